@@ -0,0 +1,56 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#if !defined(BENCH_HH)
+#    define BENCH_HH
+
+#    include <nel/log.hh>
+#    include <nel/defs.hh>
+
+#    include <time.h> // clock_gettime
+
+// Minimal timing support for the bench_*.cc examples.
+// Host only, uses the monotonic clock.
+
+namespace bench
+{
+
+inline long unsigned int now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+}
+
+// Time a run of f(), in ns.
+template<typename F>
+long unsigned int time_ns(F &&f)
+{
+    long unsigned int const b = now_ns();
+    f();
+    return now_ns() - b;
+}
+
+// Log a result line: name, time and (if bytes given) bandwidth.
+inline void report(char const *const name, long unsigned int const ns,
+                   long unsigned int const bytes = 0)
+{
+    nel::log << name << ": " << ns / 1000UL << "us";
+    if (bytes != 0 && ns != 0) {
+        // bytes/ns == GB/s, scaled to MB/s
+        nel::log << ", " << (bytes * 1000UL) / ns << "MB/s";
+    }
+    nel::log << '\n';
+}
+
+// Log a result line: name, and time per item in ns (to 2 decimal places).
+inline void report_per_item(char const *const name, long unsigned int const ns,
+                            long unsigned int const items)
+{
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    long unsigned int const frac = cns % 100UL;
+    nel::log << name << ": " << cns / 100UL << '.' << (frac < 10 ? "0" : "") << frac
+             << "ns/item\n";
+}
+
+} // namespace bench
+
+#endif // !defined(BENCH_HH)
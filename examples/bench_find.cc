@@ -0,0 +1,199 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+// Splitting a 1MB buffer of short and of long lines at each '\n', 100 times,
+// with a byte loop, libc's memchr, and Slice::find at each simd level the host has,
+// and counting the lines, and finding an int that isn't there.
+// Then splitting 4MB of records at a multi-byte separator, short and long,
+// with a double loop over Slice::slice() vs Slice::split.
+#include "bench.hh"
+
+#include <nel/slice.hh>
+#include <nel/simd.hh>
+#include <nel/log.hh>
+#include <nel/defs.hh>
+#include "libnosys_stubs.cx"
+
+#include <string.h> // memchr
+
+static constexpr nel::Count n_bytes = 1024 * 1024;
+static constexpr nel::Count n_reps = 100;
+
+static char buf[n_bytes];
+static unsigned int ints[n_bytes / sizeof(unsigned int)];
+
+static unsigned int next_rand(unsigned int &s)
+{
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return s;
+}
+
+// Lines of random length, up to 2 * avg, each ending in '\n'.
+static void fill(nel::Length const avg)
+{
+    unsigned int seed = 0x12345678;
+    nel::Index i = 0;
+    while (i < n_bytes) {
+        nel::Length const n = next_rand(seed) % (2 * avg);
+        for (nel::Index j = 0; j < n && i < n_bytes; ++j, ++i) {
+            buf[i] = char('a' + (i % 26));
+        }
+        if (i < n_bytes) { buf[i++] = '\n'; }
+    }
+}
+
+// Runs find(p, n) -> index of the next '\n' in p[0..n), or n, over the buffer,
+// as a protocol parser would, counting the lines.
+template<typename F>
+void run(char const *const name, F &&find)
+{
+    nel::Count r = 0;
+    auto t = bench::time_ns([&r, &find]() {
+        for (nel::Index k = 0; k < n_reps; ++k) {
+            nel::Index i = 0;
+            while (i < n_bytes) {
+                i += find(buf + i, n_bytes - i) + 1;
+                r += 1;
+            }
+        }
+    });
+    bench::report(name, t, n_reps * n_bytes);
+    nel::log << "  lines: " << r / n_reps << '\n';
+}
+
+static void bench_lines(nel::Length const avg)
+{
+    fill(avg);
+    nel::log << "lines of ~" << avg << " bytes\n";
+    run("  byte loop       ", [](char const *p, nel::Length const n) -> nel::Index {
+        nel::Index i = 0;
+        while (i < n && p[i] != '\n') {
+            i += 1;
+        }
+        return i;
+    });
+    run("  memchr          ", [](char const *p, nel::Length const n) -> nel::Index {
+        void const *const e = memchr(p, '\n', n);
+        return (e == nullptr) ? n : nel::Index(static_cast<char const *>(e) - p);
+    });
+
+    nel::simd::Level const top = nel::simd::max_level();
+    for (int l = int(nel::simd::Level::SCALAR); l <= int(top); ++l) {
+        nel::simd::set_level(nel::simd::Level(l));
+        nel::log << "  " << nel::simd::level() << '\n';
+        run("    Slice::find   ", [](char const *p, nel::Length const n) -> nel::Index {
+            return nel::Slice<char const>(p, n).find('\n').unwrap_or(nel::Index(n));
+        });
+        {
+            nel::Count r = 0;
+            auto const s = nel::Slice<char const>(buf, n_bytes);
+            auto t = bench::time_ns([&r, &s]() {
+                for (nel::Index k = 0; k < n_reps; ++k) {
+                    r += s.count('\n');
+                }
+            });
+            bench::report("    Slice::count  ", t, n_reps * n_bytes);
+            nel::log << "  lines: " << r / n_reps << '\n';
+        }
+    }
+    nel::simd::set_level(top);
+}
+
+static void bench_ints(void)
+{
+    nel::Length const n = sizeof(ints) / sizeof(ints[0]);
+    for (nel::Index i = 0; i < n; ++i) {
+        ints[i] = (unsigned int)i;
+    }
+    auto const s = nel::Slice<unsigned int const>(ints, n);
+    nel::log << "unsigned ints, not found\n";
+    nel::simd::Level const top = nel::simd::max_level();
+    for (int l = int(nel::simd::Level::SCALAR); l <= int(top); ++l) {
+        nel::simd::set_level(nel::simd::Level(l));
+        nel::Count r = 0;
+        auto t = bench::time_ns([&r, &s]() {
+            for (nel::Index k = 0; k < n_reps; ++k) {
+                r += s.contains(~0U) ? 1 : 0;
+            }
+        });
+        nel::log << "  " << nel::simd::level() << ' ';
+        bench::report("Slice::contains", t, n_reps * n_bytes);
+        nel::log << "  found: " << r << '\n';
+    }
+    nel::simd::set_level(top);
+}
+
+static constexpr nel::Count n_recs_bytes = 4 * n_bytes;
+static unsigned char recs[n_recs_bytes];
+
+// Records of ~200 random bytes, each ending with sep.
+static void fill_recs(nel::Slice<unsigned char const> const &sep)
+{
+    unsigned int seed = 0x12345678;
+    nel::Index i = 0;
+    while (i + sep.len() < n_recs_bytes) {
+        nel::Length const n = next_rand(seed) % 400;
+        for (nel::Index j = 0; j < n && i + sep.len() < n_recs_bytes; ++j, ++i) {
+            recs[i] = (unsigned char)(' ' + next_rand(seed) % 64);
+        }
+        for (nel::Index j = 0; j < sep.len() && i < n_recs_bytes; ++j, ++i) {
+            recs[i] = sep[j];
+        }
+    }
+}
+
+static void bench_recs(char const *const sep_str)
+{
+    nel::Length sn = 0;
+    while (sep_str[sn] != '\0') {
+        sn += 1;
+    }
+    auto const sep =
+        nel::Slice<unsigned char const>(reinterpret_cast<unsigned char const *>(sep_str), sn);
+    fill_recs(sep);
+    auto const all = nel::Slice<unsigned char const>(recs, n_recs_bytes);
+    nel::log << "records split by a " << sn << " byte separator\n";
+    {
+        nel::Count r = 0;
+        auto t = bench::time_ns([&r, &all, &sep]() {
+            for (nel::Index k = 0; k < n_reps / 10; ++k) {
+                // the naive way: compare at every position.
+                for (nel::Index i = 0; i + sep.len() <= all.len(); ++i) {
+                    if (all.slice(i, i + sep.len()) == sep) {
+                        r += 1;
+                        i += sep.len() - 1;
+                    }
+                }
+            }
+        });
+        bench::report("  double loop      ", t, n_reps / 10 * n_recs_bytes);
+        nel::log << "  records: " << r / (n_reps / 10) << '\n';
+    }
+    nel::simd::Level const top = nel::simd::max_level();
+    for (int l = int(nel::simd::Level::SCALAR); l <= int(top); ++l) {
+        nel::simd::set_level(nel::simd::Level(l));
+        nel::Count r = 0;
+        auto t = bench::time_ns([&r, &all, &sep]() {
+            for (nel::Index k = 0; k < n_reps / 10; ++k) {
+                r += all.split(sep).fold(nel::Count(0),
+                                         [](nel::Count &acc, nel::Slice<unsigned char const>) {
+                                             acc += 1;
+                                         });
+            }
+        });
+        nel::log << "  " << nel::simd::level() << ' ';
+        bench::report("Slice::split", t, n_reps / 10 * n_recs_bytes);
+        // split counts the piece after the last separator too.
+        nel::log << "  records: " << r / (n_reps / 10) - 1 << '\n';
+    }
+    nel::simd::set_level(top);
+}
+
+int main()
+{
+    bench_lines(16);
+    bench_lines(256);
+    bench_ints();
+    bench_recs("\r\n\r\n");
+    bench_recs("\n--------------------------------------------------- record ---\n");
+}
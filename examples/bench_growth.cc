@@ -0,0 +1,69 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+// Cost of heaped::Vector growth policies (see nel/heaped/growth.hh),
+// pushing 10M ints one at a time.
+#include "bench.hh"
+
+#include <nel/heaped/vector.hh>
+#include <nel/heaped/growth.hh>
+#include <nel/heaped/allocator.hh>
+#include <nel/log.hh>
+#include <nel/defs.hh>
+#include "libnosys_stubs.cx"
+
+static constexpr nel::Count n_pushes = 10 * 1000 * 1000;
+
+// Allocator counting reallocs and the bytes they may have had to copy.
+struct Counting
+{
+    public:
+        static long unsigned int reallocs;
+        static long unsigned int bytes;
+
+        static nel::Result<void *, nel::heaped::AllocError> try_malloc(nel::Length const align,
+                                                                       nel::Length const size)
+        {
+            return try_realloc(nullptr, align, 0, size);
+        }
+
+        static nel::Result<void *, nel::heaped::AllocError> try_realloc(void *const p,
+                                                                        nel::Length const align,
+                                                                        nel::Length const old_size,
+                                                                        nel::Length const new_size)
+        {
+            reallocs += 1;
+            bytes += old_size;
+            return nel::heaped::Malloc::try_realloc(p, align, old_size, new_size);
+        }
+
+        static void free(void *const p, nel::Length const align, nel::Length const size)
+        {
+            nel::heaped::Malloc::free(p, align, size);
+        }
+};
+
+long unsigned int Counting::reallocs = 0;
+long unsigned int Counting::bytes = 0;
+
+template<typename G>
+void bench_push(char const *const name)
+{
+    typedef nel::heaped::Vector<int, Counting, G> Vec;
+    Counting::reallocs = 0;
+    Counting::bytes = 0;
+    auto t = bench::time_ns([]() {
+        auto v = Vec::empty();
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+            v.push(int(i)).is_ok();
+        }
+    });
+    bench::report(name, t);
+    nel::log << "  reallocs: " << Counting::reallocs << ", bytes moved (at most): "
+             << Counting::bytes << '\n';
+}
+
+int main()
+{
+    bench_push<nel::heaped::GeometricGrowth<2, 1>>("push 10M, geometric 2x");
+    bench_push<nel::heaped::GeometricGrowth<3, 2>>("push 10M, geometric 1.5x");
+    bench_push<nel::heaped::LinearGrowth<16>>("push 10M, linear 16");
+}
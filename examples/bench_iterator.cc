@@ -0,0 +1,225 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+// Cost per item of the two iterator protocols, against a raw loop,
+// for for_each, map+first_n+fold and chain, over ints filling L1 to beyond LLC,
+// and for a wrapped heapless::Queue, whose iter() is a 2 part chain.
+//
+// RUST_LIKE is defined here, before any nel header, so both protocols are built:
+// for_each/fold drive the iterator with next() (RUST_LIKE),
+// for_each2/fold2 drive it with is_done/inc/deref (C_LIKE).
+// A protocol that is 'zero cost' should match the raw loop.
+// Adapters and chains override for_each/try_fold (internal iteration),
+// so a chain's for_each runs a loop per part, and only ++/* and next() pay per item for the join.
+#if !defined(RUST_LIKE)
+#    define RUST_LIKE
+#endif
+
+#include "bench.hh"
+
+#include <nel/heaped/vector.hh>
+#include <nel/heapless/queue.hh>
+#include <nel/iterator.hh>
+#include <nel/slice.hh>
+#include <nel/log.hh>
+#include <nel/defs.hh>
+#include "libnosys_stubs.cx"
+
+// items visited per case, whatever the size.
+static constexpr nel::Count n_total = 64 * 1000 * 1000;
+
+// working sets, in bytes: L1, L2, LLC(ish), well beyond LLC.
+static constexpr nel::Length sizes[] = {
+    16 * 1024,
+    256 * 1024,
+    4 * 1024 * 1024,
+    64 * 1024 * 1024,
+};
+
+// results are summed into here, so the work can't be optimised away.
+static volatile long unsigned int sink = 0;
+
+typedef long unsigned int Acc;
+
+template<typename F>
+void run(char const *const name, nel::Slice<int> const &s, F &&f)
+{
+    nel::Count const reps = n_total / s.len();
+    Acc r = 0;
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+        for (nel::Index i = 0; i < reps; ++i) {
+            r += f(s);
+        }
+    });
+    sink = sink + r;
+    bench::report_per_item(name, t, reps * s.len());
+}
+
+void bench_for_each(nel::Slice<int> const &s)
+{
+    run("  for_each, raw loop       ", s, [](nel::Slice<int> const &s) {
+        Acc acc = 0;
+        int const *const p = s.ptr();
+        for (nel::Index i = 0; i < s.len(); ++i) {
+            acc += Acc(p[i]);
+        }
+        return acc;
+    });
+    run("  for_each, RUST_LIKE      ", s, [](nel::Slice<int> const &s) {
+        Acc acc = 0;
+        s.iter().for_each([&acc](int const &e) { acc += Acc(e); });
+        return acc;
+    });
+    run("  for_each, C_LIKE         ", s, [](nel::Slice<int> const &s) {
+        Acc acc = 0;
+        s.iter().for_each2([&acc](int const &e) { acc += Acc(e); });
+        return acc;
+    });
+}
+
+void bench_map_first_n_fold(nel::Slice<int> const &s)
+{
+    // all but the last item, so first_n has to count.
+    nel::Count const limit = s.len() - 1;
+    run("  map+first_n+fold, raw    ", s, [limit](nel::Slice<int> const &s) {
+        Acc acc = 0;
+        int const *const p = s.ptr();
+        for (nel::Index i = 0; i < limit; ++i) {
+            acc += Acc(p[i]) * 3;
+        }
+        return acc;
+    });
+    run("  map+first_n+fold, RUST   ", s, [limit](nel::Slice<int> const &s) {
+        return s.iter()
+            .map<Acc>([](int const &e) -> Acc { return Acc(e) * 3; })
+            .first_n(limit)
+            .fold(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    });
+    run("  map+first_n+fold, C      ", s, [limit](nel::Slice<int> const &s) {
+        return s.iter()
+            .map<Acc>([](int const &e) -> Acc { return Acc(e) * 3; })
+            .first_n(limit)
+            .fold2(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    });
+}
+
+void bench_chain(nel::Slice<int> const &s)
+{
+    // the two halves, chained back together.
+    nel::Length const h = s.len() / 2;
+    run("  chain, raw loops         ", s, [h](nel::Slice<int> const &s) {
+        Acc acc = 0;
+        int const *const p = s.ptr();
+        for (nel::Index i = 0; i < h; ++i) {
+            acc += Acc(p[i]);
+        }
+        for (nel::Index i = h; i < s.len(); ++i) {
+            acc += Acc(p[i]);
+        }
+        return acc;
+    });
+    run("  chain, RUST_LIKE for_each", s, [h](nel::Slice<int> const &s) {
+        Acc acc = 0;
+        s.slice(0, h).iter().chain(s.slice(h, s.len()).iter()).for_each([&acc](int const &e) {
+            acc += Acc(e);
+        });
+        return acc;
+    });
+    run("  chain, C_LIKE for_each   ", s, [h](nel::Slice<int> const &s) {
+        Acc acc = 0;
+        s.slice(0, h).iter().chain(s.slice(h, s.len()).iter()).for_each2([&acc](int const &e) {
+            acc += Acc(e);
+        });
+        return acc;
+    });
+    // driven from outside, so chain's own for_each can't help.
+    run("  chain, RUST_LIKE next()  ", s, [h](nel::Slice<int> const &s) {
+        Acc acc = 0;
+        auto it = s.slice(0, h).iter().chain(s.slice(h, s.len()).iter());
+        while (true) {
+            auto v = it.next();
+            if (v.is_none()) { break; }
+            acc += Acc(v.unwrap());
+        }
+        return acc;
+    });
+    run("  chain, C_LIKE ++/*       ", s, [h](nel::Slice<int> const &s) {
+        Acc acc = 0;
+        auto it = s.slice(0, h).iter().chain(s.slice(h, s.len()).iter());
+        for (; it; ++it) {
+            acc += Acc(*it);
+        }
+        return acc;
+    });
+}
+
+// 16KiB of ints, half wrapped round to the front of the ring.
+static constexpr nel::Length queue_len = 4 * 1024;
+typedef nel::heapless::Queue<int, queue_len> Queue;
+static Queue queue = Queue::empty();
+
+template<typename F>
+void run_queue(char const *const name, F &&f)
+{
+    nel::Count const reps = n_total / queue_len;
+    Acc r = 0;
+    auto t = bench::time_ns([&r, &f, reps]() {
+        for (nel::Index i = 0; i < reps; ++i) {
+            r += f(queue);
+        }
+    });
+    sink = sink + r;
+    bench::report_per_item(name, t, reps * queue_len);
+}
+
+void bench_queue(nel::Slice<int> const &s)
+{
+    for (nel::Index i = 0; i < queue_len + queue_len / 2; ++i) {
+        queue.push(int(i % 1000)).unwrap();
+    }
+    // the same items, as one slice.
+    auto flat = s.slice(0, queue_len);
+    run("  queue, raw slice         ", flat, [](nel::Slice<int> const &s) {
+        Acc acc = 0;
+        int const *const p = s.ptr();
+        for (nel::Index i = 0; i < s.len(); ++i) {
+            acc += Acc(p[i]);
+        }
+        return acc;
+    });
+    run_queue("  queue, for_each          ", [](Queue &q) {
+        Acc acc = 0;
+        q.iter().for_each([&acc](int const &e) { acc += Acc(e); });
+        return acc;
+    });
+    run_queue("  queue, map+fold          ", [](Queue &q) {
+        return q.iter()
+            .map<Acc>([](int const &e) -> Acc { return Acc(e); })
+            .fold(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    });
+    run_queue("  queue, ++/*              ", [](Queue &q) {
+        Acc acc = 0;
+        for (auto it = q.iter(); it; ++it) {
+            acc += Acc(*it);
+        }
+        return acc;
+    });
+}
+
+int main()
+{
+    nel::Length const max_len = sizes[sizeof(sizes) / sizeof(sizes[0]) - 1] / sizeof(int);
+    auto v = nel::heaped::Vector<int>::with_capacity(max_len);
+    for (nel::Index i = 0; i < max_len; ++i) {
+        v.push(int(i % 1000)).unwrap();
+    }
+
+    for (nel::Length const bytes: sizes) {
+        auto s = v.slice(0, bytes / sizeof(int));
+        nel::log << "working set " << bytes / 1024 << "KiB, " << s.len() << " ints\n";
+        bench_for_each(s);
+        bench_map_first_n_fold(s);
+        bench_chain(s);
+    }
+    nel::log << "queue " << queue_len << " ints, wrapped\n";
+    bench_queue(v.slice());
+    nel::log << "sink: " << (long unsigned int)sink << '\n';
+}
@@ -0,0 +1,78 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+// Batch scoring of 8M values (a few flops each), and summing the scores,
+// on one thread vs a par::Pool with one thread per cpu.
+#include "bench.hh"
+
+#include <nel/par/pool.hh>
+#include <nel/heaped/vector.hh>
+#include <nel/slice.hh>
+#include <nel/log.hh>
+#include <nel/defs.hh>
+#include "libnosys_stubs.cx"
+
+static constexpr nel::Count n_values = 8 * 1000 * 1000;
+
+static float score(float const &v)
+{
+    // a small polynomial, standing in for a per-item model.
+    float s = v;
+    for (int i = 0; i < 16; ++i) {
+        s = s * 0.75f + v * 0.125f;
+    }
+    return s;
+}
+
+int main()
+{
+    auto in = nel::heaped::Vector<float>::with_capacity(n_values);
+    auto out = nel::heaped::Vector<float>::with_capacity(n_values);
+    for (nel::Index i = 0; i < n_values; ++i) {
+        in.push(float(i % 1000)).unwrap();
+        out.push(0.0f).unwrap();
+    }
+    nel::Slice<float const> const src = in.slice();
+    nel::Slice<float> const dst = out.slice();
+
+    {
+        auto t = bench::time_ns([&src, &dst]() {
+            for (nel::Index i = 0; i < n_values; ++i) {
+                dst.ptr()[i] = score(src.ptr()[i]);
+            }
+        });
+        bench::report("score 8M, 1 thread", t, n_values * sizeof(float));
+        nel::log << "  sum: " << (long unsigned int)dst.sum() << '\n';
+    }
+
+    {
+        double sum = 0;
+        auto t = bench::time_ns([&src, &sum]() {
+            for (nel::Index i = 0; i < n_values; ++i) {
+                sum += score(src.ptr()[i]);
+            }
+        });
+        bench::report("score+sum 8M, 1 thread", t, n_values * sizeof(float));
+        nel::log << "  sum: " << (long unsigned int)sum << '\n';
+    }
+
+    auto pool = nel::par::Pool::try_new(0).unwrap();
+    nel::log << "pool threads: " << pool.n_threads() << '\n';
+    {
+        auto t = bench::time_ns([&pool, &src, &dst]() {
+            nel::par_map_into(pool, src, dst, [](float const &v) { return score(v); })
+                .unwrap();
+        });
+        bench::report("score 8M, par_map_into", t, n_values * sizeof(float));
+        nel::log << "  sum: " << (long unsigned int)dst.sum() << '\n';
+    }
+    {
+        double sum = 0;
+        auto t = bench::time_ns([&pool, &src, &sum]() {
+            sum = nel::par_reduce(
+                      pool, src, 0.0, [](double &acc, float const &v) { acc += score(v); },
+                      [](double &acc, double &&p) { acc += p; })
+                      .unwrap();
+        });
+        bench::report("score+sum 8M, par_reduce", t, n_values * sizeof(float));
+        nel::log << "  sum: " << (long unsigned int)sum << '\n';
+    }
+}
@@ -0,0 +1,136 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+// Parsing 1MB of newline separated numbers, 10 times, summing them:
+// unsigned ints of up to 20 digits, and floats with a fraction and some with an exponent,
+// with libc's strtoull and strtod vs parse_u64 and parse_f64.
+// The sums wrap, the floats are summed as their bits, so both ways must give the same sum.
+#include "bench.hh"
+
+#include <nel/parse.hh>
+#include <nel/slice.hh>
+#include <nel/log.hh>
+#include <nel/defs.hh>
+#include "libnosys_stubs.cx"
+
+#include <cstdlib> // std::strtoull, std::strtod
+
+static constexpr nel::Count n_bytes = 1024 * 1024;
+static constexpr nel::Count n_reps = 10;
+
+typedef long unsigned int Sum;
+
+// 0 terminated, for strtod.
+static char buf[n_bytes + 1];
+
+static unsigned int next_rand(unsigned int &s)
+{
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return s;
+}
+
+// Fills the buffer with lines of put(i, seed), writing from buf[i].
+template<typename F>
+static nel::Length fill(F &&put)
+{
+    unsigned int seed = 0x12345678;
+    nel::Index i = 0;
+    while (i + 64 < n_bytes) {
+        put(i, seed);
+        buf[i++] = '\n';
+    }
+    buf[i] = '\0';
+    return i;
+}
+
+static void put_digits(nel::Index &i, unsigned int &seed, nel::Length const n)
+{
+    buf[i++] = char('1' + next_rand(seed) % 9);
+    for (nel::Index k = 1; k < n; ++k) {
+        buf[i++] = char('0' + next_rand(seed) % 10);
+    }
+}
+
+static nel::Length fill_ints(void)
+{
+    return fill([](nel::Index &i, unsigned int &seed) {
+        // mostly short, as counters and ids are.
+        nel::Length const n = (next_rand(seed) % 4 == 0) ? 1 + next_rand(seed) % 19
+                                                         : 1 + next_rand(seed) % 6;
+        put_digits(i, seed, n);
+    });
+}
+
+static nel::Length fill_floats(void)
+{
+    return fill([](nel::Index &i, unsigned int &seed) {
+        if (next_rand(seed) % 2 == 0) { buf[i++] = '-'; }
+        put_digits(i, seed, 1 + next_rand(seed) % 5);
+        buf[i++] = '.';
+        put_digits(i, seed, 1 + next_rand(seed) % 12);
+        if (next_rand(seed) % 4 == 0) {
+            buf[i++] = 'e';
+            put_digits(i, seed, 1 + next_rand(seed) % 2);
+        }
+    });
+}
+
+template<typename F>
+static void run(char const *const name, nel::Length const n, F &&parse_one)
+{
+    Sum r = 0;
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+        for (nel::Index k = 0; k < n_reps; ++k) {
+            nel::Index i = 0;
+            while (i < n) {
+                i += parse_one(buf + i, n - i, r) + 1;
+            }
+        }
+    });
+    bench::report(name, t, n_reps * n);
+    nel::log << "  sum: " << r << '\n';
+}
+
+static Sum bits(double const d)
+{
+    long unsigned int b;
+    __builtin_memcpy(&b, &d, sizeof(b));
+    return b;
+}
+
+static nel::Slice<unsigned char const> field(char const *const p, nel::Length const n)
+{
+    return nel::Slice<unsigned char const>(reinterpret_cast<unsigned char const *>(p), n);
+}
+
+int main()
+{
+    {
+        nel::Length const n = fill_ints();
+        nel::log << n << " bytes of ints\n";
+        run("  strtoull   ", n, [](char const *p, nel::Length, Sum &r) -> nel::Length {
+            char *e;
+            r += std::strtoull(p, &e, 10);
+            return nel::Length(e - p);
+        });
+        run("  parse_u64  ", n, [](char const *p, nel::Length const n, Sum &r) {
+            auto const v = nel::parse_u64(field(p, n)).unwrap();
+            r += v.first;
+            return v.second;
+        });
+    }
+    {
+        nel::Length const n = fill_floats();
+        nel::log << n << " bytes of floats\n";
+        run("  strtod     ", n, [](char const *p, nel::Length, Sum &r) -> nel::Length {
+            char *e;
+            r += bits(std::strtod(p, &e));
+            return nel::Length(e - p);
+        });
+        run("  parse_f64  ", n, [](char const *p, nel::Length const n, Sum &r) {
+            auto const v = nel::parse_f64(field(p, n)).unwrap();
+            r += bits(v.first);
+            return v.second;
+        });
+    }
+}
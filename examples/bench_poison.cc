@@ -0,0 +1,83 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+// Cost of poisoning (see NEL_POISON in nel/memory.hh) on moves and growth.
+//
+// Build default is poisoning in debug, not in release/minsize/fast,
+// compare target/debug/examples/bench_poison with target/release/examples/bench_poison.
+// The explicit on/off runs are the same in all builds.
+#include "bench.hh"
+#include "largestruct1.hh"
+
+#include <nel/heaped/vector.hh>
+#include <nel/heaped/allocator.hh>
+#include <nel/log.hh>
+#include <nel/memory.hh>
+#include <nel/defs.hh>
+#include "libnosys_stubs.cx"
+
+static constexpr Length buf_size = 64 * 1024;
+static constexpr nel::Count n_moves = 4096;
+
+// buffers to move between, byte-wise.
+static uint8_t buf1[buf_size];
+static uint8_t buf2[buf_size];
+
+void bench_moves(void)
+{
+    long unsigned int const bytes = 2UL * n_moves * buf_size;
+
+    auto t1 = bench::time_ns([]() {
+        for (Index i = 0; i < n_moves; ++i) {
+            nel::elem::copy(buf2, buf1, buf_size);
+            nel::elem::wipe(buf1, buf_size);
+            nel::elem::copy(buf1, buf2, buf_size);
+            nel::elem::wipe(buf2, buf_size);
+        }
+    });
+    bench::report("move, poisoned", t1, bytes);
+
+    auto t2 = bench::time_ns([]() {
+        for (Index i = 0; i < n_moves; ++i) {
+            nel::elem::copy(buf2, buf1, buf_size);
+            nel::elem::copy(buf1, buf2, buf_size);
+        }
+    });
+    bench::report("move, not poisoned", t2, bytes);
+
+    // what the build gives, as used by U8Buf.
+    U8Buf<buf_size> *a = new U8Buf<buf_size>((uint8_t)0x12);
+    U8Buf<buf_size> *b = new U8Buf<buf_size>((uint8_t)0x34);
+    auto t3 = bench::time_ns([a, b]() {
+        for (Index i = 0; i < n_moves; ++i) {
+            *b = nel::move(*a);
+            *a = nel::move(*b);
+        }
+    });
+    bench::report(nel::elem::poisoning ? "U8Buf move, build default (poisoned)"
+                                       : "U8Buf move, build default (not poisoned)",
+                  t3, bytes);
+    delete a;
+    delete b;
+}
+
+template<typename A>
+void bench_growth(char const *const name)
+{
+    static constexpr nel::Count n = 1000;
+    typedef nel::heaped::Vector<U8Buf<256>, A> Vec;
+    auto t = bench::time_ns([]() {
+        for (Index r = 0; r < 100; ++r) {
+            auto v = Vec::empty();
+            for (Index i = 0; i < n; ++i) {
+                v.push((uint8_t)i).is_ok();
+            }
+        }
+    });
+    bench::report(name, t);
+}
+
+int main()
+{
+    bench_moves();
+    bench_growth<nel::heaped::Poisoned<true>>("vector growth, poisoned");
+    bench_growth<nel::heaped::Poisoned<false>>("vector growth, not poisoned");
+}
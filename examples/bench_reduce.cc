@@ -0,0 +1,84 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+// Cost of summing/min-maxing/dotting 1M ints and floats, 100 times,
+// with an iterator fold vs the Slice reductions at each simd level the host has.
+#include "bench.hh"
+
+#include <nel/slice.hh>
+#include <nel/simd.hh>
+#include <nel/log.hh>
+#include <nel/defs.hh>
+#include "libnosys_stubs.cx"
+
+static constexpr nel::Count n_values = 1000 * 1000;
+static constexpr nel::Count n_reps = 100;
+
+static int ints[n_values];
+static float floats[n_values];
+
+template<typename T>
+void bench_type(T const a[], char const *const name)
+{
+    auto s = nel::Slice<T const>(a, n_values);
+    long unsigned int const bytes = n_reps * n_values * sizeof(T);
+
+    {
+        typename nel::simd::Reduce<T>::Acc r = 0;
+        auto t = bench::time_ns([&r, &s]() {
+            for (nel::Index i = 0; i < n_reps; ++i) {
+                r += s.iter().fold(typename nel::simd::Reduce<T>::Acc(0),
+                                   [](auto &acc, T const &e) { acc += e; });
+            }
+        });
+        nel::log << name << " ";
+        bench::report("sum, iter().fold", t, bytes);
+        nel::log << "  res: " << (long unsigned int)r << '\n';
+    }
+
+    nel::simd::Level const top = nel::simd::max_level();
+    for (int l = int(nel::simd::Level::SCALAR); l <= int(top); ++l) {
+        nel::simd::set_level(nel::simd::Level(l));
+        nel::log << name << " " << nel::simd::level() << '\n';
+        {
+            typename nel::simd::Reduce<T>::Acc r = 0;
+            auto t = bench::time_ns([&r, &s]() {
+                for (nel::Index i = 0; i < n_reps; ++i) {
+                    r += s.sum();
+                }
+            });
+            bench::report("  sum", t, bytes);
+            nel::log << "  res: " << (long unsigned int)r << '\n';
+        }
+        {
+            T r = 0;
+            auto t = bench::time_ns([&r, &s]() {
+                for (nel::Index i = 0; i < n_reps; ++i) {
+                    auto mm = s.min_max().unwrap();
+                    r += mm.second - mm.first;
+                }
+            });
+            bench::report("  min_max", t, bytes);
+            nel::log << "  res: " << (long unsigned int)r << '\n';
+        }
+        {
+            typename nel::simd::Reduce<T>::Acc r = 0;
+            auto t = bench::time_ns([&r, &s]() {
+                for (nel::Index i = 0; i < n_reps; ++i) {
+                    r += s.dot(s);
+                }
+            });
+            bench::report("  dot", t, 2 * bytes);
+            nel::log << "  res: " << (long unsigned int)r << '\n';
+        }
+    }
+    nel::simd::set_level(top);
+}
+
+int main()
+{
+    for (nel::Index i = 0; i < n_values; ++i) {
+        ints[i] = int(i % 1000) - 500;
+        floats[i] = float(i % 16);
+    }
+    bench_type(ints, "int");
+    bench_type(floats, "float");
+}
@@ -0,0 +1,86 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+// Looking up random keys in sorted tables of ints, from a few cache lines to beyond LLC,
+// with a linear scan (small tables only), Slice::binary_search, and an Eytzinger layout.
+#include "bench.hh"
+
+#include <nel/heaped/vector.hh>
+#include <nel/slice.hh>
+#include <nel/search.hh>
+#include <nel/sort.hh>
+#include <nel/log.hh>
+#include <nel/defs.hh>
+#include "libnosys_stubs.cx"
+
+static constexpr nel::Count n_lookups = 4 * 1000 * 1000;
+
+// table sizes, in items.
+static constexpr nel::Length sizes[] = {
+    16, 256, 4 * 1024, 64 * 1024, 1024 * 1024, 16 * 1024 * 1024,
+};
+
+// above this, a linear scan would take all day.
+static constexpr nel::Length max_linear = 4 * 1024;
+
+static unsigned int next_rand(unsigned int &s)
+{
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return s;
+}
+
+// results are summed into here, so the work can't be optimised away.
+static volatile long unsigned int sink = 0;
+
+template<typename F>
+void run(char const *const name, nel::Length const n, F &&f)
+{
+    unsigned int seed = 0x9e3779b9;
+    long unsigned int r = 0;
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+        for (nel::Index i = 0; i < n_lookups; ++i) {
+            // every other key is in the table.
+            int const key = int(next_rand(seed) % (2 * n));
+            r += f(key);
+        }
+    });
+    sink = sink + r;
+    bench::report_per_item(name, t, n_lookups);
+}
+
+int main()
+{
+    nel::Length const max_n = sizes[sizeof(sizes) / sizeof(sizes[0]) - 1];
+    auto sorted = nel::heaped::Vector<int>::with_capacity(max_n);
+    auto layout = nel::heaped::Vector<int>::with_capacity(max_n);
+    for (nel::Index i = 0; i < max_n; ++i) {
+        sorted.push(int(2 * i)).unwrap();
+        layout.push(0).unwrap();
+    }
+    nel::sort::Less less;
+
+    for (nel::Length const n: sizes) {
+        auto s = sorted.slice(0, n);
+        auto e = layout.slice(0, n);
+        nel::search::eytzinger_from(e.ptr(), s.ptr(), n);
+        nel::log << "table of " << n << " ints\n";
+
+        if (n <= max_linear) {
+            run("  linear, try_get   ", n, [&s](int const key) -> nel::Index {
+                nel::Index i = 0;
+                while (s.try_get(i).is_some() && s[i] < key) {
+                    i += 1;
+                }
+                return i;
+            });
+        }
+        run("  binary_search     ", n, [&s](int const key) -> nel::Index {
+            auto r = s.binary_search(key);
+            return r.is_ok() ? r.unwrap() : r.unwrap_err();
+        });
+        run("  eytzinger         ", n, [&e, &less, n](int const key) -> nel::Index {
+            return nel::search::eytzinger_lower_bound(e.ptr(), n, key, less);
+        });
+    }
+    nel::log << "sink: " << (long unsigned int)sink << '\n';
+}
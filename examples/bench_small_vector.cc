@@ -0,0 +1,36 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+// Cost of building many short lists (6 ints, as a per-request list)
+// in a heaped::Vector (one malloc each) vs a heaped::SmallVector<int, 8> (none).
+#include "bench.hh"
+
+#include <nel/heaped/small_vector.hh>
+#include <nel/heaped/vector.hh>
+#include <nel/log.hh>
+#include <nel/defs.hh>
+#include "libnosys_stubs.cx"
+
+static constexpr nel::Count n_lists = 1000 * 1000;
+static constexpr nel::Count n_values = 6;
+
+template<typename Vec>
+void bench_lists(char const *const name)
+{
+    long unsigned int sum = 0;
+    auto t = bench::time_ns([&sum]() {
+        for (nel::Index i = 0; i < n_lists; ++i) {
+            auto v = Vec::empty();
+            for (nel::Index j = 0; j < n_values; ++j) {
+                v.push(int(i + j)).is_ok();
+            }
+            v.iter().for_each([&sum](int const &e) { sum += (long unsigned int)e; });
+        }
+    });
+    bench::report(name, t);
+    nel::log << "  sum: " << sum << '\n';
+}
+
+int main()
+{
+    bench_lists<nel::heaped::Vector<int>>("1M lists of 6, heaped::Vector");
+    bench_lists<nel::heaped::SmallVector<int, 8>>("1M lists of 6, heaped::SmallVector<8>");
+}
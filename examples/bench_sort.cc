@@ -0,0 +1,119 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+// Sorting 1M ints, random and in the patterns quicksorts dislike,
+// with libc's qsort vs the Slice sorts, and selecting/partially sorting them.
+#include "bench.hh"
+
+#include <nel/heaped/vector.hh>
+#include <nel/slice.hh>
+#include <nel/log.hh>
+#include <nel/defs.hh>
+#include "libnosys_stubs.cx"
+
+#include <stdlib.h> // qsort
+
+static constexpr nel::Count n_values = 1000 * 1000;
+
+static unsigned int next_rand(unsigned int &s)
+{
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return s;
+}
+
+static void fill(nel::Slice<int> const &s, int const pat)
+{
+    unsigned int seed = 0x12345678;
+    int *const p = s.ptr();
+    nel::Length const n = s.len();
+    for (nel::Index i = 0; i < n; ++i) {
+        switch (pat) {
+            case 0:
+                p[i] = int(next_rand(seed) & 0x7fffffff);
+                break;
+            case 1:
+                p[i] = int(i);
+                break;
+            case 2:
+                p[i] = int(n - i);
+                break;
+            case 3:
+                p[i] = int(next_rand(seed) % 16);
+                break;
+            default:
+                // sorted, with 1% of items swapped at random.
+                p[i] = int(i);
+                if (i % 100 == 99) {
+                    nel::Index const j = next_rand(seed) % n;
+                    int const t = p[i];
+                    p[i] = p[j];
+                    p[j] = t;
+                }
+                break;
+        }
+    }
+}
+
+static char const *const pat_names[] = {
+    "random", "sorted", "reversed", "16 distinct", "1% unsorted",
+};
+
+static int cmp_int(void const *a, void const *b)
+{
+    int const x = *static_cast<int const *>(a);
+    int const y = *static_cast<int const *>(b);
+    return (x > y) - (x < y);
+}
+
+template<typename F>
+void run(char const *const name, nel::Slice<int> const &s, int const pat, F &&f)
+{
+    fill(s, pat);
+    auto t = bench::time_ns([&s, &f]() { f(s); });
+    bool sorted = true;
+    for (nel::Index i = 1; i < s.len(); ++i) {
+        sorted = sorted && !(s.ptr()[i] < s.ptr()[i - 1]);
+    }
+    bench::report_per_item(name, t, s.len());
+    if (!sorted) { nel::log << "  not sorted!\n"; }
+}
+
+int main()
+{
+    auto v = nel::heaped::Vector<int>::with_capacity(n_values);
+    auto b = nel::heaped::Vector<int>::with_capacity(n_values / 2);
+    for (nel::Index i = 0; i < n_values; ++i) {
+        v.push(0).unwrap();
+    }
+    for (nel::Index i = 0; i < n_values / 2; ++i) {
+        b.push(0).unwrap();
+    }
+    nel::Slice<int> const s = v.slice();
+    nel::Slice<int> const scratch = b.slice();
+
+    for (int pat = 0; pat < 5; ++pat) {
+        nel::log << pat_names[pat] << ", " << n_values << " ints\n";
+        run("  qsort                  ", s, pat,
+            [](nel::Slice<int> const &s) { qsort(s.ptr(), s.len(), sizeof(int), cmp_int); });
+        run("  sort_unstable          ", s, pat,
+            [](nel::Slice<int> s) { s.sort_unstable(); });
+        run("  sort, in place         ", s, pat, [](nel::Slice<int> s) { s.sort(); });
+        run("  sort_with, n/2 scratch ", s, pat,
+            [&scratch](nel::Slice<int> s) { s.sort_with(scratch); });
+    }
+
+    // the 1000 smallest, and the median, of random ints.
+    {
+        fill(s, 0);
+        auto t = bench::time_ns([&s]() { nel::Slice<int>(s).partial_sort(1000); });
+        bench::report_per_item("random, partial_sort 1000", t, s.len());
+    }
+    {
+        fill(s, 0);
+        int m = 0;
+        auto t = bench::time_ns(
+            [&s, &m]() { m = nel::Slice<int>(s).select_nth_unstable(s.len() / 2); });
+        bench::report_per_item("random, select median    ", t, s.len());
+        nel::log << "  median: " << m << '\n';
+    }
+}
@@ -0,0 +1,121 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+// Parsing 4MB of CSV-like telemetry lines ("id,name,value\n"), 10 times, summing the values:
+// copying each field into a Vector vs Slice::lines() and split(',') views,
+// and counting the words with split_whitespace.
+#include "bench.hh"
+
+#include <nel/heaped/vector.hh>
+#include <nel/slice.hh>
+#include <nel/log.hh>
+#include <nel/defs.hh>
+#include "libnosys_stubs.cx"
+
+static constexpr nel::Count n_bytes = 4 * 1024 * 1024;
+static constexpr nel::Count n_reps = 10;
+
+static unsigned char buf[n_bytes];
+
+static unsigned int next_rand(unsigned int &s)
+{
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return s;
+}
+
+// Lines of an id, a name of 4..19 letters, and a value, until the buffer is full.
+static nel::Length fill(void)
+{
+    unsigned int seed = 0x12345678;
+    nel::Index i = 0;
+    nel::Count id = 0;
+    while (i + 64 < n_bytes) {
+        auto put_num = [&i](long unsigned int v) {
+            unsigned char d[20];
+            nel::Index n = 0;
+            do {
+                d[n++] = (unsigned char)('0' + v % 10);
+                v /= 10;
+            } while (v != 0);
+            while (n > 0) {
+                buf[i++] = d[--n];
+            }
+        };
+        put_num(id++);
+        buf[i++] = ',';
+        for (nel::Index k = 4 + next_rand(seed) % 16; k > 0; --k) {
+            buf[i++] = (unsigned char)('a' + next_rand(seed) % 26);
+        }
+        buf[i++] = ',';
+        put_num(next_rand(seed) % 100000);
+        buf[i++] = '\n';
+    }
+    return i;
+}
+
+static long unsigned int to_num(unsigned char const p[], nel::Length const n)
+{
+    long unsigned int v = 0;
+    for (nel::Index i = 0; i < n; ++i) {
+        v = v * 10 + (p[i] - '0');
+    }
+    return v;
+}
+
+int main()
+{
+    nel::Length const n = fill();
+    auto const all = nel::Slice<unsigned char const>(buf, n);
+    nel::log << n << " bytes of telemetry\n";
+
+    {
+        // the allocating way: each line's fields copied out into a vector.
+        long unsigned int r = 0;
+        auto t = bench::time_ns([&r, n]() {
+            for (nel::Index k = 0; k < n_reps; ++k) {
+                nel::Index i = 0;
+                while (i < n) {
+                    auto field = nel::heaped::Vector<unsigned char>::empty();
+                    for (; i < n && buf[i] != '\n'; ++i) {
+                        if (buf[i] == ',') {
+                            field = nel::heaped::Vector<unsigned char>::empty();
+                        } else {
+                            field.push((unsigned char)buf[i]).unwrap();
+                        }
+                    }
+                    i += 1;
+                    r += to_num(field.slice().ptr(), field.len());
+                }
+            }
+        });
+        bench::report("copy fields      ", t, n_reps * n);
+        nel::log << "  sum: " << r / n_reps << '\n';
+    }
+    {
+        long unsigned int r = 0;
+        auto t = bench::time_ns([&r, &all]() {
+            for (nel::Index k = 0; k < n_reps; ++k) {
+                all.lines().for_each([&r](nel::Slice<unsigned char const> line) {
+                    auto it = line.split((unsigned char)',');
+                    it.inc();
+                    it.inc();
+                    nel::Slice<unsigned char const> const v = it.deref();
+                    r += to_num(v.ptr(), v.len());
+                });
+            }
+        });
+        bench::report("lines, split     ", t, n_reps * n);
+        nel::log << "  sum: " << r / n_reps << '\n';
+    }
+    {
+        nel::Count r = 0;
+        auto count = [](nel::Count &acc, nel::Slice<unsigned char const>) { acc += 1; };
+        auto t = bench::time_ns([&r, &all, &count]() {
+            for (nel::Index k = 0; k < n_reps; ++k) {
+                r += all.split_whitespace().fold(nel::Count(0), count);
+            }
+        });
+        bench::report("split_whitespace ", t, n_reps * n);
+        nel::log << "  words: " << r / n_reps << '\n';
+    }
+}
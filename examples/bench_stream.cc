@@ -0,0 +1,153 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+// Snapshotting a 200MB buffer with Slice::copy_from vs copy_from_streaming,
+// and what each costs a neighbour working on 4MB of its own (about an LLC's share):
+// - on one thread, the time to re-read the neighbour's (warm) 4MB after a snapshot,
+// - with 2 threads (par::Pool), the neighbour's read rate while snapshots run.
+#include "bench.hh"
+
+#include <nel/par/pool.hh>
+#include <nel/slice.hh>
+#include <nel/memory.hh>
+#include <nel/log.hh>
+#include <nel/defs.hh>
+#include "libnosys_stubs.cx"
+
+static constexpr nel::Length n_state = 200 * 1024 * 1024;
+static constexpr nel::Length n_work = 4 * 1024 * 1024;
+static constexpr nel::Count n_snaps = 5;
+
+typedef long unsigned int Word;
+
+struct Buffers
+{
+        nel::Slice<Word> src;
+        nel::Slice<Word> dst;
+        nel::Slice<Word> work;
+};
+
+static nel::Slice<Word> alloc(nel::Length const n_bytes)
+{
+    void *const p = nel::malloc_aligned(64, n_bytes);
+    nel::panic_if_not(p != nullptr, "out of memory");
+    auto s = nel::Slice<Word>(static_cast<Word *>(p), n_bytes / sizeof(Word));
+    for (nel::Index i = 0; i < s.len(); ++i) {
+        s.ptr()[i] = i;
+    }
+    return s;
+}
+
+static void snapshot(Buffers &b, bool const streaming)
+{
+    if (streaming) {
+        b.dst.copy_from_streaming(b.src);
+    } else {
+        b.dst.copy_from(b.src);
+    }
+}
+
+// One pass over the neighbour's working set, a line at a time.
+static Word touch(nel::Slice<Word> const &work)
+{
+    Word r = 0;
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+        r += work.ptr()[i];
+    }
+    return r;
+}
+
+static void one_thread(Buffers &b, bool const streaming, char const *const name)
+{
+    long unsigned int t_copy = 0;
+    long unsigned int t_reread = 0;
+    Word r = 0;
+    for (nel::Index k = 0; k < n_snaps; ++k) {
+        r += touch(b.work);
+        t_copy += bench::time_ns([&b, streaming]() { snapshot(b, streaming); });
+        t_reread += bench::time_ns([&b, &r]() { r += touch(b.work); });
+    }
+    nel::log << name << '\n';
+    bench::report("  snapshot        ", t_copy, n_snaps * n_state);
+    bench::report("  re-read 4MB     ", t_reread, n_snaps * n_work);
+    nel::log << "  sum: " << r << '\n';
+}
+
+static void baseline_reread(Buffers &b)
+{
+    Word r = touch(b.work);
+    auto t = bench::time_ns([&b, &r]() {
+        for (nel::Index k = 0; k < n_snaps; ++k) {
+            r += touch(b.work);
+        }
+    });
+    nel::log << "no snapshot\n";
+    bench::report("  re-read 4MB     ", t, n_snaps * n_work);
+    nel::log << "  sum: " << r << '\n';
+}
+
+enum class Snap {
+    None,
+    Copy,
+    Streaming,
+};
+
+// Chunk 0 snapshots (or, for Snap::None, waits about as long as snapshots take at 20GB/s),
+// chunk 1 reads its working set until chunk 0 is done.
+static void two_threads(nel::par::Pool &pool, Buffers &b, Snap const mode, char const *const name)
+{
+    int started = 0;
+    bool done = false;
+    nel::Count passes = 0;
+    long unsigned int t_neighbour = 0;
+    Word r = 0;
+    auto task = [&](nel::Index const chunk) {
+        __atomic_fetch_add(&started, 1, __ATOMIC_RELAXED);
+        while (__atomic_load_n(&started, __ATOMIC_RELAXED) < 2) {
+        }
+        if (chunk == 0) {
+            long unsigned int const b_ns = bench::now_ns();
+            for (nel::Index k = 0; k < n_snaps; ++k) {
+                if (mode != Snap::None) { snapshot(b, mode == Snap::Streaming); }
+            }
+            if (mode == Snap::None) {
+                while (bench::now_ns() - b_ns < n_snaps * n_state / 20) {
+                }
+            }
+            __atomic_store_n(&done, true, __ATOMIC_RELEASE);
+        } else {
+            long unsigned int const b_ns = bench::now_ns();
+            while (!__atomic_load_n(&done, __ATOMIC_ACQUIRE)) {
+                r += touch(b.work);
+                passes += 1;
+            }
+            t_neighbour = bench::now_ns() - b_ns;
+        }
+    };
+    pool.run(2, task).unwrap();
+    nel::log << name << '\n';
+    bench::report("  neighbour 4MB   ", t_neighbour, passes * n_work);
+    nel::log << "  passes: " << passes << " sum: " << r << '\n';
+}
+
+int main()
+{
+    Buffers b = {alloc(n_state), alloc(n_state), alloc(n_work)};
+
+    nel::log << "one thread, snapshot then re-read the neighbour's working set\n";
+    baseline_reread(b);
+    one_thread(b, false, "copy_from");
+    one_thread(b, true, "copy_from_streaming");
+
+    if (nel::par::Pool::available_parallelism() < 2) {
+        nel::log << "one cpu, no neighbour thread\n";
+    } else {
+        auto pool = nel::par::Pool::try_new(2).unwrap();
+        nel::log << "two threads, the neighbour reading while snapshots run\n";
+        two_threads(pool, b, Snap::None, "no snapshot");
+        two_threads(pool, b, Snap::Copy, "copy_from");
+        two_threads(pool, b, Snap::Streaming, "copy_from_streaming");
+    }
+
+    nel::free_aligned(b.src.ptr());
+    nel::free_aligned(b.dst.ptr());
+    nel::free_aligned(b.work.ptr());
+}
@@ -0,0 +1,410 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#if !defined(NEL_HEAPED_ALLOCATOR_HH)
+#    define NEL_HEAPED_ALLOCATOR_HH
+
+#    include <nel/defs.hh> // Length
+
+namespace nel
+{
+namespace heaped
+{
+
+enum class AllocError;
+
+struct Malloc;
+
+template<Length const N, typename A = Malloc>
+struct Aligned;
+
+template<bool const P, typename A = Malloc>
+struct Poisoned;
+
+struct AllocStats;
+
+template<typename A = Malloc>
+struct Counted;
+
+} // namespace heaped
+} // namespace nel
+
+#    include <nel/result.hh>
+#    include <nel/log.hh>
+#    include <nel/memory.hh> // malloc_aligned, elem::poisoning
+#    include <nel/panic.hh>
+#    include <nel/defs.hh>
+
+#    include <cstddef> // std::max_align_t
+#    include <cstdlib> // std::free, std::malloc, std::realloc
+
+namespace nel
+{
+namespace heaped
+{
+
+/**
+ * Reasons an allocator can fail a request.
+ */
+enum class AllocError {
+    // Allocator has no memory left to satisfy the request.
+    OutOfMemory = 1,
+    // Allocator cannot provide the alignment requested.
+    BadAlign,
+};
+
+inline Log &operator<<(Log &outs, AllocError const &val)
+{
+    switch (val) {
+        case AllocError::OutOfMemory:
+            return outs << "OutOfMemory";
+        case AllocError::BadAlign:
+            return outs << "BadAlign";
+        default:
+            break;
+    }
+    nel::panic("unknown AllocError");
+    return outs << '?';
+}
+
+/**
+ * Allocator 'concept'
+ *
+ * An allocator is a type providing the following static functions.
+ * There is no allocator instance, so no per-container state;
+ * an allocator drawing from an arena or pool keeps that state itself.
+ *
+ * ```c++
+ *  // Allocate size bytes aligned to align.
+ *  static Result<void *, AllocError> try_malloc(Length const align, Length const size);
+ *
+ *  // Grow/shrink p from old_size to new_size bytes, keeping content up to the smaller of the
+ *  // two. p may be nullptr (old_size is then 0), which behaves as try_malloc.
+ *  // On Err, p is untouched and still valid.
+ *  static Result<void *, AllocError> try_realloc(void *const p, Length const align,
+ *                                                Length const old_size, Length const new_size);
+ *
+ *  // Release p, as allocated with align and size.
+ *  // p may be nullptr.
+ *  static void free(void *const p, Length const align, Length const size);
+ * ```
+ *
+ * align and size are passed back on realloc/free so that allocators
+ * that do not keep headers (pools, arenas) know what is being returned.
+ *
+ * An allocator may also provide
+ * ```c++
+ *  // Alignment containers should give the values they allocate.
+ *  static constexpr Length min_align = N;
+ *  // Should containers poison memory not holding values.
+ *  static constexpr bool poison = P;
+ * ```
+ * see min_align_of() and poison_of().
+ */
+
+/**
+ * The alignment an allocator asks containers to give their values,
+ * A::min_align if A has one, else 1.
+ */
+template<typename A>
+constexpr Length min_align_of(void)
+{
+    if constexpr (requires { A::min_align; }) {
+        return A::min_align;
+    } else {
+        return 1;
+    }
+}
+
+/**
+ * Whether containers using allocator A poison memory not holding values,
+ * A::poison if A has one, else the build default elem::poisoning.
+ */
+template<typename A>
+constexpr bool poison_of(void)
+{
+    if constexpr (requires { A::poison; }) {
+        return A::poison;
+    } else {
+        return elem::poisoning;
+    }
+}
+
+/**
+ * Malloc
+ *
+ * Allocator over the C heap (std::malloc/std::realloc/std::free).
+ * The default for heaped containers.
+ *
+ * Alignments above alignof(std::max_align_t) are served by malloc_aligned()
+ * and friends (see memory.hh).
+ */
+struct Malloc
+{
+    public:
+        static Result<void *, AllocError> try_malloc(Length const align, Length const size)
+        {
+            return try_realloc(nullptr, align, 0, size);
+        }
+
+        static Result<void *, AllocError> try_realloc(void *const p,
+                                                      Length const align,
+                                                      Length const old_size,
+                                                      Length const new_size)
+        {
+            if (align == 0 || (align & (align - 1)) != 0) {
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+            }
+            void *const new_p = is_over_aligned(align)
+                                    ? realloc_aligned(p, align, old_size, new_size)
+                                    : std::realloc(p, new_size);
+            if (new_p == nullptr) {
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+            }
+            return Result<void *, AllocError>::Ok(new_p);
+        }
+
+        static void free(void *const p, Length const align, Length const size)
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+            }
+        }
+
+    private:
+        static constexpr bool is_over_aligned(Length const align)
+        {
+            return align > alignof(std::max_align_t);
+        }
+};
+
+/**
+ * Aligned
+ *
+ * Allocator adapter raising all allocations from A to at least N alignment.
+ * Containers using it also align their values to N (see min_align_of()),
+ * e.g. for cache-line or SIMD aligned buffers.
+ *
+ * usage:
+ * ```c++
+ *    // values start on a 64 byte boundary, and stay there as the vector grows.
+ *    auto v = nel::heaped::Vector<float, nel::heaped::Aligned<64>>::empty();
+ * ```
+ */
+template<Length const N, typename A>
+struct Aligned
+{
+        static_assert(N != 0 && (N & (N - 1)) == 0, "Aligned: N must be a power of 2");
+
+    public:
+        typedef A Upstream;
+
+        static constexpr Length min_align = N;
+        static constexpr bool poison = poison_of<A>();
+
+    private:
+        static constexpr Length align_of(Length const align)
+        {
+            return (align < N) ? N : align;
+        }
+
+    public:
+        static Result<void *, AllocError> try_malloc(Length const align, Length const size)
+        {
+            return Upstream::try_malloc(align_of(align), size);
+        }
+
+        static Result<void *, AllocError> try_realloc(void *const p,
+                                                      Length const align,
+                                                      Length const old_size,
+                                                      Length const new_size)
+        {
+            return Upstream::try_realloc(p, align_of(align), old_size, new_size);
+        }
+
+        static void free(void *const p, Length const align, Length const size)
+        {
+            Upstream::free(p, align_of(align), size);
+        }
+};
+
+/**
+ * Poisoned
+ *
+ * Allocator adapter setting whether containers using it poison
+ * memory not holding values (newly grown capacity), overriding the build
+ * default (see NEL_POISON in memory.hh).
+ *
+ * usage:
+ * ```c++
+ *    // never poison, even in debug builds.
+ *    auto v = nel::heaped::Vector<Foo, nel::heaped::Poisoned<false>>::empty();
+ * ```
+ */
+template<bool const P, typename A>
+struct Poisoned
+{
+    public:
+        typedef A Upstream;
+
+        static constexpr Length min_align = min_align_of<A>();
+        static constexpr bool poison = P;
+
+    public:
+        static Result<void *, AllocError> try_malloc(Length const align, Length const size)
+        {
+            return Upstream::try_malloc(align, size);
+        }
+
+        static Result<void *, AllocError> try_realloc(void *const p,
+                                                      Length const align,
+                                                      Length const old_size,
+                                                      Length const new_size)
+        {
+            return Upstream::try_realloc(p, align, old_size, new_size);
+        }
+
+        static void free(void *const p, Length const align, Length const size)
+        {
+            Upstream::free(p, align, size);
+        }
+};
+
+/**
+ * Totals of live allocations made through a Counted allocator.
+ */
+struct AllocStats
+{
+    public:
+        // Bytes currently allocated, as asked for by containers
+        // (so inc. their unused capacity, excl. allocator overheads).
+        Length bytes;
+        // Allocations currently live.
+        Count allocs;
+        // Highest bytes has been since start or the last Counted::reset_peak().
+        Length peak_bytes;
+
+    public:
+        friend Log &operator<<(Log &outs, AllocStats const &v)
+        {
+            outs << "AllocStats{bytes:" << v.bytes << ", allocs:" << v.allocs
+                 << ", peak_bytes:" << v.peak_bytes << '}';
+            return outs;
+        }
+};
+
+/**
+ * Counted
+ *
+ * Allocator adapter keeping process-wide totals of what is allocated through it
+ * (one set of totals per A), safe to use from multiple threads.
+ *
+ * Comparing bytes against the sum of the containers' len() shows the slack
+ * held after a load spike; shrink_to_fit() on the longer lived containers
+ * returns it, and a drop in bytes confirms it.
+ *
+ * usage:
+ * ```c++
+ *    typedef nel::heaped::Counted<> Heap;
+ *    auto v = nel::heaped::Vector<Foo, Heap>::empty();
+ *    ...
+ *    nel::log << Heap::stats() << '\n';
+ * ```
+ */
+template<typename A>
+struct Counted
+{
+    public:
+        typedef A Upstream;
+
+        static constexpr Length min_align = min_align_of<A>();
+        static constexpr bool poison = poison_of<A>();
+
+    private:
+        static inline Length bytes_ = 0;
+        static inline Count allocs_ = 0;
+        static inline Length peak_bytes_ = 0;
+
+        static void add_bytes(Length const n)
+        {
+            Length const b = __atomic_add_fetch(&bytes_, n, __ATOMIC_RELAXED);
+            Length p = __atomic_load_n(&peak_bytes_, __ATOMIC_RELAXED);
+            while (b > p && !__atomic_compare_exchange_n(&peak_bytes_, &p, b, true,
+                                                         __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            }
+        }
+
+        static void sub_bytes(Length const n)
+        {
+            __atomic_sub_fetch(&bytes_, n, __ATOMIC_RELAXED);
+        }
+
+    public:
+        static Result<void *, AllocError> try_malloc(Length const align, Length const size)
+        {
+            auto r = Upstream::try_malloc(align, size);
+            if (r.is_ok()) {
+                __atomic_add_fetch(&allocs_, 1, __ATOMIC_RELAXED);
+                add_bytes(size);
+            }
+            return r;
+        }
+
+        static Result<void *, AllocError> try_realloc(void *const p,
+                                                      Length const align,
+                                                      Length const old_size,
+                                                      Length const new_size)
+        {
+            auto r = Upstream::try_realloc(p, align, old_size, new_size);
+            if (r.is_ok()) {
+                if (p == nullptr) { __atomic_add_fetch(&allocs_, 1, __ATOMIC_RELAXED); }
+                if (new_size > old_size) {
+                    add_bytes(new_size - old_size);
+                } else {
+                    sub_bytes(old_size - new_size);
+                }
+            }
+            return r;
+        }
+
+        static void free(void *const p, Length const align, Length const size)
+        {
+            if (p != nullptr) {
+                __atomic_sub_fetch(&allocs_, 1, __ATOMIC_RELAXED);
+                sub_bytes(size);
+            }
+            Upstream::free(p, align, size);
+        }
+
+    public:
+        /**
+         * Current totals.
+         *
+         * Each total is read atomically, but not all of them together.
+         *
+         * @returns the totals.
+         */
+        static AllocStats stats(void)
+        {
+            AllocStats s;
+            s.bytes = __atomic_load_n(&bytes_, __ATOMIC_RELAXED);
+            s.allocs = __atomic_load_n(&allocs_, __ATOMIC_RELAXED);
+            s.peak_bytes = __atomic_load_n(&peak_bytes_, __ATOMIC_RELAXED);
+            return s;
+        }
+
+        /**
+         * Restart peak tracking from the current bytes allocated.
+         */
+        static void reset_peak(void)
+        {
+            __atomic_store_n(&peak_bytes_, __atomic_load_n(&bytes_, __ATOMIC_RELAXED),
+                             __ATOMIC_RELAXED);
+        }
+};
+
+} // namespace heaped
+} // namespace nel
+
+#endif // !defined(NEL_HEAPED_ALLOCATOR_HH)
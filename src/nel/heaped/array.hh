@@ -7,13 +7,16 @@ namespace nel
 namespace heaped
 {
 
-template<typename T>
+struct Malloc;
+
+template<typename T, typename A = Malloc>
 struct Array;
 
 } // namespace heaped
 } // namespace nel
 
 #    include <nel/heaped/node.hh>
+#    include <nel/heaped/allocator.hh>
 #    include <nel/iterator.hh>
 #    include <nel/slice.hh>
 #    include <nel/optional.hh>
@@ -22,6 +25,7 @@ struct Array;
 #    include <nel/panic.hh>
 
 #    include <nel/new.hh> // new
+#    include <nel/traits.hh> // TriviallyRelocatable
 #    include <nel/defs.hh>
 
 namespace nel
@@ -33,6 +37,7 @@ namespace heaped
  * An array of type T of fixed size
  *
  * The array is created and managed on the heap.
+ * Memory is obtained from the allocator A (see heaped/allocator.hh).
  * Array can be moved in O(1) (no byte-moving happens)
  * Array is not default copyable, if a copy is required it's an explicit try_copy
  * Can create an empty array: ::empty().
@@ -43,14 +48,15 @@ namespace heaped
 // TODO: put size of array in type, i.e. template<typename T, Length N>
 // would mean types checked at compile time
 // cannot move to array of diff size.. checked at compile time
-template<typename T>
+template<typename T, typename A>
 struct Array
 {
     public:
         typedef T Type;
+        typedef A Allocator;
 
     private:
-        typedef Node<Type> ArrayNode;
+        typedef Node<Type, Allocator> ArrayNode;
         // Cannot use new/delete as created using malloc/realloc.
         // and cannot use unique_ptr as using malloc/realloc.
         // or: how can i use realloc in c++ with new/delete?
@@ -268,6 +274,29 @@ struct Array
             return slice().slice(b, e);
         }
 
+        /**
+         * Returns the number of bytes allocated on the heap.
+         *
+         * Includes the node header, excludes allocator overheads.
+         * An array is allocated to fit, so has no unused capacity.
+         *
+         * @returns the bytes allocated.
+         */
+        constexpr Length allocated_bytes(void) const
+        {
+            return (item_ == nullptr) ? 0 : ArrayNode::size_of(item_->capacity());
+        }
+
+        /**
+         * Returns the number of bytes used by the array, itself and its allocation.
+         *
+         * @returns the bytes used.
+         */
+        constexpr Length memory_usage(void) const
+        {
+            return sizeof(Array) + allocated_bytes();
+        }
+
         /**
          * Create an iterator over the contents of the Array.
          *
@@ -306,6 +335,14 @@ struct Array
 };
 
 } // namespace heaped
+
+// Array only holds a pointer to its node, so can be relocated byte-wise.
+template<typename T, typename A>
+struct TriviallyRelocatable<heaped::Array<T, A>>
+{
+        static constexpr bool value = true;
+};
+
 } // namespace nel
 
 #endif // !defined(NEL_HEAPED_ARRAY_HH)
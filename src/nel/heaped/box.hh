@@ -7,17 +7,22 @@ namespace nel
 namespace heaped
 {
 
-template<typename T>
+struct Malloc;
+
+template<typename T, typename A = Malloc>
 struct Box;
 
 } // namespace heaped
 } // namespace nel
 
+#    include <nel/heaped/allocator.hh>
 #    include <nel/result.hh>
 #    include <nel/element.hh>
 #    include <nel/panic.hh>
+#    include <nel/traits.hh> // TriviallyRelocatable
 #    include <nel/defs.hh>
 #    include <nel/memory.hh> // move,forward
+#    include <nel/new.hh> // new (p) T()
 
 namespace nel
 {
@@ -26,14 +31,18 @@ namespace heaped
 
 /**
  * A T on the heap, owned (a bit like std::unique_ptr)
+ *
+ * Memory is obtained from the allocator A (see heaped/allocator.hh),
+ * e.g. heaped::Pool for many short-lived boxes of the same size.
  */
-template<typename T>
+template<typename T, typename A>
 struct Box
 {
     public:
         // heh, blatant rust-ism
         typedef Box Self;
         typedef T Type;
+        typedef A Allocator;
 
     private:
         typedef Element<Type> ElementT;
@@ -45,10 +54,35 @@ struct Box
         {
         }
 
+        // Allocate and create an element in-place.
+        // Returns nullptr if allocation fails, and args are not consumed.
+        template<typename... Args>
+        static ElementT *create(Args &&...args)
+        {
+            auto r = Allocator::try_malloc(alignof(ElementT), sizeof(ElementT));
+            if (r.is_err()) { return nullptr; }
+            return new (r.unwrap()) ElementT(forward<Args>(args)...);
+        }
+
+        static void destroy(ElementT *const p)
+        {
+            if (p == nullptr) { return; }
+            p->~ElementT();
+            Allocator::free(p, alignof(ElementT), sizeof(ElementT));
+        }
+
+        template<typename... Args>
+        static ElementT *checked_create(Args &&...args)
+        {
+            ElementT *const p = create(forward<Args>(args)...);
+            nel::panic_if(p == nullptr, "heaped::Box: out of memory");
+            return p;
+        }
+
     public:
         constexpr ~Box(void)
         {
-            if (value_ != nullptr) { delete value_; }
+            destroy(value_);
         }
 
         // No default, must create a T.
@@ -72,21 +106,23 @@ struct Box
         constexpr Box &operator=(Box &&o)
         {
             if (this != &o) {
+                destroy(value_);
                 value_ = o.value_;
                 o.value_ = nullptr;
             }
             return *this;
         }
 
+        // Panics if allocation fails, use try_from to handle that.
         constexpr Box(Type &&v)
-            : value_(new ElementT(forward<Type>(v)))
+            : value_(checked_create(forward<Type>(v)))
         {
         }
 
         // works for moving-into as well.
         template<typename... Args>
         constexpr Box(Args &&...args)
-            : value_(new ElementT(forward<Args>(args)...))
+            : value_(checked_create(forward<Args>(args)...))
         {
         }
 
@@ -95,13 +131,13 @@ struct Box
          * Create a boxed T by moving existing into the box.
          *
          * @param val The value to move into the box
-         * @returns on success, Optional::Some
-         * @returns of fail, Optional::None
+         * @returns on success, Result::Ok holding the box.
+         * @returns on fail, Result::Err holding val.
          */
         constexpr static Result<Box, Type> try_from(Type &&val)
         {
-            // for new: on fail, val not moved
-            ElementT *const p = new ElementT(move(val));
+            // on fail, val not moved
+            ElementT *const p = create(move(val));
             if (p == nullptr) { return Result<Box, Type>::Err(move(val)); }
             return Result<Box, Type>::Ok(move(Box(p)));
         }
@@ -156,6 +192,28 @@ struct Box
             return has_value();
         }
 
+        /**
+         * Returns the number of bytes allocated on the heap for the value.
+         *
+         * Excludes allocator overheads.
+         *
+         * @returns the bytes allocated, 0 if no value.
+         */
+        constexpr Length allocated_bytes(void) const
+        {
+            return (value_ == nullptr) ? 0 : sizeof(ElementT);
+        }
+
+        /**
+         * Returns the number of bytes used by the box, itself and its allocation.
+         *
+         * @returns the bytes used.
+         */
+        constexpr Length memory_usage(void) const
+        {
+            return sizeof(Box) + allocated_bytes();
+        }
+
         /**
          * Removes and returns the value contained in the box.
          *
@@ -168,7 +226,7 @@ struct Box
         {
             nel::panic_if_not(has_value(), "not a value");
             Type t = move(*(*value_));
-            delete value_;
+            destroy(value_);
             value_ = nullptr;
             return t;
         }
@@ -178,6 +236,14 @@ struct Box
 };
 
 } // namespace heaped
+
+// Box only holds a pointer to its value, so can be relocated byte-wise.
+template<typename T, typename A>
+struct TriviallyRelocatable<heaped::Box<T, A>>
+{
+        static constexpr bool value = true;
+};
+
 } // namespace nel
 
 #endif // !defined(NEL_HEAPED_BOX_HH)
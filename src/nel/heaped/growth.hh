@@ -0,0 +1,89 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#if !defined(NEL_HEAPED_GROWTH_HH)
+#    define NEL_HEAPED_GROWTH_HH
+
+#    include <nel/defs.hh> // Count
+
+namespace nel
+{
+namespace heaped
+{
+
+template<Count const NUM = 2, Count const DEN = 1>
+struct GeometricGrowth;
+
+template<Count const Q = 16>
+struct LinearGrowth;
+
+} // namespace heaped
+} // namespace nel
+
+namespace nel
+{
+namespace heaped
+{
+
+/**
+ * Growth policy 'concept'
+ *
+ * A growth policy decides the capacity a container (re)allocates to
+ * when it needs room for more (or fewer) values.
+ * It is a type providing the following static function.
+ *
+ * ```c++
+ *  // Capacity to allocate, holding cur, when cap is needed.
+ *  // Must be at least cap.
+ *  static constexpr Count capacity_for(Count const cur, Count const cap);
+ * ```
+ */
+
+/**
+ * GeometricGrowth
+ *
+ * Grow capacity by a factor of NUM/DEN (2x by default, 1.5x with <3, 2>),
+ * so pushing n values one at a time costs O(log n) reallocs and O(n) copies.
+ * Shrinks to exactly what is asked.
+ * The default for heaped::Vector.
+ */
+template<Count const NUM, Count const DEN>
+struct GeometricGrowth
+{
+        static_assert(NUM > DEN, "GeometricGrowth: factor must be > 1");
+
+    public:
+        // Smallest non-zero capacity grown to, saves the first few tiny reallocs.
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            if (cap <= cur) { return cap; }
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+            return (cap < g) ? g : cap;
+        }
+};
+
+/**
+ * LinearGrowth
+ *
+ * Round capacity up to the next multiple of Q.
+ * Pushing n values one at a time costs O(n/Q) reallocs, but never has more
+ * than Q spare, so suits memory-tight targets.
+ */
+template<Count const Q>
+struct LinearGrowth
+{
+        static_assert(Q > 0, "LinearGrowth: quanta must be > 0");
+
+    public:
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            NEL_UNUSED(cur);
+            if (cap == 0) { return 0; }
+            return cap - cap % Q + Q;
+        }
+};
+
+} // namespace heaped
+} // namespace nel
+
+#endif // !defined(NEL_HEAPED_GROWTH_HH)
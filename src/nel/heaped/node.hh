@@ -7,12 +7,15 @@ namespace nel
 namespace heaped
 {
 
-template<typename T>
+struct Malloc;
+
+template<typename T, typename A = Malloc>
 struct Node;
 
 } // namespace heaped
 } // namespace nel
 
+#    include <nel/heaped/allocator.hh>
 #    include <nel/iterator.hh>
 #    include <nel/optional.hh>
 #    include <nel/result.hh>
@@ -23,27 +26,43 @@ struct Node;
 #    include <nel/memory.hh> // move,forward
 #    include <nel/new.hh> // new (p) T()
 
-#    include <cstdlib> // std::free, std::malloc, std::realloc
-
 namespace nel
 {
 namespace heaped
 {
 
-template<typename T>
+/**
+ * Node
+ *
+ * The heap block behind heaped::Vector and heaped::Array.
+ * A header (capacity, in-use count) followed by the values.
+ * Memory is obtained from the allocator A (see heaped/allocator.hh).
+ * Values are aligned to alignof(T), or to A's min_align if greater.
+ * Newly grown capacity is poisoned if poison_of<A>().
+ */
+template<typename T, typename A>
 struct Node
 {
     public:
         typedef T Type;
+        typedef A Allocator;
 
     private:
+        static constexpr Length values_align =
+            (alignof(T) < min_align_of<A>()) ? min_align_of<A>() : alignof(T);
+
         // Number allocated.
         Length alloc_;
         // Number initialised.
         Length len_;
         // Treat as a C struct and use malloc/free to manage..
         // Meh, C++ does not like flexible arrays.
-        Type values_[1];
+        // In a union so the implicit member dtor does not also destroy values_[0],
+        // ~Node destroys the len_ initialised values itself.
+        union
+        {
+                alignas(values_align) Type values_[1];
+        };
 
     public:
         // Manually do a delete.
@@ -55,21 +74,29 @@ struct Node
 #        pragma GCC diagnostic ignored "-Wclass-memaccess"
 #    endif
         // Meh, cannot use new/delete.
-        // Make own using malloc/free.
+        // Make own using the allocator's malloc/free.
         // But, can use realloc for better growing..
-        // TODO: handle alignment..
-        // An aligning malloc?
+        // Alignment is handled by the allocator, alignof(Node) includes values_align.
         static void free(Node *old)
         {
-            if (old != nullptr) { old->~Node(); }
-            std::free(old);
+            if (old == nullptr) { return; }
+            Length const sz = size_of(old->alloc_);
+            old->~Node();
+            Allocator::free(old, alignof(Node), sz);
+        }
+
+        // Largest number of values a node can hold, keeping its size within ISize.
+        static constexpr Count max_capacity = (__PTRDIFF_MAX__ - sizeof(Node)) / sizeof(T);
+
+        // Size in bytes of a node holding cap values.
+        // alignof(T) is included in align of Node.
+        static constexpr Length size_of(Count const cap)
+        {
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
         }
 
         // Want to have realloc usage (better realloc characteristics)
-        // which means C based impl (yuk).
-        // Could rewrite allocator interaface to have a realloc func
-        // but why isn't this present already? (what reasoning why not?)
-        // TODO: handle alignment issues here..
+        // which is why the allocator interface has a realloc func.
         // How does C++ handle variable length structs?
         // static bool is_aligned(void *p)
         // {
@@ -84,25 +111,51 @@ struct Node
             return new_n;
         }
 
+        /**
+         * Grow or shrink the node to hold new_cap values.
+         *
+         * @param old_n the node to resize, or nullptr to allocate a new one.
+         * @param new_cap the number of values to make room for.
+         *
+         * @returns on success, the resized node (may have moved).
+         * @returns on fail, nullptr, old_n is then untouched and still valid.
+         */
         static Node *realloc(Node *const old_n, Count const new_cap)
         {
-            // Size of region to allocate excluding align padding.
-            // Assume alignof(T) is included in align of Node.
-            Count new_sz = sizeof(Node) - sizeof(T) + new_cap * sizeof(T);
-            Count old_sz
-                = (old_n == nullptr) ? 0 : sizeof(Node) - sizeof(T) + old_n->alloc_ * sizeof(T);
+            // Too big to address, size_of() would overflow.
+            if (new_cap > max_capacity) { return nullptr; }
 
-            // Check that max_align is multiple of align (i.e. is realign necessary..)
-            // If it isn't, then becomes:
-            Node *const new_n = reinterpret_cast<Node *>(std::realloc(old_n, new_sz));
-            if (new_n == nullptr) { return nullptr; }
+            // Size of region to allocate excluding align padding.
+            Length const new_sz = size_of(new_cap);
+            Length const old_sz = (old_n == nullptr) ? 0 : size_of(old_n->alloc_);
+
+            Node *new_n;
+            if constexpr (is_trivially_relocatable<T>) {
+                // realloc may move the values byte-wise.
+                auto r = Allocator::try_realloc(old_n, alignof(Node), old_sz, new_sz);
+                // Remember, if realloc fails, then old is still valid..
+                if (r.is_err()) { return nullptr; }
+                new_n = reinterpret_cast<Node *>(r.unwrap());
+            } else {
+                // values must be moved by their move-ctor, so a new node.
+                auto r = Allocator::try_malloc(alignof(Node), new_sz);
+                if (r.is_err()) { return nullptr; }
+                new_n = reinterpret_cast<Node *>(r.unwrap());
+                if (old_n != nullptr) {
+                    nel::assert(old_n->len_ <= new_cap, "heaped::Node: shrinking below len");
+                    new_n->len_ = old_n->len_;
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+                    Allocator::free(old_n, alignof(Node), old_sz);
+                }
+            }
 
-            // Remember, if realloc fails, then old is still valid..
             // nel_assert(is_aligned(new_n));
-            if (new_sz > old_sz) {
-                // clear new memory,
-                // assumes realloc adds to end
-                elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+            if constexpr (poison_of<Allocator>()) {
+                if (new_sz > old_sz) {
+                    // poison new memory,
+                    // assumes realloc adds to end
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+                }
             }
             new_n->alloc_ = new_cap;
             return new_n;
@@ -279,10 +332,44 @@ struct Node
         }
 #    endif
 
+        // Copy n values from s onto the end.
+        // Caller must have made room.
+        void push_back_copies(Type const s[], Count const n)
+        {
+            nel::assert(len() + n <= capacity(), "heaped::Node: no room");
+            elem::copy_uninit(&values_[len_], s, n);
+            len_ += n;
+        }
+
+        // Relocate n values from s onto the end, s is left uninitialised.
+        // Caller must have made room.
+        void push_back_relocated(Type s[], Count const n)
+        {
+            nel::assert(len() + n <= capacity(), "heaped::Node: no room");
+            elem::relocate(&values_[len_], s, n);
+            len_ += n;
+        }
+
+        // Relocate all values from o onto the end, leaving o empty.
+        // Caller must have made room.
+        void push_back_relocated(Node &o)
+        {
+            push_back_relocated(o.values_, o.len_);
+            o.len_ = 0;
+        }
+
+        // Relocate the last n values to d, d must be uninitialised.
+        void pop_back_relocated(Type d[], Count const n)
+        {
+            nel::assert(n <= len(), "heaped::Node: not enough values");
+            len_ -= n;
+            elem::relocate(d, &values_[len_], n);
+        }
+
         // rename to try_pop_back?
         Optional<Type> pop_back(void)
         {
-            if (len() == 0) { return Optional<Type>::None(); }
+            if (len() == 0) { return None; }
 
             len_ -= 1;
             auto &e = values_[len()];
@@ -292,6 +379,73 @@ struct Node
             return o;
         }
 
+        // Insert val at idx, shifting later values up one.
+        // Caller must have made room.
+        Result<void, Type> insert_at(Index const idx, Type &&val)
+        {
+            if (idx > len() || len() >= capacity()) { return Result<void, Type>::Err(move(val)); }
+            elem::relocate(&values_[idx + 1], &values_[idx], len() - idx);
+            new (&values_[idx]) Type(move(val));
+            len_ += 1;
+            return Result<void, Type>::Ok();
+        }
+
+        // Remove the value at idx, shifting later values down one.
+        Optional<Type> remove_at(Index const idx)
+        {
+            if (idx >= len()) { return None; }
+            auto o = Some(move(values_[idx]));
+            values_[idx].~Type();
+            elem::relocate(&values_[idx], &values_[idx + 1], len() - idx - 1);
+            len_ -= 1;
+            return o;
+        }
+
+        // Remove (destroy) the values in [b, e), shifting later values down.
+        Count remove_range(Index const b, Index e)
+        {
+            if (e > len()) { e = len(); }
+            if (b >= e) { return 0; }
+            for (Index i = b; i < e; ++i) {
+                values_[i].~Type();
+            }
+            elem::relocate(&values_[b], &values_[e], len() - e);
+            len_ -= e - b;
+            return e - b;
+        }
+
+        // Remove the value at idx, replacing it with the last value.
+        Optional<Type> swap_remove(Index const idx)
+        {
+            if (idx >= len()) { return None; }
+            auto o = Some(move(values_[idx]));
+            values_[idx].~Type();
+            len_ -= 1;
+            elem::relocate(&values_[idx], &values_[len()], (idx != len()) ? 1 : 0);
+            return o;
+        }
+
+        // Keep only values pred is true for, keeping order.
+        template<typename F>
+        void retain(F &&pred)
+        {
+            // write position, and start of the run of kept values still to move.
+            Index w = 0;
+            Index run = 0;
+            for (Index i = 0; i < len(); ++i) {
+                if (!pred(const_cast<Type const &>(values_[i]))) {
+                    // move kept run down in one go.
+                    elem::relocate(&values_[w], &values_[run], i - run);
+                    w += i - run;
+                    values_[i].~Type();
+                    run = i + 1;
+                }
+            }
+            elem::relocate(&values_[w], &values_[run], len() - run);
+            w += len() - run;
+            len_ = w;
+        }
+
     public:
         constexpr auto iter(void) const
         {
@@ -0,0 +1,332 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#if !defined(NEL_HEAPED_POOL_HH)
+#    define NEL_HEAPED_POOL_HH
+
+namespace nel
+{
+namespace heaped
+{
+
+struct Malloc;
+
+template<typename A = Malloc>
+struct Pool;
+
+} // namespace heaped
+} // namespace nel
+
+#    include <nel/heaped/allocator.hh>
+#    include <nel/result.hh>
+#    include <nel/defs.hh>
+
+#    include <cstddef> // std::max_align_t
+#    include <cstring> // std::memcpy
+
+// The lock-free free-lists need a double-word compare-and-swap.
+// 64 bit targets have one inline or via libatomic, 32 bit ones without an
+// inline 8 byte one (e.g. Cortex-M, which has no libatomic either)
+// guard each list with a critical section instead.
+// Override with -DNEL_HEAPED_POOL_LOCKED=0/1.
+#    if !defined(NEL_HEAPED_POOL_LOCKED)
+#        if __SIZEOF_POINTER__ == 4 && !defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)
+#            define NEL_HEAPED_POOL_LOCKED 1
+#        else
+#            define NEL_HEAPED_POOL_LOCKED 0
+#        endif
+#    endif
+
+namespace nel
+{
+namespace heaped
+{
+
+/**
+ * Pool
+ *
+ * A size-class pool allocator (see heaped/allocator.hh for the allocator 'concept').
+ *
+ * Requests of up to max_block bytes are rounded up to a power-of-2 size class
+ * and served from a free-list per class, O(1) for both malloc and free.
+ * Larger (or over-aligned) requests are passed to the upstream allocator A.
+ *
+ * Blocks are carved from chunks taken from A, and are never given back to A,
+ * so the pool holds on to its high-water mark per class.
+ * Capacity can be reserved up front with try_reserve() to keep A out
+ * of the hot path entirely.
+ *
+ * The free-lists are lock-free (a tagged Treiber stack), so a pool can be
+ * shared between threads.
+ * The tag needs a double-word compare-and-swap, so link with libatomic
+ * where the target does not have one inline.
+ * 32 bit targets without one (see NEL_HEAPED_POOL_LOCKED) guard each list
+ * with a critical section instead, on Cortex-M by masking interrupts, so
+ * a pool can also be used from interrupt handlers there.
+ *
+ * usage:
+ * ```c++
+ *    typedef nel::heaped::Box<Foo, nel::heaped::Pool<>> FooBox;
+ *    nel::heaped::Pool<>::try_reserve(sizeof(Foo), 1000).unwrap();
+ * ```
+ */
+template<typename A>
+struct Pool
+{
+    public:
+        typedef A Upstream;
+
+        // Smallest block, must be able to hold a free-list link,
+        // and be aligned to max_align_t.
+        static constexpr Length min_block = alignof(std::max_align_t);
+        // Largest block, anything bigger goes upstream.
+        static constexpr Length max_block = 512;
+        // Size of chunks taken from upstream when a class runs dry.
+        static constexpr Length chunk_size = 4096;
+
+    private:
+        struct Block
+        {
+                Block *next_;
+        };
+
+#    if NEL_HEAPED_POOL_LOCKED
+        // Critical section over a free-list, for as long as it is in scope.
+        struct Lock
+        {
+            private:
+#        if defined(__ARM_ARCH_PROFILE) && __ARM_ARCH_PROFILE == 'M'
+                // Single core, so masking interrupts is enough.
+                uint32_t primask_;
+
+            public:
+                explicit Lock(bool &)
+                {
+                    __asm__ volatile("mrs %0, primask\n\tcpsid i" : "=r"(primask_)::"memory");
+                }
+
+                ~Lock(void)
+                {
+                    __asm__ volatile("msr primask, %0" ::"r"(primask_) : "memory");
+                }
+#        else
+                bool &held_;
+
+            public:
+                explicit Lock(bool &held)
+                    : held_(held)
+                {
+                    while (__atomic_test_and_set(&held_, __ATOMIC_ACQUIRE)) {}
+                }
+
+                ~Lock(void)
+                {
+                    __atomic_clear(&held_, __ATOMIC_RELEASE);
+                }
+#        endif
+        };
+
+        struct FreeList
+        {
+            private:
+                Block *top_;
+                bool held_;
+
+            public:
+                // Push the chain [first..last] onto the list.
+                void push(Block *const first, Block *const last)
+                {
+                    Lock const lock(held_);
+                    last->next_ = top_;
+                    top_ = first;
+                }
+
+                // Pop a block from the list, nullptr if empty.
+                Block *pop(void)
+                {
+                    Lock const lock(held_);
+                    Block *const b = top_;
+                    if (b != nullptr) { top_ = b->next_; }
+                    return b;
+                }
+        };
+#    else
+        struct alignas(2 * sizeof(void *)) Head
+        {
+                Block *top_;
+                USize tag_;
+        };
+
+        struct FreeList
+        {
+            private:
+                Head head_;
+
+            public:
+                // Push the chain [first..last] onto the list.
+                void push(Block *const first, Block *const last)
+                {
+                    Head old;
+                    Head nu;
+                    __atomic_load(&head_, &old, __ATOMIC_RELAXED);
+                    do {
+                        // atomic, as a pop() may be reading it, see there.
+                        __atomic_store_n(&last->next_, old.top_, __ATOMIC_RELAXED);
+                        nu.top_ = first;
+                        nu.tag_ = old.tag_ + 1;
+                    } while (!__atomic_compare_exchange(
+                        &head_, &old, &nu, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+                }
+
+                // Pop a block from the list, nullptr if empty.
+                Block *pop(void)
+                {
+                    Head old;
+                    Head nu;
+                    __atomic_load(&head_, &old, __ATOMIC_ACQUIRE);
+                    do {
+                        if (old.top_ == nullptr) { return nullptr; }
+                        // This read races on purpose: top_ may already be popped, and its
+                        // next_ rewritten by a push(), by another thread. The block is never
+                        // returned upstream so is still readable, and the tag will have
+                        // moved on so the exchange fails and the value is not used.
+                        // Atomic, so the race is not undefined behaviour.
+                        nu.top_ = __atomic_load_n(&old.top_->next_, __ATOMIC_RELAXED);
+                        nu.tag_ = old.tag_ + 1;
+                    } while (!__atomic_compare_exchange(
+                        &head_, &old, &nu, true, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE));
+                    return old.top_;
+                }
+        };
+#    endif // NEL_HEAPED_POOL_LOCKED
+
+        // Number of size classes, min_block..max_block in powers of 2.
+        static constexpr Count n_classes = __builtin_ctzl(max_block / min_block) + 1;
+
+        static inline FreeList lists_[n_classes] = {};
+
+    private:
+        static constexpr bool is_pooled(Length const align, Length const size)
+        {
+            return size <= max_block && align <= min_block;
+        }
+
+        // Index of the size class serving size bytes.
+        static constexpr Index class_of(Length const size)
+        {
+            Index i = 0;
+            for (Length b = min_block; b < size; b *= 2) {
+                i += 1;
+            }
+            return i;
+        }
+
+        static constexpr Length block_size(Index const cls)
+        {
+            return min_block << cls;
+        }
+
+        // Take a chunk of n blocks from upstream, link them into a chain.
+        // Returns the first, and sets last.
+        static Result<Block *, AllocError> try_new_chain(Index const cls,
+                                                         Count const n,
+                                                         Block *&last)
+        {
+            Length const bsz = block_size(cls);
+            auto r = Upstream::try_malloc(min_block, bsz * n);
+            if (r.is_err()) { return Result<Block *, AllocError>::Err(r.unwrap_err()); }
+            uint8_t *const chunk = reinterpret_cast<uint8_t *>(r.unwrap());
+
+            Block *first = reinterpret_cast<Block *>(chunk);
+            Block *b = first;
+            for (Index i = 1; i < n; ++i) {
+                Block *const nb = reinterpret_cast<Block *>(chunk + i * bsz);
+                b->next_ = nb;
+                b = nb;
+            }
+            b->next_ = nullptr;
+            last = b;
+            return Result<Block *, AllocError>::Ok(first);
+        }
+
+    public:
+        /**
+         * Reserve blocks for n allocations of size bytes.
+         *
+         * @param size size of the allocations to reserve for.
+         * @param n number of allocations to reserve for.
+         *
+         * @returns on success, Ok.
+         * @returns on fail, Err with why upstream failed.
+         *
+         * @note no effect if size is too big to be pooled.
+         */
+        static Result<void, AllocError> try_reserve(Length const size, Count const n)
+        {
+            if (n == 0 || !is_pooled(min_block, size)) { return Result<void, AllocError>::Ok(); }
+            Index const cls = class_of(size);
+            Block *last = nullptr;
+            auto r = try_new_chain(cls, n, last);
+            if (r.is_err()) { return Result<void, AllocError>::Err(r.unwrap_err()); }
+            lists_[cls].push(r.unwrap(), last);
+            return Result<void, AllocError>::Ok();
+        }
+
+        static Result<void *, AllocError> try_malloc(Length const align, Length const size)
+        {
+            if (!is_pooled(align, size)) { return Upstream::try_malloc(align, size); }
+
+            Index const cls = class_of(size);
+            Block *b = lists_[cls].pop();
+            if (b == nullptr) {
+                // ran dry, refill with a chunk, keep the first for this request.
+                Length const bsz = block_size(cls);
+                Count const n = (chunk_size < bsz) ? 1 : chunk_size / bsz;
+                Block *last = nullptr;
+                auto r = try_new_chain(cls, n, last);
+                if (r.is_err()) { return Result<void *, AllocError>::Err(r.unwrap_err()); }
+                b = r.unwrap();
+                if (b->next_ != nullptr) { lists_[cls].push(b->next_, last); }
+            }
+            return Result<void *, AllocError>::Ok(b);
+        }
+
+        static Result<void *, AllocError> try_realloc(void *const p,
+                                                      Length const align,
+                                                      Length const old_size,
+                                                      Length const new_size)
+        {
+            if (p == nullptr) { return try_malloc(align, new_size); }
+
+            bool const old_pooled = is_pooled(align, old_size);
+            bool const new_pooled = is_pooled(align, new_size);
+            if (!old_pooled && !new_pooled) {
+                return Upstream::try_realloc(p, align, old_size, new_size);
+            }
+            if (old_pooled && new_pooled && class_of(old_size) == class_of(new_size)) {
+                // still fits the block it's in.
+                return Result<void *, AllocError>::Ok(p);
+            }
+
+            auto r = try_malloc(align, new_size);
+            if (r.is_err()) { return r; }
+            void *const new_p = r.unwrap();
+            std::memcpy(new_p, p, (old_size < new_size) ? old_size : new_size);
+            free(p, align, old_size);
+            return Result<void *, AllocError>::Ok(new_p);
+        }
+
+        static void free(void *const p, Length const align, Length const size)
+        {
+            if (p == nullptr) { return; }
+            if (!is_pooled(align, size)) {
+                Upstream::free(p, align, size);
+                return;
+            }
+            Block *const b = reinterpret_cast<Block *>(p);
+            lists_[class_of(size)].push(b, b);
+        }
+};
+
+} // namespace heaped
+} // namespace nel
+
+#endif // !defined(NEL_HEAPED_POOL_HH)
@@ -7,28 +7,36 @@ namespace nel
 namespace heaped
 {
 
-template<typename T>
+struct Malloc;
+
+template<typename T, typename A = Malloc>
 struct RC;
 
 } // namespace heaped
 } // namespace nel
 
+#    include <nel/heaped/allocator.hh>
 #    include <nel/element.hh>
 #    include <nel/panic.hh>
+#    include <nel/traits.hh> // TriviallyRelocatable
 #    include <nel/defs.hh>
+#    include <nel/memory.hh> // move,forward
+#    include <nel/new.hh> // new (p) T()
 
 namespace nel
 {
 namespace heaped
 {
 
-template<typename T>
+template<typename T, typename A>
 struct RC
 {
         // Contained value on the heap.
         // Single threaded reference counted sharing.
+        // Memory is obtained from the allocator A (see heaped/allocator.hh).
     public:
         typedef T Type;
+        typedef A Allocator;
 
     private:
         struct Node
@@ -59,6 +67,16 @@ struct RC
                 }
 
             public:
+                // Allocate and create a node in-place, pre-grabbed.
+                // Panics if allocation fails.
+                template<typename... Args>
+                static Node *create(Args &&...args)
+                {
+                    auto r = Allocator::try_malloc(alignof(Node), sizeof(Node));
+                    nel::panic_if(r.is_err(), "heaped::RC: out of memory");
+                    return new (r.unwrap()) Node(forward<Args>(args)...);
+                }
+
                 // Could be members, but then it'll end up with 'delete this' in the release impl..
                 // which I don't want.
                 constexpr static Node *grab(Node *const v)
@@ -71,7 +89,10 @@ struct RC
                 {
                     if (v != nullptr) {
                         v->n_refs_ -= 1;
-                        if (v->n_refs_ == 0) { delete v; }
+                        if (v->n_refs_ == 0) {
+                            v->~Node();
+                            Allocator::free(v, alignof(Node), sizeof(Node));
+                        }
                     }
                 }
 
@@ -177,14 +198,14 @@ struct RC
 
     public:
         constexpr RC(Type &&v)
-            : node_(new Node(move(v)))
+            : node_(Node::create(move(v)))
         {
             // Node created pre-grabbed.
         }
 
         template<typename... Args>
         constexpr RC(Args &&...args)
-            : node_(new Node(forward<Args>(args)...))
+            : node_(Node::create(forward<Args>(args)...))
         {
             // Node created pre-grabbed.
         }
@@ -224,6 +245,29 @@ struct RC
             return node_ != nullptr && node_->has_value();
         }
 
+        /**
+         * Returns the number of bytes allocated on the heap for the shared node.
+         *
+         * The node is shared by all references, so is counted by each of them.
+         * Includes the reference count, excludes allocator overheads.
+         *
+         * @returns the bytes allocated, 0 if no node.
+         */
+        constexpr Length allocated_bytes(void) const
+        {
+            return (node_ == nullptr) ? 0 : sizeof(Node);
+        }
+
+        /**
+         * Returns the number of bytes used by the rc, itself and its (shared) allocation.
+         *
+         * @returns the bytes used.
+         */
+        constexpr Length memory_usage(void) const
+        {
+            return sizeof(RC) + allocated_bytes();
+        }
+
         /**
          * Removes and returns the value contained in the box.
          *
@@ -268,6 +312,14 @@ struct RC
 };
 
 } // namespace heaped
+
+// RC only holds a pointer to its shared node, so can be relocated byte-wise.
+template<typename T, typename A>
+struct TriviallyRelocatable<heaped::RC<T, A>>
+{
+        static constexpr bool value = true;
+};
+
 } // namespace nel
 
 #endif // !defined(NEL_HEAPED_RC_HH)
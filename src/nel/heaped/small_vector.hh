@@ -0,0 +1,513 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#if !defined(NEL_HEAPED_SMALL_VECTOR_HH)
+#    define NEL_HEAPED_SMALL_VECTOR_HH
+
+#    include <nel/defs.hh> // Count, Length
+
+namespace nel
+{
+namespace heaped
+{
+
+struct Malloc;
+
+template<Count const NUM, Count const DEN>
+struct GeometricGrowth;
+
+template<typename T, Length const N, typename A = Malloc, typename G = GeometricGrowth<2, 1>>
+struct SmallVector;
+
+} // namespace heaped
+} // namespace nel
+
+#    include <nel/heaped/node.hh>
+#    include <nel/heaped/allocator.hh>
+#    include <nel/heaped/growth.hh>
+#    include <nel/manual.hh>
+#    include <nel/iterator.hh>
+#    include <nel/slice.hh>
+#    include <nel/optional.hh>
+#    include <nel/result.hh>
+#    include <nel/log.hh>
+#    include <nel/memory.hh> // move, relocate
+#    include <nel/new.hh> //  placement new
+#    include <nel/traits.hh> // TriviallyRelocatable
+#    include <nel/defs.hh>
+
+namespace nel
+{
+namespace heaped
+{
+
+/**
+ * SmallVector
+ *
+ * A container of type T held in a contiguous block (a variable sized array.)
+ * The first N values are held within itself (as heapless::Vector),
+ * so small vectors never allocate.
+ * Pushing past N moves all values to a heap node (as heaped::Vector),
+ * from then on capacity is limited only by ram and grows as the growth policy G
+ * decides (see heaped/growth.hh).
+ * Memory is obtained from the allocator A (see heaped/allocator.hh).
+ * Cannot be implicitly coped.
+ * Can be implicitly moved, moving values one by one while inline.
+ */
+template<typename T, Length const N, typename A, typename G>
+struct SmallVector
+{
+        static_assert(N > 0, "SmallVector: inline capacity must be > 0, else use heaped::Vector");
+
+    public:
+        typedef T Type;
+        typedef A Allocator;
+        typedef G Growth;
+
+    private:
+        typedef Node<Type, Allocator> VectorNode;
+
+        // Heap node holding the values, or nullptr while they are inline.
+        VectorNode *item_;
+
+        // Number initialised inline, only used while item_ is nullptr.
+        Length len_;
+
+        // Must create with N uninitialised.
+        Manual<Type[N]> elems_;
+
+        constexpr Type *inline_ptr(void)
+        {
+            return elems_.ptr()[0];
+        }
+
+        constexpr Type const *inline_ptr(void) const
+        {
+            return elems_.ptr()[0];
+        }
+
+    public:
+        /**
+         * destroy the vector, deleting all elements owned by it.
+         */
+        ~SmallVector(void)
+        {
+            if (item_ != nullptr) {
+                VectorNode::free(item_);
+            } else {
+                for (Index i = 0; i < len_; ++i) {
+                    inline_ptr()[i].~Type();
+                }
+            }
+        }
+
+        // default ctor is safe, will always succeed.
+        constexpr SmallVector(void)
+            : item_(nullptr)
+            , len_(0)
+        {
+        }
+
+        // No copying..
+        SmallVector(SmallVector const &o) = delete;
+        SmallVector &operator=(SmallVector const &o) = delete;
+
+        // moving ok.
+        // heap values stay where they are, inline values are relocated.
+        SmallVector(SmallVector &&o)
+            : item_(move(o.item_))
+            , len_(move(o.len_))
+        {
+            if (item_ == nullptr) { elem::relocate(inline_ptr(), o.inline_ptr(), len_); }
+            o.item_ = nullptr;
+            o.len_ = 0;
+        }
+
+        SmallVector &operator=(SmallVector &&o)
+        {
+            if (this != &o) {
+                this->~SmallVector();
+                new (this) SmallVector(move(o));
+            }
+            return *this;
+        }
+
+    public:
+        /**
+         * Create a vector with no initial allocation.
+         *
+         * @returns the vector created.
+         */
+        static constexpr SmallVector empty(void)
+        {
+            return SmallVector();
+        }
+
+        /**
+         * Create a vector able to hold cap values before (re)allocating.
+         *
+         * If cap fits inline, no allocation is made.
+         * If the allocation fails, the vector is created inline.
+         *
+         * @param cap The number of elements to initially allocate.
+         *
+         * @returns the vector.
+         */
+        static SmallVector with_capacity(Count const cap)
+        {
+            SmallVector v;
+            if (cap > N) { v.item_ = VectorNode::malloc(cap); }
+            return v;
+        }
+
+    public:
+        /**
+         * Returns the number of items currently in the allocation
+         *
+         * Is N while the values are inline.
+         *
+         * @returns the current allocation amount.
+         */
+        constexpr Count capacity(void) const
+        {
+            return (item_ == nullptr) ? N : item_->capacity();
+        }
+
+        /**
+         * Returns the number of items currently in use.
+         *
+         * @returns the current in use count.
+         */
+        constexpr Length len(void) const
+        {
+            return (item_ == nullptr) ? len_ : item_->len();
+        }
+
+        /**
+         * Determines if the vector is empty (i.e. in-use count of 0).
+         *
+         * @returns true if in-use is 0, else false.
+         */
+        constexpr bool is_empty(void) const
+        {
+            return len() == 0;
+        }
+
+        /**
+         * Determines if the values are held inline (i.e. no heap allocation).
+         *
+         * @returns true if inline, false if on the heap.
+         */
+        constexpr bool is_inline(void) const
+        {
+            return item_ == nullptr;
+        }
+
+        /**
+         * Clears the vector, i.e. removes and destroys all in-use elements.
+         *
+         * Any heap allocation is kept.
+         */
+        void clear(void)
+        {
+            if (item_ != nullptr) {
+                item_->clear();
+            } else {
+                for (Index i = 0; i < len_; ++i) {
+                    inline_ptr()[i].~Type();
+                }
+                len_ = 0;
+            }
+        }
+
+        /**
+         * Return a reference to the value at idx or None.
+         *
+         * @param idx index of element to get
+         *
+         * @returns If idx is out-of range, return None.
+         * @returns else return ref to item at index..
+         */
+        constexpr Optional<Type &> try_get(Index idx)
+        {
+            return slice().try_get(idx);
+        }
+
+        constexpr Optional<Type const &> try_get(Index idx) const
+        {
+            return slice().try_get(idx);
+        }
+
+        /**
+         * Cast this vector into a full slice?
+         *
+         * Creates a slice from the vector.
+         * Slice does not own the contents, vector does (vector is still valid).
+         * Slice is invalidated if SmallVector goes out of scope/destroyed,
+         * or is pushed to (may move to the heap).
+         *
+         * @returns a slice over the the vector.
+         */
+        constexpr Slice<Type> slice(void)
+        {
+            return (item_ == nullptr) ? Slice<Type>(inline_ptr(), len_) : item_->slice();
+        }
+
+        constexpr Slice<Type const> slice(void) const
+        {
+            return (item_ == nullptr) ? Slice<Type const>(inline_ptr(), len_)
+                                      : static_cast<VectorNode const *>(item_)->slice();
+        }
+
+        /**
+         * Get a partial slice over the range of elements in the SmallVector.
+         *
+         * @param b the start index of the range to slice.
+         * @param e the end index of the range to slice.
+         *
+         * @returns if vec is empty, return empty slice
+         * @returns if b >= vec len, return empty slice
+         * @returns if e > vec len, clamp to last elem.
+         * @returns else return slice over region b..e of vec.
+         */
+        constexpr Slice<Type> slice(Index b, Index e)
+        {
+            return slice().slice(b, e);
+        }
+
+        constexpr Slice<Type const> slice(Index b, Index e) const
+        {
+            return slice().slice(b, e);
+        }
+
+    private:
+        // Move the inline values to a new heap node of cap values.
+        bool spill(Count const cap)
+        {
+            VectorNode *n = VectorNode::malloc(cap);
+            if (n == nullptr) { return false; }
+            n->push_back_relocated(inline_ptr(), len_);
+            len_ = 0;
+            item_ = n;
+            return true;
+        }
+
+        // Make room for n more values, only ever grows.
+        bool try_reserve_for(Count const n)
+        {
+            if (len() + n <= capacity()) { return true; }
+            return try_reserve(len() + n);
+        }
+
+    public:
+        /**
+         * Change the internal allocation to given number of elements.
+         *
+         * While inline, only grows, moving the values to the heap if new_cap > N.
+         * Once on the heap, as heaped::Vector::try_reserve, the allocation made is
+         * as the growth policy decides and is never less than len().
+         *
+         * @param new_cap the new allocation to set.
+         *
+         * @returns true if (re)allocation succeeded.
+         * @returns false otherwise.
+         */
+        bool try_reserve(Count new_cap)
+        {
+            if (item_ == nullptr) {
+                if (new_cap <= N) { return true; }
+                return spill(Growth::capacity_for(N, new_cap));
+            }
+
+            new_cap = Growth::capacity_for(capacity(), new_cap);
+            if (new_cap < len()) { new_cap = len(); }
+            if (new_cap == item_->capacity()) { return true; }
+
+            VectorNode *p = VectorNode::realloc(item_, new_cap);
+            if (p == nullptr) { return false; }
+            item_ = p;
+            return true;
+        }
+
+        /**
+         * Release unused capacity.
+         *
+         * Moves the values back inline if they fit,
+         * else reallocates to exactly len() values, bypassing the growth policy.
+         *
+         * @returns true if (re)allocation succeeded or was not needed.
+         * @returns false otherwise, the vector is unchanged.
+         */
+        bool shrink_to_fit(void)
+        {
+            if (item_ == nullptr || len() == item_->capacity()) { return true; }
+            if (len() <= N) {
+                len_ = item_->len();
+                item_->pop_back_relocated(inline_ptr(), len_);
+                VectorNode::free(item_);
+                item_ = nullptr;
+                return true;
+            }
+            VectorNode *p = VectorNode::realloc(item_, len());
+            if (p == nullptr) { return false; }
+            item_ = p;
+            return true;
+        }
+
+        /**
+         * Returns the number of bytes allocated on the heap.
+         *
+         * 0 while inline. Once on the heap, includes the node header and
+         * unused capacity, excludes allocator overheads.
+         *
+         * @returns the bytes allocated.
+         */
+        constexpr Length allocated_bytes(void) const
+        {
+            return (item_ == nullptr) ? 0 : VectorNode::size_of(item_->capacity());
+        }
+
+        /**
+         * Returns the number of bytes used by the vector, itself (inc. inline storage)
+         * and its allocation.
+         *
+         * @returns the bytes used.
+         */
+        constexpr Length memory_usage(void) const
+        {
+            return sizeof(SmallVector) + allocated_bytes();
+        }
+
+        /**
+         * Push a value onto the end of the vec.
+         *
+         * Moves the values to the heap if they no longer fit inline.
+         *
+         * @param val The value to move into the vec.
+         * @returns if successful, Result<void, T>::Ok()
+         * @returns if unsuccessful, Result<void, T>::Err() holding val
+         */
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+        {
+            if (!try_reserve_for(1)) { return Result<void, Type>::Err(move(val)); }
+            if (item_ != nullptr) { return item_->push_back(move(val)); }
+            new (&inline_ptr()[len_]) Type(move(val));
+            len_ += 1;
+            return Result<void, Type>::Ok();
+        }
+
+        /**
+         * Copy the values of a slice onto the end of the vec.
+         *
+         * Reserves once, then copies in bulk (a byte copy if T is trivially copyable).
+         *
+         * @param s the slice of values to copy.
+         * @returns if successful, Result<void, Slice>::Ok()
+         * @returns if unsuccessful, Result<void, Slice>::Err() holding s, vec is unchanged.
+         */
+        Result<void, Slice<Type const>> NEL_WARN_UNUSED_RESULT
+        extend_from_slice(Slice<Type const> const s)
+        {
+            if (s.is_empty()) { return Result<void, Slice<Type const>>::Ok(); }
+            if (!try_reserve_for(s.len())) { return Result<void, Slice<Type const>>::Err(s); }
+            if (item_ != nullptr) {
+                item_->push_back_copies(s.ptr(), s.len());
+            } else {
+                elem::copy_uninit(&inline_ptr()[len_], s.ptr(), s.len());
+                len_ += s.len();
+            }
+            return Result<void, Slice<Type const>>::Ok();
+        }
+
+        /**
+         * Push the values from an iterator onto the end of the vec.
+         *
+         * Reserves once for the values the iterator is sure to have (its size_hint()).
+         *
+         * @param it the iterator to take values from.
+         * @returns if successful, Result<void, It>::Ok()
+         * @returns if unsuccessful, Result<void, It>::Err() holding the iterator,
+         *          at the first value not pushed.
+         */
+        template<typename It>
+        Result<void, It> NEL_WARN_UNUSED_RESULT extend(It it)
+        {
+            if (!try_reserve_for(it.size_hint().lower)) { return Result<void, It>::Err(move(it)); }
+            for (; !it.is_done(); it.inc()) {
+                if (!try_reserve_for(1)) { return Result<void, It>::Err(move(it)); }
+                if (item_ != nullptr) {
+                    // cannot fail, room has been made.
+                    item_->push_back(it.deref());
+                } else {
+                    new (&inline_ptr()[len_]) Type(it.deref());
+                    len_ += 1;
+                }
+            }
+            return Result<void, It>::Ok();
+        }
+
+        /**
+         * Remove and return the last item in the vec.
+         *
+         * Values on the heap stay there.
+         *
+         * @returns on success: Optional::Some holding the value
+         * @returns on fail: Optional::None
+         */
+        Optional<Type> pop(void)
+        {
+            if (item_ != nullptr) { return item_->pop_back(); }
+            if (len_ == 0) { return None; }
+            len_ -= 1;
+            Type &e = inline_ptr()[len_];
+            auto o = Some(move(e));
+            e.~Type();
+            return o;
+        }
+
+    public:
+        /**
+         * Create an iterator over the contents of the SmallVector.
+         *
+         * iterator is invalidated if vector goes out of scope/destroyed.
+         *
+         * @returns The iterator.
+         */
+        constexpr auto iter(void) const
+        {
+            return slice().iter();
+        }
+
+        constexpr auto iter(void)
+        {
+            return slice().iter();
+        }
+
+    public:
+        /**
+         * Format/emit a representation of this object as a charstring
+         * for debugging purposes.
+         *
+         * @param val the value to format
+         * @param outs the stream to dump the representation into.
+         */
+        friend Log &operator<<(Log &outs, SmallVector const &v)
+        {
+            outs << "SmallVector<" << N << ">(" << v.len() << "){";
+            outs << v.iter();
+            outs << '}';
+            return outs;
+        }
+};
+
+} // namespace heaped
+
+// SmallVector holds no pointers to itself, so can be relocated byte-wise
+// if its inline values can.
+template<typename T, Length const N, typename A, typename G>
+struct TriviallyRelocatable<heaped::SmallVector<T, N, A, G>>
+{
+        static constexpr bool value = is_trivially_relocatable<T>;
+};
+
+} // namespace nel
+
+#endif // !defined(NEL_HEAPED_SMALL_VECTOR_HH)
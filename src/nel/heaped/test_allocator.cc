@@ -0,0 +1,269 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#include <nel/heaped/allocator.hh>
+#include <nel/heaped/vector.hh>
+#include <nel/heaped/array.hh>
+
+#include <catch2/catch.hpp>
+
+namespace nel
+{
+namespace test
+{
+namespace heaped
+{
+namespace allocator
+{
+
+// Allocator that counts calls, passing through to Malloc.
+struct Counting
+{
+    public:
+        static int mallocs;
+        static int reallocs;
+        static int frees;
+        static bool fail;
+
+        static void reset(void)
+        {
+            mallocs = reallocs = frees = 0;
+            fail = false;
+        }
+
+        static Result<void *, nel::heaped::AllocError> try_malloc(Length const align,
+                                                                  Length const size)
+        {
+            mallocs += 1;
+            return try_realloc(nullptr, align, 0, size);
+        }
+
+        static Result<void *, nel::heaped::AllocError>
+        try_realloc(void *const p, Length const align, Length const old_size, Length const new_size)
+        {
+            reallocs += 1;
+            if (fail) {
+                return Result<void *, nel::heaped::AllocError>::Err(
+                    nel::heaped::AllocError::OutOfMemory);
+            }
+            return nel::heaped::Malloc::try_realloc(p, align, old_size, new_size);
+        }
+
+        static void free(void *const p, Length const align, Length const size)
+        {
+            if (p != nullptr) { frees += 1; }
+            nel::heaped::Malloc::free(p, align, size);
+        }
+};
+
+int Counting::mallocs = 0;
+int Counting::reallocs = 0;
+int Counting::frees = 0;
+bool Counting::fail = false;
+
+TEST_CASE("heaped::Malloc", "[heaped][allocator]")
+{
+    {
+        // can allocate, grow and free.
+        auto r1 = nel::heaped::Malloc::try_malloc(alignof(int), 4 * sizeof(int));
+        REQUIRE(r1.is_ok());
+        int *p = reinterpret_cast<int *>(r1.unwrap());
+        p[0] = 1;
+        p[3] = 4;
+
+        auto r2 = nel::heaped::Malloc::try_realloc(p, alignof(int), 4 * sizeof(int),
+                                                   100 * sizeof(int));
+        REQUIRE(r2.is_ok());
+        p = reinterpret_cast<int *>(r2.unwrap());
+        // content kept on growth
+        REQUIRE(p[0] == 1);
+        REQUIRE(p[3] == 4);
+
+        nel::heaped::Malloc::free(p, alignof(int), 100 * sizeof(int));
+    }
+
+    {
+        // freeing nullptr is ok
+        nel::heaped::Malloc::free(nullptr, alignof(int), 0);
+    }
+}
+
+static bool is_aligned(void const *const p, Length const align)
+{
+    return (reinterpret_cast<USize>(p) & (align - 1)) == 0;
+}
+
+TEST_CASE("heaped::Malloc, over aligned", "[heaped][allocator]")
+{
+    {
+        // alignment kept through growth, and content kept.
+        auto r1 = nel::heaped::Malloc::try_malloc(256, 10);
+        REQUIRE(r1.is_ok());
+        uint8_t *p = reinterpret_cast<uint8_t *>(r1.unwrap());
+        REQUIRE(is_aligned(p, 256));
+        for (uint8_t i = 0; i < 10; ++i) {
+            p[i] = i;
+        }
+
+        for (Length sz = 10; sz < 100000; sz *= 3) {
+            auto r2 = nel::heaped::Malloc::try_realloc(p, 256, sz, sz * 3);
+            REQUIRE(r2.is_ok());
+            p = reinterpret_cast<uint8_t *>(r2.unwrap());
+            REQUIRE(is_aligned(p, 256));
+            for (uint8_t i = 0; i < 10; ++i) {
+                REQUIRE(p[i] == i);
+            }
+        }
+        nel::heaped::Malloc::free(p, 256, 10 * 3 * 3 * 3 * 3 * 3 * 3 * 3 * 3 * 3);
+    }
+
+    {
+        // alignment must be a power of 2.
+        auto r1 = nel::heaped::Malloc::try_malloc(48, 10);
+        REQUIRE(r1.is_err());
+        REQUIRE(r1.unwrap_err() == nel::heaped::AllocError::BadAlign);
+    }
+}
+
+struct alignas(128) OverAligned
+{
+        int v;
+
+        OverAligned(int v_): v(v_) {}
+};
+
+TEST_CASE("heaped::Vector<T>, over aligned T", "[heaped][allocator]")
+{
+    auto a1 = nel::heaped::Vector<OverAligned>::empty();
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(a1.push(i).is_ok());
+        REQUIRE(is_aligned(&a1.try_get(0).unwrap(), 128));
+    }
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(a1.try_get(i).unwrap().v == i);
+    }
+}
+
+TEST_CASE("heaped::Vector<T, Aligned<N>>", "[heaped][allocator]")
+{
+    // values aligned to N, and stay so as vector grows.
+    auto a1 = nel::heaped::Vector<float, nel::heaped::Aligned<64>>::empty();
+    for (int i = 0; i < 1000; ++i) {
+        REQUIRE(a1.push(float(i)).is_ok());
+        REQUIRE(is_aligned(&a1.try_get(0).unwrap(), 64));
+    }
+    REQUIRE(a1.try_get(999).unwrap() == 999.0f);
+
+    auto a2 = nel::heaped::Array<uint8_t, nel::heaped::Aligned<64>>::filled(1, 5);
+    REQUIRE(is_aligned(&a2.try_get(0).unwrap(), 64));
+}
+
+TEST_CASE("heaped::Poisoned<P, A>", "[heaped][allocator]")
+{
+    CHECK(nel::heaped::poison_of<nel::heaped::Malloc>() == nel::elem::poisoning);
+    CHECK(nel::heaped::poison_of<nel::heaped::Poisoned<true>>());
+    CHECK(!nel::heaped::poison_of<nel::heaped::Poisoned<false>>());
+    // adapters keep each others settings.
+    CHECK(!nel::heaped::poison_of<nel::heaped::Aligned<64, nel::heaped::Poisoned<false>>>());
+    CHECK(nel::heaped::min_align_of<nel::heaped::Poisoned<false, nel::heaped::Aligned<64>>>()
+          == 64);
+
+    {
+        // unused capacity is poisoned.
+        auto a1 = nel::heaped::Vector<uint8_t, nel::heaped::Poisoned<true>>::with_capacity(8);
+        REQUIRE(a1.push(1).is_ok());
+        uint8_t const *p = &a1.try_get(0).unwrap();
+        for (Index i = 1; i < 8; ++i) {
+            REQUIRE(p[i] == 0xa5);
+        }
+    }
+}
+
+TEST_CASE("heaped::Vector<T, A>", "[heaped][allocator]")
+{
+    {
+        // vector allocates using the allocator given.
+        Counting::reset();
+        {
+            auto a1 = nel::heaped::Vector<int, Counting>::empty();
+            REQUIRE(Counting::reallocs == 0);
+
+            a1.push(1).is_ok();
+            REQUIRE(Counting::reallocs == 1);
+            REQUIRE(a1.len() == 1);
+            REQUIRE(a1.try_get(0).unwrap() == 1);
+        }
+        // and releases using it.
+        REQUIRE(Counting::frees == 1);
+    }
+
+    {
+        // allocator failure is reported as push failure, value is returned.
+        Counting::reset();
+        auto a1 = nel::heaped::Vector<int, Counting>::empty();
+        Counting::fail = true;
+        auto r = a1.push(3);
+        REQUIRE(r.is_err());
+        REQUIRE(r.unwrap_err() == 3);
+        REQUIRE(a1.is_empty());
+    }
+
+    {
+        // failed growth leaves existing content intact.
+        Counting::reset();
+        auto a1 = nel::heaped::Vector<int, Counting>::with_capacity(1);
+        a1.push(1).is_ok();
+        Counting::fail = true;
+        REQUIRE(!a1.try_reserve(1000));
+        REQUIRE(a1.len() == 1);
+        REQUIRE(a1.try_get(0).unwrap() == 1);
+        Counting::fail = false;
+    }
+}
+
+TEST_CASE("heaped::Array<T, A>", "[heaped][allocator]")
+{
+    Counting::reset();
+    {
+        // array allocates using the allocator given.
+        auto a1 = nel::heaped::Array<int, Counting>::filled(2, 5);
+        REQUIRE(Counting::reallocs == 1);
+        REQUIRE(a1.len() == 5);
+    }
+    // and releases using it.
+    REQUIRE(Counting::frees == 1);
+}
+
+TEST_CASE("heaped::Counted", "[heaped][allocator]")
+{
+    // own tag type, so totals are not shared with other tests.
+    typedef nel::heaped::Counted<nel::heaped::Aligned<8>> Heap;
+
+    REQUIRE(Heap::stats().bytes == 0);
+    REQUIRE(Heap::stats().allocs == 0);
+    {
+        auto v1 = nel::heaped::Vector<int, Heap>::with_capacity(100);
+        auto const b = Heap::stats().bytes;
+        REQUIRE(b == v1.allocated_bytes());
+        REQUIRE(Heap::stats().allocs == 1);
+        REQUIRE(Heap::stats().peak_bytes == b);
+
+        // slack is returned, peak remembers the spike.
+        REQUIRE(v1.push(1).is_ok());
+        REQUIRE(v1.shrink_to_fit());
+        REQUIRE(Heap::stats().bytes == v1.allocated_bytes());
+        REQUIRE(Heap::stats().bytes < b);
+        REQUIRE(Heap::stats().peak_bytes == b);
+
+        Heap::reset_peak();
+        REQUIRE(Heap::stats().peak_bytes == v1.allocated_bytes());
+
+        auto a1 = nel::heaped::Array<int, Heap>::filled(2, 5);
+        REQUIRE(Heap::stats().allocs == 2);
+    }
+    REQUIRE(Heap::stats().bytes == 0);
+    REQUIRE(Heap::stats().allocs == 0);
+}
+
+} // namespace allocator
+} // namespace heaped
+} // namespace test
+} // namespace nel
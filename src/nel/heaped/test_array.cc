@@ -354,6 +354,18 @@ TEST_CASE("heaped::Array::try_get", "[heaped][array]")
     }
 }
 
+TEST_CASE("heaped::Array::allocated_bytes", "[heaped][array]")
+{
+    auto a1 = nel::heaped::Array<int>::empty();
+    REQUIRE(a1.allocated_bytes() == 0);
+    REQUIRE(a1.memory_usage() == sizeof(a1));
+
+    auto a2 = nel::heaped::Array<int>::filled(2, 10);
+    REQUIRE(a2.allocated_bytes() >= 10 * sizeof(int));
+    REQUIRE(a2.allocated_bytes() < 10 * sizeof(int) + 64);
+    REQUIRE(a2.memory_usage() == sizeof(a2) + a2.allocated_bytes());
+}
+
 }; // namespace array
 }; // namespace heaped
 }; // namespace test
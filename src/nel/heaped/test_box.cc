@@ -120,6 +120,18 @@ TEST_CASE("heaped::Box::eq", "[heaped][box]")
 }
 #endif
 
+TEST_CASE("heaped::Box::allocated_bytes", "[heaped][box]")
+{
+    auto a1 = nel::heaped::Box<long>::try_from(1).unwrap();
+    REQUIRE(a1.allocated_bytes() >= sizeof(long));
+    REQUIRE(a1.memory_usage() == sizeof(a1) + a1.allocated_bytes());
+
+    // moved from holds nothing.
+    auto a2 = nel::move(a1);
+    REQUIRE(a1.allocated_bytes() == 0);
+    REQUIRE(a2.allocated_bytes() >= sizeof(long));
+}
+
 }; // namespace box
 }; // namespace heaped
 }; // namespace test
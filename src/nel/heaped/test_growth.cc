@@ -0,0 +1,107 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#include <nel/heaped/growth.hh>
+#include <nel/heaped/vector.hh>
+#include <nel/heaped/allocator.hh>
+
+#include <catch2/catch.hpp>
+
+namespace nel
+{
+namespace test
+{
+namespace heaped
+{
+namespace growth
+{
+
+// Allocator that counts reallocs, passing through to Malloc.
+struct Counting: public nel::heaped::Malloc
+{
+    public:
+        static int reallocs;
+
+        static Result<void *, nel::heaped::AllocError> try_malloc(Length const align,
+                                                                  Length const size)
+        {
+            return try_realloc(nullptr, align, 0, size);
+        }
+
+        static Result<void *, nel::heaped::AllocError>
+        try_realloc(void *const p, Length const align, Length const old_size, Length const new_size)
+        {
+            reallocs += 1;
+            return nel::heaped::Malloc::try_realloc(p, align, old_size, new_size);
+        }
+};
+
+int Counting::reallocs = 0;
+
+TEST_CASE("heaped::GeometricGrowth", "[heaped][growth]")
+{
+    typedef nel::heaped::GeometricGrowth<> G2;
+    typedef nel::heaped::GeometricGrowth<3, 2> G15;
+
+    // never less than asked.
+    CHECK(G2::capacity_for(0, 100) == 100);
+    CHECK(G2::capacity_for(10, 100) == 100);
+
+    // grows from small to a minimum.
+    CHECK(G2::capacity_for(0, 1) == G2::min_capacity);
+
+    // grows by the factor.
+    CHECK(G2::capacity_for(10, 11) == 20);
+    CHECK(G15::capacity_for(10, 11) == 15);
+    CHECK(G15::capacity_for(11, 12) == 16);
+
+    // shrinks to what is asked.
+    CHECK(G2::capacity_for(100, 10) == 10);
+    CHECK(G2::capacity_for(100, 0) == 0);
+}
+
+TEST_CASE("heaped::LinearGrowth", "[heaped][growth]")
+{
+    typedef nel::heaped::LinearGrowth<16> L16;
+
+    CHECK(L16::capacity_for(0, 0) == 0);
+    CHECK(L16::capacity_for(0, 1) == 16);
+    CHECK(L16::capacity_for(16, 17) == 32);
+    CHECK(L16::capacity_for(100, 10) == 16);
+}
+
+TEST_CASE("heaped::Vector<T, A, G>", "[heaped][growth]")
+{
+    Count const n = 10000;
+
+    Counting::reallocs = 0;
+    auto a1 = nel::heaped::Vector<int, Counting>::empty();
+    for (Index i = 0; i < n; ++i) {
+        REQUIRE(a1.push(int(i)).is_ok());
+    }
+    // 4, 8, 16, .. 16384
+    CHECK(Counting::reallocs == 13);
+    int const geometric = Counting::reallocs;
+
+    Counting::reallocs = 0;
+    auto a2 = nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16>>::empty();
+    for (Index i = 0; i < n; ++i) {
+        REQUIRE(a2.push(int(i)).is_ok());
+    }
+    CHECK(Counting::reallocs == int((n + 15) / 16));
+    CHECK(Counting::reallocs > geometric);
+
+    CHECK(a1.try_get(n - 1).unwrap() == int(n - 1));
+    CHECK(a2.try_get(n - 1).unwrap() == int(n - 1));
+    CHECK(a2.capacity() - a2.len() <= 16);
+}
+
+TEST_CASE("heaped::Vector::push, does not shrink", "[heaped][growth]")
+{
+    auto a1 = nel::heaped::Vector<int>::with_capacity(100);
+    REQUIRE(a1.push(1).is_ok());
+    CHECK(a1.capacity() == 100);
+}
+
+} // namespace growth
+} // namespace heaped
+} // namespace test
+} // namespace nel
@@ -0,0 +1,203 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#include <nel/heaped/pool.hh>
+#include <nel/heaped/box.hh>
+#include <nel/heaped/rc.hh>
+
+#include <catch2/catch.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#    define NEL_TEST_PTHREADS 1
+#    include <pthread.h>
+#endif
+
+namespace nel
+{
+namespace test
+{
+namespace heaped
+{
+namespace pool
+{
+
+// separate upstream so these tests have a pool to themselves.
+struct Upstream: public nel::heaped::Malloc
+{
+};
+
+typedef nel::heaped::Pool<Upstream> TestPool;
+
+TEST_CASE("heaped::Pool::try_malloc", "[heaped][pool]")
+{
+    {
+        // freed blocks are re-used for the same size class.
+        void *p1 = TestPool::try_malloc(alignof(int), 24).unwrap();
+        TestPool::free(p1, alignof(int), 24);
+        void *p2 = TestPool::try_malloc(alignof(int), 20).unwrap();
+        REQUIRE(p1 == p2);
+        TestPool::free(p2, alignof(int), 20);
+    }
+
+    {
+        // different size classes get different blocks.
+        void *p1 = TestPool::try_malloc(alignof(int), 16).unwrap();
+        void *p2 = TestPool::try_malloc(alignof(int), 100).unwrap();
+        REQUIRE(p1 != p2);
+        TestPool::free(p1, alignof(int), 16);
+        TestPool::free(p2, alignof(int), 100);
+    }
+
+    {
+        // blocks are writable and distinct.
+        int *ps[100];
+        for (int i = 0; i < 100; ++i) {
+            ps[i] = reinterpret_cast<int *>(TestPool::try_malloc(alignof(int), 64).unwrap());
+            *ps[i] = i;
+        }
+        for (int i = 0; i < 100; ++i) {
+            REQUIRE(*ps[i] == i);
+        }
+        for (int i = 0; i < 100; ++i) {
+            TestPool::free(ps[i], alignof(int), 64);
+        }
+    }
+
+    {
+        // too big for the pool goes upstream.
+        void *p1 = TestPool::try_malloc(alignof(int), 10000).unwrap();
+        REQUIRE(p1 != nullptr);
+        TestPool::free(p1, alignof(int), 10000);
+    }
+}
+
+TEST_CASE("heaped::Pool::try_realloc", "[heaped][pool]")
+{
+    // growing within size class keeps the block.
+    uint8_t *p1 = reinterpret_cast<uint8_t *>(TestPool::try_malloc(1, 40).unwrap());
+    p1[0] = 0x12;
+    p1[39] = 0x34;
+    uint8_t *p2 = reinterpret_cast<uint8_t *>(TestPool::try_realloc(p1, 1, 40, 60).unwrap());
+    REQUIRE(p1 == p2);
+
+    // growing beyond moves, keeping content.
+    uint8_t *p3 = reinterpret_cast<uint8_t *>(TestPool::try_realloc(p2, 1, 60, 2000).unwrap());
+    REQUIRE(p3[0] == 0x12);
+    REQUIRE(p3[39] == 0x34);
+
+    // and back again
+    uint8_t *p4 = reinterpret_cast<uint8_t *>(TestPool::try_realloc(p3, 1, 2000, 40).unwrap());
+    REQUIRE(p4[0] == 0x12);
+    REQUIRE(p4[39] == 0x34);
+    TestPool::free(p4, 1, 40);
+}
+
+TEST_CASE("heaped::Pool::try_reserve", "[heaped][pool]")
+{
+    REQUIRE(TestPool::try_reserve(256, 10).is_ok());
+
+    // too big to pool is a no-op.
+    REQUIRE(TestPool::try_reserve(100000, 10).is_ok());
+}
+
+#if defined(NEL_TEST_PTHREADS)
+// own upstream, so the threads start on an empty pool and race on refills too.
+struct ThreadedUpstream: public nel::heaped::Malloc
+{
+};
+
+typedef nel::heaped::Pool<ThreadedUpstream> ThreadedPool;
+
+struct Churn
+{
+        // what this thread stamps into the blocks it holds.
+        USize id;
+        // blocks found holding someone else's stamp.
+        Count clashes;
+};
+
+static void *churn(void *arg)
+{
+    Churn *const c = reinterpret_cast<Churn *>(arg);
+    constexpr Count n_held = 8;
+    constexpr Length size = 32;
+    constexpr Count n_words = size / sizeof(USize);
+    USize *held[n_held];
+    for (Count round = 0; round < 20000; ++round) {
+        // take a few, stamp them, hold on to them a while.
+        for (Index i = 0; i < n_held; ++i) {
+            held[i] = reinterpret_cast<USize *>(ThreadedPool::try_malloc(1, size).unwrap());
+            for (Index w = 0; w < n_words; ++w) {
+                __atomic_store_n(&held[i][w], c->id, __ATOMIC_RELAXED);
+            }
+        }
+        // a block handed to another thread too will have its stamp.
+        for (Index i = 0; i < n_held; ++i) {
+            for (Index w = 0; w < n_words; ++w) {
+                if (__atomic_load_n(&held[i][w], __ATOMIC_RELAXED) != c->id) { c->clashes += 1; }
+            }
+        }
+        // give back interleaved with the other threads.
+        for (Index i = 0; i < n_held; ++i) {
+            ThreadedPool::free(held[(i * 3) % n_held], 1, size);
+        }
+    }
+    return nullptr;
+}
+
+TEST_CASE("heaped::Pool, shared between threads", "[heaped][pool]")
+{
+    constexpr Count n_threads = 4;
+    pthread_t threads[n_threads];
+    Churn churns[n_threads];
+    for (Index i = 0; i < n_threads; ++i) {
+        churns[i] = Churn{i + 1, 0};
+        REQUIRE(pthread_create(&threads[i], nullptr, churn, &churns[i]) == 0);
+    }
+    for (Index i = 0; i < n_threads; ++i) {
+        REQUIRE(pthread_join(threads[i], nullptr) == 0);
+    }
+    for (Index i = 0; i < n_threads; ++i) {
+        REQUIRE(churns[i].clashes == 0);
+    }
+
+    // the list is still intact afterwards, the blocks held at once come back distinct.
+    void *ps[n_threads * 8];
+    Count dups = 0;
+    for (Index i = 0; i < n_threads * 8; ++i) {
+        ps[i] = ThreadedPool::try_malloc(1, 32).unwrap();
+        for (Index j = 0; j < i; ++j) {
+            dups += (ps[i] == ps[j]) ? 1 : 0;
+        }
+    }
+    REQUIRE(dups == 0);
+    for (Index i = 0; i < n_threads * 8; ++i) {
+        ThreadedPool::free(ps[i], 1, 32);
+    }
+}
+#endif
+
+TEST_CASE("heaped::Box<T, Pool>", "[heaped][pool]")
+{
+    // box from the pool works as any other box.
+    auto a1 = nel::heaped::Box<int, TestPool>::try_from(1).unwrap();
+    REQUIRE(*a1 == 1);
+    auto a2 = nel::move(a1);
+    REQUIRE(!a1.has_value());
+    REQUIRE(*a2 == 1);
+    REQUIRE(a2.unwrap() == 1);
+}
+
+TEST_CASE("heaped::RC<T, Pool>", "[heaped][pool]")
+{
+    // rc from the pool works as any other rc.
+    auto a1 = nel::heaped::RC<int, TestPool>(1);
+    auto a2 = a1;
+    REQUIRE((*a1 == 1));
+    REQUIRE((*a2 == 1));
+    REQUIRE(a1.unwrap() == 1);
+    REQUIRE(!a2.has_value());
+}
+
+} // namespace pool
+} // namespace heaped
+} // namespace test
+} // namespace nel
@@ -87,6 +87,20 @@ TEST_CASE("heaped::RC::unwrap", "[heaped][rc]")
 
 // TODO: check that dtor of T is called only when last reference is destroyed..
 
+TEST_CASE("heaped::RC::allocated_bytes", "[heaped][rc]")
+{
+    auto a1 = nel::heaped::RC<long>(1);
+    // value + ref count.
+    REQUIRE(a1.allocated_bytes() > sizeof(long));
+    REQUIRE(a1.memory_usage() == sizeof(a1) + a1.allocated_bytes());
+
+    // shared, so each reference reports the same node.
+    auto a2 = a1;
+    REQUIRE(a2.allocated_bytes() == a1.allocated_bytes());
+    REQUIRE(a2.unwrap() == 1);
+    REQUIRE(a2.allocated_bytes() == 0);
+}
+
 }; // namespace rc
 }; // namespace heaped
 }; // namespace test
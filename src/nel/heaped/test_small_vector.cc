@@ -0,0 +1,255 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#include <nel/heaped/small_vector.hh>
+#include <nel/memory.hh> // move()
+
+#include <catch2/catch.hpp>
+
+#include <nel/stub.hh>
+
+namespace nel
+{
+namespace test
+{
+namespace heaped
+{
+namespace small_vector
+{
+
+TEST_CASE("heaped::SmallVector::empty", "[heaped][small_vector]")
+{
+    auto v1 = nel::heaped::SmallVector<int, 4>::empty();
+    REQUIRE(v1.is_empty());
+    REQUIRE(v1.len() == 0);
+    REQUIRE(v1.is_inline());
+    REQUIRE(v1.capacity() == 4);
+    REQUIRE(v1.pop().is_none());
+    REQUIRE(v1.try_get(0).is_none());
+}
+
+TEST_CASE("heaped::SmallVector::with_capacity", "[heaped][small_vector]")
+{
+    // fits inline, no alloc.
+    auto v1 = nel::heaped::SmallVector<int, 4>::with_capacity(3);
+    REQUIRE(v1.is_inline());
+    REQUIRE(v1.capacity() == 4);
+
+    // too big, on the heap from the start.
+    auto v2 = nel::heaped::SmallVector<int, 4>::with_capacity(10);
+    REQUIRE(!v2.is_inline());
+    REQUIRE(v2.capacity() == 10);
+    REQUIRE(v2.is_empty());
+}
+
+TEST_CASE("heaped::SmallVector::push", "[heaped][small_vector]")
+{
+    auto v1 = nel::heaped::SmallVector<int, 4>::empty();
+
+    // up to N stays inline.
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(v1.push(int(i)).is_ok());
+        REQUIRE(v1.is_inline());
+    }
+    REQUIRE(v1.len() == 4);
+
+    // N+1 spills, keeping values.
+    REQUIRE(v1.push(4).is_ok());
+    REQUIRE(!v1.is_inline());
+    REQUIRE(v1.len() == 5);
+    REQUIRE(v1.capacity() >= 5);
+    for (int i = 5; i < 100; ++i) {
+        REQUIRE(v1.push(int(i)).is_ok());
+    }
+    REQUIRE(v1.len() == 100);
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(v1.try_get(i).unwrap() == i);
+    }
+}
+
+TEST_CASE("heaped::SmallVector::pop", "[heaped][small_vector]")
+{
+    auto v1 = nel::heaped::SmallVector<int, 2>::empty();
+    REQUIRE(v1.push(1).is_ok());
+    REQUIRE(v1.push(2).is_ok());
+    REQUIRE(v1.pop().unwrap() == 2);
+    REQUIRE(v1.pop().unwrap() == 1);
+    REQUIRE(v1.pop().is_none());
+
+    // popping off the heap stays on the heap.
+    for (int i = 0; i < 3; ++i) {
+        REQUIRE(v1.push(int(i)).is_ok());
+    }
+    REQUIRE(!v1.is_inline());
+    REQUIRE(v1.pop().unwrap() == 2);
+    REQUIRE(v1.pop().unwrap() == 1);
+    REQUIRE(!v1.is_inline());
+    REQUIRE(v1.len() == 1);
+}
+
+TEST_CASE("heaped::SmallVector::move", "[heaped][small_vector]")
+{
+    {
+        // inline
+        auto v1 = nel::heaped::SmallVector<int, 4>::empty();
+        REQUIRE(v1.push(1).is_ok());
+        REQUIRE(v1.push(2).is_ok());
+        auto v2 = nel::move(v1);
+        REQUIRE(v1.is_empty());
+        REQUIRE(v2.len() == 2);
+        REQUIRE(v2.is_inline());
+        REQUIRE(v2.try_get(1).unwrap() == 2);
+    }
+    {
+        // heap
+        auto v1 = nel::heaped::SmallVector<int, 1>::empty();
+        REQUIRE(v1.push(1).is_ok());
+        REQUIRE(v1.push(2).is_ok());
+        auto v2 = nel::heaped::SmallVector<int, 1>::empty();
+        v2 = nel::move(v1);
+        REQUIRE(v1.is_empty());
+        REQUIRE(v1.is_inline());
+        REQUIRE(!v2.is_inline());
+        REQUIRE(v2.len() == 2);
+        REQUIRE(v2.try_get(1).unwrap() == 2);
+    }
+}
+
+TEST_CASE("heaped::SmallVector::try_reserve", "[heaped][small_vector]")
+{
+    auto v1 = nel::heaped::SmallVector<int, 4>::empty();
+    REQUIRE(v1.push(1).is_ok());
+
+    // within inline, nothing to do.
+    REQUIRE(v1.try_reserve(2));
+    REQUIRE(v1.is_inline());
+
+    REQUIRE(v1.try_reserve(20));
+    REQUIRE(!v1.is_inline());
+    REQUIRE(v1.capacity() >= 20);
+    REQUIRE(v1.try_get(0).unwrap() == 1);
+
+    // never below len.
+    REQUIRE(v1.try_reserve(0));
+    REQUIRE(v1.capacity() >= 1);
+    REQUIRE(v1.len() == 1);
+}
+
+TEST_CASE("heaped::SmallVector::extend_from_slice", "[heaped][small_vector]")
+{
+    int const a[] = {1, 2, 3, 4, 5, 6};
+    auto v1 = nel::heaped::SmallVector<int, 4>::empty();
+
+    REQUIRE(v1.extend_from_slice(Slice<int const>(a, 3)).is_ok());
+    REQUIRE(v1.is_inline());
+    REQUIRE(v1.extend_from_slice(Slice<int const>(a, 6)).is_ok());
+    REQUIRE(!v1.is_inline());
+    REQUIRE(v1.len() == 9);
+    REQUIRE(v1.try_get(2).unwrap() == 3);
+    REQUIRE(v1.try_get(3).unwrap() == 1);
+    REQUIRE(v1.try_get(8).unwrap() == 6);
+}
+
+TEST_CASE("heaped::SmallVector::iter", "[heaped][small_vector]")
+{
+    auto v1 = nel::heaped::SmallVector<int, 4>::empty();
+    for (int i = 0; i < 3; ++i) {
+        REQUIRE(v1.push(int(i)).is_ok());
+    }
+    int sum = 0;
+    v1.iter().for_each([&sum](int const &v) { sum += v; });
+    REQUIRE(sum == 3);
+
+    REQUIRE(v1.slice(1, 3).len() == 2);
+}
+
+TEST_CASE("heaped::SmallVector: dtor destroys contained", "[heaped][small_vector]")
+{
+    nel::test::Stub::reset();
+    {
+        // inline
+        auto v1 = nel::heaped::SmallVector<nel::test::Stub, 4>::empty();
+        for (int i = 0; i < 3; ++i) {
+            REQUIRE(v1.push(nel::test::Stub(i)).is_ok());
+        }
+        REQUIRE(nel::test::Stub::instances == 3);
+    }
+    REQUIRE(nel::test::Stub::instances == 0);
+
+    {
+        // spilled, and moved.
+        auto v1 = nel::heaped::SmallVector<nel::test::Stub, 2>::empty();
+        for (int i = 0; i < 5; ++i) {
+            REQUIRE(v1.push(nel::test::Stub(i)).is_ok());
+        }
+        REQUIRE(nel::test::Stub::instances == 5);
+        auto v2 = nel::move(v1);
+        REQUIRE(v2.try_get(4).unwrap().val == 4);
+        REQUIRE(v2.pop().unwrap().val == 4);
+        REQUIRE(nel::test::Stub::instances == 4);
+    }
+    REQUIRE(nel::test::Stub::instances == 0);
+
+    {
+        auto v1 = nel::heaped::SmallVector<nel::test::Stub, 4>::empty();
+        REQUIRE(v1.push(nel::test::Stub(1)).is_ok());
+        v1.clear();
+        REQUIRE(nel::test::Stub::instances == 0);
+        REQUIRE(v1.is_empty());
+    }
+}
+
+TEST_CASE("heaped::SmallVector::shrink_to_fit", "[heaped][small_vector]")
+{
+    auto v1 = nel::heaped::SmallVector<int, 4>::empty();
+    REQUIRE(v1.allocated_bytes() == 0);
+    REQUIRE(v1.memory_usage() == sizeof(v1));
+
+    for (int i = 0; i < 20; ++i) {
+        REQUIRE(v1.push(int(i)).is_ok());
+    }
+    REQUIRE(v1.allocated_bytes() >= 20 * sizeof(int));
+
+    // stays on the heap, trimmed to len.
+    for (int i = 0; i < 10; ++i) {
+        REQUIRE(v1.pop().is_some());
+    }
+    REQUIRE(v1.shrink_to_fit());
+    REQUIRE(!v1.is_inline());
+    REQUIRE(v1.capacity() == 10);
+
+    // back inline once it fits.
+    for (int i = 0; i < 7; ++i) {
+        REQUIRE(v1.pop().is_some());
+    }
+    REQUIRE(v1.shrink_to_fit());
+    REQUIRE(v1.is_inline());
+    REQUIRE(v1.allocated_bytes() == 0);
+    REQUIRE(v1.len() == 3);
+    for (int i = 0; i < 3; ++i) {
+        REQUIRE(v1.try_get(i).unwrap() == i);
+    }
+}
+
+TEST_CASE("heaped::SmallVector::extend", "[heaped][small_vector]")
+{
+    int const a[] = {1, 2, 3, 4, 5, 6};
+    {
+        // fits, stays inline.
+        auto v1 = nel::heaped::SmallVector<int, 8>::empty();
+        REQUIRE(v1.extend(Slice<int const>(a, 6).iter()).is_ok());
+        REQUIRE(v1.is_inline());
+        REQUIRE(v1.len() == 6);
+    }
+    {
+        // spills once, to exactly what's needed.
+        auto v1 = nel::heaped::SmallVector<int, 4>::empty();
+        REQUIRE(Slice<int const>(a, 6).iter().collect_into(v1).is_ok());
+        REQUIRE(!v1.is_inline());
+        REQUIRE(v1.capacity() >= 6);
+        REQUIRE(v1.try_get(5).unwrap() == 6);
+    }
+}
+
+}; // namespace small_vector
+}; // namespace heaped
+}; // namespace test
+}; // namespace nel
@@ -4,6 +4,8 @@
 
 #include <catch2/catch.hpp>
 
+#include <nel/stub.hh>
+
 namespace nel
 {
 namespace test
@@ -507,6 +509,282 @@ TEST_CASE("heaped::Vector::try_get", "[heaped][vector]")
     }
 }
 
+TEST_CASE("heaped::Vector::extend_from_slice", "[heaped][vector]")
+{
+    {
+        // trivial values, copied in bulk.
+        int const a1[] {1, 2, 3, 4, 5};
+        auto v1 = nel::heaped::Vector<int>::empty();
+        REQUIRE(v1.push(0).is_ok());
+        REQUIRE(v1.extend_from_slice(Slice(a1, 5)).is_ok());
+        REQUIRE(v1.len() == 6);
+        REQUIRE(v1.try_get(0).unwrap() == 0);
+        REQUIRE(v1.try_get(5).unwrap() == 5);
+
+        // from a mutable slice.
+        int a2[] {6, 7};
+        REQUIRE(v1.extend_from_slice(Slice(a2, 2)).is_ok());
+        REQUIRE(v1.len() == 8);
+        REQUIRE(v1.try_get(7).unwrap() == 7);
+
+        // empty slice is ok.
+        REQUIRE(v1.extend_from_slice(Slice<int const>::empty()).is_ok());
+        REQUIRE(v1.len() == 8);
+    }
+
+    {
+        // non-trivial values, copied by copy-ctor.
+        nel::test::Stub const a1[] {nel::test::Stub(1), nel::test::Stub(2)};
+        auto v1 = nel::heaped::Vector<nel::test::Stub>::empty();
+        nel::test::Stub::reset();
+        REQUIRE(v1.extend_from_slice(Slice(a1, 2)).is_ok());
+        REQUIRE(nel::test::Stub::copy_ctor == 2);
+        REQUIRE(v1.try_get(1).unwrap().val == 2);
+    }
+}
+
+TEST_CASE("heaped::Vector::append", "[heaped][vector]")
+{
+    {
+        auto v1 = nel::heaped::Vector<int>::empty();
+        auto v2 = nel::heaped::Vector<int>::empty();
+        REQUIRE(v1.push(1).is_ok());
+        REQUIRE(v2.push(2).is_ok());
+        REQUIRE(v2.push(3).is_ok());
+        REQUIRE(v1.append(nel::move(v2)).is_ok());
+        REQUIRE(v1.len() == 3);
+        REQUIRE(v1.try_get(2).unwrap() == 3);
+        REQUIRE(v2.is_empty());
+    }
+
+    {
+        // appending to empty takes the other's values.
+        auto v1 = nel::heaped::Vector<int>::empty();
+        auto v2 = nel::heaped::Vector<int>::empty();
+        REQUIRE(v2.push(2).is_ok());
+        REQUIRE(v1.append(nel::move(v2)).is_ok());
+        REQUIRE(v1.len() == 1);
+        REQUIRE(v1.try_get(0).unwrap() == 2);
+        REQUIRE(v2.is_empty());
+    }
+
+    {
+        // non-trivial values, relocated.
+        auto v1 = nel::heaped::Vector<nel::test::Stub>::empty();
+        auto v2 = nel::heaped::Vector<nel::test::Stub>::empty();
+        REQUIRE(v1.push(1).is_ok());
+        REQUIRE(v2.push(2).is_ok());
+        REQUIRE(v1.append(nel::move(v2)).is_ok());
+        REQUIRE(v1.len() == 2);
+        REQUIRE(v1.try_get(1).unwrap().val == 2);
+        REQUIRE(v1.try_get(1).unwrap().valid);
+        REQUIRE(v2.is_empty());
+    }
+}
+
+TEST_CASE("heaped::Vector::extend", "[heaped][vector]")
+{
+    int a1[] {1, 2, 3};
+    auto v1 = nel::heaped::Vector<int>::empty();
+    REQUIRE(v1.extend(Slice(a1, 3).iter()).is_ok());
+    REQUIRE(v1.len() == 3);
+    REQUIRE(v1.try_get(2).unwrap() == 3);
+
+    // mapped values.
+    REQUIRE(v1.extend(Slice(a1, 3).iter().map<int>([](int &v) -> int { return v * 10; })).is_ok());
+    REQUIRE(v1.len() == 6);
+    REQUIRE(v1.try_get(5).unwrap() == 30);
+}
+
+TEST_CASE("heaped::Vector::insert_at", "[heaped][vector]")
+{
+    auto v1 = nel::heaped::Vector<int>::empty();
+    REQUIRE(v1.insert_at(0, 2).is_ok());
+    REQUIRE(v1.insert_at(0, 0).is_ok());
+    REQUIRE(v1.insert_at(1, 1).is_ok());
+    REQUIRE(v1.insert_at(3, 3).is_ok());
+    REQUIRE(v1.len() == 4);
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(v1.try_get(i).unwrap() == i);
+    }
+
+    // past the end fails, value returned.
+    auto r = v1.insert_at(5, 5);
+    REQUIRE(r.is_err());
+    REQUIRE(r.unwrap_err() == 5);
+    REQUIRE(v1.len() == 4);
+}
+
+TEST_CASE("heaped::Vector::remove_at", "[heaped][vector]")
+{
+    {
+        auto v1 = nel::heaped::Vector<int>::empty();
+        for (int i = 0; i < 5; ++i) {
+            REQUIRE(v1.push(int(i)).is_ok());
+        }
+        REQUIRE(v1.remove_at(1).unwrap() == 1);
+        REQUIRE(v1.remove_at(3).unwrap() == 4);
+        REQUIRE(v1.remove_at(3).is_none());
+        REQUIRE(v1.len() == 3);
+        REQUIRE(v1.try_get(0).unwrap() == 0);
+        REQUIRE(v1.try_get(1).unwrap() == 2);
+        REQUIRE(v1.try_get(2).unwrap() == 3);
+    }
+
+    {
+        // non-trivial values are moved, not leaked.
+        nel::test::Stub::reset();
+        {
+            auto v1 = nel::heaped::Vector<nel::test::Stub>::empty();
+            for (int i = 0; i < 3; ++i) {
+                REQUIRE(v1.push(nel::test::Stub(i)).is_ok());
+            }
+            REQUIRE(v1.remove_at(0).unwrap().val == 0);
+            REQUIRE(v1.try_get(0).unwrap().val == 1);
+            REQUIRE(v1.try_get(0).unwrap().valid);
+            REQUIRE(v1.try_get(1).unwrap().val == 2);
+        }
+        REQUIRE(nel::test::Stub::instances == 0);
+    }
+}
+
+TEST_CASE("heaped::Vector::remove_range", "[heaped][vector]")
+{
+    auto v1 = nel::heaped::Vector<int>::empty();
+    for (int i = 0; i < 8; ++i) {
+        REQUIRE(v1.push(int(i)).is_ok());
+    }
+    REQUIRE(v1.remove_range(2, 5) == 3);
+    REQUIRE(v1.len() == 5);
+    REQUIRE(v1.try_get(1).unwrap() == 1);
+    REQUIRE(v1.try_get(2).unwrap() == 5);
+
+    // clamped to end.
+    REQUIRE(v1.remove_range(3, 100) == 2);
+    REQUIRE(v1.len() == 3);
+    REQUIRE(v1.try_get(2).unwrap() == 5);
+
+    // empty ranges
+    REQUIRE(v1.remove_range(2, 2) == 0);
+    REQUIRE(v1.remove_range(5, 6) == 0);
+    REQUIRE(v1.len() == 3);
+}
+
+TEST_CASE("heaped::Vector::swap_remove", "[heaped][vector]")
+{
+    auto v1 = nel::heaped::Vector<int>::empty();
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(v1.push(int(i)).is_ok());
+    }
+    REQUIRE(v1.swap_remove(1).unwrap() == 1);
+    REQUIRE(v1.len() == 3);
+    REQUIRE(v1.try_get(1).unwrap() == 3);
+    // removing last is ok.
+    REQUIRE(v1.swap_remove(2).unwrap() == 2);
+    REQUIRE(v1.len() == 2);
+    REQUIRE(v1.swap_remove(2).is_none());
+}
+
+TEST_CASE("heaped::Vector::retain", "[heaped][vector]")
+{
+    {
+        auto v1 = nel::heaped::Vector<int>::empty();
+        for (int i = 0; i < 8; ++i) {
+            REQUIRE(v1.push(int(i)).is_ok());
+        }
+        // drop 1, 2, 5.
+        v1.retain([](int const &v) -> bool { return v != 1 && v != 2 && v != 5; });
+        REQUIRE(v1.len() == 5);
+        int const e[] {0, 3, 4, 6, 7};
+        for (int i = 0; i < 5; ++i) {
+            REQUIRE(v1.try_get(i).unwrap() == e[i]);
+        }
+
+        v1.retain([](int const &) -> bool { return false; });
+        REQUIRE(v1.is_empty());
+    }
+
+    {
+        // non-trivial values dropped are destroyed, kept are moved.
+        nel::test::Stub::reset();
+        {
+            auto v1 = nel::heaped::Vector<nel::test::Stub>::empty();
+            for (int i = 0; i < 4; ++i) {
+                REQUIRE(v1.push(nel::test::Stub(i)).is_ok());
+            }
+            v1.retain([](auto const &v) -> bool { return v.val % 2 == 1; });
+            REQUIRE(v1.len() == 2);
+            REQUIRE(nel::test::Stub::instances == 2);
+            REQUIRE(v1.try_get(0).unwrap().val == 1);
+            REQUIRE(v1.try_get(1).unwrap().val == 3);
+        }
+        REQUIRE(nel::test::Stub::instances == 0);
+    }
+}
+
+TEST_CASE("heaped::Vector::shrink_to_fit", "[heaped][vector]")
+{
+    auto v1 = nel::heaped::Vector<int>::empty();
+    REQUIRE(v1.shrink_to_fit());
+    REQUIRE(v1.capacity() == 0);
+
+    REQUIRE(v1.try_reserve(100));
+    for (int i = 0; i < 10; ++i) {
+        REQUIRE(v1.push(int(i)).is_ok());
+    }
+    REQUIRE(v1.capacity() >= 100);
+    REQUIRE(v1.shrink_to_fit());
+    REQUIRE(v1.capacity() == 10);
+    REQUIRE(v1.len() == 10);
+    for (int i = 0; i < 10; ++i) {
+        REQUIRE(v1.try_get(i).unwrap() == i);
+    }
+
+    // empty releases it all.
+    v1.clear();
+    REQUIRE(v1.shrink_to_fit());
+    REQUIRE(v1.capacity() == 0);
+    REQUIRE(v1.allocated_bytes() == 0);
+}
+
+TEST_CASE("heaped::Vector::allocated_bytes", "[heaped][vector]")
+{
+    auto v1 = nel::heaped::Vector<int>::empty();
+    REQUIRE(v1.allocated_bytes() == 0);
+    REQUIRE(v1.memory_usage() == sizeof(v1));
+
+    auto v2 = nel::heaped::Vector<int>::with_capacity(10);
+    // header + capacity, not just len.
+    REQUIRE(v2.allocated_bytes() >= 10 * sizeof(int));
+    REQUIRE(v2.allocated_bytes() < 10 * sizeof(int) + 64);
+    REQUIRE(v2.memory_usage() == sizeof(v2) + v2.allocated_bytes());
+
+    auto const b = v2.allocated_bytes();
+    REQUIRE(v2.push(1).is_ok());
+    REQUIRE(v2.allocated_bytes() == b);
+}
+
+TEST_CASE("heaped::Vector::collect_into", "[heaped][vector]")
+{
+    auto a1 = nel::heaped::Vector<int>::empty();
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(a1.push(int(i)).is_ok());
+    }
+
+    // exact sized, so reserves exactly once, no growth slack.
+    auto v1 = nel::heaped::Vector<long>::empty();
+    REQUIRE(a1.iter().map<long>([](int &e) -> long { return e * 2; }).collect_into(v1).is_ok());
+    REQUIRE(v1.len() == 100);
+    REQUIRE(v1.capacity() == 100);
+    REQUIRE(v1.try_get(99).unwrap() == 198);
+
+    // only a bound, so grows as it goes.
+    auto v2 = nel::heaped::Vector<int>::empty();
+    REQUIRE(a1.iter().filter([](int const &e) { return e % 2 == 0; }).collect_into(v2).is_ok());
+    REQUIRE(v2.len() == 50);
+    REQUIRE(v2.try_get(49).unwrap() == 98);
+}
+
 }; // namespace vector
 }; // namespace heaped
 }; // namespace test
@@ -2,24 +2,34 @@
 #if !defined(NEL_HEAPED_VECTOR_HH)
 #    define NEL_HEAPED_VECTOR_HH
 
+#    include <nel/defs.hh> // Count
+
 namespace nel
 {
 namespace heaped
 {
 
-template<typename T>
+struct Malloc;
+
+template<Count const NUM, Count const DEN>
+struct GeometricGrowth;
+
+template<typename T, typename A = Malloc, typename G = GeometricGrowth<2, 1>>
 struct Vector;
 
 } // namespace heaped
 } // namespace nel
 
 #    include <nel/heaped/node.hh>
+#    include <nel/heaped/allocator.hh>
+#    include <nel/heaped/growth.hh>
 #    include <nel/iterator.hh>
 #    include <nel/slice.hh>
 #    include <nel/optional.hh>
 #    include <nel/result.hh>
 #    include <nel/log.hh>
 #    include <nel/memory.hh> // new, move
+#    include <nel/traits.hh> // TriviallyRelocatable
 #    include <nel/defs.hh>
 
 namespace nel
@@ -32,21 +42,26 @@ namespace heaped
  *
  * A container of type T held in a contiguous block (a variable sized array.)
  * Capacity (max number of elements) is limited only by ram (unbounded).
+ * Memory is obtained from the allocator A (see heaped/allocator.hh).
+ * Capacity grows as the growth policy G decides (see heaped/growth.hh),
+ * geometrically by default.
  * Cannot be implicitly coped.
  * Can be implicitly moved.
  */
-template<typename T>
+template<typename T, typename A, typename G>
 struct Vector
 {
     public:
         typedef T Type;
+        typedef A Allocator;
+        typedef G Growth;
 
     private:
         // not using unique_ptr as didn't use new to alloc it.
         // TODO: create malloc/free unique_ptr or see if unique_ptr can be used
         // to call free directly.. (it seems to have capability to do so).
         // maybe use of allocator?
-        typedef Node<Type> VectorNode;
+        typedef Node<Type, Allocator> VectorNode;
         VectorNode *item_;
 
     private:
@@ -278,6 +293,8 @@ struct Vector
         /**
          * Change the internal allocation to given number of elements.
          *
+         * The allocation made is as the growth policy decides for new_cap,
+         * so may be more than asked.
          * If new capacity is smaller than current, then current is reduced.
          * If new capacity is less than currently used, then removes all unused
          * allocations and does not reduce the in-use amount (does not delete
@@ -293,10 +310,7 @@ struct Vector
         // Optional<void> aka bool?
         bool try_reserve(Count new_cap)
         {
-            // TODO: handle alignment issues here.
-            // TODO: quanta as a template param?
-            Count const quanta = 16;
-            if (new_cap > 0) { new_cap = new_cap - new_cap % quanta + quanta; }
+            new_cap = Growth::capacity_for(capacity(), new_cap);
 
             // prevent new_cap going below len..
             // i.e. reserve does not free off items.
@@ -326,6 +340,60 @@ struct Vector
             return true;
         }
 
+        /**
+         * Release unused capacity, reallocating to exactly len() values.
+         *
+         * Bypasses the growth policy.
+         * An empty vector releases its allocation altogether.
+         *
+         * @returns true if (re)allocation succeeded or was not needed.
+         * @returns false otherwise, the vector is unchanged.
+         */
+        bool shrink_to_fit(void)
+        {
+            if (item_ == nullptr || len() == item_->capacity()) { return true; }
+            if (len() == 0) {
+                VectorNode::free(item_);
+                item_ = nullptr;
+                return true;
+            }
+            VectorNode *p = VectorNode::realloc(item_, len());
+            if (p == nullptr) { return false; }
+            item_ = p;
+            return true;
+        }
+
+        /**
+         * Returns the number of bytes allocated on the heap.
+         *
+         * Includes the node header and unused capacity, excludes allocator overheads.
+         *
+         * @returns the bytes allocated.
+         */
+        constexpr Length allocated_bytes(void) const
+        {
+            return (item_ == nullptr) ? 0 : VectorNode::size_of(item_->capacity());
+        }
+
+        /**
+         * Returns the number of bytes used by the vector, itself and its allocation.
+         *
+         * @returns the bytes used.
+         */
+        constexpr Length memory_usage(void) const
+        {
+            return sizeof(Vector) + allocated_bytes();
+        }
+
+    private:
+        // Make room for n more values, only ever grows.
+        bool try_reserve_for(Count const n)
+        {
+            if (len() + n <= capacity()) { return true; }
+            return try_reserve(len() + n);
+        }
+
+    public:
         /**
          * Push a value onto the end of the vec.
          *
@@ -336,7 +404,7 @@ struct Vector
         Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
         {
             bool ok;
-            ok = try_reserve(len() + 1);
+            ok = try_reserve_for(1);
             if (!ok) { return Result<void, Type>::Err(val); }
             if (item_ == nullptr) { return Result<void, Type>::Err(val); }
             return item_->push_back(val);
@@ -359,18 +427,82 @@ struct Vector
         Result<void, Type> NEL_WARN_UNUSED_RESULT push(Args &&...args)
         {
             bool ok;
-            ok = try_reserve(len() + 1);
+            ok = try_reserve_for(1);
             if (!ok) { return Result<void, Type>::Err(forward<Args>(args)...); }
             if (item_ == nullptr) { return Result<void, Type>::Err(forward<Args>(args)...); }
             return item_->push_back(forward<Args>(args)...);
         }
 
-        // move contents of vec into this?
-        // Result<void, Vector<T>> push_back(Vector<T> &l) ?
-        // move contents of slice into this?
-        // Result<void, Slice<T>> push_back(Slice<T> &l) ?
-        // move contents of iter into this? into_vec?
-        // Result<void, Slice<T>> push_back(Iter<T> &l) ?
+        /**
+         * Copy the values of a slice onto the end of the vec.
+         *
+         * Reserves once, then copies in bulk (a byte copy if T is trivially copyable).
+         *
+         * @param s the slice of values to copy.
+         * @returns if successful, Result<void, Slice>::Ok()
+         * @returns if unsuccessful, Result<void, Slice>::Err() holding s, vec is unchanged.
+         */
+        Result<void, Slice<Type const>> NEL_WARN_UNUSED_RESULT
+        extend_from_slice(Slice<Type const> const s)
+        {
+            if (s.is_empty()) { return Result<void, Slice<Type const>>::Ok(); }
+            if (!try_reserve_for(s.len()) || item_ == nullptr) {
+                return Result<void, Slice<Type const>>::Err(s);
+            }
+            item_->push_back_copies(s.ptr(), s.len());
+            return Result<void, Slice<Type const>>::Ok();
+        }
+
+        /**
+         * Move all the values of another vec onto the end of this.
+         *
+         * Reserves once, then relocates in bulk (a byte copy if T is trivially relocatable).
+         *
+         * @param o the vec to move the values of, is left empty.
+         * @returns if successful, Result<void, Vector>::Ok()
+         * @returns if unsuccessful, Result<void, Vector>::Err() holding o, vec is unchanged.
+         */
+        Result<void, Vector> NEL_WARN_UNUSED_RESULT append(Vector &&o)
+        {
+            if (o.is_empty()) { return Result<void, Vector>::Ok(); }
+            if (is_empty() && o.capacity() >= capacity()) {
+                // just take o's node, don't copy anything.
+                Vector t = move(o);
+                o = move(*this);
+                *this = move(t);
+                return Result<void, Vector>::Ok();
+            }
+            if (!try_reserve_for(o.len()) || item_ == nullptr) {
+                return Result<void, Vector>::Err(move(o));
+            }
+            item_->push_back_relocated(*o.item_);
+            return Result<void, Vector>::Ok();
+        }
+
+        /**
+         * Push the values from an iterator onto the end of the vec.
+         *
+         * Reserves once for the values the iterator is sure to have (its size_hint()),
+         * so an exact sized iterator (e.g. a mapped slice) makes a single allocation.
+         *
+         * @param it the iterator to take values from.
+         * @returns if successful, Result<void, It>::Ok()
+         * @returns if unsuccessful, Result<void, It>::Err() holding the iterator,
+         *          at the first value not pushed.
+         */
+        template<typename It>
+        Result<void, It> NEL_WARN_UNUSED_RESULT extend(It it)
+        {
+            if (!try_reserve_for(it.size_hint().lower)) { return Result<void, It>::Err(move(it)); }
+            for (; !it.is_done(); it.inc()) {
+                if (!try_reserve_for(1) || item_ == nullptr) {
+                    return Result<void, It>::Err(move(it));
+                }
+                // cannot fail, room has been made.
+                item_->push_back(it.deref());
+            }
+            return Result<void, It>::Ok();
+        }
 
         /**
          * Remove and return the last item in the vec.
@@ -380,16 +512,80 @@ struct Vector
          */
         Optional<Type> pop(void)
         {
-            return (item_ == nullptr) ? Optional<Type>::None() : item_->pop_back();
+            return (item_ == nullptr) ? Optional<Type>(None) : item_->pop_back();
+        }
+
+        /**
+         * Insert a value at idx, shifting the values after it up one.
+         *
+         * Shifting is a memmove if T is trivially relocatable.
+         *
+         * @param idx index to insert at, may be len() to push.
+         * @param val the value to move into the vec.
+         * @returns if successful, Result<void, T>::Ok()
+         * @returns if idx > len() or out of memory, Result<void, T>::Err() holding val
+         */
+        Result<void, Type> NEL_WARN_UNUSED_RESULT insert_at(Index const idx, Type &&val)
+        {
+            if (idx > len() || !try_reserve_for(1) || item_ == nullptr) {
+                return Result<void, Type>::Err(move(val));
+            }
+            return item_->insert_at(idx, move(val));
         }
 
-        // insert_at(idx, T &&) ?
-        // insert_at(idx, Array<T> &&) ?
-        // insert_at(idx, iter<T> it) ?
-        // remove_at(idx) ? drops or returns item
-        // remove_at(beg,end) ? drops or returns items..(how?)
-        // sort ?
-        // find ?
+        /**
+         * Remove and return the value at idx, shifting the values after it down one.
+         *
+         * @param idx index of the value to remove.
+         * @returns on success: Optional::Some holding the value
+         * @returns if idx is out of range: Optional::None
+         */
+        Optional<Type> remove_at(Index const idx)
+        {
+            return (item_ == nullptr) ? Optional<Type>(None) : item_->remove_at(idx);
+        }
+
+        /**
+         * Remove (and destroy) the values in [b, e), shifting the values after down.
+         *
+         * @param b index of the first value to remove.
+         * @param e index after the last value to remove, clamped to len().
+         * @returns the number of values removed.
+         */
+        Count remove_range(Index const b, Index const e)
+        {
+            return (item_ == nullptr) ? 0 : item_->remove_range(b, e);
+        }
+
+        /**
+         * Remove and return the value at idx, replacing it with the last value.
+         *
+         * O(1), but does not keep order.
+         *
+         * @param idx index of the value to remove.
+         * @returns on success: Optional::Some holding the value
+         * @returns if idx is out of range: Optional::None
+         */
+        Optional<Type> swap_remove(Index const idx)
+        {
+            return (item_ == nullptr) ? Optional<Type>(None) : item_->swap_remove(idx);
+        }
+
+        /**
+         * Keep only the values that pred returns true for, in order, in place.
+         *
+         * Kept values are shifted down in runs (a memmove if T is trivially relocatable).
+         *
+         * @param pred called with each value (as Type const &), returns true to keep it.
+         */
+        template<typename F>
+        void retain(F &&pred)
+        {
+            if (item_ != nullptr) { item_->retain(pred); }
+        }
+
+        // sort: see slice().sort(), sort_unstable() and friends.
+        // find: see slice().find(), contains(), position() and friends.
 
     public:
         /**
@@ -435,6 +631,14 @@ struct Vector
 };
 
 } // namespace heaped
+
+// Vector only holds a pointer to its node, so can be relocated byte-wise.
+template<typename T, typename A, typename G>
+struct TriviallyRelocatable<heaped::Vector<T, A, G>>
+{
+        static constexpr bool value = true;
+};
+
 } // namespace nel
 
 #endif // !defined(NEL_HEAPED_VECTOR_HH)
@@ -42,7 +42,8 @@ namespace heapless
  * Once empty, pop will fail.
  * All remaining elements are destroyed when queue is destroyed.
  * Queue cannot be resized.
- * Present Elements can be iterated over in push order.
+ * Present Elements can be iterated over in push order,
+ * or newest first with iter().rev(), e.g. iter().rev().first_n(n) for the latest n.
  * Queue can be moved, calling the move operator on each elem.
  * Queue cannot be copied implicitly.
  * The FIFO ordering is preserved.
@@ -87,8 +88,8 @@ struct Queue
     public:
         constexpr ~Queue(void)
         {
-            // TODO: delete in reverse as allocated forward..?
-            iter().for_each([&](auto &v) -> void { v.~Type(); });
+            // newest first, reverse of construction.
+            iter().rev().for_each([&](auto &v) -> void { v.~Type(); });
         }
 
     public:
@@ -209,7 +210,7 @@ struct Queue
     public:
         void clear(void)
         {
-            iter().for_each([&](auto &v) -> void { v.~Type(); });
+            iter().rev().for_each([&](auto &v) -> void { v.~Type(); });
             rp_ = wp_ = len_ = 0;
         }
 
@@ -282,10 +283,10 @@ struct Queue
                 len_ -= n;
             } else {
                 auto s1 = Slice(ptr(rp_), ptr(N));
-                auto s2 = Slice(ptr(), ptr(n - N));
+                auto s2 = Slice(ptr(), ptr(rp_ + n - N));
                 auto it = QueueIteratorMut(s1.iter(), s2.iter());
                 it.for_each([&](auto &v) -> void { v.~Type(); });
-                rp_ = n - N;
+                rp_ = rp_ + n - N;
                 len_ -= n;
             }
         }
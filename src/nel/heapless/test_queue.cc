@@ -488,6 +488,159 @@ TEST_CASE("heapless::Queue::iter()", "[heapless][queue]")
 #endif
 }
 
+TEST_CASE("heapless::Queue::iter().rev()", "[heapless][queue]")
+{
+    {
+        auto a1 = nel::heapless::Queue<int, 3>::empty();
+        int n = 0;
+        a1.iter().rev().for_each([&n](int &) { n += 1; });
+        REQUIRE(n == 0);
+    }
+    {
+        // newest first, over a wrapped ring.
+        auto a1 = nel::heapless::Queue<int, 4>::empty();
+        for (int i = 1; i <= 6; ++i) {
+            a1.push(int(i)).unwrap();
+        }
+        int expected = 6;
+        a1.iter().rev().for_each([&expected](int &e) {
+            REQUIRE(e == expected);
+            expected -= 1;
+        });
+        REQUIRE(expected == 2);
+    }
+    {
+        // the latest n samples, without walking the rest.
+        auto a1 = nel::heapless::Queue<int, 8>::empty();
+        for (int i = 0; i < 11; ++i) {
+            a1.push(int(i)).unwrap();
+        }
+        int sum = 0;
+        int n = 0;
+        a1.iter().rev().first_n(3).for_each([&sum, &n](int &e) {
+            sum += e;
+            n += 1;
+        });
+        REQUIRE(n == 3);
+        REQUIRE(sum == 10 + 9 + 8);
+    }
+    {
+        // dtor and clear destroy all, newest first.
+        Stub::reset();
+        {
+            auto a1 = nel::heapless::Queue<Stub, 3>::empty();
+            a1.push(Stub(1)).unwrap();
+            a1.push(Stub(2)).unwrap();
+            a1.pop().unwrap();
+            a1.push(Stub(3)).unwrap();
+            a1.push(Stub(4)).unwrap();
+            REQUIRE(Stub::instances == 3);
+            a1.clear();
+            REQUIRE(Stub::instances == 0);
+            a1.push(Stub(5)).unwrap();
+        }
+        REQUIRE(Stub::instances == 0);
+    }
+}
+
+TEST_CASE("heapless::Queue::iter(), internal iteration", "[heapless][queue]")
+{
+    // wrapped, so iter() is a chain of 2 segments: [4,5] then [6,7,8]
+    auto a1 = nel::heapless::Queue<int, 5>::empty();
+    for (int i = 1; i <= 8; ++i) {
+        a1.push(int(i)).unwrap();
+    }
+    {
+        int sum = a1.iter().fold(0, [](int &acc, int &e) { acc += e; });
+        REQUIRE(sum == 4 + 5 + 6 + 7 + 8);
+    }
+    {
+        // stops within the first segment.
+        int n = 0;
+        bool ok = a1.iter().try_for_each([&n](int &e) {
+            n += 1;
+            return e != 5;
+        });
+        REQUIRE(!ok);
+        REQUIRE(n == 2);
+    }
+    {
+        // across the join.
+        int sum = 0;
+        a1.iter().map<int>([](int &e) { return e * 2; }).first_n(3).for_each([&sum](int e) {
+            sum += e;
+        });
+        REQUIRE(sum == 2 * (4 + 5 + 6));
+    }
+    {
+        int acc = 0;
+        auto it = a1.iter();
+        REQUIRE(!it.try_fold(acc, [](int &a, int &e) {
+            a += e;
+            return e != 7;
+        }));
+        REQUIRE(acc == 4 + 5 + 6 + 7);
+        // continues after the item stopped on.
+        int rest = 0;
+        REQUIRE(it.try_fold(rest, [](int &a, int &e) {
+            a += e;
+            return true;
+        }));
+        REQUIRE(rest == 8);
+    }
+}
+
+TEST_CASE("heapless::Queue::drain()", "[heapless][queue]")
+{
+    {
+        Stub::reset();
+        auto a1 = nel::heapless::Queue<Stub, 4>::empty();
+        for (int i = 1; i <= 3; ++i) {
+            a1.push(Stub(i)).unwrap();
+        }
+        a1.drain(2);
+        REQUIRE(a1.len() == 1);
+        REQUIRE(Stub::instances == 1);
+        REQUIRE(a1.pop().unwrap().val == 3);
+    }
+    {
+        // drained range wraps.
+        Stub::reset();
+        {
+            auto a1 = nel::heapless::Queue<Stub, 4>::empty();
+            for (int i = 1; i <= 4; ++i) {
+                a1.push(Stub(i)).unwrap();
+            }
+            for (int i = 1; i <= 3; ++i) {
+                a1.pop().unwrap();
+            }
+            a1.push(Stub(5)).unwrap();
+            a1.push(Stub(6)).unwrap();
+            // holds 4,5,6 from index 3.
+            a1.drain(2);
+            REQUIRE(a1.len() == 1);
+            REQUIRE(Stub::instances == 1);
+            a1.push(Stub(7)).unwrap();
+            REQUIRE(a1.pop().unwrap().val == 6);
+            REQUIRE(a1.pop().unwrap().val == 7);
+            REQUIRE(a1.pop().is_none());
+        }
+        REQUIRE(Stub::instances == 0);
+    }
+    {
+        // drain up to the end of the ring exactly.
+        auto a1 = nel::heapless::Queue<int, 4>::empty();
+        for (int i = 1; i <= 6; ++i) {
+            a1.push(int(i)).unwrap();
+        }
+        // holds 3,4,5,6 from index 2.
+        a1.drain(2);
+        REQUIRE(a1.len() == 2);
+        REQUIRE(a1.pop().unwrap() == 5);
+        REQUIRE(a1.pop().unwrap() == 6);
+    }
+}
+
 } // namespace queue
 } // namespace heapless
 } // namespace test
@@ -699,6 +699,191 @@ TEST_CASE("heapless::Vector::try_get()", "[heapless][Vector]")
     }
 }
 
+TEST_CASE("heapless::Vector::extend_from_slice", "[heapless][vector]")
+{
+    int const a1[] {1, 2, 3};
+    auto v1 = nel::heapless::Vector<int, 5>::empty();
+    REQUIRE(v1.extend_from_slice(Slice(a1, 3)).is_ok());
+    REQUIRE(v1.len() == 3);
+    REQUIRE(v1.try_get(2).unwrap() == 3);
+
+    // not enough room, all returned and vec unchanged.
+    auto r = v1.extend_from_slice(Slice(a1, 3));
+    REQUIRE(r.is_err());
+    REQUIRE(r.unwrap_err().len() == 3);
+    REQUIRE(v1.len() == 3);
+}
+
+TEST_CASE("heapless::Vector::append", "[heapless][vector]")
+{
+    {
+        auto v1 = nel::heapless::Vector<Stub, 5>::empty();
+        auto v2 = nel::heapless::Vector<Stub, 3>::empty();
+        REQUIRE(v1.push(Stub(1)).is_ok());
+        REQUIRE(v2.push(Stub(2)).is_ok());
+        REQUIRE(v2.push(Stub(3)).is_ok());
+        REQUIRE(v1.append(nel::move(v2)).is_ok());
+        REQUIRE(v1.len() == 3);
+        REQUIRE(v1.try_get(2).unwrap().val == 3);
+        REQUIRE(v1.try_get(2).unwrap().valid);
+        REQUIRE(v2.is_empty());
+    }
+
+    {
+        // not enough room, other is returned.
+        auto v1 = nel::heapless::Vector<int, 2>::empty();
+        auto v2 = nel::heapless::Vector<int, 3>::empty();
+        REQUIRE(v2.push(1).is_ok());
+        REQUIRE(v2.push(2).is_ok());
+        REQUIRE(v2.push(3).is_ok());
+        auto r = v1.append(nel::move(v2));
+        REQUIRE(r.is_err());
+        REQUIRE(r.unwrap_err().len() == 3);
+        REQUIRE(v1.is_empty());
+    }
+}
+
+TEST_CASE("heapless::Vector::extend", "[heapless][vector]")
+{
+    int a1[] {1, 2, 3, 4};
+    auto v1 = nel::heapless::Vector<int, 3>::empty();
+    auto r = v1.extend(Slice(a1, 4).iter());
+    REQUIRE(v1.len() == 3);
+    REQUIRE(v1.try_get(2).unwrap() == 3);
+
+    // remaining left in the iterator.
+    REQUIRE(r.is_err());
+    auto it = r.unwrap_err();
+    REQUIRE(!it.is_done());
+    REQUIRE(it.deref() == 4);
+}
+
+TEST_CASE("heapless::Vector::insert_at", "[heapless][vector]")
+{
+    auto v1 = nel::heapless::Vector<int, 8>::empty();
+    REQUIRE(v1.insert_at(0, 2).is_ok());
+    REQUIRE(v1.insert_at(0, 0).is_ok());
+    REQUIRE(v1.insert_at(1, 1).is_ok());
+    REQUIRE(v1.insert_at(3, 3).is_ok());
+    REQUIRE(v1.len() == 4);
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(v1.try_get(i).unwrap() == i);
+    }
+
+    // past the end fails, value returned.
+    auto r = v1.insert_at(5, 5);
+    REQUIRE(r.is_err());
+    REQUIRE(r.unwrap_err() == 5);
+    REQUIRE(v1.len() == 4);
+}
+
+TEST_CASE("heapless::Vector::remove_at", "[heapless][vector]")
+{
+    {
+        auto v1 = nel::heapless::Vector<int, 8>::empty();
+        for (int i = 0; i < 5; ++i) {
+            REQUIRE(v1.push(int(i)).is_ok());
+        }
+        REQUIRE(v1.remove_at(1).unwrap() == 1);
+        REQUIRE(v1.remove_at(3).unwrap() == 4);
+        REQUIRE(v1.remove_at(3).is_none());
+        REQUIRE(v1.len() == 3);
+        REQUIRE(v1.try_get(0).unwrap() == 0);
+        REQUIRE(v1.try_get(1).unwrap() == 2);
+        REQUIRE(v1.try_get(2).unwrap() == 3);
+    }
+
+    {
+        // non-trivial values are moved, not leaked.
+        Stub::reset();
+        {
+            auto v1 = nel::heapless::Vector<Stub, 4>::empty();
+            for (int i = 0; i < 3; ++i) {
+                REQUIRE(v1.push(Stub(i)).is_ok());
+            }
+            REQUIRE(v1.remove_at(0).unwrap().val == 0);
+            REQUIRE(v1.try_get(0).unwrap().val == 1);
+            REQUIRE(v1.try_get(0).unwrap().valid);
+            REQUIRE(v1.try_get(1).unwrap().val == 2);
+        }
+        REQUIRE(Stub::instances == 0);
+    }
+}
+
+TEST_CASE("heapless::Vector::remove_range", "[heapless][vector]")
+{
+    auto v1 = nel::heapless::Vector<int, 8>::empty();
+    for (int i = 0; i < 8; ++i) {
+        REQUIRE(v1.push(int(i)).is_ok());
+    }
+    REQUIRE(v1.remove_range(2, 5) == 3);
+    REQUIRE(v1.len() == 5);
+    REQUIRE(v1.try_get(1).unwrap() == 1);
+    REQUIRE(v1.try_get(2).unwrap() == 5);
+
+    // clamped to end.
+    REQUIRE(v1.remove_range(3, 100) == 2);
+    REQUIRE(v1.len() == 3);
+    REQUIRE(v1.try_get(2).unwrap() == 5);
+
+    // empty ranges
+    REQUIRE(v1.remove_range(2, 2) == 0);
+    REQUIRE(v1.remove_range(5, 6) == 0);
+    REQUIRE(v1.len() == 3);
+}
+
+TEST_CASE("heapless::Vector::swap_remove", "[heapless][vector]")
+{
+    auto v1 = nel::heapless::Vector<int, 8>::empty();
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(v1.push(int(i)).is_ok());
+    }
+    REQUIRE(v1.swap_remove(1).unwrap() == 1);
+    REQUIRE(v1.len() == 3);
+    REQUIRE(v1.try_get(1).unwrap() == 3);
+    // removing last is ok.
+    REQUIRE(v1.swap_remove(2).unwrap() == 2);
+    REQUIRE(v1.len() == 2);
+    REQUIRE(v1.swap_remove(2).is_none());
+}
+
+TEST_CASE("heapless::Vector::retain", "[heapless][vector]")
+{
+    {
+        auto v1 = nel::heapless::Vector<int, 8>::empty();
+        for (int i = 0; i < 8; ++i) {
+            REQUIRE(v1.push(int(i)).is_ok());
+        }
+        // drop 1, 2, 5.
+        v1.retain([](int const &v) -> bool { return v != 1 && v != 2 && v != 5; });
+        REQUIRE(v1.len() == 5);
+        int const e[] {0, 3, 4, 6, 7};
+        for (int i = 0; i < 5; ++i) {
+            REQUIRE(v1.try_get(i).unwrap() == e[i]);
+        }
+
+        v1.retain([](int const &) -> bool { return false; });
+        REQUIRE(v1.is_empty());
+    }
+
+    {
+        // non-trivial values dropped are destroyed, kept are moved.
+        Stub::reset();
+        {
+            auto v1 = nel::heapless::Vector<Stub, 4>::empty();
+            for (int i = 0; i < 4; ++i) {
+                REQUIRE(v1.push(Stub(i)).is_ok());
+            }
+            v1.retain([](auto const &v) -> bool { return v.val % 2 == 1; });
+            REQUIRE(v1.len() == 2);
+            REQUIRE(Stub::instances == 2);
+            REQUIRE(v1.try_get(0).unwrap().val == 1);
+            REQUIRE(v1.try_get(1).unwrap().val == 3);
+        }
+        REQUIRE(Stub::instances == 0);
+    }
+}
+
 } // namespace vector
 } // namespace heapless
 } // namespace test
@@ -54,6 +54,10 @@ struct Vector
         typedef T Type;
 
     private:
+        // for append from vectors of other sizes.
+        template<typename U, Length const M>
+        friend struct Vector;
+
         // Number initialised.
         Length len_;
 
@@ -505,12 +509,63 @@ struct Vector
         }
 #    endif
 
-        // move contents of vec into this?
-        // Result<void, Vector<T>> push_back(Vector<T> &l) ?
-        // move contents of slice into this?
-        // Result<void, Slice<T>> push_back(Slice<T> &l) ?
-        // move contents of iter into this? into_vec?
-        // Result<void, Slice<T>> push_back(Iter<T> &l) ?
+        /**
+         * Copy the values of a slice onto the end of the vec.
+         *
+         * Copies in bulk (a byte copy if T is trivially copyable).
+         *
+         * @param s the slice of values to copy.
+         * @returns if successful, Result<void, Slice>::Ok()
+         * @returns if not enough room, Result<void, Slice>::Err() holding s, vec is unchanged.
+         */
+        Result<void, Slice<Type const>> NEL_WARN_UNUSED_RESULT
+        extend_from_slice(Slice<Type const> const s)
+        {
+            if (len() + s.len() > capacity()) { return Result<void, Slice<Type const>>::Err(s); }
+            elem::copy_uninit(end(), s.ptr(), s.len());
+            len_ += s.len();
+            return Result<void, Slice<Type const>>::Ok();
+        }
+
+        /**
+         * Move all the values of another vec onto the end of this.
+         *
+         * Relocates in bulk (a byte copy if T is trivially relocatable).
+         *
+         * @param o the vec to move the values of, is left empty.
+         * @returns if successful, Result<void, Vector>::Ok()
+         * @returns if not enough room, Result<void, Vector>::Err() holding o, vec is unchanged.
+         */
+        template<Length const M>
+        Result<void, Vector<Type, M>> NEL_WARN_UNUSED_RESULT append(Vector<Type, M> &&o)
+        {
+            if (len() + o.len() > capacity()) { return Result<void, Vector<Type, M>>::Err(move(o)); }
+            elem::relocate(end(), o.ptr(), o.len());
+            len_ += o.len();
+            o.len_ = 0;
+            return Result<void, Vector<Type, M>>::Ok();
+        }
+
+        /**
+         * Push the values from an iterator onto the end of the vec.
+         *
+         * Nothing to reserve, pushes until the iterator is exhausted or the vec is full.
+         *
+         * @param it the iterator to take values from.
+         * @returns if successful, Result<void, It>::Ok()
+         * @returns if vec fills, Result<void, It>::Err() holding the iterator,
+         *          at the first value not pushed.
+         */
+        template<typename It>
+        Result<void, It> NEL_WARN_UNUSED_RESULT extend(It it)
+        {
+            for (; !it.is_done(); it.inc()) {
+                if (is_full()) { return Result<void, It>::Err(move(it)); }
+                new (end()) Type(it.deref());
+                len_ += 1;
+            }
+            return Result<void, It>::Ok();
+        }
 
         /**
          * Remove and return the last item in the vec.
@@ -525,13 +580,109 @@ struct Vector
             return Some(move(*end()));
         }
 
-        // insert_at(idx, T &&) ?
-        // insert_at(idx, Array<T> &&) ?
-        // insert_at(idx, iter<T> it) ?
-        // remove_at(idx) ? drops or returns item
-        // remove_at(beg,end) ? drops or returns items..(how?)
-        // sort ?
-        // find ?
+        /**
+         * Insert a value at idx, shifting the values after it up one.
+         *
+         * Shifting is a memmove if T is trivially relocatable.
+         *
+         * @param idx index to insert at, may be len() to push.
+         * @param val the value to move into the vec.
+         * @returns if successful, Result<void, T>::Ok()
+         * @returns if idx > len() or full, Result<void, T>::Err() holding val
+         */
+        Result<void, Type> NEL_WARN_UNUSED_RESULT insert_at(Index const idx, Type &&val)
+        {
+            if (idx > len() || is_full()) { return Result<void, Type>::Err(move(val)); }
+            elem::relocate(ptr(idx + 1), ptr(idx), len() - idx);
+            new (ptr(idx)) Type(move(val));
+            len_ += 1;
+            return Result<void, Type>::Ok();
+        }
+
+        /**
+         * Remove and return the value at idx, shifting the values after it down one.
+         *
+         * @param idx index of the value to remove.
+         * @returns on success: Optional::Some holding the value
+         * @returns if idx is out of range: Optional::None
+         */
+        Optional<Type> remove_at(Index const idx)
+        {
+            if (idx >= len()) { return None; }
+            auto o = Some(move(*ptr(idx)));
+            ptr(idx)->~Type();
+            elem::relocate(ptr(idx), ptr(idx + 1), len() - idx - 1);
+            len_ -= 1;
+            return o;
+        }
+
+        /**
+         * Remove (and destroy) the values in [b, e), shifting the values after down.
+         *
+         * @param b index of the first value to remove.
+         * @param e index after the last value to remove, clamped to len().
+         * @returns the number of values removed.
+         */
+        Count remove_range(Index const b, Index e)
+        {
+            if (e > len()) { e = len(); }
+            if (b >= e) { return 0; }
+            for (Type *it = ptr(b); it != ptr(e); ++it) {
+                it->~Type();
+            }
+            elem::relocate(ptr(b), ptr(e), len() - e);
+            len_ -= e - b;
+            return e - b;
+        }
+
+        /**
+         * Remove and return the value at idx, replacing it with the last value.
+         *
+         * O(1), but does not keep order.
+         *
+         * @param idx index of the value to remove.
+         * @returns on success: Optional::Some holding the value
+         * @returns if idx is out of range: Optional::None
+         */
+        Optional<Type> swap_remove(Index const idx)
+        {
+            if (idx >= len()) { return None; }
+            auto o = Some(move(*ptr(idx)));
+            ptr(idx)->~Type();
+            len_ -= 1;
+            elem::relocate(ptr(idx), end(), (idx != len()) ? 1 : 0);
+            return o;
+        }
+
+        /**
+         * Keep only the values that pred returns true for, in order, in place.
+         *
+         * Kept values are shifted down in runs (a memmove if T is trivially relocatable).
+         *
+         * @param pred called with each value (as Type const &), returns true to keep it.
+         */
+        template<typename F>
+        void retain(F &&pred)
+        {
+            // write position, and start of the run of kept values still to move.
+            Index w = 0;
+            Index run = 0;
+            for (Index i = 0; i < len(); ++i) {
+                if (!pred(const_cast<Type const &>(*ptr(i)))) {
+                    // move kept run down in one go.
+                    elem::relocate(ptr(w), ptr(run), i - run);
+                    w += i - run;
+                    ptr(i)->~Type();
+                    run = i + 1;
+                }
+            }
+            elem::relocate(ptr(w), ptr(run), len() - run);
+            w += len() - run;
+            len_ = w;
+        }
+
+        // sort: see slice().sort(), sort_unstable() and friends.
+        // find: see slice().find(), contains(), position() and friends.
 
     public:
         /**
@@ -5,6 +5,8 @@
 namespace nel
 {
 
+struct SizeHint;
+
 template<typename It, typename InT, typename OutT>
 struct Iterator;
 
@@ -17,9 +19,33 @@ struct ChainIterator;
 template<typename It>
 struct FirstNIterator;
 
+template<typename It, typename Fn>
+struct FilterIterator;
+
+template<typename It>
+struct SkipIterator;
+
+template<typename It, typename Fn>
+struct TakeWhileIterator;
+
+template<typename It>
+struct StepByIterator;
+
+template<typename It1, typename It2>
+struct ZipIterator;
+
+template<typename It>
+struct EnumerateIterator;
+
+template<typename It>
+struct RevIterator;
+
 } // namespace nel
 
+#    include <nel/pair.hh>
 #    include <nel/optional.hh>
+#    include <nel/result.hh>
+#    include <nel/panic.hh>
 #    include <nel/log.hh>
 #    include <nel/defs.hh>
 
@@ -38,6 +64,77 @@ struct FirstNIterator;
 
 namespace nel
 {
+
+/**
+ * Bounds on the number of items an iterator has left to return.
+ *
+ * Exact when lower == upper, e.g. for a SliceIterator and any map/first_n/zip..
+ * over exact iterators, so a collect into a vector can reserve once up front.
+ * upper is unbounded when unknown.
+ */
+struct SizeHint
+{
+    public:
+        static constexpr Count unbounded = ~Count(0);
+
+        Count lower;
+        Count upper;
+
+    public:
+        static constexpr SizeHint exact(Count const n)
+        {
+            return SizeHint {n, n};
+        }
+
+        static constexpr SizeHint unknown(void)
+        {
+            return SizeHint {0, unbounded};
+        }
+
+        constexpr bool is_exact(void) const
+        {
+            return lower == upper;
+        }
+
+        // Bound on what's left once items are removed by an adapter.
+        constexpr SizeHint at_most(void) const
+        {
+            return SizeHint {0, upper};
+        }
+
+        // Bounds of two iterators run one after the other.
+        constexpr SizeHint operator+(SizeHint const &o) const
+        {
+            return SizeHint {sat_add(lower, o.lower), sat_add(upper, o.upper)};
+        }
+
+        // Bounds of two iterators run side by side, stopping at the shorter.
+        constexpr SizeHint min(SizeHint const &o) const
+        {
+            return SizeHint {(lower < o.lower) ? lower : o.lower,
+                             (upper < o.upper) ? upper : o.upper};
+        }
+
+        // Bounds clamped to at most n.
+        constexpr SizeHint min(Count const n) const
+        {
+            return min(exact(n));
+        }
+
+        // Bounds with n items taken off the front.
+        constexpr SizeHint skip(Count const n) const
+        {
+            return SizeHint {(lower > n) ? lower - n : 0,
+                             (upper == unbounded) ? unbounded : (upper > n) ? upper - n : 0};
+        }
+
+    private:
+        static constexpr Count sat_add(Count const a, Count const b)
+        {
+            return (a > unbounded - b) ? unbounded : a + b;
+        }
+};
+
 template<typename ItT, typename IT, typename OT>
 struct Iterator
 {
@@ -61,6 +158,8 @@ struct Iterator
 #    if defined(RUST_LIKE)
     public:
         Optional<OutT> next(void);
+        // Double-ended iterators also take items from the back.
+        Optional<OutT> next_back(void);
 #    endif // defined(RUST_LIKE)
 
     public:
@@ -68,6 +167,10 @@ struct Iterator
         constexpr bool is_done(void) const;
         void inc(void);
         constexpr OutT deref(void);
+        // Double-ended iterators also step/read from the back,
+        // dec() drops the last item, deref_back() returns it.
+        void dec(void);
+        OutT deref_back(void);
 
         constexpr operator bool(void) const
         {
@@ -86,6 +189,35 @@ struct Iterator
         }
 #    endif // defined(C_LIKE)
 
+    public:
+        /**
+         * Bounds on the number of items left, see SizeHint.
+         *
+         * Iterators that know better override this.
+         *
+         * @returns unknown, i.e. 0 to unbounded.
+         */
+        constexpr SizeHint size_hint(void) const
+        {
+            return SizeHint::unknown();
+        }
+
+        /**
+         * Push all items onto the end of a container (e.g. a heaped or heapless Vector).
+         *
+         * The container reserves once, from size_hint(), before pushing.
+         *
+         * @param c the container to push into, via its extend().
+         * @returns if successful, Result<void, ItT>::Ok()
+         * @returns if the container fills or runs out of memory, Result<void, ItT>::Err()
+         *          holding the iterator at the first item not pushed.
+         */
+        template<typename C>
+        Result<void, ItT> NEL_WARN_UNUSED_RESULT collect_into(C &c)
+        {
+            return c.extend(move(self()));
+        }
+
     public:
         /**
          * Apply fn to each item in iterator
@@ -144,11 +276,42 @@ enter:
         template<typename F>
         bool try_for_each(F &&fn)
         {
-            bool ok = true;
-            for (; ok && self(); ++self()) {
-                ok = fn(*self());
+            bool unused = true;
+            return self().try_fold(unused, [&fn](bool &, OutT e) { return fn(forward<OutT>(e)); });
+        }
+
+        /**
+         * Fold each item into acc, stop if fn returns false.
+         *
+         * The internal iteration hook: try_for_each is built on it, and the
+         * adapters (map, first_n, filter, chain) run their for_each/try_fold
+         * through their inner iterator's try_fold. So an iterator that overrides
+         * this runs its own loop under them, e.g. a chain runs one tight loop
+         * per part rather than checking which part it is in on every item.
+         * The base for_each/for_each2 keep their own loops.
+         *
+         * @param acc the folded value, updated in place.
+         * @param fn callable as bool(U &acc, OutT e), returns true to continue, false to stop.
+         * @return: true if iteration completed successfully
+         * @return: false if iteration was interrupted, the item fn stopped on is consumed.
+         */
+        template<typename U, typename F>
+        bool try_fold(U &acc, F &&fn)
+        {
+#    if defined(RUST_LIKE) && !defined(C_LIKE)
+            while (true) {
+                Optional<OutT> r = self().next();
+                if (r.is_none()) { return true; }
+                if (!fn(acc, r.unwrap())) { return false; }
             }
-            return ok;
+#    else
+            while (!self().is_done()) {
+                OutT e = self().deref();
+                self().inc();
+                if (!fn(acc, forward<OutT>(e))) { return false; }
+            }
+            return true;
+#    endif
         }
 
         /**
@@ -235,10 +398,52 @@ enter:
         {
             return ChainIterator<ItT>(move(self()), move(other));
         }
-};
 
-// x.zip(it2).for_each([&](??)->void{});
-// x.enum().for_each([&](??)->void {..});
+        // Only items fn returns true for.
+        template<typename Fn>
+        constexpr FilterIterator<ItT, Fn> filter(Fn &&fn)
+        {
+            return FilterIterator<ItT, Fn>(move(self()), forward<Fn>(fn));
+        }
+
+        // All but the first n items.
+        constexpr SkipIterator<ItT> skip(Count const n)
+        {
+            return SkipIterator<ItT>(move(self()), n);
+        }
+
+        // Items up to (not inc.) the first one fn returns false for.
+        template<typename Fn>
+        constexpr TakeWhileIterator<ItT, Fn> take_while(Fn &&fn)
+        {
+            return TakeWhileIterator<ItT, Fn>(move(self()), forward<Fn>(fn));
+        }
+
+        // The first item, then every step'th item after it.
+        constexpr StepByIterator<ItT> step_by(Count const step)
+        {
+            return StepByIterator<ItT>(move(self()), step);
+        }
+
+        // Pairs of items from self and other, until either runs out.
+        template<typename It2>
+        constexpr ZipIterator<ItT, It2> zip(It2 &&other)
+        {
+            return ZipIterator<ItT, It2>(move(self()), move(other));
+        }
+
+        // Pairs of (index, item).
+        constexpr EnumerateIterator<ItT> enumerate(void)
+        {
+            return EnumerateIterator<ItT>(move(self()));
+        }
+
+        // The items in reverse order, for double-ended iterators only.
+        constexpr RevIterator<ItT> rev(void)
+        {
+            return RevIterator<ItT>(move(self()));
+        }
+};
 
 template<typename It, typename V, typename Fn>
 struct MappingIterator: public Iterator<MappingIterator<It, V, Fn>, typename It::InT, V>
@@ -286,6 +491,12 @@ struct MappingIterator: public Iterator<MappingIterator<It, V, Fn>, typename It:
             return inner_.next().template map<OutT>(
                 [this](typename It::OutT &e) -> V { return fn_(e); });
         }
+
+        Optional<OutT> next_back(void)
+        {
+            return inner_.next_back().template map<OutT>(
+                [this](typename It::OutT &e) -> V { return fn_(e); });
+        }
 #    endif // defined(RUST_LIKE)
 
     public:
@@ -304,7 +515,38 @@ struct MappingIterator: public Iterator<MappingIterator<It, V, Fn>, typename It:
         {
             return fn_(inner_.deref());
         }
+
+        void dec(void)
+        {
+            inner_.dec();
+        }
+
+        OutT deref_back(void)
+        {
+            return fn_(inner_.deref_back());
+        }
 #    endif
+
+    public:
+        constexpr SizeHint size_hint(void) const
+        {
+            return inner_.size_hint();
+        }
+
+    public:
+        // Map inside inner's own loop.
+        template<typename F>
+        void for_each(F &&fn)
+        {
+            inner_.for_each([this, &fn](typename It::OutT e) { fn(fn_(e)); });
+        }
+
+        template<typename U, typename F>
+        bool try_fold(U &acc, F &&fn)
+        {
+            return inner_.try_fold(
+                acc, [this, &fn](U &a, typename It::OutT e) { return fn(a, fn_(e)); });
+        }
 };
 
 /**
@@ -361,8 +603,50 @@ struct FirstNIterator: public Iterator<FirstNIterator<It>, typename It::InT, typ
             return inner_.deref();
         }
 #    endif
+
+    public:
+        constexpr SizeHint size_hint(void) const
+        {
+            return inner_.size_hint().min((current_ < limit_) ? limit_ - current_ : 0);
+        }
+
+    public:
+        // Count inside inner's own loop, stopping it at the limit.
+        template<typename F>
+        void for_each(F &&fn)
+        {
+            if (current_ >= limit_) { return; }
+            bool unused = true;
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+                fn(e);
+                return ++current_ < limit_;
+            });
+        }
+
+        template<typename U, typename F>
+        bool try_fold(U &acc, F &&fn)
+        {
+            if (current_ >= limit_) { return true; }
+            bool stopped = false;
+            inner_.try_fold(acc, [this, &fn, &stopped](U &a, typename It::OutT e) {
+                ++current_;
+                if (!fn(a, e)) {
+                    stopped = true;
+                    return false;
+                }
+                return current_ < limit_;
+            });
+            return !stopped;
+        }
 };
 
+/**
+ * Return the items in the first iterator, then those in the second.
+ *
+ * Stepped from outside, each step checks which iterator it is in.
+ * for_each, try_fold and the folds built on them instead run
+ * one loop over each iterator in turn, e.g. a heapless::Queue's two segments.
+ */
 template<typename It>
 struct ChainIterator: public Iterator<ChainIterator<It>, typename It::InT, typename It::OutT>
 {
@@ -396,6 +680,18 @@ struct ChainIterator: public Iterator<ChainIterator<It>, typename It::InT, typen
         {
             return it1_.next().or_else([&](void) -> Optional<OutT> { return it2_.next(); });
         }
+
+        /**
+         * Return last item left in iterator or None if no more.
+         *
+         * @returns Optional::Some if iterator still active.
+         * @returns Optional::None if iterator exhausted.
+         */
+        Optional<OutT> next_back(void)
+        {
+            return it2_.next_back().or_else(
+                [&](void) -> Optional<OutT> { return it1_.next_back(); });
+        }
 #    endif // defined(RUST_LIKE)
 
     public:
@@ -418,8 +714,28 @@ struct ChainIterator: public Iterator<ChainIterator<It>, typename It::InT, typen
         {
             return (!it1_.is_done()) ? it1_.deref() : it2_.deref();
         }
+
+        void dec(void)
+        {
+            if (!it2_.is_done()) {
+                it2_.dec();
+            } else {
+                it1_.dec();
+            }
+        }
+
+        OutT deref_back(void)
+        {
+            return (!it2_.is_done()) ? it2_.deref_back() : it1_.deref_back();
+        }
 #    endif
 
+    public:
+        constexpr SizeHint size_hint(void) const
+        {
+            return it1_.size_hint() + it2_.size_hint();
+        }
+
     public:
         /**
          * Apply fn to each item in iterator
@@ -445,10 +761,566 @@ struct ChainIterator: public Iterator<ChainIterator<It>, typename It::InT, typen
         }
 #    endif // defined(C_LIKE)
 
+        template<typename U, typename F>
+        bool try_fold(U &acc, F &&fn)
+        {
+            return it1_.try_fold(acc, fn) && it2_.try_fold(acc, fn);
+        }
+};
+
+/**
+ * Return only the items in iterator fn returns true for.
+ *
+ * fn is called with each item (as It::OutT), so should take it by const &.
+ */
+template<typename It, typename Fn>
+struct FilterIterator: public Iterator<FilterIterator<It, Fn>, typename It::InT, typename It::OutT>
+{
+    public:
+        typedef typename It::OutT OutT;
+        typedef Fn FnT;
+
+    private:
+        It inner_;
+        FnT fn_;
+
+#    if defined(C_LIKE)
+        // Move inner on to the next item to return (or its end).
+        void settle(void)
+        {
+            while (!inner_.is_done() && !fn_(inner_.deref())) {
+                inner_.inc();
+            }
+        }
+#    endif
+
+    public:
+        constexpr FilterIterator(It &&inner, FnT &&fn)
+            : inner_(move(inner))
+            , fn_(forward<FnT>(fn))
+        {
+#    if defined(C_LIKE)
+            settle();
+#    endif
+        }
+
+    public:
+#    if defined(RUST_LIKE)
+        /**
+         * Return next item in iterator or None is no more.
+         *
+         * @returns Optional::Some if iterator still active.
+         * @returns Optional::None if iterator exhausted.
+         */
+        Optional<OutT> next(void)
+        {
+            while (true) {
+                Optional<OutT> r = inner_.next();
+                if (r.is_none()) { return None; }
+                OutT e = r.unwrap();
+                if (fn_(e)) { return Some(forward<OutT>(e)); }
+            }
+        }
+#    endif // defined(RUST_LIKE)
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return inner_.is_done();
+        }
+
+        void inc(void)
+        {
+            inner_.inc();
+            settle();
+        }
+
+        OutT deref(void)
+        {
+            return inner_.deref();
+        }
+#    endif
+
+    public:
+        constexpr SizeHint size_hint(void) const
+        {
+            return inner_.size_hint().at_most();
+        }
+
+    public:
+        // Test and apply in one pass, so each item is deref'd once.
         template<typename F>
-        bool try_for_each(F &&fn)
+        void for_each(F &&fn)
+        {
+            inner_.for_each([this, &fn](OutT e) {
+                if (fn_(e)) { fn(forward<OutT>(e)); }
+            });
+        }
+
+        template<typename U, typename F>
+        bool try_fold(U &acc, F &&fn)
+        {
+            return inner_.try_fold(acc, [this, &fn](U &a, OutT e) {
+                return fn_(e) ? fn(a, forward<OutT>(e)) : true;
+            });
+        }
+};
+
+/**
+ * Skip the first n items in iterator, return the rest.
+ */
+template<typename It>
+struct SkipIterator: public Iterator<SkipIterator<It>, typename It::InT, typename It::OutT>
+{
+    public:
+        typedef typename It::OutT OutT;
+
+    private:
+        It inner_;
+        // C_LIKE skips up front, in the ctor. RUST_LIKE alone skips on the first next().
+#    if defined(RUST_LIKE) && !defined(C_LIKE)
+        Count to_skip_;
+#    endif
+
+    public:
+        constexpr SkipIterator(It &&inner, Count const n)
+            : inner_(move(inner))
+#    if defined(RUST_LIKE) && !defined(C_LIKE)
+            , to_skip_(n)
+#    endif
+        {
+#    if defined(C_LIKE)
+            for (Count i = 0; i < n && !inner_.is_done(); ++i) {
+                inner_.inc();
+            }
+#    endif
+        }
+
+    public:
+#    if defined(RUST_LIKE)
+        /**
+         * Return next item in iterator or None is no more.
+         *
+         * @returns Optional::Some if iterator still active.
+         * @returns Optional::None if iterator exhausted.
+         */
+        Optional<OutT> next(void)
+        {
+#        if !defined(C_LIKE)
+            for (; to_skip_ > 0; --to_skip_) {
+                if (inner_.next().is_none()) { return None; }
+            }
+#        endif
+            return inner_.next();
+        }
+#    endif // defined(RUST_LIKE)
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return inner_.is_done();
+        }
+
+        void inc(void)
+        {
+            inner_.inc();
+        }
+
+        OutT deref(void)
+        {
+            return inner_.deref();
+        }
+#    endif
+
+    public:
+        constexpr SizeHint size_hint(void) const
+        {
+#    if defined(RUST_LIKE) && !defined(C_LIKE)
+            return inner_.size_hint().skip(to_skip_);
+#    else
+            // already skipped.
+            return inner_.size_hint();
+#    endif
+        }
+};
+
+/**
+ * Return items in iterator until fn returns false for one, stop iteration there.
+ *
+ * fn is called with each item (as It::OutT), so should take it by const &.
+ */
+template<typename It, typename Fn>
+struct TakeWhileIterator
+    : public Iterator<TakeWhileIterator<It, Fn>, typename It::InT, typename It::OutT>
+{
+    public:
+        typedef typename It::OutT OutT;
+        typedef Fn FnT;
+
+    private:
+        It inner_;
+        FnT fn_;
+        bool done_;
+
+#    if defined(C_LIKE)
+        // Stop at the current item if fn says so.
+        void settle(void)
+        {
+            done_ = inner_.is_done() || !fn_(inner_.deref());
+        }
+#    endif
+
+    public:
+        constexpr TakeWhileIterator(It &&inner, FnT &&fn)
+            : inner_(move(inner))
+            , fn_(forward<FnT>(fn))
+            , done_(false)
+        {
+#    if defined(C_LIKE)
+            settle();
+#    endif
+        }
+
+    public:
+#    if defined(RUST_LIKE)
+        /**
+         * Return next item in iterator or None is no more.
+         *
+         * @returns Optional::Some if iterator still active.
+         * @returns Optional::None if iterator exhausted.
+         */
+        Optional<OutT> next(void)
+        {
+            if (done_) { return None; }
+            Optional<OutT> r = inner_.next();
+            if (r.is_some()) {
+                OutT e = r.unwrap();
+                if (fn_(e)) { return Some(forward<OutT>(e)); }
+            }
+            done_ = true;
+            return None;
+        }
+#    endif // defined(RUST_LIKE)
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return done_;
+        }
+
+        void inc(void)
+        {
+            inner_.inc();
+            settle();
+        }
+
+        OutT deref(void)
+        {
+            return inner_.deref();
+        }
+#    endif
+
+    public:
+        constexpr SizeHint size_hint(void) const
+        {
+            return done_ ? SizeHint::exact(0) : inner_.size_hint().at_most();
+        }
+};
+
+/**
+ * Return the first item in iterator, then every step'th item after it.
+ *
+ * step_by(1) returns every item.
+ * @warning Panics if step is 0.
+ */
+template<typename It>
+struct StepByIterator: public Iterator<StepByIterator<It>, typename It::InT, typename It::OutT>
+{
+    public:
+        typedef typename It::OutT OutT;
+
+    private:
+        It inner_;
+        Count const step_;
+#    if defined(RUST_LIKE)
+        bool first_;
+#    endif
+
+    public:
+        constexpr StepByIterator(It &&inner, Count const step)
+            : inner_(move(inner))
+            , step_(step)
+#    if defined(RUST_LIKE)
+            , first_(true)
+#    endif
+        {
+            nel::panic_if(step == 0, "step_by: step must be > 0");
+        }
+
+    public:
+#    if defined(RUST_LIKE)
+        /**
+         * Return next item in iterator or None is no more.
+         *
+         * @returns Optional::Some if iterator still active.
+         * @returns Optional::None if iterator exhausted.
+         */
+        Optional<OutT> next(void)
+        {
+            if (!first_) {
+                for (Count i = 1; i < step_; ++i) {
+                    if (inner_.next().is_none()) { return None; }
+                }
+            }
+            first_ = false;
+            return inner_.next();
+        }
+#    endif // defined(RUST_LIKE)
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return inner_.is_done();
+        }
+
+        void inc(void)
+        {
+            for (Count i = 0; i < step_ && !inner_.is_done(); ++i) {
+                inner_.inc();
+            }
+        }
+
+        OutT deref(void)
+        {
+            return inner_.deref();
+        }
+#    endif
+
+    public:
+        constexpr SizeHint size_hint(void) const
+        {
+            SizeHint const h = inner_.size_hint();
+            return SizeHint {steps(h.lower),
+                             (h.upper == SizeHint::unbounded) ? h.upper : steps(h.upper)};
+        }
+
+    private:
+        // Items returned out of n left in inner.
+        constexpr Count steps(Count const n) const
+        {
+#    if defined(RUST_LIKE)
+            if (!first_) { return n / step_; }
+#    endif
+            return (n == 0) ? 0 : (n - 1) / step_ + 1;
+        }
+};
+
+/**
+ * Return pairs of items, one from each iterator, stop when either is exhausted.
+ */
+template<typename It1, typename It2>
+struct ZipIterator
+    : public Iterator<ZipIterator<It1, It2>, typename It1::InT,
+                      Pair<typename It1::OutT, typename It2::OutT>>
+{
+    public:
+        typedef Pair<typename It1::OutT, typename It2::OutT> OutT;
+
+    private:
+        It1 it1_;
+        It2 it2_;
+
+    public:
+        constexpr ZipIterator(It1 &&it1, It2 &&it2)
+            : it1_(move(it1))
+            , it2_(move(it2))
+        {
+        }
+
+    public:
+#    if defined(RUST_LIKE)
+        /**
+         * Return next item in iterator or None is no more.
+         *
+         * @returns Optional::Some if iterator still active.
+         * @returns Optional::None if iterator exhausted.
+         */
+        Optional<OutT> next(void)
+        {
+            Optional<typename It1::OutT> a = it1_.next();
+            if (a.is_none()) { return None; }
+            Optional<typename It2::OutT> b = it2_.next();
+            if (b.is_none()) { return None; }
+            return Some(OutT {a.unwrap(), b.unwrap()});
+        }
+#    endif // defined(RUST_LIKE)
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return it1_.is_done() || it2_.is_done();
+        }
+
+        void inc(void)
+        {
+            it1_.inc();
+            it2_.inc();
+        }
+
+        OutT deref(void)
+        {
+            return OutT {it1_.deref(), it2_.deref()};
+        }
+#    endif
+
+    public:
+        constexpr SizeHint size_hint(void) const
+        {
+            return it1_.size_hint().min(it2_.size_hint());
+        }
+};
+
+/**
+ * Return pairs of (index, item) for the items in iterator, index counting from 0.
+ */
+template<typename It>
+struct EnumerateIterator
+    : public Iterator<EnumerateIterator<It>, typename It::InT, Pair<Index, typename It::OutT>>
+{
+    public:
+        typedef Pair<Index, typename It::OutT> OutT;
+
+    private:
+        It inner_;
+        Index idx_;
+
+    public:
+        constexpr EnumerateIterator(It &&inner)
+            : inner_(move(inner))
+            , idx_(0)
+        {
+        }
+
+    public:
+#    if defined(RUST_LIKE)
+        /**
+         * Return next item in iterator or None is no more.
+         *
+         * @returns Optional::Some if iterator still active.
+         * @returns Optional::None if iterator exhausted.
+         */
+        Optional<OutT> next(void)
+        {
+            Optional<typename It::OutT> r = inner_.next();
+            if (r.is_none()) { return None; }
+            return Some(OutT {idx_++, r.unwrap()});
+        }
+#    endif // defined(RUST_LIKE)
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return inner_.is_done();
+        }
+
+        void inc(void)
+        {
+            inner_.inc();
+            ++idx_;
+        }
+
+        OutT deref(void)
+        {
+            return OutT {idx_, inner_.deref()};
+        }
+#    endif
+
+    public:
+        constexpr SizeHint size_hint(void) const
+        {
+            return inner_.size_hint();
+        }
+};
+
+/**
+ * Return the items in iterator in reverse order, last first.
+ *
+ * The inner iterator must be double-ended (next_back(), or dec()/deref_back()),
+ * e.g. SliceIterator, and chains and maps of them.
+ * A reversed iterator is itself double-ended, its back is the inner's front.
+ */
+template<typename It>
+struct RevIterator: public Iterator<RevIterator<It>, typename It::InT, typename It::OutT>
+{
+    public:
+        typedef typename It::OutT OutT;
+
+    private:
+        It inner_;
+
+    public:
+        constexpr RevIterator(It &&inner)
+            : inner_(move(inner))
+        {
+        }
+
+    public:
+#    if defined(RUST_LIKE)
+        /**
+         * Return next item in iterator or None is no more.
+         *
+         * @returns Optional::Some if iterator still active.
+         * @returns Optional::None if iterator exhausted.
+         */
+        Optional<OutT> next(void)
+        {
+            return inner_.next_back();
+        }
+
+        Optional<OutT> next_back(void)
+        {
+            return inner_.next();
+        }
+#    endif // defined(RUST_LIKE)
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return inner_.is_done();
+        }
+
+        void inc(void)
+        {
+            inner_.dec();
+        }
+
+        OutT deref(void)
+        {
+            return inner_.deref_back();
+        }
+
+        void dec(void)
+        {
+            inner_.inc();
+        }
+
+        OutT deref_back(void)
+        {
+            return inner_.deref();
+        }
+#    endif
+
+    public:
+        constexpr SizeHint size_hint(void) const
         {
-            return it1_.try_for_each(fn) && it2_.try_for_each(fn);
+            return inner_.size_hint();
         }
 };
 
@@ -1,12 +1,10 @@
 // -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
 #include <nel/memory.hh>
-#include <nel/panic.hh> // nel_*
+#include <nel/panic.hh> // nel::assert
 
 #include <cstdlib> //std::free, std::malloc, std::realloc
 #include <cstring> // std::memcpy, std::memset, std::memmove
 
-// #include <memory> // std::align
-
 namespace nel
 {
 namespace elem
@@ -68,7 +66,12 @@ void move(uint8_t *const d, uint8_t *const s, Length const n)
     //     *is = 0xa5;
     // }
     copy(d, s, n);
-    wipe(s, n);
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
 }
 
 void wipe(uint8_t *const d, Length const n)
@@ -98,82 +101,172 @@ bool ne(uint8_t const *a, uint8_t const *b, Length n)
     return std::memcmp(a, b, n) != 0;
 }
 
+// d[i] = p[i % 16] for i in [0, n), with normal stores:
+// the pattern once, then doubling the filled region.
+static void set_pattern(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    Length done = (n < 16) ? n : 16;
+    copy(d, p, done);
+    while (done < n) {
+        Length const m = (done < n - done) ? done : n - done;
+        copy(d + done, d, m);
+        done += m;
+    }
+}
+
+#if defined(__SSE2__)
+
+// Streaming stores bypass the cache through write combining buffers, one line each,
+// so whole 64 byte lines are written at a time, into 16 byte aligned destinations.
+// The unaligned head and tail, and copies too small to be worth it, use normal stores.
+// (Prefetching the source non-temporally was tried, it slowed the copy and the source
+// still evicted as much.)
+static constexpr Length streaming_min = 256;
+
+typedef long long int Line16 __attribute__((vector_size(16)));
+
+static inline Line16 load16(uint8_t const *const s)
+{
+    Line16 v;
+    std::memcpy(&v, s, sizeof(v));
+    return v;
+}
+
+static inline void stream16(uint8_t *const d, Line16 const &v)
+{
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    if (n < streaming_min) {
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+        Line16 const a = load16(s + i);
+        Line16 const b = load16(s + i + 16);
+        Line16 const c = load16(s + i + 32);
+        Line16 const e = load16(s + i + 48);
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+        stream16(d + i, load16(s + i));
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    copy(d + i, s + i, n - i);
+}
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    if (n < streaming_min) {
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    for (Index i = 0; i < head; ++i) {
+        d[i] = p[i];
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+        rotated[i] = p[(head + i) % 16];
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+        stream16(d + i, v);
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+        stream16(d + i, v);
+    }
+    __builtin_ia32_sfence();
+    for (; i < n; ++i) {
+        d[i] = p[i % 16];
+    }
+}
+
+#else
+
+// No streaming stores, e.g. ARM, plain copies.
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    copy(d, s, n);
+}
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    set_pattern(d, p, n);
+}
+
+#endif // defined(__SSE2__)
+
 } // namespace elem
 
-#if 0
-struct Alloc {
-        Length align_;
-        uint8_t payload[1];
-
-    public:
-        static Alloc *from_payload_ptr(void *p)
-        {
-            if (p == nullptr) { return nullptr; }
-
-            uint8_t *u8p = reinterpret_cast<uint8_t *>(p);
-            // has previous ptr been corrupted..
-            // nasty that this needs to be stored..
-            // nasty, using offsetof.
-            uint8_t *u8a = u8p - offsetof(Alloc, payload);
-            Alloc *a = reinterpret_cast<Alloc *>(u8a);
-            nel_assert((Length)(u8p - u8a) == a->align_);
-            return a;
-        }
-
-        void *to_payload_ptr(void)
-        {
-            return &payload;
-        }
-};
-
-void free_aligned(void *p)
-{
-    std::free(Alloc::from_payload_ptr(p));
-}
-
-static uint8_t *as_u8ptr_mut(void *p)
-{
-    return reinterpret_cast<uint8_t *>(p);
-}
-
-void *realloc_aligned(void *old_p, Length align, Length size)
-{
-    Alloc *old_a = Alloc::from_payload_ptr(old_p);
-
-    // unaligned start of allocated memory.
-    Alloc *new_a = reinterpret_cast<Alloc *>(std::realloc(old_a, size + align));
-    if (new_a == nullptr) { return new_a; }
-
-    void *new_p;
-    if (old_p != nullptr && new_a == old_a) {
-        // re-allocating and not moved in reallocation.
-        new_p = old_p;
-    } else {
-        // new alloc.. or moved in realloc.
-        // align to next highest al boundary.
-        void *p1 = new_a;
-        size_t sz2 = size + align;
-        uint8_t *aligneda_u8 = as_u8ptr_mut(std::align(align, size, p1, sz2));
-        // TODO: handle realign fails..
-        // if realign fails, object is invalid!!
-        nel_assert(aligneda_u8 != nullptr);
-        nel_assert((aligneda_u8 + size) <= (as_u8ptr_mut(new_a) + size + align));
-        if (new_a != old_a && aligneda_u8 != as_u8ptr_mut(new_a)) {
-            // if realloc'd and needed aligning then move data.
-            // more slowness, shame malloc cannot do this when allocating.
-            std::memmove(aligneda_u8, new_a, size);
-        }
-        Alloc *aligned_a = reinterpret_cast<Alloc *>(aligneda_u8);
-        aligned_a->align_ = align;
-        new_p = aligned_a->to_payload_ptr();
+// Aligned allocations are over-allocated by align bytes from the C heap.
+// The payload is the first align boundary leaving room for a Length in front,
+// which holds the offset from the start of the underlying allocation.
+// Malloc alignment is at least alignof(Length), so the payload is at most
+// align bytes in.
+static Length offset_of(uint8_t *const base, Length const align)
+{
+    USize const a = reinterpret_cast<USize>(base) + sizeof(Length);
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+}
+
+static Length &offset_field(uint8_t *const p)
+{
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+}
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    if (new_base == nullptr) { return nullptr; }
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
     }
+    offset_field(new_p) = new_offset;
     return new_p;
 }
 
-void *malloc_aligned(Length align, Length size)
+void *malloc_aligned(Length const align, Length const size)
 {
-    return realloc_aligned(nullptr, align, size);
+    return realloc_aligned(nullptr, align, 0, size);
 }
-#endif
 
 } // namespace nel
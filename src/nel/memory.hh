@@ -3,11 +3,25 @@
 #    define NEL_MEMORY_HH
 
 #    include <nel/defs.hh> // Length
+#    include <nel/traits.hh> // is_trivially_copyable, is_trivially_relocatable, ..
+#    include <nel/new.hh> // new (p) T()
 
 #    include <inttypes.h> // uint8_t
 
 #    include <cstddef> // std::nullptr_t
 
+// Poisoning: overwriting memory that no longer (or does not yet) hold a
+// value with a debug pattern, to make use of stale values stand out.
+// Costs a memset per move/growth, so on in debug builds only by default.
+// Override with -DNEL_POISON=0/1.
+#    if !defined(NEL_POISON)
+#        if defined(DEBUG)
+#            define NEL_POISON 1
+#        else
+#            define NEL_POISON 0
+#        endif
+#    endif
+
 namespace nel
 {
 
@@ -79,6 +93,61 @@ constexpr U &&forward(T &&t)
     return static_cast<U &&>(t);
 }
 
+/**
+ * Exchange the values of a and b.
+ *
+ * @param a first value
+ * @param b second value
+ *
+ * Uses T's move-ctor and move-assign, so works for move-only types.
+ */
+template<typename T>
+constexpr void swap(T &a, T &b)
+{
+    T t = move(a);
+    a = move(b);
+    b = move(t);
+}
+
+/**
+ * Allocate size bytes aligned to align, from the C heap.
+ *
+ * For alignments greater than malloc gives (alignof(std::max_align_t)).
+ * The offset back to the start of the underlying allocation is kept just
+ * in front of the returned pointer.
+ *
+ * @param align alignment required, must be a power of 2.
+ * @param size number of bytes required.
+ *
+ * @returns on success, pointer to the memory.
+ * @returns on fail, nullptr.
+ *
+ * @note memory must be released with free_aligned().
+ */
+void *malloc_aligned(Length const align, Length const size);
+
+/**
+ * Resize an allocation from malloc_aligned(), keeping its alignment.
+ *
+ * @param p allocation to resize, or nullptr to allocate anew.
+ * @param align alignment p was allocated with.
+ * @param old_size size p was allocated with.
+ * @param new_size size required.
+ *
+ * @returns on success, pointer to the resized memory (may have moved),
+ *          content up to the smaller of old_size and new_size is kept.
+ * @returns on fail, nullptr, p is then untouched and still valid.
+ */
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size);
+
+/**
+ * Release an allocation from malloc_aligned()/realloc_aligned().
+ *
+ * @param p allocation to release, may be nullptr.
+ */
+void free_aligned(void *const p);
+
 namespace elem
 {
 
@@ -118,6 +187,24 @@ void wipe(T &d)
     wipe(&d, 1);
 }
 
+/**
+ * Is memory poisoned by default (see NEL_POISON).
+ */
+constexpr bool poisoning = (NEL_POISON != 0);
+
+/**
+ * Wipe memory region [d, d+n), if poisoning.
+ *
+ * @param d destination region to poison.
+ * @param n size in bytes of region to poison.
+ *
+ * @see wipe()
+ */
+inline void poison(uint8_t *const d, Length const n)
+{
+    if constexpr (poisoning) { wipe(d, n); }
+}
+
 /**
  * Set elements [d,d+n) copy of s.
  *
@@ -125,22 +212,42 @@ void wipe(T &d)
  * @param s source value to use as template.
  * @param n number of elements to copy.
  *
- * @note Uses element copy-assn operator to copy.
+ * @note Uses element copy-assn operator to copy,
+ *       or byte copies if T is trivially copyable.
  *
  * @warning UB if [d, d+n) is not writable.
  * @warning UB if [d, d+n) is not initialised.
  */
+void set(uint8_t *const d, uint8_t const s, Length const n);
+
+void copy(uint8_t *const d, uint8_t const *const s, Length const n);
+
 template<typename T>
 void set(T d[], T const &s, Length const n)
 {
-    T *const e = d + n;
-    for (; d != e; ++d) {
-        *d = s;
+    if constexpr (is_trivially_copyable<T>) {
+        if (n == 0) { return; }
+        if constexpr (sizeof(T) == 1) {
+            set(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t const &>(s), n);
+        } else {
+            // seed one, then keep doubling the filled region.
+            copy(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t const *>(&s), sizeof(T));
+            Length done = 1;
+            while (done < n) {
+                Length const m = (done < n - done) ? done : n - done;
+                copy(reinterpret_cast<uint8_t *>(d + done), reinterpret_cast<uint8_t const *>(d),
+                     m * sizeof(T));
+                done += m;
+            }
+        }
+    } else {
+        T *const e = d + n;
+        for (; d != e; ++d) {
+            *d = s;
+        }
     }
 }
 
-void set(uint8_t *const d, uint8_t const s, Length const n);
-
 #    if 0
 template<typename T>
 Result<void, Error> WARN_UNUSED_RESULT try_set(T *d, T const &s, Length const n)
@@ -162,7 +269,8 @@ Result<void, Error> WARN_UNUSED_RESULT try_set(T *d, T const &s, Length const n)
  * @param n number of elements to copy.
  *
  * @note safe to call if d == s.
- * @note Uses element copy-assn operator to copy.
+ * @note Uses element copy-assn operator to copy,
+ *       or a byte copy if T is trivially copyable.
  *
  * @warning UB if [s, s+n) is not readable.
  * @warning UB if [d, d+n) is not writable.
@@ -173,14 +281,45 @@ void copy(T d[], T const s[], Length const n)
 {
     // don't copy if dest is same as src.
     if (d == s) { return; }
-    T *const e = d + n;
-    for (; d != e; ++d) {
-        *d = *s;
-        ++s;
+    if constexpr (is_trivially_copyable<T>) {
+        copy(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t const *>(s), n * sizeof(T));
+    } else {
+        T *const e = d + n;
+        for (; d != e; ++d) {
+            *d = *s;
+            ++s;
+        }
     }
 }
 
-void copy(uint8_t *const d, uint8_t const *const s, Length const n);
+/**
+ * Copy elements [s,s+n) into uninitialised [d,d+n).
+ *
+ * @param d destination array to receive values.
+ * @param s source array to provide templates.
+ * @param n number of elements to copy.
+ *
+ * @note Uses element copy-ctor to copy,
+ *       or a byte copy if T is trivially copyable.
+ *
+ * @warning UB if [s, s+n) is not readable.
+ * @warning UB if [d, d+n) is not writable.
+ * @warning UB if [d, d+n) is initialised (is not destroyed first).
+ * @warning UB if regions overlap.
+ */
+template<typename T>
+void copy_uninit(T d[], T const s[], Length const n)
+{
+    if constexpr (is_trivially_copyable<T>) {
+        copy(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t const *>(s), n * sizeof(T));
+    } else {
+        T *const e = d + n;
+        for (; d != e; ++d) {
+            new (d) T(*s);
+            ++s;
+        }
+    }
+}
 
 #    if 0
 template<typename T>
@@ -209,21 +348,151 @@ Result<void, Error> WARN_UNUSED_RESULT try_copy(T *d, T const *s, Length const n
  * @warning UB if [s, s+n) is not writable.
  *
  * @note safe to call if d == s.
- * @note Uses element move-assn operator to copy.
+ * @note Uses element move-assn operator to copy,
+ *       or a byte copy if T is trivially copyable (src is then left as is).
+ * @note for uint8_t, src is poisoned after (see poisoning).
  */
+void move(uint8_t *const d, uint8_t *const s, Length const n);
+
 template<typename T>
 void move(T d[], T s[], Length const n)
 {
     // don't move if dest is same as src.
     if (d == s) { return; }
-    T *const e = d + n;
-    for (; d != e; ++d) {
-        *d = nel::move(*s);
-        ++s;
+    if constexpr (is_trivially_copyable<T>) {
+        // a trivial move is a copy, src is still valid.
+        copy(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t const *>(s), n * sizeof(T));
+    } else {
+        T *const e = d + n;
+        for (; d != e; ++d) {
+            *d = nel::move(*s);
+            ++s;
+        }
     }
 }
 
-void move(uint8_t *const d, uint8_t *const s, Length const n);
+/**
+ * Copy bytes [s,s+n) to [d,d+n) with streaming (non-temporal) stores,
+ * that write to memory without first reading the destination into the cache.
+ *
+ * For copies much bigger than the last level cache, where the destination will not be
+ * read again soon (e.g. snapshots of large state): a normal copy would evict the
+ * working set of every other thread sharing that cache (the source is still read
+ * through the cache, so only halves what is evicted), and would first read each
+ * destination line from memory, a third more memory traffic.
+ * Ends with a store fence, so the copy is visible to other threads before any later store.
+ *
+ * Falls back to a normal copy where streaming stores are not available (non SSE2),
+ * and for small n.
+ *
+ * @warning UB if regions overlap.
+ */
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n);
+
+/**
+ * Fill [d,d+n) bytes with the 16 byte pattern p, using streaming stores.
+ *
+ * d[i] = p[i % 16].
+ *
+ * @see copy_streaming()
+ */
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n);
+
+/**
+ * Copy elements [s,s+n) to [d,d+n), with streaming stores if T is trivially copyable.
+ *
+ * @see copy(), copy_streaming()
+ */
+template<typename T>
+void copy_streaming(T d[], T const s[], Length const n)
+{
+    if (d == s) { return; }
+    if constexpr (is_trivially_copyable<T>) {
+        copy_streaming(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t const *>(s),
+                       n * sizeof(T));
+    } else {
+        copy(d, s, n);
+    }
+}
+
+/**
+ * Move elements [s,s+n) to [d,d+n), with streaming stores if T is trivially copyable.
+ *
+ * @see move(), copy_streaming()
+ */
+template<typename T>
+void move_streaming(T d[], T s[], Length const n)
+{
+    if (d == s) { return; }
+    if constexpr (is_trivially_copyable<T>) {
+        // a trivial move is a copy, src is still valid.
+        copy_streaming(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t const *>(s),
+                       n * sizeof(T));
+    } else {
+        move(d, s, n);
+    }
+}
+
+/**
+ * Set elements [d,d+n) copy of s, with streaming stores if T is trivially copyable
+ * and its size divides 16 (e.g. ints, floats, pointers).
+ *
+ * @see set(), copy_streaming()
+ */
+template<typename T>
+void set_streaming(T d[], T const &s, Length const n)
+{
+    if constexpr (is_trivially_copyable<T> && (16 % sizeof(T)) == 0) {
+        uint8_t p[16];
+        for (Index i = 0; i < 16; i += sizeof(T)) {
+            copy(p + i, reinterpret_cast<uint8_t const *>(&s), sizeof(T));
+        }
+        set_streaming(reinterpret_cast<uint8_t *>(d), p, n * sizeof(T));
+    } else {
+        set(d, s, n);
+    }
+}
+
+/**
+ * Relocate elements [s,s+n) to uninitialised [d,d+n).
+ *
+ * After, [d,d+n) is initialised and [s,s+n) is not,
+ * the src values have been moved and destroyed.
+ *
+ * @param d destination array to receive values.
+ * @param s source array to relocate from.
+ * @param n number of elements to relocate.
+ *
+ * @note safe to call if regions overlap.
+ * @note Uses element move-ctor and dtor,
+ *       or a byte copy if T is trivially relocatable.
+ *
+ * @warning UB if [d, d+n) is not writable.
+ * @warning UB if [d, d+n) is initialised (outside of any overlap).
+ * @warning UB if [s, s+n) is not initialised.
+ */
+void relocate(uint8_t *const d, uint8_t *const s, Length const n);
+
+template<typename T>
+void relocate(T d[], T s[], Length const n)
+{
+    if (d == s) { return; }
+    if constexpr (is_trivially_relocatable<T>) {
+        relocate(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t *>(s), n * sizeof(T));
+    } else if (d < s) {
+        // forwards, so overlap is not overwritten before it is read.
+        for (Index i = 0; i < n; ++i) {
+            new (&d[i]) T(nel::move(s[i]));
+            s[i].~T();
+        }
+    } else {
+        // backwards, so overlap is not overwritten before it is read.
+        for (Index i = n; i > 0; --i) {
+            new (&d[i - 1]) T(nel::move(s[i - 1]));
+            s[i - 1].~T();
+        }
+    }
+}
 
 /**
  * Compare for equality [a,a+n) to [b,b+n) element-wise.
@@ -236,13 +505,16 @@ void move(uint8_t *const d, uint8_t *const s, Length const n);
  * @returns false if regions are different or have diff content.
  *
  * @note comparison will stop at first fail.
- * @note uses the element == operator.
+ * @note uses the element == operator,
+ *       or a byte compare if T is bitwise comparable.
  *
  * @warning UB if [a,a+n) region cannot be read from.
  * @warning UB if [b,b+n) region cannot be read from.
  * @warning UB if [a, a+n) is not initialised.
  * @warning UB if [b, b+n) is not initialised.
  */
+bool eq(uint8_t const a[], uint8_t const b[], Length const n);
+
 template<typename T>
 bool eq(T const a[], T const b[], Length const n)
 {
@@ -251,12 +523,17 @@ bool eq(T const a[], T const b[], Length const n)
     if (a == b) { return true; }
     // empty regions are always eq.
     if (n == 0) { return true; }
-    T const *const e = a + n;
-    for (; a != e; ++a) {
-        if (!(*a == *b)) { return false; }
-        ++b;
+    if constexpr (is_bitwise_comparable<T>) {
+        return eq(reinterpret_cast<uint8_t const *>(a), reinterpret_cast<uint8_t const *>(b),
+                  n * sizeof(T));
+    } else {
+        T const *const e = a + n;
+        for (; a != e; ++a) {
+            if (!(*a == *b)) { return false; }
+            ++b;
+        }
+        return true;
     }
-    return true;
 }
 
 template<typename T>
@@ -279,8 +556,6 @@ bool eq(std::nullptr_t, std::nullptr_t, Length const n)
     return (n == 0);
 }
 
-bool eq(uint8_t const a[], uint8_t const b[], Length const n);
-
 /**
  * Compare for inequality [a,a+n) to [b,b+n) element-wise.
  *
@@ -292,23 +567,31 @@ bool eq(uint8_t const a[], uint8_t const b[], Length const n);
  * @returns true if regions are different and have diff content.
  *
  * @note comparison will stop at first fail.
- * @note uses the element != operator.
+ * @note uses the element != operator,
+ *       or a byte compare if T is bitwise comparable.
  *
  * @warning UB if [a, a+n) region cannot be read from.
  * @warning UB if [b, b+n) region cannot be read from.
  * @warning UB if [a, a+n) is not initialised.
  * @warning UB if [b, b+n) is not initialised.
  */
+bool ne(uint8_t const a[], uint8_t const b[], Length const n);
+
 template<typename T>
 bool ne(T const a[], T const b[], Length const n)
 {
     if (a == b) { return false; }
-    T const *const e = a + n;
-    for (; a != e; ++a) {
-        if (*a != *b) { return true; }
-        ++b;
+    if constexpr (is_bitwise_comparable<T>) {
+        return ne(reinterpret_cast<uint8_t const *>(a), reinterpret_cast<uint8_t const *>(b),
+                  n * sizeof(T));
+    } else {
+        T const *const e = a + n;
+        for (; a != e; ++a) {
+            if (*a != *b) { return true; }
+            ++b;
+        }
+        return false;
     }
-    return false;
 }
 
 template<typename T>
@@ -331,8 +614,6 @@ bool ne(std::nullptr_t, std::nullptr_t, Length const n)
     return (n != 0);
 }
 
-bool ne(uint8_t const a[], uint8_t const b[], Length const n);
-
 } // namespace elem
 
 } // namespace nel
@@ -0,0 +1,55 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#if !defined(NEL_PAIR_HH)
+#    define NEL_PAIR_HH
+
+namespace nel
+{
+
+template<typename A, typename B>
+struct Pair;
+
+} // namespace nel
+
+#    include <nel/log.hh>
+
+namespace nel
+{
+
+/**
+ * Pair
+ *
+ * Two values of possibly different types, held together.
+ * e.g. the items of zip() and enumerate() iterators.
+ *
+ * Either may be a reference, e.g. Pair<Index, int &>,
+ * in which case the pair refers to, but does not own, that value.
+ */
+template<typename A, typename B>
+struct Pair
+{
+    public:
+        A first;
+        B second;
+
+    public:
+        constexpr bool operator==(Pair const &o) const
+        {
+            return first == o.first && second == o.second;
+        }
+
+        constexpr bool operator!=(Pair const &o) const
+        {
+            return !(*this == o);
+        }
+
+    public:
+        friend Log &operator<<(Log &outs, Pair const &v)
+        {
+            outs << '(' << v.first << ',' << v.second << ')';
+            return outs;
+        }
+};
+
+} // namespace nel
+
+#endif // !defined(NEL_PAIR_HH)
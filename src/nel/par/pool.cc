@@ -0,0 +1,286 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#include <nel/par/pool.hh>
+#include <nel/heaped/allocator.hh> // Malloc
+
+#if defined(__unix__) || defined(__APPLE__)
+#    define NEL_PAR_PTHREADS 1
+#    include <pthread.h>
+#    include <unistd.h> // sysconf
+#endif
+
+namespace nel
+{
+namespace par
+{
+
+struct Pool::Shared
+{
+        // threads running chunks, including the caller.
+        Count n_threads_;
+
+#if defined(NEL_PAR_PTHREADS)
+        // workers started, n_threads_ - 1 once up.
+        Count n_workers_;
+        pthread_t *workers_;
+
+        // one run at a time.
+        pthread_mutex_t run_lock_;
+
+        // guards the fields below, and signals a new run (wake_) or its end (idle_).
+        pthread_mutex_t lock_;
+        pthread_cond_t wake_;
+        pthread_cond_t idle_;
+        // bumped for each run, so workers can tell a new one from a spurious wakeup.
+        USize generation_;
+        // workers still in the current run.
+        Count busy_;
+        bool stop_;
+#endif
+
+        // the current run, read by workers once woken.
+        Task task_;
+        void *ctx_;
+        Count n_chunks_;
+        // next chunk to claim, and if a task has failed. Atomic, outside the lock.
+        Index next_;
+        bool failed_;
+};
+
+namespace
+{
+
+typedef heaped::Malloc Alloc;
+
+// Claim and run chunks until none are left, or one fails.
+void run_chunks(Pool::Task const task, void *const ctx, Count const n_chunks, Index &next,
+                bool &failed)
+{
+    while (!__atomic_load_n(&failed, __ATOMIC_RELAXED)) {
+        Index const c = __atomic_fetch_add(&next, 1, __ATOMIC_RELAXED);
+        if (c >= n_chunks) { break; }
+        if (!task(ctx, c)) { __atomic_store_n(&failed, true, __ATOMIC_RELAXED); }
+    }
+}
+
+#if defined(NEL_PAR_PTHREADS)
+
+void *worker_main(void *const arg)
+{
+    Pool::Shared *const s = static_cast<Pool::Shared *>(arg);
+    USize seen = 0;
+
+    pthread_mutex_lock(&s->lock_);
+    for (;;) {
+        while (!s->stop_ && s->generation_ == seen) {
+            pthread_cond_wait(&s->wake_, &s->lock_);
+        }
+        if (s->stop_) { break; }
+        seen = s->generation_;
+        Pool::Task const task = s->task_;
+        void *const ctx = s->ctx_;
+        Count const n_chunks = s->n_chunks_;
+        pthread_mutex_unlock(&s->lock_);
+
+        run_chunks(task, ctx, n_chunks, s->next_, s->failed_);
+
+        pthread_mutex_lock(&s->lock_);
+        s->busy_ -= 1;
+        if (s->busy_ == 0) { pthread_cond_signal(&s->idle_); }
+    }
+    pthread_mutex_unlock(&s->lock_);
+    return nullptr;
+}
+
+// Stop and join the started workers, then free s.
+void destroy(Pool::Shared *const s)
+{
+    pthread_mutex_lock(&s->lock_);
+    s->stop_ = true;
+    pthread_cond_broadcast(&s->wake_);
+    pthread_mutex_unlock(&s->lock_);
+
+    for (Index i = 0; i < s->n_workers_; ++i) {
+        pthread_join(s->workers_[i], nullptr);
+    }
+
+    pthread_cond_destroy(&s->idle_);
+    pthread_cond_destroy(&s->wake_);
+    pthread_mutex_destroy(&s->lock_);
+    pthread_mutex_destroy(&s->run_lock_);
+    if (s->workers_ != nullptr) {
+        Alloc::free(s->workers_, alignof(pthread_t), (s->n_threads_ - 1) * sizeof(pthread_t));
+    }
+    Alloc::free(s, alignof(Pool::Shared), sizeof(Pool::Shared));
+}
+
+#else
+
+void destroy(Pool::Shared *const s)
+{
+    Alloc::free(s, alignof(Pool::Shared), sizeof(Pool::Shared));
+}
+
+#endif // defined(NEL_PAR_PTHREADS)
+
+} // namespace
+
+Pool::~Pool(void)
+{
+    if (shared_ != nullptr) { destroy(shared_); }
+}
+
+Pool &Pool::operator=(Pool &&o)
+{
+    if (this != &o) {
+        if (shared_ != nullptr) { destroy(shared_); }
+        shared_ = o.shared_;
+        o.shared_ = nullptr;
+    }
+    return *this;
+}
+
+Count Pool::available_parallelism(void)
+{
+#if defined(NEL_PAR_PTHREADS)
+    long const n = sysconf(_SC_NPROCESSORS_ONLN);
+    return (n < 1) ? 1 : Count(n);
+#else
+    return 1;
+#endif
+}
+
+Result<Pool, ParError> Pool::try_new(Count const n)
+{
+#if defined(NEL_PAR_PTHREADS)
+    Count const n_threads = (n == 0) ? available_parallelism() : n;
+#else
+    Count const n_threads = 1;
+    nel::unused(n);
+#endif
+
+    auto rs = Alloc::try_malloc(alignof(Shared), sizeof(Shared));
+    if (rs.is_err()) { return Result<Pool, ParError>::Err(ParError::OutOfMemory); }
+    Shared *const s = static_cast<Shared *>(rs.unwrap());
+    s->n_threads_ = n_threads;
+    s->task_ = nullptr;
+    s->ctx_ = nullptr;
+    s->n_chunks_ = 0;
+    s->next_ = 0;
+    s->failed_ = false;
+
+#if defined(NEL_PAR_PTHREADS)
+    s->n_workers_ = 0;
+    s->workers_ = nullptr;
+    s->generation_ = 0;
+    s->busy_ = 0;
+    s->stop_ = false;
+    pthread_mutex_init(&s->run_lock_, nullptr);
+    pthread_mutex_init(&s->lock_, nullptr);
+    pthread_cond_init(&s->wake_, nullptr);
+    pthread_cond_init(&s->idle_, nullptr);
+
+    // Pool now owns s, so destroys it on any failure below.
+    Pool pool(s);
+
+    if (n_threads > 1) {
+        auto rw = Alloc::try_malloc(alignof(pthread_t), (n_threads - 1) * sizeof(pthread_t));
+        if (rw.is_err()) { return Result<Pool, ParError>::Err(ParError::OutOfMemory); }
+        s->workers_ = static_cast<pthread_t *>(rw.unwrap());
+    }
+
+    for (Index i = 0; i < n_threads - 1; ++i) {
+        if (pthread_create(&s->workers_[i], nullptr, worker_main, s) != 0) {
+            return Result<Pool, ParError>::Err(ParError::SpawnFailed);
+        }
+        s->n_workers_ += 1;
+    }
+    return Result<Pool, ParError>::Ok(move(pool));
+#else
+    return Result<Pool, ParError>::Ok(Pool(s));
+#endif
+}
+
+Count Pool::n_threads(void) const
+{
+    return shared_->n_threads_;
+}
+
+Length Pool::chunk_len(Length const len, Length const item_size) const
+{
+    // fewest items that make whole cache lines: cache_line / gcd(item_size, cache_line).
+    Length const pow2 = item_size & (~item_size + 1);
+    Length const line_items = cache_line / ((pow2 < cache_line) ? pow2 : cache_line);
+    Length const min_items = (item_size < min_chunk_bytes) ? min_chunk_bytes / item_size : 1;
+    Length const even = len / (n_threads() * chunks_per_thread);
+    Length const c = (even > min_items) ? even : min_items;
+    return ((c + line_items - 1) / line_items) * line_items;
+}
+
+Chunks Pool::chunks(void const *const p, Length const len, Length const item_size) const
+{
+    Length const cl = chunk_len(len, item_size);
+    // items up to the first cache line edge, if an item boundary lands on one.
+    USize const off = reinterpret_cast<USize>(p) % cache_line;
+    Length head = 0;
+    if (off != 0) {
+        for (Length h = 1; h < cache_line; ++h) {
+            if ((off + h * item_size) % cache_line == 0) {
+                head = h;
+                break;
+            }
+        }
+    }
+    return Chunks(len, cl, head);
+}
+
+Result<void, ParError> Pool::run(Count const n_chunks, Task const task, void *const ctx)
+{
+    Shared *const s = shared_;
+    if (n_chunks == 0) { return Result<void, ParError>::Ok(); }
+
+#if defined(NEL_PAR_PTHREADS)
+    pthread_mutex_lock(&s->run_lock_);
+#endif
+
+    s->task_ = task;
+    s->ctx_ = ctx;
+    s->n_chunks_ = n_chunks;
+    s->next_ = 0;
+    s->failed_ = false;
+
+#if defined(NEL_PAR_PTHREADS)
+    // A single chunk isn't worth waking anyone for.
+    bool const wake = s->n_workers_ > 0 && n_chunks > 1;
+    if (wake) {
+        pthread_mutex_lock(&s->lock_);
+        s->generation_ += 1;
+        s->busy_ = s->n_workers_;
+        pthread_cond_broadcast(&s->wake_);
+        pthread_mutex_unlock(&s->lock_);
+    }
+#endif
+
+    run_chunks(task, ctx, n_chunks, s->next_, s->failed_);
+
+#if defined(NEL_PAR_PTHREADS)
+    if (wake) {
+        pthread_mutex_lock(&s->lock_);
+        while (s->busy_ != 0) {
+            pthread_cond_wait(&s->idle_, &s->lock_);
+        }
+        pthread_mutex_unlock(&s->lock_);
+    }
+#endif
+
+    bool const failed = s->failed_;
+
+#if defined(NEL_PAR_PTHREADS)
+    pthread_mutex_unlock(&s->run_lock_);
+#endif
+
+    if (failed) { return Result<void, ParError>::Err(ParError::Cancelled); }
+    return Result<void, ParError>::Ok();
+}
+
+} // namespace par
+} // namespace nel
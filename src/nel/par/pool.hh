@@ -0,0 +1,362 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#if !defined(NEL_PAR_POOL_HH)
+#    define NEL_PAR_POOL_HH
+
+#    include <nel/defs.hh> // Length
+
+namespace nel
+{
+namespace par
+{
+
+enum class ParError;
+
+struct Chunks;
+
+struct Pool;
+
+} // namespace par
+} // namespace nel
+
+#    include <nel/heaped/vector.hh>
+#    include <nel/slice.hh>
+#    include <nel/result.hh>
+#    include <nel/memory.hh> // move, forward
+#    include <nel/log.hh>
+#    include <nel/panic.hh>
+#    include <nel/traits.hh> // remove_reference
+#    include <nel/defs.hh>
+
+namespace nel
+{
+namespace par
+{
+
+/**
+ * Reasons a parallel run can fail.
+ */
+enum class ParError {
+    // A worker thread could not be started.
+    SpawnFailed = 1,
+    // A task reported failure, remaining chunks were not run.
+    Cancelled,
+    // Not enough memory for the pool, or for per-chunk results.
+    OutOfMemory,
+    // Source and destination slices are of different lengths.
+    LengthMismatch,
+};
+
+inline Log &operator<<(Log &outs, ParError const &val)
+{
+    switch (val) {
+        case ParError::SpawnFailed:
+            return outs << "SpawnFailed";
+        case ParError::Cancelled:
+            return outs << "Cancelled";
+        case ParError::OutOfMemory:
+            return outs << "OutOfMemory";
+        case ParError::LengthMismatch:
+            return outs << "LengthMismatch";
+        default:
+            break;
+    }
+    nel::panic("unknown ParError");
+    return outs << '?';
+}
+
+/**
+ * How a run over len items is split into chunks, see Pool::chunks().
+ *
+ * Chunk c covers items [begin(c), end(c)). Each is chunk_len items, except
+ * the first also takes the head items before the first cache line edge,
+ * and the last takes whatever is left.
+ */
+struct Chunks
+{
+    private:
+        Length len_;
+        Length chunk_len_;
+        Length head_;
+
+    public:
+        constexpr Chunks(Length const len, Length const chunk_len, Length const head)
+            : len_(len)
+            , chunk_len_(chunk_len)
+            , head_(head)
+        {
+        }
+
+    public:
+        constexpr Count n_chunks(void) const
+        {
+            if (len_ <= head_) { return (len_ == 0) ? 0 : 1; }
+            return (len_ - head_ + chunk_len_ - 1) / chunk_len_;
+        }
+
+        constexpr Index begin(Index const c) const
+        {
+            return (c == 0) ? 0 : head_ + c * chunk_len_;
+        }
+
+        constexpr Index end(Index const c) const
+        {
+            return (c + 1 >= n_chunks()) ? len_ : head_ + (c + 1) * chunk_len_;
+        }
+};
+
+/**
+ * Pool
+ *
+ * A fixed set of worker threads, started once, that run chunked work in parallel.
+ *
+ * A run splits work into n chunks; the workers and the calling thread
+ * claim chunks one at a time (an atomic counter) until none are left,
+ * so uneven chunks balance out.
+ * The caller blocks until every chunk is done.
+ *
+ * A task returns false to fail; chunks not yet claimed are then skipped and
+ * the run returns Err(Cancelled). Chunks already running complete.
+ *
+ * Runs are serialised, one at a time per pool.
+ * A task must not start a run on the pool it is running on.
+ *
+ * Uses pthreads where the target has them; elsewhere (e.g. bare metal)
+ * the pool has no workers and runs everything on the calling thread.
+ *
+ * usage:
+ * ```c++
+ *    auto pool = nel::par::Pool::try_new(0).unwrap(); // one thread per cpu
+ *    nel::par_for_each(pool, values, [](float &v) { v = score(v); }).unwrap();
+ * ```
+ */
+struct Pool
+{
+    public:
+        // The task for a chunk. Returns false on failure.
+        typedef bool (*Task)(void *ctx, Index chunk);
+
+        // Chunks are at least this big, so claiming one (an atomic add) is amortised.
+        static constexpr Length min_chunk_bytes = 32 * 1024;
+        // Aim for this many chunks per thread, so a slow chunk doesn't hold up the run.
+        static constexpr Count chunks_per_thread = 4;
+        // Chunk edges are aligned to this (see chunks()),
+        // so neighbouring chunks don't share cache lines.
+        static constexpr Length cache_line = 64;
+
+    public:
+        // State shared with the workers, heap allocated so the pool can move.
+        // Opaque outside of pool.cc.
+        struct Shared;
+
+    private:
+        Shared *shared_;
+
+    private:
+        constexpr Pool(Shared *const s)
+            : shared_(s)
+        {
+        }
+
+    public:
+        ~Pool(void);
+
+        Pool(Pool const &) = delete;
+        Pool &operator=(Pool const &) = delete;
+
+        constexpr Pool(Pool &&o)
+            : shared_(o.shared_)
+        {
+            o.shared_ = nullptr;
+        }
+
+        Pool &operator=(Pool &&o);
+
+    public:
+        /**
+         * Create a pool of n threads, the caller of a run counting as one.
+         *
+         * @param n number of threads, 0 for one per online cpu.
+         *
+         * @returns on success, Ok with the pool, its workers waiting.
+         * @returns on fail, Err(SpawnFailed) or Err(OutOfMemory).
+         */
+        static Result<Pool, ParError> try_new(Count const n);
+
+        /**
+         * Number of online cpus, 1 if unknown.
+         */
+        static Count available_parallelism(void);
+
+    public:
+        /**
+         * Number of threads running chunks, including the caller.
+         */
+        Count n_threads(void) const;
+
+        /**
+         * Number of items in each chunk, when splitting len items of item_size bytes.
+         *
+         * At least min_chunk_bytes worth and rounded up to whole cache lines,
+         * but no bigger than needed for chunks_per_thread chunks per thread.
+         */
+        Length chunk_len(Length const len, Length const item_size) const;
+
+        /**
+         * Split len items of item_size bytes, starting at p, into chunks of chunk_len().
+         *
+         * The first chunk also takes the items before the first cache line edge,
+         * so the edges between chunks fall on cache line edges.
+         * That needs an item boundary to land on one, i.e. p aligned to the
+         * largest power of 2 dividing item_size (up to cache_line);
+         * if not, the edges are left where they fall.
+         */
+        Chunks chunks(void const *const p, Length const len, Length const item_size) const;
+
+        /**
+         * Run task for every chunk in [0, n_chunks), in parallel.
+         *
+         * @param n_chunks number of chunks.
+         * @param task the task, given ctx and the chunk index.
+         * @param ctx passed, unchanged, to task.
+         *
+         * @returns Ok if all tasks succeeded.
+         * @returns Err(Cancelled) if any task failed.
+         */
+        Result<void, ParError> run(Count const n_chunks, Task const task, void *const ctx);
+
+        /**
+         * Run f(chunk) for every chunk in [0, n_chunks), in parallel.
+         *
+         * @param f callable as bool(Index) or void(Index).
+         */
+        template<typename F>
+        Result<void, ParError> run(Count const n_chunks, F &&f)
+        {
+            return run(n_chunks, &thunk<F>, &f);
+        }
+
+    private:
+        template<typename F>
+        static bool thunk(void *const ctx, Index const chunk)
+        {
+            F &f = *static_cast<remove_reference<F> *>(ctx);
+            if constexpr (__is_same(decltype(f(chunk)), bool)) {
+                return f(chunk);
+            } else {
+                f(chunk);
+                return true;
+            }
+        }
+};
+
+} // namespace par
+
+/**
+ * Call f on every item of s, in parallel on pool.
+ *
+ * @param pool the threads to use.
+ * @param s the items, split into pool.chunks().
+ * @param f callable as void(T &), or bool(T &) returning false to fail the run.
+ *
+ * @returns Ok if all calls succeeded.
+ * @returns Err(Cancelled) if f failed, not all items will have been visited.
+ */
+template<typename T, typename F>
+Result<void, par::ParError> par_for_each(par::Pool &pool, Slice<T> const &s, F &&f)
+{
+    par::Chunks const ch = pool.chunks(s.ptr(), s.len(), sizeof(T));
+    return pool.run(ch.n_chunks(), [&s, &f, ch](Index const c) -> bool {
+        T *const p = s.ptr();
+        for (Index i = ch.begin(c), e = ch.end(c); i < e; ++i) {
+            if constexpr (__is_same(decltype(f(p[i])), bool)) {
+                if (!f(p[i])) { return false; }
+            } else {
+                f(p[i]);
+            }
+        }
+        return true;
+    });
+}
+
+/**
+ * Set dst[i] = f(src[i]) for all items, in parallel on pool.
+ *
+ * @param pool the threads to use.
+ * @param src the items to map.
+ * @param dst where to put the mapped values, same length as src.
+ * @param f callable as U(T &).
+ *
+ * @returns Ok if all done.
+ * @returns Err(LengthMismatch) if src and dst differ in length, nothing is done.
+ */
+template<typename T, typename U, typename F>
+Result<void, par::ParError> par_map_into(par::Pool &pool, Slice<T> const &src,
+                                         Slice<U> const &dst, F &&f)
+{
+    if (src.len() != dst.len()) {
+        return Result<void, par::ParError>::Err(par::ParError::LengthMismatch);
+    }
+    // chunk by the destination, so chunks' writes don't share cache lines.
+    par::Chunks const ch = pool.chunks(dst.ptr(), dst.len(), sizeof(U));
+    return pool.run(ch.n_chunks(), [&src, &dst, &f, ch](Index const c) {
+        T *const s = src.ptr();
+        U *const d = dst.ptr();
+        for (Index i = ch.begin(c), e = ch.end(c); i < e; ++i) {
+            d[i] = f(s[i]);
+        }
+    });
+}
+
+/**
+ * Reduce the items of s to a single value, in parallel on pool.
+ *
+ * Each chunk is folded, from a copy of identity, into a partial value,
+ * then the partials are combined in chunk order on the calling thread.
+ * So for a given pool size the result is the same from run to run,
+ * even for non-associative folds (e.g. float sums).
+ *
+ * @param pool the threads to use.
+ * @param s the items to reduce.
+ * @param identity the starting value for each chunk (and the result if s is empty).
+ * @param fold callable as void(U &acc, T &item).
+ * @param combine callable as void(U &acc, U &&partial).
+ *
+ * @returns on success, Ok with the reduced value.
+ * @returns on fail, Err(OutOfMemory) if there's no space for the partials.
+ */
+template<typename T, typename U, typename F, typename C>
+Result<U, par::ParError> par_reduce(par::Pool &pool, Slice<T> const &s, U const &identity,
+                                    F &&fold, C &&combine)
+{
+    par::Chunks const ch = pool.chunks(s.ptr(), s.len(), sizeof(T));
+    Count const n_chunks = ch.n_chunks();
+
+    auto parts = heaped::Vector<U>::with_capacity(n_chunks);
+    if (parts.capacity() < n_chunks) {
+        return Result<U, par::ParError>::Err(par::ParError::OutOfMemory);
+    }
+    for (Index c = 0; c < n_chunks; ++c) {
+        parts.push(U(identity)).unwrap();
+    }
+    U *const pp = parts.slice().ptr();
+
+    auto r = pool.run(n_chunks, [&s, &fold, pp, ch](Index const c) {
+        T *const p = s.ptr();
+        U acc = move(pp[c]);
+        for (Index i = ch.begin(c), e = ch.end(c); i < e; ++i) {
+            fold(acc, p[i]);
+        }
+        pp[c] = move(acc);
+    });
+    if (r.is_err()) { return Result<U, par::ParError>::Err(r.unwrap_err()); }
+
+    U acc = U(identity);
+    for (Index c = 0; c < n_chunks; ++c) {
+        combine(acc, move(pp[c]));
+    }
+    return Result<U, par::ParError>::Ok(move(acc));
+}
+
+} // namespace nel
+
+#endif // !defined(NEL_PAR_POOL_HH)
@@ -0,0 +1,221 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#include <nel/par/pool.hh>
+#include <nel/heaped/vector.hh>
+#include <nel/memory.hh> // move()
+
+#include <catch2/catch.hpp>
+
+namespace nel
+{
+namespace test
+{
+namespace par
+{
+namespace pool
+{
+
+// big enough for several chunks per thread.
+static constexpr Length n_values = 1000 * 1000;
+
+static heaped::Vector<int> iota(Length const n)
+{
+    auto v = heaped::Vector<int>::with_capacity(n);
+    for (Index i = 0; i < n; ++i) {
+        v.push(int(i)).unwrap();
+    }
+    return v;
+}
+
+TEST_CASE("par::Pool::try_new", "[par][pool]")
+{
+    {
+        auto p1 = nel::par::Pool::try_new(4).unwrap();
+        REQUIRE(p1.n_threads() == 4);
+    }
+    {
+        // 0 is one per cpu.
+        auto p1 = nel::par::Pool::try_new(0).unwrap();
+        REQUIRE(p1.n_threads() == nel::par::Pool::available_parallelism());
+        REQUIRE(p1.n_threads() >= 1);
+    }
+    {
+        // moves, workers and all.
+        auto p1 = nel::par::Pool::try_new(2).unwrap();
+        auto p2 = nel::move(p1);
+        REQUIRE(p2.n_threads() == 2);
+        auto p3 = nel::par::Pool::try_new(1).unwrap();
+        p3 = nel::move(p2);
+        REQUIRE(p3.n_threads() == 2);
+    }
+}
+
+TEST_CASE("par::Pool::chunk_len", "[par][pool]")
+{
+    auto p1 = nel::par::Pool::try_new(4).unwrap();
+
+    // never under min_chunk_bytes worth.
+    REQUIRE(p1.chunk_len(10, sizeof(int)) == nel::par::Pool::min_chunk_bytes / sizeof(int));
+    REQUIRE(p1.chunk_len(0, sizeof(int)) > 0);
+
+    // split for chunks_per_thread, in whole cache lines.
+    Length const cl = p1.chunk_len(n_values, sizeof(int));
+    REQUIRE(cl % (nel::par::Pool::cache_line / sizeof(int)) == 0);
+    REQUIRE((n_values + cl - 1) / cl == 4 * nel::par::Pool::chunks_per_thread);
+
+    // items bigger than a chunk.
+    REQUIRE(p1.chunk_len(10, 2 * nel::par::Pool::min_chunk_bytes) == 1);
+}
+
+// Chunks tile [0, len) in order, return how many inner edges are off a cache line.
+static Count unaligned_edges(nel::par::Pool const &pool, USize const addr, Length const len,
+                             Length const item_size)
+{
+    auto const ch = pool.chunks(reinterpret_cast<void const *>(addr), len, item_size);
+    REQUIRE(ch.n_chunks() >= 1);
+    REQUIRE(ch.begin(0) == 0);
+    REQUIRE(ch.end(ch.n_chunks() - 1) == len);
+    Count bad = 0;
+    for (Index c = 1; c < ch.n_chunks(); ++c) {
+        REQUIRE(ch.begin(c) == ch.end(c - 1));
+        REQUIRE(ch.begin(c) < ch.end(c));
+        bad += ((addr + ch.begin(c) * item_size) % nel::par::Pool::cache_line != 0) ? 1 : 0;
+    }
+    return bad;
+}
+
+TEST_CASE("par::Pool::chunks", "[par][pool]")
+{
+    auto p1 = nel::par::Pool::try_new(4).unwrap();
+
+    // edges on cache lines, wherever the items start.
+    REQUIRE(unaligned_edges(p1, 0x10000, n_values, sizeof(int)) == 0);
+    REQUIRE(unaligned_edges(p1, 0x10004, n_values, sizeof(int)) == 0);
+    REQUIRE(unaligned_edges(p1, 0x1003c, n_values, sizeof(int)) == 0);
+    REQUIRE(unaligned_edges(p1, 0x10008, n_values, 8) == 0);
+
+    // items that don't divide a cache line.
+    REQUIRE(p1.chunk_len(n_values, 12) * 12 % nel::par::Pool::cache_line == 0);
+    REQUIRE(unaligned_edges(p1, 0x10004, n_values, 12) == 0);
+    REQUIRE(unaligned_edges(p1, 0x10020, n_values, 96) == 0);
+
+    // no item boundary on a cache line, edges are left where they fall.
+    REQUIRE(unaligned_edges(p1, 0x10001, n_values, 8) > 0);
+
+    // fewer items than the head, or none.
+    REQUIRE(unaligned_edges(p1, 0x10004, 3, sizeof(int)) == 0);
+    auto const ch = p1.chunks(nullptr, 0, sizeof(int));
+    REQUIRE(ch.n_chunks() == 0);
+}
+
+TEST_CASE("par::Pool::run", "[par][pool]")
+{
+    auto p1 = nel::par::Pool::try_new(4).unwrap();
+
+    // every chunk run exactly once.
+    int runs[100] = {};
+    auto inc = [&runs](Index const c) { __atomic_fetch_add(&runs[c], 1, __ATOMIC_RELAXED); };
+    REQUIRE(p1.run(100, inc).is_ok());
+    for (Index i = 0; i < 100; ++i) {
+        REQUIRE(runs[i] == 1);
+    }
+
+    // nothing to do.
+    REQUIRE(p1.run(0, [](Index const) { return false; }).is_ok());
+
+    // failing task cancels.
+    Count n = 0;
+    auto r = p1.run(1000, [&n](Index const c) {
+        __atomic_fetch_add(&n, 1, __ATOMIC_RELAXED);
+        return c != 3;
+    });
+    REQUIRE(r.unwrap_err() == nel::par::ParError::Cancelled);
+    REQUIRE(n < 1000);
+
+    // and the pool is fine for the next run.
+    REQUIRE(p1.run(10, [](Index const) { return true; }).is_ok());
+}
+
+TEST_CASE("par::par_for_each", "[par][pool]")
+{
+    auto p1 = nel::par::Pool::try_new(4).unwrap();
+    auto v1 = iota(n_values);
+
+    REQUIRE(nel::par_for_each(p1, v1.slice(), [](int &v) { v *= 2; }).is_ok());
+    auto s1 = v1.slice();
+    Count bad = 0;
+    for (Index i = 0; i < n_values; ++i) {
+        bad += (s1[i] != int(2 * i)) ? 1 : 0;
+    }
+    REQUIRE(bad == 0);
+
+    // empty is ok.
+    REQUIRE(nel::par_for_each(p1, Slice<int>::empty(), [](int &) {}).is_ok());
+
+    // failure is reported.
+    auto r = nel::par_for_each(p1, v1.slice(), [](int &v) { return v != 1000; });
+    REQUIRE(r.unwrap_err() == nel::par::ParError::Cancelled);
+}
+
+TEST_CASE("par::par_for_each, single thread", "[par][pool]")
+{
+    auto p1 = nel::par::Pool::try_new(1).unwrap();
+    auto v1 = iota(n_values);
+    REQUIRE(nel::par_for_each(p1, v1.slice(), [](int &v) { v += 1; }).is_ok());
+    REQUIRE(v1.slice()[n_values - 1] == int(n_values));
+}
+
+TEST_CASE("par::par_map_into", "[par][pool]")
+{
+    auto p1 = nel::par::Pool::try_new(4).unwrap();
+    auto v1 = iota(n_values);
+    auto v2 = heaped::Vector<long unsigned int>::with_capacity(n_values);
+    for (Index i = 0; i < n_values; ++i) {
+        v2.push(0).unwrap();
+    }
+
+    Slice<int const> src = v1.slice();
+    REQUIRE(nel::par_map_into(p1, src, v2.slice(), [](int const &v) {
+                return (long unsigned int)v * 3;
+            }).is_ok());
+    auto s2 = v2.slice();
+    Count bad = 0;
+    for (Index i = 0; i < n_values; ++i) {
+        bad += (s2[i] != 3 * i) ? 1 : 0;
+    }
+    REQUIRE(bad == 0);
+
+    auto r = nel::par_map_into(p1, src, v2.slice(0, 10), [](int const &v) {
+        return (long unsigned int)v;
+    });
+    REQUIRE(r.unwrap_err() == nel::par::ParError::LengthMismatch);
+}
+
+TEST_CASE("par::par_reduce", "[par][pool]")
+{
+    auto p1 = nel::par::Pool::try_new(4).unwrap();
+    auto v1 = iota(n_values);
+
+    auto fold = [](long unsigned int &acc, int const &v) { acc += (long unsigned int)v; };
+    auto combine = [](long unsigned int &acc, long unsigned int &&p) { acc += p; };
+    auto r = nel::par_reduce(p1, v1.slice(), 0UL, fold, combine);
+    REQUIRE(r.unwrap() == n_values * (n_values - 1) / 2);
+
+    // identity if empty.
+    REQUIRE(nel::par_reduce(p1, Slice<int>::empty(), 7UL, fold, combine).unwrap() == 7);
+
+    // partials are combined in order, so non-commutative combines work.
+    auto first = nel::par_reduce(
+        p1, v1.slice(), -1,
+        [](int &acc, int const &v) {
+            if (acc < 0) { acc = v; }
+        },
+        [](int &acc, int &&p) {
+            if (acc < 0) { acc = p; }
+        });
+    REQUIRE(first.unwrap() == 0);
+}
+
+} // namespace pool
+} // namespace par
+} // namespace test
+} // namespace nel
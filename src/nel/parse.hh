@@ -0,0 +1,107 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#if !defined(NEL_PARSE_HH)
+#    define NEL_PARSE_HH
+
+#    include <nel/defs.hh> // Length
+
+namespace nel
+{
+
+enum class ParseError;
+
+} // namespace nel
+
+#    include <nel/slice.hh>
+#    include <nel/result.hh>
+#    include <nel/pair.hh>
+#    include <nel/log.hh>
+#    include <nel/panic.hh>
+#    include <nel/defs.hh>
+
+namespace nel
+{
+
+/**
+ * Parsing numbers from text, without allocating, copying, locales or errno.
+ *
+ * Each parses the longest number at the start of a slice of bytes,
+ * returning it and how many bytes it took, so the caller can check what follows
+ * (a delimiter, the end of the field, ...).
+ *
+ * usage:
+ * ```c++
+ *    auto r = nel::parse_u64(field);
+ *    if (r.is_err()) { ... r.unwrap_err() ... }
+ *    auto v = r.unwrap();
+ *    if (v.second != field.len()) { ... trailing junk ... }
+ *    use(v.first);
+ * ```
+ */
+
+/**
+ * Reasons a number could not be parsed.
+ */
+enum class ParseError {
+    // Nothing to parse.
+    Empty = 1,
+    // Does not start with a number, e.g. "x1", "-", "+.e1".
+    InvalidDigit,
+    // An integer too big (or small) for the type.
+    Overflow,
+};
+
+inline Log &operator<<(Log &outs, ParseError const &val)
+{
+    switch (val) {
+        case ParseError::Empty:
+            return outs << "Empty";
+        case ParseError::InvalidDigit:
+            return outs << "InvalidDigit";
+        case ParseError::Overflow:
+            return outs << "Overflow";
+        default:
+            break;
+    }
+    nel::panic("unknown ParseError");
+    return outs << '?';
+}
+
+/**
+ * Parse an unsigned decimal integer, digits only.
+ *
+ * Digits are converted 8 at a time where there are 8 (SWAR).
+ *
+ * @returns Ok with the value and the number of bytes used.
+ * @returns Err(ParseError::Overflow) if the value does not fit in 64 bits.
+ */
+Result<Pair<long long unsigned int, Length>, ParseError>
+parse_u64(Slice<unsigned char const> const &s);
+
+/**
+ * Parse a signed decimal integer, digits with an optional leading '+' or '-'.
+ *
+ * @returns Ok with the value and the number of bytes used.
+ * @returns Err(ParseError::Overflow) if the value does not fit in 64 bits.
+ */
+Result<Pair<long long int, Length>, ParseError> parse_i64(Slice<unsigned char const> const &s);
+
+/**
+ * Parse a decimal floating point number, correctly rounded to nearest (even).
+ *
+ * Accepts [+-] digits [. digits] [(e|E) [+-] digits], where either the integer or fraction
+ * digits may be missing (but not both), and "inf", "infinity" and "nan" in any case.
+ * An exponent without digits is not used, e.g. "1e" gives 1 from 1 byte.
+ * Values too big for a double are +-infinity, too small +-0, as for strtod.
+ *
+ * Most numbers (up to 19 significant digits) are converted with the Eisel-Lemire algorithm,
+ * or exactly with a double multiply when both the digits and the power of 10 are small.
+ * Numbers with more digits are converted from their first 19, falling back to strtod when
+ * the rest could change the rounding.
+ *
+ * @returns Ok with the value and the number of bytes used.
+ */
+Result<Pair<double, Length>, ParseError> parse_f64(Slice<unsigned char const> const &s);
+
+} // namespace nel
+
+#endif // !defined(NEL_PARSE_HH)
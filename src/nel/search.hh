@@ -0,0 +1,149 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#if !defined(NEL_SEARCH_HH)
+#    define NEL_SEARCH_HH
+
+#    include <nel/defs.hh> // Length, Index
+
+#    include <stdint.h> // uintptr_t
+
+namespace nel
+{
+namespace search
+{
+
+// Searches of the sorted items in [p, p+n), used by Slice::binary_search and friends.
+//
+// All take a comparator, less(a, b) returning true if a comes before b,
+// the one the items were sorted with (see nel/sort.hh).
+//
+// The searches are branchless: each step picks the half to keep with a
+// conditional move rather than a branch, so there are no mispredicts,
+// at the cost of always taking log2(n) steps (no early exit on a match).
+
+// Steps bigger than this (a few cache lines) likely miss the cache,
+// so are worth prefetching for.
+static constexpr Length prefetch_bytes = 256;
+
+/**
+ * Index of the first item for which pred is false,
+ * given pred is true for all items before it and false for all after.
+ *
+ * @returns n if pred is true for all.
+ */
+template<typename T, typename F>
+Index partition_point(T const p[], Length n, F &pred)
+{
+    if (n == 0) { return 0; }
+    T const *b = p;
+    while (n > 1) {
+        Length const h = n / 2;
+        // While far apart, fetch both possible next midpoints while this one is compared.
+        // Addresses computed as ints, a prefetch past the end is harmless.
+        if (h * sizeof(T) > prefetch_bytes) {
+            __builtin_prefetch(
+                reinterpret_cast<void const *>(uintptr_t(b) + (h / 2) * sizeof(T)));
+            __builtin_prefetch(
+                reinterpret_cast<void const *>(uintptr_t(b) + (h + h / 2) * sizeof(T)));
+        }
+        b = pred(b[h]) ? b + h : b;
+        n -= h;
+    }
+    return Index(b - p) + (pred(*b) ? 1 : 0);
+}
+
+/**
+ * Index of the first item not less than key, where key would be inserted to keep order.
+ *
+ * @returns n if all are less.
+ */
+template<typename T, typename F>
+Index lower_bound(T const p[], Length const n, T const &key, F &less)
+{
+    auto pred = [&key, &less](T const &v) -> bool { return less(v, key); };
+    return partition_point(p, n, pred);
+}
+
+/**
+ * Index of the first item greater than key, where key would be inserted after any equal
+ * items.
+ *
+ * @returns n if none are greater.
+ */
+template<typename T, typename F>
+Index upper_bound(T const p[], Length const n, T const &key, F &less)
+{
+    auto pred = [&key, &less](T const &v) -> bool { return !less(key, v); };
+    return partition_point(p, n, pred);
+}
+
+/**
+ * Eytzinger layout, for read-mostly lookup tables.
+ *
+ * The items of a sorted table stored as an implicit binary search tree,
+ * breadth first: the root, then its 2 children, then their 4, ...
+ * (with 1-based positions, node i has children 2i and 2i+1).
+ * A search walks down from the root, so the top levels, visited by every search,
+ * share cache lines, and the next few levels can be prefetched ahead.
+ * For large tables this is faster than a binary search of the sorted items,
+ * which touches a new cache line at each of its last log2(n / line) steps.
+ *
+ * usage:
+ * ```c++
+ *    // once, from the sorted table.
+ *    nel::search::eytzinger_from(layout, sorted, n);
+ *    // then
+ *    Index i = nel::search::eytzinger_lower_bound(layout, n, key, less);
+ *    if (i < n && !less(key, layout[i])) { // layout[i] is key
+ * ```
+ */
+
+// In-order walk of the tree at node i (1-based) filling it from src[k..].
+template<typename T>
+Index eytzinger_fill(T dst[], T const src[], Length const n, Index const i, Index k)
+{
+    if (i <= n) {
+        k = eytzinger_fill(dst, src, n, 2 * i, k);
+        dst[i - 1] = src[k];
+        k += 1;
+        k = eytzinger_fill(dst, src, n, 2 * i + 1, k);
+    }
+    return k;
+}
+
+/**
+ * Copy the n sorted items of src into dst in Eytzinger layout.
+ */
+template<typename T>
+void eytzinger_from(T dst[], T const src[], Length const n)
+{
+    eytzinger_fill(dst, src, n, 1, 0);
+}
+
+/**
+ * Position, in the Eytzinger layout e, of the first item not less than key.
+ *
+ * @returns n if all are less.
+ */
+template<typename T, typename F>
+Index eytzinger_lower_bound(T const e[], Length const n, T const &key, F &less)
+{
+    // Nodes 4 levels down from i are 16i..16i+15, contiguous,
+    // so for small items a single prefetch covers them.
+    // Addresses computed as ints, a prefetch past the end is harmless.
+    constexpr Length ahead = 16;
+    Index i = 1;
+    while (i <= n) {
+        __builtin_prefetch(
+            reinterpret_cast<void const *>(uintptr_t(e) + (ahead * i - 1) * sizeof(T)));
+        i = 2 * i + (less(e[i - 1], key) ? 1 : 0);
+    }
+    // The trailing 1s of i are the steps right (less) after the last step left,
+    // which was at the answer.
+    i >>= __builtin_ffsll((long long)(~i));
+    return (i == 0) ? n : i - 1;
+}
+
+} // namespace search
+} // namespace nel
+
+#endif // !defined(NEL_SEARCH_HH)
@@ -0,0 +1,865 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#include <nel/simd.hh>
+
+namespace nel
+{
+namespace simd
+{
+
+namespace
+{
+
+// Plain loops, the reference results and the fallback for targets without SSE2.
+
+template<typename T>
+typename Reduce<T>::Acc sum_scalar(T const p[], Length const n)
+{
+    typedef typename Reduce<T>::Acc Acc;
+    Acc s = 0;
+    for (Index i = 0; i < n; ++i) {
+        s += Acc(p[i]);
+    }
+    return s;
+}
+
+template<bool const DO_MIN, bool const DO_MAX, typename T>
+void min_max_scalar(T const p[], Length const n, T &mn, T &mx)
+{
+    T lo = p[0];
+    T hi = p[0];
+    for (Index i = 1; i < n; ++i) {
+        if (DO_MIN) { lo = (p[i] < lo) ? p[i] : lo; }
+        if (DO_MAX) { hi = (p[i] > hi) ? p[i] : hi; }
+    }
+    mn = lo;
+    mx = hi;
+}
+
+template<typename T>
+typename Reduce<T>::Acc dot_scalar(T const a[], T const b[], Length const n)
+{
+    typedef typename Reduce<T>::Acc Acc;
+    Acc s = 0;
+    for (Index i = 0; i < n; ++i) {
+        s += Acc(a[i]) * Acc(b[i]);
+    }
+    return s;
+}
+
+template<typename B>
+Index find_scalar(B const p[], Length const n, B const v)
+{
+    for (Index i = 0; i < n; ++i) {
+        if (p[i] == v) { return i; }
+    }
+    return n;
+}
+
+template<typename B>
+Index rfind_scalar(B const p[], Length const n, B const v)
+{
+    for (Index i = n; i > 0; --i) {
+        if (p[i - 1] == v) { return i - 1; }
+    }
+    return n;
+}
+
+template<typename B>
+Count count_scalar(B const p[], Length const n, B const v)
+{
+    Count c = 0;
+    for (Index i = 0; i < n; ++i) {
+        c += (p[i] == v) ? 1 : 0;
+    }
+    return c;
+}
+
+bool equal_bytes(unsigned char const a[], unsigned char const b[], Length const n)
+{
+    for (Index i = 0; i < n; ++i) {
+        if (a[i] != b[i]) { return false; }
+    }
+    return true;
+}
+
+// Two-Way (Crochemore and Perrin), the scalar substring search.
+//
+// The needle is split at a critical factorization nd = u v, found from its maximal suffixes.
+// Each step matches v left to right, then u right to left: a mismatch in v shifts past it,
+// a full match (or mismatch in u) shifts by the needle's period,
+// remembering, for periodic needles, the prefix already known to match.
+// So no haystack byte is compared more than twice.
+// Before each step the window's last byte is looked up in a table of how far it is from
+// the end of the needle (Horspool's skip), so windows ending in a byte that's not near the
+// end of the needle are passed over without comparing, which is most of them for text.
+
+// Start of the maximal suffix of x[0..m), in byte order (or the reverse if rev),
+// and its period.
+Index max_suffix(unsigned char const x[], Length const m, bool const rev, Length &period)
+{
+    Index a = 0; // start of the maximal suffix so far.
+    Index j = 0; // start of the suffix being compared against it.
+    Length k = 1;
+    Length p = 1;
+    while (j + k < m) {
+        unsigned char const u = x[a + k - 1];
+        unsigned char const v = x[j + k];
+        if (u == v) {
+            if (k == p) {
+                j += p;
+                k = 1;
+            } else {
+                k += 1;
+            }
+        } else if ((u > v) != rev) {
+            j += k;
+            k = 1;
+            p = j + 1 - a;
+        } else {
+            j += 1;
+            a = j;
+            k = 1;
+            p = 1;
+        }
+    }
+    period = p;
+    return a;
+}
+
+Index two_way(unsigned char const h[], Length const n, unsigned char const nd[], Length const m)
+{
+    if (m > n) { return n; }
+    Length p0 = 0;
+    Length p1 = 0;
+    Index const a0 = max_suffix(nd, m, false, p0);
+    Index const a1 = max_suffix(nd, m, true, p1);
+    // nd[0..c) is u, nd[c..m) is v.
+    Index const c = (a1 > a0) ? a1 : a0;
+    Length p = (a1 > a0) ? p1 : p0;
+
+    // mem0: how much of the needle is known to match after a shift by the period.
+    Length mem0 = 0;
+    if (equal_bytes(nd, nd + p, c)) {
+        mem0 = m - p;
+    } else {
+        // not periodic, any shift bigger than both halves is safe.
+        Length const l = (c > 0) ? c - 1 : 0;
+        p = ((l > m - c) ? l : m - c) + 1;
+    }
+
+    // distance of each byte's last occurrence from the end of the needle, m if none,
+    // capped to fit (a shorter skip is still safe).
+    unsigned char skip[256];
+    for (Index j = 0; j < 256; ++j) {
+        skip[j] = (unsigned char)((m < 255) ? m : 255);
+    }
+    for (Index j = 0; j < m; ++j) {
+        skip[nd[j]] = (unsigned char)((m - 1 - j < 255) ? m - 1 - j : 255);
+    }
+
+    Length mem = 0;
+    Index i = 0;
+    while (i + m <= n) {
+        Length const d = skip[h[i + m - 1]];
+        if (d != 0) {
+            i += d;
+            mem = 0;
+            continue;
+        }
+        Index k = (c > mem) ? c : mem;
+        while (k < m && nd[k] == h[i + k]) {
+            k += 1;
+        }
+        if (k < m) {
+            i += k - c + 1;
+            mem = 0;
+            continue;
+        }
+        k = c;
+        while (k > mem && nd[k - 1] == h[i + k - 1]) {
+            k -= 1;
+        }
+        if (k <= mem) { return i; }
+        i += p;
+        mem = mem0;
+    }
+    return n;
+}
+
+// The kernels need SSE2 as their baseline: always there on x86_64,
+// but only with -msse2 on 32 bit x86, where the SSE2 builtins are otherwise undeclared.
+#if defined(__SSE2__)
+
+// Kernels over B byte vectors, using gcc/clang vector extensions.
+// Always inlined into the per-level wrappers below, so the same source
+// becomes SSE2 code (B=16) or AVX2 code (B=32, in a target("avx2") function).
+// Loads go through memcpy as the values need not be vector aligned.
+#    define NEL_SIMD_KERNEL __attribute__((always_inline)) inline
+
+template<Length const B, typename T>
+NEL_SIMD_KERNEL typename Reduce<T>::Acc sum_k(T const p[], Length const n)
+{
+    typedef typename Reduce<T>::Acc Acc;
+    constexpr Length L = B / sizeof(T);
+    typedef T VT __attribute__((vector_size(B)));
+    typedef Acc VA __attribute__((vector_size(B)));
+
+    if constexpr (sizeof(T) < sizeof(Acc)) {
+        // __builtin_convertvector's sign extension is poor without sse4.1 (pmovsx),
+        // gcc's own widening of a plain loop, vectorised here for this function's target, is
+        // as fast or better.
+        Acc s = 0;
+        for (Index i = 0; i < n; ++i) {
+            s += Acc(p[i]);
+        }
+        return s;
+    } else {
+        // 2 accumulators to hide the add latency.
+        VA acc0 = {};
+        VA acc1 = {};
+        Index i = 0;
+        for (; i + 2 * L <= n; i += 2 * L) {
+            VT a0;
+            VT a1;
+            __builtin_memcpy(&a0, p + i, B);
+            __builtin_memcpy(&a1, p + i + L, B);
+            acc0 += __builtin_convertvector(a0, VA);
+            acc1 += __builtin_convertvector(a1, VA);
+        }
+        if (i + L <= n) {
+            VT a0;
+            __builtin_memcpy(&a0, p + i, B);
+            acc0 += __builtin_convertvector(a0, VA);
+            i += L;
+        }
+        acc0 += acc1;
+        Acc s = 0;
+        for (Index j = 0; j < L; ++j) {
+            s += acc0[j];
+        }
+        for (; i < n; ++i) {
+            s += Acc(p[i]);
+        }
+        return s;
+    }
+}
+
+template<Length const B, bool const DO_MIN, bool const DO_MAX, typename T>
+NEL_SIMD_KERNEL void min_max_k(T const p[], Length const n, T &mn, T &mx)
+{
+    constexpr Length L = B / sizeof(T);
+    typedef T VT __attribute__((vector_size(B)));
+
+    T lo = p[0];
+    T hi = p[0];
+    Index i = 0;
+    if (n >= L) {
+        VT vlo;
+        __builtin_memcpy(&vlo, p, B);
+        VT vhi = vlo;
+        for (i = L; i + L <= n; i += L) {
+            VT a;
+            __builtin_memcpy(&a, p + i, B);
+            if (DO_MIN) { vlo = (a < vlo) ? a : vlo; }
+            if (DO_MAX) { vhi = (a > vhi) ? a : vhi; }
+        }
+        for (Index j = 0; j < L; ++j) {
+            if (DO_MIN) { lo = (vlo[j] < lo) ? vlo[j] : lo; }
+            if (DO_MAX) { hi = (vhi[j] > hi) ? vhi[j] : hi; }
+        }
+    }
+    for (; i < n; ++i) {
+        if (DO_MIN) { lo = (p[i] < lo) ? p[i] : lo; }
+        if (DO_MAX) { hi = (p[i] > hi) ? p[i] : hi; }
+    }
+    mn = lo;
+    mx = hi;
+}
+
+template<Length const B, typename T>
+NEL_SIMD_KERNEL typename Reduce<T>::Acc dot_k(T const a[], T const b[], Length const n)
+{
+    typedef typename Reduce<T>::Acc Acc;
+    constexpr Length L = B / sizeof(T);
+    typedef T VT __attribute__((vector_size(B)));
+    typedef Acc VA __attribute__((vector_size(B)));
+
+    if constexpr (sizeof(T) < sizeof(Acc)) {
+        // As sum_k, and more so: there's no widening multiply in the vector extensions,
+        // a 64x64 multiply of the widened values is emulated and slow,
+        // but gcc spots the pattern in a plain loop (pmuldq/pmuludq).
+        Acc s = 0;
+        for (Index i = 0; i < n; ++i) {
+            s += Acc(a[i]) * Acc(b[i]);
+        }
+        return s;
+    } else {
+        VA acc0 = {};
+        VA acc1 = {};
+        Index i = 0;
+        for (; i + 2 * L <= n; i += 2 * L) {
+            VT a0;
+            VT a1;
+            VT b0;
+            VT b1;
+            __builtin_memcpy(&a0, a + i, B);
+            __builtin_memcpy(&b0, b + i, B);
+            __builtin_memcpy(&a1, a + i + L, B);
+            __builtin_memcpy(&b1, b + i + L, B);
+            acc0 += __builtin_convertvector(a0, VA) * __builtin_convertvector(b0, VA);
+            acc1 += __builtin_convertvector(a1, VA) * __builtin_convertvector(b1, VA);
+        }
+        if (i + L <= n) {
+            VT a0;
+            VT b0;
+            __builtin_memcpy(&a0, a + i, B);
+            __builtin_memcpy(&b0, b + i, B);
+            acc0 += __builtin_convertvector(a0, VA) * __builtin_convertvector(b0, VA);
+            i += L;
+        }
+        acc0 += acc1;
+        Acc s = 0;
+        for (Index j = 0; j < L; ++j) {
+            s += acc0[j];
+        }
+        for (; i < n; ++i) {
+            s += Acc(a[i]) * Acc(b[i]);
+        }
+        return s;
+    }
+}
+
+// The search kernels reduce a vector compare to a bit per byte, as memchr does,
+// so a set bit is a match and its position the lane, from ctz (first) or clz (last).
+// pmovmskb on 16 bytes is SSE2, which every x86_64 has, so is usable in any kernel,
+// and a 32 byte compare is done as its 2 halves.
+
+template<Length const B, typename V>
+NEL_SIMD_KERNEL long long unsigned int byte_mask(V const &m)
+{
+    typedef char V16 __attribute__((vector_size(16)));
+    long long unsigned int r = 0;
+    for (Index j = 0; j < B / 16; ++j) {
+        V16 h;
+        __builtin_memcpy(&h, reinterpret_cast<char const *>(&m) + 16 * j, 16);
+        r |= (long long unsigned int)(unsigned int)__builtin_ia32_pmovmskb128(h) << (16 * j);
+    }
+    return r;
+}
+
+template<Length const B, typename U>
+NEL_SIMD_KERNEL Index find_k(U const p[], Length const n, U const v)
+{
+    constexpr Length L = B / sizeof(U);
+    typedef U VU __attribute__((vector_size(B)));
+    VU const vv = VU{} + v;
+
+    Index i = 0;
+    // Short searches (the next delimiter) mostly end in the first 32 bytes,
+    // so with 32 byte vectors try the first alone (2 smaller ones are the step below).
+    if (B >= 32 && n >= L) {
+        VU a0;
+        __builtin_memcpy(&a0, p, B);
+        long long unsigned int const m = byte_mask<B>((VU)(a0 == vv));
+        if (m != 0) { return Index(__builtin_ctzll(m)) / sizeof(U); }
+        i = L;
+    }
+    // Then 2 vectors a step, tested together.
+    for (; i + 2 * L <= n; i += 2 * L) {
+        VU a0;
+        VU a1;
+        __builtin_memcpy(&a0, p + i, B);
+        __builtin_memcpy(&a1, p + i + L, B);
+        VU const m0 = (VU)(a0 == vv);
+        VU const m1 = (VU)(a1 == vv);
+        if (byte_mask<B>(m0 | m1) != 0) {
+            long long unsigned int const m = byte_mask<B>(m0) | (byte_mask<B>(m1) << B);
+            return i + Index(__builtin_ctzll(m)) / sizeof(U);
+        }
+    }
+    if (i + L <= n) {
+        VU a0;
+        __builtin_memcpy(&a0, p + i, B);
+        long long unsigned int const m = byte_mask<B>((VU)(a0 == vv));
+        if (m != 0) { return i + Index(__builtin_ctzll(m)) / sizeof(U); }
+        i += L;
+    }
+    // The last few as a vector ending at n, overlapping ones already searched (so not equal).
+    if (i < n && n >= L) {
+        VU a0;
+        __builtin_memcpy(&a0, p + n - L, B);
+        long long unsigned int const m = byte_mask<B>((VU)(a0 == vv));
+        if (m != 0) { return n - L + Index(__builtin_ctzll(m)) / sizeof(U); }
+        return n;
+    }
+    for (; i < n; ++i) {
+        if (p[i] == v) { return i; }
+    }
+    return n;
+}
+
+template<Length const B, typename U>
+NEL_SIMD_KERNEL Index rfind_k(U const p[], Length const n, U const v)
+{
+    constexpr Length L = B / sizeof(U);
+    typedef U VU __attribute__((vector_size(B)));
+    VU const vv = VU{} + v;
+
+    // i is the end of what's left to search.
+    Index i = n;
+    for (; i >= 2 * L; i -= 2 * L) {
+        VU a0;
+        VU a1;
+        __builtin_memcpy(&a0, p + i - 2 * L, B);
+        __builtin_memcpy(&a1, p + i - L, B);
+        VU const m0 = (VU)(a0 == vv);
+        VU const m1 = (VU)(a1 == vv);
+        if (byte_mask<B>(m0 | m1) != 0) {
+            long long unsigned int const m = byte_mask<B>(m0) | (byte_mask<B>(m1) << B);
+            return i - 2 * L + Index(63 - __builtin_clzll(m)) / sizeof(U);
+        }
+    }
+    if (i >= L) {
+        VU a0;
+        __builtin_memcpy(&a0, p + i - L, B);
+        long long unsigned int const m = byte_mask<B>((VU)(a0 == vv));
+        if (m != 0) { return i - L + Index(63 - __builtin_clzll(m)) / sizeof(U); }
+        i -= L;
+    }
+    // The first few as a vector starting at 0, overlapping ones already searched.
+    if (i > 0 && n >= L) {
+        VU a0;
+        __builtin_memcpy(&a0, p, B);
+        long long unsigned int const m = byte_mask<B>((VU)(a0 == vv));
+        if (m != 0) { return Index(63 - __builtin_clzll(m)) / sizeof(U); }
+        return n;
+    }
+    for (; i > 0; --i) {
+        if (p[i - 1] == v) { return i - 1; }
+    }
+    return n;
+}
+
+template<Length const B, typename U>
+NEL_SIMD_KERNEL Count count_k(U const p[], Length const n, U const v)
+{
+    constexpr Length L = B / sizeof(U);
+    typedef U VU __attribute__((vector_size(B)));
+    VU const vv = VU{} + v;
+    // Matches are counted per lane, in U, so flushed before a lane can overflow.
+    constexpr Length max_steps = (sizeof(U) >= sizeof(Length)) ? ~Length(0) : Length(U(~U(0)));
+
+    Count c = 0;
+    Index i = 0;
+    while (i + L <= n) {
+        Length const left = (n - i) / L;
+        Length const steps = (left < max_steps) ? left : max_steps;
+        VU acc = {};
+        for (Index k = 0; k < steps; ++k) {
+            VU a;
+            __builtin_memcpy(&a, p + i, B);
+            // a true lane is all ones, i.e. -1.
+            acc -= (VU)(a == vv);
+            i += L;
+        }
+        for (Index j = 0; j < L; ++j) {
+            c += acc[j];
+        }
+    }
+    for (; i < n; ++i) {
+        c += (p[i] == v) ? 1 : 0;
+    }
+    return c;
+}
+
+// Substring search (m >= 2): B possible starts at a time, those where both the first and
+// the last byte match are checked in full, rarely more than one a vector for real text.
+// But each check may compare m bytes, so for many partial matches (e.g. aaa..ab in aaaa..)
+// this gives up once it's spent more on checks than on scanning, returning false
+// with where it got to in r, for Two-Way to carry on from, so the total stays linear.
+// Else returns true with the answer (n if none) in r.
+template<Length const B>
+NEL_SIMD_KERNEL bool find_sub_k(unsigned char const h[], Length const n, unsigned char const nd[],
+                                Length const m, Index &r)
+{
+    typedef unsigned char VU __attribute__((vector_size(B)));
+    VU const vf = VU{} + nd[0];
+    VU const vl = VU{} + nd[m - 1];
+
+    Length spent = 0;
+    Index i = 0;
+    for (; i + m - 1 + B <= n; i += B) {
+        VU f;
+        VU l;
+        __builtin_memcpy(&f, h + i, B);
+        __builtin_memcpy(&l, h + i + m - 1, B);
+        long long unsigned int c = byte_mask<B>((VU)((f == vf) & (l == vl)));
+        while (c != 0) {
+            Index const k = i + Index(__builtin_ctzll(c));
+            if (equal_bytes(h + k + 1, nd + 1, m - 2)) {
+                r = k;
+                return true;
+            }
+            spent += m;
+            c &= c - 1;
+        }
+        if (spent > 2 * i + 8 * m) {
+            r = i + B;
+            return false;
+        }
+    }
+    for (; i + m <= n; ++i) {
+        if (h[i] == nd[0] && h[i + m - 1] == nd[m - 1]) {
+            if (equal_bytes(h + i + 1, nd + 1, m - 2)) {
+                r = i;
+                return true;
+            }
+            spent += m;
+            if (spent > 2 * i + 8 * m) {
+                r = i + 1;
+                return false;
+            }
+        }
+    }
+    r = n;
+    return true;
+}
+
+// SSE2 is part of the x86_64 baseline, so needs no target attribute.
+template<typename T>
+typename Reduce<T>::Acc sum_sse2(T const p[], Length const n)
+{
+    return sum_k<16>(p, n);
+}
+
+template<bool const DO_MIN, bool const DO_MAX, typename T>
+void min_max_sse2(T const p[], Length const n, T &mn, T &mx)
+{
+    min_max_k<16, DO_MIN, DO_MAX>(p, n, mn, mx);
+}
+
+template<typename T>
+typename Reduce<T>::Acc dot_sse2(T const a[], T const b[], Length const n)
+{
+    return dot_k<16>(a, b, n);
+}
+
+template<typename T>
+__attribute__((target("avx2"))) typename Reduce<T>::Acc sum_avx2(T const p[], Length const n)
+{
+    return sum_k<32>(p, n);
+}
+
+template<bool const DO_MIN, bool const DO_MAX, typename T>
+__attribute__((target("avx2"))) void min_max_avx2(T const p[], Length const n, T &mn, T &mx)
+{
+    min_max_k<32, DO_MIN, DO_MAX>(p, n, mn, mx);
+}
+
+template<typename T>
+__attribute__((target("avx2"))) typename Reduce<T>::Acc dot_avx2(T const a[], T const b[],
+                                                                  Length const n)
+{
+    return dot_k<32>(a, b, n);
+}
+
+template<typename U>
+Index find_sse2(U const p[], Length const n, U const v)
+{
+    return find_k<16>(p, n, v);
+}
+
+template<typename U>
+Index rfind_sse2(U const p[], Length const n, U const v)
+{
+    return rfind_k<16>(p, n, v);
+}
+
+template<typename U>
+Count count_sse2(U const p[], Length const n, U const v)
+{
+    return count_k<16>(p, n, v);
+}
+
+template<typename U>
+__attribute__((target("avx2"))) Index find_avx2(U const p[], Length const n, U const v)
+{
+    return find_k<32>(p, n, v);
+}
+
+template<typename U>
+__attribute__((target("avx2"))) Index rfind_avx2(U const p[], Length const n, U const v)
+{
+    return rfind_k<32>(p, n, v);
+}
+
+template<typename U>
+__attribute__((target("avx2"))) Count count_avx2(U const p[], Length const n, U const v)
+{
+    return count_k<32>(p, n, v);
+}
+
+bool find_sub_sse2(unsigned char const h[], Length const n, unsigned char const nd[],
+                   Length const m, Index &r)
+{
+    return find_sub_k<16>(h, n, nd, m, r);
+}
+
+__attribute__((target("avx2"))) bool find_sub_avx2(unsigned char const h[], Length const n,
+                                                   unsigned char const nd[], Length const m,
+                                                   Index &r)
+{
+    return find_sub_k<32>(h, n, nd, m, r);
+}
+
+#    undef NEL_SIMD_KERNEL
+
+#endif // defined(__SSE2__)
+
+Level detect(void)
+{
+#if defined(__SSE2__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) { return Level::AVX2; }
+    return Level::SSE2;
+#else
+    return Level::SCALAR;
+#endif
+}
+
+// Resolved on first use rather than by a static ctor, so reductions
+// can be used from other static ctors.
+// Racing first uses all store the same value.
+int max_level_ = -1;
+int level_ = -1;
+
+template<bool const DO_MIN, bool const DO_MAX, typename T>
+void min_max_dispatch(T const p[], Length const n, T &mn, T &mx)
+{
+    switch (level()) {
+#if defined(__SSE2__)
+        case Level::AVX2:
+            min_max_avx2<DO_MIN, DO_MAX>(p, n, mn, mx);
+            break;
+        case Level::SSE2:
+            min_max_sse2<DO_MIN, DO_MAX>(p, n, mn, mx);
+            break;
+#else
+        case Level::AVX2:
+        case Level::SSE2:
+#endif
+        case Level::SCALAR:
+        default:
+            min_max_scalar<DO_MIN, DO_MAX>(p, n, mn, mx);
+            break;
+    }
+}
+
+} // namespace
+
+Level max_level(void)
+{
+    int l = __atomic_load_n(&max_level_, __ATOMIC_RELAXED);
+    if (l < 0) {
+        l = int(detect());
+        __atomic_store_n(&max_level_, l, __ATOMIC_RELAXED);
+    }
+    return Level(l);
+}
+
+Level level(void)
+{
+    int l = __atomic_load_n(&level_, __ATOMIC_RELAXED);
+    if (l < 0) {
+        l = int(max_level());
+        __atomic_store_n(&level_, l, __ATOMIC_RELAXED);
+    }
+    return Level(l);
+}
+
+Level set_level(Level const l)
+{
+    Level const m = max_level();
+    Level const r = (int(l) < int(m)) ? l : m;
+    __atomic_store_n(&level_, int(r), __ATOMIC_RELAXED);
+    return r;
+}
+
+template<typename T>
+typename Reduce<T>::Acc sum(T const p[], Length const n)
+{
+    switch (level()) {
+#if defined(__SSE2__)
+        case Level::AVX2:
+            return sum_avx2(p, n);
+        case Level::SSE2:
+            return sum_sse2(p, n);
+#else
+        case Level::AVX2:
+        case Level::SSE2:
+#endif
+        case Level::SCALAR:
+        default:
+            return sum_scalar(p, n);
+    }
+}
+
+template<typename T>
+T min(T const p[], Length const n)
+{
+    T mn;
+    T mx;
+    min_max_dispatch<true, false>(p, n, mn, mx);
+    return mn;
+}
+
+template<typename T>
+T max(T const p[], Length const n)
+{
+    T mn;
+    T mx;
+    min_max_dispatch<false, true>(p, n, mn, mx);
+    return mx;
+}
+
+template<typename T>
+void min_max(T const p[], Length const n, T &mn, T &mx)
+{
+    min_max_dispatch<true, true>(p, n, mn, mx);
+}
+
+template<typename T>
+typename Reduce<T>::Acc dot(T const a[], T const b[], Length const n)
+{
+    switch (level()) {
+#if defined(__SSE2__)
+        case Level::AVX2:
+            return dot_avx2(a, b, n);
+        case Level::SSE2:
+            return dot_sse2(a, b, n);
+#else
+        case Level::AVX2:
+        case Level::SSE2:
+#endif
+        case Level::SCALAR:
+        default:
+            return dot_scalar(a, b, n);
+    }
+}
+
+template<typename B>
+Index find_bits(B const p[], Length const n, B const v)
+{
+    switch (level()) {
+#if defined(__SSE2__)
+        case Level::AVX2:
+            return find_avx2(p, n, v);
+        case Level::SSE2:
+            return find_sse2(p, n, v);
+#else
+        case Level::AVX2:
+        case Level::SSE2:
+#endif
+        case Level::SCALAR:
+        default:
+            return find_scalar(p, n, v);
+    }
+}
+
+template<typename B>
+Index rfind_bits(B const p[], Length const n, B const v)
+{
+    switch (level()) {
+#if defined(__SSE2__)
+        case Level::AVX2:
+            return rfind_avx2(p, n, v);
+        case Level::SSE2:
+            return rfind_sse2(p, n, v);
+#else
+        case Level::AVX2:
+        case Level::SSE2:
+#endif
+        case Level::SCALAR:
+        default:
+            return rfind_scalar(p, n, v);
+    }
+}
+
+template<typename B>
+Count count_bits(B const p[], Length const n, B const v)
+{
+    switch (level()) {
+#if defined(__SSE2__)
+        case Level::AVX2:
+            return count_avx2(p, n, v);
+        case Level::SSE2:
+            return count_sse2(p, n, v);
+#else
+        case Level::AVX2:
+        case Level::SSE2:
+#endif
+        case Level::SCALAR:
+        default:
+            return count_scalar(p, n, v);
+    }
+}
+
+#define NEL_SIMD_INSTANTIATE(T)                                                                    \
+    template Reduce<T>::Acc sum<T>(T const[], Length const);                                       \
+    template T min<T>(T const[], Length const);                                                    \
+    template T max<T>(T const[], Length const);                                                    \
+    template void min_max<T>(T const[], Length const, T &, T &);                                   \
+    template Reduce<T>::Acc dot<T>(T const[], T const[], Length const);
+
+NEL_SIMD_INSTANTIATE(int)
+NEL_SIMD_INSTANTIATE(unsigned int)
+NEL_SIMD_INSTANTIATE(long)
+NEL_SIMD_INSTANTIATE(long unsigned int)
+NEL_SIMD_INSTANTIATE(long long)
+NEL_SIMD_INSTANTIATE(long long unsigned int)
+NEL_SIMD_INSTANTIATE(float)
+NEL_SIMD_INSTANTIATE(double)
+
+#undef NEL_SIMD_INSTANTIATE
+
+Index find_sub_bytes(unsigned char const h[], Length const n, unsigned char const nd[],
+                     Length const m)
+{
+    if (m == 1) { return find_bits(h, n, nd[0]); }
+    if (m > n) { return n; }
+    Index r = 0;
+    switch (level()) {
+#if defined(__SSE2__)
+        case Level::AVX2:
+            if (find_sub_avx2(h, n, nd, m, r)) { return r; }
+            break;
+        case Level::SSE2:
+            if (find_sub_sse2(h, n, nd, m, r)) { return r; }
+            break;
+#else
+        case Level::AVX2:
+        case Level::SSE2:
+#endif
+        case Level::SCALAR:
+        default:
+            break;
+    }
+    // the rest, from r on.
+    return r + two_way(h + r, n - r, nd, m);
+}
+
+#define NEL_SIMD_INSTANTIATE_SEARCH(B)                                                             \
+    template Index find_bits<B>(B const[], Length const, B const);                                 \
+    template Index rfind_bits<B>(B const[], Length const, B const);                                \
+    template Count count_bits<B>(B const[], Length const, B const);
+
+NEL_SIMD_INSTANTIATE_SEARCH(unsigned char)
+NEL_SIMD_INSTANTIATE_SEARCH(short unsigned int)
+NEL_SIMD_INSTANTIATE_SEARCH(unsigned int)
+NEL_SIMD_INSTANTIATE_SEARCH(long unsigned int)
+NEL_SIMD_INSTANTIATE_SEARCH(long long unsigned int)
+
+#undef NEL_SIMD_INSTANTIATE_SEARCH
+
+} // namespace simd
+} // namespace nel
@@ -0,0 +1,389 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#if !defined(NEL_SIMD_HH)
+#    define NEL_SIMD_HH
+
+#    include <nel/defs.hh> // Length
+
+namespace nel
+{
+namespace simd
+{
+
+template<typename T>
+struct Reduce;
+
+template<typename T>
+struct Search;
+
+enum class Level;
+
+} // namespace simd
+} // namespace nel
+
+#    include <nel/log.hh>
+#    include <nel/defs.hh>
+
+namespace nel
+{
+namespace simd
+{
+
+/**
+ * Numeric reductions, and searches, over contiguous values,
+ * using vector instructions where available.
+ *
+ * On x86 built with SSE2 (always so for x86_64, -msse2 for 32 bit x86)
+ * the widest supported kernel (AVX2, else SSE2) is picked at runtime,
+ * so a binary built for baseline x86_64 still uses AVX2 on hosts that have it.
+ * Elsewhere (e.g. ARM, or 32 bit x86 without SSE2) a scalar loop is used.
+ *
+ * Sum and dot are computed in several lanes, so for floats the result may differ
+ * from a left-to-right sum in the last bits.
+ */
+
+/**
+ * The accumulator type used to sum values of type T.
+ *
+ * 32bit ints are summed in 64bits, so sums of up to 2^32 values cannot overflow.
+ * 64bit ints wrap as with normal (unsigned) arithmetic.
+ * floats and doubles are summed in their own type.
+ *
+ * Only the types specialised here are reducible.
+ */
+template<>
+struct Reduce<int>
+{
+        typedef long long Acc;
+};
+
+template<>
+struct Reduce<unsigned int>
+{
+        typedef long long unsigned int Acc;
+};
+
+template<>
+struct Reduce<long>
+{
+        typedef long long Acc;
+};
+
+template<>
+struct Reduce<long unsigned int>
+{
+        typedef long long unsigned int Acc;
+};
+
+template<>
+struct Reduce<long long>
+{
+        typedef long long Acc;
+};
+
+template<>
+struct Reduce<long long unsigned int>
+{
+        typedef long long unsigned int Acc;
+};
+
+template<>
+struct Reduce<float>
+{
+        typedef float Acc;
+};
+
+template<>
+struct Reduce<double>
+{
+        typedef double Acc;
+};
+
+template<typename T>
+concept is_reducible = requires { typename Reduce<T>::Acc; };
+
+/**
+ * Sum of p[0..n).
+ *
+ * @returns 0 if n is 0.
+ */
+template<typename T>
+typename Reduce<T>::Acc sum(T const p[], Length const n);
+
+/**
+ * Smallest of p[0..n).
+ *
+ * @warning UB if n is 0.
+ */
+template<typename T>
+T min(T const p[], Length const n);
+
+/**
+ * Largest of p[0..n).
+ *
+ * @warning UB if n is 0.
+ */
+template<typename T>
+T max(T const p[], Length const n);
+
+/**
+ * Smallest and largest of p[0..n), in one pass.
+ *
+ * @warning UB if n is 0.
+ */
+template<typename T>
+void min_max(T const p[], Length const n, T &mn, T &mx);
+
+/**
+ * Sum of a[i] * b[i] for i in [0..n).
+ *
+ * @returns 0 if n is 0.
+ */
+template<typename T>
+typename Reduce<T>::Acc dot(T const a[], T const b[], Length const n);
+
+/**
+ * Number of values in p[0..n) for which pred is true.
+ *
+ * There is no vector form of an arbitrary predicate,
+ * this is a branch free loop the compiler can vectorise if pred allows.
+ */
+template<typename T, typename F>
+Count count_if(T const p[], Length const n, F &&pred)
+{
+    Count c = 0;
+    for (Index i = 0; i < n; ++i) {
+        c += pred(p[i]) ? 1 : 0;
+    }
+    return c;
+}
+
+/**
+ * The unsigned type of the same size as T, for ints searchable by value.
+ *
+ * Searches compare the bits of values, so work for 8, 16, 32 and 64bit ints,
+ * signed or not, which are equal only if their bits are.
+ * Not floats (+0.0 == -0.0, NaN != NaN).
+ *
+ * Only the types specialised here are searchable with vector instructions,
+ * others are searched with a loop using their ==.
+ */
+template<>
+struct Search<char>
+{
+        typedef unsigned char Bits;
+};
+
+template<>
+struct Search<signed char>
+{
+        typedef unsigned char Bits;
+};
+
+template<>
+struct Search<unsigned char>
+{
+        typedef unsigned char Bits;
+};
+
+template<>
+struct Search<short>
+{
+        typedef short unsigned int Bits;
+};
+
+template<>
+struct Search<short unsigned int>
+{
+        typedef short unsigned int Bits;
+};
+
+template<>
+struct Search<int>
+{
+        typedef unsigned int Bits;
+};
+
+template<>
+struct Search<unsigned int>
+{
+        typedef unsigned int Bits;
+};
+
+template<>
+struct Search<long>
+{
+        typedef long unsigned int Bits;
+};
+
+template<>
+struct Search<long unsigned int>
+{
+        typedef long unsigned int Bits;
+};
+
+template<>
+struct Search<long long>
+{
+        typedef long long unsigned int Bits;
+};
+
+template<>
+struct Search<long long unsigned int>
+{
+        typedef long long unsigned int Bits;
+};
+
+template<typename T>
+concept is_searchable = requires { typename Search<T>::Bits; };
+
+// The kernels, over the unsigned types only.
+template<typename B>
+Index find_bits(B const p[], Length const n, B const v);
+
+template<typename B>
+Index rfind_bits(B const p[], Length const n, B const v);
+
+template<typename B>
+Count count_bits(B const p[], Length const n, B const v);
+
+/**
+ * Index of the first of p[0..n) equal to v.
+ *
+ * @returns n if none are.
+ */
+template<typename T>
+Index find(T const p[], Length const n, T const &v)
+{
+    if constexpr (is_searchable<T>) {
+        typedef typename Search<T>::Bits B;
+        return find_bits(reinterpret_cast<B const *>(p), n, B(v));
+    } else {
+        for (Index i = 0; i < n; ++i) {
+            if (p[i] == v) { return i; }
+        }
+        return n;
+    }
+}
+
+/**
+ * Index of the last of p[0..n) equal to v.
+ *
+ * @returns n if none are.
+ */
+template<typename T>
+Index rfind(T const p[], Length const n, T const &v)
+{
+    if constexpr (is_searchable<T>) {
+        typedef typename Search<T>::Bits B;
+        return rfind_bits(reinterpret_cast<B const *>(p), n, B(v));
+    } else {
+        for (Index i = n; i > 0; --i) {
+            if (p[i - 1] == v) { return i - 1; }
+        }
+        return n;
+    }
+}
+
+/**
+ * Number of values in p[0..n) equal to v.
+ */
+template<typename T>
+Count count(T const p[], Length const n, T const &v)
+{
+    if constexpr (is_searchable<T>) {
+        typedef typename Search<T>::Bits B;
+        return count_bits(reinterpret_cast<B const *>(p), n, B(v));
+    } else {
+        return count_if(p, n, [&v](T const &e) -> bool { return e == v; });
+    }
+}
+
+/**
+ * Index of the first occurrence of the bytes nd[0..m) in h[0..n).
+ *
+ * Found by comparing a vector of possible starts against nd's first byte
+ * and the vector m-1 on against its last, and checking only where both match.
+ * If that finds many partial matches (e.g. in periodic text), and at Level::SCALAR,
+ * the Two-Way algorithm is used instead, so the time is linear in n + m whatever the input.
+ *
+ * @param m must be > 0.
+ * @returns n if none.
+ */
+Index find_sub_bytes(unsigned char const h[], Length const n, unsigned char const nd[],
+                     Length const m);
+
+/**
+ * Index of the first occurrence of nd[0..m) in p[0..n), items compared by ==.
+ *
+ * Bytes (8bit ints) use find_sub_bytes, other types a loop.
+ *
+ * @param m must be > 0.
+ * @returns n if none.
+ */
+template<typename T>
+Index find_sub(T const p[], Length const n, T const nd[], Length const m)
+{
+    if constexpr (is_searchable<T> && sizeof(T) == 1) {
+        return find_sub_bytes(reinterpret_cast<unsigned char const *>(p), n,
+                              reinterpret_cast<unsigned char const *>(nd), m);
+    } else {
+        for (Index i = 0; i + m <= n; ++i) {
+            Index k = 0;
+            while (k < m && p[i + k] == nd[k]) {
+                k += 1;
+            }
+            if (k == m) { return i; }
+        }
+        return n;
+    }
+}
+
+/**
+ * The instruction sets the kernels can use, from narrowest to widest.
+ */
+enum class Level {
+    SCALAR,
+    SSE2,
+    AVX2,
+};
+
+/**
+ * The widest level the host supports.
+ */
+Level max_level(void);
+
+/**
+ * The level currently in use, max_level() unless set_level() has been used.
+ */
+Level level(void);
+
+/**
+ * Restrict the kernels to at most level l, e.g. to test or benchmark the narrower ones.
+ *
+ * @returns the level now in use, l clamped to max_level().
+ */
+Level set_level(Level const l);
+
+inline Log &operator<<(Log &outs, Level const l)
+{
+    switch (l) {
+        case Level::SCALAR:
+            outs << "SCALAR";
+            break;
+        case Level::SSE2:
+            outs << "SSE2";
+            break;
+        case Level::AVX2:
+            outs << "AVX2";
+            break;
+        default:
+            outs << "?";
+            break;
+    }
+    return outs;
+}
+
+} // namespace simd
+} // namespace nel
+
+#endif // !defined(NEL_SIMD_HH)
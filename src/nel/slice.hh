@@ -2,6 +2,8 @@
 #if !defined(NEL_SLICE_HH)
 #    define NEL_SLICE_HH
 
+#    include <nel/defs.hh> // Length
+
 namespace nel
 {
 
@@ -11,12 +13,45 @@ struct Slice;
 template<typename T>
 struct SliceIterator;
 
+template<typename T>
+struct ChunksIterator;
+
+template<typename T, Length const N>
+struct ChunksExactIterator;
+
+template<typename T>
+struct WindowsIterator;
+
+template<typename T>
+struct SplitAtSlice;
+
+template<typename T>
+struct SplitAtItem;
+
+template<typename T, typename F>
+struct SplitAtPred;
+
+template<typename T, typename S>
+struct SplitIterator;
+
+template<typename T>
+struct LinesIterator;
+
+template<typename T>
+struct SplitWhitespaceIterator;
+
 } // namespace nel
 
 #    include <nel/iterator.hh>
 #    include <nel/memory.hh>
 // #    include <printio.hh>
 #    include <nel/panic.hh>
+#    include <nel/simd.hh>
+#    include <nel/sort.hh>
+#    include <nel/search.hh>
+#    include <nel/result.hh>
+#    include <nel/pair.hh>
+#    include <nel/traits.hh> // remove_const
 #    include <nel/defs.hh>
 
 #    include <cstddef> // std::nullptr_t
@@ -40,6 +75,8 @@ struct Slice
 {
     public:
         typedef T Type;
+        // Type without const, for values passed in and returned.
+        typedef remove_const<Type> Value;
 
     private:
         Type *content_;
@@ -70,6 +107,15 @@ struct Slice
         {
         }
 
+        // A slice over mutable values can be used as one over const values.
+        template<typename U>
+        constexpr Slice(Slice<U> const &o)
+            requires(__is_same(U const, T) && !__is_same(U, T))
+            : content_(o.ptr())
+            , len_(o.len())
+        {
+        }
+
     public:
         // Copying a slice is ok as it does not own the data it points to.
         constexpr Slice(Slice const &) = default;
@@ -279,6 +325,60 @@ struct Slice
             elem::copy(ptr(), o.ptr(), len());
         }
 
+        /**
+         * Copy contents of one slice to another of same length,
+         * with streaming stores that bypass the cache.
+         *
+         * For copies much larger than the last level cache whose destination is not read
+         * again soon, e.g. snapshotting a large buffer, so the copy does not evict
+         * every other thread's working set. Slower than copy_from() if the destination is
+         * used straight after, as it must then be read back from memory.
+         *
+         * @param src Slice to copy values from.
+         *
+         * @note a normal copy_from() if T is not trivially copyable.
+         * @see elem::copy_streaming()
+         * @warning panics if slices are of different lengths
+         * @warning UB if the slices overlap.
+         */
+        void copy_from_streaming(Slice const &o)
+        {
+            nel::panic_if_not(len() == o.len(),
+                              "nel::Slice:copy_from_streaming: Different lengths");
+            elem::copy_streaming(ptr(), o.ptr(), len());
+        }
+
+        /**
+         * Move contents of one slice to another of same length,
+         * with streaming stores that bypass the cache.
+         *
+         * @param src Slice to move values from.
+         *
+         * @note a normal move_from() if T is not trivially copyable.
+         * @see copy_from_streaming()
+         * @warning panics if slices are of different lengths
+         * @warning UB if the slices overlap.
+         */
+        void move_from_streaming(Slice &src)
+        {
+            nel::panic_if_not(len() == src.len(),
+                              "nel::Slice:move_from_streaming: Different lengths");
+            elem::move_streaming(ptr(), src.ptr(), len());
+        }
+
+        /**
+         * Fill the slice with the value given, with streaming stores that bypass the cache.
+         *
+         * @param f value to use as a template.
+         *
+         * @note a normal fill() unless T is trivially copyable and its size divides 16.
+         * @see copy_from_streaming()
+         */
+        void fill_streaming(Type const &f)
+        {
+            elem::set_streaming(ptr(), f, len());
+        }
+
         /**
          * Get a partial slice over the range of elements in the slice.
          *
@@ -312,149 +412,1159 @@ struct Slice
             return Iterator(ptr(), len());
         }
 
-    public:
         /**
-         * Format/emit a representation of this object as a charstring
-         * for debugging purposes.
+         * Return an iterator over consecutive sub-slices of n items.
          *
-         * @param val the value to format
-         * @param outs the stream to dump the representation into.
+         * The last may be shorter if len() is not a multiple of n.
+         * Sub-slices refer to this slice's items, none are copied.
+         *
+         * @param n the number of items in each sub-slice.
+         * @warning Panics if n is 0.
          */
-        // TODO: replace <<(Log ) with dbgfmt, so separate out from
-        // any other form of conversion to charstring.
-        // TODO: insert into formatter and not final dest type.
-        // instead of insert into log, can it format into ? which log implements?
-        // so it doesn't matter about the destination..
-        // and can format-insert into any char endpoint.
-        friend Log &operator<<(Log &outs, Slice const &v)
+        constexpr ChunksIterator<Type> chunks(Length const n) const
         {
-            outs << "Slice(" << v.len() << "){";
-#    if defined(RUST_LIKE)
-            auto it = v.iter();
-            auto itv = it.next();
-            if (itv.is_some()) {
-                outs << itv.unwrap();
-                it.for_each([&outs](T const &e) { outs << ' ' << e; });
-            }
-#    elif 0 && defined(C_LIKE)
-            if (v.len() > 0) {
-                outs << v.content_[0];
-                for (Index i = 1; i < v.len(); ++i) {
-                    outs << ' ' << v.content_[i];
-                }
-            }
-#    elif defined(C_LIKE)
-            auto it = v.iter();
-            if (it) {
-                outs << *it;
-                ++it;
-                it.for_each([&outs](T const &e) { outs << ' ' << e; });
-            }
-#    endif
-            outs << '}';
-            return outs;
+            return ChunksIterator<Type>(ptr(), len(), n);
         }
-};
 
-/**
- * An Iterator over a range of T
- *
- * Iterator does not own what it's iterating over, so is invalidated if that goes out of scope.
- * Cannot be reset once exhausted.
- * Is non-consuming, items are not moved out of original container.
- */
-// TODO: maybe make length a template param..
-template<typename T>
-struct SliceIterator: public Iterator<SliceIterator<T>, T &, T &>
-{
-    public:
-        typedef T &InT;
-        typedef T &OutT;
+        /**
+         * Return an iterator over consecutive blocks of exactly N items.
+         *
+         * Each block is a reference to a fixed size array (Type (&)[N]) in this slice,
+         * so loops over a block have a trip count known at compile time
+         * and can be unrolled/vectorised.
+         * Items left over, fewer than N, are skipped, see ChunksExactIterator::remainder().
+         */
+        template<Length const N>
+        constexpr ChunksExactIterator<Type, N> chunks_exact(void) const
+        {
+            return ChunksExactIterator<Type, N>(ptr(), len());
+        }
 
-    private:
-        T *b_;
-        T *e_;
+        /**
+         * Return an iterator over all overlapping sub-slices of n items,
+         * i.e. [0, n), [1, n+1), ...
+         *
+         * Empty if len() < n.
+         *
+         * @param n the number of items in each sub-slice.
+         * @warning Panics if n is 0.
+         */
+        constexpr WindowsIterator<Type> windows(Length const n) const
+        {
+            return WindowsIterator<Type>(ptr(), len(), n);
+        }
 
-    public:
-        constexpr SliceIterator(void) = delete;
+        /**
+         * Return an iterator over the sub-slices between occurrences of needle.
+         *
+         * As for splitting strings: n occurrences give n+1 sub-slices, empty ones included,
+         * e.g. "a,,b," split by "," is "a", "", "b", "". An empty slice gives one empty
+         * sub-slice. Occurrences are found as by find_subslice(), left to right, not
+         * overlapping. Sub-slices refer to this slice's items, none are copied.
+         *
+         * @param needle the items to split at, must outlive the iterator.
+         * @warning Panics if needle is empty.
+         */
+        SplitIterator<Type, SplitAtSlice<Value>> split(Slice<Value const> const &needle) const
+        {
+            nel::panic_if(needle.is_empty(), "split: needle must not be empty");
+            return SplitIterator<Type, SplitAtSlice<Value>>(ptr(), len(),
+                                                            SplitAtSlice<Value> {needle});
+        }
 
-    public:
-        // copy ok
-        SliceIterator(SliceIterator const &o) = default;
-        SliceIterator &operator=(SliceIterator const &o) = default;
+        /**
+         * Return an iterator over the sub-slices between items equal to sep.
+         *
+         * As split(needle), for a needle of one item, found as by find().
+         *
+         * @param sep the item to split at.
+         */
+        SplitIterator<Type, SplitAtItem<Value>> split(Value const &sep) const
+        {
+            return SplitIterator<Type, SplitAtItem<Value>>(ptr(), len(), SplitAtItem<Value> {sep});
+        }
 
-    public:
-        // move ok
-        SliceIterator(SliceIterator &&o)
-            : b_(move(o.b_))
-            , e_(move(o.e_))
+        /**
+         * Return an iterator over the sub-slices between items pred returns true for.
+         *
+         * As split(needle), each item pred returns true for being a separator.
+         *
+         * @param pred callable as bool(Type const &).
+         */
+        template<typename F>
+        SplitIterator<Type, SplitAtPred<Value, F>> split_if(F &&pred) const
         {
-            o.b_ = nullptr;
-            o.e_ = nullptr;
+            return SplitIterator<Type, SplitAtPred<Value, F>>(
+                ptr(), len(), SplitAtPred<Value, F> {forward<F>(pred)});
         }
 
-        SliceIterator &operator=(SliceIterator &&o)
+        /**
+         * Return an iterator over the lines of a slice of bytes (text).
+         *
+         * Lines end with "\n" or "\r\n", which are not part of the sub-slices.
+         * The last line need not end in one, so "a\nb" and "a\nb\n" are both lines "a", "b".
+         * An empty slice has no lines. Sub-slices refer to this slice's items, none are copied.
+         */
+        LinesIterator<Type> lines(void) const
+            requires(simd::is_searchable<Value> && sizeof(Value) == 1)
         {
-            if (this != &o) {
-                b_ = move(o.b_);
-                e_ = move(o.e_);
-                o.b_ = nullptr;
-                o.e_ = nullptr;
-            }
-            return *this;
+            return LinesIterator<Type>(ptr(), len());
+        }
+
+        /**
+         * Return an iterator over the words of a slice of bytes (text),
+         * the sub-slices between runs of ASCII whitespace (" \t\n\v\f\r").
+         *
+         * Never yields empty sub-slices, so all whitespace has no words.
+         * Sub-slices refer to this slice's items, none are copied.
+         */
+        SplitWhitespaceIterator<Type> split_whitespace(void) const
+            requires(simd::is_searchable<Value> && sizeof(Value) == 1)
+        {
+            return SplitWhitespaceIterator<Type>(ptr(), len());
         }
 
     public:
-        constexpr SliceIterator(T arr[], Count len)
-            : b_(arr)
-            , e_(arr + len)
+        /**
+         * Numeric reductions, for slices of the types nel::simd supports
+         * (32 and 64 bit ints, float and double).
+         * These use vector instructions where the host has them, see nel/simd.hh.
+         */
+
+        /**
+         * Sum of all values in the slice.
+         *
+         * @returns 0 if empty.
+         * @note 32 bit values are summed as 64 bit, see simd::Reduce for the type.
+         */
+        auto sum(void) const
+            requires(simd::is_reducible<Value>)
         {
+            return simd::sum<Value>(ptr(), len());
         }
 
-        constexpr SliceIterator(T *const b, T *const e)
-            : b_(b)
-            , e_(e)
+        /**
+         * Smallest value in the slice.
+         *
+         * @returns None if empty.
+         */
+        Optional<Value> min(void) const
+            requires(simd::is_reducible<Value>)
         {
+            if (is_empty()) { return None; }
+            return Some(simd::min<Value>(ptr(), len()));
         }
 
-#    if defined(RUST_LIKE)
         /**
-         * Return next item in iterator or None is no more.
+         * Largest value in the slice.
          *
-         * @returns Optional::Some if iterator still active.
-         * @returns Optional::None if iterator exhausted.
+         * @returns None if empty.
          */
-        // if T == U & then mutating, non-consuming.
-        // if T == U && then owning/consuming (val moved out of underlying collection)
-        // if T == U then coping.. want to avoid.
-        // mutating.non-consuming
-        // non-mutating.non-consuming
-        Optional<OutT> next(void)
+        Optional<Value> max(void) const
+            requires(simd::is_reducible<Value>)
         {
-            // Some() takes a move, so want to move the reference into the optional.
-            // ref(),
-            if (b_ == e_) { return None; }
-            return Some(*b_++);
+            if (is_empty()) { return None; }
+            return Some(simd::max<Value>(ptr(), len()));
+        }
+
+        /**
+         * Smallest and largest value in the slice, found in one pass.
+         *
+         * @returns None if empty.
+         * @returns else Pair of (min, max)
+         */
+        Optional<Pair<Value, Value>> min_max(void) const
+            requires(simd::is_reducible<Value>)
+        {
+            if (is_empty()) { return None; }
+            Pair<Value, Value> r;
+            simd::min_max<Value>(ptr(), len(), r.first, r.second);
+            return Some(move(r));
+        }
+
+        /**
+         * Dot product of this slice and o, i.e. sum of this[i] * o[i].
+         *
+         * @param o the other values.
+         *
+         * @returns 0 if either is empty.
+         * @note if lengths differ, only the first min(len(), o.len()) values are used.
+         */
+        auto dot(Slice<Value const> const &o) const
+            requires(simd::is_reducible<Value>)
+        {
+            Length const n = (len() < o.len()) ? len() : o.len();
+            return simd::dot<Value>(ptr(), o.ptr(), n);
+        }
+
+        /**
+         * Number of values in the slice for which pred returns true.
+         *
+         * @param pred callable as bool(Type const &).
+         */
+        template<typename F>
+        Count count_if(F &&pred) const
+        {
+            return simd::count_if(ptr(), len(), forward<F>(pred));
         }
-#    endif
 
     public:
-#    if defined(C_LIKE)
-        constexpr bool is_done(void) const
+        /**
+         * Sorting, in place, without allocating, see nel/sort.hh.
+         *
+         * Each takes an optional comparator, callable as bool(Type const &a, Type const &b),
+         * returning true if a must come before b. Defaults to a < b.
+         * It must be a strict weak ordering (e.g. not <=).
+         */
+
+        /**
+         * Sort the slice, equal items may be reordered.
+         *
+         * Pattern-defeating quicksort, O(n log n) worst case,
+         * O(n) if already sorted, reverse sorted or all equal.
+         */
+        template<typename F = sort::Less>
+        void sort_unstable(F &&less = F())
         {
-            return (b_ == e_);
+            sort::unstable(ptr(), len(), less);
         }
 
-        void inc(void)
+        /**
+         * Sort the slice, equal items keep their order.
+         *
+         * Merge sort in place, O(n log^2 n).
+         * Use sort_with() and some scratch space for O(n log n).
+         */
+        template<typename F = sort::Less>
+        void sort(F &&less = F())
         {
-            ++b_;
+            sort::stable(ptr(), len(), static_cast<Type *>(nullptr), 0, less);
         }
 
-        OutT deref(void)
+        /**
+         * Sort the slice, equal items keep their order, using scratch space.
+         *
+         * Merge sort, O(n log n) if scratch has at least len()/2 items,
+         * less scratch still helps, none is the same as sort().
+         *
+         * @param scratch items to use as temporary storage, left in a moved-from state.
+         */
+        template<typename F = sort::Less>
+        void sort_with(Slice const &scratch, F &&less = F())
         {
-            return *b_;
+            sort::stable(ptr(), len(), scratch.ptr(), scratch.len(), less);
+        }
+
+        /**
+         * Reorder the slice so the item at idx is the one that would be there if sorted,
+         * items before it are not greater than it, and items after not less.
+         *
+         * O(n) on average, O(n log n) worst case.
+         *
+         * @param idx the index of the item to place.
+         * @returns the item now at idx.
+         * @warning panics if idx is out-of-range for slice.
+         */
+        template<typename F = sort::Less>
+        Type &select_nth_unstable(Index idx, F &&less = F())
+        {
+            nel::panic_if_not(idx < len(), "nel::Slice::select_nth_unstable: index out of range");
+            sort::select_nth(ptr(), len(), idx, less);
+            return content_[idx];
+        }
+
+        /**
+         * Sort the smallest k items into the front of the slice, the rest are left after
+         * them in no particular order.
+         *
+         * O(n + k log k), equal items may be reordered.
+         *
+         * @param k number of items to sort, sorts all if k >= len().
+         */
+        template<typename F = sort::Less>
+        void partial_sort(Length k, F &&less = F())
+        {
+            if (k < len()) {
+                sort::select_nth(ptr(), len(), k, less);
+            } else {
+                k = len();
+            }
+            sort::unstable(ptr(), k, less);
+        }
+
+    public:
+        /**
+         * Searching a sorted slice, by binary search, see nel/search.hh.
+         *
+         * Each takes an optional comparator, as for sorting, which the slice must be sorted by.
+         * Defaults to a < b.
+         * For large read-mostly tables, see also search::eytzinger_lower_bound.
+         */
+
+        /**
+         * Find key.
+         *
+         * @param key the value to find.
+         * @returns Ok with the index of an item equal to key, any of them if several.
+         * @returns Err with the index key would be inserted at to keep the slice sorted.
+         */
+        template<typename F = sort::Less>
+        Result<Index, Index> binary_search(Value const &key, F &&less = F()) const
+        {
+            Index const i = search::lower_bound(ptr(), len(), key, less);
+            if (i < len() && !less(key, content_[i])) { return Result<Index, Index>::Ok(i); }
+            return Result<Index, Index>::Err(i);
+        }
+
+        /**
+         * Index of the first item not less than key.
+         *
+         * @returns len() if all are less.
+         */
+        template<typename F = sort::Less>
+        Index lower_bound(Value const &key, F &&less = F()) const
+        {
+            return search::lower_bound(ptr(), len(), key, less);
+        }
+
+        /**
+         * Index of the first item greater than key.
+         *
+         * @returns len() if none are greater.
+         */
+        template<typename F = sort::Less>
+        Index upper_bound(Value const &key, F &&less = F()) const
+        {
+            return search::upper_bound(ptr(), len(), key, less);
+        }
+
+        /**
+         * Index of the first item pred returns false for,
+         * given the slice is partitioned: pred is true for all items before it, false after.
+         *
+         * @param pred callable as bool(Type const &).
+         * @returns len() if pred is true for all.
+         */
+        template<typename F>
+        Index partition_point(F &&pred) const
+        {
+            return search::partition_point(ptr(), len(), pred);
+        }
+
+    public:
+        /**
+         * Searching a slice by value, in order, see nel/simd.hh.
+         *
+         * For slices of 8, 16, 32 and 64 bit ints these compare many items at once with
+         * vector instructions where the host has them, else use Type's ==.
+         */
+
+        /**
+         * Index of the first item equal to v.
+         *
+         * @returns None if there isn't one.
+         */
+        Optional<Index> find(Value const &v) const
+        {
+            Index const i = simd::find<Value>(ptr(), len(), v);
+            if (i == len()) { return None; }
+            return Some(Index(i));
+        }
+
+        /**
+         * Index of the last item equal to v.
+         *
+         * @returns None if there isn't one.
+         */
+        Optional<Index> rfind(Value const &v) const
+        {
+            Index const i = simd::rfind<Value>(ptr(), len(), v);
+            if (i == len()) { return None; }
+            return Some(Index(i));
+        }
+
+        /**
+         * Is there an item equal to v?
+         */
+        bool contains(Value const &v) const
+        {
+            return simd::find<Value>(ptr(), len(), v) != len();
+        }
+
+        /**
+         * Number of items equal to v.
+         */
+        Count count(Value const &v) const
+        {
+            return simd::count<Value>(ptr(), len(), v);
+        }
+
+        /**
+         * Index of the first occurrence of needle, as consecutive items.
+         *
+         * For slices of bytes this is vectorised, and linear in len() + needle.len()
+         * whatever the input, see simd::find_sub_bytes.
+         *
+         * @returns None if there isn't one.
+         * @returns Some(0) if needle is empty.
+         */
+        Optional<Index> find_subslice(Slice<Value const> const &needle) const
+        {
+            if (needle.is_empty()) { return Some(Index(0)); }
+            Index const i = simd::find_sub<Value>(ptr(), len(), needle.ptr(), needle.len());
+            if (i == len()) { return None; }
+            return Some(Index(i));
+        }
+
+        /**
+         * Index of the first item pred returns true for.
+         *
+         * @param pred callable as bool(Type const &).
+         * @returns None if there isn't one.
+         */
+        template<typename F>
+        Optional<Index> position(F &&pred) const
+        {
+            for (Index i = 0; i < len(); ++i) {
+                if (pred(content_[i])) { return Some(Index(i)); }
+            }
+            return None;
+        }
+
+        /**
+         * Index of the last item pred returns true for.
+         *
+         * @param pred callable as bool(Type const &).
+         * @returns None if there isn't one.
+         */
+        template<typename F>
+        Optional<Index> rposition(F &&pred) const
+        {
+            for (Index i = len(); i > 0; --i) {
+                if (pred(content_[i - 1])) { return Some(Index(i - 1)); }
+            }
+            return None;
+        }
+
+    public:
+        /**
+         * Format/emit a representation of this object as a charstring
+         * for debugging purposes.
+         *
+         * @param val the value to format
+         * @param outs the stream to dump the representation into.
+         */
+        // TODO: replace <<(Log ) with dbgfmt, so separate out from
+        // any other form of conversion to charstring.
+        // TODO: insert into formatter and not final dest type.
+        // instead of insert into log, can it format into ? which log implements?
+        // so it doesn't matter about the destination..
+        // and can format-insert into any char endpoint.
+        friend Log &operator<<(Log &outs, Slice const &v)
+        {
+            outs << "Slice(" << v.len() << "){";
+#    if defined(RUST_LIKE)
+            auto it = v.iter();
+            auto itv = it.next();
+            if (itv.is_some()) {
+                outs << itv.unwrap();
+                it.for_each([&outs](T const &e) { outs << ' ' << e; });
+            }
+#    elif 0 && defined(C_LIKE)
+            if (v.len() > 0) {
+                outs << v.content_[0];
+                for (Index i = 1; i < v.len(); ++i) {
+                    outs << ' ' << v.content_[i];
+                }
+            }
+#    elif defined(C_LIKE)
+            auto it = v.iter();
+            if (it) {
+                outs << *it;
+                ++it;
+                it.for_each([&outs](T const &e) { outs << ' ' << e; });
+            }
+#    endif
+            outs << '}';
+            return outs;
+        }
+};
+
+/**
+ * An Iterator over a range of T
+ *
+ * Iterator does not own what it's iterating over, so is invalidated if that goes out of scope.
+ * Cannot be reset once exhausted.
+ * Is non-consuming, items are not moved out of original container.
+ */
+// TODO: maybe make length a template param..
+template<typename T>
+struct SliceIterator: public Iterator<SliceIterator<T>, T &, T &>
+{
+    public:
+        typedef T &InT;
+        typedef T &OutT;
+
+    private:
+        T *b_;
+        T *e_;
+
+    public:
+        constexpr SliceIterator(void) = delete;
+
+    public:
+        // copy ok
+        SliceIterator(SliceIterator const &o) = default;
+        SliceIterator &operator=(SliceIterator const &o) = default;
+
+    public:
+        // move ok
+        SliceIterator(SliceIterator &&o)
+            : b_(move(o.b_))
+            , e_(move(o.e_))
+        {
+            o.b_ = nullptr;
+            o.e_ = nullptr;
+        }
+
+        SliceIterator &operator=(SliceIterator &&o)
+        {
+            if (this != &o) {
+                b_ = move(o.b_);
+                e_ = move(o.e_);
+                o.b_ = nullptr;
+                o.e_ = nullptr;
+            }
+            return *this;
+        }
+
+    public:
+        constexpr SliceIterator(T arr[], Count len)
+            : b_(arr)
+            , e_(arr + len)
+        {
+        }
+
+        constexpr SliceIterator(T *const b, T *const e)
+            : b_(b)
+            , e_(e)
+        {
+        }
+
+#    if defined(RUST_LIKE)
+        /**
+         * Return next item in iterator or None is no more.
+         *
+         * @returns Optional::Some if iterator still active.
+         * @returns Optional::None if iterator exhausted.
+         */
+        // if T == U & then mutating, non-consuming.
+        // if T == U && then owning/consuming (val moved out of underlying collection)
+        // if T == U then coping.. want to avoid.
+        // mutating.non-consuming
+        // non-mutating.non-consuming
+        Optional<OutT> next(void)
+        {
+            // Some() takes a move, so want to move the reference into the optional.
+            // ref(),
+            if (b_ == e_) { return None; }
+            return Some(*b_++);
+        }
+
+        /**
+         * Return the last item left in iterator or None if no more.
+         *
+         * @returns Optional::Some if iterator still active.
+         * @returns Optional::None if iterator exhausted.
+         */
+        Optional<OutT> next_back(void)
+        {
+            if (b_ == e_) { return None; }
+            return Some(*--e_);
+        }
+#    endif
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return (b_ == e_);
+        }
+
+        void inc(void)
+        {
+            ++b_;
+        }
+
+        OutT deref(void)
+        {
+            return *b_;
+        }
+
+        void dec(void)
+        {
+            --e_;
+        }
+
+        OutT deref_back(void)
+        {
+            return *(e_ - 1);
+        }
+#    endif
+
+    public:
+        constexpr SizeHint size_hint(void) const
+        {
+            return SizeHint::exact(Count(e_ - b_));
+        }
+};
+
+/**
+ * An Iterator over consecutive sub-slices of (at most) n items of a range of T.
+ *
+ * Iterator does not own what it's iterating over, so is invalidated if that goes out of scope.
+ */
+template<typename T>
+struct ChunksIterator: public Iterator<ChunksIterator<T>, Slice<T>, Slice<T>>
+{
+    public:
+        typedef Slice<T> InT;
+        typedef Slice<T> OutT;
+
+    private:
+        T *b_;
+        T *e_;
+        Length n_;
+
+        constexpr Length current_len(void) const
+        {
+            return (Length(e_ - b_) < n_) ? Length(e_ - b_) : n_;
+        }
+
+    public:
+        constexpr ChunksIterator(T *const b, Length const len, Length const n)
+            : b_(b)
+            , e_(b + len)
+            , n_(n)
+        {
+            nel::panic_if(n == 0, "chunks: n must be > 0");
+        }
+
+#    if defined(RUST_LIKE)
+        /**
+         * Return next item in iterator or None is no more.
+         *
+         * @returns Optional::Some if iterator still active.
+         * @returns Optional::None if iterator exhausted.
+         */
+        Optional<OutT> next(void)
+        {
+            if (b_ == e_) { return None; }
+            OutT s(b_, current_len());
+            b_ += s.len();
+            return Some(move(s));
+        }
+#    endif
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return (b_ == e_);
+        }
+
+        void inc(void)
+        {
+            b_ += current_len();
+        }
+
+        OutT deref(void)
+        {
+            return OutT(b_, current_len());
+        }
+#    endif
+
+    public:
+        constexpr SizeHint size_hint(void) const
+        {
+            return SizeHint::exact((Length(e_ - b_) + n_ - 1) / n_);
+        }
+};
+
+/**
+ * An Iterator over consecutive blocks of exactly N items of a range of T,
+ * each as a reference to a T[N].
+ *
+ * Iterator does not own what it's iterating over, so is invalidated if that goes out of scope.
+ */
+template<typename T, Length const N>
+struct ChunksExactIterator: public Iterator<ChunksExactIterator<T, N>, T (&)[N], T (&)[N]>
+{
+        static_assert(N > 0, "chunks_exact: N must be > 0");
+
+    public:
+        typedef T (&InT)[N];
+        typedef T (&OutT)[N];
+
+    private:
+        T *b_;
+        // end of the whole blocks, the remainder follows.
+        T *e_;
+        Length rem_;
+
+    public:
+        constexpr ChunksExactIterator(T *const b, Length const len)
+            : b_(b)
+            , e_(b + len - len % N)
+            , rem_(len % N)
+        {
+        }
+
+        /**
+         * The items left over after the last whole block.
+         *
+         * @returns slice of the (fewer than N) items not in any block.
+         */
+        constexpr Slice<T> remainder(void) const
+        {
+            return Slice<T>(e_, rem_);
+        }
+
+#    if defined(RUST_LIKE)
+        /**
+         * Return next item in iterator or None is no more.
+         *
+         * @returns Optional::Some if iterator still active.
+         * @returns Optional::None if iterator exhausted.
+         */
+        Optional<OutT> next(void)
+        {
+            if (b_ == e_) { return None; }
+            T *const c = b_;
+            b_ += N;
+            return Some(*reinterpret_cast<T(*)[N]>(c));
+        }
+#    endif
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return (b_ == e_);
+        }
+
+        void inc(void)
+        {
+            b_ += N;
+        }
+
+        OutT deref(void)
+        {
+            return *reinterpret_cast<T(*)[N]>(b_);
+        }
+#    endif
+
+    public:
+        constexpr SizeHint size_hint(void) const
+        {
+            return SizeHint::exact(Length(e_ - b_) / N);
+        }
+};
+
+/**
+ * An Iterator over all overlapping sub-slices of n items of a range of T.
+ *
+ * Iterator does not own what it's iterating over, so is invalidated if that goes out of scope.
+ */
+template<typename T>
+struct WindowsIterator: public Iterator<WindowsIterator<T>, Slice<T>, Slice<T>>
+{
+    public:
+        typedef Slice<T> InT;
+        typedef Slice<T> OutT;
+
+    private:
+        T *b_;
+        // start of the last window, one past if none.
+        T *e_;
+        Length n_;
+
+    public:
+        constexpr WindowsIterator(T *const b, Length const len, Length const n)
+            : b_(b)
+            , e_((len < n) ? b : b + (len - n + 1))
+            , n_(n)
+        {
+            nel::panic_if(n == 0, "windows: n must be > 0");
+        }
+
+#    if defined(RUST_LIKE)
+        /**
+         * Return next item in iterator or None is no more.
+         *
+         * @returns Optional::Some if iterator still active.
+         * @returns Optional::None if iterator exhausted.
+         */
+        Optional<OutT> next(void)
+        {
+            if (b_ == e_) { return None; }
+            return Some(OutT(b_++, n_));
+        }
+#    endif
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return (b_ == e_);
+        }
+
+        void inc(void)
+        {
+            ++b_;
+        }
+
+        OutT deref(void)
+        {
+            return OutT(b_, n_);
+        }
+#    endif
+
+    public:
+        constexpr SizeHint size_hint(void) const
+        {
+            return SizeHint::exact(Length(e_ - b_));
+        }
+};
+
+/**
+ * Separators for SplitIterator.
+ *
+ * Each has find(p, n), the index of the first separator in p[0..n) (n if none),
+ * and len(), the number of items in a separator.
+ */
+
+// A run of items, see Slice::split(needle).
+template<typename T>
+struct SplitAtSlice
+{
+        Slice<T const> needle;
+
+        Index find(T const p[], Length const n) const
+        {
+            return simd::find_sub<T>(p, n, needle.ptr(), needle.len());
+        }
+
+        constexpr Length len(void) const
+        {
+            return needle.len();
+        }
+};
+
+// An item, see Slice::split(sep).
+template<typename T>
+struct SplitAtItem
+{
+        T sep;
+
+        Index find(T const p[], Length const n) const
+        {
+            return simd::find<T>(p, n, sep);
+        }
+
+        constexpr Length len(void) const
+        {
+            return 1;
+        }
+};
+
+// Any item a predicate is true for, see Slice::split_if(pred).
+template<typename T, typename F>
+struct SplitAtPred
+{
+        F pred;
+
+        Index find(T const p[], Length const n)
+        {
+            Index i = 0;
+            while (i < n && !pred(p[i])) {
+                i += 1;
+            }
+            return i;
+        }
+
+        constexpr Length len(void) const
+        {
+            return 1;
+        }
+};
+
+/**
+ * An Iterator over the sub-slices of a range of T between separators,
+ * found by S, one of the SplitAt* above.
+ *
+ * The next separator is found ahead, as each sub-slice is reached,
+ * so each item is searched once.
+ *
+ * Iterator does not own what it's iterating over, or a needle it splits at,
+ * so is invalidated if either goes out of scope.
+ */
+template<typename T, typename S>
+struct SplitIterator: public Iterator<SplitIterator<T, S>, Slice<T>, Slice<T>>
+{
+    public:
+        typedef Slice<T> InT;
+        typedef Slice<T> OutT;
+
+    private:
+        T *b_;
+        // the next separator, e_ if none.
+        T *m_;
+        T *e_;
+        S sep_;
+        bool done_;
+
+        T *find_from(T *const b)
+        {
+            return b + sep_.find(b, Length(e_ - b));
+        }
+
+    public:
+        SplitIterator(T *const b, Length const len, S &&sep)
+            : b_(b)
+            , m_(b + len)
+            , e_(b + len)
+            , sep_(forward<S>(sep))
+            , done_(false)
+        {
+            m_ = find_from(b_);
+        }
+
+#    if defined(RUST_LIKE)
+        /**
+         * Return next item in iterator or None is no more.
+         *
+         * @returns Optional::Some if iterator still active.
+         * @returns Optional::None if iterator exhausted.
+         */
+        Optional<OutT> next(void)
+        {
+            if (done_) { return None; }
+            OutT s(b_, m_);
+            inc();
+            return Some(move(s));
+        }
+#    endif
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return done_;
+        }
+#    endif
+
+        void inc(void)
+        {
+            if (m_ == e_) {
+                done_ = true;
+                return;
+            }
+            b_ = m_ + sep_.len();
+            m_ = find_from(b_);
+        }
+
+#    if defined(C_LIKE)
+        OutT deref(void)
+        {
+            return OutT(b_, m_);
+        }
+#    endif
+
+    public:
+        constexpr SizeHint size_hint(void) const
+        {
+            if (done_) { return SizeHint::exact(0); }
+            // at least this one, at most one per separator's worth of items left.
+            return SizeHint {1, 1 + Count(e_ - b_) / sep_.len()};
+        }
+};
+
+/**
+ * An Iterator over the lines of a range of bytes, without their "\n" or "\r\n".
+ *
+ * Iterator does not own what it's iterating over, so is invalidated if that goes out of scope.
+ */
+template<typename T>
+struct LinesIterator: public Iterator<LinesIterator<T>, Slice<T>, Slice<T>>
+{
+    public:
+        typedef Slice<T> InT;
+        typedef Slice<T> OutT;
+
+    private:
+        T *b_;
+        // the end of this line, at its "\n", e_ if none.
+        T *m_;
+        T *e_;
+
+        T *find_from(T *const b) const
+        {
+            return b + simd::find<remove_const<T>>(b, Length(e_ - b), '\n');
+        }
+
+        OutT current(void) const
+        {
+            // drop the '\r' of a "\r\n" only, one at the very end is part of the last line.
+            T *const e = (m_ != e_ && m_ != b_ && *(m_ - 1) == '\r') ? m_ - 1 : m_;
+            return OutT(b_, e);
+        }
+
+    public:
+        LinesIterator(T *const b, Length const len)
+            : b_(b)
+            , m_(b + len)
+            , e_(b + len)
+        {
+            m_ = find_from(b_);
+        }
+
+#    if defined(RUST_LIKE)
+        /**
+         * Return next item in iterator or None is no more.
+         *
+         * @returns Optional::Some if iterator still active.
+         * @returns Optional::None if iterator exhausted.
+         */
+        Optional<OutT> next(void)
+        {
+            if (b_ == e_) { return None; }
+            OutT s = current();
+            inc();
+            return Some(move(s));
+        }
+#    endif
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return b_ == e_;
+        }
+#    endif
+
+        void inc(void)
+        {
+            b_ = (m_ == e_) ? e_ : m_ + 1;
+            m_ = find_from(b_);
+        }
+
+#    if defined(C_LIKE)
+        OutT deref(void)
+        {
+            return current();
+        }
+#    endif
+
+    public:
+        constexpr SizeHint size_hint(void) const
+        {
+            if (b_ == e_) { return SizeHint::exact(0); }
+            // at least this one, at most one per item after it (all "\n").
+            return SizeHint {1, 1 + Count(e_ - m_)};
+        }
+};
+
+/**
+ * An Iterator over the words of a range of bytes, between runs of ASCII whitespace.
+ *
+ * Iterator does not own what it's iterating over, so is invalidated if that goes out of scope.
+ */
+template<typename T>
+struct SplitWhitespaceIterator: public Iterator<SplitWhitespaceIterator<T>, Slice<T>, Slice<T>>
+{
+    public:
+        typedef Slice<T> InT;
+        typedef Slice<T> OutT;
+
+    private:
+        // the start of this word, e_ if no more.
+        T *b_;
+        // the end of this word.
+        T *m_;
+        T *e_;
+
+        static constexpr bool is_space(T const &c)
+        {
+            return c == ' ' || (c >= '\t' && c <= '\r');
+        }
+
+        // Move on to the word at or after b.
+        void settle(T *b)
+        {
+            while (b != e_ && is_space(*b)) {
+                ++b;
+            }
+            T *m = b;
+            while (m != e_ && !is_space(*m)) {
+                ++m;
+            }
+            b_ = b;
+            m_ = m;
+        }
+
+    public:
+        SplitWhitespaceIterator(T *const b, Length const len)
+            : b_(b)
+            , m_(b)
+            , e_(b + len)
+        {
+            settle(b_);
+        }
+
+#    if defined(RUST_LIKE)
+        /**
+         * Return next item in iterator or None is no more.
+         *
+         * @returns Optional::Some if iterator still active.
+         * @returns Optional::None if iterator exhausted.
+         */
+        Optional<OutT> next(void)
+        {
+            if (b_ == e_) { return None; }
+            OutT s(b_, m_);
+            inc();
+            return Some(move(s));
+        }
+#    endif
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return b_ == e_;
+        }
+#    endif
+
+        void inc(void)
+        {
+            settle(m_);
+        }
+
+#    if defined(C_LIKE)
+        OutT deref(void)
+        {
+            return OutT(b_, m_);
+        }
+#    endif
+
+    public:
+        constexpr SizeHint size_hint(void) const
+        {
+            if (b_ == e_) { return SizeHint::exact(0); }
+            // at least this one, at most one per 2 items after it (a space and a letter).
+            return SizeHint {1, 1 + Count(e_ - m_) / 2};
         }
-#    endif
 };
 
 } // namespace nel
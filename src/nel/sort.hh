@@ -0,0 +1,467 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#if !defined(NEL_SORT_HH)
+#    define NEL_SORT_HH
+
+#    include <nel/defs.hh> // Length
+
+namespace nel
+{
+namespace sort
+{
+
+struct Less;
+
+} // namespace sort
+} // namespace nel
+
+#    include <nel/search.hh> // lower_bound, upper_bound
+#    include <nel/memory.hh> // move, swap
+#    include <nel/defs.hh>
+
+namespace nel
+{
+namespace sort
+{
+
+// Sorting of the items in [p, p+n), used by Slice::sort and friends.
+//
+// All take a comparator, less(a, b) returning true if a must come before b.
+// It must be a strict weak ordering, e.g. < not <=, and no NaNs for floats.
+// Items are moved with T's move-ctor/move-assign, and compared as T const &.
+// None allocate, and none recurse deeper than O(log n).
+
+/**
+ * The default comparator, a < b.
+ */
+struct Less
+{
+        template<typename T>
+        constexpr bool operator()(T const &a, T const &b) const
+        {
+            return a < b;
+        }
+};
+
+// Below this many items, insertion sort beats partitioning or merging.
+static constexpr Length small_n = 20;
+
+// Above this many items, use the median of 3 medians of 3 as pivot.
+static constexpr Length ninther_n = 128;
+
+// floor(log2(n)), n > 0.
+constexpr Count log2(Length n)
+{
+    Count l = 0;
+    while (n > 1) {
+        n /= 2;
+        l += 1;
+    }
+    return l;
+}
+
+/**
+ * Stable insertion sort, O(n^2), for small n or nearly sorted items.
+ */
+template<typename T, typename F>
+void insertion(T p[], Length const n, F &less)
+{
+    for (Index i = 1; i < n; ++i) {
+        if (!less(p[i], p[i - 1])) { continue; }
+        T t = move(p[i]);
+        Index j = i;
+        do {
+            p[j] = move(p[j - 1]);
+            j -= 1;
+        } while (j > 0 && less(t, p[j - 1]));
+        p[j] = move(t);
+    }
+}
+
+/**
+ * Insertion sort that gives up if more than a few items would be moved.
+ *
+ * @returns true if sorted.
+ * @returns false if gave up, items are still all present but only partly sorted.
+ */
+template<typename T, typename F>
+bool partial_insertion(T p[], Length const n, F &less)
+{
+    Count moved = 0;
+    for (Index i = 1; i < n; ++i) {
+        if (!less(p[i], p[i - 1])) { continue; }
+        T t = move(p[i]);
+        Index j = i;
+        do {
+            p[j] = move(p[j - 1]);
+            j -= 1;
+        } while (j > 0 && less(t, p[j - 1]));
+        p[j] = move(t);
+        moved += i - j;
+        if (moved > 8) { return false; }
+    }
+    return true;
+}
+
+template<typename T, typename F>
+void sift_down(T p[], Index i, Length const n, F &less)
+{
+    while (true) {
+        Index c = 2 * i + 1;
+        if (c >= n) { break; }
+        if (c + 1 < n && less(p[c], p[c + 1])) { c += 1; }
+        if (!less(p[i], p[c])) { break; }
+        swap(p[i], p[c]);
+        i = c;
+    }
+}
+
+/**
+ * Heap sort, O(n log n) always, the fallback when partitioning goes badly.
+ */
+template<typename T, typename F>
+void heap(T p[], Length const n, F &less)
+{
+    for (Index i = n / 2; i > 0; --i) {
+        sift_down(p, i - 1, n, less);
+    }
+    for (Index e = n; e > 1; --e) {
+        swap(p[0], p[e - 1]);
+        sift_down(p, 0, e - 1, less);
+    }
+}
+
+// Order a, b, c.
+template<typename T, typename F>
+void sort3(T &a, T &b, T &c, F &less)
+{
+    if (less(b, a)) { swap(a, b); }
+    if (less(c, b)) {
+        swap(b, c);
+        if (less(b, a)) { swap(a, b); }
+    }
+}
+
+// Move a pivot to p[0], n >= small_n.
+// Leaves an item no greater than it, and one no less than it, elsewhere in p,
+// which the partitions below rely on to stop their scans.
+template<typename T, typename F>
+void choose_pivot(T p[], Length const n, F &less)
+{
+    Index const h = n / 2;
+    if (n > ninther_n) {
+        sort3(p[0], p[h], p[n - 1], less);
+        sort3(p[1], p[h - 1], p[n - 2], less);
+        sort3(p[2], p[h + 1], p[n - 3], less);
+        sort3(p[h - 1], p[h], p[h + 1], less);
+        swap(p[0], p[h]);
+    } else {
+        sort3(p[h], p[0], p[n - 1], less);
+    }
+}
+
+/**
+ * Partition p around the pivot p[0], items less than it to its left, the rest to its right.
+ *
+ * @param already set true if no items had to be moved.
+ * @returns where the pivot ends up.
+ */
+template<typename T, typename F>
+Index partition_right(T p[], Length const n, F &less, bool &already)
+{
+    T pivot = move(p[0]);
+    Index first = 0;
+    Index last = n;
+    do {
+        first += 1;
+    } while (less(p[first], pivot));
+    if (first == 1) {
+        while (first < last) {
+            last -= 1;
+            if (less(p[last], pivot)) { break; }
+        }
+    } else {
+        do {
+            last -= 1;
+        } while (!less(p[last], pivot));
+    }
+    already = first >= last;
+    while (first < last) {
+        swap(p[first], p[last]);
+        do {
+            first += 1;
+        } while (less(p[first], pivot));
+        do {
+            last -= 1;
+        } while (!less(p[last], pivot));
+    }
+    Index const pos = first - 1;
+    p[0] = move(p[pos]);
+    p[pos] = move(pivot);
+    return pos;
+}
+
+/**
+ * Partition p around the pivot p[0], items equal to it to its left, greater to its right.
+ * Used when the pivot equals the item before p, so no item in p is less than it.
+ *
+ * @returns where the pivot ends up, all of [0, pos] are then equal.
+ */
+template<typename T, typename F>
+Index partition_left(T p[], Length const n, F &less)
+{
+    T pivot = move(p[0]);
+    Index first = 0;
+    Index last = n;
+    do {
+        last -= 1;
+    } while (less(pivot, p[last]));
+    if (last + 1 == n) {
+        while (first < last) {
+            first += 1;
+            if (less(pivot, p[first])) { break; }
+        }
+    } else {
+        do {
+            first += 1;
+        } while (!less(pivot, p[first]));
+    }
+    while (first < last) {
+        swap(p[first], p[last]);
+        do {
+            last -= 1;
+        } while (less(pivot, p[last]));
+        do {
+            first += 1;
+        } while (!less(pivot, p[first]));
+    }
+    p[0] = move(p[last]);
+    p[last] = move(pivot);
+    return last;
+}
+
+// Swap a few items about, to break up a pattern that gave a bad partition.
+template<typename T>
+void break_patterns(T p[], Length const n)
+{
+    if (n >= small_n) {
+        swap(p[0], p[n / 4]);
+        swap(p[n - 1], p[n - n / 4]);
+    }
+}
+
+template<typename T, typename F>
+void pdq(T p[], Length n, F &less, Count bad_allowed, bool leftmost)
+{
+    while (true) {
+        if (n < small_n) {
+            insertion(p, n, less);
+            return;
+        }
+        choose_pivot(p, n, less);
+
+        // The item before p is the pivot of a partition p is right of, so no item is less.
+        // If this pivot is equal to it, so are all items not greater, and they're done.
+        if (!leftmost && !less(p[-1], p[0])) {
+            Index const m = partition_left(p, n, less);
+            p += m + 1;
+            n -= m + 1;
+            continue;
+        }
+
+        bool already;
+        Index const m = partition_right(p, n, less, already);
+        Length const l = m;
+        Length const r = n - m - 1;
+
+        if (l < n / 8 || r < n / 8) {
+            // Too many of these and it's heading to O(n^2).
+            bad_allowed -= 1;
+            if (bad_allowed == 0) {
+                heap(p, n, less);
+                return;
+            }
+            break_patterns(p, l);
+            break_patterns(p + m + 1, r);
+        } else if (already && partial_insertion(p, l, less)
+                   && partial_insertion(p + m + 1, r, less)) {
+            // Was likely already sorted.
+            return;
+        }
+
+        // Recurse into the smaller part, loop on the larger, to bound the depth.
+        if (l < r) {
+            pdq(p, l, less, bad_allowed, leftmost);
+            p += m + 1;
+            n = r;
+            leftmost = false;
+        } else {
+            pdq(p + m + 1, r, less, bad_allowed, false);
+            n = l;
+        }
+    }
+}
+
+/**
+ * Unstable sort, pattern-defeating quicksort.
+ *
+ * O(n log n) worst case, O(n) for sorted, reversed or all equal items.
+ * Equal items may be reordered.
+ */
+template<typename T, typename F>
+void unstable(T p[], Length const n, F &less)
+{
+    if (n < 2) { return; }
+    pdq(p, n, less, log2(n), true);
+}
+
+/**
+ * Reorder so p[k] is the item that would be there if sorted,
+ * items before it are not greater, and items after it not less.
+ *
+ * O(n) on average, O(n log n) worst case. k < n.
+ */
+template<typename T, typename F>
+void select_nth(T p[], Length n, Index k, F &less)
+{
+    Count bad_allowed = log2(n);
+    bool leftmost = true;
+    while (n >= small_n) {
+        choose_pivot(p, n, less);
+        if (!leftmost && !less(p[-1], p[0])) {
+            Index const m = partition_left(p, n, less);
+            if (k <= m) { return; }
+            p += m + 1;
+            n -= m + 1;
+            k -= m + 1;
+            continue;
+        }
+
+        bool already;
+        Index const m = partition_right(p, n, less, already);
+        if (m < n / 8 || n - m - 1 < n / 8) {
+            bad_allowed -= 1;
+            if (bad_allowed == 0) {
+                heap(p, n, less);
+                return;
+            }
+        }
+        if (k == m) { return; }
+        if (k < m) {
+            n = m;
+        } else {
+            p += m + 1;
+            n -= m + 1;
+            k -= m + 1;
+            leftmost = false;
+        }
+    }
+    insertion(p, n, less);
+}
+
+// Reverse [p, p+n).
+template<typename T>
+void reverse(T p[], Length const n)
+{
+    Index i = 0;
+    Index j = n;
+    while (i + 1 < j) {
+        j -= 1;
+        swap(p[i], p[j]);
+        i += 1;
+    }
+}
+
+// Rotate [p, p+l+r) so the r items at p+l come first.
+template<typename T>
+void rotate(T p[], Length const l, Length const r)
+{
+    reverse(p, l);
+    reverse(p + l, r);
+    reverse(p, l + r);
+}
+
+/**
+ * Stably merge the sorted runs [p, p+m) and [p+m, p+n).
+ *
+ * If the shorter run fits in buf, it is moved there and merged back in one pass.
+ * Else the runs are split with binary searches and rotations, and merged in parts,
+ * any part whose shorter run fits in buf is merged through it.
+ */
+template<typename T, typename F>
+void merge(T p[], Length const m, Length const n, T buf[], Length const buf_n, F &less)
+{
+    // already in order, the common case for nearly sorted items.
+    if (m == 0 || m == n || !less(p[m], p[m - 1])) { return; }
+
+    Length const a = m;
+    Length const b = n - m;
+    if (a <= b && a <= buf_n) {
+        for (Index i = 0; i < a; ++i) {
+            buf[i] = move(p[i]);
+        }
+        Index i = 0;
+        Index j = m;
+        Index o = 0;
+        while (i < a && j < n) {
+            p[o++] = less(p[j], buf[i]) ? move(p[j++]) : move(buf[i++]);
+        }
+        while (i < a) {
+            p[o++] = move(buf[i++]);
+        }
+    } else if (b < a && b <= buf_n) {
+        for (Index j = 0; j < b; ++j) {
+            buf[j] = move(p[m + j]);
+        }
+        Index i = m;
+        Index j = b;
+        Index o = n;
+        while (i > 0 && j > 0) {
+            p[--o] = less(buf[j - 1], p[i - 1]) ? move(p[--i]) : move(buf[--j]);
+        }
+        while (j > 0) {
+            p[--o] = move(buf[--j]);
+        }
+    } else {
+        // Split the longer run in half, and the other where that middle item would go.
+        Index c1;
+        Index c2;
+        if (a >= b) {
+            c1 = a / 2;
+            c2 = m + search::lower_bound(p + m, b, p[c1], less);
+        } else {
+            c2 = m + b / 2;
+            c1 = search::upper_bound(p, a, p[c2], less);
+        }
+        rotate(p + c1, m - c1, c2 - m);
+        Index const nm = c1 + (c2 - m);
+        merge(p, c1, nm, buf, buf_n, less);
+        merge(p + nm, c2 - nm, n - nm, buf, buf_n, less);
+    }
+}
+
+/**
+ * Stable sort, merge sort.
+ *
+ * @param buf scratch space, its items are overwritten (left moved-from).
+ * @param buf_n size of buf, any size.
+ *
+ * O(n log n) if buf_n >= n / 2, down to O(n log^2 n) in place (buf_n == 0).
+ * O(n) for already sorted items.
+ */
+template<typename T, typename F>
+void stable(T p[], Length const n, T buf[], Length const buf_n, F &less)
+{
+    if (n < small_n) {
+        insertion(p, n, less);
+        return;
+    }
+    Length const h = n / 2;
+    stable(p, h, buf, buf_n, less);
+    stable(p + h, n - h, buf, buf_n, less);
+    merge(p, h, n, buf, buf_n, less);
+}
+
+} // namespace sort
+} // namespace nel
+
+#endif // !defined(NEL_SORT_HH)
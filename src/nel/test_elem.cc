@@ -779,6 +779,148 @@ TEST_CASE("elem::ne", "[elem]")
     }
 }
 
+TEST_CASE("elem::move, poisoning", "[elem]")
+{
+    uint8_t a1[] {1, 2, 3};
+    uint8_t a2[] {0, 0, 0};
+    nel::elem::move(a2, a1, 3);
+    CHECK(a2[0] == 1);
+    CHECK(a2[2] == 3);
+    // src is poisoned only if build says so.
+    CHECK((a1[0] == 0xa5) == nel::elem::poisoning);
+    CHECK((a1[2] == 0xa5) == nel::elem::poisoning);
+}
+
+struct Pod
+{
+        int a;
+        short b;
+        uint8_t c[3];
+};
+
+TEST_CASE("elem::copy, trivially copyable", "[elem]")
+{
+    Pod a1[] {{1, 2, {3, 4, 5}}, {6, 7, {8, 9, 10}}};
+    Pod a2[2] {};
+    nel::elem::copy(a2, a1, 2);
+    CHECK(a2[0].a == 1);
+    CHECK(a2[0].c[2] == 5);
+    CHECK(a2[1].b == 7);
+    CHECK(a2[1].c[0] == 8);
+
+    // move is a copy, src left as is.
+    Pod a3[2] {};
+    nel::elem::move(a3, a1, 2);
+    CHECK(a3[1].a == 6);
+    CHECK(a1[1].a == 6);
+}
+
+TEST_CASE("elem::set, trivially copyable", "[elem]")
+{
+    for (Length n = 0; n < 20; ++n) {
+        Pod a1[20] {};
+        Pod const f {11, 12, {13, 14, 15}};
+        nel::elem::set(a1, f, n);
+        for (Index i = 0; i < 20; ++i) {
+            CHECK(a1[i].a == ((i < n) ? 11 : 0));
+            CHECK(a1[i].c[2] == ((i < n) ? 15 : 0));
+        }
+    }
+
+    {
+        // single byte types.
+        bool a1[5] {};
+        nel::elem::set(a1, true, 4);
+        CHECK(a1[3]);
+        CHECK(!a1[4]);
+    }
+}
+
+TEST_CASE("elem::eq, bitwise comparable", "[elem]")
+{
+    {
+        long a1[] {1, 2, 3, 4};
+        long a2[] {1, 2, 3, 4};
+        long a3[] {1, 2, 3, 5};
+        CHECK(nel::elem::eq(a1, a2, 4));
+        CHECK(!nel::elem::ne(a1, a2, 4));
+        CHECK(!nel::elem::eq(a1, a3, 4));
+        CHECK(nel::elem::ne(a1, a3, 4));
+        CHECK(nel::elem::eq(a1, a3, 3));
+    }
+
+    {
+        // floats are not bitwise, +0 == -0.
+        float a1[] {0.0f};
+        float a2[] {-0.0f};
+        CHECK(nel::elem::eq(a1, a2, 1));
+        CHECK(!nel::elem::ne(a1, a2, 1));
+    }
+}
+
+TEST_CASE("elem::copy_uninit", "[elem]")
+{
+    {
+        // udt copied using copy-ctor.
+        Stub const a1[] {Stub(1), Stub(2)};
+        alignas(Stub) uint8_t b2[2 * sizeof(Stub)];
+        Stub *a2 = reinterpret_cast<Stub *>(b2);
+
+        Stub::reset();
+        nel::elem::copy_uninit(a2, a1, 2);
+        CHECK(Stub::copy_ctor == 2);
+        CHECK(Stub::copy_assn == 0);
+        CHECK(a2[1].val == 2);
+        CHECK(a1[1].valid);
+        a2[0].~Stub();
+        a2[1].~Stub();
+    }
+
+    {
+        int const a1[] {1, 2, 3};
+        int a2[3];
+        nel::elem::copy_uninit(a2, a1, 3);
+        CHECK(a2[0] == 1);
+        CHECK(a2[2] == 3);
+    }
+}
+
+TEST_CASE("elem::relocate", "[elem]")
+{
+    {
+        // udt relocated using move-ctor and dtor.
+        alignas(Stub) uint8_t b1[3 * sizeof(Stub)];
+        alignas(Stub) uint8_t b2[3 * sizeof(Stub)];
+        Stub *a1 = reinterpret_cast<Stub *>(b1);
+        Stub *a2 = reinterpret_cast<Stub *>(b2);
+        for (int i = 0; i < 3; ++i) {
+            new (&a1[i]) Stub(i + 1);
+        }
+
+        Stub::reset();
+        nel::elem::relocate(a2, a1, 3);
+        CHECK(Stub::move_ctor == 3);
+        CHECK(Stub::dtor == 3);
+        CHECK(Stub::move_assn == 0);
+        CHECK(a2[0].val == 1);
+        CHECK(a2[2].val == 3);
+        for (int i = 0; i < 3; ++i) {
+            a2[i].~Stub();
+        }
+    }
+
+    {
+        // overlapping, forwards and backwards.
+        int a1[] {1, 2, 3, 4, 5};
+        nel::elem::relocate(&a1[1], &a1[0], 4);
+        CHECK(a1[1] == 1);
+        CHECK(a1[4] == 4);
+        nel::elem::relocate(&a1[0], &a1[1], 4);
+        CHECK(a1[0] == 1);
+        CHECK(a1[3] == 4);
+    }
+}
+
 }; // namespace elem
 }; // namespace test
 }; // namespace nel
@@ -2,6 +2,7 @@
 #include "iterator.hh"
 
 #include <nel/heapless/array.hh>
+#include <nel/heapless/vector.hh>
 
 #include <catch2/catch.hpp>
 
@@ -110,6 +111,378 @@ TEST_CASE("iterator::map", "[iterator]")
 #endif
 }
 
+// Collect the items of an iterator of ints, to check against.
+template<typename It>
+static nel::heapless::Vector<int, 16> collect(It &&it)
+{
+    auto v = nel::heapless::Vector<int, 16>::empty();
+    it.for_each([&v](int e) { v.push(int(e)).unwrap(); });
+    return v;
+}
+
+// 0, 1, 2, ... n-1
+template<Length const N>
+static nel::heapless::Array<int, N> iota(void)
+{
+    auto a = nel::heapless::Array<int, N>::filled_with(0);
+    int i = 0;
+    a.iter().for_each([&i](int &e) { e = i++; });
+    return a;
+}
+
+TEST_CASE("iterator::filter", "[iterator]")
+{
+    auto a1 = iota<8>();
+    {
+        auto v = collect(a1.iter().filter([](int const &e) { return e % 3 == 0; }));
+        REQUIRE(v.len() == 3);
+        REQUIRE(v[0] == 0);
+        REQUIRE(v[1] == 3);
+        REQUIRE(v[2] == 6);
+    }
+#if defined(C_LIKE)
+    {
+        // skips leading and trailing non-matches.
+        auto it1 = a1.iter().filter([](int const &e) { return e == 4; });
+        REQUIRE(it1);
+        REQUIRE(*it1 == 4);
+        ++it1;
+        REQUIRE(!it1);
+    }
+#endif
+    {
+        // none match.
+        auto v = collect(a1.iter().filter([](int const &) { return false; }));
+        REQUIRE(v.is_empty());
+    }
+    {
+        // items are still refs, so can be mutated.
+        a1.iter().filter([](int const &e) { return e < 2; }).for_each([](int &e) { e = 10; });
+        REQUIRE(a1[0] == 10);
+        REQUIRE(a1[1] == 10);
+        REQUIRE(a1[2] == 2);
+    }
+}
+
+TEST_CASE("iterator::skip", "[iterator]")
+{
+    auto a1 = iota<5>();
+    {
+        auto v = collect(a1.iter().skip(3));
+        REQUIRE(v.len() == 2);
+        REQUIRE(v[0] == 3);
+        REQUIRE(v[1] == 4);
+    }
+    {
+        REQUIRE(collect(a1.iter().skip(0)).len() == 5);
+        REQUIRE(collect(a1.iter().skip(5)).is_empty());
+        REQUIRE(collect(a1.iter().skip(100)).is_empty());
+    }
+#if defined(RUST_LIKE)
+    {
+        // skips once, even when C_LIKE has already skipped in the ctor.
+        auto it1 = a1.iter().skip(2);
+        REQUIRE(it1.next().unwrap() == 2);
+        REQUIRE(it1.next().unwrap() == 3);
+        REQUIRE(it1.next().unwrap() == 4);
+        REQUIRE(it1.next().is_none());
+    }
+#endif
+}
+
+TEST_CASE("iterator::take_while", "[iterator]")
+{
+    auto a1 = iota<6>();
+    {
+        auto v = collect(a1.iter().take_while([](int const &e) { return e < 3; }));
+        REQUIRE(v.len() == 3);
+        REQUIRE(v[2] == 2);
+    }
+    {
+        // stops at first false, even if later ones are true.
+        auto v = collect(a1.iter().take_while([](int const &e) { return e != 1; }));
+        REQUIRE(v.len() == 1);
+        REQUIRE(v[0] == 0);
+    }
+    {
+        REQUIRE(collect(a1.iter().take_while([](int const &) { return true; })).len() == 6);
+        REQUIRE(collect(a1.iter().take_while([](int const &) { return false; })).is_empty());
+    }
+}
+
+TEST_CASE("iterator::step_by", "[iterator]")
+{
+    auto a1 = iota<7>();
+    {
+        auto v = collect(a1.iter().step_by(3));
+        REQUIRE(v.len() == 3);
+        REQUIRE(v[0] == 0);
+        REQUIRE(v[1] == 3);
+        REQUIRE(v[2] == 6);
+    }
+    {
+        REQUIRE(collect(a1.iter().step_by(1)).len() == 7);
+        REQUIRE(collect(a1.iter().step_by(2)).len() == 4);
+        REQUIRE(collect(a1.iter().step_by(100)).len() == 1);
+    }
+}
+
+TEST_CASE("iterator::zip", "[iterator]")
+{
+    auto a1 = iota<4>();
+    auto a2 = nel::heapless::Array<int, 3>::filled_with(10);
+    {
+        int sum = 0;
+        Count n = 0;
+        a1.iter().zip(a2.iter()).for_each([&sum, &n](Pair<int &, int &> p) {
+            sum += p.first * p.second;
+            n += 1;
+        });
+        // stops at shorter.
+        REQUIRE(n == 3);
+        REQUIRE(sum == (0 + 1 + 2) * 10);
+    }
+    {
+        // refs, so can write through.
+        a1.iter().zip(a2.iter()).for_each([](Pair<int &, int &> p) { p.second = p.first; });
+        REQUIRE(a2[0] == 0);
+        REQUIRE(a2[2] == 2);
+    }
+}
+
+TEST_CASE("iterator::enumerate", "[iterator]")
+{
+    auto a1 = nel::heapless::Array<int, 3>::filled_with(7);
+    {
+        Index expected = 0;
+        a1.iter().enumerate().for_each([&expected](Pair<Index, int &> p) {
+            REQUIRE(p.first == expected);
+            REQUIRE(p.second == 7);
+            ++expected;
+        });
+        REQUIRE(expected == 3);
+    }
+    {
+        // composes, index is of the filtered items.
+        auto a2 = iota<6>();
+        Index last = 0;
+        int sum = 0;
+        a2.iter()
+            .filter([](int const &e) { return e % 2 == 1; })
+            .enumerate()
+            .for_each([&last, &sum](Pair<Index, int &> p) {
+                last = p.first;
+                sum += p.second;
+            });
+        REQUIRE(last == 2);
+        REQUIRE(sum == 1 + 3 + 5);
+    }
+}
+
+TEST_CASE("iterator::size_hint", "[iterator]")
+{
+    auto a1 = iota<8>();
+    auto a2 = iota<3>();
+    {
+        // slices, and adapters that keep count, are exact.
+        REQUIRE(a1.iter().size_hint().is_exact());
+        REQUIRE(a1.iter().size_hint().lower == 8);
+        REQUIRE(a1.iter().map<int>([](int &e) { return e; }).size_hint().lower == 8);
+        REQUIRE(a1.iter().first_n(3).size_hint().upper == 3);
+        REQUIRE(a1.iter().chain(a1.iter()).size_hint().lower == 16);
+        REQUIRE(a1.iter().skip(3).size_hint().lower == 5);
+        REQUIRE(a1.iter().skip(30).size_hint().upper == 0);
+        REQUIRE(a1.iter().step_by(3).size_hint().lower == 3);
+        REQUIRE(a1.iter().step_by(4).size_hint().lower == 2);
+        REQUIRE(a1.iter().zip(a2.iter()).size_hint().upper == 3);
+        REQUIRE(a1.iter().enumerate().size_hint().is_exact());
+    }
+    {
+        // adapters that drop an unknown number are bounded above only.
+        auto h1 = a1.iter().filter([](int const &e) { return e > 2; }).size_hint();
+        REQUIRE(h1.lower == 0);
+        REQUIRE(h1.upper <= 8);
+        REQUIRE(h1.upper >= 5);
+        auto h2 = a1.iter().take_while([](int const &e) { return e < 2; }).size_hint();
+        REQUIRE(h2.lower == 0);
+        REQUIRE(h2.upper == 8);
+    }
+#if defined(C_LIKE)
+    {
+        // shrinks as items are taken.
+        auto it1 = a1.iter().step_by(2);
+        ++it1;
+        REQUIRE(it1.size_hint().lower == 3);
+        auto it2 = a1.iter();
+        ++it2;
+        ++it2;
+        REQUIRE(it2.size_hint().lower == 6);
+    }
+#endif
+    {
+        // unbounded saturates.
+        auto h = SizeHint::unknown() + SizeHint::exact(3);
+        REQUIRE(h.upper == SizeHint::unbounded);
+        REQUIRE(h.lower == 3);
+    }
+}
+
+TEST_CASE("iterator::collect_into", "[iterator]")
+{
+    auto a1 = iota<8>();
+    {
+        auto v = nel::heapless::Vector<int, 16>::empty();
+        REQUIRE(a1.iter().map<int>([](int &e) { return e * 2; }).collect_into(v).is_ok());
+        REQUIRE(v.len() == 8);
+        REQUIRE(v[7] == 14);
+    }
+    {
+        // full, returns the iterator at the first item not pushed.
+        auto v = nel::heapless::Vector<int, 5>::empty();
+        auto r = a1.iter().collect_into(v);
+        REQUIRE(r.is_err());
+        REQUIRE(v.len() == 5);
+        REQUIRE(r.unwrap_err().size_hint().lower == 3);
+    }
+}
+
+TEST_CASE("iterator::rev", "[iterator]")
+{
+    auto a1 = iota<5>();
+    auto a2 = iota<3>();
+    {
+        auto v = collect(a1.iter().rev());
+        REQUIRE(v.len() == 5);
+        REQUIRE(v[0] == 4);
+        REQUIRE(v[4] == 0);
+        REQUIRE(a1.iter().rev().size_hint().lower == 5);
+    }
+    {
+        // chains reverse as a whole, second part first.
+        auto v = collect(a1.iter().chain(a2.iter()).rev());
+        REQUIRE(v.len() == 8);
+        REQUIRE(v[0] == 2);
+        REQUIRE(v[2] == 0);
+        REQUIRE(v[3] == 4);
+        REQUIRE(v[7] == 0);
+    }
+    {
+        // maps, rev'd either side.
+        auto v1 = collect(a1.iter().map<int>([](int &e) { return e * 10; }).rev());
+        REQUIRE(v1[0] == 40);
+        auto v2 = collect(a1.iter().rev().map<int>([](int &e) { return e * 10; }));
+        REQUIRE(v2[0] == 40);
+    }
+    {
+        // the last n, newest first.
+        auto v = collect(a1.iter().rev().first_n(2));
+        REQUIRE(v.len() == 2);
+        REQUIRE(v[0] == 4);
+        REQUIRE(v[1] == 3);
+    }
+    {
+        // rev of rev is forward again.
+        auto v = collect(a1.iter().rev().rev());
+        REQUIRE(v[0] == 0);
+        REQUIRE(v[4] == 4);
+    }
+    {
+        REQUIRE(collect(Slice<int>::empty().iter().rev()).is_empty());
+    }
+}
+
+TEST_CASE("iterator::double-ended", "[iterator]")
+{
+    auto a1 = iota<4>();
+    auto a2 = iota<2>();
+#if defined(RUST_LIKE)
+    {
+        // front and back meet in the middle.
+        auto it = a1.iter();
+        REQUIRE(it.next_back().unwrap() == 3);
+        REQUIRE(it.next().unwrap() == 0);
+        REQUIRE(it.next_back().unwrap() == 2);
+        REQUIRE(it.next().unwrap() == 1);
+        REQUIRE(it.next().is_none());
+        REQUIRE(it.next_back().is_none());
+    }
+    {
+        auto it = a1.iter().chain(a2.iter());
+        REQUIRE(it.next_back().unwrap() == 1);
+        REQUIRE(it.next_back().unwrap() == 0);
+        REQUIRE(it.next_back().unwrap() == 3);
+        REQUIRE(it.next().unwrap() == 0);
+        REQUIRE(it.size_hint().lower == 2);
+    }
+#endif
+#if defined(C_LIKE)
+    {
+        auto it = a1.iter();
+        REQUIRE(it.deref_back() == 3);
+        it.dec();
+        REQUIRE(it.deref_back() == 2);
+        ++it;
+        it.dec();
+        REQUIRE(*it == 1);
+        REQUIRE(it.deref_back() == 1);
+        it.dec();
+        REQUIRE(!it);
+    }
+    {
+        auto it = a1.iter().chain(a2.iter());
+        REQUIRE(it.deref_back() == 1);
+        it.dec();
+        it.dec();
+        REQUIRE(it.deref_back() == 3);
+        REQUIRE(*it == 0);
+    }
+#endif
+}
+
+TEST_CASE("iterator::try_fold", "[iterator]")
+{
+    auto a1 = iota<4>();
+    auto a2 = iota<3>();
+    {
+        int acc = 0;
+        REQUIRE(a1.iter().try_fold(acc, [](int &a, int &e) {
+            a += e;
+            return true;
+        }));
+        REQUIRE(acc == 0 + 1 + 2 + 3);
+    }
+    {
+        // chain runs each part in turn, and stops in the second.
+        int acc = 0;
+        REQUIRE(!a1.iter().chain(a2.iter()).try_fold(acc, [](int &a, int &e) {
+            a += 1;
+            return !(a > 4 && e == 1);
+        }));
+        REQUIRE(acc == 4 + 2);
+    }
+    {
+        // adapters pass it down to the chain.
+        int acc = 0;
+        REQUIRE(a1.iter()
+                    .chain(a2.iter())
+                    .map<int>([](int &e) { return e * 10; })
+                    .filter([](int const &e) { return e != 20; })
+                    .first_n(5)
+                    .try_fold(acc, [](int &a, int e) {
+                        a += e;
+                        return true;
+                    }));
+        REQUIRE(acc == 0 + 10 + 30 + 0 + 10);
+    }
+    {
+        // first_n stops the inner loop at the limit.
+        int n = 0;
+        a1.iter().chain(a2.iter()).first_n(5).for_each([&n](int &) { n += 1; });
+        REQUIRE(n == 5);
+        REQUIRE(a1.iter().chain(a2.iter()).first_n(0).fold(0, [](int &a, int &) { a += 1; }) == 0);
+    }
+}
+
 } // namespace iterator
 } // namespace test
 } // namespace nel
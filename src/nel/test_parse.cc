@@ -0,0 +1,292 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#include "parse.hh"
+
+#include <catch2/catch.hpp>
+
+namespace nel
+{
+namespace test
+{
+namespace parse
+{
+
+// A byte slice of a string, without its terminating 0.
+static Slice<unsigned char const> bytes(char const *const s)
+{
+    Length n = 0;
+    while (s[n] != '\0') {
+        n += 1;
+    }
+    return Slice<unsigned char const>(reinterpret_cast<unsigned char const *>(s), n);
+}
+
+template<typename T>
+static bool parses(Result<Pair<T, Length>, ParseError> r, T const &v, Length const used)
+{
+    return r.is_ok() && r.unwrap() == Pair<T, Length>{v, used};
+}
+
+template<typename T>
+static bool fails(Result<Pair<T, Length>, ParseError> r, ParseError const e)
+{
+    return r.is_err() && r.unwrap_err() == e;
+}
+
+// Same bits, so -0.0 != 0.0 and the last bit counts.
+static bool same(double const a, double const b)
+{
+    long long unsigned int ab;
+    long long unsigned int bb;
+    __builtin_memcpy(&ab, &a, sizeof(a));
+    __builtin_memcpy(&bb, &b, sizeof(b));
+    return ab == bb;
+}
+
+static bool parses_f64(char const *const s, double const v, Length const used)
+{
+    auto r = parse_f64(bytes(s));
+    if (r.is_err()) { return false; }
+    auto const p = r.unwrap();
+    return same(p.first, v) && p.second == used;
+}
+
+TEST_CASE("parse_u64", "[parse]")
+{
+    REQUIRE(parses(parse_u64(bytes("0")), 0ULL, 1));
+    REQUIRE(parses(parse_u64(bytes("7")), 7ULL, 1));
+    REQUIRE(parses(parse_u64(bytes("12345678")), 12345678ULL, 8));
+    REQUIRE(parses(parse_u64(bytes("123456789")), 123456789ULL, 9));
+    REQUIRE(parses(parse_u64(bytes("1234567890123456")), 1234567890123456ULL, 16));
+    REQUIRE(parses(parse_u64(bytes("18446744073709551615")), 18446744073709551615ULL, 20));
+    // leading 0s don't count towards overflow.
+    REQUIRE(parses(parse_u64(bytes("00000000000000000000042")), 42ULL, 23));
+
+    // stops at the first non-digit, whether there are 8 bytes left or not.
+    REQUIRE(parses(parse_u64(bytes("42,17")), 42ULL, 2));
+    REQUIRE(parses(parse_u64(bytes("42,1234567890")), 42ULL, 2));
+    REQUIRE(parses(parse_u64(bytes("1234567/9")), 1234567ULL, 7));
+    REQUIRE(parses(parse_u64(bytes("12345678:0")), 12345678ULL, 8));
+    REQUIRE(parses(parse_u64(bytes("123456789012\n")), 123456789012ULL, 12));
+
+    REQUIRE(fails(parse_u64(bytes("")), ParseError::Empty));
+    REQUIRE(fails(parse_u64(bytes("x1")), ParseError::InvalidDigit));
+    REQUIRE(fails(parse_u64(bytes("+1")), ParseError::InvalidDigit));
+    REQUIRE(fails(parse_u64(bytes("-1")), ParseError::InvalidDigit));
+    REQUIRE(fails(parse_u64(bytes("18446744073709551616")), ParseError::Overflow));
+    REQUIRE(fails(parse_u64(bytes("99999999999999999999")), ParseError::Overflow));
+    REQUIRE(fails(parse_u64(bytes("100000000000000000000")), ParseError::Overflow));
+}
+
+TEST_CASE("parse_u64, every length and position", "[parse]")
+{
+    // a number of each length, at each offset in a buffer, with junk after it.
+    char buf[40];
+    for (Length d = 1; d <= 19; ++d) {
+        for (Index off = 0; off < 8; ++off) {
+            long long unsigned int v = 0;
+            for (Index i = 0; i < sizeof(buf); ++i) {
+                buf[i] = 'z';
+            }
+            for (Index i = 0; i < d; ++i) {
+                unsigned char const c = (unsigned char)('1' + (i * 7 + d) % 9);
+                buf[off + i] = char(c);
+                v = v * 10 + (c - '0');
+            }
+            auto const all = Slice<unsigned char const>(
+                reinterpret_cast<unsigned char const *>(buf + off), sizeof(buf) - off);
+            REQUIRE(parses(parse_u64(all), v, d));
+            REQUIRE(parses(parse_u64(all.slice(0, d)), v, d));
+        }
+    }
+}
+
+TEST_CASE("parse_i64", "[parse]")
+{
+    REQUIRE(parses(parse_i64(bytes("0")), 0LL, 1));
+    REQUIRE(parses(parse_i64(bytes("-0")), 0LL, 2));
+    REQUIRE(parses(parse_i64(bytes("+17,")), 17LL, 3));
+    REQUIRE(parses(parse_i64(bytes("-12345678901")), -12345678901LL, 12));
+    REQUIRE(parses(parse_i64(bytes("9223372036854775807")), 9223372036854775807LL, 19));
+    REQUIRE(parses(parse_i64(bytes("-9223372036854775808")), -9223372036854775807LL - 1, 20));
+
+    REQUIRE(fails(parse_i64(bytes("")), ParseError::Empty));
+    REQUIRE(fails(parse_i64(bytes("-")), ParseError::InvalidDigit));
+    REQUIRE(fails(parse_i64(bytes("+")), ParseError::InvalidDigit));
+    REQUIRE(fails(parse_i64(bytes("--1")), ParseError::InvalidDigit));
+    REQUIRE(fails(parse_i64(bytes(" 1")), ParseError::InvalidDigit));
+    REQUIRE(fails(parse_i64(bytes("9223372036854775808")), ParseError::Overflow));
+    REQUIRE(fails(parse_i64(bytes("-9223372036854775809")), ParseError::Overflow));
+    REQUIRE(fails(parse_i64(bytes("-18446744073709551616")), ParseError::Overflow));
+}
+
+// The text of a literal, and the compiler's (correctly rounded) value of it.
+#define NEL_PARSE_CASE(x) {#x, x}
+
+TEST_CASE("parse_f64, matches the compiler", "[parse]")
+{
+    struct Case
+    {
+            char const *s;
+            double v;
+    };
+
+    Case const cases[] = {
+        NEL_PARSE_CASE(0.0),
+        NEL_PARSE_CASE(1.0),
+        NEL_PARSE_CASE(0.1),
+        NEL_PARSE_CASE(3.14159),
+        NEL_PARSE_CASE(123456.789e3),
+        NEL_PARSE_CASE(1e23),
+        NEL_PARSE_CASE(1e22),
+        NEL_PARSE_CASE(9007199254740993.0),
+        NEL_PARSE_CASE(9007199254740992.5),
+        NEL_PARSE_CASE(8.98846567431158e307),
+        NEL_PARSE_CASE(1.7976931348623157e308),
+        NEL_PARSE_CASE(1.7976931348623158e308),
+        NEL_PARSE_CASE(2.2250738585072014e-308),
+        NEL_PARSE_CASE(2.2250738585072011e-308),
+        NEL_PARSE_CASE(2.2250738585072012e-308),
+        NEL_PARSE_CASE(4.9406564584124654e-324),
+        NEL_PARSE_CASE(2.4703282292062328e-324),
+        NEL_PARSE_CASE(7.2057594037927933e16),
+        NEL_PARSE_CASE(1234567890123456789012345678901234567890.0),
+        NEL_PARSE_CASE(0.000000000000000000000000000000000000000000001234567890123456789),
+        // half way between two doubles: ties to even, and just above or below.
+        NEL_PARSE_CASE(9007199254740993.0000000000000000000000001),
+        NEL_PARSE_CASE(9007199254740992.9999999999999999999999999),
+        NEL_PARSE_CASE(9007199254740995.0),
+        NEL_PARSE_CASE(9007199254740993.0000000000000000000000000000000000000000000001),
+    };
+    for (Case const &c: cases) {
+        INFO(c.s);
+        REQUIRE(parses_f64(c.s, c.v, bytes(c.s).len()));
+    }
+}
+
+#undef NEL_PARSE_CASE
+
+TEST_CASE("parse_f64", "[parse]")
+{
+    REQUIRE(parses_f64("-0", -0.0, 2));
+    REQUIRE(parses_f64("+1.5", 1.5, 4));
+    REQUIRE(parses_f64(".5", 0.5, 2));
+    REQUIRE(parses_f64("5.", 5.0, 2));
+    REQUIRE(parses_f64("-2.5E-3,", -2.5e-3, 7));
+    REQUIRE(parses_f64("000000000000000000000000000012.5", 12.5, 32));
+    // an exponent without digits isn't part of the number.
+    REQUIRE(parses_f64("1e", 1.0, 1));
+    REQUIRE(parses_f64("1e+", 1.0, 1));
+    REQUIRE(parses_f64("1.5ex", 1.5, 3));
+    REQUIRE(parses_f64("7.5e-", 7.5, 3));
+
+    // out of range.
+    REQUIRE(parses_f64("1e400", __builtin_inf(), 5));
+    REQUIRE(parses_f64("-1e99999999999999999999", -__builtin_inf(), 23));
+    REQUIRE(parses_f64("1e-400", 0.0, 6));
+    REQUIRE(parses_f64("-1e-99999999999999999999", -0.0, 24));
+    REQUIRE(parses_f64("0e99999", 0.0, 7));
+
+    REQUIRE(parses_f64("inf", __builtin_inf(), 3));
+    REQUIRE(parses_f64("-Infinity", -__builtin_inf(), 9));
+    REQUIRE(parses_f64("INFINITE", __builtin_inf(), 3));
+    auto nan = parse_f64(bytes("NaN,")).unwrap();
+    REQUIRE(nan.first != nan.first);
+    REQUIRE(nan.second == 3);
+
+    REQUIRE(fails(parse_f64(bytes("")), ParseError::Empty));
+    REQUIRE(fails(parse_f64(bytes("-")), ParseError::InvalidDigit));
+    REQUIRE(fails(parse_f64(bytes(".")), ParseError::InvalidDigit));
+    REQUIRE(fails(parse_f64(bytes("+.e1")), ParseError::InvalidDigit));
+    REQUIRE(fails(parse_f64(bytes(" 1")), ParseError::InvalidDigit));
+    REQUIRE(fails(parse_f64(bytes("in")), ParseError::InvalidDigit));
+    REQUIRE(fails(parse_f64(bytes("nul")), ParseError::InvalidDigit));
+}
+
+// The exact value of 2^-1075, half way between 0 and the smallest double, without its e-324.
+static char const half_min[] =
+    "2.47032822920623272088284396434110686182529901307162382212792841250337753635104375932649"
+    "9181808179961898982823477228588654633283551779698981993873980053909390631503565951557022"
+    "6392290858392449105184435931802849936536152500319370457678249219365623669863658480757001"
+    "5857692699037063119282795585513329278343384093519780155312465972635795746227664652728272"
+    "2005637400648549997709659947045402082816622623785739345073633900796776193057750674017632"
+    "4673600968951340535537458516661134223766678604162159680461914467291840300530057530849048"
+    "7653917113865916462395249126236538818796362393732804238910186723484976682350898633885879"
+    "2562830275599565752445550725518931369083625477918694866799496832404970582102851318545139"
+    "6213837722826145437693412532098591327667236328125";
+
+// half_min + digits + "e-324", parsed.
+static double half_min_and(char const *const digits)
+{
+    static char buf[sizeof(half_min) + 1024];
+    Index n = 0;
+    for (Index i = 0; half_min[i] != '\0'; ++i) {
+        buf[n++] = half_min[i];
+    }
+    for (Index i = 0; digits[i] != '\0'; ++i) {
+        buf[n++] = digits[i];
+    }
+    for (char const *e = "e-324"; *e != '\0'; ++e) {
+        buf[n++] = *e;
+    }
+    auto const r =
+        parse_f64(Slice<unsigned char const>(reinterpret_cast<unsigned char const *>(buf), n))
+            .unwrap();
+    REQUIRE(r.second == n);
+    return r.first;
+}
+
+TEST_CASE("parse_f64, more digits than fit", "[parse]")
+{
+    double const min = 4.9406564584124654e-324;
+    // exactly half way ties to even (0), any more rounds up, however far along.
+    REQUIRE(same(half_min_and(""), 0.0));
+    REQUIRE(same(half_min_and("000"), 0.0));
+    REQUIRE(same(half_min_and("1"), min));
+    char zeros[1001];
+    for (Index i = 0; i < 999; ++i) {
+        zeros[i] = '0';
+    }
+    zeros[999] = '1';
+    zeros[1000] = '\0';
+    REQUIRE(same(half_min_and(zeros), min));
+    zeros[999] = '0';
+    REQUIRE(same(half_min_and(zeros), 0.0));
+}
+
+TEST_CASE("parse_f64, powers of 10", "[parse]")
+{
+    // 1eK for every K a normal double has, near 10^|K| built up by multiplying.
+    char buf[8];
+    for (int k = -300; k <= 308; k += 1) {
+        int a = (k < 0) ? -k : k;
+        Index n = 0;
+        buf[n++] = '1';
+        buf[n++] = 'e';
+        if (k < 0) { buf[n++] = '-'; }
+        char d[4];
+        Index dn = 0;
+        do {
+            d[dn++] = char('0' + a % 10);
+            a /= 10;
+        } while (a != 0);
+        while (dn > 0) {
+            buf[n++] = d[--dn];
+        }
+        auto const r = parse_f64(Slice<unsigned char const>(
+                                     reinterpret_cast<unsigned char const *>(buf), n))
+                           .unwrap();
+        REQUIRE(r.second == n);
+        // the multiplies round, the exact values are checked against the compiler above.
+        double p = 1.0;
+        for (int i = 0; i < ((k < 0) ? -k : k); ++i) {
+            p *= 10.0;
+        }
+        double const rel = (k < 0) ? r.first * p : r.first / p;
+        REQUIRE(rel > 1.0 - 1e-12);
+        REQUIRE(rel < 1.0 + 1e-12);
+    }
+}
+
+} // namespace parse
+} // namespace test
+} // namespace nel
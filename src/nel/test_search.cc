@@ -0,0 +1,99 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#include <nel/search.hh>
+#include <nel/sort.hh> // Less
+
+#include <catch2/catch.hpp>
+
+namespace nel
+{
+namespace test
+{
+namespace search
+{
+
+// Each search is checked against a linear scan, for every key in and around
+// the values, over lengths either side of powers of 2.
+static constexpr Length max_len = 130;
+
+// 0, 2, 2, 4, 4, 6, ... so there are runs of equal items and gaps between them.
+static void fill(int a[], Length const n)
+{
+    for (Index i = 0; i < n; ++i) {
+        a[i] = int((i + 1) / 2) * 2;
+    }
+}
+
+static Index linear_lower(int const a[], Length const n, int const key)
+{
+    Index i = 0;
+    while (i < n && a[i] < key) {
+        i += 1;
+    }
+    return i;
+}
+
+static Index linear_upper(int const a[], Length const n, int const key)
+{
+    Index i = 0;
+    while (i < n && !(key < a[i])) {
+        i += 1;
+    }
+    return i;
+}
+
+TEST_CASE("search::lower_bound, upper_bound", "[search]")
+{
+    int a[max_len];
+    nel::sort::Less less;
+    bool ok = true;
+    for (Length n = 0; n <= max_len; ++n) {
+        fill(a, n);
+        for (int key = -1; key <= int(n) + 2; ++key) {
+            ok = ok && nel::search::lower_bound(a, n, key, less) == linear_lower(a, n, key);
+            ok = ok && nel::search::upper_bound(a, n, key, less) == linear_upper(a, n, key);
+        }
+    }
+    REQUIRE(ok);
+}
+
+TEST_CASE("search::partition_point", "[search]")
+{
+    int a[] = {1, 3, 5, 7, 2, 4, 6};
+    auto odd = [](int const &v) { return v % 2 == 1; };
+    REQUIRE(nel::search::partition_point(a, 7, odd) == 4);
+    REQUIRE(nel::search::partition_point(a, 4, odd) == 4);
+    REQUIRE(nel::search::partition_point(a + 4, 3, odd) == 0);
+    REQUIRE(nel::search::partition_point(a, 0, odd) == 0);
+}
+
+TEST_CASE("search::eytzinger", "[search]")
+{
+    int sorted[max_len];
+    int layout[max_len];
+    nel::sort::Less less;
+    bool ok = true;
+    for (Length n = 0; n <= max_len; ++n) {
+        fill(sorted, n);
+        nel::search::eytzinger_from(layout, sorted, n);
+        for (int key = -1; key <= int(n) + 2; ++key) {
+            Index const e = nel::search::eytzinger_lower_bound(layout, n, key, less);
+            Index const s = linear_lower(sorted, n, key);
+            // same item, or both none.
+            ok = ok && ((e == n && s == n) || (e < n && s < n && layout[e] == sorted[s]));
+        }
+    }
+    REQUIRE(ok);
+
+    // the root is the middle, then breadth first.
+    int const s7[] = {1, 2, 3, 4, 5, 6, 7};
+    int e7[7];
+    nel::search::eytzinger_from(e7, s7, 7);
+    int const x7[] = {4, 2, 6, 1, 3, 5, 7};
+    for (Index i = 0; i < 7; ++i) {
+        REQUIRE(e7[i] == x7[i]);
+    }
+}
+
+} // namespace search
+} // namespace test
+} // namespace nel
@@ -0,0 +1,288 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#include <nel/simd.hh>
+
+#include <catch2/catch.hpp>
+
+namespace nel
+{
+namespace test
+{
+namespace simd
+{
+
+// Every level the host has, narrowest first.
+// Each reduction is checked at every level against a plain loop,
+// over lengths around the vector widths so the tail handling is exercised.
+static constexpr Length max_len = 80;
+
+template<typename T>
+void fill(T a[], Length const n, int const seed)
+{
+    // small ints, so float sums are exact regardless of order.
+    for (Index i = 0; i < n; ++i) {
+        int const v = int((i * 37 + Index(seed) * 11) % 101) - 50;
+        a[i] = (T(-1) < T(0)) ? T(v) : T(v + 50);
+    }
+}
+
+template<typename T>
+void check_all_levels(void)
+{
+    typedef typename nel::simd::Reduce<T>::Acc Acc;
+    T a[max_len];
+    T b[max_len];
+    fill(a, max_len, 1);
+    fill(b, max_len, 2);
+
+    nel::simd::Level const top = nel::simd::max_level();
+    for (int l = int(nel::simd::Level::SCALAR); l <= int(top); ++l) {
+        REQUIRE(nel::simd::set_level(nel::simd::Level(l)) == nel::simd::Level(l));
+        for (Length n = 0; n <= max_len; ++n) {
+            Acc s = 0;
+            Acc d = 0;
+            for (Index i = 0; i < n; ++i) {
+                s += Acc(a[i]);
+                d += Acc(a[i]) * Acc(b[i]);
+            }
+            REQUIRE(nel::simd::sum(a, n) == s);
+            REQUIRE(nel::simd::dot(a, b, n) == d);
+            if (n == 0) { continue; }
+
+            T mn = a[0];
+            T mx = a[0];
+            for (Index i = 1; i < n; ++i) {
+                mn = (a[i] < mn) ? a[i] : mn;
+                mx = (a[i] > mx) ? a[i] : mx;
+            }
+            REQUIRE(nel::simd::min(a, n) == mn);
+            REQUIRE(nel::simd::max(a, n) == mx);
+            T rmn = 0;
+            T rmx = 0;
+            nel::simd::min_max(a, n, rmn, rmx);
+            REQUIRE(rmn == mn);
+            REQUIRE(rmx == mx);
+        }
+    }
+    nel::simd::set_level(top);
+}
+
+TEST_CASE("simd::level", "[simd]")
+{
+    nel::simd::Level const top = nel::simd::max_level();
+    REQUIRE(nel::simd::level() == top);
+
+    REQUIRE(nel::simd::set_level(nel::simd::Level::SCALAR) == nel::simd::Level::SCALAR);
+    REQUIRE(nel::simd::level() == nel::simd::Level::SCALAR);
+
+    // clamped to what the host has.
+    REQUIRE(nel::simd::set_level(nel::simd::Level::AVX2) == top);
+    REQUIRE(nel::simd::level() == top);
+}
+
+TEST_CASE("simd::reductions, all levels", "[simd]")
+{
+    check_all_levels<int>();
+    check_all_levels<unsigned int>();
+    check_all_levels<long>();
+    check_all_levels<long unsigned int>();
+    check_all_levels<long long>();
+    check_all_levels<long long unsigned int>();
+    check_all_levels<float>();
+    check_all_levels<double>();
+}
+
+TEST_CASE("simd::sum, 32bit does not overflow", "[simd]")
+{
+    int a[max_len];
+    for (Index i = 0; i < max_len; ++i) {
+        a[i] = 0x7fffffff;
+    }
+    REQUIRE(nel::simd::sum(a, max_len) == 0x7fffffffLL * max_len);
+}
+
+TEST_CASE("simd::min,max, extremes at the ends", "[simd]")
+{
+    int a[max_len];
+    for (Index i = 0; i < max_len; ++i) {
+        a[i] = 0;
+    }
+    // in the scalar tail.
+    a[max_len - 1] = -5;
+    a[max_len - 2] = 5;
+    REQUIRE(nel::simd::min(a, max_len) == -5);
+    REQUIRE(nel::simd::max(a, max_len) == 5);
+    // in the first vector.
+    a[0] = -6;
+    a[1] = 6;
+    REQUIRE(nel::simd::min(a, max_len) == -6);
+    REQUIRE(nel::simd::max(a, max_len) == 6);
+}
+
+TEST_CASE("simd::count_if", "[simd]")
+{
+    int a[max_len];
+    fill(a, max_len, 3);
+    Count n = 0;
+    for (Index i = 0; i < max_len; ++i) {
+        n += (a[i] > 0) ? 1 : 0;
+    }
+    REQUIRE(nel::simd::count_if(a, max_len, [](int const &v) { return v > 0; }) == n);
+    REQUIRE(nel::simd::count_if(a, 0, [](int const &) { return true; }) == 0);
+}
+
+// find, rfind and count checked at every level against plain loops,
+// with matches at every position (head, in a vector, in the tail) and none.
+template<typename T>
+void check_search_all_levels(void)
+{
+    T a[max_len];
+    T const v = T(-3);
+
+    nel::simd::Level const top = nel::simd::max_level();
+    for (int l = int(nel::simd::Level::SCALAR); l <= int(top); ++l) {
+        REQUIRE(nel::simd::set_level(nel::simd::Level(l)) == nel::simd::Level(l));
+        bool ok = true;
+        for (Length n = 0; n <= max_len; ++n) {
+            fill(a, n, 1);
+            for (Index i = 0; i < n; ++i) {
+                a[i] = (a[i] == v) ? T(0) : a[i];
+            }
+            ok = ok && nel::simd::find(a, n, v) == n;
+            ok = ok && nel::simd::rfind(a, n, v) == n;
+            ok = ok && nel::simd::count(a, n, v) == 0;
+            // a match at j, and another at k >= j.
+            for (Index j = 0; j < n; ++j) {
+                for (Index k = j; k < n; k += 7) {
+                    T const aj = a[j];
+                    T const ak = a[k];
+                    a[j] = v;
+                    a[k] = v;
+                    ok = ok && nel::simd::find(a, n, v) == j;
+                    ok = ok && nel::simd::rfind(a, n, v) == k;
+                    ok = ok && nel::simd::count(a, n, v) == ((j == k) ? 1 : 2);
+                    a[k] = ak;
+                    a[j] = aj;
+                }
+            }
+        }
+        REQUIRE(ok);
+    }
+    nel::simd::set_level(top);
+}
+
+TEST_CASE("simd::find,rfind,count, all levels", "[simd]")
+{
+    check_search_all_levels<char>();
+    check_search_all_levels<signed char>();
+    check_search_all_levels<unsigned char>();
+    check_search_all_levels<short>();
+    check_search_all_levels<short unsigned int>();
+    check_search_all_levels<int>();
+    check_search_all_levels<unsigned int>();
+    check_search_all_levels<long>();
+    check_search_all_levels<long unsigned int>();
+    check_search_all_levels<long long>();
+    check_search_all_levels<long long unsigned int>();
+    // not searchable by bits, so a loop using ==.
+    check_search_all_levels<float>();
+}
+
+TEST_CASE("simd::count, more matches than a lane can count", "[simd]")
+{
+    // byte lanes count up to 255, so long runs of matches must be flushed as they go.
+    static unsigned char a[64 * 1024 + 5];
+    Length const n = sizeof(a);
+    for (Index i = 0; i < n; ++i) {
+        a[i] = 0xff;
+    }
+    nel::simd::Level const top = nel::simd::max_level();
+    for (int l = int(nel::simd::Level::SCALAR); l <= int(top); ++l) {
+        nel::simd::set_level(nel::simd::Level(l));
+        REQUIRE(nel::simd::count(a, n, (unsigned char)0xff) == n);
+        REQUIRE(nel::simd::find(a, n, (unsigned char)0xff) == 0);
+        REQUIRE(nel::simd::rfind(a, n, (unsigned char)0xff) == n - 1);
+    }
+    nel::simd::set_level(top);
+}
+
+static Index naive_find_sub(unsigned char const h[], Length const n, unsigned char const nd[],
+                            Length const m)
+{
+    for (Index i = 0; i + m <= n; ++i) {
+        Index k = 0;
+        while (k < m && h[i + k] == nd[k]) {
+            k += 1;
+        }
+        if (k == m) { return i; }
+    }
+    return n;
+}
+
+TEST_CASE("simd::find_sub, all levels", "[simd]")
+{
+    // haystacks of a's and b's, so many partial matches, and periodic needles,
+    // so the vector filter gives up part way and Two-Way finishes.
+    static constexpr Length hn = 300;
+    unsigned char h[hn];
+    unsigned char nd[72];
+    unsigned int seed = 1;
+    auto next = [&seed]() -> unsigned int {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) & 0x7fff;
+    };
+
+    nel::simd::Level const top = nel::simd::max_level();
+    for (int l = int(nel::simd::Level::SCALAR); l <= int(top); ++l) {
+        REQUIRE(nel::simd::set_level(nel::simd::Level(l)) == nel::simd::Level(l));
+        bool ok = true;
+        for (int r = 0; r < 400; ++r) {
+            // mostly a's, or a random mix.
+            unsigned int const pb = (r % 2 == 0) ? 8 : 50;
+            Length const n = next() % hn;
+            for (Index i = 0; i < n; ++i) {
+                h[i] = (next() % 100 < pb) ? 'b' : 'a';
+            }
+            Length const m = 1 + next() % sizeof(nd);
+            // a copy of part of h (so found), or random (likely not).
+            if (r % 3 != 0 && m <= n) {
+                Index const at = next() % (n - m + 1);
+                for (Index k = 0; k < m; ++k) {
+                    nd[k] = h[at + k];
+                }
+            } else {
+                for (Index k = 0; k < m; ++k) {
+                    nd[k] = (next() % 100 < pb) ? 'b' : 'a';
+                }
+            }
+            ok = ok && nel::simd::find_sub(h, n, nd, m) == naive_find_sub(h, n, nd, m);
+        }
+        REQUIRE(ok);
+
+        // the worst case for naive search: a^n vs a^(m-1)b, and found at the very end.
+        for (Index i = 0; i < hn; ++i) {
+            h[i] = 'a';
+        }
+        for (Length m = 2; m <= sizeof(nd); m += 3) {
+            for (Index k = 0; k < m; ++k) {
+                nd[k] = 'a';
+            }
+            nd[m - 1] = 'b';
+            REQUIRE(nel::simd::find_sub(h, hn, nd, m) == hn);
+            h[hn - 1] = 'b';
+            REQUIRE(nel::simd::find_sub(h, hn, nd, m) == hn - m);
+            h[hn - 1] = 'a';
+        }
+    }
+    nel::simd::set_level(top);
+
+    // other types, a loop.
+    int const hi[] = {1, 2, 1, 2, 3};
+    int const ni[] = {1, 2, 3};
+    REQUIRE(nel::simd::find_sub(hi, 5, ni, 3) == 2);
+    REQUIRE(nel::simd::find_sub(hi, 5, ni + 2, 1) == 4);
+    REQUIRE(nel::simd::find_sub(hi, 2, ni, 3) == 2);
+}
+
+} // namespace simd
+} // namespace test
+} // namespace nel
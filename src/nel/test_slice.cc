@@ -177,6 +177,17 @@ TEST_CASE("Slice::empty()", "[slice]")
     }
 }
 
+TEST_CASE("Slice<T const>::from(Slice<T>)", "[slice]")
+{
+    // a mutable slice can be used as a const one.
+    int a1[] {1, 2, 3};
+    Slice<int> s1(a1, 3);
+    Slice<int const> s2 = s1;
+    REQUIRE(s2.len() == 3);
+    REQUIRE(s2.ptr() == a1);
+    REQUIRE(s2[2] == 3);
+}
+
 TEST_CASE("Slice::from(ptr,len)", "[slice]")
 {
     {
@@ -1284,6 +1295,595 @@ TEST_CASE("Slice::copy_from(src)", "[slice]")
     // }
 }
 
+TEST_CASE("Slice::copy_from_streaming,move_from_streaming,fill_streaming", "[slice]")
+{
+    // every alignment of the destination, lengths either side of the streaming minimum
+    // and of whole lines, with guard bytes either side that must be left alone.
+    static uint8_t src[4200];
+    static uint8_t dst[4200 + 32];
+    for (Index i = 0; i < sizeof(src); ++i) {
+        src[i] = uint8_t(i * 7 + 3);
+    }
+    Length const lens[] = {0, 1, 15, 16, 17, 255, 256, 257, 300, 1000, 4099, 4160};
+    for (Index off = 0; off < 16; ++off) {
+        for (Length const n: lens) {
+            Slice<uint8_t>(dst, sizeof(dst)).fill(0xee);
+            auto d = Slice<uint8_t>(dst + off, n);
+            d.copy_from_streaming(Slice<uint8_t>(src + 1, n));
+            REQUIRE(d == Slice<uint8_t>(src + 1, n));
+            REQUIRE(dst[off + n] == 0xee);
+            if (off > 0) { REQUIRE(dst[off - 1] == 0xee); }
+
+            d.fill_streaming(0x5a);
+            REQUIRE(d.count(0x5a) == n);
+            REQUIRE(dst[off + n] == 0xee);
+            if (off > 0) { REQUIRE(dst[off - 1] == 0xee); }
+        }
+    }
+
+    // wider values keep their order whatever the alignment of the start.
+    static unsigned int ints[1100];
+    for (Index off = 0; off < 4; ++off) {
+        auto s1 = Slice<unsigned int>(ints + off, 1000);
+        s1.fill_streaming(0x01020304U);
+        REQUIRE(s1.count(0x01020304U) == 1000);
+        s1.fill(7);
+        unsigned int a2[1000];
+        auto s2 = Slice<unsigned int>(a2, 1000);
+        s2.fill(9);
+        s1.move_from_streaming(s2);
+        REQUIRE(s1.count(9U) == 1000);
+    }
+
+    {
+        // not trivially copyable, normal copies.
+        Stub a1[] = {Stub(2), Stub(3), Stub(4)};
+        Stub a2[] = {Stub(5), Stub(6), Stub(7)};
+        auto s1 = Slice(a1, 3);
+        s1.copy_from_streaming(Slice(a2, 3));
+        REQUIRE(a1[0] == Stub(5));
+        REQUIRE(a1[2] == Stub(7));
+        s1.fill_streaming(Stub(1));
+        REQUIRE(a1[1] == Stub(1));
+    }
+}
+
+TEST_CASE("Slice::chunks", "[slice]")
+{
+    int a[] = {0, 1, 2, 3, 4, 5, 6};
+    auto s1 = Slice<int>(a, 7);
+    {
+        Count n = 0;
+        Length last_len = 0;
+        int sum = 0;
+        s1.chunks(3).for_each([&](Slice<int> c) {
+            // refers to, not copies, the items.
+            REQUIRE(c.ptr() == &a[n * 3]);
+            last_len = c.len();
+            c.iter().for_each([&sum](int &e) { sum += e; });
+            n += 1;
+        });
+        REQUIRE(n == 3);
+        REQUIRE(last_len == 1);
+        REQUIRE(sum == 21);
+        REQUIRE(s1.chunks(3).size_hint().lower == 3);
+    }
+    {
+        // exact multiple, no short last chunk.
+        Count n = 0;
+        s1.slice(0, 6).chunks(2).for_each([&n](Slice<int> c) {
+            REQUIRE(c.len() == 2);
+            n += 1;
+        });
+        REQUIRE(n == 3);
+    }
+    {
+        REQUIRE(Slice<int>::empty().chunks(2).size_hint().lower == 0);
+        REQUIRE(s1.chunks(100).size_hint().lower == 1);
+    }
+}
+
+TEST_CASE("Slice::chunks_exact", "[slice]")
+{
+    int a[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    auto s1 = Slice<int>(a, 10);
+    {
+        int sums[2] = {0, 0};
+        Count n = 0;
+        auto it = s1.chunks_exact<4>();
+        REQUIRE(it.size_hint().lower == 2);
+        it.for_each([&](int(&c)[4]) {
+            for (int const &e: c) {
+                sums[n] += e;
+            }
+            n += 1;
+        });
+        REQUIRE(n == 2);
+        REQUIRE(sums[0] == 0 + 1 + 2 + 3);
+        REQUIRE(sums[1] == 4 + 5 + 6 + 7);
+    }
+    {
+        // remainder is what's left after the whole blocks.
+        auto it = s1.chunks_exact<4>();
+        REQUIRE(it.remainder().len() == 2);
+        REQUIRE(it.remainder().ptr() == &a[8]);
+        REQUIRE(s1.chunks_exact<5>().remainder().is_empty());
+        REQUIRE(s1.chunks_exact<20>().size_hint().lower == 0);
+        REQUIRE(s1.chunks_exact<20>().remainder().len() == 10);
+    }
+    {
+        // blocks refer to the slice's items.
+        s1.chunks_exact<5>().for_each([](int(&c)[5]) { c[0] = -1; });
+        REQUIRE(a[0] == -1);
+        REQUIRE(a[5] == -1);
+    }
+}
+
+TEST_CASE("Slice::windows", "[slice]")
+{
+    int a[] = {1, 2, 3, 4, 5};
+    auto s1 = Slice<int>(a, 5);
+    {
+        Count n = 0;
+        s1.windows(3).for_each([&](Slice<int> w) {
+            REQUIRE(w.len() == 3);
+            REQUIRE(w.ptr() == &a[n]);
+            n += 1;
+        });
+        REQUIRE(n == 3);
+        REQUIRE(s1.windows(3).size_hint().lower == 3);
+    }
+    {
+        REQUIRE(s1.windows(5).size_hint().lower == 1);
+        REQUIRE(s1.windows(6).size_hint().lower == 0);
+        Count n = 0;
+        s1.windows(6).for_each([&n](Slice<int>) { n += 1; });
+        REQUIRE(n == 0);
+    }
+}
+
+TEST_CASE("Slice::sum", "[slice]")
+{
+    int a[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    REQUIRE(Slice<int>(a, 11).sum() == 66);
+    REQUIRE(Slice<int const>(a, 3).sum() == 6);
+    REQUIRE(Slice<int>::empty().sum() == 0);
+
+    // no overflow of 32bit values.
+    unsigned int const b[] = {0xffffffffU, 0xffffffffU};
+    REQUIRE(Slice<unsigned int const>(b, 2).sum() == 0x1fffffffeULL);
+
+    double const c[] = {0.5, 1.5, 2.0};
+    REQUIRE(Slice<double const>(c, 3).sum() == 4.0);
+}
+
+TEST_CASE("Slice::min,max,min_max", "[slice]")
+{
+    int a[] = {5, -3, 9, 2, 7, -8, 4, 1, 0, 6};
+    auto s1 = Slice<int>(a, 10);
+    REQUIRE(s1.min() == Some(-8));
+    REQUIRE(s1.max() == Some(9));
+    auto mm = s1.min_max().unwrap();
+    REQUIRE(mm.first == -8);
+    REQUIRE(mm.second == 9);
+
+    REQUIRE(Slice<int>::empty().min().is_none());
+    REQUIRE(Slice<int>::empty().max().is_none());
+    REQUIRE(Slice<int>::empty().min_max().is_none());
+
+    float const f[] = {2.5f};
+    REQUIRE(Slice<float const>(f, 1).min() == Some(2.5f));
+}
+
+TEST_CASE("Slice::dot", "[slice]")
+{
+    int a[] = {1, 2, 3, 4};
+    int const b[] = {4, 3, 2, 1, 100};
+    REQUIRE(Slice<int>(a, 4).dot(Slice<int const>(b, 4)) == 20);
+    // shortest wins.
+    REQUIRE(Slice<int>(a, 4).dot(Slice<int const>(b, 5)) == 20);
+    REQUIRE(Slice<int>(a, 2).dot(Slice<int const>(b, 5)) == 10);
+    REQUIRE(Slice<int>::empty().dot(Slice<int const>(b, 5)) == 0);
+}
+
+TEST_CASE("Slice::count_if", "[slice]")
+{
+    int a[] = {1, 2, 3, 4, 5, 6, 7};
+    auto s1 = Slice<int>(a, 7);
+    REQUIRE(s1.count_if([](int const &v) { return v % 2 == 0; }) == 3);
+    REQUIRE(s1.count_if([](int const &v) { return v > 10; }) == 0);
+    REQUIRE(Slice<int>::empty().count_if([](int const &) { return true; }) == 0);
+
+    // for any type, not just numeric.
+    Stub s[] = {Stub(1), Stub(2)};
+    REQUIRE(Slice<Stub>(s, 2).count_if([](Stub const &v) { return v.val == 2; }) == 1);
+}
+
+TEST_CASE("Slice::sort_unstable", "[slice]")
+{
+    int a[] = {5, 3, 9, 1, 3, 7};
+    auto s1 = Slice<int>(a, 6);
+    s1.sort_unstable();
+    int e1[] = {1, 3, 3, 5, 7, 9};
+    REQUIRE(s1 == Slice<int>(e1, 6));
+
+    // any comparator.
+    s1.sort_unstable([](int const &x, int const &y) { return x > y; });
+    int e2[] = {9, 7, 5, 3, 3, 1};
+    REQUIRE(s1 == Slice<int>(e2, 6));
+
+    Slice<int>::empty().sort_unstable();
+}
+
+TEST_CASE("Slice::sort", "[slice]")
+{
+    // by val, so equal vals show their order by position in the original.
+    Stub a[] = {Stub(3), Stub(1), Stub(3), Stub(2), Stub(1)};
+    Stub *const p[] = {&a[0], &a[1], &a[2], &a[3], &a[4]};
+    Stub *q[] = {p[0], p[1], p[2], p[3], p[4]};
+    auto by_val = [](Stub *const &x, Stub *const &y) { return x->val < y->val; };
+
+    auto s1 = Slice<Stub *>(q, 5);
+    s1.sort(by_val);
+    REQUIRE(q[0] == p[1]);
+    REQUIRE(q[1] == p[4]);
+    REQUIRE(q[2] == p[3]);
+    REQUIRE(q[3] == p[0]);
+    REQUIRE(q[4] == p[2]);
+
+    // and with scratch.
+    Stub *r[] = {p[4], p[3], p[2], p[1], p[0]};
+    Stub *b[3] = {};
+    Slice<Stub *>(r, 5).sort_with(Slice<Stub *>(b, 3), by_val);
+    REQUIRE(r[0] == p[4]);
+    REQUIRE(r[1] == p[1]);
+    REQUIRE(r[2] == p[3]);
+    REQUIRE(r[3] == p[2]);
+    REQUIRE(r[4] == p[0]);
+}
+
+TEST_CASE("Slice::select_nth_unstable", "[slice]")
+{
+    int a[] = {50, 10, 40, 30, 20};
+    auto s1 = Slice<int>(a, 5);
+    REQUIRE(s1.select_nth_unstable(2) == 30);
+    REQUIRE(a[2] == 30);
+    REQUIRE((a[0] < 30 && a[1] < 30));
+    REQUIRE((a[3] > 30 && a[4] > 30));
+
+    // the largest, by a comparator.
+    REQUIRE(s1.select_nth_unstable(0, [](int const &x, int const &y) { return x > y; }) == 50);
+
+    // must not be able to select outside of bounds of slice.
+    // wants panic detection.
+    // s1.select_nth_unstable(5);
+}
+
+TEST_CASE("Slice::partial_sort", "[slice]")
+{
+    int a[] = {8, 3, 9, 1, 7, 2, 6};
+    auto s1 = Slice<int>(a, 7);
+    s1.partial_sort(3);
+    REQUIRE(a[0] == 1);
+    REQUIRE(a[1] == 2);
+    REQUIRE(a[2] == 3);
+    REQUIRE(s1.slice(3, 7).min().unwrap() == 6);
+
+    // k past the end sorts all.
+    s1.partial_sort(10);
+    int e1[] = {1, 2, 3, 6, 7, 8, 9};
+    REQUIRE(s1 == Slice<int>(e1, 7));
+
+    s1.partial_sort(0);
+    REQUIRE(s1 == Slice<int>(e1, 7));
+}
+
+TEST_CASE("Slice::binary_search", "[slice]")
+{
+    int a[] = {1, 3, 3, 3, 5, 8};
+    auto s1 = Slice<int const>(a, 6);
+
+    auto r1 = s1.binary_search(5);
+    REQUIRE(r1.is_ok());
+    REQUIRE(r1.unwrap() == 4);
+
+    // any of the equal ones.
+    Index const i3 = s1.binary_search(3).unwrap();
+    REQUIRE((i3 >= 1 && i3 <= 3));
+
+    // where it would go.
+    REQUIRE(s1.binary_search(4).unwrap_err() == 4);
+    REQUIRE(s1.binary_search(0).unwrap_err() == 0);
+    REQUIRE(s1.binary_search(9).unwrap_err() == 6);
+    REQUIRE(Slice<int const>::empty().binary_search(1).unwrap_err() == 0);
+
+    // sorted by another comparator.
+    int b[] = {8, 5, 3, 1};
+    auto gt = [](int const &x, int const &y) { return x > y; };
+    REQUIRE(Slice<int>(b, 4).binary_search(3, gt).unwrap() == 2);
+    REQUIRE(Slice<int>(b, 4).binary_search(4, gt).unwrap_err() == 2);
+}
+
+TEST_CASE("Slice::lower_bound,upper_bound,partition_point", "[slice]")
+{
+    int a[] = {1, 3, 3, 3, 5, 8};
+    auto s1 = Slice<int>(a, 6);
+    REQUIRE(s1.lower_bound(3) == 1);
+    REQUIRE(s1.upper_bound(3) == 4);
+    REQUIRE(s1.lower_bound(4) == 4);
+    REQUIRE(s1.upper_bound(4) == 4);
+    REQUIRE(s1.lower_bound(9) == 6);
+    REQUIRE(s1.upper_bound(0) == 0);
+    REQUIRE(s1.partition_point([](int const &v) { return v < 5; }) == 4);
+    REQUIRE(Slice<int>::empty().partition_point([](int const &) { return true; }) == 0);
+}
+
+TEST_CASE("Slice::find,rfind,contains,count", "[slice]")
+{
+    char const a[] = "GET /a/b HTTP/1.1\r\nHost: x\r\n\r\n";
+    auto s1 = Slice<char const>(a, sizeof(a) - 1);
+    REQUIRE(s1.find('/').unwrap() == 4);
+    REQUIRE(s1.rfind('/').unwrap() == 13);
+    REQUIRE(s1.find('\n').unwrap() == 18);
+    REQUIRE(s1.rfind('\n').unwrap() == s1.len() - 1);
+    REQUIRE(s1.find('#').is_none());
+    REQUIRE(s1.rfind('#').is_none());
+    REQUIRE(s1.contains('H'));
+    REQUIRE(!s1.contains('#'));
+    REQUIRE(s1.count('\r') == 3);
+    REQUIRE(s1.count('#') == 0);
+
+    long long unsigned int b[] = {7, 1, 7, 2, 7};
+    auto s2 = Slice<long long unsigned int>(b, 5);
+    REQUIRE(s2.find(7).unwrap() == 0);
+    REQUIRE(s2.rfind(7).unwrap() == 4);
+    REQUIRE(s2.count(7) == 3);
+    REQUIRE(s2.find(3).is_none());
+
+    auto s3 = Slice<int>::empty();
+    REQUIRE(s3.find(0).is_none());
+    REQUIRE(s3.rfind(0).is_none());
+    REQUIRE(!s3.contains(0));
+    REQUIRE(s3.count(0) == 0);
+}
+
+TEST_CASE("Slice::find, not searchable by bits", "[slice]")
+{
+    // items with only an ==, searched with a loop.
+    Stub a1[] {Stub(1), Stub(2), Stub(3), Stub(2)};
+    auto s1 = Slice<Stub>(a1, 4);
+    REQUIRE(s1.find(Stub(2)).unwrap() == 1);
+    REQUIRE(s1.rfind(Stub(2)).unwrap() == 3);
+    REQUIRE(s1.count(Stub(2)) == 2);
+    REQUIRE(!s1.contains(Stub(4)));
+
+    // floats compare by value, -0.0 == 0.0.
+    float f[] = {1.0f, -0.0f, 2.0f};
+    REQUIRE(Slice<float>(f, 3).find(0.0f).unwrap() == 1);
+}
+
+TEST_CASE("Slice::position,rposition", "[slice]")
+{
+    int a[] = {1, 4, 5, 8, 9};
+    auto s1 = Slice<int>(a, 5);
+    auto even = [](int const &v) { return v % 2 == 0; };
+    REQUIRE(s1.position(even).unwrap() == 1);
+    REQUIRE(s1.rposition(even).unwrap() == 3);
+    REQUIRE(s1.position([](int const &v) { return v > 10; }).is_none());
+    REQUIRE(s1.rposition([](int const &v) { return v > 10; }).is_none());
+    REQUIRE(Slice<int>::empty().position(even).is_none());
+    REQUIRE(Slice<int>::empty().rposition(even).is_none());
+}
+
+// A byte slice of a string literal, without its terminating 0.
+template<Length const N>
+static Slice<uint8_t const> bytes(char const (&s)[N])
+{
+    return Slice<uint8_t const>(reinterpret_cast<uint8_t const *>(s), N - 1);
+}
+
+TEST_CASE("Slice::find_subslice", "[slice]")
+{
+    auto s1 = bytes("rec one\x1e\x1erec two\x1e\x1erec three");
+    REQUIRE(s1.find_subslice(bytes("\x1e\x1e")).unwrap() == 7);
+    REQUIRE(s1.find_subslice(bytes("rec")).unwrap() == 0);
+    REQUIRE(s1.find_subslice(bytes("three")).unwrap() == s1.len() - 5);
+    REQUIRE(s1.find_subslice(bytes("four")).is_none());
+    REQUIRE(s1.find_subslice(bytes("e")).unwrap() == 1);
+    // empty needle is found at the start, a longer one never.
+    REQUIRE(s1.find_subslice(bytes("")).unwrap() == 0);
+    REQUIRE(bytes("ab").find_subslice(bytes("abc")).is_none());
+    REQUIRE(Slice<uint8_t const>::empty().find_subslice(bytes("a")).is_none());
+
+    // long needles, found with Two-Way, in 50 x's, y, --, 46 x's, y.
+    uint8_t h[100];
+    uint8_t n1[41];
+    Slice<uint8_t>(h, 100).fill('x');
+    Slice<uint8_t>(n1, 41).fill('x');
+    h[50] = 'y';
+    h[51] = '-';
+    h[52] = '-';
+    h[99] = 'y';
+    n1[40] = 'y';
+    auto s2 = Slice<uint8_t const>(h, 100);
+    REQUIRE(s2.find_subslice(Slice<uint8_t const>(n1, 41)).unwrap() == 10);
+    REQUIRE(s2.find_subslice(Slice<uint8_t const>(h + 52, 48)).unwrap() == 52);
+    n1[0] = '-';
+    REQUIRE(s2.find_subslice(Slice<uint8_t const>(n1, 41)).is_none());
+    REQUIRE(s2.find_subslice(Slice<uint8_t const>(h, 51)).unwrap() == 0);
+
+    // not bytes, items compared by ==.
+    int a[] = {1, 2, 1, 2, 3};
+    int n[] = {2, 3};
+    REQUIRE(Slice<int>(a, 5).find_subslice(Slice<int>(n, 2)).unwrap() == 3);
+}
+
+static Count n_pieces(Slice<uint8_t const> const &s, Slice<uint8_t const> const &sep)
+{
+    return s.split(sep).fold(Count(0), [](Count &acc, Slice<uint8_t const>) { acc += 1; });
+}
+
+TEST_CASE("Slice::split", "[slice]")
+{
+    auto sep = bytes("::");
+    {
+        auto s1 = bytes("a::bc::::d::");
+        Slice<uint8_t const> const e1[] = {bytes("a"), bytes("bc"), bytes(""), bytes("d"),
+                                           bytes("")};
+        Count n = 0;
+        s1.split(sep).for_each([&](Slice<uint8_t const> p) {
+            REQUIRE(n < 5);
+            REQUIRE(p == e1[n]);
+            n += 1;
+        });
+        REQUIRE(n == 5);
+        // pieces are views of the original.
+        REQUIRE(s1.split(sep).first_n(2).fold(Count(0), [&s1](Count &acc, Slice<uint8_t const> p) {
+            acc += Count(p.ptr() - s1.ptr());
+        }) == 3);
+    }
+    {
+        // no needle, one piece: all of it.
+        Count n = 0;
+        bytes("abc").split(sep).for_each([&n](Slice<uint8_t const> p) {
+            REQUIRE(p == bytes("abc"));
+            n += 1;
+        });
+        REQUIRE(n == 1);
+        REQUIRE(n_pieces(Slice<uint8_t const>::empty(), sep) == 1);
+        REQUIRE(n_pieces(bytes("::"), sep) == 2);
+        REQUIRE(n_pieces(bytes(":::"), sep) == 2);
+    }
+    {
+        auto h = bytes("a::b");
+        auto it = h.split(sep);
+        REQUIRE(it.size_hint().lower == 1);
+        REQUIRE(it.size_hint().upper == 3);
+    }
+#if defined(RUST_LIKE)
+    {
+        auto it = bytes("x::y").split(sep);
+        REQUIRE(it.next().unwrap() == bytes("x"));
+        REQUIRE(it.next().unwrap() == bytes("y"));
+        REQUIRE(it.next().is_none());
+    }
+#endif
+}
+
+// The sub-slices an iterator gives, checked against the expected strings.
+template<typename It, Length const N>
+static bool yields(It &&it, char const *const (&e)[N])
+{
+    Index n = 0;
+    bool ok = true;
+    it.for_each([&](Slice<uint8_t const> p) {
+        if (n < N) {
+            Length el = 0;
+            while (e[n][el] != '\0') {
+                el += 1;
+            }
+            ok = ok && p == Slice<uint8_t const>(reinterpret_cast<uint8_t const *>(e[n]), el);
+        }
+        n += 1;
+    });
+    return ok && n == N;
+}
+
+TEST_CASE("Slice::split(item),split_if", "[slice]")
+{
+    char const *const e1[] = {"a", "bc", "", "d", ""};
+    REQUIRE(yields(bytes("a,bc,,d,").split(','), e1));
+    char const *const e2[] = {""};
+    REQUIRE(yields(Slice<uint8_t const>::empty().split(','), e2));
+    char const *const e3[] = {"abc"};
+    REQUIRE(yields(bytes("abc").split(','), e3));
+
+    // any of several separators.
+    char const *const e4[] = {"k", "v", "k2", "v2"};
+    auto is_sep = [](uint8_t const &c) { return c == '=' || c == ';'; };
+    REQUIRE(yields(bytes("k=v;k2=v2").split_if(is_sep), e4));
+
+    // views, not copies.
+    auto s1 = bytes("ab,cd");
+    auto it = s1.split(',');
+    it.inc();
+    REQUIRE(it.deref().ptr() == s1.ptr() + 3);
+
+    // not bytes.
+    int a[] = {1, 0, 2, 3, 0};
+    Count n = 0;
+    Slice<int>(a, 5).split(0).for_each([&n](Slice<int> p) { n += p.len(); });
+    REQUIRE(n == 3);
+}
+
+TEST_CASE("Slice::lines", "[slice]")
+{
+    char const *const e1[] = {"one", "two", "", "three"};
+    REQUIRE(yields(bytes("one\ntwo\r\n\nthree").lines(), e1));
+    REQUIRE(yields(bytes("one\ntwo\r\n\nthree\n").lines(), e1));
+    REQUIRE(yields(bytes("one\ntwo\r\n\nthree\r\n").lines(), e1));
+    char const *const e2[] = {""};
+    REQUIRE(yields(bytes("\n").lines(), e2));
+    REQUIRE(yields(bytes("\r\n").lines(), e2));
+    char const *const e3[] = {"a\rb"};
+    REQUIRE(yields(bytes("a\rb").lines(), e3));
+    char const *const e4[] = {"abc\r"};
+    REQUIRE(yields(bytes("abc\r").lines(), e4));
+    char const *const e5[] = {"a", "b\r"};
+    REQUIRE(yields(bytes("a\r\nb\r").lines(), e5));
+    REQUIRE(Slice<uint8_t const>::empty().lines().size_hint().upper == 0);
+    REQUIRE(Slice<char const>("x\n", 2).lines().size_hint().lower == 1);
+}
+
+TEST_CASE("Slice::split_whitespace", "[slice]")
+{
+    char const *const e1[] = {"GET", "/x", "HTTP/1.1"};
+    REQUIRE(yields(bytes("GET /x  HTTP/1.1").split_whitespace(), e1));
+    REQUIRE(yields(bytes("\t GET\r\n/x \v\fHTTP/1.1 \n").split_whitespace(), e1));
+    char const *const e2[] = {"a"};
+    REQUIRE(yields(bytes("a").split_whitespace(), e2));
+    REQUIRE(bytes(" \t\r\n ").split_whitespace().size_hint().upper == 0);
+    REQUIRE(Slice<uint8_t const>::empty().split_whitespace().size_hint().upper == 0);
+#if defined(RUST_LIKE)
+    {
+        auto it = bytes(" a\nbc ").split_whitespace();
+        REQUIRE(it.next().unwrap() == bytes("a"));
+        REQUIRE(it.next().unwrap() == bytes("bc"));
+        REQUIRE(it.next().is_none());
+        auto it2 = bytes("a\r\n\n").lines();
+        REQUIRE(it2.next().unwrap() == bytes("a"));
+        REQUIRE(it2.next().unwrap() == bytes(""));
+        REQUIRE(it2.next().is_none());
+    }
+#endif
+}
+
+TEST_CASE("Slice::lines,split, telemetry", "[slice]")
+{
+    // sum the 3rd field of each line, without copying any of it.
+    auto t = bytes("id,name,value\n1,a,10\r\n2,b,20\n3,c,12\n");
+    auto field = [](Slice<uint8_t const> line, Index k) -> Slice<uint8_t const> {
+        auto it = line.split(',');
+        for (Index i = 0; i < k; ++i) {
+            it.inc();
+        }
+        return it.deref();
+    };
+    auto to_int = [](Slice<uint8_t const> f) -> int {
+        int v = 0;
+        f.iter().for_each([&v](uint8_t const &c) { v = v * 10 + (c - '0'); });
+        return v;
+    };
+    int const total = t.lines()
+                          .skip(1)
+                          .map<int>([&](Slice<uint8_t const> l) { return to_int(field(l, 2)); })
+                          .fold(0, [](int &acc, int v) { acc += v; });
+    REQUIRE(total == 42);
+    REQUIRE(t.lines().first_n(2).fold(Count(0), [](Count &acc, Slice<uint8_t const>) {
+        acc += 1;
+    }) == 2);
+}
+
 } // namespace slice
 } // namespace test
 } // namespace nel
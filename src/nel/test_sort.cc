@@ -0,0 +1,228 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#include <nel/sort.hh>
+#include <nel/slice.hh>
+#include <nel/memory.hh> // move()
+
+#include <catch2/catch.hpp>
+
+namespace nel
+{
+namespace test
+{
+namespace sort
+{
+
+// Each algorithm is checked against insertion sort, the simplest,
+// over patterns that upset quicksorts: sorted, reversed, all equal, few distinct,
+// organ pipe and sawtooth, as well as random, and across the small_n cutoffs.
+static constexpr Length max_len = 3000;
+static constexpr Length lens[] = {0, 1, 2, 3, 19, 20, 21, 128, 129, 1000, max_len};
+
+enum class Pattern {
+    Random,
+    Sorted,
+    Reversed,
+    Equal,
+    FewDistinct,
+    OrganPipe,
+    Sawtooth,
+};
+
+static constexpr Pattern patterns[] = {
+    Pattern::Random,      Pattern::Sorted,    Pattern::Reversed, Pattern::Equal,
+    Pattern::FewDistinct, Pattern::OrganPipe, Pattern::Sawtooth,
+};
+
+// xorshift, repeatable.
+static unsigned int next_rand(unsigned int &s)
+{
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return s;
+}
+
+static void fill(int a[], Length const n, Pattern const pat)
+{
+    unsigned int seed = 0x12345678;
+    for (Index i = 0; i < n; ++i) {
+        switch (pat) {
+            case Pattern::Random:
+                a[i] = int(next_rand(seed) % 1000);
+                break;
+            case Pattern::Sorted:
+                a[i] = int(i);
+                break;
+            case Pattern::Reversed:
+                a[i] = int(n - i);
+                break;
+            case Pattern::Equal:
+                a[i] = 7;
+                break;
+            case Pattern::FewDistinct:
+                a[i] = int(next_rand(seed) % 4);
+                break;
+            case Pattern::OrganPipe:
+                a[i] = int((i < n / 2) ? i : n - i);
+                break;
+            case Pattern::Sawtooth:
+                a[i] = int(i % 17);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+static int reference[max_len];
+static int values[max_len];
+static int scratch[max_len];
+
+static void make(Length const n, Pattern const pat)
+{
+    fill(reference, n, pat);
+    fill(values, n, pat);
+    nel::sort::Less less;
+    nel::sort::insertion(reference, n, less);
+}
+
+static bool same_as_reference(Length const n)
+{
+    for (Index i = 0; i < n; ++i) {
+        if (values[i] != reference[i]) { return false; }
+    }
+    return true;
+}
+
+TEST_CASE("sort::unstable", "[sort]")
+{
+    for (Pattern const pat: patterns) {
+        for (Length const n: lens) {
+            make(n, pat);
+            nel::sort::Less less;
+            nel::sort::unstable(values, n, less);
+            REQUIRE(same_as_reference(n));
+        }
+    }
+}
+
+TEST_CASE("sort::stable", "[sort]")
+{
+    for (Pattern const pat: patterns) {
+        for (Length const n: lens) {
+            // in place, some scratch, and enough scratch.
+            for (Length const buf_n: {Length(0), n / 8, n / 2}) {
+                make(n, pat);
+                nel::sort::Less less;
+                nel::sort::stable(values, n, scratch, buf_n, less);
+                REQUIRE(same_as_reference(n));
+            }
+        }
+    }
+}
+
+TEST_CASE("sort::heap", "[sort]")
+{
+    for (Pattern const pat: patterns) {
+        for (Length const n: lens) {
+            make(n, pat);
+            nel::sort::Less less;
+            nel::sort::heap(values, n, less);
+            REQUIRE(same_as_reference(n));
+        }
+    }
+}
+
+TEST_CASE("sort::select_nth", "[sort]")
+{
+    for (Pattern const pat: patterns) {
+        for (Length const n: lens) {
+            for (Index const k: {Index(0), n / 3, n / 2, n - 1}) {
+                if (k >= n) { continue; }
+                make(n, pat);
+                nel::sort::Less less;
+                nel::sort::select_nth(values, n, k, less);
+                REQUIRE(values[k] == reference[k]);
+                bool ok = true;
+                for (Index i = 0; i < k; ++i) {
+                    ok = ok && !(values[k] < values[i]);
+                }
+                for (Index i = k + 1; i < n; ++i) {
+                    ok = ok && !(values[i] < values[k]);
+                }
+                REQUIRE(ok);
+            }
+        }
+    }
+}
+
+TEST_CASE("sort::unstable, sorted input is linear", "[sort]")
+{
+    // pdqsort spots the already partitioned, sorted, input and stops.
+    Count compares = 0;
+    auto less = [&compares](int const &a, int const &b) {
+        compares += 1;
+        return a < b;
+    };
+    fill(values, max_len, Pattern::Sorted);
+    nel::sort::unstable(values, max_len, less);
+    REQUIRE(compares < 3 * max_len);
+
+    compares = 0;
+    nel::sort::stable(values, max_len, scratch, 0, less);
+    REQUIRE(compares < 3 * max_len);
+}
+
+// Sorted by key only, seq records the original order.
+struct Keyed
+{
+        int key;
+        int seq;
+
+        Keyed(Keyed const &) = delete;
+        Keyed &operator=(Keyed const &) = delete;
+
+        Keyed(Keyed &&o) = default;
+        Keyed &operator=(Keyed &&o) = default;
+
+        Keyed(void)
+            : key(0)
+            , seq(0)
+        {
+        }
+
+        Keyed(int k, int s)
+            : key(k)
+            , seq(s)
+        {
+        }
+};
+
+TEST_CASE("sort::stable, keeps order of equal items", "[sort]")
+{
+    // move-only items.
+    static Keyed items[max_len];
+    static Keyed buf[max_len / 2];
+    auto by_key = [](Keyed const &a, Keyed const &b) { return a.key < b.key; };
+
+    for (Length const n: lens) {
+        for (Length const buf_n: {Length(0), n / 8, n / 2}) {
+            unsigned int seed = 0x2468ace0;
+            for (Index i = 0; i < n; ++i) {
+                items[i] = Keyed(int(next_rand(seed) % 10), int(i));
+            }
+            nel::sort::stable(items, n, buf, buf_n, by_key);
+            bool ok = true;
+            for (Index i = 1; i < n; ++i) {
+                ok = ok && (items[i - 1].key < items[i].key
+                            || (items[i - 1].key == items[i].key
+                                && items[i - 1].seq < items[i].seq));
+            }
+            REQUIRE(ok);
+        }
+    }
+}
+
+} // namespace sort
+} // namespace test
+} // namespace nel
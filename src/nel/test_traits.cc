@@ -0,0 +1,89 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#include <nel/traits.hh>
+#include <nel/heaped/box.hh>
+#include <nel/heaped/vector.hh>
+
+#include <catch2/catch.hpp>
+
+#include <nel/stub.hh>
+
+#include <inttypes.h> // uint8_t
+
+namespace nel
+{
+namespace test
+{
+namespace traits
+{
+
+struct Pod
+{
+        int a;
+        uint8_t b;
+};
+
+enum class Colour {
+    Red,
+    Blue,
+};
+
+struct Relocatable
+{
+        int *p;
+
+        ~Relocatable(void) {}
+};
+
+} // namespace traits
+} // namespace test
+
+template<>
+struct TriviallyRelocatable<test::traits::Relocatable>
+{
+        static constexpr bool value = true;
+};
+
+namespace test
+{
+namespace traits
+{
+
+TEST_CASE("traits::is_trivially_copyable", "[traits]")
+{
+    CHECK(nel::is_trivially_copyable<int>);
+    CHECK(nel::is_trivially_copyable<float>);
+    CHECK(nel::is_trivially_copyable<Pod>);
+    CHECK(nel::is_trivially_copyable<int *>);
+    CHECK(!nel::is_trivially_copyable<Stub>);
+    CHECK(!nel::is_trivially_copyable<Relocatable>);
+}
+
+TEST_CASE("traits::is_trivially_relocatable", "[traits]")
+{
+    // trivially copyable are trivially relocatable.
+    CHECK(nel::is_trivially_relocatable<int>);
+    CHECK(nel::is_trivially_relocatable<Pod>);
+    CHECK(!nel::is_trivially_relocatable<Stub>);
+
+    // opted in.
+    CHECK(nel::is_trivially_relocatable<Relocatable>);
+    CHECK(nel::is_trivially_relocatable<nel::heaped::Box<Stub>>);
+    CHECK(nel::is_trivially_relocatable<nel::heaped::Vector<Stub>>);
+}
+
+TEST_CASE("traits::is_bitwise_comparable", "[traits]")
+{
+    CHECK(nel::is_bitwise_comparable<int>);
+    CHECK(nel::is_bitwise_comparable<uint8_t>);
+    CHECK(nel::is_bitwise_comparable<Colour>);
+    CHECK(nel::is_bitwise_comparable<int *>);
+    CHECK(!nel::is_bitwise_comparable<float>);
+    CHECK(!nel::is_bitwise_comparable<double>);
+    // padded
+    CHECK(!nel::is_bitwise_comparable<Pod>);
+    CHECK(!nel::is_bitwise_comparable<Stub>);
+}
+
+} // namespace traits
+} // namespace test
+} // namespace nel
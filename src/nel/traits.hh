@@ -0,0 +1,106 @@
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+#if !defined(NEL_TRAITS_HH)
+#    define NEL_TRAITS_HH
+
+namespace nel
+{
+
+// Compile time type properties, used to pick bulk (byte-wise) fast paths in
+// elem:: and the containers.
+// Built on compiler builtins, as nel does not use std <type_traits>.
+
+/**
+ * Can T be copied byte-wise (memcpy) instead of via its copy/move ops.
+ */
+template<typename T>
+constexpr bool is_trivially_copyable = __is_trivially_copyable(T);
+
+/**
+ * Can T be relocated (moved to new memory and the old left for dead)
+ * byte-wise, skipping the move-ctor and dtor.
+ *
+ * True for trivially copyable types.
+ * Types that only hold pointers to what they own (heaped::Box, heaped::Vector, ..)
+ * are also relocatable, and opt in by specialising TriviallyRelocatable.
+ *
+ * usage:
+ * ```c++
+ *  template<>
+ *  struct nel::TriviallyRelocatable<Foo> {
+ *      static constexpr bool value = true;
+ *  };
+ * ```
+ */
+template<typename T>
+struct TriviallyRelocatable
+{
+        static constexpr bool value = __is_trivially_copyable(T);
+};
+
+template<typename T>
+constexpr bool is_trivially_relocatable = TriviallyRelocatable<T>::value;
+
+/**
+ * Can T be compared for equality byte-wise (memcmp) instead of via operator==.
+ *
+ * True for integers, enums and pointers; every value has a single byte
+ * representation and == means same bytes.
+ * Not floats (+0.0 == -0.0, NaN != NaN), and not classes,
+ * which may have padding or their own operator==.
+ * Classes for which it does hold can opt in by specialising BitwiseComparable.
+ */
+template<typename T>
+struct BitwiseComparable
+{
+        static constexpr bool value =
+            __has_unique_object_representations(T) && !__is_class(T) && !__is_union(T);
+};
+
+template<typename T>
+constexpr bool is_bitwise_comparable = BitwiseComparable<T>::value;
+
+/**
+ * T without any top level const, e.g. the value type of a Slice<T const>.
+ */
+template<typename T>
+struct RemoveConst
+{
+        typedef T Type;
+};
+
+template<typename T>
+struct RemoveConst<T const>
+{
+        typedef T Type;
+};
+
+template<typename T>
+using remove_const = typename RemoveConst<T>::Type;
+
+/**
+ * T without any reference, e.g. the type of a forwarded (F &&) arg.
+ */
+template<typename T>
+struct RemoveReference
+{
+        typedef T Type;
+};
+
+template<typename T>
+struct RemoveReference<T &>
+{
+        typedef T Type;
+};
+
+template<typename T>
+struct RemoveReference<T &&>
+{
+        typedef T Type;
+};
+
+template<typename T>
+using remove_reference = typename RemoveReference<T>::Type;
+
+} // namespace nel
+
+#endif // !defined(NEL_TRAITS_HH)
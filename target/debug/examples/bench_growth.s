@@ -0,0 +1,4315 @@
+
+target/debug/examples/bench_growth:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 5f 00 00 	mov    0x5fc5(%rip),%rax        # 6fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 5f 00 00    	push   0x5fca(%rip)        # 6ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 5f 00 00    	jmp    *0x5fcc(%rip)        # 6ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 5f 00 00    	jmp    *0x5fca(%rip)        # 7000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 5f 00 00    	jmp    *0x5fc2(%rip)        # 7008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <clock_gettime@plt>:
+    1050:	ff 25 ba 5f 00 00    	jmp    *0x5fba(%rip)        # 7010 <clock_gettime@GLIBC_2.17>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputs@plt>:
+    1060:	ff 25 b2 5f 00 00    	jmp    *0x5fb2(%rip)        # 7018 <fputs@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <memset@plt>:
+    1070:	ff 25 aa 5f 00 00    	jmp    *0x5faa(%rip)        # 7020 <memset@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fputc@plt>:
+    1080:	ff 25 a2 5f 00 00    	jmp    *0x5fa2(%rip)        # 7028 <fputc@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <memcmp@plt>:
+    1090:	ff 25 9a 5f 00 00    	jmp    *0x5f9a(%rip)        # 7030 <memcmp@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <fprintf@plt>:
+    10a0:	ff 25 92 5f 00 00    	jmp    *0x5f92(%rip)        # 7038 <fprintf@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <memcpy@plt>:
+    10b0:	ff 25 8a 5f 00 00    	jmp    *0x5f8a(%rip)        # 7040 <memcpy@GLIBC_2.14>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <realloc@plt>:
+    10c0:	ff 25 82 5f 00 00    	jmp    *0x5f82(%rip)        # 7048 <realloc@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <memmove@plt>:
+    10d0:	ff 25 7a 5f 00 00    	jmp    *0x5f7a(%rip)        # 7050 <memmove@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010e0 <__cxa_finalize@plt>:
+    10e0:	ff 25 fa 5e 00 00    	jmp    *0x5efa(%rip)        # 6fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10e6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010f0 <_start>:
+    10f0:	31 ed                	xor    %ebp,%ebp
+    10f2:	49 89 d1             	mov    %rdx,%r9
+    10f5:	5e                   	pop    %rsi
+    10f6:	48 89 e2             	mov    %rsp,%rdx
+    10f9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    10fd:	50                   	push   %rax
+    10fe:	54                   	push   %rsp
+    10ff:	45 31 c0             	xor    %r8d,%r8d
+    1102:	31 c9                	xor    %ecx,%ecx
+    1104:	48 8d 3d 6f 01 00 00 	lea    0x16f(%rip),%rdi        # 127a <main>
+    110b:	ff 15 af 5e 00 00    	call   *0x5eaf(%rip)        # 6fc0 <__libc_start_main@GLIBC_2.34>
+    1111:	f4                   	hlt
+    1112:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1119:	00 00 00 
+    111c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001120 <deregister_tm_clones>:
+    1120:	    48 8d 3d 41 5f 00 00 	lea    0x5f41(%rip),%rdi        # 7068 <__TMC_END__>
+    1127:	    48 8d 05 3a 5f 00 00 	lea    0x5f3a(%rip),%rax        # 7068 <__TMC_END__>
+    112e:	    48 39 f8             	cmp    %rdi,%rax
+    1131:	/-- 74 15                	je     1148 <deregister_tm_clones+0x28>
+    1133:	|   48 8b 05 8e 5e 00 00 	mov    0x5e8e(%rip),%rax        # 6fc8 <_ITM_deregisterTMCloneTable@Base>
+    113a:	|   48 85 c0             	test   %rax,%rax
+    113d:	+-- 74 09                	je     1148 <deregister_tm_clones+0x28>
+    113f:	|   ff e0                	jmp    *%rax
+    1141:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1148:	\-> c3                   	ret
+    1149:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001150 <register_tm_clones>:
+    1150:	    48 8d 3d 11 5f 00 00 	lea    0x5f11(%rip),%rdi        # 7068 <__TMC_END__>
+    1157:	    48 8d 35 0a 5f 00 00 	lea    0x5f0a(%rip),%rsi        # 7068 <__TMC_END__>
+    115e:	    48 29 fe             	sub    %rdi,%rsi
+    1161:	    48 89 f0             	mov    %rsi,%rax
+    1164:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1168:	    48 c1 f8 03          	sar    $0x3,%rax
+    116c:	    48 01 c6             	add    %rax,%rsi
+    116f:	    48 d1 fe             	sar    %rsi
+    1172:	/-- 74 14                	je     1188 <register_tm_clones+0x38>
+    1174:	|   48 8b 05 5d 5e 00 00 	mov    0x5e5d(%rip),%rax        # 6fd8 <_ITM_registerTMCloneTable@Base>
+    117b:	|   48 85 c0             	test   %rax,%rax
+    117e:	+-- 74 08                	je     1188 <register_tm_clones+0x38>
+    1180:	|   ff e0                	jmp    *%rax
+    1182:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1188:	\-> c3                   	ret
+    1189:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001190 <__do_global_dtors_aux>:
+    1190:	       f3 0f 1e fa          	endbr64
+    1194:	       80 3d ed 5e 00 00 00 	cmpb   $0x0,0x5eed(%rip)        # 7088 <completed.0>
+    119b:	/----- 75 2b                	jne    11c8 <__do_global_dtors_aux+0x38>
+    119d:	|      55                   	push   %rbp
+    119e:	|      48 83 3d 3a 5e 00 00 	cmpq   $0x0,0x5e3a(%rip)        # 6fe0 <__cxa_finalize@GLIBC_2.2.5>
+    11a5:	|      00 
+    11a6:	|      48 89 e5             	mov    %rsp,%rbp
+    11a9:	|  /-- 74 0c                	je     11b7 <__do_global_dtors_aux+0x27>
+    11ab:	|  |   48 8b 3d ae 5e 00 00 	mov    0x5eae(%rip),%rdi        # 7060 <__dso_handle>
+    11b2:	|  |   e8 29 ff ff ff       	call   10e0 <__cxa_finalize@plt>
+    11b7:	|  \-> e8 64 ff ff ff       	call   1120 <deregister_tm_clones>
+    11bc:	|      c6 05 c5 5e 00 00 01 	movb   $0x1,0x5ec5(%rip)        # 7088 <completed.0>
+    11c3:	|      5d                   	pop    %rbp
+    11c4:	|      c3                   	ret
+    11c5:	|      0f 1f 00             	nopl   (%rax)
+    11c8:	\----> c3                   	ret
+    11c9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011d0 <frame_dummy>:
+    11d0:	f3 0f 1e fa          	endbr64
+    11d4:	e9 77 ff ff ff       	jmp    1150 <register_tm_clones>
+
+00000000000011d9 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    11d9:	55                   	push   %rbp
+    11da:	48 89 e5             	mov    %rsp,%rbp
+    11dd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11e1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    11e4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11e9:	5d                   	pop    %rbp
+    11ea:	c3                   	ret
+
+00000000000011eb <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    11eb:	55                   	push   %rbp
+    11ec:	48 89 e5             	mov    %rsp,%rbp
+    11ef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11f3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11f6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return -1;
+    11fa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11ff:	5d                   	pop    %rbp
+    1200:	c3                   	ret
+
+0000000000001201 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    1201:	55                   	push   %rbp
+    1202:	48 89 e5             	mov    %rsp,%rbp
+    1205:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1209:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    120c:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    return -1;
+    120f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1214:	5d                   	pop    %rbp
+    1215:	c3                   	ret
+
+0000000000001216 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    1216:	55                   	push   %rbp
+    1217:	48 89 e5             	mov    %rsp,%rbp
+    121a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    121e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1221:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    1224:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    return -1;
+    1227:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    122c:	5d                   	pop    %rbp
+    122d:	c3                   	ret
+
+000000000000122e <_read_r>:
+int _read_r(struct _reent *, int) {
+    122e:	55                   	push   %rbp
+    122f:	48 89 e5             	mov    %rsp,%rbp
+    1232:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1236:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1239:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    123e:	5d                   	pop    %rbp
+    123f:	c3                   	ret
+
+0000000000001240 <_write_r>:
+int _write_r(struct _reent *, int, char *, int) {
+    1240:	55                   	push   %rbp
+    1241:	48 89 e5             	mov    %rsp,%rbp
+    1244:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1248:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    124b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    124f:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+    return -1;
+    1252:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1257:	5d                   	pop    %rbp
+    1258:	c3                   	ret
+
+0000000000001259 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    1259:	55                   	push   %rbp
+    125a:	48 89 e5             	mov    %rsp,%rbp
+    125d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return -1;
+    1261:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1266:	5d                   	pop    %rbp
+    1267:	c3                   	ret
+
+0000000000001268 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1268:	55                   	push   %rbp
+    1269:	48 89 e5             	mov    %rsp,%rbp
+    126c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1270:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1273:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1278:	5d                   	pop    %rbp
+    1279:	c3                   	ret
+
+000000000000127a <main>:
+    nel::log << "  reallocs: " << Counting::reallocs << ", bytes moved (at most): "
+             << Counting::bytes << '\n';
+}
+
+int main()
+{
+    127a:	55                   	push   %rbp
+    127b:	48 89 e5             	mov    %rsp,%rbp
+    bench_push<nel::heaped::GeometricGrowth<2, 1>>("push 10M, geometric 2x");
+    127e:	48 8d 05 b3 2d 00 00 	lea    0x2db3(%rip),%rax        # 4038 <n_pushes+0x8>
+    1285:	48 89 c7             	mov    %rax,%rdi
+    1288:	e8 af 04 00 00       	call   173c <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)>
+    bench_push<nel::heaped::GeometricGrowth<3, 2>>("push 10M, geometric 1.5x");
+    128d:	48 8d 05 bb 2d 00 00 	lea    0x2dbb(%rip),%rax        # 404f <n_pushes+0x1f>
+    1294:	48 89 c7             	mov    %rax,%rdi
+    1297:	e8 ee 05 00 00       	call   188a <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)>
+    bench_push<nel::heaped::LinearGrowth<16>>("push 10M, linear 16");
+    129c:	48 8d 05 c5 2d 00 00 	lea    0x2dc5(%rip),%rax        # 4068 <n_pushes+0x38>
+    12a3:	48 89 c7             	mov    %rax,%rdi
+    12a6:	e8 2d 07 00 00       	call   19d8 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)>
+}
+    12ab:	b8 00 00 00 00       	mov    $0x0,%eax
+    12b0:	5d                   	pop    %rbp
+    12b1:	c3                   	ret
+
+00000000000012b2 <bench::now_ns()>:
+{
+    12b2:	55                   	push   %rbp
+    12b3:	48 89 e5             	mov    %rsp,%rbp
+    12b6:	48 83 ec 10          	sub    $0x10,%rsp
+        static long unsigned int reallocs;
+    12ba:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    12be:	48 89 c6             	mov    %rax,%rsi
+    12c1:	bf 01 00 00 00       	mov    $0x1,%edi
+    12c6:	e8 85 fd ff ff       	call   1050 <clock_gettime@plt>
+        static long unsigned int bytes;
+    12cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12cf:	48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+    12d6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    12da:	48 01 d0             	add    %rdx,%rax
+
+    12dd:	c9                   	leave
+    12de:	c3                   	ret
+
+00000000000012df <bench::report(char const*, unsigned long, unsigned long)>:
+            return nel::heaped::Malloc::try_realloc(p, align, old_size, new_size);
+    12df:	    55                   	push   %rbp
+    12e0:	    48 89 e5             	mov    %rsp,%rbp
+    12e3:	    48 83 ec 20          	sub    $0x20,%rsp
+    12e7:	    48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    12eb:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    12ef:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        }
+    12f3:	    48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12f7:	    48 89 c6             	mov    %rax,%rsi
+    12fa:	    48 8d 05 9f 5d 00 00 	lea    0x5d9f(%rip),%rax        # 70a0 <nel::log>
+    1301:	    48 89 c7             	mov    %rax,%rdi
+    1304:	    e8 8e 24 00 00       	call   3797 <nel::operator<<(nel::Log&, char const*)>
+    1309:	    48 89 c2             	mov    %rax,%rdx
+    130c:	    48 8d 05 f5 2c 00 00 	lea    0x2cf5(%rip),%rax        # 4008 <_IO_stdin_used+0x8>
+    1313:	    48 89 c6             	mov    %rax,%rsi
+    1316:	    48 89 d7             	mov    %rdx,%rdi
+    1319:	    e8 79 24 00 00       	call   3797 <nel::operator<<(nel::Log&, char const*)>
+    131e:	    48 89 c1             	mov    %rax,%rcx
+    1321:	    48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1325:	    48 c1 e8 03          	shr    $0x3,%rax
+    1329:	    48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+    1330:	    9b c4 20 
+    1333:	    48 f7 e2             	mul    %rdx
+    1336:	    48 89 d0             	mov    %rdx,%rax
+    1339:	    48 c1 e8 04          	shr    $0x4,%rax
+    133d:	    48 89 c6             	mov    %rax,%rsi
+    1340:	    48 89 cf             	mov    %rcx,%rdi
+    1343:	    e8 5a 25 00 00       	call   38a2 <nel::operator<<(nel::Log&, unsigned long)>
+    1348:	    48 89 c2             	mov    %rax,%rdx
+    134b:	    48 8d 05 b9 2c 00 00 	lea    0x2cb9(%rip),%rax        # 400b <_IO_stdin_used+0xb>
+    1352:	    48 89 c6             	mov    %rax,%rsi
+    1355:	    48 89 d7             	mov    %rdx,%rdi
+    1358:	    e8 3a 24 00 00       	call   3797 <nel::operator<<(nel::Log&, char const*)>
+
+    135d:	    48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1362:	/-- 74 57                	je     13bb <bench::report(char const*, unsigned long, unsigned long)+0xdc>
+    1364:	|   48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1369:	+-- 74 50                	je     13bb <bench::report(char const*, unsigned long, unsigned long)+0xdc>
+        {
+    136b:	|   48 8d 05 9c 2c 00 00 	lea    0x2c9c(%rip),%rax        # 400e <_IO_stdin_used+0xe>
+    1372:	|   48 89 c6             	mov    %rax,%rsi
+    1375:	|   48 8d 05 24 5d 00 00 	lea    0x5d24(%rip),%rax        # 70a0 <nel::log>
+    137c:	|   48 89 c7             	mov    %rax,%rdi
+    137f:	|   e8 13 24 00 00       	call   3797 <nel::operator<<(nel::Log&, char const*)>
+    1384:	|   48 89 c1             	mov    %rax,%rcx
+    1387:	|   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    138b:	|   48 69 c0 e8 03 00 00 	imul   $0x3e8,%rax,%rax
+    1392:	|   ba 00 00 00 00       	mov    $0x0,%edx
+    1397:	|   48 f7 75 f0          	divq   -0x10(%rbp)
+    139b:	|   48 89 c6             	mov    %rax,%rsi
+    139e:	|   48 89 cf             	mov    %rcx,%rdi
+    13a1:	|   e8 fc 24 00 00       	call   38a2 <nel::operator<<(nel::Log&, unsigned long)>
+    13a6:	|   48 89 c2             	mov    %rax,%rdx
+    13a9:	|   48 8d 05 61 2c 00 00 	lea    0x2c61(%rip),%rax        # 4011 <_IO_stdin_used+0x11>
+    13b0:	|   48 89 c6             	mov    %rax,%rsi
+    13b3:	|   48 89 d7             	mov    %rdx,%rdi
+    13b6:	|   e8 dc 23 00 00       	call   3797 <nel::operator<<(nel::Log&, char const*)>
+        }
+    13bb:	\-> be 0a 00 00 00       	mov    $0xa,%esi
+    13c0:	    48 8d 05 d9 5c 00 00 	lea    0x5cd9(%rip),%rax        # 70a0 <nel::log>
+    13c7:	    48 89 c7             	mov    %rax,%rdi
+    13ca:	    e8 9c 23 00 00       	call   376b <nel::operator<<(nel::Log&, char)>
+};
+    13cf:	    90                   	nop
+    13d0:	    c9                   	leave
+    13d1:	    c3                   	ret
+
+00000000000013d2 <operator new(unsigned long, void*)>:
+
+#    if !defined(TEST)
+// catch2 uses stdlib and so uses stdlib's new defn.
+// Operator new must not be in a namespace
+inline void *operator new(nel::USize, void *p)
+{
+    13d2:	55                   	push   %rbp
+    13d3:	48 89 e5             	mov    %rsp,%rbp
+    13d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    13da:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return p;
+    13de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+    13e2:	5d                   	pop    %rbp
+    13e3:	c3                   	ret
+
+00000000000013e4 <nel::Context::Context(char const*, char const*, int)>:
+        char const *fn_name_;
+        char const *file_name_;
+        int line_num_;
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+    13e4:	55                   	push   %rbp
+    13e5:	48 89 e5             	mov    %rsp,%rbp
+    13e8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    13ec:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    13f0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    13f4:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    13f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13fb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    13ff:	48 89 10             	mov    %rdx,(%rax)
+            , file_name_(file_name)
+    1402:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1406:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    140a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , line_num_(line_num)
+    140e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1412:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1415:	89 50 10             	mov    %edx,0x10(%rax)
+        {
+        }
+    1418:	90                   	nop
+    1419:	5d                   	pop    %rbp
+    141a:	c3                   	ret
+
+000000000000141b <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>:
+        static Result<void *, AllocError> try_malloc(Length const align, Length const size)
+        {
+            return try_realloc(nullptr, align, 0, size);
+        }
+
+        static Result<void *, AllocError> try_realloc(void *const p,
+    141b:	          55                   	push   %rbp
+    141c:	          48 89 e5             	mov    %rsp,%rbp
+    141f:	          48 83 ec 40          	sub    $0x40,%rsp
+    1423:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1427:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    142b:	          48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    142f:	          48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    1433:	          4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+                                                      Length const align,
+                                                      Length const old_size,
+                                                      Length const new_size)
+        {
+            if (align == 0 || (align & (align - 1)) != 0) {
+    1437:	          48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    143c:	      /-- 74 11                	je     144f <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x34>
+    143e:	      |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1442:	      |   48 83 e8 01          	sub    $0x1,%rax
+    1446:	      |   48 23 45 d8          	and    -0x28(%rbp),%rax
+    144a:	      |   48 85 c0             	test   %rax,%rax
+    144d:	   /--|-- 74 1c                	je     146b <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x50>
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+    144f:	   |  \-> c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+    1456:	   |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    145a:	   |      48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    145e:	   |      48 89 d6             	mov    %rdx,%rsi
+    1461:	   |      48 89 c7             	mov    %rax,%rdi
+    1464:	   |      e8 cf 01 00 00       	call   1638 <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+                                    : std::realloc(p, new_size);
+            if (new_p == nullptr) {
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+            }
+            return Result<void *, AllocError>::Ok(new_p);
+        }
+    1469:	/--|----- eb 79                	jmp    14e4 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            void *const new_p = is_over_aligned(align)
+    146b:	|  \----> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    146f:	|         48 89 c7             	mov    %rax,%rdi
+    1472:	|         e8 b4 00 00 00       	call   152b <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+                                    ? realloc_aligned(p, align, old_size, new_size)
+    1477:	|         84 c0                	test   %al,%al
+    1479:	|  /----- 74 1a                	je     1495 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x7a>
+    147b:	|  |      48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+    147f:	|  |      48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1483:	|  |      48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+    1487:	|  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    148b:	|  |      48 89 c7             	mov    %rax,%rdi
+    148e:	|  |      e8 d3 20 00 00       	call   3566 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+    1493:	|  |  /-- eb 13                	jmp    14a8 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x8d>
+                                    : std::realloc(p, new_size);
+    1495:	|  \--|-> 48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    1499:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    149d:	|     |   48 89 d6             	mov    %rdx,%rsi
+    14a0:	|     |   48 89 c7             	mov    %rax,%rdi
+    14a3:	|     |   e8 18 fc ff ff       	call   10c0 <realloc@plt>
+    14a8:	|     \-> 48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            if (new_p == nullptr) {
+    14ac:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14b0:	|         48 85 c0             	test   %rax,%rax
+    14b3:	|     /-- 75 1c                	jne    14d1 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xb6>
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+    14b5:	|     |   c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    14bc:	|     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14c0:	|     |   48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    14c4:	|     |   48 89 d6             	mov    %rdx,%rsi
+    14c7:	|     |   48 89 c7             	mov    %rax,%rdi
+    14ca:	|     |   e8 69 01 00 00       	call   1638 <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+        }
+    14cf:	+-----|-- eb 13                	jmp    14e4 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            return Result<void *, AllocError>::Ok(new_p);
+    14d1:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14d5:	|         48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    14d9:	|         48 89 d6             	mov    %rdx,%rsi
+    14dc:	|         48 89 c7             	mov    %rax,%rdi
+    14df:	|         e8 88 01 00 00       	call   166c <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>
+        }
+    14e4:	\-------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14e8:	          c9                   	leave
+    14e9:	          c3                   	ret
+
+00000000000014ea <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>:
+
+        static void free(void *const p, Length const align, Length const size)
+    14ea:	       55                   	push   %rbp
+    14eb:	       48 89 e5             	mov    %rsp,%rbp
+    14ee:	       48 83 ec 20          	sub    $0x20,%rsp
+    14f2:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    14f6:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    14fa:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+    14fe:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1502:	       48 89 c7             	mov    %rax,%rdi
+    1505:	       e8 21 00 00 00       	call   152b <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+    150a:	       84 c0                	test   %al,%al
+    150c:	/----- 74 0e                	je     151c <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x32>
+                free_aligned(p);
+    150e:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1512:	|      48 89 c7             	mov    %rax,%rdi
+    1515:	|      e8 08 20 00 00       	call   3522 <nel::free_aligned(void*)>
+            } else {
+                std::free(p);
+            }
+        }
+    151a:	|  /-- eb 0c                	jmp    1528 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x3e>
+                std::free(p);
+    151c:	\--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1520:	   |   48 89 c7             	mov    %rax,%rdi
+    1523:	   |   e8 08 fb ff ff       	call   1030 <free@plt>
+        }
+    1528:	   \-> 90                   	nop
+    1529:	       c9                   	leave
+    152a:	       c3                   	ret
+
+000000000000152b <nel::heaped::Malloc::is_over_aligned(unsigned long)>:
+
+    private:
+        static constexpr bool is_over_aligned(Length const align)
+    152b:	55                   	push   %rbp
+    152c:	48 89 e5             	mov    %rsp,%rbp
+    152f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return align > alignof(std::max_align_t);
+    1533:	48 83 7d f8 10       	cmpq   $0x10,-0x8(%rbp)
+    1538:	0f 97 c0             	seta   %al
+        }
+    153b:	5d                   	pop    %rbp
+    153c:	c3                   	ret
+
+000000000000153d <Counting::try_realloc(void*, unsigned long, unsigned long, unsigned long)>:
+        static nel::Result<void *, nel::heaped::AllocError> try_realloc(void *const p,
+    153d:	55                   	push   %rbp
+    153e:	48 89 e5             	mov    %rsp,%rbp
+    1541:	48 83 ec 30          	sub    $0x30,%rsp
+    1545:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1549:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    154d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1551:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+    1555:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+            reallocs += 1;
+    1559:	48 8b 05 30 5b 00 00 	mov    0x5b30(%rip),%rax        # 7090 <Counting::reallocs>
+    1560:	48 83 c0 01          	add    $0x1,%rax
+    1564:	48 89 05 25 5b 00 00 	mov    %rax,0x5b25(%rip)        # 7090 <Counting::reallocs>
+            bytes += old_size;
+    156b:	48 8b 15 26 5b 00 00 	mov    0x5b26(%rip),%rdx        # 7098 <Counting::bytes>
+    1572:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1576:	48 01 d0             	add    %rdx,%rax
+    1579:	48 89 05 18 5b 00 00 	mov    %rax,0x5b18(%rip)        # 7098 <Counting::bytes>
+            return nel::heaped::Malloc::try_realloc(p, align, old_size, new_size);
+    1580:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1584:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+    1588:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    158c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1590:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+    1594:	49 89 f8             	mov    %rdi,%r8
+    1597:	48 89 c7             	mov    %rax,%rdi
+    159a:	e8 7c fe ff ff       	call   141b <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>
+        }
+    159f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15a3:	c9                   	leave
+    15a4:	c3                   	ret
+
+00000000000015a5 <Counting::free(void*, unsigned long, unsigned long)>:
+        static void free(void *const p, nel::Length const align, nel::Length const size)
+    15a5:	55                   	push   %rbp
+    15a6:	48 89 e5             	mov    %rsp,%rbp
+    15a9:	48 83 ec 20          	sub    $0x20,%rsp
+    15ad:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    15b1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    15b5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            nel::heaped::Malloc::free(p, align, size);
+    15b9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    15bd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    15c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15c5:	48 89 ce             	mov    %rcx,%rsi
+    15c8:	48 89 c7             	mov    %rax,%rdi
+    15cb:	e8 1a ff ff ff       	call   14ea <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>
+        }
+    15d0:	90                   	nop
+    15d1:	c9                   	leave
+    15d2:	c3                   	ret
+    15d3:	90                   	nop
+
+00000000000015d4 <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+                Element<T> ok_;
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    15d4:	             55                   	push   %rbp
+    15d5:	             48 89 e5             	mov    %rsp,%rbp
+    15d8:	             48 83 ec 30          	sub    $0x30,%rsp
+    15dc:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result::dtor
+    15e0:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    15e4:	             8b 00                	mov    (%rax),%eax
+    15e6:	             83 f8 02             	cmp    $0x2,%eax
+    15e9:	/----------- 74 43                	je     162e <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5a>
+    15eb:	|            83 f8 02             	cmp    $0x2,%eax
+    15ee:	|        /-- 7f 09                	jg     15f9 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x25>
+    15f0:	|        |   85 c0                	test   %eax,%eax
+    15f2:	|  /-----|-- 74 3d                	je     1631 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5d>
+    15f4:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    15f7:	|  |  /--|-- 74 3b                	je     1634 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x60>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    15f9:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    15fd:	|  |  |      b9 72 00 00 00       	mov    $0x72,%ecx
+    1602:	|  |  |      48 8d 15 73 2a 00 00 	lea    0x2a73(%rip),%rdx        # 407c <n_pushes+0x4c>
+    1609:	|  |  |      48 8d 35 7e 2a 00 00 	lea    0x2a7e(%rip),%rsi        # 408e <n_pushes+0x5e>
+    1610:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1613:	|  |  |      e8 cc fd ff ff       	call   13e4 <nel::Context::Context(char const*, char const*, int)>
+    1618:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    161c:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    161f:	|  |  |      48 8d 05 70 2a 00 00 	lea    0x2a70(%rip),%rax        # 4096 <n_pushes+0x66>
+    1626:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1629:	|  |  |      e8 31 18 00 00       	call   2e5f <nel::panic(char const*, nel::Context const&)>
+                    break;
+    162e:	\--|--|----> 90                   	nop
+    162f:	   |  |  /-- eb 04                	jmp    1635 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    1631:	   \--|--|-> 90                   	nop
+    1632:	      |  +-- eb 01                	jmp    1635 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    1634:	      \--|-> 90                   	nop
+                    break;
+            }
+        }
+    1635:	         \-> 90                   	nop
+    1636:	             c9                   	leave
+    1637:	             c3                   	ret
+
+0000000000001638 <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>:
+         *
+         * @param val The value to move into the result as an err value.
+         *
+         * @returns a Result 'wrapping' the value given as an err value.
+         */
+        constexpr static Result Err(E &&val)
+    1638:	55                   	push   %rbp
+    1639:	48 89 e5             	mov    %rsp,%rbp
+    163c:	48 83 ec 10          	sub    $0x10,%rsp
+    1640:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1644:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            return Result(Phantom<Tag::ERR>(), forward<E>(val));
+    1648:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    164c:	48 89 c7             	mov    %rax,%rdi
+    164f:	e8 36 04 00 00       	call   1a8a <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    1654:	48 89 c2             	mov    %rax,%rdx
+    1657:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    165b:	48 89 d6             	mov    %rdx,%rsi
+    165e:	48 89 c7             	mov    %rax,%rdi
+    1661:	e8 32 04 00 00       	call   1a98 <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>
+        }
+    1666:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    166a:	c9                   	leave
+    166b:	c3                   	ret
+
+000000000000166c <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>:
+        constexpr static Result Ok(Args &&...args)
+    166c:	55                   	push   %rbp
+    166d:	48 89 e5             	mov    %rsp,%rbp
+    1670:	48 83 ec 10          	sub    $0x10,%rsp
+    1674:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1678:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<Args>(args)...);
+    167c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1680:	48 89 c7             	mov    %rax,%rdi
+    1683:	e8 51 04 00 00       	call   1ad9 <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    1688:	48 89 c2             	mov    %rax,%rdx
+    168b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    168f:	48 89 d6             	mov    %rdx,%rsi
+    1692:	48 89 c7             	mov    %rax,%rdi
+    1695:	e8 4e 04 00 00       	call   1ae8 <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>
+        }
+    169a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    169e:	c9                   	leave
+    169f:	c3                   	ret
+
+00000000000016a0 <bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([]() {
+    16a0:	       55                   	push   %rbp
+    16a1:	       48 89 e5             	mov    %rsp,%rbp
+    16a4:	       48 83 ec 50          	sub    $0x50,%rsp
+    16a8:	       48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+        auto v = Vec::empty();
+    16ac:	       48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    16b0:	       48 89 c7             	mov    %rax,%rdi
+    16b3:	       e8 71 04 00 00       	call   1b29 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::empty()>
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    16b8:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    16bf:	       00 
+    16c0:	   /-- eb 61                	jmp    1723 <bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)::{lambda()#1}::operator()() const+0x83>
+            v.push(int(i)).is_ok();
+    16c2:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16c6:	|  |   89 45 dc             	mov    %eax,-0x24(%rbp)
+    16c9:	|  |   48 8d 45 d4          	lea    -0x2c(%rbp),%rax
+    16cd:	|  |   48 8d 55 dc          	lea    -0x24(%rbp),%rdx
+    16d1:	|  |   48 8d 4d c8          	lea    -0x38(%rbp),%rcx
+    16d5:	|  |   48 89 ce             	mov    %rcx,%rsi
+    16d8:	|  |   48 89 c7             	mov    %rax,%rdi
+    16db:	|  |   e8 86 04 00 00       	call   1b66 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>
+    16e0:	|  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    16e4:	|  |   b9 38 00 00 00       	mov    $0x38,%ecx
+    16e9:	|  |   48 8d 15 b1 29 00 00 	lea    0x29b1(%rip),%rdx        # 40a1 <n_pushes+0x71>
+    16f0:	|  |   48 8d 35 c3 29 00 00 	lea    0x29c3(%rip),%rsi        # 40ba <n_pushes+0x8a>
+    16f7:	|  |   48 89 c7             	mov    %rax,%rdi
+    16fa:	|  |   e8 e5 fc ff ff       	call   13e4 <nel::Context::Context(char const*, char const*, int)>
+    16ff:	|  |   48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1703:	|  |   48 8d 45 d4          	lea    -0x2c(%rbp),%rax
+    1707:	|  |   48 89 d6             	mov    %rdx,%rsi
+    170a:	|  |   48 89 c7             	mov    %rax,%rdi
+    170d:	|  |   e8 66 05 00 00       	call   1c78 <nel::Result<void, int>::is_ok(nel::Context const&) const>
+    1712:	|  |   48 8d 45 d4          	lea    -0x2c(%rbp),%rax
+    1716:	|  |   48 89 c7             	mov    %rax,%rdi
+    1719:	|  |   e8 d2 04 00 00       	call   1bf0 <nel::Result<void, int>::~Result()>
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    171e:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1723:	|  \-> 48 81 7d f8 7f 96 98 	cmpq   $0x98967f,-0x8(%rbp)
+    172a:	|      00 
+    172b:	\----- 76 95                	jbe    16c2 <bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)::{lambda()#1}::operator()() const+0x22>
+    });
+    172d:	       48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    1731:	       48 89 c7             	mov    %rax,%rdi
+    1734:	       e8 0f 04 00 00       	call   1b48 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    auto t = bench::time_ns([]() {
+    1739:	       90                   	nop
+    173a:	       c9                   	leave
+    173b:	       c3                   	ret
+
+000000000000173c <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)>:
+void bench_push(char const *const name)
+    173c:	55                   	push   %rbp
+    173d:	48 89 e5             	mov    %rsp,%rbp
+    1740:	48 83 ec 20          	sub    $0x20,%rsp
+    1744:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Counting::reallocs = 0;
+    1748:	48 c7 05 3d 59 00 00 	movq   $0x0,0x593d(%rip)        # 7090 <Counting::reallocs>
+    174f:	00 00 00 00 
+    Counting::bytes = 0;
+    1753:	48 c7 05 3a 59 00 00 	movq   $0x0,0x593a(%rip)        # 7098 <Counting::bytes>
+    175a:	00 00 00 00 
+    auto t = bench::time_ns([]() {
+    175e:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1762:	48 89 c7             	mov    %rax,%rdi
+    1765:	e8 38 05 00 00       	call   1ca2 <unsigned long bench::time_ns<bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)::{lambda()#1}>(bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)::{lambda()#1}&&)>
+    176a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    bench::report(name, t);
+    176e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1772:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1776:	ba 00 00 00 00       	mov    $0x0,%edx
+    177b:	48 89 ce             	mov    %rcx,%rsi
+    177e:	48 89 c7             	mov    %rax,%rdi
+    1781:	e8 59 fb ff ff       	call   12df <bench::report(char const*, unsigned long, unsigned long)>
+             << Counting::bytes << '\n';
+    1786:	48 8d 05 38 29 00 00 	lea    0x2938(%rip),%rax        # 40c5 <n_pushes+0x95>
+    178d:	48 89 c6             	mov    %rax,%rsi
+    1790:	48 8d 05 09 59 00 00 	lea    0x5909(%rip),%rax        # 70a0 <nel::log>
+    1797:	48 89 c7             	mov    %rax,%rdi
+    179a:	e8 f8 1f 00 00       	call   3797 <nel::operator<<(nel::Log&, char const*)>
+    179f:	48 89 c2             	mov    %rax,%rdx
+    17a2:	48 8b 05 e7 58 00 00 	mov    0x58e7(%rip),%rax        # 7090 <Counting::reallocs>
+    17a9:	48 89 c6             	mov    %rax,%rsi
+    17ac:	48 89 d7             	mov    %rdx,%rdi
+    17af:	e8 ee 20 00 00       	call   38a2 <nel::operator<<(nel::Log&, unsigned long)>
+    17b4:	48 89 c2             	mov    %rax,%rdx
+    17b7:	48 8d 05 14 29 00 00 	lea    0x2914(%rip),%rax        # 40d2 <n_pushes+0xa2>
+    17be:	48 89 c6             	mov    %rax,%rsi
+    17c1:	48 89 d7             	mov    %rdx,%rdi
+    17c4:	e8 ce 1f 00 00       	call   3797 <nel::operator<<(nel::Log&, char const*)>
+    17c9:	48 89 c2             	mov    %rax,%rdx
+    17cc:	48 8b 05 c5 58 00 00 	mov    0x58c5(%rip),%rax        # 7098 <Counting::bytes>
+    17d3:	48 89 c6             	mov    %rax,%rsi
+    17d6:	48 89 d7             	mov    %rdx,%rdi
+    17d9:	e8 c4 20 00 00       	call   38a2 <nel::operator<<(nel::Log&, unsigned long)>
+    17de:	be 0a 00 00 00       	mov    $0xa,%esi
+    17e3:	48 89 c7             	mov    %rax,%rdi
+    17e6:	e8 80 1f 00 00       	call   376b <nel::operator<<(nel::Log&, char)>
+}
+    17eb:	90                   	nop
+    17ec:	c9                   	leave
+    17ed:	c3                   	ret
+
+00000000000017ee <bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([]() {
+    17ee:	       55                   	push   %rbp
+    17ef:	       48 89 e5             	mov    %rsp,%rbp
+    17f2:	       48 83 ec 50          	sub    $0x50,%rsp
+    17f6:	       48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+        auto v = Vec::empty();
+    17fa:	       48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    17fe:	       48 89 c7             	mov    %rax,%rdi
+    1801:	       e8 c8 04 00 00       	call   1cce <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::empty()>
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    1806:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    180d:	       00 
+    180e:	   /-- eb 61                	jmp    1871 <bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)::{lambda()#1}::operator()() const+0x83>
+            v.push(int(i)).is_ok();
+    1810:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1814:	|  |   89 45 dc             	mov    %eax,-0x24(%rbp)
+    1817:	|  |   48 8d 45 d4          	lea    -0x2c(%rbp),%rax
+    181b:	|  |   48 8d 55 dc          	lea    -0x24(%rbp),%rdx
+    181f:	|  |   48 8d 4d c8          	lea    -0x38(%rbp),%rcx
+    1823:	|  |   48 89 ce             	mov    %rcx,%rsi
+    1826:	|  |   48 89 c7             	mov    %rax,%rdi
+    1829:	|  |   e8 dc 04 00 00       	call   1d0a <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::push(int&&)>
+    182e:	|  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1832:	|  |   b9 38 00 00 00       	mov    $0x38,%ecx
+    1837:	|  |   48 8d 15 63 28 00 00 	lea    0x2863(%rip),%rdx        # 40a1 <n_pushes+0x71>
+    183e:	|  |   48 8d 35 75 28 00 00 	lea    0x2875(%rip),%rsi        # 40ba <n_pushes+0x8a>
+    1845:	|  |   48 89 c7             	mov    %rax,%rdi
+    1848:	|  |   e8 97 fb ff ff       	call   13e4 <nel::Context::Context(char const*, char const*, int)>
+    184d:	|  |   48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1851:	|  |   48 8d 45 d4          	lea    -0x2c(%rbp),%rax
+    1855:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1858:	|  |   48 89 c7             	mov    %rax,%rdi
+    185b:	|  |   e8 18 04 00 00       	call   1c78 <nel::Result<void, int>::is_ok(nel::Context const&) const>
+    1860:	|  |   48 8d 45 d4          	lea    -0x2c(%rbp),%rax
+    1864:	|  |   48 89 c7             	mov    %rax,%rdi
+    1867:	|  |   e8 84 03 00 00       	call   1bf0 <nel::Result<void, int>::~Result()>
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    186c:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1871:	|  \-> 48 81 7d f8 7f 96 98 	cmpq   $0x98967f,-0x8(%rbp)
+    1878:	|      00 
+    1879:	\----- 76 95                	jbe    1810 <bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)::{lambda()#1}::operator()() const+0x22>
+    });
+    187b:	       48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    187f:	       48 89 c7             	mov    %rax,%rdi
+    1882:	       e8 65 04 00 00       	call   1cec <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::~Vector()>
+    auto t = bench::time_ns([]() {
+    1887:	       90                   	nop
+    1888:	       c9                   	leave
+    1889:	       c3                   	ret
+
+000000000000188a <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)>:
+void bench_push(char const *const name)
+    188a:	55                   	push   %rbp
+    188b:	48 89 e5             	mov    %rsp,%rbp
+    188e:	48 83 ec 20          	sub    $0x20,%rsp
+    1892:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Counting::reallocs = 0;
+    1896:	48 c7 05 ef 57 00 00 	movq   $0x0,0x57ef(%rip)        # 7090 <Counting::reallocs>
+    189d:	00 00 00 00 
+    Counting::bytes = 0;
+    18a1:	48 c7 05 ec 57 00 00 	movq   $0x0,0x57ec(%rip)        # 7098 <Counting::bytes>
+    18a8:	00 00 00 00 
+    auto t = bench::time_ns([]() {
+    18ac:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    18b0:	48 89 c7             	mov    %rax,%rdi
+    18b3:	e8 db 04 00 00       	call   1d93 <unsigned long bench::time_ns<bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)::{lambda()#1}>(bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)::{lambda()#1}&&)>
+    18b8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    bench::report(name, t);
+    18bc:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    18c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18c4:	ba 00 00 00 00       	mov    $0x0,%edx
+    18c9:	48 89 ce             	mov    %rcx,%rsi
+    18cc:	48 89 c7             	mov    %rax,%rdi
+    18cf:	e8 0b fa ff ff       	call   12df <bench::report(char const*, unsigned long, unsigned long)>
+             << Counting::bytes << '\n';
+    18d4:	48 8d 05 ea 27 00 00 	lea    0x27ea(%rip),%rax        # 40c5 <n_pushes+0x95>
+    18db:	48 89 c6             	mov    %rax,%rsi
+    18de:	48 8d 05 bb 57 00 00 	lea    0x57bb(%rip),%rax        # 70a0 <nel::log>
+    18e5:	48 89 c7             	mov    %rax,%rdi
+    18e8:	e8 aa 1e 00 00       	call   3797 <nel::operator<<(nel::Log&, char const*)>
+    18ed:	48 89 c2             	mov    %rax,%rdx
+    18f0:	48 8b 05 99 57 00 00 	mov    0x5799(%rip),%rax        # 7090 <Counting::reallocs>
+    18f7:	48 89 c6             	mov    %rax,%rsi
+    18fa:	48 89 d7             	mov    %rdx,%rdi
+    18fd:	e8 a0 1f 00 00       	call   38a2 <nel::operator<<(nel::Log&, unsigned long)>
+    1902:	48 89 c2             	mov    %rax,%rdx
+    1905:	48 8d 05 c6 27 00 00 	lea    0x27c6(%rip),%rax        # 40d2 <n_pushes+0xa2>
+    190c:	48 89 c6             	mov    %rax,%rsi
+    190f:	48 89 d7             	mov    %rdx,%rdi
+    1912:	e8 80 1e 00 00       	call   3797 <nel::operator<<(nel::Log&, char const*)>
+    1917:	48 89 c2             	mov    %rax,%rdx
+    191a:	48 8b 05 77 57 00 00 	mov    0x5777(%rip),%rax        # 7098 <Counting::bytes>
+    1921:	48 89 c6             	mov    %rax,%rsi
+    1924:	48 89 d7             	mov    %rdx,%rdi
+    1927:	e8 76 1f 00 00       	call   38a2 <nel::operator<<(nel::Log&, unsigned long)>
+    192c:	be 0a 00 00 00       	mov    $0xa,%esi
+    1931:	48 89 c7             	mov    %rax,%rdi
+    1934:	e8 32 1e 00 00       	call   376b <nel::operator<<(nel::Log&, char)>
+}
+    1939:	90                   	nop
+    193a:	c9                   	leave
+    193b:	c3                   	ret
+
+000000000000193c <bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([]() {
+    193c:	       55                   	push   %rbp
+    193d:	       48 89 e5             	mov    %rsp,%rbp
+    1940:	       48 83 ec 50          	sub    $0x50,%rsp
+    1944:	       48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+        auto v = Vec::empty();
+    1948:	       48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    194c:	       48 89 c7             	mov    %rax,%rdi
+    194f:	       e8 6b 04 00 00       	call   1dbf <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::empty()>
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    1954:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    195b:	       00 
+    195c:	   /-- eb 61                	jmp    19bf <bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)::{lambda()#1}::operator()() const+0x83>
+            v.push(int(i)).is_ok();
+    195e:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1962:	|  |   89 45 dc             	mov    %eax,-0x24(%rbp)
+    1965:	|  |   48 8d 45 d4          	lea    -0x2c(%rbp),%rax
+    1969:	|  |   48 8d 55 dc          	lea    -0x24(%rbp),%rdx
+    196d:	|  |   48 8d 4d c8          	lea    -0x38(%rbp),%rcx
+    1971:	|  |   48 89 ce             	mov    %rcx,%rsi
+    1974:	|  |   48 89 c7             	mov    %rax,%rdi
+    1977:	|  |   e8 80 04 00 00       	call   1dfc <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::push(int&&)>
+    197c:	|  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1980:	|  |   b9 38 00 00 00       	mov    $0x38,%ecx
+    1985:	|  |   48 8d 15 15 27 00 00 	lea    0x2715(%rip),%rdx        # 40a1 <n_pushes+0x71>
+    198c:	|  |   48 8d 35 27 27 00 00 	lea    0x2727(%rip),%rsi        # 40ba <n_pushes+0x8a>
+    1993:	|  |   48 89 c7             	mov    %rax,%rdi
+    1996:	|  |   e8 49 fa ff ff       	call   13e4 <nel::Context::Context(char const*, char const*, int)>
+    199b:	|  |   48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    199f:	|  |   48 8d 45 d4          	lea    -0x2c(%rbp),%rax
+    19a3:	|  |   48 89 d6             	mov    %rdx,%rsi
+    19a6:	|  |   48 89 c7             	mov    %rax,%rdi
+    19a9:	|  |   e8 ca 02 00 00       	call   1c78 <nel::Result<void, int>::is_ok(nel::Context const&) const>
+    19ae:	|  |   48 8d 45 d4          	lea    -0x2c(%rbp),%rax
+    19b2:	|  |   48 89 c7             	mov    %rax,%rdi
+    19b5:	|  |   e8 36 02 00 00       	call   1bf0 <nel::Result<void, int>::~Result()>
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    19ba:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    19bf:	|  \-> 48 81 7d f8 7f 96 98 	cmpq   $0x98967f,-0x8(%rbp)
+    19c6:	|      00 
+    19c7:	\----- 76 95                	jbe    195e <bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)::{lambda()#1}::operator()() const+0x22>
+    });
+    19c9:	       48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    19cd:	       48 89 c7             	mov    %rax,%rdi
+    19d0:	       e8 09 04 00 00       	call   1dde <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::~Vector()>
+    auto t = bench::time_ns([]() {
+    19d5:	       90                   	nop
+    19d6:	       c9                   	leave
+    19d7:	       c3                   	ret
+
+00000000000019d8 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)>:
+void bench_push(char const *const name)
+    19d8:	55                   	push   %rbp
+    19d9:	48 89 e5             	mov    %rsp,%rbp
+    19dc:	48 83 ec 20          	sub    $0x20,%rsp
+    19e0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Counting::reallocs = 0;
+    19e4:	48 c7 05 a1 56 00 00 	movq   $0x0,0x56a1(%rip)        # 7090 <Counting::reallocs>
+    19eb:	00 00 00 00 
+    Counting::bytes = 0;
+    19ef:	48 c7 05 9e 56 00 00 	movq   $0x0,0x569e(%rip)        # 7098 <Counting::bytes>
+    19f6:	00 00 00 00 
+    auto t = bench::time_ns([]() {
+    19fa:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    19fe:	48 89 c7             	mov    %rax,%rdi
+    1a01:	e8 7f 04 00 00       	call   1e85 <unsigned long bench::time_ns<bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)::{lambda()#1}>(bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)::{lambda()#1}&&)>
+    1a06:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    bench::report(name, t);
+    1a0a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1a0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a12:	ba 00 00 00 00       	mov    $0x0,%edx
+    1a17:	48 89 ce             	mov    %rcx,%rsi
+    1a1a:	48 89 c7             	mov    %rax,%rdi
+    1a1d:	e8 bd f8 ff ff       	call   12df <bench::report(char const*, unsigned long, unsigned long)>
+             << Counting::bytes << '\n';
+    1a22:	48 8d 05 9c 26 00 00 	lea    0x269c(%rip),%rax        # 40c5 <n_pushes+0x95>
+    1a29:	48 89 c6             	mov    %rax,%rsi
+    1a2c:	48 8d 05 6d 56 00 00 	lea    0x566d(%rip),%rax        # 70a0 <nel::log>
+    1a33:	48 89 c7             	mov    %rax,%rdi
+    1a36:	e8 5c 1d 00 00       	call   3797 <nel::operator<<(nel::Log&, char const*)>
+    1a3b:	48 89 c2             	mov    %rax,%rdx
+    1a3e:	48 8b 05 4b 56 00 00 	mov    0x564b(%rip),%rax        # 7090 <Counting::reallocs>
+    1a45:	48 89 c6             	mov    %rax,%rsi
+    1a48:	48 89 d7             	mov    %rdx,%rdi
+    1a4b:	e8 52 1e 00 00       	call   38a2 <nel::operator<<(nel::Log&, unsigned long)>
+    1a50:	48 89 c2             	mov    %rax,%rdx
+    1a53:	48 8d 05 78 26 00 00 	lea    0x2678(%rip),%rax        # 40d2 <n_pushes+0xa2>
+    1a5a:	48 89 c6             	mov    %rax,%rsi
+    1a5d:	48 89 d7             	mov    %rdx,%rdi
+    1a60:	e8 32 1d 00 00       	call   3797 <nel::operator<<(nel::Log&, char const*)>
+    1a65:	48 89 c2             	mov    %rax,%rdx
+    1a68:	48 8b 05 29 56 00 00 	mov    0x5629(%rip),%rax        # 7098 <Counting::bytes>
+    1a6f:	48 89 c6             	mov    %rax,%rsi
+    1a72:	48 89 d7             	mov    %rdx,%rdi
+    1a75:	e8 28 1e 00 00       	call   38a2 <nel::operator<<(nel::Log&, unsigned long)>
+    1a7a:	be 0a 00 00 00       	mov    $0xa,%esi
+    1a7f:	48 89 c7             	mov    %rax,%rdi
+    1a82:	e8 e4 1c 00 00       	call   376b <nel::operator<<(nel::Log&, char)>
+}
+    1a87:	90                   	nop
+    1a88:	c9                   	leave
+    1a89:	c3                   	ret
+
+0000000000001a8a <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel so to not need std.
+ */
+template<typename U, typename T>
+constexpr U &&forward(T &t)
+    1a8a:	55                   	push   %rbp
+    1a8b:	48 89 e5             	mov    %rsp,%rbp
+    1a8e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<U &&>(t);
+    1a92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1a96:	5d                   	pop    %rbp
+    1a97:	c3                   	ret
+
+0000000000001a98 <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    1a98:	55                   	push   %rbp
+    1a99:	48 89 e5             	mov    %rsp,%rbp
+    1a9c:	53                   	push   %rbx
+    1a9d:	48 83 ec 18          	sub    $0x18,%rsp
+    1aa1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1aa5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    1aa9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1aad:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    1ab3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ab7:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    1abb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1abf:	48 89 c7             	mov    %rax,%rdi
+    1ac2:	e8 c3 ff ff ff       	call   1a8a <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    1ac7:	48 89 c6             	mov    %rax,%rsi
+    1aca:	48 89 df             	mov    %rbx,%rdi
+    1acd:	e8 e0 03 00 00       	call   1eb2 <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>
+        }
+    1ad2:	90                   	nop
+    1ad3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1ad7:	c9                   	leave
+    1ad8:	c3                   	ret
+
+0000000000001ad9 <void* const& nel::forward<void* const&, void* const>(void* const&)>:
+constexpr U &&forward(T &t)
+    1ad9:	55                   	push   %rbp
+    1ada:	48 89 e5             	mov    %rsp,%rbp
+    1add:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    1ae1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1ae5:	5d                   	pop    %rbp
+    1ae6:	c3                   	ret
+    1ae7:	90                   	nop
+
+0000000000001ae8 <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>:
+        constexpr Result(Phantom<Tag::OK> const, Args &&...args)
+    1ae8:	55                   	push   %rbp
+    1ae9:	48 89 e5             	mov    %rsp,%rbp
+    1aec:	53                   	push   %rbx
+    1aed:	48 83 ec 18          	sub    $0x18,%rsp
+    1af1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1af5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    1af9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1afd:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<Args>(args)...)
+    1b03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b07:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    1b0b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1b0f:	48 89 c7             	mov    %rax,%rdi
+    1b12:	e8 c2 ff ff ff       	call   1ad9 <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    1b17:	48 89 c6             	mov    %rax,%rsi
+    1b1a:	48 89 df             	mov    %rbx,%rdi
+    1b1d:	e8 b8 03 00 00       	call   1eda <nel::Element<void*>::Element<void* const&>(void* const&)>
+        }
+    1b22:	90                   	nop
+    1b23:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1b27:	c9                   	leave
+    1b28:	c3                   	ret
+
+0000000000001b29 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::empty()>:
+        /**
+         * Create a vector with no initial allocation.
+         *
+         * @returns the vector created.
+         */
+        static constexpr Vector empty(void)
+    1b29:	55                   	push   %rbp
+    1b2a:	48 89 e5             	mov    %rsp,%rbp
+    1b2d:	48 83 ec 10          	sub    $0x10,%rsp
+    1b31:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return Vector();
+    1b35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b39:	48 89 c7             	mov    %rax,%rdi
+    1b3c:	e8 c3 03 00 00       	call   1f04 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector()>
+        }
+    1b41:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b45:	c9                   	leave
+    1b46:	c3                   	ret
+    1b47:	90                   	nop
+
+0000000000001b48 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>:
+        ~Vector(void)
+    1b48:	55                   	push   %rbp
+    1b49:	48 89 e5             	mov    %rsp,%rbp
+    1b4c:	48 83 ec 10          	sub    $0x10,%rsp
+    1b50:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            VectorNode::free(item_);
+    1b54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b58:	48 8b 00             	mov    (%rax),%rax
+    1b5b:	48 89 c7             	mov    %rax,%rdi
+    1b5e:	e8 cd 03 00 00       	call   1f30 <nel::heaped::Node<int, Counting>::free(nel::heaped::Node<int, Counting>*)>
+        }
+    1b63:	90                   	nop
+    1b64:	c9                   	leave
+    1b65:	c3                   	ret
+
+0000000000001b66 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>:
+         *
+         * @param val The value to move into the vec.
+         * @returns if successful, Result<void, T>::Ok()
+         * @returns if unsuccessful, Result<void, T>::Err() holding val
+         */
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+    1b66:	       55                   	push   %rbp
+    1b67:	       48 89 e5             	mov    %rsp,%rbp
+    1b6a:	       48 83 ec 30          	sub    $0x30,%rsp
+    1b6e:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1b72:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1b76:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+        {
+            bool ok;
+            ok = try_reserve_for(1);
+    1b7a:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1b7e:	       be 01 00 00 00       	mov    $0x1,%esi
+    1b83:	       48 89 c7             	mov    %rax,%rdi
+    1b86:	       e8 f1 03 00 00       	call   1f7c <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>
+    1b8b:	       88 45 ff             	mov    %al,-0x1(%rbp)
+            if (!ok) { return Result<void, Type>::Err(val); }
+    1b8e:	       0f b6 45 ff          	movzbl -0x1(%rbp),%eax
+    1b92:	       83 f0 01             	xor    $0x1,%eax
+    1b95:	       84 c0                	test   %al,%al
+    1b97:	   /-- 74 15                	je     1bae <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x48>
+    1b99:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b9d:	   |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1ba1:	   |   48 89 d6             	mov    %rdx,%rsi
+    1ba4:	   |   48 89 c7             	mov    %rax,%rdi
+    1ba7:	   |   e8 3b 04 00 00       	call   1fe7 <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    1bac:	/--|-- eb 3b                	jmp    1be9 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x83>
+            if (item_ == nullptr) { return Result<void, Type>::Err(val); }
+    1bae:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1bb2:	|      48 8b 00             	mov    (%rax),%rax
+    1bb5:	|      48 85 c0             	test   %rax,%rax
+    1bb8:	|  /-- 75 15                	jne    1bcf <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x69>
+    1bba:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bbe:	|  |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1bc2:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1bc5:	|  |   48 89 c7             	mov    %rax,%rdi
+    1bc8:	|  |   e8 1a 04 00 00       	call   1fe7 <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    1bcd:	+--|-- eb 1a                	jmp    1be9 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x83>
+            return item_->push_back(val);
+    1bcf:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1bd3:	|      48 8b 08             	mov    (%rax),%rcx
+    1bd6:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bda:	|      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1bde:	|      48 89 ce             	mov    %rcx,%rsi
+    1be1:	|      48 89 c7             	mov    %rax,%rdi
+    1be4:	|      e8 33 04 00 00       	call   201c <nel::Result<void, int> nel::heaped::Node<int, Counting>::push_back<int&>(int&)>
+        }
+    1be9:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bed:	       c9                   	leave
+    1bee:	       c3                   	ret
+    1bef:	       90                   	nop
+
+0000000000001bf0 <nel::Result<void, int>::~Result()>:
+        union {
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    1bf0:	             55                   	push   %rbp
+    1bf1:	             48 89 e5             	mov    %rsp,%rbp
+    1bf4:	             48 83 ec 30          	sub    $0x30,%rsp
+    1bf8:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result<void>-dtor
+    1bfc:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1c00:	             8b 00                	mov    (%rax),%eax
+    1c02:	             83 f8 02             	cmp    $0x2,%eax
+    1c05:	/----------- 74 43                	je     1c4a <nel::Result<void, int>::~Result()+0x5a>
+    1c07:	|            83 f8 02             	cmp    $0x2,%eax
+    1c0a:	|        /-- 7f 09                	jg     1c15 <nel::Result<void, int>::~Result()+0x25>
+    1c0c:	|        |   85 c0                	test   %eax,%eax
+    1c0e:	|  /-----|-- 74 3d                	je     1c4d <nel::Result<void, int>::~Result()+0x5d>
+    1c10:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    1c13:	|  |  /--|-- 74 3b                	je     1c50 <nel::Result<void, int>::~Result()+0x60>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    1c15:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1c19:	|  |  |      b9 dd 02 00 00       	mov    $0x2dd,%ecx
+    1c1e:	|  |  |      48 8d 15 57 24 00 00 	lea    0x2457(%rip),%rdx        # 407c <n_pushes+0x4c>
+    1c25:	|  |  |      48 8d 35 62 24 00 00 	lea    0x2462(%rip),%rsi        # 408e <n_pushes+0x5e>
+    1c2c:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1c2f:	|  |  |      e8 b0 f7 ff ff       	call   13e4 <nel::Context::Context(char const*, char const*, int)>
+    1c34:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1c38:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    1c3b:	|  |  |      48 8d 05 54 24 00 00 	lea    0x2454(%rip),%rax        # 4096 <n_pushes+0x66>
+    1c42:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1c45:	|  |  |      e8 15 12 00 00       	call   2e5f <nel::panic(char const*, nel::Context const&)>
+                    break;
+    1c4a:	\--|--|----> 90                   	nop
+    1c4b:	   |  |  /-- eb 04                	jmp    1c51 <nel::Result<void, int>::~Result()+0x61>
+                    break;
+    1c4d:	   \--|--|-> 90                   	nop
+    1c4e:	      |  +-- eb 01                	jmp    1c51 <nel::Result<void, int>::~Result()+0x61>
+                    break;
+    1c50:	      \--|-> 90                   	nop
+                    break;
+            }
+        }
+    1c51:	         \-> 90                   	nop
+    1c52:	             c9                   	leave
+    1c53:	             c3                   	ret
+
+0000000000001c54 <nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}::operator()() const>:
+         *
+         * `this` is not consumed by this op.
+         */
+        constexpr bool is_ok(Context const &ctx = Context()) const
+        {
+            return match<bool>([](void) -> bool { return true; },
+    1c54:	55                   	push   %rbp
+    1c55:	48 89 e5             	mov    %rsp,%rbp
+    1c58:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1c5c:	b8 01 00 00 00       	mov    $0x1,%eax
+    1c61:	5d                   	pop    %rbp
+    1c62:	c3                   	ret
+    1c63:	90                   	nop
+
+0000000000001c64 <nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}::operator()(int const&) const>:
+                               [](E const &) -> bool { return false; },
+    1c64:	55                   	push   %rbp
+    1c65:	48 89 e5             	mov    %rsp,%rbp
+    1c68:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1c6c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1c70:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c75:	5d                   	pop    %rbp
+    1c76:	c3                   	ret
+    1c77:	90                   	nop
+
+0000000000001c78 <nel::Result<void, int>::is_ok(nel::Context const&) const>:
+        constexpr bool is_ok(Context const &ctx = Context()) const
+    1c78:	55                   	push   %rbp
+    1c79:	48 89 e5             	mov    %rsp,%rbp
+    1c7c:	48 83 ec 20          	sub    $0x20,%rsp
+    1c80:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1c84:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](void) -> bool { return true; },
+    1c88:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1c8c:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    1c90:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    1c94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c98:	48 89 c7             	mov    %rax,%rdi
+    1c9b:	e8 40 04 00 00       	call   20e0 <bool nel::Result<void, int>::match<bool, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}>(nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}&&, nel::Context const&) const>
+                               ctx);
+        }
+    1ca0:	c9                   	leave
+    1ca1:	c3                   	ret
+
+0000000000001ca2 <unsigned long bench::time_ns<bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)::{lambda()#1}>(bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)::{lambda()#1}&&)>:
+            return try_realloc(nullptr, align, 0, size);
+    1ca2:	55                   	push   %rbp
+    1ca3:	48 89 e5             	mov    %rsp,%rbp
+    1ca6:	48 83 ec 20          	sub    $0x20,%rsp
+    1caa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+
+    1cae:	e8 ff f5 ff ff       	call   12b2 <bench::now_ns()>
+    1cb3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        static nel::Result<void *, nel::heaped::AllocError> try_realloc(void *const p,
+    1cb7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cbb:	48 89 c7             	mov    %rax,%rdi
+    1cbe:	e8 dd f9 ff ff       	call   16a0 <bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)::{lambda()#1}::operator()() const>
+                                                                        nel::Length const align,
+    1cc3:	e8 ea f5 ff ff       	call   12b2 <bench::now_ns()>
+    1cc8:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+                                                                        nel::Length const old_size,
+    1ccc:	c9                   	leave
+    1ccd:	c3                   	ret
+
+0000000000001cce <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::empty()>:
+        static constexpr Vector empty(void)
+    1cce:	55                   	push   %rbp
+    1ccf:	48 89 e5             	mov    %rsp,%rbp
+    1cd2:	48 83 ec 10          	sub    $0x10,%rsp
+    1cd6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Vector();
+    1cda:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cde:	48 89 c7             	mov    %rax,%rdi
+    1ce1:	e8 8c 04 00 00       	call   2172 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::Vector()>
+        }
+    1ce6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cea:	c9                   	leave
+    1ceb:	c3                   	ret
+
+0000000000001cec <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::~Vector()>:
+        ~Vector(void)
+    1cec:	55                   	push   %rbp
+    1ced:	48 89 e5             	mov    %rsp,%rbp
+    1cf0:	48 83 ec 10          	sub    $0x10,%rsp
+    1cf4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            VectorNode::free(item_);
+    1cf8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cfc:	48 8b 00             	mov    (%rax),%rax
+    1cff:	48 89 c7             	mov    %rax,%rdi
+    1d02:	e8 29 02 00 00       	call   1f30 <nel::heaped::Node<int, Counting>::free(nel::heaped::Node<int, Counting>*)>
+        }
+    1d07:	90                   	nop
+    1d08:	c9                   	leave
+    1d09:	c3                   	ret
+
+0000000000001d0a <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::push(int&&)>:
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+    1d0a:	       55                   	push   %rbp
+    1d0b:	       48 89 e5             	mov    %rsp,%rbp
+    1d0e:	       48 83 ec 30          	sub    $0x30,%rsp
+    1d12:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1d16:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1d1a:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            ok = try_reserve_for(1);
+    1d1e:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d22:	       be 01 00 00 00       	mov    $0x1,%esi
+    1d27:	       48 89 c7             	mov    %rax,%rdi
+    1d2a:	       e8 59 04 00 00       	call   2188 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::try_reserve_for(unsigned long)>
+    1d2f:	       88 45 ff             	mov    %al,-0x1(%rbp)
+            if (!ok) { return Result<void, Type>::Err(val); }
+    1d32:	       0f b6 45 ff          	movzbl -0x1(%rbp),%eax
+    1d36:	       83 f0 01             	xor    $0x1,%eax
+    1d39:	       84 c0                	test   %al,%al
+    1d3b:	   /-- 74 15                	je     1d52 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::push(int&&)+0x48>
+    1d3d:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d41:	   |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1d45:	   |   48 89 d6             	mov    %rdx,%rsi
+    1d48:	   |   48 89 c7             	mov    %rax,%rdi
+    1d4b:	   |   e8 97 02 00 00       	call   1fe7 <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    1d50:	/--|-- eb 3b                	jmp    1d8d <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::push(int&&)+0x83>
+            if (item_ == nullptr) { return Result<void, Type>::Err(val); }
+    1d52:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d56:	|      48 8b 00             	mov    (%rax),%rax
+    1d59:	|      48 85 c0             	test   %rax,%rax
+    1d5c:	|  /-- 75 15                	jne    1d73 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::push(int&&)+0x69>
+    1d5e:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d62:	|  |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1d66:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1d69:	|  |   48 89 c7             	mov    %rax,%rdi
+    1d6c:	|  |   e8 76 02 00 00       	call   1fe7 <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    1d71:	+--|-- eb 1a                	jmp    1d8d <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::push(int&&)+0x83>
+            return item_->push_back(val);
+    1d73:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d77:	|      48 8b 08             	mov    (%rax),%rcx
+    1d7a:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d7e:	|      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1d82:	|      48 89 ce             	mov    %rcx,%rsi
+    1d85:	|      48 89 c7             	mov    %rax,%rdi
+    1d88:	|      e8 8f 02 00 00       	call   201c <nel::Result<void, int> nel::heaped::Node<int, Counting>::push_back<int&>(int&)>
+        }
+    1d8d:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d91:	       c9                   	leave
+    1d92:	       c3                   	ret
+
+0000000000001d93 <unsigned long bench::time_ns<bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)::{lambda()#1}>(bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)::{lambda()#1}&&)>:
+            return try_realloc(nullptr, align, 0, size);
+    1d93:	55                   	push   %rbp
+    1d94:	48 89 e5             	mov    %rsp,%rbp
+    1d97:	48 83 ec 20          	sub    $0x20,%rsp
+    1d9b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+
+    1d9f:	e8 0e f5 ff ff       	call   12b2 <bench::now_ns()>
+    1da4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        static nel::Result<void *, nel::heaped::AllocError> try_realloc(void *const p,
+    1da8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1dac:	48 89 c7             	mov    %rax,%rdi
+    1daf:	e8 3a fa ff ff       	call   17ee <bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)::{lambda()#1}::operator()() const>
+                                                                        nel::Length const align,
+    1db4:	e8 f9 f4 ff ff       	call   12b2 <bench::now_ns()>
+    1db9:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+                                                                        nel::Length const old_size,
+    1dbd:	c9                   	leave
+    1dbe:	c3                   	ret
+
+0000000000001dbf <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::empty()>:
+        static constexpr Vector empty(void)
+    1dbf:	55                   	push   %rbp
+    1dc0:	48 89 e5             	mov    %rsp,%rbp
+    1dc3:	48 83 ec 10          	sub    $0x10,%rsp
+    1dc7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Vector();
+    1dcb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dcf:	48 89 c7             	mov    %rax,%rdi
+    1dd2:	e8 1d 04 00 00       	call   21f4 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::Vector()>
+        }
+    1dd7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ddb:	c9                   	leave
+    1ddc:	c3                   	ret
+    1ddd:	90                   	nop
+
+0000000000001dde <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::~Vector()>:
+        ~Vector(void)
+    1dde:	55                   	push   %rbp
+    1ddf:	48 89 e5             	mov    %rsp,%rbp
+    1de2:	48 83 ec 10          	sub    $0x10,%rsp
+    1de6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            VectorNode::free(item_);
+    1dea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dee:	48 8b 00             	mov    (%rax),%rax
+    1df1:	48 89 c7             	mov    %rax,%rdi
+    1df4:	e8 37 01 00 00       	call   1f30 <nel::heaped::Node<int, Counting>::free(nel::heaped::Node<int, Counting>*)>
+        }
+    1df9:	90                   	nop
+    1dfa:	c9                   	leave
+    1dfb:	c3                   	ret
+
+0000000000001dfc <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::push(int&&)>:
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+    1dfc:	       55                   	push   %rbp
+    1dfd:	       48 89 e5             	mov    %rsp,%rbp
+    1e00:	       48 83 ec 30          	sub    $0x30,%rsp
+    1e04:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1e08:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1e0c:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            ok = try_reserve_for(1);
+    1e10:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e14:	       be 01 00 00 00       	mov    $0x1,%esi
+    1e19:	       48 89 c7             	mov    %rax,%rdi
+    1e1c:	       e8 e9 03 00 00       	call   220a <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::try_reserve_for(unsigned long)>
+    1e21:	       88 45 ff             	mov    %al,-0x1(%rbp)
+            if (!ok) { return Result<void, Type>::Err(val); }
+    1e24:	       0f b6 45 ff          	movzbl -0x1(%rbp),%eax
+    1e28:	       83 f0 01             	xor    $0x1,%eax
+    1e2b:	       84 c0                	test   %al,%al
+    1e2d:	   /-- 74 15                	je     1e44 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::push(int&&)+0x48>
+    1e2f:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e33:	   |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1e37:	   |   48 89 d6             	mov    %rdx,%rsi
+    1e3a:	   |   48 89 c7             	mov    %rax,%rdi
+    1e3d:	   |   e8 a5 01 00 00       	call   1fe7 <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    1e42:	/--|-- eb 3b                	jmp    1e7f <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::push(int&&)+0x83>
+            if (item_ == nullptr) { return Result<void, Type>::Err(val); }
+    1e44:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e48:	|      48 8b 00             	mov    (%rax),%rax
+    1e4b:	|      48 85 c0             	test   %rax,%rax
+    1e4e:	|  /-- 75 15                	jne    1e65 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::push(int&&)+0x69>
+    1e50:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e54:	|  |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1e58:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1e5b:	|  |   48 89 c7             	mov    %rax,%rdi
+    1e5e:	|  |   e8 84 01 00 00       	call   1fe7 <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    1e63:	+--|-- eb 1a                	jmp    1e7f <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::push(int&&)+0x83>
+            return item_->push_back(val);
+    1e65:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e69:	|      48 8b 08             	mov    (%rax),%rcx
+    1e6c:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e70:	|      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1e74:	|      48 89 ce             	mov    %rcx,%rsi
+    1e77:	|      48 89 c7             	mov    %rax,%rdi
+    1e7a:	|      e8 9d 01 00 00       	call   201c <nel::Result<void, int> nel::heaped::Node<int, Counting>::push_back<int&>(int&)>
+        }
+    1e7f:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e83:	       c9                   	leave
+    1e84:	       c3                   	ret
+
+0000000000001e85 <unsigned long bench::time_ns<bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)::{lambda()#1}>(bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)::{lambda()#1}&&)>:
+            return try_realloc(nullptr, align, 0, size);
+    1e85:	55                   	push   %rbp
+    1e86:	48 89 e5             	mov    %rsp,%rbp
+    1e89:	48 83 ec 20          	sub    $0x20,%rsp
+    1e8d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+
+    1e91:	e8 1c f4 ff ff       	call   12b2 <bench::now_ns()>
+    1e96:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        static nel::Result<void *, nel::heaped::AllocError> try_realloc(void *const p,
+    1e9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e9e:	48 89 c7             	mov    %rax,%rdi
+    1ea1:	e8 96 fa ff ff       	call   193c <bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)::{lambda()#1}::operator()() const>
+                                                                        nel::Length const align,
+    1ea6:	e8 07 f4 ff ff       	call   12b2 <bench::now_ns()>
+    1eab:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+                                                                        nel::Length const old_size,
+    1eaf:	c9                   	leave
+    1eb0:	c3                   	ret
+    1eb1:	90                   	nop
+
+0000000000001eb2 <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>:
+        constexpr Element &operator=(Element const &) const = delete;
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+    1eb2:	55                   	push   %rbp
+    1eb3:	48 89 e5             	mov    %rsp,%rbp
+    1eb6:	48 83 ec 10          	sub    $0x10,%rsp
+    1eba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1ebe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    1ec2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ec6:	48 89 c7             	mov    %rax,%rdi
+    1ec9:	e8 bc fb ff ff       	call   1a8a <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    1ece:	8b 10                	mov    (%rax),%edx
+    1ed0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ed4:	89 10                	mov    %edx,(%rax)
+        {
+        }
+    1ed6:	90                   	nop
+    1ed7:	c9                   	leave
+    1ed8:	c3                   	ret
+    1ed9:	90                   	nop
+
+0000000000001eda <nel::Element<void*>::Element<void* const&>(void* const&)>:
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+    1eda:	55                   	push   %rbp
+    1edb:	48 89 e5             	mov    %rsp,%rbp
+    1ede:	48 83 ec 10          	sub    $0x10,%rsp
+    1ee2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1ee6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Args>(args)...)
+    1eea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1eee:	48 89 c7             	mov    %rax,%rdi
+    1ef1:	e8 e3 fb ff ff       	call   1ad9 <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    1ef6:	48 8b 10             	mov    (%rax),%rdx
+    1ef9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1efd:	48 89 10             	mov    %rdx,(%rax)
+        {
+        }
+    1f00:	90                   	nop
+    1f01:	c9                   	leave
+    1f02:	c3                   	ret
+    1f03:	90                   	nop
+
+0000000000001f04 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector()>:
+        constexpr Vector(void)
+    1f04:	55                   	push   %rbp
+    1f05:	48 89 e5             	mov    %rsp,%rbp
+    1f08:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : item_(nullptr)
+    1f0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f10:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        }
+    1f17:	90                   	nop
+    1f18:	5d                   	pop    %rbp
+    1f19:	c3                   	ret
+
+0000000000001f1a <nel::heaped::Node<int, Counting>::size_of(unsigned long)>:
+        // Largest number of values a node can hold, keeping its size within ISize.
+        static constexpr Count max_capacity = (__PTRDIFF_MAX__ - sizeof(Node)) / sizeof(T);
+
+        // Size in bytes of a node holding cap values.
+        // alignof(T) is included in align of Node.
+        static constexpr Length size_of(Count const cap)
+    1f1a:	55                   	push   %rbp
+    1f1b:	48 89 e5             	mov    %rsp,%rbp
+    1f1e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1f22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f26:	48 83 c0 05          	add    $0x5,%rax
+    1f2a:	48 c1 e0 02          	shl    $0x2,%rax
+        }
+    1f2e:	5d                   	pop    %rbp
+    1f2f:	c3                   	ret
+
+0000000000001f30 <nel::heaped::Node<int, Counting>::free(nel::heaped::Node<int, Counting>*)>:
+        static void free(Node *old)
+    1f30:	       55                   	push   %rbp
+    1f31:	       48 89 e5             	mov    %rsp,%rbp
+    1f34:	       48 83 ec 20          	sub    $0x20,%rsp
+    1f38:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            if (old == nullptr) { return; }
+    1f3c:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1f41:	/----- 74 36                	je     1f79 <nel::heaped::Node<int, Counting>::free(nel::heaped::Node<int, Counting>*)+0x49>
+            Length const sz = size_of(old->alloc_);
+    1f43:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f47:	|      48 8b 00             	mov    (%rax),%rax
+    1f4a:	|      48 89 c7             	mov    %rax,%rdi
+    1f4d:	|      e8 c8 ff ff ff       	call   1f1a <nel::heaped::Node<int, Counting>::size_of(unsigned long)>
+    1f52:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            old->~Node();
+    1f56:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f5a:	|      48 89 c7             	mov    %rax,%rdi
+    1f5d:	|      e8 14 03 00 00       	call   2276 <nel::heaped::Node<int, Counting>::~Node()>
+            Allocator::free(old, alignof(Node), sz);
+    1f62:	|      48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1f66:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f6a:	|      be 08 00 00 00       	mov    $0x8,%esi
+    1f6f:	|      48 89 c7             	mov    %rax,%rdi
+    1f72:	|      e8 2e f6 ff ff       	call   15a5 <Counting::free(void*, unsigned long, unsigned long)>
+    1f77:	|  /-- eb 01                	jmp    1f7a <nel::heaped::Node<int, Counting>::free(nel::heaped::Node<int, Counting>*)+0x4a>
+            if (old == nullptr) { return; }
+    1f79:	\--|-> 90                   	nop
+        }
+    1f7a:	   \-> c9                   	leave
+    1f7b:	       c3                   	ret
+
+0000000000001f7c <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>:
+        bool try_reserve_for(Count const n)
+    1f7c:	       55                   	push   %rbp
+    1f7d:	       48 89 e5             	mov    %rsp,%rbp
+    1f80:	       53                   	push   %rbx
+    1f81:	       48 83 ec 18          	sub    $0x18,%rsp
+    1f85:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1f89:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            if (len() + n <= capacity()) { return true; }
+    1f8d:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f91:	       48 89 c7             	mov    %rax,%rdi
+    1f94:	       e8 13 03 00 00       	call   22ac <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    1f99:	       48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1f9d:	       48 8d 1c 10          	lea    (%rax,%rdx,1),%rbx
+    1fa1:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1fa5:	       48 89 c7             	mov    %rax,%rdi
+    1fa8:	       e8 2f 03 00 00       	call   22dc <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    1fad:	       48 39 d8             	cmp    %rbx,%rax
+    1fb0:	       0f 93 c0             	setae  %al
+    1fb3:	       84 c0                	test   %al,%al
+    1fb5:	   /-- 74 07                	je     1fbe <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x42>
+    1fb7:	   |   b8 01 00 00 00       	mov    $0x1,%eax
+    1fbc:	/--|-- eb 23                	jmp    1fe1 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x65>
+            return try_reserve(len() + n);
+    1fbe:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1fc2:	|      48 89 c7             	mov    %rax,%rdi
+    1fc5:	|      e8 e2 02 00 00       	call   22ac <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    1fca:	|      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1fce:	|      48 01 c2             	add    %rax,%rdx
+    1fd1:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1fd5:	|      48 89 d6             	mov    %rdx,%rsi
+    1fd8:	|      48 89 c7             	mov    %rax,%rdi
+    1fdb:	|      e8 2c 03 00 00       	call   230c <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>
+    1fe0:	|      90                   	nop
+        }
+    1fe1:	\----> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1fe5:	       c9                   	leave
+    1fe6:	       c3                   	ret
+
+0000000000001fe7 <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>:
+        constexpr static Result Err(Args &&...args)
+    1fe7:	55                   	push   %rbp
+    1fe8:	48 89 e5             	mov    %rsp,%rbp
+    1feb:	48 83 ec 10          	sub    $0x10,%rsp
+    1fef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1ff3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    1ff7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ffb:	48 89 c7             	mov    %rax,%rdi
+    1ffe:	e8 5c 04 00 00       	call   245f <int& nel::forward<int&, int>(int&)>
+    2003:	48 89 c2             	mov    %rax,%rdx
+    2006:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    200a:	48 89 d6             	mov    %rdx,%rsi
+    200d:	48 89 c7             	mov    %rax,%rdi
+    2010:	e8 59 04 00 00       	call   246e <nel::Result<void, int>::Result<int&>(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)2>, int&)>
+        }
+    2015:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2019:	c9                   	leave
+    201a:	c3                   	ret
+    201b:	90                   	nop
+
+000000000000201c <nel::Result<void, int> nel::heaped::Node<int, Counting>::push_back<int&>(int&)>:
+            }
+        }
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+    201c:	       55                   	push   %rbp
+    201d:	       48 89 e5             	mov    %rsp,%rbp
+    2020:	       53                   	push   %rbx
+    2021:	       48 83 ec 28          	sub    $0x28,%rsp
+    2025:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2029:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    202d:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+        {
+            if (len() >= capacity()) {
+    2031:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2035:	       48 89 c7             	mov    %rax,%rdi
+    2038:	       e8 73 04 00 00       	call   24b0 <nel::heaped::Node<int, Counting>::len() const>
+    203d:	       48 89 c3             	mov    %rax,%rbx
+    2040:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2044:	       48 89 c7             	mov    %rax,%rdi
+    2047:	       e8 76 04 00 00       	call   24c2 <nel::heaped::Node<int, Counting>::capacity() const>
+    204c:	       48 39 c3             	cmp    %rax,%rbx
+    204f:	       0f 93 c0             	setae  %al
+    2052:	       84 c0                	test   %al,%al
+    2054:	   /-- 74 20                	je     2076 <nel::Result<void, int> nel::heaped::Node<int, Counting>::push_back<int&>(int&)+0x5a>
+                // TODO: don't want to create a T on error though..
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+    2056:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    205a:	   |   48 89 c7             	mov    %rax,%rdi
+    205d:	   |   e8 fd 03 00 00       	call   245f <int& nel::forward<int&, int>(int&)>
+    2062:	   |   48 89 c2             	mov    %rax,%rdx
+    2065:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2069:	   |   48 89 d6             	mov    %rdx,%rsi
+    206c:	   |   48 89 c7             	mov    %rax,%rdi
+    206f:	   |   e8 73 ff ff ff       	call   1fe7 <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    2074:	/--|-- eb 5f                	jmp    20d5 <nel::Result<void, int> nel::heaped::Node<int, Counting>::push_back<int&>(int&)+0xb9>
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    2076:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    207a:	|      48 89 c7             	mov    %rax,%rdi
+    207d:	|      e8 2e 04 00 00       	call   24b0 <nel::heaped::Node<int, Counting>::len() const>
+    2082:	|      48 83 c0 04          	add    $0x4,%rax
+    2086:	|      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    208d:	|      00 
+    208e:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2092:	|      48 01 d0             	add    %rdx,%rax
+    2095:	|      48 89 c6             	mov    %rax,%rsi
+    2098:	|      bf 04 00 00 00       	mov    $0x4,%edi
+    209d:	|      e8 30 f3 ff ff       	call   13d2 <operator new(unsigned long, void*)>
+    20a2:	|      48 89 c3             	mov    %rax,%rbx
+    20a5:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    20a9:	|      48 89 c7             	mov    %rax,%rdi
+    20ac:	|      e8 ae 03 00 00       	call   245f <int& nel::forward<int&, int>(int&)>
+    20b1:	|      8b 00                	mov    (%rax),%eax
+    20b3:	|      89 03                	mov    %eax,(%rbx)
+            len_ += 1;
+    20b5:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    20b9:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    20bd:	|      48 8d 50 01          	lea    0x1(%rax),%rdx
+    20c1:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    20c5:	|      48 89 50 08          	mov    %rdx,0x8(%rax)
+            return Result<void, Type>::Ok();
+    20c9:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20cd:	|      48 89 c7             	mov    %rax,%rdi
+    20d0:	|      e8 fe 03 00 00       	call   24d3 <nel::Result<void, int>::Ok()>
+        }
+    20d5:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20d9:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    20dd:	       c9                   	leave
+    20de:	       c3                   	ret
+    20df:	       90                   	nop
+
+00000000000020e0 <bool nel::Result<void, int>::match<bool, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}>(nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    20e0:	             55                   	push   %rbp
+    20e1:	             48 89 e5             	mov    %rsp,%rbp
+    20e4:	             48 83 ec 20          	sub    $0x20,%rsp
+    20e8:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    20ec:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    20f0:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    20f4:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result<void>-match
+    20f8:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20fc:	             8b 00                	mov    (%rax),%eax
+    20fe:	             83 f8 02             	cmp    $0x2,%eax
+    2101:	         /-- 74 1c                	je     211f <bool nel::Result<void, int>::match<bool, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}>(nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}&&, nel::Context const&) const+0x3f>
+    2103:	         |   83 f8 02             	cmp    $0x2,%eax
+    2106:	/--------|-- 7f 51                	jg     2159 <bool nel::Result<void, int>::match<bool, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}>(nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}&&, nel::Context const&) const+0x79>
+    2108:	|        |   85 c0                	test   %eax,%eax
+    210a:	|     /--|-- 74 37                	je     2143 <bool nel::Result<void, int>::match<bool, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}>(nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}&&, nel::Context const&) const+0x63>
+    210c:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    210f:	+-----|--|-- 75 48                	jne    2159 <bool nel::Result<void, int>::match<bool, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}>(nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}&&, nel::Context const&) const+0x79>
+                    return on_ok();
+    2111:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2115:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    2118:	|     |  |   e8 37 fb ff ff       	call   1c54 <nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}::operator()() const>
+    211d:	|  /--|--|-- eb 50                	jmp    216f <bool nel::Result<void, int>::match<bool, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}>(nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_err(*err_);
+    211f:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2123:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    2127:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    212a:	|  |  |      e8 c3 03 00 00       	call   24f2 <nel::Element<int>::operator*() const>
+    212f:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    2132:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2136:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    2139:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    213c:	|  |  |      e8 23 fb ff ff       	call   1c64 <nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}::operator()(int const&) const>
+    2141:	|  +--|----- eb 2c                	jmp    216f <bool nel::Result<void, int>::match<bool, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}>(nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}&&, nel::Context const&) const+0x8f>
+                    nel::panic("invalid Result", ctx);
+    2143:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2147:	|  |         48 89 c6             	mov    %rax,%rsi
+    214a:	|  |         48 8d 05 9b 1f 00 00 	lea    0x1f9b(%rip),%rax        # 40ec <n_pushes+0xbc>
+    2151:	|  |         48 89 c7             	mov    %rax,%rdi
+    2154:	|  |         e8 06 0d 00 00       	call   2e5f <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    2159:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    215d:	   |         48 89 c6             	mov    %rax,%rsi
+    2160:	   |         48 8d 05 2f 1f 00 00 	lea    0x1f2f(%rip),%rax        # 4096 <n_pushes+0x66>
+    2167:	   |         48 89 c7             	mov    %rax,%rdi
+    216a:	   |         e8 f0 0c 00 00       	call   2e5f <nel::panic(char const*, nel::Context const&)>
+        }
+    216f:	   \-------> c9                   	leave
+    2170:	             c3                   	ret
+    2171:	             90                   	nop
+
+0000000000002172 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::Vector()>:
+        constexpr Vector(void)
+    2172:	55                   	push   %rbp
+    2173:	48 89 e5             	mov    %rsp,%rbp
+    2176:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : item_(nullptr)
+    217a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    217e:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        }
+    2185:	90                   	nop
+    2186:	5d                   	pop    %rbp
+    2187:	c3                   	ret
+
+0000000000002188 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::try_reserve_for(unsigned long)>:
+        bool try_reserve_for(Count const n)
+    2188:	       55                   	push   %rbp
+    2189:	       48 89 e5             	mov    %rsp,%rbp
+    218c:	       53                   	push   %rbx
+    218d:	       48 83 ec 18          	sub    $0x18,%rsp
+    2191:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2195:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            if (len() + n <= capacity()) { return true; }
+    2199:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    219d:	       48 89 c7             	mov    %rax,%rdi
+    21a0:	       e8 67 03 00 00       	call   250c <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::len() const>
+    21a5:	       48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    21a9:	       48 8d 1c 10          	lea    (%rax,%rdx,1),%rbx
+    21ad:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    21b1:	       48 89 c7             	mov    %rax,%rdi
+    21b4:	       e8 83 03 00 00       	call   253c <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::capacity() const>
+    21b9:	       48 39 d8             	cmp    %rbx,%rax
+    21bc:	       0f 93 c0             	setae  %al
+    21bf:	       84 c0                	test   %al,%al
+    21c1:	   /-- 74 07                	je     21ca <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::try_reserve_for(unsigned long)+0x42>
+    21c3:	   |   b8 01 00 00 00       	mov    $0x1,%eax
+    21c8:	/--|-- eb 23                	jmp    21ed <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::try_reserve_for(unsigned long)+0x65>
+            return try_reserve(len() + n);
+    21ca:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    21ce:	|      48 89 c7             	mov    %rax,%rdi
+    21d1:	|      e8 36 03 00 00       	call   250c <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::len() const>
+    21d6:	|      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    21da:	|      48 01 c2             	add    %rax,%rdx
+    21dd:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    21e1:	|      48 89 d6             	mov    %rdx,%rsi
+    21e4:	|      48 89 c7             	mov    %rax,%rdi
+    21e7:	|      e8 80 03 00 00       	call   256c <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::try_reserve(unsigned long)>
+    21ec:	|      90                   	nop
+        }
+    21ed:	\----> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    21f1:	       c9                   	leave
+    21f2:	       c3                   	ret
+    21f3:	       90                   	nop
+
+00000000000021f4 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::Vector()>:
+        constexpr Vector(void)
+    21f4:	55                   	push   %rbp
+    21f5:	48 89 e5             	mov    %rsp,%rbp
+    21f8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : item_(nullptr)
+    21fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2200:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        }
+    2207:	90                   	nop
+    2208:	5d                   	pop    %rbp
+    2209:	c3                   	ret
+
+000000000000220a <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::try_reserve_for(unsigned long)>:
+        bool try_reserve_for(Count const n)
+    220a:	       55                   	push   %rbp
+    220b:	       48 89 e5             	mov    %rsp,%rbp
+    220e:	       53                   	push   %rbx
+    220f:	       48 83 ec 18          	sub    $0x18,%rsp
+    2213:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2217:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            if (len() + n <= capacity()) { return true; }
+    221b:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    221f:	       48 89 c7             	mov    %rax,%rdi
+    2222:	       e8 99 04 00 00       	call   26c0 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::len() const>
+    2227:	       48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    222b:	       48 8d 1c 10          	lea    (%rax,%rdx,1),%rbx
+    222f:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2233:	       48 89 c7             	mov    %rax,%rdi
+    2236:	       e8 b5 04 00 00       	call   26f0 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::capacity() const>
+    223b:	       48 39 d8             	cmp    %rbx,%rax
+    223e:	       0f 93 c0             	setae  %al
+    2241:	       84 c0                	test   %al,%al
+    2243:	   /-- 74 07                	je     224c <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::try_reserve_for(unsigned long)+0x42>
+    2245:	   |   b8 01 00 00 00       	mov    $0x1,%eax
+    224a:	/--|-- eb 23                	jmp    226f <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::try_reserve_for(unsigned long)+0x65>
+            return try_reserve(len() + n);
+    224c:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2250:	|      48 89 c7             	mov    %rax,%rdi
+    2253:	|      e8 68 04 00 00       	call   26c0 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::len() const>
+    2258:	|      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    225c:	|      48 01 c2             	add    %rax,%rdx
+    225f:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2263:	|      48 89 d6             	mov    %rdx,%rsi
+    2266:	|      48 89 c7             	mov    %rax,%rdi
+    2269:	|      e8 b2 04 00 00       	call   2720 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::try_reserve(unsigned long)>
+    226e:	|      90                   	nop
+        }
+    226f:	\----> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2273:	       c9                   	leave
+    2274:	       c3                   	ret
+    2275:	       90                   	nop
+
+0000000000002276 <nel::heaped::Node<int, Counting>::~Node()>:
+        constexpr ~Node(void)
+    2276:	       55                   	push   %rbp
+    2277:	       48 89 e5             	mov    %rsp,%rbp
+    227a:	       48 83 ec 20          	sub    $0x20,%rsp
+    227e:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            for (Index i = 0; i < len(); ++i) {
+    2282:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    2289:	       00 
+    228a:	   /-- eb 05                	jmp    2291 <nel::heaped::Node<int, Counting>::~Node()+0x1b>
+    228c:	/--|-> 48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    2291:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2295:	|      48 89 c7             	mov    %rax,%rdi
+    2298:	|      e8 13 02 00 00       	call   24b0 <nel::heaped::Node<int, Counting>::len() const>
+    229d:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    22a1:	|      0f 92 c0             	setb   %al
+    22a4:	|      84 c0                	test   %al,%al
+    22a6:	\----- 75 e4                	jne    228c <nel::heaped::Node<int, Counting>::~Node()+0x16>
+        }
+    22a8:	       90                   	nop
+    22a9:	       90                   	nop
+    22aa:	       c9                   	leave
+    22ab:	       c3                   	ret
+
+00000000000022ac <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>:
+        constexpr Length len(void) const
+    22ac:	       55                   	push   %rbp
+    22ad:	       48 89 e5             	mov    %rsp,%rbp
+    22b0:	       48 83 ec 10          	sub    $0x10,%rsp
+    22b4:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->len();
+    22b8:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22bc:	       48 8b 00             	mov    (%rax),%rax
+    22bf:	       48 85 c0             	test   %rax,%rax
+    22c2:	/----- 74 11                	je     22d5 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x29>
+    22c4:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22c8:	|      48 8b 00             	mov    (%rax),%rax
+    22cb:	|      48 89 c7             	mov    %rax,%rdi
+    22ce:	|      e8 dd 01 00 00       	call   24b0 <nel::heaped::Node<int, Counting>::len() const>
+    22d3:	|  /-- eb 05                	jmp    22da <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x2e>
+    22d5:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    22da:	   \-> c9                   	leave
+    22db:	       c3                   	ret
+
+00000000000022dc <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>:
+        constexpr Count capacity(void) const
+    22dc:	       55                   	push   %rbp
+    22dd:	       48 89 e5             	mov    %rsp,%rbp
+    22e0:	       48 83 ec 10          	sub    $0x10,%rsp
+    22e4:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->capacity();
+    22e8:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22ec:	       48 8b 00             	mov    (%rax),%rax
+    22ef:	       48 85 c0             	test   %rax,%rax
+    22f2:	/----- 74 11                	je     2305 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x29>
+    22f4:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22f8:	|      48 8b 00             	mov    (%rax),%rax
+    22fb:	|      48 89 c7             	mov    %rax,%rdi
+    22fe:	|      e8 bf 01 00 00       	call   24c2 <nel::heaped::Node<int, Counting>::capacity() const>
+    2303:	|  /-- eb 05                	jmp    230a <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x2e>
+    2305:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    230a:	   \-> c9                   	leave
+    230b:	       c3                   	ret
+
+000000000000230c <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>:
+        bool try_reserve(Count new_cap)
+    230c:	             55                   	push   %rbp
+    230d:	             48 89 e5             	mov    %rsp,%rbp
+    2310:	             48 83 ec 20          	sub    $0x20,%rsp
+    2314:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2318:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            new_cap = Growth::capacity_for(capacity(), new_cap);
+    231c:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2320:	             48 89 c7             	mov    %rax,%rdi
+    2323:	             e8 b4 ff ff ff       	call   22dc <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    2328:	             48 89 c2             	mov    %rax,%rdx
+    232b:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    232f:	             48 89 c6             	mov    %rax,%rsi
+    2332:	             48 89 d7             	mov    %rdx,%rdi
+    2335:	             e8 39 05 00 00       	call   2873 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>
+    233a:	             48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (new_cap < len()) { new_cap = len(); }
+    233e:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2342:	             48 89 c7             	mov    %rax,%rdi
+    2345:	             e8 62 ff ff ff       	call   22ac <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    234a:	             48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    234e:	             0f 92 c0             	setb   %al
+    2351:	             84 c0                	test   %al,%al
+    2353:	         /-- 74 10                	je     2365 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x59>
+    2355:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2359:	         |   48 89 c7             	mov    %rax,%rdi
+    235c:	         |   e8 4b ff ff ff       	call   22ac <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    2361:	         |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (item_ == nullptr) {
+    2365:	         \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2369:	             48 8b 00             	mov    (%rax),%rax
+    236c:	             48 85 c0             	test   %rax,%rax
+    236f:	         /-- 75 2d                	jne    239e <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x92>
+                item_ = VectorNode::malloc(new_cap);
+    2371:	         |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2375:	         |   48 89 c7             	mov    %rax,%rdi
+    2378:	         |   e8 42 05 00 00       	call   28bf <nel::heaped::Node<int, Counting>::malloc(unsigned long)>
+    237d:	         |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2381:	         |   48 89 02             	mov    %rax,(%rdx)
+                if (item_ == nullptr) { return false; }
+    2384:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2388:	         |   48 8b 00             	mov    (%rax),%rax
+    238b:	         |   48 85 c0             	test   %rax,%rax
+    238e:	/--------|-- 0f 85 c4 00 00 00    	jne    2458 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+    2394:	|        |   b8 00 00 00 00       	mov    $0x0,%eax
+    2399:	|  /-----|-- e9 bf 00 00 00       	jmp    245d <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+            } else if (new_cap == item_->capacity()) {
+    239e:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    23a2:	|  |         48 8b 00             	mov    (%rax),%rax
+    23a5:	|  |         48 89 c7             	mov    %rax,%rdi
+    23a8:	|  |         e8 15 01 00 00       	call   24c2 <nel::heaped::Node<int, Counting>::capacity() const>
+    23ad:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    23b1:	|  |         0f 94 c0             	sete   %al
+    23b4:	|  |         84 c0                	test   %al,%al
+    23b6:	+--|-------- 0f 85 9c 00 00 00    	jne    2458 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap > item_->capacity()) {
+    23bc:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    23c0:	|  |         48 8b 00             	mov    (%rax),%rax
+    23c3:	|  |         48 89 c7             	mov    %rax,%rdi
+    23c6:	|  |         e8 f7 00 00 00       	call   24c2 <nel::heaped::Node<int, Counting>::capacity() const>
+    23cb:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    23cf:	|  |         0f 92 c0             	setb   %al
+    23d2:	|  |         84 c0                	test   %al,%al
+    23d4:	|  |  /----- 74 35                	je     240b <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xff>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    23d6:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    23da:	|  |  |      48 8b 00             	mov    (%rax),%rax
+    23dd:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    23e1:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    23e4:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    23e7:	|  |  |      e8 07 06 00 00       	call   29f3 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)>
+    23ec:	|  |  |      48 89 45 f0          	mov    %rax,-0x10(%rbp)
+                if (p == nullptr) { return false; }
+    23f0:	|  |  |      48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    23f5:	|  |  |  /-- 75 07                	jne    23fe <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xf2>
+    23f7:	|  |  |  |   b8 00 00 00 00       	mov    $0x0,%eax
+    23fc:	|  +--|--|-- eb 5f                	jmp    245d <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    23fe:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2402:	|  |  |      48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2406:	|  |  |      48 89 10             	mov    %rdx,(%rax)
+    2409:	+--|--|----- eb 4d                	jmp    2458 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap < item_->capacity()) {
+    240b:	|  |  \----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    240f:	|  |         48 8b 00             	mov    (%rax),%rax
+    2412:	|  |         48 89 c7             	mov    %rax,%rdi
+    2415:	|  |         e8 a8 00 00 00       	call   24c2 <nel::heaped::Node<int, Counting>::capacity() const>
+    241a:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    241e:	|  |         0f 92 c0             	setb   %al
+    2421:	|  |         84 c0                	test   %al,%al
+    2423:	+--|-------- 74 33                	je     2458 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    2425:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2429:	|  |         48 8b 00             	mov    (%rax),%rax
+    242c:	|  |         48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2430:	|  |         48 89 d6             	mov    %rdx,%rsi
+    2433:	|  |         48 89 c7             	mov    %rax,%rdi
+    2436:	|  |         e8 b8 05 00 00       	call   29f3 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)>
+    243b:	|  |         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                if (p == nullptr) { return false; }
+    243f:	|  |         48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2444:	|  |     /-- 75 07                	jne    244d <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x141>
+    2446:	|  |     |   b8 00 00 00 00       	mov    $0x0,%eax
+    244b:	|  +-----|-- eb 10                	jmp    245d <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    244d:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2451:	|  |         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2455:	|  |         48 89 10             	mov    %rdx,(%rax)
+            return true;
+    2458:	\--|-------> b8 01 00 00 00       	mov    $0x1,%eax
+        }
+    245d:	   \-------> c9                   	leave
+    245e:	             c3                   	ret
+
+000000000000245f <int& nel::forward<int&, int>(int&)>:
+constexpr U &&forward(T &t)
+    245f:	55                   	push   %rbp
+    2460:	48 89 e5             	mov    %rsp,%rbp
+    2463:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    2467:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    246b:	5d                   	pop    %rbp
+    246c:	c3                   	ret
+    246d:	90                   	nop
+
+000000000000246e <nel::Result<void, int>::Result<int&>(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)2>, int&)>:
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+    246e:	55                   	push   %rbp
+    246f:	48 89 e5             	mov    %rsp,%rbp
+    2472:	53                   	push   %rbx
+    2473:	48 83 ec 18          	sub    $0x18,%rsp
+    2477:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    247b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    247f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2483:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<Args>(args)...)
+    2489:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    248d:	48 8d 58 04          	lea    0x4(%rax),%rbx
+    2491:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2495:	48 89 c7             	mov    %rax,%rdi
+    2498:	e8 c2 ff ff ff       	call   245f <int& nel::forward<int&, int>(int&)>
+    249d:	48 89 c6             	mov    %rax,%rsi
+    24a0:	48 89 df             	mov    %rbx,%rdi
+    24a3:	e8 a2 06 00 00       	call   2b4a <nel::Element<int>::Element<int&>(int&)>
+        }
+    24a8:	90                   	nop
+    24a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    24ad:	c9                   	leave
+    24ae:	c3                   	ret
+    24af:	90                   	nop
+
+00000000000024b0 <nel::heaped::Node<int, Counting>::len() const>:
+        constexpr Length len(void) const
+    24b0:	55                   	push   %rbp
+    24b1:	48 89 e5             	mov    %rsp,%rbp
+    24b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    24b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24bc:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    24c0:	5d                   	pop    %rbp
+    24c1:	c3                   	ret
+
+00000000000024c2 <nel::heaped::Node<int, Counting>::capacity() const>:
+        constexpr Count capacity(void) const
+    24c2:	55                   	push   %rbp
+    24c3:	48 89 e5             	mov    %rsp,%rbp
+    24c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return alloc_;
+    24ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24ce:	48 8b 00             	mov    (%rax),%rax
+        }
+    24d1:	5d                   	pop    %rbp
+    24d2:	c3                   	ret
+
+00000000000024d3 <nel::Result<void, int>::Ok()>:
+        constexpr static Result Ok(void)
+    24d3:	55                   	push   %rbp
+    24d4:	48 89 e5             	mov    %rsp,%rbp
+    24d7:	48 83 ec 10          	sub    $0x10,%rsp
+    24db:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Result(Phantom<Tag::OK>());
+    24df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24e3:	48 89 c7             	mov    %rax,%rdi
+    24e6:	e8 87 06 00 00       	call   2b72 <nel::Result<void, int>::Result(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)1>)>
+        }
+    24eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24ef:	c9                   	leave
+    24f0:	c3                   	ret
+    24f1:	90                   	nop
+
+00000000000024f2 <nel::Element<int>::operator*() const>:
+        constexpr Type &ref(void)
+        {
+            return value_;
+        }
+
+        constexpr Type const &operator*(void) const
+    24f2:	55                   	push   %rbp
+    24f3:	48 89 e5             	mov    %rsp,%rbp
+    24f6:	48 83 ec 10          	sub    $0x10,%rsp
+    24fa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    24fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2502:	48 89 c7             	mov    %rax,%rdi
+    2505:	e8 7e 06 00 00       	call   2b88 <nel::Element<int>::ref() const>
+        }
+    250a:	c9                   	leave
+    250b:	c3                   	ret
+
+000000000000250c <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::len() const>:
+        constexpr Length len(void) const
+    250c:	       55                   	push   %rbp
+    250d:	       48 89 e5             	mov    %rsp,%rbp
+    2510:	       48 83 ec 10          	sub    $0x10,%rsp
+    2514:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->len();
+    2518:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    251c:	       48 8b 00             	mov    (%rax),%rax
+    251f:	       48 85 c0             	test   %rax,%rax
+    2522:	/----- 74 11                	je     2535 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::len() const+0x29>
+    2524:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2528:	|      48 8b 00             	mov    (%rax),%rax
+    252b:	|      48 89 c7             	mov    %rax,%rdi
+    252e:	|      e8 7d ff ff ff       	call   24b0 <nel::heaped::Node<int, Counting>::len() const>
+    2533:	|  /-- eb 05                	jmp    253a <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::len() const+0x2e>
+    2535:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    253a:	   \-> c9                   	leave
+    253b:	       c3                   	ret
+
+000000000000253c <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::capacity() const>:
+        constexpr Count capacity(void) const
+    253c:	       55                   	push   %rbp
+    253d:	       48 89 e5             	mov    %rsp,%rbp
+    2540:	       48 83 ec 10          	sub    $0x10,%rsp
+    2544:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->capacity();
+    2548:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    254c:	       48 8b 00             	mov    (%rax),%rax
+    254f:	       48 85 c0             	test   %rax,%rax
+    2552:	/----- 74 11                	je     2565 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::capacity() const+0x29>
+    2554:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2558:	|      48 8b 00             	mov    (%rax),%rax
+    255b:	|      48 89 c7             	mov    %rax,%rdi
+    255e:	|      e8 5f ff ff ff       	call   24c2 <nel::heaped::Node<int, Counting>::capacity() const>
+    2563:	|  /-- eb 05                	jmp    256a <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::capacity() const+0x2e>
+    2565:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    256a:	   \-> c9                   	leave
+    256b:	       c3                   	ret
+
+000000000000256c <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::try_reserve(unsigned long)>:
+        bool try_reserve(Count new_cap)
+    256c:	             55                   	push   %rbp
+    256d:	             48 89 e5             	mov    %rsp,%rbp
+    2570:	             48 83 ec 20          	sub    $0x20,%rsp
+    2574:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2578:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            new_cap = Growth::capacity_for(capacity(), new_cap);
+    257c:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2580:	             48 89 c7             	mov    %rax,%rdi
+    2583:	             e8 b4 ff ff ff       	call   253c <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::capacity() const>
+    2588:	             48 89 c2             	mov    %rax,%rdx
+    258b:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    258f:	             48 89 c6             	mov    %rax,%rsi
+    2592:	             48 89 d7             	mov    %rdx,%rdi
+    2595:	             e8 fc 05 00 00       	call   2b96 <nel::heaped::GeometricGrowth<3ul, 2ul>::capacity_for(unsigned long, unsigned long)>
+    259a:	             48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (new_cap < len()) { new_cap = len(); }
+    259e:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25a2:	             48 89 c7             	mov    %rax,%rdi
+    25a5:	             e8 62 ff ff ff       	call   250c <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::len() const>
+    25aa:	             48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    25ae:	             0f 92 c0             	setb   %al
+    25b1:	             84 c0                	test   %al,%al
+    25b3:	         /-- 74 10                	je     25c5 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::try_reserve(unsigned long)+0x59>
+    25b5:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25b9:	         |   48 89 c7             	mov    %rax,%rdi
+    25bc:	         |   e8 4b ff ff ff       	call   250c <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::len() const>
+    25c1:	         |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (item_ == nullptr) {
+    25c5:	         \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25c9:	             48 8b 00             	mov    (%rax),%rax
+    25cc:	             48 85 c0             	test   %rax,%rax
+    25cf:	         /-- 75 2d                	jne    25fe <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::try_reserve(unsigned long)+0x92>
+                item_ = VectorNode::malloc(new_cap);
+    25d1:	         |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    25d5:	         |   48 89 c7             	mov    %rax,%rdi
+    25d8:	         |   e8 e2 02 00 00       	call   28bf <nel::heaped::Node<int, Counting>::malloc(unsigned long)>
+    25dd:	         |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    25e1:	         |   48 89 02             	mov    %rax,(%rdx)
+                if (item_ == nullptr) { return false; }
+    25e4:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25e8:	         |   48 8b 00             	mov    (%rax),%rax
+    25eb:	         |   48 85 c0             	test   %rax,%rax
+    25ee:	/--------|-- 0f 85 c4 00 00 00    	jne    26b8 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::try_reserve(unsigned long)+0x14c>
+    25f4:	|        |   b8 00 00 00 00       	mov    $0x0,%eax
+    25f9:	|  /-----|-- e9 bf 00 00 00       	jmp    26bd <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::try_reserve(unsigned long)+0x151>
+            } else if (new_cap == item_->capacity()) {
+    25fe:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2602:	|  |         48 8b 00             	mov    (%rax),%rax
+    2605:	|  |         48 89 c7             	mov    %rax,%rdi
+    2608:	|  |         e8 b5 fe ff ff       	call   24c2 <nel::heaped::Node<int, Counting>::capacity() const>
+    260d:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    2611:	|  |         0f 94 c0             	sete   %al
+    2614:	|  |         84 c0                	test   %al,%al
+    2616:	+--|-------- 0f 85 9c 00 00 00    	jne    26b8 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap > item_->capacity()) {
+    261c:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2620:	|  |         48 8b 00             	mov    (%rax),%rax
+    2623:	|  |         48 89 c7             	mov    %rax,%rdi
+    2626:	|  |         e8 97 fe ff ff       	call   24c2 <nel::heaped::Node<int, Counting>::capacity() const>
+    262b:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    262f:	|  |         0f 92 c0             	setb   %al
+    2632:	|  |         84 c0                	test   %al,%al
+    2634:	|  |  /----- 74 35                	je     266b <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::try_reserve(unsigned long)+0xff>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    2636:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    263a:	|  |  |      48 8b 00             	mov    (%rax),%rax
+    263d:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2641:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    2644:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2647:	|  |  |      e8 a7 03 00 00       	call   29f3 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)>
+    264c:	|  |  |      48 89 45 f0          	mov    %rax,-0x10(%rbp)
+                if (p == nullptr) { return false; }
+    2650:	|  |  |      48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2655:	|  |  |  /-- 75 07                	jne    265e <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::try_reserve(unsigned long)+0xf2>
+    2657:	|  |  |  |   b8 00 00 00 00       	mov    $0x0,%eax
+    265c:	|  +--|--|-- eb 5f                	jmp    26bd <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    265e:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2662:	|  |  |      48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2666:	|  |  |      48 89 10             	mov    %rdx,(%rax)
+    2669:	+--|--|----- eb 4d                	jmp    26b8 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap < item_->capacity()) {
+    266b:	|  |  \----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    266f:	|  |         48 8b 00             	mov    (%rax),%rax
+    2672:	|  |         48 89 c7             	mov    %rax,%rdi
+    2675:	|  |         e8 48 fe ff ff       	call   24c2 <nel::heaped::Node<int, Counting>::capacity() const>
+    267a:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    267e:	|  |         0f 92 c0             	setb   %al
+    2681:	|  |         84 c0                	test   %al,%al
+    2683:	+--|-------- 74 33                	je     26b8 <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::try_reserve(unsigned long)+0x14c>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    2685:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2689:	|  |         48 8b 00             	mov    (%rax),%rax
+    268c:	|  |         48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2690:	|  |         48 89 d6             	mov    %rdx,%rsi
+    2693:	|  |         48 89 c7             	mov    %rax,%rdi
+    2696:	|  |         e8 58 03 00 00       	call   29f3 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)>
+    269b:	|  |         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                if (p == nullptr) { return false; }
+    269f:	|  |         48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    26a4:	|  |     /-- 75 07                	jne    26ad <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::try_reserve(unsigned long)+0x141>
+    26a6:	|  |     |   b8 00 00 00 00       	mov    $0x0,%eax
+    26ab:	|  +-----|-- eb 10                	jmp    26bd <nel::heaped::Vector<int, Counting, nel::heaped::GeometricGrowth<3ul, 2ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    26ad:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26b1:	|  |         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    26b5:	|  |         48 89 10             	mov    %rdx,(%rax)
+            return true;
+    26b8:	\--|-------> b8 01 00 00 00       	mov    $0x1,%eax
+        }
+    26bd:	   \-------> c9                   	leave
+    26be:	             c3                   	ret
+    26bf:	             90                   	nop
+
+00000000000026c0 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::len() const>:
+        constexpr Length len(void) const
+    26c0:	       55                   	push   %rbp
+    26c1:	       48 89 e5             	mov    %rsp,%rbp
+    26c4:	       48 83 ec 10          	sub    $0x10,%rsp
+    26c8:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->len();
+    26cc:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26d0:	       48 8b 00             	mov    (%rax),%rax
+    26d3:	       48 85 c0             	test   %rax,%rax
+    26d6:	/----- 74 11                	je     26e9 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::len() const+0x29>
+    26d8:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26dc:	|      48 8b 00             	mov    (%rax),%rax
+    26df:	|      48 89 c7             	mov    %rax,%rdi
+    26e2:	|      e8 c9 fd ff ff       	call   24b0 <nel::heaped::Node<int, Counting>::len() const>
+    26e7:	|  /-- eb 05                	jmp    26ee <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::len() const+0x2e>
+    26e9:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    26ee:	   \-> c9                   	leave
+    26ef:	       c3                   	ret
+
+00000000000026f0 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::capacity() const>:
+        constexpr Count capacity(void) const
+    26f0:	       55                   	push   %rbp
+    26f1:	       48 89 e5             	mov    %rsp,%rbp
+    26f4:	       48 83 ec 10          	sub    $0x10,%rsp
+    26f8:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->capacity();
+    26fc:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2700:	       48 8b 00             	mov    (%rax),%rax
+    2703:	       48 85 c0             	test   %rax,%rax
+    2706:	/----- 74 11                	je     2719 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::capacity() const+0x29>
+    2708:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    270c:	|      48 8b 00             	mov    (%rax),%rax
+    270f:	|      48 89 c7             	mov    %rax,%rdi
+    2712:	|      e8 ab fd ff ff       	call   24c2 <nel::heaped::Node<int, Counting>::capacity() const>
+    2717:	|  /-- eb 05                	jmp    271e <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::capacity() const+0x2e>
+    2719:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    271e:	   \-> c9                   	leave
+    271f:	       c3                   	ret
+
+0000000000002720 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::try_reserve(unsigned long)>:
+        bool try_reserve(Count new_cap)
+    2720:	             55                   	push   %rbp
+    2721:	             48 89 e5             	mov    %rsp,%rbp
+    2724:	             48 83 ec 20          	sub    $0x20,%rsp
+    2728:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    272c:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            new_cap = Growth::capacity_for(capacity(), new_cap);
+    2730:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2734:	             48 89 c7             	mov    %rax,%rdi
+    2737:	             e8 b4 ff ff ff       	call   26f0 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::capacity() const>
+    273c:	             48 89 c2             	mov    %rax,%rdx
+    273f:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2743:	             48 89 c6             	mov    %rax,%rsi
+    2746:	             48 89 d7             	mov    %rdx,%rdi
+    2749:	             e8 9e 04 00 00       	call   2bec <nel::heaped::LinearGrowth<16ul>::capacity_for(unsigned long, unsigned long)>
+    274e:	             48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (new_cap < len()) { new_cap = len(); }
+    2752:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2756:	             48 89 c7             	mov    %rax,%rdi
+    2759:	             e8 62 ff ff ff       	call   26c0 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::len() const>
+    275e:	             48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    2762:	             0f 92 c0             	setb   %al
+    2765:	             84 c0                	test   %al,%al
+    2767:	         /-- 74 10                	je     2779 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::try_reserve(unsigned long)+0x59>
+    2769:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    276d:	         |   48 89 c7             	mov    %rax,%rdi
+    2770:	         |   e8 4b ff ff ff       	call   26c0 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::len() const>
+    2775:	         |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (item_ == nullptr) {
+    2779:	         \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    277d:	             48 8b 00             	mov    (%rax),%rax
+    2780:	             48 85 c0             	test   %rax,%rax
+    2783:	         /-- 75 2d                	jne    27b2 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::try_reserve(unsigned long)+0x92>
+                item_ = VectorNode::malloc(new_cap);
+    2785:	         |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2789:	         |   48 89 c7             	mov    %rax,%rdi
+    278c:	         |   e8 2e 01 00 00       	call   28bf <nel::heaped::Node<int, Counting>::malloc(unsigned long)>
+    2791:	         |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2795:	         |   48 89 02             	mov    %rax,(%rdx)
+                if (item_ == nullptr) { return false; }
+    2798:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    279c:	         |   48 8b 00             	mov    (%rax),%rax
+    279f:	         |   48 85 c0             	test   %rax,%rax
+    27a2:	/--------|-- 0f 85 c4 00 00 00    	jne    286c <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::try_reserve(unsigned long)+0x14c>
+    27a8:	|        |   b8 00 00 00 00       	mov    $0x0,%eax
+    27ad:	|  /-----|-- e9 bf 00 00 00       	jmp    2871 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::try_reserve(unsigned long)+0x151>
+            } else if (new_cap == item_->capacity()) {
+    27b2:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27b6:	|  |         48 8b 00             	mov    (%rax),%rax
+    27b9:	|  |         48 89 c7             	mov    %rax,%rdi
+    27bc:	|  |         e8 01 fd ff ff       	call   24c2 <nel::heaped::Node<int, Counting>::capacity() const>
+    27c1:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    27c5:	|  |         0f 94 c0             	sete   %al
+    27c8:	|  |         84 c0                	test   %al,%al
+    27ca:	+--|-------- 0f 85 9c 00 00 00    	jne    286c <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap > item_->capacity()) {
+    27d0:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27d4:	|  |         48 8b 00             	mov    (%rax),%rax
+    27d7:	|  |         48 89 c7             	mov    %rax,%rdi
+    27da:	|  |         e8 e3 fc ff ff       	call   24c2 <nel::heaped::Node<int, Counting>::capacity() const>
+    27df:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    27e3:	|  |         0f 92 c0             	setb   %al
+    27e6:	|  |         84 c0                	test   %al,%al
+    27e8:	|  |  /----- 74 35                	je     281f <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::try_reserve(unsigned long)+0xff>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    27ea:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27ee:	|  |  |      48 8b 00             	mov    (%rax),%rax
+    27f1:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    27f5:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    27f8:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    27fb:	|  |  |      e8 f3 01 00 00       	call   29f3 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)>
+    2800:	|  |  |      48 89 45 f0          	mov    %rax,-0x10(%rbp)
+                if (p == nullptr) { return false; }
+    2804:	|  |  |      48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2809:	|  |  |  /-- 75 07                	jne    2812 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::try_reserve(unsigned long)+0xf2>
+    280b:	|  |  |  |   b8 00 00 00 00       	mov    $0x0,%eax
+    2810:	|  +--|--|-- eb 5f                	jmp    2871 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    2812:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2816:	|  |  |      48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    281a:	|  |  |      48 89 10             	mov    %rdx,(%rax)
+    281d:	+--|--|----- eb 4d                	jmp    286c <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap < item_->capacity()) {
+    281f:	|  |  \----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2823:	|  |         48 8b 00             	mov    (%rax),%rax
+    2826:	|  |         48 89 c7             	mov    %rax,%rdi
+    2829:	|  |         e8 94 fc ff ff       	call   24c2 <nel::heaped::Node<int, Counting>::capacity() const>
+    282e:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    2832:	|  |         0f 92 c0             	setb   %al
+    2835:	|  |         84 c0                	test   %al,%al
+    2837:	+--|-------- 74 33                	je     286c <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::try_reserve(unsigned long)+0x14c>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    2839:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    283d:	|  |         48 8b 00             	mov    (%rax),%rax
+    2840:	|  |         48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2844:	|  |         48 89 d6             	mov    %rdx,%rsi
+    2847:	|  |         48 89 c7             	mov    %rax,%rdi
+    284a:	|  |         e8 a4 01 00 00       	call   29f3 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)>
+    284f:	|  |         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                if (p == nullptr) { return false; }
+    2853:	|  |         48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2858:	|  |     /-- 75 07                	jne    2861 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::try_reserve(unsigned long)+0x141>
+    285a:	|  |     |   b8 00 00 00 00       	mov    $0x0,%eax
+    285f:	|  +-----|-- eb 10                	jmp    2871 <nel::heaped::Vector<int, Counting, nel::heaped::LinearGrowth<16ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    2861:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2865:	|  |         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2869:	|  |         48 89 10             	mov    %rdx,(%rax)
+            return true;
+    286c:	\--|-------> b8 01 00 00 00       	mov    $0x1,%eax
+        }
+    2871:	   \-------> c9                   	leave
+    2872:	             c3                   	ret
+
+0000000000002873 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>:
+
+    public:
+        // Smallest non-zero capacity grown to, saves the first few tiny reallocs.
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+    2873:	          55                   	push   %rbp
+    2874:	          48 89 e5             	mov    %rsp,%rbp
+    2877:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    287b:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            if (cap <= cur) { return cap; }
+    287f:	          48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2883:	          48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    2887:	      /-- 72 06                	jb     288f <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x1c>
+    2889:	      |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    288d:	/-----|-- eb 2e                	jmp    28bd <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x4a>
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    288f:	|     \-> 48 83 7d e8 03       	cmpq   $0x3,-0x18(%rbp)
+    2894:	|  /----- 76 09                	jbe    289f <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x2c>
+    2896:	|  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    289a:	|  |      48 01 c0             	add    %rax,%rax
+    289d:	|  |  /-- eb 05                	jmp    28a4 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x31>
+    289f:	|  \--|-> b8 04 00 00 00       	mov    $0x4,%eax
+    28a4:	|     \-> 48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return (cap < g) ? g : cap;
+    28a8:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    28ac:	|         48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    28b0:	|  /----- 73 06                	jae    28b8 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x45>
+    28b2:	|  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28b6:	|  |  /-- eb 04                	jmp    28bc <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x49>
+    28b8:	|  \--|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    28bc:	|     \-> 90                   	nop
+        }
+    28bd:	\-------> 5d                   	pop    %rbp
+    28be:	          c3                   	ret
+
+00000000000028bf <nel::heaped::Node<int, Counting>::malloc(unsigned long)>:
+        static Node *malloc(Count capacity)
+    28bf:	    55                   	push   %rbp
+    28c0:	    48 89 e5             	mov    %rsp,%rbp
+    28c3:	    48 83 ec 20          	sub    $0x20,%rsp
+    28c7:	    48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            Node *new_n = realloc(nullptr, capacity);
+    28cb:	    48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28cf:	    48 89 c6             	mov    %rax,%rsi
+    28d2:	    bf 00 00 00 00       	mov    $0x0,%edi
+    28d7:	    e8 17 01 00 00       	call   29f3 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)>
+    28dc:	    48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    28e0:	    48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    28e5:	/-- 74 0c                	je     28f3 <nel::heaped::Node<int, Counting>::malloc(unsigned long)+0x34>
+    28e7:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28eb:	|   48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    28f2:	|   00 
+            return new_n;
+    28f3:	\-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    28f7:	    c9                   	leave
+    28f8:	    c3                   	ret
+    28f9:	    90                   	nop
+
+00000000000028fa <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>:
+            return match<bool>([](T const &) -> bool { return false; },
+    28fa:	55                   	push   %rbp
+    28fb:	48 89 e5             	mov    %rsp,%rbp
+    28fe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2902:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2906:	b8 00 00 00 00       	mov    $0x0,%eax
+    290b:	5d                   	pop    %rbp
+    290c:	c3                   	ret
+    290d:	90                   	nop
+
+000000000000290e <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>:
+                               [](E const &) -> bool { return true; },
+    290e:	55                   	push   %rbp
+    290f:	48 89 e5             	mov    %rsp,%rbp
+    2912:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2916:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    291a:	b8 01 00 00 00       	mov    $0x1,%eax
+    291f:	5d                   	pop    %rbp
+    2920:	c3                   	ret
+    2921:	90                   	nop
+
+0000000000002922 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>:
+        constexpr bool is_err(Context const &ctx = Context()) const
+    2922:	55                   	push   %rbp
+    2923:	48 89 e5             	mov    %rsp,%rbp
+    2926:	48 83 ec 20          	sub    $0x20,%rsp
+    292a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    292e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](T const &) -> bool { return false; },
+    2932:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2936:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    293a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    293e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2942:	48 89 c7             	mov    %rax,%rdi
+    2945:	e8 02 00 00 00       	call   294c <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>
+        }
+    294a:	c9                   	leave
+    294b:	c3                   	ret
+
+000000000000294c <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    294c:	             55                   	push   %rbp
+    294d:	             48 89 e5             	mov    %rsp,%rbp
+    2950:	             48 83 ec 20          	sub    $0x20,%rsp
+    2954:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2958:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    295c:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2960:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result-match
+    2964:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2968:	             8b 00                	mov    (%rax),%eax
+    296a:	             83 f8 02             	cmp    $0x2,%eax
+    296d:	         /-- 74 32                	je     29a1 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x55>
+    296f:	         |   83 f8 02             	cmp    $0x2,%eax
+    2972:	/--------|-- 7f 67                	jg     29db <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+    2974:	|        |   85 c0                	test   %eax,%eax
+    2976:	|     /--|-- 74 4d                	je     29c5 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x79>
+    2978:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    297b:	+-----|--|-- 75 5e                	jne    29db <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_ok(*ok_);
+    297d:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2981:	|     |  |   48 83 c0 08          	add    $0x8,%rax
+    2985:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    2988:	|     |  |   e8 87 02 00 00       	call   2c14 <nel::Element<void*>::operator*() const>
+    298d:	|     |  |   48 89 c2             	mov    %rax,%rdx
+    2990:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2994:	|     |  |   48 89 d6             	mov    %rdx,%rsi
+    2997:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    299a:	|     |  |   e8 5b ff ff ff       	call   28fa <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>
+    299f:	|  /--|--|-- eb 50                	jmp    29f1 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    return on_err(*err_);
+    29a1:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29a5:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    29a9:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    29ac:	|  |  |      e8 7d 02 00 00       	call   2c2e <nel::Element<nel::heaped::AllocError>::operator*() const>
+    29b1:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    29b4:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    29b8:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    29bb:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    29be:	|  |  |      e8 4b ff ff ff       	call   290e <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>
+    29c3:	|  +--|----- eb 2c                	jmp    29f1 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    nel::panic("invalid Result", ctx);
+    29c5:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29c9:	|  |         48 89 c6             	mov    %rax,%rsi
+    29cc:	|  |         48 8d 05 19 17 00 00 	lea    0x1719(%rip),%rax        # 40ec <n_pushes+0xbc>
+    29d3:	|  |         48 89 c7             	mov    %rax,%rdi
+    29d6:	|  |         e8 84 04 00 00       	call   2e5f <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    29db:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29df:	   |         48 89 c6             	mov    %rax,%rsi
+    29e2:	   |         48 8d 05 ad 16 00 00 	lea    0x16ad(%rip),%rax        # 4096 <n_pushes+0x66>
+    29e9:	   |         48 89 c7             	mov    %rax,%rdi
+    29ec:	   |         e8 6e 04 00 00       	call   2e5f <nel::panic(char const*, nel::Context const&)>
+        }
+    29f1:	   \-------> c9                   	leave
+    29f2:	             c3                   	ret
+
+00000000000029f3 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)>:
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    29f3:	          55                   	push   %rbp
+    29f4:	          48 89 e5             	mov    %rsp,%rbp
+    29f7:	          41 54                	push   %r12
+    29f9:	          53                   	push   %rbx
+    29fa:	          48 83 ec 70          	sub    $0x70,%rsp
+    29fe:	          48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+    2a02:	          48 89 75 80          	mov    %rsi,-0x80(%rbp)
+            if (new_cap > max_capacity) { return nullptr; }
+    2a06:	          48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    2a0d:	          ff ff 1f 
+    2a10:	          48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    2a14:	      /-- 73 0a                	jae    2a20 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)+0x2d>
+    2a16:	      |   bb 00 00 00 00       	mov    $0x0,%ebx
+    2a1b:	/-----|-- e9 1d 01 00 00       	jmp    2b3d <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)+0x14a>
+            Length const new_sz = size_of(new_cap);
+    2a20:	|     \-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    2a24:	|         48 89 c7             	mov    %rax,%rdi
+    2a27:	|         e8 ee f4 ff ff       	call   1f1a <nel::heaped::Node<int, Counting>::size_of(unsigned long)>
+    2a2c:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            Length const old_sz = (old_n == nullptr) ? 0 : size_of(old_n->alloc_);
+    2a30:	|         48 83 7d 88 00       	cmpq   $0x0,-0x78(%rbp)
+    2a35:	|  /----- 74 11                	je     2a48 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)+0x55>
+    2a37:	|  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    2a3b:	|  |      48 8b 00             	mov    (%rax),%rax
+    2a3e:	|  |      48 89 c7             	mov    %rax,%rdi
+    2a41:	|  |      e8 d4 f4 ff ff       	call   1f1a <nel::heaped::Node<int, Counting>::size_of(unsigned long)>
+    2a46:	|  |  /-- eb 05                	jmp    2a4d <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)+0x5a>
+    2a48:	|  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    2a4d:	|     \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+                auto r = Allocator::try_realloc(old_n, alignof(Node), old_sz, new_sz);
+    2a51:	|         48 8d 45 90          	lea    -0x70(%rbp),%rax
+    2a55:	|         48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2a59:	|         48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2a5d:	|         48 8b 75 88          	mov    -0x78(%rbp),%rsi
+    2a61:	|         49 89 c8             	mov    %rcx,%r8
+    2a64:	|         48 89 d1             	mov    %rdx,%rcx
+    2a67:	|         ba 08 00 00 00       	mov    $0x8,%edx
+    2a6c:	|         48 89 c7             	mov    %rax,%rdi
+    2a6f:	|         e8 c9 ea ff ff       	call   153d <Counting::try_realloc(void*, unsigned long, unsigned long, unsigned long)>
+                if (r.is_err()) { return nullptr; }
+    2a74:	|         48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    2a78:	|         b9 89 00 00 00       	mov    $0x89,%ecx
+    2a7d:	|         48 8d 15 77 16 00 00 	lea    0x1677(%rip),%rdx        # 40fb <n_pushes+0xcb>
+    2a84:	|         48 8d 35 87 16 00 00 	lea    0x1687(%rip),%rsi        # 4112 <n_pushes+0xe2>
+    2a8b:	|         48 89 c7             	mov    %rax,%rdi
+    2a8e:	|         e8 51 e9 ff ff       	call   13e4 <nel::Context::Context(char const*, char const*, int)>
+    2a93:	|         48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    2a97:	|         48 8d 45 90          	lea    -0x70(%rbp),%rax
+    2a9b:	|         48 89 d6             	mov    %rdx,%rsi
+    2a9e:	|         48 89 c7             	mov    %rax,%rdi
+    2aa1:	|         e8 7c fe ff ff       	call   2922 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>
+    2aa6:	|         84 c0                	test   %al,%al
+    2aa8:	|     /-- 74 0d                	je     2ab7 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)+0xc4>
+    2aaa:	|     |   bb 00 00 00 00       	mov    $0x0,%ebx
+    2aaf:	|     |   41 bc 00 00 00 00    	mov    $0x0,%r12d
+    2ab5:	|  /--|-- eb 3c                	jmp    2af3 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)+0x100>
+                new_n = reinterpret_cast<Node *>(r.unwrap());
+    2ab7:	|  |  \-> 48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2abb:	|  |      b9 8a 00 00 00       	mov    $0x8a,%ecx
+    2ac0:	|  |      48 8d 15 34 16 00 00 	lea    0x1634(%rip),%rdx        # 40fb <n_pushes+0xcb>
+    2ac7:	|  |      48 8d 35 44 16 00 00 	lea    0x1644(%rip),%rsi        # 4112 <n_pushes+0xe2>
+    2ace:	|  |      48 89 c7             	mov    %rax,%rdi
+    2ad1:	|  |      e8 0e e9 ff ff       	call   13e4 <nel::Context::Context(char const*, char const*, int)>
+    2ad6:	|  |      48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    2ada:	|  |      48 8d 45 90          	lea    -0x70(%rbp),%rax
+    2ade:	|  |      48 89 d6             	mov    %rdx,%rsi
+    2ae1:	|  |      48 89 c7             	mov    %rax,%rdi
+    2ae4:	|  |      e8 ab 01 00 00       	call   2c94 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+    2ae9:	|  |      48 89 45 e8          	mov    %rax,-0x18(%rbp)
+            } else {
+    2aed:	|  |      41 bc 01 00 00 00    	mov    $0x1,%r12d
+    2af3:	|  \----> 48 8d 45 90          	lea    -0x70(%rbp),%rax
+    2af7:	|         48 89 c7             	mov    %rax,%rdi
+    2afa:	|         e8 d5 ea ff ff       	call   15d4 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+    2aff:	|         41 83 fc 01          	cmp    $0x1,%r12d
+    2b03:	+-------- 75 38                	jne    2b3d <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)+0x14a>
+    2b05:	|         90                   	nop
+                if (new_sz > old_sz) {
+    2b06:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2b0a:	|         48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    2b0e:	|     /-- 73 1e                	jae    2b2e <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)+0x13b>
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+    2b10:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2b14:	|     |   48 2b 45 d8          	sub    -0x28(%rbp),%rax
+    2b18:	|     |   48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    2b1c:	|     |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2b20:	|     |   48 01 ca             	add    %rcx,%rdx
+    2b23:	|     |   48 89 c6             	mov    %rax,%rsi
+    2b26:	|     |   48 89 d7             	mov    %rdx,%rdi
+    2b29:	|     |   e8 b2 04 00 00       	call   2fe0 <nel::elem::wipe(unsigned char*, unsigned long)>
+            new_n->alloc_ = new_cap;
+    2b2e:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b32:	|         48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    2b36:	|         48 89 10             	mov    %rdx,(%rax)
+            return new_n;
+    2b39:	|         48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+        }
+    2b3d:	\-------> 48 89 d8             	mov    %rbx,%rax
+    2b40:	          48 83 c4 70          	add    $0x70,%rsp
+    2b44:	          5b                   	pop    %rbx
+    2b45:	          41 5c                	pop    %r12
+    2b47:	          5d                   	pop    %rbp
+    2b48:	          c3                   	ret
+    2b49:	          90                   	nop
+
+0000000000002b4a <nel::Element<int>::Element<int&>(int&)>:
+        constexpr Element(Args &&...args)
+    2b4a:	55                   	push   %rbp
+    2b4b:	48 89 e5             	mov    %rsp,%rbp
+    2b4e:	48 83 ec 10          	sub    $0x10,%rsp
+    2b52:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2b56:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Args>(args)...)
+    2b5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b5e:	48 89 c7             	mov    %rax,%rdi
+    2b61:	e8 f9 f8 ff ff       	call   245f <int& nel::forward<int&, int>(int&)>
+    2b66:	8b 10                	mov    (%rax),%edx
+    2b68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b6c:	89 10                	mov    %edx,(%rax)
+        }
+    2b6e:	90                   	nop
+    2b6f:	c9                   	leave
+    2b70:	c3                   	ret
+    2b71:	90                   	nop
+
+0000000000002b72 <nel::Result<void, int>::Result(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)1>)>:
+        constexpr Result(Phantom<Tag::OK> const)
+    2b72:	55                   	push   %rbp
+    2b73:	48 89 e5             	mov    %rsp,%rbp
+    2b76:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : tag_(Tag::OK)
+    2b7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b7e:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+        }
+    2b84:	90                   	nop
+    2b85:	5d                   	pop    %rbp
+    2b86:	c3                   	ret
+    2b87:	90                   	nop
+
+0000000000002b88 <nel::Element<int>::ref() const>:
+        constexpr Type const &ref(void) const
+    2b88:	55                   	push   %rbp
+    2b89:	48 89 e5             	mov    %rsp,%rbp
+    2b8c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2b90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2b94:	5d                   	pop    %rbp
+    2b95:	c3                   	ret
+
+0000000000002b96 <nel::heaped::GeometricGrowth<3ul, 2ul>::capacity_for(unsigned long, unsigned long)>:
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+    2b96:	          55                   	push   %rbp
+    2b97:	          48 89 e5             	mov    %rsp,%rbp
+    2b9a:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2b9e:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            if (cap <= cur) { return cap; }
+    2ba2:	          48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2ba6:	          48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    2baa:	      /-- 72 06                	jb     2bb2 <nel::heaped::GeometricGrowth<3ul, 2ul>::capacity_for(unsigned long, unsigned long)+0x1c>
+    2bac:	      |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2bb0:	/-----|-- eb 38                	jmp    2bea <nel::heaped::GeometricGrowth<3ul, 2ul>::capacity_for(unsigned long, unsigned long)+0x54>
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    2bb2:	|     \-> 48 83 7d e8 03       	cmpq   $0x3,-0x18(%rbp)
+    2bb7:	|  /----- 76 13                	jbe    2bcc <nel::heaped::GeometricGrowth<3ul, 2ul>::capacity_for(unsigned long, unsigned long)+0x36>
+    2bb9:	|  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2bbd:	|  |      48 d1 e8             	shr    %rax
+    2bc0:	|  |      48 89 c2             	mov    %rax,%rdx
+    2bc3:	|  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2bc7:	|  |      48 01 d0             	add    %rdx,%rax
+    2bca:	|  |  /-- eb 05                	jmp    2bd1 <nel::heaped::GeometricGrowth<3ul, 2ul>::capacity_for(unsigned long, unsigned long)+0x3b>
+    2bcc:	|  \--|-> b8 04 00 00 00       	mov    $0x4,%eax
+    2bd1:	|     \-> 48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return (cap < g) ? g : cap;
+    2bd5:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2bd9:	|         48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    2bdd:	|  /----- 73 06                	jae    2be5 <nel::heaped::GeometricGrowth<3ul, 2ul>::capacity_for(unsigned long, unsigned long)+0x4f>
+    2bdf:	|  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2be3:	|  |  /-- eb 04                	jmp    2be9 <nel::heaped::GeometricGrowth<3ul, 2ul>::capacity_for(unsigned long, unsigned long)+0x53>
+    2be5:	|  \--|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2be9:	|     \-> 90                   	nop
+        }
+    2bea:	\-------> 5d                   	pop    %rbp
+    2beb:	          c3                   	ret
+
+0000000000002bec <nel::heaped::LinearGrowth<16ul>::capacity_for(unsigned long, unsigned long)>:
+struct LinearGrowth
+{
+        static_assert(Q > 0, "LinearGrowth: quanta must be > 0");
+
+    public:
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+    2bec:	       55                   	push   %rbp
+    2bed:	       48 89 e5             	mov    %rsp,%rbp
+    2bf0:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2bf4:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            NEL_UNUSED(cur);
+            if (cap == 0) { return 0; }
+    2bf8:	       48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2bfd:	   /-- 75 07                	jne    2c06 <nel::heaped::LinearGrowth<16ul>::capacity_for(unsigned long, unsigned long)+0x1a>
+    2bff:	   |   b8 00 00 00 00       	mov    $0x0,%eax
+    2c04:	/--|-- eb 0c                	jmp    2c12 <nel::heaped::LinearGrowth<16ul>::capacity_for(unsigned long, unsigned long)+0x26>
+            return cap - cap % Q + Q;
+    2c06:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2c0a:	|      48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+    2c0e:	|      48 83 c0 10          	add    $0x10,%rax
+        }
+    2c12:	\----> 5d                   	pop    %rbp
+    2c13:	       c3                   	ret
+
+0000000000002c14 <nel::Element<void*>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    2c14:	55                   	push   %rbp
+    2c15:	48 89 e5             	mov    %rsp,%rbp
+    2c18:	48 83 ec 10          	sub    $0x10,%rsp
+    2c1c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    2c20:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c24:	48 89 c7             	mov    %rax,%rdi
+    2c27:	e8 9a 00 00 00       	call   2cc6 <nel::Element<void*>::ref() const>
+        }
+    2c2c:	c9                   	leave
+    2c2d:	c3                   	ret
+
+0000000000002c2e <nel::Element<nel::heaped::AllocError>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    2c2e:	55                   	push   %rbp
+    2c2f:	48 89 e5             	mov    %rsp,%rbp
+    2c32:	48 83 ec 10          	sub    $0x10,%rsp
+    2c36:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    2c3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c3e:	48 89 c7             	mov    %rax,%rdi
+    2c41:	e8 8e 00 00 00       	call   2cd4 <nel::Element<nel::heaped::AllocError>::ref() const>
+        }
+    2c46:	c9                   	leave
+    2c47:	c3                   	ret
+
+0000000000002c48 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>:
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    2c48:	55                   	push   %rbp
+    2c49:	48 89 e5             	mov    %rsp,%rbp
+    2c4c:	48 83 ec 10          	sub    $0x10,%rsp
+    2c50:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2c54:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2c58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2c5c:	48 89 c7             	mov    %rax,%rdi
+    2c5f:	e8 7e 00 00 00       	call   2ce2 <void*&& nel::forward<void*, void*>(void*&)>
+    2c64:	48 8b 00             	mov    (%rax),%rax
+    2c67:	c9                   	leave
+    2c68:	c3                   	ret
+    2c69:	90                   	nop
+
+0000000000002c6a <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>:
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    2c6a:	55                   	push   %rbp
+    2c6b:	48 89 e5             	mov    %rsp,%rbp
+    2c6e:	48 83 ec 10          	sub    $0x10,%rsp
+    2c72:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2c76:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2c7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c7e:	48 8b 00             	mov    (%rax),%rax
+    2c81:	48 89 c6             	mov    %rax,%rsi
+    2c84:	48 8d 05 8f 14 00 00 	lea    0x148f(%rip),%rax        # 411a <n_pushes+0xea>
+    2c8b:	48 89 c7             	mov    %rax,%rdi
+    2c8e:	e8 cc 01 00 00       	call   2e5f <nel::panic(char const*, nel::Context const&)>
+    2c93:	90                   	nop
+
+0000000000002c94 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>:
+        constexpr T unwrap(Context const &ctx = Context())
+    2c94:	55                   	push   %rbp
+    2c95:	48 89 e5             	mov    %rsp,%rbp
+    2c98:	48 83 ec 20          	sub    $0x20,%rsp
+    2c9c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2ca0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    2ca4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2ca8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    2cac:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2cb0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    2cb4:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    2cb8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2cbc:	48 89 c7             	mov    %rax,%rdi
+    2cbf:	e8 2c 00 00 00       	call   2cf0 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>
+        }
+    2cc4:	c9                   	leave
+    2cc5:	c3                   	ret
+
+0000000000002cc6 <nel::Element<void*>::ref() const>:
+        constexpr Type const &ref(void) const
+    2cc6:	55                   	push   %rbp
+    2cc7:	48 89 e5             	mov    %rsp,%rbp
+    2cca:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2cce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2cd2:	5d                   	pop    %rbp
+    2cd3:	c3                   	ret
+
+0000000000002cd4 <nel::Element<nel::heaped::AllocError>::ref() const>:
+        constexpr Type const &ref(void) const
+    2cd4:	55                   	push   %rbp
+    2cd5:	48 89 e5             	mov    %rsp,%rbp
+    2cd8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2cdc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2ce0:	5d                   	pop    %rbp
+    2ce1:	c3                   	ret
+
+0000000000002ce2 <void*&& nel::forward<void*, void*>(void*&)>:
+constexpr U &&forward(T &t)
+    2ce2:	55                   	push   %rbp
+    2ce3:	48 89 e5             	mov    %rsp,%rbp
+    2ce6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    2cea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2cee:	5d                   	pop    %rbp
+    2cef:	c3                   	ret
+
+0000000000002cf0 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    2cf0:	             55                   	push   %rbp
+    2cf1:	             48 89 e5             	mov    %rsp,%rbp
+    2cf4:	             48 83 ec 30          	sub    $0x30,%rsp
+    2cf8:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2cfc:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2d00:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    2d04:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    2d08:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d0c:	             8b 00                	mov    (%rax),%eax
+    2d0e:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    2d11:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d15:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    2d1b:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    2d1f:	         /-- 74 3e                	je     2d5f <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x6f>
+    2d21:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    2d25:	/--------|-- 7f 7a                	jg     2da1 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+    2d27:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2d2b:	|  /-----|-- 74 5e                	je     2d8b <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x9b>
+    2d2d:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    2d31:	+--|-----|-- 75 6e                	jne    2da1 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+                    return on_ok(forward<T>(*ok_));
+    2d33:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d37:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    2d3b:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2d3e:	|  |     |   e8 77 00 00 00       	call   2dba <nel::Element<void*>::operator*()>
+    2d43:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2d46:	|  |     |   e8 97 ff ff ff       	call   2ce2 <void*&& nel::forward<void*, void*>(void*&)>
+    2d4b:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    2d4e:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2d52:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    2d55:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2d58:	|  |     |   e8 eb fe ff ff       	call   2c48 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>
+    2d5d:	|  |  /--|-- eb 58                	jmp    2db7 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    return on_err(forward<E>(*err_));
+    2d5f:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d63:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    2d67:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2d6a:	|  |  |      e8 65 00 00 00       	call   2dd4 <nel::Element<nel::heaped::AllocError>::operator*()>
+    2d6f:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2d72:	|  |  |      e8 13 ed ff ff       	call   1a8a <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    2d77:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    2d7a:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2d7e:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    2d81:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2d84:	|  |  |      e8 e1 fe ff ff       	call   2c6a <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>
+    2d89:	|  |  +----- eb 2c                	jmp    2db7 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    nel::panic("invalid Result", ctx);
+    2d8b:	|  \--|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2d8f:	|     |      48 89 c6             	mov    %rax,%rsi
+    2d92:	|     |      48 8d 05 53 13 00 00 	lea    0x1353(%rip),%rax        # 40ec <n_pushes+0xbc>
+    2d99:	|     |      48 89 c7             	mov    %rax,%rdi
+    2d9c:	|     |      e8 be 00 00 00       	call   2e5f <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    2da1:	\-----|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2da5:	      |      48 89 c6             	mov    %rax,%rsi
+    2da8:	      |      48 8d 05 e7 12 00 00 	lea    0x12e7(%rip),%rax        # 4096 <n_pushes+0x66>
+    2daf:	      |      48 89 c7             	mov    %rax,%rdi
+    2db2:	      |      e8 a8 00 00 00       	call   2e5f <nel::panic(char const*, nel::Context const&)>
+        }
+    2db7:	      \----> c9                   	leave
+    2db8:	             c3                   	ret
+    2db9:	             90                   	nop
+
+0000000000002dba <nel::Element<void*>::operator*()>:
+
+        constexpr Type &operator*(void)
+    2dba:	55                   	push   %rbp
+    2dbb:	48 89 e5             	mov    %rsp,%rbp
+    2dbe:	48 83 ec 10          	sub    $0x10,%rsp
+    2dc2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    2dc6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2dca:	48 89 c7             	mov    %rax,%rdi
+    2dcd:	e8 1c 00 00 00       	call   2dee <nel::Element<void*>::ref()>
+        }
+    2dd2:	c9                   	leave
+    2dd3:	c3                   	ret
+
+0000000000002dd4 <nel::Element<nel::heaped::AllocError>::operator*()>:
+        constexpr Type &operator*(void)
+    2dd4:	55                   	push   %rbp
+    2dd5:	48 89 e5             	mov    %rsp,%rbp
+    2dd8:	48 83 ec 10          	sub    $0x10,%rsp
+    2ddc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    2de0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2de4:	48 89 c7             	mov    %rax,%rdi
+    2de7:	e8 10 00 00 00       	call   2dfc <nel::Element<nel::heaped::AllocError>::ref()>
+        }
+    2dec:	c9                   	leave
+    2ded:	c3                   	ret
+
+0000000000002dee <nel::Element<void*>::ref()>:
+        constexpr Type &ref(void)
+    2dee:	55                   	push   %rbp
+    2def:	48 89 e5             	mov    %rsp,%rbp
+    2df2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2df6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2dfa:	5d                   	pop    %rbp
+    2dfb:	c3                   	ret
+
+0000000000002dfc <nel::Element<nel::heaped::AllocError>::ref()>:
+        constexpr Type &ref(void)
+    2dfc:	55                   	push   %rbp
+    2dfd:	48 89 e5             	mov    %rsp,%rbp
+    2e00:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2e04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2e08:	5d                   	pop    %rbp
+    2e09:	c3                   	ret
+
+0000000000002e0a <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    2e0a:	55                   	push   %rbp
+    2e0b:	48 89 e5             	mov    %rsp,%rbp
+    std::abort();
+    2e0e:	e8 2d e2 ff ff       	call   1040 <abort@plt>
+
+0000000000002e13 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    2e13:	55                   	push   %rbp
+    2e14:	48 89 e5             	mov    %rsp,%rbp
+    2e17:	48 83 ec 10          	sub    $0x10,%rsp
+    2e1b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    2e1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e23:	48 8b 30             	mov    (%rax),%rsi
+    2e26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e2a:	8b 48 10             	mov    0x10(%rax),%ecx
+    2e2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e31:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2e35:	48 8b 05 44 42 00 00 	mov    0x4244(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    2e3c:	4c 8d 0d e2 12 00 00 	lea    0x12e2(%rip),%r9        # 4125 <nel::is_trivially_relocatable<int>+0x1>
+    2e43:	49 89 f0             	mov    %rsi,%r8
+    2e46:	48 8d 35 de 12 00 00 	lea    0x12de(%rip),%rsi        # 412b <nel::is_trivially_relocatable<int>+0x7>
+    2e4d:	48 89 c7             	mov    %rax,%rdi
+    2e50:	b8 00 00 00 00       	mov    $0x0,%eax
+    2e55:	e8 46 e2 ff ff       	call   10a0 <fprintf@plt>
+    abort();
+    2e5a:	e8 ab ff ff ff       	call   2e0a <nel::abort()>
+
+0000000000002e5f <nel::panic(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    2e5f:	55                   	push   %rbp
+    2e60:	48 89 e5             	mov    %rsp,%rbp
+    2e63:	48 83 ec 10          	sub    $0x10,%rsp
+    2e67:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2e6b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    2e6f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e73:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    2e76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e7a:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    2e7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e81:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    2e85:	48 8b 05 f4 41 00 00 	mov    0x41f4(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    2e8c:	48 83 ec 08          	sub    $0x8,%rsp
+    2e90:	ff 75 f8             	push   -0x8(%rbp)
+    2e93:	4c 8d 0d 8b 12 00 00 	lea    0x128b(%rip),%r9        # 4125 <nel::is_trivially_relocatable<int>+0x1>
+    2e9a:	49 89 f0             	mov    %rsi,%r8
+    2e9d:	48 8d 35 98 12 00 00 	lea    0x1298(%rip),%rsi        # 413c <nel::is_trivially_relocatable<int>+0x18>
+    2ea4:	48 89 c7             	mov    %rax,%rdi
+    2ea7:	b8 00 00 00 00       	mov    $0x0,%eax
+    2eac:	e8 ef e1 ff ff       	call   10a0 <fprintf@plt>
+    2eb1:	48 83 c4 10          	add    $0x10,%rsp
+            "PANIC",
+            msg);
+    abort();
+    2eb5:	e8 50 ff ff ff       	call   2e0a <nel::abort()>
+
+0000000000002eba <nel::assert_fail(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    2eba:	55                   	push   %rbp
+    2ebb:	48 89 e5             	mov    %rsp,%rbp
+    2ebe:	48 83 ec 10          	sub    $0x10,%rsp
+    2ec2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2ec6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    2eca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ece:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    2ed1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ed5:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    2ed8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2edc:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    2ee0:	48 8b 05 99 41 00 00 	mov    0x4199(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    2ee7:	48 83 ec 08          	sub    $0x8,%rsp
+    2eeb:	ff 75 f8             	push   -0x8(%rbp)
+    2eee:	4c 8d 0d 5c 12 00 00 	lea    0x125c(%rip),%r9        # 4151 <nel::is_trivially_relocatable<int>+0x2d>
+    2ef5:	49 89 f0             	mov    %rsi,%r8
+    2ef8:	48 8d 35 3d 12 00 00 	lea    0x123d(%rip),%rsi        # 413c <nel::is_trivially_relocatable<int>+0x18>
+    2eff:	48 89 c7             	mov    %rax,%rdi
+    2f02:	b8 00 00 00 00       	mov    $0x0,%eax
+    2f07:	e8 94 e1 ff ff       	call   10a0 <fprintf@plt>
+    2f0c:	48 83 c4 10          	add    $0x10,%rsp
+            "ASSERT FAIL",
+            msg);
+    abort();
+    2f10:	e8 f5 fe ff ff       	call   2e0a <nel::abort()>
+
+0000000000002f15 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    2f15:	55                   	push   %rbp
+    2f16:	48 89 e5             	mov    %rsp,%rbp
+    2f19:	48 83 ec 20          	sub    $0x20,%rsp
+    2f1d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2f21:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2f25:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    2f29:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2f2d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2f31:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f35:	48 89 ce             	mov    %rcx,%rsi
+    2f38:	48 89 c7             	mov    %rax,%rdi
+    2f3b:	e8 70 e1 ff ff       	call   10b0 <memcpy@plt>
+}
+    2f40:	90                   	nop
+    2f41:	c9                   	leave
+    2f42:	c3                   	ret
+
+0000000000002f43 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    2f43:	55                   	push   %rbp
+    2f44:	48 89 e5             	mov    %rsp,%rbp
+    2f47:	48 83 ec 20          	sub    $0x20,%rsp
+    2f4b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2f4f:	89 f0                	mov    %esi,%eax
+    2f51:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2f55:	88 45 f4             	mov    %al,-0xc(%rbp)
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    2f58:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    2f5c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2f60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f64:	89 ce                	mov    %ecx,%esi
+    2f66:	48 89 c7             	mov    %rax,%rdi
+    2f69:	e8 02 e1 ff ff       	call   1070 <memset@plt>
+}
+    2f6e:	90                   	nop
+    2f6f:	c9                   	leave
+    2f70:	c3                   	ret
+
+0000000000002f71 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    2f71:	55                   	push   %rbp
+    2f72:	48 89 e5             	mov    %rsp,%rbp
+    2f75:	48 83 ec 20          	sub    $0x20,%rsp
+    2f79:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2f7d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2f81:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    //     *id = *is;
+    // }
+    // for (uint8_t *id = d, *is = s, *const e = (d + n); id != e; ++is, ++id) {
+    //     *is = 0xa5;
+    // }
+    copy(d, s, n);
+    2f85:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2f89:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2f8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f91:	48 89 ce             	mov    %rcx,%rsi
+    2f94:	48 89 c7             	mov    %rax,%rdi
+    2f97:	e8 79 ff ff ff       	call   2f15 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    poison(s, n);
+    2f9c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2fa0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2fa4:	48 89 d6             	mov    %rdx,%rsi
+    2fa7:	48 89 c7             	mov    %rax,%rdi
+    2faa:	e8 60 07 00 00       	call   370f <nel::elem::poison(unsigned char*, unsigned long)>
+}
+    2faf:	90                   	nop
+    2fb0:	c9                   	leave
+    2fb1:	c3                   	ret
+
+0000000000002fb2 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    2fb2:	55                   	push   %rbp
+    2fb3:	48 89 e5             	mov    %rsp,%rbp
+    2fb6:	48 83 ec 20          	sub    $0x20,%rsp
+    2fba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2fbe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2fc2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    std::memmove(d, s, n);
+    2fc6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2fca:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2fce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2fd2:	48 89 ce             	mov    %rcx,%rsi
+    2fd5:	48 89 c7             	mov    %rax,%rdi
+    2fd8:	e8 f3 e0 ff ff       	call   10d0 <memmove@plt>
+}
+    2fdd:	90                   	nop
+    2fde:	c9                   	leave
+    2fdf:	c3                   	ret
+
+0000000000002fe0 <nel::elem::wipe(unsigned char*, unsigned long)>:
+
+void wipe(uint8_t *const d, Length const n)
+{
+    2fe0:	55                   	push   %rbp
+    2fe1:	48 89 e5             	mov    %rsp,%rbp
+    2fe4:	48 83 ec 10          	sub    $0x10,%rsp
+    2fe8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2fec:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    set(d, 0xa5, n);
+    2ff0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2ff4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ff8:	be a5 00 00 00       	mov    $0xa5,%esi
+    2ffd:	48 89 c7             	mov    %rax,%rdi
+    3000:	e8 3e ff ff ff       	call   2f43 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    3005:	90                   	nop
+    3006:	c9                   	leave
+    3007:	c3                   	ret
+
+0000000000003008 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    3008:	55                   	push   %rbp
+    3009:	48 89 e5             	mov    %rsp,%rbp
+    300c:	48 83 ec 20          	sub    $0x20,%rsp
+    3010:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3014:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3018:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    301c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3020:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3024:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3028:	48 89 ce             	mov    %rcx,%rsi
+    302b:	48 89 c7             	mov    %rax,%rdi
+    302e:	e8 5d e0 ff ff       	call   1090 <memcmp@plt>
+    3033:	85 c0                	test   %eax,%eax
+    3035:	0f 94 c0             	sete   %al
+}
+    3038:	c9                   	leave
+    3039:	c3                   	ret
+
+000000000000303a <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    303a:	55                   	push   %rbp
+    303b:	48 89 e5             	mov    %rsp,%rbp
+    303e:	48 83 ec 20          	sub    $0x20,%rsp
+    3042:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3046:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    304a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    304e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3052:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3056:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    305a:	48 89 ce             	mov    %rcx,%rsi
+    305d:	48 89 c7             	mov    %rax,%rdi
+    3060:	e8 2b e0 ff ff       	call   1090 <memcmp@plt>
+    3065:	85 c0                	test   %eax,%eax
+    3067:	0f 95 c0             	setne  %al
+}
+    306a:	c9                   	leave
+    306b:	c3                   	ret
+
+000000000000306c <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>:
+
+// d[i] = p[i % 16] for i in [0, n), with normal stores:
+// the pattern once, then doubling the filled region.
+static void set_pattern(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    306c:	       55                   	push   %rbp
+    306d:	       48 89 e5             	mov    %rsp,%rbp
+    3070:	       48 83 ec 30          	sub    $0x30,%rsp
+    3074:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3078:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    307c:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    Length done = (n < 16) ? n : 16;
+    3080:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3084:	       ba 10 00 00 00       	mov    $0x10,%edx
+    3089:	       48 39 d0             	cmp    %rdx,%rax
+    308c:	       48 0f 47 c2          	cmova  %rdx,%rax
+    3090:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    copy(d, p, done);
+    3094:	       48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3098:	       48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    309c:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    30a0:	       48 89 ce             	mov    %rcx,%rsi
+    30a3:	       48 89 c7             	mov    %rax,%rdi
+    30a6:	       e8 6a fe ff ff       	call   2f15 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    while (done < n) {
+    30ab:	   /-- eb 3e                	jmp    30eb <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x7f>
+        Length const m = (done < n - done) ? done : n - done;
+    30ad:	/--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    30b1:	|  |   48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    30b5:	|  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    30b9:	|  |   48 39 c2             	cmp    %rax,%rdx
+    30bc:	|  |   48 0f 46 c2          	cmovbe %rdx,%rax
+    30c0:	|  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        copy(d + done, d, m);
+    30c4:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    30c8:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30cc:	|  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    30d0:	|  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    30d4:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    30d8:	|  |   48 89 c6             	mov    %rax,%rsi
+    30db:	|  |   48 89 cf             	mov    %rcx,%rdi
+    30de:	|  |   e8 32 fe ff ff       	call   2f15 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        done += m;
+    30e3:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    30e7:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+    while (done < n) {
+    30eb:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30ef:	|      48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    30f3:	\----- 72 b8                	jb     30ad <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x41>
+    }
+}
+    30f5:	       90                   	nop
+    30f6:	       90                   	nop
+    30f7:	       c9                   	leave
+    30f8:	       c3                   	ret
+
+00000000000030f9 <nel::elem::load16(unsigned char const*)>:
+static constexpr Length streaming_min = 256;
+
+typedef long long int Line16 __attribute__((vector_size(16)));
+
+static inline Line16 load16(uint8_t const *const s)
+{
+    30f9:	55                   	push   %rbp
+    30fa:	48 89 e5             	mov    %rsp,%rbp
+    30fd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Line16 v;
+    std::memcpy(&v, s, sizeof(v));
+    3101:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3105:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    3109:	48 8b 00             	mov    (%rax),%rax
+    310c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    3110:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    return v;
+    3114:	66 0f 6f 45 f0       	movdqa -0x10(%rbp),%xmm0
+}
+    3119:	5d                   	pop    %rbp
+    311a:	c3                   	ret
+
+000000000000311b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>:
+
+static inline void stream16(uint8_t *const d, Line16 const &v)
+{
+    311b:	55                   	push   %rbp
+    311c:	48 89 e5             	mov    %rsp,%rbp
+    311f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3123:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    3127:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    312b:	66 0f 6f 00          	movdqa (%rax),%xmm0
+    312f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3133:	66 0f e7 00          	movntdq %xmm0,(%rax)
+}
+    3137:	90                   	nop
+    3138:	5d                   	pop    %rbp
+    3139:	c3                   	ret
+
+000000000000313a <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    313a:	          55                   	push   %rbp
+    313b:	          48 89 e5             	mov    %rsp,%rbp
+    313e:	          48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    3142:	          48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    3146:	          48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    314a:	          48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    if (n < streaming_min) {
+    314e:	          48 81 7d 88 ff 00 00 	cmpq   $0xff,-0x78(%rbp)
+    3155:	          00 
+    3156:	      /-- 77 1c                	ja     3174 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        copy(d, s, n);
+    3158:	      |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    315c:	      |   48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    3160:	      |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3164:	      |   48 89 ce             	mov    %rcx,%rsi
+    3167:	      |   48 89 c7             	mov    %rax,%rdi
+    316a:	      |   e8 a6 fd ff ff       	call   2f15 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        return;
+    316f:	/-----|-- e9 98 01 00 00       	jmp    330c <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1d2>
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    3174:	|     \-> 48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3178:	|         48 f7 d8             	neg    %rax
+    317b:	|         83 e0 0f             	and    $0xf,%eax
+    317e:	|         48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    copy(d, s, head);
+    3182:	|         48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3186:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    318a:	|         48 8b 45 98          	mov    -0x68(%rbp),%rax
+    318e:	|         48 89 ce             	mov    %rcx,%rsi
+    3191:	|         48 89 c7             	mov    %rax,%rdi
+    3194:	|         e8 7c fd ff ff       	call   2f15 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    Index i = head;
+    3199:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    319d:	|         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    31a1:	|     /-- e9 e1 00 00 00       	jmp    3287 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        Line16 const a = load16(s + i);
+    31a6:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    31aa:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31ae:	|  |  |   48 01 d0             	add    %rdx,%rax
+    31b1:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    31b4:	|  |  |   e8 40 ff ff ff       	call   30f9 <nel::elem::load16(unsigned char const*)>
+    31b9:	|  |  |   0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+        Line16 const b = load16(s + i + 16);
+    31bd:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31c1:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    31c5:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    31c9:	|  |  |   48 01 d0             	add    %rdx,%rax
+    31cc:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    31cf:	|  |  |   e8 25 ff ff ff       	call   30f9 <nel::elem::load16(unsigned char const*)>
+    31d4:	|  |  |   0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+        Line16 const c = load16(s + i + 32);
+    31d8:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31dc:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    31e0:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    31e4:	|  |  |   48 01 d0             	add    %rdx,%rax
+    31e7:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    31ea:	|  |  |   e8 0a ff ff ff       	call   30f9 <nel::elem::load16(unsigned char const*)>
+    31ef:	|  |  |   0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+        Line16 const e = load16(s + i + 48);
+    31f3:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31f7:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    31fb:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    31ff:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3202:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3205:	|  |  |   e8 ef fe ff ff       	call   30f9 <nel::elem::load16(unsigned char const*)>
+    320a:	|  |  |   0f 29 45 a0          	movaps %xmm0,-0x60(%rbp)
+        stream16(d + i, a);
+    320e:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    3212:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3216:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3219:	|  |  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    321d:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3220:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3223:	|  |  |   e8 f3 fe ff ff       	call   311b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, b);
+    3228:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    322c:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    3230:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3234:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3237:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    323b:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    323e:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3241:	|  |  |   e8 d5 fe ff ff       	call   311b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, c);
+    3246:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    324a:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    324e:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3252:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3255:	|  |  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    3259:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    325c:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    325f:	|  |  |   e8 b7 fe ff ff       	call   311b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, e);
+    3264:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3268:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    326c:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3270:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3273:	|  |  |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    3277:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    327a:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    327d:	|  |  |   e8 99 fe ff ff       	call   311b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    3282:	|  |  |   48 83 45 f8 40       	addq   $0x40,-0x8(%rbp)
+    3287:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    328b:	|  |      48 83 c0 40          	add    $0x40,%rax
+    328f:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    3293:	|  \----- 0f 83 0d ff ff ff    	jae    31a6 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x6c>
+    }
+    for (; i + 16 <= n; i += 16) {
+    3299:	|     /-- eb 36                	jmp    32d1 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x197>
+        stream16(d + i, load16(s + i));
+    329b:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    329f:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32a3:	|  |  |   48 01 d0             	add    %rdx,%rax
+    32a6:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    32a9:	|  |  |   e8 4b fe ff ff       	call   30f9 <nel::elem::load16(unsigned char const*)>
+    32ae:	|  |  |   0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+    32b2:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    32b6:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32ba:	|  |  |   48 01 c2             	add    %rax,%rdx
+    32bd:	|  |  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    32c1:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    32c4:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    32c7:	|  |  |   e8 4f fe ff ff       	call   311b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    32cc:	|  |  |   48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+    32d1:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32d5:	|  |      48 83 c0 10          	add    $0x10,%rax
+    32d9:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    32dd:	|  \----- 73 bc                	jae    329b <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    32df:	|         0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    32e2:	|         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    32e6:	|         48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    32ea:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    32ee:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    32f2:	|         48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    32f6:	|         48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+    32fa:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    32fe:	|         48 01 d1             	add    %rdx,%rcx
+    3301:	|         48 89 c2             	mov    %rax,%rdx
+    3304:	|         48 89 cf             	mov    %rcx,%rdi
+    3307:	|         e8 09 fc ff ff       	call   2f15 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+}
+    330c:	\-------> c9                   	leave
+    330d:	          c3                   	ret
+
+000000000000330e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    330e:	          55                   	push   %rbp
+    330f:	          48 89 e5             	mov    %rsp,%rbp
+    3312:	          48 83 ec 60          	sub    $0x60,%rsp
+    3316:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    331a:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    331e:	          48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    if (n < streaming_min) {
+    3322:	          48 81 7d a8 ff 00 00 	cmpq   $0xff,-0x58(%rbp)
+    3329:	          00 
+    332a:	      /-- 77 1c                	ja     3348 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        set_pattern(d, p, n);
+    332c:	      |   48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    3330:	      |   48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+    3334:	      |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3338:	      |   48 89 ce             	mov    %rcx,%rsi
+    333b:	      |   48 89 c7             	mov    %rax,%rdi
+    333e:	      |   e8 29 fd ff ff       	call   306c <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>
+    3343:	/-----|-- e9 89 01 00 00       	jmp    34d1 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c3>
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    3348:	|     \-> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    334c:	|         48 f7 d8             	neg    %rax
+    334f:	|         83 e0 0f             	and    $0xf,%eax
+    3352:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    for (Index i = 0; i < head; ++i) {
+    3356:	|         48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    335d:	|         00 
+    335e:	|     /-- eb 20                	jmp    3380 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x72>
+        d[i] = p[i];
+    3360:	|  /--|-> 48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    3364:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3368:	|  |  |   48 01 d0             	add    %rdx,%rax
+    336b:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    336f:	|  |  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3373:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    3376:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    3379:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < head; ++i) {
+    337b:	|  |  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    3380:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3384:	|  |      48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    3388:	|  \----- 72 d6                	jb     3360 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x52>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    338a:	|         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    3391:	|         00 
+    3392:	|     /-- eb 2d                	jmp    33c1 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xb3>
+        rotated[i] = p[(head + i) % 16];
+    3394:	|  /--|-> 48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    3398:	|  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    339c:	|  |  |   48 01 d0             	add    %rdx,%rax
+    339f:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    33a2:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    33a5:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    33a9:	|  |  |   48 01 d0             	add    %rdx,%rax
+    33ac:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    33af:	|  |  |   48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    33b3:	|  |  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    33b7:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    33ba:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < 16; ++i) {
+    33bc:	|  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    33c1:	|  |  \-> 48 83 7d f0 0f       	cmpq   $0xf,-0x10(%rbp)
+    33c6:	|  \----- 76 cc                	jbe    3394 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x86>
+    }
+    Line16 const v = load16(rotated);
+    33c8:	|         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    33cc:	|         48 89 c7             	mov    %rax,%rdi
+    33cf:	|         e8 25 fd ff ff       	call   30f9 <nel::elem::load16(unsigned char const*)>
+    33d4:	|         0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+    Index i = head;
+    33d8:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    33dc:	|         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    33e0:	|     /-- eb 79                	jmp    345b <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        stream16(d + i, v);
+    33e2:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    33e6:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    33ea:	|  |  |   48 01 c2             	add    %rax,%rdx
+    33ed:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    33f1:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    33f4:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    33f7:	|  |  |   e8 1f fd ff ff       	call   311b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, v);
+    33fc:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3400:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    3404:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3408:	|  |  |   48 01 c2             	add    %rax,%rdx
+    340b:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    340f:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3412:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3415:	|  |  |   e8 01 fd ff ff       	call   311b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, v);
+    341a:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    341e:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    3422:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3426:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3429:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    342d:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3430:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3433:	|  |  |   e8 e3 fc ff ff       	call   311b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, v);
+    3438:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    343c:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    3440:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3444:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3447:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    344b:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    344e:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3451:	|  |  |   e8 c5 fc ff ff       	call   311b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    3456:	|  |  |   48 83 45 e8 40       	addq   $0x40,-0x18(%rbp)
+    345b:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    345f:	|  |      48 83 c0 40          	add    $0x40,%rax
+    3463:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    3467:	|  \----- 0f 83 75 ff ff ff    	jae    33e2 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd4>
+    }
+    for (; i + 16 <= n; i += 16) {
+    346d:	|     /-- eb 1f                	jmp    348e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x180>
+        stream16(d + i, v);
+    346f:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    3473:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3477:	|  |  |   48 01 c2             	add    %rax,%rdx
+    347a:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    347e:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3481:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3484:	|  |  |   e8 92 fc ff ff       	call   311b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    3489:	|  |  |   48 83 45 e8 10       	addq   $0x10,-0x18(%rbp)
+    348e:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3492:	|  |      48 83 c0 10          	add    $0x10,%rax
+    3496:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    349a:	|  \----- 73 d3                	jae    346f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    __builtin_ia32_sfence();
+    349c:	|         0f ae f8             	sfence
+    for (; i < n; ++i) {
+    349f:	|     /-- eb 26                	jmp    34c7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1b9>
+        d[i] = p[i % 16];
+    34a1:	|  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34a5:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    34a8:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    34ab:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    34af:	|  |  |   48 01 d0             	add    %rdx,%rax
+    34b2:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    34b6:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    34ba:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    34bd:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    34c0:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (; i < n; ++i) {
+    34c2:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    34c7:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34cb:	|  |      48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    34cf:	|  \----- 72 d0                	jb     34a1 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x193>
+    }
+}
+    34d1:	\-------> c9                   	leave
+    34d2:	          c3                   	ret
+
+00000000000034d3 <nel::offset_of(unsigned char*, unsigned long)>:
+// The payload is the first align boundary leaving room for a Length in front,
+// which holds the offset from the start of the underlying allocation.
+// Malloc alignment is at least alignof(Length), so the payload is at most
+// align bytes in.
+static Length offset_of(uint8_t *const base, Length const align)
+{
+    34d3:	55                   	push   %rbp
+    34d4:	48 89 e5             	mov    %rsp,%rbp
+    34d7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    34db:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    USize const a = reinterpret_cast<USize>(base) + sizeof(Length);
+    34df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34e3:	48 83 c0 08          	add    $0x8,%rax
+    34e7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    34eb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    34ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    34f3:	48 01 d0             	add    %rdx,%rax
+    34f6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    34fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    34fe:	48 f7 d8             	neg    %rax
+    3501:	48 21 c2             	and    %rax,%rdx
+    3504:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3508:	48 29 c2             	sub    %rax,%rdx
+    350b:	48 89 d0             	mov    %rdx,%rax
+}
+    350e:	5d                   	pop    %rbp
+    350f:	c3                   	ret
+
+0000000000003510 <nel::offset_field(unsigned char*)>:
+
+static Length &offset_field(uint8_t *const p)
+{
+    3510:	55                   	push   %rbp
+    3511:	48 89 e5             	mov    %rsp,%rbp
+    3514:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return reinterpret_cast<Length *>(p)[-1];
+    3518:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    351c:	48 83 e8 08          	sub    $0x8,%rax
+}
+    3520:	5d                   	pop    %rbp
+    3521:	c3                   	ret
+
+0000000000003522 <nel::free_aligned(void*)>:
+
+void free_aligned(void *const p)
+{
+    3522:	       55                   	push   %rbp
+    3523:	       48 89 e5             	mov    %rsp,%rbp
+    3526:	       48 83 ec 20          	sub    $0x20,%rsp
+    352a:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (p == nullptr) { return; }
+    352e:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3533:	/----- 74 2e                	je     3563 <nel::free_aligned(void*)+0x41>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    3535:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3539:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    std::free(u8p - offset_field(u8p));
+    353d:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3541:	|      48 89 c7             	mov    %rax,%rdi
+    3544:	|      e8 c7 ff ff ff       	call   3510 <nel::offset_field(unsigned char*)>
+    3549:	|      48 8b 00             	mov    (%rax),%rax
+    354c:	|      48 f7 d8             	neg    %rax
+    354f:	|      48 89 c2             	mov    %rax,%rdx
+    3552:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3556:	|      48 01 d0             	add    %rdx,%rax
+    3559:	|      48 89 c7             	mov    %rax,%rdi
+    355c:	|      e8 cf da ff ff       	call   1030 <free@plt>
+    3561:	|  /-- eb 01                	jmp    3564 <nel::free_aligned(void*)+0x42>
+    if (p == nullptr) { return; }
+    3563:	\--|-> 90                   	nop
+}
+    3564:	   \-> c9                   	leave
+    3565:	       c3                   	ret
+
+0000000000003566 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    3566:	             55                   	push   %rbp
+    3567:	             48 89 e5             	mov    %rsp,%rbp
+    356a:	             53                   	push   %rbx
+    356b:	             48 83 ec 78          	sub    $0x78,%rsp
+    356f:	             48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    3573:	             48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    3577:	             48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    357b:	             48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    357f:	             48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    3583:	             b9 f3 00 00 00       	mov    $0xf3,%ecx
+    3588:	             48 8d 15 e1 0b 00 00 	lea    0xbe1(%rip),%rdx        # 4170 <nel::elem::streaming_min+0x8>
+    358f:	             48 8d 35 ec 0b 00 00 	lea    0xbec(%rip),%rsi        # 4182 <nel::elem::streaming_min+0x1a>
+    3596:	             48 89 c7             	mov    %rax,%rdi
+    3599:	             e8 46 de ff ff       	call   13e4 <nel::Context::Context(char const*, char const*, int)>
+    359e:	             48 83 7d 90 00       	cmpq   $0x0,-0x70(%rbp)
+    35a3:	      /----- 74 18                	je     35bd <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    35a5:	      |      48 8b 45 90          	mov    -0x70(%rbp),%rax
+    35a9:	      |      48 83 e8 01          	sub    $0x1,%rax
+    35ad:	      |      48 23 45 90          	and    -0x70(%rbp),%rax
+    35b1:	      |      48 85 c0             	test   %rax,%rax
+    35b4:	      +----- 75 07                	jne    35bd <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    35b6:	      |      b8 01 00 00 00       	mov    $0x1,%eax
+    35bb:	      |  /-- eb 05                	jmp    35c2 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x5c>
+    35bd:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    35c2:	         \-> 0f b6 c0             	movzbl %al,%eax
+    35c5:	             48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    35c9:	             48 8d 0d c2 0b 00 00 	lea    0xbc2(%rip),%rcx        # 4192 <nel::elem::streaming_min+0x2a>
+    35d0:	             48 89 ce             	mov    %rcx,%rsi
+    35d3:	             89 c7                	mov    %eax,%edi
+    35d5:	             e8 5b 01 00 00       	call   3735 <nel::assert(bool, char const*, nel::Context const&)>
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    35da:	             48 8b 45 98          	mov    -0x68(%rbp),%rax
+    35de:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    35e2:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    35e7:	      /----- 74 11                	je     35fa <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x94>
+    35e9:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    35ed:	      |      48 89 c7             	mov    %rax,%rdi
+    35f0:	      |      e8 1b ff ff ff       	call   3510 <nel::offset_field(unsigned char*)>
+    35f5:	      |      48 8b 00             	mov    (%rax),%rax
+    35f8:	      |  /-- eb 05                	jmp    35ff <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x99>
+    35fa:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    35ff:	         \-> 48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    3603:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3608:	      /----- 74 13                	je     361d <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb7>
+    360a:	      |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    360e:	      |      48 f7 d8             	neg    %rax
+    3611:	      |      48 89 c2             	mov    %rax,%rdx
+    3614:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3618:	      |      48 01 d0             	add    %rdx,%rax
+    361b:	      |  /-- eb 05                	jmp    3622 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xbc>
+    361d:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3622:	         \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    3626:	             48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    362a:	             48 8b 45 90          	mov    -0x70(%rbp),%rax
+    362e:	             48 01 c2             	add    %rax,%rdx
+    3631:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3635:	             48 89 d6             	mov    %rdx,%rsi
+    3638:	             48 89 c7             	mov    %rax,%rdi
+    363b:	             e8 80 da ff ff       	call   10c0 <realloc@plt>
+    3640:	             48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if (new_base == nullptr) { return nullptr; }
+    3644:	             48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    3649:	         /-- 75 0a                	jne    3655 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    364b:	         |   b8 00 00 00 00       	mov    $0x0,%eax
+    3650:	/--------|-- e9 85 00 00 00       	jmp    36da <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x174>
+
+    Length const new_offset = offset_of(new_base, align);
+    3655:	|        \-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3659:	|            48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    365d:	|            48 89 d6             	mov    %rdx,%rsi
+    3660:	|            48 89 c7             	mov    %rax,%rdi
+    3663:	|            e8 6b fe ff ff       	call   34d3 <nel::offset_of(unsigned char*, unsigned long)>
+    3668:	|            48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    uint8_t *const new_p = new_base + new_offset;
+    366c:	|            48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    3670:	|            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3674:	|            48 01 d0             	add    %rdx,%rax
+    3677:	|            48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    if (old_p != nullptr && new_offset != old_offset) {
+    367b:	|            48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3680:	|  /-------- 74 41                	je     36c3 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+    3682:	|  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3686:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    368a:	|  +-------- 74 37                	je     36c3 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+    368c:	|  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3690:	|  |         48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    3694:	|  |  /----- 73 06                	jae    369c <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x136>
+    3696:	|  |  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    369a:	|  |  |  /-- eb 04                	jmp    36a0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x13a>
+    369c:	|  |  \--|-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    36a0:	|  |     \-> 48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        std::memmove(new_p, new_base + old_offset, n);
+    36a4:	|  |         48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    36a8:	|  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    36ac:	|  |         48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    36b0:	|  |         48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    36b4:	|  |         48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    36b8:	|  |         48 89 ce             	mov    %rcx,%rsi
+    36bb:	|  |         48 89 c7             	mov    %rax,%rdi
+    36be:	|  |         e8 0d da ff ff       	call   10d0 <memmove@plt>
+    }
+    offset_field(new_p) = new_offset;
+    36c3:	|  \-------> 48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+    36c7:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    36cb:	|            48 89 c7             	mov    %rax,%rdi
+    36ce:	|            e8 3d fe ff ff       	call   3510 <nel::offset_field(unsigned char*)>
+    36d3:	|            48 89 18             	mov    %rbx,(%rax)
+    return new_p;
+    36d6:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+}
+    36da:	\----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    36de:	             c9                   	leave
+    36df:	             c3                   	ret
+
+00000000000036e0 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    36e0:	55                   	push   %rbp
+    36e1:	48 89 e5             	mov    %rsp,%rbp
+    36e4:	48 83 ec 10          	sub    $0x10,%rsp
+    36e8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    36ec:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return realloc_aligned(nullptr, align, 0, size);
+    36f0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    36f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    36f8:	48 89 d1             	mov    %rdx,%rcx
+    36fb:	ba 00 00 00 00       	mov    $0x0,%edx
+    3700:	48 89 c6             	mov    %rax,%rsi
+    3703:	bf 00 00 00 00       	mov    $0x0,%edi
+    3708:	e8 59 fe ff ff       	call   3566 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+}
+    370d:	c9                   	leave
+    370e:	c3                   	ret
+
+000000000000370f <nel::elem::poison(unsigned char*, unsigned long)>:
+{
+    370f:	55                   	push   %rbp
+    3710:	48 89 e5             	mov    %rsp,%rbp
+    3713:	48 83 ec 10          	sub    $0x10,%rsp
+    3717:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    371b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    copy(d, s, n);
+    371f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3723:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3727:	48 89 d6             	mov    %rdx,%rsi
+    372a:	48 89 c7             	mov    %rax,%rdi
+    372d:	e8 ae f8 ff ff       	call   2fe0 <nel::elem::wipe(unsigned char*, unsigned long)>
+}
+    3732:	90                   	nop
+    3733:	c9                   	leave
+    3734:	c3                   	ret
+
+0000000000003735 <nel::assert(bool, char const*, nel::Context const&)>:
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx);
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    3735:	    55                   	push   %rbp
+    3736:	    48 89 e5             	mov    %rsp,%rbp
+    3739:	    48 83 ec 20          	sub    $0x20,%rsp
+    373d:	    89 f8                	mov    %edi,%eax
+    373f:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3743:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    3747:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { assert_fail(msg, ctx); }
+    374a:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    374e:	    83 f0 01             	xor    $0x1,%eax
+    3751:	    84 c0                	test   %al,%al
+    3753:	/-- 74 13                	je     3768 <nel::assert(bool, char const*, nel::Context const&)+0x33>
+    3755:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3759:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    375d:	|   48 89 d6             	mov    %rdx,%rsi
+    3760:	|   48 89 c7             	mov    %rax,%rdi
+    3763:	|   e8 52 f7 ff ff       	call   2eba <nel::assert_fail(char const*, nel::Context const&)>
+}
+    3768:	\-> 90                   	nop
+    3769:	    c9                   	leave
+    376a:	    c3                   	ret
+
+000000000000376b <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    376b:	55                   	push   %rbp
+    376c:	48 89 e5             	mov    %rsp,%rbp
+    376f:	48 83 ec 10          	sub    $0x10,%rsp
+    3773:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3777:	89 f0                	mov    %esi,%eax
+    3779:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    377c:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    3780:	48 8b 15 f9 38 00 00 	mov    0x38f9(%rip),%rdx        # 7080 <stderr@GLIBC_2.2.5>
+    3787:	48 89 d6             	mov    %rdx,%rsi
+    378a:	89 c7                	mov    %eax,%edi
+    378c:	e8 ef d8 ff ff       	call   1080 <fputc@plt>
+    return outs;
+    3791:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3795:	c9                   	leave
+    3796:	c3                   	ret
+
+0000000000003797 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    3797:	55                   	push   %rbp
+    3798:	48 89 e5             	mov    %rsp,%rbp
+    379b:	48 83 ec 10          	sub    $0x10,%rsp
+    379f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    37a3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    37a7:	48 8b 15 d2 38 00 00 	mov    0x38d2(%rip),%rdx        # 7080 <stderr@GLIBC_2.2.5>
+    37ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    37b2:	48 89 d6             	mov    %rdx,%rsi
+    37b5:	48 89 c7             	mov    %rax,%rdi
+    37b8:	e8 a3 d8 ff ff       	call   1060 <fputs@plt>
+    return outs;
+    37bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    37c1:	c9                   	leave
+    37c2:	c3                   	ret
+
+00000000000037c3 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    37c3:	55                   	push   %rbp
+    37c4:	48 89 e5             	mov    %rsp,%rbp
+    37c7:	48 83 ec 10          	sub    $0x10,%rsp
+    37cb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    37cf:	89 f0                	mov    %esi,%eax
+    37d1:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    37d4:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    37d8:	48 8b 05 a1 38 00 00 	mov    0x38a1(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    37df:	48 8d 0d c7 09 00 00 	lea    0x9c7(%rip),%rcx        # 41ad <nel::elem::streaming_min+0x45>
+    37e6:	48 89 ce             	mov    %rcx,%rsi
+    37e9:	48 89 c7             	mov    %rax,%rdi
+    37ec:	b8 00 00 00 00       	mov    $0x0,%eax
+    37f1:	e8 aa d8 ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    37f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    37fa:	c9                   	leave
+    37fb:	c3                   	ret
+
+00000000000037fc <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    37fc:	55                   	push   %rbp
+    37fd:	48 89 e5             	mov    %rsp,%rbp
+    3800:	48 83 ec 10          	sub    $0x10,%rsp
+    3804:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3808:	89 f0                	mov    %esi,%eax
+    380a:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    380e:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    3812:	48 8b 05 67 38 00 00 	mov    0x3867(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    3819:	48 8d 0d 8d 09 00 00 	lea    0x98d(%rip),%rcx        # 41ad <nel::elem::streaming_min+0x45>
+    3820:	48 89 ce             	mov    %rcx,%rsi
+    3823:	48 89 c7             	mov    %rax,%rdi
+    3826:	b8 00 00 00 00       	mov    $0x0,%eax
+    382b:	e8 70 d8 ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    3830:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3834:	c9                   	leave
+    3835:	c3                   	ret
+
+0000000000003836 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    3836:	55                   	push   %rbp
+    3837:	48 89 e5             	mov    %rsp,%rbp
+    383a:	48 83 ec 10          	sub    $0x10,%rsp
+    383e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3842:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    3845:	48 8b 05 34 38 00 00 	mov    0x3834(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    384c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    384f:	48 8d 0d 57 09 00 00 	lea    0x957(%rip),%rcx        # 41ad <nel::elem::streaming_min+0x45>
+    3856:	48 89 ce             	mov    %rcx,%rsi
+    3859:	48 89 c7             	mov    %rax,%rdi
+    385c:	b8 00 00 00 00       	mov    $0x0,%eax
+    3861:	e8 3a d8 ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    3866:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    386a:	c9                   	leave
+    386b:	c3                   	ret
+
+000000000000386c <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    386c:	55                   	push   %rbp
+    386d:	48 89 e5             	mov    %rsp,%rbp
+    3870:	48 83 ec 10          	sub    $0x10,%rsp
+    3874:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3878:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    387b:	48 8b 05 fe 37 00 00 	mov    0x37fe(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    3882:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    3885:	48 8d 0d 21 09 00 00 	lea    0x921(%rip),%rcx        # 41ad <nel::elem::streaming_min+0x45>
+    388c:	48 89 ce             	mov    %rcx,%rsi
+    388f:	48 89 c7             	mov    %rax,%rdi
+    3892:	b8 00 00 00 00       	mov    $0x0,%eax
+    3897:	e8 04 d8 ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    389c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    38a0:	c9                   	leave
+    38a1:	c3                   	ret
+
+00000000000038a2 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    38a2:	55                   	push   %rbp
+    38a3:	48 89 e5             	mov    %rsp,%rbp
+    38a6:	48 83 ec 10          	sub    $0x10,%rsp
+    38aa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    38ae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    38b2:	48 8b 05 c7 37 00 00 	mov    0x37c7(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    38b9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    38bd:	48 8d 0d ec 08 00 00 	lea    0x8ec(%rip),%rcx        # 41b0 <nel::elem::streaming_min+0x48>
+    38c4:	48 89 ce             	mov    %rcx,%rsi
+    38c7:	48 89 c7             	mov    %rax,%rdi
+    38ca:	b8 00 00 00 00       	mov    $0x0,%eax
+    38cf:	e8 cc d7 ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    38d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    38d8:	c9                   	leave
+    38d9:	c3                   	ret
+
+Disassembly of section .fini:
+
+00000000000038dc <_fini>:
+    38dc:	48 83 ec 08          	sub    $0x8,%rsp
+    38e0:	48 83 c4 08          	add    $0x8,%rsp
+    38e4:	c3                   	ret
@@ -0,0 +1,10108 @@
+
+target/debug/examples/bench_iterator:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 bf 00 00 	mov    0xbfc5(%rip),%rax        # cfd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca bf 00 00    	push   0xbfca(%rip)        # cff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc bf 00 00    	jmp    *0xbfcc(%rip)        # cff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca bf 00 00    	jmp    *0xbfca(%rip)        # d000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 bf 00 00    	jmp    *0xbfc2(%rip)        # d008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <clock_gettime@plt>:
+    1050:	ff 25 ba bf 00 00    	jmp    *0xbfba(%rip)        # d010 <clock_gettime@GLIBC_2.17>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputs@plt>:
+    1060:	ff 25 b2 bf 00 00    	jmp    *0xbfb2(%rip)        # d018 <fputs@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <memset@plt>:
+    1070:	ff 25 aa bf 00 00    	jmp    *0xbfaa(%rip)        # d020 <memset@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fputc@plt>:
+    1080:	ff 25 a2 bf 00 00    	jmp    *0xbfa2(%rip)        # d028 <fputc@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <memcmp@plt>:
+    1090:	ff 25 9a bf 00 00    	jmp    *0xbf9a(%rip)        # d030 <memcmp@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <fprintf@plt>:
+    10a0:	ff 25 92 bf 00 00    	jmp    *0xbf92(%rip)        # d038 <fprintf@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <memcpy@plt>:
+    10b0:	ff 25 8a bf 00 00    	jmp    *0xbf8a(%rip)        # d040 <memcpy@GLIBC_2.14>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <realloc@plt>:
+    10c0:	ff 25 82 bf 00 00    	jmp    *0xbf82(%rip)        # d048 <realloc@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <memmove@plt>:
+    10d0:	ff 25 7a bf 00 00    	jmp    *0xbf7a(%rip)        # d050 <memmove@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010e0 <__cxa_atexit@plt>:
+    10e0:	ff 25 72 bf 00 00    	jmp    *0xbf72(%rip)        # d058 <__cxa_atexit@GLIBC_2.2.5>
+    10e6:	68 0b 00 00 00       	push   $0xb
+    10eb:	e9 30 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010f0 <__cxa_finalize@plt>:
+    10f0:	ff 25 ea be 00 00    	jmp    *0xbeea(%rip)        # cfe0 <__cxa_finalize@GLIBC_2.2.5>
+    10f6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+0000000000001100 <_start>:
+    1100:	31 ed                	xor    %ebp,%ebp
+    1102:	49 89 d1             	mov    %rdx,%r9
+    1105:	5e                   	pop    %rsi
+    1106:	48 89 e2             	mov    %rsp,%rdx
+    1109:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    110d:	50                   	push   %rax
+    110e:	54                   	push   %rsp
+    110f:	45 31 c0             	xor    %r8d,%r8d
+    1112:	31 c9                	xor    %ecx,%ecx
+    1114:	48 8d 3d 5c 0e 00 00 	lea    0xe5c(%rip),%rdi        # 1f77 <main>
+    111b:	ff 15 9f be 00 00    	call   *0xbe9f(%rip)        # cfc0 <__libc_start_main@GLIBC_2.34>
+    1121:	f4                   	hlt
+    1122:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1129:	00 00 00 
+    112c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001130 <deregister_tm_clones>:
+    1130:	    48 8d 3d 39 bf 00 00 	lea    0xbf39(%rip),%rdi        # d070 <__TMC_END__>
+    1137:	    48 8d 05 32 bf 00 00 	lea    0xbf32(%rip),%rax        # d070 <__TMC_END__>
+    113e:	    48 39 f8             	cmp    %rdi,%rax
+    1141:	/-- 74 15                	je     1158 <deregister_tm_clones+0x28>
+    1143:	|   48 8b 05 7e be 00 00 	mov    0xbe7e(%rip),%rax        # cfc8 <_ITM_deregisterTMCloneTable@Base>
+    114a:	|   48 85 c0             	test   %rax,%rax
+    114d:	+-- 74 09                	je     1158 <deregister_tm_clones+0x28>
+    114f:	|   ff e0                	jmp    *%rax
+    1151:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1158:	\-> c3                   	ret
+    1159:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001160 <register_tm_clones>:
+    1160:	    48 8d 3d 09 bf 00 00 	lea    0xbf09(%rip),%rdi        # d070 <__TMC_END__>
+    1167:	    48 8d 35 02 bf 00 00 	lea    0xbf02(%rip),%rsi        # d070 <__TMC_END__>
+    116e:	    48 29 fe             	sub    %rdi,%rsi
+    1171:	    48 89 f0             	mov    %rsi,%rax
+    1174:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1178:	    48 c1 f8 03          	sar    $0x3,%rax
+    117c:	    48 01 c6             	add    %rax,%rsi
+    117f:	    48 d1 fe             	sar    %rsi
+    1182:	/-- 74 14                	je     1198 <register_tm_clones+0x38>
+    1184:	|   48 8b 05 4d be 00 00 	mov    0xbe4d(%rip),%rax        # cfd8 <_ITM_registerTMCloneTable@Base>
+    118b:	|   48 85 c0             	test   %rax,%rax
+    118e:	+-- 74 08                	je     1198 <register_tm_clones+0x38>
+    1190:	|   ff e0                	jmp    *%rax
+    1192:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1198:	\-> c3                   	ret
+    1199:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011a0 <__do_global_dtors_aux>:
+    11a0:	       f3 0f 1e fa          	endbr64
+    11a4:	       80 3d dd be 00 00 00 	cmpb   $0x0,0xbedd(%rip)        # d088 <completed.0>
+    11ab:	/----- 75 2b                	jne    11d8 <__do_global_dtors_aux+0x38>
+    11ad:	|      55                   	push   %rbp
+    11ae:	|      48 83 3d 2a be 00 00 	cmpq   $0x0,0xbe2a(%rip)        # cfe0 <__cxa_finalize@GLIBC_2.2.5>
+    11b5:	|      00 
+    11b6:	|      48 89 e5             	mov    %rsp,%rbp
+    11b9:	|  /-- 74 0c                	je     11c7 <__do_global_dtors_aux+0x27>
+    11bb:	|  |   48 8b 3d a6 be 00 00 	mov    0xbea6(%rip),%rdi        # d068 <__dso_handle>
+    11c2:	|  |   e8 29 ff ff ff       	call   10f0 <__cxa_finalize@plt>
+    11c7:	|  \-> e8 64 ff ff ff       	call   1130 <deregister_tm_clones>
+    11cc:	|      c6 05 b5 be 00 00 01 	movb   $0x1,0xbeb5(%rip)        # d088 <completed.0>
+    11d3:	|      5d                   	pop    %rbp
+    11d4:	|      c3                   	ret
+    11d5:	|      0f 1f 00             	nopl   (%rax)
+    11d8:	\----> c3                   	ret
+    11d9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011e0 <frame_dummy>:
+    11e0:	f3 0f 1e fa          	endbr64
+    11e4:	e9 77 ff ff ff       	jmp    1160 <register_tm_clones>
+    11e9:	90                   	nop
+
+00000000000011ea <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    11ea:	55                   	push   %rbp
+    11eb:	48 89 e5             	mov    %rsp,%rbp
+    11ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11f2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    11f5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11fa:	5d                   	pop    %rbp
+    11fb:	c3                   	ret
+
+00000000000011fc <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    11fc:	55                   	push   %rbp
+    11fd:	48 89 e5             	mov    %rsp,%rbp
+    1200:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1204:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1207:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return -1;
+    120b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1210:	5d                   	pop    %rbp
+    1211:	c3                   	ret
+
+0000000000001212 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    1212:	55                   	push   %rbp
+    1213:	48 89 e5             	mov    %rsp,%rbp
+    1216:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    121a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    121d:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    return -1;
+    1220:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1225:	5d                   	pop    %rbp
+    1226:	c3                   	ret
+
+0000000000001227 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    1227:	55                   	push   %rbp
+    1228:	48 89 e5             	mov    %rsp,%rbp
+    122b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    122f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1232:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    1235:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    return -1;
+    1238:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    123d:	5d                   	pop    %rbp
+    123e:	c3                   	ret
+
+000000000000123f <_read_r>:
+int _read_r(struct _reent *, int) {
+    123f:	55                   	push   %rbp
+    1240:	48 89 e5             	mov    %rsp,%rbp
+    1243:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1247:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    124a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    124f:	5d                   	pop    %rbp
+    1250:	c3                   	ret
+
+0000000000001251 <_write_r>:
+int _write_r(struct _reent *, int, char *, int) {
+    1251:	55                   	push   %rbp
+    1252:	48 89 e5             	mov    %rsp,%rbp
+    1255:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1259:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    125c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1260:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+    return -1;
+    1263:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1268:	5d                   	pop    %rbp
+    1269:	c3                   	ret
+
+000000000000126a <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    126a:	55                   	push   %rbp
+    126b:	48 89 e5             	mov    %rsp,%rbp
+    126e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return -1;
+    1272:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1277:	5d                   	pop    %rbp
+    1278:	c3                   	ret
+
+0000000000001279 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1279:	55                   	push   %rbp
+    127a:	48 89 e5             	mov    %rsp,%rbp
+    127d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1281:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1284:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1289:	5d                   	pop    %rbp
+    128a:	c3                   	ret
+    128b:	90                   	nop
+
+000000000000128c <bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const>:
+    bench::report_per_item(name, t, reps * s.len());
+}
+
+void bench_for_each(nel::Slice<int> const &s)
+{
+    run("  for_each, raw loop       ", s, [](nel::Slice<int> const &s) {
+    128c:	       55                   	push   %rbp
+    128d:	       48 89 e5             	mov    %rsp,%rbp
+    1290:	       48 83 ec 30          	sub    $0x30,%rsp
+    1294:	       48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1298:	       48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+        Acc acc = 0;
+    129c:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    12a3:	       00 
+        int const *const p = s.ptr();
+    12a4:	       48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    12a8:	       48 89 c7             	mov    %rax,%rdi
+    12ab:	       e8 6c 33 00 00       	call   461c <nel::Slice<int>::ptr() const>
+    12b0:	       48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    12b4:	       48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    12bb:	       00 
+    12bc:	   /-- eb 20                	jmp    12de <bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const+0x52>
+            acc += Acc(p[i]);
+    12be:	/--|-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12c2:	|  |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    12c9:	|  |   00 
+    12ca:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12ce:	|  |   48 01 d0             	add    %rdx,%rax
+    12d1:	|  |   8b 00                	mov    (%rax),%eax
+    12d3:	|  |   48 98                	cltq
+    12d5:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    12d9:	|  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    12de:	|  \-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    12e2:	|      48 89 c7             	mov    %rax,%rdi
+    12e5:	|      e8 9e 31 00 00       	call   4488 <nel::Slice<int>::len() const>
+    12ea:	|      48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    12ee:	|      0f 92 c0             	setb   %al
+    12f1:	|      84 c0                	test   %al,%al
+    12f3:	\----- 75 c9                	jne    12be <bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const+0x32>
+        }
+        return acc;
+    12f5:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    });
+    12f9:	       c9                   	leave
+    12fa:	       c3                   	ret
+    12fb:	       90                   	nop
+
+00000000000012fc <bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}::operator()(int const&) const>:
+    run("  for_each, RUST_LIKE      ", s, [](nel::Slice<int> const &s) {
+        Acc acc = 0;
+        s.iter().for_each([&acc](int const &e) { acc += Acc(e); });
+    12fc:	55                   	push   %rbp
+    12fd:	48 89 e5             	mov    %rsp,%rbp
+    1300:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1304:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1308:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    130c:	48 8b 00             	mov    (%rax),%rax
+    130f:	48 8b 08             	mov    (%rax),%rcx
+    1312:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1316:	8b 00                	mov    (%rax),%eax
+    1318:	48 63 d0             	movslq %eax,%rdx
+    131b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    131f:	48 8b 00             	mov    (%rax),%rax
+    1322:	48 01 ca             	add    %rcx,%rdx
+    1325:	48 89 10             	mov    %rdx,(%rax)
+    1328:	90                   	nop
+    1329:	5d                   	pop    %rbp
+    132a:	c3                   	ret
+    132b:	90                   	nop
+
+000000000000132c <bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const>:
+    run("  for_each, RUST_LIKE      ", s, [](nel::Slice<int> const &s) {
+    132c:	55                   	push   %rbp
+    132d:	48 89 e5             	mov    %rsp,%rbp
+    1330:	48 83 ec 40          	sub    $0x40,%rsp
+    1334:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    1338:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+        Acc acc = 0;
+    133c:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+    1343:	00 
+        s.iter().for_each([&acc](int const &e) { acc += Acc(e); });
+    1344:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1348:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    134c:	48 89 d6             	mov    %rdx,%rsi
+    134f:	48 89 c7             	mov    %rax,%rdi
+    1352:	e8 d7 32 00 00       	call   462e <nel::Slice<int>::iter() const>
+    1357:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+    135b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    135f:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    1363:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1367:	48 89 d6             	mov    %rdx,%rsi
+    136a:	48 89 c7             	mov    %rax,%rdi
+    136d:	e8 a4 0f 00 00       	call   2316 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)>
+        return acc;
+    1372:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    });
+    1376:	c9                   	leave
+    1377:	c3                   	ret
+
+0000000000001378 <bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}::operator()(int const&) const>:
+    run("  for_each, C_LIKE         ", s, [](nel::Slice<int> const &s) {
+        Acc acc = 0;
+        s.iter().for_each2([&acc](int const &e) { acc += Acc(e); });
+    1378:	55                   	push   %rbp
+    1379:	48 89 e5             	mov    %rsp,%rbp
+    137c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1380:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1384:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1388:	48 8b 00             	mov    (%rax),%rax
+    138b:	48 8b 08             	mov    (%rax),%rcx
+    138e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1392:	8b 00                	mov    (%rax),%eax
+    1394:	48 63 d0             	movslq %eax,%rdx
+    1397:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    139b:	48 8b 00             	mov    (%rax),%rax
+    139e:	48 01 ca             	add    %rcx,%rdx
+    13a1:	48 89 10             	mov    %rdx,(%rax)
+    13a4:	90                   	nop
+    13a5:	5d                   	pop    %rbp
+    13a6:	c3                   	ret
+    13a7:	90                   	nop
+
+00000000000013a8 <bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const>:
+    run("  for_each, C_LIKE         ", s, [](nel::Slice<int> const &s) {
+    13a8:	55                   	push   %rbp
+    13a9:	48 89 e5             	mov    %rsp,%rbp
+    13ac:	48 83 ec 40          	sub    $0x40,%rsp
+    13b0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    13b4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+        Acc acc = 0;
+    13b8:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+    13bf:	00 
+        s.iter().for_each2([&acc](int const &e) { acc += Acc(e); });
+    13c0:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    13c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    13c8:	48 89 d6             	mov    %rdx,%rsi
+    13cb:	48 89 c7             	mov    %rax,%rdi
+    13ce:	e8 5b 32 00 00       	call   462e <nel::Slice<int>::iter() const>
+    13d3:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+    13d7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    13db:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    13df:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    13e3:	48 89 d6             	mov    %rdx,%rsi
+    13e6:	48 89 c7             	mov    %rax,%rdi
+    13e9:	e8 e2 10 00 00       	call   24d0 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each2<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)>
+        return acc;
+    13ee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    });
+    13f2:	c9                   	leave
+    13f3:	c3                   	ret
+
+00000000000013f4 <bench_for_each(nel::Slice<int> const&)>:
+{
+    13f4:	55                   	push   %rbp
+    13f5:	48 89 e5             	mov    %rsp,%rbp
+    13f8:	48 83 ec 20          	sub    $0x20,%rsp
+    13fc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    run("  for_each, raw loop       ", s, [](nel::Slice<int> const &s) {
+    1400:	48 8d 55 fd          	lea    -0x3(%rbp),%rdx
+    1404:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1408:	48 89 c6             	mov    %rax,%rsi
+    140b:	48 8d 05 6e 6c 00 00 	lea    0x6c6e(%rip),%rax        # 8080 <sizes+0x20>
+    1412:	48 89 c7             	mov    %rax,%rdi
+    1415:	e8 50 0e 00 00       	call   226a <void run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)>
+    run("  for_each, RUST_LIKE      ", s, [](nel::Slice<int> const &s) {
+    141a:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    141e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1422:	48 89 c6             	mov    %rax,%rsi
+    1425:	48 8d 05 70 6c 00 00 	lea    0x6c70(%rip),%rax        # 809c <sizes+0x3c>
+    142c:	48 89 c7             	mov    %rax,%rdi
+    142f:	e8 f0 0f 00 00       	call   2424 <void run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)>
+    run("  for_each, C_LIKE         ", s, [](nel::Slice<int> const &s) {
+    1434:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    1438:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    143c:	48 89 c6             	mov    %rax,%rsi
+    143f:	48 8d 05 72 6c 00 00 	lea    0x6c72(%rip),%rax        # 80b8 <sizes+0x58>
+    1446:	48 89 c7             	mov    %rax,%rdi
+    1449:	e8 50 11 00 00       	call   259e <void run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)>
+}
+    144e:	90                   	nop
+    144f:	c9                   	leave
+    1450:	c3                   	ret
+    1451:	90                   	nop
+
+0000000000001452 <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const>:
+
+void bench_map_first_n_fold(nel::Slice<int> const &s)
+{
+    // all but the last item, so first_n has to count.
+    nel::Count const limit = s.len() - 1;
+    run("  map+first_n+fold, raw    ", s, [limit](nel::Slice<int> const &s) {
+    1452:	       55                   	push   %rbp
+    1453:	       48 89 e5             	mov    %rsp,%rbp
+    1456:	       48 83 ec 30          	sub    $0x30,%rsp
+    145a:	       48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    145e:	       48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+        Acc acc = 0;
+    1462:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1469:	       00 
+        int const *const p = s.ptr();
+    146a:	       48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    146e:	       48 89 c7             	mov    %rax,%rdi
+    1471:	       e8 a6 31 00 00       	call   461c <nel::Slice<int>::ptr() const>
+    1476:	       48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        for (nel::Index i = 0; i < limit; ++i) {
+    147a:	       48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1481:	       00 
+    1482:	   /-- eb 2a                	jmp    14ae <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const+0x5c>
+            acc += Acc(p[i]) * 3;
+    1484:	/--|-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1488:	|  |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    148f:	|  |   00 
+    1490:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1494:	|  |   48 01 d0             	add    %rdx,%rax
+    1497:	|  |   8b 00                	mov    (%rax),%eax
+    1499:	|  |   48 63 d0             	movslq %eax,%rdx
+    149c:	|  |   48 89 d0             	mov    %rdx,%rax
+    149f:	|  |   48 01 c0             	add    %rax,%rax
+    14a2:	|  |   48 01 d0             	add    %rdx,%rax
+    14a5:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+        for (nel::Index i = 0; i < limit; ++i) {
+    14a9:	|  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    run("  map+first_n+fold, raw    ", s, [limit](nel::Slice<int> const &s) {
+    14ae:	|  \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    14b2:	|      48 8b 00             	mov    (%rax),%rax
+        for (nel::Index i = 0; i < limit; ++i) {
+    14b5:	|      48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    14b9:	\----- 72 c9                	jb     1484 <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const+0x32>
+        }
+        return acc;
+    14bb:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    });
+    14bf:	       c9                   	leave
+    14c0:	       c3                   	ret
+    14c1:	       90                   	nop
+
+00000000000014c2 <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}::operator()(int const&) const>:
+    run("  map+first_n+fold, RUST   ", s, [limit](nel::Slice<int> const &s) {
+        return s.iter()
+            .map<Acc>([](int const &e) -> Acc { return Acc(e) * 3; })
+    14c2:	55                   	push   %rbp
+    14c3:	48 89 e5             	mov    %rsp,%rbp
+    14c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    14ca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    14ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14d2:	8b 00                	mov    (%rax),%eax
+    14d4:	48 63 d0             	movslq %eax,%rdx
+    14d7:	48 89 d0             	mov    %rdx,%rax
+    14da:	48 01 c0             	add    %rax,%rax
+    14dd:	48 01 d0             	add    %rdx,%rax
+    14e0:	5d                   	pop    %rbp
+    14e1:	c3                   	ret
+
+00000000000014e2 <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}::operator()(unsigned long&, unsigned long const&) const>:
+            .first_n(limit)
+            .fold(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    14e2:	55                   	push   %rbp
+    14e3:	48 89 e5             	mov    %rsp,%rbp
+    14e6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    14ea:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    14ee:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    14f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14f6:	48 8b 10             	mov    (%rax),%rdx
+    14f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14fd:	48 8b 00             	mov    (%rax),%rax
+    1500:	48 01 c2             	add    %rax,%rdx
+    1503:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1507:	48 89 10             	mov    %rdx,(%rax)
+    150a:	90                   	nop
+    150b:	5d                   	pop    %rbp
+    150c:	c3                   	ret
+    150d:	90                   	nop
+
+000000000000150e <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const>:
+    run("  map+first_n+fold, RUST   ", s, [limit](nel::Slice<int> const &s) {
+    150e:	55                   	push   %rbp
+    150f:	48 89 e5             	mov    %rsp,%rbp
+    1512:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    1516:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+    151a:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+        return s.iter()
+    151e:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1522:	48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    1526:	48 89 d6             	mov    %rdx,%rsi
+    1529:	48 89 c7             	mov    %rax,%rdi
+    152c:	e8 fd 30 00 00       	call   462e <nel::Slice<int>::iter() const>
+            .map<Acc>([](int const &e) -> Acc { return Acc(e) * 3; })
+    1531:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1535:	48 8d 55 f6          	lea    -0xa(%rbp),%rdx
+    1539:	48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+    153d:	48 89 ce             	mov    %rcx,%rsi
+    1540:	48 89 c7             	mov    %rax,%rdi
+    1543:	e8 10 12 00 00       	call   2758 <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> nel::Iterator<nel::SliceIterator<int>, int&, int&>::map<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)>
+    run("  map+first_n+fold, RUST   ", s, [limit](nel::Slice<int> const &s) {
+    1548:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+    154c:	48 8b 10             	mov    (%rax),%rdx
+            .first_n(limit)
+    154f:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+    1553:	48 8d 4d c0          	lea    -0x40(%rbp),%rcx
+    1557:	48 89 ce             	mov    %rcx,%rsi
+    155a:	48 89 c7             	mov    %rax,%rdi
+    155d:	e8 4e 12 00 00       	call   27b0 <nel::Iterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>, int&, unsigned long>::first_n(unsigned long)>
+            .fold(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    1562:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1569:	00 
+    156a:	48 8d 55 f7          	lea    -0x9(%rbp),%rdx
+    156e:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    1572:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+    1576:	48 89 ce             	mov    %rcx,%rsi
+    1579:	48 89 c7             	mov    %rax,%rdi
+    157c:	e8 a5 12 00 00       	call   2826 <unsigned long nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)>
+    });
+    1581:	c9                   	leave
+    1582:	c3                   	ret
+    1583:	90                   	nop
+
+0000000000001584 <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}::operator()(int const&) const>:
+    run("  map+first_n+fold, C      ", s, [limit](nel::Slice<int> const &s) {
+        return s.iter()
+            .map<Acc>([](int const &e) -> Acc { return Acc(e) * 3; })
+    1584:	55                   	push   %rbp
+    1585:	48 89 e5             	mov    %rsp,%rbp
+    1588:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    158c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1590:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1594:	8b 00                	mov    (%rax),%eax
+    1596:	48 63 d0             	movslq %eax,%rdx
+    1599:	48 89 d0             	mov    %rdx,%rax
+    159c:	48 01 c0             	add    %rax,%rax
+    159f:	48 01 d0             	add    %rdx,%rax
+    15a2:	5d                   	pop    %rbp
+    15a3:	c3                   	ret
+
+00000000000015a4 <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}::operator()(unsigned long&, unsigned long const&) const>:
+            .first_n(limit)
+            .fold2(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    15a4:	55                   	push   %rbp
+    15a5:	48 89 e5             	mov    %rsp,%rbp
+    15a8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    15ac:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    15b0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    15b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15b8:	48 8b 10             	mov    (%rax),%rdx
+    15bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15bf:	48 8b 00             	mov    (%rax),%rax
+    15c2:	48 01 c2             	add    %rax,%rdx
+    15c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15c9:	48 89 10             	mov    %rdx,(%rax)
+    15cc:	90                   	nop
+    15cd:	5d                   	pop    %rbp
+    15ce:	c3                   	ret
+    15cf:	90                   	nop
+
+00000000000015d0 <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const>:
+    run("  map+first_n+fold, C      ", s, [limit](nel::Slice<int> const &s) {
+    15d0:	55                   	push   %rbp
+    15d1:	48 89 e5             	mov    %rsp,%rbp
+    15d4:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    15d8:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+    15dc:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+        return s.iter()
+    15e0:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    15e4:	48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    15e8:	48 89 d6             	mov    %rdx,%rsi
+    15eb:	48 89 c7             	mov    %rax,%rdi
+    15ee:	e8 3b 30 00 00       	call   462e <nel::Slice<int>::iter() const>
+            .map<Acc>([](int const &e) -> Acc { return Acc(e) * 3; })
+    15f3:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    15f7:	48 8d 55 f6          	lea    -0xa(%rbp),%rdx
+    15fb:	48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+    15ff:	48 89 ce             	mov    %rcx,%rsi
+    1602:	48 89 c7             	mov    %rax,%rdi
+    1605:	e8 86 13 00 00       	call   2990 <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> nel::Iterator<nel::SliceIterator<int>, int&, int&>::map<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)>
+    run("  map+first_n+fold, C      ", s, [limit](nel::Slice<int> const &s) {
+    160a:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+    160e:	48 8b 10             	mov    (%rax),%rdx
+            .first_n(limit)
+    1611:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+    1615:	48 8d 4d c0          	lea    -0x40(%rbp),%rcx
+    1619:	48 89 ce             	mov    %rcx,%rsi
+    161c:	48 89 c7             	mov    %rax,%rdi
+    161f:	e8 c4 13 00 00       	call   29e8 <nel::Iterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>, int&, unsigned long>::first_n(unsigned long)>
+            .fold2(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    1624:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    162b:	00 
+    162c:	48 8d 55 f7          	lea    -0x9(%rbp),%rdx
+    1630:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    1634:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+    1638:	48 89 ce             	mov    %rcx,%rsi
+    163b:	48 89 c7             	mov    %rax,%rdi
+    163e:	e8 1b 14 00 00       	call   2a5e <unsigned long nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold2<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)>
+    });
+    1643:	c9                   	leave
+    1644:	c3                   	ret
+
+0000000000001645 <bench_map_first_n_fold(nel::Slice<int> const&)>:
+{
+    1645:	55                   	push   %rbp
+    1646:	48 89 e5             	mov    %rsp,%rbp
+    1649:	48 83 ec 30          	sub    $0x30,%rsp
+    164d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    nel::Count const limit = s.len() - 1;
+    1651:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1655:	48 89 c7             	mov    %rax,%rdi
+    1658:	e8 2b 2e 00 00       	call   4488 <nel::Slice<int>::len() const>
+    165d:	48 83 e8 01          	sub    $0x1,%rax
+    1661:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    run("  map+first_n+fold, raw    ", s, [limit](nel::Slice<int> const &s) {
+    1665:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1669:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    166d:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1671:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1675:	48 89 c6             	mov    %rax,%rsi
+    1678:	48 8d 05 55 6a 00 00 	lea    0x6a55(%rip),%rax        # 80d4 <sizes+0x74>
+    167f:	48 89 c7             	mov    %rax,%rdi
+    1682:	e8 25 10 00 00       	call   26ac <void run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)>
+    run("  map+first_n+fold, RUST   ", s, [limit](nel::Slice<int> const &s) {
+    1687:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    168b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    168f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+    1693:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1697:	48 89 c6             	mov    %rax,%rsi
+    169a:	48 8d 05 4f 6a 00 00 	lea    0x6a4f(%rip),%rax        # 80f0 <sizes+0x90>
+    16a1:	48 89 c7             	mov    %rax,%rdi
+    16a4:	e8 3b 12 00 00       	call   28e4 <void run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)>
+    run("  map+first_n+fold, C      ", s, [limit](nel::Slice<int> const &s) {
+    16a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16ad:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    16b1:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    16b5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    16b9:	48 89 c6             	mov    %rax,%rsi
+    16bc:	48 8d 05 49 6a 00 00 	lea    0x6a49(%rip),%rax        # 810c <sizes+0xac>
+    16c3:	48 89 c7             	mov    %rax,%rdi
+    16c6:	e8 51 14 00 00       	call   2b1c <void run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)>
+}
+    16cb:	90                   	nop
+    16cc:	c9                   	leave
+    16cd:	c3                   	ret
+
+00000000000016ce <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const>:
+
+void bench_chain(nel::Slice<int> const &s)
+{
+    // the two halves, chained back together.
+    nel::Length const h = s.len() / 2;
+    run("  chain, raw loops         ", s, [h](nel::Slice<int> const &s) {
+    16ce:	       55                   	push   %rbp
+    16cf:	       48 89 e5             	mov    %rsp,%rbp
+    16d2:	       48 83 ec 30          	sub    $0x30,%rsp
+    16d6:	       48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    16da:	       48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+        Acc acc = 0;
+    16de:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    16e5:	       00 
+        int const *const p = s.ptr();
+    16e6:	       48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    16ea:	       48 89 c7             	mov    %rax,%rdi
+    16ed:	       e8 2a 2f 00 00       	call   461c <nel::Slice<int>::ptr() const>
+    16f2:	       48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        for (nel::Index i = 0; i < h; ++i) {
+    16f6:	       48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    16fd:	       00 
+    16fe:	   /-- eb 20                	jmp    1720 <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const+0x52>
+            acc += Acc(p[i]);
+    1700:	/--|-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1704:	|  |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    170b:	|  |   00 
+    170c:	|  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1710:	|  |   48 01 d0             	add    %rdx,%rax
+    1713:	|  |   8b 00                	mov    (%rax),%eax
+    1715:	|  |   48 98                	cltq
+    1717:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+        for (nel::Index i = 0; i < h; ++i) {
+    171b:	|  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    run("  chain, raw loops         ", s, [h](nel::Slice<int> const &s) {
+    1720:	|  \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1724:	|      48 8b 00             	mov    (%rax),%rax
+        for (nel::Index i = 0; i < h; ++i) {
+    1727:	|      48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    172b:	\----- 72 d3                	jb     1700 <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const+0x32>
+        }
+        for (nel::Index i = h; i < s.len(); ++i) {
+    172d:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1731:	       48 8b 00             	mov    (%rax),%rax
+    1734:	       48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1738:	   /-- eb 20                	jmp    175a <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const+0x8c>
+            acc += Acc(p[i]);
+    173a:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    173e:	|  |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1745:	|  |   00 
+    1746:	|  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    174a:	|  |   48 01 d0             	add    %rdx,%rax
+    174d:	|  |   8b 00                	mov    (%rax),%eax
+    174f:	|  |   48 98                	cltq
+    1751:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+        for (nel::Index i = h; i < s.len(); ++i) {
+    1755:	|  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    175a:	|  \-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    175e:	|      48 89 c7             	mov    %rax,%rdi
+    1761:	|      e8 22 2d 00 00       	call   4488 <nel::Slice<int>::len() const>
+    1766:	|      48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    176a:	|      0f 92 c0             	setb   %al
+    176d:	|      84 c0                	test   %al,%al
+    176f:	\----- 75 c9                	jne    173a <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const+0x6c>
+        }
+        return acc;
+    1771:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    });
+    1775:	       c9                   	leave
+    1776:	       c3                   	ret
+    1777:	       90                   	nop
+
+0000000000001778 <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}::operator()(int const&) const>:
+    run("  chain, RUST_LIKE for_each", s, [h](nel::Slice<int> const &s) {
+        Acc acc = 0;
+        s.slice(0, h).iter().chain(s.slice(h, s.len()).iter()).for_each([&acc](int const &e) {
+    1778:	55                   	push   %rbp
+    1779:	48 89 e5             	mov    %rsp,%rbp
+    177c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1780:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1784:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1788:	48 8b 00             	mov    (%rax),%rax
+            acc += Acc(e);
+    178b:	48 8b 08             	mov    (%rax),%rcx
+    178e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1792:	8b 00                	mov    (%rax),%eax
+    1794:	48 63 d0             	movslq %eax,%rdx
+        s.slice(0, h).iter().chain(s.slice(h, s.len()).iter()).for_each([&acc](int const &e) {
+    1797:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    179b:	48 8b 00             	mov    (%rax),%rax
+            acc += Acc(e);
+    179e:	48 01 ca             	add    %rcx,%rdx
+    17a1:	48 89 10             	mov    %rdx,(%rax)
+        });
+    17a4:	90                   	nop
+    17a5:	5d                   	pop    %rbp
+    17a6:	c3                   	ret
+    17a7:	90                   	nop
+
+00000000000017a8 <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const>:
+    run("  chain, RUST_LIKE for_each", s, [h](nel::Slice<int> const &s) {
+    17a8:	55                   	push   %rbp
+    17a9:	48 89 e5             	mov    %rsp,%rbp
+    17ac:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+    17b3:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+    17ba:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+        Acc acc = 0;
+    17c1:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+    17c8:	00 
+    run("  chain, RUST_LIKE for_each", s, [h](nel::Slice<int> const &s) {
+    17c9:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+    17d0:	48 8b 10             	mov    (%rax),%rdx
+        s.slice(0, h).iter().chain(s.slice(h, s.len()).iter()).for_each([&acc](int const &e) {
+    17d3:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    17d7:	48 8b b5 70 ff ff ff 	mov    -0x90(%rbp),%rsi
+    17de:	48 89 d1             	mov    %rdx,%rcx
+    17e1:	ba 00 00 00 00       	mov    $0x0,%edx
+    17e6:	48 89 c7             	mov    %rax,%rdi
+    17e9:	e8 8a 2f 00 00       	call   4778 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+    17ee:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    17f2:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    17f6:	48 89 d6             	mov    %rdx,%rsi
+    17f9:	48 89 c7             	mov    %rax,%rdi
+    17fc:	e8 2d 2e 00 00       	call   462e <nel::Slice<int>::iter() const>
+    1801:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+    1808:	48 89 c7             	mov    %rax,%rdi
+    180b:	e8 78 2c 00 00       	call   4488 <nel::Slice<int>::len() const>
+    1810:	48 89 c1             	mov    %rax,%rcx
+    run("  chain, RUST_LIKE for_each", s, [h](nel::Slice<int> const &s) {
+    1813:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+    181a:	48 8b 10             	mov    (%rax),%rdx
+        s.slice(0, h).iter().chain(s.slice(h, s.len()).iter()).for_each([&acc](int const &e) {
+    181d:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1821:	48 8b b5 70 ff ff ff 	mov    -0x90(%rbp),%rsi
+    1828:	48 89 c7             	mov    %rax,%rdi
+    182b:	e8 48 2f 00 00       	call   4778 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+    1830:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1834:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1838:	48 89 d6             	mov    %rdx,%rsi
+    183b:	48 89 c7             	mov    %rax,%rdi
+    183e:	e8 eb 2d 00 00       	call   462e <nel::Slice<int>::iter() const>
+    1843:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+    1847:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    184b:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+    184f:	48 89 ce             	mov    %rcx,%rsi
+    1852:	48 89 c7             	mov    %rax,%rdi
+    1855:	e8 b6 2f 00 00       	call   4810 <nel::Iterator<nel::SliceIterator<int>, int&, int&>::chain(nel::SliceIterator<int>&&)>
+    185a:	48 8d 45 88          	lea    -0x78(%rbp),%rax
+    185e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1862:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    1866:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+    186a:	48 89 d6             	mov    %rdx,%rsi
+    186d:	48 89 c7             	mov    %rax,%rdi
+    1870:	e8 61 14 00 00       	call   2cd6 <void nel::ChainIterator<nel::SliceIterator<int> >::for_each<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)>
+        return acc;
+    1875:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+    });
+    1879:	c9                   	leave
+    187a:	c3                   	ret
+    187b:	90                   	nop
+
+000000000000187c <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}::operator()(int const&) const>:
+    run("  chain, C_LIKE for_each   ", s, [h](nel::Slice<int> const &s) {
+        Acc acc = 0;
+        s.slice(0, h).iter().chain(s.slice(h, s.len()).iter()).for_each2([&acc](int const &e) {
+    187c:	55                   	push   %rbp
+    187d:	48 89 e5             	mov    %rsp,%rbp
+    1880:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1884:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1888:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    188c:	48 8b 00             	mov    (%rax),%rax
+            acc += Acc(e);
+    188f:	48 8b 08             	mov    (%rax),%rcx
+    1892:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1896:	8b 00                	mov    (%rax),%eax
+    1898:	48 63 d0             	movslq %eax,%rdx
+        s.slice(0, h).iter().chain(s.slice(h, s.len()).iter()).for_each2([&acc](int const &e) {
+    189b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    189f:	48 8b 00             	mov    (%rax),%rax
+            acc += Acc(e);
+    18a2:	48 01 ca             	add    %rcx,%rdx
+    18a5:	48 89 10             	mov    %rdx,(%rax)
+        });
+    18a8:	90                   	nop
+    18a9:	5d                   	pop    %rbp
+    18aa:	c3                   	ret
+    18ab:	90                   	nop
+
+00000000000018ac <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const>:
+    run("  chain, C_LIKE for_each   ", s, [h](nel::Slice<int> const &s) {
+    18ac:	55                   	push   %rbp
+    18ad:	48 89 e5             	mov    %rsp,%rbp
+    18b0:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+    18b7:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+    18be:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+        Acc acc = 0;
+    18c5:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+    18cc:	00 
+    run("  chain, C_LIKE for_each   ", s, [h](nel::Slice<int> const &s) {
+    18cd:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+    18d4:	48 8b 10             	mov    (%rax),%rdx
+        s.slice(0, h).iter().chain(s.slice(h, s.len()).iter()).for_each2([&acc](int const &e) {
+    18d7:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    18db:	48 8b b5 70 ff ff ff 	mov    -0x90(%rbp),%rsi
+    18e2:	48 89 d1             	mov    %rdx,%rcx
+    18e5:	ba 00 00 00 00       	mov    $0x0,%edx
+    18ea:	48 89 c7             	mov    %rax,%rdi
+    18ed:	e8 86 2e 00 00       	call   4778 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+    18f2:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    18f6:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    18fa:	48 89 d6             	mov    %rdx,%rsi
+    18fd:	48 89 c7             	mov    %rax,%rdi
+    1900:	e8 29 2d 00 00       	call   462e <nel::Slice<int>::iter() const>
+    1905:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+    190c:	48 89 c7             	mov    %rax,%rdi
+    190f:	e8 74 2b 00 00       	call   4488 <nel::Slice<int>::len() const>
+    1914:	48 89 c1             	mov    %rax,%rcx
+    run("  chain, C_LIKE for_each   ", s, [h](nel::Slice<int> const &s) {
+    1917:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+    191e:	48 8b 10             	mov    (%rax),%rdx
+        s.slice(0, h).iter().chain(s.slice(h, s.len()).iter()).for_each2([&acc](int const &e) {
+    1921:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1925:	48 8b b5 70 ff ff ff 	mov    -0x90(%rbp),%rsi
+    192c:	48 89 c7             	mov    %rax,%rdi
+    192f:	e8 44 2e 00 00       	call   4778 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+    1934:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1938:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    193c:	48 89 d6             	mov    %rdx,%rsi
+    193f:	48 89 c7             	mov    %rax,%rdi
+    1942:	e8 e7 2c 00 00       	call   462e <nel::Slice<int>::iter() const>
+    1947:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+    194b:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    194f:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+    1953:	48 89 ce             	mov    %rcx,%rsi
+    1956:	48 89 c7             	mov    %rax,%rdi
+    1959:	e8 b2 2e 00 00       	call   4810 <nel::Iterator<nel::SliceIterator<int>, int&, int&>::chain(nel::SliceIterator<int>&&)>
+    195e:	48 8d 45 88          	lea    -0x78(%rbp),%rax
+    1962:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1966:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    196a:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+    196e:	48 89 d6             	mov    %rdx,%rsi
+    1971:	48 89 c7             	mov    %rax,%rdi
+    1974:	e8 a9 14 00 00       	call   2e22 <void nel::ChainIterator<nel::SliceIterator<int> >::for_each2<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)>
+        return acc;
+    1979:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+    });
+    197d:	c9                   	leave
+    197e:	c3                   	ret
+    197f:	90                   	nop
+
+0000000000001980 <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}::operator()(nel::Slice<int> const&) const>:
+    // driven from outside, so chain's own for_each can't help.
+    run("  chain, RUST_LIKE next()  ", s, [h](nel::Slice<int> const &s) {
+    1980:	          55                   	push   %rbp
+    1981:	          48 89 e5             	mov    %rsp,%rbp
+    1984:	          53                   	push   %rbx
+    1985:	          48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+    198c:	          48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+    1993:	          48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+        Acc acc = 0;
+    199a:	          48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+    19a1:	          00 
+    run("  chain, RUST_LIKE next()  ", s, [h](nel::Slice<int> const &s) {
+    19a2:	          48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+    19a9:	          48 8b 10             	mov    (%rax),%rdx
+        auto it = s.slice(0, h).iter().chain(s.slice(h, s.len()).iter());
+    19ac:	          48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    19b0:	          48 8b b5 50 ff ff ff 	mov    -0xb0(%rbp),%rsi
+    19b7:	          48 89 d1             	mov    %rdx,%rcx
+    19ba:	          ba 00 00 00 00       	mov    $0x0,%edx
+    19bf:	          48 89 c7             	mov    %rax,%rdi
+    19c2:	          e8 b1 2d 00 00       	call   4778 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+    19c7:	          48 8d 45 90          	lea    -0x70(%rbp),%rax
+    19cb:	          48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    19cf:	          48 89 d6             	mov    %rdx,%rsi
+    19d2:	          48 89 c7             	mov    %rax,%rdi
+    19d5:	          e8 54 2c 00 00       	call   462e <nel::Slice<int>::iter() const>
+    19da:	          48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+    19e1:	          48 89 c7             	mov    %rax,%rdi
+    19e4:	          e8 9f 2a 00 00       	call   4488 <nel::Slice<int>::len() const>
+    19e9:	          48 89 c1             	mov    %rax,%rcx
+    run("  chain, RUST_LIKE next()  ", s, [h](nel::Slice<int> const &s) {
+    19ec:	          48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+    19f3:	          48 8b 10             	mov    (%rax),%rdx
+        auto it = s.slice(0, h).iter().chain(s.slice(h, s.len()).iter());
+    19f6:	          48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    19fa:	          48 8b b5 50 ff ff ff 	mov    -0xb0(%rbp),%rsi
+    1a01:	          48 89 c7             	mov    %rax,%rdi
+    1a04:	          e8 6f 2d 00 00       	call   4778 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+    1a09:	          48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    1a0d:	          48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    1a11:	          48 89 d6             	mov    %rdx,%rsi
+    1a14:	          48 89 c7             	mov    %rax,%rdi
+    1a17:	          e8 12 2c 00 00       	call   462e <nel::Slice<int>::iter() const>
+    1a1c:	          48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+    1a23:	          48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    1a27:	          48 8d 4d 90          	lea    -0x70(%rbp),%rcx
+    1a2b:	          48 89 ce             	mov    %rcx,%rsi
+    1a2e:	          48 89 c7             	mov    %rax,%rdi
+    1a31:	          e8 da 2d 00 00       	call   4810 <nel::Iterator<nel::SliceIterator<int>, int&, int&>::chain(nel::SliceIterator<int>&&)>
+        while (true) {
+            auto v = it.next();
+    1a36:	/-------> 48 8d 45 80          	lea    -0x80(%rbp),%rax
+    1a3a:	|         48 8d 95 60 ff ff ff 	lea    -0xa0(%rbp),%rdx
+    1a41:	|         48 89 d6             	mov    %rdx,%rsi
+    1a44:	|         48 89 c7             	mov    %rax,%rdi
+    1a47:	|         e8 4c 2e 00 00       	call   4898 <nel::ChainIterator<nel::SliceIterator<int> >::next()>
+            if (v.is_none()) { break; }
+    1a4c:	|         48 8d 45 80          	lea    -0x80(%rbp),%rax
+    1a50:	|         48 89 c7             	mov    %rax,%rdi
+    1a53:	|         e8 46 2c 00 00       	call   469e <nel::Optional<int&>::is_none() const>
+    1a58:	|         84 c0                	test   %al,%al
+    1a5a:	|     /-- 74 07                	je     1a63 <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}::operator()(nel::Slice<int> const&) const+0xe3>
+    1a5c:	|     |   bb 00 00 00 00       	mov    $0x0,%ebx
+    1a61:	|  /--|-- eb 3f                	jmp    1aa2 <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}::operator()(nel::Slice<int> const&) const+0x122>
+            acc += Acc(v.unwrap());
+    1a63:	|  |  \-> 48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1a67:	|  |      b9 8c 00 00 00       	mov    $0x8c,%ecx
+    1a6c:	|  |      48 8d 15 b5 66 00 00 	lea    0x66b5(%rip),%rdx        # 8128 <sizes+0xc8>
+    1a73:	|  |      48 8d 35 c9 66 00 00 	lea    0x66c9(%rip),%rsi        # 8143 <sizes+0xe3>
+    1a7a:	|  |      48 89 c7             	mov    %rax,%rdi
+    1a7d:	|  |      e8 ac 28 00 00       	call   432e <nel::Context::Context(char const*, char const*, int)>
+    1a82:	|  |      48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    1a86:	|  |      48 8d 45 80          	lea    -0x80(%rbp),%rax
+    1a8a:	|  |      48 89 d6             	mov    %rdx,%rsi
+    1a8d:	|  |      48 89 c7             	mov    %rax,%rdi
+    1a90:	|  |      e8 13 2f 00 00       	call   49a8 <nel::Optional<int&>::unwrap(nel::Context const&)>
+    1a95:	|  |      8b 00                	mov    (%rax),%eax
+    1a97:	|  |      48 98                	cltq
+    1a99:	|  |      48 01 45 e8          	add    %rax,-0x18(%rbp)
+        }
+    1a9d:	|  |      bb 01 00 00 00       	mov    $0x1,%ebx
+    1aa2:	|  \----> 48 8d 45 80          	lea    -0x80(%rbp),%rax
+    1aa6:	|         48 89 c7             	mov    %rax,%rdi
+    1aa9:	|         e8 5e 2e 00 00       	call   490c <nel::Optional<int&>::~Optional()>
+    1aae:	|         83 fb 01             	cmp    $0x1,%ebx
+    1ab1:	|     /-- 75 02                	jne    1ab5 <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}::operator()(nel::Slice<int> const&) const+0x135>
+    1ab3:	\-----|-- eb 81                	jmp    1a36 <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}::operator()(nel::Slice<int> const&) const+0xb6>
+        return acc;
+    1ab5:	      \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    });
+    1ab9:	          48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1abd:	          c9                   	leave
+    1abe:	          c3                   	ret
+    1abf:	          90                   	nop
+
+0000000000001ac0 <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}::operator()(nel::Slice<int> const&) const>:
+    run("  chain, C_LIKE ++/*       ", s, [h](nel::Slice<int> const &s) {
+    1ac0:	       55                   	push   %rbp
+    1ac1:	       48 89 e5             	mov    %rsp,%rbp
+    1ac4:	       48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    1ac8:	       48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+    1acc:	       48 89 75 80          	mov    %rsi,-0x80(%rbp)
+        Acc acc = 0;
+    1ad0:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1ad7:	       00 
+    run("  chain, C_LIKE ++/*       ", s, [h](nel::Slice<int> const &s) {
+    1ad8:	       48 8b 45 88          	mov    -0x78(%rbp),%rax
+    1adc:	       48 8b 10             	mov    (%rax),%rdx
+        auto it = s.slice(0, h).iter().chain(s.slice(h, s.len()).iter());
+    1adf:	       48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1ae3:	       48 8b 75 80          	mov    -0x80(%rbp),%rsi
+    1ae7:	       48 89 d1             	mov    %rdx,%rcx
+    1aea:	       ba 00 00 00 00       	mov    $0x0,%edx
+    1aef:	       48 89 c7             	mov    %rax,%rdi
+    1af2:	       e8 81 2c 00 00       	call   4778 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+    1af7:	       48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    1afb:	       48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    1aff:	       48 89 d6             	mov    %rdx,%rsi
+    1b02:	       48 89 c7             	mov    %rax,%rdi
+    1b05:	       e8 24 2b 00 00       	call   462e <nel::Slice<int>::iter() const>
+    1b0a:	       48 8b 45 80          	mov    -0x80(%rbp),%rax
+    1b0e:	       48 89 c7             	mov    %rax,%rdi
+    1b11:	       e8 72 29 00 00       	call   4488 <nel::Slice<int>::len() const>
+    1b16:	       48 89 c1             	mov    %rax,%rcx
+    run("  chain, C_LIKE ++/*       ", s, [h](nel::Slice<int> const &s) {
+    1b19:	       48 8b 45 88          	mov    -0x78(%rbp),%rax
+    1b1d:	       48 8b 10             	mov    (%rax),%rdx
+        auto it = s.slice(0, h).iter().chain(s.slice(h, s.len()).iter());
+    1b20:	       48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1b24:	       48 8b 75 80          	mov    -0x80(%rbp),%rsi
+    1b28:	       48 89 c7             	mov    %rax,%rdi
+    1b2b:	       e8 48 2c 00 00       	call   4778 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+    1b30:	       48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1b34:	       48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1b38:	       48 89 d6             	mov    %rdx,%rsi
+    1b3b:	       48 89 c7             	mov    %rax,%rdi
+    1b3e:	       e8 eb 2a 00 00       	call   462e <nel::Slice<int>::iter() const>
+    1b43:	       48 8d 45 90          	lea    -0x70(%rbp),%rax
+    1b47:	       48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    1b4b:	       48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+    1b4f:	       48 89 ce             	mov    %rcx,%rsi
+    1b52:	       48 89 c7             	mov    %rax,%rdi
+    1b55:	       e8 b6 2c 00 00       	call   4810 <nel::Iterator<nel::SliceIterator<int>, int&, int&>::chain(nel::SliceIterator<int>&&)>
+        for (; it; ++it) {
+    1b5a:	   /-- eb 20                	jmp    1b7c <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}::operator()(nel::Slice<int> const&) const+0xbc>
+            acc += Acc(*it);
+    1b5c:	/--|-> 48 8d 45 90          	lea    -0x70(%rbp),%rax
+    1b60:	|  |   48 89 c7             	mov    %rax,%rdi
+    1b63:	|  |   e8 98 2e 00 00       	call   4a00 <nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::operator*()>
+    1b68:	|  |   8b 00                	mov    (%rax),%eax
+    1b6a:	|  |   48 98                	cltq
+    1b6c:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+        for (; it; ++it) {
+    1b70:	|  |   48 8d 45 90          	lea    -0x70(%rbp),%rax
+    1b74:	|  |   48 89 c7             	mov    %rax,%rdi
+    1b77:	|  |   e8 5e 2e 00 00       	call   49da <nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::operator++()>
+    1b7c:	|  \-> 48 8d 45 90          	lea    -0x70(%rbp),%rax
+    1b80:	|      48 89 c7             	mov    %rax,%rdi
+    1b83:	|      e8 12 29 00 00       	call   449a <nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::operator bool() const>
+    1b88:	|      84 c0                	test   %al,%al
+    1b8a:	\----- 75 d0                	jne    1b5c <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}::operator()(nel::Slice<int> const&) const+0x9c>
+        }
+        return acc;
+    1b8c:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    });
+    1b90:	       c9                   	leave
+    1b91:	       c3                   	ret
+
+0000000000001b92 <bench_chain(nel::Slice<int> const&)>:
+{
+    1b92:	55                   	push   %rbp
+    1b93:	48 89 e5             	mov    %rsp,%rbp
+    1b96:	48 83 ec 40          	sub    $0x40,%rsp
+    1b9a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    nel::Length const h = s.len() / 2;
+    1b9e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1ba2:	48 89 c7             	mov    %rax,%rdi
+    1ba5:	e8 de 28 00 00       	call   4488 <nel::Slice<int>::len() const>
+    1baa:	48 d1 e8             	shr    %rax
+    1bad:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    run("  chain, raw loops         ", s, [h](nel::Slice<int> const &s) {
+    1bb1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bb5:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    1bb9:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    1bbd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1bc1:	48 89 c6             	mov    %rax,%rsi
+    1bc4:	48 8d 05 83 65 00 00 	lea    0x6583(%rip),%rax        # 814e <sizes+0xee>
+    1bcb:	48 89 c7             	mov    %rax,%rdi
+    1bce:	e8 57 10 00 00       	call   2c2a <void run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)>
+    run("  chain, RUST_LIKE for_each", s, [h](nel::Slice<int> const &s) {
+    1bd3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bd7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    1bdb:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+    1bdf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1be3:	48 89 c6             	mov    %rax,%rsi
+    1be6:	48 8d 05 7d 65 00 00 	lea    0x657d(%rip),%rax        # 816a <sizes+0x10a>
+    1bed:	48 89 c7             	mov    %rax,%rdi
+    1bf0:	e8 81 11 00 00       	call   2d76 <void run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)>
+    run("  chain, C_LIKE for_each   ", s, [h](nel::Slice<int> const &s) {
+    1bf5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bf9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1bfd:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1c01:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1c05:	48 89 c6             	mov    %rax,%rsi
+    1c08:	48 8d 05 77 65 00 00 	lea    0x6577(%rip),%rax        # 8186 <sizes+0x126>
+    1c0f:	48 89 c7             	mov    %rax,%rdi
+    1c12:	e8 ab 12 00 00       	call   2ec2 <void run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)>
+    run("  chain, RUST_LIKE next()  ", s, [h](nel::Slice<int> const &s) {
+    1c17:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c1b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1c1f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+    1c23:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1c27:	48 89 c6             	mov    %rax,%rsi
+    1c2a:	48 8d 05 71 65 00 00 	lea    0x6571(%rip),%rax        # 81a2 <sizes+0x142>
+    1c31:	48 89 c7             	mov    %rax,%rdi
+    1c34:	e8 97 13 00 00       	call   2fd0 <void run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}&&)>
+    run("  chain, C_LIKE ++/*       ", s, [h](nel::Slice<int> const &s) {
+    1c39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c3d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1c41:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    1c45:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1c49:	48 89 c6             	mov    %rax,%rsi
+    1c4c:	48 8d 05 6b 65 00 00 	lea    0x656b(%rip),%rax        # 81be <sizes+0x15e>
+    1c53:	48 89 c7             	mov    %rax,%rdi
+    1c56:	e8 83 14 00 00       	call   30de <void run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}&&)>
+}
+    1c5b:	90                   	nop
+    1c5c:	c9                   	leave
+    1c5d:	c3                   	ret
+
+0000000000001c5e <bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const>:
+    for (nel::Index i = 0; i < queue_len + queue_len / 2; ++i) {
+        queue.push(int(i % 1000)).unwrap();
+    }
+    // the same items, as one slice.
+    auto flat = s.slice(0, queue_len);
+    run("  queue, raw slice         ", flat, [](nel::Slice<int> const &s) {
+    1c5e:	       55                   	push   %rbp
+    1c5f:	       48 89 e5             	mov    %rsp,%rbp
+    1c62:	       48 83 ec 30          	sub    $0x30,%rsp
+    1c66:	       48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1c6a:	       48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+        Acc acc = 0;
+    1c6e:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1c75:	       00 
+        int const *const p = s.ptr();
+    1c76:	       48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1c7a:	       48 89 c7             	mov    %rax,%rdi
+    1c7d:	       e8 9a 29 00 00       	call   461c <nel::Slice<int>::ptr() const>
+    1c82:	       48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    1c86:	       48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1c8d:	       00 
+    1c8e:	   /-- eb 20                	jmp    1cb0 <bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const+0x52>
+            acc += Acc(p[i]);
+    1c90:	/--|-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c94:	|  |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c9b:	|  |   00 
+    1c9c:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ca0:	|  |   48 01 d0             	add    %rdx,%rax
+    1ca3:	|  |   8b 00                	mov    (%rax),%eax
+    1ca5:	|  |   48 98                	cltq
+    1ca7:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    1cab:	|  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    1cb0:	|  \-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1cb4:	|      48 89 c7             	mov    %rax,%rdi
+    1cb7:	|      e8 cc 27 00 00       	call   4488 <nel::Slice<int>::len() const>
+    1cbc:	|      48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1cc0:	|      0f 92 c0             	setb   %al
+    1cc3:	|      84 c0                	test   %al,%al
+    1cc5:	\----- 75 c9                	jne    1c90 <bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const+0x32>
+        }
+        return acc;
+    1cc7:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    });
+    1ccb:	       c9                   	leave
+    1ccc:	       c3                   	ret
+    1ccd:	       90                   	nop
+
+0000000000001cce <bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}::operator()(int const&) const>:
+    run_queue("  queue, for_each          ", [](Queue &q) {
+        Acc acc = 0;
+        q.iter().for_each([&acc](int const &e) { acc += Acc(e); });
+    1cce:	55                   	push   %rbp
+    1ccf:	48 89 e5             	mov    %rsp,%rbp
+    1cd2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1cd6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1cda:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cde:	48 8b 00             	mov    (%rax),%rax
+    1ce1:	48 8b 08             	mov    (%rax),%rcx
+    1ce4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ce8:	8b 00                	mov    (%rax),%eax
+    1cea:	48 63 d0             	movslq %eax,%rdx
+    1ced:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cf1:	48 8b 00             	mov    (%rax),%rax
+    1cf4:	48 01 ca             	add    %rcx,%rdx
+    1cf7:	48 89 10             	mov    %rdx,(%rax)
+    1cfa:	90                   	nop
+    1cfb:	5d                   	pop    %rbp
+    1cfc:	c3                   	ret
+    1cfd:	90                   	nop
+
+0000000000001cfe <bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const>:
+    run_queue("  queue, for_each          ", [](Queue &q) {
+    1cfe:	55                   	push   %rbp
+    1cff:	48 89 e5             	mov    %rsp,%rbp
+    1d02:	48 83 ec 50          	sub    $0x50,%rsp
+    1d06:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    1d0a:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+        Acc acc = 0;
+    1d0e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+    1d15:	00 
+        q.iter().for_each([&acc](int const &e) { acc += Acc(e); });
+    1d16:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1d1a:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    1d1e:	48 89 d6             	mov    %rdx,%rsi
+    1d21:	48 89 c7             	mov    %rax,%rdi
+    1d24:	e8 af 2f 00 00       	call   4cd8 <nel::heapless::Queue<int, 4096ul>::iter()>
+    1d29:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    1d2d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1d31:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    1d35:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1d39:	48 89 d6             	mov    %rdx,%rsi
+    1d3c:	48 89 c7             	mov    %rax,%rdi
+    1d3f:	e8 54 15 00 00       	call   3298 <void nel::ChainIterator<nel::SliceIterator<int> >::for_each<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&&)>
+        return acc;
+    1d44:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    });
+    1d48:	c9                   	leave
+    1d49:	c3                   	ret
+
+0000000000001d4a <bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}::operator()(int const&) const>:
+    run_queue("  queue, map+fold          ", [](Queue &q) {
+        return q.iter()
+            .map<Acc>([](int const &e) -> Acc { return Acc(e); })
+    1d4a:	55                   	push   %rbp
+    1d4b:	48 89 e5             	mov    %rsp,%rbp
+    1d4e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1d52:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1d56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d5a:	8b 00                	mov    (%rax),%eax
+    1d5c:	48 98                	cltq
+    1d5e:	5d                   	pop    %rbp
+    1d5f:	c3                   	ret
+
+0000000000001d60 <bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}::operator()(unsigned long&, unsigned long const&) const>:
+            .fold(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    1d60:	55                   	push   %rbp
+    1d61:	48 89 e5             	mov    %rsp,%rbp
+    1d64:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1d68:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1d6c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1d70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d74:	48 8b 10             	mov    (%rax),%rdx
+    1d77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d7b:	48 8b 00             	mov    (%rax),%rax
+    1d7e:	48 01 c2             	add    %rax,%rdx
+    1d81:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d85:	48 89 10             	mov    %rdx,(%rax)
+    1d88:	90                   	nop
+    1d89:	5d                   	pop    %rbp
+    1d8a:	c3                   	ret
+    1d8b:	90                   	nop
+
+0000000000001d8c <bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const>:
+    run_queue("  queue, map+fold          ", [](Queue &q) {
+    1d8c:	55                   	push   %rbp
+    1d8d:	48 89 e5             	mov    %rsp,%rbp
+    1d90:	48 83 ec 70          	sub    $0x70,%rsp
+    1d94:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    1d98:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+        return q.iter()
+    1d9c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1da0:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    1da4:	48 89 d6             	mov    %rdx,%rsi
+    1da7:	48 89 c7             	mov    %rax,%rdi
+    1daa:	e8 29 2f 00 00       	call   4cd8 <nel::heapless::Queue<int, 4096ul>::iter()>
+            .map<Acc>([](int const &e) -> Acc { return Acc(e); })
+    1daf:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    1db3:	48 8d 55 f6          	lea    -0xa(%rbp),%rdx
+    1db7:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    1dbb:	48 89 ce             	mov    %rcx,%rsi
+    1dbe:	48 89 c7             	mov    %rax,%rdi
+    1dc1:	e8 e6 15 00 00       	call   33ac <nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}> nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::map<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&&)>
+            .fold(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    1dc6:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1dcd:	00 
+    1dce:	48 8d 55 f7          	lea    -0x9(%rbp),%rdx
+    1dd2:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    1dd6:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    1dda:	48 89 ce             	mov    %rcx,%rsi
+    1ddd:	48 89 c7             	mov    %rax,%rdi
+    1de0:	e8 51 16 00 00       	call   3436 <unsigned long nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)>
+    });
+    1de5:	c9                   	leave
+    1de6:	c3                   	ret
+    1de7:	90                   	nop
+
+0000000000001de8 <bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}::operator()(nel::heapless::Queue<int, 4096ul>&) const>:
+    run_queue("  queue, ++/*              ", [](Queue &q) {
+    1de8:	       55                   	push   %rbp
+    1de9:	       48 89 e5             	mov    %rsp,%rbp
+    1dec:	       48 83 ec 40          	sub    $0x40,%rsp
+    1df0:	       48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    1df4:	       48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+        Acc acc = 0;
+    1df8:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1dff:	       00 
+        for (auto it = q.iter(); it; ++it) {
+    1e00:	       48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1e04:	       48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1e08:	       48 89 d6             	mov    %rdx,%rsi
+    1e0b:	       48 89 c7             	mov    %rax,%rdi
+    1e0e:	       e8 c5 2e 00 00       	call   4cd8 <nel::heapless::Queue<int, 4096ul>::iter()>
+    1e13:	   /-- eb 20                	jmp    1e35 <bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}::operator()(nel::heapless::Queue<int, 4096ul>&) const+0x4d>
+            acc += Acc(*it);
+    1e15:	/--|-> 48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1e19:	|  |   48 89 c7             	mov    %rax,%rdi
+    1e1c:	|  |   e8 df 2b 00 00       	call   4a00 <nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::operator*()>
+    1e21:	|  |   8b 00                	mov    (%rax),%eax
+    1e23:	|  |   48 98                	cltq
+    1e25:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+        for (auto it = q.iter(); it; ++it) {
+    1e29:	|  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1e2d:	|  |   48 89 c7             	mov    %rax,%rdi
+    1e30:	|  |   e8 a5 2b 00 00       	call   49da <nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::operator++()>
+    1e35:	|  \-> 48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1e39:	|      48 89 c7             	mov    %rax,%rdi
+    1e3c:	|      e8 59 26 00 00       	call   449a <nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::operator bool() const>
+    1e41:	|      84 c0                	test   %al,%al
+    1e43:	\----- 75 d0                	jne    1e15 <bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}::operator()(nel::heapless::Queue<int, 4096ul>&) const+0x2d>
+        }
+        return acc;
+    1e45:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    });
+    1e49:	       c9                   	leave
+    1e4a:	       c3                   	ret
+
+0000000000001e4b <bench_queue(nel::Slice<int> const&)>:
+{
+    1e4b:	       55                   	push   %rbp
+    1e4c:	       48 89 e5             	mov    %rsp,%rbp
+    1e4f:	       48 83 ec 60          	sub    $0x60,%rsp
+    1e53:	       48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+    for (nel::Index i = 0; i < queue_len + queue_len / 2; ++i) {
+    1e57:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1e5e:	       00 
+    1e5f:	   /-- e9 8c 00 00 00       	jmp    1ef0 <bench_queue(nel::Slice<int> const&)+0xa5>
+        queue.push(int(i % 1000)).unwrap();
+    1e64:	/--|-> 48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1e68:	|  |   48 89 c8             	mov    %rcx,%rax
+    1e6b:	|  |   48 c1 e8 03          	shr    $0x3,%rax
+    1e6f:	|  |   48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+    1e76:	|  |   9b c4 20 
+    1e79:	|  |   48 f7 e2             	mul    %rdx
+    1e7c:	|  |   48 89 d0             	mov    %rdx,%rax
+    1e7f:	|  |   48 c1 e8 04          	shr    $0x4,%rax
+    1e83:	|  |   48 69 d0 e8 03 00 00 	imul   $0x3e8,%rax,%rdx
+    1e8a:	|  |   48 89 c8             	mov    %rcx,%rax
+    1e8d:	|  |   48 29 d0             	sub    %rdx,%rax
+    1e90:	|  |   89 45 cc             	mov    %eax,-0x34(%rbp)
+    1e93:	|  |   48 8d 45 c4          	lea    -0x3c(%rbp),%rax
+    1e97:	|  |   48 8d 55 cc          	lea    -0x34(%rbp),%rdx
+    1e9b:	|  |   48 8d 0d 1e b2 00 00 	lea    0xb21e(%rip),%rcx        # d0c0 <queue>
+    1ea2:	|  |   48 89 ce             	mov    %rcx,%rsi
+    1ea5:	|  |   48 89 c7             	mov    %rax,%rdi
+    1ea8:	|  |   e8 d9 2b 00 00       	call   4a86 <nel::heapless::Queue<int, 4096ul>::push(int&&)>
+    1ead:	|  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1eb1:	|  |   b9 b0 00 00 00       	mov    $0xb0,%ecx
+    1eb6:	|  |   48 8d 15 6b 62 00 00 	lea    0x626b(%rip),%rdx        # 8128 <sizes+0xc8>
+    1ebd:	|  |   48 8d 35 24 63 00 00 	lea    0x6324(%rip),%rsi        # 81e8 <queue_len+0x8>
+    1ec4:	|  |   48 89 c7             	mov    %rax,%rdi
+    1ec7:	|  |   e8 62 24 00 00       	call   432e <nel::Context::Context(char const*, char const*, int)>
+    1ecc:	|  |   48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    1ed0:	|  |   48 8d 45 c4          	lea    -0x3c(%rbp),%rax
+    1ed4:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1ed7:	|  |   48 89 c7             	mov    %rax,%rdi
+    1eda:	|  |   e8 8d 2d 00 00       	call   4c6c <nel::Result<void, int>::unwrap(nel::Context const&)>
+    1edf:	|  |   48 8d 45 c4          	lea    -0x3c(%rbp),%rax
+    1ee3:	|  |   48 89 c7             	mov    %rax,%rdi
+    1ee6:	|  |   e8 cb 2c 00 00       	call   4bb6 <nel::Result<void, int>::~Result()>
+    for (nel::Index i = 0; i < queue_len + queue_len / 2; ++i) {
+    1eeb:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1ef0:	|  \-> 48 81 7d f8 ff 17 00 	cmpq   $0x17ff,-0x8(%rbp)
+    1ef7:	|      00 
+    1ef8:	\----- 0f 86 66 ff ff ff    	jbe    1e64 <bench_queue(nel::Slice<int> const&)+0x19>
+    auto flat = s.slice(0, queue_len);
+    1efe:	       48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    1f02:	       48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+    1f06:	       b9 00 10 00 00       	mov    $0x1000,%ecx
+    1f0b:	       ba 00 00 00 00       	mov    $0x0,%edx
+    1f10:	       48 89 c7             	mov    %rax,%rdi
+    1f13:	       e8 60 28 00 00       	call   4778 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+    run("  queue, raw slice         ", flat, [](nel::Slice<int> const &s) {
+    1f18:	       48 8d 55 f4          	lea    -0xc(%rbp),%rdx
+    1f1c:	       48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    1f20:	       48 89 c6             	mov    %rax,%rsi
+    1f23:	       48 8d 05 ca 62 00 00 	lea    0x62ca(%rip),%rax        # 81f4 <queue_len+0x14>
+    1f2a:	       48 89 c7             	mov    %rax,%rdi
+    1f2d:	       e8 ba 12 00 00       	call   31ec <void run<bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)>
+    run_queue("  queue, for_each          ", [](Queue &q) {
+    1f32:	       48 8d 45 f5          	lea    -0xb(%rbp),%rax
+    1f36:	       48 89 c6             	mov    %rax,%rsi
+    1f39:	       48 8d 05 d0 62 00 00 	lea    0x62d0(%rip),%rax        # 8210 <queue_len+0x30>
+    1f40:	       48 89 c7             	mov    %rax,%rdi
+    1f43:	       e8 eb 13 00 00       	call   3333 <void run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}&&)>
+    run_queue("  queue, map+fold          ", [](Queue &q) {
+    1f48:	       48 8d 45 f6          	lea    -0xa(%rbp),%rax
+    1f4c:	       48 89 c6             	mov    %rax,%rsi
+    1f4f:	       48 8d 05 d6 62 00 00 	lea    0x62d6(%rip),%rax        # 822c <queue_len+0x4c>
+    1f56:	       48 89 c7             	mov    %rax,%rdi
+    1f59:	       e8 91 15 00 00       	call   34ef <void run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}&&)>
+    run_queue("  queue, ++/*              ", [](Queue &q) {
+    1f5e:	       48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1f62:	       48 89 c6             	mov    %rax,%rsi
+    1f65:	       48 8d 05 dc 62 00 00 	lea    0x62dc(%rip),%rax        # 8248 <queue_len+0x68>
+    1f6c:	       48 89 c7             	mov    %rax,%rdi
+    1f6f:	       e8 51 16 00 00       	call   35c5 <void run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}&&)>
+}
+    1f74:	       90                   	nop
+    1f75:	       c9                   	leave
+    1f76:	       c3                   	ret
+
+0000000000001f77 <main>:
+
+int main()
+{
+    1f77:	       55                   	push   %rbp
+    1f78:	       48 89 e5             	mov    %rsp,%rbp
+    1f7b:	       53                   	push   %rbx
+    1f7c:	       48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+    nel::Length const max_len = sizes[sizeof(sizes) / sizeof(sizes[0]) - 1] / sizeof(int);
+    1f83:	       48 c7 45 d8 00 00 00 	movq   $0x1000000,-0x28(%rbp)
+    1f8a:	       01 
+    auto v = nel::heaped::Vector<int>::with_capacity(max_len);
+    1f8b:	       48 8d 85 78 ff ff ff 	lea    -0x88(%rbp),%rax
+    1f92:	       be 00 00 00 01       	mov    $0x1000000,%esi
+    1f97:	       48 89 c7             	mov    %rax,%rdi
+    1f9a:	       e8 a1 2f 00 00       	call   4f40 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+    for (nel::Index i = 0; i < max_len; ++i) {
+    1f9f:	       48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+    1fa6:	       00 
+    1fa7:	   /-- e9 8c 00 00 00       	jmp    2038 <main+0xc1>
+        v.push(int(i % 1000)).unwrap();
+    1fac:	/--|-> 48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1fb0:	|  |   48 89 c8             	mov    %rcx,%rax
+    1fb3:	|  |   48 c1 e8 03          	shr    $0x3,%rax
+    1fb7:	|  |   48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+    1fbe:	|  |   9b c4 20 
+    1fc1:	|  |   48 f7 e2             	mul    %rdx
+    1fc4:	|  |   48 89 d0             	mov    %rdx,%rax
+    1fc7:	|  |   48 c1 e8 04          	shr    $0x4,%rax
+    1fcb:	|  |   48 69 d0 e8 03 00 00 	imul   $0x3e8,%rax,%rdx
+    1fd2:	|  |   48 89 c8             	mov    %rcx,%rax
+    1fd5:	|  |   48 29 d0             	sub    %rdx,%rax
+    1fd8:	|  |   89 45 8c             	mov    %eax,-0x74(%rbp)
+    1fdb:	|  |   48 8d 45 84          	lea    -0x7c(%rbp),%rax
+    1fdf:	|  |   48 8d 55 8c          	lea    -0x74(%rbp),%rdx
+    1fe3:	|  |   48 8d 8d 78 ff ff ff 	lea    -0x88(%rbp),%rcx
+    1fea:	|  |   48 89 ce             	mov    %rcx,%rsi
+    1fed:	|  |   48 89 c7             	mov    %rax,%rdi
+    1ff0:	|  |   e8 d1 2f 00 00       	call   4fc6 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>
+    1ff5:	|  |   48 8d 45 90          	lea    -0x70(%rbp),%rax
+    1ff9:	|  |   b9 d4 00 00 00       	mov    $0xd4,%ecx
+    1ffe:	|  |   48 8d 15 23 61 00 00 	lea    0x6123(%rip),%rdx        # 8128 <sizes+0xc8>
+    2005:	|  |   48 8d 35 58 62 00 00 	lea    0x6258(%rip),%rsi        # 8264 <queue_len+0x84>
+    200c:	|  |   48 89 c7             	mov    %rax,%rdi
+    200f:	|  |   e8 1a 23 00 00       	call   432e <nel::Context::Context(char const*, char const*, int)>
+    2014:	|  |   48 8d 55 90          	lea    -0x70(%rbp),%rdx
+    2018:	|  |   48 8d 45 84          	lea    -0x7c(%rbp),%rax
+    201c:	|  |   48 89 d6             	mov    %rdx,%rsi
+    201f:	|  |   48 89 c7             	mov    %rax,%rdi
+    2022:	|  |   e8 45 2c 00 00       	call   4c6c <nel::Result<void, int>::unwrap(nel::Context const&)>
+    2027:	|  |   48 8d 45 84          	lea    -0x7c(%rbp),%rax
+    202b:	|  |   48 89 c7             	mov    %rax,%rdi
+    202e:	|  |   e8 83 2b 00 00       	call   4bb6 <nel::Result<void, int>::~Result()>
+    for (nel::Index i = 0; i < max_len; ++i) {
+    2033:	|  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    2038:	|  \-> 48 81 7d e8 ff ff ff 	cmpq   $0xffffff,-0x18(%rbp)
+    203f:	|      00 
+    2040:	\----- 0f 86 66 ff ff ff    	jbe    1fac <main+0x35>
+    }
+
+    for (nel::Length const bytes: sizes) {
+    2046:	       48 8d 05 13 60 00 00 	lea    0x6013(%rip),%rax        # 8060 <sizes>
+    204d:	       48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    2051:	       48 8d 05 08 60 00 00 	lea    0x6008(%rip),%rax        # 8060 <sizes>
+    2058:	       48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    205c:	       48 8d 05 1d 60 00 00 	lea    0x601d(%rip),%rax        # 8080 <sizes+0x20>
+    2063:	       48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    2067:	   /-- e9 dc 00 00 00       	jmp    2148 <main+0x1d1>
+    206c:	/--|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2070:	|  |   48 8b 00             	mov    (%rax),%rax
+    2073:	|  |   48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        auto s = v.slice(0, bytes / sizeof(int));
+    2077:	|  |   48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    207b:	|  |   48 c1 e8 02          	shr    $0x2,%rax
+    207f:	|  |   48 89 c2             	mov    %rax,%rdx
+    2082:	|  |   48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+    2089:	|  |   48 8d b5 78 ff ff ff 	lea    -0x88(%rbp),%rsi
+    2090:	|  |   48 89 d1             	mov    %rdx,%rcx
+    2093:	|  |   ba 00 00 00 00       	mov    $0x0,%edx
+    2098:	|  |   48 89 c7             	mov    %rax,%rdi
+    209b:	|  |   e8 b0 2f 00 00       	call   5050 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice(unsigned long, unsigned long)>
+        nel::log << "working set " << bytes / 1024 << "KiB, " << s.len() << " ints\n";
+    20a0:	|  |   48 8d 05 c2 61 00 00 	lea    0x61c2(%rip),%rax        # 8269 <queue_len+0x89>
+    20a7:	|  |   48 89 c6             	mov    %rax,%rsi
+    20aa:	|  |   48 8d 05 27 f0 00 00 	lea    0xf027(%rip),%rax        # 110d8 <nel::log>
+    20b1:	|  |   48 89 c7             	mov    %rax,%rdi
+    20b4:	|  |   e8 6e 50 00 00       	call   7127 <nel::operator<<(nel::Log&, char const*)>
+    20b9:	|  |   48 89 c2             	mov    %rax,%rdx
+    20bc:	|  |   48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    20c0:	|  |   48 c1 e8 0a          	shr    $0xa,%rax
+    20c4:	|  |   48 89 c6             	mov    %rax,%rsi
+    20c7:	|  |   48 89 d7             	mov    %rdx,%rdi
+    20ca:	|  |   e8 63 51 00 00       	call   7232 <nel::operator<<(nel::Log&, unsigned long)>
+    20cf:	|  |   48 89 c2             	mov    %rax,%rdx
+    20d2:	|  |   48 8d 05 9d 61 00 00 	lea    0x619d(%rip),%rax        # 8276 <queue_len+0x96>
+    20d9:	|  |   48 89 c6             	mov    %rax,%rsi
+    20dc:	|  |   48 89 d7             	mov    %rdx,%rdi
+    20df:	|  |   e8 43 50 00 00       	call   7127 <nel::operator<<(nel::Log&, char const*)>
+    20e4:	|  |   48 89 c3             	mov    %rax,%rbx
+    20e7:	|  |   48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+    20ee:	|  |   48 89 c7             	mov    %rax,%rdi
+    20f1:	|  |   e8 92 23 00 00       	call   4488 <nel::Slice<int>::len() const>
+    20f6:	|  |   48 89 c6             	mov    %rax,%rsi
+    20f9:	|  |   48 89 df             	mov    %rbx,%rdi
+    20fc:	|  |   e8 31 51 00 00       	call   7232 <nel::operator<<(nel::Log&, unsigned long)>
+    2101:	|  |   48 89 c2             	mov    %rax,%rdx
+    2104:	|  |   48 8d 05 71 61 00 00 	lea    0x6171(%rip),%rax        # 827c <queue_len+0x9c>
+    210b:	|  |   48 89 c6             	mov    %rax,%rsi
+    210e:	|  |   48 89 d7             	mov    %rdx,%rdi
+    2111:	|  |   e8 11 50 00 00       	call   7127 <nel::operator<<(nel::Log&, char const*)>
+        bench_for_each(s);
+    2116:	|  |   48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+    211d:	|  |   48 89 c7             	mov    %rax,%rdi
+    2120:	|  |   e8 cf f2 ff ff       	call   13f4 <bench_for_each(nel::Slice<int> const&)>
+        bench_map_first_n_fold(s);
+    2125:	|  |   48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+    212c:	|  |   48 89 c7             	mov    %rax,%rdi
+    212f:	|  |   e8 11 f5 ff ff       	call   1645 <bench_map_first_n_fold(nel::Slice<int> const&)>
+        bench_chain(s);
+    2134:	|  |   48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+    213b:	|  |   48 89 c7             	mov    %rax,%rdi
+    213e:	|  |   e8 4f fa ff ff       	call   1b92 <bench_chain(nel::Slice<int> const&)>
+    for (nel::Length const bytes: sizes) {
+    2143:	|  |   48 83 45 e0 08       	addq   $0x8,-0x20(%rbp)
+    2148:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    214c:	|      48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+    2150:	\----- 0f 85 16 ff ff ff    	jne    206c <main+0xf5>
+    }
+    nel::log << "queue " << queue_len << " ints, wrapped\n";
+    2156:	       48 8d 05 26 61 00 00 	lea    0x6126(%rip),%rax        # 8283 <queue_len+0xa3>
+    215d:	       48 89 c6             	mov    %rax,%rsi
+    2160:	       48 8d 05 71 ef 00 00 	lea    0xef71(%rip),%rax        # 110d8 <nel::log>
+    2167:	       48 89 c7             	mov    %rax,%rdi
+    216a:	       e8 b8 4f 00 00       	call   7127 <nel::operator<<(nel::Log&, char const*)>
+    216f:	       be 00 10 00 00       	mov    $0x1000,%esi
+    2174:	       48 89 c7             	mov    %rax,%rdi
+    2177:	       e8 b6 50 00 00       	call   7232 <nel::operator<<(nel::Log&, unsigned long)>
+    217c:	       48 89 c2             	mov    %rax,%rdx
+    217f:	       48 8d 05 04 61 00 00 	lea    0x6104(%rip),%rax        # 828a <queue_len+0xaa>
+    2186:	       48 89 c6             	mov    %rax,%rsi
+    2189:	       48 89 d7             	mov    %rdx,%rdi
+    218c:	       e8 96 4f 00 00       	call   7127 <nel::operator<<(nel::Log&, char const*)>
+    bench_queue(v.slice());
+    2191:	       48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    2195:	       48 8d 95 78 ff ff ff 	lea    -0x88(%rbp),%rdx
+    219c:	       48 89 d6             	mov    %rdx,%rsi
+    219f:	       48 89 c7             	mov    %rax,%rdi
+    21a2:	       e8 f3 2e 00 00       	call   509a <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()>
+    21a7:	       48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    21ab:	       48 89 c7             	mov    %rax,%rdi
+    21ae:	       e8 98 fc ff ff       	call   1e4b <bench_queue(nel::Slice<int> const&)>
+    nel::log << "sink: " << (long unsigned int)sink << '\n';
+    21b3:	       48 8d 05 e0 60 00 00 	lea    0x60e0(%rip),%rax        # 829a <queue_len+0xba>
+    21ba:	       48 89 c6             	mov    %rax,%rsi
+    21bd:	       48 8d 05 14 ef 00 00 	lea    0xef14(%rip),%rax        # 110d8 <nel::log>
+    21c4:	       48 89 c7             	mov    %rax,%rdi
+    21c7:	       e8 5b 4f 00 00       	call   7127 <nel::operator<<(nel::Log&, char const*)>
+    21cc:	       48 89 c2             	mov    %rax,%rdx
+    21cf:	       48 8b 05 ca ae 00 00 	mov    0xaeca(%rip),%rax        # d0a0 <sink>
+    21d6:	       48 89 c6             	mov    %rax,%rsi
+    21d9:	       48 89 d7             	mov    %rdx,%rdi
+    21dc:	       e8 51 50 00 00       	call   7232 <nel::operator<<(nel::Log&, unsigned long)>
+    21e1:	       be 0a 00 00 00       	mov    $0xa,%esi
+    21e6:	       48 89 c7             	mov    %rax,%rdi
+    21e9:	       e8 0d 4f 00 00       	call   70fb <nel::operator<<(nel::Log&, char)>
+}
+    21ee:	       48 8d 85 78 ff ff ff 	lea    -0x88(%rbp),%rax
+    21f5:	       48 89 c7             	mov    %rax,%rdi
+    21f8:	       e8 ab 2d 00 00       	call   4fa8 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    21fd:	       b8 00 00 00 00       	mov    $0x0,%eax
+    2202:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2206:	       c9                   	leave
+    2207:	       c3                   	ret
+
+0000000000002208 <run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2208:	       55                   	push   %rbp
+    2209:	       48 89 e5             	mov    %rsp,%rbp
+    220c:	       48 83 ec 20          	sub    $0x20,%rsp
+    2210:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2214:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    221b:	       00 
+    221c:	   /-- eb 3a                	jmp    2258 <run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}::operator()() const+0x50>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    221e:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2222:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    2226:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    222a:	|  |   48 8b 52 08          	mov    0x8(%rdx),%rdx
+            r += f(s);
+    222e:	|  |   48 89 d6             	mov    %rdx,%rsi
+    2231:	|  |   48 89 c7             	mov    %rax,%rdi
+    2234:	|  |   e8 53 f0 ff ff       	call   128c <bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const>
+    2239:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    223c:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2240:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    2243:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2246:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    224a:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    224d:	|  |   48 01 ca             	add    %rcx,%rdx
+    2250:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2253:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2258:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    225c:	|      48 8b 40 18          	mov    0x18(%rax),%rax
+        for (nel::Index i = 0; i < reps; ++i) {
+    2260:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2264:	\----- 72 b8                	jb     221e <run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2266:	       90                   	nop
+    2267:	       90                   	nop
+    2268:	       c9                   	leave
+    2269:	       c3                   	ret
+
+000000000000226a <void run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)>:
+void run(char const *const name, nel::Slice<int> const &s, F &&f)
+    226a:	55                   	push   %rbp
+    226b:	48 89 e5             	mov    %rsp,%rbp
+    226e:	48 83 ec 60          	sub    $0x60,%rsp
+    2272:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    2276:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    227a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    nel::Count const reps = n_total / s.len();
+    227e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2282:	48 89 c7             	mov    %rax,%rdi
+    2285:	e8 fe 21 00 00       	call   4488 <nel::Slice<int>::len() const>
+    228a:	48 89 c1             	mov    %rax,%rcx
+    228d:	b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    2292:	ba 00 00 00 00       	mov    $0x0,%edx
+    2297:	48 f7 f1             	div    %rcx
+    229a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    Acc r = 0;
+    229e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+    22a5:	00 
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    22a6:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    22aa:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    22ae:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    22b2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    22b6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    22ba:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    22be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22c2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    22c6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    22ca:	48 89 c7             	mov    %rax,%rdi
+    22cd:	e8 6b 13 00 00       	call   363d <unsigned long bench::time_ns<run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}>(bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)>
+    22d2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    sink = sink + r;
+    22d6:	48 8b 15 c3 ad 00 00 	mov    0xadc3(%rip),%rdx        # d0a0 <sink>
+    22dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    22e1:	48 01 d0             	add    %rdx,%rax
+    22e4:	48 89 05 b5 ad 00 00 	mov    %rax,0xadb5(%rip)        # d0a0 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    22eb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    22ef:	48 89 c7             	mov    %rax,%rdi
+    22f2:	e8 91 21 00 00       	call   4488 <nel::Slice<int>::len() const>
+    22f7:	48 0f af 45 f8       	imul   -0x8(%rbp),%rax
+    22fc:	48 89 c2             	mov    %rax,%rdx
+    22ff:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2303:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2307:	48 89 ce             	mov    %rcx,%rsi
+    230a:	48 89 c7             	mov    %rax,%rdi
+    230d:	e8 cd 1e 00 00       	call   41df <bench::report_per_item(char const*, unsigned long, unsigned long)>
+}
+    2312:	90                   	nop
+    2313:	c9                   	leave
+    2314:	c3                   	ret
+    2315:	90                   	nop
+
+0000000000002316 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)>:
+         * @param fn func to apply to each item in iterator
+         */
+        // void for_each(std::function<void(OutT)> fn)
+#    if defined(C_LIKE) || defined(RUST_LIKE)
+        template<typename F>
+        void for_each(F &&fn)
+    2316:	          55                   	push   %rbp
+    2317:	          48 89 e5             	mov    %rsp,%rbp
+    231a:	          53                   	push   %rbx
+    231b:	          48 83 ec 48          	sub    $0x48,%rsp
+    231f:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    2323:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+#    endif
+#    if defined(RUST_LIKE)
+        {
+            while (true) {
+                Optional<OutT> r = self().next();
+    2327:	/-------> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    232b:	|         48 89 c7             	mov    %rax,%rdi
+    232e:	|         e8 87 2e 00 00       	call   51ba <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    2333:	|         48 89 c2             	mov    %rax,%rdx
+    2336:	|         48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    233a:	|         48 89 d6             	mov    %rdx,%rsi
+    233d:	|         48 89 c7             	mov    %rax,%rdi
+    2340:	|         e8 8b 2e 00 00       	call   51d0 <nel::SliceIterator<int>::next()>
+                if (r.is_none()) { break; }
+    2345:	|         48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2349:	|         48 89 c7             	mov    %rax,%rdi
+    234c:	|         e8 4d 23 00 00       	call   469e <nel::Optional<int&>::is_none() const>
+    2351:	|         84 c0                	test   %al,%al
+    2353:	|     /-- 74 07                	je     235c <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)+0x46>
+    2355:	|     |   bb 00 00 00 00       	mov    $0x0,%ebx
+    235a:	|  /--|-- eb 49                	jmp    23a5 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)+0x8f>
+                // TODO: already checked r for none, but unwrap will do so again.. can this be
+                // avoided?
+                fn(r.unwrap());
+    235c:	|  |  \-> 48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    2360:	|  |      b9 ef 00 00 00       	mov    $0xef,%ecx
+    2365:	|  |      48 8d 15 94 5f 00 00 	lea    0x5f94(%rip),%rdx        # 8300 <queue_len+0x120>
+    236c:	|  |      48 8d 35 a5 5f 00 00 	lea    0x5fa5(%rip),%rsi        # 8318 <queue_len+0x138>
+    2373:	|  |      48 89 c7             	mov    %rax,%rdi
+    2376:	|  |      e8 b3 1f 00 00       	call   432e <nel::Context::Context(char const*, char const*, int)>
+    237b:	|  |      48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    237f:	|  |      48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2383:	|  |      48 89 d6             	mov    %rdx,%rsi
+    2386:	|  |      48 89 c7             	mov    %rax,%rdi
+    2389:	|  |      e8 1a 26 00 00       	call   49a8 <nel::Optional<int&>::unwrap(nel::Context const&)>
+    238e:	|  |      48 89 c2             	mov    %rax,%rdx
+    2391:	|  |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2395:	|  |      48 89 d6             	mov    %rdx,%rsi
+    2398:	|  |      48 89 c7             	mov    %rax,%rdi
+    239b:	|  |      e8 5c ef ff ff       	call   12fc <bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}::operator()(int const&) const>
+            while (true) {
+    23a0:	|  |      bb 01 00 00 00       	mov    $0x1,%ebx
+    23a5:	|  \----> 48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    23a9:	|         48 89 c7             	mov    %rax,%rdi
+    23ac:	|         e8 5b 25 00 00       	call   490c <nel::Optional<int&>::~Optional()>
+    23b1:	|         83 fb 01             	cmp    $0x1,%ebx
+    23b4:	|     /-- 75 05                	jne    23bb <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)+0xa5>
+    23b6:	\-----|-- e9 6c ff ff ff       	jmp    2327 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)+0x11>
+            }
+        }
+    23bb:	      \-> 90                   	nop
+    23bc:	          48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    23c0:	          c9                   	leave
+    23c1:	          c3                   	ret
+
+00000000000023c2 <run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    23c2:	       55                   	push   %rbp
+    23c3:	       48 89 e5             	mov    %rsp,%rbp
+    23c6:	       48 83 ec 20          	sub    $0x20,%rsp
+    23ca:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    23ce:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    23d5:	       00 
+    23d6:	   /-- eb 3a                	jmp    2412 <run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)::{lambda()#1}::operator()() const+0x50>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    23d8:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    23dc:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    23e0:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    23e4:	|  |   48 8b 52 08          	mov    0x8(%rdx),%rdx
+            r += f(s);
+    23e8:	|  |   48 89 d6             	mov    %rdx,%rsi
+    23eb:	|  |   48 89 c7             	mov    %rax,%rdi
+    23ee:	|  |   e8 39 ef ff ff       	call   132c <bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const>
+    23f3:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    23f6:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    23fa:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    23fd:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2400:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2404:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    2407:	|  |   48 01 ca             	add    %rcx,%rdx
+    240a:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index i = 0; i < reps; ++i) {
+    240d:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2412:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2416:	|      48 8b 40 18          	mov    0x18(%rax),%rax
+        for (nel::Index i = 0; i < reps; ++i) {
+    241a:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    241e:	\----- 72 b8                	jb     23d8 <run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2420:	       90                   	nop
+    2421:	       90                   	nop
+    2422:	       c9                   	leave
+    2423:	       c3                   	ret
+
+0000000000002424 <void run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)>:
+void run(char const *const name, nel::Slice<int> const &s, F &&f)
+    2424:	55                   	push   %rbp
+    2425:	48 89 e5             	mov    %rsp,%rbp
+    2428:	48 83 ec 60          	sub    $0x60,%rsp
+    242c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    2430:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    2434:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    nel::Count const reps = n_total / s.len();
+    2438:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    243c:	48 89 c7             	mov    %rax,%rdi
+    243f:	e8 44 20 00 00       	call   4488 <nel::Slice<int>::len() const>
+    2444:	48 89 c1             	mov    %rax,%rcx
+    2447:	b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    244c:	ba 00 00 00 00       	mov    $0x0,%edx
+    2451:	48 f7 f1             	div    %rcx
+    2454:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    Acc r = 0;
+    2458:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+    245f:	00 
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2460:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    2464:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    2468:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    246c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    2470:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2474:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2478:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    247c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    2480:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    2484:	48 89 c7             	mov    %rax,%rdi
+    2487:	e8 dd 11 00 00       	call   3669 <unsigned long bench::time_ns<run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)::{lambda()#1}>(bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)>
+    248c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    sink = sink + r;
+    2490:	48 8b 15 09 ac 00 00 	mov    0xac09(%rip),%rdx        # d0a0 <sink>
+    2497:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    249b:	48 01 d0             	add    %rdx,%rax
+    249e:	48 89 05 fb ab 00 00 	mov    %rax,0xabfb(%rip)        # d0a0 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    24a5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    24a9:	48 89 c7             	mov    %rax,%rdi
+    24ac:	e8 d7 1f 00 00       	call   4488 <nel::Slice<int>::len() const>
+    24b1:	48 0f af 45 f8       	imul   -0x8(%rbp),%rax
+    24b6:	48 89 c2             	mov    %rax,%rdx
+    24b9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    24bd:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    24c1:	48 89 ce             	mov    %rcx,%rsi
+    24c4:	48 89 c7             	mov    %rax,%rdi
+    24c7:	e8 13 1d 00 00       	call   41df <bench::report_per_item(char const*, unsigned long, unsigned long)>
+}
+    24cc:	90                   	nop
+    24cd:	c9                   	leave
+    24ce:	c3                   	ret
+    24cf:	90                   	nop
+
+00000000000024d0 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each2<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)>:
+
+#    if defined(C_LIKE)
+#        if defined(RUST_LIKE)
+        // void for_each2(std::function<void(OutT)> fn)
+        template<typename F>
+        void for_each2(F &&fn)
+    24d0:	       55                   	push   %rbp
+    24d1:	       48 89 e5             	mov    %rsp,%rbp
+    24d4:	       48 83 ec 10          	sub    $0x10,%rsp
+    24d8:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    24dc:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#        endif
+        {
+#        if 1
+            for (; !self().is_done(); self().inc()) {
+    24e0:	   /-- eb 3a                	jmp    251c <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each2<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)+0x4c>
+                fn(self().deref());
+    24e2:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24e6:	|  |   48 89 c7             	mov    %rax,%rdi
+    24e9:	|  |   e8 cc 2c 00 00       	call   51ba <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    24ee:	|  |   48 89 c7             	mov    %rax,%rdi
+    24f1:	|  |   e8 76 2d 00 00       	call   526c <nel::SliceIterator<int>::deref()>
+    24f6:	|  |   48 89 c2             	mov    %rax,%rdx
+    24f9:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    24fd:	|  |   48 89 d6             	mov    %rdx,%rsi
+    2500:	|  |   48 89 c7             	mov    %rax,%rdi
+    2503:	|  |   e8 70 ee ff ff       	call   1378 <bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}::operator()(int const&) const>
+            for (; !self().is_done(); self().inc()) {
+    2508:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    250c:	|  |   48 89 c7             	mov    %rax,%rdi
+    250f:	|  |   e8 a6 2c 00 00       	call   51ba <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    2514:	|  |   48 89 c7             	mov    %rax,%rdi
+    2517:	|  |   e8 32 2d 00 00       	call   524e <nel::SliceIterator<int>::inc()>
+    251c:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2520:	|      48 89 c7             	mov    %rax,%rdi
+    2523:	|      e8 92 2c 00 00       	call   51ba <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    2528:	|      48 89 c7             	mov    %rax,%rdi
+    252b:	|      e8 e4 1f 00 00       	call   4514 <nel::SliceIterator<int>::is_done() const>
+    2530:	|      83 f0 01             	xor    $0x1,%eax
+    2533:	|      84 c0                	test   %al,%al
+    2535:	\----- 75 ab                	jne    24e2 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each2<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)+0x12>
+            fn(self().deref());
+            self().inc();
+enter:
+            if (!self().is_done()) { goto loop; }
+#        endif
+        }
+    2537:	       90                   	nop
+    2538:	       90                   	nop
+    2539:	       c9                   	leave
+    253a:	       c3                   	ret
+    253b:	       90                   	nop
+
+000000000000253c <run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    253c:	       55                   	push   %rbp
+    253d:	       48 89 e5             	mov    %rsp,%rbp
+    2540:	       48 83 ec 20          	sub    $0x20,%rsp
+    2544:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2548:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    254f:	       00 
+    2550:	   /-- eb 3a                	jmp    258c <run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)::{lambda()#1}::operator()() const+0x50>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2552:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2556:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    255a:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    255e:	|  |   48 8b 52 08          	mov    0x8(%rdx),%rdx
+            r += f(s);
+    2562:	|  |   48 89 d6             	mov    %rdx,%rsi
+    2565:	|  |   48 89 c7             	mov    %rax,%rdi
+    2568:	|  |   e8 3b ee ff ff       	call   13a8 <bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const>
+    256d:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2570:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2574:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    2577:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    257a:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    257e:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    2581:	|  |   48 01 ca             	add    %rcx,%rdx
+    2584:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2587:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    258c:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2590:	|      48 8b 40 18          	mov    0x18(%rax),%rax
+        for (nel::Index i = 0; i < reps; ++i) {
+    2594:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2598:	\----- 72 b8                	jb     2552 <run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    259a:	       90                   	nop
+    259b:	       90                   	nop
+    259c:	       c9                   	leave
+    259d:	       c3                   	ret
+
+000000000000259e <void run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)>:
+void run(char const *const name, nel::Slice<int> const &s, F &&f)
+    259e:	55                   	push   %rbp
+    259f:	48 89 e5             	mov    %rsp,%rbp
+    25a2:	48 83 ec 60          	sub    $0x60,%rsp
+    25a6:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    25aa:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    25ae:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    nel::Count const reps = n_total / s.len();
+    25b2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    25b6:	48 89 c7             	mov    %rax,%rdi
+    25b9:	e8 ca 1e 00 00       	call   4488 <nel::Slice<int>::len() const>
+    25be:	48 89 c1             	mov    %rax,%rcx
+    25c1:	b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    25c6:	ba 00 00 00 00       	mov    $0x0,%edx
+    25cb:	48 f7 f1             	div    %rcx
+    25ce:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    Acc r = 0;
+    25d2:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+    25d9:	00 
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    25da:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    25de:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    25e2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    25e6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    25ea:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    25ee:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    25f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25f6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    25fa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    25fe:	48 89 c7             	mov    %rax,%rdi
+    2601:	e8 8f 10 00 00       	call   3695 <unsigned long bench::time_ns<run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)::{lambda()#1}>(bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)>
+    2606:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    sink = sink + r;
+    260a:	48 8b 15 8f aa 00 00 	mov    0xaa8f(%rip),%rdx        # d0a0 <sink>
+    2611:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2615:	48 01 d0             	add    %rdx,%rax
+    2618:	48 89 05 81 aa 00 00 	mov    %rax,0xaa81(%rip)        # d0a0 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    261f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2623:	48 89 c7             	mov    %rax,%rdi
+    2626:	e8 5d 1e 00 00       	call   4488 <nel::Slice<int>::len() const>
+    262b:	48 0f af 45 f8       	imul   -0x8(%rbp),%rax
+    2630:	48 89 c2             	mov    %rax,%rdx
+    2633:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2637:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    263b:	48 89 ce             	mov    %rcx,%rsi
+    263e:	48 89 c7             	mov    %rax,%rdi
+    2641:	e8 99 1b 00 00       	call   41df <bench::report_per_item(char const*, unsigned long, unsigned long)>
+}
+    2646:	90                   	nop
+    2647:	c9                   	leave
+    2648:	c3                   	ret
+    2649:	90                   	nop
+
+000000000000264a <run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    264a:	       55                   	push   %rbp
+    264b:	       48 89 e5             	mov    %rsp,%rbp
+    264e:	       48 83 ec 20          	sub    $0x20,%rsp
+    2652:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2656:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    265d:	       00 
+    265e:	   /-- eb 3a                	jmp    269a <run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}::operator()() const+0x50>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2660:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2664:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    2668:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    266c:	|  |   48 8b 52 08          	mov    0x8(%rdx),%rdx
+            r += f(s);
+    2670:	|  |   48 89 d6             	mov    %rdx,%rsi
+    2673:	|  |   48 89 c7             	mov    %rax,%rdi
+    2676:	|  |   e8 d7 ed ff ff       	call   1452 <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const>
+    267b:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    267e:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2682:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    2685:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2688:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    268c:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    268f:	|  |   48 01 ca             	add    %rcx,%rdx
+    2692:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2695:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    269a:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    269e:	|      48 8b 40 18          	mov    0x18(%rax),%rax
+        for (nel::Index i = 0; i < reps; ++i) {
+    26a2:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    26a6:	\----- 72 b8                	jb     2660 <run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    26a8:	       90                   	nop
+    26a9:	       90                   	nop
+    26aa:	       c9                   	leave
+    26ab:	       c3                   	ret
+
+00000000000026ac <void run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)>:
+void run(char const *const name, nel::Slice<int> const &s, F &&f)
+    26ac:	55                   	push   %rbp
+    26ad:	48 89 e5             	mov    %rsp,%rbp
+    26b0:	48 83 ec 60          	sub    $0x60,%rsp
+    26b4:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    26b8:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    26bc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    nel::Count const reps = n_total / s.len();
+    26c0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    26c4:	48 89 c7             	mov    %rax,%rdi
+    26c7:	e8 bc 1d 00 00       	call   4488 <nel::Slice<int>::len() const>
+    26cc:	48 89 c1             	mov    %rax,%rcx
+    26cf:	b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    26d4:	ba 00 00 00 00       	mov    $0x0,%edx
+    26d9:	48 f7 f1             	div    %rcx
+    26dc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    Acc r = 0;
+    26e0:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+    26e7:	00 
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    26e8:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    26ec:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    26f0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    26f4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    26f8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    26fc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2700:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2704:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    2708:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    270c:	48 89 c7             	mov    %rax,%rdi
+    270f:	e8 ad 0f 00 00       	call   36c1 <unsigned long bench::time_ns<run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}>(bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)>
+    2714:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    sink = sink + r;
+    2718:	48 8b 15 81 a9 00 00 	mov    0xa981(%rip),%rdx        # d0a0 <sink>
+    271f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2723:	48 01 d0             	add    %rdx,%rax
+    2726:	48 89 05 73 a9 00 00 	mov    %rax,0xa973(%rip)        # d0a0 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    272d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2731:	48 89 c7             	mov    %rax,%rdi
+    2734:	e8 4f 1d 00 00       	call   4488 <nel::Slice<int>::len() const>
+    2739:	48 0f af 45 f8       	imul   -0x8(%rbp),%rax
+    273e:	48 89 c2             	mov    %rax,%rdx
+    2741:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2745:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2749:	48 89 ce             	mov    %rcx,%rsi
+    274c:	48 89 c7             	mov    %rax,%rdi
+    274f:	e8 8b 1a 00 00       	call   41df <bench::report_per_item(char const*, unsigned long, unsigned long)>
+}
+    2754:	90                   	nop
+    2755:	c9                   	leave
+    2756:	c3                   	ret
+    2757:	90                   	nop
+
+0000000000002758 <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> nel::Iterator<nel::SliceIterator<int>, int&, int&>::map<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)>:
+
+        // template<typename U>
+        // MappingIterator<ItT, U> map(std::function<U(OutT &)> fn)
+        // template<typename Fn, typename U>
+        template<typename U, typename Fn>
+        constexpr MappingIterator<ItT, U, Fn> map(Fn &&fn)
+    2758:	55                   	push   %rbp
+    2759:	48 89 e5             	mov    %rsp,%rbp
+    275c:	53                   	push   %rbx
+    275d:	48 83 ec 28          	sub    $0x28,%rsp
+    2761:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2765:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2769:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+        {
+            return MappingIterator<ItT, U, Fn>(move(self()), forward<Fn>(fn));
+    276d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2771:	48 89 c7             	mov    %rax,%rdi
+    2774:	e8 74 0f 00 00       	call   36ed <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&& nel::forward<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)>
+    2779:	48 89 c3             	mov    %rax,%rbx
+    277c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2780:	48 89 c7             	mov    %rax,%rdi
+    2783:	e8 32 2a 00 00       	call   51ba <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    2788:	48 89 c7             	mov    %rax,%rdi
+    278b:	e8 ed 2a 00 00       	call   527d <nel::SliceIterator<int>&& nel::move<nel::SliceIterator<int> >(nel::SliceIterator<int>&)>
+    2790:	48 89 c1             	mov    %rax,%rcx
+    2793:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2797:	48 89 da             	mov    %rbx,%rdx
+    279a:	48 89 ce             	mov    %rcx,%rsi
+    279d:	48 89 c7             	mov    %rax,%rdi
+    27a0:	e8 57 0f 00 00       	call   36fc <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::MappingIterator(nel::SliceIterator<int>&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)>
+        }
+    27a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    27ad:	c9                   	leave
+    27ae:	c3                   	ret
+    27af:	90                   	nop
+
+00000000000027b0 <nel::Iterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>, int&, unsigned long>::first_n(unsigned long)>:
+        constexpr FirstNIterator<ItT> first_n(Count const limit)
+    27b0:	55                   	push   %rbp
+    27b1:	48 89 e5             	mov    %rsp,%rbp
+    27b4:	48 83 ec 20          	sub    $0x20,%rsp
+    27b8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    27bc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    27c0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            return FirstNIterator<ItT>(move(self()), limit);
+    27c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    27c8:	48 89 c7             	mov    %rax,%rdi
+    27cb:	e8 70 0f 00 00       	call   3740 <nel::Iterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>, int&, unsigned long>::self()>
+    27d0:	48 89 c7             	mov    %rax,%rdi
+    27d3:	e8 7e 0f 00 00       	call   3756 <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&& nel::move<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >(nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&)>
+    27d8:	48 89 c1             	mov    %rax,%rcx
+    27db:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    27df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27e3:	48 89 ce             	mov    %rcx,%rsi
+    27e6:	48 89 c7             	mov    %rax,%rdi
+    27e9:	e8 9c 0f 00 00       	call   378a <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::FirstNIterator(nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&&, unsigned long)>
+        }
+    27ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27f2:	c9                   	leave
+    27f3:	c3                   	ret
+
+00000000000027f4 <nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}::operator()(unsigned long) const>:
+            self().for_each([&acc, &fn](OutT v) { fn(acc, v); });
+    27f4:	55                   	push   %rbp
+    27f5:	48 89 e5             	mov    %rsp,%rbp
+    27f8:	48 83 ec 10          	sub    $0x10,%rsp
+    27fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2800:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2804:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2808:	48 8b 40 08          	mov    0x8(%rax),%rax
+    280c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2810:	48 8b 0a             	mov    (%rdx),%rcx
+    2813:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    2817:	48 89 ce             	mov    %rcx,%rsi
+    281a:	48 89 c7             	mov    %rax,%rdi
+    281d:	e8 c0 ec ff ff       	call   14e2 <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}::operator()(unsigned long&, unsigned long const&) const>
+    2822:	90                   	nop
+    2823:	c9                   	leave
+    2824:	c3                   	ret
+    2825:	90                   	nop
+
+0000000000002826 <unsigned long nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)>:
+        U fold(U &&initial, F &&fn)
+    2826:	55                   	push   %rbp
+    2827:	48 89 e5             	mov    %rsp,%rbp
+    282a:	48 83 ec 40          	sub    $0x40,%rsp
+    282e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    2832:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    2836:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+            U acc = move(initial);
+    283a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    283e:	48 89 c7             	mov    %rax,%rdi
+    2841:	e8 45 2a 00 00       	call   528b <unsigned long&& nel::move<unsigned long>(unsigned long&)>
+    2846:	48 8b 00             	mov    (%rax),%rax
+    2849:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+            self().for_each([&acc, &fn](OutT v) { fn(acc, v); });
+    284d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2851:	48 89 c7             	mov    %rax,%rdi
+    2854:	e8 81 0f 00 00       	call   37da <nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::self()>
+    2859:	48 89 c2             	mov    %rax,%rdx
+    285c:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+    2860:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2864:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2868:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    286c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    2870:	48 89 c6             	mov    %rax,%rsi
+    2873:	48 89 d7             	mov    %rdx,%rdi
+    2876:	e8 cb 0f 00 00       	call   3846 <void nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)>
+            return acc;
+    287b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+        }
+    287f:	c9                   	leave
+    2880:	c3                   	ret
+    2881:	90                   	nop
+
+0000000000002882 <run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2882:	       55                   	push   %rbp
+    2883:	       48 89 e5             	mov    %rsp,%rbp
+    2886:	       48 83 ec 20          	sub    $0x20,%rsp
+    288a:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    288e:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    2895:	       00 
+    2896:	   /-- eb 3a                	jmp    28d2 <run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)::{lambda()#1}::operator()() const+0x50>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2898:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    289c:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    28a0:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    28a4:	|  |   48 8b 52 08          	mov    0x8(%rdx),%rdx
+            r += f(s);
+    28a8:	|  |   48 89 d6             	mov    %rdx,%rsi
+    28ab:	|  |   48 89 c7             	mov    %rax,%rdi
+    28ae:	|  |   e8 5b ec ff ff       	call   150e <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const>
+    28b3:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    28b6:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28ba:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    28bd:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    28c0:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28c4:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    28c7:	|  |   48 01 ca             	add    %rcx,%rdx
+    28ca:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index i = 0; i < reps; ++i) {
+    28cd:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    28d2:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28d6:	|      48 8b 40 18          	mov    0x18(%rax),%rax
+        for (nel::Index i = 0; i < reps; ++i) {
+    28da:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    28de:	\----- 72 b8                	jb     2898 <run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    28e0:	       90                   	nop
+    28e1:	       90                   	nop
+    28e2:	       c9                   	leave
+    28e3:	       c3                   	ret
+
+00000000000028e4 <void run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)>:
+void run(char const *const name, nel::Slice<int> const &s, F &&f)
+    28e4:	55                   	push   %rbp
+    28e5:	48 89 e5             	mov    %rsp,%rbp
+    28e8:	48 83 ec 60          	sub    $0x60,%rsp
+    28ec:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    28f0:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    28f4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    nel::Count const reps = n_total / s.len();
+    28f8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    28fc:	48 89 c7             	mov    %rax,%rdi
+    28ff:	e8 84 1b 00 00       	call   4488 <nel::Slice<int>::len() const>
+    2904:	48 89 c1             	mov    %rax,%rcx
+    2907:	b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    290c:	ba 00 00 00 00       	mov    $0x0,%edx
+    2911:	48 f7 f1             	div    %rcx
+    2914:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    Acc r = 0;
+    2918:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+    291f:	00 
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2920:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    2924:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    2928:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    292c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    2930:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2934:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2938:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    293c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    2940:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    2944:	48 89 c7             	mov    %rax,%rdi
+    2947:	e8 4f 0f 00 00       	call   389b <unsigned long bench::time_ns<run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)::{lambda()#1}>(bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)>
+    294c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    sink = sink + r;
+    2950:	48 8b 15 49 a7 00 00 	mov    0xa749(%rip),%rdx        # d0a0 <sink>
+    2957:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    295b:	48 01 d0             	add    %rdx,%rax
+    295e:	48 89 05 3b a7 00 00 	mov    %rax,0xa73b(%rip)        # d0a0 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    2965:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2969:	48 89 c7             	mov    %rax,%rdi
+    296c:	e8 17 1b 00 00       	call   4488 <nel::Slice<int>::len() const>
+    2971:	48 0f af 45 f8       	imul   -0x8(%rbp),%rax
+    2976:	48 89 c2             	mov    %rax,%rdx
+    2979:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    297d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2981:	48 89 ce             	mov    %rcx,%rsi
+    2984:	48 89 c7             	mov    %rax,%rdi
+    2987:	e8 53 18 00 00       	call   41df <bench::report_per_item(char const*, unsigned long, unsigned long)>
+}
+    298c:	90                   	nop
+    298d:	c9                   	leave
+    298e:	c3                   	ret
+    298f:	90                   	nop
+
+0000000000002990 <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> nel::Iterator<nel::SliceIterator<int>, int&, int&>::map<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)>:
+        constexpr MappingIterator<ItT, U, Fn> map(Fn &&fn)
+    2990:	55                   	push   %rbp
+    2991:	48 89 e5             	mov    %rsp,%rbp
+    2994:	53                   	push   %rbx
+    2995:	48 83 ec 28          	sub    $0x28,%rsp
+    2999:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    299d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    29a1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            return MappingIterator<ItT, U, Fn>(move(self()), forward<Fn>(fn));
+    29a5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    29a9:	48 89 c7             	mov    %rax,%rdi
+    29ac:	e8 16 0f 00 00       	call   38c7 <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&& nel::forward<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)>
+    29b1:	48 89 c3             	mov    %rax,%rbx
+    29b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29b8:	48 89 c7             	mov    %rax,%rdi
+    29bb:	e8 fa 27 00 00       	call   51ba <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    29c0:	48 89 c7             	mov    %rax,%rdi
+    29c3:	e8 b5 28 00 00       	call   527d <nel::SliceIterator<int>&& nel::move<nel::SliceIterator<int> >(nel::SliceIterator<int>&)>
+    29c8:	48 89 c1             	mov    %rax,%rcx
+    29cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    29cf:	48 89 da             	mov    %rbx,%rdx
+    29d2:	48 89 ce             	mov    %rcx,%rsi
+    29d5:	48 89 c7             	mov    %rax,%rdi
+    29d8:	e8 f9 0e 00 00       	call   38d6 <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::MappingIterator(nel::SliceIterator<int>&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)>
+        }
+    29dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    29e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    29e5:	c9                   	leave
+    29e6:	c3                   	ret
+    29e7:	90                   	nop
+
+00000000000029e8 <nel::Iterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>, int&, unsigned long>::first_n(unsigned long)>:
+        constexpr FirstNIterator<ItT> first_n(Count const limit)
+    29e8:	55                   	push   %rbp
+    29e9:	48 89 e5             	mov    %rsp,%rbp
+    29ec:	48 83 ec 20          	sub    $0x20,%rsp
+    29f0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    29f4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    29f8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            return FirstNIterator<ItT>(move(self()), limit);
+    29fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a00:	48 89 c7             	mov    %rax,%rdi
+    2a03:	e8 12 0f 00 00       	call   391a <nel::Iterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>, int&, unsigned long>::self()>
+    2a08:	48 89 c7             	mov    %rax,%rdi
+    2a0b:	e8 20 0f 00 00       	call   3930 <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&& nel::move<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >(nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&)>
+    2a10:	48 89 c1             	mov    %rax,%rcx
+    2a13:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2a17:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a1b:	48 89 ce             	mov    %rcx,%rsi
+    2a1e:	48 89 c7             	mov    %rax,%rdi
+    2a21:	e8 3e 0f 00 00       	call   3964 <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::FirstNIterator(nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&&, unsigned long)>
+        }
+    2a26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a2a:	c9                   	leave
+    2a2b:	c3                   	ret
+
+0000000000002a2c <nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold2<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}::operator()(unsigned long) const>:
+            self().for_each2([&acc, &fn](OutT v) { fn(acc, v); });
+    2a2c:	55                   	push   %rbp
+    2a2d:	48 89 e5             	mov    %rsp,%rbp
+    2a30:	48 83 ec 10          	sub    $0x10,%rsp
+    2a34:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2a38:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2a3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a40:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2a44:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2a48:	48 8b 0a             	mov    (%rdx),%rcx
+    2a4b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    2a4f:	48 89 ce             	mov    %rcx,%rsi
+    2a52:	48 89 c7             	mov    %rax,%rdi
+    2a55:	e8 4a eb ff ff       	call   15a4 <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}::operator()(unsigned long&, unsigned long const&) const>
+    2a5a:	90                   	nop
+    2a5b:	c9                   	leave
+    2a5c:	c3                   	ret
+    2a5d:	90                   	nop
+
+0000000000002a5e <unsigned long nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold2<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)>:
+        U fold2(U &&initial, F &&fn)
+    2a5e:	55                   	push   %rbp
+    2a5f:	48 89 e5             	mov    %rsp,%rbp
+    2a62:	48 83 ec 40          	sub    $0x40,%rsp
+    2a66:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    2a6a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    2a6e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+            U acc = move(initial);
+    2a72:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2a76:	48 89 c7             	mov    %rax,%rdi
+    2a79:	e8 0d 28 00 00       	call   528b <unsigned long&& nel::move<unsigned long>(unsigned long&)>
+    2a7e:	48 8b 00             	mov    (%rax),%rax
+    2a81:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+            self().for_each2([&acc, &fn](OutT v) { fn(acc, v); });
+    2a85:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2a89:	48 89 c7             	mov    %rax,%rdi
+    2a8c:	e8 23 0f 00 00       	call   39b4 <nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::self()>
+    2a91:	48 89 c2             	mov    %rax,%rdx
+    2a94:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+    2a98:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2a9c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2aa0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2aa4:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    2aa8:	48 89 c6             	mov    %rax,%rsi
+    2aab:	48 89 d7             	mov    %rdx,%rdi
+    2aae:	e8 17 0f 00 00       	call   39ca <void nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::for_each2<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold2<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)>
+            return acc;
+    2ab3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+        }
+    2ab7:	c9                   	leave
+    2ab8:	c3                   	ret
+    2ab9:	90                   	nop
+
+0000000000002aba <run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2aba:	       55                   	push   %rbp
+    2abb:	       48 89 e5             	mov    %rsp,%rbp
+    2abe:	       48 83 ec 20          	sub    $0x20,%rsp
+    2ac2:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2ac6:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    2acd:	       00 
+    2ace:	   /-- eb 3a                	jmp    2b0a <run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)::{lambda()#1}::operator()() const+0x50>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2ad0:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ad4:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    2ad8:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2adc:	|  |   48 8b 52 08          	mov    0x8(%rdx),%rdx
+            r += f(s);
+    2ae0:	|  |   48 89 d6             	mov    %rdx,%rsi
+    2ae3:	|  |   48 89 c7             	mov    %rax,%rdi
+    2ae6:	|  |   e8 e5 ea ff ff       	call   15d0 <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const>
+    2aeb:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2aee:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2af2:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    2af5:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2af8:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2afc:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    2aff:	|  |   48 01 ca             	add    %rcx,%rdx
+    2b02:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2b05:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2b0a:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b0e:	|      48 8b 40 18          	mov    0x18(%rax),%rax
+        for (nel::Index i = 0; i < reps; ++i) {
+    2b12:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2b16:	\----- 72 b8                	jb     2ad0 <run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2b18:	       90                   	nop
+    2b19:	       90                   	nop
+    2b1a:	       c9                   	leave
+    2b1b:	       c3                   	ret
+
+0000000000002b1c <void run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)>:
+void run(char const *const name, nel::Slice<int> const &s, F &&f)
+    2b1c:	55                   	push   %rbp
+    2b1d:	48 89 e5             	mov    %rsp,%rbp
+    2b20:	48 83 ec 60          	sub    $0x60,%rsp
+    2b24:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    2b28:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    2b2c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    nel::Count const reps = n_total / s.len();
+    2b30:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2b34:	48 89 c7             	mov    %rax,%rdi
+    2b37:	e8 4c 19 00 00       	call   4488 <nel::Slice<int>::len() const>
+    2b3c:	48 89 c1             	mov    %rax,%rcx
+    2b3f:	b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    2b44:	ba 00 00 00 00       	mov    $0x0,%edx
+    2b49:	48 f7 f1             	div    %rcx
+    2b4c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    Acc r = 0;
+    2b50:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+    2b57:	00 
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2b58:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    2b5c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    2b60:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2b64:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    2b68:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2b6c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2b70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b74:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    2b78:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    2b7c:	48 89 c7             	mov    %rax,%rdi
+    2b7f:	e8 b1 0e 00 00       	call   3a35 <unsigned long bench::time_ns<run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)::{lambda()#1}>(bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)>
+    2b84:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    sink = sink + r;
+    2b88:	48 8b 15 11 a5 00 00 	mov    0xa511(%rip),%rdx        # d0a0 <sink>
+    2b8f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2b93:	48 01 d0             	add    %rdx,%rax
+    2b96:	48 89 05 03 a5 00 00 	mov    %rax,0xa503(%rip)        # d0a0 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    2b9d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2ba1:	48 89 c7             	mov    %rax,%rdi
+    2ba4:	e8 df 18 00 00       	call   4488 <nel::Slice<int>::len() const>
+    2ba9:	48 0f af 45 f8       	imul   -0x8(%rbp),%rax
+    2bae:	48 89 c2             	mov    %rax,%rdx
+    2bb1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2bb5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2bb9:	48 89 ce             	mov    %rcx,%rsi
+    2bbc:	48 89 c7             	mov    %rax,%rdi
+    2bbf:	e8 1b 16 00 00       	call   41df <bench::report_per_item(char const*, unsigned long, unsigned long)>
+}
+    2bc4:	90                   	nop
+    2bc5:	c9                   	leave
+    2bc6:	c3                   	ret
+    2bc7:	90                   	nop
+
+0000000000002bc8 <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2bc8:	       55                   	push   %rbp
+    2bc9:	       48 89 e5             	mov    %rsp,%rbp
+    2bcc:	       48 83 ec 20          	sub    $0x20,%rsp
+    2bd0:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2bd4:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    2bdb:	       00 
+    2bdc:	   /-- eb 3a                	jmp    2c18 <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}::operator()() const+0x50>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2bde:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2be2:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    2be6:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2bea:	|  |   48 8b 52 08          	mov    0x8(%rdx),%rdx
+            r += f(s);
+    2bee:	|  |   48 89 d6             	mov    %rdx,%rsi
+    2bf1:	|  |   48 89 c7             	mov    %rax,%rdi
+    2bf4:	|  |   e8 d5 ea ff ff       	call   16ce <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const>
+    2bf9:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2bfc:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c00:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    2c03:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2c06:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c0a:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    2c0d:	|  |   48 01 ca             	add    %rcx,%rdx
+    2c10:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2c13:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2c18:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c1c:	|      48 8b 40 18          	mov    0x18(%rax),%rax
+        for (nel::Index i = 0; i < reps; ++i) {
+    2c20:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2c24:	\----- 72 b8                	jb     2bde <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2c26:	       90                   	nop
+    2c27:	       90                   	nop
+    2c28:	       c9                   	leave
+    2c29:	       c3                   	ret
+
+0000000000002c2a <void run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)>:
+void run(char const *const name, nel::Slice<int> const &s, F &&f)
+    2c2a:	55                   	push   %rbp
+    2c2b:	48 89 e5             	mov    %rsp,%rbp
+    2c2e:	48 83 ec 60          	sub    $0x60,%rsp
+    2c32:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    2c36:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    2c3a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    nel::Count const reps = n_total / s.len();
+    2c3e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2c42:	48 89 c7             	mov    %rax,%rdi
+    2c45:	e8 3e 18 00 00       	call   4488 <nel::Slice<int>::len() const>
+    2c4a:	48 89 c1             	mov    %rax,%rcx
+    2c4d:	b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    2c52:	ba 00 00 00 00       	mov    $0x0,%edx
+    2c57:	48 f7 f1             	div    %rcx
+    2c5a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    Acc r = 0;
+    2c5e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+    2c65:	00 
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2c66:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    2c6a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    2c6e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2c72:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    2c76:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2c7a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2c7e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c82:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    2c86:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    2c8a:	48 89 c7             	mov    %rax,%rdi
+    2c8d:	e8 cf 0d 00 00       	call   3a61 <unsigned long bench::time_ns<run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)>
+    2c92:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    sink = sink + r;
+    2c96:	48 8b 15 03 a4 00 00 	mov    0xa403(%rip),%rdx        # d0a0 <sink>
+    2c9d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2ca1:	48 01 d0             	add    %rdx,%rax
+    2ca4:	48 89 05 f5 a3 00 00 	mov    %rax,0xa3f5(%rip)        # d0a0 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    2cab:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2caf:	48 89 c7             	mov    %rax,%rdi
+    2cb2:	e8 d1 17 00 00       	call   4488 <nel::Slice<int>::len() const>
+    2cb7:	48 0f af 45 f8       	imul   -0x8(%rbp),%rax
+    2cbc:	48 89 c2             	mov    %rax,%rdx
+    2cbf:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2cc3:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2cc7:	48 89 ce             	mov    %rcx,%rsi
+    2cca:	48 89 c7             	mov    %rax,%rdi
+    2ccd:	e8 0d 15 00 00       	call   41df <bench::report_per_item(char const*, unsigned long, unsigned long)>
+}
+    2cd2:	90                   	nop
+    2cd3:	c9                   	leave
+    2cd4:	c3                   	ret
+    2cd5:	90                   	nop
+
+0000000000002cd6 <void nel::ChainIterator<nel::SliceIterator<int> >::for_each<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)>:
+         *
+         * @param fn func to apply to each item in iterator
+         */
+        // void for_each(std::function<void(OutT)> fn)
+        template<typename F>
+        void for_each(F &&fn)
+    2cd6:	55                   	push   %rbp
+    2cd7:	48 89 e5             	mov    %rsp,%rbp
+    2cda:	48 83 ec 10          	sub    $0x10,%rsp
+    2cde:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2ce2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            it1_.for_each(fn);
+    2ce6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cea:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2cee:	48 89 d6             	mov    %rdx,%rsi
+    2cf1:	48 89 c7             	mov    %rax,%rdi
+    2cf4:	e8 95 0d 00 00       	call   3a8e <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)>
+            it2_.for_each(fn);
+    2cf9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cfd:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    2d01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2d05:	48 89 c6             	mov    %rax,%rsi
+    2d08:	48 89 d7             	mov    %rdx,%rdi
+    2d0b:	e8 7e 0d 00 00       	call   3a8e <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)>
+        }
+    2d10:	90                   	nop
+    2d11:	c9                   	leave
+    2d12:	c3                   	ret
+    2d13:	90                   	nop
+
+0000000000002d14 <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2d14:	       55                   	push   %rbp
+    2d15:	       48 89 e5             	mov    %rsp,%rbp
+    2d18:	       48 83 ec 20          	sub    $0x20,%rsp
+    2d1c:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2d20:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    2d27:	       00 
+    2d28:	   /-- eb 3a                	jmp    2d64 <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)::{lambda()#1}::operator()() const+0x50>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2d2a:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d2e:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    2d32:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2d36:	|  |   48 8b 52 08          	mov    0x8(%rdx),%rdx
+            r += f(s);
+    2d3a:	|  |   48 89 d6             	mov    %rdx,%rsi
+    2d3d:	|  |   48 89 c7             	mov    %rax,%rdi
+    2d40:	|  |   e8 63 ea ff ff       	call   17a8 <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const>
+    2d45:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2d48:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d4c:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    2d4f:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2d52:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d56:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    2d59:	|  |   48 01 ca             	add    %rcx,%rdx
+    2d5c:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2d5f:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2d64:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d68:	|      48 8b 40 18          	mov    0x18(%rax),%rax
+        for (nel::Index i = 0; i < reps; ++i) {
+    2d6c:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2d70:	\----- 72 b8                	jb     2d2a <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2d72:	       90                   	nop
+    2d73:	       90                   	nop
+    2d74:	       c9                   	leave
+    2d75:	       c3                   	ret
+
+0000000000002d76 <void run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)>:
+void run(char const *const name, nel::Slice<int> const &s, F &&f)
+    2d76:	55                   	push   %rbp
+    2d77:	48 89 e5             	mov    %rsp,%rbp
+    2d7a:	48 83 ec 60          	sub    $0x60,%rsp
+    2d7e:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    2d82:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    2d86:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    nel::Count const reps = n_total / s.len();
+    2d8a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2d8e:	48 89 c7             	mov    %rax,%rdi
+    2d91:	e8 f2 16 00 00       	call   4488 <nel::Slice<int>::len() const>
+    2d96:	48 89 c1             	mov    %rax,%rcx
+    2d99:	b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    2d9e:	ba 00 00 00 00       	mov    $0x0,%edx
+    2da3:	48 f7 f1             	div    %rcx
+    2da6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    Acc r = 0;
+    2daa:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+    2db1:	00 
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2db2:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    2db6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    2dba:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2dbe:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    2dc2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2dc6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2dca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2dce:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    2dd2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    2dd6:	48 89 c7             	mov    %rax,%rdi
+    2dd9:	e8 5c 0d 00 00       	call   3b3a <unsigned long bench::time_ns<run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)::{lambda()#1}>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)>
+    2dde:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    sink = sink + r;
+    2de2:	48 8b 15 b7 a2 00 00 	mov    0xa2b7(%rip),%rdx        # d0a0 <sink>
+    2de9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2ded:	48 01 d0             	add    %rdx,%rax
+    2df0:	48 89 05 a9 a2 00 00 	mov    %rax,0xa2a9(%rip)        # d0a0 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    2df7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2dfb:	48 89 c7             	mov    %rax,%rdi
+    2dfe:	e8 85 16 00 00       	call   4488 <nel::Slice<int>::len() const>
+    2e03:	48 0f af 45 f8       	imul   -0x8(%rbp),%rax
+    2e08:	48 89 c2             	mov    %rax,%rdx
+    2e0b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2e0f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2e13:	48 89 ce             	mov    %rcx,%rsi
+    2e16:	48 89 c7             	mov    %rax,%rdi
+    2e19:	e8 c1 13 00 00       	call   41df <bench::report_per_item(char const*, unsigned long, unsigned long)>
+}
+    2e1e:	90                   	nop
+    2e1f:	c9                   	leave
+    2e20:	c3                   	ret
+    2e21:	90                   	nop
+
+0000000000002e22 <void nel::ChainIterator<nel::SliceIterator<int> >::for_each2<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)>:
+
+#    if defined(C_LIKE) && defined(RUST_LIKE)
+        // void for_each2(std::function<void(OutT)> fn)
+        template<typename F>
+        void for_each2(F &&fn)
+    2e22:	55                   	push   %rbp
+    2e23:	48 89 e5             	mov    %rsp,%rbp
+    2e26:	48 83 ec 10          	sub    $0x10,%rsp
+    2e2a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2e2e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            it1_.for_each2(fn);
+    2e32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e36:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2e3a:	48 89 d6             	mov    %rdx,%rsi
+    2e3d:	48 89 c7             	mov    %rax,%rdi
+    2e40:	e8 21 0d 00 00       	call   3b66 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each2<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)>
+            it2_.for_each2(fn);
+    2e45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e49:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    2e4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e51:	48 89 c6             	mov    %rax,%rsi
+    2e54:	48 89 d7             	mov    %rdx,%rdi
+    2e57:	e8 0a 0d 00 00       	call   3b66 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each2<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)>
+        }
+    2e5c:	90                   	nop
+    2e5d:	c9                   	leave
+    2e5e:	c3                   	ret
+    2e5f:	90                   	nop
+
+0000000000002e60 <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2e60:	       55                   	push   %rbp
+    2e61:	       48 89 e5             	mov    %rsp,%rbp
+    2e64:	       48 83 ec 20          	sub    $0x20,%rsp
+    2e68:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2e6c:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    2e73:	       00 
+    2e74:	   /-- eb 3a                	jmp    2eb0 <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)::{lambda()#1}::operator()() const+0x50>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2e76:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e7a:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    2e7e:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2e82:	|  |   48 8b 52 08          	mov    0x8(%rdx),%rdx
+            r += f(s);
+    2e86:	|  |   48 89 d6             	mov    %rdx,%rsi
+    2e89:	|  |   48 89 c7             	mov    %rax,%rdi
+    2e8c:	|  |   e8 1b ea ff ff       	call   18ac <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const>
+    2e91:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2e94:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e98:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    2e9b:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2e9e:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ea2:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    2ea5:	|  |   48 01 ca             	add    %rcx,%rdx
+    2ea8:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2eab:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2eb0:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2eb4:	|      48 8b 40 18          	mov    0x18(%rax),%rax
+        for (nel::Index i = 0; i < reps; ++i) {
+    2eb8:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2ebc:	\----- 72 b8                	jb     2e76 <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2ebe:	       90                   	nop
+    2ebf:	       90                   	nop
+    2ec0:	       c9                   	leave
+    2ec1:	       c3                   	ret
+
+0000000000002ec2 <void run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)>:
+void run(char const *const name, nel::Slice<int> const &s, F &&f)
+    2ec2:	55                   	push   %rbp
+    2ec3:	48 89 e5             	mov    %rsp,%rbp
+    2ec6:	48 83 ec 60          	sub    $0x60,%rsp
+    2eca:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    2ece:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    2ed2:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    nel::Count const reps = n_total / s.len();
+    2ed6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2eda:	48 89 c7             	mov    %rax,%rdi
+    2edd:	e8 a6 15 00 00       	call   4488 <nel::Slice<int>::len() const>
+    2ee2:	48 89 c1             	mov    %rax,%rcx
+    2ee5:	b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    2eea:	ba 00 00 00 00       	mov    $0x0,%edx
+    2eef:	48 f7 f1             	div    %rcx
+    2ef2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    Acc r = 0;
+    2ef6:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+    2efd:	00 
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2efe:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    2f02:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    2f06:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2f0a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    2f0e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2f12:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2f16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f1a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    2f1e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    2f22:	48 89 c7             	mov    %rax,%rdi
+    2f25:	e8 a7 0c 00 00       	call   3bd1 <unsigned long bench::time_ns<run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)::{lambda()#1}>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)>
+    2f2a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    sink = sink + r;
+    2f2e:	48 8b 15 6b a1 00 00 	mov    0xa16b(%rip),%rdx        # d0a0 <sink>
+    2f35:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2f39:	48 01 d0             	add    %rdx,%rax
+    2f3c:	48 89 05 5d a1 00 00 	mov    %rax,0xa15d(%rip)        # d0a0 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    2f43:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2f47:	48 89 c7             	mov    %rax,%rdi
+    2f4a:	e8 39 15 00 00       	call   4488 <nel::Slice<int>::len() const>
+    2f4f:	48 0f af 45 f8       	imul   -0x8(%rbp),%rax
+    2f54:	48 89 c2             	mov    %rax,%rdx
+    2f57:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2f5b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2f5f:	48 89 ce             	mov    %rcx,%rsi
+    2f62:	48 89 c7             	mov    %rax,%rdi
+    2f65:	e8 75 12 00 00       	call   41df <bench::report_per_item(char const*, unsigned long, unsigned long)>
+}
+    2f6a:	90                   	nop
+    2f6b:	c9                   	leave
+    2f6c:	c3                   	ret
+    2f6d:	90                   	nop
+
+0000000000002f6e <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2f6e:	       55                   	push   %rbp
+    2f6f:	       48 89 e5             	mov    %rsp,%rbp
+    2f72:	       48 83 ec 20          	sub    $0x20,%rsp
+    2f76:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2f7a:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    2f81:	       00 
+    2f82:	   /-- eb 3a                	jmp    2fbe <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}&&)::{lambda()#1}::operator()() const+0x50>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2f84:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f88:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    2f8c:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2f90:	|  |   48 8b 52 08          	mov    0x8(%rdx),%rdx
+            r += f(s);
+    2f94:	|  |   48 89 d6             	mov    %rdx,%rsi
+    2f97:	|  |   48 89 c7             	mov    %rax,%rdi
+    2f9a:	|  |   e8 e1 e9 ff ff       	call   1980 <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}::operator()(nel::Slice<int> const&) const>
+    2f9f:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2fa2:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2fa6:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    2fa9:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2fac:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2fb0:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    2fb3:	|  |   48 01 ca             	add    %rcx,%rdx
+    2fb6:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2fb9:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2fbe:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2fc2:	|      48 8b 40 18          	mov    0x18(%rax),%rax
+        for (nel::Index i = 0; i < reps; ++i) {
+    2fc6:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2fca:	\----- 72 b8                	jb     2f84 <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2fcc:	       90                   	nop
+    2fcd:	       90                   	nop
+    2fce:	       c9                   	leave
+    2fcf:	       c3                   	ret
+
+0000000000002fd0 <void run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}&&)>:
+void run(char const *const name, nel::Slice<int> const &s, F &&f)
+    2fd0:	55                   	push   %rbp
+    2fd1:	48 89 e5             	mov    %rsp,%rbp
+    2fd4:	48 83 ec 60          	sub    $0x60,%rsp
+    2fd8:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    2fdc:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    2fe0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    nel::Count const reps = n_total / s.len();
+    2fe4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2fe8:	48 89 c7             	mov    %rax,%rdi
+    2feb:	e8 98 14 00 00       	call   4488 <nel::Slice<int>::len() const>
+    2ff0:	48 89 c1             	mov    %rax,%rcx
+    2ff3:	b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    2ff8:	ba 00 00 00 00       	mov    $0x0,%edx
+    2ffd:	48 f7 f1             	div    %rcx
+    3000:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    Acc r = 0;
+    3004:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+    300b:	00 
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    300c:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    3010:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    3014:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3018:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    301c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    3020:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    3024:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3028:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    302c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    3030:	48 89 c7             	mov    %rax,%rdi
+    3033:	e8 c5 0b 00 00       	call   3bfd <unsigned long bench::time_ns<run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}&&)::{lambda()#1}>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}&&)>
+    3038:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    sink = sink + r;
+    303c:	48 8b 15 5d a0 00 00 	mov    0xa05d(%rip),%rdx        # d0a0 <sink>
+    3043:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3047:	48 01 d0             	add    %rdx,%rax
+    304a:	48 89 05 4f a0 00 00 	mov    %rax,0xa04f(%rip)        # d0a0 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    3051:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3055:	48 89 c7             	mov    %rax,%rdi
+    3058:	e8 2b 14 00 00       	call   4488 <nel::Slice<int>::len() const>
+    305d:	48 0f af 45 f8       	imul   -0x8(%rbp),%rax
+    3062:	48 89 c2             	mov    %rax,%rdx
+    3065:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3069:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    306d:	48 89 ce             	mov    %rcx,%rsi
+    3070:	48 89 c7             	mov    %rax,%rdi
+    3073:	e8 67 11 00 00       	call   41df <bench::report_per_item(char const*, unsigned long, unsigned long)>
+}
+    3078:	90                   	nop
+    3079:	c9                   	leave
+    307a:	c3                   	ret
+    307b:	90                   	nop
+
+000000000000307c <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    307c:	       55                   	push   %rbp
+    307d:	       48 89 e5             	mov    %rsp,%rbp
+    3080:	       48 83 ec 20          	sub    $0x20,%rsp
+    3084:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    3088:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    308f:	       00 
+    3090:	   /-- eb 3a                	jmp    30cc <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}&&)::{lambda()#1}::operator()() const+0x50>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    3092:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3096:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    309a:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    309e:	|  |   48 8b 52 08          	mov    0x8(%rdx),%rdx
+            r += f(s);
+    30a2:	|  |   48 89 d6             	mov    %rdx,%rsi
+    30a5:	|  |   48 89 c7             	mov    %rax,%rdi
+    30a8:	|  |   e8 13 ea ff ff       	call   1ac0 <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}::operator()(nel::Slice<int> const&) const>
+    30ad:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    30b0:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    30b4:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    30b7:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    30ba:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    30be:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    30c1:	|  |   48 01 ca             	add    %rcx,%rdx
+    30c4:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index i = 0; i < reps; ++i) {
+    30c7:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    30cc:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    30d0:	|      48 8b 40 18          	mov    0x18(%rax),%rax
+        for (nel::Index i = 0; i < reps; ++i) {
+    30d4:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    30d8:	\----- 72 b8                	jb     3092 <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    30da:	       90                   	nop
+    30db:	       90                   	nop
+    30dc:	       c9                   	leave
+    30dd:	       c3                   	ret
+
+00000000000030de <void run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}&&)>:
+void run(char const *const name, nel::Slice<int> const &s, F &&f)
+    30de:	55                   	push   %rbp
+    30df:	48 89 e5             	mov    %rsp,%rbp
+    30e2:	48 83 ec 60          	sub    $0x60,%rsp
+    30e6:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    30ea:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    30ee:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    nel::Count const reps = n_total / s.len();
+    30f2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    30f6:	48 89 c7             	mov    %rax,%rdi
+    30f9:	e8 8a 13 00 00       	call   4488 <nel::Slice<int>::len() const>
+    30fe:	48 89 c1             	mov    %rax,%rcx
+    3101:	b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    3106:	ba 00 00 00 00       	mov    $0x0,%edx
+    310b:	48 f7 f1             	div    %rcx
+    310e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    Acc r = 0;
+    3112:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+    3119:	00 
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    311a:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    311e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    3122:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3126:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    312a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    312e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    3132:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3136:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    313a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    313e:	48 89 c7             	mov    %rax,%rdi
+    3141:	e8 e3 0a 00 00       	call   3c29 <unsigned long bench::time_ns<run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}&&)::{lambda()#1}>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}&&)>
+    3146:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    sink = sink + r;
+    314a:	48 8b 15 4f 9f 00 00 	mov    0x9f4f(%rip),%rdx        # d0a0 <sink>
+    3151:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3155:	48 01 d0             	add    %rdx,%rax
+    3158:	48 89 05 41 9f 00 00 	mov    %rax,0x9f41(%rip)        # d0a0 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    315f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3163:	48 89 c7             	mov    %rax,%rdi
+    3166:	e8 1d 13 00 00       	call   4488 <nel::Slice<int>::len() const>
+    316b:	48 0f af 45 f8       	imul   -0x8(%rbp),%rax
+    3170:	48 89 c2             	mov    %rax,%rdx
+    3173:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3177:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    317b:	48 89 ce             	mov    %rcx,%rsi
+    317e:	48 89 c7             	mov    %rax,%rdi
+    3181:	e8 59 10 00 00       	call   41df <bench::report_per_item(char const*, unsigned long, unsigned long)>
+}
+    3186:	90                   	nop
+    3187:	c9                   	leave
+    3188:	c3                   	ret
+    3189:	90                   	nop
+
+000000000000318a <run<bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    318a:	       55                   	push   %rbp
+    318b:	       48 89 e5             	mov    %rsp,%rbp
+    318e:	       48 83 ec 20          	sub    $0x20,%rsp
+    3192:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    3196:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    319d:	       00 
+    319e:	   /-- eb 3a                	jmp    31da <run<bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}::operator()() const+0x50>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    31a0:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31a4:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    31a8:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    31ac:	|  |   48 8b 52 08          	mov    0x8(%rdx),%rdx
+            r += f(s);
+    31b0:	|  |   48 89 d6             	mov    %rdx,%rsi
+    31b3:	|  |   48 89 c7             	mov    %rax,%rdi
+    31b6:	|  |   e8 a3 ea ff ff       	call   1c5e <bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const>
+    31bb:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    31be:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31c2:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    31c5:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    31c8:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31cc:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(s);
+    31cf:	|  |   48 01 ca             	add    %rcx,%rdx
+    31d2:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index i = 0; i < reps; ++i) {
+    31d5:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    31da:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31de:	|      48 8b 40 18          	mov    0x18(%rax),%rax
+        for (nel::Index i = 0; i < reps; ++i) {
+    31e2:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    31e6:	\----- 72 b8                	jb     31a0 <run<bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    31e8:	       90                   	nop
+    31e9:	       90                   	nop
+    31ea:	       c9                   	leave
+    31eb:	       c3                   	ret
+
+00000000000031ec <void run<bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)>:
+void run(char const *const name, nel::Slice<int> const &s, F &&f)
+    31ec:	55                   	push   %rbp
+    31ed:	48 89 e5             	mov    %rsp,%rbp
+    31f0:	48 83 ec 60          	sub    $0x60,%rsp
+    31f4:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    31f8:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    31fc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    nel::Count const reps = n_total / s.len();
+    3200:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3204:	48 89 c7             	mov    %rax,%rdi
+    3207:	e8 7c 12 00 00       	call   4488 <nel::Slice<int>::len() const>
+    320c:	48 89 c1             	mov    %rax,%rcx
+    320f:	b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    3214:	ba 00 00 00 00       	mov    $0x0,%edx
+    3219:	48 f7 f1             	div    %rcx
+    321c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    Acc r = 0;
+    3220:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+    3227:	00 
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    3228:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    322c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    3230:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3234:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    3238:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    323c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    3240:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3244:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    3248:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    324c:	48 89 c7             	mov    %rax,%rdi
+    324f:	e8 01 0a 00 00       	call   3c55 <unsigned long bench::time_ns<run<bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}>(bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)>
+    3254:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    sink = sink + r;
+    3258:	48 8b 15 41 9e 00 00 	mov    0x9e41(%rip),%rdx        # d0a0 <sink>
+    325f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3263:	48 01 d0             	add    %rdx,%rax
+    3266:	48 89 05 33 9e 00 00 	mov    %rax,0x9e33(%rip)        # d0a0 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    326d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3271:	48 89 c7             	mov    %rax,%rdi
+    3274:	e8 0f 12 00 00       	call   4488 <nel::Slice<int>::len() const>
+    3279:	48 0f af 45 f8       	imul   -0x8(%rbp),%rax
+    327e:	48 89 c2             	mov    %rax,%rdx
+    3281:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3285:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3289:	48 89 ce             	mov    %rcx,%rsi
+    328c:	48 89 c7             	mov    %rax,%rdi
+    328f:	e8 4b 0f 00 00       	call   41df <bench::report_per_item(char const*, unsigned long, unsigned long)>
+}
+    3294:	90                   	nop
+    3295:	c9                   	leave
+    3296:	c3                   	ret
+    3297:	90                   	nop
+
+0000000000003298 <void nel::ChainIterator<nel::SliceIterator<int> >::for_each<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&&)>:
+        void for_each(F &&fn)
+    3298:	55                   	push   %rbp
+    3299:	48 89 e5             	mov    %rsp,%rbp
+    329c:	48 83 ec 10          	sub    $0x10,%rsp
+    32a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    32a4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            it1_.for_each(fn);
+    32a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32ac:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    32b0:	48 89 d6             	mov    %rdx,%rsi
+    32b3:	48 89 c7             	mov    %rax,%rdi
+    32b6:	e8 c7 09 00 00       	call   3c82 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&)>
+            it2_.for_each(fn);
+    32bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32bf:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    32c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    32c7:	48 89 c6             	mov    %rax,%rsi
+    32ca:	48 89 d7             	mov    %rdx,%rdi
+    32cd:	e8 b0 09 00 00       	call   3c82 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&)>
+        }
+    32d2:	90                   	nop
+    32d3:	c9                   	leave
+    32d4:	c3                   	ret
+    32d5:	90                   	nop
+
+00000000000032d6 <run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, &f, reps]() {
+    32d6:	       55                   	push   %rbp
+    32d7:	       48 89 e5             	mov    %rsp,%rbp
+    32da:	       48 83 ec 20          	sub    $0x20,%rsp
+    32de:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    32e2:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    32e9:	       00 
+    32ea:	   /-- eb 39                	jmp    3325 <run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}&&)::{lambda()#1}::operator()() const+0x4f>
+    auto t = bench::time_ns([&r, &f, reps]() {
+    32ec:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    32f0:	|  |   48 8b 40 08          	mov    0x8(%rax),%rax
+            r += f(queue);
+    32f4:	|  |   48 8d 15 c5 9d 00 00 	lea    0x9dc5(%rip),%rdx        # d0c0 <queue>
+    32fb:	|  |   48 89 d6             	mov    %rdx,%rsi
+    32fe:	|  |   48 89 c7             	mov    %rax,%rdi
+    3301:	|  |   e8 f8 e9 ff ff       	call   1cfe <bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const>
+    3306:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&r, &f, reps]() {
+    3309:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    330d:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(queue);
+    3310:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&r, &f, reps]() {
+    3313:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3317:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(queue);
+    331a:	|  |   48 01 ca             	add    %rcx,%rdx
+    331d:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index i = 0; i < reps; ++i) {
+    3320:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    3325:	|  \-> 48 81 7d f8 08 3d 00 	cmpq   $0x3d08,-0x8(%rbp)
+    332c:	|      00 
+    332d:	\----- 76 bd                	jbe    32ec <run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, &f, reps]() {
+    332f:	       90                   	nop
+    3330:	       90                   	nop
+    3331:	       c9                   	leave
+    3332:	       c3                   	ret
+
+0000000000003333 <void run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}&&)>:
+void run_queue(char const *const name, F &&f)
+    3333:	55                   	push   %rbp
+    3334:	48 89 e5             	mov    %rsp,%rbp
+    3337:	48 83 ec 50          	sub    $0x50,%rsp
+    333b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    333f:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    nel::Count const reps = n_total / queue_len;
+    3343:	48 c7 45 f8 09 3d 00 	movq   $0x3d09,-0x8(%rbp)
+    334a:	00 
+    Acc r = 0;
+    334b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+    3352:	00 
+    auto t = bench::time_ns([&r, &f, reps]() {
+    3353:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    3357:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    335b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    335f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    3363:	48 c7 45 e0 09 3d 00 	movq   $0x3d09,-0x20(%rbp)
+    336a:	00 
+    336b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    336f:	48 89 c7             	mov    %rax,%rdi
+    3372:	e8 b7 09 00 00       	call   3d2e <unsigned long bench::time_ns<run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}&&)::{lambda()#1}>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}&&)>
+    3377:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    sink = sink + r;
+    337b:	48 8b 15 1e 9d 00 00 	mov    0x9d1e(%rip),%rdx        # d0a0 <sink>
+    3382:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3386:	48 01 d0             	add    %rdx,%rax
+    3389:	48 89 05 10 9d 00 00 	mov    %rax,0x9d10(%rip)        # d0a0 <sink>
+    bench::report_per_item(name, t, reps * queue_len);
+    3390:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3394:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3398:	ba 00 90 d0 03       	mov    $0x3d09000,%edx
+    339d:	48 89 ce             	mov    %rcx,%rsi
+    33a0:	48 89 c7             	mov    %rax,%rdi
+    33a3:	e8 37 0e 00 00       	call   41df <bench::report_per_item(char const*, unsigned long, unsigned long)>
+}
+    33a8:	90                   	nop
+    33a9:	c9                   	leave
+    33aa:	c3                   	ret
+    33ab:	90                   	nop
+
+00000000000033ac <nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}> nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::map<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&&)>:
+        constexpr MappingIterator<ItT, U, Fn> map(Fn &&fn)
+    33ac:	55                   	push   %rbp
+    33ad:	48 89 e5             	mov    %rsp,%rbp
+    33b0:	53                   	push   %rbx
+    33b1:	48 83 ec 28          	sub    $0x28,%rsp
+    33b5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    33b9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    33bd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            return MappingIterator<ItT, U, Fn>(move(self()), forward<Fn>(fn));
+    33c1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    33c5:	48 89 c7             	mov    %rax,%rdi
+    33c8:	e8 8d 09 00 00       	call   3d5a <bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&& nel::forward<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&)>
+    33cd:	48 89 c3             	mov    %rax,%rbx
+    33d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    33d4:	48 89 c7             	mov    %rax,%rdi
+    33d7:	e8 96 20 00 00       	call   5472 <nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::self()>
+    33dc:	48 89 c7             	mov    %rax,%rdi
+    33df:	e8 9e 23 00 00       	call   5782 <nel::ChainIterator<nel::SliceIterator<int> >&& nel::move<nel::ChainIterator<nel::SliceIterator<int> > >(nel::ChainIterator<nel::SliceIterator<int> >&)>
+    33e4:	48 89 c1             	mov    %rax,%rcx
+    33e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    33eb:	48 89 da             	mov    %rbx,%rdx
+    33ee:	48 89 ce             	mov    %rcx,%rsi
+    33f1:	48 89 c7             	mov    %rax,%rdi
+    33f4:	e8 6f 09 00 00       	call   3d68 <nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::MappingIterator(nel::ChainIterator<nel::SliceIterator<int> >&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&&)>
+        }
+    33f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    33fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3401:	c9                   	leave
+    3402:	c3                   	ret
+    3403:	90                   	nop
+
+0000000000003404 <nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}::operator()(unsigned long) const>:
+            self().for_each([&acc, &fn](OutT v) { fn(acc, v); });
+    3404:	55                   	push   %rbp
+    3405:	48 89 e5             	mov    %rsp,%rbp
+    3408:	48 83 ec 10          	sub    $0x10,%rsp
+    340c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3410:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3414:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3418:	48 8b 40 08          	mov    0x8(%rax),%rax
+    341c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3420:	48 8b 0a             	mov    (%rdx),%rcx
+    3423:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    3427:	48 89 ce             	mov    %rcx,%rsi
+    342a:	48 89 c7             	mov    %rax,%rdi
+    342d:	e8 2e e9 ff ff       	call   1d60 <bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}::operator()(unsigned long&, unsigned long const&) const>
+    3432:	90                   	nop
+    3433:	c9                   	leave
+    3434:	c3                   	ret
+    3435:	90                   	nop
+
+0000000000003436 <unsigned long nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)>:
+        U fold(U &&initial, F &&fn)
+    3436:	55                   	push   %rbp
+    3437:	48 89 e5             	mov    %rsp,%rbp
+    343a:	48 83 ec 40          	sub    $0x40,%rsp
+    343e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    3442:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    3446:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+            U acc = move(initial);
+    344a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    344e:	48 89 c7             	mov    %rax,%rdi
+    3451:	e8 35 1e 00 00       	call   528b <unsigned long&& nel::move<unsigned long>(unsigned long&)>
+    3456:	48 8b 00             	mov    (%rax),%rax
+    3459:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+            self().for_each([&acc, &fn](OutT v) { fn(acc, v); });
+    345d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3461:	48 89 c7             	mov    %rax,%rdi
+    3464:	e8 43 09 00 00       	call   3dac <nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::self()>
+    3469:	48 89 c2             	mov    %rax,%rdx
+    346c:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+    3470:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    3474:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3478:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    347c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    3480:	48 89 c6             	mov    %rax,%rsi
+    3483:	48 89 d7             	mov    %rdx,%rdi
+    3486:	e8 7d 09 00 00       	call   3e08 <void nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::for_each<nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)>
+            return acc;
+    348b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+        }
+    348f:	c9                   	leave
+    3490:	c3                   	ret
+    3491:	90                   	nop
+
+0000000000003492 <run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, &f, reps]() {
+    3492:	       55                   	push   %rbp
+    3493:	       48 89 e5             	mov    %rsp,%rbp
+    3496:	       48 83 ec 20          	sub    $0x20,%rsp
+    349a:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    349e:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    34a5:	       00 
+    34a6:	   /-- eb 39                	jmp    34e1 <run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}&&)::{lambda()#1}::operator()() const+0x4f>
+    auto t = bench::time_ns([&r, &f, reps]() {
+    34a8:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34ac:	|  |   48 8b 40 08          	mov    0x8(%rax),%rax
+            r += f(queue);
+    34b0:	|  |   48 8d 15 09 9c 00 00 	lea    0x9c09(%rip),%rdx        # d0c0 <queue>
+    34b7:	|  |   48 89 d6             	mov    %rdx,%rsi
+    34ba:	|  |   48 89 c7             	mov    %rax,%rdi
+    34bd:	|  |   e8 ca e8 ff ff       	call   1d8c <bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const>
+    34c2:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&r, &f, reps]() {
+    34c5:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34c9:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(queue);
+    34cc:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&r, &f, reps]() {
+    34cf:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34d3:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(queue);
+    34d6:	|  |   48 01 ca             	add    %rcx,%rdx
+    34d9:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index i = 0; i < reps; ++i) {
+    34dc:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    34e1:	|  \-> 48 81 7d f8 08 3d 00 	cmpq   $0x3d08,-0x8(%rbp)
+    34e8:	|      00 
+    34e9:	\----- 76 bd                	jbe    34a8 <run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, &f, reps]() {
+    34eb:	       90                   	nop
+    34ec:	       90                   	nop
+    34ed:	       c9                   	leave
+    34ee:	       c3                   	ret
+
+00000000000034ef <void run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}&&)>:
+void run_queue(char const *const name, F &&f)
+    34ef:	55                   	push   %rbp
+    34f0:	48 89 e5             	mov    %rsp,%rbp
+    34f3:	48 83 ec 50          	sub    $0x50,%rsp
+    34f7:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    34fb:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    nel::Count const reps = n_total / queue_len;
+    34ff:	48 c7 45 f8 09 3d 00 	movq   $0x3d09,-0x8(%rbp)
+    3506:	00 
+    Acc r = 0;
+    3507:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+    350e:	00 
+    auto t = bench::time_ns([&r, &f, reps]() {
+    350f:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    3513:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    3517:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    351b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    351f:	48 c7 45 e0 09 3d 00 	movq   $0x3d09,-0x20(%rbp)
+    3526:	00 
+    3527:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    352b:	48 89 c7             	mov    %rax,%rdi
+    352e:	e8 0b 09 00 00       	call   3e3e <unsigned long bench::time_ns<run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}&&)::{lambda()#1}>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}&&)>
+    3533:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    sink = sink + r;
+    3537:	48 8b 15 62 9b 00 00 	mov    0x9b62(%rip),%rdx        # d0a0 <sink>
+    353e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3542:	48 01 d0             	add    %rdx,%rax
+    3545:	48 89 05 54 9b 00 00 	mov    %rax,0x9b54(%rip)        # d0a0 <sink>
+    bench::report_per_item(name, t, reps * queue_len);
+    354c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3550:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3554:	ba 00 90 d0 03       	mov    $0x3d09000,%edx
+    3559:	48 89 ce             	mov    %rcx,%rsi
+    355c:	48 89 c7             	mov    %rax,%rdi
+    355f:	e8 7b 0c 00 00       	call   41df <bench::report_per_item(char const*, unsigned long, unsigned long)>
+}
+    3564:	90                   	nop
+    3565:	c9                   	leave
+    3566:	c3                   	ret
+    3567:	90                   	nop
+
+0000000000003568 <run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, &f, reps]() {
+    3568:	       55                   	push   %rbp
+    3569:	       48 89 e5             	mov    %rsp,%rbp
+    356c:	       48 83 ec 20          	sub    $0x20,%rsp
+    3570:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    3574:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    357b:	       00 
+    357c:	   /-- eb 39                	jmp    35b7 <run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}&&)::{lambda()#1}::operator()() const+0x4f>
+    auto t = bench::time_ns([&r, &f, reps]() {
+    357e:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3582:	|  |   48 8b 40 08          	mov    0x8(%rax),%rax
+            r += f(queue);
+    3586:	|  |   48 8d 15 33 9b 00 00 	lea    0x9b33(%rip),%rdx        # d0c0 <queue>
+    358d:	|  |   48 89 d6             	mov    %rdx,%rsi
+    3590:	|  |   48 89 c7             	mov    %rax,%rdi
+    3593:	|  |   e8 50 e8 ff ff       	call   1de8 <bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}::operator()(nel::heapless::Queue<int, 4096ul>&) const>
+    3598:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&r, &f, reps]() {
+    359b:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    359f:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(queue);
+    35a2:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&r, &f, reps]() {
+    35a5:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    35a9:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(queue);
+    35ac:	|  |   48 01 ca             	add    %rcx,%rdx
+    35af:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index i = 0; i < reps; ++i) {
+    35b2:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    35b7:	|  \-> 48 81 7d f8 08 3d 00 	cmpq   $0x3d08,-0x8(%rbp)
+    35be:	|      00 
+    35bf:	\----- 76 bd                	jbe    357e <run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, &f, reps]() {
+    35c1:	       90                   	nop
+    35c2:	       90                   	nop
+    35c3:	       c9                   	leave
+    35c4:	       c3                   	ret
+
+00000000000035c5 <void run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}&&)>:
+void run_queue(char const *const name, F &&f)
+    35c5:	55                   	push   %rbp
+    35c6:	48 89 e5             	mov    %rsp,%rbp
+    35c9:	48 83 ec 50          	sub    $0x50,%rsp
+    35cd:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    35d1:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    nel::Count const reps = n_total / queue_len;
+    35d5:	48 c7 45 f8 09 3d 00 	movq   $0x3d09,-0x8(%rbp)
+    35dc:	00 
+    Acc r = 0;
+    35dd:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+    35e4:	00 
+    auto t = bench::time_ns([&r, &f, reps]() {
+    35e5:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    35e9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    35ed:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    35f1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    35f5:	48 c7 45 e0 09 3d 00 	movq   $0x3d09,-0x20(%rbp)
+    35fc:	00 
+    35fd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    3601:	48 89 c7             	mov    %rax,%rdi
+    3604:	e8 61 08 00 00       	call   3e6a <unsigned long bench::time_ns<run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}&&)::{lambda()#1}>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}&&)>
+    3609:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    sink = sink + r;
+    360d:	48 8b 15 8c 9a 00 00 	mov    0x9a8c(%rip),%rdx        # d0a0 <sink>
+    3614:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3618:	48 01 d0             	add    %rdx,%rax
+    361b:	48 89 05 7e 9a 00 00 	mov    %rax,0x9a7e(%rip)        # d0a0 <sink>
+    bench::report_per_item(name, t, reps * queue_len);
+    3622:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3626:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    362a:	ba 00 90 d0 03       	mov    $0x3d09000,%edx
+    362f:	48 89 ce             	mov    %rcx,%rsi
+    3632:	48 89 c7             	mov    %rax,%rdi
+    3635:	e8 a5 0b 00 00       	call   41df <bench::report_per_item(char const*, unsigned long, unsigned long)>
+}
+    363a:	90                   	nop
+    363b:	c9                   	leave
+    363c:	c3                   	ret
+
+000000000000363d <unsigned long bench::time_ns<run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}>(bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)>:
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+}
+
+// Time a run of f(), in ns.
+template<typename F>
+long unsigned int time_ns(F &&f)
+    363d:	55                   	push   %rbp
+    363e:	48 89 e5             	mov    %rsp,%rbp
+    3641:	48 83 ec 20          	sub    $0x20,%rsp
+    3645:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+{
+    long unsigned int const b = now_ns();
+    3649:	e8 64 0b 00 00       	call   41b2 <bench::now_ns()>
+    364e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    3652:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3656:	48 89 c7             	mov    %rax,%rdi
+    3659:	e8 aa eb ff ff       	call   2208 <run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    365e:	e8 4f 0b 00 00       	call   41b2 <bench::now_ns()>
+    3663:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    3667:	c9                   	leave
+    3668:	c3                   	ret
+
+0000000000003669 <unsigned long bench::time_ns<run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)::{lambda()#1}>(bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)>:
+long unsigned int time_ns(F &&f)
+    3669:	55                   	push   %rbp
+    366a:	48 89 e5             	mov    %rsp,%rbp
+    366d:	48 83 ec 20          	sub    $0x20,%rsp
+    3671:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    3675:	e8 38 0b 00 00       	call   41b2 <bench::now_ns()>
+    367a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    367e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3682:	48 89 c7             	mov    %rax,%rdi
+    3685:	e8 38 ed ff ff       	call   23c2 <run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    368a:	e8 23 0b 00 00       	call   41b2 <bench::now_ns()>
+    368f:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    3693:	c9                   	leave
+    3694:	c3                   	ret
+
+0000000000003695 <unsigned long bench::time_ns<run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)::{lambda()#1}>(bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)>:
+long unsigned int time_ns(F &&f)
+    3695:	55                   	push   %rbp
+    3696:	48 89 e5             	mov    %rsp,%rbp
+    3699:	48 83 ec 20          	sub    $0x20,%rsp
+    369d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    36a1:	e8 0c 0b 00 00       	call   41b2 <bench::now_ns()>
+    36a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    36aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    36ae:	48 89 c7             	mov    %rax,%rdi
+    36b1:	e8 86 ee ff ff       	call   253c <run<bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_for_each(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    36b6:	e8 f7 0a 00 00       	call   41b2 <bench::now_ns()>
+    36bb:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    36bf:	c9                   	leave
+    36c0:	c3                   	ret
+
+00000000000036c1 <unsigned long bench::time_ns<run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}>(bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)>:
+long unsigned int time_ns(F &&f)
+    36c1:	55                   	push   %rbp
+    36c2:	48 89 e5             	mov    %rsp,%rbp
+    36c5:	48 83 ec 20          	sub    $0x20,%rsp
+    36c9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    36cd:	e8 e0 0a 00 00       	call   41b2 <bench::now_ns()>
+    36d2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    36d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    36da:	48 89 c7             	mov    %rax,%rdi
+    36dd:	e8 68 ef ff ff       	call   264a <run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    36e2:	e8 cb 0a 00 00       	call   41b2 <bench::now_ns()>
+    36e7:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    36eb:	c9                   	leave
+    36ec:	c3                   	ret
+
+00000000000036ed <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&& nel::forward<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel so to not need std.
+ */
+template<typename U, typename T>
+constexpr U &&forward(T &t)
+    36ed:	55                   	push   %rbp
+    36ee:	48 89 e5             	mov    %rsp,%rbp
+    36f1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<U &&>(t);
+    36f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    36f9:	5d                   	pop    %rbp
+    36fa:	c3                   	ret
+    36fb:	90                   	nop
+
+00000000000036fc <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::MappingIterator(nel::SliceIterator<int>&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)>:
+        constexpr MappingIterator(It &&inner, FnT &&fn)
+    36fc:	55                   	push   %rbp
+    36fd:	48 89 e5             	mov    %rsp,%rbp
+    3700:	53                   	push   %rbx
+    3701:	48 83 ec 28          	sub    $0x28,%rsp
+    3705:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3709:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    370d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            : inner_(move(inner))
+    3711:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    3715:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3719:	48 89 c7             	mov    %rax,%rdi
+    371c:	e8 5c 1b 00 00       	call   527d <nel::SliceIterator<int>&& nel::move<nel::SliceIterator<int> >(nel::SliceIterator<int>&)>
+    3721:	48 89 c6             	mov    %rax,%rsi
+    3724:	48 89 df             	mov    %rbx,%rdi
+    3727:	e8 f8 23 00 00       	call   5b24 <nel::SliceIterator<int>::SliceIterator(nel::SliceIterator<int>&&)>
+            , fn_(forward<FnT>(fn))
+    372c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3730:	48 89 c7             	mov    %rax,%rdi
+    3733:	e8 b5 ff ff ff       	call   36ed <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&& nel::forward<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)>
+        }
+    3738:	90                   	nop
+    3739:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    373d:	c9                   	leave
+    373e:	c3                   	ret
+    373f:	90                   	nop
+
+0000000000003740 <nel::Iterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>, int&, unsigned long>::self()>:
+        constexpr ItT &self(void)
+    3740:	55                   	push   %rbp
+    3741:	48 89 e5             	mov    %rsp,%rbp
+    3744:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    3748:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    374c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    3750:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    3754:	5d                   	pop    %rbp
+    3755:	c3                   	ret
+
+0000000000003756 <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&& nel::move<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >(nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&)>:
+constexpr T &&move(T &v)
+    3756:	55                   	push   %rbp
+    3757:	48 89 e5             	mov    %rsp,%rbp
+    375a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    375e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3762:	5d                   	pop    %rbp
+    3763:	c3                   	ret
+
+0000000000003764 <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::MappingIterator(nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&&)>:
+struct MappingIterator: public Iterator<MappingIterator<It, V, Fn>, typename It::InT, V>
+    3764:	55                   	push   %rbp
+    3765:	48 89 e5             	mov    %rsp,%rbp
+    3768:	48 83 ec 10          	sub    $0x10,%rsp
+    376c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3770:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3774:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3778:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    377c:	48 89 d6             	mov    %rdx,%rsi
+    377f:	48 89 c7             	mov    %rax,%rdi
+    3782:	e8 9d 23 00 00       	call   5b24 <nel::SliceIterator<int>::SliceIterator(nel::SliceIterator<int>&&)>
+    3787:	90                   	nop
+    3788:	c9                   	leave
+    3789:	c3                   	ret
+
+000000000000378a <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::FirstNIterator(nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&&, unsigned long)>:
+        constexpr FirstNIterator(It &&inner, Length limit)
+    378a:	55                   	push   %rbp
+    378b:	48 89 e5             	mov    %rsp,%rbp
+    378e:	53                   	push   %rbx
+    378f:	48 83 ec 28          	sub    $0x28,%rsp
+    3793:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3797:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    379b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            : inner_(move(inner))
+    379f:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    37a3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    37a7:	48 89 c7             	mov    %rax,%rdi
+    37aa:	e8 a7 ff ff ff       	call   3756 <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&& nel::move<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >(nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&)>
+    37af:	48 89 c6             	mov    %rax,%rsi
+    37b2:	48 89 df             	mov    %rbx,%rdi
+    37b5:	e8 aa ff ff ff       	call   3764 <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::MappingIterator(nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&&)>
+            , current_(0)
+    37ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    37be:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+    37c5:	00 
+            , limit_(limit)
+    37c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    37ca:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    37ce:	48 89 50 20          	mov    %rdx,0x20(%rax)
+        }
+    37d2:	90                   	nop
+    37d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    37d7:	c9                   	leave
+    37d8:	c3                   	ret
+    37d9:	90                   	nop
+
+00000000000037da <nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::self()>:
+        constexpr ItT &self(void)
+    37da:	55                   	push   %rbp
+    37db:	48 89 e5             	mov    %rsp,%rbp
+    37de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    37e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    37e6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    37ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    37ee:	5d                   	pop    %rbp
+    37ef:	c3                   	ret
+
+00000000000037f0 <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(bool&, unsigned long)#1}::operator()(bool&, unsigned long) const>:
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    37f0:	55                   	push   %rbp
+    37f1:	48 89 e5             	mov    %rsp,%rbp
+    37f4:	48 83 ec 18          	sub    $0x18,%rsp
+    37f8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    37fc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3800:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    3804:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3808:	48 8b 40 08          	mov    0x8(%rax),%rax
+                fn(e);
+    380c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3810:	48 89 d6             	mov    %rdx,%rsi
+    3813:	48 89 c7             	mov    %rax,%rdi
+    3816:	e8 d9 ef ff ff       	call   27f4 <nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}::operator()(unsigned long) const>
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    381b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    381f:	48 8b 00             	mov    (%rax),%rax
+                return ++current_ < limit_;
+    3822:	48 8b 50 18          	mov    0x18(%rax),%rdx
+    3826:	48 83 c2 01          	add    $0x1,%rdx
+    382a:	48 89 50 18          	mov    %rdx,0x18(%rax)
+    382e:	48 8b 50 18          	mov    0x18(%rax),%rdx
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    3832:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3836:	48 8b 00             	mov    (%rax),%rax
+                return ++current_ < limit_;
+    3839:	48 8b 40 20          	mov    0x20(%rax),%rax
+    383d:	48 39 c2             	cmp    %rax,%rdx
+    3840:	0f 92 c0             	setb   %al
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    3843:	c9                   	leave
+    3844:	c3                   	ret
+    3845:	90                   	nop
+
+0000000000003846 <void nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)>:
+        void for_each(F &&fn)
+    3846:	       55                   	push   %rbp
+    3847:	       48 89 e5             	mov    %rsp,%rbp
+    384a:	       48 83 ec 30          	sub    $0x30,%rsp
+    384e:	       48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    3852:	       48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+            if (current_ >= limit_) { return; }
+    3856:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    385a:	       48 8b 50 18          	mov    0x18(%rax),%rdx
+    385e:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3862:	       48 8b 40 20          	mov    0x20(%rax),%rax
+    3866:	       48 39 c2             	cmp    %rax,%rdx
+    3869:	/----- 73 2d                	jae    3898 <void nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)+0x52>
+            bool unused = true;
+    386b:	|      c6 45 ef 01          	movb   $0x1,-0x11(%rbp)
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    386f:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3873:	|      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    3877:	|      48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    387b:	|      48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    387f:	|      48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    3883:	|      48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    3887:	|      48 8d 4d ef          	lea    -0x11(%rbp),%rcx
+    388b:	|      48 89 ce             	mov    %rcx,%rsi
+    388e:	|      48 89 c7             	mov    %rax,%rdi
+    3891:	|      e8 50 06 00 00       	call   3ee6 <bool nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(bool&, unsigned long)#1}>(unsigned long&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)>
+    3896:	|  /-- eb 01                	jmp    3899 <void nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)+0x53>
+            if (current_ >= limit_) { return; }
+    3898:	\--|-> 90                   	nop
+        }
+    3899:	   \-> c9                   	leave
+    389a:	       c3                   	ret
+
+000000000000389b <unsigned long bench::time_ns<run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)::{lambda()#1}>(bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)>:
+long unsigned int time_ns(F &&f)
+    389b:	55                   	push   %rbp
+    389c:	48 89 e5             	mov    %rsp,%rbp
+    389f:	48 83 ec 20          	sub    $0x20,%rsp
+    38a3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    38a7:	e8 06 09 00 00       	call   41b2 <bench::now_ns()>
+    38ac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    38b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    38b4:	48 89 c7             	mov    %rax,%rdi
+    38b7:	e8 c6 ef ff ff       	call   2882 <run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    38bc:	e8 f1 08 00 00       	call   41b2 <bench::now_ns()>
+    38c1:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    38c5:	c9                   	leave
+    38c6:	c3                   	ret
+
+00000000000038c7 <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&& nel::forward<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)>:
+constexpr U &&forward(T &t)
+    38c7:	55                   	push   %rbp
+    38c8:	48 89 e5             	mov    %rsp,%rbp
+    38cb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    38cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    38d3:	5d                   	pop    %rbp
+    38d4:	c3                   	ret
+    38d5:	90                   	nop
+
+00000000000038d6 <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::MappingIterator(nel::SliceIterator<int>&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&&)>:
+        constexpr MappingIterator(It &&inner, FnT &&fn)
+    38d6:	55                   	push   %rbp
+    38d7:	48 89 e5             	mov    %rsp,%rbp
+    38da:	53                   	push   %rbx
+    38db:	48 83 ec 28          	sub    $0x28,%rsp
+    38df:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    38e3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    38e7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            : inner_(move(inner))
+    38eb:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    38ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    38f3:	48 89 c7             	mov    %rax,%rdi
+    38f6:	e8 82 19 00 00       	call   527d <nel::SliceIterator<int>&& nel::move<nel::SliceIterator<int> >(nel::SliceIterator<int>&)>
+    38fb:	48 89 c6             	mov    %rax,%rsi
+    38fe:	48 89 df             	mov    %rbx,%rdi
+    3901:	e8 1e 22 00 00       	call   5b24 <nel::SliceIterator<int>::SliceIterator(nel::SliceIterator<int>&&)>
+            , fn_(forward<FnT>(fn))
+    3906:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    390a:	48 89 c7             	mov    %rax,%rdi
+    390d:	e8 b5 ff ff ff       	call   38c7 <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&& nel::forward<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>(bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)>
+        }
+    3912:	90                   	nop
+    3913:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3917:	c9                   	leave
+    3918:	c3                   	ret
+    3919:	90                   	nop
+
+000000000000391a <nel::Iterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>, int&, unsigned long>::self()>:
+        constexpr ItT &self(void)
+    391a:	55                   	push   %rbp
+    391b:	48 89 e5             	mov    %rsp,%rbp
+    391e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    3922:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3926:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    392a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    392e:	5d                   	pop    %rbp
+    392f:	c3                   	ret
+
+0000000000003930 <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&& nel::move<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >(nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&)>:
+constexpr T &&move(T &v)
+    3930:	55                   	push   %rbp
+    3931:	48 89 e5             	mov    %rsp,%rbp
+    3934:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    3938:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    393c:	5d                   	pop    %rbp
+    393d:	c3                   	ret
+
+000000000000393e <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::MappingIterator(nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&&)>:
+struct MappingIterator: public Iterator<MappingIterator<It, V, Fn>, typename It::InT, V>
+    393e:	55                   	push   %rbp
+    393f:	48 89 e5             	mov    %rsp,%rbp
+    3942:	48 83 ec 10          	sub    $0x10,%rsp
+    3946:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    394a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    394e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3952:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3956:	48 89 d6             	mov    %rdx,%rsi
+    3959:	48 89 c7             	mov    %rax,%rdi
+    395c:	e8 c3 21 00 00       	call   5b24 <nel::SliceIterator<int>::SliceIterator(nel::SliceIterator<int>&&)>
+    3961:	90                   	nop
+    3962:	c9                   	leave
+    3963:	c3                   	ret
+
+0000000000003964 <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::FirstNIterator(nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&&, unsigned long)>:
+        constexpr FirstNIterator(It &&inner, Length limit)
+    3964:	55                   	push   %rbp
+    3965:	48 89 e5             	mov    %rsp,%rbp
+    3968:	53                   	push   %rbx
+    3969:	48 83 ec 28          	sub    $0x28,%rsp
+    396d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3971:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    3975:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            : inner_(move(inner))
+    3979:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    397d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3981:	48 89 c7             	mov    %rax,%rdi
+    3984:	e8 a7 ff ff ff       	call   3930 <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&& nel::move<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >(nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&)>
+    3989:	48 89 c6             	mov    %rax,%rsi
+    398c:	48 89 df             	mov    %rbx,%rdi
+    398f:	e8 aa ff ff ff       	call   393e <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::MappingIterator(nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>&&)>
+            , current_(0)
+    3994:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3998:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+    399f:	00 
+            , limit_(limit)
+    39a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    39a4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    39a8:	48 89 50 20          	mov    %rdx,0x20(%rax)
+        }
+    39ac:	90                   	nop
+    39ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    39b1:	c9                   	leave
+    39b2:	c3                   	ret
+    39b3:	90                   	nop
+
+00000000000039b4 <nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::self()>:
+        constexpr ItT &self(void)
+    39b4:	55                   	push   %rbp
+    39b5:	48 89 e5             	mov    %rsp,%rbp
+    39b8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    39bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    39c0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    39c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    39c8:	5d                   	pop    %rbp
+    39c9:	c3                   	ret
+
+00000000000039ca <void nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::for_each2<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold2<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)>:
+        void for_each2(F &&fn)
+    39ca:	       55                   	push   %rbp
+    39cb:	       48 89 e5             	mov    %rsp,%rbp
+    39ce:	       48 83 ec 10          	sub    $0x10,%rsp
+    39d2:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    39d6:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            for (; !self().is_done(); self().inc()) {
+    39da:	   /-- eb 3a                	jmp    3a16 <void nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::for_each2<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold2<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)+0x4c>
+                fn(self().deref());
+    39dc:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    39e0:	|  |   48 89 c7             	mov    %rax,%rdi
+    39e3:	|  |   e8 cc ff ff ff       	call   39b4 <nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::self()>
+    39e8:	|  |   48 89 c7             	mov    %rax,%rdi
+    39eb:	|  |   e8 84 05 00 00       	call   3f74 <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::deref()>
+    39f0:	|  |   48 89 c2             	mov    %rax,%rdx
+    39f3:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    39f7:	|  |   48 89 d6             	mov    %rdx,%rsi
+    39fa:	|  |   48 89 c7             	mov    %rax,%rdi
+    39fd:	|  |   e8 2a f0 ff ff       	call   2a2c <nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold2<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}::operator()(unsigned long) const>
+            for (; !self().is_done(); self().inc()) {
+    3a02:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a06:	|  |   48 89 c7             	mov    %rax,%rdi
+    3a09:	|  |   e8 a6 ff ff ff       	call   39b4 <nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::self()>
+    3a0e:	|  |   48 89 c7             	mov    %rax,%rdi
+    3a11:	|  |   e8 2e 05 00 00       	call   3f44 <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::inc()>
+    3a16:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a1a:	|      48 89 c7             	mov    %rax,%rdi
+    3a1d:	|      e8 92 ff ff ff       	call   39b4 <nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::self()>
+    3a22:	|      48 89 c7             	mov    %rax,%rdi
+    3a25:	|      e8 fa 04 00 00       	call   3f24 <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::is_done() const>
+    3a2a:	|      83 f0 01             	xor    $0x1,%eax
+    3a2d:	|      84 c0                	test   %al,%al
+    3a2f:	\----- 75 ab                	jne    39dc <void nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::for_each2<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold2<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)+0x12>
+        }
+    3a31:	       90                   	nop
+    3a32:	       90                   	nop
+    3a33:	       c9                   	leave
+    3a34:	       c3                   	ret
+
+0000000000003a35 <unsigned long bench::time_ns<run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)::{lambda()#1}>(bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)>:
+long unsigned int time_ns(F &&f)
+    3a35:	55                   	push   %rbp
+    3a36:	48 89 e5             	mov    %rsp,%rbp
+    3a39:	48 83 ec 20          	sub    $0x20,%rsp
+    3a3d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    3a41:	e8 6c 07 00 00       	call   41b2 <bench::now_ns()>
+    3a46:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    3a4a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3a4e:	48 89 c7             	mov    %rax,%rdi
+    3a51:	e8 64 f0 ff ff       	call   2aba <run<bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    3a56:	e8 57 07 00 00       	call   41b2 <bench::now_ns()>
+    3a5b:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    3a5f:	c9                   	leave
+    3a60:	c3                   	ret
+
+0000000000003a61 <unsigned long bench::time_ns<run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)>:
+long unsigned int time_ns(F &&f)
+    3a61:	55                   	push   %rbp
+    3a62:	48 89 e5             	mov    %rsp,%rbp
+    3a65:	48 83 ec 20          	sub    $0x20,%rsp
+    3a69:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    3a6d:	e8 40 07 00 00       	call   41b2 <bench::now_ns()>
+    3a72:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    3a76:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3a7a:	48 89 c7             	mov    %rax,%rdi
+    3a7d:	e8 46 f1 ff ff       	call   2bc8 <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    3a82:	e8 2b 07 00 00       	call   41b2 <bench::now_ns()>
+    3a87:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    3a8b:	c9                   	leave
+    3a8c:	c3                   	ret
+    3a8d:	90                   	nop
+
+0000000000003a8e <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)>:
+        void for_each(F &&fn)
+    3a8e:	          55                   	push   %rbp
+    3a8f:	          48 89 e5             	mov    %rsp,%rbp
+    3a92:	          53                   	push   %rbx
+    3a93:	          48 83 ec 48          	sub    $0x48,%rsp
+    3a97:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    3a9b:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+                Optional<OutT> r = self().next();
+    3a9f:	/-------> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3aa3:	|         48 89 c7             	mov    %rax,%rdi
+    3aa6:	|         e8 0f 17 00 00       	call   51ba <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    3aab:	|         48 89 c2             	mov    %rax,%rdx
+    3aae:	|         48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3ab2:	|         48 89 d6             	mov    %rdx,%rsi
+    3ab5:	|         48 89 c7             	mov    %rax,%rdi
+    3ab8:	|         e8 13 17 00 00       	call   51d0 <nel::SliceIterator<int>::next()>
+                if (r.is_none()) { break; }
+    3abd:	|         48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3ac1:	|         48 89 c7             	mov    %rax,%rdi
+    3ac4:	|         e8 d5 0b 00 00       	call   469e <nel::Optional<int&>::is_none() const>
+    3ac9:	|         84 c0                	test   %al,%al
+    3acb:	|     /-- 74 07                	je     3ad4 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)+0x46>
+    3acd:	|     |   bb 00 00 00 00       	mov    $0x0,%ebx
+    3ad2:	|  /--|-- eb 49                	jmp    3b1d <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)+0x8f>
+                fn(r.unwrap());
+    3ad4:	|  |  \-> 48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    3ad8:	|  |      b9 ef 00 00 00       	mov    $0xef,%ecx
+    3add:	|  |      48 8d 15 1c 48 00 00 	lea    0x481c(%rip),%rdx        # 8300 <queue_len+0x120>
+    3ae4:	|  |      48 8d 35 bd 48 00 00 	lea    0x48bd(%rip),%rsi        # 83a8 <queue_len+0x1c8>
+    3aeb:	|  |      48 89 c7             	mov    %rax,%rdi
+    3aee:	|  |      e8 3b 08 00 00       	call   432e <nel::Context::Context(char const*, char const*, int)>
+    3af3:	|  |      48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    3af7:	|  |      48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3afb:	|  |      48 89 d6             	mov    %rdx,%rsi
+    3afe:	|  |      48 89 c7             	mov    %rax,%rdi
+    3b01:	|  |      e8 a2 0e 00 00       	call   49a8 <nel::Optional<int&>::unwrap(nel::Context const&)>
+    3b06:	|  |      48 89 c2             	mov    %rax,%rdx
+    3b09:	|  |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3b0d:	|  |      48 89 d6             	mov    %rdx,%rsi
+    3b10:	|  |      48 89 c7             	mov    %rax,%rdi
+    3b13:	|  |      e8 60 dc ff ff       	call   1778 <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}::operator()(int const&) const>
+            while (true) {
+    3b18:	|  |      bb 01 00 00 00       	mov    $0x1,%ebx
+    3b1d:	|  \----> 48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3b21:	|         48 89 c7             	mov    %rax,%rdi
+    3b24:	|         e8 e3 0d 00 00       	call   490c <nel::Optional<int&>::~Optional()>
+    3b29:	|         83 fb 01             	cmp    $0x1,%ebx
+    3b2c:	|     /-- 75 05                	jne    3b33 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)+0xa5>
+    3b2e:	\-----|-- e9 6c ff ff ff       	jmp    3a9f <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)+0x11>
+        }
+    3b33:	      \-> 90                   	nop
+    3b34:	          48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3b38:	          c9                   	leave
+    3b39:	          c3                   	ret
+
+0000000000003b3a <unsigned long bench::time_ns<run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)::{lambda()#1}>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)>:
+long unsigned int time_ns(F &&f)
+    3b3a:	55                   	push   %rbp
+    3b3b:	48 89 e5             	mov    %rsp,%rbp
+    3b3e:	48 83 ec 20          	sub    $0x20,%rsp
+    3b42:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    3b46:	e8 67 06 00 00       	call   41b2 <bench::now_ns()>
+    3b4b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    3b4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3b53:	48 89 c7             	mov    %rax,%rdi
+    3b56:	e8 b9 f1 ff ff       	call   2d14 <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    3b5b:	e8 52 06 00 00       	call   41b2 <bench::now_ns()>
+    3b60:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    3b64:	c9                   	leave
+    3b65:	c3                   	ret
+
+0000000000003b66 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each2<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)>:
+        void for_each2(F &&fn)
+    3b66:	       55                   	push   %rbp
+    3b67:	       48 89 e5             	mov    %rsp,%rbp
+    3b6a:	       48 83 ec 10          	sub    $0x10,%rsp
+    3b6e:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3b72:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            for (; !self().is_done(); self().inc()) {
+    3b76:	   /-- eb 3a                	jmp    3bb2 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each2<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)+0x4c>
+                fn(self().deref());
+    3b78:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3b7c:	|  |   48 89 c7             	mov    %rax,%rdi
+    3b7f:	|  |   e8 36 16 00 00       	call   51ba <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    3b84:	|  |   48 89 c7             	mov    %rax,%rdi
+    3b87:	|  |   e8 e0 16 00 00       	call   526c <nel::SliceIterator<int>::deref()>
+    3b8c:	|  |   48 89 c2             	mov    %rax,%rdx
+    3b8f:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3b93:	|  |   48 89 d6             	mov    %rdx,%rsi
+    3b96:	|  |   48 89 c7             	mov    %rax,%rdi
+    3b99:	|  |   e8 de dc ff ff       	call   187c <bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}::operator()(int const&) const>
+            for (; !self().is_done(); self().inc()) {
+    3b9e:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3ba2:	|  |   48 89 c7             	mov    %rax,%rdi
+    3ba5:	|  |   e8 10 16 00 00       	call   51ba <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    3baa:	|  |   48 89 c7             	mov    %rax,%rdi
+    3bad:	|  |   e8 9c 16 00 00       	call   524e <nel::SliceIterator<int>::inc()>
+    3bb2:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3bb6:	|      48 89 c7             	mov    %rax,%rdi
+    3bb9:	|      e8 fc 15 00 00       	call   51ba <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    3bbe:	|      48 89 c7             	mov    %rax,%rdi
+    3bc1:	|      e8 4e 09 00 00       	call   4514 <nel::SliceIterator<int>::is_done() const>
+    3bc6:	|      83 f0 01             	xor    $0x1,%eax
+    3bc9:	|      84 c0                	test   %al,%al
+    3bcb:	\----- 75 ab                	jne    3b78 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each2<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)+0x12>
+        }
+    3bcd:	       90                   	nop
+    3bce:	       90                   	nop
+    3bcf:	       c9                   	leave
+    3bd0:	       c3                   	ret
+
+0000000000003bd1 <unsigned long bench::time_ns<run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)::{lambda()#1}>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)>:
+long unsigned int time_ns(F &&f)
+    3bd1:	55                   	push   %rbp
+    3bd2:	48 89 e5             	mov    %rsp,%rbp
+    3bd5:	48 83 ec 20          	sub    $0x20,%rsp
+    3bd9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    3bdd:	e8 d0 05 00 00       	call   41b2 <bench::now_ns()>
+    3be2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    3be6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3bea:	48 89 c7             	mov    %rax,%rdi
+    3bed:	e8 6e f2 ff ff       	call   2e60 <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    3bf2:	e8 bb 05 00 00       	call   41b2 <bench::now_ns()>
+    3bf7:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    3bfb:	c9                   	leave
+    3bfc:	c3                   	ret
+
+0000000000003bfd <unsigned long bench::time_ns<run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}&&)::{lambda()#1}>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}&&)>:
+long unsigned int time_ns(F &&f)
+    3bfd:	55                   	push   %rbp
+    3bfe:	48 89 e5             	mov    %rsp,%rbp
+    3c01:	48 83 ec 20          	sub    $0x20,%rsp
+    3c05:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    3c09:	e8 a4 05 00 00       	call   41b2 <bench::now_ns()>
+    3c0e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    3c12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3c16:	48 89 c7             	mov    %rax,%rdi
+    3c19:	e8 50 f3 ff ff       	call   2f6e <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#4}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    3c1e:	e8 8f 05 00 00       	call   41b2 <bench::now_ns()>
+    3c23:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    3c27:	c9                   	leave
+    3c28:	c3                   	ret
+
+0000000000003c29 <unsigned long bench::time_ns<run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}&&)::{lambda()#1}>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}&&)>:
+long unsigned int time_ns(F &&f)
+    3c29:	55                   	push   %rbp
+    3c2a:	48 89 e5             	mov    %rsp,%rbp
+    3c2d:	48 83 ec 20          	sub    $0x20,%rsp
+    3c31:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    3c35:	e8 78 05 00 00       	call   41b2 <bench::now_ns()>
+    3c3a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    3c3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3c42:	48 89 c7             	mov    %rax,%rdi
+    3c45:	e8 32 f4 ff ff       	call   307c <run<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}>(char const*, nel::Slice<int> const&, bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#5}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    3c4a:	e8 63 05 00 00       	call   41b2 <bench::now_ns()>
+    3c4f:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    3c53:	c9                   	leave
+    3c54:	c3                   	ret
+
+0000000000003c55 <unsigned long bench::time_ns<run<bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}>(bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)>:
+long unsigned int time_ns(F &&f)
+    3c55:	55                   	push   %rbp
+    3c56:	48 89 e5             	mov    %rsp,%rbp
+    3c59:	48 83 ec 20          	sub    $0x20,%rsp
+    3c5d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    3c61:	e8 4c 05 00 00       	call   41b2 <bench::now_ns()>
+    3c66:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    3c6a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3c6e:	48 89 c7             	mov    %rax,%rdi
+    3c71:	e8 14 f5 ff ff       	call   318a <run<bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, bench_queue(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    3c76:	e8 37 05 00 00       	call   41b2 <bench::now_ns()>
+    3c7b:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    3c7f:	c9                   	leave
+    3c80:	c3                   	ret
+    3c81:	90                   	nop
+
+0000000000003c82 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&)>:
+        void for_each(F &&fn)
+    3c82:	          55                   	push   %rbp
+    3c83:	          48 89 e5             	mov    %rsp,%rbp
+    3c86:	          53                   	push   %rbx
+    3c87:	          48 83 ec 48          	sub    $0x48,%rsp
+    3c8b:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    3c8f:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+                Optional<OutT> r = self().next();
+    3c93:	/-------> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3c97:	|         48 89 c7             	mov    %rax,%rdi
+    3c9a:	|         e8 1b 15 00 00       	call   51ba <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    3c9f:	|         48 89 c2             	mov    %rax,%rdx
+    3ca2:	|         48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3ca6:	|         48 89 d6             	mov    %rdx,%rsi
+    3ca9:	|         48 89 c7             	mov    %rax,%rdi
+    3cac:	|         e8 1f 15 00 00       	call   51d0 <nel::SliceIterator<int>::next()>
+                if (r.is_none()) { break; }
+    3cb1:	|         48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3cb5:	|         48 89 c7             	mov    %rax,%rdi
+    3cb8:	|         e8 e1 09 00 00       	call   469e <nel::Optional<int&>::is_none() const>
+    3cbd:	|         84 c0                	test   %al,%al
+    3cbf:	|     /-- 74 07                	je     3cc8 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&)+0x46>
+    3cc1:	|     |   bb 00 00 00 00       	mov    $0x0,%ebx
+    3cc6:	|  /--|-- eb 49                	jmp    3d11 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&)+0x8f>
+                fn(r.unwrap());
+    3cc8:	|  |  \-> 48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    3ccc:	|  |      b9 ef 00 00 00       	mov    $0xef,%ecx
+    3cd1:	|  |      48 8d 15 28 46 00 00 	lea    0x4628(%rip),%rdx        # 8300 <queue_len+0x120>
+    3cd8:	|  |      48 8d 35 89 47 00 00 	lea    0x4789(%rip),%rsi        # 8468 <queue_len+0x288>
+    3cdf:	|  |      48 89 c7             	mov    %rax,%rdi
+    3ce2:	|  |      e8 47 06 00 00       	call   432e <nel::Context::Context(char const*, char const*, int)>
+    3ce7:	|  |      48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    3ceb:	|  |      48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3cef:	|  |      48 89 d6             	mov    %rdx,%rsi
+    3cf2:	|  |      48 89 c7             	mov    %rax,%rdi
+    3cf5:	|  |      e8 ae 0c 00 00       	call   49a8 <nel::Optional<int&>::unwrap(nel::Context const&)>
+    3cfa:	|  |      48 89 c2             	mov    %rax,%rdx
+    3cfd:	|  |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3d01:	|  |      48 89 d6             	mov    %rdx,%rsi
+    3d04:	|  |      48 89 c7             	mov    %rax,%rdi
+    3d07:	|  |      e8 c2 df ff ff       	call   1cce <bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}::operator()(int const&) const>
+            while (true) {
+    3d0c:	|  |      bb 01 00 00 00       	mov    $0x1,%ebx
+    3d11:	|  \----> 48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3d15:	|         48 89 c7             	mov    %rax,%rdi
+    3d18:	|         e8 ef 0b 00 00       	call   490c <nel::Optional<int&>::~Optional()>
+    3d1d:	|         83 fb 01             	cmp    $0x1,%ebx
+    3d20:	|     /-- 75 05                	jne    3d27 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&)+0xa5>
+    3d22:	\-----|-- e9 6c ff ff ff       	jmp    3c93 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&)+0x11>
+        }
+    3d27:	      \-> 90                   	nop
+    3d28:	          48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3d2c:	          c9                   	leave
+    3d2d:	          c3                   	ret
+
+0000000000003d2e <unsigned long bench::time_ns<run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}&&)::{lambda()#1}>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}&&)>:
+long unsigned int time_ns(F &&f)
+    3d2e:	55                   	push   %rbp
+    3d2f:	48 89 e5             	mov    %rsp,%rbp
+    3d32:	48 83 ec 20          	sub    $0x20,%rsp
+    3d36:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    3d3a:	e8 73 04 00 00       	call   41b2 <bench::now_ns()>
+    3d3f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    3d43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3d47:	48 89 c7             	mov    %rax,%rdi
+    3d4a:	e8 87 f5 ff ff       	call   32d6 <run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    3d4f:	e8 5e 04 00 00       	call   41b2 <bench::now_ns()>
+    3d54:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    3d58:	c9                   	leave
+    3d59:	c3                   	ret
+
+0000000000003d5a <bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&& nel::forward<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&)>:
+constexpr U &&forward(T &t)
+    3d5a:	55                   	push   %rbp
+    3d5b:	48 89 e5             	mov    %rsp,%rbp
+    3d5e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    3d62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3d66:	5d                   	pop    %rbp
+    3d67:	c3                   	ret
+
+0000000000003d68 <nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::MappingIterator(nel::ChainIterator<nel::SliceIterator<int> >&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&&)>:
+        constexpr MappingIterator(It &&inner, FnT &&fn)
+    3d68:	55                   	push   %rbp
+    3d69:	48 89 e5             	mov    %rsp,%rbp
+    3d6c:	53                   	push   %rbx
+    3d6d:	48 83 ec 28          	sub    $0x28,%rsp
+    3d71:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3d75:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    3d79:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            : inner_(move(inner))
+    3d7d:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    3d81:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3d85:	48 89 c7             	mov    %rax,%rdi
+    3d88:	e8 f5 19 00 00       	call   5782 <nel::ChainIterator<nel::SliceIterator<int> >&& nel::move<nel::ChainIterator<nel::SliceIterator<int> > >(nel::ChainIterator<nel::SliceIterator<int> >&)>
+    3d8d:	48 89 c6             	mov    %rax,%rsi
+    3d90:	48 89 df             	mov    %rbx,%rdi
+    3d93:	e8 f8 19 00 00       	call   5790 <nel::ChainIterator<nel::SliceIterator<int> >::ChainIterator(nel::ChainIterator<nel::SliceIterator<int> >&&)>
+            , fn_(forward<FnT>(fn))
+    3d98:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3d9c:	48 89 c7             	mov    %rax,%rdi
+    3d9f:	e8 b6 ff ff ff       	call   3d5a <bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&& nel::forward<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&)>
+        }
+    3da4:	90                   	nop
+    3da5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3da9:	c9                   	leave
+    3daa:	c3                   	ret
+    3dab:	90                   	nop
+
+0000000000003dac <nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::self()>:
+        constexpr ItT &self(void)
+    3dac:	55                   	push   %rbp
+    3dad:	48 89 e5             	mov    %rsp,%rbp
+    3db0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    3db4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3db8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    3dbc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    3dc0:	5d                   	pop    %rbp
+    3dc1:	c3                   	ret
+
+0000000000003dc2 <nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::for_each<nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(int&)#1}::operator()(int&) const>:
+            inner_.for_each([this, &fn](typename It::OutT e) { fn(fn_(e)); });
+    3dc2:	55                   	push   %rbp
+    3dc3:	48 89 e5             	mov    %rsp,%rbp
+    3dc6:	53                   	push   %rbx
+    3dc7:	48 83 ec 10          	sub    $0x10,%rsp
+    3dcb:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+    3dcf:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    3dd3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3dd7:	48 8b 58 08          	mov    0x8(%rax),%rbx
+    3ddb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3ddf:	48 8b 00             	mov    (%rax),%rax
+    3de2:	48 8d 50 20          	lea    0x20(%rax),%rdx
+    3de6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3dea:	48 89 c6             	mov    %rax,%rsi
+    3ded:	48 89 d7             	mov    %rdx,%rdi
+    3df0:	e8 55 df ff ff       	call   1d4a <bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}::operator()(int const&) const>
+    3df5:	48 89 c6             	mov    %rax,%rsi
+    3df8:	48 89 df             	mov    %rbx,%rdi
+    3dfb:	e8 04 f6 ff ff       	call   3404 <nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}::operator()(unsigned long) const>
+    3e00:	90                   	nop
+    3e01:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3e05:	c9                   	leave
+    3e06:	c3                   	ret
+    3e07:	90                   	nop
+
+0000000000003e08 <void nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::for_each<nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)>:
+        void for_each(F &&fn)
+    3e08:	55                   	push   %rbp
+    3e09:	48 89 e5             	mov    %rsp,%rbp
+    3e0c:	48 83 ec 20          	sub    $0x20,%rsp
+    3e10:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3e14:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            inner_.for_each([this, &fn](typename It::OutT e) { fn(fn_(e)); });
+    3e18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3e1c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3e20:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    3e24:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    3e28:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    3e2c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    3e30:	48 89 d6             	mov    %rdx,%rsi
+    3e33:	48 89 c7             	mov    %rax,%rdi
+    3e36:	e8 53 01 00 00       	call   3f8e <void nel::ChainIterator<nel::SliceIterator<int> >::for_each<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::for_each<nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(int&)#1}>(unsigned long&&)>
+        }
+    3e3b:	90                   	nop
+    3e3c:	c9                   	leave
+    3e3d:	c3                   	ret
+
+0000000000003e3e <unsigned long bench::time_ns<run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}&&)::{lambda()#1}>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}&&)>:
+long unsigned int time_ns(F &&f)
+    3e3e:	55                   	push   %rbp
+    3e3f:	48 89 e5             	mov    %rsp,%rbp
+    3e42:	48 83 ec 20          	sub    $0x20,%rsp
+    3e46:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    3e4a:	e8 63 03 00 00       	call   41b2 <bench::now_ns()>
+    3e4f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    3e53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3e57:	48 89 c7             	mov    %rax,%rdi
+    3e5a:	e8 33 f6 ff ff       	call   3492 <run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    3e5f:	e8 4e 03 00 00       	call   41b2 <bench::now_ns()>
+    3e64:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    3e68:	c9                   	leave
+    3e69:	c3                   	ret
+
+0000000000003e6a <unsigned long bench::time_ns<run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}&&)::{lambda()#1}>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}&&)>:
+long unsigned int time_ns(F &&f)
+    3e6a:	55                   	push   %rbp
+    3e6b:	48 89 e5             	mov    %rsp,%rbp
+    3e6e:	48 83 ec 20          	sub    $0x20,%rsp
+    3e72:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    3e76:	e8 37 03 00 00       	call   41b2 <bench::now_ns()>
+    3e7b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    3e7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3e83:	48 89 c7             	mov    %rax,%rdi
+    3e86:	e8 dd f6 ff ff       	call   3568 <run_queue<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}>(char const*, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#4}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    3e8b:	e8 22 03 00 00       	call   41b2 <bench::now_ns()>
+    3e90:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    3e94:	c9                   	leave
+    3e95:	c3                   	ret
+
+0000000000003e96 <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(bool&, unsigned long)#1}>(unsigned long&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(bool&, int&)#1}::operator()(bool&, int&) const>:
+                acc, [this, &fn](U &a, typename It::OutT e) { return fn(a, fn_(e)); });
+    3e96:	55                   	push   %rbp
+    3e97:	48 89 e5             	mov    %rsp,%rbp
+    3e9a:	53                   	push   %rbx
+    3e9b:	48 83 ec 18          	sub    $0x18,%rsp
+    3e9f:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+    3ea3:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    3ea7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    3eab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3eaf:	48 8b 58 08          	mov    0x8(%rax),%rbx
+    3eb3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3eb7:	48 8b 00             	mov    (%rax),%rax
+    3eba:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    3ebe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3ec2:	48 89 c6             	mov    %rax,%rsi
+    3ec5:	48 89 d7             	mov    %rdx,%rdi
+    3ec8:	e8 f5 d5 ff ff       	call   14c2 <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}::operator()(int const&) const>
+    3ecd:	48 89 c2             	mov    %rax,%rdx
+    3ed0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3ed4:	48 89 c6             	mov    %rax,%rsi
+    3ed7:	48 89 df             	mov    %rbx,%rdi
+    3eda:	e8 11 f9 ff ff       	call   37f0 <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(bool&, unsigned long)#1}::operator()(bool&, unsigned long) const>
+    3edf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3ee3:	c9                   	leave
+    3ee4:	c3                   	ret
+    3ee5:	90                   	nop
+
+0000000000003ee6 <bool nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(bool&, unsigned long)#1}>(unsigned long&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)>:
+        bool try_fold(U &acc, F &&fn)
+    3ee6:	55                   	push   %rbp
+    3ee7:	48 89 e5             	mov    %rsp,%rbp
+    3eea:	48 83 ec 30          	sub    $0x30,%rsp
+    3eee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3ef2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    3ef6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            return inner_.try_fold(
+    3efa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+                acc, [this, &fn](U &a, typename It::OutT e) { return fn(a, fn_(e)); });
+    3efe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3f02:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    3f06:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    3f0a:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+            return inner_.try_fold(
+    3f0e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    3f12:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    3f16:	48 89 ce             	mov    %rcx,%rsi
+    3f19:	48 89 c7             	mov    %rax,%rdi
+    3f1c:	e8 ab 00 00 00       	call   3fcc <bool nel::Iterator<nel::SliceIterator<int>, int&, int&>::try_fold<bool, nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(bool&, unsigned long)#1}>(unsigned long&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(bool&, int&)#1}>(unsigned long&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)>
+        }
+    3f21:	c9                   	leave
+    3f22:	c3                   	ret
+    3f23:	90                   	nop
+
+0000000000003f24 <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::is_done() const>:
+        constexpr bool is_done(void) const
+    3f24:	55                   	push   %rbp
+    3f25:	48 89 e5             	mov    %rsp,%rbp
+    3f28:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (current_ >= limit_);
+    3f2c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f30:	48 8b 50 18          	mov    0x18(%rax),%rdx
+    3f34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f38:	48 8b 40 20          	mov    0x20(%rax),%rax
+    3f3c:	48 39 c2             	cmp    %rax,%rdx
+    3f3f:	0f 93 c0             	setae  %al
+        }
+    3f42:	5d                   	pop    %rbp
+    3f43:	c3                   	ret
+
+0000000000003f44 <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::inc()>:
+        void inc(void)
+    3f44:	55                   	push   %rbp
+    3f45:	48 89 e5             	mov    %rsp,%rbp
+    3f48:	48 83 ec 10          	sub    $0x10,%rsp
+    3f4c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            inner_.inc();
+    3f50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f54:	48 89 c7             	mov    %rax,%rdi
+    3f57:	e8 04 01 00 00       	call   4060 <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::inc()>
+            ++current_;
+    3f5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f60:	48 8b 40 18          	mov    0x18(%rax),%rax
+    3f64:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    3f68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f6c:	48 89 50 18          	mov    %rdx,0x18(%rax)
+        }
+    3f70:	90                   	nop
+    3f71:	c9                   	leave
+    3f72:	c3                   	ret
+    3f73:	90                   	nop
+
+0000000000003f74 <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::deref()>:
+        OutT deref(void)
+    3f74:	55                   	push   %rbp
+    3f75:	48 89 e5             	mov    %rsp,%rbp
+    3f78:	48 83 ec 10          	sub    $0x10,%rsp
+    3f7c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return inner_.deref();
+    3f80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f84:	48 89 c7             	mov    %rax,%rdi
+    3f87:	e8 f0 00 00 00       	call   407c <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::deref()>
+        }
+    3f8c:	c9                   	leave
+    3f8d:	c3                   	ret
+
+0000000000003f8e <void nel::ChainIterator<nel::SliceIterator<int> >::for_each<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::for_each<nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(int&)#1}>(unsigned long&&)>:
+        void for_each(F &&fn)
+    3f8e:	55                   	push   %rbp
+    3f8f:	48 89 e5             	mov    %rsp,%rbp
+    3f92:	48 83 ec 10          	sub    $0x10,%rsp
+    3f96:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3f9a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            it1_.for_each(fn);
+    3f9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3fa2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3fa6:	48 89 d6             	mov    %rdx,%rsi
+    3fa9:	48 89 c7             	mov    %rax,%rdi
+    3fac:	e8 fd 00 00 00       	call   40ae <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::for_each<nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(int&)#1}&>(unsigned long&&)>
+            it2_.for_each(fn);
+    3fb1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3fb5:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    3fb9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3fbd:	48 89 c6             	mov    %rax,%rsi
+    3fc0:	48 89 d7             	mov    %rdx,%rdi
+    3fc3:	e8 e6 00 00 00       	call   40ae <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::for_each<nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(int&)#1}&>(unsigned long&&)>
+        }
+    3fc8:	90                   	nop
+    3fc9:	c9                   	leave
+    3fca:	c3                   	ret
+    3fcb:	90                   	nop
+
+0000000000003fcc <bool nel::Iterator<nel::SliceIterator<int>, int&, int&>::try_fold<bool, nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(bool&, unsigned long)#1}>(unsigned long&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(bool&, int&)#1}>(unsigned long&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)>:
+        bool try_fold(U &acc, F &&fn)
+    3fcc:	          55                   	push   %rbp
+    3fcd:	          48 89 e5             	mov    %rsp,%rbp
+    3fd0:	          48 83 ec 30          	sub    $0x30,%rsp
+    3fd4:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3fd8:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    3fdc:	          48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            while (!self().is_done()) {
+    3fe0:	   /----- eb 5c                	jmp    403e <bool nel::Iterator<nel::SliceIterator<int>, int&, int&>::try_fold<bool, nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(bool&, unsigned long)#1}>(unsigned long&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(bool&, int&)#1}>(unsigned long&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)+0x72>
+                OutT e = self().deref();
+    3fe2:	/--|----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3fe6:	|  |      48 89 c7             	mov    %rax,%rdi
+    3fe9:	|  |      e8 cc 11 00 00       	call   51ba <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    3fee:	|  |      48 89 c7             	mov    %rax,%rdi
+    3ff1:	|  |      e8 76 12 00 00       	call   526c <nel::SliceIterator<int>::deref()>
+    3ff6:	|  |      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                self().inc();
+    3ffa:	|  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3ffe:	|  |      48 89 c7             	mov    %rax,%rdi
+    4001:	|  |      e8 b4 11 00 00       	call   51ba <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    4006:	|  |      48 89 c7             	mov    %rax,%rdi
+    4009:	|  |      e8 40 12 00 00       	call   524e <nel::SliceIterator<int>::inc()>
+                if (!fn(acc, forward<OutT>(e))) { return false; }
+    400e:	|  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4012:	|  |      48 89 c7             	mov    %rax,%rdi
+    4015:	|  |      e8 99 1b 00 00       	call   5bb3 <int& nel::forward<int&, int>(int&)>
+    401a:	|  |      48 89 c2             	mov    %rax,%rdx
+    401d:	|  |      48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    4021:	|  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4025:	|  |      48 89 ce             	mov    %rcx,%rsi
+    4028:	|  |      48 89 c7             	mov    %rax,%rdi
+    402b:	|  |      e8 66 fe ff ff       	call   3e96 <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(bool&, unsigned long)#1}>(unsigned long&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(bool&, int&)#1}::operator()(bool&, int&) const>
+    4030:	|  |      83 f0 01             	xor    $0x1,%eax
+    4033:	|  |      84 c0                	test   %al,%al
+    4035:	|  +----- 74 07                	je     403e <bool nel::Iterator<nel::SliceIterator<int>, int&, int&>::try_fold<bool, nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(bool&, unsigned long)#1}>(unsigned long&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(bool&, int&)#1}>(unsigned long&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)+0x72>
+    4037:	|  |      b8 00 00 00 00       	mov    $0x0,%eax
+    403c:	|  |  /-- eb 20                	jmp    405e <bool nel::Iterator<nel::SliceIterator<int>, int&, int&>::try_fold<bool, nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(bool&, unsigned long)#1}>(unsigned long&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(bool&, int&)#1}>(unsigned long&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)+0x92>
+            while (!self().is_done()) {
+    403e:	|  \--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4042:	|     |   48 89 c7             	mov    %rax,%rdi
+    4045:	|     |   e8 70 11 00 00       	call   51ba <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    404a:	|     |   48 89 c7             	mov    %rax,%rdi
+    404d:	|     |   e8 c2 04 00 00       	call   4514 <nel::SliceIterator<int>::is_done() const>
+    4052:	|     |   83 f0 01             	xor    $0x1,%eax
+    4055:	|     |   84 c0                	test   %al,%al
+    4057:	\-----|-- 75 89                	jne    3fe2 <bool nel::Iterator<nel::SliceIterator<int>, int&, int&>::try_fold<bool, nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}> >, int&, unsigned long>::fold<unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(bool&, unsigned long)#1}>(unsigned long&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(bool&, int&)#1}>(unsigned long&, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)+0x16>
+            return true;
+    4059:	      |   b8 01 00 00 00       	mov    $0x1,%eax
+        }
+    405e:	      \-> c9                   	leave
+    405f:	          c3                   	ret
+
+0000000000004060 <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::inc()>:
+        void inc(void)
+    4060:	55                   	push   %rbp
+    4061:	48 89 e5             	mov    %rsp,%rbp
+    4064:	48 83 ec 10          	sub    $0x10,%rsp
+    4068:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            inner_.inc();
+    406c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4070:	48 89 c7             	mov    %rax,%rdi
+    4073:	e8 d6 11 00 00       	call   524e <nel::SliceIterator<int>::inc()>
+        }
+    4078:	90                   	nop
+    4079:	c9                   	leave
+    407a:	c3                   	ret
+    407b:	90                   	nop
+
+000000000000407c <nel::MappingIterator<nel::SliceIterator<int>, unsigned long, bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}>::deref()>:
+        OutT deref(void)
+    407c:	55                   	push   %rbp
+    407d:	48 89 e5             	mov    %rsp,%rbp
+    4080:	53                   	push   %rbx
+    4081:	48 83 ec 18          	sub    $0x18,%rsp
+    4085:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            return fn_(inner_.deref());
+    4089:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    408d:	48 8d 58 10          	lea    0x10(%rax),%rbx
+    4091:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4095:	48 89 c7             	mov    %rax,%rdi
+    4098:	e8 cf 11 00 00       	call   526c <nel::SliceIterator<int>::deref()>
+    409d:	48 89 c6             	mov    %rax,%rsi
+    40a0:	48 89 df             	mov    %rbx,%rdi
+    40a3:	e8 dc d4 ff ff       	call   1584 <bench_map_first_n_fold(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#3}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}::operator()(int const&) const>
+        }
+    40a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    40ac:	c9                   	leave
+    40ad:	c3                   	ret
+
+00000000000040ae <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::for_each<nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(int&)#1}&>(unsigned long&&)>:
+        void for_each(F &&fn)
+    40ae:	          55                   	push   %rbp
+    40af:	          48 89 e5             	mov    %rsp,%rbp
+    40b2:	          53                   	push   %rbx
+    40b3:	          48 83 ec 48          	sub    $0x48,%rsp
+    40b7:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    40bb:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+                Optional<OutT> r = self().next();
+    40bf:	/-------> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    40c3:	|         48 89 c7             	mov    %rax,%rdi
+    40c6:	|         e8 ef 10 00 00       	call   51ba <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    40cb:	|         48 89 c2             	mov    %rax,%rdx
+    40ce:	|         48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    40d2:	|         48 89 d6             	mov    %rdx,%rsi
+    40d5:	|         48 89 c7             	mov    %rax,%rdi
+    40d8:	|         e8 f3 10 00 00       	call   51d0 <nel::SliceIterator<int>::next()>
+                if (r.is_none()) { break; }
+    40dd:	|         48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    40e1:	|         48 89 c7             	mov    %rax,%rdi
+    40e4:	|         e8 b5 05 00 00       	call   469e <nel::Optional<int&>::is_none() const>
+    40e9:	|         84 c0                	test   %al,%al
+    40eb:	|     /-- 74 07                	je     40f4 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::for_each<nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(int&)#1}&>(unsigned long&&)+0x46>
+    40ed:	|     |   bb 00 00 00 00       	mov    $0x0,%ebx
+    40f2:	|  /--|-- eb 49                	jmp    413d <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::for_each<nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(int&)#1}&>(unsigned long&&)+0x8f>
+                fn(r.unwrap());
+    40f4:	|  |  \-> 48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    40f8:	|  |      b9 ef 00 00 00       	mov    $0xef,%ecx
+    40fd:	|  |      48 8d 15 fc 41 00 00 	lea    0x41fc(%rip),%rdx        # 8300 <queue_len+0x120>
+    4104:	|  |      48 8d 35 dd 43 00 00 	lea    0x43dd(%rip),%rsi        # 84e8 <queue_len+0x308>
+    410b:	|  |      48 89 c7             	mov    %rax,%rdi
+    410e:	|  |      e8 1b 02 00 00       	call   432e <nel::Context::Context(char const*, char const*, int)>
+    4113:	|  |      48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    4117:	|  |      48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    411b:	|  |      48 89 d6             	mov    %rdx,%rsi
+    411e:	|  |      48 89 c7             	mov    %rax,%rdi
+    4121:	|  |      e8 82 08 00 00       	call   49a8 <nel::Optional<int&>::unwrap(nel::Context const&)>
+    4126:	|  |      48 89 c2             	mov    %rax,%rdx
+    4129:	|  |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    412d:	|  |      48 89 d6             	mov    %rdx,%rsi
+    4130:	|  |      48 89 c7             	mov    %rax,%rdi
+    4133:	|  |      e8 8a fc ff ff       	call   3dc2 <nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::for_each<nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(int&)#1}::operator()(int&) const>
+            while (true) {
+    4138:	|  |      bb 01 00 00 00       	mov    $0x1,%ebx
+    413d:	|  \----> 48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    4141:	|         48 89 c7             	mov    %rax,%rdi
+    4144:	|         e8 c3 07 00 00       	call   490c <nel::Optional<int&>::~Optional()>
+    4149:	|         83 fb 01             	cmp    $0x1,%ebx
+    414c:	|     /-- 75 05                	jne    4153 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::for_each<nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(int&)#1}&>(unsigned long&&)+0xa5>
+    414e:	\-----|-- e9 6c ff ff ff       	jmp    40bf <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::for_each<nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(int&)#1}&>(unsigned long&&)+0x11>
+        }
+    4153:	      \-> 90                   	nop
+    4154:	          48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    4158:	          c9                   	leave
+    4159:	          c3                   	ret
+
+000000000000415a <__static_initialization_and_destruction_0(int, int)>:
+}
+    415a:	    55                   	push   %rbp
+    415b:	    48 89 e5             	mov    %rsp,%rbp
+    415e:	    48 83 ec 10          	sub    $0x10,%rsp
+    4162:	    89 7d fc             	mov    %edi,-0x4(%rbp)
+    4165:	    89 75 f8             	mov    %esi,-0x8(%rbp)
+    4168:	    83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    416c:	/-- 75 2c                	jne    419a <__static_initialization_and_destruction_0(int, int)+0x40>
+    416e:	|   81 7d f8 ff ff 00 00 	cmpl   $0xffff,-0x8(%rbp)
+    4175:	+-- 75 23                	jne    419a <__static_initialization_and_destruction_0(int, int)+0x40>
+static Queue queue = Queue::empty();
+    4177:	|   48 8d 05 ea 8e 00 00 	lea    0x8eea(%rip),%rax        # d068 <__dso_handle>
+    417e:	|   48 89 c2             	mov    %rax,%rdx
+    4181:	|   48 8d 05 38 8f 00 00 	lea    0x8f38(%rip),%rax        # d0c0 <queue>
+    4188:	|   48 89 c6             	mov    %rax,%rsi
+    418b:	|   48 8d 05 90 08 00 00 	lea    0x890(%rip),%rax        # 4a22 <nel::heapless::Queue<int, 4096ul>::~Queue()>
+    4192:	|   48 89 c7             	mov    %rax,%rdi
+    4195:	|   e8 46 cf ff ff       	call   10e0 <__cxa_atexit@plt>
+}
+    419a:	\-> 90                   	nop
+    419b:	    c9                   	leave
+    419c:	    c3                   	ret
+
+000000000000419d <_GLOBAL__sub_I__close_r>:
+    419d:	55                   	push   %rbp
+    419e:	48 89 e5             	mov    %rsp,%rbp
+    41a1:	be ff ff 00 00       	mov    $0xffff,%esi
+    41a6:	bf 01 00 00 00       	mov    $0x1,%edi
+    41ab:	e8 aa ff ff ff       	call   415a <__static_initialization_and_destruction_0(int, int)>
+    41b0:	5d                   	pop    %rbp
+    41b1:	c3                   	ret
+
+00000000000041b2 <bench::now_ns()>:
+
+    41b2:	55                   	push   %rbp
+    41b3:	48 89 e5             	mov    %rsp,%rbp
+    41b6:	48 83 ec 10          	sub    $0x10,%rsp
+#include <nel/heapless/queue.hh>
+    41ba:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    41be:	48 89 c6             	mov    %rax,%rsi
+    41c1:	bf 01 00 00 00       	mov    $0x1,%edi
+    41c6:	e8 85 ce ff ff       	call   1050 <clock_gettime@plt>
+#include <nel/iterator.hh>
+    41cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    41cf:	48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+    41d6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    41da:	48 01 d0             	add    %rdx,%rax
+#include <nel/slice.hh>
+    41dd:	c9                   	leave
+    41de:	c3                   	ret
+
+00000000000041df <bench::report_per_item(char const*, unsigned long, unsigned long)>:
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    41df:	       55                   	push   %rbp
+    41e0:	       48 89 e5             	mov    %rsp,%rbp
+    41e3:	       48 83 ec 30          	sub    $0x30,%rsp
+    41e7:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    41eb:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    41ef:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    41f3:	       48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    41f8:	/----- 74 28                	je     4222 <bench::report_per_item(char const*, unsigned long, unsigned long)+0x43>
+    41fa:	|      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    41fe:	|      48 89 d0             	mov    %rdx,%rax
+    4201:	|      48 c1 e0 02          	shl    $0x2,%rax
+    4205:	|      48 01 d0             	add    %rdx,%rax
+    4208:	|      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    420f:	|      00 
+    4210:	|      48 01 d0             	add    %rdx,%rax
+    4213:	|      48 c1 e0 02          	shl    $0x2,%rax
+    4217:	|      ba 00 00 00 00       	mov    $0x0,%edx
+    421c:	|      48 f7 75 d8          	divq   -0x28(%rbp)
+    4220:	|  /-- eb 05                	jmp    4227 <bench::report_per_item(char const*, unsigned long, unsigned long)+0x48>
+    4222:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    4227:	   \-> 48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            r += f(s);
+    422b:	       48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    422f:	       48 89 c8             	mov    %rcx,%rax
+    4232:	       48 c1 e8 02          	shr    $0x2,%rax
+    4236:	       48 ba c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rdx
+    423d:	       c2 f5 28 
+    4240:	       48 f7 e2             	mul    %rdx
+    4243:	       48 c1 ea 02          	shr    $0x2,%rdx
+    4247:	       48 89 d0             	mov    %rdx,%rax
+    424a:	       48 c1 e0 02          	shl    $0x2,%rax
+    424e:	       48 01 d0             	add    %rdx,%rax
+    4251:	       48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    4258:	       00 
+    4259:	       48 01 d0             	add    %rdx,%rax
+    425c:	       48 c1 e0 02          	shl    $0x2,%rax
+    4260:	       48 29 c1             	sub    %rax,%rcx
+    4263:	       48 89 ca             	mov    %rcx,%rdx
+    4266:	       48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    });
+    426a:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    426e:	       48 89 c6             	mov    %rax,%rsi
+    4271:	       48 8d 05 60 ce 00 00 	lea    0xce60(%rip),%rax        # 110d8 <nel::log>
+    4278:	       48 89 c7             	mov    %rax,%rdi
+    427b:	       e8 a7 2e 00 00       	call   7127 <nel::operator<<(nel::Log&, char const*)>
+    4280:	       48 89 c2             	mov    %rax,%rdx
+    4283:	       48 8d 05 96 3d 00 00 	lea    0x3d96(%rip),%rax        # 8020 <_IO_stdin_used+0x20>
+    428a:	       48 89 c6             	mov    %rax,%rsi
+    428d:	       48 89 d7             	mov    %rdx,%rdi
+    4290:	       e8 92 2e 00 00       	call   7127 <nel::operator<<(nel::Log&, char const*)>
+    4295:	       48 89 c1             	mov    %rax,%rcx
+    4298:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    429c:	       48 c1 e8 02          	shr    $0x2,%rax
+    42a0:	       48 ba c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rdx
+    42a7:	       c2 f5 28 
+    42aa:	       48 f7 e2             	mul    %rdx
+    42ad:	       48 89 d0             	mov    %rdx,%rax
+    42b0:	       48 c1 e8 02          	shr    $0x2,%rax
+    42b4:	       48 89 c6             	mov    %rax,%rsi
+    42b7:	       48 89 cf             	mov    %rcx,%rdi
+    42ba:	       e8 73 2f 00 00       	call   7232 <nel::operator<<(nel::Log&, unsigned long)>
+    42bf:	       be 2e 00 00 00       	mov    $0x2e,%esi
+    42c4:	       48 89 c7             	mov    %rax,%rdi
+    42c7:	       e8 2f 2e 00 00       	call   70fb <nel::operator<<(nel::Log&, char)>
+    42cc:	       48 89 c2             	mov    %rax,%rdx
+    42cf:	       48 83 7d f0 09       	cmpq   $0x9,-0x10(%rbp)
+    42d4:	/----- 77 09                	ja     42df <bench::report_per_item(char const*, unsigned long, unsigned long)+0x100>
+    42d6:	|      48 8d 05 46 3d 00 00 	lea    0x3d46(%rip),%rax        # 8023 <_IO_stdin_used+0x23>
+    42dd:	|  /-- eb 07                	jmp    42e6 <bench::report_per_item(char const*, unsigned long, unsigned long)+0x107>
+    42df:	\--|-> 48 8d 05 3f 3d 00 00 	lea    0x3d3f(%rip),%rax        # 8025 <_IO_stdin_used+0x25>
+    42e6:	   \-> 48 89 c6             	mov    %rax,%rsi
+    42e9:	       48 89 d7             	mov    %rdx,%rdi
+    42ec:	       e8 36 2e 00 00       	call   7127 <nel::operator<<(nel::Log&, char const*)>
+    42f1:	       48 89 c2             	mov    %rax,%rdx
+    42f4:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    42f8:	       48 89 c6             	mov    %rax,%rsi
+    42fb:	       48 89 d7             	mov    %rdx,%rdi
+    42fe:	       e8 2f 2f 00 00       	call   7232 <nel::operator<<(nel::Log&, unsigned long)>
+    4303:	       48 89 c2             	mov    %rax,%rdx
+    4306:	       48 8d 05 19 3d 00 00 	lea    0x3d19(%rip),%rax        # 8026 <_IO_stdin_used+0x26>
+    430d:	       48 89 c6             	mov    %rax,%rsi
+    4310:	       48 89 d7             	mov    %rdx,%rdi
+    4313:	       e8 0f 2e 00 00       	call   7127 <nel::operator<<(nel::Log&, char const*)>
+    sink = sink + r;
+    4318:	       90                   	nop
+    4319:	       c9                   	leave
+    431a:	       c3                   	ret
+
+000000000000431b <operator new(unsigned long, void*)>:
+
+#    if !defined(TEST)
+// catch2 uses stdlib and so uses stdlib's new defn.
+// Operator new must not be in a namespace
+inline void *operator new(nel::USize, void *p)
+{
+    431b:	55                   	push   %rbp
+    431c:	48 89 e5             	mov    %rsp,%rbp
+    431f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4323:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return p;
+    4327:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+    432b:	5d                   	pop    %rbp
+    432c:	c3                   	ret
+    432d:	90                   	nop
+
+000000000000432e <nel::Context::Context(char const*, char const*, int)>:
+        char const *fn_name_;
+        char const *file_name_;
+        int line_num_;
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+    432e:	55                   	push   %rbp
+    432f:	48 89 e5             	mov    %rsp,%rbp
+    4332:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4336:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    433a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    433e:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    4341:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4345:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    4349:	48 89 10             	mov    %rdx,(%rax)
+            , file_name_(file_name)
+    434c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4350:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    4354:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , line_num_(line_num)
+    4358:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    435c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    435f:	89 50 10             	mov    %edx,0x10(%rax)
+        {
+        }
+    4362:	90                   	nop
+    4363:	5d                   	pop    %rbp
+    4364:	c3                   	ret
+
+0000000000004365 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>:
+        static Result<void *, AllocError> try_malloc(Length const align, Length const size)
+        {
+            return try_realloc(nullptr, align, 0, size);
+        }
+
+        static Result<void *, AllocError> try_realloc(void *const p,
+    4365:	          55                   	push   %rbp
+    4366:	          48 89 e5             	mov    %rsp,%rbp
+    4369:	          48 83 ec 40          	sub    $0x40,%rsp
+    436d:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    4371:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    4375:	          48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    4379:	          48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    437d:	          4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+                                                      Length const align,
+                                                      Length const old_size,
+                                                      Length const new_size)
+        {
+            if (align == 0 || (align & (align - 1)) != 0) {
+    4381:	          48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    4386:	      /-- 74 11                	je     4399 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x34>
+    4388:	      |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    438c:	      |   48 83 e8 01          	sub    $0x1,%rax
+    4390:	      |   48 23 45 d8          	and    -0x28(%rbp),%rax
+    4394:	      |   48 85 c0             	test   %rax,%rax
+    4397:	   /--|-- 74 1c                	je     43b5 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x50>
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+    4399:	   |  \-> c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+    43a0:	   |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    43a4:	   |      48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    43a8:	   |      48 89 d6             	mov    %rdx,%rsi
+    43ab:	   |      48 89 c7             	mov    %rax,%rdi
+    43ae:	   |      e8 01 02 00 00       	call   45b4 <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+                                    : std::realloc(p, new_size);
+            if (new_p == nullptr) {
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+            }
+            return Result<void *, AllocError>::Ok(new_p);
+        }
+    43b3:	/--|----- eb 79                	jmp    442e <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            void *const new_p = is_over_aligned(align)
+    43b5:	|  \----> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    43b9:	|         48 89 c7             	mov    %rax,%rdi
+    43bc:	|         e8 b4 00 00 00       	call   4475 <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+                                    ? realloc_aligned(p, align, old_size, new_size)
+    43c1:	|         84 c0                	test   %al,%al
+    43c3:	|  /----- 74 1a                	je     43df <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x7a>
+    43c5:	|  |      48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+    43c9:	|  |      48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    43cd:	|  |      48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+    43d1:	|  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    43d5:	|  |      48 89 c7             	mov    %rax,%rdi
+    43d8:	|  |      e8 19 2b 00 00       	call   6ef6 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+    43dd:	|  |  /-- eb 13                	jmp    43f2 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x8d>
+                                    : std::realloc(p, new_size);
+    43df:	|  \--|-> 48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    43e3:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    43e7:	|     |   48 89 d6             	mov    %rdx,%rsi
+    43ea:	|     |   48 89 c7             	mov    %rax,%rdi
+    43ed:	|     |   e8 ce cc ff ff       	call   10c0 <realloc@plt>
+    43f2:	|     \-> 48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            if (new_p == nullptr) {
+    43f6:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    43fa:	|         48 85 c0             	test   %rax,%rax
+    43fd:	|     /-- 75 1c                	jne    441b <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xb6>
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+    43ff:	|     |   c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    4406:	|     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    440a:	|     |   48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    440e:	|     |   48 89 d6             	mov    %rdx,%rsi
+    4411:	|     |   48 89 c7             	mov    %rax,%rdi
+    4414:	|     |   e8 9b 01 00 00       	call   45b4 <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+        }
+    4419:	+-----|-- eb 13                	jmp    442e <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            return Result<void *, AllocError>::Ok(new_p);
+    441b:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    441f:	|         48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    4423:	|         48 89 d6             	mov    %rdx,%rsi
+    4426:	|         48 89 c7             	mov    %rax,%rdi
+    4429:	|         e8 ba 01 00 00       	call   45e8 <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>
+        }
+    442e:	\-------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4432:	          c9                   	leave
+    4433:	          c3                   	ret
+
+0000000000004434 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>:
+
+        static void free(void *const p, Length const align, Length const size)
+    4434:	       55                   	push   %rbp
+    4435:	       48 89 e5             	mov    %rsp,%rbp
+    4438:	       48 83 ec 20          	sub    $0x20,%rsp
+    443c:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4440:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    4444:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+    4448:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    444c:	       48 89 c7             	mov    %rax,%rdi
+    444f:	       e8 21 00 00 00       	call   4475 <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+    4454:	       84 c0                	test   %al,%al
+    4456:	/----- 74 0e                	je     4466 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x32>
+                free_aligned(p);
+    4458:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    445c:	|      48 89 c7             	mov    %rax,%rdi
+    445f:	|      e8 4e 2a 00 00       	call   6eb2 <nel::free_aligned(void*)>
+            } else {
+                std::free(p);
+            }
+        }
+    4464:	|  /-- eb 0c                	jmp    4472 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x3e>
+                std::free(p);
+    4466:	\--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    446a:	   |   48 89 c7             	mov    %rax,%rdi
+    446d:	   |   e8 be cb ff ff       	call   1030 <free@plt>
+        }
+    4472:	   \-> 90                   	nop
+    4473:	       c9                   	leave
+    4474:	       c3                   	ret
+
+0000000000004475 <nel::heaped::Malloc::is_over_aligned(unsigned long)>:
+
+    private:
+        static constexpr bool is_over_aligned(Length const align)
+    4475:	55                   	push   %rbp
+    4476:	48 89 e5             	mov    %rsp,%rbp
+    4479:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return align > alignof(std::max_align_t);
+    447d:	48 83 7d f8 10       	cmpq   $0x10,-0x8(%rbp)
+    4482:	0f 97 c0             	seta   %al
+        }
+    4485:	5d                   	pop    %rbp
+    4486:	c3                   	ret
+    4487:	90                   	nop
+
+0000000000004488 <nel::Slice<int>::len() const>:
+        /**
+         * Determine numer of elements in the slice.
+         *
+         * @returns number of elements in the slice.
+         */
+        constexpr Length len(void) const
+    4488:	55                   	push   %rbp
+    4489:	48 89 e5             	mov    %rsp,%rbp
+    448c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return len_;
+    4490:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4494:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    4498:	5d                   	pop    %rbp
+    4499:	c3                   	ret
+
+000000000000449a <nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::operator bool() const>:
+        constexpr operator bool(void) const
+    449a:	55                   	push   %rbp
+    449b:	48 89 e5             	mov    %rsp,%rbp
+    449e:	48 83 ec 10          	sub    $0x10,%rsp
+    44a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return !self().is_done();
+    44a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    44aa:	48 89 c7             	mov    %rax,%rdi
+    44ad:	e8 0e 00 00 00       	call   44c0 <nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::self() const>
+    44b2:	48 89 c7             	mov    %rax,%rdi
+    44b5:	e8 1c 00 00 00       	call   44d6 <nel::ChainIterator<nel::SliceIterator<int> >::is_done() const>
+    44ba:	83 f0 01             	xor    $0x1,%eax
+        }
+    44bd:	c9                   	leave
+    44be:	c3                   	ret
+    44bf:	90                   	nop
+
+00000000000044c0 <nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::self() const>:
+        constexpr ItT const &self(void) const
+    44c0:	55                   	push   %rbp
+    44c1:	48 89 e5             	mov    %rsp,%rbp
+    44c4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT const &it = static_cast<ItT const &>(*this);
+    44c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    44cc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    44d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    44d4:	5d                   	pop    %rbp
+    44d5:	c3                   	ret
+
+00000000000044d6 <nel::ChainIterator<nel::SliceIterator<int> >::is_done() const>:
+        constexpr bool is_done(void) const
+    44d6:	       55                   	push   %rbp
+    44d7:	       48 89 e5             	mov    %rsp,%rbp
+    44da:	       48 83 ec 10          	sub    $0x10,%rsp
+    44de:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return it1_.is_done() && it2_.is_done();
+    44e2:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    44e6:	       48 89 c7             	mov    %rax,%rdi
+    44e9:	       e8 26 00 00 00       	call   4514 <nel::SliceIterator<int>::is_done() const>
+    44ee:	       84 c0                	test   %al,%al
+    44f0:	/----- 74 1b                	je     450d <nel::ChainIterator<nel::SliceIterator<int> >::is_done() const+0x37>
+    44f2:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    44f6:	|      48 83 c0 10          	add    $0x10,%rax
+    44fa:	|      48 89 c7             	mov    %rax,%rdi
+    44fd:	|      e8 12 00 00 00       	call   4514 <nel::SliceIterator<int>::is_done() const>
+    4502:	|      84 c0                	test   %al,%al
+    4504:	+----- 74 07                	je     450d <nel::ChainIterator<nel::SliceIterator<int> >::is_done() const+0x37>
+    4506:	|      b8 01 00 00 00       	mov    $0x1,%eax
+    450b:	|  /-- eb 05                	jmp    4512 <nel::ChainIterator<nel::SliceIterator<int> >::is_done() const+0x3c>
+    450d:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    4512:	   \-> c9                   	leave
+    4513:	       c3                   	ret
+
+0000000000004514 <nel::SliceIterator<int>::is_done() const>:
+        }
+#    endif
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+    4514:	55                   	push   %rbp
+    4515:	48 89 e5             	mov    %rsp,%rbp
+    4518:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return (b_ == e_);
+    451c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4520:	48 8b 10             	mov    (%rax),%rdx
+    4523:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4527:	48 8b 40 08          	mov    0x8(%rax),%rax
+    452b:	48 39 c2             	cmp    %rax,%rdx
+    452e:	0f 94 c0             	sete   %al
+        }
+    4531:	5d                   	pop    %rbp
+    4532:	c3                   	ret
+    4533:	90                   	nop
+
+0000000000004534 <nel::Manual<int [4096]>::~Manual()>:
+        } u_;
+
+    public:
+        // default must not delete..
+        // doesn't know if value contained or not.
+        constexpr ~Manual() = default;
+    4534:	55                   	push   %rbp
+    4535:	48 89 e5             	mov    %rsp,%rbp
+    4538:	48 83 ec 10          	sub    $0x10,%rsp
+    453c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4540:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4544:	48 89 c7             	mov    %rax,%rdi
+    4547:	e8 2e 05 00 00       	call   4a7a <nel::Manual<int [4096]>::U::~U()>
+    454c:	90                   	nop
+    454d:	c9                   	leave
+    454e:	c3                   	ret
+    454f:	90                   	nop
+
+0000000000004550 <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+                Element<T> ok_;
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    4550:	             55                   	push   %rbp
+    4551:	             48 89 e5             	mov    %rsp,%rbp
+    4554:	             48 83 ec 30          	sub    $0x30,%rsp
+    4558:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result::dtor
+    455c:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4560:	             8b 00                	mov    (%rax),%eax
+    4562:	             83 f8 02             	cmp    $0x2,%eax
+    4565:	/----------- 74 43                	je     45aa <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5a>
+    4567:	|            83 f8 02             	cmp    $0x2,%eax
+    456a:	|        /-- 7f 09                	jg     4575 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x25>
+    456c:	|        |   85 c0                	test   %eax,%eax
+    456e:	|  /-----|-- 74 3d                	je     45ad <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5d>
+    4570:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    4573:	|  |  /--|-- 74 3b                	je     45b0 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x60>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    4575:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    4579:	|  |  |      b9 72 00 00 00       	mov    $0x72,%ecx
+    457e:	|  |  |      48 8d 15 1c 3d 00 00 	lea    0x3d1c(%rip),%rdx        # 82a1 <queue_len+0xc1>
+    4585:	|  |  |      48 8d 35 27 3d 00 00 	lea    0x3d27(%rip),%rsi        # 82b3 <queue_len+0xd3>
+    458c:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    458f:	|  |  |      e8 9a fd ff ff       	call   432e <nel::Context::Context(char const*, char const*, int)>
+    4594:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    4598:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    459b:	|  |  |      48 8d 05 19 3d 00 00 	lea    0x3d19(%rip),%rax        # 82bb <queue_len+0xdb>
+    45a2:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    45a5:	|  |  |      e8 45 22 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+                    break;
+    45aa:	\--|--|----> 90                   	nop
+    45ab:	   |  |  /-- eb 04                	jmp    45b1 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    45ad:	   \--|--|-> 90                   	nop
+    45ae:	      |  +-- eb 01                	jmp    45b1 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    45b0:	      \--|-> 90                   	nop
+                    break;
+            }
+        }
+    45b1:	         \-> 90                   	nop
+    45b2:	             c9                   	leave
+    45b3:	             c3                   	ret
+
+00000000000045b4 <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>:
+         *
+         * @param val The value to move into the result as an err value.
+         *
+         * @returns a Result 'wrapping' the value given as an err value.
+         */
+        constexpr static Result Err(E &&val)
+    45b4:	55                   	push   %rbp
+    45b5:	48 89 e5             	mov    %rsp,%rbp
+    45b8:	48 83 ec 10          	sub    $0x10,%rsp
+    45bc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    45c0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            return Result(Phantom<Tag::ERR>(), forward<E>(val));
+    45c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    45c8:	48 89 c7             	mov    %rax,%rdi
+    45cb:	e8 10 0b 00 00       	call   50e0 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    45d0:	48 89 c2             	mov    %rax,%rdx
+    45d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    45d7:	48 89 d6             	mov    %rdx,%rsi
+    45da:	48 89 c7             	mov    %rax,%rdi
+    45dd:	e8 0c 0b 00 00       	call   50ee <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>
+        }
+    45e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    45e6:	c9                   	leave
+    45e7:	c3                   	ret
+
+00000000000045e8 <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>:
+        constexpr static Result Ok(Args &&...args)
+    45e8:	55                   	push   %rbp
+    45e9:	48 89 e5             	mov    %rsp,%rbp
+    45ec:	48 83 ec 10          	sub    $0x10,%rsp
+    45f0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    45f4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<Args>(args)...);
+    45f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    45fc:	48 89 c7             	mov    %rax,%rdi
+    45ff:	e8 2b 0b 00 00       	call   512f <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    4604:	48 89 c2             	mov    %rax,%rdx
+    4607:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    460b:	48 89 d6             	mov    %rdx,%rsi
+    460e:	48 89 c7             	mov    %rax,%rdi
+    4611:	e8 28 0b 00 00       	call   513e <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>
+        }
+    4616:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    461a:	c9                   	leave
+    461b:	c3                   	ret
+
+000000000000461c <nel::Slice<int>::ptr() const>:
+        constexpr Type *ptr(void) const
+    461c:	55                   	push   %rbp
+    461d:	48 89 e5             	mov    %rsp,%rbp
+    4620:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return content_;
+    4624:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4628:	48 8b 00             	mov    (%rax),%rax
+        }
+    462b:	5d                   	pop    %rbp
+    462c:	c3                   	ret
+    462d:	90                   	nop
+
+000000000000462e <nel::Slice<int>::iter() const>:
+        constexpr Iterator iter(void) const
+    462e:	55                   	push   %rbp
+    462f:	48 89 e5             	mov    %rsp,%rbp
+    4632:	53                   	push   %rbx
+    4633:	48 83 ec 18          	sub    $0x18,%rsp
+    4637:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    463b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return Iterator(ptr(), len());
+    463f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4643:	48 89 c7             	mov    %rax,%rdi
+    4646:	e8 3d fe ff ff       	call   4488 <nel::Slice<int>::len() const>
+    464b:	48 89 c3             	mov    %rax,%rbx
+    464e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4652:	48 89 c7             	mov    %rax,%rdi
+    4655:	e8 c2 ff ff ff       	call   461c <nel::Slice<int>::ptr() const>
+    465a:	48 89 c1             	mov    %rax,%rcx
+    465d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4661:	48 89 da             	mov    %rbx,%rdx
+    4664:	48 89 ce             	mov    %rcx,%rsi
+    4667:	48 89 c7             	mov    %rax,%rdi
+    466a:	e8 11 0b 00 00       	call   5180 <nel::SliceIterator<int>::SliceIterator(int*, unsigned long)>
+        }
+    466f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4673:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    4677:	c9                   	leave
+    4678:	c3                   	ret
+    4679:	90                   	nop
+
+000000000000467a <nel::Optional<int&>::is_none() const::{lambda(int&)#1}::operator()(int&) const>:
+         *
+         * The optional is not consumed by the operation.
+         */
+        constexpr bool is_none(void) const
+        {
+            return match<bool>([](T const &) -> bool { return false; },
+    467a:	55                   	push   %rbp
+    467b:	48 89 e5             	mov    %rsp,%rbp
+    467e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4682:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    4686:	b8 00 00 00 00       	mov    $0x0,%eax
+    468b:	5d                   	pop    %rbp
+    468c:	c3                   	ret
+    468d:	90                   	nop
+
+000000000000468e <nel::Optional<int&>::is_none() const::{lambda()#2}::operator()() const>:
+                               [](void) -> bool { return true; });
+    468e:	55                   	push   %rbp
+    468f:	48 89 e5             	mov    %rsp,%rbp
+    4692:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4696:	b8 01 00 00 00       	mov    $0x1,%eax
+    469b:	5d                   	pop    %rbp
+    469c:	c3                   	ret
+    469d:	90                   	nop
+
+000000000000469e <nel::Optional<int&>::is_none() const>:
+        constexpr bool is_none(void) const
+    469e:	55                   	push   %rbp
+    469f:	48 89 e5             	mov    %rsp,%rbp
+    46a2:	48 83 ec 30          	sub    $0x30,%rsp
+    46a6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+            return match<bool>([](T const &) -> bool { return false; },
+    46aa:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    46ae:	b9 78 01 00 00       	mov    $0x178,%ecx
+    46b3:	48 8d 15 0c 3c 00 00 	lea    0x3c0c(%rip),%rdx        # 82c6 <queue_len+0xe6>
+    46ba:	48 8d 35 19 3c 00 00 	lea    0x3c19(%rip),%rsi        # 82da <queue_len+0xfa>
+    46c1:	48 89 c7             	mov    %rax,%rdi
+    46c4:	e8 65 fc ff ff       	call   432e <nel::Context::Context(char const*, char const*, int)>
+    46c9:	48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+    46cd:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    46d1:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    46d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    46d9:	48 89 c7             	mov    %rax,%rdi
+    46dc:	e8 03 00 00 00       	call   46e4 <bool nel::Optional<int&>::match<bool, nel::Optional<int&>::is_none() const::{lambda(int&)#1}, nel::Optional<int&>::is_none() const::{lambda()#2}>(nel::Optional<int&>::is_none() const::{lambda(int&)#1}&&, nel::Optional<int&>::is_none() const::{lambda()#2}&&, nel::Context const&) const>
+        }
+    46e1:	c9                   	leave
+    46e2:	c3                   	ret
+    46e3:	90                   	nop
+
+00000000000046e4 <bool nel::Optional<int&>::match<bool, nel::Optional<int&>::is_none() const::{lambda(int&)#1}, nel::Optional<int&>::is_none() const::{lambda()#2}>(nel::Optional<int&>::is_none() const::{lambda(int&)#1}&&, nel::Optional<int&>::is_none() const::{lambda()#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_some, Fn2 &&on_none, Context const &ctx = Context()) const
+    46e4:	             55                   	push   %rbp
+    46e5:	             48 89 e5             	mov    %rsp,%rbp
+    46e8:	             48 83 ec 20          	sub    $0x20,%rsp
+    46ec:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    46f0:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    46f4:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    46f8:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // optional::match
+    46fc:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4700:	             8b 00                	mov    (%rax),%eax
+    4702:	             83 f8 02             	cmp    $0x2,%eax
+    4705:	         /-- 74 10                	je     4717 <bool nel::Optional<int&>::match<bool, nel::Optional<int&>::is_none() const::{lambda(int&)#1}, nel::Optional<int&>::is_none() const::{lambda()#2}>(nel::Optional<int&>::is_none() const::{lambda(int&)#1}&&, nel::Optional<int&>::is_none() const::{lambda()#2}&&, nel::Context const&) const+0x33>
+    4707:	         |   83 f8 02             	cmp    $0x2,%eax
+    470a:	/--------|-- 7f 53                	jg     475f <bool nel::Optional<int&>::match<bool, nel::Optional<int&>::is_none() const::{lambda(int&)#1}, nel::Optional<int&>::is_none() const::{lambda()#2}>(nel::Optional<int&>::is_none() const::{lambda(int&)#1}&&, nel::Optional<int&>::is_none() const::{lambda()#2}&&, nel::Context const&) const+0x7b>
+    470c:	|        |   85 c0                	test   %eax,%eax
+    470e:	|  /-----|-- 74 39                	je     4749 <bool nel::Optional<int&>::match<bool, nel::Optional<int&>::is_none() const::{lambda(int&)#1}, nel::Optional<int&>::is_none() const::{lambda()#2}>(nel::Optional<int&>::is_none() const::{lambda(int&)#1}&&, nel::Optional<int&>::is_none() const::{lambda()#2}&&, nel::Context const&) const+0x65>
+    4710:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    4713:	|  |  /--|-- 74 26                	je     473b <bool nel::Optional<int&>::match<bool, nel::Optional<int&>::is_none() const::{lambda(int&)#1}, nel::Optional<int&>::is_none() const::{lambda()#2}>(nel::Optional<int&>::is_none() const::{lambda(int&)#1}&&, nel::Optional<int&>::is_none() const::{lambda()#2}&&, nel::Context const&) const+0x57>
+    4715:	+--|--|--|-- eb 48                	jmp    475f <bool nel::Optional<int&>::match<bool, nel::Optional<int&>::is_none() const::{lambda(int&)#1}, nel::Optional<int&>::is_none() const::{lambda()#2}>(nel::Optional<int&>::is_none() const::{lambda(int&)#1}&&, nel::Optional<int&>::is_none() const::{lambda()#2}&&, nel::Context const&) const+0x7b>
+                    return on_some(*some_);
+    4717:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    471b:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    471f:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    4722:	|  |  |      e8 0d 0b 00 00       	call   5234 <nel::Element<int&>::operator*() const>
+    4727:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    472a:	|  |  |      48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    472e:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    4731:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    4734:	|  |  |      e8 41 ff ff ff       	call   467a <nel::Optional<int&>::is_none() const::{lambda(int&)#1}::operator()(int&) const>
+    4739:	|  |  |  /-- eb 3a                	jmp    4775 <bool nel::Optional<int&>::match<bool, nel::Optional<int&>::is_none() const::{lambda(int&)#1}, nel::Optional<int&>::is_none() const::{lambda()#2}>(nel::Optional<int&>::is_none() const::{lambda(int&)#1}&&, nel::Optional<int&>::is_none() const::{lambda()#2}&&, nel::Context const&) const+0x91>
+                    return on_none();
+    473b:	|  |  \--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    473f:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    4742:	|  |     |   e8 47 ff ff ff       	call   468e <nel::Optional<int&>::is_none() const::{lambda()#2}::operator()() const>
+    4747:	|  |     +-- eb 2c                	jmp    4775 <bool nel::Optional<int&>::match<bool, nel::Optional<int&>::is_none() const::{lambda(int&)#1}, nel::Optional<int&>::is_none() const::{lambda()#2}>(nel::Optional<int&>::is_none() const::{lambda(int&)#1}&&, nel::Optional<int&>::is_none() const::{lambda()#2}&&, nel::Context const&) const+0x91>
+                    nel::panic("invalid Optional", ctx);
+    4749:	|  \-----|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    474d:	|        |   48 89 c6             	mov    %rax,%rsi
+    4750:	|        |   48 8d 05 8b 3b 00 00 	lea    0x3b8b(%rip),%rax        # 82e2 <queue_len+0x102>
+    4757:	|        |   48 89 c7             	mov    %rax,%rdi
+    475a:	|        |   e8 90 20 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Optional", ctx);
+    475f:	\--------|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4763:	         |   48 89 c6             	mov    %rax,%rsi
+    4766:	         |   48 8d 05 86 3b 00 00 	lea    0x3b86(%rip),%rax        # 82f3 <queue_len+0x113>
+    476d:	         |   48 89 c7             	mov    %rax,%rdi
+    4770:	         |   e8 7a 20 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+        }
+    4775:	         \-> c9                   	leave
+    4776:	             c3                   	ret
+    4777:	             90                   	nop
+
+0000000000004778 <nel::Slice<int>::slice(unsigned long, unsigned long) const>:
+        Slice slice(Index b, Index e) const
+    4778:	       55                   	push   %rbp
+    4779:	       48 89 e5             	mov    %rsp,%rbp
+    477c:	       48 83 ec 20          	sub    $0x20,%rsp
+    4780:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4784:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    4788:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    478c:	       48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            if (b >= e) { return Slice::empty(); }
+    4790:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4794:	       48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    4798:	   /-- 72 0e                	jb     47a8 <nel::Slice<int>::slice(unsigned long, unsigned long) const+0x30>
+    479a:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    479e:	   |   48 89 c7             	mov    %rax,%rdi
+    47a1:	   |   e8 f1 04 00 00       	call   4c97 <nel::Slice<int>::empty()>
+    47a6:	/--|-- eb 62                	jmp    480a <nel::Slice<int>::slice(unsigned long, unsigned long) const+0x92>
+            if (b >= len_) { return Slice::empty(); }
+    47a8:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    47ac:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    47b0:	|      48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    47b4:	|  /-- 72 0e                	jb     47c4 <nel::Slice<int>::slice(unsigned long, unsigned long) const+0x4c>
+    47b6:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    47ba:	|  |   48 89 c7             	mov    %rax,%rdi
+    47bd:	|  |   e8 d5 04 00 00       	call   4c97 <nel::Slice<int>::empty()>
+    47c2:	+--|-- eb 46                	jmp    480a <nel::Slice<int>::slice(unsigned long, unsigned long) const+0x92>
+            if (e > len_) { e = len_; }
+    47c4:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    47c8:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    47cc:	|      48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    47d0:	|  /-- 73 0c                	jae    47de <nel::Slice<int>::slice(unsigned long, unsigned long) const+0x66>
+    47d2:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    47d6:	|  |   48 8b 40 08          	mov    0x8(%rax),%rax
+    47da:	|  |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            return Slice(&content_[b], e - b);
+    47de:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    47e2:	|      48 2b 45 e8          	sub    -0x18(%rbp),%rax
+    47e6:	|      48 89 c2             	mov    %rax,%rdx
+    47e9:	|      48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    47ed:	|      48 8b 00             	mov    (%rax),%rax
+    47f0:	|      48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    47f4:	|      48 c1 e1 02          	shl    $0x2,%rcx
+    47f8:	|      48 01 c1             	add    %rax,%rcx
+    47fb:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    47ff:	|      48 89 ce             	mov    %rcx,%rsi
+    4802:	|      48 89 c7             	mov    %rax,%rdi
+    4805:	|      e8 90 0a 00 00       	call   529a <nel::Slice<int>::Slice(int*, unsigned long)>
+        }
+    480a:	\----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    480e:	       c9                   	leave
+    480f:	       c3                   	ret
+
+0000000000004810 <nel::Iterator<nel::SliceIterator<int>, int&, int&>::chain(nel::SliceIterator<int>&&)>:
+        constexpr ChainIterator<ItT> chain(ItT &&other)
+    4810:	55                   	push   %rbp
+    4811:	48 89 e5             	mov    %rsp,%rbp
+    4814:	53                   	push   %rbx
+    4815:	48 83 ec 28          	sub    $0x28,%rsp
+    4819:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    481d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    4821:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            return ChainIterator<ItT>(move(self()), move(other));
+    4825:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4829:	48 89 c7             	mov    %rax,%rdi
+    482c:	e8 4c 0a 00 00       	call   527d <nel::SliceIterator<int>&& nel::move<nel::SliceIterator<int> >(nel::SliceIterator<int>&)>
+    4831:	48 89 c3             	mov    %rax,%rbx
+    4834:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4838:	48 89 c7             	mov    %rax,%rdi
+    483b:	e8 7a 09 00 00       	call   51ba <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    4840:	48 89 c7             	mov    %rax,%rdi
+    4843:	e8 35 0a 00 00       	call   527d <nel::SliceIterator<int>&& nel::move<nel::SliceIterator<int> >(nel::SliceIterator<int>&)>
+    4848:	48 89 c1             	mov    %rax,%rcx
+    484b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    484f:	48 89 da             	mov    %rbx,%rdx
+    4852:	48 89 ce             	mov    %rcx,%rsi
+    4855:	48 89 c7             	mov    %rax,%rdi
+    4858:	e8 67 0a 00 00       	call   52c4 <nel::ChainIterator<nel::SliceIterator<int> >::ChainIterator(nel::SliceIterator<int>&&, nel::SliceIterator<int>&&)>
+        }
+    485d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4861:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    4865:	c9                   	leave
+    4866:	c3                   	ret
+    4867:	90                   	nop
+
+0000000000004868 <nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}::operator()() const>:
+            return it1_.next().or_else([&](void) -> Optional<OutT> { return it2_.next(); });
+    4868:	55                   	push   %rbp
+    4869:	48 89 e5             	mov    %rsp,%rbp
+    486c:	48 83 ec 10          	sub    $0x10,%rsp
+    4870:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4874:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    4878:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    487c:	48 8b 00             	mov    (%rax),%rax
+    487f:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    4883:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4887:	48 89 d6             	mov    %rdx,%rsi
+    488a:	48 89 c7             	mov    %rax,%rdi
+    488d:	e8 3e 09 00 00       	call   51d0 <nel::SliceIterator<int>::next()>
+    4892:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4896:	c9                   	leave
+    4897:	c3                   	ret
+
+0000000000004898 <nel::ChainIterator<nel::SliceIterator<int> >::next()>:
+        Optional<OutT> next(void)
+    4898:	55                   	push   %rbp
+    4899:	48 89 e5             	mov    %rsp,%rbp
+    489c:	48 83 ec 40          	sub    $0x40,%rsp
+    48a0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    48a4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+            return it1_.next().or_else([&](void) -> Optional<OutT> { return it2_.next(); });
+    48a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    48ac:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    48b0:	48 89 d6             	mov    %rdx,%rsi
+    48b3:	48 89 c7             	mov    %rax,%rdi
+    48b6:	e8 15 09 00 00       	call   51d0 <nel::SliceIterator<int>::next()>
+    48bb:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    48bf:	b9 a9 02 00 00       	mov    $0x2a9,%ecx
+    48c4:	48 8d 15 35 3a 00 00 	lea    0x3a35(%rip),%rdx        # 8300 <queue_len+0x120>
+    48cb:	48 8d 35 b0 3a 00 00 	lea    0x3ab0(%rip),%rsi        # 8382 <queue_len+0x1a2>
+    48d2:	48 89 c7             	mov    %rax,%rdi
+    48d5:	e8 54 fa ff ff       	call   432e <nel::Context::Context(char const*, char const*, int)>
+    48da:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    48de:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    48e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    48e6:	48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+    48ea:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    48ee:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+    48f2:	48 89 c7             	mov    %rax,%rdi
+    48f5:	e8 84 0a 00 00       	call   537e <nel::Optional<int&> nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)>
+    48fa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    48fe:	48 89 c7             	mov    %rax,%rdi
+    4901:	e8 06 00 00 00       	call   490c <nel::Optional<int&>::~Optional()>
+        }
+    4906:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    490a:	c9                   	leave
+    490b:	c3                   	ret
+
+000000000000490c <nel::Optional<int&>::~Optional()>:
+        constexpr ~Optional(void)
+    490c:	             55                   	push   %rbp
+    490d:	             48 89 e5             	mov    %rsp,%rbp
+    4910:	             48 83 ec 30          	sub    $0x30,%rsp
+    4914:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+            switch (tag_) { // optional::dtor
+    4918:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    491c:	             8b 00                	mov    (%rax),%eax
+    491e:	             83 f8 02             	cmp    $0x2,%eax
+    4921:	/----------- 74 43                	je     4966 <nel::Optional<int&>::~Optional()+0x5a>
+    4923:	|            83 f8 02             	cmp    $0x2,%eax
+    4926:	|        /-- 7f 09                	jg     4931 <nel::Optional<int&>::~Optional()+0x25>
+    4928:	|        |   85 c0                	test   %eax,%eax
+    492a:	|  /-----|-- 74 3d                	je     4969 <nel::Optional<int&>::~Optional()+0x5d>
+    492c:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    492f:	|  |  /--|-- 74 3b                	je     496c <nel::Optional<int&>::~Optional()+0x60>
+                    nel::panic("bad Optional");
+    4931:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    4935:	|  |  |      b9 87 00 00 00       	mov    $0x87,%ecx
+    493a:	|  |  |      48 8d 15 85 39 00 00 	lea    0x3985(%rip),%rdx        # 82c6 <queue_len+0xe6>
+    4941:	|  |  |      48 8d 35 3f 3a 00 00 	lea    0x3a3f(%rip),%rsi        # 8387 <queue_len+0x1a7>
+    4948:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    494b:	|  |  |      e8 de f9 ff ff       	call   432e <nel::Context::Context(char const*, char const*, int)>
+    4950:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    4954:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    4957:	|  |  |      48 8d 05 95 39 00 00 	lea    0x3995(%rip),%rax        # 82f3 <queue_len+0x113>
+    495e:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    4961:	|  |  |      e8 89 1e 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+                    break;
+    4966:	\--|--|----> 90                   	nop
+    4967:	   |  |  /-- eb 04                	jmp    496d <nel::Optional<int&>::~Optional()+0x61>
+                    break;
+    4969:	   \--|--|-> 90                   	nop
+    496a:	      |  +-- eb 01                	jmp    496d <nel::Optional<int&>::~Optional()+0x61>
+                    break;
+    496c:	      \--|-> 90                   	nop
+        }
+    496d:	         \-> 90                   	nop
+    496e:	             c9                   	leave
+    496f:	             c3                   	ret
+
+0000000000004970 <nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}::operator()(int&) const>:
+         *
+         * @warning If the optional does not contain a Some, then abort/panic.
+         */
+        T unwrap(Context const &ctx = Context())
+        {
+            return consume<T>([](T &&some) -> T { return some; },
+    4970:	55                   	push   %rbp
+    4971:	48 89 e5             	mov    %rsp,%rbp
+    4974:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4978:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    497c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4980:	5d                   	pop    %rbp
+    4981:	c3                   	ret
+
+0000000000004982 <nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}::operator()() const>:
+                              [&](void) -> T { nel::panic("not a Some", ctx); },
+    4982:	55                   	push   %rbp
+    4983:	48 89 e5             	mov    %rsp,%rbp
+    4986:	48 83 ec 10          	sub    $0x10,%rsp
+    498a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    498e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4992:	48 8b 00             	mov    (%rax),%rax
+    4995:	48 89 c6             	mov    %rax,%rsi
+    4998:	48 8d 05 f2 39 00 00 	lea    0x39f2(%rip),%rax        # 8391 <queue_len+0x1b1>
+    499f:	48 89 c7             	mov    %rax,%rdi
+    49a2:	e8 48 1e 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+    49a7:	90                   	nop
+
+00000000000049a8 <nel::Optional<int&>::unwrap(nel::Context const&)>:
+        T unwrap(Context const &ctx = Context())
+    49a8:	55                   	push   %rbp
+    49a9:	48 89 e5             	mov    %rsp,%rbp
+    49ac:	48 83 ec 20          	sub    $0x20,%rsp
+    49b0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    49b4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+                              [&](void) -> T { nel::panic("not a Some", ctx); },
+    49b8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    49bc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            return consume<T>([](T &&some) -> T { return some; },
+    49c0:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    49c4:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    49c8:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    49cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    49d0:	48 89 c7             	mov    %rax,%rdi
+    49d3:	e8 ec 09 00 00       	call   53c4 <int& nel::Optional<int&>::consume<int&, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)>
+                              ctx);
+        }
+    49d8:	c9                   	leave
+    49d9:	c3                   	ret
+
+00000000000049da <nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::operator++()>:
+        Iterator &operator++(void)
+    49da:	55                   	push   %rbp
+    49db:	48 89 e5             	mov    %rsp,%rbp
+    49de:	48 83 ec 10          	sub    $0x10,%rsp
+    49e2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            self().inc();
+    49e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    49ea:	48 89 c7             	mov    %rax,%rdi
+    49ed:	e8 80 0a 00 00       	call   5472 <nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::self()>
+    49f2:	48 89 c7             	mov    %rax,%rdi
+    49f5:	e8 8e 0a 00 00       	call   5488 <nel::ChainIterator<nel::SliceIterator<int> >::inc()>
+            return *this;
+    49fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    49fe:	c9                   	leave
+    49ff:	c3                   	ret
+
+0000000000004a00 <nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::operator*()>:
+        constexpr OutT operator*(void)
+    4a00:	55                   	push   %rbp
+    4a01:	48 89 e5             	mov    %rsp,%rbp
+    4a04:	48 83 ec 10          	sub    $0x10,%rsp
+    4a08:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return self().deref();
+    4a0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4a10:	48 89 c7             	mov    %rax,%rdi
+    4a13:	e8 5a 0a 00 00       	call   5472 <nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::self()>
+    4a18:	48 89 c7             	mov    %rax,%rdi
+    4a1b:	e8 a8 0a 00 00       	call   54c8 <nel::ChainIterator<nel::SliceIterator<int> >::deref()>
+        }
+    4a20:	c9                   	leave
+    4a21:	c3                   	ret
+
+0000000000004a22 <nel::heapless::Queue<int, 4096ul>::~Queue()>:
+        {
+            return &ptr()[d];
+        }
+
+    public:
+        constexpr ~Queue(void)
+    4a22:	55                   	push   %rbp
+    4a23:	48 89 e5             	mov    %rsp,%rbp
+    4a26:	48 83 ec 60          	sub    $0x60,%rsp
+    4a2a:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+        {
+            // newest first, reverse of construction.
+            iter().rev().for_each([&](auto &v) -> void { v.~Type(); });
+    4a2e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    4a32:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    4a36:	48 89 d6             	mov    %rdx,%rsi
+    4a39:	48 89 c7             	mov    %rax,%rdi
+    4a3c:	e8 97 02 00 00       	call   4cd8 <nel::heapless::Queue<int, 4096ul>::iter()>
+    4a41:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    4a45:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    4a49:	48 89 d6             	mov    %rdx,%rsi
+    4a4c:	48 89 c7             	mov    %rax,%rdi
+    4a4f:	e8 b4 0a 00 00       	call   5508 <nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::rev()>
+    4a54:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    4a58:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    4a5c:	48 89 d6             	mov    %rdx,%rsi
+    4a5f:	48 89 c7             	mov    %rax,%rdi
+    4a62:	e8 dd 0a 00 00       	call   5544 <void nel::Iterator<nel::RevIterator<nel::ChainIterator<nel::SliceIterator<int> > >, int&, int&>::for_each<nel::heapless::Queue<int, 4096ul>::~Queue()::{lambda(auto:1&)#1}>(nel::heapless::Queue<int, 4096ul>::~Queue()::{lambda(auto:1&)#1}&&)>
+        }
+    4a67:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    4a6b:	48 83 c0 18          	add    $0x18,%rax
+    4a6f:	48 89 c7             	mov    %rax,%rdi
+    4a72:	e8 bd fa ff ff       	call   4534 <nel::Manual<int [4096]>::~Manual()>
+    4a77:	90                   	nop
+    4a78:	c9                   	leave
+    4a79:	c3                   	ret
+
+0000000000004a7a <nel::Manual<int [4096]>::U::~U()>:
+                constexpr ~U() {};
+    4a7a:	55                   	push   %rbp
+    4a7b:	48 89 e5             	mov    %rsp,%rbp
+    4a7e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4a82:	90                   	nop
+    4a83:	5d                   	pop    %rbp
+    4a84:	c3                   	ret
+    4a85:	90                   	nop
+
+0000000000004a86 <nel::heapless::Queue<int, 4096ul>::push(int&&)>:
+         *
+         * @param val The value to move into the queue.
+         * @returns if successful, Result<void, T>::Ok()
+         * @returns if unsuccessful, Result<void, T>::Err() holding val
+         */
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+    4a86:	       55                   	push   %rbp
+    4a87:	       48 89 e5             	mov    %rsp,%rbp
+    4a8a:	       53                   	push   %rbx
+    4a8b:	       48 83 ec 28          	sub    $0x28,%rsp
+    4a8f:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    4a93:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    4a97:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            new (ptr(wp_)) Type(move(val));
+            wp_ += 1;
+            if (wp_ == N) { wp_ = 0; }
+            return Result<void, T>::Ok();
+#    else
+            if (is_full()) {
+    4a9b:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4a9f:	       48 89 c7             	mov    %rax,%rdi
+    4aa2:	       e8 49 0b 00 00       	call   55f0 <nel::heapless::Queue<int, 4096ul>::is_full() const>
+    4aa7:	       84 c0                	test   %al,%al
+    4aa9:	/----- 74 6a                	je     4b15 <nel::heapless::Queue<int, 4096ul>::push(int&&)+0x8f>
+                // here , rp_ == wp_.
+                rp_ += 1;
+    4aab:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4aaf:	|      48 8b 40 10          	mov    0x10(%rax),%rax
+    4ab3:	|      48 8d 50 01          	lea    0x1(%rax),%rdx
+    4ab7:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4abb:	|      48 89 50 10          	mov    %rdx,0x10(%rax)
+                if (rp_ >= capacity()) { rp_ = 0; }
+    4abf:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4ac3:	|      48 8b 58 10          	mov    0x10(%rax),%rbx
+    4ac7:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4acb:	|      48 89 c7             	mov    %rax,%rdi
+    4ace:	|      e8 37 0b 00 00       	call   560a <nel::heapless::Queue<int, 4096ul>::capacity() const>
+    4ad3:	|      48 39 c3             	cmp    %rax,%rbx
+    4ad6:	|      0f 93 c0             	setae  %al
+    4ad9:	|      84 c0                	test   %al,%al
+    4adb:	|  /-- 74 0c                	je     4ae9 <nel::heapless::Queue<int, 4096ul>::push(int&&)+0x63>
+    4add:	|  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4ae1:	|  |   48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+    4ae8:	|  |   00 
+                *ptr(wp_) = move(val);
+    4ae9:	|  \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4aed:	|      48 89 c7             	mov    %rax,%rdi
+    4af0:	|      e8 4e 0b 00 00       	call   5643 <int&& nel::move<int>(int&)>
+    4af5:	|      8b 18                	mov    (%rax),%ebx
+    4af7:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4afb:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    4aff:	|      48 89 c2             	mov    %rax,%rdx
+    4b02:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4b06:	|      48 89 d6             	mov    %rdx,%rsi
+    4b09:	|      48 89 c7             	mov    %rax,%rdi
+    4b0c:	|      e8 09 0b 00 00       	call   561a <nel::heapless::Queue<int, 4096ul>::ptr(long)>
+    4b11:	|      89 18                	mov    %ebx,(%rax)
+    4b13:	|  /-- eb 4c                	jmp    4b61 <nel::heapless::Queue<int, 4096ul>::push(int&&)+0xdb>
+            } else {
+                len_ += 1;
+    4b15:	\--|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4b19:	   |   48 8b 00             	mov    (%rax),%rax
+    4b1c:	   |   48 8d 50 01          	lea    0x1(%rax),%rdx
+    4b20:	   |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4b24:	   |   48 89 10             	mov    %rdx,(%rax)
+                new (ptr(wp_)) Type(move(val));
+    4b27:	   |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4b2b:	   |   48 8b 40 08          	mov    0x8(%rax),%rax
+    4b2f:	   |   48 89 c2             	mov    %rax,%rdx
+    4b32:	   |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4b36:	   |   48 89 d6             	mov    %rdx,%rsi
+    4b39:	   |   48 89 c7             	mov    %rax,%rdi
+    4b3c:	   |   e8 d9 0a 00 00       	call   561a <nel::heapless::Queue<int, 4096ul>::ptr(long)>
+    4b41:	   |   48 89 c6             	mov    %rax,%rsi
+    4b44:	   |   bf 04 00 00 00       	mov    $0x4,%edi
+    4b49:	   |   e8 cd f7 ff ff       	call   431b <operator new(unsigned long, void*)>
+    4b4e:	   |   48 89 c3             	mov    %rax,%rbx
+    4b51:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4b55:	   |   48 89 c7             	mov    %rax,%rdi
+    4b58:	   |   e8 e6 0a 00 00       	call   5643 <int&& nel::move<int>(int&)>
+    4b5d:	   |   8b 00                	mov    (%rax),%eax
+    4b5f:	   |   89 03                	mov    %eax,(%rbx)
+            }
+            wp_ += 1;
+    4b61:	   \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4b65:	       48 8b 40 08          	mov    0x8(%rax),%rax
+    4b69:	       48 8d 50 01          	lea    0x1(%rax),%rdx
+    4b6d:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4b71:	       48 89 50 08          	mov    %rdx,0x8(%rax)
+            if (wp_ >= capacity()) { wp_ = 0; }
+    4b75:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4b79:	       48 8b 58 08          	mov    0x8(%rax),%rbx
+    4b7d:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4b81:	       48 89 c7             	mov    %rax,%rdi
+    4b84:	       e8 81 0a 00 00       	call   560a <nel::heapless::Queue<int, 4096ul>::capacity() const>
+    4b89:	       48 39 c3             	cmp    %rax,%rbx
+    4b8c:	       0f 93 c0             	setae  %al
+    4b8f:	       84 c0                	test   %al,%al
+    4b91:	   /-- 74 0c                	je     4b9f <nel::heapless::Queue<int, 4096ul>::push(int&&)+0x119>
+    4b93:	   |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4b97:	   |   48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    4b9e:	   |   00 
+            return Result<void, Type>::Ok();
+    4b9f:	   \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4ba3:	       48 89 c7             	mov    %rax,%rdi
+    4ba6:	       e8 a6 0a 00 00       	call   5651 <nel::Result<void, int>::Ok()>
+#    endif
+        }
+    4bab:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4baf:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    4bb3:	       c9                   	leave
+    4bb4:	       c3                   	ret
+    4bb5:	       90                   	nop
+
+0000000000004bb6 <nel::Result<void, int>::~Result()>:
+        union {
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    4bb6:	             55                   	push   %rbp
+    4bb7:	             48 89 e5             	mov    %rsp,%rbp
+    4bba:	             48 83 ec 30          	sub    $0x30,%rsp
+    4bbe:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result<void>-dtor
+    4bc2:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4bc6:	             8b 00                	mov    (%rax),%eax
+    4bc8:	             83 f8 02             	cmp    $0x2,%eax
+    4bcb:	/----------- 74 43                	je     4c10 <nel::Result<void, int>::~Result()+0x5a>
+    4bcd:	|            83 f8 02             	cmp    $0x2,%eax
+    4bd0:	|        /-- 7f 09                	jg     4bdb <nel::Result<void, int>::~Result()+0x25>
+    4bd2:	|        |   85 c0                	test   %eax,%eax
+    4bd4:	|  /-----|-- 74 3d                	je     4c13 <nel::Result<void, int>::~Result()+0x5d>
+    4bd6:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    4bd9:	|  |  /--|-- 74 3b                	je     4c16 <nel::Result<void, int>::~Result()+0x60>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    4bdb:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    4bdf:	|  |  |      b9 dd 02 00 00       	mov    $0x2dd,%ecx
+    4be4:	|  |  |      48 8d 15 b6 36 00 00 	lea    0x36b6(%rip),%rdx        # 82a1 <queue_len+0xc1>
+    4beb:	|  |  |      48 8d 35 c1 36 00 00 	lea    0x36c1(%rip),%rsi        # 82b3 <queue_len+0xd3>
+    4bf2:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    4bf5:	|  |  |      e8 34 f7 ff ff       	call   432e <nel::Context::Context(char const*, char const*, int)>
+    4bfa:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    4bfe:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    4c01:	|  |  |      48 8d 05 b3 36 00 00 	lea    0x36b3(%rip),%rax        # 82bb <queue_len+0xdb>
+    4c08:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    4c0b:	|  |  |      e8 df 1b 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+                    break;
+    4c10:	\--|--|----> 90                   	nop
+    4c11:	   |  |  /-- eb 04                	jmp    4c17 <nel::Result<void, int>::~Result()+0x61>
+                    break;
+    4c13:	   \--|--|-> 90                   	nop
+    4c14:	      |  +-- eb 01                	jmp    4c17 <nel::Result<void, int>::~Result()+0x61>
+                    break;
+    4c16:	      \--|-> 90                   	nop
+                    break;
+            }
+        }
+    4c17:	         \-> 90                   	nop
+    4c18:	             c9                   	leave
+    4c19:	             c3                   	ret
+
+0000000000004c1a <nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}::operator()() const>:
+         *
+         * `this` is consumed by the operation.
+         */
+        constexpr void unwrap(Context const &ctx = Context())
+        {
+            return consumev([](void) {}, [](E &&) { nel::panic("not an ok"); }, ctx);
+    4c1a:	55                   	push   %rbp
+    4c1b:	48 89 e5             	mov    %rsp,%rbp
+    4c1e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4c22:	90                   	nop
+    4c23:	5d                   	pop    %rbp
+    4c24:	c3                   	ret
+    4c25:	90                   	nop
+
+0000000000004c26 <nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}::operator()(int&&) const>:
+    4c26:	55                   	push   %rbp
+    4c27:	48 89 e5             	mov    %rsp,%rbp
+    4c2a:	48 83 ec 30          	sub    $0x30,%rsp
+    4c2e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    4c32:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    4c36:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    4c3a:	b9 1f 04 00 00       	mov    $0x41f,%ecx
+    4c3f:	48 8d 15 5b 36 00 00 	lea    0x365b(%rip),%rdx        # 82a1 <queue_len+0xc1>
+    4c46:	48 8d 35 f6 34 00 00 	lea    0x34f6(%rip),%rsi        # 8143 <sizes+0xe3>
+    4c4d:	48 89 c7             	mov    %rax,%rdi
+    4c50:	e8 d9 f6 ff ff       	call   432e <nel::Context::Context(char const*, char const*, int)>
+    4c55:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    4c59:	48 89 c6             	mov    %rax,%rsi
+    4c5c:	48 8d 05 39 37 00 00 	lea    0x3739(%rip),%rax        # 839c <queue_len+0x1bc>
+    4c63:	48 89 c7             	mov    %rax,%rdi
+    4c66:	e8 84 1b 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+    4c6b:	90                   	nop
+
+0000000000004c6c <nel::Result<void, int>::unwrap(nel::Context const&)>:
+        constexpr void unwrap(Context const &ctx = Context())
+    4c6c:	55                   	push   %rbp
+    4c6d:	48 89 e5             	mov    %rsp,%rbp
+    4c70:	48 83 ec 20          	sub    $0x20,%rsp
+    4c74:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    4c78:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return consumev([](void) {}, [](E &&) { nel::panic("not an ok"); }, ctx);
+    4c7c:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    4c80:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    4c84:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    4c88:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4c8c:	48 89 c7             	mov    %rax,%rdi
+    4c8f:	e8 dc 09 00 00       	call   5670 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)>
+    4c94:	90                   	nop
+        }
+    4c95:	c9                   	leave
+    4c96:	c3                   	ret
+
+0000000000004c97 <nel::Slice<int>::empty()>:
+        static constexpr Slice empty(void)
+    4c97:	55                   	push   %rbp
+    4c98:	48 89 e5             	mov    %rsp,%rbp
+    4c9b:	48 83 ec 10          	sub    $0x10,%rsp
+    4c9f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Slice();
+    4ca3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4ca7:	48 89 c7             	mov    %rax,%rdi
+    4caa:	e8 07 00 00 00       	call   4cb6 <nel::Slice<int>::Slice()>
+        }
+    4caf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4cb3:	c9                   	leave
+    4cb4:	c3                   	ret
+    4cb5:	90                   	nop
+
+0000000000004cb6 <nel::Slice<int>::Slice()>:
+        constexpr Slice(void)
+    4cb6:	55                   	push   %rbp
+    4cb7:	48 89 e5             	mov    %rsp,%rbp
+    4cba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : content_(nullptr)
+    4cbe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4cc2:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+            , len_(0)
+    4cc9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4ccd:	48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    4cd4:	00 
+        }
+    4cd5:	90                   	nop
+    4cd6:	5d                   	pop    %rbp
+    4cd7:	c3                   	ret
+
+0000000000004cd8 <nel::heapless::Queue<int, 4096ul>::iter()>:
+        }
+
+    public:
+        typedef ChainIterator<SliceIterator<Type>> QueueIteratorMut;
+
+        QueueIteratorMut iter(void)
+    4cd8:	       55                   	push   %rbp
+    4cd9:	       48 89 e5             	mov    %rsp,%rbp
+    4cdc:	       53                   	push   %rbx
+    4cdd:	       48 81 ec d8 00 00 00 	sub    $0xd8,%rsp
+    4ce4:	       48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+    4ceb:	       48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+        {
+            if (len() == 0) {
+    4cf2:	       48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    4cf9:	       48 89 c7             	mov    %rax,%rdi
+    4cfc:	       e8 1b 0a 00 00       	call   571c <nel::heapless::Queue<int, 4096ul>::len() const>
+    4d01:	       48 85 c0             	test   %rax,%rax
+    4d04:	       0f 94 c0             	sete   %al
+    4d07:	       84 c0                	test   %al,%al
+    4d09:	   /-- 74 6e                	je     4d79 <nel::heapless::Queue<int, 4096ul>::iter()+0xa1>
+                auto s1 = Slice<Type>::empty();
+    4d0b:	   |   48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+    4d12:	   |   00 
+    4d13:	   |   48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+    4d1a:	   |   00 
+                auto s2 = s1;
+    4d1b:	   |   48 8b 45 80          	mov    -0x80(%rbp),%rax
+    4d1f:	   |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    4d23:	   |   48 89 85 70 ff ff ff 	mov    %rax,-0x90(%rbp)
+    4d2a:	   |   48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+                return QueueIteratorMut(s1.iter(), s2.iter());
+    4d31:	   |   48 8d 45 90          	lea    -0x70(%rbp),%rax
+    4d35:	   |   48 8d 95 70 ff ff ff 	lea    -0x90(%rbp),%rdx
+    4d3c:	   |   48 89 d6             	mov    %rdx,%rsi
+    4d3f:	   |   48 89 c7             	mov    %rax,%rdi
+    4d42:	   |   e8 e7 f8 ff ff       	call   462e <nel::Slice<int>::iter() const>
+    4d47:	   |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    4d4b:	   |   48 8d 55 80          	lea    -0x80(%rbp),%rdx
+    4d4f:	   |   48 89 d6             	mov    %rdx,%rsi
+    4d52:	   |   48 89 c7             	mov    %rax,%rdi
+    4d55:	   |   e8 d4 f8 ff ff       	call   462e <nel::Slice<int>::iter() const>
+    4d5a:	   |   48 8d 55 90          	lea    -0x70(%rbp),%rdx
+    4d5e:	   |   48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+    4d62:	   |   48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    4d69:	   |   48 89 ce             	mov    %rcx,%rsi
+    4d6c:	   |   48 89 c7             	mov    %rax,%rdi
+    4d6f:	   |   e8 50 05 00 00       	call   52c4 <nel::ChainIterator<nel::SliceIterator<int> >::ChainIterator(nel::SliceIterator<int>&&, nel::SliceIterator<int>&&)>
+            } else {
+                auto s1 = Slice(ptr(rp_), ptr(N));
+                auto s2 = Slice(ptr(), ptr(wp_));
+                return QueueIteratorMut(s1.iter(), s2.iter());
+            }
+        }
+    4d74:	/--|-- e9 ba 01 00 00       	jmp    4f33 <nel::heapless::Queue<int, 4096ul>::iter()+0x25b>
+            } else if (rp_ < wp_) {
+    4d79:	|  \-> 48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    4d80:	|      48 8b 50 10          	mov    0x10(%rax),%rdx
+    4d84:	|      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    4d8b:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    4d8f:	|      48 39 c2             	cmp    %rax,%rdx
+    4d92:	|  /-- 0f 83 bc 00 00 00    	jae    4e54 <nel::heapless::Queue<int, 4096ul>::iter()+0x17c>
+                auto s1 = Slice(ptr(rp_), ptr(wp_));
+    4d98:	|  |   48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    4d9f:	|  |   48 8b 40 08          	mov    0x8(%rax),%rax
+    4da3:	|  |   48 89 c2             	mov    %rax,%rdx
+    4da6:	|  |   48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    4dad:	|  |   48 89 d6             	mov    %rdx,%rsi
+    4db0:	|  |   48 89 c7             	mov    %rax,%rdi
+    4db3:	|  |   e8 62 08 00 00       	call   561a <nel::heapless::Queue<int, 4096ul>::ptr(long)>
+    4db8:	|  |   48 89 c3             	mov    %rax,%rbx
+    4dbb:	|  |   48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    4dc2:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    4dc6:	|  |   48 89 c2             	mov    %rax,%rdx
+    4dc9:	|  |   48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    4dd0:	|  |   48 89 d6             	mov    %rdx,%rsi
+    4dd3:	|  |   48 89 c7             	mov    %rax,%rdi
+    4dd6:	|  |   e8 3f 08 00 00       	call   561a <nel::heapless::Queue<int, 4096ul>::ptr(long)>
+    4ddb:	|  |   48 89 c1             	mov    %rax,%rcx
+    4dde:	|  |   48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+    4de5:	|  |   48 89 da             	mov    %rbx,%rdx
+    4de8:	|  |   48 89 ce             	mov    %rcx,%rsi
+    4deb:	|  |   48 89 c7             	mov    %rax,%rdi
+    4dee:	|  |   e8 3b 09 00 00       	call   572e <nel::Slice<int>::Slice(int*, int*)>
+                auto s2 = Slice<Type>::empty();
+    4df3:	|  |   48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+    4dfa:	|  |   00 00 00 00 
+    4dfe:	|  |   48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+    4e05:	|  |   00 00 00 00 
+                return QueueIteratorMut(s1.iter(), s2.iter());
+    4e09:	|  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    4e0d:	|  |   48 8d 95 50 ff ff ff 	lea    -0xb0(%rbp),%rdx
+    4e14:	|  |   48 89 d6             	mov    %rdx,%rsi
+    4e17:	|  |   48 89 c7             	mov    %rax,%rdi
+    4e1a:	|  |   e8 0f f8 ff ff       	call   462e <nel::Slice<int>::iter() const>
+    4e1f:	|  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    4e23:	|  |   48 8d 95 60 ff ff ff 	lea    -0xa0(%rbp),%rdx
+    4e2a:	|  |   48 89 d6             	mov    %rdx,%rsi
+    4e2d:	|  |   48 89 c7             	mov    %rax,%rdi
+    4e30:	|  |   e8 f9 f7 ff ff       	call   462e <nel::Slice<int>::iter() const>
+    4e35:	|  |   48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    4e39:	|  |   48 8d 4d c0          	lea    -0x40(%rbp),%rcx
+    4e3d:	|  |   48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    4e44:	|  |   48 89 ce             	mov    %rcx,%rsi
+    4e47:	|  |   48 89 c7             	mov    %rax,%rdi
+    4e4a:	|  |   e8 75 04 00 00       	call   52c4 <nel::ChainIterator<nel::SliceIterator<int> >::ChainIterator(nel::SliceIterator<int>&&, nel::SliceIterator<int>&&)>
+        }
+    4e4f:	+--|-- e9 df 00 00 00       	jmp    4f33 <nel::heapless::Queue<int, 4096ul>::iter()+0x25b>
+                auto s1 = Slice(ptr(rp_), ptr(N));
+    4e54:	|  \-> 48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    4e5b:	|      be 00 10 00 00       	mov    $0x1000,%esi
+    4e60:	|      48 89 c7             	mov    %rax,%rdi
+    4e63:	|      e8 b2 07 00 00       	call   561a <nel::heapless::Queue<int, 4096ul>::ptr(long)>
+    4e68:	|      48 89 c3             	mov    %rax,%rbx
+    4e6b:	|      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    4e72:	|      48 8b 40 10          	mov    0x10(%rax),%rax
+    4e76:	|      48 89 c2             	mov    %rax,%rdx
+    4e79:	|      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    4e80:	|      48 89 d6             	mov    %rdx,%rsi
+    4e83:	|      48 89 c7             	mov    %rax,%rdi
+    4e86:	|      e8 8f 07 00 00       	call   561a <nel::heapless::Queue<int, 4096ul>::ptr(long)>
+    4e8b:	|      48 89 c1             	mov    %rax,%rcx
+    4e8e:	|      48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+    4e95:	|      48 89 da             	mov    %rbx,%rdx
+    4e98:	|      48 89 ce             	mov    %rcx,%rsi
+    4e9b:	|      48 89 c7             	mov    %rax,%rdi
+    4e9e:	|      e8 8b 08 00 00       	call   572e <nel::Slice<int>::Slice(int*, int*)>
+                auto s2 = Slice(ptr(), ptr(wp_));
+    4ea3:	|      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    4eaa:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    4eae:	|      48 89 c2             	mov    %rax,%rdx
+    4eb1:	|      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    4eb8:	|      48 89 d6             	mov    %rdx,%rsi
+    4ebb:	|      48 89 c7             	mov    %rax,%rdi
+    4ebe:	|      e8 57 07 00 00       	call   561a <nel::heapless::Queue<int, 4096ul>::ptr(long)>
+    4ec3:	|      48 89 c3             	mov    %rax,%rbx
+    4ec6:	|      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    4ecd:	|      48 89 c7             	mov    %rax,%rdi
+    4ed0:	|      e8 8f 08 00 00       	call   5764 <nel::heapless::Queue<int, 4096ul>::ptr()>
+    4ed5:	|      48 89 c1             	mov    %rax,%rcx
+    4ed8:	|      48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    4edf:	|      48 89 da             	mov    %rbx,%rdx
+    4ee2:	|      48 89 ce             	mov    %rcx,%rsi
+    4ee5:	|      48 89 c7             	mov    %rax,%rdi
+    4ee8:	|      e8 41 08 00 00       	call   572e <nel::Slice<int>::Slice(int*, int*)>
+                return QueueIteratorMut(s1.iter(), s2.iter());
+    4eed:	|      48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    4ef1:	|      48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+    4ef8:	|      48 89 d6             	mov    %rdx,%rsi
+    4efb:	|      48 89 c7             	mov    %rax,%rdi
+    4efe:	|      e8 2b f7 ff ff       	call   462e <nel::Slice<int>::iter() const>
+    4f03:	|      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    4f07:	|      48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+    4f0e:	|      48 89 d6             	mov    %rdx,%rsi
+    4f11:	|      48 89 c7             	mov    %rax,%rdi
+    4f14:	|      e8 15 f7 ff ff       	call   462e <nel::Slice<int>::iter() const>
+    4f19:	|      48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    4f1d:	|      48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+    4f21:	|      48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    4f28:	|      48 89 ce             	mov    %rcx,%rsi
+    4f2b:	|      48 89 c7             	mov    %rax,%rdi
+    4f2e:	|      e8 91 03 00 00       	call   52c4 <nel::ChainIterator<nel::SliceIterator<int> >::ChainIterator(nel::SliceIterator<int>&&, nel::SliceIterator<int>&&)>
+        }
+    4f33:	\----> 48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    4f3a:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    4f3e:	       c9                   	leave
+    4f3f:	       c3                   	ret
+
+0000000000004f40 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>:
+         *
+         * @param initial The number of elements to initially allocate.
+         *
+         * @returns the vector.
+         */
+        static constexpr Vector with_capacity(Count cap)
+    4f40:	       55                   	push   %rbp
+    4f41:	       48 89 e5             	mov    %rsp,%rbp
+    4f44:	       48 83 ec 20          	sub    $0x20,%rsp
+    4f48:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    4f4c:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            if (cap == 0) { return Vector(); }
+    4f50:	       48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    4f55:	   /-- 75 0e                	jne    4f65 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x25>
+    4f57:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4f5b:	   |   48 89 c7             	mov    %rax,%rdi
+    4f5e:	   |   e8 6f 08 00 00       	call   57d2 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector()>
+    4f63:	/--|-- eb 3d                	jmp    4fa2 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x62>
+            Vector a(VectorNode::malloc(cap));
+    4f65:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4f69:	|      48 89 c7             	mov    %rax,%rdi
+    4f6c:	|      e8 77 08 00 00       	call   57e8 <nel::heaped::Node<int, nel::heaped::Malloc>::malloc(unsigned long)>
+    4f71:	|      48 89 c2             	mov    %rax,%rdx
+    4f74:	|      48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    4f78:	|      48 89 d6             	mov    %rdx,%rsi
+    4f7b:	|      48 89 c7             	mov    %rax,%rdi
+    4f7e:	|      e8 9f 08 00 00       	call   5822 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Node<int, nel::heaped::Malloc>*)>
+            return a;
+    4f83:	|      48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    4f87:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4f8b:	|      48 89 d6             	mov    %rdx,%rsi
+    4f8e:	|      48 89 c7             	mov    %rax,%rdi
+    4f91:	|      e8 a6 08 00 00       	call   583c <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >&&)>
+        }
+    4f96:	|      48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    4f9a:	|      48 89 c7             	mov    %rax,%rdi
+    4f9d:	|      e8 06 00 00 00       	call   4fa8 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    4fa2:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4fa6:	       c9                   	leave
+    4fa7:	       c3                   	ret
+
+0000000000004fa8 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>:
+        ~Vector(void)
+    4fa8:	55                   	push   %rbp
+    4fa9:	48 89 e5             	mov    %rsp,%rbp
+    4fac:	48 83 ec 10          	sub    $0x10,%rsp
+    4fb0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            VectorNode::free(item_);
+    4fb4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4fb8:	48 8b 00             	mov    (%rax),%rax
+    4fbb:	48 89 c7             	mov    %rax,%rdi
+    4fbe:	e8 c3 08 00 00       	call   5886 <nel::heaped::Node<int, nel::heaped::Malloc>::free(nel::heaped::Node<int, nel::heaped::Malloc>*)>
+        }
+    4fc3:	90                   	nop
+    4fc4:	c9                   	leave
+    4fc5:	c3                   	ret
+
+0000000000004fc6 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>:
+         *
+         * @param val The value to move into the vec.
+         * @returns if successful, Result<void, T>::Ok()
+         * @returns if unsuccessful, Result<void, T>::Err() holding val
+         */
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+    4fc6:	       55                   	push   %rbp
+    4fc7:	       48 89 e5             	mov    %rsp,%rbp
+    4fca:	       48 83 ec 30          	sub    $0x30,%rsp
+    4fce:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    4fd2:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    4fd6:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+        {
+            bool ok;
+            ok = try_reserve_for(1);
+    4fda:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4fde:	       be 01 00 00 00       	mov    $0x1,%esi
+    4fe3:	       48 89 c7             	mov    %rax,%rdi
+    4fe6:	       e8 e7 08 00 00       	call   58d2 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>
+    4feb:	       88 45 ff             	mov    %al,-0x1(%rbp)
+            if (!ok) { return Result<void, Type>::Err(val); }
+    4fee:	       0f b6 45 ff          	movzbl -0x1(%rbp),%eax
+    4ff2:	       83 f0 01             	xor    $0x1,%eax
+    4ff5:	       84 c0                	test   %al,%al
+    4ff7:	   /-- 74 15                	je     500e <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x48>
+    4ff9:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4ffd:	   |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    5001:	   |   48 89 d6             	mov    %rdx,%rsi
+    5004:	   |   48 89 c7             	mov    %rax,%rdi
+    5007:	   |   e8 31 09 00 00       	call   593d <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    500c:	/--|-- eb 3b                	jmp    5049 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x83>
+            if (item_ == nullptr) { return Result<void, Type>::Err(val); }
+    500e:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    5012:	|      48 8b 00             	mov    (%rax),%rax
+    5015:	|      48 85 c0             	test   %rax,%rax
+    5018:	|  /-- 75 15                	jne    502f <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x69>
+    501a:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    501e:	|  |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    5022:	|  |   48 89 d6             	mov    %rdx,%rsi
+    5025:	|  |   48 89 c7             	mov    %rax,%rdi
+    5028:	|  |   e8 10 09 00 00       	call   593d <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    502d:	+--|-- eb 1a                	jmp    5049 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x83>
+            return item_->push_back(val);
+    502f:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    5033:	|      48 8b 08             	mov    (%rax),%rcx
+    5036:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    503a:	|      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    503e:	|      48 89 ce             	mov    %rcx,%rsi
+    5041:	|      48 89 c7             	mov    %rax,%rdi
+    5044:	|      e8 29 09 00 00       	call   5972 <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int&>(int&)>
+        }
+    5049:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    504d:	       c9                   	leave
+    504e:	       c3                   	ret
+    504f:	       90                   	nop
+
+0000000000005050 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice(unsigned long, unsigned long)>:
+        constexpr Slice<Type> slice(Index b, Index e)
+    5050:	55                   	push   %rbp
+    5051:	48 89 e5             	mov    %rsp,%rbp
+    5054:	48 83 ec 30          	sub    $0x30,%rsp
+    5058:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    505c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    5060:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    5064:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            return slice().slice(b, e);
+    5068:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    506c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    5070:	48 89 d6             	mov    %rdx,%rsi
+    5073:	48 89 c7             	mov    %rax,%rdi
+    5076:	e8 1f 00 00 00       	call   509a <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()>
+    507b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    507f:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    5083:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    5087:	48 8d 75 f0          	lea    -0x10(%rbp),%rsi
+    508b:	48 89 c7             	mov    %rax,%rdi
+    508e:	e8 e5 f6 ff ff       	call   4778 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+        }
+    5093:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5097:	c9                   	leave
+    5098:	c3                   	ret
+    5099:	90                   	nop
+
+000000000000509a <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()>:
+        constexpr Slice<Type> slice(void)
+    509a:	       55                   	push   %rbp
+    509b:	       48 89 e5             	mov    %rsp,%rbp
+    509e:	       48 83 ec 10          	sub    $0x10,%rsp
+    50a2:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    50a6:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return (item_ == nullptr) ? Slice<Type>::empty() : item_->slice();
+    50aa:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    50ae:	       48 8b 00             	mov    (%rax),%rax
+    50b1:	       48 85 c0             	test   %rax,%rax
+    50b4:	   /-- 75 0e                	jne    50c4 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()+0x2a>
+    50b6:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    50ba:	   |   48 89 c7             	mov    %rax,%rdi
+    50bd:	   |   e8 d5 fb ff ff       	call   4c97 <nel::Slice<int>::empty()>
+    50c2:	/--|-- eb 16                	jmp    50da <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()+0x40>
+    50c4:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    50c8:	|      48 8b 10             	mov    (%rax),%rdx
+    50cb:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    50cf:	|      48 89 d6             	mov    %rdx,%rsi
+    50d2:	|      48 89 c7             	mov    %rax,%rdi
+    50d5:	|      e8 5c 09 00 00       	call   5a36 <nel::heaped::Node<int, nel::heaped::Malloc>::slice()>
+        }
+    50da:	\----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    50de:	       c9                   	leave
+    50df:	       c3                   	ret
+
+00000000000050e0 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>:
+constexpr U &&forward(T &t)
+    50e0:	55                   	push   %rbp
+    50e1:	48 89 e5             	mov    %rsp,%rbp
+    50e4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    50e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    50ec:	5d                   	pop    %rbp
+    50ed:	c3                   	ret
+
+00000000000050ee <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    50ee:	55                   	push   %rbp
+    50ef:	48 89 e5             	mov    %rsp,%rbp
+    50f2:	53                   	push   %rbx
+    50f3:	48 83 ec 18          	sub    $0x18,%rsp
+    50f7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    50fb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    50ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5103:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    5109:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    510d:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    5111:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    5115:	48 89 c7             	mov    %rax,%rdi
+    5118:	e8 c3 ff ff ff       	call   50e0 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    511d:	48 89 c6             	mov    %rax,%rsi
+    5120:	48 89 df             	mov    %rbx,%rdi
+    5123:	e8 4a 09 00 00       	call   5a72 <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>
+        }
+    5128:	90                   	nop
+    5129:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    512d:	c9                   	leave
+    512e:	c3                   	ret
+
+000000000000512f <void* const& nel::forward<void* const&, void* const>(void* const&)>:
+constexpr U &&forward(T &t)
+    512f:	55                   	push   %rbp
+    5130:	48 89 e5             	mov    %rsp,%rbp
+    5133:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    5137:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    513b:	5d                   	pop    %rbp
+    513c:	c3                   	ret
+    513d:	90                   	nop
+
+000000000000513e <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>:
+        constexpr Result(Phantom<Tag::OK> const, Args &&...args)
+    513e:	55                   	push   %rbp
+    513f:	48 89 e5             	mov    %rsp,%rbp
+    5142:	53                   	push   %rbx
+    5143:	48 83 ec 18          	sub    $0x18,%rsp
+    5147:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    514b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    514f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5153:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<Args>(args)...)
+    5159:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    515d:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    5161:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    5165:	48 89 c7             	mov    %rax,%rdi
+    5168:	e8 c2 ff ff ff       	call   512f <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    516d:	48 89 c6             	mov    %rax,%rsi
+    5170:	48 89 df             	mov    %rbx,%rdi
+    5173:	e8 22 09 00 00       	call   5a9a <nel::Element<void*>::Element<void* const&>(void* const&)>
+        }
+    5178:	90                   	nop
+    5179:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    517d:	c9                   	leave
+    517e:	c3                   	ret
+    517f:	90                   	nop
+
+0000000000005180 <nel::SliceIterator<int>::SliceIterator(int*, unsigned long)>:
+        constexpr SliceIterator(T arr[], Count len)
+    5180:	55                   	push   %rbp
+    5181:	48 89 e5             	mov    %rsp,%rbp
+    5184:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5188:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    518c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : b_(arr)
+    5190:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5194:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    5198:	48 89 10             	mov    %rdx,(%rax)
+            , e_(arr + len)
+    519b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    519f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    51a6:	00 
+    51a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    51ab:	48 01 c2             	add    %rax,%rdx
+    51ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    51b2:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    51b6:	90                   	nop
+    51b7:	5d                   	pop    %rbp
+    51b8:	c3                   	ret
+    51b9:	90                   	nop
+
+00000000000051ba <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>:
+        constexpr ItT &self(void)
+    51ba:	55                   	push   %rbp
+    51bb:	48 89 e5             	mov    %rsp,%rbp
+    51be:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    51c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    51c6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    51ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    51ce:	5d                   	pop    %rbp
+    51cf:	c3                   	ret
+
+00000000000051d0 <nel::SliceIterator<int>::next()>:
+        Optional<OutT> next(void)
+    51d0:	       55                   	push   %rbp
+    51d1:	       48 89 e5             	mov    %rsp,%rbp
+    51d4:	       48 83 ec 10          	sub    $0x10,%rsp
+    51d8:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    51dc:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            if (b_ == e_) { return None; }
+    51e0:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    51e4:	       48 8b 10             	mov    (%rax),%rdx
+    51e7:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    51eb:	       48 8b 40 08          	mov    0x8(%rax),%rax
+    51ef:	       48 39 c2             	cmp    %rax,%rdx
+    51f2:	   /-- 75 18                	jne    520c <nel::SliceIterator<int>::next()+0x3c>
+    51f4:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    51f8:	   |   48 8d 15 31 2e 00 00 	lea    0x2e31(%rip),%rdx        # 8030 <nel::None>
+    51ff:	   |   48 89 d6             	mov    %rdx,%rsi
+    5202:	   |   48 89 c7             	mov    %rax,%rdi
+    5205:	   |   e8 ba 08 00 00       	call   5ac4 <nel::Optional<int&>::Optional(nel::NoneT const&)>
+    520a:	/--|-- eb 21                	jmp    522d <nel::SliceIterator<int>::next()+0x5d>
+            return Some(*b_++);
+    520c:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5210:	|      48 8b 00             	mov    (%rax),%rax
+    5213:	|      48 8d 48 04          	lea    0x4(%rax),%rcx
+    5217:	|      48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    521b:	|      48 89 0a             	mov    %rcx,(%rdx)
+    521e:	|      48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    5222:	|      48 89 c6             	mov    %rax,%rsi
+    5225:	|      48 89 d7             	mov    %rdx,%rdi
+    5228:	|      e8 b0 08 00 00       	call   5add <nel::Optional<int&> nel::Some<int&>(int&)>
+        }
+    522d:	\----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5231:	       c9                   	leave
+    5232:	       c3                   	ret
+    5233:	       90                   	nop
+
+0000000000005234 <nel::Element<int&>::operator*() const>:
+        constexpr Type &ref(void)
+        {
+            return value_;
+        }
+
+        constexpr Type const &operator*(void) const
+    5234:	55                   	push   %rbp
+    5235:	48 89 e5             	mov    %rsp,%rbp
+    5238:	48 83 ec 10          	sub    $0x10,%rsp
+    523c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    5240:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5244:	48 89 c7             	mov    %rax,%rdi
+    5247:	e8 c6 08 00 00       	call   5b12 <nel::Element<int&>::ref() const>
+        }
+    524c:	c9                   	leave
+    524d:	c3                   	ret
+
+000000000000524e <nel::SliceIterator<int>::inc()>:
+
+        void inc(void)
+    524e:	55                   	push   %rbp
+    524f:	48 89 e5             	mov    %rsp,%rbp
+    5252:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            ++b_;
+    5256:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    525a:	48 8b 00             	mov    (%rax),%rax
+    525d:	48 8d 50 04          	lea    0x4(%rax),%rdx
+    5261:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5265:	48 89 10             	mov    %rdx,(%rax)
+        }
+    5268:	90                   	nop
+    5269:	5d                   	pop    %rbp
+    526a:	c3                   	ret
+    526b:	90                   	nop
+
+000000000000526c <nel::SliceIterator<int>::deref()>:
+
+        OutT deref(void)
+    526c:	55                   	push   %rbp
+    526d:	48 89 e5             	mov    %rsp,%rbp
+    5270:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return *b_;
+    5274:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5278:	48 8b 00             	mov    (%rax),%rax
+        }
+    527b:	5d                   	pop    %rbp
+    527c:	c3                   	ret
+
+000000000000527d <nel::SliceIterator<int>&& nel::move<nel::SliceIterator<int> >(nel::SliceIterator<int>&)>:
+constexpr T &&move(T &v)
+    527d:	55                   	push   %rbp
+    527e:	48 89 e5             	mov    %rsp,%rbp
+    5281:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    5285:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    5289:	5d                   	pop    %rbp
+    528a:	c3                   	ret
+
+000000000000528b <unsigned long&& nel::move<unsigned long>(unsigned long&)>:
+constexpr T &&move(T &v)
+    528b:	55                   	push   %rbp
+    528c:	48 89 e5             	mov    %rsp,%rbp
+    528f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    5293:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    5297:	5d                   	pop    %rbp
+    5298:	c3                   	ret
+    5299:	90                   	nop
+
+000000000000529a <nel::Slice<int>::Slice(int*, unsigned long)>:
+        constexpr Slice(Type *const p, Length len)
+    529a:	55                   	push   %rbp
+    529b:	48 89 e5             	mov    %rsp,%rbp
+    529e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    52a2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    52a6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : content_(p)
+    52aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    52ae:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    52b2:	48 89 10             	mov    %rdx,(%rax)
+            , len_(len)
+    52b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    52b9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    52bd:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    52c1:	90                   	nop
+    52c2:	5d                   	pop    %rbp
+    52c3:	c3                   	ret
+
+00000000000052c4 <nel::ChainIterator<nel::SliceIterator<int> >::ChainIterator(nel::SliceIterator<int>&&, nel::SliceIterator<int>&&)>:
+        constexpr ChainIterator(It &&it1, It &&it2)
+    52c4:	55                   	push   %rbp
+    52c5:	48 89 e5             	mov    %rsp,%rbp
+    52c8:	53                   	push   %rbx
+    52c9:	48 83 ec 28          	sub    $0x28,%rsp
+    52cd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    52d1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    52d5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            : it1_(move(it1))
+    52d9:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    52dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    52e1:	48 89 c7             	mov    %rax,%rdi
+    52e4:	e8 94 ff ff ff       	call   527d <nel::SliceIterator<int>&& nel::move<nel::SliceIterator<int> >(nel::SliceIterator<int>&)>
+    52e9:	48 89 c6             	mov    %rax,%rsi
+    52ec:	48 89 df             	mov    %rbx,%rdi
+    52ef:	e8 30 08 00 00       	call   5b24 <nel::SliceIterator<int>::SliceIterator(nel::SliceIterator<int>&&)>
+            , it2_(move(it2))
+    52f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    52f8:	48 8d 58 10          	lea    0x10(%rax),%rbx
+    52fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    5300:	48 89 c7             	mov    %rax,%rdi
+    5303:	e8 75 ff ff ff       	call   527d <nel::SliceIterator<int>&& nel::move<nel::SliceIterator<int> >(nel::SliceIterator<int>&)>
+    5308:	48 89 c6             	mov    %rax,%rsi
+    530b:	48 89 df             	mov    %rbx,%rdi
+    530e:	e8 11 08 00 00       	call   5b24 <nel::SliceIterator<int>::SliceIterator(nel::SliceIterator<int>&&)>
+        }
+    5313:	90                   	nop
+    5314:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    5318:	c9                   	leave
+    5319:	c3                   	ret
+
+000000000000531a <nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}::operator()(int&) const>:
+        }
+
+        template<typename Fn>
+        Optional or_else(Fn &&fn, Context const &ctx = Context())
+        {
+            return consume<Optional>([](T &&some)
+    531a:	55                   	push   %rbp
+    531b:	48 89 e5             	mov    %rsp,%rbp
+    531e:	48 83 ec 20          	sub    $0x20,%rsp
+    5322:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5326:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    532a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+                                         -> Optional { return Optional::Some(forward<T>(some)); },
+    532e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5332:	48 89 c7             	mov    %rax,%rdi
+    5335:	e8 79 08 00 00       	call   5bb3 <int& nel::forward<int&, int>(int&)>
+    533a:	48 89 c2             	mov    %rax,%rdx
+    533d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5341:	48 89 d6             	mov    %rdx,%rsi
+    5344:	48 89 c7             	mov    %rax,%rdi
+    5347:	e8 33 08 00 00       	call   5b7f <nel::Optional<int&>::Some(int&)>
+            return consume<Optional>([](T &&some)
+    534c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5350:	c9                   	leave
+    5351:	c3                   	ret
+
+0000000000005352 <nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}::operator()() const>:
+                                     [&fn](void) -> Optional { return fn(); },
+    5352:	55                   	push   %rbp
+    5353:	48 89 e5             	mov    %rsp,%rbp
+    5356:	48 83 ec 10          	sub    $0x10,%rsp
+    535a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    535e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    5362:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5366:	48 8b 10             	mov    (%rax),%rdx
+    5369:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    536d:	48 89 d6             	mov    %rdx,%rsi
+    5370:	48 89 c7             	mov    %rax,%rdi
+    5373:	e8 f0 f4 ff ff       	call   4868 <nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}::operator()() const>
+    5378:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    537c:	c9                   	leave
+    537d:	c3                   	ret
+
+000000000000537e <nel::Optional<int&> nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)>:
+        Optional or_else(Fn &&fn, Context const &ctx = Context())
+    537e:	55                   	push   %rbp
+    537f:	48 89 e5             	mov    %rsp,%rbp
+    5382:	48 83 ec 30          	sub    $0x30,%rsp
+    5386:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    538a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    538e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    5392:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+                                     [&fn](void) -> Optional { return fn(); },
+    5396:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    539a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+                                     ctx);
+    539e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    53a2:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    53a6:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+    53aa:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    53ae:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+    53b2:	49 89 f8             	mov    %rdi,%r8
+    53b5:	48 89 c7             	mov    %rax,%rdi
+    53b8:	e8 05 08 00 00       	call   5bc2 <nel::Optional<int&> nel::Optional<int&>::consume<nel::Optional<int&>, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)>
+        }
+    53bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    53c1:	c9                   	leave
+    53c2:	c3                   	ret
+    53c3:	90                   	nop
+
+00000000000053c4 <int& nel::Optional<int&>::consume<int&, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_some, Fn2 &&on_none, Context const &ctx = Context())
+    53c4:	             55                   	push   %rbp
+    53c5:	             48 89 e5             	mov    %rsp,%rbp
+    53c8:	             48 83 ec 30          	sub    $0x30,%rsp
+    53cc:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    53d0:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    53d4:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    53d8:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    53dc:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    53e0:	             8b 00                	mov    (%rax),%eax
+    53e2:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    53e5:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    53e9:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // optional::consume
+    53ef:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    53f3:	         /-- 74 14                	je     5409 <int& nel::Optional<int&>::consume<int&, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x45>
+    53f5:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    53f9:	/--------|-- 7f 5e                	jg     5459 <int& nel::Optional<int&>::consume<int&, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x95>
+    53fb:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    53ff:	|  /-----|-- 74 42                	je     5443 <int& nel::Optional<int&>::consume<int&, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x7f>
+    5401:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    5405:	|  |  /--|-- 74 2e                	je     5435 <int& nel::Optional<int&>::consume<int&, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x71>
+    5407:	+--|--|--|-- eb 50                	jmp    5459 <int& nel::Optional<int&>::consume<int&, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x95>
+                    return on_some(forward<T>(*some_));
+    5409:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    540d:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    5411:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    5414:	|  |  |      e8 69 08 00 00       	call   5c82 <nel::Element<int&>::operator*()>
+    5419:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    541c:	|  |  |      e8 92 07 00 00       	call   5bb3 <int& nel::forward<int&, int>(int&)>
+    5421:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    5424:	|  |  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    5428:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    542b:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    542e:	|  |  |      e8 3d f5 ff ff       	call   4970 <nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}::operator()(int&) const>
+    5433:	|  |  |  /-- eb 3a                	jmp    546f <int& nel::Optional<int&>::consume<int&, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0xab>
+                    return on_none();
+    5435:	|  |  \--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    5439:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    543c:	|  |     |   e8 41 f5 ff ff       	call   4982 <nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}::operator()() const>
+    5441:	|  |     +-- eb 2c                	jmp    546f <int& nel::Optional<int&>::consume<int&, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::unwrap(nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0xab>
+                    nel::panic("invalid Optional", ctx);
+    5443:	|  \-----|-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    5447:	|        |   48 89 c6             	mov    %rax,%rsi
+    544a:	|        |   48 8d 05 91 2e 00 00 	lea    0x2e91(%rip),%rax        # 82e2 <queue_len+0x102>
+    5451:	|        |   48 89 c7             	mov    %rax,%rdi
+    5454:	|        |   e8 96 13 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Optional", ctx);
+    5459:	\--------|-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    545d:	         |   48 89 c6             	mov    %rax,%rsi
+    5460:	         |   48 8d 05 8c 2e 00 00 	lea    0x2e8c(%rip),%rax        # 82f3 <queue_len+0x113>
+    5467:	         |   48 89 c7             	mov    %rax,%rdi
+    546a:	         |   e8 80 13 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+        }
+    546f:	         \-> c9                   	leave
+    5470:	             c3                   	ret
+    5471:	             90                   	nop
+
+0000000000005472 <nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::self()>:
+        constexpr ItT &self(void)
+    5472:	55                   	push   %rbp
+    5473:	48 89 e5             	mov    %rsp,%rbp
+    5476:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    547a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    547e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    5482:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    5486:	5d                   	pop    %rbp
+    5487:	c3                   	ret
+
+0000000000005488 <nel::ChainIterator<nel::SliceIterator<int> >::inc()>:
+        void inc(void)
+    5488:	       55                   	push   %rbp
+    5489:	       48 89 e5             	mov    %rsp,%rbp
+    548c:	       48 83 ec 10          	sub    $0x10,%rsp
+    5490:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            if (!it1_.is_done()) {
+    5494:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5498:	       48 89 c7             	mov    %rax,%rdi
+    549b:	       e8 74 f0 ff ff       	call   4514 <nel::SliceIterator<int>::is_done() const>
+    54a0:	       83 f0 01             	xor    $0x1,%eax
+    54a3:	       84 c0                	test   %al,%al
+    54a5:	   /-- 74 0e                	je     54b5 <nel::ChainIterator<nel::SliceIterator<int> >::inc()+0x2d>
+                it1_.inc();
+    54a7:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    54ab:	   |   48 89 c7             	mov    %rax,%rdi
+    54ae:	   |   e8 9b fd ff ff       	call   524e <nel::SliceIterator<int>::inc()>
+        }
+    54b3:	/--|-- eb 10                	jmp    54c5 <nel::ChainIterator<nel::SliceIterator<int> >::inc()+0x3d>
+                it2_.inc();
+    54b5:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    54b9:	|      48 83 c0 10          	add    $0x10,%rax
+    54bd:	|      48 89 c7             	mov    %rax,%rdi
+    54c0:	|      e8 89 fd ff ff       	call   524e <nel::SliceIterator<int>::inc()>
+        }
+    54c5:	\----> 90                   	nop
+    54c6:	       c9                   	leave
+    54c7:	       c3                   	ret
+
+00000000000054c8 <nel::ChainIterator<nel::SliceIterator<int> >::deref()>:
+        OutT deref(void)
+    54c8:	       55                   	push   %rbp
+    54c9:	       48 89 e5             	mov    %rsp,%rbp
+    54cc:	       48 83 ec 10          	sub    $0x10,%rsp
+    54d0:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (!it1_.is_done()) ? it1_.deref() : it2_.deref();
+    54d4:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    54d8:	       48 89 c7             	mov    %rax,%rdi
+    54db:	       e8 34 f0 ff ff       	call   4514 <nel::SliceIterator<int>::is_done() const>
+    54e0:	       83 f0 01             	xor    $0x1,%eax
+    54e3:	       84 c0                	test   %al,%al
+    54e5:	   /-- 74 0e                	je     54f5 <nel::ChainIterator<nel::SliceIterator<int> >::deref()+0x2d>
+    54e7:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    54eb:	   |   48 89 c7             	mov    %rax,%rdi
+    54ee:	   |   e8 79 fd ff ff       	call   526c <nel::SliceIterator<int>::deref()>
+    54f3:	/--|-- eb 10                	jmp    5505 <nel::ChainIterator<nel::SliceIterator<int> >::deref()+0x3d>
+    54f5:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    54f9:	|      48 83 c0 10          	add    $0x10,%rax
+    54fd:	|      48 89 c7             	mov    %rax,%rdi
+    5500:	|      e8 67 fd ff ff       	call   526c <nel::SliceIterator<int>::deref()>
+        }
+    5505:	\----> c9                   	leave
+    5506:	       c3                   	ret
+    5507:	       90                   	nop
+
+0000000000005508 <nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::rev()>:
+        constexpr RevIterator<ItT> rev(void)
+    5508:	55                   	push   %rbp
+    5509:	48 89 e5             	mov    %rsp,%rbp
+    550c:	48 83 ec 10          	sub    $0x10,%rsp
+    5510:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5514:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return RevIterator<ItT>(move(self()));
+    5518:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    551c:	48 89 c7             	mov    %rax,%rdi
+    551f:	e8 4e ff ff ff       	call   5472 <nel::Iterator<nel::ChainIterator<nel::SliceIterator<int> >, int&, int&>::self()>
+    5524:	48 89 c7             	mov    %rax,%rdi
+    5527:	e8 56 02 00 00       	call   5782 <nel::ChainIterator<nel::SliceIterator<int> >&& nel::move<nel::ChainIterator<nel::SliceIterator<int> > >(nel::ChainIterator<nel::SliceIterator<int> >&)>
+    552c:	48 89 c2             	mov    %rax,%rdx
+    552f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5533:	48 89 d6             	mov    %rdx,%rsi
+    5536:	48 89 c7             	mov    %rax,%rdi
+    5539:	e8 5e 07 00 00       	call   5c9c <nel::RevIterator<nel::ChainIterator<nel::SliceIterator<int> > >::RevIterator(nel::ChainIterator<nel::SliceIterator<int> >&&)>
+        }
+    553e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5542:	c9                   	leave
+    5543:	c3                   	ret
+
+0000000000005544 <void nel::Iterator<nel::RevIterator<nel::ChainIterator<nel::SliceIterator<int> > >, int&, int&>::for_each<nel::heapless::Queue<int, 4096ul>::~Queue()::{lambda(auto:1&)#1}>(nel::heapless::Queue<int, 4096ul>::~Queue()::{lambda(auto:1&)#1}&&)>:
+        void for_each(F &&fn)
+    5544:	          55                   	push   %rbp
+    5545:	          48 89 e5             	mov    %rsp,%rbp
+    5548:	          53                   	push   %rbx
+    5549:	          48 83 ec 48          	sub    $0x48,%rsp
+    554d:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    5551:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+                Optional<OutT> r = self().next();
+    5555:	/-------> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    5559:	|         48 89 c7             	mov    %rax,%rdi
+    555c:	|         e8 6f 07 00 00       	call   5cd0 <nel::Iterator<nel::RevIterator<nel::ChainIterator<nel::SliceIterator<int> > >, int&, int&>::self()>
+    5561:	|         48 89 c2             	mov    %rax,%rdx
+    5564:	|         48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    5568:	|         48 89 d6             	mov    %rdx,%rsi
+    556b:	|         48 89 c7             	mov    %rax,%rdi
+    556e:	|         e8 73 07 00 00       	call   5ce6 <nel::RevIterator<nel::ChainIterator<nel::SliceIterator<int> > >::next()>
+                if (r.is_none()) { break; }
+    5573:	|         48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    5577:	|         48 89 c7             	mov    %rax,%rdi
+    557a:	|         e8 1f f1 ff ff       	call   469e <nel::Optional<int&>::is_none() const>
+    557f:	|         84 c0                	test   %al,%al
+    5581:	|     /-- 74 07                	je     558a <void nel::Iterator<nel::RevIterator<nel::ChainIterator<nel::SliceIterator<int> > >, int&, int&>::for_each<nel::heapless::Queue<int, 4096ul>::~Queue()::{lambda(auto:1&)#1}>(nel::heapless::Queue<int, 4096ul>::~Queue()::{lambda(auto:1&)#1}&&)+0x46>
+    5583:	|     |   bb 00 00 00 00       	mov    $0x0,%ebx
+    5588:	|  /--|-- eb 49                	jmp    55d3 <void nel::Iterator<nel::RevIterator<nel::ChainIterator<nel::SliceIterator<int> > >, int&, int&>::for_each<nel::heapless::Queue<int, 4096ul>::~Queue()::{lambda(auto:1&)#1}>(nel::heapless::Queue<int, 4096ul>::~Queue()::{lambda(auto:1&)#1}&&)+0x8f>
+                fn(r.unwrap());
+    558a:	|  |  \-> 48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    558e:	|  |      b9 ef 00 00 00       	mov    $0xef,%ecx
+    5593:	|  |      48 8d 15 66 2d 00 00 	lea    0x2d66(%rip),%rdx        # 8300 <queue_len+0x120>
+    559a:	|  |      48 8d 35 6f 2e 00 00 	lea    0x2e6f(%rip),%rsi        # 8410 <queue_len+0x230>
+    55a1:	|  |      48 89 c7             	mov    %rax,%rdi
+    55a4:	|  |      e8 85 ed ff ff       	call   432e <nel::Context::Context(char const*, char const*, int)>
+    55a9:	|  |      48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    55ad:	|  |      48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    55b1:	|  |      48 89 d6             	mov    %rdx,%rsi
+    55b4:	|  |      48 89 c7             	mov    %rax,%rdi
+    55b7:	|  |      e8 ec f3 ff ff       	call   49a8 <nel::Optional<int&>::unwrap(nel::Context const&)>
+    55bc:	|  |      48 89 c2             	mov    %rax,%rdx
+    55bf:	|  |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    55c3:	|  |      48 89 d6             	mov    %rdx,%rsi
+    55c6:	|  |      48 89 c7             	mov    %rax,%rdi
+    55c9:	|  |      e8 42 07 00 00       	call   5d10 <void nel::heapless::Queue<int, 4096ul>::~Queue()::{lambda(auto:1&)#1}::operator()<int>(int&) const>
+            while (true) {
+    55ce:	|  |      bb 01 00 00 00       	mov    $0x1,%ebx
+    55d3:	|  \----> 48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    55d7:	|         48 89 c7             	mov    %rax,%rdi
+    55da:	|         e8 2d f3 ff ff       	call   490c <nel::Optional<int&>::~Optional()>
+    55df:	|         83 fb 01             	cmp    $0x1,%ebx
+    55e2:	|     /-- 75 05                	jne    55e9 <void nel::Iterator<nel::RevIterator<nel::ChainIterator<nel::SliceIterator<int> > >, int&, int&>::for_each<nel::heapless::Queue<int, 4096ul>::~Queue()::{lambda(auto:1&)#1}>(nel::heapless::Queue<int, 4096ul>::~Queue()::{lambda(auto:1&)#1}&&)+0xa5>
+    55e4:	\-----|-- e9 6c ff ff ff       	jmp    5555 <void nel::Iterator<nel::RevIterator<nel::ChainIterator<nel::SliceIterator<int> > >, int&, int&>::for_each<nel::heapless::Queue<int, 4096ul>::~Queue()::{lambda(auto:1&)#1}>(nel::heapless::Queue<int, 4096ul>::~Queue()::{lambda(auto:1&)#1}&&)+0x11>
+        }
+    55e9:	      \-> 90                   	nop
+    55ea:	          48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    55ee:	          c9                   	leave
+    55ef:	          c3                   	ret
+
+00000000000055f0 <nel::heapless::Queue<int, 4096ul>::is_full() const>:
+        constexpr bool is_full(void) const
+    55f0:	55                   	push   %rbp
+    55f1:	48 89 e5             	mov    %rsp,%rbp
+    55f4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_ == N;
+    55f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    55fc:	48 8b 00             	mov    (%rax),%rax
+    55ff:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+    5605:	0f 94 c0             	sete   %al
+        }
+    5608:	5d                   	pop    %rbp
+    5609:	c3                   	ret
+
+000000000000560a <nel::heapless::Queue<int, 4096ul>::capacity() const>:
+        constexpr Length capacity(void) const
+    560a:	55                   	push   %rbp
+    560b:	48 89 e5             	mov    %rsp,%rbp
+    560e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return N;
+    5612:	b8 00 10 00 00       	mov    $0x1000,%eax
+        }
+    5617:	5d                   	pop    %rbp
+    5618:	c3                   	ret
+    5619:	90                   	nop
+
+000000000000561a <nel::heapless::Queue<int, 4096ul>::ptr(long)>:
+        constexpr Type *ptr(ptrdiff_t d)
+    561a:	55                   	push   %rbp
+    561b:	48 89 e5             	mov    %rsp,%rbp
+    561e:	48 83 ec 10          	sub    $0x10,%rsp
+    5622:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5626:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return &ptr()[d];
+    562a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    562e:	48 89 c7             	mov    %rax,%rdi
+    5631:	e8 2e 01 00 00       	call   5764 <nel::heapless::Queue<int, 4096ul>::ptr()>
+    5636:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    563a:	48 c1 e2 02          	shl    $0x2,%rdx
+    563e:	48 01 d0             	add    %rdx,%rax
+        }
+    5641:	c9                   	leave
+    5642:	c3                   	ret
+
+0000000000005643 <int&& nel::move<int>(int&)>:
+constexpr T &&move(T &v)
+    5643:	55                   	push   %rbp
+    5644:	48 89 e5             	mov    %rsp,%rbp
+    5647:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    564b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    564f:	5d                   	pop    %rbp
+    5650:	c3                   	ret
+
+0000000000005651 <nel::Result<void, int>::Ok()>:
+        constexpr static Result Ok(void)
+    5651:	55                   	push   %rbp
+    5652:	48 89 e5             	mov    %rsp,%rbp
+    5655:	48 83 ec 10          	sub    $0x10,%rsp
+    5659:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Result(Phantom<Tag::OK>());
+    565d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5661:	48 89 c7             	mov    %rax,%rdi
+    5664:	e8 b7 06 00 00       	call   5d20 <nel::Result<void, int>::Result(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)1>)>
+        }
+    5669:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    566d:	c9                   	leave
+    566e:	c3                   	ret
+    566f:	90                   	nop
+
+0000000000005670 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)>:
+        constexpr void consumev(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    5670:	             55                   	push   %rbp
+    5671:	             48 89 e5             	mov    %rsp,%rbp
+    5674:	             48 83 ec 30          	sub    $0x30,%rsp
+    5678:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    567c:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    5680:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    5684:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    5688:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    568c:	             8b 00                	mov    (%rax),%eax
+    568e:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    5691:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5695:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result<void>-consume
+    569b:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    569f:	         /-- 74 20                	je     56c1 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)+0x51>
+    56a1:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    56a5:	/--------|-- 7f 5c                	jg     5703 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)+0x93>
+    56a7:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    56ab:	|     /--|-- 74 40                	je     56ed <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)+0x7d>
+    56ad:	|     |  |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    56b1:	+-----|--|-- 75 50                	jne    5703 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)+0x93>
+                    on_ok();
+    56b3:	|     |  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    56b7:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    56ba:	|     |  |   e8 5b f5 ff ff       	call   4c1a <nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}::operator()() const>
+                    break;
+    56bf:	|  /--|--|-- eb 58                	jmp    5719 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)+0xa9>
+                    on_err(nel::forward<E>(*err_));
+    56c1:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    56c5:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    56c9:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    56cc:	|  |  |      e8 65 06 00 00       	call   5d36 <nel::Element<int>::operator*()>
+    56d1:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    56d4:	|  |  |      e8 77 06 00 00       	call   5d50 <int&& nel::forward<int, int>(int&)>
+    56d9:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    56dc:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    56e0:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    56e3:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    56e6:	|  |  |      e8 3b f5 ff ff       	call   4c26 <nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}::operator()(int&&) const>
+                    break;
+    56eb:	|  +--|----- eb 2c                	jmp    5719 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)+0xa9>
+                    nel::panic("invalid Result", ctx);
+    56ed:	|  |  \----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    56f1:	|  |         48 89 c6             	mov    %rax,%rsi
+    56f4:	|  |         48 8d 05 5d 2d 00 00 	lea    0x2d5d(%rip),%rax        # 8458 <queue_len+0x278>
+    56fb:	|  |         48 89 c7             	mov    %rax,%rdi
+    56fe:	|  |         e8 ec 10 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    5703:	\--|-------> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    5707:	   |         48 89 c6             	mov    %rax,%rsi
+    570a:	   |         48 8d 05 aa 2b 00 00 	lea    0x2baa(%rip),%rax        # 82bb <queue_len+0xdb>
+    5711:	   |         48 89 c7             	mov    %rax,%rdi
+    5714:	   |         e8 d6 10 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+        }
+    5719:	   \-------> 90                   	nop
+    571a:	             c9                   	leave
+    571b:	             c3                   	ret
+
+000000000000571c <nel::heapless::Queue<int, 4096ul>::len() const>:
+        constexpr Length len(void) const
+    571c:	55                   	push   %rbp
+    571d:	48 89 e5             	mov    %rsp,%rbp
+    5720:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    5724:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5728:	48 8b 00             	mov    (%rax),%rax
+        }
+    572b:	5d                   	pop    %rbp
+    572c:	c3                   	ret
+    572d:	90                   	nop
+
+000000000000572e <nel::Slice<int>::Slice(int*, int*)>:
+        constexpr Slice(Type *const b, Type *const e)
+    572e:	55                   	push   %rbp
+    572f:	48 89 e5             	mov    %rsp,%rbp
+    5732:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5736:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    573a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : content_(b)
+    573e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5742:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    5746:	48 89 10             	mov    %rdx,(%rax)
+            , len_(e - b)
+    5749:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    574d:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+    5751:	48 c1 f8 02          	sar    $0x2,%rax
+    5755:	48 89 c2             	mov    %rax,%rdx
+    5758:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    575c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    5760:	90                   	nop
+    5761:	5d                   	pop    %rbp
+    5762:	c3                   	ret
+    5763:	90                   	nop
+
+0000000000005764 <nel::heapless::Queue<int, 4096ul>::ptr()>:
+        constexpr Type *ptr()
+    5764:	55                   	push   %rbp
+    5765:	48 89 e5             	mov    %rsp,%rbp
+    5768:	48 83 ec 10          	sub    $0x10,%rsp
+    576c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return elems_.ptr()[0];
+    5770:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5774:	48 83 c0 18          	add    $0x18,%rax
+    5778:	48 89 c7             	mov    %rax,%rdi
+    577b:	e8 de 05 00 00       	call   5d5e <nel::Manual<int [4096]>::ptr()>
+        }
+    5780:	c9                   	leave
+    5781:	c3                   	ret
+
+0000000000005782 <nel::ChainIterator<nel::SliceIterator<int> >&& nel::move<nel::ChainIterator<nel::SliceIterator<int> > >(nel::ChainIterator<nel::SliceIterator<int> >&)>:
+constexpr T &&move(T &v)
+    5782:	55                   	push   %rbp
+    5783:	48 89 e5             	mov    %rsp,%rbp
+    5786:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    578a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    578e:	5d                   	pop    %rbp
+    578f:	c3                   	ret
+
+0000000000005790 <nel::ChainIterator<nel::SliceIterator<int> >::ChainIterator(nel::ChainIterator<nel::SliceIterator<int> >&&)>:
+struct ChainIterator: public Iterator<ChainIterator<It>, typename It::InT, typename It::OutT>
+    5790:	55                   	push   %rbp
+    5791:	48 89 e5             	mov    %rsp,%rbp
+    5794:	48 83 ec 10          	sub    $0x10,%rsp
+    5798:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    579c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    57a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    57a4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    57a8:	48 89 d6             	mov    %rdx,%rsi
+    57ab:	48 89 c7             	mov    %rax,%rdi
+    57ae:	e8 71 03 00 00       	call   5b24 <nel::SliceIterator<int>::SliceIterator(nel::SliceIterator<int>&&)>
+    57b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    57b7:	48 83 c0 10          	add    $0x10,%rax
+    57bb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    57bf:	48 83 c2 10          	add    $0x10,%rdx
+    57c3:	48 89 d6             	mov    %rdx,%rsi
+    57c6:	48 89 c7             	mov    %rax,%rdi
+    57c9:	e8 56 03 00 00       	call   5b24 <nel::SliceIterator<int>::SliceIterator(nel::SliceIterator<int>&&)>
+    57ce:	90                   	nop
+    57cf:	c9                   	leave
+    57d0:	c3                   	ret
+    57d1:	90                   	nop
+
+00000000000057d2 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector()>:
+        constexpr Vector(void)
+    57d2:	55                   	push   %rbp
+    57d3:	48 89 e5             	mov    %rsp,%rbp
+    57d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : item_(nullptr)
+    57da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    57de:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        }
+    57e5:	90                   	nop
+    57e6:	5d                   	pop    %rbp
+    57e7:	c3                   	ret
+
+00000000000057e8 <nel::heaped::Node<int, nel::heaped::Malloc>::malloc(unsigned long)>:
+        // {
+        //     Length const align = alignof(Node);
+        //     // p % alignment == 0?
+        //     return ((Length)p & (align-1)) == 0;
+        // }
+        static Node *malloc(Count capacity)
+    57e8:	    55                   	push   %rbp
+    57e9:	    48 89 e5             	mov    %rsp,%rbp
+    57ec:	    48 83 ec 20          	sub    $0x20,%rsp
+    57f0:	    48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        {
+            Node *new_n = realloc(nullptr, capacity);
+    57f4:	    48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    57f8:	    48 89 c6             	mov    %rax,%rsi
+    57fb:	    bf 00 00 00 00       	mov    $0x0,%edi
+    5800:	    e8 60 06 00 00       	call   5e65 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    5805:	    48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    5809:	    48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    580e:	/-- 74 0c                	je     581c <nel::heaped::Node<int, nel::heaped::Malloc>::malloc(unsigned long)+0x34>
+    5810:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5814:	|   48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    581b:	|   00 
+            return new_n;
+    581c:	\-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    5820:	    c9                   	leave
+    5821:	    c3                   	ret
+
+0000000000005822 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Node<int, nel::heaped::Malloc>*)>:
+        constexpr Vector(VectorNode *const n)
+    5822:	55                   	push   %rbp
+    5823:	48 89 e5             	mov    %rsp,%rbp
+    5826:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    582a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : item_(n)
+    582e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5832:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    5836:	48 89 10             	mov    %rdx,(%rax)
+        }
+    5839:	90                   	nop
+    583a:	5d                   	pop    %rbp
+    583b:	c3                   	ret
+
+000000000000583c <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >&&)>:
+        constexpr Vector(Vector &&o)
+    583c:	55                   	push   %rbp
+    583d:	48 89 e5             	mov    %rsp,%rbp
+    5840:	48 83 ec 10          	sub    $0x10,%rsp
+    5844:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5848:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : item_(move(o.item_))
+    584c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5850:	48 89 c7             	mov    %rax,%rdi
+    5853:	e8 63 07 00 00       	call   5fbb <nel::heaped::Node<int, nel::heaped::Malloc>*&& nel::move<nel::heaped::Node<int, nel::heaped::Malloc>*>(nel::heaped::Node<int, nel::heaped::Malloc>*&)>
+    5858:	48 8b 10             	mov    (%rax),%rdx
+    585b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    585f:	48 89 10             	mov    %rdx,(%rax)
+            o.item_ = nullptr;
+    5862:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5866:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        }
+    586d:	90                   	nop
+    586e:	c9                   	leave
+    586f:	c3                   	ret
+
+0000000000005870 <nel::heaped::Node<int, nel::heaped::Malloc>::size_of(unsigned long)>:
+        static constexpr Length size_of(Count const cap)
+    5870:	55                   	push   %rbp
+    5871:	48 89 e5             	mov    %rsp,%rbp
+    5874:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    5878:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    587c:	48 83 c0 05          	add    $0x5,%rax
+    5880:	48 c1 e0 02          	shl    $0x2,%rax
+        }
+    5884:	5d                   	pop    %rbp
+    5885:	c3                   	ret
+
+0000000000005886 <nel::heaped::Node<int, nel::heaped::Malloc>::free(nel::heaped::Node<int, nel::heaped::Malloc>*)>:
+        static void free(Node *old)
+    5886:	       55                   	push   %rbp
+    5887:	       48 89 e5             	mov    %rsp,%rbp
+    588a:	       48 83 ec 20          	sub    $0x20,%rsp
+    588e:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            if (old == nullptr) { return; }
+    5892:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    5897:	/----- 74 36                	je     58cf <nel::heaped::Node<int, nel::heaped::Malloc>::free(nel::heaped::Node<int, nel::heaped::Malloc>*)+0x49>
+            Length const sz = size_of(old->alloc_);
+    5899:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    589d:	|      48 8b 00             	mov    (%rax),%rax
+    58a0:	|      48 89 c7             	mov    %rax,%rdi
+    58a3:	|      e8 c8 ff ff ff       	call   5870 <nel::heaped::Node<int, nel::heaped::Malloc>::size_of(unsigned long)>
+    58a8:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            old->~Node();
+    58ac:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    58b0:	|      48 89 c7             	mov    %rax,%rdi
+    58b3:	|      e8 12 07 00 00       	call   5fca <nel::heaped::Node<int, nel::heaped::Malloc>::~Node()>
+            Allocator::free(old, alignof(Node), sz);
+    58b8:	|      48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    58bc:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    58c0:	|      be 08 00 00 00       	mov    $0x8,%esi
+    58c5:	|      48 89 c7             	mov    %rax,%rdi
+    58c8:	|      e8 67 eb ff ff       	call   4434 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>
+    58cd:	|  /-- eb 01                	jmp    58d0 <nel::heaped::Node<int, nel::heaped::Malloc>::free(nel::heaped::Node<int, nel::heaped::Malloc>*)+0x4a>
+            if (old == nullptr) { return; }
+    58cf:	\--|-> 90                   	nop
+        }
+    58d0:	   \-> c9                   	leave
+    58d1:	       c3                   	ret
+
+00000000000058d2 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>:
+        bool try_reserve_for(Count const n)
+    58d2:	       55                   	push   %rbp
+    58d3:	       48 89 e5             	mov    %rsp,%rbp
+    58d6:	       53                   	push   %rbx
+    58d7:	       48 83 ec 18          	sub    $0x18,%rsp
+    58db:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    58df:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            if (len() + n <= capacity()) { return true; }
+    58e3:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    58e7:	       48 89 c7             	mov    %rax,%rdi
+    58ea:	       e8 11 07 00 00       	call   6000 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    58ef:	       48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    58f3:	       48 8d 1c 10          	lea    (%rax,%rdx,1),%rbx
+    58f7:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    58fb:	       48 89 c7             	mov    %rax,%rdi
+    58fe:	       e8 2d 07 00 00       	call   6030 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    5903:	       48 39 d8             	cmp    %rbx,%rax
+    5906:	       0f 93 c0             	setae  %al
+    5909:	       84 c0                	test   %al,%al
+    590b:	   /-- 74 07                	je     5914 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x42>
+    590d:	   |   b8 01 00 00 00       	mov    $0x1,%eax
+    5912:	/--|-- eb 23                	jmp    5937 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x65>
+            return try_reserve(len() + n);
+    5914:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5918:	|      48 89 c7             	mov    %rax,%rdi
+    591b:	|      e8 e0 06 00 00       	call   6000 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    5920:	|      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    5924:	|      48 01 c2             	add    %rax,%rdx
+    5927:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    592b:	|      48 89 d6             	mov    %rdx,%rsi
+    592e:	|      48 89 c7             	mov    %rax,%rdi
+    5931:	|      e8 2a 07 00 00       	call   6060 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>
+    5936:	|      90                   	nop
+        }
+    5937:	\----> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    593b:	       c9                   	leave
+    593c:	       c3                   	ret
+
+000000000000593d <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>:
+        constexpr static Result Err(Args &&...args)
+    593d:	55                   	push   %rbp
+    593e:	48 89 e5             	mov    %rsp,%rbp
+    5941:	48 83 ec 10          	sub    $0x10,%rsp
+    5945:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5949:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    594d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5951:	48 89 c7             	mov    %rax,%rdi
+    5954:	e8 5a 02 00 00       	call   5bb3 <int& nel::forward<int&, int>(int&)>
+    5959:	48 89 c2             	mov    %rax,%rdx
+    595c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5960:	48 89 d6             	mov    %rdx,%rsi
+    5963:	48 89 c7             	mov    %rax,%rdi
+    5966:	e8 49 08 00 00       	call   61b4 <nel::Result<void, int>::Result<int&>(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)2>, int&)>
+        }
+    596b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    596f:	c9                   	leave
+    5970:	c3                   	ret
+    5971:	90                   	nop
+
+0000000000005972 <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int&>(int&)>:
+            }
+        }
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+    5972:	       55                   	push   %rbp
+    5973:	       48 89 e5             	mov    %rsp,%rbp
+    5976:	       53                   	push   %rbx
+    5977:	       48 83 ec 28          	sub    $0x28,%rsp
+    597b:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    597f:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    5983:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+        {
+            if (len() >= capacity()) {
+    5987:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    598b:	       48 89 c7             	mov    %rax,%rdi
+    598e:	       e8 63 08 00 00       	call   61f6 <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    5993:	       48 89 c3             	mov    %rax,%rbx
+    5996:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    599a:	       48 89 c7             	mov    %rax,%rdi
+    599d:	       e8 66 08 00 00       	call   6208 <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    59a2:	       48 39 c3             	cmp    %rax,%rbx
+    59a5:	       0f 93 c0             	setae  %al
+    59a8:	       84 c0                	test   %al,%al
+    59aa:	   /-- 74 20                	je     59cc <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int&>(int&)+0x5a>
+                // TODO: don't want to create a T on error though..
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+    59ac:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    59b0:	   |   48 89 c7             	mov    %rax,%rdi
+    59b3:	   |   e8 fb 01 00 00       	call   5bb3 <int& nel::forward<int&, int>(int&)>
+    59b8:	   |   48 89 c2             	mov    %rax,%rdx
+    59bb:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    59bf:	   |   48 89 d6             	mov    %rdx,%rsi
+    59c2:	   |   48 89 c7             	mov    %rax,%rdi
+    59c5:	   |   e8 73 ff ff ff       	call   593d <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    59ca:	/--|-- eb 5f                	jmp    5a2b <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int&>(int&)+0xb9>
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    59cc:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    59d0:	|      48 89 c7             	mov    %rax,%rdi
+    59d3:	|      e8 1e 08 00 00       	call   61f6 <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    59d8:	|      48 83 c0 04          	add    $0x4,%rax
+    59dc:	|      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    59e3:	|      00 
+    59e4:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    59e8:	|      48 01 d0             	add    %rdx,%rax
+    59eb:	|      48 89 c6             	mov    %rax,%rsi
+    59ee:	|      bf 04 00 00 00       	mov    $0x4,%edi
+    59f3:	|      e8 23 e9 ff ff       	call   431b <operator new(unsigned long, void*)>
+    59f8:	|      48 89 c3             	mov    %rax,%rbx
+    59fb:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    59ff:	|      48 89 c7             	mov    %rax,%rdi
+    5a02:	|      e8 ac 01 00 00       	call   5bb3 <int& nel::forward<int&, int>(int&)>
+    5a07:	|      8b 00                	mov    (%rax),%eax
+    5a09:	|      89 03                	mov    %eax,(%rbx)
+            len_ += 1;
+    5a0b:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    5a0f:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    5a13:	|      48 8d 50 01          	lea    0x1(%rax),%rdx
+    5a17:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    5a1b:	|      48 89 50 08          	mov    %rdx,0x8(%rax)
+            return Result<void, Type>::Ok();
+    5a1f:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5a23:	|      48 89 c7             	mov    %rax,%rdi
+    5a26:	|      e8 26 fc ff ff       	call   5651 <nel::Result<void, int>::Ok()>
+        }
+    5a2b:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5a2f:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    5a33:	       c9                   	leave
+    5a34:	       c3                   	ret
+    5a35:	       90                   	nop
+
+0000000000005a36 <nel::heaped::Node<int, nel::heaped::Malloc>::slice()>:
+        constexpr Slice<Type> slice(void)
+    5a36:	55                   	push   %rbp
+    5a37:	48 89 e5             	mov    %rsp,%rbp
+    5a3a:	48 83 ec 10          	sub    $0x10,%rsp
+    5a3e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5a42:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Slice(values_, len());
+    5a46:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5a4a:	48 89 c7             	mov    %rax,%rdi
+    5a4d:	e8 a4 07 00 00       	call   61f6 <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    5a52:	48 89 c2             	mov    %rax,%rdx
+    5a55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5a59:	48 8d 48 10          	lea    0x10(%rax),%rcx
+    5a5d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5a61:	48 89 ce             	mov    %rcx,%rsi
+    5a64:	48 89 c7             	mov    %rax,%rdi
+    5a67:	e8 2e f8 ff ff       	call   529a <nel::Slice<int>::Slice(int*, unsigned long)>
+        }
+    5a6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5a70:	c9                   	leave
+    5a71:	c3                   	ret
+
+0000000000005a72 <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>:
+        constexpr Element(Type &&val)
+    5a72:	55                   	push   %rbp
+    5a73:	48 89 e5             	mov    %rsp,%rbp
+    5a76:	48 83 ec 10          	sub    $0x10,%rsp
+    5a7a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5a7e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    5a82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5a86:	48 89 c7             	mov    %rax,%rdi
+    5a89:	e8 52 f6 ff ff       	call   50e0 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    5a8e:	8b 10                	mov    (%rax),%edx
+    5a90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5a94:	89 10                	mov    %edx,(%rax)
+        }
+    5a96:	90                   	nop
+    5a97:	c9                   	leave
+    5a98:	c3                   	ret
+    5a99:	90                   	nop
+
+0000000000005a9a <nel::Element<void*>::Element<void* const&>(void* const&)>:
+        constexpr Element(Args &&...args)
+    5a9a:	55                   	push   %rbp
+    5a9b:	48 89 e5             	mov    %rsp,%rbp
+    5a9e:	48 83 ec 10          	sub    $0x10,%rsp
+    5aa2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5aa6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Args>(args)...)
+    5aaa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5aae:	48 89 c7             	mov    %rax,%rdi
+    5ab1:	e8 79 f6 ff ff       	call   512f <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    5ab6:	48 8b 10             	mov    (%rax),%rdx
+    5ab9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5abd:	48 89 10             	mov    %rdx,(%rax)
+        }
+    5ac0:	90                   	nop
+    5ac1:	c9                   	leave
+    5ac2:	c3                   	ret
+    5ac3:	90                   	nop
+
+0000000000005ac4 <nel::Optional<int&>::Optional(nel::NoneT const&)>:
+        constexpr Optional(NoneT const &)
+    5ac4:	55                   	push   %rbp
+    5ac5:	48 89 e5             	mov    %rsp,%rbp
+    5ac8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5acc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : tag_(Tag::NONE)
+    5ad0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5ad4:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+        }
+    5ada:	90                   	nop
+    5adb:	5d                   	pop    %rbp
+    5adc:	c3                   	ret
+
+0000000000005add <nel::Optional<int&> nel::Some<int&>(int&)>:
+            return outs;
+        }
+};
+
+template<typename T>
+constexpr Optional<T> Some(T &&v)
+    5add:	55                   	push   %rbp
+    5ade:	48 89 e5             	mov    %rsp,%rbp
+    5ae1:	48 83 ec 10          	sub    $0x10,%rsp
+    5ae5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5ae9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+{
+    return Optional<T>::Some(forward<T>(v));
+    5aed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5af1:	48 89 c7             	mov    %rax,%rdi
+    5af4:	e8 ba 00 00 00       	call   5bb3 <int& nel::forward<int&, int>(int&)>
+    5af9:	48 89 c2             	mov    %rax,%rdx
+    5afc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5b00:	48 89 d6             	mov    %rdx,%rsi
+    5b03:	48 89 c7             	mov    %rax,%rdi
+    5b06:	e8 74 00 00 00       	call   5b7f <nel::Optional<int&>::Some(int&)>
+}
+    5b0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5b0f:	c9                   	leave
+    5b10:	c3                   	ret
+    5b11:	90                   	nop
+
+0000000000005b12 <nel::Element<int&>::ref() const>:
+        constexpr Type const &ref(void) const
+    5b12:	55                   	push   %rbp
+    5b13:	48 89 e5             	mov    %rsp,%rbp
+    5b16:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    5b1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5b1e:	48 8b 00             	mov    (%rax),%rax
+        }
+    5b21:	5d                   	pop    %rbp
+    5b22:	c3                   	ret
+    5b23:	90                   	nop
+
+0000000000005b24 <nel::SliceIterator<int>::SliceIterator(nel::SliceIterator<int>&&)>:
+        SliceIterator(SliceIterator &&o)
+    5b24:	55                   	push   %rbp
+    5b25:	48 89 e5             	mov    %rsp,%rbp
+    5b28:	48 83 ec 10          	sub    $0x10,%rsp
+    5b2c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5b30:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : b_(move(o.b_))
+    5b34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5b38:	48 89 c7             	mov    %rax,%rdi
+    5b3b:	e8 d9 06 00 00       	call   6219 <int*&& nel::move<int*>(int*&)>
+    5b40:	48 8b 10             	mov    (%rax),%rdx
+    5b43:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5b47:	48 89 10             	mov    %rdx,(%rax)
+            , e_(move(o.e_))
+    5b4a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5b4e:	48 83 c0 08          	add    $0x8,%rax
+    5b52:	48 89 c7             	mov    %rax,%rdi
+    5b55:	e8 bf 06 00 00       	call   6219 <int*&& nel::move<int*>(int*&)>
+    5b5a:	48 8b 10             	mov    (%rax),%rdx
+    5b5d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5b61:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            o.b_ = nullptr;
+    5b65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5b69:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+            o.e_ = nullptr;
+    5b70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5b74:	48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    5b7b:	00 
+        }
+    5b7c:	90                   	nop
+    5b7d:	c9                   	leave
+    5b7e:	c3                   	ret
+
+0000000000005b7f <nel::Optional<int&>::Some(int&)>:
+        constexpr static Optional Some(T &&v)
+    5b7f:	55                   	push   %rbp
+    5b80:	48 89 e5             	mov    %rsp,%rbp
+    5b83:	48 83 ec 10          	sub    $0x10,%rsp
+    5b87:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5b8b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Optional(Phantom<Tag::SOME>(), forward<T>(v));
+    5b8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5b93:	48 89 c7             	mov    %rax,%rdi
+    5b96:	e8 18 00 00 00       	call   5bb3 <int& nel::forward<int&, int>(int&)>
+    5b9b:	48 89 c2             	mov    %rax,%rdx
+    5b9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5ba2:	48 89 d6             	mov    %rdx,%rsi
+    5ba5:	48 89 c7             	mov    %rax,%rdi
+    5ba8:	e8 7b 06 00 00       	call   6228 <nel::Optional<int&>::Optional(nel::Optional<int&>::Phantom<(nel::Optional<int&>::Tag)2>, int&)>
+        }
+    5bad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5bb1:	c9                   	leave
+    5bb2:	c3                   	ret
+
+0000000000005bb3 <int& nel::forward<int&, int>(int&)>:
+constexpr U &&forward(T &t)
+    5bb3:	55                   	push   %rbp
+    5bb4:	48 89 e5             	mov    %rsp,%rbp
+    5bb7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    5bbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    5bbf:	5d                   	pop    %rbp
+    5bc0:	c3                   	ret
+    5bc1:	90                   	nop
+
+0000000000005bc2 <nel::Optional<int&> nel::Optional<int&>::consume<nel::Optional<int&>, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_some, Fn2 &&on_none, Context const &ctx = Context())
+    5bc2:	             55                   	push   %rbp
+    5bc3:	             48 89 e5             	mov    %rsp,%rbp
+    5bc6:	             48 83 ec 40          	sub    $0x40,%rsp
+    5bca:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    5bce:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    5bd2:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    5bd6:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    5bda:	             4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+            auto tag = tag_;
+    5bde:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    5be2:	             8b 00                	mov    (%rax),%eax
+    5be4:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    5be7:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    5beb:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // optional::consume
+    5bf1:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    5bf5:	         /-- 74 14                	je     5c0b <nel::Optional<int&> nel::Optional<int&>::consume<nel::Optional<int&>, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x49>
+    5bf7:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    5bfb:	/--------|-- 7f 69                	jg     5c66 <nel::Optional<int&> nel::Optional<int&>::consume<nel::Optional<int&>, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0xa4>
+    5bfd:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    5c01:	|  /-----|-- 74 4d                	je     5c50 <nel::Optional<int&> nel::Optional<int&>::consume<nel::Optional<int&>, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x8e>
+    5c03:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    5c07:	|  |  /--|-- 74 32                	je     5c3b <nel::Optional<int&> nel::Optional<int&>::consume<nel::Optional<int&>, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x79>
+    5c09:	+--|--|--|-- eb 5b                	jmp    5c66 <nel::Optional<int&> nel::Optional<int&>::consume<nel::Optional<int&>, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0xa4>
+                    return on_some(forward<T>(*some_));
+    5c0b:	|  |  |  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    5c0f:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    5c13:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    5c16:	|  |  |      e8 67 00 00 00       	call   5c82 <nel::Element<int&>::operator*()>
+    5c1b:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    5c1e:	|  |  |      e8 90 ff ff ff       	call   5bb3 <int& nel::forward<int&, int>(int&)>
+    5c23:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    5c26:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5c2a:	|  |  |      48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+    5c2e:	|  |  |      48 89 ce             	mov    %rcx,%rsi
+    5c31:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    5c34:	|  |  |      e8 e1 f6 ff ff       	call   531a <nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}::operator()(int&) const>
+    5c39:	|  |  |  /-- eb 41                	jmp    5c7c <nel::Optional<int&> nel::Optional<int&>::consume<nel::Optional<int&>, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0xba>
+                    return on_none();
+    5c3b:	|  |  \--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5c3f:	|  |     |   48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    5c43:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    5c46:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    5c49:	|  |     |   e8 04 f7 ff ff       	call   5352 <nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}::operator()() const>
+    5c4e:	|  |     +-- eb 2c                	jmp    5c7c <nel::Optional<int&> nel::Optional<int&>::consume<nel::Optional<int&>, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0xba>
+                    nel::panic("invalid Optional", ctx);
+    5c50:	|  \-----|-> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    5c54:	|        |   48 89 c6             	mov    %rax,%rsi
+    5c57:	|        |   48 8d 05 84 26 00 00 	lea    0x2684(%rip),%rax        # 82e2 <queue_len+0x102>
+    5c5e:	|        |   48 89 c7             	mov    %rax,%rdi
+    5c61:	|        |   e8 89 0b 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Optional", ctx);
+    5c66:	\--------|-> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    5c6a:	         |   48 89 c6             	mov    %rax,%rsi
+    5c6d:	         |   48 8d 05 7f 26 00 00 	lea    0x267f(%rip),%rax        # 82f3 <queue_len+0x113>
+    5c74:	         |   48 89 c7             	mov    %rax,%rdi
+    5c77:	         |   e8 73 0b 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+        }
+    5c7c:	         \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5c80:	             c9                   	leave
+    5c81:	             c3                   	ret
+
+0000000000005c82 <nel::Element<int&>::operator*()>:
+
+        constexpr Type &operator*(void)
+    5c82:	55                   	push   %rbp
+    5c83:	48 89 e5             	mov    %rsp,%rbp
+    5c86:	48 83 ec 10          	sub    $0x10,%rsp
+    5c8a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    5c8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5c92:	48 89 c7             	mov    %rax,%rdi
+    5c95:	e8 d0 05 00 00       	call   626a <nel::Element<int&>::ref()>
+        }
+    5c9a:	c9                   	leave
+    5c9b:	c3                   	ret
+
+0000000000005c9c <nel::RevIterator<nel::ChainIterator<nel::SliceIterator<int> > >::RevIterator(nel::ChainIterator<nel::SliceIterator<int> >&&)>:
+
+    private:
+        It inner_;
+
+    public:
+        constexpr RevIterator(It &&inner)
+    5c9c:	55                   	push   %rbp
+    5c9d:	48 89 e5             	mov    %rsp,%rbp
+    5ca0:	53                   	push   %rbx
+    5ca1:	48 83 ec 18          	sub    $0x18,%rsp
+    5ca5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    5ca9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : inner_(move(inner))
+    5cad:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    5cb1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    5cb5:	48 89 c7             	mov    %rax,%rdi
+    5cb8:	e8 c5 fa ff ff       	call   5782 <nel::ChainIterator<nel::SliceIterator<int> >&& nel::move<nel::ChainIterator<nel::SliceIterator<int> > >(nel::ChainIterator<nel::SliceIterator<int> >&)>
+    5cbd:	48 89 c6             	mov    %rax,%rsi
+    5cc0:	48 89 df             	mov    %rbx,%rdi
+    5cc3:	e8 c8 fa ff ff       	call   5790 <nel::ChainIterator<nel::SliceIterator<int> >::ChainIterator(nel::ChainIterator<nel::SliceIterator<int> >&&)>
+        {
+        }
+    5cc8:	90                   	nop
+    5cc9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    5ccd:	c9                   	leave
+    5cce:	c3                   	ret
+    5ccf:	90                   	nop
+
+0000000000005cd0 <nel::Iterator<nel::RevIterator<nel::ChainIterator<nel::SliceIterator<int> > >, int&, int&>::self()>:
+        constexpr ItT &self(void)
+    5cd0:	55                   	push   %rbp
+    5cd1:	48 89 e5             	mov    %rsp,%rbp
+    5cd4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    5cd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5cdc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    5ce0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    5ce4:	5d                   	pop    %rbp
+    5ce5:	c3                   	ret
+
+0000000000005ce6 <nel::RevIterator<nel::ChainIterator<nel::SliceIterator<int> > >::next()>:
+         * Return next item in iterator or None is no more.
+         *
+         * @returns Optional::Some if iterator still active.
+         * @returns Optional::None if iterator exhausted.
+         */
+        Optional<OutT> next(void)
+    5ce6:	55                   	push   %rbp
+    5ce7:	48 89 e5             	mov    %rsp,%rbp
+    5cea:	48 83 ec 10          	sub    $0x10,%rsp
+    5cee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5cf2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            return inner_.next_back();
+    5cf6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    5cfa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5cfe:	48 89 d6             	mov    %rdx,%rsi
+    5d01:	48 89 c7             	mov    %rax,%rdi
+    5d04:	e8 a3 05 00 00       	call   62ac <nel::ChainIterator<nel::SliceIterator<int> >::next_back()>
+        }
+    5d09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5d0d:	c9                   	leave
+    5d0e:	c3                   	ret
+    5d0f:	90                   	nop
+
+0000000000005d10 <void nel::heapless::Queue<int, 4096ul>::~Queue()::{lambda(auto:1&)#1}::operator()<int>(int&) const>:
+            iter().rev().for_each([&](auto &v) -> void { v.~Type(); });
+    5d10:	55                   	push   %rbp
+    5d11:	48 89 e5             	mov    %rsp,%rbp
+    5d14:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5d18:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    5d1c:	90                   	nop
+    5d1d:	5d                   	pop    %rbp
+    5d1e:	c3                   	ret
+    5d1f:	90                   	nop
+
+0000000000005d20 <nel::Result<void, int>::Result(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)1>)>:
+        constexpr Result(Phantom<Tag::OK> const)
+    5d20:	55                   	push   %rbp
+    5d21:	48 89 e5             	mov    %rsp,%rbp
+    5d24:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : tag_(Tag::OK)
+    5d28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5d2c:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+        }
+    5d32:	90                   	nop
+    5d33:	5d                   	pop    %rbp
+    5d34:	c3                   	ret
+    5d35:	90                   	nop
+
+0000000000005d36 <nel::Element<int>::operator*()>:
+        constexpr Type &operator*(void)
+    5d36:	55                   	push   %rbp
+    5d37:	48 89 e5             	mov    %rsp,%rbp
+    5d3a:	48 83 ec 10          	sub    $0x10,%rsp
+    5d3e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    5d42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5d46:	48 89 c7             	mov    %rax,%rdi
+    5d49:	e8 d6 05 00 00       	call   6324 <nel::Element<int>::ref()>
+        }
+    5d4e:	c9                   	leave
+    5d4f:	c3                   	ret
+
+0000000000005d50 <int&& nel::forward<int, int>(int&)>:
+constexpr U &&forward(T &t)
+    5d50:	55                   	push   %rbp
+    5d51:	48 89 e5             	mov    %rsp,%rbp
+    5d54:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    5d58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    5d5c:	5d                   	pop    %rbp
+    5d5d:	c3                   	ret
+
+0000000000005d5e <nel::Manual<int [4096]>::ptr()>:
+
+        // private:
+    public:
+        // only if you know there's a value there..
+        // TODO: must have no bare pointers.. safety feature.
+        constexpr Type *ptr()
+    5d5e:	55                   	push   %rbp
+    5d5f:	48 89 e5             	mov    %rsp,%rbp
+    5d62:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return &u_.elem_;
+    5d66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    5d6a:	5d                   	pop    %rbp
+    5d6b:	c3                   	ret
+
+0000000000005d6c <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>:
+            return match<bool>([](T const &) -> bool { return false; },
+    5d6c:	55                   	push   %rbp
+    5d6d:	48 89 e5             	mov    %rsp,%rbp
+    5d70:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5d74:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    5d78:	b8 00 00 00 00       	mov    $0x0,%eax
+    5d7d:	5d                   	pop    %rbp
+    5d7e:	c3                   	ret
+    5d7f:	90                   	nop
+
+0000000000005d80 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>:
+                               [](E const &) -> bool { return true; },
+    5d80:	55                   	push   %rbp
+    5d81:	48 89 e5             	mov    %rsp,%rbp
+    5d84:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5d88:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    5d8c:	b8 01 00 00 00       	mov    $0x1,%eax
+    5d91:	5d                   	pop    %rbp
+    5d92:	c3                   	ret
+    5d93:	90                   	nop
+
+0000000000005d94 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>:
+        constexpr bool is_err(Context const &ctx = Context()) const
+    5d94:	55                   	push   %rbp
+    5d95:	48 89 e5             	mov    %rsp,%rbp
+    5d98:	48 83 ec 20          	sub    $0x20,%rsp
+    5d9c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    5da0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](T const &) -> bool { return false; },
+    5da4:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    5da8:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    5dac:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    5db0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5db4:	48 89 c7             	mov    %rax,%rdi
+    5db7:	e8 02 00 00 00       	call   5dbe <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>
+        }
+    5dbc:	c9                   	leave
+    5dbd:	c3                   	ret
+
+0000000000005dbe <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    5dbe:	             55                   	push   %rbp
+    5dbf:	             48 89 e5             	mov    %rsp,%rbp
+    5dc2:	             48 83 ec 20          	sub    $0x20,%rsp
+    5dc6:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5dca:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    5dce:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    5dd2:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result-match
+    5dd6:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5dda:	             8b 00                	mov    (%rax),%eax
+    5ddc:	             83 f8 02             	cmp    $0x2,%eax
+    5ddf:	         /-- 74 32                	je     5e13 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x55>
+    5de1:	         |   83 f8 02             	cmp    $0x2,%eax
+    5de4:	/--------|-- 7f 67                	jg     5e4d <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+    5de6:	|        |   85 c0                	test   %eax,%eax
+    5de8:	|     /--|-- 74 4d                	je     5e37 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x79>
+    5dea:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    5ded:	+-----|--|-- 75 5e                	jne    5e4d <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_ok(*ok_);
+    5def:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5df3:	|     |  |   48 83 c0 08          	add    $0x8,%rax
+    5df7:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    5dfa:	|     |  |   e8 33 05 00 00       	call   6332 <nel::Element<void*>::operator*() const>
+    5dff:	|     |  |   48 89 c2             	mov    %rax,%rdx
+    5e02:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5e06:	|     |  |   48 89 d6             	mov    %rdx,%rsi
+    5e09:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    5e0c:	|     |  |   e8 5b ff ff ff       	call   5d6c <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>
+    5e11:	|  /--|--|-- eb 50                	jmp    5e63 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    return on_err(*err_);
+    5e13:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5e17:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    5e1b:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    5e1e:	|  |  |      e8 29 05 00 00       	call   634c <nel::Element<nel::heaped::AllocError>::operator*() const>
+    5e23:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    5e26:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5e2a:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    5e2d:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    5e30:	|  |  |      e8 4b ff ff ff       	call   5d80 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>
+    5e35:	|  +--|----- eb 2c                	jmp    5e63 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    nel::panic("invalid Result", ctx);
+    5e37:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    5e3b:	|  |         48 89 c6             	mov    %rax,%rsi
+    5e3e:	|  |         48 8d 05 13 26 00 00 	lea    0x2613(%rip),%rax        # 8458 <queue_len+0x278>
+    5e45:	|  |         48 89 c7             	mov    %rax,%rdi
+    5e48:	|  |         e8 a2 09 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    5e4d:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    5e51:	   |         48 89 c6             	mov    %rax,%rsi
+    5e54:	   |         48 8d 05 60 24 00 00 	lea    0x2460(%rip),%rax        # 82bb <queue_len+0xdb>
+    5e5b:	   |         48 89 c7             	mov    %rax,%rdi
+    5e5e:	   |         e8 8c 09 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+        }
+    5e63:	   \-------> c9                   	leave
+    5e64:	             c3                   	ret
+
+0000000000005e65 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>:
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    5e65:	          55                   	push   %rbp
+    5e66:	          48 89 e5             	mov    %rsp,%rbp
+    5e69:	          41 54                	push   %r12
+    5e6b:	          53                   	push   %rbx
+    5e6c:	          48 83 ec 70          	sub    $0x70,%rsp
+    5e70:	          48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+    5e74:	          48 89 75 80          	mov    %rsi,-0x80(%rbp)
+            if (new_cap > max_capacity) { return nullptr; }
+    5e78:	          48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    5e7f:	          ff ff 1f 
+    5e82:	          48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    5e86:	      /-- 73 0a                	jae    5e92 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x2d>
+    5e88:	      |   bb 00 00 00 00       	mov    $0x0,%ebx
+    5e8d:	/-----|-- e9 1d 01 00 00       	jmp    5faf <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x14a>
+            Length const new_sz = size_of(new_cap);
+    5e92:	|     \-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    5e96:	|         48 89 c7             	mov    %rax,%rdi
+    5e99:	|         e8 d2 f9 ff ff       	call   5870 <nel::heaped::Node<int, nel::heaped::Malloc>::size_of(unsigned long)>
+    5e9e:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            Length const old_sz = (old_n == nullptr) ? 0 : size_of(old_n->alloc_);
+    5ea2:	|         48 83 7d 88 00       	cmpq   $0x0,-0x78(%rbp)
+    5ea7:	|  /----- 74 11                	je     5eba <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x55>
+    5ea9:	|  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    5ead:	|  |      48 8b 00             	mov    (%rax),%rax
+    5eb0:	|  |      48 89 c7             	mov    %rax,%rdi
+    5eb3:	|  |      e8 b8 f9 ff ff       	call   5870 <nel::heaped::Node<int, nel::heaped::Malloc>::size_of(unsigned long)>
+    5eb8:	|  |  /-- eb 05                	jmp    5ebf <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x5a>
+    5eba:	|  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    5ebf:	|     \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+                auto r = Allocator::try_realloc(old_n, alignof(Node), old_sz, new_sz);
+    5ec3:	|         48 8d 45 90          	lea    -0x70(%rbp),%rax
+    5ec7:	|         48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    5ecb:	|         48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    5ecf:	|         48 8b 75 88          	mov    -0x78(%rbp),%rsi
+    5ed3:	|         49 89 c8             	mov    %rcx,%r8
+    5ed6:	|         48 89 d1             	mov    %rdx,%rcx
+    5ed9:	|         ba 08 00 00 00       	mov    $0x8,%edx
+    5ede:	|         48 89 c7             	mov    %rax,%rdi
+    5ee1:	|         e8 7f e4 ff ff       	call   4365 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>
+                if (r.is_err()) { return nullptr; }
+    5ee6:	|         48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    5eea:	|         b9 89 00 00 00       	mov    $0x89,%ecx
+    5eef:	|         48 8d 15 c9 25 00 00 	lea    0x25c9(%rip),%rdx        # 84bf <queue_len+0x2df>
+    5ef6:	|         48 8d 35 d9 25 00 00 	lea    0x25d9(%rip),%rsi        # 84d6 <queue_len+0x2f6>
+    5efd:	|         48 89 c7             	mov    %rax,%rdi
+    5f00:	|         e8 29 e4 ff ff       	call   432e <nel::Context::Context(char const*, char const*, int)>
+    5f05:	|         48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    5f09:	|         48 8d 45 90          	lea    -0x70(%rbp),%rax
+    5f0d:	|         48 89 d6             	mov    %rdx,%rsi
+    5f10:	|         48 89 c7             	mov    %rax,%rdi
+    5f13:	|         e8 7c fe ff ff       	call   5d94 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>
+    5f18:	|         84 c0                	test   %al,%al
+    5f1a:	|     /-- 74 0d                	je     5f29 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0xc4>
+    5f1c:	|     |   bb 00 00 00 00       	mov    $0x0,%ebx
+    5f21:	|     |   41 bc 00 00 00 00    	mov    $0x0,%r12d
+    5f27:	|  /--|-- eb 3c                	jmp    5f65 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x100>
+                new_n = reinterpret_cast<Node *>(r.unwrap());
+    5f29:	|  |  \-> 48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    5f2d:	|  |      b9 8a 00 00 00       	mov    $0x8a,%ecx
+    5f32:	|  |      48 8d 15 86 25 00 00 	lea    0x2586(%rip),%rdx        # 84bf <queue_len+0x2df>
+    5f39:	|  |      48 8d 35 96 25 00 00 	lea    0x2596(%rip),%rsi        # 84d6 <queue_len+0x2f6>
+    5f40:	|  |      48 89 c7             	mov    %rax,%rdi
+    5f43:	|  |      e8 e6 e3 ff ff       	call   432e <nel::Context::Context(char const*, char const*, int)>
+    5f48:	|  |      48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    5f4c:	|  |      48 8d 45 90          	lea    -0x70(%rbp),%rax
+    5f50:	|  |      48 89 d6             	mov    %rdx,%rsi
+    5f53:	|  |      48 89 c7             	mov    %rax,%rdi
+    5f56:	|  |      e8 57 04 00 00       	call   63b2 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+    5f5b:	|  |      48 89 45 e8          	mov    %rax,-0x18(%rbp)
+            } else {
+    5f5f:	|  |      41 bc 01 00 00 00    	mov    $0x1,%r12d
+    5f65:	|  \----> 48 8d 45 90          	lea    -0x70(%rbp),%rax
+    5f69:	|         48 89 c7             	mov    %rax,%rdi
+    5f6c:	|         e8 df e5 ff ff       	call   4550 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+    5f71:	|         41 83 fc 01          	cmp    $0x1,%r12d
+    5f75:	+-------- 75 38                	jne    5faf <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x14a>
+    5f77:	|         90                   	nop
+                if (new_sz > old_sz) {
+    5f78:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    5f7c:	|         48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    5f80:	|     /-- 73 1e                	jae    5fa0 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x13b>
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+    5f82:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    5f86:	|     |   48 2b 45 d8          	sub    -0x28(%rbp),%rax
+    5f8a:	|     |   48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    5f8e:	|     |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    5f92:	|     |   48 01 ca             	add    %rcx,%rdx
+    5f95:	|     |   48 89 c6             	mov    %rax,%rsi
+    5f98:	|     |   48 89 d7             	mov    %rdx,%rdi
+    5f9b:	|     |   e8 d0 09 00 00       	call   6970 <nel::elem::wipe(unsigned char*, unsigned long)>
+            new_n->alloc_ = new_cap;
+    5fa0:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5fa4:	|         48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    5fa8:	|         48 89 10             	mov    %rdx,(%rax)
+            return new_n;
+    5fab:	|         48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+        }
+    5faf:	\-------> 48 89 d8             	mov    %rbx,%rax
+    5fb2:	          48 83 c4 70          	add    $0x70,%rsp
+    5fb6:	          5b                   	pop    %rbx
+    5fb7:	          41 5c                	pop    %r12
+    5fb9:	          5d                   	pop    %rbp
+    5fba:	          c3                   	ret
+
+0000000000005fbb <nel::heaped::Node<int, nel::heaped::Malloc>*&& nel::move<nel::heaped::Node<int, nel::heaped::Malloc>*>(nel::heaped::Node<int, nel::heaped::Malloc>*&)>:
+constexpr T &&move(T &v)
+    5fbb:	55                   	push   %rbp
+    5fbc:	48 89 e5             	mov    %rsp,%rbp
+    5fbf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    5fc3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    5fc7:	5d                   	pop    %rbp
+    5fc8:	c3                   	ret
+    5fc9:	90                   	nop
+
+0000000000005fca <nel::heaped::Node<int, nel::heaped::Malloc>::~Node()>:
+        constexpr ~Node(void)
+    5fca:	       55                   	push   %rbp
+    5fcb:	       48 89 e5             	mov    %rsp,%rbp
+    5fce:	       48 83 ec 20          	sub    $0x20,%rsp
+    5fd2:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            for (Index i = 0; i < len(); ++i) {
+    5fd6:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    5fdd:	       00 
+    5fde:	   /-- eb 05                	jmp    5fe5 <nel::heaped::Node<int, nel::heaped::Malloc>::~Node()+0x1b>
+    5fe0:	/--|-> 48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    5fe5:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5fe9:	|      48 89 c7             	mov    %rax,%rdi
+    5fec:	|      e8 05 02 00 00       	call   61f6 <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    5ff1:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    5ff5:	|      0f 92 c0             	setb   %al
+    5ff8:	|      84 c0                	test   %al,%al
+    5ffa:	\----- 75 e4                	jne    5fe0 <nel::heaped::Node<int, nel::heaped::Malloc>::~Node()+0x16>
+        }
+    5ffc:	       90                   	nop
+    5ffd:	       90                   	nop
+    5ffe:	       c9                   	leave
+    5fff:	       c3                   	ret
+
+0000000000006000 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>:
+        constexpr Length len(void) const
+    6000:	       55                   	push   %rbp
+    6001:	       48 89 e5             	mov    %rsp,%rbp
+    6004:	       48 83 ec 10          	sub    $0x10,%rsp
+    6008:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->len();
+    600c:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6010:	       48 8b 00             	mov    (%rax),%rax
+    6013:	       48 85 c0             	test   %rax,%rax
+    6016:	/----- 74 11                	je     6029 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x29>
+    6018:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    601c:	|      48 8b 00             	mov    (%rax),%rax
+    601f:	|      48 89 c7             	mov    %rax,%rdi
+    6022:	|      e8 cf 01 00 00       	call   61f6 <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    6027:	|  /-- eb 05                	jmp    602e <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x2e>
+    6029:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    602e:	   \-> c9                   	leave
+    602f:	       c3                   	ret
+
+0000000000006030 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>:
+        constexpr Count capacity(void) const
+    6030:	       55                   	push   %rbp
+    6031:	       48 89 e5             	mov    %rsp,%rbp
+    6034:	       48 83 ec 10          	sub    $0x10,%rsp
+    6038:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->capacity();
+    603c:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6040:	       48 8b 00             	mov    (%rax),%rax
+    6043:	       48 85 c0             	test   %rax,%rax
+    6046:	/----- 74 11                	je     6059 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x29>
+    6048:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    604c:	|      48 8b 00             	mov    (%rax),%rax
+    604f:	|      48 89 c7             	mov    %rax,%rdi
+    6052:	|      e8 b1 01 00 00       	call   6208 <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    6057:	|  /-- eb 05                	jmp    605e <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x2e>
+    6059:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    605e:	   \-> c9                   	leave
+    605f:	       c3                   	ret
+
+0000000000006060 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>:
+        bool try_reserve(Count new_cap)
+    6060:	             55                   	push   %rbp
+    6061:	             48 89 e5             	mov    %rsp,%rbp
+    6064:	             48 83 ec 20          	sub    $0x20,%rsp
+    6068:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    606c:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            new_cap = Growth::capacity_for(capacity(), new_cap);
+    6070:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6074:	             48 89 c7             	mov    %rax,%rdi
+    6077:	             e8 b4 ff ff ff       	call   6030 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    607c:	             48 89 c2             	mov    %rax,%rdx
+    607f:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    6083:	             48 89 c6             	mov    %rax,%rsi
+    6086:	             48 89 d7             	mov    %rdx,%rdi
+    6089:	             e8 56 03 00 00       	call   63e4 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>
+    608e:	             48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (new_cap < len()) { new_cap = len(); }
+    6092:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6096:	             48 89 c7             	mov    %rax,%rdi
+    6099:	             e8 62 ff ff ff       	call   6000 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    609e:	             48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    60a2:	             0f 92 c0             	setb   %al
+    60a5:	             84 c0                	test   %al,%al
+    60a7:	         /-- 74 10                	je     60b9 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x59>
+    60a9:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    60ad:	         |   48 89 c7             	mov    %rax,%rdi
+    60b0:	         |   e8 4b ff ff ff       	call   6000 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    60b5:	         |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (item_ == nullptr) {
+    60b9:	         \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    60bd:	             48 8b 00             	mov    (%rax),%rax
+    60c0:	             48 85 c0             	test   %rax,%rax
+    60c3:	         /-- 75 2d                	jne    60f2 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x92>
+                item_ = VectorNode::malloc(new_cap);
+    60c5:	         |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    60c9:	         |   48 89 c7             	mov    %rax,%rdi
+    60cc:	         |   e8 17 f7 ff ff       	call   57e8 <nel::heaped::Node<int, nel::heaped::Malloc>::malloc(unsigned long)>
+    60d1:	         |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    60d5:	         |   48 89 02             	mov    %rax,(%rdx)
+                if (item_ == nullptr) { return false; }
+    60d8:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    60dc:	         |   48 8b 00             	mov    (%rax),%rax
+    60df:	         |   48 85 c0             	test   %rax,%rax
+    60e2:	/--------|-- 0f 85 c4 00 00 00    	jne    61ac <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+    60e8:	|        |   b8 00 00 00 00       	mov    $0x0,%eax
+    60ed:	|  /-----|-- e9 bf 00 00 00       	jmp    61b1 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+            } else if (new_cap == item_->capacity()) {
+    60f2:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    60f6:	|  |         48 8b 00             	mov    (%rax),%rax
+    60f9:	|  |         48 89 c7             	mov    %rax,%rdi
+    60fc:	|  |         e8 07 01 00 00       	call   6208 <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    6101:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    6105:	|  |         0f 94 c0             	sete   %al
+    6108:	|  |         84 c0                	test   %al,%al
+    610a:	+--|-------- 0f 85 9c 00 00 00    	jne    61ac <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap > item_->capacity()) {
+    6110:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6114:	|  |         48 8b 00             	mov    (%rax),%rax
+    6117:	|  |         48 89 c7             	mov    %rax,%rdi
+    611a:	|  |         e8 e9 00 00 00       	call   6208 <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    611f:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    6123:	|  |         0f 92 c0             	setb   %al
+    6126:	|  |         84 c0                	test   %al,%al
+    6128:	|  |  /----- 74 35                	je     615f <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xff>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    612a:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    612e:	|  |  |      48 8b 00             	mov    (%rax),%rax
+    6131:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    6135:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    6138:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    613b:	|  |  |      e8 25 fd ff ff       	call   5e65 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    6140:	|  |  |      48 89 45 f0          	mov    %rax,-0x10(%rbp)
+                if (p == nullptr) { return false; }
+    6144:	|  |  |      48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    6149:	|  |  |  /-- 75 07                	jne    6152 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xf2>
+    614b:	|  |  |  |   b8 00 00 00 00       	mov    $0x0,%eax
+    6150:	|  +--|--|-- eb 5f                	jmp    61b1 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    6152:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6156:	|  |  |      48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    615a:	|  |  |      48 89 10             	mov    %rdx,(%rax)
+    615d:	+--|--|----- eb 4d                	jmp    61ac <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap < item_->capacity()) {
+    615f:	|  |  \----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6163:	|  |         48 8b 00             	mov    (%rax),%rax
+    6166:	|  |         48 89 c7             	mov    %rax,%rdi
+    6169:	|  |         e8 9a 00 00 00       	call   6208 <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    616e:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    6172:	|  |         0f 92 c0             	setb   %al
+    6175:	|  |         84 c0                	test   %al,%al
+    6177:	+--|-------- 74 33                	je     61ac <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    6179:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    617d:	|  |         48 8b 00             	mov    (%rax),%rax
+    6180:	|  |         48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    6184:	|  |         48 89 d6             	mov    %rdx,%rsi
+    6187:	|  |         48 89 c7             	mov    %rax,%rdi
+    618a:	|  |         e8 d6 fc ff ff       	call   5e65 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    618f:	|  |         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                if (p == nullptr) { return false; }
+    6193:	|  |         48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    6198:	|  |     /-- 75 07                	jne    61a1 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x141>
+    619a:	|  |     |   b8 00 00 00 00       	mov    $0x0,%eax
+    619f:	|  +-----|-- eb 10                	jmp    61b1 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    61a1:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    61a5:	|  |         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    61a9:	|  |         48 89 10             	mov    %rdx,(%rax)
+            return true;
+    61ac:	\--|-------> b8 01 00 00 00       	mov    $0x1,%eax
+        }
+    61b1:	   \-------> c9                   	leave
+    61b2:	             c3                   	ret
+    61b3:	             90                   	nop
+
+00000000000061b4 <nel::Result<void, int>::Result<int&>(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)2>, int&)>:
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+    61b4:	55                   	push   %rbp
+    61b5:	48 89 e5             	mov    %rsp,%rbp
+    61b8:	53                   	push   %rbx
+    61b9:	48 83 ec 18          	sub    $0x18,%rsp
+    61bd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    61c1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    61c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    61c9:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<Args>(args)...)
+    61cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    61d3:	48 8d 58 04          	lea    0x4(%rax),%rbx
+    61d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    61db:	48 89 c7             	mov    %rax,%rdi
+    61de:	e8 d0 f9 ff ff       	call   5bb3 <int& nel::forward<int&, int>(int&)>
+    61e3:	48 89 c6             	mov    %rax,%rsi
+    61e6:	48 89 df             	mov    %rbx,%rdi
+    61e9:	e8 42 02 00 00       	call   6430 <nel::Element<int>::Element<int&>(int&)>
+        }
+    61ee:	90                   	nop
+    61ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    61f3:	c9                   	leave
+    61f4:	c3                   	ret
+    61f5:	90                   	nop
+
+00000000000061f6 <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>:
+        constexpr Length len(void) const
+    61f6:	55                   	push   %rbp
+    61f7:	48 89 e5             	mov    %rsp,%rbp
+    61fa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    61fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6202:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    6206:	5d                   	pop    %rbp
+    6207:	c3                   	ret
+
+0000000000006208 <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>:
+        constexpr Count capacity(void) const
+    6208:	55                   	push   %rbp
+    6209:	48 89 e5             	mov    %rsp,%rbp
+    620c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return alloc_;
+    6210:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6214:	48 8b 00             	mov    (%rax),%rax
+        }
+    6217:	5d                   	pop    %rbp
+    6218:	c3                   	ret
+
+0000000000006219 <int*&& nel::move<int*>(int*&)>:
+constexpr T &&move(T &v)
+    6219:	55                   	push   %rbp
+    621a:	48 89 e5             	mov    %rsp,%rbp
+    621d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    6221:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    6225:	5d                   	pop    %rbp
+    6226:	c3                   	ret
+    6227:	90                   	nop
+
+0000000000006228 <nel::Optional<int&>::Optional(nel::Optional<int&>::Phantom<(nel::Optional<int&>::Tag)2>, int&)>:
+        constexpr Optional(Phantom<Tag::SOME> const, T &&v)
+    6228:	55                   	push   %rbp
+    6229:	48 89 e5             	mov    %rsp,%rbp
+    622c:	53                   	push   %rbx
+    622d:	48 83 ec 18          	sub    $0x18,%rsp
+    6231:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    6235:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::SOME)
+    6239:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    623d:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , some_(forward<T>(v))
+    6243:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6247:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    624b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    624f:	48 89 c7             	mov    %rax,%rdi
+    6252:	e8 5c f9 ff ff       	call   5bb3 <int& nel::forward<int&, int>(int&)>
+    6257:	48 89 c6             	mov    %rax,%rsi
+    625a:	48 89 df             	mov    %rbx,%rdi
+    625d:	e8 f6 01 00 00       	call   6458 <nel::Element<int&>::Element(int&)>
+        }
+    6262:	90                   	nop
+    6263:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    6267:	c9                   	leave
+    6268:	c3                   	ret
+    6269:	90                   	nop
+
+000000000000626a <nel::Element<int&>::ref()>:
+        constexpr Type &ref(void)
+    626a:	55                   	push   %rbp
+    626b:	48 89 e5             	mov    %rsp,%rbp
+    626e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    6272:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6276:	48 8b 00             	mov    (%rax),%rax
+        }
+    6279:	5d                   	pop    %rbp
+    627a:	c3                   	ret
+    627b:	90                   	nop
+
+000000000000627c <nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}::operator()() const>:
+                [&](void) -> Optional<OutT> { return it1_.next_back(); });
+    627c:	55                   	push   %rbp
+    627d:	48 89 e5             	mov    %rsp,%rbp
+    6280:	48 83 ec 10          	sub    $0x10,%rsp
+    6284:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    6288:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    628c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    6290:	48 8b 00             	mov    (%rax),%rax
+    6293:	48 89 c2             	mov    %rax,%rdx
+    6296:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    629a:	48 89 d6             	mov    %rdx,%rsi
+    629d:	48 89 c7             	mov    %rax,%rdi
+    62a0:	e8 d9 01 00 00       	call   647e <nel::SliceIterator<int>::next_back()>
+    62a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    62a9:	c9                   	leave
+    62aa:	c3                   	ret
+    62ab:	90                   	nop
+
+00000000000062ac <nel::ChainIterator<nel::SliceIterator<int> >::next_back()>:
+        Optional<OutT> next_back(void)
+    62ac:	55                   	push   %rbp
+    62ad:	48 89 e5             	mov    %rsp,%rbp
+    62b0:	48 83 ec 40          	sub    $0x40,%rsp
+    62b4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    62b8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+                [&](void) -> Optional<OutT> { return it1_.next_back(); });
+    62bc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    62c0:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    62c4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    62c8:	48 89 d6             	mov    %rdx,%rsi
+    62cb:	48 89 c7             	mov    %rax,%rdi
+    62ce:	e8 ab 01 00 00       	call   647e <nel::SliceIterator<int>::next_back()>
+            return it2_.next_back().or_else(
+    62d3:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    62d7:	b9 b4 02 00 00       	mov    $0x2b4,%ecx
+    62dc:	48 8d 15 1d 20 00 00 	lea    0x201d(%rip),%rdx        # 8300 <queue_len+0x120>
+    62e3:	48 8d 35 f4 21 00 00 	lea    0x21f4(%rip),%rsi        # 84de <queue_len+0x2fe>
+    62ea:	48 89 c7             	mov    %rax,%rdi
+    62ed:	e8 3c e0 ff ff       	call   432e <nel::Context::Context(char const*, char const*, int)>
+                [&](void) -> Optional<OutT> { return it1_.next_back(); });
+    62f2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    62f6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    62fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    62fe:	48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+    6302:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    6306:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+    630a:	48 89 c7             	mov    %rax,%rdi
+    630d:	e8 3e 02 00 00       	call   6550 <nel::Optional<int&> nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)>
+    6312:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    6316:	48 89 c7             	mov    %rax,%rdi
+    6319:	e8 ee e5 ff ff       	call   490c <nel::Optional<int&>::~Optional()>
+        }
+    631e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    6322:	c9                   	leave
+    6323:	c3                   	ret
+
+0000000000006324 <nel::Element<int>::ref()>:
+        constexpr Type &ref(void)
+    6324:	55                   	push   %rbp
+    6325:	48 89 e5             	mov    %rsp,%rbp
+    6328:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    632c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    6330:	5d                   	pop    %rbp
+    6331:	c3                   	ret
+
+0000000000006332 <nel::Element<void*>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    6332:	55                   	push   %rbp
+    6333:	48 89 e5             	mov    %rsp,%rbp
+    6336:	48 83 ec 10          	sub    $0x10,%rsp
+    633a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    633e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6342:	48 89 c7             	mov    %rax,%rdi
+    6345:	e8 4c 02 00 00       	call   6596 <nel::Element<void*>::ref() const>
+        }
+    634a:	c9                   	leave
+    634b:	c3                   	ret
+
+000000000000634c <nel::Element<nel::heaped::AllocError>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    634c:	55                   	push   %rbp
+    634d:	48 89 e5             	mov    %rsp,%rbp
+    6350:	48 83 ec 10          	sub    $0x10,%rsp
+    6354:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    6358:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    635c:	48 89 c7             	mov    %rax,%rdi
+    635f:	e8 40 02 00 00       	call   65a4 <nel::Element<nel::heaped::AllocError>::ref() const>
+        }
+    6364:	c9                   	leave
+    6365:	c3                   	ret
+
+0000000000006366 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>:
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    6366:	55                   	push   %rbp
+    6367:	48 89 e5             	mov    %rsp,%rbp
+    636a:	48 83 ec 10          	sub    $0x10,%rsp
+    636e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    6372:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    6376:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    637a:	48 89 c7             	mov    %rax,%rdi
+    637d:	e8 30 02 00 00       	call   65b2 <void*&& nel::forward<void*, void*>(void*&)>
+    6382:	48 8b 00             	mov    (%rax),%rax
+    6385:	c9                   	leave
+    6386:	c3                   	ret
+    6387:	90                   	nop
+
+0000000000006388 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>:
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    6388:	55                   	push   %rbp
+    6389:	48 89 e5             	mov    %rsp,%rbp
+    638c:	48 83 ec 10          	sub    $0x10,%rsp
+    6390:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    6394:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    6398:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    639c:	48 8b 00             	mov    (%rax),%rax
+    639f:	48 89 c6             	mov    %rax,%rsi
+    63a2:	48 8d 05 3b 27 00 00 	lea    0x273b(%rip),%rax        # 8ae4 <queue_len+0x904>
+    63a9:	48 89 c7             	mov    %rax,%rdi
+    63ac:	e8 3e 04 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+    63b1:	90                   	nop
+
+00000000000063b2 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>:
+        constexpr T unwrap(Context const &ctx = Context())
+    63b2:	55                   	push   %rbp
+    63b3:	48 89 e5             	mov    %rsp,%rbp
+    63b6:	48 83 ec 20          	sub    $0x20,%rsp
+    63ba:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    63be:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    63c2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    63c6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    63ca:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    63ce:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    63d2:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    63d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    63da:	48 89 c7             	mov    %rax,%rdi
+    63dd:	e8 de 01 00 00       	call   65c0 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>
+        }
+    63e2:	c9                   	leave
+    63e3:	c3                   	ret
+
+00000000000063e4 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>:
+
+    public:
+        // Smallest non-zero capacity grown to, saves the first few tiny reallocs.
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+    63e4:	          55                   	push   %rbp
+    63e5:	          48 89 e5             	mov    %rsp,%rbp
+    63e8:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    63ec:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            if (cap <= cur) { return cap; }
+    63f0:	          48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    63f4:	          48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    63f8:	      /-- 72 06                	jb     6400 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x1c>
+    63fa:	      |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    63fe:	/-----|-- eb 2e                	jmp    642e <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x4a>
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    6400:	|     \-> 48 83 7d e8 03       	cmpq   $0x3,-0x18(%rbp)
+    6405:	|  /----- 76 09                	jbe    6410 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x2c>
+    6407:	|  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    640b:	|  |      48 01 c0             	add    %rax,%rax
+    640e:	|  |  /-- eb 05                	jmp    6415 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x31>
+    6410:	|  \--|-> b8 04 00 00 00       	mov    $0x4,%eax
+    6415:	|     \-> 48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return (cap < g) ? g : cap;
+    6419:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    641d:	|         48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    6421:	|  /----- 73 06                	jae    6429 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x45>
+    6423:	|  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6427:	|  |  /-- eb 04                	jmp    642d <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x49>
+    6429:	|  \--|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    642d:	|     \-> 90                   	nop
+        }
+    642e:	\-------> 5d                   	pop    %rbp
+    642f:	          c3                   	ret
+
+0000000000006430 <nel::Element<int>::Element<int&>(int&)>:
+        constexpr Element(Args &&...args)
+    6430:	55                   	push   %rbp
+    6431:	48 89 e5             	mov    %rsp,%rbp
+    6434:	48 83 ec 10          	sub    $0x10,%rsp
+    6438:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    643c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Args>(args)...)
+    6440:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    6444:	48 89 c7             	mov    %rax,%rdi
+    6447:	e8 67 f7 ff ff       	call   5bb3 <int& nel::forward<int&, int>(int&)>
+    644c:	8b 10                	mov    (%rax),%edx
+    644e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6452:	89 10                	mov    %edx,(%rax)
+        }
+    6454:	90                   	nop
+    6455:	c9                   	leave
+    6456:	c3                   	ret
+    6457:	90                   	nop
+
+0000000000006458 <nel::Element<int&>::Element(int&)>:
+        constexpr Element(Type &&val)
+    6458:	55                   	push   %rbp
+    6459:	48 89 e5             	mov    %rsp,%rbp
+    645c:	48 83 ec 10          	sub    $0x10,%rsp
+    6460:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    6464:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    6468:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    646c:	48 89 c7             	mov    %rax,%rdi
+    646f:	e8 3f f7 ff ff       	call   5bb3 <int& nel::forward<int&, int>(int&)>
+    6474:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    6478:	48 89 02             	mov    %rax,(%rdx)
+        }
+    647b:	90                   	nop
+    647c:	c9                   	leave
+    647d:	c3                   	ret
+
+000000000000647e <nel::SliceIterator<int>::next_back()>:
+        Optional<OutT> next_back(void)
+    647e:	       55                   	push   %rbp
+    647f:	       48 89 e5             	mov    %rsp,%rbp
+    6482:	       48 83 ec 10          	sub    $0x10,%rsp
+    6486:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    648a:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            if (b_ == e_) { return None; }
+    648e:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    6492:	       48 8b 10             	mov    (%rax),%rdx
+    6495:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    6499:	       48 8b 40 08          	mov    0x8(%rax),%rax
+    649d:	       48 39 c2             	cmp    %rax,%rdx
+    64a0:	   /-- 75 18                	jne    64ba <nel::SliceIterator<int>::next_back()+0x3c>
+    64a2:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    64a6:	   |   48 8d 15 83 1b 00 00 	lea    0x1b83(%rip),%rdx        # 8030 <nel::None>
+    64ad:	   |   48 89 d6             	mov    %rdx,%rsi
+    64b0:	   |   48 89 c7             	mov    %rax,%rdi
+    64b3:	   |   e8 0c f6 ff ff       	call   5ac4 <nel::Optional<int&>::Optional(nel::NoneT const&)>
+    64b8:	/--|-- eb 2b                	jmp    64e5 <nel::SliceIterator<int>::next_back()+0x67>
+            return Some(*--e_);
+    64ba:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    64be:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    64c2:	|      48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    64c6:	|      48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    64ca:	|      48 89 50 08          	mov    %rdx,0x8(%rax)
+    64ce:	|      48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    64d2:	|      48 8b 50 08          	mov    0x8(%rax),%rdx
+    64d6:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    64da:	|      48 89 d6             	mov    %rdx,%rsi
+    64dd:	|      48 89 c7             	mov    %rax,%rdi
+    64e0:	|      e8 f8 f5 ff ff       	call   5add <nel::Optional<int&> nel::Some<int&>(int&)>
+        }
+    64e5:	\----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    64e9:	       c9                   	leave
+    64ea:	       c3                   	ret
+    64eb:	       90                   	nop
+
+00000000000064ec <nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}::operator()(int&) const>:
+            return consume<Optional>([](T &&some)
+    64ec:	55                   	push   %rbp
+    64ed:	48 89 e5             	mov    %rsp,%rbp
+    64f0:	48 83 ec 20          	sub    $0x20,%rsp
+    64f4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    64f8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    64fc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+                                         -> Optional { return Optional::Some(forward<T>(some)); },
+    6500:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6504:	48 89 c7             	mov    %rax,%rdi
+    6507:	e8 a7 f6 ff ff       	call   5bb3 <int& nel::forward<int&, int>(int&)>
+    650c:	48 89 c2             	mov    %rax,%rdx
+    650f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6513:	48 89 d6             	mov    %rdx,%rsi
+    6516:	48 89 c7             	mov    %rax,%rdi
+    6519:	e8 61 f6 ff ff       	call   5b7f <nel::Optional<int&>::Some(int&)>
+            return consume<Optional>([](T &&some)
+    651e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6522:	c9                   	leave
+    6523:	c3                   	ret
+
+0000000000006524 <nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}::operator()() const>:
+                                     [&fn](void) -> Optional { return fn(); },
+    6524:	55                   	push   %rbp
+    6525:	48 89 e5             	mov    %rsp,%rbp
+    6528:	48 83 ec 10          	sub    $0x10,%rsp
+    652c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    6530:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    6534:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    6538:	48 8b 10             	mov    (%rax),%rdx
+    653b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    653f:	48 89 d6             	mov    %rdx,%rsi
+    6542:	48 89 c7             	mov    %rax,%rdi
+    6545:	e8 32 fd ff ff       	call   627c <nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}::operator()() const>
+    654a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    654e:	c9                   	leave
+    654f:	c3                   	ret
+
+0000000000006550 <nel::Optional<int&> nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)>:
+        Optional or_else(Fn &&fn, Context const &ctx = Context())
+    6550:	55                   	push   %rbp
+    6551:	48 89 e5             	mov    %rsp,%rbp
+    6554:	48 83 ec 30          	sub    $0x30,%rsp
+    6558:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    655c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    6560:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    6564:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+                                     [&fn](void) -> Optional { return fn(); },
+    6568:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    656c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+                                     ctx);
+    6570:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6574:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    6578:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+    657c:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    6580:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+    6584:	49 89 f8             	mov    %rdi,%r8
+    6587:	48 89 c7             	mov    %rax,%rdi
+    658a:	e8 fb 00 00 00       	call   668a <nel::Optional<int&> nel::Optional<int&>::consume<nel::Optional<int&>, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)>
+        }
+    658f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6593:	c9                   	leave
+    6594:	c3                   	ret
+    6595:	90                   	nop
+
+0000000000006596 <nel::Element<void*>::ref() const>:
+        constexpr Type const &ref(void) const
+    6596:	55                   	push   %rbp
+    6597:	48 89 e5             	mov    %rsp,%rbp
+    659a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    659e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    65a2:	5d                   	pop    %rbp
+    65a3:	c3                   	ret
+
+00000000000065a4 <nel::Element<nel::heaped::AllocError>::ref() const>:
+        constexpr Type const &ref(void) const
+    65a4:	55                   	push   %rbp
+    65a5:	48 89 e5             	mov    %rsp,%rbp
+    65a8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    65ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    65b0:	5d                   	pop    %rbp
+    65b1:	c3                   	ret
+
+00000000000065b2 <void*&& nel::forward<void*, void*>(void*&)>:
+constexpr U &&forward(T &t)
+    65b2:	55                   	push   %rbp
+    65b3:	48 89 e5             	mov    %rsp,%rbp
+    65b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    65ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    65be:	5d                   	pop    %rbp
+    65bf:	c3                   	ret
+
+00000000000065c0 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    65c0:	             55                   	push   %rbp
+    65c1:	             48 89 e5             	mov    %rsp,%rbp
+    65c4:	             48 83 ec 30          	sub    $0x30,%rsp
+    65c8:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    65cc:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    65d0:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    65d4:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    65d8:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    65dc:	             8b 00                	mov    (%rax),%eax
+    65de:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    65e1:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    65e5:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    65eb:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    65ef:	         /-- 74 3e                	je     662f <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x6f>
+    65f1:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    65f5:	/--------|-- 7f 7a                	jg     6671 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+    65f7:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    65fb:	|  /-----|-- 74 5e                	je     665b <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x9b>
+    65fd:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    6601:	+--|-----|-- 75 6e                	jne    6671 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+                    return on_ok(forward<T>(*ok_));
+    6603:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6607:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    660b:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    660e:	|  |     |   e8 37 01 00 00       	call   674a <nel::Element<void*>::operator*()>
+    6613:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    6616:	|  |     |   e8 97 ff ff ff       	call   65b2 <void*&& nel::forward<void*, void*>(void*&)>
+    661b:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    661e:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    6622:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    6625:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    6628:	|  |     |   e8 39 fd ff ff       	call   6366 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>
+    662d:	|  |  /--|-- eb 58                	jmp    6687 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    return on_err(forward<E>(*err_));
+    662f:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6633:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    6637:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    663a:	|  |  |      e8 25 01 00 00       	call   6764 <nel::Element<nel::heaped::AllocError>::operator*()>
+    663f:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    6642:	|  |  |      e8 99 ea ff ff       	call   50e0 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    6647:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    664a:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    664e:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    6651:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    6654:	|  |  |      e8 2f fd ff ff       	call   6388 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>
+    6659:	|  |  +----- eb 2c                	jmp    6687 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    nel::panic("invalid Result", ctx);
+    665b:	|  \--|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    665f:	|     |      48 89 c6             	mov    %rax,%rsi
+    6662:	|     |      48 8d 05 ef 1d 00 00 	lea    0x1def(%rip),%rax        # 8458 <queue_len+0x278>
+    6669:	|     |      48 89 c7             	mov    %rax,%rdi
+    666c:	|     |      e8 7e 01 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    6671:	\-----|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    6675:	      |      48 89 c6             	mov    %rax,%rsi
+    6678:	      |      48 8d 05 3c 1c 00 00 	lea    0x1c3c(%rip),%rax        # 82bb <queue_len+0xdb>
+    667f:	      |      48 89 c7             	mov    %rax,%rdi
+    6682:	      |      e8 68 01 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+        }
+    6687:	      \----> c9                   	leave
+    6688:	             c3                   	ret
+    6689:	             90                   	nop
+
+000000000000668a <nel::Optional<int&> nel::Optional<int&>::consume<nel::Optional<int&>, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_some, Fn2 &&on_none, Context const &ctx = Context())
+    668a:	             55                   	push   %rbp
+    668b:	             48 89 e5             	mov    %rsp,%rbp
+    668e:	             48 83 ec 40          	sub    $0x40,%rsp
+    6692:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    6696:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    669a:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    669e:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    66a2:	             4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+            auto tag = tag_;
+    66a6:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    66aa:	             8b 00                	mov    (%rax),%eax
+    66ac:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    66af:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    66b3:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // optional::consume
+    66b9:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    66bd:	         /-- 74 14                	je     66d3 <nel::Optional<int&> nel::Optional<int&>::consume<nel::Optional<int&>, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x49>
+    66bf:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    66c3:	/--------|-- 7f 69                	jg     672e <nel::Optional<int&> nel::Optional<int&>::consume<nel::Optional<int&>, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0xa4>
+    66c5:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    66c9:	|  /-----|-- 74 4d                	je     6718 <nel::Optional<int&> nel::Optional<int&>::consume<nel::Optional<int&>, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x8e>
+    66cb:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    66cf:	|  |  /--|-- 74 32                	je     6703 <nel::Optional<int&> nel::Optional<int&>::consume<nel::Optional<int&>, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x79>
+    66d1:	+--|--|--|-- eb 5b                	jmp    672e <nel::Optional<int&> nel::Optional<int&>::consume<nel::Optional<int&>, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0xa4>
+                    return on_some(forward<T>(*some_));
+    66d3:	|  |  |  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    66d7:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    66db:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    66de:	|  |  |      e8 9f f5 ff ff       	call   5c82 <nel::Element<int&>::operator*()>
+    66e3:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    66e6:	|  |  |      e8 c8 f4 ff ff       	call   5bb3 <int& nel::forward<int&, int>(int&)>
+    66eb:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    66ee:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    66f2:	|  |  |      48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+    66f6:	|  |  |      48 89 ce             	mov    %rcx,%rsi
+    66f9:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    66fc:	|  |  |      e8 eb fd ff ff       	call   64ec <nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}::operator()(int&) const>
+    6701:	|  |  |  /-- eb 41                	jmp    6744 <nel::Optional<int&> nel::Optional<int&>::consume<nel::Optional<int&>, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0xba>
+                    return on_none();
+    6703:	|  |  \--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6707:	|  |     |   48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    670b:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    670e:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    6711:	|  |     |   e8 0e fe ff ff       	call   6524 <nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}::operator()() const>
+    6716:	|  |     +-- eb 2c                	jmp    6744 <nel::Optional<int&> nel::Optional<int&>::consume<nel::Optional<int&>, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}>(nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda(int&)#1}&&, nel::Optional<int&>::or_else<nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}>(nel::ChainIterator<nel::SliceIterator<int> >::next_back()::{lambda()#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0xba>
+                    nel::panic("invalid Optional", ctx);
+    6718:	|  \-----|-> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    671c:	|        |   48 89 c6             	mov    %rax,%rsi
+    671f:	|        |   48 8d 05 bc 1b 00 00 	lea    0x1bbc(%rip),%rax        # 82e2 <queue_len+0x102>
+    6726:	|        |   48 89 c7             	mov    %rax,%rdi
+    6729:	|        |   e8 c1 00 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Optional", ctx);
+    672e:	\--------|-> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    6732:	         |   48 89 c6             	mov    %rax,%rsi
+    6735:	         |   48 8d 05 b7 1b 00 00 	lea    0x1bb7(%rip),%rax        # 82f3 <queue_len+0x113>
+    673c:	         |   48 89 c7             	mov    %rax,%rdi
+    673f:	         |   e8 ab 00 00 00       	call   67ef <nel::panic(char const*, nel::Context const&)>
+        }
+    6744:	         \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6748:	             c9                   	leave
+    6749:	             c3                   	ret
+
+000000000000674a <nel::Element<void*>::operator*()>:
+        constexpr Type &operator*(void)
+    674a:	55                   	push   %rbp
+    674b:	48 89 e5             	mov    %rsp,%rbp
+    674e:	48 83 ec 10          	sub    $0x10,%rsp
+    6752:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    6756:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    675a:	48 89 c7             	mov    %rax,%rdi
+    675d:	e8 1c 00 00 00       	call   677e <nel::Element<void*>::ref()>
+        }
+    6762:	c9                   	leave
+    6763:	c3                   	ret
+
+0000000000006764 <nel::Element<nel::heaped::AllocError>::operator*()>:
+        constexpr Type &operator*(void)
+    6764:	55                   	push   %rbp
+    6765:	48 89 e5             	mov    %rsp,%rbp
+    6768:	48 83 ec 10          	sub    $0x10,%rsp
+    676c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    6770:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6774:	48 89 c7             	mov    %rax,%rdi
+    6777:	e8 10 00 00 00       	call   678c <nel::Element<nel::heaped::AllocError>::ref()>
+        }
+    677c:	c9                   	leave
+    677d:	c3                   	ret
+
+000000000000677e <nel::Element<void*>::ref()>:
+        constexpr Type &ref(void)
+    677e:	55                   	push   %rbp
+    677f:	48 89 e5             	mov    %rsp,%rbp
+    6782:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    6786:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    678a:	5d                   	pop    %rbp
+    678b:	c3                   	ret
+
+000000000000678c <nel::Element<nel::heaped::AllocError>::ref()>:
+        constexpr Type &ref(void)
+    678c:	55                   	push   %rbp
+    678d:	48 89 e5             	mov    %rsp,%rbp
+    6790:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    6794:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    6798:	5d                   	pop    %rbp
+    6799:	c3                   	ret
+
+000000000000679a <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    679a:	55                   	push   %rbp
+    679b:	48 89 e5             	mov    %rsp,%rbp
+    std::abort();
+    679e:	e8 9d a8 ff ff       	call   1040 <abort@plt>
+
+00000000000067a3 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    67a3:	55                   	push   %rbp
+    67a4:	48 89 e5             	mov    %rsp,%rbp
+    67a7:	48 83 ec 10          	sub    $0x10,%rsp
+    67ab:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    67af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    67b3:	48 8b 30             	mov    (%rax),%rsi
+    67b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    67ba:	8b 48 10             	mov    0x10(%rax),%ecx
+    67bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    67c1:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    67c5:	48 8b 05 b4 68 00 00 	mov    0x68b4(%rip),%rax        # d080 <stderr@GLIBC_2.2.5>
+    67cc:	4c 8d 0d 1c 23 00 00 	lea    0x231c(%rip),%r9        # 8aef <nel::is_trivially_relocatable<int>+0x1>
+    67d3:	49 89 f0             	mov    %rsi,%r8
+    67d6:	48 8d 35 18 23 00 00 	lea    0x2318(%rip),%rsi        # 8af5 <nel::is_trivially_relocatable<int>+0x7>
+    67dd:	48 89 c7             	mov    %rax,%rdi
+    67e0:	b8 00 00 00 00       	mov    $0x0,%eax
+    67e5:	e8 b6 a8 ff ff       	call   10a0 <fprintf@plt>
+    abort();
+    67ea:	e8 ab ff ff ff       	call   679a <nel::abort()>
+
+00000000000067ef <nel::panic(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    67ef:	55                   	push   %rbp
+    67f0:	48 89 e5             	mov    %rsp,%rbp
+    67f3:	48 83 ec 10          	sub    $0x10,%rsp
+    67f7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    67fb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    67ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    6803:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    6806:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    680a:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    680d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    6811:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    6815:	48 8b 05 64 68 00 00 	mov    0x6864(%rip),%rax        # d080 <stderr@GLIBC_2.2.5>
+    681c:	48 83 ec 08          	sub    $0x8,%rsp
+    6820:	ff 75 f8             	push   -0x8(%rbp)
+    6823:	4c 8d 0d c5 22 00 00 	lea    0x22c5(%rip),%r9        # 8aef <nel::is_trivially_relocatable<int>+0x1>
+    682a:	49 89 f0             	mov    %rsi,%r8
+    682d:	48 8d 35 d2 22 00 00 	lea    0x22d2(%rip),%rsi        # 8b06 <nel::is_trivially_relocatable<int>+0x18>
+    6834:	48 89 c7             	mov    %rax,%rdi
+    6837:	b8 00 00 00 00       	mov    $0x0,%eax
+    683c:	e8 5f a8 ff ff       	call   10a0 <fprintf@plt>
+    6841:	48 83 c4 10          	add    $0x10,%rsp
+            "PANIC",
+            msg);
+    abort();
+    6845:	e8 50 ff ff ff       	call   679a <nel::abort()>
+
+000000000000684a <nel::assert_fail(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    684a:	55                   	push   %rbp
+    684b:	48 89 e5             	mov    %rsp,%rbp
+    684e:	48 83 ec 10          	sub    $0x10,%rsp
+    6852:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    6856:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    685a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    685e:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    6861:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    6865:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    6868:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    686c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    6870:	48 8b 05 09 68 00 00 	mov    0x6809(%rip),%rax        # d080 <stderr@GLIBC_2.2.5>
+    6877:	48 83 ec 08          	sub    $0x8,%rsp
+    687b:	ff 75 f8             	push   -0x8(%rbp)
+    687e:	4c 8d 0d 96 22 00 00 	lea    0x2296(%rip),%r9        # 8b1b <nel::is_trivially_relocatable<int>+0x2d>
+    6885:	49 89 f0             	mov    %rsi,%r8
+    6888:	48 8d 35 77 22 00 00 	lea    0x2277(%rip),%rsi        # 8b06 <nel::is_trivially_relocatable<int>+0x18>
+    688f:	48 89 c7             	mov    %rax,%rdi
+    6892:	b8 00 00 00 00       	mov    $0x0,%eax
+    6897:	e8 04 a8 ff ff       	call   10a0 <fprintf@plt>
+    689c:	48 83 c4 10          	add    $0x10,%rsp
+            "ASSERT FAIL",
+            msg);
+    abort();
+    68a0:	e8 f5 fe ff ff       	call   679a <nel::abort()>
+
+00000000000068a5 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    68a5:	55                   	push   %rbp
+    68a6:	48 89 e5             	mov    %rsp,%rbp
+    68a9:	48 83 ec 20          	sub    $0x20,%rsp
+    68ad:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    68b1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    68b5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    68b9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    68bd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    68c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    68c5:	48 89 ce             	mov    %rcx,%rsi
+    68c8:	48 89 c7             	mov    %rax,%rdi
+    68cb:	e8 e0 a7 ff ff       	call   10b0 <memcpy@plt>
+}
+    68d0:	90                   	nop
+    68d1:	c9                   	leave
+    68d2:	c3                   	ret
+
+00000000000068d3 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    68d3:	55                   	push   %rbp
+    68d4:	48 89 e5             	mov    %rsp,%rbp
+    68d7:	48 83 ec 20          	sub    $0x20,%rsp
+    68db:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    68df:	89 f0                	mov    %esi,%eax
+    68e1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    68e5:	88 45 f4             	mov    %al,-0xc(%rbp)
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    68e8:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    68ec:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    68f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    68f4:	89 ce                	mov    %ecx,%esi
+    68f6:	48 89 c7             	mov    %rax,%rdi
+    68f9:	e8 72 a7 ff ff       	call   1070 <memset@plt>
+}
+    68fe:	90                   	nop
+    68ff:	c9                   	leave
+    6900:	c3                   	ret
+
+0000000000006901 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    6901:	55                   	push   %rbp
+    6902:	48 89 e5             	mov    %rsp,%rbp
+    6905:	48 83 ec 20          	sub    $0x20,%rsp
+    6909:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    690d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    6911:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    //     *id = *is;
+    // }
+    // for (uint8_t *id = d, *is = s, *const e = (d + n); id != e; ++is, ++id) {
+    //     *is = 0xa5;
+    // }
+    copy(d, s, n);
+    6915:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    6919:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    691d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6921:	48 89 ce             	mov    %rcx,%rsi
+    6924:	48 89 c7             	mov    %rax,%rdi
+    6927:	e8 79 ff ff ff       	call   68a5 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    poison(s, n);
+    692c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    6930:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    6934:	48 89 d6             	mov    %rdx,%rsi
+    6937:	48 89 c7             	mov    %rax,%rdi
+    693a:	e8 60 07 00 00       	call   709f <nel::elem::poison(unsigned char*, unsigned long)>
+}
+    693f:	90                   	nop
+    6940:	c9                   	leave
+    6941:	c3                   	ret
+
+0000000000006942 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    6942:	55                   	push   %rbp
+    6943:	48 89 e5             	mov    %rsp,%rbp
+    6946:	48 83 ec 20          	sub    $0x20,%rsp
+    694a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    694e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    6952:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    std::memmove(d, s, n);
+    6956:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    695a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    695e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6962:	48 89 ce             	mov    %rcx,%rsi
+    6965:	48 89 c7             	mov    %rax,%rdi
+    6968:	e8 63 a7 ff ff       	call   10d0 <memmove@plt>
+}
+    696d:	90                   	nop
+    696e:	c9                   	leave
+    696f:	c3                   	ret
+
+0000000000006970 <nel::elem::wipe(unsigned char*, unsigned long)>:
+
+void wipe(uint8_t *const d, Length const n)
+{
+    6970:	55                   	push   %rbp
+    6971:	48 89 e5             	mov    %rsp,%rbp
+    6974:	48 83 ec 10          	sub    $0x10,%rsp
+    6978:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    697c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    set(d, 0xa5, n);
+    6980:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    6984:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6988:	be a5 00 00 00       	mov    $0xa5,%esi
+    698d:	48 89 c7             	mov    %rax,%rdi
+    6990:	e8 3e ff ff ff       	call   68d3 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    6995:	90                   	nop
+    6996:	c9                   	leave
+    6997:	c3                   	ret
+
+0000000000006998 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    6998:	55                   	push   %rbp
+    6999:	48 89 e5             	mov    %rsp,%rbp
+    699c:	48 83 ec 20          	sub    $0x20,%rsp
+    69a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    69a4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    69a8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    69ac:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    69b0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    69b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    69b8:	48 89 ce             	mov    %rcx,%rsi
+    69bb:	48 89 c7             	mov    %rax,%rdi
+    69be:	e8 cd a6 ff ff       	call   1090 <memcmp@plt>
+    69c3:	85 c0                	test   %eax,%eax
+    69c5:	0f 94 c0             	sete   %al
+}
+    69c8:	c9                   	leave
+    69c9:	c3                   	ret
+
+00000000000069ca <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    69ca:	55                   	push   %rbp
+    69cb:	48 89 e5             	mov    %rsp,%rbp
+    69ce:	48 83 ec 20          	sub    $0x20,%rsp
+    69d2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    69d6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    69da:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    69de:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    69e2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    69e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    69ea:	48 89 ce             	mov    %rcx,%rsi
+    69ed:	48 89 c7             	mov    %rax,%rdi
+    69f0:	e8 9b a6 ff ff       	call   1090 <memcmp@plt>
+    69f5:	85 c0                	test   %eax,%eax
+    69f7:	0f 95 c0             	setne  %al
+}
+    69fa:	c9                   	leave
+    69fb:	c3                   	ret
+
+00000000000069fc <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>:
+
+// d[i] = p[i % 16] for i in [0, n), with normal stores:
+// the pattern once, then doubling the filled region.
+static void set_pattern(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    69fc:	       55                   	push   %rbp
+    69fd:	       48 89 e5             	mov    %rsp,%rbp
+    6a00:	       48 83 ec 30          	sub    $0x30,%rsp
+    6a04:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    6a08:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    6a0c:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    Length done = (n < 16) ? n : 16;
+    6a10:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    6a14:	       ba 10 00 00 00       	mov    $0x10,%edx
+    6a19:	       48 39 d0             	cmp    %rdx,%rax
+    6a1c:	       48 0f 47 c2          	cmova  %rdx,%rax
+    6a20:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    copy(d, p, done);
+    6a24:	       48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    6a28:	       48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    6a2c:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6a30:	       48 89 ce             	mov    %rcx,%rsi
+    6a33:	       48 89 c7             	mov    %rax,%rdi
+    6a36:	       e8 6a fe ff ff       	call   68a5 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    while (done < n) {
+    6a3b:	   /-- eb 3e                	jmp    6a7b <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x7f>
+        Length const m = (done < n - done) ? done : n - done;
+    6a3d:	/--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    6a41:	|  |   48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    6a45:	|  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    6a49:	|  |   48 39 c2             	cmp    %rax,%rdx
+    6a4c:	|  |   48 0f 46 c2          	cmovbe %rdx,%rax
+    6a50:	|  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        copy(d + done, d, m);
+    6a54:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    6a58:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6a5c:	|  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    6a60:	|  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    6a64:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6a68:	|  |   48 89 c6             	mov    %rax,%rsi
+    6a6b:	|  |   48 89 cf             	mov    %rcx,%rdi
+    6a6e:	|  |   e8 32 fe ff ff       	call   68a5 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        done += m;
+    6a73:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    6a77:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+    while (done < n) {
+    6a7b:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6a7f:	|      48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    6a83:	\----- 72 b8                	jb     6a3d <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x41>
+    }
+}
+    6a85:	       90                   	nop
+    6a86:	       90                   	nop
+    6a87:	       c9                   	leave
+    6a88:	       c3                   	ret
+
+0000000000006a89 <nel::elem::load16(unsigned char const*)>:
+static constexpr Length streaming_min = 256;
+
+typedef long long int Line16 __attribute__((vector_size(16)));
+
+static inline Line16 load16(uint8_t const *const s)
+{
+    6a89:	55                   	push   %rbp
+    6a8a:	48 89 e5             	mov    %rsp,%rbp
+    6a8d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Line16 v;
+    std::memcpy(&v, s, sizeof(v));
+    6a91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6a95:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    6a99:	48 8b 00             	mov    (%rax),%rax
+    6a9c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    6aa0:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    return v;
+    6aa4:	66 0f 6f 45 f0       	movdqa -0x10(%rbp),%xmm0
+}
+    6aa9:	5d                   	pop    %rbp
+    6aaa:	c3                   	ret
+
+0000000000006aab <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>:
+
+static inline void stream16(uint8_t *const d, Line16 const &v)
+{
+    6aab:	55                   	push   %rbp
+    6aac:	48 89 e5             	mov    %rsp,%rbp
+    6aaf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    6ab3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    6ab7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    6abb:	66 0f 6f 00          	movdqa (%rax),%xmm0
+    6abf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6ac3:	66 0f e7 00          	movntdq %xmm0,(%rax)
+}
+    6ac7:	90                   	nop
+    6ac8:	5d                   	pop    %rbp
+    6ac9:	c3                   	ret
+
+0000000000006aca <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    6aca:	          55                   	push   %rbp
+    6acb:	          48 89 e5             	mov    %rsp,%rbp
+    6ace:	          48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    6ad2:	          48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    6ad6:	          48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    6ada:	          48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    if (n < streaming_min) {
+    6ade:	          48 81 7d 88 ff 00 00 	cmpq   $0xff,-0x78(%rbp)
+    6ae5:	          00 
+    6ae6:	      /-- 77 1c                	ja     6b04 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        copy(d, s, n);
+    6ae8:	      |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    6aec:	      |   48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    6af0:	      |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    6af4:	      |   48 89 ce             	mov    %rcx,%rsi
+    6af7:	      |   48 89 c7             	mov    %rax,%rdi
+    6afa:	      |   e8 a6 fd ff ff       	call   68a5 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        return;
+    6aff:	/-----|-- e9 98 01 00 00       	jmp    6c9c <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1d2>
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    6b04:	|     \-> 48 8b 45 98          	mov    -0x68(%rbp),%rax
+    6b08:	|         48 f7 d8             	neg    %rax
+    6b0b:	|         83 e0 0f             	and    $0xf,%eax
+    6b0e:	|         48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    copy(d, s, head);
+    6b12:	|         48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    6b16:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    6b1a:	|         48 8b 45 98          	mov    -0x68(%rbp),%rax
+    6b1e:	|         48 89 ce             	mov    %rcx,%rsi
+    6b21:	|         48 89 c7             	mov    %rax,%rdi
+    6b24:	|         e8 7c fd ff ff       	call   68a5 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    Index i = head;
+    6b29:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    6b2d:	|         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    6b31:	|     /-- e9 e1 00 00 00       	jmp    6c17 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        Line16 const a = load16(s + i);
+    6b36:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    6b3a:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6b3e:	|  |  |   48 01 d0             	add    %rdx,%rax
+    6b41:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    6b44:	|  |  |   e8 40 ff ff ff       	call   6a89 <nel::elem::load16(unsigned char const*)>
+    6b49:	|  |  |   0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+        Line16 const b = load16(s + i + 16);
+    6b4d:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6b51:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    6b55:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    6b59:	|  |  |   48 01 d0             	add    %rdx,%rax
+    6b5c:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    6b5f:	|  |  |   e8 25 ff ff ff       	call   6a89 <nel::elem::load16(unsigned char const*)>
+    6b64:	|  |  |   0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+        Line16 const c = load16(s + i + 32);
+    6b68:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6b6c:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    6b70:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    6b74:	|  |  |   48 01 d0             	add    %rdx,%rax
+    6b77:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    6b7a:	|  |  |   e8 0a ff ff ff       	call   6a89 <nel::elem::load16(unsigned char const*)>
+    6b7f:	|  |  |   0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+        Line16 const e = load16(s + i + 48);
+    6b83:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6b87:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    6b8b:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    6b8f:	|  |  |   48 01 d0             	add    %rdx,%rax
+    6b92:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    6b95:	|  |  |   e8 ef fe ff ff       	call   6a89 <nel::elem::load16(unsigned char const*)>
+    6b9a:	|  |  |   0f 29 45 a0          	movaps %xmm0,-0x60(%rbp)
+        stream16(d + i, a);
+    6b9e:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    6ba2:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6ba6:	|  |  |   48 01 c2             	add    %rax,%rdx
+    6ba9:	|  |  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    6bad:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    6bb0:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    6bb3:	|  |  |   e8 f3 fe ff ff       	call   6aab <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, b);
+    6bb8:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6bbc:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    6bc0:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    6bc4:	|  |  |   48 01 c2             	add    %rax,%rdx
+    6bc7:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    6bcb:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    6bce:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    6bd1:	|  |  |   e8 d5 fe ff ff       	call   6aab <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, c);
+    6bd6:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6bda:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    6bde:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    6be2:	|  |  |   48 01 c2             	add    %rax,%rdx
+    6be5:	|  |  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    6be9:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    6bec:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    6bef:	|  |  |   e8 b7 fe ff ff       	call   6aab <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, e);
+    6bf4:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6bf8:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    6bfc:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    6c00:	|  |  |   48 01 c2             	add    %rax,%rdx
+    6c03:	|  |  |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    6c07:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    6c0a:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    6c0d:	|  |  |   e8 99 fe ff ff       	call   6aab <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    6c12:	|  |  |   48 83 45 f8 40       	addq   $0x40,-0x8(%rbp)
+    6c17:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6c1b:	|  |      48 83 c0 40          	add    $0x40,%rax
+    6c1f:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    6c23:	|  \----- 0f 83 0d ff ff ff    	jae    6b36 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x6c>
+    }
+    for (; i + 16 <= n; i += 16) {
+    6c29:	|     /-- eb 36                	jmp    6c61 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x197>
+        stream16(d + i, load16(s + i));
+    6c2b:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    6c2f:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6c33:	|  |  |   48 01 d0             	add    %rdx,%rax
+    6c36:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    6c39:	|  |  |   e8 4b fe ff ff       	call   6a89 <nel::elem::load16(unsigned char const*)>
+    6c3e:	|  |  |   0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+    6c42:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    6c46:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6c4a:	|  |  |   48 01 c2             	add    %rax,%rdx
+    6c4d:	|  |  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    6c51:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    6c54:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    6c57:	|  |  |   e8 4f fe ff ff       	call   6aab <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    6c5c:	|  |  |   48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+    6c61:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6c65:	|  |      48 83 c0 10          	add    $0x10,%rax
+    6c69:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    6c6d:	|  \----- 73 bc                	jae    6c2b <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    6c6f:	|         0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    6c72:	|         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    6c76:	|         48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    6c7a:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    6c7e:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    6c82:	|         48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    6c86:	|         48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+    6c8a:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    6c8e:	|         48 01 d1             	add    %rdx,%rcx
+    6c91:	|         48 89 c2             	mov    %rax,%rdx
+    6c94:	|         48 89 cf             	mov    %rcx,%rdi
+    6c97:	|         e8 09 fc ff ff       	call   68a5 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+}
+    6c9c:	\-------> c9                   	leave
+    6c9d:	          c3                   	ret
+
+0000000000006c9e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    6c9e:	          55                   	push   %rbp
+    6c9f:	          48 89 e5             	mov    %rsp,%rbp
+    6ca2:	          48 83 ec 60          	sub    $0x60,%rsp
+    6ca6:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    6caa:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    6cae:	          48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    if (n < streaming_min) {
+    6cb2:	          48 81 7d a8 ff 00 00 	cmpq   $0xff,-0x58(%rbp)
+    6cb9:	          00 
+    6cba:	      /-- 77 1c                	ja     6cd8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        set_pattern(d, p, n);
+    6cbc:	      |   48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    6cc0:	      |   48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+    6cc4:	      |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    6cc8:	      |   48 89 ce             	mov    %rcx,%rsi
+    6ccb:	      |   48 89 c7             	mov    %rax,%rdi
+    6cce:	      |   e8 29 fd ff ff       	call   69fc <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>
+    6cd3:	/-----|-- e9 89 01 00 00       	jmp    6e61 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c3>
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    6cd8:	|     \-> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    6cdc:	|         48 f7 d8             	neg    %rax
+    6cdf:	|         83 e0 0f             	and    $0xf,%eax
+    6ce2:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    for (Index i = 0; i < head; ++i) {
+    6ce6:	|         48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    6ced:	|         00 
+    6cee:	|     /-- eb 20                	jmp    6d10 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x72>
+        d[i] = p[i];
+    6cf0:	|  /--|-> 48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    6cf4:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6cf8:	|  |  |   48 01 d0             	add    %rdx,%rax
+    6cfb:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    6cff:	|  |  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    6d03:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    6d06:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    6d09:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < head; ++i) {
+    6d0b:	|  |  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    6d10:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6d14:	|  |      48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    6d18:	|  \----- 72 d6                	jb     6cf0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x52>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    6d1a:	|         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    6d21:	|         00 
+    6d22:	|     /-- eb 2d                	jmp    6d51 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xb3>
+        rotated[i] = p[(head + i) % 16];
+    6d24:	|  /--|-> 48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    6d28:	|  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    6d2c:	|  |  |   48 01 d0             	add    %rdx,%rax
+    6d2f:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    6d32:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    6d35:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    6d39:	|  |  |   48 01 d0             	add    %rdx,%rax
+    6d3c:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    6d3f:	|  |  |   48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    6d43:	|  |  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    6d47:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    6d4a:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < 16; ++i) {
+    6d4c:	|  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    6d51:	|  |  \-> 48 83 7d f0 0f       	cmpq   $0xf,-0x10(%rbp)
+    6d56:	|  \----- 76 cc                	jbe    6d24 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x86>
+    }
+    Line16 const v = load16(rotated);
+    6d58:	|         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    6d5c:	|         48 89 c7             	mov    %rax,%rdi
+    6d5f:	|         e8 25 fd ff ff       	call   6a89 <nel::elem::load16(unsigned char const*)>
+    6d64:	|         0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+    Index i = head;
+    6d68:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    6d6c:	|         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    6d70:	|     /-- eb 79                	jmp    6deb <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        stream16(d + i, v);
+    6d72:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    6d76:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6d7a:	|  |  |   48 01 c2             	add    %rax,%rdx
+    6d7d:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    6d81:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    6d84:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    6d87:	|  |  |   e8 1f fd ff ff       	call   6aab <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, v);
+    6d8c:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6d90:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    6d94:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    6d98:	|  |  |   48 01 c2             	add    %rax,%rdx
+    6d9b:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    6d9f:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    6da2:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    6da5:	|  |  |   e8 01 fd ff ff       	call   6aab <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, v);
+    6daa:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6dae:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    6db2:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    6db6:	|  |  |   48 01 c2             	add    %rax,%rdx
+    6db9:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    6dbd:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    6dc0:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    6dc3:	|  |  |   e8 e3 fc ff ff       	call   6aab <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, v);
+    6dc8:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6dcc:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    6dd0:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    6dd4:	|  |  |   48 01 c2             	add    %rax,%rdx
+    6dd7:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    6ddb:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    6dde:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    6de1:	|  |  |   e8 c5 fc ff ff       	call   6aab <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    6de6:	|  |  |   48 83 45 e8 40       	addq   $0x40,-0x18(%rbp)
+    6deb:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6def:	|  |      48 83 c0 40          	add    $0x40,%rax
+    6df3:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    6df7:	|  \----- 0f 83 75 ff ff ff    	jae    6d72 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd4>
+    }
+    for (; i + 16 <= n; i += 16) {
+    6dfd:	|     /-- eb 1f                	jmp    6e1e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x180>
+        stream16(d + i, v);
+    6dff:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    6e03:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6e07:	|  |  |   48 01 c2             	add    %rax,%rdx
+    6e0a:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    6e0e:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    6e11:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    6e14:	|  |  |   e8 92 fc ff ff       	call   6aab <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    6e19:	|  |  |   48 83 45 e8 10       	addq   $0x10,-0x18(%rbp)
+    6e1e:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6e22:	|  |      48 83 c0 10          	add    $0x10,%rax
+    6e26:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    6e2a:	|  \----- 73 d3                	jae    6dff <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    __builtin_ia32_sfence();
+    6e2c:	|         0f ae f8             	sfence
+    for (; i < n; ++i) {
+    6e2f:	|     /-- eb 26                	jmp    6e57 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1b9>
+        d[i] = p[i % 16];
+    6e31:	|  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6e35:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    6e38:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    6e3b:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    6e3f:	|  |  |   48 01 d0             	add    %rdx,%rax
+    6e42:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    6e46:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    6e4a:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    6e4d:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    6e50:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (; i < n; ++i) {
+    6e52:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    6e57:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6e5b:	|  |      48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    6e5f:	|  \----- 72 d0                	jb     6e31 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x193>
+    }
+}
+    6e61:	\-------> c9                   	leave
+    6e62:	          c3                   	ret
+
+0000000000006e63 <nel::offset_of(unsigned char*, unsigned long)>:
+// The payload is the first align boundary leaving room for a Length in front,
+// which holds the offset from the start of the underlying allocation.
+// Malloc alignment is at least alignof(Length), so the payload is at most
+// align bytes in.
+static Length offset_of(uint8_t *const base, Length const align)
+{
+    6e63:	55                   	push   %rbp
+    6e64:	48 89 e5             	mov    %rsp,%rbp
+    6e67:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    6e6b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    USize const a = reinterpret_cast<USize>(base) + sizeof(Length);
+    6e6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6e73:	48 83 c0 08          	add    $0x8,%rax
+    6e77:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    6e7b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    6e7f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    6e83:	48 01 d0             	add    %rdx,%rax
+    6e86:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    6e8a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    6e8e:	48 f7 d8             	neg    %rax
+    6e91:	48 21 c2             	and    %rax,%rdx
+    6e94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6e98:	48 29 c2             	sub    %rax,%rdx
+    6e9b:	48 89 d0             	mov    %rdx,%rax
+}
+    6e9e:	5d                   	pop    %rbp
+    6e9f:	c3                   	ret
+
+0000000000006ea0 <nel::offset_field(unsigned char*)>:
+
+static Length &offset_field(uint8_t *const p)
+{
+    6ea0:	55                   	push   %rbp
+    6ea1:	48 89 e5             	mov    %rsp,%rbp
+    6ea4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return reinterpret_cast<Length *>(p)[-1];
+    6ea8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6eac:	48 83 e8 08          	sub    $0x8,%rax
+}
+    6eb0:	5d                   	pop    %rbp
+    6eb1:	c3                   	ret
+
+0000000000006eb2 <nel::free_aligned(void*)>:
+
+void free_aligned(void *const p)
+{
+    6eb2:	       55                   	push   %rbp
+    6eb3:	       48 89 e5             	mov    %rsp,%rbp
+    6eb6:	       48 83 ec 20          	sub    $0x20,%rsp
+    6eba:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (p == nullptr) { return; }
+    6ebe:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    6ec3:	/----- 74 2e                	je     6ef3 <nel::free_aligned(void*)+0x41>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    6ec5:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6ec9:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    std::free(u8p - offset_field(u8p));
+    6ecd:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6ed1:	|      48 89 c7             	mov    %rax,%rdi
+    6ed4:	|      e8 c7 ff ff ff       	call   6ea0 <nel::offset_field(unsigned char*)>
+    6ed9:	|      48 8b 00             	mov    (%rax),%rax
+    6edc:	|      48 f7 d8             	neg    %rax
+    6edf:	|      48 89 c2             	mov    %rax,%rdx
+    6ee2:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    6ee6:	|      48 01 d0             	add    %rdx,%rax
+    6ee9:	|      48 89 c7             	mov    %rax,%rdi
+    6eec:	|      e8 3f a1 ff ff       	call   1030 <free@plt>
+    6ef1:	|  /-- eb 01                	jmp    6ef4 <nel::free_aligned(void*)+0x42>
+    if (p == nullptr) { return; }
+    6ef3:	\--|-> 90                   	nop
+}
+    6ef4:	   \-> c9                   	leave
+    6ef5:	       c3                   	ret
+
+0000000000006ef6 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    6ef6:	             55                   	push   %rbp
+    6ef7:	             48 89 e5             	mov    %rsp,%rbp
+    6efa:	             53                   	push   %rbx
+    6efb:	             48 83 ec 78          	sub    $0x78,%rsp
+    6eff:	             48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    6f03:	             48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    6f07:	             48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    6f0b:	             48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    6f0f:	             48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    6f13:	             b9 f3 00 00 00       	mov    $0xf3,%ecx
+    6f18:	             48 8d 15 19 1c 00 00 	lea    0x1c19(%rip),%rdx        # 8b38 <nel::elem::streaming_min+0x8>
+    6f1f:	             48 8d 35 24 1c 00 00 	lea    0x1c24(%rip),%rsi        # 8b4a <nel::elem::streaming_min+0x1a>
+    6f26:	             48 89 c7             	mov    %rax,%rdi
+    6f29:	             e8 00 d4 ff ff       	call   432e <nel::Context::Context(char const*, char const*, int)>
+    6f2e:	             48 83 7d 90 00       	cmpq   $0x0,-0x70(%rbp)
+    6f33:	      /----- 74 18                	je     6f4d <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    6f35:	      |      48 8b 45 90          	mov    -0x70(%rbp),%rax
+    6f39:	      |      48 83 e8 01          	sub    $0x1,%rax
+    6f3d:	      |      48 23 45 90          	and    -0x70(%rbp),%rax
+    6f41:	      |      48 85 c0             	test   %rax,%rax
+    6f44:	      +----- 75 07                	jne    6f4d <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    6f46:	      |      b8 01 00 00 00       	mov    $0x1,%eax
+    6f4b:	      |  /-- eb 05                	jmp    6f52 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x5c>
+    6f4d:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    6f52:	         \-> 0f b6 c0             	movzbl %al,%eax
+    6f55:	             48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    6f59:	             48 8d 0d fa 1b 00 00 	lea    0x1bfa(%rip),%rcx        # 8b5a <nel::elem::streaming_min+0x2a>
+    6f60:	             48 89 ce             	mov    %rcx,%rsi
+    6f63:	             89 c7                	mov    %eax,%edi
+    6f65:	             e8 5b 01 00 00       	call   70c5 <nel::assert(bool, char const*, nel::Context const&)>
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    6f6a:	             48 8b 45 98          	mov    -0x68(%rbp),%rax
+    6f6e:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    6f72:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    6f77:	      /----- 74 11                	je     6f8a <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x94>
+    6f79:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6f7d:	      |      48 89 c7             	mov    %rax,%rdi
+    6f80:	      |      e8 1b ff ff ff       	call   6ea0 <nel::offset_field(unsigned char*)>
+    6f85:	      |      48 8b 00             	mov    (%rax),%rax
+    6f88:	      |  /-- eb 05                	jmp    6f8f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x99>
+    6f8a:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    6f8f:	         \-> 48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    6f93:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    6f98:	      /----- 74 13                	je     6fad <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb7>
+    6f9a:	      |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    6f9e:	      |      48 f7 d8             	neg    %rax
+    6fa1:	      |      48 89 c2             	mov    %rax,%rdx
+    6fa4:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    6fa8:	      |      48 01 d0             	add    %rdx,%rax
+    6fab:	      |  /-- eb 05                	jmp    6fb2 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xbc>
+    6fad:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    6fb2:	         \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    6fb6:	             48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    6fba:	             48 8b 45 90          	mov    -0x70(%rbp),%rax
+    6fbe:	             48 01 c2             	add    %rax,%rdx
+    6fc1:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    6fc5:	             48 89 d6             	mov    %rdx,%rsi
+    6fc8:	             48 89 c7             	mov    %rax,%rdi
+    6fcb:	             e8 f0 a0 ff ff       	call   10c0 <realloc@plt>
+    6fd0:	             48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if (new_base == nullptr) { return nullptr; }
+    6fd4:	             48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    6fd9:	         /-- 75 0a                	jne    6fe5 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    6fdb:	         |   b8 00 00 00 00       	mov    $0x0,%eax
+    6fe0:	/--------|-- e9 85 00 00 00       	jmp    706a <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x174>
+
+    Length const new_offset = offset_of(new_base, align);
+    6fe5:	|        \-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    6fe9:	|            48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    6fed:	|            48 89 d6             	mov    %rdx,%rsi
+    6ff0:	|            48 89 c7             	mov    %rax,%rdi
+    6ff3:	|            e8 6b fe ff ff       	call   6e63 <nel::offset_of(unsigned char*, unsigned long)>
+    6ff8:	|            48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    uint8_t *const new_p = new_base + new_offset;
+    6ffc:	|            48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    7000:	|            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    7004:	|            48 01 d0             	add    %rdx,%rax
+    7007:	|            48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    if (old_p != nullptr && new_offset != old_offset) {
+    700b:	|            48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    7010:	|  /-------- 74 41                	je     7053 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+    7012:	|  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    7016:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    701a:	|  +-------- 74 37                	je     7053 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+    701c:	|  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    7020:	|  |         48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    7024:	|  |  /----- 73 06                	jae    702c <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x136>
+    7026:	|  |  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    702a:	|  |  |  /-- eb 04                	jmp    7030 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x13a>
+    702c:	|  |  \--|-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    7030:	|  |     \-> 48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        std::memmove(new_p, new_base + old_offset, n);
+    7034:	|  |         48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    7038:	|  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    703c:	|  |         48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    7040:	|  |         48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    7044:	|  |         48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    7048:	|  |         48 89 ce             	mov    %rcx,%rsi
+    704b:	|  |         48 89 c7             	mov    %rax,%rdi
+    704e:	|  |         e8 7d a0 ff ff       	call   10d0 <memmove@plt>
+    }
+    offset_field(new_p) = new_offset;
+    7053:	|  \-------> 48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+    7057:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    705b:	|            48 89 c7             	mov    %rax,%rdi
+    705e:	|            e8 3d fe ff ff       	call   6ea0 <nel::offset_field(unsigned char*)>
+    7063:	|            48 89 18             	mov    %rbx,(%rax)
+    return new_p;
+    7066:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+}
+    706a:	\----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    706e:	             c9                   	leave
+    706f:	             c3                   	ret
+
+0000000000007070 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    7070:	55                   	push   %rbp
+    7071:	48 89 e5             	mov    %rsp,%rbp
+    7074:	48 83 ec 10          	sub    $0x10,%rsp
+    7078:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    707c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return realloc_aligned(nullptr, align, 0, size);
+    7080:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    7084:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    7088:	48 89 d1             	mov    %rdx,%rcx
+    708b:	ba 00 00 00 00       	mov    $0x0,%edx
+    7090:	48 89 c6             	mov    %rax,%rsi
+    7093:	bf 00 00 00 00       	mov    $0x0,%edi
+    7098:	e8 59 fe ff ff       	call   6ef6 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+}
+    709d:	c9                   	leave
+    709e:	c3                   	ret
+
+000000000000709f <nel::elem::poison(unsigned char*, unsigned long)>:
+{
+    709f:	55                   	push   %rbp
+    70a0:	48 89 e5             	mov    %rsp,%rbp
+    70a3:	48 83 ec 10          	sub    $0x10,%rsp
+    70a7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    70ab:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    copy(d, s, n);
+    70af:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    70b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    70b7:	48 89 d6             	mov    %rdx,%rsi
+    70ba:	48 89 c7             	mov    %rax,%rdi
+    70bd:	e8 ae f8 ff ff       	call   6970 <nel::elem::wipe(unsigned char*, unsigned long)>
+}
+    70c2:	90                   	nop
+    70c3:	c9                   	leave
+    70c4:	c3                   	ret
+
+00000000000070c5 <nel::assert(bool, char const*, nel::Context const&)>:
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx);
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    70c5:	    55                   	push   %rbp
+    70c6:	    48 89 e5             	mov    %rsp,%rbp
+    70c9:	    48 83 ec 20          	sub    $0x20,%rsp
+    70cd:	    89 f8                	mov    %edi,%eax
+    70cf:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    70d3:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    70d7:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { assert_fail(msg, ctx); }
+    70da:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    70de:	    83 f0 01             	xor    $0x1,%eax
+    70e1:	    84 c0                	test   %al,%al
+    70e3:	/-- 74 13                	je     70f8 <nel::assert(bool, char const*, nel::Context const&)+0x33>
+    70e5:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    70e9:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    70ed:	|   48 89 d6             	mov    %rdx,%rsi
+    70f0:	|   48 89 c7             	mov    %rax,%rdi
+    70f3:	|   e8 52 f7 ff ff       	call   684a <nel::assert_fail(char const*, nel::Context const&)>
+}
+    70f8:	\-> 90                   	nop
+    70f9:	    c9                   	leave
+    70fa:	    c3                   	ret
+
+00000000000070fb <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    70fb:	55                   	push   %rbp
+    70fc:	48 89 e5             	mov    %rsp,%rbp
+    70ff:	48 83 ec 10          	sub    $0x10,%rsp
+    7103:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    7107:	89 f0                	mov    %esi,%eax
+    7109:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    710c:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    7110:	48 8b 15 69 5f 00 00 	mov    0x5f69(%rip),%rdx        # d080 <stderr@GLIBC_2.2.5>
+    7117:	48 89 d6             	mov    %rdx,%rsi
+    711a:	89 c7                	mov    %eax,%edi
+    711c:	e8 5f 9f ff ff       	call   1080 <fputc@plt>
+    return outs;
+    7121:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    7125:	c9                   	leave
+    7126:	c3                   	ret
+
+0000000000007127 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    7127:	55                   	push   %rbp
+    7128:	48 89 e5             	mov    %rsp,%rbp
+    712b:	48 83 ec 10          	sub    $0x10,%rsp
+    712f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    7133:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    7137:	48 8b 15 42 5f 00 00 	mov    0x5f42(%rip),%rdx        # d080 <stderr@GLIBC_2.2.5>
+    713e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    7142:	48 89 d6             	mov    %rdx,%rsi
+    7145:	48 89 c7             	mov    %rax,%rdi
+    7148:	e8 13 9f ff ff       	call   1060 <fputs@plt>
+    return outs;
+    714d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    7151:	c9                   	leave
+    7152:	c3                   	ret
+
+0000000000007153 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    7153:	55                   	push   %rbp
+    7154:	48 89 e5             	mov    %rsp,%rbp
+    7157:	48 83 ec 10          	sub    $0x10,%rsp
+    715b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    715f:	89 f0                	mov    %esi,%eax
+    7161:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    7164:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    7168:	48 8b 05 11 5f 00 00 	mov    0x5f11(%rip),%rax        # d080 <stderr@GLIBC_2.2.5>
+    716f:	48 8d 0d ff 19 00 00 	lea    0x19ff(%rip),%rcx        # 8b75 <nel::elem::streaming_min+0x45>
+    7176:	48 89 ce             	mov    %rcx,%rsi
+    7179:	48 89 c7             	mov    %rax,%rdi
+    717c:	b8 00 00 00 00       	mov    $0x0,%eax
+    7181:	e8 1a 9f ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    7186:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    718a:	c9                   	leave
+    718b:	c3                   	ret
+
+000000000000718c <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    718c:	55                   	push   %rbp
+    718d:	48 89 e5             	mov    %rsp,%rbp
+    7190:	48 83 ec 10          	sub    $0x10,%rsp
+    7194:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    7198:	89 f0                	mov    %esi,%eax
+    719a:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    719e:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    71a2:	48 8b 05 d7 5e 00 00 	mov    0x5ed7(%rip),%rax        # d080 <stderr@GLIBC_2.2.5>
+    71a9:	48 8d 0d c5 19 00 00 	lea    0x19c5(%rip),%rcx        # 8b75 <nel::elem::streaming_min+0x45>
+    71b0:	48 89 ce             	mov    %rcx,%rsi
+    71b3:	48 89 c7             	mov    %rax,%rdi
+    71b6:	b8 00 00 00 00       	mov    $0x0,%eax
+    71bb:	e8 e0 9e ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    71c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    71c4:	c9                   	leave
+    71c5:	c3                   	ret
+
+00000000000071c6 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    71c6:	55                   	push   %rbp
+    71c7:	48 89 e5             	mov    %rsp,%rbp
+    71ca:	48 83 ec 10          	sub    $0x10,%rsp
+    71ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    71d2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    71d5:	48 8b 05 a4 5e 00 00 	mov    0x5ea4(%rip),%rax        # d080 <stderr@GLIBC_2.2.5>
+    71dc:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    71df:	48 8d 0d 8f 19 00 00 	lea    0x198f(%rip),%rcx        # 8b75 <nel::elem::streaming_min+0x45>
+    71e6:	48 89 ce             	mov    %rcx,%rsi
+    71e9:	48 89 c7             	mov    %rax,%rdi
+    71ec:	b8 00 00 00 00       	mov    $0x0,%eax
+    71f1:	e8 aa 9e ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    71f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    71fa:	c9                   	leave
+    71fb:	c3                   	ret
+
+00000000000071fc <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    71fc:	55                   	push   %rbp
+    71fd:	48 89 e5             	mov    %rsp,%rbp
+    7200:	48 83 ec 10          	sub    $0x10,%rsp
+    7204:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    7208:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    720b:	48 8b 05 6e 5e 00 00 	mov    0x5e6e(%rip),%rax        # d080 <stderr@GLIBC_2.2.5>
+    7212:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    7215:	48 8d 0d 59 19 00 00 	lea    0x1959(%rip),%rcx        # 8b75 <nel::elem::streaming_min+0x45>
+    721c:	48 89 ce             	mov    %rcx,%rsi
+    721f:	48 89 c7             	mov    %rax,%rdi
+    7222:	b8 00 00 00 00       	mov    $0x0,%eax
+    7227:	e8 74 9e ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    722c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    7230:	c9                   	leave
+    7231:	c3                   	ret
+
+0000000000007232 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    7232:	55                   	push   %rbp
+    7233:	48 89 e5             	mov    %rsp,%rbp
+    7236:	48 83 ec 10          	sub    $0x10,%rsp
+    723a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    723e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    7242:	48 8b 05 37 5e 00 00 	mov    0x5e37(%rip),%rax        # d080 <stderr@GLIBC_2.2.5>
+    7249:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    724d:	48 8d 0d 24 19 00 00 	lea    0x1924(%rip),%rcx        # 8b78 <nel::elem::streaming_min+0x48>
+    7254:	48 89 ce             	mov    %rcx,%rsi
+    7257:	48 89 c7             	mov    %rax,%rdi
+    725a:	b8 00 00 00 00       	mov    $0x0,%eax
+    725f:	e8 3c 9e ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    7264:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    7268:	c9                   	leave
+    7269:	c3                   	ret
+
+Disassembly of section .fini:
+
+000000000000726c <_fini>:
+    726c:	48 83 ec 08          	sub    $0x8,%rsp
+    7270:	48 83 c4 08          	add    $0x8,%rsp
+    7274:	c3                   	ret
@@ -0,0 +1,5138 @@
+
+target/debug/examples/bench_parse:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 8f 00 00 	mov    0x8fc5(%rip),%rax        # 9fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <abort@plt-0x10>:
+    1020:	ff 35 ca 8f 00 00    	push   0x8fca(%rip)        # 9ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 8f 00 00    	jmp    *0x8fcc(%rip)        # 9ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <abort@plt>:
+    1030:	ff 25 ca 8f 00 00    	jmp    *0x8fca(%rip)        # a000 <abort@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <strtod@plt>:
+    1040:	ff 25 c2 8f 00 00    	jmp    *0x8fc2(%rip)        # a008 <strtod@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <clock_gettime@plt>:
+    1050:	ff 25 ba 8f 00 00    	jmp    *0x8fba(%rip)        # a010 <clock_gettime@GLIBC_2.17>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputs@plt>:
+    1060:	ff 25 b2 8f 00 00    	jmp    *0x8fb2(%rip)        # a018 <fputs@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 8f 00 00    	jmp    *0x8faa(%rip)        # a020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <strtoull@plt>:
+    1080:	ff 25 a2 8f 00 00    	jmp    *0x8fa2(%rip)        # a028 <strtoull@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 8f 00 00    	jmp    *0x8f9a(%rip)        # a030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010a0 <__cxa_finalize@plt>:
+    10a0:	ff 25 3a 8f 00 00    	jmp    *0x8f3a(%rip)        # 9fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10a6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010b0 <_start>:
+    10b0:	31 ed                	xor    %ebp,%ebp
+    10b2:	49 89 d1             	mov    %rdx,%r9
+    10b5:	5e                   	pop    %rsi
+    10b6:	48 89 e2             	mov    %rsp,%rdx
+    10b9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    10bd:	50                   	push   %rax
+    10be:	54                   	push   %rsp
+    10bf:	45 31 c0             	xor    %r8d,%r8d
+    10c2:	31 c9                	xor    %ecx,%ecx
+    10c4:	48 8d 3d 0d 07 00 00 	lea    0x70d(%rip),%rdi        # 17d8 <main>
+    10cb:	ff 15 ef 8e 00 00    	call   *0x8eef(%rip)        # 9fc0 <__libc_start_main@GLIBC_2.34>
+    10d1:	f4                   	hlt
+    10d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    10d9:	00 00 00 
+    10dc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000010e0 <deregister_tm_clones>:
+    10e0:	    48 8d 3d 61 8f 00 00 	lea    0x8f61(%rip),%rdi        # a048 <__TMC_END__>
+    10e7:	    48 8d 05 5a 8f 00 00 	lea    0x8f5a(%rip),%rax        # a048 <__TMC_END__>
+    10ee:	    48 39 f8             	cmp    %rdi,%rax
+    10f1:	/-- 74 15                	je     1108 <deregister_tm_clones+0x28>
+    10f3:	|   48 8b 05 ce 8e 00 00 	mov    0x8ece(%rip),%rax        # 9fc8 <_ITM_deregisterTMCloneTable@Base>
+    10fa:	|   48 85 c0             	test   %rax,%rax
+    10fd:	+-- 74 09                	je     1108 <deregister_tm_clones+0x28>
+    10ff:	|   ff e0                	jmp    *%rax
+    1101:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1108:	\-> c3                   	ret
+    1109:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001110 <register_tm_clones>:
+    1110:	    48 8d 3d 31 8f 00 00 	lea    0x8f31(%rip),%rdi        # a048 <__TMC_END__>
+    1117:	    48 8d 35 2a 8f 00 00 	lea    0x8f2a(%rip),%rsi        # a048 <__TMC_END__>
+    111e:	    48 29 fe             	sub    %rdi,%rsi
+    1121:	    48 89 f0             	mov    %rsi,%rax
+    1124:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1128:	    48 c1 f8 03          	sar    $0x3,%rax
+    112c:	    48 01 c6             	add    %rax,%rsi
+    112f:	    48 d1 fe             	sar    %rsi
+    1132:	/-- 74 14                	je     1148 <register_tm_clones+0x38>
+    1134:	|   48 8b 05 9d 8e 00 00 	mov    0x8e9d(%rip),%rax        # 9fd8 <_ITM_registerTMCloneTable@Base>
+    113b:	|   48 85 c0             	test   %rax,%rax
+    113e:	+-- 74 08                	je     1148 <register_tm_clones+0x38>
+    1140:	|   ff e0                	jmp    *%rax
+    1142:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1148:	\-> c3                   	ret
+    1149:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001150 <__do_global_dtors_aux>:
+    1150:	       f3 0f 1e fa          	endbr64
+    1154:	       80 3d 0d 8f 00 00 00 	cmpb   $0x0,0x8f0d(%rip)        # a068 <completed.0>
+    115b:	/----- 75 2b                	jne    1188 <__do_global_dtors_aux+0x38>
+    115d:	|      55                   	push   %rbp
+    115e:	|      48 83 3d 7a 8e 00 00 	cmpq   $0x0,0x8e7a(%rip)        # 9fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1165:	|      00 
+    1166:	|      48 89 e5             	mov    %rsp,%rbp
+    1169:	|  /-- 74 0c                	je     1177 <__do_global_dtors_aux+0x27>
+    116b:	|  |   48 8b 3d ce 8e 00 00 	mov    0x8ece(%rip),%rdi        # a040 <__dso_handle>
+    1172:	|  |   e8 29 ff ff ff       	call   10a0 <__cxa_finalize@plt>
+    1177:	|  \-> e8 64 ff ff ff       	call   10e0 <deregister_tm_clones>
+    117c:	|      c6 05 e5 8e 00 00 01 	movb   $0x1,0x8ee5(%rip)        # a068 <completed.0>
+    1183:	|      5d                   	pop    %rbp
+    1184:	|      c3                   	ret
+    1185:	|      0f 1f 00             	nopl   (%rax)
+    1188:	\----> c3                   	ret
+    1189:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001190 <frame_dummy>:
+    1190:	f3 0f 1e fa          	endbr64
+    1194:	e9 77 ff ff ff       	jmp    1110 <register_tm_clones>
+    1199:	90                   	nop
+
+000000000000119a <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    119a:	55                   	push   %rbp
+    119b:	48 89 e5             	mov    %rsp,%rbp
+    119e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11a2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    11a5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11aa:	5d                   	pop    %rbp
+    11ab:	c3                   	ret
+
+00000000000011ac <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    11ac:	55                   	push   %rbp
+    11ad:	48 89 e5             	mov    %rsp,%rbp
+    11b0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11b4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11b7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return -1;
+    11bb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11c0:	5d                   	pop    %rbp
+    11c1:	c3                   	ret
+
+00000000000011c2 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    11c2:	55                   	push   %rbp
+    11c3:	48 89 e5             	mov    %rsp,%rbp
+    11c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11ca:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11cd:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    return -1;
+    11d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11d5:	5d                   	pop    %rbp
+    11d6:	c3                   	ret
+
+00000000000011d7 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    11d7:	55                   	push   %rbp
+    11d8:	48 89 e5             	mov    %rsp,%rbp
+    11db:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11df:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11e2:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    11e5:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    return -1;
+    11e8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11ed:	5d                   	pop    %rbp
+    11ee:	c3                   	ret
+
+00000000000011ef <_read_r>:
+int _read_r(struct _reent *, int) {
+    11ef:	55                   	push   %rbp
+    11f0:	48 89 e5             	mov    %rsp,%rbp
+    11f3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11f7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    11fa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11ff:	5d                   	pop    %rbp
+    1200:	c3                   	ret
+
+0000000000001201 <_write_r>:
+int _write_r(struct _reent *, int, char *, int) {
+    1201:	55                   	push   %rbp
+    1202:	48 89 e5             	mov    %rsp,%rbp
+    1205:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1209:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    120c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1210:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+    return -1;
+    1213:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1218:	5d                   	pop    %rbp
+    1219:	c3                   	ret
+
+000000000000121a <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    121a:	55                   	push   %rbp
+    121b:	48 89 e5             	mov    %rsp,%rbp
+    121e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return -1;
+    1222:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1227:	5d                   	pop    %rbp
+    1228:	c3                   	ret
+
+0000000000001229 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1229:	55                   	push   %rbp
+    122a:	48 89 e5             	mov    %rsp,%rbp
+    122d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1231:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1234:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1239:	5d                   	pop    %rbp
+    123a:	c3                   	ret
+
+000000000000123b <next_rand(unsigned int&)>:
+
+// 0 terminated, for strtod.
+static char buf[n_bytes + 1];
+
+static unsigned int next_rand(unsigned int &s)
+{
+    123b:	55                   	push   %rbp
+    123c:	48 89 e5             	mov    %rsp,%rbp
+    123f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    s ^= s << 13;
+    1243:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1247:	8b 10                	mov    (%rax),%edx
+    1249:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    124d:	8b 00                	mov    (%rax),%eax
+    124f:	c1 e0 0d             	shl    $0xd,%eax
+    1252:	31 c2                	xor    %eax,%edx
+    1254:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1258:	89 10                	mov    %edx,(%rax)
+    s ^= s >> 17;
+    125a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    125e:	8b 10                	mov    (%rax),%edx
+    1260:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1264:	8b 00                	mov    (%rax),%eax
+    1266:	c1 e8 11             	shr    $0x11,%eax
+    1269:	31 c2                	xor    %eax,%edx
+    126b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    126f:	89 10                	mov    %edx,(%rax)
+    s ^= s << 5;
+    1271:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1275:	8b 10                	mov    (%rax),%edx
+    1277:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    127b:	8b 00                	mov    (%rax),%eax
+    127d:	c1 e0 05             	shl    $0x5,%eax
+    1280:	31 c2                	xor    %eax,%edx
+    1282:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1286:	89 10                	mov    %edx,(%rax)
+    return s;
+    1288:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    128c:	8b 00                	mov    (%rax),%eax
+}
+    128e:	5d                   	pop    %rbp
+    128f:	c3                   	ret
+
+0000000000001290 <put_digits(unsigned long&, unsigned int&, unsigned long)>:
+    buf[i] = '\0';
+    return i;
+}
+
+static void put_digits(nel::Index &i, unsigned int &seed, nel::Length const n)
+{
+    1290:	       55                   	push   %rbp
+    1291:	       48 89 e5             	mov    %rsp,%rbp
+    1294:	       48 83 ec 28          	sub    $0x28,%rsp
+    1298:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    129c:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    12a0:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    buf[i++] = char('1' + next_rand(seed) % 9);
+    12a4:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    12a8:	       48 89 c7             	mov    %rax,%rdi
+    12ab:	       e8 8b ff ff ff       	call   123b <next_rand(unsigned int&)>
+    12b0:	       89 c1                	mov    %eax,%ecx
+    12b2:	       89 c8                	mov    %ecx,%eax
+    12b4:	       48 69 c0 39 8e e3 38 	imul   $0x38e38e39,%rax,%rax
+    12bb:	       48 c1 e8 20          	shr    $0x20,%rax
+    12bf:	       89 c2                	mov    %eax,%edx
+    12c1:	       d1 ea                	shr    %edx
+    12c3:	       89 d0                	mov    %edx,%eax
+    12c5:	       c1 e0 03             	shl    $0x3,%eax
+    12c8:	       01 d0                	add    %edx,%eax
+    12ca:	       29 c1                	sub    %eax,%ecx
+    12cc:	       89 ca                	mov    %ecx,%edx
+    12ce:	       89 d0                	mov    %edx,%eax
+    12d0:	       83 c0 31             	add    $0x31,%eax
+    12d3:	       89 c6                	mov    %eax,%esi
+    12d5:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12d9:	       48 8b 00             	mov    (%rax),%rax
+    12dc:	       48 8d 48 01          	lea    0x1(%rax),%rcx
+    12e0:	       48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    12e4:	       48 89 0a             	mov    %rcx,(%rdx)
+    12e7:	       48 8d 15 92 8d 00 00 	lea    0x8d92(%rip),%rdx        # a080 <buf>
+    12ee:	       40 88 34 10          	mov    %sil,(%rax,%rdx,1)
+    for (nel::Index k = 1; k < n; ++k) {
+    12f2:	       48 c7 45 f8 01 00 00 	movq   $0x1,-0x8(%rbp)
+    12f9:	       00 
+    12fa:	   /-- eb 58                	jmp    1354 <put_digits(unsigned long&, unsigned int&, unsigned long)+0xc4>
+        buf[i++] = char('0' + next_rand(seed) % 10);
+    12fc:	/--|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1300:	|  |   48 89 c7             	mov    %rax,%rdi
+    1303:	|  |   e8 33 ff ff ff       	call   123b <next_rand(unsigned int&)>
+    1308:	|  |   89 c1                	mov    %eax,%ecx
+    130a:	|  |   89 ca                	mov    %ecx,%edx
+    130c:	|  |   b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    1311:	|  |   48 0f af c2          	imul   %rdx,%rax
+    1315:	|  |   48 c1 e8 20          	shr    $0x20,%rax
+    1319:	|  |   89 c2                	mov    %eax,%edx
+    131b:	|  |   c1 ea 03             	shr    $0x3,%edx
+    131e:	|  |   89 d0                	mov    %edx,%eax
+    1320:	|  |   c1 e0 02             	shl    $0x2,%eax
+    1323:	|  |   01 d0                	add    %edx,%eax
+    1325:	|  |   01 c0                	add    %eax,%eax
+    1327:	|  |   29 c1                	sub    %eax,%ecx
+    1329:	|  |   89 ca                	mov    %ecx,%edx
+    132b:	|  |   89 d0                	mov    %edx,%eax
+    132d:	|  |   83 c0 30             	add    $0x30,%eax
+    1330:	|  |   89 c6                	mov    %eax,%esi
+    1332:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1336:	|  |   48 8b 00             	mov    (%rax),%rax
+    1339:	|  |   48 8d 48 01          	lea    0x1(%rax),%rcx
+    133d:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1341:	|  |   48 89 0a             	mov    %rcx,(%rdx)
+    1344:	|  |   48 8d 15 35 8d 00 00 	lea    0x8d35(%rip),%rdx        # a080 <buf>
+    134b:	|  |   40 88 34 10          	mov    %sil,(%rax,%rdx,1)
+    for (nel::Index k = 1; k < n; ++k) {
+    134f:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1354:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1358:	|      48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    135c:	\----- 72 9e                	jb     12fc <put_digits(unsigned long&, unsigned int&, unsigned long)+0x6c>
+    }
+}
+    135e:	       90                   	nop
+    135f:	       90                   	nop
+    1360:	       c9                   	leave
+    1361:	       c3                   	ret
+
+0000000000001362 <fill_ints()::{lambda(unsigned long&, unsigned int&)#1}::operator()(unsigned long&, unsigned int&) const>:
+
+static nel::Length fill_ints(void)
+{
+    return fill([](nel::Index &i, unsigned int &seed) {
+    1362:	       55                   	push   %rbp
+    1363:	       48 89 e5             	mov    %rsp,%rbp
+    1366:	       48 83 ec 28          	sub    $0x28,%rsp
+    136a:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    136e:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1372:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+        // mostly short, as counters and ids are.
+        nel::Length const n = (next_rand(seed) % 4 == 0) ? 1 + next_rand(seed) % 19
+    1376:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    137a:	       48 89 c7             	mov    %rax,%rdi
+    137d:	       e8 b9 fe ff ff       	call   123b <next_rand(unsigned int&)>
+    1382:	       83 e0 03             	and    $0x3,%eax
+    1385:	       85 c0                	test   %eax,%eax
+    1387:	/----- 75 40                	jne    13c9 <fill_ints()::{lambda(unsigned long&, unsigned int&)#1}::operator()(unsigned long&, unsigned int&) const+0x67>
+    1389:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    138d:	|      48 89 c7             	mov    %rax,%rdi
+    1390:	|      e8 a6 fe ff ff       	call   123b <next_rand(unsigned int&)>
+    1395:	|      89 c1                	mov    %eax,%ecx
+    1397:	|      89 ca                	mov    %ecx,%edx
+    1399:	|      b8 cb 6b 28 af       	mov    $0xaf286bcb,%eax
+    139e:	|      48 0f af c2          	imul   %rdx,%rax
+    13a2:	|      48 c1 e8 20          	shr    $0x20,%rax
+    13a6:	|      89 ca                	mov    %ecx,%edx
+    13a8:	|      29 c2                	sub    %eax,%edx
+    13aa:	|      d1 ea                	shr    %edx
+    13ac:	|      01 d0                	add    %edx,%eax
+    13ae:	|      c1 e8 04             	shr    $0x4,%eax
+    13b1:	|      89 c2                	mov    %eax,%edx
+    13b3:	|      89 d0                	mov    %edx,%eax
+    13b5:	|      c1 e0 03             	shl    $0x3,%eax
+    13b8:	|      01 d0                	add    %edx,%eax
+    13ba:	|      01 c0                	add    %eax,%eax
+    13bc:	|      01 d0                	add    %edx,%eax
+    13be:	|      29 c1                	sub    %eax,%ecx
+    13c0:	|      89 ca                	mov    %ecx,%edx
+    13c2:	|      8d 42 01             	lea    0x1(%rdx),%eax
+    13c5:	|      89 c0                	mov    %eax,%eax
+    13c7:	|  /-- eb 33                	jmp    13fc <fill_ints()::{lambda(unsigned long&, unsigned int&)#1}::operator()(unsigned long&, unsigned int&) const+0x9a>
+                                                         : 1 + next_rand(seed) % 6;
+    13c9:	\--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    13cd:	   |   48 89 c7             	mov    %rax,%rdi
+    13d0:	   |   e8 66 fe ff ff       	call   123b <next_rand(unsigned int&)>
+    13d5:	   |   89 c1                	mov    %eax,%ecx
+    13d7:	   |   89 ca                	mov    %ecx,%edx
+    13d9:	   |   b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    13de:	   |   48 0f af c2          	imul   %rdx,%rax
+    13e2:	   |   48 c1 e8 20          	shr    $0x20,%rax
+    13e6:	   |   89 c2                	mov    %eax,%edx
+    13e8:	   |   c1 ea 02             	shr    $0x2,%edx
+    13eb:	   |   89 d0                	mov    %edx,%eax
+    13ed:	   |   01 c0                	add    %eax,%eax
+    13ef:	   |   01 d0                	add    %edx,%eax
+    13f1:	   |   01 c0                	add    %eax,%eax
+    13f3:	   |   29 c1                	sub    %eax,%ecx
+    13f5:	   |   89 ca                	mov    %ecx,%edx
+    13f7:	   |   8d 42 01             	lea    0x1(%rdx),%eax
+        nel::Length const n = (next_rand(seed) % 4 == 0) ? 1 + next_rand(seed) % 19
+    13fa:	   |   89 c0                	mov    %eax,%eax
+                                                         : 1 + next_rand(seed) % 6;
+    13fc:	   \-> 48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        put_digits(i, seed, n);
+    1400:	       48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1404:	       48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+    1408:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    140c:	       48 89 ce             	mov    %rcx,%rsi
+    140f:	       48 89 c7             	mov    %rax,%rdi
+    1412:	       e8 79 fe ff ff       	call   1290 <put_digits(unsigned long&, unsigned int&, unsigned long)>
+    });
+    1417:	       90                   	nop
+    1418:	       c9                   	leave
+    1419:	       c3                   	ret
+
+000000000000141a <fill_ints()>:
+{
+    141a:	55                   	push   %rbp
+    141b:	48 89 e5             	mov    %rsp,%rbp
+    141e:	48 83 ec 10          	sub    $0x10,%rsp
+    return fill([](nel::Index &i, unsigned int &seed) {
+    1422:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+    1426:	48 89 c7             	mov    %rax,%rdi
+    1429:	e8 89 04 00 00       	call   18b7 <unsigned long fill<fill_ints()::{lambda(unsigned long&, unsigned int&)#1}>(fill_ints()::{lambda(unsigned long&, unsigned int&)#1}&&)>
+}
+    142e:	c9                   	leave
+    142f:	c3                   	ret
+
+0000000000001430 <fill_floats()::{lambda(unsigned long&, unsigned int&)#1}::operator()(unsigned long&, unsigned int&) const>:
+
+static nel::Length fill_floats(void)
+{
+    return fill([](nel::Index &i, unsigned int &seed) {
+    1430:	    55                   	push   %rbp
+    1431:	    48 89 e5             	mov    %rsp,%rbp
+    1434:	    48 83 ec 18          	sub    $0x18,%rsp
+    1438:	    48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    143c:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1440:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        if (next_rand(seed) % 2 == 0) { buf[i++] = '-'; }
+    1444:	    48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1448:	    48 89 c7             	mov    %rax,%rdi
+    144b:	    e8 eb fd ff ff       	call   123b <next_rand(unsigned int&)>
+    1450:	    83 e0 01             	and    $0x1,%eax
+    1453:	    85 c0                	test   %eax,%eax
+    1455:	    0f 94 c0             	sete   %al
+    1458:	    84 c0                	test   %al,%al
+    145a:	/-- 74 1d                	je     1479 <fill_floats()::{lambda(unsigned long&, unsigned int&)#1}::operator()(unsigned long&, unsigned int&) const+0x49>
+    145c:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1460:	|   48 8b 00             	mov    (%rax),%rax
+    1463:	|   48 8d 48 01          	lea    0x1(%rax),%rcx
+    1467:	|   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    146b:	|   48 89 0a             	mov    %rcx,(%rdx)
+    146e:	|   48 8d 15 0b 8c 00 00 	lea    0x8c0b(%rip),%rdx        # a080 <buf>
+    1475:	|   c6 04 10 2d          	movb   $0x2d,(%rax,%rdx,1)
+        put_digits(i, seed, 1 + next_rand(seed) % 5);
+    1479:	\-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    147d:	    48 89 c7             	mov    %rax,%rdi
+    1480:	    e8 b6 fd ff ff       	call   123b <next_rand(unsigned int&)>
+    1485:	    89 c1                	mov    %eax,%ecx
+    1487:	    89 ca                	mov    %ecx,%edx
+    1489:	    b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    148e:	    48 0f af c2          	imul   %rdx,%rax
+    1492:	    48 c1 e8 20          	shr    $0x20,%rax
+    1496:	    89 c2                	mov    %eax,%edx
+    1498:	    c1 ea 02             	shr    $0x2,%edx
+    149b:	    89 d0                	mov    %edx,%eax
+    149d:	    c1 e0 02             	shl    $0x2,%eax
+    14a0:	    01 d0                	add    %edx,%eax
+    14a2:	    29 c1                	sub    %eax,%ecx
+    14a4:	    89 ca                	mov    %ecx,%edx
+    14a6:	    8d 42 01             	lea    0x1(%rdx),%eax
+    14a9:	    89 c2                	mov    %eax,%edx
+    14ab:	    48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    14af:	    48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14b3:	    48 89 ce             	mov    %rcx,%rsi
+    14b6:	    48 89 c7             	mov    %rax,%rdi
+    14b9:	    e8 d2 fd ff ff       	call   1290 <put_digits(unsigned long&, unsigned int&, unsigned long)>
+        buf[i++] = '.';
+    14be:	    48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14c2:	    48 8b 00             	mov    (%rax),%rax
+    14c5:	    48 8d 48 01          	lea    0x1(%rax),%rcx
+    14c9:	    48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    14cd:	    48 89 0a             	mov    %rcx,(%rdx)
+    14d0:	    48 8d 15 a9 8b 00 00 	lea    0x8ba9(%rip),%rdx        # a080 <buf>
+    14d7:	    c6 04 10 2e          	movb   $0x2e,(%rax,%rdx,1)
+        put_digits(i, seed, 1 + next_rand(seed) % 12);
+    14db:	    48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14df:	    48 89 c7             	mov    %rax,%rdi
+    14e2:	    e8 54 fd ff ff       	call   123b <next_rand(unsigned int&)>
+    14e7:	    89 c1                	mov    %eax,%ecx
+    14e9:	    89 ca                	mov    %ecx,%edx
+    14eb:	    b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    14f0:	    48 0f af c2          	imul   %rdx,%rax
+    14f4:	    48 c1 e8 20          	shr    $0x20,%rax
+    14f8:	    89 c2                	mov    %eax,%edx
+    14fa:	    c1 ea 03             	shr    $0x3,%edx
+    14fd:	    89 d0                	mov    %edx,%eax
+    14ff:	    01 c0                	add    %eax,%eax
+    1501:	    01 d0                	add    %edx,%eax
+    1503:	    c1 e0 02             	shl    $0x2,%eax
+    1506:	    29 c1                	sub    %eax,%ecx
+    1508:	    89 ca                	mov    %ecx,%edx
+    150a:	    8d 42 01             	lea    0x1(%rdx),%eax
+    150d:	    89 c2                	mov    %eax,%edx
+    150f:	    48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1513:	    48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1517:	    48 89 ce             	mov    %rcx,%rsi
+    151a:	    48 89 c7             	mov    %rax,%rdi
+    151d:	    e8 6e fd ff ff       	call   1290 <put_digits(unsigned long&, unsigned int&, unsigned long)>
+        if (next_rand(seed) % 4 == 0) {
+    1522:	    48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1526:	    48 89 c7             	mov    %rax,%rdi
+    1529:	    e8 0d fd ff ff       	call   123b <next_rand(unsigned int&)>
+    152e:	    83 e0 03             	and    $0x3,%eax
+    1531:	    85 c0                	test   %eax,%eax
+    1533:	    0f 94 c0             	sete   %al
+    1536:	    84 c0                	test   %al,%al
+    1538:	/-- 74 44                	je     157e <fill_floats()::{lambda(unsigned long&, unsigned int&)#1}::operator()(unsigned long&, unsigned int&) const+0x14e>
+            buf[i++] = 'e';
+    153a:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    153e:	|   48 8b 00             	mov    (%rax),%rax
+    1541:	|   48 8d 48 01          	lea    0x1(%rax),%rcx
+    1545:	|   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1549:	|   48 89 0a             	mov    %rcx,(%rdx)
+    154c:	|   48 8d 15 2d 8b 00 00 	lea    0x8b2d(%rip),%rdx        # a080 <buf>
+    1553:	|   c6 04 10 65          	movb   $0x65,(%rax,%rdx,1)
+            put_digits(i, seed, 1 + next_rand(seed) % 2);
+    1557:	|   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    155b:	|   48 89 c7             	mov    %rax,%rdi
+    155e:	|   e8 d8 fc ff ff       	call   123b <next_rand(unsigned int&)>
+    1563:	|   83 e0 01             	and    $0x1,%eax
+    1566:	|   83 c0 01             	add    $0x1,%eax
+    1569:	|   89 c2                	mov    %eax,%edx
+    156b:	|   48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    156f:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1573:	|   48 89 ce             	mov    %rcx,%rsi
+    1576:	|   48 89 c7             	mov    %rax,%rdi
+    1579:	|   e8 12 fd ff ff       	call   1290 <put_digits(unsigned long&, unsigned int&, unsigned long)>
+        }
+    });
+    157e:	\-> 90                   	nop
+    157f:	    c9                   	leave
+    1580:	    c3                   	ret
+
+0000000000001581 <fill_floats()>:
+{
+    1581:	55                   	push   %rbp
+    1582:	48 89 e5             	mov    %rsp,%rbp
+    1585:	48 83 ec 10          	sub    $0x10,%rsp
+    return fill([](nel::Index &i, unsigned int &seed) {
+    1589:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+    158d:	48 89 c7             	mov    %rax,%rdi
+    1590:	e8 92 03 00 00       	call   1927 <unsigned long fill<fill_floats()::{lambda(unsigned long&, unsigned int&)#1}>(fill_floats()::{lambda(unsigned long&, unsigned int&)#1}&&)>
+}
+    1595:	c9                   	leave
+    1596:	c3                   	ret
+
+0000000000001597 <bits(double)>:
+    bench::report(name, t, n_reps * n);
+    nel::log << "  sum: " << r << '\n';
+}
+
+static Sum bits(double const d)
+{
+    1597:	55                   	push   %rbp
+    1598:	48 89 e5             	mov    %rsp,%rbp
+    159b:	f2 0f 11 45 e8       	movsd  %xmm0,-0x18(%rbp)
+    long unsigned int b;
+    __builtin_memcpy(&b, &d, sizeof(b));
+    15a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15a4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return b;
+    15a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    15ac:	5d                   	pop    %rbp
+    15ad:	c3                   	ret
+
+00000000000015ae <field(char const*, unsigned long)>:
+
+static nel::Slice<unsigned char const> field(char const *const p, nel::Length const n)
+{
+    15ae:	55                   	push   %rbp
+    15af:	48 89 e5             	mov    %rsp,%rbp
+    15b2:	48 83 ec 20          	sub    $0x20,%rsp
+    15b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    15ba:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    15be:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return nel::Slice<unsigned char const>(reinterpret_cast<unsigned char const *>(p), n);
+    15c2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    15c6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    15ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15ce:	48 89 ce             	mov    %rcx,%rsi
+    15d1:	48 89 c7             	mov    %rax,%rdi
+    15d4:	e8 3f 0a 00 00       	call   2018 <nel::Slice<unsigned char const>::Slice(unsigned char const*, unsigned long)>
+}
+    15d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15dd:	c9                   	leave
+    15de:	c3                   	ret
+    15df:	90                   	nop
+
+00000000000015e0 <main::{lambda(char const*, unsigned long, unsigned long&)#1}::operator()(char const*, unsigned long, unsigned long&) const>:
+int main()
+{
+    {
+        nel::Length const n = fill_ints();
+        nel::log << n << " bytes of ints\n";
+        run("  strtoull   ", n, [](char const *p, nel::Length, Sum &r) -> nel::Length {
+    15e0:	55                   	push   %rbp
+    15e1:	48 89 e5             	mov    %rsp,%rbp
+    15e4:	48 83 ec 30          	sub    $0x30,%rsp
+    15e8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    15ec:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    15f0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    15f4:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            char *e;
+            r += std::strtoull(p, &e, 10);
+    15f8:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    15fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1600:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1605:	48 89 ce             	mov    %rcx,%rsi
+    1608:	48 89 c7             	mov    %rax,%rdi
+    160b:	e8 70 fa ff ff       	call   1080 <strtoull@plt>
+    1610:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1614:	48 8b 12             	mov    (%rdx),%rdx
+    1617:	48 01 c2             	add    %rax,%rdx
+    161a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    161e:	48 89 10             	mov    %rdx,(%rax)
+            return nel::Length(e - p);
+    1621:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1625:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+        });
+    1629:	c9                   	leave
+    162a:	c3                   	ret
+    162b:	90                   	nop
+
+000000000000162c <main::{lambda(char const*, unsigned long, unsigned long&)#2}::operator()(char const*, unsigned long, unsigned long&) const>:
+        run("  parse_u64  ", n, [](char const *p, nel::Length const n, Sum &r) {
+    162c:	55                   	push   %rbp
+    162d:	48 89 e5             	mov    %rsp,%rbp
+    1630:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    1634:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    1638:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    163c:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    1640:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+            auto const v = nel::parse_u64(field(p, n)).unwrap();
+    1644:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1648:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    164c:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    1650:	48 89 ce             	mov    %rcx,%rsi
+    1653:	48 89 c7             	mov    %rax,%rdi
+    1656:	e8 53 ff ff ff       	call   15ae <field(char const*, unsigned long)>
+    165b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    165f:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    1663:	48 89 d6             	mov    %rdx,%rsi
+    1666:	48 89 c7             	mov    %rax,%rdi
+    1669:	e8 0b 1d 00 00       	call   3379 <nel::parse_u64(nel::Slice<unsigned char const> const&)>
+    166e:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1672:	b9 75 00 00 00       	mov    $0x75,%ecx
+    1677:	48 8d 15 c2 39 00 00 	lea    0x39c2(%rip),%rdx        # 5040 <n_reps+0x8>
+    167e:	48 8d 35 d3 39 00 00 	lea    0x39d3(%rip),%rsi        # 5058 <n_reps+0x20>
+    1685:	48 89 c7             	mov    %rax,%rdi
+    1688:	e8 53 09 00 00       	call   1fe0 <nel::Context::Context(char const*, char const*, int)>
+    168d:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1691:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    1695:	48 89 d6             	mov    %rdx,%rsi
+    1698:	48 89 c7             	mov    %rax,%rdi
+    169b:	e8 56 0a 00 00       	call   20f6 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)>
+    16a0:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+    16a4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    16a8:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    16ac:	48 89 c7             	mov    %rax,%rdi
+    16af:	e8 8e 09 00 00       	call   2042 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::~Result()>
+            r += v.first;
+    16b4:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+    16b8:	48 8b 10             	mov    (%rax),%rdx
+    16bb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    16bf:	48 01 c2             	add    %rax,%rdx
+    16c2:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+    16c6:	48 89 10             	mov    %rdx,(%rax)
+            return v.second;
+    16c9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+        });
+    16cd:	c9                   	leave
+    16ce:	c3                   	ret
+    16cf:	90                   	nop
+
+00000000000016d0 <main::{lambda(char const*, unsigned long, unsigned long&)#3}::operator()(char const*, unsigned long, unsigned long&) const>:
+    }
+    {
+        nel::Length const n = fill_floats();
+        nel::log << n << " bytes of floats\n";
+        run("  strtod     ", n, [](char const *p, nel::Length, Sum &r) -> nel::Length {
+    16d0:	55                   	push   %rbp
+    16d1:	48 89 e5             	mov    %rsp,%rbp
+    16d4:	48 83 ec 30          	sub    $0x30,%rsp
+    16d8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    16dc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    16e0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    16e4:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            char *e;
+            r += bits(std::strtod(p, &e));
+    16e8:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    16ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    16f0:	48 89 d6             	mov    %rdx,%rsi
+    16f3:	48 89 c7             	mov    %rax,%rdi
+    16f6:	e8 45 f9 ff ff       	call   1040 <strtod@plt>
+    16fb:	66 48 0f 7e c0       	movq   %xmm0,%rax
+    1700:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    1705:	e8 8d fe ff ff       	call   1597 <bits(double)>
+    170a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    170e:	48 8b 12             	mov    (%rdx),%rdx
+    1711:	48 01 c2             	add    %rax,%rdx
+    1714:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1718:	48 89 10             	mov    %rdx,(%rax)
+            return nel::Length(e - p);
+    171b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    171f:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+        });
+    1723:	c9                   	leave
+    1724:	c3                   	ret
+    1725:	90                   	nop
+
+0000000000001726 <main::{lambda(char const*, unsigned long, unsigned long&)#4}::operator()(char const*, unsigned long, unsigned long&) const>:
+        run("  parse_f64  ", n, [](char const *p, nel::Length const n, Sum &r) {
+    1726:	55                   	push   %rbp
+    1727:	48 89 e5             	mov    %rsp,%rbp
+    172a:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    172e:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    1732:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    1736:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    173a:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+            auto const v = nel::parse_f64(field(p, n)).unwrap();
+    173e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1742:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    1746:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    174a:	48 89 ce             	mov    %rcx,%rsi
+    174d:	48 89 c7             	mov    %rax,%rdi
+    1750:	e8 59 fe ff ff       	call   15ae <field(char const*, unsigned long)>
+    1755:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    1759:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    175d:	48 89 d6             	mov    %rdx,%rsi
+    1760:	48 89 c7             	mov    %rax,%rdi
+    1763:	e8 c1 1e 00 00       	call   3629 <nel::parse_f64(nel::Slice<unsigned char const> const&)>
+    1768:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    176c:	b9 83 00 00 00       	mov    $0x83,%ecx
+    1771:	48 8d 15 c8 38 00 00 	lea    0x38c8(%rip),%rdx        # 5040 <n_reps+0x8>
+    1778:	48 8d 35 d9 38 00 00 	lea    0x38d9(%rip),%rsi        # 5058 <n_reps+0x20>
+    177f:	48 89 c7             	mov    %rax,%rdi
+    1782:	e8 59 08 00 00       	call   1fe0 <nel::Context::Context(char const*, char const*, int)>
+    1787:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    178b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    178f:	48 89 d6             	mov    %rdx,%rsi
+    1792:	48 89 c7             	mov    %rax,%rdi
+    1795:	e8 54 0a 00 00       	call   21ee <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)>
+    179a:	66 48 0f 7e c2       	movq   %xmm0,%rdx
+    179f:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+    17a3:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    17a7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    17ab:	48 89 c7             	mov    %rax,%rdi
+    17ae:	e8 75 09 00 00       	call   2128 <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::~Result()>
+            r += bits(v.first);
+    17b3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    17b7:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    17bc:	e8 d6 fd ff ff       	call   1597 <bits(double)>
+    17c1:	48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    17c5:	48 8b 12             	mov    (%rdx),%rdx
+    17c8:	48 01 c2             	add    %rax,%rdx
+    17cb:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+    17cf:	48 89 10             	mov    %rdx,(%rax)
+            return v.second;
+    17d2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+        });
+    17d6:	c9                   	leave
+    17d7:	c3                   	ret
+
+00000000000017d8 <main>:
+{
+    17d8:	55                   	push   %rbp
+    17d9:	48 89 e5             	mov    %rsp,%rbp
+    17dc:	48 83 ec 20          	sub    $0x20,%rsp
+        nel::Length const n = fill_ints();
+    17e0:	e8 35 fc ff ff       	call   141a <fill_ints()>
+    17e5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        nel::log << n << " bytes of ints\n";
+    17e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17ed:	48 89 c6             	mov    %rax,%rsi
+    17f0:	48 8d 05 8a 88 10 00 	lea    0x10888a(%rip),%rax        # 10a081 <nel::log>
+    17f7:	48 89 c7             	mov    %rax,%rdi
+    17fa:	e8 13 0f 00 00       	call   2712 <nel::operator<<(nel::Log&, unsigned long)>
+    17ff:	48 89 c2             	mov    %rax,%rdx
+    1802:	48 8d 05 5a 38 00 00 	lea    0x385a(%rip),%rax        # 5063 <n_reps+0x2b>
+    1809:	48 89 c6             	mov    %rax,%rsi
+    180c:	48 89 d7             	mov    %rdx,%rdi
+    180f:	e8 f3 0d 00 00       	call   2607 <nel::operator<<(nel::Log&, char const*)>
+        run("  strtoull   ", n, [](char const *p, nel::Length, Sum &r) -> nel::Length {
+    1814:	48 8d 55 ec          	lea    -0x14(%rbp),%rdx
+    1818:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    181c:	48 89 c6             	mov    %rax,%rsi
+    181f:	48 8d 05 4d 38 00 00 	lea    0x384d(%rip),%rax        # 5073 <n_reps+0x3b>
+    1826:	48 89 c7             	mov    %rax,%rdi
+    1829:	e8 e1 01 00 00       	call   1a0f <void run<main::{lambda(char const*, unsigned long, unsigned long&)#1}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#1}&&)>
+        run("  parse_u64  ", n, [](char const *p, nel::Length const n, Sum &r) {
+    182e:	48 8d 55 ed          	lea    -0x13(%rbp),%rdx
+    1832:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1836:	48 89 c6             	mov    %rax,%rsi
+    1839:	48 8d 05 41 38 00 00 	lea    0x3841(%rip),%rax        # 5081 <n_reps+0x49>
+    1840:	48 89 c7             	mov    %rax,%rdi
+    1843:	e8 e5 02 00 00       	call   1b2d <void run<main::{lambda(char const*, unsigned long, unsigned long&)#2}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#2}&&)>
+        nel::Length const n = fill_floats();
+    1848:	e8 34 fd ff ff       	call   1581 <fill_floats()>
+    184d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        nel::log << n << " bytes of floats\n";
+    1851:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1855:	48 89 c6             	mov    %rax,%rsi
+    1858:	48 8d 05 22 88 10 00 	lea    0x108822(%rip),%rax        # 10a081 <nel::log>
+    185f:	48 89 c7             	mov    %rax,%rdi
+    1862:	e8 ab 0e 00 00       	call   2712 <nel::operator<<(nel::Log&, unsigned long)>
+    1867:	48 89 c2             	mov    %rax,%rdx
+    186a:	48 8d 05 1e 38 00 00 	lea    0x381e(%rip),%rax        # 508f <n_reps+0x57>
+    1871:	48 89 c6             	mov    %rax,%rsi
+    1874:	48 89 d7             	mov    %rdx,%rdi
+    1877:	e8 8b 0d 00 00       	call   2607 <nel::operator<<(nel::Log&, char const*)>
+        run("  strtod     ", n, [](char const *p, nel::Length, Sum &r) -> nel::Length {
+    187c:	48 8d 55 ee          	lea    -0x12(%rbp),%rdx
+    1880:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1884:	48 89 c6             	mov    %rax,%rsi
+    1887:	48 8d 05 13 38 00 00 	lea    0x3813(%rip),%rax        # 50a1 <n_reps+0x69>
+    188e:	48 89 c7             	mov    %rax,%rdi
+    1891:	e8 b5 03 00 00       	call   1c4b <void run<main::{lambda(char const*, unsigned long, unsigned long&)#3}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#3}&&)>
+        run("  parse_f64  ", n, [](char const *p, nel::Length const n, Sum &r) {
+    1896:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+    189a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    189e:	48 89 c6             	mov    %rax,%rsi
+    18a1:	48 8d 05 07 38 00 00 	lea    0x3807(%rip),%rax        # 50af <n_reps+0x77>
+    18a8:	48 89 c7             	mov    %rax,%rdi
+    18ab:	e8 b9 04 00 00       	call   1d69 <void run<main::{lambda(char const*, unsigned long, unsigned long&)#4}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#4}&&)>
+    }
+}
+    18b0:	b8 00 00 00 00       	mov    $0x0,%eax
+    18b5:	c9                   	leave
+    18b6:	c3                   	ret
+
+00000000000018b7 <unsigned long fill<fill_ints()::{lambda(unsigned long&, unsigned int&)#1}>(fill_ints()::{lambda(unsigned long&, unsigned int&)#1}&&)>:
+static nel::Length fill(F &&put)
+    18b7:	       55                   	push   %rbp
+    18b8:	       48 89 e5             	mov    %rsp,%rbp
+    18bb:	       48 83 ec 18          	sub    $0x18,%rsp
+    18bf:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    unsigned int seed = 0x12345678;
+    18c3:	       c7 45 fc 78 56 34 12 	movl   $0x12345678,-0x4(%rbp)
+    nel::Index i = 0;
+    18ca:	       48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    18d1:	       00 
+    while (i + 64 < n_bytes) {
+    18d2:	   /-- eb 2e                	jmp    1902 <unsigned long fill<fill_ints()::{lambda(unsigned long&, unsigned int&)#1}>(fill_ints()::{lambda(unsigned long&, unsigned int&)#1}&&)+0x4b>
+        put(i, seed);
+    18d4:	/--|-> 48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    18d8:	|  |   48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+    18dc:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18e0:	|  |   48 89 ce             	mov    %rcx,%rsi
+    18e3:	|  |   48 89 c7             	mov    %rax,%rdi
+    18e6:	|  |   e8 77 fa ff ff       	call   1362 <fill_ints()::{lambda(unsigned long&, unsigned int&)#1}::operator()(unsigned long&, unsigned int&) const>
+        buf[i++] = '\n';
+    18eb:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18ef:	|  |   48 8d 50 01          	lea    0x1(%rax),%rdx
+    18f3:	|  |   48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    18f7:	|  |   48 8d 15 82 87 00 00 	lea    0x8782(%rip),%rdx        # a080 <buf>
+    18fe:	|  |   c6 04 10 0a          	movb   $0xa,(%rax,%rdx,1)
+    while (i + 64 < n_bytes) {
+    1902:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1906:	|      48 83 c0 40          	add    $0x40,%rax
+    190a:	|      48 3d ff ff 0f 00    	cmp    $0xfffff,%rax
+    1910:	\----- 76 c2                	jbe    18d4 <unsigned long fill<fill_ints()::{lambda(unsigned long&, unsigned int&)#1}>(fill_ints()::{lambda(unsigned long&, unsigned int&)#1}&&)+0x1d>
+    buf[i] = '\0';
+    1912:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1916:	       48 8d 15 63 87 00 00 	lea    0x8763(%rip),%rdx        # a080 <buf>
+    191d:	       c6 04 10 00          	movb   $0x0,(%rax,%rdx,1)
+    return i;
+    1921:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+    1925:	       c9                   	leave
+    1926:	       c3                   	ret
+
+0000000000001927 <unsigned long fill<fill_floats()::{lambda(unsigned long&, unsigned int&)#1}>(fill_floats()::{lambda(unsigned long&, unsigned int&)#1}&&)>:
+static nel::Length fill(F &&put)
+    1927:	       55                   	push   %rbp
+    1928:	       48 89 e5             	mov    %rsp,%rbp
+    192b:	       48 83 ec 18          	sub    $0x18,%rsp
+    192f:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    unsigned int seed = 0x12345678;
+    1933:	       c7 45 fc 78 56 34 12 	movl   $0x12345678,-0x4(%rbp)
+    nel::Index i = 0;
+    193a:	       48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1941:	       00 
+    while (i + 64 < n_bytes) {
+    1942:	   /-- eb 2e                	jmp    1972 <unsigned long fill<fill_floats()::{lambda(unsigned long&, unsigned int&)#1}>(fill_floats()::{lambda(unsigned long&, unsigned int&)#1}&&)+0x4b>
+        put(i, seed);
+    1944:	/--|-> 48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    1948:	|  |   48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+    194c:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1950:	|  |   48 89 ce             	mov    %rcx,%rsi
+    1953:	|  |   48 89 c7             	mov    %rax,%rdi
+    1956:	|  |   e8 d5 fa ff ff       	call   1430 <fill_floats()::{lambda(unsigned long&, unsigned int&)#1}::operator()(unsigned long&, unsigned int&) const>
+        buf[i++] = '\n';
+    195b:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    195f:	|  |   48 8d 50 01          	lea    0x1(%rax),%rdx
+    1963:	|  |   48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    1967:	|  |   48 8d 15 12 87 00 00 	lea    0x8712(%rip),%rdx        # a080 <buf>
+    196e:	|  |   c6 04 10 0a          	movb   $0xa,(%rax,%rdx,1)
+    while (i + 64 < n_bytes) {
+    1972:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1976:	|      48 83 c0 40          	add    $0x40,%rax
+    197a:	|      48 3d ff ff 0f 00    	cmp    $0xfffff,%rax
+    1980:	\----- 76 c2                	jbe    1944 <unsigned long fill<fill_floats()::{lambda(unsigned long&, unsigned int&)#1}>(fill_floats()::{lambda(unsigned long&, unsigned int&)#1}&&)+0x1d>
+    buf[i] = '\0';
+    1982:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1986:	       48 8d 15 f3 86 00 00 	lea    0x86f3(%rip),%rdx        # a080 <buf>
+    198d:	       c6 04 10 00          	movb   $0x0,(%rax,%rdx,1)
+    return i;
+    1991:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+    1995:	       c9                   	leave
+    1996:	       c3                   	ret
+    1997:	       90                   	nop
+
+0000000000001998 <run<main::{lambda(char const*, unsigned long, unsigned long&)#1}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#1}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    1998:	             55                   	push   %rbp
+    1999:	             48 89 e5             	mov    %rsp,%rbp
+    199c:	             48 83 ec 20          	sub    $0x20,%rsp
+    19a0:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    19a4:	             48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    19ab:	             00 
+    19ac:	   /-------- eb 56                	jmp    1a04 <run<main::{lambda(char const*, unsigned long, unsigned long&)#1}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#1}&&)::{lambda()#1}::operator()() const+0x6c>
+            nel::Index i = 0;
+    19ae:	/--|-------> 48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    19b5:	|  |         00 
+            while (i < n) {
+    19b6:	|  |     /-- eb 39                	jmp    19f1 <run<main::{lambda(char const*, unsigned long, unsigned long&)#1}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#1}&&)::{lambda()#1}::operator()() const+0x59>
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    19b8:	|  |  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19bc:	|  |  |  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    19c0:	|  |  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    19c4:	|  |  |  |   48 8b 0a             	mov    (%rdx),%rcx
+    19c7:	|  |  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    19cb:	|  |  |  |   48 8b 52 08          	mov    0x8(%rdx),%rdx
+                i += parse_one(buf + i, n - i, r) + 1;
+    19cf:	|  |  |  |   48 2b 55 f0          	sub    -0x10(%rbp),%rdx
+    19d3:	|  |  |  |   48 8d 3d a6 86 00 00 	lea    0x86a6(%rip),%rdi        # a080 <buf>
+    19da:	|  |  |  |   48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+    19de:	|  |  |  |   48 01 fe             	add    %rdi,%rsi
+    19e1:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    19e4:	|  |  |  |   e8 f7 fb ff ff       	call   15e0 <main::{lambda(char const*, unsigned long, unsigned long&)#1}::operator()(char const*, unsigned long, unsigned long&) const>
+    19e9:	|  |  |  |   48 83 c0 01          	add    $0x1,%rax
+    19ed:	|  |  |  |   48 01 45 f0          	add    %rax,-0x10(%rbp)
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    19f1:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19f5:	|  |  |      48 8b 40 08          	mov    0x8(%rax),%rax
+            while (i < n) {
+    19f9:	|  |  |      48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    19fd:	|  |  \----- 72 b9                	jb     19b8 <run<main::{lambda(char const*, unsigned long, unsigned long&)#1}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#1}&&)::{lambda()#1}::operator()() const+0x20>
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    19ff:	|  |         48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1a04:	|  \-------> 48 83 7d f8 09       	cmpq   $0x9,-0x8(%rbp)
+    1a09:	\----------- 76 a3                	jbe    19ae <run<main::{lambda(char const*, unsigned long, unsigned long&)#1}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#1}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    1a0b:	             90                   	nop
+    1a0c:	             90                   	nop
+    1a0d:	             c9                   	leave
+    1a0e:	             c3                   	ret
+
+0000000000001a0f <void run<main::{lambda(char const*, unsigned long, unsigned long&)#1}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#1}&&)>:
+static void run(char const *const name, nel::Length const n, F &&parse_one)
+    1a0f:	55                   	push   %rbp
+    1a10:	48 89 e5             	mov    %rsp,%rbp
+    1a13:	48 83 ec 50          	sub    $0x50,%rsp
+    1a17:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    1a1b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    1a1f:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    Sum r = 0;
+    1a23:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+    1a2a:	00 
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    1a2b:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+    1a2f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1a33:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1a37:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1a3b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    1a3f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1a43:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1a47:	48 89 c7             	mov    %rax,%rdi
+    1a4a:	e8 c0 03 00 00       	call   1e0f <unsigned long bench::time_ns<run<main::{lambda(char const*, unsigned long, unsigned long&)#1}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#1}&&)::{lambda()#1}>(main::{lambda(char const*, unsigned long, unsigned long&)#1}&&)>
+    1a4f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    bench::report(name, t, n_reps * n);
+    1a53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1a57:	48 89 d0             	mov    %rdx,%rax
+    1a5a:	48 c1 e0 02          	shl    $0x2,%rax
+    1a5e:	48 01 d0             	add    %rdx,%rax
+    1a61:	48 01 c0             	add    %rax,%rax
+    1a64:	48 89 c2             	mov    %rax,%rdx
+    1a67:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1a6b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1a6f:	48 89 ce             	mov    %rcx,%rsi
+    1a72:	48 89 c7             	mov    %rax,%rdi
+    1a75:	e8 72 04 00 00       	call   1eec <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << r << '\n';
+    1a7a:	48 8d 05 3c 36 00 00 	lea    0x363c(%rip),%rax        # 50bd <n_reps+0x85>
+    1a81:	48 89 c6             	mov    %rax,%rsi
+    1a84:	48 8d 05 f6 85 10 00 	lea    0x1085f6(%rip),%rax        # 10a081 <nel::log>
+    1a8b:	48 89 c7             	mov    %rax,%rdi
+    1a8e:	e8 74 0b 00 00       	call   2607 <nel::operator<<(nel::Log&, char const*)>
+    1a93:	48 89 c2             	mov    %rax,%rdx
+    1a96:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1a9a:	48 89 c6             	mov    %rax,%rsi
+    1a9d:	48 89 d7             	mov    %rdx,%rdi
+    1aa0:	e8 6d 0c 00 00       	call   2712 <nel::operator<<(nel::Log&, unsigned long)>
+    1aa5:	be 0a 00 00 00       	mov    $0xa,%esi
+    1aaa:	48 89 c7             	mov    %rax,%rdi
+    1aad:	e8 29 0b 00 00       	call   25db <nel::operator<<(nel::Log&, char)>
+}
+    1ab2:	90                   	nop
+    1ab3:	c9                   	leave
+    1ab4:	c3                   	ret
+    1ab5:	90                   	nop
+
+0000000000001ab6 <run<main::{lambda(char const*, unsigned long, unsigned long&)#2}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#2}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    1ab6:	             55                   	push   %rbp
+    1ab7:	             48 89 e5             	mov    %rsp,%rbp
+    1aba:	             48 83 ec 20          	sub    $0x20,%rsp
+    1abe:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    1ac2:	             48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1ac9:	             00 
+    1aca:	   /-------- eb 56                	jmp    1b22 <run<main::{lambda(char const*, unsigned long, unsigned long&)#2}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#2}&&)::{lambda()#1}::operator()() const+0x6c>
+            nel::Index i = 0;
+    1acc:	/--|-------> 48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1ad3:	|  |         00 
+            while (i < n) {
+    1ad4:	|  |     /-- eb 39                	jmp    1b0f <run<main::{lambda(char const*, unsigned long, unsigned long&)#2}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#2}&&)::{lambda()#1}::operator()() const+0x59>
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    1ad6:	|  |  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ada:	|  |  |  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    1ade:	|  |  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1ae2:	|  |  |  |   48 8b 0a             	mov    (%rdx),%rcx
+    1ae5:	|  |  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1ae9:	|  |  |  |   48 8b 52 08          	mov    0x8(%rdx),%rdx
+                i += parse_one(buf + i, n - i, r) + 1;
+    1aed:	|  |  |  |   48 2b 55 f0          	sub    -0x10(%rbp),%rdx
+    1af1:	|  |  |  |   48 8d 3d 88 85 00 00 	lea    0x8588(%rip),%rdi        # a080 <buf>
+    1af8:	|  |  |  |   48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+    1afc:	|  |  |  |   48 01 fe             	add    %rdi,%rsi
+    1aff:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1b02:	|  |  |  |   e8 25 fb ff ff       	call   162c <main::{lambda(char const*, unsigned long, unsigned long&)#2}::operator()(char const*, unsigned long, unsigned long&) const>
+    1b07:	|  |  |  |   48 83 c0 01          	add    $0x1,%rax
+    1b0b:	|  |  |  |   48 01 45 f0          	add    %rax,-0x10(%rbp)
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    1b0f:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b13:	|  |  |      48 8b 40 08          	mov    0x8(%rax),%rax
+            while (i < n) {
+    1b17:	|  |  |      48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1b1b:	|  |  \----- 72 b9                	jb     1ad6 <run<main::{lambda(char const*, unsigned long, unsigned long&)#2}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#2}&&)::{lambda()#1}::operator()() const+0x20>
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    1b1d:	|  |         48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1b22:	|  \-------> 48 83 7d f8 09       	cmpq   $0x9,-0x8(%rbp)
+    1b27:	\----------- 76 a3                	jbe    1acc <run<main::{lambda(char const*, unsigned long, unsigned long&)#2}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#2}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    1b29:	             90                   	nop
+    1b2a:	             90                   	nop
+    1b2b:	             c9                   	leave
+    1b2c:	             c3                   	ret
+
+0000000000001b2d <void run<main::{lambda(char const*, unsigned long, unsigned long&)#2}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#2}&&)>:
+static void run(char const *const name, nel::Length const n, F &&parse_one)
+    1b2d:	55                   	push   %rbp
+    1b2e:	48 89 e5             	mov    %rsp,%rbp
+    1b31:	48 83 ec 50          	sub    $0x50,%rsp
+    1b35:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    1b39:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    1b3d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    Sum r = 0;
+    1b41:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+    1b48:	00 
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    1b49:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+    1b4d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1b51:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1b55:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1b59:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    1b5d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1b61:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1b65:	48 89 c7             	mov    %rax,%rdi
+    1b68:	e8 ce 02 00 00       	call   1e3b <unsigned long bench::time_ns<run<main::{lambda(char const*, unsigned long, unsigned long&)#2}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#2}&&)::{lambda()#1}>(main::{lambda(char const*, unsigned long, unsigned long&)#2}&&)>
+    1b6d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    bench::report(name, t, n_reps * n);
+    1b71:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1b75:	48 89 d0             	mov    %rdx,%rax
+    1b78:	48 c1 e0 02          	shl    $0x2,%rax
+    1b7c:	48 01 d0             	add    %rdx,%rax
+    1b7f:	48 01 c0             	add    %rax,%rax
+    1b82:	48 89 c2             	mov    %rax,%rdx
+    1b85:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1b89:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1b8d:	48 89 ce             	mov    %rcx,%rsi
+    1b90:	48 89 c7             	mov    %rax,%rdi
+    1b93:	e8 54 03 00 00       	call   1eec <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << r << '\n';
+    1b98:	48 8d 05 1e 35 00 00 	lea    0x351e(%rip),%rax        # 50bd <n_reps+0x85>
+    1b9f:	48 89 c6             	mov    %rax,%rsi
+    1ba2:	48 8d 05 d8 84 10 00 	lea    0x1084d8(%rip),%rax        # 10a081 <nel::log>
+    1ba9:	48 89 c7             	mov    %rax,%rdi
+    1bac:	e8 56 0a 00 00       	call   2607 <nel::operator<<(nel::Log&, char const*)>
+    1bb1:	48 89 c2             	mov    %rax,%rdx
+    1bb4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1bb8:	48 89 c6             	mov    %rax,%rsi
+    1bbb:	48 89 d7             	mov    %rdx,%rdi
+    1bbe:	e8 4f 0b 00 00       	call   2712 <nel::operator<<(nel::Log&, unsigned long)>
+    1bc3:	be 0a 00 00 00       	mov    $0xa,%esi
+    1bc8:	48 89 c7             	mov    %rax,%rdi
+    1bcb:	e8 0b 0a 00 00       	call   25db <nel::operator<<(nel::Log&, char)>
+}
+    1bd0:	90                   	nop
+    1bd1:	c9                   	leave
+    1bd2:	c3                   	ret
+    1bd3:	90                   	nop
+
+0000000000001bd4 <run<main::{lambda(char const*, unsigned long, unsigned long&)#3}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#3}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    1bd4:	             55                   	push   %rbp
+    1bd5:	             48 89 e5             	mov    %rsp,%rbp
+    1bd8:	             48 83 ec 20          	sub    $0x20,%rsp
+    1bdc:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    1be0:	             48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1be7:	             00 
+    1be8:	   /-------- eb 56                	jmp    1c40 <run<main::{lambda(char const*, unsigned long, unsigned long&)#3}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#3}&&)::{lambda()#1}::operator()() const+0x6c>
+            nel::Index i = 0;
+    1bea:	/--|-------> 48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1bf1:	|  |         00 
+            while (i < n) {
+    1bf2:	|  |     /-- eb 39                	jmp    1c2d <run<main::{lambda(char const*, unsigned long, unsigned long&)#3}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#3}&&)::{lambda()#1}::operator()() const+0x59>
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    1bf4:	|  |  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bf8:	|  |  |  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    1bfc:	|  |  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1c00:	|  |  |  |   48 8b 0a             	mov    (%rdx),%rcx
+    1c03:	|  |  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1c07:	|  |  |  |   48 8b 52 08          	mov    0x8(%rdx),%rdx
+                i += parse_one(buf + i, n - i, r) + 1;
+    1c0b:	|  |  |  |   48 2b 55 f0          	sub    -0x10(%rbp),%rdx
+    1c0f:	|  |  |  |   48 8d 3d 6a 84 00 00 	lea    0x846a(%rip),%rdi        # a080 <buf>
+    1c16:	|  |  |  |   48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+    1c1a:	|  |  |  |   48 01 fe             	add    %rdi,%rsi
+    1c1d:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1c20:	|  |  |  |   e8 ab fa ff ff       	call   16d0 <main::{lambda(char const*, unsigned long, unsigned long&)#3}::operator()(char const*, unsigned long, unsigned long&) const>
+    1c25:	|  |  |  |   48 83 c0 01          	add    $0x1,%rax
+    1c29:	|  |  |  |   48 01 45 f0          	add    %rax,-0x10(%rbp)
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    1c2d:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c31:	|  |  |      48 8b 40 08          	mov    0x8(%rax),%rax
+            while (i < n) {
+    1c35:	|  |  |      48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1c39:	|  |  \----- 72 b9                	jb     1bf4 <run<main::{lambda(char const*, unsigned long, unsigned long&)#3}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#3}&&)::{lambda()#1}::operator()() const+0x20>
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    1c3b:	|  |         48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1c40:	|  \-------> 48 83 7d f8 09       	cmpq   $0x9,-0x8(%rbp)
+    1c45:	\----------- 76 a3                	jbe    1bea <run<main::{lambda(char const*, unsigned long, unsigned long&)#3}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#3}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    1c47:	             90                   	nop
+    1c48:	             90                   	nop
+    1c49:	             c9                   	leave
+    1c4a:	             c3                   	ret
+
+0000000000001c4b <void run<main::{lambda(char const*, unsigned long, unsigned long&)#3}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#3}&&)>:
+static void run(char const *const name, nel::Length const n, F &&parse_one)
+    1c4b:	55                   	push   %rbp
+    1c4c:	48 89 e5             	mov    %rsp,%rbp
+    1c4f:	48 83 ec 50          	sub    $0x50,%rsp
+    1c53:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    1c57:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    1c5b:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    Sum r = 0;
+    1c5f:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+    1c66:	00 
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    1c67:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+    1c6b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1c6f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1c73:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1c77:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    1c7b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1c7f:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1c83:	48 89 c7             	mov    %rax,%rdi
+    1c86:	e8 dc 01 00 00       	call   1e67 <unsigned long bench::time_ns<run<main::{lambda(char const*, unsigned long, unsigned long&)#3}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#3}&&)::{lambda()#1}>(main::{lambda(char const*, unsigned long, unsigned long&)#3}&&)>
+    1c8b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    bench::report(name, t, n_reps * n);
+    1c8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1c93:	48 89 d0             	mov    %rdx,%rax
+    1c96:	48 c1 e0 02          	shl    $0x2,%rax
+    1c9a:	48 01 d0             	add    %rdx,%rax
+    1c9d:	48 01 c0             	add    %rax,%rax
+    1ca0:	48 89 c2             	mov    %rax,%rdx
+    1ca3:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1ca7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1cab:	48 89 ce             	mov    %rcx,%rsi
+    1cae:	48 89 c7             	mov    %rax,%rdi
+    1cb1:	e8 36 02 00 00       	call   1eec <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << r << '\n';
+    1cb6:	48 8d 05 00 34 00 00 	lea    0x3400(%rip),%rax        # 50bd <n_reps+0x85>
+    1cbd:	48 89 c6             	mov    %rax,%rsi
+    1cc0:	48 8d 05 ba 83 10 00 	lea    0x1083ba(%rip),%rax        # 10a081 <nel::log>
+    1cc7:	48 89 c7             	mov    %rax,%rdi
+    1cca:	e8 38 09 00 00       	call   2607 <nel::operator<<(nel::Log&, char const*)>
+    1ccf:	48 89 c2             	mov    %rax,%rdx
+    1cd2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1cd6:	48 89 c6             	mov    %rax,%rsi
+    1cd9:	48 89 d7             	mov    %rdx,%rdi
+    1cdc:	e8 31 0a 00 00       	call   2712 <nel::operator<<(nel::Log&, unsigned long)>
+    1ce1:	be 0a 00 00 00       	mov    $0xa,%esi
+    1ce6:	48 89 c7             	mov    %rax,%rdi
+    1ce9:	e8 ed 08 00 00       	call   25db <nel::operator<<(nel::Log&, char)>
+}
+    1cee:	90                   	nop
+    1cef:	c9                   	leave
+    1cf0:	c3                   	ret
+    1cf1:	90                   	nop
+
+0000000000001cf2 <run<main::{lambda(char const*, unsigned long, unsigned long&)#4}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#4}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    1cf2:	             55                   	push   %rbp
+    1cf3:	             48 89 e5             	mov    %rsp,%rbp
+    1cf6:	             48 83 ec 20          	sub    $0x20,%rsp
+    1cfa:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    1cfe:	             48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1d05:	             00 
+    1d06:	   /-------- eb 56                	jmp    1d5e <run<main::{lambda(char const*, unsigned long, unsigned long&)#4}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#4}&&)::{lambda()#1}::operator()() const+0x6c>
+            nel::Index i = 0;
+    1d08:	/--|-------> 48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1d0f:	|  |         00 
+            while (i < n) {
+    1d10:	|  |     /-- eb 39                	jmp    1d4b <run<main::{lambda(char const*, unsigned long, unsigned long&)#4}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#4}&&)::{lambda()#1}::operator()() const+0x59>
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    1d12:	|  |  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d16:	|  |  |  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    1d1a:	|  |  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1d1e:	|  |  |  |   48 8b 0a             	mov    (%rdx),%rcx
+    1d21:	|  |  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1d25:	|  |  |  |   48 8b 52 08          	mov    0x8(%rdx),%rdx
+                i += parse_one(buf + i, n - i, r) + 1;
+    1d29:	|  |  |  |   48 2b 55 f0          	sub    -0x10(%rbp),%rdx
+    1d2d:	|  |  |  |   48 8d 3d 4c 83 00 00 	lea    0x834c(%rip),%rdi        # a080 <buf>
+    1d34:	|  |  |  |   48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+    1d38:	|  |  |  |   48 01 fe             	add    %rdi,%rsi
+    1d3b:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1d3e:	|  |  |  |   e8 e3 f9 ff ff       	call   1726 <main::{lambda(char const*, unsigned long, unsigned long&)#4}::operator()(char const*, unsigned long, unsigned long&) const>
+    1d43:	|  |  |  |   48 83 c0 01          	add    $0x1,%rax
+    1d47:	|  |  |  |   48 01 45 f0          	add    %rax,-0x10(%rbp)
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    1d4b:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d4f:	|  |  |      48 8b 40 08          	mov    0x8(%rax),%rax
+            while (i < n) {
+    1d53:	|  |  |      48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1d57:	|  |  \----- 72 b9                	jb     1d12 <run<main::{lambda(char const*, unsigned long, unsigned long&)#4}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#4}&&)::{lambda()#1}::operator()() const+0x20>
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    1d59:	|  |         48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1d5e:	|  \-------> 48 83 7d f8 09       	cmpq   $0x9,-0x8(%rbp)
+    1d63:	\----------- 76 a3                	jbe    1d08 <run<main::{lambda(char const*, unsigned long, unsigned long&)#4}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#4}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    1d65:	             90                   	nop
+    1d66:	             90                   	nop
+    1d67:	             c9                   	leave
+    1d68:	             c3                   	ret
+
+0000000000001d69 <void run<main::{lambda(char const*, unsigned long, unsigned long&)#4}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#4}&&)>:
+static void run(char const *const name, nel::Length const n, F &&parse_one)
+    1d69:	55                   	push   %rbp
+    1d6a:	48 89 e5             	mov    %rsp,%rbp
+    1d6d:	48 83 ec 50          	sub    $0x50,%rsp
+    1d71:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    1d75:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    1d79:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    Sum r = 0;
+    1d7d:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+    1d84:	00 
+    auto t = bench::time_ns([&r, n, &parse_one]() {
+    1d85:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+    1d89:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1d8d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1d91:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1d95:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    1d99:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1d9d:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1da1:	48 89 c7             	mov    %rax,%rdi
+    1da4:	e8 ea 00 00 00       	call   1e93 <unsigned long bench::time_ns<run<main::{lambda(char const*, unsigned long, unsigned long&)#4}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#4}&&)::{lambda()#1}>(main::{lambda(char const*, unsigned long, unsigned long&)#4}&&)>
+    1da9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    bench::report(name, t, n_reps * n);
+    1dad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1db1:	48 89 d0             	mov    %rdx,%rax
+    1db4:	48 c1 e0 02          	shl    $0x2,%rax
+    1db8:	48 01 d0             	add    %rdx,%rax
+    1dbb:	48 01 c0             	add    %rax,%rax
+    1dbe:	48 89 c2             	mov    %rax,%rdx
+    1dc1:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1dc5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1dc9:	48 89 ce             	mov    %rcx,%rsi
+    1dcc:	48 89 c7             	mov    %rax,%rdi
+    1dcf:	e8 18 01 00 00       	call   1eec <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << r << '\n';
+    1dd4:	48 8d 05 e2 32 00 00 	lea    0x32e2(%rip),%rax        # 50bd <n_reps+0x85>
+    1ddb:	48 89 c6             	mov    %rax,%rsi
+    1dde:	48 8d 05 9c 82 10 00 	lea    0x10829c(%rip),%rax        # 10a081 <nel::log>
+    1de5:	48 89 c7             	mov    %rax,%rdi
+    1de8:	e8 1a 08 00 00       	call   2607 <nel::operator<<(nel::Log&, char const*)>
+    1ded:	48 89 c2             	mov    %rax,%rdx
+    1df0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1df4:	48 89 c6             	mov    %rax,%rsi
+    1df7:	48 89 d7             	mov    %rdx,%rdi
+    1dfa:	e8 13 09 00 00       	call   2712 <nel::operator<<(nel::Log&, unsigned long)>
+    1dff:	be 0a 00 00 00       	mov    $0xa,%esi
+    1e04:	48 89 c7             	mov    %rax,%rdi
+    1e07:	e8 cf 07 00 00       	call   25db <nel::operator<<(nel::Log&, char)>
+}
+    1e0c:	90                   	nop
+    1e0d:	c9                   	leave
+    1e0e:	c3                   	ret
+
+0000000000001e0f <unsigned long bench::time_ns<run<main::{lambda(char const*, unsigned long, unsigned long&)#1}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#1}&&)::{lambda()#1}>(main::{lambda(char const*, unsigned long, unsigned long&)#1}&&)>:
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+}
+
+// Time a run of f(), in ns.
+template<typename F>
+long unsigned int time_ns(F &&f)
+    1e0f:	55                   	push   %rbp
+    1e10:	48 89 e5             	mov    %rsp,%rbp
+    1e13:	48 83 ec 20          	sub    $0x20,%rsp
+    1e17:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+{
+    long unsigned int const b = now_ns();
+    1e1b:	e8 9f 00 00 00       	call   1ebf <bench::now_ns()>
+    1e20:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    1e24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e28:	48 89 c7             	mov    %rax,%rdi
+    1e2b:	e8 68 fb ff ff       	call   1998 <run<main::{lambda(char const*, unsigned long, unsigned long&)#1}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#1}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    1e30:	e8 8a 00 00 00       	call   1ebf <bench::now_ns()>
+    1e35:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    1e39:	c9                   	leave
+    1e3a:	c3                   	ret
+
+0000000000001e3b <unsigned long bench::time_ns<run<main::{lambda(char const*, unsigned long, unsigned long&)#2}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#2}&&)::{lambda()#1}>(main::{lambda(char const*, unsigned long, unsigned long&)#2}&&)>:
+long unsigned int time_ns(F &&f)
+    1e3b:	55                   	push   %rbp
+    1e3c:	48 89 e5             	mov    %rsp,%rbp
+    1e3f:	48 83 ec 20          	sub    $0x20,%rsp
+    1e43:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    1e47:	e8 73 00 00 00       	call   1ebf <bench::now_ns()>
+    1e4c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    1e50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e54:	48 89 c7             	mov    %rax,%rdi
+    1e57:	e8 5a fc ff ff       	call   1ab6 <run<main::{lambda(char const*, unsigned long, unsigned long&)#2}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#2}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    1e5c:	e8 5e 00 00 00       	call   1ebf <bench::now_ns()>
+    1e61:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    1e65:	c9                   	leave
+    1e66:	c3                   	ret
+
+0000000000001e67 <unsigned long bench::time_ns<run<main::{lambda(char const*, unsigned long, unsigned long&)#3}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#3}&&)::{lambda()#1}>(main::{lambda(char const*, unsigned long, unsigned long&)#3}&&)>:
+long unsigned int time_ns(F &&f)
+    1e67:	55                   	push   %rbp
+    1e68:	48 89 e5             	mov    %rsp,%rbp
+    1e6b:	48 83 ec 20          	sub    $0x20,%rsp
+    1e6f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    1e73:	e8 47 00 00 00       	call   1ebf <bench::now_ns()>
+    1e78:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    1e7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e80:	48 89 c7             	mov    %rax,%rdi
+    1e83:	e8 4c fd ff ff       	call   1bd4 <run<main::{lambda(char const*, unsigned long, unsigned long&)#3}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#3}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    1e88:	e8 32 00 00 00       	call   1ebf <bench::now_ns()>
+    1e8d:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    1e91:	c9                   	leave
+    1e92:	c3                   	ret
+
+0000000000001e93 <unsigned long bench::time_ns<run<main::{lambda(char const*, unsigned long, unsigned long&)#4}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#4}&&)::{lambda()#1}>(main::{lambda(char const*, unsigned long, unsigned long&)#4}&&)>:
+long unsigned int time_ns(F &&f)
+    1e93:	55                   	push   %rbp
+    1e94:	48 89 e5             	mov    %rsp,%rbp
+    1e97:	48 83 ec 20          	sub    $0x20,%rsp
+    1e9b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    1e9f:	e8 1b 00 00 00       	call   1ebf <bench::now_ns()>
+    1ea4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    1ea8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1eac:	48 89 c7             	mov    %rax,%rdi
+    1eaf:	e8 3e fe ff ff       	call   1cf2 <run<main::{lambda(char const*, unsigned long, unsigned long&)#4}>(char const*, unsigned long, main::{lambda(char const*, unsigned long, unsigned long&)#4}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    1eb4:	e8 06 00 00 00       	call   1ebf <bench::now_ns()>
+    1eb9:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    1ebd:	c9                   	leave
+    1ebe:	c3                   	ret
+
+0000000000001ebf <bench::now_ns()>:
+static constexpr nel::Count n_reps = 10;
+    1ebf:	55                   	push   %rbp
+    1ec0:	48 89 e5             	mov    %rsp,%rbp
+    1ec3:	48 83 ec 10          	sub    $0x10,%rsp
+typedef long unsigned int Sum;
+    1ec7:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1ecb:	48 89 c6             	mov    %rax,%rsi
+    1ece:	bf 01 00 00 00       	mov    $0x1,%edi
+    1ed3:	e8 78 f1 ff ff       	call   1050 <clock_gettime@plt>
+
+    1ed8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1edc:	48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+    1ee3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1ee7:	48 01 d0             	add    %rdx,%rax
+// 0 terminated, for strtod.
+    1eea:	c9                   	leave
+    1eeb:	c3                   	ret
+
+0000000000001eec <bench::report(char const*, unsigned long, unsigned long)>:
+{
+    1eec:	    55                   	push   %rbp
+    1eed:	    48 89 e5             	mov    %rsp,%rbp
+    1ef0:	    48 83 ec 20          	sub    $0x20,%rsp
+    1ef4:	    48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1ef8:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1efc:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    unsigned int seed = 0x12345678;
+    1f00:	    48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f04:	    48 89 c6             	mov    %rax,%rsi
+    1f07:	    48 8d 05 73 81 10 00 	lea    0x108173(%rip),%rax        # 10a081 <nel::log>
+    1f0e:	    48 89 c7             	mov    %rax,%rdi
+    1f11:	    e8 f1 06 00 00       	call   2607 <nel::operator<<(nel::Log&, char const*)>
+    1f16:	    48 89 c2             	mov    %rax,%rdx
+    1f19:	    48 8d 05 e8 30 00 00 	lea    0x30e8(%rip),%rax        # 5008 <_IO_stdin_used+0x8>
+    1f20:	    48 89 c6             	mov    %rax,%rsi
+    1f23:	    48 89 d7             	mov    %rdx,%rdi
+    1f26:	    e8 dc 06 00 00       	call   2607 <nel::operator<<(nel::Log&, char const*)>
+    1f2b:	    48 89 c1             	mov    %rax,%rcx
+    1f2e:	    48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f32:	    48 c1 e8 03          	shr    $0x3,%rax
+    1f36:	    48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+    1f3d:	    9b c4 20 
+    1f40:	    48 f7 e2             	mul    %rdx
+    1f43:	    48 89 d0             	mov    %rdx,%rax
+    1f46:	    48 c1 e8 04          	shr    $0x4,%rax
+    1f4a:	    48 89 c6             	mov    %rax,%rsi
+    1f4d:	    48 89 cf             	mov    %rcx,%rdi
+    1f50:	    e8 bd 07 00 00       	call   2712 <nel::operator<<(nel::Log&, unsigned long)>
+    1f55:	    48 89 c2             	mov    %rax,%rdx
+    1f58:	    48 8d 05 ac 30 00 00 	lea    0x30ac(%rip),%rax        # 500b <_IO_stdin_used+0xb>
+    1f5f:	    48 89 c6             	mov    %rax,%rsi
+    1f62:	    48 89 d7             	mov    %rdx,%rdi
+    1f65:	    e8 9d 06 00 00       	call   2607 <nel::operator<<(nel::Log&, char const*)>
+    nel::Index i = 0;
+    1f6a:	    48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1f6f:	/-- 74 57                	je     1fc8 <bench::report(char const*, unsigned long, unsigned long)+0xdc>
+    1f71:	|   48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1f76:	+-- 74 50                	je     1fc8 <bench::report(char const*, unsigned long, unsigned long)+0xdc>
+        put(i, seed);
+    1f78:	|   48 8d 05 8f 30 00 00 	lea    0x308f(%rip),%rax        # 500e <_IO_stdin_used+0xe>
+    1f7f:	|   48 89 c6             	mov    %rax,%rsi
+    1f82:	|   48 8d 05 f8 80 10 00 	lea    0x1080f8(%rip),%rax        # 10a081 <nel::log>
+    1f89:	|   48 89 c7             	mov    %rax,%rdi
+    1f8c:	|   e8 76 06 00 00       	call   2607 <nel::operator<<(nel::Log&, char const*)>
+    1f91:	|   48 89 c1             	mov    %rax,%rcx
+    1f94:	|   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f98:	|   48 69 c0 e8 03 00 00 	imul   $0x3e8,%rax,%rax
+    1f9f:	|   ba 00 00 00 00       	mov    $0x0,%edx
+    1fa4:	|   48 f7 75 f0          	divq   -0x10(%rbp)
+    1fa8:	|   48 89 c6             	mov    %rax,%rsi
+    1fab:	|   48 89 cf             	mov    %rcx,%rdi
+    1fae:	|   e8 5f 07 00 00       	call   2712 <nel::operator<<(nel::Log&, unsigned long)>
+    1fb3:	|   48 89 c2             	mov    %rax,%rdx
+    1fb6:	|   48 8d 05 54 30 00 00 	lea    0x3054(%rip),%rax        # 5011 <_IO_stdin_used+0x11>
+    1fbd:	|   48 89 c6             	mov    %rax,%rsi
+    1fc0:	|   48 89 d7             	mov    %rdx,%rdi
+    1fc3:	|   e8 3f 06 00 00       	call   2607 <nel::operator<<(nel::Log&, char const*)>
+    }
+    1fc8:	\-> be 0a 00 00 00       	mov    $0xa,%esi
+    1fcd:	    48 8d 05 ad 80 10 00 	lea    0x1080ad(%rip),%rax        # 10a081 <nel::log>
+    1fd4:	    48 89 c7             	mov    %rax,%rdi
+    1fd7:	    e8 ff 05 00 00       	call   25db <nel::operator<<(nel::Log&, char)>
+    buf[i] = '\0';
+    1fdc:	    90                   	nop
+    1fdd:	    c9                   	leave
+    1fde:	    c3                   	ret
+    1fdf:	    90                   	nop
+
+0000000000001fe0 <nel::Context::Context(char const*, char const*, int)>:
+        char const *fn_name_;
+        char const *file_name_;
+        int line_num_;
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+    1fe0:	55                   	push   %rbp
+    1fe1:	48 89 e5             	mov    %rsp,%rbp
+    1fe4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1fe8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1fec:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1ff0:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1ff3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ff7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1ffb:	48 89 10             	mov    %rdx,(%rax)
+            , file_name_(file_name)
+    1ffe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2002:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2006:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , line_num_(line_num)
+    200a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    200e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    2011:	89 50 10             	mov    %edx,0x10(%rax)
+        {
+        }
+    2014:	90                   	nop
+    2015:	5d                   	pop    %rbp
+    2016:	c3                   	ret
+    2017:	90                   	nop
+
+0000000000002018 <nel::Slice<unsigned char const>::Slice(unsigned char const*, unsigned long)>:
+    public:
+        // annoyingly, the type deducing form only works on ctors, not statics
+        // so Slice( int ptr, len) gets a Slice<int>(int ptr, len)
+        // but a Slice::from(int ptr, len) does not work..
+        // constexpr Slice(Type p[], Length len)
+        constexpr Slice(Type *const p, Length len)
+    2018:	55                   	push   %rbp
+    2019:	48 89 e5             	mov    %rsp,%rbp
+    201c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2020:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2024:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : content_(p)
+    2028:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    202c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2030:	48 89 10             	mov    %rdx,(%rax)
+            , len_(len)
+    2033:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2037:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    203b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        {
+        }
+    203f:	90                   	nop
+    2040:	5d                   	pop    %rbp
+    2041:	c3                   	ret
+
+0000000000002042 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::~Result()>:
+                Element<T> ok_;
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    2042:	             55                   	push   %rbp
+    2043:	             48 89 e5             	mov    %rsp,%rbp
+    2046:	             48 83 ec 30          	sub    $0x30,%rsp
+    204a:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result::dtor
+    204e:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2052:	             8b 00                	mov    (%rax),%eax
+    2054:	             83 f8 02             	cmp    $0x2,%eax
+    2057:	/----------- 74 43                	je     209c <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::~Result()+0x5a>
+    2059:	|            83 f8 02             	cmp    $0x2,%eax
+    205c:	|        /-- 7f 09                	jg     2067 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::~Result()+0x25>
+    205e:	|        |   85 c0                	test   %eax,%eax
+    2060:	|  /-----|-- 74 3d                	je     209f <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::~Result()+0x5d>
+    2062:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    2065:	|  |  /--|-- 74 3b                	je     20a2 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::~Result()+0x60>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    2067:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    206b:	|  |  |      b9 72 00 00 00       	mov    $0x72,%ecx
+    2070:	|  |  |      48 8d 15 4e 30 00 00 	lea    0x304e(%rip),%rdx        # 50c5 <n_reps+0x8d>
+    2077:	|  |  |      48 8d 35 59 30 00 00 	lea    0x3059(%rip),%rsi        # 50d7 <n_reps+0x9f>
+    207e:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2081:	|  |  |      e8 5a ff ff ff       	call   1fe0 <nel::Context::Context(char const*, char const*, int)>
+    2086:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    208a:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    208d:	|  |  |      48 8d 05 4b 30 00 00 	lea    0x304b(%rip),%rax        # 50df <n_reps+0xa7>
+    2094:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2097:	|  |  |      e8 89 04 00 00       	call   2525 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    209c:	\--|--|----> 90                   	nop
+    209d:	   |  |  /-- eb 04                	jmp    20a3 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::~Result()+0x61>
+                    break;
+    209f:	   \--|--|-> 90                   	nop
+    20a0:	      |  +-- eb 01                	jmp    20a3 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::~Result()+0x61>
+                    break;
+    20a2:	      \--|-> 90                   	nop
+                    break;
+            }
+        }
+    20a3:	         \-> 90                   	nop
+    20a4:	             c9                   	leave
+    20a5:	             c3                   	ret
+
+00000000000020a6 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}::operator()(nel::Pair<unsigned long long, unsigned long>&&) const>:
+         *
+         * `this` is consumed by the operation.
+         */
+        constexpr T unwrap(Context const &ctx = Context())
+        {
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    20a6:	55                   	push   %rbp
+    20a7:	48 89 e5             	mov    %rsp,%rbp
+    20aa:	48 83 ec 10          	sub    $0x10,%rsp
+    20ae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    20b2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    20b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20ba:	48 89 c7             	mov    %rax,%rdi
+    20bd:	e8 89 01 00 00       	call   224b <nel::Pair<unsigned long long, unsigned long>&& nel::forward<nel::Pair<unsigned long long, unsigned long>, nel::Pair<unsigned long long, unsigned long> >(nel::Pair<unsigned long long, unsigned long>&)>
+    20c2:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    20c6:	48 8b 00             	mov    (%rax),%rax
+    20c9:	c9                   	leave
+    20ca:	c3                   	ret
+    20cb:	90                   	nop
+
+00000000000020cc <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}::operator()(nel::ParseError&&) const>:
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    20cc:	55                   	push   %rbp
+    20cd:	48 89 e5             	mov    %rsp,%rbp
+    20d0:	48 83 ec 10          	sub    $0x10,%rsp
+    20d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    20d8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    20dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20e0:	48 8b 00             	mov    (%rax),%rax
+    20e3:	48 89 c6             	mov    %rax,%rsi
+    20e6:	48 8d 05 fd 2f 00 00 	lea    0x2ffd(%rip),%rax        # 50ea <n_reps+0xb2>
+    20ed:	48 89 c7             	mov    %rax,%rdi
+    20f0:	e8 30 04 00 00       	call   2525 <nel::panic(char const*, nel::Context const&)>
+    20f5:	90                   	nop
+
+00000000000020f6 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)>:
+        constexpr T unwrap(Context const &ctx = Context())
+    20f6:	55                   	push   %rbp
+    20f7:	48 89 e5             	mov    %rsp,%rbp
+    20fa:	48 83 ec 20          	sub    $0x20,%rsp
+    20fe:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2102:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    2106:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    210a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    210e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2112:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    2116:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    211a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    211e:	48 89 c7             	mov    %rax,%rdi
+    2121:	e8 34 01 00 00       	call   225a <nel::Pair<unsigned long long, unsigned long> nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::consume<nel::Pair<unsigned long long, unsigned long>, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)>
+                              ctx);
+        }
+    2126:	c9                   	leave
+    2127:	c3                   	ret
+
+0000000000002128 <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::~Result()>:
+        constexpr ~Result(void)
+    2128:	             55                   	push   %rbp
+    2129:	             48 89 e5             	mov    %rsp,%rbp
+    212c:	             48 83 ec 30          	sub    $0x30,%rsp
+    2130:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+            switch (tag_) { // result::dtor
+    2134:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2138:	             8b 00                	mov    (%rax),%eax
+    213a:	             83 f8 02             	cmp    $0x2,%eax
+    213d:	/----------- 74 43                	je     2182 <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::~Result()+0x5a>
+    213f:	|            83 f8 02             	cmp    $0x2,%eax
+    2142:	|        /-- 7f 09                	jg     214d <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::~Result()+0x25>
+    2144:	|        |   85 c0                	test   %eax,%eax
+    2146:	|  /-----|-- 74 3d                	je     2185 <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::~Result()+0x5d>
+    2148:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    214b:	|  |  /--|-- 74 3b                	je     2188 <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::~Result()+0x60>
+                    nel::panic("bad Result");
+    214d:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2151:	|  |  |      b9 72 00 00 00       	mov    $0x72,%ecx
+    2156:	|  |  |      48 8d 15 68 2f 00 00 	lea    0x2f68(%rip),%rdx        # 50c5 <n_reps+0x8d>
+    215d:	|  |  |      48 8d 35 73 2f 00 00 	lea    0x2f73(%rip),%rsi        # 50d7 <n_reps+0x9f>
+    2164:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2167:	|  |  |      e8 74 fe ff ff       	call   1fe0 <nel::Context::Context(char const*, char const*, int)>
+    216c:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2170:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    2173:	|  |  |      48 8d 05 65 2f 00 00 	lea    0x2f65(%rip),%rax        # 50df <n_reps+0xa7>
+    217a:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    217d:	|  |  |      e8 a3 03 00 00       	call   2525 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    2182:	\--|--|----> 90                   	nop
+    2183:	   |  |  /-- eb 04                	jmp    2189 <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::~Result()+0x61>
+                    break;
+    2185:	   \--|--|-> 90                   	nop
+    2186:	      |  +-- eb 01                	jmp    2189 <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::~Result()+0x61>
+                    break;
+    2188:	      \--|-> 90                   	nop
+        }
+    2189:	         \-> 90                   	nop
+    218a:	             c9                   	leave
+    218b:	             c3                   	ret
+
+000000000000218c <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<double, unsigned long>&&)#1}::operator()(nel::Pair<double, unsigned long>&&) const>:
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    218c:	55                   	push   %rbp
+    218d:	48 89 e5             	mov    %rsp,%rbp
+    2190:	53                   	push   %rbx
+    2191:	48 83 ec 18          	sub    $0x18,%rsp
+    2195:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2199:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    219d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    21a1:	48 89 c7             	mov    %rax,%rdi
+    21a4:	e8 7a 01 00 00       	call   2323 <nel::Pair<double, unsigned long>&& nel::forward<nel::Pair<double, unsigned long>, nel::Pair<double, unsigned long> >(nel::Pair<double, unsigned long>&)>
+    21a9:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    21ad:	48 8b 00             	mov    (%rax),%rax
+    21b0:	48 89 c1             	mov    %rax,%rcx
+    21b3:	48 89 d3             	mov    %rdx,%rbx
+    21b6:	48 89 d0             	mov    %rdx,%rax
+    21b9:	66 48 0f 6e c1       	movq   %rcx,%xmm0
+    21be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    21c2:	c9                   	leave
+    21c3:	c3                   	ret
+
+00000000000021c4 <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}::operator()(nel::ParseError&&) const>:
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    21c4:	55                   	push   %rbp
+    21c5:	48 89 e5             	mov    %rsp,%rbp
+    21c8:	48 83 ec 10          	sub    $0x10,%rsp
+    21cc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    21d0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    21d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21d8:	48 8b 00             	mov    (%rax),%rax
+    21db:	48 89 c6             	mov    %rax,%rsi
+    21de:	48 8d 05 05 2f 00 00 	lea    0x2f05(%rip),%rax        # 50ea <n_reps+0xb2>
+    21e5:	48 89 c7             	mov    %rax,%rdi
+    21e8:	e8 38 03 00 00       	call   2525 <nel::panic(char const*, nel::Context const&)>
+    21ed:	90                   	nop
+
+00000000000021ee <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)>:
+        constexpr T unwrap(Context const &ctx = Context())
+    21ee:	55                   	push   %rbp
+    21ef:	48 89 e5             	mov    %rsp,%rbp
+    21f2:	53                   	push   %rbx
+    21f3:	48 83 ec 28          	sub    $0x28,%rsp
+    21f7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    21fb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    21ff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2203:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    2207:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    220b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    220f:	48 8d 75 ef          	lea    -0x11(%rbp),%rsi
+    2213:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2217:	48 89 c7             	mov    %rax,%rdi
+    221a:	e8 13 01 00 00       	call   2332 <nel::Pair<double, unsigned long> nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::consume<nel::Pair<double, unsigned long>, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<double, unsigned long>&&)#1}, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<double, unsigned long>&&)#1}&&, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)>
+    221f:	66 48 0f 7e c6       	movq   %xmm0,%rsi
+    2224:	48 89 c1             	mov    %rax,%rcx
+    2227:	b8 00 00 00 00       	mov    $0x0,%eax
+    222c:	ba 00 00 00 00       	mov    $0x0,%edx
+    2231:	48 89 f0             	mov    %rsi,%rax
+    2234:	48 89 ca             	mov    %rcx,%rdx
+                              ctx);
+    2237:	48 89 c1             	mov    %rax,%rcx
+    223a:	48 89 d3             	mov    %rdx,%rbx
+    223d:	48 89 d0             	mov    %rdx,%rax
+        }
+    2240:	66 48 0f 6e c1       	movq   %rcx,%xmm0
+    2245:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2249:	c9                   	leave
+    224a:	c3                   	ret
+
+000000000000224b <nel::Pair<unsigned long long, unsigned long>&& nel::forward<nel::Pair<unsigned long long, unsigned long>, nel::Pair<unsigned long long, unsigned long> >(nel::Pair<unsigned long long, unsigned long>&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel so to not need std.
+ */
+template<typename U, typename T>
+constexpr U &&forward(T &t)
+    224b:	55                   	push   %rbp
+    224c:	48 89 e5             	mov    %rsp,%rbp
+    224f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<U &&>(t);
+    2253:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2257:	5d                   	pop    %rbp
+    2258:	c3                   	ret
+    2259:	90                   	nop
+
+000000000000225a <nel::Pair<unsigned long long, unsigned long> nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::consume<nel::Pair<unsigned long long, unsigned long>, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    225a:	             55                   	push   %rbp
+    225b:	             48 89 e5             	mov    %rsp,%rbp
+    225e:	             48 83 ec 30          	sub    $0x30,%rsp
+    2262:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2266:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    226a:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    226e:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    2272:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2276:	             8b 00                	mov    (%rax),%eax
+    2278:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    227b:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    227f:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    2285:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    2289:	         /-- 74 3e                	je     22c9 <nel::Pair<unsigned long long, unsigned long> nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::consume<nel::Pair<unsigned long long, unsigned long>, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)+0x6f>
+    228b:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    228f:	/--------|-- 7f 7a                	jg     230b <nel::Pair<unsigned long long, unsigned long> nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::consume<nel::Pair<unsigned long long, unsigned long>, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)+0xb1>
+    2291:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2295:	|  /-----|-- 74 5e                	je     22f5 <nel::Pair<unsigned long long, unsigned long> nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::consume<nel::Pair<unsigned long long, unsigned long>, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)+0x9b>
+    2297:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    229b:	+--|-----|-- 75 6e                	jne    230b <nel::Pair<unsigned long long, unsigned long> nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::consume<nel::Pair<unsigned long long, unsigned long>, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)+0xb1>
+                    return on_ok(forward<T>(*ok_));
+    229d:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22a1:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    22a5:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    22a8:	|  |     |   e8 9d 01 00 00       	call   244a <nel::Element<nel::Pair<unsigned long long, unsigned long> >::operator*()>
+    22ad:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    22b0:	|  |     |   e8 96 ff ff ff       	call   224b <nel::Pair<unsigned long long, unsigned long>&& nel::forward<nel::Pair<unsigned long long, unsigned long>, nel::Pair<unsigned long long, unsigned long> >(nel::Pair<unsigned long long, unsigned long>&)>
+    22b5:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    22b8:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    22bc:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    22bf:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    22c2:	|  |     |   e8 df fd ff ff       	call   20a6 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}::operator()(nel::Pair<unsigned long long, unsigned long>&&) const>
+    22c7:	|  |  /--|-- eb 58                	jmp    2321 <nel::Pair<unsigned long long, unsigned long> nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::consume<nel::Pair<unsigned long long, unsigned long>, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)+0xc7>
+                    return on_err(forward<E>(*err_));
+    22c9:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22cd:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    22d1:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    22d4:	|  |  |      e8 8b 01 00 00       	call   2464 <nel::Element<nel::ParseError>::operator*()>
+    22d9:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    22dc:	|  |  |      e8 9d 01 00 00       	call   247e <nel::ParseError&& nel::forward<nel::ParseError, nel::ParseError>(nel::ParseError&)>
+    22e1:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    22e4:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    22e8:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    22eb:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    22ee:	|  |  |      e8 d9 fd ff ff       	call   20cc <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}::operator()(nel::ParseError&&) const>
+    22f3:	|  |  +----- eb 2c                	jmp    2321 <nel::Pair<unsigned long long, unsigned long> nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::consume<nel::Pair<unsigned long long, unsigned long>, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)+0xc7>
+                    nel::panic("invalid Result", ctx);
+    22f5:	|  \--|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    22f9:	|     |      48 89 c6             	mov    %rax,%rsi
+    22fc:	|     |      48 8d 05 f1 2d 00 00 	lea    0x2df1(%rip),%rax        # 50f4 <n_reps+0xbc>
+    2303:	|     |      48 89 c7             	mov    %rax,%rdi
+    2306:	|     |      e8 1a 02 00 00       	call   2525 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    230b:	\-----|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    230f:	      |      48 89 c6             	mov    %rax,%rsi
+    2312:	      |      48 8d 05 c6 2d 00 00 	lea    0x2dc6(%rip),%rax        # 50df <n_reps+0xa7>
+    2319:	      |      48 89 c7             	mov    %rax,%rdi
+    231c:	      |      e8 04 02 00 00       	call   2525 <nel::panic(char const*, nel::Context const&)>
+        }
+    2321:	      \----> c9                   	leave
+    2322:	             c3                   	ret
+
+0000000000002323 <nel::Pair<double, unsigned long>&& nel::forward<nel::Pair<double, unsigned long>, nel::Pair<double, unsigned long> >(nel::Pair<double, unsigned long>&)>:
+constexpr U &&forward(T &t)
+    2323:	55                   	push   %rbp
+    2324:	48 89 e5             	mov    %rsp,%rbp
+    2327:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    232b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    232f:	5d                   	pop    %rbp
+    2330:	c3                   	ret
+    2331:	90                   	nop
+
+0000000000002332 <nel::Pair<double, unsigned long> nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::consume<nel::Pair<double, unsigned long>, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<double, unsigned long>&&)#1}, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<double, unsigned long>&&)#1}&&, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    2332:	             55                   	push   %rbp
+    2333:	             48 89 e5             	mov    %rsp,%rbp
+    2336:	             53                   	push   %rbx
+    2337:	             48 83 ec 38          	sub    $0x38,%rsp
+    233b:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    233f:	             48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    2343:	             48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    2347:	             48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+            auto tag = tag_;
+    234b:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    234f:	             8b 00                	mov    (%rax),%eax
+    2351:	             89 45 ec             	mov    %eax,-0x14(%rbp)
+            tag_ = Tag::INVAL;
+    2354:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2358:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    235e:	             83 7d ec 02          	cmpl   $0x2,-0x14(%rbp)
+    2362:	         /-- 74 62                	je     23c6 <nel::Pair<double, unsigned long> nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::consume<nel::Pair<double, unsigned long>, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<double, unsigned long>&&)#1}, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<double, unsigned long>&&)#1}&&, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)+0x94>
+    2364:	         |   83 7d ec 02          	cmpl   $0x2,-0x14(%rbp)
+    2368:	/--------|-- 0f 8f b2 00 00 00    	jg     2420 <nel::Pair<double, unsigned long> nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::consume<nel::Pair<double, unsigned long>, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<double, unsigned long>&&)#1}, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<double, unsigned long>&&)#1}&&, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)+0xee>
+    236e:	|        |   83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    2372:	|  /-----|-- 0f 84 92 00 00 00    	je     240a <nel::Pair<double, unsigned long> nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::consume<nel::Pair<double, unsigned long>, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<double, unsigned long>&&)#1}, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<double, unsigned long>&&)#1}&&, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)+0xd8>
+    2378:	|  |     |   83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    237c:	+--|-----|-- 0f 85 9e 00 00 00    	jne    2420 <nel::Pair<double, unsigned long> nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::consume<nel::Pair<double, unsigned long>, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<double, unsigned long>&&)#1}, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<double, unsigned long>&&)#1}&&, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)+0xee>
+                    return on_ok(forward<T>(*ok_));
+    2382:	|  |     |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2386:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    238a:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    238d:	|  |     |   e8 fa 00 00 00       	call   248c <nel::Element<nel::Pair<double, unsigned long> >::operator*()>
+    2392:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2395:	|  |     |   e8 89 ff ff ff       	call   2323 <nel::Pair<double, unsigned long>&& nel::forward<nel::Pair<double, unsigned long>, nel::Pair<double, unsigned long> >(nel::Pair<double, unsigned long>&)>
+    239a:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    239d:	|  |     |   48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    23a1:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    23a4:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    23a7:	|  |     |   e8 e0 fd ff ff       	call   218c <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<double, unsigned long>&&)#1}::operator()(nel::Pair<double, unsigned long>&&) const>
+    23ac:	|  |     |   66 48 0f 7e c6       	movq   %xmm0,%rsi
+    23b1:	|  |     |   48 89 c1             	mov    %rax,%rcx
+    23b4:	|  |     |   b8 00 00 00 00       	mov    $0x0,%eax
+    23b9:	|  |     |   ba 00 00 00 00       	mov    $0x0,%edx
+    23be:	|  |     |   48 89 f0             	mov    %rsi,%rax
+    23c1:	|  |     |   48 89 ca             	mov    %rcx,%rdx
+    23c4:	|  |  /--|-- eb 70                	jmp    2436 <nel::Pair<double, unsigned long> nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::consume<nel::Pair<double, unsigned long>, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<double, unsigned long>&&)#1}, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<double, unsigned long>&&)#1}&&, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)+0x104>
+                    return on_err(forward<E>(*err_));
+    23c6:	|  |  |  \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    23ca:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    23ce:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    23d1:	|  |  |      e8 8e 00 00 00       	call   2464 <nel::Element<nel::ParseError>::operator*()>
+    23d6:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    23d9:	|  |  |      e8 a0 00 00 00       	call   247e <nel::ParseError&& nel::forward<nel::ParseError, nel::ParseError>(nel::ParseError&)>
+    23de:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    23e1:	|  |  |      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    23e5:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    23e8:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    23eb:	|  |  |      e8 d4 fd ff ff       	call   21c4 <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}::operator()(nel::ParseError&&) const>
+    23f0:	|  |  |      66 48 0f 7e c6       	movq   %xmm0,%rsi
+    23f5:	|  |  |      48 89 c1             	mov    %rax,%rcx
+    23f8:	|  |  |      b8 00 00 00 00       	mov    $0x0,%eax
+    23fd:	|  |  |      ba 00 00 00 00       	mov    $0x0,%edx
+    2402:	|  |  |      48 89 f0             	mov    %rsi,%rax
+    2405:	|  |  |      48 89 ca             	mov    %rcx,%rdx
+    2408:	|  |  +----- eb 2c                	jmp    2436 <nel::Pair<double, unsigned long> nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::consume<nel::Pair<double, unsigned long>, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<double, unsigned long>&&)#1}, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::Pair<double, unsigned long>&&)#1}&&, nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)+0x104>
+                    nel::panic("invalid Result", ctx);
+    240a:	|  \--|----> 48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    240e:	|     |      48 89 c6             	mov    %rax,%rsi
+    2411:	|     |      48 8d 05 dc 2c 00 00 	lea    0x2cdc(%rip),%rax        # 50f4 <n_reps+0xbc>
+    2418:	|     |      48 89 c7             	mov    %rax,%rdi
+    241b:	|     |      e8 05 01 00 00       	call   2525 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    2420:	\-----|----> 48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2424:	      |      48 89 c6             	mov    %rax,%rsi
+    2427:	      |      48 8d 05 b1 2c 00 00 	lea    0x2cb1(%rip),%rax        # 50df <n_reps+0xa7>
+    242e:	      |      48 89 c7             	mov    %rax,%rdi
+    2431:	      |      e8 ef 00 00 00       	call   2525 <nel::panic(char const*, nel::Context const&)>
+        }
+    2436:	      \----> 48 89 c1             	mov    %rax,%rcx
+    2439:	             48 89 d3             	mov    %rdx,%rbx
+    243c:	             48 89 d0             	mov    %rdx,%rax
+    243f:	             66 48 0f 6e c1       	movq   %rcx,%xmm0
+    2444:	             48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2448:	             c9                   	leave
+    2449:	             c3                   	ret
+
+000000000000244a <nel::Element<nel::Pair<unsigned long long, unsigned long> >::operator*()>:
+        constexpr Type const &operator*(void) const
+        {
+            return ref();
+        }
+
+        constexpr Type &operator*(void)
+    244a:	55                   	push   %rbp
+    244b:	48 89 e5             	mov    %rsp,%rbp
+    244e:	48 83 ec 10          	sub    $0x10,%rsp
+    2452:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    2456:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    245a:	48 89 c7             	mov    %rax,%rdi
+    245d:	e8 44 00 00 00       	call   24a6 <nel::Element<nel::Pair<unsigned long long, unsigned long> >::ref()>
+        }
+    2462:	c9                   	leave
+    2463:	c3                   	ret
+
+0000000000002464 <nel::Element<nel::ParseError>::operator*()>:
+        constexpr Type &operator*(void)
+    2464:	55                   	push   %rbp
+    2465:	48 89 e5             	mov    %rsp,%rbp
+    2468:	48 83 ec 10          	sub    $0x10,%rsp
+    246c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    2470:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2474:	48 89 c7             	mov    %rax,%rdi
+    2477:	e8 38 00 00 00       	call   24b4 <nel::Element<nel::ParseError>::ref()>
+        }
+    247c:	c9                   	leave
+    247d:	c3                   	ret
+
+000000000000247e <nel::ParseError&& nel::forward<nel::ParseError, nel::ParseError>(nel::ParseError&)>:
+constexpr U &&forward(T &t)
+    247e:	55                   	push   %rbp
+    247f:	48 89 e5             	mov    %rsp,%rbp
+    2482:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    2486:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    248a:	5d                   	pop    %rbp
+    248b:	c3                   	ret
+
+000000000000248c <nel::Element<nel::Pair<double, unsigned long> >::operator*()>:
+        constexpr Type &operator*(void)
+    248c:	55                   	push   %rbp
+    248d:	48 89 e5             	mov    %rsp,%rbp
+    2490:	48 83 ec 10          	sub    $0x10,%rsp
+    2494:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    2498:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    249c:	48 89 c7             	mov    %rax,%rdi
+    249f:	e8 1e 00 00 00       	call   24c2 <nel::Element<nel::Pair<double, unsigned long> >::ref()>
+        }
+    24a4:	c9                   	leave
+    24a5:	c3                   	ret
+
+00000000000024a6 <nel::Element<nel::Pair<unsigned long long, unsigned long> >::ref()>:
+        constexpr Type &ref(void)
+    24a6:	55                   	push   %rbp
+    24a7:	48 89 e5             	mov    %rsp,%rbp
+    24aa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    24ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    24b2:	5d                   	pop    %rbp
+    24b3:	c3                   	ret
+
+00000000000024b4 <nel::Element<nel::ParseError>::ref()>:
+        constexpr Type &ref(void)
+    24b4:	55                   	push   %rbp
+    24b5:	48 89 e5             	mov    %rsp,%rbp
+    24b8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    24bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    24c0:	5d                   	pop    %rbp
+    24c1:	c3                   	ret
+
+00000000000024c2 <nel::Element<nel::Pair<double, unsigned long> >::ref()>:
+        constexpr Type &ref(void)
+    24c2:	55                   	push   %rbp
+    24c3:	48 89 e5             	mov    %rsp,%rbp
+    24c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    24ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    24ce:	5d                   	pop    %rbp
+    24cf:	c3                   	ret
+
+00000000000024d0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    24d0:	55                   	push   %rbp
+    24d1:	48 89 e5             	mov    %rsp,%rbp
+    std::abort();
+    24d4:	e8 57 eb ff ff       	call   1030 <abort@plt>
+
+00000000000024d9 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    24d9:	55                   	push   %rbp
+    24da:	48 89 e5             	mov    %rsp,%rbp
+    24dd:	48 83 ec 10          	sub    $0x10,%rsp
+    24e1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    24e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24e9:	48 8b 30             	mov    (%rax),%rsi
+    24ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24f0:	8b 48 10             	mov    0x10(%rax),%ecx
+    24f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24f7:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    24fb:	48 8b 05 5e 7b 00 00 	mov    0x7b5e(%rip),%rax        # a060 <stderr@GLIBC_2.2.5>
+    2502:	4c 8d 0d fa 2b 00 00 	lea    0x2bfa(%rip),%r9        # 5103 <n_reps+0xcb>
+    2509:	49 89 f0             	mov    %rsi,%r8
+    250c:	48 8d 35 f6 2b 00 00 	lea    0x2bf6(%rip),%rsi        # 5109 <n_reps+0xd1>
+    2513:	48 89 c7             	mov    %rax,%rdi
+    2516:	b8 00 00 00 00       	mov    $0x0,%eax
+    251b:	e8 70 eb ff ff       	call   1090 <fprintf@plt>
+    abort();
+    2520:	e8 ab ff ff ff       	call   24d0 <nel::abort()>
+
+0000000000002525 <nel::panic(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    2525:	55                   	push   %rbp
+    2526:	48 89 e5             	mov    %rsp,%rbp
+    2529:	48 83 ec 10          	sub    $0x10,%rsp
+    252d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2531:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    2535:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2539:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    253c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2540:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    2543:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2547:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    254b:	48 8b 05 0e 7b 00 00 	mov    0x7b0e(%rip),%rax        # a060 <stderr@GLIBC_2.2.5>
+    2552:	48 83 ec 08          	sub    $0x8,%rsp
+    2556:	ff 75 f8             	push   -0x8(%rbp)
+    2559:	4c 8d 0d a3 2b 00 00 	lea    0x2ba3(%rip),%r9        # 5103 <n_reps+0xcb>
+    2560:	49 89 f0             	mov    %rsi,%r8
+    2563:	48 8d 35 b0 2b 00 00 	lea    0x2bb0(%rip),%rsi        # 511a <n_reps+0xe2>
+    256a:	48 89 c7             	mov    %rax,%rdi
+    256d:	b8 00 00 00 00       	mov    $0x0,%eax
+    2572:	e8 19 eb ff ff       	call   1090 <fprintf@plt>
+    2577:	48 83 c4 10          	add    $0x10,%rsp
+            "PANIC",
+            msg);
+    abort();
+    257b:	e8 50 ff ff ff       	call   24d0 <nel::abort()>
+
+0000000000002580 <nel::assert_fail(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    2580:	55                   	push   %rbp
+    2581:	48 89 e5             	mov    %rsp,%rbp
+    2584:	48 83 ec 10          	sub    $0x10,%rsp
+    2588:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    258c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    2590:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2594:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    2597:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    259b:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    259e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25a2:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    25a6:	48 8b 05 b3 7a 00 00 	mov    0x7ab3(%rip),%rax        # a060 <stderr@GLIBC_2.2.5>
+    25ad:	48 83 ec 08          	sub    $0x8,%rsp
+    25b1:	ff 75 f8             	push   -0x8(%rbp)
+    25b4:	4c 8d 0d 74 2b 00 00 	lea    0x2b74(%rip),%r9        # 512f <n_reps+0xf7>
+    25bb:	49 89 f0             	mov    %rsi,%r8
+    25be:	48 8d 35 55 2b 00 00 	lea    0x2b55(%rip),%rsi        # 511a <n_reps+0xe2>
+    25c5:	48 89 c7             	mov    %rax,%rdi
+    25c8:	b8 00 00 00 00       	mov    $0x0,%eax
+    25cd:	e8 be ea ff ff       	call   1090 <fprintf@plt>
+    25d2:	48 83 c4 10          	add    $0x10,%rsp
+            "ASSERT FAIL",
+            msg);
+    abort();
+    25d6:	e8 f5 fe ff ff       	call   24d0 <nel::abort()>
+
+00000000000025db <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    25db:	55                   	push   %rbp
+    25dc:	48 89 e5             	mov    %rsp,%rbp
+    25df:	48 83 ec 10          	sub    $0x10,%rsp
+    25e3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    25e7:	89 f0                	mov    %esi,%eax
+    25e9:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    25ec:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    25f0:	48 8b 15 69 7a 00 00 	mov    0x7a69(%rip),%rdx        # a060 <stderr@GLIBC_2.2.5>
+    25f7:	48 89 d6             	mov    %rdx,%rsi
+    25fa:	89 c7                	mov    %eax,%edi
+    25fc:	e8 6f ea ff ff       	call   1070 <fputc@plt>
+    return outs;
+    2601:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2605:	c9                   	leave
+    2606:	c3                   	ret
+
+0000000000002607 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    2607:	55                   	push   %rbp
+    2608:	48 89 e5             	mov    %rsp,%rbp
+    260b:	48 83 ec 10          	sub    $0x10,%rsp
+    260f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2613:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    2617:	48 8b 15 42 7a 00 00 	mov    0x7a42(%rip),%rdx        # a060 <stderr@GLIBC_2.2.5>
+    261e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2622:	48 89 d6             	mov    %rdx,%rsi
+    2625:	48 89 c7             	mov    %rax,%rdi
+    2628:	e8 33 ea ff ff       	call   1060 <fputs@plt>
+    return outs;
+    262d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2631:	c9                   	leave
+    2632:	c3                   	ret
+
+0000000000002633 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    2633:	55                   	push   %rbp
+    2634:	48 89 e5             	mov    %rsp,%rbp
+    2637:	48 83 ec 10          	sub    $0x10,%rsp
+    263b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    263f:	89 f0                	mov    %esi,%eax
+    2641:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    2644:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    2648:	48 8b 05 11 7a 00 00 	mov    0x7a11(%rip),%rax        # a060 <stderr@GLIBC_2.2.5>
+    264f:	48 8d 0d e5 2a 00 00 	lea    0x2ae5(%rip),%rcx        # 513b <n_reps+0x103>
+    2656:	48 89 ce             	mov    %rcx,%rsi
+    2659:	48 89 c7             	mov    %rax,%rdi
+    265c:	b8 00 00 00 00       	mov    $0x0,%eax
+    2661:	e8 2a ea ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    2666:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    266a:	c9                   	leave
+    266b:	c3                   	ret
+
+000000000000266c <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    266c:	55                   	push   %rbp
+    266d:	48 89 e5             	mov    %rsp,%rbp
+    2670:	48 83 ec 10          	sub    $0x10,%rsp
+    2674:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2678:	89 f0                	mov    %esi,%eax
+    267a:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    267e:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    2682:	48 8b 05 d7 79 00 00 	mov    0x79d7(%rip),%rax        # a060 <stderr@GLIBC_2.2.5>
+    2689:	48 8d 0d ab 2a 00 00 	lea    0x2aab(%rip),%rcx        # 513b <n_reps+0x103>
+    2690:	48 89 ce             	mov    %rcx,%rsi
+    2693:	48 89 c7             	mov    %rax,%rdi
+    2696:	b8 00 00 00 00       	mov    $0x0,%eax
+    269b:	e8 f0 e9 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    26a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    26a4:	c9                   	leave
+    26a5:	c3                   	ret
+
+00000000000026a6 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    26a6:	55                   	push   %rbp
+    26a7:	48 89 e5             	mov    %rsp,%rbp
+    26aa:	48 83 ec 10          	sub    $0x10,%rsp
+    26ae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    26b2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    26b5:	48 8b 05 a4 79 00 00 	mov    0x79a4(%rip),%rax        # a060 <stderr@GLIBC_2.2.5>
+    26bc:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    26bf:	48 8d 0d 75 2a 00 00 	lea    0x2a75(%rip),%rcx        # 513b <n_reps+0x103>
+    26c6:	48 89 ce             	mov    %rcx,%rsi
+    26c9:	48 89 c7             	mov    %rax,%rdi
+    26cc:	b8 00 00 00 00       	mov    $0x0,%eax
+    26d1:	e8 ba e9 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    26d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    26da:	c9                   	leave
+    26db:	c3                   	ret
+
+00000000000026dc <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    26dc:	55                   	push   %rbp
+    26dd:	48 89 e5             	mov    %rsp,%rbp
+    26e0:	48 83 ec 10          	sub    $0x10,%rsp
+    26e4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    26e8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    26eb:	48 8b 05 6e 79 00 00 	mov    0x796e(%rip),%rax        # a060 <stderr@GLIBC_2.2.5>
+    26f2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    26f5:	48 8d 0d 3f 2a 00 00 	lea    0x2a3f(%rip),%rcx        # 513b <n_reps+0x103>
+    26fc:	48 89 ce             	mov    %rcx,%rsi
+    26ff:	48 89 c7             	mov    %rax,%rdi
+    2702:	b8 00 00 00 00       	mov    $0x0,%eax
+    2707:	e8 84 e9 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    270c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2710:	c9                   	leave
+    2711:	c3                   	ret
+
+0000000000002712 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    2712:	55                   	push   %rbp
+    2713:	48 89 e5             	mov    %rsp,%rbp
+    2716:	48 83 ec 10          	sub    $0x10,%rsp
+    271a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    271e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    2722:	48 8b 05 37 79 00 00 	mov    0x7937(%rip),%rax        # a060 <stderr@GLIBC_2.2.5>
+    2729:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    272d:	48 8d 0d 0a 2a 00 00 	lea    0x2a0a(%rip),%rcx        # 513e <n_reps+0x106>
+    2734:	48 89 ce             	mov    %rcx,%rsi
+    2737:	48 89 c7             	mov    %rax,%rdi
+    273a:	b8 00 00 00 00       	mov    $0x0,%eax
+    273f:	e8 4c e9 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    2744:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2748:	c9                   	leave
+    2749:	c3                   	ret
+
+000000000000274a <nel::(anonymous namespace)::is_digit(unsigned char)>:
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+bool is_digit(unsigned char const c)
+{
+    274a:	55                   	push   %rbp
+    274b:	48 89 e5             	mov    %rsp,%rbp
+    274e:	89 f8                	mov    %edi,%eax
+    2750:	88 45 fc             	mov    %al,-0x4(%rbp)
+    return (unsigned char)(c - '0') < 10;
+    2753:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    2757:	83 e8 30             	sub    $0x30,%eax
+    275a:	3c 09                	cmp    $0x9,%al
+    275c:	0f 96 c0             	setbe  %al
+}
+    275f:	5d                   	pop    %rbp
+    2760:	c3                   	ret
+
+0000000000002761 <nel::(anonymous namespace)::load8(unsigned char const*)>:
+
+// The 8 bytes at p as a little endian word, so p[0] is the lowest byte.
+Word load8(unsigned char const p[])
+{
+    2761:	55                   	push   %rbp
+    2762:	48 89 e5             	mov    %rsp,%rbp
+    2765:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Word v;
+    __builtin_memcpy(&v, p, sizeof(v));
+    2769:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    276d:	48 8b 00             	mov    (%rax),%rax
+    2770:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    return v;
+    2774:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2778:	5d                   	pop    %rbp
+    2779:	c3                   	ret
+
+000000000000277a <nel::(anonymous namespace)::non_digits(unsigned long long)>:
+
+// The top bit of each byte of v set if that byte is not a digit.
+// Only exact up to and including the first non-digit, which is all that's used:
+// the subtract can borrow out of a byte below '0' into the bytes after it.
+Word non_digits(Word const v)
+{
+    277a:	55                   	push   %rbp
+    277b:	48 89 e5             	mov    %rsp,%rbp
+    277e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    2782:	48 ba 46 46 46 46 46 	movabs $0x4646464646464646,%rdx
+    2789:	46 46 46 
+    278c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2790:	48 01 c2             	add    %rax,%rdx
+    2793:	48 b9 d0 cf cf cf cf 	movabs $0xcfcfcfcfcfcfcfd0,%rcx
+    279a:	cf cf cf 
+    279d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27a1:	48 01 c8             	add    %rcx,%rax
+    27a4:	48 09 c2             	or     %rax,%rdx
+    27a7:	48 b8 80 80 80 80 80 	movabs $0x8080808080808080,%rax
+    27ae:	80 80 80 
+    27b1:	48 21 d0             	and    %rdx,%rax
+}
+    27b4:	5d                   	pop    %rbp
+    27b5:	c3                   	ret
+
+00000000000027b6 <nel::(anonymous namespace)::parse8(unsigned long long)>:
+
+// The value of the 8 digits in v, p[0] the most significant.
+// Pairs of digits are combined, then pairs of pairs, each with one multiply.
+Word parse8(Word v)
+{
+    27b6:	55                   	push   %rbp
+    27b7:	48 89 e5             	mov    %rsp,%rbp
+    27ba:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    Word const mask = 0x000000FF000000FFULL;
+    27be:	48 b8 ff 00 00 00 ff 	movabs $0xff000000ff,%rax
+    27c5:	00 00 00 
+    27c8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    Word const mul1 = 100ULL + (1000000ULL << 32);
+    27cc:	48 b8 64 00 00 00 40 	movabs $0xf424000000064,%rax
+    27d3:	42 0f 00 
+    27d6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    Word const mul2 = 1ULL + (10000ULL << 32);
+    27da:	48 b8 01 00 00 00 10 	movabs $0x271000000001,%rax
+    27e1:	27 00 00 
+    27e4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    v -= 0x3030303030303030ULL;
+    27e8:	48 b8 d0 cf cf cf cf 	movabs $0xcfcfcfcfcfcfcfd0,%rax
+    27ef:	cf cf cf 
+    27f2:	48 01 45 d8          	add    %rax,-0x28(%rbp)
+    v = (v * 10) + (v >> 8);
+    27f6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    27fa:	48 89 d0             	mov    %rdx,%rax
+    27fd:	48 c1 e0 02          	shl    $0x2,%rax
+    2801:	48 01 d0             	add    %rdx,%rax
+    2804:	48 01 c0             	add    %rax,%rax
+    2807:	48 89 c2             	mov    %rax,%rdx
+    280a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    280e:	48 c1 e8 08          	shr    $0x8,%rax
+    2812:	48 01 d0             	add    %rdx,%rax
+    2815:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+    2819:	48 b8 ff 00 00 00 ff 	movabs $0xff000000ff,%rax
+    2820:	00 00 00 
+    2823:	48 23 45 d8          	and    -0x28(%rbp),%rax
+    2827:	48 ba 64 00 00 00 40 	movabs $0xf424000000064,%rdx
+    282e:	42 0f 00 
+    2831:	48 0f af d0          	imul   %rax,%rdx
+    2835:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2839:	48 c1 e8 10          	shr    $0x10,%rax
+    283d:	48 89 c1             	mov    %rax,%rcx
+    2840:	48 b8 ff 00 00 00 ff 	movabs $0xff000000ff,%rax
+    2847:	00 00 00 
+    284a:	48 21 c1             	and    %rax,%rcx
+    284d:	48 b8 01 00 00 00 10 	movabs $0x271000000001,%rax
+    2854:	27 00 00 
+    2857:	48 0f af c1          	imul   %rcx,%rax
+    285b:	48 01 d0             	add    %rdx,%rax
+    285e:	48 c1 e8 20          	shr    $0x20,%rax
+}
+    2862:	5d                   	pop    %rbp
+    2863:	c3                   	ret
+
+0000000000002864 <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)>:
+
+// The number of digits at the start of p[0..n).
+Length digit_run(unsigned char const p[], Length const n)
+{
+    2864:	             55                   	push   %rbp
+    2865:	             48 89 e5             	mov    %rsp,%rbp
+    2868:	             48 83 ec 20          	sub    $0x20,%rsp
+    286c:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2870:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    Index i = 0;
+    2874:	             48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    287b:	             00 
+    while (i + 8 <= n) {
+    287c:	      /----- eb 4a                	jmp    28c8 <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)+0x64>
+        Word const m = non_digits(load8(p + i));
+    287e:	   /--|----> 48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2882:	   |  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2886:	   |  |      48 01 d0             	add    %rdx,%rax
+    2889:	   |  |      48 89 c7             	mov    %rax,%rdi
+    288c:	   |  |      e8 d0 fe ff ff       	call   2761 <nel::(anonymous namespace)::load8(unsigned char const*)>
+    2891:	   |  |      48 89 c7             	mov    %rax,%rdi
+    2894:	   |  |      e8 e1 fe ff ff       	call   277a <nel::(anonymous namespace)::non_digits(unsigned long long)>
+    2899:	   |  |      48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        if (m != 0) { return i + Length(__builtin_ctzll(m) / 8); }
+    289d:	   |  |      48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    28a2:	   |  |  /-- 74 1f                	je     28c3 <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)+0x5f>
+    28a4:	   |  |  |   31 c0                	xor    %eax,%eax
+    28a6:	   |  |  |   f3 48 0f bc 45 f0    	tzcnt  -0x10(%rbp),%rax
+    28ac:	   |  |  |   8d 50 07             	lea    0x7(%rax),%edx
+    28af:	   |  |  |   85 c0                	test   %eax,%eax
+    28b1:	   |  |  |   0f 48 c2             	cmovs  %edx,%eax
+    28b4:	   |  |  |   c1 f8 03             	sar    $0x3,%eax
+    28b7:	   |  |  |   48 63 d0             	movslq %eax,%rdx
+    28ba:	   |  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28be:	   |  |  |   48 01 d0             	add    %rdx,%rax
+    28c1:	/--|--|--|-- eb 54                	jmp    2917 <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)+0xb3>
+        i += 8;
+    28c3:	|  |  |  \-> 48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (i + 8 <= n) {
+    28c8:	|  |  \----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28cc:	|  |         48 83 c0 08          	add    $0x8,%rax
+    28d0:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    28d4:	|  \-------- 73 a8                	jae    287e <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)+0x1a>
+    }
+    while (i < n && is_digit(p[i])) {
+    28d6:	|        /-- eb 05                	jmp    28dd <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)+0x79>
+        i += 1;
+    28d8:	|  /-----|-> 48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (i < n && is_digit(p[i])) {
+    28dd:	|  |     \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28e1:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    28e5:	|  |  /----- 73 23                	jae    290a <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)+0xa6>
+    28e7:	|  |  |      48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    28eb:	|  |  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28ef:	|  |  |      48 01 d0             	add    %rdx,%rax
+    28f2:	|  |  |      0f b6 00             	movzbl (%rax),%eax
+    28f5:	|  |  |      0f b6 c0             	movzbl %al,%eax
+    28f8:	|  |  |      89 c7                	mov    %eax,%edi
+    28fa:	|  |  |      e8 4b fe ff ff       	call   274a <nel::(anonymous namespace)::is_digit(unsigned char)>
+    28ff:	|  |  |      84 c0                	test   %al,%al
+    2901:	|  |  +----- 74 07                	je     290a <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)+0xa6>
+    2903:	|  |  |      b8 01 00 00 00       	mov    $0x1,%eax
+    2908:	|  |  |  /-- eb 05                	jmp    290f <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)+0xab>
+    290a:	|  |  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    290f:	|  |     \-> 84 c0                	test   %al,%al
+    2911:	|  \-------- 75 c5                	jne    28d8 <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)+0x74>
+    }
+    return i;
+    2913:	|            48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2917:	\----------> c9                   	leave
+    2918:	             c3                   	ret
+
+0000000000002919 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>:
+
+// The value of the d digits p[0..d), d <= 19 so it fits.
+// avail is how many bytes may be read from p, at least d.
+Word digits_value(unsigned char const p[], Length const d, Length const avail)
+{
+    2919:	          55                   	push   %rbp
+    291a:	          48 89 e5             	mov    %rsp,%rbp
+    291d:	          53                   	push   %rbx
+    291e:	          48 83 ec 38          	sub    $0x38,%rsp
+    2922:	          48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+    2926:	          48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    292a:	          48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    Word v = 0;
+    292e:	          48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    2935:	          00 
+    Index i = 0;
+    2936:	          48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+    293d:	          00 
+    for (; i + 8 <= d; i += 8) {
+    293e:	      /-- eb 32                	jmp    2972 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x59>
+        v = v * 100000000ULL + parse8(load8(p + i));
+    2940:	   /--|-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2944:	   |  |   48 69 d8 00 e1 f5 05 	imul   $0x5f5e100,%rax,%rbx
+    294b:	   |  |   48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    294f:	   |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2953:	   |  |   48 01 d0             	add    %rdx,%rax
+    2956:	   |  |   48 89 c7             	mov    %rax,%rdi
+    2959:	   |  |   e8 03 fe ff ff       	call   2761 <nel::(anonymous namespace)::load8(unsigned char const*)>
+    295e:	   |  |   48 89 c7             	mov    %rax,%rdi
+    2961:	   |  |   e8 50 fe ff ff       	call   27b6 <nel::(anonymous namespace)::parse8(unsigned long long)>
+    2966:	   |  |   48 01 d8             	add    %rbx,%rax
+    2969:	   |  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (; i + 8 <= d; i += 8) {
+    296d:	   |  |   48 83 45 e8 08       	addq   $0x8,-0x18(%rbp)
+    2972:	   |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2976:	   |      48 83 c0 08          	add    $0x8,%rax
+    297a:	   |      48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    297e:	   \----- 73 c0                	jae    2940 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x27>
+    }
+    Length const r = d - i;
+    2980:	          48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2984:	          48 2b 45 e8          	sub    -0x18(%rbp),%rax
+    2988:	          48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if (r == 0) { return v; }
+    298c:	          48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    2991:	      /-- 75 09                	jne    299c <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x83>
+    2993:	      |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2997:	/-----|-- e9 cc 00 00 00       	jmp    2a68 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x14f>
+    if (i + 8 <= avail) {
+    299c:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    29a0:	|         48 83 c0 08          	add    $0x8,%rax
+    29a4:	|         48 39 45 c0          	cmp    %rax,-0x40(%rbp)
+    29a8:	|  /----- 0f 82 ac 00 00 00    	jb     2a5a <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x141>
+        // the last r digits as the low digits of 8: shifted up, with '0's shifted in under them.
+        Word const w =
+            (load8(p + i) << (8 * (8 - r))) | (0x3030303030303030ULL >> (8 * r));
+    29ae:	|  |      48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    29b2:	|  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    29b6:	|  |      48 01 d0             	add    %rdx,%rax
+    29b9:	|  |      48 89 c7             	mov    %rax,%rdi
+    29bc:	|  |      e8 a0 fd ff ff       	call   2761 <nel::(anonymous namespace)::load8(unsigned char const*)>
+    29c1:	|  |      ba 08 00 00 00       	mov    $0x8,%edx
+    29c6:	|  |      48 2b 55 e0          	sub    -0x20(%rbp),%rdx
+    29ca:	|  |      48 c1 e2 03          	shl    $0x3,%rdx
+    29ce:	|  |      89 d1                	mov    %edx,%ecx
+    29d0:	|  |      48 d3 e0             	shl    %cl,%rax
+    29d3:	|  |      48 89 c2             	mov    %rax,%rdx
+    29d6:	|  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29da:	|  |      48 c1 e0 03          	shl    $0x3,%rax
+    29de:	|  |      89 c1                	mov    %eax,%ecx
+    29e0:	|  |      48 b8 30 30 30 30 30 	movabs $0x3030303030303030,%rax
+    29e7:	|  |      30 30 30 
+    29ea:	|  |      48 d3 e8             	shr    %cl,%rax
+    29ed:	|  |      48 09 d0             	or     %rdx,%rax
+    29f0:	|  |      48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        return v * pow10_u64[r] + parse8(w);
+    29f4:	|  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29f8:	|  |      48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    29ff:	|  |      00 
+    2a00:	|  |      48 8d 05 79 27 00 00 	lea    0x2779(%rip),%rax        # 5180 <nel::(anonymous namespace)::pow10_u64>
+    2a07:	|  |      48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    2a0b:	|  |      48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+    2a10:	|  |      48 89 c3             	mov    %rax,%rbx
+    2a13:	|  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2a17:	|  |      48 89 c7             	mov    %rax,%rdi
+    2a1a:	|  |      e8 97 fd ff ff       	call   27b6 <nel::(anonymous namespace)::parse8(unsigned long long)>
+    2a1f:	|  |      48 01 d8             	add    %rbx,%rax
+    2a22:	+--|----- eb 44                	jmp    2a68 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x14f>
+    }
+    for (; i < d; ++i) {
+        v = v * 10 + Word(p[i] - '0');
+    2a24:	|  |  /-> 48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2a28:	|  |  |   48 89 d0             	mov    %rdx,%rax
+    2a2b:	|  |  |   48 c1 e0 02          	shl    $0x2,%rax
+    2a2f:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2a32:	|  |  |   48 01 c0             	add    %rax,%rax
+    2a35:	|  |  |   48 89 c1             	mov    %rax,%rcx
+    2a38:	|  |  |   48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    2a3c:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a40:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2a43:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    2a46:	|  |  |   0f b6 c0             	movzbl %al,%eax
+    2a49:	|  |  |   83 e8 30             	sub    $0x30,%eax
+    2a4c:	|  |  |   48 98                	cltq
+    2a4e:	|  |  |   48 01 c8             	add    %rcx,%rax
+    2a51:	|  |  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (; i < d; ++i) {
+    2a55:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    2a5a:	|  \--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a5e:	|     |   48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+    2a62:	|     \-- 72 c0                	jb     2a24 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x10b>
+    }
+    return v;
+    2a64:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+    2a68:	\-------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2a6c:	          c9                   	leave
+    2a6d:	          c3                   	ret
+
+0000000000002a6e <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)>:
+
+// The magnitude of the unsigned integer at p[0..n).
+Result<Pair<Word, Length>, ParseError> parse_magnitude(unsigned char const p[], Length const n)
+{
+    2a6e:	             55                   	push   %rbp
+    2a6f:	             48 89 e5             	mov    %rsp,%rbp
+    2a72:	             48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    2a76:	             48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    2a7a:	             48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    2a7e:	             48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    typedef Result<Pair<Word, Length>, ParseError> R;
+    if (n == 0) { return R::Err(ParseError::Empty); }
+    2a82:	             48 83 7d 88 00       	cmpq   $0x0,-0x78(%rbp)
+    2a87:	         /-- 75 1f                	jne    2aa8 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x3a>
+    2a89:	         |   c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+    2a90:	         |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2a94:	         |   48 8d 55 a8          	lea    -0x58(%rbp),%rdx
+    2a98:	         |   48 89 d6             	mov    %rdx,%rsi
+    2a9b:	         |   48 89 c7             	mov    %rax,%rdi
+    2a9e:	         |   e8 ce 16 00 00       	call   4171 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Err(nel::ParseError&&)>
+    if (__builtin_mul_overflow(v, Word(10), &v) ||
+        __builtin_add_overflow(v, Word(p[z + 19] - '0'), &v)) {
+        return R::Err(ParseError::Overflow);
+    }
+    return R::Ok(Pair<Word, Length>{v, used});
+}
+    2aa3:	/--------|-- e9 e1 01 00 00       	jmp    2c89 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x21b>
+    if (!is_digit(p[0])) { return R::Err(ParseError::InvalidDigit); }
+    2aa8:	|        \-> 48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2aac:	|            0f b6 00             	movzbl (%rax),%eax
+    2aaf:	|            0f b6 c0             	movzbl %al,%eax
+    2ab2:	|            89 c7                	mov    %eax,%edi
+    2ab4:	|            e8 91 fc ff ff       	call   274a <nel::(anonymous namespace)::is_digit(unsigned char)>
+    2ab9:	|            83 f0 01             	xor    $0x1,%eax
+    2abc:	|            84 c0                	test   %al,%al
+    2abe:	|        /-- 74 1f                	je     2adf <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x71>
+    2ac0:	|        |   c7 45 ac 02 00 00 00 	movl   $0x2,-0x54(%rbp)
+    2ac7:	|        |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2acb:	|        |   48 8d 55 ac          	lea    -0x54(%rbp),%rdx
+    2acf:	|        |   48 89 d6             	mov    %rdx,%rsi
+    2ad2:	|        |   48 89 c7             	mov    %rax,%rdi
+    2ad5:	|        |   e8 97 16 00 00       	call   4171 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Err(nel::ParseError&&)>
+}
+    2ada:	+--------|-- e9 aa 01 00 00       	jmp    2c89 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x21b>
+    Index z = 0;
+    2adf:	|        \-> 48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    2ae6:	|            00 
+    while (z < n && p[z] == '0') {
+    2ae7:	|        /-- eb 05                	jmp    2aee <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x80>
+        z += 1;
+    2ae9:	|     /--|-> 48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (z < n && p[z] == '0') {
+    2aee:	|     |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2af2:	|     |      48 3b 45 88          	cmp    -0x78(%rbp),%rax
+    2af6:	|     |  /-- 73 12                	jae    2b0a <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x9c>
+    2af8:	|     |  |   48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    2afc:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b00:	|     |  |   48 01 d0             	add    %rdx,%rax
+    2b03:	|     |  |   0f b6 00             	movzbl (%rax),%eax
+    2b06:	|     |  |   3c 30                	cmp    $0x30,%al
+    2b08:	|     \--|-- 74 df                	je     2ae9 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x7b>
+    Length const d = digit_run(p + z, n - z);
+    2b0a:	|        \-> 48 8b 45 88          	mov    -0x78(%rbp),%rax
+    2b0e:	|            48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    2b12:	|            48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    2b16:	|            48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2b1a:	|            48 01 ca             	add    %rcx,%rdx
+    2b1d:	|            48 89 c6             	mov    %rax,%rsi
+    2b20:	|            48 89 d7             	mov    %rdx,%rdi
+    2b23:	|            e8 3c fd ff ff       	call   2864 <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)>
+    2b28:	|            48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    Length const used = z + d;
+    2b2c:	|            48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2b30:	|            48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b34:	|            48 01 d0             	add    %rdx,%rax
+    2b37:	|            48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    if (d <= 19) { return R::Ok(Pair<Word, Length>{digits_value(p + z, d, n - z), used}); }
+    2b3b:	|            48 83 7d f0 13       	cmpq   $0x13,-0x10(%rbp)
+    2b40:	|        /-- 77 49                	ja     2b8b <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x11d>
+    2b42:	|        |   48 8b 45 88          	mov    -0x78(%rbp),%rax
+    2b46:	|        |   48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    2b4a:	|        |   48 89 c2             	mov    %rax,%rdx
+    2b4d:	|        |   48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    2b51:	|        |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b55:	|        |   48 01 c1             	add    %rax,%rcx
+    2b58:	|        |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b5c:	|        |   48 89 c6             	mov    %rax,%rsi
+    2b5f:	|        |   48 89 cf             	mov    %rcx,%rdi
+    2b62:	|        |   e8 b2 fd ff ff       	call   2919 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    2b67:	|        |   48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    2b6b:	|        |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b6f:	|        |   48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    2b73:	|        |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2b77:	|        |   48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    2b7b:	|        |   48 89 d6             	mov    %rdx,%rsi
+    2b7e:	|        |   48 89 c7             	mov    %rax,%rdi
+    2b81:	|        |   e8 1f 16 00 00       	call   41a5 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Ok(nel::Pair<unsigned long long, unsigned long>&&)>
+}
+    2b86:	+--------|-- e9 fe 00 00 00       	jmp    2c89 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x21b>
+    if (d > 20) { return R::Err(ParseError::Overflow); }
+    2b8b:	|        \-> 48 83 7d f0 14       	cmpq   $0x14,-0x10(%rbp)
+    2b90:	|        /-- 76 1f                	jbe    2bb1 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x143>
+    2b92:	|        |   c7 45 c8 03 00 00 00 	movl   $0x3,-0x38(%rbp)
+    2b99:	|        |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2b9d:	|        |   48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+    2ba1:	|        |   48 89 d6             	mov    %rdx,%rsi
+    2ba4:	|        |   48 89 c7             	mov    %rax,%rdi
+    2ba7:	|        |   e8 c5 15 00 00       	call   4171 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Err(nel::ParseError&&)>
+}
+    2bac:	+--------|-- e9 d8 00 00 00       	jmp    2c89 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x21b>
+    Word v = digits_value(p + z, 19, n - z);
+    2bb1:	|        \-> 48 8b 45 88          	mov    -0x78(%rbp),%rax
+    2bb5:	|            48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    2bb9:	|            48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    2bbd:	|            48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2bc1:	|            48 01 d1             	add    %rdx,%rcx
+    2bc4:	|            48 89 c2             	mov    %rax,%rdx
+    2bc7:	|            be 13 00 00 00       	mov    $0x13,%esi
+    2bcc:	|            48 89 cf             	mov    %rcx,%rdi
+    2bcf:	|            e8 45 fd ff ff       	call   2919 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    2bd4:	|            48 89 45 a0          	mov    %rax,-0x60(%rbp)
+    if (__builtin_mul_overflow(v, Word(10), &v) ||
+    2bd8:	|            48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    2bdc:	|            b9 00 00 00 00       	mov    $0x0,%ecx
+    2be1:	|            ba 0a 00 00 00       	mov    $0xa,%edx
+    2be6:	|            48 f7 e2             	mul    %rdx
+    2be9:	|        /-- 71 05                	jno    2bf0 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x182>
+    2beb:	|        |   b9 01 00 00 00       	mov    $0x1,%ecx
+    2bf0:	|        \-> 48 89 45 a0          	mov    %rax,-0x60(%rbp)
+    2bf4:	|            48 89 c8             	mov    %rcx,%rax
+    2bf7:	|            83 e0 01             	and    $0x1,%eax
+    2bfa:	|            84 c0                	test   %al,%al
+    2bfc:	|  /-------- 75 3c                	jne    2c3a <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x1cc>
+        __builtin_add_overflow(v, Word(p[z + 19] - '0'), &v)) {
+    2bfe:	|  |         48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    2c02:	|  |         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2c06:	|  |         48 8d 4a 13          	lea    0x13(%rdx),%rcx
+    2c0a:	|  |         48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    2c0e:	|  |         48 01 ca             	add    %rcx,%rdx
+    2c11:	|  |         0f b6 12             	movzbl (%rdx),%edx
+    2c14:	|  |         0f b6 d2             	movzbl %dl,%edx
+    2c17:	|  |         83 ea 30             	sub    $0x30,%edx
+    2c1a:	|  |         48 63 d2             	movslq %edx,%rdx
+    2c1d:	|  |         b9 00 00 00 00       	mov    $0x0,%ecx
+    2c22:	|  |         48 01 d0             	add    %rdx,%rax
+    2c25:	|  |     /-- 73 05                	jae    2c2c <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x1be>
+    2c27:	|  |     |   b9 01 00 00 00       	mov    $0x1,%ecx
+    2c2c:	|  |     \-> 48 89 45 a0          	mov    %rax,-0x60(%rbp)
+    2c30:	|  |         48 89 c8             	mov    %rcx,%rax
+    2c33:	|  |         83 e0 01             	and    $0x1,%eax
+    if (__builtin_mul_overflow(v, Word(10), &v) ||
+    2c36:	|  |         84 c0                	test   %al,%al
+    2c38:	|  |  /----- 74 07                	je     2c41 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x1d3>
+    2c3a:	|  \--|----> b8 01 00 00 00       	mov    $0x1,%eax
+    2c3f:	|     |  /-- eb 05                	jmp    2c46 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x1d8>
+    2c41:	|     \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    2c46:	|        \-> 84 c0                	test   %al,%al
+    2c48:	|        /-- 74 1c                	je     2c66 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x1f8>
+        return R::Err(ParseError::Overflow);
+    2c4a:	|        |   c7 45 cc 03 00 00 00 	movl   $0x3,-0x34(%rbp)
+    2c51:	|        |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2c55:	|        |   48 8d 55 cc          	lea    -0x34(%rbp),%rdx
+    2c59:	|        |   48 89 d6             	mov    %rdx,%rsi
+    2c5c:	|        |   48 89 c7             	mov    %rax,%rdi
+    2c5f:	|        |   e8 0d 15 00 00       	call   4171 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Err(nel::ParseError&&)>
+}
+    2c64:	+--------|-- eb 23                	jmp    2c89 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x21b>
+    return R::Ok(Pair<Word, Length>{v, used});
+    2c66:	|        \-> 48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    2c6a:	|            48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    2c6e:	|            48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c72:	|            48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    2c76:	|            48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2c7a:	|            48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    2c7e:	|            48 89 d6             	mov    %rdx,%rsi
+    2c81:	|            48 89 c7             	mov    %rax,%rdi
+    2c84:	|            e8 1c 15 00 00       	call   41a5 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Ok(nel::Pair<unsigned long long, unsigned long>&&)>
+}
+    2c89:	\----------> 48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2c8d:	             c9                   	leave
+    2c8e:	             c3                   	ret
+
+0000000000002c8f <nel::(anonymous namespace)::mul_wide(unsigned long long, unsigned long long)>:
+        Word lo;
+        Word hi;
+};
+
+Wide mul_wide(Word const a, Word const b)
+{
+    2c8f:	55                   	push   %rbp
+    2c90:	48 89 e5             	mov    %rsp,%rbp
+    2c93:	53                   	push   %rbx
+    2c94:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    2c98:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 U128;
+    U128 const r = U128(a) * b;
+    2c9c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+    2ca0:	48 89 f1             	mov    %rsi,%rcx
+    2ca3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2ca8:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+    2cac:	48 89 f0             	mov    %rsi,%rax
+    2caf:	ba 00 00 00 00       	mov    $0x0,%edx
+    2cb4:	48 89 df             	mov    %rbx,%rdi
+    2cb7:	48 0f af f8          	imul   %rax,%rdi
+    2cbb:	48 89 d6             	mov    %rdx,%rsi
+    2cbe:	48 0f af f1          	imul   %rcx,%rsi
+    2cc2:	48 01 fe             	add    %rdi,%rsi
+    2cc5:	48 f7 e1             	mul    %rcx
+    2cc8:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+    2ccc:	48 89 ca             	mov    %rcx,%rdx
+    2ccf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2cd3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2cd7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2cdb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return Wide{Word(r), Word(r >> 64)};
+    2cdf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2ce3:	49 89 c0             	mov    %rax,%r8
+    2ce6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2cea:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2cee:	48 89 d0             	mov    %rdx,%rax
+    2cf1:	31 d2                	xor    %edx,%edx
+    2cf3:	49 89 c1             	mov    %rax,%r9
+    2cf6:	4c 89 c0             	mov    %r8,%rax
+    2cf9:	4c 89 ca             	mov    %r9,%rdx
+    Word const hl = a_hi * b_lo;
+    Word const hh = a_hi * b_hi;
+    Word const mid = (ll >> 32) + (lh & 0xFFFFFFFFULL) + (hl & 0xFFFFFFFFULL);
+    return Wide{(mid << 32) | (ll & 0xFFFFFFFFULL), hh + (lh >> 32) + (hl >> 32) + (mid >> 32)};
+#endif
+}
+    2cfc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2d00:	c9                   	leave
+    2d01:	c3                   	ret
+
+0000000000002d02 <nel::(anonymous namespace)::Binary::operator==(nel::(anonymous namespace)::Binary const&) const>:
+struct Binary
+{
+        Word mantissa;
+        int power2;
+
+        bool operator==(Binary const &o) const
+    2d02:	       55                   	push   %rbp
+    2d03:	       48 89 e5             	mov    %rsp,%rbp
+    2d06:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2d0a:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            return mantissa == o.mantissa && power2 == o.power2;
+    2d0e:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d12:	       48 8b 10             	mov    (%rax),%rdx
+    2d15:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2d19:	       48 8b 00             	mov    (%rax),%rax
+    2d1c:	       48 39 c2             	cmp    %rax,%rdx
+    2d1f:	/----- 75 19                	jne    2d3a <nel::(anonymous namespace)::Binary::operator==(nel::(anonymous namespace)::Binary const&) const+0x38>
+    2d21:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d25:	|      8b 50 08             	mov    0x8(%rax),%edx
+    2d28:	|      48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2d2c:	|      8b 40 08             	mov    0x8(%rax),%eax
+    2d2f:	|      39 c2                	cmp    %eax,%edx
+    2d31:	+----- 75 07                	jne    2d3a <nel::(anonymous namespace)::Binary::operator==(nel::(anonymous namespace)::Binary const&) const+0x38>
+    2d33:	|      b8 01 00 00 00       	mov    $0x1,%eax
+    2d38:	|  /-- eb 05                	jmp    2d3f <nel::(anonymous namespace)::Binary::operator==(nel::(anonymous namespace)::Binary const&) const+0x3d>
+    2d3a:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    2d3f:	   \-> 5d                   	pop    %rbp
+    2d40:	       c3                   	ret
+
+0000000000002d41 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)>:
+// The double nearest w * 10^q (Eisel-Lemire).
+// w * 5^q is approximated by the 64x128 product of w with the top of pow5_128,
+// which always has enough correct bits to round from (Mushtak & Lemire),
+// and the power of 2 of 10^q = 5^q * 2^q is added to the exponent.
+Binary compute_float(long long int const q, Word w)
+{
+    2d41:	          55                   	push   %rbp
+    2d42:	          48 89 e5             	mov    %rsp,%rbp
+    2d45:	          41 55                	push   %r13
+    2d47:	          41 54                	push   %r12
+    2d49:	          48 83 ec 60          	sub    $0x60,%rsp
+    2d4d:	          48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    2d51:	          48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    if (w == 0 || q < pow5_min) { return Binary{0, 0}; }
+    2d55:	          48 83 7d 90 00       	cmpq   $0x0,-0x70(%rbp)
+    2d5a:	      /-- 74 0a                	je     2d66 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x25>
+    2d5c:	      |   48 81 7d 98 aa fe ff 	cmpq   $0xfffffffffffffeaa,-0x68(%rbp)
+    2d63:	      |   ff 
+    2d64:	   /--|-- 7d 1e                	jge    2d84 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x43>
+    2d66:	   |  \-> 41 bc 00 00 00 00    	mov    $0x0,%r12d
+    2d6c:	   |      4c 89 ea             	mov    %r13,%rdx
+    2d6f:	   |      48 b8 00 00 00 00 ff 	movabs $0xffffffff00000000,%rax
+    2d76:	   |      ff ff ff 
+    2d79:	   |      48 21 d0             	and    %rdx,%rax
+    2d7c:	   |      49 89 c5             	mov    %rax,%r13
+    2d7f:	/--|----- e9 a7 02 00 00       	jmp    302b <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x2ea>
+    if (q > pow5_max) { return Binary{0, infinite_power}; }
+    2d84:	|  \----> 48 81 7d 98 34 01 00 	cmpq   $0x134,-0x68(%rbp)
+    2d8b:	|         00 
+    2d8c:	|     /-- 7e 24                	jle    2db2 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x71>
+    2d8e:	|     |   41 bc 00 00 00 00    	mov    $0x0,%r12d
+    2d94:	|     |   4c 89 ea             	mov    %r13,%rdx
+    2d97:	|     |   48 b8 00 00 00 00 ff 	movabs $0xffffffff00000000,%rax
+    2d9e:	|     |   ff ff ff 
+    2da1:	|     |   48 21 d0             	and    %rdx,%rax
+    2da4:	|     |   48 0d ff 07 00 00    	or     $0x7ff,%rax
+    2daa:	|     |   49 89 c5             	mov    %rax,%r13
+    2dad:	+-----|-- e9 79 02 00 00       	jmp    302b <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x2ea>
+
+    int const lz = __builtin_clzll(w);
+    2db2:	|     \-> 48 0f bd 45 90       	bsr    -0x70(%rbp),%rax
+    2db7:	|         48 83 f0 3f          	xor    $0x3f,%rax
+    2dbb:	|         89 45 ec             	mov    %eax,-0x14(%rbp)
+    w <<= lz;
+    2dbe:	|         8b 45 ec             	mov    -0x14(%rbp),%eax
+    2dc1:	|         89 c1                	mov    %eax,%ecx
+    2dc3:	|         48 d3 65 90          	shlq   %cl,-0x70(%rbp)
+
+    Index const k = Index(2 * (q - pow5_min));
+    2dc7:	|         48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2dcb:	|         48 05 56 01 00 00    	add    $0x156,%rax
+    2dd1:	|         48 01 c0             	add    %rax,%rax
+    2dd4:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    Wide p = mul_wide(w, pow5_128[k]);
+    2dd8:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2ddc:	|         48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2de3:	|         00 
+    2de4:	|         48 8d 05 f5 24 00 00 	lea    0x24f5(%rip),%rax        # 52e0 <nel::(anonymous namespace)::pow5_128>
+    2deb:	|         48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    2def:	|         48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2df3:	|         48 89 d6             	mov    %rdx,%rsi
+    2df6:	|         48 89 c7             	mov    %rax,%rdi
+    2df9:	|         e8 91 fe ff ff       	call   2c8f <nel::(anonymous namespace)::mul_wide(unsigned long long, unsigned long long)>
+    2dfe:	|         48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    2e02:	|         48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    // only the top 55 bits are needed, the low word only matters if they might carry.
+    Word const precision_mask = ~0ULL >> (mantissa_bits + 3);
+    2e06:	|         48 c7 45 d8 ff 01 00 	movq   $0x1ff,-0x28(%rbp)
+    2e0d:	|         00 
+    if ((p.hi & precision_mask) == precision_mask) {
+    2e0e:	|         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2e12:	|         25 ff 01 00 00       	and    $0x1ff,%eax
+    2e17:	|         48 3d ff 01 00 00    	cmp    $0x1ff,%rax
+    2e1d:	|     /-- 75 5a                	jne    2e79 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x138>
+        Wide const p2 = mul_wide(w, pow5_128[k + 1]);
+    2e1f:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2e23:	|     |   48 83 c0 01          	add    $0x1,%rax
+    2e27:	|     |   48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2e2e:	|     |   00 
+    2e2f:	|     |   48 8d 05 aa 24 00 00 	lea    0x24aa(%rip),%rax        # 52e0 <nel::(anonymous namespace)::pow5_128>
+    2e36:	|     |   48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    2e3a:	|     |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2e3e:	|     |   48 89 d6             	mov    %rdx,%rsi
+    2e41:	|     |   48 89 c7             	mov    %rax,%rdi
+    2e44:	|     |   e8 46 fe ff ff       	call   2c8f <nel::(anonymous namespace)::mul_wide(unsigned long long, unsigned long long)>
+    2e49:	|     |   48 89 45 a0          	mov    %rax,-0x60(%rbp)
+    2e4d:	|     |   48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+        p.lo += p2.hi;
+    2e51:	|     |   48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    2e55:	|     |   48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2e59:	|     |   48 01 d0             	add    %rdx,%rax
+    2e5c:	|     |   48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        if (p2.hi > p.lo) { p.hi += 1; }
+    2e60:	|     |   48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2e64:	|     |   48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    2e68:	|     |   48 39 c2             	cmp    %rax,%rdx
+    2e6b:	|     +-- 73 0c                	jae    2e79 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x138>
+    2e6d:	|     |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2e71:	|     |   48 83 c0 01          	add    $0x1,%rax
+    2e75:	|     |   48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    }
+
+    int const upperbit = int(p.hi >> 63);
+    2e79:	|     \-> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2e7d:	|         48 c1 e8 3f          	shr    $0x3f,%rax
+    2e81:	|         89 45 d4             	mov    %eax,-0x2c(%rbp)
+    int const shift = upperbit + 64 - mantissa_bits - 3;
+    2e84:	|         8b 45 d4             	mov    -0x2c(%rbp),%eax
+    2e87:	|         83 c0 09             	add    $0x9,%eax
+    2e8a:	|         89 45 d0             	mov    %eax,-0x30(%rbp)
+    Binary r;
+    r.mantissa = p.hi >> shift;
+    2e8d:	|         48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    2e91:	|         8b 45 d0             	mov    -0x30(%rbp),%eax
+    2e94:	|         89 c1                	mov    %eax,%ecx
+    2e96:	|         48 d3 ea             	shr    %cl,%rdx
+    2e99:	|         48 89 d0             	mov    %rdx,%rax
+    2e9c:	|         48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    // floor(log2(10^q)) + 63, + the bias.
+    r.power2 = int((((152170 + 65536) * q) >> 16) + 63) + upperbit - lz + 1023;
+    2ea0:	|         48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2ea4:	|         48 69 c0 6a 52 03 00 	imul   $0x3526a,%rax,%rax
+    2eab:	|         48 c1 f8 10          	sar    $0x10,%rax
+    2eaf:	|         89 c2                	mov    %eax,%edx
+    2eb1:	|         8b 45 d4             	mov    -0x2c(%rbp),%eax
+    2eb4:	|         01 c2                	add    %eax,%edx
+    2eb6:	|         8b 45 ec             	mov    -0x14(%rbp),%eax
+    2eb9:	|         29 c2                	sub    %eax,%edx
+    2ebb:	|         8d 82 3e 04 00 00    	lea    0x43e(%rdx),%eax
+    2ec1:	|         89 45 b8             	mov    %eax,-0x48(%rbp)
+
+    if (r.power2 <= 0) {
+    2ec4:	|         8b 45 b8             	mov    -0x48(%rbp),%eax
+    2ec7:	|         85 c0                	test   %eax,%eax
+    2ec9:	|  /----- 0f 8f 89 00 00 00    	jg     2f58 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x217>
+        // subnormal, or zero.
+        if (-r.power2 + 1 >= 64) { return Binary{0, 0}; }
+    2ecf:	|  |      8b 45 b8             	mov    -0x48(%rbp),%eax
+    2ed2:	|  |      ba 01 00 00 00       	mov    $0x1,%edx
+    2ed7:	|  |      29 c2                	sub    %eax,%edx
+    2ed9:	|  |      83 fa 3f             	cmp    $0x3f,%edx
+    2edc:	|  |  /-- 7e 1e                	jle    2efc <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x1bb>
+    2ede:	|  |  |   41 bc 00 00 00 00    	mov    $0x0,%r12d
+    2ee4:	|  |  |   4c 89 ea             	mov    %r13,%rdx
+    2ee7:	|  |  |   48 b8 00 00 00 00 ff 	movabs $0xffffffff00000000,%rax
+    2eee:	|  |  |   ff ff ff 
+    2ef1:	|  |  |   48 21 d0             	and    %rdx,%rax
+    2ef4:	|  |  |   49 89 c5             	mov    %rax,%r13
+    2ef7:	+--|--|-- e9 2f 01 00 00       	jmp    302b <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x2ea>
+        r.mantissa >>= -r.power2 + 1;
+    2efc:	|  |  \-> 48 8b 75 b0          	mov    -0x50(%rbp),%rsi
+    2f00:	|  |      8b 45 b8             	mov    -0x48(%rbp),%eax
+    2f03:	|  |      ba 01 00 00 00       	mov    $0x1,%edx
+    2f08:	|  |      29 c2                	sub    %eax,%edx
+    2f0a:	|  |      48 89 f0             	mov    %rsi,%rax
+    2f0d:	|  |      89 d1                	mov    %edx,%ecx
+    2f0f:	|  |      48 d3 e8             	shr    %cl,%rax
+    2f12:	|  |      48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        r.mantissa += (r.mantissa & 1);
+    2f16:	|  |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2f1a:	|  |      48 83 c0 01          	add    $0x1,%rax
+    2f1e:	|  |      48 83 e0 fe          	and    $0xfffffffffffffffe,%rax
+    2f22:	|  |      48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        r.mantissa >>= 1;
+    2f26:	|  |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2f2a:	|  |      48 d1 e8             	shr    %rax
+    2f2d:	|  |      48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        // rounding up may have made it the smallest normal.
+        r.power2 = (r.mantissa < (1ULL << mantissa_bits)) ? 0 : 1;
+    2f31:	|  |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2f35:	|  |      48 ba ff ff ff ff ff 	movabs $0xfffffffffffff,%rdx
+    2f3c:	|  |      ff 0f 00 
+    2f3f:	|  |      48 39 c2             	cmp    %rax,%rdx
+    2f42:	|  |      0f 92 c0             	setb   %al
+    2f45:	|  |      0f b6 c0             	movzbl %al,%eax
+    2f48:	|  |      89 45 b8             	mov    %eax,-0x48(%rbp)
+        return r;
+    2f4b:	|  |      4c 8b 65 b0          	mov    -0x50(%rbp),%r12
+    2f4f:	|  |      4c 8b 6d b8          	mov    -0x48(%rbp),%r13
+    2f53:	+--|----- e9 d3 00 00 00       	jmp    302b <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x2ea>
+    }
+
+    // exactly half way between two doubles rounds to even, not up.
+    // Only possible where 5^q is exact in the table, small q.
+    if (p.lo <= 1 && q >= -4 && q <= 23 && (r.mantissa & 3) == 1 &&
+    2f58:	|  \----> 48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2f5c:	|         48 83 f8 01          	cmp    $0x1,%rax
+    2f60:	|     /-- 77 3c                	ja     2f9e <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x25d>
+    2f62:	|     |   48 83 7d 98 fc       	cmpq   $0xfffffffffffffffc,-0x68(%rbp)
+    2f67:	|     +-- 7c 35                	jl     2f9e <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x25d>
+    2f69:	|     |   48 83 7d 98 17       	cmpq   $0x17,-0x68(%rbp)
+    2f6e:	|     +-- 7f 2e                	jg     2f9e <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x25d>
+    2f70:	|     |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2f74:	|     |   83 e0 03             	and    $0x3,%eax
+    2f77:	|     |   48 83 f8 01          	cmp    $0x1,%rax
+    2f7b:	|     +-- 75 21                	jne    2f9e <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x25d>
+        (r.mantissa << shift) == p.hi) {
+    2f7d:	|     |   48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    2f81:	|     |   8b 45 d0             	mov    -0x30(%rbp),%eax
+    2f84:	|     |   89 c1                	mov    %eax,%ecx
+    2f86:	|     |   48 d3 e2             	shl    %cl,%rdx
+    2f89:	|     |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    if (p.lo <= 1 && q >= -4 && q <= 23 && (r.mantissa & 3) == 1 &&
+    2f8d:	|     |   48 39 c2             	cmp    %rax,%rdx
+    2f90:	|     +-- 75 0c                	jne    2f9e <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x25d>
+        r.mantissa &= ~1ULL;
+    2f92:	|     |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2f96:	|     |   48 83 e0 fe          	and    $0xfffffffffffffffe,%rax
+    2f9a:	|     |   48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    }
+
+    r.mantissa += (r.mantissa & 1);
+    2f9e:	|     \-> 48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2fa2:	|         48 83 c0 01          	add    $0x1,%rax
+    2fa6:	|         48 83 e0 fe          	and    $0xfffffffffffffffe,%rax
+    2faa:	|         48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    r.mantissa >>= 1;
+    2fae:	|         48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2fb2:	|         48 d1 e8             	shr    %rax
+    2fb5:	|         48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    if (r.mantissa >= (2ULL << mantissa_bits)) {
+    2fb9:	|         48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2fbd:	|         48 ba ff ff ff ff ff 	movabs $0x1fffffffffffff,%rdx
+    2fc4:	|         ff 1f 00 
+    2fc7:	|         48 39 c2             	cmp    %rax,%rdx
+    2fca:	|     /-- 73 17                	jae    2fe3 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x2a2>
+        r.mantissa = 1ULL << mantissa_bits;
+    2fcc:	|     |   48 b8 00 00 00 00 00 	movabs $0x10000000000000,%rax
+    2fd3:	|     |   00 10 00 
+    2fd6:	|     |   48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        r.power2 += 1;
+    2fda:	|     |   8b 45 b8             	mov    -0x48(%rbp),%eax
+    2fdd:	|     |   83 c0 01             	add    $0x1,%eax
+    2fe0:	|     |   89 45 b8             	mov    %eax,-0x48(%rbp)
+    }
+    r.mantissa &= ~(1ULL << mantissa_bits);
+    2fe3:	|     \-> 48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2fe7:	|         48 ba ff ff ff ff ff 	movabs $0xffefffffffffffff,%rdx
+    2fee:	|         ff ef ff 
+    2ff1:	|         48 21 d0             	and    %rdx,%rax
+    2ff4:	|         48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    if (r.power2 >= infinite_power) { return Binary{0, infinite_power}; }
+    2ff8:	|         8b 45 b8             	mov    -0x48(%rbp),%eax
+    2ffb:	|         3d fe 07 00 00       	cmp    $0x7fe,%eax
+    3000:	|     /-- 7e 21                	jle    3023 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x2e2>
+    3002:	|     |   41 bc 00 00 00 00    	mov    $0x0,%r12d
+    3008:	|     |   4c 89 ea             	mov    %r13,%rdx
+    300b:	|     |   48 b8 00 00 00 00 ff 	movabs $0xffffffff00000000,%rax
+    3012:	|     |   ff ff ff 
+    3015:	|     |   48 21 d0             	and    %rdx,%rax
+    3018:	|     |   48 0d ff 07 00 00    	or     $0x7ff,%rax
+    301e:	|     |   49 89 c5             	mov    %rax,%r13
+    3021:	+-----|-- eb 08                	jmp    302b <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x2ea>
+    return r;
+    3023:	|     \-> 4c 8b 65 b0          	mov    -0x50(%rbp),%r12
+    3027:	|         4c 8b 6d b8          	mov    -0x48(%rbp),%r13
+}
+    302b:	\-------> 4c 89 e0             	mov    %r12,%rax
+    302e:	          4c 89 ea             	mov    %r13,%rdx
+    3031:	          48 83 c4 60          	add    $0x60,%rsp
+    3035:	          41 5c                	pop    %r12
+    3037:	          41 5d                	pop    %r13
+    3039:	          5d                   	pop    %rbp
+    303a:	          c3                   	ret
+
+000000000000303b <nel::(anonymous namespace)::to_double(nel::(anonymous namespace)::Binary const&, bool)>:
+
+double to_double(Binary const &b, bool const neg)
+{
+    303b:	55                   	push   %rbp
+    303c:	48 89 e5             	mov    %rsp,%rbp
+    303f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3043:	89 f0                	mov    %esi,%eax
+    3045:	88 45 e4             	mov    %al,-0x1c(%rbp)
+    Word const bits = b.mantissa | (Word(b.power2) << mantissa_bits) | (Word(neg) << 63);
+    3048:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    304c:	48 8b 10             	mov    (%rax),%rdx
+    304f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3053:	8b 40 08             	mov    0x8(%rax),%eax
+    3056:	48 98                	cltq
+    3058:	48 c1 e0 34          	shl    $0x34,%rax
+    305c:	48 09 c2             	or     %rax,%rdx
+    305f:	0f b6 45 e4          	movzbl -0x1c(%rbp),%eax
+    3063:	48 c1 e0 3f          	shl    $0x3f,%rax
+    3067:	48 09 d0             	or     %rdx,%rax
+    306a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    double d;
+    __builtin_memcpy(&d, &bits, sizeof(d));
+    306e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3072:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    return d;
+    3076:	f2 0f 10 45 f0       	movsd  -0x10(%rbp),%xmm0
+    307b:	66 48 0f 7e c0       	movq   %xmm0,%rax
+}
+    3080:	66 48 0f 6e c0       	movq   %rax,%xmm0
+    3085:	5d                   	pop    %rbp
+    3086:	c3                   	ret
+    3087:	90                   	nop
+
+0000000000003088 <nel::(anonymous namespace)::Digits::operator[](unsigned long) const>:
+        unsigned char const *a;
+        Length an;
+        unsigned char const *b;
+        Length bn;
+
+        unsigned char operator[](Index const i) const
+    3088:	       55                   	push   %rbp
+    3089:	       48 89 e5             	mov    %rsp,%rbp
+    308c:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3090:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            return (i < an) ? a[i] : b[i - an];
+    3094:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3098:	       48 8b 40 08          	mov    0x8(%rax),%rax
+    309c:	       48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    30a0:	   /-- 73 13                	jae    30b5 <nel::(anonymous namespace)::Digits::operator[](unsigned long) const+0x2d>
+    30a2:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30a6:	   |   48 8b 10             	mov    (%rax),%rdx
+    30a9:	   |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    30ad:	   |   48 01 d0             	add    %rdx,%rax
+    30b0:	   |   0f b6 00             	movzbl (%rax),%eax
+    30b3:	/--|-- eb 1e                	jmp    30d3 <nel::(anonymous namespace)::Digits::operator[](unsigned long) const+0x4b>
+    30b5:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30b9:	|      48 8b 50 10          	mov    0x10(%rax),%rdx
+    30bd:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30c1:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    30c5:	|      48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    30c9:	|      48 29 c1             	sub    %rax,%rcx
+    30cc:	|      48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+    30d0:	|      0f b6 00             	movzbl (%rax),%eax
+        }
+    30d3:	\----> 5d                   	pop    %rbp
+    30d4:	       c3                   	ret
+
+00000000000030d5 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)>:
+
+// The double nearest digits * 10^q, for numbers too long for compute_float to round alone.
+// Enough leading digits to decide the rounding are passed to strtod,
+// with a '1' after them if any of the rest are not 0, to break ties the right way.
+__attribute__((noinline)) double slow_path(Digits const &ds, long long int q)
+{
+    30d5:	             55                   	push   %rbp
+    30d6:	             48 89 e5             	mov    %rsp,%rbp
+    30d9:	             48 81 ec 90 03 00 00 	sub    $0x390,%rsp
+    30e0:	             48 89 bd 78 fc ff ff 	mov    %rdi,-0x388(%rbp)
+    30e7:	             48 89 b5 70 fc ff ff 	mov    %rsi,-0x390(%rbp)
+    constexpr Length max_digits = 768;
+    30ee:	             48 c7 45 d8 00 03 00 	movq   $0x300,-0x28(%rbp)
+    30f5:	             00 
+    char buf[max_digits + 32];
+    Length const n = ds.an + ds.bn;
+    30f6:	             48 8b 85 78 fc ff ff 	mov    -0x388(%rbp),%rax
+    30fd:	             48 8b 50 08          	mov    0x8(%rax),%rdx
+    3101:	             48 8b 85 78 fc ff ff 	mov    -0x388(%rbp),%rax
+    3108:	             48 8b 40 18          	mov    0x18(%rax),%rax
+    310c:	             48 01 d0             	add    %rdx,%rax
+    310f:	             48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    Length const kept = (n < max_digits) ? n : max_digits;
+    3113:	             48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3117:	             ba 00 03 00 00       	mov    $0x300,%edx
+    311c:	             48 39 d0             	cmp    %rdx,%rax
+    311f:	             48 0f 47 c2          	cmova  %rdx,%rax
+    3123:	             48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    Index o = 0;
+    3127:	             48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    312e:	             00 
+    for (Index i = 0; i < kept; ++i) {
+    312f:	             48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    3136:	             00 
+    3137:	         /-- eb 30                	jmp    3169 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x94>
+        buf[o++] = char(ds[i]);
+    3139:	      /--|-> 48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    313d:	      |  |   48 8b 85 78 fc ff ff 	mov    -0x388(%rbp),%rax
+    3144:	      |  |   48 89 d6             	mov    %rdx,%rsi
+    3147:	      |  |   48 89 c7             	mov    %rax,%rdi
+    314a:	      |  |   e8 39 ff ff ff       	call   3088 <nel::(anonymous namespace)::Digits::operator[](unsigned long) const>
+    314f:	      |  |   89 c1                	mov    %eax,%ecx
+    3151:	      |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3155:	      |  |   48 8d 50 01          	lea    0x1(%rax),%rdx
+    3159:	      |  |   48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    315d:	      |  |   88 8c 05 a0 fc ff ff 	mov    %cl,-0x360(%rbp,%rax,1)
+    for (Index i = 0; i < kept; ++i) {
+    3164:	      |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    3169:	      |  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    316d:	      |      48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+    3171:	      \----- 72 c6                	jb     3139 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x64>
+    }
+    q += (long long int)(n - kept);
+    3173:	             48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3177:	             48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    317b:	             48 01 85 70 fc ff ff 	add    %rax,-0x390(%rbp)
+    for (Index i = kept; i < n; ++i) {
+    3182:	             48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3186:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    318a:	   /-------- eb 42                	jmp    31ce <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0xf9>
+        if (ds[i] != '0') {
+    318c:	/--|-------> 48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3190:	|  |         48 8b 85 78 fc ff ff 	mov    -0x388(%rbp),%rax
+    3197:	|  |         48 89 d6             	mov    %rdx,%rsi
+    319a:	|  |         48 89 c7             	mov    %rax,%rdi
+    319d:	|  |         e8 e6 fe ff ff       	call   3088 <nel::(anonymous namespace)::Digits::operator[](unsigned long) const>
+    31a2:	|  |         3c 30                	cmp    $0x30,%al
+    31a4:	|  |         0f 95 c0             	setne  %al
+    31a7:	|  |         84 c0                	test   %al,%al
+    31a9:	|  |  /----- 74 1e                	je     31c9 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0xf4>
+            buf[o++] = '1';
+    31ab:	|  |  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31af:	|  |  |      48 8d 50 01          	lea    0x1(%rax),%rdx
+    31b3:	|  |  |      48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    31b7:	|  |  |      c6 84 05 a0 fc ff ff 	movb   $0x31,-0x360(%rbp,%rax,1)
+    31be:	|  |  |      31 
+            q -= 1;
+    31bf:	|  |  |      48 83 ad 70 fc ff ff 	subq   $0x1,-0x390(%rbp)
+    31c6:	|  |  |      01 
+            break;
+    31c7:	|  |  |  /-- eb 0f                	jmp    31d8 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x103>
+    for (Index i = kept; i < n; ++i) {
+    31c9:	|  |  \--|-> 48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    31ce:	|  \-----|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31d2:	|        |   48 3b 45 d0          	cmp    -0x30(%rbp),%rax
+    31d6:	\--------|-- 72 b4                	jb     318c <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0xb7>
+        }
+    }
+    buf[o++] = 'e';
+    31d8:	         \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31dc:	             48 8d 50 01          	lea    0x1(%rax),%rdx
+    31e0:	             48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    31e4:	             c6 84 05 a0 fc ff ff 	movb   $0x65,-0x360(%rbp,%rax,1)
+    31eb:	             65 
+    if (q < 0) {
+    31ec:	             48 83 bd 70 fc ff ff 	cmpq   $0x0,-0x390(%rbp)
+    31f3:	             00 
+    31f4:	         /-- 79 1b                	jns    3211 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x13c>
+        buf[o++] = '-';
+    31f6:	         |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31fa:	         |   48 8d 50 01          	lea    0x1(%rax),%rdx
+    31fe:	         |   48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    3202:	         |   c6 84 05 a0 fc ff ff 	movb   $0x2d,-0x360(%rbp,%rax,1)
+    3209:	         |   2d 
+        q = -q;
+    320a:	         |   48 f7 9d 70 fc ff ff 	negq   -0x390(%rbp)
+    }
+    char e[24];
+    Index en = 0;
+    3211:	         \-> 48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+    3218:	             00 
+    do {
+        e[en++] = char('0' + q % 10);
+    3219:	         /-> 48 8b 8d 70 fc ff ff 	mov    -0x390(%rbp),%rcx
+    3220:	         |   48 ba 67 66 66 66 66 	movabs $0x6666666666666667,%rdx
+    3227:	         |   66 66 66 
+    322a:	         |   48 89 c8             	mov    %rcx,%rax
+    322d:	         |   48 f7 ea             	imul   %rdx
+    3230:	         |   48 c1 fa 02          	sar    $0x2,%rdx
+    3234:	         |   48 89 c8             	mov    %rcx,%rax
+    3237:	         |   48 c1 f8 3f          	sar    $0x3f,%rax
+    323b:	         |   48 29 c2             	sub    %rax,%rdx
+    323e:	         |   48 89 d0             	mov    %rdx,%rax
+    3241:	         |   48 c1 e0 02          	shl    $0x2,%rax
+    3245:	         |   48 01 d0             	add    %rdx,%rax
+    3248:	         |   48 01 c0             	add    %rax,%rax
+    324b:	         |   48 29 c1             	sub    %rax,%rcx
+    324e:	         |   48 89 ca             	mov    %rcx,%rdx
+    3251:	         |   89 d0                	mov    %edx,%eax
+    3253:	         |   83 c0 30             	add    $0x30,%eax
+    3256:	         |   89 c1                	mov    %eax,%ecx
+    3258:	         |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    325c:	         |   48 8d 50 01          	lea    0x1(%rax),%rdx
+    3260:	         |   48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    3264:	         |   88 8c 05 80 fc ff ff 	mov    %cl,-0x380(%rbp,%rax,1)
+        q /= 10;
+    326b:	         |   48 8b 8d 70 fc ff ff 	mov    -0x390(%rbp),%rcx
+    3272:	         |   48 ba 67 66 66 66 66 	movabs $0x6666666666666667,%rdx
+    3279:	         |   66 66 66 
+    327c:	         |   48 89 c8             	mov    %rcx,%rax
+    327f:	         |   48 f7 ea             	imul   %rdx
+    3282:	         |   48 89 d0             	mov    %rdx,%rax
+    3285:	         |   48 c1 f8 02          	sar    $0x2,%rax
+    3289:	         |   48 c1 f9 3f          	sar    $0x3f,%rcx
+    328d:	         |   48 89 ca             	mov    %rcx,%rdx
+    3290:	         |   48 29 d0             	sub    %rdx,%rax
+    3293:	         |   48 89 85 70 fc ff ff 	mov    %rax,-0x390(%rbp)
+    } while (q != 0);
+    329a:	         |   48 83 bd 70 fc ff ff 	cmpq   $0x0,-0x390(%rbp)
+    32a1:	         |   00 
+    32a2:	         \-- 0f 85 71 ff ff ff    	jne    3219 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x144>
+    while (en > 0) {
+    32a8:	         /-- eb 29                	jmp    32d3 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x1fe>
+        buf[o++] = e[--en];
+    32aa:	      /--|-> 48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+    32af:	      |  |   48 8d 95 80 fc ff ff 	lea    -0x380(%rbp),%rdx
+    32b6:	      |  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    32ba:	      |  |   48 01 d0             	add    %rdx,%rax
+    32bd:	      |  |   0f b6 10             	movzbl (%rax),%edx
+    32c0:	      |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32c4:	      |  |   48 8d 48 01          	lea    0x1(%rax),%rcx
+    32c8:	      |  |   48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    32cc:	      |  |   88 94 05 a0 fc ff ff 	mov    %dl,-0x360(%rbp,%rax,1)
+    while (en > 0) {
+    32d3:	      |  \-> 48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    32d8:	      \----- 75 d0                	jne    32aa <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x1d5>
+    }
+    buf[o] = '\0';
+    32da:	             48 8d 95 a0 fc ff ff 	lea    -0x360(%rbp),%rdx
+    32e1:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32e5:	             48 01 d0             	add    %rdx,%rax
+    32e8:	             c6 00 00             	movb   $0x0,(%rax)
+    return std::strtod(buf, nullptr);
+    32eb:	             48 8d 85 a0 fc ff ff 	lea    -0x360(%rbp),%rax
+    32f2:	             be 00 00 00 00       	mov    $0x0,%esi
+    32f7:	             48 89 c7             	mov    %rax,%rdi
+    32fa:	             e8 41 dd ff ff       	call   1040 <strtod@plt>
+    32ff:	             66 48 0f 7e c0       	movq   %xmm0,%rax
+}
+    3304:	             66 48 0f 6e c0       	movq   %rax,%xmm0
+    3309:	             c9                   	leave
+    330a:	             c3                   	ret
+
+000000000000330b <nel::(anonymous namespace)::starts_with_word(unsigned char const*, unsigned long, char const*)>:
+
+// Case insensitive match of the lower case word at the start of p[0..n).
+bool starts_with_word(unsigned char const p[], Length const n, char const *const word)
+{
+    330b:	             55                   	push   %rbp
+    330c:	             48 89 e5             	mov    %rsp,%rbp
+    330f:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3313:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    3317:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    Index i = 0;
+    331b:	             48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    3322:	             00 
+    for (; word[i] != '\0'; ++i) {
+    3323:	   /-------- eb 3b                	jmp    3360 <nel::(anonymous namespace)::starts_with_word(unsigned char const*, unsigned long, char const*)+0x55>
+        if (i >= n || (p[i] | 0x20) != (unsigned char)word[i]) { return false; }
+    3325:	/--|-------> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3329:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    332d:	|  |  /----- 73 25                	jae    3354 <nel::(anonymous namespace)::starts_with_word(unsigned char const*, unsigned long, char const*)+0x49>
+    332f:	|  |  |      48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3333:	|  |  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3337:	|  |  |      48 01 d0             	add    %rdx,%rax
+    333a:	|  |  |      0f b6 00             	movzbl (%rax),%eax
+    333d:	|  |  |      83 c8 20             	or     $0x20,%eax
+    3340:	|  |  |      89 c1                	mov    %eax,%ecx
+    3342:	|  |  |      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    3346:	|  |  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    334a:	|  |  |      48 01 d0             	add    %rdx,%rax
+    334d:	|  |  |      0f b6 00             	movzbl (%rax),%eax
+    3350:	|  |  |      38 c1                	cmp    %al,%cl
+    3352:	|  |  |  /-- 74 07                	je     335b <nel::(anonymous namespace)::starts_with_word(unsigned char const*, unsigned long, char const*)+0x50>
+    3354:	|  |  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3359:	|  |  /--|-- eb 1c                	jmp    3377 <nel::(anonymous namespace)::starts_with_word(unsigned char const*, unsigned long, char const*)+0x6c>
+    for (; word[i] != '\0'; ++i) {
+    335b:	|  |  |  \-> 48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    3360:	|  \--|----> 48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    3364:	|     |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3368:	|     |      48 01 d0             	add    %rdx,%rax
+    336b:	|     |      0f b6 00             	movzbl (%rax),%eax
+    336e:	|     |      84 c0                	test   %al,%al
+    3370:	\-----|----- 75 b3                	jne    3325 <nel::(anonymous namespace)::starts_with_word(unsigned char const*, unsigned long, char const*)+0x1a>
+    }
+    return true;
+    3372:	      |      b8 01 00 00 00       	mov    $0x1,%eax
+}
+    3377:	      \----> 5d                   	pop    %rbp
+    3378:	             c3                   	ret
+
+0000000000003379 <nel::parse_u64(nel::Slice<unsigned char const> const&)>:
+
+} // namespace
+
+Result<Pair<long long unsigned int, Length>, ParseError>
+parse_u64(Slice<unsigned char const> const &s)
+{
+    3379:	55                   	push   %rbp
+    337a:	48 89 e5             	mov    %rsp,%rbp
+    337d:	53                   	push   %rbx
+    337e:	48 83 ec 18          	sub    $0x18,%rsp
+    3382:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3386:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    return parse_magnitude(s.ptr(), s.len());
+    338a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    338e:	48 89 c7             	mov    %rax,%rdi
+    3391:	e8 90 0c 00 00       	call   4026 <nel::Slice<unsigned char const>::len() const>
+    3396:	48 89 c3             	mov    %rax,%rbx
+    3399:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    339d:	48 89 c7             	mov    %rax,%rdi
+    33a0:	e8 35 0e 00 00       	call   41da <nel::Slice<unsigned char const>::ptr() const>
+    33a5:	48 89 c1             	mov    %rax,%rcx
+    33a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    33ac:	48 89 da             	mov    %rbx,%rdx
+    33af:	48 89 ce             	mov    %rcx,%rsi
+    33b2:	48 89 c7             	mov    %rax,%rdi
+    33b5:	e8 b4 f6 ff ff       	call   2a6e <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)>
+}
+    33ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    33be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    33c2:	c9                   	leave
+    33c3:	c3                   	ret
+
+00000000000033c4 <nel::parse_i64(nel::Slice<unsigned char const> const&)>:
+
+Result<Pair<long long int, Length>, ParseError> parse_i64(Slice<unsigned char const> const &s)
+{
+    33c4:	                55                   	push   %rbp
+    33c5:	                48 89 e5             	mov    %rsp,%rbp
+    33c8:	                48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+    33cf:	                48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+    33d6:	                48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+    typedef Result<Pair<long long int, Length>, ParseError> R;
+    unsigned char const *const p = s.ptr();
+    33dd:	                48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+    33e4:	                48 89 c7             	mov    %rax,%rdi
+    33e7:	                e8 ee 0d 00 00       	call   41da <nel::Slice<unsigned char const>::ptr() const>
+    33ec:	                48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    Length const n = s.len();
+    33f0:	                48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+    33f7:	                48 89 c7             	mov    %rax,%rdi
+    33fa:	                e8 27 0c 00 00       	call   4026 <nel::Slice<unsigned char const>::len() const>
+    33ff:	                48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (n == 0) { return R::Err(ParseError::Empty); }
+    3403:	                48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    3408:	            /-- 75 28                	jne    3432 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x6e>
+    340a:	            |   c7 85 4c ff ff ff 01 	movl   $0x1,-0xb4(%rbp)
+    3411:	            |   00 00 00 
+    3414:	            |   48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+    341b:	            |   48 8d 95 4c ff ff ff 	lea    -0xb4(%rbp),%rdx
+    3422:	            |   48 89 d6             	mov    %rdx,%rsi
+    3425:	            |   48 89 c7             	mov    %rax,%rdi
+    3428:	            |   e8 be 0d 00 00       	call   41eb <nel::Result<nel::Pair<long long, unsigned long>, nel::ParseError>::Err(nel::ParseError&&)>
+    auto const v = m.unwrap();
+    Word const limit = neg ? (1ULL << 63) : (1ULL << 63) - 1;
+    if (v.first > limit) { return R::Err(ParseError::Overflow); }
+    long long int const r = neg ? (long long int)(0 - v.first) : (long long int)v.first;
+    return R::Ok(Pair<long long int, Length>{r, i + v.second});
+}
+    342d:	/-----------|-- e9 ee 01 00 00       	jmp    3620 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x25c>
+    bool const neg = p[0] == '-';
+    3432:	|           \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3436:	|               0f b6 00             	movzbl (%rax),%eax
+    3439:	|               3c 2d                	cmp    $0x2d,%al
+    343b:	|               0f 94 c0             	sete   %al
+    343e:	|               88 45 ef             	mov    %al,-0x11(%rbp)
+    Index const i = (neg || p[0] == '+') ? 1 : 0;
+    3441:	|               80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+    3445:	|           /-- 75 0b                	jne    3452 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x8e>
+    3447:	|           |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    344b:	|           |   0f b6 00             	movzbl (%rax),%eax
+    344e:	|           |   3c 2b                	cmp    $0x2b,%al
+    3450:	|        /--|-- 75 07                	jne    3459 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x95>
+    3452:	|        |  \-> b8 01 00 00 00       	mov    $0x1,%eax
+    3457:	|        |  /-- eb 05                	jmp    345e <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x9a>
+    3459:	|        \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    345e:	|           \-> 48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    auto m = parse_magnitude(p + i, n - i);
+    3462:	|               48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3466:	|               48 2b 45 e0          	sub    -0x20(%rbp),%rax
+    346a:	|               48 89 c2             	mov    %rax,%rdx
+    346d:	|               48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    3471:	|               48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3475:	|               48 01 c1             	add    %rax,%rcx
+    3478:	|               48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    347f:	|               48 89 ce             	mov    %rcx,%rsi
+    3482:	|               48 89 c7             	mov    %rax,%rdi
+    3485:	|               e8 e4 f5 ff ff       	call   2a6e <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)>
+    if (m.is_err()) {
+    348a:	|               48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+    3491:	|               b9 dc 03 00 00       	mov    $0x3dc,%ecx
+    3496:	|               48 8d 15 2a 47 00 00 	lea    0x472a(%rip),%rdx        # 7bc7 <nel::(anonymous namespace)::infinite_power+0x33>
+    349d:	|               48 8d 35 34 47 00 00 	lea    0x4734(%rip),%rsi        # 7bd8 <nel::(anonymous namespace)::infinite_power+0x44>
+    34a4:	|               48 89 c7             	mov    %rax,%rdi
+    34a7:	|               e8 34 eb ff ff       	call   1fe0 <nel::Context::Context(char const*, char const*, int)>
+    34ac:	|               48 8d 95 50 ff ff ff 	lea    -0xb0(%rbp),%rdx
+    34b3:	|               48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    34ba:	|               48 89 d6             	mov    %rdx,%rsi
+    34bd:	|               48 89 c7             	mov    %rax,%rdi
+    34c0:	|               e8 83 0d 00 00       	call   4248 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const>
+    34c5:	|               84 c0                	test   %al,%al
+    34c7:	|     /-------- 74 6c                	je     3535 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x171>
+        ParseError const e = m.unwrap_err();
+    34c9:	|     |         48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    34d0:	|     |         b9 dd 03 00 00       	mov    $0x3dd,%ecx
+    34d5:	|     |         48 8d 15 eb 46 00 00 	lea    0x46eb(%rip),%rdx        # 7bc7 <nel::(anonymous namespace)::infinite_power+0x33>
+    34dc:	|     |         48 8d 35 f5 46 00 00 	lea    0x46f5(%rip),%rsi        # 7bd8 <nel::(anonymous namespace)::infinite_power+0x44>
+    34e3:	|     |         48 89 c7             	mov    %rax,%rdi
+    34e6:	|     |         e8 f5 ea ff ff       	call   1fe0 <nel::Context::Context(char const*, char const*, int)>
+    34eb:	|     |         48 8d 95 70 ff ff ff 	lea    -0x90(%rbp),%rdx
+    34f2:	|     |         48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    34f9:	|     |         48 89 d6             	mov    %rdx,%rsi
+    34fc:	|     |         48 89 c7             	mov    %rax,%rdi
+    34ff:	|     |         e8 72 0b 00 00       	call   4076 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)>
+    3504:	|     |         89 45 cc             	mov    %eax,-0x34(%rbp)
+        return R::Err((e == ParseError::Empty) ? ParseError::InvalidDigit : e);
+    3507:	|     |         83 7d cc 01          	cmpl   $0x1,-0x34(%rbp)
+    350b:	|     |     /-- 74 05                	je     3512 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x14e>
+    350d:	|     |     |   8b 45 cc             	mov    -0x34(%rbp),%eax
+    3510:	|     |  /--|-- eb 05                	jmp    3517 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x153>
+    3512:	|     |  |  \-> b8 02 00 00 00       	mov    $0x2,%eax
+    3517:	|     |  \----> 89 45 8c             	mov    %eax,-0x74(%rbp)
+    351a:	|     |         48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+    3521:	|     |         48 8d 55 8c          	lea    -0x74(%rbp),%rdx
+    3525:	|     |         48 89 d6             	mov    %rdx,%rsi
+    3528:	|     |         48 89 c7             	mov    %rax,%rdi
+    352b:	|     |         e8 bb 0c 00 00       	call   41eb <nel::Result<nel::Pair<long long, unsigned long>, nel::ParseError>::Err(nel::ParseError&&)>
+    3530:	|  /--|-------- e9 dc 00 00 00       	jmp    3611 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x24d>
+    auto const v = m.unwrap();
+    3535:	|  |  \-------> 48 8d 45 90          	lea    -0x70(%rbp),%rax
+    3539:	|  |            b9 e1 03 00 00       	mov    $0x3e1,%ecx
+    353e:	|  |            48 8d 15 82 46 00 00 	lea    0x4682(%rip),%rdx        # 7bc7 <nel::(anonymous namespace)::infinite_power+0x33>
+    3545:	|  |            48 8d 35 8c 46 00 00 	lea    0x468c(%rip),%rsi        # 7bd8 <nel::(anonymous namespace)::infinite_power+0x44>
+    354c:	|  |            48 89 c7             	mov    %rax,%rdi
+    354f:	|  |            e8 8c ea ff ff       	call   1fe0 <nel::Context::Context(char const*, char const*, int)>
+    3554:	|  |            48 8d 55 90          	lea    -0x70(%rbp),%rdx
+    3558:	|  |            48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    355f:	|  |            48 89 d6             	mov    %rdx,%rsi
+    3562:	|  |            48 89 c7             	mov    %rax,%rdi
+    3565:	|  |            e8 8c eb ff ff       	call   20f6 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap(nel::Context const&)>
+    356a:	|  |            48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+    3571:	|  |            48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+    Word const limit = neg ? (1ULL << 63) : (1ULL << 63) - 1;
+    3578:	|  |            80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+    357c:	|  |     /----- 74 0c                	je     358a <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x1c6>
+    357e:	|  |     |      48 b8 00 00 00 00 00 	movabs $0x8000000000000000,%rax
+    3585:	|  |     |      00 00 80 
+    3588:	|  |     |  /-- eb 0a                	jmp    3594 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x1d0>
+    358a:	|  |     \--|-> 48 b8 ff ff ff ff ff 	movabs $0x7fffffffffffffff,%rax
+    3591:	|  |        |   ff ff 7f 
+    3594:	|  |        \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    if (v.first > limit) { return R::Err(ParseError::Overflow); }
+    3598:	|  |            48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    359f:	|  |            48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    35a3:	|  |        /-- 73 1f                	jae    35c4 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x200>
+    35a5:	|  |        |   c7 45 ac 03 00 00 00 	movl   $0x3,-0x54(%rbp)
+    35ac:	|  |        |   48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+    35b3:	|  |        |   48 8d 55 ac          	lea    -0x54(%rbp),%rdx
+    35b7:	|  |        |   48 89 d6             	mov    %rdx,%rsi
+    35ba:	|  |        |   48 89 c7             	mov    %rax,%rdi
+    35bd:	|  |        |   e8 29 0c 00 00       	call   41eb <nel::Result<nel::Pair<long long, unsigned long>, nel::ParseError>::Err(nel::ParseError&&)>
+    35c2:	|  +--------|-- eb 4d                	jmp    3611 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x24d>
+    long long int const r = neg ? (long long int)(0 - v.first) : (long long int)v.first;
+    35c4:	|  |        \-> 80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+    35c8:	|  |     /----- 74 0c                	je     35d6 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x212>
+    35ca:	|  |     |      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    35d1:	|  |     |      48 f7 d8             	neg    %rax
+    35d4:	|  |     |  /-- eb 07                	jmp    35dd <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x219>
+    35d6:	|  |     \--|-> 48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    35dd:	|  |        \-> 48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    return R::Ok(Pair<long long int, Length>{r, i + v.second});
+    35e1:	|  |            48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    35e5:	|  |            48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    35e9:	|  |            48 8b 95 28 ff ff ff 	mov    -0xd8(%rbp),%rdx
+    35f0:	|  |            48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    35f4:	|  |            48 01 d0             	add    %rdx,%rax
+    35f7:	|  |            48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    35fb:	|  |            48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+    3602:	|  |            48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    3606:	|  |            48 89 d6             	mov    %rdx,%rsi
+    3609:	|  |            48 89 c7             	mov    %rax,%rdi
+    360c:	|  |            e8 61 0c 00 00       	call   4272 <nel::Result<nel::Pair<long long, unsigned long>, nel::ParseError>::Ok(nel::Pair<long long, unsigned long>&&)>
+}
+    3611:	|  \----------> 48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    3618:	|               48 89 c7             	mov    %rax,%rdi
+    361b:	|               e8 22 ea ff ff       	call   2042 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::~Result()>
+    3620:	\-------------> 48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+    3627:	                c9                   	leave
+    3628:	                c3                   	ret
+
+0000000000003629 <nel::parse_f64(nel::Slice<unsigned char const> const&)>:
+
+Result<Pair<double, Length>, ParseError> parse_f64(Slice<unsigned char const> const &s)
+{
+    3629:	                55                   	push   %rbp
+    362a:	                48 89 e5             	mov    %rsp,%rbp
+    362d:	                53                   	push   %rbx
+    362e:	                48 81 ec 98 01 00 00 	sub    $0x198,%rsp
+    3635:	                48 89 bd 68 fe ff ff 	mov    %rdi,-0x198(%rbp)
+    363c:	                48 89 b5 60 fe ff ff 	mov    %rsi,-0x1a0(%rbp)
+    typedef Result<Pair<double, Length>, ParseError> R;
+    unsigned char const *const p = s.ptr();
+    3643:	                48 8b 85 60 fe ff ff 	mov    -0x1a0(%rbp),%rax
+    364a:	                48 89 c7             	mov    %rax,%rdi
+    364d:	                e8 88 0b 00 00       	call   41da <nel::Slice<unsigned char const>::ptr() const>
+    3652:	                48 89 45 90          	mov    %rax,-0x70(%rbp)
+    Length const n = s.len();
+    3656:	                48 8b 85 60 fe ff ff 	mov    -0x1a0(%rbp),%rax
+    365d:	                48 89 c7             	mov    %rax,%rdi
+    3660:	                e8 c1 09 00 00       	call   4026 <nel::Slice<unsigned char const>::len() const>
+    3665:	                48 89 45 88          	mov    %rax,-0x78(%rbp)
+    if (n == 0) { return R::Err(ParseError::Empty); }
+    3669:	                48 83 7d 88 00       	cmpq   $0x0,-0x78(%rbp)
+    366e:	            /-- 75 28                	jne    3698 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x6f>
+    3670:	            |   c7 85 ac fe ff ff 01 	movl   $0x1,-0x154(%rbp)
+    3677:	            |   00 00 00 
+    367a:	            |   48 8b 85 68 fe ff ff 	mov    -0x198(%rbp),%rax
+    3681:	            |   48 8d 95 ac fe ff ff 	lea    -0x154(%rbp),%rdx
+    3688:	            |   48 89 d6             	mov    %rdx,%rsi
+    368b:	            |   48 89 c7             	mov    %rax,%rdi
+    368e:	            |   e8 13 0c 00 00       	call   42a6 <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Err(nel::ParseError&&)>
+    if (truncated && !(b == compute_float(q, w + 1))) {
+        double const d = slow_path(ds, e - (long long int)(frac_e - frac_b));
+        return R::Ok(Pair<double, Length>{neg ? -d : d, used});
+    }
+    return R::Ok(Pair<double, Length>{to_double(b, neg), used});
+}
+    3693:	/-----------|-- e9 81 09 00 00       	jmp    4019 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x9f0>
+    Index i = 0;
+    3698:	|           \-> 48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+    369f:	|               00 
+    bool const neg = p[0] == '-';
+    36a0:	|               48 8b 45 90          	mov    -0x70(%rbp),%rax
+    36a4:	|               0f b6 00             	movzbl (%rax),%eax
+    36a7:	|               3c 2d                	cmp    $0x2d,%al
+    36a9:	|               0f 94 c0             	sete   %al
+    36ac:	|               88 45 87             	mov    %al,-0x79(%rbp)
+    if (neg || p[0] == '+') { i = 1; }
+    36af:	|               80 7d 87 00          	cmpb   $0x0,-0x79(%rbp)
+    36b3:	|        /----- 75 0b                	jne    36c0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x97>
+    36b5:	|        |      48 8b 45 90          	mov    -0x70(%rbp),%rax
+    36b9:	|        |      0f b6 00             	movzbl (%rax),%eax
+    36bc:	|        |      3c 2b                	cmp    $0x2b,%al
+    36be:	|        |  /-- 75 08                	jne    36c8 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x9f>
+    36c0:	|        \--|-> 48 c7 45 e8 01 00 00 	movq   $0x1,-0x18(%rbp)
+    36c7:	|           |   00 
+    if (i < n && !is_digit(p[i]) && p[i] != '.') {
+    36c8:	|           \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    36cc:	|               48 3b 45 88          	cmp    -0x78(%rbp),%rax
+    36d0:	|        /----- 73 38                	jae    370a <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xe1>
+    36d2:	|        |      48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    36d6:	|        |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    36da:	|        |      48 01 d0             	add    %rdx,%rax
+    36dd:	|        |      0f b6 00             	movzbl (%rax),%eax
+    36e0:	|        |      0f b6 c0             	movzbl %al,%eax
+    36e3:	|        |      89 c7                	mov    %eax,%edi
+    36e5:	|        |      e8 60 f0 ff ff       	call   274a <nel::(anonymous namespace)::is_digit(unsigned char)>
+    36ea:	|        |      83 f0 01             	xor    $0x1,%eax
+    36ed:	|        |      84 c0                	test   %al,%al
+    36ef:	|        +----- 74 19                	je     370a <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xe1>
+    36f1:	|        |      48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    36f5:	|        |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    36f9:	|        |      48 01 d0             	add    %rdx,%rax
+    36fc:	|        |      0f b6 00             	movzbl (%rax),%eax
+    36ff:	|        |      3c 2e                	cmp    $0x2e,%al
+    3701:	|        +----- 74 07                	je     370a <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xe1>
+    3703:	|        |      b8 01 00 00 00       	mov    $0x1,%eax
+    3708:	|        |  /-- eb 05                	jmp    370f <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xe6>
+    370a:	|        \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    370f:	|           \-> 84 c0                	test   %al,%al
+    3711:	|  /----------- 0f 84 8a 01 00 00    	je     38a1 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x278>
+        if (starts_with_word(p + i, n - i, "infinity")) {
+    3717:	|  |            48 8b 45 88          	mov    -0x78(%rbp),%rax
+    371b:	|  |            48 2b 45 e8          	sub    -0x18(%rbp),%rax
+    371f:	|  |            48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    3723:	|  |            48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3727:	|  |            48 01 d1             	add    %rdx,%rcx
+    372a:	|  |            48 8d 15 b1 44 00 00 	lea    0x44b1(%rip),%rdx        # 7be2 <nel::(anonymous namespace)::infinite_power+0x4e>
+    3731:	|  |            48 89 c6             	mov    %rax,%rsi
+    3734:	|  |            48 89 cf             	mov    %rcx,%rdi
+    3737:	|  |            e8 cf fb ff ff       	call   330b <nel::(anonymous namespace)::starts_with_word(unsigned char const*, unsigned long, char const*)>
+    373c:	|  |            84 c0                	test   %al,%al
+    373e:	|  |  /-------- 74 4d                	je     378d <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x164>
+            return R::Ok(Pair<double, Length>{neg ? -__builtin_inf() : __builtin_inf(), i + 8});
+    3740:	|  |  |         80 7d 87 00          	cmpb   $0x0,-0x79(%rbp)
+    3744:	|  |  |  /----- 74 0a                	je     3750 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x127>
+    3746:	|  |  |  |      f2 0f 10 05 c2 44 00 	movsd  0x44c2(%rip),%xmm0        # 7c10 <nel::(anonymous namespace)::infinite_power+0x7c>
+    374d:	|  |  |  |      00 
+    374e:	|  |  |  |  /-- eb 08                	jmp    3758 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x12f>
+    3750:	|  |  |  \--|-> f2 0f 10 05 c0 44 00 	movsd  0x44c0(%rip),%xmm0        # 7c18 <nel::(anonymous namespace)::infinite_power+0x84>
+    3757:	|  |  |     |   00 
+    3758:	|  |  |     \-> f2 0f 11 85 b0 fe ff 	movsd  %xmm0,-0x150(%rbp)
+    375f:	|  |  |         ff 
+    3760:	|  |  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3764:	|  |  |         48 83 c0 08          	add    $0x8,%rax
+    3768:	|  |  |         48 89 85 b8 fe ff ff 	mov    %rax,-0x148(%rbp)
+    376f:	|  |  |         48 8b 85 68 fe ff ff 	mov    -0x198(%rbp),%rax
+    3776:	|  |  |         48 8d 95 b0 fe ff ff 	lea    -0x150(%rbp),%rdx
+    377d:	|  |  |         48 89 d6             	mov    %rdx,%rsi
+    3780:	|  |  |         48 89 c7             	mov    %rax,%rdi
+    3783:	|  |  |         e8 52 0b 00 00       	call   42da <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Ok(nel::Pair<double, unsigned long>&&)>
+}
+    3788:	+--|--|-------- e9 8c 08 00 00       	jmp    4019 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x9f0>
+        if (starts_with_word(p + i, n - i, "inf")) {
+    378d:	|  |  \-------> 48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3791:	|  |            48 2b 45 e8          	sub    -0x18(%rbp),%rax
+    3795:	|  |            48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    3799:	|  |            48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    379d:	|  |            48 01 d1             	add    %rdx,%rcx
+    37a0:	|  |            48 8d 15 44 44 00 00 	lea    0x4444(%rip),%rdx        # 7beb <nel::(anonymous namespace)::infinite_power+0x57>
+    37a7:	|  |            48 89 c6             	mov    %rax,%rsi
+    37aa:	|  |            48 89 cf             	mov    %rcx,%rdi
+    37ad:	|  |            e8 59 fb ff ff       	call   330b <nel::(anonymous namespace)::starts_with_word(unsigned char const*, unsigned long, char const*)>
+    37b2:	|  |            84 c0                	test   %al,%al
+    37b4:	|  |  /-------- 74 4d                	je     3803 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x1da>
+            return R::Ok(Pair<double, Length>{neg ? -__builtin_inf() : __builtin_inf(), i + 3});
+    37b6:	|  |  |         80 7d 87 00          	cmpb   $0x0,-0x79(%rbp)
+    37ba:	|  |  |  /----- 74 0a                	je     37c6 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x19d>
+    37bc:	|  |  |  |      f2 0f 10 05 4c 44 00 	movsd  0x444c(%rip),%xmm0        # 7c10 <nel::(anonymous namespace)::infinite_power+0x7c>
+    37c3:	|  |  |  |      00 
+    37c4:	|  |  |  |  /-- eb 08                	jmp    37ce <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x1a5>
+    37c6:	|  |  |  \--|-> f2 0f 10 05 4a 44 00 	movsd  0x444a(%rip),%xmm0        # 7c18 <nel::(anonymous namespace)::infinite_power+0x84>
+    37cd:	|  |  |     |   00 
+    37ce:	|  |  |     \-> f2 0f 11 85 c0 fe ff 	movsd  %xmm0,-0x140(%rbp)
+    37d5:	|  |  |         ff 
+    37d6:	|  |  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    37da:	|  |  |         48 83 c0 03          	add    $0x3,%rax
+    37de:	|  |  |         48 89 85 c8 fe ff ff 	mov    %rax,-0x138(%rbp)
+    37e5:	|  |  |         48 8b 85 68 fe ff ff 	mov    -0x198(%rbp),%rax
+    37ec:	|  |  |         48 8d 95 c0 fe ff ff 	lea    -0x140(%rbp),%rdx
+    37f3:	|  |  |         48 89 d6             	mov    %rdx,%rsi
+    37f6:	|  |  |         48 89 c7             	mov    %rax,%rdi
+    37f9:	|  |  |         e8 dc 0a 00 00       	call   42da <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Ok(nel::Pair<double, unsigned long>&&)>
+}
+    37fe:	+--|--|-------- e9 16 08 00 00       	jmp    4019 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x9f0>
+        if (starts_with_word(p + i, n - i, "nan")) {
+    3803:	|  |  \-------> 48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3807:	|  |            48 2b 45 e8          	sub    -0x18(%rbp),%rax
+    380b:	|  |            48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    380f:	|  |            48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3813:	|  |            48 01 d1             	add    %rdx,%rcx
+    3816:	|  |            48 8d 15 d2 43 00 00 	lea    0x43d2(%rip),%rdx        # 7bef <nel::(anonymous namespace)::infinite_power+0x5b>
+    381d:	|  |            48 89 c6             	mov    %rax,%rsi
+    3820:	|  |            48 89 cf             	mov    %rcx,%rdi
+    3823:	|  |            e8 e3 fa ff ff       	call   330b <nel::(anonymous namespace)::starts_with_word(unsigned char const*, unsigned long, char const*)>
+    3828:	|  |            84 c0                	test   %al,%al
+    382a:	|  |  /-------- 74 4d                	je     3879 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x250>
+            return R::Ok(Pair<double, Length>{neg ? -__builtin_nan("") : __builtin_nan(""), i + 3});
+    382c:	|  |  |         80 7d 87 00          	cmpb   $0x0,-0x79(%rbp)
+    3830:	|  |  |  /----- 74 0a                	je     383c <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x213>
+    3832:	|  |  |  |      f2 0f 10 05 e6 43 00 	movsd  0x43e6(%rip),%xmm0        # 7c20 <nel::(anonymous namespace)::infinite_power+0x8c>
+    3839:	|  |  |  |      00 
+    383a:	|  |  |  |  /-- eb 08                	jmp    3844 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x21b>
+    383c:	|  |  |  \--|-> f2 0f 10 05 e4 43 00 	movsd  0x43e4(%rip),%xmm0        # 7c28 <nel::(anonymous namespace)::infinite_power+0x94>
+    3843:	|  |  |     |   00 
+    3844:	|  |  |     \-> f2 0f 11 85 d0 fe ff 	movsd  %xmm0,-0x130(%rbp)
+    384b:	|  |  |         ff 
+    384c:	|  |  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3850:	|  |  |         48 83 c0 03          	add    $0x3,%rax
+    3854:	|  |  |         48 89 85 d8 fe ff ff 	mov    %rax,-0x128(%rbp)
+    385b:	|  |  |         48 8b 85 68 fe ff ff 	mov    -0x198(%rbp),%rax
+    3862:	|  |  |         48 8d 95 d0 fe ff ff 	lea    -0x130(%rbp),%rdx
+    3869:	|  |  |         48 89 d6             	mov    %rdx,%rsi
+    386c:	|  |  |         48 89 c7             	mov    %rax,%rdi
+    386f:	|  |  |         e8 66 0a 00 00       	call   42da <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Ok(nel::Pair<double, unsigned long>&&)>
+}
+    3874:	+--|--|-------- e9 a0 07 00 00       	jmp    4019 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x9f0>
+        return R::Err(ParseError::InvalidDigit);
+    3879:	|  |  \-------> c7 85 e8 fe ff ff 02 	movl   $0x2,-0x118(%rbp)
+    3880:	|  |            00 00 00 
+    3883:	|  |            48 8b 85 68 fe ff ff 	mov    -0x198(%rbp),%rax
+    388a:	|  |            48 8d 95 e8 fe ff ff 	lea    -0x118(%rbp),%rdx
+    3891:	|  |            48 89 d6             	mov    %rdx,%rsi
+    3894:	|  |            48 89 c7             	mov    %rax,%rdi
+    3897:	|  |            e8 0a 0a 00 00       	call   42a6 <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Err(nel::ParseError&&)>
+}
+    389c:	+--|----------- e9 78 07 00 00       	jmp    4019 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x9f0>
+    Index const int_b = i;
+    38a1:	|  \----------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    38a5:	|               48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+    Index const int_e = int_b + digit_run(p + int_b, n - int_b);
+    38ac:	|               48 8b 45 88          	mov    -0x78(%rbp),%rax
+    38b0:	|               48 2b 85 78 ff ff ff 	sub    -0x88(%rbp),%rax
+    38b7:	|               48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    38bb:	|               48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+    38c2:	|               48 01 ca             	add    %rcx,%rdx
+    38c5:	|               48 89 c6             	mov    %rax,%rsi
+    38c8:	|               48 89 d7             	mov    %rdx,%rdi
+    38cb:	|               e8 94 ef ff ff       	call   2864 <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)>
+    38d0:	|               48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+    38d7:	|               48 01 d0             	add    %rdx,%rax
+    38da:	|               48 89 85 70 ff ff ff 	mov    %rax,-0x90(%rbp)
+    Index frac_b = int_e;
+    38e1:	|               48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+    38e8:	|               48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    Index frac_e = int_e;
+    38ec:	|               48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+    38f3:	|               48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    if (int_e < n && p[int_e] == '.') {
+    38f7:	|               48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+    38fe:	|               48 3b 45 88          	cmp    -0x78(%rbp),%rax
+    3902:	|           /-- 73 4d                	jae    3951 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x328>
+    3904:	|           |   48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3908:	|           |   48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+    390f:	|           |   48 01 d0             	add    %rdx,%rax
+    3912:	|           |   0f b6 00             	movzbl (%rax),%eax
+    3915:	|           |   3c 2e                	cmp    $0x2e,%al
+    3917:	|           +-- 75 38                	jne    3951 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x328>
+        frac_b = int_e + 1;
+    3919:	|           |   48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+    3920:	|           |   48 83 c0 01          	add    $0x1,%rax
+    3924:	|           |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        frac_e = frac_b + digit_run(p + frac_b, n - frac_b);
+    3928:	|           |   48 8b 45 88          	mov    -0x78(%rbp),%rax
+    392c:	|           |   48 2b 45 e0          	sub    -0x20(%rbp),%rax
+    3930:	|           |   48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    3934:	|           |   48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    3938:	|           |   48 01 ca             	add    %rcx,%rdx
+    393b:	|           |   48 89 c6             	mov    %rax,%rsi
+    393e:	|           |   48 89 d7             	mov    %rdx,%rdi
+    3941:	|           |   e8 1e ef ff ff       	call   2864 <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)>
+    3946:	|           |   48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    394a:	|           |   48 01 d0             	add    %rdx,%rax
+    394d:	|           |   48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    if (int_e == int_b && frac_e == frac_b) { return R::Err(ParseError::InvalidDigit); }
+    3951:	|           \-> 48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+    3958:	|               48 3b 85 78 ff ff ff 	cmp    -0x88(%rbp),%rax
+    395f:	|           /-- 75 32                	jne    3993 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x36a>
+    3961:	|           |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3965:	|           |   48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    3969:	|           +-- 75 28                	jne    3993 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x36a>
+    396b:	|           |   c7 85 ec fe ff ff 02 	movl   $0x2,-0x114(%rbp)
+    3972:	|           |   00 00 00 
+    3975:	|           |   48 8b 85 68 fe ff ff 	mov    -0x198(%rbp),%rax
+    397c:	|           |   48 8d 95 ec fe ff ff 	lea    -0x114(%rbp),%rdx
+    3983:	|           |   48 89 d6             	mov    %rdx,%rsi
+    3986:	|           |   48 89 c7             	mov    %rax,%rdi
+    3989:	|           |   e8 18 09 00 00       	call   42a6 <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Err(nel::ParseError&&)>
+}
+    398e:	+-----------|-- e9 86 06 00 00       	jmp    4019 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x9f0>
+    i = frac_e;
+    3993:	|           \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3997:	|               48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    long long int e = 0;
+    399b:	|               48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+    39a2:	|               00 
+    if (i < n && (p[i] | 0x20) == 'e') {
+    39a3:	|               48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    39a7:	|               48 3b 45 88          	cmp    -0x78(%rbp),%rax
+    39ab:	|  /----------- 0f 83 39 01 00 00    	jae    3aea <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x4c1>
+    39b1:	|  |            48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    39b5:	|  |            48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    39b9:	|  |            48 01 d0             	add    %rdx,%rax
+    39bc:	|  |            0f b6 00             	movzbl (%rax),%eax
+    39bf:	|  |            83 c8 20             	or     $0x20,%eax
+    39c2:	|  |            3c 65                	cmp    $0x65,%al
+    39c4:	|  +----------- 0f 85 20 01 00 00    	jne    3aea <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x4c1>
+        Index j = i + 1;
+    39ca:	|  |            48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    39ce:	|  |            48 83 c0 01          	add    $0x1,%rax
+    39d2:	|  |            48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        bool const e_neg = j < n && p[j] == '-';
+    39d6:	|  |            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    39da:	|  |            48 3b 45 88          	cmp    -0x78(%rbp),%rax
+    39de:	|  |     /----- 73 19                	jae    39f9 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x3d0>
+    39e0:	|  |     |      48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    39e4:	|  |     |      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    39e8:	|  |     |      48 01 d0             	add    %rdx,%rax
+    39eb:	|  |     |      0f b6 00             	movzbl (%rax),%eax
+    39ee:	|  |     |      3c 2d                	cmp    $0x2d,%al
+    39f0:	|  |     +----- 75 07                	jne    39f9 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x3d0>
+    39f2:	|  |     |      b8 01 00 00 00       	mov    $0x1,%eax
+    39f7:	|  |     |  /-- eb 05                	jmp    39fe <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x3d5>
+    39f9:	|  |     \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    39fe:	|  |        \-> 88 85 6f ff ff ff    	mov    %al,-0x91(%rbp)
+        if (j < n && (p[j] == '-' || p[j] == '+')) { j += 1; }
+    3a04:	|  |            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3a08:	|  |            48 3b 45 88          	cmp    -0x78(%rbp),%rax
+    3a0c:	|  |     /----- 73 29                	jae    3a37 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x40e>
+    3a0e:	|  |     |      48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3a12:	|  |     |      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3a16:	|  |     |      48 01 d0             	add    %rdx,%rax
+    3a19:	|  |     |      0f b6 00             	movzbl (%rax),%eax
+    3a1c:	|  |     |      3c 2d                	cmp    $0x2d,%al
+    3a1e:	|  |     |  /-- 74 12                	je     3a32 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x409>
+    3a20:	|  |     |  |   48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3a24:	|  |     |  |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3a28:	|  |     |  |   48 01 d0             	add    %rdx,%rax
+    3a2b:	|  |     |  |   0f b6 00             	movzbl (%rax),%eax
+    3a2e:	|  |     |  |   3c 2b                	cmp    $0x2b,%al
+    3a30:	|  |     +--|-- 75 05                	jne    3a37 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x40e>
+    3a32:	|  |     |  \-> 48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+        Index const e_end = j + digit_run(p + j, n - j);
+    3a37:	|  |     \----> 48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3a3b:	|  |            48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    3a3f:	|  |            48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    3a43:	|  |            48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    3a47:	|  |            48 01 ca             	add    %rcx,%rdx
+    3a4a:	|  |            48 89 c6             	mov    %rax,%rsi
+    3a4d:	|  |            48 89 d7             	mov    %rdx,%rdi
+    3a50:	|  |            e8 0f ee ff ff       	call   2864 <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)>
+    3a55:	|  |            48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    3a59:	|  |            48 01 d0             	add    %rdx,%rax
+    3a5c:	|  |            48 89 85 60 ff ff ff 	mov    %rax,-0xa0(%rbp)
+        if (e_end > j) {
+    3a63:	|  |            48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+    3a6a:	|  |            48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    3a6e:	|  +----------- 73 7a                	jae    3aea <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x4c1>
+            for (; j < e_end; ++j) {
+    3a70:	|  |     /----- eb 46                	jmp    3ab8 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x48f>
+                if (e < (1LL << 40)) { e = e * 10 + (p[j] - '0'); }
+    3a72:	|  |  /--|----> 48 b8 ff ff ff ff ff 	movabs $0xffffffffff,%rax
+    3a79:	|  |  |  |      00 00 00 
+    3a7c:	|  |  |  |      48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+    3a80:	|  |  |  |  /-- 7f 31                	jg     3ab3 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x48a>
+    3a82:	|  |  |  |  |   48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    3a86:	|  |  |  |  |   48 89 d0             	mov    %rdx,%rax
+    3a89:	|  |  |  |  |   48 c1 e0 02          	shl    $0x2,%rax
+    3a8d:	|  |  |  |  |   48 01 d0             	add    %rdx,%rax
+    3a90:	|  |  |  |  |   48 01 c0             	add    %rax,%rax
+    3a93:	|  |  |  |  |   48 89 c1             	mov    %rax,%rcx
+    3a96:	|  |  |  |  |   48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3a9a:	|  |  |  |  |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3a9e:	|  |  |  |  |   48 01 d0             	add    %rdx,%rax
+    3aa1:	|  |  |  |  |   0f b6 00             	movzbl (%rax),%eax
+    3aa4:	|  |  |  |  |   0f b6 c0             	movzbl %al,%eax
+    3aa7:	|  |  |  |  |   83 e8 30             	sub    $0x30,%eax
+    3aaa:	|  |  |  |  |   48 98                	cltq
+    3aac:	|  |  |  |  |   48 01 c8             	add    %rcx,%rax
+    3aaf:	|  |  |  |  |   48 89 45 d0          	mov    %rax,-0x30(%rbp)
+            for (; j < e_end; ++j) {
+    3ab3:	|  |  |  |  \-> 48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    3ab8:	|  |  |  \----> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3abc:	|  |  |         48 3b 85 60 ff ff ff 	cmp    -0xa0(%rbp),%rax
+    3ac3:	|  |  \-------- 72 ad                	jb     3a72 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x449>
+            e = e_neg ? -e : e;
+    3ac5:	|  |            80 bd 6f ff ff ff 00 	cmpb   $0x0,-0x91(%rbp)
+    3acc:	|  |     /----- 74 09                	je     3ad7 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x4ae>
+    3ace:	|  |     |      48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3ad2:	|  |     |      48 f7 d8             	neg    %rax
+    3ad5:	|  |     |  /-- eb 04                	jmp    3adb <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x4b2>
+    3ad7:	|  |     \--|-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3adb:	|  |        \-> 48 89 45 d0          	mov    %rax,-0x30(%rbp)
+            i = e_end;
+    3adf:	|  |            48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+    3ae6:	|  |            48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    Length const used = i;
+    3aea:	|  \----------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3aee:	|               48 89 85 58 ff ff ff 	mov    %rax,-0xa8(%rbp)
+    Index a = int_b;
+    3af5:	|               48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+    3afc:	|               48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (a < int_e && p[a] == '0') {
+    3b00:	|           /-- eb 05                	jmp    3b07 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x4de>
+        a += 1;
+    3b02:	|        /--|-> 48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+    while (a < int_e && p[a] == '0') {
+    3b07:	|        |  \-> 48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    3b0b:	|        |      48 3b 85 70 ff ff ff 	cmp    -0x90(%rbp),%rax
+    3b12:	|        |  /-- 73 12                	jae    3b26 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x4fd>
+    3b14:	|        |  |   48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3b18:	|        |  |   48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    3b1c:	|        |  |   48 01 d0             	add    %rdx,%rax
+    3b1f:	|        |  |   0f b6 00             	movzbl (%rax),%eax
+    3b22:	|        |  |   3c 30                	cmp    $0x30,%al
+    3b24:	|        \--|-- 74 dc                	je     3b02 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x4d9>
+    Index f = frac_b;
+    3b26:	|           \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3b2a:	|               48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    if (a == int_e) {
+    3b2e:	|               48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    3b32:	|               48 3b 85 70 ff ff ff 	cmp    -0x90(%rbp),%rax
+    3b39:	|     /-------- 75 23                	jne    3b5e <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x535>
+        while (f < frac_e && p[f] == '0') {
+    3b3b:	|     |     /-- eb 05                	jmp    3b42 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x519>
+            f += 1;
+    3b3d:	|     |  /--|-> 48 83 45 b8 01       	addq   $0x1,-0x48(%rbp)
+        while (f < frac_e && p[f] == '0') {
+    3b42:	|     |  |  \-> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3b46:	|     |  |      48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    3b4a:	|     +--|----- 73 12                	jae    3b5e <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x535>
+    3b4c:	|     |  |      48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3b50:	|     |  |      48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3b54:	|     |  |      48 01 d0             	add    %rdx,%rax
+    3b57:	|     |  |      0f b6 00             	movzbl (%rax),%eax
+    3b5a:	|     |  |      3c 30                	cmp    $0x30,%al
+    3b5c:	|     |  \----- 74 df                	je     3b3d <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x514>
+    Digits const ds = {p + a, int_e - a, p + f, frac_e - f};
+    3b5e:	|     \-------> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3b62:	|               48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    3b66:	|               48 01 d0             	add    %rdx,%rax
+    3b69:	|               48 89 85 80 fe ff ff 	mov    %rax,-0x180(%rbp)
+    3b70:	|               48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+    3b77:	|               48 2b 45 c0          	sub    -0x40(%rbp),%rax
+    3b7b:	|               48 89 85 88 fe ff ff 	mov    %rax,-0x178(%rbp)
+    3b82:	|               48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3b86:	|               48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3b8a:	|               48 01 d0             	add    %rdx,%rax
+    3b8d:	|               48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+    3b94:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3b98:	|               48 2b 45 b8          	sub    -0x48(%rbp),%rax
+    3b9c:	|               48 89 85 98 fe ff ff 	mov    %rax,-0x168(%rbp)
+    Length const n_sig = ds.an + ds.bn;
+    3ba3:	|               48 8b 95 88 fe ff ff 	mov    -0x178(%rbp),%rdx
+    3baa:	|               48 8b 85 98 fe ff ff 	mov    -0x168(%rbp),%rax
+    3bb1:	|               48 01 d0             	add    %rdx,%rax
+    3bb4:	|               48 89 85 50 ff ff ff 	mov    %rax,-0xb0(%rbp)
+    long long int q = e - (long long int)(frac_e - frac_b);
+    3bbb:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3bbf:	|               48 2b 45 e0          	sub    -0x20(%rbp),%rax
+    3bc3:	|               48 89 c2             	mov    %rax,%rdx
+    3bc6:	|               48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3bca:	|               48 29 d0             	sub    %rdx,%rax
+    3bcd:	|               48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    if (n_sig == 0) { return R::Ok(Pair<double, Length>{neg ? -0.0 : 0.0, used}); }
+    3bd1:	|               48 83 bd 50 ff ff ff 	cmpq   $0x0,-0xb0(%rbp)
+    3bd8:	|               00 
+    3bd9:	|     /-------- 75 48                	jne    3c23 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x5fa>
+    3bdb:	|     |         80 7d 87 00          	cmpb   $0x0,-0x79(%rbp)
+    3bdf:	|     |  /----- 74 0a                	je     3beb <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x5c2>
+    3be1:	|     |  |      f2 0f 10 05 47 40 00 	movsd  0x4047(%rip),%xmm0        # 7c30 <nel::(anonymous namespace)::infinite_power+0x9c>
+    3be8:	|     |  |      00 
+    3be9:	|     |  |  /-- eb 04                	jmp    3bef <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x5c6>
+    3beb:	|     |  \--|-> 66 0f ef c0          	pxor   %xmm0,%xmm0
+    3bef:	|     |     \-> f2 0f 11 85 f0 fe ff 	movsd  %xmm0,-0x110(%rbp)
+    3bf6:	|     |         ff 
+    3bf7:	|     |         48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+    3bfe:	|     |         48 89 85 f8 fe ff ff 	mov    %rax,-0x108(%rbp)
+    3c05:	|     |         48 8b 85 68 fe ff ff 	mov    -0x198(%rbp),%rax
+    3c0c:	|     |         48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+    3c13:	|     |         48 89 d6             	mov    %rdx,%rsi
+    3c16:	|     |         48 89 c7             	mov    %rax,%rdi
+    3c19:	|     |         e8 bc 06 00 00       	call   42da <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Ok(nel::Pair<double, unsigned long>&&)>
+}
+    3c1e:	+-----|-------- e9 f6 03 00 00       	jmp    4019 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x9f0>
+    bool truncated = false;
+    3c23:	|     \-------> c6 45 a7 00          	movb   $0x0,-0x59(%rbp)
+    if (n_sig <= 19) {
+    3c27:	|               48 83 bd 50 ff ff ff 	cmpq   $0x13,-0xb0(%rbp)
+    3c2e:	|               13 
+    3c2f:	|           /-- 77 75                	ja     3ca6 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x67d>
+        w = digits_value(ds.a, ds.an, n - a) * pow10_u64[ds.bn] + digits_value(ds.b, ds.bn, n - f);
+    3c31:	|           |   48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3c35:	|           |   48 2b 45 c0          	sub    -0x40(%rbp),%rax
+    3c39:	|           |   48 89 c2             	mov    %rax,%rdx
+    3c3c:	|           |   48 8b 8d 88 fe ff ff 	mov    -0x178(%rbp),%rcx
+    3c43:	|           |   48 8b 85 80 fe ff ff 	mov    -0x180(%rbp),%rax
+    3c4a:	|           |   48 89 ce             	mov    %rcx,%rsi
+    3c4d:	|           |   48 89 c7             	mov    %rax,%rdi
+    3c50:	|           |   e8 c4 ec ff ff       	call   2919 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    3c55:	|           |   48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+    3c5c:	|           |   48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    3c63:	|           |   00 
+    3c64:	|           |   48 8d 15 15 15 00 00 	lea    0x1515(%rip),%rdx        # 5180 <nel::(anonymous namespace)::pow10_u64>
+    3c6b:	|           |   48 8b 14 11          	mov    (%rcx,%rdx,1),%rdx
+    3c6f:	|           |   48 0f af c2          	imul   %rdx,%rax
+    3c73:	|           |   48 89 c3             	mov    %rax,%rbx
+    3c76:	|           |   48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3c7a:	|           |   48 2b 45 b8          	sub    -0x48(%rbp),%rax
+    3c7e:	|           |   48 89 c2             	mov    %rax,%rdx
+    3c81:	|           |   48 8b 8d 98 fe ff ff 	mov    -0x168(%rbp),%rcx
+    3c88:	|           |   48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+    3c8f:	|           |   48 89 ce             	mov    %rcx,%rsi
+    3c92:	|           |   48 89 c7             	mov    %rax,%rdi
+    3c95:	|           |   e8 7f ec ff ff       	call   2919 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    3c9a:	|           |   48 01 d8             	add    %rbx,%rax
+    3c9d:	|           |   48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    3ca1:	|  /--------|-- e9 05 01 00 00       	jmp    3dab <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x782>
+        if (ds.an >= 19) {
+    3ca6:	|  |        \-> 48 8b 85 88 fe ff ff 	mov    -0x178(%rbp),%rax
+    3cad:	|  |            48 83 f8 12          	cmp    $0x12,%rax
+    3cb1:	|  |        /-- 76 25                	jbe    3cd8 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x6af>
+            w = digits_value(ds.a, 19, n - a);
+    3cb3:	|  |        |   48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3cb7:	|  |        |   48 2b 45 c0          	sub    -0x40(%rbp),%rax
+    3cbb:	|  |        |   48 89 c2             	mov    %rax,%rdx
+    3cbe:	|  |        |   48 8b 85 80 fe ff ff 	mov    -0x180(%rbp),%rax
+    3cc5:	|  |        |   be 13 00 00 00       	mov    $0x13,%esi
+    3cca:	|  |        |   48 89 c7             	mov    %rax,%rdi
+    3ccd:	|  |        |   e8 47 ec ff ff       	call   2919 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    3cd2:	|  |        |   48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    3cd6:	|  |     /--|-- eb 7c                	jmp    3d54 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x72b>
+            w = digits_value(ds.a, ds.an, n - a) * pow10_u64[19 - ds.an] +
+    3cd8:	|  |     |  \-> 48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3cdc:	|  |     |      48 2b 45 c0          	sub    -0x40(%rbp),%rax
+    3ce0:	|  |     |      48 89 c2             	mov    %rax,%rdx
+    3ce3:	|  |     |      48 8b 8d 88 fe ff ff 	mov    -0x178(%rbp),%rcx
+    3cea:	|  |     |      48 8b 85 80 fe ff ff 	mov    -0x180(%rbp),%rax
+    3cf1:	|  |     |      48 89 ce             	mov    %rcx,%rsi
+    3cf4:	|  |     |      48 89 c7             	mov    %rax,%rdi
+    3cf7:	|  |     |      e8 1d ec ff ff       	call   2919 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    3cfc:	|  |     |      48 8b 95 88 fe ff ff 	mov    -0x178(%rbp),%rdx
+    3d03:	|  |     |      b9 13 00 00 00       	mov    $0x13,%ecx
+    3d08:	|  |     |      48 29 d1             	sub    %rdx,%rcx
+    3d0b:	|  |     |      48 c1 e1 03          	shl    $0x3,%rcx
+    3d0f:	|  |     |      48 8d 15 6a 14 00 00 	lea    0x146a(%rip),%rdx        # 5180 <nel::(anonymous namespace)::pow10_u64>
+    3d16:	|  |     |      48 8b 14 11          	mov    (%rcx,%rdx,1),%rdx
+    3d1a:	|  |     |      48 0f af c2          	imul   %rdx,%rax
+    3d1e:	|  |     |      48 89 c3             	mov    %rax,%rbx
+                digits_value(ds.b, 19 - ds.an, n - f);
+    3d21:	|  |     |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3d25:	|  |     |      48 2b 45 b8          	sub    -0x48(%rbp),%rax
+    3d29:	|  |     |      48 89 c2             	mov    %rax,%rdx
+    3d2c:	|  |     |      48 8b 85 88 fe ff ff 	mov    -0x178(%rbp),%rax
+    3d33:	|  |     |      b9 13 00 00 00       	mov    $0x13,%ecx
+    3d38:	|  |     |      48 29 c1             	sub    %rax,%rcx
+    3d3b:	|  |     |      48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+    3d42:	|  |     |      48 89 ce             	mov    %rcx,%rsi
+    3d45:	|  |     |      48 89 c7             	mov    %rax,%rdi
+    3d48:	|  |     |      e8 cc eb ff ff       	call   2919 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+            w = digits_value(ds.a, ds.an, n - a) * pow10_u64[19 - ds.an] +
+    3d4d:	|  |     |      48 01 d8             	add    %rbx,%rax
+    3d50:	|  |     |      48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        q += (long long int)(n_sig - 19);
+    3d54:	|  |     \----> 48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    3d58:	|  |            48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+    3d5f:	|  |            48 01 d0             	add    %rdx,%rax
+    3d62:	|  |            48 83 e8 13          	sub    $0x13,%rax
+    3d66:	|  |            48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        for (Index k = 19; k < n_sig; ++k) {
+    3d6a:	|  |            48 c7 45 98 13 00 00 	movq   $0x13,-0x68(%rbp)
+    3d71:	|  |            00 
+    3d72:	|  |     /----- eb 2a                	jmp    3d9e <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x775>
+            if (ds[k] != '0') {
+    3d74:	|  |  /--|----> 48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    3d78:	|  |  |  |      48 8d 85 80 fe ff ff 	lea    -0x180(%rbp),%rax
+    3d7f:	|  |  |  |      48 89 d6             	mov    %rdx,%rsi
+    3d82:	|  |  |  |      48 89 c7             	mov    %rax,%rdi
+    3d85:	|  |  |  |      e8 fe f2 ff ff       	call   3088 <nel::(anonymous namespace)::Digits::operator[](unsigned long) const>
+    3d8a:	|  |  |  |      3c 30                	cmp    $0x30,%al
+    3d8c:	|  |  |  |      0f 95 c0             	setne  %al
+    3d8f:	|  |  |  |      84 c0                	test   %al,%al
+    3d91:	|  |  |  |  /-- 74 06                	je     3d99 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x770>
+                truncated = true;
+    3d93:	|  |  |  |  |   c6 45 a7 01          	movb   $0x1,-0x59(%rbp)
+                break;
+    3d97:	|  +--|--|--|-- eb 12                	jmp    3dab <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x782>
+        for (Index k = 19; k < n_sig; ++k) {
+    3d99:	|  |  |  |  \-> 48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+    3d9e:	|  |  |  \----> 48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3da2:	|  |  |         48 3b 85 50 ff ff ff 	cmp    -0xb0(%rbp),%rax
+    3da9:	|  |  \-------- 72 c9                	jb     3d74 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x74b>
+    if (!truncated && w <= (1ULL << 53) && q >= -22 && q <= 22) {
+    3dab:	|  \----------> 0f b6 45 a7          	movzbl -0x59(%rbp),%eax
+    3daf:	|               83 f0 01             	xor    $0x1,%eax
+    3db2:	|               84 c0                	test   %al,%al
+    3db4:	|     /-------- 0f 84 0f 01 00 00    	je     3ec9 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x8a0>
+    3dba:	|     |         48 b8 00 00 00 00 00 	movabs $0x20000000000000,%rax
+    3dc1:	|     |         00 20 00 
+    3dc4:	|     |         48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    3dc8:	|     +-------- 0f 82 fb 00 00 00    	jb     3ec9 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x8a0>
+    3dce:	|     |         48 83 7d b0 ea       	cmpq   $0xffffffffffffffea,-0x50(%rbp)
+    3dd3:	|     +-------- 0f 8c f0 00 00 00    	jl     3ec9 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x8a0>
+    3dd9:	|     |         48 83 7d b0 16       	cmpq   $0x16,-0x50(%rbp)
+    3dde:	|     +-------- 0f 8f e5 00 00 00    	jg     3ec9 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x8a0>
+        double d = double(w);
+    3de4:	|     |         48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    3de8:	|     |         48 85 c0             	test   %rax,%rax
+    3deb:	|     |     /-- 78 0b                	js     3df8 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x7cf>
+    3ded:	|     |     |   66 0f ef c0          	pxor   %xmm0,%xmm0
+    3df1:	|     |     |   f2 48 0f 2a c0       	cvtsi2sd %rax,%xmm0
+    3df6:	|     |  /--|-- eb 19                	jmp    3e11 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x7e8>
+    3df8:	|     |  |  \-> 48 89 c2             	mov    %rax,%rdx
+    3dfb:	|     |  |      48 d1 ea             	shr    %rdx
+    3dfe:	|     |  |      83 e0 01             	and    $0x1,%eax
+    3e01:	|     |  |      48 09 c2             	or     %rax,%rdx
+    3e04:	|     |  |      66 0f ef c0          	pxor   %xmm0,%xmm0
+    3e08:	|     |  |      f2 48 0f 2a c2       	cvtsi2sd %rdx,%xmm0
+    3e0d:	|     |  |      f2 0f 58 c0          	addsd  %xmm0,%xmm0
+    3e11:	|     |  \----> f2 0f 11 85 48 ff ff 	movsd  %xmm0,-0xb8(%rbp)
+    3e18:	|     |         ff 
+        d = (q < 0) ? d / pow10_f64[-q] : d * pow10_f64[q];
+    3e19:	|     |         48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+    3e1e:	|     |  /----- 79 29                	jns    3e49 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x820>
+    3e20:	|     |  |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3e24:	|     |  |      48 f7 d8             	neg    %rax
+    3e27:	|     |  |      48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3e2e:	|     |  |      00 
+    3e2f:	|     |  |      48 8d 05 ea 13 00 00 	lea    0x13ea(%rip),%rax        # 5220 <nel::(anonymous namespace)::pow10_f64>
+    3e36:	|     |  |      f2 0f 10 0c 02       	movsd  (%rdx,%rax,1),%xmm1
+    3e3b:	|     |  |      f2 0f 10 85 48 ff ff 	movsd  -0xb8(%rbp),%xmm0
+    3e42:	|     |  |      ff 
+    3e43:	|     |  |      f2 0f 5e c1          	divsd  %xmm1,%xmm0
+    3e47:	|     |  |  /-- eb 20                	jmp    3e69 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x840>
+    3e49:	|     |  \--|-> 48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3e4d:	|     |     |   48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3e54:	|     |     |   00 
+    3e55:	|     |     |   48 8d 05 c4 13 00 00 	lea    0x13c4(%rip),%rax        # 5220 <nel::(anonymous namespace)::pow10_f64>
+    3e5c:	|     |     |   f2 0f 10 04 02       	movsd  (%rdx,%rax,1),%xmm0
+    3e61:	|     |     |   f2 0f 59 85 48 ff ff 	mulsd  -0xb8(%rbp),%xmm0
+    3e68:	|     |     |   ff 
+    3e69:	|     |     \-> f2 0f 11 85 48 ff ff 	movsd  %xmm0,-0xb8(%rbp)
+    3e70:	|     |         ff 
+        return R::Ok(Pair<double, Length>{neg ? -d : d, used});
+    3e71:	|     |         80 7d 87 00          	cmpb   $0x0,-0x79(%rbp)
+    3e75:	|     |  /----- 74 16                	je     3e8d <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x864>
+    3e77:	|     |  |      f2 0f 10 85 48 ff ff 	movsd  -0xb8(%rbp),%xmm0
+    3e7e:	|     |  |      ff 
+    3e7f:	|     |  |      f3 0f 7e 0d b9 3d 00 	movq   0x3db9(%rip),%xmm1        # 7c40 <nel::(anonymous namespace)::infinite_power+0xac>
+    3e86:	|     |  |      00 
+    3e87:	|     |  |      66 0f 57 c1          	xorpd  %xmm1,%xmm0
+    3e8b:	|     |  |  /-- eb 08                	jmp    3e95 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x86c>
+    3e8d:	|     |  \--|-> f2 0f 10 85 48 ff ff 	movsd  -0xb8(%rbp),%xmm0
+    3e94:	|     |     |   ff 
+    3e95:	|     |     \-> f2 0f 11 85 00 ff ff 	movsd  %xmm0,-0x100(%rbp)
+    3e9c:	|     |         ff 
+    3e9d:	|     |         48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+    3ea4:	|     |         48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+    3eab:	|     |         48 8b 85 68 fe ff ff 	mov    -0x198(%rbp),%rax
+    3eb2:	|     |         48 8d 95 00 ff ff ff 	lea    -0x100(%rbp),%rdx
+    3eb9:	|     |         48 89 d6             	mov    %rdx,%rsi
+    3ebc:	|     |         48 89 c7             	mov    %rax,%rdi
+    3ebf:	|     |         e8 16 04 00 00       	call   42da <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Ok(nel::Pair<double, unsigned long>&&)>
+}
+    3ec4:	+-----|-------- e9 50 01 00 00       	jmp    4019 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x9f0>
+    Binary const b = compute_float(q, w);
+    3ec9:	|     \-------> 48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    3ecd:	|               48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3ed1:	|               48 89 d6             	mov    %rdx,%rsi
+    3ed4:	|               48 89 c7             	mov    %rax,%rdi
+    3ed7:	|               e8 65 ee ff ff       	call   2d41 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)>
+    3edc:	|               48 89 85 70 fe ff ff 	mov    %rax,-0x190(%rbp)
+    3ee3:	|               48 89 95 78 fe ff ff 	mov    %rdx,-0x188(%rbp)
+    if (truncated && !(b == compute_float(q, w + 1))) {
+    3eea:	|               80 7d a7 00          	cmpb   $0x0,-0x59(%rbp)
+    3eee:	|        /----- 74 4c                	je     3f3c <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x913>
+    3ef0:	|        |      48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    3ef4:	|        |      48 8d 50 01          	lea    0x1(%rax),%rdx
+    3ef8:	|        |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3efc:	|        |      48 89 d6             	mov    %rdx,%rsi
+    3eff:	|        |      48 89 c7             	mov    %rax,%rdi
+    3f02:	|        |      e8 3a ee ff ff       	call   2d41 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)>
+    3f07:	|        |      48 89 85 10 ff ff ff 	mov    %rax,-0xf0(%rbp)
+    3f0e:	|        |      48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+    3f15:	|        |      48 8d 95 10 ff ff ff 	lea    -0xf0(%rbp),%rdx
+    3f1c:	|        |      48 8d 85 70 fe ff ff 	lea    -0x190(%rbp),%rax
+    3f23:	|        |      48 89 d6             	mov    %rdx,%rsi
+    3f26:	|        |      48 89 c7             	mov    %rax,%rdi
+    3f29:	|        |      e8 d4 ed ff ff       	call   2d02 <nel::(anonymous namespace)::Binary::operator==(nel::(anonymous namespace)::Binary const&) const>
+    3f2e:	|        |      83 f0 01             	xor    $0x1,%eax
+    3f31:	|        |      84 c0                	test   %al,%al
+    3f33:	|        +----- 74 07                	je     3f3c <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x913>
+    3f35:	|        |      b8 01 00 00 00       	mov    $0x1,%eax
+    3f3a:	|        |  /-- eb 05                	jmp    3f41 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x918>
+    3f3c:	|        \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3f41:	|           \-> 84 c0                	test   %al,%al
+    3f43:	|     /-------- 0f 84 88 00 00 00    	je     3fd1 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x9a8>
+        double const d = slow_path(ds, e - (long long int)(frac_e - frac_b));
+    3f49:	|     |         48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3f4d:	|     |         48 2b 45 e0          	sub    -0x20(%rbp),%rax
+    3f51:	|     |         48 89 c1             	mov    %rax,%rcx
+    3f54:	|     |         48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3f58:	|     |         48 29 c8             	sub    %rcx,%rax
+    3f5b:	|     |         48 89 c2             	mov    %rax,%rdx
+    3f5e:	|     |         48 8d 85 80 fe ff ff 	lea    -0x180(%rbp),%rax
+    3f65:	|     |         48 89 d6             	mov    %rdx,%rsi
+    3f68:	|     |         48 89 c7             	mov    %rax,%rdi
+    3f6b:	|     |         e8 65 f1 ff ff       	call   30d5 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)>
+    3f70:	|     |         66 48 0f 7e c0       	movq   %xmm0,%rax
+    3f75:	|     |         48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+        return R::Ok(Pair<double, Length>{neg ? -d : d, used});
+    3f7c:	|     |         80 7d 87 00          	cmpb   $0x0,-0x79(%rbp)
+    3f80:	|     |  /----- 74 16                	je     3f98 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x96f>
+    3f82:	|     |  |      f2 0f 10 85 40 ff ff 	movsd  -0xc0(%rbp),%xmm0
+    3f89:	|     |  |      ff 
+    3f8a:	|     |  |      f3 0f 7e 0d ae 3c 00 	movq   0x3cae(%rip),%xmm1        # 7c40 <nel::(anonymous namespace)::infinite_power+0xac>
+    3f91:	|     |  |      00 
+    3f92:	|     |  |      66 0f 57 c1          	xorpd  %xmm1,%xmm0
+    3f96:	|     |  |  /-- eb 08                	jmp    3fa0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x977>
+    3f98:	|     |  \--|-> f2 0f 10 85 40 ff ff 	movsd  -0xc0(%rbp),%xmm0
+    3f9f:	|     |     |   ff 
+    3fa0:	|     |     \-> f2 0f 11 85 20 ff ff 	movsd  %xmm0,-0xe0(%rbp)
+    3fa7:	|     |         ff 
+    3fa8:	|     |         48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+    3faf:	|     |         48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+    3fb6:	|     |         48 8b 85 68 fe ff ff 	mov    -0x198(%rbp),%rax
+    3fbd:	|     |         48 8d 95 20 ff ff ff 	lea    -0xe0(%rbp),%rdx
+    3fc4:	|     |         48 89 d6             	mov    %rdx,%rsi
+    3fc7:	|     |         48 89 c7             	mov    %rax,%rdi
+    3fca:	|     |         e8 0b 03 00 00       	call   42da <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Ok(nel::Pair<double, unsigned long>&&)>
+}
+    3fcf:	+-----|-------- eb 48                	jmp    4019 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x9f0>
+    return R::Ok(Pair<double, Length>{to_double(b, neg), used});
+    3fd1:	|     \-------> 0f b6 55 87          	movzbl -0x79(%rbp),%edx
+    3fd5:	|               48 8d 85 70 fe ff ff 	lea    -0x190(%rbp),%rax
+    3fdc:	|               89 d6                	mov    %edx,%esi
+    3fde:	|               48 89 c7             	mov    %rax,%rdi
+    3fe1:	|               e8 55 f0 ff ff       	call   303b <nel::(anonymous namespace)::to_double(nel::(anonymous namespace)::Binary const&, bool)>
+    3fe6:	|               66 48 0f 7e c0       	movq   %xmm0,%rax
+    3feb:	|               48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+    3ff2:	|               48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+    3ff9:	|               48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+    4000:	|               48 8b 85 68 fe ff ff 	mov    -0x198(%rbp),%rax
+    4007:	|               48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+    400e:	|               48 89 d6             	mov    %rdx,%rsi
+    4011:	|               48 89 c7             	mov    %rax,%rdi
+    4014:	|               e8 c1 02 00 00       	call   42da <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Ok(nel::Pair<double, unsigned long>&&)>
+}
+    4019:	\-------------> 48 8b 85 68 fe ff ff 	mov    -0x198(%rbp),%rax
+    4020:	                48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    4024:	                c9                   	leave
+    4025:	                c3                   	ret
+
+0000000000004026 <nel::Slice<unsigned char const>::len() const>:
+        /**
+         * Determine numer of elements in the slice.
+         *
+         * @returns number of elements in the slice.
+         */
+        constexpr Length len(void) const
+    4026:	55                   	push   %rbp
+    4027:	48 89 e5             	mov    %rsp,%rbp
+    402a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return len_;
+    402e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4032:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    4036:	5d                   	pop    %rbp
+    4037:	c3                   	ret
+
+0000000000004038 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}::operator()(nel::Pair<unsigned long long, unsigned long>&&) const>:
+         *
+         * this is consumed by the operation.
+         */
+        constexpr E unwrap_err(Context const &ctx = Context())
+        {
+            return consume<E>([&](T &&) -> E { nel::panic("not an err", ctx); },
+    4038:	55                   	push   %rbp
+    4039:	48 89 e5             	mov    %rsp,%rbp
+    403c:	48 83 ec 10          	sub    $0x10,%rsp
+    4040:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4044:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    4048:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    404c:	48 8b 00             	mov    (%rax),%rax
+    404f:	48 89 c6             	mov    %rax,%rsi
+    4052:	48 8d 05 3f 3b 00 00 	lea    0x3b3f(%rip),%rax        # 7b98 <nel::(anonymous namespace)::infinite_power+0x4>
+    4059:	48 89 c7             	mov    %rax,%rdi
+    405c:	e8 c4 e4 ff ff       	call   2525 <nel::panic(char const*, nel::Context const&)>
+    4061:	90                   	nop
+
+0000000000004062 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::ParseError&&)#2}::operator()(nel::ParseError&&) const>:
+                              [](E &&err) -> E { return err; },
+    4062:	55                   	push   %rbp
+    4063:	48 89 e5             	mov    %rsp,%rbp
+    4066:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    406a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    406e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4072:	8b 00                	mov    (%rax),%eax
+    4074:	5d                   	pop    %rbp
+    4075:	c3                   	ret
+
+0000000000004076 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)>:
+        constexpr E unwrap_err(Context const &ctx = Context())
+    4076:	55                   	push   %rbp
+    4077:	48 89 e5             	mov    %rsp,%rbp
+    407a:	48 83 ec 20          	sub    $0x20,%rsp
+    407e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    4082:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return consume<E>([&](T &&) -> E { nel::panic("not an err", ctx); },
+    4086:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    408a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    408e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    4092:	48 8d 55 f7          	lea    -0x9(%rbp),%rdx
+    4096:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+    409a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    409e:	48 89 c7             	mov    %rax,%rdi
+    40a1:	e8 02 00 00 00       	call   40a8 <nel::ParseError nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::consume<nel::ParseError, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)>
+                              ctx);
+        }
+    40a6:	c9                   	leave
+    40a7:	c3                   	ret
+
+00000000000040a8 <nel::ParseError nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::consume<nel::ParseError, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    40a8:	             55                   	push   %rbp
+    40a9:	             48 89 e5             	mov    %rsp,%rbp
+    40ac:	             48 83 ec 30          	sub    $0x30,%rsp
+    40b0:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    40b4:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    40b8:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    40bc:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    40c0:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    40c4:	             8b 00                	mov    (%rax),%eax
+    40c6:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    40c9:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    40cd:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    40d3:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    40d7:	         /-- 74 3e                	je     4117 <nel::ParseError nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::consume<nel::ParseError, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)+0x6f>
+    40d9:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    40dd:	/--------|-- 7f 7a                	jg     4159 <nel::ParseError nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::consume<nel::ParseError, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)+0xb1>
+    40df:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    40e3:	|  /-----|-- 74 5e                	je     4143 <nel::ParseError nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::consume<nel::ParseError, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)+0x9b>
+    40e5:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    40e9:	+--|-----|-- 75 6e                	jne    4159 <nel::ParseError nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::consume<nel::ParseError, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)+0xb1>
+                    return on_ok(forward<T>(*ok_));
+    40eb:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    40ef:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    40f3:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    40f6:	|  |     |   e8 4f e3 ff ff       	call   244a <nel::Element<nel::Pair<unsigned long long, unsigned long> >::operator*()>
+    40fb:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    40fe:	|  |     |   e8 48 e1 ff ff       	call   224b <nel::Pair<unsigned long long, unsigned long>&& nel::forward<nel::Pair<unsigned long long, unsigned long>, nel::Pair<unsigned long long, unsigned long> >(nel::Pair<unsigned long long, unsigned long>&)>
+    4103:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    4106:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    410a:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    410d:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    4110:	|  |     |   e8 23 ff ff ff       	call   4038 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}::operator()(nel::Pair<unsigned long long, unsigned long>&&) const>
+    4115:	|  |  /--|-- eb 58                	jmp    416f <nel::ParseError nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::consume<nel::ParseError, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)+0xc7>
+                    return on_err(forward<E>(*err_));
+    4117:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    411b:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    411f:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    4122:	|  |  |      e8 3d e3 ff ff       	call   2464 <nel::Element<nel::ParseError>::operator*()>
+    4127:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    412a:	|  |  |      e8 4f e3 ff ff       	call   247e <nel::ParseError&& nel::forward<nel::ParseError, nel::ParseError>(nel::ParseError&)>
+    412f:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    4132:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4136:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    4139:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    413c:	|  |  |      e8 21 ff ff ff       	call   4062 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::ParseError&&)#2}::operator()(nel::ParseError&&) const>
+    4141:	|  |  +----- eb 2c                	jmp    416f <nel::ParseError nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::consume<nel::ParseError, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::ParseError&&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::Pair<unsigned long long, unsigned long>&&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::unwrap_err(nel::Context const&)::{lambda(nel::ParseError&&)#2}&&, nel::Context const&)+0xc7>
+                    nel::panic("invalid Result", ctx);
+    4143:	|  \--|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    4147:	|     |      48 89 c6             	mov    %rax,%rsi
+    414a:	|     |      48 8d 05 52 3a 00 00 	lea    0x3a52(%rip),%rax        # 7ba3 <nel::(anonymous namespace)::infinite_power+0xf>
+    4151:	|     |      48 89 c7             	mov    %rax,%rdi
+    4154:	|     |      e8 cc e3 ff ff       	call   2525 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    4159:	\-----|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    415d:	      |      48 89 c6             	mov    %rax,%rsi
+    4160:	      |      48 8d 05 4b 3a 00 00 	lea    0x3a4b(%rip),%rax        # 7bb2 <nel::(anonymous namespace)::infinite_power+0x1e>
+    4167:	      |      48 89 c7             	mov    %rax,%rdi
+    416a:	      |      e8 b6 e3 ff ff       	call   2525 <nel::panic(char const*, nel::Context const&)>
+        }
+    416f:	      \----> c9                   	leave
+    4170:	             c3                   	ret
+
+0000000000004171 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Err(nel::ParseError&&)>:
+        constexpr static Result Err(E &&val)
+    4171:	55                   	push   %rbp
+    4172:	48 89 e5             	mov    %rsp,%rbp
+    4175:	48 83 ec 10          	sub    $0x10,%rsp
+    4179:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    417d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<E>(val));
+    4181:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4185:	48 89 c7             	mov    %rax,%rdi
+    4188:	e8 f1 e2 ff ff       	call   247e <nel::ParseError&& nel::forward<nel::ParseError, nel::ParseError>(nel::ParseError&)>
+    418d:	48 89 c2             	mov    %rax,%rdx
+    4190:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4194:	48 89 d6             	mov    %rdx,%rsi
+    4197:	48 89 c7             	mov    %rax,%rdi
+    419a:	e8 6f 01 00 00       	call   430e <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Result(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Phantom<(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Tag)2>, nel::ParseError&&)>
+        }
+    419f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    41a3:	c9                   	leave
+    41a4:	c3                   	ret
+
+00000000000041a5 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Ok(nel::Pair<unsigned long long, unsigned long>&&)>:
+        constexpr static Result Ok(T &&val)
+    41a5:	55                   	push   %rbp
+    41a6:	48 89 e5             	mov    %rsp,%rbp
+    41a9:	48 83 ec 10          	sub    $0x10,%rsp
+    41ad:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    41b1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<T>(val));
+    41b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    41b9:	48 89 c7             	mov    %rax,%rdi
+    41bc:	e8 8a e0 ff ff       	call   224b <nel::Pair<unsigned long long, unsigned long>&& nel::forward<nel::Pair<unsigned long long, unsigned long>, nel::Pair<unsigned long long, unsigned long> >(nel::Pair<unsigned long long, unsigned long>&)>
+    41c1:	48 89 c2             	mov    %rax,%rdx
+    41c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    41c8:	48 89 d6             	mov    %rdx,%rsi
+    41cb:	48 89 c7             	mov    %rax,%rdi
+    41ce:	e8 7d 01 00 00       	call   4350 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Result(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Phantom<(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Tag)1>, nel::Pair<unsigned long long, unsigned long>&&)>
+        }
+    41d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    41d7:	c9                   	leave
+    41d8:	c3                   	ret
+    41d9:	90                   	nop
+
+00000000000041da <nel::Slice<unsigned char const>::ptr() const>:
+        constexpr Type *ptr(void) const
+    41da:	55                   	push   %rbp
+    41db:	48 89 e5             	mov    %rsp,%rbp
+    41de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return content_;
+    41e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    41e6:	48 8b 00             	mov    (%rax),%rax
+        }
+    41e9:	5d                   	pop    %rbp
+    41ea:	c3                   	ret
+
+00000000000041eb <nel::Result<nel::Pair<long long, unsigned long>, nel::ParseError>::Err(nel::ParseError&&)>:
+        constexpr static Result Err(E &&val)
+    41eb:	55                   	push   %rbp
+    41ec:	48 89 e5             	mov    %rsp,%rbp
+    41ef:	48 83 ec 10          	sub    $0x10,%rsp
+    41f3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    41f7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<E>(val));
+    41fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    41ff:	48 89 c7             	mov    %rax,%rdi
+    4202:	e8 77 e2 ff ff       	call   247e <nel::ParseError&& nel::forward<nel::ParseError, nel::ParseError>(nel::ParseError&)>
+    4207:	48 89 c2             	mov    %rax,%rdx
+    420a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    420e:	48 89 d6             	mov    %rdx,%rsi
+    4211:	48 89 c7             	mov    %rax,%rdi
+    4214:	e8 79 01 00 00       	call   4392 <nel::Result<nel::Pair<long long, unsigned long>, nel::ParseError>::Result(nel::Result<nel::Pair<long long, unsigned long>, nel::ParseError>::Phantom<(nel::Result<nel::Pair<long long, unsigned long>, nel::ParseError>::Tag)2>, nel::ParseError&&)>
+        }
+    4219:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    421d:	c9                   	leave
+    421e:	c3                   	ret
+    421f:	90                   	nop
+
+0000000000004220 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::Pair<unsigned long long, unsigned long> const&)#1}::operator()(nel::Pair<unsigned long long, unsigned long> const&) const>:
+            return match<bool>([](T const &) -> bool { return false; },
+    4220:	55                   	push   %rbp
+    4221:	48 89 e5             	mov    %rsp,%rbp
+    4224:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4228:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    422c:	b8 00 00 00 00       	mov    $0x0,%eax
+    4231:	5d                   	pop    %rbp
+    4232:	c3                   	ret
+    4233:	90                   	nop
+
+0000000000004234 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::ParseError const&)#2}::operator()(nel::ParseError const&) const>:
+                               [](E const &) -> bool { return true; },
+    4234:	55                   	push   %rbp
+    4235:	48 89 e5             	mov    %rsp,%rbp
+    4238:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    423c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    4240:	b8 01 00 00 00       	mov    $0x1,%eax
+    4245:	5d                   	pop    %rbp
+    4246:	c3                   	ret
+    4247:	90                   	nop
+
+0000000000004248 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const>:
+        constexpr bool is_err(Context const &ctx = Context()) const
+    4248:	55                   	push   %rbp
+    4249:	48 89 e5             	mov    %rsp,%rbp
+    424c:	48 83 ec 20          	sub    $0x20,%rsp
+    4250:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    4254:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](T const &) -> bool { return false; },
+    4258:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    425c:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    4260:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    4264:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4268:	48 89 c7             	mov    %rax,%rdi
+    426b:	e8 64 01 00 00       	call   43d4 <bool nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::match<bool, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::Pair<unsigned long long, unsigned long> const&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::ParseError const&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::Pair<unsigned long long, unsigned long> const&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::ParseError const&)#2}&&, nel::Context const&) const>
+        }
+    4270:	c9                   	leave
+    4271:	c3                   	ret
+
+0000000000004272 <nel::Result<nel::Pair<long long, unsigned long>, nel::ParseError>::Ok(nel::Pair<long long, unsigned long>&&)>:
+        constexpr static Result Ok(T &&val)
+    4272:	55                   	push   %rbp
+    4273:	48 89 e5             	mov    %rsp,%rbp
+    4276:	48 83 ec 10          	sub    $0x10,%rsp
+    427a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    427e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<T>(val));
+    4282:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4286:	48 89 c7             	mov    %rax,%rdi
+    4289:	e8 ed 01 00 00       	call   447b <nel::Pair<long long, unsigned long>&& nel::forward<nel::Pair<long long, unsigned long>, nel::Pair<long long, unsigned long> >(nel::Pair<long long, unsigned long>&)>
+    428e:	48 89 c2             	mov    %rax,%rdx
+    4291:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4295:	48 89 d6             	mov    %rdx,%rsi
+    4298:	48 89 c7             	mov    %rax,%rdi
+    429b:	e8 ea 01 00 00       	call   448a <nel::Result<nel::Pair<long long, unsigned long>, nel::ParseError>::Result(nel::Result<nel::Pair<long long, unsigned long>, nel::ParseError>::Phantom<(nel::Result<nel::Pair<long long, unsigned long>, nel::ParseError>::Tag)1>, nel::Pair<long long, unsigned long>&&)>
+        }
+    42a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    42a4:	c9                   	leave
+    42a5:	c3                   	ret
+
+00000000000042a6 <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Err(nel::ParseError&&)>:
+        constexpr static Result Err(E &&val)
+    42a6:	55                   	push   %rbp
+    42a7:	48 89 e5             	mov    %rsp,%rbp
+    42aa:	48 83 ec 10          	sub    $0x10,%rsp
+    42ae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    42b2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<E>(val));
+    42b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    42ba:	48 89 c7             	mov    %rax,%rdi
+    42bd:	e8 bc e1 ff ff       	call   247e <nel::ParseError&& nel::forward<nel::ParseError, nel::ParseError>(nel::ParseError&)>
+    42c2:	48 89 c2             	mov    %rax,%rdx
+    42c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    42c9:	48 89 d6             	mov    %rdx,%rsi
+    42cc:	48 89 c7             	mov    %rax,%rdi
+    42cf:	e8 f8 01 00 00       	call   44cc <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Result(nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Phantom<(nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Tag)2>, nel::ParseError&&)>
+        }
+    42d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    42d8:	c9                   	leave
+    42d9:	c3                   	ret
+
+00000000000042da <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Ok(nel::Pair<double, unsigned long>&&)>:
+        constexpr static Result Ok(T &&val)
+    42da:	55                   	push   %rbp
+    42db:	48 89 e5             	mov    %rsp,%rbp
+    42de:	48 83 ec 10          	sub    $0x10,%rsp
+    42e2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    42e6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<T>(val));
+    42ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    42ee:	48 89 c7             	mov    %rax,%rdi
+    42f1:	e8 2d e0 ff ff       	call   2323 <nel::Pair<double, unsigned long>&& nel::forward<nel::Pair<double, unsigned long>, nel::Pair<double, unsigned long> >(nel::Pair<double, unsigned long>&)>
+    42f6:	48 89 c2             	mov    %rax,%rdx
+    42f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    42fd:	48 89 d6             	mov    %rdx,%rsi
+    4300:	48 89 c7             	mov    %rax,%rdi
+    4303:	e8 06 02 00 00       	call   450e <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Result(nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Phantom<(nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Tag)1>, nel::Pair<double, unsigned long>&&)>
+        }
+    4308:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    430c:	c9                   	leave
+    430d:	c3                   	ret
+
+000000000000430e <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Result(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Phantom<(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Tag)2>, nel::ParseError&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    430e:	55                   	push   %rbp
+    430f:	48 89 e5             	mov    %rsp,%rbp
+    4312:	53                   	push   %rbx
+    4313:	48 83 ec 18          	sub    $0x18,%rsp
+    4317:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    431b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    431f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4323:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    4329:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    432d:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    4331:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4335:	48 89 c7             	mov    %rax,%rdi
+    4338:	e8 41 e1 ff ff       	call   247e <nel::ParseError&& nel::forward<nel::ParseError, nel::ParseError>(nel::ParseError&)>
+    433d:	48 89 c6             	mov    %rax,%rsi
+    4340:	48 89 df             	mov    %rbx,%rdi
+    4343:	e8 08 02 00 00       	call   4550 <nel::Element<nel::ParseError>::Element(nel::ParseError&&)>
+        }
+    4348:	90                   	nop
+    4349:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    434d:	c9                   	leave
+    434e:	c3                   	ret
+    434f:	90                   	nop
+
+0000000000004350 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Result(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Phantom<(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::Tag)1>, nel::Pair<unsigned long long, unsigned long>&&)>:
+        constexpr Result(Phantom<Tag::OK> const, T &&v)
+    4350:	55                   	push   %rbp
+    4351:	48 89 e5             	mov    %rsp,%rbp
+    4354:	53                   	push   %rbx
+    4355:	48 83 ec 18          	sub    $0x18,%rsp
+    4359:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    435d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    4361:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4365:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<T>(v))
+    436b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    436f:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    4373:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4377:	48 89 c7             	mov    %rax,%rdi
+    437a:	e8 cc de ff ff       	call   224b <nel::Pair<unsigned long long, unsigned long>&& nel::forward<nel::Pair<unsigned long long, unsigned long>, nel::Pair<unsigned long long, unsigned long> >(nel::Pair<unsigned long long, unsigned long>&)>
+    437f:	48 89 c6             	mov    %rax,%rsi
+    4382:	48 89 df             	mov    %rbx,%rdi
+    4385:	e8 ee 01 00 00       	call   4578 <nel::Element<nel::Pair<unsigned long long, unsigned long> >::Element(nel::Pair<unsigned long long, unsigned long>&&)>
+        }
+    438a:	90                   	nop
+    438b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    438f:	c9                   	leave
+    4390:	c3                   	ret
+    4391:	90                   	nop
+
+0000000000004392 <nel::Result<nel::Pair<long long, unsigned long>, nel::ParseError>::Result(nel::Result<nel::Pair<long long, unsigned long>, nel::ParseError>::Phantom<(nel::Result<nel::Pair<long long, unsigned long>, nel::ParseError>::Tag)2>, nel::ParseError&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    4392:	55                   	push   %rbp
+    4393:	48 89 e5             	mov    %rsp,%rbp
+    4396:	53                   	push   %rbx
+    4397:	48 83 ec 18          	sub    $0x18,%rsp
+    439b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    439f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    43a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    43a7:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    43ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    43b1:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    43b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    43b9:	48 89 c7             	mov    %rax,%rdi
+    43bc:	e8 bd e0 ff ff       	call   247e <nel::ParseError&& nel::forward<nel::ParseError, nel::ParseError>(nel::ParseError&)>
+    43c1:	48 89 c6             	mov    %rax,%rsi
+    43c4:	48 89 df             	mov    %rbx,%rdi
+    43c7:	e8 84 01 00 00       	call   4550 <nel::Element<nel::ParseError>::Element(nel::ParseError&&)>
+        }
+    43cc:	90                   	nop
+    43cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    43d1:	c9                   	leave
+    43d2:	c3                   	ret
+    43d3:	90                   	nop
+
+00000000000043d4 <bool nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::match<bool, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::Pair<unsigned long long, unsigned long> const&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::ParseError const&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::Pair<unsigned long long, unsigned long> const&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::ParseError const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    43d4:	             55                   	push   %rbp
+    43d5:	             48 89 e5             	mov    %rsp,%rbp
+    43d8:	             48 83 ec 20          	sub    $0x20,%rsp
+    43dc:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    43e0:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    43e4:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    43e8:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result-match
+    43ec:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    43f0:	             8b 00                	mov    (%rax),%eax
+    43f2:	             83 f8 02             	cmp    $0x2,%eax
+    43f5:	         /-- 74 32                	je     4429 <bool nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::match<bool, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::Pair<unsigned long long, unsigned long> const&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::ParseError const&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::Pair<unsigned long long, unsigned long> const&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::ParseError const&)#2}&&, nel::Context const&) const+0x55>
+    43f7:	         |   83 f8 02             	cmp    $0x2,%eax
+    43fa:	/--------|-- 7f 67                	jg     4463 <bool nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::match<bool, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::Pair<unsigned long long, unsigned long> const&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::ParseError const&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::Pair<unsigned long long, unsigned long> const&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::ParseError const&)#2}&&, nel::Context const&) const+0x8f>
+    43fc:	|        |   85 c0                	test   %eax,%eax
+    43fe:	|     /--|-- 74 4d                	je     444d <bool nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::match<bool, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::Pair<unsigned long long, unsigned long> const&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::ParseError const&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::Pair<unsigned long long, unsigned long> const&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::ParseError const&)#2}&&, nel::Context const&) const+0x79>
+    4400:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    4403:	+-----|--|-- 75 5e                	jne    4463 <bool nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::match<bool, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::Pair<unsigned long long, unsigned long> const&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::ParseError const&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::Pair<unsigned long long, unsigned long> const&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::ParseError const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_ok(*ok_);
+    4405:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4409:	|     |  |   48 83 c0 08          	add    $0x8,%rax
+    440d:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    4410:	|     |  |   e8 95 01 00 00       	call   45aa <nel::Element<nel::Pair<unsigned long long, unsigned long> >::operator*() const>
+    4415:	|     |  |   48 89 c2             	mov    %rax,%rdx
+    4418:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    441c:	|     |  |   48 89 d6             	mov    %rdx,%rsi
+    441f:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    4422:	|     |  |   e8 f9 fd ff ff       	call   4220 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::Pair<unsigned long long, unsigned long> const&)#1}::operator()(nel::Pair<unsigned long long, unsigned long> const&) const>
+    4427:	|  /--|--|-- eb 50                	jmp    4479 <bool nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::match<bool, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::Pair<unsigned long long, unsigned long> const&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::ParseError const&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::Pair<unsigned long long, unsigned long> const&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::ParseError const&)#2}&&, nel::Context const&) const+0xa5>
+                    return on_err(*err_);
+    4429:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    442d:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    4431:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    4434:	|  |  |      e8 8b 01 00 00       	call   45c4 <nel::Element<nel::ParseError>::operator*() const>
+    4439:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    443c:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4440:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    4443:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    4446:	|  |  |      e8 e9 fd ff ff       	call   4234 <nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::ParseError const&)#2}::operator()(nel::ParseError const&) const>
+    444b:	|  +--|----- eb 2c                	jmp    4479 <bool nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::match<bool, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::Pair<unsigned long long, unsigned long> const&)#1}, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::ParseError const&)#2}>(nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::Pair<unsigned long long, unsigned long> const&)#1}&&, nel::Result<nel::Pair<unsigned long long, unsigned long>, nel::ParseError>::is_err(nel::Context const&) const::{lambda(nel::ParseError const&)#2}&&, nel::Context const&) const+0xa5>
+                    nel::panic("invalid Result", ctx);
+    444d:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4451:	|  |         48 89 c6             	mov    %rax,%rsi
+    4454:	|  |         48 8d 05 48 37 00 00 	lea    0x3748(%rip),%rax        # 7ba3 <nel::(anonymous namespace)::infinite_power+0xf>
+    445b:	|  |         48 89 c7             	mov    %rax,%rdi
+    445e:	|  |         e8 c2 e0 ff ff       	call   2525 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    4463:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4467:	   |         48 89 c6             	mov    %rax,%rsi
+    446a:	   |         48 8d 05 41 37 00 00 	lea    0x3741(%rip),%rax        # 7bb2 <nel::(anonymous namespace)::infinite_power+0x1e>
+    4471:	   |         48 89 c7             	mov    %rax,%rdi
+    4474:	   |         e8 ac e0 ff ff       	call   2525 <nel::panic(char const*, nel::Context const&)>
+        }
+    4479:	   \-------> c9                   	leave
+    447a:	             c3                   	ret
+
+000000000000447b <nel::Pair<long long, unsigned long>&& nel::forward<nel::Pair<long long, unsigned long>, nel::Pair<long long, unsigned long> >(nel::Pair<long long, unsigned long>&)>:
+constexpr U &&forward(T &t)
+    447b:	55                   	push   %rbp
+    447c:	48 89 e5             	mov    %rsp,%rbp
+    447f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    4483:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    4487:	5d                   	pop    %rbp
+    4488:	c3                   	ret
+    4489:	90                   	nop
+
+000000000000448a <nel::Result<nel::Pair<long long, unsigned long>, nel::ParseError>::Result(nel::Result<nel::Pair<long long, unsigned long>, nel::ParseError>::Phantom<(nel::Result<nel::Pair<long long, unsigned long>, nel::ParseError>::Tag)1>, nel::Pair<long long, unsigned long>&&)>:
+        constexpr Result(Phantom<Tag::OK> const, T &&v)
+    448a:	55                   	push   %rbp
+    448b:	48 89 e5             	mov    %rsp,%rbp
+    448e:	53                   	push   %rbx
+    448f:	48 83 ec 18          	sub    $0x18,%rsp
+    4493:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    4497:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    449b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    449f:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<T>(v))
+    44a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    44a9:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    44ad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    44b1:	48 89 c7             	mov    %rax,%rdi
+    44b4:	e8 c2 ff ff ff       	call   447b <nel::Pair<long long, unsigned long>&& nel::forward<nel::Pair<long long, unsigned long>, nel::Pair<long long, unsigned long> >(nel::Pair<long long, unsigned long>&)>
+    44b9:	48 89 c6             	mov    %rax,%rsi
+    44bc:	48 89 df             	mov    %rbx,%rdi
+    44bf:	e8 1a 01 00 00       	call   45de <nel::Element<nel::Pair<long long, unsigned long> >::Element(nel::Pair<long long, unsigned long>&&)>
+        }
+    44c4:	90                   	nop
+    44c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    44c9:	c9                   	leave
+    44ca:	c3                   	ret
+    44cb:	90                   	nop
+
+00000000000044cc <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Result(nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Phantom<(nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Tag)2>, nel::ParseError&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    44cc:	55                   	push   %rbp
+    44cd:	48 89 e5             	mov    %rsp,%rbp
+    44d0:	53                   	push   %rbx
+    44d1:	48 83 ec 18          	sub    $0x18,%rsp
+    44d5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    44d9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    44dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    44e1:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    44e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    44eb:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    44ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    44f3:	48 89 c7             	mov    %rax,%rdi
+    44f6:	e8 83 df ff ff       	call   247e <nel::ParseError&& nel::forward<nel::ParseError, nel::ParseError>(nel::ParseError&)>
+    44fb:	48 89 c6             	mov    %rax,%rsi
+    44fe:	48 89 df             	mov    %rbx,%rdi
+    4501:	e8 4a 00 00 00       	call   4550 <nel::Element<nel::ParseError>::Element(nel::ParseError&&)>
+        }
+    4506:	90                   	nop
+    4507:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    450b:	c9                   	leave
+    450c:	c3                   	ret
+    450d:	90                   	nop
+
+000000000000450e <nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Result(nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Phantom<(nel::Result<nel::Pair<double, unsigned long>, nel::ParseError>::Tag)1>, nel::Pair<double, unsigned long>&&)>:
+        constexpr Result(Phantom<Tag::OK> const, T &&v)
+    450e:	55                   	push   %rbp
+    450f:	48 89 e5             	mov    %rsp,%rbp
+    4512:	53                   	push   %rbx
+    4513:	48 83 ec 18          	sub    $0x18,%rsp
+    4517:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    451b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    451f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4523:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<T>(v))
+    4529:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    452d:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    4531:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4535:	48 89 c7             	mov    %rax,%rdi
+    4538:	e8 e6 dd ff ff       	call   2323 <nel::Pair<double, unsigned long>&& nel::forward<nel::Pair<double, unsigned long>, nel::Pair<double, unsigned long> >(nel::Pair<double, unsigned long>&)>
+    453d:	48 89 c6             	mov    %rax,%rsi
+    4540:	48 89 df             	mov    %rbx,%rdi
+    4543:	e8 c8 00 00 00       	call   4610 <nel::Element<nel::Pair<double, unsigned long> >::Element(nel::Pair<double, unsigned long>&&)>
+        }
+    4548:	90                   	nop
+    4549:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    454d:	c9                   	leave
+    454e:	c3                   	ret
+    454f:	90                   	nop
+
+0000000000004550 <nel::Element<nel::ParseError>::Element(nel::ParseError&&)>:
+        constexpr Element(Type &&val)
+    4550:	55                   	push   %rbp
+    4551:	48 89 e5             	mov    %rsp,%rbp
+    4554:	48 83 ec 10          	sub    $0x10,%rsp
+    4558:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    455c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    4560:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4564:	48 89 c7             	mov    %rax,%rdi
+    4567:	e8 12 df ff ff       	call   247e <nel::ParseError&& nel::forward<nel::ParseError, nel::ParseError>(nel::ParseError&)>
+    456c:	8b 10                	mov    (%rax),%edx
+    456e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4572:	89 10                	mov    %edx,(%rax)
+        }
+    4574:	90                   	nop
+    4575:	c9                   	leave
+    4576:	c3                   	ret
+    4577:	90                   	nop
+
+0000000000004578 <nel::Element<nel::Pair<unsigned long long, unsigned long> >::Element(nel::Pair<unsigned long long, unsigned long>&&)>:
+        constexpr Element(Type &&val)
+    4578:	55                   	push   %rbp
+    4579:	48 89 e5             	mov    %rsp,%rbp
+    457c:	48 83 ec 10          	sub    $0x10,%rsp
+    4580:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4584:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    4588:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    458c:	48 89 c7             	mov    %rax,%rdi
+    458f:	e8 b7 dc ff ff       	call   224b <nel::Pair<unsigned long long, unsigned long>&& nel::forward<nel::Pair<unsigned long long, unsigned long>, nel::Pair<unsigned long long, unsigned long> >(nel::Pair<unsigned long long, unsigned long>&)>
+    4594:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    4598:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    459c:	48 8b 00             	mov    (%rax),%rax
+    459f:	48 89 01             	mov    %rax,(%rcx)
+    45a2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        }
+    45a6:	90                   	nop
+    45a7:	c9                   	leave
+    45a8:	c3                   	ret
+    45a9:	90                   	nop
+
+00000000000045aa <nel::Element<nel::Pair<unsigned long long, unsigned long> >::operator*() const>:
+        constexpr Type const &operator*(void) const
+    45aa:	55                   	push   %rbp
+    45ab:	48 89 e5             	mov    %rsp,%rbp
+    45ae:	48 83 ec 10          	sub    $0x10,%rsp
+    45b2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    45b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    45ba:	48 89 c7             	mov    %rax,%rdi
+    45bd:	e8 80 00 00 00       	call   4642 <nel::Element<nel::Pair<unsigned long long, unsigned long> >::ref() const>
+        }
+    45c2:	c9                   	leave
+    45c3:	c3                   	ret
+
+00000000000045c4 <nel::Element<nel::ParseError>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    45c4:	55                   	push   %rbp
+    45c5:	48 89 e5             	mov    %rsp,%rbp
+    45c8:	48 83 ec 10          	sub    $0x10,%rsp
+    45cc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    45d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    45d4:	48 89 c7             	mov    %rax,%rdi
+    45d7:	e8 74 00 00 00       	call   4650 <nel::Element<nel::ParseError>::ref() const>
+        }
+    45dc:	c9                   	leave
+    45dd:	c3                   	ret
+
+00000000000045de <nel::Element<nel::Pair<long long, unsigned long> >::Element(nel::Pair<long long, unsigned long>&&)>:
+        constexpr Element(Type &&val)
+    45de:	55                   	push   %rbp
+    45df:	48 89 e5             	mov    %rsp,%rbp
+    45e2:	48 83 ec 10          	sub    $0x10,%rsp
+    45e6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    45ea:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    45ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    45f2:	48 89 c7             	mov    %rax,%rdi
+    45f5:	e8 81 fe ff ff       	call   447b <nel::Pair<long long, unsigned long>&& nel::forward<nel::Pair<long long, unsigned long>, nel::Pair<long long, unsigned long> >(nel::Pair<long long, unsigned long>&)>
+    45fa:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    45fe:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    4602:	48 8b 00             	mov    (%rax),%rax
+    4605:	48 89 01             	mov    %rax,(%rcx)
+    4608:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        }
+    460c:	90                   	nop
+    460d:	c9                   	leave
+    460e:	c3                   	ret
+    460f:	90                   	nop
+
+0000000000004610 <nel::Element<nel::Pair<double, unsigned long> >::Element(nel::Pair<double, unsigned long>&&)>:
+        constexpr Element(Type &&val)
+    4610:	55                   	push   %rbp
+    4611:	48 89 e5             	mov    %rsp,%rbp
+    4614:	48 83 ec 10          	sub    $0x10,%rsp
+    4618:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    461c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    4620:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4624:	48 89 c7             	mov    %rax,%rdi
+    4627:	e8 f7 dc ff ff       	call   2323 <nel::Pair<double, unsigned long>&& nel::forward<nel::Pair<double, unsigned long>, nel::Pair<double, unsigned long> >(nel::Pair<double, unsigned long>&)>
+    462c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    4630:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    4634:	48 8b 00             	mov    (%rax),%rax
+    4637:	48 89 01             	mov    %rax,(%rcx)
+    463a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        }
+    463e:	90                   	nop
+    463f:	c9                   	leave
+    4640:	c3                   	ret
+    4641:	90                   	nop
+
+0000000000004642 <nel::Element<nel::Pair<unsigned long long, unsigned long> >::ref() const>:
+        constexpr Type const &ref(void) const
+    4642:	55                   	push   %rbp
+    4643:	48 89 e5             	mov    %rsp,%rbp
+    4646:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    464a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    464e:	5d                   	pop    %rbp
+    464f:	c3                   	ret
+
+0000000000004650 <nel::Element<nel::ParseError>::ref() const>:
+        constexpr Type const &ref(void) const
+    4650:	55                   	push   %rbp
+    4651:	48 89 e5             	mov    %rsp,%rbp
+    4654:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    4658:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    465c:	5d                   	pop    %rbp
+    465d:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000004660 <_fini>:
+    4660:	48 83 ec 08          	sub    $0x8,%rsp
+    4664:	48 83 c4 08          	add    $0x8,%rsp
+    4668:	c3                   	ret
@@ -0,0 +1,4862 @@
+
+target/debug/examples/bench_poison:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 cd 5f 00 00 	mov    0x5fcd(%rip),%rax        # 6fd8 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <memcmp@plt-0x10>:
+    1020:	ff 35 ca 5f 00 00    	push   0x5fca(%rip)        # 6ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 5f 00 00    	jmp    *0x5fcc(%rip)        # 6ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <memcmp@plt>:
+    1030:	ff 25 ca 5f 00 00    	jmp    *0x5fca(%rip)        # 7000 <memcmp@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <memset@plt>:
+    1040:	ff 25 c2 5f 00 00    	jmp    *0x5fc2(%rip)        # 7008 <memset@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <abort@plt>:
+    1050:	ff 25 ba 5f 00 00    	jmp    *0x5fba(%rip)        # 7010 <abort@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memcpy@plt>:
+    1060:	ff 25 b2 5f 00 00    	jmp    *0x5fb2(%rip)        # 7018 <memcpy@GLIBC_2.14>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <clock_gettime@plt>:
+    1070:	ff 25 aa 5f 00 00    	jmp    *0x5faa(%rip)        # 7020 <clock_gettime@GLIBC_2.17>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <operator new(unsigned long)@plt>:
+    1080:	ff 25 a2 5f 00 00    	jmp    *0x5fa2(%rip)        # 7028 <operator new(unsigned long)@GLIBCXX_3.4>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <operator delete(void*, unsigned long)@plt>:
+    1090:	ff 25 9a 5f 00 00    	jmp    *0x5f9a(%rip)        # 7030 <operator delete(void*, unsigned long)@CXXABI_1.3.9>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <fputs@plt>:
+    10a0:	ff 25 92 5f 00 00    	jmp    *0x5f92(%rip)        # 7038 <fputs@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <free@plt>:
+    10b0:	ff 25 8a 5f 00 00    	jmp    *0x5f8a(%rip)        # 7040 <free@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <fputc@plt>:
+    10c0:	ff 25 82 5f 00 00    	jmp    *0x5f82(%rip)        # 7048 <fputc@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <fprintf@plt>:
+    10d0:	ff 25 7a 5f 00 00    	jmp    *0x5f7a(%rip)        # 7050 <fprintf@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010e0 <memmove@plt>:
+    10e0:	ff 25 72 5f 00 00    	jmp    *0x5f72(%rip)        # 7058 <memmove@GLIBC_2.2.5>
+    10e6:	68 0b 00 00 00       	push   $0xb
+    10eb:	e9 30 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010f0 <realloc@plt>:
+    10f0:	ff 25 6a 5f 00 00    	jmp    *0x5f6a(%rip)        # 7060 <realloc@GLIBC_2.2.5>
+    10f6:	68 0c 00 00 00       	push   $0xc
+    10fb:	e9 20 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+0000000000001100 <__cxa_finalize@plt>:
+    1100:	ff 25 ba 5e 00 00    	jmp    *0x5eba(%rip)        # 6fc0 <__cxa_finalize@GLIBC_2.2.5>
+    1106:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+0000000000001110 <_start>:
+    1110:	31 ed                	xor    %ebp,%ebp
+    1112:	49 89 d1             	mov    %rdx,%r9
+    1115:	5e                   	pop    %rsi
+    1116:	48 89 e2             	mov    %rsp,%rdx
+    1119:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    111d:	50                   	push   %rax
+    111e:	54                   	push   %rsp
+    111f:	45 31 c0             	xor    %r8d,%r8d
+    1122:	31 c9                	xor    %ecx,%ecx
+    1124:	48 8d 3d f9 03 00 00 	lea    0x3f9(%rip),%rdi        # 1524 <main>
+    112b:	ff 15 97 5e 00 00    	call   *0x5e97(%rip)        # 6fc8 <__libc_start_main@GLIBC_2.34>
+    1131:	f4                   	hlt
+    1132:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1139:	00 00 00 
+    113c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001140 <deregister_tm_clones>:
+    1140:	    48 8d 3d 31 5f 00 00 	lea    0x5f31(%rip),%rdi        # 7078 <__TMC_END__>
+    1147:	    48 8d 05 2a 5f 00 00 	lea    0x5f2a(%rip),%rax        # 7078 <__TMC_END__>
+    114e:	    48 39 f8             	cmp    %rdi,%rax
+    1151:	/-- 74 15                	je     1168 <deregister_tm_clones+0x28>
+    1153:	|   48 8b 05 76 5e 00 00 	mov    0x5e76(%rip),%rax        # 6fd0 <_ITM_deregisterTMCloneTable@Base>
+    115a:	|   48 85 c0             	test   %rax,%rax
+    115d:	+-- 74 09                	je     1168 <deregister_tm_clones+0x28>
+    115f:	|   ff e0                	jmp    *%rax
+    1161:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1168:	\-> c3                   	ret
+    1169:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001170 <register_tm_clones>:
+    1170:	    48 8d 3d 01 5f 00 00 	lea    0x5f01(%rip),%rdi        # 7078 <__TMC_END__>
+    1177:	    48 8d 35 fa 5e 00 00 	lea    0x5efa(%rip),%rsi        # 7078 <__TMC_END__>
+    117e:	    48 29 fe             	sub    %rdi,%rsi
+    1181:	    48 89 f0             	mov    %rsi,%rax
+    1184:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1188:	    48 c1 f8 03          	sar    $0x3,%rax
+    118c:	    48 01 c6             	add    %rax,%rsi
+    118f:	    48 d1 fe             	sar    %rsi
+    1192:	/-- 74 14                	je     11a8 <register_tm_clones+0x38>
+    1194:	|   48 8b 05 45 5e 00 00 	mov    0x5e45(%rip),%rax        # 6fe0 <_ITM_registerTMCloneTable@Base>
+    119b:	|   48 85 c0             	test   %rax,%rax
+    119e:	+-- 74 08                	je     11a8 <register_tm_clones+0x38>
+    11a0:	|   ff e0                	jmp    *%rax
+    11a2:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    11a8:	\-> c3                   	ret
+    11a9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011b0 <__do_global_dtors_aux>:
+    11b0:	       f3 0f 1e fa          	endbr64
+    11b4:	       80 3d cd 5e 00 00 00 	cmpb   $0x0,0x5ecd(%rip)        # 7088 <completed.0>
+    11bb:	/----- 75 2b                	jne    11e8 <__do_global_dtors_aux+0x38>
+    11bd:	|      55                   	push   %rbp
+    11be:	|      48 83 3d fa 5d 00 00 	cmpq   $0x0,0x5dfa(%rip)        # 6fc0 <__cxa_finalize@GLIBC_2.2.5>
+    11c5:	|      00 
+    11c6:	|      48 89 e5             	mov    %rsp,%rbp
+    11c9:	|  /-- 74 0c                	je     11d7 <__do_global_dtors_aux+0x27>
+    11cb:	|  |   48 8b 3d 9e 5e 00 00 	mov    0x5e9e(%rip),%rdi        # 7070 <__dso_handle>
+    11d2:	|  |   e8 29 ff ff ff       	call   1100 <__cxa_finalize@plt>
+    11d7:	|  \-> e8 64 ff ff ff       	call   1140 <deregister_tm_clones>
+    11dc:	|      c6 05 a5 5e 00 00 01 	movb   $0x1,0x5ea5(%rip)        # 7088 <completed.0>
+    11e3:	|      5d                   	pop    %rbp
+    11e4:	|      c3                   	ret
+    11e5:	|      0f 1f 00             	nopl   (%rax)
+    11e8:	\----> c3                   	ret
+    11e9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011f0 <frame_dummy>:
+    11f0:	f3 0f 1e fa          	endbr64
+    11f4:	e9 77 ff ff ff       	jmp    1170 <register_tm_clones>
+    11f9:	90                   	nop
+
+00000000000011fa <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    11fa:	55                   	push   %rbp
+    11fb:	48 89 e5             	mov    %rsp,%rbp
+    11fe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1202:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1205:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    120a:	5d                   	pop    %rbp
+    120b:	c3                   	ret
+
+000000000000120c <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    120c:	55                   	push   %rbp
+    120d:	48 89 e5             	mov    %rsp,%rbp
+    1210:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1214:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1217:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return -1;
+    121b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1220:	5d                   	pop    %rbp
+    1221:	c3                   	ret
+
+0000000000001222 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    1222:	55                   	push   %rbp
+    1223:	48 89 e5             	mov    %rsp,%rbp
+    1226:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    122a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    122d:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    return -1;
+    1230:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1235:	5d                   	pop    %rbp
+    1236:	c3                   	ret
+
+0000000000001237 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    1237:	55                   	push   %rbp
+    1238:	48 89 e5             	mov    %rsp,%rbp
+    123b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    123f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1242:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    1245:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    return -1;
+    1248:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    124d:	5d                   	pop    %rbp
+    124e:	c3                   	ret
+
+000000000000124f <_read_r>:
+int _read_r(struct _reent *, int) {
+    124f:	55                   	push   %rbp
+    1250:	48 89 e5             	mov    %rsp,%rbp
+    1253:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1257:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    125a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    125f:	5d                   	pop    %rbp
+    1260:	c3                   	ret
+
+0000000000001261 <_write_r>:
+int _write_r(struct _reent *, int, char *, int) {
+    1261:	55                   	push   %rbp
+    1262:	48 89 e5             	mov    %rsp,%rbp
+    1265:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1269:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    126c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1270:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+    return -1;
+    1273:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1278:	5d                   	pop    %rbp
+    1279:	c3                   	ret
+
+000000000000127a <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    127a:	55                   	push   %rbp
+    127b:	48 89 e5             	mov    %rsp,%rbp
+    127e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return -1;
+    1282:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1287:	5d                   	pop    %rbp
+    1288:	c3                   	ret
+
+0000000000001289 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1289:	55                   	push   %rbp
+    128a:	48 89 e5             	mov    %rsp,%rbp
+    128d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1291:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1294:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1299:	5d                   	pop    %rbp
+    129a:	c3                   	ret
+    129b:	90                   	nop
+
+000000000000129c <bench_moves()::{lambda()#1}::operator()() const>:
+
+void bench_moves(void)
+{
+    long unsigned int const bytes = 2UL * n_moves * buf_size;
+
+    auto t1 = bench::time_ns([]() {
+    129c:	       55                   	push   %rbp
+    129d:	       48 89 e5             	mov    %rsp,%rbp
+    12a0:	       48 83 ec 20          	sub    $0x20,%rsp
+    12a4:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (Index i = 0; i < n_moves; ++i) {
+    12a8:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    12af:	       00 
+    12b0:	   /-- eb 69                	jmp    131b <bench_moves()::{lambda()#1}::operator()() const+0x7f>
+            nel::elem::copy(buf2, buf1, buf_size);
+    12b2:	/--|-> ba 00 00 01 00       	mov    $0x10000,%edx
+    12b7:	|  |   48 8d 05 e2 5d 00 00 	lea    0x5de2(%rip),%rax        # 70a0 <buf1>
+    12be:	|  |   48 89 c6             	mov    %rax,%rsi
+    12c1:	|  |   48 8d 05 d8 5d 01 00 	lea    0x15dd8(%rip),%rax        # 170a0 <buf2>
+    12c8:	|  |   48 89 c7             	mov    %rax,%rdi
+    12cb:	|  |   e8 23 22 00 00       	call   34f3 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+            nel::elem::wipe(buf1, buf_size);
+    12d0:	|  |   be 00 00 01 00       	mov    $0x10000,%esi
+    12d5:	|  |   48 8d 05 c4 5d 00 00 	lea    0x5dc4(%rip),%rax        # 70a0 <buf1>
+    12dc:	|  |   48 89 c7             	mov    %rax,%rdi
+    12df:	|  |   e8 da 22 00 00       	call   35be <nel::elem::wipe(unsigned char*, unsigned long)>
+            nel::elem::copy(buf1, buf2, buf_size);
+    12e4:	|  |   ba 00 00 01 00       	mov    $0x10000,%edx
+    12e9:	|  |   48 8d 05 b0 5d 01 00 	lea    0x15db0(%rip),%rax        # 170a0 <buf2>
+    12f0:	|  |   48 89 c6             	mov    %rax,%rsi
+    12f3:	|  |   48 8d 05 a6 5d 00 00 	lea    0x5da6(%rip),%rax        # 70a0 <buf1>
+    12fa:	|  |   48 89 c7             	mov    %rax,%rdi
+    12fd:	|  |   e8 f1 21 00 00       	call   34f3 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+            nel::elem::wipe(buf2, buf_size);
+    1302:	|  |   be 00 00 01 00       	mov    $0x10000,%esi
+    1307:	|  |   48 8d 05 92 5d 01 00 	lea    0x15d92(%rip),%rax        # 170a0 <buf2>
+    130e:	|  |   48 89 c7             	mov    %rax,%rdi
+    1311:	|  |   e8 a8 22 00 00       	call   35be <nel::elem::wipe(unsigned char*, unsigned long)>
+        for (Index i = 0; i < n_moves; ++i) {
+    1316:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    131b:	|  \-> 48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1322:	|      00 
+    1323:	\----- 76 8d                	jbe    12b2 <bench_moves()::{lambda()#1}::operator()() const+0x16>
+        }
+    });
+    1325:	       90                   	nop
+    1326:	       90                   	nop
+    1327:	       c9                   	leave
+    1328:	       c3                   	ret
+    1329:	       90                   	nop
+
+000000000000132a <bench_moves()::{lambda()#2}::operator()() const>:
+    bench::report("move, poisoned", t1, bytes);
+
+    auto t2 = bench::time_ns([]() {
+    132a:	       55                   	push   %rbp
+    132b:	       48 89 e5             	mov    %rsp,%rbp
+    132e:	       48 83 ec 20          	sub    $0x20,%rsp
+    1332:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (Index i = 0; i < n_moves; ++i) {
+    1336:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    133d:	       00 
+    133e:	   /-- eb 41                	jmp    1381 <bench_moves()::{lambda()#2}::operator()() const+0x57>
+            nel::elem::copy(buf2, buf1, buf_size);
+    1340:	/--|-> ba 00 00 01 00       	mov    $0x10000,%edx
+    1345:	|  |   48 8d 05 54 5d 00 00 	lea    0x5d54(%rip),%rax        # 70a0 <buf1>
+    134c:	|  |   48 89 c6             	mov    %rax,%rsi
+    134f:	|  |   48 8d 05 4a 5d 01 00 	lea    0x15d4a(%rip),%rax        # 170a0 <buf2>
+    1356:	|  |   48 89 c7             	mov    %rax,%rdi
+    1359:	|  |   e8 95 21 00 00       	call   34f3 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+            nel::elem::copy(buf1, buf2, buf_size);
+    135e:	|  |   ba 00 00 01 00       	mov    $0x10000,%edx
+    1363:	|  |   48 8d 05 36 5d 01 00 	lea    0x15d36(%rip),%rax        # 170a0 <buf2>
+    136a:	|  |   48 89 c6             	mov    %rax,%rsi
+    136d:	|  |   48 8d 05 2c 5d 00 00 	lea    0x5d2c(%rip),%rax        # 70a0 <buf1>
+    1374:	|  |   48 89 c7             	mov    %rax,%rdi
+    1377:	|  |   e8 77 21 00 00       	call   34f3 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        for (Index i = 0; i < n_moves; ++i) {
+    137c:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1381:	|  \-> 48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1388:	|      00 
+    1389:	\----- 76 b5                	jbe    1340 <bench_moves()::{lambda()#2}::operator()() const+0x16>
+        }
+    });
+    138b:	       90                   	nop
+    138c:	       90                   	nop
+    138d:	       c9                   	leave
+    138e:	       c3                   	ret
+    138f:	       90                   	nop
+
+0000000000001390 <bench_moves()::{lambda()#3}::operator()() const>:
+    bench::report("move, not poisoned", t2, bytes);
+
+    // what the build gives, as used by U8Buf.
+    U8Buf<buf_size> *a = new U8Buf<buf_size>((uint8_t)0x12);
+    U8Buf<buf_size> *b = new U8Buf<buf_size>((uint8_t)0x34);
+    auto t3 = bench::time_ns([a, b]() {
+    1390:	       55                   	push   %rbp
+    1391:	       48 89 e5             	mov    %rsp,%rbp
+    1394:	       48 83 ec 20          	sub    $0x20,%rsp
+    1398:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (Index i = 0; i < n_moves; ++i) {
+    139c:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    13a3:	       00 
+    13a4:	   /-- eb 4f                	jmp    13f5 <bench_moves()::{lambda()#3}::operator()() const+0x65>
+    auto t3 = bench::time_ns([a, b]() {
+    13a6:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13aa:	|  |   48 8b 00             	mov    (%rax),%rax
+            *b = nel::move(*a);
+    13ad:	|  |   48 89 c7             	mov    %rax,%rdi
+    13b0:	|  |   e8 14 06 00 00       	call   19c9 <U8Buf<65536ul>&& nel::move<U8Buf<65536ul> >(U8Buf<65536ul>&)>
+    13b5:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t3 = bench::time_ns([a, b]() {
+    13b8:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13bc:	|  |   48 8b 40 08          	mov    0x8(%rax),%rax
+            *b = nel::move(*a);
+    13c0:	|  |   48 89 d6             	mov    %rdx,%rsi
+    13c3:	|  |   48 89 c7             	mov    %rax,%rdi
+    13c6:	|  |   e8 0d 06 00 00       	call   19d8 <U8Buf<65536ul>::operator=(U8Buf<65536ul>&&)>
+    auto t3 = bench::time_ns([a, b]() {
+    13cb:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13cf:	|  |   48 8b 40 08          	mov    0x8(%rax),%rax
+            *a = nel::move(*b);
+    13d3:	|  |   48 89 c7             	mov    %rax,%rdi
+    13d6:	|  |   e8 ee 05 00 00       	call   19c9 <U8Buf<65536ul>&& nel::move<U8Buf<65536ul> >(U8Buf<65536ul>&)>
+    13db:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t3 = bench::time_ns([a, b]() {
+    13de:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13e2:	|  |   48 8b 00             	mov    (%rax),%rax
+            *a = nel::move(*b);
+    13e5:	|  |   48 89 d6             	mov    %rdx,%rsi
+    13e8:	|  |   48 89 c7             	mov    %rax,%rdi
+    13eb:	|  |   e8 e8 05 00 00       	call   19d8 <U8Buf<65536ul>::operator=(U8Buf<65536ul>&&)>
+        for (Index i = 0; i < n_moves; ++i) {
+    13f0:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    13f5:	|  \-> 48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    13fc:	|      00 
+    13fd:	\----- 76 a7                	jbe    13a6 <bench_moves()::{lambda()#3}::operator()() const+0x16>
+        }
+    });
+    13ff:	       90                   	nop
+    1400:	       90                   	nop
+    1401:	       c9                   	leave
+    1402:	       c3                   	ret
+
+0000000000001403 <bench_moves()>:
+{
+    1403:	    55                   	push   %rbp
+    1404:	    48 89 e5             	mov    %rsp,%rbp
+    1407:	    53                   	push   %rbx
+    1408:	    48 83 ec 58          	sub    $0x58,%rsp
+    long unsigned int const bytes = 2UL * n_moves * buf_size;
+    140c:	    48 c7 45 e8 00 00 00 	movq   $0x20000000,-0x18(%rbp)
+    1413:	    20 
+    auto t1 = bench::time_ns([]() {
+    1414:	    48 8d 45 ae          	lea    -0x52(%rbp),%rax
+    1418:	    48 89 c7             	mov    %rax,%rdi
+    141b:	    e8 32 01 00 00       	call   1552 <unsigned long bench::time_ns<bench_moves()::{lambda()#1}>(bench_moves()::{lambda()#1}&&)>
+    1420:	    48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    bench::report("move, poisoned", t1, bytes);
+    1424:	    48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1428:	    ba 00 00 00 20       	mov    $0x20000000,%edx
+    142d:	    48 89 c6             	mov    %rax,%rsi
+    1430:	    48 8d 05 09 2c 00 00 	lea    0x2c09(%rip),%rax        # 4040 <n_moves+0x8>
+    1437:	    48 89 c7             	mov    %rax,%rdi
+    143a:	    e8 c4 01 00 00       	call   1603 <bench::report(char const*, unsigned long, unsigned long)>
+    auto t2 = bench::time_ns([]() {
+    143f:	    48 8d 45 af          	lea    -0x51(%rbp),%rax
+    1443:	    48 89 c7             	mov    %rax,%rdi
+    1446:	    e8 33 01 00 00       	call   157e <unsigned long bench::time_ns<bench_moves()::{lambda()#2}>(bench_moves()::{lambda()#2}&&)>
+    144b:	    48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    bench::report("move, not poisoned", t2, bytes);
+    144f:	    48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1453:	    ba 00 00 00 20       	mov    $0x20000000,%edx
+    1458:	    48 89 c6             	mov    %rax,%rsi
+    145b:	    48 8d 05 ed 2b 00 00 	lea    0x2bed(%rip),%rax        # 404f <n_moves+0x17>
+    1462:	    48 89 c7             	mov    %rax,%rdi
+    1465:	    e8 99 01 00 00       	call   1603 <bench::report(char const*, unsigned long, unsigned long)>
+    U8Buf<buf_size> *a = new U8Buf<buf_size>((uint8_t)0x12);
+    146a:	    bf 00 00 01 00       	mov    $0x10000,%edi
+    146f:	    e8 0c fc ff ff       	call   1080 <operator new(unsigned long)@plt>
+    1474:	    48 89 c3             	mov    %rax,%rbx
+    1477:	    be 12 00 00 00       	mov    $0x12,%esi
+    147c:	    48 89 df             	mov    %rbx,%rdi
+    147f:	    e8 1a 05 00 00       	call   199e <U8Buf<65536ul>::U8Buf(unsigned char)>
+    1484:	    48 89 5d d0          	mov    %rbx,-0x30(%rbp)
+    U8Buf<buf_size> *b = new U8Buf<buf_size>((uint8_t)0x34);
+    1488:	    bf 00 00 01 00       	mov    $0x10000,%edi
+    148d:	    e8 ee fb ff ff       	call   1080 <operator new(unsigned long)@plt>
+    1492:	    48 89 c3             	mov    %rax,%rbx
+    1495:	    be 34 00 00 00       	mov    $0x34,%esi
+    149a:	    48 89 df             	mov    %rbx,%rdi
+    149d:	    e8 fc 04 00 00       	call   199e <U8Buf<65536ul>::U8Buf(unsigned char)>
+    14a2:	    48 89 5d c8          	mov    %rbx,-0x38(%rbp)
+    auto t3 = bench::time_ns([a, b]() {
+    14a6:	    48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    14aa:	    48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    14ae:	    48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    14b2:	    48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    14b6:	    48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    14ba:	    48 89 c7             	mov    %rax,%rdi
+    14bd:	    e8 e8 00 00 00       	call   15aa <unsigned long bench::time_ns<bench_moves()::{lambda()#3}>(bench_moves()::{lambda()#3}&&)>
+    14c2:	    48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    bench::report(nel::elem::poisoning ? "U8Buf move, build default (poisoned)"
+    14c6:	    48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    14ca:	    ba 00 00 00 20       	mov    $0x20000000,%edx
+    14cf:	    48 89 c6             	mov    %rax,%rsi
+    14d2:	    48 8d 05 8f 2b 00 00 	lea    0x2b8f(%rip),%rax        # 4068 <n_moves+0x30>
+    14d9:	    48 89 c7             	mov    %rax,%rdi
+    14dc:	    e8 22 01 00 00       	call   1603 <bench::report(char const*, unsigned long, unsigned long)>
+                                       : "U8Buf move, build default (not poisoned)",
+                  t3, bytes);
+    delete a;
+    14e1:	    48 8b 5d d0          	mov    -0x30(%rbp),%rbx
+    14e5:	    48 85 db             	test   %rbx,%rbx
+    14e8:	/-- 74 15                	je     14ff <bench_moves()+0xfc>
+    14ea:	|   48 89 df             	mov    %rbx,%rdi
+    14ed:	|   e8 14 05 00 00       	call   1a06 <U8Buf<65536ul>::~U8Buf()>
+    14f2:	|   be 00 00 01 00       	mov    $0x10000,%esi
+    14f7:	|   48 89 df             	mov    %rbx,%rdi
+    14fa:	|   e8 91 fb ff ff       	call   1090 <operator delete(void*, unsigned long)@plt>
+    delete b;
+    14ff:	\-> 48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+    1503:	    48 85 db             	test   %rbx,%rbx
+    1506:	/-- 74 15                	je     151d <bench_moves()+0x11a>
+    1508:	|   48 89 df             	mov    %rbx,%rdi
+    150b:	|   e8 f6 04 00 00       	call   1a06 <U8Buf<65536ul>::~U8Buf()>
+    1510:	|   be 00 00 01 00       	mov    $0x10000,%esi
+    1515:	|   48 89 df             	mov    %rbx,%rdi
+    1518:	|   e8 73 fb ff ff       	call   1090 <operator delete(void*, unsigned long)@plt>
+}
+    151d:	\-> 90                   	nop
+    151e:	    48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1522:	    c9                   	leave
+    1523:	    c3                   	ret
+
+0000000000001524 <main>:
+    });
+    bench::report(name, t);
+}
+
+int main()
+{
+    1524:	55                   	push   %rbp
+    1525:	48 89 e5             	mov    %rsp,%rbp
+    bench_moves();
+    1528:	e8 d6 fe ff ff       	call   1403 <bench_moves()>
+    bench_growth<nel::heaped::Poisoned<true>>("vector growth, poisoned");
+    152d:	48 8d 05 59 2b 00 00 	lea    0x2b59(%rip),%rax        # 408d <n_moves+0x55>
+    1534:	48 89 c7             	mov    %rax,%rdi
+    1537:	e8 c2 05 00 00       	call   1afe <void bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)>
+    bench_growth<nel::heaped::Poisoned<false>>("vector growth, not poisoned");
+    153c:	48 8d 05 62 2b 00 00 	lea    0x2b62(%rip),%rax        # 40a5 <n_moves+0x6d>
+    1543:	48 89 c7             	mov    %rax,%rdi
+    1546:	e8 bd 06 00 00       	call   1c08 <void bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)>
+}
+    154b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1550:	5d                   	pop    %rbp
+    1551:	c3                   	ret
+
+0000000000001552 <unsigned long bench::time_ns<bench_moves()::{lambda()#1}>(bench_moves()::{lambda()#1}&&)>:
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+}
+
+// Time a run of f(), in ns.
+template<typename F>
+long unsigned int time_ns(F &&f)
+    1552:	55                   	push   %rbp
+    1553:	48 89 e5             	mov    %rsp,%rbp
+    1556:	48 83 ec 20          	sub    $0x20,%rsp
+    155a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+{
+    long unsigned int const b = now_ns();
+    155e:	e8 73 00 00 00       	call   15d6 <bench::now_ns()>
+    1563:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    1567:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    156b:	48 89 c7             	mov    %rax,%rdi
+    156e:	e8 29 fd ff ff       	call   129c <bench_moves()::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    1573:	e8 5e 00 00 00       	call   15d6 <bench::now_ns()>
+    1578:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    157c:	c9                   	leave
+    157d:	c3                   	ret
+
+000000000000157e <unsigned long bench::time_ns<bench_moves()::{lambda()#2}>(bench_moves()::{lambda()#2}&&)>:
+long unsigned int time_ns(F &&f)
+    157e:	55                   	push   %rbp
+    157f:	48 89 e5             	mov    %rsp,%rbp
+    1582:	48 83 ec 20          	sub    $0x20,%rsp
+    1586:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    158a:	e8 47 00 00 00       	call   15d6 <bench::now_ns()>
+    158f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    1593:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1597:	48 89 c7             	mov    %rax,%rdi
+    159a:	e8 8b fd ff ff       	call   132a <bench_moves()::{lambda()#2}::operator()() const>
+    return now_ns() - b;
+    159f:	e8 32 00 00 00       	call   15d6 <bench::now_ns()>
+    15a4:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    15a8:	c9                   	leave
+    15a9:	c3                   	ret
+
+00000000000015aa <unsigned long bench::time_ns<bench_moves()::{lambda()#3}>(bench_moves()::{lambda()#3}&&)>:
+long unsigned int time_ns(F &&f)
+    15aa:	55                   	push   %rbp
+    15ab:	48 89 e5             	mov    %rsp,%rbp
+    15ae:	48 83 ec 20          	sub    $0x20,%rsp
+    15b2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    15b6:	e8 1b 00 00 00       	call   15d6 <bench::now_ns()>
+    15bb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    15bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15c3:	48 89 c7             	mov    %rax,%rdi
+    15c6:	e8 c5 fd ff ff       	call   1390 <bench_moves()::{lambda()#3}::operator()() const>
+    return now_ns() - b;
+    15cb:	e8 06 00 00 00       	call   15d6 <bench::now_ns()>
+    15d0:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    15d4:	c9                   	leave
+    15d5:	c3                   	ret
+
+00000000000015d6 <bench::now_ns()>:
+static constexpr Length buf_size = 64 * 1024;
+    15d6:	55                   	push   %rbp
+    15d7:	48 89 e5             	mov    %rsp,%rbp
+    15da:	48 83 ec 10          	sub    $0x10,%rsp
+
+    15de:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    15e2:	48 89 c6             	mov    %rax,%rsi
+    15e5:	bf 01 00 00 00       	mov    $0x1,%edi
+    15ea:	e8 81 fa ff ff       	call   1070 <clock_gettime@plt>
+// buffers to move between, byte-wise.
+    15ef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15f3:	48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+    15fa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    15fe:	48 01 d0             	add    %rdx,%rax
+static uint8_t buf1[buf_size];
+    1601:	c9                   	leave
+    1602:	c3                   	ret
+
+0000000000001603 <bench::report(char const*, unsigned long, unsigned long)>:
+    });
+    1603:	    55                   	push   %rbp
+    1604:	    48 89 e5             	mov    %rsp,%rbp
+    1607:	    48 83 ec 20          	sub    $0x20,%rsp
+    160b:	    48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    160f:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1613:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    bench::report("move, poisoned", t1, bytes);
+    1617:	    48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    161b:	    48 89 c6             	mov    %rax,%rsi
+    161e:	    48 8d 05 7b 5a 02 00 	lea    0x25a7b(%rip),%rax        # 270a0 <nel::log>
+    1625:	    48 89 c7             	mov    %rax,%rdi
+    1628:	    e8 12 27 00 00       	call   3d3f <nel::operator<<(nel::Log&, char const*)>
+    162d:	    48 89 c2             	mov    %rax,%rdx
+    1630:	    48 8d 05 d1 29 00 00 	lea    0x29d1(%rip),%rax        # 4008 <_IO_stdin_used+0x8>
+    1637:	    48 89 c6             	mov    %rax,%rsi
+    163a:	    48 89 d7             	mov    %rdx,%rdi
+    163d:	    e8 fd 26 00 00       	call   3d3f <nel::operator<<(nel::Log&, char const*)>
+    1642:	    48 89 c1             	mov    %rax,%rcx
+    1645:	    48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1649:	    48 c1 e8 03          	shr    $0x3,%rax
+    164d:	    48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+    1654:	    9b c4 20 
+    1657:	    48 f7 e2             	mul    %rdx
+    165a:	    48 89 d0             	mov    %rdx,%rax
+    165d:	    48 c1 e8 04          	shr    $0x4,%rax
+    1661:	    48 89 c6             	mov    %rax,%rsi
+    1664:	    48 89 cf             	mov    %rcx,%rdi
+    1667:	    e8 de 27 00 00       	call   3e4a <nel::operator<<(nel::Log&, unsigned long)>
+    166c:	    48 89 c2             	mov    %rax,%rdx
+    166f:	    48 8d 05 95 29 00 00 	lea    0x2995(%rip),%rax        # 400b <_IO_stdin_used+0xb>
+    1676:	    48 89 c6             	mov    %rax,%rsi
+    1679:	    48 89 d7             	mov    %rdx,%rdi
+    167c:	    e8 be 26 00 00       	call   3d3f <nel::operator<<(nel::Log&, char const*)>
+
+    1681:	    48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1686:	/-- 74 57                	je     16df <bench::report(char const*, unsigned long, unsigned long)+0xdc>
+    1688:	|   48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    168d:	+-- 74 50                	je     16df <bench::report(char const*, unsigned long, unsigned long)+0xdc>
+        for (Index i = 0; i < n_moves; ++i) {
+    168f:	|   48 8d 05 78 29 00 00 	lea    0x2978(%rip),%rax        # 400e <_IO_stdin_used+0xe>
+    1696:	|   48 89 c6             	mov    %rax,%rsi
+    1699:	|   48 8d 05 00 5a 02 00 	lea    0x25a00(%rip),%rax        # 270a0 <nel::log>
+    16a0:	|   48 89 c7             	mov    %rax,%rdi
+    16a3:	|   e8 97 26 00 00       	call   3d3f <nel::operator<<(nel::Log&, char const*)>
+    16a8:	|   48 89 c1             	mov    %rax,%rcx
+    16ab:	|   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16af:	|   48 69 c0 e8 03 00 00 	imul   $0x3e8,%rax,%rax
+    16b6:	|   ba 00 00 00 00       	mov    $0x0,%edx
+    16bb:	|   48 f7 75 f0          	divq   -0x10(%rbp)
+    16bf:	|   48 89 c6             	mov    %rax,%rsi
+    16c2:	|   48 89 cf             	mov    %rcx,%rdi
+    16c5:	|   e8 80 27 00 00       	call   3e4a <nel::operator<<(nel::Log&, unsigned long)>
+    16ca:	|   48 89 c2             	mov    %rax,%rdx
+    16cd:	|   48 8d 05 3d 29 00 00 	lea    0x293d(%rip),%rax        # 4011 <_IO_stdin_used+0x11>
+    16d4:	|   48 89 c6             	mov    %rax,%rsi
+    16d7:	|   48 89 d7             	mov    %rdx,%rdi
+    16da:	|   e8 60 26 00 00       	call   3d3f <nel::operator<<(nel::Log&, char const*)>
+            nel::elem::copy(buf1, buf2, buf_size);
+    16df:	\-> be 0a 00 00 00       	mov    $0xa,%esi
+    16e4:	    48 8d 05 b5 59 02 00 	lea    0x259b5(%rip),%rax        # 270a0 <nel::log>
+    16eb:	    48 89 c7             	mov    %rax,%rdi
+    16ee:	    e8 20 26 00 00       	call   3d13 <nel::operator<<(nel::Log&, char)>
+        }
+    16f3:	    90                   	nop
+    16f4:	    c9                   	leave
+    16f5:	    c3                   	ret
+
+00000000000016f6 <operator new(unsigned long, void*)>:
+
+#    if !defined(TEST)
+// catch2 uses stdlib and so uses stdlib's new defn.
+// Operator new must not be in a namespace
+inline void *operator new(nel::USize, void *p)
+{
+    16f6:	55                   	push   %rbp
+    16f7:	48 89 e5             	mov    %rsp,%rbp
+    16fa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    16fe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return p;
+    1702:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+    1706:	5d                   	pop    %rbp
+    1707:	c3                   	ret
+
+0000000000001708 <nel::Context::Context(char const*, char const*, int)>:
+        char const *fn_name_;
+        char const *file_name_;
+        int line_num_;
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+    1708:	55                   	push   %rbp
+    1709:	48 89 e5             	mov    %rsp,%rbp
+    170c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1710:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1714:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1718:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    171b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    171f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1723:	48 89 10             	mov    %rdx,(%rax)
+            , file_name_(file_name)
+    1726:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    172a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    172e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , line_num_(line_num)
+    1732:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1736:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1739:	89 50 10             	mov    %edx,0x10(%rax)
+        {
+        }
+    173c:	90                   	nop
+    173d:	5d                   	pop    %rbp
+    173e:	c3                   	ret
+
+000000000000173f <nel::assert(bool, char const*, nel::Context const&)>:
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx);
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    173f:	    55                   	push   %rbp
+    1740:	    48 89 e5             	mov    %rsp,%rbp
+    1743:	    48 83 ec 20          	sub    $0x20,%rsp
+    1747:	    89 f8                	mov    %edi,%eax
+    1749:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    174d:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1751:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { assert_fail(msg, ctx); }
+    1754:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    1758:	    83 f0 01             	xor    $0x1,%eax
+    175b:	    84 c0                	test   %al,%al
+    175d:	/-- 74 13                	je     1772 <nel::assert(bool, char const*, nel::Context const&)+0x33>
+    175f:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1763:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1767:	|   48 89 d6             	mov    %rdx,%rsi
+    176a:	|   48 89 c7             	mov    %rax,%rdi
+    176d:	|   e8 26 1d 00 00       	call   3498 <nel::assert_fail(char const*, nel::Context const&)>
+}
+    1772:	\-> 90                   	nop
+    1773:	    c9                   	leave
+    1774:	    c3                   	ret
+
+0000000000001775 <nel::heaped::Malloc::try_malloc(unsigned long, unsigned long)>:
+ * and friends (see memory.hh).
+ */
+struct Malloc
+{
+    public:
+        static Result<void *, AllocError> try_malloc(Length const align, Length const size)
+    1775:	55                   	push   %rbp
+    1776:	48 89 e5             	mov    %rsp,%rbp
+    1779:	48 83 ec 20          	sub    $0x20,%rsp
+    177d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1781:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1785:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            return try_realloc(nullptr, align, 0, size);
+    1789:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    178d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1791:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1795:	49 89 c8             	mov    %rcx,%r8
+    1798:	b9 00 00 00 00       	mov    $0x0,%ecx
+    179d:	be 00 00 00 00       	mov    $0x0,%esi
+    17a2:	48 89 c7             	mov    %rax,%rdi
+    17a5:	e8 06 00 00 00       	call   17b0 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>
+        }
+    17aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17ae:	c9                   	leave
+    17af:	c3                   	ret
+
+00000000000017b0 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>:
+
+        static Result<void *, AllocError> try_realloc(void *const p,
+    17b0:	          55                   	push   %rbp
+    17b1:	          48 89 e5             	mov    %rsp,%rbp
+    17b4:	          48 83 ec 40          	sub    $0x40,%rsp
+    17b8:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    17bc:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    17c0:	          48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    17c4:	          48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    17c8:	          4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+                                                      Length const align,
+                                                      Length const old_size,
+                                                      Length const new_size)
+        {
+            if (align == 0 || (align & (align - 1)) != 0) {
+    17cc:	          48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    17d1:	      /-- 74 11                	je     17e4 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x34>
+    17d3:	      |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17d7:	      |   48 83 e8 01          	sub    $0x1,%rax
+    17db:	      |   48 23 45 d8          	and    -0x28(%rbp),%rax
+    17df:	      |   48 85 c0             	test   %rax,%rax
+    17e2:	   /--|-- 74 1c                	je     1800 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x50>
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+    17e4:	   |  \-> c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+    17eb:	   |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17ef:	   |      48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    17f3:	   |      48 89 d6             	mov    %rdx,%rsi
+    17f6:	   |      48 89 c7             	mov    %rax,%rdi
+    17f9:	   |      e8 38 01 00 00       	call   1936 <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+                                    : std::realloc(p, new_size);
+            if (new_p == nullptr) {
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+            }
+            return Result<void *, AllocError>::Ok(new_p);
+        }
+    17fe:	/--|----- eb 79                	jmp    1879 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            void *const new_p = is_over_aligned(align)
+    1800:	|  \----> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1804:	|         48 89 c7             	mov    %rax,%rdi
+    1807:	|         e8 b4 00 00 00       	call   18c0 <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+                                    ? realloc_aligned(p, align, old_size, new_size)
+    180c:	|         84 c0                	test   %al,%al
+    180e:	|  /----- 74 1a                	je     182a <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x7a>
+    1810:	|  |      48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+    1814:	|  |      48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1818:	|  |      48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+    181c:	|  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1820:	|  |      48 89 c7             	mov    %rax,%rdi
+    1823:	|  |      e8 1c 23 00 00       	call   3b44 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+    1828:	|  |  /-- eb 13                	jmp    183d <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x8d>
+                                    : std::realloc(p, new_size);
+    182a:	|  \--|-> 48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    182e:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1832:	|     |   48 89 d6             	mov    %rdx,%rsi
+    1835:	|     |   48 89 c7             	mov    %rax,%rdi
+    1838:	|     |   e8 b3 f8 ff ff       	call   10f0 <realloc@plt>
+    183d:	|     \-> 48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            if (new_p == nullptr) {
+    1841:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1845:	|         48 85 c0             	test   %rax,%rax
+    1848:	|     /-- 75 1c                	jne    1866 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xb6>
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+    184a:	|     |   c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1851:	|     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1855:	|     |   48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    1859:	|     |   48 89 d6             	mov    %rdx,%rsi
+    185c:	|     |   48 89 c7             	mov    %rax,%rdi
+    185f:	|     |   e8 d2 00 00 00       	call   1936 <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+        }
+    1864:	+-----|-- eb 13                	jmp    1879 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            return Result<void *, AllocError>::Ok(new_p);
+    1866:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    186a:	|         48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    186e:	|         48 89 d6             	mov    %rdx,%rsi
+    1871:	|         48 89 c7             	mov    %rax,%rdi
+    1874:	|         e8 f1 00 00 00       	call   196a <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>
+        }
+    1879:	\-------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    187d:	          c9                   	leave
+    187e:	          c3                   	ret
+
+000000000000187f <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>:
+
+        static void free(void *const p, Length const align, Length const size)
+    187f:	       55                   	push   %rbp
+    1880:	       48 89 e5             	mov    %rsp,%rbp
+    1883:	       48 83 ec 20          	sub    $0x20,%rsp
+    1887:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    188b:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    188f:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+    1893:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1897:	       48 89 c7             	mov    %rax,%rdi
+    189a:	       e8 21 00 00 00       	call   18c0 <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+    189f:	       84 c0                	test   %al,%al
+    18a1:	/----- 74 0e                	je     18b1 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x32>
+                free_aligned(p);
+    18a3:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18a7:	|      48 89 c7             	mov    %rax,%rdi
+    18aa:	|      e8 51 22 00 00       	call   3b00 <nel::free_aligned(void*)>
+            } else {
+                std::free(p);
+            }
+        }
+    18af:	|  /-- eb 0c                	jmp    18bd <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x3e>
+                std::free(p);
+    18b1:	\--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18b5:	   |   48 89 c7             	mov    %rax,%rdi
+    18b8:	   |   e8 f3 f7 ff ff       	call   10b0 <free@plt>
+        }
+    18bd:	   \-> 90                   	nop
+    18be:	       c9                   	leave
+    18bf:	       c3                   	ret
+
+00000000000018c0 <nel::heaped::Malloc::is_over_aligned(unsigned long)>:
+
+    private:
+        static constexpr bool is_over_aligned(Length const align)
+    18c0:	55                   	push   %rbp
+    18c1:	48 89 e5             	mov    %rsp,%rbp
+    18c4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return align > alignof(std::max_align_t);
+    18c8:	48 83 7d f8 10       	cmpq   $0x10,-0x8(%rbp)
+    18cd:	0f 97 c0             	seta   %al
+        }
+    18d0:	5d                   	pop    %rbp
+    18d1:	c3                   	ret
+
+00000000000018d2 <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+                Element<T> ok_;
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    18d2:	             55                   	push   %rbp
+    18d3:	             48 89 e5             	mov    %rsp,%rbp
+    18d6:	             48 83 ec 30          	sub    $0x30,%rsp
+    18da:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result::dtor
+    18de:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    18e2:	             8b 00                	mov    (%rax),%eax
+    18e4:	             83 f8 02             	cmp    $0x2,%eax
+    18e7:	/----------- 74 43                	je     192c <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5a>
+    18e9:	|            83 f8 02             	cmp    $0x2,%eax
+    18ec:	|        /-- 7f 09                	jg     18f7 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x25>
+    18ee:	|        |   85 c0                	test   %eax,%eax
+    18f0:	|  /-----|-- 74 3d                	je     192f <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5d>
+    18f2:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    18f5:	|  |  /--|-- 74 3b                	je     1932 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x60>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    18f7:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    18fb:	|  |  |      b9 72 00 00 00       	mov    $0x72,%ecx
+    1900:	|  |  |      48 8d 15 ba 27 00 00 	lea    0x27ba(%rip),%rdx        # 40c1 <n_moves+0x89>
+    1907:	|  |  |      48 8d 35 c5 27 00 00 	lea    0x27c5(%rip),%rsi        # 40d3 <n_moves+0x9b>
+    190e:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1911:	|  |  |      e8 f2 fd ff ff       	call   1708 <nel::Context::Context(char const*, char const*, int)>
+    1916:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    191a:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    191d:	|  |  |      48 8d 05 b7 27 00 00 	lea    0x27b7(%rip),%rax        # 40db <n_moves+0xa3>
+    1924:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1927:	|  |  |      e8 11 1b 00 00       	call   343d <nel::panic(char const*, nel::Context const&)>
+                    break;
+    192c:	\--|--|----> 90                   	nop
+    192d:	   |  |  /-- eb 04                	jmp    1933 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    192f:	   \--|--|-> 90                   	nop
+    1930:	      |  +-- eb 01                	jmp    1933 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    1932:	      \--|-> 90                   	nop
+                    break;
+            }
+        }
+    1933:	         \-> 90                   	nop
+    1934:	             c9                   	leave
+    1935:	             c3                   	ret
+
+0000000000001936 <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>:
+         *
+         * @param val The value to move into the result as an err value.
+         *
+         * @returns a Result 'wrapping' the value given as an err value.
+         */
+        constexpr static Result Err(E &&val)
+    1936:	55                   	push   %rbp
+    1937:	48 89 e5             	mov    %rsp,%rbp
+    193a:	48 83 ec 10          	sub    $0x10,%rsp
+    193e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1942:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            return Result(Phantom<Tag::ERR>(), forward<E>(val));
+    1946:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    194a:	48 89 c7             	mov    %rax,%rdi
+    194d:	e8 ed 02 00 00       	call   1c3f <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    1952:	48 89 c2             	mov    %rax,%rdx
+    1955:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1959:	48 89 d6             	mov    %rdx,%rsi
+    195c:	48 89 c7             	mov    %rax,%rdi
+    195f:	e8 ea 02 00 00       	call   1c4e <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>
+        }
+    1964:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1968:	c9                   	leave
+    1969:	c3                   	ret
+
+000000000000196a <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>:
+        constexpr static Result Ok(Args &&...args)
+    196a:	55                   	push   %rbp
+    196b:	48 89 e5             	mov    %rsp,%rbp
+    196e:	48 83 ec 10          	sub    $0x10,%rsp
+    1972:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1976:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<Args>(args)...);
+    197a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    197e:	48 89 c7             	mov    %rax,%rdi
+    1981:	e8 09 03 00 00       	call   1c8f <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    1986:	48 89 c2             	mov    %rax,%rdx
+    1989:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    198d:	48 89 d6             	mov    %rdx,%rsi
+    1990:	48 89 c7             	mov    %rax,%rdi
+    1993:	e8 06 03 00 00       	call   1c9e <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>
+        }
+    1998:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    199c:	c9                   	leave
+    199d:	c3                   	ret
+
+000000000000199e <U8Buf<65536ul>::U8Buf(unsigned char)>:
+            nel::elem::move(data_, o.data_, N);
+            return *this;
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+    199e:	55                   	push   %rbp
+    199f:	48 89 e5             	mov    %rsp,%rbp
+    19a2:	48 83 ec 10          	sub    $0x10,%rsp
+    19a6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    19aa:	89 f0                	mov    %esi,%eax
+    19ac:	88 45 f4             	mov    %al,-0xc(%rbp)
+        {
+            nel::elem::set(data_, f, N);
+    19af:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    19b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19b7:	ba 00 00 01 00       	mov    $0x10000,%edx
+    19bc:	89 ce                	mov    %ecx,%esi
+    19be:	48 89 c7             	mov    %rax,%rdi
+    19c1:	e8 5b 1b 00 00       	call   3521 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    19c6:	90                   	nop
+    19c7:	c9                   	leave
+    19c8:	c3                   	ret
+
+00000000000019c9 <U8Buf<65536ul>&& nel::move<U8Buf<65536ul> >(U8Buf<65536ul>&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel is to not need std.
+ */
+template<typename T>
+constexpr T &&move(T &v)
+    19c9:	55                   	push   %rbp
+    19ca:	48 89 e5             	mov    %rsp,%rbp
+    19cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<T &&>(v);
+    19d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    19d5:	5d                   	pop    %rbp
+    19d6:	c3                   	ret
+    19d7:	90                   	nop
+
+00000000000019d8 <U8Buf<65536ul>::operator=(U8Buf<65536ul>&&)>:
+        constexpr U8Buf &operator=(U8Buf &&o)
+    19d8:	55                   	push   %rbp
+    19d9:	48 89 e5             	mov    %rsp,%rbp
+    19dc:	48 83 ec 10          	sub    $0x10,%rsp
+    19e0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    19e4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            nel::elem::move(data_, o.data_, N);
+    19e8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    19ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19f0:	ba 00 00 01 00       	mov    $0x10000,%edx
+    19f5:	48 89 ce             	mov    %rcx,%rsi
+    19f8:	48 89 c7             	mov    %rax,%rdi
+    19fb:	e8 4f 1b 00 00       	call   354f <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            return *this;
+    1a00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1a04:	c9                   	leave
+    1a05:	c3                   	ret
+
+0000000000001a06 <U8Buf<65536ul>::~U8Buf()>:
+        constexpr ~U8Buf(void)
+    1a06:	55                   	push   %rbp
+    1a07:	48 89 e5             	mov    %rsp,%rbp
+    1a0a:	48 83 ec 10          	sub    $0x10,%rsp
+    1a0e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            nel::elem::set(data_, 0xa5, N);
+    1a12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a16:	ba 00 00 01 00       	mov    $0x10000,%edx
+    1a1b:	be a5 00 00 00       	mov    $0xa5,%esi
+    1a20:	48 89 c7             	mov    %rax,%rdi
+    1a23:	e8 f9 1a 00 00       	call   3521 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    1a28:	90                   	nop
+    1a29:	c9                   	leave
+    1a2a:	c3                   	ret
+    1a2b:	90                   	nop
+
+0000000000001a2c <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([]() {
+    1a2c:	             55                   	push   %rbp
+    1a2d:	             48 89 e5             	mov    %rsp,%rbp
+    1a30:	             48 81 ec 60 01 00 00 	sub    $0x160,%rsp
+    1a37:	             48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+        for (Index r = 0; r < 100; ++r) {
+    1a3e:	             48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1a45:	             00 
+    1a46:	   /-------- e9 a4 00 00 00       	jmp    1aef <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const+0xc3>
+            auto v = Vec::empty();
+    1a4b:	/--|-------> 48 8d 85 b8 fe ff ff 	lea    -0x148(%rbp),%rax
+    1a52:	|  |         48 89 c7             	mov    %rax,%rdi
+    1a55:	|  |         e8 85 02 00 00       	call   1cdf <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::empty()>
+            for (Index i = 0; i < n; ++i) {
+    1a5a:	|  |         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1a61:	|  |         00 
+    1a62:	|  |     /-- eb 6d                	jmp    1ad1 <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const+0xa5>
+                v.push((uint8_t)i).is_ok();
+    1a64:	|  |  /--|-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a68:	|  |  |  |   88 45 cf             	mov    %al,-0x31(%rbp)
+    1a6b:	|  |  |  |   48 8d 85 c0 fe ff ff 	lea    -0x140(%rbp),%rax
+    1a72:	|  |  |  |   48 8d 55 cf          	lea    -0x31(%rbp),%rdx
+    1a76:	|  |  |  |   48 8d 8d b8 fe ff ff 	lea    -0x148(%rbp),%rcx
+    1a7d:	|  |  |  |   48 89 ce             	mov    %rcx,%rsi
+    1a80:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1a83:	|  |  |  |   e8 94 02 00 00       	call   1d1c <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    1a88:	|  |  |  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1a8c:	|  |  |  |   b9 47 00 00 00       	mov    $0x47,%ecx
+    1a91:	|  |  |  |   48 8d 15 4e 26 00 00 	lea    0x264e(%rip),%rdx        # 40e6 <n_moves+0xae>
+    1a98:	|  |  |  |   48 8d 35 60 26 00 00 	lea    0x2660(%rip),%rsi        # 40ff <n_moves+0xc7>
+    1a9f:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1aa2:	|  |  |  |   e8 61 fc ff ff       	call   1708 <nel::Context::Context(char const*, char const*, int)>
+    1aa7:	|  |  |  |   48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    1aab:	|  |  |  |   48 8d 85 c0 fe ff ff 	lea    -0x140(%rbp),%rax
+    1ab2:	|  |  |  |   48 89 d6             	mov    %rdx,%rsi
+    1ab5:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1ab8:	|  |  |  |   e8 c1 03 00 00       	call   1e7e <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    1abd:	|  |  |  |   48 8d 85 c0 fe ff ff 	lea    -0x140(%rbp),%rax
+    1ac4:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1ac7:	|  |  |  |   e8 1c 03 00 00       	call   1de8 <nel::Result<void, U8Buf<256ul> >::~Result()>
+            for (Index i = 0; i < n; ++i) {
+    1acc:	|  |  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    1ad1:	|  |  |  \-> 48 81 7d f0 e7 03 00 	cmpq   $0x3e7,-0x10(%rbp)
+    1ad8:	|  |  |      00 
+    1ad9:	|  |  \----- 76 89                	jbe    1a64 <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const+0x38>
+        for (Index r = 0; r < 100; ++r) {
+    1adb:	|  |         48 8d 85 b8 fe ff ff 	lea    -0x148(%rbp),%rax
+    1ae2:	|  |         48 89 c7             	mov    %rax,%rdi
+    1ae5:	|  |         e8 14 02 00 00       	call   1cfe <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    1aea:	|  |         48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1aef:	|  \-------> 48 83 7d f8 63       	cmpq   $0x63,-0x8(%rbp)
+    1af4:	\----------- 0f 86 51 ff ff ff    	jbe    1a4b <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const+0x1f>
+    auto t = bench::time_ns([]() {
+    1afa:	             90                   	nop
+    1afb:	             90                   	nop
+    1afc:	             c9                   	leave
+    1afd:	             c3                   	ret
+
+0000000000001afe <void bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)>:
+void bench_growth(char const *const name)
+    1afe:	55                   	push   %rbp
+    1aff:	48 89 e5             	mov    %rsp,%rbp
+    1b02:	48 83 ec 20          	sub    $0x20,%rsp
+    1b06:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    auto t = bench::time_ns([]() {
+    1b0a:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1b0e:	48 89 c7             	mov    %rax,%rdi
+    1b11:	e8 92 03 00 00       	call   1ea8 <unsigned long bench::time_ns<bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}>(bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}&&)>
+    1b16:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    bench::report(name, t);
+    1b1a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1b1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b22:	ba 00 00 00 00       	mov    $0x0,%edx
+    1b27:	48 89 ce             	mov    %rcx,%rsi
+    1b2a:	48 89 c7             	mov    %rax,%rdi
+    1b2d:	e8 d1 fa ff ff       	call   1603 <bench::report(char const*, unsigned long, unsigned long)>
+}
+    1b32:	90                   	nop
+    1b33:	c9                   	leave
+    1b34:	c3                   	ret
+    1b35:	90                   	nop
+
+0000000000001b36 <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([]() {
+    1b36:	             55                   	push   %rbp
+    1b37:	             48 89 e5             	mov    %rsp,%rbp
+    1b3a:	             48 81 ec 60 01 00 00 	sub    $0x160,%rsp
+    1b41:	             48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+        for (Index r = 0; r < 100; ++r) {
+    1b48:	             48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1b4f:	             00 
+    1b50:	   /-------- e9 a4 00 00 00       	jmp    1bf9 <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const+0xc3>
+            auto v = Vec::empty();
+    1b55:	/--|-------> 48 8d 85 b8 fe ff ff 	lea    -0x148(%rbp),%rax
+    1b5c:	|  |         48 89 c7             	mov    %rax,%rdi
+    1b5f:	|  |         e8 70 03 00 00       	call   1ed4 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::empty()>
+            for (Index i = 0; i < n; ++i) {
+    1b64:	|  |         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1b6b:	|  |         00 
+    1b6c:	|  |     /-- eb 6d                	jmp    1bdb <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const+0xa5>
+                v.push((uint8_t)i).is_ok();
+    1b6e:	|  |  /--|-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b72:	|  |  |  |   88 45 cf             	mov    %al,-0x31(%rbp)
+    1b75:	|  |  |  |   48 8d 85 c0 fe ff ff 	lea    -0x140(%rbp),%rax
+    1b7c:	|  |  |  |   48 8d 55 cf          	lea    -0x31(%rbp),%rdx
+    1b80:	|  |  |  |   48 8d 8d b8 fe ff ff 	lea    -0x148(%rbp),%rcx
+    1b87:	|  |  |  |   48 89 ce             	mov    %rcx,%rsi
+    1b8a:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1b8d:	|  |  |  |   e8 7e 03 00 00       	call   1f10 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    1b92:	|  |  |  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1b96:	|  |  |  |   b9 47 00 00 00       	mov    $0x47,%ecx
+    1b9b:	|  |  |  |   48 8d 15 44 25 00 00 	lea    0x2544(%rip),%rdx        # 40e6 <n_moves+0xae>
+    1ba2:	|  |  |  |   48 8d 35 56 25 00 00 	lea    0x2556(%rip),%rsi        # 40ff <n_moves+0xc7>
+    1ba9:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1bac:	|  |  |  |   e8 57 fb ff ff       	call   1708 <nel::Context::Context(char const*, char const*, int)>
+    1bb1:	|  |  |  |   48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    1bb5:	|  |  |  |   48 8d 85 c0 fe ff ff 	lea    -0x140(%rbp),%rax
+    1bbc:	|  |  |  |   48 89 d6             	mov    %rdx,%rsi
+    1bbf:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1bc2:	|  |  |  |   e8 b7 02 00 00       	call   1e7e <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    1bc7:	|  |  |  |   48 8d 85 c0 fe ff ff 	lea    -0x140(%rbp),%rax
+    1bce:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1bd1:	|  |  |  |   e8 12 02 00 00       	call   1de8 <nel::Result<void, U8Buf<256ul> >::~Result()>
+            for (Index i = 0; i < n; ++i) {
+    1bd6:	|  |  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    1bdb:	|  |  |  \-> 48 81 7d f0 e7 03 00 	cmpq   $0x3e7,-0x10(%rbp)
+    1be2:	|  |  |      00 
+    1be3:	|  |  \----- 76 89                	jbe    1b6e <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const+0x38>
+        for (Index r = 0; r < 100; ++r) {
+    1be5:	|  |         48 8d 85 b8 fe ff ff 	lea    -0x148(%rbp),%rax
+    1bec:	|  |         48 89 c7             	mov    %rax,%rdi
+    1bef:	|  |         e8 fe 02 00 00       	call   1ef2 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    1bf4:	|  |         48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1bf9:	|  \-------> 48 83 7d f8 63       	cmpq   $0x63,-0x8(%rbp)
+    1bfe:	\----------- 0f 86 51 ff ff ff    	jbe    1b55 <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const+0x1f>
+    auto t = bench::time_ns([]() {
+    1c04:	             90                   	nop
+    1c05:	             90                   	nop
+    1c06:	             c9                   	leave
+    1c07:	             c3                   	ret
+
+0000000000001c08 <void bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)>:
+void bench_growth(char const *const name)
+    1c08:	55                   	push   %rbp
+    1c09:	48 89 e5             	mov    %rsp,%rbp
+    1c0c:	48 83 ec 20          	sub    $0x20,%rsp
+    1c10:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    auto t = bench::time_ns([]() {
+    1c14:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1c18:	48 89 c7             	mov    %rax,%rdi
+    1c1b:	e8 9f 03 00 00       	call   1fbf <unsigned long bench::time_ns<bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}>(bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}&&)>
+    1c20:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    bench::report(name, t);
+    1c24:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1c28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c2c:	ba 00 00 00 00       	mov    $0x0,%edx
+    1c31:	48 89 ce             	mov    %rcx,%rsi
+    1c34:	48 89 c7             	mov    %rax,%rdi
+    1c37:	e8 c7 f9 ff ff       	call   1603 <bench::report(char const*, unsigned long, unsigned long)>
+}
+    1c3c:	90                   	nop
+    1c3d:	c9                   	leave
+    1c3e:	c3                   	ret
+
+0000000000001c3f <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel so to not need std.
+ */
+template<typename U, typename T>
+constexpr U &&forward(T &t)
+    1c3f:	55                   	push   %rbp
+    1c40:	48 89 e5             	mov    %rsp,%rbp
+    1c43:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<U &&>(t);
+    1c47:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1c4b:	5d                   	pop    %rbp
+    1c4c:	c3                   	ret
+    1c4d:	90                   	nop
+
+0000000000001c4e <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    1c4e:	55                   	push   %rbp
+    1c4f:	48 89 e5             	mov    %rsp,%rbp
+    1c52:	53                   	push   %rbx
+    1c53:	48 83 ec 18          	sub    $0x18,%rsp
+    1c57:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1c5b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    1c5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c63:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    1c69:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c6d:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    1c71:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c75:	48 89 c7             	mov    %rax,%rdi
+    1c78:	e8 c2 ff ff ff       	call   1c3f <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    1c7d:	48 89 c6             	mov    %rax,%rsi
+    1c80:	48 89 df             	mov    %rbx,%rdi
+    1c83:	e8 64 03 00 00       	call   1fec <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>
+        }
+    1c88:	90                   	nop
+    1c89:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1c8d:	c9                   	leave
+    1c8e:	c3                   	ret
+
+0000000000001c8f <void* const& nel::forward<void* const&, void* const>(void* const&)>:
+constexpr U &&forward(T &t)
+    1c8f:	55                   	push   %rbp
+    1c90:	48 89 e5             	mov    %rsp,%rbp
+    1c93:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    1c97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1c9b:	5d                   	pop    %rbp
+    1c9c:	c3                   	ret
+    1c9d:	90                   	nop
+
+0000000000001c9e <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>:
+        constexpr Result(Phantom<Tag::OK> const, Args &&...args)
+    1c9e:	55                   	push   %rbp
+    1c9f:	48 89 e5             	mov    %rsp,%rbp
+    1ca2:	53                   	push   %rbx
+    1ca3:	48 83 ec 18          	sub    $0x18,%rsp
+    1ca7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1cab:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    1caf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cb3:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<Args>(args)...)
+    1cb9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cbd:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    1cc1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1cc5:	48 89 c7             	mov    %rax,%rdi
+    1cc8:	e8 c2 ff ff ff       	call   1c8f <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    1ccd:	48 89 c6             	mov    %rax,%rsi
+    1cd0:	48 89 df             	mov    %rbx,%rdi
+    1cd3:	e8 3c 03 00 00       	call   2014 <nel::Element<void*>::Element<void* const&>(void* const&)>
+        }
+    1cd8:	90                   	nop
+    1cd9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1cdd:	c9                   	leave
+    1cde:	c3                   	ret
+
+0000000000001cdf <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::empty()>:
+        /**
+         * Create a vector with no initial allocation.
+         *
+         * @returns the vector created.
+         */
+        static constexpr Vector empty(void)
+    1cdf:	55                   	push   %rbp
+    1ce0:	48 89 e5             	mov    %rsp,%rbp
+    1ce3:	48 83 ec 10          	sub    $0x10,%rsp
+    1ce7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return Vector();
+    1ceb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cef:	48 89 c7             	mov    %rax,%rdi
+    1cf2:	e8 47 03 00 00       	call   203e <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector()>
+        }
+    1cf7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cfb:	c9                   	leave
+    1cfc:	c3                   	ret
+    1cfd:	90                   	nop
+
+0000000000001cfe <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>:
+        ~Vector(void)
+    1cfe:	55                   	push   %rbp
+    1cff:	48 89 e5             	mov    %rsp,%rbp
+    1d02:	48 83 ec 10          	sub    $0x10,%rsp
+    1d06:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            VectorNode::free(item_);
+    1d0a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d0e:	48 8b 00             	mov    (%rax),%rax
+    1d11:	48 89 c7             	mov    %rax,%rdi
+    1d14:	e8 51 03 00 00       	call   206a <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*)>
+        }
+    1d19:	90                   	nop
+    1d1a:	c9                   	leave
+    1d1b:	c3                   	ret
+
+0000000000001d1c <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>:
+            return item_->push_back(l);
+        }
+#    endif
+
+        template<typename... Args>
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Args &&...args)
+    1d1c:	       55                   	push   %rbp
+    1d1d:	       48 89 e5             	mov    %rsp,%rbp
+    1d20:	       53                   	push   %rbx
+    1d21:	       48 83 ec 38          	sub    $0x38,%rsp
+    1d25:	       48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1d29:	       48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    1d2d:	       48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+        {
+            bool ok;
+            ok = try_reserve_for(1);
+    1d31:	       48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1d35:	       be 01 00 00 00       	mov    $0x1,%esi
+    1d3a:	       48 89 c7             	mov    %rax,%rdi
+    1d3d:	       e8 74 03 00 00       	call   20b6 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>
+    1d42:	       88 45 ef             	mov    %al,-0x11(%rbp)
+            if (!ok) { return Result<void, Type>::Err(forward<Args>(args)...); }
+    1d45:	       0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+    1d49:	       83 f0 01             	xor    $0x1,%eax
+    1d4c:	       84 c0                	test   %al,%al
+    1d4e:	   /-- 74 20                	je     1d70 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x54>
+    1d50:	   |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1d54:	   |   48 89 c7             	mov    %rax,%rdi
+    1d57:	   |   e8 c5 03 00 00       	call   2121 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    1d5c:	   |   48 89 c2             	mov    %rax,%rdx
+    1d5f:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1d63:	   |   48 89 d6             	mov    %rdx,%rsi
+    1d66:	   |   48 89 c7             	mov    %rax,%rdi
+    1d69:	   |   e8 c1 03 00 00       	call   212f <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<unsigned char>(unsigned char&&)>
+    1d6e:	/--|-- eb 51                	jmp    1dc1 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0xa5>
+            if (item_ == nullptr) { return Result<void, Type>::Err(forward<Args>(args)...); }
+    1d70:	|  \-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1d74:	|      48 8b 00             	mov    (%rax),%rax
+    1d77:	|      48 85 c0             	test   %rax,%rax
+    1d7a:	|  /-- 75 20                	jne    1d9c <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x80>
+    1d7c:	|  |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1d80:	|  |   48 89 c7             	mov    %rax,%rdi
+    1d83:	|  |   e8 99 03 00 00       	call   2121 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    1d88:	|  |   48 89 c2             	mov    %rax,%rdx
+    1d8b:	|  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1d8f:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1d92:	|  |   48 89 c7             	mov    %rax,%rdi
+    1d95:	|  |   e8 95 03 00 00       	call   212f <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<unsigned char>(unsigned char&&)>
+    1d9a:	+--|-- eb 25                	jmp    1dc1 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0xa5>
+            return item_->push_back(forward<Args>(args)...);
+    1d9c:	|  \-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1da0:	|      48 8b 18             	mov    (%rax),%rbx
+    1da3:	|      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1da7:	|      48 89 c7             	mov    %rax,%rdi
+    1daa:	|      e8 72 03 00 00       	call   2121 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    1daf:	|      48 89 c2             	mov    %rax,%rdx
+    1db2:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1db6:	|      48 89 de             	mov    %rbx,%rsi
+    1db9:	|      48 89 c7             	mov    %rax,%rdi
+    1dbc:	|      e8 a3 03 00 00       	call   2164 <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::push_back<unsigned char>(unsigned char&&)>
+        }
+    1dc1:	\----> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1dc5:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1dc9:	       c9                   	leave
+    1dca:	       c3                   	ret
+    1dcb:	       90                   	nop
+
+0000000000001dcc <nel::Element<U8Buf<256ul> >::~Element()>:
+
+    private:
+        Type value_;
+
+    public:
+        constexpr ~Element(void) = default;
+    1dcc:	55                   	push   %rbp
+    1dcd:	48 89 e5             	mov    %rsp,%rbp
+    1dd0:	48 83 ec 10          	sub    $0x10,%rsp
+    1dd4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1dd8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ddc:	48 89 c7             	mov    %rax,%rdi
+    1ddf:	e8 4c 04 00 00       	call   2230 <U8Buf<256ul>::~U8Buf()>
+    1de4:	90                   	nop
+    1de5:	c9                   	leave
+    1de6:	c3                   	ret
+    1de7:	90                   	nop
+
+0000000000001de8 <nel::Result<void, U8Buf<256ul> >::~Result()>:
+        union {
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    1de8:	             55                   	push   %rbp
+    1de9:	             48 89 e5             	mov    %rsp,%rbp
+    1dec:	             48 83 ec 30          	sub    $0x30,%rsp
+    1df0:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result<void>-dtor
+    1df4:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1df8:	             8b 00                	mov    (%rax),%eax
+    1dfa:	             83 f8 02             	cmp    $0x2,%eax
+    1dfd:	         /-- 74 10                	je     1e0f <nel::Result<void, U8Buf<256ul> >::~Result()+0x27>
+    1dff:	         |   83 f8 02             	cmp    $0x2,%eax
+    1e02:	      /--|-- 7f 1d                	jg     1e21 <nel::Result<void, U8Buf<256ul> >::~Result()+0x39>
+    1e04:	      |  |   85 c0                	test   %eax,%eax
+    1e06:	/-----|--|-- 74 4e                	je     1e56 <nel::Result<void, U8Buf<256ul> >::~Result()+0x6e>
+    1e08:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    1e0b:	|     +--|-- 75 14                	jne    1e21 <nel::Result<void, U8Buf<256ul> >::~Result()+0x39>
+                case Tag::OK:
+                    break;
+    1e0d:	|  /--|--|-- eb 48                	jmp    1e57 <nel::Result<void, U8Buf<256ul> >::~Result()+0x6f>
+
+                case Tag::ERR:
+                    err_.~Element<E>();
+    1e0f:	|  |  |  \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1e13:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    1e17:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1e1a:	|  |  |      e8 ad ff ff ff       	call   1dcc <nel::Element<U8Buf<256ul> >::~Element()>
+                    break;
+    1e1f:	|  +--|----- eb 36                	jmp    1e57 <nel::Result<void, U8Buf<256ul> >::~Result()+0x6f>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    1e21:	|  |  \----> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1e25:	|  |         b9 dd 02 00 00       	mov    $0x2dd,%ecx
+    1e2a:	|  |         48 8d 15 90 22 00 00 	lea    0x2290(%rip),%rdx        # 40c1 <n_moves+0x89>
+    1e31:	|  |         48 8d 35 9b 22 00 00 	lea    0x229b(%rip),%rsi        # 40d3 <n_moves+0x9b>
+    1e38:	|  |         48 89 c7             	mov    %rax,%rdi
+    1e3b:	|  |         e8 c8 f8 ff ff       	call   1708 <nel::Context::Context(char const*, char const*, int)>
+    1e40:	|  |         48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1e44:	|  |         48 89 c6             	mov    %rax,%rsi
+    1e47:	|  |         48 8d 05 8d 22 00 00 	lea    0x228d(%rip),%rax        # 40db <n_moves+0xa3>
+    1e4e:	|  |         48 89 c7             	mov    %rax,%rdi
+    1e51:	|  |         e8 e7 15 00 00       	call   343d <nel::panic(char const*, nel::Context const&)>
+                    break;
+    1e56:	\--|-------> 90                   	nop
+                    break;
+            }
+        }
+    1e57:	   \-------> 90                   	nop
+    1e58:	             c9                   	leave
+    1e59:	             c3                   	ret
+
+0000000000001e5a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}::operator()() const>:
+         *
+         * `this` is not consumed by this op.
+         */
+        constexpr bool is_ok(Context const &ctx = Context()) const
+        {
+            return match<bool>([](void) -> bool { return true; },
+    1e5a:	55                   	push   %rbp
+    1e5b:	48 89 e5             	mov    %rsp,%rbp
+    1e5e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1e62:	b8 01 00 00 00       	mov    $0x1,%eax
+    1e67:	5d                   	pop    %rbp
+    1e68:	c3                   	ret
+    1e69:	90                   	nop
+
+0000000000001e6a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}::operator()(U8Buf<256ul> const&) const>:
+                               [](E const &) -> bool { return false; },
+    1e6a:	55                   	push   %rbp
+    1e6b:	48 89 e5             	mov    %rsp,%rbp
+    1e6e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1e72:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1e76:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e7b:	5d                   	pop    %rbp
+    1e7c:	c3                   	ret
+    1e7d:	90                   	nop
+
+0000000000001e7e <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>:
+        constexpr bool is_ok(Context const &ctx = Context()) const
+    1e7e:	55                   	push   %rbp
+    1e7f:	48 89 e5             	mov    %rsp,%rbp
+    1e82:	48 83 ec 20          	sub    $0x20,%rsp
+    1e86:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1e8a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](void) -> bool { return true; },
+    1e8e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1e92:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    1e96:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    1e9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e9e:	48 89 c7             	mov    %rax,%rdi
+    1ea1:	e8 b0 03 00 00       	call   2256 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const>
+                               ctx);
+        }
+    1ea6:	c9                   	leave
+    1ea7:	c3                   	ret
+
+0000000000001ea8 <unsigned long bench::time_ns<bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}>(bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}&&)>:
+{
+    1ea8:	55                   	push   %rbp
+    1ea9:	48 89 e5             	mov    %rsp,%rbp
+    1eac:	48 83 ec 20          	sub    $0x20,%rsp
+    1eb0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+
+    1eb4:	e8 1d f7 ff ff       	call   15d6 <bench::now_ns()>
+    1eb9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    auto t1 = bench::time_ns([]() {
+    1ebd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ec1:	48 89 c7             	mov    %rax,%rdi
+    1ec4:	e8 63 fb ff ff       	call   1a2c <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const>
+        for (Index i = 0; i < n_moves; ++i) {
+    1ec9:	e8 08 f7 ff ff       	call   15d6 <bench::now_ns()>
+    1ece:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+            nel::elem::copy(buf2, buf1, buf_size);
+    1ed2:	c9                   	leave
+    1ed3:	c3                   	ret
+
+0000000000001ed4 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::empty()>:
+        static constexpr Vector empty(void)
+    1ed4:	55                   	push   %rbp
+    1ed5:	48 89 e5             	mov    %rsp,%rbp
+    1ed8:	48 83 ec 10          	sub    $0x10,%rsp
+    1edc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Vector();
+    1ee0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ee4:	48 89 c7             	mov    %rax,%rdi
+    1ee7:	e8 fc 03 00 00       	call   22e8 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector()>
+        }
+    1eec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ef0:	c9                   	leave
+    1ef1:	c3                   	ret
+
+0000000000001ef2 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>:
+        ~Vector(void)
+    1ef2:	55                   	push   %rbp
+    1ef3:	48 89 e5             	mov    %rsp,%rbp
+    1ef6:	48 83 ec 10          	sub    $0x10,%rsp
+    1efa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            VectorNode::free(item_);
+    1efe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f02:	48 8b 00             	mov    (%rax),%rax
+    1f05:	48 89 c7             	mov    %rax,%rdi
+    1f08:	e8 07 04 00 00       	call   2314 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*)>
+        }
+    1f0d:	90                   	nop
+    1f0e:	c9                   	leave
+    1f0f:	c3                   	ret
+
+0000000000001f10 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>:
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Args &&...args)
+    1f10:	       55                   	push   %rbp
+    1f11:	       48 89 e5             	mov    %rsp,%rbp
+    1f14:	       53                   	push   %rbx
+    1f15:	       48 83 ec 38          	sub    $0x38,%rsp
+    1f19:	       48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1f1d:	       48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    1f21:	       48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+            ok = try_reserve_for(1);
+    1f25:	       48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1f29:	       be 01 00 00 00       	mov    $0x1,%esi
+    1f2e:	       48 89 c7             	mov    %rax,%rdi
+    1f31:	       e8 2a 04 00 00       	call   2360 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>
+    1f36:	       88 45 ef             	mov    %al,-0x11(%rbp)
+            if (!ok) { return Result<void, Type>::Err(forward<Args>(args)...); }
+    1f39:	       0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+    1f3d:	       83 f0 01             	xor    $0x1,%eax
+    1f40:	       84 c0                	test   %al,%al
+    1f42:	   /-- 74 20                	je     1f64 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x54>
+    1f44:	   |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1f48:	   |   48 89 c7             	mov    %rax,%rdi
+    1f4b:	   |   e8 d1 01 00 00       	call   2121 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    1f50:	   |   48 89 c2             	mov    %rax,%rdx
+    1f53:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1f57:	   |   48 89 d6             	mov    %rdx,%rsi
+    1f5a:	   |   48 89 c7             	mov    %rax,%rdi
+    1f5d:	   |   e8 cd 01 00 00       	call   212f <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<unsigned char>(unsigned char&&)>
+    1f62:	/--|-- eb 51                	jmp    1fb5 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0xa5>
+            if (item_ == nullptr) { return Result<void, Type>::Err(forward<Args>(args)...); }
+    1f64:	|  \-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1f68:	|      48 8b 00             	mov    (%rax),%rax
+    1f6b:	|      48 85 c0             	test   %rax,%rax
+    1f6e:	|  /-- 75 20                	jne    1f90 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x80>
+    1f70:	|  |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1f74:	|  |   48 89 c7             	mov    %rax,%rdi
+    1f77:	|  |   e8 a5 01 00 00       	call   2121 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    1f7c:	|  |   48 89 c2             	mov    %rax,%rdx
+    1f7f:	|  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1f83:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1f86:	|  |   48 89 c7             	mov    %rax,%rdi
+    1f89:	|  |   e8 a1 01 00 00       	call   212f <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<unsigned char>(unsigned char&&)>
+    1f8e:	+--|-- eb 25                	jmp    1fb5 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0xa5>
+            return item_->push_back(forward<Args>(args)...);
+    1f90:	|  \-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1f94:	|      48 8b 18             	mov    (%rax),%rbx
+    1f97:	|      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1f9b:	|      48 89 c7             	mov    %rax,%rdi
+    1f9e:	|      e8 7e 01 00 00       	call   2121 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    1fa3:	|      48 89 c2             	mov    %rax,%rdx
+    1fa6:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1faa:	|      48 89 de             	mov    %rbx,%rsi
+    1fad:	|      48 89 c7             	mov    %rax,%rdi
+    1fb0:	|      e8 17 04 00 00       	call   23cc <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::push_back<unsigned char>(unsigned char&&)>
+        }
+    1fb5:	\----> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1fb9:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1fbd:	       c9                   	leave
+    1fbe:	       c3                   	ret
+
+0000000000001fbf <unsigned long bench::time_ns<bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}>(bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}&&)>:
+{
+    1fbf:	55                   	push   %rbp
+    1fc0:	48 89 e5             	mov    %rsp,%rbp
+    1fc3:	48 83 ec 20          	sub    $0x20,%rsp
+    1fc7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+
+    1fcb:	e8 06 f6 ff ff       	call   15d6 <bench::now_ns()>
+    1fd0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    auto t1 = bench::time_ns([]() {
+    1fd4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1fd8:	48 89 c7             	mov    %rax,%rdi
+    1fdb:	e8 56 fb ff ff       	call   1b36 <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const>
+        for (Index i = 0; i < n_moves; ++i) {
+    1fe0:	e8 f1 f5 ff ff       	call   15d6 <bench::now_ns()>
+    1fe5:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+            nel::elem::copy(buf2, buf1, buf_size);
+    1fe9:	c9                   	leave
+    1fea:	c3                   	ret
+    1feb:	90                   	nop
+
+0000000000001fec <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>:
+        constexpr Element &operator=(Element const &) const = delete;
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+    1fec:	55                   	push   %rbp
+    1fed:	48 89 e5             	mov    %rsp,%rbp
+    1ff0:	48 83 ec 10          	sub    $0x10,%rsp
+    1ff4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1ff8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    1ffc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2000:	48 89 c7             	mov    %rax,%rdi
+    2003:	e8 37 fc ff ff       	call   1c3f <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    2008:	8b 10                	mov    (%rax),%edx
+    200a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    200e:	89 10                	mov    %edx,(%rax)
+        {
+        }
+    2010:	90                   	nop
+    2011:	c9                   	leave
+    2012:	c3                   	ret
+    2013:	90                   	nop
+
+0000000000002014 <nel::Element<void*>::Element<void* const&>(void* const&)>:
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+    2014:	55                   	push   %rbp
+    2015:	48 89 e5             	mov    %rsp,%rbp
+    2018:	48 83 ec 10          	sub    $0x10,%rsp
+    201c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2020:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Args>(args)...)
+    2024:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2028:	48 89 c7             	mov    %rax,%rdi
+    202b:	e8 5f fc ff ff       	call   1c8f <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    2030:	48 8b 10             	mov    (%rax),%rdx
+    2033:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2037:	48 89 10             	mov    %rdx,(%rax)
+        {
+        }
+    203a:	90                   	nop
+    203b:	c9                   	leave
+    203c:	c3                   	ret
+    203d:	90                   	nop
+
+000000000000203e <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector()>:
+        constexpr Vector(void)
+    203e:	55                   	push   %rbp
+    203f:	48 89 e5             	mov    %rsp,%rbp
+    2042:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : item_(nullptr)
+    2046:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    204a:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        }
+    2051:	90                   	nop
+    2052:	5d                   	pop    %rbp
+    2053:	c3                   	ret
+
+0000000000002054 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::size_of(unsigned long)>:
+        // Largest number of values a node can hold, keeping its size within ISize.
+        static constexpr Count max_capacity = (__PTRDIFF_MAX__ - sizeof(Node)) / sizeof(T);
+
+        // Size in bytes of a node holding cap values.
+        // alignof(T) is included in align of Node.
+        static constexpr Length size_of(Count const cap)
+    2054:	55                   	push   %rbp
+    2055:	48 89 e5             	mov    %rsp,%rbp
+    2058:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    205c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2060:	48 c1 e0 08          	shl    $0x8,%rax
+    2064:	48 83 c0 10          	add    $0x10,%rax
+        }
+    2068:	5d                   	pop    %rbp
+    2069:	c3                   	ret
+
+000000000000206a <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*)>:
+        static void free(Node *old)
+    206a:	       55                   	push   %rbp
+    206b:	       48 89 e5             	mov    %rsp,%rbp
+    206e:	       48 83 ec 20          	sub    $0x20,%rsp
+    2072:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            if (old == nullptr) { return; }
+    2076:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    207b:	/----- 74 36                	je     20b3 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*)+0x49>
+            Length const sz = size_of(old->alloc_);
+    207d:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2081:	|      48 8b 00             	mov    (%rax),%rax
+    2084:	|      48 89 c7             	mov    %rax,%rdi
+    2087:	|      e8 c8 ff ff ff       	call   2054 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::size_of(unsigned long)>
+    208c:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            old->~Node();
+    2090:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2094:	|      48 89 c7             	mov    %rax,%rdi
+    2097:	|      e8 fc 03 00 00       	call   2498 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::~Node()>
+            Allocator::free(old, alignof(Node), sz);
+    209c:	|      48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    20a0:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20a4:	|      be 08 00 00 00       	mov    $0x8,%esi
+    20a9:	|      48 89 c7             	mov    %rax,%rdi
+    20ac:	|      e8 38 04 00 00       	call   24e9 <nel::heaped::Poisoned<true, nel::heaped::Malloc>::free(void*, unsigned long, unsigned long)>
+    20b1:	|  /-- eb 01                	jmp    20b4 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*)+0x4a>
+            if (old == nullptr) { return; }
+    20b3:	\--|-> 90                   	nop
+        }
+    20b4:	   \-> c9                   	leave
+    20b5:	       c3                   	ret
+
+00000000000020b6 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>:
+        bool try_reserve_for(Count const n)
+    20b6:	       55                   	push   %rbp
+    20b7:	       48 89 e5             	mov    %rsp,%rbp
+    20ba:	       53                   	push   %rbx
+    20bb:	       48 83 ec 18          	sub    $0x18,%rsp
+    20bf:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    20c3:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            if (len() + n <= capacity()) { return true; }
+    20c7:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20cb:	       48 89 c7             	mov    %rax,%rdi
+    20ce:	       e8 45 04 00 00       	call   2518 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    20d3:	       48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    20d7:	       48 8d 1c 10          	lea    (%rax,%rdx,1),%rbx
+    20db:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20df:	       48 89 c7             	mov    %rax,%rdi
+    20e2:	       e8 61 04 00 00       	call   2548 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    20e7:	       48 39 d8             	cmp    %rbx,%rax
+    20ea:	       0f 93 c0             	setae  %al
+    20ed:	       84 c0                	test   %al,%al
+    20ef:	   /-- 74 07                	je     20f8 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x42>
+    20f1:	   |   b8 01 00 00 00       	mov    $0x1,%eax
+    20f6:	/--|-- eb 23                	jmp    211b <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x65>
+            return try_reserve(len() + n);
+    20f8:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20fc:	|      48 89 c7             	mov    %rax,%rdi
+    20ff:	|      e8 14 04 00 00       	call   2518 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    2104:	|      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2108:	|      48 01 c2             	add    %rax,%rdx
+    210b:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    210f:	|      48 89 d6             	mov    %rdx,%rsi
+    2112:	|      48 89 c7             	mov    %rax,%rdi
+    2115:	|      e8 5e 04 00 00       	call   2578 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>
+    211a:	|      90                   	nop
+        }
+    211b:	\----> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    211f:	       c9                   	leave
+    2120:	       c3                   	ret
+
+0000000000002121 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>:
+constexpr U &&forward(T &t)
+    2121:	55                   	push   %rbp
+    2122:	48 89 e5             	mov    %rsp,%rbp
+    2125:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    2129:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    212d:	5d                   	pop    %rbp
+    212e:	c3                   	ret
+
+000000000000212f <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<unsigned char>(unsigned char&&)>:
+        constexpr static Result Err(Args &&...args)
+    212f:	55                   	push   %rbp
+    2130:	48 89 e5             	mov    %rsp,%rbp
+    2133:	48 83 ec 10          	sub    $0x10,%rsp
+    2137:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    213b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    213f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2143:	48 89 c7             	mov    %rax,%rdi
+    2146:	e8 d6 ff ff ff       	call   2121 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    214b:	48 89 c2             	mov    %rax,%rdx
+    214e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2152:	48 89 d6             	mov    %rdx,%rsi
+    2155:	48 89 c7             	mov    %rax,%rdi
+    2158:	e8 6f 05 00 00       	call   26cc <nel::Result<void, U8Buf<256ul> >::Result<unsigned char>(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)2>, unsigned char&&)>
+        }
+    215d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2161:	c9                   	leave
+    2162:	c3                   	ret
+    2163:	90                   	nop
+
+0000000000002164 <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::push_back<unsigned char>(unsigned char&&)>:
+            }
+        }
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+    2164:	       55                   	push   %rbp
+    2165:	       48 89 e5             	mov    %rsp,%rbp
+    2168:	       53                   	push   %rbx
+    2169:	       48 83 ec 28          	sub    $0x28,%rsp
+    216d:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2171:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2175:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+        {
+            if (len() >= capacity()) {
+    2179:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    217d:	       48 89 c7             	mov    %rax,%rdi
+    2180:	       e8 89 05 00 00       	call   270e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::len() const>
+    2185:	       48 89 c3             	mov    %rax,%rbx
+    2188:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    218c:	       48 89 c7             	mov    %rax,%rdi
+    218f:	       e8 8c 05 00 00       	call   2720 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::capacity() const>
+    2194:	       48 39 c3             	cmp    %rax,%rbx
+    2197:	       0f 93 c0             	setae  %al
+    219a:	       84 c0                	test   %al,%al
+    219c:	   /-- 74 20                	je     21be <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::push_back<unsigned char>(unsigned char&&)+0x5a>
+                // TODO: don't want to create a T on error though..
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+    219e:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    21a2:	   |   48 89 c7             	mov    %rax,%rdi
+    21a5:	   |   e8 77 ff ff ff       	call   2121 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    21aa:	   |   48 89 c2             	mov    %rax,%rdx
+    21ad:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    21b1:	   |   48 89 d6             	mov    %rdx,%rsi
+    21b4:	   |   48 89 c7             	mov    %rax,%rdi
+    21b7:	   |   e8 73 ff ff ff       	call   212f <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<unsigned char>(unsigned char&&)>
+    21bc:	/--|-- eb 67                	jmp    2225 <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::push_back<unsigned char>(unsigned char&&)+0xc1>
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    21be:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    21c2:	|      48 89 c7             	mov    %rax,%rdi
+    21c5:	|      e8 44 05 00 00       	call   270e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::len() const>
+    21ca:	|      48 c1 e0 08          	shl    $0x8,%rax
+    21ce:	|      48 8d 50 10          	lea    0x10(%rax),%rdx
+    21d2:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    21d6:	|      48 01 d0             	add    %rdx,%rax
+    21d9:	|      48 89 c6             	mov    %rax,%rsi
+    21dc:	|      bf 00 01 00 00       	mov    $0x100,%edi
+    21e1:	|      e8 10 f5 ff ff       	call   16f6 <operator new(unsigned long, void*)>
+    21e6:	|      48 89 c3             	mov    %rax,%rbx
+    21e9:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    21ed:	|      48 89 c7             	mov    %rax,%rdi
+    21f0:	|      e8 2c ff ff ff       	call   2121 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    21f5:	|      0f b6 00             	movzbl (%rax),%eax
+    21f8:	|      0f b6 c0             	movzbl %al,%eax
+    21fb:	|      89 c6                	mov    %eax,%esi
+    21fd:	|      48 89 df             	mov    %rbx,%rdi
+    2200:	|      e8 2d 05 00 00       	call   2732 <U8Buf<256ul>::U8Buf(unsigned char)>
+            len_ += 1;
+    2205:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2209:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    220d:	|      48 8d 50 01          	lea    0x1(%rax),%rdx
+    2211:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2215:	|      48 89 50 08          	mov    %rdx,0x8(%rax)
+            return Result<void, Type>::Ok();
+    2219:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    221d:	|      48 89 c7             	mov    %rax,%rdi
+    2220:	|      e8 38 05 00 00       	call   275d <nel::Result<void, U8Buf<256ul> >::Ok()>
+        }
+    2225:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2229:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    222d:	       c9                   	leave
+    222e:	       c3                   	ret
+    222f:	       90                   	nop
+
+0000000000002230 <U8Buf<256ul>::~U8Buf()>:
+        constexpr ~U8Buf(void)
+    2230:	55                   	push   %rbp
+    2231:	48 89 e5             	mov    %rsp,%rbp
+    2234:	48 83 ec 10          	sub    $0x10,%rsp
+    2238:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            nel::elem::set(data_, 0xa5, N);
+    223c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2240:	ba 00 01 00 00       	mov    $0x100,%edx
+    2245:	be a5 00 00 00       	mov    $0xa5,%esi
+    224a:	48 89 c7             	mov    %rax,%rdi
+    224d:	e8 cf 12 00 00       	call   3521 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    2252:	90                   	nop
+    2253:	c9                   	leave
+    2254:	c3                   	ret
+    2255:	90                   	nop
+
+0000000000002256 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    2256:	             55                   	push   %rbp
+    2257:	             48 89 e5             	mov    %rsp,%rbp
+    225a:	             48 83 ec 20          	sub    $0x20,%rsp
+    225e:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2262:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2266:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    226a:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result<void>-match
+    226e:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2272:	             8b 00                	mov    (%rax),%eax
+    2274:	             83 f8 02             	cmp    $0x2,%eax
+    2277:	         /-- 74 1c                	je     2295 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x3f>
+    2279:	         |   83 f8 02             	cmp    $0x2,%eax
+    227c:	/--------|-- 7f 51                	jg     22cf <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x79>
+    227e:	|        |   85 c0                	test   %eax,%eax
+    2280:	|     /--|-- 74 37                	je     22b9 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x63>
+    2282:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    2285:	+-----|--|-- 75 48                	jne    22cf <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x79>
+                    return on_ok();
+    2287:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    228b:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    228e:	|     |  |   e8 c7 fb ff ff       	call   1e5a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}::operator()() const>
+    2293:	|  /--|--|-- eb 50                	jmp    22e5 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_err(*err_);
+    2295:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2299:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    229d:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    22a0:	|  |  |      e8 d7 04 00 00       	call   277c <nel::Element<U8Buf<256ul> >::operator*() const>
+    22a5:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    22a8:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22ac:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    22af:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    22b2:	|  |  |      e8 b3 fb ff ff       	call   1e6a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}::operator()(U8Buf<256ul> const&) const>
+    22b7:	|  +--|----- eb 2c                	jmp    22e5 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x8f>
+                    nel::panic("invalid Result", ctx);
+    22b9:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    22bd:	|  |         48 89 c6             	mov    %rax,%rsi
+    22c0:	|  |         48 8d 05 43 1e 00 00 	lea    0x1e43(%rip),%rax        # 410a <n_moves+0xd2>
+    22c7:	|  |         48 89 c7             	mov    %rax,%rdi
+    22ca:	|  |         e8 6e 11 00 00       	call   343d <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    22cf:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    22d3:	   |         48 89 c6             	mov    %rax,%rsi
+    22d6:	   |         48 8d 05 fe 1d 00 00 	lea    0x1dfe(%rip),%rax        # 40db <n_moves+0xa3>
+    22dd:	   |         48 89 c7             	mov    %rax,%rdi
+    22e0:	   |         e8 58 11 00 00       	call   343d <nel::panic(char const*, nel::Context const&)>
+        }
+    22e5:	   \-------> c9                   	leave
+    22e6:	             c3                   	ret
+    22e7:	             90                   	nop
+
+00000000000022e8 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector()>:
+        constexpr Vector(void)
+    22e8:	55                   	push   %rbp
+    22e9:	48 89 e5             	mov    %rsp,%rbp
+    22ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : item_(nullptr)
+    22f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22f4:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        }
+    22fb:	90                   	nop
+    22fc:	5d                   	pop    %rbp
+    22fd:	c3                   	ret
+
+00000000000022fe <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::size_of(unsigned long)>:
+        static constexpr Length size_of(Count const cap)
+    22fe:	55                   	push   %rbp
+    22ff:	48 89 e5             	mov    %rsp,%rbp
+    2302:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    2306:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    230a:	48 c1 e0 08          	shl    $0x8,%rax
+    230e:	48 83 c0 10          	add    $0x10,%rax
+        }
+    2312:	5d                   	pop    %rbp
+    2313:	c3                   	ret
+
+0000000000002314 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*)>:
+        static void free(Node *old)
+    2314:	       55                   	push   %rbp
+    2315:	       48 89 e5             	mov    %rsp,%rbp
+    2318:	       48 83 ec 20          	sub    $0x20,%rsp
+    231c:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            if (old == nullptr) { return; }
+    2320:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    2325:	/----- 74 36                	je     235d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*)+0x49>
+            Length const sz = size_of(old->alloc_);
+    2327:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    232b:	|      48 8b 00             	mov    (%rax),%rax
+    232e:	|      48 89 c7             	mov    %rax,%rdi
+    2331:	|      e8 c8 ff ff ff       	call   22fe <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::size_of(unsigned long)>
+    2336:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            old->~Node();
+    233a:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    233e:	|      48 89 c7             	mov    %rax,%rdi
+    2341:	|      e8 50 04 00 00       	call   2796 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::~Node()>
+            Allocator::free(old, alignof(Node), sz);
+    2346:	|      48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    234a:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    234e:	|      be 08 00 00 00       	mov    $0x8,%esi
+    2353:	|      48 89 c7             	mov    %rax,%rdi
+    2356:	|      e8 8c 04 00 00       	call   27e7 <nel::heaped::Poisoned<false, nel::heaped::Malloc>::free(void*, unsigned long, unsigned long)>
+    235b:	|  /-- eb 01                	jmp    235e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*)+0x4a>
+            if (old == nullptr) { return; }
+    235d:	\--|-> 90                   	nop
+        }
+    235e:	   \-> c9                   	leave
+    235f:	       c3                   	ret
+
+0000000000002360 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>:
+        bool try_reserve_for(Count const n)
+    2360:	       55                   	push   %rbp
+    2361:	       48 89 e5             	mov    %rsp,%rbp
+    2364:	       53                   	push   %rbx
+    2365:	       48 83 ec 18          	sub    $0x18,%rsp
+    2369:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    236d:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            if (len() + n <= capacity()) { return true; }
+    2371:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2375:	       48 89 c7             	mov    %rax,%rdi
+    2378:	       e8 99 04 00 00       	call   2816 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    237d:	       48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2381:	       48 8d 1c 10          	lea    (%rax,%rdx,1),%rbx
+    2385:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2389:	       48 89 c7             	mov    %rax,%rdi
+    238c:	       e8 b5 04 00 00       	call   2846 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    2391:	       48 39 d8             	cmp    %rbx,%rax
+    2394:	       0f 93 c0             	setae  %al
+    2397:	       84 c0                	test   %al,%al
+    2399:	   /-- 74 07                	je     23a2 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x42>
+    239b:	   |   b8 01 00 00 00       	mov    $0x1,%eax
+    23a0:	/--|-- eb 23                	jmp    23c5 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x65>
+            return try_reserve(len() + n);
+    23a2:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    23a6:	|      48 89 c7             	mov    %rax,%rdi
+    23a9:	|      e8 68 04 00 00       	call   2816 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    23ae:	|      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    23b2:	|      48 01 c2             	add    %rax,%rdx
+    23b5:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    23b9:	|      48 89 d6             	mov    %rdx,%rsi
+    23bc:	|      48 89 c7             	mov    %rax,%rdi
+    23bf:	|      e8 b2 04 00 00       	call   2876 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>
+    23c4:	|      90                   	nop
+        }
+    23c5:	\----> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    23c9:	       c9                   	leave
+    23ca:	       c3                   	ret
+    23cb:	       90                   	nop
+
+00000000000023cc <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::push_back<unsigned char>(unsigned char&&)>:
+        Result<void, T> push_back(Args &&...args)
+    23cc:	       55                   	push   %rbp
+    23cd:	       48 89 e5             	mov    %rsp,%rbp
+    23d0:	       53                   	push   %rbx
+    23d1:	       48 83 ec 28          	sub    $0x28,%rsp
+    23d5:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    23d9:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    23dd:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            if (len() >= capacity()) {
+    23e1:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    23e5:	       48 89 c7             	mov    %rax,%rdi
+    23e8:	       e8 dd 05 00 00       	call   29ca <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::len() const>
+    23ed:	       48 89 c3             	mov    %rax,%rbx
+    23f0:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    23f4:	       48 89 c7             	mov    %rax,%rdi
+    23f7:	       e8 e0 05 00 00       	call   29dc <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::capacity() const>
+    23fc:	       48 39 c3             	cmp    %rax,%rbx
+    23ff:	       0f 93 c0             	setae  %al
+    2402:	       84 c0                	test   %al,%al
+    2404:	   /-- 74 20                	je     2426 <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::push_back<unsigned char>(unsigned char&&)+0x5a>
+                return Result<void, Type>::Err(forward<Args>(args)...);
+    2406:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    240a:	   |   48 89 c7             	mov    %rax,%rdi
+    240d:	   |   e8 0f fd ff ff       	call   2121 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    2412:	   |   48 89 c2             	mov    %rax,%rdx
+    2415:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2419:	   |   48 89 d6             	mov    %rdx,%rsi
+    241c:	   |   48 89 c7             	mov    %rax,%rdi
+    241f:	   |   e8 0b fd ff ff       	call   212f <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<unsigned char>(unsigned char&&)>
+    2424:	/--|-- eb 67                	jmp    248d <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::push_back<unsigned char>(unsigned char&&)+0xc1>
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    2426:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    242a:	|      48 89 c7             	mov    %rax,%rdi
+    242d:	|      e8 98 05 00 00       	call   29ca <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::len() const>
+    2432:	|      48 c1 e0 08          	shl    $0x8,%rax
+    2436:	|      48 8d 50 10          	lea    0x10(%rax),%rdx
+    243a:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    243e:	|      48 01 d0             	add    %rdx,%rax
+    2441:	|      48 89 c6             	mov    %rax,%rsi
+    2444:	|      bf 00 01 00 00       	mov    $0x100,%edi
+    2449:	|      e8 a8 f2 ff ff       	call   16f6 <operator new(unsigned long, void*)>
+    244e:	|      48 89 c3             	mov    %rax,%rbx
+    2451:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2455:	|      48 89 c7             	mov    %rax,%rdi
+    2458:	|      e8 c4 fc ff ff       	call   2121 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    245d:	|      0f b6 00             	movzbl (%rax),%eax
+    2460:	|      0f b6 c0             	movzbl %al,%eax
+    2463:	|      89 c6                	mov    %eax,%esi
+    2465:	|      48 89 df             	mov    %rbx,%rdi
+    2468:	|      e8 c5 02 00 00       	call   2732 <U8Buf<256ul>::U8Buf(unsigned char)>
+            len_ += 1;
+    246d:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2471:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    2475:	|      48 8d 50 01          	lea    0x1(%rax),%rdx
+    2479:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    247d:	|      48 89 50 08          	mov    %rdx,0x8(%rax)
+            return Result<void, Type>::Ok();
+    2481:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2485:	|      48 89 c7             	mov    %rax,%rdi
+    2488:	|      e8 d0 02 00 00       	call   275d <nel::Result<void, U8Buf<256ul> >::Ok()>
+        }
+    248d:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2491:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2495:	       c9                   	leave
+    2496:	       c3                   	ret
+    2497:	       90                   	nop
+
+0000000000002498 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::~Node()>:
+        constexpr ~Node(void)
+    2498:	       55                   	push   %rbp
+    2499:	       48 89 e5             	mov    %rsp,%rbp
+    249c:	       48 83 ec 20          	sub    $0x20,%rsp
+    24a0:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            for (Index i = 0; i < len(); ++i) {
+    24a4:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    24ab:	       00 
+    24ac:	   /-- eb 20                	jmp    24ce <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::~Node()+0x36>
+                values_[i].~Type();
+    24ae:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24b2:	|  |   48 c1 e0 08          	shl    $0x8,%rax
+    24b6:	|  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    24ba:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24be:	|  |   48 01 d0             	add    %rdx,%rax
+    24c1:	|  |   48 89 c7             	mov    %rax,%rdi
+    24c4:	|  |   e8 67 fd ff ff       	call   2230 <U8Buf<256ul>::~U8Buf()>
+            for (Index i = 0; i < len(); ++i) {
+    24c9:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    24ce:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24d2:	|      48 89 c7             	mov    %rax,%rdi
+    24d5:	|      e8 34 02 00 00       	call   270e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::len() const>
+    24da:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    24de:	|      0f 92 c0             	setb   %al
+    24e1:	|      84 c0                	test   %al,%al
+    24e3:	\----- 75 c9                	jne    24ae <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::~Node()+0x16>
+        }
+    24e5:	       90                   	nop
+    24e6:	       90                   	nop
+    24e7:	       c9                   	leave
+    24e8:	       c3                   	ret
+
+00000000000024e9 <nel::heaped::Poisoned<true, nel::heaped::Malloc>::free(void*, unsigned long, unsigned long)>:
+                                                      Length const new_size)
+        {
+            return Upstream::try_realloc(p, align, old_size, new_size);
+        }
+
+        static void free(void *const p, Length const align, Length const size)
+    24e9:	55                   	push   %rbp
+    24ea:	48 89 e5             	mov    %rsp,%rbp
+    24ed:	48 83 ec 20          	sub    $0x20,%rsp
+    24f1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    24f5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    24f9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            Upstream::free(p, align, size);
+    24fd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2501:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2505:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2509:	48 89 ce             	mov    %rcx,%rsi
+    250c:	48 89 c7             	mov    %rax,%rdi
+    250f:	e8 6b f3 ff ff       	call   187f <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>
+        }
+    2514:	90                   	nop
+    2515:	c9                   	leave
+    2516:	c3                   	ret
+    2517:	90                   	nop
+
+0000000000002518 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>:
+        constexpr Length len(void) const
+    2518:	       55                   	push   %rbp
+    2519:	       48 89 e5             	mov    %rsp,%rbp
+    251c:	       48 83 ec 10          	sub    $0x10,%rsp
+    2520:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->len();
+    2524:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2528:	       48 8b 00             	mov    (%rax),%rax
+    252b:	       48 85 c0             	test   %rax,%rax
+    252e:	/----- 74 11                	je     2541 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x29>
+    2530:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2534:	|      48 8b 00             	mov    (%rax),%rax
+    2537:	|      48 89 c7             	mov    %rax,%rdi
+    253a:	|      e8 cf 01 00 00       	call   270e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::len() const>
+    253f:	|  /-- eb 05                	jmp    2546 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x2e>
+    2541:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    2546:	   \-> c9                   	leave
+    2547:	       c3                   	ret
+
+0000000000002548 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>:
+        constexpr Count capacity(void) const
+    2548:	       55                   	push   %rbp
+    2549:	       48 89 e5             	mov    %rsp,%rbp
+    254c:	       48 83 ec 10          	sub    $0x10,%rsp
+    2550:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->capacity();
+    2554:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2558:	       48 8b 00             	mov    (%rax),%rax
+    255b:	       48 85 c0             	test   %rax,%rax
+    255e:	/----- 74 11                	je     2571 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x29>
+    2560:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2564:	|      48 8b 00             	mov    (%rax),%rax
+    2567:	|      48 89 c7             	mov    %rax,%rdi
+    256a:	|      e8 b1 01 00 00       	call   2720 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::capacity() const>
+    256f:	|  /-- eb 05                	jmp    2576 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x2e>
+    2571:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    2576:	   \-> c9                   	leave
+    2577:	       c3                   	ret
+
+0000000000002578 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>:
+        bool try_reserve(Count new_cap)
+    2578:	             55                   	push   %rbp
+    2579:	             48 89 e5             	mov    %rsp,%rbp
+    257c:	             48 83 ec 20          	sub    $0x20,%rsp
+    2580:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2584:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            new_cap = Growth::capacity_for(capacity(), new_cap);
+    2588:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    258c:	             48 89 c7             	mov    %rax,%rdi
+    258f:	             e8 b4 ff ff ff       	call   2548 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    2594:	             48 89 c2             	mov    %rax,%rdx
+    2597:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    259b:	             48 89 c6             	mov    %rax,%rsi
+    259e:	             48 89 d7             	mov    %rdx,%rdi
+    25a1:	             e8 47 04 00 00       	call   29ed <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>
+    25a6:	             48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (new_cap < len()) { new_cap = len(); }
+    25aa:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25ae:	             48 89 c7             	mov    %rax,%rdi
+    25b1:	             e8 62 ff ff ff       	call   2518 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    25b6:	             48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    25ba:	             0f 92 c0             	setb   %al
+    25bd:	             84 c0                	test   %al,%al
+    25bf:	         /-- 74 10                	je     25d1 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x59>
+    25c1:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25c5:	         |   48 89 c7             	mov    %rax,%rdi
+    25c8:	         |   e8 4b ff ff ff       	call   2518 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    25cd:	         |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (item_ == nullptr) {
+    25d1:	         \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25d5:	             48 8b 00             	mov    (%rax),%rax
+    25d8:	             48 85 c0             	test   %rax,%rax
+    25db:	         /-- 75 2d                	jne    260a <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x92>
+                item_ = VectorNode::malloc(new_cap);
+    25dd:	         |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    25e1:	         |   48 89 c7             	mov    %rax,%rdi
+    25e4:	         |   e8 50 04 00 00       	call   2a39 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::malloc(unsigned long)>
+    25e9:	         |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    25ed:	         |   48 89 02             	mov    %rax,(%rdx)
+                if (item_ == nullptr) { return false; }
+    25f0:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25f4:	         |   48 8b 00             	mov    (%rax),%rax
+    25f7:	         |   48 85 c0             	test   %rax,%rax
+    25fa:	/--------|-- 0f 85 c4 00 00 00    	jne    26c4 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+    2600:	|        |   b8 00 00 00 00       	mov    $0x0,%eax
+    2605:	|  /-----|-- e9 bf 00 00 00       	jmp    26c9 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+            } else if (new_cap == item_->capacity()) {
+    260a:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    260e:	|  |         48 8b 00             	mov    (%rax),%rax
+    2611:	|  |         48 89 c7             	mov    %rax,%rdi
+    2614:	|  |         e8 07 01 00 00       	call   2720 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::capacity() const>
+    2619:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    261d:	|  |         0f 94 c0             	sete   %al
+    2620:	|  |         84 c0                	test   %al,%al
+    2622:	+--|-------- 0f 85 9c 00 00 00    	jne    26c4 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap > item_->capacity()) {
+    2628:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    262c:	|  |         48 8b 00             	mov    (%rax),%rax
+    262f:	|  |         48 89 c7             	mov    %rax,%rdi
+    2632:	|  |         e8 e9 00 00 00       	call   2720 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::capacity() const>
+    2637:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    263b:	|  |         0f 92 c0             	setb   %al
+    263e:	|  |         84 c0                	test   %al,%al
+    2640:	|  |  /----- 74 35                	je     2677 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xff>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    2642:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2646:	|  |  |      48 8b 00             	mov    (%rax),%rax
+    2649:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    264d:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    2650:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2653:	|  |  |      e8 15 05 00 00       	call   2b6d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)>
+    2658:	|  |  |      48 89 45 f0          	mov    %rax,-0x10(%rbp)
+                if (p == nullptr) { return false; }
+    265c:	|  |  |      48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2661:	|  |  |  /-- 75 07                	jne    266a <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xf2>
+    2663:	|  |  |  |   b8 00 00 00 00       	mov    $0x0,%eax
+    2668:	|  +--|--|-- eb 5f                	jmp    26c9 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    266a:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    266e:	|  |  |      48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2672:	|  |  |      48 89 10             	mov    %rdx,(%rax)
+    2675:	+--|--|----- eb 4d                	jmp    26c4 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap < item_->capacity()) {
+    2677:	|  |  \----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    267b:	|  |         48 8b 00             	mov    (%rax),%rax
+    267e:	|  |         48 89 c7             	mov    %rax,%rdi
+    2681:	|  |         e8 9a 00 00 00       	call   2720 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::capacity() const>
+    2686:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    268a:	|  |         0f 92 c0             	setb   %al
+    268d:	|  |         84 c0                	test   %al,%al
+    268f:	+--|-------- 74 33                	je     26c4 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    2691:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2695:	|  |         48 8b 00             	mov    (%rax),%rax
+    2698:	|  |         48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    269c:	|  |         48 89 d6             	mov    %rdx,%rsi
+    269f:	|  |         48 89 c7             	mov    %rax,%rdi
+    26a2:	|  |         e8 c6 04 00 00       	call   2b6d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)>
+    26a7:	|  |         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                if (p == nullptr) { return false; }
+    26ab:	|  |         48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    26b0:	|  |     /-- 75 07                	jne    26b9 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x141>
+    26b2:	|  |     |   b8 00 00 00 00       	mov    $0x0,%eax
+    26b7:	|  +-----|-- eb 10                	jmp    26c9 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    26b9:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26bd:	|  |         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    26c1:	|  |         48 89 10             	mov    %rdx,(%rax)
+            return true;
+    26c4:	\--|-------> b8 01 00 00 00       	mov    $0x1,%eax
+        }
+    26c9:	   \-------> c9                   	leave
+    26ca:	             c3                   	ret
+    26cb:	             90                   	nop
+
+00000000000026cc <nel::Result<void, U8Buf<256ul> >::Result<unsigned char>(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)2>, unsigned char&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+    26cc:	55                   	push   %rbp
+    26cd:	48 89 e5             	mov    %rsp,%rbp
+    26d0:	53                   	push   %rbx
+    26d1:	48 83 ec 18          	sub    $0x18,%rsp
+    26d5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    26d9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    26dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26e1:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<Args>(args)...)
+    26e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26eb:	48 8d 58 04          	lea    0x4(%rax),%rbx
+    26ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    26f3:	48 89 c7             	mov    %rax,%rdi
+    26f6:	e8 26 fa ff ff       	call   2121 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    26fb:	48 89 c6             	mov    %rax,%rsi
+    26fe:	48 89 df             	mov    %rbx,%rdi
+    2701:	e8 88 06 00 00       	call   2d8e <nel::Element<U8Buf<256ul> >::Element<unsigned char>(unsigned char&&)>
+        }
+    2706:	90                   	nop
+    2707:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    270b:	c9                   	leave
+    270c:	c3                   	ret
+    270d:	90                   	nop
+
+000000000000270e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::len() const>:
+        constexpr Length len(void) const
+    270e:	55                   	push   %rbp
+    270f:	48 89 e5             	mov    %rsp,%rbp
+    2712:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    2716:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    271a:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    271e:	5d                   	pop    %rbp
+    271f:	c3                   	ret
+
+0000000000002720 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::capacity() const>:
+        constexpr Count capacity(void) const
+    2720:	55                   	push   %rbp
+    2721:	48 89 e5             	mov    %rsp,%rbp
+    2724:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return alloc_;
+    2728:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    272c:	48 8b 00             	mov    (%rax),%rax
+        }
+    272f:	5d                   	pop    %rbp
+    2730:	c3                   	ret
+    2731:	90                   	nop
+
+0000000000002732 <U8Buf<256ul>::U8Buf(unsigned char)>:
+        constexpr U8Buf(uint8_t const f)
+    2732:	55                   	push   %rbp
+    2733:	48 89 e5             	mov    %rsp,%rbp
+    2736:	48 83 ec 10          	sub    $0x10,%rsp
+    273a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    273e:	89 f0                	mov    %esi,%eax
+    2740:	88 45 f4             	mov    %al,-0xc(%rbp)
+            nel::elem::set(data_, f, N);
+    2743:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    2747:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    274b:	ba 00 01 00 00       	mov    $0x100,%edx
+    2750:	89 ce                	mov    %ecx,%esi
+    2752:	48 89 c7             	mov    %rax,%rdi
+    2755:	e8 c7 0d 00 00       	call   3521 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    275a:	90                   	nop
+    275b:	c9                   	leave
+    275c:	c3                   	ret
+
+000000000000275d <nel::Result<void, U8Buf<256ul> >::Ok()>:
+        constexpr static Result Ok(void)
+    275d:	55                   	push   %rbp
+    275e:	48 89 e5             	mov    %rsp,%rbp
+    2761:	48 83 ec 10          	sub    $0x10,%rsp
+    2765:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Result(Phantom<Tag::OK>());
+    2769:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    276d:	48 89 c7             	mov    %rax,%rdi
+    2770:	e8 51 06 00 00       	call   2dc6 <nel::Result<void, U8Buf<256ul> >::Result(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)1>)>
+        }
+    2775:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2779:	c9                   	leave
+    277a:	c3                   	ret
+    277b:	90                   	nop
+
+000000000000277c <nel::Element<U8Buf<256ul> >::operator*() const>:
+        constexpr Type &ref(void)
+        {
+            return value_;
+        }
+
+        constexpr Type const &operator*(void) const
+    277c:	55                   	push   %rbp
+    277d:	48 89 e5             	mov    %rsp,%rbp
+    2780:	48 83 ec 10          	sub    $0x10,%rsp
+    2784:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    2788:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    278c:	48 89 c7             	mov    %rax,%rdi
+    278f:	e8 48 06 00 00       	call   2ddc <nel::Element<U8Buf<256ul> >::ref() const>
+        }
+    2794:	c9                   	leave
+    2795:	c3                   	ret
+
+0000000000002796 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::~Node()>:
+        constexpr ~Node(void)
+    2796:	       55                   	push   %rbp
+    2797:	       48 89 e5             	mov    %rsp,%rbp
+    279a:	       48 83 ec 20          	sub    $0x20,%rsp
+    279e:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            for (Index i = 0; i < len(); ++i) {
+    27a2:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    27a9:	       00 
+    27aa:	   /-- eb 20                	jmp    27cc <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::~Node()+0x36>
+                values_[i].~Type();
+    27ac:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27b0:	|  |   48 c1 e0 08          	shl    $0x8,%rax
+    27b4:	|  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    27b8:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27bc:	|  |   48 01 d0             	add    %rdx,%rax
+    27bf:	|  |   48 89 c7             	mov    %rax,%rdi
+    27c2:	|  |   e8 69 fa ff ff       	call   2230 <U8Buf<256ul>::~U8Buf()>
+            for (Index i = 0; i < len(); ++i) {
+    27c7:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    27cc:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27d0:	|      48 89 c7             	mov    %rax,%rdi
+    27d3:	|      e8 f2 01 00 00       	call   29ca <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::len() const>
+    27d8:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    27dc:	|      0f 92 c0             	setb   %al
+    27df:	|      84 c0                	test   %al,%al
+    27e1:	\----- 75 c9                	jne    27ac <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::~Node()+0x16>
+        }
+    27e3:	       90                   	nop
+    27e4:	       90                   	nop
+    27e5:	       c9                   	leave
+    27e6:	       c3                   	ret
+
+00000000000027e7 <nel::heaped::Poisoned<false, nel::heaped::Malloc>::free(void*, unsigned long, unsigned long)>:
+        static void free(void *const p, Length const align, Length const size)
+    27e7:	55                   	push   %rbp
+    27e8:	48 89 e5             	mov    %rsp,%rbp
+    27eb:	48 83 ec 20          	sub    $0x20,%rsp
+    27ef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    27f3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    27f7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            Upstream::free(p, align, size);
+    27fb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    27ff:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2803:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2807:	48 89 ce             	mov    %rcx,%rsi
+    280a:	48 89 c7             	mov    %rax,%rdi
+    280d:	e8 6d f0 ff ff       	call   187f <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>
+        }
+    2812:	90                   	nop
+    2813:	c9                   	leave
+    2814:	c3                   	ret
+    2815:	90                   	nop
+
+0000000000002816 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>:
+        constexpr Length len(void) const
+    2816:	       55                   	push   %rbp
+    2817:	       48 89 e5             	mov    %rsp,%rbp
+    281a:	       48 83 ec 10          	sub    $0x10,%rsp
+    281e:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->len();
+    2822:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2826:	       48 8b 00             	mov    (%rax),%rax
+    2829:	       48 85 c0             	test   %rax,%rax
+    282c:	/----- 74 11                	je     283f <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x29>
+    282e:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2832:	|      48 8b 00             	mov    (%rax),%rax
+    2835:	|      48 89 c7             	mov    %rax,%rdi
+    2838:	|      e8 8d 01 00 00       	call   29ca <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::len() const>
+    283d:	|  /-- eb 05                	jmp    2844 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x2e>
+    283f:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    2844:	   \-> c9                   	leave
+    2845:	       c3                   	ret
+
+0000000000002846 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>:
+        constexpr Count capacity(void) const
+    2846:	       55                   	push   %rbp
+    2847:	       48 89 e5             	mov    %rsp,%rbp
+    284a:	       48 83 ec 10          	sub    $0x10,%rsp
+    284e:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->capacity();
+    2852:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2856:	       48 8b 00             	mov    (%rax),%rax
+    2859:	       48 85 c0             	test   %rax,%rax
+    285c:	/----- 74 11                	je     286f <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x29>
+    285e:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2862:	|      48 8b 00             	mov    (%rax),%rax
+    2865:	|      48 89 c7             	mov    %rax,%rdi
+    2868:	|      e8 6f 01 00 00       	call   29dc <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::capacity() const>
+    286d:	|  /-- eb 05                	jmp    2874 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x2e>
+    286f:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    2874:	   \-> c9                   	leave
+    2875:	       c3                   	ret
+
+0000000000002876 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>:
+        bool try_reserve(Count new_cap)
+    2876:	             55                   	push   %rbp
+    2877:	             48 89 e5             	mov    %rsp,%rbp
+    287a:	             48 83 ec 20          	sub    $0x20,%rsp
+    287e:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2882:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            new_cap = Growth::capacity_for(capacity(), new_cap);
+    2886:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    288a:	             48 89 c7             	mov    %rax,%rdi
+    288d:	             e8 b4 ff ff ff       	call   2846 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    2892:	             48 89 c2             	mov    %rax,%rdx
+    2895:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2899:	             48 89 c6             	mov    %rax,%rsi
+    289c:	             48 89 d7             	mov    %rdx,%rdi
+    289f:	             e8 49 01 00 00       	call   29ed <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>
+    28a4:	             48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (new_cap < len()) { new_cap = len(); }
+    28a8:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28ac:	             48 89 c7             	mov    %rax,%rdi
+    28af:	             e8 62 ff ff ff       	call   2816 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    28b4:	             48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    28b8:	             0f 92 c0             	setb   %al
+    28bb:	             84 c0                	test   %al,%al
+    28bd:	         /-- 74 10                	je     28cf <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x59>
+    28bf:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28c3:	         |   48 89 c7             	mov    %rax,%rdi
+    28c6:	         |   e8 4b ff ff ff       	call   2816 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    28cb:	         |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (item_ == nullptr) {
+    28cf:	         \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28d3:	             48 8b 00             	mov    (%rax),%rax
+    28d6:	             48 85 c0             	test   %rax,%rax
+    28d9:	         /-- 75 2d                	jne    2908 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x92>
+                item_ = VectorNode::malloc(new_cap);
+    28db:	         |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    28df:	         |   48 89 c7             	mov    %rax,%rdi
+    28e2:	         |   e8 03 05 00 00       	call   2dea <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::malloc(unsigned long)>
+    28e7:	         |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    28eb:	         |   48 89 02             	mov    %rax,(%rdx)
+                if (item_ == nullptr) { return false; }
+    28ee:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28f2:	         |   48 8b 00             	mov    (%rax),%rax
+    28f5:	         |   48 85 c0             	test   %rax,%rax
+    28f8:	/--------|-- 0f 85 c4 00 00 00    	jne    29c2 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+    28fe:	|        |   b8 00 00 00 00       	mov    $0x0,%eax
+    2903:	|  /-----|-- e9 bf 00 00 00       	jmp    29c7 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+            } else if (new_cap == item_->capacity()) {
+    2908:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    290c:	|  |         48 8b 00             	mov    (%rax),%rax
+    290f:	|  |         48 89 c7             	mov    %rax,%rdi
+    2912:	|  |         e8 c5 00 00 00       	call   29dc <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::capacity() const>
+    2917:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    291b:	|  |         0f 94 c0             	sete   %al
+    291e:	|  |         84 c0                	test   %al,%al
+    2920:	+--|-------- 0f 85 9c 00 00 00    	jne    29c2 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap > item_->capacity()) {
+    2926:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    292a:	|  |         48 8b 00             	mov    (%rax),%rax
+    292d:	|  |         48 89 c7             	mov    %rax,%rdi
+    2930:	|  |         e8 a7 00 00 00       	call   29dc <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::capacity() const>
+    2935:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    2939:	|  |         0f 92 c0             	setb   %al
+    293c:	|  |         84 c0                	test   %al,%al
+    293e:	|  |  /----- 74 35                	je     2975 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xff>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    2940:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2944:	|  |  |      48 8b 00             	mov    (%rax),%rax
+    2947:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    294b:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    294e:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2951:	|  |  |      e8 ce 04 00 00       	call   2e24 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)>
+    2956:	|  |  |      48 89 45 f0          	mov    %rax,-0x10(%rbp)
+                if (p == nullptr) { return false; }
+    295a:	|  |  |      48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    295f:	|  |  |  /-- 75 07                	jne    2968 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xf2>
+    2961:	|  |  |  |   b8 00 00 00 00       	mov    $0x0,%eax
+    2966:	|  +--|--|-- eb 5f                	jmp    29c7 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    2968:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    296c:	|  |  |      48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2970:	|  |  |      48 89 10             	mov    %rdx,(%rax)
+    2973:	+--|--|----- eb 4d                	jmp    29c2 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap < item_->capacity()) {
+    2975:	|  |  \----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2979:	|  |         48 8b 00             	mov    (%rax),%rax
+    297c:	|  |         48 89 c7             	mov    %rax,%rdi
+    297f:	|  |         e8 58 00 00 00       	call   29dc <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::capacity() const>
+    2984:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    2988:	|  |         0f 92 c0             	setb   %al
+    298b:	|  |         84 c0                	test   %al,%al
+    298d:	+--|-------- 74 33                	je     29c2 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    298f:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2993:	|  |         48 8b 00             	mov    (%rax),%rax
+    2996:	|  |         48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    299a:	|  |         48 89 d6             	mov    %rdx,%rsi
+    299d:	|  |         48 89 c7             	mov    %rax,%rdi
+    29a0:	|  |         e8 7f 04 00 00       	call   2e24 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)>
+    29a5:	|  |         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                if (p == nullptr) { return false; }
+    29a9:	|  |         48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    29ae:	|  |     /-- 75 07                	jne    29b7 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x141>
+    29b0:	|  |     |   b8 00 00 00 00       	mov    $0x0,%eax
+    29b5:	|  +-----|-- eb 10                	jmp    29c7 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc>, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    29b7:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    29bb:	|  |         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    29bf:	|  |         48 89 10             	mov    %rdx,(%rax)
+            return true;
+    29c2:	\--|-------> b8 01 00 00 00       	mov    $0x1,%eax
+        }
+    29c7:	   \-------> c9                   	leave
+    29c8:	             c3                   	ret
+    29c9:	             90                   	nop
+
+00000000000029ca <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::len() const>:
+        constexpr Length len(void) const
+    29ca:	55                   	push   %rbp
+    29cb:	48 89 e5             	mov    %rsp,%rbp
+    29ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    29d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29d6:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    29da:	5d                   	pop    %rbp
+    29db:	c3                   	ret
+
+00000000000029dc <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::capacity() const>:
+        constexpr Count capacity(void) const
+    29dc:	55                   	push   %rbp
+    29dd:	48 89 e5             	mov    %rsp,%rbp
+    29e0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return alloc_;
+    29e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29e8:	48 8b 00             	mov    (%rax),%rax
+        }
+    29eb:	5d                   	pop    %rbp
+    29ec:	c3                   	ret
+
+00000000000029ed <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>:
+
+    public:
+        // Smallest non-zero capacity grown to, saves the first few tiny reallocs.
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+    29ed:	          55                   	push   %rbp
+    29ee:	          48 89 e5             	mov    %rsp,%rbp
+    29f1:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    29f5:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            if (cap <= cur) { return cap; }
+    29f9:	          48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29fd:	          48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    2a01:	      /-- 72 06                	jb     2a09 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x1c>
+    2a03:	      |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a07:	/-----|-- eb 2e                	jmp    2a37 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x4a>
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    2a09:	|     \-> 48 83 7d e8 03       	cmpq   $0x3,-0x18(%rbp)
+    2a0e:	|  /----- 76 09                	jbe    2a19 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x2c>
+    2a10:	|  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a14:	|  |      48 01 c0             	add    %rax,%rax
+    2a17:	|  |  /-- eb 05                	jmp    2a1e <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x31>
+    2a19:	|  \--|-> b8 04 00 00 00       	mov    $0x4,%eax
+    2a1e:	|     \-> 48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return (cap < g) ? g : cap;
+    2a22:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a26:	|         48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    2a2a:	|  /----- 73 06                	jae    2a32 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x45>
+    2a2c:	|  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a30:	|  |  /-- eb 04                	jmp    2a36 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x49>
+    2a32:	|  \--|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a36:	|     \-> 90                   	nop
+        }
+    2a37:	\-------> 5d                   	pop    %rbp
+    2a38:	          c3                   	ret
+
+0000000000002a39 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::malloc(unsigned long)>:
+        static Node *malloc(Count capacity)
+    2a39:	    55                   	push   %rbp
+    2a3a:	    48 89 e5             	mov    %rsp,%rbp
+    2a3d:	    48 83 ec 20          	sub    $0x20,%rsp
+    2a41:	    48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            Node *new_n = realloc(nullptr, capacity);
+    2a45:	    48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a49:	    48 89 c6             	mov    %rax,%rsi
+    2a4c:	    bf 00 00 00 00       	mov    $0x0,%edi
+    2a51:	    e8 17 01 00 00       	call   2b6d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)>
+    2a56:	    48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    2a5a:	    48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2a5f:	/-- 74 0c                	je     2a6d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::malloc(unsigned long)+0x34>
+    2a61:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a65:	|   48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    2a6c:	|   00 
+            return new_n;
+    2a6d:	\-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2a71:	    c9                   	leave
+    2a72:	    c3                   	ret
+    2a73:	    90                   	nop
+
+0000000000002a74 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>:
+            return match<bool>([](T const &) -> bool { return false; },
+    2a74:	55                   	push   %rbp
+    2a75:	48 89 e5             	mov    %rsp,%rbp
+    2a78:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2a7c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2a80:	b8 00 00 00 00       	mov    $0x0,%eax
+    2a85:	5d                   	pop    %rbp
+    2a86:	c3                   	ret
+    2a87:	90                   	nop
+
+0000000000002a88 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>:
+                               [](E const &) -> bool { return true; },
+    2a88:	55                   	push   %rbp
+    2a89:	48 89 e5             	mov    %rsp,%rbp
+    2a8c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2a90:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2a94:	b8 01 00 00 00       	mov    $0x1,%eax
+    2a99:	5d                   	pop    %rbp
+    2a9a:	c3                   	ret
+    2a9b:	90                   	nop
+
+0000000000002a9c <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>:
+        constexpr bool is_err(Context const &ctx = Context()) const
+    2a9c:	55                   	push   %rbp
+    2a9d:	48 89 e5             	mov    %rsp,%rbp
+    2aa0:	48 83 ec 20          	sub    $0x20,%rsp
+    2aa4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2aa8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](T const &) -> bool { return false; },
+    2aac:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2ab0:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    2ab4:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    2ab8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2abc:	48 89 c7             	mov    %rax,%rdi
+    2abf:	e8 02 00 00 00       	call   2ac6 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>
+        }
+    2ac4:	c9                   	leave
+    2ac5:	c3                   	ret
+
+0000000000002ac6 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    2ac6:	             55                   	push   %rbp
+    2ac7:	             48 89 e5             	mov    %rsp,%rbp
+    2aca:	             48 83 ec 20          	sub    $0x20,%rsp
+    2ace:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2ad2:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2ad6:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2ada:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result-match
+    2ade:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ae2:	             8b 00                	mov    (%rax),%eax
+    2ae4:	             83 f8 02             	cmp    $0x2,%eax
+    2ae7:	         /-- 74 32                	je     2b1b <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x55>
+    2ae9:	         |   83 f8 02             	cmp    $0x2,%eax
+    2aec:	/--------|-- 7f 67                	jg     2b55 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+    2aee:	|        |   85 c0                	test   %eax,%eax
+    2af0:	|     /--|-- 74 4d                	je     2b3f <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x79>
+    2af2:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    2af5:	+-----|--|-- 75 5e                	jne    2b55 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_ok(*ok_);
+    2af7:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2afb:	|     |  |   48 83 c0 08          	add    $0x8,%rax
+    2aff:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    2b02:	|     |  |   e8 47 05 00 00       	call   304e <nel::Element<void*>::operator*() const>
+    2b07:	|     |  |   48 89 c2             	mov    %rax,%rdx
+    2b0a:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b0e:	|     |  |   48 89 d6             	mov    %rdx,%rsi
+    2b11:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    2b14:	|     |  |   e8 5b ff ff ff       	call   2a74 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>
+    2b19:	|  /--|--|-- eb 50                	jmp    2b6b <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    return on_err(*err_);
+    2b1b:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b1f:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    2b23:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2b26:	|  |  |      e8 3d 05 00 00       	call   3068 <nel::Element<nel::heaped::AllocError>::operator*() const>
+    2b2b:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    2b2e:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b32:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    2b35:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2b38:	|  |  |      e8 4b ff ff ff       	call   2a88 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>
+    2b3d:	|  +--|----- eb 2c                	jmp    2b6b <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    nel::panic("invalid Result", ctx);
+    2b3f:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2b43:	|  |         48 89 c6             	mov    %rax,%rsi
+    2b46:	|  |         48 8d 05 bd 15 00 00 	lea    0x15bd(%rip),%rax        # 410a <n_moves+0xd2>
+    2b4d:	|  |         48 89 c7             	mov    %rax,%rdi
+    2b50:	|  |         e8 e8 08 00 00       	call   343d <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    2b55:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2b59:	   |         48 89 c6             	mov    %rax,%rsi
+    2b5c:	   |         48 8d 05 78 15 00 00 	lea    0x1578(%rip),%rax        # 40db <n_moves+0xa3>
+    2b63:	   |         48 89 c7             	mov    %rax,%rdi
+    2b66:	   |         e8 d2 08 00 00       	call   343d <nel::panic(char const*, nel::Context const&)>
+        }
+    2b6b:	   \-------> c9                   	leave
+    2b6c:	             c3                   	ret
+
+0000000000002b6d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)>:
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    2b6d:	          55                   	push   %rbp
+    2b6e:	          48 89 e5             	mov    %rsp,%rbp
+    2b71:	          41 54                	push   %r12
+    2b73:	          53                   	push   %rbx
+    2b74:	          48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+    2b7b:	          48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+    2b82:	          48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+            if (new_cap > max_capacity) { return nullptr; }
+    2b89:	          48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    2b90:	          ff 7f 00 
+    2b93:	          48 3b 85 60 ff ff ff 	cmp    -0xa0(%rbp),%rax
+    2b9a:	      /-- 73 0a                	jae    2ba6 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)+0x39>
+    2b9c:	      |   bb 00 00 00 00       	mov    $0x0,%ebx
+    2ba1:	/-----|-- e9 d8 01 00 00       	jmp    2d7e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)+0x211>
+            Length const new_sz = size_of(new_cap);
+    2ba6:	|     \-> 48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+    2bad:	|         48 89 c7             	mov    %rax,%rdi
+    2bb0:	|         e8 9f f4 ff ff       	call   2054 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::size_of(unsigned long)>
+    2bb5:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            Length const old_sz = (old_n == nullptr) ? 0 : size_of(old_n->alloc_);
+    2bb9:	|         48 83 bd 68 ff ff ff 	cmpq   $0x0,-0x98(%rbp)
+    2bc0:	|         00 
+    2bc1:	|  /----- 74 14                	je     2bd7 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)+0x6a>
+    2bc3:	|  |      48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2bca:	|  |      48 8b 00             	mov    (%rax),%rax
+    2bcd:	|  |      48 89 c7             	mov    %rax,%rdi
+    2bd0:	|  |      e8 7f f4 ff ff       	call   2054 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::size_of(unsigned long)>
+    2bd5:	|  |  /-- eb 05                	jmp    2bdc <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)+0x6f>
+    2bd7:	|  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    2bdc:	|     \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+                auto r = Allocator::try_malloc(alignof(Node), new_sz);
+    2be0:	|         48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    2be7:	|         48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2beb:	|         be 08 00 00 00       	mov    $0x8,%esi
+    2bf0:	|         48 89 c7             	mov    %rax,%rdi
+    2bf3:	|         e8 24 04 00 00       	call   301c <nel::heaped::Poisoned<true, nel::heaped::Malloc>::try_malloc(unsigned long, unsigned long)>
+                if (r.is_err()) { return nullptr; }
+    2bf8:	|         48 8d 45 80          	lea    -0x80(%rbp),%rax
+    2bfc:	|         b9 8e 00 00 00       	mov    $0x8e,%ecx
+    2c01:	|         48 8d 15 11 15 00 00 	lea    0x1511(%rip),%rdx        # 4119 <n_moves+0xe1>
+    2c08:	|         48 8d 35 21 15 00 00 	lea    0x1521(%rip),%rsi        # 4130 <n_moves+0xf8>
+    2c0f:	|         48 89 c7             	mov    %rax,%rdi
+    2c12:	|         e8 f1 ea ff ff       	call   1708 <nel::Context::Context(char const*, char const*, int)>
+    2c17:	|         48 8d 55 80          	lea    -0x80(%rbp),%rdx
+    2c1b:	|         48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    2c22:	|         48 89 d6             	mov    %rdx,%rsi
+    2c25:	|         48 89 c7             	mov    %rax,%rdi
+    2c28:	|         e8 6f fe ff ff       	call   2a9c <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>
+    2c2d:	|         84 c0                	test   %al,%al
+    2c2f:	|     /-- 74 10                	je     2c41 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)+0xd4>
+    2c31:	|     |   bb 00 00 00 00       	mov    $0x0,%ebx
+    2c36:	|     |   41 bc 00 00 00 00    	mov    $0x0,%r12d
+    2c3c:	|  /--|-- e9 ed 00 00 00       	jmp    2d2e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)+0x1c1>
+                new_n = reinterpret_cast<Node *>(r.unwrap());
+    2c41:	|  |  \-> 48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    2c45:	|  |      b9 8f 00 00 00       	mov    $0x8f,%ecx
+    2c4a:	|  |      48 8d 15 c8 14 00 00 	lea    0x14c8(%rip),%rdx        # 4119 <n_moves+0xe1>
+    2c51:	|  |      48 8d 35 d8 14 00 00 	lea    0x14d8(%rip),%rsi        # 4130 <n_moves+0xf8>
+    2c58:	|  |      48 89 c7             	mov    %rax,%rdi
+    2c5b:	|  |      e8 a8 ea ff ff       	call   1708 <nel::Context::Context(char const*, char const*, int)>
+    2c60:	|  |      48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    2c64:	|  |      48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    2c6b:	|  |      48 89 d6             	mov    %rdx,%rsi
+    2c6e:	|  |      48 89 c7             	mov    %rax,%rdi
+    2c71:	|  |      e8 58 04 00 00       	call   30ce <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+    2c76:	|  |      48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                if (old_n != nullptr) {
+    2c7a:	|  |      48 83 bd 68 ff ff ff 	cmpq   $0x0,-0x98(%rbp)
+    2c81:	|  |      00 
+    2c82:	|  |  /-- 0f 84 a0 00 00 00    	je     2d28 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)+0x1bb>
+                    nel::assert(old_n->len_ <= new_cap, "heaped::Node: shrinking below len");
+    2c88:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2c8c:	|  |  |   b9 91 00 00 00       	mov    $0x91,%ecx
+    2c91:	|  |  |   48 8d 15 81 14 00 00 	lea    0x1481(%rip),%rdx        # 4119 <n_moves+0xe1>
+    2c98:	|  |  |   48 8d 35 91 14 00 00 	lea    0x1491(%rip),%rsi        # 4130 <n_moves+0xf8>
+    2c9f:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2ca2:	|  |  |   e8 61 ea ff ff       	call   1708 <nel::Context::Context(char const*, char const*, int)>
+    2ca7:	|  |  |   48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2cae:	|  |  |   48 8b 40 08          	mov    0x8(%rax),%rax
+    2cb2:	|  |  |   48 39 85 60 ff ff ff 	cmp    %rax,-0xa0(%rbp)
+    2cb9:	|  |  |   0f 93 c0             	setae  %al
+    2cbc:	|  |  |   0f b6 c0             	movzbl %al,%eax
+    2cbf:	|  |  |   48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    2cc3:	|  |  |   48 8d 0d 6e 14 00 00 	lea    0x146e(%rip),%rcx        # 4138 <n_moves+0x100>
+    2cca:	|  |  |   48 89 ce             	mov    %rcx,%rsi
+    2ccd:	|  |  |   89 c7                	mov    %eax,%edi
+    2ccf:	|  |  |   e8 6b ea ff ff       	call   173f <nel::assert(bool, char const*, nel::Context const&)>
+                    new_n->len_ = old_n->len_;
+    2cd4:	|  |  |   48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2cdb:	|  |  |   48 8b 50 08          	mov    0x8(%rax),%rdx
+    2cdf:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ce3:	|  |  |   48 89 50 08          	mov    %rdx,0x8(%rax)
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    2ce7:	|  |  |   48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2cee:	|  |  |   48 8b 40 08          	mov    0x8(%rax),%rax
+    2cf2:	|  |  |   48 8b 95 68 ff ff ff 	mov    -0x98(%rbp),%rdx
+    2cf9:	|  |  |   48 8d 72 10          	lea    0x10(%rdx),%rsi
+    2cfd:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2d01:	|  |  |   48 8d 4a 10          	lea    0x10(%rdx),%rcx
+    2d05:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    2d08:	|  |  |   48 89 cf             	mov    %rcx,%rdi
+    2d0b:	|  |  |   e8 f0 03 00 00       	call   3100 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)>
+                    Allocator::free(old_n, alignof(Node), old_sz);
+    2d10:	|  |  |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2d14:	|  |  |   48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2d1b:	|  |  |   be 08 00 00 00       	mov    $0x8,%esi
+    2d20:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2d23:	|  |  |   e8 c1 f7 ff ff       	call   24e9 <nel::heaped::Poisoned<true, nel::heaped::Malloc>::free(void*, unsigned long, unsigned long)>
+            }
+    2d28:	|  |  \-> 41 bc 01 00 00 00    	mov    $0x1,%r12d
+    2d2e:	|  \----> 48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    2d35:	|         48 89 c7             	mov    %rax,%rdi
+    2d38:	|         e8 95 eb ff ff       	call   18d2 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+    2d3d:	|         41 83 fc 01          	cmp    $0x1,%r12d
+    2d41:	+-------- 75 3b                	jne    2d7e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)+0x211>
+    2d43:	|         90                   	nop
+                if (new_sz > old_sz) {
+    2d44:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2d48:	|         48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    2d4c:	|     /-- 73 1e                	jae    2d6c <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)+0x1ff>
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+    2d4e:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2d52:	|     |   48 2b 45 d8          	sub    -0x28(%rbp),%rax
+    2d56:	|     |   48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    2d5a:	|     |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2d5e:	|     |   48 01 ca             	add    %rcx,%rdx
+    2d61:	|     |   48 89 c6             	mov    %rax,%rsi
+    2d64:	|     |   48 89 d7             	mov    %rdx,%rdi
+    2d67:	|     |   e8 52 08 00 00       	call   35be <nel::elem::wipe(unsigned char*, unsigned long)>
+            new_n->alloc_ = new_cap;
+    2d6c:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d70:	|         48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+    2d77:	|         48 89 10             	mov    %rdx,(%rax)
+            return new_n;
+    2d7a:	|         48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+        }
+    2d7e:	\-------> 48 89 d8             	mov    %rbx,%rax
+    2d81:	          48 81 c4 90 00 00 00 	add    $0x90,%rsp
+    2d88:	          5b                   	pop    %rbx
+    2d89:	          41 5c                	pop    %r12
+    2d8b:	          5d                   	pop    %rbp
+    2d8c:	          c3                   	ret
+    2d8d:	          90                   	nop
+
+0000000000002d8e <nel::Element<U8Buf<256ul> >::Element<unsigned char>(unsigned char&&)>:
+        constexpr Element(Args &&...args)
+    2d8e:	55                   	push   %rbp
+    2d8f:	48 89 e5             	mov    %rsp,%rbp
+    2d92:	53                   	push   %rbx
+    2d93:	48 83 ec 18          	sub    $0x18,%rsp
+    2d97:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2d9b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : value_(forward<Args>(args)...)
+    2d9f:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    2da3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2da7:	48 89 c7             	mov    %rax,%rdi
+    2daa:	e8 72 f3 ff ff       	call   2121 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    2daf:	0f b6 00             	movzbl (%rax),%eax
+    2db2:	0f b6 c0             	movzbl %al,%eax
+    2db5:	89 c6                	mov    %eax,%esi
+    2db7:	48 89 df             	mov    %rbx,%rdi
+    2dba:	e8 73 f9 ff ff       	call   2732 <U8Buf<256ul>::U8Buf(unsigned char)>
+        }
+    2dbf:	90                   	nop
+    2dc0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2dc4:	c9                   	leave
+    2dc5:	c3                   	ret
+
+0000000000002dc6 <nel::Result<void, U8Buf<256ul> >::Result(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)1>)>:
+        constexpr Result(Phantom<Tag::OK> const)
+    2dc6:	55                   	push   %rbp
+    2dc7:	48 89 e5             	mov    %rsp,%rbp
+    2dca:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : tag_(Tag::OK)
+    2dce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2dd2:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+        }
+    2dd8:	90                   	nop
+    2dd9:	5d                   	pop    %rbp
+    2dda:	c3                   	ret
+    2ddb:	90                   	nop
+
+0000000000002ddc <nel::Element<U8Buf<256ul> >::ref() const>:
+        constexpr Type const &ref(void) const
+    2ddc:	55                   	push   %rbp
+    2ddd:	48 89 e5             	mov    %rsp,%rbp
+    2de0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2de4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2de8:	5d                   	pop    %rbp
+    2de9:	c3                   	ret
+
+0000000000002dea <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::malloc(unsigned long)>:
+        static Node *malloc(Count capacity)
+    2dea:	    55                   	push   %rbp
+    2deb:	    48 89 e5             	mov    %rsp,%rbp
+    2dee:	    48 83 ec 20          	sub    $0x20,%rsp
+    2df2:	    48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            Node *new_n = realloc(nullptr, capacity);
+    2df6:	    48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2dfa:	    48 89 c6             	mov    %rax,%rsi
+    2dfd:	    bf 00 00 00 00       	mov    $0x0,%edi
+    2e02:	    e8 1d 00 00 00       	call   2e24 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)>
+    2e07:	    48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    2e0b:	    48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2e10:	/-- 74 0c                	je     2e1e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::malloc(unsigned long)+0x34>
+    2e12:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e16:	|   48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    2e1d:	|   00 
+            return new_n;
+    2e1e:	\-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2e22:	    c9                   	leave
+    2e23:	    c3                   	ret
+
+0000000000002e24 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)>:
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    2e24:	          55                   	push   %rbp
+    2e25:	          48 89 e5             	mov    %rsp,%rbp
+    2e28:	          41 54                	push   %r12
+    2e2a:	          53                   	push   %rbx
+    2e2b:	          48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+    2e32:	          48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+    2e39:	          48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+            if (new_cap > max_capacity) { return nullptr; }
+    2e40:	          48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    2e47:	          ff 7f 00 
+    2e4a:	          48 3b 85 60 ff ff ff 	cmp    -0xa0(%rbp),%rax
+    2e51:	      /-- 73 0a                	jae    2e5d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)+0x39>
+    2e53:	      |   bb 00 00 00 00       	mov    $0x0,%ebx
+    2e58:	/-----|-- e9 b0 01 00 00       	jmp    300d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)+0x1e9>
+            Length const new_sz = size_of(new_cap);
+    2e5d:	|     \-> 48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+    2e64:	|         48 89 c7             	mov    %rax,%rdi
+    2e67:	|         e8 92 f4 ff ff       	call   22fe <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::size_of(unsigned long)>
+    2e6c:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            Length const old_sz = (old_n == nullptr) ? 0 : size_of(old_n->alloc_);
+    2e70:	|         48 83 bd 68 ff ff ff 	cmpq   $0x0,-0x98(%rbp)
+    2e77:	|         00 
+    2e78:	|  /----- 74 14                	je     2e8e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)+0x6a>
+    2e7a:	|  |      48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2e81:	|  |      48 8b 00             	mov    (%rax),%rax
+    2e84:	|  |      48 89 c7             	mov    %rax,%rdi
+    2e87:	|  |      e8 72 f4 ff ff       	call   22fe <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::size_of(unsigned long)>
+    2e8c:	|  |  /-- eb 05                	jmp    2e93 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)+0x6f>
+    2e8e:	|  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    2e93:	|     \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+                auto r = Allocator::try_malloc(alignof(Node), new_sz);
+    2e97:	|         48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    2e9e:	|         48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2ea2:	|         be 08 00 00 00       	mov    $0x8,%esi
+    2ea7:	|         48 89 c7             	mov    %rax,%rdi
+    2eaa:	|         e8 89 03 00 00       	call   3238 <nel::heaped::Poisoned<false, nel::heaped::Malloc>::try_malloc(unsigned long, unsigned long)>
+                if (r.is_err()) { return nullptr; }
+    2eaf:	|         48 8d 45 80          	lea    -0x80(%rbp),%rax
+    2eb3:	|         b9 8e 00 00 00       	mov    $0x8e,%ecx
+    2eb8:	|         48 8d 15 5a 12 00 00 	lea    0x125a(%rip),%rdx        # 4119 <n_moves+0xe1>
+    2ebf:	|         48 8d 35 6a 12 00 00 	lea    0x126a(%rip),%rsi        # 4130 <n_moves+0xf8>
+    2ec6:	|         48 89 c7             	mov    %rax,%rdi
+    2ec9:	|         e8 3a e8 ff ff       	call   1708 <nel::Context::Context(char const*, char const*, int)>
+    2ece:	|         48 8d 55 80          	lea    -0x80(%rbp),%rdx
+    2ed2:	|         48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    2ed9:	|         48 89 d6             	mov    %rdx,%rsi
+    2edc:	|         48 89 c7             	mov    %rax,%rdi
+    2edf:	|         e8 b8 fb ff ff       	call   2a9c <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>
+    2ee4:	|         84 c0                	test   %al,%al
+    2ee6:	|     /-- 74 10                	je     2ef8 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)+0xd4>
+    2ee8:	|     |   bb 00 00 00 00       	mov    $0x0,%ebx
+    2eed:	|     |   41 bc 00 00 00 00    	mov    $0x0,%r12d
+    2ef3:	|  /--|-- e9 ed 00 00 00       	jmp    2fe5 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)+0x1c1>
+                new_n = reinterpret_cast<Node *>(r.unwrap());
+    2ef8:	|  |  \-> 48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    2efc:	|  |      b9 8f 00 00 00       	mov    $0x8f,%ecx
+    2f01:	|  |      48 8d 15 11 12 00 00 	lea    0x1211(%rip),%rdx        # 4119 <n_moves+0xe1>
+    2f08:	|  |      48 8d 35 21 12 00 00 	lea    0x1221(%rip),%rsi        # 4130 <n_moves+0xf8>
+    2f0f:	|  |      48 89 c7             	mov    %rax,%rdi
+    2f12:	|  |      e8 f1 e7 ff ff       	call   1708 <nel::Context::Context(char const*, char const*, int)>
+    2f17:	|  |      48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    2f1b:	|  |      48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    2f22:	|  |      48 89 d6             	mov    %rdx,%rsi
+    2f25:	|  |      48 89 c7             	mov    %rax,%rdi
+    2f28:	|  |      e8 a1 01 00 00       	call   30ce <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+    2f2d:	|  |      48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                if (old_n != nullptr) {
+    2f31:	|  |      48 83 bd 68 ff ff ff 	cmpq   $0x0,-0x98(%rbp)
+    2f38:	|  |      00 
+    2f39:	|  |  /-- 0f 84 a0 00 00 00    	je     2fdf <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)+0x1bb>
+                    nel::assert(old_n->len_ <= new_cap, "heaped::Node: shrinking below len");
+    2f3f:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2f43:	|  |  |   b9 91 00 00 00       	mov    $0x91,%ecx
+    2f48:	|  |  |   48 8d 15 ca 11 00 00 	lea    0x11ca(%rip),%rdx        # 4119 <n_moves+0xe1>
+    2f4f:	|  |  |   48 8d 35 da 11 00 00 	lea    0x11da(%rip),%rsi        # 4130 <n_moves+0xf8>
+    2f56:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2f59:	|  |  |   e8 aa e7 ff ff       	call   1708 <nel::Context::Context(char const*, char const*, int)>
+    2f5e:	|  |  |   48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2f65:	|  |  |   48 8b 40 08          	mov    0x8(%rax),%rax
+    2f69:	|  |  |   48 39 85 60 ff ff ff 	cmp    %rax,-0xa0(%rbp)
+    2f70:	|  |  |   0f 93 c0             	setae  %al
+    2f73:	|  |  |   0f b6 c0             	movzbl %al,%eax
+    2f76:	|  |  |   48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    2f7a:	|  |  |   48 8d 0d b7 11 00 00 	lea    0x11b7(%rip),%rcx        # 4138 <n_moves+0x100>
+    2f81:	|  |  |   48 89 ce             	mov    %rcx,%rsi
+    2f84:	|  |  |   89 c7                	mov    %eax,%edi
+    2f86:	|  |  |   e8 b4 e7 ff ff       	call   173f <nel::assert(bool, char const*, nel::Context const&)>
+                    new_n->len_ = old_n->len_;
+    2f8b:	|  |  |   48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2f92:	|  |  |   48 8b 50 08          	mov    0x8(%rax),%rdx
+    2f96:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f9a:	|  |  |   48 89 50 08          	mov    %rdx,0x8(%rax)
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    2f9e:	|  |  |   48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2fa5:	|  |  |   48 8b 40 08          	mov    0x8(%rax),%rax
+    2fa9:	|  |  |   48 8b 95 68 ff ff ff 	mov    -0x98(%rbp),%rdx
+    2fb0:	|  |  |   48 8d 72 10          	lea    0x10(%rdx),%rsi
+    2fb4:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2fb8:	|  |  |   48 8d 4a 10          	lea    0x10(%rdx),%rcx
+    2fbc:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    2fbf:	|  |  |   48 89 cf             	mov    %rcx,%rdi
+    2fc2:	|  |  |   e8 39 01 00 00       	call   3100 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)>
+                    Allocator::free(old_n, alignof(Node), old_sz);
+    2fc7:	|  |  |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2fcb:	|  |  |   48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2fd2:	|  |  |   be 08 00 00 00       	mov    $0x8,%esi
+    2fd7:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2fda:	|  |  |   e8 08 f8 ff ff       	call   27e7 <nel::heaped::Poisoned<false, nel::heaped::Malloc>::free(void*, unsigned long, unsigned long)>
+            }
+    2fdf:	|  |  \-> 41 bc 01 00 00 00    	mov    $0x1,%r12d
+    2fe5:	|  \----> 48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    2fec:	|         48 89 c7             	mov    %rax,%rdi
+    2fef:	|         e8 de e8 ff ff       	call   18d2 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+    2ff4:	|         41 83 fc 01          	cmp    $0x1,%r12d
+    2ff8:	+-------- 75 13                	jne    300d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)+0x1e9>
+    2ffa:	|         90                   	nop
+            new_n->alloc_ = new_cap;
+    2ffb:	|         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2fff:	|         48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+    3006:	|         48 89 10             	mov    %rdx,(%rax)
+            return new_n;
+    3009:	|         48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+        }
+    300d:	\-------> 48 89 d8             	mov    %rbx,%rax
+    3010:	          48 81 c4 90 00 00 00 	add    $0x90,%rsp
+    3017:	          5b                   	pop    %rbx
+    3018:	          41 5c                	pop    %r12
+    301a:	          5d                   	pop    %rbp
+    301b:	          c3                   	ret
+
+000000000000301c <nel::heaped::Poisoned<true, nel::heaped::Malloc>::try_malloc(unsigned long, unsigned long)>:
+        static Result<void *, AllocError> try_malloc(Length const align, Length const size)
+    301c:	55                   	push   %rbp
+    301d:	48 89 e5             	mov    %rsp,%rbp
+    3020:	48 83 ec 20          	sub    $0x20,%rsp
+    3024:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3028:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    302c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            return Upstream::try_malloc(align, size);
+    3030:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3034:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3038:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    303c:	48 89 ce             	mov    %rcx,%rsi
+    303f:	48 89 c7             	mov    %rax,%rdi
+    3042:	e8 2e e7 ff ff       	call   1775 <nel::heaped::Malloc::try_malloc(unsigned long, unsigned long)>
+        }
+    3047:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    304b:	c9                   	leave
+    304c:	c3                   	ret
+    304d:	90                   	nop
+
+000000000000304e <nel::Element<void*>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    304e:	55                   	push   %rbp
+    304f:	48 89 e5             	mov    %rsp,%rbp
+    3052:	48 83 ec 10          	sub    $0x10,%rsp
+    3056:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    305a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    305e:	48 89 c7             	mov    %rax,%rdi
+    3061:	e8 04 02 00 00       	call   326a <nel::Element<void*>::ref() const>
+        }
+    3066:	c9                   	leave
+    3067:	c3                   	ret
+
+0000000000003068 <nel::Element<nel::heaped::AllocError>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    3068:	55                   	push   %rbp
+    3069:	48 89 e5             	mov    %rsp,%rbp
+    306c:	48 83 ec 10          	sub    $0x10,%rsp
+    3070:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    3074:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3078:	48 89 c7             	mov    %rax,%rdi
+    307b:	e8 f8 01 00 00       	call   3278 <nel::Element<nel::heaped::AllocError>::ref() const>
+        }
+    3080:	c9                   	leave
+    3081:	c3                   	ret
+
+0000000000003082 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>:
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    3082:	55                   	push   %rbp
+    3083:	48 89 e5             	mov    %rsp,%rbp
+    3086:	48 83 ec 10          	sub    $0x10,%rsp
+    308a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    308e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3092:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3096:	48 89 c7             	mov    %rax,%rdi
+    3099:	e8 e8 01 00 00       	call   3286 <void*&& nel::forward<void*, void*>(void*&)>
+    309e:	48 8b 00             	mov    (%rax),%rax
+    30a1:	c9                   	leave
+    30a2:	c3                   	ret
+    30a3:	90                   	nop
+
+00000000000030a4 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>:
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    30a4:	55                   	push   %rbp
+    30a5:	48 89 e5             	mov    %rsp,%rbp
+    30a8:	48 83 ec 10          	sub    $0x10,%rsp
+    30ac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    30b0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    30b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30b8:	48 8b 00             	mov    (%rax),%rax
+    30bb:	48 89 c6             	mov    %rax,%rsi
+    30be:	48 8d 05 95 10 00 00 	lea    0x1095(%rip),%rax        # 415a <n_moves+0x122>
+    30c5:	48 89 c7             	mov    %rax,%rdi
+    30c8:	e8 70 03 00 00       	call   343d <nel::panic(char const*, nel::Context const&)>
+    30cd:	90                   	nop
+
+00000000000030ce <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>:
+        constexpr T unwrap(Context const &ctx = Context())
+    30ce:	55                   	push   %rbp
+    30cf:	48 89 e5             	mov    %rsp,%rbp
+    30d2:	48 83 ec 20          	sub    $0x20,%rsp
+    30d6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    30da:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    30de:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    30e2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    30e6:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    30ea:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    30ee:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    30f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    30f6:	48 89 c7             	mov    %rax,%rdi
+    30f9:	e8 96 01 00 00       	call   3294 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>
+        }
+    30fe:	c9                   	leave
+    30ff:	c3                   	ret
+
+0000000000003100 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)>:
+ * @warning UB if [s, s+n) is not initialised.
+ */
+void relocate(uint8_t *const d, uint8_t *const s, Length const n);
+
+template<typename T>
+void relocate(T d[], T s[], Length const n)
+    3100:	                55                   	push   %rbp
+    3101:	                48 89 e5             	mov    %rsp,%rbp
+    3104:	                53                   	push   %rbx
+    3105:	                48 83 ec 38          	sub    $0x38,%rsp
+    3109:	                48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    310d:	                48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    3111:	                48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+{
+    if (d == s) { return; }
+    3115:	                48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3119:	                48 3b 45 d0          	cmp    -0x30(%rbp),%rax
+    311d:	/-------------- 0f 84 0e 01 00 00    	je     3231 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x131>
+    if constexpr (is_trivially_relocatable<T>) {
+        relocate(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t *>(s), n * sizeof(T));
+    } else if (d < s) {
+    3123:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3127:	|               48 3b 45 d0          	cmp    -0x30(%rbp),%rax
+    312b:	|     /-------- 73 7f                	jae    31ac <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0xac>
+        // forwards, so overlap is not overwritten before it is read.
+        for (Index i = 0; i < n; ++i) {
+    312d:	|     |         48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+    3134:	|     |         00 
+    3135:	|     |     /-- eb 66                	jmp    319d <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x9d>
+            new (&d[i]) T(nel::move(s[i]));
+    3137:	|     |  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    313b:	|     |  |  |   48 c1 e0 08          	shl    $0x8,%rax
+    313f:	|     |  |  |   48 89 c2             	mov    %rax,%rdx
+    3142:	|     |  |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3146:	|     |  |  |   48 01 d0             	add    %rdx,%rax
+    3149:	|     |  |  |   48 89 c6             	mov    %rax,%rsi
+    314c:	|     |  |  |   bf 00 01 00 00       	mov    $0x100,%edi
+    3151:	|     |  |  |   e8 a0 e5 ff ff       	call   16f6 <operator new(unsigned long, void*)>
+    3156:	|     |  |  |   48 89 c3             	mov    %rax,%rbx
+    3159:	|     |  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    315d:	|     |  |  |   48 c1 e0 08          	shl    $0x8,%rax
+    3161:	|     |  |  |   48 89 c2             	mov    %rax,%rdx
+    3164:	|     |  |  |   48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3168:	|     |  |  |   48 01 d0             	add    %rdx,%rax
+    316b:	|     |  |  |   48 89 c7             	mov    %rax,%rdi
+    316e:	|     |  |  |   e8 ea 01 00 00       	call   335d <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    3173:	|     |  |  |   48 89 c6             	mov    %rax,%rsi
+    3176:	|     |  |  |   48 89 df             	mov    %rbx,%rdi
+    3179:	|     |  |  |   e8 ee 01 00 00       	call   336c <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>
+            s[i].~T();
+    317e:	|     |  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3182:	|     |  |  |   48 c1 e0 08          	shl    $0x8,%rax
+    3186:	|     |  |  |   48 89 c2             	mov    %rax,%rdx
+    3189:	|     |  |  |   48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    318d:	|     |  |  |   48 01 d0             	add    %rdx,%rax
+    3190:	|     |  |  |   48 89 c7             	mov    %rax,%rdi
+    3193:	|     |  |  |   e8 98 f0 ff ff       	call   2230 <U8Buf<256ul>::~U8Buf()>
+        for (Index i = 0; i < n; ++i) {
+    3198:	|     |  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    319d:	|     |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31a1:	|     |  |      48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+    31a5:	|     |  \----- 72 90                	jb     3137 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x37>
+    31a7:	|  /--|-------- e9 86 00 00 00       	jmp    3232 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x132>
+        }
+    } else {
+        // backwards, so overlap is not overwritten before it is read.
+        for (Index i = n; i > 0; --i) {
+    31ac:	|  |  \-------> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    31b0:	|  |            48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    31b4:	|  |        /-- eb 72                	jmp    3228 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x128>
+            new (&d[i - 1]) T(nel::move(s[i - 1]));
+    31b6:	|  |     /--|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    31ba:	|  |     |  |   48 c1 e0 08          	shl    $0x8,%rax
+    31be:	|  |     |  |   48 8d 90 00 ff ff ff 	lea    -0x100(%rax),%rdx
+    31c5:	|  |     |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    31c9:	|  |     |  |   48 01 d0             	add    %rdx,%rax
+    31cc:	|  |     |  |   48 89 c6             	mov    %rax,%rsi
+    31cf:	|  |     |  |   bf 00 01 00 00       	mov    $0x100,%edi
+    31d4:	|  |     |  |   e8 1d e5 ff ff       	call   16f6 <operator new(unsigned long, void*)>
+    31d9:	|  |     |  |   48 89 c3             	mov    %rax,%rbx
+    31dc:	|  |     |  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    31e0:	|  |     |  |   48 c1 e0 08          	shl    $0x8,%rax
+    31e4:	|  |     |  |   48 8d 90 00 ff ff ff 	lea    -0x100(%rax),%rdx
+    31eb:	|  |     |  |   48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    31ef:	|  |     |  |   48 01 d0             	add    %rdx,%rax
+    31f2:	|  |     |  |   48 89 c7             	mov    %rax,%rdi
+    31f5:	|  |     |  |   e8 63 01 00 00       	call   335d <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    31fa:	|  |     |  |   48 89 c6             	mov    %rax,%rsi
+    31fd:	|  |     |  |   48 89 df             	mov    %rbx,%rdi
+    3200:	|  |     |  |   e8 67 01 00 00       	call   336c <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>
+            s[i - 1].~T();
+    3205:	|  |     |  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3209:	|  |     |  |   48 c1 e0 08          	shl    $0x8,%rax
+    320d:	|  |     |  |   48 8d 90 00 ff ff ff 	lea    -0x100(%rax),%rdx
+    3214:	|  |     |  |   48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3218:	|  |     |  |   48 01 d0             	add    %rdx,%rax
+    321b:	|  |     |  |   48 89 c7             	mov    %rax,%rdi
+    321e:	|  |     |  |   e8 0d f0 ff ff       	call   2230 <U8Buf<256ul>::~U8Buf()>
+        for (Index i = n; i > 0; --i) {
+    3223:	|  |     |  |   48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+    3228:	|  |     |  \-> 48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    322d:	|  |     \----- 75 87                	jne    31b6 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0xb6>
+    322f:	|  +----------- eb 01                	jmp    3232 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x132>
+    if (d == s) { return; }
+    3231:	\--|----------> 90                   	nop
+        }
+    }
+}
+    3232:	   \----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3236:	                c9                   	leave
+    3237:	                c3                   	ret
+
+0000000000003238 <nel::heaped::Poisoned<false, nel::heaped::Malloc>::try_malloc(unsigned long, unsigned long)>:
+        static Result<void *, AllocError> try_malloc(Length const align, Length const size)
+    3238:	55                   	push   %rbp
+    3239:	48 89 e5             	mov    %rsp,%rbp
+    323c:	48 83 ec 20          	sub    $0x20,%rsp
+    3240:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3244:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3248:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            return Upstream::try_malloc(align, size);
+    324c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3250:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3254:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3258:	48 89 ce             	mov    %rcx,%rsi
+    325b:	48 89 c7             	mov    %rax,%rdi
+    325e:	e8 12 e5 ff ff       	call   1775 <nel::heaped::Malloc::try_malloc(unsigned long, unsigned long)>
+        }
+    3263:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3267:	c9                   	leave
+    3268:	c3                   	ret
+    3269:	90                   	nop
+
+000000000000326a <nel::Element<void*>::ref() const>:
+        constexpr Type const &ref(void) const
+    326a:	55                   	push   %rbp
+    326b:	48 89 e5             	mov    %rsp,%rbp
+    326e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    3272:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    3276:	5d                   	pop    %rbp
+    3277:	c3                   	ret
+
+0000000000003278 <nel::Element<nel::heaped::AllocError>::ref() const>:
+        constexpr Type const &ref(void) const
+    3278:	55                   	push   %rbp
+    3279:	48 89 e5             	mov    %rsp,%rbp
+    327c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    3280:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    3284:	5d                   	pop    %rbp
+    3285:	c3                   	ret
+
+0000000000003286 <void*&& nel::forward<void*, void*>(void*&)>:
+constexpr U &&forward(T &t)
+    3286:	55                   	push   %rbp
+    3287:	48 89 e5             	mov    %rsp,%rbp
+    328a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    328e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3292:	5d                   	pop    %rbp
+    3293:	c3                   	ret
+
+0000000000003294 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    3294:	             55                   	push   %rbp
+    3295:	             48 89 e5             	mov    %rsp,%rbp
+    3298:	             48 83 ec 30          	sub    $0x30,%rsp
+    329c:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    32a0:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    32a4:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    32a8:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    32ac:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    32b0:	             8b 00                	mov    (%rax),%eax
+    32b2:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    32b5:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    32b9:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    32bf:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    32c3:	         /-- 74 3e                	je     3303 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x6f>
+    32c5:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    32c9:	/--------|-- 7f 7a                	jg     3345 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+    32cb:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    32cf:	|  /-----|-- 74 5e                	je     332f <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x9b>
+    32d1:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    32d5:	+--|-----|-- 75 6e                	jne    3345 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+                    return on_ok(forward<T>(*ok_));
+    32d7:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    32db:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    32df:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    32e2:	|  |     |   e8 b1 00 00 00       	call   3398 <nel::Element<void*>::operator*()>
+    32e7:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    32ea:	|  |     |   e8 97 ff ff ff       	call   3286 <void*&& nel::forward<void*, void*>(void*&)>
+    32ef:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    32f2:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    32f6:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    32f9:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    32fc:	|  |     |   e8 81 fd ff ff       	call   3082 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>
+    3301:	|  |  /--|-- eb 58                	jmp    335b <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    return on_err(forward<E>(*err_));
+    3303:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3307:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    330b:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    330e:	|  |  |      e8 9f 00 00 00       	call   33b2 <nel::Element<nel::heaped::AllocError>::operator*()>
+    3313:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3316:	|  |  |      e8 24 e9 ff ff       	call   1c3f <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    331b:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    331e:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3322:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    3325:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3328:	|  |  |      e8 77 fd ff ff       	call   30a4 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>
+    332d:	|  |  +----- eb 2c                	jmp    335b <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    nel::panic("invalid Result", ctx);
+    332f:	|  \--|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3333:	|     |      48 89 c6             	mov    %rax,%rsi
+    3336:	|     |      48 8d 05 cd 0d 00 00 	lea    0xdcd(%rip),%rax        # 410a <n_moves+0xd2>
+    333d:	|     |      48 89 c7             	mov    %rax,%rdi
+    3340:	|     |      e8 f8 00 00 00       	call   343d <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    3345:	\-----|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3349:	      |      48 89 c6             	mov    %rax,%rsi
+    334c:	      |      48 8d 05 88 0d 00 00 	lea    0xd88(%rip),%rax        # 40db <n_moves+0xa3>
+    3353:	      |      48 89 c7             	mov    %rax,%rdi
+    3356:	      |      e8 e2 00 00 00       	call   343d <nel::panic(char const*, nel::Context const&)>
+        }
+    335b:	      \----> c9                   	leave
+    335c:	             c3                   	ret
+
+000000000000335d <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>:
+constexpr T &&move(T &v)
+    335d:	55                   	push   %rbp
+    335e:	48 89 e5             	mov    %rsp,%rbp
+    3361:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    3365:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3369:	5d                   	pop    %rbp
+    336a:	c3                   	ret
+    336b:	90                   	nop
+
+000000000000336c <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>:
+        constexpr U8Buf(U8Buf &&o)
+    336c:	55                   	push   %rbp
+    336d:	48 89 e5             	mov    %rsp,%rbp
+    3370:	48 83 ec 10          	sub    $0x10,%rsp
+    3374:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3378:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            nel::elem::move(data_, o.data_, N);
+    337c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3380:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3384:	ba 00 01 00 00       	mov    $0x100,%edx
+    3389:	48 89 ce             	mov    %rcx,%rsi
+    338c:	48 89 c7             	mov    %rax,%rdi
+    338f:	e8 bb 01 00 00       	call   354f <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+        }
+    3394:	90                   	nop
+    3395:	c9                   	leave
+    3396:	c3                   	ret
+    3397:	90                   	nop
+
+0000000000003398 <nel::Element<void*>::operator*()>:
+
+        constexpr Type &operator*(void)
+    3398:	55                   	push   %rbp
+    3399:	48 89 e5             	mov    %rsp,%rbp
+    339c:	48 83 ec 10          	sub    $0x10,%rsp
+    33a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    33a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33a8:	48 89 c7             	mov    %rax,%rdi
+    33ab:	e8 1c 00 00 00       	call   33cc <nel::Element<void*>::ref()>
+        }
+    33b0:	c9                   	leave
+    33b1:	c3                   	ret
+
+00000000000033b2 <nel::Element<nel::heaped::AllocError>::operator*()>:
+        constexpr Type &operator*(void)
+    33b2:	55                   	push   %rbp
+    33b3:	48 89 e5             	mov    %rsp,%rbp
+    33b6:	48 83 ec 10          	sub    $0x10,%rsp
+    33ba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    33be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33c2:	48 89 c7             	mov    %rax,%rdi
+    33c5:	e8 10 00 00 00       	call   33da <nel::Element<nel::heaped::AllocError>::ref()>
+        }
+    33ca:	c9                   	leave
+    33cb:	c3                   	ret
+
+00000000000033cc <nel::Element<void*>::ref()>:
+        constexpr Type &ref(void)
+    33cc:	55                   	push   %rbp
+    33cd:	48 89 e5             	mov    %rsp,%rbp
+    33d0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    33d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    33d8:	5d                   	pop    %rbp
+    33d9:	c3                   	ret
+
+00000000000033da <nel::Element<nel::heaped::AllocError>::ref()>:
+        constexpr Type &ref(void)
+    33da:	55                   	push   %rbp
+    33db:	48 89 e5             	mov    %rsp,%rbp
+    33de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    33e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    33e6:	5d                   	pop    %rbp
+    33e7:	c3                   	ret
+
+00000000000033e8 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    33e8:	55                   	push   %rbp
+    33e9:	48 89 e5             	mov    %rsp,%rbp
+    std::abort();
+    33ec:	e8 5f dc ff ff       	call   1050 <abort@plt>
+
+00000000000033f1 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    33f1:	55                   	push   %rbp
+    33f2:	48 89 e5             	mov    %rsp,%rbp
+    33f5:	48 83 ec 10          	sub    $0x10,%rsp
+    33f9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    33fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3401:	48 8b 30             	mov    (%rax),%rsi
+    3404:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3408:	8b 48 10             	mov    0x10(%rax),%ecx
+    340b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    340f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    3413:	48 8b 05 66 3c 00 00 	mov    0x3c66(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    341a:	4c 8d 0d 44 0d 00 00 	lea    0xd44(%rip),%r9        # 4165 <nel::is_trivially_relocatable<U8Buf<256ul> >+0x1>
+    3421:	49 89 f0             	mov    %rsi,%r8
+    3424:	48 8d 35 40 0d 00 00 	lea    0xd40(%rip),%rsi        # 416b <nel::is_trivially_relocatable<U8Buf<256ul> >+0x7>
+    342b:	48 89 c7             	mov    %rax,%rdi
+    342e:	b8 00 00 00 00       	mov    $0x0,%eax
+    3433:	e8 98 dc ff ff       	call   10d0 <fprintf@plt>
+    abort();
+    3438:	e8 ab ff ff ff       	call   33e8 <nel::abort()>
+
+000000000000343d <nel::panic(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    343d:	55                   	push   %rbp
+    343e:	48 89 e5             	mov    %rsp,%rbp
+    3441:	48 83 ec 10          	sub    $0x10,%rsp
+    3445:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3449:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    344d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3451:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    3454:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3458:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    345b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    345f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    3463:	48 8b 05 16 3c 00 00 	mov    0x3c16(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    346a:	48 83 ec 08          	sub    $0x8,%rsp
+    346e:	ff 75 f8             	push   -0x8(%rbp)
+    3471:	4c 8d 0d ed 0c 00 00 	lea    0xced(%rip),%r9        # 4165 <nel::is_trivially_relocatable<U8Buf<256ul> >+0x1>
+    3478:	49 89 f0             	mov    %rsi,%r8
+    347b:	48 8d 35 fa 0c 00 00 	lea    0xcfa(%rip),%rsi        # 417c <nel::is_trivially_relocatable<U8Buf<256ul> >+0x18>
+    3482:	48 89 c7             	mov    %rax,%rdi
+    3485:	b8 00 00 00 00       	mov    $0x0,%eax
+    348a:	e8 41 dc ff ff       	call   10d0 <fprintf@plt>
+    348f:	48 83 c4 10          	add    $0x10,%rsp
+            "PANIC",
+            msg);
+    abort();
+    3493:	e8 50 ff ff ff       	call   33e8 <nel::abort()>
+
+0000000000003498 <nel::assert_fail(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    3498:	55                   	push   %rbp
+    3499:	48 89 e5             	mov    %rsp,%rbp
+    349c:	48 83 ec 10          	sub    $0x10,%rsp
+    34a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    34a4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    34a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    34ac:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    34af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    34b3:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    34b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    34ba:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    34be:	48 8b 05 bb 3b 00 00 	mov    0x3bbb(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    34c5:	48 83 ec 08          	sub    $0x8,%rsp
+    34c9:	ff 75 f8             	push   -0x8(%rbp)
+    34cc:	4c 8d 0d be 0c 00 00 	lea    0xcbe(%rip),%r9        # 4191 <nel::is_trivially_relocatable<U8Buf<256ul> >+0x2d>
+    34d3:	49 89 f0             	mov    %rsi,%r8
+    34d6:	48 8d 35 9f 0c 00 00 	lea    0xc9f(%rip),%rsi        # 417c <nel::is_trivially_relocatable<U8Buf<256ul> >+0x18>
+    34dd:	48 89 c7             	mov    %rax,%rdi
+    34e0:	b8 00 00 00 00       	mov    $0x0,%eax
+    34e5:	e8 e6 db ff ff       	call   10d0 <fprintf@plt>
+    34ea:	48 83 c4 10          	add    $0x10,%rsp
+            "ASSERT FAIL",
+            msg);
+    abort();
+    34ee:	e8 f5 fe ff ff       	call   33e8 <nel::abort()>
+
+00000000000034f3 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    34f3:	55                   	push   %rbp
+    34f4:	48 89 e5             	mov    %rsp,%rbp
+    34f7:	48 83 ec 20          	sub    $0x20,%rsp
+    34fb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    34ff:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3503:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    3507:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    350b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    350f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3513:	48 89 ce             	mov    %rcx,%rsi
+    3516:	48 89 c7             	mov    %rax,%rdi
+    3519:	e8 42 db ff ff       	call   1060 <memcpy@plt>
+}
+    351e:	90                   	nop
+    351f:	c9                   	leave
+    3520:	c3                   	ret
+
+0000000000003521 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    3521:	55                   	push   %rbp
+    3522:	48 89 e5             	mov    %rsp,%rbp
+    3525:	48 83 ec 20          	sub    $0x20,%rsp
+    3529:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    352d:	89 f0                	mov    %esi,%eax
+    352f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    3533:	88 45 f4             	mov    %al,-0xc(%rbp)
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    3536:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    353a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    353e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3542:	89 ce                	mov    %ecx,%esi
+    3544:	48 89 c7             	mov    %rax,%rdi
+    3547:	e8 f4 da ff ff       	call   1040 <memset@plt>
+}
+    354c:	90                   	nop
+    354d:	c9                   	leave
+    354e:	c3                   	ret
+
+000000000000354f <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    354f:	55                   	push   %rbp
+    3550:	48 89 e5             	mov    %rsp,%rbp
+    3553:	48 83 ec 20          	sub    $0x20,%rsp
+    3557:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    355b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    355f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    //     *id = *is;
+    // }
+    // for (uint8_t *id = d, *is = s, *const e = (d + n); id != e; ++is, ++id) {
+    //     *is = 0xa5;
+    // }
+    copy(d, s, n);
+    3563:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3567:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    356b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    356f:	48 89 ce             	mov    %rcx,%rsi
+    3572:	48 89 c7             	mov    %rax,%rdi
+    3575:	e8 79 ff ff ff       	call   34f3 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    poison(s, n);
+    357a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    357e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3582:	48 89 d6             	mov    %rdx,%rsi
+    3585:	48 89 c7             	mov    %rax,%rdi
+    3588:	e8 60 07 00 00       	call   3ced <nel::elem::poison(unsigned char*, unsigned long)>
+}
+    358d:	90                   	nop
+    358e:	c9                   	leave
+    358f:	c3                   	ret
+
+0000000000003590 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    3590:	55                   	push   %rbp
+    3591:	48 89 e5             	mov    %rsp,%rbp
+    3594:	48 83 ec 20          	sub    $0x20,%rsp
+    3598:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    359c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    35a0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    std::memmove(d, s, n);
+    35a4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    35a8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    35ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    35b0:	48 89 ce             	mov    %rcx,%rsi
+    35b3:	48 89 c7             	mov    %rax,%rdi
+    35b6:	e8 25 db ff ff       	call   10e0 <memmove@plt>
+}
+    35bb:	90                   	nop
+    35bc:	c9                   	leave
+    35bd:	c3                   	ret
+
+00000000000035be <nel::elem::wipe(unsigned char*, unsigned long)>:
+
+void wipe(uint8_t *const d, Length const n)
+{
+    35be:	55                   	push   %rbp
+    35bf:	48 89 e5             	mov    %rsp,%rbp
+    35c2:	48 83 ec 10          	sub    $0x10,%rsp
+    35c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    35ca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    set(d, 0xa5, n);
+    35ce:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    35d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    35d6:	be a5 00 00 00       	mov    $0xa5,%esi
+    35db:	48 89 c7             	mov    %rax,%rdi
+    35de:	e8 3e ff ff ff       	call   3521 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    35e3:	90                   	nop
+    35e4:	c9                   	leave
+    35e5:	c3                   	ret
+
+00000000000035e6 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    35e6:	55                   	push   %rbp
+    35e7:	48 89 e5             	mov    %rsp,%rbp
+    35ea:	48 83 ec 20          	sub    $0x20,%rsp
+    35ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    35f2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    35f6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    35fa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    35fe:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3602:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3606:	48 89 ce             	mov    %rcx,%rsi
+    3609:	48 89 c7             	mov    %rax,%rdi
+    360c:	e8 1f da ff ff       	call   1030 <memcmp@plt>
+    3611:	85 c0                	test   %eax,%eax
+    3613:	0f 94 c0             	sete   %al
+}
+    3616:	c9                   	leave
+    3617:	c3                   	ret
+
+0000000000003618 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    3618:	55                   	push   %rbp
+    3619:	48 89 e5             	mov    %rsp,%rbp
+    361c:	48 83 ec 20          	sub    $0x20,%rsp
+    3620:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3624:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3628:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    362c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3630:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3634:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3638:	48 89 ce             	mov    %rcx,%rsi
+    363b:	48 89 c7             	mov    %rax,%rdi
+    363e:	e8 ed d9 ff ff       	call   1030 <memcmp@plt>
+    3643:	85 c0                	test   %eax,%eax
+    3645:	0f 95 c0             	setne  %al
+}
+    3648:	c9                   	leave
+    3649:	c3                   	ret
+
+000000000000364a <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>:
+
+// d[i] = p[i % 16] for i in [0, n), with normal stores:
+// the pattern once, then doubling the filled region.
+static void set_pattern(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    364a:	       55                   	push   %rbp
+    364b:	       48 89 e5             	mov    %rsp,%rbp
+    364e:	       48 83 ec 30          	sub    $0x30,%rsp
+    3652:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3656:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    365a:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    Length done = (n < 16) ? n : 16;
+    365e:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3662:	       ba 10 00 00 00       	mov    $0x10,%edx
+    3667:	       48 39 d0             	cmp    %rdx,%rax
+    366a:	       48 0f 47 c2          	cmova  %rdx,%rax
+    366e:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    copy(d, p, done);
+    3672:	       48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3676:	       48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    367a:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    367e:	       48 89 ce             	mov    %rcx,%rsi
+    3681:	       48 89 c7             	mov    %rax,%rdi
+    3684:	       e8 6a fe ff ff       	call   34f3 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    while (done < n) {
+    3689:	   /-- eb 3e                	jmp    36c9 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x7f>
+        Length const m = (done < n - done) ? done : n - done;
+    368b:	/--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    368f:	|  |   48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    3693:	|  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3697:	|  |   48 39 c2             	cmp    %rax,%rdx
+    369a:	|  |   48 0f 46 c2          	cmovbe %rdx,%rax
+    369e:	|  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        copy(d + done, d, m);
+    36a2:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    36a6:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    36aa:	|  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    36ae:	|  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    36b2:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    36b6:	|  |   48 89 c6             	mov    %rax,%rsi
+    36b9:	|  |   48 89 cf             	mov    %rcx,%rdi
+    36bc:	|  |   e8 32 fe ff ff       	call   34f3 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        done += m;
+    36c1:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    36c5:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+    while (done < n) {
+    36c9:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    36cd:	|      48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    36d1:	\----- 72 b8                	jb     368b <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x41>
+    }
+}
+    36d3:	       90                   	nop
+    36d4:	       90                   	nop
+    36d5:	       c9                   	leave
+    36d6:	       c3                   	ret
+
+00000000000036d7 <nel::elem::load16(unsigned char const*)>:
+static constexpr Length streaming_min = 256;
+
+typedef long long int Line16 __attribute__((vector_size(16)));
+
+static inline Line16 load16(uint8_t const *const s)
+{
+    36d7:	55                   	push   %rbp
+    36d8:	48 89 e5             	mov    %rsp,%rbp
+    36db:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Line16 v;
+    std::memcpy(&v, s, sizeof(v));
+    36df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    36e3:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    36e7:	48 8b 00             	mov    (%rax),%rax
+    36ea:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    36ee:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    return v;
+    36f2:	66 0f 6f 45 f0       	movdqa -0x10(%rbp),%xmm0
+}
+    36f7:	5d                   	pop    %rbp
+    36f8:	c3                   	ret
+
+00000000000036f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>:
+
+static inline void stream16(uint8_t *const d, Line16 const &v)
+{
+    36f9:	55                   	push   %rbp
+    36fa:	48 89 e5             	mov    %rsp,%rbp
+    36fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3701:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    3705:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3709:	66 0f 6f 00          	movdqa (%rax),%xmm0
+    370d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3711:	66 0f e7 00          	movntdq %xmm0,(%rax)
+}
+    3715:	90                   	nop
+    3716:	5d                   	pop    %rbp
+    3717:	c3                   	ret
+
+0000000000003718 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    3718:	          55                   	push   %rbp
+    3719:	          48 89 e5             	mov    %rsp,%rbp
+    371c:	          48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    3720:	          48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    3724:	          48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    3728:	          48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    if (n < streaming_min) {
+    372c:	          48 81 7d 88 ff 00 00 	cmpq   $0xff,-0x78(%rbp)
+    3733:	          00 
+    3734:	      /-- 77 1c                	ja     3752 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        copy(d, s, n);
+    3736:	      |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    373a:	      |   48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    373e:	      |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3742:	      |   48 89 ce             	mov    %rcx,%rsi
+    3745:	      |   48 89 c7             	mov    %rax,%rdi
+    3748:	      |   e8 a6 fd ff ff       	call   34f3 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        return;
+    374d:	/-----|-- e9 98 01 00 00       	jmp    38ea <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1d2>
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    3752:	|     \-> 48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3756:	|         48 f7 d8             	neg    %rax
+    3759:	|         83 e0 0f             	and    $0xf,%eax
+    375c:	|         48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    copy(d, s, head);
+    3760:	|         48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3764:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    3768:	|         48 8b 45 98          	mov    -0x68(%rbp),%rax
+    376c:	|         48 89 ce             	mov    %rcx,%rsi
+    376f:	|         48 89 c7             	mov    %rax,%rdi
+    3772:	|         e8 7c fd ff ff       	call   34f3 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    Index i = head;
+    3777:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    377b:	|         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    377f:	|     /-- e9 e1 00 00 00       	jmp    3865 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        Line16 const a = load16(s + i);
+    3784:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3788:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    378c:	|  |  |   48 01 d0             	add    %rdx,%rax
+    378f:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3792:	|  |  |   e8 40 ff ff ff       	call   36d7 <nel::elem::load16(unsigned char const*)>
+    3797:	|  |  |   0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+        Line16 const b = load16(s + i + 16);
+    379b:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    379f:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    37a3:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    37a7:	|  |  |   48 01 d0             	add    %rdx,%rax
+    37aa:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    37ad:	|  |  |   e8 25 ff ff ff       	call   36d7 <nel::elem::load16(unsigned char const*)>
+    37b2:	|  |  |   0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+        Line16 const c = load16(s + i + 32);
+    37b6:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    37ba:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    37be:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    37c2:	|  |  |   48 01 d0             	add    %rdx,%rax
+    37c5:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    37c8:	|  |  |   e8 0a ff ff ff       	call   36d7 <nel::elem::load16(unsigned char const*)>
+    37cd:	|  |  |   0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+        Line16 const e = load16(s + i + 48);
+    37d1:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    37d5:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    37d9:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    37dd:	|  |  |   48 01 d0             	add    %rdx,%rax
+    37e0:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    37e3:	|  |  |   e8 ef fe ff ff       	call   36d7 <nel::elem::load16(unsigned char const*)>
+    37e8:	|  |  |   0f 29 45 a0          	movaps %xmm0,-0x60(%rbp)
+        stream16(d + i, a);
+    37ec:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    37f0:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    37f4:	|  |  |   48 01 c2             	add    %rax,%rdx
+    37f7:	|  |  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    37fb:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    37fe:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3801:	|  |  |   e8 f3 fe ff ff       	call   36f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, b);
+    3806:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    380a:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    380e:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3812:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3815:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3819:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    381c:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    381f:	|  |  |   e8 d5 fe ff ff       	call   36f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, c);
+    3824:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3828:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    382c:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3830:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3833:	|  |  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    3837:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    383a:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    383d:	|  |  |   e8 b7 fe ff ff       	call   36f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, e);
+    3842:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3846:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    384a:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    384e:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3851:	|  |  |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    3855:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3858:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    385b:	|  |  |   e8 99 fe ff ff       	call   36f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    3860:	|  |  |   48 83 45 f8 40       	addq   $0x40,-0x8(%rbp)
+    3865:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3869:	|  |      48 83 c0 40          	add    $0x40,%rax
+    386d:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    3871:	|  \----- 0f 83 0d ff ff ff    	jae    3784 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x6c>
+    }
+    for (; i + 16 <= n; i += 16) {
+    3877:	|     /-- eb 36                	jmp    38af <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x197>
+        stream16(d + i, load16(s + i));
+    3879:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    387d:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3881:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3884:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3887:	|  |  |   e8 4b fe ff ff       	call   36d7 <nel::elem::load16(unsigned char const*)>
+    388c:	|  |  |   0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+    3890:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    3894:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3898:	|  |  |   48 01 c2             	add    %rax,%rdx
+    389b:	|  |  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    389f:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    38a2:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    38a5:	|  |  |   e8 4f fe ff ff       	call   36f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    38aa:	|  |  |   48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+    38af:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    38b3:	|  |      48 83 c0 10          	add    $0x10,%rax
+    38b7:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    38bb:	|  \----- 73 bc                	jae    3879 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    38bd:	|         0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    38c0:	|         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    38c4:	|         48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    38c8:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    38cc:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    38d0:	|         48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    38d4:	|         48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+    38d8:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    38dc:	|         48 01 d1             	add    %rdx,%rcx
+    38df:	|         48 89 c2             	mov    %rax,%rdx
+    38e2:	|         48 89 cf             	mov    %rcx,%rdi
+    38e5:	|         e8 09 fc ff ff       	call   34f3 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+}
+    38ea:	\-------> c9                   	leave
+    38eb:	          c3                   	ret
+
+00000000000038ec <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    38ec:	          55                   	push   %rbp
+    38ed:	          48 89 e5             	mov    %rsp,%rbp
+    38f0:	          48 83 ec 60          	sub    $0x60,%rsp
+    38f4:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    38f8:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    38fc:	          48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    if (n < streaming_min) {
+    3900:	          48 81 7d a8 ff 00 00 	cmpq   $0xff,-0x58(%rbp)
+    3907:	          00 
+    3908:	      /-- 77 1c                	ja     3926 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        set_pattern(d, p, n);
+    390a:	      |   48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    390e:	      |   48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+    3912:	      |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3916:	      |   48 89 ce             	mov    %rcx,%rsi
+    3919:	      |   48 89 c7             	mov    %rax,%rdi
+    391c:	      |   e8 29 fd ff ff       	call   364a <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>
+    3921:	/-----|-- e9 89 01 00 00       	jmp    3aaf <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c3>
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    3926:	|     \-> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    392a:	|         48 f7 d8             	neg    %rax
+    392d:	|         83 e0 0f             	and    $0xf,%eax
+    3930:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    for (Index i = 0; i < head; ++i) {
+    3934:	|         48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    393b:	|         00 
+    393c:	|     /-- eb 20                	jmp    395e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x72>
+        d[i] = p[i];
+    393e:	|  /--|-> 48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    3942:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3946:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3949:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    394d:	|  |  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3951:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    3954:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    3957:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < head; ++i) {
+    3959:	|  |  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    395e:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3962:	|  |      48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    3966:	|  \----- 72 d6                	jb     393e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x52>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    3968:	|         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    396f:	|         00 
+    3970:	|     /-- eb 2d                	jmp    399f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xb3>
+        rotated[i] = p[(head + i) % 16];
+    3972:	|  /--|-> 48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    3976:	|  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    397a:	|  |  |   48 01 d0             	add    %rdx,%rax
+    397d:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    3980:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    3983:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3987:	|  |  |   48 01 d0             	add    %rdx,%rax
+    398a:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    398d:	|  |  |   48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    3991:	|  |  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3995:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    3998:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < 16; ++i) {
+    399a:	|  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    399f:	|  |  \-> 48 83 7d f0 0f       	cmpq   $0xf,-0x10(%rbp)
+    39a4:	|  \----- 76 cc                	jbe    3972 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x86>
+    }
+    Line16 const v = load16(rotated);
+    39a6:	|         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    39aa:	|         48 89 c7             	mov    %rax,%rdi
+    39ad:	|         e8 25 fd ff ff       	call   36d7 <nel::elem::load16(unsigned char const*)>
+    39b2:	|         0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+    Index i = head;
+    39b6:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    39ba:	|         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    39be:	|     /-- eb 79                	jmp    3a39 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        stream16(d + i, v);
+    39c0:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    39c4:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    39c8:	|  |  |   48 01 c2             	add    %rax,%rdx
+    39cb:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    39cf:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    39d2:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    39d5:	|  |  |   e8 1f fd ff ff       	call   36f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, v);
+    39da:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    39de:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    39e2:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    39e6:	|  |  |   48 01 c2             	add    %rax,%rdx
+    39e9:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    39ed:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    39f0:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    39f3:	|  |  |   e8 01 fd ff ff       	call   36f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, v);
+    39f8:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    39fc:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    3a00:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3a04:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3a07:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3a0b:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3a0e:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3a11:	|  |  |   e8 e3 fc ff ff       	call   36f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, v);
+    3a16:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3a1a:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    3a1e:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3a22:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3a25:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3a29:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3a2c:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3a2f:	|  |  |   e8 c5 fc ff ff       	call   36f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    3a34:	|  |  |   48 83 45 e8 40       	addq   $0x40,-0x18(%rbp)
+    3a39:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3a3d:	|  |      48 83 c0 40          	add    $0x40,%rax
+    3a41:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    3a45:	|  \----- 0f 83 75 ff ff ff    	jae    39c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd4>
+    }
+    for (; i + 16 <= n; i += 16) {
+    3a4b:	|     /-- eb 1f                	jmp    3a6c <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x180>
+        stream16(d + i, v);
+    3a4d:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    3a51:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3a55:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3a58:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3a5c:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3a5f:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3a62:	|  |  |   e8 92 fc ff ff       	call   36f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    3a67:	|  |  |   48 83 45 e8 10       	addq   $0x10,-0x18(%rbp)
+    3a6c:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3a70:	|  |      48 83 c0 10          	add    $0x10,%rax
+    3a74:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    3a78:	|  \----- 73 d3                	jae    3a4d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    __builtin_ia32_sfence();
+    3a7a:	|         0f ae f8             	sfence
+    for (; i < n; ++i) {
+    3a7d:	|     /-- eb 26                	jmp    3aa5 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1b9>
+        d[i] = p[i % 16];
+    3a7f:	|  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3a83:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    3a86:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    3a89:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3a8d:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3a90:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    3a94:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3a98:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    3a9b:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    3a9e:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (; i < n; ++i) {
+    3aa0:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    3aa5:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3aa9:	|  |      48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    3aad:	|  \----- 72 d0                	jb     3a7f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x193>
+    }
+}
+    3aaf:	\-------> c9                   	leave
+    3ab0:	          c3                   	ret
+
+0000000000003ab1 <nel::offset_of(unsigned char*, unsigned long)>:
+// The payload is the first align boundary leaving room for a Length in front,
+// which holds the offset from the start of the underlying allocation.
+// Malloc alignment is at least alignof(Length), so the payload is at most
+// align bytes in.
+static Length offset_of(uint8_t *const base, Length const align)
+{
+    3ab1:	55                   	push   %rbp
+    3ab2:	48 89 e5             	mov    %rsp,%rbp
+    3ab5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3ab9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    USize const a = reinterpret_cast<USize>(base) + sizeof(Length);
+    3abd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3ac1:	48 83 c0 08          	add    $0x8,%rax
+    3ac5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    3ac9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3acd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3ad1:	48 01 d0             	add    %rdx,%rax
+    3ad4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    3ad8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3adc:	48 f7 d8             	neg    %rax
+    3adf:	48 21 c2             	and    %rax,%rdx
+    3ae2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3ae6:	48 29 c2             	sub    %rax,%rdx
+    3ae9:	48 89 d0             	mov    %rdx,%rax
+}
+    3aec:	5d                   	pop    %rbp
+    3aed:	c3                   	ret
+
+0000000000003aee <nel::offset_field(unsigned char*)>:
+
+static Length &offset_field(uint8_t *const p)
+{
+    3aee:	55                   	push   %rbp
+    3aef:	48 89 e5             	mov    %rsp,%rbp
+    3af2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return reinterpret_cast<Length *>(p)[-1];
+    3af6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3afa:	48 83 e8 08          	sub    $0x8,%rax
+}
+    3afe:	5d                   	pop    %rbp
+    3aff:	c3                   	ret
+
+0000000000003b00 <nel::free_aligned(void*)>:
+
+void free_aligned(void *const p)
+{
+    3b00:	       55                   	push   %rbp
+    3b01:	       48 89 e5             	mov    %rsp,%rbp
+    3b04:	       48 83 ec 20          	sub    $0x20,%rsp
+    3b08:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (p == nullptr) { return; }
+    3b0c:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3b11:	/----- 74 2e                	je     3b41 <nel::free_aligned(void*)+0x41>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    3b13:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3b17:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    std::free(u8p - offset_field(u8p));
+    3b1b:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3b1f:	|      48 89 c7             	mov    %rax,%rdi
+    3b22:	|      e8 c7 ff ff ff       	call   3aee <nel::offset_field(unsigned char*)>
+    3b27:	|      48 8b 00             	mov    (%rax),%rax
+    3b2a:	|      48 f7 d8             	neg    %rax
+    3b2d:	|      48 89 c2             	mov    %rax,%rdx
+    3b30:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3b34:	|      48 01 d0             	add    %rdx,%rax
+    3b37:	|      48 89 c7             	mov    %rax,%rdi
+    3b3a:	|      e8 71 d5 ff ff       	call   10b0 <free@plt>
+    3b3f:	|  /-- eb 01                	jmp    3b42 <nel::free_aligned(void*)+0x42>
+    if (p == nullptr) { return; }
+    3b41:	\--|-> 90                   	nop
+}
+    3b42:	   \-> c9                   	leave
+    3b43:	       c3                   	ret
+
+0000000000003b44 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    3b44:	             55                   	push   %rbp
+    3b45:	             48 89 e5             	mov    %rsp,%rbp
+    3b48:	             53                   	push   %rbx
+    3b49:	             48 83 ec 78          	sub    $0x78,%rsp
+    3b4d:	             48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    3b51:	             48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    3b55:	             48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    3b59:	             48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    3b5d:	             48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    3b61:	             b9 f3 00 00 00       	mov    $0xf3,%ecx
+    3b66:	             48 8d 15 43 06 00 00 	lea    0x643(%rip),%rdx        # 41b0 <nel::elem::streaming_min+0x8>
+    3b6d:	             48 8d 35 4e 06 00 00 	lea    0x64e(%rip),%rsi        # 41c2 <nel::elem::streaming_min+0x1a>
+    3b74:	             48 89 c7             	mov    %rax,%rdi
+    3b77:	             e8 8c db ff ff       	call   1708 <nel::Context::Context(char const*, char const*, int)>
+    3b7c:	             48 83 7d 90 00       	cmpq   $0x0,-0x70(%rbp)
+    3b81:	      /----- 74 18                	je     3b9b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    3b83:	      |      48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3b87:	      |      48 83 e8 01          	sub    $0x1,%rax
+    3b8b:	      |      48 23 45 90          	and    -0x70(%rbp),%rax
+    3b8f:	      |      48 85 c0             	test   %rax,%rax
+    3b92:	      +----- 75 07                	jne    3b9b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    3b94:	      |      b8 01 00 00 00       	mov    $0x1,%eax
+    3b99:	      |  /-- eb 05                	jmp    3ba0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x5c>
+    3b9b:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3ba0:	         \-> 0f b6 c0             	movzbl %al,%eax
+    3ba3:	             48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    3ba7:	             48 8d 0d 24 06 00 00 	lea    0x624(%rip),%rcx        # 41d2 <nel::elem::streaming_min+0x2a>
+    3bae:	             48 89 ce             	mov    %rcx,%rsi
+    3bb1:	             89 c7                	mov    %eax,%edi
+    3bb3:	             e8 87 db ff ff       	call   173f <nel::assert(bool, char const*, nel::Context const&)>
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    3bb8:	             48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3bbc:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    3bc0:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3bc5:	      /----- 74 11                	je     3bd8 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x94>
+    3bc7:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3bcb:	      |      48 89 c7             	mov    %rax,%rdi
+    3bce:	      |      e8 1b ff ff ff       	call   3aee <nel::offset_field(unsigned char*)>
+    3bd3:	      |      48 8b 00             	mov    (%rax),%rax
+    3bd6:	      |  /-- eb 05                	jmp    3bdd <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x99>
+    3bd8:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3bdd:	         \-> 48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    3be1:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3be6:	      /----- 74 13                	je     3bfb <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb7>
+    3be8:	      |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3bec:	      |      48 f7 d8             	neg    %rax
+    3bef:	      |      48 89 c2             	mov    %rax,%rdx
+    3bf2:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3bf6:	      |      48 01 d0             	add    %rdx,%rax
+    3bf9:	      |  /-- eb 05                	jmp    3c00 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xbc>
+    3bfb:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3c00:	         \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    3c04:	             48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    3c08:	             48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3c0c:	             48 01 c2             	add    %rax,%rdx
+    3c0f:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3c13:	             48 89 d6             	mov    %rdx,%rsi
+    3c16:	             48 89 c7             	mov    %rax,%rdi
+    3c19:	             e8 d2 d4 ff ff       	call   10f0 <realloc@plt>
+    3c1e:	             48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if (new_base == nullptr) { return nullptr; }
+    3c22:	             48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    3c27:	         /-- 75 0a                	jne    3c33 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    3c29:	         |   b8 00 00 00 00       	mov    $0x0,%eax
+    3c2e:	/--------|-- e9 85 00 00 00       	jmp    3cb8 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x174>
+
+    Length const new_offset = offset_of(new_base, align);
+    3c33:	|        \-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3c37:	|            48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3c3b:	|            48 89 d6             	mov    %rdx,%rsi
+    3c3e:	|            48 89 c7             	mov    %rax,%rdi
+    3c41:	|            e8 6b fe ff ff       	call   3ab1 <nel::offset_of(unsigned char*, unsigned long)>
+    3c46:	|            48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    uint8_t *const new_p = new_base + new_offset;
+    3c4a:	|            48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    3c4e:	|            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3c52:	|            48 01 d0             	add    %rdx,%rax
+    3c55:	|            48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    if (old_p != nullptr && new_offset != old_offset) {
+    3c59:	|            48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3c5e:	|  /-------- 74 41                	je     3ca1 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+    3c60:	|  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3c64:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    3c68:	|  +-------- 74 37                	je     3ca1 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+    3c6a:	|  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3c6e:	|  |         48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    3c72:	|  |  /----- 73 06                	jae    3c7a <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x136>
+    3c74:	|  |  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3c78:	|  |  |  /-- eb 04                	jmp    3c7e <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x13a>
+    3c7a:	|  |  \--|-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    3c7e:	|  |     \-> 48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        std::memmove(new_p, new_base + old_offset, n);
+    3c82:	|  |         48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    3c86:	|  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3c8a:	|  |         48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    3c8e:	|  |         48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    3c92:	|  |         48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    3c96:	|  |         48 89 ce             	mov    %rcx,%rsi
+    3c99:	|  |         48 89 c7             	mov    %rax,%rdi
+    3c9c:	|  |         e8 3f d4 ff ff       	call   10e0 <memmove@plt>
+    }
+    offset_field(new_p) = new_offset;
+    3ca1:	|  \-------> 48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+    3ca5:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    3ca9:	|            48 89 c7             	mov    %rax,%rdi
+    3cac:	|            e8 3d fe ff ff       	call   3aee <nel::offset_field(unsigned char*)>
+    3cb1:	|            48 89 18             	mov    %rbx,(%rax)
+    return new_p;
+    3cb4:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+}
+    3cb8:	\----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3cbc:	             c9                   	leave
+    3cbd:	             c3                   	ret
+
+0000000000003cbe <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    3cbe:	55                   	push   %rbp
+    3cbf:	48 89 e5             	mov    %rsp,%rbp
+    3cc2:	48 83 ec 10          	sub    $0x10,%rsp
+    3cc6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3cca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return realloc_aligned(nullptr, align, 0, size);
+    3cce:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3cd2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3cd6:	48 89 d1             	mov    %rdx,%rcx
+    3cd9:	ba 00 00 00 00       	mov    $0x0,%edx
+    3cde:	48 89 c6             	mov    %rax,%rsi
+    3ce1:	bf 00 00 00 00       	mov    $0x0,%edi
+    3ce6:	e8 59 fe ff ff       	call   3b44 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+}
+    3ceb:	c9                   	leave
+    3cec:	c3                   	ret
+
+0000000000003ced <nel::elem::poison(unsigned char*, unsigned long)>:
+{
+    3ced:	55                   	push   %rbp
+    3cee:	48 89 e5             	mov    %rsp,%rbp
+    3cf1:	48 83 ec 10          	sub    $0x10,%rsp
+    3cf5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3cf9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    copy(d, s, n);
+    3cfd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3d01:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3d05:	48 89 d6             	mov    %rdx,%rsi
+    3d08:	48 89 c7             	mov    %rax,%rdi
+    3d0b:	e8 ae f8 ff ff       	call   35be <nel::elem::wipe(unsigned char*, unsigned long)>
+}
+    3d10:	90                   	nop
+    3d11:	c9                   	leave
+    3d12:	c3                   	ret
+
+0000000000003d13 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    3d13:	55                   	push   %rbp
+    3d14:	48 89 e5             	mov    %rsp,%rbp
+    3d17:	48 83 ec 10          	sub    $0x10,%rsp
+    3d1b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3d1f:	89 f0                	mov    %esi,%eax
+    3d21:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    3d24:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    3d28:	48 8b 15 51 33 00 00 	mov    0x3351(%rip),%rdx        # 7080 <stderr@GLIBC_2.2.5>
+    3d2f:	48 89 d6             	mov    %rdx,%rsi
+    3d32:	89 c7                	mov    %eax,%edi
+    3d34:	e8 87 d3 ff ff       	call   10c0 <fputc@plt>
+    return outs;
+    3d39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3d3d:	c9                   	leave
+    3d3e:	c3                   	ret
+
+0000000000003d3f <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    3d3f:	55                   	push   %rbp
+    3d40:	48 89 e5             	mov    %rsp,%rbp
+    3d43:	48 83 ec 10          	sub    $0x10,%rsp
+    3d47:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3d4b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    3d4f:	48 8b 15 2a 33 00 00 	mov    0x332a(%rip),%rdx        # 7080 <stderr@GLIBC_2.2.5>
+    3d56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3d5a:	48 89 d6             	mov    %rdx,%rsi
+    3d5d:	48 89 c7             	mov    %rax,%rdi
+    3d60:	e8 3b d3 ff ff       	call   10a0 <fputs@plt>
+    return outs;
+    3d65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3d69:	c9                   	leave
+    3d6a:	c3                   	ret
+
+0000000000003d6b <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    3d6b:	55                   	push   %rbp
+    3d6c:	48 89 e5             	mov    %rsp,%rbp
+    3d6f:	48 83 ec 10          	sub    $0x10,%rsp
+    3d73:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3d77:	89 f0                	mov    %esi,%eax
+    3d79:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    3d7c:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    3d80:	48 8b 05 f9 32 00 00 	mov    0x32f9(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    3d87:	48 8d 0d 5f 04 00 00 	lea    0x45f(%rip),%rcx        # 41ed <nel::elem::streaming_min+0x45>
+    3d8e:	48 89 ce             	mov    %rcx,%rsi
+    3d91:	48 89 c7             	mov    %rax,%rdi
+    3d94:	b8 00 00 00 00       	mov    $0x0,%eax
+    3d99:	e8 32 d3 ff ff       	call   10d0 <fprintf@plt>
+    return outs;
+    3d9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3da2:	c9                   	leave
+    3da3:	c3                   	ret
+
+0000000000003da4 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    3da4:	55                   	push   %rbp
+    3da5:	48 89 e5             	mov    %rsp,%rbp
+    3da8:	48 83 ec 10          	sub    $0x10,%rsp
+    3dac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3db0:	89 f0                	mov    %esi,%eax
+    3db2:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    3db6:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    3dba:	48 8b 05 bf 32 00 00 	mov    0x32bf(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    3dc1:	48 8d 0d 25 04 00 00 	lea    0x425(%rip),%rcx        # 41ed <nel::elem::streaming_min+0x45>
+    3dc8:	48 89 ce             	mov    %rcx,%rsi
+    3dcb:	48 89 c7             	mov    %rax,%rdi
+    3dce:	b8 00 00 00 00       	mov    $0x0,%eax
+    3dd3:	e8 f8 d2 ff ff       	call   10d0 <fprintf@plt>
+    return outs;
+    3dd8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3ddc:	c9                   	leave
+    3ddd:	c3                   	ret
+
+0000000000003dde <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    3dde:	55                   	push   %rbp
+    3ddf:	48 89 e5             	mov    %rsp,%rbp
+    3de2:	48 83 ec 10          	sub    $0x10,%rsp
+    3de6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3dea:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    3ded:	48 8b 05 8c 32 00 00 	mov    0x328c(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    3df4:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    3df7:	48 8d 0d ef 03 00 00 	lea    0x3ef(%rip),%rcx        # 41ed <nel::elem::streaming_min+0x45>
+    3dfe:	48 89 ce             	mov    %rcx,%rsi
+    3e01:	48 89 c7             	mov    %rax,%rdi
+    3e04:	b8 00 00 00 00       	mov    $0x0,%eax
+    3e09:	e8 c2 d2 ff ff       	call   10d0 <fprintf@plt>
+    return outs;
+    3e0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3e12:	c9                   	leave
+    3e13:	c3                   	ret
+
+0000000000003e14 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    3e14:	55                   	push   %rbp
+    3e15:	48 89 e5             	mov    %rsp,%rbp
+    3e18:	48 83 ec 10          	sub    $0x10,%rsp
+    3e1c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3e20:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    3e23:	48 8b 05 56 32 00 00 	mov    0x3256(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    3e2a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    3e2d:	48 8d 0d b9 03 00 00 	lea    0x3b9(%rip),%rcx        # 41ed <nel::elem::streaming_min+0x45>
+    3e34:	48 89 ce             	mov    %rcx,%rsi
+    3e37:	48 89 c7             	mov    %rax,%rdi
+    3e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+    3e3f:	e8 8c d2 ff ff       	call   10d0 <fprintf@plt>
+    return outs;
+    3e44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3e48:	c9                   	leave
+    3e49:	c3                   	ret
+
+0000000000003e4a <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    3e4a:	55                   	push   %rbp
+    3e4b:	48 89 e5             	mov    %rsp,%rbp
+    3e4e:	48 83 ec 10          	sub    $0x10,%rsp
+    3e52:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3e56:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    3e5a:	48 8b 05 1f 32 00 00 	mov    0x321f(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    3e61:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3e65:	48 8d 0d 84 03 00 00 	lea    0x384(%rip),%rcx        # 41f0 <nel::elem::streaming_min+0x48>
+    3e6c:	48 89 ce             	mov    %rcx,%rsi
+    3e6f:	48 89 c7             	mov    %rax,%rdi
+    3e72:	b8 00 00 00 00       	mov    $0x0,%eax
+    3e77:	e8 54 d2 ff ff       	call   10d0 <fprintf@plt>
+    return outs;
+    3e7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3e80:	c9                   	leave
+    3e81:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000003e84 <_fini>:
+    3e84:	48 83 ec 08          	sub    $0x8,%rsp
+    3e88:	48 83 c4 08          	add    $0x8,%rsp
+    3e8c:	c3                   	ret
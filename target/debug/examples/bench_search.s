@@ -0,0 +1,5691 @@
+
+target/debug/examples/bench_search:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 6f 00 00 	mov    0x6fc5(%rip),%rax        # 7fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 6f 00 00    	push   0x6fca(%rip)        # 7ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 6f 00 00    	jmp    *0x6fcc(%rip)        # 7ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 6f 00 00    	jmp    *0x6fca(%rip)        # 8000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 6f 00 00    	jmp    *0x6fc2(%rip)        # 8008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <clock_gettime@plt>:
+    1050:	ff 25 ba 6f 00 00    	jmp    *0x6fba(%rip)        # 8010 <clock_gettime@GLIBC_2.17>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputs@plt>:
+    1060:	ff 25 b2 6f 00 00    	jmp    *0x6fb2(%rip)        # 8018 <fputs@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <memset@plt>:
+    1070:	ff 25 aa 6f 00 00    	jmp    *0x6faa(%rip)        # 8020 <memset@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fputc@plt>:
+    1080:	ff 25 a2 6f 00 00    	jmp    *0x6fa2(%rip)        # 8028 <fputc@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <memcmp@plt>:
+    1090:	ff 25 9a 6f 00 00    	jmp    *0x6f9a(%rip)        # 8030 <memcmp@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <fprintf@plt>:
+    10a0:	ff 25 92 6f 00 00    	jmp    *0x6f92(%rip)        # 8038 <fprintf@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <memcpy@plt>:
+    10b0:	ff 25 8a 6f 00 00    	jmp    *0x6f8a(%rip)        # 8040 <memcpy@GLIBC_2.14>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <realloc@plt>:
+    10c0:	ff 25 82 6f 00 00    	jmp    *0x6f82(%rip)        # 8048 <realloc@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <memmove@plt>:
+    10d0:	ff 25 7a 6f 00 00    	jmp    *0x6f7a(%rip)        # 8050 <memmove@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010e0 <__cxa_finalize@plt>:
+    10e0:	ff 25 fa 6e 00 00    	jmp    *0x6efa(%rip)        # 7fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10e6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010f0 <_start>:
+    10f0:	31 ed                	xor    %ebp,%ebp
+    10f2:	49 89 d1             	mov    %rdx,%r9
+    10f5:	5e                   	pop    %rsi
+    10f6:	48 89 e2             	mov    %rsp,%rdx
+    10f9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    10fd:	50                   	push   %rax
+    10fe:	54                   	push   %rsp
+    10ff:	45 31 c0             	xor    %r8d,%r8d
+    1102:	31 c9                	xor    %ecx,%ecx
+    1104:	48 8d 3d b0 03 00 00 	lea    0x3b0(%rip),%rdi        # 14bb <main>
+    110b:	ff 15 af 6e 00 00    	call   *0x6eaf(%rip)        # 7fc0 <__libc_start_main@GLIBC_2.34>
+    1111:	f4                   	hlt
+    1112:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1119:	00 00 00 
+    111c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001120 <deregister_tm_clones>:
+    1120:	    48 8d 3d 41 6f 00 00 	lea    0x6f41(%rip),%rdi        # 8068 <__TMC_END__>
+    1127:	    48 8d 05 3a 6f 00 00 	lea    0x6f3a(%rip),%rax        # 8068 <__TMC_END__>
+    112e:	    48 39 f8             	cmp    %rdi,%rax
+    1131:	/-- 74 15                	je     1148 <deregister_tm_clones+0x28>
+    1133:	|   48 8b 05 8e 6e 00 00 	mov    0x6e8e(%rip),%rax        # 7fc8 <_ITM_deregisterTMCloneTable@Base>
+    113a:	|   48 85 c0             	test   %rax,%rax
+    113d:	+-- 74 09                	je     1148 <deregister_tm_clones+0x28>
+    113f:	|   ff e0                	jmp    *%rax
+    1141:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1148:	\-> c3                   	ret
+    1149:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001150 <register_tm_clones>:
+    1150:	    48 8d 3d 11 6f 00 00 	lea    0x6f11(%rip),%rdi        # 8068 <__TMC_END__>
+    1157:	    48 8d 35 0a 6f 00 00 	lea    0x6f0a(%rip),%rsi        # 8068 <__TMC_END__>
+    115e:	    48 29 fe             	sub    %rdi,%rsi
+    1161:	    48 89 f0             	mov    %rsi,%rax
+    1164:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1168:	    48 c1 f8 03          	sar    $0x3,%rax
+    116c:	    48 01 c6             	add    %rax,%rsi
+    116f:	    48 d1 fe             	sar    %rsi
+    1172:	/-- 74 14                	je     1188 <register_tm_clones+0x38>
+    1174:	|   48 8b 05 5d 6e 00 00 	mov    0x6e5d(%rip),%rax        # 7fd8 <_ITM_registerTMCloneTable@Base>
+    117b:	|   48 85 c0             	test   %rax,%rax
+    117e:	+-- 74 08                	je     1188 <register_tm_clones+0x38>
+    1180:	|   ff e0                	jmp    *%rax
+    1182:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1188:	\-> c3                   	ret
+    1189:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001190 <__do_global_dtors_aux>:
+    1190:	       f3 0f 1e fa          	endbr64
+    1194:	       80 3d ed 6e 00 00 00 	cmpb   $0x0,0x6eed(%rip)        # 8088 <completed.0>
+    119b:	/----- 75 2b                	jne    11c8 <__do_global_dtors_aux+0x38>
+    119d:	|      55                   	push   %rbp
+    119e:	|      48 83 3d 3a 6e 00 00 	cmpq   $0x0,0x6e3a(%rip)        # 7fe0 <__cxa_finalize@GLIBC_2.2.5>
+    11a5:	|      00 
+    11a6:	|      48 89 e5             	mov    %rsp,%rbp
+    11a9:	|  /-- 74 0c                	je     11b7 <__do_global_dtors_aux+0x27>
+    11ab:	|  |   48 8b 3d ae 6e 00 00 	mov    0x6eae(%rip),%rdi        # 8060 <__dso_handle>
+    11b2:	|  |   e8 29 ff ff ff       	call   10e0 <__cxa_finalize@plt>
+    11b7:	|  \-> e8 64 ff ff ff       	call   1120 <deregister_tm_clones>
+    11bc:	|      c6 05 c5 6e 00 00 01 	movb   $0x1,0x6ec5(%rip)        # 8088 <completed.0>
+    11c3:	|      5d                   	pop    %rbp
+    11c4:	|      c3                   	ret
+    11c5:	|      0f 1f 00             	nopl   (%rax)
+    11c8:	\----> c3                   	ret
+    11c9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011d0 <frame_dummy>:
+    11d0:	f3 0f 1e fa          	endbr64
+    11d4:	e9 77 ff ff ff       	jmp    1150 <register_tm_clones>
+    11d9:	90                   	nop
+
+00000000000011da <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    11da:	55                   	push   %rbp
+    11db:	48 89 e5             	mov    %rsp,%rbp
+    11de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11e2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    11e5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11ea:	5d                   	pop    %rbp
+    11eb:	c3                   	ret
+
+00000000000011ec <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    11ec:	55                   	push   %rbp
+    11ed:	48 89 e5             	mov    %rsp,%rbp
+    11f0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11f4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11f7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return -1;
+    11fb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1200:	5d                   	pop    %rbp
+    1201:	c3                   	ret
+
+0000000000001202 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    1202:	55                   	push   %rbp
+    1203:	48 89 e5             	mov    %rsp,%rbp
+    1206:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    120a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    120d:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    return -1;
+    1210:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1215:	5d                   	pop    %rbp
+    1216:	c3                   	ret
+
+0000000000001217 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    1217:	55                   	push   %rbp
+    1218:	48 89 e5             	mov    %rsp,%rbp
+    121b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    121f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1222:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    1225:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    return -1;
+    1228:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    122d:	5d                   	pop    %rbp
+    122e:	c3                   	ret
+
+000000000000122f <_read_r>:
+int _read_r(struct _reent *, int) {
+    122f:	55                   	push   %rbp
+    1230:	48 89 e5             	mov    %rsp,%rbp
+    1233:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1237:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    123a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    123f:	5d                   	pop    %rbp
+    1240:	c3                   	ret
+
+0000000000001241 <_write_r>:
+int _write_r(struct _reent *, int, char *, int) {
+    1241:	55                   	push   %rbp
+    1242:	48 89 e5             	mov    %rsp,%rbp
+    1245:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1249:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    124c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1250:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+    return -1;
+    1253:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1258:	5d                   	pop    %rbp
+    1259:	c3                   	ret
+
+000000000000125a <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    125a:	55                   	push   %rbp
+    125b:	48 89 e5             	mov    %rsp,%rbp
+    125e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return -1;
+    1262:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1267:	5d                   	pop    %rbp
+    1268:	c3                   	ret
+
+0000000000001269 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1269:	55                   	push   %rbp
+    126a:	48 89 e5             	mov    %rsp,%rbp
+    126d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1271:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1274:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1279:	5d                   	pop    %rbp
+    127a:	c3                   	ret
+
+000000000000127b <next_rand(unsigned int&)>:
+
+// above this, a linear scan would take all day.
+static constexpr nel::Length max_linear = 4 * 1024;
+
+static unsigned int next_rand(unsigned int &s)
+{
+    127b:	55                   	push   %rbp
+    127c:	48 89 e5             	mov    %rsp,%rbp
+    127f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    s ^= s << 13;
+    1283:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1287:	8b 10                	mov    (%rax),%edx
+    1289:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    128d:	8b 00                	mov    (%rax),%eax
+    128f:	c1 e0 0d             	shl    $0xd,%eax
+    1292:	31 c2                	xor    %eax,%edx
+    1294:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1298:	89 10                	mov    %edx,(%rax)
+    s ^= s >> 17;
+    129a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    129e:	8b 10                	mov    (%rax),%edx
+    12a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12a4:	8b 00                	mov    (%rax),%eax
+    12a6:	c1 e8 11             	shr    $0x11,%eax
+    12a9:	31 c2                	xor    %eax,%edx
+    12ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12af:	89 10                	mov    %edx,(%rax)
+    s ^= s << 5;
+    12b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12b5:	8b 10                	mov    (%rax),%edx
+    12b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12bb:	8b 00                	mov    (%rax),%eax
+    12bd:	c1 e0 05             	shl    $0x5,%eax
+    12c0:	31 c2                	xor    %eax,%edx
+    12c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12c6:	89 10                	mov    %edx,(%rax)
+    return s;
+    12c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12cc:	8b 00                	mov    (%rax),%eax
+}
+    12ce:	5d                   	pop    %rbp
+    12cf:	c3                   	ret
+
+00000000000012d0 <main::{lambda(int)#1}::operator()(int) const>:
+        auto e = layout.slice(0, n);
+        nel::search::eytzinger_from(e.ptr(), s.ptr(), n);
+        nel::log << "table of " << n << " ints\n";
+
+        if (n <= max_linear) {
+            run("  linear, try_get   ", n, [&s](int const key) -> nel::Index {
+    12d0:	          55                   	push   %rbp
+    12d1:	          48 89 e5             	mov    %rsp,%rbp
+    12d4:	          41 54                	push   %r12
+    12d6:	          53                   	push   %rbx
+    12d7:	          48 83 ec 30          	sub    $0x30,%rsp
+    12db:	          48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    12df:	          89 75 c4             	mov    %esi,-0x3c(%rbp)
+                nel::Index i = 0;
+    12e2:	          48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+    12e9:	          00 
+                while (s.try_get(i).is_some() && s[i] < key) {
+    12ea:	      /-- eb 05                	jmp    12f1 <main::{lambda(int)#1}::operator()(int) const+0x21>
+                    i += 1;
+    12ec:	/-----|-> 48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+            run("  linear, try_get   ", n, [&s](int const key) -> nel::Index {
+    12f1:	|     \-> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    12f5:	|         48 8b 08             	mov    (%rax),%rcx
+                while (s.try_get(i).is_some() && s[i] < key) {
+    12f8:	|         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    12fc:	|         48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1300:	|         48 89 ce             	mov    %rcx,%rsi
+    1303:	|         48 89 c7             	mov    %rax,%rdi
+    1306:	|         e8 dd 0f 00 00       	call   22e8 <nel::Slice<int>::try_get(unsigned long) const>
+    130b:	|         41 bc 01 00 00 00    	mov    $0x1,%r12d
+    1311:	|         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1315:	|         48 89 c7             	mov    %rax,%rdi
+    1318:	|         e8 b5 10 00 00       	call   23d2 <nel::Optional<int&>::is_some() const>
+    131d:	|         84 c0                	test   %al,%al
+    131f:	|  /----- 74 24                	je     1345 <main::{lambda(int)#1}::operator()(int) const+0x75>
+            run("  linear, try_get   ", n, [&s](int const key) -> nel::Index {
+    1321:	|  |      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1325:	|  |      48 8b 00             	mov    (%rax),%rax
+                while (s.try_get(i).is_some() && s[i] < key) {
+    1328:	|  |      48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    132c:	|  |      48 89 d6             	mov    %rdx,%rsi
+    132f:	|  |      48 89 c7             	mov    %rax,%rdi
+    1332:	|  |      e8 e1 10 00 00       	call   2418 <nel::Slice<int>::operator[](unsigned long) const>
+    1337:	|  |      8b 00                	mov    (%rax),%eax
+    1339:	|  |      39 45 c4             	cmp    %eax,-0x3c(%rbp)
+    133c:	|  +----- 7e 07                	jle    1345 <main::{lambda(int)#1}::operator()(int) const+0x75>
+    133e:	|  |      bb 01 00 00 00       	mov    $0x1,%ebx
+    1343:	|  |  /-- eb 05                	jmp    134a <main::{lambda(int)#1}::operator()(int) const+0x7a>
+    1345:	|  \--|-> bb 00 00 00 00       	mov    $0x0,%ebx
+    134a:	|     \-> 45 84 e4             	test   %r12b,%r12b
+    134d:	|     /-- 74 0c                	je     135b <main::{lambda(int)#1}::operator()(int) const+0x8b>
+    134f:	|     |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1353:	|     |   48 89 c7             	mov    %rax,%rdi
+    1356:	|     |   e8 ef 0f 00 00       	call   234a <nel::Optional<int&>::~Optional()>
+    135b:	|     \-> 84 db                	test   %bl,%bl
+    135d:	\-------- 75 8d                	jne    12ec <main::{lambda(int)#1}::operator()(int) const+0x1c>
+                }
+                return i;
+    135f:	          48 8b 45 e8          	mov    -0x18(%rbp),%rax
+            });
+    1363:	          48 83 c4 30          	add    $0x30,%rsp
+    1367:	          5b                   	pop    %rbx
+    1368:	          41 5c                	pop    %r12
+    136a:	          5d                   	pop    %rbp
+    136b:	          c3                   	ret
+
+000000000000136c <main::{lambda(int)#2}::operator()(int) const>:
+        }
+        run("  binary_search     ", n, [&s](int const key) -> nel::Index {
+    136c:	       55                   	push   %rbp
+    136d:	       48 89 e5             	mov    %rsp,%rbp
+    1370:	       53                   	push   %rbx
+    1371:	       48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+    1378:	       48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+    137f:	       89 b5 64 ff ff ff    	mov    %esi,-0x9c(%rbp)
+    1385:	       48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    138c:	       48 8b 30             	mov    (%rax),%rsi
+            auto r = s.binary_search(key);
+    138f:	       48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    1396:	       48 8d 4d 8f          	lea    -0x71(%rbp),%rcx
+    139a:	       48 8d 95 64 ff ff ff 	lea    -0x9c(%rbp),%rdx
+    13a1:	       48 89 c7             	mov    %rax,%rdi
+    13a4:	       e8 95 10 00 00       	call   243e <nel::Result<unsigned long, unsigned long> nel::Slice<int>::binary_search<nel::sort::Less>(int const&, nel::sort::Less&&) const>
+            return r.is_ok() ? r.unwrap() : r.unwrap_err();
+    13a9:	       48 8d 45 90          	lea    -0x70(%rbp),%rax
+    13ad:	       b9 4f 00 00 00       	mov    $0x4f,%ecx
+    13b2:	       48 8d 15 f9 3c 00 00 	lea    0x3cf9(%rip),%rdx        # 50b2 <max_linear+0x22>
+    13b9:	       48 8d 35 0b 3d 00 00 	lea    0x3d0b(%rip),%rsi        # 50cb <max_linear+0x3b>
+    13c0:	       48 89 c7             	mov    %rax,%rdi
+    13c3:	       e8 46 09 00 00       	call   1d0e <nel::Context::Context(char const*, char const*, int)>
+    13c8:	       48 8d 55 90          	lea    -0x70(%rbp),%rdx
+    13cc:	       48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    13d3:	       48 89 d6             	mov    %rdx,%rsi
+    13d6:	       48 89 c7             	mov    %rax,%rdi
+    13d9:	       e8 fa 0a 00 00       	call   1ed8 <nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const>
+    13de:	       84 c0                	test   %al,%al
+    13e0:	/----- 74 3a                	je     141c <main::{lambda(int)#2}::operator()(int) const+0xb0>
+    13e2:	|      48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    13e6:	|      b9 4f 00 00 00       	mov    $0x4f,%ecx
+    13eb:	|      48 8d 15 c0 3c 00 00 	lea    0x3cc0(%rip),%rdx        # 50b2 <max_linear+0x22>
+    13f2:	|      48 8d 35 d2 3c 00 00 	lea    0x3cd2(%rip),%rsi        # 50cb <max_linear+0x3b>
+    13f9:	|      48 89 c7             	mov    %rax,%rdi
+    13fc:	|      e8 0d 09 00 00       	call   1d0e <nel::Context::Context(char const*, char const*, int)>
+    1401:	|      48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    1405:	|      48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    140c:	|      48 89 d6             	mov    %rdx,%rsi
+    140f:	|      48 89 c7             	mov    %rax,%rdi
+    1412:	|      e8 c5 11 00 00       	call   25dc <nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)>
+    1417:	|      48 89 c3             	mov    %rax,%rbx
+    141a:	|  /-- eb 38                	jmp    1454 <main::{lambda(int)#2}::operator()(int) const+0xe8>
+    141c:	\--|-> 48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1420:	   |   b9 4f 00 00 00       	mov    $0x4f,%ecx
+    1425:	   |   48 8d 15 86 3c 00 00 	lea    0x3c86(%rip),%rdx        # 50b2 <max_linear+0x22>
+    142c:	   |   48 8d 35 98 3c 00 00 	lea    0x3c98(%rip),%rsi        # 50cb <max_linear+0x3b>
+    1433:	   |   48 89 c7             	mov    %rax,%rdi
+    1436:	   |   e8 d3 08 00 00       	call   1d0e <nel::Context::Context(char const*, char const*, int)>
+    143b:	   |   48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    143f:	   |   48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    1446:	   |   48 89 d6             	mov    %rdx,%rsi
+    1449:	   |   48 89 c7             	mov    %rax,%rdi
+    144c:	   |   e8 fd 11 00 00       	call   264e <nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)>
+    1451:	   |   48 89 c3             	mov    %rax,%rbx
+        });
+    1454:	   \-> 48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    145b:	       48 89 c7             	mov    %rax,%rdi
+    145e:	       e8 af 10 00 00       	call   2512 <nel::Result<unsigned long, unsigned long>::~Result()>
+            return r.is_ok() ? r.unwrap() : r.unwrap_err();
+    1463:	       48 89 d8             	mov    %rbx,%rax
+        });
+    1466:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    146a:	       c9                   	leave
+    146b:	       c3                   	ret
+
+000000000000146c <main::{lambda(int)#3}::operator()(int) const>:
+        run("  eytzinger         ", n, [&e, &less, n](int const key) -> nel::Index {
+    146c:	55                   	push   %rbp
+    146d:	48 89 e5             	mov    %rsp,%rbp
+    1470:	41 54                	push   %r12
+    1472:	53                   	push   %rbx
+    1473:	48 83 ec 10          	sub    $0x10,%rsp
+    1477:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    147b:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    147e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1482:	4c 8b 60 08          	mov    0x8(%rax),%r12
+    1486:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    148a:	48 8b 58 10          	mov    0x10(%rax),%rbx
+    148e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1492:	48 8b 00             	mov    (%rax),%rax
+            return nel::search::eytzinger_lower_bound(e.ptr(), n, key, less);
+    1495:	48 89 c7             	mov    %rax,%rdi
+    1498:	e8 01 0a 00 00       	call   1e9e <nel::Slice<int>::ptr() const>
+    149d:	48 89 c7             	mov    %rax,%rdi
+    14a0:	48 8d 45 e4          	lea    -0x1c(%rbp),%rax
+    14a4:	4c 89 e1             	mov    %r12,%rcx
+    14a7:	48 89 c2             	mov    %rax,%rdx
+    14aa:	48 89 de             	mov    %rbx,%rsi
+    14ad:	e8 ce 11 00 00       	call   2680 <unsigned long nel::search::eytzinger_lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)>
+        });
+    14b2:	48 83 c4 10          	add    $0x10,%rsp
+    14b6:	5b                   	pop    %rbx
+    14b7:	41 5c                	pop    %r12
+    14b9:	5d                   	pop    %rbp
+    14ba:	c3                   	ret
+
+00000000000014bb <main>:
+{
+    14bb:	          55                   	push   %rbp
+    14bc:	          48 89 e5             	mov    %rsp,%rbp
+    14bf:	          53                   	push   %rbx
+    14c0:	          48 81 ec 08 01 00 00 	sub    $0x108,%rsp
+    nel::Length const max_n = sizes[sizeof(sizes) / sizeof(sizes[0]) - 1];
+    14c7:	          48 c7 45 d8 00 00 00 	movq   $0x1000000,-0x28(%rbp)
+    14ce:	          01 
+    auto sorted = nel::heaped::Vector<int>::with_capacity(max_n);
+    14cf:	          48 8d 85 28 ff ff ff 	lea    -0xd8(%rbp),%rax
+    14d6:	          be 00 00 00 01       	mov    $0x1000000,%esi
+    14db:	          48 89 c7             	mov    %rax,%rdi
+    14de:	          e8 93 0b 00 00       	call   2076 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+    auto layout = nel::heaped::Vector<int>::with_capacity(max_n);
+    14e3:	          48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+    14ea:	          be 00 00 00 01       	mov    $0x1000000,%esi
+    14ef:	          48 89 c7             	mov    %rax,%rdi
+    14f2:	          e8 7f 0b 00 00       	call   2076 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+    for (nel::Index i = 0; i < max_n; ++i) {
+    14f7:	          48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+    14fe:	          00 
+    14ff:	      /-- e9 ef 00 00 00       	jmp    15f3 <main+0x138>
+        sorted.push(int(2 * i)).unwrap();
+    1504:	   /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1508:	   |  |   01 c0                	add    %eax,%eax
+    150a:	   |  |   89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+    1510:	   |  |   48 8d 85 34 ff ff ff 	lea    -0xcc(%rbp),%rax
+    1517:	   |  |   48 8d 95 3c ff ff ff 	lea    -0xc4(%rbp),%rdx
+    151e:	   |  |   48 8d 8d 28 ff ff ff 	lea    -0xd8(%rbp),%rcx
+    1525:	   |  |   48 89 ce             	mov    %rcx,%rsi
+    1528:	   |  |   48 89 c7             	mov    %rax,%rdi
+    152b:	   |  |   e8 cc 0b 00 00       	call   20fc <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>
+    1530:	   |  |   48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+    1537:	   |  |   b9 39 00 00 00       	mov    $0x39,%ecx
+    153c:	   |  |   48 8d 15 6f 3b 00 00 	lea    0x3b6f(%rip),%rdx        # 50b2 <max_linear+0x22>
+    1543:	   |  |   48 8d 35 8c 3b 00 00 	lea    0x3b8c(%rip),%rsi        # 50d6 <max_linear+0x46>
+    154a:	   |  |   48 89 c7             	mov    %rax,%rdi
+    154d:	   |  |   e8 bc 07 00 00       	call   1d0e <nel::Context::Context(char const*, char const*, int)>
+    1552:	   |  |   48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+    1559:	   |  |   48 8d 85 34 ff ff ff 	lea    -0xcc(%rbp),%rax
+    1560:	   |  |   48 89 d6             	mov    %rdx,%rsi
+    1563:	   |  |   48 89 c7             	mov    %rax,%rdi
+    1566:	   |  |   e8 d1 0c 00 00       	call   223c <nel::Result<void, int>::unwrap(nel::Context const&)>
+    156b:	   |  |   48 8d 85 34 ff ff ff 	lea    -0xcc(%rbp),%rax
+    1572:	   |  |   48 89 c7             	mov    %rax,%rdi
+    1575:	   |  |   e8 0c 0c 00 00       	call   2186 <nel::Result<void, int>::~Result()>
+        layout.push(0).unwrap();
+    157a:	   |  |   c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%rbp)
+    1581:	   |  |   00 00 00 
+    1584:	   |  |   48 8d 85 64 ff ff ff 	lea    -0x9c(%rbp),%rax
+    158b:	   |  |   48 8d 95 6c ff ff ff 	lea    -0x94(%rbp),%rdx
+    1592:	   |  |   48 8d 8d 20 ff ff ff 	lea    -0xe0(%rbp),%rcx
+    1599:	   |  |   48 89 ce             	mov    %rcx,%rsi
+    159c:	   |  |   48 89 c7             	mov    %rax,%rdi
+    159f:	   |  |   e8 58 0b 00 00       	call   20fc <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>
+    15a4:	   |  |   48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    15ab:	   |  |   b9 3a 00 00 00       	mov    $0x3a,%ecx
+    15b0:	   |  |   48 8d 15 fb 3a 00 00 	lea    0x3afb(%rip),%rdx        # 50b2 <max_linear+0x22>
+    15b7:	   |  |   48 8d 35 18 3b 00 00 	lea    0x3b18(%rip),%rsi        # 50d6 <max_linear+0x46>
+    15be:	   |  |   48 89 c7             	mov    %rax,%rdi
+    15c1:	   |  |   e8 48 07 00 00       	call   1d0e <nel::Context::Context(char const*, char const*, int)>
+    15c6:	   |  |   48 8d 95 70 ff ff ff 	lea    -0x90(%rbp),%rdx
+    15cd:	   |  |   48 8d 85 64 ff ff ff 	lea    -0x9c(%rbp),%rax
+    15d4:	   |  |   48 89 d6             	mov    %rdx,%rsi
+    15d7:	   |  |   48 89 c7             	mov    %rax,%rdi
+    15da:	   |  |   e8 5d 0c 00 00       	call   223c <nel::Result<void, int>::unwrap(nel::Context const&)>
+    15df:	   |  |   48 8d 85 64 ff ff ff 	lea    -0x9c(%rbp),%rax
+    15e6:	   |  |   48 89 c7             	mov    %rax,%rdi
+    15e9:	   |  |   e8 98 0b 00 00       	call   2186 <nel::Result<void, int>::~Result()>
+    for (nel::Index i = 0; i < max_n; ++i) {
+    15ee:	   |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    15f3:	   |  \-> 48 81 7d e8 ff ff ff 	cmpq   $0xffffff,-0x18(%rbp)
+    15fa:	   |      00 
+    15fb:	   \----- 0f 86 03 ff ff ff    	jbe    1504 <main+0x49>
+    for (nel::Length const n: sizes) {
+    1601:	          48 8d 05 58 3a 00 00 	lea    0x3a58(%rip),%rax        # 5060 <sizes>
+    1608:	          48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    160c:	          48 8d 05 4d 3a 00 00 	lea    0x3a4d(%rip),%rax        # 5060 <sizes>
+    1613:	          48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1617:	          48 8d 05 72 3a 00 00 	lea    0x3a72(%rip),%rax        # 5090 <max_linear>
+    161e:	          48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    1622:	   /----- e9 56 01 00 00       	jmp    177d <main+0x2c2>
+    1627:	/--|----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    162b:	|  |      48 8b 00             	mov    (%rax),%rax
+    162e:	|  |      48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        auto s = sorted.slice(0, n);
+    1632:	|  |      48 8d 85 00 ff ff ff 	lea    -0x100(%rbp),%rax
+    1639:	|  |      48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    163d:	|  |      48 8d b5 28 ff ff ff 	lea    -0xd8(%rbp),%rsi
+    1644:	|  |      48 89 d1             	mov    %rdx,%rcx
+    1647:	|  |      ba 00 00 00 00       	mov    $0x0,%edx
+    164c:	|  |      48 89 c7             	mov    %rax,%rdi
+    164f:	|  |      e8 14 0c 00 00       	call   2268 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice(unsigned long, unsigned long)>
+        auto e = layout.slice(0, n);
+    1654:	|  |      48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+    165b:	|  |      48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    165f:	|  |      48 8d b5 20 ff ff ff 	lea    -0xe0(%rbp),%rsi
+    1666:	|  |      48 89 d1             	mov    %rdx,%rcx
+    1669:	|  |      ba 00 00 00 00       	mov    $0x0,%edx
+    166e:	|  |      48 89 c7             	mov    %rax,%rdi
+    1671:	|  |      e8 f2 0b 00 00       	call   2268 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice(unsigned long, unsigned long)>
+        nel::search::eytzinger_from(e.ptr(), s.ptr(), n);
+    1676:	|  |      48 8d 85 00 ff ff ff 	lea    -0x100(%rbp),%rax
+    167d:	|  |      48 89 c7             	mov    %rax,%rdi
+    1680:	|  |      e8 19 08 00 00       	call   1e9e <nel::Slice<int>::ptr() const>
+    1685:	|  |      48 89 c3             	mov    %rax,%rbx
+    1688:	|  |      48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+    168f:	|  |      48 89 c7             	mov    %rax,%rdi
+    1692:	|  |      e8 07 08 00 00       	call   1e9e <nel::Slice<int>::ptr() const>
+    1697:	|  |      48 89 c1             	mov    %rax,%rcx
+    169a:	|  |      48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    169e:	|  |      48 89 c2             	mov    %rax,%rdx
+    16a1:	|  |      48 89 de             	mov    %rbx,%rsi
+    16a4:	|  |      48 89 cf             	mov    %rcx,%rdi
+    16a7:	|  |      e8 05 0c 00 00       	call   22b1 <void nel::search::eytzinger_from<int>(int*, int const*, unsigned long)>
+        nel::log << "table of " << n << " ints\n";
+    16ac:	|  |      48 8d 05 28 3a 00 00 	lea    0x3a28(%rip),%rax        # 50db <max_linear+0x4b>
+    16b3:	|  |      48 89 c6             	mov    %rax,%rsi
+    16b6:	|  |      48 8d 05 db 69 00 00 	lea    0x69db(%rip),%rax        # 8098 <nel::log>
+    16bd:	|  |      48 89 c7             	mov    %rax,%rdi
+    16c0:	|  |      e8 a4 2e 00 00       	call   4569 <nel::operator<<(nel::Log&, char const*)>
+    16c5:	|  |      48 89 c2             	mov    %rax,%rdx
+    16c8:	|  |      48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    16cc:	|  |      48 89 c6             	mov    %rax,%rsi
+    16cf:	|  |      48 89 d7             	mov    %rdx,%rdi
+    16d2:	|  |      e8 9d 2f 00 00       	call   4674 <nel::operator<<(nel::Log&, unsigned long)>
+    16d7:	|  |      48 89 c2             	mov    %rax,%rdx
+    16da:	|  |      48 8d 05 04 3a 00 00 	lea    0x3a04(%rip),%rax        # 50e5 <max_linear+0x55>
+    16e1:	|  |      48 89 c6             	mov    %rax,%rsi
+    16e4:	|  |      48 89 d7             	mov    %rdx,%rdi
+    16e7:	|  |      e8 7d 2e 00 00       	call   4569 <nel::operator<<(nel::Log&, char const*)>
+        if (n <= max_linear) {
+    16ec:	|  |      48 81 7d c0 00 10 00 	cmpq   $0x1000,-0x40(%rbp)
+    16f3:	|  |      00 
+    16f4:	|  |  /-- 77 25                	ja     171b <main+0x260>
+            run("  linear, try_get   ", n, [&s](int const key) -> nel::Index {
+    16f6:	|  |  |   48 8d 85 00 ff ff ff 	lea    -0x100(%rbp),%rax
+    16fd:	|  |  |   48 89 45 90          	mov    %rax,-0x70(%rbp)
+    1701:	|  |  |   48 8d 55 90          	lea    -0x70(%rbp),%rdx
+    1705:	|  |  |   48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1709:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    170c:	|  |  |   48 8d 05 d9 39 00 00 	lea    0x39d9(%rip),%rax        # 50ec <max_linear+0x5c>
+    1713:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    1716:	|  |  |   e8 5c 01 00 00       	call   1877 <void run<main::{lambda(int)#1}>(char const*, unsigned long, main::{lambda(int)#1}&&)>
+        run("  binary_search     ", n, [&s](int const key) -> nel::Index {
+    171b:	|  |  \-> 48 8d 85 00 ff ff ff 	lea    -0x100(%rbp),%rax
+    1722:	|  |      48 89 45 98          	mov    %rax,-0x68(%rbp)
+    1726:	|  |      48 8d 55 98          	lea    -0x68(%rbp),%rdx
+    172a:	|  |      48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    172e:	|  |      48 89 c6             	mov    %rax,%rsi
+    1731:	|  |      48 8d 05 c9 39 00 00 	lea    0x39c9(%rip),%rax        # 5101 <max_linear+0x71>
+    1738:	|  |      48 89 c7             	mov    %rax,%rdi
+    173b:	|  |      e8 41 02 00 00       	call   1981 <void run<main::{lambda(int)#2}>(char const*, unsigned long, main::{lambda(int)#2}&&)>
+        run("  eytzinger         ", n, [&e, &less, n](int const key) -> nel::Index {
+    1740:	|  |      48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+    1747:	|  |      48 89 45 a0          	mov    %rax,-0x60(%rbp)
+    174b:	|  |      48 8d 85 1f ff ff ff 	lea    -0xe1(%rbp),%rax
+    1752:	|  |      48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    1756:	|  |      48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    175a:	|  |      48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    175e:	|  |      48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    1762:	|  |      48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1766:	|  |      48 89 c6             	mov    %rax,%rsi
+    1769:	|  |      48 8d 05 a6 39 00 00 	lea    0x39a6(%rip),%rax        # 5116 <max_linear+0x86>
+    1770:	|  |      48 89 c7             	mov    %rax,%rdi
+    1773:	|  |      e8 13 03 00 00       	call   1a8b <void run<main::{lambda(int)#3}>(char const*, unsigned long, main::{lambda(int)#3}&&)>
+    for (nel::Length const n: sizes) {
+    1778:	|  |      48 83 45 e0 08       	addq   $0x8,-0x20(%rbp)
+    177d:	|  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1781:	|         48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+    1785:	\-------- 0f 85 9c fe ff ff    	jne    1627 <main+0x16c>
+    }
+    nel::log << "sink: " << (long unsigned int)sink << '\n';
+    178b:	          48 8d 05 99 39 00 00 	lea    0x3999(%rip),%rax        # 512b <max_linear+0x9b>
+    1792:	          48 89 c6             	mov    %rax,%rsi
+    1795:	          48 8d 05 fc 68 00 00 	lea    0x68fc(%rip),%rax        # 8098 <nel::log>
+    179c:	          48 89 c7             	mov    %rax,%rdi
+    179f:	          e8 c5 2d 00 00       	call   4569 <nel::operator<<(nel::Log&, char const*)>
+    17a4:	          48 89 c2             	mov    %rax,%rdx
+    17a7:	          48 8b 05 e2 68 00 00 	mov    0x68e2(%rip),%rax        # 8090 <sink>
+    17ae:	          48 89 c6             	mov    %rax,%rsi
+    17b1:	          48 89 d7             	mov    %rdx,%rdi
+    17b4:	          e8 bb 2e 00 00       	call   4674 <nel::operator<<(nel::Log&, unsigned long)>
+    17b9:	          be 0a 00 00 00       	mov    $0xa,%esi
+    17be:	          48 89 c7             	mov    %rax,%rdi
+    17c1:	          e8 77 2d 00 00       	call   453d <nel::operator<<(nel::Log&, char)>
+}
+    17c6:	          48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+    17cd:	          48 89 c7             	mov    %rax,%rdi
+    17d0:	          e8 09 09 00 00       	call   20de <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    17d5:	          48 8d 85 28 ff ff ff 	lea    -0xd8(%rbp),%rax
+    17dc:	          48 89 c7             	mov    %rax,%rdi
+    17df:	          e8 fa 08 00 00       	call   20de <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    17e4:	          b8 00 00 00 00       	mov    $0x0,%eax
+    17e9:	          48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    17ed:	          c9                   	leave
+    17ee:	          c3                   	ret
+    17ef:	          90                   	nop
+
+00000000000017f0 <run<main::{lambda(int)#1}>(char const*, unsigned long, main::{lambda(int)#1}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    17f0:	       55                   	push   %rbp
+    17f1:	       48 89 e5             	mov    %rsp,%rbp
+    17f4:	       48 83 ec 20          	sub    $0x20,%rsp
+    17f8:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index i = 0; i < n_lookups; ++i) {
+    17fc:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1803:	       00 
+    1804:	   /-- eb 63                	jmp    1869 <run<main::{lambda(int)#1}>(char const*, unsigned long, main::{lambda(int)#1}&&)::{lambda()#1}::operator()() const+0x79>
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    1806:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    180a:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+            int const key = int(next_rand(seed) % (2 * n));
+    180e:	|  |   48 89 c7             	mov    %rax,%rdi
+    1811:	|  |   e8 65 fa ff ff       	call   127b <next_rand(unsigned int&)>
+    1816:	|  |   89 c2                	mov    %eax,%edx
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    1818:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    181c:	|  |   48 8b 40 18          	mov    0x18(%rax),%rax
+            int const key = int(next_rand(seed) % (2 * n));
+    1820:	|  |   48 8d 0c 00          	lea    (%rax,%rax,1),%rcx
+    1824:	|  |   48 89 d0             	mov    %rdx,%rax
+    1827:	|  |   ba 00 00 00 00       	mov    $0x0,%edx
+    182c:	|  |   48 f7 f1             	div    %rcx
+    182f:	|  |   48 89 d0             	mov    %rdx,%rax
+    1832:	|  |   89 45 f4             	mov    %eax,-0xc(%rbp)
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    1835:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1839:	|  |   48 8b 40 08          	mov    0x8(%rax),%rax
+            r += f(key);
+    183d:	|  |   8b 55 f4             	mov    -0xc(%rbp),%edx
+    1840:	|  |   89 d6                	mov    %edx,%esi
+    1842:	|  |   48 89 c7             	mov    %rax,%rdi
+    1845:	|  |   e8 86 fa ff ff       	call   12d0 <main::{lambda(int)#1}::operator()(int) const>
+    184a:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    184d:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1851:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(key);
+    1854:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    1857:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    185b:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(key);
+    185e:	|  |   48 01 ca             	add    %rcx,%rdx
+    1861:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index i = 0; i < n_lookups; ++i) {
+    1864:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1869:	|  \-> 48 81 7d f8 ff 08 3d 	cmpq   $0x3d08ff,-0x8(%rbp)
+    1870:	|      00 
+    1871:	\----- 76 93                	jbe    1806 <run<main::{lambda(int)#1}>(char const*, unsigned long, main::{lambda(int)#1}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    1873:	       90                   	nop
+    1874:	       90                   	nop
+    1875:	       c9                   	leave
+    1876:	       c3                   	ret
+
+0000000000001877 <void run<main::{lambda(int)#1}>(char const*, unsigned long, main::{lambda(int)#1}&&)>:
+void run(char const *const name, nel::Length const n, F &&f)
+    1877:	55                   	push   %rbp
+    1878:	48 89 e5             	mov    %rsp,%rbp
+    187b:	48 83 ec 60          	sub    $0x60,%rsp
+    187f:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    1883:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    1887:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    unsigned int seed = 0x9e3779b9;
+    188b:	c7 45 cc b9 79 37 9e 	movl   $0x9e3779b9,-0x34(%rbp)
+    long unsigned int r = 0;
+    1892:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+    1899:	00 
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    189a:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    189e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    18a2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    18a6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    18aa:	48 8d 45 cc          	lea    -0x34(%rbp),%rax
+    18ae:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    18b2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    18b6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    18ba:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    18be:	48 89 c7             	mov    %rax,%rdi
+    18c1:	e8 48 02 00 00       	call   1b0e <unsigned long bench::time_ns<run<main::{lambda(int)#1}>(char const*, unsigned long, main::{lambda(int)#1}&&)::{lambda()#1}>(main::{lambda(int)#1}&&)>
+    18c6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    sink = sink + r;
+    18ca:	48 8b 15 bf 67 00 00 	mov    0x67bf(%rip),%rdx        # 8090 <sink>
+    18d1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    18d5:	48 01 d0             	add    %rdx,%rax
+    18d8:	48 89 05 b1 67 00 00 	mov    %rax,0x67b1(%rip)        # 8090 <sink>
+    bench::report_per_item(name, t, n_lookups);
+    18df:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    18e3:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    18e7:	ba 00 09 3d 00       	mov    $0x3d0900,%edx
+    18ec:	48 89 ce             	mov    %rcx,%rsi
+    18ef:	48 89 c7             	mov    %rax,%rdi
+    18f2:	e8 c8 02 00 00       	call   1bbf <bench::report_per_item(char const*, unsigned long, unsigned long)>
+}
+    18f7:	90                   	nop
+    18f8:	c9                   	leave
+    18f9:	c3                   	ret
+
+00000000000018fa <run<main::{lambda(int)#2}>(char const*, unsigned long, main::{lambda(int)#2}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    18fa:	       55                   	push   %rbp
+    18fb:	       48 89 e5             	mov    %rsp,%rbp
+    18fe:	       48 83 ec 20          	sub    $0x20,%rsp
+    1902:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index i = 0; i < n_lookups; ++i) {
+    1906:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    190d:	       00 
+    190e:	   /-- eb 63                	jmp    1973 <run<main::{lambda(int)#2}>(char const*, unsigned long, main::{lambda(int)#2}&&)::{lambda()#1}::operator()() const+0x79>
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    1910:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1914:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+            int const key = int(next_rand(seed) % (2 * n));
+    1918:	|  |   48 89 c7             	mov    %rax,%rdi
+    191b:	|  |   e8 5b f9 ff ff       	call   127b <next_rand(unsigned int&)>
+    1920:	|  |   89 c2                	mov    %eax,%edx
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    1922:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1926:	|  |   48 8b 40 18          	mov    0x18(%rax),%rax
+            int const key = int(next_rand(seed) % (2 * n));
+    192a:	|  |   48 8d 0c 00          	lea    (%rax,%rax,1),%rcx
+    192e:	|  |   48 89 d0             	mov    %rdx,%rax
+    1931:	|  |   ba 00 00 00 00       	mov    $0x0,%edx
+    1936:	|  |   48 f7 f1             	div    %rcx
+    1939:	|  |   48 89 d0             	mov    %rdx,%rax
+    193c:	|  |   89 45 f4             	mov    %eax,-0xc(%rbp)
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    193f:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1943:	|  |   48 8b 40 08          	mov    0x8(%rax),%rax
+            r += f(key);
+    1947:	|  |   8b 55 f4             	mov    -0xc(%rbp),%edx
+    194a:	|  |   89 d6                	mov    %edx,%esi
+    194c:	|  |   48 89 c7             	mov    %rax,%rdi
+    194f:	|  |   e8 18 fa ff ff       	call   136c <main::{lambda(int)#2}::operator()(int) const>
+    1954:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    1957:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    195b:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(key);
+    195e:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    1961:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1965:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(key);
+    1968:	|  |   48 01 ca             	add    %rcx,%rdx
+    196b:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index i = 0; i < n_lookups; ++i) {
+    196e:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1973:	|  \-> 48 81 7d f8 ff 08 3d 	cmpq   $0x3d08ff,-0x8(%rbp)
+    197a:	|      00 
+    197b:	\----- 76 93                	jbe    1910 <run<main::{lambda(int)#2}>(char const*, unsigned long, main::{lambda(int)#2}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    197d:	       90                   	nop
+    197e:	       90                   	nop
+    197f:	       c9                   	leave
+    1980:	       c3                   	ret
+
+0000000000001981 <void run<main::{lambda(int)#2}>(char const*, unsigned long, main::{lambda(int)#2}&&)>:
+void run(char const *const name, nel::Length const n, F &&f)
+    1981:	55                   	push   %rbp
+    1982:	48 89 e5             	mov    %rsp,%rbp
+    1985:	48 83 ec 60          	sub    $0x60,%rsp
+    1989:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    198d:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    1991:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    unsigned int seed = 0x9e3779b9;
+    1995:	c7 45 cc b9 79 37 9e 	movl   $0x9e3779b9,-0x34(%rbp)
+    long unsigned int r = 0;
+    199c:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+    19a3:	00 
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    19a4:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    19a8:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    19ac:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    19b0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    19b4:	48 8d 45 cc          	lea    -0x34(%rbp),%rax
+    19b8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    19bc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    19c0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    19c4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    19c8:	48 89 c7             	mov    %rax,%rdi
+    19cb:	e8 6a 01 00 00       	call   1b3a <unsigned long bench::time_ns<run<main::{lambda(int)#2}>(char const*, unsigned long, main::{lambda(int)#2}&&)::{lambda()#1}>(main::{lambda(int)#2}&&)>
+    19d0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    sink = sink + r;
+    19d4:	48 8b 15 b5 66 00 00 	mov    0x66b5(%rip),%rdx        # 8090 <sink>
+    19db:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    19df:	48 01 d0             	add    %rdx,%rax
+    19e2:	48 89 05 a7 66 00 00 	mov    %rax,0x66a7(%rip)        # 8090 <sink>
+    bench::report_per_item(name, t, n_lookups);
+    19e9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    19ed:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    19f1:	ba 00 09 3d 00       	mov    $0x3d0900,%edx
+    19f6:	48 89 ce             	mov    %rcx,%rsi
+    19f9:	48 89 c7             	mov    %rax,%rdi
+    19fc:	e8 be 01 00 00       	call   1bbf <bench::report_per_item(char const*, unsigned long, unsigned long)>
+}
+    1a01:	90                   	nop
+    1a02:	c9                   	leave
+    1a03:	c3                   	ret
+
+0000000000001a04 <run<main::{lambda(int)#3}>(char const*, unsigned long, main::{lambda(int)#3}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    1a04:	       55                   	push   %rbp
+    1a05:	       48 89 e5             	mov    %rsp,%rbp
+    1a08:	       48 83 ec 20          	sub    $0x20,%rsp
+    1a0c:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index i = 0; i < n_lookups; ++i) {
+    1a10:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1a17:	       00 
+    1a18:	   /-- eb 63                	jmp    1a7d <run<main::{lambda(int)#3}>(char const*, unsigned long, main::{lambda(int)#3}&&)::{lambda()#1}::operator()() const+0x79>
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    1a1a:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a1e:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+            int const key = int(next_rand(seed) % (2 * n));
+    1a22:	|  |   48 89 c7             	mov    %rax,%rdi
+    1a25:	|  |   e8 51 f8 ff ff       	call   127b <next_rand(unsigned int&)>
+    1a2a:	|  |   89 c2                	mov    %eax,%edx
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    1a2c:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a30:	|  |   48 8b 40 18          	mov    0x18(%rax),%rax
+            int const key = int(next_rand(seed) % (2 * n));
+    1a34:	|  |   48 8d 0c 00          	lea    (%rax,%rax,1),%rcx
+    1a38:	|  |   48 89 d0             	mov    %rdx,%rax
+    1a3b:	|  |   ba 00 00 00 00       	mov    $0x0,%edx
+    1a40:	|  |   48 f7 f1             	div    %rcx
+    1a43:	|  |   48 89 d0             	mov    %rdx,%rax
+    1a46:	|  |   89 45 f4             	mov    %eax,-0xc(%rbp)
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    1a49:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a4d:	|  |   48 8b 40 08          	mov    0x8(%rax),%rax
+            r += f(key);
+    1a51:	|  |   8b 55 f4             	mov    -0xc(%rbp),%edx
+    1a54:	|  |   89 d6                	mov    %edx,%esi
+    1a56:	|  |   48 89 c7             	mov    %rax,%rdi
+    1a59:	|  |   e8 0e fa ff ff       	call   146c <main::{lambda(int)#3}::operator()(int) const>
+    1a5e:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    1a61:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a65:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(key);
+    1a68:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    1a6b:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a6f:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += f(key);
+    1a72:	|  |   48 01 ca             	add    %rcx,%rdx
+    1a75:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index i = 0; i < n_lookups; ++i) {
+    1a78:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1a7d:	|  \-> 48 81 7d f8 ff 08 3d 	cmpq   $0x3d08ff,-0x8(%rbp)
+    1a84:	|      00 
+    1a85:	\----- 76 93                	jbe    1a1a <run<main::{lambda(int)#3}>(char const*, unsigned long, main::{lambda(int)#3}&&)::{lambda()#1}::operator()() const+0x16>
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    1a87:	       90                   	nop
+    1a88:	       90                   	nop
+    1a89:	       c9                   	leave
+    1a8a:	       c3                   	ret
+
+0000000000001a8b <void run<main::{lambda(int)#3}>(char const*, unsigned long, main::{lambda(int)#3}&&)>:
+void run(char const *const name, nel::Length const n, F &&f)
+    1a8b:	55                   	push   %rbp
+    1a8c:	48 89 e5             	mov    %rsp,%rbp
+    1a8f:	48 83 ec 60          	sub    $0x60,%rsp
+    1a93:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    1a97:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    1a9b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    unsigned int seed = 0x9e3779b9;
+    1a9f:	c7 45 cc b9 79 37 9e 	movl   $0x9e3779b9,-0x34(%rbp)
+    long unsigned int r = 0;
+    1aa6:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+    1aad:	00 
+    auto t = bench::time_ns([&r, &f, &seed, n]() {
+    1aae:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1ab2:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    1ab6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1aba:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    1abe:	48 8d 45 cc          	lea    -0x34(%rbp),%rax
+    1ac2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1ac6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1aca:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1ace:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1ad2:	48 89 c7             	mov    %rax,%rdi
+    1ad5:	e8 8c 00 00 00       	call   1b66 <unsigned long bench::time_ns<run<main::{lambda(int)#3}>(char const*, unsigned long, main::{lambda(int)#3}&&)::{lambda()#1}>(main::{lambda(int)#3}&&)>
+    1ada:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    sink = sink + r;
+    1ade:	48 8b 15 ab 65 00 00 	mov    0x65ab(%rip),%rdx        # 8090 <sink>
+    1ae5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1ae9:	48 01 d0             	add    %rdx,%rax
+    1aec:	48 89 05 9d 65 00 00 	mov    %rax,0x659d(%rip)        # 8090 <sink>
+    bench::report_per_item(name, t, n_lookups);
+    1af3:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1af7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    1afb:	ba 00 09 3d 00       	mov    $0x3d0900,%edx
+    1b00:	48 89 ce             	mov    %rcx,%rsi
+    1b03:	48 89 c7             	mov    %rax,%rdi
+    1b06:	e8 b4 00 00 00       	call   1bbf <bench::report_per_item(char const*, unsigned long, unsigned long)>
+}
+    1b0b:	90                   	nop
+    1b0c:	c9                   	leave
+    1b0d:	c3                   	ret
+
+0000000000001b0e <unsigned long bench::time_ns<run<main::{lambda(int)#1}>(char const*, unsigned long, main::{lambda(int)#1}&&)::{lambda()#1}>(main::{lambda(int)#1}&&)>:
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+}
+
+// Time a run of f(), in ns.
+template<typename F>
+long unsigned int time_ns(F &&f)
+    1b0e:	55                   	push   %rbp
+    1b0f:	48 89 e5             	mov    %rsp,%rbp
+    1b12:	48 83 ec 20          	sub    $0x20,%rsp
+    1b16:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+{
+    long unsigned int const b = now_ns();
+    1b1a:	e8 73 00 00 00       	call   1b92 <bench::now_ns()>
+    1b1f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    1b23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b27:	48 89 c7             	mov    %rax,%rdi
+    1b2a:	e8 c1 fc ff ff       	call   17f0 <run<main::{lambda(int)#1}>(char const*, unsigned long, main::{lambda(int)#1}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    1b2f:	e8 5e 00 00 00       	call   1b92 <bench::now_ns()>
+    1b34:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    1b38:	c9                   	leave
+    1b39:	c3                   	ret
+
+0000000000001b3a <unsigned long bench::time_ns<run<main::{lambda(int)#2}>(char const*, unsigned long, main::{lambda(int)#2}&&)::{lambda()#1}>(main::{lambda(int)#2}&&)>:
+long unsigned int time_ns(F &&f)
+    1b3a:	55                   	push   %rbp
+    1b3b:	48 89 e5             	mov    %rsp,%rbp
+    1b3e:	48 83 ec 20          	sub    $0x20,%rsp
+    1b42:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    1b46:	e8 47 00 00 00       	call   1b92 <bench::now_ns()>
+    1b4b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    1b4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b53:	48 89 c7             	mov    %rax,%rdi
+    1b56:	e8 9f fd ff ff       	call   18fa <run<main::{lambda(int)#2}>(char const*, unsigned long, main::{lambda(int)#2}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    1b5b:	e8 32 00 00 00       	call   1b92 <bench::now_ns()>
+    1b60:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    1b64:	c9                   	leave
+    1b65:	c3                   	ret
+
+0000000000001b66 <unsigned long bench::time_ns<run<main::{lambda(int)#3}>(char const*, unsigned long, main::{lambda(int)#3}&&)::{lambda()#1}>(main::{lambda(int)#3}&&)>:
+long unsigned int time_ns(F &&f)
+    1b66:	55                   	push   %rbp
+    1b67:	48 89 e5             	mov    %rsp,%rbp
+    1b6a:	48 83 ec 20          	sub    $0x20,%rsp
+    1b6e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    1b72:	e8 1b 00 00 00       	call   1b92 <bench::now_ns()>
+    1b77:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    1b7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b7f:	48 89 c7             	mov    %rax,%rdi
+    1b82:	e8 7d fe ff ff       	call   1a04 <run<main::{lambda(int)#3}>(char const*, unsigned long, main::{lambda(int)#3}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    1b87:	e8 06 00 00 00       	call   1b92 <bench::now_ns()>
+    1b8c:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    1b90:	c9                   	leave
+    1b91:	c3                   	ret
+
+0000000000001b92 <bench::now_ns()>:
+static constexpr nel::Length sizes[] = {
+    1b92:	55                   	push   %rbp
+    1b93:	48 89 e5             	mov    %rsp,%rbp
+    1b96:	48 83 ec 10          	sub    $0x10,%rsp
+};
+    1b9a:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1b9e:	48 89 c6             	mov    %rax,%rsi
+    1ba1:	bf 01 00 00 00       	mov    $0x1,%edi
+    1ba6:	e8 a5 f4 ff ff       	call   1050 <clock_gettime@plt>
+
+    1bab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1baf:	48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+    1bb6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1bba:	48 01 d0             	add    %rdx,%rax
+// above this, a linear scan would take all day.
+    1bbd:	c9                   	leave
+    1bbe:	c3                   	ret
+
+0000000000001bbf <bench::report_per_item(char const*, unsigned long, unsigned long)>:
+    sink = sink + r;
+    1bbf:	       55                   	push   %rbp
+    1bc0:	       48 89 e5             	mov    %rsp,%rbp
+    1bc3:	       48 83 ec 30          	sub    $0x30,%rsp
+    1bc7:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1bcb:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1bcf:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    bench::report_per_item(name, t, n_lookups);
+    1bd3:	       48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    1bd8:	/----- 74 28                	je     1c02 <bench::report_per_item(char const*, unsigned long, unsigned long)+0x43>
+    1bda:	|      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1bde:	|      48 89 d0             	mov    %rdx,%rax
+    1be1:	|      48 c1 e0 02          	shl    $0x2,%rax
+    1be5:	|      48 01 d0             	add    %rdx,%rax
+    1be8:	|      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bef:	|      00 
+    1bf0:	|      48 01 d0             	add    %rdx,%rax
+    1bf3:	|      48 c1 e0 02          	shl    $0x2,%rax
+    1bf7:	|      ba 00 00 00 00       	mov    $0x0,%edx
+    1bfc:	|      48 f7 75 d8          	divq   -0x28(%rbp)
+    1c00:	|  /-- eb 05                	jmp    1c07 <bench::report_per_item(char const*, unsigned long, unsigned long)+0x48>
+    1c02:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    1c07:	   \-> 48 89 45 f8          	mov    %rax,-0x8(%rbp)
+}
+    1c0b:	       48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1c0f:	       48 89 c8             	mov    %rcx,%rax
+    1c12:	       48 c1 e8 02          	shr    $0x2,%rax
+    1c16:	       48 ba c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rdx
+    1c1d:	       c2 f5 28 
+    1c20:	       48 f7 e2             	mul    %rdx
+    1c23:	       48 c1 ea 02          	shr    $0x2,%rdx
+    1c27:	       48 89 d0             	mov    %rdx,%rax
+    1c2a:	       48 c1 e0 02          	shl    $0x2,%rax
+    1c2e:	       48 01 d0             	add    %rdx,%rax
+    1c31:	       48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c38:	       00 
+    1c39:	       48 01 d0             	add    %rdx,%rax
+    1c3c:	       48 c1 e0 02          	shl    $0x2,%rax
+    1c40:	       48 29 c1             	sub    %rax,%rcx
+    1c43:	       48 89 ca             	mov    %rcx,%rdx
+    1c46:	       48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+int main()
+    1c4a:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c4e:	       48 89 c6             	mov    %rax,%rsi
+    1c51:	       48 8d 05 40 64 00 00 	lea    0x6440(%rip),%rax        # 8098 <nel::log>
+    1c58:	       48 89 c7             	mov    %rax,%rdi
+    1c5b:	       e8 09 29 00 00       	call   4569 <nel::operator<<(nel::Log&, char const*)>
+    1c60:	       48 89 c2             	mov    %rax,%rdx
+    1c63:	       48 8d 05 b6 33 00 00 	lea    0x33b6(%rip),%rax        # 5020 <_IO_stdin_used+0x20>
+    1c6a:	       48 89 c6             	mov    %rax,%rsi
+    1c6d:	       48 89 d7             	mov    %rdx,%rdi
+    1c70:	       e8 f4 28 00 00       	call   4569 <nel::operator<<(nel::Log&, char const*)>
+    1c75:	       48 89 c1             	mov    %rax,%rcx
+    1c78:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c7c:	       48 c1 e8 02          	shr    $0x2,%rax
+    1c80:	       48 ba c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rdx
+    1c87:	       c2 f5 28 
+    1c8a:	       48 f7 e2             	mul    %rdx
+    1c8d:	       48 89 d0             	mov    %rdx,%rax
+    1c90:	       48 c1 e8 02          	shr    $0x2,%rax
+    1c94:	       48 89 c6             	mov    %rax,%rsi
+    1c97:	       48 89 cf             	mov    %rcx,%rdi
+    1c9a:	       e8 d5 29 00 00       	call   4674 <nel::operator<<(nel::Log&, unsigned long)>
+    1c9f:	       be 2e 00 00 00       	mov    $0x2e,%esi
+    1ca4:	       48 89 c7             	mov    %rax,%rdi
+    1ca7:	       e8 91 28 00 00       	call   453d <nel::operator<<(nel::Log&, char)>
+    1cac:	       48 89 c2             	mov    %rax,%rdx
+    1caf:	       48 83 7d f0 09       	cmpq   $0x9,-0x10(%rbp)
+    1cb4:	/----- 77 09                	ja     1cbf <bench::report_per_item(char const*, unsigned long, unsigned long)+0x100>
+    1cb6:	|      48 8d 05 66 33 00 00 	lea    0x3366(%rip),%rax        # 5023 <_IO_stdin_used+0x23>
+    1cbd:	|  /-- eb 07                	jmp    1cc6 <bench::report_per_item(char const*, unsigned long, unsigned long)+0x107>
+    1cbf:	\--|-> 48 8d 05 5f 33 00 00 	lea    0x335f(%rip),%rax        # 5025 <_IO_stdin_used+0x25>
+    1cc6:	   \-> 48 89 c6             	mov    %rax,%rsi
+    1cc9:	       48 89 d7             	mov    %rdx,%rdi
+    1ccc:	       e8 98 28 00 00       	call   4569 <nel::operator<<(nel::Log&, char const*)>
+    1cd1:	       48 89 c2             	mov    %rax,%rdx
+    1cd4:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cd8:	       48 89 c6             	mov    %rax,%rsi
+    1cdb:	       48 89 d7             	mov    %rdx,%rdi
+    1cde:	       e8 91 29 00 00       	call   4674 <nel::operator<<(nel::Log&, unsigned long)>
+    1ce3:	       48 89 c2             	mov    %rax,%rdx
+    1ce6:	       48 8d 05 39 33 00 00 	lea    0x3339(%rip),%rax        # 5026 <_IO_stdin_used+0x26>
+    1ced:	       48 89 c6             	mov    %rax,%rsi
+    1cf0:	       48 89 d7             	mov    %rdx,%rdi
+    1cf3:	       e8 71 28 00 00       	call   4569 <nel::operator<<(nel::Log&, char const*)>
+{
+    1cf8:	       90                   	nop
+    1cf9:	       c9                   	leave
+    1cfa:	       c3                   	ret
+
+0000000000001cfb <operator new(unsigned long, void*)>:
+
+#    if !defined(TEST)
+// catch2 uses stdlib and so uses stdlib's new defn.
+// Operator new must not be in a namespace
+inline void *operator new(nel::USize, void *p)
+{
+    1cfb:	55                   	push   %rbp
+    1cfc:	48 89 e5             	mov    %rsp,%rbp
+    1cff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1d03:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return p;
+    1d07:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+    1d0b:	5d                   	pop    %rbp
+    1d0c:	c3                   	ret
+    1d0d:	90                   	nop
+
+0000000000001d0e <nel::Context::Context(char const*, char const*, int)>:
+        char const *fn_name_;
+        char const *file_name_;
+        int line_num_;
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+    1d0e:	55                   	push   %rbp
+    1d0f:	48 89 e5             	mov    %rsp,%rbp
+    1d12:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1d16:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1d1a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1d1e:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1d21:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d25:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1d29:	48 89 10             	mov    %rdx,(%rax)
+            , file_name_(file_name)
+    1d2c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d30:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1d34:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , line_num_(line_num)
+    1d38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d3c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1d3f:	89 50 10             	mov    %edx,0x10(%rax)
+        {
+        }
+    1d42:	90                   	nop
+    1d43:	5d                   	pop    %rbp
+    1d44:	c3                   	ret
+
+0000000000001d45 <nel::panic_if_not(bool, char const*, nel::Context const&)>:
+{
+    if (pred) { panic(msg, ctx); }
+}
+
+inline void panic_if_not(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    1d45:	    55                   	push   %rbp
+    1d46:	    48 89 e5             	mov    %rsp,%rbp
+    1d49:	    48 83 ec 20          	sub    $0x20,%rsp
+    1d4d:	    89 f8                	mov    %edi,%eax
+    1d4f:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1d53:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1d57:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { panic(msg, ctx); }
+    1d5a:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    1d5e:	    83 f0 01             	xor    $0x1,%eax
+    1d61:	    84 c0                	test   %al,%al
+    1d63:	/-- 74 13                	je     1d78 <nel::panic_if_not(bool, char const*, nel::Context const&)+0x33>
+    1d65:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1d69:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d6d:	|   48 89 d6             	mov    %rdx,%rsi
+    1d70:	|   48 89 c7             	mov    %rax,%rdi
+    1d73:	|   e8 b9 1e 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+}
+    1d78:	\-> 90                   	nop
+    1d79:	    c9                   	leave
+    1d7a:	    c3                   	ret
+
+0000000000001d7b <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>:
+        static Result<void *, AllocError> try_malloc(Length const align, Length const size)
+        {
+            return try_realloc(nullptr, align, 0, size);
+        }
+
+        static Result<void *, AllocError> try_realloc(void *const p,
+    1d7b:	          55                   	push   %rbp
+    1d7c:	          48 89 e5             	mov    %rsp,%rbp
+    1d7f:	          48 83 ec 40          	sub    $0x40,%rsp
+    1d83:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1d87:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1d8b:	          48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    1d8f:	          48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    1d93:	          4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+                                                      Length const align,
+                                                      Length const old_size,
+                                                      Length const new_size)
+        {
+            if (align == 0 || (align & (align - 1)) != 0) {
+    1d97:	          48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    1d9c:	      /-- 74 11                	je     1daf <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x34>
+    1d9e:	      |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1da2:	      |   48 83 e8 01          	sub    $0x1,%rax
+    1da6:	      |   48 23 45 d8          	and    -0x28(%rbp),%rax
+    1daa:	      |   48 85 c0             	test   %rax,%rax
+    1dad:	   /--|-- 74 1c                	je     1dcb <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x50>
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+    1daf:	   |  \-> c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+    1db6:	   |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1dba:	   |      48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    1dbe:	   |      48 89 d6             	mov    %rdx,%rsi
+    1dc1:	   |      48 89 c7             	mov    %rax,%rdi
+    1dc4:	   |      e8 45 02 00 00       	call   200e <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+                                    : std::realloc(p, new_size);
+            if (new_p == nullptr) {
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+            }
+            return Result<void *, AllocError>::Ok(new_p);
+        }
+    1dc9:	/--|----- eb 79                	jmp    1e44 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            void *const new_p = is_over_aligned(align)
+    1dcb:	|  \----> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1dcf:	|         48 89 c7             	mov    %rax,%rdi
+    1dd2:	|         e8 b4 00 00 00       	call   1e8b <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+                                    ? realloc_aligned(p, align, old_size, new_size)
+    1dd7:	|         84 c0                	test   %al,%al
+    1dd9:	|  /----- 74 1a                	je     1df5 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x7a>
+    1ddb:	|  |      48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+    1ddf:	|  |      48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1de3:	|  |      48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+    1de7:	|  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1deb:	|  |      48 89 c7             	mov    %rax,%rdi
+    1dee:	|  |      e8 45 25 00 00       	call   4338 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+    1df3:	|  |  /-- eb 13                	jmp    1e08 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x8d>
+                                    : std::realloc(p, new_size);
+    1df5:	|  \--|-> 48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    1df9:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1dfd:	|     |   48 89 d6             	mov    %rdx,%rsi
+    1e00:	|     |   48 89 c7             	mov    %rax,%rdi
+    1e03:	|     |   e8 b8 f2 ff ff       	call   10c0 <realloc@plt>
+    1e08:	|     \-> 48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            if (new_p == nullptr) {
+    1e0c:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e10:	|         48 85 c0             	test   %rax,%rax
+    1e13:	|     /-- 75 1c                	jne    1e31 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xb6>
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+    1e15:	|     |   c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1e1c:	|     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e20:	|     |   48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    1e24:	|     |   48 89 d6             	mov    %rdx,%rsi
+    1e27:	|     |   48 89 c7             	mov    %rax,%rdi
+    1e2a:	|     |   e8 df 01 00 00       	call   200e <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+        }
+    1e2f:	+-----|-- eb 13                	jmp    1e44 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            return Result<void *, AllocError>::Ok(new_p);
+    1e31:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e35:	|         48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    1e39:	|         48 89 d6             	mov    %rdx,%rsi
+    1e3c:	|         48 89 c7             	mov    %rax,%rdi
+    1e3f:	|         e8 fe 01 00 00       	call   2042 <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>
+        }
+    1e44:	\-------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e48:	          c9                   	leave
+    1e49:	          c3                   	ret
+
+0000000000001e4a <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>:
+
+        static void free(void *const p, Length const align, Length const size)
+    1e4a:	       55                   	push   %rbp
+    1e4b:	       48 89 e5             	mov    %rsp,%rbp
+    1e4e:	       48 83 ec 20          	sub    $0x20,%rsp
+    1e52:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1e56:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1e5a:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+    1e5e:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e62:	       48 89 c7             	mov    %rax,%rdi
+    1e65:	       e8 21 00 00 00       	call   1e8b <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+    1e6a:	       84 c0                	test   %al,%al
+    1e6c:	/----- 74 0e                	je     1e7c <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x32>
+                free_aligned(p);
+    1e6e:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e72:	|      48 89 c7             	mov    %rax,%rdi
+    1e75:	|      e8 7a 24 00 00       	call   42f4 <nel::free_aligned(void*)>
+            } else {
+                std::free(p);
+            }
+        }
+    1e7a:	|  /-- eb 0c                	jmp    1e88 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x3e>
+                std::free(p);
+    1e7c:	\--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e80:	   |   48 89 c7             	mov    %rax,%rdi
+    1e83:	   |   e8 a8 f1 ff ff       	call   1030 <free@plt>
+        }
+    1e88:	   \-> 90                   	nop
+    1e89:	       c9                   	leave
+    1e8a:	       c3                   	ret
+
+0000000000001e8b <nel::heaped::Malloc::is_over_aligned(unsigned long)>:
+
+    private:
+        static constexpr bool is_over_aligned(Length const align)
+    1e8b:	55                   	push   %rbp
+    1e8c:	48 89 e5             	mov    %rsp,%rbp
+    1e8f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return align > alignof(std::max_align_t);
+    1e93:	48 83 7d f8 10       	cmpq   $0x10,-0x8(%rbp)
+    1e98:	0f 97 c0             	seta   %al
+        }
+    1e9b:	5d                   	pop    %rbp
+    1e9c:	c3                   	ret
+    1e9d:	90                   	nop
+
+0000000000001e9e <nel::Slice<int>::ptr() const>:
+        /**
+         * Determine numer of elements in the slice.
+         *
+         * @returns number of elements in the slice.
+         */
+        constexpr Type *ptr(void) const
+    1e9e:	55                   	push   %rbp
+    1e9f:	48 89 e5             	mov    %rsp,%rbp
+    1ea2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return content_;
+    1ea6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1eaa:	48 8b 00             	mov    (%rax),%rax
+        }
+    1ead:	5d                   	pop    %rbp
+    1eae:	c3                   	ret
+    1eaf:	90                   	nop
+
+0000000000001eb0 <nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#1}::operator()(unsigned long const&) const>:
+         */
+        constexpr bool is_ok(Context const &ctx = Context()) const
+        {
+            // min-size: gets optimised + inlined at call site.
+            // release: gets optimised away..
+            return match<bool>([](T const &) -> bool { return true; },
+    1eb0:	55                   	push   %rbp
+    1eb1:	48 89 e5             	mov    %rsp,%rbp
+    1eb4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1eb8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1ebc:	b8 01 00 00 00       	mov    $0x1,%eax
+    1ec1:	5d                   	pop    %rbp
+    1ec2:	c3                   	ret
+    1ec3:	90                   	nop
+
+0000000000001ec4 <nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#2}::operator()(unsigned long const&) const>:
+                               [](E const &) -> bool { return false; },
+    1ec4:	55                   	push   %rbp
+    1ec5:	48 89 e5             	mov    %rsp,%rbp
+    1ec8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1ecc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ed5:	5d                   	pop    %rbp
+    1ed6:	c3                   	ret
+    1ed7:	90                   	nop
+
+0000000000001ed8 <nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const>:
+        constexpr bool is_ok(Context const &ctx = Context()) const
+    1ed8:	55                   	push   %rbp
+    1ed9:	48 89 e5             	mov    %rsp,%rbp
+    1edc:	48 83 ec 20          	sub    $0x20,%rsp
+    1ee0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1ee4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](T const &) -> bool { return true; },
+    1ee8:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1eec:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    1ef0:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    1ef4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ef8:	48 89 c7             	mov    %rax,%rdi
+    1efb:	e8 02 00 00 00       	call   1f02 <bool nel::Result<unsigned long, unsigned long>::match<bool, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#1}, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#2}>(nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#1}&&, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#2}&&, nel::Context const&) const>
+                               ctx);
+        }
+    1f00:	c9                   	leave
+    1f01:	c3                   	ret
+
+0000000000001f02 <bool nel::Result<unsigned long, unsigned long>::match<bool, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#1}, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#2}>(nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#1}&&, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    1f02:	             55                   	push   %rbp
+    1f03:	             48 89 e5             	mov    %rsp,%rbp
+    1f06:	             48 83 ec 20          	sub    $0x20,%rsp
+    1f0a:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f0e:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1f12:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1f16:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result-match
+    1f1a:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f1e:	             8b 00                	mov    (%rax),%eax
+    1f20:	             83 f8 02             	cmp    $0x2,%eax
+    1f23:	         /-- 74 32                	je     1f57 <bool nel::Result<unsigned long, unsigned long>::match<bool, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#1}, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#2}>(nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#1}&&, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#2}&&, nel::Context const&) const+0x55>
+    1f25:	         |   83 f8 02             	cmp    $0x2,%eax
+    1f28:	/--------|-- 7f 67                	jg     1f91 <bool nel::Result<unsigned long, unsigned long>::match<bool, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#1}, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#2}>(nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#1}&&, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#2}&&, nel::Context const&) const+0x8f>
+    1f2a:	|        |   85 c0                	test   %eax,%eax
+    1f2c:	|     /--|-- 74 4d                	je     1f7b <bool nel::Result<unsigned long, unsigned long>::match<bool, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#1}, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#2}>(nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#1}&&, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#2}&&, nel::Context const&) const+0x79>
+    1f2e:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    1f31:	+-----|--|-- 75 5e                	jne    1f91 <bool nel::Result<unsigned long, unsigned long>::match<bool, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#1}, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#2}>(nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#1}&&, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_ok(*ok_);
+    1f33:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f37:	|     |  |   48 83 c0 08          	add    $0x8,%rax
+    1f3b:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    1f3e:	|     |  |   e8 33 06 00 00       	call   2576 <nel::Element<unsigned long>::operator*() const>
+    1f43:	|     |  |   48 89 c2             	mov    %rax,%rdx
+    1f46:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f4a:	|     |  |   48 89 d6             	mov    %rdx,%rsi
+    1f4d:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    1f50:	|     |  |   e8 5b ff ff ff       	call   1eb0 <nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#1}::operator()(unsigned long const&) const>
+    1f55:	|  /--|--|-- eb 50                	jmp    1fa7 <bool nel::Result<unsigned long, unsigned long>::match<bool, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#1}, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#2}>(nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#1}&&, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#2}&&, nel::Context const&) const+0xa5>
+                    return on_err(*err_);
+    1f57:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f5b:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    1f5f:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1f62:	|  |  |      e8 0f 06 00 00       	call   2576 <nel::Element<unsigned long>::operator*() const>
+    1f67:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    1f6a:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f6e:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    1f71:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1f74:	|  |  |      e8 4b ff ff ff       	call   1ec4 <nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#2}::operator()(unsigned long const&) const>
+    1f79:	|  +--|----- eb 2c                	jmp    1fa7 <bool nel::Result<unsigned long, unsigned long>::match<bool, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#1}, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#2}>(nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#1}&&, nel::Result<unsigned long, unsigned long>::is_ok(nel::Context const&) const::{lambda(unsigned long const&)#2}&&, nel::Context const&) const+0xa5>
+                    nel::panic("invalid Result", ctx);
+    1f7b:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f7f:	|  |         48 89 c6             	mov    %rax,%rsi
+    1f82:	|  |         48 8d 05 0f 31 00 00 	lea    0x310f(%rip),%rax        # 5098 <max_linear+0x8>
+    1f89:	|  |         48 89 c7             	mov    %rax,%rdi
+    1f8c:	|  |         e8 a0 1c 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    1f91:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f95:	   |         48 89 c6             	mov    %rax,%rsi
+    1f98:	   |         48 8d 05 08 31 00 00 	lea    0x3108(%rip),%rax        # 50a7 <max_linear+0x17>
+    1f9f:	   |         48 89 c7             	mov    %rax,%rdi
+    1fa2:	   |         e8 8a 1c 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+        }
+    1fa7:	   \-------> c9                   	leave
+    1fa8:	             c3                   	ret
+    1fa9:	             90                   	nop
+
+0000000000001faa <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+        constexpr ~Result(void)
+    1faa:	             55                   	push   %rbp
+    1fab:	             48 89 e5             	mov    %rsp,%rbp
+    1fae:	             48 83 ec 30          	sub    $0x30,%rsp
+    1fb2:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+            switch (tag_) { // result::dtor
+    1fb6:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1fba:	             8b 00                	mov    (%rax),%eax
+    1fbc:	             83 f8 02             	cmp    $0x2,%eax
+    1fbf:	/----------- 74 43                	je     2004 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5a>
+    1fc1:	|            83 f8 02             	cmp    $0x2,%eax
+    1fc4:	|        /-- 7f 09                	jg     1fcf <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x25>
+    1fc6:	|        |   85 c0                	test   %eax,%eax
+    1fc8:	|  /-----|-- 74 3d                	je     2007 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5d>
+    1fca:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    1fcd:	|  |  /--|-- 74 3b                	je     200a <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x60>
+                    nel::panic("bad Result");
+    1fcf:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1fd3:	|  |  |      b9 72 00 00 00       	mov    $0x72,%ecx
+    1fd8:	|  |  |      48 8d 15 53 31 00 00 	lea    0x3153(%rip),%rdx        # 5132 <max_linear+0xa2>
+    1fdf:	|  |  |      48 8d 35 5e 31 00 00 	lea    0x315e(%rip),%rsi        # 5144 <max_linear+0xb4>
+    1fe6:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1fe9:	|  |  |      e8 20 fd ff ff       	call   1d0e <nel::Context::Context(char const*, char const*, int)>
+    1fee:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1ff2:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    1ff5:	|  |  |      48 8d 05 ab 30 00 00 	lea    0x30ab(%rip),%rax        # 50a7 <max_linear+0x17>
+    1ffc:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1fff:	|  |  |      e8 2d 1c 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    2004:	\--|--|----> 90                   	nop
+    2005:	   |  |  /-- eb 04                	jmp    200b <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    2007:	   \--|--|-> 90                   	nop
+    2008:	      |  +-- eb 01                	jmp    200b <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    200a:	      \--|-> 90                   	nop
+        }
+    200b:	         \-> 90                   	nop
+    200c:	             c9                   	leave
+    200d:	             c3                   	ret
+
+000000000000200e <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>:
+        constexpr static Result Err(E &&val)
+    200e:	55                   	push   %rbp
+    200f:	48 89 e5             	mov    %rsp,%rbp
+    2012:	48 83 ec 10          	sub    $0x10,%rsp
+    2016:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    201a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<E>(val));
+    201e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2022:	48 89 c7             	mov    %rax,%rdi
+    2025:	e8 25 07 00 00       	call   274f <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    202a:	48 89 c2             	mov    %rax,%rdx
+    202d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2031:	48 89 d6             	mov    %rdx,%rsi
+    2034:	48 89 c7             	mov    %rax,%rdi
+    2037:	e8 22 07 00 00       	call   275e <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>
+        }
+    203c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2040:	c9                   	leave
+    2041:	c3                   	ret
+
+0000000000002042 <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>:
+        constexpr static Result Ok(Args &&...args)
+    2042:	55                   	push   %rbp
+    2043:	48 89 e5             	mov    %rsp,%rbp
+    2046:	48 83 ec 10          	sub    $0x10,%rsp
+    204a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    204e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<Args>(args)...);
+    2052:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2056:	48 89 c7             	mov    %rax,%rdi
+    2059:	e8 41 07 00 00       	call   279f <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    205e:	48 89 c2             	mov    %rax,%rdx
+    2061:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2065:	48 89 d6             	mov    %rdx,%rsi
+    2068:	48 89 c7             	mov    %rax,%rdi
+    206b:	e8 3e 07 00 00       	call   27ae <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>
+        }
+    2070:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2074:	c9                   	leave
+    2075:	c3                   	ret
+
+0000000000002076 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>:
+         *
+         * @param initial The number of elements to initially allocate.
+         *
+         * @returns the vector.
+         */
+        static constexpr Vector with_capacity(Count cap)
+    2076:	       55                   	push   %rbp
+    2077:	       48 89 e5             	mov    %rsp,%rbp
+    207a:	       48 83 ec 20          	sub    $0x20,%rsp
+    207e:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2082:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            if (cap == 0) { return Vector(); }
+    2086:	       48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    208b:	   /-- 75 0e                	jne    209b <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x25>
+    208d:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2091:	   |   48 89 c7             	mov    %rax,%rdi
+    2094:	   |   e8 57 07 00 00       	call   27f0 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector()>
+    2099:	/--|-- eb 3d                	jmp    20d8 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x62>
+            Vector a(VectorNode::malloc(cap));
+    209b:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    209f:	|      48 89 c7             	mov    %rax,%rdi
+    20a2:	|      e8 5f 07 00 00       	call   2806 <nel::heaped::Node<int, nel::heaped::Malloc>::malloc(unsigned long)>
+    20a7:	|      48 89 c2             	mov    %rax,%rdx
+    20aa:	|      48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    20ae:	|      48 89 d6             	mov    %rdx,%rsi
+    20b1:	|      48 89 c7             	mov    %rax,%rdi
+    20b4:	|      e8 87 07 00 00       	call   2840 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Node<int, nel::heaped::Malloc>*)>
+            return a;
+    20b9:	|      48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    20bd:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20c1:	|      48 89 d6             	mov    %rdx,%rsi
+    20c4:	|      48 89 c7             	mov    %rax,%rdi
+    20c7:	|      e8 8e 07 00 00       	call   285a <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >&&)>
+        }
+    20cc:	|      48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    20d0:	|      48 89 c7             	mov    %rax,%rdi
+    20d3:	|      e8 06 00 00 00       	call   20de <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    20d8:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20dc:	       c9                   	leave
+    20dd:	       c3                   	ret
+
+00000000000020de <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>:
+        ~Vector(void)
+    20de:	55                   	push   %rbp
+    20df:	48 89 e5             	mov    %rsp,%rbp
+    20e2:	48 83 ec 10          	sub    $0x10,%rsp
+    20e6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            VectorNode::free(item_);
+    20ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20ee:	48 8b 00             	mov    (%rax),%rax
+    20f1:	48 89 c7             	mov    %rax,%rdi
+    20f4:	e8 ab 07 00 00       	call   28a4 <nel::heaped::Node<int, nel::heaped::Malloc>::free(nel::heaped::Node<int, nel::heaped::Malloc>*)>
+        }
+    20f9:	90                   	nop
+    20fa:	c9                   	leave
+    20fb:	c3                   	ret
+
+00000000000020fc <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>:
+         *
+         * @param val The value to move into the vec.
+         * @returns if successful, Result<void, T>::Ok()
+         * @returns if unsuccessful, Result<void, T>::Err() holding val
+         */
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+    20fc:	       55                   	push   %rbp
+    20fd:	       48 89 e5             	mov    %rsp,%rbp
+    2100:	       48 83 ec 30          	sub    $0x30,%rsp
+    2104:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2108:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    210c:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+        {
+            bool ok;
+            ok = try_reserve_for(1);
+    2110:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2114:	       be 01 00 00 00       	mov    $0x1,%esi
+    2119:	       48 89 c7             	mov    %rax,%rdi
+    211c:	       e8 cf 07 00 00       	call   28f0 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>
+    2121:	       88 45 ff             	mov    %al,-0x1(%rbp)
+            if (!ok) { return Result<void, Type>::Err(val); }
+    2124:	       0f b6 45 ff          	movzbl -0x1(%rbp),%eax
+    2128:	       83 f0 01             	xor    $0x1,%eax
+    212b:	       84 c0                	test   %al,%al
+    212d:	   /-- 74 15                	je     2144 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x48>
+    212f:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2133:	   |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2137:	   |   48 89 d6             	mov    %rdx,%rsi
+    213a:	   |   48 89 c7             	mov    %rax,%rdi
+    213d:	   |   e8 19 08 00 00       	call   295b <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    2142:	/--|-- eb 3b                	jmp    217f <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x83>
+            if (item_ == nullptr) { return Result<void, Type>::Err(val); }
+    2144:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2148:	|      48 8b 00             	mov    (%rax),%rax
+    214b:	|      48 85 c0             	test   %rax,%rax
+    214e:	|  /-- 75 15                	jne    2165 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x69>
+    2150:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2154:	|  |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2158:	|  |   48 89 d6             	mov    %rdx,%rsi
+    215b:	|  |   48 89 c7             	mov    %rax,%rdi
+    215e:	|  |   e8 f8 07 00 00       	call   295b <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    2163:	+--|-- eb 1a                	jmp    217f <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x83>
+            return item_->push_back(val);
+    2165:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2169:	|      48 8b 08             	mov    (%rax),%rcx
+    216c:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2170:	|      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2174:	|      48 89 ce             	mov    %rcx,%rsi
+    2177:	|      48 89 c7             	mov    %rax,%rdi
+    217a:	|      e8 11 08 00 00       	call   2990 <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int&>(int&)>
+        }
+    217f:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2183:	       c9                   	leave
+    2184:	       c3                   	ret
+    2185:	       90                   	nop
+
+0000000000002186 <nel::Result<void, int>::~Result()>:
+        union {
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    2186:	             55                   	push   %rbp
+    2187:	             48 89 e5             	mov    %rsp,%rbp
+    218a:	             48 83 ec 30          	sub    $0x30,%rsp
+    218e:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result<void>-dtor
+    2192:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2196:	             8b 00                	mov    (%rax),%eax
+    2198:	             83 f8 02             	cmp    $0x2,%eax
+    219b:	/----------- 74 43                	je     21e0 <nel::Result<void, int>::~Result()+0x5a>
+    219d:	|            83 f8 02             	cmp    $0x2,%eax
+    21a0:	|        /-- 7f 09                	jg     21ab <nel::Result<void, int>::~Result()+0x25>
+    21a2:	|        |   85 c0                	test   %eax,%eax
+    21a4:	|  /-----|-- 74 3d                	je     21e3 <nel::Result<void, int>::~Result()+0x5d>
+    21a6:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    21a9:	|  |  /--|-- 74 3b                	je     21e6 <nel::Result<void, int>::~Result()+0x60>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    21ab:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    21af:	|  |  |      b9 dd 02 00 00       	mov    $0x2dd,%ecx
+    21b4:	|  |  |      48 8d 15 77 2f 00 00 	lea    0x2f77(%rip),%rdx        # 5132 <max_linear+0xa2>
+    21bb:	|  |  |      48 8d 35 82 2f 00 00 	lea    0x2f82(%rip),%rsi        # 5144 <max_linear+0xb4>
+    21c2:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    21c5:	|  |  |      e8 44 fb ff ff       	call   1d0e <nel::Context::Context(char const*, char const*, int)>
+    21ca:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    21ce:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    21d1:	|  |  |      48 8d 05 cf 2e 00 00 	lea    0x2ecf(%rip),%rax        # 50a7 <max_linear+0x17>
+    21d8:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    21db:	|  |  |      e8 51 1a 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    21e0:	\--|--|----> 90                   	nop
+    21e1:	   |  |  /-- eb 04                	jmp    21e7 <nel::Result<void, int>::~Result()+0x61>
+                    break;
+    21e3:	   \--|--|-> 90                   	nop
+    21e4:	      |  +-- eb 01                	jmp    21e7 <nel::Result<void, int>::~Result()+0x61>
+                    break;
+    21e6:	      \--|-> 90                   	nop
+                    break;
+            }
+        }
+    21e7:	         \-> 90                   	nop
+    21e8:	             c9                   	leave
+    21e9:	             c3                   	ret
+
+00000000000021ea <nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}::operator()() const>:
+         *
+         * `this` is consumed by the operation.
+         */
+        constexpr void unwrap(Context const &ctx = Context())
+        {
+            return consumev([](void) {}, [](E &&) { nel::panic("not an ok"); }, ctx);
+    21ea:	55                   	push   %rbp
+    21eb:	48 89 e5             	mov    %rsp,%rbp
+    21ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    21f2:	90                   	nop
+    21f3:	5d                   	pop    %rbp
+    21f4:	c3                   	ret
+    21f5:	90                   	nop
+
+00000000000021f6 <nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}::operator()(int&&) const>:
+    21f6:	55                   	push   %rbp
+    21f7:	48 89 e5             	mov    %rsp,%rbp
+    21fa:	48 83 ec 30          	sub    $0x30,%rsp
+    21fe:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    2202:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    2206:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    220a:	b9 1f 04 00 00       	mov    $0x41f,%ecx
+    220f:	48 8d 15 1c 2f 00 00 	lea    0x2f1c(%rip),%rdx        # 5132 <max_linear+0xa2>
+    2216:	48 8d 35 ae 2e 00 00 	lea    0x2eae(%rip),%rsi        # 50cb <max_linear+0x3b>
+    221d:	48 89 c7             	mov    %rax,%rdi
+    2220:	e8 e9 fa ff ff       	call   1d0e <nel::Context::Context(char const*, char const*, int)>
+    2225:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2229:	48 89 c6             	mov    %rax,%rsi
+    222c:	48 8d 05 19 2f 00 00 	lea    0x2f19(%rip),%rax        # 514c <max_linear+0xbc>
+    2233:	48 89 c7             	mov    %rax,%rdi
+    2236:	e8 f6 19 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+    223b:	90                   	nop
+
+000000000000223c <nel::Result<void, int>::unwrap(nel::Context const&)>:
+        constexpr void unwrap(Context const &ctx = Context())
+    223c:	55                   	push   %rbp
+    223d:	48 89 e5             	mov    %rsp,%rbp
+    2240:	48 83 ec 20          	sub    $0x20,%rsp
+    2244:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2248:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return consumev([](void) {}, [](E &&) { nel::panic("not an ok"); }, ctx);
+    224c:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2250:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    2254:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    2258:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    225c:	48 89 c7             	mov    %rax,%rdi
+    225f:	e8 f0 07 00 00       	call   2a54 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)>
+    2264:	90                   	nop
+        }
+    2265:	c9                   	leave
+    2266:	c3                   	ret
+    2267:	90                   	nop
+
+0000000000002268 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice(unsigned long, unsigned long)>:
+        constexpr Slice<Type> slice(Index b, Index e)
+    2268:	55                   	push   %rbp
+    2269:	48 89 e5             	mov    %rsp,%rbp
+    226c:	48 83 ec 30          	sub    $0x30,%rsp
+    2270:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2274:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2278:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    227c:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            return slice().slice(b, e);
+    2280:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    2284:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2288:	48 89 d6             	mov    %rdx,%rsi
+    228b:	48 89 c7             	mov    %rax,%rdi
+    228e:	e8 6d 08 00 00       	call   2b00 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()>
+    2293:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2297:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    229b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    229f:	48 8d 75 f0          	lea    -0x10(%rbp),%rsi
+    22a3:	48 89 c7             	mov    %rax,%rdi
+    22a6:	e8 9b 08 00 00       	call   2b46 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+        }
+    22ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22af:	c9                   	leave
+    22b0:	c3                   	ret
+
+00000000000022b1 <void nel::search::eytzinger_from<int>(int*, int const*, unsigned long)>:
+
+/**
+ * Copy the n sorted items of src into dst in Eytzinger layout.
+ */
+template<typename T>
+void eytzinger_from(T dst[], T const src[], Length const n)
+    22b1:	55                   	push   %rbp
+    22b2:	48 89 e5             	mov    %rsp,%rbp
+    22b5:	48 83 ec 20          	sub    $0x20,%rsp
+    22b9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    22bd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    22c1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+{
+    eytzinger_fill(dst, src, n, 1, 0);
+    22c5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    22c9:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+    22cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    22d7:	b9 01 00 00 00       	mov    $0x1,%ecx
+    22dc:	48 89 c7             	mov    %rax,%rdi
+    22df:	e8 fa 08 00 00       	call   2bde <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)>
+}
+    22e4:	90                   	nop
+    22e5:	c9                   	leave
+    22e6:	c3                   	ret
+    22e7:	90                   	nop
+
+00000000000022e8 <nel::Slice<int>::try_get(unsigned long) const>:
+         *
+         * @returns If array is empty, return None.
+         * @returns If idx is out-of range, return None.
+         * @returns else return ref to item at index..
+         */
+        constexpr Optional<Type &> try_get(Index idx) const
+    22e8:	       55                   	push   %rbp
+    22e9:	       48 89 e5             	mov    %rsp,%rbp
+    22ec:	       48 83 ec 20          	sub    $0x20,%rsp
+    22f0:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    22f4:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    22f8:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            return (idx >= len_) ? None : Optional<Type &>::Some(content_[idx]);
+    22fc:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2300:	       48 8b 40 08          	mov    0x8(%rax),%rax
+    2304:	       48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    2308:	   /-- 72 18                	jb     2322 <nel::Slice<int>::try_get(unsigned long) const+0x3a>
+    230a:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    230e:	   |   48 8d 15 1b 2d 00 00 	lea    0x2d1b(%rip),%rdx        # 5030 <nel::None>
+    2315:	   |   48 89 d6             	mov    %rdx,%rsi
+    2318:	   |   48 89 c7             	mov    %rax,%rdi
+    231b:	   |   e8 a2 09 00 00       	call   2cc2 <nel::Optional<int&>::Optional(nel::NoneT const&)>
+    2320:	/--|-- eb 21                	jmp    2343 <nel::Slice<int>::try_get(unsigned long) const+0x5b>
+    2322:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2326:	|      48 8b 00             	mov    (%rax),%rax
+    2329:	|      48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    232d:	|      48 c1 e2 02          	shl    $0x2,%rdx
+    2331:	|      48 01 c2             	add    %rax,%rdx
+    2334:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2338:	|      48 89 d6             	mov    %rdx,%rsi
+    233b:	|      48 89 c7             	mov    %rax,%rdi
+    233e:	|      e8 4b 09 00 00       	call   2c8e <nel::Optional<int&>::Some(int&)>
+        }
+    2343:	\----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2347:	       c9                   	leave
+    2348:	       c3                   	ret
+    2349:	       90                   	nop
+
+000000000000234a <nel::Optional<int&>::~Optional()>:
+        union {
+                Element<T> some_;
+        };
+
+    public:
+        constexpr ~Optional(void)
+    234a:	             55                   	push   %rbp
+    234b:	             48 89 e5             	mov    %rsp,%rbp
+    234e:	             48 83 ec 30          	sub    $0x30,%rsp
+    2352:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // optional::dtor
+    2356:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    235a:	             8b 00                	mov    (%rax),%eax
+    235c:	             83 f8 02             	cmp    $0x2,%eax
+    235f:	/----------- 74 43                	je     23a4 <nel::Optional<int&>::~Optional()+0x5a>
+    2361:	|            83 f8 02             	cmp    $0x2,%eax
+    2364:	|        /-- 7f 09                	jg     236f <nel::Optional<int&>::~Optional()+0x25>
+    2366:	|        |   85 c0                	test   %eax,%eax
+    2368:	|  /-----|-- 74 3d                	je     23a7 <nel::Optional<int&>::~Optional()+0x5d>
+    236a:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    236d:	|  |  /--|-- 74 3b                	je     23aa <nel::Optional<int&>::~Optional()+0x60>
+                    // yes, since it may have contained one or the others..
+                    // if memory hardware is assumed to be incorruptable then can ignore ? (buffer
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob.
+                    nel::panic("bad Optional");
+    236f:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2373:	|  |  |      b9 87 00 00 00       	mov    $0x87,%ecx
+    2378:	|  |  |      48 8d 15 d7 2d 00 00 	lea    0x2dd7(%rip),%rdx        # 5156 <max_linear+0xc6>
+    237f:	|  |  |      48 8d 35 e4 2d 00 00 	lea    0x2de4(%rip),%rsi        # 516a <max_linear+0xda>
+    2386:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2389:	|  |  |      e8 80 f9 ff ff       	call   1d0e <nel::Context::Context(char const*, char const*, int)>
+    238e:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2392:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    2395:	|  |  |      48 8d 05 d8 2d 00 00 	lea    0x2dd8(%rip),%rax        # 5174 <max_linear+0xe4>
+    239c:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    239f:	|  |  |      e8 8d 18 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    23a4:	\--|--|----> 90                   	nop
+    23a5:	   |  |  /-- eb 04                	jmp    23ab <nel::Optional<int&>::~Optional()+0x61>
+                    break;
+    23a7:	   \--|--|-> 90                   	nop
+    23a8:	      |  +-- eb 01                	jmp    23ab <nel::Optional<int&>::~Optional()+0x61>
+                    break;
+    23aa:	      \--|-> 90                   	nop
+                    break;
+            }
+        }
+    23ab:	         \-> 90                   	nop
+    23ac:	             c9                   	leave
+    23ad:	             c3                   	ret
+
+00000000000023ae <nel::Optional<int&>::is_some() const::{lambda(int&)#1}::operator()(int&) const>:
+         *
+         * The optional is not consumed by the operation.
+         */
+        constexpr bool is_some(void) const
+        {
+            return match<bool>([](T const &) -> bool { return true; },
+    23ae:	55                   	push   %rbp
+    23af:	48 89 e5             	mov    %rsp,%rbp
+    23b2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    23b6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    23ba:	b8 01 00 00 00       	mov    $0x1,%eax
+    23bf:	5d                   	pop    %rbp
+    23c0:	c3                   	ret
+    23c1:	90                   	nop
+
+00000000000023c2 <nel::Optional<int&>::is_some() const::{lambda()#2}::operator()() const>:
+                               [](void) -> bool { return false; });
+    23c2:	55                   	push   %rbp
+    23c3:	48 89 e5             	mov    %rsp,%rbp
+    23c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    23ca:	b8 00 00 00 00       	mov    $0x0,%eax
+    23cf:	5d                   	pop    %rbp
+    23d0:	c3                   	ret
+    23d1:	90                   	nop
+
+00000000000023d2 <nel::Optional<int&>::is_some() const>:
+        constexpr bool is_some(void) const
+    23d2:	55                   	push   %rbp
+    23d3:	48 89 e5             	mov    %rsp,%rbp
+    23d6:	48 83 ec 30          	sub    $0x30,%rsp
+    23da:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+            return match<bool>([](T const &) -> bool { return true; },
+    23de:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    23e2:	b9 6b 01 00 00       	mov    $0x16b,%ecx
+    23e7:	48 8d 15 68 2d 00 00 	lea    0x2d68(%rip),%rdx        # 5156 <max_linear+0xc6>
+    23ee:	48 8d 35 8c 2d 00 00 	lea    0x2d8c(%rip),%rsi        # 5181 <max_linear+0xf1>
+    23f5:	48 89 c7             	mov    %rax,%rdi
+    23f8:	e8 11 f9 ff ff       	call   1d0e <nel::Context::Context(char const*, char const*, int)>
+    23fd:	48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+    2401:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    2405:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    2409:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    240d:	48 89 c7             	mov    %rax,%rdi
+    2410:	e8 c7 08 00 00       	call   2cdc <bool nel::Optional<int&>::match<bool, nel::Optional<int&>::is_some() const::{lambda(int&)#1}, nel::Optional<int&>::is_some() const::{lambda()#2}>(nel::Optional<int&>::is_some() const::{lambda(int&)#1}&&, nel::Optional<int&>::is_some() const::{lambda()#2}&&, nel::Context const&) const>
+        }
+    2415:	c9                   	leave
+    2416:	c3                   	ret
+    2417:	90                   	nop
+
+0000000000002418 <nel::Slice<int>::operator[](unsigned long) const>:
+        constexpr Type &operator[](Index idx) const
+    2418:	55                   	push   %rbp
+    2419:	48 89 e5             	mov    %rsp,%rbp
+    241c:	48 83 ec 10          	sub    $0x10,%rsp
+    2420:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2424:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return checked_get(idx);
+    2428:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    242c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2430:	48 89 d6             	mov    %rdx,%rsi
+    2433:	48 89 c7             	mov    %rax,%rdi
+    2436:	e8 35 09 00 00       	call   2d70 <nel::Slice<int>::checked_get(unsigned long) const>
+        }
+    243b:	c9                   	leave
+    243c:	c3                   	ret
+    243d:	90                   	nop
+
+000000000000243e <nel::Result<unsigned long, unsigned long> nel::Slice<int>::binary_search<nel::sort::Less>(int const&, nel::sort::Less&&) const>:
+         * @param key the value to find.
+         * @returns Ok with the index of an item equal to key, any of them if several.
+         * @returns Err with the index key would be inserted at to keep the slice sorted.
+         */
+        template<typename F = sort::Less>
+        Result<Index, Index> binary_search(Value const &key, F &&less = F()) const
+    243e:	       55                   	push   %rbp
+    243f:	       48 89 e5             	mov    %rsp,%rbp
+    2442:	       53                   	push   %rbx
+    2443:	       48 83 ec 38          	sub    $0x38,%rsp
+    2447:	       48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    244b:	       48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    244f:	       48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    2453:	       48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+        {
+            Index const i = search::lower_bound(ptr(), len(), key, less);
+    2457:	       48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    245b:	       48 89 c7             	mov    %rax,%rdi
+    245e:	       e8 7d 09 00 00       	call   2de0 <nel::Slice<int>::len() const>
+    2463:	       48 89 c3             	mov    %rax,%rbx
+    2466:	       48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    246a:	       48 89 c7             	mov    %rax,%rdi
+    246d:	       e8 2c fa ff ff       	call   1e9e <nel::Slice<int>::ptr() const>
+    2472:	       48 89 c7             	mov    %rax,%rdi
+    2475:	       48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    2479:	       48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    247d:	       48 89 d1             	mov    %rdx,%rcx
+    2480:	       48 89 c2             	mov    %rax,%rdx
+    2483:	       48 89 de             	mov    %rbx,%rsi
+    2486:	       e8 97 09 00 00       	call   2e22 <unsigned long nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)>
+    248b:	       48 89 45 e8          	mov    %rax,-0x18(%rbp)
+            if (i < len() && !less(key, content_[i])) { return Result<Index, Index>::Ok(i); }
+    248f:	       48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2493:	       48 89 c7             	mov    %rax,%rdi
+    2496:	       e8 45 09 00 00       	call   2de0 <nel::Slice<int>::len() const>
+    249b:	       48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    249f:	       48 39 c2             	cmp    %rax,%rdx
+    24a2:	/----- 73 33                	jae    24d7 <nel::Result<unsigned long, unsigned long> nel::Slice<int>::binary_search<nel::sort::Less>(int const&, nel::sort::Less&&) const+0x99>
+    24a4:	|      48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    24a8:	|      48 8b 00             	mov    (%rax),%rax
+    24ab:	|      48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    24af:	|      48 c1 e2 02          	shl    $0x2,%rdx
+    24b3:	|      48 01 c2             	add    %rax,%rdx
+    24b6:	|      48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+    24ba:	|      48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    24be:	|      48 89 ce             	mov    %rcx,%rsi
+    24c1:	|      48 89 c7             	mov    %rax,%rdi
+    24c4:	|      e8 9b 09 00 00       	call   2e64 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    24c9:	|      83 f0 01             	xor    $0x1,%eax
+    24cc:	|      84 c0                	test   %al,%al
+    24ce:	+----- 74 07                	je     24d7 <nel::Result<unsigned long, unsigned long> nel::Slice<int>::binary_search<nel::sort::Less>(int const&, nel::sort::Less&&) const+0x99>
+    24d0:	|      b8 01 00 00 00       	mov    $0x1,%eax
+    24d5:	|  /-- eb 05                	jmp    24dc <nel::Result<unsigned long, unsigned long> nel::Slice<int>::binary_search<nel::sort::Less>(int const&, nel::sort::Less&&) const+0x9e>
+    24d7:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    24dc:	   \-> 84 c0                	test   %al,%al
+    24de:	/----- 74 15                	je     24f5 <nel::Result<unsigned long, unsigned long> nel::Slice<int>::binary_search<nel::sort::Less>(int const&, nel::sort::Less&&) const+0xb7>
+    24e0:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    24e4:	|      48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+    24e8:	|      48 89 d6             	mov    %rdx,%rsi
+    24eb:	|      48 89 c7             	mov    %rax,%rdi
+    24ee:	|      e8 94 09 00 00       	call   2e87 <nel::Result<unsigned long, unsigned long> nel::Result<unsigned long, unsigned long>::Ok<unsigned long const&>(unsigned long const&)>
+    24f3:	|  /-- eb 13                	jmp    2508 <nel::Result<unsigned long, unsigned long> nel::Slice<int>::binary_search<nel::sort::Less>(int const&, nel::sort::Less&&) const+0xca>
+            return Result<Index, Index>::Err(i);
+    24f5:	\--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    24f9:	   |   48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+    24fd:	   |   48 89 d6             	mov    %rdx,%rsi
+    2500:	   |   48 89 c7             	mov    %rax,%rdi
+    2503:	   |   e8 b3 09 00 00       	call   2ebb <nel::Result<unsigned long, unsigned long> nel::Result<unsigned long, unsigned long>::Err<unsigned long const&>(unsigned long const&)>
+        }
+    2508:	   \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    250c:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2510:	       c9                   	leave
+    2511:	       c3                   	ret
+
+0000000000002512 <nel::Result<unsigned long, unsigned long>::~Result()>:
+        constexpr ~Result(void)
+    2512:	             55                   	push   %rbp
+    2513:	             48 89 e5             	mov    %rsp,%rbp
+    2516:	             48 83 ec 30          	sub    $0x30,%rsp
+    251a:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+            switch (tag_) { // result::dtor
+    251e:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2522:	             8b 00                	mov    (%rax),%eax
+    2524:	             83 f8 02             	cmp    $0x2,%eax
+    2527:	/----------- 74 43                	je     256c <nel::Result<unsigned long, unsigned long>::~Result()+0x5a>
+    2529:	|            83 f8 02             	cmp    $0x2,%eax
+    252c:	|        /-- 7f 09                	jg     2537 <nel::Result<unsigned long, unsigned long>::~Result()+0x25>
+    252e:	|        |   85 c0                	test   %eax,%eax
+    2530:	|  /-----|-- 74 3d                	je     256f <nel::Result<unsigned long, unsigned long>::~Result()+0x5d>
+    2532:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    2535:	|  |  /--|-- 74 3b                	je     2572 <nel::Result<unsigned long, unsigned long>::~Result()+0x60>
+                    nel::panic("bad Result");
+    2537:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    253b:	|  |  |      b9 72 00 00 00       	mov    $0x72,%ecx
+    2540:	|  |  |      48 8d 15 eb 2b 00 00 	lea    0x2beb(%rip),%rdx        # 5132 <max_linear+0xa2>
+    2547:	|  |  |      48 8d 35 f6 2b 00 00 	lea    0x2bf6(%rip),%rsi        # 5144 <max_linear+0xb4>
+    254e:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2551:	|  |  |      e8 b8 f7 ff ff       	call   1d0e <nel::Context::Context(char const*, char const*, int)>
+    2556:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    255a:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    255d:	|  |  |      48 8d 05 43 2b 00 00 	lea    0x2b43(%rip),%rax        # 50a7 <max_linear+0x17>
+    2564:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2567:	|  |  |      e8 c5 16 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    256c:	\--|--|----> 90                   	nop
+    256d:	   |  |  /-- eb 04                	jmp    2573 <nel::Result<unsigned long, unsigned long>::~Result()+0x61>
+                    break;
+    256f:	   \--|--|-> 90                   	nop
+    2570:	      |  +-- eb 01                	jmp    2573 <nel::Result<unsigned long, unsigned long>::~Result()+0x61>
+                    break;
+    2572:	      \--|-> 90                   	nop
+        }
+    2573:	         \-> 90                   	nop
+    2574:	             c9                   	leave
+    2575:	             c3                   	ret
+
+0000000000002576 <nel::Element<unsigned long>::operator*() const>:
+        constexpr Type &ref(void)
+        {
+            return value_;
+        }
+
+        constexpr Type const &operator*(void) const
+    2576:	55                   	push   %rbp
+    2577:	48 89 e5             	mov    %rsp,%rbp
+    257a:	48 83 ec 10          	sub    $0x10,%rsp
+    257e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    2582:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2586:	48 89 c7             	mov    %rax,%rdi
+    2589:	e8 62 09 00 00       	call   2ef0 <nel::Element<unsigned long>::ref() const>
+        }
+    258e:	c9                   	leave
+    258f:	c3                   	ret
+
+0000000000002590 <nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#1}::operator()(unsigned long&&) const>:
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    2590:	55                   	push   %rbp
+    2591:	48 89 e5             	mov    %rsp,%rbp
+    2594:	48 83 ec 10          	sub    $0x10,%rsp
+    2598:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    259c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    25a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25a4:	48 89 c7             	mov    %rax,%rdi
+    25a7:	e8 52 09 00 00       	call   2efe <unsigned long&& nel::forward<unsigned long, unsigned long>(unsigned long&)>
+    25ac:	48 8b 00             	mov    (%rax),%rax
+    25af:	c9                   	leave
+    25b0:	c3                   	ret
+    25b1:	90                   	nop
+
+00000000000025b2 <nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#2}::operator()(unsigned long&&) const>:
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    25b2:	55                   	push   %rbp
+    25b3:	48 89 e5             	mov    %rsp,%rbp
+    25b6:	48 83 ec 10          	sub    $0x10,%rsp
+    25ba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    25be:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    25c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25c6:	48 8b 00             	mov    (%rax),%rax
+    25c9:	48 89 c6             	mov    %rax,%rsi
+    25cc:	48 8d 05 b6 2b 00 00 	lea    0x2bb6(%rip),%rax        # 5189 <max_linear+0xf9>
+    25d3:	48 89 c7             	mov    %rax,%rdi
+    25d6:	e8 56 16 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+    25db:	90                   	nop
+
+00000000000025dc <nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)>:
+        constexpr T unwrap(Context const &ctx = Context())
+    25dc:	55                   	push   %rbp
+    25dd:	48 89 e5             	mov    %rsp,%rbp
+    25e0:	48 83 ec 20          	sub    $0x20,%rsp
+    25e4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    25e8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    25ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    25f0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    25f4:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    25f8:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    25fc:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    2600:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2604:	48 89 c7             	mov    %rax,%rdi
+    2607:	e8 00 09 00 00       	call   2f0c <unsigned long nel::Result<unsigned long, unsigned long>::consume<unsigned long, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#1}, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#2}>(nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#1}&&, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#2}&&, nel::Context const&)>
+        }
+    260c:	c9                   	leave
+    260d:	c3                   	ret
+
+000000000000260e <nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#1}::operator()(unsigned long&&) const>:
+            return consume<E>([&](T &&) -> E { nel::panic("not an err", ctx); },
+    260e:	55                   	push   %rbp
+    260f:	48 89 e5             	mov    %rsp,%rbp
+    2612:	48 83 ec 10          	sub    $0x10,%rsp
+    2616:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    261a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    261e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2622:	48 8b 00             	mov    (%rax),%rax
+    2625:	48 89 c6             	mov    %rax,%rsi
+    2628:	48 8d 05 64 2b 00 00 	lea    0x2b64(%rip),%rax        # 5193 <max_linear+0x103>
+    262f:	48 89 c7             	mov    %rax,%rdi
+    2632:	e8 fa 15 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+    2637:	90                   	nop
+
+0000000000002638 <nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#2}::operator()(unsigned long&&) const>:
+                              [](E &&err) -> E { return err; },
+    2638:	55                   	push   %rbp
+    2639:	48 89 e5             	mov    %rsp,%rbp
+    263c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2640:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2644:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2648:	48 8b 00             	mov    (%rax),%rax
+    264b:	5d                   	pop    %rbp
+    264c:	c3                   	ret
+    264d:	90                   	nop
+
+000000000000264e <nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)>:
+        constexpr E unwrap_err(Context const &ctx = Context())
+    264e:	55                   	push   %rbp
+    264f:	48 89 e5             	mov    %rsp,%rbp
+    2652:	48 83 ec 20          	sub    $0x20,%rsp
+    2656:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    265a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return consume<E>([&](T &&) -> E { nel::panic("not an err", ctx); },
+    265e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2662:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2666:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    266a:	48 8d 55 f7          	lea    -0x9(%rbp),%rdx
+    266e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+    2672:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2676:	48 89 c7             	mov    %rax,%rdi
+    2679:	e8 58 09 00 00       	call   2fd6 <unsigned long nel::Result<unsigned long, unsigned long>::consume<unsigned long, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#1}, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#2}>(nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#1}&&, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#2}&&, nel::Context const&)>
+        }
+    267e:	c9                   	leave
+    267f:	c3                   	ret
+
+0000000000002680 <unsigned long nel::search::eytzinger_lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)>:
+ * Position, in the Eytzinger layout e, of the first item not less than key.
+ *
+ * @returns n if all are less.
+ */
+template<typename T, typename F>
+Index eytzinger_lower_bound(T const e[], Length const n, T const &key, F &less)
+    2680:	             55                   	push   %rbp
+    2681:	             48 89 e5             	mov    %rsp,%rbp
+    2684:	             53                   	push   %rbx
+    2685:	             48 83 ec 38          	sub    $0x38,%rsp
+    2689:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    268d:	             48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    2691:	             48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    2695:	             48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+{
+    // Nodes 4 levels down from i are 16i..16i+15, contiguous,
+    // so for small items a single prefetch covers them.
+    // Addresses computed as ints, a prefetch past the end is harmless.
+    constexpr Length ahead = 16;
+    2699:	             48 c7 45 e0 10 00 00 	movq   $0x10,-0x20(%rbp)
+    26a0:	             00 
+    Index i = 1;
+    26a1:	             48 c7 45 e8 01 00 00 	movq   $0x1,-0x18(%rbp)
+    26a8:	             00 
+    while (i <= n) {
+    26a9:	   /-------- eb 5f                	jmp    270a <unsigned long nel::search::eytzinger_lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)+0x8a>
+        __builtin_prefetch(
+            reinterpret_cast<void const *>(uintptr_t(e) + (ahead * i - 1) * sizeof(T)));
+    26ab:	/--|-------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26af:	|  |         48 c1 e0 06          	shl    $0x6,%rax
+    26b3:	|  |         48 89 c2             	mov    %rax,%rdx
+    26b6:	|  |         48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    26ba:	|  |         48 01 d0             	add    %rdx,%rax
+    26bd:	|  |         48 83 e8 04          	sub    $0x4,%rax
+        __builtin_prefetch(
+    26c1:	|  |         0f 18 08             	prefetcht0 (%rax)
+        i = 2 * i + (less(e[i - 1], key) ? 1 : 0);
+    26c4:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26c8:	|  |         48 8d 1c 00          	lea    (%rax,%rax,1),%rbx
+    26cc:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26d0:	|  |         48 c1 e0 02          	shl    $0x2,%rax
+    26d4:	|  |         48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    26d8:	|  |         48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    26dc:	|  |         48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    26e0:	|  |         48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    26e4:	|  |         48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    26e8:	|  |         48 89 ce             	mov    %rcx,%rsi
+    26eb:	|  |         48 89 c7             	mov    %rax,%rdi
+    26ee:	|  |         e8 71 07 00 00       	call   2e64 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    26f3:	|  |         84 c0                	test   %al,%al
+    26f5:	|  |  /----- 74 07                	je     26fe <unsigned long nel::search::eytzinger_lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)+0x7e>
+    26f7:	|  |  |      b8 01 00 00 00       	mov    $0x1,%eax
+    26fc:	|  |  |  /-- eb 05                	jmp    2703 <unsigned long nel::search::eytzinger_lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)+0x83>
+    26fe:	|  |  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    2703:	|  |     \-> 48 01 d8             	add    %rbx,%rax
+    2706:	|  |         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (i <= n) {
+    270a:	|  \-------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    270e:	|            48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+    2712:	\----------- 73 97                	jae    26ab <unsigned long nel::search::eytzinger_lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)+0x2b>
+    }
+    // The trailing 1s of i are the steps right (less) after the last step left,
+    // which was at the answer.
+    i >>= __builtin_ffsll((long long)(~i));
+    2714:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2718:	             48 f7 d0             	not    %rax
+    271b:	             48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+    2722:	             48 0f bc c0          	bsf    %rax,%rax
+    2726:	             48 0f 44 c2          	cmove  %rdx,%rax
+    272a:	             48 83 c0 01          	add    $0x1,%rax
+    272e:	             89 c1                	mov    %eax,%ecx
+    2730:	             48 d3 6d e8          	shrq   %cl,-0x18(%rbp)
+    return (i == 0) ? n : i - 1;
+    2734:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    2739:	      /----- 74 0a                	je     2745 <unsigned long nel::search::eytzinger_lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)+0xc5>
+    273b:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    273f:	      |      48 83 e8 01          	sub    $0x1,%rax
+    2743:	      |  /-- eb 04                	jmp    2749 <unsigned long nel::search::eytzinger_lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)+0xc9>
+    2745:	      \--|-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+}
+    2749:	         \-> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    274d:	             c9                   	leave
+    274e:	             c3                   	ret
+
+000000000000274f <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel so to not need std.
+ */
+template<typename U, typename T>
+constexpr U &&forward(T &t)
+    274f:	55                   	push   %rbp
+    2750:	48 89 e5             	mov    %rsp,%rbp
+    2753:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<U &&>(t);
+    2757:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    275b:	5d                   	pop    %rbp
+    275c:	c3                   	ret
+    275d:	90                   	nop
+
+000000000000275e <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    275e:	55                   	push   %rbp
+    275f:	48 89 e5             	mov    %rsp,%rbp
+    2762:	53                   	push   %rbx
+    2763:	48 83 ec 18          	sub    $0x18,%rsp
+    2767:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    276b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    276f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2773:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    2779:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    277d:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    2781:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2785:	48 89 c7             	mov    %rax,%rdi
+    2788:	e8 c2 ff ff ff       	call   274f <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    278d:	48 89 c6             	mov    %rax,%rsi
+    2790:	48 89 df             	mov    %rbx,%rdi
+    2793:	e8 08 09 00 00       	call   30a0 <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>
+        }
+    2798:	90                   	nop
+    2799:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    279d:	c9                   	leave
+    279e:	c3                   	ret
+
+000000000000279f <void* const& nel::forward<void* const&, void* const>(void* const&)>:
+constexpr U &&forward(T &t)
+    279f:	55                   	push   %rbp
+    27a0:	48 89 e5             	mov    %rsp,%rbp
+    27a3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    27a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    27ab:	5d                   	pop    %rbp
+    27ac:	c3                   	ret
+    27ad:	90                   	nop
+
+00000000000027ae <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>:
+        constexpr Result(Phantom<Tag::OK> const, Args &&...args)
+    27ae:	55                   	push   %rbp
+    27af:	48 89 e5             	mov    %rsp,%rbp
+    27b2:	53                   	push   %rbx
+    27b3:	48 83 ec 18          	sub    $0x18,%rsp
+    27b7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    27bb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    27bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27c3:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<Args>(args)...)
+    27c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27cd:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    27d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    27d5:	48 89 c7             	mov    %rax,%rdi
+    27d8:	e8 c2 ff ff ff       	call   279f <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    27dd:	48 89 c6             	mov    %rax,%rsi
+    27e0:	48 89 df             	mov    %rbx,%rdi
+    27e3:	e8 e0 08 00 00       	call   30c8 <nel::Element<void*>::Element<void* const&>(void* const&)>
+        }
+    27e8:	90                   	nop
+    27e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    27ed:	c9                   	leave
+    27ee:	c3                   	ret
+    27ef:	90                   	nop
+
+00000000000027f0 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector()>:
+        constexpr Vector(void)
+    27f0:	55                   	push   %rbp
+    27f1:	48 89 e5             	mov    %rsp,%rbp
+    27f4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : item_(nullptr)
+    27f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27fc:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        }
+    2803:	90                   	nop
+    2804:	5d                   	pop    %rbp
+    2805:	c3                   	ret
+
+0000000000002806 <nel::heaped::Node<int, nel::heaped::Malloc>::malloc(unsigned long)>:
+        // {
+        //     Length const align = alignof(Node);
+        //     // p % alignment == 0?
+        //     return ((Length)p & (align-1)) == 0;
+        // }
+        static Node *malloc(Count capacity)
+    2806:	    55                   	push   %rbp
+    2807:	    48 89 e5             	mov    %rsp,%rbp
+    280a:	    48 83 ec 20          	sub    $0x20,%rsp
+    280e:	    48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        {
+            Node *new_n = realloc(nullptr, capacity);
+    2812:	    48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2816:	    48 89 c6             	mov    %rax,%rsi
+    2819:	    bf 00 00 00 00       	mov    $0x0,%edi
+    281e:	    e8 c8 09 00 00       	call   31eb <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    2823:	    48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    2827:	    48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    282c:	/-- 74 0c                	je     283a <nel::heaped::Node<int, nel::heaped::Malloc>::malloc(unsigned long)+0x34>
+    282e:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2832:	|   48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    2839:	|   00 
+            return new_n;
+    283a:	\-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    283e:	    c9                   	leave
+    283f:	    c3                   	ret
+
+0000000000002840 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Node<int, nel::heaped::Malloc>*)>:
+        constexpr Vector(VectorNode *const n)
+    2840:	55                   	push   %rbp
+    2841:	48 89 e5             	mov    %rsp,%rbp
+    2844:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2848:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : item_(n)
+    284c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2850:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2854:	48 89 10             	mov    %rdx,(%rax)
+        }
+    2857:	90                   	nop
+    2858:	5d                   	pop    %rbp
+    2859:	c3                   	ret
+
+000000000000285a <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >&&)>:
+        constexpr Vector(Vector &&o)
+    285a:	55                   	push   %rbp
+    285b:	48 89 e5             	mov    %rsp,%rbp
+    285e:	48 83 ec 10          	sub    $0x10,%rsp
+    2862:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2866:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : item_(move(o.item_))
+    286a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    286e:	48 89 c7             	mov    %rax,%rdi
+    2871:	e8 cb 0a 00 00       	call   3341 <nel::heaped::Node<int, nel::heaped::Malloc>*&& nel::move<nel::heaped::Node<int, nel::heaped::Malloc>*>(nel::heaped::Node<int, nel::heaped::Malloc>*&)>
+    2876:	48 8b 10             	mov    (%rax),%rdx
+    2879:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    287d:	48 89 10             	mov    %rdx,(%rax)
+            o.item_ = nullptr;
+    2880:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2884:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        }
+    288b:	90                   	nop
+    288c:	c9                   	leave
+    288d:	c3                   	ret
+
+000000000000288e <nel::heaped::Node<int, nel::heaped::Malloc>::size_of(unsigned long)>:
+        static constexpr Length size_of(Count const cap)
+    288e:	55                   	push   %rbp
+    288f:	48 89 e5             	mov    %rsp,%rbp
+    2892:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    2896:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    289a:	48 83 c0 05          	add    $0x5,%rax
+    289e:	48 c1 e0 02          	shl    $0x2,%rax
+        }
+    28a2:	5d                   	pop    %rbp
+    28a3:	c3                   	ret
+
+00000000000028a4 <nel::heaped::Node<int, nel::heaped::Malloc>::free(nel::heaped::Node<int, nel::heaped::Malloc>*)>:
+        static void free(Node *old)
+    28a4:	       55                   	push   %rbp
+    28a5:	       48 89 e5             	mov    %rsp,%rbp
+    28a8:	       48 83 ec 20          	sub    $0x20,%rsp
+    28ac:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            if (old == nullptr) { return; }
+    28b0:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    28b5:	/----- 74 36                	je     28ed <nel::heaped::Node<int, nel::heaped::Malloc>::free(nel::heaped::Node<int, nel::heaped::Malloc>*)+0x49>
+            Length const sz = size_of(old->alloc_);
+    28b7:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28bb:	|      48 8b 00             	mov    (%rax),%rax
+    28be:	|      48 89 c7             	mov    %rax,%rdi
+    28c1:	|      e8 c8 ff ff ff       	call   288e <nel::heaped::Node<int, nel::heaped::Malloc>::size_of(unsigned long)>
+    28c6:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            old->~Node();
+    28ca:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28ce:	|      48 89 c7             	mov    %rax,%rdi
+    28d1:	|      e8 7a 0a 00 00       	call   3350 <nel::heaped::Node<int, nel::heaped::Malloc>::~Node()>
+            Allocator::free(old, alignof(Node), sz);
+    28d6:	|      48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    28da:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28de:	|      be 08 00 00 00       	mov    $0x8,%esi
+    28e3:	|      48 89 c7             	mov    %rax,%rdi
+    28e6:	|      e8 5f f5 ff ff       	call   1e4a <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>
+    28eb:	|  /-- eb 01                	jmp    28ee <nel::heaped::Node<int, nel::heaped::Malloc>::free(nel::heaped::Node<int, nel::heaped::Malloc>*)+0x4a>
+            if (old == nullptr) { return; }
+    28ed:	\--|-> 90                   	nop
+        }
+    28ee:	   \-> c9                   	leave
+    28ef:	       c3                   	ret
+
+00000000000028f0 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>:
+        bool try_reserve_for(Count const n)
+    28f0:	       55                   	push   %rbp
+    28f1:	       48 89 e5             	mov    %rsp,%rbp
+    28f4:	       53                   	push   %rbx
+    28f5:	       48 83 ec 18          	sub    $0x18,%rsp
+    28f9:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    28fd:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            if (len() + n <= capacity()) { return true; }
+    2901:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2905:	       48 89 c7             	mov    %rax,%rdi
+    2908:	       e8 79 0a 00 00       	call   3386 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    290d:	       48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2911:	       48 8d 1c 10          	lea    (%rax,%rdx,1),%rbx
+    2915:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2919:	       48 89 c7             	mov    %rax,%rdi
+    291c:	       e8 95 0a 00 00       	call   33b6 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    2921:	       48 39 d8             	cmp    %rbx,%rax
+    2924:	       0f 93 c0             	setae  %al
+    2927:	       84 c0                	test   %al,%al
+    2929:	   /-- 74 07                	je     2932 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x42>
+    292b:	   |   b8 01 00 00 00       	mov    $0x1,%eax
+    2930:	/--|-- eb 23                	jmp    2955 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x65>
+            return try_reserve(len() + n);
+    2932:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2936:	|      48 89 c7             	mov    %rax,%rdi
+    2939:	|      e8 48 0a 00 00       	call   3386 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    293e:	|      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2942:	|      48 01 c2             	add    %rax,%rdx
+    2945:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2949:	|      48 89 d6             	mov    %rdx,%rsi
+    294c:	|      48 89 c7             	mov    %rax,%rdi
+    294f:	|      e8 92 0a 00 00       	call   33e6 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>
+    2954:	|      90                   	nop
+        }
+    2955:	\----> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2959:	       c9                   	leave
+    295a:	       c3                   	ret
+
+000000000000295b <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>:
+        constexpr static Result Err(Args &&...args)
+    295b:	55                   	push   %rbp
+    295c:	48 89 e5             	mov    %rsp,%rbp
+    295f:	48 83 ec 10          	sub    $0x10,%rsp
+    2963:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2967:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    296b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    296f:	48 89 c7             	mov    %rax,%rdi
+    2972:	e8 c2 0b 00 00       	call   3539 <int& nel::forward<int&, int>(int&)>
+    2977:	48 89 c2             	mov    %rax,%rdx
+    297a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    297e:	48 89 d6             	mov    %rdx,%rsi
+    2981:	48 89 c7             	mov    %rax,%rdi
+    2984:	e8 bf 0b 00 00       	call   3548 <nel::Result<void, int>::Result<int&>(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)2>, int&)>
+        }
+    2989:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    298d:	c9                   	leave
+    298e:	c3                   	ret
+    298f:	90                   	nop
+
+0000000000002990 <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int&>(int&)>:
+            }
+        }
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+    2990:	       55                   	push   %rbp
+    2991:	       48 89 e5             	mov    %rsp,%rbp
+    2994:	       53                   	push   %rbx
+    2995:	       48 83 ec 28          	sub    $0x28,%rsp
+    2999:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    299d:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    29a1:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+        {
+            if (len() >= capacity()) {
+    29a5:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29a9:	       48 89 c7             	mov    %rax,%rdi
+    29ac:	       e8 d9 0b 00 00       	call   358a <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    29b1:	       48 89 c3             	mov    %rax,%rbx
+    29b4:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29b8:	       48 89 c7             	mov    %rax,%rdi
+    29bb:	       e8 dc 0b 00 00       	call   359c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    29c0:	       48 39 c3             	cmp    %rax,%rbx
+    29c3:	       0f 93 c0             	setae  %al
+    29c6:	       84 c0                	test   %al,%al
+    29c8:	   /-- 74 20                	je     29ea <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int&>(int&)+0x5a>
+                // TODO: don't want to create a T on error though..
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+    29ca:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    29ce:	   |   48 89 c7             	mov    %rax,%rdi
+    29d1:	   |   e8 63 0b 00 00       	call   3539 <int& nel::forward<int&, int>(int&)>
+    29d6:	   |   48 89 c2             	mov    %rax,%rdx
+    29d9:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    29dd:	   |   48 89 d6             	mov    %rdx,%rsi
+    29e0:	   |   48 89 c7             	mov    %rax,%rdi
+    29e3:	   |   e8 73 ff ff ff       	call   295b <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    29e8:	/--|-- eb 5f                	jmp    2a49 <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int&>(int&)+0xb9>
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    29ea:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29ee:	|      48 89 c7             	mov    %rax,%rdi
+    29f1:	|      e8 94 0b 00 00       	call   358a <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    29f6:	|      48 83 c0 04          	add    $0x4,%rax
+    29fa:	|      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2a01:	|      00 
+    2a02:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a06:	|      48 01 d0             	add    %rdx,%rax
+    2a09:	|      48 89 c6             	mov    %rax,%rsi
+    2a0c:	|      bf 04 00 00 00       	mov    $0x4,%edi
+    2a11:	|      e8 e5 f2 ff ff       	call   1cfb <operator new(unsigned long, void*)>
+    2a16:	|      48 89 c3             	mov    %rax,%rbx
+    2a19:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2a1d:	|      48 89 c7             	mov    %rax,%rdi
+    2a20:	|      e8 14 0b 00 00       	call   3539 <int& nel::forward<int&, int>(int&)>
+    2a25:	|      8b 00                	mov    (%rax),%eax
+    2a27:	|      89 03                	mov    %eax,(%rbx)
+            len_ += 1;
+    2a29:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a2d:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    2a31:	|      48 8d 50 01          	lea    0x1(%rax),%rdx
+    2a35:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a39:	|      48 89 50 08          	mov    %rdx,0x8(%rax)
+            return Result<void, Type>::Ok();
+    2a3d:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a41:	|      48 89 c7             	mov    %rax,%rdi
+    2a44:	|      e8 64 0b 00 00       	call   35ad <nel::Result<void, int>::Ok()>
+        }
+    2a49:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a4d:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2a51:	       c9                   	leave
+    2a52:	       c3                   	ret
+    2a53:	       90                   	nop
+
+0000000000002a54 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)>:
+        constexpr void consumev(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    2a54:	             55                   	push   %rbp
+    2a55:	             48 89 e5             	mov    %rsp,%rbp
+    2a58:	             48 83 ec 30          	sub    $0x30,%rsp
+    2a5c:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2a60:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2a64:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    2a68:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    2a6c:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a70:	             8b 00                	mov    (%rax),%eax
+    2a72:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    2a75:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a79:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result<void>-consume
+    2a7f:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    2a83:	         /-- 74 20                	je     2aa5 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)+0x51>
+    2a85:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    2a89:	/--------|-- 7f 5c                	jg     2ae7 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)+0x93>
+    2a8b:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2a8f:	|     /--|-- 74 40                	je     2ad1 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)+0x7d>
+    2a91:	|     |  |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    2a95:	+-----|--|-- 75 50                	jne    2ae7 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)+0x93>
+                    on_ok();
+    2a97:	|     |  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a9b:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    2a9e:	|     |  |   e8 47 f7 ff ff       	call   21ea <nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}::operator()() const>
+                    break;
+    2aa3:	|  /--|--|-- eb 58                	jmp    2afd <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)+0xa9>
+                    on_err(nel::forward<E>(*err_));
+    2aa5:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2aa9:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    2aad:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2ab0:	|  |  |      e8 17 0b 00 00       	call   35cc <nel::Element<int>::operator*()>
+    2ab5:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2ab8:	|  |  |      e8 29 0b 00 00       	call   35e6 <int&& nel::forward<int, int>(int&)>
+    2abd:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    2ac0:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2ac4:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    2ac7:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2aca:	|  |  |      e8 27 f7 ff ff       	call   21f6 <nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}::operator()(int&&) const>
+                    break;
+    2acf:	|  +--|----- eb 2c                	jmp    2afd <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)+0xa9>
+                    nel::panic("invalid Result", ctx);
+    2ad1:	|  |  \----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2ad5:	|  |         48 89 c6             	mov    %rax,%rsi
+    2ad8:	|  |         48 8d 05 b9 25 00 00 	lea    0x25b9(%rip),%rax        # 5098 <max_linear+0x8>
+    2adf:	|  |         48 89 c7             	mov    %rax,%rdi
+    2ae2:	|  |         e8 4a 11 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    2ae7:	\--|-------> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2aeb:	   |         48 89 c6             	mov    %rax,%rsi
+    2aee:	   |         48 8d 05 b2 25 00 00 	lea    0x25b2(%rip),%rax        # 50a7 <max_linear+0x17>
+    2af5:	   |         48 89 c7             	mov    %rax,%rdi
+    2af8:	   |         e8 34 11 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+        }
+    2afd:	   \-------> 90                   	nop
+    2afe:	             c9                   	leave
+    2aff:	             c3                   	ret
+
+0000000000002b00 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()>:
+        constexpr Slice<Type> slice(void)
+    2b00:	       55                   	push   %rbp
+    2b01:	       48 89 e5             	mov    %rsp,%rbp
+    2b04:	       48 83 ec 10          	sub    $0x10,%rsp
+    2b08:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2b0c:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return (item_ == nullptr) ? Slice<Type>::empty() : item_->slice();
+    2b10:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b14:	       48 8b 00             	mov    (%rax),%rax
+    2b17:	       48 85 c0             	test   %rax,%rax
+    2b1a:	   /-- 75 0e                	jne    2b2a <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()+0x2a>
+    2b1c:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b20:	   |   48 89 c7             	mov    %rax,%rdi
+    2b23:	   |   e8 cc 0a 00 00       	call   35f4 <nel::Slice<int>::empty()>
+    2b28:	/--|-- eb 16                	jmp    2b40 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()+0x40>
+    2b2a:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b2e:	|      48 8b 10             	mov    (%rax),%rdx
+    2b31:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b35:	|      48 89 d6             	mov    %rdx,%rsi
+    2b38:	|      48 89 c7             	mov    %rax,%rdi
+    2b3b:	|      e8 d2 0a 00 00       	call   3612 <nel::heaped::Node<int, nel::heaped::Malloc>::slice()>
+        }
+    2b40:	\----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b44:	       c9                   	leave
+    2b45:	       c3                   	ret
+
+0000000000002b46 <nel::Slice<int>::slice(unsigned long, unsigned long) const>:
+        Slice slice(Index b, Index e) const
+    2b46:	       55                   	push   %rbp
+    2b47:	       48 89 e5             	mov    %rsp,%rbp
+    2b4a:	       48 83 ec 20          	sub    $0x20,%rsp
+    2b4e:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2b52:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2b56:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2b5a:	       48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            if (b >= e) { return Slice::empty(); }
+    2b5e:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b62:	       48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    2b66:	   /-- 72 0e                	jb     2b76 <nel::Slice<int>::slice(unsigned long, unsigned long) const+0x30>
+    2b68:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b6c:	   |   48 89 c7             	mov    %rax,%rdi
+    2b6f:	   |   e8 80 0a 00 00       	call   35f4 <nel::Slice<int>::empty()>
+    2b74:	/--|-- eb 62                	jmp    2bd8 <nel::Slice<int>::slice(unsigned long, unsigned long) const+0x92>
+            if (b >= len_) { return Slice::empty(); }
+    2b76:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b7a:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    2b7e:	|      48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    2b82:	|  /-- 72 0e                	jb     2b92 <nel::Slice<int>::slice(unsigned long, unsigned long) const+0x4c>
+    2b84:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b88:	|  |   48 89 c7             	mov    %rax,%rdi
+    2b8b:	|  |   e8 64 0a 00 00       	call   35f4 <nel::Slice<int>::empty()>
+    2b90:	+--|-- eb 46                	jmp    2bd8 <nel::Slice<int>::slice(unsigned long, unsigned long) const+0x92>
+            if (e > len_) { e = len_; }
+    2b92:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b96:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    2b9a:	|      48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    2b9e:	|  /-- 73 0c                	jae    2bac <nel::Slice<int>::slice(unsigned long, unsigned long) const+0x66>
+    2ba0:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ba4:	|  |   48 8b 40 08          	mov    0x8(%rax),%rax
+    2ba8:	|  |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            return Slice(&content_[b], e - b);
+    2bac:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2bb0:	|      48 2b 45 e8          	sub    -0x18(%rbp),%rax
+    2bb4:	|      48 89 c2             	mov    %rax,%rdx
+    2bb7:	|      48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2bbb:	|      48 8b 00             	mov    (%rax),%rax
+    2bbe:	|      48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    2bc2:	|      48 c1 e1 02          	shl    $0x2,%rcx
+    2bc6:	|      48 01 c1             	add    %rax,%rcx
+    2bc9:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2bcd:	|      48 89 ce             	mov    %rcx,%rsi
+    2bd0:	|      48 89 c7             	mov    %rax,%rdi
+    2bd3:	|      e8 76 0a 00 00       	call   364e <nel::Slice<int>::Slice(int*, unsigned long)>
+        }
+    2bd8:	\----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2bdc:	       c9                   	leave
+    2bdd:	       c3                   	ret
+
+0000000000002bde <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)>:
+Index eytzinger_fill(T dst[], T const src[], Length const n, Index const i, Index k)
+    2bde:	/----> 55                   	push   %rbp
+    2bdf:	|      48 89 e5             	mov    %rsp,%rbp
+    2be2:	|      48 83 ec 30          	sub    $0x30,%rsp
+    2be6:	|      48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2bea:	|      48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2bee:	|      48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2bf2:	|      48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+    2bf6:	|      4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+    if (i <= n) {
+    2bfa:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2bfe:	|      48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    2c02:	|  /-- 0f 82 80 00 00 00    	jb     2c88 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0xaa>
+        k = eytzinger_fill(dst, src, n, 2 * i, k);
+    2c08:	|  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2c0c:	|  |   48 8d 0c 00          	lea    (%rax,%rax,1),%rcx
+    2c10:	|  |   48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+    2c14:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2c18:	|  |   48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+    2c1c:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c20:	|  |   49 89 f8             	mov    %rdi,%r8
+    2c23:	|  |   48 89 c7             	mov    %rax,%rdi
+    2c26:	+--|-- e8 b3 ff ff ff       	call   2bde <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)>
+    2c2b:	|  |   48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        dst[i - 1] = src[k];
+    2c2f:	|  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2c33:	|  |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2c3a:	|  |   00 
+    2c3b:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2c3f:	|  |   48 01 d0             	add    %rdx,%rax
+    2c42:	|  |   48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2c46:	|  |   48 c1 e2 02          	shl    $0x2,%rdx
+    2c4a:	|  |   48 8d 4a fc          	lea    -0x4(%rdx),%rcx
+    2c4e:	|  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2c52:	|  |   48 01 ca             	add    %rcx,%rdx
+    2c55:	|  |   8b 00                	mov    (%rax),%eax
+    2c57:	|  |   89 02                	mov    %eax,(%rdx)
+        k += 1;
+    2c59:	|  |   48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+        k = eytzinger_fill(dst, src, n, 2 * i + 1, k);
+    2c5e:	|  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2c62:	|  |   48 01 c0             	add    %rax,%rax
+    2c65:	|  |   48 8d 48 01          	lea    0x1(%rax),%rcx
+    2c69:	|  |   48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+    2c6d:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2c71:	|  |   48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+    2c75:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c79:	|  |   49 89 f8             	mov    %rdi,%r8
+    2c7c:	|  |   48 89 c7             	mov    %rax,%rdi
+    2c7f:	\--|-- e8 5a ff ff ff       	call   2bde <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)>
+    2c84:	   |   48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return k;
+    2c88:	   \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+    2c8c:	       c9                   	leave
+    2c8d:	       c3                   	ret
+
+0000000000002c8e <nel::Optional<int&>::Some(int&)>:
+        constexpr static Optional Some(T &&v)
+    2c8e:	55                   	push   %rbp
+    2c8f:	48 89 e5             	mov    %rsp,%rbp
+    2c92:	48 83 ec 10          	sub    $0x10,%rsp
+    2c96:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2c9a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Optional(Phantom<Tag::SOME>(), forward<T>(v));
+    2c9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ca2:	48 89 c7             	mov    %rax,%rdi
+    2ca5:	e8 8f 08 00 00       	call   3539 <int& nel::forward<int&, int>(int&)>
+    2caa:	48 89 c2             	mov    %rax,%rdx
+    2cad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cb1:	48 89 d6             	mov    %rdx,%rsi
+    2cb4:	48 89 c7             	mov    %rax,%rdi
+    2cb7:	e8 bc 09 00 00       	call   3678 <nel::Optional<int&>::Optional(nel::Optional<int&>::Phantom<(nel::Optional<int&>::Tag)2>, int&)>
+        }
+    2cbc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cc0:	c9                   	leave
+    2cc1:	c3                   	ret
+
+0000000000002cc2 <nel::Optional<int&>::Optional(nel::NoneT const&)>:
+        constexpr Optional(NoneT const &)
+    2cc2:	55                   	push   %rbp
+    2cc3:	48 89 e5             	mov    %rsp,%rbp
+    2cc6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2cca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : tag_(Tag::NONE)
+    2cce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cd2:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+        }
+    2cd8:	90                   	nop
+    2cd9:	5d                   	pop    %rbp
+    2cda:	c3                   	ret
+    2cdb:	90                   	nop
+
+0000000000002cdc <bool nel::Optional<int&>::match<bool, nel::Optional<int&>::is_some() const::{lambda(int&)#1}, nel::Optional<int&>::is_some() const::{lambda()#2}>(nel::Optional<int&>::is_some() const::{lambda(int&)#1}&&, nel::Optional<int&>::is_some() const::{lambda()#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_some, Fn2 &&on_none, Context const &ctx = Context()) const
+    2cdc:	             55                   	push   %rbp
+    2cdd:	             48 89 e5             	mov    %rsp,%rbp
+    2ce0:	             48 83 ec 20          	sub    $0x20,%rsp
+    2ce4:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2ce8:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2cec:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2cf0:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // optional::match
+    2cf4:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cf8:	             8b 00                	mov    (%rax),%eax
+    2cfa:	             83 f8 02             	cmp    $0x2,%eax
+    2cfd:	         /-- 74 10                	je     2d0f <bool nel::Optional<int&>::match<bool, nel::Optional<int&>::is_some() const::{lambda(int&)#1}, nel::Optional<int&>::is_some() const::{lambda()#2}>(nel::Optional<int&>::is_some() const::{lambda(int&)#1}&&, nel::Optional<int&>::is_some() const::{lambda()#2}&&, nel::Context const&) const+0x33>
+    2cff:	         |   83 f8 02             	cmp    $0x2,%eax
+    2d02:	/--------|-- 7f 53                	jg     2d57 <bool nel::Optional<int&>::match<bool, nel::Optional<int&>::is_some() const::{lambda(int&)#1}, nel::Optional<int&>::is_some() const::{lambda()#2}>(nel::Optional<int&>::is_some() const::{lambda(int&)#1}&&, nel::Optional<int&>::is_some() const::{lambda()#2}&&, nel::Context const&) const+0x7b>
+    2d04:	|        |   85 c0                	test   %eax,%eax
+    2d06:	|  /-----|-- 74 39                	je     2d41 <bool nel::Optional<int&>::match<bool, nel::Optional<int&>::is_some() const::{lambda(int&)#1}, nel::Optional<int&>::is_some() const::{lambda()#2}>(nel::Optional<int&>::is_some() const::{lambda(int&)#1}&&, nel::Optional<int&>::is_some() const::{lambda()#2}&&, nel::Context const&) const+0x65>
+    2d08:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    2d0b:	|  |  /--|-- 74 26                	je     2d33 <bool nel::Optional<int&>::match<bool, nel::Optional<int&>::is_some() const::{lambda(int&)#1}, nel::Optional<int&>::is_some() const::{lambda()#2}>(nel::Optional<int&>::is_some() const::{lambda(int&)#1}&&, nel::Optional<int&>::is_some() const::{lambda()#2}&&, nel::Context const&) const+0x57>
+    2d0d:	+--|--|--|-- eb 48                	jmp    2d57 <bool nel::Optional<int&>::match<bool, nel::Optional<int&>::is_some() const::{lambda(int&)#1}, nel::Optional<int&>::is_some() const::{lambda()#2}>(nel::Optional<int&>::is_some() const::{lambda(int&)#1}&&, nel::Optional<int&>::is_some() const::{lambda()#2}&&, nel::Context const&) const+0x7b>
+                    return on_some(*some_);
+    2d0f:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d13:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    2d17:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2d1a:	|  |  |      e8 9b 09 00 00       	call   36ba <nel::Element<int&>::operator*() const>
+    2d1f:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    2d22:	|  |  |      48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2d26:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    2d29:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2d2c:	|  |  |      e8 7d f6 ff ff       	call   23ae <nel::Optional<int&>::is_some() const::{lambda(int&)#1}::operator()(int&) const>
+    2d31:	|  |  |  /-- eb 3a                	jmp    2d6d <bool nel::Optional<int&>::match<bool, nel::Optional<int&>::is_some() const::{lambda(int&)#1}, nel::Optional<int&>::is_some() const::{lambda()#2}>(nel::Optional<int&>::is_some() const::{lambda(int&)#1}&&, nel::Optional<int&>::is_some() const::{lambda()#2}&&, nel::Context const&) const+0x91>
+                    return on_none();
+    2d33:	|  |  \--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d37:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2d3a:	|  |     |   e8 83 f6 ff ff       	call   23c2 <nel::Optional<int&>::is_some() const::{lambda()#2}::operator()() const>
+    2d3f:	|  |     +-- eb 2c                	jmp    2d6d <bool nel::Optional<int&>::match<bool, nel::Optional<int&>::is_some() const::{lambda(int&)#1}, nel::Optional<int&>::is_some() const::{lambda()#2}>(nel::Optional<int&>::is_some() const::{lambda(int&)#1}&&, nel::Optional<int&>::is_some() const::{lambda()#2}&&, nel::Context const&) const+0x91>
+                    nel::panic("invalid Optional", ctx);
+    2d41:	|  \-----|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2d45:	|        |   48 89 c6             	mov    %rax,%rsi
+    2d48:	|        |   48 8d 05 4f 24 00 00 	lea    0x244f(%rip),%rax        # 519e <max_linear+0x10e>
+    2d4f:	|        |   48 89 c7             	mov    %rax,%rdi
+    2d52:	|        |   e8 da 0e 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Optional", ctx);
+    2d57:	\--------|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2d5b:	         |   48 89 c6             	mov    %rax,%rsi
+    2d5e:	         |   48 8d 05 0f 24 00 00 	lea    0x240f(%rip),%rax        # 5174 <max_linear+0xe4>
+    2d65:	         |   48 89 c7             	mov    %rax,%rdi
+    2d68:	         |   e8 c4 0e 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+        }
+    2d6d:	         \-> c9                   	leave
+    2d6e:	             c3                   	ret
+    2d6f:	             90                   	nop
+
+0000000000002d70 <nel::Slice<int>::checked_get(unsigned long) const>:
+        constexpr Type &checked_get(Index idx) const
+    2d70:	55                   	push   %rbp
+    2d71:	48 89 e5             	mov    %rsp,%rbp
+    2d74:	48 83 ec 30          	sub    $0x30,%rsp
+    2d78:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    2d7c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+            nel::panic_if_not(idx < len(), "nel::Slice<T>: index out of range");
+    2d80:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2d84:	b9 d6 00 00 00       	mov    $0xd6,%ecx
+    2d89:	48 8d 15 1f 24 00 00 	lea    0x241f(%rip),%rdx        # 51af <max_linear+0x11f>
+    2d90:	48 8d 35 29 24 00 00 	lea    0x2429(%rip),%rsi        # 51c0 <max_linear+0x130>
+    2d97:	48 89 c7             	mov    %rax,%rdi
+    2d9a:	e8 6f ef ff ff       	call   1d0e <nel::Context::Context(char const*, char const*, int)>
+    2d9f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2da3:	48 89 c7             	mov    %rax,%rdi
+    2da6:	e8 35 00 00 00       	call   2de0 <nel::Slice<int>::len() const>
+    2dab:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+    2daf:	0f 92 c0             	setb   %al
+    2db2:	0f b6 c0             	movzbl %al,%eax
+    2db5:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    2db9:	48 8d 0d 10 24 00 00 	lea    0x2410(%rip),%rcx        # 51d0 <max_linear+0x140>
+    2dc0:	48 89 ce             	mov    %rcx,%rsi
+    2dc3:	89 c7                	mov    %eax,%edi
+    2dc5:	e8 7b ef ff ff       	call   1d45 <nel::panic_if_not(bool, char const*, nel::Context const&)>
+            return unchecked_get(idx);
+    2dca:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    2dce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2dd2:	48 89 d6             	mov    %rdx,%rsi
+    2dd5:	48 89 c7             	mov    %rax,%rdi
+    2dd8:	e8 f7 08 00 00       	call   36d4 <nel::Slice<int>::unchecked_get(unsigned long) const>
+        }
+    2ddd:	c9                   	leave
+    2dde:	c3                   	ret
+    2ddf:	90                   	nop
+
+0000000000002de0 <nel::Slice<int>::len() const>:
+        constexpr Length len(void) const
+    2de0:	55                   	push   %rbp
+    2de1:	48 89 e5             	mov    %rsp,%rbp
+    2de4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    2de8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2dec:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    2df0:	5d                   	pop    %rbp
+    2df1:	c3                   	ret
+
+0000000000002df2 <nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}::operator()(int const&) const>:
+    auto pred = [&key, &less](T const &v) -> bool { return less(v, key); };
+    2df2:	55                   	push   %rbp
+    2df3:	48 89 e5             	mov    %rsp,%rbp
+    2df6:	48 83 ec 10          	sub    $0x10,%rsp
+    2dfa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2dfe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2e02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e06:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2e0a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2e0e:	48 8b 12             	mov    (%rdx),%rdx
+    2e11:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2e15:	48 89 ce             	mov    %rcx,%rsi
+    2e18:	48 89 c7             	mov    %rax,%rdi
+    2e1b:	e8 44 00 00 00       	call   2e64 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    2e20:	c9                   	leave
+    2e21:	c3                   	ret
+
+0000000000002e22 <unsigned long nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)>:
+Index lower_bound(T const p[], Length const n, T const &key, F &less)
+    2e22:	55                   	push   %rbp
+    2e23:	48 89 e5             	mov    %rsp,%rbp
+    2e26:	48 83 ec 30          	sub    $0x30,%rsp
+    2e2a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2e2e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2e32:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    2e36:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    auto pred = [&key, &less](T const &v) -> bool { return less(v, key); };
+    2e3a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2e3e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2e42:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2e46:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return partition_point(p, n, pred);
+    2e4a:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    2e4e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2e52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e56:	48 89 ce             	mov    %rcx,%rsi
+    2e59:	48 89 c7             	mov    %rax,%rdi
+    2e5c:	e8 93 08 00 00       	call   36f4 <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)>
+}
+    2e61:	c9                   	leave
+    2e62:	c3                   	ret
+    2e63:	90                   	nop
+
+0000000000002e64 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>:
+ * The default comparator, a < b.
+ */
+struct Less
+{
+        template<typename T>
+        constexpr bool operator()(T const &a, T const &b) const
+    2e64:	55                   	push   %rbp
+    2e65:	48 89 e5             	mov    %rsp,%rbp
+    2e68:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2e6c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2e70:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            return a < b;
+    2e74:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e78:	8b 10                	mov    (%rax),%edx
+    2e7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e7e:	8b 00                	mov    (%rax),%eax
+    2e80:	39 c2                	cmp    %eax,%edx
+    2e82:	0f 9c c0             	setl   %al
+        }
+    2e85:	5d                   	pop    %rbp
+    2e86:	c3                   	ret
+
+0000000000002e87 <nel::Result<unsigned long, unsigned long> nel::Result<unsigned long, unsigned long>::Ok<unsigned long const&>(unsigned long const&)>:
+        constexpr static Result Ok(Args &&...args)
+    2e87:	55                   	push   %rbp
+    2e88:	48 89 e5             	mov    %rsp,%rbp
+    2e8b:	48 83 ec 10          	sub    $0x10,%rsp
+    2e8f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2e93:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<Args>(args)...);
+    2e97:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e9b:	48 89 c7             	mov    %rax,%rdi
+    2e9e:	e8 6c 09 00 00       	call   380f <unsigned long const& nel::forward<unsigned long const&, unsigned long const>(unsigned long const&)>
+    2ea3:	48 89 c2             	mov    %rax,%rdx
+    2ea6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2eaa:	48 89 d6             	mov    %rdx,%rsi
+    2ead:	48 89 c7             	mov    %rax,%rdi
+    2eb0:	e8 69 09 00 00       	call   381e <nel::Result<unsigned long, unsigned long>::Result<unsigned long const&>(nel::Result<unsigned long, unsigned long>::Phantom<(nel::Result<unsigned long, unsigned long>::Tag)1>, unsigned long const&)>
+        }
+    2eb5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2eb9:	c9                   	leave
+    2eba:	c3                   	ret
+
+0000000000002ebb <nel::Result<unsigned long, unsigned long> nel::Result<unsigned long, unsigned long>::Err<unsigned long const&>(unsigned long const&)>:
+        constexpr static Result Err(Args &&...args)
+    2ebb:	55                   	push   %rbp
+    2ebc:	48 89 e5             	mov    %rsp,%rbp
+    2ebf:	48 83 ec 10          	sub    $0x10,%rsp
+    2ec3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2ec7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    2ecb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ecf:	48 89 c7             	mov    %rax,%rdi
+    2ed2:	e8 38 09 00 00       	call   380f <unsigned long const& nel::forward<unsigned long const&, unsigned long const>(unsigned long const&)>
+    2ed7:	48 89 c2             	mov    %rax,%rdx
+    2eda:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ede:	48 89 d6             	mov    %rdx,%rsi
+    2ee1:	48 89 c7             	mov    %rax,%rdi
+    2ee4:	e8 77 09 00 00       	call   3860 <nel::Result<unsigned long, unsigned long>::Result<unsigned long const&>(nel::Result<unsigned long, unsigned long>::Phantom<(nel::Result<unsigned long, unsigned long>::Tag)2>, unsigned long const&)>
+        }
+    2ee9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2eed:	c9                   	leave
+    2eee:	c3                   	ret
+    2eef:	90                   	nop
+
+0000000000002ef0 <nel::Element<unsigned long>::ref() const>:
+        constexpr Type const &ref(void) const
+    2ef0:	55                   	push   %rbp
+    2ef1:	48 89 e5             	mov    %rsp,%rbp
+    2ef4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2ef8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2efc:	5d                   	pop    %rbp
+    2efd:	c3                   	ret
+
+0000000000002efe <unsigned long&& nel::forward<unsigned long, unsigned long>(unsigned long&)>:
+constexpr U &&forward(T &t)
+    2efe:	55                   	push   %rbp
+    2eff:	48 89 e5             	mov    %rsp,%rbp
+    2f02:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    2f06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2f0a:	5d                   	pop    %rbp
+    2f0b:	c3                   	ret
+
+0000000000002f0c <unsigned long nel::Result<unsigned long, unsigned long>::consume<unsigned long, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#1}, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#2}>(nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#1}&&, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    2f0c:	             55                   	push   %rbp
+    2f0d:	             48 89 e5             	mov    %rsp,%rbp
+    2f10:	             48 83 ec 30          	sub    $0x30,%rsp
+    2f14:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2f18:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2f1c:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    2f20:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    2f24:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f28:	             8b 00                	mov    (%rax),%eax
+    2f2a:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    2f2d:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f31:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    2f37:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    2f3b:	         /-- 74 3e                	je     2f7b <unsigned long nel::Result<unsigned long, unsigned long>::consume<unsigned long, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#1}, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#2}>(nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#1}&&, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#2}&&, nel::Context const&)+0x6f>
+    2f3d:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    2f41:	/--------|-- 7f 7a                	jg     2fbd <unsigned long nel::Result<unsigned long, unsigned long>::consume<unsigned long, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#1}, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#2}>(nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#1}&&, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#2}&&, nel::Context const&)+0xb1>
+    2f43:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2f47:	|  /-----|-- 74 5e                	je     2fa7 <unsigned long nel::Result<unsigned long, unsigned long>::consume<unsigned long, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#1}, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#2}>(nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#1}&&, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#2}&&, nel::Context const&)+0x9b>
+    2f49:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    2f4d:	+--|-----|-- 75 6e                	jne    2fbd <unsigned long nel::Result<unsigned long, unsigned long>::consume<unsigned long, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#1}, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#2}>(nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#1}&&, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#2}&&, nel::Context const&)+0xb1>
+                    return on_ok(forward<T>(*ok_));
+    2f4f:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f53:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    2f57:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2f5a:	|  |     |   e8 43 09 00 00       	call   38a2 <nel::Element<unsigned long>::operator*()>
+    2f5f:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2f62:	|  |     |   e8 97 ff ff ff       	call   2efe <unsigned long&& nel::forward<unsigned long, unsigned long>(unsigned long&)>
+    2f67:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    2f6a:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2f6e:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    2f71:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2f74:	|  |     |   e8 17 f6 ff ff       	call   2590 <nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#1}::operator()(unsigned long&&) const>
+    2f79:	|  |  /--|-- eb 58                	jmp    2fd3 <unsigned long nel::Result<unsigned long, unsigned long>::consume<unsigned long, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#1}, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#2}>(nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#1}&&, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#2}&&, nel::Context const&)+0xc7>
+                    return on_err(forward<E>(*err_));
+    2f7b:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f7f:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    2f83:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2f86:	|  |  |      e8 17 09 00 00       	call   38a2 <nel::Element<unsigned long>::operator*()>
+    2f8b:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2f8e:	|  |  |      e8 6b ff ff ff       	call   2efe <unsigned long&& nel::forward<unsigned long, unsigned long>(unsigned long&)>
+    2f93:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    2f96:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2f9a:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    2f9d:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2fa0:	|  |  |      e8 0d f6 ff ff       	call   25b2 <nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#2}::operator()(unsigned long&&) const>
+    2fa5:	|  |  +----- eb 2c                	jmp    2fd3 <unsigned long nel::Result<unsigned long, unsigned long>::consume<unsigned long, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#1}, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#2}>(nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#1}&&, nel::Result<unsigned long, unsigned long>::unwrap(nel::Context const&)::{lambda(unsigned long&&)#2}&&, nel::Context const&)+0xc7>
+                    nel::panic("invalid Result", ctx);
+    2fa7:	|  \--|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2fab:	|     |      48 89 c6             	mov    %rax,%rsi
+    2fae:	|     |      48 8d 05 e3 20 00 00 	lea    0x20e3(%rip),%rax        # 5098 <max_linear+0x8>
+    2fb5:	|     |      48 89 c7             	mov    %rax,%rdi
+    2fb8:	|     |      e8 74 0c 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    2fbd:	\-----|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2fc1:	      |      48 89 c6             	mov    %rax,%rsi
+    2fc4:	      |      48 8d 05 dc 20 00 00 	lea    0x20dc(%rip),%rax        # 50a7 <max_linear+0x17>
+    2fcb:	      |      48 89 c7             	mov    %rax,%rdi
+    2fce:	      |      e8 5e 0c 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+        }
+    2fd3:	      \----> c9                   	leave
+    2fd4:	             c3                   	ret
+    2fd5:	             90                   	nop
+
+0000000000002fd6 <unsigned long nel::Result<unsigned long, unsigned long>::consume<unsigned long, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#1}, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#2}>(nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#1}&&, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    2fd6:	             55                   	push   %rbp
+    2fd7:	             48 89 e5             	mov    %rsp,%rbp
+    2fda:	             48 83 ec 30          	sub    $0x30,%rsp
+    2fde:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2fe2:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2fe6:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    2fea:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    2fee:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ff2:	             8b 00                	mov    (%rax),%eax
+    2ff4:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    2ff7:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ffb:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    3001:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    3005:	         /-- 74 3e                	je     3045 <unsigned long nel::Result<unsigned long, unsigned long>::consume<unsigned long, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#1}, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#2}>(nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#1}&&, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#2}&&, nel::Context const&)+0x6f>
+    3007:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    300b:	/--------|-- 7f 7a                	jg     3087 <unsigned long nel::Result<unsigned long, unsigned long>::consume<unsigned long, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#1}, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#2}>(nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#1}&&, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#2}&&, nel::Context const&)+0xb1>
+    300d:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    3011:	|  /-----|-- 74 5e                	je     3071 <unsigned long nel::Result<unsigned long, unsigned long>::consume<unsigned long, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#1}, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#2}>(nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#1}&&, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#2}&&, nel::Context const&)+0x9b>
+    3013:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    3017:	+--|-----|-- 75 6e                	jne    3087 <unsigned long nel::Result<unsigned long, unsigned long>::consume<unsigned long, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#1}, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#2}>(nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#1}&&, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#2}&&, nel::Context const&)+0xb1>
+                    return on_ok(forward<T>(*ok_));
+    3019:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    301d:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    3021:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    3024:	|  |     |   e8 79 08 00 00       	call   38a2 <nel::Element<unsigned long>::operator*()>
+    3029:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    302c:	|  |     |   e8 cd fe ff ff       	call   2efe <unsigned long&& nel::forward<unsigned long, unsigned long>(unsigned long&)>
+    3031:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    3034:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3038:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    303b:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    303e:	|  |     |   e8 cb f5 ff ff       	call   260e <nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#1}::operator()(unsigned long&&) const>
+    3043:	|  |  /--|-- eb 58                	jmp    309d <unsigned long nel::Result<unsigned long, unsigned long>::consume<unsigned long, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#1}, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#2}>(nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#1}&&, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#2}&&, nel::Context const&)+0xc7>
+                    return on_err(forward<E>(*err_));
+    3045:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3049:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    304d:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3050:	|  |  |      e8 4d 08 00 00       	call   38a2 <nel::Element<unsigned long>::operator*()>
+    3055:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3058:	|  |  |      e8 a1 fe ff ff       	call   2efe <unsigned long&& nel::forward<unsigned long, unsigned long>(unsigned long&)>
+    305d:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    3060:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3064:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    3067:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    306a:	|  |  |      e8 c9 f5 ff ff       	call   2638 <nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#2}::operator()(unsigned long&&) const>
+    306f:	|  |  +----- eb 2c                	jmp    309d <unsigned long nel::Result<unsigned long, unsigned long>::consume<unsigned long, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#1}, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#2}>(nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#1}&&, nel::Result<unsigned long, unsigned long>::unwrap_err(nel::Context const&)::{lambda(unsigned long&&)#2}&&, nel::Context const&)+0xc7>
+                    nel::panic("invalid Result", ctx);
+    3071:	|  \--|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3075:	|     |      48 89 c6             	mov    %rax,%rsi
+    3078:	|     |      48 8d 05 19 20 00 00 	lea    0x2019(%rip),%rax        # 5098 <max_linear+0x8>
+    307f:	|     |      48 89 c7             	mov    %rax,%rdi
+    3082:	|     |      e8 aa 0b 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    3087:	\-----|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    308b:	      |      48 89 c6             	mov    %rax,%rsi
+    308e:	      |      48 8d 05 12 20 00 00 	lea    0x2012(%rip),%rax        # 50a7 <max_linear+0x17>
+    3095:	      |      48 89 c7             	mov    %rax,%rdi
+    3098:	      |      e8 94 0b 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+        }
+    309d:	      \----> c9                   	leave
+    309e:	             c3                   	ret
+    309f:	             90                   	nop
+
+00000000000030a0 <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>:
+        constexpr Element(Type &&val)
+    30a0:	55                   	push   %rbp
+    30a1:	48 89 e5             	mov    %rsp,%rbp
+    30a4:	48 83 ec 10          	sub    $0x10,%rsp
+    30a8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    30ac:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    30b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    30b4:	48 89 c7             	mov    %rax,%rdi
+    30b7:	e8 93 f6 ff ff       	call   274f <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    30bc:	8b 10                	mov    (%rax),%edx
+    30be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30c2:	89 10                	mov    %edx,(%rax)
+        }
+    30c4:	90                   	nop
+    30c5:	c9                   	leave
+    30c6:	c3                   	ret
+    30c7:	90                   	nop
+
+00000000000030c8 <nel::Element<void*>::Element<void* const&>(void* const&)>:
+        constexpr Element(Args &&...args)
+    30c8:	55                   	push   %rbp
+    30c9:	48 89 e5             	mov    %rsp,%rbp
+    30cc:	48 83 ec 10          	sub    $0x10,%rsp
+    30d0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    30d4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Args>(args)...)
+    30d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    30dc:	48 89 c7             	mov    %rax,%rdi
+    30df:	e8 bb f6 ff ff       	call   279f <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    30e4:	48 8b 10             	mov    (%rax),%rdx
+    30e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30eb:	48 89 10             	mov    %rdx,(%rax)
+        }
+    30ee:	90                   	nop
+    30ef:	c9                   	leave
+    30f0:	c3                   	ret
+    30f1:	90                   	nop
+
+00000000000030f2 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>:
+            return match<bool>([](T const &) -> bool { return false; },
+    30f2:	55                   	push   %rbp
+    30f3:	48 89 e5             	mov    %rsp,%rbp
+    30f6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    30fa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    30fe:	b8 00 00 00 00       	mov    $0x0,%eax
+    3103:	5d                   	pop    %rbp
+    3104:	c3                   	ret
+    3105:	90                   	nop
+
+0000000000003106 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>:
+                               [](E const &) -> bool { return true; },
+    3106:	55                   	push   %rbp
+    3107:	48 89 e5             	mov    %rsp,%rbp
+    310a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    310e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3112:	b8 01 00 00 00       	mov    $0x1,%eax
+    3117:	5d                   	pop    %rbp
+    3118:	c3                   	ret
+    3119:	90                   	nop
+
+000000000000311a <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>:
+        constexpr bool is_err(Context const &ctx = Context()) const
+    311a:	55                   	push   %rbp
+    311b:	48 89 e5             	mov    %rsp,%rbp
+    311e:	48 83 ec 20          	sub    $0x20,%rsp
+    3122:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3126:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](T const &) -> bool { return false; },
+    312a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    312e:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    3132:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    3136:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    313a:	48 89 c7             	mov    %rax,%rdi
+    313d:	e8 02 00 00 00       	call   3144 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>
+        }
+    3142:	c9                   	leave
+    3143:	c3                   	ret
+
+0000000000003144 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    3144:	             55                   	push   %rbp
+    3145:	             48 89 e5             	mov    %rsp,%rbp
+    3148:	             48 83 ec 20          	sub    $0x20,%rsp
+    314c:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3150:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3154:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    3158:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result-match
+    315c:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3160:	             8b 00                	mov    (%rax),%eax
+    3162:	             83 f8 02             	cmp    $0x2,%eax
+    3165:	         /-- 74 32                	je     3199 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x55>
+    3167:	         |   83 f8 02             	cmp    $0x2,%eax
+    316a:	/--------|-- 7f 67                	jg     31d3 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+    316c:	|        |   85 c0                	test   %eax,%eax
+    316e:	|     /--|-- 74 4d                	je     31bd <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x79>
+    3170:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    3173:	+-----|--|-- 75 5e                	jne    31d3 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_ok(*ok_);
+    3175:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3179:	|     |  |   48 83 c0 08          	add    $0x8,%rax
+    317d:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    3180:	|     |  |   e8 37 07 00 00       	call   38bc <nel::Element<void*>::operator*() const>
+    3185:	|     |  |   48 89 c2             	mov    %rax,%rdx
+    3188:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    318c:	|     |  |   48 89 d6             	mov    %rdx,%rsi
+    318f:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    3192:	|     |  |   e8 5b ff ff ff       	call   30f2 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>
+    3197:	|  /--|--|-- eb 50                	jmp    31e9 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    return on_err(*err_);
+    3199:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    319d:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    31a1:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    31a4:	|  |  |      e8 2d 07 00 00       	call   38d6 <nel::Element<nel::heaped::AllocError>::operator*() const>
+    31a9:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    31ac:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31b0:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    31b3:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    31b6:	|  |  |      e8 4b ff ff ff       	call   3106 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>
+    31bb:	|  +--|----- eb 2c                	jmp    31e9 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    nel::panic("invalid Result", ctx);
+    31bd:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    31c1:	|  |         48 89 c6             	mov    %rax,%rsi
+    31c4:	|  |         48 8d 05 cd 1e 00 00 	lea    0x1ecd(%rip),%rax        # 5098 <max_linear+0x8>
+    31cb:	|  |         48 89 c7             	mov    %rax,%rdi
+    31ce:	|  |         e8 5e 0a 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    31d3:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    31d7:	   |         48 89 c6             	mov    %rax,%rsi
+    31da:	   |         48 8d 05 c6 1e 00 00 	lea    0x1ec6(%rip),%rax        # 50a7 <max_linear+0x17>
+    31e1:	   |         48 89 c7             	mov    %rax,%rdi
+    31e4:	   |         e8 48 0a 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+        }
+    31e9:	   \-------> c9                   	leave
+    31ea:	             c3                   	ret
+
+00000000000031eb <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>:
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    31eb:	          55                   	push   %rbp
+    31ec:	          48 89 e5             	mov    %rsp,%rbp
+    31ef:	          41 54                	push   %r12
+    31f1:	          53                   	push   %rbx
+    31f2:	          48 83 ec 70          	sub    $0x70,%rsp
+    31f6:	          48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+    31fa:	          48 89 75 80          	mov    %rsi,-0x80(%rbp)
+            if (new_cap > max_capacity) { return nullptr; }
+    31fe:	          48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    3205:	          ff ff 1f 
+    3208:	          48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    320c:	      /-- 73 0a                	jae    3218 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x2d>
+    320e:	      |   bb 00 00 00 00       	mov    $0x0,%ebx
+    3213:	/-----|-- e9 1d 01 00 00       	jmp    3335 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x14a>
+            Length const new_sz = size_of(new_cap);
+    3218:	|     \-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    321c:	|         48 89 c7             	mov    %rax,%rdi
+    321f:	|         e8 6a f6 ff ff       	call   288e <nel::heaped::Node<int, nel::heaped::Malloc>::size_of(unsigned long)>
+    3224:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            Length const old_sz = (old_n == nullptr) ? 0 : size_of(old_n->alloc_);
+    3228:	|         48 83 7d 88 00       	cmpq   $0x0,-0x78(%rbp)
+    322d:	|  /----- 74 11                	je     3240 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x55>
+    322f:	|  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3233:	|  |      48 8b 00             	mov    (%rax),%rax
+    3236:	|  |      48 89 c7             	mov    %rax,%rdi
+    3239:	|  |      e8 50 f6 ff ff       	call   288e <nel::heaped::Node<int, nel::heaped::Malloc>::size_of(unsigned long)>
+    323e:	|  |  /-- eb 05                	jmp    3245 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x5a>
+    3240:	|  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3245:	|     \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+                auto r = Allocator::try_realloc(old_n, alignof(Node), old_sz, new_sz);
+    3249:	|         48 8d 45 90          	lea    -0x70(%rbp),%rax
+    324d:	|         48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    3251:	|         48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    3255:	|         48 8b 75 88          	mov    -0x78(%rbp),%rsi
+    3259:	|         49 89 c8             	mov    %rcx,%r8
+    325c:	|         48 89 d1             	mov    %rdx,%rcx
+    325f:	|         ba 08 00 00 00       	mov    $0x8,%edx
+    3264:	|         48 89 c7             	mov    %rax,%rdi
+    3267:	|         e8 0f eb ff ff       	call   1d7b <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>
+                if (r.is_err()) { return nullptr; }
+    326c:	|         48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    3270:	|         b9 89 00 00 00       	mov    $0x89,%ecx
+    3275:	|         48 8d 15 76 1f 00 00 	lea    0x1f76(%rip),%rdx        # 51f2 <max_linear+0x162>
+    327c:	|         48 8d 35 86 1f 00 00 	lea    0x1f86(%rip),%rsi        # 5209 <max_linear+0x179>
+    3283:	|         48 89 c7             	mov    %rax,%rdi
+    3286:	|         e8 83 ea ff ff       	call   1d0e <nel::Context::Context(char const*, char const*, int)>
+    328b:	|         48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    328f:	|         48 8d 45 90          	lea    -0x70(%rbp),%rax
+    3293:	|         48 89 d6             	mov    %rdx,%rsi
+    3296:	|         48 89 c7             	mov    %rax,%rdi
+    3299:	|         e8 7c fe ff ff       	call   311a <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>
+    329e:	|         84 c0                	test   %al,%al
+    32a0:	|     /-- 74 0d                	je     32af <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0xc4>
+    32a2:	|     |   bb 00 00 00 00       	mov    $0x0,%ebx
+    32a7:	|     |   41 bc 00 00 00 00    	mov    $0x0,%r12d
+    32ad:	|  /--|-- eb 3c                	jmp    32eb <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x100>
+                new_n = reinterpret_cast<Node *>(r.unwrap());
+    32af:	|  |  \-> 48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    32b3:	|  |      b9 8a 00 00 00       	mov    $0x8a,%ecx
+    32b8:	|  |      48 8d 15 33 1f 00 00 	lea    0x1f33(%rip),%rdx        # 51f2 <max_linear+0x162>
+    32bf:	|  |      48 8d 35 43 1f 00 00 	lea    0x1f43(%rip),%rsi        # 5209 <max_linear+0x179>
+    32c6:	|  |      48 89 c7             	mov    %rax,%rdi
+    32c9:	|  |      e8 40 ea ff ff       	call   1d0e <nel::Context::Context(char const*, char const*, int)>
+    32ce:	|  |      48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    32d2:	|  |      48 8d 45 90          	lea    -0x70(%rbp),%rax
+    32d6:	|  |      48 89 d6             	mov    %rdx,%rsi
+    32d9:	|  |      48 89 c7             	mov    %rax,%rdi
+    32dc:	|  |      e8 5b 06 00 00       	call   393c <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+    32e1:	|  |      48 89 45 e8          	mov    %rax,-0x18(%rbp)
+            } else {
+    32e5:	|  |      41 bc 01 00 00 00    	mov    $0x1,%r12d
+    32eb:	|  \----> 48 8d 45 90          	lea    -0x70(%rbp),%rax
+    32ef:	|         48 89 c7             	mov    %rax,%rdi
+    32f2:	|         e8 b3 ec ff ff       	call   1faa <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+    32f7:	|         41 83 fc 01          	cmp    $0x1,%r12d
+    32fb:	+-------- 75 38                	jne    3335 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x14a>
+    32fd:	|         90                   	nop
+                if (new_sz > old_sz) {
+    32fe:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3302:	|         48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    3306:	|     /-- 73 1e                	jae    3326 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x13b>
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+    3308:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    330c:	|     |   48 2b 45 d8          	sub    -0x28(%rbp),%rax
+    3310:	|     |   48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    3314:	|     |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    3318:	|     |   48 01 ca             	add    %rcx,%rdx
+    331b:	|     |   48 89 c6             	mov    %rax,%rsi
+    331e:	|     |   48 89 d7             	mov    %rdx,%rdi
+    3321:	|     |   e8 8c 0a 00 00       	call   3db2 <nel::elem::wipe(unsigned char*, unsigned long)>
+            new_n->alloc_ = new_cap;
+    3326:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    332a:	|         48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    332e:	|         48 89 10             	mov    %rdx,(%rax)
+            return new_n;
+    3331:	|         48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+        }
+    3335:	\-------> 48 89 d8             	mov    %rbx,%rax
+    3338:	          48 83 c4 70          	add    $0x70,%rsp
+    333c:	          5b                   	pop    %rbx
+    333d:	          41 5c                	pop    %r12
+    333f:	          5d                   	pop    %rbp
+    3340:	          c3                   	ret
+
+0000000000003341 <nel::heaped::Node<int, nel::heaped::Malloc>*&& nel::move<nel::heaped::Node<int, nel::heaped::Malloc>*>(nel::heaped::Node<int, nel::heaped::Malloc>*&)>:
+constexpr T &&move(T &v)
+    3341:	55                   	push   %rbp
+    3342:	48 89 e5             	mov    %rsp,%rbp
+    3345:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    3349:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    334d:	5d                   	pop    %rbp
+    334e:	c3                   	ret
+    334f:	90                   	nop
+
+0000000000003350 <nel::heaped::Node<int, nel::heaped::Malloc>::~Node()>:
+        constexpr ~Node(void)
+    3350:	       55                   	push   %rbp
+    3351:	       48 89 e5             	mov    %rsp,%rbp
+    3354:	       48 83 ec 20          	sub    $0x20,%rsp
+    3358:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            for (Index i = 0; i < len(); ++i) {
+    335c:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    3363:	       00 
+    3364:	   /-- eb 05                	jmp    336b <nel::heaped::Node<int, nel::heaped::Malloc>::~Node()+0x1b>
+    3366:	/--|-> 48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    336b:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    336f:	|      48 89 c7             	mov    %rax,%rdi
+    3372:	|      e8 13 02 00 00       	call   358a <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    3377:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    337b:	|      0f 92 c0             	setb   %al
+    337e:	|      84 c0                	test   %al,%al
+    3380:	\----- 75 e4                	jne    3366 <nel::heaped::Node<int, nel::heaped::Malloc>::~Node()+0x16>
+        }
+    3382:	       90                   	nop
+    3383:	       90                   	nop
+    3384:	       c9                   	leave
+    3385:	       c3                   	ret
+
+0000000000003386 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>:
+        constexpr Length len(void) const
+    3386:	       55                   	push   %rbp
+    3387:	       48 89 e5             	mov    %rsp,%rbp
+    338a:	       48 83 ec 10          	sub    $0x10,%rsp
+    338e:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->len();
+    3392:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3396:	       48 8b 00             	mov    (%rax),%rax
+    3399:	       48 85 c0             	test   %rax,%rax
+    339c:	/----- 74 11                	je     33af <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x29>
+    339e:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33a2:	|      48 8b 00             	mov    (%rax),%rax
+    33a5:	|      48 89 c7             	mov    %rax,%rdi
+    33a8:	|      e8 dd 01 00 00       	call   358a <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    33ad:	|  /-- eb 05                	jmp    33b4 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x2e>
+    33af:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    33b4:	   \-> c9                   	leave
+    33b5:	       c3                   	ret
+
+00000000000033b6 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>:
+        constexpr Count capacity(void) const
+    33b6:	       55                   	push   %rbp
+    33b7:	       48 89 e5             	mov    %rsp,%rbp
+    33ba:	       48 83 ec 10          	sub    $0x10,%rsp
+    33be:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->capacity();
+    33c2:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33c6:	       48 8b 00             	mov    (%rax),%rax
+    33c9:	       48 85 c0             	test   %rax,%rax
+    33cc:	/----- 74 11                	je     33df <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x29>
+    33ce:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33d2:	|      48 8b 00             	mov    (%rax),%rax
+    33d5:	|      48 89 c7             	mov    %rax,%rdi
+    33d8:	|      e8 bf 01 00 00       	call   359c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    33dd:	|  /-- eb 05                	jmp    33e4 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x2e>
+    33df:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    33e4:	   \-> c9                   	leave
+    33e5:	       c3                   	ret
+
+00000000000033e6 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>:
+        bool try_reserve(Count new_cap)
+    33e6:	             55                   	push   %rbp
+    33e7:	             48 89 e5             	mov    %rsp,%rbp
+    33ea:	             48 83 ec 20          	sub    $0x20,%rsp
+    33ee:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    33f2:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            new_cap = Growth::capacity_for(capacity(), new_cap);
+    33f6:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    33fa:	             48 89 c7             	mov    %rax,%rdi
+    33fd:	             e8 b4 ff ff ff       	call   33b6 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    3402:	             48 89 c2             	mov    %rax,%rdx
+    3405:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3409:	             48 89 c6             	mov    %rax,%rsi
+    340c:	             48 89 d7             	mov    %rdx,%rdi
+    340f:	             e8 5a 05 00 00       	call   396e <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>
+    3414:	             48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (new_cap < len()) { new_cap = len(); }
+    3418:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    341c:	             48 89 c7             	mov    %rax,%rdi
+    341f:	             e8 62 ff ff ff       	call   3386 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    3424:	             48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    3428:	             0f 92 c0             	setb   %al
+    342b:	             84 c0                	test   %al,%al
+    342d:	         /-- 74 10                	je     343f <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x59>
+    342f:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3433:	         |   48 89 c7             	mov    %rax,%rdi
+    3436:	         |   e8 4b ff ff ff       	call   3386 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    343b:	         |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (item_ == nullptr) {
+    343f:	         \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3443:	             48 8b 00             	mov    (%rax),%rax
+    3446:	             48 85 c0             	test   %rax,%rax
+    3449:	         /-- 75 2d                	jne    3478 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x92>
+                item_ = VectorNode::malloc(new_cap);
+    344b:	         |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    344f:	         |   48 89 c7             	mov    %rax,%rdi
+    3452:	         |   e8 af f3 ff ff       	call   2806 <nel::heaped::Node<int, nel::heaped::Malloc>::malloc(unsigned long)>
+    3457:	         |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    345b:	         |   48 89 02             	mov    %rax,(%rdx)
+                if (item_ == nullptr) { return false; }
+    345e:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3462:	         |   48 8b 00             	mov    (%rax),%rax
+    3465:	         |   48 85 c0             	test   %rax,%rax
+    3468:	/--------|-- 0f 85 c4 00 00 00    	jne    3532 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+    346e:	|        |   b8 00 00 00 00       	mov    $0x0,%eax
+    3473:	|  /-----|-- e9 bf 00 00 00       	jmp    3537 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+            } else if (new_cap == item_->capacity()) {
+    3478:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    347c:	|  |         48 8b 00             	mov    (%rax),%rax
+    347f:	|  |         48 89 c7             	mov    %rax,%rdi
+    3482:	|  |         e8 15 01 00 00       	call   359c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    3487:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    348b:	|  |         0f 94 c0             	sete   %al
+    348e:	|  |         84 c0                	test   %al,%al
+    3490:	+--|-------- 0f 85 9c 00 00 00    	jne    3532 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap > item_->capacity()) {
+    3496:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    349a:	|  |         48 8b 00             	mov    (%rax),%rax
+    349d:	|  |         48 89 c7             	mov    %rax,%rdi
+    34a0:	|  |         e8 f7 00 00 00       	call   359c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    34a5:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    34a9:	|  |         0f 92 c0             	setb   %al
+    34ac:	|  |         84 c0                	test   %al,%al
+    34ae:	|  |  /----- 74 35                	je     34e5 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xff>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    34b0:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34b4:	|  |  |      48 8b 00             	mov    (%rax),%rax
+    34b7:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    34bb:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    34be:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    34c1:	|  |  |      e8 25 fd ff ff       	call   31eb <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    34c6:	|  |  |      48 89 45 f0          	mov    %rax,-0x10(%rbp)
+                if (p == nullptr) { return false; }
+    34ca:	|  |  |      48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    34cf:	|  |  |  /-- 75 07                	jne    34d8 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xf2>
+    34d1:	|  |  |  |   b8 00 00 00 00       	mov    $0x0,%eax
+    34d6:	|  +--|--|-- eb 5f                	jmp    3537 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    34d8:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34dc:	|  |  |      48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    34e0:	|  |  |      48 89 10             	mov    %rdx,(%rax)
+    34e3:	+--|--|----- eb 4d                	jmp    3532 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap < item_->capacity()) {
+    34e5:	|  |  \----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34e9:	|  |         48 8b 00             	mov    (%rax),%rax
+    34ec:	|  |         48 89 c7             	mov    %rax,%rdi
+    34ef:	|  |         e8 a8 00 00 00       	call   359c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    34f4:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    34f8:	|  |         0f 92 c0             	setb   %al
+    34fb:	|  |         84 c0                	test   %al,%al
+    34fd:	+--|-------- 74 33                	je     3532 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    34ff:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3503:	|  |         48 8b 00             	mov    (%rax),%rax
+    3506:	|  |         48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    350a:	|  |         48 89 d6             	mov    %rdx,%rsi
+    350d:	|  |         48 89 c7             	mov    %rax,%rdi
+    3510:	|  |         e8 d6 fc ff ff       	call   31eb <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    3515:	|  |         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                if (p == nullptr) { return false; }
+    3519:	|  |         48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    351e:	|  |     /-- 75 07                	jne    3527 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x141>
+    3520:	|  |     |   b8 00 00 00 00       	mov    $0x0,%eax
+    3525:	|  +-----|-- eb 10                	jmp    3537 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    3527:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    352b:	|  |         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    352f:	|  |         48 89 10             	mov    %rdx,(%rax)
+            return true;
+    3532:	\--|-------> b8 01 00 00 00       	mov    $0x1,%eax
+        }
+    3537:	   \-------> c9                   	leave
+    3538:	             c3                   	ret
+
+0000000000003539 <int& nel::forward<int&, int>(int&)>:
+constexpr U &&forward(T &t)
+    3539:	55                   	push   %rbp
+    353a:	48 89 e5             	mov    %rsp,%rbp
+    353d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    3541:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3545:	5d                   	pop    %rbp
+    3546:	c3                   	ret
+    3547:	90                   	nop
+
+0000000000003548 <nel::Result<void, int>::Result<int&>(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)2>, int&)>:
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+    3548:	55                   	push   %rbp
+    3549:	48 89 e5             	mov    %rsp,%rbp
+    354c:	53                   	push   %rbx
+    354d:	48 83 ec 18          	sub    $0x18,%rsp
+    3551:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3555:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    3559:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    355d:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<Args>(args)...)
+    3563:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3567:	48 8d 58 04          	lea    0x4(%rax),%rbx
+    356b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    356f:	48 89 c7             	mov    %rax,%rdi
+    3572:	e8 c2 ff ff ff       	call   3539 <int& nel::forward<int&, int>(int&)>
+    3577:	48 89 c6             	mov    %rax,%rsi
+    357a:	48 89 df             	mov    %rbx,%rdi
+    357d:	e8 38 04 00 00       	call   39ba <nel::Element<int>::Element<int&>(int&)>
+        }
+    3582:	90                   	nop
+    3583:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3587:	c9                   	leave
+    3588:	c3                   	ret
+    3589:	90                   	nop
+
+000000000000358a <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>:
+        constexpr Length len(void) const
+    358a:	55                   	push   %rbp
+    358b:	48 89 e5             	mov    %rsp,%rbp
+    358e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    3592:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3596:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    359a:	5d                   	pop    %rbp
+    359b:	c3                   	ret
+
+000000000000359c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>:
+        constexpr Count capacity(void) const
+    359c:	55                   	push   %rbp
+    359d:	48 89 e5             	mov    %rsp,%rbp
+    35a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return alloc_;
+    35a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    35a8:	48 8b 00             	mov    (%rax),%rax
+        }
+    35ab:	5d                   	pop    %rbp
+    35ac:	c3                   	ret
+
+00000000000035ad <nel::Result<void, int>::Ok()>:
+        constexpr static Result Ok(void)
+    35ad:	55                   	push   %rbp
+    35ae:	48 89 e5             	mov    %rsp,%rbp
+    35b1:	48 83 ec 10          	sub    $0x10,%rsp
+    35b5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Result(Phantom<Tag::OK>());
+    35b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    35bd:	48 89 c7             	mov    %rax,%rdi
+    35c0:	e8 1d 04 00 00       	call   39e2 <nel::Result<void, int>::Result(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)1>)>
+        }
+    35c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    35c9:	c9                   	leave
+    35ca:	c3                   	ret
+    35cb:	90                   	nop
+
+00000000000035cc <nel::Element<int>::operator*()>:
+
+        constexpr Type &operator*(void)
+    35cc:	55                   	push   %rbp
+    35cd:	48 89 e5             	mov    %rsp,%rbp
+    35d0:	48 83 ec 10          	sub    $0x10,%rsp
+    35d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    35d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    35dc:	48 89 c7             	mov    %rax,%rdi
+    35df:	e8 14 04 00 00       	call   39f8 <nel::Element<int>::ref()>
+        }
+    35e4:	c9                   	leave
+    35e5:	c3                   	ret
+
+00000000000035e6 <int&& nel::forward<int, int>(int&)>:
+constexpr U &&forward(T &t)
+    35e6:	55                   	push   %rbp
+    35e7:	48 89 e5             	mov    %rsp,%rbp
+    35ea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    35ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    35f2:	5d                   	pop    %rbp
+    35f3:	c3                   	ret
+
+00000000000035f4 <nel::Slice<int>::empty()>:
+        static constexpr Slice empty(void)
+    35f4:	55                   	push   %rbp
+    35f5:	48 89 e5             	mov    %rsp,%rbp
+    35f8:	48 83 ec 10          	sub    $0x10,%rsp
+    35fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Slice();
+    3600:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3604:	48 89 c7             	mov    %rax,%rdi
+    3607:	e8 fa 03 00 00       	call   3a06 <nel::Slice<int>::Slice()>
+        }
+    360c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3610:	c9                   	leave
+    3611:	c3                   	ret
+
+0000000000003612 <nel::heaped::Node<int, nel::heaped::Malloc>::slice()>:
+        constexpr Slice<Type> slice(void)
+    3612:	55                   	push   %rbp
+    3613:	48 89 e5             	mov    %rsp,%rbp
+    3616:	48 83 ec 10          	sub    $0x10,%rsp
+    361a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    361e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Slice(values_, len());
+    3622:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3626:	48 89 c7             	mov    %rax,%rdi
+    3629:	e8 5c ff ff ff       	call   358a <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    362e:	48 89 c2             	mov    %rax,%rdx
+    3631:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3635:	48 8d 48 10          	lea    0x10(%rax),%rcx
+    3639:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    363d:	48 89 ce             	mov    %rcx,%rsi
+    3640:	48 89 c7             	mov    %rax,%rdi
+    3643:	e8 06 00 00 00       	call   364e <nel::Slice<int>::Slice(int*, unsigned long)>
+        }
+    3648:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    364c:	c9                   	leave
+    364d:	c3                   	ret
+
+000000000000364e <nel::Slice<int>::Slice(int*, unsigned long)>:
+        constexpr Slice(Type *const p, Length len)
+    364e:	55                   	push   %rbp
+    364f:	48 89 e5             	mov    %rsp,%rbp
+    3652:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3656:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    365a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : content_(p)
+    365e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3662:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3666:	48 89 10             	mov    %rdx,(%rax)
+            , len_(len)
+    3669:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    366d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3671:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    3675:	90                   	nop
+    3676:	5d                   	pop    %rbp
+    3677:	c3                   	ret
+
+0000000000003678 <nel::Optional<int&>::Optional(nel::Optional<int&>::Phantom<(nel::Optional<int&>::Tag)2>, int&)>:
+        constexpr Optional(Phantom<Tag::SOME> const, T &&v)
+    3678:	55                   	push   %rbp
+    3679:	48 89 e5             	mov    %rsp,%rbp
+    367c:	53                   	push   %rbx
+    367d:	48 83 ec 18          	sub    $0x18,%rsp
+    3681:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3685:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::SOME)
+    3689:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    368d:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , some_(forward<T>(v))
+    3693:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3697:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    369b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    369f:	48 89 c7             	mov    %rax,%rdi
+    36a2:	e8 92 fe ff ff       	call   3539 <int& nel::forward<int&, int>(int&)>
+    36a7:	48 89 c6             	mov    %rax,%rsi
+    36aa:	48 89 df             	mov    %rbx,%rdi
+    36ad:	e8 76 03 00 00       	call   3a28 <nel::Element<int&>::Element(int&)>
+        }
+    36b2:	90                   	nop
+    36b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    36b7:	c9                   	leave
+    36b8:	c3                   	ret
+    36b9:	90                   	nop
+
+00000000000036ba <nel::Element<int&>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    36ba:	55                   	push   %rbp
+    36bb:	48 89 e5             	mov    %rsp,%rbp
+    36be:	48 83 ec 10          	sub    $0x10,%rsp
+    36c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    36c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    36ca:	48 89 c7             	mov    %rax,%rdi
+    36cd:	e8 7c 03 00 00       	call   3a4e <nel::Element<int&>::ref() const>
+        }
+    36d2:	c9                   	leave
+    36d3:	c3                   	ret
+
+00000000000036d4 <nel::Slice<int>::unchecked_get(unsigned long) const>:
+        constexpr Type &unchecked_get(Index idx) const
+    36d4:	55                   	push   %rbp
+    36d5:	48 89 e5             	mov    %rsp,%rbp
+    36d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    36dc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return content_[idx];
+    36e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    36e4:	48 8b 00             	mov    (%rax),%rax
+    36e7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    36eb:	48 c1 e2 02          	shl    $0x2,%rdx
+    36ef:	48 01 d0             	add    %rdx,%rax
+        }
+    36f2:	5d                   	pop    %rbp
+    36f3:	c3                   	ret
+
+00000000000036f4 <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)>:
+Index partition_point(T const p[], Length n, F &pred)
+    36f4:	                55                   	push   %rbp
+    36f5:	                48 89 e5             	mov    %rsp,%rbp
+    36f8:	                53                   	push   %rbx
+    36f9:	                48 83 ec 38          	sub    $0x38,%rsp
+    36fd:	                48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    3701:	                48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    3705:	                48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    if (n == 0) { return 0; }
+    3709:	                48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    370e:	            /-- 75 0a                	jne    371a <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0x26>
+    3710:	            |   b8 00 00 00 00       	mov    $0x0,%eax
+    3715:	/-----------|-- e9 ef 00 00 00       	jmp    3809 <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0x115>
+    T const *b = p;
+    371a:	|           \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    371e:	|               48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (n > 1) {
+    3722:	|     /-------- e9 a2 00 00 00       	jmp    37c9 <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0xd5>
+        Length const h = n / 2;
+    3727:	|  /--|-------> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    372b:	|  |  |         48 d1 e8             	shr    %rax
+    372e:	|  |  |         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        if (h * sizeof(T) > prefetch_bytes) {
+    3732:	|  |  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3736:	|  |  |         48 c1 e0 02          	shl    $0x2,%rax
+    373a:	|  |  |         48 3d 00 01 00 00    	cmp    $0x100,%rax
+    3740:	|  |  |     /-- 76 3c                	jbe    377e <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0x8a>
+                reinterpret_cast<void const *>(uintptr_t(b) + (h / 2) * sizeof(T)));
+    3742:	|  |  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3746:	|  |  |     |   48 d1 e8             	shr    %rax
+    3749:	|  |  |     |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3750:	|  |  |     |   00 
+    3751:	|  |  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3755:	|  |  |     |   48 01 d0             	add    %rdx,%rax
+            __builtin_prefetch(
+    3758:	|  |  |     |   0f 18 08             	prefetcht0 (%rax)
+                reinterpret_cast<void const *>(uintptr_t(b) + (h + h / 2) * sizeof(T)));
+    375b:	|  |  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    375f:	|  |  |     |   48 d1 e8             	shr    %rax
+    3762:	|  |  |     |   48 89 c2             	mov    %rax,%rdx
+    3765:	|  |  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3769:	|  |  |     |   48 01 d0             	add    %rdx,%rax
+    376c:	|  |  |     |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3773:	|  |  |     |   00 
+    3774:	|  |  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3778:	|  |  |     |   48 01 d0             	add    %rdx,%rax
+            __builtin_prefetch(
+    377b:	|  |  |     |   0f 18 08             	prefetcht0 (%rax)
+        b = pred(b[h]) ? b + h : b;
+    377e:	|  |  |     \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3782:	|  |  |         48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3789:	|  |  |         00 
+    378a:	|  |  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    378e:	|  |  |         48 01 c2             	add    %rax,%rdx
+    3791:	|  |  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3795:	|  |  |         48 89 d6             	mov    %rdx,%rsi
+    3798:	|  |  |         48 89 c7             	mov    %rax,%rdi
+    379b:	|  |  |         e8 52 f6 ff ff       	call   2df2 <nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}::operator()(int const&) const>
+    37a0:	|  |  |         84 c0                	test   %al,%al
+    37a2:	|  |  |  /----- 74 15                	je     37b9 <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0xc5>
+    37a4:	|  |  |  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    37a8:	|  |  |  |      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    37af:	|  |  |  |      00 
+    37b0:	|  |  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    37b4:	|  |  |  |      48 01 d0             	add    %rdx,%rax
+    37b7:	|  |  |  |  /-- eb 04                	jmp    37bd <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0xc9>
+    37b9:	|  |  |  \--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    37bd:	|  |  |     \-> 48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        n -= h;
+    37c1:	|  |  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    37c5:	|  |  |         48 29 45 d0          	sub    %rax,-0x30(%rbp)
+    while (n > 1) {
+    37c9:	|  |  \-------> 48 83 7d d0 01       	cmpq   $0x1,-0x30(%rbp)
+    37ce:	|  \----------- 0f 87 53 ff ff ff    	ja     3727 <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0x33>
+    return Index(b - p) + (pred(*b) ? 1 : 0);
+    37d4:	|               48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    37d8:	|               48 2b 45 d8          	sub    -0x28(%rbp),%rax
+    37dc:	|               48 c1 f8 02          	sar    $0x2,%rax
+    37e0:	|               48 89 c3             	mov    %rax,%rbx
+    37e3:	|               48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    37e7:	|               48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    37eb:	|               48 89 d6             	mov    %rdx,%rsi
+    37ee:	|               48 89 c7             	mov    %rax,%rdi
+    37f1:	|               e8 fc f5 ff ff       	call   2df2 <nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}::operator()(int const&) const>
+    37f6:	|               84 c0                	test   %al,%al
+    37f8:	|        /----- 74 07                	je     3801 <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0x10d>
+    37fa:	|        |      b8 01 00 00 00       	mov    $0x1,%eax
+    37ff:	|        |  /-- eb 05                	jmp    3806 <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0x112>
+    3801:	|        \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3806:	|           \-> 48 01 d8             	add    %rbx,%rax
+}
+    3809:	\-------------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    380d:	                c9                   	leave
+    380e:	                c3                   	ret
+
+000000000000380f <unsigned long const& nel::forward<unsigned long const&, unsigned long const>(unsigned long const&)>:
+constexpr U &&forward(T &t)
+    380f:	55                   	push   %rbp
+    3810:	48 89 e5             	mov    %rsp,%rbp
+    3813:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    3817:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    381b:	5d                   	pop    %rbp
+    381c:	c3                   	ret
+    381d:	90                   	nop
+
+000000000000381e <nel::Result<unsigned long, unsigned long>::Result<unsigned long const&>(nel::Result<unsigned long, unsigned long>::Phantom<(nel::Result<unsigned long, unsigned long>::Tag)1>, unsigned long const&)>:
+        constexpr Result(Phantom<Tag::OK> const, Args &&...args)
+    381e:	55                   	push   %rbp
+    381f:	48 89 e5             	mov    %rsp,%rbp
+    3822:	53                   	push   %rbx
+    3823:	48 83 ec 18          	sub    $0x18,%rsp
+    3827:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    382b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    382f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3833:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<Args>(args)...)
+    3839:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    383d:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    3841:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3845:	48 89 c7             	mov    %rax,%rdi
+    3848:	e8 c2 ff ff ff       	call   380f <unsigned long const& nel::forward<unsigned long const&, unsigned long const>(unsigned long const&)>
+    384d:	48 89 c6             	mov    %rax,%rsi
+    3850:	48 89 df             	mov    %rbx,%rdi
+    3853:	e8 08 02 00 00       	call   3a60 <nel::Element<unsigned long>::Element<unsigned long const&>(unsigned long const&)>
+        }
+    3858:	90                   	nop
+    3859:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    385d:	c9                   	leave
+    385e:	c3                   	ret
+    385f:	90                   	nop
+
+0000000000003860 <nel::Result<unsigned long, unsigned long>::Result<unsigned long const&>(nel::Result<unsigned long, unsigned long>::Phantom<(nel::Result<unsigned long, unsigned long>::Tag)2>, unsigned long const&)>:
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+    3860:	55                   	push   %rbp
+    3861:	48 89 e5             	mov    %rsp,%rbp
+    3864:	53                   	push   %rbx
+    3865:	48 83 ec 18          	sub    $0x18,%rsp
+    3869:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    386d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    3871:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3875:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<Args>(args)...)
+    387b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    387f:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    3883:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3887:	48 89 c7             	mov    %rax,%rdi
+    388a:	e8 80 ff ff ff       	call   380f <unsigned long const& nel::forward<unsigned long const&, unsigned long const>(unsigned long const&)>
+    388f:	48 89 c6             	mov    %rax,%rsi
+    3892:	48 89 df             	mov    %rbx,%rdi
+    3895:	e8 c6 01 00 00       	call   3a60 <nel::Element<unsigned long>::Element<unsigned long const&>(unsigned long const&)>
+        }
+    389a:	90                   	nop
+    389b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    389f:	c9                   	leave
+    38a0:	c3                   	ret
+    38a1:	90                   	nop
+
+00000000000038a2 <nel::Element<unsigned long>::operator*()>:
+        constexpr Type &operator*(void)
+    38a2:	55                   	push   %rbp
+    38a3:	48 89 e5             	mov    %rsp,%rbp
+    38a6:	48 83 ec 10          	sub    $0x10,%rsp
+    38aa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    38ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    38b2:	48 89 c7             	mov    %rax,%rdi
+    38b5:	e8 d0 01 00 00       	call   3a8a <nel::Element<unsigned long>::ref()>
+        }
+    38ba:	c9                   	leave
+    38bb:	c3                   	ret
+
+00000000000038bc <nel::Element<void*>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    38bc:	55                   	push   %rbp
+    38bd:	48 89 e5             	mov    %rsp,%rbp
+    38c0:	48 83 ec 10          	sub    $0x10,%rsp
+    38c4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    38c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    38cc:	48 89 c7             	mov    %rax,%rdi
+    38cf:	e8 c4 01 00 00       	call   3a98 <nel::Element<void*>::ref() const>
+        }
+    38d4:	c9                   	leave
+    38d5:	c3                   	ret
+
+00000000000038d6 <nel::Element<nel::heaped::AllocError>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    38d6:	55                   	push   %rbp
+    38d7:	48 89 e5             	mov    %rsp,%rbp
+    38da:	48 83 ec 10          	sub    $0x10,%rsp
+    38de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    38e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    38e6:	48 89 c7             	mov    %rax,%rdi
+    38e9:	e8 b8 01 00 00       	call   3aa6 <nel::Element<nel::heaped::AllocError>::ref() const>
+        }
+    38ee:	c9                   	leave
+    38ef:	c3                   	ret
+
+00000000000038f0 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>:
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    38f0:	55                   	push   %rbp
+    38f1:	48 89 e5             	mov    %rsp,%rbp
+    38f4:	48 83 ec 10          	sub    $0x10,%rsp
+    38f8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    38fc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3900:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3904:	48 89 c7             	mov    %rax,%rdi
+    3907:	e8 a8 01 00 00       	call   3ab4 <void*&& nel::forward<void*, void*>(void*&)>
+    390c:	48 8b 00             	mov    (%rax),%rax
+    390f:	c9                   	leave
+    3910:	c3                   	ret
+    3911:	90                   	nop
+
+0000000000003912 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>:
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    3912:	55                   	push   %rbp
+    3913:	48 89 e5             	mov    %rsp,%rbp
+    3916:	48 83 ec 10          	sub    $0x10,%rsp
+    391a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    391e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3922:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3926:	48 8b 00             	mov    (%rax),%rax
+    3929:	48 89 c6             	mov    %rax,%rsi
+    392c:	48 8d 05 56 18 00 00 	lea    0x1856(%rip),%rax        # 5189 <max_linear+0xf9>
+    3933:	48 89 c7             	mov    %rax,%rdi
+    3936:	e8 f6 02 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+    393b:	90                   	nop
+
+000000000000393c <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>:
+        constexpr T unwrap(Context const &ctx = Context())
+    393c:	55                   	push   %rbp
+    393d:	48 89 e5             	mov    %rsp,%rbp
+    3940:	48 83 ec 20          	sub    $0x20,%rsp
+    3944:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3948:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    394c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3950:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    3954:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    3958:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    395c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    3960:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3964:	48 89 c7             	mov    %rax,%rdi
+    3967:	e8 56 01 00 00       	call   3ac2 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>
+        }
+    396c:	c9                   	leave
+    396d:	c3                   	ret
+
+000000000000396e <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>:
+
+    public:
+        // Smallest non-zero capacity grown to, saves the first few tiny reallocs.
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+    396e:	          55                   	push   %rbp
+    396f:	          48 89 e5             	mov    %rsp,%rbp
+    3972:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3976:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            if (cap <= cur) { return cap; }
+    397a:	          48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    397e:	          48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    3982:	      /-- 72 06                	jb     398a <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x1c>
+    3984:	      |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3988:	/-----|-- eb 2e                	jmp    39b8 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x4a>
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    398a:	|     \-> 48 83 7d e8 03       	cmpq   $0x3,-0x18(%rbp)
+    398f:	|  /----- 76 09                	jbe    399a <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x2c>
+    3991:	|  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3995:	|  |      48 01 c0             	add    %rax,%rax
+    3998:	|  |  /-- eb 05                	jmp    399f <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x31>
+    399a:	|  \--|-> b8 04 00 00 00       	mov    $0x4,%eax
+    399f:	|     \-> 48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return (cap < g) ? g : cap;
+    39a3:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    39a7:	|         48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    39ab:	|  /----- 73 06                	jae    39b3 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x45>
+    39ad:	|  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    39b1:	|  |  /-- eb 04                	jmp    39b7 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x49>
+    39b3:	|  \--|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    39b7:	|     \-> 90                   	nop
+        }
+    39b8:	\-------> 5d                   	pop    %rbp
+    39b9:	          c3                   	ret
+
+00000000000039ba <nel::Element<int>::Element<int&>(int&)>:
+        constexpr Element(Args &&...args)
+    39ba:	55                   	push   %rbp
+    39bb:	48 89 e5             	mov    %rsp,%rbp
+    39be:	48 83 ec 10          	sub    $0x10,%rsp
+    39c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    39c6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Args>(args)...)
+    39ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    39ce:	48 89 c7             	mov    %rax,%rdi
+    39d1:	e8 63 fb ff ff       	call   3539 <int& nel::forward<int&, int>(int&)>
+    39d6:	8b 10                	mov    (%rax),%edx
+    39d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    39dc:	89 10                	mov    %edx,(%rax)
+        }
+    39de:	90                   	nop
+    39df:	c9                   	leave
+    39e0:	c3                   	ret
+    39e1:	90                   	nop
+
+00000000000039e2 <nel::Result<void, int>::Result(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)1>)>:
+        constexpr Result(Phantom<Tag::OK> const)
+    39e2:	55                   	push   %rbp
+    39e3:	48 89 e5             	mov    %rsp,%rbp
+    39e6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : tag_(Tag::OK)
+    39ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    39ee:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+        }
+    39f4:	90                   	nop
+    39f5:	5d                   	pop    %rbp
+    39f6:	c3                   	ret
+    39f7:	90                   	nop
+
+00000000000039f8 <nel::Element<int>::ref()>:
+        constexpr Type &ref(void)
+    39f8:	55                   	push   %rbp
+    39f9:	48 89 e5             	mov    %rsp,%rbp
+    39fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    3a00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    3a04:	5d                   	pop    %rbp
+    3a05:	c3                   	ret
+
+0000000000003a06 <nel::Slice<int>::Slice()>:
+        constexpr Slice(void)
+    3a06:	55                   	push   %rbp
+    3a07:	48 89 e5             	mov    %rsp,%rbp
+    3a0a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : content_(nullptr)
+    3a0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a12:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+            , len_(0)
+    3a19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a1d:	48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    3a24:	00 
+        }
+    3a25:	90                   	nop
+    3a26:	5d                   	pop    %rbp
+    3a27:	c3                   	ret
+
+0000000000003a28 <nel::Element<int&>::Element(int&)>:
+        constexpr Element(Type &&val)
+    3a28:	55                   	push   %rbp
+    3a29:	48 89 e5             	mov    %rsp,%rbp
+    3a2c:	48 83 ec 10          	sub    $0x10,%rsp
+    3a30:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3a34:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    3a38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3a3c:	48 89 c7             	mov    %rax,%rdi
+    3a3f:	e8 f5 fa ff ff       	call   3539 <int& nel::forward<int&, int>(int&)>
+    3a44:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3a48:	48 89 02             	mov    %rax,(%rdx)
+        }
+    3a4b:	90                   	nop
+    3a4c:	c9                   	leave
+    3a4d:	c3                   	ret
+
+0000000000003a4e <nel::Element<int&>::ref() const>:
+        constexpr Type const &ref(void) const
+    3a4e:	55                   	push   %rbp
+    3a4f:	48 89 e5             	mov    %rsp,%rbp
+    3a52:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    3a56:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a5a:	48 8b 00             	mov    (%rax),%rax
+        }
+    3a5d:	5d                   	pop    %rbp
+    3a5e:	c3                   	ret
+    3a5f:	90                   	nop
+
+0000000000003a60 <nel::Element<unsigned long>::Element<unsigned long const&>(unsigned long const&)>:
+        constexpr Element(Args &&...args)
+    3a60:	55                   	push   %rbp
+    3a61:	48 89 e5             	mov    %rsp,%rbp
+    3a64:	48 83 ec 10          	sub    $0x10,%rsp
+    3a68:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3a6c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Args>(args)...)
+    3a70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3a74:	48 89 c7             	mov    %rax,%rdi
+    3a77:	e8 93 fd ff ff       	call   380f <unsigned long const& nel::forward<unsigned long const&, unsigned long const>(unsigned long const&)>
+    3a7c:	48 8b 10             	mov    (%rax),%rdx
+    3a7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a83:	48 89 10             	mov    %rdx,(%rax)
+        }
+    3a86:	90                   	nop
+    3a87:	c9                   	leave
+    3a88:	c3                   	ret
+    3a89:	90                   	nop
+
+0000000000003a8a <nel::Element<unsigned long>::ref()>:
+        constexpr Type &ref(void)
+    3a8a:	55                   	push   %rbp
+    3a8b:	48 89 e5             	mov    %rsp,%rbp
+    3a8e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    3a92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    3a96:	5d                   	pop    %rbp
+    3a97:	c3                   	ret
+
+0000000000003a98 <nel::Element<void*>::ref() const>:
+        constexpr Type const &ref(void) const
+    3a98:	55                   	push   %rbp
+    3a99:	48 89 e5             	mov    %rsp,%rbp
+    3a9c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    3aa0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    3aa4:	5d                   	pop    %rbp
+    3aa5:	c3                   	ret
+
+0000000000003aa6 <nel::Element<nel::heaped::AllocError>::ref() const>:
+        constexpr Type const &ref(void) const
+    3aa6:	55                   	push   %rbp
+    3aa7:	48 89 e5             	mov    %rsp,%rbp
+    3aaa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    3aae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    3ab2:	5d                   	pop    %rbp
+    3ab3:	c3                   	ret
+
+0000000000003ab4 <void*&& nel::forward<void*, void*>(void*&)>:
+constexpr U &&forward(T &t)
+    3ab4:	55                   	push   %rbp
+    3ab5:	48 89 e5             	mov    %rsp,%rbp
+    3ab8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    3abc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3ac0:	5d                   	pop    %rbp
+    3ac1:	c3                   	ret
+
+0000000000003ac2 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    3ac2:	             55                   	push   %rbp
+    3ac3:	             48 89 e5             	mov    %rsp,%rbp
+    3ac6:	             48 83 ec 30          	sub    $0x30,%rsp
+    3aca:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3ace:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    3ad2:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    3ad6:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    3ada:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3ade:	             8b 00                	mov    (%rax),%eax
+    3ae0:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    3ae3:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3ae7:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    3aed:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    3af1:	         /-- 74 3e                	je     3b31 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x6f>
+    3af3:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    3af7:	/--------|-- 7f 7a                	jg     3b73 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+    3af9:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    3afd:	|  /-----|-- 74 5e                	je     3b5d <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x9b>
+    3aff:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    3b03:	+--|-----|-- 75 6e                	jne    3b73 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+                    return on_ok(forward<T>(*ok_));
+    3b05:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3b09:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    3b0d:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    3b10:	|  |     |   e8 77 00 00 00       	call   3b8c <nel::Element<void*>::operator*()>
+    3b15:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    3b18:	|  |     |   e8 97 ff ff ff       	call   3ab4 <void*&& nel::forward<void*, void*>(void*&)>
+    3b1d:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    3b20:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3b24:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    3b27:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    3b2a:	|  |     |   e8 c1 fd ff ff       	call   38f0 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>
+    3b2f:	|  |  /--|-- eb 58                	jmp    3b89 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    return on_err(forward<E>(*err_));
+    3b31:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3b35:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    3b39:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3b3c:	|  |  |      e8 65 00 00 00       	call   3ba6 <nel::Element<nel::heaped::AllocError>::operator*()>
+    3b41:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3b44:	|  |  |      e8 06 ec ff ff       	call   274f <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    3b49:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    3b4c:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3b50:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    3b53:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3b56:	|  |  |      e8 b7 fd ff ff       	call   3912 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>
+    3b5b:	|  |  +----- eb 2c                	jmp    3b89 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    nel::panic("invalid Result", ctx);
+    3b5d:	|  \--|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3b61:	|     |      48 89 c6             	mov    %rax,%rsi
+    3b64:	|     |      48 8d 05 2d 15 00 00 	lea    0x152d(%rip),%rax        # 5098 <max_linear+0x8>
+    3b6b:	|     |      48 89 c7             	mov    %rax,%rdi
+    3b6e:	|     |      e8 be 00 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    3b73:	\-----|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3b77:	      |      48 89 c6             	mov    %rax,%rsi
+    3b7a:	      |      48 8d 05 26 15 00 00 	lea    0x1526(%rip),%rax        # 50a7 <max_linear+0x17>
+    3b81:	      |      48 89 c7             	mov    %rax,%rdi
+    3b84:	      |      e8 a8 00 00 00       	call   3c31 <nel::panic(char const*, nel::Context const&)>
+        }
+    3b89:	      \----> c9                   	leave
+    3b8a:	             c3                   	ret
+    3b8b:	             90                   	nop
+
+0000000000003b8c <nel::Element<void*>::operator*()>:
+        constexpr Type &operator*(void)
+    3b8c:	55                   	push   %rbp
+    3b8d:	48 89 e5             	mov    %rsp,%rbp
+    3b90:	48 83 ec 10          	sub    $0x10,%rsp
+    3b94:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    3b98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3b9c:	48 89 c7             	mov    %rax,%rdi
+    3b9f:	e8 1c 00 00 00       	call   3bc0 <nel::Element<void*>::ref()>
+        }
+    3ba4:	c9                   	leave
+    3ba5:	c3                   	ret
+
+0000000000003ba6 <nel::Element<nel::heaped::AllocError>::operator*()>:
+        constexpr Type &operator*(void)
+    3ba6:	55                   	push   %rbp
+    3ba7:	48 89 e5             	mov    %rsp,%rbp
+    3baa:	48 83 ec 10          	sub    $0x10,%rsp
+    3bae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    3bb2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3bb6:	48 89 c7             	mov    %rax,%rdi
+    3bb9:	e8 10 00 00 00       	call   3bce <nel::Element<nel::heaped::AllocError>::ref()>
+        }
+    3bbe:	c9                   	leave
+    3bbf:	c3                   	ret
+
+0000000000003bc0 <nel::Element<void*>::ref()>:
+        constexpr Type &ref(void)
+    3bc0:	55                   	push   %rbp
+    3bc1:	48 89 e5             	mov    %rsp,%rbp
+    3bc4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    3bc8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    3bcc:	5d                   	pop    %rbp
+    3bcd:	c3                   	ret
+
+0000000000003bce <nel::Element<nel::heaped::AllocError>::ref()>:
+        constexpr Type &ref(void)
+    3bce:	55                   	push   %rbp
+    3bcf:	48 89 e5             	mov    %rsp,%rbp
+    3bd2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    3bd6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    3bda:	5d                   	pop    %rbp
+    3bdb:	c3                   	ret
+
+0000000000003bdc <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    3bdc:	55                   	push   %rbp
+    3bdd:	48 89 e5             	mov    %rsp,%rbp
+    std::abort();
+    3be0:	e8 5b d4 ff ff       	call   1040 <abort@plt>
+
+0000000000003be5 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    3be5:	55                   	push   %rbp
+    3be6:	48 89 e5             	mov    %rsp,%rbp
+    3be9:	48 83 ec 10          	sub    $0x10,%rsp
+    3bed:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    3bf1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3bf5:	48 8b 30             	mov    (%rax),%rsi
+    3bf8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3bfc:	8b 48 10             	mov    0x10(%rax),%ecx
+    3bff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3c03:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    3c07:	48 8b 05 72 44 00 00 	mov    0x4472(%rip),%rax        # 8080 <stderr@GLIBC_2.2.5>
+    3c0e:	4c 8d 0d fd 15 00 00 	lea    0x15fd(%rip),%r9        # 5212 <nel::is_trivially_relocatable<int>+0x1>
+    3c15:	49 89 f0             	mov    %rsi,%r8
+    3c18:	48 8d 35 f9 15 00 00 	lea    0x15f9(%rip),%rsi        # 5218 <nel::is_trivially_relocatable<int>+0x7>
+    3c1f:	48 89 c7             	mov    %rax,%rdi
+    3c22:	b8 00 00 00 00       	mov    $0x0,%eax
+    3c27:	e8 74 d4 ff ff       	call   10a0 <fprintf@plt>
+    abort();
+    3c2c:	e8 ab ff ff ff       	call   3bdc <nel::abort()>
+
+0000000000003c31 <nel::panic(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    3c31:	55                   	push   %rbp
+    3c32:	48 89 e5             	mov    %rsp,%rbp
+    3c35:	48 83 ec 10          	sub    $0x10,%rsp
+    3c39:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3c3d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    3c41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3c45:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    3c48:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3c4c:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    3c4f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3c53:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    3c57:	48 8b 05 22 44 00 00 	mov    0x4422(%rip),%rax        # 8080 <stderr@GLIBC_2.2.5>
+    3c5e:	48 83 ec 08          	sub    $0x8,%rsp
+    3c62:	ff 75 f8             	push   -0x8(%rbp)
+    3c65:	4c 8d 0d a6 15 00 00 	lea    0x15a6(%rip),%r9        # 5212 <nel::is_trivially_relocatable<int>+0x1>
+    3c6c:	49 89 f0             	mov    %rsi,%r8
+    3c6f:	48 8d 35 b3 15 00 00 	lea    0x15b3(%rip),%rsi        # 5229 <nel::is_trivially_relocatable<int>+0x18>
+    3c76:	48 89 c7             	mov    %rax,%rdi
+    3c79:	b8 00 00 00 00       	mov    $0x0,%eax
+    3c7e:	e8 1d d4 ff ff       	call   10a0 <fprintf@plt>
+    3c83:	48 83 c4 10          	add    $0x10,%rsp
+            "PANIC",
+            msg);
+    abort();
+    3c87:	e8 50 ff ff ff       	call   3bdc <nel::abort()>
+
+0000000000003c8c <nel::assert_fail(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    3c8c:	55                   	push   %rbp
+    3c8d:	48 89 e5             	mov    %rsp,%rbp
+    3c90:	48 83 ec 10          	sub    $0x10,%rsp
+    3c94:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3c98:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    3c9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3ca0:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    3ca3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3ca7:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    3caa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3cae:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    3cb2:	48 8b 05 c7 43 00 00 	mov    0x43c7(%rip),%rax        # 8080 <stderr@GLIBC_2.2.5>
+    3cb9:	48 83 ec 08          	sub    $0x8,%rsp
+    3cbd:	ff 75 f8             	push   -0x8(%rbp)
+    3cc0:	4c 8d 0d 77 15 00 00 	lea    0x1577(%rip),%r9        # 523e <nel::is_trivially_relocatable<int>+0x2d>
+    3cc7:	49 89 f0             	mov    %rsi,%r8
+    3cca:	48 8d 35 58 15 00 00 	lea    0x1558(%rip),%rsi        # 5229 <nel::is_trivially_relocatable<int>+0x18>
+    3cd1:	48 89 c7             	mov    %rax,%rdi
+    3cd4:	b8 00 00 00 00       	mov    $0x0,%eax
+    3cd9:	e8 c2 d3 ff ff       	call   10a0 <fprintf@plt>
+    3cde:	48 83 c4 10          	add    $0x10,%rsp
+            "ASSERT FAIL",
+            msg);
+    abort();
+    3ce2:	e8 f5 fe ff ff       	call   3bdc <nel::abort()>
+
+0000000000003ce7 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    3ce7:	55                   	push   %rbp
+    3ce8:	48 89 e5             	mov    %rsp,%rbp
+    3ceb:	48 83 ec 20          	sub    $0x20,%rsp
+    3cef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3cf3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3cf7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    3cfb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3cff:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3d03:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3d07:	48 89 ce             	mov    %rcx,%rsi
+    3d0a:	48 89 c7             	mov    %rax,%rdi
+    3d0d:	e8 9e d3 ff ff       	call   10b0 <memcpy@plt>
+}
+    3d12:	90                   	nop
+    3d13:	c9                   	leave
+    3d14:	c3                   	ret
+
+0000000000003d15 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    3d15:	55                   	push   %rbp
+    3d16:	48 89 e5             	mov    %rsp,%rbp
+    3d19:	48 83 ec 20          	sub    $0x20,%rsp
+    3d1d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3d21:	89 f0                	mov    %esi,%eax
+    3d23:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    3d27:	88 45 f4             	mov    %al,-0xc(%rbp)
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    3d2a:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    3d2e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3d32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3d36:	89 ce                	mov    %ecx,%esi
+    3d38:	48 89 c7             	mov    %rax,%rdi
+    3d3b:	e8 30 d3 ff ff       	call   1070 <memset@plt>
+}
+    3d40:	90                   	nop
+    3d41:	c9                   	leave
+    3d42:	c3                   	ret
+
+0000000000003d43 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    3d43:	55                   	push   %rbp
+    3d44:	48 89 e5             	mov    %rsp,%rbp
+    3d47:	48 83 ec 20          	sub    $0x20,%rsp
+    3d4b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3d4f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3d53:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    //     *id = *is;
+    // }
+    // for (uint8_t *id = d, *is = s, *const e = (d + n); id != e; ++is, ++id) {
+    //     *is = 0xa5;
+    // }
+    copy(d, s, n);
+    3d57:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3d5b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3d5f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3d63:	48 89 ce             	mov    %rcx,%rsi
+    3d66:	48 89 c7             	mov    %rax,%rdi
+    3d69:	e8 79 ff ff ff       	call   3ce7 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    poison(s, n);
+    3d6e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3d72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3d76:	48 89 d6             	mov    %rdx,%rsi
+    3d79:	48 89 c7             	mov    %rax,%rdi
+    3d7c:	e8 60 07 00 00       	call   44e1 <nel::elem::poison(unsigned char*, unsigned long)>
+}
+    3d81:	90                   	nop
+    3d82:	c9                   	leave
+    3d83:	c3                   	ret
+
+0000000000003d84 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    3d84:	55                   	push   %rbp
+    3d85:	48 89 e5             	mov    %rsp,%rbp
+    3d88:	48 83 ec 20          	sub    $0x20,%rsp
+    3d8c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3d90:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3d94:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    std::memmove(d, s, n);
+    3d98:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3d9c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3da0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3da4:	48 89 ce             	mov    %rcx,%rsi
+    3da7:	48 89 c7             	mov    %rax,%rdi
+    3daa:	e8 21 d3 ff ff       	call   10d0 <memmove@plt>
+}
+    3daf:	90                   	nop
+    3db0:	c9                   	leave
+    3db1:	c3                   	ret
+
+0000000000003db2 <nel::elem::wipe(unsigned char*, unsigned long)>:
+
+void wipe(uint8_t *const d, Length const n)
+{
+    3db2:	55                   	push   %rbp
+    3db3:	48 89 e5             	mov    %rsp,%rbp
+    3db6:	48 83 ec 10          	sub    $0x10,%rsp
+    3dba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3dbe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    set(d, 0xa5, n);
+    3dc2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3dc6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3dca:	be a5 00 00 00       	mov    $0xa5,%esi
+    3dcf:	48 89 c7             	mov    %rax,%rdi
+    3dd2:	e8 3e ff ff ff       	call   3d15 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    3dd7:	90                   	nop
+    3dd8:	c9                   	leave
+    3dd9:	c3                   	ret
+
+0000000000003dda <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    3dda:	55                   	push   %rbp
+    3ddb:	48 89 e5             	mov    %rsp,%rbp
+    3dde:	48 83 ec 20          	sub    $0x20,%rsp
+    3de2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3de6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3dea:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    3dee:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3df2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3df6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3dfa:	48 89 ce             	mov    %rcx,%rsi
+    3dfd:	48 89 c7             	mov    %rax,%rdi
+    3e00:	e8 8b d2 ff ff       	call   1090 <memcmp@plt>
+    3e05:	85 c0                	test   %eax,%eax
+    3e07:	0f 94 c0             	sete   %al
+}
+    3e0a:	c9                   	leave
+    3e0b:	c3                   	ret
+
+0000000000003e0c <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    3e0c:	55                   	push   %rbp
+    3e0d:	48 89 e5             	mov    %rsp,%rbp
+    3e10:	48 83 ec 20          	sub    $0x20,%rsp
+    3e14:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3e18:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3e1c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    3e20:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3e24:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3e28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3e2c:	48 89 ce             	mov    %rcx,%rsi
+    3e2f:	48 89 c7             	mov    %rax,%rdi
+    3e32:	e8 59 d2 ff ff       	call   1090 <memcmp@plt>
+    3e37:	85 c0                	test   %eax,%eax
+    3e39:	0f 95 c0             	setne  %al
+}
+    3e3c:	c9                   	leave
+    3e3d:	c3                   	ret
+
+0000000000003e3e <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>:
+
+// d[i] = p[i % 16] for i in [0, n), with normal stores:
+// the pattern once, then doubling the filled region.
+static void set_pattern(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    3e3e:	       55                   	push   %rbp
+    3e3f:	       48 89 e5             	mov    %rsp,%rbp
+    3e42:	       48 83 ec 30          	sub    $0x30,%rsp
+    3e46:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3e4a:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    3e4e:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    Length done = (n < 16) ? n : 16;
+    3e52:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3e56:	       ba 10 00 00 00       	mov    $0x10,%edx
+    3e5b:	       48 39 d0             	cmp    %rdx,%rax
+    3e5e:	       48 0f 47 c2          	cmova  %rdx,%rax
+    3e62:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    copy(d, p, done);
+    3e66:	       48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3e6a:	       48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    3e6e:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3e72:	       48 89 ce             	mov    %rcx,%rsi
+    3e75:	       48 89 c7             	mov    %rax,%rdi
+    3e78:	       e8 6a fe ff ff       	call   3ce7 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    while (done < n) {
+    3e7d:	   /-- eb 3e                	jmp    3ebd <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x7f>
+        Length const m = (done < n - done) ? done : n - done;
+    3e7f:	/--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3e83:	|  |   48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    3e87:	|  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3e8b:	|  |   48 39 c2             	cmp    %rax,%rdx
+    3e8e:	|  |   48 0f 46 c2          	cmovbe %rdx,%rax
+    3e92:	|  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        copy(d + done, d, m);
+    3e96:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3e9a:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3e9e:	|  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    3ea2:	|  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3ea6:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3eaa:	|  |   48 89 c6             	mov    %rax,%rsi
+    3ead:	|  |   48 89 cf             	mov    %rcx,%rdi
+    3eb0:	|  |   e8 32 fe ff ff       	call   3ce7 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        done += m;
+    3eb5:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3eb9:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+    while (done < n) {
+    3ebd:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3ec1:	|      48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    3ec5:	\----- 72 b8                	jb     3e7f <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x41>
+    }
+}
+    3ec7:	       90                   	nop
+    3ec8:	       90                   	nop
+    3ec9:	       c9                   	leave
+    3eca:	       c3                   	ret
+
+0000000000003ecb <nel::elem::load16(unsigned char const*)>:
+static constexpr Length streaming_min = 256;
+
+typedef long long int Line16 __attribute__((vector_size(16)));
+
+static inline Line16 load16(uint8_t const *const s)
+{
+    3ecb:	55                   	push   %rbp
+    3ecc:	48 89 e5             	mov    %rsp,%rbp
+    3ecf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Line16 v;
+    std::memcpy(&v, s, sizeof(v));
+    3ed3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3ed7:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    3edb:	48 8b 00             	mov    (%rax),%rax
+    3ede:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    3ee2:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    return v;
+    3ee6:	66 0f 6f 45 f0       	movdqa -0x10(%rbp),%xmm0
+}
+    3eeb:	5d                   	pop    %rbp
+    3eec:	c3                   	ret
+
+0000000000003eed <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>:
+
+static inline void stream16(uint8_t *const d, Line16 const &v)
+{
+    3eed:	55                   	push   %rbp
+    3eee:	48 89 e5             	mov    %rsp,%rbp
+    3ef1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3ef5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    3ef9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3efd:	66 0f 6f 00          	movdqa (%rax),%xmm0
+    3f01:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f05:	66 0f e7 00          	movntdq %xmm0,(%rax)
+}
+    3f09:	90                   	nop
+    3f0a:	5d                   	pop    %rbp
+    3f0b:	c3                   	ret
+
+0000000000003f0c <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    3f0c:	          55                   	push   %rbp
+    3f0d:	          48 89 e5             	mov    %rsp,%rbp
+    3f10:	          48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    3f14:	          48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    3f18:	          48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    3f1c:	          48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    if (n < streaming_min) {
+    3f20:	          48 81 7d 88 ff 00 00 	cmpq   $0xff,-0x78(%rbp)
+    3f27:	          00 
+    3f28:	      /-- 77 1c                	ja     3f46 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        copy(d, s, n);
+    3f2a:	      |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    3f2e:	      |   48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    3f32:	      |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3f36:	      |   48 89 ce             	mov    %rcx,%rsi
+    3f39:	      |   48 89 c7             	mov    %rax,%rdi
+    3f3c:	      |   e8 a6 fd ff ff       	call   3ce7 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        return;
+    3f41:	/-----|-- e9 98 01 00 00       	jmp    40de <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1d2>
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    3f46:	|     \-> 48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3f4a:	|         48 f7 d8             	neg    %rax
+    3f4d:	|         83 e0 0f             	and    $0xf,%eax
+    3f50:	|         48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    copy(d, s, head);
+    3f54:	|         48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3f58:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    3f5c:	|         48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3f60:	|         48 89 ce             	mov    %rcx,%rsi
+    3f63:	|         48 89 c7             	mov    %rax,%rdi
+    3f66:	|         e8 7c fd ff ff       	call   3ce7 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    Index i = head;
+    3f6b:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3f6f:	|         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    3f73:	|     /-- e9 e1 00 00 00       	jmp    4059 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        Line16 const a = load16(s + i);
+    3f78:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3f7c:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f80:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3f83:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3f86:	|  |  |   e8 40 ff ff ff       	call   3ecb <nel::elem::load16(unsigned char const*)>
+    3f8b:	|  |  |   0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+        Line16 const b = load16(s + i + 16);
+    3f8f:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f93:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    3f97:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3f9b:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3f9e:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3fa1:	|  |  |   e8 25 ff ff ff       	call   3ecb <nel::elem::load16(unsigned char const*)>
+    3fa6:	|  |  |   0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+        Line16 const c = load16(s + i + 32);
+    3faa:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3fae:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    3fb2:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3fb6:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3fb9:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3fbc:	|  |  |   e8 0a ff ff ff       	call   3ecb <nel::elem::load16(unsigned char const*)>
+    3fc1:	|  |  |   0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+        Line16 const e = load16(s + i + 48);
+    3fc5:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3fc9:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    3fcd:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3fd1:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3fd4:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3fd7:	|  |  |   e8 ef fe ff ff       	call   3ecb <nel::elem::load16(unsigned char const*)>
+    3fdc:	|  |  |   0f 29 45 a0          	movaps %xmm0,-0x60(%rbp)
+        stream16(d + i, a);
+    3fe0:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    3fe4:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3fe8:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3feb:	|  |  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    3fef:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3ff2:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3ff5:	|  |  |   e8 f3 fe ff ff       	call   3eed <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, b);
+    3ffa:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3ffe:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    4002:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    4006:	|  |  |   48 01 c2             	add    %rax,%rdx
+    4009:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    400d:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    4010:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    4013:	|  |  |   e8 d5 fe ff ff       	call   3eed <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, c);
+    4018:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    401c:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    4020:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    4024:	|  |  |   48 01 c2             	add    %rax,%rdx
+    4027:	|  |  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    402b:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    402e:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    4031:	|  |  |   e8 b7 fe ff ff       	call   3eed <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, e);
+    4036:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    403a:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    403e:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    4042:	|  |  |   48 01 c2             	add    %rax,%rdx
+    4045:	|  |  |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    4049:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    404c:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    404f:	|  |  |   e8 99 fe ff ff       	call   3eed <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    4054:	|  |  |   48 83 45 f8 40       	addq   $0x40,-0x8(%rbp)
+    4059:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    405d:	|  |      48 83 c0 40          	add    $0x40,%rax
+    4061:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    4065:	|  \----- 0f 83 0d ff ff ff    	jae    3f78 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x6c>
+    }
+    for (; i + 16 <= n; i += 16) {
+    406b:	|     /-- eb 36                	jmp    40a3 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x197>
+        stream16(d + i, load16(s + i));
+    406d:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    4071:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4075:	|  |  |   48 01 d0             	add    %rdx,%rax
+    4078:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    407b:	|  |  |   e8 4b fe ff ff       	call   3ecb <nel::elem::load16(unsigned char const*)>
+    4080:	|  |  |   0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+    4084:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    4088:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    408c:	|  |  |   48 01 c2             	add    %rax,%rdx
+    408f:	|  |  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    4093:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    4096:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    4099:	|  |  |   e8 4f fe ff ff       	call   3eed <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    409e:	|  |  |   48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+    40a3:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    40a7:	|  |      48 83 c0 10          	add    $0x10,%rax
+    40ab:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    40af:	|  \----- 73 bc                	jae    406d <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    40b1:	|         0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    40b4:	|         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    40b8:	|         48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    40bc:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    40c0:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    40c4:	|         48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    40c8:	|         48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+    40cc:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    40d0:	|         48 01 d1             	add    %rdx,%rcx
+    40d3:	|         48 89 c2             	mov    %rax,%rdx
+    40d6:	|         48 89 cf             	mov    %rcx,%rdi
+    40d9:	|         e8 09 fc ff ff       	call   3ce7 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+}
+    40de:	\-------> c9                   	leave
+    40df:	          c3                   	ret
+
+00000000000040e0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    40e0:	          55                   	push   %rbp
+    40e1:	          48 89 e5             	mov    %rsp,%rbp
+    40e4:	          48 83 ec 60          	sub    $0x60,%rsp
+    40e8:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    40ec:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    40f0:	          48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    if (n < streaming_min) {
+    40f4:	          48 81 7d a8 ff 00 00 	cmpq   $0xff,-0x58(%rbp)
+    40fb:	          00 
+    40fc:	      /-- 77 1c                	ja     411a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        set_pattern(d, p, n);
+    40fe:	      |   48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    4102:	      |   48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+    4106:	      |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    410a:	      |   48 89 ce             	mov    %rcx,%rsi
+    410d:	      |   48 89 c7             	mov    %rax,%rdi
+    4110:	      |   e8 29 fd ff ff       	call   3e3e <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>
+    4115:	/-----|-- e9 89 01 00 00       	jmp    42a3 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c3>
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    411a:	|     \-> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    411e:	|         48 f7 d8             	neg    %rax
+    4121:	|         83 e0 0f             	and    $0xf,%eax
+    4124:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    for (Index i = 0; i < head; ++i) {
+    4128:	|         48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    412f:	|         00 
+    4130:	|     /-- eb 20                	jmp    4152 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x72>
+        d[i] = p[i];
+    4132:	|  /--|-> 48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    4136:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    413a:	|  |  |   48 01 d0             	add    %rdx,%rax
+    413d:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    4141:	|  |  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    4145:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    4148:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    414b:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < head; ++i) {
+    414d:	|  |  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    4152:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4156:	|  |      48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    415a:	|  \----- 72 d6                	jb     4132 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x52>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    415c:	|         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    4163:	|         00 
+    4164:	|     /-- eb 2d                	jmp    4193 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xb3>
+        rotated[i] = p[(head + i) % 16];
+    4166:	|  /--|-> 48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    416a:	|  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    416e:	|  |  |   48 01 d0             	add    %rdx,%rax
+    4171:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    4174:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    4177:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    417b:	|  |  |   48 01 d0             	add    %rdx,%rax
+    417e:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    4181:	|  |  |   48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    4185:	|  |  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    4189:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    418c:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < 16; ++i) {
+    418e:	|  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    4193:	|  |  \-> 48 83 7d f0 0f       	cmpq   $0xf,-0x10(%rbp)
+    4198:	|  \----- 76 cc                	jbe    4166 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x86>
+    }
+    Line16 const v = load16(rotated);
+    419a:	|         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    419e:	|         48 89 c7             	mov    %rax,%rdi
+    41a1:	|         e8 25 fd ff ff       	call   3ecb <nel::elem::load16(unsigned char const*)>
+    41a6:	|         0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+    Index i = head;
+    41aa:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    41ae:	|         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    41b2:	|     /-- eb 79                	jmp    422d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        stream16(d + i, v);
+    41b4:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    41b8:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    41bc:	|  |  |   48 01 c2             	add    %rax,%rdx
+    41bf:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    41c3:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    41c6:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    41c9:	|  |  |   e8 1f fd ff ff       	call   3eed <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, v);
+    41ce:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    41d2:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    41d6:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    41da:	|  |  |   48 01 c2             	add    %rax,%rdx
+    41dd:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    41e1:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    41e4:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    41e7:	|  |  |   e8 01 fd ff ff       	call   3eed <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, v);
+    41ec:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    41f0:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    41f4:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    41f8:	|  |  |   48 01 c2             	add    %rax,%rdx
+    41fb:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    41ff:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    4202:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    4205:	|  |  |   e8 e3 fc ff ff       	call   3eed <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, v);
+    420a:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    420e:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    4212:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    4216:	|  |  |   48 01 c2             	add    %rax,%rdx
+    4219:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    421d:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    4220:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    4223:	|  |  |   e8 c5 fc ff ff       	call   3eed <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    4228:	|  |  |   48 83 45 e8 40       	addq   $0x40,-0x18(%rbp)
+    422d:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4231:	|  |      48 83 c0 40          	add    $0x40,%rax
+    4235:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    4239:	|  \----- 0f 83 75 ff ff ff    	jae    41b4 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd4>
+    }
+    for (; i + 16 <= n; i += 16) {
+    423f:	|     /-- eb 1f                	jmp    4260 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x180>
+        stream16(d + i, v);
+    4241:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    4245:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4249:	|  |  |   48 01 c2             	add    %rax,%rdx
+    424c:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    4250:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    4253:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    4256:	|  |  |   e8 92 fc ff ff       	call   3eed <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    425b:	|  |  |   48 83 45 e8 10       	addq   $0x10,-0x18(%rbp)
+    4260:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4264:	|  |      48 83 c0 10          	add    $0x10,%rax
+    4268:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    426c:	|  \----- 73 d3                	jae    4241 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    __builtin_ia32_sfence();
+    426e:	|         0f ae f8             	sfence
+    for (; i < n; ++i) {
+    4271:	|     /-- eb 26                	jmp    4299 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1b9>
+        d[i] = p[i % 16];
+    4273:	|  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4277:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    427a:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    427d:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    4281:	|  |  |   48 01 d0             	add    %rdx,%rax
+    4284:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    4288:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    428c:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    428f:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    4292:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (; i < n; ++i) {
+    4294:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    4299:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    429d:	|  |      48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    42a1:	|  \----- 72 d0                	jb     4273 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x193>
+    }
+}
+    42a3:	\-------> c9                   	leave
+    42a4:	          c3                   	ret
+
+00000000000042a5 <nel::offset_of(unsigned char*, unsigned long)>:
+// The payload is the first align boundary leaving room for a Length in front,
+// which holds the offset from the start of the underlying allocation.
+// Malloc alignment is at least alignof(Length), so the payload is at most
+// align bytes in.
+static Length offset_of(uint8_t *const base, Length const align)
+{
+    42a5:	55                   	push   %rbp
+    42a6:	48 89 e5             	mov    %rsp,%rbp
+    42a9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    42ad:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    USize const a = reinterpret_cast<USize>(base) + sizeof(Length);
+    42b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    42b5:	48 83 c0 08          	add    $0x8,%rax
+    42b9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    42bd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    42c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    42c5:	48 01 d0             	add    %rdx,%rax
+    42c8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    42cc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    42d0:	48 f7 d8             	neg    %rax
+    42d3:	48 21 c2             	and    %rax,%rdx
+    42d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    42da:	48 29 c2             	sub    %rax,%rdx
+    42dd:	48 89 d0             	mov    %rdx,%rax
+}
+    42e0:	5d                   	pop    %rbp
+    42e1:	c3                   	ret
+
+00000000000042e2 <nel::offset_field(unsigned char*)>:
+
+static Length &offset_field(uint8_t *const p)
+{
+    42e2:	55                   	push   %rbp
+    42e3:	48 89 e5             	mov    %rsp,%rbp
+    42e6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return reinterpret_cast<Length *>(p)[-1];
+    42ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    42ee:	48 83 e8 08          	sub    $0x8,%rax
+}
+    42f2:	5d                   	pop    %rbp
+    42f3:	c3                   	ret
+
+00000000000042f4 <nel::free_aligned(void*)>:
+
+void free_aligned(void *const p)
+{
+    42f4:	       55                   	push   %rbp
+    42f5:	       48 89 e5             	mov    %rsp,%rbp
+    42f8:	       48 83 ec 20          	sub    $0x20,%rsp
+    42fc:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (p == nullptr) { return; }
+    4300:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    4305:	/----- 74 2e                	je     4335 <nel::free_aligned(void*)+0x41>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    4307:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    430b:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    std::free(u8p - offset_field(u8p));
+    430f:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4313:	|      48 89 c7             	mov    %rax,%rdi
+    4316:	|      e8 c7 ff ff ff       	call   42e2 <nel::offset_field(unsigned char*)>
+    431b:	|      48 8b 00             	mov    (%rax),%rax
+    431e:	|      48 f7 d8             	neg    %rax
+    4321:	|      48 89 c2             	mov    %rax,%rdx
+    4324:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4328:	|      48 01 d0             	add    %rdx,%rax
+    432b:	|      48 89 c7             	mov    %rax,%rdi
+    432e:	|      e8 fd cc ff ff       	call   1030 <free@plt>
+    4333:	|  /-- eb 01                	jmp    4336 <nel::free_aligned(void*)+0x42>
+    if (p == nullptr) { return; }
+    4335:	\--|-> 90                   	nop
+}
+    4336:	   \-> c9                   	leave
+    4337:	       c3                   	ret
+
+0000000000004338 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    4338:	             55                   	push   %rbp
+    4339:	             48 89 e5             	mov    %rsp,%rbp
+    433c:	             53                   	push   %rbx
+    433d:	             48 83 ec 78          	sub    $0x78,%rsp
+    4341:	             48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    4345:	             48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    4349:	             48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    434d:	             48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    4351:	             48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    4355:	             b9 f3 00 00 00       	mov    $0xf3,%ecx
+    435a:	             48 8d 15 ff 0e 00 00 	lea    0xeff(%rip),%rdx        # 5260 <nel::elem::streaming_min+0x8>
+    4361:	             48 8d 35 0a 0f 00 00 	lea    0xf0a(%rip),%rsi        # 5272 <nel::elem::streaming_min+0x1a>
+    4368:	             48 89 c7             	mov    %rax,%rdi
+    436b:	             e8 9e d9 ff ff       	call   1d0e <nel::Context::Context(char const*, char const*, int)>
+    4370:	             48 83 7d 90 00       	cmpq   $0x0,-0x70(%rbp)
+    4375:	      /----- 74 18                	je     438f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    4377:	      |      48 8b 45 90          	mov    -0x70(%rbp),%rax
+    437b:	      |      48 83 e8 01          	sub    $0x1,%rax
+    437f:	      |      48 23 45 90          	and    -0x70(%rbp),%rax
+    4383:	      |      48 85 c0             	test   %rax,%rax
+    4386:	      +----- 75 07                	jne    438f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    4388:	      |      b8 01 00 00 00       	mov    $0x1,%eax
+    438d:	      |  /-- eb 05                	jmp    4394 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x5c>
+    438f:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    4394:	         \-> 0f b6 c0             	movzbl %al,%eax
+    4397:	             48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    439b:	             48 8d 0d e0 0e 00 00 	lea    0xee0(%rip),%rcx        # 5282 <nel::elem::streaming_min+0x2a>
+    43a2:	             48 89 ce             	mov    %rcx,%rsi
+    43a5:	             89 c7                	mov    %eax,%edi
+    43a7:	             e8 5b 01 00 00       	call   4507 <nel::assert(bool, char const*, nel::Context const&)>
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    43ac:	             48 8b 45 98          	mov    -0x68(%rbp),%rax
+    43b0:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    43b4:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    43b9:	      /----- 74 11                	je     43cc <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x94>
+    43bb:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    43bf:	      |      48 89 c7             	mov    %rax,%rdi
+    43c2:	      |      e8 1b ff ff ff       	call   42e2 <nel::offset_field(unsigned char*)>
+    43c7:	      |      48 8b 00             	mov    (%rax),%rax
+    43ca:	      |  /-- eb 05                	jmp    43d1 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x99>
+    43cc:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    43d1:	         \-> 48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    43d5:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    43da:	      /----- 74 13                	je     43ef <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb7>
+    43dc:	      |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    43e0:	      |      48 f7 d8             	neg    %rax
+    43e3:	      |      48 89 c2             	mov    %rax,%rdx
+    43e6:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    43ea:	      |      48 01 d0             	add    %rdx,%rax
+    43ed:	      |  /-- eb 05                	jmp    43f4 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xbc>
+    43ef:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    43f4:	         \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    43f8:	             48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    43fc:	             48 8b 45 90          	mov    -0x70(%rbp),%rax
+    4400:	             48 01 c2             	add    %rax,%rdx
+    4403:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4407:	             48 89 d6             	mov    %rdx,%rsi
+    440a:	             48 89 c7             	mov    %rax,%rdi
+    440d:	             e8 ae cc ff ff       	call   10c0 <realloc@plt>
+    4412:	             48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if (new_base == nullptr) { return nullptr; }
+    4416:	             48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    441b:	         /-- 75 0a                	jne    4427 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    441d:	         |   b8 00 00 00 00       	mov    $0x0,%eax
+    4422:	/--------|-- e9 85 00 00 00       	jmp    44ac <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x174>
+
+    Length const new_offset = offset_of(new_base, align);
+    4427:	|        \-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    442b:	|            48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    442f:	|            48 89 d6             	mov    %rdx,%rsi
+    4432:	|            48 89 c7             	mov    %rax,%rdi
+    4435:	|            e8 6b fe ff ff       	call   42a5 <nel::offset_of(unsigned char*, unsigned long)>
+    443a:	|            48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    uint8_t *const new_p = new_base + new_offset;
+    443e:	|            48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    4442:	|            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    4446:	|            48 01 d0             	add    %rdx,%rax
+    4449:	|            48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    if (old_p != nullptr && new_offset != old_offset) {
+    444d:	|            48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    4452:	|  /-------- 74 41                	je     4495 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+    4454:	|  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    4458:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    445c:	|  +-------- 74 37                	je     4495 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+    445e:	|  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    4462:	|  |         48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    4466:	|  |  /----- 73 06                	jae    446e <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x136>
+    4468:	|  |  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    446c:	|  |  |  /-- eb 04                	jmp    4472 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x13a>
+    446e:	|  |  \--|-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    4472:	|  |     \-> 48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        std::memmove(new_p, new_base + old_offset, n);
+    4476:	|  |         48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    447a:	|  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    447e:	|  |         48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    4482:	|  |         48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    4486:	|  |         48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    448a:	|  |         48 89 ce             	mov    %rcx,%rsi
+    448d:	|  |         48 89 c7             	mov    %rax,%rdi
+    4490:	|  |         e8 3b cc ff ff       	call   10d0 <memmove@plt>
+    }
+    offset_field(new_p) = new_offset;
+    4495:	|  \-------> 48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+    4499:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    449d:	|            48 89 c7             	mov    %rax,%rdi
+    44a0:	|            e8 3d fe ff ff       	call   42e2 <nel::offset_field(unsigned char*)>
+    44a5:	|            48 89 18             	mov    %rbx,(%rax)
+    return new_p;
+    44a8:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+}
+    44ac:	\----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    44b0:	             c9                   	leave
+    44b1:	             c3                   	ret
+
+00000000000044b2 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    44b2:	55                   	push   %rbp
+    44b3:	48 89 e5             	mov    %rsp,%rbp
+    44b6:	48 83 ec 10          	sub    $0x10,%rsp
+    44ba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    44be:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return realloc_aligned(nullptr, align, 0, size);
+    44c2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    44c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    44ca:	48 89 d1             	mov    %rdx,%rcx
+    44cd:	ba 00 00 00 00       	mov    $0x0,%edx
+    44d2:	48 89 c6             	mov    %rax,%rsi
+    44d5:	bf 00 00 00 00       	mov    $0x0,%edi
+    44da:	e8 59 fe ff ff       	call   4338 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+}
+    44df:	c9                   	leave
+    44e0:	c3                   	ret
+
+00000000000044e1 <nel::elem::poison(unsigned char*, unsigned long)>:
+{
+    44e1:	55                   	push   %rbp
+    44e2:	48 89 e5             	mov    %rsp,%rbp
+    44e5:	48 83 ec 10          	sub    $0x10,%rsp
+    44e9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    44ed:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    copy(d, s, n);
+    44f1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    44f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    44f9:	48 89 d6             	mov    %rdx,%rsi
+    44fc:	48 89 c7             	mov    %rax,%rdi
+    44ff:	e8 ae f8 ff ff       	call   3db2 <nel::elem::wipe(unsigned char*, unsigned long)>
+}
+    4504:	90                   	nop
+    4505:	c9                   	leave
+    4506:	c3                   	ret
+
+0000000000004507 <nel::assert(bool, char const*, nel::Context const&)>:
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx);
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    4507:	    55                   	push   %rbp
+    4508:	    48 89 e5             	mov    %rsp,%rbp
+    450b:	    48 83 ec 20          	sub    $0x20,%rsp
+    450f:	    89 f8                	mov    %edi,%eax
+    4511:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    4515:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    4519:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { assert_fail(msg, ctx); }
+    451c:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    4520:	    83 f0 01             	xor    $0x1,%eax
+    4523:	    84 c0                	test   %al,%al
+    4525:	/-- 74 13                	je     453a <nel::assert(bool, char const*, nel::Context const&)+0x33>
+    4527:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    452b:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    452f:	|   48 89 d6             	mov    %rdx,%rsi
+    4532:	|   48 89 c7             	mov    %rax,%rdi
+    4535:	|   e8 52 f7 ff ff       	call   3c8c <nel::assert_fail(char const*, nel::Context const&)>
+}
+    453a:	\-> 90                   	nop
+    453b:	    c9                   	leave
+    453c:	    c3                   	ret
+
+000000000000453d <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    453d:	55                   	push   %rbp
+    453e:	48 89 e5             	mov    %rsp,%rbp
+    4541:	48 83 ec 10          	sub    $0x10,%rsp
+    4545:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4549:	89 f0                	mov    %esi,%eax
+    454b:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    454e:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    4552:	48 8b 15 27 3b 00 00 	mov    0x3b27(%rip),%rdx        # 8080 <stderr@GLIBC_2.2.5>
+    4559:	48 89 d6             	mov    %rdx,%rsi
+    455c:	89 c7                	mov    %eax,%edi
+    455e:	e8 1d cb ff ff       	call   1080 <fputc@plt>
+    return outs;
+    4563:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    4567:	c9                   	leave
+    4568:	c3                   	ret
+
+0000000000004569 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    4569:	55                   	push   %rbp
+    456a:	48 89 e5             	mov    %rsp,%rbp
+    456d:	48 83 ec 10          	sub    $0x10,%rsp
+    4571:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4575:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    4579:	48 8b 15 00 3b 00 00 	mov    0x3b00(%rip),%rdx        # 8080 <stderr@GLIBC_2.2.5>
+    4580:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4584:	48 89 d6             	mov    %rdx,%rsi
+    4587:	48 89 c7             	mov    %rax,%rdi
+    458a:	e8 d1 ca ff ff       	call   1060 <fputs@plt>
+    return outs;
+    458f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    4593:	c9                   	leave
+    4594:	c3                   	ret
+
+0000000000004595 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    4595:	55                   	push   %rbp
+    4596:	48 89 e5             	mov    %rsp,%rbp
+    4599:	48 83 ec 10          	sub    $0x10,%rsp
+    459d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    45a1:	89 f0                	mov    %esi,%eax
+    45a3:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    45a6:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    45aa:	48 8b 05 cf 3a 00 00 	mov    0x3acf(%rip),%rax        # 8080 <stderr@GLIBC_2.2.5>
+    45b1:	48 8d 0d e5 0c 00 00 	lea    0xce5(%rip),%rcx        # 529d <nel::elem::streaming_min+0x45>
+    45b8:	48 89 ce             	mov    %rcx,%rsi
+    45bb:	48 89 c7             	mov    %rax,%rdi
+    45be:	b8 00 00 00 00       	mov    $0x0,%eax
+    45c3:	e8 d8 ca ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    45c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    45cc:	c9                   	leave
+    45cd:	c3                   	ret
+
+00000000000045ce <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    45ce:	55                   	push   %rbp
+    45cf:	48 89 e5             	mov    %rsp,%rbp
+    45d2:	48 83 ec 10          	sub    $0x10,%rsp
+    45d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    45da:	89 f0                	mov    %esi,%eax
+    45dc:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    45e0:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    45e4:	48 8b 05 95 3a 00 00 	mov    0x3a95(%rip),%rax        # 8080 <stderr@GLIBC_2.2.5>
+    45eb:	48 8d 0d ab 0c 00 00 	lea    0xcab(%rip),%rcx        # 529d <nel::elem::streaming_min+0x45>
+    45f2:	48 89 ce             	mov    %rcx,%rsi
+    45f5:	48 89 c7             	mov    %rax,%rdi
+    45f8:	b8 00 00 00 00       	mov    $0x0,%eax
+    45fd:	e8 9e ca ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    4602:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    4606:	c9                   	leave
+    4607:	c3                   	ret
+
+0000000000004608 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    4608:	55                   	push   %rbp
+    4609:	48 89 e5             	mov    %rsp,%rbp
+    460c:	48 83 ec 10          	sub    $0x10,%rsp
+    4610:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4614:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    4617:	48 8b 05 62 3a 00 00 	mov    0x3a62(%rip),%rax        # 8080 <stderr@GLIBC_2.2.5>
+    461e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    4621:	48 8d 0d 75 0c 00 00 	lea    0xc75(%rip),%rcx        # 529d <nel::elem::streaming_min+0x45>
+    4628:	48 89 ce             	mov    %rcx,%rsi
+    462b:	48 89 c7             	mov    %rax,%rdi
+    462e:	b8 00 00 00 00       	mov    $0x0,%eax
+    4633:	e8 68 ca ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    4638:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    463c:	c9                   	leave
+    463d:	c3                   	ret
+
+000000000000463e <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    463e:	55                   	push   %rbp
+    463f:	48 89 e5             	mov    %rsp,%rbp
+    4642:	48 83 ec 10          	sub    $0x10,%rsp
+    4646:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    464a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    464d:	48 8b 05 2c 3a 00 00 	mov    0x3a2c(%rip),%rax        # 8080 <stderr@GLIBC_2.2.5>
+    4654:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    4657:	48 8d 0d 3f 0c 00 00 	lea    0xc3f(%rip),%rcx        # 529d <nel::elem::streaming_min+0x45>
+    465e:	48 89 ce             	mov    %rcx,%rsi
+    4661:	48 89 c7             	mov    %rax,%rdi
+    4664:	b8 00 00 00 00       	mov    $0x0,%eax
+    4669:	e8 32 ca ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    466e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    4672:	c9                   	leave
+    4673:	c3                   	ret
+
+0000000000004674 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    4674:	55                   	push   %rbp
+    4675:	48 89 e5             	mov    %rsp,%rbp
+    4678:	48 83 ec 10          	sub    $0x10,%rsp
+    467c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4680:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    4684:	48 8b 05 f5 39 00 00 	mov    0x39f5(%rip),%rax        # 8080 <stderr@GLIBC_2.2.5>
+    468b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    468f:	48 8d 0d 0a 0c 00 00 	lea    0xc0a(%rip),%rcx        # 52a0 <nel::elem::streaming_min+0x48>
+    4696:	48 89 ce             	mov    %rcx,%rsi
+    4699:	48 89 c7             	mov    %rax,%rdi
+    469c:	b8 00 00 00 00       	mov    $0x0,%eax
+    46a1:	e8 fa c9 ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    46a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    46aa:	c9                   	leave
+    46ab:	c3                   	ret
+
+Disassembly of section .fini:
+
+00000000000046ac <_fini>:
+    46ac:	48 83 ec 08          	sub    $0x8,%rsp
+    46b0:	48 83 c4 08          	add    $0x8,%rsp
+    46b4:	c3                   	ret
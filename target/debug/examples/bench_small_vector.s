@@ -0,0 +1,4720 @@
+
+target/debug/examples/bench_small_vector:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 5f 00 00 	mov    0x5fc5(%rip),%rax        # 6fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 5f 00 00    	push   0x5fca(%rip)        # 6ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 5f 00 00    	jmp    *0x5fcc(%rip)        # 6ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 5f 00 00    	jmp    *0x5fca(%rip)        # 7000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 5f 00 00    	jmp    *0x5fc2(%rip)        # 7008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <clock_gettime@plt>:
+    1050:	ff 25 ba 5f 00 00    	jmp    *0x5fba(%rip)        # 7010 <clock_gettime@GLIBC_2.17>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputs@plt>:
+    1060:	ff 25 b2 5f 00 00    	jmp    *0x5fb2(%rip)        # 7018 <fputs@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <memset@plt>:
+    1070:	ff 25 aa 5f 00 00    	jmp    *0x5faa(%rip)        # 7020 <memset@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fputc@plt>:
+    1080:	ff 25 a2 5f 00 00    	jmp    *0x5fa2(%rip)        # 7028 <fputc@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <memcmp@plt>:
+    1090:	ff 25 9a 5f 00 00    	jmp    *0x5f9a(%rip)        # 7030 <memcmp@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <fprintf@plt>:
+    10a0:	ff 25 92 5f 00 00    	jmp    *0x5f92(%rip)        # 7038 <fprintf@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <memcpy@plt>:
+    10b0:	ff 25 8a 5f 00 00    	jmp    *0x5f8a(%rip)        # 7040 <memcpy@GLIBC_2.14>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <realloc@plt>:
+    10c0:	ff 25 82 5f 00 00    	jmp    *0x5f82(%rip)        # 7048 <realloc@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <memmove@plt>:
+    10d0:	ff 25 7a 5f 00 00    	jmp    *0x5f7a(%rip)        # 7050 <memmove@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010e0 <__cxa_finalize@plt>:
+    10e0:	ff 25 fa 5e 00 00    	jmp    *0x5efa(%rip)        # 6fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10e6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010f0 <_start>:
+    10f0:	31 ed                	xor    %ebp,%ebp
+    10f2:	49 89 d1             	mov    %rdx,%r9
+    10f5:	5e                   	pop    %rsi
+    10f6:	48 89 e2             	mov    %rsp,%rdx
+    10f9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    10fd:	50                   	push   %rax
+    10fe:	54                   	push   %rsp
+    10ff:	45 31 c0             	xor    %r8d,%r8d
+    1102:	31 c9                	xor    %ecx,%ecx
+    1104:	48 8d 3d 6f 01 00 00 	lea    0x16f(%rip),%rdi        # 127a <main>
+    110b:	ff 15 af 5e 00 00    	call   *0x5eaf(%rip)        # 6fc0 <__libc_start_main@GLIBC_2.34>
+    1111:	f4                   	hlt
+    1112:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1119:	00 00 00 
+    111c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001120 <deregister_tm_clones>:
+    1120:	    48 8d 3d 41 5f 00 00 	lea    0x5f41(%rip),%rdi        # 7068 <__TMC_END__>
+    1127:	    48 8d 05 3a 5f 00 00 	lea    0x5f3a(%rip),%rax        # 7068 <__TMC_END__>
+    112e:	    48 39 f8             	cmp    %rdi,%rax
+    1131:	/-- 74 15                	je     1148 <deregister_tm_clones+0x28>
+    1133:	|   48 8b 05 8e 5e 00 00 	mov    0x5e8e(%rip),%rax        # 6fc8 <_ITM_deregisterTMCloneTable@Base>
+    113a:	|   48 85 c0             	test   %rax,%rax
+    113d:	+-- 74 09                	je     1148 <deregister_tm_clones+0x28>
+    113f:	|   ff e0                	jmp    *%rax
+    1141:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1148:	\-> c3                   	ret
+    1149:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001150 <register_tm_clones>:
+    1150:	    48 8d 3d 11 5f 00 00 	lea    0x5f11(%rip),%rdi        # 7068 <__TMC_END__>
+    1157:	    48 8d 35 0a 5f 00 00 	lea    0x5f0a(%rip),%rsi        # 7068 <__TMC_END__>
+    115e:	    48 29 fe             	sub    %rdi,%rsi
+    1161:	    48 89 f0             	mov    %rsi,%rax
+    1164:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1168:	    48 c1 f8 03          	sar    $0x3,%rax
+    116c:	    48 01 c6             	add    %rax,%rsi
+    116f:	    48 d1 fe             	sar    %rsi
+    1172:	/-- 74 14                	je     1188 <register_tm_clones+0x38>
+    1174:	|   48 8b 05 5d 5e 00 00 	mov    0x5e5d(%rip),%rax        # 6fd8 <_ITM_registerTMCloneTable@Base>
+    117b:	|   48 85 c0             	test   %rax,%rax
+    117e:	+-- 74 08                	je     1188 <register_tm_clones+0x38>
+    1180:	|   ff e0                	jmp    *%rax
+    1182:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1188:	\-> c3                   	ret
+    1189:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001190 <__do_global_dtors_aux>:
+    1190:	       f3 0f 1e fa          	endbr64
+    1194:	       80 3d ed 5e 00 00 00 	cmpb   $0x0,0x5eed(%rip)        # 7088 <completed.0>
+    119b:	/----- 75 2b                	jne    11c8 <__do_global_dtors_aux+0x38>
+    119d:	|      55                   	push   %rbp
+    119e:	|      48 83 3d 3a 5e 00 00 	cmpq   $0x0,0x5e3a(%rip)        # 6fe0 <__cxa_finalize@GLIBC_2.2.5>
+    11a5:	|      00 
+    11a6:	|      48 89 e5             	mov    %rsp,%rbp
+    11a9:	|  /-- 74 0c                	je     11b7 <__do_global_dtors_aux+0x27>
+    11ab:	|  |   48 8b 3d ae 5e 00 00 	mov    0x5eae(%rip),%rdi        # 7060 <__dso_handle>
+    11b2:	|  |   e8 29 ff ff ff       	call   10e0 <__cxa_finalize@plt>
+    11b7:	|  \-> e8 64 ff ff ff       	call   1120 <deregister_tm_clones>
+    11bc:	|      c6 05 c5 5e 00 00 01 	movb   $0x1,0x5ec5(%rip)        # 7088 <completed.0>
+    11c3:	|      5d                   	pop    %rbp
+    11c4:	|      c3                   	ret
+    11c5:	|      0f 1f 00             	nopl   (%rax)
+    11c8:	\----> c3                   	ret
+    11c9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011d0 <frame_dummy>:
+    11d0:	f3 0f 1e fa          	endbr64
+    11d4:	e9 77 ff ff ff       	jmp    1150 <register_tm_clones>
+
+00000000000011d9 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    11d9:	55                   	push   %rbp
+    11da:	48 89 e5             	mov    %rsp,%rbp
+    11dd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11e1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    11e4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11e9:	5d                   	pop    %rbp
+    11ea:	c3                   	ret
+
+00000000000011eb <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    11eb:	55                   	push   %rbp
+    11ec:	48 89 e5             	mov    %rsp,%rbp
+    11ef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11f3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11f6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return -1;
+    11fa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11ff:	5d                   	pop    %rbp
+    1200:	c3                   	ret
+
+0000000000001201 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    1201:	55                   	push   %rbp
+    1202:	48 89 e5             	mov    %rsp,%rbp
+    1205:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1209:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    120c:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    return -1;
+    120f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1214:	5d                   	pop    %rbp
+    1215:	c3                   	ret
+
+0000000000001216 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    1216:	55                   	push   %rbp
+    1217:	48 89 e5             	mov    %rsp,%rbp
+    121a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    121e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1221:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    1224:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    return -1;
+    1227:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    122c:	5d                   	pop    %rbp
+    122d:	c3                   	ret
+
+000000000000122e <_read_r>:
+int _read_r(struct _reent *, int) {
+    122e:	55                   	push   %rbp
+    122f:	48 89 e5             	mov    %rsp,%rbp
+    1232:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1236:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1239:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    123e:	5d                   	pop    %rbp
+    123f:	c3                   	ret
+
+0000000000001240 <_write_r>:
+int _write_r(struct _reent *, int, char *, int) {
+    1240:	55                   	push   %rbp
+    1241:	48 89 e5             	mov    %rsp,%rbp
+    1244:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1248:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    124b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    124f:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+    return -1;
+    1252:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1257:	5d                   	pop    %rbp
+    1258:	c3                   	ret
+
+0000000000001259 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    1259:	55                   	push   %rbp
+    125a:	48 89 e5             	mov    %rsp,%rbp
+    125d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return -1;
+    1261:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1266:	5d                   	pop    %rbp
+    1267:	c3                   	ret
+
+0000000000001268 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1268:	55                   	push   %rbp
+    1269:	48 89 e5             	mov    %rsp,%rbp
+    126c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1270:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1273:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1278:	5d                   	pop    %rbp
+    1279:	c3                   	ret
+
+000000000000127a <main>:
+    bench::report(name, t);
+    nel::log << "  sum: " << sum << '\n';
+}
+
+int main()
+{
+    127a:	55                   	push   %rbp
+    127b:	48 89 e5             	mov    %rsp,%rbp
+    bench_lists<nel::heaped::Vector<int>>("1M lists of 6, heaped::Vector");
+    127e:	48 8d 05 bb 2d 00 00 	lea    0x2dbb(%rip),%rax        # 4040 <n_values+0x8>
+    1285:	48 89 c7             	mov    %rax,%rdi
+    1288:	e8 04 05 00 00       	call   1791 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)>
+    bench_lists<nel::heaped::SmallVector<int, 8>>("1M lists of 6, heaped::SmallVector<8>");
+    128d:	48 8d 05 cc 2d 00 00 	lea    0x2dcc(%rip),%rax        # 4060 <n_values+0x28>
+    1294:	48 89 c7             	mov    %rax,%rdi
+    1297:	e8 e7 06 00 00       	call   1983 <void bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)>
+}
+    129c:	b8 00 00 00 00       	mov    $0x0,%eax
+    12a1:	5d                   	pop    %rbp
+    12a2:	c3                   	ret
+
+00000000000012a3 <bench::now_ns()>:
+{
+    12a3:	55                   	push   %rbp
+    12a4:	48 89 e5             	mov    %rsp,%rbp
+    12a7:	48 83 ec 10          	sub    $0x10,%rsp
+    auto t = bench::time_ns([&sum]() {
+    12ab:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    12af:	48 89 c6             	mov    %rax,%rsi
+    12b2:	bf 01 00 00 00       	mov    $0x1,%edi
+    12b7:	e8 94 fd ff ff       	call   1050 <clock_gettime@plt>
+        for (nel::Index i = 0; i < n_lists; ++i) {
+    12bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12c0:	48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+    12c7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    12cb:	48 01 d0             	add    %rdx,%rax
+            auto v = Vec::empty();
+    12ce:	c9                   	leave
+    12cf:	c3                   	ret
+
+00000000000012d0 <bench::report(char const*, unsigned long, unsigned long)>:
+    bench_lists<nel::heaped::SmallVector<int, 8>>("1M lists of 6, heaped::SmallVector<8>");
+    12d0:	    55                   	push   %rbp
+    12d1:	    48 89 e5             	mov    %rsp,%rbp
+    12d4:	    48 83 ec 20          	sub    $0x20,%rsp
+    12d8:	    48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    12dc:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    12e0:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+}
+    12e4:	    48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12e8:	    48 89 c6             	mov    %rax,%rsi
+    12eb:	    48 8d 05 97 5d 00 00 	lea    0x5d97(%rip),%rax        # 7089 <nel::log>
+    12f2:	    48 89 c7             	mov    %rax,%rdi
+    12f5:	    e8 5d 27 00 00       	call   3a57 <nel::operator<<(nel::Log&, char const*)>
+    12fa:	    48 89 c2             	mov    %rax,%rdx
+    12fd:	    48 8d 05 04 2d 00 00 	lea    0x2d04(%rip),%rax        # 4008 <_IO_stdin_used+0x8>
+    1304:	    48 89 c6             	mov    %rax,%rsi
+    1307:	    48 89 d7             	mov    %rdx,%rdi
+    130a:	    e8 48 27 00 00       	call   3a57 <nel::operator<<(nel::Log&, char const*)>
+    130f:	    48 89 c1             	mov    %rax,%rcx
+    1312:	    48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1316:	    48 c1 e8 03          	shr    $0x3,%rax
+    131a:	    48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+    1321:	    9b c4 20 
+    1324:	    48 f7 e2             	mul    %rdx
+    1327:	    48 89 d0             	mov    %rdx,%rax
+    132a:	    48 c1 e8 04          	shr    $0x4,%rax
+    132e:	    48 89 c6             	mov    %rax,%rsi
+    1331:	    48 89 cf             	mov    %rcx,%rdi
+    1334:	    e8 29 28 00 00       	call   3b62 <nel::operator<<(nel::Log&, unsigned long)>
+    1339:	    48 89 c2             	mov    %rax,%rdx
+    133c:	    48 8d 05 c8 2c 00 00 	lea    0x2cc8(%rip),%rax        # 400b <_IO_stdin_used+0xb>
+    1343:	    48 89 c6             	mov    %rax,%rsi
+    1346:	    48 89 d7             	mov    %rdx,%rdi
+    1349:	    e8 09 27 00 00       	call   3a57 <nel::operator<<(nel::Log&, char const*)>
+    134e:	    48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1353:	/-- 74 57                	je     13ac <bench::report(char const*, unsigned long, unsigned long)+0xdc>
+    1355:	|   48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    135a:	+-- 74 50                	je     13ac <bench::report(char const*, unsigned long, unsigned long)+0xdc>
+    135c:	|   48 8d 05 ab 2c 00 00 	lea    0x2cab(%rip),%rax        # 400e <_IO_stdin_used+0xe>
+    1363:	|   48 89 c6             	mov    %rax,%rsi
+    1366:	|   48 8d 05 1c 5d 00 00 	lea    0x5d1c(%rip),%rax        # 7089 <nel::log>
+    136d:	|   48 89 c7             	mov    %rax,%rdi
+    1370:	|   e8 e2 26 00 00       	call   3a57 <nel::operator<<(nel::Log&, char const*)>
+    1375:	|   48 89 c1             	mov    %rax,%rcx
+    1378:	|   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    137c:	|   48 69 c0 e8 03 00 00 	imul   $0x3e8,%rax,%rax
+    1383:	|   ba 00 00 00 00       	mov    $0x0,%edx
+    1388:	|   48 f7 75 f0          	divq   -0x10(%rbp)
+    138c:	|   48 89 c6             	mov    %rax,%rsi
+    138f:	|   48 89 cf             	mov    %rcx,%rdi
+    1392:	|   e8 cb 27 00 00       	call   3b62 <nel::operator<<(nel::Log&, unsigned long)>
+    1397:	|   48 89 c2             	mov    %rax,%rdx
+    139a:	|   48 8d 05 70 2c 00 00 	lea    0x2c70(%rip),%rax        # 4011 <_IO_stdin_used+0x11>
+    13a1:	|   48 89 c6             	mov    %rax,%rsi
+    13a4:	|   48 89 d7             	mov    %rdx,%rdi
+    13a7:	|   e8 ab 26 00 00       	call   3a57 <nel::operator<<(nel::Log&, char const*)>
+    13ac:	\-> be 0a 00 00 00       	mov    $0xa,%esi
+    13b1:	    48 8d 05 d1 5c 00 00 	lea    0x5cd1(%rip),%rax        # 7089 <nel::log>
+    13b8:	    48 89 c7             	mov    %rax,%rdi
+    13bb:	    e8 6b 26 00 00       	call   3a2b <nel::operator<<(nel::Log&, char)>
+    13c0:	    90                   	nop
+    13c1:	    c9                   	leave
+    13c2:	    c3                   	ret
+
+00000000000013c3 <operator new(unsigned long, void*)>:
+
+#    if !defined(TEST)
+// catch2 uses stdlib and so uses stdlib's new defn.
+// Operator new must not be in a namespace
+inline void *operator new(nel::USize, void *p)
+{
+    13c3:	55                   	push   %rbp
+    13c4:	48 89 e5             	mov    %rsp,%rbp
+    13c7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    13cb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return p;
+    13cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+    13d3:	5d                   	pop    %rbp
+    13d4:	c3                   	ret
+    13d5:	90                   	nop
+
+00000000000013d6 <nel::Context::Context(char const*, char const*, int)>:
+        char const *fn_name_;
+        char const *file_name_;
+        int line_num_;
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+    13d6:	55                   	push   %rbp
+    13d7:	48 89 e5             	mov    %rsp,%rbp
+    13da:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    13de:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    13e2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    13e6:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    13e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13ed:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    13f1:	48 89 10             	mov    %rdx,(%rax)
+            , file_name_(file_name)
+    13f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13f8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    13fc:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , line_num_(line_num)
+    1400:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1404:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1407:	89 50 10             	mov    %edx,0x10(%rax)
+        {
+        }
+    140a:	90                   	nop
+    140b:	5d                   	pop    %rbp
+    140c:	c3                   	ret
+
+000000000000140d <nel::assert(bool, char const*, nel::Context const&)>:
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx);
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    140d:	    55                   	push   %rbp
+    140e:	    48 89 e5             	mov    %rsp,%rbp
+    1411:	    48 83 ec 20          	sub    $0x20,%rsp
+    1415:	    89 f8                	mov    %edi,%eax
+    1417:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    141b:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    141f:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { assert_fail(msg, ctx); }
+    1422:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    1426:	    83 f0 01             	xor    $0x1,%eax
+    1429:	    84 c0                	test   %al,%al
+    142b:	/-- 74 13                	je     1440 <nel::assert(bool, char const*, nel::Context const&)+0x33>
+    142d:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1431:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1435:	|   48 89 d6             	mov    %rdx,%rsi
+    1438:	|   48 89 c7             	mov    %rax,%rdi
+    143b:	|   e8 70 1d 00 00       	call   31b0 <nel::assert_fail(char const*, nel::Context const&)>
+}
+    1440:	\-> 90                   	nop
+    1441:	    c9                   	leave
+    1442:	    c3                   	ret
+
+0000000000001443 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>:
+        static Result<void *, AllocError> try_malloc(Length const align, Length const size)
+        {
+            return try_realloc(nullptr, align, 0, size);
+        }
+
+        static Result<void *, AllocError> try_realloc(void *const p,
+    1443:	          55                   	push   %rbp
+    1444:	          48 89 e5             	mov    %rsp,%rbp
+    1447:	          48 83 ec 40          	sub    $0x40,%rsp
+    144b:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    144f:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1453:	          48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    1457:	          48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    145b:	          4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+                                                      Length const align,
+                                                      Length const old_size,
+                                                      Length const new_size)
+        {
+            if (align == 0 || (align & (align - 1)) != 0) {
+    145f:	          48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    1464:	      /-- 74 11                	je     1477 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x34>
+    1466:	      |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    146a:	      |   48 83 e8 01          	sub    $0x1,%rax
+    146e:	      |   48 23 45 d8          	and    -0x28(%rbp),%rax
+    1472:	      |   48 85 c0             	test   %rax,%rax
+    1475:	   /--|-- 74 1c                	je     1493 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x50>
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+    1477:	   |  \-> c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+    147e:	   |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1482:	   |      48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    1486:	   |      48 89 d6             	mov    %rdx,%rsi
+    1489:	   |      48 89 c7             	mov    %rax,%rdi
+    148c:	   |      e8 39 01 00 00       	call   15ca <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+                                    : std::realloc(p, new_size);
+            if (new_p == nullptr) {
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+            }
+            return Result<void *, AllocError>::Ok(new_p);
+        }
+    1491:	/--|----- eb 79                	jmp    150c <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            void *const new_p = is_over_aligned(align)
+    1493:	|  \----> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1497:	|         48 89 c7             	mov    %rax,%rdi
+    149a:	|         e8 b4 00 00 00       	call   1553 <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+                                    ? realloc_aligned(p, align, old_size, new_size)
+    149f:	|         84 c0                	test   %al,%al
+    14a1:	|  /----- 74 1a                	je     14bd <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x7a>
+    14a3:	|  |      48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+    14a7:	|  |      48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    14ab:	|  |      48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+    14af:	|  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    14b3:	|  |      48 89 c7             	mov    %rax,%rdi
+    14b6:	|  |      e8 a1 23 00 00       	call   385c <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+    14bb:	|  |  /-- eb 13                	jmp    14d0 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x8d>
+                                    : std::realloc(p, new_size);
+    14bd:	|  \--|-> 48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    14c1:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    14c5:	|     |   48 89 d6             	mov    %rdx,%rsi
+    14c8:	|     |   48 89 c7             	mov    %rax,%rdi
+    14cb:	|     |   e8 f0 fb ff ff       	call   10c0 <realloc@plt>
+    14d0:	|     \-> 48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            if (new_p == nullptr) {
+    14d4:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14d8:	|         48 85 c0             	test   %rax,%rax
+    14db:	|     /-- 75 1c                	jne    14f9 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xb6>
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+    14dd:	|     |   c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    14e4:	|     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14e8:	|     |   48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    14ec:	|     |   48 89 d6             	mov    %rdx,%rsi
+    14ef:	|     |   48 89 c7             	mov    %rax,%rdi
+    14f2:	|     |   e8 d3 00 00 00       	call   15ca <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+        }
+    14f7:	+-----|-- eb 13                	jmp    150c <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            return Result<void *, AllocError>::Ok(new_p);
+    14f9:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14fd:	|         48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    1501:	|         48 89 d6             	mov    %rdx,%rsi
+    1504:	|         48 89 c7             	mov    %rax,%rdi
+    1507:	|         e8 f2 00 00 00       	call   15fe <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>
+        }
+    150c:	\-------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1510:	          c9                   	leave
+    1511:	          c3                   	ret
+
+0000000000001512 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>:
+
+        static void free(void *const p, Length const align, Length const size)
+    1512:	       55                   	push   %rbp
+    1513:	       48 89 e5             	mov    %rsp,%rbp
+    1516:	       48 83 ec 20          	sub    $0x20,%rsp
+    151a:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    151e:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1522:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+    1526:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    152a:	       48 89 c7             	mov    %rax,%rdi
+    152d:	       e8 21 00 00 00       	call   1553 <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+    1532:	       84 c0                	test   %al,%al
+    1534:	/----- 74 0e                	je     1544 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x32>
+                free_aligned(p);
+    1536:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    153a:	|      48 89 c7             	mov    %rax,%rdi
+    153d:	|      e8 d6 22 00 00       	call   3818 <nel::free_aligned(void*)>
+            } else {
+                std::free(p);
+            }
+        }
+    1542:	|  /-- eb 0c                	jmp    1550 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x3e>
+                std::free(p);
+    1544:	\--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1548:	   |   48 89 c7             	mov    %rax,%rdi
+    154b:	   |   e8 e0 fa ff ff       	call   1030 <free@plt>
+        }
+    1550:	   \-> 90                   	nop
+    1551:	       c9                   	leave
+    1552:	       c3                   	ret
+
+0000000000001553 <nel::heaped::Malloc::is_over_aligned(unsigned long)>:
+
+    private:
+        static constexpr bool is_over_aligned(Length const align)
+    1553:	55                   	push   %rbp
+    1554:	48 89 e5             	mov    %rsp,%rbp
+    1557:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return align > alignof(std::max_align_t);
+    155b:	48 83 7d f8 10       	cmpq   $0x10,-0x8(%rbp)
+    1560:	0f 97 c0             	seta   %al
+        }
+    1563:	5d                   	pop    %rbp
+    1564:	c3                   	ret
+    1565:	90                   	nop
+
+0000000000001566 <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+                Element<T> ok_;
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    1566:	             55                   	push   %rbp
+    1567:	             48 89 e5             	mov    %rsp,%rbp
+    156a:	             48 83 ec 30          	sub    $0x30,%rsp
+    156e:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result::dtor
+    1572:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1576:	             8b 00                	mov    (%rax),%eax
+    1578:	             83 f8 02             	cmp    $0x2,%eax
+    157b:	/----------- 74 43                	je     15c0 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5a>
+    157d:	|            83 f8 02             	cmp    $0x2,%eax
+    1580:	|        /-- 7f 09                	jg     158b <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x25>
+    1582:	|        |   85 c0                	test   %eax,%eax
+    1584:	|  /-----|-- 74 3d                	je     15c3 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5d>
+    1586:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    1589:	|  |  /--|-- 74 3b                	je     15c6 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x60>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    158b:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    158f:	|  |  |      b9 72 00 00 00       	mov    $0x72,%ecx
+    1594:	|  |  |      48 8d 15 eb 2a 00 00 	lea    0x2aeb(%rip),%rdx        # 4086 <n_values+0x4e>
+    159b:	|  |  |      48 8d 35 f6 2a 00 00 	lea    0x2af6(%rip),%rsi        # 4098 <n_values+0x60>
+    15a2:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    15a5:	|  |  |      e8 2c fe ff ff       	call   13d6 <nel::Context::Context(char const*, char const*, int)>
+    15aa:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    15ae:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    15b1:	|  |  |      48 8d 05 e8 2a 00 00 	lea    0x2ae8(%rip),%rax        # 40a0 <n_values+0x68>
+    15b8:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    15bb:	|  |  |      e8 95 1b 00 00       	call   3155 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    15c0:	\--|--|----> 90                   	nop
+    15c1:	   |  |  /-- eb 04                	jmp    15c7 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    15c3:	   \--|--|-> 90                   	nop
+    15c4:	      |  +-- eb 01                	jmp    15c7 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    15c6:	      \--|-> 90                   	nop
+                    break;
+            }
+        }
+    15c7:	         \-> 90                   	nop
+    15c8:	             c9                   	leave
+    15c9:	             c3                   	ret
+
+00000000000015ca <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>:
+         *
+         * @param val The value to move into the result as an err value.
+         *
+         * @returns a Result 'wrapping' the value given as an err value.
+         */
+        constexpr static Result Err(E &&val)
+    15ca:	55                   	push   %rbp
+    15cb:	48 89 e5             	mov    %rsp,%rbp
+    15ce:	48 83 ec 10          	sub    $0x10,%rsp
+    15d2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    15d6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            return Result(Phantom<Tag::ERR>(), forward<E>(val));
+    15da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15de:	48 89 c7             	mov    %rax,%rdi
+    15e1:	e8 1c 04 00 00       	call   1a02 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    15e6:	48 89 c2             	mov    %rax,%rdx
+    15e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15ed:	48 89 d6             	mov    %rdx,%rsi
+    15f0:	48 89 c7             	mov    %rax,%rdi
+    15f3:	e8 18 04 00 00       	call   1a10 <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>
+        }
+    15f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15fc:	c9                   	leave
+    15fd:	c3                   	ret
+
+00000000000015fe <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>:
+        constexpr static Result Ok(Args &&...args)
+    15fe:	55                   	push   %rbp
+    15ff:	48 89 e5             	mov    %rsp,%rbp
+    1602:	48 83 ec 10          	sub    $0x10,%rsp
+    1606:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    160a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<Args>(args)...);
+    160e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1612:	48 89 c7             	mov    %rax,%rdi
+    1615:	e8 37 04 00 00       	call   1a51 <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    161a:	48 89 c2             	mov    %rax,%rdx
+    161d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1621:	48 89 d6             	mov    %rdx,%rsi
+    1624:	48 89 c7             	mov    %rax,%rdi
+    1627:	e8 34 04 00 00       	call   1a60 <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>
+        }
+    162c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1630:	c9                   	leave
+    1631:	c3                   	ret
+
+0000000000001632 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&sum]() {
+    1632:	             55                   	push   %rbp
+    1633:	             48 89 e5             	mov    %rsp,%rbp
+    1636:	             48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    163a:	             48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+        for (nel::Index i = 0; i < n_lists; ++i) {
+    163e:	             48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1645:	             00 
+    1646:	   /-------- e9 c8 00 00 00       	jmp    1713 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0xe1>
+            auto v = Vec::empty();
+    164b:	/--|-------> 48 8d 45 98          	lea    -0x68(%rbp),%rax
+    164f:	|  |         48 89 c7             	mov    %rax,%rdi
+    1652:	|  |         e8 4a 04 00 00       	call   1aa1 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::empty()>
+            for (nel::Index j = 0; j < n_values; ++j) {
+    1657:	|  |         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    165e:	|  |         00 
+    165f:	|  |     /-- eb 69                	jmp    16ca <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x98>
+                v.push(int(i + j)).is_ok();
+    1661:	|  |  /--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1665:	|  |  |  |   89 c2                	mov    %eax,%edx
+    1667:	|  |  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    166b:	|  |  |  |   01 d0                	add    %edx,%eax
+    166d:	|  |  |  |   89 45 ac             	mov    %eax,-0x54(%rbp)
+    1670:	|  |  |  |   48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+    1674:	|  |  |  |   48 8d 55 ac          	lea    -0x54(%rbp),%rdx
+    1678:	|  |  |  |   48 8d 4d 98          	lea    -0x68(%rbp),%rcx
+    167c:	|  |  |  |   48 89 ce             	mov    %rcx,%rsi
+    167f:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1682:	|  |  |  |   e8 57 04 00 00       	call   1ade <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>
+    1687:	|  |  |  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    168b:	|  |  |  |   b9 17 00 00 00       	mov    $0x17,%ecx
+    1690:	|  |  |  |   48 8d 15 19 2a 00 00 	lea    0x2a19(%rip),%rdx        # 40b0 <n_values+0x78>
+    1697:	|  |  |  |   48 8d 35 31 2a 00 00 	lea    0x2a31(%rip),%rsi        # 40cf <n_values+0x97>
+    169e:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    16a1:	|  |  |  |   e8 30 fd ff ff       	call   13d6 <nel::Context::Context(char const*, char const*, int)>
+    16a6:	|  |  |  |   48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    16aa:	|  |  |  |   48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+    16ae:	|  |  |  |   48 89 d6             	mov    %rdx,%rsi
+    16b1:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    16b4:	|  |  |  |   e8 37 05 00 00       	call   1bf0 <nel::Result<void, int>::is_ok(nel::Context const&) const>
+    16b9:	|  |  |  |   48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+    16bd:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    16c0:	|  |  |  |   e8 a3 04 00 00       	call   1b68 <nel::Result<void, int>::~Result()>
+            for (nel::Index j = 0; j < n_values; ++j) {
+    16c5:	|  |  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    16ca:	|  |  |  \-> 48 83 7d f0 05       	cmpq   $0x5,-0x10(%rbp)
+    16cf:	|  |  \----- 76 90                	jbe    1661 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x2f>
+            v.iter().for_each([&sum](int const &e) { sum += (long unsigned int)e; });
+    16d1:	|  |         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    16d5:	|  |         48 8d 55 98          	lea    -0x68(%rbp),%rdx
+    16d9:	|  |         48 89 d6             	mov    %rdx,%rsi
+    16dc:	|  |         48 89 c7             	mov    %rax,%rdi
+    16df:	|  |         e8 42 00 00 00       	call   1726 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::iter()>
+    auto t = bench::time_ns([&sum]() {
+    16e4:	|  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    16e8:	|  |         48 8b 00             	mov    (%rax),%rax
+            v.iter().for_each([&sum](int const &e) { sum += (long unsigned int)e; });
+    16eb:	|  |         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    16ef:	|  |         48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+    16f3:	|  |         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    16f7:	|  |         48 89 d6             	mov    %rdx,%rsi
+    16fa:	|  |         48 89 c7             	mov    %rax,%rdi
+    16fd:	|  |         e8 aa 05 00 00       	call   1cac <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}>(bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}&&)>
+        for (nel::Index i = 0; i < n_lists; ++i) {
+    1702:	|  |         48 8d 45 98          	lea    -0x68(%rbp),%rax
+    1706:	|  |         48 89 c7             	mov    %rax,%rdi
+    1709:	|  |         e8 b2 03 00 00       	call   1ac0 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    170e:	|  |         48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1713:	|  \-------> 48 81 7d f8 3f 42 0f 	cmpq   $0xf423f,-0x8(%rbp)
+    171a:	|            00 
+    171b:	\----------- 0f 86 2a ff ff ff    	jbe    164b <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x19>
+    auto t = bench::time_ns([&sum]() {
+    1721:	             90                   	nop
+    1722:	             90                   	nop
+    1723:	             c9                   	leave
+    1724:	             c3                   	ret
+    1725:	             90                   	nop
+
+0000000000001726 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::iter()>:
+        constexpr auto iter(void) const
+        {
+            return slice().iter();
+        }
+
+        constexpr auto iter(void)
+    1726:	55                   	push   %rbp
+    1727:	48 89 e5             	mov    %rsp,%rbp
+    172a:	48 83 ec 20          	sub    $0x20,%rsp
+    172e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1732:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            return slice().iter();
+    1736:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    173a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    173e:	48 89 d6             	mov    %rdx,%rsi
+    1741:	48 89 c7             	mov    %rax,%rdi
+    1744:	e8 d1 04 00 00       	call   1c1a <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()>
+    1749:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    174d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    1751:	48 89 d6             	mov    %rdx,%rsi
+    1754:	48 89 c7             	mov    %rax,%rdi
+    1757:	e8 04 05 00 00       	call   1c60 <nel::Slice<int>::iter() const>
+        }
+    175c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1760:	c9                   	leave
+    1761:	c3                   	ret
+
+0000000000001762 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}::operator()(int const&) const>:
+            v.iter().for_each([&sum](int const &e) { sum += (long unsigned int)e; });
+    1762:	55                   	push   %rbp
+    1763:	48 89 e5             	mov    %rsp,%rbp
+    1766:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    176a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    176e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1772:	48 8b 00             	mov    (%rax),%rax
+    1775:	48 8b 08             	mov    (%rax),%rcx
+    1778:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    177c:	8b 00                	mov    (%rax),%eax
+    177e:	48 63 d0             	movslq %eax,%rdx
+    1781:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1785:	48 8b 00             	mov    (%rax),%rax
+    1788:	48 01 ca             	add    %rcx,%rdx
+    178b:	48 89 10             	mov    %rdx,(%rax)
+    178e:	90                   	nop
+    178f:	5d                   	pop    %rbp
+    1790:	c3                   	ret
+
+0000000000001791 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)>:
+void bench_lists(char const *const name)
+    1791:	55                   	push   %rbp
+    1792:	48 89 e5             	mov    %rsp,%rbp
+    1795:	48 83 ec 30          	sub    $0x30,%rsp
+    1799:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    long unsigned int sum = 0;
+    179d:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+    17a4:	00 
+    auto t = bench::time_ns([&sum]() {
+    17a5:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+    17a9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    17ad:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    17b1:	48 89 c7             	mov    %rax,%rdi
+    17b4:	e8 5e 05 00 00       	call   1d17 <unsigned long bench::time_ns<bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}>(bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}&&)>
+    17b9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    bench::report(name, t);
+    17bd:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    17c1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17c5:	ba 00 00 00 00       	mov    $0x0,%edx
+    17ca:	48 89 ce             	mov    %rcx,%rsi
+    17cd:	48 89 c7             	mov    %rax,%rdi
+    17d0:	e8 fb fa ff ff       	call   12d0 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << sum << '\n';
+    17d5:	48 8d 05 fe 28 00 00 	lea    0x28fe(%rip),%rax        # 40da <n_values+0xa2>
+    17dc:	48 89 c6             	mov    %rax,%rsi
+    17df:	48 8d 05 a3 58 00 00 	lea    0x58a3(%rip),%rax        # 7089 <nel::log>
+    17e6:	48 89 c7             	mov    %rax,%rdi
+    17e9:	e8 69 22 00 00       	call   3a57 <nel::operator<<(nel::Log&, char const*)>
+    17ee:	48 89 c2             	mov    %rax,%rdx
+    17f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17f5:	48 89 c6             	mov    %rax,%rsi
+    17f8:	48 89 d7             	mov    %rdx,%rdi
+    17fb:	e8 62 23 00 00       	call   3b62 <nel::operator<<(nel::Log&, unsigned long)>
+    1800:	be 0a 00 00 00       	mov    $0xa,%esi
+    1805:	48 89 c7             	mov    %rax,%rdi
+    1808:	e8 1e 22 00 00       	call   3a2b <nel::operator<<(nel::Log&, char)>
+}
+    180d:	90                   	nop
+    180e:	c9                   	leave
+    180f:	c3                   	ret
+
+0000000000001810 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&sum]() {
+    1810:	             55                   	push   %rbp
+    1811:	             48 89 e5             	mov    %rsp,%rbp
+    1814:	             48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+    181b:	             48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+        for (nel::Index i = 0; i < n_lists; ++i) {
+    1822:	             48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1829:	             00 
+    182a:	   /-------- e9 d7 00 00 00       	jmp    1906 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0xf6>
+            auto v = Vec::empty();
+    182f:	/--|-------> 48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    1836:	|  |         48 89 c7             	mov    %rax,%rdi
+    1839:	|  |         e8 05 05 00 00       	call   1d43 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::empty()>
+            for (nel::Index j = 0; j < n_values; ++j) {
+    183e:	|  |         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1845:	|  |         00 
+    1846:	|  |     /-- eb 6c                	jmp    18b4 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0xa4>
+                v.push(int(i + j)).is_ok();
+    1848:	|  |  /--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    184c:	|  |  |  |   89 c2                	mov    %eax,%edx
+    184e:	|  |  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1852:	|  |  |  |   01 d0                	add    %edx,%eax
+    1854:	|  |  |  |   89 45 ac             	mov    %eax,-0x54(%rbp)
+    1857:	|  |  |  |   48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+    185b:	|  |  |  |   48 8d 55 ac          	lea    -0x54(%rbp),%rdx
+    185f:	|  |  |  |   48 8d 8d 70 ff ff ff 	lea    -0x90(%rbp),%rcx
+    1866:	|  |  |  |   48 89 ce             	mov    %rcx,%rsi
+    1869:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    186c:	|  |  |  |   e8 73 05 00 00       	call   1de4 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>
+    1871:	|  |  |  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    1875:	|  |  |  |   b9 17 00 00 00       	mov    $0x17,%ecx
+    187a:	|  |  |  |   48 8d 15 2f 28 00 00 	lea    0x282f(%rip),%rdx        # 40b0 <n_values+0x78>
+    1881:	|  |  |  |   48 8d 35 47 28 00 00 	lea    0x2847(%rip),%rsi        # 40cf <n_values+0x97>
+    1888:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    188b:	|  |  |  |   e8 46 fb ff ff       	call   13d6 <nel::Context::Context(char const*, char const*, int)>
+    1890:	|  |  |  |   48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    1894:	|  |  |  |   48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+    1898:	|  |  |  |   48 89 d6             	mov    %rdx,%rsi
+    189b:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    189e:	|  |  |  |   e8 4d 03 00 00       	call   1bf0 <nel::Result<void, int>::is_ok(nel::Context const&) const>
+    18a3:	|  |  |  |   48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+    18a7:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    18aa:	|  |  |  |   e8 b9 02 00 00       	call   1b68 <nel::Result<void, int>::~Result()>
+            for (nel::Index j = 0; j < n_values; ++j) {
+    18af:	|  |  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    18b4:	|  |  |  \-> 48 83 7d f0 05       	cmpq   $0x5,-0x10(%rbp)
+    18b9:	|  |  \----- 76 8d                	jbe    1848 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x38>
+            v.iter().for_each([&sum](int const &e) { sum += (long unsigned int)e; });
+    18bb:	|  |         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    18bf:	|  |         48 8d 95 70 ff ff ff 	lea    -0x90(%rbp),%rdx
+    18c6:	|  |         48 89 d6             	mov    %rdx,%rsi
+    18c9:	|  |         48 89 c7             	mov    %rax,%rdi
+    18cc:	|  |         e8 47 00 00 00       	call   1918 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::iter()>
+    auto t = bench::time_ns([&sum]() {
+    18d1:	|  |         48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    18d8:	|  |         48 8b 00             	mov    (%rax),%rax
+            v.iter().for_each([&sum](int const &e) { sum += (long unsigned int)e; });
+    18db:	|  |         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    18df:	|  |         48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+    18e3:	|  |         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    18e7:	|  |         48 89 d6             	mov    %rdx,%rsi
+    18ea:	|  |         48 89 c7             	mov    %rax,%rdi
+    18ed:	|  |         e8 42 06 00 00       	call   1f34 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}>(bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}&&)>
+        for (nel::Index i = 0; i < n_lists; ++i) {
+    18f2:	|  |         48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    18f9:	|  |         48 89 c7             	mov    %rax,%rdi
+    18fc:	|  |         e8 7d 04 00 00       	call   1d7e <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~SmallVector()>
+    1901:	|  |         48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1906:	|  \-------> 48 81 7d f8 3f 42 0f 	cmpq   $0xf423f,-0x8(%rbp)
+    190d:	|            00 
+    190e:	\----------- 0f 86 1b ff ff ff    	jbe    182f <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x1f>
+    auto t = bench::time_ns([&sum]() {
+    1914:	             90                   	nop
+    1915:	             90                   	nop
+    1916:	             c9                   	leave
+    1917:	             c3                   	ret
+
+0000000000001918 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::iter()>:
+        constexpr auto iter(void) const
+        {
+            return slice().iter();
+        }
+
+        constexpr auto iter(void)
+    1918:	55                   	push   %rbp
+    1919:	48 89 e5             	mov    %rsp,%rbp
+    191c:	48 83 ec 20          	sub    $0x20,%rsp
+    1920:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1924:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            return slice().iter();
+    1928:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    192c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1930:	48 89 d6             	mov    %rdx,%rsi
+    1933:	48 89 c7             	mov    %rax,%rdi
+    1936:	e8 91 05 00 00       	call   1ecc <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()>
+    193b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    193f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    1943:	48 89 d6             	mov    %rdx,%rsi
+    1946:	48 89 c7             	mov    %rax,%rdi
+    1949:	e8 12 03 00 00       	call   1c60 <nel::Slice<int>::iter() const>
+        }
+    194e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1952:	c9                   	leave
+    1953:	c3                   	ret
+
+0000000000001954 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}::operator()(int const&) const>:
+            v.iter().for_each([&sum](int const &e) { sum += (long unsigned int)e; });
+    1954:	55                   	push   %rbp
+    1955:	48 89 e5             	mov    %rsp,%rbp
+    1958:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    195c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1960:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1964:	48 8b 00             	mov    (%rax),%rax
+    1967:	48 8b 08             	mov    (%rax),%rcx
+    196a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    196e:	8b 00                	mov    (%rax),%eax
+    1970:	48 63 d0             	movslq %eax,%rdx
+    1973:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1977:	48 8b 00             	mov    (%rax),%rax
+    197a:	48 01 ca             	add    %rcx,%rdx
+    197d:	48 89 10             	mov    %rdx,(%rax)
+    1980:	90                   	nop
+    1981:	5d                   	pop    %rbp
+    1982:	c3                   	ret
+
+0000000000001983 <void bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)>:
+void bench_lists(char const *const name)
+    1983:	55                   	push   %rbp
+    1984:	48 89 e5             	mov    %rsp,%rbp
+    1987:	48 83 ec 30          	sub    $0x30,%rsp
+    198b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    long unsigned int sum = 0;
+    198f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+    1996:	00 
+    auto t = bench::time_ns([&sum]() {
+    1997:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+    199b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    199f:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    19a3:	48 89 c7             	mov    %rax,%rdi
+    19a6:	e8 f4 05 00 00       	call   1f9f <unsigned long bench::time_ns<bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}>(bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}&&)>
+    19ab:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    bench::report(name, t);
+    19af:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    19b3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    19b7:	ba 00 00 00 00       	mov    $0x0,%edx
+    19bc:	48 89 ce             	mov    %rcx,%rsi
+    19bf:	48 89 c7             	mov    %rax,%rdi
+    19c2:	e8 09 f9 ff ff       	call   12d0 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << sum << '\n';
+    19c7:	48 8d 05 0c 27 00 00 	lea    0x270c(%rip),%rax        # 40da <n_values+0xa2>
+    19ce:	48 89 c6             	mov    %rax,%rsi
+    19d1:	48 8d 05 b1 56 00 00 	lea    0x56b1(%rip),%rax        # 7089 <nel::log>
+    19d8:	48 89 c7             	mov    %rax,%rdi
+    19db:	e8 77 20 00 00       	call   3a57 <nel::operator<<(nel::Log&, char const*)>
+    19e0:	48 89 c2             	mov    %rax,%rdx
+    19e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19e7:	48 89 c6             	mov    %rax,%rsi
+    19ea:	48 89 d7             	mov    %rdx,%rdi
+    19ed:	e8 70 21 00 00       	call   3b62 <nel::operator<<(nel::Log&, unsigned long)>
+    19f2:	be 0a 00 00 00       	mov    $0xa,%esi
+    19f7:	48 89 c7             	mov    %rax,%rdi
+    19fa:	e8 2c 20 00 00       	call   3a2b <nel::operator<<(nel::Log&, char)>
+}
+    19ff:	90                   	nop
+    1a00:	c9                   	leave
+    1a01:	c3                   	ret
+
+0000000000001a02 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel so to not need std.
+ */
+template<typename U, typename T>
+constexpr U &&forward(T &t)
+    1a02:	55                   	push   %rbp
+    1a03:	48 89 e5             	mov    %rsp,%rbp
+    1a06:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<U &&>(t);
+    1a0a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1a0e:	5d                   	pop    %rbp
+    1a0f:	c3                   	ret
+
+0000000000001a10 <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    1a10:	55                   	push   %rbp
+    1a11:	48 89 e5             	mov    %rsp,%rbp
+    1a14:	53                   	push   %rbx
+    1a15:	48 83 ec 18          	sub    $0x18,%rsp
+    1a19:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1a1d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    1a21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a25:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    1a2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a2f:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    1a33:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a37:	48 89 c7             	mov    %rax,%rdi
+    1a3a:	e8 c3 ff ff ff       	call   1a02 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    1a3f:	48 89 c6             	mov    %rax,%rsi
+    1a42:	48 89 df             	mov    %rbx,%rdi
+    1a45:	e8 82 05 00 00       	call   1fcc <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>
+        }
+    1a4a:	90                   	nop
+    1a4b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1a4f:	c9                   	leave
+    1a50:	c3                   	ret
+
+0000000000001a51 <void* const& nel::forward<void* const&, void* const>(void* const&)>:
+constexpr U &&forward(T &t)
+    1a51:	55                   	push   %rbp
+    1a52:	48 89 e5             	mov    %rsp,%rbp
+    1a55:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    1a59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1a5d:	5d                   	pop    %rbp
+    1a5e:	c3                   	ret
+    1a5f:	90                   	nop
+
+0000000000001a60 <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>:
+        constexpr Result(Phantom<Tag::OK> const, Args &&...args)
+    1a60:	55                   	push   %rbp
+    1a61:	48 89 e5             	mov    %rsp,%rbp
+    1a64:	53                   	push   %rbx
+    1a65:	48 83 ec 18          	sub    $0x18,%rsp
+    1a69:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1a6d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    1a71:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a75:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<Args>(args)...)
+    1a7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a7f:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    1a83:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a87:	48 89 c7             	mov    %rax,%rdi
+    1a8a:	e8 c2 ff ff ff       	call   1a51 <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    1a8f:	48 89 c6             	mov    %rax,%rsi
+    1a92:	48 89 df             	mov    %rbx,%rdi
+    1a95:	e8 5a 05 00 00       	call   1ff4 <nel::Element<void*>::Element<void* const&>(void* const&)>
+        }
+    1a9a:	90                   	nop
+    1a9b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1a9f:	c9                   	leave
+    1aa0:	c3                   	ret
+
+0000000000001aa1 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::empty()>:
+        static constexpr Vector empty(void)
+    1aa1:	55                   	push   %rbp
+    1aa2:	48 89 e5             	mov    %rsp,%rbp
+    1aa5:	48 83 ec 10          	sub    $0x10,%rsp
+    1aa9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Vector();
+    1aad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ab1:	48 89 c7             	mov    %rax,%rdi
+    1ab4:	e8 65 05 00 00       	call   201e <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector()>
+        }
+    1ab9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1abd:	c9                   	leave
+    1abe:	c3                   	ret
+    1abf:	90                   	nop
+
+0000000000001ac0 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>:
+        ~Vector(void)
+    1ac0:	55                   	push   %rbp
+    1ac1:	48 89 e5             	mov    %rsp,%rbp
+    1ac4:	48 83 ec 10          	sub    $0x10,%rsp
+    1ac8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            VectorNode::free(item_);
+    1acc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ad0:	48 8b 00             	mov    (%rax),%rax
+    1ad3:	48 89 c7             	mov    %rax,%rdi
+    1ad6:	e8 6f 05 00 00       	call   204a <nel::heaped::Node<int, nel::heaped::Malloc>::free(nel::heaped::Node<int, nel::heaped::Malloc>*)>
+        }
+    1adb:	90                   	nop
+    1adc:	c9                   	leave
+    1add:	c3                   	ret
+
+0000000000001ade <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>:
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+    1ade:	       55                   	push   %rbp
+    1adf:	       48 89 e5             	mov    %rsp,%rbp
+    1ae2:	       48 83 ec 30          	sub    $0x30,%rsp
+    1ae6:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1aea:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1aee:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            ok = try_reserve_for(1);
+    1af2:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1af6:	       be 01 00 00 00       	mov    $0x1,%esi
+    1afb:	       48 89 c7             	mov    %rax,%rdi
+    1afe:	       e8 93 05 00 00       	call   2096 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>
+    1b03:	       88 45 ff             	mov    %al,-0x1(%rbp)
+            if (!ok) { return Result<void, Type>::Err(val); }
+    1b06:	       0f b6 45 ff          	movzbl -0x1(%rbp),%eax
+    1b0a:	       83 f0 01             	xor    $0x1,%eax
+    1b0d:	       84 c0                	test   %al,%al
+    1b0f:	   /-- 74 15                	je     1b26 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x48>
+    1b11:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b15:	   |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1b19:	   |   48 89 d6             	mov    %rdx,%rsi
+    1b1c:	   |   48 89 c7             	mov    %rax,%rdi
+    1b1f:	   |   e8 dd 05 00 00       	call   2101 <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    1b24:	/--|-- eb 3b                	jmp    1b61 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x83>
+            if (item_ == nullptr) { return Result<void, Type>::Err(val); }
+    1b26:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1b2a:	|      48 8b 00             	mov    (%rax),%rax
+    1b2d:	|      48 85 c0             	test   %rax,%rax
+    1b30:	|  /-- 75 15                	jne    1b47 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x69>
+    1b32:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b36:	|  |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1b3a:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1b3d:	|  |   48 89 c7             	mov    %rax,%rdi
+    1b40:	|  |   e8 bc 05 00 00       	call   2101 <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    1b45:	+--|-- eb 1a                	jmp    1b61 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x83>
+            return item_->push_back(val);
+    1b47:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1b4b:	|      48 8b 08             	mov    (%rax),%rcx
+    1b4e:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b52:	|      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1b56:	|      48 89 ce             	mov    %rcx,%rsi
+    1b59:	|      48 89 c7             	mov    %rax,%rdi
+    1b5c:	|      e8 d5 05 00 00       	call   2136 <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int&>(int&)>
+        }
+    1b61:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b65:	       c9                   	leave
+    1b66:	       c3                   	ret
+    1b67:	       90                   	nop
+
+0000000000001b68 <nel::Result<void, int>::~Result()>:
+        union {
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    1b68:	             55                   	push   %rbp
+    1b69:	             48 89 e5             	mov    %rsp,%rbp
+    1b6c:	             48 83 ec 30          	sub    $0x30,%rsp
+    1b70:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result<void>-dtor
+    1b74:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1b78:	             8b 00                	mov    (%rax),%eax
+    1b7a:	             83 f8 02             	cmp    $0x2,%eax
+    1b7d:	/----------- 74 43                	je     1bc2 <nel::Result<void, int>::~Result()+0x5a>
+    1b7f:	|            83 f8 02             	cmp    $0x2,%eax
+    1b82:	|        /-- 7f 09                	jg     1b8d <nel::Result<void, int>::~Result()+0x25>
+    1b84:	|        |   85 c0                	test   %eax,%eax
+    1b86:	|  /-----|-- 74 3d                	je     1bc5 <nel::Result<void, int>::~Result()+0x5d>
+    1b88:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    1b8b:	|  |  /--|-- 74 3b                	je     1bc8 <nel::Result<void, int>::~Result()+0x60>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    1b8d:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1b91:	|  |  |      b9 dd 02 00 00       	mov    $0x2dd,%ecx
+    1b96:	|  |  |      48 8d 15 e9 24 00 00 	lea    0x24e9(%rip),%rdx        # 4086 <n_values+0x4e>
+    1b9d:	|  |  |      48 8d 35 f4 24 00 00 	lea    0x24f4(%rip),%rsi        # 4098 <n_values+0x60>
+    1ba4:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1ba7:	|  |  |      e8 2a f8 ff ff       	call   13d6 <nel::Context::Context(char const*, char const*, int)>
+    1bac:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1bb0:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    1bb3:	|  |  |      48 8d 05 e6 24 00 00 	lea    0x24e6(%rip),%rax        # 40a0 <n_values+0x68>
+    1bba:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1bbd:	|  |  |      e8 93 15 00 00       	call   3155 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    1bc2:	\--|--|----> 90                   	nop
+    1bc3:	   |  |  /-- eb 04                	jmp    1bc9 <nel::Result<void, int>::~Result()+0x61>
+                    break;
+    1bc5:	   \--|--|-> 90                   	nop
+    1bc6:	      |  +-- eb 01                	jmp    1bc9 <nel::Result<void, int>::~Result()+0x61>
+                    break;
+    1bc8:	      \--|-> 90                   	nop
+                    break;
+            }
+        }
+    1bc9:	         \-> 90                   	nop
+    1bca:	             c9                   	leave
+    1bcb:	             c3                   	ret
+
+0000000000001bcc <nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}::operator()() const>:
+         *
+         * `this` is not consumed by this op.
+         */
+        constexpr bool is_ok(Context const &ctx = Context()) const
+        {
+            return match<bool>([](void) -> bool { return true; },
+    1bcc:	55                   	push   %rbp
+    1bcd:	48 89 e5             	mov    %rsp,%rbp
+    1bd0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1bd4:	b8 01 00 00 00       	mov    $0x1,%eax
+    1bd9:	5d                   	pop    %rbp
+    1bda:	c3                   	ret
+    1bdb:	90                   	nop
+
+0000000000001bdc <nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}::operator()(int const&) const>:
+                               [](E const &) -> bool { return false; },
+    1bdc:	55                   	push   %rbp
+    1bdd:	48 89 e5             	mov    %rsp,%rbp
+    1be0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1be4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1be8:	b8 00 00 00 00       	mov    $0x0,%eax
+    1bed:	5d                   	pop    %rbp
+    1bee:	c3                   	ret
+    1bef:	90                   	nop
+
+0000000000001bf0 <nel::Result<void, int>::is_ok(nel::Context const&) const>:
+        constexpr bool is_ok(Context const &ctx = Context()) const
+    1bf0:	55                   	push   %rbp
+    1bf1:	48 89 e5             	mov    %rsp,%rbp
+    1bf4:	48 83 ec 20          	sub    $0x20,%rsp
+    1bf8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1bfc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](void) -> bool { return true; },
+    1c00:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1c04:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    1c08:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    1c0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c10:	48 89 c7             	mov    %rax,%rdi
+    1c13:	e8 e2 05 00 00       	call   21fa <bool nel::Result<void, int>::match<bool, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}>(nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}&&, nel::Context const&) const>
+                               ctx);
+        }
+    1c18:	c9                   	leave
+    1c19:	c3                   	ret
+
+0000000000001c1a <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()>:
+        constexpr Slice<Type> slice(void)
+    1c1a:	       55                   	push   %rbp
+    1c1b:	       48 89 e5             	mov    %rsp,%rbp
+    1c1e:	       48 83 ec 10          	sub    $0x10,%rsp
+    1c22:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1c26:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return (item_ == nullptr) ? Slice<Type>::empty() : item_->slice();
+    1c2a:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c2e:	       48 8b 00             	mov    (%rax),%rax
+    1c31:	       48 85 c0             	test   %rax,%rax
+    1c34:	   /-- 75 0e                	jne    1c44 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()+0x2a>
+    1c36:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c3a:	   |   48 89 c7             	mov    %rax,%rdi
+    1c3d:	   |   e8 49 06 00 00       	call   228b <nel::Slice<int>::empty()>
+    1c42:	/--|-- eb 16                	jmp    1c5a <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()+0x40>
+    1c44:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c48:	|      48 8b 10             	mov    (%rax),%rdx
+    1c4b:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c4f:	|      48 89 d6             	mov    %rdx,%rsi
+    1c52:	|      48 89 c7             	mov    %rax,%rdi
+    1c55:	|      e8 50 06 00 00       	call   22aa <nel::heaped::Node<int, nel::heaped::Malloc>::slice()>
+        }
+    1c5a:	\----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c5e:	       c9                   	leave
+    1c5f:	       c3                   	ret
+
+0000000000001c60 <nel::Slice<int>::iter() const>:
+         *
+         * The iterator is invalidated if the slice goes out of scope/destroyed.
+         */
+        typedef SliceIterator<Type> Iterator;
+
+        constexpr Iterator iter(void) const
+    1c60:	55                   	push   %rbp
+    1c61:	48 89 e5             	mov    %rsp,%rbp
+    1c64:	53                   	push   %rbx
+    1c65:	48 83 ec 18          	sub    $0x18,%rsp
+    1c69:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1c6d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            return Iterator(ptr(), len());
+    1c71:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c75:	48 89 c7             	mov    %rax,%rdi
+    1c78:	e8 7b 06 00 00       	call   22f8 <nel::Slice<int>::len() const>
+    1c7d:	48 89 c3             	mov    %rax,%rbx
+    1c80:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c84:	48 89 c7             	mov    %rax,%rdi
+    1c87:	e8 5a 06 00 00       	call   22e6 <nel::Slice<int>::ptr() const>
+    1c8c:	48 89 c1             	mov    %rax,%rcx
+    1c8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c93:	48 89 da             	mov    %rbx,%rdx
+    1c96:	48 89 ce             	mov    %rcx,%rsi
+    1c99:	48 89 c7             	mov    %rax,%rdi
+    1c9c:	e8 69 06 00 00       	call   230a <nel::SliceIterator<int>::SliceIterator(int*, unsigned long)>
+        }
+    1ca1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ca5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1ca9:	c9                   	leave
+    1caa:	c3                   	ret
+    1cab:	90                   	nop
+
+0000000000001cac <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}>(bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}&&)>:
+         * @param fn func to apply to each item in iterator
+         */
+        // void for_each(std::function<void(OutT)> fn)
+#    if defined(C_LIKE) || defined(RUST_LIKE)
+        template<typename F>
+        void for_each(F &&fn)
+    1cac:	       55                   	push   %rbp
+    1cad:	       48 89 e5             	mov    %rsp,%rbp
+    1cb0:	       48 83 ec 10          	sub    $0x10,%rsp
+    1cb4:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1cb8:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        template<typename F>
+        void for_each2(F &&fn)
+#        endif
+        {
+#        if 1
+            for (; !self().is_done(); self().inc()) {
+    1cbc:	   /-- eb 3a                	jmp    1cf8 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}>(bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}&&)+0x4c>
+                fn(self().deref());
+    1cbe:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cc2:	|  |   48 89 c7             	mov    %rax,%rdi
+    1cc5:	|  |   e8 7a 06 00 00       	call   2344 <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1cca:	|  |   48 89 c7             	mov    %rax,%rdi
+    1ccd:	|  |   e8 c6 06 00 00       	call   2398 <nel::SliceIterator<int>::deref()>
+    1cd2:	|  |   48 89 c2             	mov    %rax,%rdx
+    1cd5:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cd9:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1cdc:	|  |   48 89 c7             	mov    %rax,%rdi
+    1cdf:	|  |   e8 7e fa ff ff       	call   1762 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}::operator()(int const&) const>
+            for (; !self().is_done(); self().inc()) {
+    1ce4:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ce8:	|  |   48 89 c7             	mov    %rax,%rdi
+    1ceb:	|  |   e8 54 06 00 00       	call   2344 <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1cf0:	|  |   48 89 c7             	mov    %rax,%rdi
+    1cf3:	|  |   e8 82 06 00 00       	call   237a <nel::SliceIterator<int>::inc()>
+    1cf8:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cfc:	|      48 89 c7             	mov    %rax,%rdi
+    1cff:	|      e8 40 06 00 00       	call   2344 <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1d04:	|      48 89 c7             	mov    %rax,%rdi
+    1d07:	|      e8 4e 06 00 00       	call   235a <nel::SliceIterator<int>::is_done() const>
+    1d0c:	|      83 f0 01             	xor    $0x1,%eax
+    1d0f:	|      84 c0                	test   %al,%al
+    1d11:	\----- 75 ab                	jne    1cbe <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}>(bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}&&)+0x12>
+            fn(self().deref());
+            self().inc();
+enter:
+            if (!self().is_done()) { goto loop; }
+#        endif
+        }
+    1d13:	       90                   	nop
+    1d14:	       90                   	nop
+    1d15:	       c9                   	leave
+    1d16:	       c3                   	ret
+
+0000000000001d17 <unsigned long bench::time_ns<bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}>(bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}&&)>:
+            v.iter().for_each([&sum](int const &e) { sum += (long unsigned int)e; });
+    1d17:	55                   	push   %rbp
+    1d18:	48 89 e5             	mov    %rsp,%rbp
+    1d1b:	48 83 ec 20          	sub    $0x20,%rsp
+    1d1f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    });
+    1d23:	e8 7b f5 ff ff       	call   12a3 <bench::now_ns()>
+    1d28:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    bench::report(name, t);
+    1d2c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d30:	48 89 c7             	mov    %rax,%rdi
+    1d33:	e8 fa f8 ff ff       	call   1632 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const>
+    nel::log << "  sum: " << sum << '\n';
+    1d38:	e8 66 f5 ff ff       	call   12a3 <bench::now_ns()>
+    1d3d:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    1d41:	c9                   	leave
+    1d42:	c3                   	ret
+
+0000000000001d43 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::empty()>:
+        static constexpr SmallVector empty(void)
+    1d43:	55                   	push   %rbp
+    1d44:	48 89 e5             	mov    %rsp,%rbp
+    1d47:	48 83 ec 10          	sub    $0x10,%rsp
+    1d4b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return SmallVector();
+    1d4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d53:	48 89 c7             	mov    %rax,%rdi
+    1d56:	e8 6b 06 00 00       	call   23c6 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::SmallVector()>
+        }
+    1d5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d5f:	c9                   	leave
+    1d60:	c3                   	ret
+    1d61:	90                   	nop
+
+0000000000001d62 <nel::Manual<int [8]>::~Manual()>:
+        } u_;
+
+    public:
+        // default must not delete..
+        // doesn't know if value contained or not.
+        constexpr ~Manual() = default;
+    1d62:	55                   	push   %rbp
+    1d63:	48 89 e5             	mov    %rsp,%rbp
+    1d66:	48 83 ec 10          	sub    $0x10,%rsp
+    1d6a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1d6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d72:	48 89 c7             	mov    %rax,%rdi
+    1d75:	e8 82 06 00 00       	call   23fc <nel::Manual<int [8]>::U::~U()>
+    1d7a:	90                   	nop
+    1d7b:	c9                   	leave
+    1d7c:	c3                   	ret
+    1d7d:	90                   	nop
+
+0000000000001d7e <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~SmallVector()>:
+        ~SmallVector(void)
+    1d7e:	          55                   	push   %rbp
+    1d7f:	          48 89 e5             	mov    %rsp,%rbp
+    1d82:	          48 83 ec 20          	sub    $0x20,%rsp
+    1d86:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            if (item_ != nullptr) {
+    1d8a:	          48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d8e:	          48 8b 00             	mov    (%rax),%rax
+    1d91:	          48 85 c0             	test   %rax,%rax
+    1d94:	      /-- 74 11                	je     1da7 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~SmallVector()+0x29>
+                VectorNode::free(item_);
+    1d96:	      |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d9a:	      |   48 8b 00             	mov    (%rax),%rax
+    1d9d:	      |   48 89 c7             	mov    %rax,%rdi
+    1da0:	      |   e8 a5 02 00 00       	call   204a <nel::heaped::Node<int, nel::heaped::Malloc>::free(nel::heaped::Node<int, nel::heaped::Malloc>*)>
+    1da5:	/-----|-- eb 29                	jmp    1dd0 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~SmallVector()+0x52>
+                for (Index i = 0; i < len_; ++i) {
+    1da7:	|     \-> 48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1dae:	|         00 
+    1daf:	|     /-- eb 11                	jmp    1dc2 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~SmallVector()+0x44>
+                    inline_ptr()[i].~Type();
+    1db1:	|  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1db5:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    1db8:	|  |  |   e8 4b 06 00 00       	call   2408 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::inline_ptr()>
+                for (Index i = 0; i < len_; ++i) {
+    1dbd:	|  |  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1dc2:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1dc6:	|  |      48 8b 40 08          	mov    0x8(%rax),%rax
+    1dca:	|  |      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1dce:	|  \----- 72 e1                	jb     1db1 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~SmallVector()+0x33>
+        }
+    1dd0:	\-------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1dd4:	          48 83 c0 10          	add    $0x10,%rax
+    1dd8:	          48 89 c7             	mov    %rax,%rdi
+    1ddb:	          e8 82 ff ff ff       	call   1d62 <nel::Manual<int [8]>::~Manual()>
+    1de0:	          90                   	nop
+    1de1:	          c9                   	leave
+    1de2:	          c3                   	ret
+    1de3:	          90                   	nop
+
+0000000000001de4 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>:
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+    1de4:	       55                   	push   %rbp
+    1de5:	       48 89 e5             	mov    %rsp,%rbp
+    1de8:	       53                   	push   %rbx
+    1de9:	       48 83 ec 28          	sub    $0x28,%rsp
+    1ded:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1df1:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1df5:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            if (!try_reserve_for(1)) { return Result<void, Type>::Err(move(val)); }
+    1df9:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1dfd:	       be 01 00 00 00       	mov    $0x1,%esi
+    1e02:	       48 89 c7             	mov    %rax,%rdi
+    1e05:	       e8 1c 06 00 00       	call   2426 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>
+    1e0a:	       83 f0 01             	xor    $0x1,%eax
+    1e0d:	       84 c0                	test   %al,%al
+    1e0f:	   /-- 74 23                	je     1e34 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x50>
+    1e11:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1e15:	   |   48 89 c7             	mov    %rax,%rdi
+    1e18:	   |   e8 74 06 00 00       	call   2491 <int&& nel::move<int>(int&)>
+    1e1d:	   |   48 89 c2             	mov    %rax,%rdx
+    1e20:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e24:	   |   48 89 d6             	mov    %rdx,%rsi
+    1e27:	   |   48 89 c7             	mov    %rax,%rdi
+    1e2a:	   |   e8 70 06 00 00       	call   249f <nel::Result<void, int>::Err(int&&)>
+    1e2f:	/--|-- e9 8e 00 00 00       	jmp    1ec2 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0xde>
+            if (item_ != nullptr) { return item_->push_back(move(val)); }
+    1e34:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e38:	|      48 8b 00             	mov    (%rax),%rax
+    1e3b:	|      48 85 c0             	test   %rax,%rax
+    1e3e:	|  /-- 74 27                	je     1e67 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x83>
+    1e40:	|  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e44:	|  |   48 8b 18             	mov    (%rax),%rbx
+    1e47:	|  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1e4b:	|  |   48 89 c7             	mov    %rax,%rdi
+    1e4e:	|  |   e8 3e 06 00 00       	call   2491 <int&& nel::move<int>(int&)>
+    1e53:	|  |   48 89 c2             	mov    %rax,%rdx
+    1e56:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e5a:	|  |   48 89 de             	mov    %rbx,%rsi
+    1e5d:	|  |   48 89 c7             	mov    %rax,%rdi
+    1e60:	|  |   e8 6f 06 00 00       	call   24d4 <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int>(int&&)>
+    1e65:	+--|-- eb 5b                	jmp    1ec2 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0xde>
+            new (&inline_ptr()[len_]) Type(move(val));
+    1e67:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e6b:	|      48 89 c7             	mov    %rax,%rdi
+    1e6e:	|      e8 95 05 00 00       	call   2408 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::inline_ptr()>
+    1e73:	|      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1e77:	|      48 8b 52 08          	mov    0x8(%rdx),%rdx
+    1e7b:	|      48 c1 e2 02          	shl    $0x2,%rdx
+    1e7f:	|      48 01 d0             	add    %rdx,%rax
+    1e82:	|      48 89 c6             	mov    %rax,%rsi
+    1e85:	|      bf 04 00 00 00       	mov    $0x4,%edi
+    1e8a:	|      e8 34 f5 ff ff       	call   13c3 <operator new(unsigned long, void*)>
+    1e8f:	|      48 89 c3             	mov    %rax,%rbx
+    1e92:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1e96:	|      48 89 c7             	mov    %rax,%rdi
+    1e99:	|      e8 f3 05 00 00       	call   2491 <int&& nel::move<int>(int&)>
+    1e9e:	|      8b 00                	mov    (%rax),%eax
+    1ea0:	|      89 03                	mov    %eax,(%rbx)
+            len_ += 1;
+    1ea2:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ea6:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    1eaa:	|      48 8d 50 01          	lea    0x1(%rax),%rdx
+    1eae:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1eb2:	|      48 89 50 08          	mov    %rdx,0x8(%rax)
+            return Result<void, Type>::Ok();
+    1eb6:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1eba:	|      48 89 c7             	mov    %rax,%rdi
+    1ebd:	|      e8 d5 06 00 00       	call   2597 <nel::Result<void, int>::Ok()>
+        }
+    1ec2:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ec6:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1eca:	       c9                   	leave
+    1ecb:	       c3                   	ret
+
+0000000000001ecc <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()>:
+        constexpr Slice<Type> slice(void)
+    1ecc:	       55                   	push   %rbp
+    1ecd:	       48 89 e5             	mov    %rsp,%rbp
+    1ed0:	       53                   	push   %rbx
+    1ed1:	       48 83 ec 18          	sub    $0x18,%rsp
+    1ed5:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1ed9:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return (item_ == nullptr) ? Slice<Type>(inline_ptr(), len_) : item_->slice();
+    1edd:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ee1:	       48 8b 00             	mov    (%rax),%rax
+    1ee4:	       48 85 c0             	test   %rax,%rax
+    1ee7:	/----- 75 2b                	jne    1f14 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()+0x48>
+    1ee9:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1eed:	|      48 8b 58 08          	mov    0x8(%rax),%rbx
+    1ef1:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ef5:	|      48 89 c7             	mov    %rax,%rdi
+    1ef8:	|      e8 0b 05 00 00       	call   2408 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::inline_ptr()>
+    1efd:	|      48 89 c1             	mov    %rax,%rcx
+    1f00:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f04:	|      48 89 da             	mov    %rbx,%rdx
+    1f07:	|      48 89 ce             	mov    %rcx,%rsi
+    1f0a:	|      48 89 c7             	mov    %rax,%rdi
+    1f0d:	|      e8 a4 06 00 00       	call   25b6 <nel::Slice<int>::Slice(int*, unsigned long)>
+    1f12:	|  /-- eb 16                	jmp    1f2a <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()+0x5e>
+    1f14:	\--|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f18:	   |   48 8b 10             	mov    (%rax),%rdx
+    1f1b:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f1f:	   |   48 89 d6             	mov    %rdx,%rsi
+    1f22:	   |   48 89 c7             	mov    %rax,%rdi
+    1f25:	   |   e8 80 03 00 00       	call   22aa <nel::heaped::Node<int, nel::heaped::Malloc>::slice()>
+        }
+    1f2a:	   \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f2e:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1f32:	       c9                   	leave
+    1f33:	       c3                   	ret
+
+0000000000001f34 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}>(bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}&&)>:
+        void for_each(F &&fn)
+    1f34:	       55                   	push   %rbp
+    1f35:	       48 89 e5             	mov    %rsp,%rbp
+    1f38:	       48 83 ec 10          	sub    $0x10,%rsp
+    1f3c:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f40:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            for (; !self().is_done(); self().inc()) {
+    1f44:	   /-- eb 3a                	jmp    1f80 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}>(bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}&&)+0x4c>
+                fn(self().deref());
+    1f46:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f4a:	|  |   48 89 c7             	mov    %rax,%rdi
+    1f4d:	|  |   e8 f2 03 00 00       	call   2344 <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1f52:	|  |   48 89 c7             	mov    %rax,%rdi
+    1f55:	|  |   e8 3e 04 00 00       	call   2398 <nel::SliceIterator<int>::deref()>
+    1f5a:	|  |   48 89 c2             	mov    %rax,%rdx
+    1f5d:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f61:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1f64:	|  |   48 89 c7             	mov    %rax,%rdi
+    1f67:	|  |   e8 e8 f9 ff ff       	call   1954 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}::operator()(int const&) const>
+            for (; !self().is_done(); self().inc()) {
+    1f6c:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f70:	|  |   48 89 c7             	mov    %rax,%rdi
+    1f73:	|  |   e8 cc 03 00 00       	call   2344 <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1f78:	|  |   48 89 c7             	mov    %rax,%rdi
+    1f7b:	|  |   e8 fa 03 00 00       	call   237a <nel::SliceIterator<int>::inc()>
+    1f80:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f84:	|      48 89 c7             	mov    %rax,%rdi
+    1f87:	|      e8 b8 03 00 00       	call   2344 <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1f8c:	|      48 89 c7             	mov    %rax,%rdi
+    1f8f:	|      e8 c6 03 00 00       	call   235a <nel::SliceIterator<int>::is_done() const>
+    1f94:	|      83 f0 01             	xor    $0x1,%eax
+    1f97:	|      84 c0                	test   %al,%al
+    1f99:	\----- 75 ab                	jne    1f46 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}>(bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const::{lambda(int const&)#1}&&)+0x12>
+        }
+    1f9b:	       90                   	nop
+    1f9c:	       90                   	nop
+    1f9d:	       c9                   	leave
+    1f9e:	       c3                   	ret
+
+0000000000001f9f <unsigned long bench::time_ns<bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}>(bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}&&)>:
+            v.iter().for_each([&sum](int const &e) { sum += (long unsigned int)e; });
+    1f9f:	55                   	push   %rbp
+    1fa0:	48 89 e5             	mov    %rsp,%rbp
+    1fa3:	48 83 ec 20          	sub    $0x20,%rsp
+    1fa7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    });
+    1fab:	e8 f3 f2 ff ff       	call   12a3 <bench::now_ns()>
+    1fb0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    bench::report(name, t);
+    1fb4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1fb8:	48 89 c7             	mov    %rax,%rdi
+    1fbb:	e8 50 f8 ff ff       	call   1810 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const>
+    nel::log << "  sum: " << sum << '\n';
+    1fc0:	e8 de f2 ff ff       	call   12a3 <bench::now_ns()>
+    1fc5:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    1fc9:	c9                   	leave
+    1fca:	c3                   	ret
+    1fcb:	90                   	nop
+
+0000000000001fcc <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>:
+        constexpr Element &operator=(Element const &) const = delete;
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+    1fcc:	55                   	push   %rbp
+    1fcd:	48 89 e5             	mov    %rsp,%rbp
+    1fd0:	48 83 ec 10          	sub    $0x10,%rsp
+    1fd4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1fd8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    1fdc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1fe0:	48 89 c7             	mov    %rax,%rdi
+    1fe3:	e8 1a fa ff ff       	call   1a02 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    1fe8:	8b 10                	mov    (%rax),%edx
+    1fea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fee:	89 10                	mov    %edx,(%rax)
+        {
+        }
+    1ff0:	90                   	nop
+    1ff1:	c9                   	leave
+    1ff2:	c3                   	ret
+    1ff3:	90                   	nop
+
+0000000000001ff4 <nel::Element<void*>::Element<void* const&>(void* const&)>:
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+    1ff4:	55                   	push   %rbp
+    1ff5:	48 89 e5             	mov    %rsp,%rbp
+    1ff8:	48 83 ec 10          	sub    $0x10,%rsp
+    1ffc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2000:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Args>(args)...)
+    2004:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2008:	48 89 c7             	mov    %rax,%rdi
+    200b:	e8 41 fa ff ff       	call   1a51 <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    2010:	48 8b 10             	mov    (%rax),%rdx
+    2013:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2017:	48 89 10             	mov    %rdx,(%rax)
+        {
+        }
+    201a:	90                   	nop
+    201b:	c9                   	leave
+    201c:	c3                   	ret
+    201d:	90                   	nop
+
+000000000000201e <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector()>:
+        constexpr Vector(void)
+    201e:	55                   	push   %rbp
+    201f:	48 89 e5             	mov    %rsp,%rbp
+    2022:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : item_(nullptr)
+    2026:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    202a:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        }
+    2031:	90                   	nop
+    2032:	5d                   	pop    %rbp
+    2033:	c3                   	ret
+
+0000000000002034 <nel::heaped::Node<int, nel::heaped::Malloc>::size_of(unsigned long)>:
+        // Largest number of values a node can hold, keeping its size within ISize.
+        static constexpr Count max_capacity = (__PTRDIFF_MAX__ - sizeof(Node)) / sizeof(T);
+
+        // Size in bytes of a node holding cap values.
+        // alignof(T) is included in align of Node.
+        static constexpr Length size_of(Count const cap)
+    2034:	55                   	push   %rbp
+    2035:	48 89 e5             	mov    %rsp,%rbp
+    2038:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    203c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2040:	48 83 c0 05          	add    $0x5,%rax
+    2044:	48 c1 e0 02          	shl    $0x2,%rax
+        }
+    2048:	5d                   	pop    %rbp
+    2049:	c3                   	ret
+
+000000000000204a <nel::heaped::Node<int, nel::heaped::Malloc>::free(nel::heaped::Node<int, nel::heaped::Malloc>*)>:
+        static void free(Node *old)
+    204a:	       55                   	push   %rbp
+    204b:	       48 89 e5             	mov    %rsp,%rbp
+    204e:	       48 83 ec 20          	sub    $0x20,%rsp
+    2052:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            if (old == nullptr) { return; }
+    2056:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    205b:	/----- 74 36                	je     2093 <nel::heaped::Node<int, nel::heaped::Malloc>::free(nel::heaped::Node<int, nel::heaped::Malloc>*)+0x49>
+            Length const sz = size_of(old->alloc_);
+    205d:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2061:	|      48 8b 00             	mov    (%rax),%rax
+    2064:	|      48 89 c7             	mov    %rax,%rdi
+    2067:	|      e8 c8 ff ff ff       	call   2034 <nel::heaped::Node<int, nel::heaped::Malloc>::size_of(unsigned long)>
+    206c:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            old->~Node();
+    2070:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2074:	|      48 89 c7             	mov    %rax,%rdi
+    2077:	|      e8 64 05 00 00       	call   25e0 <nel::heaped::Node<int, nel::heaped::Malloc>::~Node()>
+            Allocator::free(old, alignof(Node), sz);
+    207c:	|      48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2080:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2084:	|      be 08 00 00 00       	mov    $0x8,%esi
+    2089:	|      48 89 c7             	mov    %rax,%rdi
+    208c:	|      e8 81 f4 ff ff       	call   1512 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>
+    2091:	|  /-- eb 01                	jmp    2094 <nel::heaped::Node<int, nel::heaped::Malloc>::free(nel::heaped::Node<int, nel::heaped::Malloc>*)+0x4a>
+            if (old == nullptr) { return; }
+    2093:	\--|-> 90                   	nop
+        }
+    2094:	   \-> c9                   	leave
+    2095:	       c3                   	ret
+
+0000000000002096 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>:
+        bool try_reserve_for(Count const n)
+    2096:	       55                   	push   %rbp
+    2097:	       48 89 e5             	mov    %rsp,%rbp
+    209a:	       53                   	push   %rbx
+    209b:	       48 83 ec 18          	sub    $0x18,%rsp
+    209f:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    20a3:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            if (len() + n <= capacity()) { return true; }
+    20a7:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20ab:	       48 89 c7             	mov    %rax,%rdi
+    20ae:	       e8 63 05 00 00       	call   2616 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    20b3:	       48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    20b7:	       48 8d 1c 10          	lea    (%rax,%rdx,1),%rbx
+    20bb:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20bf:	       48 89 c7             	mov    %rax,%rdi
+    20c2:	       e8 7f 05 00 00       	call   2646 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    20c7:	       48 39 d8             	cmp    %rbx,%rax
+    20ca:	       0f 93 c0             	setae  %al
+    20cd:	       84 c0                	test   %al,%al
+    20cf:	   /-- 74 07                	je     20d8 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x42>
+    20d1:	   |   b8 01 00 00 00       	mov    $0x1,%eax
+    20d6:	/--|-- eb 23                	jmp    20fb <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x65>
+            return try_reserve(len() + n);
+    20d8:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20dc:	|      48 89 c7             	mov    %rax,%rdi
+    20df:	|      e8 32 05 00 00       	call   2616 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    20e4:	|      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    20e8:	|      48 01 c2             	add    %rax,%rdx
+    20eb:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20ef:	|      48 89 d6             	mov    %rdx,%rsi
+    20f2:	|      48 89 c7             	mov    %rax,%rdi
+    20f5:	|      e8 7c 05 00 00       	call   2676 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>
+    20fa:	|      90                   	nop
+        }
+    20fb:	\----> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    20ff:	       c9                   	leave
+    2100:	       c3                   	ret
+
+0000000000002101 <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>:
+        constexpr static Result Err(Args &&...args)
+    2101:	55                   	push   %rbp
+    2102:	48 89 e5             	mov    %rsp,%rbp
+    2105:	48 83 ec 10          	sub    $0x10,%rsp
+    2109:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    210d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    2111:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2115:	48 89 c7             	mov    %rax,%rdi
+    2118:	e8 ac 06 00 00       	call   27c9 <int& nel::forward<int&, int>(int&)>
+    211d:	48 89 c2             	mov    %rax,%rdx
+    2120:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2124:	48 89 d6             	mov    %rdx,%rsi
+    2127:	48 89 c7             	mov    %rax,%rdi
+    212a:	e8 a9 06 00 00       	call   27d8 <nel::Result<void, int>::Result<int&>(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)2>, int&)>
+        }
+    212f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2133:	c9                   	leave
+    2134:	c3                   	ret
+    2135:	90                   	nop
+
+0000000000002136 <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int&>(int&)>:
+            }
+        }
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+    2136:	       55                   	push   %rbp
+    2137:	       48 89 e5             	mov    %rsp,%rbp
+    213a:	       53                   	push   %rbx
+    213b:	       48 83 ec 28          	sub    $0x28,%rsp
+    213f:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2143:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2147:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+        {
+            if (len() >= capacity()) {
+    214b:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    214f:	       48 89 c7             	mov    %rax,%rdi
+    2152:	       e8 c3 06 00 00       	call   281a <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    2157:	       48 89 c3             	mov    %rax,%rbx
+    215a:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    215e:	       48 89 c7             	mov    %rax,%rdi
+    2161:	       e8 c6 06 00 00       	call   282c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    2166:	       48 39 c3             	cmp    %rax,%rbx
+    2169:	       0f 93 c0             	setae  %al
+    216c:	       84 c0                	test   %al,%al
+    216e:	   /-- 74 20                	je     2190 <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int&>(int&)+0x5a>
+                // TODO: don't want to create a T on error though..
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+    2170:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2174:	   |   48 89 c7             	mov    %rax,%rdi
+    2177:	   |   e8 4d 06 00 00       	call   27c9 <int& nel::forward<int&, int>(int&)>
+    217c:	   |   48 89 c2             	mov    %rax,%rdx
+    217f:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2183:	   |   48 89 d6             	mov    %rdx,%rsi
+    2186:	   |   48 89 c7             	mov    %rax,%rdi
+    2189:	   |   e8 73 ff ff ff       	call   2101 <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    218e:	/--|-- eb 5f                	jmp    21ef <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int&>(int&)+0xb9>
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    2190:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2194:	|      48 89 c7             	mov    %rax,%rdi
+    2197:	|      e8 7e 06 00 00       	call   281a <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    219c:	|      48 83 c0 04          	add    $0x4,%rax
+    21a0:	|      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    21a7:	|      00 
+    21a8:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    21ac:	|      48 01 d0             	add    %rdx,%rax
+    21af:	|      48 89 c6             	mov    %rax,%rsi
+    21b2:	|      bf 04 00 00 00       	mov    $0x4,%edi
+    21b7:	|      e8 07 f2 ff ff       	call   13c3 <operator new(unsigned long, void*)>
+    21bc:	|      48 89 c3             	mov    %rax,%rbx
+    21bf:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    21c3:	|      48 89 c7             	mov    %rax,%rdi
+    21c6:	|      e8 fe 05 00 00       	call   27c9 <int& nel::forward<int&, int>(int&)>
+    21cb:	|      8b 00                	mov    (%rax),%eax
+    21cd:	|      89 03                	mov    %eax,(%rbx)
+            len_ += 1;
+    21cf:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    21d3:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    21d7:	|      48 8d 50 01          	lea    0x1(%rax),%rdx
+    21db:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    21df:	|      48 89 50 08          	mov    %rdx,0x8(%rax)
+            return Result<void, Type>::Ok();
+    21e3:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    21e7:	|      48 89 c7             	mov    %rax,%rdi
+    21ea:	|      e8 a8 03 00 00       	call   2597 <nel::Result<void, int>::Ok()>
+        }
+    21ef:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    21f3:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    21f7:	       c9                   	leave
+    21f8:	       c3                   	ret
+    21f9:	       90                   	nop
+
+00000000000021fa <bool nel::Result<void, int>::match<bool, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}>(nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    21fa:	             55                   	push   %rbp
+    21fb:	             48 89 e5             	mov    %rsp,%rbp
+    21fe:	             48 83 ec 20          	sub    $0x20,%rsp
+    2202:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2206:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    220a:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    220e:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result<void>-match
+    2212:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2216:	             8b 00                	mov    (%rax),%eax
+    2218:	             83 f8 02             	cmp    $0x2,%eax
+    221b:	         /-- 74 1c                	je     2239 <bool nel::Result<void, int>::match<bool, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}>(nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}&&, nel::Context const&) const+0x3f>
+    221d:	         |   83 f8 02             	cmp    $0x2,%eax
+    2220:	/--------|-- 7f 51                	jg     2273 <bool nel::Result<void, int>::match<bool, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}>(nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}&&, nel::Context const&) const+0x79>
+    2222:	|        |   85 c0                	test   %eax,%eax
+    2224:	|     /--|-- 74 37                	je     225d <bool nel::Result<void, int>::match<bool, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}>(nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}&&, nel::Context const&) const+0x63>
+    2226:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    2229:	+-----|--|-- 75 48                	jne    2273 <bool nel::Result<void, int>::match<bool, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}>(nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}&&, nel::Context const&) const+0x79>
+                    return on_ok();
+    222b:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    222f:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    2232:	|     |  |   e8 95 f9 ff ff       	call   1bcc <nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}::operator()() const>
+    2237:	|  /--|--|-- eb 50                	jmp    2289 <bool nel::Result<void, int>::match<bool, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}>(nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_err(*err_);
+    2239:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    223d:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    2241:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2244:	|  |  |      e8 f5 05 00 00       	call   283e <nel::Element<int>::operator*() const>
+    2249:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    224c:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2250:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    2253:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2256:	|  |  |      e8 81 f9 ff ff       	call   1bdc <nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}::operator()(int const&) const>
+    225b:	|  +--|----- eb 2c                	jmp    2289 <bool nel::Result<void, int>::match<bool, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}>(nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, int>::is_ok(nel::Context const&) const::{lambda(int const&)#2}&&, nel::Context const&) const+0x8f>
+                    nel::panic("invalid Result", ctx);
+    225d:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2261:	|  |         48 89 c6             	mov    %rax,%rsi
+    2264:	|  |         48 8d 05 77 1e 00 00 	lea    0x1e77(%rip),%rax        # 40e2 <n_values+0xaa>
+    226b:	|  |         48 89 c7             	mov    %rax,%rdi
+    226e:	|  |         e8 e2 0e 00 00       	call   3155 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    2273:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2277:	   |         48 89 c6             	mov    %rax,%rsi
+    227a:	   |         48 8d 05 1f 1e 00 00 	lea    0x1e1f(%rip),%rax        # 40a0 <n_values+0x68>
+    2281:	   |         48 89 c7             	mov    %rax,%rdi
+    2284:	   |         e8 cc 0e 00 00       	call   3155 <nel::panic(char const*, nel::Context const&)>
+        }
+    2289:	   \-------> c9                   	leave
+    228a:	             c3                   	ret
+
+000000000000228b <nel::Slice<int>::empty()>:
+        static constexpr Slice empty(void)
+    228b:	55                   	push   %rbp
+    228c:	48 89 e5             	mov    %rsp,%rbp
+    228f:	48 83 ec 10          	sub    $0x10,%rsp
+    2293:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Slice();
+    2297:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    229b:	48 89 c7             	mov    %rax,%rdi
+    229e:	e8 b5 05 00 00       	call   2858 <nel::Slice<int>::Slice()>
+        }
+    22a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22a7:	c9                   	leave
+    22a8:	c3                   	ret
+    22a9:	90                   	nop
+
+00000000000022aa <nel::heaped::Node<int, nel::heaped::Malloc>::slice()>:
+        constexpr Slice<Type> slice(void)
+    22aa:	55                   	push   %rbp
+    22ab:	48 89 e5             	mov    %rsp,%rbp
+    22ae:	48 83 ec 10          	sub    $0x10,%rsp
+    22b2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    22b6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Slice(values_, len());
+    22ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22be:	48 89 c7             	mov    %rax,%rdi
+    22c1:	e8 54 05 00 00       	call   281a <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    22c6:	48 89 c2             	mov    %rax,%rdx
+    22c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22cd:	48 8d 48 10          	lea    0x10(%rax),%rcx
+    22d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22d5:	48 89 ce             	mov    %rcx,%rsi
+    22d8:	48 89 c7             	mov    %rax,%rdi
+    22db:	e8 d6 02 00 00       	call   25b6 <nel::Slice<int>::Slice(int*, unsigned long)>
+        }
+    22e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22e4:	c9                   	leave
+    22e5:	c3                   	ret
+
+00000000000022e6 <nel::Slice<int>::ptr() const>:
+        constexpr Type *ptr(void) const
+    22e6:	55                   	push   %rbp
+    22e7:	48 89 e5             	mov    %rsp,%rbp
+    22ea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return content_;
+    22ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22f2:	48 8b 00             	mov    (%rax),%rax
+        }
+    22f5:	5d                   	pop    %rbp
+    22f6:	c3                   	ret
+    22f7:	90                   	nop
+
+00000000000022f8 <nel::Slice<int>::len() const>:
+        constexpr Length len(void) const
+    22f8:	55                   	push   %rbp
+    22f9:	48 89 e5             	mov    %rsp,%rbp
+    22fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    2300:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2304:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    2308:	5d                   	pop    %rbp
+    2309:	c3                   	ret
+
+000000000000230a <nel::SliceIterator<int>::SliceIterator(int*, unsigned long)>:
+            }
+            return *this;
+        }
+
+    public:
+        constexpr SliceIterator(T arr[], Count len)
+    230a:	55                   	push   %rbp
+    230b:	48 89 e5             	mov    %rsp,%rbp
+    230e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2312:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2316:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : b_(arr)
+    231a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    231e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2322:	48 89 10             	mov    %rdx,(%rax)
+            , e_(arr + len)
+    2325:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2329:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2330:	00 
+    2331:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2335:	48 01 c2             	add    %rax,%rdx
+    2338:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    233c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        {
+        }
+    2340:	90                   	nop
+    2341:	5d                   	pop    %rbp
+    2342:	c3                   	ret
+    2343:	90                   	nop
+
+0000000000002344 <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>:
+        constexpr ItT &self(void)
+    2344:	55                   	push   %rbp
+    2345:	48 89 e5             	mov    %rsp,%rbp
+    2348:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    234c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2350:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    2354:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2358:	5d                   	pop    %rbp
+    2359:	c3                   	ret
+
+000000000000235a <nel::SliceIterator<int>::is_done() const>:
+        }
+#    endif
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+    235a:	55                   	push   %rbp
+    235b:	48 89 e5             	mov    %rsp,%rbp
+    235e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return (b_ == e_);
+    2362:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2366:	48 8b 10             	mov    (%rax),%rdx
+    2369:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    236d:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2371:	48 39 c2             	cmp    %rax,%rdx
+    2374:	0f 94 c0             	sete   %al
+        }
+    2377:	5d                   	pop    %rbp
+    2378:	c3                   	ret
+    2379:	90                   	nop
+
+000000000000237a <nel::SliceIterator<int>::inc()>:
+
+        void inc(void)
+    237a:	55                   	push   %rbp
+    237b:	48 89 e5             	mov    %rsp,%rbp
+    237e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            ++b_;
+    2382:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2386:	48 8b 00             	mov    (%rax),%rax
+    2389:	48 8d 50 04          	lea    0x4(%rax),%rdx
+    238d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2391:	48 89 10             	mov    %rdx,(%rax)
+        }
+    2394:	90                   	nop
+    2395:	5d                   	pop    %rbp
+    2396:	c3                   	ret
+    2397:	90                   	nop
+
+0000000000002398 <nel::SliceIterator<int>::deref()>:
+
+        OutT deref(void)
+    2398:	55                   	push   %rbp
+    2399:	48 89 e5             	mov    %rsp,%rbp
+    239c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return *b_;
+    23a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23a4:	48 8b 00             	mov    (%rax),%rax
+        }
+    23a7:	5d                   	pop    %rbp
+    23a8:	c3                   	ret
+    23a9:	90                   	nop
+
+00000000000023aa <nel::Manual<int [8]>::Manual()>:
+
+        // create empty container
+        // union should prevent ctor call of T.
+        constexpr Manual() = default;
+    23aa:	55                   	push   %rbp
+    23ab:	48 89 e5             	mov    %rsp,%rbp
+    23ae:	48 83 ec 10          	sub    $0x10,%rsp
+    23b2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    23b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23ba:	48 89 c7             	mov    %rax,%rdi
+    23bd:	e8 b8 04 00 00       	call   287a <nel::Manual<int [8]>::U::U()>
+    23c2:	90                   	nop
+    23c3:	c9                   	leave
+    23c4:	c3                   	ret
+    23c5:	90                   	nop
+
+00000000000023c6 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::SmallVector()>:
+        constexpr SmallVector(void)
+    23c6:	55                   	push   %rbp
+    23c7:	48 89 e5             	mov    %rsp,%rbp
+    23ca:	48 83 ec 10          	sub    $0x10,%rsp
+    23ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : item_(nullptr)
+    23d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23d6:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+            , len_(0)
+    23dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23e1:	48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    23e8:	00 
+    23e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23ed:	48 83 c0 10          	add    $0x10,%rax
+    23f1:	48 89 c7             	mov    %rax,%rdi
+    23f4:	e8 b1 ff ff ff       	call   23aa <nel::Manual<int [8]>::Manual()>
+        }
+    23f9:	90                   	nop
+    23fa:	c9                   	leave
+    23fb:	c3                   	ret
+
+00000000000023fc <nel::Manual<int [8]>::U::~U()>:
+                constexpr ~U() {};
+    23fc:	55                   	push   %rbp
+    23fd:	48 89 e5             	mov    %rsp,%rbp
+    2400:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2404:	90                   	nop
+    2405:	5d                   	pop    %rbp
+    2406:	c3                   	ret
+    2407:	90                   	nop
+
+0000000000002408 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::inline_ptr()>:
+        constexpr Type *inline_ptr(void)
+    2408:	55                   	push   %rbp
+    2409:	48 89 e5             	mov    %rsp,%rbp
+    240c:	48 83 ec 10          	sub    $0x10,%rsp
+    2410:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return elems_.ptr()[0];
+    2414:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2418:	48 83 c0 10          	add    $0x10,%rax
+    241c:	48 89 c7             	mov    %rax,%rdi
+    241f:	e8 62 04 00 00       	call   2886 <nel::Manual<int [8]>::ptr()>
+        }
+    2424:	c9                   	leave
+    2425:	c3                   	ret
+
+0000000000002426 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>:
+        bool try_reserve_for(Count const n)
+    2426:	       55                   	push   %rbp
+    2427:	       48 89 e5             	mov    %rsp,%rbp
+    242a:	       53                   	push   %rbx
+    242b:	       48 83 ec 18          	sub    $0x18,%rsp
+    242f:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2433:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            if (len() + n <= capacity()) { return true; }
+    2437:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    243b:	       48 89 c7             	mov    %rax,%rdi
+    243e:	       e8 51 04 00 00       	call   2894 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    2443:	       48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2447:	       48 8d 1c 10          	lea    (%rax,%rdx,1),%rbx
+    244b:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    244f:	       48 89 c7             	mov    %rax,%rdi
+    2452:	       e8 71 04 00 00       	call   28c8 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    2457:	       48 39 d8             	cmp    %rbx,%rax
+    245a:	       0f 93 c0             	setae  %al
+    245d:	       84 c0                	test   %al,%al
+    245f:	   /-- 74 07                	je     2468 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x42>
+    2461:	   |   b8 01 00 00 00       	mov    $0x1,%eax
+    2466:	/--|-- eb 23                	jmp    248b <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x65>
+            return try_reserve(len() + n);
+    2468:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    246c:	|      48 89 c7             	mov    %rax,%rdi
+    246f:	|      e8 20 04 00 00       	call   2894 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    2474:	|      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2478:	|      48 01 c2             	add    %rax,%rdx
+    247b:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    247f:	|      48 89 d6             	mov    %rdx,%rsi
+    2482:	|      48 89 c7             	mov    %rax,%rdi
+    2485:	|      e8 6e 04 00 00       	call   28f8 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>
+    248a:	|      90                   	nop
+        }
+    248b:	\----> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    248f:	       c9                   	leave
+    2490:	       c3                   	ret
+
+0000000000002491 <int&& nel::move<int>(int&)>:
+constexpr T &&move(T &v)
+    2491:	55                   	push   %rbp
+    2492:	48 89 e5             	mov    %rsp,%rbp
+    2495:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    2499:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    249d:	5d                   	pop    %rbp
+    249e:	c3                   	ret
+
+000000000000249f <nel::Result<void, int>::Err(int&&)>:
+        constexpr static Result Err(E &&v)
+    249f:	55                   	push   %rbp
+    24a0:	48 89 e5             	mov    %rsp,%rbp
+    24a3:	48 83 ec 10          	sub    $0x10,%rsp
+    24a7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    24ab:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<E>(v));
+    24af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    24b3:	48 89 c7             	mov    %rax,%rdi
+    24b6:	e8 36 05 00 00       	call   29f1 <int&& nel::forward<int, int>(int&)>
+    24bb:	48 89 c2             	mov    %rax,%rdx
+    24be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24c2:	48 89 d6             	mov    %rdx,%rsi
+    24c5:	48 89 c7             	mov    %rax,%rdi
+    24c8:	e8 33 05 00 00       	call   2a00 <nel::Result<void, int>::Result(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)2>, int&&)>
+        }
+    24cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24d1:	c9                   	leave
+    24d2:	c3                   	ret
+    24d3:	90                   	nop
+
+00000000000024d4 <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int>(int&&)>:
+        Result<void, T> push_back(Args &&...args)
+    24d4:	       55                   	push   %rbp
+    24d5:	       48 89 e5             	mov    %rsp,%rbp
+    24d8:	       53                   	push   %rbx
+    24d9:	       48 83 ec 28          	sub    $0x28,%rsp
+    24dd:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    24e1:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    24e5:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            if (len() >= capacity()) {
+    24e9:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    24ed:	       48 89 c7             	mov    %rax,%rdi
+    24f0:	       e8 25 03 00 00       	call   281a <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    24f5:	       48 89 c3             	mov    %rax,%rbx
+    24f8:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    24fc:	       48 89 c7             	mov    %rax,%rdi
+    24ff:	       e8 28 03 00 00       	call   282c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    2504:	       48 39 c3             	cmp    %rax,%rbx
+    2507:	       0f 93 c0             	setae  %al
+    250a:	       84 c0                	test   %al,%al
+    250c:	   /-- 74 20                	je     252e <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int>(int&&)+0x5a>
+                return Result<void, Type>::Err(forward<Args>(args)...);
+    250e:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2512:	   |   48 89 c7             	mov    %rax,%rdi
+    2515:	   |   e8 d7 04 00 00       	call   29f1 <int&& nel::forward<int, int>(int&)>
+    251a:	   |   48 89 c2             	mov    %rax,%rdx
+    251d:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2521:	   |   48 89 d6             	mov    %rdx,%rsi
+    2524:	   |   48 89 c7             	mov    %rax,%rdi
+    2527:	   |   e8 73 ff ff ff       	call   249f <nel::Result<void, int>::Err(int&&)>
+    252c:	/--|-- eb 5f                	jmp    258d <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int>(int&&)+0xb9>
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    252e:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2532:	|      48 89 c7             	mov    %rax,%rdi
+    2535:	|      e8 e0 02 00 00       	call   281a <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    253a:	|      48 83 c0 04          	add    $0x4,%rax
+    253e:	|      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2545:	|      00 
+    2546:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    254a:	|      48 01 d0             	add    %rdx,%rax
+    254d:	|      48 89 c6             	mov    %rax,%rsi
+    2550:	|      bf 04 00 00 00       	mov    $0x4,%edi
+    2555:	|      e8 69 ee ff ff       	call   13c3 <operator new(unsigned long, void*)>
+    255a:	|      48 89 c3             	mov    %rax,%rbx
+    255d:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2561:	|      48 89 c7             	mov    %rax,%rdi
+    2564:	|      e8 88 04 00 00       	call   29f1 <int&& nel::forward<int, int>(int&)>
+    2569:	|      8b 00                	mov    (%rax),%eax
+    256b:	|      89 03                	mov    %eax,(%rbx)
+            len_ += 1;
+    256d:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2571:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    2575:	|      48 8d 50 01          	lea    0x1(%rax),%rdx
+    2579:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    257d:	|      48 89 50 08          	mov    %rdx,0x8(%rax)
+            return Result<void, Type>::Ok();
+    2581:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2585:	|      48 89 c7             	mov    %rax,%rdi
+    2588:	|      e8 0a 00 00 00       	call   2597 <nel::Result<void, int>::Ok()>
+        }
+    258d:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2591:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2595:	       c9                   	leave
+    2596:	       c3                   	ret
+
+0000000000002597 <nel::Result<void, int>::Ok()>:
+        constexpr static Result Ok(void)
+    2597:	55                   	push   %rbp
+    2598:	48 89 e5             	mov    %rsp,%rbp
+    259b:	48 83 ec 10          	sub    $0x10,%rsp
+    259f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Result(Phantom<Tag::OK>());
+    25a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25a7:	48 89 c7             	mov    %rax,%rdi
+    25aa:	e8 93 04 00 00       	call   2a42 <nel::Result<void, int>::Result(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)1>)>
+        }
+    25af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25b3:	c9                   	leave
+    25b4:	c3                   	ret
+    25b5:	90                   	nop
+
+00000000000025b6 <nel::Slice<int>::Slice(int*, unsigned long)>:
+        constexpr Slice(Type *const p, Length len)
+    25b6:	55                   	push   %rbp
+    25b7:	48 89 e5             	mov    %rsp,%rbp
+    25ba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    25be:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    25c2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : content_(p)
+    25c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25ca:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    25ce:	48 89 10             	mov    %rdx,(%rax)
+            , len_(len)
+    25d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25d5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    25d9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    25dd:	90                   	nop
+    25de:	5d                   	pop    %rbp
+    25df:	c3                   	ret
+
+00000000000025e0 <nel::heaped::Node<int, nel::heaped::Malloc>::~Node()>:
+        constexpr ~Node(void)
+    25e0:	       55                   	push   %rbp
+    25e1:	       48 89 e5             	mov    %rsp,%rbp
+    25e4:	       48 83 ec 20          	sub    $0x20,%rsp
+    25e8:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            for (Index i = 0; i < len(); ++i) {
+    25ec:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    25f3:	       00 
+    25f4:	   /-- eb 05                	jmp    25fb <nel::heaped::Node<int, nel::heaped::Malloc>::~Node()+0x1b>
+    25f6:	/--|-> 48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    25fb:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25ff:	|      48 89 c7             	mov    %rax,%rdi
+    2602:	|      e8 13 02 00 00       	call   281a <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    2607:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    260b:	|      0f 92 c0             	setb   %al
+    260e:	|      84 c0                	test   %al,%al
+    2610:	\----- 75 e4                	jne    25f6 <nel::heaped::Node<int, nel::heaped::Malloc>::~Node()+0x16>
+        }
+    2612:	       90                   	nop
+    2613:	       90                   	nop
+    2614:	       c9                   	leave
+    2615:	       c3                   	ret
+
+0000000000002616 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>:
+        constexpr Length len(void) const
+    2616:	       55                   	push   %rbp
+    2617:	       48 89 e5             	mov    %rsp,%rbp
+    261a:	       48 83 ec 10          	sub    $0x10,%rsp
+    261e:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->len();
+    2622:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2626:	       48 8b 00             	mov    (%rax),%rax
+    2629:	       48 85 c0             	test   %rax,%rax
+    262c:	/----- 74 11                	je     263f <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x29>
+    262e:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2632:	|      48 8b 00             	mov    (%rax),%rax
+    2635:	|      48 89 c7             	mov    %rax,%rdi
+    2638:	|      e8 dd 01 00 00       	call   281a <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    263d:	|  /-- eb 05                	jmp    2644 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x2e>
+    263f:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    2644:	   \-> c9                   	leave
+    2645:	       c3                   	ret
+
+0000000000002646 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>:
+        constexpr Count capacity(void) const
+    2646:	       55                   	push   %rbp
+    2647:	       48 89 e5             	mov    %rsp,%rbp
+    264a:	       48 83 ec 10          	sub    $0x10,%rsp
+    264e:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->capacity();
+    2652:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2656:	       48 8b 00             	mov    (%rax),%rax
+    2659:	       48 85 c0             	test   %rax,%rax
+    265c:	/----- 74 11                	je     266f <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x29>
+    265e:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2662:	|      48 8b 00             	mov    (%rax),%rax
+    2665:	|      48 89 c7             	mov    %rax,%rdi
+    2668:	|      e8 bf 01 00 00       	call   282c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    266d:	|  /-- eb 05                	jmp    2674 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x2e>
+    266f:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    2674:	   \-> c9                   	leave
+    2675:	       c3                   	ret
+
+0000000000002676 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>:
+        bool try_reserve(Count new_cap)
+    2676:	             55                   	push   %rbp
+    2677:	             48 89 e5             	mov    %rsp,%rbp
+    267a:	             48 83 ec 20          	sub    $0x20,%rsp
+    267e:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2682:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            new_cap = Growth::capacity_for(capacity(), new_cap);
+    2686:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    268a:	             48 89 c7             	mov    %rax,%rdi
+    268d:	             e8 b4 ff ff ff       	call   2646 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    2692:	             48 89 c2             	mov    %rax,%rdx
+    2695:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2699:	             48 89 c6             	mov    %rax,%rsi
+    269c:	             48 89 d7             	mov    %rdx,%rdi
+    269f:	             e8 b3 03 00 00       	call   2a57 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>
+    26a4:	             48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (new_cap < len()) { new_cap = len(); }
+    26a8:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26ac:	             48 89 c7             	mov    %rax,%rdi
+    26af:	             e8 62 ff ff ff       	call   2616 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    26b4:	             48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    26b8:	             0f 92 c0             	setb   %al
+    26bb:	             84 c0                	test   %al,%al
+    26bd:	         /-- 74 10                	je     26cf <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x59>
+    26bf:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26c3:	         |   48 89 c7             	mov    %rax,%rdi
+    26c6:	         |   e8 4b ff ff ff       	call   2616 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    26cb:	         |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (item_ == nullptr) {
+    26cf:	         \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26d3:	             48 8b 00             	mov    (%rax),%rax
+    26d6:	             48 85 c0             	test   %rax,%rax
+    26d9:	         /-- 75 2d                	jne    2708 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x92>
+                item_ = VectorNode::malloc(new_cap);
+    26db:	         |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    26df:	         |   48 89 c7             	mov    %rax,%rdi
+    26e2:	         |   e8 bc 03 00 00       	call   2aa3 <nel::heaped::Node<int, nel::heaped::Malloc>::malloc(unsigned long)>
+    26e7:	         |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    26eb:	         |   48 89 02             	mov    %rax,(%rdx)
+                if (item_ == nullptr) { return false; }
+    26ee:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26f2:	         |   48 8b 00             	mov    (%rax),%rax
+    26f5:	         |   48 85 c0             	test   %rax,%rax
+    26f8:	/--------|-- 0f 85 c4 00 00 00    	jne    27c2 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+    26fe:	|        |   b8 00 00 00 00       	mov    $0x0,%eax
+    2703:	|  /-----|-- e9 bf 00 00 00       	jmp    27c7 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+            } else if (new_cap == item_->capacity()) {
+    2708:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    270c:	|  |         48 8b 00             	mov    (%rax),%rax
+    270f:	|  |         48 89 c7             	mov    %rax,%rdi
+    2712:	|  |         e8 15 01 00 00       	call   282c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    2717:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    271b:	|  |         0f 94 c0             	sete   %al
+    271e:	|  |         84 c0                	test   %al,%al
+    2720:	+--|-------- 0f 85 9c 00 00 00    	jne    27c2 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap > item_->capacity()) {
+    2726:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    272a:	|  |         48 8b 00             	mov    (%rax),%rax
+    272d:	|  |         48 89 c7             	mov    %rax,%rdi
+    2730:	|  |         e8 f7 00 00 00       	call   282c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    2735:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    2739:	|  |         0f 92 c0             	setb   %al
+    273c:	|  |         84 c0                	test   %al,%al
+    273e:	|  |  /----- 74 35                	je     2775 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xff>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    2740:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2744:	|  |  |      48 8b 00             	mov    (%rax),%rax
+    2747:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    274b:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    274e:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2751:	|  |  |      e8 81 04 00 00       	call   2bd7 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    2756:	|  |  |      48 89 45 f0          	mov    %rax,-0x10(%rbp)
+                if (p == nullptr) { return false; }
+    275a:	|  |  |      48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    275f:	|  |  |  /-- 75 07                	jne    2768 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xf2>
+    2761:	|  |  |  |   b8 00 00 00 00       	mov    $0x0,%eax
+    2766:	|  +--|--|-- eb 5f                	jmp    27c7 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    2768:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    276c:	|  |  |      48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2770:	|  |  |      48 89 10             	mov    %rdx,(%rax)
+    2773:	+--|--|----- eb 4d                	jmp    27c2 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap < item_->capacity()) {
+    2775:	|  |  \----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2779:	|  |         48 8b 00             	mov    (%rax),%rax
+    277c:	|  |         48 89 c7             	mov    %rax,%rdi
+    277f:	|  |         e8 a8 00 00 00       	call   282c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    2784:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    2788:	|  |         0f 92 c0             	setb   %al
+    278b:	|  |         84 c0                	test   %al,%al
+    278d:	+--|-------- 74 33                	je     27c2 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    278f:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2793:	|  |         48 8b 00             	mov    (%rax),%rax
+    2796:	|  |         48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    279a:	|  |         48 89 d6             	mov    %rdx,%rsi
+    279d:	|  |         48 89 c7             	mov    %rax,%rdi
+    27a0:	|  |         e8 32 04 00 00       	call   2bd7 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    27a5:	|  |         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                if (p == nullptr) { return false; }
+    27a9:	|  |         48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    27ae:	|  |     /-- 75 07                	jne    27b7 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x141>
+    27b0:	|  |     |   b8 00 00 00 00       	mov    $0x0,%eax
+    27b5:	|  +-----|-- eb 10                	jmp    27c7 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    27b7:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27bb:	|  |         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    27bf:	|  |         48 89 10             	mov    %rdx,(%rax)
+            return true;
+    27c2:	\--|-------> b8 01 00 00 00       	mov    $0x1,%eax
+        }
+    27c7:	   \-------> c9                   	leave
+    27c8:	             c3                   	ret
+
+00000000000027c9 <int& nel::forward<int&, int>(int&)>:
+constexpr U &&forward(T &t)
+    27c9:	55                   	push   %rbp
+    27ca:	48 89 e5             	mov    %rsp,%rbp
+    27cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    27d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    27d5:	5d                   	pop    %rbp
+    27d6:	c3                   	ret
+    27d7:	90                   	nop
+
+00000000000027d8 <nel::Result<void, int>::Result<int&>(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)2>, int&)>:
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+    27d8:	55                   	push   %rbp
+    27d9:	48 89 e5             	mov    %rsp,%rbp
+    27dc:	53                   	push   %rbx
+    27dd:	48 83 ec 18          	sub    $0x18,%rsp
+    27e1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    27e5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    27e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27ed:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<Args>(args)...)
+    27f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27f7:	48 8d 58 04          	lea    0x4(%rax),%rbx
+    27fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    27ff:	48 89 c7             	mov    %rax,%rdi
+    2802:	e8 c2 ff ff ff       	call   27c9 <int& nel::forward<int&, int>(int&)>
+    2807:	48 89 c6             	mov    %rax,%rsi
+    280a:	48 89 df             	mov    %rbx,%rdi
+    280d:	e8 1c 05 00 00       	call   2d2e <nel::Element<int>::Element<int&>(int&)>
+        }
+    2812:	90                   	nop
+    2813:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2817:	c9                   	leave
+    2818:	c3                   	ret
+    2819:	90                   	nop
+
+000000000000281a <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>:
+        constexpr Length len(void) const
+    281a:	55                   	push   %rbp
+    281b:	48 89 e5             	mov    %rsp,%rbp
+    281e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    2822:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2826:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    282a:	5d                   	pop    %rbp
+    282b:	c3                   	ret
+
+000000000000282c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>:
+        constexpr Count capacity(void) const
+    282c:	55                   	push   %rbp
+    282d:	48 89 e5             	mov    %rsp,%rbp
+    2830:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return alloc_;
+    2834:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2838:	48 8b 00             	mov    (%rax),%rax
+        }
+    283b:	5d                   	pop    %rbp
+    283c:	c3                   	ret
+    283d:	90                   	nop
+
+000000000000283e <nel::Element<int>::operator*() const>:
+        constexpr Type &ref(void)
+        {
+            return value_;
+        }
+
+        constexpr Type const &operator*(void) const
+    283e:	55                   	push   %rbp
+    283f:	48 89 e5             	mov    %rsp,%rbp
+    2842:	48 83 ec 10          	sub    $0x10,%rsp
+    2846:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    284a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    284e:	48 89 c7             	mov    %rax,%rdi
+    2851:	e8 00 05 00 00       	call   2d56 <nel::Element<int>::ref() const>
+        }
+    2856:	c9                   	leave
+    2857:	c3                   	ret
+
+0000000000002858 <nel::Slice<int>::Slice()>:
+        constexpr Slice(void)
+    2858:	55                   	push   %rbp
+    2859:	48 89 e5             	mov    %rsp,%rbp
+    285c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : content_(nullptr)
+    2860:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2864:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+            , len_(0)
+    286b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    286f:	48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    2876:	00 
+        }
+    2877:	90                   	nop
+    2878:	5d                   	pop    %rbp
+    2879:	c3                   	ret
+
+000000000000287a <nel::Manual<int [8]>::U::U()>:
+                constexpr U() {};
+    287a:	55                   	push   %rbp
+    287b:	48 89 e5             	mov    %rsp,%rbp
+    287e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2882:	90                   	nop
+    2883:	5d                   	pop    %rbp
+    2884:	c3                   	ret
+    2885:	90                   	nop
+
+0000000000002886 <nel::Manual<int [8]>::ptr()>:
+
+        // private:
+    public:
+        // only if you know there's a value there..
+        // TODO: must have no bare pointers.. safety feature.
+        constexpr Type *ptr()
+    2886:	55                   	push   %rbp
+    2887:	48 89 e5             	mov    %rsp,%rbp
+    288a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return &u_.elem_;
+    288e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2892:	5d                   	pop    %rbp
+    2893:	c3                   	ret
+
+0000000000002894 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>:
+        constexpr Length len(void) const
+    2894:	       55                   	push   %rbp
+    2895:	       48 89 e5             	mov    %rsp,%rbp
+    2898:	       48 83 ec 10          	sub    $0x10,%rsp
+    289c:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? len_ : item_->len();
+    28a0:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28a4:	       48 8b 00             	mov    (%rax),%rax
+    28a7:	       48 85 c0             	test   %rax,%rax
+    28aa:	   /-- 75 0a                	jne    28b6 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x22>
+    28ac:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28b0:	   |   48 8b 40 08          	mov    0x8(%rax),%rax
+    28b4:	/--|-- eb 0f                	jmp    28c5 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x31>
+    28b6:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28ba:	|      48 8b 00             	mov    (%rax),%rax
+    28bd:	|      48 89 c7             	mov    %rax,%rdi
+    28c0:	|      e8 55 ff ff ff       	call   281a <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+        }
+    28c5:	\----> c9                   	leave
+    28c6:	       c3                   	ret
+    28c7:	       90                   	nop
+
+00000000000028c8 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>:
+        constexpr Count capacity(void) const
+    28c8:	       55                   	push   %rbp
+    28c9:	       48 89 e5             	mov    %rsp,%rbp
+    28cc:	       48 83 ec 10          	sub    $0x10,%rsp
+    28d0:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? N : item_->capacity();
+    28d4:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28d8:	       48 8b 00             	mov    (%rax),%rax
+    28db:	       48 85 c0             	test   %rax,%rax
+    28de:	/----- 74 11                	je     28f1 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x29>
+    28e0:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28e4:	|      48 8b 00             	mov    (%rax),%rax
+    28e7:	|      48 89 c7             	mov    %rax,%rdi
+    28ea:	|      e8 3d ff ff ff       	call   282c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    28ef:	|  /-- eb 05                	jmp    28f6 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x2e>
+    28f1:	\--|-> b8 08 00 00 00       	mov    $0x8,%eax
+        }
+    28f6:	   \-> c9                   	leave
+    28f7:	       c3                   	ret
+
+00000000000028f8 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>:
+        bool try_reserve(Count new_cap)
+    28f8:	          55                   	push   %rbp
+    28f9:	          48 89 e5             	mov    %rsp,%rbp
+    28fc:	          48 83 ec 20          	sub    $0x20,%rsp
+    2900:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2904:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            if (item_ == nullptr) {
+    2908:	          48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    290c:	          48 8b 00             	mov    (%rax),%rax
+    290f:	          48 85 c0             	test   %rax,%rax
+    2912:	   /----- 75 39                	jne    294d <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x55>
+                if (new_cap <= N) { return true; }
+    2914:	   |      48 83 7d e0 08       	cmpq   $0x8,-0x20(%rbp)
+    2919:	   |  /-- 77 0a                	ja     2925 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x2d>
+    291b:	   |  |   b8 01 00 00 00       	mov    $0x1,%eax
+    2920:	/--|--|-- e9 ca 00 00 00       	jmp    29ef <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xf7>
+                return spill(Growth::capacity_for(N, new_cap));
+    2925:	|  |  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2929:	|  |      48 89 c6             	mov    %rax,%rsi
+    292c:	|  |      bf 08 00 00 00       	mov    $0x8,%edi
+    2931:	|  |      e8 21 01 00 00       	call   2a57 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>
+    2936:	|  |      48 89 c2             	mov    %rax,%rdx
+    2939:	|  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    293d:	|  |      48 89 d6             	mov    %rdx,%rsi
+    2940:	|  |      48 89 c7             	mov    %rax,%rdi
+    2943:	|  |      e8 1c 04 00 00       	call   2d64 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::spill(unsigned long)>
+    2948:	+--|----- e9 a2 00 00 00       	jmp    29ef <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xf7>
+            new_cap = Growth::capacity_for(capacity(), new_cap);
+    294d:	|  \----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2951:	|         48 89 c7             	mov    %rax,%rdi
+    2954:	|         e8 6f ff ff ff       	call   28c8 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    2959:	|         48 89 c2             	mov    %rax,%rdx
+    295c:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2960:	|         48 89 c6             	mov    %rax,%rsi
+    2963:	|         48 89 d7             	mov    %rdx,%rdi
+    2966:	|         e8 ec 00 00 00       	call   2a57 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>
+    296b:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (new_cap < len()) { new_cap = len(); }
+    296f:	|         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2973:	|         48 89 c7             	mov    %rax,%rdi
+    2976:	|         e8 19 ff ff ff       	call   2894 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    297b:	|         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    297f:	|         0f 92 c0             	setb   %al
+    2982:	|         84 c0                	test   %al,%al
+    2984:	|     /-- 74 10                	je     2996 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x9e>
+    2986:	|     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    298a:	|     |   48 89 c7             	mov    %rax,%rdi
+    298d:	|     |   e8 02 ff ff ff       	call   2894 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    2992:	|     |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (new_cap == item_->capacity()) { return true; }
+    2996:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    299a:	|         48 8b 00             	mov    (%rax),%rax
+    299d:	|         48 89 c7             	mov    %rax,%rdi
+    29a0:	|         e8 87 fe ff ff       	call   282c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    29a5:	|         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    29a9:	|         0f 94 c0             	sete   %al
+    29ac:	|         84 c0                	test   %al,%al
+    29ae:	|     /-- 74 07                	je     29b7 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xbf>
+    29b0:	|     |   b8 01 00 00 00       	mov    $0x1,%eax
+    29b5:	+-----|-- eb 38                	jmp    29ef <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xf7>
+            VectorNode *p = VectorNode::realloc(item_, new_cap);
+    29b7:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    29bb:	|         48 8b 00             	mov    (%rax),%rax
+    29be:	|         48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    29c2:	|         48 89 d6             	mov    %rdx,%rsi
+    29c5:	|         48 89 c7             	mov    %rax,%rdi
+    29c8:	|         e8 0a 02 00 00       	call   2bd7 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    29cd:	|         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            if (p == nullptr) { return false; }
+    29d1:	|         48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    29d6:	|     /-- 75 07                	jne    29df <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xe7>
+    29d8:	|     |   b8 00 00 00 00       	mov    $0x0,%eax
+    29dd:	+-----|-- eb 10                	jmp    29ef <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xf7>
+            item_ = p;
+    29df:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    29e3:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    29e7:	|         48 89 10             	mov    %rdx,(%rax)
+            return true;
+    29ea:	|         b8 01 00 00 00       	mov    $0x1,%eax
+        }
+    29ef:	\-------> c9                   	leave
+    29f0:	          c3                   	ret
+
+00000000000029f1 <int&& nel::forward<int, int>(int&)>:
+constexpr U &&forward(T &t)
+    29f1:	55                   	push   %rbp
+    29f2:	48 89 e5             	mov    %rsp,%rbp
+    29f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    29f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    29fd:	5d                   	pop    %rbp
+    29fe:	c3                   	ret
+    29ff:	90                   	nop
+
+0000000000002a00 <nel::Result<void, int>::Result(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)2>, int&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    2a00:	55                   	push   %rbp
+    2a01:	48 89 e5             	mov    %rsp,%rbp
+    2a04:	53                   	push   %rbx
+    2a05:	48 83 ec 18          	sub    $0x18,%rsp
+    2a09:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2a0d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    2a11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a15:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    2a1b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a1f:	48 8d 58 04          	lea    0x4(%rax),%rbx
+    2a23:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a27:	48 89 c7             	mov    %rax,%rdi
+    2a2a:	e8 c2 ff ff ff       	call   29f1 <int&& nel::forward<int, int>(int&)>
+    2a2f:	48 89 c6             	mov    %rax,%rsi
+    2a32:	48 89 df             	mov    %rbx,%rdi
+    2a35:	e8 a6 03 00 00       	call   2de0 <nel::Element<int>::Element(int&&)>
+        }
+    2a3a:	90                   	nop
+    2a3b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2a3f:	c9                   	leave
+    2a40:	c3                   	ret
+    2a41:	90                   	nop
+
+0000000000002a42 <nel::Result<void, int>::Result(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)1>)>:
+        constexpr Result(Phantom<Tag::OK> const)
+    2a42:	55                   	push   %rbp
+    2a43:	48 89 e5             	mov    %rsp,%rbp
+    2a46:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : tag_(Tag::OK)
+    2a4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a4e:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+        }
+    2a54:	90                   	nop
+    2a55:	5d                   	pop    %rbp
+    2a56:	c3                   	ret
+
+0000000000002a57 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>:
+
+    public:
+        // Smallest non-zero capacity grown to, saves the first few tiny reallocs.
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+    2a57:	          55                   	push   %rbp
+    2a58:	          48 89 e5             	mov    %rsp,%rbp
+    2a5b:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2a5f:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            if (cap <= cur) { return cap; }
+    2a63:	          48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a67:	          48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    2a6b:	      /-- 72 06                	jb     2a73 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x1c>
+    2a6d:	      |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a71:	/-----|-- eb 2e                	jmp    2aa1 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x4a>
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    2a73:	|     \-> 48 83 7d e8 03       	cmpq   $0x3,-0x18(%rbp)
+    2a78:	|  /----- 76 09                	jbe    2a83 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x2c>
+    2a7a:	|  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a7e:	|  |      48 01 c0             	add    %rax,%rax
+    2a81:	|  |  /-- eb 05                	jmp    2a88 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x31>
+    2a83:	|  \--|-> b8 04 00 00 00       	mov    $0x4,%eax
+    2a88:	|     \-> 48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return (cap < g) ? g : cap;
+    2a8c:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a90:	|         48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    2a94:	|  /----- 73 06                	jae    2a9c <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x45>
+    2a96:	|  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a9a:	|  |  /-- eb 04                	jmp    2aa0 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x49>
+    2a9c:	|  \--|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2aa0:	|     \-> 90                   	nop
+        }
+    2aa1:	\-------> 5d                   	pop    %rbp
+    2aa2:	          c3                   	ret
+
+0000000000002aa3 <nel::heaped::Node<int, nel::heaped::Malloc>::malloc(unsigned long)>:
+        static Node *malloc(Count capacity)
+    2aa3:	    55                   	push   %rbp
+    2aa4:	    48 89 e5             	mov    %rsp,%rbp
+    2aa7:	    48 83 ec 20          	sub    $0x20,%rsp
+    2aab:	    48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            Node *new_n = realloc(nullptr, capacity);
+    2aaf:	    48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ab3:	    48 89 c6             	mov    %rax,%rsi
+    2ab6:	    bf 00 00 00 00       	mov    $0x0,%edi
+    2abb:	    e8 17 01 00 00       	call   2bd7 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    2ac0:	    48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    2ac4:	    48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2ac9:	/-- 74 0c                	je     2ad7 <nel::heaped::Node<int, nel::heaped::Malloc>::malloc(unsigned long)+0x34>
+    2acb:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2acf:	|   48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    2ad6:	|   00 
+            return new_n;
+    2ad7:	\-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2adb:	    c9                   	leave
+    2adc:	    c3                   	ret
+    2add:	    90                   	nop
+
+0000000000002ade <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>:
+            return match<bool>([](T const &) -> bool { return false; },
+    2ade:	55                   	push   %rbp
+    2adf:	48 89 e5             	mov    %rsp,%rbp
+    2ae2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2ae6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2aea:	b8 00 00 00 00       	mov    $0x0,%eax
+    2aef:	5d                   	pop    %rbp
+    2af0:	c3                   	ret
+    2af1:	90                   	nop
+
+0000000000002af2 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>:
+                               [](E const &) -> bool { return true; },
+    2af2:	55                   	push   %rbp
+    2af3:	48 89 e5             	mov    %rsp,%rbp
+    2af6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2afa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2afe:	b8 01 00 00 00       	mov    $0x1,%eax
+    2b03:	5d                   	pop    %rbp
+    2b04:	c3                   	ret
+    2b05:	90                   	nop
+
+0000000000002b06 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>:
+        constexpr bool is_err(Context const &ctx = Context()) const
+    2b06:	55                   	push   %rbp
+    2b07:	48 89 e5             	mov    %rsp,%rbp
+    2b0a:	48 83 ec 20          	sub    $0x20,%rsp
+    2b0e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2b12:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](T const &) -> bool { return false; },
+    2b16:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2b1a:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    2b1e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    2b22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b26:	48 89 c7             	mov    %rax,%rdi
+    2b29:	e8 02 00 00 00       	call   2b30 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>
+        }
+    2b2e:	c9                   	leave
+    2b2f:	c3                   	ret
+
+0000000000002b30 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    2b30:	             55                   	push   %rbp
+    2b31:	             48 89 e5             	mov    %rsp,%rbp
+    2b34:	             48 83 ec 20          	sub    $0x20,%rsp
+    2b38:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2b3c:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2b40:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2b44:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result-match
+    2b48:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b4c:	             8b 00                	mov    (%rax),%eax
+    2b4e:	             83 f8 02             	cmp    $0x2,%eax
+    2b51:	         /-- 74 32                	je     2b85 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x55>
+    2b53:	         |   83 f8 02             	cmp    $0x2,%eax
+    2b56:	/--------|-- 7f 67                	jg     2bbf <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+    2b58:	|        |   85 c0                	test   %eax,%eax
+    2b5a:	|     /--|-- 74 4d                	je     2ba9 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x79>
+    2b5c:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    2b5f:	+-----|--|-- 75 5e                	jne    2bbf <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_ok(*ok_);
+    2b61:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b65:	|     |  |   48 83 c0 08          	add    $0x8,%rax
+    2b69:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    2b6c:	|     |  |   e8 97 02 00 00       	call   2e08 <nel::Element<void*>::operator*() const>
+    2b71:	|     |  |   48 89 c2             	mov    %rax,%rdx
+    2b74:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b78:	|     |  |   48 89 d6             	mov    %rdx,%rsi
+    2b7b:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    2b7e:	|     |  |   e8 5b ff ff ff       	call   2ade <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>
+    2b83:	|  /--|--|-- eb 50                	jmp    2bd5 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    return on_err(*err_);
+    2b85:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b89:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    2b8d:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2b90:	|  |  |      e8 8d 02 00 00       	call   2e22 <nel::Element<nel::heaped::AllocError>::operator*() const>
+    2b95:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    2b98:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b9c:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    2b9f:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2ba2:	|  |  |      e8 4b ff ff ff       	call   2af2 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>
+    2ba7:	|  +--|----- eb 2c                	jmp    2bd5 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    nel::panic("invalid Result", ctx);
+    2ba9:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2bad:	|  |         48 89 c6             	mov    %rax,%rsi
+    2bb0:	|  |         48 8d 05 2b 15 00 00 	lea    0x152b(%rip),%rax        # 40e2 <n_values+0xaa>
+    2bb7:	|  |         48 89 c7             	mov    %rax,%rdi
+    2bba:	|  |         e8 96 05 00 00       	call   3155 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    2bbf:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2bc3:	   |         48 89 c6             	mov    %rax,%rsi
+    2bc6:	   |         48 8d 05 d3 14 00 00 	lea    0x14d3(%rip),%rax        # 40a0 <n_values+0x68>
+    2bcd:	   |         48 89 c7             	mov    %rax,%rdi
+    2bd0:	   |         e8 80 05 00 00       	call   3155 <nel::panic(char const*, nel::Context const&)>
+        }
+    2bd5:	   \-------> c9                   	leave
+    2bd6:	             c3                   	ret
+
+0000000000002bd7 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>:
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    2bd7:	          55                   	push   %rbp
+    2bd8:	          48 89 e5             	mov    %rsp,%rbp
+    2bdb:	          41 54                	push   %r12
+    2bdd:	          53                   	push   %rbx
+    2bde:	          48 83 ec 70          	sub    $0x70,%rsp
+    2be2:	          48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+    2be6:	          48 89 75 80          	mov    %rsi,-0x80(%rbp)
+            if (new_cap > max_capacity) { return nullptr; }
+    2bea:	          48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    2bf1:	          ff ff 1f 
+    2bf4:	          48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    2bf8:	      /-- 73 0a                	jae    2c04 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x2d>
+    2bfa:	      |   bb 00 00 00 00       	mov    $0x0,%ebx
+    2bff:	/-----|-- e9 1d 01 00 00       	jmp    2d21 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x14a>
+            Length const new_sz = size_of(new_cap);
+    2c04:	|     \-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    2c08:	|         48 89 c7             	mov    %rax,%rdi
+    2c0b:	|         e8 24 f4 ff ff       	call   2034 <nel::heaped::Node<int, nel::heaped::Malloc>::size_of(unsigned long)>
+    2c10:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            Length const old_sz = (old_n == nullptr) ? 0 : size_of(old_n->alloc_);
+    2c14:	|         48 83 7d 88 00       	cmpq   $0x0,-0x78(%rbp)
+    2c19:	|  /----- 74 11                	je     2c2c <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x55>
+    2c1b:	|  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    2c1f:	|  |      48 8b 00             	mov    (%rax),%rax
+    2c22:	|  |      48 89 c7             	mov    %rax,%rdi
+    2c25:	|  |      e8 0a f4 ff ff       	call   2034 <nel::heaped::Node<int, nel::heaped::Malloc>::size_of(unsigned long)>
+    2c2a:	|  |  /-- eb 05                	jmp    2c31 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x5a>
+    2c2c:	|  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    2c31:	|     \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+                auto r = Allocator::try_realloc(old_n, alignof(Node), old_sz, new_sz);
+    2c35:	|         48 8d 45 90          	lea    -0x70(%rbp),%rax
+    2c39:	|         48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2c3d:	|         48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2c41:	|         48 8b 75 88          	mov    -0x78(%rbp),%rsi
+    2c45:	|         49 89 c8             	mov    %rcx,%r8
+    2c48:	|         48 89 d1             	mov    %rdx,%rcx
+    2c4b:	|         ba 08 00 00 00       	mov    $0x8,%edx
+    2c50:	|         48 89 c7             	mov    %rax,%rdi
+    2c53:	|         e8 eb e7 ff ff       	call   1443 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>
+                if (r.is_err()) { return nullptr; }
+    2c58:	|         48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    2c5c:	|         b9 89 00 00 00       	mov    $0x89,%ecx
+    2c61:	|         48 8d 15 89 14 00 00 	lea    0x1489(%rip),%rdx        # 40f1 <n_values+0xb9>
+    2c68:	|         48 8d 35 99 14 00 00 	lea    0x1499(%rip),%rsi        # 4108 <n_values+0xd0>
+    2c6f:	|         48 89 c7             	mov    %rax,%rdi
+    2c72:	|         e8 5f e7 ff ff       	call   13d6 <nel::Context::Context(char const*, char const*, int)>
+    2c77:	|         48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    2c7b:	|         48 8d 45 90          	lea    -0x70(%rbp),%rax
+    2c7f:	|         48 89 d6             	mov    %rdx,%rsi
+    2c82:	|         48 89 c7             	mov    %rax,%rdi
+    2c85:	|         e8 7c fe ff ff       	call   2b06 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>
+    2c8a:	|         84 c0                	test   %al,%al
+    2c8c:	|     /-- 74 0d                	je     2c9b <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0xc4>
+    2c8e:	|     |   bb 00 00 00 00       	mov    $0x0,%ebx
+    2c93:	|     |   41 bc 00 00 00 00    	mov    $0x0,%r12d
+    2c99:	|  /--|-- eb 3c                	jmp    2cd7 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x100>
+                new_n = reinterpret_cast<Node *>(r.unwrap());
+    2c9b:	|  |  \-> 48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2c9f:	|  |      b9 8a 00 00 00       	mov    $0x8a,%ecx
+    2ca4:	|  |      48 8d 15 46 14 00 00 	lea    0x1446(%rip),%rdx        # 40f1 <n_values+0xb9>
+    2cab:	|  |      48 8d 35 56 14 00 00 	lea    0x1456(%rip),%rsi        # 4108 <n_values+0xd0>
+    2cb2:	|  |      48 89 c7             	mov    %rax,%rdi
+    2cb5:	|  |      e8 1c e7 ff ff       	call   13d6 <nel::Context::Context(char const*, char const*, int)>
+    2cba:	|  |      48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    2cbe:	|  |      48 8d 45 90          	lea    -0x70(%rbp),%rax
+    2cc2:	|  |      48 89 d6             	mov    %rdx,%rsi
+    2cc5:	|  |      48 89 c7             	mov    %rax,%rdi
+    2cc8:	|  |      e8 bb 01 00 00       	call   2e88 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+    2ccd:	|  |      48 89 45 e8          	mov    %rax,-0x18(%rbp)
+            } else {
+    2cd1:	|  |      41 bc 01 00 00 00    	mov    $0x1,%r12d
+    2cd7:	|  \----> 48 8d 45 90          	lea    -0x70(%rbp),%rax
+    2cdb:	|         48 89 c7             	mov    %rax,%rdi
+    2cde:	|         e8 83 e8 ff ff       	call   1566 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+    2ce3:	|         41 83 fc 01          	cmp    $0x1,%r12d
+    2ce7:	+-------- 75 38                	jne    2d21 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x14a>
+    2ce9:	|         90                   	nop
+                if (new_sz > old_sz) {
+    2cea:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2cee:	|         48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    2cf2:	|     /-- 73 1e                	jae    2d12 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x13b>
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+    2cf4:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2cf8:	|     |   48 2b 45 d8          	sub    -0x28(%rbp),%rax
+    2cfc:	|     |   48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    2d00:	|     |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2d04:	|     |   48 01 ca             	add    %rcx,%rdx
+    2d07:	|     |   48 89 c6             	mov    %rax,%rsi
+    2d0a:	|     |   48 89 d7             	mov    %rdx,%rdi
+    2d0d:	|     |   e8 c4 05 00 00       	call   32d6 <nel::elem::wipe(unsigned char*, unsigned long)>
+            new_n->alloc_ = new_cap;
+    2d12:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d16:	|         48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    2d1a:	|         48 89 10             	mov    %rdx,(%rax)
+            return new_n;
+    2d1d:	|         48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+        }
+    2d21:	\-------> 48 89 d8             	mov    %rbx,%rax
+    2d24:	          48 83 c4 70          	add    $0x70,%rsp
+    2d28:	          5b                   	pop    %rbx
+    2d29:	          41 5c                	pop    %r12
+    2d2b:	          5d                   	pop    %rbp
+    2d2c:	          c3                   	ret
+    2d2d:	          90                   	nop
+
+0000000000002d2e <nel::Element<int>::Element<int&>(int&)>:
+        constexpr Element(Args &&...args)
+    2d2e:	55                   	push   %rbp
+    2d2f:	48 89 e5             	mov    %rsp,%rbp
+    2d32:	48 83 ec 10          	sub    $0x10,%rsp
+    2d36:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2d3a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Args>(args)...)
+    2d3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2d42:	48 89 c7             	mov    %rax,%rdi
+    2d45:	e8 7f fa ff ff       	call   27c9 <int& nel::forward<int&, int>(int&)>
+    2d4a:	8b 10                	mov    (%rax),%edx
+    2d4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d50:	89 10                	mov    %edx,(%rax)
+        }
+    2d52:	90                   	nop
+    2d53:	c9                   	leave
+    2d54:	c3                   	ret
+    2d55:	90                   	nop
+
+0000000000002d56 <nel::Element<int>::ref() const>:
+        constexpr Type const &ref(void) const
+    2d56:	55                   	push   %rbp
+    2d57:	48 89 e5             	mov    %rsp,%rbp
+    2d5a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2d5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2d62:	5d                   	pop    %rbp
+    2d63:	c3                   	ret
+
+0000000000002d64 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::spill(unsigned long)>:
+        bool spill(Count const cap)
+    2d64:	       55                   	push   %rbp
+    2d65:	       48 89 e5             	mov    %rsp,%rbp
+    2d68:	       41 54                	push   %r12
+    2d6a:	       53                   	push   %rbx
+    2d6b:	       48 83 ec 20          	sub    $0x20,%rsp
+    2d6f:	       48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    2d73:	       48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+            VectorNode *n = VectorNode::malloc(cap);
+    2d77:	       48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2d7b:	       48 89 c7             	mov    %rax,%rdi
+    2d7e:	       e8 20 fd ff ff       	call   2aa3 <nel::heaped::Node<int, nel::heaped::Malloc>::malloc(unsigned long)>
+    2d83:	       48 89 45 e8          	mov    %rax,-0x18(%rbp)
+            if (n == nullptr) { return false; }
+    2d87:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    2d8c:	   /-- 75 07                	jne    2d95 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::spill(unsigned long)+0x31>
+    2d8e:	   |   b8 00 00 00 00       	mov    $0x0,%eax
+    2d93:	/--|-- eb 42                	jmp    2dd7 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::spill(unsigned long)+0x73>
+            n->push_back_relocated(inline_ptr(), len_);
+    2d95:	|  \-> 48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    2d99:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2d9d:	|      4c 8b 60 08          	mov    0x8(%rax),%r12
+    2da1:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2da5:	|      48 89 c7             	mov    %rax,%rdi
+    2da8:	|      e8 5b f6 ff ff       	call   2408 <nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::inline_ptr()>
+    2dad:	|      4c 89 e2             	mov    %r12,%rdx
+    2db0:	|      48 89 c6             	mov    %rax,%rsi
+    2db3:	|      48 89 df             	mov    %rbx,%rdi
+    2db6:	|      e8 ff 00 00 00       	call   2eba <nel::heaped::Node<int, nel::heaped::Malloc>::push_back_relocated(int*, unsigned long)>
+            len_ = 0;
+    2dbb:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2dbf:	|      48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    2dc6:	|      00 
+            item_ = n;
+    2dc7:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2dcb:	|      48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2dcf:	|      48 89 10             	mov    %rdx,(%rax)
+            return true;
+    2dd2:	|      b8 01 00 00 00       	mov    $0x1,%eax
+        }
+    2dd7:	\----> 48 83 c4 20          	add    $0x20,%rsp
+    2ddb:	       5b                   	pop    %rbx
+    2ddc:	       41 5c                	pop    %r12
+    2dde:	       5d                   	pop    %rbp
+    2ddf:	       c3                   	ret
+
+0000000000002de0 <nel::Element<int>::Element(int&&)>:
+        constexpr Element(Type &&val)
+    2de0:	55                   	push   %rbp
+    2de1:	48 89 e5             	mov    %rsp,%rbp
+    2de4:	48 83 ec 10          	sub    $0x10,%rsp
+    2de8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2dec:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    2df0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2df4:	48 89 c7             	mov    %rax,%rdi
+    2df7:	e8 f5 fb ff ff       	call   29f1 <int&& nel::forward<int, int>(int&)>
+    2dfc:	8b 10                	mov    (%rax),%edx
+    2dfe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e02:	89 10                	mov    %edx,(%rax)
+        }
+    2e04:	90                   	nop
+    2e05:	c9                   	leave
+    2e06:	c3                   	ret
+    2e07:	90                   	nop
+
+0000000000002e08 <nel::Element<void*>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    2e08:	55                   	push   %rbp
+    2e09:	48 89 e5             	mov    %rsp,%rbp
+    2e0c:	48 83 ec 10          	sub    $0x10,%rsp
+    2e10:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    2e14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e18:	48 89 c7             	mov    %rax,%rdi
+    2e1b:	e8 5a 01 00 00       	call   2f7a <nel::Element<void*>::ref() const>
+        }
+    2e20:	c9                   	leave
+    2e21:	c3                   	ret
+
+0000000000002e22 <nel::Element<nel::heaped::AllocError>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    2e22:	55                   	push   %rbp
+    2e23:	48 89 e5             	mov    %rsp,%rbp
+    2e26:	48 83 ec 10          	sub    $0x10,%rsp
+    2e2a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    2e2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e32:	48 89 c7             	mov    %rax,%rdi
+    2e35:	e8 4e 01 00 00       	call   2f88 <nel::Element<nel::heaped::AllocError>::ref() const>
+        }
+    2e3a:	c9                   	leave
+    2e3b:	c3                   	ret
+
+0000000000002e3c <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>:
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    2e3c:	55                   	push   %rbp
+    2e3d:	48 89 e5             	mov    %rsp,%rbp
+    2e40:	48 83 ec 10          	sub    $0x10,%rsp
+    2e44:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2e48:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2e4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e50:	48 89 c7             	mov    %rax,%rdi
+    2e53:	e8 3e 01 00 00       	call   2f96 <void*&& nel::forward<void*, void*>(void*&)>
+    2e58:	48 8b 00             	mov    (%rax),%rax
+    2e5b:	c9                   	leave
+    2e5c:	c3                   	ret
+    2e5d:	90                   	nop
+
+0000000000002e5e <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>:
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    2e5e:	55                   	push   %rbp
+    2e5f:	48 89 e5             	mov    %rsp,%rbp
+    2e62:	48 83 ec 10          	sub    $0x10,%rsp
+    2e66:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2e6a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2e6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e72:	48 8b 00             	mov    (%rax),%rax
+    2e75:	48 89 c6             	mov    %rax,%rsi
+    2e78:	48 8d 05 91 12 00 00 	lea    0x1291(%rip),%rax        # 4110 <n_values+0xd8>
+    2e7f:	48 89 c7             	mov    %rax,%rdi
+    2e82:	e8 ce 02 00 00       	call   3155 <nel::panic(char const*, nel::Context const&)>
+    2e87:	90                   	nop
+
+0000000000002e88 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>:
+        constexpr T unwrap(Context const &ctx = Context())
+    2e88:	55                   	push   %rbp
+    2e89:	48 89 e5             	mov    %rsp,%rbp
+    2e8c:	48 83 ec 20          	sub    $0x20,%rsp
+    2e90:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2e94:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    2e98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2e9c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    2ea0:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2ea4:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    2ea8:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    2eac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2eb0:	48 89 c7             	mov    %rax,%rdi
+    2eb3:	e8 ec 00 00 00       	call   2fa4 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>
+        }
+    2eb8:	c9                   	leave
+    2eb9:	c3                   	ret
+
+0000000000002eba <nel::heaped::Node<int, nel::heaped::Malloc>::push_back_relocated(int*, unsigned long)>:
+            len_ += n;
+        }
+
+        // Relocate n values from s onto the end, s is left uninitialised.
+        // Caller must have made room.
+        void push_back_relocated(Type s[], Count const n)
+    2eba:	55                   	push   %rbp
+    2ebb:	48 89 e5             	mov    %rsp,%rbp
+    2ebe:	53                   	push   %rbx
+    2ebf:	48 83 ec 48          	sub    $0x48,%rsp
+    2ec3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    2ec7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    2ecb:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+        {
+            nel::assert(len() + n <= capacity(), "heaped::Node: no room");
+    2ecf:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    2ed3:	b9 5c 01 00 00       	mov    $0x15c,%ecx
+    2ed8:	48 8d 15 12 12 00 00 	lea    0x1212(%rip),%rdx        # 40f1 <n_values+0xb9>
+    2edf:	48 8d 35 34 12 00 00 	lea    0x1234(%rip),%rsi        # 411a <n_values+0xe2>
+    2ee6:	48 89 c7             	mov    %rax,%rdi
+    2ee9:	e8 e8 e4 ff ff       	call   13d6 <nel::Context::Context(char const*, char const*, int)>
+    2eee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2ef2:	48 89 c7             	mov    %rax,%rdi
+    2ef5:	e8 20 f9 ff ff       	call   281a <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    2efa:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    2efe:	48 8d 1c 10          	lea    (%rax,%rdx,1),%rbx
+    2f02:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2f06:	48 89 c7             	mov    %rax,%rdi
+    2f09:	e8 1e f9 ff ff       	call   282c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    2f0e:	48 39 d8             	cmp    %rbx,%rax
+    2f11:	0f 93 c0             	setae  %al
+    2f14:	0f b6 c0             	movzbl %al,%eax
+    2f17:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    2f1b:	48 8d 0d 0c 12 00 00 	lea    0x120c(%rip),%rcx        # 412e <n_values+0xf6>
+    2f22:	48 89 ce             	mov    %rcx,%rsi
+    2f25:	89 c7                	mov    %eax,%edi
+    2f27:	e8 e1 e4 ff ff       	call   140d <nel::assert(bool, char const*, nel::Context const&)>
+            elem::relocate(&values_[len_], s, n);
+    2f2c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2f30:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2f34:	48 83 c0 04          	add    $0x4,%rax
+    2f38:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2f3f:	00 
+    2f40:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2f44:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    2f48:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    2f4c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2f50:	48 89 c6             	mov    %rax,%rsi
+    2f53:	48 89 cf             	mov    %rcx,%rdi
+    2f56:	e8 12 01 00 00       	call   306d <void nel::elem::relocate<int>(int*, int*, unsigned long)>
+            len_ += n;
+    2f5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2f5f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2f63:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2f67:	48 01 c2             	add    %rax,%rdx
+    2f6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2f6e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    2f72:	90                   	nop
+    2f73:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2f77:	c9                   	leave
+    2f78:	c3                   	ret
+    2f79:	90                   	nop
+
+0000000000002f7a <nel::Element<void*>::ref() const>:
+        constexpr Type const &ref(void) const
+    2f7a:	55                   	push   %rbp
+    2f7b:	48 89 e5             	mov    %rsp,%rbp
+    2f7e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2f82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2f86:	5d                   	pop    %rbp
+    2f87:	c3                   	ret
+
+0000000000002f88 <nel::Element<nel::heaped::AllocError>::ref() const>:
+        constexpr Type const &ref(void) const
+    2f88:	55                   	push   %rbp
+    2f89:	48 89 e5             	mov    %rsp,%rbp
+    2f8c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2f90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2f94:	5d                   	pop    %rbp
+    2f95:	c3                   	ret
+
+0000000000002f96 <void*&& nel::forward<void*, void*>(void*&)>:
+constexpr U &&forward(T &t)
+    2f96:	55                   	push   %rbp
+    2f97:	48 89 e5             	mov    %rsp,%rbp
+    2f9a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    2f9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2fa2:	5d                   	pop    %rbp
+    2fa3:	c3                   	ret
+
+0000000000002fa4 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    2fa4:	             55                   	push   %rbp
+    2fa5:	             48 89 e5             	mov    %rsp,%rbp
+    2fa8:	             48 83 ec 30          	sub    $0x30,%rsp
+    2fac:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2fb0:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2fb4:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    2fb8:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    2fbc:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2fc0:	             8b 00                	mov    (%rax),%eax
+    2fc2:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    2fc5:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2fc9:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    2fcf:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    2fd3:	         /-- 74 3e                	je     3013 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x6f>
+    2fd5:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    2fd9:	/--------|-- 7f 7a                	jg     3055 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+    2fdb:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2fdf:	|  /-----|-- 74 5e                	je     303f <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x9b>
+    2fe1:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    2fe5:	+--|-----|-- 75 6e                	jne    3055 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+                    return on_ok(forward<T>(*ok_));
+    2fe7:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2feb:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    2fef:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2ff2:	|  |     |   e8 b9 00 00 00       	call   30b0 <nel::Element<void*>::operator*()>
+    2ff7:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2ffa:	|  |     |   e8 97 ff ff ff       	call   2f96 <void*&& nel::forward<void*, void*>(void*&)>
+    2fff:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    3002:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3006:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    3009:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    300c:	|  |     |   e8 2b fe ff ff       	call   2e3c <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>
+    3011:	|  |  /--|-- eb 58                	jmp    306b <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    return on_err(forward<E>(*err_));
+    3013:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3017:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    301b:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    301e:	|  |  |      e8 a7 00 00 00       	call   30ca <nel::Element<nel::heaped::AllocError>::operator*()>
+    3023:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3026:	|  |  |      e8 d7 e9 ff ff       	call   1a02 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    302b:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    302e:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3032:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    3035:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3038:	|  |  |      e8 21 fe ff ff       	call   2e5e <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>
+    303d:	|  |  +----- eb 2c                	jmp    306b <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    nel::panic("invalid Result", ctx);
+    303f:	|  \--|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3043:	|     |      48 89 c6             	mov    %rax,%rsi
+    3046:	|     |      48 8d 05 95 10 00 00 	lea    0x1095(%rip),%rax        # 40e2 <n_values+0xaa>
+    304d:	|     |      48 89 c7             	mov    %rax,%rdi
+    3050:	|     |      e8 00 01 00 00       	call   3155 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    3055:	\-----|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3059:	      |      48 89 c6             	mov    %rax,%rsi
+    305c:	      |      48 8d 05 3d 10 00 00 	lea    0x103d(%rip),%rax        # 40a0 <n_values+0x68>
+    3063:	      |      48 89 c7             	mov    %rax,%rdi
+    3066:	      |      e8 ea 00 00 00       	call   3155 <nel::panic(char const*, nel::Context const&)>
+        }
+    306b:	      \----> c9                   	leave
+    306c:	             c3                   	ret
+
+000000000000306d <void nel::elem::relocate<int>(int*, int*, unsigned long)>:
+ * @warning UB if [s, s+n) is not initialised.
+ */
+void relocate(uint8_t *const d, uint8_t *const s, Length const n);
+
+template<typename T>
+void relocate(T d[], T s[], Length const n)
+    306d:	       55                   	push   %rbp
+    306e:	       48 89 e5             	mov    %rsp,%rbp
+    3071:	       48 83 ec 20          	sub    $0x20,%rsp
+    3075:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3079:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    307d:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+{
+    if (d == s) { return; }
+    3081:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3085:	       48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    3089:	/----- 74 21                	je     30ac <void nel::elem::relocate<int>(int*, int*, unsigned long)+0x3f>
+    if constexpr (is_trivially_relocatable<T>) {
+        relocate(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t *>(s), n * sizeof(T));
+    308b:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    308f:	|      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3096:	|      00 
+    3097:	|      48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    309b:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    309f:	|      48 89 ce             	mov    %rcx,%rsi
+    30a2:	|      48 89 c7             	mov    %rax,%rdi
+    30a5:	|      e8 fe 01 00 00       	call   32a8 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>
+    30aa:	|  /-- eb 01                	jmp    30ad <void nel::elem::relocate<int>(int*, int*, unsigned long)+0x40>
+    if (d == s) { return; }
+    30ac:	\--|-> 90                   	nop
+        for (Index i = n; i > 0; --i) {
+            new (&d[i - 1]) T(nel::move(s[i - 1]));
+            s[i - 1].~T();
+        }
+    }
+}
+    30ad:	   \-> c9                   	leave
+    30ae:	       c3                   	ret
+    30af:	       90                   	nop
+
+00000000000030b0 <nel::Element<void*>::operator*()>:
+
+        constexpr Type &operator*(void)
+    30b0:	55                   	push   %rbp
+    30b1:	48 89 e5             	mov    %rsp,%rbp
+    30b4:	48 83 ec 10          	sub    $0x10,%rsp
+    30b8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    30bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30c0:	48 89 c7             	mov    %rax,%rdi
+    30c3:	e8 1c 00 00 00       	call   30e4 <nel::Element<void*>::ref()>
+        }
+    30c8:	c9                   	leave
+    30c9:	c3                   	ret
+
+00000000000030ca <nel::Element<nel::heaped::AllocError>::operator*()>:
+        constexpr Type &operator*(void)
+    30ca:	55                   	push   %rbp
+    30cb:	48 89 e5             	mov    %rsp,%rbp
+    30ce:	48 83 ec 10          	sub    $0x10,%rsp
+    30d2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    30d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30da:	48 89 c7             	mov    %rax,%rdi
+    30dd:	e8 10 00 00 00       	call   30f2 <nel::Element<nel::heaped::AllocError>::ref()>
+        }
+    30e2:	c9                   	leave
+    30e3:	c3                   	ret
+
+00000000000030e4 <nel::Element<void*>::ref()>:
+        constexpr Type &ref(void)
+    30e4:	55                   	push   %rbp
+    30e5:	48 89 e5             	mov    %rsp,%rbp
+    30e8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    30ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    30f0:	5d                   	pop    %rbp
+    30f1:	c3                   	ret
+
+00000000000030f2 <nel::Element<nel::heaped::AllocError>::ref()>:
+        constexpr Type &ref(void)
+    30f2:	55                   	push   %rbp
+    30f3:	48 89 e5             	mov    %rsp,%rbp
+    30f6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    30fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    30fe:	5d                   	pop    %rbp
+    30ff:	c3                   	ret
+
+0000000000003100 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    3100:	55                   	push   %rbp
+    3101:	48 89 e5             	mov    %rsp,%rbp
+    std::abort();
+    3104:	e8 37 df ff ff       	call   1040 <abort@plt>
+
+0000000000003109 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    3109:	55                   	push   %rbp
+    310a:	48 89 e5             	mov    %rsp,%rbp
+    310d:	48 83 ec 10          	sub    $0x10,%rsp
+    3111:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    3115:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3119:	48 8b 30             	mov    (%rax),%rsi
+    311c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3120:	8b 48 10             	mov    0x10(%rax),%ecx
+    3123:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3127:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    312b:	48 8b 05 4e 3f 00 00 	mov    0x3f4e(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    3132:	4c 8d 0d 0c 10 00 00 	lea    0x100c(%rip),%r9        # 4145 <nel::is_trivially_relocatable<int>+0x1>
+    3139:	49 89 f0             	mov    %rsi,%r8
+    313c:	48 8d 35 08 10 00 00 	lea    0x1008(%rip),%rsi        # 414b <nel::is_trivially_relocatable<int>+0x7>
+    3143:	48 89 c7             	mov    %rax,%rdi
+    3146:	b8 00 00 00 00       	mov    $0x0,%eax
+    314b:	e8 50 df ff ff       	call   10a0 <fprintf@plt>
+    abort();
+    3150:	e8 ab ff ff ff       	call   3100 <nel::abort()>
+
+0000000000003155 <nel::panic(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    3155:	55                   	push   %rbp
+    3156:	48 89 e5             	mov    %rsp,%rbp
+    3159:	48 83 ec 10          	sub    $0x10,%rsp
+    315d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3161:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    3165:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3169:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    316c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3170:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    3173:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3177:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    317b:	48 8b 05 fe 3e 00 00 	mov    0x3efe(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    3182:	48 83 ec 08          	sub    $0x8,%rsp
+    3186:	ff 75 f8             	push   -0x8(%rbp)
+    3189:	4c 8d 0d b5 0f 00 00 	lea    0xfb5(%rip),%r9        # 4145 <nel::is_trivially_relocatable<int>+0x1>
+    3190:	49 89 f0             	mov    %rsi,%r8
+    3193:	48 8d 35 c2 0f 00 00 	lea    0xfc2(%rip),%rsi        # 415c <nel::is_trivially_relocatable<int>+0x18>
+    319a:	48 89 c7             	mov    %rax,%rdi
+    319d:	b8 00 00 00 00       	mov    $0x0,%eax
+    31a2:	e8 f9 de ff ff       	call   10a0 <fprintf@plt>
+    31a7:	48 83 c4 10          	add    $0x10,%rsp
+            "PANIC",
+            msg);
+    abort();
+    31ab:	e8 50 ff ff ff       	call   3100 <nel::abort()>
+
+00000000000031b0 <nel::assert_fail(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    31b0:	55                   	push   %rbp
+    31b1:	48 89 e5             	mov    %rsp,%rbp
+    31b4:	48 83 ec 10          	sub    $0x10,%rsp
+    31b8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    31bc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    31c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    31c4:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    31c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    31cb:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    31ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    31d2:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    31d6:	48 8b 05 a3 3e 00 00 	mov    0x3ea3(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    31dd:	48 83 ec 08          	sub    $0x8,%rsp
+    31e1:	ff 75 f8             	push   -0x8(%rbp)
+    31e4:	4c 8d 0d 86 0f 00 00 	lea    0xf86(%rip),%r9        # 4171 <nel::is_trivially_relocatable<int>+0x2d>
+    31eb:	49 89 f0             	mov    %rsi,%r8
+    31ee:	48 8d 35 67 0f 00 00 	lea    0xf67(%rip),%rsi        # 415c <nel::is_trivially_relocatable<int>+0x18>
+    31f5:	48 89 c7             	mov    %rax,%rdi
+    31f8:	b8 00 00 00 00       	mov    $0x0,%eax
+    31fd:	e8 9e de ff ff       	call   10a0 <fprintf@plt>
+    3202:	48 83 c4 10          	add    $0x10,%rsp
+            "ASSERT FAIL",
+            msg);
+    abort();
+    3206:	e8 f5 fe ff ff       	call   3100 <nel::abort()>
+
+000000000000320b <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    320b:	55                   	push   %rbp
+    320c:	48 89 e5             	mov    %rsp,%rbp
+    320f:	48 83 ec 20          	sub    $0x20,%rsp
+    3213:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3217:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    321b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    321f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3223:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3227:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    322b:	48 89 ce             	mov    %rcx,%rsi
+    322e:	48 89 c7             	mov    %rax,%rdi
+    3231:	e8 7a de ff ff       	call   10b0 <memcpy@plt>
+}
+    3236:	90                   	nop
+    3237:	c9                   	leave
+    3238:	c3                   	ret
+
+0000000000003239 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    3239:	55                   	push   %rbp
+    323a:	48 89 e5             	mov    %rsp,%rbp
+    323d:	48 83 ec 20          	sub    $0x20,%rsp
+    3241:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3245:	89 f0                	mov    %esi,%eax
+    3247:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    324b:	88 45 f4             	mov    %al,-0xc(%rbp)
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    324e:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    3252:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3256:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    325a:	89 ce                	mov    %ecx,%esi
+    325c:	48 89 c7             	mov    %rax,%rdi
+    325f:	e8 0c de ff ff       	call   1070 <memset@plt>
+}
+    3264:	90                   	nop
+    3265:	c9                   	leave
+    3266:	c3                   	ret
+
+0000000000003267 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    3267:	55                   	push   %rbp
+    3268:	48 89 e5             	mov    %rsp,%rbp
+    326b:	48 83 ec 20          	sub    $0x20,%rsp
+    326f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3273:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3277:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    //     *id = *is;
+    // }
+    // for (uint8_t *id = d, *is = s, *const e = (d + n); id != e; ++is, ++id) {
+    //     *is = 0xa5;
+    // }
+    copy(d, s, n);
+    327b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    327f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3283:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3287:	48 89 ce             	mov    %rcx,%rsi
+    328a:	48 89 c7             	mov    %rax,%rdi
+    328d:	e8 79 ff ff ff       	call   320b <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    poison(s, n);
+    3292:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3296:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    329a:	48 89 d6             	mov    %rdx,%rsi
+    329d:	48 89 c7             	mov    %rax,%rdi
+    32a0:	e8 60 07 00 00       	call   3a05 <nel::elem::poison(unsigned char*, unsigned long)>
+}
+    32a5:	90                   	nop
+    32a6:	c9                   	leave
+    32a7:	c3                   	ret
+
+00000000000032a8 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    32a8:	55                   	push   %rbp
+    32a9:	48 89 e5             	mov    %rsp,%rbp
+    32ac:	48 83 ec 20          	sub    $0x20,%rsp
+    32b0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    32b4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    32b8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    std::memmove(d, s, n);
+    32bc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    32c0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    32c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32c8:	48 89 ce             	mov    %rcx,%rsi
+    32cb:	48 89 c7             	mov    %rax,%rdi
+    32ce:	e8 fd dd ff ff       	call   10d0 <memmove@plt>
+}
+    32d3:	90                   	nop
+    32d4:	c9                   	leave
+    32d5:	c3                   	ret
+
+00000000000032d6 <nel::elem::wipe(unsigned char*, unsigned long)>:
+
+void wipe(uint8_t *const d, Length const n)
+{
+    32d6:	55                   	push   %rbp
+    32d7:	48 89 e5             	mov    %rsp,%rbp
+    32da:	48 83 ec 10          	sub    $0x10,%rsp
+    32de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    32e2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    set(d, 0xa5, n);
+    32e6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    32ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32ee:	be a5 00 00 00       	mov    $0xa5,%esi
+    32f3:	48 89 c7             	mov    %rax,%rdi
+    32f6:	e8 3e ff ff ff       	call   3239 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    32fb:	90                   	nop
+    32fc:	c9                   	leave
+    32fd:	c3                   	ret
+
+00000000000032fe <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    32fe:	55                   	push   %rbp
+    32ff:	48 89 e5             	mov    %rsp,%rbp
+    3302:	48 83 ec 20          	sub    $0x20,%rsp
+    3306:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    330a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    330e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    3312:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3316:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    331a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    331e:	48 89 ce             	mov    %rcx,%rsi
+    3321:	48 89 c7             	mov    %rax,%rdi
+    3324:	e8 67 dd ff ff       	call   1090 <memcmp@plt>
+    3329:	85 c0                	test   %eax,%eax
+    332b:	0f 94 c0             	sete   %al
+}
+    332e:	c9                   	leave
+    332f:	c3                   	ret
+
+0000000000003330 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    3330:	55                   	push   %rbp
+    3331:	48 89 e5             	mov    %rsp,%rbp
+    3334:	48 83 ec 20          	sub    $0x20,%rsp
+    3338:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    333c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3340:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    3344:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3348:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    334c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3350:	48 89 ce             	mov    %rcx,%rsi
+    3353:	48 89 c7             	mov    %rax,%rdi
+    3356:	e8 35 dd ff ff       	call   1090 <memcmp@plt>
+    335b:	85 c0                	test   %eax,%eax
+    335d:	0f 95 c0             	setne  %al
+}
+    3360:	c9                   	leave
+    3361:	c3                   	ret
+
+0000000000003362 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>:
+
+// d[i] = p[i % 16] for i in [0, n), with normal stores:
+// the pattern once, then doubling the filled region.
+static void set_pattern(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    3362:	       55                   	push   %rbp
+    3363:	       48 89 e5             	mov    %rsp,%rbp
+    3366:	       48 83 ec 30          	sub    $0x30,%rsp
+    336a:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    336e:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    3372:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    Length done = (n < 16) ? n : 16;
+    3376:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    337a:	       ba 10 00 00 00       	mov    $0x10,%edx
+    337f:	       48 39 d0             	cmp    %rdx,%rax
+    3382:	       48 0f 47 c2          	cmova  %rdx,%rax
+    3386:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    copy(d, p, done);
+    338a:	       48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    338e:	       48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    3392:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3396:	       48 89 ce             	mov    %rcx,%rsi
+    3399:	       48 89 c7             	mov    %rax,%rdi
+    339c:	       e8 6a fe ff ff       	call   320b <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    while (done < n) {
+    33a1:	   /-- eb 3e                	jmp    33e1 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x7f>
+        Length const m = (done < n - done) ? done : n - done;
+    33a3:	/--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    33a7:	|  |   48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    33ab:	|  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    33af:	|  |   48 39 c2             	cmp    %rax,%rdx
+    33b2:	|  |   48 0f 46 c2          	cmovbe %rdx,%rax
+    33b6:	|  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        copy(d + done, d, m);
+    33ba:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    33be:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33c2:	|  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    33c6:	|  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    33ca:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    33ce:	|  |   48 89 c6             	mov    %rax,%rsi
+    33d1:	|  |   48 89 cf             	mov    %rcx,%rdi
+    33d4:	|  |   e8 32 fe ff ff       	call   320b <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        done += m;
+    33d9:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    33dd:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+    while (done < n) {
+    33e1:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33e5:	|      48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    33e9:	\----- 72 b8                	jb     33a3 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x41>
+    }
+}
+    33eb:	       90                   	nop
+    33ec:	       90                   	nop
+    33ed:	       c9                   	leave
+    33ee:	       c3                   	ret
+
+00000000000033ef <nel::elem::load16(unsigned char const*)>:
+static constexpr Length streaming_min = 256;
+
+typedef long long int Line16 __attribute__((vector_size(16)));
+
+static inline Line16 load16(uint8_t const *const s)
+{
+    33ef:	55                   	push   %rbp
+    33f0:	48 89 e5             	mov    %rsp,%rbp
+    33f3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Line16 v;
+    std::memcpy(&v, s, sizeof(v));
+    33f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    33fb:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    33ff:	48 8b 00             	mov    (%rax),%rax
+    3402:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    3406:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    return v;
+    340a:	66 0f 6f 45 f0       	movdqa -0x10(%rbp),%xmm0
+}
+    340f:	5d                   	pop    %rbp
+    3410:	c3                   	ret
+
+0000000000003411 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>:
+
+static inline void stream16(uint8_t *const d, Line16 const &v)
+{
+    3411:	55                   	push   %rbp
+    3412:	48 89 e5             	mov    %rsp,%rbp
+    3415:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3419:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    341d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3421:	66 0f 6f 00          	movdqa (%rax),%xmm0
+    3425:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3429:	66 0f e7 00          	movntdq %xmm0,(%rax)
+}
+    342d:	90                   	nop
+    342e:	5d                   	pop    %rbp
+    342f:	c3                   	ret
+
+0000000000003430 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    3430:	          55                   	push   %rbp
+    3431:	          48 89 e5             	mov    %rsp,%rbp
+    3434:	          48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    3438:	          48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    343c:	          48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    3440:	          48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    if (n < streaming_min) {
+    3444:	          48 81 7d 88 ff 00 00 	cmpq   $0xff,-0x78(%rbp)
+    344b:	          00 
+    344c:	      /-- 77 1c                	ja     346a <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        copy(d, s, n);
+    344e:	      |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    3452:	      |   48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    3456:	      |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    345a:	      |   48 89 ce             	mov    %rcx,%rsi
+    345d:	      |   48 89 c7             	mov    %rax,%rdi
+    3460:	      |   e8 a6 fd ff ff       	call   320b <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        return;
+    3465:	/-----|-- e9 98 01 00 00       	jmp    3602 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1d2>
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    346a:	|     \-> 48 8b 45 98          	mov    -0x68(%rbp),%rax
+    346e:	|         48 f7 d8             	neg    %rax
+    3471:	|         83 e0 0f             	and    $0xf,%eax
+    3474:	|         48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    copy(d, s, head);
+    3478:	|         48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    347c:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    3480:	|         48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3484:	|         48 89 ce             	mov    %rcx,%rsi
+    3487:	|         48 89 c7             	mov    %rax,%rdi
+    348a:	|         e8 7c fd ff ff       	call   320b <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    Index i = head;
+    348f:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3493:	|         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    3497:	|     /-- e9 e1 00 00 00       	jmp    357d <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        Line16 const a = load16(s + i);
+    349c:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    34a0:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    34a4:	|  |  |   48 01 d0             	add    %rdx,%rax
+    34a7:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    34aa:	|  |  |   e8 40 ff ff ff       	call   33ef <nel::elem::load16(unsigned char const*)>
+    34af:	|  |  |   0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+        Line16 const b = load16(s + i + 16);
+    34b3:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    34b7:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    34bb:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    34bf:	|  |  |   48 01 d0             	add    %rdx,%rax
+    34c2:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    34c5:	|  |  |   e8 25 ff ff ff       	call   33ef <nel::elem::load16(unsigned char const*)>
+    34ca:	|  |  |   0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+        Line16 const c = load16(s + i + 32);
+    34ce:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    34d2:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    34d6:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    34da:	|  |  |   48 01 d0             	add    %rdx,%rax
+    34dd:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    34e0:	|  |  |   e8 0a ff ff ff       	call   33ef <nel::elem::load16(unsigned char const*)>
+    34e5:	|  |  |   0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+        Line16 const e = load16(s + i + 48);
+    34e9:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    34ed:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    34f1:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    34f5:	|  |  |   48 01 d0             	add    %rdx,%rax
+    34f8:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    34fb:	|  |  |   e8 ef fe ff ff       	call   33ef <nel::elem::load16(unsigned char const*)>
+    3500:	|  |  |   0f 29 45 a0          	movaps %xmm0,-0x60(%rbp)
+        stream16(d + i, a);
+    3504:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    3508:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    350c:	|  |  |   48 01 c2             	add    %rax,%rdx
+    350f:	|  |  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    3513:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3516:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3519:	|  |  |   e8 f3 fe ff ff       	call   3411 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, b);
+    351e:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3522:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    3526:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    352a:	|  |  |   48 01 c2             	add    %rax,%rdx
+    352d:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3531:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3534:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3537:	|  |  |   e8 d5 fe ff ff       	call   3411 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, c);
+    353c:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3540:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    3544:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3548:	|  |  |   48 01 c2             	add    %rax,%rdx
+    354b:	|  |  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    354f:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3552:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3555:	|  |  |   e8 b7 fe ff ff       	call   3411 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, e);
+    355a:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    355e:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    3562:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3566:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3569:	|  |  |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    356d:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3570:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3573:	|  |  |   e8 99 fe ff ff       	call   3411 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    3578:	|  |  |   48 83 45 f8 40       	addq   $0x40,-0x8(%rbp)
+    357d:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3581:	|  |      48 83 c0 40          	add    $0x40,%rax
+    3585:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    3589:	|  \----- 0f 83 0d ff ff ff    	jae    349c <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x6c>
+    }
+    for (; i + 16 <= n; i += 16) {
+    358f:	|     /-- eb 36                	jmp    35c7 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x197>
+        stream16(d + i, load16(s + i));
+    3591:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3595:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3599:	|  |  |   48 01 d0             	add    %rdx,%rax
+    359c:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    359f:	|  |  |   e8 4b fe ff ff       	call   33ef <nel::elem::load16(unsigned char const*)>
+    35a4:	|  |  |   0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+    35a8:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    35ac:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    35b0:	|  |  |   48 01 c2             	add    %rax,%rdx
+    35b3:	|  |  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    35b7:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    35ba:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    35bd:	|  |  |   e8 4f fe ff ff       	call   3411 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    35c2:	|  |  |   48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+    35c7:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    35cb:	|  |      48 83 c0 10          	add    $0x10,%rax
+    35cf:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    35d3:	|  \----- 73 bc                	jae    3591 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    35d5:	|         0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    35d8:	|         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    35dc:	|         48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    35e0:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    35e4:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    35e8:	|         48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    35ec:	|         48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+    35f0:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    35f4:	|         48 01 d1             	add    %rdx,%rcx
+    35f7:	|         48 89 c2             	mov    %rax,%rdx
+    35fa:	|         48 89 cf             	mov    %rcx,%rdi
+    35fd:	|         e8 09 fc ff ff       	call   320b <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+}
+    3602:	\-------> c9                   	leave
+    3603:	          c3                   	ret
+
+0000000000003604 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    3604:	          55                   	push   %rbp
+    3605:	          48 89 e5             	mov    %rsp,%rbp
+    3608:	          48 83 ec 60          	sub    $0x60,%rsp
+    360c:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    3610:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    3614:	          48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    if (n < streaming_min) {
+    3618:	          48 81 7d a8 ff 00 00 	cmpq   $0xff,-0x58(%rbp)
+    361f:	          00 
+    3620:	      /-- 77 1c                	ja     363e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        set_pattern(d, p, n);
+    3622:	      |   48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    3626:	      |   48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+    362a:	      |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    362e:	      |   48 89 ce             	mov    %rcx,%rsi
+    3631:	      |   48 89 c7             	mov    %rax,%rdi
+    3634:	      |   e8 29 fd ff ff       	call   3362 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>
+    3639:	/-----|-- e9 89 01 00 00       	jmp    37c7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c3>
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    363e:	|     \-> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3642:	|         48 f7 d8             	neg    %rax
+    3645:	|         83 e0 0f             	and    $0xf,%eax
+    3648:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    for (Index i = 0; i < head; ++i) {
+    364c:	|         48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    3653:	|         00 
+    3654:	|     /-- eb 20                	jmp    3676 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x72>
+        d[i] = p[i];
+    3656:	|  /--|-> 48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    365a:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    365e:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3661:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    3665:	|  |  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3669:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    366c:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    366f:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < head; ++i) {
+    3671:	|  |  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    3676:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    367a:	|  |      48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    367e:	|  \----- 72 d6                	jb     3656 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x52>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    3680:	|         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    3687:	|         00 
+    3688:	|     /-- eb 2d                	jmp    36b7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xb3>
+        rotated[i] = p[(head + i) % 16];
+    368a:	|  /--|-> 48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    368e:	|  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3692:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3695:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    3698:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    369b:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    369f:	|  |  |   48 01 d0             	add    %rdx,%rax
+    36a2:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    36a5:	|  |  |   48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    36a9:	|  |  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    36ad:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    36b0:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < 16; ++i) {
+    36b2:	|  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    36b7:	|  |  \-> 48 83 7d f0 0f       	cmpq   $0xf,-0x10(%rbp)
+    36bc:	|  \----- 76 cc                	jbe    368a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x86>
+    }
+    Line16 const v = load16(rotated);
+    36be:	|         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    36c2:	|         48 89 c7             	mov    %rax,%rdi
+    36c5:	|         e8 25 fd ff ff       	call   33ef <nel::elem::load16(unsigned char const*)>
+    36ca:	|         0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+    Index i = head;
+    36ce:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    36d2:	|         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    36d6:	|     /-- eb 79                	jmp    3751 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        stream16(d + i, v);
+    36d8:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    36dc:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    36e0:	|  |  |   48 01 c2             	add    %rax,%rdx
+    36e3:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    36e7:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    36ea:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    36ed:	|  |  |   e8 1f fd ff ff       	call   3411 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, v);
+    36f2:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    36f6:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    36fa:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    36fe:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3701:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3705:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3708:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    370b:	|  |  |   e8 01 fd ff ff       	call   3411 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, v);
+    3710:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3714:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    3718:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    371c:	|  |  |   48 01 c2             	add    %rax,%rdx
+    371f:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3723:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3726:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3729:	|  |  |   e8 e3 fc ff ff       	call   3411 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, v);
+    372e:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3732:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    3736:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    373a:	|  |  |   48 01 c2             	add    %rax,%rdx
+    373d:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3741:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3744:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3747:	|  |  |   e8 c5 fc ff ff       	call   3411 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    374c:	|  |  |   48 83 45 e8 40       	addq   $0x40,-0x18(%rbp)
+    3751:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3755:	|  |      48 83 c0 40          	add    $0x40,%rax
+    3759:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    375d:	|  \----- 0f 83 75 ff ff ff    	jae    36d8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd4>
+    }
+    for (; i + 16 <= n; i += 16) {
+    3763:	|     /-- eb 1f                	jmp    3784 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x180>
+        stream16(d + i, v);
+    3765:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    3769:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    376d:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3770:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3774:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3777:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    377a:	|  |  |   e8 92 fc ff ff       	call   3411 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    377f:	|  |  |   48 83 45 e8 10       	addq   $0x10,-0x18(%rbp)
+    3784:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3788:	|  |      48 83 c0 10          	add    $0x10,%rax
+    378c:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    3790:	|  \----- 73 d3                	jae    3765 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    __builtin_ia32_sfence();
+    3792:	|         0f ae f8             	sfence
+    for (; i < n; ++i) {
+    3795:	|     /-- eb 26                	jmp    37bd <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1b9>
+        d[i] = p[i % 16];
+    3797:	|  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    379b:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    379e:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    37a1:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    37a5:	|  |  |   48 01 d0             	add    %rdx,%rax
+    37a8:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    37ac:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    37b0:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    37b3:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    37b6:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (; i < n; ++i) {
+    37b8:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    37bd:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    37c1:	|  |      48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    37c5:	|  \----- 72 d0                	jb     3797 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x193>
+    }
+}
+    37c7:	\-------> c9                   	leave
+    37c8:	          c3                   	ret
+
+00000000000037c9 <nel::offset_of(unsigned char*, unsigned long)>:
+// The payload is the first align boundary leaving room for a Length in front,
+// which holds the offset from the start of the underlying allocation.
+// Malloc alignment is at least alignof(Length), so the payload is at most
+// align bytes in.
+static Length offset_of(uint8_t *const base, Length const align)
+{
+    37c9:	55                   	push   %rbp
+    37ca:	48 89 e5             	mov    %rsp,%rbp
+    37cd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    37d1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    USize const a = reinterpret_cast<USize>(base) + sizeof(Length);
+    37d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    37d9:	48 83 c0 08          	add    $0x8,%rax
+    37dd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    37e1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    37e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    37e9:	48 01 d0             	add    %rdx,%rax
+    37ec:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    37f0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    37f4:	48 f7 d8             	neg    %rax
+    37f7:	48 21 c2             	and    %rax,%rdx
+    37fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    37fe:	48 29 c2             	sub    %rax,%rdx
+    3801:	48 89 d0             	mov    %rdx,%rax
+}
+    3804:	5d                   	pop    %rbp
+    3805:	c3                   	ret
+
+0000000000003806 <nel::offset_field(unsigned char*)>:
+
+static Length &offset_field(uint8_t *const p)
+{
+    3806:	55                   	push   %rbp
+    3807:	48 89 e5             	mov    %rsp,%rbp
+    380a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return reinterpret_cast<Length *>(p)[-1];
+    380e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3812:	48 83 e8 08          	sub    $0x8,%rax
+}
+    3816:	5d                   	pop    %rbp
+    3817:	c3                   	ret
+
+0000000000003818 <nel::free_aligned(void*)>:
+
+void free_aligned(void *const p)
+{
+    3818:	       55                   	push   %rbp
+    3819:	       48 89 e5             	mov    %rsp,%rbp
+    381c:	       48 83 ec 20          	sub    $0x20,%rsp
+    3820:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (p == nullptr) { return; }
+    3824:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3829:	/----- 74 2e                	je     3859 <nel::free_aligned(void*)+0x41>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    382b:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    382f:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    std::free(u8p - offset_field(u8p));
+    3833:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3837:	|      48 89 c7             	mov    %rax,%rdi
+    383a:	|      e8 c7 ff ff ff       	call   3806 <nel::offset_field(unsigned char*)>
+    383f:	|      48 8b 00             	mov    (%rax),%rax
+    3842:	|      48 f7 d8             	neg    %rax
+    3845:	|      48 89 c2             	mov    %rax,%rdx
+    3848:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    384c:	|      48 01 d0             	add    %rdx,%rax
+    384f:	|      48 89 c7             	mov    %rax,%rdi
+    3852:	|      e8 d9 d7 ff ff       	call   1030 <free@plt>
+    3857:	|  /-- eb 01                	jmp    385a <nel::free_aligned(void*)+0x42>
+    if (p == nullptr) { return; }
+    3859:	\--|-> 90                   	nop
+}
+    385a:	   \-> c9                   	leave
+    385b:	       c3                   	ret
+
+000000000000385c <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    385c:	             55                   	push   %rbp
+    385d:	             48 89 e5             	mov    %rsp,%rbp
+    3860:	             53                   	push   %rbx
+    3861:	             48 83 ec 78          	sub    $0x78,%rsp
+    3865:	             48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    3869:	             48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    386d:	             48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    3871:	             48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    3875:	             48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    3879:	             b9 f3 00 00 00       	mov    $0xf3,%ecx
+    387e:	             48 8d 15 0b 09 00 00 	lea    0x90b(%rip),%rdx        # 4190 <nel::elem::streaming_min+0x8>
+    3885:	             48 8d 35 16 09 00 00 	lea    0x916(%rip),%rsi        # 41a2 <nel::elem::streaming_min+0x1a>
+    388c:	             48 89 c7             	mov    %rax,%rdi
+    388f:	             e8 42 db ff ff       	call   13d6 <nel::Context::Context(char const*, char const*, int)>
+    3894:	             48 83 7d 90 00       	cmpq   $0x0,-0x70(%rbp)
+    3899:	      /----- 74 18                	je     38b3 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    389b:	      |      48 8b 45 90          	mov    -0x70(%rbp),%rax
+    389f:	      |      48 83 e8 01          	sub    $0x1,%rax
+    38a3:	      |      48 23 45 90          	and    -0x70(%rbp),%rax
+    38a7:	      |      48 85 c0             	test   %rax,%rax
+    38aa:	      +----- 75 07                	jne    38b3 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    38ac:	      |      b8 01 00 00 00       	mov    $0x1,%eax
+    38b1:	      |  /-- eb 05                	jmp    38b8 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x5c>
+    38b3:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    38b8:	         \-> 0f b6 c0             	movzbl %al,%eax
+    38bb:	             48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    38bf:	             48 8d 0d ec 08 00 00 	lea    0x8ec(%rip),%rcx        # 41b2 <nel::elem::streaming_min+0x2a>
+    38c6:	             48 89 ce             	mov    %rcx,%rsi
+    38c9:	             89 c7                	mov    %eax,%edi
+    38cb:	             e8 3d db ff ff       	call   140d <nel::assert(bool, char const*, nel::Context const&)>
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    38d0:	             48 8b 45 98          	mov    -0x68(%rbp),%rax
+    38d4:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    38d8:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    38dd:	      /----- 74 11                	je     38f0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x94>
+    38df:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    38e3:	      |      48 89 c7             	mov    %rax,%rdi
+    38e6:	      |      e8 1b ff ff ff       	call   3806 <nel::offset_field(unsigned char*)>
+    38eb:	      |      48 8b 00             	mov    (%rax),%rax
+    38ee:	      |  /-- eb 05                	jmp    38f5 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x99>
+    38f0:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    38f5:	         \-> 48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    38f9:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    38fe:	      /----- 74 13                	je     3913 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb7>
+    3900:	      |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3904:	      |      48 f7 d8             	neg    %rax
+    3907:	      |      48 89 c2             	mov    %rax,%rdx
+    390a:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    390e:	      |      48 01 d0             	add    %rdx,%rax
+    3911:	      |  /-- eb 05                	jmp    3918 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xbc>
+    3913:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3918:	         \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    391c:	             48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    3920:	             48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3924:	             48 01 c2             	add    %rax,%rdx
+    3927:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    392b:	             48 89 d6             	mov    %rdx,%rsi
+    392e:	             48 89 c7             	mov    %rax,%rdi
+    3931:	             e8 8a d7 ff ff       	call   10c0 <realloc@plt>
+    3936:	             48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if (new_base == nullptr) { return nullptr; }
+    393a:	             48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    393f:	         /-- 75 0a                	jne    394b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    3941:	         |   b8 00 00 00 00       	mov    $0x0,%eax
+    3946:	/--------|-- e9 85 00 00 00       	jmp    39d0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x174>
+
+    Length const new_offset = offset_of(new_base, align);
+    394b:	|        \-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    394f:	|            48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3953:	|            48 89 d6             	mov    %rdx,%rsi
+    3956:	|            48 89 c7             	mov    %rax,%rdi
+    3959:	|            e8 6b fe ff ff       	call   37c9 <nel::offset_of(unsigned char*, unsigned long)>
+    395e:	|            48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    uint8_t *const new_p = new_base + new_offset;
+    3962:	|            48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    3966:	|            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    396a:	|            48 01 d0             	add    %rdx,%rax
+    396d:	|            48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    if (old_p != nullptr && new_offset != old_offset) {
+    3971:	|            48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3976:	|  /-------- 74 41                	je     39b9 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+    3978:	|  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    397c:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    3980:	|  +-------- 74 37                	je     39b9 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+    3982:	|  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3986:	|  |         48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    398a:	|  |  /----- 73 06                	jae    3992 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x136>
+    398c:	|  |  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3990:	|  |  |  /-- eb 04                	jmp    3996 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x13a>
+    3992:	|  |  \--|-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    3996:	|  |     \-> 48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        std::memmove(new_p, new_base + old_offset, n);
+    399a:	|  |         48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    399e:	|  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    39a2:	|  |         48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    39a6:	|  |         48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    39aa:	|  |         48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    39ae:	|  |         48 89 ce             	mov    %rcx,%rsi
+    39b1:	|  |         48 89 c7             	mov    %rax,%rdi
+    39b4:	|  |         e8 17 d7 ff ff       	call   10d0 <memmove@plt>
+    }
+    offset_field(new_p) = new_offset;
+    39b9:	|  \-------> 48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+    39bd:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    39c1:	|            48 89 c7             	mov    %rax,%rdi
+    39c4:	|            e8 3d fe ff ff       	call   3806 <nel::offset_field(unsigned char*)>
+    39c9:	|            48 89 18             	mov    %rbx,(%rax)
+    return new_p;
+    39cc:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+}
+    39d0:	\----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    39d4:	             c9                   	leave
+    39d5:	             c3                   	ret
+
+00000000000039d6 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    39d6:	55                   	push   %rbp
+    39d7:	48 89 e5             	mov    %rsp,%rbp
+    39da:	48 83 ec 10          	sub    $0x10,%rsp
+    39de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    39e2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return realloc_aligned(nullptr, align, 0, size);
+    39e6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    39ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    39ee:	48 89 d1             	mov    %rdx,%rcx
+    39f1:	ba 00 00 00 00       	mov    $0x0,%edx
+    39f6:	48 89 c6             	mov    %rax,%rsi
+    39f9:	bf 00 00 00 00       	mov    $0x0,%edi
+    39fe:	e8 59 fe ff ff       	call   385c <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+}
+    3a03:	c9                   	leave
+    3a04:	c3                   	ret
+
+0000000000003a05 <nel::elem::poison(unsigned char*, unsigned long)>:
+{
+    3a05:	55                   	push   %rbp
+    3a06:	48 89 e5             	mov    %rsp,%rbp
+    3a09:	48 83 ec 10          	sub    $0x10,%rsp
+    3a0d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3a11:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    copy(d, s, n);
+    3a15:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3a19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a1d:	48 89 d6             	mov    %rdx,%rsi
+    3a20:	48 89 c7             	mov    %rax,%rdi
+    3a23:	e8 ae f8 ff ff       	call   32d6 <nel::elem::wipe(unsigned char*, unsigned long)>
+}
+    3a28:	90                   	nop
+    3a29:	c9                   	leave
+    3a2a:	c3                   	ret
+
+0000000000003a2b <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    3a2b:	55                   	push   %rbp
+    3a2c:	48 89 e5             	mov    %rsp,%rbp
+    3a2f:	48 83 ec 10          	sub    $0x10,%rsp
+    3a33:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3a37:	89 f0                	mov    %esi,%eax
+    3a39:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    3a3c:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    3a40:	48 8b 15 39 36 00 00 	mov    0x3639(%rip),%rdx        # 7080 <stderr@GLIBC_2.2.5>
+    3a47:	48 89 d6             	mov    %rdx,%rsi
+    3a4a:	89 c7                	mov    %eax,%edi
+    3a4c:	e8 2f d6 ff ff       	call   1080 <fputc@plt>
+    return outs;
+    3a51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3a55:	c9                   	leave
+    3a56:	c3                   	ret
+
+0000000000003a57 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    3a57:	55                   	push   %rbp
+    3a58:	48 89 e5             	mov    %rsp,%rbp
+    3a5b:	48 83 ec 10          	sub    $0x10,%rsp
+    3a5f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3a63:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    3a67:	48 8b 15 12 36 00 00 	mov    0x3612(%rip),%rdx        # 7080 <stderr@GLIBC_2.2.5>
+    3a6e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3a72:	48 89 d6             	mov    %rdx,%rsi
+    3a75:	48 89 c7             	mov    %rax,%rdi
+    3a78:	e8 e3 d5 ff ff       	call   1060 <fputs@plt>
+    return outs;
+    3a7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3a81:	c9                   	leave
+    3a82:	c3                   	ret
+
+0000000000003a83 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    3a83:	55                   	push   %rbp
+    3a84:	48 89 e5             	mov    %rsp,%rbp
+    3a87:	48 83 ec 10          	sub    $0x10,%rsp
+    3a8b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3a8f:	89 f0                	mov    %esi,%eax
+    3a91:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    3a94:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    3a98:	48 8b 05 e1 35 00 00 	mov    0x35e1(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    3a9f:	48 8d 0d 27 07 00 00 	lea    0x727(%rip),%rcx        # 41cd <nel::elem::streaming_min+0x45>
+    3aa6:	48 89 ce             	mov    %rcx,%rsi
+    3aa9:	48 89 c7             	mov    %rax,%rdi
+    3aac:	b8 00 00 00 00       	mov    $0x0,%eax
+    3ab1:	e8 ea d5 ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    3ab6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3aba:	c9                   	leave
+    3abb:	c3                   	ret
+
+0000000000003abc <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    3abc:	55                   	push   %rbp
+    3abd:	48 89 e5             	mov    %rsp,%rbp
+    3ac0:	48 83 ec 10          	sub    $0x10,%rsp
+    3ac4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3ac8:	89 f0                	mov    %esi,%eax
+    3aca:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    3ace:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    3ad2:	48 8b 05 a7 35 00 00 	mov    0x35a7(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    3ad9:	48 8d 0d ed 06 00 00 	lea    0x6ed(%rip),%rcx        # 41cd <nel::elem::streaming_min+0x45>
+    3ae0:	48 89 ce             	mov    %rcx,%rsi
+    3ae3:	48 89 c7             	mov    %rax,%rdi
+    3ae6:	b8 00 00 00 00       	mov    $0x0,%eax
+    3aeb:	e8 b0 d5 ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    3af0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3af4:	c9                   	leave
+    3af5:	c3                   	ret
+
+0000000000003af6 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    3af6:	55                   	push   %rbp
+    3af7:	48 89 e5             	mov    %rsp,%rbp
+    3afa:	48 83 ec 10          	sub    $0x10,%rsp
+    3afe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3b02:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    3b05:	48 8b 05 74 35 00 00 	mov    0x3574(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    3b0c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    3b0f:	48 8d 0d b7 06 00 00 	lea    0x6b7(%rip),%rcx        # 41cd <nel::elem::streaming_min+0x45>
+    3b16:	48 89 ce             	mov    %rcx,%rsi
+    3b19:	48 89 c7             	mov    %rax,%rdi
+    3b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+    3b21:	e8 7a d5 ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    3b26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3b2a:	c9                   	leave
+    3b2b:	c3                   	ret
+
+0000000000003b2c <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    3b2c:	55                   	push   %rbp
+    3b2d:	48 89 e5             	mov    %rsp,%rbp
+    3b30:	48 83 ec 10          	sub    $0x10,%rsp
+    3b34:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3b38:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    3b3b:	48 8b 05 3e 35 00 00 	mov    0x353e(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    3b42:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    3b45:	48 8d 0d 81 06 00 00 	lea    0x681(%rip),%rcx        # 41cd <nel::elem::streaming_min+0x45>
+    3b4c:	48 89 ce             	mov    %rcx,%rsi
+    3b4f:	48 89 c7             	mov    %rax,%rdi
+    3b52:	b8 00 00 00 00       	mov    $0x0,%eax
+    3b57:	e8 44 d5 ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    3b5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3b60:	c9                   	leave
+    3b61:	c3                   	ret
+
+0000000000003b62 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    3b62:	55                   	push   %rbp
+    3b63:	48 89 e5             	mov    %rsp,%rbp
+    3b66:	48 83 ec 10          	sub    $0x10,%rsp
+    3b6a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3b6e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    3b72:	48 8b 05 07 35 00 00 	mov    0x3507(%rip),%rax        # 7080 <stderr@GLIBC_2.2.5>
+    3b79:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3b7d:	48 8d 0d 4c 06 00 00 	lea    0x64c(%rip),%rcx        # 41d0 <nel::elem::streaming_min+0x48>
+    3b84:	48 89 ce             	mov    %rcx,%rsi
+    3b87:	48 89 c7             	mov    %rax,%rdi
+    3b8a:	b8 00 00 00 00       	mov    $0x0,%eax
+    3b8f:	e8 0c d5 ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+    3b94:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3b98:	c9                   	leave
+    3b99:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000003b9c <_fini>:
+    3b9c:	48 83 ec 08          	sub    $0x8,%rsp
+    3ba0:	48 83 c4 08          	add    $0x8,%rsp
+    3ba4:	c3                   	ret
@@ -0,0 +1,7187 @@
+
+target/debug/examples/bench_sort:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 ad 7f 00 00 	mov    0x7fad(%rip),%rax        # 8fb8 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 7f 00 00    	push   0x7fca(%rip)        # 8ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 7f 00 00    	jmp    *0x7fcc(%rip)        # 8ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 7f 00 00    	jmp    *0x7fca(%rip)        # 9000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 7f 00 00    	jmp    *0x7fc2(%rip)        # 9008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <qsort@plt>:
+    1050:	ff 25 ba 7f 00 00    	jmp    *0x7fba(%rip)        # 9010 <qsort@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <clock_gettime@plt>:
+    1060:	ff 25 b2 7f 00 00    	jmp    *0x7fb2(%rip)        # 9018 <clock_gettime@GLIBC_2.17>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputs@plt>:
+    1070:	ff 25 aa 7f 00 00    	jmp    *0x7faa(%rip)        # 9020 <fputs@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memset@plt>:
+    1080:	ff 25 a2 7f 00 00    	jmp    *0x7fa2(%rip)        # 9028 <memset@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fputc@plt>:
+    1090:	ff 25 9a 7f 00 00    	jmp    *0x7f9a(%rip)        # 9030 <fputc@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcmp@plt>:
+    10a0:	ff 25 92 7f 00 00    	jmp    *0x7f92(%rip)        # 9038 <memcmp@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <fprintf@plt>:
+    10b0:	ff 25 8a 7f 00 00    	jmp    *0x7f8a(%rip)        # 9040 <fprintf@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <memcpy@plt>:
+    10c0:	ff 25 82 7f 00 00    	jmp    *0x7f82(%rip)        # 9048 <memcpy@GLIBC_2.14>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <realloc@plt>:
+    10d0:	ff 25 7a 7f 00 00    	jmp    *0x7f7a(%rip)        # 9050 <realloc@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010e0 <memmove@plt>:
+    10e0:	ff 25 72 7f 00 00    	jmp    *0x7f72(%rip)        # 9058 <memmove@GLIBC_2.2.5>
+    10e6:	68 0b 00 00 00       	push   $0xb
+    10eb:	e9 30 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010f0 <__cxa_finalize@plt>:
+    10f0:	ff 25 d2 7e 00 00    	jmp    *0x7ed2(%rip)        # 8fc8 <__cxa_finalize@GLIBC_2.2.5>
+    10f6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+0000000000001100 <_start>:
+    1100:	31 ed                	xor    %ebp,%ebp
+    1102:	49 89 d1             	mov    %rdx,%r9
+    1105:	5e                   	pop    %rsi
+    1106:	48 89 e2             	mov    %rsp,%rdx
+    1109:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    110d:	50                   	push   %rax
+    110e:	54                   	push   %rsp
+    110f:	45 31 c0             	xor    %r8d,%r8d
+    1112:	31 c9                	xor    %ecx,%ecx
+    1114:	48 8d 3d 5c 05 00 00 	lea    0x55c(%rip),%rdi        # 1677 <main>
+    111b:	ff 15 87 7e 00 00    	call   *0x7e87(%rip)        # 8fa8 <__libc_start_main@GLIBC_2.34>
+    1121:	f4                   	hlt
+    1122:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1129:	00 00 00 
+    112c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001130 <deregister_tm_clones>:
+    1130:	    48 8d 3d 39 7f 00 00 	lea    0x7f39(%rip),%rdi        # 9070 <__TMC_END__>
+    1137:	    48 8d 05 32 7f 00 00 	lea    0x7f32(%rip),%rax        # 9070 <__TMC_END__>
+    113e:	    48 39 f8             	cmp    %rdi,%rax
+    1141:	/-- 74 15                	je     1158 <deregister_tm_clones+0x28>
+    1143:	|   48 8b 05 66 7e 00 00 	mov    0x7e66(%rip),%rax        # 8fb0 <_ITM_deregisterTMCloneTable@Base>
+    114a:	|   48 85 c0             	test   %rax,%rax
+    114d:	+-- 74 09                	je     1158 <deregister_tm_clones+0x28>
+    114f:	|   ff e0                	jmp    *%rax
+    1151:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1158:	\-> c3                   	ret
+    1159:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001160 <register_tm_clones>:
+    1160:	    48 8d 3d 09 7f 00 00 	lea    0x7f09(%rip),%rdi        # 9070 <__TMC_END__>
+    1167:	    48 8d 35 02 7f 00 00 	lea    0x7f02(%rip),%rsi        # 9070 <__TMC_END__>
+    116e:	    48 29 fe             	sub    %rdi,%rsi
+    1171:	    48 89 f0             	mov    %rsi,%rax
+    1174:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1178:	    48 c1 f8 03          	sar    $0x3,%rax
+    117c:	    48 01 c6             	add    %rax,%rsi
+    117f:	    48 d1 fe             	sar    %rsi
+    1182:	/-- 74 14                	je     1198 <register_tm_clones+0x38>
+    1184:	|   48 8b 05 35 7e 00 00 	mov    0x7e35(%rip),%rax        # 8fc0 <_ITM_registerTMCloneTable@Base>
+    118b:	|   48 85 c0             	test   %rax,%rax
+    118e:	+-- 74 08                	je     1198 <register_tm_clones+0x38>
+    1190:	|   ff e0                	jmp    *%rax
+    1192:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1198:	\-> c3                   	ret
+    1199:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011a0 <__do_global_dtors_aux>:
+    11a0:	       f3 0f 1e fa          	endbr64
+    11a4:	       80 3d dd 7e 00 00 00 	cmpb   $0x0,0x7edd(%rip)        # 9088 <completed.0>
+    11ab:	/----- 75 2b                	jne    11d8 <__do_global_dtors_aux+0x38>
+    11ad:	|      55                   	push   %rbp
+    11ae:	|      48 83 3d 12 7e 00 00 	cmpq   $0x0,0x7e12(%rip)        # 8fc8 <__cxa_finalize@GLIBC_2.2.5>
+    11b5:	|      00 
+    11b6:	|      48 89 e5             	mov    %rsp,%rbp
+    11b9:	|  /-- 74 0c                	je     11c7 <__do_global_dtors_aux+0x27>
+    11bb:	|  |   48 8b 3d a6 7e 00 00 	mov    0x7ea6(%rip),%rdi        # 9068 <__dso_handle>
+    11c2:	|  |   e8 29 ff ff ff       	call   10f0 <__cxa_finalize@plt>
+    11c7:	|  \-> e8 64 ff ff ff       	call   1130 <deregister_tm_clones>
+    11cc:	|      c6 05 b5 7e 00 00 01 	movb   $0x1,0x7eb5(%rip)        # 9088 <completed.0>
+    11d3:	|      5d                   	pop    %rbp
+    11d4:	|      c3                   	ret
+    11d5:	|      0f 1f 00             	nopl   (%rax)
+    11d8:	\----> c3                   	ret
+    11d9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011e0 <frame_dummy>:
+    11e0:	f3 0f 1e fa          	endbr64
+    11e4:	e9 77 ff ff ff       	jmp    1160 <register_tm_clones>
+    11e9:	90                   	nop
+
+00000000000011ea <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    11ea:	55                   	push   %rbp
+    11eb:	48 89 e5             	mov    %rsp,%rbp
+    11ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11f2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    11f5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11fa:	5d                   	pop    %rbp
+    11fb:	c3                   	ret
+
+00000000000011fc <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    11fc:	55                   	push   %rbp
+    11fd:	48 89 e5             	mov    %rsp,%rbp
+    1200:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1204:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1207:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return -1;
+    120b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1210:	5d                   	pop    %rbp
+    1211:	c3                   	ret
+
+0000000000001212 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    1212:	55                   	push   %rbp
+    1213:	48 89 e5             	mov    %rsp,%rbp
+    1216:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    121a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    121d:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    return -1;
+    1220:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1225:	5d                   	pop    %rbp
+    1226:	c3                   	ret
+
+0000000000001227 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    1227:	55                   	push   %rbp
+    1228:	48 89 e5             	mov    %rsp,%rbp
+    122b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    122f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1232:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    1235:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    return -1;
+    1238:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    123d:	5d                   	pop    %rbp
+    123e:	c3                   	ret
+
+000000000000123f <_read_r>:
+int _read_r(struct _reent *, int) {
+    123f:	55                   	push   %rbp
+    1240:	48 89 e5             	mov    %rsp,%rbp
+    1243:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1247:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    124a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    124f:	5d                   	pop    %rbp
+    1250:	c3                   	ret
+
+0000000000001251 <_write_r>:
+int _write_r(struct _reent *, int, char *, int) {
+    1251:	55                   	push   %rbp
+    1252:	48 89 e5             	mov    %rsp,%rbp
+    1255:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1259:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    125c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1260:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+    return -1;
+    1263:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1268:	5d                   	pop    %rbp
+    1269:	c3                   	ret
+
+000000000000126a <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    126a:	55                   	push   %rbp
+    126b:	48 89 e5             	mov    %rsp,%rbp
+    126e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return -1;
+    1272:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1277:	5d                   	pop    %rbp
+    1278:	c3                   	ret
+
+0000000000001279 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1279:	55                   	push   %rbp
+    127a:	48 89 e5             	mov    %rsp,%rbp
+    127d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1281:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1284:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1289:	5d                   	pop    %rbp
+    128a:	c3                   	ret
+
+000000000000128b <next_rand(unsigned int&)>:
+#include <stdlib.h> // qsort
+
+static constexpr nel::Count n_values = 1000 * 1000;
+
+static unsigned int next_rand(unsigned int &s)
+{
+    128b:	55                   	push   %rbp
+    128c:	48 89 e5             	mov    %rsp,%rbp
+    128f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    s ^= s << 13;
+    1293:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1297:	8b 10                	mov    (%rax),%edx
+    1299:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    129d:	8b 00                	mov    (%rax),%eax
+    129f:	c1 e0 0d             	shl    $0xd,%eax
+    12a2:	31 c2                	xor    %eax,%edx
+    12a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12a8:	89 10                	mov    %edx,(%rax)
+    s ^= s >> 17;
+    12aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12ae:	8b 10                	mov    (%rax),%edx
+    12b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12b4:	8b 00                	mov    (%rax),%eax
+    12b6:	c1 e8 11             	shr    $0x11,%eax
+    12b9:	31 c2                	xor    %eax,%edx
+    12bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12bf:	89 10                	mov    %edx,(%rax)
+    s ^= s << 5;
+    12c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12c5:	8b 10                	mov    (%rax),%edx
+    12c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12cb:	8b 00                	mov    (%rax),%eax
+    12cd:	c1 e0 05             	shl    $0x5,%eax
+    12d0:	31 c2                	xor    %eax,%edx
+    12d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12d6:	89 10                	mov    %edx,(%rax)
+    return s;
+    12d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12dc:	8b 00                	mov    (%rax),%eax
+}
+    12de:	5d                   	pop    %rbp
+    12df:	c3                   	ret
+
+00000000000012e0 <fill(nel::Slice<int> const&, int)>:
+
+static void fill(nel::Slice<int> const &s, int const pat)
+{
+    12e0:	                         55                   	push   %rbp
+    12e1:	                         48 89 e5             	mov    %rsp,%rbp
+    12e4:	                         48 83 ec 40          	sub    $0x40,%rsp
+    12e8:	                         48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    12ec:	                         89 75 c4             	mov    %esi,-0x3c(%rbp)
+    unsigned int seed = 0x12345678;
+    12ef:	                         c7 45 d8 78 56 34 12 	movl   $0x12345678,-0x28(%rbp)
+    int *const p = s.ptr();
+    12f6:	                         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    12fa:	                         48 89 c7             	mov    %rax,%rdi
+    12fd:	                         e8 8a 11 00 00       	call   248c <nel::Slice<int>::ptr() const>
+    1302:	                         48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nel::Length const n = s.len();
+    1306:	                         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    130a:	                         48 89 c7             	mov    %rax,%rdi
+    130d:	                         e8 56 10 00 00       	call   2368 <nel::Slice<int>::len() const>
+    1312:	                         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (nel::Index i = 0; i < n; ++i) {
+    1316:	                         48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    131d:	                         00 
+    131e:	   /-------------------- e9 ab 01 00 00       	jmp    14ce <fill(nel::Slice<int> const&, int)+0x1ee>
+        switch (pat) {
+    1323:	/--|-------------------> 83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+    1327:	|  |        /----------- 0f 84 9f 00 00 00    	je     13cc <fill(nel::Slice<int> const&, int)+0xec>
+    132d:	|  |        |            83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+    1331:	|  |     /--|----------- 0f 8f c2 00 00 00    	jg     13f9 <fill(nel::Slice<int> const&, int)+0x119>
+    1337:	|  |     |  |            83 7d c4 02          	cmpl   $0x2,-0x3c(%rbp)
+    133b:	|  |     |  |  /-------- 74 69                	je     13a6 <fill(nel::Slice<int> const&, int)+0xc6>
+    133d:	|  |     |  |  |         83 7d c4 02          	cmpl   $0x2,-0x3c(%rbp)
+    1341:	|  |     +--|--|-------- 0f 8f b2 00 00 00    	jg     13f9 <fill(nel::Slice<int> const&, int)+0x119>
+    1347:	|  |     |  |  |         83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+    134b:	|  |     |  |  |     /-- 74 0b                	je     1358 <fill(nel::Slice<int> const&, int)+0x78>
+    134d:	|  |     |  |  |     |   83 7d c4 01          	cmpl   $0x1,-0x3c(%rbp)
+    1351:	|  |     |  |  |  /--|-- 74 35                	je     1388 <fill(nel::Slice<int> const&, int)+0xa8>
+    1353:	|  |     +--|--|--|--|-- e9 a1 00 00 00       	jmp    13f9 <fill(nel::Slice<int> const&, int)+0x119>
+            case 0:
+                p[i] = int(next_rand(seed) & 0x7fffffff);
+    1358:	|  |     |  |  |  |  \-> 48 8d 45 d8          	lea    -0x28(%rbp),%rax
+    135c:	|  |     |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    135f:	|  |     |  |  |  |      e8 27 ff ff ff       	call   128b <next_rand(unsigned int&)>
+    1364:	|  |     |  |  |  |      89 c1                	mov    %eax,%ecx
+    1366:	|  |     |  |  |  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    136a:	|  |     |  |  |  |      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1371:	|  |     |  |  |  |      00 
+    1372:	|  |     |  |  |  |      48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1376:	|  |     |  |  |  |      48 01 d0             	add    %rdx,%rax
+    1379:	|  |     |  |  |  |      81 e1 ff ff ff 7f    	and    $0x7fffffff,%ecx
+    137f:	|  |     |  |  |  |      89 ca                	mov    %ecx,%edx
+    1381:	|  |     |  |  |  |      89 10                	mov    %edx,(%rax)
+                break;
+    1383:	|  |  /--|--|--|--|----- e9 41 01 00 00       	jmp    14c9 <fill(nel::Slice<int> const&, int)+0x1e9>
+            case 1:
+                p[i] = int(i);
+    1388:	|  |  |  |  |  |  \----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    138c:	|  |  |  |  |  |         48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1393:	|  |  |  |  |  |         00 
+    1394:	|  |  |  |  |  |         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1398:	|  |  |  |  |  |         48 01 d0             	add    %rdx,%rax
+    139b:	|  |  |  |  |  |         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    139f:	|  |  |  |  |  |         89 10                	mov    %edx,(%rax)
+                break;
+    13a1:	|  |  +--|--|--|-------- e9 23 01 00 00       	jmp    14c9 <fill(nel::Slice<int> const&, int)+0x1e9>
+            case 2:
+                p[i] = int(n - i);
+    13a6:	|  |  |  |  |  \-------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13aa:	|  |  |  |  |            89 c2                	mov    %eax,%edx
+    13ac:	|  |  |  |  |            48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13b0:	|  |  |  |  |            29 c2                	sub    %eax,%edx
+    13b2:	|  |  |  |  |            48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13b6:	|  |  |  |  |            48 8d 0c 85 00 00 00 	lea    0x0(,%rax,4),%rcx
+    13bd:	|  |  |  |  |            00 
+    13be:	|  |  |  |  |            48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13c2:	|  |  |  |  |            48 01 c8             	add    %rcx,%rax
+    13c5:	|  |  |  |  |            89 10                	mov    %edx,(%rax)
+                break;
+    13c7:	|  |  +--|--|----------- e9 fd 00 00 00       	jmp    14c9 <fill(nel::Slice<int> const&, int)+0x1e9>
+            case 3:
+                p[i] = int(next_rand(seed) % 16);
+    13cc:	|  |  |  |  \----------> 48 8d 45 d8          	lea    -0x28(%rbp),%rax
+    13d0:	|  |  |  |               48 89 c7             	mov    %rax,%rdi
+    13d3:	|  |  |  |               e8 b3 fe ff ff       	call   128b <next_rand(unsigned int&)>
+    13d8:	|  |  |  |               89 c1                	mov    %eax,%ecx
+    13da:	|  |  |  |               48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13de:	|  |  |  |               48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    13e5:	|  |  |  |               00 
+    13e6:	|  |  |  |               48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13ea:	|  |  |  |               48 01 d0             	add    %rdx,%rax
+    13ed:	|  |  |  |               83 e1 0f             	and    $0xf,%ecx
+    13f0:	|  |  |  |               89 ca                	mov    %ecx,%edx
+    13f2:	|  |  |  |               89 10                	mov    %edx,(%rax)
+                break;
+    13f4:	|  |  +--|-------------- e9 d0 00 00 00       	jmp    14c9 <fill(nel::Slice<int> const&, int)+0x1e9>
+            default:
+                // sorted, with 1% of items swapped at random.
+                p[i] = int(i);
+    13f9:	|  |  |  \-------------> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13fd:	|  |  |                  48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1404:	|  |  |                  00 
+    1405:	|  |  |                  48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1409:	|  |  |                  48 01 d0             	add    %rdx,%rax
+    140c:	|  |  |                  48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1410:	|  |  |                  89 10                	mov    %edx,(%rax)
+                if (i % 100 == 99) {
+    1412:	|  |  |                  48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1416:	|  |  |                  48 89 c8             	mov    %rcx,%rax
+    1419:	|  |  |                  48 c1 e8 02          	shr    $0x2,%rax
+    141d:	|  |  |                  48 ba c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rdx
+    1424:	|  |  |                  c2 f5 28 
+    1427:	|  |  |                  48 f7 e2             	mul    %rdx
+    142a:	|  |  |                  48 c1 ea 02          	shr    $0x2,%rdx
+    142e:	|  |  |                  48 89 d0             	mov    %rdx,%rax
+    1431:	|  |  |                  48 c1 e0 02          	shl    $0x2,%rax
+    1435:	|  |  |                  48 01 d0             	add    %rdx,%rax
+    1438:	|  |  |                  48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    143f:	|  |  |                  00 
+    1440:	|  |  |                  48 01 d0             	add    %rdx,%rax
+    1443:	|  |  |                  48 c1 e0 02          	shl    $0x2,%rax
+    1447:	|  |  |                  48 29 c1             	sub    %rax,%rcx
+    144a:	|  |  |                  48 89 ca             	mov    %rcx,%rdx
+    144d:	|  |  |                  48 83 fa 63          	cmp    $0x63,%rdx
+    1451:	|  |  |              /-- 75 75                	jne    14c8 <fill(nel::Slice<int> const&, int)+0x1e8>
+                    nel::Index const j = next_rand(seed) % n;
+    1453:	|  |  |              |   48 8d 45 d8          	lea    -0x28(%rbp),%rax
+    1457:	|  |  |              |   48 89 c7             	mov    %rax,%rdi
+    145a:	|  |  |              |   e8 2c fe ff ff       	call   128b <next_rand(unsigned int&)>
+    145f:	|  |  |              |   89 c0                	mov    %eax,%eax
+    1461:	|  |  |              |   ba 00 00 00 00       	mov    $0x0,%edx
+    1466:	|  |  |              |   48 f7 75 e8          	divq   -0x18(%rbp)
+    146a:	|  |  |              |   48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+                    int const t = p[i];
+    146e:	|  |  |              |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1472:	|  |  |              |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1479:	|  |  |              |   00 
+    147a:	|  |  |              |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    147e:	|  |  |              |   48 01 d0             	add    %rdx,%rax
+    1481:	|  |  |              |   8b 00                	mov    (%rax),%eax
+    1483:	|  |  |              |   89 45 dc             	mov    %eax,-0x24(%rbp)
+                    p[i] = p[j];
+    1486:	|  |  |              |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    148a:	|  |  |              |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1491:	|  |  |              |   00 
+    1492:	|  |  |              |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1496:	|  |  |              |   48 01 d0             	add    %rdx,%rax
+    1499:	|  |  |              |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    149d:	|  |  |              |   48 8d 0c 95 00 00 00 	lea    0x0(,%rdx,4),%rcx
+    14a4:	|  |  |              |   00 
+    14a5:	|  |  |              |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    14a9:	|  |  |              |   48 01 ca             	add    %rcx,%rdx
+    14ac:	|  |  |              |   8b 00                	mov    (%rax),%eax
+    14ae:	|  |  |              |   89 02                	mov    %eax,(%rdx)
+                    p[j] = t;
+    14b0:	|  |  |              |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    14b4:	|  |  |              |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    14bb:	|  |  |              |   00 
+    14bc:	|  |  |              |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14c0:	|  |  |              |   48 01 c2             	add    %rax,%rdx
+    14c3:	|  |  |              |   8b 45 dc             	mov    -0x24(%rbp),%eax
+    14c6:	|  |  |              |   89 02                	mov    %eax,(%rdx)
+                }
+                break;
+    14c8:	|  |  |              \-> 90                   	nop
+    for (nel::Index i = 0; i < n; ++i) {
+    14c9:	|  |  \----------------> 48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    14ce:	|  \-------------------> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14d2:	|                        48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+    14d6:	\----------------------- 0f 82 47 fe ff ff    	jb     1323 <fill(nel::Slice<int> const&, int)+0x43>
+        }
+    }
+}
+    14dc:	                         90                   	nop
+    14dd:	                         90                   	nop
+    14de:	                         c9                   	leave
+    14df:	                         c3                   	ret
+
+00000000000014e0 <cmp_int(void const*, void const*)>:
+static char const *const pat_names[] = {
+    "random", "sorted", "reversed", "16 distinct", "1% unsorted",
+};
+
+static int cmp_int(void const *a, void const *b)
+{
+    14e0:	55                   	push   %rbp
+    14e1:	48 89 e5             	mov    %rsp,%rbp
+    14e4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    14e8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    int const x = *static_cast<int const *>(a);
+    14ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14f0:	8b 00                	mov    (%rax),%eax
+    14f2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    int const y = *static_cast<int const *>(b);
+    14f5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    14f9:	8b 00                	mov    (%rax),%eax
+    14fb:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    return (x > y) - (x < y);
+    14fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1501:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+    1504:	0f 9f c0             	setg   %al
+    1507:	0f b6 d0             	movzbl %al,%edx
+    150a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    150d:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+    1510:	0f 9c c0             	setl   %al
+    1513:	0f b6 c0             	movzbl %al,%eax
+    1516:	29 c2                	sub    %eax,%edx
+    1518:	89 d0                	mov    %edx,%eax
+}
+    151a:	5d                   	pop    %rbp
+    151b:	c3                   	ret
+
+000000000000151c <main::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const>:
+    nel::Slice<int> const scratch = b.slice();
+
+    for (int pat = 0; pat < 5; ++pat) {
+        nel::log << pat_names[pat] << ", " << n_values << " ints\n";
+        run("  qsort                  ", s, pat,
+            [](nel::Slice<int> const &s) { qsort(s.ptr(), s.len(), sizeof(int), cmp_int); });
+    151c:	55                   	push   %rbp
+    151d:	48 89 e5             	mov    %rsp,%rbp
+    1520:	53                   	push   %rbx
+    1521:	48 83 ec 18          	sub    $0x18,%rsp
+    1525:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1529:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    152d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1531:	48 89 c7             	mov    %rax,%rdi
+    1534:	e8 2f 0e 00 00       	call   2368 <nel::Slice<int>::len() const>
+    1539:	48 89 c3             	mov    %rax,%rbx
+    153c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1540:	48 89 c7             	mov    %rax,%rdi
+    1543:	e8 44 0f 00 00       	call   248c <nel::Slice<int>::ptr() const>
+    1548:	48 89 c7             	mov    %rax,%rdi
+    154b:	48 8d 05 8e ff ff ff 	lea    -0x72(%rip),%rax        # 14e0 <cmp_int(void const*, void const*)>
+    1552:	48 89 c1             	mov    %rax,%rcx
+    1555:	ba 04 00 00 00       	mov    $0x4,%edx
+    155a:	48 89 de             	mov    %rbx,%rsi
+    155d:	e8 ee fa ff ff       	call   1050 <qsort@plt>
+    1562:	90                   	nop
+    1563:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1567:	c9                   	leave
+    1568:	c3                   	ret
+    1569:	90                   	nop
+
+000000000000156a <main::{lambda(nel::Slice<int>)#2}::operator()(nel::Slice<int>) const>:
+        run("  sort_unstable          ", s, pat,
+            [](nel::Slice<int> s) { s.sort_unstable(); });
+    156a:	55                   	push   %rbp
+    156b:	48 89 e5             	mov    %rsp,%rbp
+    156e:	48 83 ec 20          	sub    $0x20,%rsp
+    1572:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1576:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    157a:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    157e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1582:	48 89 d6             	mov    %rdx,%rsi
+    1585:	48 89 c7             	mov    %rax,%rdi
+    1588:	e8 5d 11 00 00       	call   26ea <void nel::Slice<int>::sort_unstable<nel::sort::Less>(nel::sort::Less&&)>
+    158d:	90                   	nop
+    158e:	c9                   	leave
+    158f:	c3                   	ret
+
+0000000000001590 <main::{lambda(nel::Slice<int>)#3}::operator()(nel::Slice<int>) const>:
+        run("  sort, in place         ", s, pat, [](nel::Slice<int> s) { s.sort(); });
+    1590:	55                   	push   %rbp
+    1591:	48 89 e5             	mov    %rsp,%rbp
+    1594:	48 83 ec 20          	sub    $0x20,%rsp
+    1598:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    159c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    15a0:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    15a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    15a8:	48 89 d6             	mov    %rdx,%rsi
+    15ab:	48 89 c7             	mov    %rax,%rdi
+    15ae:	e8 7f 11 00 00       	call   2732 <void nel::Slice<int>::sort<nel::sort::Less>(nel::sort::Less&&)>
+    15b3:	90                   	nop
+    15b4:	c9                   	leave
+    15b5:	c3                   	ret
+
+00000000000015b6 <main::{lambda(nel::Slice<int>)#4}::operator()(nel::Slice<int>) const>:
+        run("  sort_with, n/2 scratch ", s, pat,
+            [&scratch](nel::Slice<int> s) { s.sort_with(scratch); });
+    15b6:	55                   	push   %rbp
+    15b7:	48 89 e5             	mov    %rsp,%rbp
+    15ba:	48 83 ec 20          	sub    $0x20,%rsp
+    15be:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    15c2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    15c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15ca:	48 8b 08             	mov    (%rax),%rcx
+    15cd:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    15d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    15d5:	48 89 ce             	mov    %rcx,%rsi
+    15d8:	48 89 c7             	mov    %rax,%rdi
+    15db:	e8 a2 11 00 00       	call   2782 <void nel::Slice<int>::sort_with<nel::sort::Less>(nel::Slice<int> const&, nel::sort::Less&&)>
+    15e0:	90                   	nop
+    15e1:	c9                   	leave
+    15e2:	c3                   	ret
+    15e3:	90                   	nop
+
+00000000000015e4 <main::{lambda()#5}::operator()() const>:
+    }
+
+    // the 1000 smallest, and the median, of random ints.
+    {
+        fill(s, 0);
+        auto t = bench::time_ns([&s]() { nel::Slice<int>(s).partial_sort(1000); });
+    15e4:	55                   	push   %rbp
+    15e5:	48 89 e5             	mov    %rsp,%rbp
+    15e8:	48 83 ec 30          	sub    $0x30,%rsp
+    15ec:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    15f0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    15f4:	48 8b 00             	mov    (%rax),%rax
+    15f7:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    15fb:	48 8b 00             	mov    (%rax),%rax
+    15fe:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1602:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1606:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    160a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    160e:	be e8 03 00 00       	mov    $0x3e8,%esi
+    1613:	48 89 c7             	mov    %rax,%rdi
+    1616:	e8 dd 11 00 00       	call   27f8 <void nel::Slice<int>::partial_sort<nel::sort::Less>(unsigned long, nel::sort::Less&&)>
+    161b:	90                   	nop
+    161c:	c9                   	leave
+    161d:	c3                   	ret
+
+000000000000161e <main::{lambda()#6}::operator()() const>:
+    }
+    {
+        fill(s, 0);
+        int m = 0;
+        auto t = bench::time_ns(
+            [&s, &m]() { m = nel::Slice<int>(s).select_nth_unstable(s.len() / 2); });
+    161e:	55                   	push   %rbp
+    161f:	48 89 e5             	mov    %rsp,%rbp
+    1622:	48 83 ec 30          	sub    $0x30,%rsp
+    1626:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    162a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    162e:	48 8b 00             	mov    (%rax),%rax
+    1631:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1635:	48 8b 00             	mov    (%rax),%rax
+    1638:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    163c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1640:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1644:	48 8b 00             	mov    (%rax),%rax
+    1647:	48 89 c7             	mov    %rax,%rdi
+    164a:	e8 19 0d 00 00       	call   2368 <nel::Slice<int>::len() const>
+    164f:	48 d1 e8             	shr    %rax
+    1652:	48 89 c1             	mov    %rax,%rcx
+    1655:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    1659:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    165d:	48 89 ce             	mov    %rcx,%rsi
+    1660:	48 89 c7             	mov    %rax,%rdi
+    1663:	e8 2c 12 00 00       	call   2894 <int& nel::Slice<int>::select_nth_unstable<nel::sort::Less>(unsigned long, nel::sort::Less&&)>
+    1668:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    166c:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+    1670:	8b 00                	mov    (%rax),%eax
+    1672:	89 02                	mov    %eax,(%rdx)
+    1674:	90                   	nop
+    1675:	c9                   	leave
+    1676:	c3                   	ret
+
+0000000000001677 <main>:
+{
+    1677:	       55                   	push   %rbp
+    1678:	       48 89 e5             	mov    %rsp,%rbp
+    167b:	       48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+    auto v = nel::heaped::Vector<int>::with_capacity(n_values);
+    1682:	       48 8d 85 48 ff ff ff 	lea    -0xb8(%rbp),%rax
+    1689:	       be 40 42 0f 00       	mov    $0xf4240,%esi
+    168e:	       48 89 c7             	mov    %rax,%rdi
+    1691:	       e8 07 0e 00 00       	call   249d <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+    auto b = nel::heaped::Vector<int>::with_capacity(n_values / 2);
+    1696:	       48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+    169d:	       be 20 a1 07 00       	mov    $0x7a120,%esi
+    16a2:	       48 89 c7             	mov    %rax,%rdi
+    16a5:	       e8 f3 0d 00 00       	call   249d <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+    for (nel::Index i = 0; i < n_values; ++i) {
+    16aa:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    16b1:	       00 
+    16b2:	   /-- eb 79                	jmp    172d <main+0xb6>
+        v.push(0).unwrap();
+    16b4:	/--|-> c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%rbp)
+    16bb:	|  |   00 00 00 
+    16be:	|  |   48 8d 85 54 ff ff ff 	lea    -0xac(%rbp),%rax
+    16c5:	|  |   48 8d 95 5c ff ff ff 	lea    -0xa4(%rbp),%rdx
+    16cc:	|  |   48 8d 8d 48 ff ff ff 	lea    -0xb8(%rbp),%rcx
+    16d3:	|  |   48 89 ce             	mov    %rcx,%rsi
+    16d6:	|  |   48 89 c7             	mov    %rax,%rdi
+    16d9:	|  |   e8 46 0e 00 00       	call   2524 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>
+    16de:	|  |   48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+    16e5:	|  |   b9 56 00 00 00       	mov    $0x56,%ecx
+    16ea:	|  |   48 8d 15 7e 49 00 00 	lea    0x497e(%rip),%rdx        # 606f <n_values+0x37>
+    16f1:	|  |   48 8d 35 8e 49 00 00 	lea    0x498e(%rip),%rsi        # 6086 <n_values+0x4e>
+    16f8:	|  |   48 89 c7             	mov    %rax,%rdi
+    16fb:	|  |   e8 aa 0a 00 00       	call   21aa <nel::Context::Context(char const*, char const*, int)>
+    1700:	|  |   48 8d 95 60 ff ff ff 	lea    -0xa0(%rbp),%rdx
+    1707:	|  |   48 8d 85 54 ff ff ff 	lea    -0xac(%rbp),%rax
+    170e:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1711:	|  |   48 89 c7             	mov    %rax,%rdi
+    1714:	|  |   e8 4b 0f 00 00       	call   2664 <nel::Result<void, int>::unwrap(nel::Context const&)>
+    1719:	|  |   48 8d 85 54 ff ff ff 	lea    -0xac(%rbp),%rax
+    1720:	|  |   48 89 c7             	mov    %rax,%rdi
+    1723:	|  |   e8 86 0e 00 00       	call   25ae <nel::Result<void, int>::~Result()>
+    for (nel::Index i = 0; i < n_values; ++i) {
+    1728:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    172d:	|  \-> 48 81 7d f8 3f 42 0f 	cmpq   $0xf423f,-0x8(%rbp)
+    1734:	|      00 
+    1735:	\----- 0f 86 79 ff ff ff    	jbe    16b4 <main+0x3d>
+    for (nel::Index i = 0; i < n_values / 2; ++i) {
+    173b:	       48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1742:	       00 
+    1743:	   /-- eb 64                	jmp    17a9 <main+0x132>
+        b.push(0).unwrap();
+    1745:	/--|-> c7 45 8c 00 00 00 00 	movl   $0x0,-0x74(%rbp)
+    174c:	|  |   48 8d 45 84          	lea    -0x7c(%rbp),%rax
+    1750:	|  |   48 8d 55 8c          	lea    -0x74(%rbp),%rdx
+    1754:	|  |   48 8d 8d 40 ff ff ff 	lea    -0xc0(%rbp),%rcx
+    175b:	|  |   48 89 ce             	mov    %rcx,%rsi
+    175e:	|  |   48 89 c7             	mov    %rax,%rdi
+    1761:	|  |   e8 be 0d 00 00       	call   2524 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>
+    1766:	|  |   48 8d 45 90          	lea    -0x70(%rbp),%rax
+    176a:	|  |   b9 59 00 00 00       	mov    $0x59,%ecx
+    176f:	|  |   48 8d 15 f9 48 00 00 	lea    0x48f9(%rip),%rdx        # 606f <n_values+0x37>
+    1776:	|  |   48 8d 35 09 49 00 00 	lea    0x4909(%rip),%rsi        # 6086 <n_values+0x4e>
+    177d:	|  |   48 89 c7             	mov    %rax,%rdi
+    1780:	|  |   e8 25 0a 00 00       	call   21aa <nel::Context::Context(char const*, char const*, int)>
+    1785:	|  |   48 8d 55 90          	lea    -0x70(%rbp),%rdx
+    1789:	|  |   48 8d 45 84          	lea    -0x7c(%rbp),%rax
+    178d:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1790:	|  |   48 89 c7             	mov    %rax,%rdi
+    1793:	|  |   e8 cc 0e 00 00       	call   2664 <nel::Result<void, int>::unwrap(nel::Context const&)>
+    1798:	|  |   48 8d 45 84          	lea    -0x7c(%rbp),%rax
+    179c:	|  |   48 89 c7             	mov    %rax,%rdi
+    179f:	|  |   e8 0a 0e 00 00       	call   25ae <nel::Result<void, int>::~Result()>
+    for (nel::Index i = 0; i < n_values / 2; ++i) {
+    17a4:	|  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    17a9:	|  \-> 48 81 7d f0 1f a1 07 	cmpq   $0x7a11f,-0x10(%rbp)
+    17b0:	|      00 
+    17b1:	\----- 76 92                	jbe    1745 <main+0xce>
+    nel::Slice<int> const s = v.slice();
+    17b3:	       48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    17ba:	       48 8d 95 48 ff ff ff 	lea    -0xb8(%rbp),%rdx
+    17c1:	       48 89 d6             	mov    %rdx,%rsi
+    17c4:	       48 89 c7             	mov    %rax,%rdi
+    17c7:	       e8 ae 0b 00 00       	call   237a <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()>
+    nel::Slice<int> const scratch = b.slice();
+    17cc:	       48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+    17d3:	       48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+    17da:	       48 89 d6             	mov    %rdx,%rsi
+    17dd:	       48 89 c7             	mov    %rax,%rdi
+    17e0:	       e8 95 0b 00 00       	call   237a <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()>
+    for (int pat = 0; pat < 5; ++pat) {
+    17e5:	       c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    17ec:	/----- e9 f0 00 00 00       	jmp    18e1 <main+0x26a>
+        nel::log << pat_names[pat] << ", " << n_values << " ints\n";
+    17f1:	|  /-> 8b 45 ec             	mov    -0x14(%rbp),%eax
+    17f4:	|  |   48 98                	cltq
+    17f6:	|  |   48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    17fd:	|  |   00 
+    17fe:	|  |   48 8d 05 9b 75 00 00 	lea    0x759b(%rip),%rax        # 8da0 <pat_names>
+    1805:	|  |   48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1809:	|  |   48 89 c6             	mov    %rax,%rsi
+    180c:	|  |   48 8d 05 76 78 00 00 	lea    0x7876(%rip),%rax        # 9089 <nel::log>
+    1813:	|  |   48 89 c7             	mov    %rax,%rdi
+    1816:	|  |   e8 5a 40 00 00       	call   5875 <nel::operator<<(nel::Log&, char const*)>
+    181b:	|  |   48 89 c2             	mov    %rax,%rdx
+    181e:	|  |   48 8d 05 66 48 00 00 	lea    0x4866(%rip),%rax        # 608b <n_values+0x53>
+    1825:	|  |   48 89 c6             	mov    %rax,%rsi
+    1828:	|  |   48 89 d7             	mov    %rdx,%rdi
+    182b:	|  |   e8 45 40 00 00       	call   5875 <nel::operator<<(nel::Log&, char const*)>
+    1830:	|  |   be 40 42 0f 00       	mov    $0xf4240,%esi
+    1835:	|  |   48 89 c7             	mov    %rax,%rdi
+    1838:	|  |   e8 43 41 00 00       	call   5980 <nel::operator<<(nel::Log&, unsigned long)>
+    183d:	|  |   48 89 c2             	mov    %rax,%rdx
+    1840:	|  |   48 8d 05 47 48 00 00 	lea    0x4847(%rip),%rax        # 608e <n_values+0x56>
+    1847:	|  |   48 89 c6             	mov    %rax,%rsi
+    184a:	|  |   48 89 d7             	mov    %rdx,%rdi
+    184d:	|  |   e8 23 40 00 00       	call   5875 <nel::operator<<(nel::Log&, char const*)>
+        run("  qsort                  ", s, pat,
+    1852:	|  |   48 8d 4d ad          	lea    -0x53(%rbp),%rcx
+    1856:	|  |   8b 55 ec             	mov    -0x14(%rbp),%edx
+    1859:	|  |   48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    1860:	|  |   48 89 c6             	mov    %rax,%rsi
+    1863:	|  |   48 8d 05 2b 48 00 00 	lea    0x482b(%rip),%rax        # 6095 <n_values+0x5d>
+    186a:	|  |   48 89 c7             	mov    %rax,%rdi
+    186d:	|  |   e8 c3 01 00 00       	call   1a35 <void run<main::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int> const&)#1}&&)>
+        run("  sort_unstable          ", s, pat,
+    1872:	|  |   48 8d 4d ae          	lea    -0x52(%rbp),%rcx
+    1876:	|  |   8b 55 ec             	mov    -0x14(%rbp),%edx
+    1879:	|  |   48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    1880:	|  |   48 89 c6             	mov    %rax,%rsi
+    1883:	|  |   48 8d 05 25 48 00 00 	lea    0x4825(%rip),%rax        # 60af <n_values+0x77>
+    188a:	|  |   48 89 c7             	mov    %rax,%rdi
+    188d:	|  |   e8 ee 02 00 00       	call   1b80 <void run<main::{lambda(nel::Slice<int>)#2}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#2}&&)>
+        run("  sort, in place         ", s, pat, [](nel::Slice<int> s) { s.sort(); });
+    1892:	|  |   48 8d 4d af          	lea    -0x51(%rbp),%rcx
+    1896:	|  |   8b 55 ec             	mov    -0x14(%rbp),%edx
+    1899:	|  |   48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    18a0:	|  |   48 89 c6             	mov    %rax,%rsi
+    18a3:	|  |   48 8d 05 1f 48 00 00 	lea    0x481f(%rip),%rax        # 60c9 <n_values+0x91>
+    18aa:	|  |   48 89 c7             	mov    %rax,%rdi
+    18ad:	|  |   e8 1a 04 00 00       	call   1ccc <void run<main::{lambda(nel::Slice<int>)#3}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#3}&&)>
+            [&scratch](nel::Slice<int> s) { s.sort_with(scratch); });
+    18b2:	|  |   48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+    18b9:	|  |   48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        run("  sort_with, n/2 scratch ", s, pat,
+    18bd:	|  |   48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+    18c1:	|  |   8b 55 ec             	mov    -0x14(%rbp),%edx
+    18c4:	|  |   48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    18cb:	|  |   48 89 c6             	mov    %rax,%rsi
+    18ce:	|  |   48 8d 05 0e 48 00 00 	lea    0x480e(%rip),%rax        # 60e3 <n_values+0xab>
+    18d5:	|  |   48 89 c7             	mov    %rax,%rdi
+    18d8:	|  |   e8 3b 05 00 00       	call   1e18 <void run<main::{lambda(nel::Slice<int>)#4}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#4}&&)>
+    for (int pat = 0; pat < 5; ++pat) {
+    18dd:	|  |   83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    18e1:	\--|-> 83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+    18e5:	   \-- 0f 8e 06 ff ff ff    	jle    17f1 <main+0x17a>
+        fill(s, 0);
+    18eb:	       48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    18f2:	       be 00 00 00 00       	mov    $0x0,%esi
+    18f7:	       48 89 c7             	mov    %rax,%rdi
+    18fa:	       e8 e1 f9 ff ff       	call   12e0 <fill(nel::Slice<int> const&, int)>
+        auto t = bench::time_ns([&s]() { nel::Slice<int>(s).partial_sort(1000); });
+    18ff:	       48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    1906:	       48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    190a:	       48 8d 45 b8          	lea    -0x48(%rbp),%rax
+    190e:	       48 89 c7             	mov    %rax,%rdi
+    1911:	       e8 11 06 00 00       	call   1f27 <unsigned long bench::time_ns<main::{lambda()#5}>(main::{lambda()#5}&&)>
+    1916:	       48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        bench::report_per_item("random, partial_sort 1000", t, s.len());
+    191a:	       48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    1921:	       48 89 c7             	mov    %rax,%rdi
+    1924:	       e8 3f 0a 00 00       	call   2368 <nel::Slice<int>::len() const>
+    1929:	       48 89 c2             	mov    %rax,%rdx
+    192c:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1930:	       48 89 c6             	mov    %rax,%rsi
+    1933:	       48 8d 05 c3 47 00 00 	lea    0x47c3(%rip),%rax        # 60fd <n_values+0xc5>
+    193a:	       48 89 c7             	mov    %rax,%rdi
+    193d:	       e8 1a 07 00 00       	call   205c <bench::report_per_item(char const*, unsigned long, unsigned long)>
+        fill(s, 0);
+    1942:	       48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    1949:	       be 00 00 00 00       	mov    $0x0,%esi
+    194e:	       48 89 c7             	mov    %rax,%rdi
+    1951:	       e8 8a f9 ff ff       	call   12e0 <fill(nel::Slice<int> const&, int)>
+        int m = 0;
+    1956:	       c7 85 1c ff ff ff 00 	movl   $0x0,-0xe4(%rbp)
+    195d:	       00 00 00 
+            [&s, &m]() { m = nel::Slice<int>(s).select_nth_unstable(s.len() / 2); });
+    1960:	       48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    1967:	       48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    196b:	       48 8d 85 1c ff ff ff 	lea    -0xe4(%rbp),%rax
+    1972:	       48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        auto t = bench::time_ns(
+    1976:	       48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    197a:	       48 89 c7             	mov    %rax,%rdi
+    197d:	       e8 d1 05 00 00       	call   1f53 <unsigned long bench::time_ns<main::{lambda()#6}>(main::{lambda()#6}&&)>
+    1982:	       48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        bench::report_per_item("random, select median    ", t, s.len());
+    1986:	       48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    198d:	       48 89 c7             	mov    %rax,%rdi
+    1990:	       e8 d3 09 00 00       	call   2368 <nel::Slice<int>::len() const>
+    1995:	       48 89 c2             	mov    %rax,%rdx
+    1998:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    199c:	       48 89 c6             	mov    %rax,%rsi
+    199f:	       48 8d 05 71 47 00 00 	lea    0x4771(%rip),%rax        # 6117 <n_values+0xdf>
+    19a6:	       48 89 c7             	mov    %rax,%rdi
+    19a9:	       e8 ae 06 00 00       	call   205c <bench::report_per_item(char const*, unsigned long, unsigned long)>
+        nel::log << "  median: " << m << '\n';
+    19ae:	       48 8d 05 7c 47 00 00 	lea    0x477c(%rip),%rax        # 6131 <n_values+0xf9>
+    19b5:	       48 89 c6             	mov    %rax,%rsi
+    19b8:	       48 8d 05 ca 76 00 00 	lea    0x76ca(%rip),%rax        # 9089 <nel::log>
+    19bf:	       48 89 c7             	mov    %rax,%rdi
+    19c2:	       e8 ae 3e 00 00       	call   5875 <nel::operator<<(nel::Log&, char const*)>
+    19c7:	       48 89 c2             	mov    %rax,%rdx
+    19ca:	       8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+    19d0:	       89 c6                	mov    %eax,%esi
+    19d2:	       48 89 d7             	mov    %rdx,%rdi
+    19d5:	       e8 70 3f 00 00       	call   594a <nel::operator<<(nel::Log&, int)>
+    19da:	       be 0a 00 00 00       	mov    $0xa,%esi
+    19df:	       48 89 c7             	mov    %rax,%rdi
+    19e2:	       e8 62 3e 00 00       	call   5849 <nel::operator<<(nel::Log&, char)>
+    }
+}
+    19e7:	       48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+    19ee:	       48 89 c7             	mov    %rax,%rdi
+    19f1:	       e8 10 0b 00 00       	call   2506 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    19f6:	       48 8d 85 48 ff ff ff 	lea    -0xb8(%rbp),%rax
+    19fd:	       48 89 c7             	mov    %rax,%rdi
+    1a00:	       e8 01 0b 00 00       	call   2506 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    1a05:	       b8 00 00 00 00       	mov    $0x0,%eax
+    1a0a:	       c9                   	leave
+    1a0b:	       c3                   	ret
+
+0000000000001a0c <run<main::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&s, &f]() { f(s); });
+    1a0c:	55                   	push   %rbp
+    1a0d:	48 89 e5             	mov    %rsp,%rbp
+    1a10:	48 83 ec 10          	sub    $0x10,%rsp
+    1a14:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a1c:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1a20:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1a24:	48 8b 12             	mov    (%rdx),%rdx
+    1a27:	48 89 d6             	mov    %rdx,%rsi
+    1a2a:	48 89 c7             	mov    %rax,%rdi
+    1a2d:	e8 ea fa ff ff       	call   151c <main::{lambda(nel::Slice<int> const&)#1}::operator()(nel::Slice<int> const&) const>
+    1a32:	90                   	nop
+    1a33:	c9                   	leave
+    1a34:	c3                   	ret
+
+0000000000001a35 <void run<main::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int> const&)#1}&&)>:
+void run(char const *const name, nel::Slice<int> const &s, int const pat, F &&f)
+    1a35:	             55                   	push   %rbp
+    1a36:	             48 89 e5             	mov    %rsp,%rbp
+    1a39:	             53                   	push   %rbx
+    1a3a:	             48 83 ec 58          	sub    $0x58,%rsp
+    1a3e:	             48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    1a42:	             48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    1a46:	             89 55 ac             	mov    %edx,-0x54(%rbp)
+    1a49:	             48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+    fill(s, pat);
+    1a4d:	             8b 55 ac             	mov    -0x54(%rbp),%edx
+    1a50:	             48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1a54:	             89 d6                	mov    %edx,%esi
+    1a56:	             48 89 c7             	mov    %rax,%rdi
+    1a59:	             e8 82 f8 ff ff       	call   12e0 <fill(nel::Slice<int> const&, int)>
+    auto t = bench::time_ns([&s, &f]() { f(s); });
+    1a5e:	             48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1a62:	             48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    1a66:	             48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    1a6a:	             48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    1a6e:	             48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1a72:	             48 89 c7             	mov    %rax,%rdi
+    1a75:	             e8 05 05 00 00       	call   1f7f <unsigned long bench::time_ns<run<main::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}>(main::{lambda(nel::Slice<int> const&)#1}&&)>
+    1a7a:	             48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    bool sorted = true;
+    1a7e:	             c6 45 ef 01          	movb   $0x1,-0x11(%rbp)
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    1a82:	             48 c7 45 e0 01 00 00 	movq   $0x1,-0x20(%rbp)
+    1a89:	             00 
+    1a8a:	   /-------- eb 54                	jmp    1ae0 <void run<main::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int> const&)#1}&&)+0xab>
+        sorted = sorted && !(s.ptr()[i] < s.ptr()[i - 1]);
+    1a8c:	/--|-------> 80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+    1a90:	|  |  /----- 74 41                	je     1ad3 <void run<main::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int> const&)#1}&&)+0x9e>
+    1a92:	|  |  |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1a96:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1a99:	|  |  |      e8 ee 09 00 00       	call   248c <nel::Slice<int>::ptr() const>
+    1a9e:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1aa2:	|  |  |      48 c1 e2 02          	shl    $0x2,%rdx
+    1aa6:	|  |  |      48 01 d0             	add    %rdx,%rax
+    1aa9:	|  |  |      8b 18                	mov    (%rax),%ebx
+    1aab:	|  |  |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1aaf:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1ab2:	|  |  |      e8 d5 09 00 00       	call   248c <nel::Slice<int>::ptr() const>
+    1ab7:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1abb:	|  |  |      48 c1 e2 02          	shl    $0x2,%rdx
+    1abf:	|  |  |      48 83 ea 04          	sub    $0x4,%rdx
+    1ac3:	|  |  |      48 01 d0             	add    %rdx,%rax
+    1ac6:	|  |  |      8b 00                	mov    (%rax),%eax
+    1ac8:	|  |  |      39 c3                	cmp    %eax,%ebx
+    1aca:	|  |  +----- 7c 07                	jl     1ad3 <void run<main::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int> const&)#1}&&)+0x9e>
+    1acc:	|  |  |      b8 01 00 00 00       	mov    $0x1,%eax
+    1ad1:	|  |  |  /-- eb 05                	jmp    1ad8 <void run<main::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int> const&)#1}&&)+0xa3>
+    1ad3:	|  |  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    1ad8:	|  |     \-> 88 45 ef             	mov    %al,-0x11(%rbp)
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    1adb:	|  |         48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+    1ae0:	|  \-------> 48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1ae4:	|            48 89 c7             	mov    %rax,%rdi
+    1ae7:	|            e8 7c 08 00 00       	call   2368 <nel::Slice<int>::len() const>
+    1aec:	|            48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    1af0:	|            0f 92 c0             	setb   %al
+    1af3:	|            84 c0                	test   %al,%al
+    1af5:	\----------- 75 95                	jne    1a8c <void run<main::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int> const&)#1}&&)+0x57>
+    bench::report_per_item(name, t, s.len());
+    1af7:	             48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1afb:	             48 89 c7             	mov    %rax,%rdi
+    1afe:	             e8 65 08 00 00       	call   2368 <nel::Slice<int>::len() const>
+    1b03:	             48 89 c2             	mov    %rax,%rdx
+    1b06:	             48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+    1b0a:	             48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    1b0e:	             48 89 ce             	mov    %rcx,%rsi
+    1b11:	             48 89 c7             	mov    %rax,%rdi
+    1b14:	             e8 43 05 00 00       	call   205c <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    if (!sorted) { nel::log << "  not sorted!\n"; }
+    1b19:	             0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+    1b1d:	             83 f0 01             	xor    $0x1,%eax
+    1b20:	             84 c0                	test   %al,%al
+    1b22:	         /-- 74 19                	je     1b3d <void run<main::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int> const&)#1}&&)+0x108>
+    1b24:	         |   48 8d 05 4b 46 00 00 	lea    0x464b(%rip),%rax        # 6176 <n_values+0x13e>
+    1b2b:	         |   48 89 c6             	mov    %rax,%rsi
+    1b2e:	         |   48 8d 05 54 75 00 00 	lea    0x7554(%rip),%rax        # 9089 <nel::log>
+    1b35:	         |   48 89 c7             	mov    %rax,%rdi
+    1b38:	         |   e8 38 3d 00 00       	call   5875 <nel::operator<<(nel::Log&, char const*)>
+}
+    1b3d:	         \-> 90                   	nop
+    1b3e:	             48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1b42:	             c9                   	leave
+    1b43:	             c3                   	ret
+
+0000000000001b44 <run<main::{lambda(nel::Slice<int>)#2}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#2}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&s, &f]() { f(s); });
+    1b44:	55                   	push   %rbp
+    1b45:	48 89 e5             	mov    %rsp,%rbp
+    1b48:	48 83 ec 20          	sub    $0x20,%rsp
+    1b4c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1b50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b54:	48 8b 48 08          	mov    0x8(%rax),%rcx
+    1b58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b5c:	48 8b 00             	mov    (%rax),%rax
+    1b5f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1b63:	48 8b 00             	mov    (%rax),%rax
+    1b66:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1b6a:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    1b6e:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1b72:	48 89 c6             	mov    %rax,%rsi
+    1b75:	48 89 cf             	mov    %rcx,%rdi
+    1b78:	e8 ed f9 ff ff       	call   156a <main::{lambda(nel::Slice<int>)#2}::operator()(nel::Slice<int>) const>
+    1b7d:	90                   	nop
+    1b7e:	c9                   	leave
+    1b7f:	c3                   	ret
+
+0000000000001b80 <void run<main::{lambda(nel::Slice<int>)#2}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#2}&&)>:
+void run(char const *const name, nel::Slice<int> const &s, int const pat, F &&f)
+    1b80:	             55                   	push   %rbp
+    1b81:	             48 89 e5             	mov    %rsp,%rbp
+    1b84:	             53                   	push   %rbx
+    1b85:	             48 83 ec 58          	sub    $0x58,%rsp
+    1b89:	             48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    1b8d:	             48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    1b91:	             89 55 ac             	mov    %edx,-0x54(%rbp)
+    1b94:	             48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+    fill(s, pat);
+    1b98:	             8b 55 ac             	mov    -0x54(%rbp),%edx
+    1b9b:	             48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1b9f:	             89 d6                	mov    %edx,%esi
+    1ba1:	             48 89 c7             	mov    %rax,%rdi
+    1ba4:	             e8 37 f7 ff ff       	call   12e0 <fill(nel::Slice<int> const&, int)>
+    auto t = bench::time_ns([&s, &f]() { f(s); });
+    1ba9:	             48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1bad:	             48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    1bb1:	             48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    1bb5:	             48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    1bb9:	             48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1bbd:	             48 89 c7             	mov    %rax,%rdi
+    1bc0:	             e8 e6 03 00 00       	call   1fab <unsigned long bench::time_ns<run<main::{lambda(nel::Slice<int>)#2}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#2}&&)::{lambda()#1}>(main::{lambda(nel::Slice<int>)#2}&&)>
+    1bc5:	             48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    bool sorted = true;
+    1bc9:	             c6 45 ef 01          	movb   $0x1,-0x11(%rbp)
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    1bcd:	             48 c7 45 e0 01 00 00 	movq   $0x1,-0x20(%rbp)
+    1bd4:	             00 
+    1bd5:	   /-------- eb 54                	jmp    1c2b <void run<main::{lambda(nel::Slice<int>)#2}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#2}&&)+0xab>
+        sorted = sorted && !(s.ptr()[i] < s.ptr()[i - 1]);
+    1bd7:	/--|-------> 80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+    1bdb:	|  |  /----- 74 41                	je     1c1e <void run<main::{lambda(nel::Slice<int>)#2}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#2}&&)+0x9e>
+    1bdd:	|  |  |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1be1:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1be4:	|  |  |      e8 a3 08 00 00       	call   248c <nel::Slice<int>::ptr() const>
+    1be9:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1bed:	|  |  |      48 c1 e2 02          	shl    $0x2,%rdx
+    1bf1:	|  |  |      48 01 d0             	add    %rdx,%rax
+    1bf4:	|  |  |      8b 18                	mov    (%rax),%ebx
+    1bf6:	|  |  |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1bfa:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1bfd:	|  |  |      e8 8a 08 00 00       	call   248c <nel::Slice<int>::ptr() const>
+    1c02:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1c06:	|  |  |      48 c1 e2 02          	shl    $0x2,%rdx
+    1c0a:	|  |  |      48 83 ea 04          	sub    $0x4,%rdx
+    1c0e:	|  |  |      48 01 d0             	add    %rdx,%rax
+    1c11:	|  |  |      8b 00                	mov    (%rax),%eax
+    1c13:	|  |  |      39 c3                	cmp    %eax,%ebx
+    1c15:	|  |  +----- 7c 07                	jl     1c1e <void run<main::{lambda(nel::Slice<int>)#2}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#2}&&)+0x9e>
+    1c17:	|  |  |      b8 01 00 00 00       	mov    $0x1,%eax
+    1c1c:	|  |  |  /-- eb 05                	jmp    1c23 <void run<main::{lambda(nel::Slice<int>)#2}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#2}&&)+0xa3>
+    1c1e:	|  |  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    1c23:	|  |     \-> 88 45 ef             	mov    %al,-0x11(%rbp)
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    1c26:	|  |         48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+    1c2b:	|  \-------> 48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1c2f:	|            48 89 c7             	mov    %rax,%rdi
+    1c32:	|            e8 31 07 00 00       	call   2368 <nel::Slice<int>::len() const>
+    1c37:	|            48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    1c3b:	|            0f 92 c0             	setb   %al
+    1c3e:	|            84 c0                	test   %al,%al
+    1c40:	\----------- 75 95                	jne    1bd7 <void run<main::{lambda(nel::Slice<int>)#2}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#2}&&)+0x57>
+    bench::report_per_item(name, t, s.len());
+    1c42:	             48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1c46:	             48 89 c7             	mov    %rax,%rdi
+    1c49:	             e8 1a 07 00 00       	call   2368 <nel::Slice<int>::len() const>
+    1c4e:	             48 89 c2             	mov    %rax,%rdx
+    1c51:	             48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+    1c55:	             48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    1c59:	             48 89 ce             	mov    %rcx,%rsi
+    1c5c:	             48 89 c7             	mov    %rax,%rdi
+    1c5f:	             e8 f8 03 00 00       	call   205c <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    if (!sorted) { nel::log << "  not sorted!\n"; }
+    1c64:	             0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+    1c68:	             83 f0 01             	xor    $0x1,%eax
+    1c6b:	             84 c0                	test   %al,%al
+    1c6d:	         /-- 74 19                	je     1c88 <void run<main::{lambda(nel::Slice<int>)#2}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#2}&&)+0x108>
+    1c6f:	         |   48 8d 05 00 45 00 00 	lea    0x4500(%rip),%rax        # 6176 <n_values+0x13e>
+    1c76:	         |   48 89 c6             	mov    %rax,%rsi
+    1c79:	         |   48 8d 05 09 74 00 00 	lea    0x7409(%rip),%rax        # 9089 <nel::log>
+    1c80:	         |   48 89 c7             	mov    %rax,%rdi
+    1c83:	         |   e8 ed 3b 00 00       	call   5875 <nel::operator<<(nel::Log&, char const*)>
+}
+    1c88:	         \-> 90                   	nop
+    1c89:	             48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1c8d:	             c9                   	leave
+    1c8e:	             c3                   	ret
+    1c8f:	             90                   	nop
+
+0000000000001c90 <run<main::{lambda(nel::Slice<int>)#3}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#3}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&s, &f]() { f(s); });
+    1c90:	55                   	push   %rbp
+    1c91:	48 89 e5             	mov    %rsp,%rbp
+    1c94:	48 83 ec 20          	sub    $0x20,%rsp
+    1c98:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1c9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ca0:	48 8b 48 08          	mov    0x8(%rax),%rcx
+    1ca4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ca8:	48 8b 00             	mov    (%rax),%rax
+    1cab:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1caf:	48 8b 00             	mov    (%rax),%rax
+    1cb2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1cb6:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    1cba:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1cbe:	48 89 c6             	mov    %rax,%rsi
+    1cc1:	48 89 cf             	mov    %rcx,%rdi
+    1cc4:	e8 c7 f8 ff ff       	call   1590 <main::{lambda(nel::Slice<int>)#3}::operator()(nel::Slice<int>) const>
+    1cc9:	90                   	nop
+    1cca:	c9                   	leave
+    1ccb:	c3                   	ret
+
+0000000000001ccc <void run<main::{lambda(nel::Slice<int>)#3}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#3}&&)>:
+void run(char const *const name, nel::Slice<int> const &s, int const pat, F &&f)
+    1ccc:	             55                   	push   %rbp
+    1ccd:	             48 89 e5             	mov    %rsp,%rbp
+    1cd0:	             53                   	push   %rbx
+    1cd1:	             48 83 ec 58          	sub    $0x58,%rsp
+    1cd5:	             48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    1cd9:	             48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    1cdd:	             89 55 ac             	mov    %edx,-0x54(%rbp)
+    1ce0:	             48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+    fill(s, pat);
+    1ce4:	             8b 55 ac             	mov    -0x54(%rbp),%edx
+    1ce7:	             48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1ceb:	             89 d6                	mov    %edx,%esi
+    1ced:	             48 89 c7             	mov    %rax,%rdi
+    1cf0:	             e8 eb f5 ff ff       	call   12e0 <fill(nel::Slice<int> const&, int)>
+    auto t = bench::time_ns([&s, &f]() { f(s); });
+    1cf5:	             48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1cf9:	             48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    1cfd:	             48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    1d01:	             48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    1d05:	             48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1d09:	             48 89 c7             	mov    %rax,%rdi
+    1d0c:	             e8 c6 02 00 00       	call   1fd7 <unsigned long bench::time_ns<run<main::{lambda(nel::Slice<int>)#3}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#3}&&)::{lambda()#1}>(main::{lambda(nel::Slice<int>)#3}&&)>
+    1d11:	             48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    bool sorted = true;
+    1d15:	             c6 45 ef 01          	movb   $0x1,-0x11(%rbp)
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    1d19:	             48 c7 45 e0 01 00 00 	movq   $0x1,-0x20(%rbp)
+    1d20:	             00 
+    1d21:	   /-------- eb 54                	jmp    1d77 <void run<main::{lambda(nel::Slice<int>)#3}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#3}&&)+0xab>
+        sorted = sorted && !(s.ptr()[i] < s.ptr()[i - 1]);
+    1d23:	/--|-------> 80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+    1d27:	|  |  /----- 74 41                	je     1d6a <void run<main::{lambda(nel::Slice<int>)#3}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#3}&&)+0x9e>
+    1d29:	|  |  |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1d2d:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1d30:	|  |  |      e8 57 07 00 00       	call   248c <nel::Slice<int>::ptr() const>
+    1d35:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1d39:	|  |  |      48 c1 e2 02          	shl    $0x2,%rdx
+    1d3d:	|  |  |      48 01 d0             	add    %rdx,%rax
+    1d40:	|  |  |      8b 18                	mov    (%rax),%ebx
+    1d42:	|  |  |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1d46:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1d49:	|  |  |      e8 3e 07 00 00       	call   248c <nel::Slice<int>::ptr() const>
+    1d4e:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1d52:	|  |  |      48 c1 e2 02          	shl    $0x2,%rdx
+    1d56:	|  |  |      48 83 ea 04          	sub    $0x4,%rdx
+    1d5a:	|  |  |      48 01 d0             	add    %rdx,%rax
+    1d5d:	|  |  |      8b 00                	mov    (%rax),%eax
+    1d5f:	|  |  |      39 c3                	cmp    %eax,%ebx
+    1d61:	|  |  +----- 7c 07                	jl     1d6a <void run<main::{lambda(nel::Slice<int>)#3}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#3}&&)+0x9e>
+    1d63:	|  |  |      b8 01 00 00 00       	mov    $0x1,%eax
+    1d68:	|  |  |  /-- eb 05                	jmp    1d6f <void run<main::{lambda(nel::Slice<int>)#3}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#3}&&)+0xa3>
+    1d6a:	|  |  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    1d6f:	|  |     \-> 88 45 ef             	mov    %al,-0x11(%rbp)
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    1d72:	|  |         48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+    1d77:	|  \-------> 48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1d7b:	|            48 89 c7             	mov    %rax,%rdi
+    1d7e:	|            e8 e5 05 00 00       	call   2368 <nel::Slice<int>::len() const>
+    1d83:	|            48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    1d87:	|            0f 92 c0             	setb   %al
+    1d8a:	|            84 c0                	test   %al,%al
+    1d8c:	\----------- 75 95                	jne    1d23 <void run<main::{lambda(nel::Slice<int>)#3}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#3}&&)+0x57>
+    bench::report_per_item(name, t, s.len());
+    1d8e:	             48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1d92:	             48 89 c7             	mov    %rax,%rdi
+    1d95:	             e8 ce 05 00 00       	call   2368 <nel::Slice<int>::len() const>
+    1d9a:	             48 89 c2             	mov    %rax,%rdx
+    1d9d:	             48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+    1da1:	             48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    1da5:	             48 89 ce             	mov    %rcx,%rsi
+    1da8:	             48 89 c7             	mov    %rax,%rdi
+    1dab:	             e8 ac 02 00 00       	call   205c <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    if (!sorted) { nel::log << "  not sorted!\n"; }
+    1db0:	             0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+    1db4:	             83 f0 01             	xor    $0x1,%eax
+    1db7:	             84 c0                	test   %al,%al
+    1db9:	         /-- 74 19                	je     1dd4 <void run<main::{lambda(nel::Slice<int>)#3}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#3}&&)+0x108>
+    1dbb:	         |   48 8d 05 b4 43 00 00 	lea    0x43b4(%rip),%rax        # 6176 <n_values+0x13e>
+    1dc2:	         |   48 89 c6             	mov    %rax,%rsi
+    1dc5:	         |   48 8d 05 bd 72 00 00 	lea    0x72bd(%rip),%rax        # 9089 <nel::log>
+    1dcc:	         |   48 89 c7             	mov    %rax,%rdi
+    1dcf:	         |   e8 a1 3a 00 00       	call   5875 <nel::operator<<(nel::Log&, char const*)>
+}
+    1dd4:	         \-> 90                   	nop
+    1dd5:	             48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1dd9:	             c9                   	leave
+    1dda:	             c3                   	ret
+    1ddb:	             90                   	nop
+
+0000000000001ddc <run<main::{lambda(nel::Slice<int>)#4}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#4}&&)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&s, &f]() { f(s); });
+    1ddc:	55                   	push   %rbp
+    1ddd:	48 89 e5             	mov    %rsp,%rbp
+    1de0:	48 83 ec 20          	sub    $0x20,%rsp
+    1de4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1de8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1dec:	48 8b 48 08          	mov    0x8(%rax),%rcx
+    1df0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1df4:	48 8b 00             	mov    (%rax),%rax
+    1df7:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1dfb:	48 8b 00             	mov    (%rax),%rax
+    1dfe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1e02:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    1e06:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1e0a:	48 89 c6             	mov    %rax,%rsi
+    1e0d:	48 89 cf             	mov    %rcx,%rdi
+    1e10:	e8 a1 f7 ff ff       	call   15b6 <main::{lambda(nel::Slice<int>)#4}::operator()(nel::Slice<int>) const>
+    1e15:	90                   	nop
+    1e16:	c9                   	leave
+    1e17:	c3                   	ret
+
+0000000000001e18 <void run<main::{lambda(nel::Slice<int>)#4}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#4}&&)>:
+void run(char const *const name, nel::Slice<int> const &s, int const pat, F &&f)
+    1e18:	             55                   	push   %rbp
+    1e19:	             48 89 e5             	mov    %rsp,%rbp
+    1e1c:	             53                   	push   %rbx
+    1e1d:	             48 83 ec 58          	sub    $0x58,%rsp
+    1e21:	             48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    1e25:	             48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    1e29:	             89 55 ac             	mov    %edx,-0x54(%rbp)
+    1e2c:	             48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+    fill(s, pat);
+    1e30:	             8b 55 ac             	mov    -0x54(%rbp),%edx
+    1e33:	             48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1e37:	             89 d6                	mov    %edx,%esi
+    1e39:	             48 89 c7             	mov    %rax,%rdi
+    1e3c:	             e8 9f f4 ff ff       	call   12e0 <fill(nel::Slice<int> const&, int)>
+    auto t = bench::time_ns([&s, &f]() { f(s); });
+    1e41:	             48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1e45:	             48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    1e49:	             48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    1e4d:	             48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    1e51:	             48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1e55:	             48 89 c7             	mov    %rax,%rdi
+    1e58:	             e8 a6 01 00 00       	call   2003 <unsigned long bench::time_ns<run<main::{lambda(nel::Slice<int>)#4}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#4}&&)::{lambda()#1}>(main::{lambda(nel::Slice<int>)#4}&&)>
+    1e5d:	             48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    bool sorted = true;
+    1e61:	             c6 45 ef 01          	movb   $0x1,-0x11(%rbp)
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    1e65:	             48 c7 45 e0 01 00 00 	movq   $0x1,-0x20(%rbp)
+    1e6c:	             00 
+    1e6d:	   /-------- eb 54                	jmp    1ec3 <void run<main::{lambda(nel::Slice<int>)#4}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#4}&&)+0xab>
+        sorted = sorted && !(s.ptr()[i] < s.ptr()[i - 1]);
+    1e6f:	/--|-------> 80 7d ef 00          	cmpb   $0x0,-0x11(%rbp)
+    1e73:	|  |  /----- 74 41                	je     1eb6 <void run<main::{lambda(nel::Slice<int>)#4}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#4}&&)+0x9e>
+    1e75:	|  |  |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1e79:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1e7c:	|  |  |      e8 0b 06 00 00       	call   248c <nel::Slice<int>::ptr() const>
+    1e81:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1e85:	|  |  |      48 c1 e2 02          	shl    $0x2,%rdx
+    1e89:	|  |  |      48 01 d0             	add    %rdx,%rax
+    1e8c:	|  |  |      8b 18                	mov    (%rax),%ebx
+    1e8e:	|  |  |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1e92:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1e95:	|  |  |      e8 f2 05 00 00       	call   248c <nel::Slice<int>::ptr() const>
+    1e9a:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1e9e:	|  |  |      48 c1 e2 02          	shl    $0x2,%rdx
+    1ea2:	|  |  |      48 83 ea 04          	sub    $0x4,%rdx
+    1ea6:	|  |  |      48 01 d0             	add    %rdx,%rax
+    1ea9:	|  |  |      8b 00                	mov    (%rax),%eax
+    1eab:	|  |  |      39 c3                	cmp    %eax,%ebx
+    1ead:	|  |  +----- 7c 07                	jl     1eb6 <void run<main::{lambda(nel::Slice<int>)#4}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#4}&&)+0x9e>
+    1eaf:	|  |  |      b8 01 00 00 00       	mov    $0x1,%eax
+    1eb4:	|  |  |  /-- eb 05                	jmp    1ebb <void run<main::{lambda(nel::Slice<int>)#4}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#4}&&)+0xa3>
+    1eb6:	|  |  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    1ebb:	|  |     \-> 88 45 ef             	mov    %al,-0x11(%rbp)
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    1ebe:	|  |         48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+    1ec3:	|  \-------> 48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1ec7:	|            48 89 c7             	mov    %rax,%rdi
+    1eca:	|            e8 99 04 00 00       	call   2368 <nel::Slice<int>::len() const>
+    1ecf:	|            48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    1ed3:	|            0f 92 c0             	setb   %al
+    1ed6:	|            84 c0                	test   %al,%al
+    1ed8:	\----------- 75 95                	jne    1e6f <void run<main::{lambda(nel::Slice<int>)#4}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#4}&&)+0x57>
+    bench::report_per_item(name, t, s.len());
+    1eda:	             48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1ede:	             48 89 c7             	mov    %rax,%rdi
+    1ee1:	             e8 82 04 00 00       	call   2368 <nel::Slice<int>::len() const>
+    1ee6:	             48 89 c2             	mov    %rax,%rdx
+    1ee9:	             48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+    1eed:	             48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    1ef1:	             48 89 ce             	mov    %rcx,%rsi
+    1ef4:	             48 89 c7             	mov    %rax,%rdi
+    1ef7:	             e8 60 01 00 00       	call   205c <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    if (!sorted) { nel::log << "  not sorted!\n"; }
+    1efc:	             0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+    1f00:	             83 f0 01             	xor    $0x1,%eax
+    1f03:	             84 c0                	test   %al,%al
+    1f05:	         /-- 74 19                	je     1f20 <void run<main::{lambda(nel::Slice<int>)#4}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#4}&&)+0x108>
+    1f07:	         |   48 8d 05 68 42 00 00 	lea    0x4268(%rip),%rax        # 6176 <n_values+0x13e>
+    1f0e:	         |   48 89 c6             	mov    %rax,%rsi
+    1f11:	         |   48 8d 05 71 71 00 00 	lea    0x7171(%rip),%rax        # 9089 <nel::log>
+    1f18:	         |   48 89 c7             	mov    %rax,%rdi
+    1f1b:	         |   e8 55 39 00 00       	call   5875 <nel::operator<<(nel::Log&, char const*)>
+}
+    1f20:	         \-> 90                   	nop
+    1f21:	             48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1f25:	             c9                   	leave
+    1f26:	             c3                   	ret
+
+0000000000001f27 <unsigned long bench::time_ns<main::{lambda()#5}>(main::{lambda()#5}&&)>:
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+}
+
+// Time a run of f(), in ns.
+template<typename F>
+long unsigned int time_ns(F &&f)
+    1f27:	55                   	push   %rbp
+    1f28:	48 89 e5             	mov    %rsp,%rbp
+    1f2b:	48 83 ec 20          	sub    $0x20,%rsp
+    1f2f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+{
+    long unsigned int const b = now_ns();
+    1f33:	e8 f7 00 00 00       	call   202f <bench::now_ns()>
+    1f38:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    1f3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f40:	48 89 c7             	mov    %rax,%rdi
+    1f43:	e8 9c f6 ff ff       	call   15e4 <main::{lambda()#5}::operator()() const>
+    return now_ns() - b;
+    1f48:	e8 e2 00 00 00       	call   202f <bench::now_ns()>
+    1f4d:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    1f51:	c9                   	leave
+    1f52:	c3                   	ret
+
+0000000000001f53 <unsigned long bench::time_ns<main::{lambda()#6}>(main::{lambda()#6}&&)>:
+long unsigned int time_ns(F &&f)
+    1f53:	55                   	push   %rbp
+    1f54:	48 89 e5             	mov    %rsp,%rbp
+    1f57:	48 83 ec 20          	sub    $0x20,%rsp
+    1f5b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    1f5f:	e8 cb 00 00 00       	call   202f <bench::now_ns()>
+    1f64:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    1f68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f6c:	48 89 c7             	mov    %rax,%rdi
+    1f6f:	e8 aa f6 ff ff       	call   161e <main::{lambda()#6}::operator()() const>
+    return now_ns() - b;
+    1f74:	e8 b6 00 00 00       	call   202f <bench::now_ns()>
+    1f79:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    1f7d:	c9                   	leave
+    1f7e:	c3                   	ret
+
+0000000000001f7f <unsigned long bench::time_ns<run<main::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}>(main::{lambda(nel::Slice<int> const&)#1}&&)>:
+long unsigned int time_ns(F &&f)
+    1f7f:	55                   	push   %rbp
+    1f80:	48 89 e5             	mov    %rsp,%rbp
+    1f83:	48 83 ec 20          	sub    $0x20,%rsp
+    1f87:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    1f8b:	e8 9f 00 00 00       	call   202f <bench::now_ns()>
+    1f90:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    1f94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f98:	48 89 c7             	mov    %rax,%rdi
+    1f9b:	e8 6c fa ff ff       	call   1a0c <run<main::{lambda(nel::Slice<int> const&)#1}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int> const&)#1}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    1fa0:	e8 8a 00 00 00       	call   202f <bench::now_ns()>
+    1fa5:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    1fa9:	c9                   	leave
+    1faa:	c3                   	ret
+
+0000000000001fab <unsigned long bench::time_ns<run<main::{lambda(nel::Slice<int>)#2}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#2}&&)::{lambda()#1}>(main::{lambda(nel::Slice<int>)#2}&&)>:
+long unsigned int time_ns(F &&f)
+    1fab:	55                   	push   %rbp
+    1fac:	48 89 e5             	mov    %rsp,%rbp
+    1faf:	48 83 ec 20          	sub    $0x20,%rsp
+    1fb3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    1fb7:	e8 73 00 00 00       	call   202f <bench::now_ns()>
+    1fbc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    1fc0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1fc4:	48 89 c7             	mov    %rax,%rdi
+    1fc7:	e8 78 fb ff ff       	call   1b44 <run<main::{lambda(nel::Slice<int>)#2}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#2}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    1fcc:	e8 5e 00 00 00       	call   202f <bench::now_ns()>
+    1fd1:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    1fd5:	c9                   	leave
+    1fd6:	c3                   	ret
+
+0000000000001fd7 <unsigned long bench::time_ns<run<main::{lambda(nel::Slice<int>)#3}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#3}&&)::{lambda()#1}>(main::{lambda(nel::Slice<int>)#3}&&)>:
+long unsigned int time_ns(F &&f)
+    1fd7:	55                   	push   %rbp
+    1fd8:	48 89 e5             	mov    %rsp,%rbp
+    1fdb:	48 83 ec 20          	sub    $0x20,%rsp
+    1fdf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    1fe3:	e8 47 00 00 00       	call   202f <bench::now_ns()>
+    1fe8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    1fec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ff0:	48 89 c7             	mov    %rax,%rdi
+    1ff3:	e8 98 fc ff ff       	call   1c90 <run<main::{lambda(nel::Slice<int>)#3}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#3}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    1ff8:	e8 32 00 00 00       	call   202f <bench::now_ns()>
+    1ffd:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    2001:	c9                   	leave
+    2002:	c3                   	ret
+
+0000000000002003 <unsigned long bench::time_ns<run<main::{lambda(nel::Slice<int>)#4}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#4}&&)::{lambda()#1}>(main::{lambda(nel::Slice<int>)#4}&&)>:
+long unsigned int time_ns(F &&f)
+    2003:	55                   	push   %rbp
+    2004:	48 89 e5             	mov    %rsp,%rbp
+    2007:	48 83 ec 20          	sub    $0x20,%rsp
+    200b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    200f:	e8 1b 00 00 00       	call   202f <bench::now_ns()>
+    2014:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    2018:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    201c:	48 89 c7             	mov    %rax,%rdi
+    201f:	e8 b8 fd ff ff       	call   1ddc <run<main::{lambda(nel::Slice<int>)#4}>(char const*, nel::Slice<int> const&, int, main::{lambda(nel::Slice<int>)#4}&&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    2024:	e8 06 00 00 00       	call   202f <bench::now_ns()>
+    2029:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    202d:	c9                   	leave
+    202e:	c3                   	ret
+
+000000000000202f <bench::now_ns()>:
+{
+    202f:	55                   	push   %rbp
+    2030:	48 89 e5             	mov    %rsp,%rbp
+    2033:	48 83 ec 10          	sub    $0x10,%rsp
+    s ^= s >> 17;
+    2037:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    203b:	48 89 c6             	mov    %rax,%rsi
+    203e:	bf 01 00 00 00       	mov    $0x1,%edi
+    2043:	e8 18 f0 ff ff       	call   1060 <clock_gettime@plt>
+    s ^= s << 5;
+    2048:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    204c:	48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+    2053:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2057:	48 01 d0             	add    %rdx,%rax
+    return s;
+    205a:	c9                   	leave
+    205b:	c3                   	ret
+
+000000000000205c <bench::report_per_item(char const*, unsigned long, unsigned long)>:
+                    nel::Index const j = next_rand(seed) % n;
+    205c:	       55                   	push   %rbp
+    205d:	       48 89 e5             	mov    %rsp,%rbp
+    2060:	       48 83 ec 30          	sub    $0x30,%rsp
+    2064:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2068:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    206c:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+                    int const t = p[i];
+    2070:	       48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    2075:	/----- 74 28                	je     209f <bench::report_per_item(char const*, unsigned long, unsigned long)+0x43>
+    2077:	|      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    207b:	|      48 89 d0             	mov    %rdx,%rax
+    207e:	|      48 c1 e0 02          	shl    $0x2,%rax
+    2082:	|      48 01 d0             	add    %rdx,%rax
+    2085:	|      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    208c:	|      00 
+    208d:	|      48 01 d0             	add    %rdx,%rax
+    2090:	|      48 c1 e0 02          	shl    $0x2,%rax
+    2094:	|      ba 00 00 00 00       	mov    $0x0,%edx
+    2099:	|      48 f7 75 d8          	divq   -0x28(%rbp)
+    209d:	|  /-- eb 05                	jmp    20a4 <bench::report_per_item(char const*, unsigned long, unsigned long)+0x48>
+    209f:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    20a4:	   \-> 48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                    p[i] = p[j];
+    20a8:	       48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    20ac:	       48 89 c8             	mov    %rcx,%rax
+    20af:	       48 c1 e8 02          	shr    $0x2,%rax
+    20b3:	       48 ba c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rdx
+    20ba:	       c2 f5 28 
+    20bd:	       48 f7 e2             	mul    %rdx
+    20c0:	       48 c1 ea 02          	shr    $0x2,%rdx
+    20c4:	       48 89 d0             	mov    %rdx,%rax
+    20c7:	       48 c1 e0 02          	shl    $0x2,%rax
+    20cb:	       48 01 d0             	add    %rdx,%rax
+    20ce:	       48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    20d5:	       00 
+    20d6:	       48 01 d0             	add    %rdx,%rax
+    20d9:	       48 c1 e0 02          	shl    $0x2,%rax
+    20dd:	       48 29 c1             	sub    %rax,%rcx
+    20e0:	       48 89 ca             	mov    %rcx,%rdx
+    20e3:	       48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+                }
+    20e7:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20eb:	       48 89 c6             	mov    %rax,%rsi
+    20ee:	       48 8d 05 94 6f 00 00 	lea    0x6f94(%rip),%rax        # 9089 <nel::log>
+    20f5:	       48 89 c7             	mov    %rax,%rdi
+    20f8:	       e8 78 37 00 00       	call   5875 <nel::operator<<(nel::Log&, char const*)>
+    20fd:	       48 89 c2             	mov    %rax,%rdx
+    2100:	       48 8d 05 01 3f 00 00 	lea    0x3f01(%rip),%rax        # 6008 <_IO_stdin_used+0x8>
+    2107:	       48 89 c6             	mov    %rax,%rsi
+    210a:	       48 89 d7             	mov    %rdx,%rdi
+    210d:	       e8 63 37 00 00       	call   5875 <nel::operator<<(nel::Log&, char const*)>
+    2112:	       48 89 c1             	mov    %rax,%rcx
+    2115:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2119:	       48 c1 e8 02          	shr    $0x2,%rax
+    211d:	       48 ba c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rdx
+    2124:	       c2 f5 28 
+    2127:	       48 f7 e2             	mul    %rdx
+    212a:	       48 89 d0             	mov    %rdx,%rax
+    212d:	       48 c1 e8 02          	shr    $0x2,%rax
+    2131:	       48 89 c6             	mov    %rax,%rsi
+    2134:	       48 89 cf             	mov    %rcx,%rdi
+    2137:	       e8 44 38 00 00       	call   5980 <nel::operator<<(nel::Log&, unsigned long)>
+    213c:	       be 2e 00 00 00       	mov    $0x2e,%esi
+    2141:	       48 89 c7             	mov    %rax,%rdi
+    2144:	       e8 00 37 00 00       	call   5849 <nel::operator<<(nel::Log&, char)>
+    2149:	       48 89 c2             	mov    %rax,%rdx
+    214c:	       48 83 7d f0 09       	cmpq   $0x9,-0x10(%rbp)
+    2151:	/----- 77 09                	ja     215c <bench::report_per_item(char const*, unsigned long, unsigned long)+0x100>
+    2153:	|      48 8d 05 b1 3e 00 00 	lea    0x3eb1(%rip),%rax        # 600b <_IO_stdin_used+0xb>
+    215a:	|  /-- eb 07                	jmp    2163 <bench::report_per_item(char const*, unsigned long, unsigned long)+0x107>
+    215c:	\--|-> 48 8d 05 aa 3e 00 00 	lea    0x3eaa(%rip),%rax        # 600d <_IO_stdin_used+0xd>
+    2163:	   \-> 48 89 c6             	mov    %rax,%rsi
+    2166:	       48 89 d7             	mov    %rdx,%rdi
+    2169:	       e8 07 37 00 00       	call   5875 <nel::operator<<(nel::Log&, char const*)>
+    216e:	       48 89 c2             	mov    %rax,%rdx
+    2171:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2175:	       48 89 c6             	mov    %rax,%rsi
+    2178:	       48 89 d7             	mov    %rdx,%rdi
+    217b:	       e8 00 38 00 00       	call   5980 <nel::operator<<(nel::Log&, unsigned long)>
+    2180:	       48 89 c2             	mov    %rax,%rdx
+    2183:	       48 8d 05 84 3e 00 00 	lea    0x3e84(%rip),%rax        # 600e <_IO_stdin_used+0xe>
+    218a:	       48 89 c6             	mov    %rax,%rsi
+    218d:	       48 89 d7             	mov    %rdx,%rdi
+    2190:	       e8 e0 36 00 00       	call   5875 <nel::operator<<(nel::Log&, char const*)>
+                break;
+    2195:	       90                   	nop
+    2196:	       c9                   	leave
+    2197:	       c3                   	ret
+
+0000000000002198 <operator new(unsigned long, void*)>:
+
+#    if !defined(TEST)
+// catch2 uses stdlib and so uses stdlib's new defn.
+// Operator new must not be in a namespace
+inline void *operator new(nel::USize, void *p)
+{
+    2198:	55                   	push   %rbp
+    2199:	48 89 e5             	mov    %rsp,%rbp
+    219c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    21a0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return p;
+    21a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+    21a8:	5d                   	pop    %rbp
+    21a9:	c3                   	ret
+
+00000000000021aa <nel::Context::Context(char const*, char const*, int)>:
+        char const *fn_name_;
+        char const *file_name_;
+        int line_num_;
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+    21aa:	55                   	push   %rbp
+    21ab:	48 89 e5             	mov    %rsp,%rbp
+    21ae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    21b2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    21b6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    21ba:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    21bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21c1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    21c5:	48 89 10             	mov    %rdx,(%rax)
+            , file_name_(file_name)
+    21c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21cc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    21d0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , line_num_(line_num)
+    21d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21d8:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    21db:	89 50 10             	mov    %edx,0x10(%rax)
+        {
+        }
+    21de:	90                   	nop
+    21df:	5d                   	pop    %rbp
+    21e0:	c3                   	ret
+
+00000000000021e1 <nel::panic_if_not(bool, char const*, nel::Context const&)>:
+{
+    if (pred) { panic(msg, ctx); }
+}
+
+inline void panic_if_not(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    21e1:	    55                   	push   %rbp
+    21e2:	    48 89 e5             	mov    %rsp,%rbp
+    21e5:	    48 83 ec 20          	sub    $0x20,%rsp
+    21e9:	    89 f8                	mov    %edi,%eax
+    21eb:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    21ef:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    21f3:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { panic(msg, ctx); }
+    21f6:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    21fa:	    83 f0 01             	xor    $0x1,%eax
+    21fd:	    84 c0                	test   %al,%al
+    21ff:	/-- 74 13                	je     2214 <nel::panic_if_not(bool, char const*, nel::Context const&)+0x33>
+    2201:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2205:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2209:	|   48 89 d6             	mov    %rdx,%rsi
+    220c:	|   48 89 c7             	mov    %rax,%rdi
+    220f:	|   e8 29 2d 00 00       	call   4f3d <nel::panic(char const*, nel::Context const&)>
+}
+    2214:	\-> 90                   	nop
+    2215:	    c9                   	leave
+    2216:	    c3                   	ret
+
+0000000000002217 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>:
+        static Result<void *, AllocError> try_malloc(Length const align, Length const size)
+        {
+            return try_realloc(nullptr, align, 0, size);
+        }
+
+        static Result<void *, AllocError> try_realloc(void *const p,
+    2217:	          55                   	push   %rbp
+    2218:	          48 89 e5             	mov    %rsp,%rbp
+    221b:	          48 83 ec 40          	sub    $0x40,%rsp
+    221f:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2223:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2227:	          48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    222b:	          48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    222f:	          4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+                                                      Length const align,
+                                                      Length const old_size,
+                                                      Length const new_size)
+        {
+            if (align == 0 || (align & (align - 1)) != 0) {
+    2233:	          48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    2238:	      /-- 74 11                	je     224b <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x34>
+    223a:	      |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    223e:	      |   48 83 e8 01          	sub    $0x1,%rax
+    2242:	      |   48 23 45 d8          	and    -0x28(%rbp),%rax
+    2246:	      |   48 85 c0             	test   %rax,%rax
+    2249:	   /--|-- 74 1c                	je     2267 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x50>
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+    224b:	   |  \-> c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+    2252:	   |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2256:	   |      48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    225a:	   |      48 89 d6             	mov    %rdx,%rsi
+    225d:	   |      48 89 c7             	mov    %rax,%rdi
+    2260:	   |      e8 bf 01 00 00       	call   2424 <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+                                    : std::realloc(p, new_size);
+            if (new_p == nullptr) {
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+            }
+            return Result<void *, AllocError>::Ok(new_p);
+        }
+    2265:	/--|----- eb 79                	jmp    22e0 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            void *const new_p = is_over_aligned(align)
+    2267:	|  \----> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    226b:	|         48 89 c7             	mov    %rax,%rdi
+    226e:	|         e8 b4 00 00 00       	call   2327 <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+                                    ? realloc_aligned(p, align, old_size, new_size)
+    2273:	|         84 c0                	test   %al,%al
+    2275:	|  /----- 74 1a                	je     2291 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x7a>
+    2277:	|  |      48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+    227b:	|  |      48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    227f:	|  |      48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+    2283:	|  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2287:	|  |      48 89 c7             	mov    %rax,%rdi
+    228a:	|  |      e8 b5 33 00 00       	call   5644 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+    228f:	|  |  /-- eb 13                	jmp    22a4 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x8d>
+                                    : std::realloc(p, new_size);
+    2291:	|  \--|-> 48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    2295:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2299:	|     |   48 89 d6             	mov    %rdx,%rsi
+    229c:	|     |   48 89 c7             	mov    %rax,%rdi
+    229f:	|     |   e8 2c ee ff ff       	call   10d0 <realloc@plt>
+    22a4:	|     \-> 48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            if (new_p == nullptr) {
+    22a8:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22ac:	|         48 85 c0             	test   %rax,%rax
+    22af:	|     /-- 75 1c                	jne    22cd <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xb6>
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+    22b1:	|     |   c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    22b8:	|     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22bc:	|     |   48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    22c0:	|     |   48 89 d6             	mov    %rdx,%rsi
+    22c3:	|     |   48 89 c7             	mov    %rax,%rdi
+    22c6:	|     |   e8 59 01 00 00       	call   2424 <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+        }
+    22cb:	+-----|-- eb 13                	jmp    22e0 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            return Result<void *, AllocError>::Ok(new_p);
+    22cd:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22d1:	|         48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    22d5:	|         48 89 d6             	mov    %rdx,%rsi
+    22d8:	|         48 89 c7             	mov    %rax,%rdi
+    22db:	|         e8 78 01 00 00       	call   2458 <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>
+        }
+    22e0:	\-------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22e4:	          c9                   	leave
+    22e5:	          c3                   	ret
+
+00000000000022e6 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>:
+
+        static void free(void *const p, Length const align, Length const size)
+    22e6:	       55                   	push   %rbp
+    22e7:	       48 89 e5             	mov    %rsp,%rbp
+    22ea:	       48 83 ec 20          	sub    $0x20,%rsp
+    22ee:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    22f2:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    22f6:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+    22fa:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22fe:	       48 89 c7             	mov    %rax,%rdi
+    2301:	       e8 21 00 00 00       	call   2327 <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+    2306:	       84 c0                	test   %al,%al
+    2308:	/----- 74 0e                	je     2318 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x32>
+                free_aligned(p);
+    230a:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    230e:	|      48 89 c7             	mov    %rax,%rdi
+    2311:	|      e8 ea 32 00 00       	call   5600 <nel::free_aligned(void*)>
+            } else {
+                std::free(p);
+            }
+        }
+    2316:	|  /-- eb 0c                	jmp    2324 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x3e>
+                std::free(p);
+    2318:	\--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    231c:	   |   48 89 c7             	mov    %rax,%rdi
+    231f:	   |   e8 0c ed ff ff       	call   1030 <free@plt>
+        }
+    2324:	   \-> 90                   	nop
+    2325:	       c9                   	leave
+    2326:	       c3                   	ret
+
+0000000000002327 <nel::heaped::Malloc::is_over_aligned(unsigned long)>:
+
+    private:
+        static constexpr bool is_over_aligned(Length const align)
+    2327:	55                   	push   %rbp
+    2328:	48 89 e5             	mov    %rsp,%rbp
+    232b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return align > alignof(std::max_align_t);
+    232f:	48 83 7d f8 10       	cmpq   $0x10,-0x8(%rbp)
+    2334:	0f 97 c0             	seta   %al
+        }
+    2337:	5d                   	pop    %rbp
+    2338:	c3                   	ret
+
+0000000000002339 <nel::sort::log2(unsigned long)>:
+// Above this many items, use the median of 3 medians of 3 as pivot.
+static constexpr Length ninther_n = 128;
+
+// floor(log2(n)), n > 0.
+constexpr Count log2(Length n)
+{
+    2339:	       55                   	push   %rbp
+    233a:	       48 89 e5             	mov    %rsp,%rbp
+    233d:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Count l = 0;
+    2341:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    2348:	       00 
+    while (n > 1) {
+    2349:	   /-- eb 10                	jmp    235b <nel::sort::log2(unsigned long)+0x22>
+        n /= 2;
+    234b:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    234f:	|  |   48 d1 e8             	shr    %rax
+    2352:	|  |   48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        l += 1;
+    2356:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (n > 1) {
+    235b:	|  \-> 48 83 7d e8 01       	cmpq   $0x1,-0x18(%rbp)
+    2360:	\----- 77 e9                	ja     234b <nel::sort::log2(unsigned long)+0x12>
+    }
+    return l;
+    2362:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2366:	       5d                   	pop    %rbp
+    2367:	       c3                   	ret
+
+0000000000002368 <nel::Slice<int>::len() const>:
+        /**
+         * Determine numer of elements in the slice.
+         *
+         * @returns number of elements in the slice.
+         */
+        constexpr Length len(void) const
+    2368:	55                   	push   %rbp
+    2369:	48 89 e5             	mov    %rsp,%rbp
+    236c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return len_;
+    2370:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2374:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    2378:	5d                   	pop    %rbp
+    2379:	c3                   	ret
+
+000000000000237a <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()>:
+         * Slice does not own the contents, vector does (vector is still valid).
+         * Slice is invalidated if Vector goes out of scope/destroyed.
+         *
+         * @returns a slice over the the vector.
+         */
+        constexpr Slice<Type> slice(void)
+    237a:	       55                   	push   %rbp
+    237b:	       48 89 e5             	mov    %rsp,%rbp
+    237e:	       48 83 ec 10          	sub    $0x10,%rsp
+    2382:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2386:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            return (item_ == nullptr) ? Slice<Type>::empty() : item_->slice();
+    238a:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    238e:	       48 8b 00             	mov    (%rax),%rax
+    2391:	       48 85 c0             	test   %rax,%rax
+    2394:	   /-- 75 0e                	jne    23a4 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()+0x2a>
+    2396:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    239a:	   |   48 89 c7             	mov    %rax,%rdi
+    239d:	   |   e8 ed 02 00 00       	call   268f <nel::Slice<int>::empty()>
+    23a2:	/--|-- eb 16                	jmp    23ba <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()+0x40>
+    23a4:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    23a8:	|      48 8b 10             	mov    (%rax),%rdx
+    23ab:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23af:	|      48 89 d6             	mov    %rdx,%rsi
+    23b2:	|      48 89 c7             	mov    %rax,%rdi
+    23b5:	|      e8 f4 02 00 00       	call   26ae <nel::heaped::Node<int, nel::heaped::Malloc>::slice()>
+        }
+    23ba:	\----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23be:	       c9                   	leave
+    23bf:	       c3                   	ret
+
+00000000000023c0 <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+                Element<T> ok_;
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    23c0:	             55                   	push   %rbp
+    23c1:	             48 89 e5             	mov    %rsp,%rbp
+    23c4:	             48 83 ec 30          	sub    $0x30,%rsp
+    23c8:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result::dtor
+    23cc:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    23d0:	             8b 00                	mov    (%rax),%eax
+    23d2:	             83 f8 02             	cmp    $0x2,%eax
+    23d5:	/----------- 74 43                	je     241a <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5a>
+    23d7:	|            83 f8 02             	cmp    $0x2,%eax
+    23da:	|        /-- 7f 09                	jg     23e5 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x25>
+    23dc:	|        |   85 c0                	test   %eax,%eax
+    23de:	|  /-----|-- 74 3d                	je     241d <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5d>
+    23e0:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    23e3:	|  |  /--|-- 74 3b                	je     2420 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x60>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    23e5:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    23e9:	|  |  |      b9 72 00 00 00       	mov    $0x72,%ecx
+    23ee:	|  |  |      48 8d 15 47 3d 00 00 	lea    0x3d47(%rip),%rdx        # 613c <n_values+0x104>
+    23f5:	|  |  |      48 8d 35 52 3d 00 00 	lea    0x3d52(%rip),%rsi        # 614e <n_values+0x116>
+    23fc:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    23ff:	|  |  |      e8 a6 fd ff ff       	call   21aa <nel::Context::Context(char const*, char const*, int)>
+    2404:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2408:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    240b:	|  |  |      48 8d 05 44 3d 00 00 	lea    0x3d44(%rip),%rax        # 6156 <n_values+0x11e>
+    2412:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2415:	|  |  |      e8 23 2b 00 00       	call   4f3d <nel::panic(char const*, nel::Context const&)>
+                    break;
+    241a:	\--|--|----> 90                   	nop
+    241b:	   |  |  /-- eb 04                	jmp    2421 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    241d:	   \--|--|-> 90                   	nop
+    241e:	      |  +-- eb 01                	jmp    2421 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    2420:	      \--|-> 90                   	nop
+                    break;
+            }
+        }
+    2421:	         \-> 90                   	nop
+    2422:	             c9                   	leave
+    2423:	             c3                   	ret
+
+0000000000002424 <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>:
+         *
+         * @param val The value to move into the result as an err value.
+         *
+         * @returns a Result 'wrapping' the value given as an err value.
+         */
+        constexpr static Result Err(E &&val)
+    2424:	55                   	push   %rbp
+    2425:	48 89 e5             	mov    %rsp,%rbp
+    2428:	48 83 ec 10          	sub    $0x10,%rsp
+    242c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2430:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            return Result(Phantom<Tag::ERR>(), forward<E>(val));
+    2434:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2438:	48 89 c7             	mov    %rax,%rdi
+    243b:	e8 ff 04 00 00       	call   293f <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    2440:	48 89 c2             	mov    %rax,%rdx
+    2443:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2447:	48 89 d6             	mov    %rdx,%rsi
+    244a:	48 89 c7             	mov    %rax,%rdi
+    244d:	e8 fc 04 00 00       	call   294e <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>
+        }
+    2452:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2456:	c9                   	leave
+    2457:	c3                   	ret
+
+0000000000002458 <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>:
+        constexpr static Result Ok(Args &&...args)
+    2458:	55                   	push   %rbp
+    2459:	48 89 e5             	mov    %rsp,%rbp
+    245c:	48 83 ec 10          	sub    $0x10,%rsp
+    2460:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2464:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<Args>(args)...);
+    2468:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    246c:	48 89 c7             	mov    %rax,%rdi
+    246f:	e8 1b 05 00 00       	call   298f <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    2474:	48 89 c2             	mov    %rax,%rdx
+    2477:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    247b:	48 89 d6             	mov    %rdx,%rsi
+    247e:	48 89 c7             	mov    %rax,%rdi
+    2481:	e8 18 05 00 00       	call   299e <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>
+        }
+    2486:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    248a:	c9                   	leave
+    248b:	c3                   	ret
+
+000000000000248c <nel::Slice<int>::ptr() const>:
+        constexpr Type *ptr(void) const
+    248c:	55                   	push   %rbp
+    248d:	48 89 e5             	mov    %rsp,%rbp
+    2490:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return content_;
+    2494:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2498:	48 8b 00             	mov    (%rax),%rax
+        }
+    249b:	5d                   	pop    %rbp
+    249c:	c3                   	ret
+
+000000000000249d <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>:
+        static constexpr Vector with_capacity(Count cap)
+    249d:	       55                   	push   %rbp
+    249e:	       48 89 e5             	mov    %rsp,%rbp
+    24a1:	       48 83 ec 20          	sub    $0x20,%rsp
+    24a5:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    24a9:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            if (cap == 0) { return Vector(); }
+    24ad:	       48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    24b2:	   /-- 75 0e                	jne    24c2 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x25>
+    24b4:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24b8:	   |   48 89 c7             	mov    %rax,%rdi
+    24bb:	   |   e8 20 05 00 00       	call   29e0 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector()>
+    24c0:	/--|-- eb 3d                	jmp    24ff <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x62>
+            Vector a(VectorNode::malloc(cap));
+    24c2:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    24c6:	|      48 89 c7             	mov    %rax,%rdi
+    24c9:	|      e8 28 05 00 00       	call   29f6 <nel::heaped::Node<int, nel::heaped::Malloc>::malloc(unsigned long)>
+    24ce:	|      48 89 c2             	mov    %rax,%rdx
+    24d1:	|      48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    24d5:	|      48 89 d6             	mov    %rdx,%rsi
+    24d8:	|      48 89 c7             	mov    %rax,%rdi
+    24db:	|      e8 50 05 00 00       	call   2a30 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Node<int, nel::heaped::Malloc>*)>
+            return a;
+    24e0:	|      48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    24e4:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24e8:	|      48 89 d6             	mov    %rdx,%rsi
+    24eb:	|      48 89 c7             	mov    %rax,%rdi
+    24ee:	|      e8 57 05 00 00       	call   2a4a <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >&&)>
+        }
+    24f3:	|      48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    24f7:	|      48 89 c7             	mov    %rax,%rdi
+    24fa:	|      e8 07 00 00 00       	call   2506 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    24ff:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2503:	       c9                   	leave
+    2504:	       c3                   	ret
+    2505:	       90                   	nop
+
+0000000000002506 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>:
+        ~Vector(void)
+    2506:	55                   	push   %rbp
+    2507:	48 89 e5             	mov    %rsp,%rbp
+    250a:	48 83 ec 10          	sub    $0x10,%rsp
+    250e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            VectorNode::free(item_);
+    2512:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2516:	48 8b 00             	mov    (%rax),%rax
+    2519:	48 89 c7             	mov    %rax,%rdi
+    251c:	e8 73 05 00 00       	call   2a94 <nel::heaped::Node<int, nel::heaped::Malloc>::free(nel::heaped::Node<int, nel::heaped::Malloc>*)>
+        }
+    2521:	90                   	nop
+    2522:	c9                   	leave
+    2523:	c3                   	ret
+
+0000000000002524 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>:
+         *
+         * @param val The value to move into the vec.
+         * @returns if successful, Result<void, T>::Ok()
+         * @returns if unsuccessful, Result<void, T>::Err() holding val
+         */
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+    2524:	       55                   	push   %rbp
+    2525:	       48 89 e5             	mov    %rsp,%rbp
+    2528:	       48 83 ec 30          	sub    $0x30,%rsp
+    252c:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2530:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2534:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+        {
+            bool ok;
+            ok = try_reserve_for(1);
+    2538:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    253c:	       be 01 00 00 00       	mov    $0x1,%esi
+    2541:	       48 89 c7             	mov    %rax,%rdi
+    2544:	       e8 97 05 00 00       	call   2ae0 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>
+    2549:	       88 45 ff             	mov    %al,-0x1(%rbp)
+            if (!ok) { return Result<void, Type>::Err(val); }
+    254c:	       0f b6 45 ff          	movzbl -0x1(%rbp),%eax
+    2550:	       83 f0 01             	xor    $0x1,%eax
+    2553:	       84 c0                	test   %al,%al
+    2555:	   /-- 74 15                	je     256c <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x48>
+    2557:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    255b:	   |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    255f:	   |   48 89 d6             	mov    %rdx,%rsi
+    2562:	   |   48 89 c7             	mov    %rax,%rdi
+    2565:	   |   e8 e1 05 00 00       	call   2b4b <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    256a:	/--|-- eb 3b                	jmp    25a7 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x83>
+            if (item_ == nullptr) { return Result<void, Type>::Err(val); }
+    256c:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2570:	|      48 8b 00             	mov    (%rax),%rax
+    2573:	|      48 85 c0             	test   %rax,%rax
+    2576:	|  /-- 75 15                	jne    258d <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x69>
+    2578:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    257c:	|  |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2580:	|  |   48 89 d6             	mov    %rdx,%rsi
+    2583:	|  |   48 89 c7             	mov    %rax,%rdi
+    2586:	|  |   e8 c0 05 00 00       	call   2b4b <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    258b:	+--|-- eb 1a                	jmp    25a7 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x83>
+            return item_->push_back(val);
+    258d:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2591:	|      48 8b 08             	mov    (%rax),%rcx
+    2594:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2598:	|      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    259c:	|      48 89 ce             	mov    %rcx,%rsi
+    259f:	|      48 89 c7             	mov    %rax,%rdi
+    25a2:	|      e8 d9 05 00 00       	call   2b80 <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int&>(int&)>
+        }
+    25a7:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25ab:	       c9                   	leave
+    25ac:	       c3                   	ret
+    25ad:	       90                   	nop
+
+00000000000025ae <nel::Result<void, int>::~Result()>:
+        union {
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    25ae:	             55                   	push   %rbp
+    25af:	             48 89 e5             	mov    %rsp,%rbp
+    25b2:	             48 83 ec 30          	sub    $0x30,%rsp
+    25b6:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result<void>-dtor
+    25ba:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    25be:	             8b 00                	mov    (%rax),%eax
+    25c0:	             83 f8 02             	cmp    $0x2,%eax
+    25c3:	/----------- 74 43                	je     2608 <nel::Result<void, int>::~Result()+0x5a>
+    25c5:	|            83 f8 02             	cmp    $0x2,%eax
+    25c8:	|        /-- 7f 09                	jg     25d3 <nel::Result<void, int>::~Result()+0x25>
+    25ca:	|        |   85 c0                	test   %eax,%eax
+    25cc:	|  /-----|-- 74 3d                	je     260b <nel::Result<void, int>::~Result()+0x5d>
+    25ce:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    25d1:	|  |  /--|-- 74 3b                	je     260e <nel::Result<void, int>::~Result()+0x60>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    25d3:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    25d7:	|  |  |      b9 dd 02 00 00       	mov    $0x2dd,%ecx
+    25dc:	|  |  |      48 8d 15 59 3b 00 00 	lea    0x3b59(%rip),%rdx        # 613c <n_values+0x104>
+    25e3:	|  |  |      48 8d 35 64 3b 00 00 	lea    0x3b64(%rip),%rsi        # 614e <n_values+0x116>
+    25ea:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    25ed:	|  |  |      e8 b8 fb ff ff       	call   21aa <nel::Context::Context(char const*, char const*, int)>
+    25f2:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    25f6:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    25f9:	|  |  |      48 8d 05 56 3b 00 00 	lea    0x3b56(%rip),%rax        # 6156 <n_values+0x11e>
+    2600:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2603:	|  |  |      e8 35 29 00 00       	call   4f3d <nel::panic(char const*, nel::Context const&)>
+                    break;
+    2608:	\--|--|----> 90                   	nop
+    2609:	   |  |  /-- eb 04                	jmp    260f <nel::Result<void, int>::~Result()+0x61>
+                    break;
+    260b:	   \--|--|-> 90                   	nop
+    260c:	      |  +-- eb 01                	jmp    260f <nel::Result<void, int>::~Result()+0x61>
+                    break;
+    260e:	      \--|-> 90                   	nop
+                    break;
+            }
+        }
+    260f:	         \-> 90                   	nop
+    2610:	             c9                   	leave
+    2611:	             c3                   	ret
+
+0000000000002612 <nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}::operator()() const>:
+         *
+         * `this` is consumed by the operation.
+         */
+        constexpr void unwrap(Context const &ctx = Context())
+        {
+            return consumev([](void) {}, [](E &&) { nel::panic("not an ok"); }, ctx);
+    2612:	55                   	push   %rbp
+    2613:	48 89 e5             	mov    %rsp,%rbp
+    2616:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    261a:	90                   	nop
+    261b:	5d                   	pop    %rbp
+    261c:	c3                   	ret
+    261d:	90                   	nop
+
+000000000000261e <nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}::operator()(int&&) const>:
+    261e:	55                   	push   %rbp
+    261f:	48 89 e5             	mov    %rsp,%rbp
+    2622:	48 83 ec 30          	sub    $0x30,%rsp
+    2626:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    262a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    262e:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2632:	b9 1f 04 00 00       	mov    $0x41f,%ecx
+    2637:	48 8d 15 fe 3a 00 00 	lea    0x3afe(%rip),%rdx        # 613c <n_values+0x104>
+    263e:	48 8d 35 1c 3b 00 00 	lea    0x3b1c(%rip),%rsi        # 6161 <n_values+0x129>
+    2645:	48 89 c7             	mov    %rax,%rdi
+    2648:	e8 5d fb ff ff       	call   21aa <nel::Context::Context(char const*, char const*, int)>
+    264d:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2651:	48 89 c6             	mov    %rax,%rsi
+    2654:	48 8d 05 11 3b 00 00 	lea    0x3b11(%rip),%rax        # 616c <n_values+0x134>
+    265b:	48 89 c7             	mov    %rax,%rdi
+    265e:	e8 da 28 00 00       	call   4f3d <nel::panic(char const*, nel::Context const&)>
+    2663:	90                   	nop
+
+0000000000002664 <nel::Result<void, int>::unwrap(nel::Context const&)>:
+        constexpr void unwrap(Context const &ctx = Context())
+    2664:	55                   	push   %rbp
+    2665:	48 89 e5             	mov    %rsp,%rbp
+    2668:	48 83 ec 20          	sub    $0x20,%rsp
+    266c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2670:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return consumev([](void) {}, [](E &&) { nel::panic("not an ok"); }, ctx);
+    2674:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2678:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    267c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    2680:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2684:	48 89 c7             	mov    %rax,%rdi
+    2687:	e8 b8 05 00 00       	call   2c44 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)>
+    268c:	90                   	nop
+        }
+    268d:	c9                   	leave
+    268e:	c3                   	ret
+
+000000000000268f <nel::Slice<int>::empty()>:
+        static constexpr Slice empty(void)
+    268f:	55                   	push   %rbp
+    2690:	48 89 e5             	mov    %rsp,%rbp
+    2693:	48 83 ec 10          	sub    $0x10,%rsp
+    2697:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Slice();
+    269b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    269f:	48 89 c7             	mov    %rax,%rdi
+    26a2:	e8 49 06 00 00       	call   2cf0 <nel::Slice<int>::Slice()>
+        }
+    26a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26ab:	c9                   	leave
+    26ac:	c3                   	ret
+    26ad:	90                   	nop
+
+00000000000026ae <nel::heaped::Node<int, nel::heaped::Malloc>::slice()>:
+        {
+            return len() == 0;
+        }
+
+    public:
+        constexpr Slice<Type> slice(void)
+    26ae:	55                   	push   %rbp
+    26af:	48 89 e5             	mov    %rsp,%rbp
+    26b2:	48 83 ec 10          	sub    $0x10,%rsp
+    26b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    26ba:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            return Slice(values_, len());
+    26be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26c2:	48 89 c7             	mov    %rax,%rdi
+    26c5:	e8 48 06 00 00       	call   2d12 <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    26ca:	48 89 c2             	mov    %rax,%rdx
+    26cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26d1:	48 8d 48 10          	lea    0x10(%rax),%rcx
+    26d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26d9:	48 89 ce             	mov    %rcx,%rsi
+    26dc:	48 89 c7             	mov    %rax,%rdi
+    26df:	e8 40 06 00 00       	call   2d24 <nel::Slice<int>::Slice(int*, unsigned long)>
+        }
+    26e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26e8:	c9                   	leave
+    26e9:	c3                   	ret
+
+00000000000026ea <void nel::Slice<int>::sort_unstable<nel::sort::Less>(nel::sort::Less&&)>:
+         *
+         * Pattern-defeating quicksort, O(n log n) worst case,
+         * O(n) if already sorted, reverse sorted or all equal.
+         */
+        template<typename F = sort::Less>
+        void sort_unstable(F &&less = F())
+    26ea:	55                   	push   %rbp
+    26eb:	48 89 e5             	mov    %rsp,%rbp
+    26ee:	53                   	push   %rbx
+    26ef:	48 83 ec 18          	sub    $0x18,%rsp
+    26f3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    26f7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            sort::unstable(ptr(), len(), less);
+    26fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26ff:	48 89 c7             	mov    %rax,%rdi
+    2702:	e8 61 fc ff ff       	call   2368 <nel::Slice<int>::len() const>
+    2707:	48 89 c3             	mov    %rax,%rbx
+    270a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    270e:	48 89 c7             	mov    %rax,%rdi
+    2711:	e8 76 fd ff ff       	call   248c <nel::Slice<int>::ptr() const>
+    2716:	48 89 c1             	mov    %rax,%rcx
+    2719:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    271d:	48 89 c2             	mov    %rax,%rdx
+    2720:	48 89 de             	mov    %rbx,%rsi
+    2723:	48 89 cf             	mov    %rcx,%rdi
+    2726:	e8 23 06 00 00       	call   2d4e <void nel::sort::unstable<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>
+        }
+    272b:	90                   	nop
+    272c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2730:	c9                   	leave
+    2731:	c3                   	ret
+
+0000000000002732 <void nel::Slice<int>::sort<nel::sort::Less>(nel::sort::Less&&)>:
+         *
+         * Merge sort in place, O(n log^2 n).
+         * Use sort_with() and some scratch space for O(n log n).
+         */
+        template<typename F = sort::Less>
+        void sort(F &&less = F())
+    2732:	55                   	push   %rbp
+    2733:	48 89 e5             	mov    %rsp,%rbp
+    2736:	53                   	push   %rbx
+    2737:	48 83 ec 18          	sub    $0x18,%rsp
+    273b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    273f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            sort::stable(ptr(), len(), static_cast<Type *>(nullptr), 0, less);
+    2743:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2747:	48 89 c7             	mov    %rax,%rdi
+    274a:	e8 19 fc ff ff       	call   2368 <nel::Slice<int>::len() const>
+    274f:	48 89 c3             	mov    %rax,%rbx
+    2752:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2756:	48 89 c7             	mov    %rax,%rdi
+    2759:	e8 2e fd ff ff       	call   248c <nel::Slice<int>::ptr() const>
+    275e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2762:	49 89 d0             	mov    %rdx,%r8
+    2765:	b9 00 00 00 00       	mov    $0x0,%ecx
+    276a:	ba 00 00 00 00       	mov    $0x0,%edx
+    276f:	48 89 de             	mov    %rbx,%rsi
+    2772:	48 89 c7             	mov    %rax,%rdi
+    2775:	e8 1d 06 00 00       	call   2d97 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&)>
+        }
+    277a:	90                   	nop
+    277b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    277f:	c9                   	leave
+    2780:	c3                   	ret
+    2781:	90                   	nop
+
+0000000000002782 <void nel::Slice<int>::sort_with<nel::sort::Less>(nel::Slice<int> const&, nel::sort::Less&&)>:
+         * less scratch still helps, none is the same as sort().
+         *
+         * @param scratch items to use as temporary storage, left in a moved-from state.
+         */
+        template<typename F = sort::Less>
+        void sort_with(Slice const &scratch, F &&less = F())
+    2782:	55                   	push   %rbp
+    2783:	48 89 e5             	mov    %rsp,%rbp
+    2786:	41 55                	push   %r13
+    2788:	41 54                	push   %r12
+    278a:	53                   	push   %rbx
+    278b:	48 83 ec 28          	sub    $0x28,%rsp
+    278f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    2793:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    2797:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+        {
+            sort::stable(ptr(), len(), scratch.ptr(), scratch.len(), less);
+    279b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    279f:	48 89 c7             	mov    %rax,%rdi
+    27a2:	e8 c1 fb ff ff       	call   2368 <nel::Slice<int>::len() const>
+    27a7:	49 89 c5             	mov    %rax,%r13
+    27aa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    27ae:	48 89 c7             	mov    %rax,%rdi
+    27b1:	e8 d6 fc ff ff       	call   248c <nel::Slice<int>::ptr() const>
+    27b6:	49 89 c4             	mov    %rax,%r12
+    27b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    27bd:	48 89 c7             	mov    %rax,%rdi
+    27c0:	e8 a3 fb ff ff       	call   2368 <nel::Slice<int>::len() const>
+    27c5:	48 89 c3             	mov    %rax,%rbx
+    27c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    27cc:	48 89 c7             	mov    %rax,%rdi
+    27cf:	e8 b8 fc ff ff       	call   248c <nel::Slice<int>::ptr() const>
+    27d4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    27d8:	49 89 d0             	mov    %rdx,%r8
+    27db:	4c 89 e9             	mov    %r13,%rcx
+    27de:	4c 89 e2             	mov    %r12,%rdx
+    27e1:	48 89 de             	mov    %rbx,%rsi
+    27e4:	48 89 c7             	mov    %rax,%rdi
+    27e7:	e8 ab 05 00 00       	call   2d97 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&)>
+        }
+    27ec:	90                   	nop
+    27ed:	48 83 c4 28          	add    $0x28,%rsp
+    27f1:	5b                   	pop    %rbx
+    27f2:	41 5c                	pop    %r12
+    27f4:	41 5d                	pop    %r13
+    27f6:	5d                   	pop    %rbp
+    27f7:	c3                   	ret
+
+00000000000027f8 <void nel::Slice<int>::partial_sort<nel::sort::Less>(unsigned long, nel::sort::Less&&)>:
+         * O(n + k log k), equal items may be reordered.
+         *
+         * @param k number of items to sort, sorts all if k >= len().
+         */
+        template<typename F = sort::Less>
+        void partial_sort(Length k, F &&less = F())
+    27f8:	       55                   	push   %rbp
+    27f9:	       48 89 e5             	mov    %rsp,%rbp
+    27fc:	       53                   	push   %rbx
+    27fd:	       48 83 ec 28          	sub    $0x28,%rsp
+    2801:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2805:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2809:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+        {
+            if (k < len()) {
+    280d:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2811:	       48 89 c7             	mov    %rax,%rdi
+    2814:	       e8 4f fb ff ff       	call   2368 <nel::Slice<int>::len() const>
+    2819:	       48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    281d:	       0f 92 c0             	setb   %al
+    2820:	       84 c0                	test   %al,%al
+    2822:	/----- 74 36                	je     285a <void nel::Slice<int>::partial_sort<nel::sort::Less>(unsigned long, nel::sort::Less&&)+0x62>
+                sort::select_nth(ptr(), len(), k, less);
+    2824:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2828:	|      48 89 c7             	mov    %rax,%rdi
+    282b:	|      e8 38 fb ff ff       	call   2368 <nel::Slice<int>::len() const>
+    2830:	|      48 89 c3             	mov    %rax,%rbx
+    2833:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2837:	|      48 89 c7             	mov    %rax,%rdi
+    283a:	|      e8 4d fc ff ff       	call   248c <nel::Slice<int>::ptr() const>
+    283f:	|      48 89 c7             	mov    %rax,%rdi
+    2842:	|      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2846:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    284a:	|      48 89 d1             	mov    %rdx,%rcx
+    284d:	|      48 89 c2             	mov    %rax,%rdx
+    2850:	|      48 89 de             	mov    %rbx,%rsi
+    2853:	|      e8 03 06 00 00       	call   2e5b <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)>
+    2858:	|  /-- eb 10                	jmp    286a <void nel::Slice<int>::partial_sort<nel::sort::Less>(unsigned long, nel::sort::Less&&)+0x72>
+            } else {
+                k = len();
+    285a:	\--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    285e:	   |   48 89 c7             	mov    %rax,%rdi
+    2861:	   |   e8 02 fb ff ff       	call   2368 <nel::Slice<int>::len() const>
+    2866:	   |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            }
+            sort::unstable(ptr(), k, less);
+    286a:	   \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    286e:	       48 89 c7             	mov    %rax,%rdi
+    2871:	       e8 16 fc ff ff       	call   248c <nel::Slice<int>::ptr() const>
+    2876:	       48 89 c1             	mov    %rax,%rcx
+    2879:	       48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    287d:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2881:	       48 89 c6             	mov    %rax,%rsi
+    2884:	       48 89 cf             	mov    %rcx,%rdi
+    2887:	       e8 c2 04 00 00       	call   2d4e <void nel::sort::unstable<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>
+        }
+    288c:	       90                   	nop
+    288d:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2891:	       c9                   	leave
+    2892:	       c3                   	ret
+    2893:	       90                   	nop
+
+0000000000002894 <int& nel::Slice<int>::select_nth_unstable<nel::sort::Less>(unsigned long, nel::sort::Less&&)>:
+        Type &select_nth_unstable(Index idx, F &&less = F())
+    2894:	55                   	push   %rbp
+    2895:	48 89 e5             	mov    %rsp,%rbp
+    2898:	53                   	push   %rbx
+    2899:	48 83 ec 48          	sub    $0x48,%rsp
+    289d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    28a1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    28a5:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+            nel::panic_if_not(idx < len(), "nel::Slice::select_nth_unstable: index out of range");
+    28a9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    28ad:	b9 9f 02 00 00       	mov    $0x29f,%ecx
+    28b2:	48 8d 15 cc 38 00 00 	lea    0x38cc(%rip),%rdx        # 6185 <n_values+0x14d>
+    28b9:	48 8d 35 d6 38 00 00 	lea    0x38d6(%rip),%rsi        # 6196 <n_values+0x15e>
+    28c0:	48 89 c7             	mov    %rax,%rdi
+    28c3:	e8 e2 f8 ff ff       	call   21aa <nel::Context::Context(char const*, char const*, int)>
+    28c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    28cc:	48 89 c7             	mov    %rax,%rdi
+    28cf:	e8 94 fa ff ff       	call   2368 <nel::Slice<int>::len() const>
+    28d4:	48 39 45 c0          	cmp    %rax,-0x40(%rbp)
+    28d8:	0f 92 c0             	setb   %al
+    28db:	0f b6 c0             	movzbl %al,%eax
+    28de:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    28e2:	48 8d 0d c7 38 00 00 	lea    0x38c7(%rip),%rcx        # 61b0 <n_values+0x178>
+    28e9:	48 89 ce             	mov    %rcx,%rsi
+    28ec:	89 c7                	mov    %eax,%edi
+    28ee:	e8 ee f8 ff ff       	call   21e1 <nel::panic_if_not(bool, char const*, nel::Context const&)>
+            sort::select_nth(ptr(), len(), idx, less);
+    28f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    28f7:	48 89 c7             	mov    %rax,%rdi
+    28fa:	e8 69 fa ff ff       	call   2368 <nel::Slice<int>::len() const>
+    28ff:	48 89 c3             	mov    %rax,%rbx
+    2902:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2906:	48 89 c7             	mov    %rax,%rdi
+    2909:	e8 7e fb ff ff       	call   248c <nel::Slice<int>::ptr() const>
+    290e:	48 89 c7             	mov    %rax,%rdi
+    2911:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    2915:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2919:	48 89 d1             	mov    %rdx,%rcx
+    291c:	48 89 c2             	mov    %rax,%rdx
+    291f:	48 89 de             	mov    %rbx,%rsi
+    2922:	e8 34 05 00 00       	call   2e5b <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)>
+            return content_[idx];
+    2927:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    292b:	48 8b 00             	mov    (%rax),%rax
+    292e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    2932:	48 c1 e2 02          	shl    $0x2,%rdx
+    2936:	48 01 d0             	add    %rdx,%rax
+        }
+    2939:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    293d:	c9                   	leave
+    293e:	c3                   	ret
+
+000000000000293f <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel so to not need std.
+ */
+template<typename U, typename T>
+constexpr U &&forward(T &t)
+    293f:	55                   	push   %rbp
+    2940:	48 89 e5             	mov    %rsp,%rbp
+    2943:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<U &&>(t);
+    2947:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    294b:	5d                   	pop    %rbp
+    294c:	c3                   	ret
+    294d:	90                   	nop
+
+000000000000294e <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    294e:	55                   	push   %rbp
+    294f:	48 89 e5             	mov    %rsp,%rbp
+    2952:	53                   	push   %rbx
+    2953:	48 83 ec 18          	sub    $0x18,%rsp
+    2957:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    295b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    295f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2963:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    2969:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    296d:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    2971:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2975:	48 89 c7             	mov    %rax,%rdi
+    2978:	e8 c2 ff ff ff       	call   293f <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    297d:	48 89 c6             	mov    %rax,%rsi
+    2980:	48 89 df             	mov    %rbx,%rdi
+    2983:	e8 9a 06 00 00       	call   3022 <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>
+        }
+    2988:	90                   	nop
+    2989:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    298d:	c9                   	leave
+    298e:	c3                   	ret
+
+000000000000298f <void* const& nel::forward<void* const&, void* const>(void* const&)>:
+constexpr U &&forward(T &t)
+    298f:	55                   	push   %rbp
+    2990:	48 89 e5             	mov    %rsp,%rbp
+    2993:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    2997:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    299b:	5d                   	pop    %rbp
+    299c:	c3                   	ret
+    299d:	90                   	nop
+
+000000000000299e <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>:
+        constexpr Result(Phantom<Tag::OK> const, Args &&...args)
+    299e:	55                   	push   %rbp
+    299f:	48 89 e5             	mov    %rsp,%rbp
+    29a2:	53                   	push   %rbx
+    29a3:	48 83 ec 18          	sub    $0x18,%rsp
+    29a7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    29ab:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    29af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    29b3:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<Args>(args)...)
+    29b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    29bd:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    29c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29c5:	48 89 c7             	mov    %rax,%rdi
+    29c8:	e8 c2 ff ff ff       	call   298f <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    29cd:	48 89 c6             	mov    %rax,%rsi
+    29d0:	48 89 df             	mov    %rbx,%rdi
+    29d3:	e8 72 06 00 00       	call   304a <nel::Element<void*>::Element<void* const&>(void* const&)>
+        }
+    29d8:	90                   	nop
+    29d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    29dd:	c9                   	leave
+    29de:	c3                   	ret
+    29df:	90                   	nop
+
+00000000000029e0 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector()>:
+        constexpr Vector(void)
+    29e0:	55                   	push   %rbp
+    29e1:	48 89 e5             	mov    %rsp,%rbp
+    29e4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : item_(nullptr)
+    29e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29ec:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        }
+    29f3:	90                   	nop
+    29f4:	5d                   	pop    %rbp
+    29f5:	c3                   	ret
+
+00000000000029f6 <nel::heaped::Node<int, nel::heaped::Malloc>::malloc(unsigned long)>:
+        static Node *malloc(Count capacity)
+    29f6:	    55                   	push   %rbp
+    29f7:	    48 89 e5             	mov    %rsp,%rbp
+    29fa:	    48 83 ec 20          	sub    $0x20,%rsp
+    29fe:	    48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            Node *new_n = realloc(nullptr, capacity);
+    2a02:	    48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a06:	    48 89 c6             	mov    %rax,%rsi
+    2a09:	    bf 00 00 00 00       	mov    $0x0,%edi
+    2a0e:	    e8 5a 07 00 00       	call   316d <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    2a13:	    48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    2a17:	    48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2a1c:	/-- 74 0c                	je     2a2a <nel::heaped::Node<int, nel::heaped::Malloc>::malloc(unsigned long)+0x34>
+    2a1e:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a22:	|   48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    2a29:	|   00 
+            return new_n;
+    2a2a:	\-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2a2e:	    c9                   	leave
+    2a2f:	    c3                   	ret
+
+0000000000002a30 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Node<int, nel::heaped::Malloc>*)>:
+        constexpr Vector(VectorNode *const n)
+    2a30:	55                   	push   %rbp
+    2a31:	48 89 e5             	mov    %rsp,%rbp
+    2a34:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2a38:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : item_(n)
+    2a3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a40:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2a44:	48 89 10             	mov    %rdx,(%rax)
+        }
+    2a47:	90                   	nop
+    2a48:	5d                   	pop    %rbp
+    2a49:	c3                   	ret
+
+0000000000002a4a <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >&&)>:
+        constexpr Vector(Vector &&o)
+    2a4a:	55                   	push   %rbp
+    2a4b:	48 89 e5             	mov    %rsp,%rbp
+    2a4e:	48 83 ec 10          	sub    $0x10,%rsp
+    2a52:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2a56:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : item_(move(o.item_))
+    2a5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a5e:	48 89 c7             	mov    %rax,%rdi
+    2a61:	e8 5d 08 00 00       	call   32c3 <nel::heaped::Node<int, nel::heaped::Malloc>*&& nel::move<nel::heaped::Node<int, nel::heaped::Malloc>*>(nel::heaped::Node<int, nel::heaped::Malloc>*&)>
+    2a66:	48 8b 10             	mov    (%rax),%rdx
+    2a69:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a6d:	48 89 10             	mov    %rdx,(%rax)
+            o.item_ = nullptr;
+    2a70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a74:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        }
+    2a7b:	90                   	nop
+    2a7c:	c9                   	leave
+    2a7d:	c3                   	ret
+
+0000000000002a7e <nel::heaped::Node<int, nel::heaped::Malloc>::size_of(unsigned long)>:
+        static constexpr Length size_of(Count const cap)
+    2a7e:	55                   	push   %rbp
+    2a7f:	48 89 e5             	mov    %rsp,%rbp
+    2a82:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    2a86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a8a:	48 83 c0 05          	add    $0x5,%rax
+    2a8e:	48 c1 e0 02          	shl    $0x2,%rax
+        }
+    2a92:	5d                   	pop    %rbp
+    2a93:	c3                   	ret
+
+0000000000002a94 <nel::heaped::Node<int, nel::heaped::Malloc>::free(nel::heaped::Node<int, nel::heaped::Malloc>*)>:
+        static void free(Node *old)
+    2a94:	       55                   	push   %rbp
+    2a95:	       48 89 e5             	mov    %rsp,%rbp
+    2a98:	       48 83 ec 20          	sub    $0x20,%rsp
+    2a9c:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            if (old == nullptr) { return; }
+    2aa0:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    2aa5:	/----- 74 36                	je     2add <nel::heaped::Node<int, nel::heaped::Malloc>::free(nel::heaped::Node<int, nel::heaped::Malloc>*)+0x49>
+            Length const sz = size_of(old->alloc_);
+    2aa7:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2aab:	|      48 8b 00             	mov    (%rax),%rax
+    2aae:	|      48 89 c7             	mov    %rax,%rdi
+    2ab1:	|      e8 c8 ff ff ff       	call   2a7e <nel::heaped::Node<int, nel::heaped::Malloc>::size_of(unsigned long)>
+    2ab6:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            old->~Node();
+    2aba:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2abe:	|      48 89 c7             	mov    %rax,%rdi
+    2ac1:	|      e8 0c 08 00 00       	call   32d2 <nel::heaped::Node<int, nel::heaped::Malloc>::~Node()>
+            Allocator::free(old, alignof(Node), sz);
+    2ac6:	|      48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2aca:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ace:	|      be 08 00 00 00       	mov    $0x8,%esi
+    2ad3:	|      48 89 c7             	mov    %rax,%rdi
+    2ad6:	|      e8 0b f8 ff ff       	call   22e6 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>
+    2adb:	|  /-- eb 01                	jmp    2ade <nel::heaped::Node<int, nel::heaped::Malloc>::free(nel::heaped::Node<int, nel::heaped::Malloc>*)+0x4a>
+            if (old == nullptr) { return; }
+    2add:	\--|-> 90                   	nop
+        }
+    2ade:	   \-> c9                   	leave
+    2adf:	       c3                   	ret
+
+0000000000002ae0 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>:
+        bool try_reserve_for(Count const n)
+    2ae0:	       55                   	push   %rbp
+    2ae1:	       48 89 e5             	mov    %rsp,%rbp
+    2ae4:	       53                   	push   %rbx
+    2ae5:	       48 83 ec 18          	sub    $0x18,%rsp
+    2ae9:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2aed:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            if (len() + n <= capacity()) { return true; }
+    2af1:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2af5:	       48 89 c7             	mov    %rax,%rdi
+    2af8:	       e8 0b 08 00 00       	call   3308 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    2afd:	       48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2b01:	       48 8d 1c 10          	lea    (%rax,%rdx,1),%rbx
+    2b05:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b09:	       48 89 c7             	mov    %rax,%rdi
+    2b0c:	       e8 27 08 00 00       	call   3338 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    2b11:	       48 39 d8             	cmp    %rbx,%rax
+    2b14:	       0f 93 c0             	setae  %al
+    2b17:	       84 c0                	test   %al,%al
+    2b19:	   /-- 74 07                	je     2b22 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x42>
+    2b1b:	   |   b8 01 00 00 00       	mov    $0x1,%eax
+    2b20:	/--|-- eb 23                	jmp    2b45 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x65>
+            return try_reserve(len() + n);
+    2b22:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b26:	|      48 89 c7             	mov    %rax,%rdi
+    2b29:	|      e8 da 07 00 00       	call   3308 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    2b2e:	|      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2b32:	|      48 01 c2             	add    %rax,%rdx
+    2b35:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b39:	|      48 89 d6             	mov    %rdx,%rsi
+    2b3c:	|      48 89 c7             	mov    %rax,%rdi
+    2b3f:	|      e8 24 08 00 00       	call   3368 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>
+    2b44:	|      90                   	nop
+        }
+    2b45:	\----> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2b49:	       c9                   	leave
+    2b4a:	       c3                   	ret
+
+0000000000002b4b <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>:
+        constexpr static Result Err(Args &&...args)
+    2b4b:	55                   	push   %rbp
+    2b4c:	48 89 e5             	mov    %rsp,%rbp
+    2b4f:	48 83 ec 10          	sub    $0x10,%rsp
+    2b53:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2b57:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    2b5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b5f:	48 89 c7             	mov    %rax,%rdi
+    2b62:	e8 54 09 00 00       	call   34bb <int& nel::forward<int&, int>(int&)>
+    2b67:	48 89 c2             	mov    %rax,%rdx
+    2b6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b6e:	48 89 d6             	mov    %rdx,%rsi
+    2b71:	48 89 c7             	mov    %rax,%rdi
+    2b74:	e8 51 09 00 00       	call   34ca <nel::Result<void, int>::Result<int&>(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)2>, int&)>
+        }
+    2b79:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b7d:	c9                   	leave
+    2b7e:	c3                   	ret
+    2b7f:	90                   	nop
+
+0000000000002b80 <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int&>(int&)>:
+            }
+        }
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+    2b80:	       55                   	push   %rbp
+    2b81:	       48 89 e5             	mov    %rsp,%rbp
+    2b84:	       53                   	push   %rbx
+    2b85:	       48 83 ec 28          	sub    $0x28,%rsp
+    2b89:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2b8d:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2b91:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+        {
+            if (len() >= capacity()) {
+    2b95:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2b99:	       48 89 c7             	mov    %rax,%rdi
+    2b9c:	       e8 71 01 00 00       	call   2d12 <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    2ba1:	       48 89 c3             	mov    %rax,%rbx
+    2ba4:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2ba8:	       48 89 c7             	mov    %rax,%rdi
+    2bab:	       e8 5c 09 00 00       	call   350c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    2bb0:	       48 39 c3             	cmp    %rax,%rbx
+    2bb3:	       0f 93 c0             	setae  %al
+    2bb6:	       84 c0                	test   %al,%al
+    2bb8:	   /-- 74 20                	je     2bda <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int&>(int&)+0x5a>
+                // TODO: don't want to create a T on error though..
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+    2bba:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2bbe:	   |   48 89 c7             	mov    %rax,%rdi
+    2bc1:	   |   e8 f5 08 00 00       	call   34bb <int& nel::forward<int&, int>(int&)>
+    2bc6:	   |   48 89 c2             	mov    %rax,%rdx
+    2bc9:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2bcd:	   |   48 89 d6             	mov    %rdx,%rsi
+    2bd0:	   |   48 89 c7             	mov    %rax,%rdi
+    2bd3:	   |   e8 73 ff ff ff       	call   2b4b <nel::Result<void, int> nel::Result<void, int>::Err<int&>(int&)>
+    2bd8:	/--|-- eb 5f                	jmp    2c39 <nel::Result<void, int> nel::heaped::Node<int, nel::heaped::Malloc>::push_back<int&>(int&)+0xb9>
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    2bda:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2bde:	|      48 89 c7             	mov    %rax,%rdi
+    2be1:	|      e8 2c 01 00 00       	call   2d12 <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    2be6:	|      48 83 c0 04          	add    $0x4,%rax
+    2bea:	|      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2bf1:	|      00 
+    2bf2:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2bf6:	|      48 01 d0             	add    %rdx,%rax
+    2bf9:	|      48 89 c6             	mov    %rax,%rsi
+    2bfc:	|      bf 04 00 00 00       	mov    $0x4,%edi
+    2c01:	|      e8 92 f5 ff ff       	call   2198 <operator new(unsigned long, void*)>
+    2c06:	|      48 89 c3             	mov    %rax,%rbx
+    2c09:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2c0d:	|      48 89 c7             	mov    %rax,%rdi
+    2c10:	|      e8 a6 08 00 00       	call   34bb <int& nel::forward<int&, int>(int&)>
+    2c15:	|      8b 00                	mov    (%rax),%eax
+    2c17:	|      89 03                	mov    %eax,(%rbx)
+            len_ += 1;
+    2c19:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2c1d:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    2c21:	|      48 8d 50 01          	lea    0x1(%rax),%rdx
+    2c25:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2c29:	|      48 89 50 08          	mov    %rdx,0x8(%rax)
+            return Result<void, Type>::Ok();
+    2c2d:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c31:	|      48 89 c7             	mov    %rax,%rdi
+    2c34:	|      e8 e4 08 00 00       	call   351d <nel::Result<void, int>::Ok()>
+        }
+    2c39:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c3d:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2c41:	       c9                   	leave
+    2c42:	       c3                   	ret
+    2c43:	       90                   	nop
+
+0000000000002c44 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)>:
+        constexpr void consumev(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    2c44:	             55                   	push   %rbp
+    2c45:	             48 89 e5             	mov    %rsp,%rbp
+    2c48:	             48 83 ec 30          	sub    $0x30,%rsp
+    2c4c:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2c50:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2c54:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    2c58:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    2c5c:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c60:	             8b 00                	mov    (%rax),%eax
+    2c62:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    2c65:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c69:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result<void>-consume
+    2c6f:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    2c73:	         /-- 74 20                	je     2c95 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)+0x51>
+    2c75:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    2c79:	/--------|-- 7f 5c                	jg     2cd7 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)+0x93>
+    2c7b:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2c7f:	|     /--|-- 74 40                	je     2cc1 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)+0x7d>
+    2c81:	|     |  |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    2c85:	+-----|--|-- 75 50                	jne    2cd7 <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)+0x93>
+                    on_ok();
+    2c87:	|     |  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2c8b:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    2c8e:	|     |  |   e8 7f f9 ff ff       	call   2612 <nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}::operator()() const>
+                    break;
+    2c93:	|  /--|--|-- eb 58                	jmp    2ced <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)+0xa9>
+                    on_err(nel::forward<E>(*err_));
+    2c95:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c99:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    2c9d:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2ca0:	|  |  |      e8 97 08 00 00       	call   353c <nel::Element<int>::operator*()>
+    2ca5:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2ca8:	|  |  |      e8 a9 08 00 00       	call   3556 <int&& nel::forward<int, int>(int&)>
+    2cad:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    2cb0:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2cb4:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    2cb7:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2cba:	|  |  |      e8 5f f9 ff ff       	call   261e <nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}::operator()(int&&) const>
+                    break;
+    2cbf:	|  +--|----- eb 2c                	jmp    2ced <void nel::Result<void, int>::consumev<nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}>(nel::Result<void, int>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, int>::unwrap(nel::Context const&)::{lambda(int&&)#2}&&, nel::Context const&)+0xa9>
+                    nel::panic("invalid Result", ctx);
+    2cc1:	|  |  \----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2cc5:	|  |         48 89 c6             	mov    %rax,%rsi
+    2cc8:	|  |         48 8d 05 15 35 00 00 	lea    0x3515(%rip),%rax        # 61e4 <n_values+0x1ac>
+    2ccf:	|  |         48 89 c7             	mov    %rax,%rdi
+    2cd2:	|  |         e8 66 22 00 00       	call   4f3d <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    2cd7:	\--|-------> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2cdb:	   |         48 89 c6             	mov    %rax,%rsi
+    2cde:	   |         48 8d 05 71 34 00 00 	lea    0x3471(%rip),%rax        # 6156 <n_values+0x11e>
+    2ce5:	   |         48 89 c7             	mov    %rax,%rdi
+    2ce8:	   |         e8 50 22 00 00       	call   4f3d <nel::panic(char const*, nel::Context const&)>
+        }
+    2ced:	   \-------> 90                   	nop
+    2cee:	             c9                   	leave
+    2cef:	             c3                   	ret
+
+0000000000002cf0 <nel::Slice<int>::Slice()>:
+        constexpr Slice(void)
+    2cf0:	55                   	push   %rbp
+    2cf1:	48 89 e5             	mov    %rsp,%rbp
+    2cf4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : content_(nullptr)
+    2cf8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cfc:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+            , len_(0)
+    2d03:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d07:	48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    2d0e:	00 
+        }
+    2d0f:	90                   	nop
+    2d10:	5d                   	pop    %rbp
+    2d11:	c3                   	ret
+
+0000000000002d12 <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>:
+        constexpr Length len(void) const
+    2d12:	55                   	push   %rbp
+    2d13:	48 89 e5             	mov    %rsp,%rbp
+    2d16:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    2d1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d1e:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    2d22:	5d                   	pop    %rbp
+    2d23:	c3                   	ret
+
+0000000000002d24 <nel::Slice<int>::Slice(int*, unsigned long)>:
+        constexpr Slice(Type *const p, Length len)
+    2d24:	55                   	push   %rbp
+    2d25:	48 89 e5             	mov    %rsp,%rbp
+    2d28:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2d2c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2d30:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : content_(p)
+    2d34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d38:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2d3c:	48 89 10             	mov    %rdx,(%rax)
+            , len_(len)
+    2d3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d43:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2d47:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    2d4b:	90                   	nop
+    2d4c:	5d                   	pop    %rbp
+    2d4d:	c3                   	ret
+
+0000000000002d4e <void nel::sort::unstable<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>:
+ *
+ * O(n log n) worst case, O(n) for sorted, reversed or all equal items.
+ * Equal items may be reordered.
+ */
+template<typename T, typename F>
+void unstable(T p[], Length const n, F &less)
+    2d4e:	       55                   	push   %rbp
+    2d4f:	       48 89 e5             	mov    %rsp,%rbp
+    2d52:	       48 83 ec 20          	sub    $0x20,%rsp
+    2d56:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2d5a:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2d5e:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+{
+    if (n < 2) { return; }
+    2d62:	       48 83 7d f0 01       	cmpq   $0x1,-0x10(%rbp)
+    2d67:	/----- 76 2b                	jbe    2d94 <void nel::sort::unstable<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x46>
+    pdq(p, n, less, log2(n), true);
+    2d69:	|      48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2d6d:	|      48 89 c7             	mov    %rax,%rdi
+    2d70:	|      e8 c4 f5 ff ff       	call   2339 <nel::sort::log2(unsigned long)>
+    2d75:	|      48 89 c1             	mov    %rax,%rcx
+    2d78:	|      48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2d7c:	|      48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+    2d80:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d84:	|      41 b8 01 00 00 00    	mov    $0x1,%r8d
+    2d8a:	|      48 89 c7             	mov    %rax,%rdi
+    2d8d:	|      e8 d2 07 00 00       	call   3564 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)>
+    2d92:	|  /-- eb 01                	jmp    2d95 <void nel::sort::unstable<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x47>
+    if (n < 2) { return; }
+    2d94:	\--|-> 90                   	nop
+}
+    2d95:	   \-> c9                   	leave
+    2d96:	       c3                   	ret
+
+0000000000002d97 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&)>:
+ *
+ * O(n log n) if buf_n >= n / 2, down to O(n log^2 n) in place (buf_n == 0).
+ * O(n) for already sorted items.
+ */
+template<typename T, typename F>
+void stable(T p[], Length const n, T buf[], Length const buf_n, F &less)
+    2d97:	/-------> 55                   	push   %rbp
+    2d98:	|         48 89 e5             	mov    %rsp,%rbp
+    2d9b:	|         48 83 ec 40          	sub    $0x40,%rsp
+    2d9f:	|         48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2da3:	|         48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2da7:	|         48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    2dab:	|         48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    2daf:	|         4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+{
+    if (n < small_n) {
+    2db3:	|         48 83 7d e0 13       	cmpq   $0x13,-0x20(%rbp)
+    2db8:	|     /-- 77 1c                	ja     2dd6 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&)+0x3f>
+        insertion(p, n, less);
+    2dba:	|     |   48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    2dbe:	|     |   48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2dc2:	|     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2dc6:	|     |   48 89 ce             	mov    %rcx,%rsi
+    2dc9:	|     |   48 89 c7             	mov    %rax,%rdi
+    2dcc:	|     |   e8 0d 0a 00 00       	call   37de <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>
+        return;
+    2dd1:	|  /--|-- e9 83 00 00 00       	jmp    2e59 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&)+0xc2>
+    }
+    Length const h = n / 2;
+    2dd6:	|  |  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2dda:	|  |      48 d1 e8             	shr    %rax
+    2ddd:	|  |      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    stable(p, h, buf, buf_n, less);
+    2de1:	|  |      48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+    2de5:	|  |      48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    2de9:	|  |      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2ded:	|  |      48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+    2df1:	|  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2df5:	|  |      49 89 f8             	mov    %rdi,%r8
+    2df8:	|  |      48 89 c7             	mov    %rax,%rdi
+    2dfb:	+--|----- e8 97 ff ff ff       	call   2d97 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&)>
+    stable(p + h, n - h, buf, buf_n, less);
+    2e00:	|  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2e04:	|  |      48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    2e08:	|  |      48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2e0c:	|  |      48 8d 0c 95 00 00 00 	lea    0x0(,%rdx,4),%rcx
+    2e13:	|  |      00 
+    2e14:	|  |      48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2e18:	|  |      48 8d 3c 11          	lea    (%rcx,%rdx,1),%rdi
+    2e1c:	|  |      48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    2e20:	|  |      48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    2e24:	|  |      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2e28:	|  |      49 89 f0             	mov    %rsi,%r8
+    2e2b:	|  |      48 89 c6             	mov    %rax,%rsi
+    2e2e:	\--|----- e8 64 ff ff ff       	call   2d97 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&)>
+    merge(p, h, n, buf, buf_n, less);
+    2e33:	   |      4c 8b 45 c8          	mov    -0x38(%rbp),%r8
+    2e37:	   |      48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    2e3b:	   |      48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+    2e3f:	   |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2e43:	   |      48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+    2e47:	   |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e4b:	   |      4d 89 c1             	mov    %r8,%r9
+    2e4e:	   |      49 89 f8             	mov    %rdi,%r8
+    2e51:	   |      48 89 c7             	mov    %rax,%rdi
+    2e54:	   |      e8 c3 0a 00 00       	call   391c <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)>
+}
+    2e59:	   \----> c9                   	leave
+    2e5a:	          c3                   	ret
+
+0000000000002e5b <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)>:
+void select_nth(T p[], Length n, Index k, F &less)
+    2e5b:	                   55                   	push   %rbp
+    2e5c:	                   48 89 e5             	mov    %rsp,%rbp
+    2e5f:	                   48 83 ec 50          	sub    $0x50,%rsp
+    2e63:	                   48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    2e67:	                   48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    2e6b:	                   48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    2e6f:	                   48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+    Count bad_allowed = log2(n);
+    2e73:	                   48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2e77:	                   48 89 c7             	mov    %rax,%rdi
+    2e7a:	                   e8 ba f4 ff ff       	call   2339 <nel::sort::log2(unsigned long)>
+    2e7f:	                   48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    bool leftmost = true;
+    2e83:	                   c6 45 f7 01          	movb   $0x1,-0x9(%rbp)
+    while (n >= small_n) {
+    2e87:	   /-------------- e9 6c 01 00 00       	jmp    2ff8 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x19d>
+        choose_pivot(p, n, less);
+    2e8c:	/--|-------------> 48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    2e90:	|  |               48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+    2e94:	|  |               48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2e98:	|  |               48 89 ce             	mov    %rcx,%rsi
+    2e9b:	|  |               48 89 c7             	mov    %rax,%rdi
+    2e9e:	|  |               e8 ae 0f 00 00       	call   3e51 <void nel::sort::choose_pivot<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>
+        if (!leftmost && !less(p[-1], p[0])) {
+    2ea3:	|  |               0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2ea7:	|  |               83 f0 01             	xor    $0x1,%eax
+    2eaa:	|  |               84 c0                	test   %al,%al
+    2eac:	|  |        /----- 74 29                	je     2ed7 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x7c>
+    2eae:	|  |        |      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2eb2:	|  |        |      48 8d 48 fc          	lea    -0x4(%rax),%rcx
+    2eb6:	|  |        |      48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    2eba:	|  |        |      48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2ebe:	|  |        |      48 89 ce             	mov    %rcx,%rsi
+    2ec1:	|  |        |      48 89 c7             	mov    %rax,%rdi
+    2ec4:	|  |        |      e8 1d 11 00 00       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    2ec9:	|  |        |      83 f0 01             	xor    $0x1,%eax
+    2ecc:	|  |        |      84 c0                	test   %al,%al
+    2ece:	|  |        +----- 74 07                	je     2ed7 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x7c>
+    2ed0:	|  |        |      b8 01 00 00 00       	mov    $0x1,%eax
+    2ed5:	|  |        |  /-- eb 05                	jmp    2edc <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x81>
+    2ed7:	|  |        \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    2edc:	|  |           \-> 84 c0                	test   %al,%al
+    2ede:	|  |           /-- 74 5e                	je     2f3e <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0xe3>
+            Index const m = partition_left(p, n, less);
+    2ee0:	|  |           |   48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    2ee4:	|  |           |   48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+    2ee8:	|  |           |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2eec:	|  |           |   48 89 ce             	mov    %rcx,%rsi
+    2eef:	|  |           |   48 89 c7             	mov    %rax,%rdi
+    2ef2:	|  |           |   e8 12 11 00 00       	call   4009 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>
+    2ef7:	|  |           |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (k <= m) { return; }
+    2efb:	|  |           |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2eff:	|  |           |   48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    2f03:	|  |  /--------|-- 0f 83 13 01 00 00    	jae    301c <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x1c1>
+            p += m + 1;
+    2f09:	|  |  |        |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2f0d:	|  |  |        |   48 83 c0 01          	add    $0x1,%rax
+    2f11:	|  |  |        |   48 c1 e0 02          	shl    $0x2,%rax
+    2f15:	|  |  |        |   48 01 45 c8          	add    %rax,-0x38(%rbp)
+            n -= m + 1;
+    2f19:	|  |  |        |   48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2f1d:	|  |  |        |   48 2b 45 e0          	sub    -0x20(%rbp),%rax
+    2f21:	|  |  |        |   48 83 e8 01          	sub    $0x1,%rax
+    2f25:	|  |  |        |   48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            k -= m + 1;
+    2f29:	|  |  |        |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2f2d:	|  |  |        |   48 2b 45 e0          	sub    -0x20(%rbp),%rax
+    2f31:	|  |  |        |   48 83 e8 01          	sub    $0x1,%rax
+    2f35:	|  |  |        |   48 89 45 b8          	mov    %rax,-0x48(%rbp)
+            continue;
+    2f39:	|  +--|--------|-- e9 ba 00 00 00       	jmp    2ff8 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x19d>
+        Index const m = partition_right(p, n, less, already);
+    2f3e:	|  |  |        \-> 48 8d 4d df          	lea    -0x21(%rbp),%rcx
+    2f42:	|  |  |            48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    2f46:	|  |  |            48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+    2f4a:	|  |  |            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2f4e:	|  |  |            48 89 c7             	mov    %rax,%rdi
+    2f51:	|  |  |            e8 8e 12 00 00       	call   41e4 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&)>
+    2f56:	|  |  |            48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if (m < n / 8 || n - m - 1 < n / 8) {
+    2f5a:	|  |  |            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2f5e:	|  |  |            48 c1 e8 03          	shr    $0x3,%rax
+    2f62:	|  |  |            48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    2f66:	|  |  |        /-- 72 19                	jb     2f81 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x126>
+    2f68:	|  |  |        |   48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2f6c:	|  |  |        |   48 2b 45 e8          	sub    -0x18(%rbp),%rax
+    2f70:	|  |  |        |   48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    2f74:	|  |  |        |   48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2f78:	|  |  |        |   48 c1 e8 03          	shr    $0x3,%rax
+    2f7c:	|  |  |        |   48 39 c2             	cmp    %rax,%rdx
+    2f7f:	|  |  |     /--|-- 73 25                	jae    2fa6 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x14b>
+            bad_allowed -= 1;
+    2f81:	|  |  |     |  \-> 48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+            if (bad_allowed == 0) {
+    2f86:	|  |  |     |      48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2f8b:	|  |  |     +----- 75 19                	jne    2fa6 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x14b>
+                heap(p, n, less);
+    2f8d:	|  |  |     |      48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    2f91:	|  |  |     |      48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+    2f95:	|  |  |     |      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2f99:	|  |  |     |      48 89 ce             	mov    %rcx,%rsi
+    2f9c:	|  |  |     |      48 89 c7             	mov    %rax,%rdi
+    2f9f:	|  |  |     |      e8 34 14 00 00       	call   43d8 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>
+                return;
+    2fa4:	|  |  |  /--|----- eb 7a                	jmp    3020 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x1c5>
+        if (k == m) { return; }
+    2fa6:	|  |  |  |  \----> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2faa:	|  |  |  |         48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+    2fae:	|  |  |  |  /----- 74 6f                	je     301f <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x1c4>
+        if (k < m) {
+    2fb0:	|  |  |  |  |      48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2fb4:	|  |  |  |  |      48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+    2fb8:	|  |  |  |  |  /-- 73 0a                	jae    2fc4 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x169>
+            n = m;
+    2fba:	|  |  |  |  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2fbe:	|  |  |  |  |  |   48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    2fc2:	|  +--|--|--|--|-- eb 34                	jmp    2ff8 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x19d>
+            p += m + 1;
+    2fc4:	|  |  |  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2fc8:	|  |  |  |  |      48 83 c0 01          	add    $0x1,%rax
+    2fcc:	|  |  |  |  |      48 c1 e0 02          	shl    $0x2,%rax
+    2fd0:	|  |  |  |  |      48 01 45 c8          	add    %rax,-0x38(%rbp)
+            n -= m + 1;
+    2fd4:	|  |  |  |  |      48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2fd8:	|  |  |  |  |      48 2b 45 e8          	sub    -0x18(%rbp),%rax
+    2fdc:	|  |  |  |  |      48 83 e8 01          	sub    $0x1,%rax
+    2fe0:	|  |  |  |  |      48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            k -= m + 1;
+    2fe4:	|  |  |  |  |      48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2fe8:	|  |  |  |  |      48 2b 45 e8          	sub    -0x18(%rbp),%rax
+    2fec:	|  |  |  |  |      48 83 e8 01          	sub    $0x1,%rax
+    2ff0:	|  |  |  |  |      48 89 45 b8          	mov    %rax,-0x48(%rbp)
+            leftmost = false;
+    2ff4:	|  |  |  |  |      c6 45 f7 00          	movb   $0x0,-0x9(%rbp)
+    while (n >= small_n) {
+    2ff8:	|  \--|--|--|----> 48 83 7d c0 13       	cmpq   $0x13,-0x40(%rbp)
+    2ffd:	\-----|--|--|----- 0f 87 89 fe ff ff    	ja     2e8c <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x31>
+    insertion(p, n, less);
+    3003:	      |  |  |      48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    3007:	      |  |  |      48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+    300b:	      |  |  |      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    300f:	      |  |  |      48 89 ce             	mov    %rcx,%rsi
+    3012:	      |  |  |      48 89 c7             	mov    %rax,%rdi
+    3015:	      |  |  |      e8 c4 07 00 00       	call   37de <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>
+    301a:	      |  +--|----- eb 04                	jmp    3020 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x1c5>
+            if (k <= m) { return; }
+    301c:	      \--|--|----> 90                   	nop
+    301d:	         +--|----- eb 01                	jmp    3020 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x1c5>
+        if (k == m) { return; }
+    301f:	         |  \----> 90                   	nop
+}
+    3020:	         \-------> c9                   	leave
+    3021:	                   c3                   	ret
+
+0000000000003022 <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>:
+        constexpr Element &operator=(Element const &) const = delete;
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+    3022:	55                   	push   %rbp
+    3023:	48 89 e5             	mov    %rsp,%rbp
+    3026:	48 83 ec 10          	sub    $0x10,%rsp
+    302a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    302e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    3032:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3036:	48 89 c7             	mov    %rax,%rdi
+    3039:	e8 01 f9 ff ff       	call   293f <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    303e:	8b 10                	mov    (%rax),%edx
+    3040:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3044:	89 10                	mov    %edx,(%rax)
+        {
+        }
+    3046:	90                   	nop
+    3047:	c9                   	leave
+    3048:	c3                   	ret
+    3049:	90                   	nop
+
+000000000000304a <nel::Element<void*>::Element<void* const&>(void* const&)>:
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+    304a:	55                   	push   %rbp
+    304b:	48 89 e5             	mov    %rsp,%rbp
+    304e:	48 83 ec 10          	sub    $0x10,%rsp
+    3052:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3056:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Args>(args)...)
+    305a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    305e:	48 89 c7             	mov    %rax,%rdi
+    3061:	e8 29 f9 ff ff       	call   298f <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    3066:	48 8b 10             	mov    (%rax),%rdx
+    3069:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    306d:	48 89 10             	mov    %rdx,(%rax)
+        {
+        }
+    3070:	90                   	nop
+    3071:	c9                   	leave
+    3072:	c3                   	ret
+    3073:	90                   	nop
+
+0000000000003074 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>:
+            return match<bool>([](T const &) -> bool { return false; },
+    3074:	55                   	push   %rbp
+    3075:	48 89 e5             	mov    %rsp,%rbp
+    3078:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    307c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3080:	b8 00 00 00 00       	mov    $0x0,%eax
+    3085:	5d                   	pop    %rbp
+    3086:	c3                   	ret
+    3087:	90                   	nop
+
+0000000000003088 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>:
+                               [](E const &) -> bool { return true; },
+    3088:	55                   	push   %rbp
+    3089:	48 89 e5             	mov    %rsp,%rbp
+    308c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3090:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3094:	b8 01 00 00 00       	mov    $0x1,%eax
+    3099:	5d                   	pop    %rbp
+    309a:	c3                   	ret
+    309b:	90                   	nop
+
+000000000000309c <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>:
+        constexpr bool is_err(Context const &ctx = Context()) const
+    309c:	55                   	push   %rbp
+    309d:	48 89 e5             	mov    %rsp,%rbp
+    30a0:	48 83 ec 20          	sub    $0x20,%rsp
+    30a4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    30a8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](T const &) -> bool { return false; },
+    30ac:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    30b0:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    30b4:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    30b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    30bc:	48 89 c7             	mov    %rax,%rdi
+    30bf:	e8 02 00 00 00       	call   30c6 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>
+        }
+    30c4:	c9                   	leave
+    30c5:	c3                   	ret
+
+00000000000030c6 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    30c6:	             55                   	push   %rbp
+    30c7:	             48 89 e5             	mov    %rsp,%rbp
+    30ca:	             48 83 ec 20          	sub    $0x20,%rsp
+    30ce:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    30d2:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    30d6:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    30da:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result-match
+    30de:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30e2:	             8b 00                	mov    (%rax),%eax
+    30e4:	             83 f8 02             	cmp    $0x2,%eax
+    30e7:	         /-- 74 32                	je     311b <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x55>
+    30e9:	         |   83 f8 02             	cmp    $0x2,%eax
+    30ec:	/--------|-- 7f 67                	jg     3155 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+    30ee:	|        |   85 c0                	test   %eax,%eax
+    30f0:	|     /--|-- 74 4d                	je     313f <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x79>
+    30f2:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    30f5:	+-----|--|-- 75 5e                	jne    3155 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_ok(*ok_);
+    30f7:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30fb:	|     |  |   48 83 c0 08          	add    $0x8,%rax
+    30ff:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    3102:	|     |  |   e8 79 13 00 00       	call   4480 <nel::Element<void*>::operator*() const>
+    3107:	|     |  |   48 89 c2             	mov    %rax,%rdx
+    310a:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    310e:	|     |  |   48 89 d6             	mov    %rdx,%rsi
+    3111:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    3114:	|     |  |   e8 5b ff ff ff       	call   3074 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>
+    3119:	|  /--|--|-- eb 50                	jmp    316b <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    return on_err(*err_);
+    311b:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    311f:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    3123:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3126:	|  |  |      e8 6f 13 00 00       	call   449a <nel::Element<nel::heaped::AllocError>::operator*() const>
+    312b:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    312e:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3132:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    3135:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3138:	|  |  |      e8 4b ff ff ff       	call   3088 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>
+    313d:	|  +--|----- eb 2c                	jmp    316b <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    nel::panic("invalid Result", ctx);
+    313f:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3143:	|  |         48 89 c6             	mov    %rax,%rsi
+    3146:	|  |         48 8d 05 97 30 00 00 	lea    0x3097(%rip),%rax        # 61e4 <n_values+0x1ac>
+    314d:	|  |         48 89 c7             	mov    %rax,%rdi
+    3150:	|  |         e8 e8 1d 00 00       	call   4f3d <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    3155:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3159:	   |         48 89 c6             	mov    %rax,%rsi
+    315c:	   |         48 8d 05 f3 2f 00 00 	lea    0x2ff3(%rip),%rax        # 6156 <n_values+0x11e>
+    3163:	   |         48 89 c7             	mov    %rax,%rdi
+    3166:	   |         e8 d2 1d 00 00       	call   4f3d <nel::panic(char const*, nel::Context const&)>
+        }
+    316b:	   \-------> c9                   	leave
+    316c:	             c3                   	ret
+
+000000000000316d <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>:
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    316d:	          55                   	push   %rbp
+    316e:	          48 89 e5             	mov    %rsp,%rbp
+    3171:	          41 54                	push   %r12
+    3173:	          53                   	push   %rbx
+    3174:	          48 83 ec 70          	sub    $0x70,%rsp
+    3178:	          48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+    317c:	          48 89 75 80          	mov    %rsi,-0x80(%rbp)
+            if (new_cap > max_capacity) { return nullptr; }
+    3180:	          48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    3187:	          ff ff 1f 
+    318a:	          48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    318e:	      /-- 73 0a                	jae    319a <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x2d>
+    3190:	      |   bb 00 00 00 00       	mov    $0x0,%ebx
+    3195:	/-----|-- e9 1d 01 00 00       	jmp    32b7 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x14a>
+            Length const new_sz = size_of(new_cap);
+    319a:	|     \-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    319e:	|         48 89 c7             	mov    %rax,%rdi
+    31a1:	|         e8 d8 f8 ff ff       	call   2a7e <nel::heaped::Node<int, nel::heaped::Malloc>::size_of(unsigned long)>
+    31a6:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            Length const old_sz = (old_n == nullptr) ? 0 : size_of(old_n->alloc_);
+    31aa:	|         48 83 7d 88 00       	cmpq   $0x0,-0x78(%rbp)
+    31af:	|  /----- 74 11                	je     31c2 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x55>
+    31b1:	|  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    31b5:	|  |      48 8b 00             	mov    (%rax),%rax
+    31b8:	|  |      48 89 c7             	mov    %rax,%rdi
+    31bb:	|  |      e8 be f8 ff ff       	call   2a7e <nel::heaped::Node<int, nel::heaped::Malloc>::size_of(unsigned long)>
+    31c0:	|  |  /-- eb 05                	jmp    31c7 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x5a>
+    31c2:	|  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    31c7:	|     \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+                auto r = Allocator::try_realloc(old_n, alignof(Node), old_sz, new_sz);
+    31cb:	|         48 8d 45 90          	lea    -0x70(%rbp),%rax
+    31cf:	|         48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    31d3:	|         48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    31d7:	|         48 8b 75 88          	mov    -0x78(%rbp),%rsi
+    31db:	|         49 89 c8             	mov    %rcx,%r8
+    31de:	|         48 89 d1             	mov    %rdx,%rcx
+    31e1:	|         ba 08 00 00 00       	mov    $0x8,%edx
+    31e6:	|         48 89 c7             	mov    %rax,%rdi
+    31e9:	|         e8 29 f0 ff ff       	call   2217 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>
+                if (r.is_err()) { return nullptr; }
+    31ee:	|         48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    31f2:	|         b9 89 00 00 00       	mov    $0x89,%ecx
+    31f7:	|         48 8d 15 f5 2f 00 00 	lea    0x2ff5(%rip),%rdx        # 61f3 <n_values+0x1bb>
+    31fe:	|         48 8d 35 05 30 00 00 	lea    0x3005(%rip),%rsi        # 620a <n_values+0x1d2>
+    3205:	|         48 89 c7             	mov    %rax,%rdi
+    3208:	|         e8 9d ef ff ff       	call   21aa <nel::Context::Context(char const*, char const*, int)>
+    320d:	|         48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    3211:	|         48 8d 45 90          	lea    -0x70(%rbp),%rax
+    3215:	|         48 89 d6             	mov    %rdx,%rsi
+    3218:	|         48 89 c7             	mov    %rax,%rdi
+    321b:	|         e8 7c fe ff ff       	call   309c <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>
+    3220:	|         84 c0                	test   %al,%al
+    3222:	|     /-- 74 0d                	je     3231 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0xc4>
+    3224:	|     |   bb 00 00 00 00       	mov    $0x0,%ebx
+    3229:	|     |   41 bc 00 00 00 00    	mov    $0x0,%r12d
+    322f:	|  /--|-- eb 3c                	jmp    326d <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x100>
+                new_n = reinterpret_cast<Node *>(r.unwrap());
+    3231:	|  |  \-> 48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3235:	|  |      b9 8a 00 00 00       	mov    $0x8a,%ecx
+    323a:	|  |      48 8d 15 b2 2f 00 00 	lea    0x2fb2(%rip),%rdx        # 61f3 <n_values+0x1bb>
+    3241:	|  |      48 8d 35 c2 2f 00 00 	lea    0x2fc2(%rip),%rsi        # 620a <n_values+0x1d2>
+    3248:	|  |      48 89 c7             	mov    %rax,%rdi
+    324b:	|  |      e8 5a ef ff ff       	call   21aa <nel::Context::Context(char const*, char const*, int)>
+    3250:	|  |      48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    3254:	|  |      48 8d 45 90          	lea    -0x70(%rbp),%rax
+    3258:	|  |      48 89 d6             	mov    %rdx,%rsi
+    325b:	|  |      48 89 c7             	mov    %rax,%rdi
+    325e:	|  |      e8 9d 12 00 00       	call   4500 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+    3263:	|  |      48 89 45 e8          	mov    %rax,-0x18(%rbp)
+            } else {
+    3267:	|  |      41 bc 01 00 00 00    	mov    $0x1,%r12d
+    326d:	|  \----> 48 8d 45 90          	lea    -0x70(%rbp),%rax
+    3271:	|         48 89 c7             	mov    %rax,%rdi
+    3274:	|         e8 47 f1 ff ff       	call   23c0 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+    3279:	|         41 83 fc 01          	cmp    $0x1,%r12d
+    327d:	+-------- 75 38                	jne    32b7 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x14a>
+    327f:	|         90                   	nop
+                if (new_sz > old_sz) {
+    3280:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3284:	|         48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    3288:	|     /-- 73 1e                	jae    32a8 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x13b>
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+    328a:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    328e:	|     |   48 2b 45 d8          	sub    -0x28(%rbp),%rax
+    3292:	|     |   48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    3296:	|     |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    329a:	|     |   48 01 ca             	add    %rcx,%rdx
+    329d:	|     |   48 89 c6             	mov    %rax,%rsi
+    32a0:	|     |   48 89 d7             	mov    %rdx,%rdi
+    32a3:	|     |   e8 16 1e 00 00       	call   50be <nel::elem::wipe(unsigned char*, unsigned long)>
+            new_n->alloc_ = new_cap;
+    32a8:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    32ac:	|         48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    32b0:	|         48 89 10             	mov    %rdx,(%rax)
+            return new_n;
+    32b3:	|         48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+        }
+    32b7:	\-------> 48 89 d8             	mov    %rbx,%rax
+    32ba:	          48 83 c4 70          	add    $0x70,%rsp
+    32be:	          5b                   	pop    %rbx
+    32bf:	          41 5c                	pop    %r12
+    32c1:	          5d                   	pop    %rbp
+    32c2:	          c3                   	ret
+
+00000000000032c3 <nel::heaped::Node<int, nel::heaped::Malloc>*&& nel::move<nel::heaped::Node<int, nel::heaped::Malloc>*>(nel::heaped::Node<int, nel::heaped::Malloc>*&)>:
+constexpr T &&move(T &v)
+    32c3:	55                   	push   %rbp
+    32c4:	48 89 e5             	mov    %rsp,%rbp
+    32c7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    32cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    32cf:	5d                   	pop    %rbp
+    32d0:	c3                   	ret
+    32d1:	90                   	nop
+
+00000000000032d2 <nel::heaped::Node<int, nel::heaped::Malloc>::~Node()>:
+        constexpr ~Node(void)
+    32d2:	       55                   	push   %rbp
+    32d3:	       48 89 e5             	mov    %rsp,%rbp
+    32d6:	       48 83 ec 20          	sub    $0x20,%rsp
+    32da:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            for (Index i = 0; i < len(); ++i) {
+    32de:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    32e5:	       00 
+    32e6:	   /-- eb 05                	jmp    32ed <nel::heaped::Node<int, nel::heaped::Malloc>::~Node()+0x1b>
+    32e8:	/--|-> 48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    32ed:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    32f1:	|      48 89 c7             	mov    %rax,%rdi
+    32f4:	|      e8 19 fa ff ff       	call   2d12 <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    32f9:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    32fd:	|      0f 92 c0             	setb   %al
+    3300:	|      84 c0                	test   %al,%al
+    3302:	\----- 75 e4                	jne    32e8 <nel::heaped::Node<int, nel::heaped::Malloc>::~Node()+0x16>
+        }
+    3304:	       90                   	nop
+    3305:	       90                   	nop
+    3306:	       c9                   	leave
+    3307:	       c3                   	ret
+
+0000000000003308 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>:
+        constexpr Length len(void) const
+    3308:	       55                   	push   %rbp
+    3309:	       48 89 e5             	mov    %rsp,%rbp
+    330c:	       48 83 ec 10          	sub    $0x10,%rsp
+    3310:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->len();
+    3314:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3318:	       48 8b 00             	mov    (%rax),%rax
+    331b:	       48 85 c0             	test   %rax,%rax
+    331e:	/----- 74 11                	je     3331 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x29>
+    3320:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3324:	|      48 8b 00             	mov    (%rax),%rax
+    3327:	|      48 89 c7             	mov    %rax,%rdi
+    332a:	|      e8 e3 f9 ff ff       	call   2d12 <nel::heaped::Node<int, nel::heaped::Malloc>::len() const>
+    332f:	|  /-- eb 05                	jmp    3336 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x2e>
+    3331:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    3336:	   \-> c9                   	leave
+    3337:	       c3                   	ret
+
+0000000000003338 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>:
+        constexpr Count capacity(void) const
+    3338:	       55                   	push   %rbp
+    3339:	       48 89 e5             	mov    %rsp,%rbp
+    333c:	       48 83 ec 10          	sub    $0x10,%rsp
+    3340:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->capacity();
+    3344:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3348:	       48 8b 00             	mov    (%rax),%rax
+    334b:	       48 85 c0             	test   %rax,%rax
+    334e:	/----- 74 11                	je     3361 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x29>
+    3350:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3354:	|      48 8b 00             	mov    (%rax),%rax
+    3357:	|      48 89 c7             	mov    %rax,%rdi
+    335a:	|      e8 ad 01 00 00       	call   350c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    335f:	|  /-- eb 05                	jmp    3366 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x2e>
+    3361:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    3366:	   \-> c9                   	leave
+    3367:	       c3                   	ret
+
+0000000000003368 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>:
+        bool try_reserve(Count new_cap)
+    3368:	             55                   	push   %rbp
+    3369:	             48 89 e5             	mov    %rsp,%rbp
+    336c:	             48 83 ec 20          	sub    $0x20,%rsp
+    3370:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3374:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            new_cap = Growth::capacity_for(capacity(), new_cap);
+    3378:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    337c:	             48 89 c7             	mov    %rax,%rdi
+    337f:	             e8 b4 ff ff ff       	call   3338 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    3384:	             48 89 c2             	mov    %rax,%rdx
+    3387:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    338b:	             48 89 c6             	mov    %rax,%rsi
+    338e:	             48 89 d7             	mov    %rdx,%rdi
+    3391:	             e8 9c 11 00 00       	call   4532 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>
+    3396:	             48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (new_cap < len()) { new_cap = len(); }
+    339a:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    339e:	             48 89 c7             	mov    %rax,%rdi
+    33a1:	             e8 62 ff ff ff       	call   3308 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    33a6:	             48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    33aa:	             0f 92 c0             	setb   %al
+    33ad:	             84 c0                	test   %al,%al
+    33af:	         /-- 74 10                	je     33c1 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x59>
+    33b1:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    33b5:	         |   48 89 c7             	mov    %rax,%rdi
+    33b8:	         |   e8 4b ff ff ff       	call   3308 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    33bd:	         |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (item_ == nullptr) {
+    33c1:	         \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    33c5:	             48 8b 00             	mov    (%rax),%rax
+    33c8:	             48 85 c0             	test   %rax,%rax
+    33cb:	         /-- 75 2d                	jne    33fa <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x92>
+                item_ = VectorNode::malloc(new_cap);
+    33cd:	         |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    33d1:	         |   48 89 c7             	mov    %rax,%rdi
+    33d4:	         |   e8 1d f6 ff ff       	call   29f6 <nel::heaped::Node<int, nel::heaped::Malloc>::malloc(unsigned long)>
+    33d9:	         |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    33dd:	         |   48 89 02             	mov    %rax,(%rdx)
+                if (item_ == nullptr) { return false; }
+    33e0:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    33e4:	         |   48 8b 00             	mov    (%rax),%rax
+    33e7:	         |   48 85 c0             	test   %rax,%rax
+    33ea:	/--------|-- 0f 85 c4 00 00 00    	jne    34b4 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+    33f0:	|        |   b8 00 00 00 00       	mov    $0x0,%eax
+    33f5:	|  /-----|-- e9 bf 00 00 00       	jmp    34b9 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+            } else if (new_cap == item_->capacity()) {
+    33fa:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    33fe:	|  |         48 8b 00             	mov    (%rax),%rax
+    3401:	|  |         48 89 c7             	mov    %rax,%rdi
+    3404:	|  |         e8 03 01 00 00       	call   350c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    3409:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    340d:	|  |         0f 94 c0             	sete   %al
+    3410:	|  |         84 c0                	test   %al,%al
+    3412:	+--|-------- 0f 85 9c 00 00 00    	jne    34b4 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap > item_->capacity()) {
+    3418:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    341c:	|  |         48 8b 00             	mov    (%rax),%rax
+    341f:	|  |         48 89 c7             	mov    %rax,%rdi
+    3422:	|  |         e8 e5 00 00 00       	call   350c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    3427:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    342b:	|  |         0f 92 c0             	setb   %al
+    342e:	|  |         84 c0                	test   %al,%al
+    3430:	|  |  /----- 74 35                	je     3467 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xff>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    3432:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3436:	|  |  |      48 8b 00             	mov    (%rax),%rax
+    3439:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    343d:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    3440:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3443:	|  |  |      e8 25 fd ff ff       	call   316d <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    3448:	|  |  |      48 89 45 f0          	mov    %rax,-0x10(%rbp)
+                if (p == nullptr) { return false; }
+    344c:	|  |  |      48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    3451:	|  |  |  /-- 75 07                	jne    345a <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xf2>
+    3453:	|  |  |  |   b8 00 00 00 00       	mov    $0x0,%eax
+    3458:	|  +--|--|-- eb 5f                	jmp    34b9 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    345a:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    345e:	|  |  |      48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3462:	|  |  |      48 89 10             	mov    %rdx,(%rax)
+    3465:	+--|--|----- eb 4d                	jmp    34b4 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap < item_->capacity()) {
+    3467:	|  |  \----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    346b:	|  |         48 8b 00             	mov    (%rax),%rax
+    346e:	|  |         48 89 c7             	mov    %rax,%rdi
+    3471:	|  |         e8 96 00 00 00       	call   350c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>
+    3476:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    347a:	|  |         0f 92 c0             	setb   %al
+    347d:	|  |         84 c0                	test   %al,%al
+    347f:	+--|-------- 74 33                	je     34b4 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    3481:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3485:	|  |         48 8b 00             	mov    (%rax),%rax
+    3488:	|  |         48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    348c:	|  |         48 89 d6             	mov    %rdx,%rsi
+    348f:	|  |         48 89 c7             	mov    %rax,%rdi
+    3492:	|  |         e8 d6 fc ff ff       	call   316d <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    3497:	|  |         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                if (p == nullptr) { return false; }
+    349b:	|  |         48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    34a0:	|  |     /-- 75 07                	jne    34a9 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x141>
+    34a2:	|  |     |   b8 00 00 00 00       	mov    $0x0,%eax
+    34a7:	|  +-----|-- eb 10                	jmp    34b9 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    34a9:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34ad:	|  |         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    34b1:	|  |         48 89 10             	mov    %rdx,(%rax)
+            return true;
+    34b4:	\--|-------> b8 01 00 00 00       	mov    $0x1,%eax
+        }
+    34b9:	   \-------> c9                   	leave
+    34ba:	             c3                   	ret
+
+00000000000034bb <int& nel::forward<int&, int>(int&)>:
+constexpr U &&forward(T &t)
+    34bb:	55                   	push   %rbp
+    34bc:	48 89 e5             	mov    %rsp,%rbp
+    34bf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    34c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    34c7:	5d                   	pop    %rbp
+    34c8:	c3                   	ret
+    34c9:	90                   	nop
+
+00000000000034ca <nel::Result<void, int>::Result<int&>(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)2>, int&)>:
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+    34ca:	55                   	push   %rbp
+    34cb:	48 89 e5             	mov    %rsp,%rbp
+    34ce:	53                   	push   %rbx
+    34cf:	48 83 ec 18          	sub    $0x18,%rsp
+    34d3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    34d7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    34db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34df:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<Args>(args)...)
+    34e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34e9:	48 8d 58 04          	lea    0x4(%rax),%rbx
+    34ed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    34f1:	48 89 c7             	mov    %rax,%rdi
+    34f4:	e8 c2 ff ff ff       	call   34bb <int& nel::forward<int&, int>(int&)>
+    34f9:	48 89 c6             	mov    %rax,%rsi
+    34fc:	48 89 df             	mov    %rbx,%rdi
+    34ff:	e8 7a 10 00 00       	call   457e <nel::Element<int>::Element<int&>(int&)>
+        }
+    3504:	90                   	nop
+    3505:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3509:	c9                   	leave
+    350a:	c3                   	ret
+    350b:	90                   	nop
+
+000000000000350c <nel::heaped::Node<int, nel::heaped::Malloc>::capacity() const>:
+        constexpr Count capacity(void) const
+    350c:	55                   	push   %rbp
+    350d:	48 89 e5             	mov    %rsp,%rbp
+    3510:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return alloc_;
+    3514:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3518:	48 8b 00             	mov    (%rax),%rax
+        }
+    351b:	5d                   	pop    %rbp
+    351c:	c3                   	ret
+
+000000000000351d <nel::Result<void, int>::Ok()>:
+        constexpr static Result Ok(void)
+    351d:	55                   	push   %rbp
+    351e:	48 89 e5             	mov    %rsp,%rbp
+    3521:	48 83 ec 10          	sub    $0x10,%rsp
+    3525:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Result(Phantom<Tag::OK>());
+    3529:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    352d:	48 89 c7             	mov    %rax,%rdi
+    3530:	e8 71 10 00 00       	call   45a6 <nel::Result<void, int>::Result(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)1>)>
+        }
+    3535:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3539:	c9                   	leave
+    353a:	c3                   	ret
+    353b:	90                   	nop
+
+000000000000353c <nel::Element<int>::operator*()>:
+        constexpr Type const &operator*(void) const
+        {
+            return ref();
+        }
+
+        constexpr Type &operator*(void)
+    353c:	55                   	push   %rbp
+    353d:	48 89 e5             	mov    %rsp,%rbp
+    3540:	48 83 ec 10          	sub    $0x10,%rsp
+    3544:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    3548:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    354c:	48 89 c7             	mov    %rax,%rdi
+    354f:	e8 68 10 00 00       	call   45bc <nel::Element<int>::ref()>
+        }
+    3554:	c9                   	leave
+    3555:	c3                   	ret
+
+0000000000003556 <int&& nel::forward<int, int>(int&)>:
+constexpr U &&forward(T &t)
+    3556:	55                   	push   %rbp
+    3557:	48 89 e5             	mov    %rsp,%rbp
+    355a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    355e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3562:	5d                   	pop    %rbp
+    3563:	c3                   	ret
+
+0000000000003564 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)>:
+void pdq(T p[], Length n, F &less, Count bad_allowed, bool leftmost)
+    3564:	/-------------------> 55                   	push   %rbp
+    3565:	|                     48 89 e5             	mov    %rsp,%rbp
+    3568:	|                     48 83 ec 60          	sub    $0x60,%rsp
+    356c:	|                     48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    3570:	|                     48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    3574:	|                     48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    3578:	|                     48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+    357c:	|                     44 89 c0             	mov    %r8d,%eax
+    357f:	|                     88 45 ac             	mov    %al,-0x54(%rbp)
+        if (n < small_n) {
+    3582:	|  /----------------> 48 83 7d c0 13       	cmpq   $0x13,-0x40(%rbp)
+    3587:	|  |              /-- 77 1c                	ja     35a5 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x41>
+            insertion(p, n, less);
+    3589:	|  |              |   48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    358d:	|  |              |   48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+    3591:	|  |              |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3595:	|  |              |   48 89 ce             	mov    %rcx,%rsi
+    3598:	|  |              |   48 89 c7             	mov    %rax,%rdi
+    359b:	|  |              |   e8 3e 02 00 00       	call   37de <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>
+            return;
+    35a0:	|  |  /-----------|-- e9 37 02 00 00       	jmp    37dc <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x278>
+        choose_pivot(p, n, less);
+    35a5:	|  |  |           \-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    35a9:	|  |  |               48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+    35ad:	|  |  |               48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    35b1:	|  |  |               48 89 ce             	mov    %rcx,%rsi
+    35b4:	|  |  |               48 89 c7             	mov    %rax,%rdi
+    35b7:	|  |  |               e8 95 08 00 00       	call   3e51 <void nel::sort::choose_pivot<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>
+        if (!leftmost && !less(p[-1], p[0])) {
+    35bc:	|  |  |               0f b6 45 ac          	movzbl -0x54(%rbp),%eax
+    35c0:	|  |  |               83 f0 01             	xor    $0x1,%eax
+    35c3:	|  |  |               84 c0                	test   %al,%al
+    35c5:	|  |  |        /----- 74 29                	je     35f0 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x8c>
+    35c7:	|  |  |        |      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    35cb:	|  |  |        |      48 8d 48 fc          	lea    -0x4(%rax),%rcx
+    35cf:	|  |  |        |      48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    35d3:	|  |  |        |      48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    35d7:	|  |  |        |      48 89 ce             	mov    %rcx,%rsi
+    35da:	|  |  |        |      48 89 c7             	mov    %rax,%rdi
+    35dd:	|  |  |        |      e8 04 0a 00 00       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    35e2:	|  |  |        |      83 f0 01             	xor    $0x1,%eax
+    35e5:	|  |  |        |      84 c0                	test   %al,%al
+    35e7:	|  |  |        +----- 74 07                	je     35f0 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x8c>
+    35e9:	|  |  |        |      b8 01 00 00 00       	mov    $0x1,%eax
+    35ee:	|  |  |        |  /-- eb 05                	jmp    35f5 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x91>
+    35f0:	|  |  |        \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    35f5:	|  |  |           \-> 84 c0                	test   %al,%al
+    35f7:	|  |  |           /-- 74 40                	je     3639 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0xd5>
+            Index const m = partition_left(p, n, less);
+    35f9:	|  |  |           |   48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    35fd:	|  |  |           |   48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+    3601:	|  |  |           |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3605:	|  |  |           |   48 89 ce             	mov    %rcx,%rsi
+    3608:	|  |  |           |   48 89 c7             	mov    %rax,%rdi
+    360b:	|  |  |           |   e8 f9 09 00 00       	call   4009 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>
+    3610:	|  |  |           |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            p += m + 1;
+    3614:	|  |  |           |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3618:	|  |  |           |   48 83 c0 01          	add    $0x1,%rax
+    361c:	|  |  |           |   48 c1 e0 02          	shl    $0x2,%rax
+    3620:	|  |  |           |   48 01 45 c8          	add    %rax,-0x38(%rbp)
+            n -= m + 1;
+    3624:	|  |  |           |   48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    3628:	|  |  |           |   48 2b 45 e0          	sub    -0x20(%rbp),%rax
+    362c:	|  |  |           |   48 83 e8 01          	sub    $0x1,%rax
+    3630:	|  |  |           |   48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            continue;
+    3634:	|  |  |  /--------|-- e9 9d 01 00 00       	jmp    37d6 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x272>
+        Index const m = partition_right(p, n, less, already);
+    3639:	|  |  |  |        \-> 48 8d 4d df          	lea    -0x21(%rbp),%rcx
+    363d:	|  |  |  |            48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    3641:	|  |  |  |            48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+    3645:	|  |  |  |            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3649:	|  |  |  |            48 89 c7             	mov    %rax,%rdi
+    364c:	|  |  |  |            e8 93 0b 00 00       	call   41e4 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&)>
+    3651:	|  |  |  |            48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        Length const l = m;
+    3655:	|  |  |  |            48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3659:	|  |  |  |            48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        Length const r = n - m - 1;
+    365d:	|  |  |  |            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    3661:	|  |  |  |            48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    3665:	|  |  |  |            48 83 e8 01          	sub    $0x1,%rax
+    3669:	|  |  |  |            48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if (l < n / 8 || r < n / 8) {
+    366d:	|  |  |  |            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    3671:	|  |  |  |            48 c1 e8 03          	shr    $0x3,%rax
+    3675:	|  |  |  |            48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    3679:	|  |  |  |        /-- 72 0e                	jb     3689 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x125>
+    367b:	|  |  |  |        |   48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    367f:	|  |  |  |        |   48 c1 e8 03          	shr    $0x3,%rax
+    3683:	|  |  |  |        |   48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    3687:	|  |  |  |     /--|-- 73 63                	jae    36ec <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x188>
+            bad_allowed -= 1;
+    3689:	|  |  |  |     |  \-> 48 83 6d b0 01       	subq   $0x1,-0x50(%rbp)
+            if (bad_allowed == 0) {
+    368e:	|  |  |  |     |      48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+    3693:	|  |  |  |     |  /-- 75 1c                	jne    36b1 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x14d>
+                heap(p, n, less);
+    3695:	|  |  |  |     |  |   48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    3699:	|  |  |  |     |  |   48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+    369d:	|  |  |  |     |  |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    36a1:	|  |  |  |     |  |   48 89 ce             	mov    %rcx,%rsi
+    36a4:	|  |  |  |     |  |   48 89 c7             	mov    %rax,%rdi
+    36a7:	|  |  |  |     |  |   e8 2c 0d 00 00       	call   43d8 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>
+                return;
+    36ac:	|  |  +--|-----|--|-- e9 2b 01 00 00       	jmp    37dc <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x278>
+            break_patterns(p, l);
+    36b1:	|  |  |  |     |  \-> 48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    36b5:	|  |  |  |     |      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    36b9:	|  |  |  |     |      48 89 d6             	mov    %rdx,%rsi
+    36bc:	|  |  |  |     |      48 89 c7             	mov    %rax,%rdi
+    36bf:	|  |  |  |     |      e8 06 0f 00 00       	call   45ca <void nel::sort::break_patterns<int>(int*, unsigned long)>
+            break_patterns(p + m + 1, r);
+    36c4:	|  |  |  |     |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    36c8:	|  |  |  |     |      48 83 c0 01          	add    $0x1,%rax
+    36cc:	|  |  |  |     |      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    36d3:	|  |  |  |     |      00 
+    36d4:	|  |  |  |     |      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    36d8:	|  |  |  |     |      48 01 c2             	add    %rax,%rdx
+    36db:	|  |  |  |     |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    36df:	|  |  |  |     |      48 89 c6             	mov    %rax,%rsi
+    36e2:	|  |  |  |     |      48 89 d7             	mov    %rdx,%rdi
+    36e5:	|  |  |  |     |      e8 e0 0e 00 00       	call   45ca <void nel::sort::break_patterns<int>(int*, unsigned long)>
+    36ea:	|  |  |  |  /--|----- eb 66                	jmp    3752 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x1ee>
+                   && partial_insertion(p + m + 1, r, less)) {
+    36ec:	|  |  |  |  |  \----> 0f b6 45 df          	movzbl -0x21(%rbp),%eax
+    36f0:	|  |  |  |  |         84 c0                	test   %al,%al
+    36f2:	|  |  |  |  |  /----- 74 51                	je     3745 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x1e1>
+        } else if (already && partial_insertion(p, l, less)
+    36f4:	|  |  |  |  |  |      48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    36f8:	|  |  |  |  |  |      48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    36fc:	|  |  |  |  |  |      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3700:	|  |  |  |  |  |      48 89 ce             	mov    %rcx,%rsi
+    3703:	|  |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    3706:	|  |  |  |  |  |      e8 32 0f 00 00       	call   463d <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>
+    370b:	|  |  |  |  |  |      84 c0                	test   %al,%al
+    370d:	|  |  |  |  |  +----- 74 36                	je     3745 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x1e1>
+                   && partial_insertion(p + m + 1, r, less)) {
+    370f:	|  |  |  |  |  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3713:	|  |  |  |  |  |      48 83 c0 01          	add    $0x1,%rax
+    3717:	|  |  |  |  |  |      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    371e:	|  |  |  |  |  |      00 
+    371f:	|  |  |  |  |  |      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3723:	|  |  |  |  |  |      48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    3727:	|  |  |  |  |  |      48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    372b:	|  |  |  |  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    372f:	|  |  |  |  |  |      48 89 c6             	mov    %rax,%rsi
+    3732:	|  |  |  |  |  |      48 89 cf             	mov    %rcx,%rdi
+    3735:	|  |  |  |  |  |      e8 03 0f 00 00       	call   463d <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>
+    373a:	|  |  |  |  |  |      84 c0                	test   %al,%al
+    373c:	|  |  |  |  |  +----- 74 07                	je     3745 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x1e1>
+    373e:	|  |  |  |  |  |      b8 01 00 00 00       	mov    $0x1,%eax
+    3743:	|  |  |  |  |  |  /-- eb 05                	jmp    374a <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x1e6>
+    3745:	|  |  |  |  |  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        } else if (already && partial_insertion(p, l, less)
+    374a:	|  |  |  |  |     \-> 84 c0                	test   %al,%al
+    374c:	|  |  |  |  |  /----- 0f 85 89 00 00 00    	jne    37db <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x277>
+        if (l < r) {
+    3752:	|  |  |  |  \--|----> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3756:	|  |  |  |     |      48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+    375a:	|  |  |  |     |  /-- 73 40                	jae    379c <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x238>
+            pdq(p, l, less, bad_allowed, leftmost);
+    375c:	|  |  |  |     |  |   0f b6 7d ac          	movzbl -0x54(%rbp),%edi
+    3760:	|  |  |  |     |  |   48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+    3764:	|  |  |  |     |  |   48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    3768:	|  |  |  |     |  |   48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+    376c:	|  |  |  |     |  |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3770:	|  |  |  |     |  |   41 89 f8             	mov    %edi,%r8d
+    3773:	|  |  |  |     |  |   48 89 c7             	mov    %rax,%rdi
+    3776:	+--|--|--|-----|--|-- e8 e9 fd ff ff       	call   3564 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)>
+            p += m + 1;
+    377b:	|  |  |  |     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    377f:	|  |  |  |     |  |   48 83 c0 01          	add    $0x1,%rax
+    3783:	|  |  |  |     |  |   48 c1 e0 02          	shl    $0x2,%rax
+    3787:	|  |  |  |     |  |   48 01 45 c8          	add    %rax,-0x38(%rbp)
+            n = r;
+    378b:	|  |  |  |     |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    378f:	|  |  |  |     |  |   48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            leftmost = false;
+    3793:	|  |  |  |     |  |   c6 45 ac 00          	movb   $0x0,-0x54(%rbp)
+    3797:	|  +--|--|-----|--|-- e9 e6 fd ff ff       	jmp    3582 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x1e>
+            pdq(p + m + 1, r, less, bad_allowed, false);
+    379c:	|  |  |  |     |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    37a0:	|  |  |  |     |      48 83 c0 01          	add    $0x1,%rax
+    37a4:	|  |  |  |     |      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    37ab:	|  |  |  |     |      00 
+    37ac:	|  |  |  |     |      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    37b0:	|  |  |  |     |      48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+    37b4:	|  |  |  |     |      48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+    37b8:	|  |  |  |     |      48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    37bc:	|  |  |  |     |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    37c0:	|  |  |  |     |      41 b8 00 00 00 00    	mov    $0x0,%r8d
+    37c6:	|  |  |  |     |      48 89 c6             	mov    %rax,%rsi
+    37c9:	\--|--|--|-----|----- e8 96 fd ff ff       	call   3564 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)>
+            n = l;
+    37ce:	   |  |  |     |      48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    37d2:	   |  |  |     |      48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    while (true) {
+    37d6:	   \--|--\-----|----X e9 a7 fd ff ff       	jmp    3582 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool)+0x1e>
+            return;
+    37db:	      |        \----> 90                   	nop
+}
+    37dc:	      \-------------> c9                   	leave
+    37dd:	                      c3                   	ret
+
+00000000000037de <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>:
+void insertion(T p[], Length const n, F &less)
+    37de:	                   55                   	push   %rbp
+    37df:	                   48 89 e5             	mov    %rsp,%rbp
+    37e2:	                   48 83 ec 40          	sub    $0x40,%rsp
+    37e6:	                   48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    37ea:	                   48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    37ee:	                   48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    for (Index i = 1; i < n; ++i) {
+    37f2:	                   48 c7 45 f8 01 00 00 	movq   $0x1,-0x8(%rbp)
+    37f9:	                   00 
+    37fa:	   /-------------- e9 0b 01 00 00       	jmp    390a <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x12c>
+        if (!less(p[i], p[i - 1])) { continue; }
+    37ff:	/--|-------------> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3803:	|  |               48 c1 e0 02          	shl    $0x2,%rax
+    3807:	|  |               48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    380b:	|  |               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    380f:	|  |               48 01 c2             	add    %rax,%rdx
+    3812:	|  |               48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3816:	|  |               48 8d 0c 85 00 00 00 	lea    0x0(,%rax,4),%rcx
+    381d:	|  |               00 
+    381e:	|  |               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3822:	|  |               48 01 c1             	add    %rax,%rcx
+    3825:	|  |               48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3829:	|  |               48 89 ce             	mov    %rcx,%rsi
+    382c:	|  |               48 89 c7             	mov    %rax,%rdi
+    382f:	|  |               e8 b2 07 00 00       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    3834:	|  |               83 f0 01             	xor    $0x1,%eax
+    3837:	|  |               84 c0                	test   %al,%al
+    3839:	|  |  /----------- 0f 85 c5 00 00 00    	jne    3904 <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x126>
+        T t = move(p[i]);
+    383f:	|  |  |            48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3843:	|  |  |            48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    384a:	|  |  |            00 
+    384b:	|  |  |            48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    384f:	|  |  |            48 01 d0             	add    %rdx,%rax
+    3852:	|  |  |            48 89 c7             	mov    %rax,%rdi
+    3855:	|  |  |            e8 44 0f 00 00       	call   479e <int&& nel::move<int>(int&)>
+    385a:	|  |  |            8b 00                	mov    (%rax),%eax
+    385c:	|  |  |            89 45 ec             	mov    %eax,-0x14(%rbp)
+        Index j = i;
+    385f:	|  |  |            48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3863:	|  |  |            48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            p[j] = move(p[j - 1]);
+    3867:	|  |  |  /-------> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    386b:	|  |  |  |         48 c1 e0 02          	shl    $0x2,%rax
+    386f:	|  |  |  |         48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    3873:	|  |  |  |         48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3877:	|  |  |  |         48 01 d0             	add    %rdx,%rax
+    387a:	|  |  |  |         48 89 c7             	mov    %rax,%rdi
+    387d:	|  |  |  |         e8 1c 0f 00 00       	call   479e <int&& nel::move<int>(int&)>
+    3882:	|  |  |  |         48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3886:	|  |  |  |         48 8d 0c 95 00 00 00 	lea    0x0(,%rdx,4),%rcx
+    388d:	|  |  |  |         00 
+    388e:	|  |  |  |         48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    3892:	|  |  |  |         48 01 ca             	add    %rcx,%rdx
+    3895:	|  |  |  |         8b 00                	mov    (%rax),%eax
+    3897:	|  |  |  |         89 02                	mov    %eax,(%rdx)
+            j -= 1;
+    3899:	|  |  |  |         48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        } while (j > 0 && less(t, p[j - 1]));
+    389e:	|  |  |  |         48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    38a3:	|  |  |  |  /----- 74 31                	je     38d6 <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0xf8>
+    38a5:	|  |  |  |  |      48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    38a9:	|  |  |  |  |      48 c1 e0 02          	shl    $0x2,%rax
+    38ad:	|  |  |  |  |      48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    38b1:	|  |  |  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    38b5:	|  |  |  |  |      48 01 c2             	add    %rax,%rdx
+    38b8:	|  |  |  |  |      48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+    38bc:	|  |  |  |  |      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    38c0:	|  |  |  |  |      48 89 ce             	mov    %rcx,%rsi
+    38c3:	|  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    38c6:	|  |  |  |  |      e8 1b 07 00 00       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    38cb:	|  |  |  |  |      84 c0                	test   %al,%al
+    38cd:	|  |  |  |  +----- 74 07                	je     38d6 <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0xf8>
+    38cf:	|  |  |  |  |      b8 01 00 00 00       	mov    $0x1,%eax
+    38d4:	|  |  |  |  |  /-- eb 05                	jmp    38db <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0xfd>
+    38d6:	|  |  |  |  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    38db:	|  |  |  |     \-> 84 c0                	test   %al,%al
+    38dd:	|  |  |  \-------- 75 88                	jne    3867 <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x89>
+        p[j] = move(t);
+    38df:	|  |  |            48 8d 45 ec          	lea    -0x14(%rbp),%rax
+    38e3:	|  |  |            48 89 c7             	mov    %rax,%rdi
+    38e6:	|  |  |            e8 b3 0e 00 00       	call   479e <int&& nel::move<int>(int&)>
+    38eb:	|  |  |            48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    38ef:	|  |  |            48 8d 0c 95 00 00 00 	lea    0x0(,%rdx,4),%rcx
+    38f6:	|  |  |            00 
+    38f7:	|  |  |            48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    38fb:	|  |  |            48 01 ca             	add    %rcx,%rdx
+    38fe:	|  |  |            8b 00                	mov    (%rax),%eax
+    3900:	|  |  |            89 02                	mov    %eax,(%rdx)
+    3902:	|  |  |        /-- eb 01                	jmp    3905 <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x127>
+        if (!less(p[i], p[i - 1])) { continue; }
+    3904:	|  |  \--------|-> 90                   	nop
+    for (Index i = 1; i < n; ++i) {
+    3905:	|  |           \-> 48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    390a:	|  \-------------> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    390e:	|                  48 3b 45 d0          	cmp    -0x30(%rbp),%rax
+    3912:	\----------------- 0f 82 e7 fe ff ff    	jb     37ff <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x21>
+}
+    3918:	                   90                   	nop
+    3919:	                   90                   	nop
+    391a:	                   c9                   	leave
+    391b:	                   c3                   	ret
+
+000000000000391c <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)>:
+void merge(T p[], Length const m, Length const n, T buf[], Length const buf_n, F &less)
+    391c:	/----------------------> 55                   	push   %rbp
+    391d:	|                        48 89 e5             	mov    %rsp,%rbp
+    3920:	|                        48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+    3927:	|                        48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+    392b:	|                        48 89 75 80          	mov    %rsi,-0x80(%rbp)
+    392f:	|                        48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+    3936:	|                        48 89 8d 70 ff ff ff 	mov    %rcx,-0x90(%rbp)
+    393d:	|                        4c 89 85 68 ff ff ff 	mov    %r8,-0x98(%rbp)
+    3944:	|                        4c 89 8d 60 ff ff ff 	mov    %r9,-0xa0(%rbp)
+    if (m == 0 || m == n || !less(p[m], p[m - 1])) { return; }
+    394b:	|                        48 83 7d 80 00       	cmpq   $0x0,-0x80(%rbp)
+    3950:	|                    /-- 74 4c                	je     399e <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x82>
+    3952:	|                    |   48 8b 45 80          	mov    -0x80(%rbp),%rax
+    3956:	|                    |   48 3b 85 78 ff ff ff 	cmp    -0x88(%rbp),%rax
+    395d:	|                    +-- 74 3f                	je     399e <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x82>
+    395f:	|                    |   48 8b 45 80          	mov    -0x80(%rbp),%rax
+    3963:	|                    |   48 c1 e0 02          	shl    $0x2,%rax
+    3967:	|                    |   48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    396b:	|                    |   48 8b 45 88          	mov    -0x78(%rbp),%rax
+    396f:	|                    |   48 01 c2             	add    %rax,%rdx
+    3972:	|                    |   48 8b 45 80          	mov    -0x80(%rbp),%rax
+    3976:	|                    |   48 8d 0c 85 00 00 00 	lea    0x0(,%rax,4),%rcx
+    397d:	|                    |   00 
+    397e:	|                    |   48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3982:	|                    |   48 01 c1             	add    %rax,%rcx
+    3985:	|                    |   48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+    398c:	|                    |   48 89 ce             	mov    %rcx,%rsi
+    398f:	|                    |   48 89 c7             	mov    %rax,%rdi
+    3992:	|                    |   e8 4f 06 00 00       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    3997:	|                    |   83 f0 01             	xor    $0x1,%eax
+    399a:	|                    |   84 c0                	test   %al,%al
+    399c:	|                 /--|-- 74 07                	je     39a5 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x89>
+    399e:	|                 |  \-> b8 01 00 00 00       	mov    $0x1,%eax
+    39a3:	|                 |  /-- eb 05                	jmp    39aa <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x8e>
+    39a5:	|                 \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    39aa:	|                    \-> 84 c0                	test   %al,%al
+    39ac:	|  /-------------------- 0f 85 9c 04 00 00    	jne    3e4e <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x532>
+    Length const a = m;
+    39b2:	|  |                     48 8b 45 80          	mov    -0x80(%rbp),%rax
+    39b6:	|  |                     48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    Length const b = n - m;
+    39ba:	|  |                     48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+    39c1:	|  |                     48 2b 45 80          	sub    -0x80(%rbp),%rax
+    39c5:	|  |                     48 89 45 a0          	mov    %rax,-0x60(%rbp)
+    if (a <= b && a <= buf_n) {
+    39c9:	|  |                     48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    39cd:	|  |                     48 39 45 a0          	cmp    %rax,-0x60(%rbp)
+    39d1:	|  |     /-------------- 0f 82 84 01 00 00    	jb     3b5b <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x23f>
+    39d7:	|  |     |               48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    39db:	|  |     |               48 39 85 68 ff ff ff 	cmp    %rax,-0x98(%rbp)
+    39e2:	|  |     +-------------- 0f 82 73 01 00 00    	jb     3b5b <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x23f>
+        for (Index i = 0; i < a; ++i) {
+    39e8:	|  |     |               48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    39ef:	|  |     |               00 
+    39f0:	|  |     |           /-- eb 3a                	jmp    3a2c <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x110>
+            buf[i] = move(p[i]);
+    39f2:	|  |     |        /--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    39f6:	|  |     |        |  |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    39fd:	|  |     |        |  |   00 
+    39fe:	|  |     |        |  |   48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3a02:	|  |     |        |  |   48 01 d0             	add    %rdx,%rax
+    3a05:	|  |     |        |  |   48 89 c7             	mov    %rax,%rdi
+    3a08:	|  |     |        |  |   e8 91 0d 00 00       	call   479e <int&& nel::move<int>(int&)>
+    3a0d:	|  |     |        |  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3a11:	|  |     |        |  |   48 8d 0c 95 00 00 00 	lea    0x0(,%rdx,4),%rcx
+    3a18:	|  |     |        |  |   00 
+    3a19:	|  |     |        |  |   48 8b 95 70 ff ff ff 	mov    -0x90(%rbp),%rdx
+    3a20:	|  |     |        |  |   48 01 ca             	add    %rcx,%rdx
+    3a23:	|  |     |        |  |   8b 00                	mov    (%rax),%eax
+    3a25:	|  |     |        |  |   89 02                	mov    %eax,(%rdx)
+        for (Index i = 0; i < a; ++i) {
+    3a27:	|  |     |        |  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    3a2c:	|  |     |        |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a30:	|  |     |        |      48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    3a34:	|  |     |        \----- 72 bc                	jb     39f2 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0xd6>
+        Index i = 0;
+    3a36:	|  |     |               48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    3a3d:	|  |     |               00 
+        Index j = m;
+    3a3e:	|  |     |               48 8b 45 80          	mov    -0x80(%rbp),%rax
+    3a42:	|  |     |               48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        Index o = 0;
+    3a46:	|  |     |               48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+    3a4d:	|  |     |               00 
+        while (i < a && j < n) {
+    3a4e:	|  |     |     /-------- e9 9f 00 00 00       	jmp    3af2 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x1d6>
+            p[o++] = less(p[j], buf[i]) ? move(p[j++]) : move(buf[i++]);
+    3a53:	|  |     |  /--|-------> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3a57:	|  |     |  |  |         48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3a5e:	|  |     |  |  |         00 
+    3a5f:	|  |     |  |  |         48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+    3a66:	|  |     |  |  |         48 01 c2             	add    %rax,%rdx
+    3a69:	|  |     |  |  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3a6d:	|  |     |  |  |         48 8d 0c 85 00 00 00 	lea    0x0(,%rax,4),%rcx
+    3a74:	|  |     |  |  |         00 
+    3a75:	|  |     |  |  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3a79:	|  |     |  |  |         48 01 c1             	add    %rax,%rcx
+    3a7c:	|  |     |  |  |         48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+    3a83:	|  |     |  |  |         48 89 ce             	mov    %rcx,%rsi
+    3a86:	|  |     |  |  |         48 89 c7             	mov    %rax,%rdi
+    3a89:	|  |     |  |  |         e8 58 05 00 00       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    3a8e:	|  |     |  |  |         84 c0                	test   %al,%al
+    3a90:	|  |     |  |  |     /-- 74 23                	je     3ab5 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x199>
+    3a92:	|  |     |  |  |     |   48 8b 4d 88          	mov    -0x78(%rbp),%rcx
+    3a96:	|  |     |  |  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3a9a:	|  |     |  |  |     |   48 8d 50 01          	lea    0x1(%rax),%rdx
+    3a9e:	|  |     |  |  |     |   48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    3aa2:	|  |     |  |  |     |   48 c1 e0 02          	shl    $0x2,%rax
+    3aa6:	|  |     |  |  |     |   48 01 c8             	add    %rcx,%rax
+    3aa9:	|  |     |  |  |     |   48 89 c7             	mov    %rax,%rdi
+    3aac:	|  |     |  |  |     |   e8 ed 0c 00 00       	call   479e <int&& nel::move<int>(int&)>
+    3ab1:	|  |     |  |  |     |   8b 00                	mov    (%rax),%eax
+    3ab3:	|  |     |  |  |  /--|-- eb 24                	jmp    3ad9 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x1bd>
+    3ab5:	|  |     |  |  |  |  \-> 48 8b 8d 70 ff ff ff 	mov    -0x90(%rbp),%rcx
+    3abc:	|  |     |  |  |  |      48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3ac0:	|  |     |  |  |  |      48 8d 50 01          	lea    0x1(%rax),%rdx
+    3ac4:	|  |     |  |  |  |      48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    3ac8:	|  |     |  |  |  |      48 c1 e0 02          	shl    $0x2,%rax
+    3acc:	|  |     |  |  |  |      48 01 c8             	add    %rcx,%rax
+    3acf:	|  |     |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    3ad2:	|  |     |  |  |  |      e8 c7 0c 00 00       	call   479e <int&& nel::move<int>(int&)>
+    3ad7:	|  |     |  |  |  |      8b 00                	mov    (%rax),%eax
+    3ad9:	|  |     |  |  |  \----> 48 8b 75 88          	mov    -0x78(%rbp),%rsi
+    3add:	|  |     |  |  |         48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    3ae1:	|  |     |  |  |         48 8d 4a 01          	lea    0x1(%rdx),%rcx
+    3ae5:	|  |     |  |  |         48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+    3ae9:	|  |     |  |  |         48 c1 e2 02          	shl    $0x2,%rdx
+    3aed:	|  |     |  |  |         48 01 f2             	add    %rsi,%rdx
+    3af0:	|  |     |  |  |         89 02                	mov    %eax,(%rdx)
+        while (i < a && j < n) {
+    3af2:	|  |     |  |  \-------> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3af6:	|  |     |  |            48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    3afa:	|  |     |  |     /----- 73 50                	jae    3b4c <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x230>
+    3afc:	|  |     |  |     |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3b00:	|  |     |  |     |      48 3b 85 78 ff ff ff 	cmp    -0x88(%rbp),%rax
+    3b07:	|  |     |  \-----|----- 0f 82 46 ff ff ff    	jb     3a53 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x137>
+        while (i < a) {
+    3b0d:	|  |     |        +----- eb 3d                	jmp    3b4c <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x230>
+            p[o++] = move(buf[i++]);
+    3b0f:	|  |     |        |  /-> 48 8b 8d 70 ff ff ff 	mov    -0x90(%rbp),%rcx
+    3b16:	|  |     |        |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3b1a:	|  |     |        |  |   48 8d 50 01          	lea    0x1(%rax),%rdx
+    3b1e:	|  |     |        |  |   48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    3b22:	|  |     |        |  |   48 c1 e0 02          	shl    $0x2,%rax
+    3b26:	|  |     |        |  |   48 01 c8             	add    %rcx,%rax
+    3b29:	|  |     |        |  |   48 89 c7             	mov    %rax,%rdi
+    3b2c:	|  |     |        |  |   e8 6d 0c 00 00       	call   479e <int&& nel::move<int>(int&)>
+    3b31:	|  |     |        |  |   8b 10                	mov    (%rax),%edx
+    3b33:	|  |     |        |  |   48 8b 75 88          	mov    -0x78(%rbp),%rsi
+    3b37:	|  |     |        |  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3b3b:	|  |     |        |  |   48 8d 48 01          	lea    0x1(%rax),%rcx
+    3b3f:	|  |     |        |  |   48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+    3b43:	|  |     |        |  |   48 c1 e0 02          	shl    $0x2,%rax
+    3b47:	|  |     |        |  |   48 01 f0             	add    %rsi,%rax
+    3b4a:	|  |     |        |  |   89 10                	mov    %edx,(%rax)
+        while (i < a) {
+    3b4c:	|  |     |        \--|-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3b50:	|  |     |           |   48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    3b54:	|  |     |           \-- 72 b9                	jb     3b0f <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x1f3>
+    } else if (b < a && b <= buf_n) {
+    3b56:	|  |  /--|-------------- e9 f4 02 00 00       	jmp    3e4f <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x533>
+    3b5b:	|  |  |  \-------------> 48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    3b5f:	|  |  |                  48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    3b63:	|  |  |  /-------------- 0f 83 73 01 00 00    	jae    3cdc <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x3c0>
+    3b69:	|  |  |  |               48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    3b6d:	|  |  |  |               48 39 85 68 ff ff ff 	cmp    %rax,-0x98(%rbp)
+    3b74:	|  |  |  +-------------- 0f 82 62 01 00 00    	jb     3cdc <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x3c0>
+        for (Index j = 0; j < b; ++j) {
+    3b7a:	|  |  |  |               48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+    3b81:	|  |  |  |               00 
+    3b82:	|  |  |  |           /-- eb 41                	jmp    3bc5 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x2a9>
+            buf[j] = move(p[m + j]);
+    3b84:	|  |  |  |        /--|-> 48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    3b88:	|  |  |  |        |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3b8c:	|  |  |  |        |  |   48 01 d0             	add    %rdx,%rax
+    3b8f:	|  |  |  |        |  |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3b96:	|  |  |  |        |  |   00 
+    3b97:	|  |  |  |        |  |   48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3b9b:	|  |  |  |        |  |   48 01 d0             	add    %rdx,%rax
+    3b9e:	|  |  |  |        |  |   48 89 c7             	mov    %rax,%rdi
+    3ba1:	|  |  |  |        |  |   e8 f8 0b 00 00       	call   479e <int&& nel::move<int>(int&)>
+    3ba6:	|  |  |  |        |  |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    3baa:	|  |  |  |        |  |   48 8d 0c 95 00 00 00 	lea    0x0(,%rdx,4),%rcx
+    3bb1:	|  |  |  |        |  |   00 
+    3bb2:	|  |  |  |        |  |   48 8b 95 70 ff ff ff 	mov    -0x90(%rbp),%rdx
+    3bb9:	|  |  |  |        |  |   48 01 ca             	add    %rcx,%rdx
+    3bbc:	|  |  |  |        |  |   8b 00                	mov    (%rax),%eax
+    3bbe:	|  |  |  |        |  |   89 02                	mov    %eax,(%rdx)
+        for (Index j = 0; j < b; ++j) {
+    3bc0:	|  |  |  |        |  |   48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+    3bc5:	|  |  |  |        |  \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3bc9:	|  |  |  |        |      48 3b 45 a0          	cmp    -0x60(%rbp),%rax
+    3bcd:	|  |  |  |        \----- 72 b5                	jb     3b84 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x268>
+        Index i = m;
+    3bcf:	|  |  |  |               48 8b 45 80          	mov    -0x80(%rbp),%rax
+    3bd3:	|  |  |  |               48 89 45 d0          	mov    %rax,-0x30(%rbp)
+        Index j = b;
+    3bd7:	|  |  |  |               48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    3bdb:	|  |  |  |               48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        Index o = n;
+    3bdf:	|  |  |  |               48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+    3be6:	|  |  |  |               48 89 45 c0          	mov    %rax,-0x40(%rbp)
+        while (i > 0 && j > 0) {
+    3bea:	|  |  |  |     /-------- e9 96 00 00 00       	jmp    3c85 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x369>
+            p[--o] = less(buf[j - 1], p[i - 1]) ? move(p[--i]) : move(buf[--j]);
+    3bef:	|  |  |  |  /--|-------> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3bf3:	|  |  |  |  |  |         48 c1 e0 02          	shl    $0x2,%rax
+    3bf7:	|  |  |  |  |  |         48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    3bfb:	|  |  |  |  |  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3bff:	|  |  |  |  |  |         48 01 c2             	add    %rax,%rdx
+    3c02:	|  |  |  |  |  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3c06:	|  |  |  |  |  |         48 c1 e0 02          	shl    $0x2,%rax
+    3c0a:	|  |  |  |  |  |         48 8d 48 fc          	lea    -0x4(%rax),%rcx
+    3c0e:	|  |  |  |  |  |         48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+    3c15:	|  |  |  |  |  |         48 01 c1             	add    %rax,%rcx
+    3c18:	|  |  |  |  |  |         48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+    3c1f:	|  |  |  |  |  |         48 89 ce             	mov    %rcx,%rsi
+    3c22:	|  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    3c25:	|  |  |  |  |  |         e8 bc 03 00 00       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    3c2a:	|  |  |  |  |  |         84 c0                	test   %al,%al
+    3c2c:	|  |  |  |  |  |     /-- 74 20                	je     3c4e <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x332>
+    3c2e:	|  |  |  |  |  |     |   48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3c32:	|  |  |  |  |  |     |   48 83 6d d0 01       	subq   $0x1,-0x30(%rbp)
+    3c37:	|  |  |  |  |  |     |   48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    3c3b:	|  |  |  |  |  |     |   48 c1 e2 02          	shl    $0x2,%rdx
+    3c3f:	|  |  |  |  |  |     |   48 01 d0             	add    %rdx,%rax
+    3c42:	|  |  |  |  |  |     |   48 89 c7             	mov    %rax,%rdi
+    3c45:	|  |  |  |  |  |     |   e8 54 0b 00 00       	call   479e <int&& nel::move<int>(int&)>
+    3c4a:	|  |  |  |  |  |     |   8b 00                	mov    (%rax),%eax
+    3c4c:	|  |  |  |  |  |  /--|-- eb 21                	jmp    3c6f <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x353>
+    3c4e:	|  |  |  |  |  |  |  \-> 48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+    3c55:	|  |  |  |  |  |  |      48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+    3c5a:	|  |  |  |  |  |  |      48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    3c5e:	|  |  |  |  |  |  |      48 c1 e2 02          	shl    $0x2,%rdx
+    3c62:	|  |  |  |  |  |  |      48 01 d0             	add    %rdx,%rax
+    3c65:	|  |  |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    3c68:	|  |  |  |  |  |  |      e8 31 0b 00 00       	call   479e <int&& nel::move<int>(int&)>
+    3c6d:	|  |  |  |  |  |  |      8b 00                	mov    (%rax),%eax
+    3c6f:	|  |  |  |  |  |  \----> 48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    3c73:	|  |  |  |  |  |         48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+    3c78:	|  |  |  |  |  |         48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+    3c7c:	|  |  |  |  |  |         48 c1 e1 02          	shl    $0x2,%rcx
+    3c80:	|  |  |  |  |  |         48 01 ca             	add    %rcx,%rdx
+    3c83:	|  |  |  |  |  |         89 02                	mov    %eax,(%rdx)
+        while (i > 0 && j > 0) {
+    3c85:	|  |  |  |  |  \-------> 48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    3c8a:	|  |  |  |  |     /----- 74 44                	je     3cd0 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x3b4>
+    3c8c:	|  |  |  |  |     |      48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    3c91:	|  |  |  |  \-----|----- 0f 85 58 ff ff ff    	jne    3bef <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x2d3>
+        while (j > 0) {
+    3c97:	|  |  |  |        +----- eb 37                	jmp    3cd0 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x3b4>
+            p[--o] = move(buf[--j]);
+    3c99:	|  |  |  |        |  /-> 48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+    3ca0:	|  |  |  |        |  |   48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+    3ca5:	|  |  |  |        |  |   48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    3ca9:	|  |  |  |        |  |   48 c1 e2 02          	shl    $0x2,%rdx
+    3cad:	|  |  |  |        |  |   48 01 d0             	add    %rdx,%rax
+    3cb0:	|  |  |  |        |  |   48 89 c7             	mov    %rax,%rdi
+    3cb3:	|  |  |  |        |  |   e8 e6 0a 00 00       	call   479e <int&& nel::move<int>(int&)>
+    3cb8:	|  |  |  |        |  |   8b 00                	mov    (%rax),%eax
+    3cba:	|  |  |  |        |  |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    3cbe:	|  |  |  |        |  |   48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+    3cc3:	|  |  |  |        |  |   48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+    3cc7:	|  |  |  |        |  |   48 c1 e1 02          	shl    $0x2,%rcx
+    3ccb:	|  |  |  |        |  |   48 01 ca             	add    %rcx,%rdx
+    3cce:	|  |  |  |        |  |   89 02                	mov    %eax,(%rdx)
+        while (j > 0) {
+    3cd0:	|  |  |  |        \--|-> 48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    3cd5:	|  |  |  |           \-- 75 c2                	jne    3c99 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x37d>
+    } else {
+    3cd7:	|  |  +--|-------------- e9 73 01 00 00       	jmp    3e4f <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x533>
+        if (a >= b) {
+    3cdc:	|  |  |  \-------------> 48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    3ce0:	|  |  |                  48 3b 45 a0          	cmp    -0x60(%rbp),%rax
+    3ce4:	|  |  |           /----- 72 59                	jb     3d3f <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x423>
+            c1 = a / 2;
+    3ce6:	|  |  |           |      48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    3cea:	|  |  |           |      48 d1 e8             	shr    %rax
+    3ced:	|  |  |           |      48 89 45 b8          	mov    %rax,-0x48(%rbp)
+            c2 = m + search::lower_bound(p + m, b, p[c1], less);
+    3cf1:	|  |  |           |      48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3cf5:	|  |  |           |      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3cfc:	|  |  |           |      00 
+    3cfd:	|  |  |           |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3d01:	|  |  |           |      48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+    3d05:	|  |  |           |      48 8b 45 80          	mov    -0x80(%rbp),%rax
+    3d09:	|  |  |           |      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3d10:	|  |  |           |      00 
+    3d11:	|  |  |           |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3d15:	|  |  |           |      48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+    3d19:	|  |  |           |      48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+    3d20:	|  |  |           |      48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    3d24:	|  |  |           |      48 89 d1             	mov    %rdx,%rcx
+    3d27:	|  |  |           |      48 89 f2             	mov    %rsi,%rdx
+    3d2a:	|  |  |           |      48 89 c6             	mov    %rax,%rsi
+    3d2d:	|  |  |           |      e8 aa 0a 00 00       	call   47dc <unsigned long nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)>
+    3d32:	|  |  |           |      48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    3d36:	|  |  |           |      48 01 d0             	add    %rdx,%rax
+    3d39:	|  |  |           |      48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    3d3d:	|  |  |           |  /-- eb 4a                	jmp    3d89 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x46d>
+            c2 = m + b / 2;
+    3d3f:	|  |  |           \--|-> 48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    3d43:	|  |  |              |   48 d1 e8             	shr    %rax
+    3d46:	|  |  |              |   48 89 c2             	mov    %rax,%rdx
+    3d49:	|  |  |              |   48 8b 45 80          	mov    -0x80(%rbp),%rax
+    3d4d:	|  |  |              |   48 01 d0             	add    %rdx,%rax
+    3d50:	|  |  |              |   48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            c1 = search::upper_bound(p, a, p[c2], less);
+    3d54:	|  |  |              |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3d58:	|  |  |              |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3d5f:	|  |  |              |   00 
+    3d60:	|  |  |              |   48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3d64:	|  |  |              |   48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+    3d68:	|  |  |              |   48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+    3d6f:	|  |  |              |   48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+    3d73:	|  |  |              |   48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3d77:	|  |  |              |   48 89 d1             	mov    %rdx,%rcx
+    3d7a:	|  |  |              |   48 89 fa             	mov    %rdi,%rdx
+    3d7d:	|  |  |              |   48 89 c7             	mov    %rax,%rdi
+    3d80:	|  |  |              |   e8 cc 0a 00 00       	call   4851 <unsigned long nel::search::upper_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)>
+    3d85:	|  |  |              |   48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        rotate(p + c1, m - c1, c2 - m);
+    3d89:	|  |  |              \-> 48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3d8d:	|  |  |                  48 2b 45 80          	sub    -0x80(%rbp),%rax
+    3d91:	|  |  |                  48 89 c2             	mov    %rax,%rdx
+    3d94:	|  |  |                  48 8b 45 80          	mov    -0x80(%rbp),%rax
+    3d98:	|  |  |                  48 2b 45 b8          	sub    -0x48(%rbp),%rax
+    3d9c:	|  |  |                  48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    3da0:	|  |  |                  48 8d 34 8d 00 00 00 	lea    0x0(,%rcx,4),%rsi
+    3da7:	|  |  |                  00 
+    3da8:	|  |  |                  48 8b 4d 88          	mov    -0x78(%rbp),%rcx
+    3dac:	|  |  |                  48 01 f1             	add    %rsi,%rcx
+    3daf:	|  |  |                  48 89 c6             	mov    %rax,%rsi
+    3db2:	|  |  |                  48 89 cf             	mov    %rcx,%rdi
+    3db5:	|  |  |                  e8 d8 0a 00 00       	call   4892 <void nel::sort::rotate<int>(int*, unsigned long, unsigned long)>
+        Index const nm = c1 + (c2 - m);
+    3dba:	|  |  |                  48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3dbe:	|  |  |                  48 2b 45 80          	sub    -0x80(%rbp),%rax
+    3dc2:	|  |  |                  48 89 c2             	mov    %rax,%rdx
+    3dc5:	|  |  |                  48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3dc9:	|  |  |                  48 01 d0             	add    %rdx,%rax
+    3dcc:	|  |  |                  48 89 45 98          	mov    %rax,-0x68(%rbp)
+        merge(p, c1, nm, buf, buf_n, less);
+    3dd0:	|  |  |                  4c 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%r8
+    3dd7:	|  |  |                  48 8b bd 68 ff ff ff 	mov    -0x98(%rbp),%rdi
+    3dde:	|  |  |                  48 8b 8d 70 ff ff ff 	mov    -0x90(%rbp),%rcx
+    3de5:	|  |  |                  48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    3de9:	|  |  |                  48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+    3ded:	|  |  |                  48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3df1:	|  |  |                  4d 89 c1             	mov    %r8,%r9
+    3df4:	|  |  |                  49 89 f8             	mov    %rdi,%r8
+    3df7:	|  |  |                  48 89 c7             	mov    %rax,%rdi
+    3dfa:	+--|--|----------------- e8 1d fb ff ff       	call   391c <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)>
+        merge(p + nm, c2 - nm, n - nm, buf, buf_n, less);
+    3dff:	|  |  |                  48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+    3e06:	|  |  |                  48 2b 45 98          	sub    -0x68(%rbp),%rax
+    3e0a:	|  |  |                  48 89 c2             	mov    %rax,%rdx
+    3e0d:	|  |  |                  48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3e11:	|  |  |                  48 2b 45 98          	sub    -0x68(%rbp),%rax
+    3e15:	|  |  |                  48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+    3e19:	|  |  |                  48 8d 34 8d 00 00 00 	lea    0x0(,%rcx,4),%rsi
+    3e20:	|  |  |                  00 
+    3e21:	|  |  |                  48 8b 4d 88          	mov    -0x78(%rbp),%rcx
+    3e25:	|  |  |                  48 8d 3c 0e          	lea    (%rsi,%rcx,1),%rdi
+    3e29:	|  |  |                  4c 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%r8
+    3e30:	|  |  |                  48 8b b5 68 ff ff ff 	mov    -0x98(%rbp),%rsi
+    3e37:	|  |  |                  48 8b 8d 70 ff ff ff 	mov    -0x90(%rbp),%rcx
+    3e3e:	|  |  |                  4d 89 c1             	mov    %r8,%r9
+    3e41:	|  |  |                  49 89 f0             	mov    %rsi,%r8
+    3e44:	|  |  |                  48 89 c6             	mov    %rax,%rsi
+    3e47:	\--|--|----------------- e8 d0 fa ff ff       	call   391c <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)>
+    3e4c:	   |  +----------------- eb 01                	jmp    3e4f <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x533>
+    if (m == 0 || m == n || !less(p[m], p[m - 1])) { return; }
+    3e4e:	   \--|----------------> 90                   	nop
+}
+    3e4f:	      \----------------> c9                   	leave
+    3e50:	                         c3                   	ret
+
+0000000000003e51 <void nel::sort::choose_pivot<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>:
+void choose_pivot(T p[], Length const n, F &less)
+    3e51:	       55                   	push   %rbp
+    3e52:	       48 89 e5             	mov    %rsp,%rbp
+    3e55:	       48 83 ec 30          	sub    $0x30,%rsp
+    3e59:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3e5d:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    3e61:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    Index const h = n / 2;
+    3e65:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3e69:	       48 d1 e8             	shr    %rax
+    3e6c:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (n > ninther_n) {
+    3e70:	       48 81 7d e0 80 00 00 	cmpq   $0x80,-0x20(%rbp)
+    3e77:	       00 
+    3e78:	/----- 0f 86 27 01 00 00    	jbe    3fa5 <void nel::sort::choose_pivot<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x154>
+        sort3(p[0], p[h], p[n - 1], less);
+    3e7e:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3e82:	|      48 c1 e0 02          	shl    $0x2,%rax
+    3e86:	|      48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    3e8a:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3e8e:	|      48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+    3e92:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3e96:	|      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3e9d:	|      00 
+    3e9e:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3ea2:	|      48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+    3ea6:	|      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    3eaa:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3eae:	|      48 89 d1             	mov    %rdx,%rcx
+    3eb1:	|      48 89 fa             	mov    %rdi,%rdx
+    3eb4:	|      48 89 c7             	mov    %rax,%rdi
+    3eb7:	|      e8 3c 0a 00 00       	call   48f8 <void nel::sort::sort3<int, nel::sort::Less>(int&, int&, int&, nel::sort::Less&)>
+        sort3(p[1], p[h - 1], p[n - 2], less);
+    3ebc:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3ec0:	|      48 c1 e0 02          	shl    $0x2,%rax
+    3ec4:	|      48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    3ec8:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3ecc:	|      48 01 c2             	add    %rax,%rdx
+    3ecf:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3ed3:	|      48 c1 e0 02          	shl    $0x2,%rax
+    3ed7:	|      48 8d 48 fc          	lea    -0x4(%rax),%rcx
+    3edb:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3edf:	|      48 8d 34 01          	lea    (%rcx,%rax,1),%rsi
+    3ee3:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3ee7:	|      48 8d 78 04          	lea    0x4(%rax),%rdi
+    3eeb:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3eef:	|      48 89 c1             	mov    %rax,%rcx
+    3ef2:	|      e8 01 0a 00 00       	call   48f8 <void nel::sort::sort3<int, nel::sort::Less>(int&, int&, int&, nel::sort::Less&)>
+        sort3(p[2], p[h + 1], p[n - 3], less);
+    3ef7:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3efb:	|      48 c1 e0 02          	shl    $0x2,%rax
+    3eff:	|      48 8d 50 f4          	lea    -0xc(%rax),%rdx
+    3f03:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3f07:	|      48 01 c2             	add    %rax,%rdx
+    3f0a:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f0e:	|      48 83 c0 01          	add    $0x1,%rax
+    3f12:	|      48 8d 0c 85 00 00 00 	lea    0x0(,%rax,4),%rcx
+    3f19:	|      00 
+    3f1a:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3f1e:	|      48 8d 34 01          	lea    (%rcx,%rax,1),%rsi
+    3f22:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3f26:	|      48 8d 78 08          	lea    0x8(%rax),%rdi
+    3f2a:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3f2e:	|      48 89 c1             	mov    %rax,%rcx
+    3f31:	|      e8 c2 09 00 00       	call   48f8 <void nel::sort::sort3<int, nel::sort::Less>(int&, int&, int&, nel::sort::Less&)>
+        sort3(p[h - 1], p[h], p[h + 1], less);
+    3f36:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f3a:	|      48 83 c0 01          	add    $0x1,%rax
+    3f3e:	|      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3f45:	|      00 
+    3f46:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3f4a:	|      48 01 c2             	add    %rax,%rdx
+    3f4d:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f51:	|      48 8d 0c 85 00 00 00 	lea    0x0(,%rax,4),%rcx
+    3f58:	|      00 
+    3f59:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3f5d:	|      48 8d 34 01          	lea    (%rcx,%rax,1),%rsi
+    3f61:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f65:	|      48 c1 e0 02          	shl    $0x2,%rax
+    3f69:	|      48 8d 48 fc          	lea    -0x4(%rax),%rcx
+    3f6d:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3f71:	|      48 8d 3c 01          	lea    (%rcx,%rax,1),%rdi
+    3f75:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3f79:	|      48 89 c1             	mov    %rax,%rcx
+    3f7c:	|      e8 77 09 00 00       	call   48f8 <void nel::sort::sort3<int, nel::sort::Less>(int&, int&, int&, nel::sort::Less&)>
+        swap(p[0], p[h]);
+    3f81:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f85:	|      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3f8c:	|      00 
+    3f8d:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3f91:	|      48 01 c2             	add    %rax,%rdx
+    3f94:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3f98:	|      48 89 d6             	mov    %rdx,%rsi
+    3f9b:	|      48 89 c7             	mov    %rax,%rdi
+    3f9e:	|      e8 fa 09 00 00       	call   499d <void nel::swap<int>(int&, int&)>
+}
+    3fa3:	|  /-- eb 3e                	jmp    3fe3 <void nel::sort::choose_pivot<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x192>
+        sort3(p[h], p[0], p[n - 1], less);
+    3fa5:	\--|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3fa9:	   |   48 c1 e0 02          	shl    $0x2,%rax
+    3fad:	   |   48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    3fb1:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3fb5:	   |   48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+    3fb9:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3fbd:	   |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3fc4:	   |   00 
+    3fc5:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3fc9:	   |   48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+    3fcd:	   |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    3fd1:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3fd5:	   |   48 89 d1             	mov    %rdx,%rcx
+    3fd8:	   |   48 89 f2             	mov    %rsi,%rdx
+    3fdb:	   |   48 89 c6             	mov    %rax,%rsi
+    3fde:	   |   e8 15 09 00 00       	call   48f8 <void nel::sort::sort3<int, nel::sort::Less>(int&, int&, int&, nel::sort::Less&)>
+}
+    3fe3:	   \-> 90                   	nop
+    3fe4:	       c9                   	leave
+    3fe5:	       c3                   	ret
+
+0000000000003fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>:
+        constexpr bool operator()(T const &a, T const &b) const
+    3fe6:	55                   	push   %rbp
+    3fe7:	48 89 e5             	mov    %rsp,%rbp
+    3fea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3fee:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3ff2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            return a < b;
+    3ff6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3ffa:	8b 10                	mov    (%rax),%edx
+    3ffc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4000:	8b 00                	mov    (%rax),%eax
+    4002:	39 c2                	cmp    %eax,%edx
+    4004:	0f 9c c0             	setl   %al
+        }
+    4007:	5d                   	pop    %rbp
+    4008:	c3                   	ret
+
+0000000000004009 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>:
+Index partition_left(T p[], Length const n, F &less)
+    4009:	                55                   	push   %rbp
+    400a:	                48 89 e5             	mov    %rsp,%rbp
+    400d:	                48 83 ec 40          	sub    $0x40,%rsp
+    4011:	                48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    4015:	                48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    4019:	                48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    T pivot = move(p[0]);
+    401d:	                48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4021:	                48 89 c7             	mov    %rax,%rdi
+    4024:	                e8 75 07 00 00       	call   479e <int&& nel::move<int>(int&)>
+    4029:	                8b 00                	mov    (%rax),%eax
+    402b:	                89 45 ec             	mov    %eax,-0x14(%rbp)
+    Index first = 0;
+    402e:	                48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    4035:	                00 
+    Index last = n;
+    4036:	                48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    403a:	                48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        last -= 1;
+    403e:	            /-> 48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    } while (less(pivot, p[last]));
+    4043:	            |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4047:	            |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    404e:	            |   00 
+    404f:	            |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4053:	            |   48 01 c2             	add    %rax,%rdx
+    4056:	            |   48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+    405a:	            |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    405e:	            |   48 89 ce             	mov    %rcx,%rsi
+    4061:	            |   48 89 c7             	mov    %rax,%rdi
+    4064:	            |   e8 7d ff ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    4069:	            |   84 c0                	test   %al,%al
+    406b:	            \-- 75 d1                	jne    403e <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x35>
+    if (last + 1 == n) {
+    406d:	                48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4071:	                48 83 c0 01          	add    $0x1,%rax
+    4075:	                48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+    4079:	   /----------- 75 40                	jne    40bb <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0xb2>
+        while (first < last) {
+    407b:	   |        /-- eb 2f                	jmp    40ac <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0xa3>
+            first += 1;
+    407d:	   |     /--|-> 48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+            if (less(pivot, p[first])) { break; }
+    4082:	   |     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4086:	   |     |  |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    408d:	   |     |  |   00 
+    408e:	   |     |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4092:	   |     |  |   48 01 c2             	add    %rax,%rdx
+    4095:	   |     |  |   48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+    4099:	   |     |  |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    409d:	   |     |  |   48 89 ce             	mov    %rcx,%rsi
+    40a0:	   |     |  |   48 89 c7             	mov    %rax,%rdi
+    40a3:	   |     |  |   e8 3e ff ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    40a8:	   |     |  |   84 c0                	test   %al,%al
+    40aa:	   |  /--|--|-- 75 46                	jne    40f2 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0xe9>
+        while (first < last) {
+    40ac:	   |  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    40b0:	   |  |  |      48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    40b4:	   |  |  \----- 72 c7                	jb     407d <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x74>
+    40b6:	/--|--|-------- e9 cf 00 00 00       	jmp    418a <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x181>
+            first += 1;
+    40bb:	|  >--|-------> 48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+        } while (!less(pivot, p[first]));
+    40c0:	|  |  |         48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    40c4:	|  |  |         48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    40cb:	|  |  |         00 
+    40cc:	|  |  |         48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    40d0:	|  |  |         48 01 c2             	add    %rax,%rdx
+    40d3:	|  |  |         48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+    40d7:	|  |  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    40db:	|  |  |         48 89 ce             	mov    %rcx,%rsi
+    40de:	|  |  |         48 89 c7             	mov    %rax,%rdi
+    40e1:	|  |  |         e8 00 ff ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    40e6:	|  |  |         83 f0 01             	xor    $0x1,%eax
+    40e9:	|  |  |         84 c0                	test   %al,%al
+    40eb:	|  \--|-------- 75 ce                	jne    40bb <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0xb2>
+    40ed:	+-----|-------- e9 98 00 00 00       	jmp    418a <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x181>
+            if (less(pivot, p[first])) { break; }
+    40f2:	|     \-------> 90                   	nop
+    while (first < last) {
+    40f3:	+-------------- e9 92 00 00 00       	jmp    418a <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x181>
+        swap(p[first], p[last]);
+    40f8:	|        /----> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    40fc:	|        |      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    4103:	|        |      00 
+    4104:	|        |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4108:	|        |      48 01 c2             	add    %rax,%rdx
+    410b:	|        |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    410f:	|        |      48 8d 0c 85 00 00 00 	lea    0x0(,%rax,4),%rcx
+    4116:	|        |      00 
+    4117:	|        |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    411b:	|        |      48 01 c8             	add    %rcx,%rax
+    411e:	|        |      48 89 d6             	mov    %rdx,%rsi
+    4121:	|        |      48 89 c7             	mov    %rax,%rdi
+    4124:	|        |      e8 74 08 00 00       	call   499d <void nel::swap<int>(int&, int&)>
+            last -= 1;
+    4129:	|        |  /-> 48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        } while (less(pivot, p[last]));
+    412e:	|        |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4132:	|        |  |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    4139:	|        |  |   00 
+    413a:	|        |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    413e:	|        |  |   48 01 c2             	add    %rax,%rdx
+    4141:	|        |  |   48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+    4145:	|        |  |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    4149:	|        |  |   48 89 ce             	mov    %rcx,%rsi
+    414c:	|        |  |   48 89 c7             	mov    %rax,%rdi
+    414f:	|        |  |   e8 92 fe ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    4154:	|        |  |   84 c0                	test   %al,%al
+    4156:	|        |  \-- 75 d1                	jne    4129 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x120>
+            first += 1;
+    4158:	|        |  /-> 48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+        } while (!less(pivot, p[first]));
+    415d:	|        |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4161:	|        |  |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    4168:	|        |  |   00 
+    4169:	|        |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    416d:	|        |  |   48 01 c2             	add    %rax,%rdx
+    4170:	|        |  |   48 8d 4d ec          	lea    -0x14(%rbp),%rcx
+    4174:	|        |  |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    4178:	|        |  |   48 89 ce             	mov    %rcx,%rsi
+    417b:	|        |  |   48 89 c7             	mov    %rax,%rdi
+    417e:	|        |  |   e8 63 fe ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    4183:	|        |  |   83 f0 01             	xor    $0x1,%eax
+    4186:	|        |  |   84 c0                	test   %al,%al
+    4188:	|        |  \-- 75 ce                	jne    4158 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x14f>
+    while (first < last) {
+    418a:	\--------|----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    418e:	         |      48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    4192:	         \----- 0f 82 60 ff ff ff    	jb     40f8 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0xef>
+    p[0] = move(p[last]);
+    4198:	                48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    419c:	                48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    41a3:	                00 
+    41a4:	                48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    41a8:	                48 01 d0             	add    %rdx,%rax
+    41ab:	                48 89 c7             	mov    %rax,%rdi
+    41ae:	                e8 eb 05 00 00       	call   479e <int&& nel::move<int>(int&)>
+    41b3:	                8b 10                	mov    (%rax),%edx
+    41b5:	                48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    41b9:	                89 10                	mov    %edx,(%rax)
+    p[last] = move(pivot);
+    41bb:	                48 8d 45 ec          	lea    -0x14(%rbp),%rax
+    41bf:	                48 89 c7             	mov    %rax,%rdi
+    41c2:	                e8 d7 05 00 00       	call   479e <int&& nel::move<int>(int&)>
+    41c7:	                48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    41cb:	                48 8d 0c 95 00 00 00 	lea    0x0(,%rdx,4),%rcx
+    41d2:	                00 
+    41d3:	                48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    41d7:	                48 01 ca             	add    %rcx,%rdx
+    41da:	                8b 00                	mov    (%rax),%eax
+    41dc:	                89 02                	mov    %eax,(%rdx)
+    return last;
+    41de:	                48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+    41e2:	                c9                   	leave
+    41e3:	                c3                   	ret
+
+00000000000041e4 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&)>:
+Index partition_right(T p[], Length const n, F &less, bool &already)
+    41e4:	             55                   	push   %rbp
+    41e5:	             48 89 e5             	mov    %rsp,%rbp
+    41e8:	             48 83 ec 40          	sub    $0x40,%rsp
+    41ec:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    41f0:	             48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    41f4:	             48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    41f8:	             48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+    T pivot = move(p[0]);
+    41fc:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4200:	             48 89 c7             	mov    %rax,%rdi
+    4203:	             e8 96 05 00 00       	call   479e <int&& nel::move<int>(int&)>
+    4208:	             8b 00                	mov    (%rax),%eax
+    420a:	             89 45 e4             	mov    %eax,-0x1c(%rbp)
+    Index first = 0;
+    420d:	             48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    4214:	             00 
+    Index last = n;
+    4215:	             48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    4219:	             48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        first += 1;
+    421d:	         /-> 48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    } while (less(p[first], pivot));
+    4222:	         |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4226:	         |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    422d:	         |   00 
+    422e:	         |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4232:	         |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    4236:	         |   48 8d 55 e4          	lea    -0x1c(%rbp),%rdx
+    423a:	         |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    423e:	         |   48 89 ce             	mov    %rcx,%rsi
+    4241:	         |   48 89 c7             	mov    %rax,%rdi
+    4244:	         |   e8 9d fd ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    4249:	         |   84 c0                	test   %al,%al
+    424b:	         \-- 75 d0                	jne    421d <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&)+0x39>
+    if (first == 1) {
+    424d:	             48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+    4252:	/----------- 75 3e                	jne    4292 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&)+0xae>
+        while (first < last) {
+    4254:	|        /-- eb 30                	jmp    4286 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&)+0xa2>
+            last -= 1;
+    4256:	|     /--|-> 48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+            if (less(p[last], pivot)) { break; }
+    425b:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    425f:	|     |  |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    4266:	|     |  |   00 
+    4267:	|     |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    426b:	|     |  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    426f:	|     |  |   48 8d 55 e4          	lea    -0x1c(%rbp),%rdx
+    4273:	|     |  |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    4277:	|     |  |   48 89 ce             	mov    %rcx,%rsi
+    427a:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    427d:	|     |  |   e8 64 fd ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    4282:	|     |  |   84 c0                	test   %al,%al
+    4284:	|  /--|--|-- 75 41                	jne    42c7 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&)+0xe3>
+        while (first < last) {
+    4286:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    428a:	|  |  |      48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    428e:	|  |  \----- 72 c6                	jb     4256 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&)+0x72>
+    4290:	|  |     /-- eb 36                	jmp    42c8 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&)+0xe4>
+            last -= 1;
+    4292:	>--|-----|-> 48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        } while (!less(p[last], pivot));
+    4297:	|  |     |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    429b:	|  |     |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    42a2:	|  |     |   00 
+    42a3:	|  |     |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    42a7:	|  |     |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    42ab:	|  |     |   48 8d 55 e4          	lea    -0x1c(%rbp),%rdx
+    42af:	|  |     |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    42b3:	|  |     |   48 89 ce             	mov    %rcx,%rsi
+    42b6:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    42b9:	|  |     |   e8 28 fd ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    42be:	|  |     |   83 f0 01             	xor    $0x1,%eax
+    42c1:	|  |     |   84 c0                	test   %al,%al
+    42c3:	\--|-----|-- 75 cd                	jne    4292 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&)+0xae>
+    42c5:	   |     +-- eb 01                	jmp    42c8 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&)+0xe4>
+            if (less(p[last], pivot)) { break; }
+    42c7:	   \-----|-> 90                   	nop
+    already = first >= last;
+    42c8:	         \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    42cc:	             48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    42d0:	             0f 93 c2             	setae  %dl
+    42d3:	             48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    42d7:	             88 10                	mov    %dl,(%rax)
+    while (first < last) {
+    42d9:	      /----- e9 94 00 00 00       	jmp    4372 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&)+0x18e>
+        swap(p[first], p[last]);
+    42de:	   /--|----> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    42e2:	   |  |      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    42e9:	   |  |      00 
+    42ea:	   |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    42ee:	   |  |      48 01 c2             	add    %rax,%rdx
+    42f1:	   |  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    42f5:	   |  |      48 8d 0c 85 00 00 00 	lea    0x0(,%rax,4),%rcx
+    42fc:	   |  |      00 
+    42fd:	   |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4301:	   |  |      48 01 c8             	add    %rcx,%rax
+    4304:	   |  |      48 89 d6             	mov    %rdx,%rsi
+    4307:	   |  |      48 89 c7             	mov    %rax,%rdi
+    430a:	   |  |      e8 8e 06 00 00       	call   499d <void nel::swap<int>(int&, int&)>
+            first += 1;
+    430f:	   |  |  /-> 48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+        } while (less(p[first], pivot));
+    4314:	   |  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4318:	   |  |  |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    431f:	   |  |  |   00 
+    4320:	   |  |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4324:	   |  |  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    4328:	   |  |  |   48 8d 55 e4          	lea    -0x1c(%rbp),%rdx
+    432c:	   |  |  |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    4330:	   |  |  |   48 89 ce             	mov    %rcx,%rsi
+    4333:	   |  |  |   48 89 c7             	mov    %rax,%rdi
+    4336:	   |  |  |   e8 ab fc ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    433b:	   |  |  |   84 c0                	test   %al,%al
+    433d:	   |  |  \-- 75 d0                	jne    430f <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&)+0x12b>
+            last -= 1;
+    433f:	   |  |  /-> 48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        } while (!less(p[last], pivot));
+    4344:	   |  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4348:	   |  |  |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    434f:	   |  |  |   00 
+    4350:	   |  |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4354:	   |  |  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    4358:	   |  |  |   48 8d 55 e4          	lea    -0x1c(%rbp),%rdx
+    435c:	   |  |  |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    4360:	   |  |  |   48 89 ce             	mov    %rcx,%rsi
+    4363:	   |  |  |   48 89 c7             	mov    %rax,%rdi
+    4366:	   |  |  |   e8 7b fc ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    436b:	   |  |  |   83 f0 01             	xor    $0x1,%eax
+    436e:	   |  |  |   84 c0                	test   %al,%al
+    4370:	   |  |  \-- 75 cd                	jne    433f <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&)+0x15b>
+    while (first < last) {
+    4372:	   |  \----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4376:	   |         48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    437a:	   \-------- 0f 82 5e ff ff ff    	jb     42de <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&)+0xfa>
+    Index const pos = first - 1;
+    4380:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4384:	             48 83 e8 01          	sub    $0x1,%rax
+    4388:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    p[0] = move(p[pos]);
+    438c:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4390:	             48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    4397:	             00 
+    4398:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    439c:	             48 01 d0             	add    %rdx,%rax
+    439f:	             48 89 c7             	mov    %rax,%rdi
+    43a2:	             e8 f7 03 00 00       	call   479e <int&& nel::move<int>(int&)>
+    43a7:	             8b 10                	mov    (%rax),%edx
+    43a9:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    43ad:	             89 10                	mov    %edx,(%rax)
+    p[pos] = move(pivot);
+    43af:	             48 8d 45 e4          	lea    -0x1c(%rbp),%rax
+    43b3:	             48 89 c7             	mov    %rax,%rdi
+    43b6:	             e8 e3 03 00 00       	call   479e <int&& nel::move<int>(int&)>
+    43bb:	             48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    43bf:	             48 8d 0c 95 00 00 00 	lea    0x0(,%rdx,4),%rcx
+    43c6:	             00 
+    43c7:	             48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    43cb:	             48 01 ca             	add    %rcx,%rdx
+    43ce:	             8b 00                	mov    (%rax),%eax
+    43d0:	             89 02                	mov    %eax,(%rdx)
+    return pos;
+    43d2:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    43d6:	             c9                   	leave
+    43d7:	             c3                   	ret
+
+00000000000043d8 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>:
+void heap(T p[], Length const n, F &less)
+    43d8:	       55                   	push   %rbp
+    43d9:	       48 89 e5             	mov    %rsp,%rbp
+    43dc:	       48 83 ec 30          	sub    $0x30,%rsp
+    43e0:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    43e4:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    43e8:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    for (Index i = n / 2; i > 0; --i) {
+    43ec:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    43f0:	       48 d1 e8             	shr    %rax
+    43f3:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    43f7:	   /-- eb 21                	jmp    441a <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x42>
+        sift_down(p, i - 1, n, less);
+    43f9:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    43fd:	|  |   48 8d 70 ff          	lea    -0x1(%rax),%rsi
+    4401:	|  |   48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+    4405:	|  |   48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    4409:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    440d:	|  |   48 89 c7             	mov    %rax,%rdi
+    4410:	|  |   e8 d4 05 00 00       	call   49e9 <void nel::sort::sift_down<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)>
+    for (Index i = n / 2; i > 0; --i) {
+    4415:	|  |   48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    441a:	|  \-> 48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    441f:	\----- 75 d8                	jne    43f9 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x21>
+    for (Index e = n; e > 1; --e) {
+    4421:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4425:	       48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    4429:	   /-- eb 4a                	jmp    4475 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x9d>
+        swap(p[0], p[e - 1]);
+    442b:	/--|-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    442f:	|  |   48 c1 e0 02          	shl    $0x2,%rax
+    4433:	|  |   48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    4437:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    443b:	|  |   48 01 c2             	add    %rax,%rdx
+    443e:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4442:	|  |   48 89 d6             	mov    %rdx,%rsi
+    4445:	|  |   48 89 c7             	mov    %rax,%rdi
+    4448:	|  |   e8 50 05 00 00       	call   499d <void nel::swap<int>(int&, int&)>
+        sift_down(p, 0, e - 1, less);
+    444d:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4451:	|  |   48 8d 70 ff          	lea    -0x1(%rax),%rsi
+    4455:	|  |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    4459:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    445d:	|  |   48 89 d1             	mov    %rdx,%rcx
+    4460:	|  |   48 89 f2             	mov    %rsi,%rdx
+    4463:	|  |   be 00 00 00 00       	mov    $0x0,%esi
+    4468:	|  |   48 89 c7             	mov    %rax,%rdi
+    446b:	|  |   e8 79 05 00 00       	call   49e9 <void nel::sort::sift_down<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)>
+    for (Index e = n; e > 1; --e) {
+    4470:	|  |   48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    4475:	|  \-> 48 83 7d f0 01       	cmpq   $0x1,-0x10(%rbp)
+    447a:	\----- 77 af                	ja     442b <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x53>
+}
+    447c:	       90                   	nop
+    447d:	       90                   	nop
+    447e:	       c9                   	leave
+    447f:	       c3                   	ret
+
+0000000000004480 <nel::Element<void*>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    4480:	55                   	push   %rbp
+    4481:	48 89 e5             	mov    %rsp,%rbp
+    4484:	48 83 ec 10          	sub    $0x10,%rsp
+    4488:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    448c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4490:	48 89 c7             	mov    %rax,%rdi
+    4493:	e8 68 06 00 00       	call   4b00 <nel::Element<void*>::ref() const>
+        }
+    4498:	c9                   	leave
+    4499:	c3                   	ret
+
+000000000000449a <nel::Element<nel::heaped::AllocError>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    449a:	55                   	push   %rbp
+    449b:	48 89 e5             	mov    %rsp,%rbp
+    449e:	48 83 ec 10          	sub    $0x10,%rsp
+    44a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    44a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    44aa:	48 89 c7             	mov    %rax,%rdi
+    44ad:	e8 5c 06 00 00       	call   4b0e <nel::Element<nel::heaped::AllocError>::ref() const>
+        }
+    44b2:	c9                   	leave
+    44b3:	c3                   	ret
+
+00000000000044b4 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>:
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    44b4:	55                   	push   %rbp
+    44b5:	48 89 e5             	mov    %rsp,%rbp
+    44b8:	48 83 ec 10          	sub    $0x10,%rsp
+    44bc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    44c0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    44c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    44c8:	48 89 c7             	mov    %rax,%rdi
+    44cb:	e8 4c 06 00 00       	call   4b1c <void*&& nel::forward<void*, void*>(void*&)>
+    44d0:	48 8b 00             	mov    (%rax),%rax
+    44d3:	c9                   	leave
+    44d4:	c3                   	ret
+    44d5:	90                   	nop
+
+00000000000044d6 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>:
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    44d6:	55                   	push   %rbp
+    44d7:	48 89 e5             	mov    %rsp,%rbp
+    44da:	48 83 ec 10          	sub    $0x10,%rsp
+    44de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    44e2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    44e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    44ea:	48 8b 00             	mov    (%rax),%rax
+    44ed:	48 89 c6             	mov    %rax,%rsi
+    44f0:	48 8d 05 1b 1d 00 00 	lea    0x1d1b(%rip),%rax        # 6212 <n_values+0x1da>
+    44f7:	48 89 c7             	mov    %rax,%rdi
+    44fa:	e8 3e 0a 00 00       	call   4f3d <nel::panic(char const*, nel::Context const&)>
+    44ff:	90                   	nop
+
+0000000000004500 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>:
+        constexpr T unwrap(Context const &ctx = Context())
+    4500:	55                   	push   %rbp
+    4501:	48 89 e5             	mov    %rsp,%rbp
+    4504:	48 83 ec 20          	sub    $0x20,%rsp
+    4508:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    450c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    4510:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4514:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    4518:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    451c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    4520:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    4524:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4528:	48 89 c7             	mov    %rax,%rdi
+    452b:	e8 fa 05 00 00       	call   4b2a <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>
+        }
+    4530:	c9                   	leave
+    4531:	c3                   	ret
+
+0000000000004532 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>:
+
+    public:
+        // Smallest non-zero capacity grown to, saves the first few tiny reallocs.
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+    4532:	          55                   	push   %rbp
+    4533:	          48 89 e5             	mov    %rsp,%rbp
+    4536:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    453a:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            if (cap <= cur) { return cap; }
+    453e:	          48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4542:	          48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    4546:	      /-- 72 06                	jb     454e <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x1c>
+    4548:	      |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    454c:	/-----|-- eb 2e                	jmp    457c <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x4a>
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    454e:	|     \-> 48 83 7d e8 03       	cmpq   $0x3,-0x18(%rbp)
+    4553:	|  /----- 76 09                	jbe    455e <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x2c>
+    4555:	|  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4559:	|  |      48 01 c0             	add    %rax,%rax
+    455c:	|  |  /-- eb 05                	jmp    4563 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x31>
+    455e:	|  \--|-> b8 04 00 00 00       	mov    $0x4,%eax
+    4563:	|     \-> 48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return (cap < g) ? g : cap;
+    4567:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    456b:	|         48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    456f:	|  /----- 73 06                	jae    4577 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x45>
+    4571:	|  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4575:	|  |  /-- eb 04                	jmp    457b <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x49>
+    4577:	|  \--|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    457b:	|     \-> 90                   	nop
+        }
+    457c:	\-------> 5d                   	pop    %rbp
+    457d:	          c3                   	ret
+
+000000000000457e <nel::Element<int>::Element<int&>(int&)>:
+        constexpr Element(Args &&...args)
+    457e:	55                   	push   %rbp
+    457f:	48 89 e5             	mov    %rsp,%rbp
+    4582:	48 83 ec 10          	sub    $0x10,%rsp
+    4586:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    458a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Args>(args)...)
+    458e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4592:	48 89 c7             	mov    %rax,%rdi
+    4595:	e8 21 ef ff ff       	call   34bb <int& nel::forward<int&, int>(int&)>
+    459a:	8b 10                	mov    (%rax),%edx
+    459c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    45a0:	89 10                	mov    %edx,(%rax)
+        }
+    45a2:	90                   	nop
+    45a3:	c9                   	leave
+    45a4:	c3                   	ret
+    45a5:	90                   	nop
+
+00000000000045a6 <nel::Result<void, int>::Result(nel::Result<void, int>::Phantom<(nel::Result<void, int>::Tag)1>)>:
+        constexpr Result(Phantom<Tag::OK> const)
+    45a6:	55                   	push   %rbp
+    45a7:	48 89 e5             	mov    %rsp,%rbp
+    45aa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : tag_(Tag::OK)
+    45ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    45b2:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+        }
+    45b8:	90                   	nop
+    45b9:	5d                   	pop    %rbp
+    45ba:	c3                   	ret
+    45bb:	90                   	nop
+
+00000000000045bc <nel::Element<int>::ref()>:
+        constexpr Type &ref(void)
+    45bc:	55                   	push   %rbp
+    45bd:	48 89 e5             	mov    %rsp,%rbp
+    45c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    45c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    45c8:	5d                   	pop    %rbp
+    45c9:	c3                   	ret
+
+00000000000045ca <void nel::sort::break_patterns<int>(int*, unsigned long)>:
+void break_patterns(T p[], Length const n)
+    45ca:	    55                   	push   %rbp
+    45cb:	    48 89 e5             	mov    %rsp,%rbp
+    45ce:	    48 83 ec 10          	sub    $0x10,%rsp
+    45d2:	    48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    45d6:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    if (n >= small_n) {
+    45da:	    48 83 7d f0 13       	cmpq   $0x13,-0x10(%rbp)
+    45df:	/-- 76 59                	jbe    463a <void nel::sort::break_patterns<int>(int*, unsigned long)+0x70>
+        swap(p[0], p[n / 4]);
+    45e1:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    45e5:	|   48 83 e0 fc          	and    $0xfffffffffffffffc,%rax
+    45e9:	|   48 89 c2             	mov    %rax,%rdx
+    45ec:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    45f0:	|   48 01 c2             	add    %rax,%rdx
+    45f3:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    45f7:	|   48 89 d6             	mov    %rdx,%rsi
+    45fa:	|   48 89 c7             	mov    %rax,%rdi
+    45fd:	|   e8 9b 03 00 00       	call   499d <void nel::swap<int>(int&, int&)>
+        swap(p[n - 1], p[n - n / 4]);
+    4602:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4606:	|   48 c1 e8 02          	shr    $0x2,%rax
+    460a:	|   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    460e:	|   48 29 c2             	sub    %rax,%rdx
+    4611:	|   48 c1 e2 02          	shl    $0x2,%rdx
+    4615:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4619:	|   48 01 c2             	add    %rax,%rdx
+    461c:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4620:	|   48 c1 e0 02          	shl    $0x2,%rax
+    4624:	|   48 8d 48 fc          	lea    -0x4(%rax),%rcx
+    4628:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    462c:	|   48 01 c8             	add    %rcx,%rax
+    462f:	|   48 89 d6             	mov    %rdx,%rsi
+    4632:	|   48 89 c7             	mov    %rax,%rdi
+    4635:	|   e8 63 03 00 00       	call   499d <void nel::swap<int>(int&, int&)>
+}
+    463a:	\-> 90                   	nop
+    463b:	    c9                   	leave
+    463c:	    c3                   	ret
+
+000000000000463d <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)>:
+bool partial_insertion(T p[], Length const n, F &less)
+    463d:	                   55                   	push   %rbp
+    463e:	                   48 89 e5             	mov    %rsp,%rbp
+    4641:	                   48 83 ec 40          	sub    $0x40,%rsp
+    4645:	                   48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    4649:	                   48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    464d:	                   48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    Count moved = 0;
+    4651:	                   48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    4658:	                   00 
+    for (Index i = 1; i < n; ++i) {
+    4659:	                   48 c7 45 f0 01 00 00 	movq   $0x1,-0x10(%rbp)
+    4660:	                   00 
+    4661:	   /-------------- e9 23 01 00 00       	jmp    4789 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x14c>
+        if (!less(p[i], p[i - 1])) { continue; }
+    4666:	/--|-------------> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    466a:	|  |               48 c1 e0 02          	shl    $0x2,%rax
+    466e:	|  |               48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    4672:	|  |               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4676:	|  |               48 01 c2             	add    %rax,%rdx
+    4679:	|  |               48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    467d:	|  |               48 8d 0c 85 00 00 00 	lea    0x0(,%rax,4),%rcx
+    4684:	|  |               00 
+    4685:	|  |               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4689:	|  |               48 01 c1             	add    %rax,%rcx
+    468c:	|  |               48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    4690:	|  |               48 89 ce             	mov    %rcx,%rsi
+    4693:	|  |               48 89 c7             	mov    %rax,%rdi
+    4696:	|  |               e8 4b f9 ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    469b:	|  |               83 f0 01             	xor    $0x1,%eax
+    469e:	|  |               84 c0                	test   %al,%al
+    46a0:	|  |  /----------- 0f 85 dd 00 00 00    	jne    4783 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x146>
+        T t = move(p[i]);
+    46a6:	|  |  |            48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    46aa:	|  |  |            48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    46b1:	|  |  |            00 
+    46b2:	|  |  |            48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    46b6:	|  |  |            48 01 d0             	add    %rdx,%rax
+    46b9:	|  |  |            48 89 c7             	mov    %rax,%rdi
+    46bc:	|  |  |            e8 dd 00 00 00       	call   479e <int&& nel::move<int>(int&)>
+    46c1:	|  |  |            8b 00                	mov    (%rax),%eax
+    46c3:	|  |  |            89 45 e4             	mov    %eax,-0x1c(%rbp)
+        Index j = i;
+    46c6:	|  |  |            48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    46ca:	|  |  |            48 89 45 e8          	mov    %rax,-0x18(%rbp)
+            p[j] = move(p[j - 1]);
+    46ce:	|  |  |  /-------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    46d2:	|  |  |  |         48 c1 e0 02          	shl    $0x2,%rax
+    46d6:	|  |  |  |         48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    46da:	|  |  |  |         48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    46de:	|  |  |  |         48 01 d0             	add    %rdx,%rax
+    46e1:	|  |  |  |         48 89 c7             	mov    %rax,%rdi
+    46e4:	|  |  |  |         e8 b5 00 00 00       	call   479e <int&& nel::move<int>(int&)>
+    46e9:	|  |  |  |         48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    46ed:	|  |  |  |         48 8d 0c 95 00 00 00 	lea    0x0(,%rdx,4),%rcx
+    46f4:	|  |  |  |         00 
+    46f5:	|  |  |  |         48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    46f9:	|  |  |  |         48 01 ca             	add    %rcx,%rdx
+    46fc:	|  |  |  |         8b 00                	mov    (%rax),%eax
+    46fe:	|  |  |  |         89 02                	mov    %eax,(%rdx)
+            j -= 1;
+    4700:	|  |  |  |         48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+        } while (j > 0 && less(t, p[j - 1]));
+    4705:	|  |  |  |         48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    470a:	|  |  |  |  /----- 74 31                	je     473d <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x100>
+    470c:	|  |  |  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4710:	|  |  |  |  |      48 c1 e0 02          	shl    $0x2,%rax
+    4714:	|  |  |  |  |      48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    4718:	|  |  |  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    471c:	|  |  |  |  |      48 01 c2             	add    %rax,%rdx
+    471f:	|  |  |  |  |      48 8d 4d e4          	lea    -0x1c(%rbp),%rcx
+    4723:	|  |  |  |  |      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    4727:	|  |  |  |  |      48 89 ce             	mov    %rcx,%rsi
+    472a:	|  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    472d:	|  |  |  |  |      e8 b4 f8 ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    4732:	|  |  |  |  |      84 c0                	test   %al,%al
+    4734:	|  |  |  |  +----- 74 07                	je     473d <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x100>
+    4736:	|  |  |  |  |      b8 01 00 00 00       	mov    $0x1,%eax
+    473b:	|  |  |  |  |  /-- eb 05                	jmp    4742 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x105>
+    473d:	|  |  |  |  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    4742:	|  |  |  |     \-> 84 c0                	test   %al,%al
+    4744:	|  |  |  \-------- 75 88                	jne    46ce <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x91>
+        p[j] = move(t);
+    4746:	|  |  |            48 8d 45 e4          	lea    -0x1c(%rbp),%rax
+    474a:	|  |  |            48 89 c7             	mov    %rax,%rdi
+    474d:	|  |  |            e8 4c 00 00 00       	call   479e <int&& nel::move<int>(int&)>
+    4752:	|  |  |            48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    4756:	|  |  |            48 8d 0c 95 00 00 00 	lea    0x0(,%rdx,4),%rcx
+    475d:	|  |  |            00 
+    475e:	|  |  |            48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    4762:	|  |  |            48 01 ca             	add    %rcx,%rdx
+    4765:	|  |  |            8b 00                	mov    (%rax),%eax
+    4767:	|  |  |            89 02                	mov    %eax,(%rdx)
+        moved += i - j;
+    4769:	|  |  |            48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    476d:	|  |  |            48 2b 45 e8          	sub    -0x18(%rbp),%rax
+    4771:	|  |  |            48 01 45 f8          	add    %rax,-0x8(%rbp)
+        if (moved > 8) { return false; }
+    4775:	|  |  |            48 83 7d f8 08       	cmpq   $0x8,-0x8(%rbp)
+    477a:	|  |  |        /-- 76 08                	jbe    4784 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x147>
+    477c:	|  |  |        |   b8 00 00 00 00       	mov    $0x0,%eax
+    4781:	|  |  |     /--|-- eb 19                	jmp    479c <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x15f>
+        if (!less(p[i], p[i - 1])) { continue; }
+    4783:	|  |  \-----|--|-> 90                   	nop
+    for (Index i = 1; i < n; ++i) {
+    4784:	|  |        |  \-> 48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    4789:	|  \--------|----> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    478d:	|           |      48 3b 45 d0          	cmp    -0x30(%rbp),%rax
+    4791:	\-----------|----- 0f 82 cf fe ff ff    	jb     4666 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&)+0x29>
+    return true;
+    4797:	            |      b8 01 00 00 00       	mov    $0x1,%eax
+}
+    479c:	            \----> c9                   	leave
+    479d:	                   c3                   	ret
+
+000000000000479e <int&& nel::move<int>(int&)>:
+constexpr T &&move(T &v)
+    479e:	55                   	push   %rbp
+    479f:	48 89 e5             	mov    %rsp,%rbp
+    47a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    47a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    47aa:	5d                   	pop    %rbp
+    47ab:	c3                   	ret
+
+00000000000047ac <nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}::operator()(int const&) const>:
+ * @returns n if all are less.
+ */
+template<typename T, typename F>
+Index lower_bound(T const p[], Length const n, T const &key, F &less)
+{
+    auto pred = [&key, &less](T const &v) -> bool { return less(v, key); };
+    47ac:	55                   	push   %rbp
+    47ad:	48 89 e5             	mov    %rsp,%rbp
+    47b0:	48 83 ec 10          	sub    $0x10,%rsp
+    47b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    47b8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    47bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    47c0:	48 8b 40 08          	mov    0x8(%rax),%rax
+    47c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    47c8:	48 8b 12             	mov    (%rdx),%rdx
+    47cb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    47cf:	48 89 ce             	mov    %rcx,%rsi
+    47d2:	48 89 c7             	mov    %rax,%rdi
+    47d5:	e8 0c f8 ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    47da:	c9                   	leave
+    47db:	c3                   	ret
+
+00000000000047dc <unsigned long nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)>:
+Index lower_bound(T const p[], Length const n, T const &key, F &less)
+    47dc:	55                   	push   %rbp
+    47dd:	48 89 e5             	mov    %rsp,%rbp
+    47e0:	48 83 ec 30          	sub    $0x30,%rsp
+    47e4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    47e8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    47ec:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    47f0:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    auto pred = [&key, &less](T const &v) -> bool { return less(v, key); };
+    47f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    47f8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    47fc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    4800:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return partition_point(p, n, pred);
+    4804:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    4808:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    480c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4810:	48 89 ce             	mov    %rcx,%rsi
+    4813:	48 89 c7             	mov    %rax,%rdi
+    4816:	e8 d8 03 00 00       	call   4bf3 <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)>
+}
+    481b:	c9                   	leave
+    481c:	c3                   	ret
+    481d:	90                   	nop
+
+000000000000481e <nel::search::upper_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}::operator()(int const&) const>:
+ * @returns n if none are greater.
+ */
+template<typename T, typename F>
+Index upper_bound(T const p[], Length const n, T const &key, F &less)
+{
+    auto pred = [&key, &less](T const &v) -> bool { return !less(key, v); };
+    481e:	55                   	push   %rbp
+    481f:	48 89 e5             	mov    %rsp,%rbp
+    4822:	48 83 ec 10          	sub    $0x10,%rsp
+    4826:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    482a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    482e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4832:	48 8b 40 08          	mov    0x8(%rax),%rax
+    4836:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    483a:	48 8b 0a             	mov    (%rdx),%rcx
+    483d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    4841:	48 89 ce             	mov    %rcx,%rsi
+    4844:	48 89 c7             	mov    %rax,%rdi
+    4847:	e8 9a f7 ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    484c:	83 f0 01             	xor    $0x1,%eax
+    484f:	c9                   	leave
+    4850:	c3                   	ret
+
+0000000000004851 <unsigned long nel::search::upper_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)>:
+Index upper_bound(T const p[], Length const n, T const &key, F &less)
+    4851:	55                   	push   %rbp
+    4852:	48 89 e5             	mov    %rsp,%rbp
+    4855:	48 83 ec 30          	sub    $0x30,%rsp
+    4859:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    485d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    4861:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    4865:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    auto pred = [&key, &less](T const &v) -> bool { return !less(key, v); };
+    4869:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    486d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    4871:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    4875:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return partition_point(p, n, pred);
+    4879:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    487d:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    4881:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4885:	48 89 ce             	mov    %rcx,%rsi
+    4888:	48 89 c7             	mov    %rax,%rdi
+    488b:	e8 7e 04 00 00       	call   4d0e <unsigned long nel::search::partition_point<int, nel::search::upper_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)>
+}
+    4890:	c9                   	leave
+    4891:	c3                   	ret
+
+0000000000004892 <void nel::sort::rotate<int>(int*, unsigned long, unsigned long)>:
+void rotate(T p[], Length const l, Length const r)
+    4892:	55                   	push   %rbp
+    4893:	48 89 e5             	mov    %rsp,%rbp
+    4896:	48 83 ec 20          	sub    $0x20,%rsp
+    489a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    489e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    48a2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    reverse(p, l);
+    48a6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    48aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    48ae:	48 89 d6             	mov    %rdx,%rsi
+    48b1:	48 89 c7             	mov    %rax,%rdi
+    48b4:	e8 70 05 00 00       	call   4e29 <void nel::sort::reverse<int>(int*, unsigned long)>
+    reverse(p + l, r);
+    48b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    48bd:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    48c4:	00 
+    48c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    48c9:	48 01 c2             	add    %rax,%rdx
+    48cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    48d0:	48 89 c6             	mov    %rax,%rsi
+    48d3:	48 89 d7             	mov    %rdx,%rdi
+    48d6:	e8 4e 05 00 00       	call   4e29 <void nel::sort::reverse<int>(int*, unsigned long)>
+    reverse(p, l + r);
+    48db:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    48df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    48e3:	48 01 c2             	add    %rax,%rdx
+    48e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    48ea:	48 89 d6             	mov    %rdx,%rsi
+    48ed:	48 89 c7             	mov    %rax,%rdi
+    48f0:	e8 34 05 00 00       	call   4e29 <void nel::sort::reverse<int>(int*, unsigned long)>
+}
+    48f5:	90                   	nop
+    48f6:	c9                   	leave
+    48f7:	c3                   	ret
+
+00000000000048f8 <void nel::sort::sort3<int, nel::sort::Less>(int&, int&, int&, nel::sort::Less&)>:
+void sort3(T &a, T &b, T &c, F &less)
+    48f8:	    55                   	push   %rbp
+    48f9:	    48 89 e5             	mov    %rsp,%rbp
+    48fc:	    48 83 ec 20          	sub    $0x20,%rsp
+    4900:	    48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4904:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    4908:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    490c:	    48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+    if (less(b, a)) { swap(a, b); }
+    4910:	    48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    4914:	    48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    4918:	    48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    491c:	    48 89 ce             	mov    %rcx,%rsi
+    491f:	    48 89 c7             	mov    %rax,%rdi
+    4922:	    e8 bf f6 ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    4927:	    84 c0                	test   %al,%al
+    4929:	/-- 74 13                	je     493e <void nel::sort::sort3<int, nel::sort::Less>(int&, int&, int&, nel::sort::Less&)+0x46>
+    492b:	|   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    492f:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4933:	|   48 89 d6             	mov    %rdx,%rsi
+    4936:	|   48 89 c7             	mov    %rax,%rdi
+    4939:	|   e8 5f 00 00 00       	call   499d <void nel::swap<int>(int&, int&)>
+    if (less(c, b)) {
+    493e:	\-> 48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    4942:	    48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    4946:	    48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    494a:	    48 89 ce             	mov    %rcx,%rsi
+    494d:	    48 89 c7             	mov    %rax,%rdi
+    4950:	    e8 91 f6 ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    4955:	    84 c0                	test   %al,%al
+    4957:	/-- 74 41                	je     499a <void nel::sort::sort3<int, nel::sort::Less>(int&, int&, int&, nel::sort::Less&)+0xa2>
+        swap(b, c);
+    4959:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    495d:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4961:	|   48 89 d6             	mov    %rdx,%rsi
+    4964:	|   48 89 c7             	mov    %rax,%rdi
+    4967:	|   e8 31 00 00 00       	call   499d <void nel::swap<int>(int&, int&)>
+        if (less(b, a)) { swap(a, b); }
+    496c:	|   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    4970:	|   48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    4974:	|   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4978:	|   48 89 ce             	mov    %rcx,%rsi
+    497b:	|   48 89 c7             	mov    %rax,%rdi
+    497e:	|   e8 63 f6 ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    4983:	|   84 c0                	test   %al,%al
+    4985:	+-- 74 13                	je     499a <void nel::sort::sort3<int, nel::sort::Less>(int&, int&, int&, nel::sort::Less&)+0xa2>
+    4987:	|   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    498b:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    498f:	|   48 89 d6             	mov    %rdx,%rsi
+    4992:	|   48 89 c7             	mov    %rax,%rdi
+    4995:	|   e8 03 00 00 00       	call   499d <void nel::swap<int>(int&, int&)>
+}
+    499a:	\-> 90                   	nop
+    499b:	    c9                   	leave
+    499c:	    c3                   	ret
+
+000000000000499d <void nel::swap<int>(int&, int&)>:
+ * @param b second value
+ *
+ * Uses T's move-ctor and move-assign, so works for move-only types.
+ */
+template<typename T>
+constexpr void swap(T &a, T &b)
+    499d:	55                   	push   %rbp
+    499e:	48 89 e5             	mov    %rsp,%rbp
+    49a1:	48 83 ec 20          	sub    $0x20,%rsp
+    49a5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    49a9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+{
+    T t = move(a);
+    49ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    49b1:	48 89 c7             	mov    %rax,%rdi
+    49b4:	e8 e5 fd ff ff       	call   479e <int&& nel::move<int>(int&)>
+    49b9:	8b 00                	mov    (%rax),%eax
+    49bb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    a = move(b);
+    49be:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    49c2:	48 89 c7             	mov    %rax,%rdi
+    49c5:	e8 d4 fd ff ff       	call   479e <int&& nel::move<int>(int&)>
+    49ca:	8b 10                	mov    (%rax),%edx
+    49cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    49d0:	89 10                	mov    %edx,(%rax)
+    b = move(t);
+    49d2:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+    49d6:	48 89 c7             	mov    %rax,%rdi
+    49d9:	e8 c0 fd ff ff       	call   479e <int&& nel::move<int>(int&)>
+    49de:	8b 10                	mov    (%rax),%edx
+    49e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    49e4:	89 10                	mov    %edx,(%rax)
+}
+    49e6:	90                   	nop
+    49e7:	c9                   	leave
+    49e8:	c3                   	ret
+
+00000000000049e9 <void nel::sort::sift_down<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)>:
+void sift_down(T p[], Index i, Length const n, F &less)
+    49e9:	             55                   	push   %rbp
+    49ea:	             48 89 e5             	mov    %rsp,%rbp
+    49ed:	             48 83 ec 30          	sub    $0x30,%rsp
+    49f1:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    49f5:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    49f9:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    49fd:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+        Index c = 2 * i + 1;
+    4a01:	/----------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4a05:	|            48 01 c0             	add    %rax,%rax
+    4a08:	|            48 83 c0 01          	add    $0x1,%rax
+    4a0c:	|            48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        if (c >= n) { break; }
+    4a10:	|            48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4a14:	|            48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    4a18:	|  /-------- 0f 83 da 00 00 00    	jae    4af8 <void nel::sort::sift_down<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x10f>
+        if (c + 1 < n && less(p[c], p[c + 1])) { c += 1; }
+    4a1e:	|  |         48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4a22:	|  |         48 83 c0 01          	add    $0x1,%rax
+    4a26:	|  |         48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    4a2a:	|  |  /----- 73 44                	jae    4a70 <void nel::sort::sift_down<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x87>
+    4a2c:	|  |  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4a30:	|  |  |      48 83 c0 01          	add    $0x1,%rax
+    4a34:	|  |  |      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    4a3b:	|  |  |      00 
+    4a3c:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4a40:	|  |  |      48 01 c2             	add    %rax,%rdx
+    4a43:	|  |  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4a47:	|  |  |      48 8d 0c 85 00 00 00 	lea    0x0(,%rax,4),%rcx
+    4a4e:	|  |  |      00 
+    4a4f:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4a53:	|  |  |      48 01 c1             	add    %rax,%rcx
+    4a56:	|  |  |      48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    4a5a:	|  |  |      48 89 ce             	mov    %rcx,%rsi
+    4a5d:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    4a60:	|  |  |      e8 81 f5 ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    4a65:	|  |  |      84 c0                	test   %al,%al
+    4a67:	|  |  +----- 74 07                	je     4a70 <void nel::sort::sift_down<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x87>
+    4a69:	|  |  |      b8 01 00 00 00       	mov    $0x1,%eax
+    4a6e:	|  |  |  /-- eb 05                	jmp    4a75 <void nel::sort::sift_down<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x8c>
+    4a70:	|  |  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    4a75:	|  |     \-> 84 c0                	test   %al,%al
+    4a77:	|  |     /-- 74 05                	je     4a7e <void nel::sort::sift_down<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x95>
+    4a79:	|  |     |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+        if (!less(p[i], p[c])) { break; }
+    4a7e:	|  |     \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4a82:	|  |         48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    4a89:	|  |         00 
+    4a8a:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4a8e:	|  |         48 01 c2             	add    %rax,%rdx
+    4a91:	|  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4a95:	|  |         48 8d 0c 85 00 00 00 	lea    0x0(,%rax,4),%rcx
+    4a9c:	|  |         00 
+    4a9d:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4aa1:	|  |         48 01 c1             	add    %rax,%rcx
+    4aa4:	|  |         48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    4aa8:	|  |         48 89 ce             	mov    %rcx,%rsi
+    4aab:	|  |         48 89 c7             	mov    %rax,%rdi
+    4aae:	|  |         e8 33 f5 ff ff       	call   3fe6 <bool nel::sort::Less::operator()<int>(int const&, int const&) const>
+    4ab3:	|  |         83 f0 01             	xor    $0x1,%eax
+    4ab6:	|  |         84 c0                	test   %al,%al
+    4ab8:	|  |  /----- 75 41                	jne    4afb <void nel::sort::sift_down<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x112>
+        swap(p[i], p[c]);
+    4aba:	|  |  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4abe:	|  |  |      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    4ac5:	|  |  |      00 
+    4ac6:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4aca:	|  |  |      48 01 c2             	add    %rax,%rdx
+    4acd:	|  |  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4ad1:	|  |  |      48 8d 0c 85 00 00 00 	lea    0x0(,%rax,4),%rcx
+    4ad8:	|  |  |      00 
+    4ad9:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4add:	|  |  |      48 01 c8             	add    %rcx,%rax
+    4ae0:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    4ae3:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    4ae6:	|  |  |      e8 b2 fe ff ff       	call   499d <void nel::swap<int>(int&, int&)>
+        i = c;
+    4aeb:	|  |  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4aef:	|  |  |      48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    while (true) {
+    4af3:	\--|--|----- e9 09 ff ff ff       	jmp    4a01 <void nel::sort::sift_down<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x18>
+        if (c >= n) { break; }
+    4af8:	   \--|----> 90                   	nop
+    4af9:	      |  /-- eb 01                	jmp    4afc <void nel::sort::sift_down<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&)+0x113>
+        if (!less(p[i], p[c])) { break; }
+    4afb:	      \--|-> 90                   	nop
+}
+    4afc:	         \-> 90                   	nop
+    4afd:	             c9                   	leave
+    4afe:	             c3                   	ret
+    4aff:	             90                   	nop
+
+0000000000004b00 <nel::Element<void*>::ref() const>:
+        constexpr Type const &ref(void) const
+    4b00:	55                   	push   %rbp
+    4b01:	48 89 e5             	mov    %rsp,%rbp
+    4b04:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    4b08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    4b0c:	5d                   	pop    %rbp
+    4b0d:	c3                   	ret
+
+0000000000004b0e <nel::Element<nel::heaped::AllocError>::ref() const>:
+        constexpr Type const &ref(void) const
+    4b0e:	55                   	push   %rbp
+    4b0f:	48 89 e5             	mov    %rsp,%rbp
+    4b12:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    4b16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    4b1a:	5d                   	pop    %rbp
+    4b1b:	c3                   	ret
+
+0000000000004b1c <void*&& nel::forward<void*, void*>(void*&)>:
+constexpr U &&forward(T &t)
+    4b1c:	55                   	push   %rbp
+    4b1d:	48 89 e5             	mov    %rsp,%rbp
+    4b20:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    4b24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    4b28:	5d                   	pop    %rbp
+    4b29:	c3                   	ret
+
+0000000000004b2a <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    4b2a:	             55                   	push   %rbp
+    4b2b:	             48 89 e5             	mov    %rsp,%rbp
+    4b2e:	             48 83 ec 30          	sub    $0x30,%rsp
+    4b32:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    4b36:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    4b3a:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    4b3e:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    4b42:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4b46:	             8b 00                	mov    (%rax),%eax
+    4b48:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    4b4b:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4b4f:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    4b55:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    4b59:	         /-- 74 3e                	je     4b99 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x6f>
+    4b5b:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    4b5f:	/--------|-- 7f 7a                	jg     4bdb <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+    4b61:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    4b65:	|  /-----|-- 74 5e                	je     4bc5 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x9b>
+    4b67:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    4b6b:	+--|-----|-- 75 6e                	jne    4bdb <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+                    return on_ok(forward<T>(*ok_));
+    4b6d:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4b71:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    4b75:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    4b78:	|  |     |   e8 1b 03 00 00       	call   4e98 <nel::Element<void*>::operator*()>
+    4b7d:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    4b80:	|  |     |   e8 97 ff ff ff       	call   4b1c <void*&& nel::forward<void*, void*>(void*&)>
+    4b85:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    4b88:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4b8c:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    4b8f:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    4b92:	|  |     |   e8 1d f9 ff ff       	call   44b4 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>
+    4b97:	|  |  /--|-- eb 58                	jmp    4bf1 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    return on_err(forward<E>(*err_));
+    4b99:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4b9d:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    4ba1:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    4ba4:	|  |  |      e8 09 03 00 00       	call   4eb2 <nel::Element<nel::heaped::AllocError>::operator*()>
+    4ba9:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    4bac:	|  |  |      e8 8e dd ff ff       	call   293f <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    4bb1:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    4bb4:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4bb8:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    4bbb:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    4bbe:	|  |  |      e8 13 f9 ff ff       	call   44d6 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>
+    4bc3:	|  |  +----- eb 2c                	jmp    4bf1 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    nel::panic("invalid Result", ctx);
+    4bc5:	|  \--|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    4bc9:	|     |      48 89 c6             	mov    %rax,%rsi
+    4bcc:	|     |      48 8d 05 11 16 00 00 	lea    0x1611(%rip),%rax        # 61e4 <n_values+0x1ac>
+    4bd3:	|     |      48 89 c7             	mov    %rax,%rdi
+    4bd6:	|     |      e8 62 03 00 00       	call   4f3d <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    4bdb:	\-----|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    4bdf:	      |      48 89 c6             	mov    %rax,%rsi
+    4be2:	      |      48 8d 05 6d 15 00 00 	lea    0x156d(%rip),%rax        # 6156 <n_values+0x11e>
+    4be9:	      |      48 89 c7             	mov    %rax,%rdi
+    4bec:	      |      e8 4c 03 00 00       	call   4f3d <nel::panic(char const*, nel::Context const&)>
+        }
+    4bf1:	      \----> c9                   	leave
+    4bf2:	             c3                   	ret
+
+0000000000004bf3 <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)>:
+Index partition_point(T const p[], Length n, F &pred)
+    4bf3:	                55                   	push   %rbp
+    4bf4:	                48 89 e5             	mov    %rsp,%rbp
+    4bf7:	                53                   	push   %rbx
+    4bf8:	                48 83 ec 38          	sub    $0x38,%rsp
+    4bfc:	                48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    4c00:	                48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    4c04:	                48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    if (n == 0) { return 0; }
+    4c08:	                48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    4c0d:	            /-- 75 0a                	jne    4c19 <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0x26>
+    4c0f:	            |   b8 00 00 00 00       	mov    $0x0,%eax
+    4c14:	/-----------|-- e9 ef 00 00 00       	jmp    4d08 <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0x115>
+    T const *b = p;
+    4c19:	|           \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4c1d:	|               48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (n > 1) {
+    4c21:	|     /-------- e9 a2 00 00 00       	jmp    4cc8 <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0xd5>
+        Length const h = n / 2;
+    4c26:	|  /--|-------> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    4c2a:	|  |  |         48 d1 e8             	shr    %rax
+    4c2d:	|  |  |         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        if (h * sizeof(T) > prefetch_bytes) {
+    4c31:	|  |  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4c35:	|  |  |         48 c1 e0 02          	shl    $0x2,%rax
+    4c39:	|  |  |         48 3d 00 01 00 00    	cmp    $0x100,%rax
+    4c3f:	|  |  |     /-- 76 3c                	jbe    4c7d <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0x8a>
+                reinterpret_cast<void const *>(uintptr_t(b) + (h / 2) * sizeof(T)));
+    4c41:	|  |  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4c45:	|  |  |     |   48 d1 e8             	shr    %rax
+    4c48:	|  |  |     |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    4c4f:	|  |  |     |   00 
+    4c50:	|  |  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4c54:	|  |  |     |   48 01 d0             	add    %rdx,%rax
+            __builtin_prefetch(
+    4c57:	|  |  |     |   0f 18 08             	prefetcht0 (%rax)
+                reinterpret_cast<void const *>(uintptr_t(b) + (h + h / 2) * sizeof(T)));
+    4c5a:	|  |  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4c5e:	|  |  |     |   48 d1 e8             	shr    %rax
+    4c61:	|  |  |     |   48 89 c2             	mov    %rax,%rdx
+    4c64:	|  |  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4c68:	|  |  |     |   48 01 d0             	add    %rdx,%rax
+    4c6b:	|  |  |     |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    4c72:	|  |  |     |   00 
+    4c73:	|  |  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4c77:	|  |  |     |   48 01 d0             	add    %rdx,%rax
+            __builtin_prefetch(
+    4c7a:	|  |  |     |   0f 18 08             	prefetcht0 (%rax)
+        b = pred(b[h]) ? b + h : b;
+    4c7d:	|  |  |     \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4c81:	|  |  |         48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    4c88:	|  |  |         00 
+    4c89:	|  |  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4c8d:	|  |  |         48 01 c2             	add    %rax,%rdx
+    4c90:	|  |  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    4c94:	|  |  |         48 89 d6             	mov    %rdx,%rsi
+    4c97:	|  |  |         48 89 c7             	mov    %rax,%rdi
+    4c9a:	|  |  |         e8 0d fb ff ff       	call   47ac <nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}::operator()(int const&) const>
+    4c9f:	|  |  |         84 c0                	test   %al,%al
+    4ca1:	|  |  |  /----- 74 15                	je     4cb8 <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0xc5>
+    4ca3:	|  |  |  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4ca7:	|  |  |  |      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    4cae:	|  |  |  |      00 
+    4caf:	|  |  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4cb3:	|  |  |  |      48 01 d0             	add    %rdx,%rax
+    4cb6:	|  |  |  |  /-- eb 04                	jmp    4cbc <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0xc9>
+    4cb8:	|  |  |  \--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4cbc:	|  |  |     \-> 48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        n -= h;
+    4cc0:	|  |  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4cc4:	|  |  |         48 29 45 d0          	sub    %rax,-0x30(%rbp)
+    while (n > 1) {
+    4cc8:	|  |  \-------> 48 83 7d d0 01       	cmpq   $0x1,-0x30(%rbp)
+    4ccd:	|  \----------- 0f 87 53 ff ff ff    	ja     4c26 <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0x33>
+    return Index(b - p) + (pred(*b) ? 1 : 0);
+    4cd3:	|               48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4cd7:	|               48 2b 45 d8          	sub    -0x28(%rbp),%rax
+    4cdb:	|               48 c1 f8 02          	sar    $0x2,%rax
+    4cdf:	|               48 89 c3             	mov    %rax,%rbx
+    4ce2:	|               48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    4ce6:	|               48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    4cea:	|               48 89 d6             	mov    %rdx,%rsi
+    4ced:	|               48 89 c7             	mov    %rax,%rdi
+    4cf0:	|               e8 b7 fa ff ff       	call   47ac <nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}::operator()(int const&) const>
+    4cf5:	|               84 c0                	test   %al,%al
+    4cf7:	|        /----- 74 07                	je     4d00 <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0x10d>
+    4cf9:	|        |      b8 01 00 00 00       	mov    $0x1,%eax
+    4cfe:	|        |  /-- eb 05                	jmp    4d05 <unsigned long nel::search::partition_point<int, nel::search::lower_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0x112>
+    4d00:	|        \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    4d05:	|           \-> 48 01 d8             	add    %rbx,%rax
+}
+    4d08:	\-------------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    4d0c:	                c9                   	leave
+    4d0d:	                c3                   	ret
+
+0000000000004d0e <unsigned long nel::search::partition_point<int, nel::search::upper_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)>:
+Index partition_point(T const p[], Length n, F &pred)
+    4d0e:	                55                   	push   %rbp
+    4d0f:	                48 89 e5             	mov    %rsp,%rbp
+    4d12:	                53                   	push   %rbx
+    4d13:	                48 83 ec 38          	sub    $0x38,%rsp
+    4d17:	                48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    4d1b:	                48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    4d1f:	                48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    if (n == 0) { return 0; }
+    4d23:	                48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    4d28:	            /-- 75 0a                	jne    4d34 <unsigned long nel::search::partition_point<int, nel::search::upper_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0x26>
+    4d2a:	            |   b8 00 00 00 00       	mov    $0x0,%eax
+    4d2f:	/-----------|-- e9 ef 00 00 00       	jmp    4e23 <unsigned long nel::search::partition_point<int, nel::search::upper_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0x115>
+    T const *b = p;
+    4d34:	|           \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    4d38:	|               48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    while (n > 1) {
+    4d3c:	|     /-------- e9 a2 00 00 00       	jmp    4de3 <unsigned long nel::search::partition_point<int, nel::search::upper_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0xd5>
+        Length const h = n / 2;
+    4d41:	|  /--|-------> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    4d45:	|  |  |         48 d1 e8             	shr    %rax
+    4d48:	|  |  |         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        if (h * sizeof(T) > prefetch_bytes) {
+    4d4c:	|  |  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4d50:	|  |  |         48 c1 e0 02          	shl    $0x2,%rax
+    4d54:	|  |  |         48 3d 00 01 00 00    	cmp    $0x100,%rax
+    4d5a:	|  |  |     /-- 76 3c                	jbe    4d98 <unsigned long nel::search::partition_point<int, nel::search::upper_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0x8a>
+                reinterpret_cast<void const *>(uintptr_t(b) + (h / 2) * sizeof(T)));
+    4d5c:	|  |  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4d60:	|  |  |     |   48 d1 e8             	shr    %rax
+    4d63:	|  |  |     |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    4d6a:	|  |  |     |   00 
+    4d6b:	|  |  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4d6f:	|  |  |     |   48 01 d0             	add    %rdx,%rax
+            __builtin_prefetch(
+    4d72:	|  |  |     |   0f 18 08             	prefetcht0 (%rax)
+                reinterpret_cast<void const *>(uintptr_t(b) + (h + h / 2) * sizeof(T)));
+    4d75:	|  |  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4d79:	|  |  |     |   48 d1 e8             	shr    %rax
+    4d7c:	|  |  |     |   48 89 c2             	mov    %rax,%rdx
+    4d7f:	|  |  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4d83:	|  |  |     |   48 01 d0             	add    %rdx,%rax
+    4d86:	|  |  |     |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    4d8d:	|  |  |     |   00 
+    4d8e:	|  |  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4d92:	|  |  |     |   48 01 d0             	add    %rdx,%rax
+            __builtin_prefetch(
+    4d95:	|  |  |     |   0f 18 08             	prefetcht0 (%rax)
+        b = pred(b[h]) ? b + h : b;
+    4d98:	|  |  |     \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4d9c:	|  |  |         48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    4da3:	|  |  |         00 
+    4da4:	|  |  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4da8:	|  |  |         48 01 c2             	add    %rax,%rdx
+    4dab:	|  |  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    4daf:	|  |  |         48 89 d6             	mov    %rdx,%rsi
+    4db2:	|  |  |         48 89 c7             	mov    %rax,%rdi
+    4db5:	|  |  |         e8 64 fa ff ff       	call   481e <nel::search::upper_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}::operator()(int const&) const>
+    4dba:	|  |  |         84 c0                	test   %al,%al
+    4dbc:	|  |  |  /----- 74 15                	je     4dd3 <unsigned long nel::search::partition_point<int, nel::search::upper_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0xc5>
+    4dbe:	|  |  |  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4dc2:	|  |  |  |      48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    4dc9:	|  |  |  |      00 
+    4dca:	|  |  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4dce:	|  |  |  |      48 01 d0             	add    %rdx,%rax
+    4dd1:	|  |  |  |  /-- eb 04                	jmp    4dd7 <unsigned long nel::search::partition_point<int, nel::search::upper_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0xc9>
+    4dd3:	|  |  |  \--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4dd7:	|  |  |     \-> 48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        n -= h;
+    4ddb:	|  |  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4ddf:	|  |  |         48 29 45 d0          	sub    %rax,-0x30(%rbp)
+    while (n > 1) {
+    4de3:	|  |  \-------> 48 83 7d d0 01       	cmpq   $0x1,-0x30(%rbp)
+    4de8:	|  \----------- 0f 87 53 ff ff ff    	ja     4d41 <unsigned long nel::search::partition_point<int, nel::search::upper_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0x33>
+    return Index(b - p) + (pred(*b) ? 1 : 0);
+    4dee:	|               48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4df2:	|               48 2b 45 d8          	sub    -0x28(%rbp),%rax
+    4df6:	|               48 c1 f8 02          	sar    $0x2,%rax
+    4dfa:	|               48 89 c3             	mov    %rax,%rbx
+    4dfd:	|               48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    4e01:	|               48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    4e05:	|               48 89 d6             	mov    %rdx,%rsi
+    4e08:	|               48 89 c7             	mov    %rax,%rdi
+    4e0b:	|               e8 0e fa ff ff       	call   481e <nel::search::upper_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}::operator()(int const&) const>
+    4e10:	|               84 c0                	test   %al,%al
+    4e12:	|        /----- 74 07                	je     4e1b <unsigned long nel::search::partition_point<int, nel::search::upper_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0x10d>
+    4e14:	|        |      b8 01 00 00 00       	mov    $0x1,%eax
+    4e19:	|        |  /-- eb 05                	jmp    4e20 <unsigned long nel::search::partition_point<int, nel::search::upper_bound<int, nel::sort::Less>(int const*, unsigned long, int const&, nel::sort::Less&)::{lambda(int const&)#1}>(int const*, unsigned long, nel::sort::Less&)+0x112>
+    4e1b:	|        \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    4e20:	|           \-> 48 01 d8             	add    %rbx,%rax
+}
+    4e23:	\-------------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    4e27:	                c9                   	leave
+    4e28:	                c3                   	ret
+
+0000000000004e29 <void nel::sort::reverse<int>(int*, unsigned long)>:
+void reverse(T p[], Length const n)
+    4e29:	       55                   	push   %rbp
+    4e2a:	       48 89 e5             	mov    %rsp,%rbp
+    4e2d:	       48 83 ec 20          	sub    $0x20,%rsp
+    4e31:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    4e35:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    Index i = 0;
+    4e39:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    4e40:	       00 
+    Index j = n;
+    4e41:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4e45:	       48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    while (i + 1 < j) {
+    4e49:	   /-- eb 3b                	jmp    4e86 <void nel::sort::reverse<int>(int*, unsigned long)+0x5d>
+        j -= 1;
+    4e4b:	/--|-> 48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+        swap(p[i], p[j]);
+    4e50:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4e54:	|  |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    4e5b:	|  |   00 
+    4e5c:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4e60:	|  |   48 01 c2             	add    %rax,%rdx
+    4e63:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4e67:	|  |   48 8d 0c 85 00 00 00 	lea    0x0(,%rax,4),%rcx
+    4e6e:	|  |   00 
+    4e6f:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4e73:	|  |   48 01 c8             	add    %rcx,%rax
+    4e76:	|  |   48 89 d6             	mov    %rdx,%rsi
+    4e79:	|  |   48 89 c7             	mov    %rax,%rdi
+    4e7c:	|  |   e8 1c fb ff ff       	call   499d <void nel::swap<int>(int&, int&)>
+        i += 1;
+    4e81:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (i + 1 < j) {
+    4e86:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4e8a:	|      48 83 c0 01          	add    $0x1,%rax
+    4e8e:	|      48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    4e92:	\----- 72 b7                	jb     4e4b <void nel::sort::reverse<int>(int*, unsigned long)+0x22>
+}
+    4e94:	       90                   	nop
+    4e95:	       90                   	nop
+    4e96:	       c9                   	leave
+    4e97:	       c3                   	ret
+
+0000000000004e98 <nel::Element<void*>::operator*()>:
+        constexpr Type &operator*(void)
+    4e98:	55                   	push   %rbp
+    4e99:	48 89 e5             	mov    %rsp,%rbp
+    4e9c:	48 83 ec 10          	sub    $0x10,%rsp
+    4ea0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    4ea4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4ea8:	48 89 c7             	mov    %rax,%rdi
+    4eab:	e8 1c 00 00 00       	call   4ecc <nel::Element<void*>::ref()>
+        }
+    4eb0:	c9                   	leave
+    4eb1:	c3                   	ret
+
+0000000000004eb2 <nel::Element<nel::heaped::AllocError>::operator*()>:
+        constexpr Type &operator*(void)
+    4eb2:	55                   	push   %rbp
+    4eb3:	48 89 e5             	mov    %rsp,%rbp
+    4eb6:	48 83 ec 10          	sub    $0x10,%rsp
+    4eba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    4ebe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4ec2:	48 89 c7             	mov    %rax,%rdi
+    4ec5:	e8 10 00 00 00       	call   4eda <nel::Element<nel::heaped::AllocError>::ref()>
+        }
+    4eca:	c9                   	leave
+    4ecb:	c3                   	ret
+
+0000000000004ecc <nel::Element<void*>::ref()>:
+        constexpr Type &ref(void)
+    4ecc:	55                   	push   %rbp
+    4ecd:	48 89 e5             	mov    %rsp,%rbp
+    4ed0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    4ed4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    4ed8:	5d                   	pop    %rbp
+    4ed9:	c3                   	ret
+
+0000000000004eda <nel::Element<nel::heaped::AllocError>::ref()>:
+        constexpr Type &ref(void)
+    4eda:	55                   	push   %rbp
+    4edb:	48 89 e5             	mov    %rsp,%rbp
+    4ede:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    4ee2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    4ee6:	5d                   	pop    %rbp
+    4ee7:	c3                   	ret
+
+0000000000004ee8 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    4ee8:	55                   	push   %rbp
+    4ee9:	48 89 e5             	mov    %rsp,%rbp
+    std::abort();
+    4eec:	e8 4f c1 ff ff       	call   1040 <abort@plt>
+
+0000000000004ef1 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    4ef1:	55                   	push   %rbp
+    4ef2:	48 89 e5             	mov    %rsp,%rbp
+    4ef5:	48 83 ec 10          	sub    $0x10,%rsp
+    4ef9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    4efd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4f01:	48 8b 30             	mov    (%rax),%rsi
+    4f04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4f08:	8b 48 10             	mov    0x10(%rax),%ecx
+    4f0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4f0f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    4f13:	48 8b 05 66 41 00 00 	mov    0x4166(%rip),%rax        # 9080 <stderr@GLIBC_2.2.5>
+    4f1a:	4c 8d 0d fc 12 00 00 	lea    0x12fc(%rip),%r9        # 621d <nel::is_trivially_relocatable<int>+0x1>
+    4f21:	49 89 f0             	mov    %rsi,%r8
+    4f24:	48 8d 35 f8 12 00 00 	lea    0x12f8(%rip),%rsi        # 6223 <nel::is_trivially_relocatable<int>+0x7>
+    4f2b:	48 89 c7             	mov    %rax,%rdi
+    4f2e:	b8 00 00 00 00       	mov    $0x0,%eax
+    4f33:	e8 78 c1 ff ff       	call   10b0 <fprintf@plt>
+    abort();
+    4f38:	e8 ab ff ff ff       	call   4ee8 <nel::abort()>
+
+0000000000004f3d <nel::panic(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    4f3d:	55                   	push   %rbp
+    4f3e:	48 89 e5             	mov    %rsp,%rbp
+    4f41:	48 83 ec 10          	sub    $0x10,%rsp
+    4f45:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4f49:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    4f4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4f51:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    4f54:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4f58:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    4f5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4f5f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    4f63:	48 8b 05 16 41 00 00 	mov    0x4116(%rip),%rax        # 9080 <stderr@GLIBC_2.2.5>
+    4f6a:	48 83 ec 08          	sub    $0x8,%rsp
+    4f6e:	ff 75 f8             	push   -0x8(%rbp)
+    4f71:	4c 8d 0d a5 12 00 00 	lea    0x12a5(%rip),%r9        # 621d <nel::is_trivially_relocatable<int>+0x1>
+    4f78:	49 89 f0             	mov    %rsi,%r8
+    4f7b:	48 8d 35 b2 12 00 00 	lea    0x12b2(%rip),%rsi        # 6234 <nel::is_trivially_relocatable<int>+0x18>
+    4f82:	48 89 c7             	mov    %rax,%rdi
+    4f85:	b8 00 00 00 00       	mov    $0x0,%eax
+    4f8a:	e8 21 c1 ff ff       	call   10b0 <fprintf@plt>
+    4f8f:	48 83 c4 10          	add    $0x10,%rsp
+            "PANIC",
+            msg);
+    abort();
+    4f93:	e8 50 ff ff ff       	call   4ee8 <nel::abort()>
+
+0000000000004f98 <nel::assert_fail(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    4f98:	55                   	push   %rbp
+    4f99:	48 89 e5             	mov    %rsp,%rbp
+    4f9c:	48 83 ec 10          	sub    $0x10,%rsp
+    4fa0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4fa4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    4fa8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4fac:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    4faf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4fb3:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    4fb6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4fba:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    4fbe:	48 8b 05 bb 40 00 00 	mov    0x40bb(%rip),%rax        # 9080 <stderr@GLIBC_2.2.5>
+    4fc5:	48 83 ec 08          	sub    $0x8,%rsp
+    4fc9:	ff 75 f8             	push   -0x8(%rbp)
+    4fcc:	4c 8d 0d 76 12 00 00 	lea    0x1276(%rip),%r9        # 6249 <nel::is_trivially_relocatable<int>+0x2d>
+    4fd3:	49 89 f0             	mov    %rsi,%r8
+    4fd6:	48 8d 35 57 12 00 00 	lea    0x1257(%rip),%rsi        # 6234 <nel::is_trivially_relocatable<int>+0x18>
+    4fdd:	48 89 c7             	mov    %rax,%rdi
+    4fe0:	b8 00 00 00 00       	mov    $0x0,%eax
+    4fe5:	e8 c6 c0 ff ff       	call   10b0 <fprintf@plt>
+    4fea:	48 83 c4 10          	add    $0x10,%rsp
+            "ASSERT FAIL",
+            msg);
+    abort();
+    4fee:	e8 f5 fe ff ff       	call   4ee8 <nel::abort()>
+
+0000000000004ff3 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    4ff3:	55                   	push   %rbp
+    4ff4:	48 89 e5             	mov    %rsp,%rbp
+    4ff7:	48 83 ec 20          	sub    $0x20,%rsp
+    4ffb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4fff:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    5003:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    5007:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    500b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    500f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5013:	48 89 ce             	mov    %rcx,%rsi
+    5016:	48 89 c7             	mov    %rax,%rdi
+    5019:	e8 a2 c0 ff ff       	call   10c0 <memcpy@plt>
+}
+    501e:	90                   	nop
+    501f:	c9                   	leave
+    5020:	c3                   	ret
+
+0000000000005021 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    5021:	55                   	push   %rbp
+    5022:	48 89 e5             	mov    %rsp,%rbp
+    5025:	48 83 ec 20          	sub    $0x20,%rsp
+    5029:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    502d:	89 f0                	mov    %esi,%eax
+    502f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    5033:	88 45 f4             	mov    %al,-0xc(%rbp)
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    5036:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    503a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    503e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5042:	89 ce                	mov    %ecx,%esi
+    5044:	48 89 c7             	mov    %rax,%rdi
+    5047:	e8 34 c0 ff ff       	call   1080 <memset@plt>
+}
+    504c:	90                   	nop
+    504d:	c9                   	leave
+    504e:	c3                   	ret
+
+000000000000504f <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    504f:	55                   	push   %rbp
+    5050:	48 89 e5             	mov    %rsp,%rbp
+    5053:	48 83 ec 20          	sub    $0x20,%rsp
+    5057:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    505b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    505f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    //     *id = *is;
+    // }
+    // for (uint8_t *id = d, *is = s, *const e = (d + n); id != e; ++is, ++id) {
+    //     *is = 0xa5;
+    // }
+    copy(d, s, n);
+    5063:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    5067:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    506b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    506f:	48 89 ce             	mov    %rcx,%rsi
+    5072:	48 89 c7             	mov    %rax,%rdi
+    5075:	e8 79 ff ff ff       	call   4ff3 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    poison(s, n);
+    507a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    507e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5082:	48 89 d6             	mov    %rdx,%rsi
+    5085:	48 89 c7             	mov    %rax,%rdi
+    5088:	e8 60 07 00 00       	call   57ed <nel::elem::poison(unsigned char*, unsigned long)>
+}
+    508d:	90                   	nop
+    508e:	c9                   	leave
+    508f:	c3                   	ret
+
+0000000000005090 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    5090:	55                   	push   %rbp
+    5091:	48 89 e5             	mov    %rsp,%rbp
+    5094:	48 83 ec 20          	sub    $0x20,%rsp
+    5098:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    509c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    50a0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    std::memmove(d, s, n);
+    50a4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    50a8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    50ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    50b0:	48 89 ce             	mov    %rcx,%rsi
+    50b3:	48 89 c7             	mov    %rax,%rdi
+    50b6:	e8 25 c0 ff ff       	call   10e0 <memmove@plt>
+}
+    50bb:	90                   	nop
+    50bc:	c9                   	leave
+    50bd:	c3                   	ret
+
+00000000000050be <nel::elem::wipe(unsigned char*, unsigned long)>:
+
+void wipe(uint8_t *const d, Length const n)
+{
+    50be:	55                   	push   %rbp
+    50bf:	48 89 e5             	mov    %rsp,%rbp
+    50c2:	48 83 ec 10          	sub    $0x10,%rsp
+    50c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    50ca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    set(d, 0xa5, n);
+    50ce:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    50d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    50d6:	be a5 00 00 00       	mov    $0xa5,%esi
+    50db:	48 89 c7             	mov    %rax,%rdi
+    50de:	e8 3e ff ff ff       	call   5021 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    50e3:	90                   	nop
+    50e4:	c9                   	leave
+    50e5:	c3                   	ret
+
+00000000000050e6 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    50e6:	55                   	push   %rbp
+    50e7:	48 89 e5             	mov    %rsp,%rbp
+    50ea:	48 83 ec 20          	sub    $0x20,%rsp
+    50ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    50f2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    50f6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    50fa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    50fe:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    5102:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5106:	48 89 ce             	mov    %rcx,%rsi
+    5109:	48 89 c7             	mov    %rax,%rdi
+    510c:	e8 8f bf ff ff       	call   10a0 <memcmp@plt>
+    5111:	85 c0                	test   %eax,%eax
+    5113:	0f 94 c0             	sete   %al
+}
+    5116:	c9                   	leave
+    5117:	c3                   	ret
+
+0000000000005118 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    5118:	55                   	push   %rbp
+    5119:	48 89 e5             	mov    %rsp,%rbp
+    511c:	48 83 ec 20          	sub    $0x20,%rsp
+    5120:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5124:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    5128:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    512c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    5130:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    5134:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5138:	48 89 ce             	mov    %rcx,%rsi
+    513b:	48 89 c7             	mov    %rax,%rdi
+    513e:	e8 5d bf ff ff       	call   10a0 <memcmp@plt>
+    5143:	85 c0                	test   %eax,%eax
+    5145:	0f 95 c0             	setne  %al
+}
+    5148:	c9                   	leave
+    5149:	c3                   	ret
+
+000000000000514a <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>:
+
+// d[i] = p[i % 16] for i in [0, n), with normal stores:
+// the pattern once, then doubling the filled region.
+static void set_pattern(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    514a:	       55                   	push   %rbp
+    514b:	       48 89 e5             	mov    %rsp,%rbp
+    514e:	       48 83 ec 30          	sub    $0x30,%rsp
+    5152:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    5156:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    515a:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    Length done = (n < 16) ? n : 16;
+    515e:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    5162:	       ba 10 00 00 00       	mov    $0x10,%edx
+    5167:	       48 39 d0             	cmp    %rdx,%rax
+    516a:	       48 0f 47 c2          	cmova  %rdx,%rax
+    516e:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    copy(d, p, done);
+    5172:	       48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    5176:	       48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    517a:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    517e:	       48 89 ce             	mov    %rcx,%rsi
+    5181:	       48 89 c7             	mov    %rax,%rdi
+    5184:	       e8 6a fe ff ff       	call   4ff3 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    while (done < n) {
+    5189:	   /-- eb 3e                	jmp    51c9 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x7f>
+        Length const m = (done < n - done) ? done : n - done;
+    518b:	/--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    518f:	|  |   48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    5193:	|  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    5197:	|  |   48 39 c2             	cmp    %rax,%rdx
+    519a:	|  |   48 0f 46 c2          	cmovbe %rdx,%rax
+    519e:	|  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        copy(d + done, d, m);
+    51a2:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    51a6:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    51aa:	|  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    51ae:	|  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    51b2:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    51b6:	|  |   48 89 c6             	mov    %rax,%rsi
+    51b9:	|  |   48 89 cf             	mov    %rcx,%rdi
+    51bc:	|  |   e8 32 fe ff ff       	call   4ff3 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        done += m;
+    51c1:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    51c5:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+    while (done < n) {
+    51c9:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    51cd:	|      48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    51d1:	\----- 72 b8                	jb     518b <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x41>
+    }
+}
+    51d3:	       90                   	nop
+    51d4:	       90                   	nop
+    51d5:	       c9                   	leave
+    51d6:	       c3                   	ret
+
+00000000000051d7 <nel::elem::load16(unsigned char const*)>:
+static constexpr Length streaming_min = 256;
+
+typedef long long int Line16 __attribute__((vector_size(16)));
+
+static inline Line16 load16(uint8_t const *const s)
+{
+    51d7:	55                   	push   %rbp
+    51d8:	48 89 e5             	mov    %rsp,%rbp
+    51db:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Line16 v;
+    std::memcpy(&v, s, sizeof(v));
+    51df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    51e3:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    51e7:	48 8b 00             	mov    (%rax),%rax
+    51ea:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    51ee:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    return v;
+    51f2:	66 0f 6f 45 f0       	movdqa -0x10(%rbp),%xmm0
+}
+    51f7:	5d                   	pop    %rbp
+    51f8:	c3                   	ret
+
+00000000000051f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>:
+
+static inline void stream16(uint8_t *const d, Line16 const &v)
+{
+    51f9:	55                   	push   %rbp
+    51fa:	48 89 e5             	mov    %rsp,%rbp
+    51fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5201:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    5205:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5209:	66 0f 6f 00          	movdqa (%rax),%xmm0
+    520d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5211:	66 0f e7 00          	movntdq %xmm0,(%rax)
+}
+    5215:	90                   	nop
+    5216:	5d                   	pop    %rbp
+    5217:	c3                   	ret
+
+0000000000005218 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    5218:	          55                   	push   %rbp
+    5219:	          48 89 e5             	mov    %rsp,%rbp
+    521c:	          48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    5220:	          48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    5224:	          48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    5228:	          48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    if (n < streaming_min) {
+    522c:	          48 81 7d 88 ff 00 00 	cmpq   $0xff,-0x78(%rbp)
+    5233:	          00 
+    5234:	      /-- 77 1c                	ja     5252 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        copy(d, s, n);
+    5236:	      |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    523a:	      |   48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    523e:	      |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    5242:	      |   48 89 ce             	mov    %rcx,%rsi
+    5245:	      |   48 89 c7             	mov    %rax,%rdi
+    5248:	      |   e8 a6 fd ff ff       	call   4ff3 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        return;
+    524d:	/-----|-- e9 98 01 00 00       	jmp    53ea <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1d2>
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    5252:	|     \-> 48 8b 45 98          	mov    -0x68(%rbp),%rax
+    5256:	|         48 f7 d8             	neg    %rax
+    5259:	|         83 e0 0f             	and    $0xf,%eax
+    525c:	|         48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    copy(d, s, head);
+    5260:	|         48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    5264:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    5268:	|         48 8b 45 98          	mov    -0x68(%rbp),%rax
+    526c:	|         48 89 ce             	mov    %rcx,%rsi
+    526f:	|         48 89 c7             	mov    %rax,%rdi
+    5272:	|         e8 7c fd ff ff       	call   4ff3 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    Index i = head;
+    5277:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    527b:	|         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    527f:	|     /-- e9 e1 00 00 00       	jmp    5365 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        Line16 const a = load16(s + i);
+    5284:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    5288:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    528c:	|  |  |   48 01 d0             	add    %rdx,%rax
+    528f:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    5292:	|  |  |   e8 40 ff ff ff       	call   51d7 <nel::elem::load16(unsigned char const*)>
+    5297:	|  |  |   0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+        Line16 const b = load16(s + i + 16);
+    529b:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    529f:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    52a3:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    52a7:	|  |  |   48 01 d0             	add    %rdx,%rax
+    52aa:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    52ad:	|  |  |   e8 25 ff ff ff       	call   51d7 <nel::elem::load16(unsigned char const*)>
+    52b2:	|  |  |   0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+        Line16 const c = load16(s + i + 32);
+    52b6:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    52ba:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    52be:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    52c2:	|  |  |   48 01 d0             	add    %rdx,%rax
+    52c5:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    52c8:	|  |  |   e8 0a ff ff ff       	call   51d7 <nel::elem::load16(unsigned char const*)>
+    52cd:	|  |  |   0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+        Line16 const e = load16(s + i + 48);
+    52d1:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    52d5:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    52d9:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    52dd:	|  |  |   48 01 d0             	add    %rdx,%rax
+    52e0:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    52e3:	|  |  |   e8 ef fe ff ff       	call   51d7 <nel::elem::load16(unsigned char const*)>
+    52e8:	|  |  |   0f 29 45 a0          	movaps %xmm0,-0x60(%rbp)
+        stream16(d + i, a);
+    52ec:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    52f0:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    52f4:	|  |  |   48 01 c2             	add    %rax,%rdx
+    52f7:	|  |  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    52fb:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    52fe:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    5301:	|  |  |   e8 f3 fe ff ff       	call   51f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, b);
+    5306:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    530a:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    530e:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    5312:	|  |  |   48 01 c2             	add    %rax,%rdx
+    5315:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    5319:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    531c:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    531f:	|  |  |   e8 d5 fe ff ff       	call   51f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, c);
+    5324:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5328:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    532c:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    5330:	|  |  |   48 01 c2             	add    %rax,%rdx
+    5333:	|  |  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    5337:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    533a:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    533d:	|  |  |   e8 b7 fe ff ff       	call   51f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, e);
+    5342:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5346:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    534a:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    534e:	|  |  |   48 01 c2             	add    %rax,%rdx
+    5351:	|  |  |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    5355:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    5358:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    535b:	|  |  |   e8 99 fe ff ff       	call   51f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    5360:	|  |  |   48 83 45 f8 40       	addq   $0x40,-0x8(%rbp)
+    5365:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5369:	|  |      48 83 c0 40          	add    $0x40,%rax
+    536d:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    5371:	|  \----- 0f 83 0d ff ff ff    	jae    5284 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x6c>
+    }
+    for (; i + 16 <= n; i += 16) {
+    5377:	|     /-- eb 36                	jmp    53af <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x197>
+        stream16(d + i, load16(s + i));
+    5379:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    537d:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5381:	|  |  |   48 01 d0             	add    %rdx,%rax
+    5384:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    5387:	|  |  |   e8 4b fe ff ff       	call   51d7 <nel::elem::load16(unsigned char const*)>
+    538c:	|  |  |   0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+    5390:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    5394:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5398:	|  |  |   48 01 c2             	add    %rax,%rdx
+    539b:	|  |  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    539f:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    53a2:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    53a5:	|  |  |   e8 4f fe ff ff       	call   51f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    53aa:	|  |  |   48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+    53af:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    53b3:	|  |      48 83 c0 10          	add    $0x10,%rax
+    53b7:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    53bb:	|  \----- 73 bc                	jae    5379 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    53bd:	|         0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    53c0:	|         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    53c4:	|         48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    53c8:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    53cc:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    53d0:	|         48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    53d4:	|         48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+    53d8:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    53dc:	|         48 01 d1             	add    %rdx,%rcx
+    53df:	|         48 89 c2             	mov    %rax,%rdx
+    53e2:	|         48 89 cf             	mov    %rcx,%rdi
+    53e5:	|         e8 09 fc ff ff       	call   4ff3 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+}
+    53ea:	\-------> c9                   	leave
+    53eb:	          c3                   	ret
+
+00000000000053ec <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    53ec:	          55                   	push   %rbp
+    53ed:	          48 89 e5             	mov    %rsp,%rbp
+    53f0:	          48 83 ec 60          	sub    $0x60,%rsp
+    53f4:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    53f8:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    53fc:	          48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    if (n < streaming_min) {
+    5400:	          48 81 7d a8 ff 00 00 	cmpq   $0xff,-0x58(%rbp)
+    5407:	          00 
+    5408:	      /-- 77 1c                	ja     5426 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        set_pattern(d, p, n);
+    540a:	      |   48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    540e:	      |   48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+    5412:	      |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    5416:	      |   48 89 ce             	mov    %rcx,%rsi
+    5419:	      |   48 89 c7             	mov    %rax,%rdi
+    541c:	      |   e8 29 fd ff ff       	call   514a <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>
+    5421:	/-----|-- e9 89 01 00 00       	jmp    55af <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c3>
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    5426:	|     \-> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    542a:	|         48 f7 d8             	neg    %rax
+    542d:	|         83 e0 0f             	and    $0xf,%eax
+    5430:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    for (Index i = 0; i < head; ++i) {
+    5434:	|         48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    543b:	|         00 
+    543c:	|     /-- eb 20                	jmp    545e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x72>
+        d[i] = p[i];
+    543e:	|  /--|-> 48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    5442:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5446:	|  |  |   48 01 d0             	add    %rdx,%rax
+    5449:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    544d:	|  |  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    5451:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    5454:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    5457:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < head; ++i) {
+    5459:	|  |  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    545e:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5462:	|  |      48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    5466:	|  \----- 72 d6                	jb     543e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x52>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    5468:	|         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    546f:	|         00 
+    5470:	|     /-- eb 2d                	jmp    549f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xb3>
+        rotated[i] = p[(head + i) % 16];
+    5472:	|  /--|-> 48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    5476:	|  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    547a:	|  |  |   48 01 d0             	add    %rdx,%rax
+    547d:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    5480:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    5483:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    5487:	|  |  |   48 01 d0             	add    %rdx,%rax
+    548a:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    548d:	|  |  |   48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    5491:	|  |  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    5495:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    5498:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < 16; ++i) {
+    549a:	|  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    549f:	|  |  \-> 48 83 7d f0 0f       	cmpq   $0xf,-0x10(%rbp)
+    54a4:	|  \----- 76 cc                	jbe    5472 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x86>
+    }
+    Line16 const v = load16(rotated);
+    54a6:	|         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    54aa:	|         48 89 c7             	mov    %rax,%rdi
+    54ad:	|         e8 25 fd ff ff       	call   51d7 <nel::elem::load16(unsigned char const*)>
+    54b2:	|         0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+    Index i = head;
+    54b6:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    54ba:	|         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    54be:	|     /-- eb 79                	jmp    5539 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        stream16(d + i, v);
+    54c0:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    54c4:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    54c8:	|  |  |   48 01 c2             	add    %rax,%rdx
+    54cb:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    54cf:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    54d2:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    54d5:	|  |  |   e8 1f fd ff ff       	call   51f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, v);
+    54da:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    54de:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    54e2:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    54e6:	|  |  |   48 01 c2             	add    %rax,%rdx
+    54e9:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    54ed:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    54f0:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    54f3:	|  |  |   e8 01 fd ff ff       	call   51f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, v);
+    54f8:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    54fc:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    5500:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    5504:	|  |  |   48 01 c2             	add    %rax,%rdx
+    5507:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    550b:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    550e:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    5511:	|  |  |   e8 e3 fc ff ff       	call   51f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, v);
+    5516:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    551a:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    551e:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    5522:	|  |  |   48 01 c2             	add    %rax,%rdx
+    5525:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    5529:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    552c:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    552f:	|  |  |   e8 c5 fc ff ff       	call   51f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    5534:	|  |  |   48 83 45 e8 40       	addq   $0x40,-0x18(%rbp)
+    5539:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    553d:	|  |      48 83 c0 40          	add    $0x40,%rax
+    5541:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    5545:	|  \----- 0f 83 75 ff ff ff    	jae    54c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd4>
+    }
+    for (; i + 16 <= n; i += 16) {
+    554b:	|     /-- eb 1f                	jmp    556c <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x180>
+        stream16(d + i, v);
+    554d:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    5551:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5555:	|  |  |   48 01 c2             	add    %rax,%rdx
+    5558:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    555c:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    555f:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    5562:	|  |  |   e8 92 fc ff ff       	call   51f9 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    5567:	|  |  |   48 83 45 e8 10       	addq   $0x10,-0x18(%rbp)
+    556c:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5570:	|  |      48 83 c0 10          	add    $0x10,%rax
+    5574:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    5578:	|  \----- 73 d3                	jae    554d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    __builtin_ia32_sfence();
+    557a:	|         0f ae f8             	sfence
+    for (; i < n; ++i) {
+    557d:	|     /-- eb 26                	jmp    55a5 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1b9>
+        d[i] = p[i % 16];
+    557f:	|  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5583:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    5586:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    5589:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    558d:	|  |  |   48 01 d0             	add    %rdx,%rax
+    5590:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    5594:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    5598:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    559b:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    559e:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (; i < n; ++i) {
+    55a0:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    55a5:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    55a9:	|  |      48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    55ad:	|  \----- 72 d0                	jb     557f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x193>
+    }
+}
+    55af:	\-------> c9                   	leave
+    55b0:	          c3                   	ret
+
+00000000000055b1 <nel::offset_of(unsigned char*, unsigned long)>:
+// The payload is the first align boundary leaving room for a Length in front,
+// which holds the offset from the start of the underlying allocation.
+// Malloc alignment is at least alignof(Length), so the payload is at most
+// align bytes in.
+static Length offset_of(uint8_t *const base, Length const align)
+{
+    55b1:	55                   	push   %rbp
+    55b2:	48 89 e5             	mov    %rsp,%rbp
+    55b5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    55b9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    USize const a = reinterpret_cast<USize>(base) + sizeof(Length);
+    55bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    55c1:	48 83 c0 08          	add    $0x8,%rax
+    55c5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    55c9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    55cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    55d1:	48 01 d0             	add    %rdx,%rax
+    55d4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    55d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    55dc:	48 f7 d8             	neg    %rax
+    55df:	48 21 c2             	and    %rax,%rdx
+    55e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    55e6:	48 29 c2             	sub    %rax,%rdx
+    55e9:	48 89 d0             	mov    %rdx,%rax
+}
+    55ec:	5d                   	pop    %rbp
+    55ed:	c3                   	ret
+
+00000000000055ee <nel::offset_field(unsigned char*)>:
+
+static Length &offset_field(uint8_t *const p)
+{
+    55ee:	55                   	push   %rbp
+    55ef:	48 89 e5             	mov    %rsp,%rbp
+    55f2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return reinterpret_cast<Length *>(p)[-1];
+    55f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    55fa:	48 83 e8 08          	sub    $0x8,%rax
+}
+    55fe:	5d                   	pop    %rbp
+    55ff:	c3                   	ret
+
+0000000000005600 <nel::free_aligned(void*)>:
+
+void free_aligned(void *const p)
+{
+    5600:	       55                   	push   %rbp
+    5601:	       48 89 e5             	mov    %rsp,%rbp
+    5604:	       48 83 ec 20          	sub    $0x20,%rsp
+    5608:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (p == nullptr) { return; }
+    560c:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    5611:	/----- 74 2e                	je     5641 <nel::free_aligned(void*)+0x41>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    5613:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    5617:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    std::free(u8p - offset_field(u8p));
+    561b:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    561f:	|      48 89 c7             	mov    %rax,%rdi
+    5622:	|      e8 c7 ff ff ff       	call   55ee <nel::offset_field(unsigned char*)>
+    5627:	|      48 8b 00             	mov    (%rax),%rax
+    562a:	|      48 f7 d8             	neg    %rax
+    562d:	|      48 89 c2             	mov    %rax,%rdx
+    5630:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5634:	|      48 01 d0             	add    %rdx,%rax
+    5637:	|      48 89 c7             	mov    %rax,%rdi
+    563a:	|      e8 f1 b9 ff ff       	call   1030 <free@plt>
+    563f:	|  /-- eb 01                	jmp    5642 <nel::free_aligned(void*)+0x42>
+    if (p == nullptr) { return; }
+    5641:	\--|-> 90                   	nop
+}
+    5642:	   \-> c9                   	leave
+    5643:	       c3                   	ret
+
+0000000000005644 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    5644:	             55                   	push   %rbp
+    5645:	             48 89 e5             	mov    %rsp,%rbp
+    5648:	             53                   	push   %rbx
+    5649:	             48 83 ec 78          	sub    $0x78,%rsp
+    564d:	             48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    5651:	             48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    5655:	             48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    5659:	             48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    565d:	             48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    5661:	             b9 f3 00 00 00       	mov    $0xf3,%ecx
+    5666:	             48 8d 15 fb 0b 00 00 	lea    0xbfb(%rip),%rdx        # 6268 <nel::elem::streaming_min+0x8>
+    566d:	             48 8d 35 06 0c 00 00 	lea    0xc06(%rip),%rsi        # 627a <nel::elem::streaming_min+0x1a>
+    5674:	             48 89 c7             	mov    %rax,%rdi
+    5677:	             e8 2e cb ff ff       	call   21aa <nel::Context::Context(char const*, char const*, int)>
+    567c:	             48 83 7d 90 00       	cmpq   $0x0,-0x70(%rbp)
+    5681:	      /----- 74 18                	je     569b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    5683:	      |      48 8b 45 90          	mov    -0x70(%rbp),%rax
+    5687:	      |      48 83 e8 01          	sub    $0x1,%rax
+    568b:	      |      48 23 45 90          	and    -0x70(%rbp),%rax
+    568f:	      |      48 85 c0             	test   %rax,%rax
+    5692:	      +----- 75 07                	jne    569b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    5694:	      |      b8 01 00 00 00       	mov    $0x1,%eax
+    5699:	      |  /-- eb 05                	jmp    56a0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x5c>
+    569b:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    56a0:	         \-> 0f b6 c0             	movzbl %al,%eax
+    56a3:	             48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    56a7:	             48 8d 0d dc 0b 00 00 	lea    0xbdc(%rip),%rcx        # 628a <nel::elem::streaming_min+0x2a>
+    56ae:	             48 89 ce             	mov    %rcx,%rsi
+    56b1:	             89 c7                	mov    %eax,%edi
+    56b3:	             e8 5b 01 00 00       	call   5813 <nel::assert(bool, char const*, nel::Context const&)>
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    56b8:	             48 8b 45 98          	mov    -0x68(%rbp),%rax
+    56bc:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    56c0:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    56c5:	      /----- 74 11                	je     56d8 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x94>
+    56c7:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    56cb:	      |      48 89 c7             	mov    %rax,%rdi
+    56ce:	      |      e8 1b ff ff ff       	call   55ee <nel::offset_field(unsigned char*)>
+    56d3:	      |      48 8b 00             	mov    (%rax),%rax
+    56d6:	      |  /-- eb 05                	jmp    56dd <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x99>
+    56d8:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    56dd:	         \-> 48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    56e1:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    56e6:	      /----- 74 13                	je     56fb <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb7>
+    56e8:	      |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    56ec:	      |      48 f7 d8             	neg    %rax
+    56ef:	      |      48 89 c2             	mov    %rax,%rdx
+    56f2:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    56f6:	      |      48 01 d0             	add    %rdx,%rax
+    56f9:	      |  /-- eb 05                	jmp    5700 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xbc>
+    56fb:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    5700:	         \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    5704:	             48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    5708:	             48 8b 45 90          	mov    -0x70(%rbp),%rax
+    570c:	             48 01 c2             	add    %rax,%rdx
+    570f:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    5713:	             48 89 d6             	mov    %rdx,%rsi
+    5716:	             48 89 c7             	mov    %rax,%rdi
+    5719:	             e8 b2 b9 ff ff       	call   10d0 <realloc@plt>
+    571e:	             48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if (new_base == nullptr) { return nullptr; }
+    5722:	             48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    5727:	         /-- 75 0a                	jne    5733 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    5729:	         |   b8 00 00 00 00       	mov    $0x0,%eax
+    572e:	/--------|-- e9 85 00 00 00       	jmp    57b8 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x174>
+
+    Length const new_offset = offset_of(new_base, align);
+    5733:	|        \-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    5737:	|            48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    573b:	|            48 89 d6             	mov    %rdx,%rsi
+    573e:	|            48 89 c7             	mov    %rax,%rdi
+    5741:	|            e8 6b fe ff ff       	call   55b1 <nel::offset_of(unsigned char*, unsigned long)>
+    5746:	|            48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    uint8_t *const new_p = new_base + new_offset;
+    574a:	|            48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    574e:	|            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    5752:	|            48 01 d0             	add    %rdx,%rax
+    5755:	|            48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    if (old_p != nullptr && new_offset != old_offset) {
+    5759:	|            48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    575e:	|  /-------- 74 41                	je     57a1 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+    5760:	|  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    5764:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    5768:	|  +-------- 74 37                	je     57a1 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+    576a:	|  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    576e:	|  |         48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    5772:	|  |  /----- 73 06                	jae    577a <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x136>
+    5774:	|  |  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    5778:	|  |  |  /-- eb 04                	jmp    577e <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x13a>
+    577a:	|  |  \--|-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    577e:	|  |     \-> 48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        std::memmove(new_p, new_base + old_offset, n);
+    5782:	|  |         48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    5786:	|  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    578a:	|  |         48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    578e:	|  |         48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    5792:	|  |         48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    5796:	|  |         48 89 ce             	mov    %rcx,%rsi
+    5799:	|  |         48 89 c7             	mov    %rax,%rdi
+    579c:	|  |         e8 3f b9 ff ff       	call   10e0 <memmove@plt>
+    }
+    offset_field(new_p) = new_offset;
+    57a1:	|  \-------> 48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+    57a5:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    57a9:	|            48 89 c7             	mov    %rax,%rdi
+    57ac:	|            e8 3d fe ff ff       	call   55ee <nel::offset_field(unsigned char*)>
+    57b1:	|            48 89 18             	mov    %rbx,(%rax)
+    return new_p;
+    57b4:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+}
+    57b8:	\----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    57bc:	             c9                   	leave
+    57bd:	             c3                   	ret
+
+00000000000057be <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    57be:	55                   	push   %rbp
+    57bf:	48 89 e5             	mov    %rsp,%rbp
+    57c2:	48 83 ec 10          	sub    $0x10,%rsp
+    57c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    57ca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return realloc_aligned(nullptr, align, 0, size);
+    57ce:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    57d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    57d6:	48 89 d1             	mov    %rdx,%rcx
+    57d9:	ba 00 00 00 00       	mov    $0x0,%edx
+    57de:	48 89 c6             	mov    %rax,%rsi
+    57e1:	bf 00 00 00 00       	mov    $0x0,%edi
+    57e6:	e8 59 fe ff ff       	call   5644 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+}
+    57eb:	c9                   	leave
+    57ec:	c3                   	ret
+
+00000000000057ed <nel::elem::poison(unsigned char*, unsigned long)>:
+{
+    57ed:	55                   	push   %rbp
+    57ee:	48 89 e5             	mov    %rsp,%rbp
+    57f1:	48 83 ec 10          	sub    $0x10,%rsp
+    57f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    57f9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    copy(d, s, n);
+    57fd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    5801:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    5805:	48 89 d6             	mov    %rdx,%rsi
+    5808:	48 89 c7             	mov    %rax,%rdi
+    580b:	e8 ae f8 ff ff       	call   50be <nel::elem::wipe(unsigned char*, unsigned long)>
+}
+    5810:	90                   	nop
+    5811:	c9                   	leave
+    5812:	c3                   	ret
+
+0000000000005813 <nel::assert(bool, char const*, nel::Context const&)>:
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx);
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    5813:	    55                   	push   %rbp
+    5814:	    48 89 e5             	mov    %rsp,%rbp
+    5817:	    48 83 ec 20          	sub    $0x20,%rsp
+    581b:	    89 f8                	mov    %edi,%eax
+    581d:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    5821:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    5825:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { assert_fail(msg, ctx); }
+    5828:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    582c:	    83 f0 01             	xor    $0x1,%eax
+    582f:	    84 c0                	test   %al,%al
+    5831:	/-- 74 13                	je     5846 <nel::assert(bool, char const*, nel::Context const&)+0x33>
+    5833:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    5837:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    583b:	|   48 89 d6             	mov    %rdx,%rsi
+    583e:	|   48 89 c7             	mov    %rax,%rdi
+    5841:	|   e8 52 f7 ff ff       	call   4f98 <nel::assert_fail(char const*, nel::Context const&)>
+}
+    5846:	\-> 90                   	nop
+    5847:	    c9                   	leave
+    5848:	    c3                   	ret
+
+0000000000005849 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    5849:	55                   	push   %rbp
+    584a:	48 89 e5             	mov    %rsp,%rbp
+    584d:	48 83 ec 10          	sub    $0x10,%rsp
+    5851:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5855:	89 f0                	mov    %esi,%eax
+    5857:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    585a:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    585e:	48 8b 15 1b 38 00 00 	mov    0x381b(%rip),%rdx        # 9080 <stderr@GLIBC_2.2.5>
+    5865:	48 89 d6             	mov    %rdx,%rsi
+    5868:	89 c7                	mov    %eax,%edi
+    586a:	e8 21 b8 ff ff       	call   1090 <fputc@plt>
+    return outs;
+    586f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    5873:	c9                   	leave
+    5874:	c3                   	ret
+
+0000000000005875 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    5875:	55                   	push   %rbp
+    5876:	48 89 e5             	mov    %rsp,%rbp
+    5879:	48 83 ec 10          	sub    $0x10,%rsp
+    587d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5881:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    5885:	48 8b 15 f4 37 00 00 	mov    0x37f4(%rip),%rdx        # 9080 <stderr@GLIBC_2.2.5>
+    588c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    5890:	48 89 d6             	mov    %rdx,%rsi
+    5893:	48 89 c7             	mov    %rax,%rdi
+    5896:	e8 d5 b7 ff ff       	call   1070 <fputs@plt>
+    return outs;
+    589b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    589f:	c9                   	leave
+    58a0:	c3                   	ret
+
+00000000000058a1 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    58a1:	55                   	push   %rbp
+    58a2:	48 89 e5             	mov    %rsp,%rbp
+    58a5:	48 83 ec 10          	sub    $0x10,%rsp
+    58a9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    58ad:	89 f0                	mov    %esi,%eax
+    58af:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    58b2:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    58b6:	48 8b 05 c3 37 00 00 	mov    0x37c3(%rip),%rax        # 9080 <stderr@GLIBC_2.2.5>
+    58bd:	48 8d 0d e1 09 00 00 	lea    0x9e1(%rip),%rcx        # 62a5 <nel::elem::streaming_min+0x45>
+    58c4:	48 89 ce             	mov    %rcx,%rsi
+    58c7:	48 89 c7             	mov    %rax,%rdi
+    58ca:	b8 00 00 00 00       	mov    $0x0,%eax
+    58cf:	e8 dc b7 ff ff       	call   10b0 <fprintf@plt>
+    return outs;
+    58d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    58d8:	c9                   	leave
+    58d9:	c3                   	ret
+
+00000000000058da <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    58da:	55                   	push   %rbp
+    58db:	48 89 e5             	mov    %rsp,%rbp
+    58de:	48 83 ec 10          	sub    $0x10,%rsp
+    58e2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    58e6:	89 f0                	mov    %esi,%eax
+    58e8:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    58ec:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    58f0:	48 8b 05 89 37 00 00 	mov    0x3789(%rip),%rax        # 9080 <stderr@GLIBC_2.2.5>
+    58f7:	48 8d 0d a7 09 00 00 	lea    0x9a7(%rip),%rcx        # 62a5 <nel::elem::streaming_min+0x45>
+    58fe:	48 89 ce             	mov    %rcx,%rsi
+    5901:	48 89 c7             	mov    %rax,%rdi
+    5904:	b8 00 00 00 00       	mov    $0x0,%eax
+    5909:	e8 a2 b7 ff ff       	call   10b0 <fprintf@plt>
+    return outs;
+    590e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    5912:	c9                   	leave
+    5913:	c3                   	ret
+
+0000000000005914 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    5914:	55                   	push   %rbp
+    5915:	48 89 e5             	mov    %rsp,%rbp
+    5918:	48 83 ec 10          	sub    $0x10,%rsp
+    591c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5920:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    5923:	48 8b 05 56 37 00 00 	mov    0x3756(%rip),%rax        # 9080 <stderr@GLIBC_2.2.5>
+    592a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    592d:	48 8d 0d 71 09 00 00 	lea    0x971(%rip),%rcx        # 62a5 <nel::elem::streaming_min+0x45>
+    5934:	48 89 ce             	mov    %rcx,%rsi
+    5937:	48 89 c7             	mov    %rax,%rdi
+    593a:	b8 00 00 00 00       	mov    $0x0,%eax
+    593f:	e8 6c b7 ff ff       	call   10b0 <fprintf@plt>
+    return outs;
+    5944:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    5948:	c9                   	leave
+    5949:	c3                   	ret
+
+000000000000594a <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    594a:	55                   	push   %rbp
+    594b:	48 89 e5             	mov    %rsp,%rbp
+    594e:	48 83 ec 10          	sub    $0x10,%rsp
+    5952:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    5956:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    5959:	48 8b 05 20 37 00 00 	mov    0x3720(%rip),%rax        # 9080 <stderr@GLIBC_2.2.5>
+    5960:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    5963:	48 8d 0d 3b 09 00 00 	lea    0x93b(%rip),%rcx        # 62a5 <nel::elem::streaming_min+0x45>
+    596a:	48 89 ce             	mov    %rcx,%rsi
+    596d:	48 89 c7             	mov    %rax,%rdi
+    5970:	b8 00 00 00 00       	mov    $0x0,%eax
+    5975:	e8 36 b7 ff ff       	call   10b0 <fprintf@plt>
+    return outs;
+    597a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    597e:	c9                   	leave
+    597f:	c3                   	ret
+
+0000000000005980 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    5980:	55                   	push   %rbp
+    5981:	48 89 e5             	mov    %rsp,%rbp
+    5984:	48 83 ec 10          	sub    $0x10,%rsp
+    5988:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    598c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    5990:	48 8b 05 e9 36 00 00 	mov    0x36e9(%rip),%rax        # 9080 <stderr@GLIBC_2.2.5>
+    5997:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    599b:	48 8d 0d 06 09 00 00 	lea    0x906(%rip),%rcx        # 62a8 <nel::elem::streaming_min+0x48>
+    59a2:	48 89 ce             	mov    %rcx,%rsi
+    59a5:	48 89 c7             	mov    %rax,%rdi
+    59a8:	b8 00 00 00 00       	mov    $0x0,%eax
+    59ad:	e8 fe b6 ff ff       	call   10b0 <fprintf@plt>
+    return outs;
+    59b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    59b6:	c9                   	leave
+    59b7:	c3                   	ret
+
+Disassembly of section .fini:
+
+00000000000059b8 <_fini>:
+    59b8:	48 83 ec 08          	sub    $0x8,%rsp
+    59bc:	48 83 c4 08          	add    $0x8,%rsp
+    59c0:	c3                   	ret
@@ -0,0 +1,5167 @@
+
+target/debug/examples/bench_stream:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 6f 00 00 	mov    0x6fc5(%rip),%rax        # 7fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 6f 00 00    	push   0x6fca(%rip)        # 7ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 6f 00 00    	jmp    *0x6fcc(%rip)        # 7ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 6f 00 00    	jmp    *0x6fca(%rip)        # 8000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 6f 00 00    	jmp    *0x6fc2(%rip)        # 8008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <pthread_cond_broadcast@plt>:
+    1050:	ff 25 ba 6f 00 00    	jmp    *0x6fba(%rip)        # 8010 <pthread_cond_broadcast@GLIBC_2.3.2>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <clock_gettime@plt>:
+    1060:	ff 25 b2 6f 00 00    	jmp    *0x6fb2(%rip)        # 8018 <clock_gettime@GLIBC_2.17>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <pthread_cond_wait@plt>:
+    1070:	ff 25 aa 6f 00 00    	jmp    *0x6faa(%rip)        # 8020 <pthread_cond_wait@GLIBC_2.3.2>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <pthread_mutex_destroy@plt>:
+    1080:	ff 25 a2 6f 00 00    	jmp    *0x6fa2(%rip)        # 8028 <pthread_mutex_destroy@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fputs@plt>:
+    1090:	ff 25 9a 6f 00 00    	jmp    *0x6f9a(%rip)        # 8030 <fputs@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memset@plt>:
+    10a0:	ff 25 92 6f 00 00    	jmp    *0x6f92(%rip)        # 8038 <memset@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <fputc@plt>:
+    10b0:	ff 25 8a 6f 00 00    	jmp    *0x6f8a(%rip)        # 8040 <fputc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <memcmp@plt>:
+    10c0:	ff 25 82 6f 00 00    	jmp    *0x6f82(%rip)        # 8048 <memcmp@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <pthread_cond_signal@plt>:
+    10d0:	ff 25 7a 6f 00 00    	jmp    *0x6f7a(%rip)        # 8050 <pthread_cond_signal@GLIBC_2.3.2>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010e0 <fprintf@plt>:
+    10e0:	ff 25 72 6f 00 00    	jmp    *0x6f72(%rip)        # 8058 <fprintf@GLIBC_2.2.5>
+    10e6:	68 0b 00 00 00       	push   $0xb
+    10eb:	e9 30 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010f0 <memcpy@plt>:
+    10f0:	ff 25 6a 6f 00 00    	jmp    *0x6f6a(%rip)        # 8060 <memcpy@GLIBC_2.14>
+    10f6:	68 0c 00 00 00       	push   $0xc
+    10fb:	e9 20 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001100 <pthread_cond_init@plt>:
+    1100:	ff 25 62 6f 00 00    	jmp    *0x6f62(%rip)        # 8068 <pthread_cond_init@GLIBC_2.3.2>
+    1106:	68 0d 00 00 00       	push   $0xd
+    110b:	e9 10 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001110 <pthread_mutex_unlock@plt>:
+    1110:	ff 25 5a 6f 00 00    	jmp    *0x6f5a(%rip)        # 8070 <pthread_mutex_unlock@GLIBC_2.2.5>
+    1116:	68 0e 00 00 00       	push   $0xe
+    111b:	e9 00 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001120 <realloc@plt>:
+    1120:	ff 25 52 6f 00 00    	jmp    *0x6f52(%rip)        # 8078 <realloc@GLIBC_2.2.5>
+    1126:	68 0f 00 00 00       	push   $0xf
+    112b:	e9 f0 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001130 <pthread_create@plt>:
+    1130:	ff 25 4a 6f 00 00    	jmp    *0x6f4a(%rip)        # 8080 <pthread_create@GLIBC_2.34>
+    1136:	68 10 00 00 00       	push   $0x10
+    113b:	e9 e0 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001140 <memmove@plt>:
+    1140:	ff 25 42 6f 00 00    	jmp    *0x6f42(%rip)        # 8088 <memmove@GLIBC_2.2.5>
+    1146:	68 11 00 00 00       	push   $0x11
+    114b:	e9 d0 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001150 <pthread_cond_destroy@plt>:
+    1150:	ff 25 3a 6f 00 00    	jmp    *0x6f3a(%rip)        # 8090 <pthread_cond_destroy@GLIBC_2.3.2>
+    1156:	68 12 00 00 00       	push   $0x12
+    115b:	e9 c0 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001160 <sysconf@plt>:
+    1160:	ff 25 32 6f 00 00    	jmp    *0x6f32(%rip)        # 8098 <sysconf@GLIBC_2.2.5>
+    1166:	68 13 00 00 00       	push   $0x13
+    116b:	e9 b0 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001170 <pthread_join@plt>:
+    1170:	ff 25 2a 6f 00 00    	jmp    *0x6f2a(%rip)        # 80a0 <pthread_join@GLIBC_2.34>
+    1176:	68 14 00 00 00       	push   $0x14
+    117b:	e9 a0 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001180 <pthread_mutex_init@plt>:
+    1180:	ff 25 22 6f 00 00    	jmp    *0x6f22(%rip)        # 80a8 <pthread_mutex_init@GLIBC_2.2.5>
+    1186:	68 15 00 00 00       	push   $0x15
+    118b:	e9 90 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001190 <pthread_mutex_lock@plt>:
+    1190:	ff 25 1a 6f 00 00    	jmp    *0x6f1a(%rip)        # 80b0 <pthread_mutex_lock@GLIBC_2.2.5>
+    1196:	68 16 00 00 00       	push   $0x16
+    119b:	e9 80 fe ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000011a0 <__cxa_finalize@plt>:
+    11a0:	ff 25 3a 6e 00 00    	jmp    *0x6e3a(%rip)        # 7fe0 <__cxa_finalize@GLIBC_2.2.5>
+    11a6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000011b0 <_start>:
+    11b0:	31 ed                	xor    %ebp,%ebp
+    11b2:	49 89 d1             	mov    %rdx,%r9
+    11b5:	5e                   	pop    %rsi
+    11b6:	48 89 e2             	mov    %rsp,%rdx
+    11b9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    11bd:	50                   	push   %rax
+    11be:	54                   	push   %rsp
+    11bf:	45 31 c0             	xor    %r8d,%r8d
+    11c2:	31 c9                	xor    %ecx,%ecx
+    11c4:	48 8d 3d 5a 08 00 00 	lea    0x85a(%rip),%rdi        # 1a25 <main>
+    11cb:	ff 15 ef 6d 00 00    	call   *0x6def(%rip)        # 7fc0 <__libc_start_main@GLIBC_2.34>
+    11d1:	f4                   	hlt
+    11d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    11d9:	00 00 00 
+    11dc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000011e0 <deregister_tm_clones>:
+    11e0:	    48 8d 3d e1 6e 00 00 	lea    0x6ee1(%rip),%rdi        # 80c8 <__TMC_END__>
+    11e7:	    48 8d 05 da 6e 00 00 	lea    0x6eda(%rip),%rax        # 80c8 <__TMC_END__>
+    11ee:	    48 39 f8             	cmp    %rdi,%rax
+    11f1:	/-- 74 15                	je     1208 <deregister_tm_clones+0x28>
+    11f3:	|   48 8b 05 ce 6d 00 00 	mov    0x6dce(%rip),%rax        # 7fc8 <_ITM_deregisterTMCloneTable@Base>
+    11fa:	|   48 85 c0             	test   %rax,%rax
+    11fd:	+-- 74 09                	je     1208 <deregister_tm_clones+0x28>
+    11ff:	|   ff e0                	jmp    *%rax
+    1201:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1208:	\-> c3                   	ret
+    1209:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001210 <register_tm_clones>:
+    1210:	    48 8d 3d b1 6e 00 00 	lea    0x6eb1(%rip),%rdi        # 80c8 <__TMC_END__>
+    1217:	    48 8d 35 aa 6e 00 00 	lea    0x6eaa(%rip),%rsi        # 80c8 <__TMC_END__>
+    121e:	    48 29 fe             	sub    %rdi,%rsi
+    1221:	    48 89 f0             	mov    %rsi,%rax
+    1224:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1228:	    48 c1 f8 03          	sar    $0x3,%rax
+    122c:	    48 01 c6             	add    %rax,%rsi
+    122f:	    48 d1 fe             	sar    %rsi
+    1232:	/-- 74 14                	je     1248 <register_tm_clones+0x38>
+    1234:	|   48 8b 05 9d 6d 00 00 	mov    0x6d9d(%rip),%rax        # 7fd8 <_ITM_registerTMCloneTable@Base>
+    123b:	|   48 85 c0             	test   %rax,%rax
+    123e:	+-- 74 08                	je     1248 <register_tm_clones+0x38>
+    1240:	|   ff e0                	jmp    *%rax
+    1242:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1248:	\-> c3                   	ret
+    1249:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001250 <__do_global_dtors_aux>:
+    1250:	       f3 0f 1e fa          	endbr64
+    1254:	       80 3d 8d 6e 00 00 00 	cmpb   $0x0,0x6e8d(%rip)        # 80e8 <completed.0>
+    125b:	/----- 75 2b                	jne    1288 <__do_global_dtors_aux+0x38>
+    125d:	|      55                   	push   %rbp
+    125e:	|      48 83 3d 7a 6d 00 00 	cmpq   $0x0,0x6d7a(%rip)        # 7fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1265:	|      00 
+    1266:	|      48 89 e5             	mov    %rsp,%rbp
+    1269:	|  /-- 74 0c                	je     1277 <__do_global_dtors_aux+0x27>
+    126b:	|  |   48 8b 3d 4e 6e 00 00 	mov    0x6e4e(%rip),%rdi        # 80c0 <__dso_handle>
+    1272:	|  |   e8 29 ff ff ff       	call   11a0 <__cxa_finalize@plt>
+    1277:	|  \-> e8 64 ff ff ff       	call   11e0 <deregister_tm_clones>
+    127c:	|      c6 05 65 6e 00 00 01 	movb   $0x1,0x6e65(%rip)        # 80e8 <completed.0>
+    1283:	|      5d                   	pop    %rbp
+    1284:	|      c3                   	ret
+    1285:	|      0f 1f 00             	nopl   (%rax)
+    1288:	\----> c3                   	ret
+    1289:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001290 <frame_dummy>:
+    1290:	f3 0f 1e fa          	endbr64
+    1294:	e9 77 ff ff ff       	jmp    1210 <register_tm_clones>
+    1299:	90                   	nop
+
+000000000000129a <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    129a:	55                   	push   %rbp
+    129b:	48 89 e5             	mov    %rsp,%rbp
+    129e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    12a2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    12a5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    12aa:	5d                   	pop    %rbp
+    12ab:	c3                   	ret
+
+00000000000012ac <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    12ac:	55                   	push   %rbp
+    12ad:	48 89 e5             	mov    %rsp,%rbp
+    12b0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    12b4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    12b7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return -1;
+    12bb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    12c0:	5d                   	pop    %rbp
+    12c1:	c3                   	ret
+
+00000000000012c2 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    12c2:	55                   	push   %rbp
+    12c3:	48 89 e5             	mov    %rsp,%rbp
+    12c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    12ca:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    12cd:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    return -1;
+    12d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    12d5:	5d                   	pop    %rbp
+    12d6:	c3                   	ret
+
+00000000000012d7 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    12d7:	55                   	push   %rbp
+    12d8:	48 89 e5             	mov    %rsp,%rbp
+    12db:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    12df:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    12e2:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    12e5:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    return -1;
+    12e8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    12ed:	5d                   	pop    %rbp
+    12ee:	c3                   	ret
+
+00000000000012ef <_read_r>:
+int _read_r(struct _reent *, int) {
+    12ef:	55                   	push   %rbp
+    12f0:	48 89 e5             	mov    %rsp,%rbp
+    12f3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    12f7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    12fa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    12ff:	5d                   	pop    %rbp
+    1300:	c3                   	ret
+
+0000000000001301 <_write_r>:
+int _write_r(struct _reent *, int, char *, int) {
+    1301:	55                   	push   %rbp
+    1302:	48 89 e5             	mov    %rsp,%rbp
+    1305:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1309:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    130c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1310:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+    return -1;
+    1313:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1318:	5d                   	pop    %rbp
+    1319:	c3                   	ret
+
+000000000000131a <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    131a:	55                   	push   %rbp
+    131b:	48 89 e5             	mov    %rsp,%rbp
+    131e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return -1;
+    1322:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1327:	5d                   	pop    %rbp
+    1328:	c3                   	ret
+
+0000000000001329 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1329:	55                   	push   %rbp
+    132a:	48 89 e5             	mov    %rsp,%rbp
+    132d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1331:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1334:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1339:	5d                   	pop    %rbp
+    133a:	c3                   	ret
+
+000000000000133b <alloc(unsigned long)>:
+        nel::Slice<Word> dst;
+        nel::Slice<Word> work;
+};
+
+static nel::Slice<Word> alloc(nel::Length const n_bytes)
+{
+    133b:	       55                   	push   %rbp
+    133c:	       48 89 e5             	mov    %rsp,%rbp
+    133f:	       53                   	push   %rbx
+    1340:	       48 83 ec 48          	sub    $0x48,%rsp
+    1344:	       48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    1348:	       48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    void *const p = nel::malloc_aligned(64, n_bytes);
+    134c:	       48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1350:	       48 89 c6             	mov    %rax,%rsi
+    1353:	       bf 40 00 00 00       	mov    $0x40,%edi
+    1358:	       e8 67 1a 00 00       	call   2dc4 <nel::malloc_aligned(unsigned long, unsigned long)>
+    135d:	       48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    nel::panic_if_not(p != nullptr, "out of memory");
+    1361:	       48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1365:	       b9 1f 00 00 00       	mov    $0x1f,%ecx
+    136a:	       48 8d 15 d7 3c 00 00 	lea    0x3cd7(%rip),%rdx        # 5048 <n_snaps+0x8>
+    1371:	       48 8d 35 e9 3c 00 00 	lea    0x3ce9(%rip),%rsi        # 5061 <n_snaps+0x21>
+    1378:	       48 89 c7             	mov    %rax,%rdi
+    137b:	       e8 9a 0a 00 00       	call   1e1a <nel::Context::Context(char const*, char const*, int)>
+    1380:	       48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1385:	       0f 95 c0             	setne  %al
+    1388:	       0f b6 c0             	movzbl %al,%eax
+    138b:	       48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    138f:	       48 8d 0d d1 3c 00 00 	lea    0x3cd1(%rip),%rcx        # 5067 <n_snaps+0x27>
+    1396:	       48 89 ce             	mov    %rcx,%rsi
+    1399:	       89 c7                	mov    %eax,%edi
+    139b:	       e8 b1 0a 00 00       	call   1e51 <nel::panic_if_not(bool, char const*, nel::Context const&)>
+    auto s = nel::Slice<Word>(static_cast<Word *>(p), n_bytes / sizeof(Word));
+    13a0:	       48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    13a4:	       48 c1 e8 03          	shr    $0x3,%rax
+    13a8:	       48 89 c2             	mov    %rax,%rdx
+    13ab:	       48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    13af:	       48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    13b3:	       48 89 ce             	mov    %rcx,%rsi
+    13b6:	       48 89 c7             	mov    %rax,%rdi
+    13b9:	       e8 f2 0a 00 00       	call   1eb0 <nel::Slice<unsigned long>::Slice(unsigned long*, unsigned long)>
+    for (nel::Index i = 0; i < s.len(); ++i) {
+    13be:	       48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+    13c5:	       00 
+    13c6:	   /-- eb 23                	jmp    13eb <alloc(unsigned long)+0xb0>
+        s.ptr()[i] = i;
+    13c8:	/--|-> 48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    13cc:	|  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    13d0:	|  |   48 89 c7             	mov    %rax,%rdi
+    13d3:	|  |   e8 14 0b 00 00       	call   1eec <nel::Slice<unsigned long>::ptr() const>
+    13d8:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    13dc:	|  |   48 c1 e2 03          	shl    $0x3,%rdx
+    13e0:	|  |   48 01 d0             	add    %rdx,%rax
+    13e3:	|  |   48 89 18             	mov    %rbx,(%rax)
+    for (nel::Index i = 0; i < s.len(); ++i) {
+    13e6:	|  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    13eb:	|  \-> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    13ef:	|      48 89 c7             	mov    %rax,%rdi
+    13f2:	|      e8 e3 0a 00 00       	call   1eda <nel::Slice<unsigned long>::len() const>
+    13f7:	|      48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    13fb:	|      0f 92 c0             	setb   %al
+    13fe:	|      84 c0                	test   %al,%al
+    1400:	\----- 75 c6                	jne    13c8 <alloc(unsigned long)+0x8d>
+    }
+    return s;
+    1402:	       90                   	nop
+}
+    1403:	       48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    1407:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    140b:	       c9                   	leave
+    140c:	       c3                   	ret
+
+000000000000140d <snapshot(Buffers&, bool)>:
+
+static void snapshot(Buffers &b, bool const streaming)
+{
+    140d:	       55                   	push   %rbp
+    140e:	       48 89 e5             	mov    %rsp,%rbp
+    1411:	       48 83 ec 10          	sub    $0x10,%rsp
+    1415:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1419:	       89 f0                	mov    %esi,%eax
+    141b:	       88 45 f4             	mov    %al,-0xc(%rbp)
+    if (streaming) {
+    141e:	       80 7d f4 00          	cmpb   $0x0,-0xc(%rbp)
+    1422:	/----- 74 19                	je     143d <snapshot(Buffers&, bool)+0x30>
+        b.dst.copy_from_streaming(b.src);
+    1424:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1428:	|      48 8d 50 10          	lea    0x10(%rax),%rdx
+    142c:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1430:	|      48 89 c6             	mov    %rax,%rsi
+    1433:	|      48 89 d7             	mov    %rdx,%rdi
+    1436:	|      e8 c3 0a 00 00       	call   1efe <nel::Slice<unsigned long>::copy_from_streaming(nel::Slice<unsigned long> const&)>
+    } else {
+        b.dst.copy_from(b.src);
+    }
+}
+    143b:	|  /-- eb 17                	jmp    1454 <snapshot(Buffers&, bool)+0x47>
+        b.dst.copy_from(b.src);
+    143d:	\--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1441:	   |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    1445:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1449:	   |   48 89 c6             	mov    %rax,%rsi
+    144c:	   |   48 89 d7             	mov    %rdx,%rdi
+    144f:	   |   e8 58 0b 00 00       	call   1fac <nel::Slice<unsigned long>::copy_from(nel::Slice<unsigned long> const&)>
+}
+    1454:	   \-> 90                   	nop
+    1455:	       c9                   	leave
+    1456:	       c3                   	ret
+
+0000000000001457 <touch(nel::Slice<unsigned long> const&)>:
+
+// One pass over the neighbour's working set, a line at a time.
+static Word touch(nel::Slice<Word> const &work)
+{
+    1457:	       55                   	push   %rbp
+    1458:	       48 89 e5             	mov    %rsp,%rbp
+    145b:	       48 83 ec 20          	sub    $0x20,%rsp
+    145f:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Word r = 0;
+    1463:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    146a:	       00 
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    146b:	       48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1472:	       00 
+    1473:	   /-- eb 23                	jmp    1498 <touch(nel::Slice<unsigned long> const&)+0x41>
+        r += work.ptr()[i];
+    1475:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1479:	|  |   48 89 c7             	mov    %rax,%rdi
+    147c:	|  |   e8 6b 0a 00 00       	call   1eec <nel::Slice<unsigned long>::ptr() const>
+    1481:	|  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1485:	|  |   48 c1 e2 03          	shl    $0x3,%rdx
+    1489:	|  |   48 01 d0             	add    %rdx,%rax
+    148c:	|  |   48 8b 00             	mov    (%rax),%rax
+    148f:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    1493:	|  |   48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+    1498:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    149c:	|      48 89 c7             	mov    %rax,%rdi
+    149f:	|      e8 36 0a 00 00       	call   1eda <nel::Slice<unsigned long>::len() const>
+    14a4:	|      48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    14a8:	|      0f 92 c0             	setb   %al
+    14ab:	|      84 c0                	test   %al,%al
+    14ad:	\----- 75 c6                	jne    1475 <touch(nel::Slice<unsigned long> const&)+0x1e>
+    }
+    return r;
+    14af:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    14b3:	       c9                   	leave
+    14b4:	       c3                   	ret
+    14b5:	       90                   	nop
+
+00000000000014b6 <one_thread(Buffers&, bool, char const*)::{lambda()#1}::operator()() const>:
+    long unsigned int t_copy = 0;
+    long unsigned int t_reread = 0;
+    Word r = 0;
+    for (nel::Index k = 0; k < n_snaps; ++k) {
+        r += touch(b.work);
+        t_copy += bench::time_ns([&b, streaming]() { snapshot(b, streaming); });
+    14b6:	55                   	push   %rbp
+    14b7:	48 89 e5             	mov    %rsp,%rbp
+    14ba:	48 83 ec 10          	sub    $0x10,%rsp
+    14be:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    14c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14c6:	0f b6 40 08          	movzbl 0x8(%rax),%eax
+    14ca:	0f b6 d0             	movzbl %al,%edx
+    14cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14d1:	48 8b 00             	mov    (%rax),%rax
+    14d4:	89 d6                	mov    %edx,%esi
+    14d6:	48 89 c7             	mov    %rax,%rdi
+    14d9:	e8 2f ff ff ff       	call   140d <snapshot(Buffers&, bool)>
+    14de:	90                   	nop
+    14df:	c9                   	leave
+    14e0:	c3                   	ret
+    14e1:	90                   	nop
+
+00000000000014e2 <one_thread(Buffers&, bool, char const*)::{lambda()#2}::operator()() const>:
+        t_reread += bench::time_ns([&b, &r]() { r += touch(b.work); });
+    14e2:	55                   	push   %rbp
+    14e3:	48 89 e5             	mov    %rsp,%rbp
+    14e6:	48 83 ec 10          	sub    $0x10,%rsp
+    14ea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    14ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14f2:	48 8b 00             	mov    (%rax),%rax
+    14f5:	48 83 c0 20          	add    $0x20,%rax
+    14f9:	48 89 c7             	mov    %rax,%rdi
+    14fc:	e8 56 ff ff ff       	call   1457 <touch(nel::Slice<unsigned long> const&)>
+    1501:	48 89 c2             	mov    %rax,%rdx
+    1504:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1508:	48 8b 40 08          	mov    0x8(%rax),%rax
+    150c:	48 8b 08             	mov    (%rax),%rcx
+    150f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1513:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1517:	48 01 ca             	add    %rcx,%rdx
+    151a:	48 89 10             	mov    %rdx,(%rax)
+    151d:	90                   	nop
+    151e:	c9                   	leave
+    151f:	c3                   	ret
+
+0000000000001520 <one_thread(Buffers&, bool, char const*)>:
+{
+    1520:	       55                   	push   %rbp
+    1521:	       48 89 e5             	mov    %rsp,%rbp
+    1524:	       48 83 ec 70          	sub    $0x70,%rsp
+    1528:	       48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+    152c:	       89 f0                	mov    %esi,%eax
+    152e:	       48 89 55 98          	mov    %rdx,-0x68(%rbp)
+    1532:	       88 45 a4             	mov    %al,-0x5c(%rbp)
+    long unsigned int t_copy = 0;
+    1535:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    153c:	       00 
+    long unsigned int t_reread = 0;
+    153d:	       48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1544:	       00 
+    Word r = 0;
+    1545:	       48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+    154c:	       00 
+    for (nel::Index k = 0; k < n_snaps; ++k) {
+    154d:	       48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+    1554:	       00 
+    1555:	   /-- eb 5f                	jmp    15b6 <one_thread(Buffers&, bool, char const*)+0x96>
+        r += touch(b.work);
+    1557:	/--|-> 48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    155b:	|  |   48 83 c0 20          	add    $0x20,%rax
+    155f:	|  |   48 89 c7             	mov    %rax,%rdi
+    1562:	|  |   e8 f0 fe ff ff       	call   1457 <touch(nel::Slice<unsigned long> const&)>
+    1567:	|  |   48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    156b:	|  |   48 01 d0             	add    %rdx,%rax
+    156e:	|  |   48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        t_copy += bench::time_ns([&b, streaming]() { snapshot(b, streaming); });
+    1572:	|  |   48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1576:	|  |   48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    157a:	|  |   0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+    157e:	|  |   88 45 c8             	mov    %al,-0x38(%rbp)
+    1581:	|  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1585:	|  |   48 89 c7             	mov    %rax,%rdi
+    1588:	|  |   e8 76 06 00 00       	call   1c03 <unsigned long bench::time_ns<one_thread(Buffers&, bool, char const*)::{lambda()#1}>(one_thread(Buffers&, bool, char const*)::{lambda()#1}&&)>
+    158d:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+        t_reread += bench::time_ns([&b, &r]() { r += touch(b.work); });
+    1591:	|  |   48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1595:	|  |   48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    1599:	|  |   48 8d 45 b8          	lea    -0x48(%rbp),%rax
+    159d:	|  |   48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    15a1:	|  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    15a5:	|  |   48 89 c7             	mov    %rax,%rdi
+    15a8:	|  |   e8 82 06 00 00       	call   1c2f <unsigned long bench::time_ns<one_thread(Buffers&, bool, char const*)::{lambda()#2}>(one_thread(Buffers&, bool, char const*)::{lambda()#2}&&)>
+    15ad:	|  |   48 01 45 f0          	add    %rax,-0x10(%rbp)
+    for (nel::Index k = 0; k < n_snaps; ++k) {
+    15b1:	|  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    15b6:	|  \-> 48 83 7d e8 04       	cmpq   $0x4,-0x18(%rbp)
+    15bb:	\----- 76 9a                	jbe    1557 <one_thread(Buffers&, bool, char const*)+0x37>
+    }
+    nel::log << name << '\n';
+    15bd:	       48 8b 45 98          	mov    -0x68(%rbp),%rax
+    15c1:	       48 89 c6             	mov    %rax,%rsi
+    15c4:	       48 8d 05 1e 6b 00 00 	lea    0x6b1e(%rip),%rax        # 80e9 <nel::log>
+    15cb:	       48 89 c7             	mov    %rax,%rdi
+    15ce:	       e8 a8 18 00 00       	call   2e7b <nel::operator<<(nel::Log&, char const*)>
+    15d3:	       be 0a 00 00 00       	mov    $0xa,%esi
+    15d8:	       48 89 c7             	mov    %rax,%rdi
+    15db:	       e8 6f 18 00 00       	call   2e4f <nel::operator<<(nel::Log&, char)>
+    bench::report("  snapshot        ", t_copy, n_snaps * n_state);
+    15e0:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15e4:	       ba 00 00 80 3e       	mov    $0x3e800000,%edx
+    15e9:	       48 89 c6             	mov    %rax,%rsi
+    15ec:	       48 8d 05 82 3a 00 00 	lea    0x3a82(%rip),%rax        # 5075 <n_snaps+0x35>
+    15f3:	       48 89 c7             	mov    %rax,%rdi
+    15f6:	       e8 2c 07 00 00       	call   1d27 <bench::report(char const*, unsigned long, unsigned long)>
+    bench::report("  re-read 4MB     ", t_reread, n_snaps * n_work);
+    15fb:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15ff:	       ba 00 00 40 01       	mov    $0x1400000,%edx
+    1604:	       48 89 c6             	mov    %rax,%rsi
+    1607:	       48 8d 05 7a 3a 00 00 	lea    0x3a7a(%rip),%rax        # 5088 <n_snaps+0x48>
+    160e:	       48 89 c7             	mov    %rax,%rdi
+    1611:	       e8 11 07 00 00       	call   1d27 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << r << '\n';
+    1616:	       48 8d 05 7e 3a 00 00 	lea    0x3a7e(%rip),%rax        # 509b <n_snaps+0x5b>
+    161d:	       48 89 c6             	mov    %rax,%rsi
+    1620:	       48 8d 05 c2 6a 00 00 	lea    0x6ac2(%rip),%rax        # 80e9 <nel::log>
+    1627:	       48 89 c7             	mov    %rax,%rdi
+    162a:	       e8 4c 18 00 00       	call   2e7b <nel::operator<<(nel::Log&, char const*)>
+    162f:	       48 89 c2             	mov    %rax,%rdx
+    1632:	       48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    1636:	       48 89 c6             	mov    %rax,%rsi
+    1639:	       48 89 d7             	mov    %rdx,%rdi
+    163c:	       e8 45 19 00 00       	call   2f86 <nel::operator<<(nel::Log&, unsigned long)>
+    1641:	       be 0a 00 00 00       	mov    $0xa,%esi
+    1646:	       48 89 c7             	mov    %rax,%rdi
+    1649:	       e8 01 18 00 00       	call   2e4f <nel::operator<<(nel::Log&, char)>
+}
+    164e:	       90                   	nop
+    164f:	       c9                   	leave
+    1650:	       c3                   	ret
+    1651:	       90                   	nop
+
+0000000000001652 <baseline_reread(Buffers&)::{lambda()#1}::operator()() const>:
+
+static void baseline_reread(Buffers &b)
+{
+    Word r = touch(b.work);
+    auto t = bench::time_ns([&b, &r]() {
+    1652:	       55                   	push   %rbp
+    1653:	       48 89 e5             	mov    %rsp,%rbp
+    1656:	       48 83 ec 20          	sub    $0x20,%rsp
+    165a:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+        for (nel::Index k = 0; k < n_snaps; ++k) {
+    165e:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1665:	       00 
+    1666:	   /-- eb 34                	jmp    169c <baseline_reread(Buffers&)::{lambda()#1}::operator()() const+0x4a>
+    auto t = bench::time_ns([&b, &r]() {
+    1668:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    166c:	|  |   48 8b 00             	mov    (%rax),%rax
+            r += touch(b.work);
+    166f:	|  |   48 83 c0 20          	add    $0x20,%rax
+    1673:	|  |   48 89 c7             	mov    %rax,%rdi
+    1676:	|  |   e8 dc fd ff ff       	call   1457 <touch(nel::Slice<unsigned long> const&)>
+    167b:	|  |   48 89 c2             	mov    %rax,%rdx
+    auto t = bench::time_ns([&b, &r]() {
+    167e:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1682:	|  |   48 8b 40 08          	mov    0x8(%rax),%rax
+            r += touch(b.work);
+    1686:	|  |   48 8b 08             	mov    (%rax),%rcx
+    auto t = bench::time_ns([&b, &r]() {
+    1689:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    168d:	|  |   48 8b 40 08          	mov    0x8(%rax),%rax
+            r += touch(b.work);
+    1691:	|  |   48 01 ca             	add    %rcx,%rdx
+    1694:	|  |   48 89 10             	mov    %rdx,(%rax)
+        for (nel::Index k = 0; k < n_snaps; ++k) {
+    1697:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    169c:	|  \-> 48 83 7d f8 04       	cmpq   $0x4,-0x8(%rbp)
+    16a1:	\----- 76 c5                	jbe    1668 <baseline_reread(Buffers&)::{lambda()#1}::operator()() const+0x16>
+        }
+    });
+    16a3:	       90                   	nop
+    16a4:	       90                   	nop
+    16a5:	       c9                   	leave
+    16a6:	       c3                   	ret
+
+00000000000016a7 <baseline_reread(Buffers&)>:
+{
+    16a7:	55                   	push   %rbp
+    16a8:	48 89 e5             	mov    %rsp,%rbp
+    16ab:	48 83 ec 40          	sub    $0x40,%rsp
+    16af:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    Word r = touch(b.work);
+    16b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    16b7:	48 83 c0 20          	add    $0x20,%rax
+    16bb:	48 89 c7             	mov    %rax,%rdi
+    16be:	e8 94 fd ff ff       	call   1457 <touch(nel::Slice<unsigned long> const&)>
+    16c3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    auto t = bench::time_ns([&b, &r]() {
+    16c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    16cb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    16cf:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+    16d3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    16d7:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    16db:	48 89 c7             	mov    %rax,%rdi
+    16de:	e8 78 05 00 00       	call   1c5b <unsigned long bench::time_ns<baseline_reread(Buffers&)::{lambda()#1}>(baseline_reread(Buffers&)::{lambda()#1}&&)>
+    16e3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    nel::log << "no snapshot\n";
+    16e7:	48 8d 05 b5 39 00 00 	lea    0x39b5(%rip),%rax        # 50a3 <n_snaps+0x63>
+    16ee:	48 89 c6             	mov    %rax,%rsi
+    16f1:	48 8d 05 f1 69 00 00 	lea    0x69f1(%rip),%rax        # 80e9 <nel::log>
+    16f8:	48 89 c7             	mov    %rax,%rdi
+    16fb:	e8 7b 17 00 00       	call   2e7b <nel::operator<<(nel::Log&, char const*)>
+    bench::report("  re-read 4MB     ", t, n_snaps * n_work);
+    1700:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1704:	ba 00 00 40 01       	mov    $0x1400000,%edx
+    1709:	48 89 c6             	mov    %rax,%rsi
+    170c:	48 8d 05 75 39 00 00 	lea    0x3975(%rip),%rax        # 5088 <n_snaps+0x48>
+    1713:	48 89 c7             	mov    %rax,%rdi
+    1716:	e8 0c 06 00 00       	call   1d27 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << r << '\n';
+    171b:	48 8d 05 79 39 00 00 	lea    0x3979(%rip),%rax        # 509b <n_snaps+0x5b>
+    1722:	48 89 c6             	mov    %rax,%rsi
+    1725:	48 8d 05 bd 69 00 00 	lea    0x69bd(%rip),%rax        # 80e9 <nel::log>
+    172c:	48 89 c7             	mov    %rax,%rdi
+    172f:	e8 47 17 00 00       	call   2e7b <nel::operator<<(nel::Log&, char const*)>
+    1734:	48 89 c2             	mov    %rax,%rdx
+    1737:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    173b:	48 89 c6             	mov    %rax,%rsi
+    173e:	48 89 d7             	mov    %rdx,%rdi
+    1741:	e8 40 18 00 00       	call   2f86 <nel::operator<<(nel::Log&, unsigned long)>
+    1746:	be 0a 00 00 00       	mov    $0xa,%esi
+    174b:	48 89 c7             	mov    %rax,%rdi
+    174e:	e8 fc 16 00 00       	call   2e4f <nel::operator<<(nel::Log&, char)>
+}
+    1753:	90                   	nop
+    1754:	c9                   	leave
+    1755:	c3                   	ret
+
+0000000000001756 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}::operator()(unsigned long) const>:
+    int started = 0;
+    bool done = false;
+    nel::Count passes = 0;
+    long unsigned int t_neighbour = 0;
+    Word r = 0;
+    auto task = [&](nel::Index const chunk) {
+    1756:	             55                   	push   %rbp
+    1757:	             48 89 e5             	mov    %rsp,%rbp
+    175a:	             48 83 ec 30          	sub    $0x30,%rsp
+    175e:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1762:	             48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+        __atomic_fetch_add(&started, 1, __ATOMIC_RELAXED);
+    1766:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    176a:	             48 8b 00             	mov    (%rax),%rax
+    176d:	             f0 83 00 01          	lock addl $0x1,(%rax)
+        while (__atomic_load_n(&started, __ATOMIC_RELAXED) < 2) {
+    1771:	             90                   	nop
+        __atomic_fetch_add(&started, 1, __ATOMIC_RELAXED);
+    1772:	         /-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1776:	         |   48 8b 00             	mov    (%rax),%rax
+        while (__atomic_load_n(&started, __ATOMIC_RELAXED) < 2) {
+    1779:	         |   8b 00                	mov    (%rax),%eax
+    177b:	         |   83 f8 01             	cmp    $0x1,%eax
+    177e:	         |   0f 9e c0             	setle  %al
+    1781:	         |   84 c0                	test   %al,%al
+    1783:	         \-- 75 ed                	jne    1772 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}::operator()(unsigned long) const+0x1c>
+        }
+        if (chunk == 0) {
+    1785:	             48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    178a:	/----------- 0f 85 88 00 00 00    	jne    1818 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}::operator()(unsigned long) const+0xc2>
+            long unsigned int const b_ns = bench::now_ns();
+    1790:	|            e8 65 05 00 00       	call   1cfa <bench::now_ns()>
+    1795:	|            48 89 45 e8          	mov    %rax,-0x18(%rbp)
+            for (nel::Index k = 0; k < n_snaps; ++k) {
+    1799:	|            48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    17a0:	|            00 
+    17a1:	|     /----- eb 38                	jmp    17db <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}::operator()(unsigned long) const+0x85>
+                if (mode != Snap::None) { snapshot(b, mode == Snap::Streaming); }
+    17a3:	|  /--|----> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17a7:	|  |  |      48 8b 40 08          	mov    0x8(%rax),%rax
+    17ab:	|  |  |      8b 00                	mov    (%rax),%eax
+    17ad:	|  |  |      85 c0                	test   %eax,%eax
+    17af:	|  |  |  /-- 74 25                	je     17d6 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}::operator()(unsigned long) const+0x80>
+    17b1:	|  |  |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17b5:	|  |  |  |   48 8b 40 08          	mov    0x8(%rax),%rax
+    17b9:	|  |  |  |   8b 00                	mov    (%rax),%eax
+    17bb:	|  |  |  |   83 f8 02             	cmp    $0x2,%eax
+    17be:	|  |  |  |   0f 94 c0             	sete   %al
+    17c1:	|  |  |  |   0f b6 d0             	movzbl %al,%edx
+    17c4:	|  |  |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17c8:	|  |  |  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    17cc:	|  |  |  |   89 d6                	mov    %edx,%esi
+    17ce:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    17d1:	|  |  |  |   e8 37 fc ff ff       	call   140d <snapshot(Buffers&, bool)>
+            for (nel::Index k = 0; k < n_snaps; ++k) {
+    17d6:	|  |  |  \-> 48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    17db:	|  |  \----> 48 83 7d f8 04       	cmpq   $0x4,-0x8(%rbp)
+    17e0:	|  \-------- 76 c1                	jbe    17a3 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}::operator()(unsigned long) const+0x4d>
+                if (mode != Snap::None) { snapshot(b, mode == Snap::Streaming); }
+    17e2:	|            48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17e6:	|            48 8b 40 08          	mov    0x8(%rax),%rax
+            }
+            if (mode == Snap::None) {
+    17ea:	|            8b 00                	mov    (%rax),%eax
+    17ec:	|            85 c0                	test   %eax,%eax
+    17ee:	|     /----- 75 17                	jne    1807 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}::operator()(unsigned long) const+0xb1>
+                while (bench::now_ns() - b_ns < n_snaps * n_state / 20) {
+    17f0:	|     |      90                   	nop
+    17f1:	|     |  /-> e8 04 05 00 00       	call   1cfa <bench::now_ns()>
+    17f6:	|     |  |   48 2b 45 e8          	sub    -0x18(%rbp),%rax
+    17fa:	|     |  |   48 3d ff ff 1f 03    	cmp    $0x31fffff,%rax
+    1800:	|     |  |   0f 96 c0             	setbe  %al
+    1803:	|     |  |   84 c0                	test   %al,%al
+    1805:	|     |  \-- 75 ea                	jne    17f1 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}::operator()(unsigned long) const+0x9b>
+                }
+            }
+            __atomic_store_n(&done, true, __ATOMIC_RELEASE);
+    1807:	|     \----> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    180b:	|            48 8b 40 18          	mov    0x18(%rax),%rax
+    180f:	|            ba 01 00 00 00       	mov    $0x1,%edx
+    1814:	|            88 10                	mov    %dl,(%rax)
+                r += touch(b.work);
+                passes += 1;
+            }
+            t_neighbour = bench::now_ns() - b_ns;
+        }
+    };
+    1816:	|  /-------- eb 7d                	jmp    1895 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}::operator()(unsigned long) const+0x13f>
+            long unsigned int const b_ns = bench::now_ns();
+    1818:	\--|-------> e8 dd 04 00 00       	call   1cfa <bench::now_ns()>
+    181d:	   |         48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            while (!__atomic_load_n(&done, __ATOMIC_ACQUIRE)) {
+    1821:	   |     /-- eb 4a                	jmp    186d <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}::operator()(unsigned long) const+0x117>
+                if (mode != Snap::None) { snapshot(b, mode == Snap::Streaming); }
+    1823:	   |  /--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1827:	   |  |  |   48 8b 40 10          	mov    0x10(%rax),%rax
+                r += touch(b.work);
+    182b:	   |  |  |   48 83 c0 20          	add    $0x20,%rax
+    182f:	   |  |  |   48 89 c7             	mov    %rax,%rdi
+    1832:	   |  |  |   e8 20 fc ff ff       	call   1457 <touch(nel::Slice<unsigned long> const&)>
+    1837:	   |  |  |   48 89 c2             	mov    %rax,%rdx
+    183a:	   |  |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    183e:	   |  |  |   48 8b 40 20          	mov    0x20(%rax),%rax
+    1842:	   |  |  |   48 8b 08             	mov    (%rax),%rcx
+    1845:	   |  |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1849:	   |  |  |   48 8b 40 20          	mov    0x20(%rax),%rax
+    184d:	   |  |  |   48 01 ca             	add    %rcx,%rdx
+    1850:	   |  |  |   48 89 10             	mov    %rdx,(%rax)
+                passes += 1;
+    1853:	   |  |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1857:	   |  |  |   48 8b 40 28          	mov    0x28(%rax),%rax
+    185b:	   |  |  |   48 8b 10             	mov    (%rax),%rdx
+    185e:	   |  |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1862:	   |  |  |   48 8b 40 28          	mov    0x28(%rax),%rax
+    1866:	   |  |  |   48 83 c2 01          	add    $0x1,%rdx
+    186a:	   |  |  |   48 89 10             	mov    %rdx,(%rax)
+            __atomic_store_n(&done, true, __ATOMIC_RELEASE);
+    186d:	   |  |  \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1871:	   |  |      48 8b 40 18          	mov    0x18(%rax),%rax
+            while (!__atomic_load_n(&done, __ATOMIC_ACQUIRE)) {
+    1875:	   |  |      0f b6 00             	movzbl (%rax),%eax
+    1878:	   |  |      84 c0                	test   %al,%al
+    187a:	   |  |      0f 94 c0             	sete   %al
+    187d:	   |  |      84 c0                	test   %al,%al
+    187f:	   |  \----- 75 a2                	jne    1823 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}::operator()(unsigned long) const+0xcd>
+            t_neighbour = bench::now_ns() - b_ns;
+    1881:	   |         e8 74 04 00 00       	call   1cfa <bench::now_ns()>
+    1886:	   |         48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    188a:	   |         48 8b 52 30          	mov    0x30(%rdx),%rdx
+    188e:	   |         48 2b 45 f0          	sub    -0x10(%rbp),%rax
+    1892:	   |         48 89 02             	mov    %rax,(%rdx)
+    };
+    1895:	   \-------> 90                   	nop
+    1896:	             c9                   	leave
+    1897:	             c3                   	ret
+
+0000000000001898 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)>:
+{
+    1898:	55                   	push   %rbp
+    1899:	48 89 e5             	mov    %rsp,%rbp
+    189c:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+    18a3:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+    18aa:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+    18b1:	89 95 6c ff ff ff    	mov    %edx,-0x94(%rbp)
+    18b7:	48 89 8d 60 ff ff ff 	mov    %rcx,-0xa0(%rbp)
+    int started = 0;
+    18be:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    bool done = false;
+    18c5:	c6 45 d3 00          	movb   $0x0,-0x2d(%rbp)
+    nel::Count passes = 0;
+    18c9:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+    18d0:	00 
+    long unsigned int t_neighbour = 0;
+    18d1:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+    18d8:	00 
+    Word r = 0;
+    18d9:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+    18e0:	00 
+    };
+    18e1:	48 8d 45 d4          	lea    -0x2c(%rbp),%rax
+    18e5:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+    18e9:	48 8d 85 6c ff ff ff 	lea    -0x94(%rbp),%rax
+    18f0:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+    18f4:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+    18fb:	48 89 45 90          	mov    %rax,-0x70(%rbp)
+    18ff:	48 8d 45 d3          	lea    -0x2d(%rbp),%rax
+    1903:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+    1907:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+    190b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+    190f:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    1913:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    1917:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    191b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    pool.run(2, task).unwrap();
+    191f:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+    1923:	48 8d 55 80          	lea    -0x80(%rbp),%rdx
+    1927:	48 8b b5 78 ff ff ff 	mov    -0x88(%rbp),%rsi
+    192e:	48 89 d1             	mov    %rdx,%rcx
+    1931:	ba 02 00 00 00       	mov    $0x2,%edx
+    1936:	48 89 c7             	mov    %rax,%rdi
+    1939:	e8 4a 03 00 00       	call   1c88 <nel::Result<void, nel::par::ParError> nel::par::Pool::run<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(unsigned long, two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&)>
+    193e:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1942:	b9 7d 00 00 00       	mov    $0x7d,%ecx
+    1947:	48 8d 15 fa 36 00 00 	lea    0x36fa(%rip),%rdx        # 5048 <n_snaps+0x8>
+    194e:	48 8d 35 5b 37 00 00 	lea    0x375b(%rip),%rsi        # 50b0 <n_snaps+0x70>
+    1955:	48 89 c7             	mov    %rax,%rdi
+    1958:	e8 bd 04 00 00       	call   1e1a <nel::Context::Context(char const*, char const*, int)>
+    195d:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1961:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+    1965:	48 89 d6             	mov    %rdx,%rsi
+    1968:	48 89 c7             	mov    %rax,%rdi
+    196b:	e8 a0 07 00 00       	call   2110 <nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)>
+    1970:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+    1974:	48 89 c7             	mov    %rax,%rdi
+    1977:	e8 de 06 00 00       	call   205a <nel::Result<void, nel::par::ParError>::~Result()>
+    nel::log << name << '\n';
+    197c:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+    1983:	48 89 c6             	mov    %rax,%rsi
+    1986:	48 8d 05 5c 67 00 00 	lea    0x675c(%rip),%rax        # 80e9 <nel::log>
+    198d:	48 89 c7             	mov    %rax,%rdi
+    1990:	e8 e6 14 00 00       	call   2e7b <nel::operator<<(nel::Log&, char const*)>
+    1995:	be 0a 00 00 00       	mov    $0xa,%esi
+    199a:	48 89 c7             	mov    %rax,%rdi
+    199d:	e8 ad 14 00 00       	call   2e4f <nel::operator<<(nel::Log&, char)>
+    bench::report("  neighbour 4MB   ", t_neighbour, passes * n_work);
+    19a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    19a6:	48 c1 e0 16          	shl    $0x16,%rax
+    19aa:	48 89 c2             	mov    %rax,%rdx
+    19ad:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    19b1:	48 89 c6             	mov    %rax,%rsi
+    19b4:	48 8d 05 01 37 00 00 	lea    0x3701(%rip),%rax        # 50bc <n_snaps+0x7c>
+    19bb:	48 89 c7             	mov    %rax,%rdi
+    19be:	e8 64 03 00 00       	call   1d27 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  passes: " << passes << " sum: " << r << '\n';
+    19c3:	48 8d 05 05 37 00 00 	lea    0x3705(%rip),%rax        # 50cf <n_snaps+0x8f>
+    19ca:	48 89 c6             	mov    %rax,%rsi
+    19cd:	48 8d 05 15 67 00 00 	lea    0x6715(%rip),%rax        # 80e9 <nel::log>
+    19d4:	48 89 c7             	mov    %rax,%rdi
+    19d7:	e8 9f 14 00 00       	call   2e7b <nel::operator<<(nel::Log&, char const*)>
+    19dc:	48 89 c2             	mov    %rax,%rdx
+    19df:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    19e3:	48 89 c6             	mov    %rax,%rsi
+    19e6:	48 89 d7             	mov    %rdx,%rdi
+    19e9:	e8 98 15 00 00       	call   2f86 <nel::operator<<(nel::Log&, unsigned long)>
+    19ee:	48 89 c2             	mov    %rax,%rdx
+    19f1:	48 8d 05 e2 36 00 00 	lea    0x36e2(%rip),%rax        # 50da <n_snaps+0x9a>
+    19f8:	48 89 c6             	mov    %rax,%rsi
+    19fb:	48 89 d7             	mov    %rdx,%rdi
+    19fe:	e8 78 14 00 00       	call   2e7b <nel::operator<<(nel::Log&, char const*)>
+    1a03:	48 89 c2             	mov    %rax,%rdx
+    1a06:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    1a0a:	48 89 c6             	mov    %rax,%rsi
+    1a0d:	48 89 d7             	mov    %rdx,%rdi
+    1a10:	e8 71 15 00 00       	call   2f86 <nel::operator<<(nel::Log&, unsigned long)>
+    1a15:	be 0a 00 00 00       	mov    $0xa,%esi
+    1a1a:	48 89 c7             	mov    %rax,%rdi
+    1a1d:	e8 2d 14 00 00       	call   2e4f <nel::operator<<(nel::Log&, char)>
+}
+    1a22:	90                   	nop
+    1a23:	c9                   	leave
+    1a24:	c3                   	ret
+
+0000000000001a25 <main>:
+
+int main()
+{
+    1a25:	       55                   	push   %rbp
+    1a26:	       48 89 e5             	mov    %rsp,%rbp
+    1a29:	       48 83 ec 70          	sub    $0x70,%rsp
+    Buffers b = {alloc(n_state), alloc(n_state), alloc(n_work)};
+    1a2d:	       48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    1a31:	       be 00 00 80 0c       	mov    $0xc800000,%esi
+    1a36:	       48 89 c7             	mov    %rax,%rdi
+    1a39:	       e8 fd f8 ff ff       	call   133b <alloc(unsigned long)>
+    1a3e:	       48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    1a42:	       be 00 00 80 0c       	mov    $0xc800000,%esi
+    1a47:	       48 89 c7             	mov    %rax,%rdi
+    1a4a:	       e8 ec f8 ff ff       	call   133b <alloc(unsigned long)>
+    1a4f:	       48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1a53:	       be 00 00 40 00       	mov    $0x400000,%esi
+    1a58:	       48 89 c7             	mov    %rax,%rdi
+    1a5b:	       e8 db f8 ff ff       	call   133b <alloc(unsigned long)>
+
+    nel::log << "one thread, snapshot then re-read the neighbour's working set\n";
+    1a60:	       48 8d 05 81 36 00 00 	lea    0x3681(%rip),%rax        # 50e8 <n_snaps+0xa8>
+    1a67:	       48 89 c6             	mov    %rax,%rsi
+    1a6a:	       48 8d 05 78 66 00 00 	lea    0x6678(%rip),%rax        # 80e9 <nel::log>
+    1a71:	       48 89 c7             	mov    %rax,%rdi
+    1a74:	       e8 02 14 00 00       	call   2e7b <nel::operator<<(nel::Log&, char const*)>
+    baseline_reread(b);
+    1a79:	       48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    1a7d:	       48 89 c7             	mov    %rax,%rdi
+    1a80:	       e8 22 fc ff ff       	call   16a7 <baseline_reread(Buffers&)>
+    one_thread(b, false, "copy_from");
+    1a85:	       48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    1a89:	       48 8d 15 97 36 00 00 	lea    0x3697(%rip),%rdx        # 5127 <n_snaps+0xe7>
+    1a90:	       be 00 00 00 00       	mov    $0x0,%esi
+    1a95:	       48 89 c7             	mov    %rax,%rdi
+    1a98:	       e8 83 fa ff ff       	call   1520 <one_thread(Buffers&, bool, char const*)>
+    one_thread(b, true, "copy_from_streaming");
+    1a9d:	       48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    1aa1:	       48 8d 15 89 36 00 00 	lea    0x3689(%rip),%rdx        # 5131 <n_snaps+0xf1>
+    1aa8:	       be 01 00 00 00       	mov    $0x1,%esi
+    1aad:	       48 89 c7             	mov    %rax,%rdi
+    1ab0:	       e8 6b fa ff ff       	call   1520 <one_thread(Buffers&, bool, char const*)>
+
+    if (nel::par::Pool::available_parallelism() < 2) {
+    1ab5:	       e8 74 18 00 00       	call   332e <nel::par::Pool::available_parallelism()>
+    1aba:	       48 83 f8 01          	cmp    $0x1,%rax
+    1abe:	       0f 96 c0             	setbe  %al
+    1ac1:	       84 c0                	test   %al,%al
+    1ac3:	   /-- 74 1e                	je     1ae3 <main+0xbe>
+        nel::log << "one cpu, no neighbour thread\n";
+    1ac5:	   |   48 8d 05 79 36 00 00 	lea    0x3679(%rip),%rax        # 5145 <n_snaps+0x105>
+    1acc:	   |   48 89 c6             	mov    %rax,%rsi
+    1acf:	   |   48 8d 05 13 66 00 00 	lea    0x6613(%rip),%rax        # 80e9 <nel::log>
+    1ad6:	   |   48 89 c7             	mov    %rax,%rdi
+    1ad9:	   |   e8 9d 13 00 00       	call   2e7b <nel::operator<<(nel::Log&, char const*)>
+    1ade:	/--|-- e9 d5 00 00 00       	jmp    1bb8 <main+0x193>
+    } else {
+        auto pool = nel::par::Pool::try_new(2).unwrap();
+    1ae3:	|  \-> 48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1ae7:	|      be 02 00 00 00       	mov    $0x2,%esi
+    1aec:	|      48 89 c7             	mov    %rax,%rdi
+    1aef:	|      e8 64 18 00 00       	call   3358 <nel::par::Pool::try_new(unsigned long)>
+    1af4:	|      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1af8:	|      b9 8f 00 00 00       	mov    $0x8f,%ecx
+    1afd:	|      48 8d 15 44 35 00 00 	lea    0x3544(%rip),%rdx        # 5048 <n_snaps+0x8>
+    1b04:	|      48 8d 35 58 36 00 00 	lea    0x3658(%rip),%rsi        # 5163 <n_snaps+0x123>
+    1b0b:	|      48 89 c7             	mov    %rax,%rdi
+    1b0e:	|      e8 07 03 00 00       	call   1e1a <nel::Context::Context(char const*, char const*, int)>
+    1b13:	|      48 8d 45 98          	lea    -0x68(%rbp),%rax
+    1b17:	|      48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1b1b:	|      48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    1b1f:	|      48 89 ce             	mov    %rcx,%rsi
+    1b22:	|      48 89 c7             	mov    %rax,%rdi
+    1b25:	|      e8 08 07 00 00       	call   2232 <nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)>
+    1b2a:	|      48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1b2e:	|      48 89 c7             	mov    %rax,%rdi
+    1b31:	|      e8 22 06 00 00       	call   2158 <nel::Result<nel::par::Pool, nel::par::ParError>::~Result()>
+        nel::log << "two threads, the neighbour reading while snapshots run\n";
+    1b36:	|      48 8d 05 2b 36 00 00 	lea    0x362b(%rip),%rax        # 5168 <n_snaps+0x128>
+    1b3d:	|      48 89 c6             	mov    %rax,%rsi
+    1b40:	|      48 8d 05 a2 65 00 00 	lea    0x65a2(%rip),%rax        # 80e9 <nel::log>
+    1b47:	|      48 89 c7             	mov    %rax,%rdi
+    1b4a:	|      e8 2c 13 00 00       	call   2e7b <nel::operator<<(nel::Log&, char const*)>
+        two_threads(pool, b, Snap::None, "no snapshot");
+    1b4f:	|      48 8d 75 a0          	lea    -0x60(%rbp),%rsi
+    1b53:	|      48 8d 45 98          	lea    -0x68(%rbp),%rax
+    1b57:	|      48 8d 15 42 36 00 00 	lea    0x3642(%rip),%rdx        # 51a0 <n_snaps+0x160>
+    1b5e:	|      48 89 d1             	mov    %rdx,%rcx
+    1b61:	|      ba 00 00 00 00       	mov    $0x0,%edx
+    1b66:	|      48 89 c7             	mov    %rax,%rdi
+    1b69:	|      e8 2a fd ff ff       	call   1898 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)>
+        two_threads(pool, b, Snap::Copy, "copy_from");
+    1b6e:	|      48 8d 75 a0          	lea    -0x60(%rbp),%rsi
+    1b72:	|      48 8d 45 98          	lea    -0x68(%rbp),%rax
+    1b76:	|      48 8d 15 aa 35 00 00 	lea    0x35aa(%rip),%rdx        # 5127 <n_snaps+0xe7>
+    1b7d:	|      48 89 d1             	mov    %rdx,%rcx
+    1b80:	|      ba 01 00 00 00       	mov    $0x1,%edx
+    1b85:	|      48 89 c7             	mov    %rax,%rdi
+    1b88:	|      e8 0b fd ff ff       	call   1898 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)>
+        two_threads(pool, b, Snap::Streaming, "copy_from_streaming");
+    1b8d:	|      48 8d 75 a0          	lea    -0x60(%rbp),%rsi
+    1b91:	|      48 8d 45 98          	lea    -0x68(%rbp),%rax
+    1b95:	|      48 8d 15 95 35 00 00 	lea    0x3595(%rip),%rdx        # 5131 <n_snaps+0xf1>
+    1b9c:	|      48 89 d1             	mov    %rdx,%rcx
+    1b9f:	|      ba 02 00 00 00       	mov    $0x2,%edx
+    1ba4:	|      48 89 c7             	mov    %rax,%rdi
+    1ba7:	|      e8 ec fc ff ff       	call   1898 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)>
+    }
+    1bac:	|      48 8d 45 98          	lea    -0x68(%rbp),%rax
+    1bb0:	|      48 89 c7             	mov    %rax,%rdi
+    1bb3:	|      e8 f8 16 00 00       	call   32b0 <nel::par::Pool::~Pool()>
+
+    nel::free_aligned(b.src.ptr());
+    1bb8:	\----> 48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    1bbc:	       48 89 c7             	mov    %rax,%rdi
+    1bbf:	       e8 28 03 00 00       	call   1eec <nel::Slice<unsigned long>::ptr() const>
+    1bc4:	       48 89 c7             	mov    %rax,%rdi
+    1bc7:	       e8 3a 10 00 00       	call   2c06 <nel::free_aligned(void*)>
+    nel::free_aligned(b.dst.ptr());
+    1bcc:	       48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    1bd0:	       48 83 c0 10          	add    $0x10,%rax
+    1bd4:	       48 89 c7             	mov    %rax,%rdi
+    1bd7:	       e8 10 03 00 00       	call   1eec <nel::Slice<unsigned long>::ptr() const>
+    1bdc:	       48 89 c7             	mov    %rax,%rdi
+    1bdf:	       e8 22 10 00 00       	call   2c06 <nel::free_aligned(void*)>
+    nel::free_aligned(b.work.ptr());
+    1be4:	       48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    1be8:	       48 83 c0 20          	add    $0x20,%rax
+    1bec:	       48 89 c7             	mov    %rax,%rdi
+    1bef:	       e8 f8 02 00 00       	call   1eec <nel::Slice<unsigned long>::ptr() const>
+    1bf4:	       48 89 c7             	mov    %rax,%rdi
+    1bf7:	       e8 0a 10 00 00       	call   2c06 <nel::free_aligned(void*)>
+}
+    1bfc:	       b8 00 00 00 00       	mov    $0x0,%eax
+    1c01:	       c9                   	leave
+    1c02:	       c3                   	ret
+
+0000000000001c03 <unsigned long bench::time_ns<one_thread(Buffers&, bool, char const*)::{lambda()#1}>(one_thread(Buffers&, bool, char const*)::{lambda()#1}&&)>:
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+}
+
+// Time a run of f(), in ns.
+template<typename F>
+long unsigned int time_ns(F &&f)
+    1c03:	55                   	push   %rbp
+    1c04:	48 89 e5             	mov    %rsp,%rbp
+    1c07:	48 83 ec 20          	sub    $0x20,%rsp
+    1c0b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+{
+    long unsigned int const b = now_ns();
+    1c0f:	e8 e6 00 00 00       	call   1cfa <bench::now_ns()>
+    1c14:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    1c18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c1c:	48 89 c7             	mov    %rax,%rdi
+    1c1f:	e8 92 f8 ff ff       	call   14b6 <one_thread(Buffers&, bool, char const*)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    1c24:	e8 d1 00 00 00       	call   1cfa <bench::now_ns()>
+    1c29:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    1c2d:	c9                   	leave
+    1c2e:	c3                   	ret
+
+0000000000001c2f <unsigned long bench::time_ns<one_thread(Buffers&, bool, char const*)::{lambda()#2}>(one_thread(Buffers&, bool, char const*)::{lambda()#2}&&)>:
+long unsigned int time_ns(F &&f)
+    1c2f:	55                   	push   %rbp
+    1c30:	48 89 e5             	mov    %rsp,%rbp
+    1c33:	48 83 ec 20          	sub    $0x20,%rsp
+    1c37:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    1c3b:	e8 ba 00 00 00       	call   1cfa <bench::now_ns()>
+    1c40:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    1c44:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c48:	48 89 c7             	mov    %rax,%rdi
+    1c4b:	e8 92 f8 ff ff       	call   14e2 <one_thread(Buffers&, bool, char const*)::{lambda()#2}::operator()() const>
+    return now_ns() - b;
+    1c50:	e8 a5 00 00 00       	call   1cfa <bench::now_ns()>
+    1c55:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    1c59:	c9                   	leave
+    1c5a:	c3                   	ret
+
+0000000000001c5b <unsigned long bench::time_ns<baseline_reread(Buffers&)::{lambda()#1}>(baseline_reread(Buffers&)::{lambda()#1}&&)>:
+long unsigned int time_ns(F &&f)
+    1c5b:	55                   	push   %rbp
+    1c5c:	48 89 e5             	mov    %rsp,%rbp
+    1c5f:	48 83 ec 20          	sub    $0x20,%rsp
+    1c63:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    long unsigned int const b = now_ns();
+    1c67:	e8 8e 00 00 00       	call   1cfa <bench::now_ns()>
+    1c6c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    f();
+    1c70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c74:	48 89 c7             	mov    %rax,%rdi
+    1c77:	e8 d6 f9 ff ff       	call   1652 <baseline_reread(Buffers&)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    1c7c:	e8 79 00 00 00       	call   1cfa <bench::now_ns()>
+    1c81:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+    1c85:	c9                   	leave
+    1c86:	c3                   	ret
+    1c87:	90                   	nop
+
+0000000000001c88 <nel::Result<void, nel::par::ParError> nel::par::Pool::run<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(unsigned long, two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&)>:
+         * Run f(chunk) for every chunk in [0, n_chunks), in parallel.
+         *
+         * @param f callable as bool(Index) or void(Index).
+         */
+        template<typename F>
+        Result<void, ParError> run(Count const n_chunks, F &&f)
+    1c88:	55                   	push   %rbp
+    1c89:	48 89 e5             	mov    %rsp,%rbp
+    1c8c:	48 83 ec 20          	sub    $0x20,%rsp
+    1c90:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1c94:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1c98:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1c9c:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+        {
+            return run(n_chunks, &thunk<F>, &f);
+    1ca0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ca4:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1ca8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1cac:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+    1cb0:	49 89 c8             	mov    %rcx,%r8
+    1cb3:	48 8d 0d 0e 00 00 00 	lea    0xe(%rip),%rcx        # 1cc8 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)>
+    1cba:	48 89 c7             	mov    %rax,%rdi
+    1cbd:	e8 ca 1b 00 00       	call   388c <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)>
+        }
+    1cc2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cc6:	c9                   	leave
+    1cc7:	c3                   	ret
+
+0000000000001cc8 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)>:
+
+    private:
+        template<typename F>
+        static bool thunk(void *const ctx, Index const chunk)
+    1cc8:	55                   	push   %rbp
+    1cc9:	48 89 e5             	mov    %rsp,%rbp
+    1ccc:	48 83 ec 20          	sub    $0x20,%rsp
+    1cd0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1cd4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            F &f = *static_cast<remove_reference<F> *>(ctx);
+    1cd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cdc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            if constexpr (__is_same(decltype(f(chunk)), bool)) {
+                return f(chunk);
+            } else {
+                f(chunk);
+    1ce0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1ce4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ce8:	48 89 d6             	mov    %rdx,%rsi
+    1ceb:	48 89 c7             	mov    %rax,%rdi
+    1cee:	e8 63 fa ff ff       	call   1756 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}::operator()(unsigned long) const>
+                return true;
+    1cf3:	b8 01 00 00 00       	mov    $0x1,%eax
+            }
+        }
+    1cf8:	c9                   	leave
+    1cf9:	c3                   	ret
+
+0000000000001cfa <bench::now_ns()>:
+static constexpr nel::Count n_snaps = 5;
+    1cfa:	55                   	push   %rbp
+    1cfb:	48 89 e5             	mov    %rsp,%rbp
+    1cfe:	48 83 ec 10          	sub    $0x10,%rsp
+typedef long unsigned int Word;
+    1d02:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1d06:	48 89 c6             	mov    %rax,%rsi
+    1d09:	bf 01 00 00 00       	mov    $0x1,%edi
+    1d0e:	e8 4d f3 ff ff       	call   1060 <clock_gettime@plt>
+
+    1d13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d17:	48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+    1d1e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1d22:	48 01 d0             	add    %rdx,%rax
+struct Buffers
+    1d25:	c9                   	leave
+    1d26:	c3                   	ret
+
+0000000000001d27 <bench::report(char const*, unsigned long, unsigned long)>:
+    }
+    1d27:	    55                   	push   %rbp
+    1d28:	    48 89 e5             	mov    %rsp,%rbp
+    1d2b:	    48 83 ec 20          	sub    $0x20,%rsp
+    1d2f:	    48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1d33:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1d37:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return s;
+    1d3b:	    48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d3f:	    48 89 c6             	mov    %rax,%rsi
+    1d42:	    48 8d 05 a0 63 00 00 	lea    0x63a0(%rip),%rax        # 80e9 <nel::log>
+    1d49:	    48 89 c7             	mov    %rax,%rdi
+    1d4c:	    e8 2a 11 00 00       	call   2e7b <nel::operator<<(nel::Log&, char const*)>
+    1d51:	    48 89 c2             	mov    %rax,%rdx
+    1d54:	    48 8d 05 ad 32 00 00 	lea    0x32ad(%rip),%rax        # 5008 <_IO_stdin_used+0x8>
+    1d5b:	    48 89 c6             	mov    %rax,%rsi
+    1d5e:	    48 89 d7             	mov    %rdx,%rdi
+    1d61:	    e8 15 11 00 00       	call   2e7b <nel::operator<<(nel::Log&, char const*)>
+    1d66:	    48 89 c1             	mov    %rax,%rcx
+    1d69:	    48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d6d:	    48 c1 e8 03          	shr    $0x3,%rax
+    1d71:	    48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+    1d78:	    9b c4 20 
+    1d7b:	    48 f7 e2             	mul    %rdx
+    1d7e:	    48 89 d0             	mov    %rdx,%rax
+    1d81:	    48 c1 e8 04          	shr    $0x4,%rax
+    1d85:	    48 89 c6             	mov    %rax,%rsi
+    1d88:	    48 89 cf             	mov    %rcx,%rdi
+    1d8b:	    e8 f6 11 00 00       	call   2f86 <nel::operator<<(nel::Log&, unsigned long)>
+    1d90:	    48 89 c2             	mov    %rax,%rdx
+    1d93:	    48 8d 05 71 32 00 00 	lea    0x3271(%rip),%rax        # 500b <_IO_stdin_used+0xb>
+    1d9a:	    48 89 c6             	mov    %rax,%rsi
+    1d9d:	    48 89 d7             	mov    %rdx,%rdi
+    1da0:	    e8 d6 10 00 00       	call   2e7b <nel::operator<<(nel::Log&, char const*)>
+}
+    1da5:	    48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1daa:	/-- 74 57                	je     1e03 <bench::report(char const*, unsigned long, unsigned long)+0xdc>
+    1dac:	|   48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1db1:	+-- 74 50                	je     1e03 <bench::report(char const*, unsigned long, unsigned long)+0xdc>
+static void snapshot(Buffers &b, bool const streaming)
+    1db3:	|   48 8d 05 54 32 00 00 	lea    0x3254(%rip),%rax        # 500e <_IO_stdin_used+0xe>
+    1dba:	|   48 89 c6             	mov    %rax,%rsi
+    1dbd:	|   48 8d 05 25 63 00 00 	lea    0x6325(%rip),%rax        # 80e9 <nel::log>
+    1dc4:	|   48 89 c7             	mov    %rax,%rdi
+    1dc7:	|   e8 af 10 00 00       	call   2e7b <nel::operator<<(nel::Log&, char const*)>
+    1dcc:	|   48 89 c1             	mov    %rax,%rcx
+    1dcf:	|   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1dd3:	|   48 69 c0 e8 03 00 00 	imul   $0x3e8,%rax,%rax
+    1dda:	|   ba 00 00 00 00       	mov    $0x0,%edx
+    1ddf:	|   48 f7 75 f0          	divq   -0x10(%rbp)
+    1de3:	|   48 89 c6             	mov    %rax,%rsi
+    1de6:	|   48 89 cf             	mov    %rcx,%rdi
+    1de9:	|   e8 98 11 00 00       	call   2f86 <nel::operator<<(nel::Log&, unsigned long)>
+    1dee:	|   48 89 c2             	mov    %rax,%rdx
+    1df1:	|   48 8d 05 19 32 00 00 	lea    0x3219(%rip),%rax        # 5011 <_IO_stdin_used+0x11>
+    1df8:	|   48 89 c6             	mov    %rax,%rsi
+    1dfb:	|   48 89 d7             	mov    %rdx,%rdi
+    1dfe:	|   e8 78 10 00 00       	call   2e7b <nel::operator<<(nel::Log&, char const*)>
+    if (streaming) {
+    1e03:	\-> be 0a 00 00 00       	mov    $0xa,%esi
+    1e08:	    48 8d 05 da 62 00 00 	lea    0x62da(%rip),%rax        # 80e9 <nel::log>
+    1e0f:	    48 89 c7             	mov    %rax,%rdi
+    1e12:	    e8 38 10 00 00       	call   2e4f <nel::operator<<(nel::Log&, char)>
+        b.dst.copy_from_streaming(b.src);
+    1e17:	    90                   	nop
+    1e18:	    c9                   	leave
+    1e19:	    c3                   	ret
+
+0000000000001e1a <nel::Context::Context(char const*, char const*, int)>:
+        char const *fn_name_;
+        char const *file_name_;
+        int line_num_;
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+    1e1a:	55                   	push   %rbp
+    1e1b:	48 89 e5             	mov    %rsp,%rbp
+    1e1e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1e22:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1e26:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1e2a:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1e2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e31:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1e35:	48 89 10             	mov    %rdx,(%rax)
+            , file_name_(file_name)
+    1e38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e3c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1e40:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , line_num_(line_num)
+    1e44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e48:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1e4b:	89 50 10             	mov    %edx,0x10(%rax)
+        {
+        }
+    1e4e:	90                   	nop
+    1e4f:	5d                   	pop    %rbp
+    1e50:	c3                   	ret
+
+0000000000001e51 <nel::panic_if_not(bool, char const*, nel::Context const&)>:
+{
+    if (pred) { panic(msg, ctx); }
+}
+
+inline void panic_if_not(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    1e51:	    55                   	push   %rbp
+    1e52:	    48 89 e5             	mov    %rsp,%rbp
+    1e55:	    48 83 ec 20          	sub    $0x20,%rsp
+    1e59:	    89 f8                	mov    %edi,%eax
+    1e5b:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1e5f:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1e63:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { panic(msg, ctx); }
+    1e66:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    1e6a:	    83 f0 01             	xor    $0x1,%eax
+    1e6d:	    84 c0                	test   %al,%al
+    1e6f:	/-- 74 13                	je     1e84 <nel::panic_if_not(bool, char const*, nel::Context const&)+0x33>
+    1e71:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1e75:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e79:	|   48 89 d6             	mov    %rdx,%rsi
+    1e7c:	|   48 89 c7             	mov    %rax,%rdi
+    1e7f:	|   e8 bf 06 00 00       	call   2543 <nel::panic(char const*, nel::Context const&)>
+}
+    1e84:	\-> 90                   	nop
+    1e85:	    c9                   	leave
+    1e86:	    c3                   	ret
+    1e87:	    90                   	nop
+
+0000000000001e88 <nel::par::Pool::Pool(nel::par::Pool&&)>:
+        constexpr Pool(Pool &&o)
+    1e88:	55                   	push   %rbp
+    1e89:	48 89 e5             	mov    %rsp,%rbp
+    1e8c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1e90:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : shared_(o.shared_)
+    1e94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e98:	48 8b 10             	mov    (%rax),%rdx
+    1e9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e9f:	48 89 10             	mov    %rdx,(%rax)
+            o.shared_ = nullptr;
+    1ea2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ea6:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        }
+    1ead:	90                   	nop
+    1eae:	5d                   	pop    %rbp
+    1eaf:	c3                   	ret
+
+0000000000001eb0 <nel::Slice<unsigned long>::Slice(unsigned long*, unsigned long)>:
+    public:
+        // annoyingly, the type deducing form only works on ctors, not statics
+        // so Slice( int ptr, len) gets a Slice<int>(int ptr, len)
+        // but a Slice::from(int ptr, len) does not work..
+        // constexpr Slice(Type p[], Length len)
+        constexpr Slice(Type *const p, Length len)
+    1eb0:	55                   	push   %rbp
+    1eb1:	48 89 e5             	mov    %rsp,%rbp
+    1eb4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1eb8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1ebc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : content_(p)
+    1ec0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ec4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1ec8:	48 89 10             	mov    %rdx,(%rax)
+            , len_(len)
+    1ecb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ecf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1ed3:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        {
+        }
+    1ed7:	90                   	nop
+    1ed8:	5d                   	pop    %rbp
+    1ed9:	c3                   	ret
+
+0000000000001eda <nel::Slice<unsigned long>::len() const>:
+        /**
+         * Determine numer of elements in the slice.
+         *
+         * @returns number of elements in the slice.
+         */
+        constexpr Length len(void) const
+    1eda:	55                   	push   %rbp
+    1edb:	48 89 e5             	mov    %rsp,%rbp
+    1ede:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return len_;
+    1ee2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ee6:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    1eea:	5d                   	pop    %rbp
+    1eeb:	c3                   	ret
+
+0000000000001eec <nel::Slice<unsigned long>::ptr() const>:
+        constexpr Type *ptr(void) const
+    1eec:	55                   	push   %rbp
+    1eed:	48 89 e5             	mov    %rsp,%rbp
+    1ef0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return content_;
+    1ef4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ef8:	48 8b 00             	mov    (%rax),%rax
+        }
+    1efb:	5d                   	pop    %rbp
+    1efc:	c3                   	ret
+    1efd:	90                   	nop
+
+0000000000001efe <nel::Slice<unsigned long>::copy_from_streaming(nel::Slice<unsigned long> const&)>:
+         * @note a normal copy_from() if T is not trivially copyable.
+         * @see elem::copy_streaming()
+         * @warning panics if slices are of different lengths
+         * @warning UB if the slices overlap.
+         */
+        void copy_from_streaming(Slice const &o)
+    1efe:	55                   	push   %rbp
+    1eff:	48 89 e5             	mov    %rsp,%rbp
+    1f02:	41 54                	push   %r12
+    1f04:	53                   	push   %rbx
+    1f05:	48 83 ec 30          	sub    $0x30,%rsp
+    1f09:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    1f0d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+        {
+            nel::panic_if_not(len() == o.len(),
+    1f11:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1f15:	b9 5a 01 00 00       	mov    $0x15a,%ecx
+    1f1a:	48 8d 15 8b 32 00 00 	lea    0x328b(%rip),%rdx        # 51ac <n_snaps+0x16c>
+    1f21:	48 8d 35 09 32 00 00 	lea    0x3209(%rip),%rsi        # 5131 <n_snaps+0xf1>
+    1f28:	48 89 c7             	mov    %rax,%rdi
+    1f2b:	e8 ea fe ff ff       	call   1e1a <nel::Context::Context(char const*, char const*, int)>
+    1f30:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1f34:	48 89 c7             	mov    %rax,%rdi
+    1f37:	e8 9e ff ff ff       	call   1eda <nel::Slice<unsigned long>::len() const>
+    1f3c:	48 89 c3             	mov    %rax,%rbx
+    1f3f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1f43:	48 89 c7             	mov    %rax,%rdi
+    1f46:	e8 8f ff ff ff       	call   1eda <nel::Slice<unsigned long>::len() const>
+    1f4b:	48 39 c3             	cmp    %rax,%rbx
+    1f4e:	0f 94 c0             	sete   %al
+    1f51:	0f b6 c0             	movzbl %al,%eax
+    1f54:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    1f58:	48 8d 0d 61 32 00 00 	lea    0x3261(%rip),%rcx        # 51c0 <n_snaps+0x180>
+    1f5f:	48 89 ce             	mov    %rcx,%rsi
+    1f62:	89 c7                	mov    %eax,%edi
+    1f64:	e8 e8 fe ff ff       	call   1e51 <nel::panic_if_not(bool, char const*, nel::Context const&)>
+                              "nel::Slice:copy_from_streaming: Different lengths");
+            elem::copy_streaming(ptr(), o.ptr(), len());
+    1f69:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1f6d:	48 89 c7             	mov    %rax,%rdi
+    1f70:	e8 65 ff ff ff       	call   1eda <nel::Slice<unsigned long>::len() const>
+    1f75:	49 89 c4             	mov    %rax,%r12
+    1f78:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1f7c:	48 89 c7             	mov    %rax,%rdi
+    1f7f:	e8 68 ff ff ff       	call   1eec <nel::Slice<unsigned long>::ptr() const>
+    1f84:	48 89 c3             	mov    %rax,%rbx
+    1f87:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1f8b:	48 89 c7             	mov    %rax,%rdi
+    1f8e:	e8 59 ff ff ff       	call   1eec <nel::Slice<unsigned long>::ptr() const>
+    1f93:	4c 89 e2             	mov    %r12,%rdx
+    1f96:	48 89 de             	mov    %rbx,%rsi
+    1f99:	48 89 c7             	mov    %rax,%rdi
+    1f9c:	e8 d2 02 00 00       	call   2273 <void nel::elem::copy_streaming<unsigned long>(unsigned long*, unsigned long const*, unsigned long)>
+        }
+    1fa1:	90                   	nop
+    1fa2:	48 83 c4 30          	add    $0x30,%rsp
+    1fa6:	5b                   	pop    %rbx
+    1fa7:	41 5c                	pop    %r12
+    1fa9:	5d                   	pop    %rbp
+    1faa:	c3                   	ret
+    1fab:	90                   	nop
+
+0000000000001fac <nel::Slice<unsigned long>::copy_from(nel::Slice<unsigned long> const&)>:
+        void copy_from(Slice const &o)
+    1fac:	55                   	push   %rbp
+    1fad:	48 89 e5             	mov    %rsp,%rbp
+    1fb0:	41 54                	push   %r12
+    1fb2:	53                   	push   %rbx
+    1fb3:	48 83 ec 30          	sub    $0x30,%rsp
+    1fb7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    1fbb:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+            nel::panic_if_not(len() == o.len(), "nel::Slice:copy_from: Different lengths");
+    1fbf:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1fc3:	b9 44 01 00 00       	mov    $0x144,%ecx
+    1fc8:	48 8d 15 dd 31 00 00 	lea    0x31dd(%rip),%rdx        # 51ac <n_snaps+0x16c>
+    1fcf:	48 8d 35 51 31 00 00 	lea    0x3151(%rip),%rsi        # 5127 <n_snaps+0xe7>
+    1fd6:	48 89 c7             	mov    %rax,%rdi
+    1fd9:	e8 3c fe ff ff       	call   1e1a <nel::Context::Context(char const*, char const*, int)>
+    1fde:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1fe2:	48 89 c7             	mov    %rax,%rdi
+    1fe5:	e8 f0 fe ff ff       	call   1eda <nel::Slice<unsigned long>::len() const>
+    1fea:	48 89 c3             	mov    %rax,%rbx
+    1fed:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1ff1:	48 89 c7             	mov    %rax,%rdi
+    1ff4:	e8 e1 fe ff ff       	call   1eda <nel::Slice<unsigned long>::len() const>
+    1ff9:	48 39 c3             	cmp    %rax,%rbx
+    1ffc:	0f 94 c0             	sete   %al
+    1fff:	0f b6 c0             	movzbl %al,%eax
+    2002:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    2006:	48 8d 0d eb 31 00 00 	lea    0x31eb(%rip),%rcx        # 51f8 <n_snaps+0x1b8>
+    200d:	48 89 ce             	mov    %rcx,%rsi
+    2010:	89 c7                	mov    %eax,%edi
+    2012:	e8 3a fe ff ff       	call   1e51 <nel::panic_if_not(bool, char const*, nel::Context const&)>
+            elem::copy(ptr(), o.ptr(), len());
+    2017:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    201b:	48 89 c7             	mov    %rax,%rdi
+    201e:	e8 b7 fe ff ff       	call   1eda <nel::Slice<unsigned long>::len() const>
+    2023:	49 89 c4             	mov    %rax,%r12
+    2026:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    202a:	48 89 c7             	mov    %rax,%rdi
+    202d:	e8 ba fe ff ff       	call   1eec <nel::Slice<unsigned long>::ptr() const>
+    2032:	48 89 c3             	mov    %rax,%rbx
+    2035:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2039:	48 89 c7             	mov    %rax,%rdi
+    203c:	e8 ab fe ff ff       	call   1eec <nel::Slice<unsigned long>::ptr() const>
+    2041:	4c 89 e2             	mov    %r12,%rdx
+    2044:	48 89 de             	mov    %rbx,%rsi
+    2047:	48 89 c7             	mov    %rax,%rdi
+    204a:	e8 66 02 00 00       	call   22b5 <void nel::elem::copy<unsigned long>(unsigned long*, unsigned long const*, unsigned long)>
+        }
+    204f:	90                   	nop
+    2050:	48 83 c4 30          	add    $0x30,%rsp
+    2054:	5b                   	pop    %rbx
+    2055:	41 5c                	pop    %r12
+    2057:	5d                   	pop    %rbp
+    2058:	c3                   	ret
+    2059:	90                   	nop
+
+000000000000205a <nel::Result<void, nel::par::ParError>::~Result()>:
+        union {
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    205a:	             55                   	push   %rbp
+    205b:	             48 89 e5             	mov    %rsp,%rbp
+    205e:	             48 83 ec 30          	sub    $0x30,%rsp
+    2062:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result<void>-dtor
+    2066:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    206a:	             8b 00                	mov    (%rax),%eax
+    206c:	             83 f8 02             	cmp    $0x2,%eax
+    206f:	/----------- 74 43                	je     20b4 <nel::Result<void, nel::par::ParError>::~Result()+0x5a>
+    2071:	|            83 f8 02             	cmp    $0x2,%eax
+    2074:	|        /-- 7f 09                	jg     207f <nel::Result<void, nel::par::ParError>::~Result()+0x25>
+    2076:	|        |   85 c0                	test   %eax,%eax
+    2078:	|  /-----|-- 74 3d                	je     20b7 <nel::Result<void, nel::par::ParError>::~Result()+0x5d>
+    207a:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    207d:	|  |  /--|-- 74 3b                	je     20ba <nel::Result<void, nel::par::ParError>::~Result()+0x60>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    207f:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2083:	|  |  |      b9 dd 02 00 00       	mov    $0x2dd,%ecx
+    2088:	|  |  |      48 8d 15 91 31 00 00 	lea    0x3191(%rip),%rdx        # 5220 <n_snaps+0x1e0>
+    208f:	|  |  |      48 8d 35 9c 31 00 00 	lea    0x319c(%rip),%rsi        # 5232 <n_snaps+0x1f2>
+    2096:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2099:	|  |  |      e8 7c fd ff ff       	call   1e1a <nel::Context::Context(char const*, char const*, int)>
+    209e:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    20a2:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    20a5:	|  |  |      48 8d 05 8e 31 00 00 	lea    0x318e(%rip),%rax        # 523a <n_snaps+0x1fa>
+    20ac:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    20af:	|  |  |      e8 8f 04 00 00       	call   2543 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    20b4:	\--|--|----> 90                   	nop
+    20b5:	   |  |  /-- eb 04                	jmp    20bb <nel::Result<void, nel::par::ParError>::~Result()+0x61>
+                    break;
+    20b7:	   \--|--|-> 90                   	nop
+    20b8:	      |  +-- eb 01                	jmp    20bb <nel::Result<void, nel::par::ParError>::~Result()+0x61>
+                    break;
+    20ba:	      \--|-> 90                   	nop
+                    break;
+            }
+        }
+    20bb:	         \-> 90                   	nop
+    20bc:	             c9                   	leave
+    20bd:	             c3                   	ret
+
+00000000000020be <nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda()#1}::operator()() const>:
+         *
+         * `this` is consumed by the operation.
+         */
+        constexpr void unwrap(Context const &ctx = Context())
+        {
+            return consumev([](void) {}, [](E &&) { nel::panic("not an ok"); }, ctx);
+    20be:	55                   	push   %rbp
+    20bf:	48 89 e5             	mov    %rsp,%rbp
+    20c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    20c6:	90                   	nop
+    20c7:	5d                   	pop    %rbp
+    20c8:	c3                   	ret
+    20c9:	90                   	nop
+
+00000000000020ca <nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}::operator()(nel::par::ParError&&) const>:
+    20ca:	55                   	push   %rbp
+    20cb:	48 89 e5             	mov    %rsp,%rbp
+    20ce:	48 83 ec 30          	sub    $0x30,%rsp
+    20d2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    20d6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    20da:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    20de:	b9 1f 04 00 00       	mov    $0x41f,%ecx
+    20e3:	48 8d 15 36 31 00 00 	lea    0x3136(%rip),%rdx        # 5220 <n_snaps+0x1e0>
+    20ea:	48 8d 35 54 31 00 00 	lea    0x3154(%rip),%rsi        # 5245 <n_snaps+0x205>
+    20f1:	48 89 c7             	mov    %rax,%rdi
+    20f4:	e8 21 fd ff ff       	call   1e1a <nel::Context::Context(char const*, char const*, int)>
+    20f9:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    20fd:	48 89 c6             	mov    %rax,%rsi
+    2100:	48 8d 05 49 31 00 00 	lea    0x3149(%rip),%rax        # 5250 <n_snaps+0x210>
+    2107:	48 89 c7             	mov    %rax,%rdi
+    210a:	e8 34 04 00 00       	call   2543 <nel::panic(char const*, nel::Context const&)>
+    210f:	90                   	nop
+
+0000000000002110 <nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)>:
+        constexpr void unwrap(Context const &ctx = Context())
+    2110:	55                   	push   %rbp
+    2111:	48 89 e5             	mov    %rsp,%rbp
+    2114:	48 83 ec 20          	sub    $0x20,%rsp
+    2118:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    211c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return consumev([](void) {}, [](E &&) { nel::panic("not an ok"); }, ctx);
+    2120:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2124:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    2128:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    212c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2130:	48 89 c7             	mov    %rax,%rdi
+    2133:	e8 c0 01 00 00       	call   22f8 <void nel::Result<void, nel::par::ParError>::consumev<nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}>(nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}&&, nel::Context const&)>
+    2138:	90                   	nop
+        }
+    2139:	c9                   	leave
+    213a:	c3                   	ret
+    213b:	90                   	nop
+
+000000000000213c <nel::Element<nel::par::Pool>::~Element()>:
+
+    private:
+        Type value_;
+
+    public:
+        constexpr ~Element(void) = default;
+    213c:	55                   	push   %rbp
+    213d:	48 89 e5             	mov    %rsp,%rbp
+    2140:	48 83 ec 10          	sub    $0x10,%rsp
+    2144:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2148:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    214c:	48 89 c7             	mov    %rax,%rdi
+    214f:	e8 5c 11 00 00       	call   32b0 <nel::par::Pool::~Pool()>
+    2154:	90                   	nop
+    2155:	c9                   	leave
+    2156:	c3                   	ret
+    2157:	90                   	nop
+
+0000000000002158 <nel::Result<nel::par::Pool, nel::par::ParError>::~Result()>:
+        constexpr ~Result(void)
+    2158:	             55                   	push   %rbp
+    2159:	             48 89 e5             	mov    %rsp,%rbp
+    215c:	             48 83 ec 30          	sub    $0x30,%rsp
+    2160:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+            switch (tag_) { // result::dtor
+    2164:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2168:	             8b 00                	mov    (%rax),%eax
+    216a:	             83 f8 02             	cmp    $0x2,%eax
+    216d:	/----------- 74 55                	je     21c4 <nel::Result<nel::par::Pool, nel::par::ParError>::~Result()+0x6c>
+    216f:	|            83 f8 02             	cmp    $0x2,%eax
+    2172:	|        /-- 7f 1b                	jg     218f <nel::Result<nel::par::Pool, nel::par::ParError>::~Result()+0x37>
+    2174:	|        |   85 c0                	test   %eax,%eax
+    2176:	|  /-----|-- 74 4f                	je     21c7 <nel::Result<nel::par::Pool, nel::par::ParError>::~Result()+0x6f>
+    2178:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    217b:	|  |     +-- 75 12                	jne    218f <nel::Result<nel::par::Pool, nel::par::ParError>::~Result()+0x37>
+                    ok_.~Element<T>();
+    217d:	|  |     |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2181:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    2185:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2188:	|  |     |   e8 af ff ff ff       	call   213c <nel::Element<nel::par::Pool>::~Element()>
+                    break;
+    218d:	|  |  /--|-- eb 39                	jmp    21c8 <nel::Result<nel::par::Pool, nel::par::ParError>::~Result()+0x70>
+                    nel::panic("bad Result");
+    218f:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2193:	|  |  |      b9 72 00 00 00       	mov    $0x72,%ecx
+    2198:	|  |  |      48 8d 15 81 30 00 00 	lea    0x3081(%rip),%rdx        # 5220 <n_snaps+0x1e0>
+    219f:	|  |  |      48 8d 35 8c 30 00 00 	lea    0x308c(%rip),%rsi        # 5232 <n_snaps+0x1f2>
+    21a6:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    21a9:	|  |  |      e8 6c fc ff ff       	call   1e1a <nel::Context::Context(char const*, char const*, int)>
+    21ae:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    21b2:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    21b5:	|  |  |      48 8d 05 7e 30 00 00 	lea    0x307e(%rip),%rax        # 523a <n_snaps+0x1fa>
+    21bc:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    21bf:	|  |  |      e8 7f 03 00 00       	call   2543 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    21c4:	\--|--|----> 90                   	nop
+    21c5:	   |  +----- eb 01                	jmp    21c8 <nel::Result<nel::par::Pool, nel::par::ParError>::~Result()+0x70>
+                    break;
+    21c7:	   \--|----> 90                   	nop
+        }
+    21c8:	      \----> 90                   	nop
+    21c9:	             c9                   	leave
+    21ca:	             c3                   	ret
+    21cb:	             90                   	nop
+
+00000000000021cc <nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::Pool&&)#1}::operator()(nel::par::Pool&&) const>:
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    21cc:	55                   	push   %rbp
+    21cd:	48 89 e5             	mov    %rsp,%rbp
+    21d0:	48 83 ec 20          	sub    $0x20,%rsp
+    21d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    21d8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    21dc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    21e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    21e4:	48 89 c7             	mov    %rax,%rdi
+    21e7:	e8 b8 01 00 00       	call   23a4 <nel::par::Pool&& nel::forward<nel::par::Pool, nel::par::Pool>(nel::par::Pool&)>
+    21ec:	48 89 c2             	mov    %rax,%rdx
+    21ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21f3:	48 89 d6             	mov    %rdx,%rsi
+    21f6:	48 89 c7             	mov    %rax,%rdi
+    21f9:	e8 8a fc ff ff       	call   1e88 <nel::par::Pool::Pool(nel::par::Pool&&)>
+    21fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2202:	c9                   	leave
+    2203:	c3                   	ret
+
+0000000000002204 <nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}::operator()(nel::par::ParError&&) const>:
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    2204:	55                   	push   %rbp
+    2205:	48 89 e5             	mov    %rsp,%rbp
+    2208:	48 83 ec 20          	sub    $0x20,%rsp
+    220c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2210:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2214:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2218:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    221c:	48 8b 00             	mov    (%rax),%rax
+    221f:	48 89 c6             	mov    %rax,%rsi
+    2222:	48 8d 05 31 30 00 00 	lea    0x3031(%rip),%rax        # 525a <n_snaps+0x21a>
+    2229:	48 89 c7             	mov    %rax,%rdi
+    222c:	e8 12 03 00 00       	call   2543 <nel::panic(char const*, nel::Context const&)>
+    2231:	90                   	nop
+
+0000000000002232 <nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)>:
+        constexpr T unwrap(Context const &ctx = Context())
+    2232:	55                   	push   %rbp
+    2233:	48 89 e5             	mov    %rsp,%rbp
+    2236:	48 83 ec 30          	sub    $0x30,%rsp
+    223a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    223e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2242:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    2246:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    224a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+                              ctx);
+    224e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2252:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+    2256:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+    225a:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    225e:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+    2262:	49 89 f8             	mov    %rdi,%r8
+    2265:	48 89 c7             	mov    %rax,%rdi
+    2268:	e8 45 01 00 00       	call   23b2 <nel::par::Pool nel::Result<nel::par::Pool, nel::par::ParError>::consume<nel::par::Pool, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::Pool&&)#1}, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}>(nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::Pool&&)#1}&&, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}&&, nel::Context const&)>
+        }
+    226d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2271:	c9                   	leave
+    2272:	c3                   	ret
+
+0000000000002273 <void nel::elem::copy_streaming<unsigned long>(unsigned long*, unsigned long const*, unsigned long)>:
+ * Copy elements [s,s+n) to [d,d+n), with streaming stores if T is trivially copyable.
+ *
+ * @see copy(), copy_streaming()
+ */
+template<typename T>
+void copy_streaming(T d[], T const s[], Length const n)
+    2273:	       55                   	push   %rbp
+    2274:	       48 89 e5             	mov    %rsp,%rbp
+    2277:	       48 83 ec 20          	sub    $0x20,%rsp
+    227b:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    227f:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2283:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+{
+    if (d == s) { return; }
+    2287:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    228b:	       48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    228f:	/----- 74 21                	je     22b2 <void nel::elem::copy_streaming<unsigned long>(unsigned long*, unsigned long const*, unsigned long)+0x3f>
+    if constexpr (is_trivially_copyable<T>) {
+        copy_streaming(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t const *>(s),
+    2291:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2295:	|      48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    229c:	|      00 
+    229d:	|      48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    22a1:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22a5:	|      48 89 ce             	mov    %rcx,%rsi
+    22a8:	|      48 89 c7             	mov    %rax,%rdi
+    22ab:	|      e8 6e 05 00 00       	call   281e <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>
+    22b0:	|  /-- eb 01                	jmp    22b3 <void nel::elem::copy_streaming<unsigned long>(unsigned long*, unsigned long const*, unsigned long)+0x40>
+    if (d == s) { return; }
+    22b2:	\--|-> 90                   	nop
+                       n * sizeof(T));
+    } else {
+        copy(d, s, n);
+    }
+}
+    22b3:	   \-> c9                   	leave
+    22b4:	       c3                   	ret
+
+00000000000022b5 <void nel::elem::copy<unsigned long>(unsigned long*, unsigned long const*, unsigned long)>:
+void copy(T d[], T const s[], Length const n)
+    22b5:	       55                   	push   %rbp
+    22b6:	       48 89 e5             	mov    %rsp,%rbp
+    22b9:	       48 83 ec 20          	sub    $0x20,%rsp
+    22bd:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    22c1:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    22c5:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    if (d == s) { return; }
+    22c9:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22cd:	       48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    22d1:	/----- 74 21                	je     22f4 <void nel::elem::copy<unsigned long>(unsigned long*, unsigned long const*, unsigned long)+0x3f>
+        copy(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t const *>(s), n * sizeof(T));
+    22d3:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22d7:	|      48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    22de:	|      00 
+    22df:	|      48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    22e3:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22e7:	|      48 89 ce             	mov    %rcx,%rsi
+    22ea:	|      48 89 c7             	mov    %rax,%rdi
+    22ed:	|      e8 07 03 00 00       	call   25f9 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    22f2:	|  /-- eb 01                	jmp    22f5 <void nel::elem::copy<unsigned long>(unsigned long*, unsigned long const*, unsigned long)+0x40>
+    if (d == s) { return; }
+    22f4:	\--|-> 90                   	nop
+}
+    22f5:	   \-> c9                   	leave
+    22f6:	       c3                   	ret
+    22f7:	       90                   	nop
+
+00000000000022f8 <void nel::Result<void, nel::par::ParError>::consumev<nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}>(nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}&&, nel::Context const&)>:
+        constexpr void consumev(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    22f8:	             55                   	push   %rbp
+    22f9:	             48 89 e5             	mov    %rsp,%rbp
+    22fc:	             48 83 ec 30          	sub    $0x30,%rsp
+    2300:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2304:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2308:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    230c:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    2310:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2314:	             8b 00                	mov    (%rax),%eax
+    2316:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    2319:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    231d:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result<void>-consume
+    2323:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    2327:	         /-- 74 20                	je     2349 <void nel::Result<void, nel::par::ParError>::consumev<nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}>(nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}&&, nel::Context const&)+0x51>
+    2329:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    232d:	/--------|-- 7f 5c                	jg     238b <void nel::Result<void, nel::par::ParError>::consumev<nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}>(nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}&&, nel::Context const&)+0x93>
+    232f:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2333:	|     /--|-- 74 40                	je     2375 <void nel::Result<void, nel::par::ParError>::consumev<nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}>(nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}&&, nel::Context const&)+0x7d>
+    2335:	|     |  |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    2339:	+-----|--|-- 75 50                	jne    238b <void nel::Result<void, nel::par::ParError>::consumev<nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}>(nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}&&, nel::Context const&)+0x93>
+                    on_ok();
+    233b:	|     |  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    233f:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    2342:	|     |  |   e8 77 fd ff ff       	call   20be <nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda()#1}::operator()() const>
+                    break;
+    2347:	|  /--|--|-- eb 58                	jmp    23a1 <void nel::Result<void, nel::par::ParError>::consumev<nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}>(nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}&&, nel::Context const&)+0xa9>
+                    on_err(nel::forward<E>(*err_));
+    2349:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    234d:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    2351:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2354:	|  |  |      e8 37 01 00 00       	call   2490 <nel::Element<nel::par::ParError>::operator*()>
+    2359:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    235c:	|  |  |      e8 49 01 00 00       	call   24aa <nel::par::ParError&& nel::forward<nel::par::ParError, nel::par::ParError>(nel::par::ParError&)>
+    2361:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    2364:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2368:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    236b:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    236e:	|  |  |      e8 57 fd ff ff       	call   20ca <nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}::operator()(nel::par::ParError&&) const>
+                    break;
+    2373:	|  +--|----- eb 2c                	jmp    23a1 <void nel::Result<void, nel::par::ParError>::consumev<nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda()#1}, nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}>(nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda()#1}&&, nel::Result<void, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}&&, nel::Context const&)+0xa9>
+                    nel::panic("invalid Result", ctx);
+    2375:	|  |  \----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2379:	|  |         48 89 c6             	mov    %rax,%rsi
+    237c:	|  |         48 8d 05 e1 2e 00 00 	lea    0x2ee1(%rip),%rax        # 5264 <n_snaps+0x224>
+    2383:	|  |         48 89 c7             	mov    %rax,%rdi
+    2386:	|  |         e8 b8 01 00 00       	call   2543 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    238b:	\--|-------> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    238f:	   |         48 89 c6             	mov    %rax,%rsi
+    2392:	   |         48 8d 05 a1 2e 00 00 	lea    0x2ea1(%rip),%rax        # 523a <n_snaps+0x1fa>
+    2399:	   |         48 89 c7             	mov    %rax,%rdi
+    239c:	   |         e8 a2 01 00 00       	call   2543 <nel::panic(char const*, nel::Context const&)>
+        }
+    23a1:	   \-------> 90                   	nop
+    23a2:	             c9                   	leave
+    23a3:	             c3                   	ret
+
+00000000000023a4 <nel::par::Pool&& nel::forward<nel::par::Pool, nel::par::Pool>(nel::par::Pool&)>:
+constexpr U &&forward(T &t)
+    23a4:	55                   	push   %rbp
+    23a5:	48 89 e5             	mov    %rsp,%rbp
+    23a8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    23ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    23b0:	5d                   	pop    %rbp
+    23b1:	c3                   	ret
+
+00000000000023b2 <nel::par::Pool nel::Result<nel::par::Pool, nel::par::ParError>::consume<nel::par::Pool, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::Pool&&)#1}, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}>(nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::Pool&&)#1}&&, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    23b2:	             55                   	push   %rbp
+    23b3:	             48 89 e5             	mov    %rsp,%rbp
+    23b6:	             48 83 ec 40          	sub    $0x40,%rsp
+    23ba:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    23be:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    23c2:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    23c6:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    23ca:	             4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+            auto tag = tag_;
+    23ce:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    23d2:	             8b 00                	mov    (%rax),%eax
+    23d4:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    23d7:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    23db:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    23e1:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    23e5:	         /-- 74 46                	je     242d <nel::par::Pool nel::Result<nel::par::Pool, nel::par::ParError>::consume<nel::par::Pool, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::Pool&&)#1}, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}>(nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::Pool&&)#1}&&, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}&&, nel::Context const&)+0x7b>
+    23e7:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    23eb:	/--------|-- 0f 8f 82 00 00 00    	jg     2473 <nel::par::Pool nel::Result<nel::par::Pool, nel::par::ParError>::consume<nel::par::Pool, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::Pool&&)#1}, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}>(nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::Pool&&)#1}&&, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}&&, nel::Context const&)+0xc1>
+    23f1:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    23f5:	|  /-----|-- 74 66                	je     245d <nel::par::Pool nel::Result<nel::par::Pool, nel::par::ParError>::consume<nel::par::Pool, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::Pool&&)#1}, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}>(nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::Pool&&)#1}&&, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}&&, nel::Context const&)+0xab>
+    23f7:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    23fb:	+--|-----|-- 75 76                	jne    2473 <nel::par::Pool nel::Result<nel::par::Pool, nel::par::ParError>::consume<nel::par::Pool, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::Pool&&)#1}, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}>(nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::Pool&&)#1}&&, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}&&, nel::Context const&)+0xc1>
+                    return on_ok(forward<T>(*ok_));
+    23fd:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2401:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    2405:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2408:	|  |     |   e8 ab 00 00 00       	call   24b8 <nel::Element<nel::par::Pool>::operator*()>
+    240d:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2410:	|  |     |   e8 8f ff ff ff       	call   23a4 <nel::par::Pool&& nel::forward<nel::par::Pool, nel::par::Pool>(nel::par::Pool&)>
+    2415:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    2418:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    241c:	|  |     |   48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+    2420:	|  |     |   48 89 ce             	mov    %rcx,%rsi
+    2423:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2426:	|  |     |   e8 a1 fd ff ff       	call   21cc <nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::Pool&&)#1}::operator()(nel::par::Pool&&) const>
+    242b:	|  |  /--|-- eb 5c                	jmp    2489 <nel::par::Pool nel::Result<nel::par::Pool, nel::par::ParError>::consume<nel::par::Pool, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::Pool&&)#1}, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}>(nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::Pool&&)#1}&&, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}&&, nel::Context const&)+0xd7>
+                    return on_err(forward<E>(*err_));
+    242d:	|  |  |  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2431:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    2435:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2438:	|  |  |      e8 53 00 00 00       	call   2490 <nel::Element<nel::par::ParError>::operator*()>
+    243d:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2440:	|  |  |      e8 65 00 00 00       	call   24aa <nel::par::ParError&& nel::forward<nel::par::ParError, nel::par::ParError>(nel::par::ParError&)>
+    2445:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    2448:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    244c:	|  |  |      48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    2450:	|  |  |      48 89 ce             	mov    %rcx,%rsi
+    2453:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2456:	|  |  |      e8 a9 fd ff ff       	call   2204 <nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}::operator()(nel::par::ParError&&) const>
+    245b:	|  |  +----- eb 2c                	jmp    2489 <nel::par::Pool nel::Result<nel::par::Pool, nel::par::ParError>::consume<nel::par::Pool, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::Pool&&)#1}, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}>(nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::Pool&&)#1}&&, nel::Result<nel::par::Pool, nel::par::ParError>::unwrap(nel::Context const&)::{lambda(nel::par::ParError&&)#2}&&, nel::Context const&)+0xd7>
+                    nel::panic("invalid Result", ctx);
+    245d:	|  \--|----> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2461:	|     |      48 89 c6             	mov    %rax,%rsi
+    2464:	|     |      48 8d 05 f9 2d 00 00 	lea    0x2df9(%rip),%rax        # 5264 <n_snaps+0x224>
+    246b:	|     |      48 89 c7             	mov    %rax,%rdi
+    246e:	|     |      e8 d0 00 00 00       	call   2543 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    2473:	\-----|----> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2477:	      |      48 89 c6             	mov    %rax,%rsi
+    247a:	      |      48 8d 05 b9 2d 00 00 	lea    0x2db9(%rip),%rax        # 523a <n_snaps+0x1fa>
+    2481:	      |      48 89 c7             	mov    %rax,%rdi
+    2484:	      |      e8 ba 00 00 00       	call   2543 <nel::panic(char const*, nel::Context const&)>
+        }
+    2489:	      \----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    248d:	             c9                   	leave
+    248e:	             c3                   	ret
+    248f:	             90                   	nop
+
+0000000000002490 <nel::Element<nel::par::ParError>::operator*()>:
+        constexpr Type const &operator*(void) const
+        {
+            return ref();
+        }
+
+        constexpr Type &operator*(void)
+    2490:	55                   	push   %rbp
+    2491:	48 89 e5             	mov    %rsp,%rbp
+    2494:	48 83 ec 10          	sub    $0x10,%rsp
+    2498:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    249c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24a0:	48 89 c7             	mov    %rax,%rdi
+    24a3:	e8 2a 00 00 00       	call   24d2 <nel::Element<nel::par::ParError>::ref()>
+        }
+    24a8:	c9                   	leave
+    24a9:	c3                   	ret
+
+00000000000024aa <nel::par::ParError&& nel::forward<nel::par::ParError, nel::par::ParError>(nel::par::ParError&)>:
+constexpr U &&forward(T &t)
+    24aa:	55                   	push   %rbp
+    24ab:	48 89 e5             	mov    %rsp,%rbp
+    24ae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    24b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    24b6:	5d                   	pop    %rbp
+    24b7:	c3                   	ret
+
+00000000000024b8 <nel::Element<nel::par::Pool>::operator*()>:
+        constexpr Type &operator*(void)
+    24b8:	55                   	push   %rbp
+    24b9:	48 89 e5             	mov    %rsp,%rbp
+    24bc:	48 83 ec 10          	sub    $0x10,%rsp
+    24c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    24c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24c8:	48 89 c7             	mov    %rax,%rdi
+    24cb:	e8 10 00 00 00       	call   24e0 <nel::Element<nel::par::Pool>::ref()>
+        }
+    24d0:	c9                   	leave
+    24d1:	c3                   	ret
+
+00000000000024d2 <nel::Element<nel::par::ParError>::ref()>:
+        constexpr Type &ref(void)
+    24d2:	55                   	push   %rbp
+    24d3:	48 89 e5             	mov    %rsp,%rbp
+    24d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    24da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    24de:	5d                   	pop    %rbp
+    24df:	c3                   	ret
+
+00000000000024e0 <nel::Element<nel::par::Pool>::ref()>:
+        constexpr Type &ref(void)
+    24e0:	55                   	push   %rbp
+    24e1:	48 89 e5             	mov    %rsp,%rbp
+    24e4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    24e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    24ec:	5d                   	pop    %rbp
+    24ed:	c3                   	ret
+
+00000000000024ee <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    24ee:	55                   	push   %rbp
+    24ef:	48 89 e5             	mov    %rsp,%rbp
+    std::abort();
+    24f2:	e8 49 eb ff ff       	call   1040 <abort@plt>
+
+00000000000024f7 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    24f7:	55                   	push   %rbp
+    24f8:	48 89 e5             	mov    %rsp,%rbp
+    24fb:	48 83 ec 10          	sub    $0x10,%rsp
+    24ff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    2503:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2507:	48 8b 30             	mov    (%rax),%rsi
+    250a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    250e:	8b 48 10             	mov    0x10(%rax),%ecx
+    2511:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2515:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2519:	48 8b 05 c0 5b 00 00 	mov    0x5bc0(%rip),%rax        # 80e0 <stderr@GLIBC_2.2.5>
+    2520:	4c 8d 0d 4d 2d 00 00 	lea    0x2d4d(%rip),%r9        # 5274 <nel::is_trivially_copyable<unsigned long>+0x1>
+    2527:	49 89 f0             	mov    %rsi,%r8
+    252a:	48 8d 35 49 2d 00 00 	lea    0x2d49(%rip),%rsi        # 527a <nel::is_trivially_copyable<unsigned long>+0x7>
+    2531:	48 89 c7             	mov    %rax,%rdi
+    2534:	b8 00 00 00 00       	mov    $0x0,%eax
+    2539:	e8 a2 eb ff ff       	call   10e0 <fprintf@plt>
+    abort();
+    253e:	e8 ab ff ff ff       	call   24ee <nel::abort()>
+
+0000000000002543 <nel::panic(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    2543:	55                   	push   %rbp
+    2544:	48 89 e5             	mov    %rsp,%rbp
+    2547:	48 83 ec 10          	sub    $0x10,%rsp
+    254b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    254f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    2553:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2557:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    255a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    255e:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    2561:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2565:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    2569:	48 8b 05 70 5b 00 00 	mov    0x5b70(%rip),%rax        # 80e0 <stderr@GLIBC_2.2.5>
+    2570:	48 83 ec 08          	sub    $0x8,%rsp
+    2574:	ff 75 f8             	push   -0x8(%rbp)
+    2577:	4c 8d 0d f6 2c 00 00 	lea    0x2cf6(%rip),%r9        # 5274 <nel::is_trivially_copyable<unsigned long>+0x1>
+    257e:	49 89 f0             	mov    %rsi,%r8
+    2581:	48 8d 35 03 2d 00 00 	lea    0x2d03(%rip),%rsi        # 528b <nel::is_trivially_copyable<unsigned long>+0x18>
+    2588:	48 89 c7             	mov    %rax,%rdi
+    258b:	b8 00 00 00 00       	mov    $0x0,%eax
+    2590:	e8 4b eb ff ff       	call   10e0 <fprintf@plt>
+    2595:	48 83 c4 10          	add    $0x10,%rsp
+            "PANIC",
+            msg);
+    abort();
+    2599:	e8 50 ff ff ff       	call   24ee <nel::abort()>
+
+000000000000259e <nel::assert_fail(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    259e:	55                   	push   %rbp
+    259f:	48 89 e5             	mov    %rsp,%rbp
+    25a2:	48 83 ec 10          	sub    $0x10,%rsp
+    25a6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    25aa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    25ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25b2:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    25b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25b9:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    25bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25c0:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    25c4:	48 8b 05 15 5b 00 00 	mov    0x5b15(%rip),%rax        # 80e0 <stderr@GLIBC_2.2.5>
+    25cb:	48 83 ec 08          	sub    $0x8,%rsp
+    25cf:	ff 75 f8             	push   -0x8(%rbp)
+    25d2:	4c 8d 0d c7 2c 00 00 	lea    0x2cc7(%rip),%r9        # 52a0 <nel::is_trivially_copyable<unsigned long>+0x2d>
+    25d9:	49 89 f0             	mov    %rsi,%r8
+    25dc:	48 8d 35 a8 2c 00 00 	lea    0x2ca8(%rip),%rsi        # 528b <nel::is_trivially_copyable<unsigned long>+0x18>
+    25e3:	48 89 c7             	mov    %rax,%rdi
+    25e6:	b8 00 00 00 00       	mov    $0x0,%eax
+    25eb:	e8 f0 ea ff ff       	call   10e0 <fprintf@plt>
+    25f0:	48 83 c4 10          	add    $0x10,%rsp
+            "ASSERT FAIL",
+            msg);
+    abort();
+    25f4:	e8 f5 fe ff ff       	call   24ee <nel::abort()>
+
+00000000000025f9 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    25f9:	55                   	push   %rbp
+    25fa:	48 89 e5             	mov    %rsp,%rbp
+    25fd:	48 83 ec 20          	sub    $0x20,%rsp
+    2601:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2605:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2609:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    260d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2611:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2615:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2619:	48 89 ce             	mov    %rcx,%rsi
+    261c:	48 89 c7             	mov    %rax,%rdi
+    261f:	e8 cc ea ff ff       	call   10f0 <memcpy@plt>
+}
+    2624:	90                   	nop
+    2625:	c9                   	leave
+    2626:	c3                   	ret
+
+0000000000002627 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    2627:	55                   	push   %rbp
+    2628:	48 89 e5             	mov    %rsp,%rbp
+    262b:	48 83 ec 20          	sub    $0x20,%rsp
+    262f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2633:	89 f0                	mov    %esi,%eax
+    2635:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2639:	88 45 f4             	mov    %al,-0xc(%rbp)
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    263c:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    2640:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2644:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2648:	89 ce                	mov    %ecx,%esi
+    264a:	48 89 c7             	mov    %rax,%rdi
+    264d:	e8 4e ea ff ff       	call   10a0 <memset@plt>
+}
+    2652:	90                   	nop
+    2653:	c9                   	leave
+    2654:	c3                   	ret
+
+0000000000002655 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    2655:	55                   	push   %rbp
+    2656:	48 89 e5             	mov    %rsp,%rbp
+    2659:	48 83 ec 20          	sub    $0x20,%rsp
+    265d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2661:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2665:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    //     *id = *is;
+    // }
+    // for (uint8_t *id = d, *is = s, *const e = (d + n); id != e; ++is, ++id) {
+    //     *is = 0xa5;
+    // }
+    copy(d, s, n);
+    2669:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    266d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2671:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2675:	48 89 ce             	mov    %rcx,%rsi
+    2678:	48 89 c7             	mov    %rax,%rdi
+    267b:	e8 79 ff ff ff       	call   25f9 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    poison(s, n);
+    2680:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2684:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2688:	48 89 d6             	mov    %rdx,%rsi
+    268b:	48 89 c7             	mov    %rax,%rdi
+    268e:	e8 60 07 00 00       	call   2df3 <nel::elem::poison(unsigned char*, unsigned long)>
+}
+    2693:	90                   	nop
+    2694:	c9                   	leave
+    2695:	c3                   	ret
+
+0000000000002696 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    2696:	55                   	push   %rbp
+    2697:	48 89 e5             	mov    %rsp,%rbp
+    269a:	48 83 ec 20          	sub    $0x20,%rsp
+    269e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    26a2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    26a6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    std::memmove(d, s, n);
+    26aa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    26ae:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    26b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26b6:	48 89 ce             	mov    %rcx,%rsi
+    26b9:	48 89 c7             	mov    %rax,%rdi
+    26bc:	e8 7f ea ff ff       	call   1140 <memmove@plt>
+}
+    26c1:	90                   	nop
+    26c2:	c9                   	leave
+    26c3:	c3                   	ret
+
+00000000000026c4 <nel::elem::wipe(unsigned char*, unsigned long)>:
+
+void wipe(uint8_t *const d, Length const n)
+{
+    26c4:	55                   	push   %rbp
+    26c5:	48 89 e5             	mov    %rsp,%rbp
+    26c8:	48 83 ec 10          	sub    $0x10,%rsp
+    26cc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    26d0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    set(d, 0xa5, n);
+    26d4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    26d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26dc:	be a5 00 00 00       	mov    $0xa5,%esi
+    26e1:	48 89 c7             	mov    %rax,%rdi
+    26e4:	e8 3e ff ff ff       	call   2627 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    26e9:	90                   	nop
+    26ea:	c9                   	leave
+    26eb:	c3                   	ret
+
+00000000000026ec <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    26ec:	55                   	push   %rbp
+    26ed:	48 89 e5             	mov    %rsp,%rbp
+    26f0:	48 83 ec 20          	sub    $0x20,%rsp
+    26f4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    26f8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    26fc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    2700:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2704:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2708:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    270c:	48 89 ce             	mov    %rcx,%rsi
+    270f:	48 89 c7             	mov    %rax,%rdi
+    2712:	e8 a9 e9 ff ff       	call   10c0 <memcmp@plt>
+    2717:	85 c0                	test   %eax,%eax
+    2719:	0f 94 c0             	sete   %al
+}
+    271c:	c9                   	leave
+    271d:	c3                   	ret
+
+000000000000271e <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    271e:	55                   	push   %rbp
+    271f:	48 89 e5             	mov    %rsp,%rbp
+    2722:	48 83 ec 20          	sub    $0x20,%rsp
+    2726:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    272a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    272e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    2732:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2736:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    273a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    273e:	48 89 ce             	mov    %rcx,%rsi
+    2741:	48 89 c7             	mov    %rax,%rdi
+    2744:	e8 77 e9 ff ff       	call   10c0 <memcmp@plt>
+    2749:	85 c0                	test   %eax,%eax
+    274b:	0f 95 c0             	setne  %al
+}
+    274e:	c9                   	leave
+    274f:	c3                   	ret
+
+0000000000002750 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>:
+
+// d[i] = p[i % 16] for i in [0, n), with normal stores:
+// the pattern once, then doubling the filled region.
+static void set_pattern(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    2750:	       55                   	push   %rbp
+    2751:	       48 89 e5             	mov    %rsp,%rbp
+    2754:	       48 83 ec 30          	sub    $0x30,%rsp
+    2758:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    275c:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2760:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    Length done = (n < 16) ? n : 16;
+    2764:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2768:	       ba 10 00 00 00       	mov    $0x10,%edx
+    276d:	       48 39 d0             	cmp    %rdx,%rax
+    2770:	       48 0f 47 c2          	cmova  %rdx,%rax
+    2774:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    copy(d, p, done);
+    2778:	       48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    277c:	       48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2780:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2784:	       48 89 ce             	mov    %rcx,%rsi
+    2787:	       48 89 c7             	mov    %rax,%rdi
+    278a:	       e8 6a fe ff ff       	call   25f9 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    while (done < n) {
+    278f:	   /-- eb 3e                	jmp    27cf <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x7f>
+        Length const m = (done < n - done) ? done : n - done;
+    2791:	/--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2795:	|  |   48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    2799:	|  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    279d:	|  |   48 39 c2             	cmp    %rax,%rdx
+    27a0:	|  |   48 0f 46 c2          	cmovbe %rdx,%rax
+    27a4:	|  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        copy(d + done, d, m);
+    27a8:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    27ac:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27b0:	|  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    27b4:	|  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    27b8:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27bc:	|  |   48 89 c6             	mov    %rax,%rsi
+    27bf:	|  |   48 89 cf             	mov    %rcx,%rdi
+    27c2:	|  |   e8 32 fe ff ff       	call   25f9 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        done += m;
+    27c7:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    27cb:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+    while (done < n) {
+    27cf:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27d3:	|      48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    27d7:	\----- 72 b8                	jb     2791 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x41>
+    }
+}
+    27d9:	       90                   	nop
+    27da:	       90                   	nop
+    27db:	       c9                   	leave
+    27dc:	       c3                   	ret
+
+00000000000027dd <nel::elem::load16(unsigned char const*)>:
+static constexpr Length streaming_min = 256;
+
+typedef long long int Line16 __attribute__((vector_size(16)));
+
+static inline Line16 load16(uint8_t const *const s)
+{
+    27dd:	55                   	push   %rbp
+    27de:	48 89 e5             	mov    %rsp,%rbp
+    27e1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Line16 v;
+    std::memcpy(&v, s, sizeof(v));
+    27e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27e9:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    27ed:	48 8b 00             	mov    (%rax),%rax
+    27f0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    27f4:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    return v;
+    27f8:	66 0f 6f 45 f0       	movdqa -0x10(%rbp),%xmm0
+}
+    27fd:	5d                   	pop    %rbp
+    27fe:	c3                   	ret
+
+00000000000027ff <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>:
+
+static inline void stream16(uint8_t *const d, Line16 const &v)
+{
+    27ff:	55                   	push   %rbp
+    2800:	48 89 e5             	mov    %rsp,%rbp
+    2803:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2807:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    280b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    280f:	66 0f 6f 00          	movdqa (%rax),%xmm0
+    2813:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2817:	66 0f e7 00          	movntdq %xmm0,(%rax)
+}
+    281b:	90                   	nop
+    281c:	5d                   	pop    %rbp
+    281d:	c3                   	ret
+
+000000000000281e <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    281e:	          55                   	push   %rbp
+    281f:	          48 89 e5             	mov    %rsp,%rbp
+    2822:	          48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    2826:	          48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    282a:	          48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    282e:	          48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    if (n < streaming_min) {
+    2832:	          48 81 7d 88 ff 00 00 	cmpq   $0xff,-0x78(%rbp)
+    2839:	          00 
+    283a:	      /-- 77 1c                	ja     2858 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        copy(d, s, n);
+    283c:	      |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    2840:	      |   48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    2844:	      |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2848:	      |   48 89 ce             	mov    %rcx,%rsi
+    284b:	      |   48 89 c7             	mov    %rax,%rdi
+    284e:	      |   e8 a6 fd ff ff       	call   25f9 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        return;
+    2853:	/-----|-- e9 98 01 00 00       	jmp    29f0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1d2>
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2858:	|     \-> 48 8b 45 98          	mov    -0x68(%rbp),%rax
+    285c:	|         48 f7 d8             	neg    %rax
+    285f:	|         83 e0 0f             	and    $0xf,%eax
+    2862:	|         48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    copy(d, s, head);
+    2866:	|         48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    286a:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    286e:	|         48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2872:	|         48 89 ce             	mov    %rcx,%rsi
+    2875:	|         48 89 c7             	mov    %rax,%rdi
+    2878:	|         e8 7c fd ff ff       	call   25f9 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    Index i = head;
+    287d:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2881:	|         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    2885:	|     /-- e9 e1 00 00 00       	jmp    296b <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        Line16 const a = load16(s + i);
+    288a:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    288e:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2892:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2895:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2898:	|  |  |   e8 40 ff ff ff       	call   27dd <nel::elem::load16(unsigned char const*)>
+    289d:	|  |  |   0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+        Line16 const b = load16(s + i + 16);
+    28a1:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28a5:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    28a9:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    28ad:	|  |  |   48 01 d0             	add    %rdx,%rax
+    28b0:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    28b3:	|  |  |   e8 25 ff ff ff       	call   27dd <nel::elem::load16(unsigned char const*)>
+    28b8:	|  |  |   0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+        Line16 const c = load16(s + i + 32);
+    28bc:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28c0:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    28c4:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    28c8:	|  |  |   48 01 d0             	add    %rdx,%rax
+    28cb:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    28ce:	|  |  |   e8 0a ff ff ff       	call   27dd <nel::elem::load16(unsigned char const*)>
+    28d3:	|  |  |   0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+        Line16 const e = load16(s + i + 48);
+    28d7:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28db:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    28df:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    28e3:	|  |  |   48 01 d0             	add    %rdx,%rax
+    28e6:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    28e9:	|  |  |   e8 ef fe ff ff       	call   27dd <nel::elem::load16(unsigned char const*)>
+    28ee:	|  |  |   0f 29 45 a0          	movaps %xmm0,-0x60(%rbp)
+        stream16(d + i, a);
+    28f2:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    28f6:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28fa:	|  |  |   48 01 c2             	add    %rax,%rdx
+    28fd:	|  |  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    2901:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2904:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2907:	|  |  |   e8 f3 fe ff ff       	call   27ff <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, b);
+    290c:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2910:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    2914:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2918:	|  |  |   48 01 c2             	add    %rax,%rdx
+    291b:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    291f:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2922:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2925:	|  |  |   e8 d5 fe ff ff       	call   27ff <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, c);
+    292a:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    292e:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    2932:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2936:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2939:	|  |  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    293d:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2940:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2943:	|  |  |   e8 b7 fe ff ff       	call   27ff <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, e);
+    2948:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    294c:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    2950:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2954:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2957:	|  |  |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    295b:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    295e:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2961:	|  |  |   e8 99 fe ff ff       	call   27ff <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    2966:	|  |  |   48 83 45 f8 40       	addq   $0x40,-0x8(%rbp)
+    296b:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    296f:	|  |      48 83 c0 40          	add    $0x40,%rax
+    2973:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    2977:	|  \----- 0f 83 0d ff ff ff    	jae    288a <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x6c>
+    }
+    for (; i + 16 <= n; i += 16) {
+    297d:	|     /-- eb 36                	jmp    29b5 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x197>
+        stream16(d + i, load16(s + i));
+    297f:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    2983:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2987:	|  |  |   48 01 d0             	add    %rdx,%rax
+    298a:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    298d:	|  |  |   e8 4b fe ff ff       	call   27dd <nel::elem::load16(unsigned char const*)>
+    2992:	|  |  |   0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+    2996:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    299a:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    299e:	|  |  |   48 01 c2             	add    %rax,%rdx
+    29a1:	|  |  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    29a5:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    29a8:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    29ab:	|  |  |   e8 4f fe ff ff       	call   27ff <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    29b0:	|  |  |   48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+    29b5:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29b9:	|  |      48 83 c0 10          	add    $0x10,%rax
+    29bd:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    29c1:	|  \----- 73 bc                	jae    297f <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    29c3:	|         0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    29c6:	|         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    29ca:	|         48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    29ce:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    29d2:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    29d6:	|         48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    29da:	|         48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+    29de:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    29e2:	|         48 01 d1             	add    %rdx,%rcx
+    29e5:	|         48 89 c2             	mov    %rax,%rdx
+    29e8:	|         48 89 cf             	mov    %rcx,%rdi
+    29eb:	|         e8 09 fc ff ff       	call   25f9 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+}
+    29f0:	\-------> c9                   	leave
+    29f1:	          c3                   	ret
+
+00000000000029f2 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    29f2:	          55                   	push   %rbp
+    29f3:	          48 89 e5             	mov    %rsp,%rbp
+    29f6:	          48 83 ec 60          	sub    $0x60,%rsp
+    29fa:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    29fe:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    2a02:	          48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    if (n < streaming_min) {
+    2a06:	          48 81 7d a8 ff 00 00 	cmpq   $0xff,-0x58(%rbp)
+    2a0d:	          00 
+    2a0e:	      /-- 77 1c                	ja     2a2c <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        set_pattern(d, p, n);
+    2a10:	      |   48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    2a14:	      |   48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+    2a18:	      |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2a1c:	      |   48 89 ce             	mov    %rcx,%rsi
+    2a1f:	      |   48 89 c7             	mov    %rax,%rdi
+    2a22:	      |   e8 29 fd ff ff       	call   2750 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>
+    2a27:	/-----|-- e9 89 01 00 00       	jmp    2bb5 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c3>
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2a2c:	|     \-> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2a30:	|         48 f7 d8             	neg    %rax
+    2a33:	|         83 e0 0f             	and    $0xf,%eax
+    2a36:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    for (Index i = 0; i < head; ++i) {
+    2a3a:	|         48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    2a41:	|         00 
+    2a42:	|     /-- eb 20                	jmp    2a64 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x72>
+        d[i] = p[i];
+    2a44:	|  /--|-> 48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    2a48:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a4c:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2a4f:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    2a53:	|  |  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2a57:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    2a5a:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    2a5d:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < head; ++i) {
+    2a5f:	|  |  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    2a64:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a68:	|  |      48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    2a6c:	|  \----- 72 d6                	jb     2a44 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x52>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    2a6e:	|         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    2a75:	|         00 
+    2a76:	|     /-- eb 2d                	jmp    2aa5 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xb3>
+        rotated[i] = p[(head + i) % 16];
+    2a78:	|  /--|-> 48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2a7c:	|  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a80:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2a83:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    2a86:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    2a89:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2a8d:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2a90:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    2a93:	|  |  |   48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    2a97:	|  |  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2a9b:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    2a9e:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < 16; ++i) {
+    2aa0:	|  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    2aa5:	|  |  \-> 48 83 7d f0 0f       	cmpq   $0xf,-0x10(%rbp)
+    2aaa:	|  \----- 76 cc                	jbe    2a78 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x86>
+    }
+    Line16 const v = load16(rotated);
+    2aac:	|         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    2ab0:	|         48 89 c7             	mov    %rax,%rdi
+    2ab3:	|         e8 25 fd ff ff       	call   27dd <nel::elem::load16(unsigned char const*)>
+    2ab8:	|         0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+    Index i = head;
+    2abc:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2ac0:	|         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    2ac4:	|     /-- eb 79                	jmp    2b3f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        stream16(d + i, v);
+    2ac6:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    2aca:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ace:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2ad1:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2ad5:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2ad8:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2adb:	|  |  |   e8 1f fd ff ff       	call   27ff <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, v);
+    2ae0:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ae4:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    2ae8:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2aec:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2aef:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2af3:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2af6:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2af9:	|  |  |   e8 01 fd ff ff       	call   27ff <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, v);
+    2afe:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b02:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    2b06:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2b0a:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2b0d:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2b11:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2b14:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2b17:	|  |  |   e8 e3 fc ff ff       	call   27ff <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, v);
+    2b1c:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b20:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    2b24:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2b28:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2b2b:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2b2f:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2b32:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2b35:	|  |  |   e8 c5 fc ff ff       	call   27ff <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    2b3a:	|  |  |   48 83 45 e8 40       	addq   $0x40,-0x18(%rbp)
+    2b3f:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b43:	|  |      48 83 c0 40          	add    $0x40,%rax
+    2b47:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    2b4b:	|  \----- 0f 83 75 ff ff ff    	jae    2ac6 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd4>
+    }
+    for (; i + 16 <= n; i += 16) {
+    2b51:	|     /-- eb 1f                	jmp    2b72 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x180>
+        stream16(d + i, v);
+    2b53:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    2b57:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b5b:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2b5e:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2b62:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2b65:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2b68:	|  |  |   e8 92 fc ff ff       	call   27ff <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    2b6d:	|  |  |   48 83 45 e8 10       	addq   $0x10,-0x18(%rbp)
+    2b72:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b76:	|  |      48 83 c0 10          	add    $0x10,%rax
+    2b7a:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    2b7e:	|  \----- 73 d3                	jae    2b53 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    __builtin_ia32_sfence();
+    2b80:	|         0f ae f8             	sfence
+    for (; i < n; ++i) {
+    2b83:	|     /-- eb 26                	jmp    2bab <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1b9>
+        d[i] = p[i % 16];
+    2b85:	|  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b89:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    2b8c:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    2b8f:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2b93:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2b96:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    2b9a:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2b9e:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    2ba1:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    2ba4:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (; i < n; ++i) {
+    2ba6:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    2bab:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2baf:	|  |      48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    2bb3:	|  \----- 72 d0                	jb     2b85 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x193>
+    }
+}
+    2bb5:	\-------> c9                   	leave
+    2bb6:	          c3                   	ret
+
+0000000000002bb7 <nel::offset_of(unsigned char*, unsigned long)>:
+// The payload is the first align boundary leaving room for a Length in front,
+// which holds the offset from the start of the underlying allocation.
+// Malloc alignment is at least alignof(Length), so the payload is at most
+// align bytes in.
+static Length offset_of(uint8_t *const base, Length const align)
+{
+    2bb7:	55                   	push   %rbp
+    2bb8:	48 89 e5             	mov    %rsp,%rbp
+    2bbb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2bbf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    USize const a = reinterpret_cast<USize>(base) + sizeof(Length);
+    2bc3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2bc7:	48 83 c0 08          	add    $0x8,%rax
+    2bcb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    2bcf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2bd3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2bd7:	48 01 d0             	add    %rdx,%rax
+    2bda:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    2bde:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2be2:	48 f7 d8             	neg    %rax
+    2be5:	48 21 c2             	and    %rax,%rdx
+    2be8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2bec:	48 29 c2             	sub    %rax,%rdx
+    2bef:	48 89 d0             	mov    %rdx,%rax
+}
+    2bf2:	5d                   	pop    %rbp
+    2bf3:	c3                   	ret
+
+0000000000002bf4 <nel::offset_field(unsigned char*)>:
+
+static Length &offset_field(uint8_t *const p)
+{
+    2bf4:	55                   	push   %rbp
+    2bf5:	48 89 e5             	mov    %rsp,%rbp
+    2bf8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return reinterpret_cast<Length *>(p)[-1];
+    2bfc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c00:	48 83 e8 08          	sub    $0x8,%rax
+}
+    2c04:	5d                   	pop    %rbp
+    2c05:	c3                   	ret
+
+0000000000002c06 <nel::free_aligned(void*)>:
+
+void free_aligned(void *const p)
+{
+    2c06:	       55                   	push   %rbp
+    2c07:	       48 89 e5             	mov    %rsp,%rbp
+    2c0a:	       48 83 ec 20          	sub    $0x20,%rsp
+    2c0e:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (p == nullptr) { return; }
+    2c12:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    2c17:	/----- 74 2e                	je     2c47 <nel::free_aligned(void*)+0x41>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    2c19:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c1d:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    std::free(u8p - offset_field(u8p));
+    2c21:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c25:	|      48 89 c7             	mov    %rax,%rdi
+    2c28:	|      e8 c7 ff ff ff       	call   2bf4 <nel::offset_field(unsigned char*)>
+    2c2d:	|      48 8b 00             	mov    (%rax),%rax
+    2c30:	|      48 f7 d8             	neg    %rax
+    2c33:	|      48 89 c2             	mov    %rax,%rdx
+    2c36:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c3a:	|      48 01 d0             	add    %rdx,%rax
+    2c3d:	|      48 89 c7             	mov    %rax,%rdi
+    2c40:	|      e8 eb e3 ff ff       	call   1030 <free@plt>
+    2c45:	|  /-- eb 01                	jmp    2c48 <nel::free_aligned(void*)+0x42>
+    if (p == nullptr) { return; }
+    2c47:	\--|-> 90                   	nop
+}
+    2c48:	   \-> c9                   	leave
+    2c49:	       c3                   	ret
+
+0000000000002c4a <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    2c4a:	             55                   	push   %rbp
+    2c4b:	             48 89 e5             	mov    %rsp,%rbp
+    2c4e:	             53                   	push   %rbx
+    2c4f:	             48 83 ec 78          	sub    $0x78,%rsp
+    2c53:	             48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    2c57:	             48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    2c5b:	             48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    2c5f:	             48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    2c63:	             48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    2c67:	             b9 f3 00 00 00       	mov    $0xf3,%ecx
+    2c6c:	             48 8d 15 4d 26 00 00 	lea    0x264d(%rip),%rdx        # 52c0 <nel::elem::streaming_min+0x8>
+    2c73:	             48 8d 35 58 26 00 00 	lea    0x2658(%rip),%rsi        # 52d2 <nel::elem::streaming_min+0x1a>
+    2c7a:	             48 89 c7             	mov    %rax,%rdi
+    2c7d:	             e8 98 f1 ff ff       	call   1e1a <nel::Context::Context(char const*, char const*, int)>
+    2c82:	             48 83 7d 90 00       	cmpq   $0x0,-0x70(%rbp)
+    2c87:	      /----- 74 18                	je     2ca1 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    2c89:	      |      48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2c8d:	      |      48 83 e8 01          	sub    $0x1,%rax
+    2c91:	      |      48 23 45 90          	and    -0x70(%rbp),%rax
+    2c95:	      |      48 85 c0             	test   %rax,%rax
+    2c98:	      +----- 75 07                	jne    2ca1 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    2c9a:	      |      b8 01 00 00 00       	mov    $0x1,%eax
+    2c9f:	      |  /-- eb 05                	jmp    2ca6 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x5c>
+    2ca1:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    2ca6:	         \-> 0f b6 c0             	movzbl %al,%eax
+    2ca9:	             48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    2cad:	             48 8d 0d 2e 26 00 00 	lea    0x262e(%rip),%rcx        # 52e2 <nel::elem::streaming_min+0x2a>
+    2cb4:	             48 89 ce             	mov    %rcx,%rsi
+    2cb7:	             89 c7                	mov    %eax,%edi
+    2cb9:	             e8 5b 01 00 00       	call   2e19 <nel::assert(bool, char const*, nel::Context const&)>
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    2cbe:	             48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2cc2:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    2cc6:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    2ccb:	      /----- 74 11                	je     2cde <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x94>
+    2ccd:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2cd1:	      |      48 89 c7             	mov    %rax,%rdi
+    2cd4:	      |      e8 1b ff ff ff       	call   2bf4 <nel::offset_field(unsigned char*)>
+    2cd9:	      |      48 8b 00             	mov    (%rax),%rax
+    2cdc:	      |  /-- eb 05                	jmp    2ce3 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x99>
+    2cde:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    2ce3:	         \-> 48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    2ce7:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    2cec:	      /----- 74 13                	je     2d01 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb7>
+    2cee:	      |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2cf2:	      |      48 f7 d8             	neg    %rax
+    2cf5:	      |      48 89 c2             	mov    %rax,%rdx
+    2cf8:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2cfc:	      |      48 01 d0             	add    %rdx,%rax
+    2cff:	      |  /-- eb 05                	jmp    2d06 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xbc>
+    2d01:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    2d06:	         \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2d0a:	             48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    2d0e:	             48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2d12:	             48 01 c2             	add    %rax,%rdx
+    2d15:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2d19:	             48 89 d6             	mov    %rdx,%rsi
+    2d1c:	             48 89 c7             	mov    %rax,%rdi
+    2d1f:	             e8 fc e3 ff ff       	call   1120 <realloc@plt>
+    2d24:	             48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if (new_base == nullptr) { return nullptr; }
+    2d28:	             48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    2d2d:	         /-- 75 0a                	jne    2d39 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    2d2f:	         |   b8 00 00 00 00       	mov    $0x0,%eax
+    2d34:	/--------|-- e9 85 00 00 00       	jmp    2dbe <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x174>
+
+    Length const new_offset = offset_of(new_base, align);
+    2d39:	|        \-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    2d3d:	|            48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2d41:	|            48 89 d6             	mov    %rdx,%rsi
+    2d44:	|            48 89 c7             	mov    %rax,%rdi
+    2d47:	|            e8 6b fe ff ff       	call   2bb7 <nel::offset_of(unsigned char*, unsigned long)>
+    2d4c:	|            48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    uint8_t *const new_p = new_base + new_offset;
+    2d50:	|            48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    2d54:	|            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2d58:	|            48 01 d0             	add    %rdx,%rax
+    2d5b:	|            48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    if (old_p != nullptr && new_offset != old_offset) {
+    2d5f:	|            48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    2d64:	|  /-------- 74 41                	je     2da7 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+    2d66:	|  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2d6a:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    2d6e:	|  +-------- 74 37                	je     2da7 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+    2d70:	|  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    2d74:	|  |         48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    2d78:	|  |  /----- 73 06                	jae    2d80 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x136>
+    2d7a:	|  |  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    2d7e:	|  |  |  /-- eb 04                	jmp    2d84 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x13a>
+    2d80:	|  |  \--|-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    2d84:	|  |     \-> 48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        std::memmove(new_p, new_base + old_offset, n);
+    2d88:	|  |         48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    2d8c:	|  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2d90:	|  |         48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    2d94:	|  |         48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    2d98:	|  |         48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2d9c:	|  |         48 89 ce             	mov    %rcx,%rsi
+    2d9f:	|  |         48 89 c7             	mov    %rax,%rdi
+    2da2:	|  |         e8 99 e3 ff ff       	call   1140 <memmove@plt>
+    }
+    offset_field(new_p) = new_offset;
+    2da7:	|  \-------> 48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+    2dab:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2daf:	|            48 89 c7             	mov    %rax,%rdi
+    2db2:	|            e8 3d fe ff ff       	call   2bf4 <nel::offset_field(unsigned char*)>
+    2db7:	|            48 89 18             	mov    %rbx,(%rax)
+    return new_p;
+    2dba:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+}
+    2dbe:	\----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2dc2:	             c9                   	leave
+    2dc3:	             c3                   	ret
+
+0000000000002dc4 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    2dc4:	55                   	push   %rbp
+    2dc5:	48 89 e5             	mov    %rsp,%rbp
+    2dc8:	48 83 ec 10          	sub    $0x10,%rsp
+    2dcc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2dd0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return realloc_aligned(nullptr, align, 0, size);
+    2dd4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2dd8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ddc:	48 89 d1             	mov    %rdx,%rcx
+    2ddf:	ba 00 00 00 00       	mov    $0x0,%edx
+    2de4:	48 89 c6             	mov    %rax,%rsi
+    2de7:	bf 00 00 00 00       	mov    $0x0,%edi
+    2dec:	e8 59 fe ff ff       	call   2c4a <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+}
+    2df1:	c9                   	leave
+    2df2:	c3                   	ret
+
+0000000000002df3 <nel::elem::poison(unsigned char*, unsigned long)>:
+{
+    2df3:	55                   	push   %rbp
+    2df4:	48 89 e5             	mov    %rsp,%rbp
+    2df7:	48 83 ec 10          	sub    $0x10,%rsp
+    2dfb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2dff:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    copy(d, s, n);
+    2e03:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2e07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e0b:	48 89 d6             	mov    %rdx,%rsi
+    2e0e:	48 89 c7             	mov    %rax,%rdi
+    2e11:	e8 ae f8 ff ff       	call   26c4 <nel::elem::wipe(unsigned char*, unsigned long)>
+}
+    2e16:	90                   	nop
+    2e17:	c9                   	leave
+    2e18:	c3                   	ret
+
+0000000000002e19 <nel::assert(bool, char const*, nel::Context const&)>:
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx);
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    2e19:	    55                   	push   %rbp
+    2e1a:	    48 89 e5             	mov    %rsp,%rbp
+    2e1d:	    48 83 ec 20          	sub    $0x20,%rsp
+    2e21:	    89 f8                	mov    %edi,%eax
+    2e23:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2e27:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2e2b:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { assert_fail(msg, ctx); }
+    2e2e:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    2e32:	    83 f0 01             	xor    $0x1,%eax
+    2e35:	    84 c0                	test   %al,%al
+    2e37:	/-- 74 13                	je     2e4c <nel::assert(bool, char const*, nel::Context const&)+0x33>
+    2e39:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2e3d:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e41:	|   48 89 d6             	mov    %rdx,%rsi
+    2e44:	|   48 89 c7             	mov    %rax,%rdi
+    2e47:	|   e8 52 f7 ff ff       	call   259e <nel::assert_fail(char const*, nel::Context const&)>
+}
+    2e4c:	\-> 90                   	nop
+    2e4d:	    c9                   	leave
+    2e4e:	    c3                   	ret
+
+0000000000002e4f <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    2e4f:	55                   	push   %rbp
+    2e50:	48 89 e5             	mov    %rsp,%rbp
+    2e53:	48 83 ec 10          	sub    $0x10,%rsp
+    2e57:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2e5b:	89 f0                	mov    %esi,%eax
+    2e5d:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    2e60:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    2e64:	48 8b 15 75 52 00 00 	mov    0x5275(%rip),%rdx        # 80e0 <stderr@GLIBC_2.2.5>
+    2e6b:	48 89 d6             	mov    %rdx,%rsi
+    2e6e:	89 c7                	mov    %eax,%edi
+    2e70:	e8 3b e2 ff ff       	call   10b0 <fputc@plt>
+    return outs;
+    2e75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2e79:	c9                   	leave
+    2e7a:	c3                   	ret
+
+0000000000002e7b <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    2e7b:	55                   	push   %rbp
+    2e7c:	48 89 e5             	mov    %rsp,%rbp
+    2e7f:	48 83 ec 10          	sub    $0x10,%rsp
+    2e83:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2e87:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    2e8b:	48 8b 15 4e 52 00 00 	mov    0x524e(%rip),%rdx        # 80e0 <stderr@GLIBC_2.2.5>
+    2e92:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e96:	48 89 d6             	mov    %rdx,%rsi
+    2e99:	48 89 c7             	mov    %rax,%rdi
+    2e9c:	e8 ef e1 ff ff       	call   1090 <fputs@plt>
+    return outs;
+    2ea1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2ea5:	c9                   	leave
+    2ea6:	c3                   	ret
+
+0000000000002ea7 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    2ea7:	55                   	push   %rbp
+    2ea8:	48 89 e5             	mov    %rsp,%rbp
+    2eab:	48 83 ec 10          	sub    $0x10,%rsp
+    2eaf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2eb3:	89 f0                	mov    %esi,%eax
+    2eb5:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    2eb8:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    2ebc:	48 8b 05 1d 52 00 00 	mov    0x521d(%rip),%rax        # 80e0 <stderr@GLIBC_2.2.5>
+    2ec3:	48 8d 0d 33 24 00 00 	lea    0x2433(%rip),%rcx        # 52fd <nel::elem::streaming_min+0x45>
+    2eca:	48 89 ce             	mov    %rcx,%rsi
+    2ecd:	48 89 c7             	mov    %rax,%rdi
+    2ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+    2ed5:	e8 06 e2 ff ff       	call   10e0 <fprintf@plt>
+    return outs;
+    2eda:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2ede:	c9                   	leave
+    2edf:	c3                   	ret
+
+0000000000002ee0 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    2ee0:	55                   	push   %rbp
+    2ee1:	48 89 e5             	mov    %rsp,%rbp
+    2ee4:	48 83 ec 10          	sub    $0x10,%rsp
+    2ee8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2eec:	89 f0                	mov    %esi,%eax
+    2eee:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    2ef2:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    2ef6:	48 8b 05 e3 51 00 00 	mov    0x51e3(%rip),%rax        # 80e0 <stderr@GLIBC_2.2.5>
+    2efd:	48 8d 0d f9 23 00 00 	lea    0x23f9(%rip),%rcx        # 52fd <nel::elem::streaming_min+0x45>
+    2f04:	48 89 ce             	mov    %rcx,%rsi
+    2f07:	48 89 c7             	mov    %rax,%rdi
+    2f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+    2f0f:	e8 cc e1 ff ff       	call   10e0 <fprintf@plt>
+    return outs;
+    2f14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2f18:	c9                   	leave
+    2f19:	c3                   	ret
+
+0000000000002f1a <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    2f1a:	55                   	push   %rbp
+    2f1b:	48 89 e5             	mov    %rsp,%rbp
+    2f1e:	48 83 ec 10          	sub    $0x10,%rsp
+    2f22:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2f26:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    2f29:	48 8b 05 b0 51 00 00 	mov    0x51b0(%rip),%rax        # 80e0 <stderr@GLIBC_2.2.5>
+    2f30:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    2f33:	48 8d 0d c3 23 00 00 	lea    0x23c3(%rip),%rcx        # 52fd <nel::elem::streaming_min+0x45>
+    2f3a:	48 89 ce             	mov    %rcx,%rsi
+    2f3d:	48 89 c7             	mov    %rax,%rdi
+    2f40:	b8 00 00 00 00       	mov    $0x0,%eax
+    2f45:	e8 96 e1 ff ff       	call   10e0 <fprintf@plt>
+    return outs;
+    2f4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2f4e:	c9                   	leave
+    2f4f:	c3                   	ret
+
+0000000000002f50 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    2f50:	55                   	push   %rbp
+    2f51:	48 89 e5             	mov    %rsp,%rbp
+    2f54:	48 83 ec 10          	sub    $0x10,%rsp
+    2f58:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2f5c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    2f5f:	48 8b 05 7a 51 00 00 	mov    0x517a(%rip),%rax        # 80e0 <stderr@GLIBC_2.2.5>
+    2f66:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    2f69:	48 8d 0d 8d 23 00 00 	lea    0x238d(%rip),%rcx        # 52fd <nel::elem::streaming_min+0x45>
+    2f70:	48 89 ce             	mov    %rcx,%rsi
+    2f73:	48 89 c7             	mov    %rax,%rdi
+    2f76:	b8 00 00 00 00       	mov    $0x0,%eax
+    2f7b:	e8 60 e1 ff ff       	call   10e0 <fprintf@plt>
+    return outs;
+    2f80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2f84:	c9                   	leave
+    2f85:	c3                   	ret
+
+0000000000002f86 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    2f86:	55                   	push   %rbp
+    2f87:	48 89 e5             	mov    %rsp,%rbp
+    2f8a:	48 83 ec 10          	sub    $0x10,%rsp
+    2f8e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2f92:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    2f96:	48 8b 05 43 51 00 00 	mov    0x5143(%rip),%rax        # 80e0 <stderr@GLIBC_2.2.5>
+    2f9d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2fa1:	48 8d 0d 58 23 00 00 	lea    0x2358(%rip),%rcx        # 5300 <nel::elem::streaming_min+0x48>
+    2fa8:	48 89 ce             	mov    %rcx,%rsi
+    2fab:	48 89 c7             	mov    %rax,%rdi
+    2fae:	b8 00 00 00 00       	mov    $0x0,%eax
+    2fb3:	e8 28 e1 ff ff       	call   10e0 <fprintf@plt>
+    return outs;
+    2fb8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2fbc:	c9                   	leave
+    2fbd:	c3                   	ret
+
+0000000000002fbe <nel::par::(anonymous namespace)::run_chunks(bool (*)(void*, unsigned long), void*, unsigned long, unsigned long&, bool&)>:
+typedef heaped::Malloc Alloc;
+
+// Claim and run chunks until none are left, or one fails.
+void run_chunks(Pool::Task const task, void *const ctx, Count const n_chunks, Index &next,
+                bool &failed)
+{
+    2fbe:	          55                   	push   %rbp
+    2fbf:	          48 89 e5             	mov    %rsp,%rbp
+    2fc2:	          48 83 ec 40          	sub    $0x40,%rsp
+    2fc6:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2fca:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2fce:	          48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    2fd2:	          48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    2fd6:	          4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    while (!__atomic_load_n(&failed, __ATOMIC_RELAXED)) {
+    2fda:	      /-- eb 42                	jmp    301e <nel::par::(anonymous namespace)::run_chunks(bool (*)(void*, unsigned long), void*, unsigned long, unsigned long&, bool&)+0x60>
+        Index const c = __atomic_fetch_add(&next, 1, __ATOMIC_RELAXED);
+    2fdc:	/-----|-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2fe0:	|     |   ba 01 00 00 00       	mov    $0x1,%edx
+    2fe5:	|     |   f0 48 0f c1 10       	lock xadd %rdx,(%rax)
+    2fea:	|     |   48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+        if (c >= n_chunks) { break; }
+    2fee:	|     |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ff2:	|     |   48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    2ff6:	|  /--|-- 73 38                	jae    3030 <nel::par::(anonymous namespace)::run_chunks(bool (*)(void*, unsigned long), void*, unsigned long, unsigned long&, bool&)+0x72>
+        if (!task(ctx, c)) { __atomic_store_n(&failed, true, __ATOMIC_RELAXED); }
+    2ff8:	|  |  |   48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    2ffc:	|  |  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3000:	|  |  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3004:	|  |  |   48 89 d6             	mov    %rdx,%rsi
+    3007:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    300a:	|  |  |   ff d1                	call   *%rcx
+    300c:	|  |  |   83 f0 01             	xor    $0x1,%eax
+    300f:	|  |  |   84 c0                	test   %al,%al
+    3011:	|  |  +-- 74 0b                	je     301e <nel::par::(anonymous namespace)::run_chunks(bool (*)(void*, unsigned long), void*, unsigned long, unsigned long&, bool&)+0x60>
+    3013:	|  |  |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3017:	|  |  |   ba 01 00 00 00       	mov    $0x1,%edx
+    301c:	|  |  |   88 10                	mov    %dl,(%rax)
+    while (!__atomic_load_n(&failed, __ATOMIC_RELAXED)) {
+    301e:	|  |  \-> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3022:	|  |      0f b6 00             	movzbl (%rax),%eax
+    3025:	|  |      84 c0                	test   %al,%al
+    3027:	|  |      0f 94 c0             	sete   %al
+    302a:	|  |      84 c0                	test   %al,%al
+    302c:	\--|----- 75 ae                	jne    2fdc <nel::par::(anonymous namespace)::run_chunks(bool (*)(void*, unsigned long), void*, unsigned long, unsigned long&, bool&)+0x1e>
+    }
+}
+    302e:	   |  /-- eb 01                	jmp    3031 <nel::par::(anonymous namespace)::run_chunks(bool (*)(void*, unsigned long), void*, unsigned long, unsigned long&, bool&)+0x73>
+        if (c >= n_chunks) { break; }
+    3030:	   \--|-> 90                   	nop
+}
+    3031:	      \-> 90                   	nop
+    3032:	          c9                   	leave
+    3033:	          c3                   	ret
+
+0000000000003034 <nel::par::(anonymous namespace)::worker_main(void*)>:
+
+#if defined(NEL_PAR_PTHREADS)
+
+void *worker_main(void *const arg)
+{
+    3034:	          55                   	push   %rbp
+    3035:	          48 89 e5             	mov    %rsp,%rbp
+    3038:	          48 83 ec 40          	sub    $0x40,%rsp
+    303c:	          48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    Pool::Shared *const s = static_cast<Pool::Shared *>(arg);
+    3040:	          48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3044:	          48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    USize seen = 0;
+    3048:	          48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    304f:	          00 
+
+    pthread_mutex_lock(&s->lock_);
+    3050:	          48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3054:	          48 83 c0 40          	add    $0x40,%rax
+    3058:	          48 89 c7             	mov    %rax,%rdi
+    305b:	          e8 30 e1 ff ff       	call   1190 <pthread_mutex_lock@plt>
+    for (;;) {
+        while (!s->stop_ && s->generation_ == seen) {
+    3060:	/-----/-X eb 1b                	jmp    307d <nel::par::(anonymous namespace)::worker_main(void*)+0x49>
+            pthread_cond_wait(&s->wake_, &s->lock_);
+    3062:	|  /--|-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3066:	|  |  |   48 8d 50 40          	lea    0x40(%rax),%rdx
+    306a:	|  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    306e:	|  |  |   48 83 c0 68          	add    $0x68,%rax
+    3072:	|  |  |   48 89 d6             	mov    %rdx,%rsi
+    3075:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3078:	|  |  |   e8 f3 df ff ff       	call   1070 <pthread_cond_wait@plt>
+        while (!s->stop_ && s->generation_ == seen) {
+    307d:	|  |  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3081:	|  |      0f b6 80 d8 00 00 00 	movzbl 0xd8(%rax),%eax
+    3088:	|  |      83 f0 01             	xor    $0x1,%eax
+    308b:	|  |      84 c0                	test   %al,%al
+    308d:	|  |  /-- 74 11                	je     30a0 <nel::par::(anonymous namespace)::worker_main(void*)+0x6c>
+    308f:	|  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3093:	|  |  |   48 8b 80 c8 00 00 00 	mov    0xc8(%rax),%rax
+    309a:	|  |  |   48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    309e:	|  \--|-- 74 c2                	je     3062 <nel::par::(anonymous namespace)::worker_main(void*)+0x2e>
+        }
+        if (s->stop_) { break; }
+    30a0:	|     \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    30a4:	|         0f b6 80 d8 00 00 00 	movzbl 0xd8(%rax),%eax
+    30ab:	|         84 c0                	test   %al,%al
+    30ad:	|     /-- 0f 85 ce 00 00 00    	jne    3181 <nel::par::(anonymous namespace)::worker_main(void*)+0x14d>
+        seen = s->generation_;
+    30b3:	|     |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    30b7:	|     |   48 8b 80 c8 00 00 00 	mov    0xc8(%rax),%rax
+    30be:	|     |   48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        Pool::Task const task = s->task_;
+    30c2:	|     |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    30c6:	|     |   48 8b 80 e0 00 00 00 	mov    0xe0(%rax),%rax
+    30cd:	|     |   48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        void *const ctx = s->ctx_;
+    30d1:	|     |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    30d5:	|     |   48 8b 80 e8 00 00 00 	mov    0xe8(%rax),%rax
+    30dc:	|     |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        Count const n_chunks = s->n_chunks_;
+    30e0:	|     |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    30e4:	|     |   48 8b 80 f0 00 00 00 	mov    0xf0(%rax),%rax
+    30eb:	|     |   48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        pthread_mutex_unlock(&s->lock_);
+    30ef:	|     |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    30f3:	|     |   48 83 c0 40          	add    $0x40,%rax
+    30f7:	|     |   48 89 c7             	mov    %rax,%rdi
+    30fa:	|     |   e8 11 e0 ff ff       	call   1110 <pthread_mutex_unlock@plt>
+
+        run_chunks(task, ctx, n_chunks, s->next_, s->failed_);
+    30ff:	|     |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3103:	|     |   48 8d b8 00 01 00 00 	lea    0x100(%rax),%rdi
+    310a:	|     |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    310e:	|     |   48 8d 88 f8 00 00 00 	lea    0xf8(%rax),%rcx
+    3115:	|     |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    3119:	|     |   48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+    311d:	|     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3121:	|     |   49 89 f8             	mov    %rdi,%r8
+    3124:	|     |   48 89 c7             	mov    %rax,%rdi
+    3127:	|     |   e8 92 fe ff ff       	call   2fbe <nel::par::(anonymous namespace)::run_chunks(bool (*)(void*, unsigned long), void*, unsigned long, unsigned long&, bool&)>
+
+        pthread_mutex_lock(&s->lock_);
+    312c:	|     |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3130:	|     |   48 83 c0 40          	add    $0x40,%rax
+    3134:	|     |   48 89 c7             	mov    %rax,%rdi
+    3137:	|     |   e8 54 e0 ff ff       	call   1190 <pthread_mutex_lock@plt>
+        s->busy_ -= 1;
+    313c:	|     |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3140:	|     |   48 8b 80 d0 00 00 00 	mov    0xd0(%rax),%rax
+    3147:	|     |   48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    314b:	|     |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    314f:	|     |   48 89 90 d0 00 00 00 	mov    %rdx,0xd0(%rax)
+        if (s->busy_ == 0) { pthread_cond_signal(&s->idle_); }
+    3156:	|     |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    315a:	|     |   48 8b 80 d0 00 00 00 	mov    0xd0(%rax),%rax
+    3161:	|     |   48 85 c0             	test   %rax,%rax
+    3164:	+-----|-- 0f 85 f6 fe ff ff    	jne    3060 <nel::par::(anonymous namespace)::worker_main(void*)+0x2c>
+    316a:	|     |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    316e:	|     |   48 05 98 00 00 00    	add    $0x98,%rax
+    3174:	|     |   48 89 c7             	mov    %rax,%rdi
+    3177:	|     |   e8 54 df ff ff       	call   10d0 <pthread_cond_signal@plt>
+    }
+    317c:	\-----|-- e9 df fe ff ff       	jmp    3060 <nel::par::(anonymous namespace)::worker_main(void*)+0x2c>
+        if (s->stop_) { break; }
+    3181:	      \-> 90                   	nop
+    pthread_mutex_unlock(&s->lock_);
+    3182:	          48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3186:	          48 83 c0 40          	add    $0x40,%rax
+    318a:	          48 89 c7             	mov    %rax,%rdi
+    318d:	          e8 7e df ff ff       	call   1110 <pthread_mutex_unlock@plt>
+    return nullptr;
+    3192:	          b8 00 00 00 00       	mov    $0x0,%eax
+}
+    3197:	          c9                   	leave
+    3198:	          c3                   	ret
+
+0000000000003199 <nel::par::(anonymous namespace)::destroy(nel::par::Pool::Shared*)>:
+
+// Stop and join the started workers, then free s.
+void destroy(Pool::Shared *const s)
+{
+    3199:	       55                   	push   %rbp
+    319a:	       48 89 e5             	mov    %rsp,%rbp
+    319d:	       48 83 ec 20          	sub    $0x20,%rsp
+    31a1:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    pthread_mutex_lock(&s->lock_);
+    31a5:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31a9:	       48 83 c0 40          	add    $0x40,%rax
+    31ad:	       48 89 c7             	mov    %rax,%rdi
+    31b0:	       e8 db df ff ff       	call   1190 <pthread_mutex_lock@plt>
+    s->stop_ = true;
+    31b5:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31b9:	       c6 80 d8 00 00 00 01 	movb   $0x1,0xd8(%rax)
+    pthread_cond_broadcast(&s->wake_);
+    31c0:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31c4:	       48 83 c0 68          	add    $0x68,%rax
+    31c8:	       48 89 c7             	mov    %rax,%rdi
+    31cb:	       e8 80 de ff ff       	call   1050 <pthread_cond_broadcast@plt>
+    pthread_mutex_unlock(&s->lock_);
+    31d0:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31d4:	       48 83 c0 40          	add    $0x40,%rax
+    31d8:	       48 89 c7             	mov    %rax,%rdi
+    31db:	       e8 30 df ff ff       	call   1110 <pthread_mutex_unlock@plt>
+
+    for (Index i = 0; i < s->n_workers_; ++i) {
+    31e0:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    31e7:	       00 
+    31e8:	   /-- eb 28                	jmp    3212 <nel::par::(anonymous namespace)::destroy(nel::par::Pool::Shared*)+0x79>
+        pthread_join(s->workers_[i], nullptr);
+    31ea:	/--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31ee:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    31f2:	|  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    31f6:	|  |   48 c1 e2 03          	shl    $0x3,%rdx
+    31fa:	|  |   48 01 d0             	add    %rdx,%rax
+    31fd:	|  |   48 8b 00             	mov    (%rax),%rax
+    3200:	|  |   be 00 00 00 00       	mov    $0x0,%esi
+    3205:	|  |   48 89 c7             	mov    %rax,%rdi
+    3208:	|  |   e8 63 df ff ff       	call   1170 <pthread_join@plt>
+    for (Index i = 0; i < s->n_workers_; ++i) {
+    320d:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    3212:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3216:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    321a:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    321e:	\----- 72 ca                	jb     31ea <nel::par::(anonymous namespace)::destroy(nel::par::Pool::Shared*)+0x51>
+    }
+
+    pthread_cond_destroy(&s->idle_);
+    3220:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3224:	       48 05 98 00 00 00    	add    $0x98,%rax
+    322a:	       48 89 c7             	mov    %rax,%rdi
+    322d:	       e8 1e df ff ff       	call   1150 <pthread_cond_destroy@plt>
+    pthread_cond_destroy(&s->wake_);
+    3232:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3236:	       48 83 c0 68          	add    $0x68,%rax
+    323a:	       48 89 c7             	mov    %rax,%rdi
+    323d:	       e8 0e df ff ff       	call   1150 <pthread_cond_destroy@plt>
+    pthread_mutex_destroy(&s->lock_);
+    3242:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3246:	       48 83 c0 40          	add    $0x40,%rax
+    324a:	       48 89 c7             	mov    %rax,%rdi
+    324d:	       e8 2e de ff ff       	call   1080 <pthread_mutex_destroy@plt>
+    pthread_mutex_destroy(&s->run_lock_);
+    3252:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3256:	       48 83 c0 18          	add    $0x18,%rax
+    325a:	       48 89 c7             	mov    %rax,%rdi
+    325d:	       e8 1e de ff ff       	call   1080 <pthread_mutex_destroy@plt>
+    if (s->workers_ != nullptr) {
+    3262:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3266:	       48 8b 40 10          	mov    0x10(%rax),%rax
+    326a:	       48 85 c0             	test   %rax,%rax
+    326d:	   /-- 74 28                	je     3297 <nel::par::(anonymous namespace)::destroy(nel::par::Pool::Shared*)+0xfe>
+        Alloc::free(s->workers_, alignof(pthread_t), (s->n_threads_ - 1) * sizeof(pthread_t));
+    326f:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3273:	   |   48 8b 00             	mov    (%rax),%rax
+    3276:	   |   48 83 e8 01          	sub    $0x1,%rax
+    327a:	   |   48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3281:	   |   00 
+    3282:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3286:	   |   48 8b 40 10          	mov    0x10(%rax),%rax
+    328a:	   |   be 08 00 00 00       	mov    $0x8,%esi
+    328f:	   |   48 89 c7             	mov    %rax,%rdi
+    3292:	   |   e8 ef 08 00 00       	call   3b86 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>
+    }
+    Alloc::free(s, alignof(Pool::Shared), sizeof(Pool::Shared));
+    3297:	   \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    329b:	       ba 08 01 00 00       	mov    $0x108,%edx
+    32a0:	       be 08 00 00 00       	mov    $0x8,%esi
+    32a5:	       48 89 c7             	mov    %rax,%rdi
+    32a8:	       e8 d9 08 00 00       	call   3b86 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>
+}
+    32ad:	       90                   	nop
+    32ae:	       c9                   	leave
+    32af:	       c3                   	ret
+
+00000000000032b0 <nel::par::Pool::~Pool()>:
+
+#endif // defined(NEL_PAR_PTHREADS)
+
+} // namespace
+
+Pool::~Pool(void)
+    32b0:	    55                   	push   %rbp
+    32b1:	    48 89 e5             	mov    %rsp,%rbp
+    32b4:	    48 83 ec 10          	sub    $0x10,%rsp
+    32b8:	    48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    if (shared_ != nullptr) { destroy(shared_); }
+    32bc:	    48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32c0:	    48 8b 00             	mov    (%rax),%rax
+    32c3:	    48 85 c0             	test   %rax,%rax
+    32c6:	/-- 74 0f                	je     32d7 <nel::par::Pool::~Pool()+0x27>
+    32c8:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32cc:	|   48 8b 00             	mov    (%rax),%rax
+    32cf:	|   48 89 c7             	mov    %rax,%rdi
+    32d2:	|   e8 c2 fe ff ff       	call   3199 <nel::par::(anonymous namespace)::destroy(nel::par::Pool::Shared*)>
+}
+    32d7:	\-> 90                   	nop
+    32d8:	    c9                   	leave
+    32d9:	    c3                   	ret
+
+00000000000032da <nel::par::Pool::operator=(nel::par::Pool&&)>:
+
+Pool &Pool::operator=(Pool &&o)
+{
+    32da:	       55                   	push   %rbp
+    32db:	       48 89 e5             	mov    %rsp,%rbp
+    32de:	       48 83 ec 10          	sub    $0x10,%rsp
+    32e2:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    32e6:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    if (this != &o) {
+    32ea:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32ee:	       48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    32f2:	/----- 74 34                	je     3328 <nel::par::Pool::operator=(nel::par::Pool&&)+0x4e>
+        if (shared_ != nullptr) { destroy(shared_); }
+    32f4:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32f8:	|      48 8b 00             	mov    (%rax),%rax
+    32fb:	|      48 85 c0             	test   %rax,%rax
+    32fe:	|  /-- 74 0f                	je     330f <nel::par::Pool::operator=(nel::par::Pool&&)+0x35>
+    3300:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3304:	|  |   48 8b 00             	mov    (%rax),%rax
+    3307:	|  |   48 89 c7             	mov    %rax,%rdi
+    330a:	|  |   e8 8a fe ff ff       	call   3199 <nel::par::(anonymous namespace)::destroy(nel::par::Pool::Shared*)>
+        shared_ = o.shared_;
+    330f:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3313:	|      48 8b 10             	mov    (%rax),%rdx
+    3316:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    331a:	|      48 89 10             	mov    %rdx,(%rax)
+        o.shared_ = nullptr;
+    331d:	|      48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3321:	|      48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+    }
+    return *this;
+    3328:	\----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    332c:	       c9                   	leave
+    332d:	       c3                   	ret
+
+000000000000332e <nel::par::Pool::available_parallelism()>:
+
+Count Pool::available_parallelism(void)
+{
+    332e:	       55                   	push   %rbp
+    332f:	       48 89 e5             	mov    %rsp,%rbp
+    3332:	       48 83 ec 10          	sub    $0x10,%rsp
+#if defined(NEL_PAR_PTHREADS)
+    long const n = sysconf(_SC_NPROCESSORS_ONLN);
+    3336:	       bf 54 00 00 00       	mov    $0x54,%edi
+    333b:	       e8 20 de ff ff       	call   1160 <sysconf@plt>
+    3340:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return (n < 1) ? 1 : Count(n);
+    3344:	       48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    3349:	/----- 7e 06                	jle    3351 <nel::par::Pool::available_parallelism()+0x23>
+    334b:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    334f:	|  /-- eb 05                	jmp    3356 <nel::par::Pool::available_parallelism()+0x28>
+    3351:	\--|-> b8 01 00 00 00       	mov    $0x1,%eax
+#else
+    return 1;
+#endif
+}
+    3356:	   \-> c9                   	leave
+    3357:	       c3                   	ret
+
+0000000000003358 <nel::par::Pool::try_new(unsigned long)>:
+
+Result<Pool, ParError> Pool::try_new(Count const n)
+{
+    3358:	                55                   	push   %rbp
+    3359:	                48 89 e5             	mov    %rsp,%rbp
+    335c:	                53                   	push   %rbx
+    335d:	                48 81 ec e8 00 00 00 	sub    $0xe8,%rsp
+    3364:	                48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+    336b:	                48 89 b5 10 ff ff ff 	mov    %rsi,-0xf0(%rbp)
+#if defined(NEL_PAR_PTHREADS)
+    Count const n_threads = (n == 0) ? available_parallelism() : n;
+    3372:	                48 83 bd 10 ff ff ff 	cmpq   $0x0,-0xf0(%rbp)
+    3379:	                00 
+    337a:	            /-- 75 07                	jne    3383 <nel::par::Pool::try_new(unsigned long)+0x2b>
+    337c:	            |   e8 ad ff ff ff       	call   332e <nel::par::Pool::available_parallelism()>
+    3381:	         /--|-- eb 07                	jmp    338a <nel::par::Pool::try_new(unsigned long)+0x32>
+    3383:	         |  \-> 48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+    338a:	         \----> 48 89 45 e0          	mov    %rax,-0x20(%rbp)
+#else
+    Count const n_threads = 1;
+    nel::unused(n);
+#endif
+
+    auto rs = Alloc::try_malloc(alignof(Shared), sizeof(Shared));
+    338e:	                48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+    3395:	                ba 08 01 00 00       	mov    $0x108,%edx
+    339a:	                be 08 00 00 00       	mov    $0x8,%esi
+    339f:	                48 89 c7             	mov    %rax,%rdi
+    33a2:	                e8 d5 06 00 00       	call   3a7c <nel::heaped::Malloc::try_malloc(unsigned long, unsigned long)>
+    if (rs.is_err()) { return Result<Pool, ParError>::Err(ParError::OutOfMemory); }
+    33a7:	                48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+    33ae:	                b9 a2 00 00 00       	mov    $0xa2,%ecx
+    33b3:	                48 8d 15 92 1f 00 00 	lea    0x1f92(%rip),%rdx        # 534c <nel::sort::ninther_n+0x2c>
+    33ba:	                48 8d 35 9f 1f 00 00 	lea    0x1f9f(%rip),%rsi        # 5360 <nel::sort::ninther_n+0x40>
+    33c1:	                48 89 c7             	mov    %rax,%rdi
+    33c4:	                e8 51 ea ff ff       	call   1e1a <nel::Context::Context(char const*, char const*, int)>
+    33c9:	                48 8d 95 50 ff ff ff 	lea    -0xb0(%rbp),%rdx
+    33d0:	                48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+    33d7:	                48 89 d6             	mov    %rdx,%rsi
+    33da:	                48 89 c7             	mov    %rax,%rdi
+    33dd:	                e8 88 0a 00 00       	call   3e6a <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>
+    33e2:	                84 c0                	test   %al,%al
+    33e4:	            /-- 74 28                	je     340e <nel::par::Pool::try_new(unsigned long)+0xb6>
+    33e6:	            |   c7 85 6c ff ff ff 03 	movl   $0x3,-0x94(%rbp)
+    33ed:	            |   00 00 00 
+    33f0:	            |   48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+    33f7:	            |   48 8d 95 6c ff ff ff 	lea    -0x94(%rbp),%rdx
+    33fe:	            |   48 89 d6             	mov    %rdx,%rsi
+    3401:	            |   48 89 c7             	mov    %rax,%rdi
+    3404:	            |   e8 8b 0a 00 00       	call   3e94 <nel::Result<nel::par::Pool, nel::par::ParError>::Err(nel::par::ParError&&)>
+    3409:	/-----------|-- e9 df 02 00 00       	jmp    36ed <nel::par::Pool::try_new(unsigned long)+0x395>
+    Shared *const s = static_cast<Shared *>(rs.unwrap());
+    340e:	|           \-> 48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    3415:	|               b9 a3 00 00 00       	mov    $0xa3,%ecx
+    341a:	|               48 8d 15 2b 1f 00 00 	lea    0x1f2b(%rip),%rdx        # 534c <nel::sort::ninther_n+0x2c>
+    3421:	|               48 8d 35 38 1f 00 00 	lea    0x1f38(%rip),%rsi        # 5360 <nel::sort::ninther_n+0x40>
+    3428:	|               48 89 c7             	mov    %rax,%rdi
+    342b:	|               e8 ea e9 ff ff       	call   1e1a <nel::Context::Context(char const*, char const*, int)>
+    3430:	|               48 8d 95 70 ff ff ff 	lea    -0x90(%rbp),%rdx
+    3437:	|               48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+    343e:	|               48 89 d6             	mov    %rdx,%rsi
+    3441:	|               48 89 c7             	mov    %rax,%rdi
+    3444:	|               e8 31 08 00 00       	call   3c7a <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+    3449:	|               48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    s->n_threads_ = n_threads;
+    344d:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3451:	|               48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    3455:	|               48 89 10             	mov    %rdx,(%rax)
+    s->task_ = nullptr;
+    3458:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    345c:	|               48 c7 80 e0 00 00 00 	movq   $0x0,0xe0(%rax)
+    3463:	|               00 00 00 00 
+    s->ctx_ = nullptr;
+    3467:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    346b:	|               48 c7 80 e8 00 00 00 	movq   $0x0,0xe8(%rax)
+    3472:	|               00 00 00 00 
+    s->n_chunks_ = 0;
+    3476:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    347a:	|               48 c7 80 f0 00 00 00 	movq   $0x0,0xf0(%rax)
+    3481:	|               00 00 00 00 
+    s->next_ = 0;
+    3485:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3489:	|               48 c7 80 f8 00 00 00 	movq   $0x0,0xf8(%rax)
+    3490:	|               00 00 00 00 
+    s->failed_ = false;
+    3494:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3498:	|               c6 80 00 01 00 00 00 	movb   $0x0,0x100(%rax)
+
+#if defined(NEL_PAR_PTHREADS)
+    s->n_workers_ = 0;
+    349f:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    34a3:	|               48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    34aa:	|               00 
+    s->workers_ = nullptr;
+    34ab:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    34af:	|               48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+    34b6:	|               00 
+    s->generation_ = 0;
+    34b7:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    34bb:	|               48 c7 80 c8 00 00 00 	movq   $0x0,0xc8(%rax)
+    34c2:	|               00 00 00 00 
+    s->busy_ = 0;
+    34c6:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    34ca:	|               48 c7 80 d0 00 00 00 	movq   $0x0,0xd0(%rax)
+    34d1:	|               00 00 00 00 
+    s->stop_ = false;
+    34d5:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    34d9:	|               c6 80 d8 00 00 00 00 	movb   $0x0,0xd8(%rax)
+    pthread_mutex_init(&s->run_lock_, nullptr);
+    34e0:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    34e4:	|               48 83 c0 18          	add    $0x18,%rax
+    34e8:	|               be 00 00 00 00       	mov    $0x0,%esi
+    34ed:	|               48 89 c7             	mov    %rax,%rdi
+    34f0:	|               e8 8b dc ff ff       	call   1180 <pthread_mutex_init@plt>
+    pthread_mutex_init(&s->lock_, nullptr);
+    34f5:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    34f9:	|               48 83 c0 40          	add    $0x40,%rax
+    34fd:	|               be 00 00 00 00       	mov    $0x0,%esi
+    3502:	|               48 89 c7             	mov    %rax,%rdi
+    3505:	|               e8 76 dc ff ff       	call   1180 <pthread_mutex_init@plt>
+    pthread_cond_init(&s->wake_, nullptr);
+    350a:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    350e:	|               48 83 c0 68          	add    $0x68,%rax
+    3512:	|               be 00 00 00 00       	mov    $0x0,%esi
+    3517:	|               48 89 c7             	mov    %rax,%rdi
+    351a:	|               e8 e1 db ff ff       	call   1100 <pthread_cond_init@plt>
+    pthread_cond_init(&s->idle_, nullptr);
+    351f:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3523:	|               48 05 98 00 00 00    	add    $0x98,%rax
+    3529:	|               be 00 00 00 00       	mov    $0x0,%esi
+    352e:	|               48 89 c7             	mov    %rax,%rdi
+    3531:	|               e8 ca db ff ff       	call   1100 <pthread_cond_init@plt>
+
+    // Pool now owns s, so destroys it on any failure below.
+    Pool pool(s);
+    3536:	|               48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    353a:	|               48 8d 85 38 ff ff ff 	lea    -0xc8(%rbp),%rax
+    3541:	|               48 89 d6             	mov    %rdx,%rsi
+    3544:	|               48 89 c7             	mov    %rax,%rdi
+    3547:	|               e8 c8 06 00 00       	call   3c14 <nel::par::Pool::Pool(nel::par::Pool::Shared*)>
+
+    if (n_threads > 1) {
+    354c:	|               48 83 7d e0 01       	cmpq   $0x1,-0x20(%rbp)
+    3551:	|     /-------- 0f 86 db 00 00 00    	jbe    3632 <nel::par::Pool::try_new(unsigned long)+0x2da>
+        auto rw = Alloc::try_malloc(alignof(pthread_t), (n_threads - 1) * sizeof(pthread_t));
+    3557:	|     |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    355b:	|     |         48 83 e8 01          	sub    $0x1,%rax
+    355f:	|     |         48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3566:	|     |         00 
+    3567:	|     |         48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+    356e:	|     |         be 08 00 00 00       	mov    $0x8,%esi
+    3573:	|     |         48 89 c7             	mov    %rax,%rdi
+    3576:	|     |         e8 01 05 00 00       	call   3a7c <nel::heaped::Malloc::try_malloc(unsigned long, unsigned long)>
+        if (rw.is_err()) { return Result<Pool, ParError>::Err(ParError::OutOfMemory); }
+    357b:	|     |         48 8d 45 90          	lea    -0x70(%rbp),%rax
+    357f:	|     |         b9 bb 00 00 00       	mov    $0xbb,%ecx
+    3584:	|     |         48 8d 15 c1 1d 00 00 	lea    0x1dc1(%rip),%rdx        # 534c <nel::sort::ninther_n+0x2c>
+    358b:	|     |         48 8d 35 ce 1d 00 00 	lea    0x1dce(%rip),%rsi        # 5360 <nel::sort::ninther_n+0x40>
+    3592:	|     |         48 89 c7             	mov    %rax,%rdi
+    3595:	|     |         e8 80 e8 ff ff       	call   1e1a <nel::Context::Context(char const*, char const*, int)>
+    359a:	|     |         48 8d 55 90          	lea    -0x70(%rbp),%rdx
+    359e:	|     |         48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+    35a5:	|     |         48 89 d6             	mov    %rdx,%rsi
+    35a8:	|     |         48 89 c7             	mov    %rax,%rdi
+    35ab:	|     |         e8 ba 08 00 00       	call   3e6a <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>
+    35b0:	|     |         84 c0                	test   %al,%al
+    35b2:	|     |     /-- 74 24                	je     35d8 <nel::par::Pool::try_new(unsigned long)+0x280>
+    35b4:	|     |     |   c7 45 ac 03 00 00 00 	movl   $0x3,-0x54(%rbp)
+    35bb:	|     |     |   48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+    35c2:	|     |     |   48 8d 55 ac          	lea    -0x54(%rbp),%rdx
+    35c6:	|     |     |   48 89 d6             	mov    %rdx,%rsi
+    35c9:	|     |     |   48 89 c7             	mov    %rax,%rdi
+    35cc:	|     |     |   e8 c3 08 00 00       	call   3e94 <nel::Result<nel::par::Pool, nel::par::ParError>::Err(nel::par::ParError&&)>
+    35d1:	|     |     |   bb 00 00 00 00       	mov    $0x0,%ebx
+    35d6:	|     |  /--|-- eb 42                	jmp    361a <nel::par::Pool::try_new(unsigned long)+0x2c2>
+        s->workers_ = static_cast<pthread_t *>(rw.unwrap());
+    35d8:	|     |  |  \-> 48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    35dc:	|     |  |      b9 bc 00 00 00       	mov    $0xbc,%ecx
+    35e1:	|     |  |      48 8d 15 64 1d 00 00 	lea    0x1d64(%rip),%rdx        # 534c <nel::sort::ninther_n+0x2c>
+    35e8:	|     |  |      48 8d 35 71 1d 00 00 	lea    0x1d71(%rip),%rsi        # 5360 <nel::sort::ninther_n+0x40>
+    35ef:	|     |  |      48 89 c7             	mov    %rax,%rdi
+    35f2:	|     |  |      e8 23 e8 ff ff       	call   1e1a <nel::Context::Context(char const*, char const*, int)>
+    35f7:	|     |  |      48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    35fb:	|     |  |      48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+    3602:	|     |  |      48 89 d6             	mov    %rdx,%rsi
+    3605:	|     |  |      48 89 c7             	mov    %rax,%rdi
+    3608:	|     |  |      e8 6d 06 00 00       	call   3c7a <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+    360d:	|     |  |      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    3611:	|     |  |      48 89 42 10          	mov    %rax,0x10(%rdx)
+    }
+    3615:	|     |  |      bb 01 00 00 00       	mov    $0x1,%ebx
+    361a:	|     |  \----> 48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+    3621:	|     |         48 89 c7             	mov    %rax,%rdi
+    3624:	|     |         e8 4d 07 00 00       	call   3d76 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+    3629:	|     |         83 fb 01             	cmp    $0x1,%ebx
+    362c:	|  /--|-------- 0f 85 ac 00 00 00    	jne    36de <nel::par::Pool::try_new(unsigned long)+0x386>
+
+    for (Index i = 0; i < n_threads - 1; ++i) {
+    3632:	|  |  \-------> 48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+    3639:	|  |            00 
+    363a:	|  |     /----- eb 70                	jmp    36ac <nel::par::Pool::try_new(unsigned long)+0x354>
+        if (pthread_create(&s->workers_[i], nullptr, worker_main, s) != 0) {
+    363c:	|  |  /--|----> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3640:	|  |  |  |      48 8b 40 10          	mov    0x10(%rax),%rax
+    3644:	|  |  |  |      48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3648:	|  |  |  |      48 c1 e2 03          	shl    $0x3,%rdx
+    364c:	|  |  |  |      48 8d 3c 10          	lea    (%rax,%rdx,1),%rdi
+    3650:	|  |  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3654:	|  |  |  |      48 89 c1             	mov    %rax,%rcx
+    3657:	|  |  |  |      48 8d 05 d6 f9 ff ff 	lea    -0x62a(%rip),%rax        # 3034 <nel::par::(anonymous namespace)::worker_main(void*)>
+    365e:	|  |  |  |      48 89 c2             	mov    %rax,%rdx
+    3661:	|  |  |  |      be 00 00 00 00       	mov    $0x0,%esi
+    3666:	|  |  |  |      e8 c5 da ff ff       	call   1130 <pthread_create@plt>
+    366b:	|  |  |  |      85 c0                	test   %eax,%eax
+    366d:	|  |  |  |      0f 95 c0             	setne  %al
+    3670:	|  |  |  |      84 c0                	test   %al,%al
+    3672:	|  |  |  |  /-- 74 1f                	je     3693 <nel::par::Pool::try_new(unsigned long)+0x33b>
+            return Result<Pool, ParError>::Err(ParError::SpawnFailed);
+    3674:	|  |  |  |  |   c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+    367b:	|  |  |  |  |   48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+    3682:	|  |  |  |  |   48 8d 55 d4          	lea    -0x2c(%rbp),%rdx
+    3686:	|  |  |  |  |   48 89 d6             	mov    %rdx,%rsi
+    3689:	|  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    368c:	|  |  |  |  |   e8 03 08 00 00       	call   3e94 <nel::Result<nel::par::Pool, nel::par::ParError>::Err(nel::par::ParError&&)>
+    3691:	|  +--|--|--|-- eb 4b                	jmp    36de <nel::par::Pool::try_new(unsigned long)+0x386>
+        }
+        s->n_workers_ += 1;
+    3693:	|  |  |  |  \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3697:	|  |  |  |      48 8b 40 08          	mov    0x8(%rax),%rax
+    369b:	|  |  |  |      48 8d 50 01          	lea    0x1(%rax),%rdx
+    369f:	|  |  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    36a3:	|  |  |  |      48 89 50 08          	mov    %rdx,0x8(%rax)
+    for (Index i = 0; i < n_threads - 1; ++i) {
+    36a7:	|  |  |  |      48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    36ac:	|  |  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    36b0:	|  |  |         48 83 e8 01          	sub    $0x1,%rax
+    36b4:	|  |  |         48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    36b8:	|  |  \-------- 72 82                	jb     363c <nel::par::Pool::try_new(unsigned long)+0x2e4>
+    }
+    return Result<Pool, ParError>::Ok(move(pool));
+    36ba:	|  |            48 8d 85 38 ff ff ff 	lea    -0xc8(%rbp),%rax
+    36c1:	|  |            48 89 c7             	mov    %rax,%rdi
+    36c4:	|  |            e8 4f 08 00 00       	call   3f18 <nel::par::Pool&& nel::move<nel::par::Pool>(nel::par::Pool&)>
+    36c9:	|  |            48 89 c2             	mov    %rax,%rdx
+    36cc:	|  |            48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+    36d3:	|  |            48 89 d6             	mov    %rdx,%rsi
+    36d6:	|  |            48 89 c7             	mov    %rax,%rdi
+    36d9:	|  |            e8 48 08 00 00       	call   3f26 <nel::Result<nel::par::Pool, nel::par::ParError>::Ok(nel::par::Pool&&)>
+#else
+    return Result<Pool, ParError>::Ok(Pool(s));
+#endif
+}
+    36de:	|  \----------> 48 8d 85 38 ff ff ff 	lea    -0xc8(%rbp),%rax
+    36e5:	|               48 89 c7             	mov    %rax,%rdi
+    36e8:	|               e8 c3 fb ff ff       	call   32b0 <nel::par::Pool::~Pool()>
+    36ed:	\-------------> 48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+    36f4:	                48 89 c7             	mov    %rax,%rdi
+    36f7:	                e8 7a 06 00 00       	call   3d76 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+    36fc:	                48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+    3703:	                48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3707:	                c9                   	leave
+    3708:	                c3                   	ret
+    3709:	                90                   	nop
+
+000000000000370a <nel::par::Pool::n_threads() const>:
+
+Count Pool::n_threads(void) const
+{
+    370a:	55                   	push   %rbp
+    370b:	48 89 e5             	mov    %rsp,%rbp
+    370e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return shared_->n_threads_;
+    3712:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3716:	48 8b 00             	mov    (%rax),%rax
+    3719:	48 8b 00             	mov    (%rax),%rax
+}
+    371c:	5d                   	pop    %rbp
+    371d:	c3                   	ret
+
+000000000000371e <nel::par::Pool::chunk_len(unsigned long, unsigned long) const>:
+
+Length Pool::chunk_len(Length const len, Length const item_size) const
+{
+    371e:	       55                   	push   %rbp
+    371f:	       48 89 e5             	mov    %rsp,%rbp
+    3722:	       48 83 ec 48          	sub    $0x48,%rsp
+    3726:	       48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    372a:	       48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    372e:	       48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    // fewest items that make whole cache lines: cache_line / gcd(item_size, cache_line).
+    Length const pow2 = item_size & (~item_size + 1);
+    3732:	       48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3736:	       48 f7 d8             	neg    %rax
+    3739:	       48 23 45 b8          	and    -0x48(%rbp),%rax
+    373d:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    Length const line_items = cache_line / ((pow2 < cache_line) ? pow2 : cache_line);
+    3741:	       48 83 7d f8 3f       	cmpq   $0x3f,-0x8(%rbp)
+    3746:	/----- 77 06                	ja     374e <nel::par::Pool::chunk_len(unsigned long, unsigned long) const+0x30>
+    3748:	|      48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    374c:	|  /-- eb 05                	jmp    3753 <nel::par::Pool::chunk_len(unsigned long, unsigned long) const+0x35>
+    374e:	\--|-> b9 40 00 00 00       	mov    $0x40,%ecx
+    3753:	   \-> b8 40 00 00 00       	mov    $0x40,%eax
+    3758:	       ba 00 00 00 00       	mov    $0x0,%edx
+    375d:	       48 f7 f1             	div    %rcx
+    3760:	       48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    Length const min_items = (item_size < min_chunk_bytes) ? min_chunk_bytes / item_size : 1;
+    3764:	       48 81 7d b8 ff 7f 00 	cmpq   $0x7fff,-0x48(%rbp)
+    376b:	       00 
+    376c:	/----- 77 10                	ja     377e <nel::par::Pool::chunk_len(unsigned long, unsigned long) const+0x60>
+    376e:	|      b8 00 80 00 00       	mov    $0x8000,%eax
+    3773:	|      ba 00 00 00 00       	mov    $0x0,%edx
+    3778:	|      48 f7 75 b8          	divq   -0x48(%rbp)
+    377c:	|  /-- eb 05                	jmp    3783 <nel::par::Pool::chunk_len(unsigned long, unsigned long) const+0x65>
+    377e:	\--|-> b8 01 00 00 00       	mov    $0x1,%eax
+    3783:	   \-> 48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    Length const even = len / (n_threads() * chunks_per_thread);
+    3787:	       48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    378b:	       48 89 c7             	mov    %rax,%rdi
+    378e:	       e8 77 ff ff ff       	call   370a <nel::par::Pool::n_threads() const>
+    3793:	       48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+    379a:	       00 
+    379b:	       48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    379f:	       ba 00 00 00 00       	mov    $0x0,%edx
+    37a4:	       48 f7 f6             	div    %rsi
+    37a7:	       48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    Length const c = (even > min_items) ? even : min_items;
+    37ab:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    37af:	       48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    37b3:	/----- 73 06                	jae    37bb <nel::par::Pool::chunk_len(unsigned long, unsigned long) const+0x9d>
+    37b5:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    37b9:	|  /-- eb 04                	jmp    37bf <nel::par::Pool::chunk_len(unsigned long, unsigned long) const+0xa1>
+    37bb:	\--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    37bf:	   \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    return ((c + line_items - 1) / line_items) * line_items;
+    37c3:	       48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    37c7:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    37cb:	       48 01 d0             	add    %rdx,%rax
+    37ce:	       48 83 e8 01          	sub    $0x1,%rax
+    37d2:	       ba 00 00 00 00       	mov    $0x0,%edx
+    37d7:	       48 f7 75 f0          	divq   -0x10(%rbp)
+    37db:	       48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+}
+    37e0:	       c9                   	leave
+    37e1:	       c3                   	ret
+
+00000000000037e2 <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const>:
+
+Chunks Pool::chunks(void const *const p, Length const len, Length const item_size) const
+{
+    37e2:	             55                   	push   %rbp
+    37e3:	             48 89 e5             	mov    %rsp,%rbp
+    37e6:	             48 83 ec 50          	sub    $0x50,%rsp
+    37ea:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    37ee:	             48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    37f2:	             48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    37f6:	             48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+    37fa:	             4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+    Length const cl = chunk_len(len, item_size);
+    37fe:	             48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    3802:	             48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+    3806:	             48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    380a:	             48 89 ce             	mov    %rcx,%rsi
+    380d:	             48 89 c7             	mov    %rax,%rdi
+    3810:	             e8 09 ff ff ff       	call   371e <nel::par::Pool::chunk_len(unsigned long, unsigned long) const>
+    3815:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    // items up to the first cache line edge, if an item boundary lands on one.
+    USize const off = reinterpret_cast<USize>(p) % cache_line;
+    3819:	             48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    381d:	             83 e0 3f             	and    $0x3f,%eax
+    3820:	             48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    Length head = 0;
+    3824:	             48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    382b:	             00 
+    if (off != 0) {
+    382c:	             48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    3831:	/----------- 74 3b                	je     386e <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const+0x8c>
+        for (Length h = 1; h < cache_line; ++h) {
+    3833:	|            48 c7 45 f0 01 00 00 	movq   $0x1,-0x10(%rbp)
+    383a:	|            00 
+    383b:	|     /----- eb 2a                	jmp    3867 <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const+0x85>
+            if ((off + h * item_size) % cache_line == 0) {
+    383d:	|  /--|----> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3841:	|  |  |      48 0f af 45 b8       	imul   -0x48(%rbp),%rax
+    3846:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    3849:	|  |  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    384d:	|  |  |      48 01 d0             	add    %rdx,%rax
+    3850:	|  |  |      83 e0 3f             	and    $0x3f,%eax
+    3853:	|  |  |      48 85 c0             	test   %rax,%rax
+    3856:	|  |  |  /-- 75 0a                	jne    3862 <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const+0x80>
+                head = h;
+    3858:	|  |  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    385c:	|  |  |  |   48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                break;
+    3860:	+--|--|--|-- eb 0c                	jmp    386e <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const+0x8c>
+        for (Length h = 1; h < cache_line; ++h) {
+    3862:	|  |  |  \-> 48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    3867:	|  |  \----> 48 83 7d f0 3f       	cmpq   $0x3f,-0x10(%rbp)
+    386c:	|  \-------- 76 cf                	jbe    383d <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const+0x5b>
+            }
+        }
+    }
+    return Chunks(len, cl, head);
+    386e:	\----------> 48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    3872:	             48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3876:	             48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+    387a:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    387e:	             48 89 c7             	mov    %rax,%rdi
+    3881:	             e8 54 03 00 00       	call   3bda <nel::par::Chunks::Chunks(unsigned long, unsigned long, unsigned long)>
+}
+    3886:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    388a:	             c9                   	leave
+    388b:	             c3                   	ret
+
+000000000000388c <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)>:
+
+Result<void, ParError> Pool::run(Count const n_chunks, Task const task, void *const ctx)
+{
+    388c:	             55                   	push   %rbp
+    388d:	             48 89 e5             	mov    %rsp,%rbp
+    3890:	             48 83 ec 40          	sub    $0x40,%rsp
+    3894:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3898:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    389c:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    38a0:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    38a4:	             4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    Shared *const s = shared_;
+    38a8:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    38ac:	             48 8b 00             	mov    (%rax),%rax
+    38af:	             48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (n_chunks == 0) { return Result<void, ParError>::Ok(); }
+    38b3:	             48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    38b8:	         /-- 75 11                	jne    38cb <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x3f>
+    38ba:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    38be:	         |   48 89 c7             	mov    %rax,%rdi
+    38c1:	         |   e8 94 06 00 00       	call   3f5a <nel::Result<void, nel::par::ParError>::Ok()>
+    38c6:	/--------|-- e9 ab 01 00 00       	jmp    3a76 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x1ea>
+
+#if defined(NEL_PAR_PTHREADS)
+    pthread_mutex_lock(&s->run_lock_);
+    38cb:	|        \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    38cf:	|            48 83 c0 18          	add    $0x18,%rax
+    38d3:	|            48 89 c7             	mov    %rax,%rdi
+    38d6:	|            e8 b5 d8 ff ff       	call   1190 <pthread_mutex_lock@plt>
+#endif
+
+    s->task_ = task;
+    38db:	|            48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    38df:	|            48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    38e3:	|            48 89 90 e0 00 00 00 	mov    %rdx,0xe0(%rax)
+    s->ctx_ = ctx;
+    38ea:	|            48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    38ee:	|            48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    38f2:	|            48 89 90 e8 00 00 00 	mov    %rdx,0xe8(%rax)
+    s->n_chunks_ = n_chunks;
+    38f9:	|            48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    38fd:	|            48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    3901:	|            48 89 90 f0 00 00 00 	mov    %rdx,0xf0(%rax)
+    s->next_ = 0;
+    3908:	|            48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    390c:	|            48 c7 80 f8 00 00 00 	movq   $0x0,0xf8(%rax)
+    3913:	|            00 00 00 00 
+    s->failed_ = false;
+    3917:	|            48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    391b:	|            c6 80 00 01 00 00 00 	movb   $0x0,0x100(%rax)
+
+#if defined(NEL_PAR_PTHREADS)
+    // A single chunk isn't worth waking anyone for.
+    bool const wake = s->n_workers_ > 0 && n_chunks > 1;
+    3922:	|            48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3926:	|            48 8b 40 08          	mov    0x8(%rax),%rax
+    392a:	|            48 85 c0             	test   %rax,%rax
+    392d:	|     /----- 74 0e                	je     393d <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0xb1>
+    392f:	|     |      48 83 7d d8 01       	cmpq   $0x1,-0x28(%rbp)
+    3934:	|     +----- 76 07                	jbe    393d <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0xb1>
+    3936:	|     |      b8 01 00 00 00       	mov    $0x1,%eax
+    393b:	|     |  /-- eb 05                	jmp    3942 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0xb6>
+    393d:	|     \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3942:	|        \-> 88 45 f7             	mov    %al,-0x9(%rbp)
+    if (wake) {
+    3945:	|            80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+    3949:	|        /-- 74 5d                	je     39a8 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x11c>
+        pthread_mutex_lock(&s->lock_);
+    394b:	|        |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    394f:	|        |   48 83 c0 40          	add    $0x40,%rax
+    3953:	|        |   48 89 c7             	mov    %rax,%rdi
+    3956:	|        |   e8 35 d8 ff ff       	call   1190 <pthread_mutex_lock@plt>
+        s->generation_ += 1;
+    395b:	|        |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    395f:	|        |   48 8b 80 c8 00 00 00 	mov    0xc8(%rax),%rax
+    3966:	|        |   48 8d 50 01          	lea    0x1(%rax),%rdx
+    396a:	|        |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    396e:	|        |   48 89 90 c8 00 00 00 	mov    %rdx,0xc8(%rax)
+        s->busy_ = s->n_workers_;
+    3975:	|        |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3979:	|        |   48 8b 50 08          	mov    0x8(%rax),%rdx
+    397d:	|        |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3981:	|        |   48 89 90 d0 00 00 00 	mov    %rdx,0xd0(%rax)
+        pthread_cond_broadcast(&s->wake_);
+    3988:	|        |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    398c:	|        |   48 83 c0 68          	add    $0x68,%rax
+    3990:	|        |   48 89 c7             	mov    %rax,%rdi
+    3993:	|        |   e8 b8 d6 ff ff       	call   1050 <pthread_cond_broadcast@plt>
+        pthread_mutex_unlock(&s->lock_);
+    3998:	|        |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    399c:	|        |   48 83 c0 40          	add    $0x40,%rax
+    39a0:	|        |   48 89 c7             	mov    %rax,%rdi
+    39a3:	|        |   e8 68 d7 ff ff       	call   1110 <pthread_mutex_unlock@plt>
+    }
+#endif
+
+    run_chunks(task, ctx, n_chunks, s->next_, s->failed_);
+    39a8:	|        \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    39ac:	|            48 8d b8 00 01 00 00 	lea    0x100(%rax),%rdi
+    39b3:	|            48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    39b7:	|            48 8d 88 f8 00 00 00 	lea    0xf8(%rax),%rcx
+    39be:	|            48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    39c2:	|            48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    39c6:	|            48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    39ca:	|            49 89 f8             	mov    %rdi,%r8
+    39cd:	|            48 89 c7             	mov    %rax,%rdi
+    39d0:	|            e8 e9 f5 ff ff       	call   2fbe <nel::par::(anonymous namespace)::run_chunks(bool (*)(void*, unsigned long), void*, unsigned long, unsigned long&, bool&)>
+
+#if defined(NEL_PAR_PTHREADS)
+    if (wake) {
+    39d5:	|            80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+    39d9:	|  /-------- 74 4f                	je     3a2a <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x19e>
+        pthread_mutex_lock(&s->lock_);
+    39db:	|  |         48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    39df:	|  |         48 83 c0 40          	add    $0x40,%rax
+    39e3:	|  |         48 89 c7             	mov    %rax,%rdi
+    39e6:	|  |         e8 a5 d7 ff ff       	call   1190 <pthread_mutex_lock@plt>
+        while (s->busy_ != 0) {
+    39eb:	|  |     /-- eb 1d                	jmp    3a0a <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x17e>
+            pthread_cond_wait(&s->idle_, &s->lock_);
+    39ed:	|  |  /--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    39f1:	|  |  |  |   48 8d 50 40          	lea    0x40(%rax),%rdx
+    39f5:	|  |  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    39f9:	|  |  |  |   48 05 98 00 00 00    	add    $0x98,%rax
+    39ff:	|  |  |  |   48 89 d6             	mov    %rdx,%rsi
+    3a02:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    3a05:	|  |  |  |   e8 66 d6 ff ff       	call   1070 <pthread_cond_wait@plt>
+        while (s->busy_ != 0) {
+    3a0a:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a0e:	|  |  |      48 8b 80 d0 00 00 00 	mov    0xd0(%rax),%rax
+    3a15:	|  |  |      48 85 c0             	test   %rax,%rax
+    3a18:	|  |  \----- 75 d3                	jne    39ed <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x161>
+        }
+        pthread_mutex_unlock(&s->lock_);
+    3a1a:	|  |         48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a1e:	|  |         48 83 c0 40          	add    $0x40,%rax
+    3a22:	|  |         48 89 c7             	mov    %rax,%rdi
+    3a25:	|  |         e8 e6 d6 ff ff       	call   1110 <pthread_mutex_unlock@plt>
+    }
+#endif
+
+    bool const failed = s->failed_;
+    3a2a:	|  \-------> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a2e:	|            0f b6 80 00 01 00 00 	movzbl 0x100(%rax),%eax
+    3a35:	|            88 45 f6             	mov    %al,-0xa(%rbp)
+
+#if defined(NEL_PAR_PTHREADS)
+    pthread_mutex_unlock(&s->run_lock_);
+    3a38:	|            48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a3c:	|            48 83 c0 18          	add    $0x18,%rax
+    3a40:	|            48 89 c7             	mov    %rax,%rdi
+    3a43:	|            e8 c8 d6 ff ff       	call   1110 <pthread_mutex_unlock@plt>
+#endif
+
+    if (failed) { return Result<void, ParError>::Err(ParError::Cancelled); }
+    3a48:	|            80 7d f6 00          	cmpb   $0x0,-0xa(%rbp)
+    3a4c:	|        /-- 74 1c                	je     3a6a <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x1de>
+    3a4e:	|        |   c7 45 f0 02 00 00 00 	movl   $0x2,-0x10(%rbp)
+    3a55:	|        |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3a59:	|        |   48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    3a5d:	|        |   48 89 d6             	mov    %rdx,%rsi
+    3a60:	|        |   48 89 c7             	mov    %rax,%rdi
+    3a63:	|        |   e8 10 05 00 00       	call   3f78 <nel::Result<void, nel::par::ParError>::Err(nel::par::ParError&&)>
+    return Result<void, ParError>::Ok();
+}
+    3a68:	+--------|-- eb 0c                	jmp    3a76 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x1ea>
+    return Result<void, ParError>::Ok();
+    3a6a:	|        \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3a6e:	|            48 89 c7             	mov    %rax,%rdi
+    3a71:	|            e8 e4 04 00 00       	call   3f5a <nel::Result<void, nel::par::ParError>::Ok()>
+}
+    3a76:	\----------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3a7a:	             c9                   	leave
+    3a7b:	             c3                   	ret
+
+0000000000003a7c <nel::heaped::Malloc::try_malloc(unsigned long, unsigned long)>:
+ * and friends (see memory.hh).
+ */
+struct Malloc
+{
+    public:
+        static Result<void *, AllocError> try_malloc(Length const align, Length const size)
+    3a7c:	55                   	push   %rbp
+    3a7d:	48 89 e5             	mov    %rsp,%rbp
+    3a80:	48 83 ec 20          	sub    $0x20,%rsp
+    3a84:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3a88:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3a8c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            return try_realloc(nullptr, align, 0, size);
+    3a90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a94:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    3a98:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3a9c:	49 89 c8             	mov    %rcx,%r8
+    3a9f:	b9 00 00 00 00       	mov    $0x0,%ecx
+    3aa4:	be 00 00 00 00       	mov    $0x0,%esi
+    3aa9:	48 89 c7             	mov    %rax,%rdi
+    3aac:	e8 06 00 00 00       	call   3ab7 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>
+        }
+    3ab1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3ab5:	c9                   	leave
+    3ab6:	c3                   	ret
+
+0000000000003ab7 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>:
+
+        static Result<void *, AllocError> try_realloc(void *const p,
+    3ab7:	          55                   	push   %rbp
+    3ab8:	          48 89 e5             	mov    %rsp,%rbp
+    3abb:	          48 83 ec 40          	sub    $0x40,%rsp
+    3abf:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3ac3:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    3ac7:	          48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    3acb:	          48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    3acf:	          4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+                                                      Length const align,
+                                                      Length const old_size,
+                                                      Length const new_size)
+        {
+            if (align == 0 || (align & (align - 1)) != 0) {
+    3ad3:	          48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    3ad8:	      /-- 74 11                	je     3aeb <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x34>
+    3ada:	      |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3ade:	      |   48 83 e8 01          	sub    $0x1,%rax
+    3ae2:	      |   48 23 45 d8          	and    -0x28(%rbp),%rax
+    3ae6:	      |   48 85 c0             	test   %rax,%rax
+    3ae9:	   /--|-- 74 1c                	je     3b07 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x50>
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+    3aeb:	   |  \-> c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+    3af2:	   |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3af6:	   |      48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    3afa:	   |      48 89 d6             	mov    %rdx,%rsi
+    3afd:	   |      48 89 c7             	mov    %rax,%rdi
+    3b00:	   |      e8 d5 02 00 00       	call   3dda <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+                                    : std::realloc(p, new_size);
+            if (new_p == nullptr) {
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+            }
+            return Result<void *, AllocError>::Ok(new_p);
+        }
+    3b05:	/--|----- eb 79                	jmp    3b80 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            void *const new_p = is_over_aligned(align)
+    3b07:	|  \----> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3b0b:	|         48 89 c7             	mov    %rax,%rdi
+    3b0e:	|         e8 b4 00 00 00       	call   3bc7 <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+                                    ? realloc_aligned(p, align, old_size, new_size)
+    3b13:	|         84 c0                	test   %al,%al
+    3b15:	|  /----- 74 1a                	je     3b31 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x7a>
+    3b17:	|  |      48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+    3b1b:	|  |      48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    3b1f:	|  |      48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+    3b23:	|  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3b27:	|  |      48 89 c7             	mov    %rax,%rdi
+    3b2a:	|  |      e8 1b f1 ff ff       	call   2c4a <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+    3b2f:	|  |  /-- eb 13                	jmp    3b44 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x8d>
+                                    : std::realloc(p, new_size);
+    3b31:	|  \--|-> 48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    3b35:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3b39:	|     |   48 89 d6             	mov    %rdx,%rsi
+    3b3c:	|     |   48 89 c7             	mov    %rax,%rdi
+    3b3f:	|     |   e8 dc d5 ff ff       	call   1120 <realloc@plt>
+    3b44:	|     \-> 48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            if (new_p == nullptr) {
+    3b48:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3b4c:	|         48 85 c0             	test   %rax,%rax
+    3b4f:	|     /-- 75 1c                	jne    3b6d <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xb6>
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+    3b51:	|     |   c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    3b58:	|     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3b5c:	|     |   48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    3b60:	|     |   48 89 d6             	mov    %rdx,%rsi
+    3b63:	|     |   48 89 c7             	mov    %rax,%rdi
+    3b66:	|     |   e8 6f 02 00 00       	call   3dda <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+        }
+    3b6b:	+-----|-- eb 13                	jmp    3b80 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            return Result<void *, AllocError>::Ok(new_p);
+    3b6d:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3b71:	|         48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    3b75:	|         48 89 d6             	mov    %rdx,%rsi
+    3b78:	|         48 89 c7             	mov    %rax,%rdi
+    3b7b:	|         e8 8e 02 00 00       	call   3e0e <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>
+        }
+    3b80:	\-------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3b84:	          c9                   	leave
+    3b85:	          c3                   	ret
+
+0000000000003b86 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>:
+
+        static void free(void *const p, Length const align, Length const size)
+    3b86:	       55                   	push   %rbp
+    3b87:	       48 89 e5             	mov    %rsp,%rbp
+    3b8a:	       48 83 ec 20          	sub    $0x20,%rsp
+    3b8e:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3b92:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3b96:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+    3b9a:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3b9e:	       48 89 c7             	mov    %rax,%rdi
+    3ba1:	       e8 21 00 00 00       	call   3bc7 <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+    3ba6:	       84 c0                	test   %al,%al
+    3ba8:	/----- 74 0e                	je     3bb8 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x32>
+                free_aligned(p);
+    3baa:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3bae:	|      48 89 c7             	mov    %rax,%rdi
+    3bb1:	|      e8 50 f0 ff ff       	call   2c06 <nel::free_aligned(void*)>
+            } else {
+                std::free(p);
+            }
+        }
+    3bb6:	|  /-- eb 0c                	jmp    3bc4 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x3e>
+                std::free(p);
+    3bb8:	\--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3bbc:	   |   48 89 c7             	mov    %rax,%rdi
+    3bbf:	   |   e8 6c d4 ff ff       	call   1030 <free@plt>
+        }
+    3bc4:	   \-> 90                   	nop
+    3bc5:	       c9                   	leave
+    3bc6:	       c3                   	ret
+
+0000000000003bc7 <nel::heaped::Malloc::is_over_aligned(unsigned long)>:
+
+    private:
+        static constexpr bool is_over_aligned(Length const align)
+    3bc7:	55                   	push   %rbp
+    3bc8:	48 89 e5             	mov    %rsp,%rbp
+    3bcb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return align > alignof(std::max_align_t);
+    3bcf:	48 83 7d f8 10       	cmpq   $0x10,-0x8(%rbp)
+    3bd4:	0f 97 c0             	seta   %al
+        }
+    3bd7:	5d                   	pop    %rbp
+    3bd8:	c3                   	ret
+    3bd9:	90                   	nop
+
+0000000000003bda <nel::par::Chunks::Chunks(unsigned long, unsigned long, unsigned long)>:
+        constexpr Chunks(Length const len, Length const chunk_len, Length const head)
+    3bda:	55                   	push   %rbp
+    3bdb:	48 89 e5             	mov    %rsp,%rbp
+    3bde:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3be2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3be6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    3bea:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            : len_(len)
+    3bee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3bf2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3bf6:	48 89 10             	mov    %rdx,(%rax)
+            , chunk_len_(chunk_len)
+    3bf9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3bfd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3c01:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , head_(head)
+    3c05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3c09:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    3c0d:	48 89 50 10          	mov    %rdx,0x10(%rax)
+        }
+    3c11:	90                   	nop
+    3c12:	5d                   	pop    %rbp
+    3c13:	c3                   	ret
+
+0000000000003c14 <nel::par::Pool::Pool(nel::par::Pool::Shared*)>:
+        constexpr Pool(Shared *const s)
+    3c14:	55                   	push   %rbp
+    3c15:	48 89 e5             	mov    %rsp,%rbp
+    3c18:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3c1c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : shared_(s)
+    3c20:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3c24:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3c28:	48 89 10             	mov    %rdx,(%rax)
+        }
+    3c2b:	90                   	nop
+    3c2c:	5d                   	pop    %rbp
+    3c2d:	c3                   	ret
+
+0000000000003c2e <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>:
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    3c2e:	55                   	push   %rbp
+    3c2f:	48 89 e5             	mov    %rsp,%rbp
+    3c32:	48 83 ec 10          	sub    $0x10,%rsp
+    3c36:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3c3a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3c3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3c42:	48 89 c7             	mov    %rax,%rdi
+    3c45:	e8 7e 02 00 00       	call   3ec8 <void*&& nel::forward<void*, void*>(void*&)>
+    3c4a:	48 8b 00             	mov    (%rax),%rax
+    3c4d:	c9                   	leave
+    3c4e:	c3                   	ret
+    3c4f:	90                   	nop
+
+0000000000003c50 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>:
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    3c50:	55                   	push   %rbp
+    3c51:	48 89 e5             	mov    %rsp,%rbp
+    3c54:	48 83 ec 10          	sub    $0x10,%rsp
+    3c58:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3c5c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3c60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3c64:	48 8b 00             	mov    (%rax),%rax
+    3c67:	48 89 c6             	mov    %rax,%rsi
+    3c6a:	48 8d 05 b7 16 00 00 	lea    0x16b7(%rip),%rax        # 5328 <nel::sort::ninther_n+0x8>
+    3c71:	48 89 c7             	mov    %rax,%rdi
+    3c74:	e8 ca e8 ff ff       	call   2543 <nel::panic(char const*, nel::Context const&)>
+    3c79:	90                   	nop
+
+0000000000003c7a <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>:
+        constexpr T unwrap(Context const &ctx = Context())
+    3c7a:	55                   	push   %rbp
+    3c7b:	48 89 e5             	mov    %rsp,%rbp
+    3c7e:	48 83 ec 20          	sub    $0x20,%rsp
+    3c82:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3c86:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    3c8a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3c8e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    3c92:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    3c96:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    3c9a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    3c9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3ca2:	48 89 c7             	mov    %rax,%rdi
+    3ca5:	e8 02 00 00 00       	call   3cac <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>
+        }
+    3caa:	c9                   	leave
+    3cab:	c3                   	ret
+
+0000000000003cac <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    3cac:	             55                   	push   %rbp
+    3cad:	             48 89 e5             	mov    %rsp,%rbp
+    3cb0:	             48 83 ec 30          	sub    $0x30,%rsp
+    3cb4:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3cb8:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    3cbc:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    3cc0:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    3cc4:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3cc8:	             8b 00                	mov    (%rax),%eax
+    3cca:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    3ccd:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3cd1:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    3cd7:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    3cdb:	         /-- 74 3e                	je     3d1b <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x6f>
+    3cdd:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    3ce1:	/--------|-- 7f 7a                	jg     3d5d <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+    3ce3:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    3ce7:	|  /-----|-- 74 5e                	je     3d47 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x9b>
+    3ce9:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    3ced:	+--|-----|-- 75 6e                	jne    3d5d <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+                    return on_ok(forward<T>(*ok_));
+    3cef:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3cf3:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    3cf7:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    3cfa:	|  |     |   e8 d7 01 00 00       	call   3ed6 <nel::Element<void*>::operator*()>
+    3cff:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    3d02:	|  |     |   e8 c1 01 00 00       	call   3ec8 <void*&& nel::forward<void*, void*>(void*&)>
+    3d07:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    3d0a:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3d0e:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    3d11:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    3d14:	|  |     |   e8 15 ff ff ff       	call   3c2e <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>
+    3d19:	|  |  /--|-- eb 58                	jmp    3d73 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    return on_err(forward<E>(*err_));
+    3d1b:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3d1f:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    3d23:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3d26:	|  |  |      e8 c5 01 00 00       	call   3ef0 <nel::Element<nel::heaped::AllocError>::operator*()>
+    3d2b:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3d2e:	|  |  |      e8 d7 01 00 00       	call   3f0a <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    3d33:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    3d36:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3d3a:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    3d3d:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3d40:	|  |  |      e8 0b ff ff ff       	call   3c50 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>
+    3d45:	|  |  +----- eb 2c                	jmp    3d73 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    nel::panic("invalid Result", ctx);
+    3d47:	|  \--|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3d4b:	|     |      48 89 c6             	mov    %rax,%rsi
+    3d4e:	|     |      48 8d 05 dd 15 00 00 	lea    0x15dd(%rip),%rax        # 5332 <nel::sort::ninther_n+0x12>
+    3d55:	|     |      48 89 c7             	mov    %rax,%rdi
+    3d58:	|     |      e8 e6 e7 ff ff       	call   2543 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    3d5d:	\-----|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3d61:	      |      48 89 c6             	mov    %rax,%rsi
+    3d64:	      |      48 8d 05 d6 15 00 00 	lea    0x15d6(%rip),%rax        # 5341 <nel::sort::ninther_n+0x21>
+    3d6b:	      |      48 89 c7             	mov    %rax,%rdi
+    3d6e:	      |      e8 d0 e7 ff ff       	call   2543 <nel::panic(char const*, nel::Context const&)>
+        }
+    3d73:	      \----> c9                   	leave
+    3d74:	             c3                   	ret
+    3d75:	             90                   	nop
+
+0000000000003d76 <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+        constexpr ~Result(void)
+    3d76:	             55                   	push   %rbp
+    3d77:	             48 89 e5             	mov    %rsp,%rbp
+    3d7a:	             48 83 ec 30          	sub    $0x30,%rsp
+    3d7e:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+            switch (tag_) { // result::dtor
+    3d82:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3d86:	             8b 00                	mov    (%rax),%eax
+    3d88:	             83 f8 02             	cmp    $0x2,%eax
+    3d8b:	/----------- 74 43                	je     3dd0 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5a>
+    3d8d:	|            83 f8 02             	cmp    $0x2,%eax
+    3d90:	|        /-- 7f 09                	jg     3d9b <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x25>
+    3d92:	|        |   85 c0                	test   %eax,%eax
+    3d94:	|  /-----|-- 74 3d                	je     3dd3 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5d>
+    3d96:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    3d99:	|  |  /--|-- 74 3b                	je     3dd6 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x60>
+                    nel::panic("bad Result");
+    3d9b:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    3d9f:	|  |  |      b9 72 00 00 00       	mov    $0x72,%ecx
+    3da4:	|  |  |      48 8d 15 bd 15 00 00 	lea    0x15bd(%rip),%rdx        # 5368 <nel::sort::ninther_n+0x48>
+    3dab:	|  |  |      48 8d 35 c8 15 00 00 	lea    0x15c8(%rip),%rsi        # 537a <nel::sort::ninther_n+0x5a>
+    3db2:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3db5:	|  |  |      e8 60 e0 ff ff       	call   1e1a <nel::Context::Context(char const*, char const*, int)>
+    3dba:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    3dbe:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    3dc1:	|  |  |      48 8d 05 79 15 00 00 	lea    0x1579(%rip),%rax        # 5341 <nel::sort::ninther_n+0x21>
+    3dc8:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3dcb:	|  |  |      e8 73 e7 ff ff       	call   2543 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    3dd0:	\--|--|----> 90                   	nop
+    3dd1:	   |  |  /-- eb 04                	jmp    3dd7 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    3dd3:	   \--|--|-> 90                   	nop
+    3dd4:	      |  +-- eb 01                	jmp    3dd7 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    3dd6:	      \--|-> 90                   	nop
+        }
+    3dd7:	         \-> 90                   	nop
+    3dd8:	             c9                   	leave
+    3dd9:	             c3                   	ret
+
+0000000000003dda <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>:
+        constexpr static Result Err(E &&val)
+    3dda:	55                   	push   %rbp
+    3ddb:	48 89 e5             	mov    %rsp,%rbp
+    3dde:	48 83 ec 10          	sub    $0x10,%rsp
+    3de2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3de6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<E>(val));
+    3dea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3dee:	48 89 c7             	mov    %rax,%rdi
+    3df1:	e8 14 01 00 00       	call   3f0a <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    3df6:	48 89 c2             	mov    %rax,%rdx
+    3df9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3dfd:	48 89 d6             	mov    %rdx,%rsi
+    3e00:	48 89 c7             	mov    %rax,%rdi
+    3e03:	e8 a4 01 00 00       	call   3fac <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>
+        }
+    3e08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3e0c:	c9                   	leave
+    3e0d:	c3                   	ret
+
+0000000000003e0e <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>:
+        constexpr static Result Ok(Args &&...args)
+    3e0e:	55                   	push   %rbp
+    3e0f:	48 89 e5             	mov    %rsp,%rbp
+    3e12:	48 83 ec 10          	sub    $0x10,%rsp
+    3e16:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3e1a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<Args>(args)...);
+    3e1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3e22:	48 89 c7             	mov    %rax,%rdi
+    3e25:	e8 c3 01 00 00       	call   3fed <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    3e2a:	48 89 c2             	mov    %rax,%rdx
+    3e2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3e31:	48 89 d6             	mov    %rdx,%rsi
+    3e34:	48 89 c7             	mov    %rax,%rdi
+    3e37:	e8 c0 01 00 00       	call   3ffc <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>
+        }
+    3e3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3e40:	c9                   	leave
+    3e41:	c3                   	ret
+
+0000000000003e42 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>:
+            return match<bool>([](T const &) -> bool { return false; },
+    3e42:	55                   	push   %rbp
+    3e43:	48 89 e5             	mov    %rsp,%rbp
+    3e46:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3e4a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+    3e53:	5d                   	pop    %rbp
+    3e54:	c3                   	ret
+    3e55:	90                   	nop
+
+0000000000003e56 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>:
+                               [](E const &) -> bool { return true; },
+    3e56:	55                   	push   %rbp
+    3e57:	48 89 e5             	mov    %rsp,%rbp
+    3e5a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3e5e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3e62:	b8 01 00 00 00       	mov    $0x1,%eax
+    3e67:	5d                   	pop    %rbp
+    3e68:	c3                   	ret
+    3e69:	90                   	nop
+
+0000000000003e6a <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>:
+        constexpr bool is_err(Context const &ctx = Context()) const
+    3e6a:	55                   	push   %rbp
+    3e6b:	48 89 e5             	mov    %rsp,%rbp
+    3e6e:	48 83 ec 20          	sub    $0x20,%rsp
+    3e72:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3e76:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](T const &) -> bool { return false; },
+    3e7a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    3e7e:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    3e82:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    3e86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3e8a:	48 89 c7             	mov    %rax,%rdi
+    3e8d:	e8 ac 01 00 00       	call   403e <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>
+        }
+    3e92:	c9                   	leave
+    3e93:	c3                   	ret
+
+0000000000003e94 <nel::Result<nel::par::Pool, nel::par::ParError>::Err(nel::par::ParError&&)>:
+        constexpr static Result Err(E &&val)
+    3e94:	55                   	push   %rbp
+    3e95:	48 89 e5             	mov    %rsp,%rbp
+    3e98:	48 83 ec 10          	sub    $0x10,%rsp
+    3e9c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3ea0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<E>(val));
+    3ea4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3ea8:	48 89 c7             	mov    %rax,%rdi
+    3eab:	e8 fa e5 ff ff       	call   24aa <nel::par::ParError&& nel::forward<nel::par::ParError, nel::par::ParError>(nel::par::ParError&)>
+    3eb0:	48 89 c2             	mov    %rax,%rdx
+    3eb3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3eb7:	48 89 d6             	mov    %rdx,%rsi
+    3eba:	48 89 c7             	mov    %rax,%rdi
+    3ebd:	e8 24 02 00 00       	call   40e6 <nel::Result<nel::par::Pool, nel::par::ParError>::Result(nel::Result<nel::par::Pool, nel::par::ParError>::Phantom<(nel::Result<nel::par::Pool, nel::par::ParError>::Tag)2>, nel::par::ParError&&)>
+        }
+    3ec2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3ec6:	c9                   	leave
+    3ec7:	c3                   	ret
+
+0000000000003ec8 <void*&& nel::forward<void*, void*>(void*&)>:
+constexpr U &&forward(T &t)
+    3ec8:	55                   	push   %rbp
+    3ec9:	48 89 e5             	mov    %rsp,%rbp
+    3ecc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    3ed0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3ed4:	5d                   	pop    %rbp
+    3ed5:	c3                   	ret
+
+0000000000003ed6 <nel::Element<void*>::operator*()>:
+        constexpr Type &operator*(void)
+    3ed6:	55                   	push   %rbp
+    3ed7:	48 89 e5             	mov    %rsp,%rbp
+    3eda:	48 83 ec 10          	sub    $0x10,%rsp
+    3ede:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    3ee2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3ee6:	48 89 c7             	mov    %rax,%rdi
+    3ee9:	e8 3a 02 00 00       	call   4128 <nel::Element<void*>::ref()>
+        }
+    3eee:	c9                   	leave
+    3eef:	c3                   	ret
+
+0000000000003ef0 <nel::Element<nel::heaped::AllocError>::operator*()>:
+        constexpr Type &operator*(void)
+    3ef0:	55                   	push   %rbp
+    3ef1:	48 89 e5             	mov    %rsp,%rbp
+    3ef4:	48 83 ec 10          	sub    $0x10,%rsp
+    3ef8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    3efc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f00:	48 89 c7             	mov    %rax,%rdi
+    3f03:	e8 2e 02 00 00       	call   4136 <nel::Element<nel::heaped::AllocError>::ref()>
+        }
+    3f08:	c9                   	leave
+    3f09:	c3                   	ret
+
+0000000000003f0a <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>:
+constexpr U &&forward(T &t)
+    3f0a:	55                   	push   %rbp
+    3f0b:	48 89 e5             	mov    %rsp,%rbp
+    3f0e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    3f12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3f16:	5d                   	pop    %rbp
+    3f17:	c3                   	ret
+
+0000000000003f18 <nel::par::Pool&& nel::move<nel::par::Pool>(nel::par::Pool&)>:
+constexpr T &&move(T &v)
+    3f18:	55                   	push   %rbp
+    3f19:	48 89 e5             	mov    %rsp,%rbp
+    3f1c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    3f20:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3f24:	5d                   	pop    %rbp
+    3f25:	c3                   	ret
+
+0000000000003f26 <nel::Result<nel::par::Pool, nel::par::ParError>::Ok(nel::par::Pool&&)>:
+        constexpr static Result Ok(T &&val)
+    3f26:	55                   	push   %rbp
+    3f27:	48 89 e5             	mov    %rsp,%rbp
+    3f2a:	48 83 ec 10          	sub    $0x10,%rsp
+    3f2e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3f32:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<T>(val));
+    3f36:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3f3a:	48 89 c7             	mov    %rax,%rdi
+    3f3d:	e8 62 e4 ff ff       	call   23a4 <nel::par::Pool&& nel::forward<nel::par::Pool, nel::par::Pool>(nel::par::Pool&)>
+    3f42:	48 89 c2             	mov    %rax,%rdx
+    3f45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f49:	48 89 d6             	mov    %rdx,%rsi
+    3f4c:	48 89 c7             	mov    %rax,%rdi
+    3f4f:	e8 f0 01 00 00       	call   4144 <nel::Result<nel::par::Pool, nel::par::ParError>::Result(nel::Result<nel::par::Pool, nel::par::ParError>::Phantom<(nel::Result<nel::par::Pool, nel::par::ParError>::Tag)1>, nel::par::Pool&&)>
+        }
+    3f54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f58:	c9                   	leave
+    3f59:	c3                   	ret
+
+0000000000003f5a <nel::Result<void, nel::par::ParError>::Ok()>:
+        constexpr static Result Ok(void)
+    3f5a:	55                   	push   %rbp
+    3f5b:	48 89 e5             	mov    %rsp,%rbp
+    3f5e:	48 83 ec 10          	sub    $0x10,%rsp
+    3f62:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Result(Phantom<Tag::OK>());
+    3f66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f6a:	48 89 c7             	mov    %rax,%rdi
+    3f6d:	e8 14 02 00 00       	call   4186 <nel::Result<void, nel::par::ParError>::Result(nel::Result<void, nel::par::ParError>::Phantom<(nel::Result<void, nel::par::ParError>::Tag)1>)>
+        }
+    3f72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f76:	c9                   	leave
+    3f77:	c3                   	ret
+
+0000000000003f78 <nel::Result<void, nel::par::ParError>::Err(nel::par::ParError&&)>:
+        constexpr static Result Err(E &&v)
+    3f78:	55                   	push   %rbp
+    3f79:	48 89 e5             	mov    %rsp,%rbp
+    3f7c:	48 83 ec 10          	sub    $0x10,%rsp
+    3f80:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3f84:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<E>(v));
+    3f88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3f8c:	48 89 c7             	mov    %rax,%rdi
+    3f8f:	e8 16 e5 ff ff       	call   24aa <nel::par::ParError&& nel::forward<nel::par::ParError, nel::par::ParError>(nel::par::ParError&)>
+    3f94:	48 89 c2             	mov    %rax,%rdx
+    3f97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f9b:	48 89 d6             	mov    %rdx,%rsi
+    3f9e:	48 89 c7             	mov    %rax,%rdi
+    3fa1:	e8 f6 01 00 00       	call   419c <nel::Result<void, nel::par::ParError>::Result(nel::Result<void, nel::par::ParError>::Phantom<(nel::Result<void, nel::par::ParError>::Tag)2>, nel::par::ParError&&)>
+        }
+    3fa6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3faa:	c9                   	leave
+    3fab:	c3                   	ret
+
+0000000000003fac <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    3fac:	55                   	push   %rbp
+    3fad:	48 89 e5             	mov    %rsp,%rbp
+    3fb0:	53                   	push   %rbx
+    3fb1:	48 83 ec 18          	sub    $0x18,%rsp
+    3fb5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3fb9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    3fbd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3fc1:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    3fc7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3fcb:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    3fcf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3fd3:	48 89 c7             	mov    %rax,%rdi
+    3fd6:	e8 2f ff ff ff       	call   3f0a <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    3fdb:	48 89 c6             	mov    %rax,%rsi
+    3fde:	48 89 df             	mov    %rbx,%rdi
+    3fe1:	e8 f8 01 00 00       	call   41de <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>
+        }
+    3fe6:	90                   	nop
+    3fe7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3feb:	c9                   	leave
+    3fec:	c3                   	ret
+
+0000000000003fed <void* const& nel::forward<void* const&, void* const>(void* const&)>:
+constexpr U &&forward(T &t)
+    3fed:	55                   	push   %rbp
+    3fee:	48 89 e5             	mov    %rsp,%rbp
+    3ff1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    3ff5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3ff9:	5d                   	pop    %rbp
+    3ffa:	c3                   	ret
+    3ffb:	90                   	nop
+
+0000000000003ffc <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>:
+        constexpr Result(Phantom<Tag::OK> const, Args &&...args)
+    3ffc:	55                   	push   %rbp
+    3ffd:	48 89 e5             	mov    %rsp,%rbp
+    4000:	53                   	push   %rbx
+    4001:	48 83 ec 18          	sub    $0x18,%rsp
+    4005:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    4009:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    400d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4011:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<Args>(args)...)
+    4017:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    401b:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    401f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4023:	48 89 c7             	mov    %rax,%rdi
+    4026:	e8 c2 ff ff ff       	call   3fed <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    402b:	48 89 c6             	mov    %rax,%rsi
+    402e:	48 89 df             	mov    %rbx,%rdi
+    4031:	e8 d0 01 00 00       	call   4206 <nel::Element<void*>::Element<void* const&>(void* const&)>
+        }
+    4036:	90                   	nop
+    4037:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    403b:	c9                   	leave
+    403c:	c3                   	ret
+    403d:	90                   	nop
+
+000000000000403e <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    403e:	             55                   	push   %rbp
+    403f:	             48 89 e5             	mov    %rsp,%rbp
+    4042:	             48 83 ec 20          	sub    $0x20,%rsp
+    4046:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    404a:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    404e:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    4052:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result-match
+    4056:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    405a:	             8b 00                	mov    (%rax),%eax
+    405c:	             83 f8 02             	cmp    $0x2,%eax
+    405f:	         /-- 74 32                	je     4093 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x55>
+    4061:	         |   83 f8 02             	cmp    $0x2,%eax
+    4064:	/--------|-- 7f 67                	jg     40cd <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+    4066:	|        |   85 c0                	test   %eax,%eax
+    4068:	|     /--|-- 74 4d                	je     40b7 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x79>
+    406a:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    406d:	+-----|--|-- 75 5e                	jne    40cd <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_ok(*ok_);
+    406f:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4073:	|     |  |   48 83 c0 08          	add    $0x8,%rax
+    4077:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    407a:	|     |  |   e8 b1 01 00 00       	call   4230 <nel::Element<void*>::operator*() const>
+    407f:	|     |  |   48 89 c2             	mov    %rax,%rdx
+    4082:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4086:	|     |  |   48 89 d6             	mov    %rdx,%rsi
+    4089:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    408c:	|     |  |   e8 b1 fd ff ff       	call   3e42 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>
+    4091:	|  /--|--|-- eb 50                	jmp    40e3 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    return on_err(*err_);
+    4093:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4097:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    409b:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    409e:	|  |  |      e8 a7 01 00 00       	call   424a <nel::Element<nel::heaped::AllocError>::operator*() const>
+    40a3:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    40a6:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    40aa:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    40ad:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    40b0:	|  |  |      e8 a1 fd ff ff       	call   3e56 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>
+    40b5:	|  +--|----- eb 2c                	jmp    40e3 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    nel::panic("invalid Result", ctx);
+    40b7:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    40bb:	|  |         48 89 c6             	mov    %rax,%rsi
+    40be:	|  |         48 8d 05 6d 12 00 00 	lea    0x126d(%rip),%rax        # 5332 <nel::sort::ninther_n+0x12>
+    40c5:	|  |         48 89 c7             	mov    %rax,%rdi
+    40c8:	|  |         e8 76 e4 ff ff       	call   2543 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    40cd:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    40d1:	   |         48 89 c6             	mov    %rax,%rsi
+    40d4:	   |         48 8d 05 66 12 00 00 	lea    0x1266(%rip),%rax        # 5341 <nel::sort::ninther_n+0x21>
+    40db:	   |         48 89 c7             	mov    %rax,%rdi
+    40de:	   |         e8 60 e4 ff ff       	call   2543 <nel::panic(char const*, nel::Context const&)>
+        }
+    40e3:	   \-------> c9                   	leave
+    40e4:	             c3                   	ret
+    40e5:	             90                   	nop
+
+00000000000040e6 <nel::Result<nel::par::Pool, nel::par::ParError>::Result(nel::Result<nel::par::Pool, nel::par::ParError>::Phantom<(nel::Result<nel::par::Pool, nel::par::ParError>::Tag)2>, nel::par::ParError&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    40e6:	55                   	push   %rbp
+    40e7:	48 89 e5             	mov    %rsp,%rbp
+    40ea:	53                   	push   %rbx
+    40eb:	48 83 ec 18          	sub    $0x18,%rsp
+    40ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    40f3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    40f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    40fb:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    4101:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4105:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    4109:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    410d:	48 89 c7             	mov    %rax,%rdi
+    4110:	e8 95 e3 ff ff       	call   24aa <nel::par::ParError&& nel::forward<nel::par::ParError, nel::par::ParError>(nel::par::ParError&)>
+    4115:	48 89 c6             	mov    %rax,%rsi
+    4118:	48 89 df             	mov    %rbx,%rdi
+    411b:	e8 44 01 00 00       	call   4264 <nel::Element<nel::par::ParError>::Element(nel::par::ParError&&)>
+        }
+    4120:	90                   	nop
+    4121:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    4125:	c9                   	leave
+    4126:	c3                   	ret
+    4127:	90                   	nop
+
+0000000000004128 <nel::Element<void*>::ref()>:
+        constexpr Type &ref(void)
+    4128:	55                   	push   %rbp
+    4129:	48 89 e5             	mov    %rsp,%rbp
+    412c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    4130:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    4134:	5d                   	pop    %rbp
+    4135:	c3                   	ret
+
+0000000000004136 <nel::Element<nel::heaped::AllocError>::ref()>:
+        constexpr Type &ref(void)
+    4136:	55                   	push   %rbp
+    4137:	48 89 e5             	mov    %rsp,%rbp
+    413a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    413e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    4142:	5d                   	pop    %rbp
+    4143:	c3                   	ret
+
+0000000000004144 <nel::Result<nel::par::Pool, nel::par::ParError>::Result(nel::Result<nel::par::Pool, nel::par::ParError>::Phantom<(nel::Result<nel::par::Pool, nel::par::ParError>::Tag)1>, nel::par::Pool&&)>:
+        constexpr Result(Phantom<Tag::OK> const, T &&v)
+    4144:	55                   	push   %rbp
+    4145:	48 89 e5             	mov    %rsp,%rbp
+    4148:	53                   	push   %rbx
+    4149:	48 83 ec 18          	sub    $0x18,%rsp
+    414d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    4151:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    4155:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4159:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<T>(v))
+    415f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4163:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    4167:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    416b:	48 89 c7             	mov    %rax,%rdi
+    416e:	e8 31 e2 ff ff       	call   23a4 <nel::par::Pool&& nel::forward<nel::par::Pool, nel::par::Pool>(nel::par::Pool&)>
+    4173:	48 89 c6             	mov    %rax,%rsi
+    4176:	48 89 df             	mov    %rbx,%rdi
+    4179:	e8 0e 01 00 00       	call   428c <nel::Element<nel::par::Pool>::Element(nel::par::Pool&&)>
+        }
+    417e:	90                   	nop
+    417f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    4183:	c9                   	leave
+    4184:	c3                   	ret
+    4185:	90                   	nop
+
+0000000000004186 <nel::Result<void, nel::par::ParError>::Result(nel::Result<void, nel::par::ParError>::Phantom<(nel::Result<void, nel::par::ParError>::Tag)1>)>:
+        constexpr Result(Phantom<Tag::OK> const)
+    4186:	55                   	push   %rbp
+    4187:	48 89 e5             	mov    %rsp,%rbp
+    418a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : tag_(Tag::OK)
+    418e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4192:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+        }
+    4198:	90                   	nop
+    4199:	5d                   	pop    %rbp
+    419a:	c3                   	ret
+    419b:	90                   	nop
+
+000000000000419c <nel::Result<void, nel::par::ParError>::Result(nel::Result<void, nel::par::ParError>::Phantom<(nel::Result<void, nel::par::ParError>::Tag)2>, nel::par::ParError&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    419c:	55                   	push   %rbp
+    419d:	48 89 e5             	mov    %rsp,%rbp
+    41a0:	53                   	push   %rbx
+    41a1:	48 83 ec 18          	sub    $0x18,%rsp
+    41a5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    41a9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    41ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    41b1:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    41b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    41bb:	48 8d 58 04          	lea    0x4(%rax),%rbx
+    41bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    41c3:	48 89 c7             	mov    %rax,%rdi
+    41c6:	e8 df e2 ff ff       	call   24aa <nel::par::ParError&& nel::forward<nel::par::ParError, nel::par::ParError>(nel::par::ParError&)>
+    41cb:	48 89 c6             	mov    %rax,%rsi
+    41ce:	48 89 df             	mov    %rbx,%rdi
+    41d1:	e8 8e 00 00 00       	call   4264 <nel::Element<nel::par::ParError>::Element(nel::par::ParError&&)>
+        }
+    41d6:	90                   	nop
+    41d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    41db:	c9                   	leave
+    41dc:	c3                   	ret
+    41dd:	90                   	nop
+
+00000000000041de <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>:
+        constexpr Element(Type &&val)
+    41de:	55                   	push   %rbp
+    41df:	48 89 e5             	mov    %rsp,%rbp
+    41e2:	48 83 ec 10          	sub    $0x10,%rsp
+    41e6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    41ea:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    41ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    41f2:	48 89 c7             	mov    %rax,%rdi
+    41f5:	e8 10 fd ff ff       	call   3f0a <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    41fa:	8b 10                	mov    (%rax),%edx
+    41fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4200:	89 10                	mov    %edx,(%rax)
+        }
+    4202:	90                   	nop
+    4203:	c9                   	leave
+    4204:	c3                   	ret
+    4205:	90                   	nop
+
+0000000000004206 <nel::Element<void*>::Element<void* const&>(void* const&)>:
+        constexpr Element(Args &&...args)
+    4206:	55                   	push   %rbp
+    4207:	48 89 e5             	mov    %rsp,%rbp
+    420a:	48 83 ec 10          	sub    $0x10,%rsp
+    420e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4212:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Args>(args)...)
+    4216:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    421a:	48 89 c7             	mov    %rax,%rdi
+    421d:	e8 cb fd ff ff       	call   3fed <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    4222:	48 8b 10             	mov    (%rax),%rdx
+    4225:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4229:	48 89 10             	mov    %rdx,(%rax)
+        }
+    422c:	90                   	nop
+    422d:	c9                   	leave
+    422e:	c3                   	ret
+    422f:	90                   	nop
+
+0000000000004230 <nel::Element<void*>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    4230:	55                   	push   %rbp
+    4231:	48 89 e5             	mov    %rsp,%rbp
+    4234:	48 83 ec 10          	sub    $0x10,%rsp
+    4238:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    423c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4240:	48 89 c7             	mov    %rax,%rdi
+    4243:	e8 78 00 00 00       	call   42c0 <nel::Element<void*>::ref() const>
+        }
+    4248:	c9                   	leave
+    4249:	c3                   	ret
+
+000000000000424a <nel::Element<nel::heaped::AllocError>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    424a:	55                   	push   %rbp
+    424b:	48 89 e5             	mov    %rsp,%rbp
+    424e:	48 83 ec 10          	sub    $0x10,%rsp
+    4252:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    4256:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    425a:	48 89 c7             	mov    %rax,%rdi
+    425d:	e8 6c 00 00 00       	call   42ce <nel::Element<nel::heaped::AllocError>::ref() const>
+        }
+    4262:	c9                   	leave
+    4263:	c3                   	ret
+
+0000000000004264 <nel::Element<nel::par::ParError>::Element(nel::par::ParError&&)>:
+        constexpr Element(Type &&val)
+    4264:	55                   	push   %rbp
+    4265:	48 89 e5             	mov    %rsp,%rbp
+    4268:	48 83 ec 10          	sub    $0x10,%rsp
+    426c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4270:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    4274:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    4278:	48 89 c7             	mov    %rax,%rdi
+    427b:	e8 2a e2 ff ff       	call   24aa <nel::par::ParError&& nel::forward<nel::par::ParError, nel::par::ParError>(nel::par::ParError&)>
+    4280:	8b 10                	mov    (%rax),%edx
+    4282:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    4286:	89 10                	mov    %edx,(%rax)
+        }
+    4288:	90                   	nop
+    4289:	c9                   	leave
+    428a:	c3                   	ret
+    428b:	90                   	nop
+
+000000000000428c <nel::Element<nel::par::Pool>::Element(nel::par::Pool&&)>:
+        constexpr Element(Type &&val)
+    428c:	55                   	push   %rbp
+    428d:	48 89 e5             	mov    %rsp,%rbp
+    4290:	53                   	push   %rbx
+    4291:	48 83 ec 18          	sub    $0x18,%rsp
+    4295:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    4299:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : value_(forward<Type>(val))
+    429d:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    42a1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    42a5:	48 89 c7             	mov    %rax,%rdi
+    42a8:	e8 f7 e0 ff ff       	call   23a4 <nel::par::Pool&& nel::forward<nel::par::Pool, nel::par::Pool>(nel::par::Pool&)>
+    42ad:	48 89 c6             	mov    %rax,%rsi
+    42b0:	48 89 df             	mov    %rbx,%rdi
+    42b3:	e8 d0 db ff ff       	call   1e88 <nel::par::Pool::Pool(nel::par::Pool&&)>
+        }
+    42b8:	90                   	nop
+    42b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    42bd:	c9                   	leave
+    42be:	c3                   	ret
+    42bf:	90                   	nop
+
+00000000000042c0 <nel::Element<void*>::ref() const>:
+        constexpr Type const &ref(void) const
+    42c0:	55                   	push   %rbp
+    42c1:	48 89 e5             	mov    %rsp,%rbp
+    42c4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    42c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    42cc:	5d                   	pop    %rbp
+    42cd:	c3                   	ret
+
+00000000000042ce <nel::Element<nel::heaped::AllocError>::ref() const>:
+        constexpr Type const &ref(void) const
+    42ce:	55                   	push   %rbp
+    42cf:	48 89 e5             	mov    %rsp,%rbp
+    42d2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    42d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    42da:	5d                   	pop    %rbp
+    42db:	c3                   	ret
+
+Disassembly of section .fini:
+
+00000000000042dc <_fini>:
+    42dc:	48 83 ec 08          	sub    $0x8,%rsp
+    42e0:	48 83 c4 08          	add    $0x8,%rsp
+    42e4:	c3                   	ret
@@ -0,0 +1,2092 @@
+
+target/debug/examples/iterator:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 3f 00 00 	mov    0x3fc5(%rip),%rax        # 4fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <fputs@plt-0x10>:
+    1020:	ff 35 ca 3f 00 00    	push   0x3fca(%rip)        # 4ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 3f 00 00    	jmp    *0x3fcc(%rip)        # 4ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <fputs@plt>:
+    1030:	ff 25 ca 3f 00 00    	jmp    *0x3fca(%rip)        # 5000 <fputs@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <fputc@plt>:
+    1040:	ff 25 c2 3f 00 00    	jmp    *0x3fc2(%rip)        # 5008 <fputc@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fprintf@plt>:
+    1050:	ff 25 ba 3f 00 00    	jmp    *0x3fba(%rip)        # 5010 <fprintf@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+0000000000001060 <__cxa_finalize@plt>:
+    1060:	ff 25 7a 3f 00 00    	jmp    *0x3f7a(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1066:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+0000000000001070 <_start>:
+    1070:	31 ed                	xor    %ebp,%ebp
+    1072:	49 89 d1             	mov    %rdx,%r9
+    1075:	5e                   	pop    %rsi
+    1076:	48 89 e2             	mov    %rsp,%rdx
+    1079:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    107d:	50                   	push   %rax
+    107e:	54                   	push   %rsp
+    107f:	45 31 c0             	xor    %r8d,%r8d
+    1082:	31 c9                	xor    %ecx,%ecx
+    1084:	48 8d 3d 38 04 00 00 	lea    0x438(%rip),%rdi        # 14c3 <main>
+    108b:	ff 15 2f 3f 00 00    	call   *0x3f2f(%rip)        # 4fc0 <__libc_start_main@GLIBC_2.34>
+    1091:	f4                   	hlt
+    1092:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1099:	00 00 00 
+    109c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000010a0 <deregister_tm_clones>:
+    10a0:	    48 8d 3d 81 3f 00 00 	lea    0x3f81(%rip),%rdi        # 5028 <__TMC_END__>
+    10a7:	    48 8d 05 7a 3f 00 00 	lea    0x3f7a(%rip),%rax        # 5028 <__TMC_END__>
+    10ae:	    48 39 f8             	cmp    %rdi,%rax
+    10b1:	/-- 74 15                	je     10c8 <deregister_tm_clones+0x28>
+    10b3:	|   48 8b 05 0e 3f 00 00 	mov    0x3f0e(%rip),%rax        # 4fc8 <_ITM_deregisterTMCloneTable@Base>
+    10ba:	|   48 85 c0             	test   %rax,%rax
+    10bd:	+-- 74 09                	je     10c8 <deregister_tm_clones+0x28>
+    10bf:	|   ff e0                	jmp    *%rax
+    10c1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    10c8:	\-> c3                   	ret
+    10c9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000010d0 <register_tm_clones>:
+    10d0:	    48 8d 3d 51 3f 00 00 	lea    0x3f51(%rip),%rdi        # 5028 <__TMC_END__>
+    10d7:	    48 8d 35 4a 3f 00 00 	lea    0x3f4a(%rip),%rsi        # 5028 <__TMC_END__>
+    10de:	    48 29 fe             	sub    %rdi,%rsi
+    10e1:	    48 89 f0             	mov    %rsi,%rax
+    10e4:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    10e8:	    48 c1 f8 03          	sar    $0x3,%rax
+    10ec:	    48 01 c6             	add    %rax,%rsi
+    10ef:	    48 d1 fe             	sar    %rsi
+    10f2:	/-- 74 14                	je     1108 <register_tm_clones+0x38>
+    10f4:	|   48 8b 05 dd 3e 00 00 	mov    0x3edd(%rip),%rax        # 4fd8 <_ITM_registerTMCloneTable@Base>
+    10fb:	|   48 85 c0             	test   %rax,%rax
+    10fe:	+-- 74 08                	je     1108 <register_tm_clones+0x38>
+    1100:	|   ff e0                	jmp    *%rax
+    1102:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1108:	\-> c3                   	ret
+    1109:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001110 <__do_global_dtors_aux>:
+    1110:	       f3 0f 1e fa          	endbr64
+    1114:	       80 3d 2d 3f 00 00 00 	cmpb   $0x0,0x3f2d(%rip)        # 5048 <completed.0>
+    111b:	/----- 75 2b                	jne    1148 <__do_global_dtors_aux+0x38>
+    111d:	|      55                   	push   %rbp
+    111e:	|      48 83 3d ba 3e 00 00 	cmpq   $0x0,0x3eba(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1125:	|      00 
+    1126:	|      48 89 e5             	mov    %rsp,%rbp
+    1129:	|  /-- 74 0c                	je     1137 <__do_global_dtors_aux+0x27>
+    112b:	|  |   48 8b 3d ee 3e 00 00 	mov    0x3eee(%rip),%rdi        # 5020 <__dso_handle>
+    1132:	|  |   e8 29 ff ff ff       	call   1060 <__cxa_finalize@plt>
+    1137:	|  \-> e8 64 ff ff ff       	call   10a0 <deregister_tm_clones>
+    113c:	|      c6 05 05 3f 00 00 01 	movb   $0x1,0x3f05(%rip)        # 5048 <completed.0>
+    1143:	|      5d                   	pop    %rbp
+    1144:	|      c3                   	ret
+    1145:	|      0f 1f 00             	nopl   (%rax)
+    1148:	\----> c3                   	ret
+    1149:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001150 <frame_dummy>:
+    1150:	f3 0f 1e fa          	endbr64
+    1154:	e9 77 ff ff ff       	jmp    10d0 <register_tm_clones>
+    1159:	90                   	nop
+
+000000000000115a <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+// The iterator protocols side by side, for reading the generated code (see iterator.s).
+// For timings of these, see bench_iterator.cc.
+
+    115a:	55                   	push   %rbp
+    115b:	48 89 e5             	mov    %rsp,%rbp
+    115e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1162:	89 75 f4             	mov    %esi,-0xc(%rbp)
+#include <nel/iterator.hh>
+    1165:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+
+    116a:	5d                   	pop    %rbp
+    116b:	c3                   	ret
+
+000000000000116c <_fstat_r>:
+#include <nel/heapless/vector.hh>
+    116c:	55                   	push   %rbp
+    116d:	48 89 e5             	mov    %rsp,%rbp
+    1170:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1174:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1177:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+
+    117b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+#include <nel/log.hh>
+    1180:	5d                   	pop    %rbp
+    1181:	c3                   	ret
+
+0000000000001182 <_kill_r>:
+#include <nel/defs.hh>
+    1182:	55                   	push   %rbp
+    1183:	48 89 e5             	mov    %rsp,%rbp
+    1186:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    118a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    118d:	89 55 f0             	mov    %edx,-0x10(%rbp)
+#include "libnosys_stubs.cx"
+    1190:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+
+    1195:	5d                   	pop    %rbp
+    1196:	c3                   	ret
+
+0000000000001197 <_lseek_r>:
+void do1(nel::Slice<int>::Iterator &&it)
+    1197:	55                   	push   %rbp
+    1198:	48 89 e5             	mov    %rsp,%rbp
+    119b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    119f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11a2:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    11a5:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+{
+    11a8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    it.for_each([&](int const &e) { nel::log << e << ','; });
+    11ad:	5d                   	pop    %rbp
+    11ae:	c3                   	ret
+
+00000000000011af <_read_r>:
+}
+    11af:	55                   	push   %rbp
+    11b0:	48 89 e5             	mov    %rsp,%rbp
+    11b3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11b7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+
+    11ba:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+#if defined(RUST_LIKE)
+    11bf:	5d                   	pop    %rbp
+    11c0:	c3                   	ret
+
+00000000000011c1 <_write_r>:
+void do2(nel::Slice<int>::Iterator &&it)
+    11c1:	55                   	push   %rbp
+    11c2:	48 89 e5             	mov    %rsp,%rbp
+    11c5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11c9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11cc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    11d0:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+{
+    11d3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    it.for_each2([&](int const &e) { nel::log << e << ','; });
+    11d8:	5d                   	pop    %rbp
+    11d9:	c3                   	ret
+
+00000000000011da <_getpid_r>:
+}
+    11da:	55                   	push   %rbp
+    11db:	48 89 e5             	mov    %rsp,%rbp
+    11de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#endif
+    11e2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+
+    11e7:	5d                   	pop    %rbp
+    11e8:	c3                   	ret
+
+00000000000011e9 <_isatty_r>:
+void do3(nel::Slice<int>::Iterator &&it)
+    11e9:	55                   	push   %rbp
+    11ea:	48 89 e5             	mov    %rsp,%rbp
+    11ed:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11f1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+{
+    11f4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    it.template map<int>([](int const &e) -> int { return e * 100; })
+    11f9:	5d                   	pop    %rbp
+    11fa:	c3                   	ret
+    11fb:	90                   	nop
+
+00000000000011fc <do1(nel::SliceIterator<int>&&)::{lambda(int const&)#1}::operator()(int const&) const>:
+    it.for_each([&](int const &e) { nel::log << e << ','; });
+    11fc:	55                   	push   %rbp
+    11fd:	48 89 e5             	mov    %rsp,%rbp
+    1200:	48 83 ec 10          	sub    $0x10,%rsp
+    1204:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1208:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    120c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1210:	8b 00                	mov    (%rax),%eax
+    1212:	89 c6                	mov    %eax,%esi
+    1214:	48 8d 05 2e 3e 00 00 	lea    0x3e2e(%rip),%rax        # 5049 <nel::log>
+    121b:	48 89 c7             	mov    %rax,%rdi
+    121e:	e8 e6 0f 00 00       	call   2209 <nel::operator<<(nel::Log&, int)>
+    1223:	be 2c 00 00 00       	mov    $0x2c,%esi
+    1228:	48 89 c7             	mov    %rax,%rdi
+    122b:	e8 d8 0e 00 00       	call   2108 <nel::operator<<(nel::Log&, char)>
+    1230:	90                   	nop
+    1231:	c9                   	leave
+    1232:	c3                   	ret
+
+0000000000001233 <do1(nel::SliceIterator<int>&&)>:
+{
+    1233:	55                   	push   %rbp
+    1234:	48 89 e5             	mov    %rsp,%rbp
+    1237:	48 83 ec 20          	sub    $0x20,%rsp
+    123b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    it.for_each([&](int const &e) { nel::log << e << ','; });
+    123f:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    1243:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1247:	48 89 d6             	mov    %rdx,%rsi
+    124a:	48 89 c7             	mov    %rax,%rdi
+    124d:	e8 ce 02 00 00       	call   1520 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<do1(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>(do1(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&&)>
+}
+    1252:	90                   	nop
+    1253:	c9                   	leave
+    1254:	c3                   	ret
+    1255:	90                   	nop
+
+0000000000001256 <do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}::operator()(int const&) const>:
+    it.template map<int>([](int const &e) -> int { return e * 100; })
+    1256:	55                   	push   %rbp
+    1257:	48 89 e5             	mov    %rsp,%rbp
+    125a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    125e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1262:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1266:	8b 00                	mov    (%rax),%eax
+    1268:	6b c0 64             	imul   $0x64,%eax,%eax
+    126b:	5d                   	pop    %rbp
+    126c:	c3                   	ret
+    126d:	90                   	nop
+
+000000000000126e <do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}::operator()(int const&) const>:
+        .first_n(4)
+        .for_each([&](int const &e) { nel::log << e << ','; });
+    126e:	55                   	push   %rbp
+    126f:	48 89 e5             	mov    %rsp,%rbp
+    1272:	48 83 ec 10          	sub    $0x10,%rsp
+    1276:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    127a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    127e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1282:	8b 00                	mov    (%rax),%eax
+    1284:	89 c6                	mov    %eax,%esi
+    1286:	48 8d 05 bc 3d 00 00 	lea    0x3dbc(%rip),%rax        # 5049 <nel::log>
+    128d:	48 89 c7             	mov    %rax,%rdi
+    1290:	e8 74 0f 00 00       	call   2209 <nel::operator<<(nel::Log&, int)>
+    1295:	be 2c 00 00 00       	mov    $0x2c,%esi
+    129a:	48 89 c7             	mov    %rax,%rdi
+    129d:	e8 66 0e 00 00       	call   2108 <nel::operator<<(nel::Log&, char)>
+    12a2:	90                   	nop
+    12a3:	c9                   	leave
+    12a4:	c3                   	ret
+
+00000000000012a5 <do3(nel::SliceIterator<int>&&)>:
+{
+    12a5:	55                   	push   %rbp
+    12a6:	48 89 e5             	mov    %rsp,%rbp
+    12a9:	48 83 ec 60          	sub    $0x60,%rsp
+    12ad:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+    it.template map<int>([](int const &e) -> int { return e * 100; })
+    12b1:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    12b5:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    12b9:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+    12bd:	48 89 ce             	mov    %rcx,%rsi
+    12c0:	48 89 c7             	mov    %rax,%rdi
+    12c3:	e8 c4 02 00 00       	call   158c <nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> nel::Iterator<nel::SliceIterator<int>, int&, int&>::map<int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&&)>
+        .first_n(4)
+    12c8:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    12cc:	48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+    12d0:	ba 04 00 00 00       	mov    $0x4,%edx
+    12d5:	48 89 ce             	mov    %rcx,%rsi
+    12d8:	48 89 c7             	mov    %rax,%rdi
+    12db:	e8 04 03 00 00       	call   15e4 <nel::Iterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>, int&, int>::first_n(unsigned long)>
+        .for_each([&](int const &e) { nel::log << e << ','; });
+    12e0:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    12e4:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    12e8:	48 89 d6             	mov    %rdx,%rsi
+    12eb:	48 89 c7             	mov    %rax,%rdi
+    12ee:	e8 89 03 00 00       	call   167c <void nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)>
+}
+    12f3:	90                   	nop
+    12f4:	c9                   	leave
+    12f5:	c3                   	ret
+
+00000000000012f6 <do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}::operator()(int const&) const>:
+#endif
+
+void do5(nel::Slice<int>::Iterator &&it)
+{
+    // loopy,  simpe to read, slow..
+    int v = it.template map<int>([](int const &e) -> int { return e * 100; })
+    12f6:	55                   	push   %rbp
+    12f7:	48 89 e5             	mov    %rsp,%rbp
+    12fa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    12fe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1302:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1306:	8b 00                	mov    (%rax),%eax
+    1308:	6b c0 64             	imul   $0x64,%eax,%eax
+    130b:	5d                   	pop    %rbp
+    130c:	c3                   	ret
+    130d:	90                   	nop
+
+000000000000130e <do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}::operator()(int&, int&) const>:
+                .first_n(400)
+                .fold(10, [&](int &acc, int &e) { acc += e; });
+    130e:	55                   	push   %rbp
+    130f:	48 89 e5             	mov    %rsp,%rbp
+    1312:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1316:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    131a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    131e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1322:	8b 10                	mov    (%rax),%edx
+    1324:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1328:	8b 00                	mov    (%rax),%eax
+    132a:	01 c2                	add    %eax,%edx
+    132c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1330:	89 10                	mov    %edx,(%rax)
+    1332:	90                   	nop
+    1333:	5d                   	pop    %rbp
+    1334:	c3                   	ret
+
+0000000000001335 <do5(nel::SliceIterator<int>&&)>:
+{
+    1335:	55                   	push   %rbp
+    1336:	48 89 e5             	mov    %rsp,%rbp
+    1339:	48 83 ec 70          	sub    $0x70,%rsp
+    133d:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    int v = it.template map<int>([](int const &e) -> int { return e * 100; })
+    1341:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1345:	48 8d 55 f6          	lea    -0xa(%rbp),%rdx
+    1349:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+    134d:	48 89 ce             	mov    %rcx,%rsi
+    1350:	48 89 c7             	mov    %rax,%rdi
+    1353:	e8 7a 03 00 00       	call   16d2 <nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> nel::Iterator<nel::SliceIterator<int>, int&, int&>::map<int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>(do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&&)>
+                .first_n(400)
+    1358:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    135c:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    1360:	ba 90 01 00 00       	mov    $0x190,%edx
+    1365:	48 89 ce             	mov    %rcx,%rsi
+    1368:	48 89 c7             	mov    %rax,%rdi
+    136b:	e8 ba 03 00 00       	call   172a <nel::Iterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>, int&, int>::first_n(unsigned long)>
+                .fold(10, [&](int &acc, int &e) { acc += e; });
+    1370:	c7 45 f8 0a 00 00 00 	movl   $0xa,-0x8(%rbp)
+    1377:	48 8d 55 f7          	lea    -0x9(%rbp),%rdx
+    137b:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    137f:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    1383:	48 89 ce             	mov    %rcx,%rsi
+    1386:	48 89 c7             	mov    %rax,%rdi
+    1389:	e8 10 04 00 00       	call   179e <int nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)>
+    138e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    nel::log << v;
+    1391:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1394:	89 c6                	mov    %eax,%esi
+    1396:	48 8d 05 ac 3c 00 00 	lea    0x3cac(%rip),%rax        # 5049 <nel::log>
+    139d:	48 89 c7             	mov    %rax,%rdi
+    13a0:	e8 64 0e 00 00       	call   2209 <nel::operator<<(nel::Log&, int)>
+}
+    13a5:	90                   	nop
+    13a6:	c9                   	leave
+    13a7:	c3                   	ret
+
+00000000000013a8 <ex1()::{lambda(int&)#1}::operator()(int&) const>:
+
+void ex1()
+{
+    auto a1 = nel::heapless::Vector<int, 1000>();
+    float v = 23;
+    a1.iter().for_each([&](int &e) {
+    13a8:	55                   	push   %rbp
+    13a9:	48 89 e5             	mov    %rsp,%rbp
+    13ac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    13b0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        e = v;
+    13b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13b8:	48 8b 00             	mov    (%rax),%rax
+    13bb:	f3 0f 10 00          	movss  (%rax),%xmm0
+    13bf:	f3 0f 2c d0          	cvttss2si %xmm0,%edx
+    13c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13c7:	89 10                	mov    %edx,(%rax)
+    13c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13cd:	48 8b 00             	mov    (%rax),%rax
+        v += 34;
+    13d0:	f3 0f 10 08          	movss  (%rax),%xmm1
+        e = v;
+    13d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13d8:	48 8b 00             	mov    (%rax),%rax
+        v += 34;
+    13db:	f3 0f 10 05 51 1c 00 	movss  0x1c51(%rip),%xmm0        # 3034 <nel::sort::ninther_n+0x14>
+    13e2:	00 
+    13e3:	f3 0f 58 c1          	addss  %xmm1,%xmm0
+    13e7:	f3 0f 11 00          	movss  %xmm0,(%rax)
+    });
+    13eb:	90                   	nop
+    13ec:	5d                   	pop    %rbp
+    13ed:	c3                   	ret
+
+00000000000013ee <ex1()>:
+{
+    13ee:	55                   	push   %rbp
+    13ef:	48 89 e5             	mov    %rsp,%rbp
+    13f2:	48 81 ec 10 10 00 00 	sub    $0x1010,%rsp
+    auto a1 = nel::heapless::Vector<int, 1000>();
+    13f9:	48 8d 85 00 f0 ff ff 	lea    -0x1000(%rbp),%rax
+    1400:	48 89 c7             	mov    %rax,%rdi
+    1403:	e8 68 09 00 00       	call   1d70 <nel::heapless::Vector<int, 1000ul>::Vector()>
+    float v = 23;
+    1408:	f3 0f 10 05 28 1c 00 	movss  0x1c28(%rip),%xmm0        # 3038 <nel::sort::ninther_n+0x18>
+    140f:	00 
+    1410:	f3 0f 11 85 fc ef ff 	movss  %xmm0,-0x1004(%rbp)
+    1417:	ff 
+    a1.iter().for_each([&](int &e) {
+    1418:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    141c:	48 8d 95 00 f0 ff ff 	lea    -0x1000(%rbp),%rdx
+    1423:	48 89 d6             	mov    %rdx,%rsi
+    1426:	48 89 c7             	mov    %rax,%rdi
+    1429:	e8 78 09 00 00       	call   1da6 <nel::heapless::Vector<int, 1000ul>::iter()>
+    142e:	48 8d 85 fc ef ff ff 	lea    -0x1004(%rbp),%rax
+    1435:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    1439:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+    143d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    1441:	48 89 d6             	mov    %rdx,%rsi
+    1444:	48 89 c7             	mov    %rax,%rdi
+    1447:	e8 aa 03 00 00       	call   17f6 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<ex1()::{lambda(int&)#1}>(ex1()::{lambda(int&)#1}&&)>
+    do1(a1.iter());
+    144c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1450:	48 8d 95 00 f0 ff ff 	lea    -0x1000(%rbp),%rdx
+    1457:	48 89 d6             	mov    %rdx,%rsi
+    145a:	48 89 c7             	mov    %rax,%rdi
+    145d:	e8 44 09 00 00       	call   1da6 <nel::heapless::Vector<int, 1000ul>::iter()>
+    1462:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1466:	48 89 c7             	mov    %rax,%rdi
+    1469:	e8 c5 fd ff ff       	call   1233 <do1(nel::SliceIterator<int>&&)>
+#if defined(RUST_LIKE)
+    do2(a1.iter());
+#endif
+
+    do3(a1.iter());
+    146e:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1472:	48 8d 95 00 f0 ff ff 	lea    -0x1000(%rbp),%rdx
+    1479:	48 89 d6             	mov    %rdx,%rsi
+    147c:	48 89 c7             	mov    %rax,%rdi
+    147f:	e8 22 09 00 00       	call   1da6 <nel::heapless::Vector<int, 1000ul>::iter()>
+    1484:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1488:	48 89 c7             	mov    %rax,%rdi
+    148b:	e8 15 fe ff ff       	call   12a5 <do3(nel::SliceIterator<int>&&)>
+#if defined(RUST_LIKE)
+    do4(a1.iter());
+#endif
+    do5(a1.iter());
+    1490:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1494:	48 8d 95 00 f0 ff ff 	lea    -0x1000(%rbp),%rdx
+    149b:	48 89 d6             	mov    %rdx,%rsi
+    149e:	48 89 c7             	mov    %rax,%rdi
+    14a1:	e8 00 09 00 00       	call   1da6 <nel::heapless::Vector<int, 1000ul>::iter()>
+    14a6:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    14aa:	48 89 c7             	mov    %rax,%rdi
+    14ad:	e8 83 fe ff ff       	call   1335 <do5(nel::SliceIterator<int>&&)>
+#if defined(RUST_LIKE)
+    do6(a1.iter());
+#endif
+}
+    14b2:	48 8d 85 00 f0 ff ff 	lea    -0x1000(%rbp),%rax
+    14b9:	48 89 c7             	mov    %rax,%rdi
+    14bc:	e8 21 09 00 00       	call   1de2 <nel::heapless::Vector<int, 1000ul>::~Vector()>
+    14c1:	c9                   	leave
+    14c2:	c3                   	ret
+
+00000000000014c3 <main>:
+
+int main()
+{
+    14c3:	55                   	push   %rbp
+    14c4:	48 89 e5             	mov    %rsp,%rbp
+    nel::log << "ex1:b" << '\n';
+    14c7:	48 8d 05 5a 1b 00 00 	lea    0x1b5a(%rip),%rax        # 3028 <nel::sort::ninther_n+0x8>
+    14ce:	48 89 c6             	mov    %rax,%rsi
+    14d1:	48 8d 05 71 3b 00 00 	lea    0x3b71(%rip),%rax        # 5049 <nel::log>
+    14d8:	48 89 c7             	mov    %rax,%rdi
+    14db:	e8 54 0c 00 00       	call   2134 <nel::operator<<(nel::Log&, char const*)>
+    14e0:	be 0a 00 00 00       	mov    $0xa,%esi
+    14e5:	48 89 c7             	mov    %rax,%rdi
+    14e8:	e8 1b 0c 00 00       	call   2108 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    14ed:	e8 fc fe ff ff       	call   13ee <ex1()>
+    nel::log << "ex1:e" << '\n';
+    14f2:	48 8d 05 35 1b 00 00 	lea    0x1b35(%rip),%rax        # 302e <nel::sort::ninther_n+0xe>
+    14f9:	48 89 c6             	mov    %rax,%rsi
+    14fc:	48 8d 05 46 3b 00 00 	lea    0x3b46(%rip),%rax        # 5049 <nel::log>
+    1503:	48 89 c7             	mov    %rax,%rdi
+    1506:	e8 29 0c 00 00       	call   2134 <nel::operator<<(nel::Log&, char const*)>
+    150b:	be 0a 00 00 00       	mov    $0xa,%esi
+    1510:	48 89 c7             	mov    %rax,%rdi
+    1513:	e8 f0 0b 00 00       	call   2108 <nel::operator<<(nel::Log&, char)>
+}
+    1518:	b8 00 00 00 00       	mov    $0x0,%eax
+    151d:	5d                   	pop    %rbp
+    151e:	c3                   	ret
+    151f:	90                   	nop
+
+0000000000001520 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<do1(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>(do1(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&&)>:
+         * @param fn func to apply to each item in iterator
+         */
+        // void for_each(std::function<void(OutT)> fn)
+#    if defined(C_LIKE) || defined(RUST_LIKE)
+        template<typename F>
+        void for_each(F &&fn)
+    1520:	       55                   	push   %rbp
+    1521:	       48 89 e5             	mov    %rsp,%rbp
+    1524:	       48 83 ec 10          	sub    $0x10,%rsp
+    1528:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    152c:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        template<typename F>
+        void for_each2(F &&fn)
+#        endif
+        {
+#        if 1
+            for (; !self().is_done(); self().inc()) {
+    1530:	   /-- eb 3a                	jmp    156c <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<do1(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>(do1(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&&)+0x4c>
+                fn(self().deref());
+    1532:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1536:	|  |   48 89 c7             	mov    %rax,%rdi
+    1539:	|  |   e8 8e 09 00 00       	call   1ecc <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    153e:	|  |   48 89 c7             	mov    %rax,%rdi
+    1541:	|  |   e8 da 09 00 00       	call   1f20 <nel::SliceIterator<int>::deref()>
+    1546:	|  |   48 89 c2             	mov    %rax,%rdx
+    1549:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    154d:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1550:	|  |   48 89 c7             	mov    %rax,%rdi
+    1553:	|  |   e8 a4 fc ff ff       	call   11fc <do1(nel::SliceIterator<int>&&)::{lambda(int const&)#1}::operator()(int const&) const>
+            for (; !self().is_done(); self().inc()) {
+    1558:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    155c:	|  |   48 89 c7             	mov    %rax,%rdi
+    155f:	|  |   e8 68 09 00 00       	call   1ecc <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1564:	|  |   48 89 c7             	mov    %rax,%rdi
+    1567:	|  |   e8 96 09 00 00       	call   1f02 <nel::SliceIterator<int>::inc()>
+    156c:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1570:	|      48 89 c7             	mov    %rax,%rdi
+    1573:	|      e8 54 09 00 00       	call   1ecc <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1578:	|      48 89 c7             	mov    %rax,%rdi
+    157b:	|      e8 62 09 00 00       	call   1ee2 <nel::SliceIterator<int>::is_done() const>
+    1580:	|      83 f0 01             	xor    $0x1,%eax
+    1583:	|      84 c0                	test   %al,%al
+    1585:	\----- 75 ab                	jne    1532 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<do1(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>(do1(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&&)+0x12>
+            fn(self().deref());
+            self().inc();
+enter:
+            if (!self().is_done()) { goto loop; }
+#        endif
+        }
+    1587:	       90                   	nop
+    1588:	       90                   	nop
+    1589:	       c9                   	leave
+    158a:	       c3                   	ret
+    158b:	       90                   	nop
+
+000000000000158c <nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> nel::Iterator<nel::SliceIterator<int>, int&, int&>::map<int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&&)>:
+
+        // template<typename U>
+        // MappingIterator<ItT, U> map(std::function<U(OutT &)> fn)
+        // template<typename Fn, typename U>
+        template<typename U, typename Fn>
+        constexpr MappingIterator<ItT, U, Fn> map(Fn &&fn)
+    158c:	55                   	push   %rbp
+    158d:	48 89 e5             	mov    %rsp,%rbp
+    1590:	53                   	push   %rbx
+    1591:	48 83 ec 28          	sub    $0x28,%rsp
+    1595:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1599:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    159d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+        {
+            return MappingIterator<ItT, U, Fn>(move(self()), forward<Fn>(fn));
+    15a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    15a5:	48 89 c7             	mov    %rax,%rdi
+    15a8:	e8 b4 02 00 00       	call   1861 <do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&& nel::forward<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&)>
+    15ad:	48 89 c3             	mov    %rax,%rbx
+    15b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    15b4:	48 89 c7             	mov    %rax,%rdi
+    15b7:	e8 10 09 00 00       	call   1ecc <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    15bc:	48 89 c7             	mov    %rax,%rdi
+    15bf:	e8 6d 09 00 00       	call   1f31 <nel::SliceIterator<int>&& nel::move<nel::SliceIterator<int> >(nel::SliceIterator<int>&)>
+    15c4:	48 89 c1             	mov    %rax,%rcx
+    15c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15cb:	48 89 da             	mov    %rbx,%rdx
+    15ce:	48 89 ce             	mov    %rcx,%rsi
+    15d1:	48 89 c7             	mov    %rax,%rdi
+    15d4:	e8 97 02 00 00       	call   1870 <nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::MappingIterator(nel::SliceIterator<int>&&, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&&)>
+        }
+    15d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    15e1:	c9                   	leave
+    15e2:	c3                   	ret
+    15e3:	90                   	nop
+
+00000000000015e4 <nel::Iterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>, int&, int>::first_n(unsigned long)>:
+        constexpr FirstNIterator<ItT> first_n(Count const limit)
+    15e4:	55                   	push   %rbp
+    15e5:	48 89 e5             	mov    %rsp,%rbp
+    15e8:	48 83 ec 20          	sub    $0x20,%rsp
+    15ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    15f0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    15f4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            return FirstNIterator<ItT>(move(self()), limit);
+    15f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15fc:	48 89 c7             	mov    %rax,%rdi
+    15ff:	e8 b0 02 00 00       	call   18b4 <nel::Iterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>, int&, int>::self()>
+    1604:	48 89 c7             	mov    %rax,%rdi
+    1607:	e8 be 02 00 00       	call   18ca <nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&& nel::move<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >(nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&)>
+    160c:	48 89 c1             	mov    %rax,%rcx
+    160f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1613:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1617:	48 89 ce             	mov    %rcx,%rsi
+    161a:	48 89 c7             	mov    %rax,%rdi
+    161d:	e8 dc 02 00 00       	call   18fe <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::FirstNIterator(nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&&, unsigned long)>
+        }
+    1622:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1626:	c9                   	leave
+    1627:	c3                   	ret
+
+0000000000001628 <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}::operator()(bool&, int) const>:
+        template<typename F>
+        void for_each(F &&fn)
+        {
+            if (current_ >= limit_) { return; }
+            bool unused = true;
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    1628:	55                   	push   %rbp
+    1629:	48 89 e5             	mov    %rsp,%rbp
+    162c:	48 83 ec 20          	sub    $0x20,%rsp
+    1630:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1634:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1638:	89 55 ec             	mov    %edx,-0x14(%rbp)
+    163b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    163f:	48 8b 40 08          	mov    0x8(%rax),%rax
+                fn(e);
+    1643:	48 8d 55 ec          	lea    -0x14(%rbp),%rdx
+    1647:	48 89 d6             	mov    %rdx,%rsi
+    164a:	48 89 c7             	mov    %rax,%rdi
+    164d:	e8 1c fc ff ff       	call   126e <do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}::operator()(int const&) const>
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    1652:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1656:	48 8b 00             	mov    (%rax),%rax
+                return ++current_ < limit_;
+    1659:	48 8b 50 18          	mov    0x18(%rax),%rdx
+    165d:	48 83 c2 01          	add    $0x1,%rdx
+    1661:	48 89 50 18          	mov    %rdx,0x18(%rax)
+    1665:	48 8b 50 18          	mov    0x18(%rax),%rdx
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    1669:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    166d:	48 8b 00             	mov    (%rax),%rax
+                return ++current_ < limit_;
+    1670:	48 8b 40 20          	mov    0x20(%rax),%rax
+    1674:	48 39 c2             	cmp    %rax,%rdx
+    1677:	0f 92 c0             	setb   %al
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    167a:	c9                   	leave
+    167b:	c3                   	ret
+
+000000000000167c <void nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)>:
+        void for_each(F &&fn)
+    167c:	       55                   	push   %rbp
+    167d:	       48 89 e5             	mov    %rsp,%rbp
+    1680:	       48 83 ec 30          	sub    $0x30,%rsp
+    1684:	       48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1688:	       48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+            if (current_ >= limit_) { return; }
+    168c:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1690:	       48 8b 50 18          	mov    0x18(%rax),%rdx
+    1694:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1698:	       48 8b 40 20          	mov    0x20(%rax),%rax
+    169c:	       48 39 c2             	cmp    %rax,%rdx
+    169f:	/----- 73 2d                	jae    16ce <void nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)+0x52>
+            bool unused = true;
+    16a1:	|      c6 45 ef 01          	movb   $0x1,-0x11(%rbp)
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    16a5:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    16a9:	|      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    16ad:	|      48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    16b1:	|      48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    16b5:	|      48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    16b9:	|      48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    16bd:	|      48 8d 4d ef          	lea    -0x11(%rbp),%rcx
+    16c1:	|      48 89 ce             	mov    %rcx,%rsi
+    16c4:	|      48 89 c7             	mov    %rax,%rdi
+    16c7:	|      e8 d0 02 00 00       	call   199c <bool nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}&&)>
+    16cc:	|  /-- eb 01                	jmp    16cf <void nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)+0x53>
+            if (current_ >= limit_) { return; }
+    16ce:	\--|-> 90                   	nop
+            });
+        }
+    16cf:	   \-> c9                   	leave
+    16d0:	       c3                   	ret
+    16d1:	       90                   	nop
+
+00000000000016d2 <nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> nel::Iterator<nel::SliceIterator<int>, int&, int&>::map<int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>(do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&&)>:
+        constexpr MappingIterator<ItT, U, Fn> map(Fn &&fn)
+    16d2:	55                   	push   %rbp
+    16d3:	48 89 e5             	mov    %rsp,%rbp
+    16d6:	53                   	push   %rbx
+    16d7:	48 83 ec 28          	sub    $0x28,%rsp
+    16db:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    16df:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    16e3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            return MappingIterator<ItT, U, Fn>(move(self()), forward<Fn>(fn));
+    16e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    16eb:	48 89 c7             	mov    %rax,%rdi
+    16ee:	e8 e6 02 00 00       	call   19d9 <do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&& nel::forward<do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>(do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&)>
+    16f3:	48 89 c3             	mov    %rax,%rbx
+    16f6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    16fa:	48 89 c7             	mov    %rax,%rdi
+    16fd:	e8 ca 07 00 00       	call   1ecc <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1702:	48 89 c7             	mov    %rax,%rdi
+    1705:	e8 27 08 00 00       	call   1f31 <nel::SliceIterator<int>&& nel::move<nel::SliceIterator<int> >(nel::SliceIterator<int>&)>
+    170a:	48 89 c1             	mov    %rax,%rcx
+    170d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1711:	48 89 da             	mov    %rbx,%rdx
+    1714:	48 89 ce             	mov    %rcx,%rsi
+    1717:	48 89 c7             	mov    %rax,%rdi
+    171a:	e8 c9 02 00 00       	call   19e8 <nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::MappingIterator(nel::SliceIterator<int>&&, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&&)>
+        }
+    171f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1723:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1727:	c9                   	leave
+    1728:	c3                   	ret
+    1729:	90                   	nop
+
+000000000000172a <nel::Iterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>, int&, int>::first_n(unsigned long)>:
+        constexpr FirstNIterator<ItT> first_n(Count const limit)
+    172a:	55                   	push   %rbp
+    172b:	48 89 e5             	mov    %rsp,%rbp
+    172e:	48 83 ec 20          	sub    $0x20,%rsp
+    1732:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1736:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    173a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            return FirstNIterator<ItT>(move(self()), limit);
+    173e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1742:	48 89 c7             	mov    %rax,%rdi
+    1745:	e8 e2 02 00 00       	call   1a2c <nel::Iterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>, int&, int>::self()>
+    174a:	48 89 c7             	mov    %rax,%rdi
+    174d:	e8 f0 02 00 00       	call   1a42 <nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&& nel::move<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >(nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&)>
+    1752:	48 89 c1             	mov    %rax,%rcx
+    1755:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1759:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    175d:	48 89 ce             	mov    %rcx,%rsi
+    1760:	48 89 c7             	mov    %rax,%rdi
+    1763:	e8 0e 03 00 00       	call   1a76 <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::FirstNIterator(nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&&, unsigned long)>
+        }
+    1768:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    176c:	c9                   	leave
+    176d:	c3                   	ret
+
+000000000000176e <nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(int)#1}::operator()(int) const>:
+            self().for_each([&acc, &fn](OutT v) { fn(acc, v); });
+    176e:	55                   	push   %rbp
+    176f:	48 89 e5             	mov    %rsp,%rbp
+    1772:	48 83 ec 10          	sub    $0x10,%rsp
+    1776:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    177a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    177d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1781:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1785:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1789:	48 8b 0a             	mov    (%rdx),%rcx
+    178c:	48 8d 55 f4          	lea    -0xc(%rbp),%rdx
+    1790:	48 89 ce             	mov    %rcx,%rsi
+    1793:	48 89 c7             	mov    %rax,%rdi
+    1796:	e8 73 fb ff ff       	call   130e <do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}::operator()(int&, int&) const>
+    179b:	90                   	nop
+    179c:	c9                   	leave
+    179d:	c3                   	ret
+
+000000000000179e <int nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)>:
+        U fold(U &&initial, F &&fn)
+    179e:	55                   	push   %rbp
+    179f:	48 89 e5             	mov    %rsp,%rbp
+    17a2:	48 83 ec 40          	sub    $0x40,%rsp
+    17a6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    17aa:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    17ae:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+            U acc = move(initial);
+    17b2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    17b6:	48 89 c7             	mov    %rax,%rdi
+    17b9:	e8 81 07 00 00       	call   1f3f <int&& nel::move<int>(int&)>
+    17be:	8b 00                	mov    (%rax),%eax
+    17c0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+            self().for_each([&acc, &fn](OutT v) { fn(acc, v); });
+    17c3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17c7:	48 89 c7             	mov    %rax,%rdi
+    17ca:	e8 f7 02 00 00       	call   1ac6 <nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::self()>
+    17cf:	48 89 c2             	mov    %rax,%rdx
+    17d2:	48 8d 45 ec          	lea    -0x14(%rbp),%rax
+    17d6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    17da:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    17de:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    17e2:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    17e6:	48 89 c6             	mov    %rax,%rsi
+    17e9:	48 89 d7             	mov    %rdx,%rdi
+    17ec:	e8 3d 03 00 00       	call   1b2e <void nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(int)#1}>(int&&)>
+            return acc;
+    17f1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+        }
+    17f4:	c9                   	leave
+    17f5:	c3                   	ret
+
+00000000000017f6 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<ex1()::{lambda(int&)#1}>(ex1()::{lambda(int&)#1}&&)>:
+        void for_each(F &&fn)
+    17f6:	       55                   	push   %rbp
+    17f7:	       48 89 e5             	mov    %rsp,%rbp
+    17fa:	       48 83 ec 10          	sub    $0x10,%rsp
+    17fe:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1802:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            for (; !self().is_done(); self().inc()) {
+    1806:	   /-- eb 3a                	jmp    1842 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<ex1()::{lambda(int&)#1}>(ex1()::{lambda(int&)#1}&&)+0x4c>
+                fn(self().deref());
+    1808:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    180c:	|  |   48 89 c7             	mov    %rax,%rdi
+    180f:	|  |   e8 b8 06 00 00       	call   1ecc <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1814:	|  |   48 89 c7             	mov    %rax,%rdi
+    1817:	|  |   e8 04 07 00 00       	call   1f20 <nel::SliceIterator<int>::deref()>
+    181c:	|  |   48 89 c2             	mov    %rax,%rdx
+    181f:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1823:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1826:	|  |   48 89 c7             	mov    %rax,%rdi
+    1829:	|  |   e8 7a fb ff ff       	call   13a8 <ex1()::{lambda(int&)#1}::operator()(int&) const>
+            for (; !self().is_done(); self().inc()) {
+    182e:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1832:	|  |   48 89 c7             	mov    %rax,%rdi
+    1835:	|  |   e8 92 06 00 00       	call   1ecc <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    183a:	|  |   48 89 c7             	mov    %rax,%rdi
+    183d:	|  |   e8 c0 06 00 00       	call   1f02 <nel::SliceIterator<int>::inc()>
+    1842:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1846:	|      48 89 c7             	mov    %rax,%rdi
+    1849:	|      e8 7e 06 00 00       	call   1ecc <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    184e:	|      48 89 c7             	mov    %rax,%rdi
+    1851:	|      e8 8c 06 00 00       	call   1ee2 <nel::SliceIterator<int>::is_done() const>
+    1856:	|      83 f0 01             	xor    $0x1,%eax
+    1859:	|      84 c0                	test   %al,%al
+    185b:	\----- 75 ab                	jne    1808 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<ex1()::{lambda(int&)#1}>(ex1()::{lambda(int&)#1}&&)+0x12>
+        }
+    185d:	       90                   	nop
+    185e:	       90                   	nop
+    185f:	       c9                   	leave
+    1860:	       c3                   	ret
+
+0000000000001861 <do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&& nel::forward<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel so to not need std.
+ */
+template<typename U, typename T>
+constexpr U &&forward(T &t)
+    1861:	55                   	push   %rbp
+    1862:	48 89 e5             	mov    %rsp,%rbp
+    1865:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<U &&>(t);
+    1869:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    186d:	5d                   	pop    %rbp
+    186e:	c3                   	ret
+    186f:	90                   	nop
+
+0000000000001870 <nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::MappingIterator(nel::SliceIterator<int>&&, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&&)>:
+        constexpr MappingIterator(It &&inner, FnT &&fn)
+    1870:	55                   	push   %rbp
+    1871:	48 89 e5             	mov    %rsp,%rbp
+    1874:	53                   	push   %rbx
+    1875:	48 83 ec 28          	sub    $0x28,%rsp
+    1879:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    187d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1881:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            : inner_(move(inner))
+    1885:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    1889:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    188d:	48 89 c7             	mov    %rax,%rdi
+    1890:	e8 9c 06 00 00       	call   1f31 <nel::SliceIterator<int>&& nel::move<nel::SliceIterator<int> >(nel::SliceIterator<int>&)>
+    1895:	48 89 c6             	mov    %rax,%rsi
+    1898:	48 89 df             	mov    %rbx,%rdi
+    189b:	e8 d2 07 00 00       	call   2072 <nel::SliceIterator<int>::SliceIterator(nel::SliceIterator<int>&&)>
+            , fn_(forward<FnT>(fn))
+    18a0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    18a4:	48 89 c7             	mov    %rax,%rdi
+    18a7:	e8 b5 ff ff ff       	call   1861 <do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&& nel::forward<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&)>
+        }
+    18ac:	90                   	nop
+    18ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    18b1:	c9                   	leave
+    18b2:	c3                   	ret
+    18b3:	90                   	nop
+
+00000000000018b4 <nel::Iterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>, int&, int>::self()>:
+        constexpr ItT &self(void)
+    18b4:	55                   	push   %rbp
+    18b5:	48 89 e5             	mov    %rsp,%rbp
+    18b8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    18bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18c0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    18c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    18c8:	5d                   	pop    %rbp
+    18c9:	c3                   	ret
+
+00000000000018ca <nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&& nel::move<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >(nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&)>:
+constexpr T &&move(T &v)
+    18ca:	55                   	push   %rbp
+    18cb:	48 89 e5             	mov    %rsp,%rbp
+    18ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    18d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    18d6:	5d                   	pop    %rbp
+    18d7:	c3                   	ret
+
+00000000000018d8 <nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::MappingIterator(nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&&)>:
+struct MappingIterator: public Iterator<MappingIterator<It, V, Fn>, typename It::InT, V>
+    18d8:	55                   	push   %rbp
+    18d9:	48 89 e5             	mov    %rsp,%rbp
+    18dc:	48 83 ec 10          	sub    $0x10,%rsp
+    18e0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    18e4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    18e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18ec:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    18f0:	48 89 d6             	mov    %rdx,%rsi
+    18f3:	48 89 c7             	mov    %rax,%rdi
+    18f6:	e8 77 07 00 00       	call   2072 <nel::SliceIterator<int>::SliceIterator(nel::SliceIterator<int>&&)>
+    18fb:	90                   	nop
+    18fc:	c9                   	leave
+    18fd:	c3                   	ret
+
+00000000000018fe <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::FirstNIterator(nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&&, unsigned long)>:
+        constexpr FirstNIterator(It &&inner, Length limit)
+    18fe:	55                   	push   %rbp
+    18ff:	48 89 e5             	mov    %rsp,%rbp
+    1902:	53                   	push   %rbx
+    1903:	48 83 ec 28          	sub    $0x28,%rsp
+    1907:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    190b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    190f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            : inner_(move(inner))
+    1913:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    1917:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    191b:	48 89 c7             	mov    %rax,%rdi
+    191e:	e8 a7 ff ff ff       	call   18ca <nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&& nel::move<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >(nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&)>
+    1923:	48 89 c6             	mov    %rax,%rsi
+    1926:	48 89 df             	mov    %rbx,%rdi
+    1929:	e8 aa ff ff ff       	call   18d8 <nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::MappingIterator(nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&&)>
+            , current_(0)
+    192e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1932:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+    1939:	00 
+            , limit_(limit)
+    193a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    193e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1942:	48 89 50 20          	mov    %rdx,0x20(%rax)
+        }
+    1946:	90                   	nop
+    1947:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    194b:	c9                   	leave
+    194c:	c3                   	ret
+    194d:	90                   	nop
+
+000000000000194e <nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}&&)::{lambda(bool&, int&)#1}::operator()(bool&, int&) const>:
+                acc, [this, &fn](U &a, typename It::OutT e) { return fn(a, fn_(e)); });
+    194e:	55                   	push   %rbp
+    194f:	48 89 e5             	mov    %rsp,%rbp
+    1952:	53                   	push   %rbx
+    1953:	48 83 ec 28          	sub    $0x28,%rsp
+    1957:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    195b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    195f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    1963:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1967:	48 8b 58 08          	mov    0x8(%rax),%rbx
+    196b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    196f:	48 8b 00             	mov    (%rax),%rax
+    1972:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    1976:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    197a:	48 89 c6             	mov    %rax,%rsi
+    197d:	48 89 d7             	mov    %rdx,%rdi
+    1980:	e8 d1 f8 ff ff       	call   1256 <do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}::operator()(int const&) const>
+    1985:	89 c2                	mov    %eax,%edx
+    1987:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    198b:	48 89 c6             	mov    %rax,%rsi
+    198e:	48 89 df             	mov    %rbx,%rdi
+    1991:	e8 92 fc ff ff       	call   1628 <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}::operator()(bool&, int) const>
+    1996:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    199a:	c9                   	leave
+    199b:	c3                   	ret
+
+000000000000199c <bool nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}&&)>:
+        bool try_fold(U &acc, F &&fn)
+    199c:	55                   	push   %rbp
+    199d:	48 89 e5             	mov    %rsp,%rbp
+    19a0:	48 83 ec 30          	sub    $0x30,%rsp
+    19a4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    19a8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    19ac:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            return inner_.try_fold(
+    19b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+                acc, [this, &fn](U &a, typename It::OutT e) { return fn(a, fn_(e)); });
+    19b4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    19b8:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    19bc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    19c0:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+            return inner_.try_fold(
+    19c4:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    19c8:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    19cc:	48 89 ce             	mov    %rcx,%rsi
+    19cf:	48 89 c7             	mov    %rax,%rdi
+    19d2:	e8 ad 01 00 00       	call   1b84 <bool nel::Iterator<nel::SliceIterator<int>, int&, int&>::try_fold<bool, nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}&&)::{lambda(bool&, int&)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}&&)>
+        }
+    19d7:	c9                   	leave
+    19d8:	c3                   	ret
+
+00000000000019d9 <do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&& nel::forward<do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>(do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&)>:
+constexpr U &&forward(T &t)
+    19d9:	55                   	push   %rbp
+    19da:	48 89 e5             	mov    %rsp,%rbp
+    19dd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    19e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    19e5:	5d                   	pop    %rbp
+    19e6:	c3                   	ret
+    19e7:	90                   	nop
+
+00000000000019e8 <nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::MappingIterator(nel::SliceIterator<int>&&, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&&)>:
+        constexpr MappingIterator(It &&inner, FnT &&fn)
+    19e8:	55                   	push   %rbp
+    19e9:	48 89 e5             	mov    %rsp,%rbp
+    19ec:	53                   	push   %rbx
+    19ed:	48 83 ec 28          	sub    $0x28,%rsp
+    19f1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    19f5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    19f9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            : inner_(move(inner))
+    19fd:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    1a01:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a05:	48 89 c7             	mov    %rax,%rdi
+    1a08:	e8 24 05 00 00       	call   1f31 <nel::SliceIterator<int>&& nel::move<nel::SliceIterator<int> >(nel::SliceIterator<int>&)>
+    1a0d:	48 89 c6             	mov    %rax,%rsi
+    1a10:	48 89 df             	mov    %rbx,%rdi
+    1a13:	e8 5a 06 00 00       	call   2072 <nel::SliceIterator<int>::SliceIterator(nel::SliceIterator<int>&&)>
+            , fn_(forward<FnT>(fn))
+    1a18:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1a1c:	48 89 c7             	mov    %rax,%rdi
+    1a1f:	e8 b5 ff ff ff       	call   19d9 <do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&& nel::forward<do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>(do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}&)>
+        }
+    1a24:	90                   	nop
+    1a25:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1a29:	c9                   	leave
+    1a2a:	c3                   	ret
+    1a2b:	90                   	nop
+
+0000000000001a2c <nel::Iterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>, int&, int>::self()>:
+        constexpr ItT &self(void)
+    1a2c:	55                   	push   %rbp
+    1a2d:	48 89 e5             	mov    %rsp,%rbp
+    1a30:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    1a34:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a38:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    1a3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1a40:	5d                   	pop    %rbp
+    1a41:	c3                   	ret
+
+0000000000001a42 <nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&& nel::move<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >(nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&)>:
+constexpr T &&move(T &v)
+    1a42:	55                   	push   %rbp
+    1a43:	48 89 e5             	mov    %rsp,%rbp
+    1a46:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    1a4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1a4e:	5d                   	pop    %rbp
+    1a4f:	c3                   	ret
+
+0000000000001a50 <nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::MappingIterator(nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&&)>:
+struct MappingIterator: public Iterator<MappingIterator<It, V, Fn>, typename It::InT, V>
+    1a50:	55                   	push   %rbp
+    1a51:	48 89 e5             	mov    %rsp,%rbp
+    1a54:	48 83 ec 10          	sub    $0x10,%rsp
+    1a58:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a5c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1a60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a64:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1a68:	48 89 d6             	mov    %rdx,%rsi
+    1a6b:	48 89 c7             	mov    %rax,%rdi
+    1a6e:	e8 ff 05 00 00       	call   2072 <nel::SliceIterator<int>::SliceIterator(nel::SliceIterator<int>&&)>
+    1a73:	90                   	nop
+    1a74:	c9                   	leave
+    1a75:	c3                   	ret
+
+0000000000001a76 <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::FirstNIterator(nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&&, unsigned long)>:
+        constexpr FirstNIterator(It &&inner, Length limit)
+    1a76:	55                   	push   %rbp
+    1a77:	48 89 e5             	mov    %rsp,%rbp
+    1a7a:	53                   	push   %rbx
+    1a7b:	48 83 ec 28          	sub    $0x28,%rsp
+    1a7f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1a83:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1a87:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            : inner_(move(inner))
+    1a8b:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    1a8f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a93:	48 89 c7             	mov    %rax,%rdi
+    1a96:	e8 a7 ff ff ff       	call   1a42 <nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&& nel::move<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >(nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&)>
+    1a9b:	48 89 c6             	mov    %rax,%rsi
+    1a9e:	48 89 df             	mov    %rbx,%rdi
+    1aa1:	e8 aa ff ff ff       	call   1a50 <nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::MappingIterator(nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>&&)>
+            , current_(0)
+    1aa6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1aaa:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+    1ab1:	00 
+            , limit_(limit)
+    1ab2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ab6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1aba:	48 89 50 20          	mov    %rdx,0x20(%rax)
+        }
+    1abe:	90                   	nop
+    1abf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1ac3:	c9                   	leave
+    1ac4:	c3                   	ret
+    1ac5:	90                   	nop
+
+0000000000001ac6 <nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::self()>:
+        constexpr ItT &self(void)
+    1ac6:	55                   	push   %rbp
+    1ac7:	48 89 e5             	mov    %rsp,%rbp
+    1aca:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    1ace:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ad2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    1ad6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1ada:	5d                   	pop    %rbp
+    1adb:	c3                   	ret
+
+0000000000001adc <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(int)#1}>(int&&)::{lambda(bool&, int)#1}::operator()(bool&, int) const>:
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    1adc:	55                   	push   %rbp
+    1add:	48 89 e5             	mov    %rsp,%rbp
+    1ae0:	48 83 ec 18          	sub    $0x18,%rsp
+    1ae4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1ae8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1aec:	89 55 ec             	mov    %edx,-0x14(%rbp)
+    1aef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1af3:	48 8b 40 08          	mov    0x8(%rax),%rax
+                fn(e);
+    1af7:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1afa:	89 d6                	mov    %edx,%esi
+    1afc:	48 89 c7             	mov    %rax,%rdi
+    1aff:	e8 6a fc ff ff       	call   176e <nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(int)#1}::operator()(int) const>
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    1b04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b08:	48 8b 00             	mov    (%rax),%rax
+                return ++current_ < limit_;
+    1b0b:	48 8b 50 18          	mov    0x18(%rax),%rdx
+    1b0f:	48 83 c2 01          	add    $0x1,%rdx
+    1b13:	48 89 50 18          	mov    %rdx,0x18(%rax)
+    1b17:	48 8b 50 18          	mov    0x18(%rax),%rdx
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    1b1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b1f:	48 8b 00             	mov    (%rax),%rax
+                return ++current_ < limit_;
+    1b22:	48 8b 40 20          	mov    0x20(%rax),%rax
+    1b26:	48 39 c2             	cmp    %rax,%rdx
+    1b29:	0f 92 c0             	setb   %al
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    1b2c:	c9                   	leave
+    1b2d:	c3                   	ret
+
+0000000000001b2e <void nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(int)#1}>(int&&)>:
+        void for_each(F &&fn)
+    1b2e:	       55                   	push   %rbp
+    1b2f:	       48 89 e5             	mov    %rsp,%rbp
+    1b32:	       48 83 ec 30          	sub    $0x30,%rsp
+    1b36:	       48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1b3a:	       48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+            if (current_ >= limit_) { return; }
+    1b3e:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1b42:	       48 8b 50 18          	mov    0x18(%rax),%rdx
+    1b46:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1b4a:	       48 8b 40 20          	mov    0x20(%rax),%rax
+    1b4e:	       48 39 c2             	cmp    %rax,%rdx
+    1b51:	/----- 73 2d                	jae    1b80 <void nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(int)#1}>(int&&)+0x52>
+            bool unused = true;
+    1b53:	|      c6 45 ef 01          	movb   $0x1,-0x11(%rbp)
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    1b57:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1b5b:	|      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1b5f:	|      48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    1b63:	|      48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1b67:	|      48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    1b6b:	|      48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    1b6f:	|      48 8d 4d ef          	lea    -0x11(%rbp),%rcx
+    1b73:	|      48 89 ce             	mov    %rcx,%rsi
+    1b76:	|      48 89 c7             	mov    %rax,%rdi
+    1b79:	|      e8 e8 00 00 00       	call   1c66 <bool nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(int)#1}>(int&&)::{lambda(bool&, int)#1}>(int&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)>
+    1b7e:	|  /-- eb 01                	jmp    1b81 <void nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(int)#1}>(int&&)+0x53>
+            if (current_ >= limit_) { return; }
+    1b80:	\--|-> 90                   	nop
+        }
+    1b81:	   \-> c9                   	leave
+    1b82:	       c3                   	ret
+    1b83:	       90                   	nop
+
+0000000000001b84 <bool nel::Iterator<nel::SliceIterator<int>, int&, int&>::try_fold<bool, nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}&&)::{lambda(bool&, int&)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}&&)>:
+        bool try_fold(U &acc, F &&fn)
+    1b84:	          55                   	push   %rbp
+    1b85:	          48 89 e5             	mov    %rsp,%rbp
+    1b88:	          48 83 ec 30          	sub    $0x30,%rsp
+    1b8c:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1b90:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1b94:	          48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            while (!self().is_done()) {
+    1b98:	   /----- eb 5c                	jmp    1bf6 <bool nel::Iterator<nel::SliceIterator<int>, int&, int&>::try_fold<bool, nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}&&)::{lambda(bool&, int&)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}&&)+0x72>
+                OutT e = self().deref();
+    1b9a:	/--|----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b9e:	|  |      48 89 c7             	mov    %rax,%rdi
+    1ba1:	|  |      e8 26 03 00 00       	call   1ecc <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1ba6:	|  |      48 89 c7             	mov    %rax,%rdi
+    1ba9:	|  |      e8 72 03 00 00       	call   1f20 <nel::SliceIterator<int>::deref()>
+    1bae:	|  |      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                self().inc();
+    1bb2:	|  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bb6:	|  |      48 89 c7             	mov    %rax,%rdi
+    1bb9:	|  |      e8 0e 03 00 00       	call   1ecc <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1bbe:	|  |      48 89 c7             	mov    %rax,%rdi
+    1bc1:	|  |      e8 3c 03 00 00       	call   1f02 <nel::SliceIterator<int>::inc()>
+                if (!fn(acc, forward<OutT>(e))) { return false; }
+    1bc6:	|  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bca:	|  |      48 89 c7             	mov    %rax,%rdi
+    1bcd:	|  |      e8 28 05 00 00       	call   20fa <int& nel::forward<int&, int>(int&)>
+    1bd2:	|  |      48 89 c2             	mov    %rax,%rdx
+    1bd5:	|  |      48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1bd9:	|  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1bdd:	|  |      48 89 ce             	mov    %rcx,%rsi
+    1be0:	|  |      48 89 c7             	mov    %rax,%rdi
+    1be3:	|  |      e8 66 fd ff ff       	call   194e <nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}&&)::{lambda(bool&, int&)#1}::operator()(bool&, int&) const>
+    1be8:	|  |      83 f0 01             	xor    $0x1,%eax
+    1beb:	|  |      84 c0                	test   %al,%al
+    1bed:	|  +----- 74 07                	je     1bf6 <bool nel::Iterator<nel::SliceIterator<int>, int&, int&>::try_fold<bool, nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}&&)::{lambda(bool&, int&)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}&&)+0x72>
+    1bef:	|  |      b8 00 00 00 00       	mov    $0x0,%eax
+    1bf4:	|  |  /-- eb 20                	jmp    1c16 <bool nel::Iterator<nel::SliceIterator<int>, int&, int&>::try_fold<bool, nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}&&)::{lambda(bool&, int&)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}&&)+0x92>
+            while (!self().is_done()) {
+    1bf6:	|  \--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bfa:	|     |   48 89 c7             	mov    %rax,%rdi
+    1bfd:	|     |   e8 ca 02 00 00       	call   1ecc <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1c02:	|     |   48 89 c7             	mov    %rax,%rdi
+    1c05:	|     |   e8 d8 02 00 00       	call   1ee2 <nel::SliceIterator<int>::is_done() const>
+    1c0a:	|     |   83 f0 01             	xor    $0x1,%eax
+    1c0d:	|     |   84 c0                	test   %al,%al
+    1c0f:	\-----|-- 75 89                	jne    1b9a <bool nel::Iterator<nel::SliceIterator<int>, int&, int&>::try_fold<bool, nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}&&)::{lambda(bool&, int&)#1}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do3(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}>(do3(nel::SliceIterator<int>&&)::{lambda(int const&)#2}&&)::{lambda(bool&, int)#1}&&)+0x16>
+            return true;
+    1c11:	      |   b8 01 00 00 00       	mov    $0x1,%eax
+        }
+    1c16:	      \-> c9                   	leave
+    1c17:	          c3                   	ret
+
+0000000000001c18 <nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(int)#1}>(int&&)::{lambda(bool&, int)#1}>(int&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(bool&, int&)#1}::operator()(bool&, int&) const>:
+                acc, [this, &fn](U &a, typename It::OutT e) { return fn(a, fn_(e)); });
+    1c18:	55                   	push   %rbp
+    1c19:	48 89 e5             	mov    %rsp,%rbp
+    1c1c:	53                   	push   %rbx
+    1c1d:	48 83 ec 18          	sub    $0x18,%rsp
+    1c21:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+    1c25:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+    1c29:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    1c2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c31:	48 8b 58 08          	mov    0x8(%rax),%rbx
+    1c35:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c39:	48 8b 00             	mov    (%rax),%rax
+    1c3c:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    1c40:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c44:	48 89 c6             	mov    %rax,%rsi
+    1c47:	48 89 d7             	mov    %rdx,%rdi
+    1c4a:	e8 a7 f6 ff ff       	call   12f6 <do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}::operator()(int const&) const>
+    1c4f:	89 c2                	mov    %eax,%edx
+    1c51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c55:	48 89 c6             	mov    %rax,%rsi
+    1c58:	48 89 df             	mov    %rbx,%rdi
+    1c5b:	e8 7c fe ff ff       	call   1adc <nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(int)#1}>(int&&)::{lambda(bool&, int)#1}::operator()(bool&, int) const>
+    1c60:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1c64:	c9                   	leave
+    1c65:	c3                   	ret
+
+0000000000001c66 <bool nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(int)#1}>(int&&)::{lambda(bool&, int)#1}>(int&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)>:
+        bool try_fold(U &acc, F &&fn)
+    1c66:	55                   	push   %rbp
+    1c67:	48 89 e5             	mov    %rsp,%rbp
+    1c6a:	48 83 ec 30          	sub    $0x30,%rsp
+    1c6e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1c72:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1c76:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            return inner_.try_fold(
+    1c7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+                acc, [this, &fn](U &a, typename It::OutT e) { return fn(a, fn_(e)); });
+    1c7e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1c82:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    1c86:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1c8a:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+            return inner_.try_fold(
+    1c8e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    1c92:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1c96:	48 89 ce             	mov    %rcx,%rsi
+    1c99:	48 89 c7             	mov    %rax,%rdi
+    1c9c:	e8 03 00 00 00       	call   1ca4 <bool nel::Iterator<nel::SliceIterator<int>, int&, int&>::try_fold<bool, nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(int)#1}>(int&&)::{lambda(bool&, int)#1}>(int&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(bool&, int&)#1}>(int&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)>
+        }
+    1ca1:	c9                   	leave
+    1ca2:	c3                   	ret
+    1ca3:	90                   	nop
+
+0000000000001ca4 <bool nel::Iterator<nel::SliceIterator<int>, int&, int&>::try_fold<bool, nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(int)#1}>(int&&)::{lambda(bool&, int)#1}>(int&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(bool&, int&)#1}>(int&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)>:
+        bool try_fold(U &acc, F &&fn)
+    1ca4:	          55                   	push   %rbp
+    1ca5:	          48 89 e5             	mov    %rsp,%rbp
+    1ca8:	          48 83 ec 30          	sub    $0x30,%rsp
+    1cac:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1cb0:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1cb4:	          48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            while (!self().is_done()) {
+    1cb8:	   /----- eb 5c                	jmp    1d16 <bool nel::Iterator<nel::SliceIterator<int>, int&, int&>::try_fold<bool, nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(int)#1}>(int&&)::{lambda(bool&, int)#1}>(int&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(bool&, int&)#1}>(int&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)+0x72>
+                OutT e = self().deref();
+    1cba:	/--|----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cbe:	|  |      48 89 c7             	mov    %rax,%rdi
+    1cc1:	|  |      e8 06 02 00 00       	call   1ecc <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1cc6:	|  |      48 89 c7             	mov    %rax,%rdi
+    1cc9:	|  |      e8 52 02 00 00       	call   1f20 <nel::SliceIterator<int>::deref()>
+    1cce:	|  |      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                self().inc();
+    1cd2:	|  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cd6:	|  |      48 89 c7             	mov    %rax,%rdi
+    1cd9:	|  |      e8 ee 01 00 00       	call   1ecc <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1cde:	|  |      48 89 c7             	mov    %rax,%rdi
+    1ce1:	|  |      e8 1c 02 00 00       	call   1f02 <nel::SliceIterator<int>::inc()>
+                if (!fn(acc, forward<OutT>(e))) { return false; }
+    1ce6:	|  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cea:	|  |      48 89 c7             	mov    %rax,%rdi
+    1ced:	|  |      e8 08 04 00 00       	call   20fa <int& nel::forward<int&, int>(int&)>
+    1cf2:	|  |      48 89 c2             	mov    %rax,%rdx
+    1cf5:	|  |      48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1cf9:	|  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1cfd:	|  |      48 89 ce             	mov    %rcx,%rsi
+    1d00:	|  |      48 89 c7             	mov    %rax,%rdi
+    1d03:	|  |      e8 10 ff ff ff       	call   1c18 <nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(int)#1}>(int&&)::{lambda(bool&, int)#1}>(int&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(bool&, int&)#1}::operator()(bool&, int&) const>
+    1d08:	|  |      83 f0 01             	xor    $0x1,%eax
+    1d0b:	|  |      84 c0                	test   %al,%al
+    1d0d:	|  +----- 74 07                	je     1d16 <bool nel::Iterator<nel::SliceIterator<int>, int&, int&>::try_fold<bool, nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(int)#1}>(int&&)::{lambda(bool&, int)#1}>(int&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(bool&, int&)#1}>(int&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)+0x72>
+    1d0f:	|  |      b8 00 00 00 00       	mov    $0x0,%eax
+    1d14:	|  |  /-- eb 20                	jmp    1d36 <bool nel::Iterator<nel::SliceIterator<int>, int&, int&>::try_fold<bool, nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(int)#1}>(int&&)::{lambda(bool&, int)#1}>(int&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(bool&, int&)#1}>(int&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)+0x92>
+            while (!self().is_done()) {
+    1d16:	|  \--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d1a:	|     |   48 89 c7             	mov    %rax,%rdi
+    1d1d:	|     |   e8 aa 01 00 00       	call   1ecc <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1d22:	|     |   48 89 c7             	mov    %rax,%rdi
+    1d25:	|     |   e8 b8 01 00 00       	call   1ee2 <nel::SliceIterator<int>::is_done() const>
+    1d2a:	|     |   83 f0 01             	xor    $0x1,%eax
+    1d2d:	|     |   84 c0                	test   %al,%al
+    1d2f:	\-----|-- 75 89                	jne    1cba <bool nel::Iterator<nel::SliceIterator<int>, int&, int&>::try_fold<bool, nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}>::try_fold<bool, nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >::for_each<nel::Iterator<nel::FirstNIterator<nel::MappingIterator<nel::SliceIterator<int>, int, do5(nel::SliceIterator<int>&&)::{lambda(int const&)#1}> >, int&, int>::fold<int, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}>(int&&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(int)#1}>(int&&)::{lambda(bool&, int)#1}>(int&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)::{lambda(bool&, int&)#1}>(int&, do5(nel::SliceIterator<int>&&)::{lambda(int&, int&)#2}&&)+0x16>
+            return true;
+    1d31:	      |   b8 01 00 00 00       	mov    $0x1,%eax
+        }
+    1d36:	      \-> c9                   	leave
+    1d37:	          c3                   	ret
+
+0000000000001d38 <nel::Manual<int [1000]>::Manual()>:
+        // doesn't know if value contained or not.
+        constexpr ~Manual() = default;
+
+        // create empty container
+        // union should prevent ctor call of T.
+        constexpr Manual() = default;
+    1d38:	55                   	push   %rbp
+    1d39:	48 89 e5             	mov    %rsp,%rbp
+    1d3c:	48 83 ec 10          	sub    $0x10,%rsp
+    1d40:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1d44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d48:	48 89 c7             	mov    %rax,%rdi
+    1d4b:	e8 4a 00 00 00       	call   1d9a <nel::Manual<int [1000]>::U::U()>
+    1d50:	90                   	nop
+    1d51:	c9                   	leave
+    1d52:	c3                   	ret
+    1d53:	90                   	nop
+
+0000000000001d54 <nel::Manual<int [1000]>::~Manual()>:
+        constexpr ~Manual() = default;
+    1d54:	55                   	push   %rbp
+    1d55:	48 89 e5             	mov    %rsp,%rbp
+    1d58:	48 83 ec 10          	sub    $0x10,%rsp
+    1d5c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1d60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d64:	48 89 c7             	mov    %rax,%rdi
+    1d67:	e8 bc 00 00 00       	call   1e28 <nel::Manual<int [1000]>::U::~U()>
+    1d6c:	90                   	nop
+    1d6d:	c9                   	leave
+    1d6e:	c3                   	ret
+    1d6f:	90                   	nop
+
+0000000000001d70 <nel::heapless::Vector<int, 1000ul>::Vector()>:
+        }
+
+        // default ctor is safe, will always succeed.
+        // and is fast.
+        // if sizeof(T) or N is large will just eat ram.
+        constexpr Vector(void)
+    1d70:	55                   	push   %rbp
+    1d71:	48 89 e5             	mov    %rsp,%rbp
+    1d74:	48 83 ec 10          	sub    $0x10,%rsp
+    1d78:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : len_(0)
+    1d7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d80:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+    1d87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d8b:	48 83 c0 08          	add    $0x8,%rax
+    1d8f:	48 89 c7             	mov    %rax,%rdi
+    1d92:	e8 a1 ff ff ff       	call   1d38 <nel::Manual<int [1000]>::Manual()>
+        {
+        }
+    1d97:	90                   	nop
+    1d98:	c9                   	leave
+    1d99:	c3                   	ret
+
+0000000000001d9a <nel::Manual<int [1000]>::U::U()>:
+                constexpr U() {};
+    1d9a:	55                   	push   %rbp
+    1d9b:	48 89 e5             	mov    %rsp,%rbp
+    1d9e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1da2:	90                   	nop
+    1da3:	5d                   	pop    %rbp
+    1da4:	c3                   	ret
+    1da5:	90                   	nop
+
+0000000000001da6 <nel::heapless::Vector<int, 1000ul>::iter()>:
+         *
+         * iterator is invalidated if array goes out of scope/destroyed.
+         *
+         * @returns The iterator.
+         */
+        constexpr auto iter(void)
+    1da6:	55                   	push   %rbp
+    1da7:	48 89 e5             	mov    %rsp,%rbp
+    1daa:	48 83 ec 20          	sub    $0x20,%rsp
+    1dae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1db2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            return slice().iter();
+    1db6:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1dba:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1dbe:	48 89 d6             	mov    %rdx,%rsi
+    1dc1:	48 89 c7             	mov    %rax,%rdi
+    1dc4:	e8 6b 00 00 00       	call   1e34 <nel::heapless::Vector<int, 1000ul>::slice()>
+    1dc9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1dcd:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    1dd1:	48 89 d6             	mov    %rdx,%rsi
+    1dd4:	48 89 c7             	mov    %rax,%rdi
+    1dd7:	e8 a4 00 00 00       	call   1e80 <nel::Slice<int>::iter() const>
+        }
+    1ddc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1de0:	c9                   	leave
+    1de1:	c3                   	ret
+
+0000000000001de2 <nel::heapless::Vector<int, 1000ul>::~Vector()>:
+        constexpr ~Vector(void)
+    1de2:	55                   	push   %rbp
+    1de3:	48 89 e5             	mov    %rsp,%rbp
+    1de6:	48 83 ec 30          	sub    $0x30,%rsp
+    1dea:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+            iter().for_each([&](auto &v) -> void { v.~Type(); });
+    1dee:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1df2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1df6:	48 89 d6             	mov    %rdx,%rsi
+    1df9:	48 89 c7             	mov    %rax,%rdi
+    1dfc:	e8 a5 ff ff ff       	call   1da6 <nel::heapless::Vector<int, 1000ul>::iter()>
+    1e01:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    1e05:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1e09:	48 89 d6             	mov    %rdx,%rsi
+    1e0c:	48 89 c7             	mov    %rax,%rdi
+    1e0f:	e8 3a 01 00 00       	call   1f4e <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<nel::heapless::Vector<int, 1000ul>::~Vector()::{lambda(auto:1&)#1}>(nel::heapless::Vector<int, 1000ul>::~Vector()::{lambda(auto:1&)#1}&&)>
+        }
+    1e14:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1e18:	48 83 c0 08          	add    $0x8,%rax
+    1e1c:	48 89 c7             	mov    %rax,%rdi
+    1e1f:	e8 30 ff ff ff       	call   1d54 <nel::Manual<int [1000]>::~Manual()>
+    1e24:	90                   	nop
+    1e25:	c9                   	leave
+    1e26:	c3                   	ret
+    1e27:	90                   	nop
+
+0000000000001e28 <nel::Manual<int [1000]>::U::~U()>:
+                constexpr ~U() {};
+    1e28:	55                   	push   %rbp
+    1e29:	48 89 e5             	mov    %rsp,%rbp
+    1e2c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1e30:	90                   	nop
+    1e31:	5d                   	pop    %rbp
+    1e32:	c3                   	ret
+    1e33:	90                   	nop
+
+0000000000001e34 <nel::heapless::Vector<int, 1000ul>::slice()>:
+        constexpr Slice<Type> slice(void)
+    1e34:	55                   	push   %rbp
+    1e35:	48 89 e5             	mov    %rsp,%rbp
+    1e38:	53                   	push   %rbx
+    1e39:	48 83 ec 18          	sub    $0x18,%rsp
+    1e3d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1e41:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return Slice(ptr(), len());
+    1e45:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e49:	48 89 c7             	mov    %rax,%rdi
+    1e4c:	e8 87 01 00 00       	call   1fd8 <nel::heapless::Vector<int, 1000ul>::len() const>
+    1e51:	48 89 c3             	mov    %rax,%rbx
+    1e54:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e58:	48 89 c7             	mov    %rax,%rdi
+    1e5b:	e8 5a 01 00 00       	call   1fba <nel::heapless::Vector<int, 1000ul>::ptr()>
+    1e60:	48 89 c1             	mov    %rax,%rcx
+    1e63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e67:	48 89 da             	mov    %rbx,%rdx
+    1e6a:	48 89 ce             	mov    %rcx,%rsi
+    1e6d:	48 89 c7             	mov    %rax,%rdi
+    1e70:	e8 75 01 00 00       	call   1fea <nel::Slice<int>::Slice(int*, unsigned long)>
+        }
+    1e75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e79:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1e7d:	c9                   	leave
+    1e7e:	c3                   	ret
+    1e7f:	90                   	nop
+
+0000000000001e80 <nel::Slice<int>::iter() const>:
+         *
+         * The iterator is invalidated if the slice goes out of scope/destroyed.
+         */
+        typedef SliceIterator<Type> Iterator;
+
+        constexpr Iterator iter(void) const
+    1e80:	55                   	push   %rbp
+    1e81:	48 89 e5             	mov    %rsp,%rbp
+    1e84:	53                   	push   %rbx
+    1e85:	48 83 ec 18          	sub    $0x18,%rsp
+    1e89:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1e8d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            return Iterator(ptr(), len());
+    1e91:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e95:	48 89 c7             	mov    %rax,%rdi
+    1e98:	e8 89 01 00 00       	call   2026 <nel::Slice<int>::len() const>
+    1e9d:	48 89 c3             	mov    %rax,%rbx
+    1ea0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ea4:	48 89 c7             	mov    %rax,%rdi
+    1ea7:	e8 68 01 00 00       	call   2014 <nel::Slice<int>::ptr() const>
+    1eac:	48 89 c1             	mov    %rax,%rcx
+    1eaf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1eb3:	48 89 da             	mov    %rbx,%rdx
+    1eb6:	48 89 ce             	mov    %rcx,%rsi
+    1eb9:	48 89 c7             	mov    %rax,%rdi
+    1ebc:	e8 77 01 00 00       	call   2038 <nel::SliceIterator<int>::SliceIterator(int*, unsigned long)>
+        }
+    1ec1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ec5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1ec9:	c9                   	leave
+    1eca:	c3                   	ret
+    1ecb:	90                   	nop
+
+0000000000001ecc <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>:
+        constexpr ItT &self(void)
+    1ecc:	55                   	push   %rbp
+    1ecd:	48 89 e5             	mov    %rsp,%rbp
+    1ed0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    1ed4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ed8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    1edc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1ee0:	5d                   	pop    %rbp
+    1ee1:	c3                   	ret
+
+0000000000001ee2 <nel::SliceIterator<int>::is_done() const>:
+        }
+#    endif
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+    1ee2:	55                   	push   %rbp
+    1ee3:	48 89 e5             	mov    %rsp,%rbp
+    1ee6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return (b_ == e_);
+    1eea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1eee:	48 8b 10             	mov    (%rax),%rdx
+    1ef1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ef5:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1ef9:	48 39 c2             	cmp    %rax,%rdx
+    1efc:	0f 94 c0             	sete   %al
+        }
+    1eff:	5d                   	pop    %rbp
+    1f00:	c3                   	ret
+    1f01:	90                   	nop
+
+0000000000001f02 <nel::SliceIterator<int>::inc()>:
+
+        void inc(void)
+    1f02:	55                   	push   %rbp
+    1f03:	48 89 e5             	mov    %rsp,%rbp
+    1f06:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            ++b_;
+    1f0a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f0e:	48 8b 00             	mov    (%rax),%rax
+    1f11:	48 8d 50 04          	lea    0x4(%rax),%rdx
+    1f15:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f19:	48 89 10             	mov    %rdx,(%rax)
+        }
+    1f1c:	90                   	nop
+    1f1d:	5d                   	pop    %rbp
+    1f1e:	c3                   	ret
+    1f1f:	90                   	nop
+
+0000000000001f20 <nel::SliceIterator<int>::deref()>:
+
+        OutT deref(void)
+    1f20:	55                   	push   %rbp
+    1f21:	48 89 e5             	mov    %rsp,%rbp
+    1f24:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return *b_;
+    1f28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f2c:	48 8b 00             	mov    (%rax),%rax
+        }
+    1f2f:	5d                   	pop    %rbp
+    1f30:	c3                   	ret
+
+0000000000001f31 <nel::SliceIterator<int>&& nel::move<nel::SliceIterator<int> >(nel::SliceIterator<int>&)>:
+constexpr T &&move(T &v)
+    1f31:	55                   	push   %rbp
+    1f32:	48 89 e5             	mov    %rsp,%rbp
+    1f35:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    1f39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1f3d:	5d                   	pop    %rbp
+    1f3e:	c3                   	ret
+
+0000000000001f3f <int&& nel::move<int>(int&)>:
+constexpr T &&move(T &v)
+    1f3f:	55                   	push   %rbp
+    1f40:	48 89 e5             	mov    %rsp,%rbp
+    1f43:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    1f47:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1f4b:	5d                   	pop    %rbp
+    1f4c:	c3                   	ret
+    1f4d:	90                   	nop
+
+0000000000001f4e <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<nel::heapless::Vector<int, 1000ul>::~Vector()::{lambda(auto:1&)#1}>(nel::heapless::Vector<int, 1000ul>::~Vector()::{lambda(auto:1&)#1}&&)>:
+        void for_each(F &&fn)
+    1f4e:	       55                   	push   %rbp
+    1f4f:	       48 89 e5             	mov    %rsp,%rbp
+    1f52:	       48 83 ec 10          	sub    $0x10,%rsp
+    1f56:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f5a:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            for (; !self().is_done(); self().inc()) {
+    1f5e:	   /-- eb 3a                	jmp    1f9a <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<nel::heapless::Vector<int, 1000ul>::~Vector()::{lambda(auto:1&)#1}>(nel::heapless::Vector<int, 1000ul>::~Vector()::{lambda(auto:1&)#1}&&)+0x4c>
+                fn(self().deref());
+    1f60:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f64:	|  |   48 89 c7             	mov    %rax,%rdi
+    1f67:	|  |   e8 60 ff ff ff       	call   1ecc <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1f6c:	|  |   48 89 c7             	mov    %rax,%rdi
+    1f6f:	|  |   e8 ac ff ff ff       	call   1f20 <nel::SliceIterator<int>::deref()>
+    1f74:	|  |   48 89 c2             	mov    %rax,%rdx
+    1f77:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f7b:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1f7e:	|  |   48 89 c7             	mov    %rax,%rdi
+    1f81:	|  |   e8 48 01 00 00       	call   20ce <void nel::heapless::Vector<int, 1000ul>::~Vector()::{lambda(auto:1&)#1}::operator()<int>(int&) const>
+            for (; !self().is_done(); self().inc()) {
+    1f86:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f8a:	|  |   48 89 c7             	mov    %rax,%rdi
+    1f8d:	|  |   e8 3a ff ff ff       	call   1ecc <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1f92:	|  |   48 89 c7             	mov    %rax,%rdi
+    1f95:	|  |   e8 68 ff ff ff       	call   1f02 <nel::SliceIterator<int>::inc()>
+    1f9a:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f9e:	|      48 89 c7             	mov    %rax,%rdi
+    1fa1:	|      e8 26 ff ff ff       	call   1ecc <nel::Iterator<nel::SliceIterator<int>, int&, int&>::self()>
+    1fa6:	|      48 89 c7             	mov    %rax,%rdi
+    1fa9:	|      e8 34 ff ff ff       	call   1ee2 <nel::SliceIterator<int>::is_done() const>
+    1fae:	|      83 f0 01             	xor    $0x1,%eax
+    1fb1:	|      84 c0                	test   %al,%al
+    1fb3:	\----- 75 ab                	jne    1f60 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<nel::heapless::Vector<int, 1000ul>::~Vector()::{lambda(auto:1&)#1}>(nel::heapless::Vector<int, 1000ul>::~Vector()::{lambda(auto:1&)#1}&&)+0x12>
+        }
+    1fb5:	       90                   	nop
+    1fb6:	       90                   	nop
+    1fb7:	       c9                   	leave
+    1fb8:	       c3                   	ret
+    1fb9:	       90                   	nop
+
+0000000000001fba <nel::heapless::Vector<int, 1000ul>::ptr()>:
+        constexpr Type *ptr()
+    1fba:	55                   	push   %rbp
+    1fbb:	48 89 e5             	mov    %rsp,%rbp
+    1fbe:	48 83 ec 10          	sub    $0x10,%rsp
+    1fc2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return elems_.ptr()[0];
+    1fc6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fca:	48 83 c0 08          	add    $0x8,%rax
+    1fce:	48 89 c7             	mov    %rax,%rdi
+    1fd1:	e8 08 01 00 00       	call   20de <nel::Manual<int [1000]>::ptr()>
+        }
+    1fd6:	c9                   	leave
+    1fd7:	c3                   	ret
+
+0000000000001fd8 <nel::heapless::Vector<int, 1000ul>::len() const>:
+        constexpr Length len(void) const
+    1fd8:	55                   	push   %rbp
+    1fd9:	48 89 e5             	mov    %rsp,%rbp
+    1fdc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    1fe0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fe4:	48 8b 00             	mov    (%rax),%rax
+        }
+    1fe7:	5d                   	pop    %rbp
+    1fe8:	c3                   	ret
+    1fe9:	90                   	nop
+
+0000000000001fea <nel::Slice<int>::Slice(int*, unsigned long)>:
+        constexpr Slice(Type *const p, Length len)
+    1fea:	55                   	push   %rbp
+    1feb:	48 89 e5             	mov    %rsp,%rbp
+    1fee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1ff2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1ff6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : content_(p)
+    1ffa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ffe:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2002:	48 89 10             	mov    %rdx,(%rax)
+            , len_(len)
+    2005:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2009:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    200d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    2011:	90                   	nop
+    2012:	5d                   	pop    %rbp
+    2013:	c3                   	ret
+
+0000000000002014 <nel::Slice<int>::ptr() const>:
+        constexpr Type *ptr(void) const
+    2014:	55                   	push   %rbp
+    2015:	48 89 e5             	mov    %rsp,%rbp
+    2018:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return content_;
+    201c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2020:	48 8b 00             	mov    (%rax),%rax
+        }
+    2023:	5d                   	pop    %rbp
+    2024:	c3                   	ret
+    2025:	90                   	nop
+
+0000000000002026 <nel::Slice<int>::len() const>:
+        constexpr Length len(void) const
+    2026:	55                   	push   %rbp
+    2027:	48 89 e5             	mov    %rsp,%rbp
+    202a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    202e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2032:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    2036:	5d                   	pop    %rbp
+    2037:	c3                   	ret
+
+0000000000002038 <nel::SliceIterator<int>::SliceIterator(int*, unsigned long)>:
+        constexpr SliceIterator(T arr[], Count len)
+    2038:	55                   	push   %rbp
+    2039:	48 89 e5             	mov    %rsp,%rbp
+    203c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2040:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2044:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : b_(arr)
+    2048:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    204c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2050:	48 89 10             	mov    %rdx,(%rax)
+            , e_(arr + len)
+    2053:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2057:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    205e:	00 
+    205f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2063:	48 01 c2             	add    %rax,%rdx
+    2066:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    206a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    206e:	90                   	nop
+    206f:	5d                   	pop    %rbp
+    2070:	c3                   	ret
+    2071:	90                   	nop
+
+0000000000002072 <nel::SliceIterator<int>::SliceIterator(nel::SliceIterator<int>&&)>:
+        SliceIterator(SliceIterator &&o)
+    2072:	55                   	push   %rbp
+    2073:	48 89 e5             	mov    %rsp,%rbp
+    2076:	48 83 ec 10          	sub    $0x10,%rsp
+    207a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    207e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : b_(move(o.b_))
+    2082:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2086:	48 89 c7             	mov    %rax,%rdi
+    2089:	e8 5e 00 00 00       	call   20ec <int*&& nel::move<int*>(int*&)>
+    208e:	48 8b 10             	mov    (%rax),%rdx
+    2091:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2095:	48 89 10             	mov    %rdx,(%rax)
+            , e_(move(o.e_))
+    2098:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    209c:	48 83 c0 08          	add    $0x8,%rax
+    20a0:	48 89 c7             	mov    %rax,%rdi
+    20a3:	e8 44 00 00 00       	call   20ec <int*&& nel::move<int*>(int*&)>
+    20a8:	48 8b 10             	mov    (%rax),%rdx
+    20ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20af:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            o.b_ = nullptr;
+    20b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20b7:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+            o.e_ = nullptr;
+    20be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20c2:	48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    20c9:	00 
+        }
+    20ca:	90                   	nop
+    20cb:	c9                   	leave
+    20cc:	c3                   	ret
+    20cd:	90                   	nop
+
+00000000000020ce <void nel::heapless::Vector<int, 1000ul>::~Vector()::{lambda(auto:1&)#1}::operator()<int>(int&) const>:
+            iter().for_each([&](auto &v) -> void { v.~Type(); });
+    20ce:	55                   	push   %rbp
+    20cf:	48 89 e5             	mov    %rsp,%rbp
+    20d2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    20d6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    20da:	90                   	nop
+    20db:	5d                   	pop    %rbp
+    20dc:	c3                   	ret
+    20dd:	90                   	nop
+
+00000000000020de <nel::Manual<int [1000]>::ptr()>:
+
+        // private:
+    public:
+        // only if you know there's a value there..
+        // TODO: must have no bare pointers.. safety feature.
+        constexpr Type *ptr()
+    20de:	55                   	push   %rbp
+    20df:	48 89 e5             	mov    %rsp,%rbp
+    20e2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return &u_.elem_;
+    20e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    20ea:	5d                   	pop    %rbp
+    20eb:	c3                   	ret
+
+00000000000020ec <int*&& nel::move<int*>(int*&)>:
+constexpr T &&move(T &v)
+    20ec:	55                   	push   %rbp
+    20ed:	48 89 e5             	mov    %rsp,%rbp
+    20f0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    20f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    20f8:	5d                   	pop    %rbp
+    20f9:	c3                   	ret
+
+00000000000020fa <int& nel::forward<int&, int>(int&)>:
+constexpr U &&forward(T &t)
+    20fa:	55                   	push   %rbp
+    20fb:	48 89 e5             	mov    %rsp,%rbp
+    20fe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    2102:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2106:	5d                   	pop    %rbp
+    2107:	c3                   	ret
+
+0000000000002108 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    2108:	55                   	push   %rbp
+    2109:	48 89 e5             	mov    %rsp,%rbp
+    210c:	48 83 ec 10          	sub    $0x10,%rsp
+    2110:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2114:	89 f0                	mov    %esi,%eax
+    2116:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    2119:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    211d:	48 8b 15 1c 2f 00 00 	mov    0x2f1c(%rip),%rdx        # 5040 <stderr@GLIBC_2.2.5>
+    2124:	48 89 d6             	mov    %rdx,%rsi
+    2127:	89 c7                	mov    %eax,%edi
+    2129:	e8 12 ef ff ff       	call   1040 <fputc@plt>
+    return outs;
+    212e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2132:	c9                   	leave
+    2133:	c3                   	ret
+
+0000000000002134 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    2134:	55                   	push   %rbp
+    2135:	48 89 e5             	mov    %rsp,%rbp
+    2138:	48 83 ec 10          	sub    $0x10,%rsp
+    213c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2140:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    2144:	48 8b 15 f5 2e 00 00 	mov    0x2ef5(%rip),%rdx        # 5040 <stderr@GLIBC_2.2.5>
+    214b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    214f:	48 89 d6             	mov    %rdx,%rsi
+    2152:	48 89 c7             	mov    %rax,%rdi
+    2155:	e8 d6 ee ff ff       	call   1030 <fputs@plt>
+    return outs;
+    215a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    215e:	c9                   	leave
+    215f:	c3                   	ret
+
+0000000000002160 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    2160:	55                   	push   %rbp
+    2161:	48 89 e5             	mov    %rsp,%rbp
+    2164:	48 83 ec 10          	sub    $0x10,%rsp
+    2168:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    216c:	89 f0                	mov    %esi,%eax
+    216e:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    2171:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    2175:	48 8b 05 c4 2e 00 00 	mov    0x2ec4(%rip),%rax        # 5040 <stderr@GLIBC_2.2.5>
+    217c:	48 8d 0d b9 0e 00 00 	lea    0xeb9(%rip),%rcx        # 303c <nel::sort::ninther_n+0x1c>
+    2183:	48 89 ce             	mov    %rcx,%rsi
+    2186:	48 89 c7             	mov    %rax,%rdi
+    2189:	b8 00 00 00 00       	mov    $0x0,%eax
+    218e:	e8 bd ee ff ff       	call   1050 <fprintf@plt>
+    return outs;
+    2193:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2197:	c9                   	leave
+    2198:	c3                   	ret
+
+0000000000002199 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    2199:	55                   	push   %rbp
+    219a:	48 89 e5             	mov    %rsp,%rbp
+    219d:	48 83 ec 10          	sub    $0x10,%rsp
+    21a1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    21a5:	89 f0                	mov    %esi,%eax
+    21a7:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    21ab:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    21af:	48 8b 05 8a 2e 00 00 	mov    0x2e8a(%rip),%rax        # 5040 <stderr@GLIBC_2.2.5>
+    21b6:	48 8d 0d 7f 0e 00 00 	lea    0xe7f(%rip),%rcx        # 303c <nel::sort::ninther_n+0x1c>
+    21bd:	48 89 ce             	mov    %rcx,%rsi
+    21c0:	48 89 c7             	mov    %rax,%rdi
+    21c3:	b8 00 00 00 00       	mov    $0x0,%eax
+    21c8:	e8 83 ee ff ff       	call   1050 <fprintf@plt>
+    return outs;
+    21cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    21d1:	c9                   	leave
+    21d2:	c3                   	ret
+
+00000000000021d3 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    21d3:	55                   	push   %rbp
+    21d4:	48 89 e5             	mov    %rsp,%rbp
+    21d7:	48 83 ec 10          	sub    $0x10,%rsp
+    21db:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    21df:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    21e2:	48 8b 05 57 2e 00 00 	mov    0x2e57(%rip),%rax        # 5040 <stderr@GLIBC_2.2.5>
+    21e9:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    21ec:	48 8d 0d 49 0e 00 00 	lea    0xe49(%rip),%rcx        # 303c <nel::sort::ninther_n+0x1c>
+    21f3:	48 89 ce             	mov    %rcx,%rsi
+    21f6:	48 89 c7             	mov    %rax,%rdi
+    21f9:	b8 00 00 00 00       	mov    $0x0,%eax
+    21fe:	e8 4d ee ff ff       	call   1050 <fprintf@plt>
+    return outs;
+    2203:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2207:	c9                   	leave
+    2208:	c3                   	ret
+
+0000000000002209 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    2209:	55                   	push   %rbp
+    220a:	48 89 e5             	mov    %rsp,%rbp
+    220d:	48 83 ec 10          	sub    $0x10,%rsp
+    2211:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2215:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    2218:	48 8b 05 21 2e 00 00 	mov    0x2e21(%rip),%rax        # 5040 <stderr@GLIBC_2.2.5>
+    221f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    2222:	48 8d 0d 13 0e 00 00 	lea    0xe13(%rip),%rcx        # 303c <nel::sort::ninther_n+0x1c>
+    2229:	48 89 ce             	mov    %rcx,%rsi
+    222c:	48 89 c7             	mov    %rax,%rdi
+    222f:	b8 00 00 00 00       	mov    $0x0,%eax
+    2234:	e8 17 ee ff ff       	call   1050 <fprintf@plt>
+    return outs;
+    2239:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    223d:	c9                   	leave
+    223e:	c3                   	ret
+
+000000000000223f <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    223f:	55                   	push   %rbp
+    2240:	48 89 e5             	mov    %rsp,%rbp
+    2243:	48 83 ec 10          	sub    $0x10,%rsp
+    2247:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    224b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    224f:	48 8b 05 ea 2d 00 00 	mov    0x2dea(%rip),%rax        # 5040 <stderr@GLIBC_2.2.5>
+    2256:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    225a:	48 8d 0d de 0d 00 00 	lea    0xdde(%rip),%rcx        # 303f <nel::sort::ninther_n+0x1f>
+    2261:	48 89 ce             	mov    %rcx,%rsi
+    2264:	48 89 c7             	mov    %rax,%rdi
+    2267:	b8 00 00 00 00       	mov    $0x0,%eax
+    226c:	e8 df ed ff ff       	call   1050 <fprintf@plt>
+    return outs;
+    2271:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2275:	c9                   	leave
+    2276:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000002278 <_fini>:
+    2278:	48 83 ec 08          	sub    $0x8,%rsp
+    227c:	48 83 c4 08          	add    $0x8,%rsp
+    2280:	c3                   	ret
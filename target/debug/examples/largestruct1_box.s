@@ -0,0 +1,3047 @@
+
+target/debug/examples/largestruct1_box:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 4f 00 00 	mov    0x4fc5(%rip),%rax        # 5fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 4f 00 00    	push   0x4fca(%rip)        # 5ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 4f 00 00    	jmp    *0x4fcc(%rip)        # 5ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 4f 00 00    	jmp    *0x4fca(%rip)        # 6000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 4f 00 00    	jmp    *0x4fc2(%rip)        # 6008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 4f 00 00    	jmp    *0x4fba(%rip)        # 6010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memset@plt>:
+    1060:	ff 25 b2 4f 00 00    	jmp    *0x4fb2(%rip)        # 6018 <memset@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 4f 00 00    	jmp    *0x4faa(%rip)        # 6020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 4f 00 00    	jmp    *0x4fa2(%rip)        # 6028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 4f 00 00    	jmp    *0x4f9a(%rip)        # 6030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcpy@plt>:
+    10a0:	ff 25 92 4f 00 00    	jmp    *0x4f92(%rip)        # 6038 <memcpy@GLIBC_2.14>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <realloc@plt>:
+    10b0:	ff 25 8a 4f 00 00    	jmp    *0x4f8a(%rip)        # 6040 <realloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <memmove@plt>:
+    10c0:	ff 25 82 4f 00 00    	jmp    *0x4f82(%rip)        # 6048 <memmove@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010d0 <__cxa_finalize@plt>:
+    10d0:	ff 25 0a 4f 00 00    	jmp    *0x4f0a(%rip)        # 5fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10d6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010e0 <_start>:
+    10e0:	31 ed                	xor    %ebp,%ebp
+    10e2:	49 89 d1             	mov    %rdx,%r9
+    10e5:	5e                   	pop    %rsi
+    10e6:	48 89 e2             	mov    %rsp,%rdx
+    10e9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    10ed:	50                   	push   %rax
+    10ee:	54                   	push   %rsp
+    10ef:	45 31 c0             	xor    %r8d,%r8d
+    10f2:	31 c9                	xor    %ecx,%ecx
+    10f4:	48 8d 3d 38 03 00 00 	lea    0x338(%rip),%rdi        # 1433 <main>
+    10fb:	ff 15 bf 4e 00 00    	call   *0x4ebf(%rip)        # 5fc0 <__libc_start_main@GLIBC_2.34>
+    1101:	f4                   	hlt
+    1102:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1109:	00 00 00 
+    110c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001110 <deregister_tm_clones>:
+    1110:	    48 8d 3d 49 4f 00 00 	lea    0x4f49(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+    1117:	    48 8d 05 42 4f 00 00 	lea    0x4f42(%rip),%rax        # 6060 <stderr@GLIBC_2.2.5>
+    111e:	    48 39 f8             	cmp    %rdi,%rax
+    1121:	/-- 74 15                	je     1138 <deregister_tm_clones+0x28>
+    1123:	|   48 8b 05 9e 4e 00 00 	mov    0x4e9e(%rip),%rax        # 5fc8 <_ITM_deregisterTMCloneTable@Base>
+    112a:	|   48 85 c0             	test   %rax,%rax
+    112d:	+-- 74 09                	je     1138 <deregister_tm_clones+0x28>
+    112f:	|   ff e0                	jmp    *%rax
+    1131:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1138:	\-> c3                   	ret
+    1139:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001140 <register_tm_clones>:
+    1140:	    48 8d 3d 19 4f 00 00 	lea    0x4f19(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+    1147:	    48 8d 35 12 4f 00 00 	lea    0x4f12(%rip),%rsi        # 6060 <stderr@GLIBC_2.2.5>
+    114e:	    48 29 fe             	sub    %rdi,%rsi
+    1151:	    48 89 f0             	mov    %rsi,%rax
+    1154:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1158:	    48 c1 f8 03          	sar    $0x3,%rax
+    115c:	    48 01 c6             	add    %rax,%rsi
+    115f:	    48 d1 fe             	sar    %rsi
+    1162:	/-- 74 14                	je     1178 <register_tm_clones+0x38>
+    1164:	|   48 8b 05 6d 4e 00 00 	mov    0x4e6d(%rip),%rax        # 5fd8 <_ITM_registerTMCloneTable@Base>
+    116b:	|   48 85 c0             	test   %rax,%rax
+    116e:	+-- 74 08                	je     1178 <register_tm_clones+0x38>
+    1170:	|   ff e0                	jmp    *%rax
+    1172:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1178:	\-> c3                   	ret
+    1179:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001180 <__do_global_dtors_aux>:
+    1180:	       f3 0f 1e fa          	endbr64
+    1184:	       80 3d dd 4e 00 00 00 	cmpb   $0x0,0x4edd(%rip)        # 6068 <completed.0>
+    118b:	/----- 75 2b                	jne    11b8 <__do_global_dtors_aux+0x38>
+    118d:	|      55                   	push   %rbp
+    118e:	|      48 83 3d 4a 4e 00 00 	cmpq   $0x0,0x4e4a(%rip)        # 5fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1195:	|      00 
+    1196:	|      48 89 e5             	mov    %rsp,%rbp
+    1199:	|  /-- 74 0c                	je     11a7 <__do_global_dtors_aux+0x27>
+    119b:	|  |   48 8b 3d b6 4e 00 00 	mov    0x4eb6(%rip),%rdi        # 6058 <__dso_handle>
+    11a2:	|  |   e8 29 ff ff ff       	call   10d0 <__cxa_finalize@plt>
+    11a7:	|  \-> e8 64 ff ff ff       	call   1110 <deregister_tm_clones>
+    11ac:	|      c6 05 b5 4e 00 00 01 	movb   $0x1,0x4eb5(%rip)        # 6068 <completed.0>
+    11b3:	|      5d                   	pop    %rbp
+    11b4:	|      c3                   	ret
+    11b5:	|      0f 1f 00             	nopl   (%rax)
+    11b8:	\----> c3                   	ret
+    11b9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011c0 <frame_dummy>:
+    11c0:	f3 0f 1e fa          	endbr64
+    11c4:	e9 77 ff ff ff       	jmp    1140 <register_tm_clones>
+
+00000000000011c9 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    11c9:	55                   	push   %rbp
+    11ca:	48 89 e5             	mov    %rsp,%rbp
+    11cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11d1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    11d4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11d9:	5d                   	pop    %rbp
+    11da:	c3                   	ret
+
+00000000000011db <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    11db:	55                   	push   %rbp
+    11dc:	48 89 e5             	mov    %rsp,%rbp
+    11df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11e3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11e6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return -1;
+    11ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11ef:	5d                   	pop    %rbp
+    11f0:	c3                   	ret
+
+00000000000011f1 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    11f1:	55                   	push   %rbp
+    11f2:	48 89 e5             	mov    %rsp,%rbp
+    11f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11f9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11fc:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    return -1;
+    11ff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1204:	5d                   	pop    %rbp
+    1205:	c3                   	ret
+
+0000000000001206 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    1206:	55                   	push   %rbp
+    1207:	48 89 e5             	mov    %rsp,%rbp
+    120a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    120e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1211:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    1214:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    return -1;
+    1217:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    121c:	5d                   	pop    %rbp
+    121d:	c3                   	ret
+
+000000000000121e <_read_r>:
+int _read_r(struct _reent *, int) {
+    121e:	55                   	push   %rbp
+    121f:	48 89 e5             	mov    %rsp,%rbp
+    1222:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1226:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1229:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    122e:	5d                   	pop    %rbp
+    122f:	c3                   	ret
+
+0000000000001230 <_write_r>:
+int _write_r(struct _reent *, int, char *, int) {
+    1230:	55                   	push   %rbp
+    1231:	48 89 e5             	mov    %rsp,%rbp
+    1234:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1238:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    123b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    123f:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+    return -1;
+    1242:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1247:	5d                   	pop    %rbp
+    1248:	c3                   	ret
+
+0000000000001249 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    1249:	55                   	push   %rbp
+    124a:	48 89 e5             	mov    %rsp,%rbp
+    124d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return -1;
+    1251:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1256:	5d                   	pop    %rbp
+    1257:	c3                   	ret
+
+0000000000001258 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1258:	55                   	push   %rbp
+    1259:	48 89 e5             	mov    %rsp,%rbp
+    125c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1260:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1263:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1268:	5d                   	pop    %rbp
+    1269:	c3                   	ret
+
+000000000000126a <operator<<(nel::Log&, nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> const&)>:
+#include "libnosys_stubs.cx"
+
+typedef nel::heaped::Box<U8Buf<256>> Box1;
+
+nel::Log &operator<<(nel::Log &outs, Box1 const &v)
+{
+    126a:	55                   	push   %rbp
+    126b:	48 89 e5             	mov    %rsp,%rbp
+    126e:	48 83 ec 10          	sub    $0x10,%rsp
+    1272:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1276:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    NEL_UNUSED(v);
+    outs << "Box1()";
+    127a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    127e:	48 8d 15 81 1d 00 00 	lea    0x1d81(%rip),%rdx        # 3006 <nel::None+0x1>
+    1285:	48 89 d6             	mov    %rdx,%rsi
+    1288:	48 89 c7             	mov    %rax,%rdi
+    128b:	e8 23 18 00 00       	call   2ab3 <nel::operator<<(nel::Log&, char const*)>
+    return outs;
+    1290:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1294:	c9                   	leave
+    1295:	c3                   	ret
+
+0000000000001296 <box1()>:
+
+void box1()
+{
+    1296:	55                   	push   %rbp
+    1297:	48 89 e5             	mov    %rsp,%rbp
+    129a:	48 81 ec 40 02 00 00 	sub    $0x240,%rsp
+    U8Buf<256> v = U8Buf<256>((uint8_t)0x66);
+    12a1:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    12a8:	be 66 00 00 00       	mov    $0x66,%esi
+    12ad:	48 89 c7             	mov    %rax,%rdi
+    12b0:	e8 2f 03 00 00       	call   15e4 <U8Buf<256ul>::U8Buf(unsigned char)>
+    auto r = Box1::try_from(nel::move(v));
+    12b5:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    12bc:	48 89 c7             	mov    %rax,%rdi
+    12bf:	e8 4b 03 00 00       	call   160f <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    12c4:	48 89 c2             	mov    %rax,%rdx
+    12c7:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+    12ce:	48 89 d6             	mov    %rdx,%rsi
+    12d1:	48 89 c7             	mov    %rax,%rdi
+    12d4:	e8 44 03 00 00       	call   161d <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::try_from(U8Buf<256ul>&&)>
+    Box1 b = r.unwrap();
+    12d9:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    12dd:	b9 16 00 00 00       	mov    $0x16,%ecx
+    12e2:	48 8d 15 48 1d 00 00 	lea    0x1d48(%rip),%rdx        # 3031 <nel::None+0x2c>
+    12e9:	48 8d 35 5e 1d 00 00 	lea    0x1d5e(%rip),%rsi        # 304e <nel::None+0x49>
+    12f0:	48 89 c7             	mov    %rax,%rdi
+    12f3:	e8 58 01 00 00       	call   1450 <nel::Context::Context(char const*, char const*, int)>
+    12f8:	48 8d 85 c8 fd ff ff 	lea    -0x238(%rbp),%rax
+    12ff:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1303:	48 8d 8d d0 fd ff ff 	lea    -0x230(%rbp),%rcx
+    130a:	48 89 ce             	mov    %rcx,%rsi
+    130d:	48 89 c7             	mov    %rax,%rdi
+    1310:	e8 01 04 00 00       	call   1716 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)>
+
+    nel::log << b << '\n';
+    1315:	48 8d 85 c8 fd ff ff 	lea    -0x238(%rbp),%rax
+    131c:	48 89 c6             	mov    %rax,%rsi
+    131f:	48 8d 05 43 4d 00 00 	lea    0x4d43(%rip),%rax        # 6069 <nel::log>
+    1326:	48 89 c7             	mov    %rax,%rdi
+    1329:	e8 3c ff ff ff       	call   126a <operator<<(nel::Log&, nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> const&)>
+    132e:	be 0a 00 00 00       	mov    $0xa,%esi
+    1333:	48 89 c7             	mov    %rax,%rdi
+    1336:	e8 4c 17 00 00       	call   2a87 <nel::operator<<(nel::Log&, char)>
+}
+    133b:	48 8d 85 c8 fd ff ff 	lea    -0x238(%rbp),%rax
+    1342:	48 89 c7             	mov    %rax,%rdi
+    1345:	e8 ae 08 00 00       	call   1bf8 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::~Box()>
+    134a:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+    1351:	48 89 c7             	mov    %rax,%rdi
+    1354:	e8 07 06 00 00       	call   1960 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::~Result()>
+    1359:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    1360:	48 89 c7             	mov    %rax,%rdi
+    1363:	e8 9a 05 00 00       	call   1902 <U8Buf<256ul>::~U8Buf()>
+    1368:	c9                   	leave
+    1369:	c3                   	ret
+
+000000000000136a <box2()>:
+
+void box2()
+{
+    136a:	55                   	push   %rbp
+    136b:	48 89 e5             	mov    %rsp,%rbp
+    136e:	48 81 ec 40 02 00 00 	sub    $0x240,%rsp
+    auto r = Box1::try_from((uint8_t)0x67);
+    1375:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    137c:	be 67 00 00 00       	mov    $0x67,%esi
+    1381:	48 89 c7             	mov    %rax,%rdi
+    1384:	e8 5b 02 00 00       	call   15e4 <U8Buf<256ul>::U8Buf(unsigned char)>
+    1389:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+    1390:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+    1397:	48 89 d6             	mov    %rdx,%rsi
+    139a:	48 89 c7             	mov    %rax,%rdi
+    139d:	e8 7b 02 00 00       	call   161d <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::try_from(U8Buf<256ul>&&)>
+    13a2:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    13a9:	48 89 c7             	mov    %rax,%rdi
+    13ac:	e8 51 05 00 00       	call   1902 <U8Buf<256ul>::~U8Buf()>
+    Box1 b = r.unwrap();
+    13b1:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    13b5:	b9 1e 00 00 00       	mov    $0x1e,%ecx
+    13ba:	48 8d 15 70 1c 00 00 	lea    0x1c70(%rip),%rdx        # 3031 <nel::None+0x2c>
+    13c1:	48 8d 35 8b 1c 00 00 	lea    0x1c8b(%rip),%rsi        # 3053 <nel::None+0x4e>
+    13c8:	48 89 c7             	mov    %rax,%rdi
+    13cb:	e8 80 00 00 00       	call   1450 <nel::Context::Context(char const*, char const*, int)>
+    13d0:	48 8d 85 c8 fd ff ff 	lea    -0x238(%rbp),%rax
+    13d7:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    13db:	48 8d 8d d0 fd ff ff 	lea    -0x230(%rbp),%rcx
+    13e2:	48 89 ce             	mov    %rcx,%rsi
+    13e5:	48 89 c7             	mov    %rax,%rdi
+    13e8:	e8 29 03 00 00       	call   1716 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)>
+
+    nel::log << b << '\n';
+    13ed:	48 8d 85 c8 fd ff ff 	lea    -0x238(%rbp),%rax
+    13f4:	48 89 c6             	mov    %rax,%rsi
+    13f7:	48 8d 05 6b 4c 00 00 	lea    0x4c6b(%rip),%rax        # 6069 <nel::log>
+    13fe:	48 89 c7             	mov    %rax,%rdi
+    1401:	e8 64 fe ff ff       	call   126a <operator<<(nel::Log&, nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> const&)>
+    1406:	be 0a 00 00 00       	mov    $0xa,%esi
+    140b:	48 89 c7             	mov    %rax,%rdi
+    140e:	e8 74 16 00 00       	call   2a87 <nel::operator<<(nel::Log&, char)>
+}
+    1413:	48 8d 85 c8 fd ff ff 	lea    -0x238(%rbp),%rax
+    141a:	48 89 c7             	mov    %rax,%rdi
+    141d:	e8 d6 07 00 00       	call   1bf8 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::~Box()>
+    1422:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+    1429:	48 89 c7             	mov    %rax,%rdi
+    142c:	e8 2f 05 00 00       	call   1960 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::~Result()>
+    1431:	c9                   	leave
+    1432:	c3                   	ret
+
+0000000000001433 <main>:
+
+int main() {}
+    1433:	55                   	push   %rbp
+    1434:	48 89 e5             	mov    %rsp,%rbp
+    1437:	b8 00 00 00 00       	mov    $0x0,%eax
+    143c:	5d                   	pop    %rbp
+    143d:	c3                   	ret
+
+000000000000143e <operator new(unsigned long, void*)>:
+nel::Log &operator<<(nel::Log &outs, Box1 const &v)
+    143e:	55                   	push   %rbp
+    143f:	48 89 e5             	mov    %rsp,%rbp
+    1442:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1446:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+{
+    144a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    NEL_UNUSED(v);
+    144e:	5d                   	pop    %rbp
+    144f:	c3                   	ret
+
+0000000000001450 <nel::Context::Context(char const*, char const*, int)>:
+        char const *fn_name_;
+        char const *file_name_;
+        int line_num_;
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+    1450:	55                   	push   %rbp
+    1451:	48 89 e5             	mov    %rsp,%rbp
+    1454:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1458:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    145c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1460:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1463:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1467:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    146b:	48 89 10             	mov    %rdx,(%rax)
+            , file_name_(file_name)
+    146e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1472:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1476:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , line_num_(line_num)
+    147a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    147e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1481:	89 50 10             	mov    %edx,0x10(%rax)
+        {
+        }
+    1484:	90                   	nop
+    1485:	5d                   	pop    %rbp
+    1486:	c3                   	ret
+
+0000000000001487 <nel::heaped::Malloc::try_malloc(unsigned long, unsigned long)>:
+ * and friends (see memory.hh).
+ */
+struct Malloc
+{
+    public:
+        static Result<void *, AllocError> try_malloc(Length const align, Length const size)
+    1487:	55                   	push   %rbp
+    1488:	48 89 e5             	mov    %rsp,%rbp
+    148b:	48 83 ec 20          	sub    $0x20,%rsp
+    148f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1493:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1497:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            return try_realloc(nullptr, align, 0, size);
+    149b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    149f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    14a3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    14a7:	49 89 c8             	mov    %rcx,%r8
+    14aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+    14af:	be 00 00 00 00       	mov    $0x0,%esi
+    14b4:	48 89 c7             	mov    %rax,%rdi
+    14b7:	e8 06 00 00 00       	call   14c2 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>
+        }
+    14bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14c0:	c9                   	leave
+    14c1:	c3                   	ret
+
+00000000000014c2 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>:
+
+        static Result<void *, AllocError> try_realloc(void *const p,
+    14c2:	          55                   	push   %rbp
+    14c3:	          48 89 e5             	mov    %rsp,%rbp
+    14c6:	          48 83 ec 40          	sub    $0x40,%rsp
+    14ca:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    14ce:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    14d2:	          48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    14d6:	          48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    14da:	          4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+                                                      Length const align,
+                                                      Length const old_size,
+                                                      Length const new_size)
+        {
+            if (align == 0 || (align & (align - 1)) != 0) {
+    14de:	          48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    14e3:	      /-- 74 11                	je     14f6 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x34>
+    14e5:	      |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    14e9:	      |   48 83 e8 01          	sub    $0x1,%rax
+    14ed:	      |   48 23 45 d8          	and    -0x28(%rbp),%rax
+    14f1:	      |   48 85 c0             	test   %rax,%rax
+    14f4:	   /--|-- 74 1c                	je     1512 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x50>
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+    14f6:	   |  \-> c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+    14fd:	   |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1501:	   |      48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    1505:	   |      48 89 d6             	mov    %rdx,%rsi
+    1508:	   |      48 89 c7             	mov    %rax,%rdi
+    150b:	   |      e8 8a 03 00 00       	call   189a <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+                                    : std::realloc(p, new_size);
+            if (new_p == nullptr) {
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+            }
+            return Result<void *, AllocError>::Ok(new_p);
+        }
+    1510:	/--|----- eb 79                	jmp    158b <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            void *const new_p = is_over_aligned(align)
+    1512:	|  \----> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1516:	|         48 89 c7             	mov    %rax,%rdi
+    1519:	|         e8 b4 00 00 00       	call   15d2 <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+                                    ? realloc_aligned(p, align, old_size, new_size)
+    151e:	|         84 c0                	test   %al,%al
+    1520:	|  /----- 74 1a                	je     153c <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x7a>
+    1522:	|  |      48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+    1526:	|  |      48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    152a:	|  |      48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+    152e:	|  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1532:	|  |      48 89 c7             	mov    %rax,%rdi
+    1535:	|  |      e8 48 13 00 00       	call   2882 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+    153a:	|  |  /-- eb 13                	jmp    154f <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x8d>
+                                    : std::realloc(p, new_size);
+    153c:	|  \--|-> 48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    1540:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1544:	|     |   48 89 d6             	mov    %rdx,%rsi
+    1547:	|     |   48 89 c7             	mov    %rax,%rdi
+    154a:	|     |   e8 61 fb ff ff       	call   10b0 <realloc@plt>
+    154f:	|     \-> 48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            if (new_p == nullptr) {
+    1553:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1557:	|         48 85 c0             	test   %rax,%rax
+    155a:	|     /-- 75 1c                	jne    1578 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xb6>
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+    155c:	|     |   c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1563:	|     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1567:	|     |   48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    156b:	|     |   48 89 d6             	mov    %rdx,%rsi
+    156e:	|     |   48 89 c7             	mov    %rax,%rdi
+    1571:	|     |   e8 24 03 00 00       	call   189a <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+        }
+    1576:	+-----|-- eb 13                	jmp    158b <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            return Result<void *, AllocError>::Ok(new_p);
+    1578:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    157c:	|         48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    1580:	|         48 89 d6             	mov    %rdx,%rsi
+    1583:	|         48 89 c7             	mov    %rax,%rdi
+    1586:	|         e8 43 03 00 00       	call   18ce <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>
+        }
+    158b:	\-------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    158f:	          c9                   	leave
+    1590:	          c3                   	ret
+
+0000000000001591 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>:
+
+        static void free(void *const p, Length const align, Length const size)
+    1591:	       55                   	push   %rbp
+    1592:	       48 89 e5             	mov    %rsp,%rbp
+    1595:	       48 83 ec 20          	sub    $0x20,%rsp
+    1599:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    159d:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    15a1:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+    15a5:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15a9:	       48 89 c7             	mov    %rax,%rdi
+    15ac:	       e8 21 00 00 00       	call   15d2 <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+    15b1:	       84 c0                	test   %al,%al
+    15b3:	/----- 74 0e                	je     15c3 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x32>
+                free_aligned(p);
+    15b5:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15b9:	|      48 89 c7             	mov    %rax,%rdi
+    15bc:	|      e8 7d 12 00 00       	call   283e <nel::free_aligned(void*)>
+            } else {
+                std::free(p);
+            }
+        }
+    15c1:	|  /-- eb 0c                	jmp    15cf <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x3e>
+                std::free(p);
+    15c3:	\--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15c7:	   |   48 89 c7             	mov    %rax,%rdi
+    15ca:	   |   e8 61 fa ff ff       	call   1030 <free@plt>
+        }
+    15cf:	   \-> 90                   	nop
+    15d0:	       c9                   	leave
+    15d1:	       c3                   	ret
+
+00000000000015d2 <nel::heaped::Malloc::is_over_aligned(unsigned long)>:
+
+    private:
+        static constexpr bool is_over_aligned(Length const align)
+    15d2:	55                   	push   %rbp
+    15d3:	48 89 e5             	mov    %rsp,%rbp
+    15d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return align > alignof(std::max_align_t);
+    15da:	48 83 7d f8 10       	cmpq   $0x10,-0x8(%rbp)
+    15df:	0f 97 c0             	seta   %al
+        }
+    15e2:	5d                   	pop    %rbp
+    15e3:	c3                   	ret
+
+00000000000015e4 <U8Buf<256ul>::U8Buf(unsigned char)>:
+            nel::elem::move(data_, o.data_, N);
+            return *this;
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+    15e4:	55                   	push   %rbp
+    15e5:	48 89 e5             	mov    %rsp,%rbp
+    15e8:	48 83 ec 10          	sub    $0x10,%rsp
+    15ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    15f0:	89 f0                	mov    %esi,%eax
+    15f2:	88 45 f4             	mov    %al,-0xc(%rbp)
+        {
+            nel::elem::set(data_, f, N);
+    15f5:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    15f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15fd:	ba 00 01 00 00       	mov    $0x100,%edx
+    1602:	89 ce                	mov    %ecx,%esi
+    1604:	48 89 c7             	mov    %rax,%rdi
+    1607:	e8 53 0c 00 00       	call   225f <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    160c:	90                   	nop
+    160d:	c9                   	leave
+    160e:	c3                   	ret
+
+000000000000160f <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel is to not need std.
+ */
+template<typename T>
+constexpr T &&move(T &v)
+    160f:	55                   	push   %rbp
+    1610:	48 89 e5             	mov    %rsp,%rbp
+    1613:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<T &&>(v);
+    1617:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    161b:	5d                   	pop    %rbp
+    161c:	c3                   	ret
+
+000000000000161d <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::try_from(U8Buf<256ul>&&)>:
+         *
+         * @param val The value to move into the box
+         * @returns on success, Result::Ok holding the box.
+         * @returns on fail, Result::Err holding val.
+         */
+        constexpr static Result<Box, Type> try_from(Type &&val)
+    161d:	       55                   	push   %rbp
+    161e:	       48 89 e5             	mov    %rsp,%rbp
+    1621:	       48 83 ec 20          	sub    $0x20,%rsp
+    1625:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1629:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            // on fail, val not moved
+            ElementT *const p = create(move(val));
+    162d:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1631:	       48 89 c7             	mov    %rax,%rdi
+    1634:	       e8 d6 ff ff ff       	call   160f <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    1639:	       48 89 c7             	mov    %rax,%rdi
+    163c:	       e8 9a 04 00 00       	call   1adb <nel::Element<U8Buf<256ul> >* nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::create<U8Buf<256ul> >(U8Buf<256ul>&&)>
+    1641:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            if (p == nullptr) { return Result<Box, Type>::Err(move(val)); }
+    1645:	       48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    164a:	   /-- 75 20                	jne    166c <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::try_from(U8Buf<256ul>&&)+0x4f>
+    164c:	   |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1650:	   |   48 89 c7             	mov    %rax,%rdi
+    1653:	   |   e8 b7 ff ff ff       	call   160f <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    1658:	   |   48 89 c2             	mov    %rax,%rdx
+    165b:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    165f:	   |   48 89 d6             	mov    %rdx,%rsi
+    1662:	   |   48 89 c7             	mov    %rax,%rdi
+    1665:	   |   e8 3f 05 00 00       	call   1ba9 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::Err(U8Buf<256ul>&&)>
+    166a:	/--|-- eb 3d                	jmp    16a9 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::try_from(U8Buf<256ul>&&)+0x8c>
+            return Result<Box, Type>::Ok(move(Box(p)));
+    166c:	|  \-> 48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1670:	|      48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1674:	|      48 89 d6             	mov    %rdx,%rsi
+    1677:	|      48 89 c7             	mov    %rax,%rdi
+    167a:	|      e8 5f 05 00 00       	call   1bde <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::Box(nel::Element<U8Buf<256ul> >*)>
+    167f:	|      48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1683:	|      48 89 c7             	mov    %rax,%rdi
+    1686:	|      e8 8b 05 00 00       	call   1c16 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&& nel::move<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> >(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)>
+    168b:	|      48 89 c2             	mov    %rax,%rdx
+    168e:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1692:	|      48 89 d6             	mov    %rdx,%rsi
+    1695:	|      48 89 c7             	mov    %rax,%rdi
+    1698:	|      e8 87 05 00 00       	call   1c24 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::Ok(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)>
+    169d:	|      48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    16a1:	|      48 89 c7             	mov    %rax,%rdi
+    16a4:	|      e8 4f 05 00 00       	call   1bf8 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::~Box()>
+        }
+    16a9:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16ad:	       c9                   	leave
+    16ae:	       c3                   	ret
+    16af:	       90                   	nop
+
+00000000000016b0 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)#1}::operator()(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&) const>:
+         *
+         * `this` is consumed by the operation.
+         */
+        constexpr T unwrap(Context const &ctx = Context())
+        {
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    16b0:	55                   	push   %rbp
+    16b1:	48 89 e5             	mov    %rsp,%rbp
+    16b4:	48 83 ec 20          	sub    $0x20,%rsp
+    16b8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    16bc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    16c0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    16c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16c8:	48 89 c7             	mov    %rax,%rdi
+    16cb:	e8 88 05 00 00       	call   1c58 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&& nel::forward<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> >(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&)>
+    16d0:	48 89 c2             	mov    %rax,%rdx
+    16d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16d7:	48 89 d6             	mov    %rdx,%rsi
+    16da:	48 89 c7             	mov    %rax,%rdi
+    16dd:	e8 84 05 00 00       	call   1c66 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::Box(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)>
+    16e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16e6:	c9                   	leave
+    16e7:	c3                   	ret
+
+00000000000016e8 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#2}::operator()(U8Buf<256ul>&&) const>:
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    16e8:	55                   	push   %rbp
+    16e9:	48 89 e5             	mov    %rsp,%rbp
+    16ec:	48 83 ec 20          	sub    $0x20,%rsp
+    16f0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    16f4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    16f8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    16fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1700:	48 8b 00             	mov    (%rax),%rax
+    1703:	48 89 c6             	mov    %rax,%rsi
+    1706:	48 8d 05 00 19 00 00 	lea    0x1900(%rip),%rax        # 300d <nel::None+0x8>
+    170d:	48 89 c7             	mov    %rax,%rdi
+    1710:	e8 66 0a 00 00       	call   217b <nel::panic(char const*, nel::Context const&)>
+    1715:	90                   	nop
+
+0000000000001716 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)>:
+        constexpr T unwrap(Context const &ctx = Context())
+    1716:	55                   	push   %rbp
+    1717:	48 89 e5             	mov    %rsp,%rbp
+    171a:	48 83 ec 30          	sub    $0x30,%rsp
+    171e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1722:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1726:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    172a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    172e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+                              ctx);
+    1732:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1736:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+    173a:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+    173e:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    1742:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+    1746:	49 89 f8             	mov    %rdi,%r8
+    1749:	48 89 c7             	mov    %rax,%rdi
+    174c:	e8 07 00 00 00       	call   1758 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::consume<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)#1}, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#2}>(nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)#1}&&, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#2}&&, nel::Context const&)>
+        }
+    1751:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1755:	c9                   	leave
+    1756:	c3                   	ret
+    1757:	90                   	nop
+
+0000000000001758 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::consume<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)#1}, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#2}>(nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)#1}&&, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    1758:	             55                   	push   %rbp
+    1759:	             48 89 e5             	mov    %rsp,%rbp
+    175c:	             48 83 ec 40          	sub    $0x40,%rsp
+    1760:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1764:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1768:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    176c:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    1770:	             4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+            auto tag = tag_;
+    1774:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1778:	             8b 00                	mov    (%rax),%eax
+    177a:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    177d:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1781:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    1787:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    178b:	         /-- 74 46                	je     17d3 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::consume<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)#1}, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#2}>(nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)#1}&&, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#2}&&, nel::Context const&)+0x7b>
+    178d:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    1791:	/--------|-- 0f 8f 82 00 00 00    	jg     1819 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::consume<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)#1}, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#2}>(nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)#1}&&, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#2}&&, nel::Context const&)+0xc1>
+    1797:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    179b:	|  /-----|-- 74 66                	je     1803 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::consume<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)#1}, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#2}>(nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)#1}&&, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#2}&&, nel::Context const&)+0xab>
+    179d:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    17a1:	+--|-----|-- 75 76                	jne    1819 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::consume<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)#1}, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#2}>(nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)#1}&&, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#2}&&, nel::Context const&)+0xc1>
+                    return on_ok(forward<T>(*ok_));
+    17a3:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    17a7:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    17ab:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    17ae:	|  |     |   e8 db 04 00 00       	call   1c8e <nel::Element<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> >::operator*()>
+    17b3:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    17b6:	|  |     |   e8 9d 04 00 00       	call   1c58 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&& nel::forward<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> >(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&)>
+    17bb:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    17be:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17c2:	|  |     |   48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+    17c6:	|  |     |   48 89 ce             	mov    %rcx,%rsi
+    17c9:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    17cc:	|  |     |   e8 df fe ff ff       	call   16b0 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)#1}::operator()(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&) const>
+    17d1:	|  |  /--|-- eb 5c                	jmp    182f <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::consume<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)#1}, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#2}>(nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)#1}&&, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#2}&&, nel::Context const&)+0xd7>
+                    return on_err(forward<E>(*err_));
+    17d3:	|  |  |  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    17d7:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    17db:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    17de:	|  |  |      e8 c5 04 00 00       	call   1ca8 <nel::Element<U8Buf<256ul> >::operator*()>
+    17e3:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    17e6:	|  |  |      e8 d7 04 00 00       	call   1cc2 <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    17eb:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    17ee:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17f2:	|  |  |      48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    17f6:	|  |  |      48 89 ce             	mov    %rcx,%rsi
+    17f9:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    17fc:	|  |  |      e8 e7 fe ff ff       	call   16e8 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#2}::operator()(U8Buf<256ul>&&) const>
+    1801:	|  |  +----- eb 2c                	jmp    182f <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::consume<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)#1}, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#2}>(nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)#1}&&, nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#2}&&, nel::Context const&)+0xd7>
+                    nel::panic("invalid Result", ctx);
+    1803:	|  \--|----> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1807:	|     |      48 89 c6             	mov    %rax,%rsi
+    180a:	|     |      48 8d 05 06 18 00 00 	lea    0x1806(%rip),%rax        # 3017 <nel::None+0x12>
+    1811:	|     |      48 89 c7             	mov    %rax,%rdi
+    1814:	|     |      e8 62 09 00 00       	call   217b <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    1819:	\-----|----> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    181d:	      |      48 89 c6             	mov    %rax,%rsi
+    1820:	      |      48 8d 05 ff 17 00 00 	lea    0x17ff(%rip),%rax        # 3026 <nel::None+0x21>
+    1827:	      |      48 89 c7             	mov    %rax,%rdi
+    182a:	      |      e8 4c 09 00 00       	call   217b <nel::panic(char const*, nel::Context const&)>
+        }
+    182f:	      \----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1833:	             c9                   	leave
+    1834:	             c3                   	ret
+    1835:	             90                   	nop
+
+0000000000001836 <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+        constexpr ~Result(void)
+    1836:	             55                   	push   %rbp
+    1837:	             48 89 e5             	mov    %rsp,%rbp
+    183a:	             48 83 ec 30          	sub    $0x30,%rsp
+    183e:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+            switch (tag_) { // result::dtor
+    1842:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1846:	             8b 00                	mov    (%rax),%eax
+    1848:	             83 f8 02             	cmp    $0x2,%eax
+    184b:	/----------- 74 43                	je     1890 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5a>
+    184d:	|            83 f8 02             	cmp    $0x2,%eax
+    1850:	|        /-- 7f 09                	jg     185b <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x25>
+    1852:	|        |   85 c0                	test   %eax,%eax
+    1854:	|  /-----|-- 74 3d                	je     1893 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5d>
+    1856:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    1859:	|  |  /--|-- 74 3b                	je     1896 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x60>
+                    nel::panic("bad Result");
+    185b:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    185f:	|  |  |      b9 72 00 00 00       	mov    $0x72,%ecx
+    1864:	|  |  |      48 8d 15 ed 17 00 00 	lea    0x17ed(%rip),%rdx        # 3058 <nel::None+0x53>
+    186b:	|  |  |      48 8d 35 f8 17 00 00 	lea    0x17f8(%rip),%rsi        # 306a <nel::None+0x65>
+    1872:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1875:	|  |  |      e8 d6 fb ff ff       	call   1450 <nel::Context::Context(char const*, char const*, int)>
+    187a:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    187e:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    1881:	|  |  |      48 8d 05 9e 17 00 00 	lea    0x179e(%rip),%rax        # 3026 <nel::None+0x21>
+    1888:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    188b:	|  |  |      e8 eb 08 00 00       	call   217b <nel::panic(char const*, nel::Context const&)>
+                    break;
+    1890:	\--|--|----> 90                   	nop
+    1891:	   |  |  /-- eb 04                	jmp    1897 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    1893:	   \--|--|-> 90                   	nop
+    1894:	      |  +-- eb 01                	jmp    1897 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    1896:	      \--|-> 90                   	nop
+        }
+    1897:	         \-> 90                   	nop
+    1898:	             c9                   	leave
+    1899:	             c3                   	ret
+
+000000000000189a <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>:
+        constexpr static Result Err(E &&val)
+    189a:	55                   	push   %rbp
+    189b:	48 89 e5             	mov    %rsp,%rbp
+    189e:	48 83 ec 10          	sub    $0x10,%rsp
+    18a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    18a6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<E>(val));
+    18aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18ae:	48 89 c7             	mov    %rax,%rdi
+    18b1:	e8 1a 04 00 00       	call   1cd0 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    18b6:	48 89 c2             	mov    %rax,%rdx
+    18b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18bd:	48 89 d6             	mov    %rdx,%rsi
+    18c0:	48 89 c7             	mov    %rax,%rdi
+    18c3:	e8 16 04 00 00       	call   1cde <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>
+        }
+    18c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18cc:	c9                   	leave
+    18cd:	c3                   	ret
+
+00000000000018ce <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>:
+        constexpr static Result Ok(Args &&...args)
+    18ce:	55                   	push   %rbp
+    18cf:	48 89 e5             	mov    %rsp,%rbp
+    18d2:	48 83 ec 10          	sub    $0x10,%rsp
+    18d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    18da:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<Args>(args)...);
+    18de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18e2:	48 89 c7             	mov    %rax,%rdi
+    18e5:	e8 35 04 00 00       	call   1d1f <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    18ea:	48 89 c2             	mov    %rax,%rdx
+    18ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18f1:	48 89 d6             	mov    %rdx,%rsi
+    18f4:	48 89 c7             	mov    %rax,%rdi
+    18f7:	e8 32 04 00 00       	call   1d2e <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>
+        }
+    18fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1900:	c9                   	leave
+    1901:	c3                   	ret
+
+0000000000001902 <U8Buf<256ul>::~U8Buf()>:
+        constexpr ~U8Buf(void)
+    1902:	55                   	push   %rbp
+    1903:	48 89 e5             	mov    %rsp,%rbp
+    1906:	48 83 ec 10          	sub    $0x10,%rsp
+    190a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            nel::elem::set(data_, 0xa5, N);
+    190e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1912:	ba 00 01 00 00       	mov    $0x100,%edx
+    1917:	be a5 00 00 00       	mov    $0xa5,%esi
+    191c:	48 89 c7             	mov    %rax,%rdi
+    191f:	e8 3b 09 00 00       	call   225f <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    1924:	90                   	nop
+    1925:	c9                   	leave
+    1926:	c3                   	ret
+    1927:	90                   	nop
+
+0000000000001928 <nel::Element<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> >::~Element()>:
+
+    private:
+        Type value_;
+
+    public:
+        constexpr ~Element(void) = default;
+    1928:	55                   	push   %rbp
+    1929:	48 89 e5             	mov    %rsp,%rbp
+    192c:	48 83 ec 10          	sub    $0x10,%rsp
+    1930:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1934:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1938:	48 89 c7             	mov    %rax,%rdi
+    193b:	e8 b8 02 00 00       	call   1bf8 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::~Box()>
+    1940:	90                   	nop
+    1941:	c9                   	leave
+    1942:	c3                   	ret
+    1943:	90                   	nop
+
+0000000000001944 <nel::Element<U8Buf<256ul> >::~Element()>:
+    1944:	55                   	push   %rbp
+    1945:	48 89 e5             	mov    %rsp,%rbp
+    1948:	48 83 ec 10          	sub    $0x10,%rsp
+    194c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1950:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1954:	48 89 c7             	mov    %rax,%rdi
+    1957:	e8 a6 ff ff ff       	call   1902 <U8Buf<256ul>::~U8Buf()>
+    195c:	90                   	nop
+    195d:	c9                   	leave
+    195e:	c3                   	ret
+    195f:	90                   	nop
+
+0000000000001960 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::~Result()>:
+        constexpr ~Result(void)
+    1960:	             55                   	push   %rbp
+    1961:	             48 89 e5             	mov    %rsp,%rbp
+    1964:	             48 83 ec 30          	sub    $0x30,%rsp
+    1968:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+            switch (tag_) { // result::dtor
+    196c:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1970:	             8b 00                	mov    (%rax),%eax
+    1972:	             83 f8 02             	cmp    $0x2,%eax
+    1975:	         /-- 74 20                	je     1997 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::~Result()+0x37>
+    1977:	         |   83 f8 02             	cmp    $0x2,%eax
+    197a:	      /--|-- 7f 2d                	jg     19a9 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::~Result()+0x49>
+    197c:	      |  |   85 c0                	test   %eax,%eax
+    197e:	/-----|--|-- 74 5e                	je     19de <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::~Result()+0x7e>
+    1980:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    1983:	|     +--|-- 75 24                	jne    19a9 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::~Result()+0x49>
+                    ok_.~Element<T>();
+    1985:	|     |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1989:	|     |  |   48 83 c0 08          	add    $0x8,%rax
+    198d:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    1990:	|     |  |   e8 93 ff ff ff       	call   1928 <nel::Element<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> >::~Element()>
+                    break;
+    1995:	|  /--|--|-- eb 48                	jmp    19df <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::~Result()+0x7f>
+                    err_.~Element<E>();
+    1997:	|  |  |  \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    199b:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    199f:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    19a2:	|  |  |      e8 9d ff ff ff       	call   1944 <nel::Element<U8Buf<256ul> >::~Element()>
+                    break;
+    19a7:	|  +--|----- eb 36                	jmp    19df <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::~Result()+0x7f>
+                    nel::panic("bad Result");
+    19a9:	|  |  \----> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    19ad:	|  |         b9 72 00 00 00       	mov    $0x72,%ecx
+    19b2:	|  |         48 8d 15 9f 16 00 00 	lea    0x169f(%rip),%rdx        # 3058 <nel::None+0x53>
+    19b9:	|  |         48 8d 35 aa 16 00 00 	lea    0x16aa(%rip),%rsi        # 306a <nel::None+0x65>
+    19c0:	|  |         48 89 c7             	mov    %rax,%rdi
+    19c3:	|  |         e8 88 fa ff ff       	call   1450 <nel::Context::Context(char const*, char const*, int)>
+    19c8:	|  |         48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    19cc:	|  |         48 89 c6             	mov    %rax,%rsi
+    19cf:	|  |         48 8d 05 50 16 00 00 	lea    0x1650(%rip),%rax        # 3026 <nel::None+0x21>
+    19d6:	|  |         48 89 c7             	mov    %rax,%rdi
+    19d9:	|  |         e8 9d 07 00 00       	call   217b <nel::panic(char const*, nel::Context const&)>
+                    break;
+    19de:	\--|-------> 90                   	nop
+        }
+    19df:	   \-------> 90                   	nop
+    19e0:	             c9                   	leave
+    19e1:	             c3                   	ret
+
+00000000000019e2 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>:
+            return match<bool>([](T const &) -> bool { return false; },
+    19e2:	55                   	push   %rbp
+    19e3:	48 89 e5             	mov    %rsp,%rbp
+    19e6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    19ea:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    19ee:	b8 00 00 00 00       	mov    $0x0,%eax
+    19f3:	5d                   	pop    %rbp
+    19f4:	c3                   	ret
+    19f5:	90                   	nop
+
+00000000000019f6 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>:
+                               [](E const &) -> bool { return true; },
+    19f6:	55                   	push   %rbp
+    19f7:	48 89 e5             	mov    %rsp,%rbp
+    19fa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    19fe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1a02:	b8 01 00 00 00       	mov    $0x1,%eax
+    1a07:	5d                   	pop    %rbp
+    1a08:	c3                   	ret
+    1a09:	90                   	nop
+
+0000000000001a0a <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>:
+        constexpr bool is_err(Context const &ctx = Context()) const
+    1a0a:	55                   	push   %rbp
+    1a0b:	48 89 e5             	mov    %rsp,%rbp
+    1a0e:	48 83 ec 20          	sub    $0x20,%rsp
+    1a12:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1a16:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](T const &) -> bool { return false; },
+    1a1a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1a1e:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    1a22:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    1a26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a2a:	48 89 c7             	mov    %rax,%rdi
+    1a2d:	e8 02 00 00 00       	call   1a34 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>
+        }
+    1a32:	c9                   	leave
+    1a33:	c3                   	ret
+
+0000000000001a34 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    1a34:	             55                   	push   %rbp
+    1a35:	             48 89 e5             	mov    %rsp,%rbp
+    1a38:	             48 83 ec 20          	sub    $0x20,%rsp
+    1a3c:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a40:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1a44:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1a48:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result-match
+    1a4c:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a50:	             8b 00                	mov    (%rax),%eax
+    1a52:	             83 f8 02             	cmp    $0x2,%eax
+    1a55:	         /-- 74 32                	je     1a89 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x55>
+    1a57:	         |   83 f8 02             	cmp    $0x2,%eax
+    1a5a:	/--------|-- 7f 67                	jg     1ac3 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+    1a5c:	|        |   85 c0                	test   %eax,%eax
+    1a5e:	|     /--|-- 74 4d                	je     1aad <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x79>
+    1a60:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    1a63:	+-----|--|-- 75 5e                	jne    1ac3 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_ok(*ok_);
+    1a65:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a69:	|     |  |   48 83 c0 08          	add    $0x8,%rax
+    1a6d:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    1a70:	|     |  |   e8 fb 02 00 00       	call   1d70 <nel::Element<void*>::operator*() const>
+    1a75:	|     |  |   48 89 c2             	mov    %rax,%rdx
+    1a78:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a7c:	|     |  |   48 89 d6             	mov    %rdx,%rsi
+    1a7f:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    1a82:	|     |  |   e8 5b ff ff ff       	call   19e2 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>
+    1a87:	|  /--|--|-- eb 50                	jmp    1ad9 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    return on_err(*err_);
+    1a89:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a8d:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    1a91:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1a94:	|  |  |      e8 f1 02 00 00       	call   1d8a <nel::Element<nel::heaped::AllocError>::operator*() const>
+    1a99:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    1a9c:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1aa0:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    1aa3:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1aa6:	|  |  |      e8 4b ff ff ff       	call   19f6 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>
+    1aab:	|  +--|----- eb 2c                	jmp    1ad9 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    nel::panic("invalid Result", ctx);
+    1aad:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ab1:	|  |         48 89 c6             	mov    %rax,%rsi
+    1ab4:	|  |         48 8d 05 5c 15 00 00 	lea    0x155c(%rip),%rax        # 3017 <nel::None+0x12>
+    1abb:	|  |         48 89 c7             	mov    %rax,%rdi
+    1abe:	|  |         e8 b8 06 00 00       	call   217b <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    1ac3:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ac7:	   |         48 89 c6             	mov    %rax,%rsi
+    1aca:	   |         48 8d 05 55 15 00 00 	lea    0x1555(%rip),%rax        # 3026 <nel::None+0x21>
+    1ad1:	   |         48 89 c7             	mov    %rax,%rdi
+    1ad4:	   |         e8 a2 06 00 00       	call   217b <nel::panic(char const*, nel::Context const&)>
+        }
+    1ad9:	   \-------> c9                   	leave
+    1ada:	             c3                   	ret
+
+0000000000001adb <nel::Element<U8Buf<256ul> >* nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::create<U8Buf<256ul> >(U8Buf<256ul>&&)>:
+        static ElementT *create(Args &&...args)
+    1adb:	       55                   	push   %rbp
+    1adc:	       48 89 e5             	mov    %rsp,%rbp
+    1adf:	       53                   	push   %rbx
+    1ae0:	       48 83 ec 68          	sub    $0x68,%rsp
+    1ae4:	       48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+            auto r = Allocator::try_malloc(alignof(ElementT), sizeof(ElementT));
+    1ae8:	       48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    1aec:	       ba 00 01 00 00       	mov    $0x100,%edx
+    1af1:	       be 01 00 00 00       	mov    $0x1,%esi
+    1af6:	       48 89 c7             	mov    %rax,%rdi
+    1af9:	       e8 89 f9 ff ff       	call   1487 <nel::heaped::Malloc::try_malloc(unsigned long, unsigned long)>
+            if (r.is_err()) { return nullptr; }
+    1afe:	       48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    1b02:	       b9 3f 00 00 00       	mov    $0x3f,%ecx
+    1b07:	       48 8d 15 64 15 00 00 	lea    0x1564(%rip),%rdx        # 3072 <nel::None+0x6d>
+    1b0e:	       48 8d 35 73 15 00 00 	lea    0x1573(%rip),%rsi        # 3088 <nel::None+0x83>
+    1b15:	       48 89 c7             	mov    %rax,%rdi
+    1b18:	       e8 33 f9 ff ff       	call   1450 <nel::Context::Context(char const*, char const*, int)>
+    1b1d:	       48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    1b21:	       48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    1b25:	       48 89 d6             	mov    %rdx,%rsi
+    1b28:	       48 89 c7             	mov    %rax,%rdi
+    1b2b:	       e8 da fe ff ff       	call   1a0a <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>
+    1b30:	       84 c0                	test   %al,%al
+    1b32:	   /-- 74 07                	je     1b3b <nel::Element<U8Buf<256ul> >* nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::create<U8Buf<256ul> >(U8Buf<256ul>&&)+0x60>
+    1b34:	   |   bb 00 00 00 00       	mov    $0x0,%ebx
+    1b39:	/--|-- eb 59                	jmp    1b94 <nel::Element<U8Buf<256ul> >* nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::create<U8Buf<256ul> >(U8Buf<256ul>&&)+0xb9>
+            return new (r.unwrap()) ElementT(forward<Args>(args)...);
+    1b3b:	|  \-> 48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1b3f:	|      b9 40 00 00 00       	mov    $0x40,%ecx
+    1b44:	|      48 8d 15 27 15 00 00 	lea    0x1527(%rip),%rdx        # 3072 <nel::None+0x6d>
+    1b4b:	|      48 8d 35 36 15 00 00 	lea    0x1536(%rip),%rsi        # 3088 <nel::None+0x83>
+    1b52:	|      48 89 c7             	mov    %rax,%rdi
+    1b55:	|      e8 f6 f8 ff ff       	call   1450 <nel::Context::Context(char const*, char const*, int)>
+    1b5a:	|      48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    1b5e:	|      48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    1b62:	|      48 89 d6             	mov    %rdx,%rsi
+    1b65:	|      48 89 c7             	mov    %rax,%rdi
+    1b68:	|      e8 83 02 00 00       	call   1df0 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+    1b6d:	|      48 89 c6             	mov    %rax,%rsi
+    1b70:	|      bf 00 01 00 00       	mov    $0x100,%edi
+    1b75:	|      e8 c4 f8 ff ff       	call   143e <operator new(unsigned long, void*)>
+    1b7a:	|      48 89 c3             	mov    %rax,%rbx
+    1b7d:	|      48 8b 45 98          	mov    -0x68(%rbp),%rax
+    1b81:	|      48 89 c7             	mov    %rax,%rdi
+    1b84:	|      e8 39 01 00 00       	call   1cc2 <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    1b89:	|      48 89 c6             	mov    %rax,%rsi
+    1b8c:	|      48 89 df             	mov    %rbx,%rdi
+    1b8f:	|      e8 8e 02 00 00       	call   1e22 <nel::Element<U8Buf<256ul> >::Element(U8Buf<256ul>&&)>
+        }
+    1b94:	\----> 48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    1b98:	       48 89 c7             	mov    %rax,%rdi
+    1b9b:	       e8 96 fc ff ff       	call   1836 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+    1ba0:	       48 89 d8             	mov    %rbx,%rax
+    1ba3:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1ba7:	       c9                   	leave
+    1ba8:	       c3                   	ret
+
+0000000000001ba9 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::Err(U8Buf<256ul>&&)>:
+        constexpr static Result Err(E &&val)
+    1ba9:	55                   	push   %rbp
+    1baa:	48 89 e5             	mov    %rsp,%rbp
+    1bad:	48 83 ec 10          	sub    $0x10,%rsp
+    1bb1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1bb5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<E>(val));
+    1bb9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bbd:	48 89 c7             	mov    %rax,%rdi
+    1bc0:	e8 fd 00 00 00       	call   1cc2 <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    1bc5:	48 89 c2             	mov    %rax,%rdx
+    1bc8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bcc:	48 89 d6             	mov    %rdx,%rsi
+    1bcf:	48 89 c7             	mov    %rax,%rdi
+    1bd2:	e8 7f 02 00 00       	call   1e56 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::Result(nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::Phantom<(nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::Tag)2>, U8Buf<256ul>&&)>
+        }
+    1bd7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bdb:	c9                   	leave
+    1bdc:	c3                   	ret
+    1bdd:	90                   	nop
+
+0000000000001bde <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::Box(nel::Element<U8Buf<256ul> >*)>:
+        constexpr Box(ElementT *const p)
+    1bde:	55                   	push   %rbp
+    1bdf:	48 89 e5             	mov    %rsp,%rbp
+    1be2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1be6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(p)
+    1bea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bee:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1bf2:	48 89 10             	mov    %rdx,(%rax)
+        }
+    1bf5:	90                   	nop
+    1bf6:	5d                   	pop    %rbp
+    1bf7:	c3                   	ret
+
+0000000000001bf8 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::~Box()>:
+        constexpr ~Box(void)
+    1bf8:	55                   	push   %rbp
+    1bf9:	48 89 e5             	mov    %rsp,%rbp
+    1bfc:	48 83 ec 10          	sub    $0x10,%rsp
+    1c00:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            destroy(value_);
+    1c04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c08:	48 8b 00             	mov    (%rax),%rax
+    1c0b:	48 89 c7             	mov    %rax,%rdi
+    1c0e:	e8 84 02 00 00       	call   1e97 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::destroy(nel::Element<U8Buf<256ul> >*)>
+        }
+    1c13:	90                   	nop
+    1c14:	c9                   	leave
+    1c15:	c3                   	ret
+
+0000000000001c16 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&& nel::move<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> >(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel is to not need std.
+ */
+template<typename T>
+constexpr T &&move(T &&v)
+    1c16:	55                   	push   %rbp
+    1c17:	48 89 e5             	mov    %rsp,%rbp
+    1c1a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<T &&>(v);
+    1c1e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1c22:	5d                   	pop    %rbp
+    1c23:	c3                   	ret
+
+0000000000001c24 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::Ok(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)>:
+        constexpr static Result Ok(T &&val)
+    1c24:	55                   	push   %rbp
+    1c25:	48 89 e5             	mov    %rsp,%rbp
+    1c28:	48 83 ec 10          	sub    $0x10,%rsp
+    1c2c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1c30:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<T>(val));
+    1c34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c38:	48 89 c7             	mov    %rax,%rdi
+    1c3b:	e8 18 00 00 00       	call   1c58 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&& nel::forward<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> >(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&)>
+    1c40:	48 89 c2             	mov    %rax,%rdx
+    1c43:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c47:	48 89 d6             	mov    %rdx,%rsi
+    1c4a:	48 89 c7             	mov    %rax,%rdi
+    1c4d:	e8 80 02 00 00       	call   1ed2 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::Result(nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::Phantom<(nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::Tag)1>, nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)>
+        }
+    1c52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c56:	c9                   	leave
+    1c57:	c3                   	ret
+
+0000000000001c58 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&& nel::forward<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> >(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel so to not need std.
+ */
+template<typename U, typename T>
+constexpr U &&forward(T &t)
+    1c58:	55                   	push   %rbp
+    1c59:	48 89 e5             	mov    %rsp,%rbp
+    1c5c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<U &&>(t);
+    1c60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1c64:	5d                   	pop    %rbp
+    1c65:	c3                   	ret
+
+0000000000001c66 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::Box(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)>:
+        constexpr Box(Box &&o)
+    1c66:	55                   	push   %rbp
+    1c67:	48 89 e5             	mov    %rsp,%rbp
+    1c6a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1c6e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            value_ = o.value_;
+    1c72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c76:	48 8b 10             	mov    (%rax),%rdx
+    1c79:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c7d:	48 89 10             	mov    %rdx,(%rax)
+            o.value_ = nullptr;
+    1c80:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c84:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        }
+    1c8b:	90                   	nop
+    1c8c:	5d                   	pop    %rbp
+    1c8d:	c3                   	ret
+
+0000000000001c8e <nel::Element<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> >::operator*()>:
+        constexpr Type const &operator*(void) const
+        {
+            return ref();
+        }
+
+        constexpr Type &operator*(void)
+    1c8e:	55                   	push   %rbp
+    1c8f:	48 89 e5             	mov    %rsp,%rbp
+    1c92:	48 83 ec 10          	sub    $0x10,%rsp
+    1c96:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    1c9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c9e:	48 89 c7             	mov    %rax,%rdi
+    1ca1:	e8 6e 02 00 00       	call   1f14 <nel::Element<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> >::ref()>
+        }
+    1ca6:	c9                   	leave
+    1ca7:	c3                   	ret
+
+0000000000001ca8 <nel::Element<U8Buf<256ul> >::operator*()>:
+        constexpr Type &operator*(void)
+    1ca8:	55                   	push   %rbp
+    1ca9:	48 89 e5             	mov    %rsp,%rbp
+    1cac:	48 83 ec 10          	sub    $0x10,%rsp
+    1cb0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    1cb4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cb8:	48 89 c7             	mov    %rax,%rdi
+    1cbb:	e8 62 02 00 00       	call   1f22 <nel::Element<U8Buf<256ul> >::ref()>
+        }
+    1cc0:	c9                   	leave
+    1cc1:	c3                   	ret
+
+0000000000001cc2 <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>:
+constexpr U &&forward(T &t)
+    1cc2:	55                   	push   %rbp
+    1cc3:	48 89 e5             	mov    %rsp,%rbp
+    1cc6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    1cca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1cce:	5d                   	pop    %rbp
+    1ccf:	c3                   	ret
+
+0000000000001cd0 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>:
+constexpr U &&forward(T &t)
+    1cd0:	55                   	push   %rbp
+    1cd1:	48 89 e5             	mov    %rsp,%rbp
+    1cd4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    1cd8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1cdc:	5d                   	pop    %rbp
+    1cdd:	c3                   	ret
+
+0000000000001cde <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    1cde:	55                   	push   %rbp
+    1cdf:	48 89 e5             	mov    %rsp,%rbp
+    1ce2:	53                   	push   %rbx
+    1ce3:	48 83 ec 18          	sub    $0x18,%rsp
+    1ce7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1ceb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    1cef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cf3:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    1cf9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cfd:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    1d01:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d05:	48 89 c7             	mov    %rax,%rdi
+    1d08:	e8 c3 ff ff ff       	call   1cd0 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    1d0d:	48 89 c6             	mov    %rax,%rsi
+    1d10:	48 89 df             	mov    %rbx,%rdi
+    1d13:	e8 18 02 00 00       	call   1f30 <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>
+        }
+    1d18:	90                   	nop
+    1d19:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1d1d:	c9                   	leave
+    1d1e:	c3                   	ret
+
+0000000000001d1f <void* const& nel::forward<void* const&, void* const>(void* const&)>:
+constexpr U &&forward(T &t)
+    1d1f:	55                   	push   %rbp
+    1d20:	48 89 e5             	mov    %rsp,%rbp
+    1d23:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    1d27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1d2b:	5d                   	pop    %rbp
+    1d2c:	c3                   	ret
+    1d2d:	90                   	nop
+
+0000000000001d2e <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>:
+        constexpr Result(Phantom<Tag::OK> const, Args &&...args)
+    1d2e:	55                   	push   %rbp
+    1d2f:	48 89 e5             	mov    %rsp,%rbp
+    1d32:	53                   	push   %rbx
+    1d33:	48 83 ec 18          	sub    $0x18,%rsp
+    1d37:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1d3b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    1d3f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d43:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<Args>(args)...)
+    1d49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d4d:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    1d51:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d55:	48 89 c7             	mov    %rax,%rdi
+    1d58:	e8 c2 ff ff ff       	call   1d1f <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    1d5d:	48 89 c6             	mov    %rax,%rsi
+    1d60:	48 89 df             	mov    %rbx,%rdi
+    1d63:	e8 f0 01 00 00       	call   1f58 <nel::Element<void*>::Element<void* const&>(void* const&)>
+        }
+    1d68:	90                   	nop
+    1d69:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1d6d:	c9                   	leave
+    1d6e:	c3                   	ret
+    1d6f:	90                   	nop
+
+0000000000001d70 <nel::Element<void*>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    1d70:	55                   	push   %rbp
+    1d71:	48 89 e5             	mov    %rsp,%rbp
+    1d74:	48 83 ec 10          	sub    $0x10,%rsp
+    1d78:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    1d7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d80:	48 89 c7             	mov    %rax,%rdi
+    1d83:	e8 fa 01 00 00       	call   1f82 <nel::Element<void*>::ref() const>
+        }
+    1d88:	c9                   	leave
+    1d89:	c3                   	ret
+
+0000000000001d8a <nel::Element<nel::heaped::AllocError>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    1d8a:	55                   	push   %rbp
+    1d8b:	48 89 e5             	mov    %rsp,%rbp
+    1d8e:	48 83 ec 10          	sub    $0x10,%rsp
+    1d92:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    1d96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d9a:	48 89 c7             	mov    %rax,%rdi
+    1d9d:	e8 ee 01 00 00       	call   1f90 <nel::Element<nel::heaped::AllocError>::ref() const>
+        }
+    1da2:	c9                   	leave
+    1da3:	c3                   	ret
+
+0000000000001da4 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>:
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    1da4:	55                   	push   %rbp
+    1da5:	48 89 e5             	mov    %rsp,%rbp
+    1da8:	48 83 ec 10          	sub    $0x10,%rsp
+    1dac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1db0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1db4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1db8:	48 89 c7             	mov    %rax,%rdi
+    1dbb:	e8 de 01 00 00       	call   1f9e <void*&& nel::forward<void*, void*>(void*&)>
+    1dc0:	48 8b 00             	mov    (%rax),%rax
+    1dc3:	c9                   	leave
+    1dc4:	c3                   	ret
+    1dc5:	90                   	nop
+
+0000000000001dc6 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>:
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    1dc6:	55                   	push   %rbp
+    1dc7:	48 89 e5             	mov    %rsp,%rbp
+    1dca:	48 83 ec 10          	sub    $0x10,%rsp
+    1dce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1dd2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1dd6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dda:	48 8b 00             	mov    (%rax),%rax
+    1ddd:	48 89 c6             	mov    %rax,%rsi
+    1de0:	48 8d 05 26 12 00 00 	lea    0x1226(%rip),%rax        # 300d <nel::None+0x8>
+    1de7:	48 89 c7             	mov    %rax,%rdi
+    1dea:	e8 8c 03 00 00       	call   217b <nel::panic(char const*, nel::Context const&)>
+    1def:	90                   	nop
+
+0000000000001df0 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>:
+        constexpr T unwrap(Context const &ctx = Context())
+    1df0:	55                   	push   %rbp
+    1df1:	48 89 e5             	mov    %rsp,%rbp
+    1df4:	48 83 ec 20          	sub    $0x20,%rsp
+    1df8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1dfc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    1e00:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e04:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    1e08:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1e0c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    1e10:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    1e14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e18:	48 89 c7             	mov    %rax,%rdi
+    1e1b:	e8 8c 01 00 00       	call   1fac <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>
+        }
+    1e20:	c9                   	leave
+    1e21:	c3                   	ret
+
+0000000000001e22 <nel::Element<U8Buf<256ul> >::Element(U8Buf<256ul>&&)>:
+        constexpr Element(Type &&val)
+    1e22:	55                   	push   %rbp
+    1e23:	48 89 e5             	mov    %rsp,%rbp
+    1e26:	53                   	push   %rbx
+    1e27:	48 83 ec 18          	sub    $0x18,%rsp
+    1e2b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1e2f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : value_(forward<Type>(val))
+    1e33:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    1e37:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e3b:	48 89 c7             	mov    %rax,%rdi
+    1e3e:	e8 7f fe ff ff       	call   1cc2 <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    1e43:	48 89 c6             	mov    %rax,%rsi
+    1e46:	48 89 df             	mov    %rbx,%rdi
+    1e49:	e8 28 02 00 00       	call   2076 <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>
+        }
+    1e4e:	90                   	nop
+    1e4f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1e53:	c9                   	leave
+    1e54:	c3                   	ret
+    1e55:	90                   	nop
+
+0000000000001e56 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::Result(nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::Phantom<(nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::Tag)2>, U8Buf<256ul>&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    1e56:	55                   	push   %rbp
+    1e57:	48 89 e5             	mov    %rsp,%rbp
+    1e5a:	53                   	push   %rbx
+    1e5b:	48 83 ec 18          	sub    $0x18,%rsp
+    1e5f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1e63:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    1e67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e6b:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    1e71:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e75:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    1e79:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e7d:	48 89 c7             	mov    %rax,%rdi
+    1e80:	e8 3d fe ff ff       	call   1cc2 <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    1e85:	48 89 c6             	mov    %rax,%rsi
+    1e88:	48 89 df             	mov    %rbx,%rdi
+    1e8b:	e8 92 ff ff ff       	call   1e22 <nel::Element<U8Buf<256ul> >::Element(U8Buf<256ul>&&)>
+        }
+    1e90:	90                   	nop
+    1e91:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1e95:	c9                   	leave
+    1e96:	c3                   	ret
+
+0000000000001e97 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::destroy(nel::Element<U8Buf<256ul> >*)>:
+        static void destroy(ElementT *const p)
+    1e97:	       55                   	push   %rbp
+    1e98:	       48 89 e5             	mov    %rsp,%rbp
+    1e9b:	       48 83 ec 10          	sub    $0x10,%rsp
+    1e9f:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            if (p == nullptr) { return; }
+    1ea3:	       48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1ea8:	/----- 74 24                	je     1ece <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::destroy(nel::Element<U8Buf<256ul> >*)+0x37>
+            p->~ElementT();
+    1eaa:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1eae:	|      48 89 c7             	mov    %rax,%rdi
+    1eb1:	|      e8 8e fa ff ff       	call   1944 <nel::Element<U8Buf<256ul> >::~Element()>
+            Allocator::free(p, alignof(ElementT), sizeof(ElementT));
+    1eb6:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1eba:	|      ba 00 01 00 00       	mov    $0x100,%edx
+    1ebf:	|      be 01 00 00 00       	mov    $0x1,%esi
+    1ec4:	|      48 89 c7             	mov    %rax,%rdi
+    1ec7:	|      e8 c5 f6 ff ff       	call   1591 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>
+    1ecc:	|  /-- eb 01                	jmp    1ecf <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::destroy(nel::Element<U8Buf<256ul> >*)+0x38>
+            if (p == nullptr) { return; }
+    1ece:	\--|-> 90                   	nop
+        }
+    1ecf:	   \-> c9                   	leave
+    1ed0:	       c3                   	ret
+    1ed1:	       90                   	nop
+
+0000000000001ed2 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::Result(nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::Phantom<(nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::Tag)1>, nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)>:
+        constexpr Result(Phantom<Tag::OK> const, T &&v)
+    1ed2:	55                   	push   %rbp
+    1ed3:	48 89 e5             	mov    %rsp,%rbp
+    1ed6:	53                   	push   %rbx
+    1ed7:	48 83 ec 18          	sub    $0x18,%rsp
+    1edb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1edf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    1ee3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ee7:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<T>(v))
+    1eed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ef1:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    1ef5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ef9:	48 89 c7             	mov    %rax,%rdi
+    1efc:	e8 57 fd ff ff       	call   1c58 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&& nel::forward<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> >(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&)>
+    1f01:	48 89 c6             	mov    %rax,%rsi
+    1f04:	48 89 df             	mov    %rbx,%rdi
+    1f07:	e8 96 01 00 00       	call   20a2 <nel::Element<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> >::Element(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)>
+        }
+    1f0c:	90                   	nop
+    1f0d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1f11:	c9                   	leave
+    1f12:	c3                   	ret
+    1f13:	90                   	nop
+
+0000000000001f14 <nel::Element<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> >::ref()>:
+        constexpr Type &ref(void)
+    1f14:	55                   	push   %rbp
+    1f15:	48 89 e5             	mov    %rsp,%rbp
+    1f18:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    1f1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1f20:	5d                   	pop    %rbp
+    1f21:	c3                   	ret
+
+0000000000001f22 <nel::Element<U8Buf<256ul> >::ref()>:
+        constexpr Type &ref(void)
+    1f22:	55                   	push   %rbp
+    1f23:	48 89 e5             	mov    %rsp,%rbp
+    1f26:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    1f2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1f2e:	5d                   	pop    %rbp
+    1f2f:	c3                   	ret
+
+0000000000001f30 <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>:
+        constexpr Element(Type &&val)
+    1f30:	55                   	push   %rbp
+    1f31:	48 89 e5             	mov    %rsp,%rbp
+    1f34:	48 83 ec 10          	sub    $0x10,%rsp
+    1f38:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f3c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    1f40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f44:	48 89 c7             	mov    %rax,%rdi
+    1f47:	e8 84 fd ff ff       	call   1cd0 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    1f4c:	8b 10                	mov    (%rax),%edx
+    1f4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f52:	89 10                	mov    %edx,(%rax)
+        }
+    1f54:	90                   	nop
+    1f55:	c9                   	leave
+    1f56:	c3                   	ret
+    1f57:	90                   	nop
+
+0000000000001f58 <nel::Element<void*>::Element<void* const&>(void* const&)>:
+        constexpr Element(Args &&...args)
+    1f58:	55                   	push   %rbp
+    1f59:	48 89 e5             	mov    %rsp,%rbp
+    1f5c:	48 83 ec 10          	sub    $0x10,%rsp
+    1f60:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f64:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Args>(args)...)
+    1f68:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f6c:	48 89 c7             	mov    %rax,%rdi
+    1f6f:	e8 ab fd ff ff       	call   1d1f <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    1f74:	48 8b 10             	mov    (%rax),%rdx
+    1f77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f7b:	48 89 10             	mov    %rdx,(%rax)
+        }
+    1f7e:	90                   	nop
+    1f7f:	c9                   	leave
+    1f80:	c3                   	ret
+    1f81:	90                   	nop
+
+0000000000001f82 <nel::Element<void*>::ref() const>:
+        constexpr Type const &ref(void) const
+    1f82:	55                   	push   %rbp
+    1f83:	48 89 e5             	mov    %rsp,%rbp
+    1f86:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    1f8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1f8e:	5d                   	pop    %rbp
+    1f8f:	c3                   	ret
+
+0000000000001f90 <nel::Element<nel::heaped::AllocError>::ref() const>:
+        constexpr Type const &ref(void) const
+    1f90:	55                   	push   %rbp
+    1f91:	48 89 e5             	mov    %rsp,%rbp
+    1f94:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    1f98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1f9c:	5d                   	pop    %rbp
+    1f9d:	c3                   	ret
+
+0000000000001f9e <void*&& nel::forward<void*, void*>(void*&)>:
+constexpr U &&forward(T &t)
+    1f9e:	55                   	push   %rbp
+    1f9f:	48 89 e5             	mov    %rsp,%rbp
+    1fa2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    1fa6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1faa:	5d                   	pop    %rbp
+    1fab:	c3                   	ret
+
+0000000000001fac <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    1fac:	             55                   	push   %rbp
+    1fad:	             48 89 e5             	mov    %rsp,%rbp
+    1fb0:	             48 83 ec 30          	sub    $0x30,%rsp
+    1fb4:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1fb8:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1fbc:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    1fc0:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    1fc4:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1fc8:	             8b 00                	mov    (%rax),%eax
+    1fca:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    1fcd:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1fd1:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    1fd7:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    1fdb:	         /-- 74 3e                	je     201b <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x6f>
+    1fdd:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    1fe1:	/--------|-- 7f 7a                	jg     205d <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+    1fe3:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1fe7:	|  /-----|-- 74 5e                	je     2047 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x9b>
+    1fe9:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    1fed:	+--|-----|-- 75 6e                	jne    205d <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+                    return on_ok(forward<T>(*ok_));
+    1fef:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ff3:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    1ff7:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    1ffa:	|  |     |   e8 d7 00 00 00       	call   20d6 <nel::Element<void*>::operator*()>
+    1fff:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2002:	|  |     |   e8 97 ff ff ff       	call   1f9e <void*&& nel::forward<void*, void*>(void*&)>
+    2007:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    200a:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    200e:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    2011:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2014:	|  |     |   e8 8b fd ff ff       	call   1da4 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>
+    2019:	|  |  /--|-- eb 58                	jmp    2073 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    return on_err(forward<E>(*err_));
+    201b:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    201f:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    2023:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2026:	|  |  |      e8 c5 00 00 00       	call   20f0 <nel::Element<nel::heaped::AllocError>::operator*()>
+    202b:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    202e:	|  |  |      e8 9d fc ff ff       	call   1cd0 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    2033:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    2036:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    203a:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    203d:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2040:	|  |  |      e8 81 fd ff ff       	call   1dc6 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>
+    2045:	|  |  +----- eb 2c                	jmp    2073 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    nel::panic("invalid Result", ctx);
+    2047:	|  \--|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    204b:	|     |      48 89 c6             	mov    %rax,%rsi
+    204e:	|     |      48 8d 05 c2 0f 00 00 	lea    0xfc2(%rip),%rax        # 3017 <nel::None+0x12>
+    2055:	|     |      48 89 c7             	mov    %rax,%rdi
+    2058:	|     |      e8 1e 01 00 00       	call   217b <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    205d:	\-----|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2061:	      |      48 89 c6             	mov    %rax,%rsi
+    2064:	      |      48 8d 05 bb 0f 00 00 	lea    0xfbb(%rip),%rax        # 3026 <nel::None+0x21>
+    206b:	      |      48 89 c7             	mov    %rax,%rdi
+    206e:	      |      e8 08 01 00 00       	call   217b <nel::panic(char const*, nel::Context const&)>
+        }
+    2073:	      \----> c9                   	leave
+    2074:	             c3                   	ret
+    2075:	             90                   	nop
+
+0000000000002076 <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>:
+        constexpr U8Buf(U8Buf &&o)
+    2076:	55                   	push   %rbp
+    2077:	48 89 e5             	mov    %rsp,%rbp
+    207a:	48 83 ec 10          	sub    $0x10,%rsp
+    207e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2082:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            nel::elem::move(data_, o.data_, N);
+    2086:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    208a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    208e:	ba 00 01 00 00       	mov    $0x100,%edx
+    2093:	48 89 ce             	mov    %rcx,%rsi
+    2096:	48 89 c7             	mov    %rax,%rdi
+    2099:	e8 ef 01 00 00       	call   228d <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+        }
+    209e:	90                   	nop
+    209f:	c9                   	leave
+    20a0:	c3                   	ret
+    20a1:	90                   	nop
+
+00000000000020a2 <nel::Element<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> >::Element(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)>:
+        constexpr Element(Type &&val)
+    20a2:	55                   	push   %rbp
+    20a3:	48 89 e5             	mov    %rsp,%rbp
+    20a6:	53                   	push   %rbx
+    20a7:	48 83 ec 18          	sub    $0x18,%rsp
+    20ab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    20af:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : value_(forward<Type>(val))
+    20b3:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    20b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    20bb:	48 89 c7             	mov    %rax,%rdi
+    20be:	e8 95 fb ff ff       	call   1c58 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&& nel::forward<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> >(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&)>
+    20c3:	48 89 c6             	mov    %rax,%rsi
+    20c6:	48 89 df             	mov    %rbx,%rdi
+    20c9:	e8 98 fb ff ff       	call   1c66 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::Box(nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>&&)>
+        }
+    20ce:	90                   	nop
+    20cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    20d3:	c9                   	leave
+    20d4:	c3                   	ret
+    20d5:	90                   	nop
+
+00000000000020d6 <nel::Element<void*>::operator*()>:
+        constexpr Type &operator*(void)
+    20d6:	55                   	push   %rbp
+    20d7:	48 89 e5             	mov    %rsp,%rbp
+    20da:	48 83 ec 10          	sub    $0x10,%rsp
+    20de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    20e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20e6:	48 89 c7             	mov    %rax,%rdi
+    20e9:	e8 1c 00 00 00       	call   210a <nel::Element<void*>::ref()>
+        }
+    20ee:	c9                   	leave
+    20ef:	c3                   	ret
+
+00000000000020f0 <nel::Element<nel::heaped::AllocError>::operator*()>:
+        constexpr Type &operator*(void)
+    20f0:	55                   	push   %rbp
+    20f1:	48 89 e5             	mov    %rsp,%rbp
+    20f4:	48 83 ec 10          	sub    $0x10,%rsp
+    20f8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    20fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2100:	48 89 c7             	mov    %rax,%rdi
+    2103:	e8 10 00 00 00       	call   2118 <nel::Element<nel::heaped::AllocError>::ref()>
+        }
+    2108:	c9                   	leave
+    2109:	c3                   	ret
+
+000000000000210a <nel::Element<void*>::ref()>:
+        constexpr Type &ref(void)
+    210a:	55                   	push   %rbp
+    210b:	48 89 e5             	mov    %rsp,%rbp
+    210e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2112:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2116:	5d                   	pop    %rbp
+    2117:	c3                   	ret
+
+0000000000002118 <nel::Element<nel::heaped::AllocError>::ref()>:
+        constexpr Type &ref(void)
+    2118:	55                   	push   %rbp
+    2119:	48 89 e5             	mov    %rsp,%rbp
+    211c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2120:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2124:	5d                   	pop    %rbp
+    2125:	c3                   	ret
+
+0000000000002126 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    2126:	55                   	push   %rbp
+    2127:	48 89 e5             	mov    %rsp,%rbp
+    std::abort();
+    212a:	e8 11 ef ff ff       	call   1040 <abort@plt>
+
+000000000000212f <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    212f:	55                   	push   %rbp
+    2130:	48 89 e5             	mov    %rsp,%rbp
+    2133:	48 83 ec 10          	sub    $0x10,%rsp
+    2137:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    213b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    213f:	48 8b 30             	mov    (%rax),%rsi
+    2142:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2146:	8b 48 10             	mov    0x10(%rax),%ecx
+    2149:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    214d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2151:	48 8b 05 08 3f 00 00 	mov    0x3f08(%rip),%rax        # 6060 <stderr@GLIBC_2.2.5>
+    2158:	4c 8d 0d 3d 0f 00 00 	lea    0xf3d(%rip),%r9        # 309c <nel::None+0x97>
+    215f:	49 89 f0             	mov    %rsi,%r8
+    2162:	48 8d 35 39 0f 00 00 	lea    0xf39(%rip),%rsi        # 30a2 <nel::None+0x9d>
+    2169:	48 89 c7             	mov    %rax,%rdi
+    216c:	b8 00 00 00 00       	mov    $0x0,%eax
+    2171:	e8 1a ef ff ff       	call   1090 <fprintf@plt>
+    abort();
+    2176:	e8 ab ff ff ff       	call   2126 <nel::abort()>
+
+000000000000217b <nel::panic(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    217b:	55                   	push   %rbp
+    217c:	48 89 e5             	mov    %rsp,%rbp
+    217f:	48 83 ec 10          	sub    $0x10,%rsp
+    2183:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2187:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    218b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    218f:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    2192:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2196:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    2199:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    219d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    21a1:	48 8b 05 b8 3e 00 00 	mov    0x3eb8(%rip),%rax        # 6060 <stderr@GLIBC_2.2.5>
+    21a8:	48 83 ec 08          	sub    $0x8,%rsp
+    21ac:	ff 75 f8             	push   -0x8(%rbp)
+    21af:	4c 8d 0d e6 0e 00 00 	lea    0xee6(%rip),%r9        # 309c <nel::None+0x97>
+    21b6:	49 89 f0             	mov    %rsi,%r8
+    21b9:	48 8d 35 f3 0e 00 00 	lea    0xef3(%rip),%rsi        # 30b3 <nel::None+0xae>
+    21c0:	48 89 c7             	mov    %rax,%rdi
+    21c3:	b8 00 00 00 00       	mov    $0x0,%eax
+    21c8:	e8 c3 ee ff ff       	call   1090 <fprintf@plt>
+    21cd:	48 83 c4 10          	add    $0x10,%rsp
+            "PANIC",
+            msg);
+    abort();
+    21d1:	e8 50 ff ff ff       	call   2126 <nel::abort()>
+
+00000000000021d6 <nel::assert_fail(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    21d6:	55                   	push   %rbp
+    21d7:	48 89 e5             	mov    %rsp,%rbp
+    21da:	48 83 ec 10          	sub    $0x10,%rsp
+    21de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    21e2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    21e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    21ea:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    21ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    21f1:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    21f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    21f8:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    21fc:	48 8b 05 5d 3e 00 00 	mov    0x3e5d(%rip),%rax        # 6060 <stderr@GLIBC_2.2.5>
+    2203:	48 83 ec 08          	sub    $0x8,%rsp
+    2207:	ff 75 f8             	push   -0x8(%rbp)
+    220a:	4c 8d 0d b7 0e 00 00 	lea    0xeb7(%rip),%r9        # 30c8 <nel::None+0xc3>
+    2211:	49 89 f0             	mov    %rsi,%r8
+    2214:	48 8d 35 98 0e 00 00 	lea    0xe98(%rip),%rsi        # 30b3 <nel::None+0xae>
+    221b:	48 89 c7             	mov    %rax,%rdi
+    221e:	b8 00 00 00 00       	mov    $0x0,%eax
+    2223:	e8 68 ee ff ff       	call   1090 <fprintf@plt>
+    2228:	48 83 c4 10          	add    $0x10,%rsp
+            "ASSERT FAIL",
+            msg);
+    abort();
+    222c:	e8 f5 fe ff ff       	call   2126 <nel::abort()>
+
+0000000000002231 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    2231:	55                   	push   %rbp
+    2232:	48 89 e5             	mov    %rsp,%rbp
+    2235:	48 83 ec 20          	sub    $0x20,%rsp
+    2239:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    223d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2241:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    2245:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2249:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    224d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2251:	48 89 ce             	mov    %rcx,%rsi
+    2254:	48 89 c7             	mov    %rax,%rdi
+    2257:	e8 44 ee ff ff       	call   10a0 <memcpy@plt>
+}
+    225c:	90                   	nop
+    225d:	c9                   	leave
+    225e:	c3                   	ret
+
+000000000000225f <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    225f:	55                   	push   %rbp
+    2260:	48 89 e5             	mov    %rsp,%rbp
+    2263:	48 83 ec 20          	sub    $0x20,%rsp
+    2267:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    226b:	89 f0                	mov    %esi,%eax
+    226d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2271:	88 45 f4             	mov    %al,-0xc(%rbp)
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    2274:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    2278:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    227c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2280:	89 ce                	mov    %ecx,%esi
+    2282:	48 89 c7             	mov    %rax,%rdi
+    2285:	e8 d6 ed ff ff       	call   1060 <memset@plt>
+}
+    228a:	90                   	nop
+    228b:	c9                   	leave
+    228c:	c3                   	ret
+
+000000000000228d <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    228d:	55                   	push   %rbp
+    228e:	48 89 e5             	mov    %rsp,%rbp
+    2291:	48 83 ec 20          	sub    $0x20,%rsp
+    2295:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2299:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    229d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    //     *id = *is;
+    // }
+    // for (uint8_t *id = d, *is = s, *const e = (d + n); id != e; ++is, ++id) {
+    //     *is = 0xa5;
+    // }
+    copy(d, s, n);
+    22a1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    22a5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    22a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22ad:	48 89 ce             	mov    %rcx,%rsi
+    22b0:	48 89 c7             	mov    %rax,%rdi
+    22b3:	e8 79 ff ff ff       	call   2231 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    poison(s, n);
+    22b8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    22bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22c0:	48 89 d6             	mov    %rdx,%rsi
+    22c3:	48 89 c7             	mov    %rax,%rdi
+    22c6:	e8 60 07 00 00       	call   2a2b <nel::elem::poison(unsigned char*, unsigned long)>
+}
+    22cb:	90                   	nop
+    22cc:	c9                   	leave
+    22cd:	c3                   	ret
+
+00000000000022ce <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    22ce:	55                   	push   %rbp
+    22cf:	48 89 e5             	mov    %rsp,%rbp
+    22d2:	48 83 ec 20          	sub    $0x20,%rsp
+    22d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    22da:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    22de:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    std::memmove(d, s, n);
+    22e2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    22e6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    22ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22ee:	48 89 ce             	mov    %rcx,%rsi
+    22f1:	48 89 c7             	mov    %rax,%rdi
+    22f4:	e8 c7 ed ff ff       	call   10c0 <memmove@plt>
+}
+    22f9:	90                   	nop
+    22fa:	c9                   	leave
+    22fb:	c3                   	ret
+
+00000000000022fc <nel::elem::wipe(unsigned char*, unsigned long)>:
+
+void wipe(uint8_t *const d, Length const n)
+{
+    22fc:	55                   	push   %rbp
+    22fd:	48 89 e5             	mov    %rsp,%rbp
+    2300:	48 83 ec 10          	sub    $0x10,%rsp
+    2304:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2308:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    set(d, 0xa5, n);
+    230c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2310:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2314:	be a5 00 00 00       	mov    $0xa5,%esi
+    2319:	48 89 c7             	mov    %rax,%rdi
+    231c:	e8 3e ff ff ff       	call   225f <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    2321:	90                   	nop
+    2322:	c9                   	leave
+    2323:	c3                   	ret
+
+0000000000002324 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    2324:	55                   	push   %rbp
+    2325:	48 89 e5             	mov    %rsp,%rbp
+    2328:	48 83 ec 20          	sub    $0x20,%rsp
+    232c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2330:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2334:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    2338:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    233c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2340:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2344:	48 89 ce             	mov    %rcx,%rsi
+    2347:	48 89 c7             	mov    %rax,%rdi
+    234a:	e8 31 ed ff ff       	call   1080 <memcmp@plt>
+    234f:	85 c0                	test   %eax,%eax
+    2351:	0f 94 c0             	sete   %al
+}
+    2354:	c9                   	leave
+    2355:	c3                   	ret
+
+0000000000002356 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    2356:	55                   	push   %rbp
+    2357:	48 89 e5             	mov    %rsp,%rbp
+    235a:	48 83 ec 20          	sub    $0x20,%rsp
+    235e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2362:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2366:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    236a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    236e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2372:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2376:	48 89 ce             	mov    %rcx,%rsi
+    2379:	48 89 c7             	mov    %rax,%rdi
+    237c:	e8 ff ec ff ff       	call   1080 <memcmp@plt>
+    2381:	85 c0                	test   %eax,%eax
+    2383:	0f 95 c0             	setne  %al
+}
+    2386:	c9                   	leave
+    2387:	c3                   	ret
+
+0000000000002388 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>:
+
+// d[i] = p[i % 16] for i in [0, n), with normal stores:
+// the pattern once, then doubling the filled region.
+static void set_pattern(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    2388:	       55                   	push   %rbp
+    2389:	       48 89 e5             	mov    %rsp,%rbp
+    238c:	       48 83 ec 30          	sub    $0x30,%rsp
+    2390:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2394:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2398:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    Length done = (n < 16) ? n : 16;
+    239c:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    23a0:	       ba 10 00 00 00       	mov    $0x10,%edx
+    23a5:	       48 39 d0             	cmp    %rdx,%rax
+    23a8:	       48 0f 47 c2          	cmova  %rdx,%rax
+    23ac:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    copy(d, p, done);
+    23b0:	       48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    23b4:	       48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    23b8:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    23bc:	       48 89 ce             	mov    %rcx,%rsi
+    23bf:	       48 89 c7             	mov    %rax,%rdi
+    23c2:	       e8 6a fe ff ff       	call   2231 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    while (done < n) {
+    23c7:	   /-- eb 3e                	jmp    2407 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x7f>
+        Length const m = (done < n - done) ? done : n - done;
+    23c9:	/--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    23cd:	|  |   48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    23d1:	|  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    23d5:	|  |   48 39 c2             	cmp    %rax,%rdx
+    23d8:	|  |   48 0f 46 c2          	cmovbe %rdx,%rax
+    23dc:	|  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        copy(d + done, d, m);
+    23e0:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    23e4:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23e8:	|  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    23ec:	|  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    23f0:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    23f4:	|  |   48 89 c6             	mov    %rax,%rsi
+    23f7:	|  |   48 89 cf             	mov    %rcx,%rdi
+    23fa:	|  |   e8 32 fe ff ff       	call   2231 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        done += m;
+    23ff:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2403:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+    while (done < n) {
+    2407:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    240b:	|      48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    240f:	\----- 72 b8                	jb     23c9 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x41>
+    }
+}
+    2411:	       90                   	nop
+    2412:	       90                   	nop
+    2413:	       c9                   	leave
+    2414:	       c3                   	ret
+
+0000000000002415 <nel::elem::load16(unsigned char const*)>:
+static constexpr Length streaming_min = 256;
+
+typedef long long int Line16 __attribute__((vector_size(16)));
+
+static inline Line16 load16(uint8_t const *const s)
+{
+    2415:	55                   	push   %rbp
+    2416:	48 89 e5             	mov    %rsp,%rbp
+    2419:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Line16 v;
+    std::memcpy(&v, s, sizeof(v));
+    241d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2421:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2425:	48 8b 00             	mov    (%rax),%rax
+    2428:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    242c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    return v;
+    2430:	66 0f 6f 45 f0       	movdqa -0x10(%rbp),%xmm0
+}
+    2435:	5d                   	pop    %rbp
+    2436:	c3                   	ret
+
+0000000000002437 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>:
+
+static inline void stream16(uint8_t *const d, Line16 const &v)
+{
+    2437:	55                   	push   %rbp
+    2438:	48 89 e5             	mov    %rsp,%rbp
+    243b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    243f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2443:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2447:	66 0f 6f 00          	movdqa (%rax),%xmm0
+    244b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    244f:	66 0f e7 00          	movntdq %xmm0,(%rax)
+}
+    2453:	90                   	nop
+    2454:	5d                   	pop    %rbp
+    2455:	c3                   	ret
+
+0000000000002456 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    2456:	          55                   	push   %rbp
+    2457:	          48 89 e5             	mov    %rsp,%rbp
+    245a:	          48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    245e:	          48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    2462:	          48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    2466:	          48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    if (n < streaming_min) {
+    246a:	          48 81 7d 88 ff 00 00 	cmpq   $0xff,-0x78(%rbp)
+    2471:	          00 
+    2472:	      /-- 77 1c                	ja     2490 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        copy(d, s, n);
+    2474:	      |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    2478:	      |   48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    247c:	      |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2480:	      |   48 89 ce             	mov    %rcx,%rsi
+    2483:	      |   48 89 c7             	mov    %rax,%rdi
+    2486:	      |   e8 a6 fd ff ff       	call   2231 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        return;
+    248b:	/-----|-- e9 98 01 00 00       	jmp    2628 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1d2>
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2490:	|     \-> 48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2494:	|         48 f7 d8             	neg    %rax
+    2497:	|         83 e0 0f             	and    $0xf,%eax
+    249a:	|         48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    copy(d, s, head);
+    249e:	|         48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    24a2:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    24a6:	|         48 8b 45 98          	mov    -0x68(%rbp),%rax
+    24aa:	|         48 89 ce             	mov    %rcx,%rsi
+    24ad:	|         48 89 c7             	mov    %rax,%rdi
+    24b0:	|         e8 7c fd ff ff       	call   2231 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    Index i = head;
+    24b5:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    24b9:	|         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    24bd:	|     /-- e9 e1 00 00 00       	jmp    25a3 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        Line16 const a = load16(s + i);
+    24c2:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    24c6:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24ca:	|  |  |   48 01 d0             	add    %rdx,%rax
+    24cd:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    24d0:	|  |  |   e8 40 ff ff ff       	call   2415 <nel::elem::load16(unsigned char const*)>
+    24d5:	|  |  |   0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+        Line16 const b = load16(s + i + 16);
+    24d9:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24dd:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    24e1:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    24e5:	|  |  |   48 01 d0             	add    %rdx,%rax
+    24e8:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    24eb:	|  |  |   e8 25 ff ff ff       	call   2415 <nel::elem::load16(unsigned char const*)>
+    24f0:	|  |  |   0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+        Line16 const c = load16(s + i + 32);
+    24f4:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24f8:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    24fc:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2500:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2503:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2506:	|  |  |   e8 0a ff ff ff       	call   2415 <nel::elem::load16(unsigned char const*)>
+    250b:	|  |  |   0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+        Line16 const e = load16(s + i + 48);
+    250f:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2513:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    2517:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    251b:	|  |  |   48 01 d0             	add    %rdx,%rax
+    251e:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2521:	|  |  |   e8 ef fe ff ff       	call   2415 <nel::elem::load16(unsigned char const*)>
+    2526:	|  |  |   0f 29 45 a0          	movaps %xmm0,-0x60(%rbp)
+        stream16(d + i, a);
+    252a:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    252e:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2532:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2535:	|  |  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    2539:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    253c:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    253f:	|  |  |   e8 f3 fe ff ff       	call   2437 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, b);
+    2544:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2548:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    254c:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2550:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2553:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2557:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    255a:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    255d:	|  |  |   e8 d5 fe ff ff       	call   2437 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, c);
+    2562:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2566:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    256a:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    256e:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2571:	|  |  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    2575:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2578:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    257b:	|  |  |   e8 b7 fe ff ff       	call   2437 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, e);
+    2580:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2584:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    2588:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    258c:	|  |  |   48 01 c2             	add    %rax,%rdx
+    258f:	|  |  |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    2593:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2596:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2599:	|  |  |   e8 99 fe ff ff       	call   2437 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    259e:	|  |  |   48 83 45 f8 40       	addq   $0x40,-0x8(%rbp)
+    25a3:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25a7:	|  |      48 83 c0 40          	add    $0x40,%rax
+    25ab:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    25af:	|  \----- 0f 83 0d ff ff ff    	jae    24c2 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x6c>
+    }
+    for (; i + 16 <= n; i += 16) {
+    25b5:	|     /-- eb 36                	jmp    25ed <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x197>
+        stream16(d + i, load16(s + i));
+    25b7:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    25bb:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25bf:	|  |  |   48 01 d0             	add    %rdx,%rax
+    25c2:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    25c5:	|  |  |   e8 4b fe ff ff       	call   2415 <nel::elem::load16(unsigned char const*)>
+    25ca:	|  |  |   0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+    25ce:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    25d2:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25d6:	|  |  |   48 01 c2             	add    %rax,%rdx
+    25d9:	|  |  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    25dd:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    25e0:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    25e3:	|  |  |   e8 4f fe ff ff       	call   2437 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    25e8:	|  |  |   48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+    25ed:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25f1:	|  |      48 83 c0 10          	add    $0x10,%rax
+    25f5:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    25f9:	|  \----- 73 bc                	jae    25b7 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    25fb:	|         0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    25fe:	|         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    2602:	|         48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    2606:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    260a:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    260e:	|         48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    2612:	|         48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+    2616:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    261a:	|         48 01 d1             	add    %rdx,%rcx
+    261d:	|         48 89 c2             	mov    %rax,%rdx
+    2620:	|         48 89 cf             	mov    %rcx,%rdi
+    2623:	|         e8 09 fc ff ff       	call   2231 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+}
+    2628:	\-------> c9                   	leave
+    2629:	          c3                   	ret
+
+000000000000262a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    262a:	          55                   	push   %rbp
+    262b:	          48 89 e5             	mov    %rsp,%rbp
+    262e:	          48 83 ec 60          	sub    $0x60,%rsp
+    2632:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    2636:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    263a:	          48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    if (n < streaming_min) {
+    263e:	          48 81 7d a8 ff 00 00 	cmpq   $0xff,-0x58(%rbp)
+    2645:	          00 
+    2646:	      /-- 77 1c                	ja     2664 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        set_pattern(d, p, n);
+    2648:	      |   48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    264c:	      |   48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+    2650:	      |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2654:	      |   48 89 ce             	mov    %rcx,%rsi
+    2657:	      |   48 89 c7             	mov    %rax,%rdi
+    265a:	      |   e8 29 fd ff ff       	call   2388 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>
+    265f:	/-----|-- e9 89 01 00 00       	jmp    27ed <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c3>
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2664:	|     \-> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2668:	|         48 f7 d8             	neg    %rax
+    266b:	|         83 e0 0f             	and    $0xf,%eax
+    266e:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    for (Index i = 0; i < head; ++i) {
+    2672:	|         48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    2679:	|         00 
+    267a:	|     /-- eb 20                	jmp    269c <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x72>
+        d[i] = p[i];
+    267c:	|  /--|-> 48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    2680:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2684:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2687:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    268b:	|  |  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    268f:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    2692:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    2695:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < head; ++i) {
+    2697:	|  |  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    269c:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26a0:	|  |      48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    26a4:	|  \----- 72 d6                	jb     267c <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x52>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    26a6:	|         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    26ad:	|         00 
+    26ae:	|     /-- eb 2d                	jmp    26dd <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xb3>
+        rotated[i] = p[(head + i) % 16];
+    26b0:	|  /--|-> 48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    26b4:	|  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26b8:	|  |  |   48 01 d0             	add    %rdx,%rax
+    26bb:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    26be:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    26c1:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    26c5:	|  |  |   48 01 d0             	add    %rdx,%rax
+    26c8:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    26cb:	|  |  |   48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    26cf:	|  |  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    26d3:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    26d6:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < 16; ++i) {
+    26d8:	|  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    26dd:	|  |  \-> 48 83 7d f0 0f       	cmpq   $0xf,-0x10(%rbp)
+    26e2:	|  \----- 76 cc                	jbe    26b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x86>
+    }
+    Line16 const v = load16(rotated);
+    26e4:	|         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    26e8:	|         48 89 c7             	mov    %rax,%rdi
+    26eb:	|         e8 25 fd ff ff       	call   2415 <nel::elem::load16(unsigned char const*)>
+    26f0:	|         0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+    Index i = head;
+    26f4:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    26f8:	|         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    26fc:	|     /-- eb 79                	jmp    2777 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        stream16(d + i, v);
+    26fe:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    2702:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2706:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2709:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    270d:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2710:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2713:	|  |  |   e8 1f fd ff ff       	call   2437 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, v);
+    2718:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    271c:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    2720:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2724:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2727:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    272b:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    272e:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2731:	|  |  |   e8 01 fd ff ff       	call   2437 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, v);
+    2736:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    273a:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    273e:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2742:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2745:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2749:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    274c:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    274f:	|  |  |   e8 e3 fc ff ff       	call   2437 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, v);
+    2754:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2758:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    275c:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2760:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2763:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2767:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    276a:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    276d:	|  |  |   e8 c5 fc ff ff       	call   2437 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    2772:	|  |  |   48 83 45 e8 40       	addq   $0x40,-0x18(%rbp)
+    2777:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    277b:	|  |      48 83 c0 40          	add    $0x40,%rax
+    277f:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    2783:	|  \----- 0f 83 75 ff ff ff    	jae    26fe <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd4>
+    }
+    for (; i + 16 <= n; i += 16) {
+    2789:	|     /-- eb 1f                	jmp    27aa <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x180>
+        stream16(d + i, v);
+    278b:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    278f:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2793:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2796:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    279a:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    279d:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    27a0:	|  |  |   e8 92 fc ff ff       	call   2437 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    27a5:	|  |  |   48 83 45 e8 10       	addq   $0x10,-0x18(%rbp)
+    27aa:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27ae:	|  |      48 83 c0 10          	add    $0x10,%rax
+    27b2:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    27b6:	|  \----- 73 d3                	jae    278b <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    __builtin_ia32_sfence();
+    27b8:	|         0f ae f8             	sfence
+    for (; i < n; ++i) {
+    27bb:	|     /-- eb 26                	jmp    27e3 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1b9>
+        d[i] = p[i % 16];
+    27bd:	|  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27c1:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    27c4:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    27c7:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    27cb:	|  |  |   48 01 d0             	add    %rdx,%rax
+    27ce:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    27d2:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    27d6:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    27d9:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    27dc:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (; i < n; ++i) {
+    27de:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    27e3:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27e7:	|  |      48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    27eb:	|  \----- 72 d0                	jb     27bd <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x193>
+    }
+}
+    27ed:	\-------> c9                   	leave
+    27ee:	          c3                   	ret
+
+00000000000027ef <nel::offset_of(unsigned char*, unsigned long)>:
+// The payload is the first align boundary leaving room for a Length in front,
+// which holds the offset from the start of the underlying allocation.
+// Malloc alignment is at least alignof(Length), so the payload is at most
+// align bytes in.
+static Length offset_of(uint8_t *const base, Length const align)
+{
+    27ef:	55                   	push   %rbp
+    27f0:	48 89 e5             	mov    %rsp,%rbp
+    27f3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    27f7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    USize const a = reinterpret_cast<USize>(base) + sizeof(Length);
+    27fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27ff:	48 83 c0 08          	add    $0x8,%rax
+    2803:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    2807:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    280b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    280f:	48 01 d0             	add    %rdx,%rax
+    2812:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    2816:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    281a:	48 f7 d8             	neg    %rax
+    281d:	48 21 c2             	and    %rax,%rdx
+    2820:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2824:	48 29 c2             	sub    %rax,%rdx
+    2827:	48 89 d0             	mov    %rdx,%rax
+}
+    282a:	5d                   	pop    %rbp
+    282b:	c3                   	ret
+
+000000000000282c <nel::offset_field(unsigned char*)>:
+
+static Length &offset_field(uint8_t *const p)
+{
+    282c:	55                   	push   %rbp
+    282d:	48 89 e5             	mov    %rsp,%rbp
+    2830:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return reinterpret_cast<Length *>(p)[-1];
+    2834:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2838:	48 83 e8 08          	sub    $0x8,%rax
+}
+    283c:	5d                   	pop    %rbp
+    283d:	c3                   	ret
+
+000000000000283e <nel::free_aligned(void*)>:
+
+void free_aligned(void *const p)
+{
+    283e:	       55                   	push   %rbp
+    283f:	       48 89 e5             	mov    %rsp,%rbp
+    2842:	       48 83 ec 20          	sub    $0x20,%rsp
+    2846:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (p == nullptr) { return; }
+    284a:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    284f:	/----- 74 2e                	je     287f <nel::free_aligned(void*)+0x41>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    2851:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2855:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    std::free(u8p - offset_field(u8p));
+    2859:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    285d:	|      48 89 c7             	mov    %rax,%rdi
+    2860:	|      e8 c7 ff ff ff       	call   282c <nel::offset_field(unsigned char*)>
+    2865:	|      48 8b 00             	mov    (%rax),%rax
+    2868:	|      48 f7 d8             	neg    %rax
+    286b:	|      48 89 c2             	mov    %rax,%rdx
+    286e:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2872:	|      48 01 d0             	add    %rdx,%rax
+    2875:	|      48 89 c7             	mov    %rax,%rdi
+    2878:	|      e8 b3 e7 ff ff       	call   1030 <free@plt>
+    287d:	|  /-- eb 01                	jmp    2880 <nel::free_aligned(void*)+0x42>
+    if (p == nullptr) { return; }
+    287f:	\--|-> 90                   	nop
+}
+    2880:	   \-> c9                   	leave
+    2881:	       c3                   	ret
+
+0000000000002882 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    2882:	             55                   	push   %rbp
+    2883:	             48 89 e5             	mov    %rsp,%rbp
+    2886:	             53                   	push   %rbx
+    2887:	             48 83 ec 78          	sub    $0x78,%rsp
+    288b:	             48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    288f:	             48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    2893:	             48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    2897:	             48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    289b:	             48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    289f:	             b9 f3 00 00 00       	mov    $0xf3,%ecx
+    28a4:	             48 8d 15 3d 08 00 00 	lea    0x83d(%rip),%rdx        # 30e8 <nel::elem::streaming_min+0x8>
+    28ab:	             48 8d 35 48 08 00 00 	lea    0x848(%rip),%rsi        # 30fa <nel::elem::streaming_min+0x1a>
+    28b2:	             48 89 c7             	mov    %rax,%rdi
+    28b5:	             e8 96 eb ff ff       	call   1450 <nel::Context::Context(char const*, char const*, int)>
+    28ba:	             48 83 7d 90 00       	cmpq   $0x0,-0x70(%rbp)
+    28bf:	      /----- 74 18                	je     28d9 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    28c1:	      |      48 8b 45 90          	mov    -0x70(%rbp),%rax
+    28c5:	      |      48 83 e8 01          	sub    $0x1,%rax
+    28c9:	      |      48 23 45 90          	and    -0x70(%rbp),%rax
+    28cd:	      |      48 85 c0             	test   %rax,%rax
+    28d0:	      +----- 75 07                	jne    28d9 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    28d2:	      |      b8 01 00 00 00       	mov    $0x1,%eax
+    28d7:	      |  /-- eb 05                	jmp    28de <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x5c>
+    28d9:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    28de:	         \-> 0f b6 c0             	movzbl %al,%eax
+    28e1:	             48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    28e5:	             48 8d 0d 1e 08 00 00 	lea    0x81e(%rip),%rcx        # 310a <nel::elem::streaming_min+0x2a>
+    28ec:	             48 89 ce             	mov    %rcx,%rsi
+    28ef:	             89 c7                	mov    %eax,%edi
+    28f1:	             e8 5b 01 00 00       	call   2a51 <nel::assert(bool, char const*, nel::Context const&)>
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    28f6:	             48 8b 45 98          	mov    -0x68(%rbp),%rax
+    28fa:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    28fe:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    2903:	      /----- 74 11                	je     2916 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x94>
+    2905:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2909:	      |      48 89 c7             	mov    %rax,%rdi
+    290c:	      |      e8 1b ff ff ff       	call   282c <nel::offset_field(unsigned char*)>
+    2911:	      |      48 8b 00             	mov    (%rax),%rax
+    2914:	      |  /-- eb 05                	jmp    291b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x99>
+    2916:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    291b:	         \-> 48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    291f:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    2924:	      /----- 74 13                	je     2939 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb7>
+    2926:	      |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    292a:	      |      48 f7 d8             	neg    %rax
+    292d:	      |      48 89 c2             	mov    %rax,%rdx
+    2930:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2934:	      |      48 01 d0             	add    %rdx,%rax
+    2937:	      |  /-- eb 05                	jmp    293e <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xbc>
+    2939:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    293e:	         \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2942:	             48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    2946:	             48 8b 45 90          	mov    -0x70(%rbp),%rax
+    294a:	             48 01 c2             	add    %rax,%rdx
+    294d:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2951:	             48 89 d6             	mov    %rdx,%rsi
+    2954:	             48 89 c7             	mov    %rax,%rdi
+    2957:	             e8 54 e7 ff ff       	call   10b0 <realloc@plt>
+    295c:	             48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if (new_base == nullptr) { return nullptr; }
+    2960:	             48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    2965:	         /-- 75 0a                	jne    2971 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    2967:	         |   b8 00 00 00 00       	mov    $0x0,%eax
+    296c:	/--------|-- e9 85 00 00 00       	jmp    29f6 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x174>
+
+    Length const new_offset = offset_of(new_base, align);
+    2971:	|        \-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    2975:	|            48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2979:	|            48 89 d6             	mov    %rdx,%rsi
+    297c:	|            48 89 c7             	mov    %rax,%rdi
+    297f:	|            e8 6b fe ff ff       	call   27ef <nel::offset_of(unsigned char*, unsigned long)>
+    2984:	|            48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    uint8_t *const new_p = new_base + new_offset;
+    2988:	|            48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    298c:	|            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2990:	|            48 01 d0             	add    %rdx,%rax
+    2993:	|            48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    if (old_p != nullptr && new_offset != old_offset) {
+    2997:	|            48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    299c:	|  /-------- 74 41                	je     29df <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+    299e:	|  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    29a2:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    29a6:	|  +-------- 74 37                	je     29df <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+    29a8:	|  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    29ac:	|  |         48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    29b0:	|  |  /----- 73 06                	jae    29b8 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x136>
+    29b2:	|  |  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    29b6:	|  |  |  /-- eb 04                	jmp    29bc <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x13a>
+    29b8:	|  |  \--|-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    29bc:	|  |     \-> 48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        std::memmove(new_p, new_base + old_offset, n);
+    29c0:	|  |         48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    29c4:	|  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29c8:	|  |         48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    29cc:	|  |         48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    29d0:	|  |         48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    29d4:	|  |         48 89 ce             	mov    %rcx,%rsi
+    29d7:	|  |         48 89 c7             	mov    %rax,%rdi
+    29da:	|  |         e8 e1 e6 ff ff       	call   10c0 <memmove@plt>
+    }
+    offset_field(new_p) = new_offset;
+    29df:	|  \-------> 48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+    29e3:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    29e7:	|            48 89 c7             	mov    %rax,%rdi
+    29ea:	|            e8 3d fe ff ff       	call   282c <nel::offset_field(unsigned char*)>
+    29ef:	|            48 89 18             	mov    %rbx,(%rax)
+    return new_p;
+    29f2:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+}
+    29f6:	\----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    29fa:	             c9                   	leave
+    29fb:	             c3                   	ret
+
+00000000000029fc <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    29fc:	55                   	push   %rbp
+    29fd:	48 89 e5             	mov    %rsp,%rbp
+    2a00:	48 83 ec 10          	sub    $0x10,%rsp
+    2a04:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2a08:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return realloc_aligned(nullptr, align, 0, size);
+    2a0c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2a10:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a14:	48 89 d1             	mov    %rdx,%rcx
+    2a17:	ba 00 00 00 00       	mov    $0x0,%edx
+    2a1c:	48 89 c6             	mov    %rax,%rsi
+    2a1f:	bf 00 00 00 00       	mov    $0x0,%edi
+    2a24:	e8 59 fe ff ff       	call   2882 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+}
+    2a29:	c9                   	leave
+    2a2a:	c3                   	ret
+
+0000000000002a2b <nel::elem::poison(unsigned char*, unsigned long)>:
+{
+    2a2b:	55                   	push   %rbp
+    2a2c:	48 89 e5             	mov    %rsp,%rbp
+    2a2f:	48 83 ec 10          	sub    $0x10,%rsp
+    2a33:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2a37:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    copy(d, s, n);
+    2a3b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2a3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a43:	48 89 d6             	mov    %rdx,%rsi
+    2a46:	48 89 c7             	mov    %rax,%rdi
+    2a49:	e8 ae f8 ff ff       	call   22fc <nel::elem::wipe(unsigned char*, unsigned long)>
+}
+    2a4e:	90                   	nop
+    2a4f:	c9                   	leave
+    2a50:	c3                   	ret
+
+0000000000002a51 <nel::assert(bool, char const*, nel::Context const&)>:
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx);
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    2a51:	    55                   	push   %rbp
+    2a52:	    48 89 e5             	mov    %rsp,%rbp
+    2a55:	    48 83 ec 20          	sub    $0x20,%rsp
+    2a59:	    89 f8                	mov    %edi,%eax
+    2a5b:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2a5f:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2a63:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { assert_fail(msg, ctx); }
+    2a66:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    2a6a:	    83 f0 01             	xor    $0x1,%eax
+    2a6d:	    84 c0                	test   %al,%al
+    2a6f:	/-- 74 13                	je     2a84 <nel::assert(bool, char const*, nel::Context const&)+0x33>
+    2a71:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2a75:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a79:	|   48 89 d6             	mov    %rdx,%rsi
+    2a7c:	|   48 89 c7             	mov    %rax,%rdi
+    2a7f:	|   e8 52 f7 ff ff       	call   21d6 <nel::assert_fail(char const*, nel::Context const&)>
+}
+    2a84:	\-> 90                   	nop
+    2a85:	    c9                   	leave
+    2a86:	    c3                   	ret
+
+0000000000002a87 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    2a87:	55                   	push   %rbp
+    2a88:	48 89 e5             	mov    %rsp,%rbp
+    2a8b:	48 83 ec 10          	sub    $0x10,%rsp
+    2a8f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2a93:	89 f0                	mov    %esi,%eax
+    2a95:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    2a98:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    2a9c:	48 8b 15 bd 35 00 00 	mov    0x35bd(%rip),%rdx        # 6060 <stderr@GLIBC_2.2.5>
+    2aa3:	48 89 d6             	mov    %rdx,%rsi
+    2aa6:	89 c7                	mov    %eax,%edi
+    2aa8:	e8 c3 e5 ff ff       	call   1070 <fputc@plt>
+    return outs;
+    2aad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2ab1:	c9                   	leave
+    2ab2:	c3                   	ret
+
+0000000000002ab3 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    2ab3:	55                   	push   %rbp
+    2ab4:	48 89 e5             	mov    %rsp,%rbp
+    2ab7:	48 83 ec 10          	sub    $0x10,%rsp
+    2abb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2abf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    2ac3:	48 8b 15 96 35 00 00 	mov    0x3596(%rip),%rdx        # 6060 <stderr@GLIBC_2.2.5>
+    2aca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ace:	48 89 d6             	mov    %rdx,%rsi
+    2ad1:	48 89 c7             	mov    %rax,%rdi
+    2ad4:	e8 77 e5 ff ff       	call   1050 <fputs@plt>
+    return outs;
+    2ad9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2add:	c9                   	leave
+    2ade:	c3                   	ret
+
+0000000000002adf <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    2adf:	55                   	push   %rbp
+    2ae0:	48 89 e5             	mov    %rsp,%rbp
+    2ae3:	48 83 ec 10          	sub    $0x10,%rsp
+    2ae7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2aeb:	89 f0                	mov    %esi,%eax
+    2aed:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    2af0:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    2af4:	48 8b 05 65 35 00 00 	mov    0x3565(%rip),%rax        # 6060 <stderr@GLIBC_2.2.5>
+    2afb:	48 8d 0d 23 06 00 00 	lea    0x623(%rip),%rcx        # 3125 <nel::elem::streaming_min+0x45>
+    2b02:	48 89 ce             	mov    %rcx,%rsi
+    2b05:	48 89 c7             	mov    %rax,%rdi
+    2b08:	b8 00 00 00 00       	mov    $0x0,%eax
+    2b0d:	e8 7e e5 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    2b12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2b16:	c9                   	leave
+    2b17:	c3                   	ret
+
+0000000000002b18 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    2b18:	55                   	push   %rbp
+    2b19:	48 89 e5             	mov    %rsp,%rbp
+    2b1c:	48 83 ec 10          	sub    $0x10,%rsp
+    2b20:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2b24:	89 f0                	mov    %esi,%eax
+    2b26:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    2b2a:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    2b2e:	48 8b 05 2b 35 00 00 	mov    0x352b(%rip),%rax        # 6060 <stderr@GLIBC_2.2.5>
+    2b35:	48 8d 0d e9 05 00 00 	lea    0x5e9(%rip),%rcx        # 3125 <nel::elem::streaming_min+0x45>
+    2b3c:	48 89 ce             	mov    %rcx,%rsi
+    2b3f:	48 89 c7             	mov    %rax,%rdi
+    2b42:	b8 00 00 00 00       	mov    $0x0,%eax
+    2b47:	e8 44 e5 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    2b4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2b50:	c9                   	leave
+    2b51:	c3                   	ret
+
+0000000000002b52 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    2b52:	55                   	push   %rbp
+    2b53:	48 89 e5             	mov    %rsp,%rbp
+    2b56:	48 83 ec 10          	sub    $0x10,%rsp
+    2b5a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2b5e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    2b61:	48 8b 05 f8 34 00 00 	mov    0x34f8(%rip),%rax        # 6060 <stderr@GLIBC_2.2.5>
+    2b68:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    2b6b:	48 8d 0d b3 05 00 00 	lea    0x5b3(%rip),%rcx        # 3125 <nel::elem::streaming_min+0x45>
+    2b72:	48 89 ce             	mov    %rcx,%rsi
+    2b75:	48 89 c7             	mov    %rax,%rdi
+    2b78:	b8 00 00 00 00       	mov    $0x0,%eax
+    2b7d:	e8 0e e5 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    2b82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2b86:	c9                   	leave
+    2b87:	c3                   	ret
+
+0000000000002b88 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    2b88:	55                   	push   %rbp
+    2b89:	48 89 e5             	mov    %rsp,%rbp
+    2b8c:	48 83 ec 10          	sub    $0x10,%rsp
+    2b90:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2b94:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    2b97:	48 8b 05 c2 34 00 00 	mov    0x34c2(%rip),%rax        # 6060 <stderr@GLIBC_2.2.5>
+    2b9e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    2ba1:	48 8d 0d 7d 05 00 00 	lea    0x57d(%rip),%rcx        # 3125 <nel::elem::streaming_min+0x45>
+    2ba8:	48 89 ce             	mov    %rcx,%rsi
+    2bab:	48 89 c7             	mov    %rax,%rdi
+    2bae:	b8 00 00 00 00       	mov    $0x0,%eax
+    2bb3:	e8 d8 e4 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    2bb8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2bbc:	c9                   	leave
+    2bbd:	c3                   	ret
+
+0000000000002bbe <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    2bbe:	55                   	push   %rbp
+    2bbf:	48 89 e5             	mov    %rsp,%rbp
+    2bc2:	48 83 ec 10          	sub    $0x10,%rsp
+    2bc6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2bca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    2bce:	48 8b 05 8b 34 00 00 	mov    0x348b(%rip),%rax        # 6060 <stderr@GLIBC_2.2.5>
+    2bd5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2bd9:	48 8d 0d 48 05 00 00 	lea    0x548(%rip),%rcx        # 3128 <nel::elem::streaming_min+0x48>
+    2be0:	48 89 ce             	mov    %rcx,%rsi
+    2be3:	48 89 c7             	mov    %rax,%rdi
+    2be6:	b8 00 00 00 00       	mov    $0x0,%eax
+    2beb:	e8 a0 e4 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    2bf0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2bf4:	c9                   	leave
+    2bf5:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000002bf8 <_fini>:
+    2bf8:	48 83 ec 08          	sub    $0x8,%rsp
+    2bfc:	48 83 c4 08          	add    $0x8,%rsp
+    2c00:	c3                   	ret
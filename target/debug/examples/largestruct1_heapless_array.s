@@ -0,0 +1,4162 @@
+
+target/debug/examples/largestruct1_heapless_array:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 5f 00 00 	mov    0x5fc5(%rip),%rax        # 6fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 5f 00 00    	push   0x5fca(%rip)        # 6ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 5f 00 00    	jmp    *0x5fcc(%rip)        # 6ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 5f 00 00    	jmp    *0x5fca(%rip)        # 7000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 5f 00 00    	jmp    *0x5fc2(%rip)        # 7008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 5f 00 00    	jmp    *0x5fba(%rip)        # 7010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memset@plt>:
+    1060:	ff 25 b2 5f 00 00    	jmp    *0x5fb2(%rip)        # 7018 <memset@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 5f 00 00    	jmp    *0x5faa(%rip)        # 7020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 5f 00 00    	jmp    *0x5fa2(%rip)        # 7028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 5f 00 00    	jmp    *0x5f9a(%rip)        # 7030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcpy@plt>:
+    10a0:	ff 25 92 5f 00 00    	jmp    *0x5f92(%rip)        # 7038 <memcpy@GLIBC_2.14>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <realloc@plt>:
+    10b0:	ff 25 8a 5f 00 00    	jmp    *0x5f8a(%rip)        # 7040 <realloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <memmove@plt>:
+    10c0:	ff 25 82 5f 00 00    	jmp    *0x5f82(%rip)        # 7048 <memmove@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010d0 <__cxa_finalize@plt>:
+    10d0:	ff 25 0a 5f 00 00    	jmp    *0x5f0a(%rip)        # 6fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10d6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010e0 <_start>:
+    10e0:	31 ed                	xor    %ebp,%ebp
+    10e2:	49 89 d1             	mov    %rdx,%r9
+    10e5:	5e                   	pop    %rsi
+    10e6:	48 89 e2             	mov    %rsp,%rdx
+    10e9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    10ed:	50                   	push   %rax
+    10ee:	54                   	push   %rsp
+    10ef:	45 31 c0             	xor    %r8d,%r8d
+    10f2:	31 c9                	xor    %ecx,%ecx
+    10f4:	48 8d 3d 07 0a 00 00 	lea    0xa07(%rip),%rdi        # 1b02 <main>
+    10fb:	ff 15 bf 5e 00 00    	call   *0x5ebf(%rip)        # 6fc0 <__libc_start_main@GLIBC_2.34>
+    1101:	f4                   	hlt
+    1102:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1109:	00 00 00 
+    110c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001110 <deregister_tm_clones>:
+    1110:	    48 8d 3d 49 5f 00 00 	lea    0x5f49(%rip),%rdi        # 7060 <stderr@GLIBC_2.2.5>
+    1117:	    48 8d 05 42 5f 00 00 	lea    0x5f42(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    111e:	    48 39 f8             	cmp    %rdi,%rax
+    1121:	/-- 74 15                	je     1138 <deregister_tm_clones+0x28>
+    1123:	|   48 8b 05 9e 5e 00 00 	mov    0x5e9e(%rip),%rax        # 6fc8 <_ITM_deregisterTMCloneTable@Base>
+    112a:	|   48 85 c0             	test   %rax,%rax
+    112d:	+-- 74 09                	je     1138 <deregister_tm_clones+0x28>
+    112f:	|   ff e0                	jmp    *%rax
+    1131:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1138:	\-> c3                   	ret
+    1139:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001140 <register_tm_clones>:
+    1140:	    48 8d 3d 19 5f 00 00 	lea    0x5f19(%rip),%rdi        # 7060 <stderr@GLIBC_2.2.5>
+    1147:	    48 8d 35 12 5f 00 00 	lea    0x5f12(%rip),%rsi        # 7060 <stderr@GLIBC_2.2.5>
+    114e:	    48 29 fe             	sub    %rdi,%rsi
+    1151:	    48 89 f0             	mov    %rsi,%rax
+    1154:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1158:	    48 c1 f8 03          	sar    $0x3,%rax
+    115c:	    48 01 c6             	add    %rax,%rsi
+    115f:	    48 d1 fe             	sar    %rsi
+    1162:	/-- 74 14                	je     1178 <register_tm_clones+0x38>
+    1164:	|   48 8b 05 6d 5e 00 00 	mov    0x5e6d(%rip),%rax        # 6fd8 <_ITM_registerTMCloneTable@Base>
+    116b:	|   48 85 c0             	test   %rax,%rax
+    116e:	+-- 74 08                	je     1178 <register_tm_clones+0x38>
+    1170:	|   ff e0                	jmp    *%rax
+    1172:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1178:	\-> c3                   	ret
+    1179:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001180 <__do_global_dtors_aux>:
+    1180:	       f3 0f 1e fa          	endbr64
+    1184:	       80 3d dd 5e 00 00 00 	cmpb   $0x0,0x5edd(%rip)        # 7068 <completed.0>
+    118b:	/----- 75 2b                	jne    11b8 <__do_global_dtors_aux+0x38>
+    118d:	|      55                   	push   %rbp
+    118e:	|      48 83 3d 4a 5e 00 00 	cmpq   $0x0,0x5e4a(%rip)        # 6fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1195:	|      00 
+    1196:	|      48 89 e5             	mov    %rsp,%rbp
+    1199:	|  /-- 74 0c                	je     11a7 <__do_global_dtors_aux+0x27>
+    119b:	|  |   48 8b 3d b6 5e 00 00 	mov    0x5eb6(%rip),%rdi        # 7058 <__dso_handle>
+    11a2:	|  |   e8 29 ff ff ff       	call   10d0 <__cxa_finalize@plt>
+    11a7:	|  \-> e8 64 ff ff ff       	call   1110 <deregister_tm_clones>
+    11ac:	|      c6 05 b5 5e 00 00 01 	movb   $0x1,0x5eb5(%rip)        # 7068 <completed.0>
+    11b3:	|      5d                   	pop    %rbp
+    11b4:	|      c3                   	ret
+    11b5:	|      0f 1f 00             	nopl   (%rax)
+    11b8:	\----> c3                   	ret
+    11b9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011c0 <frame_dummy>:
+    11c0:	f3 0f 1e fa          	endbr64
+    11c4:	e9 77 ff ff ff       	jmp    1140 <register_tm_clones>
+    11c9:	90                   	nop
+
+00000000000011ca <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    11ca:	55                   	push   %rbp
+    11cb:	48 89 e5             	mov    %rsp,%rbp
+    11ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11d2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    11d5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11da:	5d                   	pop    %rbp
+    11db:	c3                   	ret
+
+00000000000011dc <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    11dc:	55                   	push   %rbp
+    11dd:	48 89 e5             	mov    %rsp,%rbp
+    11e0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11e4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11e7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return -1;
+    11eb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11f0:	5d                   	pop    %rbp
+    11f1:	c3                   	ret
+
+00000000000011f2 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    11f2:	55                   	push   %rbp
+    11f3:	48 89 e5             	mov    %rsp,%rbp
+    11f6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11fa:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11fd:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    return -1;
+    1200:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1205:	5d                   	pop    %rbp
+    1206:	c3                   	ret
+
+0000000000001207 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    1207:	55                   	push   %rbp
+    1208:	48 89 e5             	mov    %rsp,%rbp
+    120b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    120f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1212:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    1215:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    return -1;
+    1218:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    121d:	5d                   	pop    %rbp
+    121e:	c3                   	ret
+
+000000000000121f <_read_r>:
+int _read_r(struct _reent *, int) {
+    121f:	55                   	push   %rbp
+    1220:	48 89 e5             	mov    %rsp,%rbp
+    1223:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1227:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    122a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    122f:	5d                   	pop    %rbp
+    1230:	c3                   	ret
+
+0000000000001231 <_write_r>:
+int _write_r(struct _reent *, int, char *, int) {
+    1231:	55                   	push   %rbp
+    1232:	48 89 e5             	mov    %rsp,%rbp
+    1235:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1239:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    123c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1240:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+    return -1;
+    1243:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1248:	5d                   	pop    %rbp
+    1249:	c3                   	ret
+
+000000000000124a <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    124a:	55                   	push   %rbp
+    124b:	48 89 e5             	mov    %rsp,%rbp
+    124e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return -1;
+    1252:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1257:	5d                   	pop    %rbp
+    1258:	c3                   	ret
+
+0000000000001259 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1259:	55                   	push   %rbp
+    125a:	48 89 e5             	mov    %rsp,%rbp
+    125d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1261:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1264:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1269:	5d                   	pop    %rbp
+    126a:	c3                   	ret
+
+000000000000126b <ex1()>:
+#include "libnosys_stubs.cx"
+
+typedef nel::heapless::Array<U8Buf<256>, 8> Array1;
+
+void ex1()
+{
+    126b:	55                   	push   %rbp
+    126c:	48 89 e5             	mov    %rsp,%rbp
+    126f:	48 81 ec 00 09 00 00 	sub    $0x900,%rsp
+    // what should this give?
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    1276:	48 8d 85 00 ff ff ff 	lea    -0x100(%rbp),%rax
+    127d:	be ff 00 00 00       	mov    $0xff,%esi
+    1282:	48 89 c7             	mov    %rax,%rdi
+    1285:	e8 f0 0e 00 00       	call   217a <U8Buf<256ul>::U8Buf(unsigned char)>
+    128a:	48 8d 85 00 f7 ff ff 	lea    -0x900(%rbp),%rax
+    1291:	48 8d 95 00 ff ff ff 	lea    -0x100(%rbp),%rdx
+    1298:	48 89 d6             	mov    %rdx,%rsi
+    129b:	48 89 c7             	mov    %rax,%rdi
+    129e:	e8 76 11 00 00       	call   2419 <nel::heapless::Array<U8Buf<256ul>, 8ul>::filled_with(U8Buf<256ul> const&)>
+    12a3:	48 8d 85 00 ff ff ff 	lea    -0x100(%rbp),%rax
+    12aa:	48 89 c7             	mov    %rax,%rdi
+    12ad:	e8 42 11 00 00       	call   23f4 <U8Buf<256ul>::~U8Buf()>
+
+    nel::log << arr1 << '\n';
+    12b2:	48 8d 85 00 f7 ff ff 	lea    -0x900(%rbp),%rax
+    12b9:	48 89 c6             	mov    %rax,%rsi
+    12bc:	48 8d 05 a6 5d 00 00 	lea    0x5da6(%rip),%rax        # 7069 <nel::log>
+    12c3:	48 89 c7             	mov    %rax,%rdi
+    12c6:	e8 b3 11 00 00       	call   247e <nel::heapless::operator<<(nel::Log&, nel::heapless::Array<U8Buf<256ul>, 8ul> const&)>
+    12cb:	be 0a 00 00 00       	mov    $0xa,%esi
+    12d0:	48 89 c7             	mov    %rax,%rdi
+    12d3:	e8 d3 24 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+}
+    12d8:	48 8d 85 00 f7 ff ff 	lea    -0x900(%rbp),%rax
+    12df:	48 89 c7             	mov    %rax,%rdi
+    12e2:	e8 51 0e 00 00       	call   2138 <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()>
+    12e7:	c9                   	leave
+    12e8:	c3                   	ret
+
+00000000000012e9 <ex3()>:
+    nel::log << arr1 << '\n';
+}
+#endif
+
+void ex3()
+{
+    12e9:	55                   	push   %rbp
+    12ea:	48 89 e5             	mov    %rsp,%rbp
+    12ed:	48 81 ec 90 0c 00 00 	sub    $0xc90,%rsp
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    12f4:	48 8d 85 70 fb ff ff 	lea    -0x490(%rbp),%rax
+    12fb:	be ff 00 00 00       	mov    $0xff,%esi
+    1300:	48 89 c7             	mov    %rax,%rdi
+    1303:	e8 72 0e 00 00       	call   217a <U8Buf<256ul>::U8Buf(unsigned char)>
+    1308:	48 8d 85 70 f3 ff ff 	lea    -0xc90(%rbp),%rax
+    130f:	48 8d 95 70 fb ff ff 	lea    -0x490(%rbp),%rdx
+    1316:	48 89 d6             	mov    %rdx,%rsi
+    1319:	48 89 c7             	mov    %rax,%rdi
+    131c:	e8 f8 10 00 00       	call   2419 <nel::heapless::Array<U8Buf<256ul>, 8ul>::filled_with(U8Buf<256ul> const&)>
+    1321:	48 8d 85 70 fb ff ff 	lea    -0x490(%rbp),%rax
+    1328:	48 89 c7             	mov    %rax,%rdi
+    132b:	e8 c4 10 00 00       	call   23f4 <U8Buf<256ul>::~U8Buf()>
+
+    arr1.try_get(0).unwrap() = U8Buf<256>(0x11);
+    1330:	48 8d 85 70 fc ff ff 	lea    -0x390(%rbp),%rax
+    1337:	be 11 00 00 00       	mov    $0x11,%esi
+    133c:	48 89 c7             	mov    %rax,%rdi
+    133f:	e8 36 0e 00 00       	call   217a <U8Buf<256ul>::U8Buf(unsigned char)>
+    1344:	48 8d 85 70 fd ff ff 	lea    -0x290(%rbp),%rax
+    134b:	48 8d 8d 70 f3 ff ff 	lea    -0xc90(%rbp),%rcx
+    1352:	ba 00 00 00 00       	mov    $0x0,%edx
+    1357:	48 89 ce             	mov    %rcx,%rsi
+    135a:	48 89 c7             	mov    %rax,%rdi
+    135d:	e8 b4 11 00 00       	call   2516 <nel::heapless::Array<U8Buf<256ul>, 8ul>::try_get(unsigned long)>
+    1362:	48 8d 85 80 fd ff ff 	lea    -0x280(%rbp),%rax
+    1369:	b9 3c 00 00 00       	mov    $0x3c,%ecx
+    136e:	48 8d 15 b3 2c 00 00 	lea    0x2cb3(%rip),%rdx        # 4028 <nel::sort::ninther_n+0x8>
+    1375:	48 8d 35 d4 2c 00 00 	lea    0x2cd4(%rip),%rsi        # 4050 <nel::sort::ninther_n+0x30>
+    137c:	48 89 c7             	mov    %rax,%rdi
+    137f:	e8 7c 0d 00 00       	call   2100 <nel::Context::Context(char const*, char const*, int)>
+    1384:	48 8d 95 80 fd ff ff 	lea    -0x280(%rbp),%rdx
+    138b:	48 8d 85 70 fd ff ff 	lea    -0x290(%rbp),%rax
+    1392:	48 89 d6             	mov    %rdx,%rsi
+    1395:	48 89 c7             	mov    %rax,%rdi
+    1398:	e8 59 12 00 00       	call   25f6 <nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)>
+    139d:	48 89 c2             	mov    %rax,%rdx
+    13a0:	48 8d 85 70 fc ff ff 	lea    -0x390(%rbp),%rax
+    13a7:	48 89 c6             	mov    %rax,%rsi
+    13aa:	48 89 d7             	mov    %rdx,%rdi
+    13ad:	e8 76 12 00 00       	call   2628 <U8Buf<256ul>::operator=(U8Buf<256ul>&&)>
+    13b2:	48 8d 85 70 fd ff ff 	lea    -0x290(%rbp),%rax
+    13b9:	48 89 c7             	mov    %rax,%rdi
+    13bc:	e8 99 11 00 00       	call   255a <nel::Optional<U8Buf<256ul>&>::~Optional()>
+    13c1:	48 8d 85 70 fc ff ff 	lea    -0x390(%rbp),%rax
+    13c8:	48 89 c7             	mov    %rax,%rdi
+    13cb:	e8 24 10 00 00       	call   23f4 <U8Buf<256ul>::~U8Buf()>
+    arr1.try_get(5).unwrap() = U8Buf<256>(0x22);
+    13d0:	48 8d 85 a0 fd ff ff 	lea    -0x260(%rbp),%rax
+    13d7:	be 22 00 00 00       	mov    $0x22,%esi
+    13dc:	48 89 c7             	mov    %rax,%rdi
+    13df:	e8 96 0d 00 00       	call   217a <U8Buf<256ul>::U8Buf(unsigned char)>
+    13e4:	48 8d 85 a0 fe ff ff 	lea    -0x160(%rbp),%rax
+    13eb:	48 8d 8d 70 f3 ff ff 	lea    -0xc90(%rbp),%rcx
+    13f2:	ba 05 00 00 00       	mov    $0x5,%edx
+    13f7:	48 89 ce             	mov    %rcx,%rsi
+    13fa:	48 89 c7             	mov    %rax,%rdi
+    13fd:	e8 14 11 00 00       	call   2516 <nel::heapless::Array<U8Buf<256ul>, 8ul>::try_get(unsigned long)>
+    1402:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    1409:	b9 3d 00 00 00       	mov    $0x3d,%ecx
+    140e:	48 8d 15 13 2c 00 00 	lea    0x2c13(%rip),%rdx        # 4028 <nel::sort::ninther_n+0x8>
+    1415:	48 8d 35 34 2c 00 00 	lea    0x2c34(%rip),%rsi        # 4050 <nel::sort::ninther_n+0x30>
+    141c:	48 89 c7             	mov    %rax,%rdi
+    141f:	e8 dc 0c 00 00       	call   2100 <nel::Context::Context(char const*, char const*, int)>
+    1424:	48 8d 95 b0 fe ff ff 	lea    -0x150(%rbp),%rdx
+    142b:	48 8d 85 a0 fe ff ff 	lea    -0x160(%rbp),%rax
+    1432:	48 89 d6             	mov    %rdx,%rsi
+    1435:	48 89 c7             	mov    %rax,%rdi
+    1438:	e8 b9 11 00 00       	call   25f6 <nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)>
+    143d:	48 89 c2             	mov    %rax,%rdx
+    1440:	48 8d 85 a0 fd ff ff 	lea    -0x260(%rbp),%rax
+    1447:	48 89 c6             	mov    %rax,%rsi
+    144a:	48 89 d7             	mov    %rdx,%rdi
+    144d:	e8 d6 11 00 00       	call   2628 <U8Buf<256ul>::operator=(U8Buf<256ul>&&)>
+    1452:	48 8d 85 a0 fe ff ff 	lea    -0x160(%rbp),%rax
+    1459:	48 89 c7             	mov    %rax,%rdi
+    145c:	e8 f9 10 00 00       	call   255a <nel::Optional<U8Buf<256ul>&>::~Optional()>
+    1461:	48 8d 85 a0 fd ff ff 	lea    -0x260(%rbp),%rax
+    1468:	48 89 c7             	mov    %rax,%rdi
+    146b:	e8 84 0f 00 00       	call   23f4 <U8Buf<256ul>::~U8Buf()>
+    arr1.try_get(6).unwrap() = U8Buf<256>(0x33);
+    1470:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    1477:	be 33 00 00 00       	mov    $0x33,%esi
+    147c:	48 89 c7             	mov    %rax,%rdi
+    147f:	e8 f6 0c 00 00       	call   217a <U8Buf<256ul>::U8Buf(unsigned char)>
+    1484:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1488:	48 8d 8d 70 f3 ff ff 	lea    -0xc90(%rbp),%rcx
+    148f:	ba 06 00 00 00       	mov    $0x6,%edx
+    1494:	48 89 ce             	mov    %rcx,%rsi
+    1497:	48 89 c7             	mov    %rax,%rdi
+    149a:	e8 77 10 00 00       	call   2516 <nel::heapless::Array<U8Buf<256ul>, 8ul>::try_get(unsigned long)>
+    149f:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    14a3:	b9 3e 00 00 00       	mov    $0x3e,%ecx
+    14a8:	48 8d 15 79 2b 00 00 	lea    0x2b79(%rip),%rdx        # 4028 <nel::sort::ninther_n+0x8>
+    14af:	48 8d 35 9a 2b 00 00 	lea    0x2b9a(%rip),%rsi        # 4050 <nel::sort::ninther_n+0x30>
+    14b6:	48 89 c7             	mov    %rax,%rdi
+    14b9:	e8 42 0c 00 00       	call   2100 <nel::Context::Context(char const*, char const*, int)>
+    14be:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    14c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    14c6:	48 89 d6             	mov    %rdx,%rsi
+    14c9:	48 89 c7             	mov    %rax,%rdi
+    14cc:	e8 25 11 00 00       	call   25f6 <nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)>
+    14d1:	48 89 c2             	mov    %rax,%rdx
+    14d4:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    14db:	48 89 c6             	mov    %rax,%rsi
+    14de:	48 89 d7             	mov    %rdx,%rdi
+    14e1:	e8 42 11 00 00       	call   2628 <U8Buf<256ul>::operator=(U8Buf<256ul>&&)>
+    14e6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    14ea:	48 89 c7             	mov    %rax,%rdi
+    14ed:	e8 68 10 00 00       	call   255a <nel::Optional<U8Buf<256ul>&>::~Optional()>
+    14f2:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    14f9:	48 89 c7             	mov    %rax,%rdi
+    14fc:	e8 f3 0e 00 00       	call   23f4 <U8Buf<256ul>::~U8Buf()>
+}
+    1501:	48 8d 85 70 f3 ff ff 	lea    -0xc90(%rbp),%rax
+    1508:	48 89 c7             	mov    %rax,%rdi
+    150b:	e8 28 0c 00 00       	call   2138 <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()>
+    1510:	c9                   	leave
+    1511:	c3                   	ret
+
+0000000000001512 <ex42()::{lambda(U8Buf<256ul>&)#1}::operator()(U8Buf<256ul>&) const>:
+
+void ex42()
+{
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+
+    arr1.iter().for_each([&](U8Buf<256> &v) -> void { nel::log << v << '\n'; });
+    1512:	55                   	push   %rbp
+    1513:	48 89 e5             	mov    %rsp,%rbp
+    1516:	48 83 ec 10          	sub    $0x10,%rsp
+    151a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    151e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1522:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1526:	48 89 c6             	mov    %rax,%rsi
+    1529:	48 8d 05 39 5b 00 00 	lea    0x5b39(%rip),%rax        # 7069 <nel::log>
+    1530:	48 89 c7             	mov    %rax,%rdi
+    1533:	e8 1e 11 00 00       	call   2656 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    1538:	be 0a 00 00 00       	mov    $0xa,%esi
+    153d:	48 89 c7             	mov    %rax,%rdi
+    1540:	e8 66 22 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    1545:	90                   	nop
+    1546:	c9                   	leave
+    1547:	c3                   	ret
+
+0000000000001548 <ex42()>:
+{
+    1548:	55                   	push   %rbp
+    1549:	48 89 e5             	mov    %rsp,%rbp
+    154c:	48 81 ec 20 09 00 00 	sub    $0x920,%rsp
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    1553:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    155a:	be ff 00 00 00       	mov    $0xff,%esi
+    155f:	48 89 c7             	mov    %rax,%rdi
+    1562:	e8 13 0c 00 00       	call   217a <U8Buf<256ul>::U8Buf(unsigned char)>
+    1567:	48 8d 85 e0 f6 ff ff 	lea    -0x920(%rbp),%rax
+    156e:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+    1575:	48 89 d6             	mov    %rdx,%rsi
+    1578:	48 89 c7             	mov    %rax,%rdi
+    157b:	e8 99 0e 00 00       	call   2419 <nel::heapless::Array<U8Buf<256ul>, 8ul>::filled_with(U8Buf<256ul> const&)>
+    1580:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    1587:	48 89 c7             	mov    %rax,%rdi
+    158a:	e8 65 0e 00 00       	call   23f4 <U8Buf<256ul>::~U8Buf()>
+    arr1.iter().for_each([&](U8Buf<256> &v) -> void { nel::log << v << '\n'; });
+    158f:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1593:	48 8d 95 e0 f6 ff ff 	lea    -0x920(%rbp),%rdx
+    159a:	48 89 d6             	mov    %rdx,%rsi
+    159d:	48 89 c7             	mov    %rax,%rdi
+    15a0:	e8 01 0c 00 00       	call   21a6 <nel::heapless::Array<U8Buf<256ul>, 8ul>::iter()>
+    15a5:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    15a9:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    15ad:	48 89 d6             	mov    %rdx,%rsi
+    15b0:	48 89 c7             	mov    %rax,%rdi
+    15b3:	e8 de 07 00 00       	call   1d96 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<ex42()::{lambda(U8Buf<256ul>&)#1}>(ex42()::{lambda(U8Buf<256ul>&)#1}&&)>
+}
+    15b8:	48 8d 85 e0 f6 ff ff 	lea    -0x920(%rbp),%rax
+    15bf:	48 89 c7             	mov    %rax,%rdi
+    15c2:	e8 71 0b 00 00       	call   2138 <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()>
+    15c7:	c9                   	leave
+    15c8:	c3                   	ret
+
+00000000000015c9 <ex51()>:
+
+#if defined(C_LIKE)
+void ex51()
+{
+    15c9:	       55                   	push   %rbp
+    15ca:	       48 89 e5             	mov    %rsp,%rbp
+    15cd:	       48 81 ec 20 09 00 00 	sub    $0x920,%rsp
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    15d4:	       48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+    15db:	       be ff 00 00 00       	mov    $0xff,%esi
+    15e0:	       48 89 c7             	mov    %rax,%rdi
+    15e3:	       e8 92 0b 00 00       	call   217a <U8Buf<256ul>::U8Buf(unsigned char)>
+    15e8:	       48 8d 85 f0 f6 ff ff 	lea    -0x910(%rbp),%rax
+    15ef:	       48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+    15f6:	       48 89 d6             	mov    %rdx,%rsi
+    15f9:	       48 89 c7             	mov    %rax,%rdi
+    15fc:	       e8 18 0e 00 00       	call   2419 <nel::heapless::Array<U8Buf<256ul>, 8ul>::filled_with(U8Buf<256ul> const&)>
+    1601:	       48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+    1608:	       48 89 c7             	mov    %rax,%rdi
+    160b:	       e8 e4 0d 00 00       	call   23f4 <U8Buf<256ul>::~U8Buf()>
+
+    auto it = arr1.iter();
+    1610:	       48 8d 85 e0 f6 ff ff 	lea    -0x920(%rbp),%rax
+    1617:	       48 8d 95 f0 f6 ff ff 	lea    -0x910(%rbp),%rdx
+    161e:	       48 89 d6             	mov    %rdx,%rsi
+    1621:	       48 89 c7             	mov    %rax,%rdi
+    1624:	       e8 7d 0b 00 00       	call   21a6 <nel::heapless::Array<U8Buf<256ul>, 8ul>::iter()>
+    for (; !it.is_done(); it.inc()) {
+    1629:	   /-- eb 45                	jmp    1670 <ex51()+0xa7>
+        auto &v = it.deref();
+    162b:	/--|-> 48 8d 85 e0 f6 ff ff 	lea    -0x920(%rbp),%rax
+    1632:	|  |   48 89 c7             	mov    %rax,%rdi
+    1635:	|  |   e8 30 11 00 00       	call   276a <nel::SliceIterator<U8Buf<256ul> >::deref()>
+    163a:	|  |   48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        nel::log << v << '\n';
+    163e:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1642:	|  |   48 89 c6             	mov    %rax,%rsi
+    1645:	|  |   48 8d 05 1d 5a 00 00 	lea    0x5a1d(%rip),%rax        # 7069 <nel::log>
+    164c:	|  |   48 89 c7             	mov    %rax,%rdi
+    164f:	|  |   e8 02 10 00 00       	call   2656 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    1654:	|  |   be 0a 00 00 00       	mov    $0xa,%esi
+    1659:	|  |   48 89 c7             	mov    %rax,%rdi
+    165c:	|  |   e8 4a 21 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    for (; !it.is_done(); it.inc()) {
+    1661:	|  |   48 8d 85 e0 f6 ff ff 	lea    -0x920(%rbp),%rax
+    1668:	|  |   48 89 c7             	mov    %rax,%rdi
+    166b:	|  |   e8 da 10 00 00       	call   274a <nel::SliceIterator<U8Buf<256ul> >::inc()>
+    1670:	|  \-> 48 8d 85 e0 f6 ff ff 	lea    -0x920(%rbp),%rax
+    1677:	|      48 89 c7             	mov    %rax,%rdi
+    167a:	|      e8 7d 0c 00 00       	call   22fc <nel::SliceIterator<U8Buf<256ul> >::is_done() const>
+    167f:	|      83 f0 01             	xor    $0x1,%eax
+    1682:	|      84 c0                	test   %al,%al
+    1684:	\----- 75 a5                	jne    162b <ex51()+0x62>
+    }
+}
+    1686:	       48 8d 85 f0 f6 ff ff 	lea    -0x910(%rbp),%rax
+    168d:	       48 89 c7             	mov    %rax,%rdi
+    1690:	       e8 a3 0a 00 00       	call   2138 <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()>
+    1695:	       c9                   	leave
+    1696:	       c3                   	ret
+    1697:	       90                   	nop
+
+0000000000001698 <ex52()::{lambda(U8Buf<256ul>&)#1}::operator()(U8Buf<256ul>&) const>:
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+
+#    if defined(RUST_LIKE)
+    arr1.iter().for_each2([&](U8Buf<256> &v) -> void { nel::log << v << '\n'; });
+#    elif defined(C_LIKE)
+    arr1.iter().for_each([&](U8Buf<256> &v) -> void { nel::log << v << '\n'; });
+    1698:	55                   	push   %rbp
+    1699:	48 89 e5             	mov    %rsp,%rbp
+    169c:	48 83 ec 10          	sub    $0x10,%rsp
+    16a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    16a4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    16a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16ac:	48 89 c6             	mov    %rax,%rsi
+    16af:	48 8d 05 b3 59 00 00 	lea    0x59b3(%rip),%rax        # 7069 <nel::log>
+    16b6:	48 89 c7             	mov    %rax,%rdi
+    16b9:	e8 98 0f 00 00       	call   2656 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    16be:	be 0a 00 00 00       	mov    $0xa,%esi
+    16c3:	48 89 c7             	mov    %rax,%rdi
+    16c6:	e8 e0 20 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    16cb:	90                   	nop
+    16cc:	c9                   	leave
+    16cd:	c3                   	ret
+
+00000000000016ce <ex52()>:
+{
+    16ce:	55                   	push   %rbp
+    16cf:	48 89 e5             	mov    %rsp,%rbp
+    16d2:	48 81 ec 20 09 00 00 	sub    $0x920,%rsp
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    16d9:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    16e0:	be ff 00 00 00       	mov    $0xff,%esi
+    16e5:	48 89 c7             	mov    %rax,%rdi
+    16e8:	e8 8d 0a 00 00       	call   217a <U8Buf<256ul>::U8Buf(unsigned char)>
+    16ed:	48 8d 85 e0 f6 ff ff 	lea    -0x920(%rbp),%rax
+    16f4:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+    16fb:	48 89 d6             	mov    %rdx,%rsi
+    16fe:	48 89 c7             	mov    %rax,%rdi
+    1701:	e8 13 0d 00 00       	call   2419 <nel::heapless::Array<U8Buf<256ul>, 8ul>::filled_with(U8Buf<256ul> const&)>
+    1706:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    170d:	48 89 c7             	mov    %rax,%rdi
+    1710:	e8 df 0c 00 00       	call   23f4 <U8Buf<256ul>::~U8Buf()>
+    arr1.iter().for_each([&](U8Buf<256> &v) -> void { nel::log << v << '\n'; });
+    1715:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1719:	48 8d 95 e0 f6 ff ff 	lea    -0x920(%rbp),%rdx
+    1720:	48 89 d6             	mov    %rdx,%rsi
+    1723:	48 89 c7             	mov    %rax,%rdi
+    1726:	e8 7b 0a 00 00       	call   21a6 <nel::heapless::Array<U8Buf<256ul>, 8ul>::iter()>
+    172b:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    172f:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1733:	48 89 d6             	mov    %rdx,%rsi
+    1736:	48 89 c7             	mov    %rax,%rdi
+    1739:	e8 c4 06 00 00       	call   1e02 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<ex52()::{lambda(U8Buf<256ul>&)#1}>(ex52()::{lambda(U8Buf<256ul>&)#1}&&)>
+#    endif
+}
+    173e:	48 8d 85 e0 f6 ff ff 	lea    -0x920(%rbp),%rax
+    1745:	48 89 c7             	mov    %rax,%rdi
+    1748:	e8 eb 09 00 00       	call   2138 <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()>
+    174d:	c9                   	leave
+    174e:	c3                   	ret
+    174f:	90                   	nop
+
+0000000000001750 <ex62()::{lambda(U8Buf<256ul>&)#1}::operator()(U8Buf<256ul>&) const>:
+{
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+
+    auto it = arr1.iter().first_n(2);
+    Index i = 0;
+    it.for_each([&](U8Buf<256> &e) -> void {
+    1750:	55                   	push   %rbp
+    1751:	48 89 e5             	mov    %rsp,%rbp
+    1754:	48 83 ec 10          	sub    $0x10,%rsp
+    1758:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    175c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        nel::log << '[' << i << ']' << ':' << e << '\n';
+    1760:	be 5b 00 00 00       	mov    $0x5b,%esi
+    1765:	48 8d 05 fd 58 00 00 	lea    0x58fd(%rip),%rax        # 7069 <nel::log>
+    176c:	48 89 c7             	mov    %rax,%rdi
+    176f:	e8 37 20 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    1774:	48 89 c2             	mov    %rax,%rdx
+    1777:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    177b:	48 8b 00             	mov    (%rax),%rax
+    177e:	48 8b 00             	mov    (%rax),%rax
+    1781:	48 89 c6             	mov    %rax,%rsi
+    1784:	48 89 d7             	mov    %rdx,%rdi
+    1787:	e8 56 21 00 00       	call   38e2 <nel::operator<<(nel::Log&, unsigned long)>
+    178c:	be 5d 00 00 00       	mov    $0x5d,%esi
+    1791:	48 89 c7             	mov    %rax,%rdi
+    1794:	e8 12 20 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    1799:	be 3a 00 00 00       	mov    $0x3a,%esi
+    179e:	48 89 c7             	mov    %rax,%rdi
+    17a1:	e8 05 20 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    17a6:	48 89 c2             	mov    %rax,%rdx
+    17a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17ad:	48 89 c6             	mov    %rax,%rsi
+    17b0:	48 89 d7             	mov    %rdx,%rdi
+    17b3:	e8 9e 0e 00 00       	call   2656 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    17b8:	be 0a 00 00 00       	mov    $0xa,%esi
+    17bd:	48 89 c7             	mov    %rax,%rdi
+    17c0:	e8 e6 1f 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    17c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17c9:	48 8b 00             	mov    (%rax),%rax
+        ++i;
+    17cc:	48 8b 10             	mov    (%rax),%rdx
+    17cf:	48 83 c2 01          	add    $0x1,%rdx
+    17d3:	48 89 10             	mov    %rdx,(%rax)
+    });
+    17d6:	90                   	nop
+    17d7:	c9                   	leave
+    17d8:	c3                   	ret
+
+00000000000017d9 <ex62()>:
+{
+    17d9:	55                   	push   %rbp
+    17da:	48 89 e5             	mov    %rsp,%rbp
+    17dd:	48 81 ec 50 09 00 00 	sub    $0x950,%rsp
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    17e4:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    17eb:	be ff 00 00 00       	mov    $0xff,%esi
+    17f0:	48 89 c7             	mov    %rax,%rdi
+    17f3:	e8 82 09 00 00       	call   217a <U8Buf<256ul>::U8Buf(unsigned char)>
+    17f8:	48 8d 85 e0 f6 ff ff 	lea    -0x920(%rbp),%rax
+    17ff:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+    1806:	48 89 d6             	mov    %rdx,%rsi
+    1809:	48 89 c7             	mov    %rax,%rdi
+    180c:	e8 08 0c 00 00       	call   2419 <nel::heapless::Array<U8Buf<256ul>, 8ul>::filled_with(U8Buf<256ul> const&)>
+    1811:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    1818:	48 89 c7             	mov    %rax,%rdi
+    181b:	e8 d4 0b 00 00       	call   23f4 <U8Buf<256ul>::~U8Buf()>
+    auto it = arr1.iter().first_n(2);
+    1820:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1824:	48 8d 95 e0 f6 ff ff 	lea    -0x920(%rbp),%rdx
+    182b:	48 89 d6             	mov    %rdx,%rsi
+    182e:	48 89 c7             	mov    %rax,%rdi
+    1831:	e8 70 09 00 00       	call   21a6 <nel::heapless::Array<U8Buf<256ul>, 8ul>::iter()>
+    1836:	48 8d 85 c0 f6 ff ff 	lea    -0x940(%rbp),%rax
+    183d:	48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+    1841:	ba 02 00 00 00       	mov    $0x2,%edx
+    1846:	48 89 ce             	mov    %rcx,%rsi
+    1849:	48 89 c7             	mov    %rax,%rdi
+    184c:	e8 cb 0a 00 00       	call   231c <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::first_n(unsigned long)>
+    Index i = 0;
+    1851:	48 c7 85 b8 f6 ff ff 	movq   $0x0,-0x948(%rbp)
+    1858:	00 00 00 00 
+    it.for_each([&](U8Buf<256> &e) -> void {
+    185c:	48 8d 85 b8 f6 ff ff 	lea    -0x948(%rbp),%rax
+    1863:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1867:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    186b:	48 8d 85 c0 f6 ff ff 	lea    -0x940(%rbp),%rax
+    1872:	48 89 d6             	mov    %rdx,%rsi
+    1875:	48 89 c7             	mov    %rax,%rdi
+    1878:	e8 47 06 00 00       	call   1ec4 <void nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex62()::{lambda(U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&&)>
+}
+    187d:	48 8d 85 e0 f6 ff ff 	lea    -0x920(%rbp),%rax
+    1884:	48 89 c7             	mov    %rax,%rdi
+    1887:	e8 ac 08 00 00       	call   2138 <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()>
+    188c:	c9                   	leave
+    188d:	c3                   	ret
+
+000000000000188e <ex71()>:
+
+#if defined(C_LIKE)
+void ex71()
+{
+    188e:	       55                   	push   %rbp
+    188f:	       48 89 e5             	mov    %rsp,%rbp
+    1892:	       48 81 ec 40 09 00 00 	sub    $0x940,%rsp
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    1899:	       48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    18a0:	       be ff 00 00 00       	mov    $0xff,%esi
+    18a5:	       48 89 c7             	mov    %rax,%rdi
+    18a8:	       e8 cd 08 00 00       	call   217a <U8Buf<256ul>::U8Buf(unsigned char)>
+    18ad:	       48 8d 85 e0 f6 ff ff 	lea    -0x920(%rbp),%rax
+    18b4:	       48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+    18bb:	       48 89 d6             	mov    %rdx,%rsi
+    18be:	       48 89 c7             	mov    %rax,%rdi
+    18c1:	       e8 53 0b 00 00       	call   2419 <nel::heapless::Array<U8Buf<256ul>, 8ul>::filled_with(U8Buf<256ul> const&)>
+    18c6:	       48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    18cd:	       48 89 c7             	mov    %rax,%rdi
+    18d0:	       e8 1f 0b 00 00       	call   23f4 <U8Buf<256ul>::~U8Buf()>
+
+    auto it = arr1.iter().first_n(2);
+    18d5:	       48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    18d9:	       48 8d 95 e0 f6 ff ff 	lea    -0x920(%rbp),%rdx
+    18e0:	       48 89 d6             	mov    %rdx,%rsi
+    18e3:	       48 89 c7             	mov    %rax,%rdi
+    18e6:	       e8 bb 08 00 00       	call   21a6 <nel::heapless::Array<U8Buf<256ul>, 8ul>::iter()>
+    18eb:	       48 8d 85 c0 f6 ff ff 	lea    -0x940(%rbp),%rax
+    18f2:	       48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+    18f6:	       ba 02 00 00 00       	mov    $0x2,%edx
+    18fb:	       48 89 ce             	mov    %rcx,%rsi
+    18fe:	       48 89 c7             	mov    %rax,%rdi
+    1901:	       e8 16 0a 00 00       	call   231c <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::first_n(unsigned long)>
+    Index i = 0;
+    1906:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    190d:	       00 
+    for (; !it.is_done(); it.inc()) {
+    190e:	   /-- e9 86 00 00 00       	jmp    1999 <ex71()+0x10b>
+        // user can miss out the &, so forcing a copy/move of items being enumerated.
+        auto &e = it.deref();
+    1913:	/--|-> 48 8d 85 c0 f6 ff ff 	lea    -0x940(%rbp),%rax
+    191a:	|  |   48 89 c7             	mov    %rax,%rdi
+    191d:	|  |   e8 e6 0e 00 00       	call   2808 <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::deref()>
+    1922:	|  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        nel::log << '[' << i << ']' << ':' << e << '\n';
+    1926:	|  |   be 5b 00 00 00       	mov    $0x5b,%esi
+    192b:	|  |   48 8d 05 37 57 00 00 	lea    0x5737(%rip),%rax        # 7069 <nel::log>
+    1932:	|  |   48 89 c7             	mov    %rax,%rdi
+    1935:	|  |   e8 71 1e 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    193a:	|  |   48 89 c2             	mov    %rax,%rdx
+    193d:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1941:	|  |   48 89 c6             	mov    %rax,%rsi
+    1944:	|  |   48 89 d7             	mov    %rdx,%rdi
+    1947:	|  |   e8 96 1f 00 00       	call   38e2 <nel::operator<<(nel::Log&, unsigned long)>
+    194c:	|  |   be 5d 00 00 00       	mov    $0x5d,%esi
+    1951:	|  |   48 89 c7             	mov    %rax,%rdi
+    1954:	|  |   e8 52 1e 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    1959:	|  |   be 3a 00 00 00       	mov    $0x3a,%esi
+    195e:	|  |   48 89 c7             	mov    %rax,%rdi
+    1961:	|  |   e8 45 1e 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    1966:	|  |   48 89 c2             	mov    %rax,%rdx
+    1969:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    196d:	|  |   48 89 c6             	mov    %rax,%rsi
+    1970:	|  |   48 89 d7             	mov    %rdx,%rdi
+    1973:	|  |   e8 de 0c 00 00       	call   2656 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    1978:	|  |   be 0a 00 00 00       	mov    $0xa,%esi
+    197d:	|  |   48 89 c7             	mov    %rax,%rdi
+    1980:	|  |   e8 26 1e 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+        ++i;
+    1985:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    for (; !it.is_done(); it.inc()) {
+    198a:	|  |   48 8d 85 c0 f6 ff ff 	lea    -0x940(%rbp),%rax
+    1991:	|  |   48 89 c7             	mov    %rax,%rdi
+    1994:	|  |   e8 3f 0e 00 00       	call   27d8 <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::inc()>
+    1999:	|  \-> 48 8d 85 c0 f6 ff ff 	lea    -0x940(%rbp),%rax
+    19a0:	|      48 89 c7             	mov    %rax,%rdi
+    19a3:	|      e8 2c 0a 00 00       	call   23d4 <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::is_done() const>
+    19a8:	|      83 f0 01             	xor    $0x1,%eax
+    19ab:	|      84 c0                	test   %al,%al
+    19ad:	\----- 0f 85 60 ff ff ff    	jne    1913 <ex71()+0x85>
+    }
+}
+    19b3:	       48 8d 85 e0 f6 ff ff 	lea    -0x920(%rbp),%rax
+    19ba:	       48 89 c7             	mov    %rax,%rdi
+    19bd:	       e8 76 07 00 00       	call   2138 <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()>
+    19c2:	       c9                   	leave
+    19c3:	       c3                   	ret
+
+00000000000019c4 <ex72()::{lambda(U8Buf<256ul>&)#1}::operator()(U8Buf<256ul>&) const>:
+    it.for_each2([&](U8Buf<256> &e) -> void {
+        nel::log << '[' << i << ']' << ':' << e << '\n';
+        ++i;
+    });
+#    elif defined(C_LIKE)
+    it.for_each([&](U8Buf<256> &e) -> void {
+    19c4:	55                   	push   %rbp
+    19c5:	48 89 e5             	mov    %rsp,%rbp
+    19c8:	48 83 ec 10          	sub    $0x10,%rsp
+    19cc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    19d0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        nel::log << '[' << i << ']' << ':' << e << '\n';
+    19d4:	be 5b 00 00 00       	mov    $0x5b,%esi
+    19d9:	48 8d 05 89 56 00 00 	lea    0x5689(%rip),%rax        # 7069 <nel::log>
+    19e0:	48 89 c7             	mov    %rax,%rdi
+    19e3:	e8 c3 1d 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    19e8:	48 89 c2             	mov    %rax,%rdx
+    19eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19ef:	48 8b 00             	mov    (%rax),%rax
+    19f2:	48 8b 00             	mov    (%rax),%rax
+    19f5:	48 89 c6             	mov    %rax,%rsi
+    19f8:	48 89 d7             	mov    %rdx,%rdi
+    19fb:	e8 e2 1e 00 00       	call   38e2 <nel::operator<<(nel::Log&, unsigned long)>
+    1a00:	be 5d 00 00 00       	mov    $0x5d,%esi
+    1a05:	48 89 c7             	mov    %rax,%rdi
+    1a08:	e8 9e 1d 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    1a0d:	be 3a 00 00 00       	mov    $0x3a,%esi
+    1a12:	48 89 c7             	mov    %rax,%rdi
+    1a15:	e8 91 1d 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    1a1a:	48 89 c2             	mov    %rax,%rdx
+    1a1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a21:	48 89 c6             	mov    %rax,%rsi
+    1a24:	48 89 d7             	mov    %rdx,%rdi
+    1a27:	e8 2a 0c 00 00       	call   2656 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    1a2c:	be 0a 00 00 00       	mov    $0xa,%esi
+    1a31:	48 89 c7             	mov    %rax,%rdi
+    1a34:	e8 72 1d 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    1a39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a3d:	48 8b 00             	mov    (%rax),%rax
+        ++i;
+    1a40:	48 8b 10             	mov    (%rax),%rdx
+    1a43:	48 83 c2 01          	add    $0x1,%rdx
+    1a47:	48 89 10             	mov    %rdx,(%rax)
+    });
+    1a4a:	90                   	nop
+    1a4b:	c9                   	leave
+    1a4c:	c3                   	ret
+
+0000000000001a4d <ex72()>:
+{
+    1a4d:	55                   	push   %rbp
+    1a4e:	48 89 e5             	mov    %rsp,%rbp
+    1a51:	48 81 ec 50 09 00 00 	sub    $0x950,%rsp
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    1a58:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    1a5f:	be ff 00 00 00       	mov    $0xff,%esi
+    1a64:	48 89 c7             	mov    %rax,%rdi
+    1a67:	e8 0e 07 00 00       	call   217a <U8Buf<256ul>::U8Buf(unsigned char)>
+    1a6c:	48 8d 85 e0 f6 ff ff 	lea    -0x920(%rbp),%rax
+    1a73:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+    1a7a:	48 89 d6             	mov    %rdx,%rsi
+    1a7d:	48 89 c7             	mov    %rax,%rdi
+    1a80:	e8 94 09 00 00       	call   2419 <nel::heapless::Array<U8Buf<256ul>, 8ul>::filled_with(U8Buf<256ul> const&)>
+    1a85:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    1a8c:	48 89 c7             	mov    %rax,%rdi
+    1a8f:	e8 60 09 00 00       	call   23f4 <U8Buf<256ul>::~U8Buf()>
+    auto it = arr1.iter().first_n(2);
+    1a94:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1a98:	48 8d 95 e0 f6 ff ff 	lea    -0x920(%rbp),%rdx
+    1a9f:	48 89 d6             	mov    %rdx,%rsi
+    1aa2:	48 89 c7             	mov    %rax,%rdi
+    1aa5:	e8 fc 06 00 00       	call   21a6 <nel::heapless::Array<U8Buf<256ul>, 8ul>::iter()>
+    1aaa:	48 8d 85 c0 f6 ff ff 	lea    -0x940(%rbp),%rax
+    1ab1:	48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+    1ab5:	ba 02 00 00 00       	mov    $0x2,%edx
+    1aba:	48 89 ce             	mov    %rcx,%rsi
+    1abd:	48 89 c7             	mov    %rax,%rdi
+    1ac0:	e8 57 08 00 00       	call   231c <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::first_n(unsigned long)>
+    Index i = 0;
+    1ac5:	48 c7 85 b8 f6 ff ff 	movq   $0x0,-0x948(%rbp)
+    1acc:	00 00 00 00 
+    it.for_each([&](U8Buf<256> &e) -> void {
+    1ad0:	48 8d 85 b8 f6 ff ff 	lea    -0x948(%rbp),%rax
+    1ad7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1adb:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    1adf:	48 8d 85 c0 f6 ff ff 	lea    -0x940(%rbp),%rax
+    1ae6:	48 89 d6             	mov    %rdx,%rsi
+    1ae9:	48 89 c7             	mov    %rax,%rdi
+    1aec:	e8 7f 04 00 00       	call   1f70 <void nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex72()::{lambda(U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&&)>
+#    endif
+}
+    1af1:	48 8d 85 e0 f6 ff ff 	lea    -0x920(%rbp),%rax
+    1af8:	48 89 c7             	mov    %rax,%rdi
+    1afb:	e8 38 06 00 00       	call   2138 <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()>
+    1b00:	c9                   	leave
+    1b01:	c3                   	ret
+
+0000000000001b02 <main>:
+#endif
+
+int main()
+{
+    1b02:	55                   	push   %rbp
+    1b03:	48 89 e5             	mov    %rsp,%rbp
+    nel::log << "ex1:b" << '\n';
+    1b06:	48 8d 05 47 25 00 00 	lea    0x2547(%rip),%rax        # 4054 <nel::sort::ninther_n+0x34>
+    1b0d:	48 89 c6             	mov    %rax,%rsi
+    1b10:	48 8d 05 52 55 00 00 	lea    0x5552(%rip),%rax        # 7069 <nel::log>
+    1b17:	48 89 c7             	mov    %rax,%rdi
+    1b1a:	e8 b8 1c 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+    1b1f:	be 0a 00 00 00       	mov    $0xa,%esi
+    1b24:	48 89 c7             	mov    %rax,%rdi
+    1b27:	e8 7f 1c 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    ex1();
+    1b2c:	e8 3a f7 ff ff       	call   126b <ex1()>
+    nel::log << "ex1:e" << '\n';
+    1b31:	48 8d 05 22 25 00 00 	lea    0x2522(%rip),%rax        # 405a <nel::sort::ninther_n+0x3a>
+    1b38:	48 89 c6             	mov    %rax,%rsi
+    1b3b:	48 8d 05 27 55 00 00 	lea    0x5527(%rip),%rax        # 7069 <nel::log>
+    1b42:	48 89 c7             	mov    %rax,%rdi
+    1b45:	e8 8d 1c 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+    1b4a:	be 0a 00 00 00       	mov    $0xa,%esi
+    1b4f:	48 89 c7             	mov    %rax,%rdi
+    1b52:	e8 54 1c 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    // nel::log << "ex2:b" << '\n';
+    // ex2();
+    // nel::log << "ex2:e" << '\n';
+    nel::log << "ex3:b" << '\n';
+    1b57:	48 8d 05 02 25 00 00 	lea    0x2502(%rip),%rax        # 4060 <nel::sort::ninther_n+0x40>
+    1b5e:	48 89 c6             	mov    %rax,%rsi
+    1b61:	48 8d 05 01 55 00 00 	lea    0x5501(%rip),%rax        # 7069 <nel::log>
+    1b68:	48 89 c7             	mov    %rax,%rdi
+    1b6b:	e8 67 1c 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+    1b70:	be 0a 00 00 00       	mov    $0xa,%esi
+    1b75:	48 89 c7             	mov    %rax,%rdi
+    1b78:	e8 2e 1c 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    ex3();
+    1b7d:	e8 67 f7 ff ff       	call   12e9 <ex3()>
+    nel::log << "ex3:e" << '\n';
+    1b82:	48 8d 05 dd 24 00 00 	lea    0x24dd(%rip),%rax        # 4066 <nel::sort::ninther_n+0x46>
+    1b89:	48 89 c6             	mov    %rax,%rsi
+    1b8c:	48 8d 05 d6 54 00 00 	lea    0x54d6(%rip),%rax        # 7069 <nel::log>
+    1b93:	48 89 c7             	mov    %rax,%rdi
+    1b96:	e8 3c 1c 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+    1b9b:	be 0a 00 00 00       	mov    $0xa,%esi
+    1ba0:	48 89 c7             	mov    %rax,%rdi
+    1ba3:	e8 03 1c 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+#if defined(RUST_LIKE)
+    nel::log << "ex41:b" << '\n';
+    ex41();
+    nel::log << "ex41:e" << '\n';
+#endif
+    nel::log << "ex42:b" << '\n';
+    1ba8:	48 8d 05 bd 24 00 00 	lea    0x24bd(%rip),%rax        # 406c <nel::sort::ninther_n+0x4c>
+    1baf:	48 89 c6             	mov    %rax,%rsi
+    1bb2:	48 8d 05 b0 54 00 00 	lea    0x54b0(%rip),%rax        # 7069 <nel::log>
+    1bb9:	48 89 c7             	mov    %rax,%rdi
+    1bbc:	e8 16 1c 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+    1bc1:	be 0a 00 00 00       	mov    $0xa,%esi
+    1bc6:	48 89 c7             	mov    %rax,%rdi
+    1bc9:	e8 dd 1b 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    ex42();
+    1bce:	e8 75 f9 ff ff       	call   1548 <ex42()>
+    nel::log << "ex42:e" << '\n';
+    1bd3:	48 8d 05 99 24 00 00 	lea    0x2499(%rip),%rax        # 4073 <nel::sort::ninther_n+0x53>
+    1bda:	48 89 c6             	mov    %rax,%rsi
+    1bdd:	48 8d 05 85 54 00 00 	lea    0x5485(%rip),%rax        # 7069 <nel::log>
+    1be4:	48 89 c7             	mov    %rax,%rdi
+    1be7:	e8 eb 1b 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+    1bec:	be 0a 00 00 00       	mov    $0xa,%esi
+    1bf1:	48 89 c7             	mov    %rax,%rdi
+    1bf4:	e8 b2 1b 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+#if defined(C_LIKE)
+    nel::log << "ex51:b" << '\n';
+    1bf9:	48 8d 05 7a 24 00 00 	lea    0x247a(%rip),%rax        # 407a <nel::sort::ninther_n+0x5a>
+    1c00:	48 89 c6             	mov    %rax,%rsi
+    1c03:	48 8d 05 5f 54 00 00 	lea    0x545f(%rip),%rax        # 7069 <nel::log>
+    1c0a:	48 89 c7             	mov    %rax,%rdi
+    1c0d:	e8 c5 1b 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+    1c12:	be 0a 00 00 00       	mov    $0xa,%esi
+    1c17:	48 89 c7             	mov    %rax,%rdi
+    1c1a:	e8 8c 1b 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    ex51();
+    1c1f:	e8 a5 f9 ff ff       	call   15c9 <ex51()>
+    nel::log << "ex51:e" << '\n';
+    1c24:	48 8d 05 56 24 00 00 	lea    0x2456(%rip),%rax        # 4081 <nel::sort::ninther_n+0x61>
+    1c2b:	48 89 c6             	mov    %rax,%rsi
+    1c2e:	48 8d 05 34 54 00 00 	lea    0x5434(%rip),%rax        # 7069 <nel::log>
+    1c35:	48 89 c7             	mov    %rax,%rdi
+    1c38:	e8 9a 1b 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+    1c3d:	be 0a 00 00 00       	mov    $0xa,%esi
+    1c42:	48 89 c7             	mov    %rax,%rdi
+    1c45:	e8 61 1b 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex52:b" << '\n';
+    1c4a:	48 8d 05 37 24 00 00 	lea    0x2437(%rip),%rax        # 4088 <nel::sort::ninther_n+0x68>
+    1c51:	48 89 c6             	mov    %rax,%rsi
+    1c54:	48 8d 05 0e 54 00 00 	lea    0x540e(%rip),%rax        # 7069 <nel::log>
+    1c5b:	48 89 c7             	mov    %rax,%rdi
+    1c5e:	e8 74 1b 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+    1c63:	be 0a 00 00 00       	mov    $0xa,%esi
+    1c68:	48 89 c7             	mov    %rax,%rdi
+    1c6b:	e8 3b 1b 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    ex52();
+    1c70:	e8 59 fa ff ff       	call   16ce <ex52()>
+    nel::log << "ex52:e" << '\n';
+    1c75:	48 8d 05 13 24 00 00 	lea    0x2413(%rip),%rax        # 408f <nel::sort::ninther_n+0x6f>
+    1c7c:	48 89 c6             	mov    %rax,%rsi
+    1c7f:	48 8d 05 e3 53 00 00 	lea    0x53e3(%rip),%rax        # 7069 <nel::log>
+    1c86:	48 89 c7             	mov    %rax,%rdi
+    1c89:	e8 49 1b 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+    1c8e:	be 0a 00 00 00       	mov    $0xa,%esi
+    1c93:	48 89 c7             	mov    %rax,%rdi
+    1c96:	e8 10 1b 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+#if defined(RUST_LIKE)
+    nel::log << "ex61:b" << '\n';
+    ex61();
+    nel::log << "ex61:e" << '\n';
+#endif
+    nel::log << "ex62:b" << '\n';
+    1c9b:	48 8d 05 f4 23 00 00 	lea    0x23f4(%rip),%rax        # 4096 <nel::sort::ninther_n+0x76>
+    1ca2:	48 89 c6             	mov    %rax,%rsi
+    1ca5:	48 8d 05 bd 53 00 00 	lea    0x53bd(%rip),%rax        # 7069 <nel::log>
+    1cac:	48 89 c7             	mov    %rax,%rdi
+    1caf:	e8 23 1b 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+    1cb4:	be 0a 00 00 00       	mov    $0xa,%esi
+    1cb9:	48 89 c7             	mov    %rax,%rdi
+    1cbc:	e8 ea 1a 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    ex62();
+    1cc1:	e8 13 fb ff ff       	call   17d9 <ex62()>
+    nel::log << "ex62:e" << '\n';
+    1cc6:	48 8d 05 d0 23 00 00 	lea    0x23d0(%rip),%rax        # 409d <nel::sort::ninther_n+0x7d>
+    1ccd:	48 89 c6             	mov    %rax,%rsi
+    1cd0:	48 8d 05 92 53 00 00 	lea    0x5392(%rip),%rax        # 7069 <nel::log>
+    1cd7:	48 89 c7             	mov    %rax,%rdi
+    1cda:	e8 f8 1a 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+    1cdf:	be 0a 00 00 00       	mov    $0xa,%esi
+    1ce4:	48 89 c7             	mov    %rax,%rdi
+    1ce7:	e8 bf 1a 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+
+#if defined(C_LIKE)
+    nel::log << "ex71:b" << '\n';
+    1cec:	48 8d 05 b1 23 00 00 	lea    0x23b1(%rip),%rax        # 40a4 <nel::sort::ninther_n+0x84>
+    1cf3:	48 89 c6             	mov    %rax,%rsi
+    1cf6:	48 8d 05 6c 53 00 00 	lea    0x536c(%rip),%rax        # 7069 <nel::log>
+    1cfd:	48 89 c7             	mov    %rax,%rdi
+    1d00:	e8 d2 1a 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+    1d05:	be 0a 00 00 00       	mov    $0xa,%esi
+    1d0a:	48 89 c7             	mov    %rax,%rdi
+    1d0d:	e8 99 1a 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    ex71();
+    1d12:	e8 77 fb ff ff       	call   188e <ex71()>
+    nel::log << "ex71:e" << '\n';
+    1d17:	48 8d 05 8d 23 00 00 	lea    0x238d(%rip),%rax        # 40ab <nel::sort::ninther_n+0x8b>
+    1d1e:	48 89 c6             	mov    %rax,%rsi
+    1d21:	48 8d 05 41 53 00 00 	lea    0x5341(%rip),%rax        # 7069 <nel::log>
+    1d28:	48 89 c7             	mov    %rax,%rdi
+    1d2b:	e8 a7 1a 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+    1d30:	be 0a 00 00 00       	mov    $0xa,%esi
+    1d35:	48 89 c7             	mov    %rax,%rdi
+    1d38:	e8 6e 1a 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+
+    nel::log << "ex72:b" << '\n';
+    1d3d:	48 8d 05 6e 23 00 00 	lea    0x236e(%rip),%rax        # 40b2 <nel::sort::ninther_n+0x92>
+    1d44:	48 89 c6             	mov    %rax,%rsi
+    1d47:	48 8d 05 1b 53 00 00 	lea    0x531b(%rip),%rax        # 7069 <nel::log>
+    1d4e:	48 89 c7             	mov    %rax,%rdi
+    1d51:	e8 81 1a 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+    1d56:	be 0a 00 00 00       	mov    $0xa,%esi
+    1d5b:	48 89 c7             	mov    %rax,%rdi
+    1d5e:	e8 48 1a 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    ex72();
+    1d63:	e8 e5 fc ff ff       	call   1a4d <ex72()>
+    nel::log << "ex72:e" << '\n';
+    1d68:	48 8d 05 4a 23 00 00 	lea    0x234a(%rip),%rax        # 40b9 <nel::sort::ninther_n+0x99>
+    1d6f:	48 89 c6             	mov    %rax,%rsi
+    1d72:	48 8d 05 f0 52 00 00 	lea    0x52f0(%rip),%rax        # 7069 <nel::log>
+    1d79:	48 89 c7             	mov    %rax,%rdi
+    1d7c:	e8 56 1a 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+    1d81:	be 0a 00 00 00       	mov    $0xa,%esi
+    1d86:	48 89 c7             	mov    %rax,%rdi
+    1d89:	e8 1d 1a 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+#endif
+}
+    1d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d93:	5d                   	pop    %rbp
+    1d94:	c3                   	ret
+    1d95:	90                   	nop
+
+0000000000001d96 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<ex42()::{lambda(U8Buf<256ul>&)#1}>(ex42()::{lambda(U8Buf<256ul>&)#1}&&)>:
+         * @param fn func to apply to each item in iterator
+         */
+        // void for_each(std::function<void(OutT)> fn)
+#    if defined(C_LIKE) || defined(RUST_LIKE)
+        template<typename F>
+        void for_each(F &&fn)
+    1d96:	       55                   	push   %rbp
+    1d97:	       48 89 e5             	mov    %rsp,%rbp
+    1d9a:	       48 83 ec 10          	sub    $0x10,%rsp
+    1d9e:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1da2:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        template<typename F>
+        void for_each2(F &&fn)
+#        endif
+        {
+#        if 1
+            for (; !self().is_done(); self().inc()) {
+    1da6:	   /-- eb 3a                	jmp    1de2 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<ex42()::{lambda(U8Buf<256ul>&)#1}>(ex42()::{lambda(U8Buf<256ul>&)#1}&&)+0x4c>
+                fn(self().deref());
+    1da8:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dac:	|  |   48 89 c7             	mov    %rax,%rdi
+    1daf:	|  |   e8 ac 05 00 00       	call   2360 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    1db4:	|  |   48 89 c7             	mov    %rax,%rdi
+    1db7:	|  |   e8 ae 09 00 00       	call   276a <nel::SliceIterator<U8Buf<256ul> >::deref()>
+    1dbc:	|  |   48 89 c2             	mov    %rax,%rdx
+    1dbf:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1dc3:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1dc6:	|  |   48 89 c7             	mov    %rax,%rdi
+    1dc9:	|  |   e8 44 f7 ff ff       	call   1512 <ex42()::{lambda(U8Buf<256ul>&)#1}::operator()(U8Buf<256ul>&) const>
+            for (; !self().is_done(); self().inc()) {
+    1dce:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dd2:	|  |   48 89 c7             	mov    %rax,%rdi
+    1dd5:	|  |   e8 86 05 00 00       	call   2360 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    1dda:	|  |   48 89 c7             	mov    %rax,%rdi
+    1ddd:	|  |   e8 68 09 00 00       	call   274a <nel::SliceIterator<U8Buf<256ul> >::inc()>
+    1de2:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1de6:	|      48 89 c7             	mov    %rax,%rdi
+    1de9:	|      e8 72 05 00 00       	call   2360 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    1dee:	|      48 89 c7             	mov    %rax,%rdi
+    1df1:	|      e8 06 05 00 00       	call   22fc <nel::SliceIterator<U8Buf<256ul> >::is_done() const>
+    1df6:	|      83 f0 01             	xor    $0x1,%eax
+    1df9:	|      84 c0                	test   %al,%al
+    1dfb:	\----- 75 ab                	jne    1da8 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<ex42()::{lambda(U8Buf<256ul>&)#1}>(ex42()::{lambda(U8Buf<256ul>&)#1}&&)+0x12>
+            fn(self().deref());
+            self().inc();
+enter:
+            if (!self().is_done()) { goto loop; }
+#        endif
+        }
+    1dfd:	       90                   	nop
+    1dfe:	       90                   	nop
+    1dff:	       c9                   	leave
+    1e00:	       c3                   	ret
+    1e01:	       90                   	nop
+
+0000000000001e02 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<ex52()::{lambda(U8Buf<256ul>&)#1}>(ex52()::{lambda(U8Buf<256ul>&)#1}&&)>:
+        void for_each(F &&fn)
+    1e02:	       55                   	push   %rbp
+    1e03:	       48 89 e5             	mov    %rsp,%rbp
+    1e06:	       48 83 ec 10          	sub    $0x10,%rsp
+    1e0a:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1e0e:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            for (; !self().is_done(); self().inc()) {
+    1e12:	   /-- eb 3a                	jmp    1e4e <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<ex52()::{lambda(U8Buf<256ul>&)#1}>(ex52()::{lambda(U8Buf<256ul>&)#1}&&)+0x4c>
+                fn(self().deref());
+    1e14:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e18:	|  |   48 89 c7             	mov    %rax,%rdi
+    1e1b:	|  |   e8 40 05 00 00       	call   2360 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    1e20:	|  |   48 89 c7             	mov    %rax,%rdi
+    1e23:	|  |   e8 42 09 00 00       	call   276a <nel::SliceIterator<U8Buf<256ul> >::deref()>
+    1e28:	|  |   48 89 c2             	mov    %rax,%rdx
+    1e2b:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e2f:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1e32:	|  |   48 89 c7             	mov    %rax,%rdi
+    1e35:	|  |   e8 5e f8 ff ff       	call   1698 <ex52()::{lambda(U8Buf<256ul>&)#1}::operator()(U8Buf<256ul>&) const>
+            for (; !self().is_done(); self().inc()) {
+    1e3a:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e3e:	|  |   48 89 c7             	mov    %rax,%rdi
+    1e41:	|  |   e8 1a 05 00 00       	call   2360 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    1e46:	|  |   48 89 c7             	mov    %rax,%rdi
+    1e49:	|  |   e8 fc 08 00 00       	call   274a <nel::SliceIterator<U8Buf<256ul> >::inc()>
+    1e4e:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e52:	|      48 89 c7             	mov    %rax,%rdi
+    1e55:	|      e8 06 05 00 00       	call   2360 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    1e5a:	|      48 89 c7             	mov    %rax,%rdi
+    1e5d:	|      e8 9a 04 00 00       	call   22fc <nel::SliceIterator<U8Buf<256ul> >::is_done() const>
+    1e62:	|      83 f0 01             	xor    $0x1,%eax
+    1e65:	|      84 c0                	test   %al,%al
+    1e67:	\----- 75 ab                	jne    1e14 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<ex52()::{lambda(U8Buf<256ul>&)#1}>(ex52()::{lambda(U8Buf<256ul>&)#1}&&)+0x12>
+        }
+    1e69:	       90                   	nop
+    1e6a:	       90                   	nop
+    1e6b:	       c9                   	leave
+    1e6c:	       c3                   	ret
+    1e6d:	       90                   	nop
+
+0000000000001e6e <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex62()::{lambda(U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}::operator()(bool&, U8Buf<256ul>&) const>:
+        template<typename F>
+        void for_each(F &&fn)
+        {
+            if (current_ >= limit_) { return; }
+            bool unused = true;
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    1e6e:	55                   	push   %rbp
+    1e6f:	48 89 e5             	mov    %rsp,%rbp
+    1e72:	48 83 ec 20          	sub    $0x20,%rsp
+    1e76:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1e7a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1e7e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1e82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e86:	48 8b 40 08          	mov    0x8(%rax),%rax
+                fn(e);
+    1e8a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1e8e:	48 89 d6             	mov    %rdx,%rsi
+    1e91:	48 89 c7             	mov    %rax,%rdi
+    1e94:	e8 b7 f8 ff ff       	call   1750 <ex62()::{lambda(U8Buf<256ul>&)#1}::operator()(U8Buf<256ul>&) const>
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    1e99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e9d:	48 8b 00             	mov    (%rax),%rax
+                return ++current_ < limit_;
+    1ea0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+    1ea4:	48 83 c2 01          	add    $0x1,%rdx
+    1ea8:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    1eac:	48 8b 50 10          	mov    0x10(%rax),%rdx
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    1eb0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1eb4:	48 8b 00             	mov    (%rax),%rax
+                return ++current_ < limit_;
+    1eb7:	48 8b 40 18          	mov    0x18(%rax),%rax
+    1ebb:	48 39 c2             	cmp    %rax,%rdx
+    1ebe:	0f 92 c0             	setb   %al
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    1ec1:	c9                   	leave
+    1ec2:	c3                   	ret
+    1ec3:	90                   	nop
+
+0000000000001ec4 <void nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex62()::{lambda(U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&&)>:
+        void for_each(F &&fn)
+    1ec4:	       55                   	push   %rbp
+    1ec5:	       48 89 e5             	mov    %rsp,%rbp
+    1ec8:	       48 83 ec 30          	sub    $0x30,%rsp
+    1ecc:	       48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1ed0:	       48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+            if (current_ >= limit_) { return; }
+    1ed4:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1ed8:	       48 8b 50 10          	mov    0x10(%rax),%rdx
+    1edc:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1ee0:	       48 8b 40 18          	mov    0x18(%rax),%rax
+    1ee4:	       48 39 c2             	cmp    %rax,%rdx
+    1ee7:	/----- 73 2d                	jae    1f16 <void nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex62()::{lambda(U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&&)+0x52>
+            bool unused = true;
+    1ee9:	|      c6 45 ef 01          	movb   $0x1,-0x11(%rbp)
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    1eed:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1ef1:	|      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1ef5:	|      48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    1ef9:	|      48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1efd:	|      48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    1f01:	|      48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    1f05:	|      48 8d 4d ef          	lea    -0x11(%rbp),%rcx
+    1f09:	|      48 89 ce             	mov    %rcx,%rsi
+    1f0c:	|      48 89 c7             	mov    %rax,%rdi
+    1f0f:	|      e8 b2 00 00 00       	call   1fc6 <bool nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::try_fold<bool, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex62()::{lambda(U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex62()::{lambda(U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}&&)>
+    1f14:	|  /-- eb 01                	jmp    1f17 <void nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex62()::{lambda(U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&&)+0x53>
+            if (current_ >= limit_) { return; }
+    1f16:	\--|-> 90                   	nop
+            });
+        }
+    1f17:	   \-> c9                   	leave
+    1f18:	       c3                   	ret
+    1f19:	       90                   	nop
+
+0000000000001f1a <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex72()::{lambda(U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}::operator()(bool&, U8Buf<256ul>&) const>:
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    1f1a:	55                   	push   %rbp
+    1f1b:	48 89 e5             	mov    %rsp,%rbp
+    1f1e:	48 83 ec 20          	sub    $0x20,%rsp
+    1f22:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f26:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1f2a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1f2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f32:	48 8b 40 08          	mov    0x8(%rax),%rax
+                fn(e);
+    1f36:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1f3a:	48 89 d6             	mov    %rdx,%rsi
+    1f3d:	48 89 c7             	mov    %rax,%rdi
+    1f40:	e8 7f fa ff ff       	call   19c4 <ex72()::{lambda(U8Buf<256ul>&)#1}::operator()(U8Buf<256ul>&) const>
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    1f45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f49:	48 8b 00             	mov    (%rax),%rax
+                return ++current_ < limit_;
+    1f4c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+    1f50:	48 83 c2 01          	add    $0x1,%rdx
+    1f54:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    1f58:	48 8b 50 10          	mov    0x10(%rax),%rdx
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    1f5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f60:	48 8b 00             	mov    (%rax),%rax
+                return ++current_ < limit_;
+    1f63:	48 8b 40 18          	mov    0x18(%rax),%rax
+    1f67:	48 39 c2             	cmp    %rax,%rdx
+    1f6a:	0f 92 c0             	setb   %al
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    1f6d:	c9                   	leave
+    1f6e:	c3                   	ret
+    1f6f:	90                   	nop
+
+0000000000001f70 <void nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex72()::{lambda(U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&&)>:
+        void for_each(F &&fn)
+    1f70:	       55                   	push   %rbp
+    1f71:	       48 89 e5             	mov    %rsp,%rbp
+    1f74:	       48 83 ec 30          	sub    $0x30,%rsp
+    1f78:	       48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1f7c:	       48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+            if (current_ >= limit_) { return; }
+    1f80:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1f84:	       48 8b 50 10          	mov    0x10(%rax),%rdx
+    1f88:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1f8c:	       48 8b 40 18          	mov    0x18(%rax),%rax
+    1f90:	       48 39 c2             	cmp    %rax,%rdx
+    1f93:	/----- 73 2d                	jae    1fc2 <void nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex72()::{lambda(U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&&)+0x52>
+            bool unused = true;
+    1f95:	|      c6 45 ef 01          	movb   $0x1,-0x11(%rbp)
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+    1f99:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1f9d:	|      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1fa1:	|      48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    1fa5:	|      48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1fa9:	|      48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    1fad:	|      48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    1fb1:	|      48 8d 4d ef          	lea    -0x11(%rbp),%rcx
+    1fb5:	|      48 89 ce             	mov    %rcx,%rsi
+    1fb8:	|      48 89 c7             	mov    %rax,%rdi
+    1fbb:	|      e8 9a 00 00 00       	call   205a <bool nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::try_fold<bool, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex72()::{lambda(U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex72()::{lambda(U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}&&)>
+    1fc0:	|  /-- eb 01                	jmp    1fc3 <void nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex72()::{lambda(U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&&)+0x53>
+            if (current_ >= limit_) { return; }
+    1fc2:	\--|-> 90                   	nop
+        }
+    1fc3:	   \-> c9                   	leave
+    1fc4:	       c3                   	ret
+    1fc5:	       90                   	nop
+
+0000000000001fc6 <bool nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::try_fold<bool, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex62()::{lambda(U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex62()::{lambda(U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}&&)>:
+        bool try_fold(U &acc, F &&fn)
+    1fc6:	          55                   	push   %rbp
+    1fc7:	          48 89 e5             	mov    %rsp,%rbp
+    1fca:	          48 83 ec 30          	sub    $0x30,%rsp
+    1fce:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1fd2:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1fd6:	          48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            while (!self().is_done()) {
+    1fda:	   /----- eb 5c                	jmp    2038 <bool nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::try_fold<bool, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex62()::{lambda(U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex62()::{lambda(U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}&&)+0x72>
+                OutT e = self().deref();
+    1fdc:	/--|----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1fe0:	|  |      48 89 c7             	mov    %rax,%rdi
+    1fe3:	|  |      e8 78 03 00 00       	call   2360 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    1fe8:	|  |      48 89 c7             	mov    %rax,%rdi
+    1feb:	|  |      e8 7a 07 00 00       	call   276a <nel::SliceIterator<U8Buf<256ul> >::deref()>
+    1ff0:	|  |      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                self().inc();
+    1ff4:	|  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ff8:	|  |      48 89 c7             	mov    %rax,%rdi
+    1ffb:	|  |      e8 60 03 00 00       	call   2360 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    2000:	|  |      48 89 c7             	mov    %rax,%rdi
+    2003:	|  |      e8 42 07 00 00       	call   274a <nel::SliceIterator<U8Buf<256ul> >::inc()>
+                if (!fn(acc, forward<OutT>(e))) { return false; }
+    2008:	|  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    200c:	|  |      48 89 c7             	mov    %rax,%rdi
+    200f:	|  |      e8 6c 0d 00 00       	call   2d80 <U8Buf<256ul>& nel::forward<U8Buf<256ul>&, U8Buf<256ul> >(U8Buf<256ul>&)>
+    2014:	|  |      48 89 c2             	mov    %rax,%rdx
+    2017:	|  |      48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    201b:	|  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    201f:	|  |      48 89 ce             	mov    %rcx,%rsi
+    2022:	|  |      48 89 c7             	mov    %rax,%rdi
+    2025:	|  |      e8 44 fe ff ff       	call   1e6e <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex62()::{lambda(U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}::operator()(bool&, U8Buf<256ul>&) const>
+    202a:	|  |      83 f0 01             	xor    $0x1,%eax
+    202d:	|  |      84 c0                	test   %al,%al
+    202f:	|  +----- 74 07                	je     2038 <bool nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::try_fold<bool, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex62()::{lambda(U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex62()::{lambda(U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}&&)+0x72>
+    2031:	|  |      b8 00 00 00 00       	mov    $0x0,%eax
+    2036:	|  |  /-- eb 20                	jmp    2058 <bool nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::try_fold<bool, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex62()::{lambda(U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex62()::{lambda(U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}&&)+0x92>
+            while (!self().is_done()) {
+    2038:	|  \--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    203c:	|     |   48 89 c7             	mov    %rax,%rdi
+    203f:	|     |   e8 1c 03 00 00       	call   2360 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    2044:	|     |   48 89 c7             	mov    %rax,%rdi
+    2047:	|     |   e8 b0 02 00 00       	call   22fc <nel::SliceIterator<U8Buf<256ul> >::is_done() const>
+    204c:	|     |   83 f0 01             	xor    $0x1,%eax
+    204f:	|     |   84 c0                	test   %al,%al
+    2051:	\-----|-- 75 89                	jne    1fdc <bool nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::try_fold<bool, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex62()::{lambda(U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex62()::{lambda(U8Buf<256ul>&)#1}>(ex62()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}&&)+0x16>
+            return true;
+    2053:	      |   b8 01 00 00 00       	mov    $0x1,%eax
+        }
+    2058:	      \-> c9                   	leave
+    2059:	          c3                   	ret
+
+000000000000205a <bool nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::try_fold<bool, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex72()::{lambda(U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex72()::{lambda(U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}&&)>:
+        bool try_fold(U &acc, F &&fn)
+    205a:	          55                   	push   %rbp
+    205b:	          48 89 e5             	mov    %rsp,%rbp
+    205e:	          48 83 ec 30          	sub    $0x30,%rsp
+    2062:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2066:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    206a:	          48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            while (!self().is_done()) {
+    206e:	   /----- eb 5c                	jmp    20cc <bool nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::try_fold<bool, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex72()::{lambda(U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex72()::{lambda(U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}&&)+0x72>
+                OutT e = self().deref();
+    2070:	/--|----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2074:	|  |      48 89 c7             	mov    %rax,%rdi
+    2077:	|  |      e8 e4 02 00 00       	call   2360 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    207c:	|  |      48 89 c7             	mov    %rax,%rdi
+    207f:	|  |      e8 e6 06 00 00       	call   276a <nel::SliceIterator<U8Buf<256ul> >::deref()>
+    2084:	|  |      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                self().inc();
+    2088:	|  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    208c:	|  |      48 89 c7             	mov    %rax,%rdi
+    208f:	|  |      e8 cc 02 00 00       	call   2360 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    2094:	|  |      48 89 c7             	mov    %rax,%rdi
+    2097:	|  |      e8 ae 06 00 00       	call   274a <nel::SliceIterator<U8Buf<256ul> >::inc()>
+                if (!fn(acc, forward<OutT>(e))) { return false; }
+    209c:	|  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20a0:	|  |      48 89 c7             	mov    %rax,%rdi
+    20a3:	|  |      e8 d8 0c 00 00       	call   2d80 <U8Buf<256ul>& nel::forward<U8Buf<256ul>&, U8Buf<256ul> >(U8Buf<256ul>&)>
+    20a8:	|  |      48 89 c2             	mov    %rax,%rdx
+    20ab:	|  |      48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    20af:	|  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    20b3:	|  |      48 89 ce             	mov    %rcx,%rsi
+    20b6:	|  |      48 89 c7             	mov    %rax,%rdi
+    20b9:	|  |      e8 5c fe ff ff       	call   1f1a <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex72()::{lambda(U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}::operator()(bool&, U8Buf<256ul>&) const>
+    20be:	|  |      83 f0 01             	xor    $0x1,%eax
+    20c1:	|  |      84 c0                	test   %al,%al
+    20c3:	|  +----- 74 07                	je     20cc <bool nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::try_fold<bool, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex72()::{lambda(U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex72()::{lambda(U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}&&)+0x72>
+    20c5:	|  |      b8 00 00 00 00       	mov    $0x0,%eax
+    20ca:	|  |  /-- eb 20                	jmp    20ec <bool nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::try_fold<bool, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex72()::{lambda(U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex72()::{lambda(U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}&&)+0x92>
+            while (!self().is_done()) {
+    20cc:	|  \--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20d0:	|     |   48 89 c7             	mov    %rax,%rdi
+    20d3:	|     |   e8 88 02 00 00       	call   2360 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    20d8:	|     |   48 89 c7             	mov    %rax,%rdi
+    20db:	|     |   e8 1c 02 00 00       	call   22fc <nel::SliceIterator<U8Buf<256ul> >::is_done() const>
+    20e0:	|     |   83 f0 01             	xor    $0x1,%eax
+    20e3:	|     |   84 c0                	test   %al,%al
+    20e5:	\-----|-- 75 89                	jne    2070 <bool nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::try_fold<bool, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex72()::{lambda(U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&, nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::for_each<ex72()::{lambda(U8Buf<256ul>&)#1}>(ex72()::{lambda(U8Buf<256ul>&)#1}&&)::{lambda(bool&, U8Buf<256ul>&)#1}&&)+0x16>
+            return true;
+    20e7:	      |   b8 01 00 00 00       	mov    $0x1,%eax
+        }
+    20ec:	      \-> c9                   	leave
+    20ed:	          c3                   	ret
+
+00000000000020ee <operator new(unsigned long, void*)>:
+
+    20ee:	55                   	push   %rbp
+    20ef:	48 89 e5             	mov    %rsp,%rbp
+    20f2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    20f6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+void ex1()
+    20fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+{
+    20fe:	5d                   	pop    %rbp
+    20ff:	c3                   	ret
+
+0000000000002100 <nel::Context::Context(char const*, char const*, int)>:
+        char const *fn_name_;
+        char const *file_name_;
+        int line_num_;
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+    2100:	55                   	push   %rbp
+    2101:	48 89 e5             	mov    %rsp,%rbp
+    2104:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2108:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    210c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2110:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    2113:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2117:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    211b:	48 89 10             	mov    %rdx,(%rax)
+            , file_name_(file_name)
+    211e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2122:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2126:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , line_num_(line_num)
+    212a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    212e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    2131:	89 50 10             	mov    %edx,0x10(%rax)
+        {
+        }
+    2134:	90                   	nop
+    2135:	5d                   	pop    %rbp
+    2136:	c3                   	ret
+    2137:	90                   	nop
+
+0000000000002138 <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()>:
+        /**
+         * Destroy array and it's elements.
+         */
+        // do not need to implement.
+        // default one will dtuct elements.
+        ~Array() = default;
+    2138:	       55                   	push   %rbp
+    2139:	       48 89 e5             	mov    %rsp,%rbp
+    213c:	       53                   	push   %rbx
+    213d:	       48 83 ec 18          	sub    $0x18,%rsp
+    2141:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2145:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2149:	       48 85 c0             	test   %rax,%rax
+    214c:	/----- 74 25                	je     2173 <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()+0x3b>
+    214e:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2152:	|      48 8d 98 00 08 00 00 	lea    0x800(%rax),%rbx
+    2159:	|  /-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    215d:	|  |   48 39 c3             	cmp    %rax,%rbx
+    2160:	+--|-- 74 11                	je     2173 <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()+0x3b>
+    2162:	|  |   48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    2169:	|  |   48 89 df             	mov    %rbx,%rdi
+    216c:	|  |   e8 83 02 00 00       	call   23f4 <U8Buf<256ul>::~U8Buf()>
+    2171:	|  \-- eb e6                	jmp    2159 <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()+0x21>
+    2173:	\----> 90                   	nop
+    2174:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2178:	       c9                   	leave
+    2179:	       c3                   	ret
+
+000000000000217a <U8Buf<256ul>::U8Buf(unsigned char)>:
+            nel::elem::move(data_, o.data_, N);
+            return *this;
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+    217a:	55                   	push   %rbp
+    217b:	48 89 e5             	mov    %rsp,%rbp
+    217e:	48 83 ec 10          	sub    $0x10,%rsp
+    2182:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2186:	89 f0                	mov    %esi,%eax
+    2188:	88 45 f4             	mov    %al,-0xc(%rbp)
+        {
+            nel::elem::set(data_, f, N);
+    218b:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    218f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2193:	ba 00 01 00 00       	mov    $0x100,%edx
+    2198:	89 ce                	mov    %ecx,%esi
+    219a:	48 89 c7             	mov    %rax,%rdi
+    219d:	e8 e1 0d 00 00       	call   2f83 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    21a2:	90                   	nop
+    21a3:	c9                   	leave
+    21a4:	c3                   	ret
+    21a5:	90                   	nop
+
+00000000000021a6 <nel::heapless::Array<U8Buf<256ul>, 8ul>::iter()>:
+        constexpr auto iter(void) const
+        {
+            return slice().iter();
+        }
+
+        constexpr auto iter(void)
+    21a6:	55                   	push   %rbp
+    21a7:	48 89 e5             	mov    %rsp,%rbp
+    21aa:	48 83 ec 20          	sub    $0x20,%rsp
+    21ae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    21b2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            return slice().iter();
+    21b6:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    21ba:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    21be:	48 89 d6             	mov    %rdx,%rsi
+    21c1:	48 89 c7             	mov    %rax,%rdi
+    21c4:	e8 19 00 00 00       	call   21e2 <nel::heapless::Array<U8Buf<256ul>, 8ul>::slice()>
+    21c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    21cd:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    21d1:	48 89 d6             	mov    %rdx,%rsi
+    21d4:	48 89 c7             	mov    %rax,%rdi
+    21d7:	e8 78 00 00 00       	call   2254 <nel::Slice<U8Buf<256ul> >::iter() const>
+        }
+    21dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    21e0:	c9                   	leave
+    21e1:	c3                   	ret
+
+00000000000021e2 <nel::heapless::Array<U8Buf<256ul>, 8ul>::slice()>:
+        constexpr Slice<Type> slice(void)
+    21e2:	55                   	push   %rbp
+    21e3:	48 89 e5             	mov    %rsp,%rbp
+    21e6:	48 83 ec 10          	sub    $0x10,%rsp
+    21ea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    21ee:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Slice(values_, len());
+    21f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    21f6:	48 89 c7             	mov    %rax,%rdi
+    21f9:	e8 1c 00 00 00       	call   221a <nel::heapless::Array<U8Buf<256ul>, 8ul>::len() const>
+    21fe:	48 89 c2             	mov    %rax,%rdx
+    2201:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2205:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2209:	48 89 ce             	mov    %rcx,%rsi
+    220c:	48 89 c7             	mov    %rax,%rdi
+    220f:	e8 16 00 00 00       	call   222a <nel::Slice<U8Buf<256ul> >::Slice(U8Buf<256ul>*, unsigned long)>
+        }
+    2214:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2218:	c9                   	leave
+    2219:	c3                   	ret
+
+000000000000221a <nel::heapless::Array<U8Buf<256ul>, 8ul>::len() const>:
+        constexpr Length len(void) const
+    221a:	55                   	push   %rbp
+    221b:	48 89 e5             	mov    %rsp,%rbp
+    221e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return N;
+    2222:	b8 08 00 00 00       	mov    $0x8,%eax
+        }
+    2227:	5d                   	pop    %rbp
+    2228:	c3                   	ret
+    2229:	90                   	nop
+
+000000000000222a <nel::Slice<U8Buf<256ul> >::Slice(U8Buf<256ul>*, unsigned long)>:
+    public:
+        // annoyingly, the type deducing form only works on ctors, not statics
+        // so Slice( int ptr, len) gets a Slice<int>(int ptr, len)
+        // but a Slice::from(int ptr, len) does not work..
+        // constexpr Slice(Type p[], Length len)
+        constexpr Slice(Type *const p, Length len)
+    222a:	55                   	push   %rbp
+    222b:	48 89 e5             	mov    %rsp,%rbp
+    222e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2232:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2236:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : content_(p)
+    223a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    223e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2242:	48 89 10             	mov    %rdx,(%rax)
+            , len_(len)
+    2245:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2249:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    224d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        {
+        }
+    2251:	90                   	nop
+    2252:	5d                   	pop    %rbp
+    2253:	c3                   	ret
+
+0000000000002254 <nel::Slice<U8Buf<256ul> >::iter() const>:
+         *
+         * The iterator is invalidated if the slice goes out of scope/destroyed.
+         */
+        typedef SliceIterator<Type> Iterator;
+
+        constexpr Iterator iter(void) const
+    2254:	55                   	push   %rbp
+    2255:	48 89 e5             	mov    %rsp,%rbp
+    2258:	53                   	push   %rbx
+    2259:	48 83 ec 18          	sub    $0x18,%rsp
+    225d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2261:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            return Iterator(ptr(), len());
+    2265:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2269:	48 89 c7             	mov    %rax,%rdi
+    226c:	e8 41 00 00 00       	call   22b2 <nel::Slice<U8Buf<256ul> >::len() const>
+    2271:	48 89 c3             	mov    %rax,%rbx
+    2274:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2278:	48 89 c7             	mov    %rax,%rdi
+    227b:	e8 20 00 00 00       	call   22a0 <nel::Slice<U8Buf<256ul> >::ptr() const>
+    2280:	48 89 c1             	mov    %rax,%rcx
+    2283:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2287:	48 89 da             	mov    %rbx,%rdx
+    228a:	48 89 ce             	mov    %rcx,%rsi
+    228d:	48 89 c7             	mov    %rax,%rdi
+    2290:	e8 2f 00 00 00       	call   22c4 <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(U8Buf<256ul>*, unsigned long)>
+        }
+    2295:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2299:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    229d:	c9                   	leave
+    229e:	c3                   	ret
+    229f:	90                   	nop
+
+00000000000022a0 <nel::Slice<U8Buf<256ul> >::ptr() const>:
+        constexpr Type *ptr(void) const
+    22a0:	55                   	push   %rbp
+    22a1:	48 89 e5             	mov    %rsp,%rbp
+    22a4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return content_;
+    22a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22ac:	48 8b 00             	mov    (%rax),%rax
+        }
+    22af:	5d                   	pop    %rbp
+    22b0:	c3                   	ret
+    22b1:	90                   	nop
+
+00000000000022b2 <nel::Slice<U8Buf<256ul> >::len() const>:
+        constexpr Length len(void) const
+    22b2:	55                   	push   %rbp
+    22b3:	48 89 e5             	mov    %rsp,%rbp
+    22b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    22ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22be:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    22c2:	5d                   	pop    %rbp
+    22c3:	c3                   	ret
+
+00000000000022c4 <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(U8Buf<256ul>*, unsigned long)>:
+            }
+            return *this;
+        }
+
+    public:
+        constexpr SliceIterator(T arr[], Count len)
+    22c4:	55                   	push   %rbp
+    22c5:	48 89 e5             	mov    %rsp,%rbp
+    22c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    22cc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    22d0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : b_(arr)
+    22d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22d8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    22dc:	48 89 10             	mov    %rdx,(%rax)
+            , e_(arr + len)
+    22df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22e3:	48 c1 e0 08          	shl    $0x8,%rax
+    22e7:	48 89 c2             	mov    %rax,%rdx
+    22ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22ee:	48 01 c2             	add    %rax,%rdx
+    22f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22f5:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        {
+        }
+    22f9:	90                   	nop
+    22fa:	5d                   	pop    %rbp
+    22fb:	c3                   	ret
+
+00000000000022fc <nel::SliceIterator<U8Buf<256ul> >::is_done() const>:
+        }
+#    endif
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+    22fc:	55                   	push   %rbp
+    22fd:	48 89 e5             	mov    %rsp,%rbp
+    2300:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return (b_ == e_);
+    2304:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2308:	48 8b 10             	mov    (%rax),%rdx
+    230b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    230f:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2313:	48 39 c2             	cmp    %rax,%rdx
+    2316:	0f 94 c0             	sete   %al
+        }
+    2319:	5d                   	pop    %rbp
+    231a:	c3                   	ret
+    231b:	90                   	nop
+
+000000000000231c <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::first_n(unsigned long)>:
+        constexpr FirstNIterator<ItT> first_n(Count const limit)
+    231c:	55                   	push   %rbp
+    231d:	48 89 e5             	mov    %rsp,%rbp
+    2320:	48 83 ec 20          	sub    $0x20,%rsp
+    2324:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2328:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    232c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            return FirstNIterator<ItT>(move(self()), limit);
+    2330:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2334:	48 89 c7             	mov    %rax,%rdi
+    2337:	e8 24 00 00 00       	call   2360 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    233c:	48 89 c7             	mov    %rax,%rdi
+    233f:	e8 32 00 00 00       	call   2376 <nel::SliceIterator<U8Buf<256ul> >&& nel::move<nel::SliceIterator<U8Buf<256ul> > >(nel::SliceIterator<U8Buf<256ul> >&)>
+    2344:	48 89 c1             	mov    %rax,%rcx
+    2347:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    234b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    234f:	48 89 ce             	mov    %rcx,%rsi
+    2352:	48 89 c7             	mov    %rax,%rdi
+    2355:	e8 2a 00 00 00       	call   2384 <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::FirstNIterator(nel::SliceIterator<U8Buf<256ul> >&&, unsigned long)>
+        }
+    235a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    235e:	c9                   	leave
+    235f:	c3                   	ret
+
+0000000000002360 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>:
+        constexpr ItT &self(void)
+    2360:	55                   	push   %rbp
+    2361:	48 89 e5             	mov    %rsp,%rbp
+    2364:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    2368:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    236c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    2370:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2374:	5d                   	pop    %rbp
+    2375:	c3                   	ret
+
+0000000000002376 <nel::SliceIterator<U8Buf<256ul> >&& nel::move<nel::SliceIterator<U8Buf<256ul> > >(nel::SliceIterator<U8Buf<256ul> >&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel is to not need std.
+ */
+template<typename T>
+constexpr T &&move(T &v)
+    2376:	55                   	push   %rbp
+    2377:	48 89 e5             	mov    %rsp,%rbp
+    237a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<T &&>(v);
+    237e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2382:	5d                   	pop    %rbp
+    2383:	c3                   	ret
+
+0000000000002384 <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::FirstNIterator(nel::SliceIterator<U8Buf<256ul> >&&, unsigned long)>:
+        constexpr FirstNIterator(It &&inner, Length limit)
+    2384:	55                   	push   %rbp
+    2385:	48 89 e5             	mov    %rsp,%rbp
+    2388:	53                   	push   %rbx
+    2389:	48 83 ec 28          	sub    $0x28,%rsp
+    238d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2391:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2395:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            : inner_(move(inner))
+    2399:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    239d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    23a1:	48 89 c7             	mov    %rax,%rdi
+    23a4:	e8 cd ff ff ff       	call   2376 <nel::SliceIterator<U8Buf<256ul> >&& nel::move<nel::SliceIterator<U8Buf<256ul> > >(nel::SliceIterator<U8Buf<256ul> >&)>
+    23a9:	48 89 c6             	mov    %rax,%rsi
+    23ac:	48 89 df             	mov    %rbx,%rdi
+    23af:	e8 c8 03 00 00       	call   277c <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(nel::SliceIterator<U8Buf<256ul> >&&)>
+            , current_(0)
+    23b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    23b8:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+    23bf:	00 
+            , limit_(limit)
+    23c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    23c4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    23c8:	48 89 50 18          	mov    %rdx,0x18(%rax)
+        }
+    23cc:	90                   	nop
+    23cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    23d1:	c9                   	leave
+    23d2:	c3                   	ret
+    23d3:	90                   	nop
+
+00000000000023d4 <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::is_done() const>:
+        constexpr bool is_done(void) const
+    23d4:	55                   	push   %rbp
+    23d5:	48 89 e5             	mov    %rsp,%rbp
+    23d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (current_ >= limit_);
+    23dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23e0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+    23e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23e8:	48 8b 40 18          	mov    0x18(%rax),%rax
+    23ec:	48 39 c2             	cmp    %rax,%rdx
+    23ef:	0f 93 c0             	setae  %al
+        }
+    23f2:	5d                   	pop    %rbp
+    23f3:	c3                   	ret
+
+00000000000023f4 <U8Buf<256ul>::~U8Buf()>:
+        constexpr ~U8Buf(void)
+    23f4:	55                   	push   %rbp
+    23f5:	48 89 e5             	mov    %rsp,%rbp
+    23f8:	48 83 ec 10          	sub    $0x10,%rsp
+    23fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            nel::elem::set(data_, 0xa5, N);
+    2400:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2404:	ba 00 01 00 00       	mov    $0x100,%edx
+    2409:	be a5 00 00 00       	mov    $0xa5,%esi
+    240e:	48 89 c7             	mov    %rax,%rdi
+    2411:	e8 6d 0b 00 00       	call   2f83 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    2416:	90                   	nop
+    2417:	c9                   	leave
+    2418:	c3                   	ret
+
+0000000000002419 <nel::heapless::Array<U8Buf<256ul>, 8ul>::filled_with(U8Buf<256ul> const&)>:
+        constexpr static Array filled_with(Type const &v)
+    2419:	55                   	push   %rbp
+    241a:	48 89 e5             	mov    %rsp,%rbp
+    241d:	48 83 ec 10          	sub    $0x10,%rsp
+    2421:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2425:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Array(v);
+    2429:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    242d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2431:	48 89 d6             	mov    %rdx,%rsi
+    2434:	48 89 c7             	mov    %rax,%rdi
+    2437:	e8 f2 03 00 00       	call   282e <nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)>
+        }
+    243c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2440:	c9                   	leave
+    2441:	c3                   	ret
+
+0000000000002442 <nel::heapless::Array<U8Buf<256ul>, 8ul>::iter() const>:
+        constexpr auto iter(void) const
+    2442:	55                   	push   %rbp
+    2443:	48 89 e5             	mov    %rsp,%rbp
+    2446:	48 83 ec 20          	sub    $0x20,%rsp
+    244a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    244e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return slice().iter();
+    2452:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    2456:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    245a:	48 89 d6             	mov    %rdx,%rsi
+    245d:	48 89 c7             	mov    %rax,%rdi
+    2460:	e8 3b 04 00 00       	call   28a0 <nel::heapless::Array<U8Buf<256ul>, 8ul>::slice() const>
+    2465:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2469:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    246d:	48 89 d6             	mov    %rdx,%rsi
+    2470:	48 89 c7             	mov    %rax,%rdi
+    2473:	e8 60 04 00 00       	call   28d8 <nel::Slice<U8Buf<256ul> const>::iter() const>
+        }
+    2478:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    247c:	c9                   	leave
+    247d:	c3                   	ret
+
+000000000000247e <nel::heapless::operator<<(nel::Log&, nel::heapless::Array<U8Buf<256ul>, 8ul> const&)>:
+         * @param outs the stream to dump the representation into.
+         */
+        // TODO: replace <<(Log ) with dbgfmt, so separate out from
+        // any other form of conversion to charstring.
+        // TODO: insert into formatter and not final dest type.
+        friend Log &operator<<(Log &outs, Array const &v)
+    247e:	55                   	push   %rbp
+    247f:	48 89 e5             	mov    %rsp,%rbp
+    2482:	53                   	push   %rbx
+    2483:	48 83 ec 28          	sub    $0x28,%rsp
+    2487:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    248b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+        {
+            outs << "Array<" << v.len() << ">{";
+    248f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2493:	48 8d 15 26 1c 00 00 	lea    0x1c26(%rip),%rdx        # 40c0 <nel::sort::ninther_n+0xa0>
+    249a:	48 89 d6             	mov    %rdx,%rsi
+    249d:	48 89 c7             	mov    %rax,%rdi
+    24a0:	e8 32 13 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+    24a5:	48 89 c3             	mov    %rax,%rbx
+    24a8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    24ac:	48 89 c7             	mov    %rax,%rdi
+    24af:	e8 66 fd ff ff       	call   221a <nel::heapless::Array<U8Buf<256ul>, 8ul>::len() const>
+    24b4:	48 89 c6             	mov    %rax,%rsi
+    24b7:	48 89 df             	mov    %rbx,%rdi
+    24ba:	e8 23 14 00 00       	call   38e2 <nel::operator<<(nel::Log&, unsigned long)>
+    24bf:	48 89 c2             	mov    %rax,%rdx
+    24c2:	48 8d 05 fe 1b 00 00 	lea    0x1bfe(%rip),%rax        # 40c7 <nel::sort::ninther_n+0xa7>
+    24c9:	48 89 c6             	mov    %rax,%rsi
+    24cc:	48 89 d7             	mov    %rdx,%rdi
+    24cf:	e8 03 13 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+            outs << v.iter();
+    24d4:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    24d8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    24dc:	48 89 d6             	mov    %rdx,%rsi
+    24df:	48 89 c7             	mov    %rax,%rdi
+    24e2:	e8 5b ff ff ff       	call   2442 <nel::heapless::Array<U8Buf<256ul>, 8ul>::iter() const>
+    24e7:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    24eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    24ef:	48 89 d6             	mov    %rdx,%rsi
+    24f2:	48 89 c7             	mov    %rax,%rdi
+    24f5:	e8 83 04 00 00       	call   297d <nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)>
+            outs << '}';
+    24fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    24fe:	be 7d 00 00 00       	mov    $0x7d,%esi
+    2503:	48 89 c7             	mov    %rax,%rdi
+    2506:	e8 a0 12 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+            return outs;
+    250b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+        }
+    250f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2513:	c9                   	leave
+    2514:	c3                   	ret
+    2515:	90                   	nop
+
+0000000000002516 <nel::heapless::Array<U8Buf<256ul>, 8ul>::try_get(unsigned long)>:
+        constexpr Optional<Type &> try_get(Index idx)
+    2516:	55                   	push   %rbp
+    2517:	48 89 e5             	mov    %rsp,%rbp
+    251a:	48 83 ec 30          	sub    $0x30,%rsp
+    251e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2522:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2526:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            return slice().try_get(idx);
+    252a:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    252e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2532:	48 89 d6             	mov    %rdx,%rsi
+    2535:	48 89 c7             	mov    %rax,%rdi
+    2538:	e8 a5 fc ff ff       	call   21e2 <nel::heapless::Array<U8Buf<256ul>, 8ul>::slice()>
+    253d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2541:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2545:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+    2549:	48 89 ce             	mov    %rcx,%rsi
+    254c:	48 89 c7             	mov    %rax,%rdi
+    254f:	e8 cc 04 00 00       	call   2a20 <nel::Slice<U8Buf<256ul> >::try_get(unsigned long) const>
+        }
+    2554:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2558:	c9                   	leave
+    2559:	c3                   	ret
+
+000000000000255a <nel::Optional<U8Buf<256ul>&>::~Optional()>:
+        union {
+                Element<T> some_;
+        };
+
+    public:
+        constexpr ~Optional(void)
+    255a:	             55                   	push   %rbp
+    255b:	             48 89 e5             	mov    %rsp,%rbp
+    255e:	             48 83 ec 30          	sub    $0x30,%rsp
+    2562:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // optional::dtor
+    2566:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    256a:	             8b 00                	mov    (%rax),%eax
+    256c:	             83 f8 02             	cmp    $0x2,%eax
+    256f:	/----------- 74 43                	je     25b4 <nel::Optional<U8Buf<256ul>&>::~Optional()+0x5a>
+    2571:	|            83 f8 02             	cmp    $0x2,%eax
+    2574:	|        /-- 7f 09                	jg     257f <nel::Optional<U8Buf<256ul>&>::~Optional()+0x25>
+    2576:	|        |   85 c0                	test   %eax,%eax
+    2578:	|  /-----|-- 74 3d                	je     25b7 <nel::Optional<U8Buf<256ul>&>::~Optional()+0x5d>
+    257a:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    257d:	|  |  /--|-- 74 3b                	je     25ba <nel::Optional<U8Buf<256ul>&>::~Optional()+0x60>
+                    // yes, since it may have contained one or the others..
+                    // if memory hardware is assumed to be incorruptable then can ignore ? (buffer
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob.
+                    nel::panic("bad Optional");
+    257f:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2583:	|  |  |      b9 87 00 00 00       	mov    $0x87,%ecx
+    2588:	|  |  |      48 8d 15 3b 1b 00 00 	lea    0x1b3b(%rip),%rdx        # 40ca <nel::sort::ninther_n+0xaa>
+    258f:	|  |  |      48 8d 35 48 1b 00 00 	lea    0x1b48(%rip),%rsi        # 40de <nel::sort::ninther_n+0xbe>
+    2596:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2599:	|  |  |      e8 62 fb ff ff       	call   2100 <nel::Context::Context(char const*, char const*, int)>
+    259e:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    25a2:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    25a5:	|  |  |      48 8d 05 3c 1b 00 00 	lea    0x1b3c(%rip),%rax        # 40e8 <nel::sort::ninther_n+0xc8>
+    25ac:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    25af:	|  |  |      e8 eb 08 00 00       	call   2e9f <nel::panic(char const*, nel::Context const&)>
+                    break;
+    25b4:	\--|--|----> 90                   	nop
+    25b5:	   |  |  /-- eb 04                	jmp    25bb <nel::Optional<U8Buf<256ul>&>::~Optional()+0x61>
+                    break;
+    25b7:	   \--|--|-> 90                   	nop
+    25b8:	      |  +-- eb 01                	jmp    25bb <nel::Optional<U8Buf<256ul>&>::~Optional()+0x61>
+                    break;
+    25ba:	      \--|-> 90                   	nop
+                    break;
+            }
+        }
+    25bb:	         \-> 90                   	nop
+    25bc:	             c9                   	leave
+    25bd:	             c3                   	ret
+
+00000000000025be <nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}::operator()(U8Buf<256ul>&) const>:
+         *
+         * @warning If the optional does not contain a Some, then abort/panic.
+         */
+        T unwrap(Context const &ctx = Context())
+        {
+            return consume<T>([](T &&some) -> T { return some; },
+    25be:	55                   	push   %rbp
+    25bf:	48 89 e5             	mov    %rsp,%rbp
+    25c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    25c6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    25ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25ce:	5d                   	pop    %rbp
+    25cf:	c3                   	ret
+
+00000000000025d0 <nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}::operator()() const>:
+                              [&](void) -> T { nel::panic("not a Some", ctx); },
+    25d0:	55                   	push   %rbp
+    25d1:	48 89 e5             	mov    %rsp,%rbp
+    25d4:	48 83 ec 10          	sub    $0x10,%rsp
+    25d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    25dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25e0:	48 8b 00             	mov    (%rax),%rax
+    25e3:	48 89 c6             	mov    %rax,%rsi
+    25e6:	48 8d 05 08 1b 00 00 	lea    0x1b08(%rip),%rax        # 40f5 <nel::sort::ninther_n+0xd5>
+    25ed:	48 89 c7             	mov    %rax,%rdi
+    25f0:	e8 aa 08 00 00       	call   2e9f <nel::panic(char const*, nel::Context const&)>
+    25f5:	90                   	nop
+
+00000000000025f6 <nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)>:
+        T unwrap(Context const &ctx = Context())
+    25f6:	55                   	push   %rbp
+    25f7:	48 89 e5             	mov    %rsp,%rbp
+    25fa:	48 83 ec 20          	sub    $0x20,%rsp
+    25fe:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2602:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+                              [&](void) -> T { nel::panic("not a Some", ctx); },
+    2606:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    260a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            return consume<T>([](T &&some) -> T { return some; },
+    260e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2612:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    2616:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    261a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    261e:	48 89 c7             	mov    %rax,%rdi
+    2621:	e8 5c 04 00 00       	call   2a82 <U8Buf<256ul>& nel::Optional<U8Buf<256ul>&>::consume<U8Buf<256ul>&, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}&&, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)>
+                              ctx);
+        }
+    2626:	c9                   	leave
+    2627:	c3                   	ret
+
+0000000000002628 <U8Buf<256ul>::operator=(U8Buf<256ul>&&)>:
+        constexpr U8Buf &operator=(U8Buf &&o)
+    2628:	55                   	push   %rbp
+    2629:	48 89 e5             	mov    %rsp,%rbp
+    262c:	48 83 ec 10          	sub    $0x10,%rsp
+    2630:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2634:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            nel::elem::move(data_, o.data_, N);
+    2638:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    263c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2640:	ba 00 01 00 00       	mov    $0x100,%edx
+    2645:	48 89 ce             	mov    %rcx,%rsi
+    2648:	48 89 c7             	mov    %rax,%rdi
+    264b:	e8 61 09 00 00       	call   2fb1 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            return *this;
+    2650:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2654:	c9                   	leave
+    2655:	c3                   	ret
+
+0000000000002656 <operator<<(nel::Log&, U8Buf<256ul> const&)>:
+        void fill(uint8_t f)
+        {
+            nel::elem::set(data_, f, N);
+        }
+
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+    2656:	          55                   	push   %rbp
+    2657:	          48 89 e5             	mov    %rsp,%rbp
+    265a:	          53                   	push   %rbx
+    265b:	          48 83 ec 28          	sub    $0x28,%rsp
+    265f:	          48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    2663:	          48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+        {
+            outs << "U8Buf<" << val.len() << ">{";
+    2667:	          48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    266b:	          48 8d 15 8e 1a 00 00 	lea    0x1a8e(%rip),%rdx        # 4100 <nel::sort::ninther_n+0xe0>
+    2672:	          48 89 d6             	mov    %rdx,%rsi
+    2675:	          48 89 c7             	mov    %rax,%rdi
+    2678:	          e8 5a 11 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+    267d:	          48 89 c3             	mov    %rax,%rbx
+    2680:	          48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2684:	          48 89 c7             	mov    %rax,%rdi
+    2687:	          e8 a4 04 00 00       	call   2b30 <U8Buf<256ul>::len() const>
+    268c:	          48 89 c6             	mov    %rax,%rsi
+    268f:	          48 89 df             	mov    %rbx,%rdi
+    2692:	          e8 4b 12 00 00       	call   38e2 <nel::operator<<(nel::Log&, unsigned long)>
+    2697:	          48 89 c2             	mov    %rax,%rdx
+    269a:	          48 8d 05 26 1a 00 00 	lea    0x1a26(%rip),%rax        # 40c7 <nel::sort::ninther_n+0xa7>
+    26a1:	          48 89 c6             	mov    %rax,%rsi
+    26a4:	          48 89 d7             	mov    %rdx,%rdi
+    26a7:	          e8 2b 11 00 00       	call   37d7 <nel::operator<<(nel::Log&, char const*)>
+            if (val.len() > 0) {
+    26ac:	          48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    26b0:	          48 89 c7             	mov    %rax,%rdi
+    26b3:	          e8 78 04 00 00       	call   2b30 <U8Buf<256ul>::len() const>
+    26b8:	          48 85 c0             	test   %rax,%rax
+    26bb:	          0f 95 c0             	setne  %al
+    26be:	          84 c0                	test   %al,%al
+    26c0:	/-------- 74 6d                	je     272f <operator<<(nel::Log&, U8Buf<256ul> const&)+0xd9>
+                outs << val.data_[0];
+    26c2:	|         48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    26c6:	|         0f b6 00             	movzbl (%rax),%eax
+    26c9:	|         0f b6 d0             	movzbl %al,%edx
+    26cc:	|         48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    26d0:	|         89 d6                	mov    %edx,%esi
+    26d2:	|         48 89 c7             	mov    %rax,%rdi
+    26d5:	|         e8 29 11 00 00       	call   3803 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    26da:	|         48 c7 45 e8 01 00 00 	movq   $0x1,-0x18(%rbp)
+    26e1:	|         00 
+    26e2:	|     /-- eb 34                	jmp    2718 <operator<<(nel::Log&, U8Buf<256ul> const&)+0xc2>
+                    outs << ' ' << val.data_[i];
+    26e4:	|  /--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    26e8:	|  |  |   be 20 00 00 00       	mov    $0x20,%esi
+    26ed:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    26f0:	|  |  |   e8 b6 10 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    26f5:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    26f8:	|  |  |   48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    26fc:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2700:	|  |  |   48 01 c8             	add    %rcx,%rax
+    2703:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    2706:	|  |  |   0f b6 c0             	movzbl %al,%eax
+    2709:	|  |  |   89 c6                	mov    %eax,%esi
+    270b:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    270e:	|  |  |   e8 f0 10 00 00       	call   3803 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    2713:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    2718:	|  |  \-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    271c:	|  |      48 89 c7             	mov    %rax,%rdi
+    271f:	|  |      e8 0c 04 00 00       	call   2b30 <U8Buf<256ul>::len() const>
+    2724:	|  |      48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    2728:	|  |      0f 92 c0             	setb   %al
+    272b:	|  |      84 c0                	test   %al,%al
+    272d:	|  \----- 75 b5                	jne    26e4 <operator<<(nel::Log&, U8Buf<256ul> const&)+0x8e>
+                }
+            }
+            outs << '}';
+    272f:	\-------> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2733:	          be 7d 00 00 00       	mov    $0x7d,%esi
+    2738:	          48 89 c7             	mov    %rax,%rdi
+    273b:	          e8 6b 10 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+            return outs;
+    2740:	          48 8b 45 d8          	mov    -0x28(%rbp),%rax
+        }
+    2744:	          48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2748:	          c9                   	leave
+    2749:	          c3                   	ret
+
+000000000000274a <nel::SliceIterator<U8Buf<256ul> >::inc()>:
+
+        void inc(void)
+    274a:	55                   	push   %rbp
+    274b:	48 89 e5             	mov    %rsp,%rbp
+    274e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            ++b_;
+    2752:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2756:	48 8b 00             	mov    (%rax),%rax
+    2759:	48 8d 90 00 01 00 00 	lea    0x100(%rax),%rdx
+    2760:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2764:	48 89 10             	mov    %rdx,(%rax)
+        }
+    2767:	90                   	nop
+    2768:	5d                   	pop    %rbp
+    2769:	c3                   	ret
+
+000000000000276a <nel::SliceIterator<U8Buf<256ul> >::deref()>:
+
+        OutT deref(void)
+    276a:	55                   	push   %rbp
+    276b:	48 89 e5             	mov    %rsp,%rbp
+    276e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return *b_;
+    2772:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2776:	48 8b 00             	mov    (%rax),%rax
+        }
+    2779:	5d                   	pop    %rbp
+    277a:	c3                   	ret
+    277b:	90                   	nop
+
+000000000000277c <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(nel::SliceIterator<U8Buf<256ul> >&&)>:
+        SliceIterator(SliceIterator &&o)
+    277c:	55                   	push   %rbp
+    277d:	48 89 e5             	mov    %rsp,%rbp
+    2780:	48 83 ec 10          	sub    $0x10,%rsp
+    2784:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2788:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : b_(move(o.b_))
+    278c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2790:	48 89 c7             	mov    %rax,%rdi
+    2793:	e8 a7 03 00 00       	call   2b3f <U8Buf<256ul>*&& nel::move<U8Buf<256ul>*>(U8Buf<256ul>*&)>
+    2798:	48 8b 10             	mov    (%rax),%rdx
+    279b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    279f:	48 89 10             	mov    %rdx,(%rax)
+            , e_(move(o.e_))
+    27a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    27a6:	48 83 c0 08          	add    $0x8,%rax
+    27aa:	48 89 c7             	mov    %rax,%rdi
+    27ad:	e8 8d 03 00 00       	call   2b3f <U8Buf<256ul>*&& nel::move<U8Buf<256ul>*>(U8Buf<256ul>*&)>
+    27b2:	48 8b 10             	mov    (%rax),%rdx
+    27b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27b9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            o.b_ = nullptr;
+    27bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    27c1:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+            o.e_ = nullptr;
+    27c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    27cc:	48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    27d3:	00 
+        }
+    27d4:	90                   	nop
+    27d5:	c9                   	leave
+    27d6:	c3                   	ret
+    27d7:	90                   	nop
+
+00000000000027d8 <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::inc()>:
+        void inc(void)
+    27d8:	55                   	push   %rbp
+    27d9:	48 89 e5             	mov    %rsp,%rbp
+    27dc:	48 83 ec 10          	sub    $0x10,%rsp
+    27e0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            inner_.inc();
+    27e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27e8:	48 89 c7             	mov    %rax,%rdi
+    27eb:	e8 5a ff ff ff       	call   274a <nel::SliceIterator<U8Buf<256ul> >::inc()>
+            ++current_;
+    27f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27f4:	48 8b 40 10          	mov    0x10(%rax),%rax
+    27f8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    27fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2800:	48 89 50 10          	mov    %rdx,0x10(%rax)
+        }
+    2804:	90                   	nop
+    2805:	c9                   	leave
+    2806:	c3                   	ret
+    2807:	90                   	nop
+
+0000000000002808 <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::deref()>:
+        OutT deref(void)
+    2808:	55                   	push   %rbp
+    2809:	48 89 e5             	mov    %rsp,%rbp
+    280c:	48 83 ec 10          	sub    $0x10,%rsp
+    2810:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return inner_.deref();
+    2814:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2818:	48 89 c7             	mov    %rax,%rdi
+    281b:	e8 4a ff ff ff       	call   276a <nel::SliceIterator<U8Buf<256ul> >::deref()>
+        }
+    2820:	c9                   	leave
+    2821:	c3                   	ret
+
+0000000000002822 <U8Buf<256ul>::U8Buf()>:
+        constexpr U8Buf(void) {}
+    2822:	55                   	push   %rbp
+    2823:	48 89 e5             	mov    %rsp,%rbp
+    2826:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    282a:	90                   	nop
+    282b:	5d                   	pop    %rbp
+    282c:	c3                   	ret
+    282d:	90                   	nop
+
+000000000000282e <nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)>:
+        constexpr Array(Type const &v)
+    282e:	       55                   	push   %rbp
+    282f:	       48 89 e5             	mov    %rsp,%rbp
+    2832:	       41 54                	push   %r12
+    2834:	       53                   	push   %rbx
+    2835:	       48 83 ec 30          	sub    $0x30,%rsp
+    2839:	       48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    283d:	       48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+        {
+    2841:	       48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2845:	       bb 07 00 00 00       	mov    $0x7,%ebx
+    284a:	       49 89 c4             	mov    %rax,%r12
+    284d:	   /-- eb 13                	jmp    2862 <nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)+0x34>
+    284f:	/--|-> 4c 89 e7             	mov    %r12,%rdi
+    2852:	|  |   e8 cb ff ff ff       	call   2822 <U8Buf<256ul>::U8Buf()>
+    2857:	|  |   48 83 eb 01          	sub    $0x1,%rbx
+    285b:	|  |   49 81 c4 00 01 00 00 	add    $0x100,%r12
+    2862:	|  \-> 48 85 db             	test   %rbx,%rbx
+    2865:	\----- 79 e8                	jns    284f <nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)+0x21>
+            iter().for_each([&](auto &e) { new (&e) Type(v); });
+    2867:	       48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    286b:	       48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    286f:	       48 89 d6             	mov    %rdx,%rsi
+    2872:	       48 89 c7             	mov    %rax,%rdi
+    2875:	       e8 2c f9 ff ff       	call   21a6 <nel::heapless::Array<U8Buf<256ul>, 8ul>::iter()>
+    287a:	       48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    287e:	       48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    2882:	       48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+    2886:	       48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    288a:	       48 89 d6             	mov    %rdx,%rsi
+    288d:	       48 89 c7             	mov    %rax,%rdi
+    2890:	       e8 f3 02 00 00       	call   2b88 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)::{lambda(auto:1&)#1}>(nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)::{lambda(auto:1&)#1}&&)>
+        }
+    2895:	       90                   	nop
+    2896:	       48 83 c4 30          	add    $0x30,%rsp
+    289a:	       5b                   	pop    %rbx
+    289b:	       41 5c                	pop    %r12
+    289d:	       5d                   	pop    %rbp
+    289e:	       c3                   	ret
+    289f:	       90                   	nop
+
+00000000000028a0 <nel::heapless::Array<U8Buf<256ul>, 8ul>::slice() const>:
+        constexpr Slice<Type const> slice(void) const
+    28a0:	55                   	push   %rbp
+    28a1:	48 89 e5             	mov    %rsp,%rbp
+    28a4:	48 83 ec 10          	sub    $0x10,%rsp
+    28a8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    28ac:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Slice(values_, len());
+    28b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    28b4:	48 89 c7             	mov    %rax,%rdi
+    28b7:	e8 5e f9 ff ff       	call   221a <nel::heapless::Array<U8Buf<256ul>, 8ul>::len() const>
+    28bc:	48 89 c2             	mov    %rax,%rdx
+    28bf:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    28c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28c7:	48 89 ce             	mov    %rcx,%rsi
+    28ca:	48 89 c7             	mov    %rax,%rdi
+    28cd:	e8 22 03 00 00       	call   2bf4 <nel::Slice<U8Buf<256ul> const>::Slice(U8Buf<256ul> const*, unsigned long)>
+        }
+    28d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28d6:	c9                   	leave
+    28d7:	c3                   	ret
+
+00000000000028d8 <nel::Slice<U8Buf<256ul> const>::iter() const>:
+        constexpr Iterator iter(void) const
+    28d8:	55                   	push   %rbp
+    28d9:	48 89 e5             	mov    %rsp,%rbp
+    28dc:	53                   	push   %rbx
+    28dd:	48 83 ec 18          	sub    $0x18,%rsp
+    28e1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    28e5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return Iterator(ptr(), len());
+    28e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    28ed:	48 89 c7             	mov    %rax,%rdi
+    28f0:	e8 3b 03 00 00       	call   2c30 <nel::Slice<U8Buf<256ul> const>::len() const>
+    28f5:	48 89 c3             	mov    %rax,%rbx
+    28f8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    28fc:	48 89 c7             	mov    %rax,%rdi
+    28ff:	e8 1a 03 00 00       	call   2c1e <nel::Slice<U8Buf<256ul> const>::ptr() const>
+    2904:	48 89 c1             	mov    %rax,%rcx
+    2907:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    290b:	48 89 da             	mov    %rbx,%rdx
+    290e:	48 89 ce             	mov    %rcx,%rsi
+    2911:	48 89 c7             	mov    %rax,%rdi
+    2914:	e8 29 03 00 00       	call   2c42 <nel::SliceIterator<U8Buf<256ul> const>::SliceIterator(U8Buf<256ul> const*, unsigned long)>
+        }
+    2919:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    291d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2921:	c9                   	leave
+    2922:	c3                   	ret
+    2923:	90                   	nop
+
+0000000000002924 <nel::SliceIterator<U8Buf<256ul> const>::is_done() const>:
+        constexpr bool is_done(void) const
+    2924:	55                   	push   %rbp
+    2925:	48 89 e5             	mov    %rsp,%rbp
+    2928:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (b_ == e_);
+    292c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2930:	48 8b 10             	mov    (%rax),%rdx
+    2933:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2937:	48 8b 40 08          	mov    0x8(%rax),%rax
+    293b:	48 39 c2             	cmp    %rax,%rdx
+    293e:	0f 94 c0             	sete   %al
+        }
+    2941:	5d                   	pop    %rbp
+    2942:	c3                   	ret
+    2943:	90                   	nop
+
+0000000000002944 <nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}::operator()(U8Buf<256ul> const&) const>:
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    2944:	55                   	push   %rbp
+    2945:	48 89 e5             	mov    %rsp,%rbp
+    2948:	48 83 ec 10          	sub    $0x10,%rsp
+    294c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2950:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2954:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2958:	48 8b 00             	mov    (%rax),%rax
+    295b:	be 2c 00 00 00       	mov    $0x2c,%esi
+    2960:	48 89 c7             	mov    %rax,%rdi
+    2963:	e8 43 0e 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+    2968:	48 89 c2             	mov    %rax,%rdx
+    296b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    296f:	48 89 c6             	mov    %rax,%rsi
+    2972:	48 89 d7             	mov    %rdx,%rdi
+    2975:	e8 dc fc ff ff       	call   2656 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    297a:	90                   	nop
+    297b:	c9                   	leave
+    297c:	c3                   	ret
+
+000000000000297d <nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)>:
+        friend Log &operator<<(Log &outs, ItT const &it)
+    297d:	    55                   	push   %rbp
+    297e:	    48 89 e5             	mov    %rsp,%rbp
+    2981:	    48 83 ec 30          	sub    $0x30,%rsp
+    2985:	    48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    2989:	    48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+            outs << '[';
+    298d:	    48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2991:	    be 5b 00 00 00       	mov    $0x5b,%esi
+    2996:	    48 89 c7             	mov    %rax,%rdi
+    2999:	    e8 0d 0e 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+            ItT it2 = it;
+    299e:	    48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    29a2:	    48 8b 50 08          	mov    0x8(%rax),%rdx
+    29a6:	    48 8b 00             	mov    (%rax),%rax
+    29a9:	    48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    29ad:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            if (!it2.is_done()) {
+    29b1:	    48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    29b5:	    48 89 c7             	mov    %rax,%rdi
+    29b8:	    e8 67 ff ff ff       	call   2924 <nel::SliceIterator<U8Buf<256ul> const>::is_done() const>
+    29bd:	    83 f0 01             	xor    $0x1,%eax
+    29c0:	    84 c0                	test   %al,%al
+    29c2:	/-- 74 45                	je     2a09 <nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)+0x8c>
+                outs << it2.deref();
+    29c4:	|   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    29c8:	|   48 89 c7             	mov    %rax,%rdi
+    29cb:	|   e8 aa 02 00 00       	call   2c7a <nel::SliceIterator<U8Buf<256ul> const>::deref()>
+    29d0:	|   48 89 c2             	mov    %rax,%rdx
+    29d3:	|   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    29d7:	|   48 89 d6             	mov    %rdx,%rsi
+    29da:	|   48 89 c7             	mov    %rax,%rdi
+    29dd:	|   e8 74 fc ff ff       	call   2656 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+                it2.inc();
+    29e2:	|   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    29e6:	|   48 89 c7             	mov    %rax,%rdi
+    29e9:	|   e8 9e 02 00 00       	call   2c8c <nel::SliceIterator<U8Buf<256ul> const>::inc()>
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    29ee:	|   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    29f2:	|   48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    29f6:	|   48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    29fa:	|   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    29fe:	|   48 89 d6             	mov    %rdx,%rsi
+    2a01:	|   48 89 c7             	mov    %rax,%rdi
+    2a04:	|   e8 a3 02 00 00       	call   2cac <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}>(nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}&&)>
+            outs << ']';
+    2a09:	\-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2a0d:	    be 5d 00 00 00       	mov    $0x5d,%esi
+    2a12:	    48 89 c7             	mov    %rax,%rdi
+    2a15:	    e8 91 0d 00 00       	call   37ab <nel::operator<<(nel::Log&, char)>
+            return outs;
+    2a1a:	    48 8b 45 d8          	mov    -0x28(%rbp),%rax
+        }
+    2a1e:	    c9                   	leave
+    2a1f:	    c3                   	ret
+
+0000000000002a20 <nel::Slice<U8Buf<256ul> >::try_get(unsigned long) const>:
+        constexpr Optional<Type &> try_get(Index idx) const
+    2a20:	       55                   	push   %rbp
+    2a21:	       48 89 e5             	mov    %rsp,%rbp
+    2a24:	       48 83 ec 20          	sub    $0x20,%rsp
+    2a28:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2a2c:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2a30:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            return (idx >= len_) ? None : Optional<Type &>::Some(content_[idx]);
+    2a34:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a38:	       48 8b 40 08          	mov    0x8(%rax),%rax
+    2a3c:	       48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    2a40:	   /-- 72 18                	jb     2a5a <nel::Slice<U8Buf<256ul> >::try_get(unsigned long) const+0x3a>
+    2a42:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a46:	   |   48 8d 15 bc 15 00 00 	lea    0x15bc(%rip),%rdx        # 4009 <nel::None>
+    2a4d:	   |   48 89 d6             	mov    %rdx,%rsi
+    2a50:	   |   48 89 c7             	mov    %rax,%rdi
+    2a53:	   |   e8 f4 02 00 00       	call   2d4c <nel::Optional<U8Buf<256ul>&>::Optional(nel::NoneT const&)>
+    2a58:	/--|-- eb 21                	jmp    2a7b <nel::Slice<U8Buf<256ul> >::try_get(unsigned long) const+0x5b>
+    2a5a:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a5e:	|      48 8b 00             	mov    (%rax),%rax
+    2a61:	|      48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2a65:	|      48 c1 e2 08          	shl    $0x8,%rdx
+    2a69:	|      48 01 c2             	add    %rax,%rdx
+    2a6c:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a70:	|      48 89 d6             	mov    %rdx,%rsi
+    2a73:	|      48 89 c7             	mov    %rax,%rdi
+    2a76:	|      e8 9c 02 00 00       	call   2d17 <nel::Optional<U8Buf<256ul>&>::Some(U8Buf<256ul>&)>
+        }
+    2a7b:	\----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a7f:	       c9                   	leave
+    2a80:	       c3                   	ret
+    2a81:	       90                   	nop
+
+0000000000002a82 <U8Buf<256ul>& nel::Optional<U8Buf<256ul>&>::consume<U8Buf<256ul>&, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}&&, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_some, Fn2 &&on_none, Context const &ctx = Context())
+    2a82:	             55                   	push   %rbp
+    2a83:	             48 89 e5             	mov    %rsp,%rbp
+    2a86:	             48 83 ec 30          	sub    $0x30,%rsp
+    2a8a:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2a8e:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2a92:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    2a96:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    2a9a:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a9e:	             8b 00                	mov    (%rax),%eax
+    2aa0:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    2aa3:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2aa7:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // optional::consume
+    2aad:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    2ab1:	         /-- 74 14                	je     2ac7 <U8Buf<256ul>& nel::Optional<U8Buf<256ul>&>::consume<U8Buf<256ul>&, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}&&, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x45>
+    2ab3:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    2ab7:	/--------|-- 7f 5e                	jg     2b17 <U8Buf<256ul>& nel::Optional<U8Buf<256ul>&>::consume<U8Buf<256ul>&, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}&&, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x95>
+    2ab9:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2abd:	|  /-----|-- 74 42                	je     2b01 <U8Buf<256ul>& nel::Optional<U8Buf<256ul>&>::consume<U8Buf<256ul>&, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}&&, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x7f>
+    2abf:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    2ac3:	|  |  /--|-- 74 2e                	je     2af3 <U8Buf<256ul>& nel::Optional<U8Buf<256ul>&>::consume<U8Buf<256ul>&, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}&&, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x71>
+    2ac5:	+--|--|--|-- eb 50                	jmp    2b17 <U8Buf<256ul>& nel::Optional<U8Buf<256ul>&>::consume<U8Buf<256ul>&, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}&&, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x95>
+                    return on_some(forward<T>(*some_));
+    2ac7:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2acb:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    2acf:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2ad2:	|  |  |      e8 8f 02 00 00       	call   2d66 <nel::Element<U8Buf<256ul>&>::operator*()>
+    2ad7:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2ada:	|  |  |      e8 a1 02 00 00       	call   2d80 <U8Buf<256ul>& nel::forward<U8Buf<256ul>&, U8Buf<256ul> >(U8Buf<256ul>&)>
+    2adf:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    2ae2:	|  |  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2ae6:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    2ae9:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2aec:	|  |  |      e8 cd fa ff ff       	call   25be <nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}::operator()(U8Buf<256ul>&) const>
+    2af1:	|  |  |  /-- eb 3a                	jmp    2b2d <U8Buf<256ul>& nel::Optional<U8Buf<256ul>&>::consume<U8Buf<256ul>&, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}&&, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0xab>
+                    return on_none();
+    2af3:	|  |  \--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2af7:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2afa:	|  |     |   e8 d1 fa ff ff       	call   25d0 <nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}::operator()() const>
+    2aff:	|  |     +-- eb 2c                	jmp    2b2d <U8Buf<256ul>& nel::Optional<U8Buf<256ul>&>::consume<U8Buf<256ul>&, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&)#1}&&, nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0xab>
+                    nel::panic("invalid Optional", ctx);
+    2b01:	|  \-----|-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2b05:	|        |   48 89 c6             	mov    %rax,%rsi
+    2b08:	|        |   48 8d 05 f8 15 00 00 	lea    0x15f8(%rip),%rax        # 4107 <nel::sort::ninther_n+0xe7>
+    2b0f:	|        |   48 89 c7             	mov    %rax,%rdi
+    2b12:	|        |   e8 88 03 00 00       	call   2e9f <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Optional", ctx);
+    2b17:	\--------|-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2b1b:	         |   48 89 c6             	mov    %rax,%rsi
+    2b1e:	         |   48 8d 05 c3 15 00 00 	lea    0x15c3(%rip),%rax        # 40e8 <nel::sort::ninther_n+0xc8>
+    2b25:	         |   48 89 c7             	mov    %rax,%rdi
+    2b28:	         |   e8 72 03 00 00       	call   2e9f <nel::panic(char const*, nel::Context const&)>
+        }
+    2b2d:	         \-> c9                   	leave
+    2b2e:	             c3                   	ret
+    2b2f:	             90                   	nop
+
+0000000000002b30 <U8Buf<256ul>::len() const>:
+        constexpr Length len(void) const
+    2b30:	55                   	push   %rbp
+    2b31:	48 89 e5             	mov    %rsp,%rbp
+    2b34:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return N;
+    2b38:	b8 00 01 00 00       	mov    $0x100,%eax
+        }
+    2b3d:	5d                   	pop    %rbp
+    2b3e:	c3                   	ret
+
+0000000000002b3f <U8Buf<256ul>*&& nel::move<U8Buf<256ul>*>(U8Buf<256ul>*&)>:
+constexpr T &&move(T &v)
+    2b3f:	55                   	push   %rbp
+    2b40:	48 89 e5             	mov    %rsp,%rbp
+    2b43:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    2b47:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2b4b:	5d                   	pop    %rbp
+    2b4c:	c3                   	ret
+    2b4d:	90                   	nop
+
+0000000000002b4e <auto nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)::{lambda(auto:1&)#1}::operator()<U8Buf<256ul> >(U8Buf<256ul>&) const>:
+            iter().for_each([&](auto &e) { new (&e) Type(v); });
+    2b4e:	55                   	push   %rbp
+    2b4f:	48 89 e5             	mov    %rsp,%rbp
+    2b52:	48 83 ec 10          	sub    $0x10,%rsp
+    2b56:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2b5a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2b5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b62:	48 89 c6             	mov    %rax,%rsi
+    2b65:	bf 00 01 00 00       	mov    $0x100,%edi
+    2b6a:	e8 7f f5 ff ff       	call   20ee <operator new(unsigned long, void*)>
+    2b6f:	48 89 c2             	mov    %rax,%rdx
+    2b72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b76:	48 8b 00             	mov    (%rax),%rax
+    2b79:	48 89 c6             	mov    %rax,%rsi
+    2b7c:	48 89 d7             	mov    %rdx,%rdi
+    2b7f:	e8 0a 02 00 00       	call   2d8e <U8Buf<256ul>::U8Buf(U8Buf<256ul> const&)>
+    2b84:	90                   	nop
+    2b85:	c9                   	leave
+    2b86:	c3                   	ret
+    2b87:	90                   	nop
+
+0000000000002b88 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)::{lambda(auto:1&)#1}>(nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)::{lambda(auto:1&)#1}&&)>:
+        void for_each(F &&fn)
+    2b88:	       55                   	push   %rbp
+    2b89:	       48 89 e5             	mov    %rsp,%rbp
+    2b8c:	       48 83 ec 10          	sub    $0x10,%rsp
+    2b90:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2b94:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            for (; !self().is_done(); self().inc()) {
+    2b98:	   /-- eb 3a                	jmp    2bd4 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)::{lambda(auto:1&)#1}>(nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)::{lambda(auto:1&)#1}&&)+0x4c>
+                fn(self().deref());
+    2b9a:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b9e:	|  |   48 89 c7             	mov    %rax,%rdi
+    2ba1:	|  |   e8 ba f7 ff ff       	call   2360 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    2ba6:	|  |   48 89 c7             	mov    %rax,%rdi
+    2ba9:	|  |   e8 bc fb ff ff       	call   276a <nel::SliceIterator<U8Buf<256ul> >::deref()>
+    2bae:	|  |   48 89 c2             	mov    %rax,%rdx
+    2bb1:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2bb5:	|  |   48 89 d6             	mov    %rdx,%rsi
+    2bb8:	|  |   48 89 c7             	mov    %rax,%rdi
+    2bbb:	|  |   e8 8e ff ff ff       	call   2b4e <auto nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)::{lambda(auto:1&)#1}::operator()<U8Buf<256ul> >(U8Buf<256ul>&) const>
+            for (; !self().is_done(); self().inc()) {
+    2bc0:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2bc4:	|  |   48 89 c7             	mov    %rax,%rdi
+    2bc7:	|  |   e8 94 f7 ff ff       	call   2360 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    2bcc:	|  |   48 89 c7             	mov    %rax,%rdi
+    2bcf:	|  |   e8 76 fb ff ff       	call   274a <nel::SliceIterator<U8Buf<256ul> >::inc()>
+    2bd4:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2bd8:	|      48 89 c7             	mov    %rax,%rdi
+    2bdb:	|      e8 80 f7 ff ff       	call   2360 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    2be0:	|      48 89 c7             	mov    %rax,%rdi
+    2be3:	|      e8 14 f7 ff ff       	call   22fc <nel::SliceIterator<U8Buf<256ul> >::is_done() const>
+    2be8:	|      83 f0 01             	xor    $0x1,%eax
+    2beb:	|      84 c0                	test   %al,%al
+    2bed:	\----- 75 ab                	jne    2b9a <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)::{lambda(auto:1&)#1}>(nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)::{lambda(auto:1&)#1}&&)+0x12>
+        }
+    2bef:	       90                   	nop
+    2bf0:	       90                   	nop
+    2bf1:	       c9                   	leave
+    2bf2:	       c3                   	ret
+    2bf3:	       90                   	nop
+
+0000000000002bf4 <nel::Slice<U8Buf<256ul> const>::Slice(U8Buf<256ul> const*, unsigned long)>:
+        constexpr Slice(Type *const p, Length len)
+    2bf4:	55                   	push   %rbp
+    2bf5:	48 89 e5             	mov    %rsp,%rbp
+    2bf8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2bfc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2c00:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : content_(p)
+    2c04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c08:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2c0c:	48 89 10             	mov    %rdx,(%rax)
+            , len_(len)
+    2c0f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c13:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2c17:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    2c1b:	90                   	nop
+    2c1c:	5d                   	pop    %rbp
+    2c1d:	c3                   	ret
+
+0000000000002c1e <nel::Slice<U8Buf<256ul> const>::ptr() const>:
+        constexpr Type *ptr(void) const
+    2c1e:	55                   	push   %rbp
+    2c1f:	48 89 e5             	mov    %rsp,%rbp
+    2c22:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return content_;
+    2c26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c2a:	48 8b 00             	mov    (%rax),%rax
+        }
+    2c2d:	5d                   	pop    %rbp
+    2c2e:	c3                   	ret
+    2c2f:	90                   	nop
+
+0000000000002c30 <nel::Slice<U8Buf<256ul> const>::len() const>:
+        constexpr Length len(void) const
+    2c30:	55                   	push   %rbp
+    2c31:	48 89 e5             	mov    %rsp,%rbp
+    2c34:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    2c38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c3c:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    2c40:	5d                   	pop    %rbp
+    2c41:	c3                   	ret
+
+0000000000002c42 <nel::SliceIterator<U8Buf<256ul> const>::SliceIterator(U8Buf<256ul> const*, unsigned long)>:
+        constexpr SliceIterator(T arr[], Count len)
+    2c42:	55                   	push   %rbp
+    2c43:	48 89 e5             	mov    %rsp,%rbp
+    2c46:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2c4a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2c4e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : b_(arr)
+    2c52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c56:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2c5a:	48 89 10             	mov    %rdx,(%rax)
+            , e_(arr + len)
+    2c5d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c61:	48 c1 e0 08          	shl    $0x8,%rax
+    2c65:	48 89 c2             	mov    %rax,%rdx
+    2c68:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2c6c:	48 01 c2             	add    %rax,%rdx
+    2c6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c73:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    2c77:	90                   	nop
+    2c78:	5d                   	pop    %rbp
+    2c79:	c3                   	ret
+
+0000000000002c7a <nel::SliceIterator<U8Buf<256ul> const>::deref()>:
+        OutT deref(void)
+    2c7a:	55                   	push   %rbp
+    2c7b:	48 89 e5             	mov    %rsp,%rbp
+    2c7e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return *b_;
+    2c82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c86:	48 8b 00             	mov    (%rax),%rax
+        }
+    2c89:	5d                   	pop    %rbp
+    2c8a:	c3                   	ret
+    2c8b:	90                   	nop
+
+0000000000002c8c <nel::SliceIterator<U8Buf<256ul> const>::inc()>:
+        void inc(void)
+    2c8c:	55                   	push   %rbp
+    2c8d:	48 89 e5             	mov    %rsp,%rbp
+    2c90:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            ++b_;
+    2c94:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c98:	48 8b 00             	mov    (%rax),%rax
+    2c9b:	48 8d 90 00 01 00 00 	lea    0x100(%rax),%rdx
+    2ca2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ca6:	48 89 10             	mov    %rdx,(%rax)
+        }
+    2ca9:	90                   	nop
+    2caa:	5d                   	pop    %rbp
+    2cab:	c3                   	ret
+
+0000000000002cac <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}>(nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}&&)>:
+        void for_each(F &&fn)
+    2cac:	       55                   	push   %rbp
+    2cad:	       48 89 e5             	mov    %rsp,%rbp
+    2cb0:	       48 83 ec 10          	sub    $0x10,%rsp
+    2cb4:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2cb8:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            for (; !self().is_done(); self().inc()) {
+    2cbc:	   /-- eb 3a                	jmp    2cf8 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}>(nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}&&)+0x4c>
+                fn(self().deref());
+    2cbe:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cc2:	|  |   48 89 c7             	mov    %rax,%rdi
+    2cc5:	|  |   e8 f0 00 00 00       	call   2dba <nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::self()>
+    2cca:	|  |   48 89 c7             	mov    %rax,%rdi
+    2ccd:	|  |   e8 a8 ff ff ff       	call   2c7a <nel::SliceIterator<U8Buf<256ul> const>::deref()>
+    2cd2:	|  |   48 89 c2             	mov    %rax,%rdx
+    2cd5:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2cd9:	|  |   48 89 d6             	mov    %rdx,%rsi
+    2cdc:	|  |   48 89 c7             	mov    %rax,%rdi
+    2cdf:	|  |   e8 60 fc ff ff       	call   2944 <nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}::operator()(U8Buf<256ul> const&) const>
+            for (; !self().is_done(); self().inc()) {
+    2ce4:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ce8:	|  |   48 89 c7             	mov    %rax,%rdi
+    2ceb:	|  |   e8 ca 00 00 00       	call   2dba <nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::self()>
+    2cf0:	|  |   48 89 c7             	mov    %rax,%rdi
+    2cf3:	|  |   e8 94 ff ff ff       	call   2c8c <nel::SliceIterator<U8Buf<256ul> const>::inc()>
+    2cf8:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cfc:	|      48 89 c7             	mov    %rax,%rdi
+    2cff:	|      e8 b6 00 00 00       	call   2dba <nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::self()>
+    2d04:	|      48 89 c7             	mov    %rax,%rdi
+    2d07:	|      e8 18 fc ff ff       	call   2924 <nel::SliceIterator<U8Buf<256ul> const>::is_done() const>
+    2d0c:	|      83 f0 01             	xor    $0x1,%eax
+    2d0f:	|      84 c0                	test   %al,%al
+    2d11:	\----- 75 ab                	jne    2cbe <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}>(nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}&&)+0x12>
+        }
+    2d13:	       90                   	nop
+    2d14:	       90                   	nop
+    2d15:	       c9                   	leave
+    2d16:	       c3                   	ret
+
+0000000000002d17 <nel::Optional<U8Buf<256ul>&>::Some(U8Buf<256ul>&)>:
+        constexpr static Optional Some(T &&v)
+    2d17:	55                   	push   %rbp
+    2d18:	48 89 e5             	mov    %rsp,%rbp
+    2d1b:	48 83 ec 10          	sub    $0x10,%rsp
+    2d1f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2d23:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Optional(Phantom<Tag::SOME>(), forward<T>(v));
+    2d27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2d2b:	48 89 c7             	mov    %rax,%rdi
+    2d2e:	e8 4d 00 00 00       	call   2d80 <U8Buf<256ul>& nel::forward<U8Buf<256ul>&, U8Buf<256ul> >(U8Buf<256ul>&)>
+    2d33:	48 89 c2             	mov    %rax,%rdx
+    2d36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d3a:	48 89 d6             	mov    %rdx,%rsi
+    2d3d:	48 89 c7             	mov    %rax,%rdi
+    2d40:	e8 8b 00 00 00       	call   2dd0 <nel::Optional<U8Buf<256ul>&>::Optional(nel::Optional<U8Buf<256ul>&>::Phantom<(nel::Optional<U8Buf<256ul>&>::Tag)2>, U8Buf<256ul>&)>
+        }
+    2d45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d49:	c9                   	leave
+    2d4a:	c3                   	ret
+    2d4b:	90                   	nop
+
+0000000000002d4c <nel::Optional<U8Buf<256ul>&>::Optional(nel::NoneT const&)>:
+        constexpr Optional(NoneT const &)
+    2d4c:	55                   	push   %rbp
+    2d4d:	48 89 e5             	mov    %rsp,%rbp
+    2d50:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2d54:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : tag_(Tag::NONE)
+    2d58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d5c:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+        }
+    2d62:	90                   	nop
+    2d63:	5d                   	pop    %rbp
+    2d64:	c3                   	ret
+    2d65:	90                   	nop
+
+0000000000002d66 <nel::Element<U8Buf<256ul>&>::operator*()>:
+        constexpr Type const &operator*(void) const
+        {
+            return ref();
+        }
+
+        constexpr Type &operator*(void)
+    2d66:	55                   	push   %rbp
+    2d67:	48 89 e5             	mov    %rsp,%rbp
+    2d6a:	48 83 ec 10          	sub    $0x10,%rsp
+    2d6e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    2d72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d76:	48 89 c7             	mov    %rax,%rdi
+    2d79:	e8 94 00 00 00       	call   2e12 <nel::Element<U8Buf<256ul>&>::ref()>
+        }
+    2d7e:	c9                   	leave
+    2d7f:	c3                   	ret
+
+0000000000002d80 <U8Buf<256ul>& nel::forward<U8Buf<256ul>&, U8Buf<256ul> >(U8Buf<256ul>&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel so to not need std.
+ */
+template<typename U, typename T>
+constexpr U &&forward(T &t)
+    2d80:	55                   	push   %rbp
+    2d81:	48 89 e5             	mov    %rsp,%rbp
+    2d84:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<U &&>(t);
+    2d88:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2d8c:	5d                   	pop    %rbp
+    2d8d:	c3                   	ret
+
+0000000000002d8e <U8Buf<256ul>::U8Buf(U8Buf<256ul> const&)>:
+        constexpr U8Buf(U8Buf const &o)
+    2d8e:	55                   	push   %rbp
+    2d8f:	48 89 e5             	mov    %rsp,%rbp
+    2d92:	48 83 ec 10          	sub    $0x10,%rsp
+    2d96:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2d9a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            nel::elem::copy(data_, o.data_, N);
+    2d9e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2da2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2da6:	ba 00 01 00 00       	mov    $0x100,%edx
+    2dab:	48 89 ce             	mov    %rcx,%rsi
+    2dae:	48 89 c7             	mov    %rax,%rdi
+    2db1:	e8 9f 01 00 00       	call   2f55 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        }
+    2db6:	90                   	nop
+    2db7:	c9                   	leave
+    2db8:	c3                   	ret
+    2db9:	90                   	nop
+
+0000000000002dba <nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::self()>:
+        constexpr ItT &self(void)
+    2dba:	55                   	push   %rbp
+    2dbb:	48 89 e5             	mov    %rsp,%rbp
+    2dbe:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    2dc2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2dc6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    2dca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2dce:	5d                   	pop    %rbp
+    2dcf:	c3                   	ret
+
+0000000000002dd0 <nel::Optional<U8Buf<256ul>&>::Optional(nel::Optional<U8Buf<256ul>&>::Phantom<(nel::Optional<U8Buf<256ul>&>::Tag)2>, U8Buf<256ul>&)>:
+        constexpr Optional(Phantom<Tag::SOME> const, T &&v)
+    2dd0:	55                   	push   %rbp
+    2dd1:	48 89 e5             	mov    %rsp,%rbp
+    2dd4:	53                   	push   %rbx
+    2dd5:	48 83 ec 18          	sub    $0x18,%rsp
+    2dd9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2ddd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::SOME)
+    2de1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2de5:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , some_(forward<T>(v))
+    2deb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2def:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    2df3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2df7:	48 89 c7             	mov    %rax,%rdi
+    2dfa:	e8 81 ff ff ff       	call   2d80 <U8Buf<256ul>& nel::forward<U8Buf<256ul>&, U8Buf<256ul> >(U8Buf<256ul>&)>
+    2dff:	48 89 c6             	mov    %rax,%rsi
+    2e02:	48 89 df             	mov    %rbx,%rdi
+    2e05:	e8 1a 00 00 00       	call   2e24 <nel::Element<U8Buf<256ul>&>::Element(U8Buf<256ul>&)>
+        }
+    2e0a:	90                   	nop
+    2e0b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2e0f:	c9                   	leave
+    2e10:	c3                   	ret
+    2e11:	90                   	nop
+
+0000000000002e12 <nel::Element<U8Buf<256ul>&>::ref()>:
+        constexpr Type &ref(void)
+    2e12:	55                   	push   %rbp
+    2e13:	48 89 e5             	mov    %rsp,%rbp
+    2e16:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2e1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e1e:	48 8b 00             	mov    (%rax),%rax
+        }
+    2e21:	5d                   	pop    %rbp
+    2e22:	c3                   	ret
+    2e23:	90                   	nop
+
+0000000000002e24 <nel::Element<U8Buf<256ul>&>::Element(U8Buf<256ul>&)>:
+        constexpr Element(Type &&val)
+    2e24:	55                   	push   %rbp
+    2e25:	48 89 e5             	mov    %rsp,%rbp
+    2e28:	48 83 ec 10          	sub    $0x10,%rsp
+    2e2c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2e30:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    2e34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e38:	48 89 c7             	mov    %rax,%rdi
+    2e3b:	e8 40 ff ff ff       	call   2d80 <U8Buf<256ul>& nel::forward<U8Buf<256ul>&, U8Buf<256ul> >(U8Buf<256ul>&)>
+    2e40:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2e44:	48 89 02             	mov    %rax,(%rdx)
+        }
+    2e47:	90                   	nop
+    2e48:	c9                   	leave
+    2e49:	c3                   	ret
+
+0000000000002e4a <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    2e4a:	55                   	push   %rbp
+    2e4b:	48 89 e5             	mov    %rsp,%rbp
+    std::abort();
+    2e4e:	e8 ed e1 ff ff       	call   1040 <abort@plt>
+
+0000000000002e53 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    2e53:	55                   	push   %rbp
+    2e54:	48 89 e5             	mov    %rsp,%rbp
+    2e57:	48 83 ec 10          	sub    $0x10,%rsp
+    2e5b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    2e5f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e63:	48 8b 30             	mov    (%rax),%rsi
+    2e66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e6a:	8b 48 10             	mov    0x10(%rax),%ecx
+    2e6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e71:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2e75:	48 8b 05 e4 41 00 00 	mov    0x41e4(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    2e7c:	4c 8d 0d 95 12 00 00 	lea    0x1295(%rip),%r9        # 4118 <nel::sort::ninther_n+0xf8>
+    2e83:	49 89 f0             	mov    %rsi,%r8
+    2e86:	48 8d 35 91 12 00 00 	lea    0x1291(%rip),%rsi        # 411e <nel::sort::ninther_n+0xfe>
+    2e8d:	48 89 c7             	mov    %rax,%rdi
+    2e90:	b8 00 00 00 00       	mov    $0x0,%eax
+    2e95:	e8 f6 e1 ff ff       	call   1090 <fprintf@plt>
+    abort();
+    2e9a:	e8 ab ff ff ff       	call   2e4a <nel::abort()>
+
+0000000000002e9f <nel::panic(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    2e9f:	55                   	push   %rbp
+    2ea0:	48 89 e5             	mov    %rsp,%rbp
+    2ea3:	48 83 ec 10          	sub    $0x10,%rsp
+    2ea7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2eab:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    2eaf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2eb3:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    2eb6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2eba:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    2ebd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ec1:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    2ec5:	48 8b 05 94 41 00 00 	mov    0x4194(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    2ecc:	48 83 ec 08          	sub    $0x8,%rsp
+    2ed0:	ff 75 f8             	push   -0x8(%rbp)
+    2ed3:	4c 8d 0d 3e 12 00 00 	lea    0x123e(%rip),%r9        # 4118 <nel::sort::ninther_n+0xf8>
+    2eda:	49 89 f0             	mov    %rsi,%r8
+    2edd:	48 8d 35 4b 12 00 00 	lea    0x124b(%rip),%rsi        # 412f <nel::sort::ninther_n+0x10f>
+    2ee4:	48 89 c7             	mov    %rax,%rdi
+    2ee7:	b8 00 00 00 00       	mov    $0x0,%eax
+    2eec:	e8 9f e1 ff ff       	call   1090 <fprintf@plt>
+    2ef1:	48 83 c4 10          	add    $0x10,%rsp
+            "PANIC",
+            msg);
+    abort();
+    2ef5:	e8 50 ff ff ff       	call   2e4a <nel::abort()>
+
+0000000000002efa <nel::assert_fail(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    2efa:	55                   	push   %rbp
+    2efb:	48 89 e5             	mov    %rsp,%rbp
+    2efe:	48 83 ec 10          	sub    $0x10,%rsp
+    2f02:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2f06:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    2f0a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2f0e:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    2f11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2f15:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    2f18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2f1c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    2f20:	48 8b 05 39 41 00 00 	mov    0x4139(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    2f27:	48 83 ec 08          	sub    $0x8,%rsp
+    2f2b:	ff 75 f8             	push   -0x8(%rbp)
+    2f2e:	4c 8d 0d 0f 12 00 00 	lea    0x120f(%rip),%r9        # 4144 <nel::sort::ninther_n+0x124>
+    2f35:	49 89 f0             	mov    %rsi,%r8
+    2f38:	48 8d 35 f0 11 00 00 	lea    0x11f0(%rip),%rsi        # 412f <nel::sort::ninther_n+0x10f>
+    2f3f:	48 89 c7             	mov    %rax,%rdi
+    2f42:	b8 00 00 00 00       	mov    $0x0,%eax
+    2f47:	e8 44 e1 ff ff       	call   1090 <fprintf@plt>
+    2f4c:	48 83 c4 10          	add    $0x10,%rsp
+            "ASSERT FAIL",
+            msg);
+    abort();
+    2f50:	e8 f5 fe ff ff       	call   2e4a <nel::abort()>
+
+0000000000002f55 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    2f55:	55                   	push   %rbp
+    2f56:	48 89 e5             	mov    %rsp,%rbp
+    2f59:	48 83 ec 20          	sub    $0x20,%rsp
+    2f5d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2f61:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2f65:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    2f69:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2f6d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2f71:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f75:	48 89 ce             	mov    %rcx,%rsi
+    2f78:	48 89 c7             	mov    %rax,%rdi
+    2f7b:	e8 20 e1 ff ff       	call   10a0 <memcpy@plt>
+}
+    2f80:	90                   	nop
+    2f81:	c9                   	leave
+    2f82:	c3                   	ret
+
+0000000000002f83 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    2f83:	55                   	push   %rbp
+    2f84:	48 89 e5             	mov    %rsp,%rbp
+    2f87:	48 83 ec 20          	sub    $0x20,%rsp
+    2f8b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2f8f:	89 f0                	mov    %esi,%eax
+    2f91:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2f95:	88 45 f4             	mov    %al,-0xc(%rbp)
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    2f98:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    2f9c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2fa0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2fa4:	89 ce                	mov    %ecx,%esi
+    2fa6:	48 89 c7             	mov    %rax,%rdi
+    2fa9:	e8 b2 e0 ff ff       	call   1060 <memset@plt>
+}
+    2fae:	90                   	nop
+    2faf:	c9                   	leave
+    2fb0:	c3                   	ret
+
+0000000000002fb1 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    2fb1:	55                   	push   %rbp
+    2fb2:	48 89 e5             	mov    %rsp,%rbp
+    2fb5:	48 83 ec 20          	sub    $0x20,%rsp
+    2fb9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2fbd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2fc1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    //     *id = *is;
+    // }
+    // for (uint8_t *id = d, *is = s, *const e = (d + n); id != e; ++is, ++id) {
+    //     *is = 0xa5;
+    // }
+    copy(d, s, n);
+    2fc5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2fc9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2fcd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2fd1:	48 89 ce             	mov    %rcx,%rsi
+    2fd4:	48 89 c7             	mov    %rax,%rdi
+    2fd7:	e8 79 ff ff ff       	call   2f55 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    poison(s, n);
+    2fdc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2fe0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2fe4:	48 89 d6             	mov    %rdx,%rsi
+    2fe7:	48 89 c7             	mov    %rax,%rdi
+    2fea:	e8 60 07 00 00       	call   374f <nel::elem::poison(unsigned char*, unsigned long)>
+}
+    2fef:	90                   	nop
+    2ff0:	c9                   	leave
+    2ff1:	c3                   	ret
+
+0000000000002ff2 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    2ff2:	55                   	push   %rbp
+    2ff3:	48 89 e5             	mov    %rsp,%rbp
+    2ff6:	48 83 ec 20          	sub    $0x20,%rsp
+    2ffa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2ffe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3002:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    std::memmove(d, s, n);
+    3006:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    300a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    300e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3012:	48 89 ce             	mov    %rcx,%rsi
+    3015:	48 89 c7             	mov    %rax,%rdi
+    3018:	e8 a3 e0 ff ff       	call   10c0 <memmove@plt>
+}
+    301d:	90                   	nop
+    301e:	c9                   	leave
+    301f:	c3                   	ret
+
+0000000000003020 <nel::elem::wipe(unsigned char*, unsigned long)>:
+
+void wipe(uint8_t *const d, Length const n)
+{
+    3020:	55                   	push   %rbp
+    3021:	48 89 e5             	mov    %rsp,%rbp
+    3024:	48 83 ec 10          	sub    $0x10,%rsp
+    3028:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    302c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    set(d, 0xa5, n);
+    3030:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3034:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3038:	be a5 00 00 00       	mov    $0xa5,%esi
+    303d:	48 89 c7             	mov    %rax,%rdi
+    3040:	e8 3e ff ff ff       	call   2f83 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    3045:	90                   	nop
+    3046:	c9                   	leave
+    3047:	c3                   	ret
+
+0000000000003048 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    3048:	55                   	push   %rbp
+    3049:	48 89 e5             	mov    %rsp,%rbp
+    304c:	48 83 ec 20          	sub    $0x20,%rsp
+    3050:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3054:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3058:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    305c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3060:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3064:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3068:	48 89 ce             	mov    %rcx,%rsi
+    306b:	48 89 c7             	mov    %rax,%rdi
+    306e:	e8 0d e0 ff ff       	call   1080 <memcmp@plt>
+    3073:	85 c0                	test   %eax,%eax
+    3075:	0f 94 c0             	sete   %al
+}
+    3078:	c9                   	leave
+    3079:	c3                   	ret
+
+000000000000307a <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    307a:	55                   	push   %rbp
+    307b:	48 89 e5             	mov    %rsp,%rbp
+    307e:	48 83 ec 20          	sub    $0x20,%rsp
+    3082:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3086:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    308a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    308e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3092:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3096:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    309a:	48 89 ce             	mov    %rcx,%rsi
+    309d:	48 89 c7             	mov    %rax,%rdi
+    30a0:	e8 db df ff ff       	call   1080 <memcmp@plt>
+    30a5:	85 c0                	test   %eax,%eax
+    30a7:	0f 95 c0             	setne  %al
+}
+    30aa:	c9                   	leave
+    30ab:	c3                   	ret
+
+00000000000030ac <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>:
+
+// d[i] = p[i % 16] for i in [0, n), with normal stores:
+// the pattern once, then doubling the filled region.
+static void set_pattern(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    30ac:	       55                   	push   %rbp
+    30ad:	       48 89 e5             	mov    %rsp,%rbp
+    30b0:	       48 83 ec 30          	sub    $0x30,%rsp
+    30b4:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    30b8:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    30bc:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    Length done = (n < 16) ? n : 16;
+    30c0:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    30c4:	       ba 10 00 00 00       	mov    $0x10,%edx
+    30c9:	       48 39 d0             	cmp    %rdx,%rax
+    30cc:	       48 0f 47 c2          	cmova  %rdx,%rax
+    30d0:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    copy(d, p, done);
+    30d4:	       48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    30d8:	       48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    30dc:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    30e0:	       48 89 ce             	mov    %rcx,%rsi
+    30e3:	       48 89 c7             	mov    %rax,%rdi
+    30e6:	       e8 6a fe ff ff       	call   2f55 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    while (done < n) {
+    30eb:	   /-- eb 3e                	jmp    312b <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x7f>
+        Length const m = (done < n - done) ? done : n - done;
+    30ed:	/--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    30f1:	|  |   48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    30f5:	|  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    30f9:	|  |   48 39 c2             	cmp    %rax,%rdx
+    30fc:	|  |   48 0f 46 c2          	cmovbe %rdx,%rax
+    3100:	|  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        copy(d + done, d, m);
+    3104:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3108:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    310c:	|  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    3110:	|  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3114:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3118:	|  |   48 89 c6             	mov    %rax,%rsi
+    311b:	|  |   48 89 cf             	mov    %rcx,%rdi
+    311e:	|  |   e8 32 fe ff ff       	call   2f55 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        done += m;
+    3123:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3127:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+    while (done < n) {
+    312b:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    312f:	|      48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    3133:	\----- 72 b8                	jb     30ed <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x41>
+    }
+}
+    3135:	       90                   	nop
+    3136:	       90                   	nop
+    3137:	       c9                   	leave
+    3138:	       c3                   	ret
+
+0000000000003139 <nel::elem::load16(unsigned char const*)>:
+static constexpr Length streaming_min = 256;
+
+typedef long long int Line16 __attribute__((vector_size(16)));
+
+static inline Line16 load16(uint8_t const *const s)
+{
+    3139:	55                   	push   %rbp
+    313a:	48 89 e5             	mov    %rsp,%rbp
+    313d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Line16 v;
+    std::memcpy(&v, s, sizeof(v));
+    3141:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3145:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    3149:	48 8b 00             	mov    (%rax),%rax
+    314c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    3150:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    return v;
+    3154:	66 0f 6f 45 f0       	movdqa -0x10(%rbp),%xmm0
+}
+    3159:	5d                   	pop    %rbp
+    315a:	c3                   	ret
+
+000000000000315b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>:
+
+static inline void stream16(uint8_t *const d, Line16 const &v)
+{
+    315b:	55                   	push   %rbp
+    315c:	48 89 e5             	mov    %rsp,%rbp
+    315f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3163:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    3167:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    316b:	66 0f 6f 00          	movdqa (%rax),%xmm0
+    316f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3173:	66 0f e7 00          	movntdq %xmm0,(%rax)
+}
+    3177:	90                   	nop
+    3178:	5d                   	pop    %rbp
+    3179:	c3                   	ret
+
+000000000000317a <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    317a:	          55                   	push   %rbp
+    317b:	          48 89 e5             	mov    %rsp,%rbp
+    317e:	          48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    3182:	          48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    3186:	          48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    318a:	          48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    if (n < streaming_min) {
+    318e:	          48 81 7d 88 ff 00 00 	cmpq   $0xff,-0x78(%rbp)
+    3195:	          00 
+    3196:	      /-- 77 1c                	ja     31b4 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        copy(d, s, n);
+    3198:	      |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    319c:	      |   48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    31a0:	      |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    31a4:	      |   48 89 ce             	mov    %rcx,%rsi
+    31a7:	      |   48 89 c7             	mov    %rax,%rdi
+    31aa:	      |   e8 a6 fd ff ff       	call   2f55 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        return;
+    31af:	/-----|-- e9 98 01 00 00       	jmp    334c <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1d2>
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    31b4:	|     \-> 48 8b 45 98          	mov    -0x68(%rbp),%rax
+    31b8:	|         48 f7 d8             	neg    %rax
+    31bb:	|         83 e0 0f             	and    $0xf,%eax
+    31be:	|         48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    copy(d, s, head);
+    31c2:	|         48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    31c6:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    31ca:	|         48 8b 45 98          	mov    -0x68(%rbp),%rax
+    31ce:	|         48 89 ce             	mov    %rcx,%rsi
+    31d1:	|         48 89 c7             	mov    %rax,%rdi
+    31d4:	|         e8 7c fd ff ff       	call   2f55 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    Index i = head;
+    31d9:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    31dd:	|         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    31e1:	|     /-- e9 e1 00 00 00       	jmp    32c7 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        Line16 const a = load16(s + i);
+    31e6:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    31ea:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31ee:	|  |  |   48 01 d0             	add    %rdx,%rax
+    31f1:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    31f4:	|  |  |   e8 40 ff ff ff       	call   3139 <nel::elem::load16(unsigned char const*)>
+    31f9:	|  |  |   0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+        Line16 const b = load16(s + i + 16);
+    31fd:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3201:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    3205:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3209:	|  |  |   48 01 d0             	add    %rdx,%rax
+    320c:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    320f:	|  |  |   e8 25 ff ff ff       	call   3139 <nel::elem::load16(unsigned char const*)>
+    3214:	|  |  |   0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+        Line16 const c = load16(s + i + 32);
+    3218:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    321c:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    3220:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3224:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3227:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    322a:	|  |  |   e8 0a ff ff ff       	call   3139 <nel::elem::load16(unsigned char const*)>
+    322f:	|  |  |   0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+        Line16 const e = load16(s + i + 48);
+    3233:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3237:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    323b:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    323f:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3242:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3245:	|  |  |   e8 ef fe ff ff       	call   3139 <nel::elem::load16(unsigned char const*)>
+    324a:	|  |  |   0f 29 45 a0          	movaps %xmm0,-0x60(%rbp)
+        stream16(d + i, a);
+    324e:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    3252:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3256:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3259:	|  |  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    325d:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3260:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3263:	|  |  |   e8 f3 fe ff ff       	call   315b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, b);
+    3268:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    326c:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    3270:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3274:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3277:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    327b:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    327e:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3281:	|  |  |   e8 d5 fe ff ff       	call   315b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, c);
+    3286:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    328a:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    328e:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3292:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3295:	|  |  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    3299:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    329c:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    329f:	|  |  |   e8 b7 fe ff ff       	call   315b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, e);
+    32a4:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32a8:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    32ac:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    32b0:	|  |  |   48 01 c2             	add    %rax,%rdx
+    32b3:	|  |  |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    32b7:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    32ba:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    32bd:	|  |  |   e8 99 fe ff ff       	call   315b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    32c2:	|  |  |   48 83 45 f8 40       	addq   $0x40,-0x8(%rbp)
+    32c7:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32cb:	|  |      48 83 c0 40          	add    $0x40,%rax
+    32cf:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    32d3:	|  \----- 0f 83 0d ff ff ff    	jae    31e6 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x6c>
+    }
+    for (; i + 16 <= n; i += 16) {
+    32d9:	|     /-- eb 36                	jmp    3311 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x197>
+        stream16(d + i, load16(s + i));
+    32db:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    32df:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32e3:	|  |  |   48 01 d0             	add    %rdx,%rax
+    32e6:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    32e9:	|  |  |   e8 4b fe ff ff       	call   3139 <nel::elem::load16(unsigned char const*)>
+    32ee:	|  |  |   0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+    32f2:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    32f6:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32fa:	|  |  |   48 01 c2             	add    %rax,%rdx
+    32fd:	|  |  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    3301:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3304:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3307:	|  |  |   e8 4f fe ff ff       	call   315b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    330c:	|  |  |   48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+    3311:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3315:	|  |      48 83 c0 10          	add    $0x10,%rax
+    3319:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    331d:	|  \----- 73 bc                	jae    32db <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    331f:	|         0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    3322:	|         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3326:	|         48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    332a:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    332e:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3332:	|         48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    3336:	|         48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+    333a:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    333e:	|         48 01 d1             	add    %rdx,%rcx
+    3341:	|         48 89 c2             	mov    %rax,%rdx
+    3344:	|         48 89 cf             	mov    %rcx,%rdi
+    3347:	|         e8 09 fc ff ff       	call   2f55 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+}
+    334c:	\-------> c9                   	leave
+    334d:	          c3                   	ret
+
+000000000000334e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    334e:	          55                   	push   %rbp
+    334f:	          48 89 e5             	mov    %rsp,%rbp
+    3352:	          48 83 ec 60          	sub    $0x60,%rsp
+    3356:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    335a:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    335e:	          48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    if (n < streaming_min) {
+    3362:	          48 81 7d a8 ff 00 00 	cmpq   $0xff,-0x58(%rbp)
+    3369:	          00 
+    336a:	      /-- 77 1c                	ja     3388 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        set_pattern(d, p, n);
+    336c:	      |   48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    3370:	      |   48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+    3374:	      |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3378:	      |   48 89 ce             	mov    %rcx,%rsi
+    337b:	      |   48 89 c7             	mov    %rax,%rdi
+    337e:	      |   e8 29 fd ff ff       	call   30ac <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>
+    3383:	/-----|-- e9 89 01 00 00       	jmp    3511 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c3>
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    3388:	|     \-> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    338c:	|         48 f7 d8             	neg    %rax
+    338f:	|         83 e0 0f             	and    $0xf,%eax
+    3392:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    for (Index i = 0; i < head; ++i) {
+    3396:	|         48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    339d:	|         00 
+    339e:	|     /-- eb 20                	jmp    33c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x72>
+        d[i] = p[i];
+    33a0:	|  /--|-> 48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    33a4:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33a8:	|  |  |   48 01 d0             	add    %rdx,%rax
+    33ab:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    33af:	|  |  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    33b3:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    33b6:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    33b9:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < head; ++i) {
+    33bb:	|  |  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    33c0:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33c4:	|  |      48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    33c8:	|  \----- 72 d6                	jb     33a0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x52>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    33ca:	|         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    33d1:	|         00 
+    33d2:	|     /-- eb 2d                	jmp    3401 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xb3>
+        rotated[i] = p[(head + i) % 16];
+    33d4:	|  /--|-> 48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    33d8:	|  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    33dc:	|  |  |   48 01 d0             	add    %rdx,%rax
+    33df:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    33e2:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    33e5:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    33e9:	|  |  |   48 01 d0             	add    %rdx,%rax
+    33ec:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    33ef:	|  |  |   48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    33f3:	|  |  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    33f7:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    33fa:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < 16; ++i) {
+    33fc:	|  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    3401:	|  |  \-> 48 83 7d f0 0f       	cmpq   $0xf,-0x10(%rbp)
+    3406:	|  \----- 76 cc                	jbe    33d4 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x86>
+    }
+    Line16 const v = load16(rotated);
+    3408:	|         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    340c:	|         48 89 c7             	mov    %rax,%rdi
+    340f:	|         e8 25 fd ff ff       	call   3139 <nel::elem::load16(unsigned char const*)>
+    3414:	|         0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+    Index i = head;
+    3418:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    341c:	|         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    3420:	|     /-- eb 79                	jmp    349b <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        stream16(d + i, v);
+    3422:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    3426:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    342a:	|  |  |   48 01 c2             	add    %rax,%rdx
+    342d:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3431:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3434:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3437:	|  |  |   e8 1f fd ff ff       	call   315b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, v);
+    343c:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3440:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    3444:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3448:	|  |  |   48 01 c2             	add    %rax,%rdx
+    344b:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    344f:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3452:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3455:	|  |  |   e8 01 fd ff ff       	call   315b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, v);
+    345a:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    345e:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    3462:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3466:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3469:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    346d:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3470:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3473:	|  |  |   e8 e3 fc ff ff       	call   315b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, v);
+    3478:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    347c:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    3480:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3484:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3487:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    348b:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    348e:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3491:	|  |  |   e8 c5 fc ff ff       	call   315b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    3496:	|  |  |   48 83 45 e8 40       	addq   $0x40,-0x18(%rbp)
+    349b:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    349f:	|  |      48 83 c0 40          	add    $0x40,%rax
+    34a3:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    34a7:	|  \----- 0f 83 75 ff ff ff    	jae    3422 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd4>
+    }
+    for (; i + 16 <= n; i += 16) {
+    34ad:	|     /-- eb 1f                	jmp    34ce <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x180>
+        stream16(d + i, v);
+    34af:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    34b3:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34b7:	|  |  |   48 01 c2             	add    %rax,%rdx
+    34ba:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    34be:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    34c1:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    34c4:	|  |  |   e8 92 fc ff ff       	call   315b <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    34c9:	|  |  |   48 83 45 e8 10       	addq   $0x10,-0x18(%rbp)
+    34ce:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34d2:	|  |      48 83 c0 10          	add    $0x10,%rax
+    34d6:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    34da:	|  \----- 73 d3                	jae    34af <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    __builtin_ia32_sfence();
+    34dc:	|         0f ae f8             	sfence
+    for (; i < n; ++i) {
+    34df:	|     /-- eb 26                	jmp    3507 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1b9>
+        d[i] = p[i % 16];
+    34e1:	|  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34e5:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    34e8:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    34eb:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    34ef:	|  |  |   48 01 d0             	add    %rdx,%rax
+    34f2:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    34f6:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    34fa:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    34fd:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    3500:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (; i < n; ++i) {
+    3502:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    3507:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    350b:	|  |      48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    350f:	|  \----- 72 d0                	jb     34e1 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x193>
+    }
+}
+    3511:	\-------> c9                   	leave
+    3512:	          c3                   	ret
+
+0000000000003513 <nel::offset_of(unsigned char*, unsigned long)>:
+// The payload is the first align boundary leaving room for a Length in front,
+// which holds the offset from the start of the underlying allocation.
+// Malloc alignment is at least alignof(Length), so the payload is at most
+// align bytes in.
+static Length offset_of(uint8_t *const base, Length const align)
+{
+    3513:	55                   	push   %rbp
+    3514:	48 89 e5             	mov    %rsp,%rbp
+    3517:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    351b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    USize const a = reinterpret_cast<USize>(base) + sizeof(Length);
+    351f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3523:	48 83 c0 08          	add    $0x8,%rax
+    3527:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    352b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    352f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3533:	48 01 d0             	add    %rdx,%rax
+    3536:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    353a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    353e:	48 f7 d8             	neg    %rax
+    3541:	48 21 c2             	and    %rax,%rdx
+    3544:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3548:	48 29 c2             	sub    %rax,%rdx
+    354b:	48 89 d0             	mov    %rdx,%rax
+}
+    354e:	5d                   	pop    %rbp
+    354f:	c3                   	ret
+
+0000000000003550 <nel::offset_field(unsigned char*)>:
+
+static Length &offset_field(uint8_t *const p)
+{
+    3550:	55                   	push   %rbp
+    3551:	48 89 e5             	mov    %rsp,%rbp
+    3554:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return reinterpret_cast<Length *>(p)[-1];
+    3558:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    355c:	48 83 e8 08          	sub    $0x8,%rax
+}
+    3560:	5d                   	pop    %rbp
+    3561:	c3                   	ret
+
+0000000000003562 <nel::free_aligned(void*)>:
+
+void free_aligned(void *const p)
+{
+    3562:	       55                   	push   %rbp
+    3563:	       48 89 e5             	mov    %rsp,%rbp
+    3566:	       48 83 ec 20          	sub    $0x20,%rsp
+    356a:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (p == nullptr) { return; }
+    356e:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3573:	/----- 74 2e                	je     35a3 <nel::free_aligned(void*)+0x41>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    3575:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3579:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    std::free(u8p - offset_field(u8p));
+    357d:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3581:	|      48 89 c7             	mov    %rax,%rdi
+    3584:	|      e8 c7 ff ff ff       	call   3550 <nel::offset_field(unsigned char*)>
+    3589:	|      48 8b 00             	mov    (%rax),%rax
+    358c:	|      48 f7 d8             	neg    %rax
+    358f:	|      48 89 c2             	mov    %rax,%rdx
+    3592:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3596:	|      48 01 d0             	add    %rdx,%rax
+    3599:	|      48 89 c7             	mov    %rax,%rdi
+    359c:	|      e8 8f da ff ff       	call   1030 <free@plt>
+    35a1:	|  /-- eb 01                	jmp    35a4 <nel::free_aligned(void*)+0x42>
+    if (p == nullptr) { return; }
+    35a3:	\--|-> 90                   	nop
+}
+    35a4:	   \-> c9                   	leave
+    35a5:	       c3                   	ret
+
+00000000000035a6 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    35a6:	             55                   	push   %rbp
+    35a7:	             48 89 e5             	mov    %rsp,%rbp
+    35aa:	             53                   	push   %rbx
+    35ab:	             48 83 ec 78          	sub    $0x78,%rsp
+    35af:	             48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    35b3:	             48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    35b7:	             48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    35bb:	             48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    35bf:	             48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    35c3:	             b9 f3 00 00 00       	mov    $0xf3,%ecx
+    35c8:	             48 8d 15 91 0b 00 00 	lea    0xb91(%rip),%rdx        # 4160 <nel::elem::streaming_min+0x8>
+    35cf:	             48 8d 35 9c 0b 00 00 	lea    0xb9c(%rip),%rsi        # 4172 <nel::elem::streaming_min+0x1a>
+    35d6:	             48 89 c7             	mov    %rax,%rdi
+    35d9:	             e8 22 eb ff ff       	call   2100 <nel::Context::Context(char const*, char const*, int)>
+    35de:	             48 83 7d 90 00       	cmpq   $0x0,-0x70(%rbp)
+    35e3:	      /----- 74 18                	je     35fd <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    35e5:	      |      48 8b 45 90          	mov    -0x70(%rbp),%rax
+    35e9:	      |      48 83 e8 01          	sub    $0x1,%rax
+    35ed:	      |      48 23 45 90          	and    -0x70(%rbp),%rax
+    35f1:	      |      48 85 c0             	test   %rax,%rax
+    35f4:	      +----- 75 07                	jne    35fd <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    35f6:	      |      b8 01 00 00 00       	mov    $0x1,%eax
+    35fb:	      |  /-- eb 05                	jmp    3602 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x5c>
+    35fd:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3602:	         \-> 0f b6 c0             	movzbl %al,%eax
+    3605:	             48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    3609:	             48 8d 0d 72 0b 00 00 	lea    0xb72(%rip),%rcx        # 4182 <nel::elem::streaming_min+0x2a>
+    3610:	             48 89 ce             	mov    %rcx,%rsi
+    3613:	             89 c7                	mov    %eax,%edi
+    3615:	             e8 5b 01 00 00       	call   3775 <nel::assert(bool, char const*, nel::Context const&)>
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    361a:	             48 8b 45 98          	mov    -0x68(%rbp),%rax
+    361e:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    3622:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3627:	      /----- 74 11                	je     363a <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x94>
+    3629:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    362d:	      |      48 89 c7             	mov    %rax,%rdi
+    3630:	      |      e8 1b ff ff ff       	call   3550 <nel::offset_field(unsigned char*)>
+    3635:	      |      48 8b 00             	mov    (%rax),%rax
+    3638:	      |  /-- eb 05                	jmp    363f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x99>
+    363a:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    363f:	         \-> 48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    3643:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3648:	      /----- 74 13                	je     365d <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb7>
+    364a:	      |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    364e:	      |      48 f7 d8             	neg    %rax
+    3651:	      |      48 89 c2             	mov    %rax,%rdx
+    3654:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3658:	      |      48 01 d0             	add    %rdx,%rax
+    365b:	      |  /-- eb 05                	jmp    3662 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xbc>
+    365d:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3662:	         \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    3666:	             48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    366a:	             48 8b 45 90          	mov    -0x70(%rbp),%rax
+    366e:	             48 01 c2             	add    %rax,%rdx
+    3671:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3675:	             48 89 d6             	mov    %rdx,%rsi
+    3678:	             48 89 c7             	mov    %rax,%rdi
+    367b:	             e8 30 da ff ff       	call   10b0 <realloc@plt>
+    3680:	             48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if (new_base == nullptr) { return nullptr; }
+    3684:	             48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    3689:	         /-- 75 0a                	jne    3695 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    368b:	         |   b8 00 00 00 00       	mov    $0x0,%eax
+    3690:	/--------|-- e9 85 00 00 00       	jmp    371a <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x174>
+
+    Length const new_offset = offset_of(new_base, align);
+    3695:	|        \-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3699:	|            48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    369d:	|            48 89 d6             	mov    %rdx,%rsi
+    36a0:	|            48 89 c7             	mov    %rax,%rdi
+    36a3:	|            e8 6b fe ff ff       	call   3513 <nel::offset_of(unsigned char*, unsigned long)>
+    36a8:	|            48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    uint8_t *const new_p = new_base + new_offset;
+    36ac:	|            48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    36b0:	|            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    36b4:	|            48 01 d0             	add    %rdx,%rax
+    36b7:	|            48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    if (old_p != nullptr && new_offset != old_offset) {
+    36bb:	|            48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    36c0:	|  /-------- 74 41                	je     3703 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+    36c2:	|  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    36c6:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    36ca:	|  +-------- 74 37                	je     3703 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+    36cc:	|  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    36d0:	|  |         48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    36d4:	|  |  /----- 73 06                	jae    36dc <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x136>
+    36d6:	|  |  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    36da:	|  |  |  /-- eb 04                	jmp    36e0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x13a>
+    36dc:	|  |  \--|-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    36e0:	|  |     \-> 48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        std::memmove(new_p, new_base + old_offset, n);
+    36e4:	|  |         48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    36e8:	|  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    36ec:	|  |         48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    36f0:	|  |         48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    36f4:	|  |         48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    36f8:	|  |         48 89 ce             	mov    %rcx,%rsi
+    36fb:	|  |         48 89 c7             	mov    %rax,%rdi
+    36fe:	|  |         e8 bd d9 ff ff       	call   10c0 <memmove@plt>
+    }
+    offset_field(new_p) = new_offset;
+    3703:	|  \-------> 48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+    3707:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    370b:	|            48 89 c7             	mov    %rax,%rdi
+    370e:	|            e8 3d fe ff ff       	call   3550 <nel::offset_field(unsigned char*)>
+    3713:	|            48 89 18             	mov    %rbx,(%rax)
+    return new_p;
+    3716:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+}
+    371a:	\----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    371e:	             c9                   	leave
+    371f:	             c3                   	ret
+
+0000000000003720 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    3720:	55                   	push   %rbp
+    3721:	48 89 e5             	mov    %rsp,%rbp
+    3724:	48 83 ec 10          	sub    $0x10,%rsp
+    3728:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    372c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return realloc_aligned(nullptr, align, 0, size);
+    3730:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3734:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3738:	48 89 d1             	mov    %rdx,%rcx
+    373b:	ba 00 00 00 00       	mov    $0x0,%edx
+    3740:	48 89 c6             	mov    %rax,%rsi
+    3743:	bf 00 00 00 00       	mov    $0x0,%edi
+    3748:	e8 59 fe ff ff       	call   35a6 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+}
+    374d:	c9                   	leave
+    374e:	c3                   	ret
+
+000000000000374f <nel::elem::poison(unsigned char*, unsigned long)>:
+{
+    374f:	55                   	push   %rbp
+    3750:	48 89 e5             	mov    %rsp,%rbp
+    3753:	48 83 ec 10          	sub    $0x10,%rsp
+    3757:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    375b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    copy(d, s, n);
+    375f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3763:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3767:	48 89 d6             	mov    %rdx,%rsi
+    376a:	48 89 c7             	mov    %rax,%rdi
+    376d:	e8 ae f8 ff ff       	call   3020 <nel::elem::wipe(unsigned char*, unsigned long)>
+}
+    3772:	90                   	nop
+    3773:	c9                   	leave
+    3774:	c3                   	ret
+
+0000000000003775 <nel::assert(bool, char const*, nel::Context const&)>:
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx);
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    3775:	    55                   	push   %rbp
+    3776:	    48 89 e5             	mov    %rsp,%rbp
+    3779:	    48 83 ec 20          	sub    $0x20,%rsp
+    377d:	    89 f8                	mov    %edi,%eax
+    377f:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3783:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    3787:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { assert_fail(msg, ctx); }
+    378a:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    378e:	    83 f0 01             	xor    $0x1,%eax
+    3791:	    84 c0                	test   %al,%al
+    3793:	/-- 74 13                	je     37a8 <nel::assert(bool, char const*, nel::Context const&)+0x33>
+    3795:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3799:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    379d:	|   48 89 d6             	mov    %rdx,%rsi
+    37a0:	|   48 89 c7             	mov    %rax,%rdi
+    37a3:	|   e8 52 f7 ff ff       	call   2efa <nel::assert_fail(char const*, nel::Context const&)>
+}
+    37a8:	\-> 90                   	nop
+    37a9:	    c9                   	leave
+    37aa:	    c3                   	ret
+
+00000000000037ab <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    37ab:	55                   	push   %rbp
+    37ac:	48 89 e5             	mov    %rsp,%rbp
+    37af:	48 83 ec 10          	sub    $0x10,%rsp
+    37b3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    37b7:	89 f0                	mov    %esi,%eax
+    37b9:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    37bc:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    37c0:	48 8b 15 99 38 00 00 	mov    0x3899(%rip),%rdx        # 7060 <stderr@GLIBC_2.2.5>
+    37c7:	48 89 d6             	mov    %rdx,%rsi
+    37ca:	89 c7                	mov    %eax,%edi
+    37cc:	e8 9f d8 ff ff       	call   1070 <fputc@plt>
+    return outs;
+    37d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    37d5:	c9                   	leave
+    37d6:	c3                   	ret
+
+00000000000037d7 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    37d7:	55                   	push   %rbp
+    37d8:	48 89 e5             	mov    %rsp,%rbp
+    37db:	48 83 ec 10          	sub    $0x10,%rsp
+    37df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    37e3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    37e7:	48 8b 15 72 38 00 00 	mov    0x3872(%rip),%rdx        # 7060 <stderr@GLIBC_2.2.5>
+    37ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    37f2:	48 89 d6             	mov    %rdx,%rsi
+    37f5:	48 89 c7             	mov    %rax,%rdi
+    37f8:	e8 53 d8 ff ff       	call   1050 <fputs@plt>
+    return outs;
+    37fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3801:	c9                   	leave
+    3802:	c3                   	ret
+
+0000000000003803 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    3803:	55                   	push   %rbp
+    3804:	48 89 e5             	mov    %rsp,%rbp
+    3807:	48 83 ec 10          	sub    $0x10,%rsp
+    380b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    380f:	89 f0                	mov    %esi,%eax
+    3811:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    3814:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    3818:	48 8b 05 41 38 00 00 	mov    0x3841(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    381f:	48 8d 0d 77 09 00 00 	lea    0x977(%rip),%rcx        # 419d <nel::elem::streaming_min+0x45>
+    3826:	48 89 ce             	mov    %rcx,%rsi
+    3829:	48 89 c7             	mov    %rax,%rdi
+    382c:	b8 00 00 00 00       	mov    $0x0,%eax
+    3831:	e8 5a d8 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    3836:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    383a:	c9                   	leave
+    383b:	c3                   	ret
+
+000000000000383c <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    383c:	55                   	push   %rbp
+    383d:	48 89 e5             	mov    %rsp,%rbp
+    3840:	48 83 ec 10          	sub    $0x10,%rsp
+    3844:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3848:	89 f0                	mov    %esi,%eax
+    384a:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    384e:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    3852:	48 8b 05 07 38 00 00 	mov    0x3807(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    3859:	48 8d 0d 3d 09 00 00 	lea    0x93d(%rip),%rcx        # 419d <nel::elem::streaming_min+0x45>
+    3860:	48 89 ce             	mov    %rcx,%rsi
+    3863:	48 89 c7             	mov    %rax,%rdi
+    3866:	b8 00 00 00 00       	mov    $0x0,%eax
+    386b:	e8 20 d8 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    3870:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3874:	c9                   	leave
+    3875:	c3                   	ret
+
+0000000000003876 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    3876:	55                   	push   %rbp
+    3877:	48 89 e5             	mov    %rsp,%rbp
+    387a:	48 83 ec 10          	sub    $0x10,%rsp
+    387e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3882:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    3885:	48 8b 05 d4 37 00 00 	mov    0x37d4(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    388c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    388f:	48 8d 0d 07 09 00 00 	lea    0x907(%rip),%rcx        # 419d <nel::elem::streaming_min+0x45>
+    3896:	48 89 ce             	mov    %rcx,%rsi
+    3899:	48 89 c7             	mov    %rax,%rdi
+    389c:	b8 00 00 00 00       	mov    $0x0,%eax
+    38a1:	e8 ea d7 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    38a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    38aa:	c9                   	leave
+    38ab:	c3                   	ret
+
+00000000000038ac <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    38ac:	55                   	push   %rbp
+    38ad:	48 89 e5             	mov    %rsp,%rbp
+    38b0:	48 83 ec 10          	sub    $0x10,%rsp
+    38b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    38b8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    38bb:	48 8b 05 9e 37 00 00 	mov    0x379e(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    38c2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    38c5:	48 8d 0d d1 08 00 00 	lea    0x8d1(%rip),%rcx        # 419d <nel::elem::streaming_min+0x45>
+    38cc:	48 89 ce             	mov    %rcx,%rsi
+    38cf:	48 89 c7             	mov    %rax,%rdi
+    38d2:	b8 00 00 00 00       	mov    $0x0,%eax
+    38d7:	e8 b4 d7 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    38dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    38e0:	c9                   	leave
+    38e1:	c3                   	ret
+
+00000000000038e2 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    38e2:	55                   	push   %rbp
+    38e3:	48 89 e5             	mov    %rsp,%rbp
+    38e6:	48 83 ec 10          	sub    $0x10,%rsp
+    38ea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    38ee:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    38f2:	48 8b 05 67 37 00 00 	mov    0x3767(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    38f9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    38fd:	48 8d 0d 9c 08 00 00 	lea    0x89c(%rip),%rcx        # 41a0 <nel::elem::streaming_min+0x48>
+    3904:	48 89 ce             	mov    %rcx,%rsi
+    3907:	48 89 c7             	mov    %rax,%rdi
+    390a:	b8 00 00 00 00       	mov    $0x0,%eax
+    390f:	e8 7c d7 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    3914:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3918:	c9                   	leave
+    3919:	c3                   	ret
+
+Disassembly of section .fini:
+
+000000000000391c <_fini>:
+    391c:	48 83 ec 08          	sub    $0x8,%rsp
+    3920:	48 83 c4 08          	add    $0x8,%rsp
+    3924:	c3                   	ret
@@ -0,0 +1,4278 @@
+
+target/debug/examples/largestruct1_heapless_queue:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 5f 00 00 	mov    0x5fc5(%rip),%rax        # 6fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 5f 00 00    	push   0x5fca(%rip)        # 6ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 5f 00 00    	jmp    *0x5fcc(%rip)        # 6ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 5f 00 00    	jmp    *0x5fca(%rip)        # 7000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 5f 00 00    	jmp    *0x5fc2(%rip)        # 7008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 5f 00 00    	jmp    *0x5fba(%rip)        # 7010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memset@plt>:
+    1060:	ff 25 b2 5f 00 00    	jmp    *0x5fb2(%rip)        # 7018 <memset@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 5f 00 00    	jmp    *0x5faa(%rip)        # 7020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 5f 00 00    	jmp    *0x5fa2(%rip)        # 7028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 5f 00 00    	jmp    *0x5f9a(%rip)        # 7030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcpy@plt>:
+    10a0:	ff 25 92 5f 00 00    	jmp    *0x5f92(%rip)        # 7038 <memcpy@GLIBC_2.14>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <realloc@plt>:
+    10b0:	ff 25 8a 5f 00 00    	jmp    *0x5f8a(%rip)        # 7040 <realloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <memmove@plt>:
+    10c0:	ff 25 82 5f 00 00    	jmp    *0x5f82(%rip)        # 7048 <memmove@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010d0 <__cxa_finalize@plt>:
+    10d0:	ff 25 0a 5f 00 00    	jmp    *0x5f0a(%rip)        # 6fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10d6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010e0 <_start>:
+    10e0:	31 ed                	xor    %ebp,%ebp
+    10e2:	49 89 d1             	mov    %rdx,%r9
+    10e5:	5e                   	pop    %rsi
+    10e6:	48 89 e2             	mov    %rsp,%rdx
+    10e9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    10ed:	50                   	push   %rax
+    10ee:	54                   	push   %rsp
+    10ef:	45 31 c0             	xor    %r8d,%r8d
+    10f2:	31 c9                	xor    %ecx,%ecx
+    10f4:	48 8d 3d e1 03 00 00 	lea    0x3e1(%rip),%rdi        # 14dc <main>
+    10fb:	ff 15 bf 5e 00 00    	call   *0x5ebf(%rip)        # 6fc0 <__libc_start_main@GLIBC_2.34>
+    1101:	f4                   	hlt
+    1102:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1109:	00 00 00 
+    110c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001110 <deregister_tm_clones>:
+    1110:	    48 8d 3d 49 5f 00 00 	lea    0x5f49(%rip),%rdi        # 7060 <stderr@GLIBC_2.2.5>
+    1117:	    48 8d 05 42 5f 00 00 	lea    0x5f42(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    111e:	    48 39 f8             	cmp    %rdi,%rax
+    1121:	/-- 74 15                	je     1138 <deregister_tm_clones+0x28>
+    1123:	|   48 8b 05 9e 5e 00 00 	mov    0x5e9e(%rip),%rax        # 6fc8 <_ITM_deregisterTMCloneTable@Base>
+    112a:	|   48 85 c0             	test   %rax,%rax
+    112d:	+-- 74 09                	je     1138 <deregister_tm_clones+0x28>
+    112f:	|   ff e0                	jmp    *%rax
+    1131:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1138:	\-> c3                   	ret
+    1139:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001140 <register_tm_clones>:
+    1140:	    48 8d 3d 19 5f 00 00 	lea    0x5f19(%rip),%rdi        # 7060 <stderr@GLIBC_2.2.5>
+    1147:	    48 8d 35 12 5f 00 00 	lea    0x5f12(%rip),%rsi        # 7060 <stderr@GLIBC_2.2.5>
+    114e:	    48 29 fe             	sub    %rdi,%rsi
+    1151:	    48 89 f0             	mov    %rsi,%rax
+    1154:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1158:	    48 c1 f8 03          	sar    $0x3,%rax
+    115c:	    48 01 c6             	add    %rax,%rsi
+    115f:	    48 d1 fe             	sar    %rsi
+    1162:	/-- 74 14                	je     1178 <register_tm_clones+0x38>
+    1164:	|   48 8b 05 6d 5e 00 00 	mov    0x5e6d(%rip),%rax        # 6fd8 <_ITM_registerTMCloneTable@Base>
+    116b:	|   48 85 c0             	test   %rax,%rax
+    116e:	+-- 74 08                	je     1178 <register_tm_clones+0x38>
+    1170:	|   ff e0                	jmp    *%rax
+    1172:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1178:	\-> c3                   	ret
+    1179:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001180 <__do_global_dtors_aux>:
+    1180:	       f3 0f 1e fa          	endbr64
+    1184:	       80 3d dd 5e 00 00 00 	cmpb   $0x0,0x5edd(%rip)        # 7068 <completed.0>
+    118b:	/----- 75 2b                	jne    11b8 <__do_global_dtors_aux+0x38>
+    118d:	|      55                   	push   %rbp
+    118e:	|      48 83 3d 4a 5e 00 00 	cmpq   $0x0,0x5e4a(%rip)        # 6fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1195:	|      00 
+    1196:	|      48 89 e5             	mov    %rsp,%rbp
+    1199:	|  /-- 74 0c                	je     11a7 <__do_global_dtors_aux+0x27>
+    119b:	|  |   48 8b 3d b6 5e 00 00 	mov    0x5eb6(%rip),%rdi        # 7058 <__dso_handle>
+    11a2:	|  |   e8 29 ff ff ff       	call   10d0 <__cxa_finalize@plt>
+    11a7:	|  \-> e8 64 ff ff ff       	call   1110 <deregister_tm_clones>
+    11ac:	|      c6 05 b5 5e 00 00 01 	movb   $0x1,0x5eb5(%rip)        # 7068 <completed.0>
+    11b3:	|      5d                   	pop    %rbp
+    11b4:	|      c3                   	ret
+    11b5:	|      0f 1f 00             	nopl   (%rax)
+    11b8:	\----> c3                   	ret
+    11b9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011c0 <frame_dummy>:
+    11c0:	f3 0f 1e fa          	endbr64
+    11c4:	e9 77 ff ff ff       	jmp    1140 <register_tm_clones>
+
+00000000000011c9 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    11c9:	55                   	push   %rbp
+    11ca:	48 89 e5             	mov    %rsp,%rbp
+    11cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11d1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    11d4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11d9:	5d                   	pop    %rbp
+    11da:	c3                   	ret
+
+00000000000011db <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    11db:	55                   	push   %rbp
+    11dc:	48 89 e5             	mov    %rsp,%rbp
+    11df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11e3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11e6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return -1;
+    11ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11ef:	5d                   	pop    %rbp
+    11f0:	c3                   	ret
+
+00000000000011f1 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    11f1:	55                   	push   %rbp
+    11f2:	48 89 e5             	mov    %rsp,%rbp
+    11f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11f9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11fc:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    return -1;
+    11ff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1204:	5d                   	pop    %rbp
+    1205:	c3                   	ret
+
+0000000000001206 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    1206:	55                   	push   %rbp
+    1207:	48 89 e5             	mov    %rsp,%rbp
+    120a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    120e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1211:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    1214:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    return -1;
+    1217:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    121c:	5d                   	pop    %rbp
+    121d:	c3                   	ret
+
+000000000000121e <_read_r>:
+int _read_r(struct _reent *, int) {
+    121e:	55                   	push   %rbp
+    121f:	48 89 e5             	mov    %rsp,%rbp
+    1222:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1226:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1229:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    122e:	5d                   	pop    %rbp
+    122f:	c3                   	ret
+
+0000000000001230 <_write_r>:
+int _write_r(struct _reent *, int, char *, int) {
+    1230:	55                   	push   %rbp
+    1231:	48 89 e5             	mov    %rsp,%rbp
+    1234:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1238:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    123b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    123f:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+    return -1;
+    1242:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1247:	5d                   	pop    %rbp
+    1248:	c3                   	ret
+
+0000000000001249 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    1249:	55                   	push   %rbp
+    124a:	48 89 e5             	mov    %rsp,%rbp
+    124d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return -1;
+    1251:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1256:	5d                   	pop    %rbp
+    1257:	c3                   	ret
+
+0000000000001258 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1258:	55                   	push   %rbp
+    1259:	48 89 e5             	mov    %rsp,%rbp
+    125c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1260:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1263:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1268:	5d                   	pop    %rbp
+    1269:	c3                   	ret
+
+000000000000126a <ex1()>:
+#include "libnosys_stubs.cx"
+
+typedef nel::heapless::Queue<U8Buf<256>, 5> Queue1;
+
+void ex1()
+{
+    126a:	55                   	push   %rbp
+    126b:	48 89 e5             	mov    %rsp,%rbp
+    126e:	48 81 ec 20 05 00 00 	sub    $0x520,%rsp
+    auto queue1 = Queue1::empty();
+    1275:	48 8d 95 e0 fa ff ff 	lea    -0x520(%rbp),%rdx
+    127c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1281:	b9 a3 00 00 00       	mov    $0xa3,%ecx
+    1286:	48 89 d7             	mov    %rdx,%rdi
+    1289:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    nel::log << queue1 << '\n';
+    128c:	48 8d 85 e0 fa ff ff 	lea    -0x520(%rbp),%rax
+    1293:	48 89 c6             	mov    %rax,%rsi
+    1296:	48 8d 05 cc 5d 00 00 	lea    0x5dcc(%rip),%rax        # 7069 <nel::log>
+    129d:	48 89 c7             	mov    %rax,%rdi
+    12a0:	e8 2a 04 00 00       	call   16cf <nel::heapless::operator<<(nel::Log&, nel::heapless::Queue<U8Buf<256ul>, 5ul> const&)>
+    12a5:	be 0a 00 00 00       	mov    $0xa,%esi
+    12aa:	48 89 c7             	mov    %rax,%rdi
+    12ad:	e8 04 25 00 00       	call   37b6 <nel::operator<<(nel::Log&, char)>
+}
+    12b2:	48 8d 85 e0 fa ff ff 	lea    -0x520(%rbp),%rax
+    12b9:	48 89 c7             	mov    %rax,%rdi
+    12bc:	e8 ab 03 00 00       	call   166c <nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()>
+    12c1:	c9                   	leave
+    12c2:	c3                   	ret
+
+00000000000012c3 <ex2()>:
+
+void ex2()
+{
+    12c3:	55                   	push   %rbp
+    12c4:	48 89 e5             	mov    %rsp,%rbp
+    12c7:	48 81 ec 50 07 00 00 	sub    $0x750,%rsp
+    auto queue1 = Queue1::empty();
+    12ce:	48 8d 95 b0 f9 ff ff 	lea    -0x650(%rbp),%rdx
+    12d5:	b8 00 00 00 00       	mov    $0x0,%eax
+    12da:	b9 a3 00 00 00       	mov    $0xa3,%ecx
+    12df:	48 89 d7             	mov    %rdx,%rdi
+    12e2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    U8Buf<256> v = U8Buf<256>((uint8_t)0x66);
+    12e5:	48 8d 85 b0 f8 ff ff 	lea    -0x750(%rbp),%rax
+    12ec:	be 66 00 00 00       	mov    $0x66,%esi
+    12f1:	48 89 c7             	mov    %rax,%rdi
+    12f4:	e8 47 03 00 00       	call   1640 <U8Buf<256ul>::U8Buf(unsigned char)>
+    queue1.push(nel::move(v)).is_ok();
+    12f9:	48 8d 85 b0 f8 ff ff 	lea    -0x750(%rbp),%rax
+    1300:	48 89 c7             	mov    %rax,%rdi
+    1303:	e8 a5 04 00 00       	call   17ad <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    1308:	48 89 c2             	mov    %rax,%rdx
+    130b:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    1312:	48 8d 8d b0 f9 ff ff 	lea    -0x650(%rbp),%rcx
+    1319:	48 89 ce             	mov    %rcx,%rsi
+    131c:	48 89 c7             	mov    %rax,%rdi
+    131f:	e8 98 04 00 00       	call   17bc <nel::heapless::Queue<U8Buf<256ul>, 5ul>::push(U8Buf<256ul>&&)>
+    1324:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1328:	b9 18 00 00 00       	mov    $0x18,%ecx
+    132d:	48 8d 15 f4 2c 00 00 	lea    0x2cf4(%rip),%rdx        # 4028 <nel::sort::ninther_n+0x8>
+    1334:	48 8d 35 15 2d 00 00 	lea    0x2d15(%rip),%rsi        # 4050 <nel::sort::ninther_n+0x30>
+    133b:	48 89 c7             	mov    %rax,%rdi
+    133e:	e8 a9 02 00 00       	call   15ec <nel::Context::Context(char const*, char const*, int)>
+    1343:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1347:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    134e:	48 89 d6             	mov    %rdx,%rsi
+    1351:	48 89 c7             	mov    %rax,%rdi
+    1354:	e8 55 06 00 00       	call   19ae <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    1359:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    1360:	48 89 c7             	mov    %rax,%rdi
+    1363:	e8 b0 05 00 00       	call   1918 <nel::Result<void, U8Buf<256ul> >::~Result()>
+
+    nel::log << queue1 << '\n';
+    1368:	48 8d 85 b0 f9 ff ff 	lea    -0x650(%rbp),%rax
+    136f:	48 89 c6             	mov    %rax,%rsi
+    1372:	48 8d 05 f0 5c 00 00 	lea    0x5cf0(%rip),%rax        # 7069 <nel::log>
+    1379:	48 89 c7             	mov    %rax,%rdi
+    137c:	e8 4e 03 00 00       	call   16cf <nel::heapless::operator<<(nel::Log&, nel::heapless::Queue<U8Buf<256ul>, 5ul> const&)>
+    1381:	be 0a 00 00 00       	mov    $0xa,%esi
+    1386:	48 89 c7             	mov    %rax,%rdi
+    1389:	e8 28 24 00 00       	call   37b6 <nel::operator<<(nel::Log&, char)>
+}
+    138e:	48 8d 85 b0 f8 ff ff 	lea    -0x750(%rbp),%rax
+    1395:	48 89 c7             	mov    %rax,%rdi
+    1398:	e8 eb 03 00 00       	call   1788 <U8Buf<256ul>::~U8Buf()>
+    139d:	48 8d 85 b0 f9 ff ff 	lea    -0x650(%rbp),%rax
+    13a4:	48 89 c7             	mov    %rax,%rdi
+    13a7:	e8 c0 02 00 00       	call   166c <nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()>
+    13ac:	c9                   	leave
+    13ad:	c3                   	ret
+
+00000000000013ae <ex3()>:
+
+void ex3()
+{
+    13ae:	55                   	push   %rbp
+    13af:	48 89 e5             	mov    %rsp,%rbp
+    13b2:	48 81 ec 60 08 00 00 	sub    $0x860,%rsp
+    auto queue1 = Queue1::empty();
+    13b9:	48 8d 95 b0 f8 ff ff 	lea    -0x750(%rbp),%rdx
+    13c0:	b8 00 00 00 00       	mov    $0x0,%eax
+    13c5:	b9 a3 00 00 00       	mov    $0xa3,%ecx
+    13ca:	48 89 d7             	mov    %rdx,%rdi
+    13cd:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    queue1.push((uint8_t)0x67).is_ok();
+    13d0:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    13d7:	be 67 00 00 00       	mov    $0x67,%esi
+    13dc:	48 89 c7             	mov    %rax,%rdi
+    13df:	e8 5c 02 00 00       	call   1640 <U8Buf<256ul>::U8Buf(unsigned char)>
+    13e4:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+    13eb:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+    13f2:	48 8d 8d b0 f8 ff ff 	lea    -0x750(%rbp),%rcx
+    13f9:	48 89 ce             	mov    %rcx,%rsi
+    13fc:	48 89 c7             	mov    %rax,%rdi
+    13ff:	e8 b8 03 00 00       	call   17bc <nel::heapless::Queue<U8Buf<256ul>, 5ul>::push(U8Buf<256ul>&&)>
+    1404:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1408:	b9 21 00 00 00       	mov    $0x21,%ecx
+    140d:	48 8d 15 14 2c 00 00 	lea    0x2c14(%rip),%rdx        # 4028 <nel::sort::ninther_n+0x8>
+    1414:	48 8d 35 39 2c 00 00 	lea    0x2c39(%rip),%rsi        # 4054 <nel::sort::ninther_n+0x34>
+    141b:	48 89 c7             	mov    %rax,%rdi
+    141e:	e8 c9 01 00 00       	call   15ec <nel::Context::Context(char const*, char const*, int)>
+    1423:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1427:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+    142e:	48 89 d6             	mov    %rdx,%rsi
+    1431:	48 89 c7             	mov    %rax,%rdi
+    1434:	e8 75 05 00 00       	call   19ae <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    1439:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+    1440:	48 89 c7             	mov    %rax,%rdi
+    1443:	e8 d0 04 00 00       	call   1918 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    1448:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    144f:	48 89 c7             	mov    %rax,%rdi
+    1452:	e8 31 03 00 00       	call   1788 <U8Buf<256ul>::~U8Buf()>
+
+    nel::log << queue1 << '\n';
+    1457:	48 8d 85 b0 f8 ff ff 	lea    -0x750(%rbp),%rax
+    145e:	48 89 c6             	mov    %rax,%rsi
+    1461:	48 8d 05 01 5c 00 00 	lea    0x5c01(%rip),%rax        # 7069 <nel::log>
+    1468:	48 89 c7             	mov    %rax,%rdi
+    146b:	e8 5f 02 00 00       	call   16cf <nel::heapless::operator<<(nel::Log&, nel::heapless::Queue<U8Buf<256ul>, 5ul> const&)>
+    1470:	be 0a 00 00 00       	mov    $0xa,%esi
+    1475:	48 89 c7             	mov    %rax,%rdi
+    1478:	e8 39 23 00 00       	call   37b6 <nel::operator<<(nel::Log&, char)>
+
+    auto e = queue1.pop();
+    147d:	48 8d 85 a0 f7 ff ff 	lea    -0x860(%rbp),%rax
+    1484:	48 8d 95 b0 f8 ff ff 	lea    -0x750(%rbp),%rdx
+    148b:	48 89 d6             	mov    %rdx,%rsi
+    148e:	48 89 c7             	mov    %rax,%rdi
+    1491:	e8 42 05 00 00       	call   19d8 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::pop()>
+    nel::log << e << '\n';
+    1496:	48 8d 85 a0 f7 ff ff 	lea    -0x860(%rbp),%rax
+    149d:	48 89 c6             	mov    %rax,%rsi
+    14a0:	48 8d 05 c2 5b 00 00 	lea    0x5bc2(%rip),%rax        # 7069 <nel::log>
+    14a7:	48 89 c7             	mov    %rax,%rdi
+    14aa:	e8 56 06 00 00       	call   1b05 <nel::operator<<(nel::Log&, nel::Optional<U8Buf<256ul> > const&)>
+    14af:	be 0a 00 00 00       	mov    $0xa,%esi
+    14b4:	48 89 c7             	mov    %rax,%rdi
+    14b7:	e8 fa 22 00 00       	call   37b6 <nel::operator<<(nel::Log&, char)>
+}
+    14bc:	48 8d 85 a0 f7 ff ff 	lea    -0x860(%rbp),%rax
+    14c3:	48 89 c7             	mov    %rax,%rdi
+    14c6:	e8 c5 05 00 00       	call   1a90 <nel::Optional<U8Buf<256ul> >::~Optional()>
+    14cb:	48 8d 85 b0 f8 ff ff 	lea    -0x750(%rbp),%rax
+    14d2:	48 89 c7             	mov    %rax,%rdi
+    14d5:	e8 92 01 00 00       	call   166c <nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()>
+    14da:	c9                   	leave
+    14db:	c3                   	ret
+
+00000000000014dc <main>:
+
+int main()
+{
+    14dc:	55                   	push   %rbp
+    14dd:	48 89 e5             	mov    %rsp,%rbp
+    nel::log << "ex1:b" << '\n';
+    14e0:	48 8d 05 71 2b 00 00 	lea    0x2b71(%rip),%rax        # 4058 <nel::sort::ninther_n+0x38>
+    14e7:	48 89 c6             	mov    %rax,%rsi
+    14ea:	48 8d 05 78 5b 00 00 	lea    0x5b78(%rip),%rax        # 7069 <nel::log>
+    14f1:	48 89 c7             	mov    %rax,%rdi
+    14f4:	e8 e9 22 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+    14f9:	be 0a 00 00 00       	mov    $0xa,%esi
+    14fe:	48 89 c7             	mov    %rax,%rdi
+    1501:	e8 b0 22 00 00       	call   37b6 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    1506:	e8 5f fd ff ff       	call   126a <ex1()>
+    nel::log << "ex1:e" << '\n';
+    150b:	48 8d 05 4c 2b 00 00 	lea    0x2b4c(%rip),%rax        # 405e <nel::sort::ninther_n+0x3e>
+    1512:	48 89 c6             	mov    %rax,%rsi
+    1515:	48 8d 05 4d 5b 00 00 	lea    0x5b4d(%rip),%rax        # 7069 <nel::log>
+    151c:	48 89 c7             	mov    %rax,%rdi
+    151f:	e8 be 22 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+    1524:	be 0a 00 00 00       	mov    $0xa,%esi
+    1529:	48 89 c7             	mov    %rax,%rdi
+    152c:	e8 85 22 00 00       	call   37b6 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex2:b" << '\n';
+    1531:	48 8d 05 2c 2b 00 00 	lea    0x2b2c(%rip),%rax        # 4064 <nel::sort::ninther_n+0x44>
+    1538:	48 89 c6             	mov    %rax,%rsi
+    153b:	48 8d 05 27 5b 00 00 	lea    0x5b27(%rip),%rax        # 7069 <nel::log>
+    1542:	48 89 c7             	mov    %rax,%rdi
+    1545:	e8 98 22 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+    154a:	be 0a 00 00 00       	mov    $0xa,%esi
+    154f:	48 89 c7             	mov    %rax,%rdi
+    1552:	e8 5f 22 00 00       	call   37b6 <nel::operator<<(nel::Log&, char)>
+    ex2();
+    1557:	e8 67 fd ff ff       	call   12c3 <ex2()>
+    nel::log << "ex2:e" << '\n';
+    155c:	48 8d 05 07 2b 00 00 	lea    0x2b07(%rip),%rax        # 406a <nel::sort::ninther_n+0x4a>
+    1563:	48 89 c6             	mov    %rax,%rsi
+    1566:	48 8d 05 fc 5a 00 00 	lea    0x5afc(%rip),%rax        # 7069 <nel::log>
+    156d:	48 89 c7             	mov    %rax,%rdi
+    1570:	e8 6d 22 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+    1575:	be 0a 00 00 00       	mov    $0xa,%esi
+    157a:	48 89 c7             	mov    %rax,%rdi
+    157d:	e8 34 22 00 00       	call   37b6 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex3:b" << '\n';
+    1582:	48 8d 05 e7 2a 00 00 	lea    0x2ae7(%rip),%rax        # 4070 <nel::sort::ninther_n+0x50>
+    1589:	48 89 c6             	mov    %rax,%rsi
+    158c:	48 8d 05 d6 5a 00 00 	lea    0x5ad6(%rip),%rax        # 7069 <nel::log>
+    1593:	48 89 c7             	mov    %rax,%rdi
+    1596:	e8 47 22 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+    159b:	be 0a 00 00 00       	mov    $0xa,%esi
+    15a0:	48 89 c7             	mov    %rax,%rdi
+    15a3:	e8 0e 22 00 00       	call   37b6 <nel::operator<<(nel::Log&, char)>
+    ex3();
+    15a8:	e8 01 fe ff ff       	call   13ae <ex3()>
+    nel::log << "ex3:e" << '\n';
+    15ad:	48 8d 05 c2 2a 00 00 	lea    0x2ac2(%rip),%rax        # 4076 <nel::sort::ninther_n+0x56>
+    15b4:	48 89 c6             	mov    %rax,%rsi
+    15b7:	48 8d 05 ab 5a 00 00 	lea    0x5aab(%rip),%rax        # 7069 <nel::log>
+    15be:	48 89 c7             	mov    %rax,%rdi
+    15c1:	e8 1c 22 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+    15c6:	be 0a 00 00 00       	mov    $0xa,%esi
+    15cb:	48 89 c7             	mov    %rax,%rdi
+    15ce:	e8 e3 21 00 00       	call   37b6 <nel::operator<<(nel::Log&, char)>
+}
+    15d3:	b8 00 00 00 00       	mov    $0x0,%eax
+    15d8:	5d                   	pop    %rbp
+    15d9:	c3                   	ret
+
+00000000000015da <operator new(unsigned long, void*)>:
+
+    15da:	55                   	push   %rbp
+    15db:	48 89 e5             	mov    %rsp,%rbp
+    15de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    15e2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+void ex1()
+    15e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+{
+    15ea:	5d                   	pop    %rbp
+    15eb:	c3                   	ret
+
+00000000000015ec <nel::Context::Context(char const*, char const*, int)>:
+        char const *fn_name_;
+        char const *file_name_;
+        int line_num_;
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+    15ec:	55                   	push   %rbp
+    15ed:	48 89 e5             	mov    %rsp,%rbp
+    15f0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    15f4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    15f8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    15fc:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    15ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1603:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1607:	48 89 10             	mov    %rdx,(%rax)
+            , file_name_(file_name)
+    160a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    160e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1612:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , line_num_(line_num)
+    1616:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    161a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    161d:	89 50 10             	mov    %edx,0x10(%rax)
+        {
+        }
+    1620:	90                   	nop
+    1621:	5d                   	pop    %rbp
+    1622:	c3                   	ret
+    1623:	90                   	nop
+
+0000000000001624 <nel::Manual<U8Buf<256ul> [5]>::~Manual()>:
+        } u_;
+
+    public:
+        // default must not delete..
+        // doesn't know if value contained or not.
+        constexpr ~Manual() = default;
+    1624:	55                   	push   %rbp
+    1625:	48 89 e5             	mov    %rsp,%rbp
+    1628:	48 83 ec 10          	sub    $0x10,%rsp
+    162c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1630:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1634:	48 89 c7             	mov    %rax,%rdi
+    1637:	e8 88 00 00 00       	call   16c4 <nel::Manual<U8Buf<256ul> [5]>::U::~U()>
+    163c:	90                   	nop
+    163d:	c9                   	leave
+    163e:	c3                   	ret
+    163f:	90                   	nop
+
+0000000000001640 <U8Buf<256ul>::U8Buf(unsigned char)>:
+            nel::elem::move(data_, o.data_, N);
+            return *this;
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+    1640:	55                   	push   %rbp
+    1641:	48 89 e5             	mov    %rsp,%rbp
+    1644:	48 83 ec 10          	sub    $0x10,%rsp
+    1648:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    164c:	89 f0                	mov    %esi,%eax
+    164e:	88 45 f4             	mov    %al,-0xc(%rbp)
+        {
+            nel::elem::set(data_, f, N);
+    1651:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    1655:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1659:	ba 00 01 00 00       	mov    $0x100,%edx
+    165e:	89 ce                	mov    %ecx,%esi
+    1660:	48 89 c7             	mov    %rax,%rdi
+    1663:	e8 26 19 00 00       	call   2f8e <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    1668:	90                   	nop
+    1669:	c9                   	leave
+    166a:	c3                   	ret
+    166b:	90                   	nop
+
+000000000000166c <nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()>:
+        {
+            return &ptr()[d];
+        }
+
+    public:
+        constexpr ~Queue(void)
+    166c:	55                   	push   %rbp
+    166d:	48 89 e5             	mov    %rsp,%rbp
+    1670:	48 83 ec 60          	sub    $0x60,%rsp
+    1674:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+        {
+            // newest first, reverse of construction.
+            iter().rev().for_each([&](auto &v) -> void { v.~Type(); });
+    1678:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    167c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    1680:	48 89 d6             	mov    %rdx,%rsi
+    1683:	48 89 c7             	mov    %rax,%rdi
+    1686:	e8 af 05 00 00       	call   1c3a <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter()>
+    168b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    168f:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    1693:	48 89 d6             	mov    %rdx,%rsi
+    1696:	48 89 c7             	mov    %rax,%rdi
+    1699:	e8 04 08 00 00       	call   1ea2 <nel::Iterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >, U8Buf<256ul>&, U8Buf<256ul>&>::rev()>
+    169e:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    16a2:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    16a6:	48 89 d6             	mov    %rdx,%rsi
+    16a9:	48 89 c7             	mov    %rax,%rdi
+    16ac:	e8 2d 08 00 00       	call   1ede <void nel::Iterator<nel::RevIterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()::{lambda(auto:1&)#1}>(nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()::{lambda(auto:1&)#1}&&)>
+        }
+    16b1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    16b5:	48 83 c0 18          	add    $0x18,%rax
+    16b9:	48 89 c7             	mov    %rax,%rdi
+    16bc:	e8 63 ff ff ff       	call   1624 <nel::Manual<U8Buf<256ul> [5]>::~Manual()>
+    16c1:	90                   	nop
+    16c2:	c9                   	leave
+    16c3:	c3                   	ret
+
+00000000000016c4 <nel::Manual<U8Buf<256ul> [5]>::U::~U()>:
+                constexpr ~U() {};
+    16c4:	55                   	push   %rbp
+    16c5:	48 89 e5             	mov    %rsp,%rbp
+    16c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    16cc:	90                   	nop
+    16cd:	5d                   	pop    %rbp
+    16ce:	c3                   	ret
+
+00000000000016cf <nel::heapless::operator<<(nel::Log&, nel::heapless::Queue<U8Buf<256ul>, 5ul> const&)>:
+         * @param outs the stream to dump the representation into.
+         */
+        // TODO: replace <<(Log ) with dbgfmt, so separate out from
+        // any other form of conversion to charstring.
+        // TODO: insert into formatter and not final dest type.
+        friend Log &operator<<(Log &outs, Queue const &v)
+    16cf:	55                   	push   %rbp
+    16d0:	48 89 e5             	mov    %rsp,%rbp
+    16d3:	53                   	push   %rbx
+    16d4:	48 83 ec 38          	sub    $0x38,%rsp
+    16d8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    16dc:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+        {
+            outs << "Queue<" << N << ">(" << v.len() << "){";
+    16e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    16e4:	48 8d 15 91 29 00 00 	lea    0x2991(%rip),%rdx        # 407c <nel::sort::ninther_n+0x5c>
+    16eb:	48 89 d6             	mov    %rdx,%rsi
+    16ee:	48 89 c7             	mov    %rax,%rdi
+    16f1:	e8 ec 20 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+    16f6:	be 05 00 00 00       	mov    $0x5,%esi
+    16fb:	48 89 c7             	mov    %rax,%rdi
+    16fe:	e8 ea 21 00 00       	call   38ed <nel::operator<<(nel::Log&, unsigned long)>
+    1703:	48 89 c2             	mov    %rax,%rdx
+    1706:	48 8d 05 76 29 00 00 	lea    0x2976(%rip),%rax        # 4083 <nel::sort::ninther_n+0x63>
+    170d:	48 89 c6             	mov    %rax,%rsi
+    1710:	48 89 d7             	mov    %rdx,%rdi
+    1713:	e8 ca 20 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+    1718:	48 89 c3             	mov    %rax,%rbx
+    171b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    171f:	48 89 c7             	mov    %rax,%rdi
+    1722:	e8 23 08 00 00       	call   1f4a <nel::heapless::Queue<U8Buf<256ul>, 5ul>::len() const>
+    1727:	48 89 c6             	mov    %rax,%rsi
+    172a:	48 89 df             	mov    %rbx,%rdi
+    172d:	e8 bb 21 00 00       	call   38ed <nel::operator<<(nel::Log&, unsigned long)>
+    1732:	48 89 c2             	mov    %rax,%rdx
+    1735:	48 8d 05 4a 29 00 00 	lea    0x294a(%rip),%rax        # 4086 <nel::sort::ninther_n+0x66>
+    173c:	48 89 c6             	mov    %rax,%rsi
+    173f:	48 89 d7             	mov    %rdx,%rdi
+    1742:	e8 9b 20 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+            outs << v.iter();
+    1747:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    174b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    174f:	48 89 d6             	mov    %rdx,%rsi
+    1752:	48 89 c7             	mov    %rax,%rdi
+    1755:	e8 02 08 00 00       	call   1f5c <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter() const>
+    175a:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    175e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1762:	48 89 d6             	mov    %rdx,%rsi
+    1765:	48 89 c7             	mov    %rax,%rdi
+    1768:	e8 ee 0a 00 00       	call   225b <nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)>
+            outs << '}';
+    176d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1771:	be 7d 00 00 00       	mov    $0x7d,%esi
+    1776:	48 89 c7             	mov    %rax,%rdi
+    1779:	e8 38 20 00 00       	call   37b6 <nel::operator<<(nel::Log&, char)>
+            return outs;
+    177e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+        }
+    1782:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1786:	c9                   	leave
+    1787:	c3                   	ret
+
+0000000000001788 <U8Buf<256ul>::~U8Buf()>:
+        constexpr ~U8Buf(void)
+    1788:	55                   	push   %rbp
+    1789:	48 89 e5             	mov    %rsp,%rbp
+    178c:	48 83 ec 10          	sub    $0x10,%rsp
+    1790:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            nel::elem::set(data_, 0xa5, N);
+    1794:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1798:	ba 00 01 00 00       	mov    $0x100,%edx
+    179d:	be a5 00 00 00       	mov    $0xa5,%esi
+    17a2:	48 89 c7             	mov    %rax,%rdi
+    17a5:	e8 e4 17 00 00       	call   2f8e <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    17aa:	90                   	nop
+    17ab:	c9                   	leave
+    17ac:	c3                   	ret
+
+00000000000017ad <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel is to not need std.
+ */
+template<typename T>
+constexpr T &&move(T &v)
+    17ad:	55                   	push   %rbp
+    17ae:	48 89 e5             	mov    %rsp,%rbp
+    17b1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<T &&>(v);
+    17b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    17b9:	5d                   	pop    %rbp
+    17ba:	c3                   	ret
+    17bb:	90                   	nop
+
+00000000000017bc <nel::heapless::Queue<U8Buf<256ul>, 5ul>::push(U8Buf<256ul>&&)>:
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+    17bc:	       55                   	push   %rbp
+    17bd:	       48 89 e5             	mov    %rsp,%rbp
+    17c0:	       53                   	push   %rbx
+    17c1:	       48 83 ec 28          	sub    $0x28,%rsp
+    17c5:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    17c9:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    17cd:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            if (is_full()) {
+    17d1:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    17d5:	       48 89 c7             	mov    %rax,%rdi
+    17d8:	       e8 31 0b 00 00       	call   230e <nel::heapless::Queue<U8Buf<256ul>, 5ul>::is_full() const>
+    17dd:	       84 c0                	test   %al,%al
+    17df:	/----- 74 74                	je     1855 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::push(U8Buf<256ul>&&)+0x99>
+                rp_ += 1;
+    17e1:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    17e5:	|      48 8b 40 10          	mov    0x10(%rax),%rax
+    17e9:	|      48 8d 50 01          	lea    0x1(%rax),%rdx
+    17ed:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    17f1:	|      48 89 50 10          	mov    %rdx,0x10(%rax)
+                if (rp_ >= capacity()) { rp_ = 0; }
+    17f5:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    17f9:	|      48 8b 58 10          	mov    0x10(%rax),%rbx
+    17fd:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1801:	|      48 89 c7             	mov    %rax,%rdi
+    1804:	|      e8 1d 0b 00 00       	call   2326 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::capacity() const>
+    1809:	|      48 39 c3             	cmp    %rax,%rbx
+    180c:	|      0f 93 c0             	setae  %al
+    180f:	|      84 c0                	test   %al,%al
+    1811:	|  /-- 74 0c                	je     181f <nel::heapless::Queue<U8Buf<256ul>, 5ul>::push(U8Buf<256ul>&&)+0x63>
+    1813:	|  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1817:	|  |   48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+    181e:	|  |   00 
+                *ptr(wp_) = move(val);
+    181f:	|  \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1823:	|      48 89 c7             	mov    %rax,%rdi
+    1826:	|      e8 82 ff ff ff       	call   17ad <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    182b:	|      48 89 c3             	mov    %rax,%rbx
+    182e:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1832:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    1836:	|      48 89 c2             	mov    %rax,%rdx
+    1839:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    183d:	|      48 89 d6             	mov    %rdx,%rsi
+    1840:	|      48 89 c7             	mov    %rax,%rdi
+    1843:	|      e8 ee 0a 00 00       	call   2336 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr(long)>
+    1848:	|      48 89 de             	mov    %rbx,%rsi
+    184b:	|      48 89 c7             	mov    %rax,%rdi
+    184e:	|      e8 0d 0b 00 00       	call   2360 <U8Buf<256ul>::operator=(U8Buf<256ul>&&)>
+    1853:	|  /-- eb 53                	jmp    18a8 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::push(U8Buf<256ul>&&)+0xec>
+                len_ += 1;
+    1855:	\--|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1859:	   |   48 8b 00             	mov    (%rax),%rax
+    185c:	   |   48 8d 50 01          	lea    0x1(%rax),%rdx
+    1860:	   |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1864:	   |   48 89 10             	mov    %rdx,(%rax)
+                new (ptr(wp_)) Type(move(val));
+    1867:	   |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    186b:	   |   48 8b 40 08          	mov    0x8(%rax),%rax
+    186f:	   |   48 89 c2             	mov    %rax,%rdx
+    1872:	   |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1876:	   |   48 89 d6             	mov    %rdx,%rsi
+    1879:	   |   48 89 c7             	mov    %rax,%rdi
+    187c:	   |   e8 b5 0a 00 00       	call   2336 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr(long)>
+    1881:	   |   48 89 c6             	mov    %rax,%rsi
+    1884:	   |   bf 00 01 00 00       	mov    $0x100,%edi
+    1889:	   |   e8 4c fd ff ff       	call   15da <operator new(unsigned long, void*)>
+    188e:	   |   48 89 c3             	mov    %rax,%rbx
+    1891:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1895:	   |   48 89 c7             	mov    %rax,%rdi
+    1898:	   |   e8 10 ff ff ff       	call   17ad <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    189d:	   |   48 89 c6             	mov    %rax,%rsi
+    18a0:	   |   48 89 df             	mov    %rbx,%rdi
+    18a3:	   |   e8 e6 0a 00 00       	call   238e <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>
+            wp_ += 1;
+    18a8:	   \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    18ac:	       48 8b 40 08          	mov    0x8(%rax),%rax
+    18b0:	       48 8d 50 01          	lea    0x1(%rax),%rdx
+    18b4:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    18b8:	       48 89 50 08          	mov    %rdx,0x8(%rax)
+            if (wp_ >= capacity()) { wp_ = 0; }
+    18bc:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    18c0:	       48 8b 58 08          	mov    0x8(%rax),%rbx
+    18c4:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    18c8:	       48 89 c7             	mov    %rax,%rdi
+    18cb:	       e8 56 0a 00 00       	call   2326 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::capacity() const>
+    18d0:	       48 39 c3             	cmp    %rax,%rbx
+    18d3:	       0f 93 c0             	setae  %al
+    18d6:	       84 c0                	test   %al,%al
+    18d8:	   /-- 74 0c                	je     18e6 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::push(U8Buf<256ul>&&)+0x12a>
+    18da:	   |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    18de:	   |   48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    18e5:	   |   00 
+            return Result<void, Type>::Ok();
+    18e6:	   \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18ea:	       48 89 c7             	mov    %rax,%rdi
+    18ed:	       e8 c7 0a 00 00       	call   23b9 <nel::Result<void, U8Buf<256ul> >::Ok()>
+        }
+    18f2:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18f6:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    18fa:	       c9                   	leave
+    18fb:	       c3                   	ret
+
+00000000000018fc <nel::Element<U8Buf<256ul> >::~Element()>:
+
+    private:
+        Type value_;
+
+    public:
+        constexpr ~Element(void) = default;
+    18fc:	55                   	push   %rbp
+    18fd:	48 89 e5             	mov    %rsp,%rbp
+    1900:	48 83 ec 10          	sub    $0x10,%rsp
+    1904:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1908:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    190c:	48 89 c7             	mov    %rax,%rdi
+    190f:	e8 74 fe ff ff       	call   1788 <U8Buf<256ul>::~U8Buf()>
+    1914:	90                   	nop
+    1915:	c9                   	leave
+    1916:	c3                   	ret
+    1917:	90                   	nop
+
+0000000000001918 <nel::Result<void, U8Buf<256ul> >::~Result()>:
+        union {
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    1918:	             55                   	push   %rbp
+    1919:	             48 89 e5             	mov    %rsp,%rbp
+    191c:	             48 83 ec 30          	sub    $0x30,%rsp
+    1920:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result<void>-dtor
+    1924:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1928:	             8b 00                	mov    (%rax),%eax
+    192a:	             83 f8 02             	cmp    $0x2,%eax
+    192d:	         /-- 74 10                	je     193f <nel::Result<void, U8Buf<256ul> >::~Result()+0x27>
+    192f:	         |   83 f8 02             	cmp    $0x2,%eax
+    1932:	      /--|-- 7f 1d                	jg     1951 <nel::Result<void, U8Buf<256ul> >::~Result()+0x39>
+    1934:	      |  |   85 c0                	test   %eax,%eax
+    1936:	/-----|--|-- 74 4e                	je     1986 <nel::Result<void, U8Buf<256ul> >::~Result()+0x6e>
+    1938:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    193b:	|     +--|-- 75 14                	jne    1951 <nel::Result<void, U8Buf<256ul> >::~Result()+0x39>
+                case Tag::OK:
+                    break;
+    193d:	|  /--|--|-- eb 48                	jmp    1987 <nel::Result<void, U8Buf<256ul> >::~Result()+0x6f>
+
+                case Tag::ERR:
+                    err_.~Element<E>();
+    193f:	|  |  |  \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1943:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    1947:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    194a:	|  |  |      e8 ad ff ff ff       	call   18fc <nel::Element<U8Buf<256ul> >::~Element()>
+                    break;
+    194f:	|  +--|----- eb 36                	jmp    1987 <nel::Result<void, U8Buf<256ul> >::~Result()+0x6f>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    1951:	|  |  \----> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1955:	|  |         b9 dd 02 00 00       	mov    $0x2dd,%ecx
+    195a:	|  |         48 8d 15 28 27 00 00 	lea    0x2728(%rip),%rdx        # 4089 <nel::sort::ninther_n+0x69>
+    1961:	|  |         48 8d 35 33 27 00 00 	lea    0x2733(%rip),%rsi        # 409b <nel::sort::ninther_n+0x7b>
+    1968:	|  |         48 89 c7             	mov    %rax,%rdi
+    196b:	|  |         e8 7c fc ff ff       	call   15ec <nel::Context::Context(char const*, char const*, int)>
+    1970:	|  |         48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1974:	|  |         48 89 c6             	mov    %rax,%rsi
+    1977:	|  |         48 8d 05 25 27 00 00 	lea    0x2725(%rip),%rax        # 40a3 <nel::sort::ninther_n+0x83>
+    197e:	|  |         48 89 c7             	mov    %rax,%rdi
+    1981:	|  |         e8 24 15 00 00       	call   2eaa <nel::panic(char const*, nel::Context const&)>
+                    break;
+    1986:	\--|-------> 90                   	nop
+                    break;
+            }
+        }
+    1987:	   \-------> 90                   	nop
+    1988:	             c9                   	leave
+    1989:	             c3                   	ret
+
+000000000000198a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}::operator()() const>:
+         *
+         * `this` is not consumed by this op.
+         */
+        constexpr bool is_ok(Context const &ctx = Context()) const
+        {
+            return match<bool>([](void) -> bool { return true; },
+    198a:	55                   	push   %rbp
+    198b:	48 89 e5             	mov    %rsp,%rbp
+    198e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1992:	b8 01 00 00 00       	mov    $0x1,%eax
+    1997:	5d                   	pop    %rbp
+    1998:	c3                   	ret
+    1999:	90                   	nop
+
+000000000000199a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}::operator()(U8Buf<256ul> const&) const>:
+                               [](E const &) -> bool { return false; },
+    199a:	55                   	push   %rbp
+    199b:	48 89 e5             	mov    %rsp,%rbp
+    199e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    19a2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    19a6:	b8 00 00 00 00       	mov    $0x0,%eax
+    19ab:	5d                   	pop    %rbp
+    19ac:	c3                   	ret
+    19ad:	90                   	nop
+
+00000000000019ae <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>:
+        constexpr bool is_ok(Context const &ctx = Context()) const
+    19ae:	55                   	push   %rbp
+    19af:	48 89 e5             	mov    %rsp,%rbp
+    19b2:	48 83 ec 20          	sub    $0x20,%rsp
+    19b6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    19ba:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](void) -> bool { return true; },
+    19be:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    19c2:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    19c6:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    19ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19ce:	48 89 c7             	mov    %rax,%rdi
+    19d1:	e8 02 0a 00 00       	call   23d8 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const>
+                               ctx);
+        }
+    19d6:	c9                   	leave
+    19d7:	c3                   	ret
+
+00000000000019d8 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::pop()>:
+        Optional<Type> pop(void)
+    19d8:	       55                   	push   %rbp
+    19d9:	       48 89 e5             	mov    %rsp,%rbp
+    19dc:	       48 83 ec 20          	sub    $0x20,%rsp
+    19e0:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    19e4:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            if (is_empty()) { return None; }
+    19e8:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    19ec:	       48 89 c7             	mov    %rax,%rdi
+    19ef:	       e8 76 0a 00 00       	call   246a <nel::heapless::Queue<U8Buf<256ul>, 5ul>::is_empty() const>
+    19f4:	       84 c0                	test   %al,%al
+    19f6:	   /-- 74 18                	je     1a10 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::pop()+0x38>
+    19f8:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19fc:	   |   48 8d 15 06 26 00 00 	lea    0x2606(%rip),%rdx        # 4009 <nel::None>
+    1a03:	   |   48 89 d6             	mov    %rdx,%rsi
+    1a06:	   |   48 89 c7             	mov    %rax,%rdi
+    1a09:	   |   e8 74 0a 00 00       	call   2482 <nel::Optional<U8Buf<256ul> >::Optional(nel::NoneT const&)>
+    1a0e:	/--|-- eb 79                	jmp    1a89 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::pop()+0xb1>
+            len_ -= 1;
+    1a10:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a14:	|      48 8b 00             	mov    (%rax),%rax
+    1a17:	|      48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    1a1b:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a1f:	|      48 89 10             	mov    %rdx,(%rax)
+            auto rp = rp_;
+    1a22:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a26:	|      48 8b 40 10          	mov    0x10(%rax),%rax
+    1a2a:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            rp_ += 1;
+    1a2e:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a32:	|      48 8b 40 10          	mov    0x10(%rax),%rax
+    1a36:	|      48 8d 50 01          	lea    0x1(%rax),%rdx
+    1a3a:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a3e:	|      48 89 50 10          	mov    %rdx,0x10(%rax)
+            if (rp_ == N) { rp_ = 0; }
+    1a42:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a46:	|      48 8b 40 10          	mov    0x10(%rax),%rax
+    1a4a:	|      48 83 f8 05          	cmp    $0x5,%rax
+    1a4e:	|  /-- 75 0c                	jne    1a5c <nel::heapless::Queue<U8Buf<256ul>, 5ul>::pop()+0x84>
+    1a50:	|  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a54:	|  |   48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+    1a5b:	|  |   00 
+            return Some(move(*ptr(rp)));
+    1a5c:	|  \-> 48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1a60:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a64:	|      48 89 d6             	mov    %rdx,%rsi
+    1a67:	|      48 89 c7             	mov    %rax,%rdi
+    1a6a:	|      e8 c7 08 00 00       	call   2336 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr(long)>
+    1a6f:	|      48 89 c7             	mov    %rax,%rdi
+    1a72:	|      e8 36 fd ff ff       	call   17ad <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    1a77:	|      48 89 c2             	mov    %rax,%rdx
+    1a7a:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a7e:	|      48 89 d6             	mov    %rdx,%rsi
+    1a81:	|      48 89 c7             	mov    %rax,%rdi
+    1a84:	|      e8 12 0a 00 00       	call   249b <nel::Optional<U8Buf<256ul> > nel::Some<U8Buf<256ul> >(U8Buf<256ul>&&)>
+        }
+    1a89:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a8d:	       c9                   	leave
+    1a8e:	       c3                   	ret
+    1a8f:	       90                   	nop
+
+0000000000001a90 <nel::Optional<U8Buf<256ul> >::~Optional()>:
+        union {
+                Element<T> some_;
+        };
+
+    public:
+        constexpr ~Optional(void)
+    1a90:	             55                   	push   %rbp
+    1a91:	             48 89 e5             	mov    %rsp,%rbp
+    1a94:	             48 83 ec 30          	sub    $0x30,%rsp
+    1a98:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // optional::dtor
+    1a9c:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1aa0:	             8b 00                	mov    (%rax),%eax
+    1aa2:	             83 f8 02             	cmp    $0x2,%eax
+    1aa5:	         /-- 74 10                	je     1ab7 <nel::Optional<U8Buf<256ul> >::~Optional()+0x27>
+    1aa7:	         |   83 f8 02             	cmp    $0x2,%eax
+    1aaa:	      /--|-- 7f 1d                	jg     1ac9 <nel::Optional<U8Buf<256ul> >::~Optional()+0x39>
+    1aac:	      |  |   85 c0                	test   %eax,%eax
+    1aae:	/-----|--|-- 74 4e                	je     1afe <nel::Optional<U8Buf<256ul> >::~Optional()+0x6e>
+    1ab0:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    1ab3:	|  /--|--|-- 74 4c                	je     1b01 <nel::Optional<U8Buf<256ul> >::~Optional()+0x71>
+    1ab5:	|  |  +--|-- eb 12                	jmp    1ac9 <nel::Optional<U8Buf<256ul> >::~Optional()+0x39>
+                case Tag::SOME:
+                    some_.~Element<T>();
+    1ab7:	|  |  |  \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1abb:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    1abf:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1ac2:	|  |  |      e8 35 fe ff ff       	call   18fc <nel::Element<U8Buf<256ul> >::~Element()>
+                    break;
+    1ac7:	|  |  |  /-- eb 39                	jmp    1b02 <nel::Optional<U8Buf<256ul> >::~Optional()+0x72>
+                    // yes, since it may have contained one or the others..
+                    // if memory hardware is assumed to be incorruptable then can ignore ? (buffer
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob.
+                    nel::panic("bad Optional");
+    1ac9:	|  |  \--|-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1acd:	|  |     |   b9 87 00 00 00       	mov    $0x87,%ecx
+    1ad2:	|  |     |   48 8d 15 d5 25 00 00 	lea    0x25d5(%rip),%rdx        # 40ae <nel::sort::ninther_n+0x8e>
+    1ad9:	|  |     |   48 8d 35 e2 25 00 00 	lea    0x25e2(%rip),%rsi        # 40c2 <nel::sort::ninther_n+0xa2>
+    1ae0:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    1ae3:	|  |     |   e8 04 fb ff ff       	call   15ec <nel::Context::Context(char const*, char const*, int)>
+    1ae8:	|  |     |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1aec:	|  |     |   48 89 c6             	mov    %rax,%rsi
+    1aef:	|  |     |   48 8d 05 d6 25 00 00 	lea    0x25d6(%rip),%rax        # 40cc <nel::sort::ninther_n+0xac>
+    1af6:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    1af9:	|  |     |   e8 ac 13 00 00       	call   2eaa <nel::panic(char const*, nel::Context const&)>
+                    break;
+    1afe:	\--|-----|-> 90                   	nop
+    1aff:	   |     +-- eb 01                	jmp    1b02 <nel::Optional<U8Buf<256ul> >::~Optional()+0x72>
+                    break;
+    1b01:	   \-----|-> 90                   	nop
+                    break;
+            }
+        }
+    1b02:	         \-> 90                   	nop
+    1b03:	             c9                   	leave
+    1b04:	             c3                   	ret
+
+0000000000001b05 <nel::operator<<(nel::Log&, nel::Optional<U8Buf<256ul> > const&)>:
+                                     [&fn](void) -> Optional { return fn(); },
+                                     ctx);
+        }
+
+    public:
+        friend Log &operator<<(Log &outs, Optional const &val)
+    1b05:	             55                   	push   %rbp
+    1b06:	             48 89 e5             	mov    %rsp,%rbp
+    1b09:	             48 83 ec 10          	sub    $0x10,%rsp
+    1b0d:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1b11:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            switch (val.tag_) {
+    1b15:	             48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b19:	             8b 00                	mov    (%rax),%eax
+    1b1b:	             83 f8 02             	cmp    $0x2,%eax
+    1b1e:	         /-- 74 4e                	je     1b6e <nel::operator<<(nel::Log&, nel::Optional<U8Buf<256ul> > const&)+0x69>
+    1b20:	         |   83 f8 02             	cmp    $0x2,%eax
+    1b23:	/--------|-- 0f 8f df 00 00 00    	jg     1c08 <nel::operator<<(nel::Log&, nel::Optional<U8Buf<256ul> > const&)+0x103>
+    1b29:	|        |   85 c0                	test   %eax,%eax
+    1b2b:	|     /--|-- 0f 84 a6 00 00 00    	je     1bd7 <nel::operator<<(nel::Log&, nel::Optional<U8Buf<256ul> > const&)+0xd2>
+    1b31:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    1b34:	+-----|--|-- 0f 85 ce 00 00 00    	jne    1c08 <nel::operator<<(nel::Log&, nel::Optional<U8Buf<256ul> > const&)+0x103>
+                case Tag::NONE:
+                    outs << "Optional("
+                         << "None)";
+    1b3a:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b3e:	|     |  |   48 8d 15 94 25 00 00 	lea    0x2594(%rip),%rdx        # 40d9 <nel::sort::ninther_n+0xb9>
+    1b45:	|     |  |   48 89 d6             	mov    %rdx,%rsi
+    1b48:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    1b4b:	|     |  |   e8 92 1c 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+    1b50:	|     |  |   48 89 c2             	mov    %rax,%rdx
+    1b53:	|     |  |   48 8d 05 89 25 00 00 	lea    0x2589(%rip),%rax        # 40e3 <nel::sort::ninther_n+0xc3>
+    1b5a:	|     |  |   48 89 c6             	mov    %rax,%rsi
+    1b5d:	|     |  |   48 89 d7             	mov    %rdx,%rdi
+    1b60:	|     |  |   e8 7d 1c 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+                    return outs;
+    1b65:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b69:	|  /--|--|-- e9 c9 00 00 00       	jmp    1c37 <nel::operator<<(nel::Log&, nel::Optional<U8Buf<256ul> > const&)+0x132>
+                    break;
+                case Tag::SOME:
+                    outs << "Optional("
+                         << "Some(";
+    1b6e:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b72:	|  |  |      48 8d 15 60 25 00 00 	lea    0x2560(%rip),%rdx        # 40d9 <nel::sort::ninther_n+0xb9>
+    1b79:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    1b7c:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1b7f:	|  |  |      e8 5e 1c 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+    1b84:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    1b87:	|  |  |      48 8d 05 5b 25 00 00 	lea    0x255b(%rip),%rax        # 40e9 <nel::sort::ninther_n+0xc9>
+    1b8e:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    1b91:	|  |  |      48 89 d7             	mov    %rdx,%rdi
+    1b94:	|  |  |      e8 49 1c 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+                    outs << *val.some_;
+    1b99:	|  |  |      48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b9d:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    1ba1:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1ba4:	|  |  |      e8 27 09 00 00       	call   24d0 <nel::Element<U8Buf<256ul> >::operator*() const>
+    1ba9:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    1bac:	|  |  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bb0:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    1bb3:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1bb6:	|  |  |      e8 2f 09 00 00       	call   24ea <operator<<(nel::Log&, U8Buf<256ul> const&)>
+                    outs << "))";
+    1bbb:	|  |  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bbf:	|  |  |      48 8d 15 29 25 00 00 	lea    0x2529(%rip),%rdx        # 40ef <nel::sort::ninther_n+0xcf>
+    1bc6:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    1bc9:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1bcc:	|  |  |      e8 11 1c 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+                    return outs;
+    1bd1:	|  |  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bd5:	|  +--|----- eb 60                	jmp    1c37 <nel::operator<<(nel::Log&, nel::Optional<U8Buf<256ul> > const&)+0x132>
+                    break;
+                case Tag::INVAL:
+                    outs << "Optional("
+                         << "Inval)";
+    1bd7:	|  |  \----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bdb:	|  |         48 8d 15 f7 24 00 00 	lea    0x24f7(%rip),%rdx        # 40d9 <nel::sort::ninther_n+0xb9>
+    1be2:	|  |         48 89 d6             	mov    %rdx,%rsi
+    1be5:	|  |         48 89 c7             	mov    %rax,%rdi
+    1be8:	|  |         e8 f5 1b 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+    1bed:	|  |         48 89 c2             	mov    %rax,%rdx
+    1bf0:	|  |         48 8d 05 fb 24 00 00 	lea    0x24fb(%rip),%rax        # 40f2 <nel::sort::ninther_n+0xd2>
+    1bf7:	|  |         48 89 c6             	mov    %rax,%rsi
+    1bfa:	|  |         48 89 d7             	mov    %rdx,%rdi
+    1bfd:	|  |         e8 e0 1b 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+                    return outs;
+    1c02:	|  |         48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c06:	|  +-------- eb 2f                	jmp    1c37 <nel::operator<<(nel::Log&, nel::Optional<U8Buf<256ul> > const&)+0x132>
+                    break;
+                default:
+                    outs << "Optional("
+                         << "Unknown)";
+    1c08:	\--|-------> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c0c:	   |         48 8d 15 c6 24 00 00 	lea    0x24c6(%rip),%rdx        # 40d9 <nel::sort::ninther_n+0xb9>
+    1c13:	   |         48 89 d6             	mov    %rdx,%rsi
+    1c16:	   |         48 89 c7             	mov    %rax,%rdi
+    1c19:	   |         e8 c4 1b 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+    1c1e:	   |         48 89 c2             	mov    %rax,%rdx
+    1c21:	   |         48 8d 05 d1 24 00 00 	lea    0x24d1(%rip),%rax        # 40f9 <nel::sort::ninther_n+0xd9>
+    1c28:	   |         48 89 c6             	mov    %rax,%rsi
+    1c2b:	   |         48 89 d7             	mov    %rdx,%rdi
+    1c2e:	   |         e8 af 1b 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+            }
+            return outs;
+    1c33:	   |         48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1c37:	   \-------> c9                   	leave
+    1c38:	             c3                   	ret
+    1c39:	             90                   	nop
+
+0000000000001c3a <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter()>:
+        QueueIteratorMut iter(void)
+    1c3a:	       55                   	push   %rbp
+    1c3b:	       48 89 e5             	mov    %rsp,%rbp
+    1c3e:	       53                   	push   %rbx
+    1c3f:	       48 81 ec d8 00 00 00 	sub    $0xd8,%rsp
+    1c46:	       48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+    1c4d:	       48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+            if (len() == 0) {
+    1c54:	       48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    1c5b:	       48 89 c7             	mov    %rax,%rdi
+    1c5e:	       e8 e7 02 00 00       	call   1f4a <nel::heapless::Queue<U8Buf<256ul>, 5ul>::len() const>
+    1c63:	       48 85 c0             	test   %rax,%rax
+    1c66:	       0f 94 c0             	sete   %al
+    1c69:	       84 c0                	test   %al,%al
+    1c6b:	   /-- 74 6e                	je     1cdb <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter()+0xa1>
+                auto s1 = Slice<Type>::empty();
+    1c6d:	   |   48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+    1c74:	   |   00 
+    1c75:	   |   48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+    1c7c:	   |   00 
+                auto s2 = s1;
+    1c7d:	   |   48 8b 45 80          	mov    -0x80(%rbp),%rax
+    1c81:	   |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    1c85:	   |   48 89 85 70 ff ff ff 	mov    %rax,-0x90(%rbp)
+    1c8c:	   |   48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+                return QueueIteratorMut(s1.iter(), s2.iter());
+    1c93:	   |   48 8d 45 90          	lea    -0x70(%rbp),%rax
+    1c97:	   |   48 8d 95 70 ff ff ff 	lea    -0x90(%rbp),%rdx
+    1c9e:	   |   48 89 d6             	mov    %rdx,%rsi
+    1ca1:	   |   48 89 c7             	mov    %rax,%rdi
+    1ca4:	   |   e8 35 09 00 00       	call   25de <nel::Slice<U8Buf<256ul> >::iter() const>
+    1ca9:	   |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    1cad:	   |   48 8d 55 80          	lea    -0x80(%rbp),%rdx
+    1cb1:	   |   48 89 d6             	mov    %rdx,%rsi
+    1cb4:	   |   48 89 c7             	mov    %rax,%rdi
+    1cb7:	   |   e8 22 09 00 00       	call   25de <nel::Slice<U8Buf<256ul> >::iter() const>
+    1cbc:	   |   48 8d 55 90          	lea    -0x70(%rbp),%rdx
+    1cc0:	   |   48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+    1cc4:	   |   48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    1ccb:	   |   48 89 ce             	mov    %rcx,%rsi
+    1cce:	   |   48 89 c7             	mov    %rax,%rdi
+    1cd1:	   |   e8 54 09 00 00       	call   262a <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::ChainIterator(nel::SliceIterator<U8Buf<256ul> >&&, nel::SliceIterator<U8Buf<256ul> >&&)>
+        }
+    1cd6:	/--|-- e9 ba 01 00 00       	jmp    1e95 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter()+0x25b>
+            } else if (rp_ < wp_) {
+    1cdb:	|  \-> 48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    1ce2:	|      48 8b 50 10          	mov    0x10(%rax),%rdx
+    1ce6:	|      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    1ced:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    1cf1:	|      48 39 c2             	cmp    %rax,%rdx
+    1cf4:	|  /-- 0f 83 bc 00 00 00    	jae    1db6 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter()+0x17c>
+                auto s1 = Slice(ptr(rp_), ptr(wp_));
+    1cfa:	|  |   48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    1d01:	|  |   48 8b 40 08          	mov    0x8(%rax),%rax
+    1d05:	|  |   48 89 c2             	mov    %rax,%rdx
+    1d08:	|  |   48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    1d0f:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1d12:	|  |   48 89 c7             	mov    %rax,%rdi
+    1d15:	|  |   e8 1c 06 00 00       	call   2336 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr(long)>
+    1d1a:	|  |   48 89 c3             	mov    %rax,%rbx
+    1d1d:	|  |   48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    1d24:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    1d28:	|  |   48 89 c2             	mov    %rax,%rdx
+    1d2b:	|  |   48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    1d32:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1d35:	|  |   48 89 c7             	mov    %rax,%rdi
+    1d38:	|  |   e8 f9 05 00 00       	call   2336 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr(long)>
+    1d3d:	|  |   48 89 c1             	mov    %rax,%rcx
+    1d40:	|  |   48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+    1d47:	|  |   48 89 da             	mov    %rbx,%rdx
+    1d4a:	|  |   48 89 ce             	mov    %rcx,%rsi
+    1d4d:	|  |   48 89 c7             	mov    %rax,%rdi
+    1d50:	|  |   e8 2b 09 00 00       	call   2680 <nel::Slice<U8Buf<256ul> >::Slice(U8Buf<256ul>*, U8Buf<256ul>*)>
+                auto s2 = Slice<Type>::empty();
+    1d55:	|  |   48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+    1d5c:	|  |   00 00 00 00 
+    1d60:	|  |   48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+    1d67:	|  |   00 00 00 00 
+                return QueueIteratorMut(s1.iter(), s2.iter());
+    1d6b:	|  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    1d6f:	|  |   48 8d 95 50 ff ff ff 	lea    -0xb0(%rbp),%rdx
+    1d76:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1d79:	|  |   48 89 c7             	mov    %rax,%rdi
+    1d7c:	|  |   e8 5d 08 00 00       	call   25de <nel::Slice<U8Buf<256ul> >::iter() const>
+    1d81:	|  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1d85:	|  |   48 8d 95 60 ff ff ff 	lea    -0xa0(%rbp),%rdx
+    1d8c:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1d8f:	|  |   48 89 c7             	mov    %rax,%rdi
+    1d92:	|  |   e8 47 08 00 00       	call   25de <nel::Slice<U8Buf<256ul> >::iter() const>
+    1d97:	|  |   48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    1d9b:	|  |   48 8d 4d c0          	lea    -0x40(%rbp),%rcx
+    1d9f:	|  |   48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    1da6:	|  |   48 89 ce             	mov    %rcx,%rsi
+    1da9:	|  |   48 89 c7             	mov    %rax,%rdi
+    1dac:	|  |   e8 79 08 00 00       	call   262a <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::ChainIterator(nel::SliceIterator<U8Buf<256ul> >&&, nel::SliceIterator<U8Buf<256ul> >&&)>
+        }
+    1db1:	+--|-- e9 df 00 00 00       	jmp    1e95 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter()+0x25b>
+                auto s1 = Slice(ptr(rp_), ptr(N));
+    1db6:	|  \-> 48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    1dbd:	|      be 05 00 00 00       	mov    $0x5,%esi
+    1dc2:	|      48 89 c7             	mov    %rax,%rdi
+    1dc5:	|      e8 6c 05 00 00       	call   2336 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr(long)>
+    1dca:	|      48 89 c3             	mov    %rax,%rbx
+    1dcd:	|      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    1dd4:	|      48 8b 40 10          	mov    0x10(%rax),%rax
+    1dd8:	|      48 89 c2             	mov    %rax,%rdx
+    1ddb:	|      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    1de2:	|      48 89 d6             	mov    %rdx,%rsi
+    1de5:	|      48 89 c7             	mov    %rax,%rdi
+    1de8:	|      e8 49 05 00 00       	call   2336 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr(long)>
+    1ded:	|      48 89 c1             	mov    %rax,%rcx
+    1df0:	|      48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+    1df7:	|      48 89 da             	mov    %rbx,%rdx
+    1dfa:	|      48 89 ce             	mov    %rcx,%rsi
+    1dfd:	|      48 89 c7             	mov    %rax,%rdi
+    1e00:	|      e8 7b 08 00 00       	call   2680 <nel::Slice<U8Buf<256ul> >::Slice(U8Buf<256ul>*, U8Buf<256ul>*)>
+                auto s2 = Slice(ptr(), ptr(wp_));
+    1e05:	|      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    1e0c:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    1e10:	|      48 89 c2             	mov    %rax,%rdx
+    1e13:	|      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    1e1a:	|      48 89 d6             	mov    %rdx,%rsi
+    1e1d:	|      48 89 c7             	mov    %rax,%rdi
+    1e20:	|      e8 11 05 00 00       	call   2336 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr(long)>
+    1e25:	|      48 89 c3             	mov    %rax,%rbx
+    1e28:	|      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    1e2f:	|      48 89 c7             	mov    %rax,%rdi
+    1e32:	|      e8 7f 08 00 00       	call   26b6 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr()>
+    1e37:	|      48 89 c1             	mov    %rax,%rcx
+    1e3a:	|      48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    1e41:	|      48 89 da             	mov    %rbx,%rdx
+    1e44:	|      48 89 ce             	mov    %rcx,%rsi
+    1e47:	|      48 89 c7             	mov    %rax,%rdi
+    1e4a:	|      e8 31 08 00 00       	call   2680 <nel::Slice<U8Buf<256ul> >::Slice(U8Buf<256ul>*, U8Buf<256ul>*)>
+                return QueueIteratorMut(s1.iter(), s2.iter());
+    1e4f:	|      48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1e53:	|      48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+    1e5a:	|      48 89 d6             	mov    %rdx,%rsi
+    1e5d:	|      48 89 c7             	mov    %rax,%rdi
+    1e60:	|      e8 79 07 00 00       	call   25de <nel::Slice<U8Buf<256ul> >::iter() const>
+    1e65:	|      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1e69:	|      48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+    1e70:	|      48 89 d6             	mov    %rdx,%rsi
+    1e73:	|      48 89 c7             	mov    %rax,%rdi
+    1e76:	|      e8 63 07 00 00       	call   25de <nel::Slice<U8Buf<256ul> >::iter() const>
+    1e7b:	|      48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    1e7f:	|      48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+    1e83:	|      48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    1e8a:	|      48 89 ce             	mov    %rcx,%rsi
+    1e8d:	|      48 89 c7             	mov    %rax,%rdi
+    1e90:	|      e8 95 07 00 00       	call   262a <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::ChainIterator(nel::SliceIterator<U8Buf<256ul> >&&, nel::SliceIterator<U8Buf<256ul> >&&)>
+        }
+    1e95:	\----> 48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    1e9c:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1ea0:	       c9                   	leave
+    1ea1:	       c3                   	ret
+
+0000000000001ea2 <nel::Iterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >, U8Buf<256ul>&, U8Buf<256ul>&>::rev()>:
+        {
+            return EnumerateIterator<ItT>(move(self()));
+        }
+
+        // The items in reverse order, for double-ended iterators only.
+        constexpr RevIterator<ItT> rev(void)
+    1ea2:	55                   	push   %rbp
+    1ea3:	48 89 e5             	mov    %rsp,%rbp
+    1ea6:	48 83 ec 10          	sub    $0x10,%rsp
+    1eaa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1eae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            return RevIterator<ItT>(move(self()));
+    1eb2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1eb6:	48 89 c7             	mov    %rax,%rdi
+    1eb9:	e8 16 08 00 00       	call   26d4 <nel::Iterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    1ebe:	48 89 c7             	mov    %rax,%rdi
+    1ec1:	e8 24 08 00 00       	call   26ea <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >&& nel::move<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >(nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >&)>
+    1ec6:	48 89 c2             	mov    %rax,%rdx
+    1ec9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ecd:	48 89 d6             	mov    %rdx,%rsi
+    1ed0:	48 89 c7             	mov    %rax,%rdi
+    1ed3:	e8 62 08 00 00       	call   273a <nel::RevIterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >::RevIterator(nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >&&)>
+        }
+    1ed8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1edc:	c9                   	leave
+    1edd:	c3                   	ret
+
+0000000000001ede <void nel::Iterator<nel::RevIterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()::{lambda(auto:1&)#1}>(nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()::{lambda(auto:1&)#1}&&)>:
+        void for_each(F &&fn)
+    1ede:	       55                   	push   %rbp
+    1edf:	       48 89 e5             	mov    %rsp,%rbp
+    1ee2:	       48 83 ec 10          	sub    $0x10,%rsp
+    1ee6:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1eea:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            for (; !self().is_done(); self().inc()) {
+    1eee:	   /-- eb 3a                	jmp    1f2a <void nel::Iterator<nel::RevIterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()::{lambda(auto:1&)#1}>(nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()::{lambda(auto:1&)#1}&&)+0x4c>
+                fn(self().deref());
+    1ef0:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ef4:	|  |   48 89 c7             	mov    %rax,%rdi
+    1ef7:	|  |   e8 72 08 00 00       	call   276e <nel::Iterator<nel::RevIterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    1efc:	|  |   48 89 c7             	mov    %rax,%rdi
+    1eff:	|  |   e8 b6 08 00 00       	call   27ba <nel::RevIterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >::deref()>
+    1f04:	|  |   48 89 c2             	mov    %rax,%rdx
+    1f07:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f0b:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1f0e:	|  |   48 89 c7             	mov    %rax,%rdi
+    1f11:	|  |   e8 be 08 00 00       	call   27d4 <void nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()::{lambda(auto:1&)#1}::operator()<U8Buf<256ul> >(U8Buf<256ul>&) const>
+            for (; !self().is_done(); self().inc()) {
+    1f16:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f1a:	|  |   48 89 c7             	mov    %rax,%rdi
+    1f1d:	|  |   e8 4c 08 00 00       	call   276e <nel::Iterator<nel::RevIterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    1f22:	|  |   48 89 c7             	mov    %rax,%rdi
+    1f25:	|  |   e8 74 08 00 00       	call   279e <nel::RevIterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >::inc()>
+    1f2a:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f2e:	|      48 89 c7             	mov    %rax,%rdi
+    1f31:	|      e8 38 08 00 00       	call   276e <nel::Iterator<nel::RevIterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    1f36:	|      48 89 c7             	mov    %rax,%rdi
+    1f39:	|      e8 46 08 00 00       	call   2784 <nel::RevIterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >::is_done() const>
+    1f3e:	|      83 f0 01             	xor    $0x1,%eax
+    1f41:	|      84 c0                	test   %al,%al
+    1f43:	\----- 75 ab                	jne    1ef0 <void nel::Iterator<nel::RevIterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()::{lambda(auto:1&)#1}>(nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()::{lambda(auto:1&)#1}&&)+0x12>
+        }
+    1f45:	       90                   	nop
+    1f46:	       90                   	nop
+    1f47:	       c9                   	leave
+    1f48:	       c3                   	ret
+    1f49:	       90                   	nop
+
+0000000000001f4a <nel::heapless::Queue<U8Buf<256ul>, 5ul>::len() const>:
+        constexpr Length len(void) const
+    1f4a:	55                   	push   %rbp
+    1f4b:	48 89 e5             	mov    %rsp,%rbp
+    1f4e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    1f52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f56:	48 8b 00             	mov    (%rax),%rax
+        }
+    1f59:	5d                   	pop    %rbp
+    1f5a:	c3                   	ret
+    1f5b:	90                   	nop
+
+0000000000001f5c <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter() const>:
+        QueueIterator iter(void) const
+    1f5c:	       55                   	push   %rbp
+    1f5d:	       48 89 e5             	mov    %rsp,%rbp
+    1f60:	       53                   	push   %rbx
+    1f61:	       48 81 ec d8 00 00 00 	sub    $0xd8,%rsp
+    1f68:	       48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+    1f6f:	       48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+            if (len() == 0) {
+    1f76:	       48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    1f7d:	       48 89 c7             	mov    %rax,%rdi
+    1f80:	       e8 c5 ff ff ff       	call   1f4a <nel::heapless::Queue<U8Buf<256ul>, 5ul>::len() const>
+    1f85:	       48 85 c0             	test   %rax,%rax
+    1f88:	       0f 94 c0             	sete   %al
+    1f8b:	       84 c0                	test   %al,%al
+    1f8d:	   /-- 74 6e                	je     1ffd <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter() const+0xa1>
+                auto s1 = Slice<Type const>::empty();
+    1f8f:	   |   48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+    1f96:	   |   00 
+    1f97:	   |   48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+    1f9e:	   |   00 
+                auto s2 = s1;
+    1f9f:	   |   48 8b 45 80          	mov    -0x80(%rbp),%rax
+    1fa3:	   |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    1fa7:	   |   48 89 85 70 ff ff ff 	mov    %rax,-0x90(%rbp)
+    1fae:	   |   48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+                return QueueIterator(s1.iter(), s2.iter());
+    1fb5:	   |   48 8d 45 90          	lea    -0x70(%rbp),%rax
+    1fb9:	   |   48 8d 95 70 ff ff ff 	lea    -0x90(%rbp),%rdx
+    1fc0:	   |   48 89 d6             	mov    %rdx,%rsi
+    1fc3:	   |   48 89 c7             	mov    %rax,%rdi
+    1fc6:	   |   e8 29 08 00 00       	call   27f4 <nel::Slice<U8Buf<256ul> const>::iter() const>
+    1fcb:	   |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    1fcf:	   |   48 8d 55 80          	lea    -0x80(%rbp),%rdx
+    1fd3:	   |   48 89 d6             	mov    %rdx,%rsi
+    1fd6:	   |   48 89 c7             	mov    %rax,%rdi
+    1fd9:	   |   e8 16 08 00 00       	call   27f4 <nel::Slice<U8Buf<256ul> const>::iter() const>
+    1fde:	   |   48 8d 55 90          	lea    -0x70(%rbp),%rdx
+    1fe2:	   |   48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+    1fe6:	   |   48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    1fed:	   |   48 89 ce             	mov    %rcx,%rsi
+    1ff0:	   |   48 89 c7             	mov    %rax,%rdi
+    1ff3:	   |   e8 48 08 00 00       	call   2840 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::ChainIterator(nel::SliceIterator<U8Buf<256ul> const>&&, nel::SliceIterator<U8Buf<256ul> const>&&)>
+        }
+    1ff8:	/--|-- e9 ba 01 00 00       	jmp    21b7 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter() const+0x25b>
+            } else if (rp_ < wp_) {
+    1ffd:	|  \-> 48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    2004:	|      48 8b 50 10          	mov    0x10(%rax),%rdx
+    2008:	|      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    200f:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    2013:	|      48 39 c2             	cmp    %rax,%rdx
+    2016:	|  /-- 0f 83 bc 00 00 00    	jae    20d8 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter() const+0x17c>
+                auto s1 = Slice(ptr(rp_), ptr(wp_));
+    201c:	|  |   48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    2023:	|  |   48 8b 40 08          	mov    0x8(%rax),%rax
+    2027:	|  |   48 89 c2             	mov    %rax,%rdx
+    202a:	|  |   48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    2031:	|  |   48 89 d6             	mov    %rdx,%rsi
+    2034:	|  |   48 89 c7             	mov    %rax,%rdi
+    2037:	|  |   e8 5a 08 00 00       	call   2896 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr(long) const>
+    203c:	|  |   48 89 c3             	mov    %rax,%rbx
+    203f:	|  |   48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    2046:	|  |   48 8b 40 10          	mov    0x10(%rax),%rax
+    204a:	|  |   48 89 c2             	mov    %rax,%rdx
+    204d:	|  |   48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    2054:	|  |   48 89 d6             	mov    %rdx,%rsi
+    2057:	|  |   48 89 c7             	mov    %rax,%rdi
+    205a:	|  |   e8 37 08 00 00       	call   2896 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr(long) const>
+    205f:	|  |   48 89 c1             	mov    %rax,%rcx
+    2062:	|  |   48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+    2069:	|  |   48 89 da             	mov    %rbx,%rdx
+    206c:	|  |   48 89 ce             	mov    %rcx,%rsi
+    206f:	|  |   48 89 c7             	mov    %rax,%rdi
+    2072:	|  |   e8 49 08 00 00       	call   28c0 <nel::Slice<U8Buf<256ul> const>::Slice(U8Buf<256ul> const*, U8Buf<256ul> const*)>
+                auto s2 = Slice<Type const>::empty();
+    2077:	|  |   48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+    207e:	|  |   00 00 00 00 
+    2082:	|  |   48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+    2089:	|  |   00 00 00 00 
+                return QueueIterator(s1.iter(), s2.iter());
+    208d:	|  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    2091:	|  |   48 8d 95 50 ff ff ff 	lea    -0xb0(%rbp),%rdx
+    2098:	|  |   48 89 d6             	mov    %rdx,%rsi
+    209b:	|  |   48 89 c7             	mov    %rax,%rdi
+    209e:	|  |   e8 51 07 00 00       	call   27f4 <nel::Slice<U8Buf<256ul> const>::iter() const>
+    20a3:	|  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    20a7:	|  |   48 8d 95 60 ff ff ff 	lea    -0xa0(%rbp),%rdx
+    20ae:	|  |   48 89 d6             	mov    %rdx,%rsi
+    20b1:	|  |   48 89 c7             	mov    %rax,%rdi
+    20b4:	|  |   e8 3b 07 00 00       	call   27f4 <nel::Slice<U8Buf<256ul> const>::iter() const>
+    20b9:	|  |   48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    20bd:	|  |   48 8d 4d c0          	lea    -0x40(%rbp),%rcx
+    20c1:	|  |   48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    20c8:	|  |   48 89 ce             	mov    %rcx,%rsi
+    20cb:	|  |   48 89 c7             	mov    %rax,%rdi
+    20ce:	|  |   e8 6d 07 00 00       	call   2840 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::ChainIterator(nel::SliceIterator<U8Buf<256ul> const>&&, nel::SliceIterator<U8Buf<256ul> const>&&)>
+        }
+    20d3:	+--|-- e9 df 00 00 00       	jmp    21b7 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter() const+0x25b>
+                auto s1 = Slice(ptr(rp_), ptr(N));
+    20d8:	|  \-> 48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    20df:	|      be 05 00 00 00       	mov    $0x5,%esi
+    20e4:	|      48 89 c7             	mov    %rax,%rdi
+    20e7:	|      e8 aa 07 00 00       	call   2896 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr(long) const>
+    20ec:	|      48 89 c3             	mov    %rax,%rbx
+    20ef:	|      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    20f6:	|      48 8b 40 10          	mov    0x10(%rax),%rax
+    20fa:	|      48 89 c2             	mov    %rax,%rdx
+    20fd:	|      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    2104:	|      48 89 d6             	mov    %rdx,%rsi
+    2107:	|      48 89 c7             	mov    %rax,%rdi
+    210a:	|      e8 87 07 00 00       	call   2896 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr(long) const>
+    210f:	|      48 89 c1             	mov    %rax,%rcx
+    2112:	|      48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+    2119:	|      48 89 da             	mov    %rbx,%rdx
+    211c:	|      48 89 ce             	mov    %rcx,%rsi
+    211f:	|      48 89 c7             	mov    %rax,%rdi
+    2122:	|      e8 99 07 00 00       	call   28c0 <nel::Slice<U8Buf<256ul> const>::Slice(U8Buf<256ul> const*, U8Buf<256ul> const*)>
+                auto s2 = Slice(ptr(), ptr(wp_));
+    2127:	|      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    212e:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    2132:	|      48 89 c2             	mov    %rax,%rdx
+    2135:	|      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    213c:	|      48 89 d6             	mov    %rdx,%rsi
+    213f:	|      48 89 c7             	mov    %rax,%rdi
+    2142:	|      e8 4f 07 00 00       	call   2896 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr(long) const>
+    2147:	|      48 89 c3             	mov    %rax,%rbx
+    214a:	|      48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+    2151:	|      48 89 c7             	mov    %rax,%rdi
+    2154:	|      e8 9d 07 00 00       	call   28f6 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr() const>
+    2159:	|      48 89 c1             	mov    %rax,%rcx
+    215c:	|      48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+    2163:	|      48 89 da             	mov    %rbx,%rdx
+    2166:	|      48 89 ce             	mov    %rcx,%rsi
+    2169:	|      48 89 c7             	mov    %rax,%rdi
+    216c:	|      e8 4f 07 00 00       	call   28c0 <nel::Slice<U8Buf<256ul> const>::Slice(U8Buf<256ul> const*, U8Buf<256ul> const*)>
+                return QueueIterator(s1.iter(), s2.iter());
+    2171:	|      48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    2175:	|      48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+    217c:	|      48 89 d6             	mov    %rdx,%rsi
+    217f:	|      48 89 c7             	mov    %rax,%rdi
+    2182:	|      e8 6d 06 00 00       	call   27f4 <nel::Slice<U8Buf<256ul> const>::iter() const>
+    2187:	|      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    218b:	|      48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+    2192:	|      48 89 d6             	mov    %rdx,%rsi
+    2195:	|      48 89 c7             	mov    %rax,%rdi
+    2198:	|      e8 57 06 00 00       	call   27f4 <nel::Slice<U8Buf<256ul> const>::iter() const>
+    219d:	|      48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    21a1:	|      48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+    21a5:	|      48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    21ac:	|      48 89 ce             	mov    %rcx,%rsi
+    21af:	|      48 89 c7             	mov    %rax,%rdi
+    21b2:	|      e8 89 06 00 00       	call   2840 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::ChainIterator(nel::SliceIterator<U8Buf<256ul> const>&&, nel::SliceIterator<U8Buf<256ul> const>&&)>
+        }
+    21b7:	\----> 48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+    21be:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    21c2:	       c9                   	leave
+    21c3:	       c3                   	ret
+
+00000000000021c4 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::is_done() const>:
+        }
+#    endif // defined(RUST_LIKE)
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+    21c4:	       55                   	push   %rbp
+    21c5:	       48 89 e5             	mov    %rsp,%rbp
+    21c8:	       48 83 ec 10          	sub    $0x10,%rsp
+    21cc:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return it1_.is_done() && it2_.is_done();
+    21d0:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21d4:	       48 89 c7             	mov    %rax,%rdi
+    21d7:	       e8 26 00 00 00       	call   2202 <nel::SliceIterator<U8Buf<256ul> const>::is_done() const>
+    21dc:	       84 c0                	test   %al,%al
+    21de:	/----- 74 1b                	je     21fb <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::is_done() const+0x37>
+    21e0:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21e4:	|      48 83 c0 10          	add    $0x10,%rax
+    21e8:	|      48 89 c7             	mov    %rax,%rdi
+    21eb:	|      e8 12 00 00 00       	call   2202 <nel::SliceIterator<U8Buf<256ul> const>::is_done() const>
+    21f0:	|      84 c0                	test   %al,%al
+    21f2:	+----- 74 07                	je     21fb <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::is_done() const+0x37>
+    21f4:	|      b8 01 00 00 00       	mov    $0x1,%eax
+    21f9:	|  /-- eb 05                	jmp    2200 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::is_done() const+0x3c>
+    21fb:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    2200:	   \-> c9                   	leave
+    2201:	       c3                   	ret
+
+0000000000002202 <nel::SliceIterator<U8Buf<256ul> const>::is_done() const>:
+        }
+#    endif
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+    2202:	55                   	push   %rbp
+    2203:	48 89 e5             	mov    %rsp,%rbp
+    2206:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return (b_ == e_);
+    220a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    220e:	48 8b 10             	mov    (%rax),%rdx
+    2211:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2215:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2219:	48 39 c2             	cmp    %rax,%rdx
+    221c:	0f 94 c0             	sete   %al
+        }
+    221f:	5d                   	pop    %rbp
+    2220:	c3                   	ret
+    2221:	90                   	nop
+
+0000000000002222 <nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}::operator()(U8Buf<256ul> const&) const>:
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    2222:	55                   	push   %rbp
+    2223:	48 89 e5             	mov    %rsp,%rbp
+    2226:	48 83 ec 10          	sub    $0x10,%rsp
+    222a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    222e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2232:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2236:	48 8b 00             	mov    (%rax),%rax
+    2239:	be 2c 00 00 00       	mov    $0x2c,%esi
+    223e:	48 89 c7             	mov    %rax,%rdi
+    2241:	e8 70 15 00 00       	call   37b6 <nel::operator<<(nel::Log&, char)>
+    2246:	48 89 c2             	mov    %rax,%rdx
+    2249:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    224d:	48 89 c6             	mov    %rax,%rsi
+    2250:	48 89 d7             	mov    %rdx,%rdi
+    2253:	e8 92 02 00 00       	call   24ea <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    2258:	90                   	nop
+    2259:	c9                   	leave
+    225a:	c3                   	ret
+
+000000000000225b <nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)>:
+        friend Log &operator<<(Log &outs, ItT const &it)
+    225b:	    55                   	push   %rbp
+    225c:	    48 89 e5             	mov    %rsp,%rbp
+    225f:	    48 83 ec 40          	sub    $0x40,%rsp
+    2263:	    48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    2267:	    48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+            outs << '[';
+    226b:	    48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    226f:	    be 5b 00 00 00       	mov    $0x5b,%esi
+    2274:	    48 89 c7             	mov    %rax,%rdi
+    2277:	    e8 3a 15 00 00       	call   37b6 <nel::operator<<(nel::Log&, char)>
+            ItT it2 = it;
+    227c:	    48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+    2280:	    48 8b 01             	mov    (%rcx),%rax
+    2283:	    48 8b 51 08          	mov    0x8(%rcx),%rdx
+    2287:	    48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    228b:	    48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    228f:	    48 8b 41 10          	mov    0x10(%rcx),%rax
+    2293:	    48 8b 51 18          	mov    0x18(%rcx),%rdx
+    2297:	    48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    229b:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            if (!it2.is_done()) {
+    229f:	    48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    22a3:	    48 89 c7             	mov    %rax,%rdi
+    22a6:	    e8 19 ff ff ff       	call   21c4 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::is_done() const>
+    22ab:	    83 f0 01             	xor    $0x1,%eax
+    22ae:	    84 c0                	test   %al,%al
+    22b0:	/-- 74 45                	je     22f7 <nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)+0x9c>
+                outs << it2.deref();
+    22b2:	|   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    22b6:	|   48 89 c7             	mov    %rax,%rdi
+    22b9:	|   e8 56 06 00 00       	call   2914 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::deref()>
+    22be:	|   48 89 c2             	mov    %rax,%rdx
+    22c1:	|   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    22c5:	|   48 89 d6             	mov    %rdx,%rsi
+    22c8:	|   48 89 c7             	mov    %rax,%rdi
+    22cb:	|   e8 1a 02 00 00       	call   24ea <operator<<(nel::Log&, U8Buf<256ul> const&)>
+                it2.inc();
+    22d0:	|   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    22d4:	|   48 89 c7             	mov    %rax,%rdi
+    22d7:	|   e8 78 06 00 00       	call   2954 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::inc()>
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    22dc:	|   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    22e0:	|   48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    22e4:	|   48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    22e8:	|   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    22ec:	|   48 89 d6             	mov    %rdx,%rsi
+    22ef:	|   48 89 c7             	mov    %rax,%rdi
+    22f2:	|   e8 9d 06 00 00       	call   2994 <void nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::for_each<nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}>(nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&&)>
+            outs << ']';
+    22f7:	\-> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    22fb:	    be 5d 00 00 00       	mov    $0x5d,%esi
+    2300:	    48 89 c7             	mov    %rax,%rdi
+    2303:	    e8 ae 14 00 00       	call   37b6 <nel::operator<<(nel::Log&, char)>
+            return outs;
+    2308:	    48 8b 45 c8          	mov    -0x38(%rbp),%rax
+        }
+    230c:	    c9                   	leave
+    230d:	    c3                   	ret
+
+000000000000230e <nel::heapless::Queue<U8Buf<256ul>, 5ul>::is_full() const>:
+        constexpr bool is_full(void) const
+    230e:	55                   	push   %rbp
+    230f:	48 89 e5             	mov    %rsp,%rbp
+    2312:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_ == N;
+    2316:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    231a:	48 8b 00             	mov    (%rax),%rax
+    231d:	48 83 f8 05          	cmp    $0x5,%rax
+    2321:	0f 94 c0             	sete   %al
+        }
+    2324:	5d                   	pop    %rbp
+    2325:	c3                   	ret
+
+0000000000002326 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::capacity() const>:
+        constexpr Length capacity(void) const
+    2326:	55                   	push   %rbp
+    2327:	48 89 e5             	mov    %rsp,%rbp
+    232a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return N;
+    232e:	b8 05 00 00 00       	mov    $0x5,%eax
+        }
+    2333:	5d                   	pop    %rbp
+    2334:	c3                   	ret
+    2335:	90                   	nop
+
+0000000000002336 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr(long)>:
+        constexpr Type *ptr(ptrdiff_t d)
+    2336:	55                   	push   %rbp
+    2337:	48 89 e5             	mov    %rsp,%rbp
+    233a:	48 83 ec 10          	sub    $0x10,%rsp
+    233e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2342:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return &ptr()[d];
+    2346:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    234a:	48 89 c7             	mov    %rax,%rdi
+    234d:	e8 64 03 00 00       	call   26b6 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr()>
+    2352:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2356:	48 c1 e2 08          	shl    $0x8,%rdx
+    235a:	48 01 d0             	add    %rdx,%rax
+        }
+    235d:	c9                   	leave
+    235e:	c3                   	ret
+    235f:	90                   	nop
+
+0000000000002360 <U8Buf<256ul>::operator=(U8Buf<256ul>&&)>:
+        constexpr U8Buf &operator=(U8Buf &&o)
+    2360:	55                   	push   %rbp
+    2361:	48 89 e5             	mov    %rsp,%rbp
+    2364:	48 83 ec 10          	sub    $0x10,%rsp
+    2368:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    236c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            nel::elem::move(data_, o.data_, N);
+    2370:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2374:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2378:	ba 00 01 00 00       	mov    $0x100,%edx
+    237d:	48 89 ce             	mov    %rcx,%rsi
+    2380:	48 89 c7             	mov    %rax,%rdi
+    2383:	e8 34 0c 00 00       	call   2fbc <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            return *this;
+    2388:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    238c:	c9                   	leave
+    238d:	c3                   	ret
+
+000000000000238e <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>:
+        constexpr U8Buf(U8Buf &&o)
+    238e:	55                   	push   %rbp
+    238f:	48 89 e5             	mov    %rsp,%rbp
+    2392:	48 83 ec 10          	sub    $0x10,%rsp
+    2396:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    239a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            nel::elem::move(data_, o.data_, N);
+    239e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    23a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23a6:	ba 00 01 00 00       	mov    $0x100,%edx
+    23ab:	48 89 ce             	mov    %rcx,%rsi
+    23ae:	48 89 c7             	mov    %rax,%rdi
+    23b1:	e8 06 0c 00 00       	call   2fbc <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+        }
+    23b6:	90                   	nop
+    23b7:	c9                   	leave
+    23b8:	c3                   	ret
+
+00000000000023b9 <nel::Result<void, U8Buf<256ul> >::Ok()>:
+        constexpr static Result Ok(void)
+    23b9:	55                   	push   %rbp
+    23ba:	48 89 e5             	mov    %rsp,%rbp
+    23bd:	48 83 ec 10          	sub    $0x10,%rsp
+    23c1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Result(Phantom<Tag::OK>());
+    23c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23c9:	48 89 c7             	mov    %rax,%rdi
+    23cc:	e8 01 06 00 00       	call   29d2 <nel::Result<void, U8Buf<256ul> >::Result(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)1>)>
+        }
+    23d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23d5:	c9                   	leave
+    23d6:	c3                   	ret
+    23d7:	90                   	nop
+
+00000000000023d8 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    23d8:	             55                   	push   %rbp
+    23d9:	             48 89 e5             	mov    %rsp,%rbp
+    23dc:	             48 83 ec 20          	sub    $0x20,%rsp
+    23e0:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    23e4:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    23e8:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    23ec:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result<void>-match
+    23f0:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23f4:	             8b 00                	mov    (%rax),%eax
+    23f6:	             83 f8 02             	cmp    $0x2,%eax
+    23f9:	         /-- 74 1c                	je     2417 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x3f>
+    23fb:	         |   83 f8 02             	cmp    $0x2,%eax
+    23fe:	/--------|-- 7f 51                	jg     2451 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x79>
+    2400:	|        |   85 c0                	test   %eax,%eax
+    2402:	|     /--|-- 74 37                	je     243b <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x63>
+    2404:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    2407:	+-----|--|-- 75 48                	jne    2451 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x79>
+                    return on_ok();
+    2409:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    240d:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    2410:	|     |  |   e8 75 f5 ff ff       	call   198a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}::operator()() const>
+    2415:	|  /--|--|-- eb 50                	jmp    2467 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_err(*err_);
+    2417:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    241b:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    241f:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2422:	|  |  |      e8 a9 00 00 00       	call   24d0 <nel::Element<U8Buf<256ul> >::operator*() const>
+    2427:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    242a:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    242e:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    2431:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2434:	|  |  |      e8 61 f5 ff ff       	call   199a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}::operator()(U8Buf<256ul> const&) const>
+    2439:	|  +--|----- eb 2c                	jmp    2467 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x8f>
+                    nel::panic("invalid Result", ctx);
+    243b:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    243f:	|  |         48 89 c6             	mov    %rax,%rsi
+    2442:	|  |         48 8d 05 b9 1c 00 00 	lea    0x1cb9(%rip),%rax        # 4102 <nel::sort::ninther_n+0xe2>
+    2449:	|  |         48 89 c7             	mov    %rax,%rdi
+    244c:	|  |         e8 59 0a 00 00       	call   2eaa <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    2451:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2455:	   |         48 89 c6             	mov    %rax,%rsi
+    2458:	   |         48 8d 05 44 1c 00 00 	lea    0x1c44(%rip),%rax        # 40a3 <nel::sort::ninther_n+0x83>
+    245f:	   |         48 89 c7             	mov    %rax,%rdi
+    2462:	   |         e8 43 0a 00 00       	call   2eaa <nel::panic(char const*, nel::Context const&)>
+        }
+    2467:	   \-------> c9                   	leave
+    2468:	             c3                   	ret
+    2469:	             90                   	nop
+
+000000000000246a <nel::heapless::Queue<U8Buf<256ul>, 5ul>::is_empty() const>:
+        constexpr bool is_empty(void) const
+    246a:	55                   	push   %rbp
+    246b:	48 89 e5             	mov    %rsp,%rbp
+    246e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_ == 0;
+    2472:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2476:	48 8b 00             	mov    (%rax),%rax
+    2479:	48 85 c0             	test   %rax,%rax
+    247c:	0f 94 c0             	sete   %al
+        }
+    247f:	5d                   	pop    %rbp
+    2480:	c3                   	ret
+    2481:	90                   	nop
+
+0000000000002482 <nel::Optional<U8Buf<256ul> >::Optional(nel::NoneT const&)>:
+        constexpr Optional(NoneT const &)
+    2482:	55                   	push   %rbp
+    2483:	48 89 e5             	mov    %rsp,%rbp
+    2486:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    248a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : tag_(Tag::NONE)
+    248e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2492:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+        }
+    2498:	90                   	nop
+    2499:	5d                   	pop    %rbp
+    249a:	c3                   	ret
+
+000000000000249b <nel::Optional<U8Buf<256ul> > nel::Some<U8Buf<256ul> >(U8Buf<256ul>&&)>:
+};
+
+template<typename T>
+constexpr Optional<T> Some(T &&v)
+    249b:	55                   	push   %rbp
+    249c:	48 89 e5             	mov    %rsp,%rbp
+    249f:	48 83 ec 10          	sub    $0x10,%rsp
+    24a3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    24a7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+{
+    return Optional<T>::Some(forward<T>(v));
+    24ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    24af:	48 89 c7             	mov    %rax,%rdi
+    24b2:	e8 30 05 00 00       	call   29e7 <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    24b7:	48 89 c2             	mov    %rax,%rdx
+    24ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24be:	48 89 d6             	mov    %rdx,%rsi
+    24c1:	48 89 c7             	mov    %rax,%rdi
+    24c4:	e8 2c 05 00 00       	call   29f5 <nel::Optional<U8Buf<256ul> >::Some(U8Buf<256ul>&&)>
+}
+    24c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24cd:	c9                   	leave
+    24ce:	c3                   	ret
+    24cf:	90                   	nop
+
+00000000000024d0 <nel::Element<U8Buf<256ul> >::operator*() const>:
+        constexpr Type &ref(void)
+        {
+            return value_;
+        }
+
+        constexpr Type const &operator*(void) const
+    24d0:	55                   	push   %rbp
+    24d1:	48 89 e5             	mov    %rsp,%rbp
+    24d4:	48 83 ec 10          	sub    $0x10,%rsp
+    24d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    24dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24e0:	48 89 c7             	mov    %rax,%rdi
+    24e3:	e8 42 05 00 00       	call   2a2a <nel::Element<U8Buf<256ul> >::ref() const>
+        }
+    24e8:	c9                   	leave
+    24e9:	c3                   	ret
+
+00000000000024ea <operator<<(nel::Log&, U8Buf<256ul> const&)>:
+        void fill(uint8_t f)
+        {
+            nel::elem::set(data_, f, N);
+        }
+
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+    24ea:	          55                   	push   %rbp
+    24eb:	          48 89 e5             	mov    %rsp,%rbp
+    24ee:	          53                   	push   %rbx
+    24ef:	          48 83 ec 28          	sub    $0x28,%rsp
+    24f3:	          48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    24f7:	          48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+        {
+            outs << "U8Buf<" << val.len() << ">{";
+    24fb:	          48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    24ff:	          48 8d 15 0b 1c 00 00 	lea    0x1c0b(%rip),%rdx        # 4111 <nel::sort::ninther_n+0xf1>
+    2506:	          48 89 d6             	mov    %rdx,%rsi
+    2509:	          48 89 c7             	mov    %rax,%rdi
+    250c:	          e8 d1 12 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+    2511:	          48 89 c3             	mov    %rax,%rbx
+    2514:	          48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2518:	          48 89 c7             	mov    %rax,%rdi
+    251b:	          e8 18 05 00 00       	call   2a38 <U8Buf<256ul>::len() const>
+    2520:	          48 89 c6             	mov    %rax,%rsi
+    2523:	          48 89 df             	mov    %rbx,%rdi
+    2526:	          e8 c2 13 00 00       	call   38ed <nel::operator<<(nel::Log&, unsigned long)>
+    252b:	          48 89 c2             	mov    %rax,%rdx
+    252e:	          48 8d 05 e3 1b 00 00 	lea    0x1be3(%rip),%rax        # 4118 <nel::sort::ninther_n+0xf8>
+    2535:	          48 89 c6             	mov    %rax,%rsi
+    2538:	          48 89 d7             	mov    %rdx,%rdi
+    253b:	          e8 a2 12 00 00       	call   37e2 <nel::operator<<(nel::Log&, char const*)>
+            if (val.len() > 0) {
+    2540:	          48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2544:	          48 89 c7             	mov    %rax,%rdi
+    2547:	          e8 ec 04 00 00       	call   2a38 <U8Buf<256ul>::len() const>
+    254c:	          48 85 c0             	test   %rax,%rax
+    254f:	          0f 95 c0             	setne  %al
+    2552:	          84 c0                	test   %al,%al
+    2554:	/-------- 74 6d                	je     25c3 <operator<<(nel::Log&, U8Buf<256ul> const&)+0xd9>
+                outs << val.data_[0];
+    2556:	|         48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    255a:	|         0f b6 00             	movzbl (%rax),%eax
+    255d:	|         0f b6 d0             	movzbl %al,%edx
+    2560:	|         48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2564:	|         89 d6                	mov    %edx,%esi
+    2566:	|         48 89 c7             	mov    %rax,%rdi
+    2569:	|         e8 a0 12 00 00       	call   380e <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    256e:	|         48 c7 45 e8 01 00 00 	movq   $0x1,-0x18(%rbp)
+    2575:	|         00 
+    2576:	|     /-- eb 34                	jmp    25ac <operator<<(nel::Log&, U8Buf<256ul> const&)+0xc2>
+                    outs << ' ' << val.data_[i];
+    2578:	|  /--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    257c:	|  |  |   be 20 00 00 00       	mov    $0x20,%esi
+    2581:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2584:	|  |  |   e8 2d 12 00 00       	call   37b6 <nel::operator<<(nel::Log&, char)>
+    2589:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    258c:	|  |  |   48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    2590:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2594:	|  |  |   48 01 c8             	add    %rcx,%rax
+    2597:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    259a:	|  |  |   0f b6 c0             	movzbl %al,%eax
+    259d:	|  |  |   89 c6                	mov    %eax,%esi
+    259f:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    25a2:	|  |  |   e8 67 12 00 00       	call   380e <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    25a7:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    25ac:	|  |  \-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    25b0:	|  |      48 89 c7             	mov    %rax,%rdi
+    25b3:	|  |      e8 80 04 00 00       	call   2a38 <U8Buf<256ul>::len() const>
+    25b8:	|  |      48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    25bc:	|  |      0f 92 c0             	setb   %al
+    25bf:	|  |      84 c0                	test   %al,%al
+    25c1:	|  \----- 75 b5                	jne    2578 <operator<<(nel::Log&, U8Buf<256ul> const&)+0x8e>
+                }
+            }
+            outs << '}';
+    25c3:	\-------> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    25c7:	          be 7d 00 00 00       	mov    $0x7d,%esi
+    25cc:	          48 89 c7             	mov    %rax,%rdi
+    25cf:	          e8 e2 11 00 00       	call   37b6 <nel::operator<<(nel::Log&, char)>
+            return outs;
+    25d4:	          48 8b 45 d8          	mov    -0x28(%rbp),%rax
+        }
+    25d8:	          48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    25dc:	          c9                   	leave
+    25dd:	          c3                   	ret
+
+00000000000025de <nel::Slice<U8Buf<256ul> >::iter() const>:
+        constexpr Iterator iter(void) const
+    25de:	55                   	push   %rbp
+    25df:	48 89 e5             	mov    %rsp,%rbp
+    25e2:	53                   	push   %rbx
+    25e3:	48 83 ec 18          	sub    $0x18,%rsp
+    25e7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    25eb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return Iterator(ptr(), len());
+    25ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    25f3:	48 89 c7             	mov    %rax,%rdi
+    25f6:	e8 5f 04 00 00       	call   2a5a <nel::Slice<U8Buf<256ul> >::len() const>
+    25fb:	48 89 c3             	mov    %rax,%rbx
+    25fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2602:	48 89 c7             	mov    %rax,%rdi
+    2605:	e8 3e 04 00 00       	call   2a48 <nel::Slice<U8Buf<256ul> >::ptr() const>
+    260a:	48 89 c1             	mov    %rax,%rcx
+    260d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2611:	48 89 da             	mov    %rbx,%rdx
+    2614:	48 89 ce             	mov    %rcx,%rsi
+    2617:	48 89 c7             	mov    %rax,%rdi
+    261a:	e8 4d 04 00 00       	call   2a6c <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(U8Buf<256ul>*, unsigned long)>
+        }
+    261f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2623:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2627:	c9                   	leave
+    2628:	c3                   	ret
+    2629:	90                   	nop
+
+000000000000262a <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::ChainIterator(nel::SliceIterator<U8Buf<256ul> >&&, nel::SliceIterator<U8Buf<256ul> >&&)>:
+        constexpr ChainIterator(It &&it1, It &&it2)
+    262a:	55                   	push   %rbp
+    262b:	48 89 e5             	mov    %rsp,%rbp
+    262e:	53                   	push   %rbx
+    262f:	48 83 ec 28          	sub    $0x28,%rsp
+    2633:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2637:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    263b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            : it1_(move(it1))
+    263f:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    2643:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2647:	48 89 c7             	mov    %rax,%rdi
+    264a:	e8 55 04 00 00       	call   2aa4 <nel::SliceIterator<U8Buf<256ul> >&& nel::move<nel::SliceIterator<U8Buf<256ul> > >(nel::SliceIterator<U8Buf<256ul> >&)>
+    264f:	48 89 c6             	mov    %rax,%rsi
+    2652:	48 89 df             	mov    %rbx,%rdi
+    2655:	e8 58 04 00 00       	call   2ab2 <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(nel::SliceIterator<U8Buf<256ul> >&&)>
+            , it2_(move(it2))
+    265a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    265e:	48 8d 58 10          	lea    0x10(%rax),%rbx
+    2662:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2666:	48 89 c7             	mov    %rax,%rdi
+    2669:	e8 36 04 00 00       	call   2aa4 <nel::SliceIterator<U8Buf<256ul> >&& nel::move<nel::SliceIterator<U8Buf<256ul> > >(nel::SliceIterator<U8Buf<256ul> >&)>
+    266e:	48 89 c6             	mov    %rax,%rsi
+    2671:	48 89 df             	mov    %rbx,%rdi
+    2674:	e8 39 04 00 00       	call   2ab2 <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(nel::SliceIterator<U8Buf<256ul> >&&)>
+        }
+    2679:	90                   	nop
+    267a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    267e:	c9                   	leave
+    267f:	c3                   	ret
+
+0000000000002680 <nel::Slice<U8Buf<256ul> >::Slice(U8Buf<256ul>*, U8Buf<256ul>*)>:
+        constexpr Slice(Type *const b, Type *const e)
+    2680:	55                   	push   %rbp
+    2681:	48 89 e5             	mov    %rsp,%rbp
+    2684:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2688:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    268c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : content_(b)
+    2690:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2694:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2698:	48 89 10             	mov    %rdx,(%rax)
+            , len_(e - b)
+    269b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    269f:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+    26a3:	48 c1 f8 08          	sar    $0x8,%rax
+    26a7:	48 89 c2             	mov    %rax,%rdx
+    26aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26ae:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    26b2:	90                   	nop
+    26b3:	5d                   	pop    %rbp
+    26b4:	c3                   	ret
+    26b5:	90                   	nop
+
+00000000000026b6 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr()>:
+        constexpr Type *ptr()
+    26b6:	55                   	push   %rbp
+    26b7:	48 89 e5             	mov    %rsp,%rbp
+    26ba:	48 83 ec 10          	sub    $0x10,%rsp
+    26be:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return elems_.ptr()[0];
+    26c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26c6:	48 83 c0 18          	add    $0x18,%rax
+    26ca:	48 89 c7             	mov    %rax,%rdi
+    26cd:	e8 3c 04 00 00       	call   2b0e <nel::Manual<U8Buf<256ul> [5]>::ptr()>
+        }
+    26d2:	c9                   	leave
+    26d3:	c3                   	ret
+
+00000000000026d4 <nel::Iterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>:
+        constexpr ItT &self(void)
+    26d4:	55                   	push   %rbp
+    26d5:	48 89 e5             	mov    %rsp,%rbp
+    26d8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    26dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26e0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    26e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    26e8:	5d                   	pop    %rbp
+    26e9:	c3                   	ret
+
+00000000000026ea <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >&& nel::move<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >(nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >&)>:
+constexpr T &&move(T &v)
+    26ea:	55                   	push   %rbp
+    26eb:	48 89 e5             	mov    %rsp,%rbp
+    26ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    26f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    26f6:	5d                   	pop    %rbp
+    26f7:	c3                   	ret
+
+00000000000026f8 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::ChainIterator(nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >&&)>:
+struct ChainIterator: public Iterator<ChainIterator<It>, typename It::InT, typename It::OutT>
+    26f8:	55                   	push   %rbp
+    26f9:	48 89 e5             	mov    %rsp,%rbp
+    26fc:	48 83 ec 10          	sub    $0x10,%rsp
+    2700:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2704:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2708:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    270c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2710:	48 89 d6             	mov    %rdx,%rsi
+    2713:	48 89 c7             	mov    %rax,%rdi
+    2716:	e8 97 03 00 00       	call   2ab2 <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(nel::SliceIterator<U8Buf<256ul> >&&)>
+    271b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    271f:	48 83 c0 10          	add    $0x10,%rax
+    2723:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2727:	48 83 c2 10          	add    $0x10,%rdx
+    272b:	48 89 d6             	mov    %rdx,%rsi
+    272e:	48 89 c7             	mov    %rax,%rdi
+    2731:	e8 7c 03 00 00       	call   2ab2 <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(nel::SliceIterator<U8Buf<256ul> >&&)>
+    2736:	90                   	nop
+    2737:	c9                   	leave
+    2738:	c3                   	ret
+    2739:	90                   	nop
+
+000000000000273a <nel::RevIterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >::RevIterator(nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >&&)>:
+
+    private:
+        It inner_;
+
+    public:
+        constexpr RevIterator(It &&inner)
+    273a:	55                   	push   %rbp
+    273b:	48 89 e5             	mov    %rsp,%rbp
+    273e:	53                   	push   %rbx
+    273f:	48 83 ec 18          	sub    $0x18,%rsp
+    2743:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2747:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : inner_(move(inner))
+    274b:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    274f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2753:	48 89 c7             	mov    %rax,%rdi
+    2756:	e8 8f ff ff ff       	call   26ea <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >&& nel::move<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >(nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >&)>
+    275b:	48 89 c6             	mov    %rax,%rsi
+    275e:	48 89 df             	mov    %rbx,%rdi
+    2761:	e8 92 ff ff ff       	call   26f8 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::ChainIterator(nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >&&)>
+        {
+        }
+    2766:	90                   	nop
+    2767:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    276b:	c9                   	leave
+    276c:	c3                   	ret
+    276d:	90                   	nop
+
+000000000000276e <nel::Iterator<nel::RevIterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>:
+        constexpr ItT &self(void)
+    276e:	55                   	push   %rbp
+    276f:	48 89 e5             	mov    %rsp,%rbp
+    2772:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    2776:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    277a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    277e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2782:	5d                   	pop    %rbp
+    2783:	c3                   	ret
+
+0000000000002784 <nel::RevIterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >::is_done() const>:
+        }
+#    endif // defined(RUST_LIKE)
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+    2784:	55                   	push   %rbp
+    2785:	48 89 e5             	mov    %rsp,%rbp
+    2788:	48 83 ec 10          	sub    $0x10,%rsp
+    278c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return inner_.is_done();
+    2790:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2794:	48 89 c7             	mov    %rax,%rdi
+    2797:	e8 80 03 00 00       	call   2b1c <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::is_done() const>
+        }
+    279c:	c9                   	leave
+    279d:	c3                   	ret
+
+000000000000279e <nel::RevIterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >::inc()>:
+
+        void inc(void)
+    279e:	55                   	push   %rbp
+    279f:	48 89 e5             	mov    %rsp,%rbp
+    27a2:	48 83 ec 10          	sub    $0x10,%rsp
+    27a6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            inner_.dec();
+    27aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27ae:	48 89 c7             	mov    %rax,%rdi
+    27b1:	e8 a4 03 00 00       	call   2b5a <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::dec()>
+        }
+    27b6:	90                   	nop
+    27b7:	c9                   	leave
+    27b8:	c3                   	ret
+    27b9:	90                   	nop
+
+00000000000027ba <nel::RevIterator<nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > > >::deref()>:
+
+        OutT deref(void)
+    27ba:	55                   	push   %rbp
+    27bb:	48 89 e5             	mov    %rsp,%rbp
+    27be:	48 83 ec 10          	sub    $0x10,%rsp
+    27c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return inner_.deref_back();
+    27c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27ca:	48 89 c7             	mov    %rax,%rdi
+    27cd:	e8 cc 03 00 00       	call   2b9e <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::deref_back()>
+        }
+    27d2:	c9                   	leave
+    27d3:	c3                   	ret
+
+00000000000027d4 <void nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()::{lambda(auto:1&)#1}::operator()<U8Buf<256ul> >(U8Buf<256ul>&) const>:
+            iter().rev().for_each([&](auto &v) -> void { v.~Type(); });
+    27d4:	55                   	push   %rbp
+    27d5:	48 89 e5             	mov    %rsp,%rbp
+    27d8:	48 83 ec 10          	sub    $0x10,%rsp
+    27dc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    27e0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    27e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    27e8:	48 89 c7             	mov    %rax,%rdi
+    27eb:	e8 98 ef ff ff       	call   1788 <U8Buf<256ul>::~U8Buf()>
+    27f0:	90                   	nop
+    27f1:	c9                   	leave
+    27f2:	c3                   	ret
+    27f3:	90                   	nop
+
+00000000000027f4 <nel::Slice<U8Buf<256ul> const>::iter() const>:
+        constexpr Iterator iter(void) const
+    27f4:	55                   	push   %rbp
+    27f5:	48 89 e5             	mov    %rsp,%rbp
+    27f8:	53                   	push   %rbx
+    27f9:	48 83 ec 18          	sub    $0x18,%rsp
+    27fd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2801:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return Iterator(ptr(), len());
+    2805:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2809:	48 89 c7             	mov    %rax,%rdi
+    280c:	e8 e3 03 00 00       	call   2bf4 <nel::Slice<U8Buf<256ul> const>::len() const>
+    2811:	48 89 c3             	mov    %rax,%rbx
+    2814:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2818:	48 89 c7             	mov    %rax,%rdi
+    281b:	e8 c2 03 00 00       	call   2be2 <nel::Slice<U8Buf<256ul> const>::ptr() const>
+    2820:	48 89 c1             	mov    %rax,%rcx
+    2823:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2827:	48 89 da             	mov    %rbx,%rdx
+    282a:	48 89 ce             	mov    %rcx,%rsi
+    282d:	48 89 c7             	mov    %rax,%rdi
+    2830:	e8 d1 03 00 00       	call   2c06 <nel::SliceIterator<U8Buf<256ul> const>::SliceIterator(U8Buf<256ul> const*, unsigned long)>
+        }
+    2835:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2839:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    283d:	c9                   	leave
+    283e:	c3                   	ret
+    283f:	90                   	nop
+
+0000000000002840 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::ChainIterator(nel::SliceIterator<U8Buf<256ul> const>&&, nel::SliceIterator<U8Buf<256ul> const>&&)>:
+        constexpr ChainIterator(It &&it1, It &&it2)
+    2840:	55                   	push   %rbp
+    2841:	48 89 e5             	mov    %rsp,%rbp
+    2844:	53                   	push   %rbx
+    2845:	48 83 ec 28          	sub    $0x28,%rsp
+    2849:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    284d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2851:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            : it1_(move(it1))
+    2855:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    2859:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    285d:	48 89 c7             	mov    %rax,%rdi
+    2860:	e8 d9 03 00 00       	call   2c3e <nel::SliceIterator<U8Buf<256ul> const>&& nel::move<nel::SliceIterator<U8Buf<256ul> const> >(nel::SliceIterator<U8Buf<256ul> const>&)>
+    2865:	48 89 c6             	mov    %rax,%rsi
+    2868:	48 89 df             	mov    %rbx,%rdi
+    286b:	e8 dc 03 00 00       	call   2c4c <nel::SliceIterator<U8Buf<256ul> const>::SliceIterator(nel::SliceIterator<U8Buf<256ul> const>&&)>
+            , it2_(move(it2))
+    2870:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2874:	48 8d 58 10          	lea    0x10(%rax),%rbx
+    2878:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    287c:	48 89 c7             	mov    %rax,%rdi
+    287f:	e8 ba 03 00 00       	call   2c3e <nel::SliceIterator<U8Buf<256ul> const>&& nel::move<nel::SliceIterator<U8Buf<256ul> const> >(nel::SliceIterator<U8Buf<256ul> const>&)>
+    2884:	48 89 c6             	mov    %rax,%rsi
+    2887:	48 89 df             	mov    %rbx,%rdi
+    288a:	e8 bd 03 00 00       	call   2c4c <nel::SliceIterator<U8Buf<256ul> const>::SliceIterator(nel::SliceIterator<U8Buf<256ul> const>&&)>
+        }
+    288f:	90                   	nop
+    2890:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2894:	c9                   	leave
+    2895:	c3                   	ret
+
+0000000000002896 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr(long) const>:
+        constexpr Type const *ptr(ptrdiff_t d) const
+    2896:	55                   	push   %rbp
+    2897:	48 89 e5             	mov    %rsp,%rbp
+    289a:	48 83 ec 10          	sub    $0x10,%rsp
+    289e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    28a2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return &ptr()[d];
+    28a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28aa:	48 89 c7             	mov    %rax,%rdi
+    28ad:	e8 44 00 00 00       	call   28f6 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr() const>
+    28b2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    28b6:	48 c1 e2 08          	shl    $0x8,%rdx
+    28ba:	48 01 d0             	add    %rdx,%rax
+        }
+    28bd:	c9                   	leave
+    28be:	c3                   	ret
+    28bf:	90                   	nop
+
+00000000000028c0 <nel::Slice<U8Buf<256ul> const>::Slice(U8Buf<256ul> const*, U8Buf<256ul> const*)>:
+        constexpr Slice(Type *const b, Type *const e)
+    28c0:	55                   	push   %rbp
+    28c1:	48 89 e5             	mov    %rsp,%rbp
+    28c4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    28c8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    28cc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : content_(b)
+    28d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28d4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    28d8:	48 89 10             	mov    %rdx,(%rax)
+            , len_(e - b)
+    28db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28df:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+    28e3:	48 c1 f8 08          	sar    $0x8,%rax
+    28e7:	48 89 c2             	mov    %rax,%rdx
+    28ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28ee:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    28f2:	90                   	nop
+    28f3:	5d                   	pop    %rbp
+    28f4:	c3                   	ret
+    28f5:	90                   	nop
+
+00000000000028f6 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::ptr() const>:
+        constexpr Type const *ptr() const
+    28f6:	55                   	push   %rbp
+    28f7:	48 89 e5             	mov    %rsp,%rbp
+    28fa:	48 83 ec 10          	sub    $0x10,%rsp
+    28fe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return elems_.ptr()[0];
+    2902:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2906:	48 83 c0 18          	add    $0x18,%rax
+    290a:	48 89 c7             	mov    %rax,%rdi
+    290d:	e8 96 03 00 00       	call   2ca8 <nel::Manual<U8Buf<256ul> [5]>::ptr() const>
+        }
+    2912:	c9                   	leave
+    2913:	c3                   	ret
+
+0000000000002914 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::deref()>:
+        OutT deref(void)
+    2914:	       55                   	push   %rbp
+    2915:	       48 89 e5             	mov    %rsp,%rbp
+    2918:	       48 83 ec 10          	sub    $0x10,%rsp
+    291c:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (!it1_.is_done()) ? it1_.deref() : it2_.deref();
+    2920:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2924:	       48 89 c7             	mov    %rax,%rdi
+    2927:	       e8 d6 f8 ff ff       	call   2202 <nel::SliceIterator<U8Buf<256ul> const>::is_done() const>
+    292c:	       83 f0 01             	xor    $0x1,%eax
+    292f:	       84 c0                	test   %al,%al
+    2931:	   /-- 74 0e                	je     2941 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::deref()+0x2d>
+    2933:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2937:	   |   48 89 c7             	mov    %rax,%rdi
+    293a:	   |   e8 77 03 00 00       	call   2cb6 <nel::SliceIterator<U8Buf<256ul> const>::deref()>
+    293f:	/--|-- eb 10                	jmp    2951 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::deref()+0x3d>
+    2941:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2945:	|      48 83 c0 10          	add    $0x10,%rax
+    2949:	|      48 89 c7             	mov    %rax,%rdi
+    294c:	|      e8 65 03 00 00       	call   2cb6 <nel::SliceIterator<U8Buf<256ul> const>::deref()>
+        }
+    2951:	\----> c9                   	leave
+    2952:	       c3                   	ret
+    2953:	       90                   	nop
+
+0000000000002954 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::inc()>:
+        void inc(void)
+    2954:	       55                   	push   %rbp
+    2955:	       48 89 e5             	mov    %rsp,%rbp
+    2958:	       48 83 ec 10          	sub    $0x10,%rsp
+    295c:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            if (!it1_.is_done()) {
+    2960:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2964:	       48 89 c7             	mov    %rax,%rdi
+    2967:	       e8 96 f8 ff ff       	call   2202 <nel::SliceIterator<U8Buf<256ul> const>::is_done() const>
+    296c:	       83 f0 01             	xor    $0x1,%eax
+    296f:	       84 c0                	test   %al,%al
+    2971:	   /-- 74 0e                	je     2981 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::inc()+0x2d>
+                it1_.inc();
+    2973:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2977:	   |   48 89 c7             	mov    %rax,%rdi
+    297a:	   |   e8 49 03 00 00       	call   2cc8 <nel::SliceIterator<U8Buf<256ul> const>::inc()>
+        }
+    297f:	/--|-- eb 10                	jmp    2991 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::inc()+0x3d>
+                it2_.inc();
+    2981:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2985:	|      48 83 c0 10          	add    $0x10,%rax
+    2989:	|      48 89 c7             	mov    %rax,%rdi
+    298c:	|      e8 37 03 00 00       	call   2cc8 <nel::SliceIterator<U8Buf<256ul> const>::inc()>
+        }
+    2991:	\----> 90                   	nop
+    2992:	       c9                   	leave
+    2993:	       c3                   	ret
+
+0000000000002994 <void nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> >::for_each<nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}>(nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&&)>:
+        void for_each(F &&fn)
+    2994:	55                   	push   %rbp
+    2995:	48 89 e5             	mov    %rsp,%rbp
+    2998:	48 83 ec 10          	sub    $0x10,%rsp
+    299c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    29a0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            it1_.for_each(fn);
+    29a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29a8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    29ac:	48 89 d6             	mov    %rdx,%rsi
+    29af:	48 89 c7             	mov    %rax,%rdi
+    29b2:	e8 31 03 00 00       	call   2ce8 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&>(nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&)>
+            it2_.for_each(fn);
+    29b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29bb:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    29bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    29c3:	48 89 c6             	mov    %rax,%rsi
+    29c6:	48 89 d7             	mov    %rdx,%rdi
+    29c9:	e8 1a 03 00 00       	call   2ce8 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&>(nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&)>
+        }
+    29ce:	90                   	nop
+    29cf:	c9                   	leave
+    29d0:	c3                   	ret
+    29d1:	90                   	nop
+
+00000000000029d2 <nel::Result<void, U8Buf<256ul> >::Result(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)1>)>:
+        constexpr Result(Phantom<Tag::OK> const)
+    29d2:	55                   	push   %rbp
+    29d3:	48 89 e5             	mov    %rsp,%rbp
+    29d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : tag_(Tag::OK)
+    29da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29de:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+        }
+    29e4:	90                   	nop
+    29e5:	5d                   	pop    %rbp
+    29e6:	c3                   	ret
+
+00000000000029e7 <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel so to not need std.
+ */
+template<typename U, typename T>
+constexpr U &&forward(T &t)
+    29e7:	55                   	push   %rbp
+    29e8:	48 89 e5             	mov    %rsp,%rbp
+    29eb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<U &&>(t);
+    29ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    29f3:	5d                   	pop    %rbp
+    29f4:	c3                   	ret
+
+00000000000029f5 <nel::Optional<U8Buf<256ul> >::Some(U8Buf<256ul>&&)>:
+        constexpr static Optional Some(T &&v)
+    29f5:	55                   	push   %rbp
+    29f6:	48 89 e5             	mov    %rsp,%rbp
+    29f9:	48 83 ec 10          	sub    $0x10,%rsp
+    29fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2a01:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Optional(Phantom<Tag::SOME>(), forward<T>(v));
+    2a05:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a09:	48 89 c7             	mov    %rax,%rdi
+    2a0c:	e8 d6 ff ff ff       	call   29e7 <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    2a11:	48 89 c2             	mov    %rax,%rdx
+    2a14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a18:	48 89 d6             	mov    %rdx,%rsi
+    2a1b:	48 89 c7             	mov    %rax,%rdi
+    2a1e:	e8 31 03 00 00       	call   2d54 <nel::Optional<U8Buf<256ul> >::Optional(nel::Optional<U8Buf<256ul> >::Phantom<(nel::Optional<U8Buf<256ul> >::Tag)2>, U8Buf<256ul>&&)>
+        }
+    2a23:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a27:	c9                   	leave
+    2a28:	c3                   	ret
+    2a29:	90                   	nop
+
+0000000000002a2a <nel::Element<U8Buf<256ul> >::ref() const>:
+        constexpr Type const &ref(void) const
+    2a2a:	55                   	push   %rbp
+    2a2b:	48 89 e5             	mov    %rsp,%rbp
+    2a2e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2a32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2a36:	5d                   	pop    %rbp
+    2a37:	c3                   	ret
+
+0000000000002a38 <U8Buf<256ul>::len() const>:
+        constexpr Length len(void) const
+    2a38:	55                   	push   %rbp
+    2a39:	48 89 e5             	mov    %rsp,%rbp
+    2a3c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return N;
+    2a40:	b8 00 01 00 00       	mov    $0x100,%eax
+        }
+    2a45:	5d                   	pop    %rbp
+    2a46:	c3                   	ret
+    2a47:	90                   	nop
+
+0000000000002a48 <nel::Slice<U8Buf<256ul> >::ptr() const>:
+        constexpr Type *ptr(void) const
+    2a48:	55                   	push   %rbp
+    2a49:	48 89 e5             	mov    %rsp,%rbp
+    2a4c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return content_;
+    2a50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a54:	48 8b 00             	mov    (%rax),%rax
+        }
+    2a57:	5d                   	pop    %rbp
+    2a58:	c3                   	ret
+    2a59:	90                   	nop
+
+0000000000002a5a <nel::Slice<U8Buf<256ul> >::len() const>:
+        constexpr Length len(void) const
+    2a5a:	55                   	push   %rbp
+    2a5b:	48 89 e5             	mov    %rsp,%rbp
+    2a5e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    2a62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a66:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    2a6a:	5d                   	pop    %rbp
+    2a6b:	c3                   	ret
+
+0000000000002a6c <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(U8Buf<256ul>*, unsigned long)>:
+        constexpr SliceIterator(T arr[], Count len)
+    2a6c:	55                   	push   %rbp
+    2a6d:	48 89 e5             	mov    %rsp,%rbp
+    2a70:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2a74:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2a78:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : b_(arr)
+    2a7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a80:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2a84:	48 89 10             	mov    %rdx,(%rax)
+            , e_(arr + len)
+    2a87:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a8b:	48 c1 e0 08          	shl    $0x8,%rax
+    2a8f:	48 89 c2             	mov    %rax,%rdx
+    2a92:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a96:	48 01 c2             	add    %rax,%rdx
+    2a99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a9d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    2aa1:	90                   	nop
+    2aa2:	5d                   	pop    %rbp
+    2aa3:	c3                   	ret
+
+0000000000002aa4 <nel::SliceIterator<U8Buf<256ul> >&& nel::move<nel::SliceIterator<U8Buf<256ul> > >(nel::SliceIterator<U8Buf<256ul> >&)>:
+constexpr T &&move(T &v)
+    2aa4:	55                   	push   %rbp
+    2aa5:	48 89 e5             	mov    %rsp,%rbp
+    2aa8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    2aac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2ab0:	5d                   	pop    %rbp
+    2ab1:	c3                   	ret
+
+0000000000002ab2 <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(nel::SliceIterator<U8Buf<256ul> >&&)>:
+        SliceIterator(SliceIterator &&o)
+    2ab2:	55                   	push   %rbp
+    2ab3:	48 89 e5             	mov    %rsp,%rbp
+    2ab6:	48 83 ec 10          	sub    $0x10,%rsp
+    2aba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2abe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : b_(move(o.b_))
+    2ac2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ac6:	48 89 c7             	mov    %rax,%rdi
+    2ac9:	e8 c7 02 00 00       	call   2d95 <U8Buf<256ul>*&& nel::move<U8Buf<256ul>*>(U8Buf<256ul>*&)>
+    2ace:	48 8b 10             	mov    (%rax),%rdx
+    2ad1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ad5:	48 89 10             	mov    %rdx,(%rax)
+            , e_(move(o.e_))
+    2ad8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2adc:	48 83 c0 08          	add    $0x8,%rax
+    2ae0:	48 89 c7             	mov    %rax,%rdi
+    2ae3:	e8 ad 02 00 00       	call   2d95 <U8Buf<256ul>*&& nel::move<U8Buf<256ul>*>(U8Buf<256ul>*&)>
+    2ae8:	48 8b 10             	mov    (%rax),%rdx
+    2aeb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2aef:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            o.b_ = nullptr;
+    2af3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2af7:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+            o.e_ = nullptr;
+    2afe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b02:	48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    2b09:	00 
+        }
+    2b0a:	90                   	nop
+    2b0b:	c9                   	leave
+    2b0c:	c3                   	ret
+    2b0d:	90                   	nop
+
+0000000000002b0e <nel::Manual<U8Buf<256ul> [5]>::ptr()>:
+
+        // private:
+    public:
+        // only if you know there's a value there..
+        // TODO: must have no bare pointers.. safety feature.
+        constexpr Type *ptr()
+    2b0e:	55                   	push   %rbp
+    2b0f:	48 89 e5             	mov    %rsp,%rbp
+    2b12:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return &u_.elem_;
+    2b16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2b1a:	5d                   	pop    %rbp
+    2b1b:	c3                   	ret
+
+0000000000002b1c <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::is_done() const>:
+        constexpr bool is_done(void) const
+    2b1c:	       55                   	push   %rbp
+    2b1d:	       48 89 e5             	mov    %rsp,%rbp
+    2b20:	       48 83 ec 10          	sub    $0x10,%rsp
+    2b24:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return it1_.is_done() && it2_.is_done();
+    2b28:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b2c:	       48 89 c7             	mov    %rax,%rdi
+    2b2f:	       e8 70 02 00 00       	call   2da4 <nel::SliceIterator<U8Buf<256ul> >::is_done() const>
+    2b34:	       84 c0                	test   %al,%al
+    2b36:	/----- 74 1b                	je     2b53 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::is_done() const+0x37>
+    2b38:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b3c:	|      48 83 c0 10          	add    $0x10,%rax
+    2b40:	|      48 89 c7             	mov    %rax,%rdi
+    2b43:	|      e8 5c 02 00 00       	call   2da4 <nel::SliceIterator<U8Buf<256ul> >::is_done() const>
+    2b48:	|      84 c0                	test   %al,%al
+    2b4a:	+----- 74 07                	je     2b53 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::is_done() const+0x37>
+    2b4c:	|      b8 01 00 00 00       	mov    $0x1,%eax
+    2b51:	|  /-- eb 05                	jmp    2b58 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::is_done() const+0x3c>
+    2b53:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    2b58:	   \-> c9                   	leave
+    2b59:	       c3                   	ret
+
+0000000000002b5a <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::dec()>:
+        void dec(void)
+    2b5a:	       55                   	push   %rbp
+    2b5b:	       48 89 e5             	mov    %rsp,%rbp
+    2b5e:	       48 83 ec 10          	sub    $0x10,%rsp
+    2b62:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            if (!it2_.is_done()) {
+    2b66:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b6a:	       48 83 c0 10          	add    $0x10,%rax
+    2b6e:	       48 89 c7             	mov    %rax,%rdi
+    2b71:	       e8 2e 02 00 00       	call   2da4 <nel::SliceIterator<U8Buf<256ul> >::is_done() const>
+    2b76:	       83 f0 01             	xor    $0x1,%eax
+    2b79:	       84 c0                	test   %al,%al
+    2b7b:	/----- 74 12                	je     2b8f <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::dec()+0x35>
+                it2_.dec();
+    2b7d:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b81:	|      48 83 c0 10          	add    $0x10,%rax
+    2b85:	|      48 89 c7             	mov    %rax,%rdi
+    2b88:	|      e8 37 02 00 00       	call   2dc4 <nel::SliceIterator<U8Buf<256ul> >::dec()>
+        }
+    2b8d:	|  /-- eb 0c                	jmp    2b9b <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::dec()+0x41>
+                it1_.dec();
+    2b8f:	\--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b93:	   |   48 89 c7             	mov    %rax,%rdi
+    2b96:	   |   e8 29 02 00 00       	call   2dc4 <nel::SliceIterator<U8Buf<256ul> >::dec()>
+        }
+    2b9b:	   \-> 90                   	nop
+    2b9c:	       c9                   	leave
+    2b9d:	       c3                   	ret
+
+0000000000002b9e <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::deref_back()>:
+        OutT deref_back(void)
+    2b9e:	       55                   	push   %rbp
+    2b9f:	       48 89 e5             	mov    %rsp,%rbp
+    2ba2:	       48 83 ec 10          	sub    $0x10,%rsp
+    2ba6:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (!it2_.is_done()) ? it2_.deref_back() : it1_.deref_back();
+    2baa:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2bae:	       48 83 c0 10          	add    $0x10,%rax
+    2bb2:	       48 89 c7             	mov    %rax,%rdi
+    2bb5:	       e8 ea 01 00 00       	call   2da4 <nel::SliceIterator<U8Buf<256ul> >::is_done() const>
+    2bba:	       83 f0 01             	xor    $0x1,%eax
+    2bbd:	       84 c0                	test   %al,%al
+    2bbf:	/----- 74 12                	je     2bd3 <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::deref_back()+0x35>
+    2bc1:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2bc5:	|      48 83 c0 10          	add    $0x10,%rax
+    2bc9:	|      48 89 c7             	mov    %rax,%rdi
+    2bcc:	|      e8 15 02 00 00       	call   2de6 <nel::SliceIterator<U8Buf<256ul> >::deref_back()>
+    2bd1:	|  /-- eb 0c                	jmp    2bdf <nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> > >::deref_back()+0x41>
+    2bd3:	\--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2bd7:	   |   48 89 c7             	mov    %rax,%rdi
+    2bda:	   |   e8 07 02 00 00       	call   2de6 <nel::SliceIterator<U8Buf<256ul> >::deref_back()>
+        }
+    2bdf:	   \-> c9                   	leave
+    2be0:	       c3                   	ret
+    2be1:	       90                   	nop
+
+0000000000002be2 <nel::Slice<U8Buf<256ul> const>::ptr() const>:
+        constexpr Type *ptr(void) const
+    2be2:	55                   	push   %rbp
+    2be3:	48 89 e5             	mov    %rsp,%rbp
+    2be6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return content_;
+    2bea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2bee:	48 8b 00             	mov    (%rax),%rax
+        }
+    2bf1:	5d                   	pop    %rbp
+    2bf2:	c3                   	ret
+    2bf3:	90                   	nop
+
+0000000000002bf4 <nel::Slice<U8Buf<256ul> const>::len() const>:
+        constexpr Length len(void) const
+    2bf4:	55                   	push   %rbp
+    2bf5:	48 89 e5             	mov    %rsp,%rbp
+    2bf8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    2bfc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c00:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    2c04:	5d                   	pop    %rbp
+    2c05:	c3                   	ret
+
+0000000000002c06 <nel::SliceIterator<U8Buf<256ul> const>::SliceIterator(U8Buf<256ul> const*, unsigned long)>:
+        constexpr SliceIterator(T arr[], Count len)
+    2c06:	55                   	push   %rbp
+    2c07:	48 89 e5             	mov    %rsp,%rbp
+    2c0a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2c0e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2c12:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : b_(arr)
+    2c16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c1a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2c1e:	48 89 10             	mov    %rdx,(%rax)
+            , e_(arr + len)
+    2c21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c25:	48 c1 e0 08          	shl    $0x8,%rax
+    2c29:	48 89 c2             	mov    %rax,%rdx
+    2c2c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2c30:	48 01 c2             	add    %rax,%rdx
+    2c33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c37:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    2c3b:	90                   	nop
+    2c3c:	5d                   	pop    %rbp
+    2c3d:	c3                   	ret
+
+0000000000002c3e <nel::SliceIterator<U8Buf<256ul> const>&& nel::move<nel::SliceIterator<U8Buf<256ul> const> >(nel::SliceIterator<U8Buf<256ul> const>&)>:
+constexpr T &&move(T &v)
+    2c3e:	55                   	push   %rbp
+    2c3f:	48 89 e5             	mov    %rsp,%rbp
+    2c42:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    2c46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2c4a:	5d                   	pop    %rbp
+    2c4b:	c3                   	ret
+
+0000000000002c4c <nel::SliceIterator<U8Buf<256ul> const>::SliceIterator(nel::SliceIterator<U8Buf<256ul> const>&&)>:
+        SliceIterator(SliceIterator &&o)
+    2c4c:	55                   	push   %rbp
+    2c4d:	48 89 e5             	mov    %rsp,%rbp
+    2c50:	48 83 ec 10          	sub    $0x10,%rsp
+    2c54:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2c58:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : b_(move(o.b_))
+    2c5c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2c60:	48 89 c7             	mov    %rax,%rdi
+    2c63:	e8 96 01 00 00       	call   2dfe <U8Buf<256ul> const*&& nel::move<U8Buf<256ul> const*>(U8Buf<256ul> const*&)>
+    2c68:	48 8b 10             	mov    (%rax),%rdx
+    2c6b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c6f:	48 89 10             	mov    %rdx,(%rax)
+            , e_(move(o.e_))
+    2c72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2c76:	48 83 c0 08          	add    $0x8,%rax
+    2c7a:	48 89 c7             	mov    %rax,%rdi
+    2c7d:	e8 7c 01 00 00       	call   2dfe <U8Buf<256ul> const*&& nel::move<U8Buf<256ul> const*>(U8Buf<256ul> const*&)>
+    2c82:	48 8b 10             	mov    (%rax),%rdx
+    2c85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c89:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            o.b_ = nullptr;
+    2c8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2c91:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+            o.e_ = nullptr;
+    2c98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2c9c:	48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    2ca3:	00 
+        }
+    2ca4:	90                   	nop
+    2ca5:	c9                   	leave
+    2ca6:	c3                   	ret
+    2ca7:	90                   	nop
+
+0000000000002ca8 <nel::Manual<U8Buf<256ul> [5]>::ptr() const>:
+
+        constexpr Type const *ptr() const
+    2ca8:	55                   	push   %rbp
+    2ca9:	48 89 e5             	mov    %rsp,%rbp
+    2cac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return &u_.elem_;
+    2cb0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2cb4:	5d                   	pop    %rbp
+    2cb5:	c3                   	ret
+
+0000000000002cb6 <nel::SliceIterator<U8Buf<256ul> const>::deref()>:
+        void inc(void)
+        {
+            ++b_;
+        }
+
+        OutT deref(void)
+    2cb6:	55                   	push   %rbp
+    2cb7:	48 89 e5             	mov    %rsp,%rbp
+    2cba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return *b_;
+    2cbe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cc2:	48 8b 00             	mov    (%rax),%rax
+        }
+    2cc5:	5d                   	pop    %rbp
+    2cc6:	c3                   	ret
+    2cc7:	90                   	nop
+
+0000000000002cc8 <nel::SliceIterator<U8Buf<256ul> const>::inc()>:
+        void inc(void)
+    2cc8:	55                   	push   %rbp
+    2cc9:	48 89 e5             	mov    %rsp,%rbp
+    2ccc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            ++b_;
+    2cd0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cd4:	48 8b 00             	mov    (%rax),%rax
+    2cd7:	48 8d 90 00 01 00 00 	lea    0x100(%rax),%rdx
+    2cde:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ce2:	48 89 10             	mov    %rdx,(%rax)
+        }
+    2ce5:	90                   	nop
+    2ce6:	5d                   	pop    %rbp
+    2ce7:	c3                   	ret
+
+0000000000002ce8 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&>(nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&)>:
+        void for_each(F &&fn)
+    2ce8:	       55                   	push   %rbp
+    2ce9:	       48 89 e5             	mov    %rsp,%rbp
+    2cec:	       48 83 ec 10          	sub    $0x10,%rsp
+    2cf0:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2cf4:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            for (; !self().is_done(); self().inc()) {
+    2cf8:	   /-- eb 3a                	jmp    2d34 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&>(nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&)+0x4c>
+                fn(self().deref());
+    2cfa:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cfe:	|  |   48 89 c7             	mov    %rax,%rdi
+    2d01:	|  |   e8 06 01 00 00       	call   2e0c <nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::self()>
+    2d06:	|  |   48 89 c7             	mov    %rax,%rdi
+    2d09:	|  |   e8 a8 ff ff ff       	call   2cb6 <nel::SliceIterator<U8Buf<256ul> const>::deref()>
+    2d0e:	|  |   48 89 c2             	mov    %rax,%rdx
+    2d11:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2d15:	|  |   48 89 d6             	mov    %rdx,%rsi
+    2d18:	|  |   48 89 c7             	mov    %rax,%rdi
+    2d1b:	|  |   e8 02 f5 ff ff       	call   2222 <nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}::operator()(U8Buf<256ul> const&) const>
+            for (; !self().is_done(); self().inc()) {
+    2d20:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d24:	|  |   48 89 c7             	mov    %rax,%rdi
+    2d27:	|  |   e8 e0 00 00 00       	call   2e0c <nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::self()>
+    2d2c:	|  |   48 89 c7             	mov    %rax,%rdi
+    2d2f:	|  |   e8 94 ff ff ff       	call   2cc8 <nel::SliceIterator<U8Buf<256ul> const>::inc()>
+    2d34:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d38:	|      48 89 c7             	mov    %rax,%rdi
+    2d3b:	|      e8 cc 00 00 00       	call   2e0c <nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::self()>
+    2d40:	|      48 89 c7             	mov    %rax,%rdi
+    2d43:	|      e8 ba f4 ff ff       	call   2202 <nel::SliceIterator<U8Buf<256ul> const>::is_done() const>
+    2d48:	|      83 f0 01             	xor    $0x1,%eax
+    2d4b:	|      84 c0                	test   %al,%al
+    2d4d:	\----- 75 ab                	jne    2cfa <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&>(nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&)+0x12>
+        }
+    2d4f:	       90                   	nop
+    2d50:	       90                   	nop
+    2d51:	       c9                   	leave
+    2d52:	       c3                   	ret
+    2d53:	       90                   	nop
+
+0000000000002d54 <nel::Optional<U8Buf<256ul> >::Optional(nel::Optional<U8Buf<256ul> >::Phantom<(nel::Optional<U8Buf<256ul> >::Tag)2>, U8Buf<256ul>&&)>:
+        constexpr Optional(Phantom<Tag::SOME> const, T &&v)
+    2d54:	55                   	push   %rbp
+    2d55:	48 89 e5             	mov    %rsp,%rbp
+    2d58:	53                   	push   %rbx
+    2d59:	48 83 ec 18          	sub    $0x18,%rsp
+    2d5d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2d61:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::SOME)
+    2d65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d69:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , some_(forward<T>(v))
+    2d6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d73:	48 8d 58 04          	lea    0x4(%rax),%rbx
+    2d77:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2d7b:	48 89 c7             	mov    %rax,%rdi
+    2d7e:	e8 64 fc ff ff       	call   29e7 <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    2d83:	48 89 c6             	mov    %rax,%rsi
+    2d86:	48 89 df             	mov    %rbx,%rdi
+    2d89:	e8 94 00 00 00       	call   2e22 <nel::Element<U8Buf<256ul> >::Element(U8Buf<256ul>&&)>
+        }
+    2d8e:	90                   	nop
+    2d8f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2d93:	c9                   	leave
+    2d94:	c3                   	ret
+
+0000000000002d95 <U8Buf<256ul>*&& nel::move<U8Buf<256ul>*>(U8Buf<256ul>*&)>:
+constexpr T &&move(T &v)
+    2d95:	55                   	push   %rbp
+    2d96:	48 89 e5             	mov    %rsp,%rbp
+    2d99:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    2d9d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2da1:	5d                   	pop    %rbp
+    2da2:	c3                   	ret
+    2da3:	90                   	nop
+
+0000000000002da4 <nel::SliceIterator<U8Buf<256ul> >::is_done() const>:
+        constexpr bool is_done(void) const
+    2da4:	55                   	push   %rbp
+    2da5:	48 89 e5             	mov    %rsp,%rbp
+    2da8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (b_ == e_);
+    2dac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2db0:	48 8b 10             	mov    (%rax),%rdx
+    2db3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2db7:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2dbb:	48 39 c2             	cmp    %rax,%rdx
+    2dbe:	0f 94 c0             	sete   %al
+        }
+    2dc1:	5d                   	pop    %rbp
+    2dc2:	c3                   	ret
+    2dc3:	90                   	nop
+
+0000000000002dc4 <nel::SliceIterator<U8Buf<256ul> >::dec()>:
+
+        void dec(void)
+    2dc4:	55                   	push   %rbp
+    2dc5:	48 89 e5             	mov    %rsp,%rbp
+    2dc8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            --e_;
+    2dcc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2dd0:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2dd4:	48 8d 90 00 ff ff ff 	lea    -0x100(%rax),%rdx
+    2ddb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ddf:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    2de3:	90                   	nop
+    2de4:	5d                   	pop    %rbp
+    2de5:	c3                   	ret
+
+0000000000002de6 <nel::SliceIterator<U8Buf<256ul> >::deref_back()>:
+
+        OutT deref_back(void)
+    2de6:	55                   	push   %rbp
+    2de7:	48 89 e5             	mov    %rsp,%rbp
+    2dea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return *(e_ - 1);
+    2dee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2df2:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2df6:	48 2d 00 01 00 00    	sub    $0x100,%rax
+        }
+    2dfc:	5d                   	pop    %rbp
+    2dfd:	c3                   	ret
+
+0000000000002dfe <U8Buf<256ul> const*&& nel::move<U8Buf<256ul> const*>(U8Buf<256ul> const*&)>:
+constexpr T &&move(T &v)
+    2dfe:	55                   	push   %rbp
+    2dff:	48 89 e5             	mov    %rsp,%rbp
+    2e02:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    2e06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2e0a:	5d                   	pop    %rbp
+    2e0b:	c3                   	ret
+
+0000000000002e0c <nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::self()>:
+        constexpr ItT &self(void)
+    2e0c:	55                   	push   %rbp
+    2e0d:	48 89 e5             	mov    %rsp,%rbp
+    2e10:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    2e14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e18:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    2e1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2e20:	5d                   	pop    %rbp
+    2e21:	c3                   	ret
+
+0000000000002e22 <nel::Element<U8Buf<256ul> >::Element(U8Buf<256ul>&&)>:
+        constexpr Element(Type &&val)
+    2e22:	55                   	push   %rbp
+    2e23:	48 89 e5             	mov    %rsp,%rbp
+    2e26:	53                   	push   %rbx
+    2e27:	48 83 ec 18          	sub    $0x18,%rsp
+    2e2b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2e2f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : value_(forward<Type>(val))
+    2e33:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    2e37:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2e3b:	48 89 c7             	mov    %rax,%rdi
+    2e3e:	e8 a4 fb ff ff       	call   29e7 <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    2e43:	48 89 c6             	mov    %rax,%rsi
+    2e46:	48 89 df             	mov    %rbx,%rdi
+    2e49:	e8 40 f5 ff ff       	call   238e <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>
+        }
+    2e4e:	90                   	nop
+    2e4f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2e53:	c9                   	leave
+    2e54:	c3                   	ret
+
+0000000000002e55 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    2e55:	55                   	push   %rbp
+    2e56:	48 89 e5             	mov    %rsp,%rbp
+    std::abort();
+    2e59:	e8 e2 e1 ff ff       	call   1040 <abort@plt>
+
+0000000000002e5e <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    2e5e:	55                   	push   %rbp
+    2e5f:	48 89 e5             	mov    %rsp,%rbp
+    2e62:	48 83 ec 10          	sub    $0x10,%rsp
+    2e66:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    2e6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e6e:	48 8b 30             	mov    (%rax),%rsi
+    2e71:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e75:	8b 48 10             	mov    0x10(%rax),%ecx
+    2e78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e7c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2e80:	48 8b 05 d9 41 00 00 	mov    0x41d9(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    2e87:	4c 8d 0d 8d 12 00 00 	lea    0x128d(%rip),%r9        # 411b <nel::sort::ninther_n+0xfb>
+    2e8e:	49 89 f0             	mov    %rsi,%r8
+    2e91:	48 8d 35 89 12 00 00 	lea    0x1289(%rip),%rsi        # 4121 <nel::sort::ninther_n+0x101>
+    2e98:	48 89 c7             	mov    %rax,%rdi
+    2e9b:	b8 00 00 00 00       	mov    $0x0,%eax
+    2ea0:	e8 eb e1 ff ff       	call   1090 <fprintf@plt>
+    abort();
+    2ea5:	e8 ab ff ff ff       	call   2e55 <nel::abort()>
+
+0000000000002eaa <nel::panic(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    2eaa:	55                   	push   %rbp
+    2eab:	48 89 e5             	mov    %rsp,%rbp
+    2eae:	48 83 ec 10          	sub    $0x10,%rsp
+    2eb2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2eb6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    2eba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ebe:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    2ec1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ec5:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    2ec8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ecc:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    2ed0:	48 8b 05 89 41 00 00 	mov    0x4189(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    2ed7:	48 83 ec 08          	sub    $0x8,%rsp
+    2edb:	ff 75 f8             	push   -0x8(%rbp)
+    2ede:	4c 8d 0d 36 12 00 00 	lea    0x1236(%rip),%r9        # 411b <nel::sort::ninther_n+0xfb>
+    2ee5:	49 89 f0             	mov    %rsi,%r8
+    2ee8:	48 8d 35 43 12 00 00 	lea    0x1243(%rip),%rsi        # 4132 <nel::sort::ninther_n+0x112>
+    2eef:	48 89 c7             	mov    %rax,%rdi
+    2ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+    2ef7:	e8 94 e1 ff ff       	call   1090 <fprintf@plt>
+    2efc:	48 83 c4 10          	add    $0x10,%rsp
+            "PANIC",
+            msg);
+    abort();
+    2f00:	e8 50 ff ff ff       	call   2e55 <nel::abort()>
+
+0000000000002f05 <nel::assert_fail(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    2f05:	55                   	push   %rbp
+    2f06:	48 89 e5             	mov    %rsp,%rbp
+    2f09:	48 83 ec 10          	sub    $0x10,%rsp
+    2f0d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2f11:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    2f15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2f19:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    2f1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2f20:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    2f23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2f27:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    2f2b:	48 8b 05 2e 41 00 00 	mov    0x412e(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    2f32:	48 83 ec 08          	sub    $0x8,%rsp
+    2f36:	ff 75 f8             	push   -0x8(%rbp)
+    2f39:	4c 8d 0d 07 12 00 00 	lea    0x1207(%rip),%r9        # 4147 <nel::sort::ninther_n+0x127>
+    2f40:	49 89 f0             	mov    %rsi,%r8
+    2f43:	48 8d 35 e8 11 00 00 	lea    0x11e8(%rip),%rsi        # 4132 <nel::sort::ninther_n+0x112>
+    2f4a:	48 89 c7             	mov    %rax,%rdi
+    2f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+    2f52:	e8 39 e1 ff ff       	call   1090 <fprintf@plt>
+    2f57:	48 83 c4 10          	add    $0x10,%rsp
+            "ASSERT FAIL",
+            msg);
+    abort();
+    2f5b:	e8 f5 fe ff ff       	call   2e55 <nel::abort()>
+
+0000000000002f60 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    2f60:	55                   	push   %rbp
+    2f61:	48 89 e5             	mov    %rsp,%rbp
+    2f64:	48 83 ec 20          	sub    $0x20,%rsp
+    2f68:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2f6c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2f70:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    2f74:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2f78:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2f7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f80:	48 89 ce             	mov    %rcx,%rsi
+    2f83:	48 89 c7             	mov    %rax,%rdi
+    2f86:	e8 15 e1 ff ff       	call   10a0 <memcpy@plt>
+}
+    2f8b:	90                   	nop
+    2f8c:	c9                   	leave
+    2f8d:	c3                   	ret
+
+0000000000002f8e <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    2f8e:	55                   	push   %rbp
+    2f8f:	48 89 e5             	mov    %rsp,%rbp
+    2f92:	48 83 ec 20          	sub    $0x20,%rsp
+    2f96:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2f9a:	89 f0                	mov    %esi,%eax
+    2f9c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2fa0:	88 45 f4             	mov    %al,-0xc(%rbp)
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    2fa3:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    2fa7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2fab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2faf:	89 ce                	mov    %ecx,%esi
+    2fb1:	48 89 c7             	mov    %rax,%rdi
+    2fb4:	e8 a7 e0 ff ff       	call   1060 <memset@plt>
+}
+    2fb9:	90                   	nop
+    2fba:	c9                   	leave
+    2fbb:	c3                   	ret
+
+0000000000002fbc <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    2fbc:	55                   	push   %rbp
+    2fbd:	48 89 e5             	mov    %rsp,%rbp
+    2fc0:	48 83 ec 20          	sub    $0x20,%rsp
+    2fc4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2fc8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2fcc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    //     *id = *is;
+    // }
+    // for (uint8_t *id = d, *is = s, *const e = (d + n); id != e; ++is, ++id) {
+    //     *is = 0xa5;
+    // }
+    copy(d, s, n);
+    2fd0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2fd4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2fd8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2fdc:	48 89 ce             	mov    %rcx,%rsi
+    2fdf:	48 89 c7             	mov    %rax,%rdi
+    2fe2:	e8 79 ff ff ff       	call   2f60 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    poison(s, n);
+    2fe7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2feb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2fef:	48 89 d6             	mov    %rdx,%rsi
+    2ff2:	48 89 c7             	mov    %rax,%rdi
+    2ff5:	e8 60 07 00 00       	call   375a <nel::elem::poison(unsigned char*, unsigned long)>
+}
+    2ffa:	90                   	nop
+    2ffb:	c9                   	leave
+    2ffc:	c3                   	ret
+
+0000000000002ffd <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    2ffd:	55                   	push   %rbp
+    2ffe:	48 89 e5             	mov    %rsp,%rbp
+    3001:	48 83 ec 20          	sub    $0x20,%rsp
+    3005:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3009:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    300d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    std::memmove(d, s, n);
+    3011:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3015:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3019:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    301d:	48 89 ce             	mov    %rcx,%rsi
+    3020:	48 89 c7             	mov    %rax,%rdi
+    3023:	e8 98 e0 ff ff       	call   10c0 <memmove@plt>
+}
+    3028:	90                   	nop
+    3029:	c9                   	leave
+    302a:	c3                   	ret
+
+000000000000302b <nel::elem::wipe(unsigned char*, unsigned long)>:
+
+void wipe(uint8_t *const d, Length const n)
+{
+    302b:	55                   	push   %rbp
+    302c:	48 89 e5             	mov    %rsp,%rbp
+    302f:	48 83 ec 10          	sub    $0x10,%rsp
+    3033:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3037:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    set(d, 0xa5, n);
+    303b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    303f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3043:	be a5 00 00 00       	mov    $0xa5,%esi
+    3048:	48 89 c7             	mov    %rax,%rdi
+    304b:	e8 3e ff ff ff       	call   2f8e <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    3050:	90                   	nop
+    3051:	c9                   	leave
+    3052:	c3                   	ret
+
+0000000000003053 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    3053:	55                   	push   %rbp
+    3054:	48 89 e5             	mov    %rsp,%rbp
+    3057:	48 83 ec 20          	sub    $0x20,%rsp
+    305b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    305f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3063:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    3067:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    306b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    306f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3073:	48 89 ce             	mov    %rcx,%rsi
+    3076:	48 89 c7             	mov    %rax,%rdi
+    3079:	e8 02 e0 ff ff       	call   1080 <memcmp@plt>
+    307e:	85 c0                	test   %eax,%eax
+    3080:	0f 94 c0             	sete   %al
+}
+    3083:	c9                   	leave
+    3084:	c3                   	ret
+
+0000000000003085 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    3085:	55                   	push   %rbp
+    3086:	48 89 e5             	mov    %rsp,%rbp
+    3089:	48 83 ec 20          	sub    $0x20,%rsp
+    308d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3091:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3095:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    3099:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    309d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    30a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30a5:	48 89 ce             	mov    %rcx,%rsi
+    30a8:	48 89 c7             	mov    %rax,%rdi
+    30ab:	e8 d0 df ff ff       	call   1080 <memcmp@plt>
+    30b0:	85 c0                	test   %eax,%eax
+    30b2:	0f 95 c0             	setne  %al
+}
+    30b5:	c9                   	leave
+    30b6:	c3                   	ret
+
+00000000000030b7 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>:
+
+// d[i] = p[i % 16] for i in [0, n), with normal stores:
+// the pattern once, then doubling the filled region.
+static void set_pattern(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    30b7:	       55                   	push   %rbp
+    30b8:	       48 89 e5             	mov    %rsp,%rbp
+    30bb:	       48 83 ec 30          	sub    $0x30,%rsp
+    30bf:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    30c3:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    30c7:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    Length done = (n < 16) ? n : 16;
+    30cb:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    30cf:	       ba 10 00 00 00       	mov    $0x10,%edx
+    30d4:	       48 39 d0             	cmp    %rdx,%rax
+    30d7:	       48 0f 47 c2          	cmova  %rdx,%rax
+    30db:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    copy(d, p, done);
+    30df:	       48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    30e3:	       48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    30e7:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    30eb:	       48 89 ce             	mov    %rcx,%rsi
+    30ee:	       48 89 c7             	mov    %rax,%rdi
+    30f1:	       e8 6a fe ff ff       	call   2f60 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    while (done < n) {
+    30f6:	   /-- eb 3e                	jmp    3136 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x7f>
+        Length const m = (done < n - done) ? done : n - done;
+    30f8:	/--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    30fc:	|  |   48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    3100:	|  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3104:	|  |   48 39 c2             	cmp    %rax,%rdx
+    3107:	|  |   48 0f 46 c2          	cmovbe %rdx,%rax
+    310b:	|  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        copy(d + done, d, m);
+    310f:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3113:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3117:	|  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    311b:	|  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    311f:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3123:	|  |   48 89 c6             	mov    %rax,%rsi
+    3126:	|  |   48 89 cf             	mov    %rcx,%rdi
+    3129:	|  |   e8 32 fe ff ff       	call   2f60 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        done += m;
+    312e:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3132:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+    while (done < n) {
+    3136:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    313a:	|      48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    313e:	\----- 72 b8                	jb     30f8 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x41>
+    }
+}
+    3140:	       90                   	nop
+    3141:	       90                   	nop
+    3142:	       c9                   	leave
+    3143:	       c3                   	ret
+
+0000000000003144 <nel::elem::load16(unsigned char const*)>:
+static constexpr Length streaming_min = 256;
+
+typedef long long int Line16 __attribute__((vector_size(16)));
+
+static inline Line16 load16(uint8_t const *const s)
+{
+    3144:	55                   	push   %rbp
+    3145:	48 89 e5             	mov    %rsp,%rbp
+    3148:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Line16 v;
+    std::memcpy(&v, s, sizeof(v));
+    314c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3150:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    3154:	48 8b 00             	mov    (%rax),%rax
+    3157:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    315b:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    return v;
+    315f:	66 0f 6f 45 f0       	movdqa -0x10(%rbp),%xmm0
+}
+    3164:	5d                   	pop    %rbp
+    3165:	c3                   	ret
+
+0000000000003166 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>:
+
+static inline void stream16(uint8_t *const d, Line16 const &v)
+{
+    3166:	55                   	push   %rbp
+    3167:	48 89 e5             	mov    %rsp,%rbp
+    316a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    316e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    3172:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3176:	66 0f 6f 00          	movdqa (%rax),%xmm0
+    317a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    317e:	66 0f e7 00          	movntdq %xmm0,(%rax)
+}
+    3182:	90                   	nop
+    3183:	5d                   	pop    %rbp
+    3184:	c3                   	ret
+
+0000000000003185 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    3185:	          55                   	push   %rbp
+    3186:	          48 89 e5             	mov    %rsp,%rbp
+    3189:	          48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    318d:	          48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    3191:	          48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    3195:	          48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    if (n < streaming_min) {
+    3199:	          48 81 7d 88 ff 00 00 	cmpq   $0xff,-0x78(%rbp)
+    31a0:	          00 
+    31a1:	      /-- 77 1c                	ja     31bf <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        copy(d, s, n);
+    31a3:	      |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    31a7:	      |   48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    31ab:	      |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    31af:	      |   48 89 ce             	mov    %rcx,%rsi
+    31b2:	      |   48 89 c7             	mov    %rax,%rdi
+    31b5:	      |   e8 a6 fd ff ff       	call   2f60 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        return;
+    31ba:	/-----|-- e9 98 01 00 00       	jmp    3357 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1d2>
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    31bf:	|     \-> 48 8b 45 98          	mov    -0x68(%rbp),%rax
+    31c3:	|         48 f7 d8             	neg    %rax
+    31c6:	|         83 e0 0f             	and    $0xf,%eax
+    31c9:	|         48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    copy(d, s, head);
+    31cd:	|         48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    31d1:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    31d5:	|         48 8b 45 98          	mov    -0x68(%rbp),%rax
+    31d9:	|         48 89 ce             	mov    %rcx,%rsi
+    31dc:	|         48 89 c7             	mov    %rax,%rdi
+    31df:	|         e8 7c fd ff ff       	call   2f60 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    Index i = head;
+    31e4:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    31e8:	|         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    31ec:	|     /-- e9 e1 00 00 00       	jmp    32d2 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        Line16 const a = load16(s + i);
+    31f1:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    31f5:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31f9:	|  |  |   48 01 d0             	add    %rdx,%rax
+    31fc:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    31ff:	|  |  |   e8 40 ff ff ff       	call   3144 <nel::elem::load16(unsigned char const*)>
+    3204:	|  |  |   0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+        Line16 const b = load16(s + i + 16);
+    3208:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    320c:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    3210:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3214:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3217:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    321a:	|  |  |   e8 25 ff ff ff       	call   3144 <nel::elem::load16(unsigned char const*)>
+    321f:	|  |  |   0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+        Line16 const c = load16(s + i + 32);
+    3223:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3227:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    322b:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    322f:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3232:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3235:	|  |  |   e8 0a ff ff ff       	call   3144 <nel::elem::load16(unsigned char const*)>
+    323a:	|  |  |   0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+        Line16 const e = load16(s + i + 48);
+    323e:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3242:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    3246:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    324a:	|  |  |   48 01 d0             	add    %rdx,%rax
+    324d:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3250:	|  |  |   e8 ef fe ff ff       	call   3144 <nel::elem::load16(unsigned char const*)>
+    3255:	|  |  |   0f 29 45 a0          	movaps %xmm0,-0x60(%rbp)
+        stream16(d + i, a);
+    3259:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    325d:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3261:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3264:	|  |  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    3268:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    326b:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    326e:	|  |  |   e8 f3 fe ff ff       	call   3166 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, b);
+    3273:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3277:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    327b:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    327f:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3282:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3286:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3289:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    328c:	|  |  |   e8 d5 fe ff ff       	call   3166 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, c);
+    3291:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3295:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    3299:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    329d:	|  |  |   48 01 c2             	add    %rax,%rdx
+    32a0:	|  |  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    32a4:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    32a7:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    32aa:	|  |  |   e8 b7 fe ff ff       	call   3166 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, e);
+    32af:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32b3:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    32b7:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    32bb:	|  |  |   48 01 c2             	add    %rax,%rdx
+    32be:	|  |  |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    32c2:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    32c5:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    32c8:	|  |  |   e8 99 fe ff ff       	call   3166 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    32cd:	|  |  |   48 83 45 f8 40       	addq   $0x40,-0x8(%rbp)
+    32d2:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32d6:	|  |      48 83 c0 40          	add    $0x40,%rax
+    32da:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    32de:	|  \----- 0f 83 0d ff ff ff    	jae    31f1 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x6c>
+    }
+    for (; i + 16 <= n; i += 16) {
+    32e4:	|     /-- eb 36                	jmp    331c <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x197>
+        stream16(d + i, load16(s + i));
+    32e6:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    32ea:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32ee:	|  |  |   48 01 d0             	add    %rdx,%rax
+    32f1:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    32f4:	|  |  |   e8 4b fe ff ff       	call   3144 <nel::elem::load16(unsigned char const*)>
+    32f9:	|  |  |   0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+    32fd:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    3301:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3305:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3308:	|  |  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    330c:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    330f:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3312:	|  |  |   e8 4f fe ff ff       	call   3166 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    3317:	|  |  |   48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+    331c:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3320:	|  |      48 83 c0 10          	add    $0x10,%rax
+    3324:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    3328:	|  \----- 73 bc                	jae    32e6 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    332a:	|         0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    332d:	|         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3331:	|         48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    3335:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    3339:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    333d:	|         48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    3341:	|         48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+    3345:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3349:	|         48 01 d1             	add    %rdx,%rcx
+    334c:	|         48 89 c2             	mov    %rax,%rdx
+    334f:	|         48 89 cf             	mov    %rcx,%rdi
+    3352:	|         e8 09 fc ff ff       	call   2f60 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+}
+    3357:	\-------> c9                   	leave
+    3358:	          c3                   	ret
+
+0000000000003359 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    3359:	          55                   	push   %rbp
+    335a:	          48 89 e5             	mov    %rsp,%rbp
+    335d:	          48 83 ec 60          	sub    $0x60,%rsp
+    3361:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    3365:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    3369:	          48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    if (n < streaming_min) {
+    336d:	          48 81 7d a8 ff 00 00 	cmpq   $0xff,-0x58(%rbp)
+    3374:	          00 
+    3375:	      /-- 77 1c                	ja     3393 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        set_pattern(d, p, n);
+    3377:	      |   48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    337b:	      |   48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+    337f:	      |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3383:	      |   48 89 ce             	mov    %rcx,%rsi
+    3386:	      |   48 89 c7             	mov    %rax,%rdi
+    3389:	      |   e8 29 fd ff ff       	call   30b7 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>
+    338e:	/-----|-- e9 89 01 00 00       	jmp    351c <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c3>
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    3393:	|     \-> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3397:	|         48 f7 d8             	neg    %rax
+    339a:	|         83 e0 0f             	and    $0xf,%eax
+    339d:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    for (Index i = 0; i < head; ++i) {
+    33a1:	|         48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    33a8:	|         00 
+    33a9:	|     /-- eb 20                	jmp    33cb <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x72>
+        d[i] = p[i];
+    33ab:	|  /--|-> 48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    33af:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33b3:	|  |  |   48 01 d0             	add    %rdx,%rax
+    33b6:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    33ba:	|  |  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    33be:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    33c1:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    33c4:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < head; ++i) {
+    33c6:	|  |  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    33cb:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33cf:	|  |      48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    33d3:	|  \----- 72 d6                	jb     33ab <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x52>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    33d5:	|         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    33dc:	|         00 
+    33dd:	|     /-- eb 2d                	jmp    340c <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xb3>
+        rotated[i] = p[(head + i) % 16];
+    33df:	|  /--|-> 48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    33e3:	|  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    33e7:	|  |  |   48 01 d0             	add    %rdx,%rax
+    33ea:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    33ed:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    33f0:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    33f4:	|  |  |   48 01 d0             	add    %rdx,%rax
+    33f7:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    33fa:	|  |  |   48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    33fe:	|  |  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3402:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    3405:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < 16; ++i) {
+    3407:	|  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    340c:	|  |  \-> 48 83 7d f0 0f       	cmpq   $0xf,-0x10(%rbp)
+    3411:	|  \----- 76 cc                	jbe    33df <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x86>
+    }
+    Line16 const v = load16(rotated);
+    3413:	|         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    3417:	|         48 89 c7             	mov    %rax,%rdi
+    341a:	|         e8 25 fd ff ff       	call   3144 <nel::elem::load16(unsigned char const*)>
+    341f:	|         0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+    Index i = head;
+    3423:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3427:	|         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    342b:	|     /-- eb 79                	jmp    34a6 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        stream16(d + i, v);
+    342d:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    3431:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3435:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3438:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    343c:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    343f:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3442:	|  |  |   e8 1f fd ff ff       	call   3166 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, v);
+    3447:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    344b:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    344f:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3453:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3456:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    345a:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    345d:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3460:	|  |  |   e8 01 fd ff ff       	call   3166 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, v);
+    3465:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3469:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    346d:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3471:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3474:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3478:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    347b:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    347e:	|  |  |   e8 e3 fc ff ff       	call   3166 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, v);
+    3483:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3487:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    348b:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    348f:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3492:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3496:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3499:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    349c:	|  |  |   e8 c5 fc ff ff       	call   3166 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    34a1:	|  |  |   48 83 45 e8 40       	addq   $0x40,-0x18(%rbp)
+    34a6:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34aa:	|  |      48 83 c0 40          	add    $0x40,%rax
+    34ae:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    34b2:	|  \----- 0f 83 75 ff ff ff    	jae    342d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd4>
+    }
+    for (; i + 16 <= n; i += 16) {
+    34b8:	|     /-- eb 1f                	jmp    34d9 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x180>
+        stream16(d + i, v);
+    34ba:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    34be:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34c2:	|  |  |   48 01 c2             	add    %rax,%rdx
+    34c5:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    34c9:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    34cc:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    34cf:	|  |  |   e8 92 fc ff ff       	call   3166 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    34d4:	|  |  |   48 83 45 e8 10       	addq   $0x10,-0x18(%rbp)
+    34d9:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34dd:	|  |      48 83 c0 10          	add    $0x10,%rax
+    34e1:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    34e5:	|  \----- 73 d3                	jae    34ba <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    __builtin_ia32_sfence();
+    34e7:	|         0f ae f8             	sfence
+    for (; i < n; ++i) {
+    34ea:	|     /-- eb 26                	jmp    3512 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1b9>
+        d[i] = p[i % 16];
+    34ec:	|  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34f0:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    34f3:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    34f6:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    34fa:	|  |  |   48 01 d0             	add    %rdx,%rax
+    34fd:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    3501:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3505:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    3508:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    350b:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (; i < n; ++i) {
+    350d:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    3512:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3516:	|  |      48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    351a:	|  \----- 72 d0                	jb     34ec <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x193>
+    }
+}
+    351c:	\-------> c9                   	leave
+    351d:	          c3                   	ret
+
+000000000000351e <nel::offset_of(unsigned char*, unsigned long)>:
+// The payload is the first align boundary leaving room for a Length in front,
+// which holds the offset from the start of the underlying allocation.
+// Malloc alignment is at least alignof(Length), so the payload is at most
+// align bytes in.
+static Length offset_of(uint8_t *const base, Length const align)
+{
+    351e:	55                   	push   %rbp
+    351f:	48 89 e5             	mov    %rsp,%rbp
+    3522:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3526:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    USize const a = reinterpret_cast<USize>(base) + sizeof(Length);
+    352a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    352e:	48 83 c0 08          	add    $0x8,%rax
+    3532:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    3536:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    353a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    353e:	48 01 d0             	add    %rdx,%rax
+    3541:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    3545:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3549:	48 f7 d8             	neg    %rax
+    354c:	48 21 c2             	and    %rax,%rdx
+    354f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3553:	48 29 c2             	sub    %rax,%rdx
+    3556:	48 89 d0             	mov    %rdx,%rax
+}
+    3559:	5d                   	pop    %rbp
+    355a:	c3                   	ret
+
+000000000000355b <nel::offset_field(unsigned char*)>:
+
+static Length &offset_field(uint8_t *const p)
+{
+    355b:	55                   	push   %rbp
+    355c:	48 89 e5             	mov    %rsp,%rbp
+    355f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return reinterpret_cast<Length *>(p)[-1];
+    3563:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3567:	48 83 e8 08          	sub    $0x8,%rax
+}
+    356b:	5d                   	pop    %rbp
+    356c:	c3                   	ret
+
+000000000000356d <nel::free_aligned(void*)>:
+
+void free_aligned(void *const p)
+{
+    356d:	       55                   	push   %rbp
+    356e:	       48 89 e5             	mov    %rsp,%rbp
+    3571:	       48 83 ec 20          	sub    $0x20,%rsp
+    3575:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (p == nullptr) { return; }
+    3579:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    357e:	/----- 74 2e                	je     35ae <nel::free_aligned(void*)+0x41>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    3580:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3584:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    std::free(u8p - offset_field(u8p));
+    3588:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    358c:	|      48 89 c7             	mov    %rax,%rdi
+    358f:	|      e8 c7 ff ff ff       	call   355b <nel::offset_field(unsigned char*)>
+    3594:	|      48 8b 00             	mov    (%rax),%rax
+    3597:	|      48 f7 d8             	neg    %rax
+    359a:	|      48 89 c2             	mov    %rax,%rdx
+    359d:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    35a1:	|      48 01 d0             	add    %rdx,%rax
+    35a4:	|      48 89 c7             	mov    %rax,%rdi
+    35a7:	|      e8 84 da ff ff       	call   1030 <free@plt>
+    35ac:	|  /-- eb 01                	jmp    35af <nel::free_aligned(void*)+0x42>
+    if (p == nullptr) { return; }
+    35ae:	\--|-> 90                   	nop
+}
+    35af:	   \-> c9                   	leave
+    35b0:	       c3                   	ret
+
+00000000000035b1 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    35b1:	             55                   	push   %rbp
+    35b2:	             48 89 e5             	mov    %rsp,%rbp
+    35b5:	             53                   	push   %rbx
+    35b6:	             48 83 ec 78          	sub    $0x78,%rsp
+    35ba:	             48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    35be:	             48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    35c2:	             48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    35c6:	             48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    35ca:	             48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    35ce:	             b9 f3 00 00 00       	mov    $0xf3,%ecx
+    35d3:	             48 8d 15 8e 0b 00 00 	lea    0xb8e(%rip),%rdx        # 4168 <nel::elem::streaming_min+0x8>
+    35da:	             48 8d 35 99 0b 00 00 	lea    0xb99(%rip),%rsi        # 417a <nel::elem::streaming_min+0x1a>
+    35e1:	             48 89 c7             	mov    %rax,%rdi
+    35e4:	             e8 03 e0 ff ff       	call   15ec <nel::Context::Context(char const*, char const*, int)>
+    35e9:	             48 83 7d 90 00       	cmpq   $0x0,-0x70(%rbp)
+    35ee:	      /----- 74 18                	je     3608 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    35f0:	      |      48 8b 45 90          	mov    -0x70(%rbp),%rax
+    35f4:	      |      48 83 e8 01          	sub    $0x1,%rax
+    35f8:	      |      48 23 45 90          	and    -0x70(%rbp),%rax
+    35fc:	      |      48 85 c0             	test   %rax,%rax
+    35ff:	      +----- 75 07                	jne    3608 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    3601:	      |      b8 01 00 00 00       	mov    $0x1,%eax
+    3606:	      |  /-- eb 05                	jmp    360d <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x5c>
+    3608:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    360d:	         \-> 0f b6 c0             	movzbl %al,%eax
+    3610:	             48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    3614:	             48 8d 0d 6f 0b 00 00 	lea    0xb6f(%rip),%rcx        # 418a <nel::elem::streaming_min+0x2a>
+    361b:	             48 89 ce             	mov    %rcx,%rsi
+    361e:	             89 c7                	mov    %eax,%edi
+    3620:	             e8 5b 01 00 00       	call   3780 <nel::assert(bool, char const*, nel::Context const&)>
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    3625:	             48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3629:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    362d:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3632:	      /----- 74 11                	je     3645 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x94>
+    3634:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3638:	      |      48 89 c7             	mov    %rax,%rdi
+    363b:	      |      e8 1b ff ff ff       	call   355b <nel::offset_field(unsigned char*)>
+    3640:	      |      48 8b 00             	mov    (%rax),%rax
+    3643:	      |  /-- eb 05                	jmp    364a <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x99>
+    3645:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    364a:	         \-> 48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    364e:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3653:	      /----- 74 13                	je     3668 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb7>
+    3655:	      |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3659:	      |      48 f7 d8             	neg    %rax
+    365c:	      |      48 89 c2             	mov    %rax,%rdx
+    365f:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3663:	      |      48 01 d0             	add    %rdx,%rax
+    3666:	      |  /-- eb 05                	jmp    366d <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xbc>
+    3668:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    366d:	         \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    3671:	             48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    3675:	             48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3679:	             48 01 c2             	add    %rax,%rdx
+    367c:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3680:	             48 89 d6             	mov    %rdx,%rsi
+    3683:	             48 89 c7             	mov    %rax,%rdi
+    3686:	             e8 25 da ff ff       	call   10b0 <realloc@plt>
+    368b:	             48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if (new_base == nullptr) { return nullptr; }
+    368f:	             48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    3694:	         /-- 75 0a                	jne    36a0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    3696:	         |   b8 00 00 00 00       	mov    $0x0,%eax
+    369b:	/--------|-- e9 85 00 00 00       	jmp    3725 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x174>
+
+    Length const new_offset = offset_of(new_base, align);
+    36a0:	|        \-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    36a4:	|            48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    36a8:	|            48 89 d6             	mov    %rdx,%rsi
+    36ab:	|            48 89 c7             	mov    %rax,%rdi
+    36ae:	|            e8 6b fe ff ff       	call   351e <nel::offset_of(unsigned char*, unsigned long)>
+    36b3:	|            48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    uint8_t *const new_p = new_base + new_offset;
+    36b7:	|            48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    36bb:	|            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    36bf:	|            48 01 d0             	add    %rdx,%rax
+    36c2:	|            48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    if (old_p != nullptr && new_offset != old_offset) {
+    36c6:	|            48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    36cb:	|  /-------- 74 41                	je     370e <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+    36cd:	|  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    36d1:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    36d5:	|  +-------- 74 37                	je     370e <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+    36d7:	|  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    36db:	|  |         48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    36df:	|  |  /----- 73 06                	jae    36e7 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x136>
+    36e1:	|  |  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    36e5:	|  |  |  /-- eb 04                	jmp    36eb <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x13a>
+    36e7:	|  |  \--|-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    36eb:	|  |     \-> 48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        std::memmove(new_p, new_base + old_offset, n);
+    36ef:	|  |         48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    36f3:	|  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    36f7:	|  |         48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    36fb:	|  |         48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    36ff:	|  |         48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    3703:	|  |         48 89 ce             	mov    %rcx,%rsi
+    3706:	|  |         48 89 c7             	mov    %rax,%rdi
+    3709:	|  |         e8 b2 d9 ff ff       	call   10c0 <memmove@plt>
+    }
+    offset_field(new_p) = new_offset;
+    370e:	|  \-------> 48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+    3712:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    3716:	|            48 89 c7             	mov    %rax,%rdi
+    3719:	|            e8 3d fe ff ff       	call   355b <nel::offset_field(unsigned char*)>
+    371e:	|            48 89 18             	mov    %rbx,(%rax)
+    return new_p;
+    3721:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+}
+    3725:	\----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3729:	             c9                   	leave
+    372a:	             c3                   	ret
+
+000000000000372b <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    372b:	55                   	push   %rbp
+    372c:	48 89 e5             	mov    %rsp,%rbp
+    372f:	48 83 ec 10          	sub    $0x10,%rsp
+    3733:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3737:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return realloc_aligned(nullptr, align, 0, size);
+    373b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    373f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3743:	48 89 d1             	mov    %rdx,%rcx
+    3746:	ba 00 00 00 00       	mov    $0x0,%edx
+    374b:	48 89 c6             	mov    %rax,%rsi
+    374e:	bf 00 00 00 00       	mov    $0x0,%edi
+    3753:	e8 59 fe ff ff       	call   35b1 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+}
+    3758:	c9                   	leave
+    3759:	c3                   	ret
+
+000000000000375a <nel::elem::poison(unsigned char*, unsigned long)>:
+{
+    375a:	55                   	push   %rbp
+    375b:	48 89 e5             	mov    %rsp,%rbp
+    375e:	48 83 ec 10          	sub    $0x10,%rsp
+    3762:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3766:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    copy(d, s, n);
+    376a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    376e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3772:	48 89 d6             	mov    %rdx,%rsi
+    3775:	48 89 c7             	mov    %rax,%rdi
+    3778:	e8 ae f8 ff ff       	call   302b <nel::elem::wipe(unsigned char*, unsigned long)>
+}
+    377d:	90                   	nop
+    377e:	c9                   	leave
+    377f:	c3                   	ret
+
+0000000000003780 <nel::assert(bool, char const*, nel::Context const&)>:
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx);
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    3780:	    55                   	push   %rbp
+    3781:	    48 89 e5             	mov    %rsp,%rbp
+    3784:	    48 83 ec 20          	sub    $0x20,%rsp
+    3788:	    89 f8                	mov    %edi,%eax
+    378a:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    378e:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    3792:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { assert_fail(msg, ctx); }
+    3795:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    3799:	    83 f0 01             	xor    $0x1,%eax
+    379c:	    84 c0                	test   %al,%al
+    379e:	/-- 74 13                	je     37b3 <nel::assert(bool, char const*, nel::Context const&)+0x33>
+    37a0:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    37a4:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    37a8:	|   48 89 d6             	mov    %rdx,%rsi
+    37ab:	|   48 89 c7             	mov    %rax,%rdi
+    37ae:	|   e8 52 f7 ff ff       	call   2f05 <nel::assert_fail(char const*, nel::Context const&)>
+}
+    37b3:	\-> 90                   	nop
+    37b4:	    c9                   	leave
+    37b5:	    c3                   	ret
+
+00000000000037b6 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    37b6:	55                   	push   %rbp
+    37b7:	48 89 e5             	mov    %rsp,%rbp
+    37ba:	48 83 ec 10          	sub    $0x10,%rsp
+    37be:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    37c2:	89 f0                	mov    %esi,%eax
+    37c4:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    37c7:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    37cb:	48 8b 15 8e 38 00 00 	mov    0x388e(%rip),%rdx        # 7060 <stderr@GLIBC_2.2.5>
+    37d2:	48 89 d6             	mov    %rdx,%rsi
+    37d5:	89 c7                	mov    %eax,%edi
+    37d7:	e8 94 d8 ff ff       	call   1070 <fputc@plt>
+    return outs;
+    37dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    37e0:	c9                   	leave
+    37e1:	c3                   	ret
+
+00000000000037e2 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    37e2:	55                   	push   %rbp
+    37e3:	48 89 e5             	mov    %rsp,%rbp
+    37e6:	48 83 ec 10          	sub    $0x10,%rsp
+    37ea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    37ee:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    37f2:	48 8b 15 67 38 00 00 	mov    0x3867(%rip),%rdx        # 7060 <stderr@GLIBC_2.2.5>
+    37f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    37fd:	48 89 d6             	mov    %rdx,%rsi
+    3800:	48 89 c7             	mov    %rax,%rdi
+    3803:	e8 48 d8 ff ff       	call   1050 <fputs@plt>
+    return outs;
+    3808:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    380c:	c9                   	leave
+    380d:	c3                   	ret
+
+000000000000380e <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    380e:	55                   	push   %rbp
+    380f:	48 89 e5             	mov    %rsp,%rbp
+    3812:	48 83 ec 10          	sub    $0x10,%rsp
+    3816:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    381a:	89 f0                	mov    %esi,%eax
+    381c:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    381f:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    3823:	48 8b 05 36 38 00 00 	mov    0x3836(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    382a:	48 8d 0d 74 09 00 00 	lea    0x974(%rip),%rcx        # 41a5 <nel::elem::streaming_min+0x45>
+    3831:	48 89 ce             	mov    %rcx,%rsi
+    3834:	48 89 c7             	mov    %rax,%rdi
+    3837:	b8 00 00 00 00       	mov    $0x0,%eax
+    383c:	e8 4f d8 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    3841:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3845:	c9                   	leave
+    3846:	c3                   	ret
+
+0000000000003847 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    3847:	55                   	push   %rbp
+    3848:	48 89 e5             	mov    %rsp,%rbp
+    384b:	48 83 ec 10          	sub    $0x10,%rsp
+    384f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3853:	89 f0                	mov    %esi,%eax
+    3855:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    3859:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    385d:	48 8b 05 fc 37 00 00 	mov    0x37fc(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    3864:	48 8d 0d 3a 09 00 00 	lea    0x93a(%rip),%rcx        # 41a5 <nel::elem::streaming_min+0x45>
+    386b:	48 89 ce             	mov    %rcx,%rsi
+    386e:	48 89 c7             	mov    %rax,%rdi
+    3871:	b8 00 00 00 00       	mov    $0x0,%eax
+    3876:	e8 15 d8 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    387b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    387f:	c9                   	leave
+    3880:	c3                   	ret
+
+0000000000003881 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    3881:	55                   	push   %rbp
+    3882:	48 89 e5             	mov    %rsp,%rbp
+    3885:	48 83 ec 10          	sub    $0x10,%rsp
+    3889:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    388d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    3890:	48 8b 05 c9 37 00 00 	mov    0x37c9(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    3897:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    389a:	48 8d 0d 04 09 00 00 	lea    0x904(%rip),%rcx        # 41a5 <nel::elem::streaming_min+0x45>
+    38a1:	48 89 ce             	mov    %rcx,%rsi
+    38a4:	48 89 c7             	mov    %rax,%rdi
+    38a7:	b8 00 00 00 00       	mov    $0x0,%eax
+    38ac:	e8 df d7 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    38b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    38b5:	c9                   	leave
+    38b6:	c3                   	ret
+
+00000000000038b7 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    38b7:	55                   	push   %rbp
+    38b8:	48 89 e5             	mov    %rsp,%rbp
+    38bb:	48 83 ec 10          	sub    $0x10,%rsp
+    38bf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    38c3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    38c6:	48 8b 05 93 37 00 00 	mov    0x3793(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    38cd:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    38d0:	48 8d 0d ce 08 00 00 	lea    0x8ce(%rip),%rcx        # 41a5 <nel::elem::streaming_min+0x45>
+    38d7:	48 89 ce             	mov    %rcx,%rsi
+    38da:	48 89 c7             	mov    %rax,%rdi
+    38dd:	b8 00 00 00 00       	mov    $0x0,%eax
+    38e2:	e8 a9 d7 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    38e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    38eb:	c9                   	leave
+    38ec:	c3                   	ret
+
+00000000000038ed <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    38ed:	55                   	push   %rbp
+    38ee:	48 89 e5             	mov    %rsp,%rbp
+    38f1:	48 83 ec 10          	sub    $0x10,%rsp
+    38f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    38f9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    38fd:	48 8b 05 5c 37 00 00 	mov    0x375c(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    3904:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3908:	48 8d 0d 99 08 00 00 	lea    0x899(%rip),%rcx        # 41a8 <nel::elem::streaming_min+0x48>
+    390f:	48 89 ce             	mov    %rcx,%rsi
+    3912:	48 89 c7             	mov    %rax,%rdi
+    3915:	b8 00 00 00 00       	mov    $0x0,%eax
+    391a:	e8 71 d7 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    391f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3923:	c9                   	leave
+    3924:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000003928 <_fini>:
+    3928:	48 83 ec 08          	sub    $0x8,%rsp
+    392c:	48 83 c4 08          	add    $0x8,%rsp
+    3930:	c3                   	ret
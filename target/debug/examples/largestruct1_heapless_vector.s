@@ -0,0 +1,3810 @@
+
+target/debug/examples/largestruct1_heapless_vector:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 5f 00 00 	mov    0x5fc5(%rip),%rax        # 6fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 5f 00 00    	push   0x5fca(%rip)        # 6ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 5f 00 00    	jmp    *0x5fcc(%rip)        # 6ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 5f 00 00    	jmp    *0x5fca(%rip)        # 7000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 5f 00 00    	jmp    *0x5fc2(%rip)        # 7008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 5f 00 00    	jmp    *0x5fba(%rip)        # 7010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memset@plt>:
+    1060:	ff 25 b2 5f 00 00    	jmp    *0x5fb2(%rip)        # 7018 <memset@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 5f 00 00    	jmp    *0x5faa(%rip)        # 7020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 5f 00 00    	jmp    *0x5fa2(%rip)        # 7028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 5f 00 00    	jmp    *0x5f9a(%rip)        # 7030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcpy@plt>:
+    10a0:	ff 25 92 5f 00 00    	jmp    *0x5f92(%rip)        # 7038 <memcpy@GLIBC_2.14>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <realloc@plt>:
+    10b0:	ff 25 8a 5f 00 00    	jmp    *0x5f8a(%rip)        # 7040 <realloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <memmove@plt>:
+    10c0:	ff 25 82 5f 00 00    	jmp    *0x5f82(%rip)        # 7048 <memmove@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010d0 <__cxa_finalize@plt>:
+    10d0:	ff 25 0a 5f 00 00    	jmp    *0x5f0a(%rip)        # 6fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10d6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010e0 <_start>:
+    10e0:	31 ed                	xor    %ebp,%ebp
+    10e2:	49 89 d1             	mov    %rdx,%r9
+    10e5:	5e                   	pop    %rsi
+    10e6:	48 89 e2             	mov    %rsp,%rdx
+    10e9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    10ed:	50                   	push   %rax
+    10ee:	54                   	push   %rsp
+    10ef:	45 31 c0             	xor    %r8d,%r8d
+    10f2:	31 c9                	xor    %ecx,%ecx
+    10f4:	48 8d 3d 6b 07 00 00 	lea    0x76b(%rip),%rdi        # 1866 <main>
+    10fb:	ff 15 bf 5e 00 00    	call   *0x5ebf(%rip)        # 6fc0 <__libc_start_main@GLIBC_2.34>
+    1101:	f4                   	hlt
+    1102:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1109:	00 00 00 
+    110c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001110 <deregister_tm_clones>:
+    1110:	    48 8d 3d 49 5f 00 00 	lea    0x5f49(%rip),%rdi        # 7060 <stderr@GLIBC_2.2.5>
+    1117:	    48 8d 05 42 5f 00 00 	lea    0x5f42(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    111e:	    48 39 f8             	cmp    %rdi,%rax
+    1121:	/-- 74 15                	je     1138 <deregister_tm_clones+0x28>
+    1123:	|   48 8b 05 9e 5e 00 00 	mov    0x5e9e(%rip),%rax        # 6fc8 <_ITM_deregisterTMCloneTable@Base>
+    112a:	|   48 85 c0             	test   %rax,%rax
+    112d:	+-- 74 09                	je     1138 <deregister_tm_clones+0x28>
+    112f:	|   ff e0                	jmp    *%rax
+    1131:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1138:	\-> c3                   	ret
+    1139:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001140 <register_tm_clones>:
+    1140:	    48 8d 3d 19 5f 00 00 	lea    0x5f19(%rip),%rdi        # 7060 <stderr@GLIBC_2.2.5>
+    1147:	    48 8d 35 12 5f 00 00 	lea    0x5f12(%rip),%rsi        # 7060 <stderr@GLIBC_2.2.5>
+    114e:	    48 29 fe             	sub    %rdi,%rsi
+    1151:	    48 89 f0             	mov    %rsi,%rax
+    1154:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1158:	    48 c1 f8 03          	sar    $0x3,%rax
+    115c:	    48 01 c6             	add    %rax,%rsi
+    115f:	    48 d1 fe             	sar    %rsi
+    1162:	/-- 74 14                	je     1178 <register_tm_clones+0x38>
+    1164:	|   48 8b 05 6d 5e 00 00 	mov    0x5e6d(%rip),%rax        # 6fd8 <_ITM_registerTMCloneTable@Base>
+    116b:	|   48 85 c0             	test   %rax,%rax
+    116e:	+-- 74 08                	je     1178 <register_tm_clones+0x38>
+    1170:	|   ff e0                	jmp    *%rax
+    1172:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1178:	\-> c3                   	ret
+    1179:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001180 <__do_global_dtors_aux>:
+    1180:	       f3 0f 1e fa          	endbr64
+    1184:	       80 3d dd 5e 00 00 00 	cmpb   $0x0,0x5edd(%rip)        # 7068 <completed.0>
+    118b:	/----- 75 2b                	jne    11b8 <__do_global_dtors_aux+0x38>
+    118d:	|      55                   	push   %rbp
+    118e:	|      48 83 3d 4a 5e 00 00 	cmpq   $0x0,0x5e4a(%rip)        # 6fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1195:	|      00 
+    1196:	|      48 89 e5             	mov    %rsp,%rbp
+    1199:	|  /-- 74 0c                	je     11a7 <__do_global_dtors_aux+0x27>
+    119b:	|  |   48 8b 3d b6 5e 00 00 	mov    0x5eb6(%rip),%rdi        # 7058 <__dso_handle>
+    11a2:	|  |   e8 29 ff ff ff       	call   10d0 <__cxa_finalize@plt>
+    11a7:	|  \-> e8 64 ff ff ff       	call   1110 <deregister_tm_clones>
+    11ac:	|      c6 05 b5 5e 00 00 01 	movb   $0x1,0x5eb5(%rip)        # 7068 <completed.0>
+    11b3:	|      5d                   	pop    %rbp
+    11b4:	|      c3                   	ret
+    11b5:	|      0f 1f 00             	nopl   (%rax)
+    11b8:	\----> c3                   	ret
+    11b9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011c0 <frame_dummy>:
+    11c0:	f3 0f 1e fa          	endbr64
+    11c4:	e9 77 ff ff ff       	jmp    1140 <register_tm_clones>
+
+00000000000011c9 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    11c9:	55                   	push   %rbp
+    11ca:	48 89 e5             	mov    %rsp,%rbp
+    11cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11d1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    11d4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11d9:	5d                   	pop    %rbp
+    11da:	c3                   	ret
+
+00000000000011db <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    11db:	55                   	push   %rbp
+    11dc:	48 89 e5             	mov    %rsp,%rbp
+    11df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11e3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11e6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return -1;
+    11ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11ef:	5d                   	pop    %rbp
+    11f0:	c3                   	ret
+
+00000000000011f1 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    11f1:	55                   	push   %rbp
+    11f2:	48 89 e5             	mov    %rsp,%rbp
+    11f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11f9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11fc:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    return -1;
+    11ff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1204:	5d                   	pop    %rbp
+    1205:	c3                   	ret
+
+0000000000001206 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    1206:	55                   	push   %rbp
+    1207:	48 89 e5             	mov    %rsp,%rbp
+    120a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    120e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1211:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    1214:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    return -1;
+    1217:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    121c:	5d                   	pop    %rbp
+    121d:	c3                   	ret
+
+000000000000121e <_read_r>:
+int _read_r(struct _reent *, int) {
+    121e:	55                   	push   %rbp
+    121f:	48 89 e5             	mov    %rsp,%rbp
+    1222:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1226:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1229:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    122e:	5d                   	pop    %rbp
+    122f:	c3                   	ret
+
+0000000000001230 <_write_r>:
+int _write_r(struct _reent *, int, char *, int) {
+    1230:	55                   	push   %rbp
+    1231:	48 89 e5             	mov    %rsp,%rbp
+    1234:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1238:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    123b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    123f:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+    return -1;
+    1242:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1247:	5d                   	pop    %rbp
+    1248:	c3                   	ret
+
+0000000000001249 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    1249:	55                   	push   %rbp
+    124a:	48 89 e5             	mov    %rsp,%rbp
+    124d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return -1;
+    1251:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1256:	5d                   	pop    %rbp
+    1257:	c3                   	ret
+
+0000000000001258 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1258:	55                   	push   %rbp
+    1259:	48 89 e5             	mov    %rsp,%rbp
+    125c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1260:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1263:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1268:	5d                   	pop    %rbp
+    1269:	c3                   	ret
+
+000000000000126a <ex1()>:
+#include "libnosys_stubs.cx"
+
+typedef nel::heapless::Vector<U8Buf<256>, 10> Vec1;
+
+void ex1()
+{
+    126a:	55                   	push   %rbp
+    126b:	48 89 e5             	mov    %rsp,%rbp
+    126e:	48 81 ec 10 0a 00 00 	sub    $0xa10,%rsp
+    Vec1 vec1 = Vec1::empty();
+    1275:	48 8d 95 f0 f5 ff ff 	lea    -0xa10(%rbp),%rdx
+    127c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1281:	b9 41 01 00 00       	mov    $0x141,%ecx
+    1286:	48 89 d7             	mov    %rdx,%rdi
+    1289:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    nel::log << vec1 << '\n';
+    128c:	48 8d 85 f0 f5 ff ff 	lea    -0xa10(%rbp),%rax
+    1293:	48 89 c6             	mov    %rax,%rsi
+    1296:	48 8d 05 cc 5d 00 00 	lea    0x5dcc(%rip),%rax        # 7069 <nel::log>
+    129d:	48 89 c7             	mov    %rax,%rdi
+    12a0:	e8 87 09 00 00       	call   1c2c <nel::heapless::operator<<(nel::Log&, nel::heapless::Vector<U8Buf<256ul>, 10ul> const&)>
+    12a5:	be 0a 00 00 00       	mov    $0xa,%esi
+    12aa:	48 89 c7             	mov    %rax,%rdi
+    12ad:	e8 3e 20 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+}
+    12b2:	48 8d 85 f0 f5 ff ff 	lea    -0xa10(%rbp),%rax
+    12b9:	48 89 c7             	mov    %rax,%rdi
+    12bc:	e8 dd 08 00 00       	call   1b9e <nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()>
+    12c1:	c9                   	leave
+    12c2:	c3                   	ret
+
+00000000000012c3 <ex2()>:
+
+void ex2()
+{
+    12c3:	55                   	push   %rbp
+    12c4:	48 89 e5             	mov    %rsp,%rbp
+    12c7:	48 81 ec 40 0c 00 00 	sub    $0xc40,%rsp
+    Vec1 vec1 = Vec1::empty();
+    12ce:	48 8d 95 c0 f4 ff ff 	lea    -0xb40(%rbp),%rdx
+    12d5:	b8 00 00 00 00       	mov    $0x0,%eax
+    12da:	b9 41 01 00 00       	mov    $0x141,%ecx
+    12df:	48 89 d7             	mov    %rdx,%rdi
+    12e2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    U8Buf<256> v = U8Buf<256>((uint8_t)0x66);
+    12e5:	48 8d 85 c0 f3 ff ff 	lea    -0xc40(%rbp),%rax
+    12ec:	be 66 00 00 00       	mov    $0x66,%esi
+    12f1:	48 89 c7             	mov    %rax,%rdi
+    12f4:	e8 73 07 00 00       	call   1a6c <U8Buf<256ul>::U8Buf(unsigned char)>
+    vec1.push(nel::move(v)).is_ok();
+    12f9:	48 8d 85 c0 f3 ff ff 	lea    -0xc40(%rbp),%rax
+    1300:	48 89 c7             	mov    %rax,%rdi
+    1303:	e8 03 0a 00 00       	call   1d0b <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    1308:	48 89 c2             	mov    %rax,%rdx
+    130b:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    1312:	48 8d 8d c0 f4 ff ff 	lea    -0xb40(%rbp),%rcx
+    1319:	48 89 ce             	mov    %rcx,%rsi
+    131c:	48 89 c7             	mov    %rax,%rdi
+    131f:	e8 f6 09 00 00       	call   1d1a <nel::heapless::Vector<U8Buf<256ul>, 10ul>::push(U8Buf<256ul>&&)>
+    1324:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1328:	b9 18 00 00 00       	mov    $0x18,%ecx
+    132d:	48 8d 15 f4 2c 00 00 	lea    0x2cf4(%rip),%rdx        # 4028 <nel::sort::ninther_n+0x8>
+    1334:	48 8d 35 16 2d 00 00 	lea    0x2d16(%rip),%rsi        # 4051 <nel::sort::ninther_n+0x31>
+    133b:	48 89 c7             	mov    %rax,%rdi
+    133e:	e8 d5 06 00 00       	call   1a18 <nel::Context::Context(char const*, char const*, int)>
+    1343:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1347:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    134e:	48 89 d6             	mov    %rdx,%rsi
+    1351:	48 89 c7             	mov    %rax,%rdi
+    1354:	e8 29 0b 00 00       	call   1e82 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    1359:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    1360:	48 89 c7             	mov    %rax,%rdi
+    1363:	e8 84 0a 00 00       	call   1dec <nel::Result<void, U8Buf<256ul> >::~Result()>
+
+    nel::log << vec1 << '\n';
+    1368:	48 8d 85 c0 f4 ff ff 	lea    -0xb40(%rbp),%rax
+    136f:	48 89 c6             	mov    %rax,%rsi
+    1372:	48 8d 05 f0 5c 00 00 	lea    0x5cf0(%rip),%rax        # 7069 <nel::log>
+    1379:	48 89 c7             	mov    %rax,%rdi
+    137c:	e8 ab 08 00 00       	call   1c2c <nel::heapless::operator<<(nel::Log&, nel::heapless::Vector<U8Buf<256ul>, 10ul> const&)>
+    1381:	be 0a 00 00 00       	mov    $0xa,%esi
+    1386:	48 89 c7             	mov    %rax,%rdi
+    1389:	e8 62 1f 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+}
+    138e:	48 8d 85 c0 f3 ff ff 	lea    -0xc40(%rbp),%rax
+    1395:	48 89 c7             	mov    %rax,%rdi
+    1398:	e8 49 09 00 00       	call   1ce6 <U8Buf<256ul>::~U8Buf()>
+    139d:	48 8d 85 c0 f4 ff ff 	lea    -0xb40(%rbp),%rax
+    13a4:	48 89 c7             	mov    %rax,%rdi
+    13a7:	e8 f2 07 00 00       	call   1b9e <nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()>
+    13ac:	c9                   	leave
+    13ad:	c3                   	ret
+
+00000000000013ae <ex3()>:
+
+void ex3()
+{
+    13ae:	55                   	push   %rbp
+    13af:	48 89 e5             	mov    %rsp,%rbp
+    13b2:	48 81 ec 40 0c 00 00 	sub    $0xc40,%rsp
+    Vec1 vec1 = Vec1::empty();
+    13b9:	48 8d 95 c0 f3 ff ff 	lea    -0xc40(%rbp),%rdx
+    13c0:	b8 00 00 00 00       	mov    $0x0,%eax
+    13c5:	b9 41 01 00 00       	mov    $0x141,%ecx
+    13ca:	48 89 d7             	mov    %rdx,%rdi
+    13cd:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vec1.push((uint8_t)0x67).is_ok();
+    13d0:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    13d7:	be 67 00 00 00       	mov    $0x67,%esi
+    13dc:	48 89 c7             	mov    %rax,%rdi
+    13df:	e8 88 06 00 00       	call   1a6c <U8Buf<256ul>::U8Buf(unsigned char)>
+    13e4:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+    13eb:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+    13f2:	48 8d 8d c0 f3 ff ff 	lea    -0xc40(%rbp),%rcx
+    13f9:	48 89 ce             	mov    %rcx,%rsi
+    13fc:	48 89 c7             	mov    %rax,%rdi
+    13ff:	e8 16 09 00 00       	call   1d1a <nel::heapless::Vector<U8Buf<256ul>, 10ul>::push(U8Buf<256ul>&&)>
+    1404:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1408:	b9 21 00 00 00       	mov    $0x21,%ecx
+    140d:	48 8d 15 14 2c 00 00 	lea    0x2c14(%rip),%rdx        # 4028 <nel::sort::ninther_n+0x8>
+    1414:	48 8d 35 3a 2c 00 00 	lea    0x2c3a(%rip),%rsi        # 4055 <nel::sort::ninther_n+0x35>
+    141b:	48 89 c7             	mov    %rax,%rdi
+    141e:	e8 f5 05 00 00       	call   1a18 <nel::Context::Context(char const*, char const*, int)>
+    1423:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1427:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+    142e:	48 89 d6             	mov    %rdx,%rsi
+    1431:	48 89 c7             	mov    %rax,%rdi
+    1434:	e8 49 0a 00 00       	call   1e82 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    1439:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+    1440:	48 89 c7             	mov    %rax,%rdi
+    1443:	e8 a4 09 00 00       	call   1dec <nel::Result<void, U8Buf<256ul> >::~Result()>
+    1448:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+    144f:	48 89 c7             	mov    %rax,%rdi
+    1452:	e8 8f 08 00 00       	call   1ce6 <U8Buf<256ul>::~U8Buf()>
+
+    nel::log << vec1 << '\n';
+    1457:	48 8d 85 c0 f3 ff ff 	lea    -0xc40(%rbp),%rax
+    145e:	48 89 c6             	mov    %rax,%rsi
+    1461:	48 8d 05 01 5c 00 00 	lea    0x5c01(%rip),%rax        # 7069 <nel::log>
+    1468:	48 89 c7             	mov    %rax,%rdi
+    146b:	e8 bc 07 00 00       	call   1c2c <nel::heapless::operator<<(nel::Log&, nel::heapless::Vector<U8Buf<256ul>, 10ul> const&)>
+    1470:	be 0a 00 00 00       	mov    $0xa,%esi
+    1475:	48 89 c7             	mov    %rax,%rdi
+    1478:	e8 73 1e 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+}
+    147d:	48 8d 85 c0 f3 ff ff 	lea    -0xc40(%rbp),%rax
+    1484:	48 89 c7             	mov    %rax,%rdi
+    1487:	e8 12 07 00 00       	call   1b9e <nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()>
+    148c:	c9                   	leave
+    148d:	c3                   	ret
+
+000000000000148e <ex42()>:
+    }
+}
+#endif
+
+void ex42()
+{
+    148e:	       55                   	push   %rbp
+    148f:	       48 89 e5             	mov    %rsp,%rbp
+    1492:	       48 81 ec c0 11 00 00 	sub    $0x11c0,%rsp
+    Vec1 vec1 = Vec1::empty();
+    1499:	       48 8d 95 50 ee ff ff 	lea    -0x11b0(%rbp),%rdx
+    14a0:	       b8 00 00 00 00       	mov    $0x0,%eax
+    14a5:	       b9 41 01 00 00       	mov    $0x141,%ecx
+    14aa:	       48 89 d7             	mov    %rdx,%rdi
+    14ad:	       f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vec1.push((uint8_t)0x67).is_ok();
+    14b0:	       48 8d 85 70 f9 ff ff 	lea    -0x690(%rbp),%rax
+    14b7:	       be 67 00 00 00       	mov    $0x67,%esi
+    14bc:	       48 89 c7             	mov    %rax,%rdi
+    14bf:	       e8 a8 05 00 00       	call   1a6c <U8Buf<256ul>::U8Buf(unsigned char)>
+    14c4:	       48 8d 85 60 f8 ff ff 	lea    -0x7a0(%rbp),%rax
+    14cb:	       48 8d 95 70 f9 ff ff 	lea    -0x690(%rbp),%rdx
+    14d2:	       48 8d 8d 50 ee ff ff 	lea    -0x11b0(%rbp),%rcx
+    14d9:	       48 89 ce             	mov    %rcx,%rsi
+    14dc:	       48 89 c7             	mov    %rax,%rdi
+    14df:	       e8 36 08 00 00       	call   1d1a <nel::heapless::Vector<U8Buf<256ul>, 10ul>::push(U8Buf<256ul>&&)>
+    14e4:	       48 8d 85 70 fa ff ff 	lea    -0x590(%rbp),%rax
+    14eb:	       b9 48 00 00 00       	mov    $0x48,%ecx
+    14f0:	       48 8d 15 31 2b 00 00 	lea    0x2b31(%rip),%rdx        # 4028 <nel::sort::ninther_n+0x8>
+    14f7:	       48 8d 35 5b 2b 00 00 	lea    0x2b5b(%rip),%rsi        # 4059 <nel::sort::ninther_n+0x39>
+    14fe:	       48 89 c7             	mov    %rax,%rdi
+    1501:	       e8 12 05 00 00       	call   1a18 <nel::Context::Context(char const*, char const*, int)>
+    1506:	       48 8d 95 70 fa ff ff 	lea    -0x590(%rbp),%rdx
+    150d:	       48 8d 85 60 f8 ff ff 	lea    -0x7a0(%rbp),%rax
+    1514:	       48 89 d6             	mov    %rdx,%rsi
+    1517:	       48 89 c7             	mov    %rax,%rdi
+    151a:	       e8 63 09 00 00       	call   1e82 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    151f:	       48 8d 85 60 f8 ff ff 	lea    -0x7a0(%rbp),%rax
+    1526:	       48 89 c7             	mov    %rax,%rdi
+    1529:	       e8 be 08 00 00       	call   1dec <nel::Result<void, U8Buf<256ul> >::~Result()>
+    152e:	       48 8d 85 70 f9 ff ff 	lea    -0x690(%rbp),%rax
+    1535:	       48 89 c7             	mov    %rax,%rdi
+    1538:	       e8 a9 07 00 00       	call   1ce6 <U8Buf<256ul>::~U8Buf()>
+    vec1.push((uint8_t)0x68).is_ok();
+    153d:	       48 8d 85 a0 fb ff ff 	lea    -0x460(%rbp),%rax
+    1544:	       be 68 00 00 00       	mov    $0x68,%esi
+    1549:	       48 89 c7             	mov    %rax,%rdi
+    154c:	       e8 1b 05 00 00       	call   1a6c <U8Buf<256ul>::U8Buf(unsigned char)>
+    1551:	       48 8d 85 90 fa ff ff 	lea    -0x570(%rbp),%rax
+    1558:	       48 8d 95 a0 fb ff ff 	lea    -0x460(%rbp),%rdx
+    155f:	       48 8d 8d 50 ee ff ff 	lea    -0x11b0(%rbp),%rcx
+    1566:	       48 89 ce             	mov    %rcx,%rsi
+    1569:	       48 89 c7             	mov    %rax,%rdi
+    156c:	       e8 a9 07 00 00       	call   1d1a <nel::heapless::Vector<U8Buf<256ul>, 10ul>::push(U8Buf<256ul>&&)>
+    1571:	       48 8d 85 a0 fc ff ff 	lea    -0x360(%rbp),%rax
+    1578:	       b9 49 00 00 00       	mov    $0x49,%ecx
+    157d:	       48 8d 15 a4 2a 00 00 	lea    0x2aa4(%rip),%rdx        # 4028 <nel::sort::ninther_n+0x8>
+    1584:	       48 8d 35 ce 2a 00 00 	lea    0x2ace(%rip),%rsi        # 4059 <nel::sort::ninther_n+0x39>
+    158b:	       48 89 c7             	mov    %rax,%rdi
+    158e:	       e8 85 04 00 00       	call   1a18 <nel::Context::Context(char const*, char const*, int)>
+    1593:	       48 8d 95 a0 fc ff ff 	lea    -0x360(%rbp),%rdx
+    159a:	       48 8d 85 90 fa ff ff 	lea    -0x570(%rbp),%rax
+    15a1:	       48 89 d6             	mov    %rdx,%rsi
+    15a4:	       48 89 c7             	mov    %rax,%rdi
+    15a7:	       e8 d6 08 00 00       	call   1e82 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    15ac:	       48 8d 85 90 fa ff ff 	lea    -0x570(%rbp),%rax
+    15b3:	       48 89 c7             	mov    %rax,%rdi
+    15b6:	       e8 31 08 00 00       	call   1dec <nel::Result<void, U8Buf<256ul> >::~Result()>
+    15bb:	       48 8d 85 a0 fb ff ff 	lea    -0x460(%rbp),%rax
+    15c2:	       48 89 c7             	mov    %rax,%rdi
+    15c5:	       e8 1c 07 00 00       	call   1ce6 <U8Buf<256ul>::~U8Buf()>
+    vec1.push((uint8_t)0x69).is_ok();
+    15ca:	       48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+    15d1:	       be 69 00 00 00       	mov    $0x69,%esi
+    15d6:	       48 89 c7             	mov    %rax,%rdi
+    15d9:	       e8 8e 04 00 00       	call   1a6c <U8Buf<256ul>::U8Buf(unsigned char)>
+    15de:	       48 8d 85 c0 fc ff ff 	lea    -0x340(%rbp),%rax
+    15e5:	       48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+    15ec:	       48 8d 8d 50 ee ff ff 	lea    -0x11b0(%rbp),%rcx
+    15f3:	       48 89 ce             	mov    %rcx,%rsi
+    15f6:	       48 89 c7             	mov    %rax,%rdi
+    15f9:	       e8 1c 07 00 00       	call   1d1a <nel::heapless::Vector<U8Buf<256ul>, 10ul>::push(U8Buf<256ul>&&)>
+    15fe:	       48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    1605:	       b9 4a 00 00 00       	mov    $0x4a,%ecx
+    160a:	       48 8d 15 17 2a 00 00 	lea    0x2a17(%rip),%rdx        # 4028 <nel::sort::ninther_n+0x8>
+    1611:	       48 8d 35 41 2a 00 00 	lea    0x2a41(%rip),%rsi        # 4059 <nel::sort::ninther_n+0x39>
+    1618:	       48 89 c7             	mov    %rax,%rdi
+    161b:	       e8 f8 03 00 00       	call   1a18 <nel::Context::Context(char const*, char const*, int)>
+    1620:	       48 8d 95 d0 fe ff ff 	lea    -0x130(%rbp),%rdx
+    1627:	       48 8d 85 c0 fc ff ff 	lea    -0x340(%rbp),%rax
+    162e:	       48 89 d6             	mov    %rdx,%rsi
+    1631:	       48 89 c7             	mov    %rax,%rdi
+    1634:	       e8 49 08 00 00       	call   1e82 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    1639:	       48 8d 85 c0 fc ff ff 	lea    -0x340(%rbp),%rax
+    1640:	       48 89 c7             	mov    %rax,%rdi
+    1643:	       e8 a4 07 00 00       	call   1dec <nel::Result<void, U8Buf<256ul> >::~Result()>
+    1648:	       48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+    164f:	       48 89 c7             	mov    %rax,%rdi
+    1652:	       e8 8f 06 00 00       	call   1ce6 <U8Buf<256ul>::~U8Buf()>
+
+    vec1.pop();
+    1657:	       48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+    165e:	       48 8d 95 50 ee ff ff 	lea    -0x11b0(%rbp),%rdx
+    1665:	       48 89 d6             	mov    %rdx,%rsi
+    1668:	       48 89 c7             	mov    %rax,%rdi
+    166b:	       e8 3c 08 00 00       	call   1eac <nel::heapless::Vector<U8Buf<256ul>, 10ul>::pop()>
+    1670:	       48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+    1677:	       48 89 c7             	mov    %rax,%rdi
+    167a:	       e8 a9 08 00 00       	call   1f28 <nel::Optional<U8Buf<256ul> >::~Optional()>
+
+    auto it = vec1.iter();
+    167f:	       48 8d 85 40 ee ff ff 	lea    -0x11c0(%rbp),%rax
+    1686:	       48 8d 95 50 ee ff ff 	lea    -0x11b0(%rbp),%rdx
+    168d:	       48 89 d6             	mov    %rdx,%rsi
+    1690:	       48 89 c7             	mov    %rax,%rdi
+    1693:	       e8 00 04 00 00       	call   1a98 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::iter()>
+    for (; !it.is_done(); it.inc()) {
+    1698:	   /-- eb 45                	jmp    16df <ex42()+0x251>
+        auto &v = it.deref();
+    169a:	/--|-> 48 8d 85 40 ee ff ff 	lea    -0x11c0(%rbp),%rax
+    16a1:	|  |   48 89 c7             	mov    %rax,%rdi
+    16a4:	|  |   e8 8b 09 00 00       	call   2034 <nel::SliceIterator<U8Buf<256ul> >::deref()>
+    16a9:	|  |   48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        nel::log << v << '\n';
+    16ad:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16b1:	|  |   48 89 c6             	mov    %rax,%rsi
+    16b4:	|  |   48 8d 05 ae 59 00 00 	lea    0x59ae(%rip),%rax        # 7069 <nel::log>
+    16bb:	|  |   48 89 c7             	mov    %rax,%rdi
+    16be:	|  |   e8 82 09 00 00       	call   2045 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    16c3:	|  |   be 0a 00 00 00       	mov    $0xa,%esi
+    16c8:	|  |   48 89 c7             	mov    %rax,%rdi
+    16cb:	|  |   e8 20 1c 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+    for (; !it.is_done(); it.inc()) {
+    16d0:	|  |   48 8d 85 40 ee ff ff 	lea    -0x11c0(%rbp),%rax
+    16d7:	|  |   48 89 c7             	mov    %rax,%rdi
+    16da:	|  |   e8 35 09 00 00       	call   2014 <nel::SliceIterator<U8Buf<256ul> >::inc()>
+    16df:	|  \-> 48 8d 85 40 ee ff ff 	lea    -0x11c0(%rbp),%rax
+    16e6:	|      48 89 c7             	mov    %rax,%rdi
+    16e9:	|      e8 70 04 00 00       	call   1b5e <nel::SliceIterator<U8Buf<256ul> >::is_done() const>
+    16ee:	|      83 f0 01             	xor    $0x1,%eax
+    16f1:	|      84 c0                	test   %al,%al
+    16f3:	\----- 75 a5                	jne    169a <ex42()+0x20c>
+    }
+}
+    16f5:	       48 8d 85 50 ee ff ff 	lea    -0x11b0(%rbp),%rax
+    16fc:	       48 89 c7             	mov    %rax,%rdi
+    16ff:	       e8 9a 04 00 00       	call   1b9e <nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()>
+    1704:	       c9                   	leave
+    1705:	       c3                   	ret
+
+0000000000001706 <ex52()>:
+    }
+}
+#endif
+
+void ex52()
+{
+    1706:	       55                   	push   %rbp
+    1707:	       48 89 e5             	mov    %rsp,%rbp
+    170a:	       48 81 ec 80 0c 00 00 	sub    $0xc80,%rsp
+    Vec1 vec1 = Vec1::empty();
+    1711:	       48 8d 95 a0 f3 ff ff 	lea    -0xc60(%rbp),%rdx
+    1718:	       b8 00 00 00 00       	mov    $0x0,%eax
+    171d:	       b9 41 01 00 00       	mov    $0x141,%ecx
+    1722:	       48 89 d7             	mov    %rdx,%rdi
+    1725:	       f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    for (uint8_t f = 1; f < 10; ++f) {
+    1728:	       c6 45 ff 01          	movb   $0x1,-0x1(%rbp)
+    172c:	/----- e9 8c 00 00 00       	jmp    17bd <ex52()+0xb7>
+        vec1.push(f).is_ok();
+    1731:	|  /-> 0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+    1735:	|  |   48 8d 85 c0 fe ff ff 	lea    -0x140(%rbp),%rax
+    173c:	|  |   89 d6                	mov    %edx,%esi
+    173e:	|  |   48 89 c7             	mov    %rax,%rdi
+    1741:	|  |   e8 26 03 00 00       	call   1a6c <U8Buf<256ul>::U8Buf(unsigned char)>
+    1746:	|  |   48 8d 85 b0 fd ff ff 	lea    -0x250(%rbp),%rax
+    174d:	|  |   48 8d 95 c0 fe ff ff 	lea    -0x140(%rbp),%rdx
+    1754:	|  |   48 8d 8d a0 f3 ff ff 	lea    -0xc60(%rbp),%rcx
+    175b:	|  |   48 89 ce             	mov    %rcx,%rsi
+    175e:	|  |   48 89 c7             	mov    %rax,%rdi
+    1761:	|  |   e8 b4 05 00 00       	call   1d1a <nel::heapless::Vector<U8Buf<256ul>, 10ul>::push(U8Buf<256ul>&&)>
+    1766:	|  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    176a:	|  |   b9 76 00 00 00       	mov    $0x76,%ecx
+    176f:	|  |   48 8d 15 b2 28 00 00 	lea    0x28b2(%rip),%rdx        # 4028 <nel::sort::ninther_n+0x8>
+    1776:	|  |   48 8d 35 e1 28 00 00 	lea    0x28e1(%rip),%rsi        # 405e <nel::sort::ninther_n+0x3e>
+    177d:	|  |   48 89 c7             	mov    %rax,%rdi
+    1780:	|  |   e8 93 02 00 00       	call   1a18 <nel::Context::Context(char const*, char const*, int)>
+    1785:	|  |   48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    1789:	|  |   48 8d 85 b0 fd ff ff 	lea    -0x250(%rbp),%rax
+    1790:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1793:	|  |   48 89 c7             	mov    %rax,%rdi
+    1796:	|  |   e8 e7 06 00 00       	call   1e82 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    179b:	|  |   48 8d 85 b0 fd ff ff 	lea    -0x250(%rbp),%rax
+    17a2:	|  |   48 89 c7             	mov    %rax,%rdi
+    17a5:	|  |   e8 42 06 00 00       	call   1dec <nel::Result<void, U8Buf<256ul> >::~Result()>
+    17aa:	|  |   48 8d 85 c0 fe ff ff 	lea    -0x140(%rbp),%rax
+    17b1:	|  |   48 89 c7             	mov    %rax,%rdi
+    17b4:	|  |   e8 2d 05 00 00       	call   1ce6 <U8Buf<256ul>::~U8Buf()>
+    for (uint8_t f = 1; f < 10; ++f) {
+    17b9:	|  |   80 45 ff 01          	addb   $0x1,-0x1(%rbp)
+    17bd:	\--|-> 80 7d ff 09          	cmpb   $0x9,-0x1(%rbp)
+    17c1:	   \-- 0f 86 6a ff ff ff    	jbe    1731 <ex52()+0x2b>
+    }
+
+    auto it = vec1.iter().first_n(3);
+    17c7:	       48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    17cb:	       48 8d 95 a0 f3 ff ff 	lea    -0xc60(%rbp),%rdx
+    17d2:	       48 89 d6             	mov    %rdx,%rsi
+    17d5:	       48 89 c7             	mov    %rax,%rdi
+    17d8:	       e8 bb 02 00 00       	call   1a98 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::iter()>
+    17dd:	       48 8d 85 80 f3 ff ff 	lea    -0xc80(%rbp),%rax
+    17e4:	       48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+    17e8:	       ba 03 00 00 00       	mov    $0x3,%edx
+    17ed:	       48 89 ce             	mov    %rcx,%rsi
+    17f0:	       48 89 c7             	mov    %rax,%rdi
+    17f3:	       e8 42 09 00 00       	call   213a <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::first_n(unsigned long)>
+    for (; !it.is_done(); it.inc()) {
+    17f8:	   /-- eb 45                	jmp    183f <ex52()+0x139>
+        auto &v = it.deref();
+    17fa:	/--|-> 48 8d 85 80 f3 ff ff 	lea    -0xc80(%rbp),%rax
+    1801:	|  |   48 89 c7             	mov    %rax,%rdi
+    1804:	|  |   e8 a5 09 00 00       	call   21ae <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::deref()>
+    1809:	|  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        nel::log << v << '\n';
+    180d:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1811:	|  |   48 89 c6             	mov    %rax,%rsi
+    1814:	|  |   48 8d 05 4e 58 00 00 	lea    0x584e(%rip),%rax        # 7069 <nel::log>
+    181b:	|  |   48 89 c7             	mov    %rax,%rdi
+    181e:	|  |   e8 22 08 00 00       	call   2045 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    1823:	|  |   be 0a 00 00 00       	mov    $0xa,%esi
+    1828:	|  |   48 89 c7             	mov    %rax,%rdi
+    182b:	|  |   e8 c0 1a 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+    for (; !it.is_done(); it.inc()) {
+    1830:	|  |   48 8d 85 80 f3 ff ff 	lea    -0xc80(%rbp),%rax
+    1837:	|  |   48 89 c7             	mov    %rax,%rdi
+    183a:	|  |   e8 3f 09 00 00       	call   217e <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::inc()>
+    183f:	|  \-> 48 8d 85 80 f3 ff ff 	lea    -0xc80(%rbp),%rax
+    1846:	|      48 89 c7             	mov    %rax,%rdi
+    1849:	|      e8 30 03 00 00       	call   1b7e <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::is_done() const>
+    184e:	|      83 f0 01             	xor    $0x1,%eax
+    1851:	|      84 c0                	test   %al,%al
+    1853:	\----- 75 a5                	jne    17fa <ex52()+0xf4>
+    }
+}
+    1855:	       48 8d 85 a0 f3 ff ff 	lea    -0xc60(%rbp),%rax
+    185c:	       48 89 c7             	mov    %rax,%rdi
+    185f:	       e8 3a 03 00 00       	call   1b9e <nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()>
+    1864:	       c9                   	leave
+    1865:	       c3                   	ret
+
+0000000000001866 <main>:
+
+int main()
+{
+    1866:	55                   	push   %rbp
+    1867:	48 89 e5             	mov    %rsp,%rbp
+    nel::log << "ex1:b" << '\n';
+    186a:	48 8d 05 f2 27 00 00 	lea    0x27f2(%rip),%rax        # 4063 <nel::sort::ninther_n+0x43>
+    1871:	48 89 c6             	mov    %rax,%rsi
+    1874:	48 8d 05 ee 57 00 00 	lea    0x57ee(%rip),%rax        # 7069 <nel::log>
+    187b:	48 89 c7             	mov    %rax,%rdi
+    187e:	e8 99 1a 00 00       	call   331c <nel::operator<<(nel::Log&, char const*)>
+    1883:	be 0a 00 00 00       	mov    $0xa,%esi
+    1888:	48 89 c7             	mov    %rax,%rdi
+    188b:	e8 60 1a 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    1890:	e8 d5 f9 ff ff       	call   126a <ex1()>
+    nel::log << "ex1:e" << '\n';
+    1895:	48 8d 05 cd 27 00 00 	lea    0x27cd(%rip),%rax        # 4069 <nel::sort::ninther_n+0x49>
+    189c:	48 89 c6             	mov    %rax,%rsi
+    189f:	48 8d 05 c3 57 00 00 	lea    0x57c3(%rip),%rax        # 7069 <nel::log>
+    18a6:	48 89 c7             	mov    %rax,%rdi
+    18a9:	e8 6e 1a 00 00       	call   331c <nel::operator<<(nel::Log&, char const*)>
+    18ae:	be 0a 00 00 00       	mov    $0xa,%esi
+    18b3:	48 89 c7             	mov    %rax,%rdi
+    18b6:	e8 35 1a 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex2:b" << '\n';
+    18bb:	48 8d 05 ad 27 00 00 	lea    0x27ad(%rip),%rax        # 406f <nel::sort::ninther_n+0x4f>
+    18c2:	48 89 c6             	mov    %rax,%rsi
+    18c5:	48 8d 05 9d 57 00 00 	lea    0x579d(%rip),%rax        # 7069 <nel::log>
+    18cc:	48 89 c7             	mov    %rax,%rdi
+    18cf:	e8 48 1a 00 00       	call   331c <nel::operator<<(nel::Log&, char const*)>
+    18d4:	be 0a 00 00 00       	mov    $0xa,%esi
+    18d9:	48 89 c7             	mov    %rax,%rdi
+    18dc:	e8 0f 1a 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+    ex2();
+    18e1:	e8 dd f9 ff ff       	call   12c3 <ex2()>
+    nel::log << "ex2:e" << '\n';
+    18e6:	48 8d 05 88 27 00 00 	lea    0x2788(%rip),%rax        # 4075 <nel::sort::ninther_n+0x55>
+    18ed:	48 89 c6             	mov    %rax,%rsi
+    18f0:	48 8d 05 72 57 00 00 	lea    0x5772(%rip),%rax        # 7069 <nel::log>
+    18f7:	48 89 c7             	mov    %rax,%rdi
+    18fa:	e8 1d 1a 00 00       	call   331c <nel::operator<<(nel::Log&, char const*)>
+    18ff:	be 0a 00 00 00       	mov    $0xa,%esi
+    1904:	48 89 c7             	mov    %rax,%rdi
+    1907:	e8 e4 19 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex3:b" << '\n';
+    190c:	48 8d 05 68 27 00 00 	lea    0x2768(%rip),%rax        # 407b <nel::sort::ninther_n+0x5b>
+    1913:	48 89 c6             	mov    %rax,%rsi
+    1916:	48 8d 05 4c 57 00 00 	lea    0x574c(%rip),%rax        # 7069 <nel::log>
+    191d:	48 89 c7             	mov    %rax,%rdi
+    1920:	e8 f7 19 00 00       	call   331c <nel::operator<<(nel::Log&, char const*)>
+    1925:	be 0a 00 00 00       	mov    $0xa,%esi
+    192a:	48 89 c7             	mov    %rax,%rdi
+    192d:	e8 be 19 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+    ex3();
+    1932:	e8 77 fa ff ff       	call   13ae <ex3()>
+    nel::log << "ex3:e" << '\n';
+    1937:	48 8d 05 43 27 00 00 	lea    0x2743(%rip),%rax        # 4081 <nel::sort::ninther_n+0x61>
+    193e:	48 89 c6             	mov    %rax,%rsi
+    1941:	48 8d 05 21 57 00 00 	lea    0x5721(%rip),%rax        # 7069 <nel::log>
+    1948:	48 89 c7             	mov    %rax,%rdi
+    194b:	e8 cc 19 00 00       	call   331c <nel::operator<<(nel::Log&, char const*)>
+    1950:	be 0a 00 00 00       	mov    $0xa,%esi
+    1955:	48 89 c7             	mov    %rax,%rdi
+    1958:	e8 93 19 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+#if defined(RUST_LIKE)
+    nel::log << "ex41:b" << '\n';
+    ex41();
+    nel::log << "ex41:e" << '\n';
+#endif
+    nel::log << "ex42:b" << '\n';
+    195d:	48 8d 05 23 27 00 00 	lea    0x2723(%rip),%rax        # 4087 <nel::sort::ninther_n+0x67>
+    1964:	48 89 c6             	mov    %rax,%rsi
+    1967:	48 8d 05 fb 56 00 00 	lea    0x56fb(%rip),%rax        # 7069 <nel::log>
+    196e:	48 89 c7             	mov    %rax,%rdi
+    1971:	e8 a6 19 00 00       	call   331c <nel::operator<<(nel::Log&, char const*)>
+    1976:	be 0a 00 00 00       	mov    $0xa,%esi
+    197b:	48 89 c7             	mov    %rax,%rdi
+    197e:	e8 6d 19 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+    ex42();
+    1983:	e8 06 fb ff ff       	call   148e <ex42()>
+    nel::log << "ex42:e" << '\n';
+    1988:	48 8d 05 ff 26 00 00 	lea    0x26ff(%rip),%rax        # 408e <nel::sort::ninther_n+0x6e>
+    198f:	48 89 c6             	mov    %rax,%rsi
+    1992:	48 8d 05 d0 56 00 00 	lea    0x56d0(%rip),%rax        # 7069 <nel::log>
+    1999:	48 89 c7             	mov    %rax,%rdi
+    199c:	e8 7b 19 00 00       	call   331c <nel::operator<<(nel::Log&, char const*)>
+    19a1:	be 0a 00 00 00       	mov    $0xa,%esi
+    19a6:	48 89 c7             	mov    %rax,%rdi
+    19a9:	e8 42 19 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+#if defined(RUST_LIKE)
+    nel::log << "ex51:b" << '\n';
+    ex51();
+    nel::log << "ex51:e" << '\n';
+#endif
+    nel::log << "ex52:b" << '\n';
+    19ae:	48 8d 05 e0 26 00 00 	lea    0x26e0(%rip),%rax        # 4095 <nel::sort::ninther_n+0x75>
+    19b5:	48 89 c6             	mov    %rax,%rsi
+    19b8:	48 8d 05 aa 56 00 00 	lea    0x56aa(%rip),%rax        # 7069 <nel::log>
+    19bf:	48 89 c7             	mov    %rax,%rdi
+    19c2:	e8 55 19 00 00       	call   331c <nel::operator<<(nel::Log&, char const*)>
+    19c7:	be 0a 00 00 00       	mov    $0xa,%esi
+    19cc:	48 89 c7             	mov    %rax,%rdi
+    19cf:	e8 1c 19 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+    ex52();
+    19d4:	e8 2d fd ff ff       	call   1706 <ex52()>
+    nel::log << "ex52:e" << '\n';
+    19d9:	48 8d 05 bc 26 00 00 	lea    0x26bc(%rip),%rax        # 409c <nel::sort::ninther_n+0x7c>
+    19e0:	48 89 c6             	mov    %rax,%rsi
+    19e3:	48 8d 05 7f 56 00 00 	lea    0x567f(%rip),%rax        # 7069 <nel::log>
+    19ea:	48 89 c7             	mov    %rax,%rdi
+    19ed:	e8 2a 19 00 00       	call   331c <nel::operator<<(nel::Log&, char const*)>
+    19f2:	be 0a 00 00 00       	mov    $0xa,%esi
+    19f7:	48 89 c7             	mov    %rax,%rdi
+    19fa:	e8 f1 18 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+}
+    19ff:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a04:	5d                   	pop    %rbp
+    1a05:	c3                   	ret
+
+0000000000001a06 <operator new(unsigned long, void*)>:
+
+    1a06:	55                   	push   %rbp
+    1a07:	48 89 e5             	mov    %rsp,%rbp
+    1a0a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a0e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+void ex1()
+    1a12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+{
+    1a16:	5d                   	pop    %rbp
+    1a17:	c3                   	ret
+
+0000000000001a18 <nel::Context::Context(char const*, char const*, int)>:
+        char const *fn_name_;
+        char const *file_name_;
+        int line_num_;
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+    1a18:	55                   	push   %rbp
+    1a19:	48 89 e5             	mov    %rsp,%rbp
+    1a1c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a20:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1a24:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1a28:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1a2b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a2f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1a33:	48 89 10             	mov    %rdx,(%rax)
+            , file_name_(file_name)
+    1a36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a3a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1a3e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , line_num_(line_num)
+    1a42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a46:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1a49:	89 50 10             	mov    %edx,0x10(%rax)
+        {
+        }
+    1a4c:	90                   	nop
+    1a4d:	5d                   	pop    %rbp
+    1a4e:	c3                   	ret
+    1a4f:	90                   	nop
+
+0000000000001a50 <nel::Manual<U8Buf<256ul> [10]>::~Manual()>:
+        } u_;
+
+    public:
+        // default must not delete..
+        // doesn't know if value contained or not.
+        constexpr ~Manual() = default;
+    1a50:	55                   	push   %rbp
+    1a51:	48 89 e5             	mov    %rsp,%rbp
+    1a54:	48 83 ec 10          	sub    $0x10,%rsp
+    1a58:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a60:	48 89 c7             	mov    %rax,%rdi
+    1a63:	e8 7c 01 00 00       	call   1be4 <nel::Manual<U8Buf<256ul> [10]>::U::~U()>
+    1a68:	90                   	nop
+    1a69:	c9                   	leave
+    1a6a:	c3                   	ret
+    1a6b:	90                   	nop
+
+0000000000001a6c <U8Buf<256ul>::U8Buf(unsigned char)>:
+            nel::elem::move(data_, o.data_, N);
+            return *this;
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+    1a6c:	55                   	push   %rbp
+    1a6d:	48 89 e5             	mov    %rsp,%rbp
+    1a70:	48 83 ec 10          	sub    $0x10,%rsp
+    1a74:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a78:	89 f0                	mov    %esi,%eax
+    1a7a:	88 45 f4             	mov    %al,-0xc(%rbp)
+        {
+            nel::elem::set(data_, f, N);
+    1a7d:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    1a81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a85:	ba 00 01 00 00       	mov    $0x100,%edx
+    1a8a:	89 ce                	mov    %ecx,%esi
+    1a8c:	48 89 c7             	mov    %rax,%rdi
+    1a8f:	e8 34 10 00 00       	call   2ac8 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    1a94:	90                   	nop
+    1a95:	c9                   	leave
+    1a96:	c3                   	ret
+    1a97:	90                   	nop
+
+0000000000001a98 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::iter()>:
+         *
+         * iterator is invalidated if array goes out of scope/destroyed.
+         *
+         * @returns The iterator.
+         */
+        constexpr auto iter(void)
+    1a98:	55                   	push   %rbp
+    1a99:	48 89 e5             	mov    %rsp,%rbp
+    1a9c:	48 83 ec 20          	sub    $0x20,%rsp
+    1aa0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1aa4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            return slice().iter();
+    1aa8:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1aac:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1ab0:	48 89 d6             	mov    %rdx,%rsi
+    1ab3:	48 89 c7             	mov    %rax,%rdi
+    1ab6:	e8 19 00 00 00       	call   1ad4 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::slice()>
+    1abb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1abf:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    1ac3:	48 89 d6             	mov    %rdx,%rsi
+    1ac6:	48 89 c7             	mov    %rax,%rdi
+    1ac9:	e8 d0 04 00 00       	call   1f9e <nel::Slice<U8Buf<256ul> >::iter() const>
+        }
+    1ace:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ad2:	c9                   	leave
+    1ad3:	c3                   	ret
+
+0000000000001ad4 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::slice()>:
+        constexpr Slice<Type> slice(void)
+    1ad4:	55                   	push   %rbp
+    1ad5:	48 89 e5             	mov    %rsp,%rbp
+    1ad8:	53                   	push   %rbx
+    1ad9:	48 83 ec 18          	sub    $0x18,%rsp
+    1add:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1ae1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return Slice(ptr(), len());
+    1ae5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ae9:	48 89 c7             	mov    %rax,%rdi
+    1aec:	e8 5b 00 00 00       	call   1b4c <nel::heapless::Vector<U8Buf<256ul>, 10ul>::len() const>
+    1af1:	48 89 c3             	mov    %rax,%rbx
+    1af4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1af8:	48 89 c7             	mov    %rax,%rdi
+    1afb:	e8 20 00 00 00       	call   1b20 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::ptr()>
+    1b00:	48 89 c1             	mov    %rax,%rcx
+    1b03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b07:	48 89 da             	mov    %rbx,%rdx
+    1b0a:	48 89 ce             	mov    %rcx,%rsi
+    1b0d:	48 89 c7             	mov    %rax,%rdi
+    1b10:	e8 d5 04 00 00       	call   1fea <nel::Slice<U8Buf<256ul> >::Slice(U8Buf<256ul>*, unsigned long)>
+        }
+    1b15:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b19:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1b1d:	c9                   	leave
+    1b1e:	c3                   	ret
+    1b1f:	90                   	nop
+
+0000000000001b20 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::ptr()>:
+        constexpr Type *ptr()
+    1b20:	55                   	push   %rbp
+    1b21:	48 89 e5             	mov    %rsp,%rbp
+    1b24:	48 83 ec 10          	sub    $0x10,%rsp
+    1b28:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return elems_.ptr()[0];
+    1b2c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b30:	48 83 c0 08          	add    $0x8,%rax
+    1b34:	48 89 c7             	mov    %rax,%rdi
+    1b37:	e8 02 00 00 00       	call   1b3e <nel::Manual<U8Buf<256ul> [10]>::ptr()>
+        }
+    1b3c:	c9                   	leave
+    1b3d:	c3                   	ret
+
+0000000000001b3e <nel::Manual<U8Buf<256ul> [10]>::ptr()>:
+
+        // private:
+    public:
+        // only if you know there's a value there..
+        // TODO: must have no bare pointers.. safety feature.
+        constexpr Type *ptr()
+    1b3e:	55                   	push   %rbp
+    1b3f:	48 89 e5             	mov    %rsp,%rbp
+    1b42:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return &u_.elem_;
+    1b46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1b4a:	5d                   	pop    %rbp
+    1b4b:	c3                   	ret
+
+0000000000001b4c <nel::heapless::Vector<U8Buf<256ul>, 10ul>::len() const>:
+        constexpr Length len(void) const
+    1b4c:	55                   	push   %rbp
+    1b4d:	48 89 e5             	mov    %rsp,%rbp
+    1b50:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    1b54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b58:	48 8b 00             	mov    (%rax),%rax
+        }
+    1b5b:	5d                   	pop    %rbp
+    1b5c:	c3                   	ret
+    1b5d:	90                   	nop
+
+0000000000001b5e <nel::SliceIterator<U8Buf<256ul> >::is_done() const>:
+        }
+#    endif
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+    1b5e:	55                   	push   %rbp
+    1b5f:	48 89 e5             	mov    %rsp,%rbp
+    1b62:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return (b_ == e_);
+    1b66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b6a:	48 8b 10             	mov    (%rax),%rdx
+    1b6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b71:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1b75:	48 39 c2             	cmp    %rax,%rdx
+    1b78:	0f 94 c0             	sete   %al
+        }
+    1b7b:	5d                   	pop    %rbp
+    1b7c:	c3                   	ret
+    1b7d:	90                   	nop
+
+0000000000001b7e <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::is_done() const>:
+        }
+#    endif // defined(RUST_LIKE)
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+    1b7e:	55                   	push   %rbp
+    1b7f:	48 89 e5             	mov    %rsp,%rbp
+    1b82:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return (current_ >= limit_);
+    1b86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b8a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+    1b8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b92:	48 8b 40 18          	mov    0x18(%rax),%rax
+    1b96:	48 39 c2             	cmp    %rax,%rdx
+    1b99:	0f 93 c0             	setae  %al
+        }
+    1b9c:	5d                   	pop    %rbp
+    1b9d:	c3                   	ret
+
+0000000000001b9e <nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()>:
+        constexpr ~Vector(void)
+    1b9e:	55                   	push   %rbp
+    1b9f:	48 89 e5             	mov    %rsp,%rbp
+    1ba2:	48 83 ec 30          	sub    $0x30,%rsp
+    1ba6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+            iter().for_each([&](auto &v) -> void { v.~Type(); });
+    1baa:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1bae:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1bb2:	48 89 d6             	mov    %rdx,%rsi
+    1bb5:	48 89 c7             	mov    %rax,%rdi
+    1bb8:	e8 db fe ff ff       	call   1a98 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::iter()>
+    1bbd:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    1bc1:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1bc5:	48 89 d6             	mov    %rdx,%rsi
+    1bc8:	48 89 c7             	mov    %rax,%rdi
+    1bcb:	e8 f8 05 00 00       	call   21c8 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()::{lambda(auto:1&)#1}>(nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()::{lambda(auto:1&)#1}&&)>
+        }
+    1bd0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1bd4:	48 83 c0 08          	add    $0x8,%rax
+    1bd8:	48 89 c7             	mov    %rax,%rdi
+    1bdb:	e8 70 fe ff ff       	call   1a50 <nel::Manual<U8Buf<256ul> [10]>::~Manual()>
+    1be0:	90                   	nop
+    1be1:	c9                   	leave
+    1be2:	c3                   	ret
+    1be3:	90                   	nop
+
+0000000000001be4 <nel::Manual<U8Buf<256ul> [10]>::U::~U()>:
+                constexpr ~U() {};
+    1be4:	55                   	push   %rbp
+    1be5:	48 89 e5             	mov    %rsp,%rbp
+    1be8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1bec:	90                   	nop
+    1bed:	5d                   	pop    %rbp
+    1bee:	c3                   	ret
+    1bef:	90                   	nop
+
+0000000000001bf0 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::iter() const>:
+
+        constexpr auto iter(void) const
+    1bf0:	55                   	push   %rbp
+    1bf1:	48 89 e5             	mov    %rsp,%rbp
+    1bf4:	48 83 ec 20          	sub    $0x20,%rsp
+    1bf8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1bfc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            return slice().iter();
+    1c00:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1c04:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1c08:	48 89 d6             	mov    %rdx,%rsi
+    1c0b:	48 89 c7             	mov    %rax,%rdi
+    1c0e:	e8 21 06 00 00       	call   2234 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::slice() const>
+    1c13:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c17:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    1c1b:	48 89 d6             	mov    %rdx,%rsi
+    1c1e:	48 89 c7             	mov    %rax,%rdi
+    1c21:	e8 5a 06 00 00       	call   2280 <nel::Slice<U8Buf<256ul> const>::iter() const>
+        }
+    1c26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c2a:	c9                   	leave
+    1c2b:	c3                   	ret
+
+0000000000001c2c <nel::heapless::operator<<(nel::Log&, nel::heapless::Vector<U8Buf<256ul>, 10ul> const&)>:
+         * @param outs the stream to dump the representation into.
+         */
+        // TODO: replace <<(Log ) with dbgfmt, so separate out from
+        // any other form of conversion to charstring.
+        // TODO: insert into formatter and not final dest type.
+        friend Log &operator<<(Log &outs, Vector const &v)
+    1c2c:	55                   	push   %rbp
+    1c2d:	48 89 e5             	mov    %rsp,%rbp
+    1c30:	53                   	push   %rbx
+    1c31:	48 83 ec 28          	sub    $0x28,%rsp
+    1c35:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1c39:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+        {
+            outs << "Vector<" << N << ">(" << v.len() << "){";
+    1c3d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1c41:	48 8d 15 5b 24 00 00 	lea    0x245b(%rip),%rdx        # 40a3 <nel::sort::ninther_n+0x83>
+    1c48:	48 89 d6             	mov    %rdx,%rsi
+    1c4b:	48 89 c7             	mov    %rax,%rdi
+    1c4e:	e8 c9 16 00 00       	call   331c <nel::operator<<(nel::Log&, char const*)>
+    1c53:	be 0a 00 00 00       	mov    $0xa,%esi
+    1c58:	48 89 c7             	mov    %rax,%rdi
+    1c5b:	e8 c7 17 00 00       	call   3427 <nel::operator<<(nel::Log&, unsigned long)>
+    1c60:	48 89 c2             	mov    %rax,%rdx
+    1c63:	48 8d 05 41 24 00 00 	lea    0x2441(%rip),%rax        # 40ab <nel::sort::ninther_n+0x8b>
+    1c6a:	48 89 c6             	mov    %rax,%rsi
+    1c6d:	48 89 d7             	mov    %rdx,%rdi
+    1c70:	e8 a7 16 00 00       	call   331c <nel::operator<<(nel::Log&, char const*)>
+    1c75:	48 89 c3             	mov    %rax,%rbx
+    1c78:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1c7c:	48 89 c7             	mov    %rax,%rdi
+    1c7f:	e8 c8 fe ff ff       	call   1b4c <nel::heapless::Vector<U8Buf<256ul>, 10ul>::len() const>
+    1c84:	48 89 c6             	mov    %rax,%rsi
+    1c87:	48 89 df             	mov    %rbx,%rdi
+    1c8a:	e8 98 17 00 00       	call   3427 <nel::operator<<(nel::Log&, unsigned long)>
+    1c8f:	48 89 c2             	mov    %rax,%rdx
+    1c92:	48 8d 05 15 24 00 00 	lea    0x2415(%rip),%rax        # 40ae <nel::sort::ninther_n+0x8e>
+    1c99:	48 89 c6             	mov    %rax,%rsi
+    1c9c:	48 89 d7             	mov    %rdx,%rdi
+    1c9f:	e8 78 16 00 00       	call   331c <nel::operator<<(nel::Log&, char const*)>
+            outs << v.iter();
+    1ca4:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1ca8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1cac:	48 89 d6             	mov    %rdx,%rsi
+    1caf:	48 89 c7             	mov    %rax,%rdi
+    1cb2:	e8 39 ff ff ff       	call   1bf0 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::iter() const>
+    1cb7:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1cbb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1cbf:	48 89 d6             	mov    %rdx,%rsi
+    1cc2:	48 89 c7             	mov    %rax,%rdi
+    1cc5:	e8 5b 06 00 00       	call   2325 <nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)>
+            outs << '}';
+    1cca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1cce:	be 7d 00 00 00       	mov    $0x7d,%esi
+    1cd3:	48 89 c7             	mov    %rax,%rdi
+    1cd6:	e8 15 16 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+            return outs;
+    1cdb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+        }
+    1cdf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1ce3:	c9                   	leave
+    1ce4:	c3                   	ret
+    1ce5:	90                   	nop
+
+0000000000001ce6 <U8Buf<256ul>::~U8Buf()>:
+        constexpr ~U8Buf(void)
+    1ce6:	55                   	push   %rbp
+    1ce7:	48 89 e5             	mov    %rsp,%rbp
+    1cea:	48 83 ec 10          	sub    $0x10,%rsp
+    1cee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            nel::elem::set(data_, 0xa5, N);
+    1cf2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cf6:	ba 00 01 00 00       	mov    $0x100,%edx
+    1cfb:	be a5 00 00 00       	mov    $0xa5,%esi
+    1d00:	48 89 c7             	mov    %rax,%rdi
+    1d03:	e8 c0 0d 00 00       	call   2ac8 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    1d08:	90                   	nop
+    1d09:	c9                   	leave
+    1d0a:	c3                   	ret
+
+0000000000001d0b <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel is to not need std.
+ */
+template<typename T>
+constexpr T &&move(T &v)
+    1d0b:	55                   	push   %rbp
+    1d0c:	48 89 e5             	mov    %rsp,%rbp
+    1d0f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<T &&>(v);
+    1d13:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1d17:	5d                   	pop    %rbp
+    1d18:	c3                   	ret
+    1d19:	90                   	nop
+
+0000000000001d1a <nel::heapless::Vector<U8Buf<256ul>, 10ul>::push(U8Buf<256ul>&&)>:
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+    1d1a:	       55                   	push   %rbp
+    1d1b:	       48 89 e5             	mov    %rsp,%rbp
+    1d1e:	       53                   	push   %rbx
+    1d1f:	       48 83 ec 28          	sub    $0x28,%rsp
+    1d23:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1d27:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1d2b:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            if (len() >= capacity()) {
+    1d2f:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d33:	       48 89 c7             	mov    %rax,%rdi
+    1d36:	       e8 11 fe ff ff       	call   1b4c <nel::heapless::Vector<U8Buf<256ul>, 10ul>::len() const>
+    1d3b:	       48 89 c3             	mov    %rax,%rbx
+    1d3e:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d42:	       48 89 c7             	mov    %rax,%rdi
+    1d45:	       e8 7e 06 00 00       	call   23c8 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::capacity() const>
+    1d4a:	       48 39 c3             	cmp    %rax,%rbx
+    1d4d:	       0f 93 c0             	setae  %al
+    1d50:	       84 c0                	test   %al,%al
+    1d52:	   /-- 74 20                	je     1d74 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::push(U8Buf<256ul>&&)+0x5a>
+                return Result<void, Type>::Err(move(val));
+    1d54:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1d58:	   |   48 89 c7             	mov    %rax,%rdi
+    1d5b:	   |   e8 ab ff ff ff       	call   1d0b <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    1d60:	   |   48 89 c2             	mov    %rax,%rdx
+    1d63:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d67:	   |   48 89 d6             	mov    %rdx,%rsi
+    1d6a:	   |   48 89 c7             	mov    %rax,%rdi
+    1d6d:	   |   e8 65 06 00 00       	call   23d7 <nel::Result<void, U8Buf<256ul> >::Err(U8Buf<256ul>&&)>
+    1d72:	/--|-- eb 51                	jmp    1dc5 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::push(U8Buf<256ul>&&)+0xab>
+            new (end()) Type(move(val));
+    1d74:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d78:	|      48 89 c7             	mov    %rax,%rdi
+    1d7b:	|      e8 8c 06 00 00       	call   240c <nel::heapless::Vector<U8Buf<256ul>, 10ul>::end()>
+    1d80:	|      48 89 c6             	mov    %rax,%rsi
+    1d83:	|      bf 00 01 00 00       	mov    $0x100,%edi
+    1d88:	|      e8 79 fc ff ff       	call   1a06 <operator new(unsigned long, void*)>
+    1d8d:	|      48 89 c3             	mov    %rax,%rbx
+    1d90:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1d94:	|      48 89 c7             	mov    %rax,%rdi
+    1d97:	|      e8 6f ff ff ff       	call   1d0b <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    1d9c:	|      48 89 c6             	mov    %rax,%rsi
+    1d9f:	|      48 89 df             	mov    %rbx,%rdi
+    1da2:	|      e8 8d 06 00 00       	call   2434 <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>
+            len_ += 1;
+    1da7:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1dab:	|      48 8b 00             	mov    (%rax),%rax
+    1dae:	|      48 8d 50 01          	lea    0x1(%rax),%rdx
+    1db2:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1db6:	|      48 89 10             	mov    %rdx,(%rax)
+            return Result<void, Type>::Ok();
+    1db9:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1dbd:	|      48 89 c7             	mov    %rax,%rdi
+    1dc0:	|      e8 9a 06 00 00       	call   245f <nel::Result<void, U8Buf<256ul> >::Ok()>
+        }
+    1dc5:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1dc9:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1dcd:	       c9                   	leave
+    1dce:	       c3                   	ret
+    1dcf:	       90                   	nop
+
+0000000000001dd0 <nel::Element<U8Buf<256ul> >::~Element()>:
+
+    private:
+        Type value_;
+
+    public:
+        constexpr ~Element(void) = default;
+    1dd0:	55                   	push   %rbp
+    1dd1:	48 89 e5             	mov    %rsp,%rbp
+    1dd4:	48 83 ec 10          	sub    $0x10,%rsp
+    1dd8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1ddc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1de0:	48 89 c7             	mov    %rax,%rdi
+    1de3:	e8 fe fe ff ff       	call   1ce6 <U8Buf<256ul>::~U8Buf()>
+    1de8:	90                   	nop
+    1de9:	c9                   	leave
+    1dea:	c3                   	ret
+    1deb:	90                   	nop
+
+0000000000001dec <nel::Result<void, U8Buf<256ul> >::~Result()>:
+        union {
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    1dec:	             55                   	push   %rbp
+    1ded:	             48 89 e5             	mov    %rsp,%rbp
+    1df0:	             48 83 ec 30          	sub    $0x30,%rsp
+    1df4:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result<void>-dtor
+    1df8:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1dfc:	             8b 00                	mov    (%rax),%eax
+    1dfe:	             83 f8 02             	cmp    $0x2,%eax
+    1e01:	         /-- 74 10                	je     1e13 <nel::Result<void, U8Buf<256ul> >::~Result()+0x27>
+    1e03:	         |   83 f8 02             	cmp    $0x2,%eax
+    1e06:	      /--|-- 7f 1d                	jg     1e25 <nel::Result<void, U8Buf<256ul> >::~Result()+0x39>
+    1e08:	      |  |   85 c0                	test   %eax,%eax
+    1e0a:	/-----|--|-- 74 4e                	je     1e5a <nel::Result<void, U8Buf<256ul> >::~Result()+0x6e>
+    1e0c:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    1e0f:	|     +--|-- 75 14                	jne    1e25 <nel::Result<void, U8Buf<256ul> >::~Result()+0x39>
+                case Tag::OK:
+                    break;
+    1e11:	|  /--|--|-- eb 48                	jmp    1e5b <nel::Result<void, U8Buf<256ul> >::~Result()+0x6f>
+
+                case Tag::ERR:
+                    err_.~Element<E>();
+    1e13:	|  |  |  \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1e17:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    1e1b:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1e1e:	|  |  |      e8 ad ff ff ff       	call   1dd0 <nel::Element<U8Buf<256ul> >::~Element()>
+                    break;
+    1e23:	|  +--|----- eb 36                	jmp    1e5b <nel::Result<void, U8Buf<256ul> >::~Result()+0x6f>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    1e25:	|  |  \----> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1e29:	|  |         b9 dd 02 00 00       	mov    $0x2dd,%ecx
+    1e2e:	|  |         48 8d 15 7c 22 00 00 	lea    0x227c(%rip),%rdx        # 40b1 <nel::sort::ninther_n+0x91>
+    1e35:	|  |         48 8d 35 87 22 00 00 	lea    0x2287(%rip),%rsi        # 40c3 <nel::sort::ninther_n+0xa3>
+    1e3c:	|  |         48 89 c7             	mov    %rax,%rdi
+    1e3f:	|  |         e8 d4 fb ff ff       	call   1a18 <nel::Context::Context(char const*, char const*, int)>
+    1e44:	|  |         48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1e48:	|  |         48 89 c6             	mov    %rax,%rsi
+    1e4b:	|  |         48 8d 05 79 22 00 00 	lea    0x2279(%rip),%rax        # 40cb <nel::sort::ninther_n+0xab>
+    1e52:	|  |         48 89 c7             	mov    %rax,%rdi
+    1e55:	|  |         e8 8a 0b 00 00       	call   29e4 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    1e5a:	\--|-------> 90                   	nop
+                    break;
+            }
+        }
+    1e5b:	   \-------> 90                   	nop
+    1e5c:	             c9                   	leave
+    1e5d:	             c3                   	ret
+
+0000000000001e5e <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}::operator()() const>:
+         *
+         * `this` is not consumed by this op.
+         */
+        constexpr bool is_ok(Context const &ctx = Context()) const
+        {
+            return match<bool>([](void) -> bool { return true; },
+    1e5e:	55                   	push   %rbp
+    1e5f:	48 89 e5             	mov    %rsp,%rbp
+    1e62:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1e66:	b8 01 00 00 00       	mov    $0x1,%eax
+    1e6b:	5d                   	pop    %rbp
+    1e6c:	c3                   	ret
+    1e6d:	90                   	nop
+
+0000000000001e6e <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}::operator()(U8Buf<256ul> const&) const>:
+                               [](E const &) -> bool { return false; },
+    1e6e:	55                   	push   %rbp
+    1e6f:	48 89 e5             	mov    %rsp,%rbp
+    1e72:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1e76:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1e7a:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e7f:	5d                   	pop    %rbp
+    1e80:	c3                   	ret
+    1e81:	90                   	nop
+
+0000000000001e82 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>:
+        constexpr bool is_ok(Context const &ctx = Context()) const
+    1e82:	55                   	push   %rbp
+    1e83:	48 89 e5             	mov    %rsp,%rbp
+    1e86:	48 83 ec 20          	sub    $0x20,%rsp
+    1e8a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1e8e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](void) -> bool { return true; },
+    1e92:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1e96:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    1e9a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    1e9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ea2:	48 89 c7             	mov    %rax,%rdi
+    1ea5:	e8 d4 05 00 00       	call   247e <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const>
+                               ctx);
+        }
+    1eaa:	c9                   	leave
+    1eab:	c3                   	ret
+
+0000000000001eac <nel::heapless::Vector<U8Buf<256ul>, 10ul>::pop()>:
+        Optional<Type> pop(void)
+    1eac:	       55                   	push   %rbp
+    1ead:	       48 89 e5             	mov    %rsp,%rbp
+    1eb0:	       48 83 ec 10          	sub    $0x10,%rsp
+    1eb4:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1eb8:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            if (len() == 0) { return None; }
+    1ebc:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ec0:	       48 89 c7             	mov    %rax,%rdi
+    1ec3:	       e8 84 fc ff ff       	call   1b4c <nel::heapless::Vector<U8Buf<256ul>, 10ul>::len() const>
+    1ec8:	       48 85 c0             	test   %rax,%rax
+    1ecb:	       0f 94 c0             	sete   %al
+    1ece:	       84 c0                	test   %al,%al
+    1ed0:	   /-- 74 18                	je     1eea <nel::heapless::Vector<U8Buf<256ul>, 10ul>::pop()+0x3e>
+    1ed2:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ed6:	   |   48 8d 15 2c 21 00 00 	lea    0x212c(%rip),%rdx        # 4009 <nel::None>
+    1edd:	   |   48 89 d6             	mov    %rdx,%rsi
+    1ee0:	   |   48 89 c7             	mov    %rax,%rdi
+    1ee3:	   |   e8 28 06 00 00       	call   2510 <nel::Optional<U8Buf<256ul> >::Optional(nel::NoneT const&)>
+    1ee8:	/--|-- eb 38                	jmp    1f22 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::pop()+0x76>
+            len_ -= 1;
+    1eea:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1eee:	|      48 8b 00             	mov    (%rax),%rax
+    1ef1:	|      48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    1ef5:	|      48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ef9:	|      48 89 10             	mov    %rdx,(%rax)
+            return Some(move(*end()));
+    1efc:	|      48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f00:	|      48 89 c7             	mov    %rax,%rdi
+    1f03:	|      e8 04 05 00 00       	call   240c <nel::heapless::Vector<U8Buf<256ul>, 10ul>::end()>
+    1f08:	|      48 89 c7             	mov    %rax,%rdi
+    1f0b:	|      e8 fb fd ff ff       	call   1d0b <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    1f10:	|      48 89 c2             	mov    %rax,%rdx
+    1f13:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f17:	|      48 89 d6             	mov    %rdx,%rsi
+    1f1a:	|      48 89 c7             	mov    %rax,%rdi
+    1f1d:	|      e8 07 06 00 00       	call   2529 <nel::Optional<U8Buf<256ul> > nel::Some<U8Buf<256ul> >(U8Buf<256ul>&&)>
+        }
+    1f22:	\----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f26:	       c9                   	leave
+    1f27:	       c3                   	ret
+
+0000000000001f28 <nel::Optional<U8Buf<256ul> >::~Optional()>:
+        union {
+                Element<T> some_;
+        };
+
+    public:
+        constexpr ~Optional(void)
+    1f28:	             55                   	push   %rbp
+    1f29:	             48 89 e5             	mov    %rsp,%rbp
+    1f2c:	             48 83 ec 30          	sub    $0x30,%rsp
+    1f30:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // optional::dtor
+    1f34:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1f38:	             8b 00                	mov    (%rax),%eax
+    1f3a:	             83 f8 02             	cmp    $0x2,%eax
+    1f3d:	         /-- 74 10                	je     1f4f <nel::Optional<U8Buf<256ul> >::~Optional()+0x27>
+    1f3f:	         |   83 f8 02             	cmp    $0x2,%eax
+    1f42:	      /--|-- 7f 1d                	jg     1f61 <nel::Optional<U8Buf<256ul> >::~Optional()+0x39>
+    1f44:	      |  |   85 c0                	test   %eax,%eax
+    1f46:	/-----|--|-- 74 4e                	je     1f96 <nel::Optional<U8Buf<256ul> >::~Optional()+0x6e>
+    1f48:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    1f4b:	|  /--|--|-- 74 4c                	je     1f99 <nel::Optional<U8Buf<256ul> >::~Optional()+0x71>
+    1f4d:	|  |  +--|-- eb 12                	jmp    1f61 <nel::Optional<U8Buf<256ul> >::~Optional()+0x39>
+                case Tag::SOME:
+                    some_.~Element<T>();
+    1f4f:	|  |  |  \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1f53:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    1f57:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1f5a:	|  |  |      e8 71 fe ff ff       	call   1dd0 <nel::Element<U8Buf<256ul> >::~Element()>
+                    break;
+    1f5f:	|  |  |  /-- eb 39                	jmp    1f9a <nel::Optional<U8Buf<256ul> >::~Optional()+0x72>
+                    // yes, since it may have contained one or the others..
+                    // if memory hardware is assumed to be incorruptable then can ignore ? (buffer
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob.
+                    nel::panic("bad Optional");
+    1f61:	|  |  \--|-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1f65:	|  |     |   b9 87 00 00 00       	mov    $0x87,%ecx
+    1f6a:	|  |     |   48 8d 15 65 21 00 00 	lea    0x2165(%rip),%rdx        # 40d6 <nel::sort::ninther_n+0xb6>
+    1f71:	|  |     |   48 8d 35 72 21 00 00 	lea    0x2172(%rip),%rsi        # 40ea <nel::sort::ninther_n+0xca>
+    1f78:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    1f7b:	|  |     |   e8 98 fa ff ff       	call   1a18 <nel::Context::Context(char const*, char const*, int)>
+    1f80:	|  |     |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1f84:	|  |     |   48 89 c6             	mov    %rax,%rsi
+    1f87:	|  |     |   48 8d 05 66 21 00 00 	lea    0x2166(%rip),%rax        # 40f4 <nel::sort::ninther_n+0xd4>
+    1f8e:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    1f91:	|  |     |   e8 4e 0a 00 00       	call   29e4 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    1f96:	\--|-----|-> 90                   	nop
+    1f97:	   |     +-- eb 01                	jmp    1f9a <nel::Optional<U8Buf<256ul> >::~Optional()+0x72>
+                    break;
+    1f99:	   \-----|-> 90                   	nop
+                    break;
+            }
+        }
+    1f9a:	         \-> 90                   	nop
+    1f9b:	             c9                   	leave
+    1f9c:	             c3                   	ret
+    1f9d:	             90                   	nop
+
+0000000000001f9e <nel::Slice<U8Buf<256ul> >::iter() const>:
+        constexpr Iterator iter(void) const
+    1f9e:	55                   	push   %rbp
+    1f9f:	48 89 e5             	mov    %rsp,%rbp
+    1fa2:	53                   	push   %rbx
+    1fa3:	48 83 ec 18          	sub    $0x18,%rsp
+    1fa7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1fab:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return Iterator(ptr(), len());
+    1faf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1fb3:	48 89 c7             	mov    %rax,%rdi
+    1fb6:	e8 b5 05 00 00       	call   2570 <nel::Slice<U8Buf<256ul> >::len() const>
+    1fbb:	48 89 c3             	mov    %rax,%rbx
+    1fbe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1fc2:	48 89 c7             	mov    %rax,%rdi
+    1fc5:	e8 94 05 00 00       	call   255e <nel::Slice<U8Buf<256ul> >::ptr() const>
+    1fca:	48 89 c1             	mov    %rax,%rcx
+    1fcd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1fd1:	48 89 da             	mov    %rbx,%rdx
+    1fd4:	48 89 ce             	mov    %rcx,%rsi
+    1fd7:	48 89 c7             	mov    %rax,%rdi
+    1fda:	e8 a3 05 00 00       	call   2582 <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(U8Buf<256ul>*, unsigned long)>
+        }
+    1fdf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1fe3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1fe7:	c9                   	leave
+    1fe8:	c3                   	ret
+    1fe9:	90                   	nop
+
+0000000000001fea <nel::Slice<U8Buf<256ul> >::Slice(U8Buf<256ul>*, unsigned long)>:
+        constexpr Slice(Type *const p, Length len)
+    1fea:	55                   	push   %rbp
+    1feb:	48 89 e5             	mov    %rsp,%rbp
+    1fee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1ff2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1ff6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : content_(p)
+    1ffa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ffe:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2002:	48 89 10             	mov    %rdx,(%rax)
+            , len_(len)
+    2005:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2009:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    200d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    2011:	90                   	nop
+    2012:	5d                   	pop    %rbp
+    2013:	c3                   	ret
+
+0000000000002014 <nel::SliceIterator<U8Buf<256ul> >::inc()>:
+
+        void inc(void)
+    2014:	55                   	push   %rbp
+    2015:	48 89 e5             	mov    %rsp,%rbp
+    2018:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            ++b_;
+    201c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2020:	48 8b 00             	mov    (%rax),%rax
+    2023:	48 8d 90 00 01 00 00 	lea    0x100(%rax),%rdx
+    202a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    202e:	48 89 10             	mov    %rdx,(%rax)
+        }
+    2031:	90                   	nop
+    2032:	5d                   	pop    %rbp
+    2033:	c3                   	ret
+
+0000000000002034 <nel::SliceIterator<U8Buf<256ul> >::deref()>:
+
+        OutT deref(void)
+    2034:	55                   	push   %rbp
+    2035:	48 89 e5             	mov    %rsp,%rbp
+    2038:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return *b_;
+    203c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2040:	48 8b 00             	mov    (%rax),%rax
+        }
+    2043:	5d                   	pop    %rbp
+    2044:	c3                   	ret
+
+0000000000002045 <operator<<(nel::Log&, U8Buf<256ul> const&)>:
+        void fill(uint8_t f)
+        {
+            nel::elem::set(data_, f, N);
+        }
+
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+    2045:	          55                   	push   %rbp
+    2046:	          48 89 e5             	mov    %rsp,%rbp
+    2049:	          53                   	push   %rbx
+    204a:	          48 83 ec 28          	sub    $0x28,%rsp
+    204e:	          48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    2052:	          48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+        {
+            outs << "U8Buf<" << val.len() << ">{";
+    2056:	          48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    205a:	          48 8d 15 a0 20 00 00 	lea    0x20a0(%rip),%rdx        # 4101 <nel::sort::ninther_n+0xe1>
+    2061:	          48 89 d6             	mov    %rdx,%rsi
+    2064:	          48 89 c7             	mov    %rax,%rdi
+    2067:	          e8 b0 12 00 00       	call   331c <nel::operator<<(nel::Log&, char const*)>
+    206c:	          48 89 c3             	mov    %rax,%rbx
+    206f:	          48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2073:	          48 89 c7             	mov    %rax,%rdi
+    2076:	          e8 3f 05 00 00       	call   25ba <U8Buf<256ul>::len() const>
+    207b:	          48 89 c6             	mov    %rax,%rsi
+    207e:	          48 89 df             	mov    %rbx,%rdi
+    2081:	          e8 a1 13 00 00       	call   3427 <nel::operator<<(nel::Log&, unsigned long)>
+    2086:	          48 89 c2             	mov    %rax,%rdx
+    2089:	          48 8d 05 78 20 00 00 	lea    0x2078(%rip),%rax        # 4108 <nel::sort::ninther_n+0xe8>
+    2090:	          48 89 c6             	mov    %rax,%rsi
+    2093:	          48 89 d7             	mov    %rdx,%rdi
+    2096:	          e8 81 12 00 00       	call   331c <nel::operator<<(nel::Log&, char const*)>
+            if (val.len() > 0) {
+    209b:	          48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    209f:	          48 89 c7             	mov    %rax,%rdi
+    20a2:	          e8 13 05 00 00       	call   25ba <U8Buf<256ul>::len() const>
+    20a7:	          48 85 c0             	test   %rax,%rax
+    20aa:	          0f 95 c0             	setne  %al
+    20ad:	          84 c0                	test   %al,%al
+    20af:	/-------- 74 6d                	je     211e <operator<<(nel::Log&, U8Buf<256ul> const&)+0xd9>
+                outs << val.data_[0];
+    20b1:	|         48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    20b5:	|         0f b6 00             	movzbl (%rax),%eax
+    20b8:	|         0f b6 d0             	movzbl %al,%edx
+    20bb:	|         48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    20bf:	|         89 d6                	mov    %edx,%esi
+    20c1:	|         48 89 c7             	mov    %rax,%rdi
+    20c4:	|         e8 7f 12 00 00       	call   3348 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    20c9:	|         48 c7 45 e8 01 00 00 	movq   $0x1,-0x18(%rbp)
+    20d0:	|         00 
+    20d1:	|     /-- eb 34                	jmp    2107 <operator<<(nel::Log&, U8Buf<256ul> const&)+0xc2>
+                    outs << ' ' << val.data_[i];
+    20d3:	|  /--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    20d7:	|  |  |   be 20 00 00 00       	mov    $0x20,%esi
+    20dc:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    20df:	|  |  |   e8 0c 12 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+    20e4:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    20e7:	|  |  |   48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    20eb:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20ef:	|  |  |   48 01 c8             	add    %rcx,%rax
+    20f2:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    20f5:	|  |  |   0f b6 c0             	movzbl %al,%eax
+    20f8:	|  |  |   89 c6                	mov    %eax,%esi
+    20fa:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    20fd:	|  |  |   e8 46 12 00 00       	call   3348 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    2102:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    2107:	|  |  \-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    210b:	|  |      48 89 c7             	mov    %rax,%rdi
+    210e:	|  |      e8 a7 04 00 00       	call   25ba <U8Buf<256ul>::len() const>
+    2113:	|  |      48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    2117:	|  |      0f 92 c0             	setb   %al
+    211a:	|  |      84 c0                	test   %al,%al
+    211c:	|  \----- 75 b5                	jne    20d3 <operator<<(nel::Log&, U8Buf<256ul> const&)+0x8e>
+                }
+            }
+            outs << '}';
+    211e:	\-------> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2122:	          be 7d 00 00 00       	mov    $0x7d,%esi
+    2127:	          48 89 c7             	mov    %rax,%rdi
+    212a:	          e8 c1 11 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+            return outs;
+    212f:	          48 8b 45 d8          	mov    -0x28(%rbp),%rax
+        }
+    2133:	          48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2137:	          c9                   	leave
+    2138:	          c3                   	ret
+    2139:	          90                   	nop
+
+000000000000213a <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::first_n(unsigned long)>:
+        constexpr FirstNIterator<ItT> first_n(Count const limit)
+    213a:	55                   	push   %rbp
+    213b:	48 89 e5             	mov    %rsp,%rbp
+    213e:	48 83 ec 20          	sub    $0x20,%rsp
+    2142:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2146:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    214a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            return FirstNIterator<ItT>(move(self()), limit);
+    214e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2152:	48 89 c7             	mov    %rax,%rdi
+    2155:	e8 70 04 00 00       	call   25ca <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    215a:	48 89 c7             	mov    %rax,%rdi
+    215d:	e8 7e 04 00 00       	call   25e0 <nel::SliceIterator<U8Buf<256ul> >&& nel::move<nel::SliceIterator<U8Buf<256ul> > >(nel::SliceIterator<U8Buf<256ul> >&)>
+    2162:	48 89 c1             	mov    %rax,%rcx
+    2165:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2169:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    216d:	48 89 ce             	mov    %rcx,%rsi
+    2170:	48 89 c7             	mov    %rax,%rdi
+    2173:	e8 76 04 00 00       	call   25ee <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::FirstNIterator(nel::SliceIterator<U8Buf<256ul> >&&, unsigned long)>
+        }
+    2178:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    217c:	c9                   	leave
+    217d:	c3                   	ret
+
+000000000000217e <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::inc()>:
+
+        void inc(void)
+    217e:	55                   	push   %rbp
+    217f:	48 89 e5             	mov    %rsp,%rbp
+    2182:	48 83 ec 10          	sub    $0x10,%rsp
+    2186:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            inner_.inc();
+    218a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    218e:	48 89 c7             	mov    %rax,%rdi
+    2191:	e8 7e fe ff ff       	call   2014 <nel::SliceIterator<U8Buf<256ul> >::inc()>
+            ++current_;
+    2196:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    219a:	48 8b 40 10          	mov    0x10(%rax),%rax
+    219e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    21a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21a6:	48 89 50 10          	mov    %rdx,0x10(%rax)
+        }
+    21aa:	90                   	nop
+    21ab:	c9                   	leave
+    21ac:	c3                   	ret
+    21ad:	90                   	nop
+
+00000000000021ae <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::deref()>:
+
+        OutT deref(void)
+    21ae:	55                   	push   %rbp
+    21af:	48 89 e5             	mov    %rsp,%rbp
+    21b2:	48 83 ec 10          	sub    $0x10,%rsp
+    21b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return inner_.deref();
+    21ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21be:	48 89 c7             	mov    %rax,%rdi
+    21c1:	e8 6e fe ff ff       	call   2034 <nel::SliceIterator<U8Buf<256ul> >::deref()>
+        }
+    21c6:	c9                   	leave
+    21c7:	c3                   	ret
+
+00000000000021c8 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()::{lambda(auto:1&)#1}>(nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()::{lambda(auto:1&)#1}&&)>:
+        void for_each(F &&fn)
+    21c8:	       55                   	push   %rbp
+    21c9:	       48 89 e5             	mov    %rsp,%rbp
+    21cc:	       48 83 ec 10          	sub    $0x10,%rsp
+    21d0:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    21d4:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            for (; !self().is_done(); self().inc()) {
+    21d8:	   /-- eb 3a                	jmp    2214 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()::{lambda(auto:1&)#1}>(nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()::{lambda(auto:1&)#1}&&)+0x4c>
+                fn(self().deref());
+    21da:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21de:	|  |   48 89 c7             	mov    %rax,%rdi
+    21e1:	|  |   e8 e4 03 00 00       	call   25ca <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    21e6:	|  |   48 89 c7             	mov    %rax,%rdi
+    21e9:	|  |   e8 46 fe ff ff       	call   2034 <nel::SliceIterator<U8Buf<256ul> >::deref()>
+    21ee:	|  |   48 89 c2             	mov    %rax,%rdx
+    21f1:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    21f5:	|  |   48 89 d6             	mov    %rdx,%rsi
+    21f8:	|  |   48 89 c7             	mov    %rax,%rdi
+    21fb:	|  |   e8 3e 04 00 00       	call   263e <void nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()::{lambda(auto:1&)#1}::operator()<U8Buf<256ul> >(U8Buf<256ul>&) const>
+            for (; !self().is_done(); self().inc()) {
+    2200:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2204:	|  |   48 89 c7             	mov    %rax,%rdi
+    2207:	|  |   e8 be 03 00 00       	call   25ca <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    220c:	|  |   48 89 c7             	mov    %rax,%rdi
+    220f:	|  |   e8 00 fe ff ff       	call   2014 <nel::SliceIterator<U8Buf<256ul> >::inc()>
+    2214:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2218:	|      48 89 c7             	mov    %rax,%rdi
+    221b:	|      e8 aa 03 00 00       	call   25ca <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    2220:	|      48 89 c7             	mov    %rax,%rdi
+    2223:	|      e8 36 f9 ff ff       	call   1b5e <nel::SliceIterator<U8Buf<256ul> >::is_done() const>
+    2228:	|      83 f0 01             	xor    $0x1,%eax
+    222b:	|      84 c0                	test   %al,%al
+    222d:	\----- 75 ab                	jne    21da <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()::{lambda(auto:1&)#1}>(nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()::{lambda(auto:1&)#1}&&)+0x12>
+        }
+    222f:	       90                   	nop
+    2230:	       90                   	nop
+    2231:	       c9                   	leave
+    2232:	       c3                   	ret
+    2233:	       90                   	nop
+
+0000000000002234 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::slice() const>:
+        constexpr Slice<Type const> const slice(void) const
+    2234:	55                   	push   %rbp
+    2235:	48 89 e5             	mov    %rsp,%rbp
+    2238:	53                   	push   %rbx
+    2239:	48 83 ec 18          	sub    $0x18,%rsp
+    223d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2241:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return Slice(ptr(), len());
+    2245:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2249:	48 89 c7             	mov    %rax,%rdi
+    224c:	e8 fb f8 ff ff       	call   1b4c <nel::heapless::Vector<U8Buf<256ul>, 10ul>::len() const>
+    2251:	48 89 c3             	mov    %rax,%rbx
+    2254:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2258:	48 89 c7             	mov    %rax,%rdi
+    225b:	e8 fe 03 00 00       	call   265e <nel::heapless::Vector<U8Buf<256ul>, 10ul>::ptr() const>
+    2260:	48 89 c1             	mov    %rax,%rcx
+    2263:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2267:	48 89 da             	mov    %rbx,%rdx
+    226a:	48 89 ce             	mov    %rcx,%rsi
+    226d:	48 89 c7             	mov    %rax,%rdi
+    2270:	e8 07 04 00 00       	call   267c <nel::Slice<U8Buf<256ul> const>::Slice(U8Buf<256ul> const*, unsigned long)>
+        }
+    2275:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2279:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    227d:	c9                   	leave
+    227e:	c3                   	ret
+    227f:	90                   	nop
+
+0000000000002280 <nel::Slice<U8Buf<256ul> const>::iter() const>:
+        constexpr Iterator iter(void) const
+    2280:	55                   	push   %rbp
+    2281:	48 89 e5             	mov    %rsp,%rbp
+    2284:	53                   	push   %rbx
+    2285:	48 83 ec 18          	sub    $0x18,%rsp
+    2289:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    228d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return Iterator(ptr(), len());
+    2291:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2295:	48 89 c7             	mov    %rax,%rdi
+    2298:	e8 1b 04 00 00       	call   26b8 <nel::Slice<U8Buf<256ul> const>::len() const>
+    229d:	48 89 c3             	mov    %rax,%rbx
+    22a0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    22a4:	48 89 c7             	mov    %rax,%rdi
+    22a7:	e8 fa 03 00 00       	call   26a6 <nel::Slice<U8Buf<256ul> const>::ptr() const>
+    22ac:	48 89 c1             	mov    %rax,%rcx
+    22af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22b3:	48 89 da             	mov    %rbx,%rdx
+    22b6:	48 89 ce             	mov    %rcx,%rsi
+    22b9:	48 89 c7             	mov    %rax,%rdi
+    22bc:	e8 09 04 00 00       	call   26ca <nel::SliceIterator<U8Buf<256ul> const>::SliceIterator(U8Buf<256ul> const*, unsigned long)>
+        }
+    22c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    22c9:	c9                   	leave
+    22ca:	c3                   	ret
+    22cb:	90                   	nop
+
+00000000000022cc <nel::SliceIterator<U8Buf<256ul> const>::is_done() const>:
+        constexpr bool is_done(void) const
+    22cc:	55                   	push   %rbp
+    22cd:	48 89 e5             	mov    %rsp,%rbp
+    22d0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (b_ == e_);
+    22d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22d8:	48 8b 10             	mov    (%rax),%rdx
+    22db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22df:	48 8b 40 08          	mov    0x8(%rax),%rax
+    22e3:	48 39 c2             	cmp    %rax,%rdx
+    22e6:	0f 94 c0             	sete   %al
+        }
+    22e9:	5d                   	pop    %rbp
+    22ea:	c3                   	ret
+    22eb:	90                   	nop
+
+00000000000022ec <nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}::operator()(U8Buf<256ul> const&) const>:
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    22ec:	55                   	push   %rbp
+    22ed:	48 89 e5             	mov    %rsp,%rbp
+    22f0:	48 83 ec 10          	sub    $0x10,%rsp
+    22f4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    22f8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    22fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2300:	48 8b 00             	mov    (%rax),%rax
+    2303:	be 2c 00 00 00       	mov    $0x2c,%esi
+    2308:	48 89 c7             	mov    %rax,%rdi
+    230b:	e8 e0 0f 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+    2310:	48 89 c2             	mov    %rax,%rdx
+    2313:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2317:	48 89 c6             	mov    %rax,%rsi
+    231a:	48 89 d7             	mov    %rdx,%rdi
+    231d:	e8 23 fd ff ff       	call   2045 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    2322:	90                   	nop
+    2323:	c9                   	leave
+    2324:	c3                   	ret
+
+0000000000002325 <nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)>:
+        friend Log &operator<<(Log &outs, ItT const &it)
+    2325:	    55                   	push   %rbp
+    2326:	    48 89 e5             	mov    %rsp,%rbp
+    2329:	    48 83 ec 30          	sub    $0x30,%rsp
+    232d:	    48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    2331:	    48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+            outs << '[';
+    2335:	    48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2339:	    be 5b 00 00 00       	mov    $0x5b,%esi
+    233e:	    48 89 c7             	mov    %rax,%rdi
+    2341:	    e8 aa 0f 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+            ItT it2 = it;
+    2346:	    48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    234a:	    48 8b 50 08          	mov    0x8(%rax),%rdx
+    234e:	    48 8b 00             	mov    (%rax),%rax
+    2351:	    48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2355:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            if (!it2.is_done()) {
+    2359:	    48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    235d:	    48 89 c7             	mov    %rax,%rdi
+    2360:	    e8 67 ff ff ff       	call   22cc <nel::SliceIterator<U8Buf<256ul> const>::is_done() const>
+    2365:	    83 f0 01             	xor    $0x1,%eax
+    2368:	    84 c0                	test   %al,%al
+    236a:	/-- 74 45                	je     23b1 <nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)+0x8c>
+                outs << it2.deref();
+    236c:	|   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2370:	|   48 89 c7             	mov    %rax,%rdi
+    2373:	|   e8 8a 03 00 00       	call   2702 <nel::SliceIterator<U8Buf<256ul> const>::deref()>
+    2378:	|   48 89 c2             	mov    %rax,%rdx
+    237b:	|   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    237f:	|   48 89 d6             	mov    %rdx,%rsi
+    2382:	|   48 89 c7             	mov    %rax,%rdi
+    2385:	|   e8 bb fc ff ff       	call   2045 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+                it2.inc();
+    238a:	|   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    238e:	|   48 89 c7             	mov    %rax,%rdi
+    2391:	|   e8 7e 03 00 00       	call   2714 <nel::SliceIterator<U8Buf<256ul> const>::inc()>
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    2396:	|   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    239a:	|   48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    239e:	|   48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    23a2:	|   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    23a6:	|   48 89 d6             	mov    %rdx,%rsi
+    23a9:	|   48 89 c7             	mov    %rax,%rdi
+    23ac:	|   e8 83 03 00 00       	call   2734 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}>(nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}&&)>
+            outs << ']';
+    23b1:	\-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    23b5:	    be 5d 00 00 00       	mov    $0x5d,%esi
+    23ba:	    48 89 c7             	mov    %rax,%rdi
+    23bd:	    e8 2e 0f 00 00       	call   32f0 <nel::operator<<(nel::Log&, char)>
+            return outs;
+    23c2:	    48 8b 45 d8          	mov    -0x28(%rbp),%rax
+        }
+    23c6:	    c9                   	leave
+    23c7:	    c3                   	ret
+
+00000000000023c8 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::capacity() const>:
+        constexpr Count capacity(void) const
+    23c8:	55                   	push   %rbp
+    23c9:	48 89 e5             	mov    %rsp,%rbp
+    23cc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return N;
+    23d0:	b8 0a 00 00 00       	mov    $0xa,%eax
+        }
+    23d5:	5d                   	pop    %rbp
+    23d6:	c3                   	ret
+
+00000000000023d7 <nel::Result<void, U8Buf<256ul> >::Err(U8Buf<256ul>&&)>:
+        constexpr static Result Err(E &&v)
+    23d7:	55                   	push   %rbp
+    23d8:	48 89 e5             	mov    %rsp,%rbp
+    23db:	48 83 ec 10          	sub    $0x10,%rsp
+    23df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    23e3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<E>(v));
+    23e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    23eb:	48 89 c7             	mov    %rax,%rdi
+    23ee:	e8 ac 03 00 00       	call   279f <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    23f3:	48 89 c2             	mov    %rax,%rdx
+    23f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23fa:	48 89 d6             	mov    %rdx,%rsi
+    23fd:	48 89 c7             	mov    %rax,%rdi
+    2400:	e8 a9 03 00 00       	call   27ae <nel::Result<void, U8Buf<256ul> >::Result(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)2>, U8Buf<256ul>&&)>
+        }
+    2405:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2409:	c9                   	leave
+    240a:	c3                   	ret
+    240b:	90                   	nop
+
+000000000000240c <nel::heapless::Vector<U8Buf<256ul>, 10ul>::end()>:
+        constexpr Type *end()
+    240c:	55                   	push   %rbp
+    240d:	48 89 e5             	mov    %rsp,%rbp
+    2410:	48 83 ec 10          	sub    $0x10,%rsp
+    2414:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ptr(len_);
+    2418:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    241c:	48 8b 00             	mov    (%rax),%rax
+    241f:	48 89 c2             	mov    %rax,%rdx
+    2422:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2426:	48 89 d6             	mov    %rdx,%rsi
+    2429:	48 89 c7             	mov    %rax,%rdi
+    242c:	e8 bf 03 00 00       	call   27f0 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::ptr(long)>
+        }
+    2431:	c9                   	leave
+    2432:	c3                   	ret
+    2433:	90                   	nop
+
+0000000000002434 <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>:
+        constexpr U8Buf(U8Buf &&o)
+    2434:	55                   	push   %rbp
+    2435:	48 89 e5             	mov    %rsp,%rbp
+    2438:	48 83 ec 10          	sub    $0x10,%rsp
+    243c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2440:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            nel::elem::move(data_, o.data_, N);
+    2444:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2448:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    244c:	ba 00 01 00 00       	mov    $0x100,%edx
+    2451:	48 89 ce             	mov    %rcx,%rsi
+    2454:	48 89 c7             	mov    %rax,%rdi
+    2457:	e8 9a 06 00 00       	call   2af6 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+        }
+    245c:	90                   	nop
+    245d:	c9                   	leave
+    245e:	c3                   	ret
+
+000000000000245f <nel::Result<void, U8Buf<256ul> >::Ok()>:
+        constexpr static Result Ok(void)
+    245f:	55                   	push   %rbp
+    2460:	48 89 e5             	mov    %rsp,%rbp
+    2463:	48 83 ec 10          	sub    $0x10,%rsp
+    2467:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Result(Phantom<Tag::OK>());
+    246b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    246f:	48 89 c7             	mov    %rax,%rdi
+    2472:	e8 a3 03 00 00       	call   281a <nel::Result<void, U8Buf<256ul> >::Result(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)1>)>
+        }
+    2477:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    247b:	c9                   	leave
+    247c:	c3                   	ret
+    247d:	90                   	nop
+
+000000000000247e <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    247e:	             55                   	push   %rbp
+    247f:	             48 89 e5             	mov    %rsp,%rbp
+    2482:	             48 83 ec 20          	sub    $0x20,%rsp
+    2486:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    248a:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    248e:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2492:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result<void>-match
+    2496:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    249a:	             8b 00                	mov    (%rax),%eax
+    249c:	             83 f8 02             	cmp    $0x2,%eax
+    249f:	         /-- 74 1c                	je     24bd <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x3f>
+    24a1:	         |   83 f8 02             	cmp    $0x2,%eax
+    24a4:	/--------|-- 7f 51                	jg     24f7 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x79>
+    24a6:	|        |   85 c0                	test   %eax,%eax
+    24a8:	|     /--|-- 74 37                	je     24e1 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x63>
+    24aa:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    24ad:	+-----|--|-- 75 48                	jne    24f7 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x79>
+                    return on_ok();
+    24af:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    24b3:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    24b6:	|     |  |   e8 a3 f9 ff ff       	call   1e5e <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}::operator()() const>
+    24bb:	|  /--|--|-- eb 50                	jmp    250d <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_err(*err_);
+    24bd:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24c1:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    24c5:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    24c8:	|  |  |      e8 63 03 00 00       	call   2830 <nel::Element<U8Buf<256ul> >::operator*() const>
+    24cd:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    24d0:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24d4:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    24d7:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    24da:	|  |  |      e8 8f f9 ff ff       	call   1e6e <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}::operator()(U8Buf<256ul> const&) const>
+    24df:	|  +--|----- eb 2c                	jmp    250d <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x8f>
+                    nel::panic("invalid Result", ctx);
+    24e1:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    24e5:	|  |         48 89 c6             	mov    %rax,%rsi
+    24e8:	|  |         48 8d 05 1c 1c 00 00 	lea    0x1c1c(%rip),%rax        # 410b <nel::sort::ninther_n+0xeb>
+    24ef:	|  |         48 89 c7             	mov    %rax,%rdi
+    24f2:	|  |         e8 ed 04 00 00       	call   29e4 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    24f7:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    24fb:	   |         48 89 c6             	mov    %rax,%rsi
+    24fe:	   |         48 8d 05 c6 1b 00 00 	lea    0x1bc6(%rip),%rax        # 40cb <nel::sort::ninther_n+0xab>
+    2505:	   |         48 89 c7             	mov    %rax,%rdi
+    2508:	   |         e8 d7 04 00 00       	call   29e4 <nel::panic(char const*, nel::Context const&)>
+        }
+    250d:	   \-------> c9                   	leave
+    250e:	             c3                   	ret
+    250f:	             90                   	nop
+
+0000000000002510 <nel::Optional<U8Buf<256ul> >::Optional(nel::NoneT const&)>:
+        /**
+         * Create an optional set to none.
+         *
+         * @returns an Optional 'wrapping' a None
+         */
+        constexpr Optional(NoneT const &)
+    2510:	55                   	push   %rbp
+    2511:	48 89 e5             	mov    %rsp,%rbp
+    2514:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2518:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : tag_(Tag::NONE)
+    251c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2520:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+        {
+        }
+    2526:	90                   	nop
+    2527:	5d                   	pop    %rbp
+    2528:	c3                   	ret
+
+0000000000002529 <nel::Optional<U8Buf<256ul> > nel::Some<U8Buf<256ul> >(U8Buf<256ul>&&)>:
+            return outs;
+        }
+};
+
+template<typename T>
+constexpr Optional<T> Some(T &&v)
+    2529:	55                   	push   %rbp
+    252a:	48 89 e5             	mov    %rsp,%rbp
+    252d:	48 83 ec 10          	sub    $0x10,%rsp
+    2531:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2535:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+{
+    return Optional<T>::Some(forward<T>(v));
+    2539:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    253d:	48 89 c7             	mov    %rax,%rdi
+    2540:	e8 5a 02 00 00       	call   279f <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    2545:	48 89 c2             	mov    %rax,%rdx
+    2548:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    254c:	48 89 d6             	mov    %rdx,%rsi
+    254f:	48 89 c7             	mov    %rax,%rdi
+    2552:	e8 f3 02 00 00       	call   284a <nel::Optional<U8Buf<256ul> >::Some(U8Buf<256ul>&&)>
+}
+    2557:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    255b:	c9                   	leave
+    255c:	c3                   	ret
+    255d:	90                   	nop
+
+000000000000255e <nel::Slice<U8Buf<256ul> >::ptr() const>:
+        constexpr Type *ptr(void) const
+    255e:	55                   	push   %rbp
+    255f:	48 89 e5             	mov    %rsp,%rbp
+    2562:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return content_;
+    2566:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    256a:	48 8b 00             	mov    (%rax),%rax
+        }
+    256d:	5d                   	pop    %rbp
+    256e:	c3                   	ret
+    256f:	90                   	nop
+
+0000000000002570 <nel::Slice<U8Buf<256ul> >::len() const>:
+        constexpr Length len(void) const
+    2570:	55                   	push   %rbp
+    2571:	48 89 e5             	mov    %rsp,%rbp
+    2574:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    2578:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    257c:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    2580:	5d                   	pop    %rbp
+    2581:	c3                   	ret
+
+0000000000002582 <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(U8Buf<256ul>*, unsigned long)>:
+        constexpr SliceIterator(T arr[], Count len)
+    2582:	55                   	push   %rbp
+    2583:	48 89 e5             	mov    %rsp,%rbp
+    2586:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    258a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    258e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : b_(arr)
+    2592:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2596:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    259a:	48 89 10             	mov    %rdx,(%rax)
+            , e_(arr + len)
+    259d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25a1:	48 c1 e0 08          	shl    $0x8,%rax
+    25a5:	48 89 c2             	mov    %rax,%rdx
+    25a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25ac:	48 01 c2             	add    %rax,%rdx
+    25af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25b3:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    25b7:	90                   	nop
+    25b8:	5d                   	pop    %rbp
+    25b9:	c3                   	ret
+
+00000000000025ba <U8Buf<256ul>::len() const>:
+        constexpr Length len(void) const
+    25ba:	55                   	push   %rbp
+    25bb:	48 89 e5             	mov    %rsp,%rbp
+    25be:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return N;
+    25c2:	b8 00 01 00 00       	mov    $0x100,%eax
+        }
+    25c7:	5d                   	pop    %rbp
+    25c8:	c3                   	ret
+    25c9:	90                   	nop
+
+00000000000025ca <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>:
+        constexpr ItT &self(void)
+    25ca:	55                   	push   %rbp
+    25cb:	48 89 e5             	mov    %rsp,%rbp
+    25ce:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    25d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25d6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    25da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    25de:	5d                   	pop    %rbp
+    25df:	c3                   	ret
+
+00000000000025e0 <nel::SliceIterator<U8Buf<256ul> >&& nel::move<nel::SliceIterator<U8Buf<256ul> > >(nel::SliceIterator<U8Buf<256ul> >&)>:
+constexpr T &&move(T &v)
+    25e0:	55                   	push   %rbp
+    25e1:	48 89 e5             	mov    %rsp,%rbp
+    25e4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    25e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    25ec:	5d                   	pop    %rbp
+    25ed:	c3                   	ret
+
+00000000000025ee <nel::FirstNIterator<nel::SliceIterator<U8Buf<256ul> > >::FirstNIterator(nel::SliceIterator<U8Buf<256ul> >&&, unsigned long)>:
+        constexpr FirstNIterator(It &&inner, Length limit)
+    25ee:	55                   	push   %rbp
+    25ef:	48 89 e5             	mov    %rsp,%rbp
+    25f2:	53                   	push   %rbx
+    25f3:	48 83 ec 28          	sub    $0x28,%rsp
+    25f7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    25fb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    25ff:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            : inner_(move(inner))
+    2603:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    2607:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    260b:	48 89 c7             	mov    %rax,%rdi
+    260e:	e8 cd ff ff ff       	call   25e0 <nel::SliceIterator<U8Buf<256ul> >&& nel::move<nel::SliceIterator<U8Buf<256ul> > >(nel::SliceIterator<U8Buf<256ul> >&)>
+    2613:	48 89 c6             	mov    %rax,%rsi
+    2616:	48 89 df             	mov    %rbx,%rdi
+    2619:	e8 60 02 00 00       	call   287e <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(nel::SliceIterator<U8Buf<256ul> >&&)>
+            , current_(0)
+    261e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2622:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+    2629:	00 
+            , limit_(limit)
+    262a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    262e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2632:	48 89 50 18          	mov    %rdx,0x18(%rax)
+        }
+    2636:	90                   	nop
+    2637:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    263b:	c9                   	leave
+    263c:	c3                   	ret
+    263d:	90                   	nop
+
+000000000000263e <void nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()::{lambda(auto:1&)#1}::operator()<U8Buf<256ul> >(U8Buf<256ul>&) const>:
+            iter().for_each([&](auto &v) -> void { v.~Type(); });
+    263e:	55                   	push   %rbp
+    263f:	48 89 e5             	mov    %rsp,%rbp
+    2642:	48 83 ec 10          	sub    $0x10,%rsp
+    2646:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    264a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    264e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2652:	48 89 c7             	mov    %rax,%rdi
+    2655:	e8 8c f6 ff ff       	call   1ce6 <U8Buf<256ul>::~U8Buf()>
+    265a:	90                   	nop
+    265b:	c9                   	leave
+    265c:	c3                   	ret
+    265d:	90                   	nop
+
+000000000000265e <nel::heapless::Vector<U8Buf<256ul>, 10ul>::ptr() const>:
+        constexpr Type const *ptr() const
+    265e:	55                   	push   %rbp
+    265f:	48 89 e5             	mov    %rsp,%rbp
+    2662:	48 83 ec 10          	sub    $0x10,%rsp
+    2666:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return elems_.ptr()[0];
+    266a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    266e:	48 83 c0 08          	add    $0x8,%rax
+    2672:	48 89 c7             	mov    %rax,%rdi
+    2675:	e8 60 02 00 00       	call   28da <nel::Manual<U8Buf<256ul> [10]>::ptr() const>
+        }
+    267a:	c9                   	leave
+    267b:	c3                   	ret
+
+000000000000267c <nel::Slice<U8Buf<256ul> const>::Slice(U8Buf<256ul> const*, unsigned long)>:
+        constexpr Slice(Type *const p, Length len)
+    267c:	55                   	push   %rbp
+    267d:	48 89 e5             	mov    %rsp,%rbp
+    2680:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2684:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2688:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : content_(p)
+    268c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2690:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2694:	48 89 10             	mov    %rdx,(%rax)
+            , len_(len)
+    2697:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    269b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    269f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    26a3:	90                   	nop
+    26a4:	5d                   	pop    %rbp
+    26a5:	c3                   	ret
+
+00000000000026a6 <nel::Slice<U8Buf<256ul> const>::ptr() const>:
+        constexpr Type *ptr(void) const
+    26a6:	55                   	push   %rbp
+    26a7:	48 89 e5             	mov    %rsp,%rbp
+    26aa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return content_;
+    26ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26b2:	48 8b 00             	mov    (%rax),%rax
+        }
+    26b5:	5d                   	pop    %rbp
+    26b6:	c3                   	ret
+    26b7:	90                   	nop
+
+00000000000026b8 <nel::Slice<U8Buf<256ul> const>::len() const>:
+        constexpr Length len(void) const
+    26b8:	55                   	push   %rbp
+    26b9:	48 89 e5             	mov    %rsp,%rbp
+    26bc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    26c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26c4:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    26c8:	5d                   	pop    %rbp
+    26c9:	c3                   	ret
+
+00000000000026ca <nel::SliceIterator<U8Buf<256ul> const>::SliceIterator(U8Buf<256ul> const*, unsigned long)>:
+        constexpr SliceIterator(T arr[], Count len)
+    26ca:	55                   	push   %rbp
+    26cb:	48 89 e5             	mov    %rsp,%rbp
+    26ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    26d2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    26d6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : b_(arr)
+    26da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26de:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    26e2:	48 89 10             	mov    %rdx,(%rax)
+            , e_(arr + len)
+    26e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26e9:	48 c1 e0 08          	shl    $0x8,%rax
+    26ed:	48 89 c2             	mov    %rax,%rdx
+    26f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26f4:	48 01 c2             	add    %rax,%rdx
+    26f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26fb:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    26ff:	90                   	nop
+    2700:	5d                   	pop    %rbp
+    2701:	c3                   	ret
+
+0000000000002702 <nel::SliceIterator<U8Buf<256ul> const>::deref()>:
+        OutT deref(void)
+    2702:	55                   	push   %rbp
+    2703:	48 89 e5             	mov    %rsp,%rbp
+    2706:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return *b_;
+    270a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    270e:	48 8b 00             	mov    (%rax),%rax
+        }
+    2711:	5d                   	pop    %rbp
+    2712:	c3                   	ret
+    2713:	90                   	nop
+
+0000000000002714 <nel::SliceIterator<U8Buf<256ul> const>::inc()>:
+        void inc(void)
+    2714:	55                   	push   %rbp
+    2715:	48 89 e5             	mov    %rsp,%rbp
+    2718:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            ++b_;
+    271c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2720:	48 8b 00             	mov    (%rax),%rax
+    2723:	48 8d 90 00 01 00 00 	lea    0x100(%rax),%rdx
+    272a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    272e:	48 89 10             	mov    %rdx,(%rax)
+        }
+    2731:	90                   	nop
+    2732:	5d                   	pop    %rbp
+    2733:	c3                   	ret
+
+0000000000002734 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}>(nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}&&)>:
+        void for_each(F &&fn)
+    2734:	       55                   	push   %rbp
+    2735:	       48 89 e5             	mov    %rsp,%rbp
+    2738:	       48 83 ec 10          	sub    $0x10,%rsp
+    273c:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2740:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            for (; !self().is_done(); self().inc()) {
+    2744:	   /-- eb 3a                	jmp    2780 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}>(nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}&&)+0x4c>
+                fn(self().deref());
+    2746:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    274a:	|  |   48 89 c7             	mov    %rax,%rdi
+    274d:	|  |   e8 96 01 00 00       	call   28e8 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::self()>
+    2752:	|  |   48 89 c7             	mov    %rax,%rdi
+    2755:	|  |   e8 a8 ff ff ff       	call   2702 <nel::SliceIterator<U8Buf<256ul> const>::deref()>
+    275a:	|  |   48 89 c2             	mov    %rax,%rdx
+    275d:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2761:	|  |   48 89 d6             	mov    %rdx,%rsi
+    2764:	|  |   48 89 c7             	mov    %rax,%rdi
+    2767:	|  |   e8 80 fb ff ff       	call   22ec <nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}::operator()(U8Buf<256ul> const&) const>
+            for (; !self().is_done(); self().inc()) {
+    276c:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2770:	|  |   48 89 c7             	mov    %rax,%rdi
+    2773:	|  |   e8 70 01 00 00       	call   28e8 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::self()>
+    2778:	|  |   48 89 c7             	mov    %rax,%rdi
+    277b:	|  |   e8 94 ff ff ff       	call   2714 <nel::SliceIterator<U8Buf<256ul> const>::inc()>
+    2780:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2784:	|      48 89 c7             	mov    %rax,%rdi
+    2787:	|      e8 5c 01 00 00       	call   28e8 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::self()>
+    278c:	|      48 89 c7             	mov    %rax,%rdi
+    278f:	|      e8 38 fb ff ff       	call   22cc <nel::SliceIterator<U8Buf<256ul> const>::is_done() const>
+    2794:	|      83 f0 01             	xor    $0x1,%eax
+    2797:	|      84 c0                	test   %al,%al
+    2799:	\----- 75 ab                	jne    2746 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}>(nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}&&)+0x12>
+        }
+    279b:	       90                   	nop
+    279c:	       90                   	nop
+    279d:	       c9                   	leave
+    279e:	       c3                   	ret
+
+000000000000279f <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel so to not need std.
+ */
+template<typename U, typename T>
+constexpr U &&forward(T &t)
+    279f:	55                   	push   %rbp
+    27a0:	48 89 e5             	mov    %rsp,%rbp
+    27a3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<U &&>(t);
+    27a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    27ab:	5d                   	pop    %rbp
+    27ac:	c3                   	ret
+    27ad:	90                   	nop
+
+00000000000027ae <nel::Result<void, U8Buf<256ul> >::Result(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)2>, U8Buf<256ul>&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    27ae:	55                   	push   %rbp
+    27af:	48 89 e5             	mov    %rsp,%rbp
+    27b2:	53                   	push   %rbx
+    27b3:	48 83 ec 18          	sub    $0x18,%rsp
+    27b7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    27bb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    27bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27c3:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    27c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27cd:	48 8d 58 04          	lea    0x4(%rax),%rbx
+    27d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    27d5:	48 89 c7             	mov    %rax,%rdi
+    27d8:	e8 c2 ff ff ff       	call   279f <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    27dd:	48 89 c6             	mov    %rax,%rsi
+    27e0:	48 89 df             	mov    %rbx,%rdi
+    27e3:	e8 16 01 00 00       	call   28fe <nel::Element<U8Buf<256ul> >::Element(U8Buf<256ul>&&)>
+        }
+    27e8:	90                   	nop
+    27e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    27ed:	c9                   	leave
+    27ee:	c3                   	ret
+    27ef:	90                   	nop
+
+00000000000027f0 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::ptr(long)>:
+        constexpr Type *ptr(ptrdiff_t d)
+    27f0:	55                   	push   %rbp
+    27f1:	48 89 e5             	mov    %rsp,%rbp
+    27f4:	48 83 ec 10          	sub    $0x10,%rsp
+    27f8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    27fc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return &ptr()[d];
+    2800:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2804:	48 89 c7             	mov    %rax,%rdi
+    2807:	e8 14 f3 ff ff       	call   1b20 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::ptr()>
+    280c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2810:	48 c1 e2 08          	shl    $0x8,%rdx
+    2814:	48 01 d0             	add    %rdx,%rax
+        }
+    2817:	c9                   	leave
+    2818:	c3                   	ret
+    2819:	90                   	nop
+
+000000000000281a <nel::Result<void, U8Buf<256ul> >::Result(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)1>)>:
+        constexpr Result(Phantom<Tag::OK> const)
+    281a:	55                   	push   %rbp
+    281b:	48 89 e5             	mov    %rsp,%rbp
+    281e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : tag_(Tag::OK)
+    2822:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2826:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+        }
+    282c:	90                   	nop
+    282d:	5d                   	pop    %rbp
+    282e:	c3                   	ret
+    282f:	90                   	nop
+
+0000000000002830 <nel::Element<U8Buf<256ul> >::operator*() const>:
+        constexpr Type &ref(void)
+        {
+            return value_;
+        }
+
+        constexpr Type const &operator*(void) const
+    2830:	55                   	push   %rbp
+    2831:	48 89 e5             	mov    %rsp,%rbp
+    2834:	48 83 ec 10          	sub    $0x10,%rsp
+    2838:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    283c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2840:	48 89 c7             	mov    %rax,%rdi
+    2843:	e8 ea 00 00 00       	call   2932 <nel::Element<U8Buf<256ul> >::ref() const>
+        }
+    2848:	c9                   	leave
+    2849:	c3                   	ret
+
+000000000000284a <nel::Optional<U8Buf<256ul> >::Some(U8Buf<256ul>&&)>:
+        constexpr static Optional Some(T &&v)
+    284a:	55                   	push   %rbp
+    284b:	48 89 e5             	mov    %rsp,%rbp
+    284e:	48 83 ec 10          	sub    $0x10,%rsp
+    2852:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2856:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Optional(Phantom<Tag::SOME>(), forward<T>(v));
+    285a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    285e:	48 89 c7             	mov    %rax,%rdi
+    2861:	e8 39 ff ff ff       	call   279f <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    2866:	48 89 c2             	mov    %rax,%rdx
+    2869:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    286d:	48 89 d6             	mov    %rdx,%rsi
+    2870:	48 89 c7             	mov    %rax,%rdi
+    2873:	e8 c8 00 00 00       	call   2940 <nel::Optional<U8Buf<256ul> >::Optional(nel::Optional<U8Buf<256ul> >::Phantom<(nel::Optional<U8Buf<256ul> >::Tag)2>, U8Buf<256ul>&&)>
+        }
+    2878:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    287c:	c9                   	leave
+    287d:	c3                   	ret
+
+000000000000287e <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(nel::SliceIterator<U8Buf<256ul> >&&)>:
+        SliceIterator(SliceIterator &&o)
+    287e:	55                   	push   %rbp
+    287f:	48 89 e5             	mov    %rsp,%rbp
+    2882:	48 83 ec 10          	sub    $0x10,%rsp
+    2886:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    288a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : b_(move(o.b_))
+    288e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2892:	48 89 c7             	mov    %rax,%rdi
+    2895:	e8 e7 00 00 00       	call   2981 <U8Buf<256ul>*&& nel::move<U8Buf<256ul>*>(U8Buf<256ul>*&)>
+    289a:	48 8b 10             	mov    (%rax),%rdx
+    289d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28a1:	48 89 10             	mov    %rdx,(%rax)
+            , e_(move(o.e_))
+    28a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    28a8:	48 83 c0 08          	add    $0x8,%rax
+    28ac:	48 89 c7             	mov    %rax,%rdi
+    28af:	e8 cd 00 00 00       	call   2981 <U8Buf<256ul>*&& nel::move<U8Buf<256ul>*>(U8Buf<256ul>*&)>
+    28b4:	48 8b 10             	mov    (%rax),%rdx
+    28b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28bb:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            o.b_ = nullptr;
+    28bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    28c3:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+            o.e_ = nullptr;
+    28ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    28ce:	48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    28d5:	00 
+        }
+    28d6:	90                   	nop
+    28d7:	c9                   	leave
+    28d8:	c3                   	ret
+    28d9:	90                   	nop
+
+00000000000028da <nel::Manual<U8Buf<256ul> [10]>::ptr() const>:
+
+        constexpr Type const *ptr() const
+    28da:	55                   	push   %rbp
+    28db:	48 89 e5             	mov    %rsp,%rbp
+    28de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return &u_.elem_;
+    28e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    28e6:	5d                   	pop    %rbp
+    28e7:	c3                   	ret
+
+00000000000028e8 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::self()>:
+        constexpr ItT &self(void)
+    28e8:	55                   	push   %rbp
+    28e9:	48 89 e5             	mov    %rsp,%rbp
+    28ec:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    28f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28f4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    28f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    28fc:	5d                   	pop    %rbp
+    28fd:	c3                   	ret
+
+00000000000028fe <nel::Element<U8Buf<256ul> >::Element(U8Buf<256ul>&&)>:
+        constexpr Element(Type &&val)
+    28fe:	55                   	push   %rbp
+    28ff:	48 89 e5             	mov    %rsp,%rbp
+    2902:	53                   	push   %rbx
+    2903:	48 83 ec 18          	sub    $0x18,%rsp
+    2907:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    290b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : value_(forward<Type>(val))
+    290f:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    2913:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2917:	48 89 c7             	mov    %rax,%rdi
+    291a:	e8 80 fe ff ff       	call   279f <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    291f:	48 89 c6             	mov    %rax,%rsi
+    2922:	48 89 df             	mov    %rbx,%rdi
+    2925:	e8 0a fb ff ff       	call   2434 <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>
+        }
+    292a:	90                   	nop
+    292b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    292f:	c9                   	leave
+    2930:	c3                   	ret
+    2931:	90                   	nop
+
+0000000000002932 <nel::Element<U8Buf<256ul> >::ref() const>:
+        constexpr Type const &ref(void) const
+    2932:	55                   	push   %rbp
+    2933:	48 89 e5             	mov    %rsp,%rbp
+    2936:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    293a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    293e:	5d                   	pop    %rbp
+    293f:	c3                   	ret
+
+0000000000002940 <nel::Optional<U8Buf<256ul> >::Optional(nel::Optional<U8Buf<256ul> >::Phantom<(nel::Optional<U8Buf<256ul> >::Tag)2>, U8Buf<256ul>&&)>:
+        constexpr Optional(Phantom<Tag::SOME> const, T &&v)
+    2940:	55                   	push   %rbp
+    2941:	48 89 e5             	mov    %rsp,%rbp
+    2944:	53                   	push   %rbx
+    2945:	48 83 ec 18          	sub    $0x18,%rsp
+    2949:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    294d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::SOME)
+    2951:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2955:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , some_(forward<T>(v))
+    295b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    295f:	48 8d 58 04          	lea    0x4(%rax),%rbx
+    2963:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2967:	48 89 c7             	mov    %rax,%rdi
+    296a:	e8 30 fe ff ff       	call   279f <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    296f:	48 89 c6             	mov    %rax,%rsi
+    2972:	48 89 df             	mov    %rbx,%rdi
+    2975:	e8 84 ff ff ff       	call   28fe <nel::Element<U8Buf<256ul> >::Element(U8Buf<256ul>&&)>
+        }
+    297a:	90                   	nop
+    297b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    297f:	c9                   	leave
+    2980:	c3                   	ret
+
+0000000000002981 <U8Buf<256ul>*&& nel::move<U8Buf<256ul>*>(U8Buf<256ul>*&)>:
+constexpr T &&move(T &v)
+    2981:	55                   	push   %rbp
+    2982:	48 89 e5             	mov    %rsp,%rbp
+    2985:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    2989:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    298d:	5d                   	pop    %rbp
+    298e:	c3                   	ret
+
+000000000000298f <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    298f:	55                   	push   %rbp
+    2990:	48 89 e5             	mov    %rsp,%rbp
+    std::abort();
+    2993:	e8 a8 e6 ff ff       	call   1040 <abort@plt>
+
+0000000000002998 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    2998:	55                   	push   %rbp
+    2999:	48 89 e5             	mov    %rsp,%rbp
+    299c:	48 83 ec 10          	sub    $0x10,%rsp
+    29a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    29a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29a8:	48 8b 30             	mov    (%rax),%rsi
+    29ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29af:	8b 48 10             	mov    0x10(%rax),%ecx
+    29b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29b6:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    29ba:	48 8b 05 9f 46 00 00 	mov    0x469f(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    29c1:	4c 8d 0d 52 17 00 00 	lea    0x1752(%rip),%r9        # 411a <nel::sort::ninther_n+0xfa>
+    29c8:	49 89 f0             	mov    %rsi,%r8
+    29cb:	48 8d 35 4e 17 00 00 	lea    0x174e(%rip),%rsi        # 4120 <nel::sort::ninther_n+0x100>
+    29d2:	48 89 c7             	mov    %rax,%rdi
+    29d5:	b8 00 00 00 00       	mov    $0x0,%eax
+    29da:	e8 b1 e6 ff ff       	call   1090 <fprintf@plt>
+    abort();
+    29df:	e8 ab ff ff ff       	call   298f <nel::abort()>
+
+00000000000029e4 <nel::panic(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    29e4:	55                   	push   %rbp
+    29e5:	48 89 e5             	mov    %rsp,%rbp
+    29e8:	48 83 ec 10          	sub    $0x10,%rsp
+    29ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    29f0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    29f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    29f8:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    29fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    29ff:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    2a02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a06:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    2a0a:	48 8b 05 4f 46 00 00 	mov    0x464f(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    2a11:	48 83 ec 08          	sub    $0x8,%rsp
+    2a15:	ff 75 f8             	push   -0x8(%rbp)
+    2a18:	4c 8d 0d fb 16 00 00 	lea    0x16fb(%rip),%r9        # 411a <nel::sort::ninther_n+0xfa>
+    2a1f:	49 89 f0             	mov    %rsi,%r8
+    2a22:	48 8d 35 08 17 00 00 	lea    0x1708(%rip),%rsi        # 4131 <nel::sort::ninther_n+0x111>
+    2a29:	48 89 c7             	mov    %rax,%rdi
+    2a2c:	b8 00 00 00 00       	mov    $0x0,%eax
+    2a31:	e8 5a e6 ff ff       	call   1090 <fprintf@plt>
+    2a36:	48 83 c4 10          	add    $0x10,%rsp
+            "PANIC",
+            msg);
+    abort();
+    2a3a:	e8 50 ff ff ff       	call   298f <nel::abort()>
+
+0000000000002a3f <nel::assert_fail(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    2a3f:	55                   	push   %rbp
+    2a40:	48 89 e5             	mov    %rsp,%rbp
+    2a43:	48 83 ec 10          	sub    $0x10,%rsp
+    2a47:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2a4b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    2a4f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a53:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    2a56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a5a:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    2a5d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a61:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    2a65:	48 8b 05 f4 45 00 00 	mov    0x45f4(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    2a6c:	48 83 ec 08          	sub    $0x8,%rsp
+    2a70:	ff 75 f8             	push   -0x8(%rbp)
+    2a73:	4c 8d 0d cc 16 00 00 	lea    0x16cc(%rip),%r9        # 4146 <nel::sort::ninther_n+0x126>
+    2a7a:	49 89 f0             	mov    %rsi,%r8
+    2a7d:	48 8d 35 ad 16 00 00 	lea    0x16ad(%rip),%rsi        # 4131 <nel::sort::ninther_n+0x111>
+    2a84:	48 89 c7             	mov    %rax,%rdi
+    2a87:	b8 00 00 00 00       	mov    $0x0,%eax
+    2a8c:	e8 ff e5 ff ff       	call   1090 <fprintf@plt>
+    2a91:	48 83 c4 10          	add    $0x10,%rsp
+            "ASSERT FAIL",
+            msg);
+    abort();
+    2a95:	e8 f5 fe ff ff       	call   298f <nel::abort()>
+
+0000000000002a9a <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    2a9a:	55                   	push   %rbp
+    2a9b:	48 89 e5             	mov    %rsp,%rbp
+    2a9e:	48 83 ec 20          	sub    $0x20,%rsp
+    2aa2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2aa6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2aaa:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    2aae:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2ab2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2ab6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2aba:	48 89 ce             	mov    %rcx,%rsi
+    2abd:	48 89 c7             	mov    %rax,%rdi
+    2ac0:	e8 db e5 ff ff       	call   10a0 <memcpy@plt>
+}
+    2ac5:	90                   	nop
+    2ac6:	c9                   	leave
+    2ac7:	c3                   	ret
+
+0000000000002ac8 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    2ac8:	55                   	push   %rbp
+    2ac9:	48 89 e5             	mov    %rsp,%rbp
+    2acc:	48 83 ec 20          	sub    $0x20,%rsp
+    2ad0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2ad4:	89 f0                	mov    %esi,%eax
+    2ad6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2ada:	88 45 f4             	mov    %al,-0xc(%rbp)
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    2add:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    2ae1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2ae5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ae9:	89 ce                	mov    %ecx,%esi
+    2aeb:	48 89 c7             	mov    %rax,%rdi
+    2aee:	e8 6d e5 ff ff       	call   1060 <memset@plt>
+}
+    2af3:	90                   	nop
+    2af4:	c9                   	leave
+    2af5:	c3                   	ret
+
+0000000000002af6 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    2af6:	55                   	push   %rbp
+    2af7:	48 89 e5             	mov    %rsp,%rbp
+    2afa:	48 83 ec 20          	sub    $0x20,%rsp
+    2afe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2b02:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2b06:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    //     *id = *is;
+    // }
+    // for (uint8_t *id = d, *is = s, *const e = (d + n); id != e; ++is, ++id) {
+    //     *is = 0xa5;
+    // }
+    copy(d, s, n);
+    2b0a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2b0e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2b12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b16:	48 89 ce             	mov    %rcx,%rsi
+    2b19:	48 89 c7             	mov    %rax,%rdi
+    2b1c:	e8 79 ff ff ff       	call   2a9a <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    poison(s, n);
+    2b21:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2b25:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b29:	48 89 d6             	mov    %rdx,%rsi
+    2b2c:	48 89 c7             	mov    %rax,%rdi
+    2b2f:	e8 60 07 00 00       	call   3294 <nel::elem::poison(unsigned char*, unsigned long)>
+}
+    2b34:	90                   	nop
+    2b35:	c9                   	leave
+    2b36:	c3                   	ret
+
+0000000000002b37 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    2b37:	55                   	push   %rbp
+    2b38:	48 89 e5             	mov    %rsp,%rbp
+    2b3b:	48 83 ec 20          	sub    $0x20,%rsp
+    2b3f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2b43:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2b47:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    std::memmove(d, s, n);
+    2b4b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2b4f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2b53:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b57:	48 89 ce             	mov    %rcx,%rsi
+    2b5a:	48 89 c7             	mov    %rax,%rdi
+    2b5d:	e8 5e e5 ff ff       	call   10c0 <memmove@plt>
+}
+    2b62:	90                   	nop
+    2b63:	c9                   	leave
+    2b64:	c3                   	ret
+
+0000000000002b65 <nel::elem::wipe(unsigned char*, unsigned long)>:
+
+void wipe(uint8_t *const d, Length const n)
+{
+    2b65:	55                   	push   %rbp
+    2b66:	48 89 e5             	mov    %rsp,%rbp
+    2b69:	48 83 ec 10          	sub    $0x10,%rsp
+    2b6d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2b71:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    set(d, 0xa5, n);
+    2b75:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2b79:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b7d:	be a5 00 00 00       	mov    $0xa5,%esi
+    2b82:	48 89 c7             	mov    %rax,%rdi
+    2b85:	e8 3e ff ff ff       	call   2ac8 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    2b8a:	90                   	nop
+    2b8b:	c9                   	leave
+    2b8c:	c3                   	ret
+
+0000000000002b8d <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    2b8d:	55                   	push   %rbp
+    2b8e:	48 89 e5             	mov    %rsp,%rbp
+    2b91:	48 83 ec 20          	sub    $0x20,%rsp
+    2b95:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2b99:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2b9d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    2ba1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2ba5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2ba9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2bad:	48 89 ce             	mov    %rcx,%rsi
+    2bb0:	48 89 c7             	mov    %rax,%rdi
+    2bb3:	e8 c8 e4 ff ff       	call   1080 <memcmp@plt>
+    2bb8:	85 c0                	test   %eax,%eax
+    2bba:	0f 94 c0             	sete   %al
+}
+    2bbd:	c9                   	leave
+    2bbe:	c3                   	ret
+
+0000000000002bbf <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    2bbf:	55                   	push   %rbp
+    2bc0:	48 89 e5             	mov    %rsp,%rbp
+    2bc3:	48 83 ec 20          	sub    $0x20,%rsp
+    2bc7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2bcb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2bcf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    2bd3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2bd7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2bdb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2bdf:	48 89 ce             	mov    %rcx,%rsi
+    2be2:	48 89 c7             	mov    %rax,%rdi
+    2be5:	e8 96 e4 ff ff       	call   1080 <memcmp@plt>
+    2bea:	85 c0                	test   %eax,%eax
+    2bec:	0f 95 c0             	setne  %al
+}
+    2bef:	c9                   	leave
+    2bf0:	c3                   	ret
+
+0000000000002bf1 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>:
+
+// d[i] = p[i % 16] for i in [0, n), with normal stores:
+// the pattern once, then doubling the filled region.
+static void set_pattern(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    2bf1:	       55                   	push   %rbp
+    2bf2:	       48 89 e5             	mov    %rsp,%rbp
+    2bf5:	       48 83 ec 30          	sub    $0x30,%rsp
+    2bf9:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2bfd:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2c01:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    Length done = (n < 16) ? n : 16;
+    2c05:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2c09:	       ba 10 00 00 00       	mov    $0x10,%edx
+    2c0e:	       48 39 d0             	cmp    %rdx,%rax
+    2c11:	       48 0f 47 c2          	cmova  %rdx,%rax
+    2c15:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    copy(d, p, done);
+    2c19:	       48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2c1d:	       48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2c21:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c25:	       48 89 ce             	mov    %rcx,%rsi
+    2c28:	       48 89 c7             	mov    %rax,%rdi
+    2c2b:	       e8 6a fe ff ff       	call   2a9a <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    while (done < n) {
+    2c30:	   /-- eb 3e                	jmp    2c70 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x7f>
+        Length const m = (done < n - done) ? done : n - done;
+    2c32:	/--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2c36:	|  |   48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    2c3a:	|  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2c3e:	|  |   48 39 c2             	cmp    %rax,%rdx
+    2c41:	|  |   48 0f 46 c2          	cmovbe %rdx,%rax
+    2c45:	|  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        copy(d + done, d, m);
+    2c49:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2c4d:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c51:	|  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    2c55:	|  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2c59:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c5d:	|  |   48 89 c6             	mov    %rax,%rsi
+    2c60:	|  |   48 89 cf             	mov    %rcx,%rdi
+    2c63:	|  |   e8 32 fe ff ff       	call   2a9a <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        done += m;
+    2c68:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2c6c:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+    while (done < n) {
+    2c70:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c74:	|      48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    2c78:	\----- 72 b8                	jb     2c32 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x41>
+    }
+}
+    2c7a:	       90                   	nop
+    2c7b:	       90                   	nop
+    2c7c:	       c9                   	leave
+    2c7d:	       c3                   	ret
+
+0000000000002c7e <nel::elem::load16(unsigned char const*)>:
+static constexpr Length streaming_min = 256;
+
+typedef long long int Line16 __attribute__((vector_size(16)));
+
+static inline Line16 load16(uint8_t const *const s)
+{
+    2c7e:	55                   	push   %rbp
+    2c7f:	48 89 e5             	mov    %rsp,%rbp
+    2c82:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Line16 v;
+    std::memcpy(&v, s, sizeof(v));
+    2c86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c8a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2c8e:	48 8b 00             	mov    (%rax),%rax
+    2c91:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2c95:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    return v;
+    2c99:	66 0f 6f 45 f0       	movdqa -0x10(%rbp),%xmm0
+}
+    2c9e:	5d                   	pop    %rbp
+    2c9f:	c3                   	ret
+
+0000000000002ca0 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>:
+
+static inline void stream16(uint8_t *const d, Line16 const &v)
+{
+    2ca0:	55                   	push   %rbp
+    2ca1:	48 89 e5             	mov    %rsp,%rbp
+    2ca4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2ca8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2cac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2cb0:	66 0f 6f 00          	movdqa (%rax),%xmm0
+    2cb4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cb8:	66 0f e7 00          	movntdq %xmm0,(%rax)
+}
+    2cbc:	90                   	nop
+    2cbd:	5d                   	pop    %rbp
+    2cbe:	c3                   	ret
+
+0000000000002cbf <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    2cbf:	          55                   	push   %rbp
+    2cc0:	          48 89 e5             	mov    %rsp,%rbp
+    2cc3:	          48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    2cc7:	          48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    2ccb:	          48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    2ccf:	          48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    if (n < streaming_min) {
+    2cd3:	          48 81 7d 88 ff 00 00 	cmpq   $0xff,-0x78(%rbp)
+    2cda:	          00 
+    2cdb:	      /-- 77 1c                	ja     2cf9 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        copy(d, s, n);
+    2cdd:	      |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    2ce1:	      |   48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    2ce5:	      |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2ce9:	      |   48 89 ce             	mov    %rcx,%rsi
+    2cec:	      |   48 89 c7             	mov    %rax,%rdi
+    2cef:	      |   e8 a6 fd ff ff       	call   2a9a <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        return;
+    2cf4:	/-----|-- e9 98 01 00 00       	jmp    2e91 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1d2>
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2cf9:	|     \-> 48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2cfd:	|         48 f7 d8             	neg    %rax
+    2d00:	|         83 e0 0f             	and    $0xf,%eax
+    2d03:	|         48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    copy(d, s, head);
+    2d07:	|         48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2d0b:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    2d0f:	|         48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2d13:	|         48 89 ce             	mov    %rcx,%rsi
+    2d16:	|         48 89 c7             	mov    %rax,%rdi
+    2d19:	|         e8 7c fd ff ff       	call   2a9a <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    Index i = head;
+    2d1e:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2d22:	|         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    2d26:	|     /-- e9 e1 00 00 00       	jmp    2e0c <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        Line16 const a = load16(s + i);
+    2d2b:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    2d2f:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d33:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2d36:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2d39:	|  |  |   e8 40 ff ff ff       	call   2c7e <nel::elem::load16(unsigned char const*)>
+    2d3e:	|  |  |   0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+        Line16 const b = load16(s + i + 16);
+    2d42:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d46:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    2d4a:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2d4e:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2d51:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2d54:	|  |  |   e8 25 ff ff ff       	call   2c7e <nel::elem::load16(unsigned char const*)>
+    2d59:	|  |  |   0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+        Line16 const c = load16(s + i + 32);
+    2d5d:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d61:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    2d65:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2d69:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2d6c:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2d6f:	|  |  |   e8 0a ff ff ff       	call   2c7e <nel::elem::load16(unsigned char const*)>
+    2d74:	|  |  |   0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+        Line16 const e = load16(s + i + 48);
+    2d78:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d7c:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    2d80:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2d84:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2d87:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2d8a:	|  |  |   e8 ef fe ff ff       	call   2c7e <nel::elem::load16(unsigned char const*)>
+    2d8f:	|  |  |   0f 29 45 a0          	movaps %xmm0,-0x60(%rbp)
+        stream16(d + i, a);
+    2d93:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    2d97:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d9b:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2d9e:	|  |  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    2da2:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2da5:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2da8:	|  |  |   e8 f3 fe ff ff       	call   2ca0 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, b);
+    2dad:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2db1:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    2db5:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2db9:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2dbc:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2dc0:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2dc3:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2dc6:	|  |  |   e8 d5 fe ff ff       	call   2ca0 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, c);
+    2dcb:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2dcf:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    2dd3:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2dd7:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2dda:	|  |  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    2dde:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2de1:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2de4:	|  |  |   e8 b7 fe ff ff       	call   2ca0 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, e);
+    2de9:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ded:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    2df1:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2df5:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2df8:	|  |  |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    2dfc:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2dff:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2e02:	|  |  |   e8 99 fe ff ff       	call   2ca0 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    2e07:	|  |  |   48 83 45 f8 40       	addq   $0x40,-0x8(%rbp)
+    2e0c:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e10:	|  |      48 83 c0 40          	add    $0x40,%rax
+    2e14:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    2e18:	|  \----- 0f 83 0d ff ff ff    	jae    2d2b <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x6c>
+    }
+    for (; i + 16 <= n; i += 16) {
+    2e1e:	|     /-- eb 36                	jmp    2e56 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x197>
+        stream16(d + i, load16(s + i));
+    2e20:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    2e24:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e28:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2e2b:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2e2e:	|  |  |   e8 4b fe ff ff       	call   2c7e <nel::elem::load16(unsigned char const*)>
+    2e33:	|  |  |   0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+    2e37:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    2e3b:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e3f:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2e42:	|  |  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2e46:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2e49:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2e4c:	|  |  |   e8 4f fe ff ff       	call   2ca0 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    2e51:	|  |  |   48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+    2e56:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e5a:	|  |      48 83 c0 10          	add    $0x10,%rax
+    2e5e:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    2e62:	|  \----- 73 bc                	jae    2e20 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    2e64:	|         0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    2e67:	|         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    2e6b:	|         48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    2e6f:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    2e73:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2e77:	|         48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    2e7b:	|         48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+    2e7f:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2e83:	|         48 01 d1             	add    %rdx,%rcx
+    2e86:	|         48 89 c2             	mov    %rax,%rdx
+    2e89:	|         48 89 cf             	mov    %rcx,%rdi
+    2e8c:	|         e8 09 fc ff ff       	call   2a9a <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+}
+    2e91:	\-------> c9                   	leave
+    2e92:	          c3                   	ret
+
+0000000000002e93 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    2e93:	          55                   	push   %rbp
+    2e94:	          48 89 e5             	mov    %rsp,%rbp
+    2e97:	          48 83 ec 60          	sub    $0x60,%rsp
+    2e9b:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    2e9f:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    2ea3:	          48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    if (n < streaming_min) {
+    2ea7:	          48 81 7d a8 ff 00 00 	cmpq   $0xff,-0x58(%rbp)
+    2eae:	          00 
+    2eaf:	      /-- 77 1c                	ja     2ecd <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        set_pattern(d, p, n);
+    2eb1:	      |   48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    2eb5:	      |   48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+    2eb9:	      |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2ebd:	      |   48 89 ce             	mov    %rcx,%rsi
+    2ec0:	      |   48 89 c7             	mov    %rax,%rdi
+    2ec3:	      |   e8 29 fd ff ff       	call   2bf1 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>
+    2ec8:	/-----|-- e9 89 01 00 00       	jmp    3056 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c3>
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2ecd:	|     \-> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2ed1:	|         48 f7 d8             	neg    %rax
+    2ed4:	|         83 e0 0f             	and    $0xf,%eax
+    2ed7:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    for (Index i = 0; i < head; ++i) {
+    2edb:	|         48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    2ee2:	|         00 
+    2ee3:	|     /-- eb 20                	jmp    2f05 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x72>
+        d[i] = p[i];
+    2ee5:	|  /--|-> 48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    2ee9:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2eed:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2ef0:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    2ef4:	|  |  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2ef8:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    2efb:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    2efe:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < head; ++i) {
+    2f00:	|  |  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    2f05:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f09:	|  |      48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    2f0d:	|  \----- 72 d6                	jb     2ee5 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x52>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    2f0f:	|         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    2f16:	|         00 
+    2f17:	|     /-- eb 2d                	jmp    2f46 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xb3>
+        rotated[i] = p[(head + i) % 16];
+    2f19:	|  /--|-> 48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2f1d:	|  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2f21:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2f24:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    2f27:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    2f2a:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2f2e:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2f31:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    2f34:	|  |  |   48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    2f38:	|  |  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2f3c:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    2f3f:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < 16; ++i) {
+    2f41:	|  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    2f46:	|  |  \-> 48 83 7d f0 0f       	cmpq   $0xf,-0x10(%rbp)
+    2f4b:	|  \----- 76 cc                	jbe    2f19 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x86>
+    }
+    Line16 const v = load16(rotated);
+    2f4d:	|         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    2f51:	|         48 89 c7             	mov    %rax,%rdi
+    2f54:	|         e8 25 fd ff ff       	call   2c7e <nel::elem::load16(unsigned char const*)>
+    2f59:	|         0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+    Index i = head;
+    2f5d:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2f61:	|         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    2f65:	|     /-- eb 79                	jmp    2fe0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        stream16(d + i, v);
+    2f67:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    2f6b:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f6f:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2f72:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2f76:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2f79:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2f7c:	|  |  |   e8 1f fd ff ff       	call   2ca0 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, v);
+    2f81:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f85:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    2f89:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2f8d:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2f90:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2f94:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2f97:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2f9a:	|  |  |   e8 01 fd ff ff       	call   2ca0 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, v);
+    2f9f:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2fa3:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    2fa7:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2fab:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2fae:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2fb2:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2fb5:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2fb8:	|  |  |   e8 e3 fc ff ff       	call   2ca0 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, v);
+    2fbd:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2fc1:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    2fc5:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    2fc9:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2fcc:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2fd0:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2fd3:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2fd6:	|  |  |   e8 c5 fc ff ff       	call   2ca0 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    2fdb:	|  |  |   48 83 45 e8 40       	addq   $0x40,-0x18(%rbp)
+    2fe0:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2fe4:	|  |      48 83 c0 40          	add    $0x40,%rax
+    2fe8:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    2fec:	|  \----- 0f 83 75 ff ff ff    	jae    2f67 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd4>
+    }
+    for (; i + 16 <= n; i += 16) {
+    2ff2:	|     /-- eb 1f                	jmp    3013 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x180>
+        stream16(d + i, v);
+    2ff4:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    2ff8:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ffc:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2fff:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3003:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3006:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3009:	|  |  |   e8 92 fc ff ff       	call   2ca0 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    300e:	|  |  |   48 83 45 e8 10       	addq   $0x10,-0x18(%rbp)
+    3013:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3017:	|  |      48 83 c0 10          	add    $0x10,%rax
+    301b:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    301f:	|  \----- 73 d3                	jae    2ff4 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    __builtin_ia32_sfence();
+    3021:	|         0f ae f8             	sfence
+    for (; i < n; ++i) {
+    3024:	|     /-- eb 26                	jmp    304c <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1b9>
+        d[i] = p[i % 16];
+    3026:	|  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    302a:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    302d:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    3030:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3034:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3037:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    303b:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    303f:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    3042:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    3045:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (; i < n; ++i) {
+    3047:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    304c:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3050:	|  |      48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    3054:	|  \----- 72 d0                	jb     3026 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x193>
+    }
+}
+    3056:	\-------> c9                   	leave
+    3057:	          c3                   	ret
+
+0000000000003058 <nel::offset_of(unsigned char*, unsigned long)>:
+// The payload is the first align boundary leaving room for a Length in front,
+// which holds the offset from the start of the underlying allocation.
+// Malloc alignment is at least alignof(Length), so the payload is at most
+// align bytes in.
+static Length offset_of(uint8_t *const base, Length const align)
+{
+    3058:	55                   	push   %rbp
+    3059:	48 89 e5             	mov    %rsp,%rbp
+    305c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3060:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    USize const a = reinterpret_cast<USize>(base) + sizeof(Length);
+    3064:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3068:	48 83 c0 08          	add    $0x8,%rax
+    306c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    3070:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3074:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3078:	48 01 d0             	add    %rdx,%rax
+    307b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    307f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3083:	48 f7 d8             	neg    %rax
+    3086:	48 21 c2             	and    %rax,%rdx
+    3089:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    308d:	48 29 c2             	sub    %rax,%rdx
+    3090:	48 89 d0             	mov    %rdx,%rax
+}
+    3093:	5d                   	pop    %rbp
+    3094:	c3                   	ret
+
+0000000000003095 <nel::offset_field(unsigned char*)>:
+
+static Length &offset_field(uint8_t *const p)
+{
+    3095:	55                   	push   %rbp
+    3096:	48 89 e5             	mov    %rsp,%rbp
+    3099:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return reinterpret_cast<Length *>(p)[-1];
+    309d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30a1:	48 83 e8 08          	sub    $0x8,%rax
+}
+    30a5:	5d                   	pop    %rbp
+    30a6:	c3                   	ret
+
+00000000000030a7 <nel::free_aligned(void*)>:
+
+void free_aligned(void *const p)
+{
+    30a7:	       55                   	push   %rbp
+    30a8:	       48 89 e5             	mov    %rsp,%rbp
+    30ab:	       48 83 ec 20          	sub    $0x20,%rsp
+    30af:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (p == nullptr) { return; }
+    30b3:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    30b8:	/----- 74 2e                	je     30e8 <nel::free_aligned(void*)+0x41>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    30ba:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    30be:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    std::free(u8p - offset_field(u8p));
+    30c2:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30c6:	|      48 89 c7             	mov    %rax,%rdi
+    30c9:	|      e8 c7 ff ff ff       	call   3095 <nel::offset_field(unsigned char*)>
+    30ce:	|      48 8b 00             	mov    (%rax),%rax
+    30d1:	|      48 f7 d8             	neg    %rax
+    30d4:	|      48 89 c2             	mov    %rax,%rdx
+    30d7:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30db:	|      48 01 d0             	add    %rdx,%rax
+    30de:	|      48 89 c7             	mov    %rax,%rdi
+    30e1:	|      e8 4a df ff ff       	call   1030 <free@plt>
+    30e6:	|  /-- eb 01                	jmp    30e9 <nel::free_aligned(void*)+0x42>
+    if (p == nullptr) { return; }
+    30e8:	\--|-> 90                   	nop
+}
+    30e9:	   \-> c9                   	leave
+    30ea:	       c3                   	ret
+
+00000000000030eb <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    30eb:	             55                   	push   %rbp
+    30ec:	             48 89 e5             	mov    %rsp,%rbp
+    30ef:	             53                   	push   %rbx
+    30f0:	             48 83 ec 78          	sub    $0x78,%rsp
+    30f4:	             48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    30f8:	             48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    30fc:	             48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    3100:	             48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    3104:	             48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    3108:	             b9 f3 00 00 00       	mov    $0xf3,%ecx
+    310d:	             48 8d 15 54 10 00 00 	lea    0x1054(%rip),%rdx        # 4168 <nel::elem::streaming_min+0x8>
+    3114:	             48 8d 35 5f 10 00 00 	lea    0x105f(%rip),%rsi        # 417a <nel::elem::streaming_min+0x1a>
+    311b:	             48 89 c7             	mov    %rax,%rdi
+    311e:	             e8 f5 e8 ff ff       	call   1a18 <nel::Context::Context(char const*, char const*, int)>
+    3123:	             48 83 7d 90 00       	cmpq   $0x0,-0x70(%rbp)
+    3128:	      /----- 74 18                	je     3142 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    312a:	      |      48 8b 45 90          	mov    -0x70(%rbp),%rax
+    312e:	      |      48 83 e8 01          	sub    $0x1,%rax
+    3132:	      |      48 23 45 90          	and    -0x70(%rbp),%rax
+    3136:	      |      48 85 c0             	test   %rax,%rax
+    3139:	      +----- 75 07                	jne    3142 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    313b:	      |      b8 01 00 00 00       	mov    $0x1,%eax
+    3140:	      |  /-- eb 05                	jmp    3147 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x5c>
+    3142:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3147:	         \-> 0f b6 c0             	movzbl %al,%eax
+    314a:	             48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    314e:	             48 8d 0d 35 10 00 00 	lea    0x1035(%rip),%rcx        # 418a <nel::elem::streaming_min+0x2a>
+    3155:	             48 89 ce             	mov    %rcx,%rsi
+    3158:	             89 c7                	mov    %eax,%edi
+    315a:	             e8 5b 01 00 00       	call   32ba <nel::assert(bool, char const*, nel::Context const&)>
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    315f:	             48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3163:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    3167:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    316c:	      /----- 74 11                	je     317f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x94>
+    316e:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3172:	      |      48 89 c7             	mov    %rax,%rdi
+    3175:	      |      e8 1b ff ff ff       	call   3095 <nel::offset_field(unsigned char*)>
+    317a:	      |      48 8b 00             	mov    (%rax),%rax
+    317d:	      |  /-- eb 05                	jmp    3184 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x99>
+    317f:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3184:	         \-> 48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    3188:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    318d:	      /----- 74 13                	je     31a2 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb7>
+    318f:	      |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3193:	      |      48 f7 d8             	neg    %rax
+    3196:	      |      48 89 c2             	mov    %rax,%rdx
+    3199:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    319d:	      |      48 01 d0             	add    %rdx,%rax
+    31a0:	      |  /-- eb 05                	jmp    31a7 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xbc>
+    31a2:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    31a7:	         \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    31ab:	             48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    31af:	             48 8b 45 90          	mov    -0x70(%rbp),%rax
+    31b3:	             48 01 c2             	add    %rax,%rdx
+    31b6:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    31ba:	             48 89 d6             	mov    %rdx,%rsi
+    31bd:	             48 89 c7             	mov    %rax,%rdi
+    31c0:	             e8 eb de ff ff       	call   10b0 <realloc@plt>
+    31c5:	             48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if (new_base == nullptr) { return nullptr; }
+    31c9:	             48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    31ce:	         /-- 75 0a                	jne    31da <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    31d0:	         |   b8 00 00 00 00       	mov    $0x0,%eax
+    31d5:	/--------|-- e9 85 00 00 00       	jmp    325f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x174>
+
+    Length const new_offset = offset_of(new_base, align);
+    31da:	|        \-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    31de:	|            48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    31e2:	|            48 89 d6             	mov    %rdx,%rsi
+    31e5:	|            48 89 c7             	mov    %rax,%rdi
+    31e8:	|            e8 6b fe ff ff       	call   3058 <nel::offset_of(unsigned char*, unsigned long)>
+    31ed:	|            48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    uint8_t *const new_p = new_base + new_offset;
+    31f1:	|            48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    31f5:	|            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    31f9:	|            48 01 d0             	add    %rdx,%rax
+    31fc:	|            48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    if (old_p != nullptr && new_offset != old_offset) {
+    3200:	|            48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3205:	|  /-------- 74 41                	je     3248 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+    3207:	|  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    320b:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    320f:	|  +-------- 74 37                	je     3248 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+    3211:	|  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3215:	|  |         48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    3219:	|  |  /----- 73 06                	jae    3221 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x136>
+    321b:	|  |  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    321f:	|  |  |  /-- eb 04                	jmp    3225 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x13a>
+    3221:	|  |  \--|-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    3225:	|  |     \-> 48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        std::memmove(new_p, new_base + old_offset, n);
+    3229:	|  |         48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    322d:	|  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3231:	|  |         48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    3235:	|  |         48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    3239:	|  |         48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    323d:	|  |         48 89 ce             	mov    %rcx,%rsi
+    3240:	|  |         48 89 c7             	mov    %rax,%rdi
+    3243:	|  |         e8 78 de ff ff       	call   10c0 <memmove@plt>
+    }
+    offset_field(new_p) = new_offset;
+    3248:	|  \-------> 48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+    324c:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    3250:	|            48 89 c7             	mov    %rax,%rdi
+    3253:	|            e8 3d fe ff ff       	call   3095 <nel::offset_field(unsigned char*)>
+    3258:	|            48 89 18             	mov    %rbx,(%rax)
+    return new_p;
+    325b:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+}
+    325f:	\----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3263:	             c9                   	leave
+    3264:	             c3                   	ret
+
+0000000000003265 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    3265:	55                   	push   %rbp
+    3266:	48 89 e5             	mov    %rsp,%rbp
+    3269:	48 83 ec 10          	sub    $0x10,%rsp
+    326d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3271:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return realloc_aligned(nullptr, align, 0, size);
+    3275:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3279:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    327d:	48 89 d1             	mov    %rdx,%rcx
+    3280:	ba 00 00 00 00       	mov    $0x0,%edx
+    3285:	48 89 c6             	mov    %rax,%rsi
+    3288:	bf 00 00 00 00       	mov    $0x0,%edi
+    328d:	e8 59 fe ff ff       	call   30eb <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+}
+    3292:	c9                   	leave
+    3293:	c3                   	ret
+
+0000000000003294 <nel::elem::poison(unsigned char*, unsigned long)>:
+{
+    3294:	55                   	push   %rbp
+    3295:	48 89 e5             	mov    %rsp,%rbp
+    3298:	48 83 ec 10          	sub    $0x10,%rsp
+    329c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    32a0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    copy(d, s, n);
+    32a4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    32a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32ac:	48 89 d6             	mov    %rdx,%rsi
+    32af:	48 89 c7             	mov    %rax,%rdi
+    32b2:	e8 ae f8 ff ff       	call   2b65 <nel::elem::wipe(unsigned char*, unsigned long)>
+}
+    32b7:	90                   	nop
+    32b8:	c9                   	leave
+    32b9:	c3                   	ret
+
+00000000000032ba <nel::assert(bool, char const*, nel::Context const&)>:
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx);
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    32ba:	    55                   	push   %rbp
+    32bb:	    48 89 e5             	mov    %rsp,%rbp
+    32be:	    48 83 ec 20          	sub    $0x20,%rsp
+    32c2:	    89 f8                	mov    %edi,%eax
+    32c4:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    32c8:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    32cc:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { assert_fail(msg, ctx); }
+    32cf:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    32d3:	    83 f0 01             	xor    $0x1,%eax
+    32d6:	    84 c0                	test   %al,%al
+    32d8:	/-- 74 13                	je     32ed <nel::assert(bool, char const*, nel::Context const&)+0x33>
+    32da:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    32de:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    32e2:	|   48 89 d6             	mov    %rdx,%rsi
+    32e5:	|   48 89 c7             	mov    %rax,%rdi
+    32e8:	|   e8 52 f7 ff ff       	call   2a3f <nel::assert_fail(char const*, nel::Context const&)>
+}
+    32ed:	\-> 90                   	nop
+    32ee:	    c9                   	leave
+    32ef:	    c3                   	ret
+
+00000000000032f0 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    32f0:	55                   	push   %rbp
+    32f1:	48 89 e5             	mov    %rsp,%rbp
+    32f4:	48 83 ec 10          	sub    $0x10,%rsp
+    32f8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    32fc:	89 f0                	mov    %esi,%eax
+    32fe:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    3301:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    3305:	48 8b 15 54 3d 00 00 	mov    0x3d54(%rip),%rdx        # 7060 <stderr@GLIBC_2.2.5>
+    330c:	48 89 d6             	mov    %rdx,%rsi
+    330f:	89 c7                	mov    %eax,%edi
+    3311:	e8 5a dd ff ff       	call   1070 <fputc@plt>
+    return outs;
+    3316:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    331a:	c9                   	leave
+    331b:	c3                   	ret
+
+000000000000331c <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    331c:	55                   	push   %rbp
+    331d:	48 89 e5             	mov    %rsp,%rbp
+    3320:	48 83 ec 10          	sub    $0x10,%rsp
+    3324:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3328:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    332c:	48 8b 15 2d 3d 00 00 	mov    0x3d2d(%rip),%rdx        # 7060 <stderr@GLIBC_2.2.5>
+    3333:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3337:	48 89 d6             	mov    %rdx,%rsi
+    333a:	48 89 c7             	mov    %rax,%rdi
+    333d:	e8 0e dd ff ff       	call   1050 <fputs@plt>
+    return outs;
+    3342:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3346:	c9                   	leave
+    3347:	c3                   	ret
+
+0000000000003348 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    3348:	55                   	push   %rbp
+    3349:	48 89 e5             	mov    %rsp,%rbp
+    334c:	48 83 ec 10          	sub    $0x10,%rsp
+    3350:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3354:	89 f0                	mov    %esi,%eax
+    3356:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    3359:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    335d:	48 8b 05 fc 3c 00 00 	mov    0x3cfc(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    3364:	48 8d 0d 3a 0e 00 00 	lea    0xe3a(%rip),%rcx        # 41a5 <nel::elem::streaming_min+0x45>
+    336b:	48 89 ce             	mov    %rcx,%rsi
+    336e:	48 89 c7             	mov    %rax,%rdi
+    3371:	b8 00 00 00 00       	mov    $0x0,%eax
+    3376:	e8 15 dd ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    337b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    337f:	c9                   	leave
+    3380:	c3                   	ret
+
+0000000000003381 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    3381:	55                   	push   %rbp
+    3382:	48 89 e5             	mov    %rsp,%rbp
+    3385:	48 83 ec 10          	sub    $0x10,%rsp
+    3389:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    338d:	89 f0                	mov    %esi,%eax
+    338f:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    3393:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    3397:	48 8b 05 c2 3c 00 00 	mov    0x3cc2(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    339e:	48 8d 0d 00 0e 00 00 	lea    0xe00(%rip),%rcx        # 41a5 <nel::elem::streaming_min+0x45>
+    33a5:	48 89 ce             	mov    %rcx,%rsi
+    33a8:	48 89 c7             	mov    %rax,%rdi
+    33ab:	b8 00 00 00 00       	mov    $0x0,%eax
+    33b0:	e8 db dc ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    33b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    33b9:	c9                   	leave
+    33ba:	c3                   	ret
+
+00000000000033bb <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    33bb:	55                   	push   %rbp
+    33bc:	48 89 e5             	mov    %rsp,%rbp
+    33bf:	48 83 ec 10          	sub    $0x10,%rsp
+    33c3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    33c7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    33ca:	48 8b 05 8f 3c 00 00 	mov    0x3c8f(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    33d1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    33d4:	48 8d 0d ca 0d 00 00 	lea    0xdca(%rip),%rcx        # 41a5 <nel::elem::streaming_min+0x45>
+    33db:	48 89 ce             	mov    %rcx,%rsi
+    33de:	48 89 c7             	mov    %rax,%rdi
+    33e1:	b8 00 00 00 00       	mov    $0x0,%eax
+    33e6:	e8 a5 dc ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    33eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    33ef:	c9                   	leave
+    33f0:	c3                   	ret
+
+00000000000033f1 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    33f1:	55                   	push   %rbp
+    33f2:	48 89 e5             	mov    %rsp,%rbp
+    33f5:	48 83 ec 10          	sub    $0x10,%rsp
+    33f9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    33fd:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    3400:	48 8b 05 59 3c 00 00 	mov    0x3c59(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    3407:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    340a:	48 8d 0d 94 0d 00 00 	lea    0xd94(%rip),%rcx        # 41a5 <nel::elem::streaming_min+0x45>
+    3411:	48 89 ce             	mov    %rcx,%rsi
+    3414:	48 89 c7             	mov    %rax,%rdi
+    3417:	b8 00 00 00 00       	mov    $0x0,%eax
+    341c:	e8 6f dc ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    3421:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3425:	c9                   	leave
+    3426:	c3                   	ret
+
+0000000000003427 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    3427:	55                   	push   %rbp
+    3428:	48 89 e5             	mov    %rsp,%rbp
+    342b:	48 83 ec 10          	sub    $0x10,%rsp
+    342f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3433:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    3437:	48 8b 05 22 3c 00 00 	mov    0x3c22(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    343e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3442:	48 8d 0d 5f 0d 00 00 	lea    0xd5f(%rip),%rcx        # 41a8 <nel::elem::streaming_min+0x48>
+    3449:	48 89 ce             	mov    %rcx,%rsi
+    344c:	48 89 c7             	mov    %rax,%rdi
+    344f:	b8 00 00 00 00       	mov    $0x0,%eax
+    3454:	e8 37 dc ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    3459:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    345d:	c9                   	leave
+    345e:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000003460 <_fini>:
+    3460:	48 83 ec 08          	sub    $0x8,%rsp
+    3464:	48 83 c4 08          	add    $0x8,%rsp
+    3468:	c3                   	ret
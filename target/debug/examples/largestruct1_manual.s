@@ -0,0 +1,1979 @@
+
+target/debug/examples/largestruct1_manual:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 3f 00 00 	mov    0x3fc5(%rip),%rax        # 4fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 3f 00 00    	push   0x3fca(%rip)        # 4ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 3f 00 00    	jmp    *0x3fcc(%rip)        # 4ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 3f 00 00    	jmp    *0x3fca(%rip)        # 5000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 3f 00 00    	jmp    *0x3fc2(%rip)        # 5008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 3f 00 00    	jmp    *0x3fba(%rip)        # 5010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memset@plt>:
+    1060:	ff 25 b2 3f 00 00    	jmp    *0x3fb2(%rip)        # 5018 <memset@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 3f 00 00    	jmp    *0x3faa(%rip)        # 5020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 3f 00 00    	jmp    *0x3fa2(%rip)        # 5028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 3f 00 00    	jmp    *0x3f9a(%rip)        # 5030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcpy@plt>:
+    10a0:	ff 25 92 3f 00 00    	jmp    *0x3f92(%rip)        # 5038 <memcpy@GLIBC_2.14>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <realloc@plt>:
+    10b0:	ff 25 8a 3f 00 00    	jmp    *0x3f8a(%rip)        # 5040 <realloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <memmove@plt>:
+    10c0:	ff 25 82 3f 00 00    	jmp    *0x3f82(%rip)        # 5048 <memmove@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <__cxa_atexit@plt>:
+    10d0:	ff 25 7a 3f 00 00    	jmp    *0x3f7a(%rip)        # 5050 <__cxa_atexit@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010e0 <__cxa_finalize@plt>:
+    10e0:	ff 25 fa 3e 00 00    	jmp    *0x3efa(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10e6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010f0 <_start>:
+    10f0:	31 ed                	xor    %ebp,%ebp
+    10f2:	49 89 d1             	mov    %rdx,%r9
+    10f5:	5e                   	pop    %rsi
+    10f6:	48 89 e2             	mov    %rsp,%rdx
+    10f9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    10fd:	50                   	push   %rax
+    10fe:	54                   	push   %rsp
+    10ff:	45 31 c0             	xor    %r8d,%r8d
+    1102:	31 c9                	xor    %ecx,%ecx
+    1104:	48 8d 3d 1b 02 00 00 	lea    0x21b(%rip),%rdi        # 1326 <main>
+    110b:	ff 15 af 3e 00 00    	call   *0x3eaf(%rip)        # 4fc0 <__libc_start_main@GLIBC_2.34>
+    1111:	f4                   	hlt
+    1112:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1119:	00 00 00 
+    111c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001120 <deregister_tm_clones>:
+    1120:	    48 8d 3d 41 3f 00 00 	lea    0x3f41(%rip),%rdi        # 5068 <__TMC_END__>
+    1127:	    48 8d 05 3a 3f 00 00 	lea    0x3f3a(%rip),%rax        # 5068 <__TMC_END__>
+    112e:	    48 39 f8             	cmp    %rdi,%rax
+    1131:	/-- 74 15                	je     1148 <deregister_tm_clones+0x28>
+    1133:	|   48 8b 05 8e 3e 00 00 	mov    0x3e8e(%rip),%rax        # 4fc8 <_ITM_deregisterTMCloneTable@Base>
+    113a:	|   48 85 c0             	test   %rax,%rax
+    113d:	+-- 74 09                	je     1148 <deregister_tm_clones+0x28>
+    113f:	|   ff e0                	jmp    *%rax
+    1141:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1148:	\-> c3                   	ret
+    1149:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001150 <register_tm_clones>:
+    1150:	    48 8d 3d 11 3f 00 00 	lea    0x3f11(%rip),%rdi        # 5068 <__TMC_END__>
+    1157:	    48 8d 35 0a 3f 00 00 	lea    0x3f0a(%rip),%rsi        # 5068 <__TMC_END__>
+    115e:	    48 29 fe             	sub    %rdi,%rsi
+    1161:	    48 89 f0             	mov    %rsi,%rax
+    1164:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1168:	    48 c1 f8 03          	sar    $0x3,%rax
+    116c:	    48 01 c6             	add    %rax,%rsi
+    116f:	    48 d1 fe             	sar    %rsi
+    1172:	/-- 74 14                	je     1188 <register_tm_clones+0x38>
+    1174:	|   48 8b 05 5d 3e 00 00 	mov    0x3e5d(%rip),%rax        # 4fd8 <_ITM_registerTMCloneTable@Base>
+    117b:	|   48 85 c0             	test   %rax,%rax
+    117e:	+-- 74 08                	je     1188 <register_tm_clones+0x38>
+    1180:	|   ff e0                	jmp    *%rax
+    1182:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1188:	\-> c3                   	ret
+    1189:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001190 <__do_global_dtors_aux>:
+    1190:	       f3 0f 1e fa          	endbr64
+    1194:	       80 3d ed 3e 00 00 00 	cmpb   $0x0,0x3eed(%rip)        # 5088 <completed.0>
+    119b:	/----- 75 2b                	jne    11c8 <__do_global_dtors_aux+0x38>
+    119d:	|      55                   	push   %rbp
+    119e:	|      48 83 3d 3a 3e 00 00 	cmpq   $0x0,0x3e3a(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    11a5:	|      00 
+    11a6:	|      48 89 e5             	mov    %rsp,%rbp
+    11a9:	|  /-- 74 0c                	je     11b7 <__do_global_dtors_aux+0x27>
+    11ab:	|  |   48 8b 3d ae 3e 00 00 	mov    0x3eae(%rip),%rdi        # 5060 <__dso_handle>
+    11b2:	|  |   e8 29 ff ff ff       	call   10e0 <__cxa_finalize@plt>
+    11b7:	|  \-> e8 64 ff ff ff       	call   1120 <deregister_tm_clones>
+    11bc:	|      c6 05 c5 3e 00 00 01 	movb   $0x1,0x3ec5(%rip)        # 5088 <completed.0>
+    11c3:	|      5d                   	pop    %rbp
+    11c4:	|      c3                   	ret
+    11c5:	|      0f 1f 00             	nopl   (%rax)
+    11c8:	\----> c3                   	ret
+    11c9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011d0 <frame_dummy>:
+    11d0:	f3 0f 1e fa          	endbr64
+    11d4:	e9 77 ff ff ff       	jmp    1150 <register_tm_clones>
+
+00000000000011d9 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    11d9:	55                   	push   %rbp
+    11da:	48 89 e5             	mov    %rsp,%rbp
+    11dd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11e1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    11e4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11e9:	5d                   	pop    %rbp
+    11ea:	c3                   	ret
+
+00000000000011eb <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    11eb:	55                   	push   %rbp
+    11ec:	48 89 e5             	mov    %rsp,%rbp
+    11ef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11f3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11f6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return -1;
+    11fa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11ff:	5d                   	pop    %rbp
+    1200:	c3                   	ret
+
+0000000000001201 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    1201:	55                   	push   %rbp
+    1202:	48 89 e5             	mov    %rsp,%rbp
+    1205:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1209:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    120c:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    return -1;
+    120f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1214:	5d                   	pop    %rbp
+    1215:	c3                   	ret
+
+0000000000001216 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    1216:	55                   	push   %rbp
+    1217:	48 89 e5             	mov    %rsp,%rbp
+    121a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    121e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1221:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    1224:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    return -1;
+    1227:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    122c:	5d                   	pop    %rbp
+    122d:	c3                   	ret
+
+000000000000122e <_read_r>:
+int _read_r(struct _reent *, int) {
+    122e:	55                   	push   %rbp
+    122f:	48 89 e5             	mov    %rsp,%rbp
+    1232:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1236:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1239:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    123e:	5d                   	pop    %rbp
+    123f:	c3                   	ret
+
+0000000000001240 <_write_r>:
+int _write_r(struct _reent *, int, char *, int) {
+    1240:	55                   	push   %rbp
+    1241:	48 89 e5             	mov    %rsp,%rbp
+    1244:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1248:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    124b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    124f:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+    return -1;
+    1252:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1257:	5d                   	pop    %rbp
+    1258:	c3                   	ret
+
+0000000000001259 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    1259:	55                   	push   %rbp
+    125a:	48 89 e5             	mov    %rsp,%rbp
+    125d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return -1;
+    1261:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1266:	5d                   	pop    %rbp
+    1267:	c3                   	ret
+
+0000000000001268 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1268:	55                   	push   %rbp
+    1269:	48 89 e5             	mov    %rsp,%rbp
+    126c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1270:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1273:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1278:	5d                   	pop    %rbp
+    1279:	c3                   	ret
+
+000000000000127a <ex1()>:
+#include "libnosys_stubs.cx"
+
+using Stub = U8Buf<256>;
+
+void ex1(void)
+{
+    127a:	55                   	push   %rbp
+    127b:	48 89 e5             	mov    %rsp,%rbp
+    127e:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+    auto m1 = nel::Manual<Stub>();
+    1285:	48 8d 95 00 ff ff ff 	lea    -0x100(%rbp),%rdx
+    128c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1291:	b9 20 00 00 00       	mov    $0x20,%ecx
+    1296:	48 89 d7             	mov    %rdx,%rdi
+    1299:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+    129c:	48 8d 85 00 ff ff ff 	lea    -0x100(%rbp),%rax
+    12a3:	48 89 c7             	mov    %rax,%rdi
+    12a6:	e8 51 01 00 00       	call   13fc <nel::Manual<U8Buf<256ul> >::Manual()>
+
+    m1.construct();
+    12ab:	48 8d 85 00 ff ff ff 	lea    -0x100(%rbp),%rax
+    12b2:	48 89 c7             	mov    %rax,%rdi
+    12b5:	e8 d0 01 00 00       	call   148a <nel::Manual<U8Buf<256ul> >& nel::Manual<U8Buf<256ul> >::construct<>()>
+
+    nel::log << *m1 << '\n';
+    12ba:	48 8d 85 00 ff ff ff 	lea    -0x100(%rbp),%rax
+    12c1:	48 89 c7             	mov    %rax,%rdi
+    12c4:	e8 f5 01 00 00       	call   14be <nel::Manual<U8Buf<256ul> >::operator*()>
+    12c9:	48 89 c6             	mov    %rax,%rsi
+    12cc:	48 8d 05 b7 3d 00 00 	lea    0x3db7(%rip),%rax        # 508a <nel::log>
+    12d3:	48 89 c7             	mov    %rax,%rdi
+    12d6:	e8 fd 01 00 00       	call   14d8 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    12db:	be 0a 00 00 00       	mov    $0xa,%esi
+    12e0:	48 89 c7             	mov    %rax,%rdi
+    12e3:	e8 51 0c 00 00       	call   1f39 <nel::operator<<(nel::Log&, char)>
+
+    m1.destruct();
+    12e8:	48 8d 85 00 ff ff ff 	lea    -0x100(%rbp),%rax
+    12ef:	48 89 c7             	mov    %rax,%rdi
+    12f2:	e8 d5 02 00 00       	call   15cc <nel::Manual<U8Buf<256ul> >::destruct()>
+}
+    12f7:	48 8d 85 00 ff ff ff 	lea    -0x100(%rbp),%rax
+    12fe:	48 89 c7             	mov    %rax,%rdi
+    1301:	e8 12 01 00 00       	call   1418 <nel::Manual<U8Buf<256ul> >::~Manual()>
+    1306:	c9                   	leave
+    1307:	c3                   	ret
+
+0000000000001308 <isr_ctimer>:
+};
+
+nel::Manual<Fake> fak_;
+
+extern "C" void isr_ctimer()
+{
+    1308:	55                   	push   %rbp
+    1309:	48 89 e5             	mov    %rsp,%rbp
+    // there must be 3 instrs.
+    // 1 load reg with value
+    // 2 load reg with address (precomputed, no alignment adjusts etc)
+    // 3 store value to address.
+    fak_->foo();
+    130c:	48 8d 05 76 3d 00 00 	lea    0x3d76(%rip),%rax        # 5089 <fak_>
+    1313:	48 89 c7             	mov    %rax,%rdi
+    1316:	e8 e3 02 00 00       	call   15fe <nel::Manual<Fake>::operator->()>
+    131b:	48 89 c7             	mov    %rax,%rdi
+    131e:	e8 1d 01 00 00       	call   1440 <Fake::foo()>
+}
+    1323:	90                   	nop
+    1324:	5d                   	pop    %rbp
+    1325:	c3                   	ret
+
+0000000000001326 <main>:
+
+int main()
+{
+    1326:	55                   	push   %rbp
+    1327:	48 89 e5             	mov    %rsp,%rbp
+    nel::log << "ex1:b" << '\n';
+    132a:	48 8d 05 d4 1c 00 00 	lea    0x1cd4(%rip),%rax        # 3005 <nel::elem::poisoning+0x1>
+    1331:	48 89 c6             	mov    %rax,%rsi
+    1334:	48 8d 05 4f 3d 00 00 	lea    0x3d4f(%rip),%rax        # 508a <nel::log>
+    133b:	48 89 c7             	mov    %rax,%rdi
+    133e:	e8 22 0c 00 00       	call   1f65 <nel::operator<<(nel::Log&, char const*)>
+    1343:	be 0a 00 00 00       	mov    $0xa,%esi
+    1348:	48 89 c7             	mov    %rax,%rdi
+    134b:	e8 e9 0b 00 00       	call   1f39 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    1350:	e8 25 ff ff ff       	call   127a <ex1()>
+    nel::log << "ex1:e" << '\n';
+    1355:	48 8d 05 af 1c 00 00 	lea    0x1caf(%rip),%rax        # 300b <nel::elem::poisoning+0x7>
+    135c:	48 89 c6             	mov    %rax,%rsi
+    135f:	48 8d 05 24 3d 00 00 	lea    0x3d24(%rip),%rax        # 508a <nel::log>
+    1366:	48 89 c7             	mov    %rax,%rdi
+    1369:	e8 f7 0b 00 00       	call   1f65 <nel::operator<<(nel::Log&, char const*)>
+    136e:	be 0a 00 00 00       	mov    $0xa,%esi
+    1373:	48 89 c7             	mov    %rax,%rdi
+    1376:	e8 be 0b 00 00       	call   1f39 <nel::operator<<(nel::Log&, char)>
+}
+    137b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1380:	5d                   	pop    %rbp
+    1381:	c3                   	ret
+
+0000000000001382 <__static_initialization_and_destruction_0(int, int)>:
+    1382:	    55                   	push   %rbp
+    1383:	    48 89 e5             	mov    %rsp,%rbp
+    1386:	    48 83 ec 10          	sub    $0x10,%rsp
+    138a:	    89 7d fc             	mov    %edi,-0x4(%rbp)
+    138d:	    89 75 f8             	mov    %esi,-0x8(%rbp)
+    1390:	    83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    1394:	/-- 75 3b                	jne    13d1 <__static_initialization_and_destruction_0(int, int)+0x4f>
+    1396:	|   81 7d f8 ff ff 00 00 	cmpl   $0xffff,-0x8(%rbp)
+    139d:	+-- 75 32                	jne    13d1 <__static_initialization_and_destruction_0(int, int)+0x4f>
+nel::Manual<Fake> fak_;
+    139f:	|   48 8d 05 e3 3c 00 00 	lea    0x3ce3(%rip),%rax        # 5089 <fak_>
+    13a6:	|   48 89 c7             	mov    %rax,%rdi
+    13a9:	|   e8 a8 00 00 00       	call   1456 <nel::Manual<Fake>::Manual()>
+    13ae:	|   48 8d 05 ab 3c 00 00 	lea    0x3cab(%rip),%rax        # 5060 <__dso_handle>
+    13b5:	|   48 89 c2             	mov    %rax,%rdx
+    13b8:	|   48 8d 05 ca 3c 00 00 	lea    0x3cca(%rip),%rax        # 5089 <fak_>
+    13bf:	|   48 89 c6             	mov    %rax,%rsi
+    13c2:	|   48 8d 05 c7 02 00 00 	lea    0x2c7(%rip),%rax        # 1690 <nel::Manual<Fake>::~Manual()>
+    13c9:	|   48 89 c7             	mov    %rax,%rdi
+    13cc:	|   e8 ff fc ff ff       	call   10d0 <__cxa_atexit@plt>
+}
+    13d1:	\-> 90                   	nop
+    13d2:	    c9                   	leave
+    13d3:	    c3                   	ret
+
+00000000000013d4 <_GLOBAL__sub_I__close_r>:
+    13d4:	55                   	push   %rbp
+    13d5:	48 89 e5             	mov    %rsp,%rbp
+    13d8:	be ff ff 00 00       	mov    $0xffff,%esi
+    13dd:	bf 01 00 00 00       	mov    $0x1,%edi
+    13e2:	e8 9b ff ff ff       	call   1382 <__static_initialization_and_destruction_0(int, int)>
+    13e7:	5d                   	pop    %rbp
+    13e8:	c3                   	ret
+
+00000000000013e9 <operator new(unsigned long, void*)>:
+
+    13e9:	55                   	push   %rbp
+    13ea:	48 89 e5             	mov    %rsp,%rbp
+    13ed:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    13f1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+void ex1(void)
+    13f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+{
+    13f9:	5d                   	pop    %rbp
+    13fa:	c3                   	ret
+    13fb:	90                   	nop
+
+00000000000013fc <nel::Manual<U8Buf<256ul> >::Manual()>:
+        // doesn't know if value contained or not.
+        constexpr ~Manual() = default;
+
+        // create empty container
+        // union should prevent ctor call of T.
+        constexpr Manual() = default;
+    13fc:	55                   	push   %rbp
+    13fd:	48 89 e5             	mov    %rsp,%rbp
+    1400:	48 83 ec 10          	sub    $0x10,%rsp
+    1404:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1408:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    140c:	48 89 c7             	mov    %rax,%rdi
+    140f:	e8 20 00 00 00       	call   1434 <nel::Manual<U8Buf<256ul> >::U::U()>
+    1414:	90                   	nop
+    1415:	c9                   	leave
+    1416:	c3                   	ret
+    1417:	90                   	nop
+
+0000000000001418 <nel::Manual<U8Buf<256ul> >::~Manual()>:
+        constexpr ~Manual() = default;
+    1418:	55                   	push   %rbp
+    1419:	48 89 e5             	mov    %rsp,%rbp
+    141c:	48 83 ec 10          	sub    $0x10,%rsp
+    1420:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1424:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1428:	48 89 c7             	mov    %rax,%rdi
+    142b:	e8 4e 00 00 00       	call   147e <nel::Manual<U8Buf<256ul> >::U::~U()>
+    1430:	90                   	nop
+    1431:	c9                   	leave
+    1432:	c3                   	ret
+    1433:	90                   	nop
+
+0000000000001434 <nel::Manual<U8Buf<256ul> >::U::U()>:
+                constexpr U() {};
+    1434:	55                   	push   %rbp
+    1435:	48 89 e5             	mov    %rsp,%rbp
+    1438:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    143c:	90                   	nop
+    143d:	5d                   	pop    %rbp
+    143e:	c3                   	ret
+    143f:	90                   	nop
+
+0000000000001440 <Fake::foo()>:
+        void foo()
+    1440:	55                   	push   %rbp
+    1441:	48 89 e5             	mov    %rsp,%rbp
+    1444:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            RegBlock::BLOCK0.reg1_ = 23;
+    1448:	b8 00 00 00 40       	mov    $0x40000000,%eax
+    144d:	c7 00 17 00 00 00    	movl   $0x17,(%rax)
+        }
+    1453:	90                   	nop
+    1454:	5d                   	pop    %rbp
+    1455:	c3                   	ret
+
+0000000000001456 <nel::Manual<Fake>::Manual()>:
+        constexpr Manual() = default;
+    1456:	55                   	push   %rbp
+    1457:	48 89 e5             	mov    %rsp,%rbp
+    145a:	48 83 ec 10          	sub    $0x10,%rsp
+    145e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1462:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1466:	48 89 c7             	mov    %rax,%rdi
+    1469:	e8 04 00 00 00       	call   1472 <nel::Manual<Fake>::U::U()>
+    146e:	90                   	nop
+    146f:	c9                   	leave
+    1470:	c3                   	ret
+    1471:	90                   	nop
+
+0000000000001472 <nel::Manual<Fake>::U::U()>:
+                constexpr U() {};
+    1472:	55                   	push   %rbp
+    1473:	48 89 e5             	mov    %rsp,%rbp
+    1476:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    147a:	90                   	nop
+    147b:	5d                   	pop    %rbp
+    147c:	c3                   	ret
+    147d:	90                   	nop
+
+000000000000147e <nel::Manual<U8Buf<256ul> >::U::~U()>:
+                constexpr ~U() {};
+    147e:	55                   	push   %rbp
+    147f:	48 89 e5             	mov    %rsp,%rbp
+    1482:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1486:	90                   	nop
+    1487:	5d                   	pop    %rbp
+    1488:	c3                   	ret
+    1489:	90                   	nop
+
+000000000000148a <nel::Manual<U8Buf<256ul> >& nel::Manual<U8Buf<256ul> >::construct<>()>:
+
+    public:
+        // construct value in-place given an existing container.
+        template<typename... Args>
+        constexpr Self &construct(Args &&...args)
+    148a:	55                   	push   %rbp
+    148b:	48 89 e5             	mov    %rsp,%rbp
+    148e:	48 83 ec 10          	sub    $0x10,%rsp
+    1492:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            new (ptr()) Type(forward<Args>(args)...);
+    1496:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    149a:	48 89 c7             	mov    %rax,%rdi
+    149d:	e8 76 01 00 00       	call   1618 <nel::Manual<U8Buf<256ul> >::ptr()>
+    14a2:	48 89 c6             	mov    %rax,%rsi
+    14a5:	bf 00 01 00 00       	mov    $0x100,%edi
+    14aa:	e8 3a ff ff ff       	call   13e9 <operator new(unsigned long, void*)>
+    14af:	48 89 c7             	mov    %rax,%rdi
+    14b2:	e8 6f 01 00 00       	call   1626 <U8Buf<256ul>::U8Buf()>
+            return *this;
+    14b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    14bb:	c9                   	leave
+    14bc:	c3                   	ret
+    14bd:	90                   	nop
+
+00000000000014be <nel::Manual<U8Buf<256ul> >::operator*()>:
+        {
+            return *ptr();
+        }
+
+        // only if you know there's a value there..
+        constexpr Type &operator*()
+    14be:	55                   	push   %rbp
+    14bf:	48 89 e5             	mov    %rsp,%rbp
+    14c2:	48 83 ec 10          	sub    $0x10,%rsp
+    14c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return deref();
+    14ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14ce:	48 89 c7             	mov    %rax,%rdi
+    14d1:	e8 5c 01 00 00       	call   1632 <nel::Manual<U8Buf<256ul> >::deref()>
+        }
+    14d6:	c9                   	leave
+    14d7:	c3                   	ret
+
+00000000000014d8 <operator<<(nel::Log&, U8Buf<256ul> const&)>:
+        void fill(uint8_t f)
+        {
+            nel::elem::set(data_, f, N);
+        }
+
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+    14d8:	          55                   	push   %rbp
+    14d9:	          48 89 e5             	mov    %rsp,%rbp
+    14dc:	          53                   	push   %rbx
+    14dd:	          48 83 ec 28          	sub    $0x28,%rsp
+    14e1:	          48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    14e5:	          48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+        {
+            outs << "U8Buf<" << val.len() << ">{";
+    14e9:	          48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    14ed:	          48 8d 15 1d 1b 00 00 	lea    0x1b1d(%rip),%rdx        # 3011 <nel::elem::poisoning+0xd>
+    14f4:	          48 89 d6             	mov    %rdx,%rsi
+    14f7:	          48 89 c7             	mov    %rax,%rdi
+    14fa:	          e8 66 0a 00 00       	call   1f65 <nel::operator<<(nel::Log&, char const*)>
+    14ff:	          48 89 c3             	mov    %rax,%rbx
+    1502:	          48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1506:	          48 89 c7             	mov    %rax,%rdi
+    1509:	          e8 3e 01 00 00       	call   164c <U8Buf<256ul>::len() const>
+    150e:	          48 89 c6             	mov    %rax,%rsi
+    1511:	          48 89 df             	mov    %rbx,%rdi
+    1514:	          e8 57 0b 00 00       	call   2070 <nel::operator<<(nel::Log&, unsigned long)>
+    1519:	          48 89 c2             	mov    %rax,%rdx
+    151c:	          48 8d 05 f5 1a 00 00 	lea    0x1af5(%rip),%rax        # 3018 <nel::elem::poisoning+0x14>
+    1523:	          48 89 c6             	mov    %rax,%rsi
+    1526:	          48 89 d7             	mov    %rdx,%rdi
+    1529:	          e8 37 0a 00 00       	call   1f65 <nel::operator<<(nel::Log&, char const*)>
+            if (val.len() > 0) {
+    152e:	          48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1532:	          48 89 c7             	mov    %rax,%rdi
+    1535:	          e8 12 01 00 00       	call   164c <U8Buf<256ul>::len() const>
+    153a:	          48 85 c0             	test   %rax,%rax
+    153d:	          0f 95 c0             	setne  %al
+    1540:	          84 c0                	test   %al,%al
+    1542:	/-------- 74 6d                	je     15b1 <operator<<(nel::Log&, U8Buf<256ul> const&)+0xd9>
+                outs << val.data_[0];
+    1544:	|         48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1548:	|         0f b6 00             	movzbl (%rax),%eax
+    154b:	|         0f b6 d0             	movzbl %al,%edx
+    154e:	|         48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1552:	|         89 d6                	mov    %edx,%esi
+    1554:	|         48 89 c7             	mov    %rax,%rdi
+    1557:	|         e8 35 0a 00 00       	call   1f91 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    155c:	|         48 c7 45 e8 01 00 00 	movq   $0x1,-0x18(%rbp)
+    1563:	|         00 
+    1564:	|     /-- eb 34                	jmp    159a <operator<<(nel::Log&, U8Buf<256ul> const&)+0xc2>
+                    outs << ' ' << val.data_[i];
+    1566:	|  /--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    156a:	|  |  |   be 20 00 00 00       	mov    $0x20,%esi
+    156f:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    1572:	|  |  |   e8 c2 09 00 00       	call   1f39 <nel::operator<<(nel::Log&, char)>
+    1577:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    157a:	|  |  |   48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    157e:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1582:	|  |  |   48 01 c8             	add    %rcx,%rax
+    1585:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    1588:	|  |  |   0f b6 c0             	movzbl %al,%eax
+    158b:	|  |  |   89 c6                	mov    %eax,%esi
+    158d:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    1590:	|  |  |   e8 fc 09 00 00       	call   1f91 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1595:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    159a:	|  |  \-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    159e:	|  |      48 89 c7             	mov    %rax,%rdi
+    15a1:	|  |      e8 a6 00 00 00       	call   164c <U8Buf<256ul>::len() const>
+    15a6:	|  |      48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    15aa:	|  |      0f 92 c0             	setb   %al
+    15ad:	|  |      84 c0                	test   %al,%al
+    15af:	|  \----- 75 b5                	jne    1566 <operator<<(nel::Log&, U8Buf<256ul> const&)+0x8e>
+                }
+            }
+            outs << '}';
+    15b1:	\-------> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    15b5:	          be 7d 00 00 00       	mov    $0x7d,%esi
+    15ba:	          48 89 c7             	mov    %rax,%rdi
+    15bd:	          e8 77 09 00 00       	call   1f39 <nel::operator<<(nel::Log&, char)>
+            return outs;
+    15c2:	          48 8b 45 d8          	mov    -0x28(%rbp),%rax
+        }
+    15c6:	          48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    15ca:	          c9                   	leave
+    15cb:	          c3                   	ret
+
+00000000000015cc <nel::Manual<U8Buf<256ul> >::destruct()>:
+        constexpr Self &destruct()
+    15cc:	55                   	push   %rbp
+    15cd:	48 89 e5             	mov    %rsp,%rbp
+    15d0:	48 83 ec 10          	sub    $0x10,%rsp
+    15d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            deref().~Type();
+    15d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15dc:	48 89 c7             	mov    %rax,%rdi
+    15df:	e8 4e 00 00 00       	call   1632 <nel::Manual<U8Buf<256ul> >::deref()>
+    15e4:	48 89 c7             	mov    %rax,%rdi
+    15e7:	e8 70 00 00 00       	call   165c <U8Buf<256ul>::~U8Buf()>
+            return *this;
+    15ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    15f0:	c9                   	leave
+    15f1:	c3                   	ret
+
+00000000000015f2 <nel::Manual<Fake>::U::~U()>:
+                constexpr ~U() {};
+    15f2:	55                   	push   %rbp
+    15f3:	48 89 e5             	mov    %rsp,%rbp
+    15f6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    15fa:	90                   	nop
+    15fb:	5d                   	pop    %rbp
+    15fc:	c3                   	ret
+    15fd:	90                   	nop
+
+00000000000015fe <nel::Manual<Fake>::operator->()>:
+        constexpr Type *operator->()
+    15fe:	55                   	push   %rbp
+    15ff:	48 89 e5             	mov    %rsp,%rbp
+    1602:	48 83 ec 10          	sub    $0x10,%rsp
+    1606:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ptr();
+    160a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    160e:	48 89 c7             	mov    %rax,%rdi
+    1611:	e8 6c 00 00 00       	call   1682 <nel::Manual<Fake>::ptr()>
+        }
+    1616:	c9                   	leave
+    1617:	c3                   	ret
+
+0000000000001618 <nel::Manual<U8Buf<256ul> >::ptr()>:
+        constexpr Type *ptr()
+    1618:	55                   	push   %rbp
+    1619:	48 89 e5             	mov    %rsp,%rbp
+    161c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return &u_.elem_;
+    1620:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1624:	5d                   	pop    %rbp
+    1625:	c3                   	ret
+
+0000000000001626 <U8Buf<256ul>::U8Buf()>:
+        constexpr U8Buf(void) {}
+    1626:	55                   	push   %rbp
+    1627:	48 89 e5             	mov    %rsp,%rbp
+    162a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    162e:	90                   	nop
+    162f:	5d                   	pop    %rbp
+    1630:	c3                   	ret
+    1631:	90                   	nop
+
+0000000000001632 <nel::Manual<U8Buf<256ul> >::deref()>:
+        constexpr Type &deref()
+    1632:	55                   	push   %rbp
+    1633:	48 89 e5             	mov    %rsp,%rbp
+    1636:	48 83 ec 10          	sub    $0x10,%rsp
+    163a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return *ptr();
+    163e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1642:	48 89 c7             	mov    %rax,%rdi
+    1645:	e8 ce ff ff ff       	call   1618 <nel::Manual<U8Buf<256ul> >::ptr()>
+        }
+    164a:	c9                   	leave
+    164b:	c3                   	ret
+
+000000000000164c <U8Buf<256ul>::len() const>:
+        constexpr Length len(void) const
+    164c:	55                   	push   %rbp
+    164d:	48 89 e5             	mov    %rsp,%rbp
+    1650:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return N;
+    1654:	b8 00 01 00 00       	mov    $0x100,%eax
+        }
+    1659:	5d                   	pop    %rbp
+    165a:	c3                   	ret
+    165b:	90                   	nop
+
+000000000000165c <U8Buf<256ul>::~U8Buf()>:
+        constexpr ~U8Buf(void)
+    165c:	55                   	push   %rbp
+    165d:	48 89 e5             	mov    %rsp,%rbp
+    1660:	48 83 ec 10          	sub    $0x10,%rsp
+    1664:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            nel::elem::set(data_, 0xa5, N);
+    1668:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    166c:	ba 00 01 00 00       	mov    $0x100,%edx
+    1671:	be a5 00 00 00       	mov    $0xa5,%esi
+    1676:	48 89 c7             	mov    %rax,%rdi
+    1679:	e8 5b 00 00 00       	call   16d9 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    167e:	90                   	nop
+    167f:	c9                   	leave
+    1680:	c3                   	ret
+    1681:	90                   	nop
+
+0000000000001682 <nel::Manual<Fake>::ptr()>:
+        constexpr Type *ptr()
+    1682:	55                   	push   %rbp
+    1683:	48 89 e5             	mov    %rsp,%rbp
+    1686:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return &u_.elem_;
+    168a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    168e:	5d                   	pop    %rbp
+    168f:	c3                   	ret
+
+0000000000001690 <nel::Manual<Fake>::~Manual()>:
+        constexpr ~Manual() = default;
+    1690:	55                   	push   %rbp
+    1691:	48 89 e5             	mov    %rsp,%rbp
+    1694:	48 83 ec 10          	sub    $0x10,%rsp
+    1698:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    169c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16a0:	48 89 c7             	mov    %rax,%rdi
+    16a3:	e8 4a ff ff ff       	call   15f2 <nel::Manual<Fake>::U::~U()>
+    16a8:	90                   	nop
+    16a9:	c9                   	leave
+    16aa:	c3                   	ret
+
+00000000000016ab <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    16ab:	55                   	push   %rbp
+    16ac:	48 89 e5             	mov    %rsp,%rbp
+    16af:	48 83 ec 20          	sub    $0x20,%rsp
+    16b3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    16b7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    16bb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    16bf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    16c3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    16c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16cb:	48 89 ce             	mov    %rcx,%rsi
+    16ce:	48 89 c7             	mov    %rax,%rdi
+    16d1:	e8 ca f9 ff ff       	call   10a0 <memcpy@plt>
+}
+    16d6:	90                   	nop
+    16d7:	c9                   	leave
+    16d8:	c3                   	ret
+
+00000000000016d9 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    16d9:	55                   	push   %rbp
+    16da:	48 89 e5             	mov    %rsp,%rbp
+    16dd:	48 83 ec 20          	sub    $0x20,%rsp
+    16e1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    16e5:	89 f0                	mov    %esi,%eax
+    16e7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    16eb:	88 45 f4             	mov    %al,-0xc(%rbp)
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    16ee:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    16f2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    16f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16fa:	89 ce                	mov    %ecx,%esi
+    16fc:	48 89 c7             	mov    %rax,%rdi
+    16ff:	e8 5c f9 ff ff       	call   1060 <memset@plt>
+}
+    1704:	90                   	nop
+    1705:	c9                   	leave
+    1706:	c3                   	ret
+
+0000000000001707 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    1707:	55                   	push   %rbp
+    1708:	48 89 e5             	mov    %rsp,%rbp
+    170b:	48 83 ec 20          	sub    $0x20,%rsp
+    170f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1713:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1717:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    //     *id = *is;
+    // }
+    // for (uint8_t *id = d, *is = s, *const e = (d + n); id != e; ++is, ++id) {
+    //     *is = 0xa5;
+    // }
+    copy(d, s, n);
+    171b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    171f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1723:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1727:	48 89 ce             	mov    %rcx,%rsi
+    172a:	48 89 c7             	mov    %rax,%rdi
+    172d:	e8 79 ff ff ff       	call   16ab <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    poison(s, n);
+    1732:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1736:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    173a:	48 89 d6             	mov    %rdx,%rsi
+    173d:	48 89 c7             	mov    %rax,%rdi
+    1740:	e8 60 07 00 00       	call   1ea5 <nel::elem::poison(unsigned char*, unsigned long)>
+}
+    1745:	90                   	nop
+    1746:	c9                   	leave
+    1747:	c3                   	ret
+
+0000000000001748 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    1748:	55                   	push   %rbp
+    1749:	48 89 e5             	mov    %rsp,%rbp
+    174c:	48 83 ec 20          	sub    $0x20,%rsp
+    1750:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1754:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1758:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    std::memmove(d, s, n);
+    175c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1760:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1764:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1768:	48 89 ce             	mov    %rcx,%rsi
+    176b:	48 89 c7             	mov    %rax,%rdi
+    176e:	e8 4d f9 ff ff       	call   10c0 <memmove@plt>
+}
+    1773:	90                   	nop
+    1774:	c9                   	leave
+    1775:	c3                   	ret
+
+0000000000001776 <nel::elem::wipe(unsigned char*, unsigned long)>:
+
+void wipe(uint8_t *const d, Length const n)
+{
+    1776:	55                   	push   %rbp
+    1777:	48 89 e5             	mov    %rsp,%rbp
+    177a:	48 83 ec 10          	sub    $0x10,%rsp
+    177e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1782:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    set(d, 0xa5, n);
+    1786:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    178a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    178e:	be a5 00 00 00       	mov    $0xa5,%esi
+    1793:	48 89 c7             	mov    %rax,%rdi
+    1796:	e8 3e ff ff ff       	call   16d9 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    179b:	90                   	nop
+    179c:	c9                   	leave
+    179d:	c3                   	ret
+
+000000000000179e <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    179e:	55                   	push   %rbp
+    179f:	48 89 e5             	mov    %rsp,%rbp
+    17a2:	48 83 ec 20          	sub    $0x20,%rsp
+    17a6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    17aa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    17ae:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    17b2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    17b6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    17ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17be:	48 89 ce             	mov    %rcx,%rsi
+    17c1:	48 89 c7             	mov    %rax,%rdi
+    17c4:	e8 b7 f8 ff ff       	call   1080 <memcmp@plt>
+    17c9:	85 c0                	test   %eax,%eax
+    17cb:	0f 94 c0             	sete   %al
+}
+    17ce:	c9                   	leave
+    17cf:	c3                   	ret
+
+00000000000017d0 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    17d0:	55                   	push   %rbp
+    17d1:	48 89 e5             	mov    %rsp,%rbp
+    17d4:	48 83 ec 20          	sub    $0x20,%rsp
+    17d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    17dc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    17e0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    17e4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    17e8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    17ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17f0:	48 89 ce             	mov    %rcx,%rsi
+    17f3:	48 89 c7             	mov    %rax,%rdi
+    17f6:	e8 85 f8 ff ff       	call   1080 <memcmp@plt>
+    17fb:	85 c0                	test   %eax,%eax
+    17fd:	0f 95 c0             	setne  %al
+}
+    1800:	c9                   	leave
+    1801:	c3                   	ret
+
+0000000000001802 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>:
+
+// d[i] = p[i % 16] for i in [0, n), with normal stores:
+// the pattern once, then doubling the filled region.
+static void set_pattern(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    1802:	       55                   	push   %rbp
+    1803:	       48 89 e5             	mov    %rsp,%rbp
+    1806:	       48 83 ec 30          	sub    $0x30,%rsp
+    180a:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    180e:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1812:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    Length done = (n < 16) ? n : 16;
+    1816:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    181a:	       ba 10 00 00 00       	mov    $0x10,%edx
+    181f:	       48 39 d0             	cmp    %rdx,%rax
+    1822:	       48 0f 47 c2          	cmova  %rdx,%rax
+    1826:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    copy(d, p, done);
+    182a:	       48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    182e:	       48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1832:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1836:	       48 89 ce             	mov    %rcx,%rsi
+    1839:	       48 89 c7             	mov    %rax,%rdi
+    183c:	       e8 6a fe ff ff       	call   16ab <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    while (done < n) {
+    1841:	   /-- eb 3e                	jmp    1881 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x7f>
+        Length const m = (done < n - done) ? done : n - done;
+    1843:	/--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1847:	|  |   48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    184b:	|  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    184f:	|  |   48 39 c2             	cmp    %rax,%rdx
+    1852:	|  |   48 0f 46 c2          	cmovbe %rdx,%rax
+    1856:	|  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        copy(d + done, d, m);
+    185a:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    185e:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1862:	|  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    1866:	|  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    186a:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    186e:	|  |   48 89 c6             	mov    %rax,%rsi
+    1871:	|  |   48 89 cf             	mov    %rcx,%rdi
+    1874:	|  |   e8 32 fe ff ff       	call   16ab <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        done += m;
+    1879:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    187d:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+    while (done < n) {
+    1881:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1885:	|      48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    1889:	\----- 72 b8                	jb     1843 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x41>
+    }
+}
+    188b:	       90                   	nop
+    188c:	       90                   	nop
+    188d:	       c9                   	leave
+    188e:	       c3                   	ret
+
+000000000000188f <nel::elem::load16(unsigned char const*)>:
+static constexpr Length streaming_min = 256;
+
+typedef long long int Line16 __attribute__((vector_size(16)));
+
+static inline Line16 load16(uint8_t const *const s)
+{
+    188f:	55                   	push   %rbp
+    1890:	48 89 e5             	mov    %rsp,%rbp
+    1893:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Line16 v;
+    std::memcpy(&v, s, sizeof(v));
+    1897:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    189b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    189f:	48 8b 00             	mov    (%rax),%rax
+    18a2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    18a6:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    return v;
+    18aa:	66 0f 6f 45 f0       	movdqa -0x10(%rbp),%xmm0
+}
+    18af:	5d                   	pop    %rbp
+    18b0:	c3                   	ret
+
+00000000000018b1 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>:
+
+static inline void stream16(uint8_t *const d, Line16 const &v)
+{
+    18b1:	55                   	push   %rbp
+    18b2:	48 89 e5             	mov    %rsp,%rbp
+    18b5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    18b9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    18bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18c1:	66 0f 6f 00          	movdqa (%rax),%xmm0
+    18c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18c9:	66 0f e7 00          	movntdq %xmm0,(%rax)
+}
+    18cd:	90                   	nop
+    18ce:	5d                   	pop    %rbp
+    18cf:	c3                   	ret
+
+00000000000018d0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    18d0:	          55                   	push   %rbp
+    18d1:	          48 89 e5             	mov    %rsp,%rbp
+    18d4:	          48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    18d8:	          48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    18dc:	          48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    18e0:	          48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    if (n < streaming_min) {
+    18e4:	          48 81 7d 88 ff 00 00 	cmpq   $0xff,-0x78(%rbp)
+    18eb:	          00 
+    18ec:	      /-- 77 1c                	ja     190a <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        copy(d, s, n);
+    18ee:	      |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    18f2:	      |   48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    18f6:	      |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    18fa:	      |   48 89 ce             	mov    %rcx,%rsi
+    18fd:	      |   48 89 c7             	mov    %rax,%rdi
+    1900:	      |   e8 a6 fd ff ff       	call   16ab <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        return;
+    1905:	/-----|-- e9 98 01 00 00       	jmp    1aa2 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1d2>
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    190a:	|     \-> 48 8b 45 98          	mov    -0x68(%rbp),%rax
+    190e:	|         48 f7 d8             	neg    %rax
+    1911:	|         83 e0 0f             	and    $0xf,%eax
+    1914:	|         48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    copy(d, s, head);
+    1918:	|         48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    191c:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    1920:	|         48 8b 45 98          	mov    -0x68(%rbp),%rax
+    1924:	|         48 89 ce             	mov    %rcx,%rsi
+    1927:	|         48 89 c7             	mov    %rax,%rdi
+    192a:	|         e8 7c fd ff ff       	call   16ab <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    Index i = head;
+    192f:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1933:	|         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    1937:	|     /-- e9 e1 00 00 00       	jmp    1a1d <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        Line16 const a = load16(s + i);
+    193c:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    1940:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1944:	|  |  |   48 01 d0             	add    %rdx,%rax
+    1947:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    194a:	|  |  |   e8 40 ff ff ff       	call   188f <nel::elem::load16(unsigned char const*)>
+    194f:	|  |  |   0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+        Line16 const b = load16(s + i + 16);
+    1953:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1957:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    195b:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    195f:	|  |  |   48 01 d0             	add    %rdx,%rax
+    1962:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    1965:	|  |  |   e8 25 ff ff ff       	call   188f <nel::elem::load16(unsigned char const*)>
+    196a:	|  |  |   0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+        Line16 const c = load16(s + i + 32);
+    196e:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1972:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    1976:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    197a:	|  |  |   48 01 d0             	add    %rdx,%rax
+    197d:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    1980:	|  |  |   e8 0a ff ff ff       	call   188f <nel::elem::load16(unsigned char const*)>
+    1985:	|  |  |   0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+        Line16 const e = load16(s + i + 48);
+    1989:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    198d:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    1991:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1995:	|  |  |   48 01 d0             	add    %rdx,%rax
+    1998:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    199b:	|  |  |   e8 ef fe ff ff       	call   188f <nel::elem::load16(unsigned char const*)>
+    19a0:	|  |  |   0f 29 45 a0          	movaps %xmm0,-0x60(%rbp)
+        stream16(d + i, a);
+    19a4:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    19a8:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19ac:	|  |  |   48 01 c2             	add    %rax,%rdx
+    19af:	|  |  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    19b3:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    19b6:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    19b9:	|  |  |   e8 f3 fe ff ff       	call   18b1 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, b);
+    19be:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19c2:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    19c6:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    19ca:	|  |  |   48 01 c2             	add    %rax,%rdx
+    19cd:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    19d1:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    19d4:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    19d7:	|  |  |   e8 d5 fe ff ff       	call   18b1 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, c);
+    19dc:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19e0:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    19e4:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    19e8:	|  |  |   48 01 c2             	add    %rax,%rdx
+    19eb:	|  |  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    19ef:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    19f2:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    19f5:	|  |  |   e8 b7 fe ff ff       	call   18b1 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, e);
+    19fa:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19fe:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    1a02:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    1a06:	|  |  |   48 01 c2             	add    %rax,%rdx
+    1a09:	|  |  |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    1a0d:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    1a10:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    1a13:	|  |  |   e8 99 fe ff ff       	call   18b1 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    1a18:	|  |  |   48 83 45 f8 40       	addq   $0x40,-0x8(%rbp)
+    1a1d:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a21:	|  |      48 83 c0 40          	add    $0x40,%rax
+    1a25:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    1a29:	|  \----- 0f 83 0d ff ff ff    	jae    193c <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x6c>
+    }
+    for (; i + 16 <= n; i += 16) {
+    1a2f:	|     /-- eb 36                	jmp    1a67 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x197>
+        stream16(d + i, load16(s + i));
+    1a31:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    1a35:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a39:	|  |  |   48 01 d0             	add    %rdx,%rax
+    1a3c:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    1a3f:	|  |  |   e8 4b fe ff ff       	call   188f <nel::elem::load16(unsigned char const*)>
+    1a44:	|  |  |   0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+    1a48:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    1a4c:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a50:	|  |  |   48 01 c2             	add    %rax,%rdx
+    1a53:	|  |  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1a57:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    1a5a:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    1a5d:	|  |  |   e8 4f fe ff ff       	call   18b1 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    1a62:	|  |  |   48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+    1a67:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a6b:	|  |      48 83 c0 10          	add    $0x10,%rax
+    1a6f:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    1a73:	|  \----- 73 bc                	jae    1a31 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    1a75:	|         0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    1a78:	|         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    1a7c:	|         48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    1a80:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    1a84:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1a88:	|         48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    1a8c:	|         48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+    1a90:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1a94:	|         48 01 d1             	add    %rdx,%rcx
+    1a97:	|         48 89 c2             	mov    %rax,%rdx
+    1a9a:	|         48 89 cf             	mov    %rcx,%rdi
+    1a9d:	|         e8 09 fc ff ff       	call   16ab <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+}
+    1aa2:	\-------> c9                   	leave
+    1aa3:	          c3                   	ret
+
+0000000000001aa4 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    1aa4:	          55                   	push   %rbp
+    1aa5:	          48 89 e5             	mov    %rsp,%rbp
+    1aa8:	          48 83 ec 60          	sub    $0x60,%rsp
+    1aac:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    1ab0:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    1ab4:	          48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    if (n < streaming_min) {
+    1ab8:	          48 81 7d a8 ff 00 00 	cmpq   $0xff,-0x58(%rbp)
+    1abf:	          00 
+    1ac0:	      /-- 77 1c                	ja     1ade <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        set_pattern(d, p, n);
+    1ac2:	      |   48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    1ac6:	      |   48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+    1aca:	      |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    1ace:	      |   48 89 ce             	mov    %rcx,%rsi
+    1ad1:	      |   48 89 c7             	mov    %rax,%rdi
+    1ad4:	      |   e8 29 fd ff ff       	call   1802 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>
+    1ad9:	/-----|-- e9 89 01 00 00       	jmp    1c67 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c3>
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1ade:	|     \-> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    1ae2:	|         48 f7 d8             	neg    %rax
+    1ae5:	|         83 e0 0f             	and    $0xf,%eax
+    1ae8:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    for (Index i = 0; i < head; ++i) {
+    1aec:	|         48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1af3:	|         00 
+    1af4:	|     /-- eb 20                	jmp    1b16 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x72>
+        d[i] = p[i];
+    1af6:	|  /--|-> 48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    1afa:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1afe:	|  |  |   48 01 d0             	add    %rdx,%rax
+    1b01:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    1b05:	|  |  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1b09:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    1b0c:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    1b0f:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < head; ++i) {
+    1b11:	|  |  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1b16:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b1a:	|  |      48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    1b1e:	|  \----- 72 d6                	jb     1af6 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x52>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    1b20:	|         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1b27:	|         00 
+    1b28:	|     /-- eb 2d                	jmp    1b57 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xb3>
+        rotated[i] = p[(head + i) % 16];
+    1b2a:	|  /--|-> 48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1b2e:	|  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b32:	|  |  |   48 01 d0             	add    %rdx,%rax
+    1b35:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    1b38:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    1b3b:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1b3f:	|  |  |   48 01 d0             	add    %rdx,%rax
+    1b42:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    1b45:	|  |  |   48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    1b49:	|  |  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1b4d:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    1b50:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < 16; ++i) {
+    1b52:	|  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    1b57:	|  |  \-> 48 83 7d f0 0f       	cmpq   $0xf,-0x10(%rbp)
+    1b5c:	|  \----- 76 cc                	jbe    1b2a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x86>
+    }
+    Line16 const v = load16(rotated);
+    1b5e:	|         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1b62:	|         48 89 c7             	mov    %rax,%rdi
+    1b65:	|         e8 25 fd ff ff       	call   188f <nel::elem::load16(unsigned char const*)>
+    1b6a:	|         0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+    Index i = head;
+    1b6e:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1b72:	|         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    1b76:	|     /-- eb 79                	jmp    1bf1 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        stream16(d + i, v);
+    1b78:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    1b7c:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b80:	|  |  |   48 01 c2             	add    %rax,%rdx
+    1b83:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1b87:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    1b8a:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    1b8d:	|  |  |   e8 1f fd ff ff       	call   18b1 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, v);
+    1b92:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b96:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    1b9a:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    1b9e:	|  |  |   48 01 c2             	add    %rax,%rdx
+    1ba1:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1ba5:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    1ba8:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    1bab:	|  |  |   e8 01 fd ff ff       	call   18b1 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, v);
+    1bb0:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bb4:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    1bb8:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    1bbc:	|  |  |   48 01 c2             	add    %rax,%rdx
+    1bbf:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1bc3:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    1bc6:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    1bc9:	|  |  |   e8 e3 fc ff ff       	call   18b1 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, v);
+    1bce:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bd2:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    1bd6:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    1bda:	|  |  |   48 01 c2             	add    %rax,%rdx
+    1bdd:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1be1:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    1be4:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    1be7:	|  |  |   e8 c5 fc ff ff       	call   18b1 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    1bec:	|  |  |   48 83 45 e8 40       	addq   $0x40,-0x18(%rbp)
+    1bf1:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bf5:	|  |      48 83 c0 40          	add    $0x40,%rax
+    1bf9:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    1bfd:	|  \----- 0f 83 75 ff ff ff    	jae    1b78 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd4>
+    }
+    for (; i + 16 <= n; i += 16) {
+    1c03:	|     /-- eb 1f                	jmp    1c24 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x180>
+        stream16(d + i, v);
+    1c05:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    1c09:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c0d:	|  |  |   48 01 c2             	add    %rax,%rdx
+    1c10:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1c14:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    1c17:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    1c1a:	|  |  |   e8 92 fc ff ff       	call   18b1 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    1c1f:	|  |  |   48 83 45 e8 10       	addq   $0x10,-0x18(%rbp)
+    1c24:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c28:	|  |      48 83 c0 10          	add    $0x10,%rax
+    1c2c:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    1c30:	|  \----- 73 d3                	jae    1c05 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    __builtin_ia32_sfence();
+    1c32:	|         0f ae f8             	sfence
+    for (; i < n; ++i) {
+    1c35:	|     /-- eb 26                	jmp    1c5d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1b9>
+        d[i] = p[i % 16];
+    1c37:	|  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c3b:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    1c3e:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    1c41:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1c45:	|  |  |   48 01 d0             	add    %rdx,%rax
+    1c48:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    1c4c:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1c50:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    1c53:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    1c56:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (; i < n; ++i) {
+    1c58:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    1c5d:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c61:	|  |      48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    1c65:	|  \----- 72 d0                	jb     1c37 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x193>
+    }
+}
+    1c67:	\-------> c9                   	leave
+    1c68:	          c3                   	ret
+
+0000000000001c69 <nel::offset_of(unsigned char*, unsigned long)>:
+// The payload is the first align boundary leaving room for a Length in front,
+// which holds the offset from the start of the underlying allocation.
+// Malloc alignment is at least alignof(Length), so the payload is at most
+// align bytes in.
+static Length offset_of(uint8_t *const base, Length const align)
+{
+    1c69:	55                   	push   %rbp
+    1c6a:	48 89 e5             	mov    %rsp,%rbp
+    1c6d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1c71:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    USize const a = reinterpret_cast<USize>(base) + sizeof(Length);
+    1c75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c79:	48 83 c0 08          	add    $0x8,%rax
+    1c7d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1c81:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1c85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c89:	48 01 d0             	add    %rdx,%rax
+    1c8c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    1c90:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c94:	48 f7 d8             	neg    %rax
+    1c97:	48 21 c2             	and    %rax,%rdx
+    1c9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c9e:	48 29 c2             	sub    %rax,%rdx
+    1ca1:	48 89 d0             	mov    %rdx,%rax
+}
+    1ca4:	5d                   	pop    %rbp
+    1ca5:	c3                   	ret
+
+0000000000001ca6 <nel::offset_field(unsigned char*)>:
+
+static Length &offset_field(uint8_t *const p)
+{
+    1ca6:	55                   	push   %rbp
+    1ca7:	48 89 e5             	mov    %rsp,%rbp
+    1caa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return reinterpret_cast<Length *>(p)[-1];
+    1cae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cb2:	48 83 e8 08          	sub    $0x8,%rax
+}
+    1cb6:	5d                   	pop    %rbp
+    1cb7:	c3                   	ret
+
+0000000000001cb8 <nel::free_aligned(void*)>:
+
+void free_aligned(void *const p)
+{
+    1cb8:	       55                   	push   %rbp
+    1cb9:	       48 89 e5             	mov    %rsp,%rbp
+    1cbc:	       48 83 ec 20          	sub    $0x20,%rsp
+    1cc0:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (p == nullptr) { return; }
+    1cc4:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1cc9:	/----- 74 2e                	je     1cf9 <nel::free_aligned(void*)+0x41>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    1ccb:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ccf:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    std::free(u8p - offset_field(u8p));
+    1cd3:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cd7:	|      48 89 c7             	mov    %rax,%rdi
+    1cda:	|      e8 c7 ff ff ff       	call   1ca6 <nel::offset_field(unsigned char*)>
+    1cdf:	|      48 8b 00             	mov    (%rax),%rax
+    1ce2:	|      48 f7 d8             	neg    %rax
+    1ce5:	|      48 89 c2             	mov    %rax,%rdx
+    1ce8:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cec:	|      48 01 d0             	add    %rdx,%rax
+    1cef:	|      48 89 c7             	mov    %rax,%rdi
+    1cf2:	|      e8 39 f3 ff ff       	call   1030 <free@plt>
+    1cf7:	|  /-- eb 01                	jmp    1cfa <nel::free_aligned(void*)+0x42>
+    if (p == nullptr) { return; }
+    1cf9:	\--|-> 90                   	nop
+}
+    1cfa:	   \-> c9                   	leave
+    1cfb:	       c3                   	ret
+
+0000000000001cfc <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    1cfc:	             55                   	push   %rbp
+    1cfd:	             48 89 e5             	mov    %rsp,%rbp
+    1d00:	             53                   	push   %rbx
+    1d01:	             48 83 ec 78          	sub    $0x78,%rsp
+    1d05:	             48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    1d09:	             48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    1d0d:	             48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    1d11:	             48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    1d15:	             48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    1d19:	             b9 f3 00 00 00       	mov    $0xf3,%ecx
+    1d1e:	             48 8d 15 0b 13 00 00 	lea    0x130b(%rip),%rdx        # 3030 <nel::elem::streaming_min+0x8>
+    1d25:	             48 8d 35 16 13 00 00 	lea    0x1316(%rip),%rsi        # 3042 <nel::elem::streaming_min+0x1a>
+    1d2c:	             48 89 c7             	mov    %rax,%rdi
+    1d2f:	             e8 98 01 00 00       	call   1ecc <nel::Context::Context(char const*, char const*, int)>
+    1d34:	             48 83 7d 90 00       	cmpq   $0x0,-0x70(%rbp)
+    1d39:	      /----- 74 18                	je     1d53 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    1d3b:	      |      48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1d3f:	      |      48 83 e8 01          	sub    $0x1,%rax
+    1d43:	      |      48 23 45 90          	and    -0x70(%rbp),%rax
+    1d47:	      |      48 85 c0             	test   %rax,%rax
+    1d4a:	      +----- 75 07                	jne    1d53 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    1d4c:	      |      b8 01 00 00 00       	mov    $0x1,%eax
+    1d51:	      |  /-- eb 05                	jmp    1d58 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x5c>
+    1d53:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    1d58:	         \-> 0f b6 c0             	movzbl %al,%eax
+    1d5b:	             48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    1d5f:	             48 8d 0d ec 12 00 00 	lea    0x12ec(%rip),%rcx        # 3052 <nel::elem::streaming_min+0x2a>
+    1d66:	             48 89 ce             	mov    %rcx,%rsi
+    1d69:	             89 c7                	mov    %eax,%edi
+    1d6b:	             e8 93 01 00 00       	call   1f03 <nel::assert(bool, char const*, nel::Context const&)>
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    1d70:	             48 8b 45 98          	mov    -0x68(%rbp),%rax
+    1d74:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    1d78:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1d7d:	      /----- 74 11                	je     1d90 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x94>
+    1d7f:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d83:	      |      48 89 c7             	mov    %rax,%rdi
+    1d86:	      |      e8 1b ff ff ff       	call   1ca6 <nel::offset_field(unsigned char*)>
+    1d8b:	      |      48 8b 00             	mov    (%rax),%rax
+    1d8e:	      |  /-- eb 05                	jmp    1d95 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x99>
+    1d90:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    1d95:	         \-> 48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1d99:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1d9e:	      /----- 74 13                	je     1db3 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb7>
+    1da0:	      |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1da4:	      |      48 f7 d8             	neg    %rax
+    1da7:	      |      48 89 c2             	mov    %rax,%rdx
+    1daa:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1dae:	      |      48 01 d0             	add    %rdx,%rax
+    1db1:	      |  /-- eb 05                	jmp    1db8 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xbc>
+    1db3:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    1db8:	         \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1dbc:	             48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    1dc0:	             48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1dc4:	             48 01 c2             	add    %rax,%rdx
+    1dc7:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1dcb:	             48 89 d6             	mov    %rdx,%rsi
+    1dce:	             48 89 c7             	mov    %rax,%rdi
+    1dd1:	             e8 da f2 ff ff       	call   10b0 <realloc@plt>
+    1dd6:	             48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if (new_base == nullptr) { return nullptr; }
+    1dda:	             48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    1ddf:	         /-- 75 0a                	jne    1deb <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    1de1:	         |   b8 00 00 00 00       	mov    $0x0,%eax
+    1de6:	/--------|-- e9 85 00 00 00       	jmp    1e70 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x174>
+
+    Length const new_offset = offset_of(new_base, align);
+    1deb:	|        \-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    1def:	|            48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1df3:	|            48 89 d6             	mov    %rdx,%rsi
+    1df6:	|            48 89 c7             	mov    %rax,%rdi
+    1df9:	|            e8 6b fe ff ff       	call   1c69 <nel::offset_of(unsigned char*, unsigned long)>
+    1dfe:	|            48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    uint8_t *const new_p = new_base + new_offset;
+    1e02:	|            48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1e06:	|            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1e0a:	|            48 01 d0             	add    %rdx,%rax
+    1e0d:	|            48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    if (old_p != nullptr && new_offset != old_offset) {
+    1e11:	|            48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1e16:	|  /-------- 74 41                	je     1e59 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+    1e18:	|  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1e1c:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    1e20:	|  +-------- 74 37                	je     1e59 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+    1e22:	|  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    1e26:	|  |         48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    1e2a:	|  |  /----- 73 06                	jae    1e32 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x136>
+    1e2c:	|  |  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    1e30:	|  |  |  /-- eb 04                	jmp    1e36 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x13a>
+    1e32:	|  |  \--|-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    1e36:	|  |     \-> 48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        std::memmove(new_p, new_base + old_offset, n);
+    1e3a:	|  |         48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1e3e:	|  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e42:	|  |         48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    1e46:	|  |         48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    1e4a:	|  |         48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1e4e:	|  |         48 89 ce             	mov    %rcx,%rsi
+    1e51:	|  |         48 89 c7             	mov    %rax,%rdi
+    1e54:	|  |         e8 67 f2 ff ff       	call   10c0 <memmove@plt>
+    }
+    offset_field(new_p) = new_offset;
+    1e59:	|  \-------> 48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+    1e5d:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1e61:	|            48 89 c7             	mov    %rax,%rdi
+    1e64:	|            e8 3d fe ff ff       	call   1ca6 <nel::offset_field(unsigned char*)>
+    1e69:	|            48 89 18             	mov    %rbx,(%rax)
+    return new_p;
+    1e6c:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+}
+    1e70:	\----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1e74:	             c9                   	leave
+    1e75:	             c3                   	ret
+
+0000000000001e76 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    1e76:	55                   	push   %rbp
+    1e77:	48 89 e5             	mov    %rsp,%rbp
+    1e7a:	48 83 ec 10          	sub    $0x10,%rsp
+    1e7e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1e82:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return realloc_aligned(nullptr, align, 0, size);
+    1e86:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1e8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e8e:	48 89 d1             	mov    %rdx,%rcx
+    1e91:	ba 00 00 00 00       	mov    $0x0,%edx
+    1e96:	48 89 c6             	mov    %rax,%rsi
+    1e99:	bf 00 00 00 00       	mov    $0x0,%edi
+    1e9e:	e8 59 fe ff ff       	call   1cfc <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+}
+    1ea3:	c9                   	leave
+    1ea4:	c3                   	ret
+
+0000000000001ea5 <nel::elem::poison(unsigned char*, unsigned long)>:
+{
+    1ea5:	55                   	push   %rbp
+    1ea6:	48 89 e5             	mov    %rsp,%rbp
+    1ea9:	48 83 ec 10          	sub    $0x10,%rsp
+    1ead:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1eb1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    copy(d, s, n);
+    1eb5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1eb9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ebd:	48 89 d6             	mov    %rdx,%rsi
+    1ec0:	48 89 c7             	mov    %rax,%rdi
+    1ec3:	e8 ae f8 ff ff       	call   1776 <nel::elem::wipe(unsigned char*, unsigned long)>
+}
+    1ec8:	90                   	nop
+    1ec9:	c9                   	leave
+    1eca:	c3                   	ret
+    1ecb:	90                   	nop
+
+0000000000001ecc <nel::Context::Context(char const*, char const*, int)>:
+        char const *fn_name_;
+        char const *file_name_;
+        int line_num_;
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+    1ecc:	55                   	push   %rbp
+    1ecd:	48 89 e5             	mov    %rsp,%rbp
+    1ed0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1ed4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1ed8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1edc:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1edf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ee3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1ee7:	48 89 10             	mov    %rdx,(%rax)
+            , file_name_(file_name)
+    1eea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1eee:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1ef2:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , line_num_(line_num)
+    1ef6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1efa:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1efd:	89 50 10             	mov    %edx,0x10(%rax)
+        {
+        }
+    1f00:	90                   	nop
+    1f01:	5d                   	pop    %rbp
+    1f02:	c3                   	ret
+
+0000000000001f03 <nel::assert(bool, char const*, nel::Context const&)>:
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx);
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    1f03:	    55                   	push   %rbp
+    1f04:	    48 89 e5             	mov    %rsp,%rbp
+    1f07:	    48 83 ec 20          	sub    $0x20,%rsp
+    1f0b:	    89 f8                	mov    %edi,%eax
+    1f0d:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1f11:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1f15:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { assert_fail(msg, ctx); }
+    1f18:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    1f1c:	    83 f0 01             	xor    $0x1,%eax
+    1f1f:	    84 c0                	test   %al,%al
+    1f21:	/-- 74 13                	je     1f36 <nel::assert(bool, char const*, nel::Context const&)+0x33>
+    1f23:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1f27:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f2b:	|   48 89 d6             	mov    %rdx,%rsi
+    1f2e:	|   48 89 c7             	mov    %rax,%rdi
+    1f31:	|   e8 22 02 00 00       	call   2158 <nel::assert_fail(char const*, nel::Context const&)>
+}
+    1f36:	\-> 90                   	nop
+    1f37:	    c9                   	leave
+    1f38:	    c3                   	ret
+
+0000000000001f39 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1f39:	55                   	push   %rbp
+    1f3a:	48 89 e5             	mov    %rsp,%rbp
+    1f3d:	48 83 ec 10          	sub    $0x10,%rsp
+    1f41:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f45:	89 f0                	mov    %esi,%eax
+    1f47:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    1f4a:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    1f4e:	48 8b 15 2b 31 00 00 	mov    0x312b(%rip),%rdx        # 5080 <stderr@GLIBC_2.2.5>
+    1f55:	48 89 d6             	mov    %rdx,%rsi
+    1f58:	89 c7                	mov    %eax,%edi
+    1f5a:	e8 11 f1 ff ff       	call   1070 <fputc@plt>
+    return outs;
+    1f5f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1f63:	c9                   	leave
+    1f64:	c3                   	ret
+
+0000000000001f65 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1f65:	55                   	push   %rbp
+    1f66:	48 89 e5             	mov    %rsp,%rbp
+    1f69:	48 83 ec 10          	sub    $0x10,%rsp
+    1f6d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f71:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    1f75:	48 8b 15 04 31 00 00 	mov    0x3104(%rip),%rdx        # 5080 <stderr@GLIBC_2.2.5>
+    1f7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f80:	48 89 d6             	mov    %rdx,%rsi
+    1f83:	48 89 c7             	mov    %rax,%rdi
+    1f86:	e8 c5 f0 ff ff       	call   1050 <fputs@plt>
+    return outs;
+    1f8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1f8f:	c9                   	leave
+    1f90:	c3                   	ret
+
+0000000000001f91 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1f91:	55                   	push   %rbp
+    1f92:	48 89 e5             	mov    %rsp,%rbp
+    1f95:	48 83 ec 10          	sub    $0x10,%rsp
+    1f99:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f9d:	89 f0                	mov    %esi,%eax
+    1f9f:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    1fa2:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    1fa6:	48 8b 05 d3 30 00 00 	mov    0x30d3(%rip),%rax        # 5080 <stderr@GLIBC_2.2.5>
+    1fad:	48 8d 0d b9 10 00 00 	lea    0x10b9(%rip),%rcx        # 306d <nel::elem::streaming_min+0x45>
+    1fb4:	48 89 ce             	mov    %rcx,%rsi
+    1fb7:	48 89 c7             	mov    %rax,%rdi
+    1fba:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fbf:	e8 cc f0 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    1fc4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1fc8:	c9                   	leave
+    1fc9:	c3                   	ret
+
+0000000000001fca <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    1fca:	55                   	push   %rbp
+    1fcb:	48 89 e5             	mov    %rsp,%rbp
+    1fce:	48 83 ec 10          	sub    $0x10,%rsp
+    1fd2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1fd6:	89 f0                	mov    %esi,%eax
+    1fd8:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    1fdc:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    1fe0:	48 8b 05 99 30 00 00 	mov    0x3099(%rip),%rax        # 5080 <stderr@GLIBC_2.2.5>
+    1fe7:	48 8d 0d 7f 10 00 00 	lea    0x107f(%rip),%rcx        # 306d <nel::elem::streaming_min+0x45>
+    1fee:	48 89 ce             	mov    %rcx,%rsi
+    1ff1:	48 89 c7             	mov    %rax,%rdi
+    1ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ff9:	e8 92 f0 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    1ffe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2002:	c9                   	leave
+    2003:	c3                   	ret
+
+0000000000002004 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    2004:	55                   	push   %rbp
+    2005:	48 89 e5             	mov    %rsp,%rbp
+    2008:	48 83 ec 10          	sub    $0x10,%rsp
+    200c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2010:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    2013:	48 8b 05 66 30 00 00 	mov    0x3066(%rip),%rax        # 5080 <stderr@GLIBC_2.2.5>
+    201a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    201d:	48 8d 0d 49 10 00 00 	lea    0x1049(%rip),%rcx        # 306d <nel::elem::streaming_min+0x45>
+    2024:	48 89 ce             	mov    %rcx,%rsi
+    2027:	48 89 c7             	mov    %rax,%rdi
+    202a:	b8 00 00 00 00       	mov    $0x0,%eax
+    202f:	e8 5c f0 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    2034:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2038:	c9                   	leave
+    2039:	c3                   	ret
+
+000000000000203a <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    203a:	55                   	push   %rbp
+    203b:	48 89 e5             	mov    %rsp,%rbp
+    203e:	48 83 ec 10          	sub    $0x10,%rsp
+    2042:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2046:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    2049:	48 8b 05 30 30 00 00 	mov    0x3030(%rip),%rax        # 5080 <stderr@GLIBC_2.2.5>
+    2050:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    2053:	48 8d 0d 13 10 00 00 	lea    0x1013(%rip),%rcx        # 306d <nel::elem::streaming_min+0x45>
+    205a:	48 89 ce             	mov    %rcx,%rsi
+    205d:	48 89 c7             	mov    %rax,%rdi
+    2060:	b8 00 00 00 00       	mov    $0x0,%eax
+    2065:	e8 26 f0 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    206a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    206e:	c9                   	leave
+    206f:	c3                   	ret
+
+0000000000002070 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    2070:	55                   	push   %rbp
+    2071:	48 89 e5             	mov    %rsp,%rbp
+    2074:	48 83 ec 10          	sub    $0x10,%rsp
+    2078:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    207c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    2080:	48 8b 05 f9 2f 00 00 	mov    0x2ff9(%rip),%rax        # 5080 <stderr@GLIBC_2.2.5>
+    2087:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    208b:	48 8d 0d de 0f 00 00 	lea    0xfde(%rip),%rcx        # 3070 <nel::elem::streaming_min+0x48>
+    2092:	48 89 ce             	mov    %rcx,%rsi
+    2095:	48 89 c7             	mov    %rax,%rdi
+    2098:	b8 00 00 00 00       	mov    $0x0,%eax
+    209d:	e8 ee ef ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    20a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    20a6:	c9                   	leave
+    20a7:	c3                   	ret
+
+00000000000020a8 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    20a8:	55                   	push   %rbp
+    20a9:	48 89 e5             	mov    %rsp,%rbp
+    std::abort();
+    20ac:	e8 8f ef ff ff       	call   1040 <abort@plt>
+
+00000000000020b1 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    20b1:	55                   	push   %rbp
+    20b2:	48 89 e5             	mov    %rsp,%rbp
+    20b5:	48 83 ec 10          	sub    $0x10,%rsp
+    20b9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    20bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20c1:	48 8b 30             	mov    (%rax),%rsi
+    20c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20c8:	8b 48 10             	mov    0x10(%rax),%ecx
+    20cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20cf:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    20d3:	48 8b 05 a6 2f 00 00 	mov    0x2fa6(%rip),%rax        # 5080 <stderr@GLIBC_2.2.5>
+    20da:	4c 8d 0d 93 0f 00 00 	lea    0xf93(%rip),%r9        # 3074 <nel::elem::streaming_min+0x4c>
+    20e1:	49 89 f0             	mov    %rsi,%r8
+    20e4:	48 8d 35 8f 0f 00 00 	lea    0xf8f(%rip),%rsi        # 307a <nel::elem::streaming_min+0x52>
+    20eb:	48 89 c7             	mov    %rax,%rdi
+    20ee:	b8 00 00 00 00       	mov    $0x0,%eax
+    20f3:	e8 98 ef ff ff       	call   1090 <fprintf@plt>
+    abort();
+    20f8:	e8 ab ff ff ff       	call   20a8 <nel::abort()>
+
+00000000000020fd <nel::panic(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    20fd:	55                   	push   %rbp
+    20fe:	48 89 e5             	mov    %rsp,%rbp
+    2101:	48 83 ec 10          	sub    $0x10,%rsp
+    2105:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2109:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    210d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2111:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    2114:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2118:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    211b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    211f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    2123:	48 8b 05 56 2f 00 00 	mov    0x2f56(%rip),%rax        # 5080 <stderr@GLIBC_2.2.5>
+    212a:	48 83 ec 08          	sub    $0x8,%rsp
+    212e:	ff 75 f8             	push   -0x8(%rbp)
+    2131:	4c 8d 0d 3c 0f 00 00 	lea    0xf3c(%rip),%r9        # 3074 <nel::elem::streaming_min+0x4c>
+    2138:	49 89 f0             	mov    %rsi,%r8
+    213b:	48 8d 35 49 0f 00 00 	lea    0xf49(%rip),%rsi        # 308b <nel::elem::streaming_min+0x63>
+    2142:	48 89 c7             	mov    %rax,%rdi
+    2145:	b8 00 00 00 00       	mov    $0x0,%eax
+    214a:	e8 41 ef ff ff       	call   1090 <fprintf@plt>
+    214f:	48 83 c4 10          	add    $0x10,%rsp
+            "PANIC",
+            msg);
+    abort();
+    2153:	e8 50 ff ff ff       	call   20a8 <nel::abort()>
+
+0000000000002158 <nel::assert_fail(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    2158:	55                   	push   %rbp
+    2159:	48 89 e5             	mov    %rsp,%rbp
+    215c:	48 83 ec 10          	sub    $0x10,%rsp
+    2160:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2164:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    2168:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    216c:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    216f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2173:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    2176:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    217a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    217e:	48 8b 05 fb 2e 00 00 	mov    0x2efb(%rip),%rax        # 5080 <stderr@GLIBC_2.2.5>
+    2185:	48 83 ec 08          	sub    $0x8,%rsp
+    2189:	ff 75 f8             	push   -0x8(%rbp)
+    218c:	4c 8d 0d 0d 0f 00 00 	lea    0xf0d(%rip),%r9        # 30a0 <nel::elem::streaming_min+0x78>
+    2193:	49 89 f0             	mov    %rsi,%r8
+    2196:	48 8d 35 ee 0e 00 00 	lea    0xeee(%rip),%rsi        # 308b <nel::elem::streaming_min+0x63>
+    219d:	48 89 c7             	mov    %rax,%rdi
+    21a0:	b8 00 00 00 00       	mov    $0x0,%eax
+    21a5:	e8 e6 ee ff ff       	call   1090 <fprintf@plt>
+    21aa:	48 83 c4 10          	add    $0x10,%rsp
+            "ASSERT FAIL",
+            msg);
+    abort();
+    21ae:	e8 f5 fe ff ff       	call   20a8 <nel::abort()>
+
+Disassembly of section .fini:
+
+00000000000021b4 <_fini>:
+    21b4:	48 83 ec 08          	sub    $0x8,%rsp
+    21b8:	48 83 c4 08          	add    $0x8,%rsp
+    21bc:	c3                   	ret
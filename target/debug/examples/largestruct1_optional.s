@@ -0,0 +1,1631 @@
+
+target/debug/examples/largestruct1_optional:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <abort@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <abort@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <abort@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <fputs@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <fputs@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputc@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <fputc@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fprintf@plt>:
+    1060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 4018 <fprintf@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+0000000000001070 <__cxa_finalize@plt>:
+    1070:	ff 25 6a 2f 00 00    	jmp    *0x2f6a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1076:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+0000000000001080 <_start>:
+    1080:	31 ed                	xor    %ebp,%ebp
+    1082:	49 89 d1             	mov    %rdx,%r9
+    1085:	5e                   	pop    %rsi
+    1086:	48 89 e2             	mov    %rsp,%rdx
+    1089:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    108d:	50                   	push   %rax
+    108e:	54                   	push   %rsp
+    108f:	45 31 c0             	xor    %r8d,%r8d
+    1092:	31 c9                	xor    %ecx,%ecx
+    1094:	48 8d 3d 52 03 00 00 	lea    0x352(%rip),%rdi        # 13ed <main>
+    109b:	ff 15 1f 2f 00 00    	call   *0x2f1f(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    10a1:	f4                   	hlt
+    10a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    10a9:	00 00 00 
+    10ac:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000010b0 <deregister_tm_clones>:
+    10b0:	    48 8d 3d 79 2f 00 00 	lea    0x2f79(%rip),%rdi        # 4030 <__TMC_END__>
+    10b7:	    48 8d 05 72 2f 00 00 	lea    0x2f72(%rip),%rax        # 4030 <__TMC_END__>
+    10be:	    48 39 f8             	cmp    %rdi,%rax
+    10c1:	/-- 74 15                	je     10d8 <deregister_tm_clones+0x28>
+    10c3:	|   48 8b 05 fe 2e 00 00 	mov    0x2efe(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    10ca:	|   48 85 c0             	test   %rax,%rax
+    10cd:	+-- 74 09                	je     10d8 <deregister_tm_clones+0x28>
+    10cf:	|   ff e0                	jmp    *%rax
+    10d1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    10d8:	\-> c3                   	ret
+    10d9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000010e0 <register_tm_clones>:
+    10e0:	    48 8d 3d 49 2f 00 00 	lea    0x2f49(%rip),%rdi        # 4030 <__TMC_END__>
+    10e7:	    48 8d 35 42 2f 00 00 	lea    0x2f42(%rip),%rsi        # 4030 <__TMC_END__>
+    10ee:	    48 29 fe             	sub    %rdi,%rsi
+    10f1:	    48 89 f0             	mov    %rsi,%rax
+    10f4:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    10f8:	    48 c1 f8 03          	sar    $0x3,%rax
+    10fc:	    48 01 c6             	add    %rax,%rsi
+    10ff:	    48 d1 fe             	sar    %rsi
+    1102:	/-- 74 14                	je     1118 <register_tm_clones+0x38>
+    1104:	|   48 8b 05 cd 2e 00 00 	mov    0x2ecd(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    110b:	|   48 85 c0             	test   %rax,%rax
+    110e:	+-- 74 08                	je     1118 <register_tm_clones+0x38>
+    1110:	|   ff e0                	jmp    *%rax
+    1112:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1118:	\-> c3                   	ret
+    1119:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001120 <__do_global_dtors_aux>:
+    1120:	       f3 0f 1e fa          	endbr64
+    1124:	       80 3d 1d 2f 00 00 00 	cmpb   $0x0,0x2f1d(%rip)        # 4048 <completed.0>
+    112b:	/----- 75 2b                	jne    1158 <__do_global_dtors_aux+0x38>
+    112d:	|      55                   	push   %rbp
+    112e:	|      48 83 3d aa 2e 00 00 	cmpq   $0x0,0x2eaa(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1135:	|      00 
+    1136:	|      48 89 e5             	mov    %rsp,%rbp
+    1139:	|  /-- 74 0c                	je     1147 <__do_global_dtors_aux+0x27>
+    113b:	|  |   48 8b 3d e6 2e 00 00 	mov    0x2ee6(%rip),%rdi        # 4028 <__dso_handle>
+    1142:	|  |   e8 29 ff ff ff       	call   1070 <__cxa_finalize@plt>
+    1147:	|  \-> e8 64 ff ff ff       	call   10b0 <deregister_tm_clones>
+    114c:	|      c6 05 f5 2e 00 00 01 	movb   $0x1,0x2ef5(%rip)        # 4048 <completed.0>
+    1153:	|      5d                   	pop    %rbp
+    1154:	|      c3                   	ret
+    1155:	|      0f 1f 00             	nopl   (%rax)
+    1158:	\----> c3                   	ret
+    1159:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001160 <frame_dummy>:
+    1160:	f3 0f 1e fa          	endbr64
+    1164:	e9 77 ff ff ff       	jmp    10e0 <register_tm_clones>
+    1169:	90                   	nop
+
+000000000000116a <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    116a:	55                   	push   %rbp
+    116b:	48 89 e5             	mov    %rsp,%rbp
+    116e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1172:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1175:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    117a:	5d                   	pop    %rbp
+    117b:	c3                   	ret
+
+000000000000117c <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    117c:	55                   	push   %rbp
+    117d:	48 89 e5             	mov    %rsp,%rbp
+    1180:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1184:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1187:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return -1;
+    118b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1190:	5d                   	pop    %rbp
+    1191:	c3                   	ret
+
+0000000000001192 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    1192:	55                   	push   %rbp
+    1193:	48 89 e5             	mov    %rsp,%rbp
+    1196:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    119a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    119d:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    return -1;
+    11a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11a5:	5d                   	pop    %rbp
+    11a6:	c3                   	ret
+
+00000000000011a7 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    11a7:	55                   	push   %rbp
+    11a8:	48 89 e5             	mov    %rsp,%rbp
+    11ab:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11af:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11b2:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    11b5:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    return -1;
+    11b8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11bd:	5d                   	pop    %rbp
+    11be:	c3                   	ret
+
+00000000000011bf <_read_r>:
+int _read_r(struct _reent *, int) {
+    11bf:	55                   	push   %rbp
+    11c0:	48 89 e5             	mov    %rsp,%rbp
+    11c3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11c7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    11ca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11cf:	5d                   	pop    %rbp
+    11d0:	c3                   	ret
+
+00000000000011d1 <_write_r>:
+int _write_r(struct _reent *, int, char *, int) {
+    11d1:	55                   	push   %rbp
+    11d2:	48 89 e5             	mov    %rsp,%rbp
+    11d5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11d9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11dc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    11e0:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+    return -1;
+    11e3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11e8:	5d                   	pop    %rbp
+    11e9:	c3                   	ret
+
+00000000000011ea <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    11ea:	55                   	push   %rbp
+    11eb:	48 89 e5             	mov    %rsp,%rbp
+    11ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return -1;
+    11f2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11f7:	5d                   	pop    %rbp
+    11f8:	c3                   	ret
+
+00000000000011f9 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    11f9:	55                   	push   %rbp
+    11fa:	48 89 e5             	mov    %rsp,%rbp
+    11fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1201:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1204:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1209:	5d                   	pop    %rbp
+    120a:	c3                   	ret
+
+000000000000120b <T(char const*)>:
+#include <nel/log.hh>
+#include <nel/defs.hh>
+#include "libnosys_stubs.cx"
+
+char const *T(char const *v)
+{
+    120b:	55                   	push   %rbp
+    120c:	48 89 e5             	mov    %rsp,%rbp
+    120f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return v;
+    1213:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1217:	5d                   	pop    %rbp
+    1218:	c3                   	ret
+
+0000000000001219 <ex1()>:
+
+void ex1()
+{
+    1219:	55                   	push   %rbp
+    121a:	48 89 e5             	mov    %rsp,%rbp
+    121d:	48 83 ec 20          	sub    $0x20,%rsp
+    nel::Optional<char const *> a = nel::Some(T("ex1"));
+    1221:	48 8d 05 e2 0d 00 00 	lea    0xde2(%rip),%rax        # 200a <nel::None+0x1>
+    1228:	48 89 c7             	mov    %rax,%rdi
+    122b:	e8 db ff ff ff       	call   120b <T(char const*)>
+    1230:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1234:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1238:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    123c:	48 89 d6             	mov    %rdx,%rsi
+    123f:	48 89 c7             	mov    %rax,%rdi
+    1242:	e8 c4 05 00 00       	call   180b <nel::Optional<char const*> nel::Some<char const*>(char const*&&)>
+}
+    1247:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    124b:	48 89 c7             	mov    %rax,%rdi
+    124e:	e8 ed 05 00 00       	call   1840 <nel::Optional<char const*>::~Optional()>
+    1253:	c9                   	leave
+    1254:	c3                   	ret
+
+0000000000001255 <ex2()>:
+
+void ex2()
+{
+    1255:	55                   	push   %rbp
+    1256:	48 89 e5             	mov    %rsp,%rbp
+    1259:	48 83 ec 20          	sub    $0x20,%rsp
+    nel::Optional<char const *> a = nel::Some(T("ex2"));
+    125d:	48 8d 05 e4 0d 00 00 	lea    0xde4(%rip),%rax        # 2048 <nel::None+0x3f>
+    1264:	48 89 c7             	mov    %rax,%rdi
+    1267:	e8 9f ff ff ff       	call   120b <T(char const*)>
+    126c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1270:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1274:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    1278:	48 89 d6             	mov    %rdx,%rsi
+    127b:	48 89 c7             	mov    %rax,%rdi
+    127e:	e8 88 05 00 00       	call   180b <nel::Optional<char const*> nel::Some<char const*>(char const*&&)>
+    nel::log << a.is_some() << '\n';
+    1283:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1287:	48 89 c7             	mov    %rax,%rdi
+    128a:	e8 a3 04 00 00       	call   1732 <nel::Optional<char const*>::is_some() const>
+    128f:	0f b6 c0             	movzbl %al,%eax
+    1292:	89 c6                	mov    %eax,%esi
+    1294:	48 8d 05 ae 2d 00 00 	lea    0x2dae(%rip),%rax        # 4049 <nel::log>
+    129b:	48 89 c7             	mov    %rax,%rdi
+    129e:	e8 af 0c 00 00       	call   1f52 <nel::operator<<(nel::Log&, int)>
+    12a3:	be 0a 00 00 00       	mov    $0xa,%esi
+    12a8:	48 89 c7             	mov    %rax,%rdi
+    12ab:	e8 a1 0b 00 00       	call   1e51 <nel::operator<<(nel::Log&, char)>
+}
+    12b0:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    12b4:	48 89 c7             	mov    %rax,%rdi
+    12b7:	e8 84 05 00 00       	call   1840 <nel::Optional<char const*>::~Optional()>
+    12bc:	c9                   	leave
+    12bd:	c3                   	ret
+
+00000000000012be <ex3()>:
+
+void ex3()
+{
+    12be:	55                   	push   %rbp
+    12bf:	48 89 e5             	mov    %rsp,%rbp
+    12c2:	48 83 ec 40          	sub    $0x40,%rsp
+    nel::Optional<char const *> a = nel::Some(T("ex3"));
+    12c6:	48 8d 05 7f 0d 00 00 	lea    0xd7f(%rip),%rax        # 204c <nel::None+0x43>
+    12cd:	48 89 c7             	mov    %rax,%rdi
+    12d0:	e8 36 ff ff ff       	call   120b <T(char const*)>
+    12d5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    12d9:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    12dd:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+    12e1:	48 89 d6             	mov    %rdx,%rsi
+    12e4:	48 89 c7             	mov    %rax,%rdi
+    12e7:	e8 1f 05 00 00       	call   180b <nel::Optional<char const*> nel::Some<char const*>(char const*&&)>
+    nel::log << a.unwrap() << '\n';
+    12ec:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    12f0:	b9 1c 00 00 00       	mov    $0x1c,%ecx
+    12f5:	48 8d 15 54 0d 00 00 	lea    0xd54(%rip),%rdx        # 2050 <nel::None+0x47>
+    12fc:	48 8d 35 49 0d 00 00 	lea    0xd49(%rip),%rsi        # 204c <nel::None+0x43>
+    1303:	48 89 c7             	mov    %rax,%rdi
+    1306:	e8 cb 03 00 00       	call   16d6 <nel::Context::Context(char const*, char const*, int)>
+    130b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    130f:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1313:	48 89 d6             	mov    %rdx,%rsi
+    1316:	48 89 c7             	mov    %rax,%rdi
+    1319:	e8 dc 05 00 00       	call   18fa <nel::Optional<char const*>::unwrap(nel::Context const&)>
+    131e:	48 89 c6             	mov    %rax,%rsi
+    1321:	48 8d 05 21 2d 00 00 	lea    0x2d21(%rip),%rax        # 4049 <nel::log>
+    1328:	48 89 c7             	mov    %rax,%rdi
+    132b:	e8 4d 0b 00 00       	call   1e7d <nel::operator<<(nel::Log&, char const*)>
+    1330:	be 0a 00 00 00       	mov    $0xa,%esi
+    1335:	48 89 c7             	mov    %rax,%rdi
+    1338:	e8 14 0b 00 00       	call   1e51 <nel::operator<<(nel::Log&, char)>
+}
+    133d:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1341:	48 89 c7             	mov    %rax,%rdi
+    1344:	e8 f7 04 00 00       	call   1840 <nel::Optional<char const*>::~Optional()>
+    1349:	c9                   	leave
+    134a:	c3                   	ret
+
+000000000000134b <ex4()>:
+
+void ex4()
+{
+    134b:	55                   	push   %rbp
+    134c:	48 89 e5             	mov    %rsp,%rbp
+    134f:	48 83 ec 40          	sub    $0x40,%rsp
+    nel::Optional<char const *> a = nel::Some(T("ex3"));
+    1353:	48 8d 05 f2 0c 00 00 	lea    0xcf2(%rip),%rax        # 204c <nel::None+0x43>
+    135a:	48 89 c7             	mov    %rax,%rdi
+    135d:	e8 a9 fe ff ff       	call   120b <T(char const*)>
+    1362:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    1366:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    136a:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    136e:	48 89 d6             	mov    %rdx,%rsi
+    1371:	48 89 c7             	mov    %rax,%rdi
+    1374:	e8 92 04 00 00       	call   180b <nel::Optional<char const*> nel::Some<char const*>(char const*&&)>
+    nel::log << a.map<bool>([](auto &&) -> bool { return true; }) << '\n';
+    1379:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    137d:	b9 22 00 00 00       	mov    $0x22,%ecx
+    1382:	48 8d 15 c7 0c 00 00 	lea    0xcc7(%rip),%rdx        # 2050 <nel::None+0x47>
+    1389:	48 8d 35 e2 0c 00 00 	lea    0xce2(%rip),%rsi        # 2072 <nel::None+0x69>
+    1390:	48 89 c7             	mov    %rax,%rdi
+    1393:	e8 3e 03 00 00       	call   16d6 <nel::Context::Context(char const*, char const*, int)>
+    1398:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+    139c:	48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+    13a0:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    13a4:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+    13a8:	48 89 c7             	mov    %rax,%rdi
+    13ab:	e8 0c 02 00 00       	call   15bc <nel::Optional<bool> nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)>
+    13b0:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+    13b4:	48 89 c6             	mov    %rax,%rsi
+    13b7:	48 8d 05 8b 2c 00 00 	lea    0x2c8b(%rip),%rax        # 4049 <nel::log>
+    13be:	48 89 c7             	mov    %rax,%rdi
+    13c1:	e8 ca 05 00 00       	call   1990 <nel::operator<<(nel::Log&, nel::Optional<bool> const&)>
+    13c6:	be 0a 00 00 00       	mov    $0xa,%esi
+    13cb:	48 89 c7             	mov    %rax,%rdi
+    13ce:	e8 7e 0a 00 00       	call   1e51 <nel::operator<<(nel::Log&, char)>
+    13d3:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+    13d7:	48 89 c7             	mov    %rax,%rdi
+    13da:	e8 4d 05 00 00       	call   192c <nel::Optional<bool>::~Optional()>
+}
+    13df:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    13e3:	48 89 c7             	mov    %rax,%rdi
+    13e6:	e8 55 04 00 00       	call   1840 <nel::Optional<char const*>::~Optional()>
+    13eb:	c9                   	leave
+    13ec:	c3                   	ret
+
+00000000000013ed <main>:
+
+int main()
+{
+    13ed:	55                   	push   %rbp
+    13ee:	48 89 e5             	mov    %rsp,%rbp
+    nel::log << "ex1:b" << '\n';
+    13f1:	48 8d 05 7e 0c 00 00 	lea    0xc7e(%rip),%rax        # 2076 <nel::None+0x6d>
+    13f8:	48 89 c6             	mov    %rax,%rsi
+    13fb:	48 8d 05 47 2c 00 00 	lea    0x2c47(%rip),%rax        # 4049 <nel::log>
+    1402:	48 89 c7             	mov    %rax,%rdi
+    1405:	e8 73 0a 00 00       	call   1e7d <nel::operator<<(nel::Log&, char const*)>
+    140a:	be 0a 00 00 00       	mov    $0xa,%esi
+    140f:	48 89 c7             	mov    %rax,%rdi
+    1412:	e8 3a 0a 00 00       	call   1e51 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    1417:	e8 fd fd ff ff       	call   1219 <ex1()>
+    nel::log << "ex1:e" << '\n';
+    141c:	48 8d 05 59 0c 00 00 	lea    0xc59(%rip),%rax        # 207c <nel::None+0x73>
+    1423:	48 89 c6             	mov    %rax,%rsi
+    1426:	48 8d 05 1c 2c 00 00 	lea    0x2c1c(%rip),%rax        # 4049 <nel::log>
+    142d:	48 89 c7             	mov    %rax,%rdi
+    1430:	e8 48 0a 00 00       	call   1e7d <nel::operator<<(nel::Log&, char const*)>
+    1435:	be 0a 00 00 00       	mov    $0xa,%esi
+    143a:	48 89 c7             	mov    %rax,%rdi
+    143d:	e8 0f 0a 00 00       	call   1e51 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex2:b" << '\n';
+    1442:	48 8d 05 39 0c 00 00 	lea    0xc39(%rip),%rax        # 2082 <nel::None+0x79>
+    1449:	48 89 c6             	mov    %rax,%rsi
+    144c:	48 8d 05 f6 2b 00 00 	lea    0x2bf6(%rip),%rax        # 4049 <nel::log>
+    1453:	48 89 c7             	mov    %rax,%rdi
+    1456:	e8 22 0a 00 00       	call   1e7d <nel::operator<<(nel::Log&, char const*)>
+    145b:	be 0a 00 00 00       	mov    $0xa,%esi
+    1460:	48 89 c7             	mov    %rax,%rdi
+    1463:	e8 e9 09 00 00       	call   1e51 <nel::operator<<(nel::Log&, char)>
+    ex2();
+    1468:	e8 e8 fd ff ff       	call   1255 <ex2()>
+    nel::log << "ex2:e" << '\n';
+    146d:	48 8d 05 14 0c 00 00 	lea    0xc14(%rip),%rax        # 2088 <nel::None+0x7f>
+    1474:	48 89 c6             	mov    %rax,%rsi
+    1477:	48 8d 05 cb 2b 00 00 	lea    0x2bcb(%rip),%rax        # 4049 <nel::log>
+    147e:	48 89 c7             	mov    %rax,%rdi
+    1481:	e8 f7 09 00 00       	call   1e7d <nel::operator<<(nel::Log&, char const*)>
+    1486:	be 0a 00 00 00       	mov    $0xa,%esi
+    148b:	48 89 c7             	mov    %rax,%rdi
+    148e:	e8 be 09 00 00       	call   1e51 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex3:b" << '\n';
+    1493:	48 8d 05 f4 0b 00 00 	lea    0xbf4(%rip),%rax        # 208e <nel::None+0x85>
+    149a:	48 89 c6             	mov    %rax,%rsi
+    149d:	48 8d 05 a5 2b 00 00 	lea    0x2ba5(%rip),%rax        # 4049 <nel::log>
+    14a4:	48 89 c7             	mov    %rax,%rdi
+    14a7:	e8 d1 09 00 00       	call   1e7d <nel::operator<<(nel::Log&, char const*)>
+    14ac:	be 0a 00 00 00       	mov    $0xa,%esi
+    14b1:	48 89 c7             	mov    %rax,%rdi
+    14b4:	e8 98 09 00 00       	call   1e51 <nel::operator<<(nel::Log&, char)>
+    ex3();
+    14b9:	e8 00 fe ff ff       	call   12be <ex3()>
+    nel::log << "ex3:e" << '\n';
+    14be:	48 8d 05 cf 0b 00 00 	lea    0xbcf(%rip),%rax        # 2094 <nel::None+0x8b>
+    14c5:	48 89 c6             	mov    %rax,%rsi
+    14c8:	48 8d 05 7a 2b 00 00 	lea    0x2b7a(%rip),%rax        # 4049 <nel::log>
+    14cf:	48 89 c7             	mov    %rax,%rdi
+    14d2:	e8 a6 09 00 00       	call   1e7d <nel::operator<<(nel::Log&, char const*)>
+    14d7:	be 0a 00 00 00       	mov    $0xa,%esi
+    14dc:	48 89 c7             	mov    %rax,%rdi
+    14df:	e8 6d 09 00 00       	call   1e51 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex4:b" << '\n';
+    14e4:	48 8d 05 af 0b 00 00 	lea    0xbaf(%rip),%rax        # 209a <nel::None+0x91>
+    14eb:	48 89 c6             	mov    %rax,%rsi
+    14ee:	48 8d 05 54 2b 00 00 	lea    0x2b54(%rip),%rax        # 4049 <nel::log>
+    14f5:	48 89 c7             	mov    %rax,%rdi
+    14f8:	e8 80 09 00 00       	call   1e7d <nel::operator<<(nel::Log&, char const*)>
+    14fd:	be 0a 00 00 00       	mov    $0xa,%esi
+    1502:	48 89 c7             	mov    %rax,%rdi
+    1505:	e8 47 09 00 00       	call   1e51 <nel::operator<<(nel::Log&, char)>
+    ex4();
+    150a:	e8 3c fe ff ff       	call   134b <ex4()>
+    nel::log << "ex4:e" << '\n';
+    150f:	48 8d 05 8a 0b 00 00 	lea    0xb8a(%rip),%rax        # 20a0 <nel::None+0x97>
+    1516:	48 89 c6             	mov    %rax,%rsi
+    1519:	48 8d 05 29 2b 00 00 	lea    0x2b29(%rip),%rax        # 4049 <nel::log>
+    1520:	48 89 c7             	mov    %rax,%rdi
+    1523:	e8 55 09 00 00       	call   1e7d <nel::operator<<(nel::Log&, char const*)>
+    1528:	be 0a 00 00 00       	mov    $0xa,%esi
+    152d:	48 89 c7             	mov    %rax,%rdi
+    1530:	e8 1c 09 00 00       	call   1e51 <nel::operator<<(nel::Log&, char)>
+}
+    1535:	b8 00 00 00 00       	mov    $0x0,%eax
+    153a:	5d                   	pop    %rbp
+    153b:	c3                   	ret
+
+000000000000153c <nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda(char const*&&)#1}::operator()(char const*&&) const>:
+            // if contained is ptr, then move ptr.
+            // if contained is value, then move value.
+            // so, fn must always be T (*)(auto &&)
+            typedef Optional<U> ReturnType;
+            return consume<
+                ReturnType>([&fn](T &&some)
+    153c:	55                   	push   %rbp
+    153d:	48 89 e5             	mov    %rsp,%rbp
+    1540:	53                   	push   %rbx
+    1541:	48 83 ec 38          	sub    $0x38,%rsp
+    1545:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1549:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    154d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    1551:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1555:	48 8b 18             	mov    (%rax),%rbx
+                                -> ReturnType { return ReturnType::Some(fn(forward<T>(some))); },
+    1558:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    155c:	48 89 c7             	mov    %rax,%rdi
+    155f:	e8 62 05 00 00       	call   1ac6 <char const*&& nel::forward<char const*, char const*>(char const*&)>
+    1564:	48 89 c6             	mov    %rax,%rsi
+    1567:	48 89 df             	mov    %rbx,%rdi
+    156a:	e8 93 00 00 00       	call   1602 <bool ex4()::{lambda(auto:1&&)#1}::operator()<char const*>(char const*&&) const>
+    156f:	88 45 ef             	mov    %al,-0x11(%rbp)
+    1572:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1576:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+    157a:	48 89 d6             	mov    %rdx,%rsi
+    157d:	48 89 c7             	mov    %rax,%rdi
+    1580:	e8 3e 06 00 00       	call   1bc3 <nel::Optional<bool>::Some(bool&&)>
+                ReturnType>([&fn](T &&some)
+    1585:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1589:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    158d:	c9                   	leave
+    158e:	c3                   	ret
+    158f:	90                   	nop
+
+0000000000001590 <nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}::operator()() const>:
+                            [](void) -> ReturnType { return None; },
+    1590:	55                   	push   %rbp
+    1591:	48 89 e5             	mov    %rsp,%rbp
+    1594:	48 83 ec 10          	sub    $0x10,%rsp
+    1598:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    159c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    15a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15a4:	48 8d 15 5e 0a 00 00 	lea    0xa5e(%rip),%rdx        # 2009 <nel::None>
+    15ab:	48 89 d6             	mov    %rdx,%rsi
+    15ae:	48 89 c7             	mov    %rax,%rdi
+    15b1:	e8 42 06 00 00       	call   1bf8 <nel::Optional<bool>::Optional(nel::NoneT const&)>
+    15b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15ba:	c9                   	leave
+    15bb:	c3                   	ret
+
+00000000000015bc <nel::Optional<bool> nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)>:
+        Optional<U> map(Fn &&fn, Context const &ctx = Context())
+    15bc:	55                   	push   %rbp
+    15bd:	48 89 e5             	mov    %rsp,%rbp
+    15c0:	48 83 ec 30          	sub    $0x30,%rsp
+    15c4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    15c8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    15cc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    15d0:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+                ReturnType>([&fn](T &&some)
+    15d4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    15d8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                            ctx);
+    15dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15e0:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    15e4:	48 8d 4d f7          	lea    -0x9(%rbp),%rcx
+    15e8:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    15ec:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+    15f0:	49 89 f8             	mov    %rdi,%r8
+    15f3:	48 89 c7             	mov    %rax,%rdi
+    15f6:	e8 1b 00 00 00       	call   1616 <nel::Optional<bool> nel::Optional<char const*>::consume<nel::Optional<bool>, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda(char const*&&)#1}, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)>
+        }
+    15fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15ff:	c9                   	leave
+    1600:	c3                   	ret
+    1601:	90                   	nop
+
+0000000000001602 <bool ex4()::{lambda(auto:1&&)#1}::operator()<char const*>(char const*&&) const>:
+    nel::log << a.map<bool>([](auto &&) -> bool { return true; }) << '\n';
+    1602:	55                   	push   %rbp
+    1603:	48 89 e5             	mov    %rsp,%rbp
+    1606:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    160a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    160e:	b8 01 00 00 00       	mov    $0x1,%eax
+    1613:	5d                   	pop    %rbp
+    1614:	c3                   	ret
+    1615:	90                   	nop
+
+0000000000001616 <nel::Optional<bool> nel::Optional<char const*>::consume<nel::Optional<bool>, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda(char const*&&)#1}, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_some, Fn2 &&on_none, Context const &ctx = Context())
+    1616:	             55                   	push   %rbp
+    1617:	             48 89 e5             	mov    %rsp,%rbp
+    161a:	             48 83 ec 40          	sub    $0x40,%rsp
+    161e:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1622:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1626:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    162a:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    162e:	             4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+            auto tag = tag_;
+    1632:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1636:	             8b 00                	mov    (%rax),%eax
+    1638:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    163b:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    163f:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // optional::consume
+    1645:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    1649:	         /-- 74 14                	je     165f <nel::Optional<bool> nel::Optional<char const*>::consume<nel::Optional<bool>, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda(char const*&&)#1}, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x49>
+    164b:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    164f:	/--------|-- 7f 69                	jg     16ba <nel::Optional<bool> nel::Optional<char const*>::consume<nel::Optional<bool>, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda(char const*&&)#1}, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0xa4>
+    1651:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1655:	|  /-----|-- 74 4d                	je     16a4 <nel::Optional<bool> nel::Optional<char const*>::consume<nel::Optional<bool>, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda(char const*&&)#1}, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x8e>
+    1657:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    165b:	|  |  /--|-- 74 32                	je     168f <nel::Optional<bool> nel::Optional<char const*>::consume<nel::Optional<bool>, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda(char const*&&)#1}, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x79>
+    165d:	+--|--|--|-- eb 5b                	jmp    16ba <nel::Optional<bool> nel::Optional<char const*>::consume<nel::Optional<bool>, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda(char const*&&)#1}, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0xa4>
+                    return on_some(forward<T>(*some_));
+    165f:	|  |  |  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1663:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    1667:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    166a:	|  |  |      e8 ff 05 00 00       	call   1c6e <nel::Element<char const*>::operator*()>
+    166f:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1672:	|  |  |      e8 4f 04 00 00       	call   1ac6 <char const*&& nel::forward<char const*, char const*>(char const*&)>
+    1677:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    167a:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    167e:	|  |  |      48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+    1682:	|  |  |      48 89 ce             	mov    %rcx,%rsi
+    1685:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1688:	|  |  |      e8 af fe ff ff       	call   153c <nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda(char const*&&)#1}::operator()(char const*&&) const>
+    168d:	|  |  |  /-- eb 41                	jmp    16d0 <nel::Optional<bool> nel::Optional<char const*>::consume<nel::Optional<bool>, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda(char const*&&)#1}, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0xba>
+                    return on_none();
+    168f:	|  |  \--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1693:	|  |     |   48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1697:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    169a:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    169d:	|  |     |   e8 ee fe ff ff       	call   1590 <nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}::operator()() const>
+    16a2:	|  |     +-- eb 2c                	jmp    16d0 <nel::Optional<bool> nel::Optional<char const*>::consume<nel::Optional<bool>, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda(char const*&&)#1}, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Optional<char const*>::map<bool, ex4()::{lambda(auto:1&&)#1}>(ex4()::{lambda(auto:1&&)#1}&&, nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0xba>
+                    nel::panic("invalid Optional", ctx);
+    16a4:	|  \-----|-> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    16a8:	|        |   48 89 c6             	mov    %rax,%rsi
+    16ab:	|        |   48 8d 05 78 09 00 00 	lea    0x978(%rip),%rax        # 202a <nel::None+0x21>
+    16b2:	|        |   48 89 c7             	mov    %rax,%rdi
+    16b5:	|        |   e8 e1 06 00 00       	call   1d9b <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Optional", ctx);
+    16ba:	\--------|-> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    16be:	         |   48 89 c6             	mov    %rax,%rsi
+    16c1:	         |   48 8d 05 73 09 00 00 	lea    0x973(%rip),%rax        # 203b <nel::None+0x32>
+    16c8:	         |   48 89 c7             	mov    %rax,%rdi
+    16cb:	         |   e8 cb 06 00 00       	call   1d9b <nel::panic(char const*, nel::Context const&)>
+        }
+    16d0:	         \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16d4:	             c9                   	leave
+    16d5:	             c3                   	ret
+
+00000000000016d6 <nel::Context::Context(char const*, char const*, int)>:
+}
+    16d6:	55                   	push   %rbp
+    16d7:	48 89 e5             	mov    %rsp,%rbp
+    16da:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    16de:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    16e2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    16e6:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+{
+    16e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16ed:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    16f1:	48 89 10             	mov    %rdx,(%rax)
+    nel::log << "ex1:b" << '\n';
+    16f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16f8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    16fc:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    ex1();
+    1700:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1704:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1707:	89 50 10             	mov    %edx,0x10(%rax)
+    nel::log << "ex2:b" << '\n';
+    170a:	90                   	nop
+    170b:	5d                   	pop    %rbp
+    170c:	c3                   	ret
+    170d:	90                   	nop
+
+000000000000170e <nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}::operator()(char const* const&) const>:
+            return match<bool>([](T const &) -> bool { return true; },
+    170e:	55                   	push   %rbp
+    170f:	48 89 e5             	mov    %rsp,%rbp
+    1712:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1716:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    171a:	b8 01 00 00 00       	mov    $0x1,%eax
+    171f:	5d                   	pop    %rbp
+    1720:	c3                   	ret
+    1721:	90                   	nop
+
+0000000000001722 <nel::Optional<char const*>::is_some() const::{lambda()#2}::operator()() const>:
+                               [](void) -> bool { return false; });
+    1722:	55                   	push   %rbp
+    1723:	48 89 e5             	mov    %rsp,%rbp
+    1726:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    172a:	b8 00 00 00 00       	mov    $0x0,%eax
+    172f:	5d                   	pop    %rbp
+    1730:	c3                   	ret
+    1731:	90                   	nop
+
+0000000000001732 <nel::Optional<char const*>::is_some() const>:
+        constexpr bool is_some(void) const
+    1732:	55                   	push   %rbp
+    1733:	48 89 e5             	mov    %rsp,%rbp
+    1736:	48 83 ec 30          	sub    $0x30,%rsp
+    173a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+            return match<bool>([](T const &) -> bool { return true; },
+    173e:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1742:	b9 6b 01 00 00       	mov    $0x16b,%ecx
+    1747:	48 8d 15 c0 08 00 00 	lea    0x8c0(%rip),%rdx        # 200e <nel::None+0x5>
+    174e:	48 8d 35 cd 08 00 00 	lea    0x8cd(%rip),%rsi        # 2022 <nel::None+0x19>
+    1755:	48 89 c7             	mov    %rax,%rdi
+    1758:	e8 79 ff ff ff       	call   16d6 <nel::Context::Context(char const*, char const*, int)>
+    175d:	48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+    1761:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    1765:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    1769:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    176d:	48 89 c7             	mov    %rax,%rdi
+    1770:	e8 03 00 00 00       	call   1778 <bool nel::Optional<char const*>::match<bool, nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}, nel::Optional<char const*>::is_some() const::{lambda()#2}>(nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}&&, nel::Optional<char const*>::is_some() const::{lambda()#2}&&, nel::Context const&) const>
+        }
+    1775:	c9                   	leave
+    1776:	c3                   	ret
+    1777:	90                   	nop
+
+0000000000001778 <bool nel::Optional<char const*>::match<bool, nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}, nel::Optional<char const*>::is_some() const::{lambda()#2}>(nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}&&, nel::Optional<char const*>::is_some() const::{lambda()#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_some, Fn2 &&on_none, Context const &ctx = Context()) const
+    1778:	             55                   	push   %rbp
+    1779:	             48 89 e5             	mov    %rsp,%rbp
+    177c:	             48 83 ec 20          	sub    $0x20,%rsp
+    1780:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1784:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1788:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    178c:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // optional::match
+    1790:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1794:	             8b 00                	mov    (%rax),%eax
+    1796:	             83 f8 02             	cmp    $0x2,%eax
+    1799:	         /-- 74 10                	je     17ab <bool nel::Optional<char const*>::match<bool, nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}, nel::Optional<char const*>::is_some() const::{lambda()#2}>(nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}&&, nel::Optional<char const*>::is_some() const::{lambda()#2}&&, nel::Context const&) const+0x33>
+    179b:	         |   83 f8 02             	cmp    $0x2,%eax
+    179e:	/--------|-- 7f 53                	jg     17f3 <bool nel::Optional<char const*>::match<bool, nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}, nel::Optional<char const*>::is_some() const::{lambda()#2}>(nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}&&, nel::Optional<char const*>::is_some() const::{lambda()#2}&&, nel::Context const&) const+0x7b>
+    17a0:	|        |   85 c0                	test   %eax,%eax
+    17a2:	|  /-----|-- 74 39                	je     17dd <bool nel::Optional<char const*>::match<bool, nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}, nel::Optional<char const*>::is_some() const::{lambda()#2}>(nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}&&, nel::Optional<char const*>::is_some() const::{lambda()#2}&&, nel::Context const&) const+0x65>
+    17a4:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    17a7:	|  |  /--|-- 74 26                	je     17cf <bool nel::Optional<char const*>::match<bool, nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}, nel::Optional<char const*>::is_some() const::{lambda()#2}>(nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}&&, nel::Optional<char const*>::is_some() const::{lambda()#2}&&, nel::Context const&) const+0x57>
+    17a9:	+--|--|--|-- eb 48                	jmp    17f3 <bool nel::Optional<char const*>::match<bool, nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}, nel::Optional<char const*>::is_some() const::{lambda()#2}>(nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}&&, nel::Optional<char const*>::is_some() const::{lambda()#2}&&, nel::Context const&) const+0x7b>
+                    return on_some(*some_);
+    17ab:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17af:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    17b3:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    17b6:	|  |  |      e8 e9 00 00 00       	call   18a4 <nel::Element<char const*>::operator*() const>
+    17bb:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    17be:	|  |  |      48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17c2:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    17c5:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    17c8:	|  |  |      e8 41 ff ff ff       	call   170e <nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}::operator()(char const* const&) const>
+    17cd:	|  |  |  /-- eb 3a                	jmp    1809 <bool nel::Optional<char const*>::match<bool, nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}, nel::Optional<char const*>::is_some() const::{lambda()#2}>(nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}&&, nel::Optional<char const*>::is_some() const::{lambda()#2}&&, nel::Context const&) const+0x91>
+                    return on_none();
+    17cf:	|  |  \--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17d3:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    17d6:	|  |     |   e8 47 ff ff ff       	call   1722 <nel::Optional<char const*>::is_some() const::{lambda()#2}::operator()() const>
+    17db:	|  |     +-- eb 2c                	jmp    1809 <bool nel::Optional<char const*>::match<bool, nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}, nel::Optional<char const*>::is_some() const::{lambda()#2}>(nel::Optional<char const*>::is_some() const::{lambda(char const* const&)#1}&&, nel::Optional<char const*>::is_some() const::{lambda()#2}&&, nel::Context const&) const+0x91>
+                    nel::panic("invalid Optional", ctx);
+    17dd:	|  \-----|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    17e1:	|        |   48 89 c6             	mov    %rax,%rsi
+    17e4:	|        |   48 8d 05 3f 08 00 00 	lea    0x83f(%rip),%rax        # 202a <nel::None+0x21>
+    17eb:	|        |   48 89 c7             	mov    %rax,%rdi
+    17ee:	|        |   e8 a8 05 00 00       	call   1d9b <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Optional", ctx);
+    17f3:	\--------|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    17f7:	         |   48 89 c6             	mov    %rax,%rsi
+    17fa:	         |   48 8d 05 3a 08 00 00 	lea    0x83a(%rip),%rax        # 203b <nel::None+0x32>
+    1801:	         |   48 89 c7             	mov    %rax,%rdi
+    1804:	         |   e8 92 05 00 00       	call   1d9b <nel::panic(char const*, nel::Context const&)>
+        }
+    1809:	         \-> c9                   	leave
+    180a:	             c3                   	ret
+
+000000000000180b <nel::Optional<char const*> nel::Some<char const*>(char const*&&)>:
+            return outs;
+        }
+};
+
+template<typename T>
+constexpr Optional<T> Some(T &&v)
+    180b:	55                   	push   %rbp
+    180c:	48 89 e5             	mov    %rsp,%rbp
+    180f:	48 83 ec 10          	sub    $0x10,%rsp
+    1813:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1817:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+{
+    return Optional<T>::Some(forward<T>(v));
+    181b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    181f:	48 89 c7             	mov    %rax,%rdi
+    1822:	e8 9f 02 00 00       	call   1ac6 <char const*&& nel::forward<char const*, char const*>(char const*&)>
+    1827:	48 89 c2             	mov    %rax,%rdx
+    182a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    182e:	48 89 d6             	mov    %rdx,%rsi
+    1831:	48 89 c7             	mov    %rax,%rdi
+    1834:	e8 9b 02 00 00       	call   1ad4 <nel::Optional<char const*>::Some(char const*&&)>
+}
+    1839:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    183d:	c9                   	leave
+    183e:	c3                   	ret
+    183f:	90                   	nop
+
+0000000000001840 <nel::Optional<char const*>::~Optional()>:
+        constexpr ~Optional(void)
+    1840:	             55                   	push   %rbp
+    1841:	             48 89 e5             	mov    %rsp,%rbp
+    1844:	             48 83 ec 30          	sub    $0x30,%rsp
+    1848:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+            switch (tag_) { // optional::dtor
+    184c:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1850:	             8b 00                	mov    (%rax),%eax
+    1852:	             83 f8 02             	cmp    $0x2,%eax
+    1855:	/----------- 74 43                	je     189a <nel::Optional<char const*>::~Optional()+0x5a>
+    1857:	|            83 f8 02             	cmp    $0x2,%eax
+    185a:	|        /-- 7f 09                	jg     1865 <nel::Optional<char const*>::~Optional()+0x25>
+    185c:	|        |   85 c0                	test   %eax,%eax
+    185e:	|  /-----|-- 74 3d                	je     189d <nel::Optional<char const*>::~Optional()+0x5d>
+    1860:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    1863:	|  |  /--|-- 74 3b                	je     18a0 <nel::Optional<char const*>::~Optional()+0x60>
+                    nel::panic("bad Optional");
+    1865:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1869:	|  |  |      b9 87 00 00 00       	mov    $0x87,%ecx
+    186e:	|  |  |      48 8d 15 99 07 00 00 	lea    0x799(%rip),%rdx        # 200e <nel::None+0x5>
+    1875:	|  |  |      48 8d 35 2a 08 00 00 	lea    0x82a(%rip),%rsi        # 20a6 <nel::None+0x9d>
+    187c:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    187f:	|  |  |      e8 52 fe ff ff       	call   16d6 <nel::Context::Context(char const*, char const*, int)>
+    1884:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1888:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    188b:	|  |  |      48 8d 05 a9 07 00 00 	lea    0x7a9(%rip),%rax        # 203b <nel::None+0x32>
+    1892:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1895:	|  |  |      e8 01 05 00 00       	call   1d9b <nel::panic(char const*, nel::Context const&)>
+                    break;
+    189a:	\--|--|----> 90                   	nop
+    189b:	   |  |  /-- eb 04                	jmp    18a1 <nel::Optional<char const*>::~Optional()+0x61>
+                    break;
+    189d:	   \--|--|-> 90                   	nop
+    189e:	      |  +-- eb 01                	jmp    18a1 <nel::Optional<char const*>::~Optional()+0x61>
+                    break;
+    18a0:	      \--|-> 90                   	nop
+        }
+    18a1:	         \-> 90                   	nop
+    18a2:	             c9                   	leave
+    18a3:	             c3                   	ret
+
+00000000000018a4 <nel::Element<char const*>::operator*() const>:
+        constexpr Type &ref(void)
+        {
+            return value_;
+        }
+
+        constexpr Type const &operator*(void) const
+    18a4:	55                   	push   %rbp
+    18a5:	48 89 e5             	mov    %rsp,%rbp
+    18a8:	48 83 ec 10          	sub    $0x10,%rsp
+    18ac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    18b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18b4:	48 89 c7             	mov    %rax,%rdi
+    18b7:	e8 4c 02 00 00       	call   1b08 <nel::Element<char const*>::ref() const>
+        }
+    18bc:	c9                   	leave
+    18bd:	c3                   	ret
+
+00000000000018be <nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}::operator()(char const*&&) const>:
+            return consume<T>([](T &&some) -> T { return some; },
+    18be:	55                   	push   %rbp
+    18bf:	48 89 e5             	mov    %rsp,%rbp
+    18c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    18c6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    18ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18ce:	48 8b 00             	mov    (%rax),%rax
+    18d1:	5d                   	pop    %rbp
+    18d2:	c3                   	ret
+    18d3:	90                   	nop
+
+00000000000018d4 <nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}::operator()() const>:
+                              [&](void) -> T { nel::panic("not a Some", ctx); },
+    18d4:	55                   	push   %rbp
+    18d5:	48 89 e5             	mov    %rsp,%rbp
+    18d8:	48 83 ec 10          	sub    $0x10,%rsp
+    18dc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    18e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18e4:	48 8b 00             	mov    (%rax),%rax
+    18e7:	48 89 c6             	mov    %rax,%rsi
+    18ea:	48 8d 05 bf 07 00 00 	lea    0x7bf(%rip),%rax        # 20b0 <nel::None+0xa7>
+    18f1:	48 89 c7             	mov    %rax,%rdi
+    18f4:	e8 a2 04 00 00       	call   1d9b <nel::panic(char const*, nel::Context const&)>
+    18f9:	90                   	nop
+
+00000000000018fa <nel::Optional<char const*>::unwrap(nel::Context const&)>:
+        T unwrap(Context const &ctx = Context())
+    18fa:	55                   	push   %rbp
+    18fb:	48 89 e5             	mov    %rsp,%rbp
+    18fe:	48 83 ec 20          	sub    $0x20,%rsp
+    1902:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1906:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+                              [&](void) -> T { nel::panic("not a Some", ctx); },
+    190a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    190e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            return consume<T>([](T &&some) -> T { return some; },
+    1912:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1916:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    191a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    191e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1922:	48 89 c7             	mov    %rax,%rdi
+    1925:	e8 ec 01 00 00       	call   1b16 <char const* nel::Optional<char const*>::consume<char const*, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}&&, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)>
+        }
+    192a:	c9                   	leave
+    192b:	c3                   	ret
+
+000000000000192c <nel::Optional<bool>::~Optional()>:
+        constexpr ~Optional(void)
+    192c:	             55                   	push   %rbp
+    192d:	             48 89 e5             	mov    %rsp,%rbp
+    1930:	             48 83 ec 30          	sub    $0x30,%rsp
+    1934:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+            switch (tag_) { // optional::dtor
+    1938:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    193c:	             8b 00                	mov    (%rax),%eax
+    193e:	             83 f8 02             	cmp    $0x2,%eax
+    1941:	/----------- 74 43                	je     1986 <nel::Optional<bool>::~Optional()+0x5a>
+    1943:	|            83 f8 02             	cmp    $0x2,%eax
+    1946:	|        /-- 7f 09                	jg     1951 <nel::Optional<bool>::~Optional()+0x25>
+    1948:	|        |   85 c0                	test   %eax,%eax
+    194a:	|  /-----|-- 74 3d                	je     1989 <nel::Optional<bool>::~Optional()+0x5d>
+    194c:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    194f:	|  |  /--|-- 74 3b                	je     198c <nel::Optional<bool>::~Optional()+0x60>
+                    nel::panic("bad Optional");
+    1951:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1955:	|  |  |      b9 87 00 00 00       	mov    $0x87,%ecx
+    195a:	|  |  |      48 8d 15 ad 06 00 00 	lea    0x6ad(%rip),%rdx        # 200e <nel::None+0x5>
+    1961:	|  |  |      48 8d 35 3e 07 00 00 	lea    0x73e(%rip),%rsi        # 20a6 <nel::None+0x9d>
+    1968:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    196b:	|  |  |      e8 66 fd ff ff       	call   16d6 <nel::Context::Context(char const*, char const*, int)>
+    1970:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1974:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    1977:	|  |  |      48 8d 05 bd 06 00 00 	lea    0x6bd(%rip),%rax        # 203b <nel::None+0x32>
+    197e:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1981:	|  |  |      e8 15 04 00 00       	call   1d9b <nel::panic(char const*, nel::Context const&)>
+                    break;
+    1986:	\--|--|----> 90                   	nop
+    1987:	   |  |  /-- eb 04                	jmp    198d <nel::Optional<bool>::~Optional()+0x61>
+                    break;
+    1989:	   \--|--|-> 90                   	nop
+    198a:	      |  +-- eb 01                	jmp    198d <nel::Optional<bool>::~Optional()+0x61>
+                    break;
+    198c:	      \--|-> 90                   	nop
+        }
+    198d:	         \-> 90                   	nop
+    198e:	             c9                   	leave
+    198f:	             c3                   	ret
+
+0000000000001990 <nel::operator<<(nel::Log&, nel::Optional<bool> const&)>:
+        friend Log &operator<<(Log &outs, Optional const &val)
+    1990:	             55                   	push   %rbp
+    1991:	             48 89 e5             	mov    %rsp,%rbp
+    1994:	             48 83 ec 10          	sub    $0x10,%rsp
+    1998:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    199c:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            switch (val.tag_) {
+    19a0:	             48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19a4:	             8b 00                	mov    (%rax),%eax
+    19a6:	             83 f8 02             	cmp    $0x2,%eax
+    19a9:	         /-- 74 4e                	je     19f9 <nel::operator<<(nel::Log&, nel::Optional<bool> const&)+0x69>
+    19ab:	         |   83 f8 02             	cmp    $0x2,%eax
+    19ae:	/--------|-- 0f 8f e1 00 00 00    	jg     1a95 <nel::operator<<(nel::Log&, nel::Optional<bool> const&)+0x105>
+    19b4:	|        |   85 c0                	test   %eax,%eax
+    19b6:	|     /--|-- 0f 84 a8 00 00 00    	je     1a64 <nel::operator<<(nel::Log&, nel::Optional<bool> const&)+0xd4>
+    19bc:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    19bf:	+-----|--|-- 0f 85 d0 00 00 00    	jne    1a95 <nel::operator<<(nel::Log&, nel::Optional<bool> const&)+0x105>
+                         << "None)";
+    19c5:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19c9:	|     |  |   48 8d 15 eb 06 00 00 	lea    0x6eb(%rip),%rdx        # 20bb <nel::None+0xb2>
+    19d0:	|     |  |   48 89 d6             	mov    %rdx,%rsi
+    19d3:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    19d6:	|     |  |   e8 a2 04 00 00       	call   1e7d <nel::operator<<(nel::Log&, char const*)>
+    19db:	|     |  |   48 89 c2             	mov    %rax,%rdx
+    19de:	|     |  |   48 8d 05 e0 06 00 00 	lea    0x6e0(%rip),%rax        # 20c5 <nel::None+0xbc>
+    19e5:	|     |  |   48 89 c6             	mov    %rax,%rsi
+    19e8:	|     |  |   48 89 d7             	mov    %rdx,%rdi
+    19eb:	|     |  |   e8 8d 04 00 00       	call   1e7d <nel::operator<<(nel::Log&, char const*)>
+                    return outs;
+    19f0:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19f4:	|  /--|--|-- e9 cb 00 00 00       	jmp    1ac4 <nel::operator<<(nel::Log&, nel::Optional<bool> const&)+0x134>
+                         << "Some(";
+    19f9:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19fd:	|  |  |      48 8d 15 b7 06 00 00 	lea    0x6b7(%rip),%rdx        # 20bb <nel::None+0xb2>
+    1a04:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    1a07:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1a0a:	|  |  |      e8 6e 04 00 00       	call   1e7d <nel::operator<<(nel::Log&, char const*)>
+    1a0f:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    1a12:	|  |  |      48 8d 05 b2 06 00 00 	lea    0x6b2(%rip),%rax        # 20cb <nel::None+0xc2>
+    1a19:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    1a1c:	|  |  |      48 89 d7             	mov    %rdx,%rdi
+    1a1f:	|  |  |      e8 59 04 00 00       	call   1e7d <nel::operator<<(nel::Log&, char const*)>
+                    outs << *val.some_;
+    1a24:	|  |  |      48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a28:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    1a2c:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1a2f:	|  |  |      e8 de 01 00 00       	call   1c12 <nel::Element<bool>::operator*() const>
+    1a34:	|  |  |      0f b6 00             	movzbl (%rax),%eax
+    1a37:	|  |  |      0f b6 d0             	movzbl %al,%edx
+    1a3a:	|  |  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a3e:	|  |  |      89 d6                	mov    %edx,%esi
+    1a40:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1a43:	|  |  |      e8 0a 05 00 00       	call   1f52 <nel::operator<<(nel::Log&, int)>
+                    outs << "))";
+    1a48:	|  |  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a4c:	|  |  |      48 8d 15 7e 06 00 00 	lea    0x67e(%rip),%rdx        # 20d1 <nel::None+0xc8>
+    1a53:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    1a56:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1a59:	|  |  |      e8 1f 04 00 00       	call   1e7d <nel::operator<<(nel::Log&, char const*)>
+                    return outs;
+    1a5e:	|  |  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a62:	|  +--|----- eb 60                	jmp    1ac4 <nel::operator<<(nel::Log&, nel::Optional<bool> const&)+0x134>
+                         << "Inval)";
+    1a64:	|  |  \----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a68:	|  |         48 8d 15 4c 06 00 00 	lea    0x64c(%rip),%rdx        # 20bb <nel::None+0xb2>
+    1a6f:	|  |         48 89 d6             	mov    %rdx,%rsi
+    1a72:	|  |         48 89 c7             	mov    %rax,%rdi
+    1a75:	|  |         e8 03 04 00 00       	call   1e7d <nel::operator<<(nel::Log&, char const*)>
+    1a7a:	|  |         48 89 c2             	mov    %rax,%rdx
+    1a7d:	|  |         48 8d 05 50 06 00 00 	lea    0x650(%rip),%rax        # 20d4 <nel::None+0xcb>
+    1a84:	|  |         48 89 c6             	mov    %rax,%rsi
+    1a87:	|  |         48 89 d7             	mov    %rdx,%rdi
+    1a8a:	|  |         e8 ee 03 00 00       	call   1e7d <nel::operator<<(nel::Log&, char const*)>
+                    return outs;
+    1a8f:	|  |         48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a93:	|  +-------- eb 2f                	jmp    1ac4 <nel::operator<<(nel::Log&, nel::Optional<bool> const&)+0x134>
+                         << "Unknown)";
+    1a95:	\--|-------> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a99:	   |         48 8d 15 1b 06 00 00 	lea    0x61b(%rip),%rdx        # 20bb <nel::None+0xb2>
+    1aa0:	   |         48 89 d6             	mov    %rdx,%rsi
+    1aa3:	   |         48 89 c7             	mov    %rax,%rdi
+    1aa6:	   |         e8 d2 03 00 00       	call   1e7d <nel::operator<<(nel::Log&, char const*)>
+    1aab:	   |         48 89 c2             	mov    %rax,%rdx
+    1aae:	   |         48 8d 05 26 06 00 00 	lea    0x626(%rip),%rax        # 20db <nel::None+0xd2>
+    1ab5:	   |         48 89 c6             	mov    %rax,%rsi
+    1ab8:	   |         48 89 d7             	mov    %rdx,%rdi
+    1abb:	   |         e8 bd 03 00 00       	call   1e7d <nel::operator<<(nel::Log&, char const*)>
+            return outs;
+    1ac0:	   |         48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1ac4:	   \-------> c9                   	leave
+    1ac5:	             c3                   	ret
+
+0000000000001ac6 <char const*&& nel::forward<char const*, char const*>(char const*&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel so to not need std.
+ */
+template<typename U, typename T>
+constexpr U &&forward(T &t)
+    1ac6:	55                   	push   %rbp
+    1ac7:	48 89 e5             	mov    %rsp,%rbp
+    1aca:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<U &&>(t);
+    1ace:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1ad2:	5d                   	pop    %rbp
+    1ad3:	c3                   	ret
+
+0000000000001ad4 <nel::Optional<char const*>::Some(char const*&&)>:
+        constexpr static Optional Some(T &&v)
+    1ad4:	55                   	push   %rbp
+    1ad5:	48 89 e5             	mov    %rsp,%rbp
+    1ad8:	48 83 ec 10          	sub    $0x10,%rsp
+    1adc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1ae0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Optional(Phantom<Tag::SOME>(), forward<T>(v));
+    1ae4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ae8:	48 89 c7             	mov    %rax,%rdi
+    1aeb:	e8 d6 ff ff ff       	call   1ac6 <char const*&& nel::forward<char const*, char const*>(char const*&)>
+    1af0:	48 89 c2             	mov    %rax,%rdx
+    1af3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1af7:	48 89 d6             	mov    %rdx,%rsi
+    1afa:	48 89 c7             	mov    %rax,%rdi
+    1afd:	e8 2a 01 00 00       	call   1c2c <nel::Optional<char const*>::Optional(nel::Optional<char const*>::Phantom<(nel::Optional<char const*>::Tag)2>, char const*&&)>
+        }
+    1b02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b06:	c9                   	leave
+    1b07:	c3                   	ret
+
+0000000000001b08 <nel::Element<char const*>::ref() const>:
+        constexpr Type const &ref(void) const
+    1b08:	55                   	push   %rbp
+    1b09:	48 89 e5             	mov    %rsp,%rbp
+    1b0c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    1b10:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1b14:	5d                   	pop    %rbp
+    1b15:	c3                   	ret
+
+0000000000001b16 <char const* nel::Optional<char const*>::consume<char const*, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}&&, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_some, Fn2 &&on_none, Context const &ctx = Context())
+    1b16:	             55                   	push   %rbp
+    1b17:	             48 89 e5             	mov    %rsp,%rbp
+    1b1a:	             48 83 ec 30          	sub    $0x30,%rsp
+    1b1e:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1b22:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1b26:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    1b2a:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    1b2e:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b32:	             8b 00                	mov    (%rax),%eax
+    1b34:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    1b37:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b3b:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // optional::consume
+    1b41:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    1b45:	         /-- 74 14                	je     1b5b <char const* nel::Optional<char const*>::consume<char const*, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}&&, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x45>
+    1b47:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    1b4b:	/--------|-- 7f 5e                	jg     1bab <char const* nel::Optional<char const*>::consume<char const*, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}&&, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x95>
+    1b4d:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1b51:	|  /-----|-- 74 42                	je     1b95 <char const* nel::Optional<char const*>::consume<char const*, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}&&, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x7f>
+    1b53:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    1b57:	|  |  /--|-- 74 2e                	je     1b87 <char const* nel::Optional<char const*>::consume<char const*, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}&&, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x71>
+    1b59:	+--|--|--|-- eb 50                	jmp    1bab <char const* nel::Optional<char const*>::consume<char const*, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}&&, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0x95>
+                    return on_some(forward<T>(*some_));
+    1b5b:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b5f:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    1b63:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1b66:	|  |  |      e8 03 01 00 00       	call   1c6e <nel::Element<char const*>::operator*()>
+    1b6b:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1b6e:	|  |  |      e8 53 ff ff ff       	call   1ac6 <char const*&& nel::forward<char const*, char const*>(char const*&)>
+    1b73:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    1b76:	|  |  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1b7a:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    1b7d:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1b80:	|  |  |      e8 39 fd ff ff       	call   18be <nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}::operator()(char const*&&) const>
+    1b85:	|  |  |  /-- eb 3a                	jmp    1bc1 <char const* nel::Optional<char const*>::consume<char const*, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}&&, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0xab>
+                    return on_none();
+    1b87:	|  |  \--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1b8b:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    1b8e:	|  |     |   e8 41 fd ff ff       	call   18d4 <nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}::operator()() const>
+    1b93:	|  |     +-- eb 2c                	jmp    1bc1 <char const* nel::Optional<char const*>::consume<char const*, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}>(nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda(char const*&&)#1}&&, nel::Optional<char const*>::unwrap(nel::Context const&)::{lambda()#2}&&, nel::Context const&)+0xab>
+                    nel::panic("invalid Optional", ctx);
+    1b95:	|  \-----|-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1b99:	|        |   48 89 c6             	mov    %rax,%rsi
+    1b9c:	|        |   48 8d 05 87 04 00 00 	lea    0x487(%rip),%rax        # 202a <nel::None+0x21>
+    1ba3:	|        |   48 89 c7             	mov    %rax,%rdi
+    1ba6:	|        |   e8 f0 01 00 00       	call   1d9b <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Optional", ctx);
+    1bab:	\--------|-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1baf:	         |   48 89 c6             	mov    %rax,%rsi
+    1bb2:	         |   48 8d 05 82 04 00 00 	lea    0x482(%rip),%rax        # 203b <nel::None+0x32>
+    1bb9:	         |   48 89 c7             	mov    %rax,%rdi
+    1bbc:	         |   e8 da 01 00 00       	call   1d9b <nel::panic(char const*, nel::Context const&)>
+        }
+    1bc1:	         \-> c9                   	leave
+    1bc2:	             c3                   	ret
+
+0000000000001bc3 <nel::Optional<bool>::Some(bool&&)>:
+        constexpr static Optional Some(T &&v)
+    1bc3:	55                   	push   %rbp
+    1bc4:	48 89 e5             	mov    %rsp,%rbp
+    1bc7:	48 83 ec 10          	sub    $0x10,%rsp
+    1bcb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1bcf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Optional(Phantom<Tag::SOME>(), forward<T>(v));
+    1bd3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bd7:	48 89 c7             	mov    %rax,%rdi
+    1bda:	e8 a9 00 00 00       	call   1c88 <bool&& nel::forward<bool, bool>(bool&)>
+    1bdf:	48 89 c2             	mov    %rax,%rdx
+    1be2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1be6:	48 89 d6             	mov    %rdx,%rsi
+    1be9:	48 89 c7             	mov    %rax,%rdi
+    1bec:	e8 a5 00 00 00       	call   1c96 <nel::Optional<bool>::Optional(nel::Optional<bool>::Phantom<(nel::Optional<bool>::Tag)2>, bool&&)>
+        }
+    1bf1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bf5:	c9                   	leave
+    1bf6:	c3                   	ret
+    1bf7:	90                   	nop
+
+0000000000001bf8 <nel::Optional<bool>::Optional(nel::NoneT const&)>:
+        constexpr Optional(NoneT const &)
+    1bf8:	55                   	push   %rbp
+    1bf9:	48 89 e5             	mov    %rsp,%rbp
+    1bfc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1c00:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : tag_(Tag::NONE)
+    1c04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c08:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+        }
+    1c0e:	90                   	nop
+    1c0f:	5d                   	pop    %rbp
+    1c10:	c3                   	ret
+    1c11:	90                   	nop
+
+0000000000001c12 <nel::Element<bool>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    1c12:	55                   	push   %rbp
+    1c13:	48 89 e5             	mov    %rsp,%rbp
+    1c16:	48 83 ec 10          	sub    $0x10,%rsp
+    1c1a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    1c1e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c22:	48 89 c7             	mov    %rax,%rdi
+    1c25:	e8 ae 00 00 00       	call   1cd8 <nel::Element<bool>::ref() const>
+        }
+    1c2a:	c9                   	leave
+    1c2b:	c3                   	ret
+
+0000000000001c2c <nel::Optional<char const*>::Optional(nel::Optional<char const*>::Phantom<(nel::Optional<char const*>::Tag)2>, char const*&&)>:
+        constexpr Optional(Phantom<Tag::SOME> const, T &&v)
+    1c2c:	55                   	push   %rbp
+    1c2d:	48 89 e5             	mov    %rsp,%rbp
+    1c30:	53                   	push   %rbx
+    1c31:	48 83 ec 18          	sub    $0x18,%rsp
+    1c35:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1c39:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::SOME)
+    1c3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c41:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , some_(forward<T>(v))
+    1c47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c4b:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    1c4f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c53:	48 89 c7             	mov    %rax,%rdi
+    1c56:	e8 6b fe ff ff       	call   1ac6 <char const*&& nel::forward<char const*, char const*>(char const*&)>
+    1c5b:	48 89 c6             	mov    %rax,%rsi
+    1c5e:	48 89 df             	mov    %rbx,%rdi
+    1c61:	e8 80 00 00 00       	call   1ce6 <nel::Element<char const*>::Element(char const*&&)>
+        }
+    1c66:	90                   	nop
+    1c67:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1c6b:	c9                   	leave
+    1c6c:	c3                   	ret
+    1c6d:	90                   	nop
+
+0000000000001c6e <nel::Element<char const*>::operator*()>:
+
+        constexpr Type &operator*(void)
+    1c6e:	55                   	push   %rbp
+    1c6f:	48 89 e5             	mov    %rsp,%rbp
+    1c72:	48 83 ec 10          	sub    $0x10,%rsp
+    1c76:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    1c7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c7e:	48 89 c7             	mov    %rax,%rdi
+    1c81:	e8 8a 00 00 00       	call   1d10 <nel::Element<char const*>::ref()>
+        }
+    1c86:	c9                   	leave
+    1c87:	c3                   	ret
+
+0000000000001c88 <bool&& nel::forward<bool, bool>(bool&)>:
+constexpr U &&forward(T &t)
+    1c88:	55                   	push   %rbp
+    1c89:	48 89 e5             	mov    %rsp,%rbp
+    1c8c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    1c90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1c94:	5d                   	pop    %rbp
+    1c95:	c3                   	ret
+
+0000000000001c96 <nel::Optional<bool>::Optional(nel::Optional<bool>::Phantom<(nel::Optional<bool>::Tag)2>, bool&&)>:
+        constexpr Optional(Phantom<Tag::SOME> const, T &&v)
+    1c96:	55                   	push   %rbp
+    1c97:	48 89 e5             	mov    %rsp,%rbp
+    1c9a:	53                   	push   %rbx
+    1c9b:	48 83 ec 18          	sub    $0x18,%rsp
+    1c9f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1ca3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::SOME)
+    1ca7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cab:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , some_(forward<T>(v))
+    1cb1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cb5:	48 8d 58 04          	lea    0x4(%rax),%rbx
+    1cb9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1cbd:	48 89 c7             	mov    %rax,%rdi
+    1cc0:	e8 c3 ff ff ff       	call   1c88 <bool&& nel::forward<bool, bool>(bool&)>
+    1cc5:	48 89 c6             	mov    %rax,%rsi
+    1cc8:	48 89 df             	mov    %rbx,%rdi
+    1ccb:	e8 4e 00 00 00       	call   1d1e <nel::Element<bool>::Element(bool&&)>
+        }
+    1cd0:	90                   	nop
+    1cd1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1cd5:	c9                   	leave
+    1cd6:	c3                   	ret
+    1cd7:	90                   	nop
+
+0000000000001cd8 <nel::Element<bool>::ref() const>:
+        constexpr Type const &ref(void) const
+    1cd8:	55                   	push   %rbp
+    1cd9:	48 89 e5             	mov    %rsp,%rbp
+    1cdc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    1ce0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1ce4:	5d                   	pop    %rbp
+    1ce5:	c3                   	ret
+
+0000000000001ce6 <nel::Element<char const*>::Element(char const*&&)>:
+        constexpr Element(Type &&val)
+    1ce6:	55                   	push   %rbp
+    1ce7:	48 89 e5             	mov    %rsp,%rbp
+    1cea:	48 83 ec 10          	sub    $0x10,%rsp
+    1cee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1cf2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    1cf6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cfa:	48 89 c7             	mov    %rax,%rdi
+    1cfd:	e8 c4 fd ff ff       	call   1ac6 <char const*&& nel::forward<char const*, char const*>(char const*&)>
+    1d02:	48 8b 10             	mov    (%rax),%rdx
+    1d05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d09:	48 89 10             	mov    %rdx,(%rax)
+        }
+    1d0c:	90                   	nop
+    1d0d:	c9                   	leave
+    1d0e:	c3                   	ret
+    1d0f:	90                   	nop
+
+0000000000001d10 <nel::Element<char const*>::ref()>:
+        constexpr Type &ref(void)
+    1d10:	55                   	push   %rbp
+    1d11:	48 89 e5             	mov    %rsp,%rbp
+    1d14:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    1d18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1d1c:	5d                   	pop    %rbp
+    1d1d:	c3                   	ret
+
+0000000000001d1e <nel::Element<bool>::Element(bool&&)>:
+        constexpr Element(Type &&val)
+    1d1e:	55                   	push   %rbp
+    1d1f:	48 89 e5             	mov    %rsp,%rbp
+    1d22:	48 83 ec 10          	sub    $0x10,%rsp
+    1d26:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1d2a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    1d2e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d32:	48 89 c7             	mov    %rax,%rdi
+    1d35:	e8 4e ff ff ff       	call   1c88 <bool&& nel::forward<bool, bool>(bool&)>
+    1d3a:	0f b6 10             	movzbl (%rax),%edx
+    1d3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d41:	88 10                	mov    %dl,(%rax)
+        }
+    1d43:	90                   	nop
+    1d44:	c9                   	leave
+    1d45:	c3                   	ret
+
+0000000000001d46 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    1d46:	55                   	push   %rbp
+    1d47:	48 89 e5             	mov    %rsp,%rbp
+    std::abort();
+    1d4a:	e8 e1 f2 ff ff       	call   1030 <abort@plt>
+
+0000000000001d4f <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    1d4f:	55                   	push   %rbp
+    1d50:	48 89 e5             	mov    %rsp,%rbp
+    1d53:	48 83 ec 10          	sub    $0x10,%rsp
+    1d57:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    1d5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d5f:	48 8b 30             	mov    (%rax),%rsi
+    1d62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d66:	8b 48 10             	mov    0x10(%rax),%ecx
+    1d69:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d6d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1d71:	48 8b 05 c8 22 00 00 	mov    0x22c8(%rip),%rax        # 4040 <stderr@GLIBC_2.2.5>
+    1d78:	4c 8d 0d 65 03 00 00 	lea    0x365(%rip),%r9        # 20e4 <nel::None+0xdb>
+    1d7f:	49 89 f0             	mov    %rsi,%r8
+    1d82:	48 8d 35 61 03 00 00 	lea    0x361(%rip),%rsi        # 20ea <nel::None+0xe1>
+    1d89:	48 89 c7             	mov    %rax,%rdi
+    1d8c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d91:	e8 ca f2 ff ff       	call   1060 <fprintf@plt>
+    abort();
+    1d96:	e8 ab ff ff ff       	call   1d46 <nel::abort()>
+
+0000000000001d9b <nel::panic(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1d9b:	55                   	push   %rbp
+    1d9c:	48 89 e5             	mov    %rsp,%rbp
+    1d9f:	48 83 ec 10          	sub    $0x10,%rsp
+    1da3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1da7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    1dab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1daf:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    1db2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1db6:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    1db9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1dbd:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    1dc1:	48 8b 05 78 22 00 00 	mov    0x2278(%rip),%rax        # 4040 <stderr@GLIBC_2.2.5>
+    1dc8:	48 83 ec 08          	sub    $0x8,%rsp
+    1dcc:	ff 75 f8             	push   -0x8(%rbp)
+    1dcf:	4c 8d 0d 0e 03 00 00 	lea    0x30e(%rip),%r9        # 20e4 <nel::None+0xdb>
+    1dd6:	49 89 f0             	mov    %rsi,%r8
+    1dd9:	48 8d 35 1b 03 00 00 	lea    0x31b(%rip),%rsi        # 20fb <nel::None+0xf2>
+    1de0:	48 89 c7             	mov    %rax,%rdi
+    1de3:	b8 00 00 00 00       	mov    $0x0,%eax
+    1de8:	e8 73 f2 ff ff       	call   1060 <fprintf@plt>
+    1ded:	48 83 c4 10          	add    $0x10,%rsp
+            "PANIC",
+            msg);
+    abort();
+    1df1:	e8 50 ff ff ff       	call   1d46 <nel::abort()>
+
+0000000000001df6 <nel::assert_fail(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1df6:	55                   	push   %rbp
+    1df7:	48 89 e5             	mov    %rsp,%rbp
+    1dfa:	48 83 ec 10          	sub    $0x10,%rsp
+    1dfe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1e02:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    1e06:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e0a:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    1e0d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e11:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    1e14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e18:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    1e1c:	48 8b 05 1d 22 00 00 	mov    0x221d(%rip),%rax        # 4040 <stderr@GLIBC_2.2.5>
+    1e23:	48 83 ec 08          	sub    $0x8,%rsp
+    1e27:	ff 75 f8             	push   -0x8(%rbp)
+    1e2a:	4c 8d 0d df 02 00 00 	lea    0x2df(%rip),%r9        # 2110 <nel::None+0x107>
+    1e31:	49 89 f0             	mov    %rsi,%r8
+    1e34:	48 8d 35 c0 02 00 00 	lea    0x2c0(%rip),%rsi        # 20fb <nel::None+0xf2>
+    1e3b:	48 89 c7             	mov    %rax,%rdi
+    1e3e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e43:	e8 18 f2 ff ff       	call   1060 <fprintf@plt>
+    1e48:	48 83 c4 10          	add    $0x10,%rsp
+            "ASSERT FAIL",
+            msg);
+    abort();
+    1e4c:	e8 f5 fe ff ff       	call   1d46 <nel::abort()>
+
+0000000000001e51 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1e51:	55                   	push   %rbp
+    1e52:	48 89 e5             	mov    %rsp,%rbp
+    1e55:	48 83 ec 10          	sub    $0x10,%rsp
+    1e59:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1e5d:	89 f0                	mov    %esi,%eax
+    1e5f:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    1e62:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    1e66:	48 8b 15 d3 21 00 00 	mov    0x21d3(%rip),%rdx        # 4040 <stderr@GLIBC_2.2.5>
+    1e6d:	48 89 d6             	mov    %rdx,%rsi
+    1e70:	89 c7                	mov    %eax,%edi
+    1e72:	e8 d9 f1 ff ff       	call   1050 <fputc@plt>
+    return outs;
+    1e77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1e7b:	c9                   	leave
+    1e7c:	c3                   	ret
+
+0000000000001e7d <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1e7d:	55                   	push   %rbp
+    1e7e:	48 89 e5             	mov    %rsp,%rbp
+    1e81:	48 83 ec 10          	sub    $0x10,%rsp
+    1e85:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1e89:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    1e8d:	48 8b 15 ac 21 00 00 	mov    0x21ac(%rip),%rdx        # 4040 <stderr@GLIBC_2.2.5>
+    1e94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e98:	48 89 d6             	mov    %rdx,%rsi
+    1e9b:	48 89 c7             	mov    %rax,%rdi
+    1e9e:	e8 9d f1 ff ff       	call   1040 <fputs@plt>
+    return outs;
+    1ea3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1ea7:	c9                   	leave
+    1ea8:	c3                   	ret
+
+0000000000001ea9 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1ea9:	55                   	push   %rbp
+    1eaa:	48 89 e5             	mov    %rsp,%rbp
+    1ead:	48 83 ec 10          	sub    $0x10,%rsp
+    1eb1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1eb5:	89 f0                	mov    %esi,%eax
+    1eb7:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    1eba:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    1ebe:	48 8b 05 7b 21 00 00 	mov    0x217b(%rip),%rax        # 4040 <stderr@GLIBC_2.2.5>
+    1ec5:	48 8d 0d 50 02 00 00 	lea    0x250(%rip),%rcx        # 211c <nel::None+0x113>
+    1ecc:	48 89 ce             	mov    %rcx,%rsi
+    1ecf:	48 89 c7             	mov    %rax,%rdi
+    1ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ed7:	e8 84 f1 ff ff       	call   1060 <fprintf@plt>
+    return outs;
+    1edc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1ee0:	c9                   	leave
+    1ee1:	c3                   	ret
+
+0000000000001ee2 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    1ee2:	55                   	push   %rbp
+    1ee3:	48 89 e5             	mov    %rsp,%rbp
+    1ee6:	48 83 ec 10          	sub    $0x10,%rsp
+    1eea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1eee:	89 f0                	mov    %esi,%eax
+    1ef0:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    1ef4:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    1ef8:	48 8b 05 41 21 00 00 	mov    0x2141(%rip),%rax        # 4040 <stderr@GLIBC_2.2.5>
+    1eff:	48 8d 0d 16 02 00 00 	lea    0x216(%rip),%rcx        # 211c <nel::None+0x113>
+    1f06:	48 89 ce             	mov    %rcx,%rsi
+    1f09:	48 89 c7             	mov    %rax,%rdi
+    1f0c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f11:	e8 4a f1 ff ff       	call   1060 <fprintf@plt>
+    return outs;
+    1f16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1f1a:	c9                   	leave
+    1f1b:	c3                   	ret
+
+0000000000001f1c <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    1f1c:	55                   	push   %rbp
+    1f1d:	48 89 e5             	mov    %rsp,%rbp
+    1f20:	48 83 ec 10          	sub    $0x10,%rsp
+    1f24:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f28:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    1f2b:	48 8b 05 0e 21 00 00 	mov    0x210e(%rip),%rax        # 4040 <stderr@GLIBC_2.2.5>
+    1f32:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    1f35:	48 8d 0d e0 01 00 00 	lea    0x1e0(%rip),%rcx        # 211c <nel::None+0x113>
+    1f3c:	48 89 ce             	mov    %rcx,%rsi
+    1f3f:	48 89 c7             	mov    %rax,%rdi
+    1f42:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f47:	e8 14 f1 ff ff       	call   1060 <fprintf@plt>
+    return outs;
+    1f4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1f50:	c9                   	leave
+    1f51:	c3                   	ret
+
+0000000000001f52 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    1f52:	55                   	push   %rbp
+    1f53:	48 89 e5             	mov    %rsp,%rbp
+    1f56:	48 83 ec 10          	sub    $0x10,%rsp
+    1f5a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f5e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    1f61:	48 8b 05 d8 20 00 00 	mov    0x20d8(%rip),%rax        # 4040 <stderr@GLIBC_2.2.5>
+    1f68:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    1f6b:	48 8d 0d aa 01 00 00 	lea    0x1aa(%rip),%rcx        # 211c <nel::None+0x113>
+    1f72:	48 89 ce             	mov    %rcx,%rsi
+    1f75:	48 89 c7             	mov    %rax,%rdi
+    1f78:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f7d:	e8 de f0 ff ff       	call   1060 <fprintf@plt>
+    return outs;
+    1f82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1f86:	c9                   	leave
+    1f87:	c3                   	ret
+
+0000000000001f88 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    1f88:	55                   	push   %rbp
+    1f89:	48 89 e5             	mov    %rsp,%rbp
+    1f8c:	48 83 ec 10          	sub    $0x10,%rsp
+    1f90:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f94:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    1f98:	48 8b 05 a1 20 00 00 	mov    0x20a1(%rip),%rax        # 4040 <stderr@GLIBC_2.2.5>
+    1f9f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1fa3:	48 8d 0d 75 01 00 00 	lea    0x175(%rip),%rcx        # 211f <nel::None+0x116>
+    1faa:	48 89 ce             	mov    %rcx,%rsi
+    1fad:	48 89 c7             	mov    %rax,%rdi
+    1fb0:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fb5:	e8 a6 f0 ff ff       	call   1060 <fprintf@plt>
+    return outs;
+    1fba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1fbe:	c9                   	leave
+    1fbf:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000001fc0 <_fini>:
+    1fc0:	48 83 ec 08          	sub    $0x8,%rsp
+    1fc4:	48 83 c4 08          	add    $0x8,%rsp
+    1fc8:	c3                   	ret
@@ -0,0 +1,2839 @@
+
+target/debug/examples/largestruct1_rc:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 4f 00 00 	mov    0x4fc5(%rip),%rax        # 5fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 4f 00 00    	push   0x4fca(%rip)        # 5ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 4f 00 00    	jmp    *0x4fcc(%rip)        # 5ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 4f 00 00    	jmp    *0x4fca(%rip)        # 6000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 4f 00 00    	jmp    *0x4fc2(%rip)        # 6008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 4f 00 00    	jmp    *0x4fba(%rip)        # 6010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memset@plt>:
+    1060:	ff 25 b2 4f 00 00    	jmp    *0x4fb2(%rip)        # 6018 <memset@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 4f 00 00    	jmp    *0x4faa(%rip)        # 6020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 4f 00 00    	jmp    *0x4fa2(%rip)        # 6028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 4f 00 00    	jmp    *0x4f9a(%rip)        # 6030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcpy@plt>:
+    10a0:	ff 25 92 4f 00 00    	jmp    *0x4f92(%rip)        # 6038 <memcpy@GLIBC_2.14>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <realloc@plt>:
+    10b0:	ff 25 8a 4f 00 00    	jmp    *0x4f8a(%rip)        # 6040 <realloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <memmove@plt>:
+    10c0:	ff 25 82 4f 00 00    	jmp    *0x4f82(%rip)        # 6048 <memmove@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010d0 <__cxa_finalize@plt>:
+    10d0:	ff 25 0a 4f 00 00    	jmp    *0x4f0a(%rip)        # 5fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10d6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010e0 <_start>:
+    10e0:	31 ed                	xor    %ebp,%ebp
+    10e2:	49 89 d1             	mov    %rdx,%r9
+    10e5:	5e                   	pop    %rsi
+    10e6:	48 89 e2             	mov    %rsp,%rdx
+    10e9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    10ed:	50                   	push   %rax
+    10ee:	54                   	push   %rsp
+    10ef:	45 31 c0             	xor    %r8d,%r8d
+    10f2:	31 c9                	xor    %ecx,%ecx
+    10f4:	48 8d 3d 74 02 00 00 	lea    0x274(%rip),%rdi        # 136f <main>
+    10fb:	ff 15 bf 4e 00 00    	call   *0x4ebf(%rip)        # 5fc0 <__libc_start_main@GLIBC_2.34>
+    1101:	f4                   	hlt
+    1102:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1109:	00 00 00 
+    110c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001110 <deregister_tm_clones>:
+    1110:	    48 8d 3d 49 4f 00 00 	lea    0x4f49(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+    1117:	    48 8d 05 42 4f 00 00 	lea    0x4f42(%rip),%rax        # 6060 <stderr@GLIBC_2.2.5>
+    111e:	    48 39 f8             	cmp    %rdi,%rax
+    1121:	/-- 74 15                	je     1138 <deregister_tm_clones+0x28>
+    1123:	|   48 8b 05 9e 4e 00 00 	mov    0x4e9e(%rip),%rax        # 5fc8 <_ITM_deregisterTMCloneTable@Base>
+    112a:	|   48 85 c0             	test   %rax,%rax
+    112d:	+-- 74 09                	je     1138 <deregister_tm_clones+0x28>
+    112f:	|   ff e0                	jmp    *%rax
+    1131:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1138:	\-> c3                   	ret
+    1139:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001140 <register_tm_clones>:
+    1140:	    48 8d 3d 19 4f 00 00 	lea    0x4f19(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+    1147:	    48 8d 35 12 4f 00 00 	lea    0x4f12(%rip),%rsi        # 6060 <stderr@GLIBC_2.2.5>
+    114e:	    48 29 fe             	sub    %rdi,%rsi
+    1151:	    48 89 f0             	mov    %rsi,%rax
+    1154:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1158:	    48 c1 f8 03          	sar    $0x3,%rax
+    115c:	    48 01 c6             	add    %rax,%rsi
+    115f:	    48 d1 fe             	sar    %rsi
+    1162:	/-- 74 14                	je     1178 <register_tm_clones+0x38>
+    1164:	|   48 8b 05 6d 4e 00 00 	mov    0x4e6d(%rip),%rax        # 5fd8 <_ITM_registerTMCloneTable@Base>
+    116b:	|   48 85 c0             	test   %rax,%rax
+    116e:	+-- 74 08                	je     1178 <register_tm_clones+0x38>
+    1170:	|   ff e0                	jmp    *%rax
+    1172:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1178:	\-> c3                   	ret
+    1179:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001180 <__do_global_dtors_aux>:
+    1180:	       f3 0f 1e fa          	endbr64
+    1184:	       80 3d dd 4e 00 00 00 	cmpb   $0x0,0x4edd(%rip)        # 6068 <completed.0>
+    118b:	/----- 75 2b                	jne    11b8 <__do_global_dtors_aux+0x38>
+    118d:	|      55                   	push   %rbp
+    118e:	|      48 83 3d 4a 4e 00 00 	cmpq   $0x0,0x4e4a(%rip)        # 5fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1195:	|      00 
+    1196:	|      48 89 e5             	mov    %rsp,%rbp
+    1199:	|  /-- 74 0c                	je     11a7 <__do_global_dtors_aux+0x27>
+    119b:	|  |   48 8b 3d b6 4e 00 00 	mov    0x4eb6(%rip),%rdi        # 6058 <__dso_handle>
+    11a2:	|  |   e8 29 ff ff ff       	call   10d0 <__cxa_finalize@plt>
+    11a7:	|  \-> e8 64 ff ff ff       	call   1110 <deregister_tm_clones>
+    11ac:	|      c6 05 b5 4e 00 00 01 	movb   $0x1,0x4eb5(%rip)        # 6068 <completed.0>
+    11b3:	|      5d                   	pop    %rbp
+    11b4:	|      c3                   	ret
+    11b5:	|      0f 1f 00             	nopl   (%rax)
+    11b8:	\----> c3                   	ret
+    11b9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011c0 <frame_dummy>:
+    11c0:	f3 0f 1e fa          	endbr64
+    11c4:	e9 77 ff ff ff       	jmp    1140 <register_tm_clones>
+
+00000000000011c9 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    11c9:	55                   	push   %rbp
+    11ca:	48 89 e5             	mov    %rsp,%rbp
+    11cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11d1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    11d4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11d9:	5d                   	pop    %rbp
+    11da:	c3                   	ret
+
+00000000000011db <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    11db:	55                   	push   %rbp
+    11dc:	48 89 e5             	mov    %rsp,%rbp
+    11df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11e3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11e6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return -1;
+    11ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11ef:	5d                   	pop    %rbp
+    11f0:	c3                   	ret
+
+00000000000011f1 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    11f1:	55                   	push   %rbp
+    11f2:	48 89 e5             	mov    %rsp,%rbp
+    11f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11f9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11fc:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    return -1;
+    11ff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1204:	5d                   	pop    %rbp
+    1205:	c3                   	ret
+
+0000000000001206 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    1206:	55                   	push   %rbp
+    1207:	48 89 e5             	mov    %rsp,%rbp
+    120a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    120e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1211:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    1214:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    return -1;
+    1217:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    121c:	5d                   	pop    %rbp
+    121d:	c3                   	ret
+
+000000000000121e <_read_r>:
+int _read_r(struct _reent *, int) {
+    121e:	55                   	push   %rbp
+    121f:	48 89 e5             	mov    %rsp,%rbp
+    1222:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1226:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1229:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    122e:	5d                   	pop    %rbp
+    122f:	c3                   	ret
+
+0000000000001230 <_write_r>:
+int _write_r(struct _reent *, int, char *, int) {
+    1230:	55                   	push   %rbp
+    1231:	48 89 e5             	mov    %rsp,%rbp
+    1234:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1238:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    123b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    123f:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+    return -1;
+    1242:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1247:	5d                   	pop    %rbp
+    1248:	c3                   	ret
+
+0000000000001249 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    1249:	55                   	push   %rbp
+    124a:	48 89 e5             	mov    %rsp,%rbp
+    124d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return -1;
+    1251:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1256:	5d                   	pop    %rbp
+    1257:	c3                   	ret
+
+0000000000001258 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1258:	55                   	push   %rbp
+    1259:	48 89 e5             	mov    %rsp,%rbp
+    125c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1260:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1263:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1268:	5d                   	pop    %rbp
+    1269:	c3                   	ret
+
+000000000000126a <operator<<(nel::Log&, nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc> const&)>:
+#include "libnosys_stubs.cx"
+
+typedef nel::heaped::RC<U8Buf<256>> RC1;
+
+nel::Log &operator<<(nel::Log &outs, RC1 const &v)
+{
+    126a:	55                   	push   %rbp
+    126b:	48 89 e5             	mov    %rsp,%rbp
+    126e:	48 83 ec 10          	sub    $0x10,%rsp
+    1272:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1276:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    NEL_UNUSED(v);
+    outs << "RC1()";
+    127a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    127e:	48 8d 15 81 1d 00 00 	lea    0x1d81(%rip),%rdx        # 3006 <nel::None+0x1>
+    1285:	48 89 d6             	mov    %rdx,%rsi
+    1288:	48 89 c7             	mov    %rax,%rdi
+    128b:	e8 b7 15 00 00       	call   2847 <nel::operator<<(nel::Log&, char const*)>
+    return outs;
+    1290:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1294:	c9                   	leave
+    1295:	c3                   	ret
+
+0000000000001296 <rc1()>:
+
+void rc1()
+{
+    1296:	55                   	push   %rbp
+    1297:	48 89 e5             	mov    %rsp,%rbp
+    129a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+    U8Buf<256> v = U8Buf<256>((uint8_t)0x66);
+    12a1:	48 8d 85 00 ff ff ff 	lea    -0x100(%rbp),%rax
+    12a8:	be 66 00 00 00       	mov    $0x66,%esi
+    12ad:	48 89 c7             	mov    %rax,%rdi
+    12b0:	e8 9d 02 00 00       	call   1552 <U8Buf<256ul>::U8Buf(unsigned char)>
+    RC1 rc1(nel::move(v));
+    12b5:	48 8d 85 00 ff ff ff 	lea    -0x100(%rbp),%rax
+    12bc:	48 89 c7             	mov    %rax,%rdi
+    12bf:	e8 b9 02 00 00       	call   157d <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    12c4:	48 89 c2             	mov    %rax,%rdx
+    12c7:	48 8d 85 f8 fe ff ff 	lea    -0x108(%rbp),%rax
+    12ce:	48 89 d6             	mov    %rdx,%rsi
+    12d1:	48 89 c7             	mov    %rax,%rdi
+    12d4:	e8 b3 02 00 00       	call   158c <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::RC(U8Buf<256ul>&&)>
+
+    nel::log << rc1 << '\n';
+    12d9:	48 8d 85 f8 fe ff ff 	lea    -0x108(%rbp),%rax
+    12e0:	48 89 c6             	mov    %rax,%rsi
+    12e3:	48 8d 05 7f 4d 00 00 	lea    0x4d7f(%rip),%rax        # 6069 <nel::log>
+    12ea:	48 89 c7             	mov    %rax,%rdi
+    12ed:	e8 78 ff ff ff       	call   126a <operator<<(nel::Log&, nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc> const&)>
+    12f2:	be 0a 00 00 00       	mov    $0xa,%esi
+    12f7:	48 89 c7             	mov    %rax,%rdi
+    12fa:	e8 1c 15 00 00       	call   281b <nel::operator<<(nel::Log&, char)>
+}
+    12ff:	48 8d 85 f8 fe ff ff 	lea    -0x108(%rbp),%rax
+    1306:	48 89 c7             	mov    %rax,%rdi
+    1309:	e8 ce 04 00 00       	call   17dc <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::~RC()>
+    130e:	48 8d 85 00 ff ff ff 	lea    -0x100(%rbp),%rax
+    1315:	48 89 c7             	mov    %rax,%rdi
+    1318:	e8 97 03 00 00       	call   16b4 <U8Buf<256ul>::~U8Buf()>
+    131d:	c9                   	leave
+    131e:	c3                   	ret
+
+000000000000131f <rc2()>:
+
+void rc2()
+{
+    131f:	55                   	push   %rbp
+    1320:	48 89 e5             	mov    %rsp,%rbp
+    1323:	48 83 ec 10          	sub    $0x10,%rsp
+    RC1 rc1((uint8_t)0x67);
+    1327:	c6 45 ff 67          	movb   $0x67,-0x1(%rbp)
+    132b:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    132f:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1333:	48 89 d6             	mov    %rdx,%rsi
+    1336:	48 89 c7             	mov    %rax,%rdi
+    1339:	e8 7c 02 00 00       	call   15ba <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::RC<unsigned char>(unsigned char&&)>
+
+    nel::log << rc1 << '\n';
+    133e:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1342:	48 89 c6             	mov    %rax,%rsi
+    1345:	48 8d 05 1d 4d 00 00 	lea    0x4d1d(%rip),%rax        # 6069 <nel::log>
+    134c:	48 89 c7             	mov    %rax,%rdi
+    134f:	e8 16 ff ff ff       	call   126a <operator<<(nel::Log&, nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc> const&)>
+    1354:	be 0a 00 00 00       	mov    $0xa,%esi
+    1359:	48 89 c7             	mov    %rax,%rdi
+    135c:	e8 ba 14 00 00       	call   281b <nel::operator<<(nel::Log&, char)>
+}
+    1361:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1365:	48 89 c7             	mov    %rax,%rdi
+    1368:	e8 6f 04 00 00       	call   17dc <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::~RC()>
+    136d:	c9                   	leave
+    136e:	c3                   	ret
+
+000000000000136f <main>:
+
+int main() {}
+    136f:	55                   	push   %rbp
+    1370:	48 89 e5             	mov    %rsp,%rbp
+    1373:	b8 00 00 00 00       	mov    $0x0,%eax
+    1378:	5d                   	pop    %rbp
+    1379:	c3                   	ret
+
+000000000000137a <operator new(unsigned long, void*)>:
+
+    137a:	55                   	push   %rbp
+    137b:	48 89 e5             	mov    %rsp,%rbp
+    137e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1382:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+nel::Log &operator<<(nel::Log &outs, RC1 const &v)
+    1386:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+{
+    138a:	5d                   	pop    %rbp
+    138b:	c3                   	ret
+
+000000000000138c <nel::Context::Context(char const*, char const*, int)>:
+        char const *fn_name_;
+        char const *file_name_;
+        int line_num_;
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+    138c:	55                   	push   %rbp
+    138d:	48 89 e5             	mov    %rsp,%rbp
+    1390:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1394:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1398:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    139c:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    139f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13a3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    13a7:	48 89 10             	mov    %rdx,(%rax)
+            , file_name_(file_name)
+    13aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13ae:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    13b2:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , line_num_(line_num)
+    13b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13ba:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    13bd:	89 50 10             	mov    %edx,0x10(%rax)
+        {
+        }
+    13c0:	90                   	nop
+    13c1:	5d                   	pop    %rbp
+    13c2:	c3                   	ret
+
+00000000000013c3 <nel::panic_if(bool, char const*, nel::Context const&)>:
+[[noreturn]] void panic0(Context const &ctx = Context());
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx = Context());
+
+inline void panic_if(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    13c3:	    55                   	push   %rbp
+    13c4:	    48 89 e5             	mov    %rsp,%rbp
+    13c7:	    48 83 ec 20          	sub    $0x20,%rsp
+    13cb:	    89 f8                	mov    %edi,%eax
+    13cd:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    13d1:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    13d5:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (pred) { panic(msg, ctx); }
+    13d8:	    80 7d fc 00          	cmpb   $0x0,-0x4(%rbp)
+    13dc:	/-- 74 13                	je     13f1 <nel::panic_if(bool, char const*, nel::Context const&)+0x2e>
+    13de:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    13e2:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13e6:	|   48 89 d6             	mov    %rdx,%rsi
+    13e9:	|   48 89 c7             	mov    %rax,%rdi
+    13ec:	|   e8 1e 0b 00 00       	call   1f0f <nel::panic(char const*, nel::Context const&)>
+}
+    13f1:	\-> 90                   	nop
+    13f2:	    c9                   	leave
+    13f3:	    c3                   	ret
+
+00000000000013f4 <nel::heaped::Malloc::try_malloc(unsigned long, unsigned long)>:
+ * and friends (see memory.hh).
+ */
+struct Malloc
+{
+    public:
+        static Result<void *, AllocError> try_malloc(Length const align, Length const size)
+    13f4:	55                   	push   %rbp
+    13f5:	48 89 e5             	mov    %rsp,%rbp
+    13f8:	48 83 ec 20          	sub    $0x20,%rsp
+    13fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1400:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1404:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            return try_realloc(nullptr, align, 0, size);
+    1408:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    140c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1410:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1414:	49 89 c8             	mov    %rcx,%r8
+    1417:	b9 00 00 00 00       	mov    $0x0,%ecx
+    141c:	be 00 00 00 00       	mov    $0x0,%esi
+    1421:	48 89 c7             	mov    %rax,%rdi
+    1424:	e8 06 00 00 00       	call   142f <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>
+        }
+    1429:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    142d:	c9                   	leave
+    142e:	c3                   	ret
+
+000000000000142f <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>:
+
+        static Result<void *, AllocError> try_realloc(void *const p,
+    142f:	          55                   	push   %rbp
+    1430:	          48 89 e5             	mov    %rsp,%rbp
+    1433:	          48 83 ec 40          	sub    $0x40,%rsp
+    1437:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    143b:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    143f:	          48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    1443:	          48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    1447:	          4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+                                                      Length const align,
+                                                      Length const old_size,
+                                                      Length const new_size)
+        {
+            if (align == 0 || (align & (align - 1)) != 0) {
+    144b:	          48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    1450:	      /-- 74 11                	je     1463 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x34>
+    1452:	      |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1456:	      |   48 83 e8 01          	sub    $0x1,%rax
+    145a:	      |   48 23 45 d8          	and    -0x28(%rbp),%rax
+    145e:	      |   48 85 c0             	test   %rax,%rax
+    1461:	   /--|-- 74 1c                	je     147f <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x50>
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+    1463:	   |  \-> c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+    146a:	   |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    146e:	   |      48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    1472:	   |      48 89 d6             	mov    %rdx,%rsi
+    1475:	   |      48 89 c7             	mov    %rax,%rdi
+    1478:	   |      e8 cf 01 00 00       	call   164c <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+                                    : std::realloc(p, new_size);
+            if (new_p == nullptr) {
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+            }
+            return Result<void *, AllocError>::Ok(new_p);
+        }
+    147d:	/--|----- eb 79                	jmp    14f8 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            void *const new_p = is_over_aligned(align)
+    147f:	|  \----> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1483:	|         48 89 c7             	mov    %rax,%rdi
+    1486:	|         e8 b4 00 00 00       	call   153f <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+                                    ? realloc_aligned(p, align, old_size, new_size)
+    148b:	|         84 c0                	test   %al,%al
+    148d:	|  /----- 74 1a                	je     14a9 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x7a>
+    148f:	|  |      48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+    1493:	|  |      48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1497:	|  |      48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+    149b:	|  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    149f:	|  |      48 89 c7             	mov    %rax,%rdi
+    14a2:	|  |      e8 6f 11 00 00       	call   2616 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+    14a7:	|  |  /-- eb 13                	jmp    14bc <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x8d>
+                                    : std::realloc(p, new_size);
+    14a9:	|  \--|-> 48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    14ad:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    14b1:	|     |   48 89 d6             	mov    %rdx,%rsi
+    14b4:	|     |   48 89 c7             	mov    %rax,%rdi
+    14b7:	|     |   e8 f4 fb ff ff       	call   10b0 <realloc@plt>
+    14bc:	|     \-> 48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            if (new_p == nullptr) {
+    14c0:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14c4:	|         48 85 c0             	test   %rax,%rax
+    14c7:	|     /-- 75 1c                	jne    14e5 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xb6>
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+    14c9:	|     |   c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    14d0:	|     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14d4:	|     |   48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    14d8:	|     |   48 89 d6             	mov    %rdx,%rsi
+    14db:	|     |   48 89 c7             	mov    %rax,%rdi
+    14de:	|     |   e8 69 01 00 00       	call   164c <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+        }
+    14e3:	+-----|-- eb 13                	jmp    14f8 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            return Result<void *, AllocError>::Ok(new_p);
+    14e5:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14e9:	|         48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    14ed:	|         48 89 d6             	mov    %rdx,%rsi
+    14f0:	|         48 89 c7             	mov    %rax,%rdi
+    14f3:	|         e8 88 01 00 00       	call   1680 <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>
+        }
+    14f8:	\-------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14fc:	          c9                   	leave
+    14fd:	          c3                   	ret
+
+00000000000014fe <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>:
+
+        static void free(void *const p, Length const align, Length const size)
+    14fe:	       55                   	push   %rbp
+    14ff:	       48 89 e5             	mov    %rsp,%rbp
+    1502:	       48 83 ec 20          	sub    $0x20,%rsp
+    1506:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    150a:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    150e:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+    1512:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1516:	       48 89 c7             	mov    %rax,%rdi
+    1519:	       e8 21 00 00 00       	call   153f <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+    151e:	       84 c0                	test   %al,%al
+    1520:	/----- 74 0e                	je     1530 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x32>
+                free_aligned(p);
+    1522:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1526:	|      48 89 c7             	mov    %rax,%rdi
+    1529:	|      e8 a4 10 00 00       	call   25d2 <nel::free_aligned(void*)>
+            } else {
+                std::free(p);
+            }
+        }
+    152e:	|  /-- eb 0c                	jmp    153c <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x3e>
+                std::free(p);
+    1530:	\--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1534:	   |   48 89 c7             	mov    %rax,%rdi
+    1537:	   |   e8 f4 fa ff ff       	call   1030 <free@plt>
+        }
+    153c:	   \-> 90                   	nop
+    153d:	       c9                   	leave
+    153e:	       c3                   	ret
+
+000000000000153f <nel::heaped::Malloc::is_over_aligned(unsigned long)>:
+
+    private:
+        static constexpr bool is_over_aligned(Length const align)
+    153f:	55                   	push   %rbp
+    1540:	48 89 e5             	mov    %rsp,%rbp
+    1543:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return align > alignof(std::max_align_t);
+    1547:	48 83 7d f8 10       	cmpq   $0x10,-0x8(%rbp)
+    154c:	0f 97 c0             	seta   %al
+        }
+    154f:	5d                   	pop    %rbp
+    1550:	c3                   	ret
+    1551:	90                   	nop
+
+0000000000001552 <U8Buf<256ul>::U8Buf(unsigned char)>:
+            nel::elem::move(data_, o.data_, N);
+            return *this;
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+    1552:	55                   	push   %rbp
+    1553:	48 89 e5             	mov    %rsp,%rbp
+    1556:	48 83 ec 10          	sub    $0x10,%rsp
+    155a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    155e:	89 f0                	mov    %esi,%eax
+    1560:	88 45 f4             	mov    %al,-0xc(%rbp)
+        {
+            nel::elem::set(data_, f, N);
+    1563:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    1567:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    156b:	ba 00 01 00 00       	mov    $0x100,%edx
+    1570:	89 ce                	mov    %ecx,%esi
+    1572:	48 89 c7             	mov    %rax,%rdi
+    1575:	e8 79 0a 00 00       	call   1ff3 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    157a:	90                   	nop
+    157b:	c9                   	leave
+    157c:	c3                   	ret
+
+000000000000157d <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel is to not need std.
+ */
+template<typename T>
+constexpr T &&move(T &v)
+    157d:	55                   	push   %rbp
+    157e:	48 89 e5             	mov    %rsp,%rbp
+    1581:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<T &&>(v);
+    1585:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1589:	5d                   	pop    %rbp
+    158a:	c3                   	ret
+    158b:	90                   	nop
+
+000000000000158c <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::RC(U8Buf<256ul>&&)>:
+            }
+            return *this;
+        }
+
+    public:
+        constexpr RC(Type &&v)
+    158c:	55                   	push   %rbp
+    158d:	48 89 e5             	mov    %rsp,%rbp
+    1590:	48 83 ec 10          	sub    $0x10,%rsp
+    1594:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1598:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : node_(Node::create(move(v)))
+    159c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15a0:	48 89 c7             	mov    %rax,%rdi
+    15a3:	e8 d5 ff ff ff       	call   157d <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    15a8:	48 89 c7             	mov    %rax,%rdi
+    15ab:	e8 29 01 00 00       	call   16d9 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node* nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::create<U8Buf<256ul> >(U8Buf<256ul>&&)>
+    15b0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    15b4:	48 89 02             	mov    %rax,(%rdx)
+        {
+            // Node created pre-grabbed.
+        }
+    15b7:	90                   	nop
+    15b8:	c9                   	leave
+    15b9:	c3                   	ret
+
+00000000000015ba <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::RC<unsigned char>(unsigned char&&)>:
+
+        template<typename... Args>
+        constexpr RC(Args &&...args)
+    15ba:	55                   	push   %rbp
+    15bb:	48 89 e5             	mov    %rsp,%rbp
+    15be:	48 83 ec 10          	sub    $0x10,%rsp
+    15c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    15c6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : node_(Node::create(forward<Args>(args)...))
+    15ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15ce:	48 89 c7             	mov    %rax,%rdi
+    15d1:	e8 24 02 00 00       	call   17fa <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    15d6:	48 89 c7             	mov    %rax,%rdi
+    15d9:	e8 2a 02 00 00       	call   1808 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node* nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::create<unsigned char>(unsigned char&&)>
+    15de:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    15e2:	48 89 02             	mov    %rax,(%rdx)
+        {
+            // Node created pre-grabbed.
+        }
+    15e5:	90                   	nop
+    15e6:	c9                   	leave
+    15e7:	c3                   	ret
+
+00000000000015e8 <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+                Element<T> ok_;
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    15e8:	             55                   	push   %rbp
+    15e9:	             48 89 e5             	mov    %rsp,%rbp
+    15ec:	             48 83 ec 30          	sub    $0x30,%rsp
+    15f0:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result::dtor
+    15f4:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    15f8:	             8b 00                	mov    (%rax),%eax
+    15fa:	             83 f8 02             	cmp    $0x2,%eax
+    15fd:	/----------- 74 43                	je     1642 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5a>
+    15ff:	|            83 f8 02             	cmp    $0x2,%eax
+    1602:	|        /-- 7f 09                	jg     160d <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x25>
+    1604:	|        |   85 c0                	test   %eax,%eax
+    1606:	|  /-----|-- 74 3d                	je     1645 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5d>
+    1608:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    160b:	|  |  /--|-- 74 3b                	je     1648 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x60>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    160d:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1611:	|  |  |      b9 72 00 00 00       	mov    $0x72,%ecx
+    1616:	|  |  |      48 8d 15 ef 19 00 00 	lea    0x19ef(%rip),%rdx        # 300c <nel::None+0x7>
+    161d:	|  |  |      48 8d 35 fa 19 00 00 	lea    0x19fa(%rip),%rsi        # 301e <nel::None+0x19>
+    1624:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1627:	|  |  |      e8 60 fd ff ff       	call   138c <nel::Context::Context(char const*, char const*, int)>
+    162c:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1630:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    1633:	|  |  |      48 8d 05 ec 19 00 00 	lea    0x19ec(%rip),%rax        # 3026 <nel::None+0x21>
+    163a:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    163d:	|  |  |      e8 cd 08 00 00       	call   1f0f <nel::panic(char const*, nel::Context const&)>
+                    break;
+    1642:	\--|--|----> 90                   	nop
+    1643:	   |  |  /-- eb 04                	jmp    1649 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    1645:	   \--|--|-> 90                   	nop
+    1646:	      |  +-- eb 01                	jmp    1649 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    1648:	      \--|-> 90                   	nop
+                    break;
+            }
+        }
+    1649:	         \-> 90                   	nop
+    164a:	             c9                   	leave
+    164b:	             c3                   	ret
+
+000000000000164c <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>:
+         *
+         * @param val The value to move into the result as an err value.
+         *
+         * @returns a Result 'wrapping' the value given as an err value.
+         */
+        constexpr static Result Err(E &&val)
+    164c:	55                   	push   %rbp
+    164d:	48 89 e5             	mov    %rsp,%rbp
+    1650:	48 83 ec 10          	sub    $0x10,%rsp
+    1654:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1658:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            return Result(Phantom<Tag::ERR>(), forward<E>(val));
+    165c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1660:	48 89 c7             	mov    %rax,%rdi
+    1663:	e8 a3 02 00 00       	call   190b <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    1668:	48 89 c2             	mov    %rax,%rdx
+    166b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    166f:	48 89 d6             	mov    %rdx,%rsi
+    1672:	48 89 c7             	mov    %rax,%rdi
+    1675:	e8 a0 02 00 00       	call   191a <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>
+        }
+    167a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    167e:	c9                   	leave
+    167f:	c3                   	ret
+
+0000000000001680 <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>:
+        constexpr static Result Ok(Args &&...args)
+    1680:	55                   	push   %rbp
+    1681:	48 89 e5             	mov    %rsp,%rbp
+    1684:	48 83 ec 10          	sub    $0x10,%rsp
+    1688:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    168c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<Args>(args)...);
+    1690:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1694:	48 89 c7             	mov    %rax,%rdi
+    1697:	e8 bf 02 00 00       	call   195b <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    169c:	48 89 c2             	mov    %rax,%rdx
+    169f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16a3:	48 89 d6             	mov    %rdx,%rsi
+    16a6:	48 89 c7             	mov    %rax,%rdi
+    16a9:	e8 bc 02 00 00       	call   196a <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>
+        }
+    16ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16b2:	c9                   	leave
+    16b3:	c3                   	ret
+
+00000000000016b4 <U8Buf<256ul>::~U8Buf()>:
+        constexpr ~U8Buf(void)
+    16b4:	55                   	push   %rbp
+    16b5:	48 89 e5             	mov    %rsp,%rbp
+    16b8:	48 83 ec 10          	sub    $0x10,%rsp
+    16bc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            nel::elem::set(data_, 0xa5, N);
+    16c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16c4:	ba 00 01 00 00       	mov    $0x100,%edx
+    16c9:	be a5 00 00 00       	mov    $0xa5,%esi
+    16ce:	48 89 c7             	mov    %rax,%rdi
+    16d1:	e8 1d 09 00 00       	call   1ff3 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    16d6:	90                   	nop
+    16d7:	c9                   	leave
+    16d8:	c3                   	ret
+
+00000000000016d9 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node* nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::create<U8Buf<256ul> >(U8Buf<256ul>&&)>:
+                static Node *create(Args &&...args)
+    16d9:	55                   	push   %rbp
+    16da:	48 89 e5             	mov    %rsp,%rbp
+    16dd:	53                   	push   %rbx
+    16de:	48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+    16e5:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+                    auto r = Allocator::try_malloc(alignof(Node), sizeof(Node));
+    16ec:	48 8d 45 80          	lea    -0x80(%rbp),%rax
+    16f0:	ba 10 01 00 00       	mov    $0x110,%edx
+    16f5:	be 08 00 00 00       	mov    $0x8,%esi
+    16fa:	48 89 c7             	mov    %rax,%rdi
+    16fd:	e8 f2 fc ff ff       	call   13f4 <nel::heaped::Malloc::try_malloc(unsigned long, unsigned long)>
+                    nel::panic_if(r.is_err(), "heaped::RC: out of memory");
+    1702:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+    1706:	b9 4c 00 00 00       	mov    $0x4c,%ecx
+    170b:	48 8d 15 1f 19 00 00 	lea    0x191f(%rip),%rdx        # 3031 <nel::None+0x2c>
+    1712:	48 8d 35 2d 19 00 00 	lea    0x192d(%rip),%rsi        # 3046 <nel::None+0x41>
+    1719:	48 89 c7             	mov    %rax,%rdi
+    171c:	e8 6b fc ff ff       	call   138c <nel::Context::Context(char const*, char const*, int)>
+    1721:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    1725:	b9 4c 00 00 00       	mov    $0x4c,%ecx
+    172a:	48 8d 15 00 19 00 00 	lea    0x1900(%rip),%rdx        # 3031 <nel::None+0x2c>
+    1731:	48 8d 35 0e 19 00 00 	lea    0x190e(%rip),%rsi        # 3046 <nel::None+0x41>
+    1738:	48 89 c7             	mov    %rax,%rdi
+    173b:	e8 4c fc ff ff       	call   138c <nel::Context::Context(char const*, char const*, int)>
+    1740:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    1744:	48 8d 45 80          	lea    -0x80(%rbp),%rax
+    1748:	48 89 d6             	mov    %rdx,%rsi
+    174b:	48 89 c7             	mov    %rax,%rdi
+    174e:	e8 81 02 00 00       	call   19d4 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>
+    1753:	0f b6 c0             	movzbl %al,%eax
+    1756:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+    175a:	48 8d 0d f9 18 00 00 	lea    0x18f9(%rip),%rcx        # 305a <nel::None+0x55>
+    1761:	48 89 ce             	mov    %rcx,%rsi
+    1764:	89 c7                	mov    %eax,%edi
+    1766:	e8 58 fc ff ff       	call   13c3 <nel::panic_if(bool, char const*, nel::Context const&)>
+                    return new (r.unwrap()) Node(forward<Args>(args)...);
+    176b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    176f:	b9 4d 00 00 00       	mov    $0x4d,%ecx
+    1774:	48 8d 15 b6 18 00 00 	lea    0x18b6(%rip),%rdx        # 3031 <nel::None+0x2c>
+    177b:	48 8d 35 c4 18 00 00 	lea    0x18c4(%rip),%rsi        # 3046 <nel::None+0x41>
+    1782:	48 89 c7             	mov    %rax,%rdi
+    1785:	e8 02 fc ff ff       	call   138c <nel::Context::Context(char const*, char const*, int)>
+    178a:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    178e:	48 8d 45 80          	lea    -0x80(%rbp),%rax
+    1792:	48 89 d6             	mov    %rdx,%rsi
+    1795:	48 89 c7             	mov    %rax,%rdi
+    1798:	e8 ad 02 00 00       	call   1a4a <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+    179d:	48 89 c6             	mov    %rax,%rsi
+    17a0:	bf 10 01 00 00       	mov    $0x110,%edi
+    17a5:	e8 d0 fb ff ff       	call   137a <operator new(unsigned long, void*)>
+    17aa:	48 89 c3             	mov    %rax,%rbx
+    17ad:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+    17b4:	48 89 c7             	mov    %rax,%rdi
+    17b7:	e8 c0 02 00 00       	call   1a7c <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    17bc:	48 89 c6             	mov    %rax,%rsi
+    17bf:	48 89 df             	mov    %rbx,%rdi
+    17c2:	e8 df 02 00 00       	call   1aa6 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::Node<U8Buf<256ul> >(U8Buf<256ul>&&)>
+                }
+    17c7:	48 8d 45 80          	lea    -0x80(%rbp),%rax
+    17cb:	48 89 c7             	mov    %rax,%rdi
+    17ce:	e8 15 fe ff ff       	call   15e8 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+                    return new (r.unwrap()) Node(forward<Args>(args)...);
+    17d3:	48 89 d8             	mov    %rbx,%rax
+                }
+    17d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    17da:	c9                   	leave
+    17db:	c3                   	ret
+
+00000000000017dc <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::~RC()>:
+        constexpr ~RC(void)
+    17dc:	55                   	push   %rbp
+    17dd:	48 89 e5             	mov    %rsp,%rbp
+    17e0:	48 83 ec 10          	sub    $0x10,%rsp
+    17e4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            Node::release(node_);
+    17e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17ec:	48 8b 00             	mov    (%rax),%rax
+    17ef:	48 89 c7             	mov    %rax,%rdi
+    17f2:	e8 18 03 00 00       	call   1b0f <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::release(nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node*)>
+        }
+    17f7:	90                   	nop
+    17f8:	c9                   	leave
+    17f9:	c3                   	ret
+
+00000000000017fa <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel so to not need std.
+ */
+template<typename U, typename T>
+constexpr U &&forward(T &t)
+    17fa:	55                   	push   %rbp
+    17fb:	48 89 e5             	mov    %rsp,%rbp
+    17fe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<U &&>(t);
+    1802:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1806:	5d                   	pop    %rbp
+    1807:	c3                   	ret
+
+0000000000001808 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node* nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::create<unsigned char>(unsigned char&&)>:
+                static Node *create(Args &&...args)
+    1808:	55                   	push   %rbp
+    1809:	48 89 e5             	mov    %rsp,%rbp
+    180c:	53                   	push   %rbx
+    180d:	48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+    1814:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+                    auto r = Allocator::try_malloc(alignof(Node), sizeof(Node));
+    181b:	48 8d 45 80          	lea    -0x80(%rbp),%rax
+    181f:	ba 10 01 00 00       	mov    $0x110,%edx
+    1824:	be 08 00 00 00       	mov    $0x8,%esi
+    1829:	48 89 c7             	mov    %rax,%rdi
+    182c:	e8 c3 fb ff ff       	call   13f4 <nel::heaped::Malloc::try_malloc(unsigned long, unsigned long)>
+                    nel::panic_if(r.is_err(), "heaped::RC: out of memory");
+    1831:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+    1835:	b9 4c 00 00 00       	mov    $0x4c,%ecx
+    183a:	48 8d 15 f0 17 00 00 	lea    0x17f0(%rip),%rdx        # 3031 <nel::None+0x2c>
+    1841:	48 8d 35 2c 18 00 00 	lea    0x182c(%rip),%rsi        # 3074 <nel::None+0x6f>
+    1848:	48 89 c7             	mov    %rax,%rdi
+    184b:	e8 3c fb ff ff       	call   138c <nel::Context::Context(char const*, char const*, int)>
+    1850:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    1854:	b9 4c 00 00 00       	mov    $0x4c,%ecx
+    1859:	48 8d 15 d1 17 00 00 	lea    0x17d1(%rip),%rdx        # 3031 <nel::None+0x2c>
+    1860:	48 8d 35 0d 18 00 00 	lea    0x180d(%rip),%rsi        # 3074 <nel::None+0x6f>
+    1867:	48 89 c7             	mov    %rax,%rdi
+    186a:	e8 1d fb ff ff       	call   138c <nel::Context::Context(char const*, char const*, int)>
+    186f:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    1873:	48 8d 45 80          	lea    -0x80(%rbp),%rax
+    1877:	48 89 d6             	mov    %rdx,%rsi
+    187a:	48 89 c7             	mov    %rax,%rdi
+    187d:	e8 52 01 00 00       	call   19d4 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>
+    1882:	0f b6 c0             	movzbl %al,%eax
+    1885:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+    1889:	48 8d 0d ca 17 00 00 	lea    0x17ca(%rip),%rcx        # 305a <nel::None+0x55>
+    1890:	48 89 ce             	mov    %rcx,%rsi
+    1893:	89 c7                	mov    %eax,%edi
+    1895:	e8 29 fb ff ff       	call   13c3 <nel::panic_if(bool, char const*, nel::Context const&)>
+                    return new (r.unwrap()) Node(forward<Args>(args)...);
+    189a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    189e:	b9 4d 00 00 00       	mov    $0x4d,%ecx
+    18a3:	48 8d 15 87 17 00 00 	lea    0x1787(%rip),%rdx        # 3031 <nel::None+0x2c>
+    18aa:	48 8d 35 c3 17 00 00 	lea    0x17c3(%rip),%rsi        # 3074 <nel::None+0x6f>
+    18b1:	48 89 c7             	mov    %rax,%rdi
+    18b4:	e8 d3 fa ff ff       	call   138c <nel::Context::Context(char const*, char const*, int)>
+    18b9:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    18bd:	48 8d 45 80          	lea    -0x80(%rbp),%rax
+    18c1:	48 89 d6             	mov    %rdx,%rsi
+    18c4:	48 89 c7             	mov    %rax,%rdi
+    18c7:	e8 7e 01 00 00       	call   1a4a <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+    18cc:	48 89 c6             	mov    %rax,%rsi
+    18cf:	bf 10 01 00 00       	mov    $0x110,%edi
+    18d4:	e8 a1 fa ff ff       	call   137a <operator new(unsigned long, void*)>
+    18d9:	48 89 c3             	mov    %rax,%rbx
+    18dc:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+    18e3:	48 89 c7             	mov    %rax,%rdi
+    18e6:	e8 0f ff ff ff       	call   17fa <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    18eb:	48 89 c6             	mov    %rax,%rsi
+    18ee:	48 89 df             	mov    %rbx,%rdi
+    18f1:	e8 70 02 00 00       	call   1b66 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::Node<unsigned char>(unsigned char&&)>
+                }
+    18f6:	48 8d 45 80          	lea    -0x80(%rbp),%rax
+    18fa:	48 89 c7             	mov    %rax,%rdi
+    18fd:	e8 e6 fc ff ff       	call   15e8 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+                    return new (r.unwrap()) Node(forward<Args>(args)...);
+    1902:	48 89 d8             	mov    %rbx,%rax
+                }
+    1905:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1909:	c9                   	leave
+    190a:	c3                   	ret
+
+000000000000190b <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>:
+constexpr U &&forward(T &t)
+    190b:	55                   	push   %rbp
+    190c:	48 89 e5             	mov    %rsp,%rbp
+    190f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    1913:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1917:	5d                   	pop    %rbp
+    1918:	c3                   	ret
+    1919:	90                   	nop
+
+000000000000191a <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    191a:	55                   	push   %rbp
+    191b:	48 89 e5             	mov    %rsp,%rbp
+    191e:	53                   	push   %rbx
+    191f:	48 83 ec 18          	sub    $0x18,%rsp
+    1923:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1927:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    192b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    192f:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    1935:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1939:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    193d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1941:	48 89 c7             	mov    %rax,%rdi
+    1944:	e8 c2 ff ff ff       	call   190b <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    1949:	48 89 c6             	mov    %rax,%rsi
+    194c:	48 89 df             	mov    %rbx,%rdi
+    194f:	e8 5c 02 00 00       	call   1bb0 <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>
+        }
+    1954:	90                   	nop
+    1955:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1959:	c9                   	leave
+    195a:	c3                   	ret
+
+000000000000195b <void* const& nel::forward<void* const&, void* const>(void* const&)>:
+constexpr U &&forward(T &t)
+    195b:	55                   	push   %rbp
+    195c:	48 89 e5             	mov    %rsp,%rbp
+    195f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    1963:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1967:	5d                   	pop    %rbp
+    1968:	c3                   	ret
+    1969:	90                   	nop
+
+000000000000196a <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>:
+        constexpr Result(Phantom<Tag::OK> const, Args &&...args)
+    196a:	55                   	push   %rbp
+    196b:	48 89 e5             	mov    %rsp,%rbp
+    196e:	53                   	push   %rbx
+    196f:	48 83 ec 18          	sub    $0x18,%rsp
+    1973:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1977:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    197b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    197f:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<Args>(args)...)
+    1985:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1989:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    198d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1991:	48 89 c7             	mov    %rax,%rdi
+    1994:	e8 c2 ff ff ff       	call   195b <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    1999:	48 89 c6             	mov    %rax,%rsi
+    199c:	48 89 df             	mov    %rbx,%rdi
+    199f:	e8 34 02 00 00       	call   1bd8 <nel::Element<void*>::Element<void* const&>(void* const&)>
+        }
+    19a4:	90                   	nop
+    19a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    19a9:	c9                   	leave
+    19aa:	c3                   	ret
+    19ab:	90                   	nop
+
+00000000000019ac <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>:
+         *
+         * `this` is not consumed by this op.
+         */
+        constexpr bool is_err(Context const &ctx = Context()) const
+        {
+            return match<bool>([](T const &) -> bool { return false; },
+    19ac:	55                   	push   %rbp
+    19ad:	48 89 e5             	mov    %rsp,%rbp
+    19b0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    19b4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    19b8:	b8 00 00 00 00       	mov    $0x0,%eax
+    19bd:	5d                   	pop    %rbp
+    19be:	c3                   	ret
+    19bf:	90                   	nop
+
+00000000000019c0 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>:
+                               [](E const &) -> bool { return true; },
+    19c0:	55                   	push   %rbp
+    19c1:	48 89 e5             	mov    %rsp,%rbp
+    19c4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    19c8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    19cc:	b8 01 00 00 00       	mov    $0x1,%eax
+    19d1:	5d                   	pop    %rbp
+    19d2:	c3                   	ret
+    19d3:	90                   	nop
+
+00000000000019d4 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>:
+        constexpr bool is_err(Context const &ctx = Context()) const
+    19d4:	55                   	push   %rbp
+    19d5:	48 89 e5             	mov    %rsp,%rbp
+    19d8:	48 83 ec 20          	sub    $0x20,%rsp
+    19dc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    19e0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](T const &) -> bool { return false; },
+    19e4:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    19e8:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    19ec:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    19f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19f4:	48 89 c7             	mov    %rax,%rdi
+    19f7:	e8 06 02 00 00       	call   1c02 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>
+                               ctx);
+        }
+    19fc:	c9                   	leave
+    19fd:	c3                   	ret
+
+00000000000019fe <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>:
+         *
+         * `this` is consumed by the operation.
+         */
+        constexpr T unwrap(Context const &ctx = Context())
+        {
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    19fe:	55                   	push   %rbp
+    19ff:	48 89 e5             	mov    %rsp,%rbp
+    1a02:	48 83 ec 10          	sub    $0x10,%rsp
+    1a06:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a0a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1a0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a12:	48 89 c7             	mov    %rax,%rdi
+    1a15:	e8 8f 02 00 00       	call   1ca9 <void*&& nel::forward<void*, void*>(void*&)>
+    1a1a:	48 8b 00             	mov    (%rax),%rax
+    1a1d:	c9                   	leave
+    1a1e:	c3                   	ret
+    1a1f:	90                   	nop
+
+0000000000001a20 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>:
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    1a20:	55                   	push   %rbp
+    1a21:	48 89 e5             	mov    %rsp,%rbp
+    1a24:	48 83 ec 10          	sub    $0x10,%rsp
+    1a28:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a2c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1a30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a34:	48 8b 00             	mov    (%rax),%rax
+    1a37:	48 89 c6             	mov    %rax,%rsi
+    1a3a:	48 8d 05 49 16 00 00 	lea    0x1649(%rip),%rax        # 308a <nel::None+0x85>
+    1a41:	48 89 c7             	mov    %rax,%rdi
+    1a44:	e8 c6 04 00 00       	call   1f0f <nel::panic(char const*, nel::Context const&)>
+    1a49:	90                   	nop
+
+0000000000001a4a <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>:
+        constexpr T unwrap(Context const &ctx = Context())
+    1a4a:	55                   	push   %rbp
+    1a4b:	48 89 e5             	mov    %rsp,%rbp
+    1a4e:	48 83 ec 20          	sub    $0x20,%rsp
+    1a52:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1a56:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    1a5a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a5e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    1a62:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1a66:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    1a6a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    1a6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a72:	48 89 c7             	mov    %rax,%rdi
+    1a75:	e8 3e 02 00 00       	call   1cb8 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>
+                              ctx);
+        }
+    1a7a:	c9                   	leave
+    1a7b:	c3                   	ret
+
+0000000000001a7c <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>:
+constexpr U &&forward(T &t)
+    1a7c:	55                   	push   %rbp
+    1a7d:	48 89 e5             	mov    %rsp,%rbp
+    1a80:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    1a84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1a88:	5d                   	pop    %rbp
+    1a89:	c3                   	ret
+
+0000000000001a8a <nel::Element<U8Buf<256ul> >::~Element()>:
+
+    private:
+        Type value_;
+
+    public:
+        constexpr ~Element(void) = default;
+    1a8a:	55                   	push   %rbp
+    1a8b:	48 89 e5             	mov    %rsp,%rbp
+    1a8e:	48 83 ec 10          	sub    $0x10,%rsp
+    1a92:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a9a:	48 89 c7             	mov    %rax,%rdi
+    1a9d:	e8 12 fc ff ff       	call   16b4 <U8Buf<256ul>::~U8Buf()>
+    1aa2:	90                   	nop
+    1aa3:	c9                   	leave
+    1aa4:	c3                   	ret
+    1aa5:	90                   	nop
+
+0000000000001aa6 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::Node<U8Buf<256ul> >(U8Buf<256ul>&&)>:
+                constexpr Node(Args &&...args)
+    1aa6:	55                   	push   %rbp
+    1aa7:	48 89 e5             	mov    %rsp,%rbp
+    1aaa:	53                   	push   %rbx
+    1aab:	48 83 ec 18          	sub    $0x18,%rsp
+    1aaf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1ab3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+                    : n_refs_(1)
+    1ab7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1abb:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+                    , has_value_(true)
+    1ac2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ac6:	c6 40 08 01          	movb   $0x1,0x8(%rax)
+                    , value_(forward<Args>(args)...)
+    1aca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ace:	48 8d 58 09          	lea    0x9(%rax),%rbx
+    1ad2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ad6:	48 89 c7             	mov    %rax,%rdi
+    1ad9:	e8 9e ff ff ff       	call   1a7c <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    1ade:	48 89 c6             	mov    %rax,%rsi
+    1ae1:	48 89 df             	mov    %rbx,%rdi
+    1ae4:	e8 99 02 00 00       	call   1d82 <nel::Element<U8Buf<256ul> >::Element(U8Buf<256ul>&&)>
+                }
+    1ae9:	90                   	nop
+    1aea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1aee:	c9                   	leave
+    1aef:	c3                   	ret
+
+0000000000001af0 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::~Node()>:
+        struct Node
+    1af0:	55                   	push   %rbp
+    1af1:	48 89 e5             	mov    %rsp,%rbp
+    1af4:	48 83 ec 10          	sub    $0x10,%rsp
+    1af8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1afc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b00:	48 83 c0 09          	add    $0x9,%rax
+    1b04:	48 89 c7             	mov    %rax,%rdi
+    1b07:	e8 7e ff ff ff       	call   1a8a <nel::Element<U8Buf<256ul> >::~Element()>
+    1b0c:	90                   	nop
+    1b0d:	c9                   	leave
+    1b0e:	c3                   	ret
+
+0000000000001b0f <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::release(nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node*)>:
+                constexpr static void release(Node *const v)
+    1b0f:	    55                   	push   %rbp
+    1b10:	    48 89 e5             	mov    %rsp,%rbp
+    1b13:	    48 83 ec 10          	sub    $0x10,%rsp
+    1b17:	    48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+                    if (v != nullptr) {
+    1b1b:	    48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1b20:	/-- 74 40                	je     1b62 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::release(nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node*)+0x53>
+                        v->n_refs_ -= 1;
+    1b22:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b26:	|   48 8b 00             	mov    (%rax),%rax
+    1b29:	|   48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    1b2d:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b31:	|   48 89 10             	mov    %rdx,(%rax)
+                        if (v->n_refs_ == 0) {
+    1b34:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b38:	|   48 8b 00             	mov    (%rax),%rax
+    1b3b:	|   48 85 c0             	test   %rax,%rax
+    1b3e:	+-- 75 22                	jne    1b62 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::release(nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node*)+0x53>
+                            v->~Node();
+    1b40:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b44:	|   48 89 c7             	mov    %rax,%rdi
+    1b47:	|   e8 a4 ff ff ff       	call   1af0 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::~Node()>
+                            Allocator::free(v, alignof(Node), sizeof(Node));
+    1b4c:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b50:	|   ba 10 01 00 00       	mov    $0x110,%edx
+    1b55:	|   be 08 00 00 00       	mov    $0x8,%esi
+    1b5a:	|   48 89 c7             	mov    %rax,%rdi
+    1b5d:	|   e8 9c f9 ff ff       	call   14fe <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>
+                }
+    1b62:	\-> 90                   	nop
+    1b63:	    c9                   	leave
+    1b64:	    c3                   	ret
+    1b65:	    90                   	nop
+
+0000000000001b66 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::Node<unsigned char>(unsigned char&&)>:
+                constexpr Node(Args &&...args)
+    1b66:	55                   	push   %rbp
+    1b67:	48 89 e5             	mov    %rsp,%rbp
+    1b6a:	53                   	push   %rbx
+    1b6b:	48 83 ec 18          	sub    $0x18,%rsp
+    1b6f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1b73:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+                    : n_refs_(1)
+    1b77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b7b:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+                    , has_value_(true)
+    1b82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b86:	c6 40 08 01          	movb   $0x1,0x8(%rax)
+                    , value_(forward<Args>(args)...)
+    1b8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b8e:	48 8d 58 09          	lea    0x9(%rax),%rbx
+    1b92:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1b96:	48 89 c7             	mov    %rax,%rdi
+    1b99:	e8 5c fc ff ff       	call   17fa <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    1b9e:	48 89 c6             	mov    %rax,%rsi
+    1ba1:	48 89 df             	mov    %rbx,%rdi
+    1ba4:	e8 0d 02 00 00       	call   1db6 <nel::Element<U8Buf<256ul> >::Element<unsigned char>(unsigned char&&)>
+                }
+    1ba9:	90                   	nop
+    1baa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1bae:	c9                   	leave
+    1baf:	c3                   	ret
+
+0000000000001bb0 <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>:
+        constexpr Element &operator=(Element const &) const = delete;
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+    1bb0:	55                   	push   %rbp
+    1bb1:	48 89 e5             	mov    %rsp,%rbp
+    1bb4:	48 83 ec 10          	sub    $0x10,%rsp
+    1bb8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1bbc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    1bc0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bc4:	48 89 c7             	mov    %rax,%rdi
+    1bc7:	e8 3f fd ff ff       	call   190b <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    1bcc:	8b 10                	mov    (%rax),%edx
+    1bce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bd2:	89 10                	mov    %edx,(%rax)
+        {
+        }
+    1bd4:	90                   	nop
+    1bd5:	c9                   	leave
+    1bd6:	c3                   	ret
+    1bd7:	90                   	nop
+
+0000000000001bd8 <nel::Element<void*>::Element<void* const&>(void* const&)>:
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+    1bd8:	55                   	push   %rbp
+    1bd9:	48 89 e5             	mov    %rsp,%rbp
+    1bdc:	48 83 ec 10          	sub    $0x10,%rsp
+    1be0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1be4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Args>(args)...)
+    1be8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bec:	48 89 c7             	mov    %rax,%rdi
+    1bef:	e8 67 fd ff ff       	call   195b <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    1bf4:	48 8b 10             	mov    (%rax),%rdx
+    1bf7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bfb:	48 89 10             	mov    %rdx,(%rax)
+        {
+        }
+    1bfe:	90                   	nop
+    1bff:	c9                   	leave
+    1c00:	c3                   	ret
+    1c01:	90                   	nop
+
+0000000000001c02 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    1c02:	             55                   	push   %rbp
+    1c03:	             48 89 e5             	mov    %rsp,%rbp
+    1c06:	             48 83 ec 20          	sub    $0x20,%rsp
+    1c0a:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1c0e:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1c12:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1c16:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result-match
+    1c1a:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c1e:	             8b 00                	mov    (%rax),%eax
+    1c20:	             83 f8 02             	cmp    $0x2,%eax
+    1c23:	         /-- 74 32                	je     1c57 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x55>
+    1c25:	         |   83 f8 02             	cmp    $0x2,%eax
+    1c28:	/--------|-- 7f 67                	jg     1c91 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+    1c2a:	|        |   85 c0                	test   %eax,%eax
+    1c2c:	|     /--|-- 74 4d                	je     1c7b <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x79>
+    1c2e:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    1c31:	+-----|--|-- 75 5e                	jne    1c91 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_ok(*ok_);
+    1c33:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c37:	|     |  |   48 83 c0 08          	add    $0x8,%rax
+    1c3b:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    1c3e:	|     |  |   e8 ab 01 00 00       	call   1dee <nel::Element<void*>::operator*() const>
+    1c43:	|     |  |   48 89 c2             	mov    %rax,%rdx
+    1c46:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c4a:	|     |  |   48 89 d6             	mov    %rdx,%rsi
+    1c4d:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    1c50:	|     |  |   e8 57 fd ff ff       	call   19ac <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>
+    1c55:	|  /--|--|-- eb 50                	jmp    1ca7 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    return on_err(*err_);
+    1c57:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c5b:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    1c5f:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1c62:	|  |  |      e8 a1 01 00 00       	call   1e08 <nel::Element<nel::heaped::AllocError>::operator*() const>
+    1c67:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    1c6a:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c6e:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    1c71:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1c74:	|  |  |      e8 47 fd ff ff       	call   19c0 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>
+    1c79:	|  +--|----- eb 2c                	jmp    1ca7 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    nel::panic("invalid Result", ctx);
+    1c7b:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c7f:	|  |         48 89 c6             	mov    %rax,%rsi
+    1c82:	|  |         48 8d 05 0b 14 00 00 	lea    0x140b(%rip),%rax        # 3094 <nel::None+0x8f>
+    1c89:	|  |         48 89 c7             	mov    %rax,%rdi
+    1c8c:	|  |         e8 7e 02 00 00       	call   1f0f <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    1c91:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c95:	   |         48 89 c6             	mov    %rax,%rsi
+    1c98:	   |         48 8d 05 87 13 00 00 	lea    0x1387(%rip),%rax        # 3026 <nel::None+0x21>
+    1c9f:	   |         48 89 c7             	mov    %rax,%rdi
+    1ca2:	   |         e8 68 02 00 00       	call   1f0f <nel::panic(char const*, nel::Context const&)>
+        }
+    1ca7:	   \-------> c9                   	leave
+    1ca8:	             c3                   	ret
+
+0000000000001ca9 <void*&& nel::forward<void*, void*>(void*&)>:
+constexpr U &&forward(T &t)
+    1ca9:	55                   	push   %rbp
+    1caa:	48 89 e5             	mov    %rsp,%rbp
+    1cad:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    1cb1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1cb5:	5d                   	pop    %rbp
+    1cb6:	c3                   	ret
+    1cb7:	90                   	nop
+
+0000000000001cb8 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    1cb8:	             55                   	push   %rbp
+    1cb9:	             48 89 e5             	mov    %rsp,%rbp
+    1cbc:	             48 83 ec 30          	sub    $0x30,%rsp
+    1cc0:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1cc4:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1cc8:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    1ccc:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    1cd0:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cd4:	             8b 00                	mov    (%rax),%eax
+    1cd6:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    1cd9:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cdd:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    1ce3:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    1ce7:	         /-- 74 3e                	je     1d27 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x6f>
+    1ce9:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    1ced:	/--------|-- 7f 7a                	jg     1d69 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+    1cef:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1cf3:	|  /-----|-- 74 5e                	je     1d53 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x9b>
+    1cf5:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    1cf9:	+--|-----|-- 75 6e                	jne    1d69 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+                    return on_ok(forward<T>(*ok_));
+    1cfb:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cff:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    1d03:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    1d06:	|  |     |   e8 17 01 00 00       	call   1e22 <nel::Element<void*>::operator*()>
+    1d0b:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    1d0e:	|  |     |   e8 96 ff ff ff       	call   1ca9 <void*&& nel::forward<void*, void*>(void*&)>
+    1d13:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    1d16:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d1a:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    1d1d:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    1d20:	|  |     |   e8 d9 fc ff ff       	call   19fe <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>
+    1d25:	|  |  /--|-- eb 58                	jmp    1d7f <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    return on_err(forward<E>(*err_));
+    1d27:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d2b:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    1d2f:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1d32:	|  |  |      e8 05 01 00 00       	call   1e3c <nel::Element<nel::heaped::AllocError>::operator*()>
+    1d37:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1d3a:	|  |  |      e8 cc fb ff ff       	call   190b <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    1d3f:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    1d42:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1d46:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    1d49:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1d4c:	|  |  |      e8 cf fc ff ff       	call   1a20 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>
+    1d51:	|  |  +----- eb 2c                	jmp    1d7f <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    nel::panic("invalid Result", ctx);
+    1d53:	|  \--|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1d57:	|     |      48 89 c6             	mov    %rax,%rsi
+    1d5a:	|     |      48 8d 05 33 13 00 00 	lea    0x1333(%rip),%rax        # 3094 <nel::None+0x8f>
+    1d61:	|     |      48 89 c7             	mov    %rax,%rdi
+    1d64:	|     |      e8 a6 01 00 00       	call   1f0f <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    1d69:	\-----|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1d6d:	      |      48 89 c6             	mov    %rax,%rsi
+    1d70:	      |      48 8d 05 af 12 00 00 	lea    0x12af(%rip),%rax        # 3026 <nel::None+0x21>
+    1d77:	      |      48 89 c7             	mov    %rax,%rdi
+    1d7a:	      |      e8 90 01 00 00       	call   1f0f <nel::panic(char const*, nel::Context const&)>
+        }
+    1d7f:	      \----> c9                   	leave
+    1d80:	             c3                   	ret
+    1d81:	             90                   	nop
+
+0000000000001d82 <nel::Element<U8Buf<256ul> >::Element(U8Buf<256ul>&&)>:
+        constexpr Element(Type &&val)
+    1d82:	55                   	push   %rbp
+    1d83:	48 89 e5             	mov    %rsp,%rbp
+    1d86:	53                   	push   %rbx
+    1d87:	48 83 ec 18          	sub    $0x18,%rsp
+    1d8b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1d8f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : value_(forward<Type>(val))
+    1d93:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    1d97:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d9b:	48 89 c7             	mov    %rax,%rdi
+    1d9e:	e8 d9 fc ff ff       	call   1a7c <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    1da3:	48 89 c6             	mov    %rax,%rsi
+    1da6:	48 89 df             	mov    %rbx,%rdi
+    1da9:	e8 a8 00 00 00       	call   1e56 <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>
+        }
+    1dae:	90                   	nop
+    1daf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1db3:	c9                   	leave
+    1db4:	c3                   	ret
+    1db5:	90                   	nop
+
+0000000000001db6 <nel::Element<U8Buf<256ul> >::Element<unsigned char>(unsigned char&&)>:
+        constexpr Element(Args &&...args)
+    1db6:	55                   	push   %rbp
+    1db7:	48 89 e5             	mov    %rsp,%rbp
+    1dba:	53                   	push   %rbx
+    1dbb:	48 83 ec 18          	sub    $0x18,%rsp
+    1dbf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1dc3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : value_(forward<Args>(args)...)
+    1dc7:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    1dcb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1dcf:	48 89 c7             	mov    %rax,%rdi
+    1dd2:	e8 23 fa ff ff       	call   17fa <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    1dd7:	0f b6 00             	movzbl (%rax),%eax
+    1dda:	0f b6 c0             	movzbl %al,%eax
+    1ddd:	89 c6                	mov    %eax,%esi
+    1ddf:	48 89 df             	mov    %rbx,%rdi
+    1de2:	e8 6b f7 ff ff       	call   1552 <U8Buf<256ul>::U8Buf(unsigned char)>
+        }
+    1de7:	90                   	nop
+    1de8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1dec:	c9                   	leave
+    1ded:	c3                   	ret
+
+0000000000001dee <nel::Element<void*>::operator*() const>:
+        constexpr Type &ref(void)
+        {
+            return value_;
+        }
+
+        constexpr Type const &operator*(void) const
+    1dee:	55                   	push   %rbp
+    1def:	48 89 e5             	mov    %rsp,%rbp
+    1df2:	48 83 ec 10          	sub    $0x10,%rsp
+    1df6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    1dfa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dfe:	48 89 c7             	mov    %rax,%rdi
+    1e01:	e8 7c 00 00 00       	call   1e82 <nel::Element<void*>::ref() const>
+        }
+    1e06:	c9                   	leave
+    1e07:	c3                   	ret
+
+0000000000001e08 <nel::Element<nel::heaped::AllocError>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    1e08:	55                   	push   %rbp
+    1e09:	48 89 e5             	mov    %rsp,%rbp
+    1e0c:	48 83 ec 10          	sub    $0x10,%rsp
+    1e10:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    1e14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e18:	48 89 c7             	mov    %rax,%rdi
+    1e1b:	e8 70 00 00 00       	call   1e90 <nel::Element<nel::heaped::AllocError>::ref() const>
+        }
+    1e20:	c9                   	leave
+    1e21:	c3                   	ret
+
+0000000000001e22 <nel::Element<void*>::operator*()>:
+
+        constexpr Type &operator*(void)
+    1e22:	55                   	push   %rbp
+    1e23:	48 89 e5             	mov    %rsp,%rbp
+    1e26:	48 83 ec 10          	sub    $0x10,%rsp
+    1e2a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    1e2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e32:	48 89 c7             	mov    %rax,%rdi
+    1e35:	e8 64 00 00 00       	call   1e9e <nel::Element<void*>::ref()>
+        }
+    1e3a:	c9                   	leave
+    1e3b:	c3                   	ret
+
+0000000000001e3c <nel::Element<nel::heaped::AllocError>::operator*()>:
+        constexpr Type &operator*(void)
+    1e3c:	55                   	push   %rbp
+    1e3d:	48 89 e5             	mov    %rsp,%rbp
+    1e40:	48 83 ec 10          	sub    $0x10,%rsp
+    1e44:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    1e48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e4c:	48 89 c7             	mov    %rax,%rdi
+    1e4f:	e8 58 00 00 00       	call   1eac <nel::Element<nel::heaped::AllocError>::ref()>
+        }
+    1e54:	c9                   	leave
+    1e55:	c3                   	ret
+
+0000000000001e56 <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>:
+        constexpr U8Buf(U8Buf &&o)
+    1e56:	55                   	push   %rbp
+    1e57:	48 89 e5             	mov    %rsp,%rbp
+    1e5a:	48 83 ec 10          	sub    $0x10,%rsp
+    1e5e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1e62:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            nel::elem::move(data_, o.data_, N);
+    1e66:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1e6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e6e:	ba 00 01 00 00       	mov    $0x100,%edx
+    1e73:	48 89 ce             	mov    %rcx,%rsi
+    1e76:	48 89 c7             	mov    %rax,%rdi
+    1e79:	e8 a3 01 00 00       	call   2021 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+        }
+    1e7e:	90                   	nop
+    1e7f:	c9                   	leave
+    1e80:	c3                   	ret
+    1e81:	90                   	nop
+
+0000000000001e82 <nel::Element<void*>::ref() const>:
+        constexpr Type const &ref(void) const
+    1e82:	55                   	push   %rbp
+    1e83:	48 89 e5             	mov    %rsp,%rbp
+    1e86:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    1e8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1e8e:	5d                   	pop    %rbp
+    1e8f:	c3                   	ret
+
+0000000000001e90 <nel::Element<nel::heaped::AllocError>::ref() const>:
+        constexpr Type const &ref(void) const
+    1e90:	55                   	push   %rbp
+    1e91:	48 89 e5             	mov    %rsp,%rbp
+    1e94:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    1e98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1e9c:	5d                   	pop    %rbp
+    1e9d:	c3                   	ret
+
+0000000000001e9e <nel::Element<void*>::ref()>:
+        constexpr Type &ref(void)
+    1e9e:	55                   	push   %rbp
+    1e9f:	48 89 e5             	mov    %rsp,%rbp
+    1ea2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    1ea6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1eaa:	5d                   	pop    %rbp
+    1eab:	c3                   	ret
+
+0000000000001eac <nel::Element<nel::heaped::AllocError>::ref()>:
+        constexpr Type &ref(void)
+    1eac:	55                   	push   %rbp
+    1ead:	48 89 e5             	mov    %rsp,%rbp
+    1eb0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    1eb4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1eb8:	5d                   	pop    %rbp
+    1eb9:	c3                   	ret
+
+0000000000001eba <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    1eba:	55                   	push   %rbp
+    1ebb:	48 89 e5             	mov    %rsp,%rbp
+    std::abort();
+    1ebe:	e8 7d f1 ff ff       	call   1040 <abort@plt>
+
+0000000000001ec3 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    1ec3:	55                   	push   %rbp
+    1ec4:	48 89 e5             	mov    %rsp,%rbp
+    1ec7:	48 83 ec 10          	sub    $0x10,%rsp
+    1ecb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    1ecf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ed3:	48 8b 30             	mov    (%rax),%rsi
+    1ed6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1eda:	8b 48 10             	mov    0x10(%rax),%ecx
+    1edd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ee1:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1ee5:	48 8b 05 74 41 00 00 	mov    0x4174(%rip),%rax        # 6060 <stderr@GLIBC_2.2.5>
+    1eec:	4c 8d 0d b0 11 00 00 	lea    0x11b0(%rip),%r9        # 30a3 <nel::None+0x9e>
+    1ef3:	49 89 f0             	mov    %rsi,%r8
+    1ef6:	48 8d 35 ac 11 00 00 	lea    0x11ac(%rip),%rsi        # 30a9 <nel::None+0xa4>
+    1efd:	48 89 c7             	mov    %rax,%rdi
+    1f00:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f05:	e8 86 f1 ff ff       	call   1090 <fprintf@plt>
+    abort();
+    1f0a:	e8 ab ff ff ff       	call   1eba <nel::abort()>
+
+0000000000001f0f <nel::panic(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1f0f:	55                   	push   %rbp
+    1f10:	48 89 e5             	mov    %rsp,%rbp
+    1f13:	48 83 ec 10          	sub    $0x10,%rsp
+    1f17:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f1b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    1f1f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f23:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    1f26:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f2a:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    1f2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f31:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    1f35:	48 8b 05 24 41 00 00 	mov    0x4124(%rip),%rax        # 6060 <stderr@GLIBC_2.2.5>
+    1f3c:	48 83 ec 08          	sub    $0x8,%rsp
+    1f40:	ff 75 f8             	push   -0x8(%rbp)
+    1f43:	4c 8d 0d 59 11 00 00 	lea    0x1159(%rip),%r9        # 30a3 <nel::None+0x9e>
+    1f4a:	49 89 f0             	mov    %rsi,%r8
+    1f4d:	48 8d 35 66 11 00 00 	lea    0x1166(%rip),%rsi        # 30ba <nel::None+0xb5>
+    1f54:	48 89 c7             	mov    %rax,%rdi
+    1f57:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f5c:	e8 2f f1 ff ff       	call   1090 <fprintf@plt>
+    1f61:	48 83 c4 10          	add    $0x10,%rsp
+            "PANIC",
+            msg);
+    abort();
+    1f65:	e8 50 ff ff ff       	call   1eba <nel::abort()>
+
+0000000000001f6a <nel::assert_fail(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1f6a:	55                   	push   %rbp
+    1f6b:	48 89 e5             	mov    %rsp,%rbp
+    1f6e:	48 83 ec 10          	sub    $0x10,%rsp
+    1f72:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f76:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    1f7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f7e:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    1f81:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f85:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    1f88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f8c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    1f90:	48 8b 05 c9 40 00 00 	mov    0x40c9(%rip),%rax        # 6060 <stderr@GLIBC_2.2.5>
+    1f97:	48 83 ec 08          	sub    $0x8,%rsp
+    1f9b:	ff 75 f8             	push   -0x8(%rbp)
+    1f9e:	4c 8d 0d 2a 11 00 00 	lea    0x112a(%rip),%r9        # 30cf <nel::None+0xca>
+    1fa5:	49 89 f0             	mov    %rsi,%r8
+    1fa8:	48 8d 35 0b 11 00 00 	lea    0x110b(%rip),%rsi        # 30ba <nel::None+0xb5>
+    1faf:	48 89 c7             	mov    %rax,%rdi
+    1fb2:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fb7:	e8 d4 f0 ff ff       	call   1090 <fprintf@plt>
+    1fbc:	48 83 c4 10          	add    $0x10,%rsp
+            "ASSERT FAIL",
+            msg);
+    abort();
+    1fc0:	e8 f5 fe ff ff       	call   1eba <nel::abort()>
+
+0000000000001fc5 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1fc5:	55                   	push   %rbp
+    1fc6:	48 89 e5             	mov    %rsp,%rbp
+    1fc9:	48 83 ec 20          	sub    $0x20,%rsp
+    1fcd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1fd1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1fd5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    1fd9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1fdd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1fe1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fe5:	48 89 ce             	mov    %rcx,%rsi
+    1fe8:	48 89 c7             	mov    %rax,%rdi
+    1feb:	e8 b0 f0 ff ff       	call   10a0 <memcpy@plt>
+}
+    1ff0:	90                   	nop
+    1ff1:	c9                   	leave
+    1ff2:	c3                   	ret
+
+0000000000001ff3 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    1ff3:	55                   	push   %rbp
+    1ff4:	48 89 e5             	mov    %rsp,%rbp
+    1ff7:	48 83 ec 20          	sub    $0x20,%rsp
+    1ffb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1fff:	89 f0                	mov    %esi,%eax
+    2001:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2005:	88 45 f4             	mov    %al,-0xc(%rbp)
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    2008:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    200c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2010:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2014:	89 ce                	mov    %ecx,%esi
+    2016:	48 89 c7             	mov    %rax,%rdi
+    2019:	e8 42 f0 ff ff       	call   1060 <memset@plt>
+}
+    201e:	90                   	nop
+    201f:	c9                   	leave
+    2020:	c3                   	ret
+
+0000000000002021 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    2021:	55                   	push   %rbp
+    2022:	48 89 e5             	mov    %rsp,%rbp
+    2025:	48 83 ec 20          	sub    $0x20,%rsp
+    2029:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    202d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2031:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    //     *id = *is;
+    // }
+    // for (uint8_t *id = d, *is = s, *const e = (d + n); id != e; ++is, ++id) {
+    //     *is = 0xa5;
+    // }
+    copy(d, s, n);
+    2035:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2039:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    203d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2041:	48 89 ce             	mov    %rcx,%rsi
+    2044:	48 89 c7             	mov    %rax,%rdi
+    2047:	e8 79 ff ff ff       	call   1fc5 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    poison(s, n);
+    204c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2050:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2054:	48 89 d6             	mov    %rdx,%rsi
+    2057:	48 89 c7             	mov    %rax,%rdi
+    205a:	e8 60 07 00 00       	call   27bf <nel::elem::poison(unsigned char*, unsigned long)>
+}
+    205f:	90                   	nop
+    2060:	c9                   	leave
+    2061:	c3                   	ret
+
+0000000000002062 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    2062:	55                   	push   %rbp
+    2063:	48 89 e5             	mov    %rsp,%rbp
+    2066:	48 83 ec 20          	sub    $0x20,%rsp
+    206a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    206e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2072:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    std::memmove(d, s, n);
+    2076:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    207a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    207e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2082:	48 89 ce             	mov    %rcx,%rsi
+    2085:	48 89 c7             	mov    %rax,%rdi
+    2088:	e8 33 f0 ff ff       	call   10c0 <memmove@plt>
+}
+    208d:	90                   	nop
+    208e:	c9                   	leave
+    208f:	c3                   	ret
+
+0000000000002090 <nel::elem::wipe(unsigned char*, unsigned long)>:
+
+void wipe(uint8_t *const d, Length const n)
+{
+    2090:	55                   	push   %rbp
+    2091:	48 89 e5             	mov    %rsp,%rbp
+    2094:	48 83 ec 10          	sub    $0x10,%rsp
+    2098:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    209c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    set(d, 0xa5, n);
+    20a0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    20a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20a8:	be a5 00 00 00       	mov    $0xa5,%esi
+    20ad:	48 89 c7             	mov    %rax,%rdi
+    20b0:	e8 3e ff ff ff       	call   1ff3 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    20b5:	90                   	nop
+    20b6:	c9                   	leave
+    20b7:	c3                   	ret
+
+00000000000020b8 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    20b8:	55                   	push   %rbp
+    20b9:	48 89 e5             	mov    %rsp,%rbp
+    20bc:	48 83 ec 20          	sub    $0x20,%rsp
+    20c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    20c4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    20c8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    20cc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    20d0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    20d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20d8:	48 89 ce             	mov    %rcx,%rsi
+    20db:	48 89 c7             	mov    %rax,%rdi
+    20de:	e8 9d ef ff ff       	call   1080 <memcmp@plt>
+    20e3:	85 c0                	test   %eax,%eax
+    20e5:	0f 94 c0             	sete   %al
+}
+    20e8:	c9                   	leave
+    20e9:	c3                   	ret
+
+00000000000020ea <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    20ea:	55                   	push   %rbp
+    20eb:	48 89 e5             	mov    %rsp,%rbp
+    20ee:	48 83 ec 20          	sub    $0x20,%rsp
+    20f2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    20f6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    20fa:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    20fe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2102:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2106:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    210a:	48 89 ce             	mov    %rcx,%rsi
+    210d:	48 89 c7             	mov    %rax,%rdi
+    2110:	e8 6b ef ff ff       	call   1080 <memcmp@plt>
+    2115:	85 c0                	test   %eax,%eax
+    2117:	0f 95 c0             	setne  %al
+}
+    211a:	c9                   	leave
+    211b:	c3                   	ret
+
+000000000000211c <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>:
+
+// d[i] = p[i % 16] for i in [0, n), with normal stores:
+// the pattern once, then doubling the filled region.
+static void set_pattern(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    211c:	       55                   	push   %rbp
+    211d:	       48 89 e5             	mov    %rsp,%rbp
+    2120:	       48 83 ec 30          	sub    $0x30,%rsp
+    2124:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2128:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    212c:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    Length done = (n < 16) ? n : 16;
+    2130:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2134:	       ba 10 00 00 00       	mov    $0x10,%edx
+    2139:	       48 39 d0             	cmp    %rdx,%rax
+    213c:	       48 0f 47 c2          	cmova  %rdx,%rax
+    2140:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    copy(d, p, done);
+    2144:	       48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2148:	       48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    214c:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2150:	       48 89 ce             	mov    %rcx,%rsi
+    2153:	       48 89 c7             	mov    %rax,%rdi
+    2156:	       e8 6a fe ff ff       	call   1fc5 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    while (done < n) {
+    215b:	   /-- eb 3e                	jmp    219b <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x7f>
+        Length const m = (done < n - done) ? done : n - done;
+    215d:	/--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2161:	|  |   48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    2165:	|  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2169:	|  |   48 39 c2             	cmp    %rax,%rdx
+    216c:	|  |   48 0f 46 c2          	cmovbe %rdx,%rax
+    2170:	|  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        copy(d + done, d, m);
+    2174:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2178:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    217c:	|  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    2180:	|  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2184:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2188:	|  |   48 89 c6             	mov    %rax,%rsi
+    218b:	|  |   48 89 cf             	mov    %rcx,%rdi
+    218e:	|  |   e8 32 fe ff ff       	call   1fc5 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        done += m;
+    2193:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2197:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+    while (done < n) {
+    219b:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    219f:	|      48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    21a3:	\----- 72 b8                	jb     215d <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x41>
+    }
+}
+    21a5:	       90                   	nop
+    21a6:	       90                   	nop
+    21a7:	       c9                   	leave
+    21a8:	       c3                   	ret
+
+00000000000021a9 <nel::elem::load16(unsigned char const*)>:
+static constexpr Length streaming_min = 256;
+
+typedef long long int Line16 __attribute__((vector_size(16)));
+
+static inline Line16 load16(uint8_t const *const s)
+{
+    21a9:	55                   	push   %rbp
+    21aa:	48 89 e5             	mov    %rsp,%rbp
+    21ad:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Line16 v;
+    std::memcpy(&v, s, sizeof(v));
+    21b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    21b5:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    21b9:	48 8b 00             	mov    (%rax),%rax
+    21bc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    21c0:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    return v;
+    21c4:	66 0f 6f 45 f0       	movdqa -0x10(%rbp),%xmm0
+}
+    21c9:	5d                   	pop    %rbp
+    21ca:	c3                   	ret
+
+00000000000021cb <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>:
+
+static inline void stream16(uint8_t *const d, Line16 const &v)
+{
+    21cb:	55                   	push   %rbp
+    21cc:	48 89 e5             	mov    %rsp,%rbp
+    21cf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    21d3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    21d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    21db:	66 0f 6f 00          	movdqa (%rax),%xmm0
+    21df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21e3:	66 0f e7 00          	movntdq %xmm0,(%rax)
+}
+    21e7:	90                   	nop
+    21e8:	5d                   	pop    %rbp
+    21e9:	c3                   	ret
+
+00000000000021ea <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    21ea:	          55                   	push   %rbp
+    21eb:	          48 89 e5             	mov    %rsp,%rbp
+    21ee:	          48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    21f2:	          48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    21f6:	          48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    21fa:	          48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    if (n < streaming_min) {
+    21fe:	          48 81 7d 88 ff 00 00 	cmpq   $0xff,-0x78(%rbp)
+    2205:	          00 
+    2206:	      /-- 77 1c                	ja     2224 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        copy(d, s, n);
+    2208:	      |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    220c:	      |   48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    2210:	      |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2214:	      |   48 89 ce             	mov    %rcx,%rsi
+    2217:	      |   48 89 c7             	mov    %rax,%rdi
+    221a:	      |   e8 a6 fd ff ff       	call   1fc5 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        return;
+    221f:	/-----|-- e9 98 01 00 00       	jmp    23bc <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1d2>
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2224:	|     \-> 48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2228:	|         48 f7 d8             	neg    %rax
+    222b:	|         83 e0 0f             	and    $0xf,%eax
+    222e:	|         48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    copy(d, s, head);
+    2232:	|         48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2236:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    223a:	|         48 8b 45 98          	mov    -0x68(%rbp),%rax
+    223e:	|         48 89 ce             	mov    %rcx,%rsi
+    2241:	|         48 89 c7             	mov    %rax,%rdi
+    2244:	|         e8 7c fd ff ff       	call   1fc5 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    Index i = head;
+    2249:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    224d:	|         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    2251:	|     /-- e9 e1 00 00 00       	jmp    2337 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        Line16 const a = load16(s + i);
+    2256:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    225a:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    225e:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2261:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2264:	|  |  |   e8 40 ff ff ff       	call   21a9 <nel::elem::load16(unsigned char const*)>
+    2269:	|  |  |   0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+        Line16 const b = load16(s + i + 16);
+    226d:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2271:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    2275:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2279:	|  |  |   48 01 d0             	add    %rdx,%rax
+    227c:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    227f:	|  |  |   e8 25 ff ff ff       	call   21a9 <nel::elem::load16(unsigned char const*)>
+    2284:	|  |  |   0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+        Line16 const c = load16(s + i + 32);
+    2288:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    228c:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    2290:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2294:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2297:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    229a:	|  |  |   e8 0a ff ff ff       	call   21a9 <nel::elem::load16(unsigned char const*)>
+    229f:	|  |  |   0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+        Line16 const e = load16(s + i + 48);
+    22a3:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22a7:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    22ab:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    22af:	|  |  |   48 01 d0             	add    %rdx,%rax
+    22b2:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    22b5:	|  |  |   e8 ef fe ff ff       	call   21a9 <nel::elem::load16(unsigned char const*)>
+    22ba:	|  |  |   0f 29 45 a0          	movaps %xmm0,-0x60(%rbp)
+        stream16(d + i, a);
+    22be:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    22c2:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22c6:	|  |  |   48 01 c2             	add    %rax,%rdx
+    22c9:	|  |  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    22cd:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    22d0:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    22d3:	|  |  |   e8 f3 fe ff ff       	call   21cb <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, b);
+    22d8:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22dc:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    22e0:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    22e4:	|  |  |   48 01 c2             	add    %rax,%rdx
+    22e7:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    22eb:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    22ee:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    22f1:	|  |  |   e8 d5 fe ff ff       	call   21cb <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, c);
+    22f6:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22fa:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    22fe:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2302:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2305:	|  |  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    2309:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    230c:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    230f:	|  |  |   e8 b7 fe ff ff       	call   21cb <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, e);
+    2314:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2318:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    231c:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2320:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2323:	|  |  |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    2327:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    232a:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    232d:	|  |  |   e8 99 fe ff ff       	call   21cb <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    2332:	|  |  |   48 83 45 f8 40       	addq   $0x40,-0x8(%rbp)
+    2337:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    233b:	|  |      48 83 c0 40          	add    $0x40,%rax
+    233f:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    2343:	|  \----- 0f 83 0d ff ff ff    	jae    2256 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x6c>
+    }
+    for (; i + 16 <= n; i += 16) {
+    2349:	|     /-- eb 36                	jmp    2381 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x197>
+        stream16(d + i, load16(s + i));
+    234b:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    234f:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2353:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2356:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2359:	|  |  |   e8 4b fe ff ff       	call   21a9 <nel::elem::load16(unsigned char const*)>
+    235e:	|  |  |   0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+    2362:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    2366:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    236a:	|  |  |   48 01 c2             	add    %rax,%rdx
+    236d:	|  |  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2371:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2374:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2377:	|  |  |   e8 4f fe ff ff       	call   21cb <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    237c:	|  |  |   48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+    2381:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2385:	|  |      48 83 c0 10          	add    $0x10,%rax
+    2389:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    238d:	|  \----- 73 bc                	jae    234b <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    238f:	|         0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    2392:	|         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    2396:	|         48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    239a:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    239e:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    23a2:	|         48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    23a6:	|         48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+    23aa:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    23ae:	|         48 01 d1             	add    %rdx,%rcx
+    23b1:	|         48 89 c2             	mov    %rax,%rdx
+    23b4:	|         48 89 cf             	mov    %rcx,%rdi
+    23b7:	|         e8 09 fc ff ff       	call   1fc5 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+}
+    23bc:	\-------> c9                   	leave
+    23bd:	          c3                   	ret
+
+00000000000023be <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    23be:	          55                   	push   %rbp
+    23bf:	          48 89 e5             	mov    %rsp,%rbp
+    23c2:	          48 83 ec 60          	sub    $0x60,%rsp
+    23c6:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    23ca:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    23ce:	          48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    if (n < streaming_min) {
+    23d2:	          48 81 7d a8 ff 00 00 	cmpq   $0xff,-0x58(%rbp)
+    23d9:	          00 
+    23da:	      /-- 77 1c                	ja     23f8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        set_pattern(d, p, n);
+    23dc:	      |   48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    23e0:	      |   48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+    23e4:	      |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    23e8:	      |   48 89 ce             	mov    %rcx,%rsi
+    23eb:	      |   48 89 c7             	mov    %rax,%rdi
+    23ee:	      |   e8 29 fd ff ff       	call   211c <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>
+    23f3:	/-----|-- e9 89 01 00 00       	jmp    2581 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c3>
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    23f8:	|     \-> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    23fc:	|         48 f7 d8             	neg    %rax
+    23ff:	|         83 e0 0f             	and    $0xf,%eax
+    2402:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    for (Index i = 0; i < head; ++i) {
+    2406:	|         48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    240d:	|         00 
+    240e:	|     /-- eb 20                	jmp    2430 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x72>
+        d[i] = p[i];
+    2410:	|  /--|-> 48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    2414:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2418:	|  |  |   48 01 d0             	add    %rdx,%rax
+    241b:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    241f:	|  |  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2423:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    2426:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    2429:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < head; ++i) {
+    242b:	|  |  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    2430:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2434:	|  |      48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    2438:	|  \----- 72 d6                	jb     2410 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x52>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    243a:	|         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    2441:	|         00 
+    2442:	|     /-- eb 2d                	jmp    2471 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xb3>
+        rotated[i] = p[(head + i) % 16];
+    2444:	|  /--|-> 48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2448:	|  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    244c:	|  |  |   48 01 d0             	add    %rdx,%rax
+    244f:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    2452:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    2455:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2459:	|  |  |   48 01 d0             	add    %rdx,%rax
+    245c:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    245f:	|  |  |   48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    2463:	|  |  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2467:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    246a:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < 16; ++i) {
+    246c:	|  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    2471:	|  |  \-> 48 83 7d f0 0f       	cmpq   $0xf,-0x10(%rbp)
+    2476:	|  \----- 76 cc                	jbe    2444 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x86>
+    }
+    Line16 const v = load16(rotated);
+    2478:	|         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    247c:	|         48 89 c7             	mov    %rax,%rdi
+    247f:	|         e8 25 fd ff ff       	call   21a9 <nel::elem::load16(unsigned char const*)>
+    2484:	|         0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+    Index i = head;
+    2488:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    248c:	|         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    2490:	|     /-- eb 79                	jmp    250b <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        stream16(d + i, v);
+    2492:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    2496:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    249a:	|  |  |   48 01 c2             	add    %rax,%rdx
+    249d:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    24a1:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    24a4:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    24a7:	|  |  |   e8 1f fd ff ff       	call   21cb <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, v);
+    24ac:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24b0:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    24b4:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    24b8:	|  |  |   48 01 c2             	add    %rax,%rdx
+    24bb:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    24bf:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    24c2:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    24c5:	|  |  |   e8 01 fd ff ff       	call   21cb <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, v);
+    24ca:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24ce:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    24d2:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    24d6:	|  |  |   48 01 c2             	add    %rax,%rdx
+    24d9:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    24dd:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    24e0:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    24e3:	|  |  |   e8 e3 fc ff ff       	call   21cb <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, v);
+    24e8:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24ec:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    24f0:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    24f4:	|  |  |   48 01 c2             	add    %rax,%rdx
+    24f7:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    24fb:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    24fe:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2501:	|  |  |   e8 c5 fc ff ff       	call   21cb <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    2506:	|  |  |   48 83 45 e8 40       	addq   $0x40,-0x18(%rbp)
+    250b:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    250f:	|  |      48 83 c0 40          	add    $0x40,%rax
+    2513:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    2517:	|  \----- 0f 83 75 ff ff ff    	jae    2492 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd4>
+    }
+    for (; i + 16 <= n; i += 16) {
+    251d:	|     /-- eb 1f                	jmp    253e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x180>
+        stream16(d + i, v);
+    251f:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    2523:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2527:	|  |  |   48 01 c2             	add    %rax,%rdx
+    252a:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    252e:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2531:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2534:	|  |  |   e8 92 fc ff ff       	call   21cb <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    2539:	|  |  |   48 83 45 e8 10       	addq   $0x10,-0x18(%rbp)
+    253e:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2542:	|  |      48 83 c0 10          	add    $0x10,%rax
+    2546:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    254a:	|  \----- 73 d3                	jae    251f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    __builtin_ia32_sfence();
+    254c:	|         0f ae f8             	sfence
+    for (; i < n; ++i) {
+    254f:	|     /-- eb 26                	jmp    2577 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1b9>
+        d[i] = p[i % 16];
+    2551:	|  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2555:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    2558:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    255b:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    255f:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2562:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    2566:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    256a:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    256d:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    2570:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (; i < n; ++i) {
+    2572:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    2577:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    257b:	|  |      48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    257f:	|  \----- 72 d0                	jb     2551 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x193>
+    }
+}
+    2581:	\-------> c9                   	leave
+    2582:	          c3                   	ret
+
+0000000000002583 <nel::offset_of(unsigned char*, unsigned long)>:
+// The payload is the first align boundary leaving room for a Length in front,
+// which holds the offset from the start of the underlying allocation.
+// Malloc alignment is at least alignof(Length), so the payload is at most
+// align bytes in.
+static Length offset_of(uint8_t *const base, Length const align)
+{
+    2583:	55                   	push   %rbp
+    2584:	48 89 e5             	mov    %rsp,%rbp
+    2587:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    258b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    USize const a = reinterpret_cast<USize>(base) + sizeof(Length);
+    258f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2593:	48 83 c0 08          	add    $0x8,%rax
+    2597:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    259b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    259f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    25a3:	48 01 d0             	add    %rdx,%rax
+    25a6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    25aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    25ae:	48 f7 d8             	neg    %rax
+    25b1:	48 21 c2             	and    %rax,%rdx
+    25b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25b8:	48 29 c2             	sub    %rax,%rdx
+    25bb:	48 89 d0             	mov    %rdx,%rax
+}
+    25be:	5d                   	pop    %rbp
+    25bf:	c3                   	ret
+
+00000000000025c0 <nel::offset_field(unsigned char*)>:
+
+static Length &offset_field(uint8_t *const p)
+{
+    25c0:	55                   	push   %rbp
+    25c1:	48 89 e5             	mov    %rsp,%rbp
+    25c4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return reinterpret_cast<Length *>(p)[-1];
+    25c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25cc:	48 83 e8 08          	sub    $0x8,%rax
+}
+    25d0:	5d                   	pop    %rbp
+    25d1:	c3                   	ret
+
+00000000000025d2 <nel::free_aligned(void*)>:
+
+void free_aligned(void *const p)
+{
+    25d2:	       55                   	push   %rbp
+    25d3:	       48 89 e5             	mov    %rsp,%rbp
+    25d6:	       48 83 ec 20          	sub    $0x20,%rsp
+    25da:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (p == nullptr) { return; }
+    25de:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    25e3:	/----- 74 2e                	je     2613 <nel::free_aligned(void*)+0x41>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    25e5:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25e9:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    std::free(u8p - offset_field(u8p));
+    25ed:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25f1:	|      48 89 c7             	mov    %rax,%rdi
+    25f4:	|      e8 c7 ff ff ff       	call   25c0 <nel::offset_field(unsigned char*)>
+    25f9:	|      48 8b 00             	mov    (%rax),%rax
+    25fc:	|      48 f7 d8             	neg    %rax
+    25ff:	|      48 89 c2             	mov    %rax,%rdx
+    2602:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2606:	|      48 01 d0             	add    %rdx,%rax
+    2609:	|      48 89 c7             	mov    %rax,%rdi
+    260c:	|      e8 1f ea ff ff       	call   1030 <free@plt>
+    2611:	|  /-- eb 01                	jmp    2614 <nel::free_aligned(void*)+0x42>
+    if (p == nullptr) { return; }
+    2613:	\--|-> 90                   	nop
+}
+    2614:	   \-> c9                   	leave
+    2615:	       c3                   	ret
+
+0000000000002616 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    2616:	             55                   	push   %rbp
+    2617:	             48 89 e5             	mov    %rsp,%rbp
+    261a:	             53                   	push   %rbx
+    261b:	             48 83 ec 78          	sub    $0x78,%rsp
+    261f:	             48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    2623:	             48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    2627:	             48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    262b:	             48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    262f:	             48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    2633:	             b9 f3 00 00 00       	mov    $0xf3,%ecx
+    2638:	             48 8d 15 b1 0a 00 00 	lea    0xab1(%rip),%rdx        # 30f0 <nel::elem::streaming_min+0x8>
+    263f:	             48 8d 35 bc 0a 00 00 	lea    0xabc(%rip),%rsi        # 3102 <nel::elem::streaming_min+0x1a>
+    2646:	             48 89 c7             	mov    %rax,%rdi
+    2649:	             e8 3e ed ff ff       	call   138c <nel::Context::Context(char const*, char const*, int)>
+    264e:	             48 83 7d 90 00       	cmpq   $0x0,-0x70(%rbp)
+    2653:	      /----- 74 18                	je     266d <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    2655:	      |      48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2659:	      |      48 83 e8 01          	sub    $0x1,%rax
+    265d:	      |      48 23 45 90          	and    -0x70(%rbp),%rax
+    2661:	      |      48 85 c0             	test   %rax,%rax
+    2664:	      +----- 75 07                	jne    266d <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    2666:	      |      b8 01 00 00 00       	mov    $0x1,%eax
+    266b:	      |  /-- eb 05                	jmp    2672 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x5c>
+    266d:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    2672:	         \-> 0f b6 c0             	movzbl %al,%eax
+    2675:	             48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    2679:	             48 8d 0d 92 0a 00 00 	lea    0xa92(%rip),%rcx        # 3112 <nel::elem::streaming_min+0x2a>
+    2680:	             48 89 ce             	mov    %rcx,%rsi
+    2683:	             89 c7                	mov    %eax,%edi
+    2685:	             e8 5b 01 00 00       	call   27e5 <nel::assert(bool, char const*, nel::Context const&)>
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    268a:	             48 8b 45 98          	mov    -0x68(%rbp),%rax
+    268e:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    2692:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    2697:	      /----- 74 11                	je     26aa <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x94>
+    2699:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    269d:	      |      48 89 c7             	mov    %rax,%rdi
+    26a0:	      |      e8 1b ff ff ff       	call   25c0 <nel::offset_field(unsigned char*)>
+    26a5:	      |      48 8b 00             	mov    (%rax),%rax
+    26a8:	      |  /-- eb 05                	jmp    26af <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x99>
+    26aa:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    26af:	         \-> 48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    26b3:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    26b8:	      /----- 74 13                	je     26cd <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb7>
+    26ba:	      |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    26be:	      |      48 f7 d8             	neg    %rax
+    26c1:	      |      48 89 c2             	mov    %rax,%rdx
+    26c4:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26c8:	      |      48 01 d0             	add    %rdx,%rax
+    26cb:	      |  /-- eb 05                	jmp    26d2 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xbc>
+    26cd:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    26d2:	         \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    26d6:	             48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    26da:	             48 8b 45 90          	mov    -0x70(%rbp),%rax
+    26de:	             48 01 c2             	add    %rax,%rdx
+    26e1:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    26e5:	             48 89 d6             	mov    %rdx,%rsi
+    26e8:	             48 89 c7             	mov    %rax,%rdi
+    26eb:	             e8 c0 e9 ff ff       	call   10b0 <realloc@plt>
+    26f0:	             48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if (new_base == nullptr) { return nullptr; }
+    26f4:	             48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    26f9:	         /-- 75 0a                	jne    2705 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    26fb:	         |   b8 00 00 00 00       	mov    $0x0,%eax
+    2700:	/--------|-- e9 85 00 00 00       	jmp    278a <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x174>
+
+    Length const new_offset = offset_of(new_base, align);
+    2705:	|        \-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    2709:	|            48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    270d:	|            48 89 d6             	mov    %rdx,%rsi
+    2710:	|            48 89 c7             	mov    %rax,%rdi
+    2713:	|            e8 6b fe ff ff       	call   2583 <nel::offset_of(unsigned char*, unsigned long)>
+    2718:	|            48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    uint8_t *const new_p = new_base + new_offset;
+    271c:	|            48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    2720:	|            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2724:	|            48 01 d0             	add    %rdx,%rax
+    2727:	|            48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    if (old_p != nullptr && new_offset != old_offset) {
+    272b:	|            48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    2730:	|  /-------- 74 41                	je     2773 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+    2732:	|  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2736:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    273a:	|  +-------- 74 37                	je     2773 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+    273c:	|  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    2740:	|  |         48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    2744:	|  |  /----- 73 06                	jae    274c <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x136>
+    2746:	|  |  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    274a:	|  |  |  /-- eb 04                	jmp    2750 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x13a>
+    274c:	|  |  \--|-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    2750:	|  |     \-> 48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        std::memmove(new_p, new_base + old_offset, n);
+    2754:	|  |         48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    2758:	|  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    275c:	|  |         48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    2760:	|  |         48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    2764:	|  |         48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2768:	|  |         48 89 ce             	mov    %rcx,%rsi
+    276b:	|  |         48 89 c7             	mov    %rax,%rdi
+    276e:	|  |         e8 4d e9 ff ff       	call   10c0 <memmove@plt>
+    }
+    offset_field(new_p) = new_offset;
+    2773:	|  \-------> 48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+    2777:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    277b:	|            48 89 c7             	mov    %rax,%rdi
+    277e:	|            e8 3d fe ff ff       	call   25c0 <nel::offset_field(unsigned char*)>
+    2783:	|            48 89 18             	mov    %rbx,(%rax)
+    return new_p;
+    2786:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+}
+    278a:	\----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    278e:	             c9                   	leave
+    278f:	             c3                   	ret
+
+0000000000002790 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    2790:	55                   	push   %rbp
+    2791:	48 89 e5             	mov    %rsp,%rbp
+    2794:	48 83 ec 10          	sub    $0x10,%rsp
+    2798:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    279c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return realloc_aligned(nullptr, align, 0, size);
+    27a0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    27a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27a8:	48 89 d1             	mov    %rdx,%rcx
+    27ab:	ba 00 00 00 00       	mov    $0x0,%edx
+    27b0:	48 89 c6             	mov    %rax,%rsi
+    27b3:	bf 00 00 00 00       	mov    $0x0,%edi
+    27b8:	e8 59 fe ff ff       	call   2616 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+}
+    27bd:	c9                   	leave
+    27be:	c3                   	ret
+
+00000000000027bf <nel::elem::poison(unsigned char*, unsigned long)>:
+{
+    27bf:	55                   	push   %rbp
+    27c0:	48 89 e5             	mov    %rsp,%rbp
+    27c3:	48 83 ec 10          	sub    $0x10,%rsp
+    27c7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    27cb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    copy(d, s, n);
+    27cf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    27d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27d7:	48 89 d6             	mov    %rdx,%rsi
+    27da:	48 89 c7             	mov    %rax,%rdi
+    27dd:	e8 ae f8 ff ff       	call   2090 <nel::elem::wipe(unsigned char*, unsigned long)>
+}
+    27e2:	90                   	nop
+    27e3:	c9                   	leave
+    27e4:	c3                   	ret
+
+00000000000027e5 <nel::assert(bool, char const*, nel::Context const&)>:
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx);
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    27e5:	    55                   	push   %rbp
+    27e6:	    48 89 e5             	mov    %rsp,%rbp
+    27e9:	    48 83 ec 20          	sub    $0x20,%rsp
+    27ed:	    89 f8                	mov    %edi,%eax
+    27ef:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    27f3:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    27f7:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { assert_fail(msg, ctx); }
+    27fa:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    27fe:	    83 f0 01             	xor    $0x1,%eax
+    2801:	    84 c0                	test   %al,%al
+    2803:	/-- 74 13                	je     2818 <nel::assert(bool, char const*, nel::Context const&)+0x33>
+    2805:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2809:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    280d:	|   48 89 d6             	mov    %rdx,%rsi
+    2810:	|   48 89 c7             	mov    %rax,%rdi
+    2813:	|   e8 52 f7 ff ff       	call   1f6a <nel::assert_fail(char const*, nel::Context const&)>
+}
+    2818:	\-> 90                   	nop
+    2819:	    c9                   	leave
+    281a:	    c3                   	ret
+
+000000000000281b <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    281b:	55                   	push   %rbp
+    281c:	48 89 e5             	mov    %rsp,%rbp
+    281f:	48 83 ec 10          	sub    $0x10,%rsp
+    2823:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2827:	89 f0                	mov    %esi,%eax
+    2829:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    282c:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    2830:	48 8b 15 29 38 00 00 	mov    0x3829(%rip),%rdx        # 6060 <stderr@GLIBC_2.2.5>
+    2837:	48 89 d6             	mov    %rdx,%rsi
+    283a:	89 c7                	mov    %eax,%edi
+    283c:	e8 2f e8 ff ff       	call   1070 <fputc@plt>
+    return outs;
+    2841:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2845:	c9                   	leave
+    2846:	c3                   	ret
+
+0000000000002847 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    2847:	55                   	push   %rbp
+    2848:	48 89 e5             	mov    %rsp,%rbp
+    284b:	48 83 ec 10          	sub    $0x10,%rsp
+    284f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2853:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    2857:	48 8b 15 02 38 00 00 	mov    0x3802(%rip),%rdx        # 6060 <stderr@GLIBC_2.2.5>
+    285e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2862:	48 89 d6             	mov    %rdx,%rsi
+    2865:	48 89 c7             	mov    %rax,%rdi
+    2868:	e8 e3 e7 ff ff       	call   1050 <fputs@plt>
+    return outs;
+    286d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2871:	c9                   	leave
+    2872:	c3                   	ret
+
+0000000000002873 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    2873:	55                   	push   %rbp
+    2874:	48 89 e5             	mov    %rsp,%rbp
+    2877:	48 83 ec 10          	sub    $0x10,%rsp
+    287b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    287f:	89 f0                	mov    %esi,%eax
+    2881:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    2884:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    2888:	48 8b 05 d1 37 00 00 	mov    0x37d1(%rip),%rax        # 6060 <stderr@GLIBC_2.2.5>
+    288f:	48 8d 0d 97 08 00 00 	lea    0x897(%rip),%rcx        # 312d <nel::elem::streaming_min+0x45>
+    2896:	48 89 ce             	mov    %rcx,%rsi
+    2899:	48 89 c7             	mov    %rax,%rdi
+    289c:	b8 00 00 00 00       	mov    $0x0,%eax
+    28a1:	e8 ea e7 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    28a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    28aa:	c9                   	leave
+    28ab:	c3                   	ret
+
+00000000000028ac <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    28ac:	55                   	push   %rbp
+    28ad:	48 89 e5             	mov    %rsp,%rbp
+    28b0:	48 83 ec 10          	sub    $0x10,%rsp
+    28b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    28b8:	89 f0                	mov    %esi,%eax
+    28ba:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    28be:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    28c2:	48 8b 05 97 37 00 00 	mov    0x3797(%rip),%rax        # 6060 <stderr@GLIBC_2.2.5>
+    28c9:	48 8d 0d 5d 08 00 00 	lea    0x85d(%rip),%rcx        # 312d <nel::elem::streaming_min+0x45>
+    28d0:	48 89 ce             	mov    %rcx,%rsi
+    28d3:	48 89 c7             	mov    %rax,%rdi
+    28d6:	b8 00 00 00 00       	mov    $0x0,%eax
+    28db:	e8 b0 e7 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    28e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    28e4:	c9                   	leave
+    28e5:	c3                   	ret
+
+00000000000028e6 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    28e6:	55                   	push   %rbp
+    28e7:	48 89 e5             	mov    %rsp,%rbp
+    28ea:	48 83 ec 10          	sub    $0x10,%rsp
+    28ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    28f2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    28f5:	48 8b 05 64 37 00 00 	mov    0x3764(%rip),%rax        # 6060 <stderr@GLIBC_2.2.5>
+    28fc:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    28ff:	48 8d 0d 27 08 00 00 	lea    0x827(%rip),%rcx        # 312d <nel::elem::streaming_min+0x45>
+    2906:	48 89 ce             	mov    %rcx,%rsi
+    2909:	48 89 c7             	mov    %rax,%rdi
+    290c:	b8 00 00 00 00       	mov    $0x0,%eax
+    2911:	e8 7a e7 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    2916:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    291a:	c9                   	leave
+    291b:	c3                   	ret
+
+000000000000291c <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    291c:	55                   	push   %rbp
+    291d:	48 89 e5             	mov    %rsp,%rbp
+    2920:	48 83 ec 10          	sub    $0x10,%rsp
+    2924:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2928:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    292b:	48 8b 05 2e 37 00 00 	mov    0x372e(%rip),%rax        # 6060 <stderr@GLIBC_2.2.5>
+    2932:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    2935:	48 8d 0d f1 07 00 00 	lea    0x7f1(%rip),%rcx        # 312d <nel::elem::streaming_min+0x45>
+    293c:	48 89 ce             	mov    %rcx,%rsi
+    293f:	48 89 c7             	mov    %rax,%rdi
+    2942:	b8 00 00 00 00       	mov    $0x0,%eax
+    2947:	e8 44 e7 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    294c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2950:	c9                   	leave
+    2951:	c3                   	ret
+
+0000000000002952 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    2952:	55                   	push   %rbp
+    2953:	48 89 e5             	mov    %rsp,%rbp
+    2956:	48 83 ec 10          	sub    $0x10,%rsp
+    295a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    295e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    2962:	48 8b 05 f7 36 00 00 	mov    0x36f7(%rip),%rax        # 6060 <stderr@GLIBC_2.2.5>
+    2969:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    296d:	48 8d 0d bc 07 00 00 	lea    0x7bc(%rip),%rcx        # 3130 <nel::elem::streaming_min+0x48>
+    2974:	48 89 ce             	mov    %rcx,%rsi
+    2977:	48 89 c7             	mov    %rax,%rdi
+    297a:	b8 00 00 00 00       	mov    $0x0,%eax
+    297f:	e8 0c e7 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    2984:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2988:	c9                   	leave
+    2989:	c3                   	ret
+
+Disassembly of section .fini:
+
+000000000000298c <_fini>:
+    298c:	48 83 ec 08          	sub    $0x8,%rsp
+    2990:	48 83 c4 08          	add    $0x8,%rsp
+    2994:	c3                   	ret
@@ -0,0 +1,3851 @@
+
+target/debug/examples/largestruct1_result:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 5f 00 00 	mov    0x5fc5(%rip),%rax        # 6fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 5f 00 00    	push   0x5fca(%rip)        # 6ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 5f 00 00    	jmp    *0x5fcc(%rip)        # 6ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 5f 00 00    	jmp    *0x5fca(%rip)        # 7000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 5f 00 00    	jmp    *0x5fc2(%rip)        # 7008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 5f 00 00    	jmp    *0x5fba(%rip)        # 7010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memset@plt>:
+    1060:	ff 25 b2 5f 00 00    	jmp    *0x5fb2(%rip)        # 7018 <memset@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 5f 00 00    	jmp    *0x5faa(%rip)        # 7020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 5f 00 00    	jmp    *0x5fa2(%rip)        # 7028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 5f 00 00    	jmp    *0x5f9a(%rip)        # 7030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcpy@plt>:
+    10a0:	ff 25 92 5f 00 00    	jmp    *0x5f92(%rip)        # 7038 <memcpy@GLIBC_2.14>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <realloc@plt>:
+    10b0:	ff 25 8a 5f 00 00    	jmp    *0x5f8a(%rip)        # 7040 <realloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <memmove@plt>:
+    10c0:	ff 25 82 5f 00 00    	jmp    *0x5f82(%rip)        # 7048 <memmove@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010d0 <__cxa_finalize@plt>:
+    10d0:	ff 25 0a 5f 00 00    	jmp    *0x5f0a(%rip)        # 6fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10d6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010e0 <_start>:
+    10e0:	31 ed                	xor    %ebp,%ebp
+    10e2:	49 89 d1             	mov    %rdx,%r9
+    10e5:	5e                   	pop    %rsi
+    10e6:	48 89 e2             	mov    %rsp,%rdx
+    10e9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    10ed:	50                   	push   %rax
+    10ee:	54                   	push   %rsp
+    10ef:	45 31 c0             	xor    %r8d,%r8d
+    10f2:	31 c9                	xor    %ecx,%ecx
+    10f4:	48 8d 3d d4 0b 00 00 	lea    0xbd4(%rip),%rdi        # 1ccf <main>
+    10fb:	ff 15 bf 5e 00 00    	call   *0x5ebf(%rip)        # 6fc0 <__libc_start_main@GLIBC_2.34>
+    1101:	f4                   	hlt
+    1102:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1109:	00 00 00 
+    110c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001110 <deregister_tm_clones>:
+    1110:	    48 8d 3d 49 5f 00 00 	lea    0x5f49(%rip),%rdi        # 7060 <stderr@GLIBC_2.2.5>
+    1117:	    48 8d 05 42 5f 00 00 	lea    0x5f42(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    111e:	    48 39 f8             	cmp    %rdi,%rax
+    1121:	/-- 74 15                	je     1138 <deregister_tm_clones+0x28>
+    1123:	|   48 8b 05 9e 5e 00 00 	mov    0x5e9e(%rip),%rax        # 6fc8 <_ITM_deregisterTMCloneTable@Base>
+    112a:	|   48 85 c0             	test   %rax,%rax
+    112d:	+-- 74 09                	je     1138 <deregister_tm_clones+0x28>
+    112f:	|   ff e0                	jmp    *%rax
+    1131:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1138:	\-> c3                   	ret
+    1139:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001140 <register_tm_clones>:
+    1140:	    48 8d 3d 19 5f 00 00 	lea    0x5f19(%rip),%rdi        # 7060 <stderr@GLIBC_2.2.5>
+    1147:	    48 8d 35 12 5f 00 00 	lea    0x5f12(%rip),%rsi        # 7060 <stderr@GLIBC_2.2.5>
+    114e:	    48 29 fe             	sub    %rdi,%rsi
+    1151:	    48 89 f0             	mov    %rsi,%rax
+    1154:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1158:	    48 c1 f8 03          	sar    $0x3,%rax
+    115c:	    48 01 c6             	add    %rax,%rsi
+    115f:	    48 d1 fe             	sar    %rsi
+    1162:	/-- 74 14                	je     1178 <register_tm_clones+0x38>
+    1164:	|   48 8b 05 6d 5e 00 00 	mov    0x5e6d(%rip),%rax        # 6fd8 <_ITM_registerTMCloneTable@Base>
+    116b:	|   48 85 c0             	test   %rax,%rax
+    116e:	+-- 74 08                	je     1178 <register_tm_clones+0x38>
+    1170:	|   ff e0                	jmp    *%rax
+    1172:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1178:	\-> c3                   	ret
+    1179:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001180 <__do_global_dtors_aux>:
+    1180:	       f3 0f 1e fa          	endbr64
+    1184:	       80 3d dd 5e 00 00 00 	cmpb   $0x0,0x5edd(%rip)        # 7068 <completed.0>
+    118b:	/----- 75 2b                	jne    11b8 <__do_global_dtors_aux+0x38>
+    118d:	|      55                   	push   %rbp
+    118e:	|      48 83 3d 4a 5e 00 00 	cmpq   $0x0,0x5e4a(%rip)        # 6fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1195:	|      00 
+    1196:	|      48 89 e5             	mov    %rsp,%rbp
+    1199:	|  /-- 74 0c                	je     11a7 <__do_global_dtors_aux+0x27>
+    119b:	|  |   48 8b 3d b6 5e 00 00 	mov    0x5eb6(%rip),%rdi        # 7058 <__dso_handle>
+    11a2:	|  |   e8 29 ff ff ff       	call   10d0 <__cxa_finalize@plt>
+    11a7:	|  \-> e8 64 ff ff ff       	call   1110 <deregister_tm_clones>
+    11ac:	|      c6 05 b5 5e 00 00 01 	movb   $0x1,0x5eb5(%rip)        # 7068 <completed.0>
+    11b3:	|      5d                   	pop    %rbp
+    11b4:	|      c3                   	ret
+    11b5:	|      0f 1f 00             	nopl   (%rax)
+    11b8:	\----> c3                   	ret
+    11b9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011c0 <frame_dummy>:
+    11c0:	f3 0f 1e fa          	endbr64
+    11c4:	e9 77 ff ff ff       	jmp    1140 <register_tm_clones>
+
+00000000000011c9 <operator<<(nel::Log&, ErrorCode const&)>:
+    Failed = 1,
+};
+
+// std::ostream &operator<<(std::ostream &outs, ErrorCode const &val) {
+nel::Log &operator<<(nel::Log &outs, ErrorCode const &val)
+{
+    11c9:	       55                   	push   %rbp
+    11ca:	       48 89 e5             	mov    %rsp,%rbp
+    11cd:	       48 83 ec 30          	sub    $0x30,%rsp
+    11d1:	       48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    11d5:	       48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    // don't supply default case so compile fails if case not present for value in ErrorCode
+    // but, must return in each case and must panic after switch.
+    // see:
+    // https://stackoverflow.com/questions/2201493/using-default-in-a-switch-statement-when-switching-over-an-enum
+    switch (val) {
+    11d9:	       48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    11dd:	       8b 00                	mov    (%rax),%eax
+    11df:	       83 f8 01             	cmp    $0x1,%eax
+    11e2:	   /-- 75 18                	jne    11fc <operator<<(nel::Log&, ErrorCode const&)+0x33>
+        case ErrorCode::Failed:
+            return outs << "Failed";
+    11e4:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    11e8:	   |   48 8d 15 1a 2e 00 00 	lea    0x2e1a(%rip),%rdx        # 4009 <nel::elem::poisoning+0x1>
+    11ef:	   |   48 89 d6             	mov    %rdx,%rsi
+    11f2:	   |   48 89 c7             	mov    %rax,%rdi
+    11f5:	   |   e8 01 23 00 00       	call   34fb <nel::operator<<(nel::Log&, char const*)>
+    11fa:	/--|-- eb 36                	jmp    1232 <operator<<(nel::Log&, ErrorCode const&)+0x69>
+            break;
+        default:
+            break;
+    11fc:	|  \-> 90                   	nop
+    }
+    nel::panic("unknown ErrorCode");
+    11fd:	|      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1201:	|      b9 1a 00 00 00       	mov    $0x1a,%ecx
+    1206:	|      48 8d 15 03 2e 00 00 	lea    0x2e03(%rip),%rdx        # 4010 <nel::elem::poisoning+0x8>
+    120d:	|      48 8d 35 0e 2e 00 00 	lea    0x2e0e(%rip),%rsi        # 4022 <nel::elem::poisoning+0x1a>
+    1214:	|      48 89 c7             	mov    %rax,%rdi
+    1217:	|      e8 e4 0a 00 00       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    121c:	|      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1220:	|      48 89 c6             	mov    %rax,%rsi
+    1223:	|      48 8d 05 03 2e 00 00 	lea    0x2e03(%rip),%rax        # 402d <nel::elem::poisoning+0x25>
+    122a:	|      48 89 c7             	mov    %rax,%rdi
+    122d:	|      e8 91 19 00 00       	call   2bc3 <nel::panic(char const*, nel::Context const&)>
+    return outs << '?';
+}
+    1232:	\----> c9                   	leave
+    1233:	       c3                   	ret
+
+0000000000001234 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    1234:	55                   	push   %rbp
+    1235:	48 89 e5             	mov    %rsp,%rbp
+    1238:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    123c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    123f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1244:	5d                   	pop    %rbp
+    1245:	c3                   	ret
+
+0000000000001246 <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    1246:	55                   	push   %rbp
+    1247:	48 89 e5             	mov    %rsp,%rbp
+    124a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    124e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1251:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return -1;
+    1255:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    125a:	5d                   	pop    %rbp
+    125b:	c3                   	ret
+
+000000000000125c <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    125c:	55                   	push   %rbp
+    125d:	48 89 e5             	mov    %rsp,%rbp
+    1260:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1264:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1267:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    return -1;
+    126a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    126f:	5d                   	pop    %rbp
+    1270:	c3                   	ret
+
+0000000000001271 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    1271:	55                   	push   %rbp
+    1272:	48 89 e5             	mov    %rsp,%rbp
+    1275:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1279:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    127c:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    127f:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    return -1;
+    1282:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1287:	5d                   	pop    %rbp
+    1288:	c3                   	ret
+
+0000000000001289 <_read_r>:
+int _read_r(struct _reent *, int) {
+    1289:	55                   	push   %rbp
+    128a:	48 89 e5             	mov    %rsp,%rbp
+    128d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1291:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1294:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1299:	5d                   	pop    %rbp
+    129a:	c3                   	ret
+
+000000000000129b <_write_r>:
+int _write_r(struct _reent *, int, char *, int) {
+    129b:	55                   	push   %rbp
+    129c:	48 89 e5             	mov    %rsp,%rbp
+    129f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    12a3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    12a6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    12aa:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+    return -1;
+    12ad:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    12b2:	5d                   	pop    %rbp
+    12b3:	c3                   	ret
+
+00000000000012b4 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    12b4:	55                   	push   %rbp
+    12b5:	48 89 e5             	mov    %rsp,%rbp
+    12b8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return -1;
+    12bc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    12c1:	5d                   	pop    %rbp
+    12c2:	c3                   	ret
+
+00000000000012c3 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    12c3:	55                   	push   %rbp
+    12c4:	48 89 e5             	mov    %rsp,%rbp
+    12c7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    12cb:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    12ce:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    12d3:	5d                   	pop    %rbp
+    12d4:	c3                   	ret
+
+00000000000012d5 <ok1()>:
+#include "libnosys_stubs.cx"
+
+typedef nel::Result<U8Buf<256>, Error> Result_t;
+
+Result_t NEL_WARN_UNUSED_RESULT ok1(void)
+{
+    12d5:	55                   	push   %rbp
+    12d6:	48 89 e5             	mov    %rsp,%rbp
+    12d9:	48 83 ec 10          	sub    $0x10,%rsp
+    12dd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return Result_t::Ok();
+    12e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12e5:	48 89 c7             	mov    %rax,%rdi
+    12e8:	e8 92 0f 00 00       	call   227f <nel::Result<U8Buf<256ul>, Error> nel::Result<U8Buf<256ul>, Error>::Ok<>()>
+}
+    12ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12f1:	c9                   	leave
+    12f2:	c3                   	ret
+
+00000000000012f3 <ok2()>:
+
+Result_t NEL_WARN_UNUSED_RESULT ok2(void)
+{
+    12f3:	55                   	push   %rbp
+    12f4:	48 89 e5             	mov    %rsp,%rbp
+    12f7:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+    12fe:	48 89 bd f8 fe ff ff 	mov    %rdi,-0x108(%rbp)
+    return Result_t::Ok(U8Buf<256>());
+    1305:	48 8d 85 00 ff ff ff 	lea    -0x100(%rbp),%rax
+    130c:	48 89 c7             	mov    %rax,%rdi
+    130f:	e8 1a 10 00 00       	call   232e <U8Buf<256ul>::U8Buf()>
+    1314:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+    131b:	48 8d 95 00 ff ff ff 	lea    -0x100(%rbp),%rdx
+    1322:	48 89 d6             	mov    %rdx,%rsi
+    1325:	48 89 c7             	mov    %rax,%rdi
+    1328:	e8 32 10 00 00       	call   235f <nel::Result<U8Buf<256ul>, Error>::Ok(U8Buf<256ul>&&)>
+    132d:	48 8d 85 00 ff ff ff 	lea    -0x100(%rbp),%rax
+    1334:	48 89 c7             	mov    %rax,%rdi
+    1337:	e8 fe 0f 00 00       	call   233a <U8Buf<256ul>::~U8Buf()>
+    133c:	90                   	nop
+}
+    133d:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+    1344:	c9                   	leave
+    1345:	c3                   	ret
+
+0000000000001346 <ok3()>:
+
+Result_t NEL_WARN_UNUSED_RESULT ok3(void)
+{
+    1346:	55                   	push   %rbp
+    1347:	48 89 e5             	mov    %rsp,%rbp
+    134a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+    1351:	48 89 bd f8 fe ff ff 	mov    %rdi,-0x108(%rbp)
+    return Result_t::Ok(U8Buf<256>((uint8_t)0x22));
+    1358:	48 8d 85 00 ff ff ff 	lea    -0x100(%rbp),%rax
+    135f:	be 22 00 00 00       	mov    $0x22,%esi
+    1364:	48 89 c7             	mov    %rax,%rdi
+    1367:	e8 28 10 00 00       	call   2394 <U8Buf<256ul>::U8Buf(unsigned char)>
+    136c:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+    1373:	48 8d 95 00 ff ff ff 	lea    -0x100(%rbp),%rdx
+    137a:	48 89 d6             	mov    %rdx,%rsi
+    137d:	48 89 c7             	mov    %rax,%rdi
+    1380:	e8 da 0f 00 00       	call   235f <nel::Result<U8Buf<256ul>, Error>::Ok(U8Buf<256ul>&&)>
+    1385:	48 8d 85 00 ff ff ff 	lea    -0x100(%rbp),%rax
+    138c:	48 89 c7             	mov    %rax,%rdi
+    138f:	e8 a6 0f 00 00       	call   233a <U8Buf<256ul>::~U8Buf()>
+    1394:	90                   	nop
+}
+    1395:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+    139c:	c9                   	leave
+    139d:	c3                   	ret
+
+000000000000139e <ok4()>:
+
+Result_t NEL_WARN_UNUSED_RESULT ok4(void)
+{
+    139e:	55                   	push   %rbp
+    139f:	48 89 e5             	mov    %rsp,%rbp
+    13a2:	48 83 ec 20          	sub    $0x20,%rsp
+    13a6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    return Result_t::Ok((uint8_t)0x33);
+    13aa:	c6 45 ff 33          	movb   $0x33,-0x1(%rbp)
+    13ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13b2:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    13b6:	48 89 d6             	mov    %rdx,%rsi
+    13b9:	48 89 c7             	mov    %rax,%rdi
+    13bc:	e8 fe 0f 00 00       	call   23bf <nel::Result<U8Buf<256ul>, Error> nel::Result<U8Buf<256ul>, Error>::Ok<unsigned char>(unsigned char&&)>
+}
+    13c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13c5:	c9                   	leave
+    13c6:	c3                   	ret
+
+00000000000013c7 <fail2()>:
+
+Result_t NEL_WARN_UNUSED_RESULT fail2(void)
+{
+    13c7:	55                   	push   %rbp
+    13c8:	48 89 e5             	mov    %rsp,%rbp
+    13cb:	48 83 ec 30          	sub    $0x30,%rsp
+    13cf:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    return Result_t::Err(Error(ErrorCode::Failed, __FILE__, __LINE__));
+    13d3:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    13da:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+    13de:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    13e2:	b9 22 00 00 00       	mov    $0x22,%ecx
+    13e7:	48 8d 15 62 2c 00 00 	lea    0x2c62(%rip),%rdx        # 4050 <nel::None+0x2>
+    13ee:	48 89 c7             	mov    %rax,%rdi
+    13f1:	e8 42 09 00 00       	call   1d38 <Error::Error(ErrorCode const&, char const*, unsigned long)>
+    13f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    13fa:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    13fe:	48 89 d6             	mov    %rdx,%rsi
+    1401:	48 89 c7             	mov    %rax,%rdi
+    1404:	e8 ea 0f 00 00       	call   23f3 <nel::Result<U8Buf<256ul>, Error>::Err(Error&&)>
+}
+    1409:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    140d:	c9                   	leave
+    140e:	c3                   	ret
+
+000000000000140f <fail4()>:
+
+Result_t NEL_WARN_UNUSED_RESULT fail4(void)
+{
+    140f:	55                   	push   %rbp
+    1410:	48 89 e5             	mov    %rsp,%rbp
+    1413:	48 83 ec 20          	sub    $0x20,%rsp
+    1417:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    return Result_t::Err(ErrorCode::Failed, __FILE__, __LINE__);
+    141b:	c7 45 f8 27 00 00 00 	movl   $0x27,-0x8(%rbp)
+    1422:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1429:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    142d:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    1431:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+    1435:	48 89 d1             	mov    %rdx,%rcx
+    1438:	48 8d 15 11 2c 00 00 	lea    0x2c11(%rip),%rdx        # 4050 <nel::None+0x2>
+    143f:	48 89 c7             	mov    %rax,%rdi
+    1442:	e8 e0 0f 00 00       	call   2427 <nel::Result<U8Buf<256ul>, Error> nel::Result<U8Buf<256ul>, Error>::Err<ErrorCode, char const (&) [32], int>(ErrorCode&&, char const (&) [32], int&&)>
+}
+    1447:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    144b:	c9                   	leave
+    144c:	c3                   	ret
+
+000000000000144d <passok3()>:
+
+Result_t NEL_WARN_UNUSED_RESULT passok3(void)
+{
+    144d:	55                   	push   %rbp
+    144e:	48 89 e5             	mov    %rsp,%rbp
+    1451:	48 83 ec 10          	sub    $0x10,%rsp
+    1455:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return ok3();
+    1459:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    145d:	48 89 c7             	mov    %rax,%rdi
+    1460:	e8 e1 fe ff ff       	call   1346 <ok3()>
+}
+    1465:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1469:	c9                   	leave
+    146a:	c3                   	ret
+
+000000000000146b <passfail4()>:
+
+Result_t NEL_WARN_UNUSED_RESULT passfail4(void)
+{
+    146b:	55                   	push   %rbp
+    146c:	48 89 e5             	mov    %rsp,%rbp
+    146f:	48 83 ec 10          	sub    $0x10,%rsp
+    1473:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return fail4();
+    1477:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    147b:	48 89 c7             	mov    %rax,%rdi
+    147e:	e8 8c ff ff ff       	call   140f <fail4()>
+}
+    1483:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1487:	c9                   	leave
+    1488:	c3                   	ret
+
+0000000000001489 <passok31()>:
+
+Result_t NEL_WARN_UNUSED_RESULT passok31(void)
+{
+    1489:	       55                   	push   %rbp
+    148a:	       48 89 e5             	mov    %rsp,%rbp
+    148d:	       48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+    1494:	       48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+    Result_t res = ok3();
+    149b:	       48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    14a2:	       48 89 c7             	mov    %rax,%rdi
+    14a5:	       e8 9c fe ff ff       	call   1346 <ok3()>
+    if (res.is_ok()) {
+    14aa:	       48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    14ae:	       b9 37 00 00 00       	mov    $0x37,%ecx
+    14b3:	       48 8d 15 96 2b 00 00 	lea    0x2b96(%rip),%rdx        # 4050 <nel::None+0x2>
+    14ba:	       48 8d 35 af 2b 00 00 	lea    0x2baf(%rip),%rsi        # 4070 <nel::None+0x22>
+    14c1:	       48 89 c7             	mov    %rax,%rdi
+    14c4:	       e8 37 08 00 00       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    14c9:	       48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    14cd:	       48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    14d4:	       48 89 d6             	mov    %rdx,%rsi
+    14d7:	       48 89 c7             	mov    %rax,%rdi
+    14da:	       e8 d7 0f 00 00       	call   24b6 <nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const>
+    14df:	       84 c0                	test   %al,%al
+    14e1:	/----- 74 1b                	je     14fe <passok31()+0x75>
+        // only one thing to move-> better than err+bool separate
+        return res;
+    14e3:	|      48 8d 95 d0 fe ff ff 	lea    -0x130(%rbp),%rdx
+    14ea:	|      48 8b 85 c8 fe ff ff 	mov    -0x138(%rbp),%rax
+    14f1:	|      48 89 d6             	mov    %rdx,%rsi
+    14f4:	|      48 89 c7             	mov    %rax,%rdi
+    14f7:	|      e8 7e 09 00 00       	call   1e7a <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)>
+    14fc:	|  /-- eb 1a                	jmp    1518 <passok31()+0x8f>
+    }
+    return Result_t::Ok((uint8_t)0x31);
+    14fe:	\--|-> c6 45 ff 31          	movb   $0x31,-0x1(%rbp)
+    1502:	   |   48 8b 85 c8 fe ff ff 	mov    -0x138(%rbp),%rax
+    1509:	   |   48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    150d:	   |   48 89 d6             	mov    %rdx,%rsi
+    1510:	   |   48 89 c7             	mov    %rax,%rdi
+    1513:	   |   e8 a7 0e 00 00       	call   23bf <nel::Result<U8Buf<256ul>, Error> nel::Result<U8Buf<256ul>, Error>::Ok<unsigned char>(unsigned char&&)>
+}
+    1518:	   \-> 48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    151f:	       48 89 c7             	mov    %rax,%rdi
+    1522:	       e8 93 0d 00 00       	call   22ba <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    1527:	       48 8b 85 c8 fe ff ff 	mov    -0x138(%rbp),%rax
+    152e:	       c9                   	leave
+    152f:	       c3                   	ret
+
+0000000000001530 <passok32()>:
+
+Result_t NEL_WARN_UNUSED_RESULT passok32(void)
+{
+    1530:	       55                   	push   %rbp
+    1531:	       48 89 e5             	mov    %rsp,%rbp
+    1534:	       48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+    153b:	       48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+    Result_t res = ok3();
+    1542:	       48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    1549:	       48 89 c7             	mov    %rax,%rdi
+    154c:	       e8 f5 fd ff ff       	call   1346 <ok3()>
+    if (res.is_err()) {
+    1551:	       48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1555:	       b9 41 00 00 00       	mov    $0x41,%ecx
+    155a:	       48 8d 15 ef 2a 00 00 	lea    0x2aef(%rip),%rdx        # 4050 <nel::None+0x2>
+    1561:	       48 8d 35 11 2b 00 00 	lea    0x2b11(%rip),%rsi        # 4079 <nel::None+0x2b>
+    1568:	       48 89 c7             	mov    %rax,%rdi
+    156b:	       e8 90 07 00 00       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    1570:	       48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1574:	       48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    157b:	       48 89 d6             	mov    %rdx,%rsi
+    157e:	       48 89 c7             	mov    %rax,%rdi
+    1581:	       e8 82 0f 00 00       	call   2508 <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const>
+    1586:	       84 c0                	test   %al,%al
+    1588:	/----- 74 1b                	je     15a5 <passok32()+0x75>
+        // only one thing to move-> better than err+bool separate
+        return res;
+    158a:	|      48 8d 95 d0 fe ff ff 	lea    -0x130(%rbp),%rdx
+    1591:	|      48 8b 85 c8 fe ff ff 	mov    -0x138(%rbp),%rax
+    1598:	|      48 89 d6             	mov    %rdx,%rsi
+    159b:	|      48 89 c7             	mov    %rax,%rdi
+    159e:	|      e8 d7 08 00 00       	call   1e7a <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)>
+    15a3:	|  /-- eb 1a                	jmp    15bf <passok32()+0x8f>
+    }
+    return Result_t::Ok((uint8_t)0x32);
+    15a5:	\--|-> c6 45 ff 32          	movb   $0x32,-0x1(%rbp)
+    15a9:	   |   48 8b 85 c8 fe ff ff 	mov    -0x138(%rbp),%rax
+    15b0:	   |   48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    15b4:	   |   48 89 d6             	mov    %rdx,%rsi
+    15b7:	   |   48 89 c7             	mov    %rax,%rdi
+    15ba:	   |   e8 00 0e 00 00       	call   23bf <nel::Result<U8Buf<256ul>, Error> nel::Result<U8Buf<256ul>, Error>::Ok<unsigned char>(unsigned char&&)>
+}
+    15bf:	   \-> 48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    15c6:	       48 89 c7             	mov    %rax,%rdi
+    15c9:	       e8 ec 0c 00 00       	call   22ba <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    15ce:	       48 8b 85 c8 fe ff ff 	mov    -0x138(%rbp),%rax
+    15d5:	       c9                   	leave
+    15d6:	       c3                   	ret
+
+00000000000015d7 <passfail31()>:
+
+Result_t NEL_WARN_UNUSED_RESULT passfail31(void)
+{
+    15d7:	       55                   	push   %rbp
+    15d8:	       48 89 e5             	mov    %rsp,%rbp
+    15db:	       48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+    15e2:	       48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+    Result_t res = fail4();
+    15e9:	       48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    15f0:	       48 89 c7             	mov    %rax,%rdi
+    15f3:	       e8 17 fe ff ff       	call   140f <fail4()>
+    if (res.is_ok()) { return res; }
+    15f8:	       48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    15fc:	       b9 4b 00 00 00       	mov    $0x4b,%ecx
+    1601:	       48 8d 15 48 2a 00 00 	lea    0x2a48(%rip),%rdx        # 4050 <nel::None+0x2>
+    1608:	       48 8d 35 73 2a 00 00 	lea    0x2a73(%rip),%rsi        # 4082 <nel::None+0x34>
+    160f:	       48 89 c7             	mov    %rax,%rdi
+    1612:	       e8 e9 06 00 00       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    1617:	       48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    161b:	       48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    1622:	       48 89 d6             	mov    %rdx,%rsi
+    1625:	       48 89 c7             	mov    %rax,%rdi
+    1628:	       e8 89 0e 00 00       	call   24b6 <nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const>
+    162d:	       84 c0                	test   %al,%al
+    162f:	/----- 74 1b                	je     164c <passfail31()+0x75>
+    1631:	|      48 8d 95 d0 fe ff ff 	lea    -0x130(%rbp),%rdx
+    1638:	|      48 8b 85 c8 fe ff ff 	mov    -0x138(%rbp),%rax
+    163f:	|      48 89 d6             	mov    %rdx,%rsi
+    1642:	|      48 89 c7             	mov    %rax,%rdi
+    1645:	|      e8 30 08 00 00       	call   1e7a <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)>
+    164a:	|  /-- eb 1a                	jmp    1666 <passfail31()+0x8f>
+    return Result_t::Ok((uint8_t)0x41);
+    164c:	\--|-> c6 45 ff 41          	movb   $0x41,-0x1(%rbp)
+    1650:	   |   48 8b 85 c8 fe ff ff 	mov    -0x138(%rbp),%rax
+    1657:	   |   48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    165b:	   |   48 89 d6             	mov    %rdx,%rsi
+    165e:	   |   48 89 c7             	mov    %rax,%rdi
+    1661:	   |   e8 59 0d 00 00       	call   23bf <nel::Result<U8Buf<256ul>, Error> nel::Result<U8Buf<256ul>, Error>::Ok<unsigned char>(unsigned char&&)>
+}
+    1666:	   \-> 48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    166d:	       48 89 c7             	mov    %rax,%rdi
+    1670:	       e8 45 0c 00 00       	call   22ba <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    1675:	       48 8b 85 c8 fe ff ff 	mov    -0x138(%rbp),%rax
+    167c:	       c9                   	leave
+    167d:	       c3                   	ret
+
+000000000000167e <passfail32()>:
+
+Result_t NEL_WARN_UNUSED_RESULT passfail32(void)
+{
+    167e:	       55                   	push   %rbp
+    167f:	       48 89 e5             	mov    %rsp,%rbp
+    1682:	       48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+    1689:	       48 89 bd c8 fe ff ff 	mov    %rdi,-0x138(%rbp)
+    Result_t res = fail4();
+    1690:	       48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    1697:	       48 89 c7             	mov    %rax,%rdi
+    169a:	       e8 70 fd ff ff       	call   140f <fail4()>
+    if (res.is_err()) { return res; }
+    169f:	       48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    16a3:	       b9 52 00 00 00       	mov    $0x52,%ecx
+    16a8:	       48 8d 15 a1 29 00 00 	lea    0x29a1(%rip),%rdx        # 4050 <nel::None+0x2>
+    16af:	       48 8d 35 d7 29 00 00 	lea    0x29d7(%rip),%rsi        # 408d <nel::None+0x3f>
+    16b6:	       48 89 c7             	mov    %rax,%rdi
+    16b9:	       e8 42 06 00 00       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    16be:	       48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    16c2:	       48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    16c9:	       48 89 d6             	mov    %rdx,%rsi
+    16cc:	       48 89 c7             	mov    %rax,%rdi
+    16cf:	       e8 34 0e 00 00       	call   2508 <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const>
+    16d4:	       84 c0                	test   %al,%al
+    16d6:	/----- 74 1b                	je     16f3 <passfail32()+0x75>
+    16d8:	|      48 8d 95 d0 fe ff ff 	lea    -0x130(%rbp),%rdx
+    16df:	|      48 8b 85 c8 fe ff ff 	mov    -0x138(%rbp),%rax
+    16e6:	|      48 89 d6             	mov    %rdx,%rsi
+    16e9:	|      48 89 c7             	mov    %rax,%rdi
+    16ec:	|      e8 89 07 00 00       	call   1e7a <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)>
+    16f1:	|  /-- eb 1a                	jmp    170d <passfail32()+0x8f>
+    return Result_t::Ok((uint8_t)0x42);
+    16f3:	\--|-> c6 45 ff 42          	movb   $0x42,-0x1(%rbp)
+    16f7:	   |   48 8b 85 c8 fe ff ff 	mov    -0x138(%rbp),%rax
+    16fe:	   |   48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    1702:	   |   48 89 d6             	mov    %rdx,%rsi
+    1705:	   |   48 89 c7             	mov    %rax,%rdi
+    1708:	   |   e8 b2 0c 00 00       	call   23bf <nel::Result<U8Buf<256ul>, Error> nel::Result<U8Buf<256ul>, Error>::Ok<unsigned char>(unsigned char&&)>
+}
+    170d:	   \-> 48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    1714:	       48 89 c7             	mov    %rax,%rdi
+    1717:	       e8 9e 0b 00 00       	call   22ba <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    171c:	       48 8b 85 c8 fe ff ff 	mov    -0x138(%rbp),%rax
+    1723:	       c9                   	leave
+    1724:	       c3                   	ret
+
+0000000000001725 <passok33()>:
+
+Result_t NEL_WARN_UNUSED_RESULT passok33(void)
+{
+    1725:	       55                   	push   %rbp
+    1726:	       48 89 e5             	mov    %rsp,%rbp
+    1729:	       53                   	push   %rbx
+    172a:	       48 81 ec 78 03 00 00 	sub    $0x378,%rsp
+    1731:	       48 89 bd 88 fc ff ff 	mov    %rdi,-0x378(%rbp)
+    Result_t res = ok3();
+    1738:	       48 8d 85 a0 fd ff ff 	lea    -0x260(%rbp),%rax
+    173f:	       48 89 c7             	mov    %rax,%rdi
+    1742:	       e8 ff fb ff ff       	call   1346 <ok3()>
+    NEL_RESULT_TRY(res);
+    1747:	       48 8d 85 a0 fd ff ff 	lea    -0x260(%rbp),%rax
+    174e:	       48 89 c7             	mov    %rax,%rdi
+    1751:	       e8 ef 06 00 00       	call   1e45 <nel::Result<U8Buf<256ul>, Error>&& nel::move<nel::Result<U8Buf<256ul>, Error> >(nel::Result<U8Buf<256ul>, Error>&)>
+    1756:	       48 89 c2             	mov    %rax,%rdx
+    1759:	       48 8d 85 90 fc ff ff 	lea    -0x370(%rbp),%rax
+    1760:	       48 89 d6             	mov    %rdx,%rsi
+    1763:	       48 89 c7             	mov    %rax,%rdi
+    1766:	       e8 0f 07 00 00       	call   1e7a <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)>
+    176b:	       48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    176f:	       b9 59 00 00 00       	mov    $0x59,%ecx
+    1774:	       48 8d 15 d5 28 00 00 	lea    0x28d5(%rip),%rdx        # 4050 <nel::None+0x2>
+    177b:	       48 8d 35 3a 29 00 00 	lea    0x293a(%rip),%rsi        # 40bc <nel::None+0x6e>
+    1782:	       48 89 c7             	mov    %rax,%rdi
+    1785:	       e8 76 05 00 00       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    178a:	       48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    178e:	       48 8d 85 90 fc ff ff 	lea    -0x370(%rbp),%rax
+    1795:	       48 89 d6             	mov    %rdx,%rsi
+    1798:	       48 89 c7             	mov    %rax,%rdi
+    179b:	       e8 68 0d 00 00       	call   2508 <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const>
+    17a0:	       84 c0                	test   %al,%al
+    17a2:	   /-- 74 20                	je     17c4 <passok33()+0x9f>
+    17a4:	   |   48 8d 95 90 fc ff ff 	lea    -0x370(%rbp),%rdx
+    17ab:	   |   48 8b 85 88 fc ff ff 	mov    -0x378(%rbp),%rax
+    17b2:	   |   48 89 d6             	mov    %rdx,%rsi
+    17b5:	   |   48 89 c7             	mov    %rax,%rdi
+    17b8:	   |   e8 bd 06 00 00       	call   1e7a <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)>
+    17bd:	   |   bb 00 00 00 00       	mov    $0x0,%ebx
+    17c2:	/--|-- eb 41                	jmp    1805 <passok33()+0xe0>
+    17c4:	|  \-> 48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    17c8:	|      b9 59 00 00 00       	mov    $0x59,%ecx
+    17cd:	|      48 8d 15 7c 28 00 00 	lea    0x287c(%rip),%rdx        # 4050 <nel::None+0x2>
+    17d4:	|      48 8d 35 e1 28 00 00 	lea    0x28e1(%rip),%rsi        # 40bc <nel::None+0x6e>
+    17db:	|      48 89 c7             	mov    %rax,%rdi
+    17de:	|      e8 1d 05 00 00       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    17e3:	|      48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    17ea:	|      48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    17ee:	|      48 8d 8d 90 fc ff ff 	lea    -0x370(%rbp),%rcx
+    17f5:	|      48 89 ce             	mov    %rcx,%rsi
+    17f8:	|      48 89 c7             	mov    %rax,%rdi
+    17fb:	|      e8 de 07 00 00       	call   1fde <nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)>
+    1800:	|      bb 01 00 00 00       	mov    $0x1,%ebx
+    1805:	\----> 48 8d 85 90 fc ff ff 	lea    -0x370(%rbp),%rax
+    180c:	       48 89 c7             	mov    %rax,%rdi
+    180f:	       e8 a6 0a 00 00       	call   22ba <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    1814:	       83 fb 01             	cmp    $0x1,%ebx
+    1817:	   /-- 75 2a                	jne    1843 <passok33()+0x11e>
+    1819:	   |   90                   	nop
+    181a:	   |   48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    1821:	   |   48 89 c7             	mov    %rax,%rdi
+    1824:	   |   e8 11 0b 00 00       	call   233a <U8Buf<256ul>::~U8Buf()>
+    return Result_t::Ok((uint8_t)0x33);
+    1829:	   |   c6 45 ef 33          	movb   $0x33,-0x11(%rbp)
+    182d:	   |   48 8b 85 88 fc ff ff 	mov    -0x378(%rbp),%rax
+    1834:	   |   48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+    1838:	   |   48 89 d6             	mov    %rdx,%rsi
+    183b:	   |   48 89 c7             	mov    %rax,%rdi
+    183e:	   |   e8 7c 0b 00 00       	call   23bf <nel::Result<U8Buf<256ul>, Error> nel::Result<U8Buf<256ul>, Error>::Ok<unsigned char>(unsigned char&&)>
+}
+    1843:	   \-> 48 8d 85 a0 fd ff ff 	lea    -0x260(%rbp),%rax
+    184a:	       48 89 c7             	mov    %rax,%rdi
+    184d:	       e8 68 0a 00 00       	call   22ba <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    1852:	       48 8b 85 88 fc ff ff 	mov    -0x378(%rbp),%rax
+    1859:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    185d:	       c9                   	leave
+    185e:	       c3                   	ret
+
+000000000000185f <passfail33()>:
+
+Result_t NEL_WARN_UNUSED_RESULT passfail33(void)
+{
+    185f:	       55                   	push   %rbp
+    1860:	       48 89 e5             	mov    %rsp,%rbp
+    1863:	       53                   	push   %rbx
+    1864:	       48 81 ec 78 03 00 00 	sub    $0x378,%rsp
+    186b:	       48 89 bd 88 fc ff ff 	mov    %rdi,-0x378(%rbp)
+    Result_t res = fail4();
+    1872:	       48 8d 85 a0 fd ff ff 	lea    -0x260(%rbp),%rax
+    1879:	       48 89 c7             	mov    %rax,%rdi
+    187c:	       e8 8e fb ff ff       	call   140f <fail4()>
+    NEL_RESULT_TRY(res);
+    1881:	       48 8d 85 a0 fd ff ff 	lea    -0x260(%rbp),%rax
+    1888:	       48 89 c7             	mov    %rax,%rdi
+    188b:	       e8 b5 05 00 00       	call   1e45 <nel::Result<U8Buf<256ul>, Error>&& nel::move<nel::Result<U8Buf<256ul>, Error> >(nel::Result<U8Buf<256ul>, Error>&)>
+    1890:	       48 89 c2             	mov    %rax,%rdx
+    1893:	       48 8d 85 90 fc ff ff 	lea    -0x370(%rbp),%rax
+    189a:	       48 89 d6             	mov    %rdx,%rsi
+    189d:	       48 89 c7             	mov    %rax,%rdi
+    18a0:	       e8 d5 05 00 00       	call   1e7a <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)>
+    18a5:	       48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    18a9:	       b9 60 00 00 00       	mov    $0x60,%ecx
+    18ae:	       48 8d 15 9b 27 00 00 	lea    0x279b(%rip),%rdx        # 4050 <nel::None+0x2>
+    18b5:	       48 8d 35 09 28 00 00 	lea    0x2809(%rip),%rsi        # 40c5 <nel::None+0x77>
+    18bc:	       48 89 c7             	mov    %rax,%rdi
+    18bf:	       e8 3c 04 00 00       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    18c4:	       48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+    18c8:	       48 8d 85 90 fc ff ff 	lea    -0x370(%rbp),%rax
+    18cf:	       48 89 d6             	mov    %rdx,%rsi
+    18d2:	       48 89 c7             	mov    %rax,%rdi
+    18d5:	       e8 2e 0c 00 00       	call   2508 <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const>
+    18da:	       84 c0                	test   %al,%al
+    18dc:	   /-- 74 20                	je     18fe <passfail33()+0x9f>
+    18de:	   |   48 8d 95 90 fc ff ff 	lea    -0x370(%rbp),%rdx
+    18e5:	   |   48 8b 85 88 fc ff ff 	mov    -0x378(%rbp),%rax
+    18ec:	   |   48 89 d6             	mov    %rdx,%rsi
+    18ef:	   |   48 89 c7             	mov    %rax,%rdi
+    18f2:	   |   e8 83 05 00 00       	call   1e7a <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)>
+    18f7:	   |   bb 00 00 00 00       	mov    $0x0,%ebx
+    18fc:	/--|-- eb 41                	jmp    193f <passfail33()+0xe0>
+    18fe:	|  \-> 48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1902:	|      b9 60 00 00 00       	mov    $0x60,%ecx
+    1907:	|      48 8d 15 42 27 00 00 	lea    0x2742(%rip),%rdx        # 4050 <nel::None+0x2>
+    190e:	|      48 8d 35 b0 27 00 00 	lea    0x27b0(%rip),%rsi        # 40c5 <nel::None+0x77>
+    1915:	|      48 89 c7             	mov    %rax,%rdi
+    1918:	|      e8 e3 03 00 00       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    191d:	|      48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    1924:	|      48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+    1928:	|      48 8d 8d 90 fc ff ff 	lea    -0x370(%rbp),%rcx
+    192f:	|      48 89 ce             	mov    %rcx,%rsi
+    1932:	|      48 89 c7             	mov    %rax,%rdi
+    1935:	|      e8 a4 06 00 00       	call   1fde <nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)>
+    193a:	|      bb 01 00 00 00       	mov    $0x1,%ebx
+    193f:	\----> 48 8d 85 90 fc ff ff 	lea    -0x370(%rbp),%rax
+    1946:	       48 89 c7             	mov    %rax,%rdi
+    1949:	       e8 6c 09 00 00       	call   22ba <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    194e:	       83 fb 01             	cmp    $0x1,%ebx
+    1951:	   /-- 75 2a                	jne    197d <passfail33()+0x11e>
+    1953:	   |   90                   	nop
+    1954:	   |   48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    195b:	   |   48 89 c7             	mov    %rax,%rdi
+    195e:	   |   e8 d7 09 00 00       	call   233a <U8Buf<256ul>::~U8Buf()>
+    return Result_t::Ok((uint8_t)0x43);
+    1963:	   |   c6 45 ef 43          	movb   $0x43,-0x11(%rbp)
+    1967:	   |   48 8b 85 88 fc ff ff 	mov    -0x378(%rbp),%rax
+    196e:	   |   48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+    1972:	   |   48 89 d6             	mov    %rdx,%rsi
+    1975:	   |   48 89 c7             	mov    %rax,%rdi
+    1978:	   |   e8 42 0a 00 00       	call   23bf <nel::Result<U8Buf<256ul>, Error> nel::Result<U8Buf<256ul>, Error>::Ok<unsigned char>(unsigned char&&)>
+}
+    197d:	   \-> 48 8d 85 a0 fd ff ff 	lea    -0x260(%rbp),%rax
+    1984:	       48 89 c7             	mov    %rax,%rdi
+    1987:	       e8 2e 09 00 00       	call   22ba <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    198c:	       48 8b 85 88 fc ff ff 	mov    -0x378(%rbp),%rax
+    1993:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1997:	       c9                   	leave
+    1998:	       c3                   	ret
+
+0000000000001999 <handleok1()>:
+
+void handleok1(void)
+{
+    1999:	    55                   	push   %rbp
+    199a:	    48 89 e5             	mov    %rsp,%rbp
+    199d:	    48 81 ec 50 02 00 00 	sub    $0x250,%rsp
+    Result_t res = ok3();
+    19a4:	    48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    19ab:	    48 89 c7             	mov    %rax,%rdi
+    19ae:	    e8 93 f9 ff ff       	call   1346 <ok3()>
+    if (res.is_ok()) {
+    19b3:	    48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    19b7:	    b9 67 00 00 00       	mov    $0x67,%ecx
+    19bc:	    48 8d 15 8d 26 00 00 	lea    0x268d(%rip),%rdx        # 4050 <nel::None+0x2>
+    19c3:	    48 8d 35 1f 27 00 00 	lea    0x271f(%rip),%rsi        # 40e9 <nel::None+0x9b>
+    19ca:	    48 89 c7             	mov    %rax,%rdi
+    19cd:	    e8 2e 03 00 00       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    19d2:	    48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    19d6:	    48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    19dd:	    48 89 d6             	mov    %rdx,%rsi
+    19e0:	    48 89 c7             	mov    %rax,%rdi
+    19e3:	    e8 ce 0a 00 00       	call   24b6 <nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const>
+    19e8:	    84 c0                	test   %al,%al
+    19ea:	/-- 74 71                	je     1a5d <handleok1()+0xc4>
+        U8Buf<256> v = res.unwrap();
+    19ec:	|   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    19f0:	|   b9 68 00 00 00       	mov    $0x68,%ecx
+    19f5:	|   48 8d 15 54 26 00 00 	lea    0x2654(%rip),%rdx        # 4050 <nel::None+0x2>
+    19fc:	|   48 8d 35 e6 26 00 00 	lea    0x26e6(%rip),%rsi        # 40e9 <nel::None+0x9b>
+    1a03:	|   48 89 c7             	mov    %rax,%rdi
+    1a06:	|   e8 f5 02 00 00       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    1a0b:	|   48 8d 85 b0 fd ff ff 	lea    -0x250(%rbp),%rax
+    1a12:	|   48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1a16:	|   48 8d 8d b0 fe ff ff 	lea    -0x150(%rbp),%rcx
+    1a1d:	|   48 89 ce             	mov    %rcx,%rsi
+    1a20:	|   48 89 c7             	mov    %rax,%rdi
+    1a23:	|   e8 b6 05 00 00       	call   1fde <nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)>
+        nel::log << v << '\n';
+    1a28:	|   48 8d 85 b0 fd ff ff 	lea    -0x250(%rbp),%rax
+    1a2f:	|   48 89 c6             	mov    %rax,%rsi
+    1a32:	|   48 8d 05 30 56 00 00 	lea    0x5630(%rip),%rax        # 7069 <nel::log>
+    1a39:	|   48 89 c7             	mov    %rax,%rdi
+    1a3c:	|   e8 89 0b 00 00       	call   25ca <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    1a41:	|   be 0a 00 00 00       	mov    $0xa,%esi
+    1a46:	|   48 89 c7             	mov    %rax,%rdi
+    1a49:	|   e8 81 1a 00 00       	call   34cf <nel::operator<<(nel::Log&, char)>
+    }
+    1a4e:	|   48 8d 85 b0 fd ff ff 	lea    -0x250(%rbp),%rax
+    1a55:	|   48 89 c7             	mov    %rax,%rdi
+    1a58:	|   e8 dd 08 00 00       	call   233a <U8Buf<256ul>::~U8Buf()>
+}
+    1a5d:	\-> 48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    1a64:	    48 89 c7             	mov    %rax,%rdi
+    1a67:	    e8 4e 08 00 00       	call   22ba <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    1a6c:	    c9                   	leave
+    1a6d:	    c3                   	ret
+
+0000000000001a6e <handleok2()>:
+
+void handleok2(void)
+{
+    1a6e:	    55                   	push   %rbp
+    1a6f:	    48 89 e5             	mov    %rsp,%rbp
+    1a72:	    48 81 ec 70 01 00 00 	sub    $0x170,%rsp
+    Result_t res = ok3();
+    1a79:	    48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    1a80:	    48 89 c7             	mov    %rax,%rdi
+    1a83:	    e8 be f8 ff ff       	call   1346 <ok3()>
+    if (res.is_err()) {
+    1a88:	    48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1a8c:	    b9 70 00 00 00       	mov    $0x70,%ecx
+    1a91:	    48 8d 15 b8 25 00 00 	lea    0x25b8(%rip),%rdx        # 4050 <nel::None+0x2>
+    1a98:	    48 8d 35 5f 26 00 00 	lea    0x265f(%rip),%rsi        # 40fe <nel::None+0xb0>
+    1a9f:	    48 89 c7             	mov    %rax,%rdi
+    1aa2:	    e8 59 02 00 00       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    1aa7:	    48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    1aab:	    48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    1ab2:	    48 89 d6             	mov    %rdx,%rsi
+    1ab5:	    48 89 c7             	mov    %rax,%rdi
+    1ab8:	    e8 4b 0a 00 00       	call   2508 <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const>
+    1abd:	    84 c0                	test   %al,%al
+    1abf:	/-- 74 62                	je     1b23 <handleok2()+0xb5>
+        Error v = res.unwrap_err();
+    1ac1:	|   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1ac5:	|   b9 71 00 00 00       	mov    $0x71,%ecx
+    1aca:	|   48 8d 15 7f 25 00 00 	lea    0x257f(%rip),%rdx        # 4050 <nel::None+0x2>
+    1ad1:	|   48 8d 35 26 26 00 00 	lea    0x2626(%rip),%rsi        # 40fe <nel::None+0xb0>
+    1ad8:	|   48 89 c7             	mov    %rax,%rdi
+    1adb:	|   e8 20 02 00 00       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    1ae0:	|   48 8d 85 90 fe ff ff 	lea    -0x170(%rbp),%rax
+    1ae7:	|   48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1aeb:	|   48 8d 8d b0 fe ff ff 	lea    -0x150(%rbp),%rcx
+    1af2:	|   48 89 ce             	mov    %rcx,%rsi
+    1af5:	|   48 89 c7             	mov    %rax,%rdi
+    1af8:	|   e8 63 06 00 00       	call   2160 <nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)>
+        nel::log << v << '\n';
+    1afd:	|   48 8d 85 90 fe ff ff 	lea    -0x170(%rbp),%rax
+    1b04:	|   48 89 c6             	mov    %rax,%rsi
+    1b07:	|   48 8d 05 5b 55 00 00 	lea    0x555b(%rip),%rax        # 7069 <nel::log>
+    1b0e:	|   48 89 c7             	mov    %rax,%rdi
+    1b11:	|   e8 5d 02 00 00       	call   1d73 <operator<<(nel::Log&, Error const&)>
+    1b16:	|   be 0a 00 00 00       	mov    $0xa,%esi
+    1b1b:	|   48 89 c7             	mov    %rax,%rdi
+    1b1e:	|   e8 ac 19 00 00       	call   34cf <nel::operator<<(nel::Log&, char)>
+    }
+}
+    1b23:	\-> 48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    1b2a:	    48 89 c7             	mov    %rax,%rdi
+    1b2d:	    e8 88 07 00 00       	call   22ba <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    1b32:	    c9                   	leave
+    1b33:	    c3                   	ret
+
+0000000000001b34 <handlefail1()>:
+
+void handlefail1(void)
+{
+    1b34:	    55                   	push   %rbp
+    1b35:	    48 89 e5             	mov    %rsp,%rbp
+    1b38:	    48 81 ec 50 02 00 00 	sub    $0x250,%rsp
+    Result_t res = fail4();
+    1b3f:	    48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    1b46:	    48 89 c7             	mov    %rax,%rdi
+    1b49:	    e8 c1 f8 ff ff       	call   140f <fail4()>
+    if (res.is_ok()) {
+    1b4e:	    48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1b52:	    b9 79 00 00 00       	mov    $0x79,%ecx
+    1b57:	    48 8d 15 f2 24 00 00 	lea    0x24f2(%rip),%rdx        # 4050 <nel::None+0x2>
+    1b5e:	    48 8d 35 a3 25 00 00 	lea    0x25a3(%rip),%rsi        # 4108 <nel::None+0xba>
+    1b65:	    48 89 c7             	mov    %rax,%rdi
+    1b68:	    e8 93 01 00 00       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    1b6d:	    48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    1b71:	    48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    1b78:	    48 89 d6             	mov    %rdx,%rsi
+    1b7b:	    48 89 c7             	mov    %rax,%rdi
+    1b7e:	    e8 33 09 00 00       	call   24b6 <nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const>
+    1b83:	    84 c0                	test   %al,%al
+    1b85:	/-- 74 71                	je     1bf8 <handlefail1()+0xc4>
+        U8Buf<256> v = res.unwrap();
+    1b87:	|   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1b8b:	|   b9 7a 00 00 00       	mov    $0x7a,%ecx
+    1b90:	|   48 8d 15 b9 24 00 00 	lea    0x24b9(%rip),%rdx        # 4050 <nel::None+0x2>
+    1b97:	|   48 8d 35 6a 25 00 00 	lea    0x256a(%rip),%rsi        # 4108 <nel::None+0xba>
+    1b9e:	|   48 89 c7             	mov    %rax,%rdi
+    1ba1:	|   e8 5a 01 00 00       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    1ba6:	|   48 8d 85 b0 fd ff ff 	lea    -0x250(%rbp),%rax
+    1bad:	|   48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1bb1:	|   48 8d 8d b0 fe ff ff 	lea    -0x150(%rbp),%rcx
+    1bb8:	|   48 89 ce             	mov    %rcx,%rsi
+    1bbb:	|   48 89 c7             	mov    %rax,%rdi
+    1bbe:	|   e8 1b 04 00 00       	call   1fde <nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)>
+        nel::log << v << '\n';
+    1bc3:	|   48 8d 85 b0 fd ff ff 	lea    -0x250(%rbp),%rax
+    1bca:	|   48 89 c6             	mov    %rax,%rsi
+    1bcd:	|   48 8d 05 95 54 00 00 	lea    0x5495(%rip),%rax        # 7069 <nel::log>
+    1bd4:	|   48 89 c7             	mov    %rax,%rdi
+    1bd7:	|   e8 ee 09 00 00       	call   25ca <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    1bdc:	|   be 0a 00 00 00       	mov    $0xa,%esi
+    1be1:	|   48 89 c7             	mov    %rax,%rdi
+    1be4:	|   e8 e6 18 00 00       	call   34cf <nel::operator<<(nel::Log&, char)>
+    }
+    1be9:	|   48 8d 85 b0 fd ff ff 	lea    -0x250(%rbp),%rax
+    1bf0:	|   48 89 c7             	mov    %rax,%rdi
+    1bf3:	|   e8 42 07 00 00       	call   233a <U8Buf<256ul>::~U8Buf()>
+}
+    1bf8:	\-> 48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    1bff:	    48 89 c7             	mov    %rax,%rdi
+    1c02:	    e8 b3 06 00 00       	call   22ba <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    1c07:	    c9                   	leave
+    1c08:	    c3                   	ret
+
+0000000000001c09 <handlefail2()>:
+
+void handlefail2(void)
+{
+    1c09:	    55                   	push   %rbp
+    1c0a:	    48 89 e5             	mov    %rsp,%rbp
+    1c0d:	    48 81 ec 70 01 00 00 	sub    $0x170,%rsp
+    Result_t res = fail4();
+    1c14:	    48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    1c1b:	    48 89 c7             	mov    %rax,%rdi
+    1c1e:	    e8 ec f7 ff ff       	call   140f <fail4()>
+    if (res.is_err()) {
+    1c23:	    48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    1c27:	    b9 82 00 00 00       	mov    $0x82,%ecx
+    1c2c:	    48 8d 15 1d 24 00 00 	lea    0x241d(%rip),%rdx        # 4050 <nel::None+0x2>
+    1c33:	    48 8d 35 da 24 00 00 	lea    0x24da(%rip),%rsi        # 4114 <nel::None+0xc6>
+    1c3a:	    48 89 c7             	mov    %rax,%rdi
+    1c3d:	    e8 be 00 00 00       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    1c42:	    48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    1c46:	    48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    1c4d:	    48 89 d6             	mov    %rdx,%rsi
+    1c50:	    48 89 c7             	mov    %rax,%rdi
+    1c53:	    e8 b0 08 00 00       	call   2508 <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const>
+    1c58:	    84 c0                	test   %al,%al
+    1c5a:	/-- 74 62                	je     1cbe <handlefail2()+0xb5>
+        Error v = res.unwrap_err();
+    1c5c:	|   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1c60:	|   b9 83 00 00 00       	mov    $0x83,%ecx
+    1c65:	|   48 8d 15 e4 23 00 00 	lea    0x23e4(%rip),%rdx        # 4050 <nel::None+0x2>
+    1c6c:	|   48 8d 35 a1 24 00 00 	lea    0x24a1(%rip),%rsi        # 4114 <nel::None+0xc6>
+    1c73:	|   48 89 c7             	mov    %rax,%rdi
+    1c76:	|   e8 85 00 00 00       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    1c7b:	|   48 8d 85 90 fe ff ff 	lea    -0x170(%rbp),%rax
+    1c82:	|   48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1c86:	|   48 8d 8d b0 fe ff ff 	lea    -0x150(%rbp),%rcx
+    1c8d:	|   48 89 ce             	mov    %rcx,%rsi
+    1c90:	|   48 89 c7             	mov    %rax,%rdi
+    1c93:	|   e8 c8 04 00 00       	call   2160 <nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)>
+        nel::log << v << '\n';
+    1c98:	|   48 8d 85 90 fe ff ff 	lea    -0x170(%rbp),%rax
+    1c9f:	|   48 89 c6             	mov    %rax,%rsi
+    1ca2:	|   48 8d 05 c0 53 00 00 	lea    0x53c0(%rip),%rax        # 7069 <nel::log>
+    1ca9:	|   48 89 c7             	mov    %rax,%rdi
+    1cac:	|   e8 c2 00 00 00       	call   1d73 <operator<<(nel::Log&, Error const&)>
+    1cb1:	|   be 0a 00 00 00       	mov    $0xa,%esi
+    1cb6:	|   48 89 c7             	mov    %rax,%rdi
+    1cb9:	|   e8 11 18 00 00       	call   34cf <nel::operator<<(nel::Log&, char)>
+    }
+}
+    1cbe:	\-> 48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    1cc5:	    48 89 c7             	mov    %rax,%rdi
+    1cc8:	    e8 ed 05 00 00       	call   22ba <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    1ccd:	    c9                   	leave
+    1cce:	    c3                   	ret
+
+0000000000001ccf <main>:
+
+int main()
+{
+    1ccf:	55                   	push   %rbp
+    1cd0:	48 89 e5             	mov    %rsp,%rbp
+    handleok1();
+    1cd3:	e8 c1 fc ff ff       	call   1999 <handleok1()>
+    handlefail1();
+    1cd8:	e8 57 fe ff ff       	call   1b34 <handlefail1()>
+    handleok2();
+    1cdd:	e8 8c fd ff ff       	call   1a6e <handleok2()>
+    handlefail2();
+    1ce2:	e8 22 ff ff ff       	call   1c09 <handlefail2()>
+}
+    1ce7:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cec:	5d                   	pop    %rbp
+    1ced:	c3                   	ret
+
+0000000000001cee <operator new(unsigned long, void*)>:
+
+    1cee:	55                   	push   %rbp
+    1cef:	48 89 e5             	mov    %rsp,%rbp
+    1cf2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1cf6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+Result_t NEL_WARN_UNUSED_RESULT ok1(void)
+    1cfa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+{
+    1cfe:	5d                   	pop    %rbp
+    1cff:	c3                   	ret
+
+0000000000001d00 <nel::Context::Context(char const*, char const*, int)>:
+        char const *fn_name_;
+        char const *file_name_;
+        int line_num_;
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+    1d00:	55                   	push   %rbp
+    1d01:	48 89 e5             	mov    %rsp,%rbp
+    1d04:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1d08:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1d0c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1d10:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1d13:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d17:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1d1b:	48 89 10             	mov    %rdx,(%rax)
+            , file_name_(file_name)
+    1d1e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d22:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1d26:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , line_num_(line_num)
+    1d2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d2e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1d31:	89 50 10             	mov    %edx,0x10(%rax)
+        {
+        }
+    1d34:	90                   	nop
+    1d35:	5d                   	pop    %rbp
+    1d36:	c3                   	ret
+    1d37:	90                   	nop
+
+0000000000001d38 <Error::Error(ErrorCode const&, char const*, unsigned long)>:
+        ErrorCode code; // offset:0, size:4 fsize:4
+        Lineno lineno; // offset:4, size:4 fsize:2
+        const char *filename; // offset:8, size:8 fsize:8
+
+    public:
+        constexpr Error(ErrorCode const &code, char const *filename, Lineno const line)
+    1d38:	55                   	push   %rbp
+    1d39:	48 89 e5             	mov    %rsp,%rbp
+    1d3c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1d40:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1d44:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1d48:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            : code(code)
+    1d4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d50:	8b 10                	mov    (%rax),%edx
+    1d52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d56:	89 10                	mov    %edx,(%rax)
+            , lineno(line)
+    1d58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d5c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1d60:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , filename(filename)
+    1d64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d68:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1d6c:	48 89 50 10          	mov    %rdx,0x10(%rax)
+        {
+        }
+    1d70:	90                   	nop
+    1d71:	5d                   	pop    %rbp
+    1d72:	c3                   	ret
+
+0000000000001d73 <operator<<(nel::Log&, Error const&)>:
+
+    public:
+        // friend std::ostream &operator<<(std::ostream &outs, Error const &val) {
+        friend nel::Log &operator<<(nel::Log &outs, Error const &val)
+    1d73:	55                   	push   %rbp
+    1d74:	48 89 e5             	mov    %rsp,%rbp
+    1d77:	48 83 ec 10          	sub    $0x10,%rsp
+    1d7b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1d7f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            outs << "Error(" << static_cast<int>(val.code) << "=" << val.code << ")";
+    1d83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d87:	48 8d 15 b1 22 00 00 	lea    0x22b1(%rip),%rdx        # 403f <nel::elem::poisoning+0x37>
+    1d8e:	48 89 d6             	mov    %rdx,%rsi
+    1d91:	48 89 c7             	mov    %rax,%rdi
+    1d94:	e8 62 17 00 00       	call   34fb <nel::operator<<(nel::Log&, char const*)>
+    1d99:	48 89 c2             	mov    %rax,%rdx
+    1d9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1da0:	8b 00                	mov    (%rax),%eax
+    1da2:	89 c6                	mov    %eax,%esi
+    1da4:	48 89 d7             	mov    %rdx,%rdi
+    1da7:	e8 24 18 00 00       	call   35d0 <nel::operator<<(nel::Log&, int)>
+    1dac:	48 89 c2             	mov    %rax,%rdx
+    1daf:	48 8d 05 90 22 00 00 	lea    0x2290(%rip),%rax        # 4046 <nel::elem::poisoning+0x3e>
+    1db6:	48 89 c6             	mov    %rax,%rsi
+    1db9:	48 89 d7             	mov    %rdx,%rdi
+    1dbc:	e8 3a 17 00 00       	call   34fb <nel::operator<<(nel::Log&, char const*)>
+    1dc1:	48 89 c2             	mov    %rax,%rdx
+    1dc4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1dc8:	48 89 c6             	mov    %rax,%rsi
+    1dcb:	48 89 d7             	mov    %rdx,%rdi
+    1dce:	e8 f6 f3 ff ff       	call   11c9 <operator<<(nel::Log&, ErrorCode const&)>
+    1dd3:	48 89 c2             	mov    %rax,%rdx
+    1dd6:	48 8d 05 6b 22 00 00 	lea    0x226b(%rip),%rax        # 4048 <nel::elem::poisoning+0x40>
+    1ddd:	48 89 c6             	mov    %rax,%rsi
+    1de0:	48 89 d7             	mov    %rdx,%rdi
+    1de3:	e8 13 17 00 00       	call   34fb <nel::operator<<(nel::Log&, char const*)>
+            outs << "@" << val.filename << ":" << val.lineno;
+    1de8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dec:	48 8d 15 57 22 00 00 	lea    0x2257(%rip),%rdx        # 404a <nel::elem::poisoning+0x42>
+    1df3:	48 89 d6             	mov    %rdx,%rsi
+    1df6:	48 89 c7             	mov    %rax,%rdi
+    1df9:	e8 fd 16 00 00       	call   34fb <nel::operator<<(nel::Log&, char const*)>
+    1dfe:	48 89 c2             	mov    %rax,%rdx
+    1e01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e05:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1e09:	48 89 c6             	mov    %rax,%rsi
+    1e0c:	48 89 d7             	mov    %rdx,%rdi
+    1e0f:	e8 e7 16 00 00       	call   34fb <nel::operator<<(nel::Log&, char const*)>
+    1e14:	48 89 c2             	mov    %rax,%rdx
+    1e17:	48 8d 05 2e 22 00 00 	lea    0x222e(%rip),%rax        # 404c <nel::elem::poisoning+0x44>
+    1e1e:	48 89 c6             	mov    %rax,%rsi
+    1e21:	48 89 d7             	mov    %rdx,%rdi
+    1e24:	e8 d2 16 00 00       	call   34fb <nel::operator<<(nel::Log&, char const*)>
+    1e29:	48 89 c2             	mov    %rax,%rdx
+    1e2c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e30:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1e34:	48 89 c6             	mov    %rax,%rsi
+    1e37:	48 89 d7             	mov    %rdx,%rdi
+    1e3a:	e8 c7 17 00 00       	call   3606 <nel::operator<<(nel::Log&, unsigned long)>
+            return outs;
+    1e3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1e43:	c9                   	leave
+    1e44:	c3                   	ret
+
+0000000000001e45 <nel::Result<U8Buf<256ul>, Error>&& nel::move<nel::Result<U8Buf<256ul>, Error> >(nel::Result<U8Buf<256ul>, Error>&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel is to not need std.
+ */
+template<typename T>
+constexpr T &&move(T &v)
+    1e45:	55                   	push   %rbp
+    1e46:	48 89 e5             	mov    %rsp,%rbp
+    1e49:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<T &&>(v);
+    1e4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1e51:	5d                   	pop    %rbp
+    1e52:	c3                   	ret
+    1e53:	90                   	nop
+
+0000000000001e54 <nel::Element<U8Buf<256ul> >::Element(nel::Element<U8Buf<256ul> >&&)>:
+        constexpr Element(void) = default;
+
+        constexpr Element(Element const &) = delete;
+        constexpr Element &operator=(Element const &) const = delete;
+
+        constexpr Element(Element &&o) = default;
+    1e54:	55                   	push   %rbp
+    1e55:	48 89 e5             	mov    %rsp,%rbp
+    1e58:	48 83 ec 10          	sub    $0x10,%rsp
+    1e5c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1e60:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1e64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e68:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1e6c:	48 89 d6             	mov    %rdx,%rsi
+    1e6f:	48 89 c7             	mov    %rax,%rdi
+    1e72:	e8 c9 06 00 00       	call   2540 <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>
+    1e77:	90                   	nop
+    1e78:	c9                   	leave
+    1e79:	c3                   	ret
+
+0000000000001e7a <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)>:
+                    nel::panic("bad Result");
+                    break;
+            }
+        }
+
+        constexpr Result(Result &&o)
+    1e7a:	             55                   	push   %rbp
+    1e7b:	             48 89 e5             	mov    %rsp,%rbp
+    1e7e:	             53                   	push   %rbx
+    1e7f:	             48 83 ec 38          	sub    $0x38,%rsp
+    1e83:	             48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    1e87:	             48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+        {
+            tag_ = o.tag_;
+    1e8b:	             48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1e8f:	             8b 10                	mov    (%rax),%edx
+    1e91:	             48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1e95:	             89 10                	mov    %edx,(%rax)
+            o.tag_ = Tag::INVAL;
+    1e97:	             48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1e9b:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+            switch (tag_) { // result::move-ctor
+    1ea1:	             48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1ea5:	             8b 00                	mov    (%rax),%eax
+    1ea7:	             83 f8 02             	cmp    $0x2,%eax
+    1eaa:	         /-- 74 4b                	je     1ef7 <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)+0x7d>
+    1eac:	         |   83 f8 02             	cmp    $0x2,%eax
+    1eaf:	   /-----|-- 0f 8f 85 00 00 00    	jg     1f3a <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)+0xc0>
+    1eb5:	   |     |   85 c0                	test   %eax,%eax
+    1eb7:	/--|-----|-- 0f 84 b2 00 00 00    	je     1f6f <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)+0xf5>
+    1ebd:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    1ec0:	|  +-----|-- 75 78                	jne    1f3a <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)+0xc0>
+                case Tag::OK:
+                    new (&ok_) Element<T>(forward<Element<T>>(o.ok_));
+    1ec2:	|  |     |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1ec6:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    1eca:	|  |     |   48 89 c6             	mov    %rax,%rsi
+    1ecd:	|  |     |   bf 00 01 00 00       	mov    $0x100,%edi
+    1ed2:	|  |     |   e8 17 fe ff ff       	call   1cee <operator new(unsigned long, void*)>
+    1ed7:	|  |     |   48 89 c3             	mov    %rax,%rbx
+    1eda:	|  |     |   48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1ede:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    1ee2:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    1ee5:	|  |     |   e8 48 06 00 00       	call   2532 <nel::Element<U8Buf<256ul> >&& nel::forward<nel::Element<U8Buf<256ul> >, nel::Element<U8Buf<256ul> > >(nel::Element<U8Buf<256ul> >&)>
+    1eea:	|  |     |   48 89 c6             	mov    %rax,%rsi
+    1eed:	|  |     |   48 89 df             	mov    %rbx,%rdi
+    1ef0:	|  |     |   e8 5f ff ff ff       	call   1e54 <nel::Element<U8Buf<256ul> >::Element(nel::Element<U8Buf<256ul> >&&)>
+                    break;
+    1ef5:	|  |  /--|-- eb 79                	jmp    1f70 <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)+0xf6>
+
+                case Tag::ERR:
+                    new (&err_) Element<E>(forward<Element<E>>(o.err_));
+    1ef7:	|  |  |  \-> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1efb:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    1eff:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    1f02:	|  |  |      bf 18 00 00 00       	mov    $0x18,%edi
+    1f07:	|  |  |      e8 e2 fd ff ff       	call   1cee <operator new(unsigned long, void*)>
+    1f0c:	|  |  |      48 89 c3             	mov    %rax,%rbx
+    1f0f:	|  |  |      48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1f13:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    1f17:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1f1a:	|  |  |      e8 4c 06 00 00       	call   256b <nel::Element<Error>&& nel::forward<nel::Element<Error>, nel::Element<Error> >(nel::Element<Error>&)>
+    1f1f:	|  |  |      48 89 c1             	mov    %rax,%rcx
+    1f22:	|  |  |      48 8b 01             	mov    (%rcx),%rax
+    1f25:	|  |  |      48 8b 51 08          	mov    0x8(%rcx),%rdx
+    1f29:	|  |  |      48 89 03             	mov    %rax,(%rbx)
+    1f2c:	|  |  |      48 89 53 08          	mov    %rdx,0x8(%rbx)
+    1f30:	|  |  |      48 8b 41 10          	mov    0x10(%rcx),%rax
+    1f34:	|  |  |      48 89 43 10          	mov    %rax,0x10(%rbx)
+                    break;
+    1f38:	|  |  +----- eb 36                	jmp    1f70 <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)+0xf6>
+                    // yes, since it may have contained one or the others..
+                    // if memory hardware is assumed to be incorruptable then can ignore ? (buffer
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob.
+                    nel::panic("bad Result");
+    1f3a:	|  \--|----> 48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1f3e:	|     |      b9 92 00 00 00       	mov    $0x92,%ecx
+    1f43:	|     |      48 8d 15 4e 21 00 00 	lea    0x214e(%rip),%rdx        # 4098 <nel::None+0x4a>
+    1f4a:	|     |      48 8d 35 59 21 00 00 	lea    0x2159(%rip),%rsi        # 40aa <nel::None+0x5c>
+    1f51:	|     |      48 89 c7             	mov    %rax,%rdi
+    1f54:	|     |      e8 a7 fd ff ff       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    1f59:	|     |      48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1f5d:	|     |      48 89 c6             	mov    %rax,%rsi
+    1f60:	|     |      48 8d 05 4a 21 00 00 	lea    0x214a(%rip),%rax        # 40b1 <nel::None+0x63>
+    1f67:	|     |      48 89 c7             	mov    %rax,%rdi
+    1f6a:	|     |      e8 54 0c 00 00       	call   2bc3 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    1f6f:	\-----|----> 90                   	nop
+                    break;
+            }
+        }
+    1f70:	      \----> 90                   	nop
+    1f71:	             48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1f75:	             c9                   	leave
+    1f76:	             c3                   	ret
+    1f77:	             90                   	nop
+
+0000000000001f78 <nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}::operator()(U8Buf<256ul>&&) const>:
+         *
+         * `this` is consumed by the operation.
+         */
+        constexpr T unwrap(Context const &ctx = Context())
+        {
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    1f78:	55                   	push   %rbp
+    1f79:	48 89 e5             	mov    %rsp,%rbp
+    1f7c:	48 83 ec 20          	sub    $0x20,%rsp
+    1f80:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f84:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1f88:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1f8c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f90:	48 89 c7             	mov    %rax,%rdi
+    1f93:	e8 e1 05 00 00       	call   2579 <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    1f98:	48 89 c2             	mov    %rax,%rdx
+    1f9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f9f:	48 89 d6             	mov    %rdx,%rsi
+    1fa2:	48 89 c7             	mov    %rax,%rdi
+    1fa5:	e8 96 05 00 00       	call   2540 <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>
+    1faa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fae:	c9                   	leave
+    1faf:	c3                   	ret
+
+0000000000001fb0 <nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(Error&&)#2}::operator()(Error&&) const>:
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    1fb0:	55                   	push   %rbp
+    1fb1:	48 89 e5             	mov    %rsp,%rbp
+    1fb4:	48 83 ec 20          	sub    $0x20,%rsp
+    1fb8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1fbc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1fc0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1fc4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1fc8:	48 8b 00             	mov    (%rax),%rax
+    1fcb:	48 89 c6             	mov    %rax,%rsi
+    1fce:	48 8d 05 fb 20 00 00 	lea    0x20fb(%rip),%rax        # 40d0 <nel::None+0x82>
+    1fd5:	48 89 c7             	mov    %rax,%rdi
+    1fd8:	e8 e6 0b 00 00       	call   2bc3 <nel::panic(char const*, nel::Context const&)>
+    1fdd:	90                   	nop
+
+0000000000001fde <nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)>:
+        constexpr T unwrap(Context const &ctx = Context())
+    1fde:	55                   	push   %rbp
+    1fdf:	48 89 e5             	mov    %rsp,%rbp
+    1fe2:	48 83 ec 30          	sub    $0x30,%rsp
+    1fe6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1fea:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1fee:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    1ff2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1ff6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+                              ctx);
+    1ffa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ffe:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+    2002:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+    2006:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    200a:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+    200e:	49 89 f8             	mov    %rdi,%r8
+    2011:	48 89 c7             	mov    %rax,%rdi
+    2014:	e8 07 00 00 00       	call   2020 <U8Buf<256ul> nel::Result<U8Buf<256ul>, Error>::consume<U8Buf<256ul>, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(Error&&)#2}>(nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}&&, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(Error&&)#2}&&, nel::Context const&)>
+        }
+    2019:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    201d:	c9                   	leave
+    201e:	c3                   	ret
+    201f:	90                   	nop
+
+0000000000002020 <U8Buf<256ul> nel::Result<U8Buf<256ul>, Error>::consume<U8Buf<256ul>, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(Error&&)#2}>(nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}&&, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(Error&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    2020:	             55                   	push   %rbp
+    2021:	             48 89 e5             	mov    %rsp,%rbp
+    2024:	             48 83 ec 40          	sub    $0x40,%rsp
+    2028:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    202c:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2030:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    2034:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    2038:	             4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+            auto tag = tag_;
+    203c:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2040:	             8b 00                	mov    (%rax),%eax
+    2042:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    2045:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2049:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    204f:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    2053:	         /-- 74 46                	je     209b <U8Buf<256ul> nel::Result<U8Buf<256ul>, Error>::consume<U8Buf<256ul>, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(Error&&)#2}>(nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}&&, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(Error&&)#2}&&, nel::Context const&)+0x7b>
+    2055:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    2059:	/--------|-- 0f 8f 82 00 00 00    	jg     20e1 <U8Buf<256ul> nel::Result<U8Buf<256ul>, Error>::consume<U8Buf<256ul>, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(Error&&)#2}>(nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}&&, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(Error&&)#2}&&, nel::Context const&)+0xc1>
+    205f:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2063:	|  /-----|-- 74 66                	je     20cb <U8Buf<256ul> nel::Result<U8Buf<256ul>, Error>::consume<U8Buf<256ul>, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(Error&&)#2}>(nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}&&, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(Error&&)#2}&&, nel::Context const&)+0xab>
+    2065:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    2069:	+--|-----|-- 75 76                	jne    20e1 <U8Buf<256ul> nel::Result<U8Buf<256ul>, Error>::consume<U8Buf<256ul>, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(Error&&)#2}>(nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}&&, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(Error&&)#2}&&, nel::Context const&)+0xc1>
+                    return on_ok(forward<T>(*ok_));
+    206b:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    206f:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    2073:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2076:	|  |     |   e8 0d 05 00 00       	call   2588 <nel::Element<U8Buf<256ul> >::operator*()>
+    207b:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    207e:	|  |     |   e8 f6 04 00 00       	call   2579 <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    2083:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    2086:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    208a:	|  |     |   48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+    208e:	|  |     |   48 89 ce             	mov    %rcx,%rsi
+    2091:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2094:	|  |     |   e8 df fe ff ff       	call   1f78 <nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}::operator()(U8Buf<256ul>&&) const>
+    2099:	|  |  /--|-- eb 5c                	jmp    20f7 <U8Buf<256ul> nel::Result<U8Buf<256ul>, Error>::consume<U8Buf<256ul>, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(Error&&)#2}>(nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}&&, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(Error&&)#2}&&, nel::Context const&)+0xd7>
+                    return on_err(forward<E>(*err_));
+    209b:	|  |  |  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    209f:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    20a3:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    20a6:	|  |  |      e8 f7 04 00 00       	call   25a2 <nel::Element<Error>::operator*()>
+    20ab:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    20ae:	|  |  |      e8 09 05 00 00       	call   25bc <Error&& nel::forward<Error, Error>(Error&)>
+    20b3:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    20b6:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20ba:	|  |  |      48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    20be:	|  |  |      48 89 ce             	mov    %rcx,%rsi
+    20c1:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    20c4:	|  |  |      e8 e7 fe ff ff       	call   1fb0 <nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(Error&&)#2}::operator()(Error&&) const>
+    20c9:	|  |  +----- eb 2c                	jmp    20f7 <U8Buf<256ul> nel::Result<U8Buf<256ul>, Error>::consume<U8Buf<256ul>, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(Error&&)#2}>(nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}&&, nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)::{lambda(Error&&)#2}&&, nel::Context const&)+0xd7>
+                    nel::panic("invalid Result", ctx);
+    20cb:	|  \--|----> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    20cf:	|     |      48 89 c6             	mov    %rax,%rsi
+    20d2:	|     |      48 8d 05 01 20 00 00 	lea    0x2001(%rip),%rax        # 40da <nel::None+0x8c>
+    20d9:	|     |      48 89 c7             	mov    %rax,%rdi
+    20dc:	|     |      e8 e2 0a 00 00       	call   2bc3 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    20e1:	\-----|----> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    20e5:	      |      48 89 c6             	mov    %rax,%rsi
+    20e8:	      |      48 8d 05 c2 1f 00 00 	lea    0x1fc2(%rip),%rax        # 40b1 <nel::None+0x63>
+    20ef:	      |      48 89 c7             	mov    %rax,%rdi
+    20f2:	      |      e8 cc 0a 00 00       	call   2bc3 <nel::panic(char const*, nel::Context const&)>
+        }
+    20f7:	      \----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20fb:	             c9                   	leave
+    20fc:	             c3                   	ret
+    20fd:	             90                   	nop
+
+00000000000020fe <nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}::operator()(U8Buf<256ul>&&) const>:
+         *
+         * this is consumed by the operation.
+         */
+        constexpr E unwrap_err(Context const &ctx = Context())
+        {
+            return consume<E>([&](T &&) -> E { nel::panic("not an err", ctx); },
+    20fe:	55                   	push   %rbp
+    20ff:	48 89 e5             	mov    %rsp,%rbp
+    2102:	48 83 ec 20          	sub    $0x20,%rsp
+    2106:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    210a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    210e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2112:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2116:	48 8b 00             	mov    (%rax),%rax
+    2119:	48 89 c6             	mov    %rax,%rsi
+    211c:	48 8d 05 d0 1f 00 00 	lea    0x1fd0(%rip),%rax        # 40f3 <nel::None+0xa5>
+    2123:	48 89 c7             	mov    %rax,%rdi
+    2126:	e8 98 0a 00 00       	call   2bc3 <nel::panic(char const*, nel::Context const&)>
+    212b:	90                   	nop
+
+000000000000212c <nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(Error&&)#2}::operator()(Error&&) const>:
+                              [](E &&err) -> E { return err; },
+    212c:	55                   	push   %rbp
+    212d:	48 89 e5             	mov    %rsp,%rbp
+    2130:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2134:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2138:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    213c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    2140:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    2144:	48 8b 06             	mov    (%rsi),%rax
+    2147:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    214b:	48 89 01             	mov    %rax,(%rcx)
+    214e:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+    2152:	48 8b 46 10          	mov    0x10(%rsi),%rax
+    2156:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    215a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    215e:	5d                   	pop    %rbp
+    215f:	c3                   	ret
+
+0000000000002160 <nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)>:
+        constexpr E unwrap_err(Context const &ctx = Context())
+    2160:	55                   	push   %rbp
+    2161:	48 89 e5             	mov    %rsp,%rbp
+    2164:	48 83 ec 30          	sub    $0x30,%rsp
+    2168:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    216c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2170:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            return consume<E>([&](T &&) -> E { nel::panic("not an err", ctx); },
+    2174:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2178:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    217c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2180:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+    2184:	48 8d 4d f7          	lea    -0x9(%rbp),%rcx
+    2188:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    218c:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+    2190:	49 89 f8             	mov    %rdi,%r8
+    2193:	48 89 c7             	mov    %rax,%rdi
+    2196:	e8 07 00 00 00       	call   21a2 <Error nel::Result<U8Buf<256ul>, Error>::consume<Error, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(Error&&)#2}>(nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}&&, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(Error&&)#2}&&, nel::Context const&)>
+                              ctx);
+    219b:	90                   	nop
+        }
+    219c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    21a0:	c9                   	leave
+    21a1:	c3                   	ret
+
+00000000000021a2 <Error nel::Result<U8Buf<256ul>, Error>::consume<Error, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(Error&&)#2}>(nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}&&, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(Error&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    21a2:	             55                   	push   %rbp
+    21a3:	             48 89 e5             	mov    %rsp,%rbp
+    21a6:	             48 83 ec 40          	sub    $0x40,%rsp
+    21aa:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    21ae:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    21b2:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    21b6:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    21ba:	             4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+            auto tag = tag_;
+    21be:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    21c2:	             8b 00                	mov    (%rax),%eax
+    21c4:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    21c7:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    21cb:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    21d1:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    21d5:	         /-- 74 46                	je     221d <Error nel::Result<U8Buf<256ul>, Error>::consume<Error, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(Error&&)#2}>(nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}&&, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(Error&&)#2}&&, nel::Context const&)+0x7b>
+    21d7:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    21db:	/--------|-- 0f 8f 82 00 00 00    	jg     2263 <Error nel::Result<U8Buf<256ul>, Error>::consume<Error, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(Error&&)#2}>(nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}&&, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(Error&&)#2}&&, nel::Context const&)+0xc1>
+    21e1:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    21e5:	|  /-----|-- 74 66                	je     224d <Error nel::Result<U8Buf<256ul>, Error>::consume<Error, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(Error&&)#2}>(nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}&&, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(Error&&)#2}&&, nel::Context const&)+0xab>
+    21e7:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    21eb:	+--|-----|-- 75 76                	jne    2263 <Error nel::Result<U8Buf<256ul>, Error>::consume<Error, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(Error&&)#2}>(nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}&&, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(Error&&)#2}&&, nel::Context const&)+0xc1>
+                    return on_ok(forward<T>(*ok_));
+    21ed:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    21f1:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    21f5:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    21f8:	|  |     |   e8 8b 03 00 00       	call   2588 <nel::Element<U8Buf<256ul> >::operator*()>
+    21fd:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2200:	|  |     |   e8 74 03 00 00       	call   2579 <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    2205:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    2208:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    220c:	|  |     |   48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+    2210:	|  |     |   48 89 ce             	mov    %rcx,%rsi
+    2213:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2216:	|  |     |   e8 e3 fe ff ff       	call   20fe <nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}::operator()(U8Buf<256ul>&&) const>
+    221b:	|  |  /--|-- eb 5c                	jmp    2279 <Error nel::Result<U8Buf<256ul>, Error>::consume<Error, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(Error&&)#2}>(nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}&&, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(Error&&)#2}&&, nel::Context const&)+0xd7>
+                    return on_err(forward<E>(*err_));
+    221d:	|  |  |  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2221:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    2225:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2228:	|  |  |      e8 75 03 00 00       	call   25a2 <nel::Element<Error>::operator*()>
+    222d:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2230:	|  |  |      e8 87 03 00 00       	call   25bc <Error&& nel::forward<Error, Error>(Error&)>
+    2235:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    2238:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    223c:	|  |  |      48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    2240:	|  |  |      48 89 ce             	mov    %rcx,%rsi
+    2243:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2246:	|  |  |      e8 e1 fe ff ff       	call   212c <nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(Error&&)#2}::operator()(Error&&) const>
+    224b:	|  |  +----- eb 2c                	jmp    2279 <Error nel::Result<U8Buf<256ul>, Error>::consume<Error, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(Error&&)#2}>(nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(U8Buf<256ul>&&)#1}&&, nel::Result<U8Buf<256ul>, Error>::unwrap_err(nel::Context const&)::{lambda(Error&&)#2}&&, nel::Context const&)+0xd7>
+                    nel::panic("invalid Result", ctx);
+    224d:	|  \--|----> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2251:	|     |      48 89 c6             	mov    %rax,%rsi
+    2254:	|     |      48 8d 05 7f 1e 00 00 	lea    0x1e7f(%rip),%rax        # 40da <nel::None+0x8c>
+    225b:	|     |      48 89 c7             	mov    %rax,%rdi
+    225e:	|     |      e8 60 09 00 00       	call   2bc3 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    2263:	\-----|----> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2267:	      |      48 89 c6             	mov    %rax,%rsi
+    226a:	      |      48 8d 05 40 1e 00 00 	lea    0x1e40(%rip),%rax        # 40b1 <nel::None+0x63>
+    2271:	      |      48 89 c7             	mov    %rax,%rdi
+    2274:	      |      e8 4a 09 00 00       	call   2bc3 <nel::panic(char const*, nel::Context const&)>
+        }
+    2279:	      \----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    227d:	             c9                   	leave
+    227e:	             c3                   	ret
+
+000000000000227f <nel::Result<U8Buf<256ul>, Error> nel::Result<U8Buf<256ul>, Error>::Ok<>()>:
+        constexpr static Result Ok(Args &&...args)
+    227f:	55                   	push   %rbp
+    2280:	48 89 e5             	mov    %rsp,%rbp
+    2283:	48 83 ec 10          	sub    $0x10,%rsp
+    2287:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<Args>(args)...);
+    228b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    228f:	48 89 c7             	mov    %rax,%rdi
+    2292:	e8 43 04 00 00       	call   26da <nel::Result<U8Buf<256ul>, Error>::Result<>(nel::Result<U8Buf<256ul>, Error>::Phantom<(nel::Result<U8Buf<256ul>, Error>::Tag)1>)>
+        }
+    2297:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    229b:	c9                   	leave
+    229c:	c3                   	ret
+    229d:	90                   	nop
+
+000000000000229e <nel::Element<U8Buf<256ul> >::~Element()>:
+        constexpr ~Element(void) = default;
+    229e:	55                   	push   %rbp
+    229f:	48 89 e5             	mov    %rsp,%rbp
+    22a2:	48 83 ec 10          	sub    $0x10,%rsp
+    22a6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    22aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22ae:	48 89 c7             	mov    %rax,%rdi
+    22b1:	e8 84 00 00 00       	call   233a <U8Buf<256ul>::~U8Buf()>
+    22b6:	90                   	nop
+    22b7:	c9                   	leave
+    22b8:	c3                   	ret
+    22b9:	90                   	nop
+
+00000000000022ba <nel::Result<U8Buf<256ul>, Error>::~Result()>:
+        constexpr ~Result(void)
+    22ba:	             55                   	push   %rbp
+    22bb:	             48 89 e5             	mov    %rsp,%rbp
+    22be:	             48 83 ec 30          	sub    $0x30,%rsp
+    22c2:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+            switch (tag_) { // result::dtor
+    22c6:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    22ca:	             8b 00                	mov    (%rax),%eax
+    22cc:	             83 f8 02             	cmp    $0x2,%eax
+    22cf:	/----------- 74 55                	je     2326 <nel::Result<U8Buf<256ul>, Error>::~Result()+0x6c>
+    22d1:	|            83 f8 02             	cmp    $0x2,%eax
+    22d4:	|        /-- 7f 1b                	jg     22f1 <nel::Result<U8Buf<256ul>, Error>::~Result()+0x37>
+    22d6:	|        |   85 c0                	test   %eax,%eax
+    22d8:	|  /-----|-- 74 4f                	je     2329 <nel::Result<U8Buf<256ul>, Error>::~Result()+0x6f>
+    22da:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    22dd:	|  |     +-- 75 12                	jne    22f1 <nel::Result<U8Buf<256ul>, Error>::~Result()+0x37>
+                    ok_.~Element<T>();
+    22df:	|  |     |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    22e3:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    22e7:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    22ea:	|  |     |   e8 af ff ff ff       	call   229e <nel::Element<U8Buf<256ul> >::~Element()>
+                    break;
+    22ef:	|  |  /--|-- eb 39                	jmp    232a <nel::Result<U8Buf<256ul>, Error>::~Result()+0x70>
+                    nel::panic("bad Result");
+    22f1:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    22f5:	|  |  |      b9 72 00 00 00       	mov    $0x72,%ecx
+    22fa:	|  |  |      48 8d 15 97 1d 00 00 	lea    0x1d97(%rip),%rdx        # 4098 <nel::None+0x4a>
+    2301:	|  |  |      48 8d 35 18 1e 00 00 	lea    0x1e18(%rip),%rsi        # 4120 <nel::None+0xd2>
+    2308:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    230b:	|  |  |      e8 f0 f9 ff ff       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    2310:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2314:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    2317:	|  |  |      48 8d 05 93 1d 00 00 	lea    0x1d93(%rip),%rax        # 40b1 <nel::None+0x63>
+    231e:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2321:	|  |  |      e8 9d 08 00 00       	call   2bc3 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    2326:	\--|--|----> 90                   	nop
+    2327:	   |  +----- eb 01                	jmp    232a <nel::Result<U8Buf<256ul>, Error>::~Result()+0x70>
+                    break;
+    2329:	   \--|----> 90                   	nop
+        }
+    232a:	      \----> 90                   	nop
+    232b:	             c9                   	leave
+    232c:	             c3                   	ret
+    232d:	             90                   	nop
+
+000000000000232e <U8Buf<256ul>::U8Buf()>:
+    public:
+        // default initialises whole struct 0, which is not what's wanted
+        // default I want is create with uninitialised array..
+        // maybe a uninitialised ctor then?
+        // U8Buf(void) = default;
+        constexpr U8Buf(void) {}
+    232e:	55                   	push   %rbp
+    232f:	48 89 e5             	mov    %rsp,%rbp
+    2332:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2336:	90                   	nop
+    2337:	5d                   	pop    %rbp
+    2338:	c3                   	ret
+    2339:	90                   	nop
+
+000000000000233a <U8Buf<256ul>::~U8Buf()>:
+
+        constexpr ~U8Buf(void)
+    233a:	55                   	push   %rbp
+    233b:	48 89 e5             	mov    %rsp,%rbp
+    233e:	48 83 ec 10          	sub    $0x10,%rsp
+    2342:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            nel::elem::set(data_, 0xa5, N);
+    2346:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    234a:	ba 00 01 00 00       	mov    $0x100,%edx
+    234f:	be a5 00 00 00       	mov    $0xa5,%esi
+    2354:	48 89 c7             	mov    %rax,%rdi
+    2357:	e8 4b 09 00 00       	call   2ca7 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    235c:	90                   	nop
+    235d:	c9                   	leave
+    235e:	c3                   	ret
+
+000000000000235f <nel::Result<U8Buf<256ul>, Error>::Ok(U8Buf<256ul>&&)>:
+        constexpr static Result Ok(T &&val)
+    235f:	55                   	push   %rbp
+    2360:	48 89 e5             	mov    %rsp,%rbp
+    2363:	48 83 ec 10          	sub    $0x10,%rsp
+    2367:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    236b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<T>(val));
+    236f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2373:	48 89 c7             	mov    %rax,%rdi
+    2376:	e8 fe 01 00 00       	call   2579 <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    237b:	48 89 c2             	mov    %rax,%rdx
+    237e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2382:	48 89 d6             	mov    %rdx,%rsi
+    2385:	48 89 c7             	mov    %rax,%rdi
+    2388:	e8 8f 03 00 00       	call   271c <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>::Phantom<(nel::Result<U8Buf<256ul>, Error>::Tag)1>, U8Buf<256ul>&&)>
+        }
+    238d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2391:	c9                   	leave
+    2392:	c3                   	ret
+    2393:	90                   	nop
+
+0000000000002394 <U8Buf<256ul>::U8Buf(unsigned char)>:
+            nel::elem::move(data_, o.data_, N);
+            return *this;
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+    2394:	55                   	push   %rbp
+    2395:	48 89 e5             	mov    %rsp,%rbp
+    2398:	48 83 ec 10          	sub    $0x10,%rsp
+    239c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    23a0:	89 f0                	mov    %esi,%eax
+    23a2:	88 45 f4             	mov    %al,-0xc(%rbp)
+        {
+            nel::elem::set(data_, f, N);
+    23a5:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    23a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23ad:	ba 00 01 00 00       	mov    $0x100,%edx
+    23b2:	89 ce                	mov    %ecx,%esi
+    23b4:	48 89 c7             	mov    %rax,%rdi
+    23b7:	e8 eb 08 00 00       	call   2ca7 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    23bc:	90                   	nop
+    23bd:	c9                   	leave
+    23be:	c3                   	ret
+
+00000000000023bf <nel::Result<U8Buf<256ul>, Error> nel::Result<U8Buf<256ul>, Error>::Ok<unsigned char>(unsigned char&&)>:
+        constexpr static Result Ok(Args &&...args)
+    23bf:	55                   	push   %rbp
+    23c0:	48 89 e5             	mov    %rsp,%rbp
+    23c3:	48 83 ec 10          	sub    $0x10,%rsp
+    23c7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    23cb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<Args>(args)...);
+    23cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    23d3:	48 89 c7             	mov    %rax,%rdi
+    23d6:	e8 82 03 00 00       	call   275d <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    23db:	48 89 c2             	mov    %rax,%rdx
+    23de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23e2:	48 89 d6             	mov    %rdx,%rsi
+    23e5:	48 89 c7             	mov    %rax,%rdi
+    23e8:	e8 7f 03 00 00       	call   276c <nel::Result<U8Buf<256ul>, Error>::Result<unsigned char>(nel::Result<U8Buf<256ul>, Error>::Phantom<(nel::Result<U8Buf<256ul>, Error>::Tag)1>, unsigned char&&)>
+        }
+    23ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23f1:	c9                   	leave
+    23f2:	c3                   	ret
+
+00000000000023f3 <nel::Result<U8Buf<256ul>, Error>::Err(Error&&)>:
+        constexpr static Result Err(E &&val)
+    23f3:	55                   	push   %rbp
+    23f4:	48 89 e5             	mov    %rsp,%rbp
+    23f7:	48 83 ec 10          	sub    $0x10,%rsp
+    23fb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    23ff:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<E>(val));
+    2403:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2407:	48 89 c7             	mov    %rax,%rdi
+    240a:	e8 ad 01 00 00       	call   25bc <Error&& nel::forward<Error, Error>(Error&)>
+    240f:	48 89 c2             	mov    %rax,%rdx
+    2412:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2416:	48 89 d6             	mov    %rdx,%rsi
+    2419:	48 89 c7             	mov    %rax,%rdi
+    241c:	e8 8d 03 00 00       	call   27ae <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>::Phantom<(nel::Result<U8Buf<256ul>, Error>::Tag)2>, Error&&)>
+        }
+    2421:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2425:	c9                   	leave
+    2426:	c3                   	ret
+
+0000000000002427 <nel::Result<U8Buf<256ul>, Error> nel::Result<U8Buf<256ul>, Error>::Err<ErrorCode, char const (&) [32], int>(ErrorCode&&, char const (&) [32], int&&)>:
+        constexpr static Result Err(Args &&...args)
+    2427:	55                   	push   %rbp
+    2428:	48 89 e5             	mov    %rsp,%rbp
+    242b:	41 54                	push   %r12
+    242d:	53                   	push   %rbx
+    242e:	48 83 ec 20          	sub    $0x20,%rsp
+    2432:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2436:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    243a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    243e:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    2442:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2446:	48 89 c7             	mov    %rax,%rdi
+    2449:	e8 bd 03 00 00       	call   280b <int&& nel::forward<int, int>(int&)>
+    244e:	49 89 c4             	mov    %rax,%r12
+    2451:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2455:	48 89 c7             	mov    %rax,%rdi
+    2458:	e8 a0 03 00 00       	call   27fd <char const (&nel::forward<char const (&) [32], char const [32]>(char const (&) [32])) [32]>
+    245d:	48 89 c3             	mov    %rax,%rbx
+    2460:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2464:	48 89 c7             	mov    %rax,%rdi
+    2467:	e8 83 03 00 00       	call   27ef <ErrorCode&& nel::forward<ErrorCode, ErrorCode>(ErrorCode&)>
+    246c:	48 89 c6             	mov    %rax,%rsi
+    246f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2473:	4c 89 e1             	mov    %r12,%rcx
+    2476:	48 89 da             	mov    %rbx,%rdx
+    2479:	48 89 c7             	mov    %rax,%rdi
+    247c:	e8 99 03 00 00       	call   281a <nel::Result<U8Buf<256ul>, Error>::Result<ErrorCode, char const (&) [32], int>(nel::Result<U8Buf<256ul>, Error>::Phantom<(nel::Result<U8Buf<256ul>, Error>::Tag)2>, ErrorCode&&, char const (&) [32], int&&)>
+        }
+    2481:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2485:	48 83 c4 20          	add    $0x20,%rsp
+    2489:	5b                   	pop    %rbx
+    248a:	41 5c                	pop    %r12
+    248c:	5d                   	pop    %rbp
+    248d:	c3                   	ret
+
+000000000000248e <nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}::operator()(U8Buf<256ul> const&) const>:
+            return match<bool>([](T const &) -> bool { return true; },
+    248e:	55                   	push   %rbp
+    248f:	48 89 e5             	mov    %rsp,%rbp
+    2492:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2496:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    249a:	b8 01 00 00 00       	mov    $0x1,%eax
+    249f:	5d                   	pop    %rbp
+    24a0:	c3                   	ret
+    24a1:	90                   	nop
+
+00000000000024a2 <nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(Error const&)#2}::operator()(Error const&) const>:
+                               [](E const &) -> bool { return false; },
+    24a2:	55                   	push   %rbp
+    24a3:	48 89 e5             	mov    %rsp,%rbp
+    24a6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    24aa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    24ae:	b8 00 00 00 00       	mov    $0x0,%eax
+    24b3:	5d                   	pop    %rbp
+    24b4:	c3                   	ret
+    24b5:	90                   	nop
+
+00000000000024b6 <nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const>:
+        constexpr bool is_ok(Context const &ctx = Context()) const
+    24b6:	55                   	push   %rbp
+    24b7:	48 89 e5             	mov    %rsp,%rbp
+    24ba:	48 83 ec 20          	sub    $0x20,%rsp
+    24be:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    24c2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](T const &) -> bool { return true; },
+    24c6:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    24ca:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    24ce:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    24d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24d6:	48 89 c7             	mov    %rax,%rdi
+    24d9:	e8 b2 03 00 00       	call   2890 <bool nel::Result<U8Buf<256ul>, Error>::match<bool, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(Error const&)#2}>(nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}&&, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(Error const&)#2}&&, nel::Context const&) const>
+        }
+    24de:	c9                   	leave
+    24df:	c3                   	ret
+
+00000000000024e0 <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}::operator()(U8Buf<256ul> const&) const>:
+            return match<bool>([](T const &) -> bool { return false; },
+    24e0:	55                   	push   %rbp
+    24e1:	48 89 e5             	mov    %rsp,%rbp
+    24e4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    24e8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    24ec:	b8 00 00 00 00       	mov    $0x0,%eax
+    24f1:	5d                   	pop    %rbp
+    24f2:	c3                   	ret
+    24f3:	90                   	nop
+
+00000000000024f4 <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(Error const&)#2}::operator()(Error const&) const>:
+                               [](E const &) -> bool { return true; },
+    24f4:	55                   	push   %rbp
+    24f5:	48 89 e5             	mov    %rsp,%rbp
+    24f8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    24fc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2500:	b8 01 00 00 00       	mov    $0x1,%eax
+    2505:	5d                   	pop    %rbp
+    2506:	c3                   	ret
+    2507:	90                   	nop
+
+0000000000002508 <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const>:
+        constexpr bool is_err(Context const &ctx = Context()) const
+    2508:	55                   	push   %rbp
+    2509:	48 89 e5             	mov    %rsp,%rbp
+    250c:	48 83 ec 20          	sub    $0x20,%rsp
+    2510:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2514:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](T const &) -> bool { return false; },
+    2518:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    251c:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    2520:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    2524:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2528:	48 89 c7             	mov    %rax,%rdi
+    252b:	e8 08 04 00 00       	call   2938 <bool nel::Result<U8Buf<256ul>, Error>::match<bool, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(Error const&)#2}>(nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}&&, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(Error const&)#2}&&, nel::Context const&) const>
+        }
+    2530:	c9                   	leave
+    2531:	c3                   	ret
+
+0000000000002532 <nel::Element<U8Buf<256ul> >&& nel::forward<nel::Element<U8Buf<256ul> >, nel::Element<U8Buf<256ul> > >(nel::Element<U8Buf<256ul> >&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel so to not need std.
+ */
+template<typename U, typename T>
+constexpr U &&forward(T &t)
+    2532:	55                   	push   %rbp
+    2533:	48 89 e5             	mov    %rsp,%rbp
+    2536:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<U &&>(t);
+    253a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    253e:	5d                   	pop    %rbp
+    253f:	c3                   	ret
+
+0000000000002540 <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>:
+        constexpr U8Buf(U8Buf &&o)
+    2540:	55                   	push   %rbp
+    2541:	48 89 e5             	mov    %rsp,%rbp
+    2544:	48 83 ec 10          	sub    $0x10,%rsp
+    2548:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    254c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            nel::elem::move(data_, o.data_, N);
+    2550:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2554:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2558:	ba 00 01 00 00       	mov    $0x100,%edx
+    255d:	48 89 ce             	mov    %rcx,%rsi
+    2560:	48 89 c7             	mov    %rax,%rdi
+    2563:	e8 6d 07 00 00       	call   2cd5 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+        }
+    2568:	90                   	nop
+    2569:	c9                   	leave
+    256a:	c3                   	ret
+
+000000000000256b <nel::Element<Error>&& nel::forward<nel::Element<Error>, nel::Element<Error> >(nel::Element<Error>&)>:
+constexpr U &&forward(T &t)
+    256b:	55                   	push   %rbp
+    256c:	48 89 e5             	mov    %rsp,%rbp
+    256f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    2573:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2577:	5d                   	pop    %rbp
+    2578:	c3                   	ret
+
+0000000000002579 <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>:
+constexpr U &&forward(T &t)
+    2579:	55                   	push   %rbp
+    257a:	48 89 e5             	mov    %rsp,%rbp
+    257d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    2581:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2585:	5d                   	pop    %rbp
+    2586:	c3                   	ret
+    2587:	90                   	nop
+
+0000000000002588 <nel::Element<U8Buf<256ul> >::operator*()>:
+        constexpr Type const &operator*(void) const
+        {
+            return ref();
+        }
+
+        constexpr Type &operator*(void)
+    2588:	55                   	push   %rbp
+    2589:	48 89 e5             	mov    %rsp,%rbp
+    258c:	48 83 ec 10          	sub    $0x10,%rsp
+    2590:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    2594:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2598:	48 89 c7             	mov    %rax,%rdi
+    259b:	e8 40 04 00 00       	call   29e0 <nel::Element<U8Buf<256ul> >::ref()>
+        }
+    25a0:	c9                   	leave
+    25a1:	c3                   	ret
+
+00000000000025a2 <nel::Element<Error>::operator*()>:
+        constexpr Type &operator*(void)
+    25a2:	55                   	push   %rbp
+    25a3:	48 89 e5             	mov    %rsp,%rbp
+    25a6:	48 83 ec 10          	sub    $0x10,%rsp
+    25aa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    25ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25b2:	48 89 c7             	mov    %rax,%rdi
+    25b5:	e8 34 04 00 00       	call   29ee <nel::Element<Error>::ref()>
+        }
+    25ba:	c9                   	leave
+    25bb:	c3                   	ret
+
+00000000000025bc <Error&& nel::forward<Error, Error>(Error&)>:
+constexpr U &&forward(T &t)
+    25bc:	55                   	push   %rbp
+    25bd:	48 89 e5             	mov    %rsp,%rbp
+    25c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    25c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    25c8:	5d                   	pop    %rbp
+    25c9:	c3                   	ret
+
+00000000000025ca <operator<<(nel::Log&, U8Buf<256ul> const&)>:
+        void fill(uint8_t f)
+        {
+            nel::elem::set(data_, f, N);
+        }
+
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+    25ca:	          55                   	push   %rbp
+    25cb:	          48 89 e5             	mov    %rsp,%rbp
+    25ce:	          53                   	push   %rbx
+    25cf:	          48 83 ec 28          	sub    $0x28,%rsp
+    25d3:	          48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    25d7:	          48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+        {
+            outs << "U8Buf<" << val.len() << ">{";
+    25db:	          48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    25df:	          48 8d 15 42 1b 00 00 	lea    0x1b42(%rip),%rdx        # 4128 <nel::None+0xda>
+    25e6:	          48 89 d6             	mov    %rdx,%rsi
+    25e9:	          48 89 c7             	mov    %rax,%rdi
+    25ec:	          e8 0a 0f 00 00       	call   34fb <nel::operator<<(nel::Log&, char const*)>
+    25f1:	          48 89 c3             	mov    %rax,%rbx
+    25f4:	          48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    25f8:	          48 89 c7             	mov    %rax,%rdi
+    25fb:	          e8 fc 03 00 00       	call   29fc <U8Buf<256ul>::len() const>
+    2600:	          48 89 c6             	mov    %rax,%rsi
+    2603:	          48 89 df             	mov    %rbx,%rdi
+    2606:	          e8 fb 0f 00 00       	call   3606 <nel::operator<<(nel::Log&, unsigned long)>
+    260b:	          48 89 c2             	mov    %rax,%rdx
+    260e:	          48 8d 05 1a 1b 00 00 	lea    0x1b1a(%rip),%rax        # 412f <nel::None+0xe1>
+    2615:	          48 89 c6             	mov    %rax,%rsi
+    2618:	          48 89 d7             	mov    %rdx,%rdi
+    261b:	          e8 db 0e 00 00       	call   34fb <nel::operator<<(nel::Log&, char const*)>
+            if (val.len() > 0) {
+    2620:	          48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2624:	          48 89 c7             	mov    %rax,%rdi
+    2627:	          e8 d0 03 00 00       	call   29fc <U8Buf<256ul>::len() const>
+    262c:	          48 85 c0             	test   %rax,%rax
+    262f:	          0f 95 c0             	setne  %al
+    2632:	          84 c0                	test   %al,%al
+    2634:	/-------- 74 6d                	je     26a3 <operator<<(nel::Log&, U8Buf<256ul> const&)+0xd9>
+                outs << val.data_[0];
+    2636:	|         48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    263a:	|         0f b6 00             	movzbl (%rax),%eax
+    263d:	|         0f b6 d0             	movzbl %al,%edx
+    2640:	|         48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2644:	|         89 d6                	mov    %edx,%esi
+    2646:	|         48 89 c7             	mov    %rax,%rdi
+    2649:	|         e8 d9 0e 00 00       	call   3527 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    264e:	|         48 c7 45 e8 01 00 00 	movq   $0x1,-0x18(%rbp)
+    2655:	|         00 
+    2656:	|     /-- eb 34                	jmp    268c <operator<<(nel::Log&, U8Buf<256ul> const&)+0xc2>
+                    outs << ' ' << val.data_[i];
+    2658:	|  /--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    265c:	|  |  |   be 20 00 00 00       	mov    $0x20,%esi
+    2661:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2664:	|  |  |   e8 66 0e 00 00       	call   34cf <nel::operator<<(nel::Log&, char)>
+    2669:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    266c:	|  |  |   48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    2670:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2674:	|  |  |   48 01 c8             	add    %rcx,%rax
+    2677:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    267a:	|  |  |   0f b6 c0             	movzbl %al,%eax
+    267d:	|  |  |   89 c6                	mov    %eax,%esi
+    267f:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2682:	|  |  |   e8 a0 0e 00 00       	call   3527 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    2687:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    268c:	|  |  \-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2690:	|  |      48 89 c7             	mov    %rax,%rdi
+    2693:	|  |      e8 64 03 00 00       	call   29fc <U8Buf<256ul>::len() const>
+    2698:	|  |      48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    269c:	|  |      0f 92 c0             	setb   %al
+    269f:	|  |      84 c0                	test   %al,%al
+    26a1:	|  \----- 75 b5                	jne    2658 <operator<<(nel::Log&, U8Buf<256ul> const&)+0x8e>
+                }
+            }
+            outs << '}';
+    26a3:	\-------> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    26a7:	          be 7d 00 00 00       	mov    $0x7d,%esi
+    26ac:	          48 89 c7             	mov    %rax,%rdi
+    26af:	          e8 1b 0e 00 00       	call   34cf <nel::operator<<(nel::Log&, char)>
+            return outs;
+    26b4:	          48 8b 45 d8          	mov    -0x28(%rbp),%rax
+        }
+    26b8:	          48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    26bc:	          c9                   	leave
+    26bd:	          c3                   	ret
+
+00000000000026be <nel::Element<U8Buf<256ul> >::Element()>:
+        constexpr Element(void) = default;
+    26be:	55                   	push   %rbp
+    26bf:	48 89 e5             	mov    %rsp,%rbp
+    26c2:	48 83 ec 10          	sub    $0x10,%rsp
+    26c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    26ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26ce:	48 89 c7             	mov    %rax,%rdi
+    26d1:	e8 58 fc ff ff       	call   232e <U8Buf<256ul>::U8Buf()>
+    26d6:	90                   	nop
+    26d7:	c9                   	leave
+    26d8:	c3                   	ret
+    26d9:	90                   	nop
+
+00000000000026da <nel::Result<U8Buf<256ul>, Error>::Result<>(nel::Result<U8Buf<256ul>, Error>::Phantom<(nel::Result<U8Buf<256ul>, Error>::Tag)1>)>:
+        constexpr Result(Phantom<Tag::OK> const, Args &&...args)
+    26da:	55                   	push   %rbp
+    26db:	48 89 e5             	mov    %rsp,%rbp
+    26de:	48 83 ec 10          	sub    $0x10,%rsp
+    26e2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : tag_(Tag::OK)
+    26e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26ea:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<Args>(args)...)
+    26f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26f4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    26f8:	b8 00 00 00 00       	mov    $0x0,%eax
+    26fd:	b9 20 00 00 00       	mov    $0x20,%ecx
+    2702:	48 89 d7             	mov    %rdx,%rdi
+    2705:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+    2708:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    270c:	48 83 c0 08          	add    $0x8,%rax
+    2710:	48 89 c7             	mov    %rax,%rdi
+    2713:	e8 a6 ff ff ff       	call   26be <nel::Element<U8Buf<256ul> >::Element()>
+        }
+    2718:	90                   	nop
+    2719:	c9                   	leave
+    271a:	c3                   	ret
+    271b:	90                   	nop
+
+000000000000271c <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>::Phantom<(nel::Result<U8Buf<256ul>, Error>::Tag)1>, U8Buf<256ul>&&)>:
+        constexpr Result(Phantom<Tag::OK> const, T &&v)
+    271c:	55                   	push   %rbp
+    271d:	48 89 e5             	mov    %rsp,%rbp
+    2720:	53                   	push   %rbx
+    2721:	48 83 ec 18          	sub    $0x18,%rsp
+    2725:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2729:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    272d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2731:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<T>(v))
+    2737:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    273b:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    273f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2743:	48 89 c7             	mov    %rax,%rdi
+    2746:	e8 2e fe ff ff       	call   2579 <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    274b:	48 89 c6             	mov    %rax,%rsi
+    274e:	48 89 df             	mov    %rbx,%rdi
+    2751:	e8 b6 02 00 00       	call   2a0c <nel::Element<U8Buf<256ul> >::Element(U8Buf<256ul>&&)>
+        }
+    2756:	90                   	nop
+    2757:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    275b:	c9                   	leave
+    275c:	c3                   	ret
+
+000000000000275d <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>:
+constexpr U &&forward(T &t)
+    275d:	55                   	push   %rbp
+    275e:	48 89 e5             	mov    %rsp,%rbp
+    2761:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    2765:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2769:	5d                   	pop    %rbp
+    276a:	c3                   	ret
+    276b:	90                   	nop
+
+000000000000276c <nel::Result<U8Buf<256ul>, Error>::Result<unsigned char>(nel::Result<U8Buf<256ul>, Error>::Phantom<(nel::Result<U8Buf<256ul>, Error>::Tag)1>, unsigned char&&)>:
+        constexpr Result(Phantom<Tag::OK> const, Args &&...args)
+    276c:	55                   	push   %rbp
+    276d:	48 89 e5             	mov    %rsp,%rbp
+    2770:	53                   	push   %rbx
+    2771:	48 83 ec 18          	sub    $0x18,%rsp
+    2775:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2779:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    277d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2781:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<Args>(args)...)
+    2787:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    278b:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    278f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2793:	48 89 c7             	mov    %rax,%rdi
+    2796:	e8 c2 ff ff ff       	call   275d <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    279b:	48 89 c6             	mov    %rax,%rsi
+    279e:	48 89 df             	mov    %rbx,%rdi
+    27a1:	e8 9a 02 00 00       	call   2a40 <nel::Element<U8Buf<256ul> >::Element<unsigned char>(unsigned char&&)>
+        }
+    27a6:	90                   	nop
+    27a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    27ab:	c9                   	leave
+    27ac:	c3                   	ret
+    27ad:	90                   	nop
+
+00000000000027ae <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>::Phantom<(nel::Result<U8Buf<256ul>, Error>::Tag)2>, Error&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    27ae:	55                   	push   %rbp
+    27af:	48 89 e5             	mov    %rsp,%rbp
+    27b2:	53                   	push   %rbx
+    27b3:	48 83 ec 18          	sub    $0x18,%rsp
+    27b7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    27bb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    27bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27c3:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    27c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27cd:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    27d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    27d5:	48 89 c7             	mov    %rax,%rdi
+    27d8:	e8 df fd ff ff       	call   25bc <Error&& nel::forward<Error, Error>(Error&)>
+    27dd:	48 89 c6             	mov    %rax,%rsi
+    27e0:	48 89 df             	mov    %rbx,%rdi
+    27e3:	e8 90 02 00 00       	call   2a78 <nel::Element<Error>::Element(Error&&)>
+        }
+    27e8:	90                   	nop
+    27e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    27ed:	c9                   	leave
+    27ee:	c3                   	ret
+
+00000000000027ef <ErrorCode&& nel::forward<ErrorCode, ErrorCode>(ErrorCode&)>:
+constexpr U &&forward(T &t)
+    27ef:	55                   	push   %rbp
+    27f0:	48 89 e5             	mov    %rsp,%rbp
+    27f3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    27f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    27fb:	5d                   	pop    %rbp
+    27fc:	c3                   	ret
+
+00000000000027fd <char const (&nel::forward<char const (&) [32], char const [32]>(char const (&) [32])) [32]>:
+constexpr U &&forward(T &t)
+    27fd:	55                   	push   %rbp
+    27fe:	48 89 e5             	mov    %rsp,%rbp
+    2801:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    2805:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2809:	5d                   	pop    %rbp
+    280a:	c3                   	ret
+
+000000000000280b <int&& nel::forward<int, int>(int&)>:
+constexpr U &&forward(T &t)
+    280b:	55                   	push   %rbp
+    280c:	48 89 e5             	mov    %rsp,%rbp
+    280f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    2813:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2817:	5d                   	pop    %rbp
+    2818:	c3                   	ret
+    2819:	90                   	nop
+
+000000000000281a <nel::Result<U8Buf<256ul>, Error>::Result<ErrorCode, char const (&) [32], int>(nel::Result<U8Buf<256ul>, Error>::Phantom<(nel::Result<U8Buf<256ul>, Error>::Tag)2>, ErrorCode&&, char const (&) [32], int&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+    281a:	55                   	push   %rbp
+    281b:	48 89 e5             	mov    %rsp,%rbp
+    281e:	41 55                	push   %r13
+    2820:	41 54                	push   %r12
+    2822:	53                   	push   %rbx
+    2823:	48 83 ec 28          	sub    $0x28,%rsp
+    2827:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    282b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    282f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    2833:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+            : tag_(Tag::ERR)
+    2837:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    283b:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<Args>(args)...)
+    2841:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2845:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    2849:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    284d:	48 89 c7             	mov    %rax,%rdi
+    2850:	e8 b6 ff ff ff       	call   280b <int&& nel::forward<int, int>(int&)>
+    2855:	49 89 c5             	mov    %rax,%r13
+    2858:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    285c:	48 89 c7             	mov    %rax,%rdi
+    285f:	e8 99 ff ff ff       	call   27fd <char const (&nel::forward<char const (&) [32], char const [32]>(char const (&) [32])) [32]>
+    2864:	49 89 c4             	mov    %rax,%r12
+    2867:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    286b:	48 89 c7             	mov    %rax,%rdi
+    286e:	e8 7c ff ff ff       	call   27ef <ErrorCode&& nel::forward<ErrorCode, ErrorCode>(ErrorCode&)>
+    2873:	4c 89 e9             	mov    %r13,%rcx
+    2876:	4c 89 e2             	mov    %r12,%rdx
+    2879:	48 89 c6             	mov    %rax,%rsi
+    287c:	48 89 df             	mov    %rbx,%rdi
+    287f:	e8 30 02 00 00       	call   2ab4 <nel::Element<Error>::Element<ErrorCode, char const (&) [32], int>(ErrorCode&&, char const (&) [32], int&&)>
+        }
+    2884:	90                   	nop
+    2885:	48 83 c4 28          	add    $0x28,%rsp
+    2889:	5b                   	pop    %rbx
+    288a:	41 5c                	pop    %r12
+    288c:	41 5d                	pop    %r13
+    288e:	5d                   	pop    %rbp
+    288f:	c3                   	ret
+
+0000000000002890 <bool nel::Result<U8Buf<256ul>, Error>::match<bool, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(Error const&)#2}>(nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}&&, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(Error const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    2890:	             55                   	push   %rbp
+    2891:	             48 89 e5             	mov    %rsp,%rbp
+    2894:	             48 83 ec 20          	sub    $0x20,%rsp
+    2898:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    289c:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    28a0:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    28a4:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result-match
+    28a8:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28ac:	             8b 00                	mov    (%rax),%eax
+    28ae:	             83 f8 02             	cmp    $0x2,%eax
+    28b1:	         /-- 74 32                	je     28e5 <bool nel::Result<U8Buf<256ul>, Error>::match<bool, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(Error const&)#2}>(nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}&&, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(Error const&)#2}&&, nel::Context const&) const+0x55>
+    28b3:	         |   83 f8 02             	cmp    $0x2,%eax
+    28b6:	/--------|-- 7f 67                	jg     291f <bool nel::Result<U8Buf<256ul>, Error>::match<bool, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(Error const&)#2}>(nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}&&, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(Error const&)#2}&&, nel::Context const&) const+0x8f>
+    28b8:	|        |   85 c0                	test   %eax,%eax
+    28ba:	|     /--|-- 74 4d                	je     2909 <bool nel::Result<U8Buf<256ul>, Error>::match<bool, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(Error const&)#2}>(nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}&&, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(Error const&)#2}&&, nel::Context const&) const+0x79>
+    28bc:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    28bf:	+-----|--|-- 75 5e                	jne    291f <bool nel::Result<U8Buf<256ul>, Error>::match<bool, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(Error const&)#2}>(nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}&&, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(Error const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_ok(*ok_);
+    28c1:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28c5:	|     |  |   48 83 c0 08          	add    $0x8,%rax
+    28c9:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    28cc:	|     |  |   e8 4d 02 00 00       	call   2b1e <nel::Element<U8Buf<256ul> >::operator*() const>
+    28d1:	|     |  |   48 89 c2             	mov    %rax,%rdx
+    28d4:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    28d8:	|     |  |   48 89 d6             	mov    %rdx,%rsi
+    28db:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    28de:	|     |  |   e8 ab fb ff ff       	call   248e <nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}::operator()(U8Buf<256ul> const&) const>
+    28e3:	|  /--|--|-- eb 50                	jmp    2935 <bool nel::Result<U8Buf<256ul>, Error>::match<bool, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(Error const&)#2}>(nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}&&, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(Error const&)#2}&&, nel::Context const&) const+0xa5>
+                    return on_err(*err_);
+    28e5:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28e9:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    28ed:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    28f0:	|  |  |      e8 43 02 00 00       	call   2b38 <nel::Element<Error>::operator*() const>
+    28f5:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    28f8:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28fc:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    28ff:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2902:	|  |  |      e8 9b fb ff ff       	call   24a2 <nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(Error const&)#2}::operator()(Error const&) const>
+    2907:	|  +--|----- eb 2c                	jmp    2935 <bool nel::Result<U8Buf<256ul>, Error>::match<bool, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(Error const&)#2}>(nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}&&, nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const::{lambda(Error const&)#2}&&, nel::Context const&) const+0xa5>
+                    nel::panic("invalid Result", ctx);
+    2909:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    290d:	|  |         48 89 c6             	mov    %rax,%rsi
+    2910:	|  |         48 8d 05 c3 17 00 00 	lea    0x17c3(%rip),%rax        # 40da <nel::None+0x8c>
+    2917:	|  |         48 89 c7             	mov    %rax,%rdi
+    291a:	|  |         e8 a4 02 00 00       	call   2bc3 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    291f:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2923:	   |         48 89 c6             	mov    %rax,%rsi
+    2926:	   |         48 8d 05 84 17 00 00 	lea    0x1784(%rip),%rax        # 40b1 <nel::None+0x63>
+    292d:	   |         48 89 c7             	mov    %rax,%rdi
+    2930:	   |         e8 8e 02 00 00       	call   2bc3 <nel::panic(char const*, nel::Context const&)>
+        }
+    2935:	   \-------> c9                   	leave
+    2936:	             c3                   	ret
+    2937:	             90                   	nop
+
+0000000000002938 <bool nel::Result<U8Buf<256ul>, Error>::match<bool, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(Error const&)#2}>(nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}&&, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(Error const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    2938:	             55                   	push   %rbp
+    2939:	             48 89 e5             	mov    %rsp,%rbp
+    293c:	             48 83 ec 20          	sub    $0x20,%rsp
+    2940:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2944:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2948:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    294c:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result-match
+    2950:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2954:	             8b 00                	mov    (%rax),%eax
+    2956:	             83 f8 02             	cmp    $0x2,%eax
+    2959:	         /-- 74 32                	je     298d <bool nel::Result<U8Buf<256ul>, Error>::match<bool, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(Error const&)#2}>(nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}&&, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(Error const&)#2}&&, nel::Context const&) const+0x55>
+    295b:	         |   83 f8 02             	cmp    $0x2,%eax
+    295e:	/--------|-- 7f 67                	jg     29c7 <bool nel::Result<U8Buf<256ul>, Error>::match<bool, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(Error const&)#2}>(nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}&&, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(Error const&)#2}&&, nel::Context const&) const+0x8f>
+    2960:	|        |   85 c0                	test   %eax,%eax
+    2962:	|     /--|-- 74 4d                	je     29b1 <bool nel::Result<U8Buf<256ul>, Error>::match<bool, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(Error const&)#2}>(nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}&&, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(Error const&)#2}&&, nel::Context const&) const+0x79>
+    2964:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    2967:	+-----|--|-- 75 5e                	jne    29c7 <bool nel::Result<U8Buf<256ul>, Error>::match<bool, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(Error const&)#2}>(nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}&&, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(Error const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_ok(*ok_);
+    2969:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    296d:	|     |  |   48 83 c0 08          	add    $0x8,%rax
+    2971:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    2974:	|     |  |   e8 a5 01 00 00       	call   2b1e <nel::Element<U8Buf<256ul> >::operator*() const>
+    2979:	|     |  |   48 89 c2             	mov    %rax,%rdx
+    297c:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2980:	|     |  |   48 89 d6             	mov    %rdx,%rsi
+    2983:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    2986:	|     |  |   e8 55 fb ff ff       	call   24e0 <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}::operator()(U8Buf<256ul> const&) const>
+    298b:	|  /--|--|-- eb 50                	jmp    29dd <bool nel::Result<U8Buf<256ul>, Error>::match<bool, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(Error const&)#2}>(nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}&&, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(Error const&)#2}&&, nel::Context const&) const+0xa5>
+                    return on_err(*err_);
+    298d:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2991:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    2995:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2998:	|  |  |      e8 9b 01 00 00       	call   2b38 <nel::Element<Error>::operator*() const>
+    299d:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    29a0:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    29a4:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    29a7:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    29aa:	|  |  |      e8 45 fb ff ff       	call   24f4 <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(Error const&)#2}::operator()(Error const&) const>
+    29af:	|  +--|----- eb 2c                	jmp    29dd <bool nel::Result<U8Buf<256ul>, Error>::match<bool, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(Error const&)#2}>(nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#1}&&, nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const::{lambda(Error const&)#2}&&, nel::Context const&) const+0xa5>
+                    nel::panic("invalid Result", ctx);
+    29b1:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29b5:	|  |         48 89 c6             	mov    %rax,%rsi
+    29b8:	|  |         48 8d 05 1b 17 00 00 	lea    0x171b(%rip),%rax        # 40da <nel::None+0x8c>
+    29bf:	|  |         48 89 c7             	mov    %rax,%rdi
+    29c2:	|  |         e8 fc 01 00 00       	call   2bc3 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    29c7:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29cb:	   |         48 89 c6             	mov    %rax,%rsi
+    29ce:	   |         48 8d 05 dc 16 00 00 	lea    0x16dc(%rip),%rax        # 40b1 <nel::None+0x63>
+    29d5:	   |         48 89 c7             	mov    %rax,%rdi
+    29d8:	   |         e8 e6 01 00 00       	call   2bc3 <nel::panic(char const*, nel::Context const&)>
+        }
+    29dd:	   \-------> c9                   	leave
+    29de:	             c3                   	ret
+    29df:	             90                   	nop
+
+00000000000029e0 <nel::Element<U8Buf<256ul> >::ref()>:
+        constexpr Type &ref(void)
+    29e0:	55                   	push   %rbp
+    29e1:	48 89 e5             	mov    %rsp,%rbp
+    29e4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    29e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    29ec:	5d                   	pop    %rbp
+    29ed:	c3                   	ret
+
+00000000000029ee <nel::Element<Error>::ref()>:
+        constexpr Type &ref(void)
+    29ee:	55                   	push   %rbp
+    29ef:	48 89 e5             	mov    %rsp,%rbp
+    29f2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    29f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    29fa:	5d                   	pop    %rbp
+    29fb:	c3                   	ret
+
+00000000000029fc <U8Buf<256ul>::len() const>:
+        constexpr Length len(void) const
+    29fc:	55                   	push   %rbp
+    29fd:	48 89 e5             	mov    %rsp,%rbp
+    2a00:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return N;
+    2a04:	b8 00 01 00 00       	mov    $0x100,%eax
+        }
+    2a09:	5d                   	pop    %rbp
+    2a0a:	c3                   	ret
+    2a0b:	90                   	nop
+
+0000000000002a0c <nel::Element<U8Buf<256ul> >::Element(U8Buf<256ul>&&)>:
+        constexpr Element(Type &&val)
+    2a0c:	55                   	push   %rbp
+    2a0d:	48 89 e5             	mov    %rsp,%rbp
+    2a10:	53                   	push   %rbx
+    2a11:	48 83 ec 18          	sub    $0x18,%rsp
+    2a15:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2a19:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : value_(forward<Type>(val))
+    2a1d:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    2a21:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a25:	48 89 c7             	mov    %rax,%rdi
+    2a28:	e8 4c fb ff ff       	call   2579 <U8Buf<256ul>&& nel::forward<U8Buf<256ul>, U8Buf<256ul> >(U8Buf<256ul>&)>
+    2a2d:	48 89 c6             	mov    %rax,%rsi
+    2a30:	48 89 df             	mov    %rbx,%rdi
+    2a33:	e8 08 fb ff ff       	call   2540 <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>
+        }
+    2a38:	90                   	nop
+    2a39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2a3d:	c9                   	leave
+    2a3e:	c3                   	ret
+    2a3f:	90                   	nop
+
+0000000000002a40 <nel::Element<U8Buf<256ul> >::Element<unsigned char>(unsigned char&&)>:
+        constexpr Element(Args &&...args)
+    2a40:	55                   	push   %rbp
+    2a41:	48 89 e5             	mov    %rsp,%rbp
+    2a44:	53                   	push   %rbx
+    2a45:	48 83 ec 18          	sub    $0x18,%rsp
+    2a49:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2a4d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : value_(forward<Args>(args)...)
+    2a51:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    2a55:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a59:	48 89 c7             	mov    %rax,%rdi
+    2a5c:	e8 fc fc ff ff       	call   275d <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    2a61:	0f b6 00             	movzbl (%rax),%eax
+    2a64:	0f b6 c0             	movzbl %al,%eax
+    2a67:	89 c6                	mov    %eax,%esi
+    2a69:	48 89 df             	mov    %rbx,%rdi
+    2a6c:	e8 23 f9 ff ff       	call   2394 <U8Buf<256ul>::U8Buf(unsigned char)>
+        }
+    2a71:	90                   	nop
+    2a72:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2a76:	c9                   	leave
+    2a77:	c3                   	ret
+
+0000000000002a78 <nel::Element<Error>::Element(Error&&)>:
+        constexpr Element(Type &&val)
+    2a78:	55                   	push   %rbp
+    2a79:	48 89 e5             	mov    %rsp,%rbp
+    2a7c:	48 83 ec 10          	sub    $0x10,%rsp
+    2a80:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2a84:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    2a88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a8c:	48 89 c7             	mov    %rax,%rdi
+    2a8f:	e8 28 fb ff ff       	call   25bc <Error&& nel::forward<Error, Error>(Error&)>
+    2a94:	48 89 c1             	mov    %rax,%rcx
+    2a97:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+    2a9b:	48 8b 01             	mov    (%rcx),%rax
+    2a9e:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+    2aa2:	48 89 06             	mov    %rax,(%rsi)
+    2aa5:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+    2aa9:	48 8b 41 10          	mov    0x10(%rcx),%rax
+    2aad:	48 89 46 10          	mov    %rax,0x10(%rsi)
+        }
+    2ab1:	90                   	nop
+    2ab2:	c9                   	leave
+    2ab3:	c3                   	ret
+
+0000000000002ab4 <nel::Element<Error>::Element<ErrorCode, char const (&) [32], int>(ErrorCode&&, char const (&) [32], int&&)>:
+        constexpr Element(Args &&...args)
+    2ab4:	55                   	push   %rbp
+    2ab5:	48 89 e5             	mov    %rsp,%rbp
+    2ab8:	41 55                	push   %r13
+    2aba:	41 54                	push   %r12
+    2abc:	53                   	push   %rbx
+    2abd:	48 83 ec 28          	sub    $0x28,%rsp
+    2ac1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    2ac5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    2ac9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    2acd:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+            : value_(forward<Args>(args)...)
+    2ad1:	48 8b 5d d8          	mov    -0x28(%rbp),%rbx
+    2ad5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2ad9:	48 89 c7             	mov    %rax,%rdi
+    2adc:	e8 2a fd ff ff       	call   280b <int&& nel::forward<int, int>(int&)>
+    2ae1:	8b 00                	mov    (%rax),%eax
+    2ae3:	4c 63 e0             	movslq %eax,%r12
+    2ae6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2aea:	48 89 c7             	mov    %rax,%rdi
+    2aed:	e8 0b fd ff ff       	call   27fd <char const (&nel::forward<char const (&) [32], char const [32]>(char const (&) [32])) [32]>
+    2af2:	49 89 c5             	mov    %rax,%r13
+    2af5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2af9:	48 89 c7             	mov    %rax,%rdi
+    2afc:	e8 ee fc ff ff       	call   27ef <ErrorCode&& nel::forward<ErrorCode, ErrorCode>(ErrorCode&)>
+    2b01:	4c 89 e1             	mov    %r12,%rcx
+    2b04:	4c 89 ea             	mov    %r13,%rdx
+    2b07:	48 89 c6             	mov    %rax,%rsi
+    2b0a:	48 89 df             	mov    %rbx,%rdi
+    2b0d:	e8 26 f2 ff ff       	call   1d38 <Error::Error(ErrorCode const&, char const*, unsigned long)>
+        }
+    2b12:	90                   	nop
+    2b13:	48 83 c4 28          	add    $0x28,%rsp
+    2b17:	5b                   	pop    %rbx
+    2b18:	41 5c                	pop    %r12
+    2b1a:	41 5d                	pop    %r13
+    2b1c:	5d                   	pop    %rbp
+    2b1d:	c3                   	ret
+
+0000000000002b1e <nel::Element<U8Buf<256ul> >::operator*() const>:
+        constexpr Type const &operator*(void) const
+    2b1e:	55                   	push   %rbp
+    2b1f:	48 89 e5             	mov    %rsp,%rbp
+    2b22:	48 83 ec 10          	sub    $0x10,%rsp
+    2b26:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    2b2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b2e:	48 89 c7             	mov    %rax,%rdi
+    2b31:	e8 1c 00 00 00       	call   2b52 <nel::Element<U8Buf<256ul> >::ref() const>
+        }
+    2b36:	c9                   	leave
+    2b37:	c3                   	ret
+
+0000000000002b38 <nel::Element<Error>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    2b38:	55                   	push   %rbp
+    2b39:	48 89 e5             	mov    %rsp,%rbp
+    2b3c:	48 83 ec 10          	sub    $0x10,%rsp
+    2b40:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    2b44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b48:	48 89 c7             	mov    %rax,%rdi
+    2b4b:	e8 10 00 00 00       	call   2b60 <nel::Element<Error>::ref() const>
+        }
+    2b50:	c9                   	leave
+    2b51:	c3                   	ret
+
+0000000000002b52 <nel::Element<U8Buf<256ul> >::ref() const>:
+        constexpr Type const &ref(void) const
+    2b52:	55                   	push   %rbp
+    2b53:	48 89 e5             	mov    %rsp,%rbp
+    2b56:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2b5a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2b5e:	5d                   	pop    %rbp
+    2b5f:	c3                   	ret
+
+0000000000002b60 <nel::Element<Error>::ref() const>:
+        constexpr Type const &ref(void) const
+    2b60:	55                   	push   %rbp
+    2b61:	48 89 e5             	mov    %rsp,%rbp
+    2b64:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2b68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2b6c:	5d                   	pop    %rbp
+    2b6d:	c3                   	ret
+
+0000000000002b6e <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    2b6e:	55                   	push   %rbp
+    2b6f:	48 89 e5             	mov    %rsp,%rbp
+    std::abort();
+    2b72:	e8 c9 e4 ff ff       	call   1040 <abort@plt>
+
+0000000000002b77 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    2b77:	55                   	push   %rbp
+    2b78:	48 89 e5             	mov    %rsp,%rbp
+    2b7b:	48 83 ec 10          	sub    $0x10,%rsp
+    2b7f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    2b83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b87:	48 8b 30             	mov    (%rax),%rsi
+    2b8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b8e:	8b 48 10             	mov    0x10(%rax),%ecx
+    2b91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b95:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2b99:	48 8b 05 c0 44 00 00 	mov    0x44c0(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    2ba0:	4c 8d 0d 8b 15 00 00 	lea    0x158b(%rip),%r9        # 4132 <nel::None+0xe4>
+    2ba7:	49 89 f0             	mov    %rsi,%r8
+    2baa:	48 8d 35 87 15 00 00 	lea    0x1587(%rip),%rsi        # 4138 <nel::None+0xea>
+    2bb1:	48 89 c7             	mov    %rax,%rdi
+    2bb4:	b8 00 00 00 00       	mov    $0x0,%eax
+    2bb9:	e8 d2 e4 ff ff       	call   1090 <fprintf@plt>
+    abort();
+    2bbe:	e8 ab ff ff ff       	call   2b6e <nel::abort()>
+
+0000000000002bc3 <nel::panic(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    2bc3:	55                   	push   %rbp
+    2bc4:	48 89 e5             	mov    %rsp,%rbp
+    2bc7:	48 83 ec 10          	sub    $0x10,%rsp
+    2bcb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2bcf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    2bd3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2bd7:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    2bda:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2bde:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    2be1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2be5:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    2be9:	48 8b 05 70 44 00 00 	mov    0x4470(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    2bf0:	48 83 ec 08          	sub    $0x8,%rsp
+    2bf4:	ff 75 f8             	push   -0x8(%rbp)
+    2bf7:	4c 8d 0d 34 15 00 00 	lea    0x1534(%rip),%r9        # 4132 <nel::None+0xe4>
+    2bfe:	49 89 f0             	mov    %rsi,%r8
+    2c01:	48 8d 35 41 15 00 00 	lea    0x1541(%rip),%rsi        # 4149 <nel::None+0xfb>
+    2c08:	48 89 c7             	mov    %rax,%rdi
+    2c0b:	b8 00 00 00 00       	mov    $0x0,%eax
+    2c10:	e8 7b e4 ff ff       	call   1090 <fprintf@plt>
+    2c15:	48 83 c4 10          	add    $0x10,%rsp
+            "PANIC",
+            msg);
+    abort();
+    2c19:	e8 50 ff ff ff       	call   2b6e <nel::abort()>
+
+0000000000002c1e <nel::assert_fail(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    2c1e:	55                   	push   %rbp
+    2c1f:	48 89 e5             	mov    %rsp,%rbp
+    2c22:	48 83 ec 10          	sub    $0x10,%rsp
+    2c26:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2c2a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    2c2e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2c32:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    2c35:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2c39:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    2c3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2c40:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    2c44:	48 8b 05 15 44 00 00 	mov    0x4415(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    2c4b:	48 83 ec 08          	sub    $0x8,%rsp
+    2c4f:	ff 75 f8             	push   -0x8(%rbp)
+    2c52:	4c 8d 0d 05 15 00 00 	lea    0x1505(%rip),%r9        # 415e <nel::None+0x110>
+    2c59:	49 89 f0             	mov    %rsi,%r8
+    2c5c:	48 8d 35 e6 14 00 00 	lea    0x14e6(%rip),%rsi        # 4149 <nel::None+0xfb>
+    2c63:	48 89 c7             	mov    %rax,%rdi
+    2c66:	b8 00 00 00 00       	mov    $0x0,%eax
+    2c6b:	e8 20 e4 ff ff       	call   1090 <fprintf@plt>
+    2c70:	48 83 c4 10          	add    $0x10,%rsp
+            "ASSERT FAIL",
+            msg);
+    abort();
+    2c74:	e8 f5 fe ff ff       	call   2b6e <nel::abort()>
+
+0000000000002c79 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    2c79:	55                   	push   %rbp
+    2c7a:	48 89 e5             	mov    %rsp,%rbp
+    2c7d:	48 83 ec 20          	sub    $0x20,%rsp
+    2c81:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2c85:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2c89:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    2c8d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2c91:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2c95:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c99:	48 89 ce             	mov    %rcx,%rsi
+    2c9c:	48 89 c7             	mov    %rax,%rdi
+    2c9f:	e8 fc e3 ff ff       	call   10a0 <memcpy@plt>
+}
+    2ca4:	90                   	nop
+    2ca5:	c9                   	leave
+    2ca6:	c3                   	ret
+
+0000000000002ca7 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    2ca7:	55                   	push   %rbp
+    2ca8:	48 89 e5             	mov    %rsp,%rbp
+    2cab:	48 83 ec 20          	sub    $0x20,%rsp
+    2caf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2cb3:	89 f0                	mov    %esi,%eax
+    2cb5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2cb9:	88 45 f4             	mov    %al,-0xc(%rbp)
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    2cbc:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    2cc0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2cc4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cc8:	89 ce                	mov    %ecx,%esi
+    2cca:	48 89 c7             	mov    %rax,%rdi
+    2ccd:	e8 8e e3 ff ff       	call   1060 <memset@plt>
+}
+    2cd2:	90                   	nop
+    2cd3:	c9                   	leave
+    2cd4:	c3                   	ret
+
+0000000000002cd5 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    2cd5:	55                   	push   %rbp
+    2cd6:	48 89 e5             	mov    %rsp,%rbp
+    2cd9:	48 83 ec 20          	sub    $0x20,%rsp
+    2cdd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2ce1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2ce5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    //     *id = *is;
+    // }
+    // for (uint8_t *id = d, *is = s, *const e = (d + n); id != e; ++is, ++id) {
+    //     *is = 0xa5;
+    // }
+    copy(d, s, n);
+    2ce9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2ced:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2cf1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cf5:	48 89 ce             	mov    %rcx,%rsi
+    2cf8:	48 89 c7             	mov    %rax,%rdi
+    2cfb:	e8 79 ff ff ff       	call   2c79 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    poison(s, n);
+    2d00:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2d04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2d08:	48 89 d6             	mov    %rdx,%rsi
+    2d0b:	48 89 c7             	mov    %rax,%rdi
+    2d0e:	e8 60 07 00 00       	call   3473 <nel::elem::poison(unsigned char*, unsigned long)>
+}
+    2d13:	90                   	nop
+    2d14:	c9                   	leave
+    2d15:	c3                   	ret
+
+0000000000002d16 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    2d16:	55                   	push   %rbp
+    2d17:	48 89 e5             	mov    %rsp,%rbp
+    2d1a:	48 83 ec 20          	sub    $0x20,%rsp
+    2d1e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2d22:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2d26:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    std::memmove(d, s, n);
+    2d2a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2d2e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2d32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d36:	48 89 ce             	mov    %rcx,%rsi
+    2d39:	48 89 c7             	mov    %rax,%rdi
+    2d3c:	e8 7f e3 ff ff       	call   10c0 <memmove@plt>
+}
+    2d41:	90                   	nop
+    2d42:	c9                   	leave
+    2d43:	c3                   	ret
+
+0000000000002d44 <nel::elem::wipe(unsigned char*, unsigned long)>:
+
+void wipe(uint8_t *const d, Length const n)
+{
+    2d44:	55                   	push   %rbp
+    2d45:	48 89 e5             	mov    %rsp,%rbp
+    2d48:	48 83 ec 10          	sub    $0x10,%rsp
+    2d4c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2d50:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    set(d, 0xa5, n);
+    2d54:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2d58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d5c:	be a5 00 00 00       	mov    $0xa5,%esi
+    2d61:	48 89 c7             	mov    %rax,%rdi
+    2d64:	e8 3e ff ff ff       	call   2ca7 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    2d69:	90                   	nop
+    2d6a:	c9                   	leave
+    2d6b:	c3                   	ret
+
+0000000000002d6c <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    2d6c:	55                   	push   %rbp
+    2d6d:	48 89 e5             	mov    %rsp,%rbp
+    2d70:	48 83 ec 20          	sub    $0x20,%rsp
+    2d74:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2d78:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2d7c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    2d80:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2d84:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2d88:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d8c:	48 89 ce             	mov    %rcx,%rsi
+    2d8f:	48 89 c7             	mov    %rax,%rdi
+    2d92:	e8 e9 e2 ff ff       	call   1080 <memcmp@plt>
+    2d97:	85 c0                	test   %eax,%eax
+    2d99:	0f 94 c0             	sete   %al
+}
+    2d9c:	c9                   	leave
+    2d9d:	c3                   	ret
+
+0000000000002d9e <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    2d9e:	55                   	push   %rbp
+    2d9f:	48 89 e5             	mov    %rsp,%rbp
+    2da2:	48 83 ec 20          	sub    $0x20,%rsp
+    2da6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2daa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2dae:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    2db2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2db6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2dba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2dbe:	48 89 ce             	mov    %rcx,%rsi
+    2dc1:	48 89 c7             	mov    %rax,%rdi
+    2dc4:	e8 b7 e2 ff ff       	call   1080 <memcmp@plt>
+    2dc9:	85 c0                	test   %eax,%eax
+    2dcb:	0f 95 c0             	setne  %al
+}
+    2dce:	c9                   	leave
+    2dcf:	c3                   	ret
+
+0000000000002dd0 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>:
+
+// d[i] = p[i % 16] for i in [0, n), with normal stores:
+// the pattern once, then doubling the filled region.
+static void set_pattern(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    2dd0:	       55                   	push   %rbp
+    2dd1:	       48 89 e5             	mov    %rsp,%rbp
+    2dd4:	       48 83 ec 30          	sub    $0x30,%rsp
+    2dd8:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2ddc:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2de0:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    Length done = (n < 16) ? n : 16;
+    2de4:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2de8:	       ba 10 00 00 00       	mov    $0x10,%edx
+    2ded:	       48 39 d0             	cmp    %rdx,%rax
+    2df0:	       48 0f 47 c2          	cmova  %rdx,%rax
+    2df4:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    copy(d, p, done);
+    2df8:	       48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2dfc:	       48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2e00:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e04:	       48 89 ce             	mov    %rcx,%rsi
+    2e07:	       48 89 c7             	mov    %rax,%rdi
+    2e0a:	       e8 6a fe ff ff       	call   2c79 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    while (done < n) {
+    2e0f:	   /-- eb 3e                	jmp    2e4f <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x7f>
+        Length const m = (done < n - done) ? done : n - done;
+    2e11:	/--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2e15:	|  |   48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    2e19:	|  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2e1d:	|  |   48 39 c2             	cmp    %rax,%rdx
+    2e20:	|  |   48 0f 46 c2          	cmovbe %rdx,%rax
+    2e24:	|  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        copy(d + done, d, m);
+    2e28:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2e2c:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e30:	|  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    2e34:	|  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2e38:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e3c:	|  |   48 89 c6             	mov    %rax,%rsi
+    2e3f:	|  |   48 89 cf             	mov    %rcx,%rdi
+    2e42:	|  |   e8 32 fe ff ff       	call   2c79 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        done += m;
+    2e47:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e4b:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+    while (done < n) {
+    2e4f:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e53:	|      48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    2e57:	\----- 72 b8                	jb     2e11 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x41>
+    }
+}
+    2e59:	       90                   	nop
+    2e5a:	       90                   	nop
+    2e5b:	       c9                   	leave
+    2e5c:	       c3                   	ret
+
+0000000000002e5d <nel::elem::load16(unsigned char const*)>:
+static constexpr Length streaming_min = 256;
+
+typedef long long int Line16 __attribute__((vector_size(16)));
+
+static inline Line16 load16(uint8_t const *const s)
+{
+    2e5d:	55                   	push   %rbp
+    2e5e:	48 89 e5             	mov    %rsp,%rbp
+    2e61:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Line16 v;
+    std::memcpy(&v, s, sizeof(v));
+    2e65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e69:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2e6d:	48 8b 00             	mov    (%rax),%rax
+    2e70:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2e74:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    return v;
+    2e78:	66 0f 6f 45 f0       	movdqa -0x10(%rbp),%xmm0
+}
+    2e7d:	5d                   	pop    %rbp
+    2e7e:	c3                   	ret
+
+0000000000002e7f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>:
+
+static inline void stream16(uint8_t *const d, Line16 const &v)
+{
+    2e7f:	55                   	push   %rbp
+    2e80:	48 89 e5             	mov    %rsp,%rbp
+    2e83:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2e87:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2e8b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e8f:	66 0f 6f 00          	movdqa (%rax),%xmm0
+    2e93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e97:	66 0f e7 00          	movntdq %xmm0,(%rax)
+}
+    2e9b:	90                   	nop
+    2e9c:	5d                   	pop    %rbp
+    2e9d:	c3                   	ret
+
+0000000000002e9e <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    2e9e:	          55                   	push   %rbp
+    2e9f:	          48 89 e5             	mov    %rsp,%rbp
+    2ea2:	          48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    2ea6:	          48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    2eaa:	          48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    2eae:	          48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    if (n < streaming_min) {
+    2eb2:	          48 81 7d 88 ff 00 00 	cmpq   $0xff,-0x78(%rbp)
+    2eb9:	          00 
+    2eba:	      /-- 77 1c                	ja     2ed8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        copy(d, s, n);
+    2ebc:	      |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    2ec0:	      |   48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    2ec4:	      |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2ec8:	      |   48 89 ce             	mov    %rcx,%rsi
+    2ecb:	      |   48 89 c7             	mov    %rax,%rdi
+    2ece:	      |   e8 a6 fd ff ff       	call   2c79 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        return;
+    2ed3:	/-----|-- e9 98 01 00 00       	jmp    3070 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1d2>
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2ed8:	|     \-> 48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2edc:	|         48 f7 d8             	neg    %rax
+    2edf:	|         83 e0 0f             	and    $0xf,%eax
+    2ee2:	|         48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    copy(d, s, head);
+    2ee6:	|         48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2eea:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    2eee:	|         48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2ef2:	|         48 89 ce             	mov    %rcx,%rsi
+    2ef5:	|         48 89 c7             	mov    %rax,%rdi
+    2ef8:	|         e8 7c fd ff ff       	call   2c79 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    Index i = head;
+    2efd:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2f01:	|         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    2f05:	|     /-- e9 e1 00 00 00       	jmp    2feb <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        Line16 const a = load16(s + i);
+    2f0a:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    2f0e:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f12:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2f15:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2f18:	|  |  |   e8 40 ff ff ff       	call   2e5d <nel::elem::load16(unsigned char const*)>
+    2f1d:	|  |  |   0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+        Line16 const b = load16(s + i + 16);
+    2f21:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f25:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    2f29:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2f2d:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2f30:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2f33:	|  |  |   e8 25 ff ff ff       	call   2e5d <nel::elem::load16(unsigned char const*)>
+    2f38:	|  |  |   0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+        Line16 const c = load16(s + i + 32);
+    2f3c:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f40:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    2f44:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2f48:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2f4b:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2f4e:	|  |  |   e8 0a ff ff ff       	call   2e5d <nel::elem::load16(unsigned char const*)>
+    2f53:	|  |  |   0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+        Line16 const e = load16(s + i + 48);
+    2f57:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f5b:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    2f5f:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2f63:	|  |  |   48 01 d0             	add    %rdx,%rax
+    2f66:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2f69:	|  |  |   e8 ef fe ff ff       	call   2e5d <nel::elem::load16(unsigned char const*)>
+    2f6e:	|  |  |   0f 29 45 a0          	movaps %xmm0,-0x60(%rbp)
+        stream16(d + i, a);
+    2f72:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    2f76:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f7a:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2f7d:	|  |  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    2f81:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2f84:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2f87:	|  |  |   e8 f3 fe ff ff       	call   2e7f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, b);
+    2f8c:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f90:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    2f94:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2f98:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2f9b:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2f9f:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2fa2:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2fa5:	|  |  |   e8 d5 fe ff ff       	call   2e7f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, c);
+    2faa:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2fae:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    2fb2:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2fb6:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2fb9:	|  |  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    2fbd:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2fc0:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2fc3:	|  |  |   e8 b7 fe ff ff       	call   2e7f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, e);
+    2fc8:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2fcc:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    2fd0:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2fd4:	|  |  |   48 01 c2             	add    %rax,%rdx
+    2fd7:	|  |  |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    2fdb:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    2fde:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2fe1:	|  |  |   e8 99 fe ff ff       	call   2e7f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    2fe6:	|  |  |   48 83 45 f8 40       	addq   $0x40,-0x8(%rbp)
+    2feb:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2fef:	|  |      48 83 c0 40          	add    $0x40,%rax
+    2ff3:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    2ff7:	|  \----- 0f 83 0d ff ff ff    	jae    2f0a <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x6c>
+    }
+    for (; i + 16 <= n; i += 16) {
+    2ffd:	|     /-- eb 36                	jmp    3035 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x197>
+        stream16(d + i, load16(s + i));
+    2fff:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3003:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3007:	|  |  |   48 01 d0             	add    %rdx,%rax
+    300a:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    300d:	|  |  |   e8 4b fe ff ff       	call   2e5d <nel::elem::load16(unsigned char const*)>
+    3012:	|  |  |   0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+    3016:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    301a:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    301e:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3021:	|  |  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    3025:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3028:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    302b:	|  |  |   e8 4f fe ff ff       	call   2e7f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    3030:	|  |  |   48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+    3035:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3039:	|  |      48 83 c0 10          	add    $0x10,%rax
+    303d:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    3041:	|  \----- 73 bc                	jae    2fff <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    3043:	|         0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    3046:	|         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    304a:	|         48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    304e:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    3052:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3056:	|         48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    305a:	|         48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+    305e:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3062:	|         48 01 d1             	add    %rdx,%rcx
+    3065:	|         48 89 c2             	mov    %rax,%rdx
+    3068:	|         48 89 cf             	mov    %rcx,%rdi
+    306b:	|         e8 09 fc ff ff       	call   2c79 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+}
+    3070:	\-------> c9                   	leave
+    3071:	          c3                   	ret
+
+0000000000003072 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    3072:	          55                   	push   %rbp
+    3073:	          48 89 e5             	mov    %rsp,%rbp
+    3076:	          48 83 ec 60          	sub    $0x60,%rsp
+    307a:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    307e:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    3082:	          48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    if (n < streaming_min) {
+    3086:	          48 81 7d a8 ff 00 00 	cmpq   $0xff,-0x58(%rbp)
+    308d:	          00 
+    308e:	      /-- 77 1c                	ja     30ac <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        set_pattern(d, p, n);
+    3090:	      |   48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    3094:	      |   48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+    3098:	      |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    309c:	      |   48 89 ce             	mov    %rcx,%rsi
+    309f:	      |   48 89 c7             	mov    %rax,%rdi
+    30a2:	      |   e8 29 fd ff ff       	call   2dd0 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>
+    30a7:	/-----|-- e9 89 01 00 00       	jmp    3235 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c3>
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    30ac:	|     \-> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    30b0:	|         48 f7 d8             	neg    %rax
+    30b3:	|         83 e0 0f             	and    $0xf,%eax
+    30b6:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    for (Index i = 0; i < head; ++i) {
+    30ba:	|         48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    30c1:	|         00 
+    30c2:	|     /-- eb 20                	jmp    30e4 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x72>
+        d[i] = p[i];
+    30c4:	|  /--|-> 48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    30c8:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30cc:	|  |  |   48 01 d0             	add    %rdx,%rax
+    30cf:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    30d3:	|  |  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    30d7:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    30da:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    30dd:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < head; ++i) {
+    30df:	|  |  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    30e4:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30e8:	|  |      48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    30ec:	|  \----- 72 d6                	jb     30c4 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x52>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    30ee:	|         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    30f5:	|         00 
+    30f6:	|     /-- eb 2d                	jmp    3125 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xb3>
+        rotated[i] = p[(head + i) % 16];
+    30f8:	|  /--|-> 48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    30fc:	|  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3100:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3103:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    3106:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    3109:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    310d:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3110:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    3113:	|  |  |   48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    3117:	|  |  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    311b:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    311e:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < 16; ++i) {
+    3120:	|  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    3125:	|  |  \-> 48 83 7d f0 0f       	cmpq   $0xf,-0x10(%rbp)
+    312a:	|  \----- 76 cc                	jbe    30f8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x86>
+    }
+    Line16 const v = load16(rotated);
+    312c:	|         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    3130:	|         48 89 c7             	mov    %rax,%rdi
+    3133:	|         e8 25 fd ff ff       	call   2e5d <nel::elem::load16(unsigned char const*)>
+    3138:	|         0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+    Index i = head;
+    313c:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3140:	|         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    3144:	|     /-- eb 79                	jmp    31bf <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        stream16(d + i, v);
+    3146:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    314a:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    314e:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3151:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3155:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3158:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    315b:	|  |  |   e8 1f fd ff ff       	call   2e7f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, v);
+    3160:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3164:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    3168:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    316c:	|  |  |   48 01 c2             	add    %rax,%rdx
+    316f:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3173:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3176:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3179:	|  |  |   e8 01 fd ff ff       	call   2e7f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, v);
+    317e:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3182:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    3186:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    318a:	|  |  |   48 01 c2             	add    %rax,%rdx
+    318d:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3191:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3194:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3197:	|  |  |   e8 e3 fc ff ff       	call   2e7f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, v);
+    319c:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31a0:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    31a4:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    31a8:	|  |  |   48 01 c2             	add    %rax,%rdx
+    31ab:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    31af:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    31b2:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    31b5:	|  |  |   e8 c5 fc ff ff       	call   2e7f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    31ba:	|  |  |   48 83 45 e8 40       	addq   $0x40,-0x18(%rbp)
+    31bf:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31c3:	|  |      48 83 c0 40          	add    $0x40,%rax
+    31c7:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    31cb:	|  \----- 0f 83 75 ff ff ff    	jae    3146 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd4>
+    }
+    for (; i + 16 <= n; i += 16) {
+    31d1:	|     /-- eb 1f                	jmp    31f2 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x180>
+        stream16(d + i, v);
+    31d3:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    31d7:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31db:	|  |  |   48 01 c2             	add    %rax,%rdx
+    31de:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    31e2:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    31e5:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    31e8:	|  |  |   e8 92 fc ff ff       	call   2e7f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    31ed:	|  |  |   48 83 45 e8 10       	addq   $0x10,-0x18(%rbp)
+    31f2:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31f6:	|  |      48 83 c0 10          	add    $0x10,%rax
+    31fa:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    31fe:	|  \----- 73 d3                	jae    31d3 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    __builtin_ia32_sfence();
+    3200:	|         0f ae f8             	sfence
+    for (; i < n; ++i) {
+    3203:	|     /-- eb 26                	jmp    322b <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1b9>
+        d[i] = p[i % 16];
+    3205:	|  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3209:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    320c:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    320f:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3213:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3216:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    321a:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    321e:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    3221:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    3224:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (; i < n; ++i) {
+    3226:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    322b:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    322f:	|  |      48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    3233:	|  \----- 72 d0                	jb     3205 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x193>
+    }
+}
+    3235:	\-------> c9                   	leave
+    3236:	          c3                   	ret
+
+0000000000003237 <nel::offset_of(unsigned char*, unsigned long)>:
+// The payload is the first align boundary leaving room for a Length in front,
+// which holds the offset from the start of the underlying allocation.
+// Malloc alignment is at least alignof(Length), so the payload is at most
+// align bytes in.
+static Length offset_of(uint8_t *const base, Length const align)
+{
+    3237:	55                   	push   %rbp
+    3238:	48 89 e5             	mov    %rsp,%rbp
+    323b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    323f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    USize const a = reinterpret_cast<USize>(base) + sizeof(Length);
+    3243:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3247:	48 83 c0 08          	add    $0x8,%rax
+    324b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    324f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3253:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3257:	48 01 d0             	add    %rdx,%rax
+    325a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    325e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3262:	48 f7 d8             	neg    %rax
+    3265:	48 21 c2             	and    %rax,%rdx
+    3268:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    326c:	48 29 c2             	sub    %rax,%rdx
+    326f:	48 89 d0             	mov    %rdx,%rax
+}
+    3272:	5d                   	pop    %rbp
+    3273:	c3                   	ret
+
+0000000000003274 <nel::offset_field(unsigned char*)>:
+
+static Length &offset_field(uint8_t *const p)
+{
+    3274:	55                   	push   %rbp
+    3275:	48 89 e5             	mov    %rsp,%rbp
+    3278:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return reinterpret_cast<Length *>(p)[-1];
+    327c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3280:	48 83 e8 08          	sub    $0x8,%rax
+}
+    3284:	5d                   	pop    %rbp
+    3285:	c3                   	ret
+
+0000000000003286 <nel::free_aligned(void*)>:
+
+void free_aligned(void *const p)
+{
+    3286:	       55                   	push   %rbp
+    3287:	       48 89 e5             	mov    %rsp,%rbp
+    328a:	       48 83 ec 20          	sub    $0x20,%rsp
+    328e:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (p == nullptr) { return; }
+    3292:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3297:	/----- 74 2e                	je     32c7 <nel::free_aligned(void*)+0x41>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    3299:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    329d:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    std::free(u8p - offset_field(u8p));
+    32a1:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32a5:	|      48 89 c7             	mov    %rax,%rdi
+    32a8:	|      e8 c7 ff ff ff       	call   3274 <nel::offset_field(unsigned char*)>
+    32ad:	|      48 8b 00             	mov    (%rax),%rax
+    32b0:	|      48 f7 d8             	neg    %rax
+    32b3:	|      48 89 c2             	mov    %rax,%rdx
+    32b6:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32ba:	|      48 01 d0             	add    %rdx,%rax
+    32bd:	|      48 89 c7             	mov    %rax,%rdi
+    32c0:	|      e8 6b dd ff ff       	call   1030 <free@plt>
+    32c5:	|  /-- eb 01                	jmp    32c8 <nel::free_aligned(void*)+0x42>
+    if (p == nullptr) { return; }
+    32c7:	\--|-> 90                   	nop
+}
+    32c8:	   \-> c9                   	leave
+    32c9:	       c3                   	ret
+
+00000000000032ca <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    32ca:	             55                   	push   %rbp
+    32cb:	             48 89 e5             	mov    %rsp,%rbp
+    32ce:	             53                   	push   %rbx
+    32cf:	             48 83 ec 78          	sub    $0x78,%rsp
+    32d3:	             48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    32d7:	             48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    32db:	             48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    32df:	             48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    32e3:	             48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    32e7:	             b9 f3 00 00 00       	mov    $0xf3,%ecx
+    32ec:	             48 8d 15 8d 0e 00 00 	lea    0xe8d(%rip),%rdx        # 4180 <nel::elem::streaming_min+0x8>
+    32f3:	             48 8d 35 98 0e 00 00 	lea    0xe98(%rip),%rsi        # 4192 <nel::elem::streaming_min+0x1a>
+    32fa:	             48 89 c7             	mov    %rax,%rdi
+    32fd:	             e8 fe e9 ff ff       	call   1d00 <nel::Context::Context(char const*, char const*, int)>
+    3302:	             48 83 7d 90 00       	cmpq   $0x0,-0x70(%rbp)
+    3307:	      /----- 74 18                	je     3321 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    3309:	      |      48 8b 45 90          	mov    -0x70(%rbp),%rax
+    330d:	      |      48 83 e8 01          	sub    $0x1,%rax
+    3311:	      |      48 23 45 90          	and    -0x70(%rbp),%rax
+    3315:	      |      48 85 c0             	test   %rax,%rax
+    3318:	      +----- 75 07                	jne    3321 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    331a:	      |      b8 01 00 00 00       	mov    $0x1,%eax
+    331f:	      |  /-- eb 05                	jmp    3326 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x5c>
+    3321:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3326:	         \-> 0f b6 c0             	movzbl %al,%eax
+    3329:	             48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    332d:	             48 8d 0d 6e 0e 00 00 	lea    0xe6e(%rip),%rcx        # 41a2 <nel::elem::streaming_min+0x2a>
+    3334:	             48 89 ce             	mov    %rcx,%rsi
+    3337:	             89 c7                	mov    %eax,%edi
+    3339:	             e8 5b 01 00 00       	call   3499 <nel::assert(bool, char const*, nel::Context const&)>
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    333e:	             48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3342:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    3346:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    334b:	      /----- 74 11                	je     335e <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x94>
+    334d:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3351:	      |      48 89 c7             	mov    %rax,%rdi
+    3354:	      |      e8 1b ff ff ff       	call   3274 <nel::offset_field(unsigned char*)>
+    3359:	      |      48 8b 00             	mov    (%rax),%rax
+    335c:	      |  /-- eb 05                	jmp    3363 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x99>
+    335e:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3363:	         \-> 48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    3367:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    336c:	      /----- 74 13                	je     3381 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb7>
+    336e:	      |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3372:	      |      48 f7 d8             	neg    %rax
+    3375:	      |      48 89 c2             	mov    %rax,%rdx
+    3378:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    337c:	      |      48 01 d0             	add    %rdx,%rax
+    337f:	      |  /-- eb 05                	jmp    3386 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xbc>
+    3381:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3386:	         \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    338a:	             48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    338e:	             48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3392:	             48 01 c2             	add    %rax,%rdx
+    3395:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3399:	             48 89 d6             	mov    %rdx,%rsi
+    339c:	             48 89 c7             	mov    %rax,%rdi
+    339f:	             e8 0c dd ff ff       	call   10b0 <realloc@plt>
+    33a4:	             48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if (new_base == nullptr) { return nullptr; }
+    33a8:	             48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    33ad:	         /-- 75 0a                	jne    33b9 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    33af:	         |   b8 00 00 00 00       	mov    $0x0,%eax
+    33b4:	/--------|-- e9 85 00 00 00       	jmp    343e <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x174>
+
+    Length const new_offset = offset_of(new_base, align);
+    33b9:	|        \-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    33bd:	|            48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    33c1:	|            48 89 d6             	mov    %rdx,%rsi
+    33c4:	|            48 89 c7             	mov    %rax,%rdi
+    33c7:	|            e8 6b fe ff ff       	call   3237 <nel::offset_of(unsigned char*, unsigned long)>
+    33cc:	|            48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    uint8_t *const new_p = new_base + new_offset;
+    33d0:	|            48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    33d4:	|            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    33d8:	|            48 01 d0             	add    %rdx,%rax
+    33db:	|            48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    if (old_p != nullptr && new_offset != old_offset) {
+    33df:	|            48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    33e4:	|  /-------- 74 41                	je     3427 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+    33e6:	|  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    33ea:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    33ee:	|  +-------- 74 37                	je     3427 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+    33f0:	|  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    33f4:	|  |         48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    33f8:	|  |  /----- 73 06                	jae    3400 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x136>
+    33fa:	|  |  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    33fe:	|  |  |  /-- eb 04                	jmp    3404 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x13a>
+    3400:	|  |  \--|-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    3404:	|  |     \-> 48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        std::memmove(new_p, new_base + old_offset, n);
+    3408:	|  |         48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    340c:	|  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3410:	|  |         48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    3414:	|  |         48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    3418:	|  |         48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    341c:	|  |         48 89 ce             	mov    %rcx,%rsi
+    341f:	|  |         48 89 c7             	mov    %rax,%rdi
+    3422:	|  |         e8 99 dc ff ff       	call   10c0 <memmove@plt>
+    }
+    offset_field(new_p) = new_offset;
+    3427:	|  \-------> 48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+    342b:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    342f:	|            48 89 c7             	mov    %rax,%rdi
+    3432:	|            e8 3d fe ff ff       	call   3274 <nel::offset_field(unsigned char*)>
+    3437:	|            48 89 18             	mov    %rbx,(%rax)
+    return new_p;
+    343a:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+}
+    343e:	\----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3442:	             c9                   	leave
+    3443:	             c3                   	ret
+
+0000000000003444 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    3444:	55                   	push   %rbp
+    3445:	48 89 e5             	mov    %rsp,%rbp
+    3448:	48 83 ec 10          	sub    $0x10,%rsp
+    344c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3450:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return realloc_aligned(nullptr, align, 0, size);
+    3454:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3458:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    345c:	48 89 d1             	mov    %rdx,%rcx
+    345f:	ba 00 00 00 00       	mov    $0x0,%edx
+    3464:	48 89 c6             	mov    %rax,%rsi
+    3467:	bf 00 00 00 00       	mov    $0x0,%edi
+    346c:	e8 59 fe ff ff       	call   32ca <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+}
+    3471:	c9                   	leave
+    3472:	c3                   	ret
+
+0000000000003473 <nel::elem::poison(unsigned char*, unsigned long)>:
+{
+    3473:	55                   	push   %rbp
+    3474:	48 89 e5             	mov    %rsp,%rbp
+    3477:	48 83 ec 10          	sub    $0x10,%rsp
+    347b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    347f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    copy(d, s, n);
+    3483:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3487:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    348b:	48 89 d6             	mov    %rdx,%rsi
+    348e:	48 89 c7             	mov    %rax,%rdi
+    3491:	e8 ae f8 ff ff       	call   2d44 <nel::elem::wipe(unsigned char*, unsigned long)>
+}
+    3496:	90                   	nop
+    3497:	c9                   	leave
+    3498:	c3                   	ret
+
+0000000000003499 <nel::assert(bool, char const*, nel::Context const&)>:
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx);
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    3499:	    55                   	push   %rbp
+    349a:	    48 89 e5             	mov    %rsp,%rbp
+    349d:	    48 83 ec 20          	sub    $0x20,%rsp
+    34a1:	    89 f8                	mov    %edi,%eax
+    34a3:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    34a7:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    34ab:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { assert_fail(msg, ctx); }
+    34ae:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    34b2:	    83 f0 01             	xor    $0x1,%eax
+    34b5:	    84 c0                	test   %al,%al
+    34b7:	/-- 74 13                	je     34cc <nel::assert(bool, char const*, nel::Context const&)+0x33>
+    34b9:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    34bd:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    34c1:	|   48 89 d6             	mov    %rdx,%rsi
+    34c4:	|   48 89 c7             	mov    %rax,%rdi
+    34c7:	|   e8 52 f7 ff ff       	call   2c1e <nel::assert_fail(char const*, nel::Context const&)>
+}
+    34cc:	\-> 90                   	nop
+    34cd:	    c9                   	leave
+    34ce:	    c3                   	ret
+
+00000000000034cf <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    34cf:	55                   	push   %rbp
+    34d0:	48 89 e5             	mov    %rsp,%rbp
+    34d3:	48 83 ec 10          	sub    $0x10,%rsp
+    34d7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    34db:	89 f0                	mov    %esi,%eax
+    34dd:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    34e0:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    34e4:	48 8b 15 75 3b 00 00 	mov    0x3b75(%rip),%rdx        # 7060 <stderr@GLIBC_2.2.5>
+    34eb:	48 89 d6             	mov    %rdx,%rsi
+    34ee:	89 c7                	mov    %eax,%edi
+    34f0:	e8 7b db ff ff       	call   1070 <fputc@plt>
+    return outs;
+    34f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    34f9:	c9                   	leave
+    34fa:	c3                   	ret
+
+00000000000034fb <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    34fb:	55                   	push   %rbp
+    34fc:	48 89 e5             	mov    %rsp,%rbp
+    34ff:	48 83 ec 10          	sub    $0x10,%rsp
+    3503:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3507:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    350b:	48 8b 15 4e 3b 00 00 	mov    0x3b4e(%rip),%rdx        # 7060 <stderr@GLIBC_2.2.5>
+    3512:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3516:	48 89 d6             	mov    %rdx,%rsi
+    3519:	48 89 c7             	mov    %rax,%rdi
+    351c:	e8 2f db ff ff       	call   1050 <fputs@plt>
+    return outs;
+    3521:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3525:	c9                   	leave
+    3526:	c3                   	ret
+
+0000000000003527 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    3527:	55                   	push   %rbp
+    3528:	48 89 e5             	mov    %rsp,%rbp
+    352b:	48 83 ec 10          	sub    $0x10,%rsp
+    352f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3533:	89 f0                	mov    %esi,%eax
+    3535:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    3538:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    353c:	48 8b 05 1d 3b 00 00 	mov    0x3b1d(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    3543:	48 8d 0d 73 0c 00 00 	lea    0xc73(%rip),%rcx        # 41bd <nel::elem::streaming_min+0x45>
+    354a:	48 89 ce             	mov    %rcx,%rsi
+    354d:	48 89 c7             	mov    %rax,%rdi
+    3550:	b8 00 00 00 00       	mov    $0x0,%eax
+    3555:	e8 36 db ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    355a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    355e:	c9                   	leave
+    355f:	c3                   	ret
+
+0000000000003560 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    3560:	55                   	push   %rbp
+    3561:	48 89 e5             	mov    %rsp,%rbp
+    3564:	48 83 ec 10          	sub    $0x10,%rsp
+    3568:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    356c:	89 f0                	mov    %esi,%eax
+    356e:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    3572:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    3576:	48 8b 05 e3 3a 00 00 	mov    0x3ae3(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    357d:	48 8d 0d 39 0c 00 00 	lea    0xc39(%rip),%rcx        # 41bd <nel::elem::streaming_min+0x45>
+    3584:	48 89 ce             	mov    %rcx,%rsi
+    3587:	48 89 c7             	mov    %rax,%rdi
+    358a:	b8 00 00 00 00       	mov    $0x0,%eax
+    358f:	e8 fc da ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    3594:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3598:	c9                   	leave
+    3599:	c3                   	ret
+
+000000000000359a <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    359a:	55                   	push   %rbp
+    359b:	48 89 e5             	mov    %rsp,%rbp
+    359e:	48 83 ec 10          	sub    $0x10,%rsp
+    35a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    35a6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    35a9:	48 8b 05 b0 3a 00 00 	mov    0x3ab0(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    35b0:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    35b3:	48 8d 0d 03 0c 00 00 	lea    0xc03(%rip),%rcx        # 41bd <nel::elem::streaming_min+0x45>
+    35ba:	48 89 ce             	mov    %rcx,%rsi
+    35bd:	48 89 c7             	mov    %rax,%rdi
+    35c0:	b8 00 00 00 00       	mov    $0x0,%eax
+    35c5:	e8 c6 da ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    35ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    35ce:	c9                   	leave
+    35cf:	c3                   	ret
+
+00000000000035d0 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    35d0:	55                   	push   %rbp
+    35d1:	48 89 e5             	mov    %rsp,%rbp
+    35d4:	48 83 ec 10          	sub    $0x10,%rsp
+    35d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    35dc:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    35df:	48 8b 05 7a 3a 00 00 	mov    0x3a7a(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    35e6:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    35e9:	48 8d 0d cd 0b 00 00 	lea    0xbcd(%rip),%rcx        # 41bd <nel::elem::streaming_min+0x45>
+    35f0:	48 89 ce             	mov    %rcx,%rsi
+    35f3:	48 89 c7             	mov    %rax,%rdi
+    35f6:	b8 00 00 00 00       	mov    $0x0,%eax
+    35fb:	e8 90 da ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    3600:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3604:	c9                   	leave
+    3605:	c3                   	ret
+
+0000000000003606 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    3606:	55                   	push   %rbp
+    3607:	48 89 e5             	mov    %rsp,%rbp
+    360a:	48 83 ec 10          	sub    $0x10,%rsp
+    360e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3612:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    3616:	48 8b 05 43 3a 00 00 	mov    0x3a43(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    361d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3621:	48 8d 0d 98 0b 00 00 	lea    0xb98(%rip),%rcx        # 41c0 <nel::elem::streaming_min+0x48>
+    3628:	48 89 ce             	mov    %rcx,%rsi
+    362b:	48 89 c7             	mov    %rax,%rdi
+    362e:	b8 00 00 00 00       	mov    $0x0,%eax
+    3633:	e8 58 da ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    3638:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    363c:	c9                   	leave
+    363d:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000003640 <_fini>:
+    3640:	48 83 ec 08          	sub    $0x8,%rsp
+    3644:	48 83 c4 08          	add    $0x8,%rsp
+    3648:	c3                   	ret
@@ -0,0 +1,4229 @@
+
+target/debug/examples/largestruct1_slice:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 5f 00 00 	mov    0x5fc5(%rip),%rax        # 6fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 5f 00 00    	push   0x5fca(%rip)        # 6ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 5f 00 00    	jmp    *0x5fcc(%rip)        # 6ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 5f 00 00    	jmp    *0x5fca(%rip)        # 7000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 5f 00 00    	jmp    *0x5fc2(%rip)        # 7008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 5f 00 00    	jmp    *0x5fba(%rip)        # 7010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memset@plt>:
+    1060:	ff 25 b2 5f 00 00    	jmp    *0x5fb2(%rip)        # 7018 <memset@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 5f 00 00    	jmp    *0x5faa(%rip)        # 7020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 5f 00 00    	jmp    *0x5fa2(%rip)        # 7028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 5f 00 00    	jmp    *0x5f9a(%rip)        # 7030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcpy@plt>:
+    10a0:	ff 25 92 5f 00 00    	jmp    *0x5f92(%rip)        # 7038 <memcpy@GLIBC_2.14>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <realloc@plt>:
+    10b0:	ff 25 8a 5f 00 00    	jmp    *0x5f8a(%rip)        # 7040 <realloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <memmove@plt>:
+    10c0:	ff 25 82 5f 00 00    	jmp    *0x5f82(%rip)        # 7048 <memmove@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010d0 <__cxa_finalize@plt>:
+    10d0:	ff 25 0a 5f 00 00    	jmp    *0x5f0a(%rip)        # 6fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10d6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010e0 <_start>:
+    10e0:	31 ed                	xor    %ebp,%ebp
+    10e2:	49 89 d1             	mov    %rdx,%r9
+    10e5:	5e                   	pop    %rsi
+    10e6:	48 89 e2             	mov    %rsp,%rdx
+    10e9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    10ed:	50                   	push   %rax
+    10ee:	54                   	push   %rsp
+    10ef:	45 31 c0             	xor    %r8d,%r8d
+    10f2:	31 c9                	xor    %ecx,%ecx
+    10f4:	48 8d 3d 42 03 00 00 	lea    0x342(%rip),%rdi        # 143d <main>
+    10fb:	ff 15 bf 5e 00 00    	call   *0x5ebf(%rip)        # 6fc0 <__libc_start_main@GLIBC_2.34>
+    1101:	f4                   	hlt
+    1102:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1109:	00 00 00 
+    110c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001110 <deregister_tm_clones>:
+    1110:	    48 8d 3d 49 5f 00 00 	lea    0x5f49(%rip),%rdi        # 7060 <stderr@GLIBC_2.2.5>
+    1117:	    48 8d 05 42 5f 00 00 	lea    0x5f42(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    111e:	    48 39 f8             	cmp    %rdi,%rax
+    1121:	/-- 74 15                	je     1138 <deregister_tm_clones+0x28>
+    1123:	|   48 8b 05 9e 5e 00 00 	mov    0x5e9e(%rip),%rax        # 6fc8 <_ITM_deregisterTMCloneTable@Base>
+    112a:	|   48 85 c0             	test   %rax,%rax
+    112d:	+-- 74 09                	je     1138 <deregister_tm_clones+0x28>
+    112f:	|   ff e0                	jmp    *%rax
+    1131:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1138:	\-> c3                   	ret
+    1139:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001140 <register_tm_clones>:
+    1140:	    48 8d 3d 19 5f 00 00 	lea    0x5f19(%rip),%rdi        # 7060 <stderr@GLIBC_2.2.5>
+    1147:	    48 8d 35 12 5f 00 00 	lea    0x5f12(%rip),%rsi        # 7060 <stderr@GLIBC_2.2.5>
+    114e:	    48 29 fe             	sub    %rdi,%rsi
+    1151:	    48 89 f0             	mov    %rsi,%rax
+    1154:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1158:	    48 c1 f8 03          	sar    $0x3,%rax
+    115c:	    48 01 c6             	add    %rax,%rsi
+    115f:	    48 d1 fe             	sar    %rsi
+    1162:	/-- 74 14                	je     1178 <register_tm_clones+0x38>
+    1164:	|   48 8b 05 6d 5e 00 00 	mov    0x5e6d(%rip),%rax        # 6fd8 <_ITM_registerTMCloneTable@Base>
+    116b:	|   48 85 c0             	test   %rax,%rax
+    116e:	+-- 74 08                	je     1178 <register_tm_clones+0x38>
+    1170:	|   ff e0                	jmp    *%rax
+    1172:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1178:	\-> c3                   	ret
+    1179:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001180 <__do_global_dtors_aux>:
+    1180:	       f3 0f 1e fa          	endbr64
+    1184:	       80 3d dd 5e 00 00 00 	cmpb   $0x0,0x5edd(%rip)        # 7068 <completed.0>
+    118b:	/----- 75 2b                	jne    11b8 <__do_global_dtors_aux+0x38>
+    118d:	|      55                   	push   %rbp
+    118e:	|      48 83 3d 4a 5e 00 00 	cmpq   $0x0,0x5e4a(%rip)        # 6fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1195:	|      00 
+    1196:	|      48 89 e5             	mov    %rsp,%rbp
+    1199:	|  /-- 74 0c                	je     11a7 <__do_global_dtors_aux+0x27>
+    119b:	|  |   48 8b 3d b6 5e 00 00 	mov    0x5eb6(%rip),%rdi        # 7058 <__dso_handle>
+    11a2:	|  |   e8 29 ff ff ff       	call   10d0 <__cxa_finalize@plt>
+    11a7:	|  \-> e8 64 ff ff ff       	call   1110 <deregister_tm_clones>
+    11ac:	|      c6 05 b5 5e 00 00 01 	movb   $0x1,0x5eb5(%rip)        # 7068 <completed.0>
+    11b3:	|      5d                   	pop    %rbp
+    11b4:	|      c3                   	ret
+    11b5:	|      0f 1f 00             	nopl   (%rax)
+    11b8:	\----> c3                   	ret
+    11b9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011c0 <frame_dummy>:
+    11c0:	f3 0f 1e fa          	endbr64
+    11c4:	e9 77 ff ff ff       	jmp    1140 <register_tm_clones>
+
+00000000000011c9 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    11c9:	55                   	push   %rbp
+    11ca:	48 89 e5             	mov    %rsp,%rbp
+    11cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11d1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    11d4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11d9:	5d                   	pop    %rbp
+    11da:	c3                   	ret
+
+00000000000011db <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    11db:	55                   	push   %rbp
+    11dc:	48 89 e5             	mov    %rsp,%rbp
+    11df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11e3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11e6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return -1;
+    11ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11ef:	5d                   	pop    %rbp
+    11f0:	c3                   	ret
+
+00000000000011f1 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    11f1:	55                   	push   %rbp
+    11f2:	48 89 e5             	mov    %rsp,%rbp
+    11f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11f9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11fc:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    return -1;
+    11ff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1204:	5d                   	pop    %rbp
+    1205:	c3                   	ret
+
+0000000000001206 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    1206:	55                   	push   %rbp
+    1207:	48 89 e5             	mov    %rsp,%rbp
+    120a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    120e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1211:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    1214:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    return -1;
+    1217:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    121c:	5d                   	pop    %rbp
+    121d:	c3                   	ret
+
+000000000000121e <_read_r>:
+int _read_r(struct _reent *, int) {
+    121e:	55                   	push   %rbp
+    121f:	48 89 e5             	mov    %rsp,%rbp
+    1222:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1226:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1229:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    122e:	5d                   	pop    %rbp
+    122f:	c3                   	ret
+
+0000000000001230 <_write_r>:
+int _write_r(struct _reent *, int, char *, int) {
+    1230:	55                   	push   %rbp
+    1231:	48 89 e5             	mov    %rsp,%rbp
+    1234:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1238:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    123b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    123f:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+    return -1;
+    1242:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1247:	5d                   	pop    %rbp
+    1248:	c3                   	ret
+
+0000000000001249 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    1249:	55                   	push   %rbp
+    124a:	48 89 e5             	mov    %rsp,%rbp
+    124d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return -1;
+    1251:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1256:	5d                   	pop    %rbp
+    1257:	c3                   	ret
+
+0000000000001258 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1258:	55                   	push   %rbp
+    1259:	48 89 e5             	mov    %rsp,%rbp
+    125c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1260:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1263:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1268:	5d                   	pop    %rbp
+    1269:	c3                   	ret
+
+000000000000126a <ex1()>:
+#include "libnosys_stubs.cx"
+
+typedef nel::heaped::Vector<U8Buf<256>> Vec1;
+
+void ex1(void)
+{
+    126a:	55                   	push   %rbp
+    126b:	48 89 e5             	mov    %rsp,%rbp
+    126e:	48 81 ec b0 03 00 00 	sub    $0x3b0,%rsp
+    Vec1 vec1 = Vec1::with_capacity(5);
+    1275:	48 8d 85 68 fc ff ff 	lea    -0x398(%rbp),%rax
+    127c:	be 05 00 00 00       	mov    $0x5,%esi
+    1281:	48 89 c7             	mov    %rax,%rdi
+    1284:	e8 ff 04 00 00       	call   1788 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+
+    vec1.push((uint8_t)0x67).is_ok();
+    1289:	c6 85 7f fd ff ff 67 	movb   $0x67,-0x281(%rbp)
+    1290:	48 8d 85 70 fc ff ff 	lea    -0x390(%rbp),%rax
+    1297:	48 8d 95 7f fd ff ff 	lea    -0x281(%rbp),%rdx
+    129e:	48 8d 8d 68 fc ff ff 	lea    -0x398(%rbp),%rcx
+    12a5:	48 89 ce             	mov    %rcx,%rsi
+    12a8:	48 89 c7             	mov    %rax,%rdi
+    12ab:	e8 5e 05 00 00       	call   180e <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    12b0:	48 8d 85 80 fd ff ff 	lea    -0x280(%rbp),%rax
+    12b7:	b9 0f 00 00 00       	mov    $0xf,%ecx
+    12bc:	48 8d 15 65 2d 00 00 	lea    0x2d65(%rip),%rdx        # 4028 <nel::sort::ninther_n+0x8>
+    12c3:	48 8d 35 7d 2d 00 00 	lea    0x2d7d(%rip),%rsi        # 4047 <nel::sort::ninther_n+0x27>
+    12ca:	48 89 c7             	mov    %rax,%rdi
+    12cd:	e8 da 01 00 00       	call   14ac <nel::Context::Context(char const*, char const*, int)>
+    12d2:	48 8d 95 80 fd ff ff 	lea    -0x280(%rbp),%rdx
+    12d9:	48 8d 85 70 fc ff ff 	lea    -0x390(%rbp),%rax
+    12e0:	48 89 d6             	mov    %rdx,%rsi
+    12e3:	48 89 c7             	mov    %rax,%rdi
+    12e6:	e8 85 06 00 00       	call   1970 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    12eb:	48 8d 85 70 fc ff ff 	lea    -0x390(%rbp),%rax
+    12f2:	48 89 c7             	mov    %rax,%rdi
+    12f5:	e8 e0 05 00 00       	call   18da <nel::Result<void, U8Buf<256ul> >::~Result()>
+    vec1.push((uint8_t)0x68).is_ok();
+    12fa:	c6 85 af fe ff ff 68 	movb   $0x68,-0x151(%rbp)
+    1301:	48 8d 85 a0 fd ff ff 	lea    -0x260(%rbp),%rax
+    1308:	48 8d 95 af fe ff ff 	lea    -0x151(%rbp),%rdx
+    130f:	48 8d 8d 68 fc ff ff 	lea    -0x398(%rbp),%rcx
+    1316:	48 89 ce             	mov    %rcx,%rsi
+    1319:	48 89 c7             	mov    %rax,%rdi
+    131c:	e8 ed 04 00 00       	call   180e <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    1321:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    1328:	b9 10 00 00 00       	mov    $0x10,%ecx
+    132d:	48 8d 15 f4 2c 00 00 	lea    0x2cf4(%rip),%rdx        # 4028 <nel::sort::ninther_n+0x8>
+    1334:	48 8d 35 0c 2d 00 00 	lea    0x2d0c(%rip),%rsi        # 4047 <nel::sort::ninther_n+0x27>
+    133b:	48 89 c7             	mov    %rax,%rdi
+    133e:	e8 69 01 00 00       	call   14ac <nel::Context::Context(char const*, char const*, int)>
+    1343:	48 8d 95 b0 fe ff ff 	lea    -0x150(%rbp),%rdx
+    134a:	48 8d 85 a0 fd ff ff 	lea    -0x260(%rbp),%rax
+    1351:	48 89 d6             	mov    %rdx,%rsi
+    1354:	48 89 c7             	mov    %rax,%rdi
+    1357:	e8 14 06 00 00       	call   1970 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    135c:	48 8d 85 a0 fd ff ff 	lea    -0x260(%rbp),%rax
+    1363:	48 89 c7             	mov    %rax,%rdi
+    1366:	e8 6f 05 00 00       	call   18da <nel::Result<void, U8Buf<256ul> >::~Result()>
+    vec1.push((uint8_t)0x69).is_ok();
+    136b:	c6 45 df 69          	movb   $0x69,-0x21(%rbp)
+    136f:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    1376:	48 8d 55 df          	lea    -0x21(%rbp),%rdx
+    137a:	48 8d 8d 68 fc ff ff 	lea    -0x398(%rbp),%rcx
+    1381:	48 89 ce             	mov    %rcx,%rsi
+    1384:	48 89 c7             	mov    %rax,%rdi
+    1387:	e8 82 04 00 00       	call   180e <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    138c:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1390:	b9 11 00 00 00       	mov    $0x11,%ecx
+    1395:	48 8d 15 8c 2c 00 00 	lea    0x2c8c(%rip),%rdx        # 4028 <nel::sort::ninther_n+0x8>
+    139c:	48 8d 35 a4 2c 00 00 	lea    0x2ca4(%rip),%rsi        # 4047 <nel::sort::ninther_n+0x27>
+    13a3:	48 89 c7             	mov    %rax,%rdi
+    13a6:	e8 01 01 00 00       	call   14ac <nel::Context::Context(char const*, char const*, int)>
+    13ab:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    13af:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    13b6:	48 89 d6             	mov    %rdx,%rsi
+    13b9:	48 89 c7             	mov    %rax,%rdi
+    13bc:	e8 af 05 00 00       	call   1970 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    13c1:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    13c8:	48 89 c7             	mov    %rax,%rdi
+    13cb:	e8 0a 05 00 00       	call   18da <nel::Result<void, U8Buf<256ul> >::~Result()>
+
+    auto s1 = vec1.slice();
+    13d0:	48 8d 85 50 fc ff ff 	lea    -0x3b0(%rbp),%rax
+    13d7:	48 8d 95 68 fc ff ff 	lea    -0x398(%rbp),%rdx
+    13de:	48 89 d6             	mov    %rdx,%rsi
+    13e1:	48 89 c7             	mov    %rax,%rdi
+    13e4:	e8 8d 02 00 00       	call   1676 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()>
+    nel::log << s1.len() << '\n' << s1;
+    13e9:	48 8d 85 50 fc ff ff 	lea    -0x3b0(%rbp),%rax
+    13f0:	48 89 c7             	mov    %rax,%rdi
+    13f3:	e8 fc 05 00 00       	call   19f4 <nel::Slice<U8Buf<256ul> >::len() const>
+    13f8:	48 89 c6             	mov    %rax,%rsi
+    13fb:	48 8d 05 67 5c 00 00 	lea    0x5c67(%rip),%rax        # 7069 <nel::log>
+    1402:	48 89 c7             	mov    %rax,%rdi
+    1405:	e8 da 22 00 00       	call   36e4 <nel::operator<<(nel::Log&, unsigned long)>
+    140a:	be 0a 00 00 00       	mov    $0xa,%esi
+    140f:	48 89 c7             	mov    %rax,%rdi
+    1412:	e8 96 21 00 00       	call   35ad <nel::operator<<(nel::Log&, char)>
+    1417:	48 89 c2             	mov    %rax,%rdx
+    141a:	48 8d 85 50 fc ff ff 	lea    -0x3b0(%rbp),%rax
+    1421:	48 89 c6             	mov    %rax,%rsi
+    1424:	48 89 d7             	mov    %rdx,%rdi
+    1427:	e8 6f 06 00 00       	call   1a9b <nel::operator<<(nel::Log&, nel::Slice<U8Buf<256ul> > const&)>
+}
+    142c:	48 8d 85 68 fc ff ff 	lea    -0x398(%rbp),%rax
+    1433:	48 89 c7             	mov    %rax,%rdi
+    1436:	e8 b5 03 00 00       	call   17f0 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    143b:	c9                   	leave
+    143c:	c3                   	ret
+
+000000000000143d <main>:
+
+int main()
+{
+    143d:	55                   	push   %rbp
+    143e:	48 89 e5             	mov    %rsp,%rbp
+    nel::log << "ex1:b" << '\n';
+    1441:	48 8d 05 03 2c 00 00 	lea    0x2c03(%rip),%rax        # 404b <nel::sort::ninther_n+0x2b>
+    1448:	48 89 c6             	mov    %rax,%rsi
+    144b:	48 8d 05 17 5c 00 00 	lea    0x5c17(%rip),%rax        # 7069 <nel::log>
+    1452:	48 89 c7             	mov    %rax,%rdi
+    1455:	e8 7f 21 00 00       	call   35d9 <nel::operator<<(nel::Log&, char const*)>
+    145a:	be 0a 00 00 00       	mov    $0xa,%esi
+    145f:	48 89 c7             	mov    %rax,%rdi
+    1462:	e8 46 21 00 00       	call   35ad <nel::operator<<(nel::Log&, char)>
+    ex1();
+    1467:	e8 fe fd ff ff       	call   126a <ex1()>
+    nel::log << "ex1:e" << '\n';
+    146c:	48 8d 05 de 2b 00 00 	lea    0x2bde(%rip),%rax        # 4051 <nel::sort::ninther_n+0x31>
+    1473:	48 89 c6             	mov    %rax,%rsi
+    1476:	48 8d 05 ec 5b 00 00 	lea    0x5bec(%rip),%rax        # 7069 <nel::log>
+    147d:	48 89 c7             	mov    %rax,%rdi
+    1480:	e8 54 21 00 00       	call   35d9 <nel::operator<<(nel::Log&, char const*)>
+    1485:	be 0a 00 00 00       	mov    $0xa,%esi
+    148a:	48 89 c7             	mov    %rax,%rdi
+    148d:	e8 1b 21 00 00       	call   35ad <nel::operator<<(nel::Log&, char)>
+}
+    1492:	b8 00 00 00 00       	mov    $0x0,%eax
+    1497:	5d                   	pop    %rbp
+    1498:	c3                   	ret
+
+0000000000001499 <operator new(unsigned long, void*)>:
+void ex1(void)
+    1499:	55                   	push   %rbp
+    149a:	48 89 e5             	mov    %rsp,%rbp
+    149d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    14a1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+{
+    14a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    Vec1 vec1 = Vec1::with_capacity(5);
+    14a9:	5d                   	pop    %rbp
+    14aa:	c3                   	ret
+    14ab:	90                   	nop
+
+00000000000014ac <nel::Context::Context(char const*, char const*, int)>:
+        char const *fn_name_;
+        char const *file_name_;
+        int line_num_;
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+    14ac:	55                   	push   %rbp
+    14ad:	48 89 e5             	mov    %rsp,%rbp
+    14b0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    14b4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    14b8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    14bc:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    14bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14c3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    14c7:	48 89 10             	mov    %rdx,(%rax)
+            , file_name_(file_name)
+    14ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14ce:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    14d2:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , line_num_(line_num)
+    14d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14da:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    14dd:	89 50 10             	mov    %edx,0x10(%rax)
+        {
+        }
+    14e0:	90                   	nop
+    14e1:	5d                   	pop    %rbp
+    14e2:	c3                   	ret
+
+00000000000014e3 <nel::assert(bool, char const*, nel::Context const&)>:
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx);
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    14e3:	    55                   	push   %rbp
+    14e4:	    48 89 e5             	mov    %rsp,%rbp
+    14e7:	    48 83 ec 20          	sub    $0x20,%rsp
+    14eb:	    89 f8                	mov    %edi,%eax
+    14ed:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    14f1:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    14f5:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { assert_fail(msg, ctx); }
+    14f8:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    14fc:	    83 f0 01             	xor    $0x1,%eax
+    14ff:	    84 c0                	test   %al,%al
+    1501:	/-- 74 13                	je     1516 <nel::assert(bool, char const*, nel::Context const&)+0x33>
+    1503:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1507:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    150b:	|   48 89 d6             	mov    %rdx,%rsi
+    150e:	|   48 89 c7             	mov    %rax,%rdi
+    1511:	|   e8 1c 18 00 00       	call   2d32 <nel::assert_fail(char const*, nel::Context const&)>
+}
+    1516:	\-> 90                   	nop
+    1517:	    c9                   	leave
+    1518:	    c3                   	ret
+
+0000000000001519 <nel::heaped::Malloc::try_malloc(unsigned long, unsigned long)>:
+ * and friends (see memory.hh).
+ */
+struct Malloc
+{
+    public:
+        static Result<void *, AllocError> try_malloc(Length const align, Length const size)
+    1519:	55                   	push   %rbp
+    151a:	48 89 e5             	mov    %rsp,%rbp
+    151d:	48 83 ec 20          	sub    $0x20,%rsp
+    1521:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1525:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1529:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            return try_realloc(nullptr, align, 0, size);
+    152d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1531:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1535:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1539:	49 89 c8             	mov    %rcx,%r8
+    153c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1541:	be 00 00 00 00       	mov    $0x0,%esi
+    1546:	48 89 c7             	mov    %rax,%rdi
+    1549:	e8 06 00 00 00       	call   1554 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>
+        }
+    154e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1552:	c9                   	leave
+    1553:	c3                   	ret
+
+0000000000001554 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>:
+
+        static Result<void *, AllocError> try_realloc(void *const p,
+    1554:	          55                   	push   %rbp
+    1555:	          48 89 e5             	mov    %rsp,%rbp
+    1558:	          48 83 ec 40          	sub    $0x40,%rsp
+    155c:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1560:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1564:	          48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    1568:	          48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    156c:	          4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+                                                      Length const align,
+                                                      Length const old_size,
+                                                      Length const new_size)
+        {
+            if (align == 0 || (align & (align - 1)) != 0) {
+    1570:	          48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    1575:	      /-- 74 11                	je     1588 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x34>
+    1577:	      |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    157b:	      |   48 83 e8 01          	sub    $0x1,%rax
+    157f:	      |   48 23 45 d8          	and    -0x28(%rbp),%rax
+    1583:	      |   48 85 c0             	test   %rax,%rax
+    1586:	   /--|-- 74 1c                	je     15a4 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x50>
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+    1588:	   |  \-> c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+    158f:	   |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1593:	   |      48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    1597:	   |      48 89 d6             	mov    %rdx,%rsi
+    159a:	   |      48 89 c7             	mov    %rax,%rdi
+    159d:	   |      e8 7e 01 00 00       	call   1720 <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+                                    : std::realloc(p, new_size);
+            if (new_p == nullptr) {
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+            }
+            return Result<void *, AllocError>::Ok(new_p);
+        }
+    15a2:	/--|----- eb 79                	jmp    161d <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            void *const new_p = is_over_aligned(align)
+    15a4:	|  \----> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    15a8:	|         48 89 c7             	mov    %rax,%rdi
+    15ab:	|         e8 b4 00 00 00       	call   1664 <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+                                    ? realloc_aligned(p, align, old_size, new_size)
+    15b0:	|         84 c0                	test   %al,%al
+    15b2:	|  /----- 74 1a                	je     15ce <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x7a>
+    15b4:	|  |      48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+    15b8:	|  |      48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    15bc:	|  |      48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+    15c0:	|  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    15c4:	|  |      48 89 c7             	mov    %rax,%rdi
+    15c7:	|  |      e8 12 1e 00 00       	call   33de <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+    15cc:	|  |  /-- eb 13                	jmp    15e1 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x8d>
+                                    : std::realloc(p, new_size);
+    15ce:	|  \--|-> 48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    15d2:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    15d6:	|     |   48 89 d6             	mov    %rdx,%rsi
+    15d9:	|     |   48 89 c7             	mov    %rax,%rdi
+    15dc:	|     |   e8 cf fa ff ff       	call   10b0 <realloc@plt>
+    15e1:	|     \-> 48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            if (new_p == nullptr) {
+    15e5:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15e9:	|         48 85 c0             	test   %rax,%rax
+    15ec:	|     /-- 75 1c                	jne    160a <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xb6>
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+    15ee:	|     |   c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    15f5:	|     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15f9:	|     |   48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    15fd:	|     |   48 89 d6             	mov    %rdx,%rsi
+    1600:	|     |   48 89 c7             	mov    %rax,%rdi
+    1603:	|     |   e8 18 01 00 00       	call   1720 <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+        }
+    1608:	+-----|-- eb 13                	jmp    161d <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            return Result<void *, AllocError>::Ok(new_p);
+    160a:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    160e:	|         48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    1612:	|         48 89 d6             	mov    %rdx,%rsi
+    1615:	|         48 89 c7             	mov    %rax,%rdi
+    1618:	|         e8 37 01 00 00       	call   1754 <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>
+        }
+    161d:	\-------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1621:	          c9                   	leave
+    1622:	          c3                   	ret
+
+0000000000001623 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>:
+
+        static void free(void *const p, Length const align, Length const size)
+    1623:	       55                   	push   %rbp
+    1624:	       48 89 e5             	mov    %rsp,%rbp
+    1627:	       48 83 ec 20          	sub    $0x20,%rsp
+    162b:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    162f:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1633:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+    1637:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    163b:	       48 89 c7             	mov    %rax,%rdi
+    163e:	       e8 21 00 00 00       	call   1664 <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+    1643:	       84 c0                	test   %al,%al
+    1645:	/----- 74 0e                	je     1655 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x32>
+                free_aligned(p);
+    1647:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    164b:	|      48 89 c7             	mov    %rax,%rdi
+    164e:	|      e8 47 1d 00 00       	call   339a <nel::free_aligned(void*)>
+            } else {
+                std::free(p);
+            }
+        }
+    1653:	|  /-- eb 0c                	jmp    1661 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x3e>
+                std::free(p);
+    1655:	\--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1659:	   |   48 89 c7             	mov    %rax,%rdi
+    165c:	   |   e8 cf f9 ff ff       	call   1030 <free@plt>
+        }
+    1661:	   \-> 90                   	nop
+    1662:	       c9                   	leave
+    1663:	       c3                   	ret
+
+0000000000001664 <nel::heaped::Malloc::is_over_aligned(unsigned long)>:
+
+    private:
+        static constexpr bool is_over_aligned(Length const align)
+    1664:	55                   	push   %rbp
+    1665:	48 89 e5             	mov    %rsp,%rbp
+    1668:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return align > alignof(std::max_align_t);
+    166c:	48 83 7d f8 10       	cmpq   $0x10,-0x8(%rbp)
+    1671:	0f 97 c0             	seta   %al
+        }
+    1674:	5d                   	pop    %rbp
+    1675:	c3                   	ret
+
+0000000000001676 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()>:
+         * Slice does not own the contents, vector does (vector is still valid).
+         * Slice is invalidated if Vector goes out of scope/destroyed.
+         *
+         * @returns a slice over the the vector.
+         */
+        constexpr Slice<Type> slice(void)
+    1676:	       55                   	push   %rbp
+    1677:	       48 89 e5             	mov    %rsp,%rbp
+    167a:	       48 83 ec 10          	sub    $0x10,%rsp
+    167e:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1682:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            return (item_ == nullptr) ? Slice<Type>::empty() : item_->slice();
+    1686:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    168a:	       48 8b 00             	mov    (%rax),%rax
+    168d:	       48 85 c0             	test   %rax,%rax
+    1690:	   /-- 75 0e                	jne    16a0 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()+0x2a>
+    1692:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1696:	   |   48 89 c7             	mov    %rax,%rdi
+    1699:	   |   e8 fc 02 00 00       	call   199a <nel::Slice<U8Buf<256ul> >::empty()>
+    169e:	/--|-- eb 16                	jmp    16b6 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()+0x40>
+    16a0:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16a4:	|      48 8b 10             	mov    (%rax),%rdx
+    16a7:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16ab:	|      48 89 d6             	mov    %rdx,%rsi
+    16ae:	|      48 89 c7             	mov    %rax,%rdi
+    16b1:	|      e8 02 03 00 00       	call   19b8 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::slice()>
+        }
+    16b6:	\----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16ba:	       c9                   	leave
+    16bb:	       c3                   	ret
+
+00000000000016bc <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+                Element<T> ok_;
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    16bc:	             55                   	push   %rbp
+    16bd:	             48 89 e5             	mov    %rsp,%rbp
+    16c0:	             48 83 ec 30          	sub    $0x30,%rsp
+    16c4:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result::dtor
+    16c8:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    16cc:	             8b 00                	mov    (%rax),%eax
+    16ce:	             83 f8 02             	cmp    $0x2,%eax
+    16d1:	/----------- 74 43                	je     1716 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5a>
+    16d3:	|            83 f8 02             	cmp    $0x2,%eax
+    16d6:	|        /-- 7f 09                	jg     16e1 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x25>
+    16d8:	|        |   85 c0                	test   %eax,%eax
+    16da:	|  /-----|-- 74 3d                	je     1719 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5d>
+    16dc:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    16df:	|  |  /--|-- 74 3b                	je     171c <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x60>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    16e1:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    16e5:	|  |  |      b9 72 00 00 00       	mov    $0x72,%ecx
+    16ea:	|  |  |      48 8d 15 66 29 00 00 	lea    0x2966(%rip),%rdx        # 4057 <nel::sort::ninther_n+0x37>
+    16f1:	|  |  |      48 8d 35 71 29 00 00 	lea    0x2971(%rip),%rsi        # 4069 <nel::sort::ninther_n+0x49>
+    16f8:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    16fb:	|  |  |      e8 ac fd ff ff       	call   14ac <nel::Context::Context(char const*, char const*, int)>
+    1700:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1704:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    1707:	|  |  |      48 8d 05 63 29 00 00 	lea    0x2963(%rip),%rax        # 4071 <nel::sort::ninther_n+0x51>
+    170e:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1711:	|  |  |      e8 c1 15 00 00       	call   2cd7 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    1716:	\--|--|----> 90                   	nop
+    1717:	   |  |  /-- eb 04                	jmp    171d <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    1719:	   \--|--|-> 90                   	nop
+    171a:	      |  +-- eb 01                	jmp    171d <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    171c:	      \--|-> 90                   	nop
+                    break;
+            }
+        }
+    171d:	         \-> 90                   	nop
+    171e:	             c9                   	leave
+    171f:	             c3                   	ret
+
+0000000000001720 <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>:
+         *
+         * @param val The value to move into the result as an err value.
+         *
+         * @returns a Result 'wrapping' the value given as an err value.
+         */
+        constexpr static Result Err(E &&val)
+    1720:	55                   	push   %rbp
+    1721:	48 89 e5             	mov    %rsp,%rbp
+    1724:	48 83 ec 10          	sub    $0x10,%rsp
+    1728:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    172c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            return Result(Phantom<Tag::ERR>(), forward<E>(val));
+    1730:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1734:	48 89 c7             	mov    %rax,%rdi
+    1737:	e8 38 04 00 00       	call   1b74 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    173c:	48 89 c2             	mov    %rax,%rdx
+    173f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1743:	48 89 d6             	mov    %rdx,%rsi
+    1746:	48 89 c7             	mov    %rax,%rdi
+    1749:	e8 34 04 00 00       	call   1b82 <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>
+        }
+    174e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1752:	c9                   	leave
+    1753:	c3                   	ret
+
+0000000000001754 <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>:
+        constexpr static Result Ok(Args &&...args)
+    1754:	55                   	push   %rbp
+    1755:	48 89 e5             	mov    %rsp,%rbp
+    1758:	48 83 ec 10          	sub    $0x10,%rsp
+    175c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1760:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<Args>(args)...);
+    1764:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1768:	48 89 c7             	mov    %rax,%rdi
+    176b:	e8 53 04 00 00       	call   1bc3 <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    1770:	48 89 c2             	mov    %rax,%rdx
+    1773:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1777:	48 89 d6             	mov    %rdx,%rsi
+    177a:	48 89 c7             	mov    %rax,%rdi
+    177d:	e8 50 04 00 00       	call   1bd2 <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>
+        }
+    1782:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1786:	c9                   	leave
+    1787:	c3                   	ret
+
+0000000000001788 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>:
+        static constexpr Vector with_capacity(Count cap)
+    1788:	       55                   	push   %rbp
+    1789:	       48 89 e5             	mov    %rsp,%rbp
+    178c:	       48 83 ec 20          	sub    $0x20,%rsp
+    1790:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1794:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            if (cap == 0) { return Vector(); }
+    1798:	       48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    179d:	   /-- 75 0e                	jne    17ad <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x25>
+    179f:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17a3:	   |   48 89 c7             	mov    %rax,%rdi
+    17a6:	   |   e8 69 04 00 00       	call   1c14 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector()>
+    17ab:	/--|-- eb 3d                	jmp    17ea <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x62>
+            Vector a(VectorNode::malloc(cap));
+    17ad:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    17b1:	|      48 89 c7             	mov    %rax,%rdi
+    17b4:	|      e8 71 04 00 00       	call   1c2a <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::malloc(unsigned long)>
+    17b9:	|      48 89 c2             	mov    %rax,%rdx
+    17bc:	|      48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    17c0:	|      48 89 d6             	mov    %rdx,%rsi
+    17c3:	|      48 89 c7             	mov    %rax,%rdi
+    17c6:	|      e8 99 04 00 00       	call   1c64 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*)>
+            return a;
+    17cb:	|      48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    17cf:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17d3:	|      48 89 d6             	mov    %rdx,%rsi
+    17d6:	|      48 89 c7             	mov    %rax,%rdi
+    17d9:	|      e8 a0 04 00 00       	call   1c7e <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >&&)>
+        }
+    17de:	|      48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    17e2:	|      48 89 c7             	mov    %rax,%rdi
+    17e5:	|      e8 06 00 00 00       	call   17f0 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    17ea:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17ee:	       c9                   	leave
+    17ef:	       c3                   	ret
+
+00000000000017f0 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>:
+        ~Vector(void)
+    17f0:	55                   	push   %rbp
+    17f1:	48 89 e5             	mov    %rsp,%rbp
+    17f4:	48 83 ec 10          	sub    $0x10,%rsp
+    17f8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            VectorNode::free(item_);
+    17fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1800:	48 8b 00             	mov    (%rax),%rax
+    1803:	48 89 c7             	mov    %rax,%rdi
+    1806:	e8 bd 04 00 00       	call   1cc8 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*)>
+        }
+    180b:	90                   	nop
+    180c:	c9                   	leave
+    180d:	c3                   	ret
+
+000000000000180e <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>:
+            return item_->push_back(l);
+        }
+#    endif
+
+        template<typename... Args>
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Args &&...args)
+    180e:	       55                   	push   %rbp
+    180f:	       48 89 e5             	mov    %rsp,%rbp
+    1812:	       53                   	push   %rbx
+    1813:	       48 83 ec 38          	sub    $0x38,%rsp
+    1817:	       48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    181b:	       48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    181f:	       48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+        {
+            bool ok;
+            ok = try_reserve_for(1);
+    1823:	       48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1827:	       be 01 00 00 00       	mov    $0x1,%esi
+    182c:	       48 89 c7             	mov    %rax,%rdi
+    182f:	       e8 e0 04 00 00       	call   1d14 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>
+    1834:	       88 45 ef             	mov    %al,-0x11(%rbp)
+            if (!ok) { return Result<void, Type>::Err(forward<Args>(args)...); }
+    1837:	       0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+    183b:	       83 f0 01             	xor    $0x1,%eax
+    183e:	       84 c0                	test   %al,%al
+    1840:	   /-- 74 20                	je     1862 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x54>
+    1842:	   |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1846:	   |   48 89 c7             	mov    %rax,%rdi
+    1849:	   |   e8 31 05 00 00       	call   1d7f <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    184e:	   |   48 89 c2             	mov    %rax,%rdx
+    1851:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1855:	   |   48 89 d6             	mov    %rdx,%rsi
+    1858:	   |   48 89 c7             	mov    %rax,%rdi
+    185b:	   |   e8 2d 05 00 00       	call   1d8d <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<unsigned char>(unsigned char&&)>
+    1860:	/--|-- eb 51                	jmp    18b3 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0xa5>
+            if (item_ == nullptr) { return Result<void, Type>::Err(forward<Args>(args)...); }
+    1862:	|  \-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1866:	|      48 8b 00             	mov    (%rax),%rax
+    1869:	|      48 85 c0             	test   %rax,%rax
+    186c:	|  /-- 75 20                	jne    188e <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x80>
+    186e:	|  |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1872:	|  |   48 89 c7             	mov    %rax,%rdi
+    1875:	|  |   e8 05 05 00 00       	call   1d7f <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    187a:	|  |   48 89 c2             	mov    %rax,%rdx
+    187d:	|  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1881:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1884:	|  |   48 89 c7             	mov    %rax,%rdi
+    1887:	|  |   e8 01 05 00 00       	call   1d8d <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<unsigned char>(unsigned char&&)>
+    188c:	+--|-- eb 25                	jmp    18b3 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0xa5>
+            return item_->push_back(forward<Args>(args)...);
+    188e:	|  \-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1892:	|      48 8b 18             	mov    (%rax),%rbx
+    1895:	|      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1899:	|      48 89 c7             	mov    %rax,%rdi
+    189c:	|      e8 de 04 00 00       	call   1d7f <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    18a1:	|      48 89 c2             	mov    %rax,%rdx
+    18a4:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    18a8:	|      48 89 de             	mov    %rbx,%rsi
+    18ab:	|      48 89 c7             	mov    %rax,%rdi
+    18ae:	|      e8 0f 05 00 00       	call   1dc2 <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::push_back<unsigned char>(unsigned char&&)>
+        }
+    18b3:	\----> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    18b7:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    18bb:	       c9                   	leave
+    18bc:	       c3                   	ret
+    18bd:	       90                   	nop
+
+00000000000018be <nel::Element<U8Buf<256ul> >::~Element()>:
+
+    private:
+        Type value_;
+
+    public:
+        constexpr ~Element(void) = default;
+    18be:	55                   	push   %rbp
+    18bf:	48 89 e5             	mov    %rsp,%rbp
+    18c2:	48 83 ec 10          	sub    $0x10,%rsp
+    18c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    18ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18ce:	48 89 c7             	mov    %rax,%rdi
+    18d1:	e8 b8 05 00 00       	call   1e8e <U8Buf<256ul>::~U8Buf()>
+    18d6:	90                   	nop
+    18d7:	c9                   	leave
+    18d8:	c3                   	ret
+    18d9:	90                   	nop
+
+00000000000018da <nel::Result<void, U8Buf<256ul> >::~Result()>:
+        union {
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    18da:	             55                   	push   %rbp
+    18db:	             48 89 e5             	mov    %rsp,%rbp
+    18de:	             48 83 ec 30          	sub    $0x30,%rsp
+    18e2:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result<void>-dtor
+    18e6:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    18ea:	             8b 00                	mov    (%rax),%eax
+    18ec:	             83 f8 02             	cmp    $0x2,%eax
+    18ef:	         /-- 74 10                	je     1901 <nel::Result<void, U8Buf<256ul> >::~Result()+0x27>
+    18f1:	         |   83 f8 02             	cmp    $0x2,%eax
+    18f4:	      /--|-- 7f 1d                	jg     1913 <nel::Result<void, U8Buf<256ul> >::~Result()+0x39>
+    18f6:	      |  |   85 c0                	test   %eax,%eax
+    18f8:	/-----|--|-- 74 4e                	je     1948 <nel::Result<void, U8Buf<256ul> >::~Result()+0x6e>
+    18fa:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    18fd:	|     +--|-- 75 14                	jne    1913 <nel::Result<void, U8Buf<256ul> >::~Result()+0x39>
+                case Tag::OK:
+                    break;
+    18ff:	|  /--|--|-- eb 48                	jmp    1949 <nel::Result<void, U8Buf<256ul> >::~Result()+0x6f>
+
+                case Tag::ERR:
+                    err_.~Element<E>();
+    1901:	|  |  |  \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1905:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    1909:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    190c:	|  |  |      e8 ad ff ff ff       	call   18be <nel::Element<U8Buf<256ul> >::~Element()>
+                    break;
+    1911:	|  +--|----- eb 36                	jmp    1949 <nel::Result<void, U8Buf<256ul> >::~Result()+0x6f>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    1913:	|  |  \----> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1917:	|  |         b9 dd 02 00 00       	mov    $0x2dd,%ecx
+    191c:	|  |         48 8d 15 34 27 00 00 	lea    0x2734(%rip),%rdx        # 4057 <nel::sort::ninther_n+0x37>
+    1923:	|  |         48 8d 35 3f 27 00 00 	lea    0x273f(%rip),%rsi        # 4069 <nel::sort::ninther_n+0x49>
+    192a:	|  |         48 89 c7             	mov    %rax,%rdi
+    192d:	|  |         e8 7a fb ff ff       	call   14ac <nel::Context::Context(char const*, char const*, int)>
+    1932:	|  |         48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1936:	|  |         48 89 c6             	mov    %rax,%rsi
+    1939:	|  |         48 8d 05 31 27 00 00 	lea    0x2731(%rip),%rax        # 4071 <nel::sort::ninther_n+0x51>
+    1940:	|  |         48 89 c7             	mov    %rax,%rdi
+    1943:	|  |         e8 8f 13 00 00       	call   2cd7 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    1948:	\--|-------> 90                   	nop
+                    break;
+            }
+        }
+    1949:	   \-------> 90                   	nop
+    194a:	             c9                   	leave
+    194b:	             c3                   	ret
+
+000000000000194c <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}::operator()() const>:
+         *
+         * `this` is not consumed by this op.
+         */
+        constexpr bool is_ok(Context const &ctx = Context()) const
+        {
+            return match<bool>([](void) -> bool { return true; },
+    194c:	55                   	push   %rbp
+    194d:	48 89 e5             	mov    %rsp,%rbp
+    1950:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1954:	b8 01 00 00 00       	mov    $0x1,%eax
+    1959:	5d                   	pop    %rbp
+    195a:	c3                   	ret
+    195b:	90                   	nop
+
+000000000000195c <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}::operator()(U8Buf<256ul> const&) const>:
+                               [](E const &) -> bool { return false; },
+    195c:	55                   	push   %rbp
+    195d:	48 89 e5             	mov    %rsp,%rbp
+    1960:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1964:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1968:	b8 00 00 00 00       	mov    $0x0,%eax
+    196d:	5d                   	pop    %rbp
+    196e:	c3                   	ret
+    196f:	90                   	nop
+
+0000000000001970 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>:
+        constexpr bool is_ok(Context const &ctx = Context()) const
+    1970:	55                   	push   %rbp
+    1971:	48 89 e5             	mov    %rsp,%rbp
+    1974:	48 83 ec 20          	sub    $0x20,%rsp
+    1978:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    197c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](void) -> bool { return true; },
+    1980:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1984:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    1988:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    198c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1990:	48 89 c7             	mov    %rax,%rdi
+    1993:	e8 1c 05 00 00       	call   1eb4 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const>
+                               ctx);
+        }
+    1998:	c9                   	leave
+    1999:	c3                   	ret
+
+000000000000199a <nel::Slice<U8Buf<256ul> >::empty()>:
+        /**
+         * Create an empty slice.
+         *
+         * @return fresh empty slice
+         */
+        static constexpr Slice empty(void)
+    199a:	55                   	push   %rbp
+    199b:	48 89 e5             	mov    %rsp,%rbp
+    199e:	48 83 ec 10          	sub    $0x10,%rsp
+    19a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return Slice();
+    19a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19aa:	48 89 c7             	mov    %rax,%rdi
+    19ad:	e8 94 05 00 00       	call   1f46 <nel::Slice<U8Buf<256ul> >::Slice()>
+        }
+    19b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19b6:	c9                   	leave
+    19b7:	c3                   	ret
+
+00000000000019b8 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::slice()>:
+        {
+            return len() == 0;
+        }
+
+    public:
+        constexpr Slice<Type> slice(void)
+    19b8:	55                   	push   %rbp
+    19b9:	48 89 e5             	mov    %rsp,%rbp
+    19bc:	48 83 ec 10          	sub    $0x10,%rsp
+    19c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    19c4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            return Slice(values_, len());
+    19c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19cc:	48 89 c7             	mov    %rax,%rdi
+    19cf:	e8 94 05 00 00       	call   1f68 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::len() const>
+    19d4:	48 89 c2             	mov    %rax,%rdx
+    19d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19db:	48 8d 48 10          	lea    0x10(%rax),%rcx
+    19df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19e3:	48 89 ce             	mov    %rcx,%rsi
+    19e6:	48 89 c7             	mov    %rax,%rdi
+    19e9:	e8 8c 05 00 00       	call   1f7a <nel::Slice<U8Buf<256ul> >::Slice(U8Buf<256ul>*, unsigned long)>
+        }
+    19ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19f2:	c9                   	leave
+    19f3:	c3                   	ret
+
+00000000000019f4 <nel::Slice<U8Buf<256ul> >::len() const>:
+        /**
+         * Determine numer of elements in the slice.
+         *
+         * @returns number of elements in the slice.
+         */
+        constexpr Length len(void) const
+    19f4:	55                   	push   %rbp
+    19f5:	48 89 e5             	mov    %rsp,%rbp
+    19f8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return len_;
+    19fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a00:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    1a04:	5d                   	pop    %rbp
+    1a05:	c3                   	ret
+
+0000000000001a06 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::operator bool() const>:
+        // Double-ended iterators also step/read from the back,
+        // dec() drops the last item, deref_back() returns it.
+        void dec(void);
+        OutT deref_back(void);
+
+        constexpr operator bool(void) const
+    1a06:	55                   	push   %rbp
+    1a07:	48 89 e5             	mov    %rsp,%rbp
+    1a0a:	48 83 ec 10          	sub    $0x10,%rsp
+    1a0e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return !self().is_done();
+    1a12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a16:	48 89 c7             	mov    %rax,%rdi
+    1a19:	e8 0e 00 00 00       	call   1a2c <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self() const>
+    1a1e:	48 89 c7             	mov    %rax,%rdi
+    1a21:	e8 1c 00 00 00       	call   1a42 <nel::SliceIterator<U8Buf<256ul> >::is_done() const>
+    1a26:	83 f0 01             	xor    $0x1,%eax
+        }
+    1a29:	c9                   	leave
+    1a2a:	c3                   	ret
+    1a2b:	90                   	nop
+
+0000000000001a2c <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self() const>:
+        constexpr ItT const &self(void) const
+    1a2c:	55                   	push   %rbp
+    1a2d:	48 89 e5             	mov    %rsp,%rbp
+    1a30:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT const &it = static_cast<ItT const &>(*this);
+    1a34:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a38:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    1a3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1a40:	5d                   	pop    %rbp
+    1a41:	c3                   	ret
+
+0000000000001a42 <nel::SliceIterator<U8Buf<256ul> >::is_done() const>:
+        }
+#    endif
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+    1a42:	55                   	push   %rbp
+    1a43:	48 89 e5             	mov    %rsp,%rbp
+    1a46:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return (b_ == e_);
+    1a4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a4e:	48 8b 10             	mov    (%rax),%rdx
+    1a51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a55:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1a59:	48 39 c2             	cmp    %rax,%rdx
+    1a5c:	0f 94 c0             	sete   %al
+        }
+    1a5f:	5d                   	pop    %rbp
+    1a60:	c3                   	ret
+    1a61:	90                   	nop
+
+0000000000001a62 <nel::operator<<(nel::Log&, nel::Slice<U8Buf<256ul> > const&)::{lambda(U8Buf<256ul> const&)#1}::operator()(U8Buf<256ul> const&) const>:
+                it.for_each([&outs](T const &e) { outs << ' ' << e; });
+    1a62:	55                   	push   %rbp
+    1a63:	48 89 e5             	mov    %rsp,%rbp
+    1a66:	48 83 ec 10          	sub    $0x10,%rsp
+    1a6a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a6e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1a72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a76:	48 8b 00             	mov    (%rax),%rax
+    1a79:	be 20 00 00 00       	mov    $0x20,%esi
+    1a7e:	48 89 c7             	mov    %rax,%rdi
+    1a81:	e8 27 1b 00 00       	call   35ad <nel::operator<<(nel::Log&, char)>
+    1a86:	48 89 c2             	mov    %rax,%rdx
+    1a89:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a8d:	48 89 c6             	mov    %rax,%rsi
+    1a90:	48 89 d7             	mov    %rdx,%rdi
+    1a93:	e8 7a 05 00 00       	call   2012 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    1a98:	90                   	nop
+    1a99:	c9                   	leave
+    1a9a:	c3                   	ret
+
+0000000000001a9b <nel::operator<<(nel::Log&, nel::Slice<U8Buf<256ul> > const&)>:
+        friend Log &operator<<(Log &outs, Slice const &v)
+    1a9b:	    55                   	push   %rbp
+    1a9c:	    48 89 e5             	mov    %rsp,%rbp
+    1a9f:	    53                   	push   %rbx
+    1aa0:	    48 83 ec 38          	sub    $0x38,%rsp
+    1aa4:	    48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+    1aa8:	    48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+            outs << "Slice(" << v.len() << "){";
+    1aac:	    48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1ab0:	    48 8d 15 c5 25 00 00 	lea    0x25c5(%rip),%rdx        # 407c <nel::sort::ninther_n+0x5c>
+    1ab7:	    48 89 d6             	mov    %rdx,%rsi
+    1aba:	    48 89 c7             	mov    %rax,%rdi
+    1abd:	    e8 17 1b 00 00       	call   35d9 <nel::operator<<(nel::Log&, char const*)>
+    1ac2:	    48 89 c3             	mov    %rax,%rbx
+    1ac5:	    48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1ac9:	    48 89 c7             	mov    %rax,%rdi
+    1acc:	    e8 23 ff ff ff       	call   19f4 <nel::Slice<U8Buf<256ul> >::len() const>
+    1ad1:	    48 89 c6             	mov    %rax,%rsi
+    1ad4:	    48 89 df             	mov    %rbx,%rdi
+    1ad7:	    e8 08 1c 00 00       	call   36e4 <nel::operator<<(nel::Log&, unsigned long)>
+    1adc:	    48 89 c2             	mov    %rax,%rdx
+    1adf:	    48 8d 05 9d 25 00 00 	lea    0x259d(%rip),%rax        # 4083 <nel::sort::ninther_n+0x63>
+    1ae6:	    48 89 c6             	mov    %rax,%rsi
+    1ae9:	    48 89 d7             	mov    %rdx,%rdi
+    1aec:	    e8 e8 1a 00 00       	call   35d9 <nel::operator<<(nel::Log&, char const*)>
+            auto it = v.iter();
+    1af1:	    48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1af5:	    48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1af9:	    48 89 d6             	mov    %rdx,%rsi
+    1afc:	    48 89 c7             	mov    %rax,%rdi
+    1aff:	    e8 a0 04 00 00       	call   1fa4 <nel::Slice<U8Buf<256ul> >::iter() const>
+            if (it) {
+    1b04:	    48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1b08:	    48 89 c7             	mov    %rax,%rdi
+    1b0b:	    e8 f6 fe ff ff       	call   1a06 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::operator bool() const>
+    1b10:	    84 c0                	test   %al,%al
+    1b12:	/-- 74 45                	je     1b59 <nel::operator<<(nel::Log&, nel::Slice<U8Buf<256ul> > const&)+0xbe>
+                outs << *it;
+    1b14:	|   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1b18:	|   48 89 c7             	mov    %rax,%rdi
+    1b1b:	|   e8 d0 04 00 00       	call   1ff0 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::operator*()>
+    1b20:	|   48 89 c2             	mov    %rax,%rdx
+    1b23:	|   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1b27:	|   48 89 d6             	mov    %rdx,%rsi
+    1b2a:	|   48 89 c7             	mov    %rax,%rdi
+    1b2d:	|   e8 e0 04 00 00       	call   2012 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+                ++it;
+    1b32:	|   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1b36:	|   48 89 c7             	mov    %rax,%rdi
+    1b39:	|   e8 c8 05 00 00       	call   2106 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::operator++()>
+                it.for_each([&outs](T const &e) { outs << ' ' << e; });
+    1b3e:	|   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1b42:	|   48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1b46:	|   48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+    1b4a:	|   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1b4e:	|   48 89 d6             	mov    %rdx,%rsi
+    1b51:	|   48 89 c7             	mov    %rax,%rdi
+    1b54:	|   e8 d3 05 00 00       	call   212c <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<nel::operator<<(nel::Log&, nel::Slice<U8Buf<256ul> > const&)::{lambda(U8Buf<256ul> const&)#1}>(nel::operator<<(nel::Log&, nel::Slice<U8Buf<256ul> > const&)::{lambda(U8Buf<256ul> const&)#1}&&)>
+            outs << '}';
+    1b59:	\-> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1b5d:	    be 7d 00 00 00       	mov    $0x7d,%esi
+    1b62:	    48 89 c7             	mov    %rax,%rdi
+    1b65:	    e8 43 1a 00 00       	call   35ad <nel::operator<<(nel::Log&, char)>
+            return outs;
+    1b6a:	    48 8b 45 c8          	mov    -0x38(%rbp),%rax
+        }
+    1b6e:	    48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1b72:	    c9                   	leave
+    1b73:	    c3                   	ret
+
+0000000000001b74 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel so to not need std.
+ */
+template<typename U, typename T>
+constexpr U &&forward(T &t)
+    1b74:	55                   	push   %rbp
+    1b75:	48 89 e5             	mov    %rsp,%rbp
+    1b78:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<U &&>(t);
+    1b7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1b80:	5d                   	pop    %rbp
+    1b81:	c3                   	ret
+
+0000000000001b82 <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    1b82:	55                   	push   %rbp
+    1b83:	48 89 e5             	mov    %rsp,%rbp
+    1b86:	53                   	push   %rbx
+    1b87:	48 83 ec 18          	sub    $0x18,%rsp
+    1b8b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1b8f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    1b93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b97:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    1b9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ba1:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    1ba5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ba9:	48 89 c7             	mov    %rax,%rdi
+    1bac:	e8 c3 ff ff ff       	call   1b74 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    1bb1:	48 89 c6             	mov    %rax,%rsi
+    1bb4:	48 89 df             	mov    %rbx,%rdi
+    1bb7:	e8 dc 05 00 00       	call   2198 <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>
+        }
+    1bbc:	90                   	nop
+    1bbd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1bc1:	c9                   	leave
+    1bc2:	c3                   	ret
+
+0000000000001bc3 <void* const& nel::forward<void* const&, void* const>(void* const&)>:
+constexpr U &&forward(T &t)
+    1bc3:	55                   	push   %rbp
+    1bc4:	48 89 e5             	mov    %rsp,%rbp
+    1bc7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    1bcb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1bcf:	5d                   	pop    %rbp
+    1bd0:	c3                   	ret
+    1bd1:	90                   	nop
+
+0000000000001bd2 <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>:
+        constexpr Result(Phantom<Tag::OK> const, Args &&...args)
+    1bd2:	55                   	push   %rbp
+    1bd3:	48 89 e5             	mov    %rsp,%rbp
+    1bd6:	53                   	push   %rbx
+    1bd7:	48 83 ec 18          	sub    $0x18,%rsp
+    1bdb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1bdf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    1be3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1be7:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<Args>(args)...)
+    1bed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bf1:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    1bf5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1bf9:	48 89 c7             	mov    %rax,%rdi
+    1bfc:	e8 c2 ff ff ff       	call   1bc3 <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    1c01:	48 89 c6             	mov    %rax,%rsi
+    1c04:	48 89 df             	mov    %rbx,%rdi
+    1c07:	e8 b4 05 00 00       	call   21c0 <nel::Element<void*>::Element<void* const&>(void* const&)>
+        }
+    1c0c:	90                   	nop
+    1c0d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1c11:	c9                   	leave
+    1c12:	c3                   	ret
+    1c13:	90                   	nop
+
+0000000000001c14 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector()>:
+        constexpr Vector(void)
+    1c14:	55                   	push   %rbp
+    1c15:	48 89 e5             	mov    %rsp,%rbp
+    1c18:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : item_(nullptr)
+    1c1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c20:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        }
+    1c27:	90                   	nop
+    1c28:	5d                   	pop    %rbp
+    1c29:	c3                   	ret
+
+0000000000001c2a <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::malloc(unsigned long)>:
+        static Node *malloc(Count capacity)
+    1c2a:	    55                   	push   %rbp
+    1c2b:	    48 89 e5             	mov    %rsp,%rbp
+    1c2e:	    48 83 ec 20          	sub    $0x20,%rsp
+    1c32:	    48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            Node *new_n = realloc(nullptr, capacity);
+    1c36:	    48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c3a:	    48 89 c6             	mov    %rax,%rsi
+    1c3d:	    bf 00 00 00 00       	mov    $0x0,%edi
+    1c42:	    e8 9c 06 00 00       	call   22e3 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)>
+    1c47:	    48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    1c4b:	    48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1c50:	/-- 74 0c                	je     1c5e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::malloc(unsigned long)+0x34>
+    1c52:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c56:	|   48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    1c5d:	|   00 
+            return new_n;
+    1c5e:	\-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    1c62:	    c9                   	leave
+    1c63:	    c3                   	ret
+
+0000000000001c64 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*)>:
+        constexpr Vector(VectorNode *const n)
+    1c64:	55                   	push   %rbp
+    1c65:	48 89 e5             	mov    %rsp,%rbp
+    1c68:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1c6c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : item_(n)
+    1c70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c74:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1c78:	48 89 10             	mov    %rdx,(%rax)
+        }
+    1c7b:	90                   	nop
+    1c7c:	5d                   	pop    %rbp
+    1c7d:	c3                   	ret
+
+0000000000001c7e <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >&&)>:
+        constexpr Vector(Vector &&o)
+    1c7e:	55                   	push   %rbp
+    1c7f:	48 89 e5             	mov    %rsp,%rbp
+    1c82:	48 83 ec 10          	sub    $0x10,%rsp
+    1c86:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1c8a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : item_(move(o.item_))
+    1c8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c92:	48 89 c7             	mov    %rax,%rdi
+    1c95:	e8 69 08 00 00       	call   2503 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*&& nel::move<nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*>(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*&)>
+    1c9a:	48 8b 10             	mov    (%rax),%rdx
+    1c9d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ca1:	48 89 10             	mov    %rdx,(%rax)
+            o.item_ = nullptr;
+    1ca4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ca8:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        }
+    1caf:	90                   	nop
+    1cb0:	c9                   	leave
+    1cb1:	c3                   	ret
+
+0000000000001cb2 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::size_of(unsigned long)>:
+        static constexpr Length size_of(Count const cap)
+    1cb2:	55                   	push   %rbp
+    1cb3:	48 89 e5             	mov    %rsp,%rbp
+    1cb6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1cba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cbe:	48 c1 e0 08          	shl    $0x8,%rax
+    1cc2:	48 83 c0 10          	add    $0x10,%rax
+        }
+    1cc6:	5d                   	pop    %rbp
+    1cc7:	c3                   	ret
+
+0000000000001cc8 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*)>:
+        static void free(Node *old)
+    1cc8:	       55                   	push   %rbp
+    1cc9:	       48 89 e5             	mov    %rsp,%rbp
+    1ccc:	       48 83 ec 20          	sub    $0x20,%rsp
+    1cd0:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            if (old == nullptr) { return; }
+    1cd4:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1cd9:	/----- 74 36                	je     1d11 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*)+0x49>
+            Length const sz = size_of(old->alloc_);
+    1cdb:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cdf:	|      48 8b 00             	mov    (%rax),%rax
+    1ce2:	|      48 89 c7             	mov    %rax,%rdi
+    1ce5:	|      e8 c8 ff ff ff       	call   1cb2 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::size_of(unsigned long)>
+    1cea:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            old->~Node();
+    1cee:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cf2:	|      48 89 c7             	mov    %rax,%rdi
+    1cf5:	|      e8 18 08 00 00       	call   2512 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::~Node()>
+            Allocator::free(old, alignof(Node), sz);
+    1cfa:	|      48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1cfe:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d02:	|      be 08 00 00 00       	mov    $0x8,%esi
+    1d07:	|      48 89 c7             	mov    %rax,%rdi
+    1d0a:	|      e8 14 f9 ff ff       	call   1623 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>
+    1d0f:	|  /-- eb 01                	jmp    1d12 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*)+0x4a>
+            if (old == nullptr) { return; }
+    1d11:	\--|-> 90                   	nop
+        }
+    1d12:	   \-> c9                   	leave
+    1d13:	       c3                   	ret
+
+0000000000001d14 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>:
+        bool try_reserve_for(Count const n)
+    1d14:	       55                   	push   %rbp
+    1d15:	       48 89 e5             	mov    %rsp,%rbp
+    1d18:	       53                   	push   %rbx
+    1d19:	       48 83 ec 18          	sub    $0x18,%rsp
+    1d1d:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1d21:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            if (len() + n <= capacity()) { return true; }
+    1d25:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d29:	       48 89 c7             	mov    %rax,%rdi
+    1d2c:	       e8 33 08 00 00       	call   2564 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    1d31:	       48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1d35:	       48 8d 1c 10          	lea    (%rax,%rdx,1),%rbx
+    1d39:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d3d:	       48 89 c7             	mov    %rax,%rdi
+    1d40:	       e8 4f 08 00 00       	call   2594 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    1d45:	       48 39 d8             	cmp    %rbx,%rax
+    1d48:	       0f 93 c0             	setae  %al
+    1d4b:	       84 c0                	test   %al,%al
+    1d4d:	   /-- 74 07                	je     1d56 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x42>
+    1d4f:	   |   b8 01 00 00 00       	mov    $0x1,%eax
+    1d54:	/--|-- eb 23                	jmp    1d79 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x65>
+            return try_reserve(len() + n);
+    1d56:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d5a:	|      48 89 c7             	mov    %rax,%rdi
+    1d5d:	|      e8 02 08 00 00       	call   2564 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    1d62:	|      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1d66:	|      48 01 c2             	add    %rax,%rdx
+    1d69:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d6d:	|      48 89 d6             	mov    %rdx,%rsi
+    1d70:	|      48 89 c7             	mov    %rax,%rdi
+    1d73:	|      e8 4c 08 00 00       	call   25c4 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>
+    1d78:	|      90                   	nop
+        }
+    1d79:	\----> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1d7d:	       c9                   	leave
+    1d7e:	       c3                   	ret
+
+0000000000001d7f <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>:
+constexpr U &&forward(T &t)
+    1d7f:	55                   	push   %rbp
+    1d80:	48 89 e5             	mov    %rsp,%rbp
+    1d83:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    1d87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1d8b:	5d                   	pop    %rbp
+    1d8c:	c3                   	ret
+
+0000000000001d8d <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<unsigned char>(unsigned char&&)>:
+        constexpr static Result Err(Args &&...args)
+    1d8d:	55                   	push   %rbp
+    1d8e:	48 89 e5             	mov    %rsp,%rbp
+    1d91:	48 83 ec 10          	sub    $0x10,%rsp
+    1d95:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1d99:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    1d9d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1da1:	48 89 c7             	mov    %rax,%rdi
+    1da4:	e8 d6 ff ff ff       	call   1d7f <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    1da9:	48 89 c2             	mov    %rax,%rdx
+    1dac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1db0:	48 89 d6             	mov    %rdx,%rsi
+    1db3:	48 89 c7             	mov    %rax,%rdi
+    1db6:	e8 5d 09 00 00       	call   2718 <nel::Result<void, U8Buf<256ul> >::Result<unsigned char>(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)2>, unsigned char&&)>
+        }
+    1dbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dbf:	c9                   	leave
+    1dc0:	c3                   	ret
+    1dc1:	90                   	nop
+
+0000000000001dc2 <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::push_back<unsigned char>(unsigned char&&)>:
+            }
+        }
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+    1dc2:	       55                   	push   %rbp
+    1dc3:	       48 89 e5             	mov    %rsp,%rbp
+    1dc6:	       53                   	push   %rbx
+    1dc7:	       48 83 ec 28          	sub    $0x28,%rsp
+    1dcb:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1dcf:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1dd3:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+        {
+            if (len() >= capacity()) {
+    1dd7:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ddb:	       48 89 c7             	mov    %rax,%rdi
+    1dde:	       e8 85 01 00 00       	call   1f68 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::len() const>
+    1de3:	       48 89 c3             	mov    %rax,%rbx
+    1de6:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1dea:	       48 89 c7             	mov    %rax,%rdi
+    1ded:	       e8 68 09 00 00       	call   275a <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::capacity() const>
+    1df2:	       48 39 c3             	cmp    %rax,%rbx
+    1df5:	       0f 93 c0             	setae  %al
+    1df8:	       84 c0                	test   %al,%al
+    1dfa:	   /-- 74 20                	je     1e1c <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::push_back<unsigned char>(unsigned char&&)+0x5a>
+                // TODO: don't want to create a T on error though..
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+    1dfc:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1e00:	   |   48 89 c7             	mov    %rax,%rdi
+    1e03:	   |   e8 77 ff ff ff       	call   1d7f <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    1e08:	   |   48 89 c2             	mov    %rax,%rdx
+    1e0b:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e0f:	   |   48 89 d6             	mov    %rdx,%rsi
+    1e12:	   |   48 89 c7             	mov    %rax,%rdi
+    1e15:	   |   e8 73 ff ff ff       	call   1d8d <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<unsigned char>(unsigned char&&)>
+    1e1a:	/--|-- eb 67                	jmp    1e83 <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::push_back<unsigned char>(unsigned char&&)+0xc1>
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    1e1c:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e20:	|      48 89 c7             	mov    %rax,%rdi
+    1e23:	|      e8 40 01 00 00       	call   1f68 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::len() const>
+    1e28:	|      48 c1 e0 08          	shl    $0x8,%rax
+    1e2c:	|      48 8d 50 10          	lea    0x10(%rax),%rdx
+    1e30:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e34:	|      48 01 d0             	add    %rdx,%rax
+    1e37:	|      48 89 c6             	mov    %rax,%rsi
+    1e3a:	|      bf 00 01 00 00       	mov    $0x100,%edi
+    1e3f:	|      e8 55 f6 ff ff       	call   1499 <operator new(unsigned long, void*)>
+    1e44:	|      48 89 c3             	mov    %rax,%rbx
+    1e47:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1e4b:	|      48 89 c7             	mov    %rax,%rdi
+    1e4e:	|      e8 2c ff ff ff       	call   1d7f <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    1e53:	|      0f b6 00             	movzbl (%rax),%eax
+    1e56:	|      0f b6 c0             	movzbl %al,%eax
+    1e59:	|      89 c6                	mov    %eax,%esi
+    1e5b:	|      48 89 df             	mov    %rbx,%rdi
+    1e5e:	|      e8 09 09 00 00       	call   276c <U8Buf<256ul>::U8Buf(unsigned char)>
+            len_ += 1;
+    1e63:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e67:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    1e6b:	|      48 8d 50 01          	lea    0x1(%rax),%rdx
+    1e6f:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e73:	|      48 89 50 08          	mov    %rdx,0x8(%rax)
+            return Result<void, Type>::Ok();
+    1e77:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e7b:	|      48 89 c7             	mov    %rax,%rdi
+    1e7e:	|      e8 14 09 00 00       	call   2797 <nel::Result<void, U8Buf<256ul> >::Ok()>
+        }
+    1e83:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e87:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1e8b:	       c9                   	leave
+    1e8c:	       c3                   	ret
+    1e8d:	       90                   	nop
+
+0000000000001e8e <U8Buf<256ul>::~U8Buf()>:
+        // default I want is create with uninitialised array..
+        // maybe a uninitialised ctor then?
+        // U8Buf(void) = default;
+        constexpr U8Buf(void) {}
+
+        constexpr ~U8Buf(void)
+    1e8e:	55                   	push   %rbp
+    1e8f:	48 89 e5             	mov    %rsp,%rbp
+    1e92:	48 83 ec 10          	sub    $0x10,%rsp
+    1e96:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            nel::elem::set(data_, 0xa5, N);
+    1e9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e9e:	ba 00 01 00 00       	mov    $0x100,%edx
+    1ea3:	be a5 00 00 00       	mov    $0xa5,%esi
+    1ea8:	48 89 c7             	mov    %rax,%rdi
+    1eab:	e8 0b 0f 00 00       	call   2dbb <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    1eb0:	90                   	nop
+    1eb1:	c9                   	leave
+    1eb2:	c3                   	ret
+    1eb3:	90                   	nop
+
+0000000000001eb4 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    1eb4:	             55                   	push   %rbp
+    1eb5:	             48 89 e5             	mov    %rsp,%rbp
+    1eb8:	             48 83 ec 20          	sub    $0x20,%rsp
+    1ebc:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1ec0:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1ec4:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1ec8:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result<void>-match
+    1ecc:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ed0:	             8b 00                	mov    (%rax),%eax
+    1ed2:	             83 f8 02             	cmp    $0x2,%eax
+    1ed5:	         /-- 74 1c                	je     1ef3 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x3f>
+    1ed7:	         |   83 f8 02             	cmp    $0x2,%eax
+    1eda:	/--------|-- 7f 51                	jg     1f2d <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x79>
+    1edc:	|        |   85 c0                	test   %eax,%eax
+    1ede:	|     /--|-- 74 37                	je     1f17 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x63>
+    1ee0:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    1ee3:	+-----|--|-- 75 48                	jne    1f2d <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x79>
+                    return on_ok();
+    1ee5:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ee9:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    1eec:	|     |  |   e8 5b fa ff ff       	call   194c <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}::operator()() const>
+    1ef1:	|  /--|--|-- eb 50                	jmp    1f43 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_err(*err_);
+    1ef3:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ef7:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    1efb:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1efe:	|  |  |      e8 b3 08 00 00       	call   27b6 <nel::Element<U8Buf<256ul> >::operator*() const>
+    1f03:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    1f06:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f0a:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    1f0d:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1f10:	|  |  |      e8 47 fa ff ff       	call   195c <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}::operator()(U8Buf<256ul> const&) const>
+    1f15:	|  +--|----- eb 2c                	jmp    1f43 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x8f>
+                    nel::panic("invalid Result", ctx);
+    1f17:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f1b:	|  |         48 89 c6             	mov    %rax,%rsi
+    1f1e:	|  |         48 8d 05 61 21 00 00 	lea    0x2161(%rip),%rax        # 4086 <nel::sort::ninther_n+0x66>
+    1f25:	|  |         48 89 c7             	mov    %rax,%rdi
+    1f28:	|  |         e8 aa 0d 00 00       	call   2cd7 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    1f2d:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f31:	   |         48 89 c6             	mov    %rax,%rsi
+    1f34:	   |         48 8d 05 36 21 00 00 	lea    0x2136(%rip),%rax        # 4071 <nel::sort::ninther_n+0x51>
+    1f3b:	   |         48 89 c7             	mov    %rax,%rdi
+    1f3e:	   |         e8 94 0d 00 00       	call   2cd7 <nel::panic(char const*, nel::Context const&)>
+        }
+    1f43:	   \-------> c9                   	leave
+    1f44:	             c3                   	ret
+    1f45:	             90                   	nop
+
+0000000000001f46 <nel::Slice<U8Buf<256ul> >::Slice()>:
+        constexpr Slice(void)
+    1f46:	55                   	push   %rbp
+    1f47:	48 89 e5             	mov    %rsp,%rbp
+    1f4a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : content_(nullptr)
+    1f4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f52:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+            , len_(0)
+    1f59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f5d:	48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    1f64:	00 
+        }
+    1f65:	90                   	nop
+    1f66:	5d                   	pop    %rbp
+    1f67:	c3                   	ret
+
+0000000000001f68 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::len() const>:
+        constexpr Length len(void) const
+    1f68:	55                   	push   %rbp
+    1f69:	48 89 e5             	mov    %rsp,%rbp
+    1f6c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    1f70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f74:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    1f78:	5d                   	pop    %rbp
+    1f79:	c3                   	ret
+
+0000000000001f7a <nel::Slice<U8Buf<256ul> >::Slice(U8Buf<256ul>*, unsigned long)>:
+        constexpr Slice(Type *const p, Length len)
+    1f7a:	55                   	push   %rbp
+    1f7b:	48 89 e5             	mov    %rsp,%rbp
+    1f7e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f82:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1f86:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : content_(p)
+    1f8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f8e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1f92:	48 89 10             	mov    %rdx,(%rax)
+            , len_(len)
+    1f95:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f99:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1f9d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    1fa1:	90                   	nop
+    1fa2:	5d                   	pop    %rbp
+    1fa3:	c3                   	ret
+
+0000000000001fa4 <nel::Slice<U8Buf<256ul> >::iter() const>:
+        constexpr Iterator iter(void) const
+    1fa4:	55                   	push   %rbp
+    1fa5:	48 89 e5             	mov    %rsp,%rbp
+    1fa8:	53                   	push   %rbx
+    1fa9:	48 83 ec 18          	sub    $0x18,%rsp
+    1fad:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1fb1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return Iterator(ptr(), len());
+    1fb5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1fb9:	48 89 c7             	mov    %rax,%rdi
+    1fbc:	e8 33 fa ff ff       	call   19f4 <nel::Slice<U8Buf<256ul> >::len() const>
+    1fc1:	48 89 c3             	mov    %rax,%rbx
+    1fc4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1fc8:	48 89 c7             	mov    %rax,%rdi
+    1fcb:	e8 00 08 00 00       	call   27d0 <nel::Slice<U8Buf<256ul> >::ptr() const>
+    1fd0:	48 89 c1             	mov    %rax,%rcx
+    1fd3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1fd7:	48 89 da             	mov    %rbx,%rdx
+    1fda:	48 89 ce             	mov    %rcx,%rsi
+    1fdd:	48 89 c7             	mov    %rax,%rdi
+    1fe0:	e8 fd 07 00 00       	call   27e2 <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(U8Buf<256ul>*, unsigned long)>
+        }
+    1fe5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1fe9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1fed:	c9                   	leave
+    1fee:	c3                   	ret
+    1fef:	90                   	nop
+
+0000000000001ff0 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::operator*()>:
+        {
+            self().inc();
+            return *this;
+        }
+
+        constexpr OutT operator*(void)
+    1ff0:	55                   	push   %rbp
+    1ff1:	48 89 e5             	mov    %rsp,%rbp
+    1ff4:	48 83 ec 10          	sub    $0x10,%rsp
+    1ff8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return self().deref();
+    1ffc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2000:	48 89 c7             	mov    %rax,%rdi
+    2003:	e8 12 08 00 00       	call   281a <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    2008:	48 89 c7             	mov    %rax,%rdi
+    200b:	e8 20 08 00 00       	call   2830 <nel::SliceIterator<U8Buf<256ul> >::deref()>
+        }
+    2010:	c9                   	leave
+    2011:	c3                   	ret
+
+0000000000002012 <operator<<(nel::Log&, U8Buf<256ul> const&)>:
+        void fill(uint8_t f)
+        {
+            nel::elem::set(data_, f, N);
+        }
+
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+    2012:	          55                   	push   %rbp
+    2013:	          48 89 e5             	mov    %rsp,%rbp
+    2016:	          53                   	push   %rbx
+    2017:	          48 83 ec 28          	sub    $0x28,%rsp
+    201b:	          48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    201f:	          48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+        {
+            outs << "U8Buf<" << val.len() << ">{";
+    2023:	          48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2027:	          48 8d 15 67 20 00 00 	lea    0x2067(%rip),%rdx        # 4095 <nel::sort::ninther_n+0x75>
+    202e:	          48 89 d6             	mov    %rdx,%rsi
+    2031:	          48 89 c7             	mov    %rax,%rdi
+    2034:	          e8 a0 15 00 00       	call   35d9 <nel::operator<<(nel::Log&, char const*)>
+    2039:	          48 89 c3             	mov    %rax,%rbx
+    203c:	          48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2040:	          48 89 c7             	mov    %rax,%rdi
+    2043:	          e8 fa 07 00 00       	call   2842 <U8Buf<256ul>::len() const>
+    2048:	          48 89 c6             	mov    %rax,%rsi
+    204b:	          48 89 df             	mov    %rbx,%rdi
+    204e:	          e8 91 16 00 00       	call   36e4 <nel::operator<<(nel::Log&, unsigned long)>
+    2053:	          48 89 c2             	mov    %rax,%rdx
+    2056:	          48 8d 05 3f 20 00 00 	lea    0x203f(%rip),%rax        # 409c <nel::sort::ninther_n+0x7c>
+    205d:	          48 89 c6             	mov    %rax,%rsi
+    2060:	          48 89 d7             	mov    %rdx,%rdi
+    2063:	          e8 71 15 00 00       	call   35d9 <nel::operator<<(nel::Log&, char const*)>
+            if (val.len() > 0) {
+    2068:	          48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    206c:	          48 89 c7             	mov    %rax,%rdi
+    206f:	          e8 ce 07 00 00       	call   2842 <U8Buf<256ul>::len() const>
+    2074:	          48 85 c0             	test   %rax,%rax
+    2077:	          0f 95 c0             	setne  %al
+    207a:	          84 c0                	test   %al,%al
+    207c:	/-------- 74 6d                	je     20eb <operator<<(nel::Log&, U8Buf<256ul> const&)+0xd9>
+                outs << val.data_[0];
+    207e:	|         48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2082:	|         0f b6 00             	movzbl (%rax),%eax
+    2085:	|         0f b6 d0             	movzbl %al,%edx
+    2088:	|         48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    208c:	|         89 d6                	mov    %edx,%esi
+    208e:	|         48 89 c7             	mov    %rax,%rdi
+    2091:	|         e8 6f 15 00 00       	call   3605 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    2096:	|         48 c7 45 e8 01 00 00 	movq   $0x1,-0x18(%rbp)
+    209d:	|         00 
+    209e:	|     /-- eb 34                	jmp    20d4 <operator<<(nel::Log&, U8Buf<256ul> const&)+0xc2>
+                    outs << ' ' << val.data_[i];
+    20a0:	|  /--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    20a4:	|  |  |   be 20 00 00 00       	mov    $0x20,%esi
+    20a9:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    20ac:	|  |  |   e8 fc 14 00 00       	call   35ad <nel::operator<<(nel::Log&, char)>
+    20b1:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    20b4:	|  |  |   48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    20b8:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20bc:	|  |  |   48 01 c8             	add    %rcx,%rax
+    20bf:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    20c2:	|  |  |   0f b6 c0             	movzbl %al,%eax
+    20c5:	|  |  |   89 c6                	mov    %eax,%esi
+    20c7:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    20ca:	|  |  |   e8 36 15 00 00       	call   3605 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    20cf:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    20d4:	|  |  \-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    20d8:	|  |      48 89 c7             	mov    %rax,%rdi
+    20db:	|  |      e8 62 07 00 00       	call   2842 <U8Buf<256ul>::len() const>
+    20e0:	|  |      48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    20e4:	|  |      0f 92 c0             	setb   %al
+    20e7:	|  |      84 c0                	test   %al,%al
+    20e9:	|  \----- 75 b5                	jne    20a0 <operator<<(nel::Log&, U8Buf<256ul> const&)+0x8e>
+                }
+            }
+            outs << '}';
+    20eb:	\-------> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    20ef:	          be 7d 00 00 00       	mov    $0x7d,%esi
+    20f4:	          48 89 c7             	mov    %rax,%rdi
+    20f7:	          e8 b1 14 00 00       	call   35ad <nel::operator<<(nel::Log&, char)>
+            return outs;
+    20fc:	          48 8b 45 d8          	mov    -0x28(%rbp),%rax
+        }
+    2100:	          48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2104:	          c9                   	leave
+    2105:	          c3                   	ret
+
+0000000000002106 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::operator++()>:
+        Iterator &operator++(void)
+    2106:	55                   	push   %rbp
+    2107:	48 89 e5             	mov    %rsp,%rbp
+    210a:	48 83 ec 10          	sub    $0x10,%rsp
+    210e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            self().inc();
+    2112:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2116:	48 89 c7             	mov    %rax,%rdi
+    2119:	e8 fc 06 00 00       	call   281a <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    211e:	48 89 c7             	mov    %rax,%rdi
+    2121:	e8 2c 07 00 00       	call   2852 <nel::SliceIterator<U8Buf<256ul> >::inc()>
+            return *this;
+    2126:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    212a:	c9                   	leave
+    212b:	c3                   	ret
+
+000000000000212c <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<nel::operator<<(nel::Log&, nel::Slice<U8Buf<256ul> > const&)::{lambda(U8Buf<256ul> const&)#1}>(nel::operator<<(nel::Log&, nel::Slice<U8Buf<256ul> > const&)::{lambda(U8Buf<256ul> const&)#1}&&)>:
+         * @param fn func to apply to each item in iterator
+         */
+        // void for_each(std::function<void(OutT)> fn)
+#    if defined(C_LIKE) || defined(RUST_LIKE)
+        template<typename F>
+        void for_each(F &&fn)
+    212c:	       55                   	push   %rbp
+    212d:	       48 89 e5             	mov    %rsp,%rbp
+    2130:	       48 83 ec 10          	sub    $0x10,%rsp
+    2134:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2138:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        template<typename F>
+        void for_each2(F &&fn)
+#        endif
+        {
+#        if 1
+            for (; !self().is_done(); self().inc()) {
+    213c:	   /-- eb 3a                	jmp    2178 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<nel::operator<<(nel::Log&, nel::Slice<U8Buf<256ul> > const&)::{lambda(U8Buf<256ul> const&)#1}>(nel::operator<<(nel::Log&, nel::Slice<U8Buf<256ul> > const&)::{lambda(U8Buf<256ul> const&)#1}&&)+0x4c>
+                fn(self().deref());
+    213e:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2142:	|  |   48 89 c7             	mov    %rax,%rdi
+    2145:	|  |   e8 d0 06 00 00       	call   281a <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    214a:	|  |   48 89 c7             	mov    %rax,%rdi
+    214d:	|  |   e8 de 06 00 00       	call   2830 <nel::SliceIterator<U8Buf<256ul> >::deref()>
+    2152:	|  |   48 89 c2             	mov    %rax,%rdx
+    2155:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2159:	|  |   48 89 d6             	mov    %rdx,%rsi
+    215c:	|  |   48 89 c7             	mov    %rax,%rdi
+    215f:	|  |   e8 fe f8 ff ff       	call   1a62 <nel::operator<<(nel::Log&, nel::Slice<U8Buf<256ul> > const&)::{lambda(U8Buf<256ul> const&)#1}::operator()(U8Buf<256ul> const&) const>
+            for (; !self().is_done(); self().inc()) {
+    2164:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2168:	|  |   48 89 c7             	mov    %rax,%rdi
+    216b:	|  |   e8 aa 06 00 00       	call   281a <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    2170:	|  |   48 89 c7             	mov    %rax,%rdi
+    2173:	|  |   e8 da 06 00 00       	call   2852 <nel::SliceIterator<U8Buf<256ul> >::inc()>
+    2178:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    217c:	|      48 89 c7             	mov    %rax,%rdi
+    217f:	|      e8 96 06 00 00       	call   281a <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    2184:	|      48 89 c7             	mov    %rax,%rdi
+    2187:	|      e8 b6 f8 ff ff       	call   1a42 <nel::SliceIterator<U8Buf<256ul> >::is_done() const>
+    218c:	|      83 f0 01             	xor    $0x1,%eax
+    218f:	|      84 c0                	test   %al,%al
+    2191:	\----- 75 ab                	jne    213e <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<nel::operator<<(nel::Log&, nel::Slice<U8Buf<256ul> > const&)::{lambda(U8Buf<256ul> const&)#1}>(nel::operator<<(nel::Log&, nel::Slice<U8Buf<256ul> > const&)::{lambda(U8Buf<256ul> const&)#1}&&)+0x12>
+            fn(self().deref());
+            self().inc();
+enter:
+            if (!self().is_done()) { goto loop; }
+#        endif
+        }
+    2193:	       90                   	nop
+    2194:	       90                   	nop
+    2195:	       c9                   	leave
+    2196:	       c3                   	ret
+    2197:	       90                   	nop
+
+0000000000002198 <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>:
+        constexpr Element &operator=(Element const &) const = delete;
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+    2198:	55                   	push   %rbp
+    2199:	48 89 e5             	mov    %rsp,%rbp
+    219c:	48 83 ec 10          	sub    $0x10,%rsp
+    21a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    21a4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    21a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    21ac:	48 89 c7             	mov    %rax,%rdi
+    21af:	e8 c0 f9 ff ff       	call   1b74 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    21b4:	8b 10                	mov    (%rax),%edx
+    21b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21ba:	89 10                	mov    %edx,(%rax)
+        {
+        }
+    21bc:	90                   	nop
+    21bd:	c9                   	leave
+    21be:	c3                   	ret
+    21bf:	90                   	nop
+
+00000000000021c0 <nel::Element<void*>::Element<void* const&>(void* const&)>:
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+    21c0:	55                   	push   %rbp
+    21c1:	48 89 e5             	mov    %rsp,%rbp
+    21c4:	48 83 ec 10          	sub    $0x10,%rsp
+    21c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    21cc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Args>(args)...)
+    21d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    21d4:	48 89 c7             	mov    %rax,%rdi
+    21d7:	e8 e7 f9 ff ff       	call   1bc3 <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    21dc:	48 8b 10             	mov    (%rax),%rdx
+    21df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21e3:	48 89 10             	mov    %rdx,(%rax)
+        {
+        }
+    21e6:	90                   	nop
+    21e7:	c9                   	leave
+    21e8:	c3                   	ret
+    21e9:	90                   	nop
+
+00000000000021ea <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>:
+            return match<bool>([](T const &) -> bool { return false; },
+    21ea:	55                   	push   %rbp
+    21eb:	48 89 e5             	mov    %rsp,%rbp
+    21ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    21f2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    21f6:	b8 00 00 00 00       	mov    $0x0,%eax
+    21fb:	5d                   	pop    %rbp
+    21fc:	c3                   	ret
+    21fd:	90                   	nop
+
+00000000000021fe <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>:
+                               [](E const &) -> bool { return true; },
+    21fe:	55                   	push   %rbp
+    21ff:	48 89 e5             	mov    %rsp,%rbp
+    2202:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2206:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    220a:	b8 01 00 00 00       	mov    $0x1,%eax
+    220f:	5d                   	pop    %rbp
+    2210:	c3                   	ret
+    2211:	90                   	nop
+
+0000000000002212 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>:
+        constexpr bool is_err(Context const &ctx = Context()) const
+    2212:	55                   	push   %rbp
+    2213:	48 89 e5             	mov    %rsp,%rbp
+    2216:	48 83 ec 20          	sub    $0x20,%rsp
+    221a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    221e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](T const &) -> bool { return false; },
+    2222:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2226:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    222a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    222e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2232:	48 89 c7             	mov    %rax,%rdi
+    2235:	e8 02 00 00 00       	call   223c <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>
+        }
+    223a:	c9                   	leave
+    223b:	c3                   	ret
+
+000000000000223c <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    223c:	             55                   	push   %rbp
+    223d:	             48 89 e5             	mov    %rsp,%rbp
+    2240:	             48 83 ec 20          	sub    $0x20,%rsp
+    2244:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2248:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    224c:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2250:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result-match
+    2254:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2258:	             8b 00                	mov    (%rax),%eax
+    225a:	             83 f8 02             	cmp    $0x2,%eax
+    225d:	         /-- 74 32                	je     2291 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x55>
+    225f:	         |   83 f8 02             	cmp    $0x2,%eax
+    2262:	/--------|-- 7f 67                	jg     22cb <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+    2264:	|        |   85 c0                	test   %eax,%eax
+    2266:	|     /--|-- 74 4d                	je     22b5 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x79>
+    2268:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    226b:	+-----|--|-- 75 5e                	jne    22cb <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_ok(*ok_);
+    226d:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2271:	|     |  |   48 83 c0 08          	add    $0x8,%rax
+    2275:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    2278:	|     |  |   e8 f5 05 00 00       	call   2872 <nel::Element<void*>::operator*() const>
+    227d:	|     |  |   48 89 c2             	mov    %rax,%rdx
+    2280:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2284:	|     |  |   48 89 d6             	mov    %rdx,%rsi
+    2287:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    228a:	|     |  |   e8 5b ff ff ff       	call   21ea <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>
+    228f:	|  /--|--|-- eb 50                	jmp    22e1 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    return on_err(*err_);
+    2291:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2295:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    2299:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    229c:	|  |  |      e8 eb 05 00 00       	call   288c <nel::Element<nel::heaped::AllocError>::operator*() const>
+    22a1:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    22a4:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22a8:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    22ab:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    22ae:	|  |  |      e8 4b ff ff ff       	call   21fe <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>
+    22b3:	|  +--|----- eb 2c                	jmp    22e1 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    nel::panic("invalid Result", ctx);
+    22b5:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    22b9:	|  |         48 89 c6             	mov    %rax,%rsi
+    22bc:	|  |         48 8d 05 c3 1d 00 00 	lea    0x1dc3(%rip),%rax        # 4086 <nel::sort::ninther_n+0x66>
+    22c3:	|  |         48 89 c7             	mov    %rax,%rdi
+    22c6:	|  |         e8 0c 0a 00 00       	call   2cd7 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    22cb:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    22cf:	   |         48 89 c6             	mov    %rax,%rsi
+    22d2:	   |         48 8d 05 98 1d 00 00 	lea    0x1d98(%rip),%rax        # 4071 <nel::sort::ninther_n+0x51>
+    22d9:	   |         48 89 c7             	mov    %rax,%rdi
+    22dc:	   |         e8 f6 09 00 00       	call   2cd7 <nel::panic(char const*, nel::Context const&)>
+        }
+    22e1:	   \-------> c9                   	leave
+    22e2:	             c3                   	ret
+
+00000000000022e3 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)>:
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    22e3:	          55                   	push   %rbp
+    22e4:	          48 89 e5             	mov    %rsp,%rbp
+    22e7:	          41 54                	push   %r12
+    22e9:	          53                   	push   %rbx
+    22ea:	          48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+    22f1:	          48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+    22f8:	          48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+            if (new_cap > max_capacity) { return nullptr; }
+    22ff:	          48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    2306:	          ff 7f 00 
+    2309:	          48 3b 85 60 ff ff ff 	cmp    -0xa0(%rbp),%rax
+    2310:	      /-- 73 0a                	jae    231c <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x39>
+    2312:	      |   bb 00 00 00 00       	mov    $0x0,%ebx
+    2317:	/-----|-- e9 d8 01 00 00       	jmp    24f4 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x211>
+            Length const new_sz = size_of(new_cap);
+    231c:	|     \-> 48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+    2323:	|         48 89 c7             	mov    %rax,%rdi
+    2326:	|         e8 87 f9 ff ff       	call   1cb2 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::size_of(unsigned long)>
+    232b:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            Length const old_sz = (old_n == nullptr) ? 0 : size_of(old_n->alloc_);
+    232f:	|         48 83 bd 68 ff ff ff 	cmpq   $0x0,-0x98(%rbp)
+    2336:	|         00 
+    2337:	|  /----- 74 14                	je     234d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x6a>
+    2339:	|  |      48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2340:	|  |      48 8b 00             	mov    (%rax),%rax
+    2343:	|  |      48 89 c7             	mov    %rax,%rdi
+    2346:	|  |      e8 67 f9 ff ff       	call   1cb2 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::size_of(unsigned long)>
+    234b:	|  |  /-- eb 05                	jmp    2352 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x6f>
+    234d:	|  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    2352:	|     \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+                auto r = Allocator::try_malloc(alignof(Node), new_sz);
+    2356:	|         48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    235d:	|         48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2361:	|         be 08 00 00 00       	mov    $0x8,%esi
+    2366:	|         48 89 c7             	mov    %rax,%rdi
+    2369:	|         e8 ab f1 ff ff       	call   1519 <nel::heaped::Malloc::try_malloc(unsigned long, unsigned long)>
+                if (r.is_err()) { return nullptr; }
+    236e:	|         48 8d 45 80          	lea    -0x80(%rbp),%rax
+    2372:	|         b9 8e 00 00 00       	mov    $0x8e,%ecx
+    2377:	|         48 8d 15 21 1d 00 00 	lea    0x1d21(%rip),%rdx        # 409f <nel::sort::ninther_n+0x7f>
+    237e:	|         48 8d 35 31 1d 00 00 	lea    0x1d31(%rip),%rsi        # 40b6 <nel::sort::ninther_n+0x96>
+    2385:	|         48 89 c7             	mov    %rax,%rdi
+    2388:	|         e8 1f f1 ff ff       	call   14ac <nel::Context::Context(char const*, char const*, int)>
+    238d:	|         48 8d 55 80          	lea    -0x80(%rbp),%rdx
+    2391:	|         48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    2398:	|         48 89 d6             	mov    %rdx,%rsi
+    239b:	|         48 89 c7             	mov    %rax,%rdi
+    239e:	|         e8 6f fe ff ff       	call   2212 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>
+    23a3:	|         84 c0                	test   %al,%al
+    23a5:	|     /-- 74 10                	je     23b7 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0xd4>
+    23a7:	|     |   bb 00 00 00 00       	mov    $0x0,%ebx
+    23ac:	|     |   41 bc 00 00 00 00    	mov    $0x0,%r12d
+    23b2:	|  /--|-- e9 ed 00 00 00       	jmp    24a4 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x1c1>
+                new_n = reinterpret_cast<Node *>(r.unwrap());
+    23b7:	|  |  \-> 48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    23bb:	|  |      b9 8f 00 00 00       	mov    $0x8f,%ecx
+    23c0:	|  |      48 8d 15 d8 1c 00 00 	lea    0x1cd8(%rip),%rdx        # 409f <nel::sort::ninther_n+0x7f>
+    23c7:	|  |      48 8d 35 e8 1c 00 00 	lea    0x1ce8(%rip),%rsi        # 40b6 <nel::sort::ninther_n+0x96>
+    23ce:	|  |      48 89 c7             	mov    %rax,%rdi
+    23d1:	|  |      e8 d6 f0 ff ff       	call   14ac <nel::Context::Context(char const*, char const*, int)>
+    23d6:	|  |      48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    23da:	|  |      48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    23e1:	|  |      48 89 d6             	mov    %rdx,%rsi
+    23e4:	|  |      48 89 c7             	mov    %rax,%rdi
+    23e7:	|  |      e8 06 05 00 00       	call   28f2 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+    23ec:	|  |      48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                if (old_n != nullptr) {
+    23f0:	|  |      48 83 bd 68 ff ff ff 	cmpq   $0x0,-0x98(%rbp)
+    23f7:	|  |      00 
+    23f8:	|  |  /-- 0f 84 a0 00 00 00    	je     249e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x1bb>
+                    nel::assert(old_n->len_ <= new_cap, "heaped::Node: shrinking below len");
+    23fe:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2402:	|  |  |   b9 91 00 00 00       	mov    $0x91,%ecx
+    2407:	|  |  |   48 8d 15 91 1c 00 00 	lea    0x1c91(%rip),%rdx        # 409f <nel::sort::ninther_n+0x7f>
+    240e:	|  |  |   48 8d 35 a1 1c 00 00 	lea    0x1ca1(%rip),%rsi        # 40b6 <nel::sort::ninther_n+0x96>
+    2415:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2418:	|  |  |   e8 8f f0 ff ff       	call   14ac <nel::Context::Context(char const*, char const*, int)>
+    241d:	|  |  |   48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2424:	|  |  |   48 8b 40 08          	mov    0x8(%rax),%rax
+    2428:	|  |  |   48 39 85 60 ff ff ff 	cmp    %rax,-0xa0(%rbp)
+    242f:	|  |  |   0f 93 c0             	setae  %al
+    2432:	|  |  |   0f b6 c0             	movzbl %al,%eax
+    2435:	|  |  |   48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    2439:	|  |  |   48 8d 0d 80 1c 00 00 	lea    0x1c80(%rip),%rcx        # 40c0 <nel::sort::ninther_n+0xa0>
+    2440:	|  |  |   48 89 ce             	mov    %rcx,%rsi
+    2443:	|  |  |   89 c7                	mov    %eax,%edi
+    2445:	|  |  |   e8 99 f0 ff ff       	call   14e3 <nel::assert(bool, char const*, nel::Context const&)>
+                    new_n->len_ = old_n->len_;
+    244a:	|  |  |   48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2451:	|  |  |   48 8b 50 08          	mov    0x8(%rax),%rdx
+    2455:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2459:	|  |  |   48 89 50 08          	mov    %rdx,0x8(%rax)
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    245d:	|  |  |   48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2464:	|  |  |   48 8b 40 08          	mov    0x8(%rax),%rax
+    2468:	|  |  |   48 8b 95 68 ff ff ff 	mov    -0x98(%rbp),%rdx
+    246f:	|  |  |   48 8d 72 10          	lea    0x10(%rdx),%rsi
+    2473:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2477:	|  |  |   48 8d 4a 10          	lea    0x10(%rdx),%rcx
+    247b:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    247e:	|  |  |   48 89 cf             	mov    %rcx,%rdi
+    2481:	|  |  |   e8 9e 04 00 00       	call   2924 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)>
+                    Allocator::free(old_n, alignof(Node), old_sz);
+    2486:	|  |  |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    248a:	|  |  |   48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2491:	|  |  |   be 08 00 00 00       	mov    $0x8,%esi
+    2496:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2499:	|  |  |   e8 85 f1 ff ff       	call   1623 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>
+            }
+    249e:	|  |  \-> 41 bc 01 00 00 00    	mov    $0x1,%r12d
+    24a4:	|  \----> 48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    24ab:	|         48 89 c7             	mov    %rax,%rdi
+    24ae:	|         e8 09 f2 ff ff       	call   16bc <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+    24b3:	|         41 83 fc 01          	cmp    $0x1,%r12d
+    24b7:	+-------- 75 3b                	jne    24f4 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x211>
+    24b9:	|         90                   	nop
+                if (new_sz > old_sz) {
+    24ba:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    24be:	|         48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    24c2:	|     /-- 73 1e                	jae    24e2 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x1ff>
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+    24c4:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    24c8:	|     |   48 2b 45 d8          	sub    -0x28(%rbp),%rax
+    24cc:	|     |   48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    24d0:	|     |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    24d4:	|     |   48 01 ca             	add    %rcx,%rdx
+    24d7:	|     |   48 89 c6             	mov    %rax,%rsi
+    24da:	|     |   48 89 d7             	mov    %rdx,%rdi
+    24dd:	|     |   e8 76 09 00 00       	call   2e58 <nel::elem::wipe(unsigned char*, unsigned long)>
+            new_n->alloc_ = new_cap;
+    24e2:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24e6:	|         48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+    24ed:	|         48 89 10             	mov    %rdx,(%rax)
+            return new_n;
+    24f0:	|         48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+        }
+    24f4:	\-------> 48 89 d8             	mov    %rbx,%rax
+    24f7:	          48 81 c4 90 00 00 00 	add    $0x90,%rsp
+    24fe:	          5b                   	pop    %rbx
+    24ff:	          41 5c                	pop    %r12
+    2501:	          5d                   	pop    %rbp
+    2502:	          c3                   	ret
+
+0000000000002503 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*&& nel::move<nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*>(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*&)>:
+constexpr T &&move(T &v)
+    2503:	55                   	push   %rbp
+    2504:	48 89 e5             	mov    %rsp,%rbp
+    2507:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    250b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    250f:	5d                   	pop    %rbp
+    2510:	c3                   	ret
+    2511:	90                   	nop
+
+0000000000002512 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::~Node()>:
+        constexpr ~Node(void)
+    2512:	       55                   	push   %rbp
+    2513:	       48 89 e5             	mov    %rsp,%rbp
+    2516:	       48 83 ec 20          	sub    $0x20,%rsp
+    251a:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            for (Index i = 0; i < len(); ++i) {
+    251e:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    2525:	       00 
+    2526:	   /-- eb 20                	jmp    2548 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::~Node()+0x36>
+                values_[i].~Type();
+    2528:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    252c:	|  |   48 c1 e0 08          	shl    $0x8,%rax
+    2530:	|  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    2534:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2538:	|  |   48 01 d0             	add    %rdx,%rax
+    253b:	|  |   48 89 c7             	mov    %rax,%rdi
+    253e:	|  |   e8 4b f9 ff ff       	call   1e8e <U8Buf<256ul>::~U8Buf()>
+            for (Index i = 0; i < len(); ++i) {
+    2543:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    2548:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    254c:	|      48 89 c7             	mov    %rax,%rdi
+    254f:	|      e8 14 fa ff ff       	call   1f68 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::len() const>
+    2554:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2558:	|      0f 92 c0             	setb   %al
+    255b:	|      84 c0                	test   %al,%al
+    255d:	\----- 75 c9                	jne    2528 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::~Node()+0x16>
+        }
+    255f:	       90                   	nop
+    2560:	       90                   	nop
+    2561:	       c9                   	leave
+    2562:	       c3                   	ret
+    2563:	       90                   	nop
+
+0000000000002564 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>:
+        constexpr Length len(void) const
+    2564:	       55                   	push   %rbp
+    2565:	       48 89 e5             	mov    %rsp,%rbp
+    2568:	       48 83 ec 10          	sub    $0x10,%rsp
+    256c:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->len();
+    2570:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2574:	       48 8b 00             	mov    (%rax),%rax
+    2577:	       48 85 c0             	test   %rax,%rax
+    257a:	/----- 74 11                	je     258d <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x29>
+    257c:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2580:	|      48 8b 00             	mov    (%rax),%rax
+    2583:	|      48 89 c7             	mov    %rax,%rdi
+    2586:	|      e8 dd f9 ff ff       	call   1f68 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::len() const>
+    258b:	|  /-- eb 05                	jmp    2592 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x2e>
+    258d:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    2592:	   \-> c9                   	leave
+    2593:	       c3                   	ret
+
+0000000000002594 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>:
+        constexpr Count capacity(void) const
+    2594:	       55                   	push   %rbp
+    2595:	       48 89 e5             	mov    %rsp,%rbp
+    2598:	       48 83 ec 10          	sub    $0x10,%rsp
+    259c:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->capacity();
+    25a0:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25a4:	       48 8b 00             	mov    (%rax),%rax
+    25a7:	       48 85 c0             	test   %rax,%rax
+    25aa:	/----- 74 11                	je     25bd <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x29>
+    25ac:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25b0:	|      48 8b 00             	mov    (%rax),%rax
+    25b3:	|      48 89 c7             	mov    %rax,%rdi
+    25b6:	|      e8 9f 01 00 00       	call   275a <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::capacity() const>
+    25bb:	|  /-- eb 05                	jmp    25c2 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x2e>
+    25bd:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    25c2:	   \-> c9                   	leave
+    25c3:	       c3                   	ret
+
+00000000000025c4 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>:
+        bool try_reserve(Count new_cap)
+    25c4:	             55                   	push   %rbp
+    25c5:	             48 89 e5             	mov    %rsp,%rbp
+    25c8:	             48 83 ec 20          	sub    $0x20,%rsp
+    25cc:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    25d0:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            new_cap = Growth::capacity_for(capacity(), new_cap);
+    25d4:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25d8:	             48 89 c7             	mov    %rax,%rdi
+    25db:	             e8 b4 ff ff ff       	call   2594 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    25e0:	             48 89 c2             	mov    %rax,%rdx
+    25e3:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    25e7:	             48 89 c6             	mov    %rax,%rsi
+    25ea:	             48 89 d7             	mov    %rdx,%rdi
+    25ed:	             e8 6a 04 00 00       	call   2a5c <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>
+    25f2:	             48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (new_cap < len()) { new_cap = len(); }
+    25f6:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25fa:	             48 89 c7             	mov    %rax,%rdi
+    25fd:	             e8 62 ff ff ff       	call   2564 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    2602:	             48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    2606:	             0f 92 c0             	setb   %al
+    2609:	             84 c0                	test   %al,%al
+    260b:	         /-- 74 10                	je     261d <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x59>
+    260d:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2611:	         |   48 89 c7             	mov    %rax,%rdi
+    2614:	         |   e8 4b ff ff ff       	call   2564 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    2619:	         |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (item_ == nullptr) {
+    261d:	         \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2621:	             48 8b 00             	mov    (%rax),%rax
+    2624:	             48 85 c0             	test   %rax,%rax
+    2627:	         /-- 75 2d                	jne    2656 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x92>
+                item_ = VectorNode::malloc(new_cap);
+    2629:	         |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    262d:	         |   48 89 c7             	mov    %rax,%rdi
+    2630:	         |   e8 f5 f5 ff ff       	call   1c2a <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::malloc(unsigned long)>
+    2635:	         |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2639:	         |   48 89 02             	mov    %rax,(%rdx)
+                if (item_ == nullptr) { return false; }
+    263c:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2640:	         |   48 8b 00             	mov    (%rax),%rax
+    2643:	         |   48 85 c0             	test   %rax,%rax
+    2646:	/--------|-- 0f 85 c4 00 00 00    	jne    2710 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+    264c:	|        |   b8 00 00 00 00       	mov    $0x0,%eax
+    2651:	|  /-----|-- e9 bf 00 00 00       	jmp    2715 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+            } else if (new_cap == item_->capacity()) {
+    2656:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    265a:	|  |         48 8b 00             	mov    (%rax),%rax
+    265d:	|  |         48 89 c7             	mov    %rax,%rdi
+    2660:	|  |         e8 f5 00 00 00       	call   275a <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::capacity() const>
+    2665:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    2669:	|  |         0f 94 c0             	sete   %al
+    266c:	|  |         84 c0                	test   %al,%al
+    266e:	+--|-------- 0f 85 9c 00 00 00    	jne    2710 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap > item_->capacity()) {
+    2674:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2678:	|  |         48 8b 00             	mov    (%rax),%rax
+    267b:	|  |         48 89 c7             	mov    %rax,%rdi
+    267e:	|  |         e8 d7 00 00 00       	call   275a <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::capacity() const>
+    2683:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    2687:	|  |         0f 92 c0             	setb   %al
+    268a:	|  |         84 c0                	test   %al,%al
+    268c:	|  |  /----- 74 35                	je     26c3 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xff>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    268e:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2692:	|  |  |      48 8b 00             	mov    (%rax),%rax
+    2695:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2699:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    269c:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    269f:	|  |  |      e8 3f fc ff ff       	call   22e3 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)>
+    26a4:	|  |  |      48 89 45 f0          	mov    %rax,-0x10(%rbp)
+                if (p == nullptr) { return false; }
+    26a8:	|  |  |      48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    26ad:	|  |  |  /-- 75 07                	jne    26b6 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xf2>
+    26af:	|  |  |  |   b8 00 00 00 00       	mov    $0x0,%eax
+    26b4:	|  +--|--|-- eb 5f                	jmp    2715 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    26b6:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26ba:	|  |  |      48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    26be:	|  |  |      48 89 10             	mov    %rdx,(%rax)
+    26c1:	+--|--|----- eb 4d                	jmp    2710 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap < item_->capacity()) {
+    26c3:	|  |  \----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26c7:	|  |         48 8b 00             	mov    (%rax),%rax
+    26ca:	|  |         48 89 c7             	mov    %rax,%rdi
+    26cd:	|  |         e8 88 00 00 00       	call   275a <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::capacity() const>
+    26d2:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    26d6:	|  |         0f 92 c0             	setb   %al
+    26d9:	|  |         84 c0                	test   %al,%al
+    26db:	+--|-------- 74 33                	je     2710 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    26dd:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26e1:	|  |         48 8b 00             	mov    (%rax),%rax
+    26e4:	|  |         48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    26e8:	|  |         48 89 d6             	mov    %rdx,%rsi
+    26eb:	|  |         48 89 c7             	mov    %rax,%rdi
+    26ee:	|  |         e8 f0 fb ff ff       	call   22e3 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)>
+    26f3:	|  |         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                if (p == nullptr) { return false; }
+    26f7:	|  |         48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    26fc:	|  |     /-- 75 07                	jne    2705 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x141>
+    26fe:	|  |     |   b8 00 00 00 00       	mov    $0x0,%eax
+    2703:	|  +-----|-- eb 10                	jmp    2715 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    2705:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2709:	|  |         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    270d:	|  |         48 89 10             	mov    %rdx,(%rax)
+            return true;
+    2710:	\--|-------> b8 01 00 00 00       	mov    $0x1,%eax
+        }
+    2715:	   \-------> c9                   	leave
+    2716:	             c3                   	ret
+    2717:	             90                   	nop
+
+0000000000002718 <nel::Result<void, U8Buf<256ul> >::Result<unsigned char>(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)2>, unsigned char&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+    2718:	55                   	push   %rbp
+    2719:	48 89 e5             	mov    %rsp,%rbp
+    271c:	53                   	push   %rbx
+    271d:	48 83 ec 18          	sub    $0x18,%rsp
+    2721:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2725:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    2729:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    272d:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<Args>(args)...)
+    2733:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2737:	48 8d 58 04          	lea    0x4(%rax),%rbx
+    273b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    273f:	48 89 c7             	mov    %rax,%rdi
+    2742:	e8 38 f6 ff ff       	call   1d7f <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    2747:	48 89 c6             	mov    %rax,%rsi
+    274a:	48 89 df             	mov    %rbx,%rdi
+    274d:	e8 56 03 00 00       	call   2aa8 <nel::Element<U8Buf<256ul> >::Element<unsigned char>(unsigned char&&)>
+        }
+    2752:	90                   	nop
+    2753:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2757:	c9                   	leave
+    2758:	c3                   	ret
+    2759:	90                   	nop
+
+000000000000275a <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::capacity() const>:
+        constexpr Count capacity(void) const
+    275a:	55                   	push   %rbp
+    275b:	48 89 e5             	mov    %rsp,%rbp
+    275e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return alloc_;
+    2762:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2766:	48 8b 00             	mov    (%rax),%rax
+        }
+    2769:	5d                   	pop    %rbp
+    276a:	c3                   	ret
+    276b:	90                   	nop
+
+000000000000276c <U8Buf<256ul>::U8Buf(unsigned char)>:
+        constexpr U8Buf(uint8_t const f)
+    276c:	55                   	push   %rbp
+    276d:	48 89 e5             	mov    %rsp,%rbp
+    2770:	48 83 ec 10          	sub    $0x10,%rsp
+    2774:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2778:	89 f0                	mov    %esi,%eax
+    277a:	88 45 f4             	mov    %al,-0xc(%rbp)
+            nel::elem::set(data_, f, N);
+    277d:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    2781:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2785:	ba 00 01 00 00       	mov    $0x100,%edx
+    278a:	89 ce                	mov    %ecx,%esi
+    278c:	48 89 c7             	mov    %rax,%rdi
+    278f:	e8 27 06 00 00       	call   2dbb <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    2794:	90                   	nop
+    2795:	c9                   	leave
+    2796:	c3                   	ret
+
+0000000000002797 <nel::Result<void, U8Buf<256ul> >::Ok()>:
+        constexpr static Result Ok(void)
+    2797:	55                   	push   %rbp
+    2798:	48 89 e5             	mov    %rsp,%rbp
+    279b:	48 83 ec 10          	sub    $0x10,%rsp
+    279f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Result(Phantom<Tag::OK>());
+    27a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27a7:	48 89 c7             	mov    %rax,%rdi
+    27aa:	e8 31 03 00 00       	call   2ae0 <nel::Result<void, U8Buf<256ul> >::Result(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)1>)>
+        }
+    27af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27b3:	c9                   	leave
+    27b4:	c3                   	ret
+    27b5:	90                   	nop
+
+00000000000027b6 <nel::Element<U8Buf<256ul> >::operator*() const>:
+        constexpr Type &ref(void)
+        {
+            return value_;
+        }
+
+        constexpr Type const &operator*(void) const
+    27b6:	55                   	push   %rbp
+    27b7:	48 89 e5             	mov    %rsp,%rbp
+    27ba:	48 83 ec 10          	sub    $0x10,%rsp
+    27be:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    27c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27c6:	48 89 c7             	mov    %rax,%rdi
+    27c9:	e8 28 03 00 00       	call   2af6 <nel::Element<U8Buf<256ul> >::ref() const>
+        }
+    27ce:	c9                   	leave
+    27cf:	c3                   	ret
+
+00000000000027d0 <nel::Slice<U8Buf<256ul> >::ptr() const>:
+        constexpr Type *ptr(void) const
+    27d0:	55                   	push   %rbp
+    27d1:	48 89 e5             	mov    %rsp,%rbp
+    27d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return content_;
+    27d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27dc:	48 8b 00             	mov    (%rax),%rax
+        }
+    27df:	5d                   	pop    %rbp
+    27e0:	c3                   	ret
+    27e1:	90                   	nop
+
+00000000000027e2 <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(U8Buf<256ul>*, unsigned long)>:
+        constexpr SliceIterator(T arr[], Count len)
+    27e2:	55                   	push   %rbp
+    27e3:	48 89 e5             	mov    %rsp,%rbp
+    27e6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    27ea:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    27ee:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : b_(arr)
+    27f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27f6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    27fa:	48 89 10             	mov    %rdx,(%rax)
+            , e_(arr + len)
+    27fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2801:	48 c1 e0 08          	shl    $0x8,%rax
+    2805:	48 89 c2             	mov    %rax,%rdx
+    2808:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    280c:	48 01 c2             	add    %rax,%rdx
+    280f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2813:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    2817:	90                   	nop
+    2818:	5d                   	pop    %rbp
+    2819:	c3                   	ret
+
+000000000000281a <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>:
+        constexpr ItT &self(void)
+    281a:	55                   	push   %rbp
+    281b:	48 89 e5             	mov    %rsp,%rbp
+    281e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    2822:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2826:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    282a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    282e:	5d                   	pop    %rbp
+    282f:	c3                   	ret
+
+0000000000002830 <nel::SliceIterator<U8Buf<256ul> >::deref()>:
+        void inc(void)
+        {
+            ++b_;
+        }
+
+        OutT deref(void)
+    2830:	55                   	push   %rbp
+    2831:	48 89 e5             	mov    %rsp,%rbp
+    2834:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return *b_;
+    2838:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    283c:	48 8b 00             	mov    (%rax),%rax
+        }
+    283f:	5d                   	pop    %rbp
+    2840:	c3                   	ret
+    2841:	90                   	nop
+
+0000000000002842 <U8Buf<256ul>::len() const>:
+        constexpr Length len(void) const
+    2842:	55                   	push   %rbp
+    2843:	48 89 e5             	mov    %rsp,%rbp
+    2846:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return N;
+    284a:	b8 00 01 00 00       	mov    $0x100,%eax
+        }
+    284f:	5d                   	pop    %rbp
+    2850:	c3                   	ret
+    2851:	90                   	nop
+
+0000000000002852 <nel::SliceIterator<U8Buf<256ul> >::inc()>:
+        void inc(void)
+    2852:	55                   	push   %rbp
+    2853:	48 89 e5             	mov    %rsp,%rbp
+    2856:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            ++b_;
+    285a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    285e:	48 8b 00             	mov    (%rax),%rax
+    2861:	48 8d 90 00 01 00 00 	lea    0x100(%rax),%rdx
+    2868:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    286c:	48 89 10             	mov    %rdx,(%rax)
+        }
+    286f:	90                   	nop
+    2870:	5d                   	pop    %rbp
+    2871:	c3                   	ret
+
+0000000000002872 <nel::Element<void*>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    2872:	55                   	push   %rbp
+    2873:	48 89 e5             	mov    %rsp,%rbp
+    2876:	48 83 ec 10          	sub    $0x10,%rsp
+    287a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    287e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2882:	48 89 c7             	mov    %rax,%rdi
+    2885:	e8 7a 02 00 00       	call   2b04 <nel::Element<void*>::ref() const>
+        }
+    288a:	c9                   	leave
+    288b:	c3                   	ret
+
+000000000000288c <nel::Element<nel::heaped::AllocError>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    288c:	55                   	push   %rbp
+    288d:	48 89 e5             	mov    %rsp,%rbp
+    2890:	48 83 ec 10          	sub    $0x10,%rsp
+    2894:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    2898:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    289c:	48 89 c7             	mov    %rax,%rdi
+    289f:	e8 6e 02 00 00       	call   2b12 <nel::Element<nel::heaped::AllocError>::ref() const>
+        }
+    28a4:	c9                   	leave
+    28a5:	c3                   	ret
+
+00000000000028a6 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>:
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    28a6:	55                   	push   %rbp
+    28a7:	48 89 e5             	mov    %rsp,%rbp
+    28aa:	48 83 ec 10          	sub    $0x10,%rsp
+    28ae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    28b2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    28b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    28ba:	48 89 c7             	mov    %rax,%rdi
+    28bd:	e8 5e 02 00 00       	call   2b20 <void*&& nel::forward<void*, void*>(void*&)>
+    28c2:	48 8b 00             	mov    (%rax),%rax
+    28c5:	c9                   	leave
+    28c6:	c3                   	ret
+    28c7:	90                   	nop
+
+00000000000028c8 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>:
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    28c8:	55                   	push   %rbp
+    28c9:	48 89 e5             	mov    %rsp,%rbp
+    28cc:	48 83 ec 10          	sub    $0x10,%rsp
+    28d0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    28d4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    28d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28dc:	48 8b 00             	mov    (%rax),%rax
+    28df:	48 89 c6             	mov    %rax,%rsi
+    28e2:	48 8d 05 f9 17 00 00 	lea    0x17f9(%rip),%rax        # 40e2 <nel::sort::ninther_n+0xc2>
+    28e9:	48 89 c7             	mov    %rax,%rdi
+    28ec:	e8 e6 03 00 00       	call   2cd7 <nel::panic(char const*, nel::Context const&)>
+    28f1:	90                   	nop
+
+00000000000028f2 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>:
+        constexpr T unwrap(Context const &ctx = Context())
+    28f2:	55                   	push   %rbp
+    28f3:	48 89 e5             	mov    %rsp,%rbp
+    28f6:	48 83 ec 20          	sub    $0x20,%rsp
+    28fa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    28fe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    2902:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2906:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    290a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    290e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    2912:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    2916:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    291a:	48 89 c7             	mov    %rax,%rdi
+    291d:	e8 0c 02 00 00       	call   2b2e <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>
+        }
+    2922:	c9                   	leave
+    2923:	c3                   	ret
+
+0000000000002924 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)>:
+ * @warning UB if [s, s+n) is not initialised.
+ */
+void relocate(uint8_t *const d, uint8_t *const s, Length const n);
+
+template<typename T>
+void relocate(T d[], T s[], Length const n)
+    2924:	                55                   	push   %rbp
+    2925:	                48 89 e5             	mov    %rsp,%rbp
+    2928:	                53                   	push   %rbx
+    2929:	                48 83 ec 38          	sub    $0x38,%rsp
+    292d:	                48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    2931:	                48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    2935:	                48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+{
+    if (d == s) { return; }
+    2939:	                48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    293d:	                48 3b 45 d0          	cmp    -0x30(%rbp),%rax
+    2941:	/-------------- 0f 84 0e 01 00 00    	je     2a55 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x131>
+    if constexpr (is_trivially_relocatable<T>) {
+        relocate(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t *>(s), n * sizeof(T));
+    } else if (d < s) {
+    2947:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    294b:	|               48 3b 45 d0          	cmp    -0x30(%rbp),%rax
+    294f:	|     /-------- 73 7f                	jae    29d0 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0xac>
+        // forwards, so overlap is not overwritten before it is read.
+        for (Index i = 0; i < n; ++i) {
+    2951:	|     |         48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+    2958:	|     |         00 
+    2959:	|     |     /-- eb 66                	jmp    29c1 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x9d>
+            new (&d[i]) T(nel::move(s[i]));
+    295b:	|     |  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    295f:	|     |  |  |   48 c1 e0 08          	shl    $0x8,%rax
+    2963:	|     |  |  |   48 89 c2             	mov    %rax,%rdx
+    2966:	|     |  |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    296a:	|     |  |  |   48 01 d0             	add    %rdx,%rax
+    296d:	|     |  |  |   48 89 c6             	mov    %rax,%rsi
+    2970:	|     |  |  |   bf 00 01 00 00       	mov    $0x100,%edi
+    2975:	|     |  |  |   e8 1f eb ff ff       	call   1499 <operator new(unsigned long, void*)>
+    297a:	|     |  |  |   48 89 c3             	mov    %rax,%rbx
+    297d:	|     |  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2981:	|     |  |  |   48 c1 e0 08          	shl    $0x8,%rax
+    2985:	|     |  |  |   48 89 c2             	mov    %rax,%rdx
+    2988:	|     |  |  |   48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    298c:	|     |  |  |   48 01 d0             	add    %rdx,%rax
+    298f:	|     |  |  |   48 89 c7             	mov    %rax,%rdi
+    2992:	|     |  |  |   e8 60 02 00 00       	call   2bf7 <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    2997:	|     |  |  |   48 89 c6             	mov    %rax,%rsi
+    299a:	|     |  |  |   48 89 df             	mov    %rbx,%rdi
+    299d:	|     |  |  |   e8 64 02 00 00       	call   2c06 <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>
+            s[i].~T();
+    29a2:	|     |  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    29a6:	|     |  |  |   48 c1 e0 08          	shl    $0x8,%rax
+    29aa:	|     |  |  |   48 89 c2             	mov    %rax,%rdx
+    29ad:	|     |  |  |   48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    29b1:	|     |  |  |   48 01 d0             	add    %rdx,%rax
+    29b4:	|     |  |  |   48 89 c7             	mov    %rax,%rdi
+    29b7:	|     |  |  |   e8 d2 f4 ff ff       	call   1e8e <U8Buf<256ul>::~U8Buf()>
+        for (Index i = 0; i < n; ++i) {
+    29bc:	|     |  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    29c1:	|     |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    29c5:	|     |  |      48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+    29c9:	|     |  \----- 72 90                	jb     295b <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x37>
+    29cb:	|  /--|-------- e9 86 00 00 00       	jmp    2a56 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x132>
+        }
+    } else {
+        // backwards, so overlap is not overwritten before it is read.
+        for (Index i = n; i > 0; --i) {
+    29d0:	|  |  \-------> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    29d4:	|  |            48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    29d8:	|  |        /-- eb 72                	jmp    2a4c <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x128>
+            new (&d[i - 1]) T(nel::move(s[i - 1]));
+    29da:	|  |     /--|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29de:	|  |     |  |   48 c1 e0 08          	shl    $0x8,%rax
+    29e2:	|  |     |  |   48 8d 90 00 ff ff ff 	lea    -0x100(%rax),%rdx
+    29e9:	|  |     |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    29ed:	|  |     |  |   48 01 d0             	add    %rdx,%rax
+    29f0:	|  |     |  |   48 89 c6             	mov    %rax,%rsi
+    29f3:	|  |     |  |   bf 00 01 00 00       	mov    $0x100,%edi
+    29f8:	|  |     |  |   e8 9c ea ff ff       	call   1499 <operator new(unsigned long, void*)>
+    29fd:	|  |     |  |   48 89 c3             	mov    %rax,%rbx
+    2a00:	|  |     |  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a04:	|  |     |  |   48 c1 e0 08          	shl    $0x8,%rax
+    2a08:	|  |     |  |   48 8d 90 00 ff ff ff 	lea    -0x100(%rax),%rdx
+    2a0f:	|  |     |  |   48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2a13:	|  |     |  |   48 01 d0             	add    %rdx,%rax
+    2a16:	|  |     |  |   48 89 c7             	mov    %rax,%rdi
+    2a19:	|  |     |  |   e8 d9 01 00 00       	call   2bf7 <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    2a1e:	|  |     |  |   48 89 c6             	mov    %rax,%rsi
+    2a21:	|  |     |  |   48 89 df             	mov    %rbx,%rdi
+    2a24:	|  |     |  |   e8 dd 01 00 00       	call   2c06 <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>
+            s[i - 1].~T();
+    2a29:	|  |     |  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a2d:	|  |     |  |   48 c1 e0 08          	shl    $0x8,%rax
+    2a31:	|  |     |  |   48 8d 90 00 ff ff ff 	lea    -0x100(%rax),%rdx
+    2a38:	|  |     |  |   48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2a3c:	|  |     |  |   48 01 d0             	add    %rdx,%rax
+    2a3f:	|  |     |  |   48 89 c7             	mov    %rax,%rdi
+    2a42:	|  |     |  |   e8 47 f4 ff ff       	call   1e8e <U8Buf<256ul>::~U8Buf()>
+        for (Index i = n; i > 0; --i) {
+    2a47:	|  |     |  |   48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+    2a4c:	|  |     |  \-> 48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    2a51:	|  |     \----- 75 87                	jne    29da <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0xb6>
+    2a53:	|  +----------- eb 01                	jmp    2a56 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x132>
+    if (d == s) { return; }
+    2a55:	\--|----------> 90                   	nop
+        }
+    }
+}
+    2a56:	   \----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2a5a:	                c9                   	leave
+    2a5b:	                c3                   	ret
+
+0000000000002a5c <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>:
+
+    public:
+        // Smallest non-zero capacity grown to, saves the first few tiny reallocs.
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+    2a5c:	          55                   	push   %rbp
+    2a5d:	          48 89 e5             	mov    %rsp,%rbp
+    2a60:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2a64:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            if (cap <= cur) { return cap; }
+    2a68:	          48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a6c:	          48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    2a70:	      /-- 72 06                	jb     2a78 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x1c>
+    2a72:	      |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a76:	/-----|-- eb 2e                	jmp    2aa6 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x4a>
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    2a78:	|     \-> 48 83 7d e8 03       	cmpq   $0x3,-0x18(%rbp)
+    2a7d:	|  /----- 76 09                	jbe    2a88 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x2c>
+    2a7f:	|  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a83:	|  |      48 01 c0             	add    %rax,%rax
+    2a86:	|  |  /-- eb 05                	jmp    2a8d <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x31>
+    2a88:	|  \--|-> b8 04 00 00 00       	mov    $0x4,%eax
+    2a8d:	|     \-> 48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return (cap < g) ? g : cap;
+    2a91:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a95:	|         48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    2a99:	|  /----- 73 06                	jae    2aa1 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x45>
+    2a9b:	|  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a9f:	|  |  /-- eb 04                	jmp    2aa5 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x49>
+    2aa1:	|  \--|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2aa5:	|     \-> 90                   	nop
+        }
+    2aa6:	\-------> 5d                   	pop    %rbp
+    2aa7:	          c3                   	ret
+
+0000000000002aa8 <nel::Element<U8Buf<256ul> >::Element<unsigned char>(unsigned char&&)>:
+        constexpr Element(Args &&...args)
+    2aa8:	55                   	push   %rbp
+    2aa9:	48 89 e5             	mov    %rsp,%rbp
+    2aac:	53                   	push   %rbx
+    2aad:	48 83 ec 18          	sub    $0x18,%rsp
+    2ab1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2ab5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : value_(forward<Args>(args)...)
+    2ab9:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    2abd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2ac1:	48 89 c7             	mov    %rax,%rdi
+    2ac4:	e8 b6 f2 ff ff       	call   1d7f <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    2ac9:	0f b6 00             	movzbl (%rax),%eax
+    2acc:	0f b6 c0             	movzbl %al,%eax
+    2acf:	89 c6                	mov    %eax,%esi
+    2ad1:	48 89 df             	mov    %rbx,%rdi
+    2ad4:	e8 93 fc ff ff       	call   276c <U8Buf<256ul>::U8Buf(unsigned char)>
+        }
+    2ad9:	90                   	nop
+    2ada:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2ade:	c9                   	leave
+    2adf:	c3                   	ret
+
+0000000000002ae0 <nel::Result<void, U8Buf<256ul> >::Result(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)1>)>:
+        constexpr Result(Phantom<Tag::OK> const)
+    2ae0:	55                   	push   %rbp
+    2ae1:	48 89 e5             	mov    %rsp,%rbp
+    2ae4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : tag_(Tag::OK)
+    2ae8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2aec:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+        }
+    2af2:	90                   	nop
+    2af3:	5d                   	pop    %rbp
+    2af4:	c3                   	ret
+    2af5:	90                   	nop
+
+0000000000002af6 <nel::Element<U8Buf<256ul> >::ref() const>:
+        constexpr Type const &ref(void) const
+    2af6:	55                   	push   %rbp
+    2af7:	48 89 e5             	mov    %rsp,%rbp
+    2afa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2afe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2b02:	5d                   	pop    %rbp
+    2b03:	c3                   	ret
+
+0000000000002b04 <nel::Element<void*>::ref() const>:
+        constexpr Type const &ref(void) const
+    2b04:	55                   	push   %rbp
+    2b05:	48 89 e5             	mov    %rsp,%rbp
+    2b08:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2b0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2b10:	5d                   	pop    %rbp
+    2b11:	c3                   	ret
+
+0000000000002b12 <nel::Element<nel::heaped::AllocError>::ref() const>:
+        constexpr Type const &ref(void) const
+    2b12:	55                   	push   %rbp
+    2b13:	48 89 e5             	mov    %rsp,%rbp
+    2b16:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2b1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2b1e:	5d                   	pop    %rbp
+    2b1f:	c3                   	ret
+
+0000000000002b20 <void*&& nel::forward<void*, void*>(void*&)>:
+constexpr U &&forward(T &t)
+    2b20:	55                   	push   %rbp
+    2b21:	48 89 e5             	mov    %rsp,%rbp
+    2b24:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    2b28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2b2c:	5d                   	pop    %rbp
+    2b2d:	c3                   	ret
+
+0000000000002b2e <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    2b2e:	             55                   	push   %rbp
+    2b2f:	             48 89 e5             	mov    %rsp,%rbp
+    2b32:	             48 83 ec 30          	sub    $0x30,%rsp
+    2b36:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2b3a:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2b3e:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    2b42:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    2b46:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b4a:	             8b 00                	mov    (%rax),%eax
+    2b4c:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    2b4f:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b53:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    2b59:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    2b5d:	         /-- 74 3e                	je     2b9d <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x6f>
+    2b5f:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    2b63:	/--------|-- 7f 7a                	jg     2bdf <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+    2b65:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2b69:	|  /-----|-- 74 5e                	je     2bc9 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x9b>
+    2b6b:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    2b6f:	+--|-----|-- 75 6e                	jne    2bdf <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+                    return on_ok(forward<T>(*ok_));
+    2b71:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b75:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    2b79:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2b7c:	|  |     |   e8 b1 00 00 00       	call   2c32 <nel::Element<void*>::operator*()>
+    2b81:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2b84:	|  |     |   e8 97 ff ff ff       	call   2b20 <void*&& nel::forward<void*, void*>(void*&)>
+    2b89:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    2b8c:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2b90:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    2b93:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    2b96:	|  |     |   e8 0b fd ff ff       	call   28a6 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>
+    2b9b:	|  |  /--|-- eb 58                	jmp    2bf5 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    return on_err(forward<E>(*err_));
+    2b9d:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ba1:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    2ba5:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2ba8:	|  |  |      e8 9f 00 00 00       	call   2c4c <nel::Element<nel::heaped::AllocError>::operator*()>
+    2bad:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2bb0:	|  |  |      e8 bf ef ff ff       	call   1b74 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    2bb5:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    2bb8:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2bbc:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    2bbf:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2bc2:	|  |  |      e8 01 fd ff ff       	call   28c8 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>
+    2bc7:	|  |  +----- eb 2c                	jmp    2bf5 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    nel::panic("invalid Result", ctx);
+    2bc9:	|  \--|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2bcd:	|     |      48 89 c6             	mov    %rax,%rsi
+    2bd0:	|     |      48 8d 05 af 14 00 00 	lea    0x14af(%rip),%rax        # 4086 <nel::sort::ninther_n+0x66>
+    2bd7:	|     |      48 89 c7             	mov    %rax,%rdi
+    2bda:	|     |      e8 f8 00 00 00       	call   2cd7 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    2bdf:	\-----|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2be3:	      |      48 89 c6             	mov    %rax,%rsi
+    2be6:	      |      48 8d 05 84 14 00 00 	lea    0x1484(%rip),%rax        # 4071 <nel::sort::ninther_n+0x51>
+    2bed:	      |      48 89 c7             	mov    %rax,%rdi
+    2bf0:	      |      e8 e2 00 00 00       	call   2cd7 <nel::panic(char const*, nel::Context const&)>
+        }
+    2bf5:	      \----> c9                   	leave
+    2bf6:	             c3                   	ret
+
+0000000000002bf7 <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>:
+constexpr T &&move(T &v)
+    2bf7:	55                   	push   %rbp
+    2bf8:	48 89 e5             	mov    %rsp,%rbp
+    2bfb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    2bff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2c03:	5d                   	pop    %rbp
+    2c04:	c3                   	ret
+    2c05:	90                   	nop
+
+0000000000002c06 <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>:
+        constexpr U8Buf(U8Buf &&o)
+    2c06:	55                   	push   %rbp
+    2c07:	48 89 e5             	mov    %rsp,%rbp
+    2c0a:	48 83 ec 10          	sub    $0x10,%rsp
+    2c0e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2c12:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            nel::elem::move(data_, o.data_, N);
+    2c16:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2c1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c1e:	ba 00 01 00 00       	mov    $0x100,%edx
+    2c23:	48 89 ce             	mov    %rcx,%rsi
+    2c26:	48 89 c7             	mov    %rax,%rdi
+    2c29:	e8 bb 01 00 00       	call   2de9 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+        }
+    2c2e:	90                   	nop
+    2c2f:	c9                   	leave
+    2c30:	c3                   	ret
+    2c31:	90                   	nop
+
+0000000000002c32 <nel::Element<void*>::operator*()>:
+
+        constexpr Type &operator*(void)
+    2c32:	55                   	push   %rbp
+    2c33:	48 89 e5             	mov    %rsp,%rbp
+    2c36:	48 83 ec 10          	sub    $0x10,%rsp
+    2c3a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    2c3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c42:	48 89 c7             	mov    %rax,%rdi
+    2c45:	e8 1c 00 00 00       	call   2c66 <nel::Element<void*>::ref()>
+        }
+    2c4a:	c9                   	leave
+    2c4b:	c3                   	ret
+
+0000000000002c4c <nel::Element<nel::heaped::AllocError>::operator*()>:
+        constexpr Type &operator*(void)
+    2c4c:	55                   	push   %rbp
+    2c4d:	48 89 e5             	mov    %rsp,%rbp
+    2c50:	48 83 ec 10          	sub    $0x10,%rsp
+    2c54:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    2c58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c5c:	48 89 c7             	mov    %rax,%rdi
+    2c5f:	e8 10 00 00 00       	call   2c74 <nel::Element<nel::heaped::AllocError>::ref()>
+        }
+    2c64:	c9                   	leave
+    2c65:	c3                   	ret
+
+0000000000002c66 <nel::Element<void*>::ref()>:
+        constexpr Type &ref(void)
+    2c66:	55                   	push   %rbp
+    2c67:	48 89 e5             	mov    %rsp,%rbp
+    2c6a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2c6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2c72:	5d                   	pop    %rbp
+    2c73:	c3                   	ret
+
+0000000000002c74 <nel::Element<nel::heaped::AllocError>::ref()>:
+        constexpr Type &ref(void)
+    2c74:	55                   	push   %rbp
+    2c75:	48 89 e5             	mov    %rsp,%rbp
+    2c78:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    2c7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2c80:	5d                   	pop    %rbp
+    2c81:	c3                   	ret
+
+0000000000002c82 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    2c82:	55                   	push   %rbp
+    2c83:	48 89 e5             	mov    %rsp,%rbp
+    std::abort();
+    2c86:	e8 b5 e3 ff ff       	call   1040 <abort@plt>
+
+0000000000002c8b <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    2c8b:	55                   	push   %rbp
+    2c8c:	48 89 e5             	mov    %rsp,%rbp
+    2c8f:	48 83 ec 10          	sub    $0x10,%rsp
+    2c93:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    2c97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c9b:	48 8b 30             	mov    (%rax),%rsi
+    2c9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ca2:	8b 48 10             	mov    0x10(%rax),%ecx
+    2ca5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ca9:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2cad:	48 8b 05 ac 43 00 00 	mov    0x43ac(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    2cb4:	4c 8d 0d 32 14 00 00 	lea    0x1432(%rip),%r9        # 40ed <nel::is_trivially_relocatable<U8Buf<256ul> >+0x1>
+    2cbb:	49 89 f0             	mov    %rsi,%r8
+    2cbe:	48 8d 35 2e 14 00 00 	lea    0x142e(%rip),%rsi        # 40f3 <nel::is_trivially_relocatable<U8Buf<256ul> >+0x7>
+    2cc5:	48 89 c7             	mov    %rax,%rdi
+    2cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+    2ccd:	e8 be e3 ff ff       	call   1090 <fprintf@plt>
+    abort();
+    2cd2:	e8 ab ff ff ff       	call   2c82 <nel::abort()>
+
+0000000000002cd7 <nel::panic(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    2cd7:	55                   	push   %rbp
+    2cd8:	48 89 e5             	mov    %rsp,%rbp
+    2cdb:	48 83 ec 10          	sub    $0x10,%rsp
+    2cdf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2ce3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    2ce7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ceb:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    2cee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2cf2:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    2cf5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2cf9:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    2cfd:	48 8b 05 5c 43 00 00 	mov    0x435c(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    2d04:	48 83 ec 08          	sub    $0x8,%rsp
+    2d08:	ff 75 f8             	push   -0x8(%rbp)
+    2d0b:	4c 8d 0d db 13 00 00 	lea    0x13db(%rip),%r9        # 40ed <nel::is_trivially_relocatable<U8Buf<256ul> >+0x1>
+    2d12:	49 89 f0             	mov    %rsi,%r8
+    2d15:	48 8d 35 e8 13 00 00 	lea    0x13e8(%rip),%rsi        # 4104 <nel::is_trivially_relocatable<U8Buf<256ul> >+0x18>
+    2d1c:	48 89 c7             	mov    %rax,%rdi
+    2d1f:	b8 00 00 00 00       	mov    $0x0,%eax
+    2d24:	e8 67 e3 ff ff       	call   1090 <fprintf@plt>
+    2d29:	48 83 c4 10          	add    $0x10,%rsp
+            "PANIC",
+            msg);
+    abort();
+    2d2d:	e8 50 ff ff ff       	call   2c82 <nel::abort()>
+
+0000000000002d32 <nel::assert_fail(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    2d32:	55                   	push   %rbp
+    2d33:	48 89 e5             	mov    %rsp,%rbp
+    2d36:	48 83 ec 10          	sub    $0x10,%rsp
+    2d3a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2d3e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    2d42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2d46:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    2d49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2d4d:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    2d50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2d54:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    2d58:	48 8b 05 01 43 00 00 	mov    0x4301(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    2d5f:	48 83 ec 08          	sub    $0x8,%rsp
+    2d63:	ff 75 f8             	push   -0x8(%rbp)
+    2d66:	4c 8d 0d ac 13 00 00 	lea    0x13ac(%rip),%r9        # 4119 <nel::is_trivially_relocatable<U8Buf<256ul> >+0x2d>
+    2d6d:	49 89 f0             	mov    %rsi,%r8
+    2d70:	48 8d 35 8d 13 00 00 	lea    0x138d(%rip),%rsi        # 4104 <nel::is_trivially_relocatable<U8Buf<256ul> >+0x18>
+    2d77:	48 89 c7             	mov    %rax,%rdi
+    2d7a:	b8 00 00 00 00       	mov    $0x0,%eax
+    2d7f:	e8 0c e3 ff ff       	call   1090 <fprintf@plt>
+    2d84:	48 83 c4 10          	add    $0x10,%rsp
+            "ASSERT FAIL",
+            msg);
+    abort();
+    2d88:	e8 f5 fe ff ff       	call   2c82 <nel::abort()>
+
+0000000000002d8d <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    2d8d:	55                   	push   %rbp
+    2d8e:	48 89 e5             	mov    %rsp,%rbp
+    2d91:	48 83 ec 20          	sub    $0x20,%rsp
+    2d95:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2d99:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2d9d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    2da1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2da5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2da9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2dad:	48 89 ce             	mov    %rcx,%rsi
+    2db0:	48 89 c7             	mov    %rax,%rdi
+    2db3:	e8 e8 e2 ff ff       	call   10a0 <memcpy@plt>
+}
+    2db8:	90                   	nop
+    2db9:	c9                   	leave
+    2dba:	c3                   	ret
+
+0000000000002dbb <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    2dbb:	55                   	push   %rbp
+    2dbc:	48 89 e5             	mov    %rsp,%rbp
+    2dbf:	48 83 ec 20          	sub    $0x20,%rsp
+    2dc3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2dc7:	89 f0                	mov    %esi,%eax
+    2dc9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2dcd:	88 45 f4             	mov    %al,-0xc(%rbp)
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    2dd0:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    2dd4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2dd8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ddc:	89 ce                	mov    %ecx,%esi
+    2dde:	48 89 c7             	mov    %rax,%rdi
+    2de1:	e8 7a e2 ff ff       	call   1060 <memset@plt>
+}
+    2de6:	90                   	nop
+    2de7:	c9                   	leave
+    2de8:	c3                   	ret
+
+0000000000002de9 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    2de9:	55                   	push   %rbp
+    2dea:	48 89 e5             	mov    %rsp,%rbp
+    2ded:	48 83 ec 20          	sub    $0x20,%rsp
+    2df1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2df5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2df9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    //     *id = *is;
+    // }
+    // for (uint8_t *id = d, *is = s, *const e = (d + n); id != e; ++is, ++id) {
+    //     *is = 0xa5;
+    // }
+    copy(d, s, n);
+    2dfd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2e01:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2e05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e09:	48 89 ce             	mov    %rcx,%rsi
+    2e0c:	48 89 c7             	mov    %rax,%rdi
+    2e0f:	e8 79 ff ff ff       	call   2d8d <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    poison(s, n);
+    2e14:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2e18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e1c:	48 89 d6             	mov    %rdx,%rsi
+    2e1f:	48 89 c7             	mov    %rax,%rdi
+    2e22:	e8 60 07 00 00       	call   3587 <nel::elem::poison(unsigned char*, unsigned long)>
+}
+    2e27:	90                   	nop
+    2e28:	c9                   	leave
+    2e29:	c3                   	ret
+
+0000000000002e2a <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    2e2a:	55                   	push   %rbp
+    2e2b:	48 89 e5             	mov    %rsp,%rbp
+    2e2e:	48 83 ec 20          	sub    $0x20,%rsp
+    2e32:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2e36:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2e3a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    std::memmove(d, s, n);
+    2e3e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2e42:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2e46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e4a:	48 89 ce             	mov    %rcx,%rsi
+    2e4d:	48 89 c7             	mov    %rax,%rdi
+    2e50:	e8 6b e2 ff ff       	call   10c0 <memmove@plt>
+}
+    2e55:	90                   	nop
+    2e56:	c9                   	leave
+    2e57:	c3                   	ret
+
+0000000000002e58 <nel::elem::wipe(unsigned char*, unsigned long)>:
+
+void wipe(uint8_t *const d, Length const n)
+{
+    2e58:	55                   	push   %rbp
+    2e59:	48 89 e5             	mov    %rsp,%rbp
+    2e5c:	48 83 ec 10          	sub    $0x10,%rsp
+    2e60:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2e64:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    set(d, 0xa5, n);
+    2e68:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2e6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e70:	be a5 00 00 00       	mov    $0xa5,%esi
+    2e75:	48 89 c7             	mov    %rax,%rdi
+    2e78:	e8 3e ff ff ff       	call   2dbb <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    2e7d:	90                   	nop
+    2e7e:	c9                   	leave
+    2e7f:	c3                   	ret
+
+0000000000002e80 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    2e80:	55                   	push   %rbp
+    2e81:	48 89 e5             	mov    %rsp,%rbp
+    2e84:	48 83 ec 20          	sub    $0x20,%rsp
+    2e88:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2e8c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2e90:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    2e94:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2e98:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2e9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ea0:	48 89 ce             	mov    %rcx,%rsi
+    2ea3:	48 89 c7             	mov    %rax,%rdi
+    2ea6:	e8 d5 e1 ff ff       	call   1080 <memcmp@plt>
+    2eab:	85 c0                	test   %eax,%eax
+    2ead:	0f 94 c0             	sete   %al
+}
+    2eb0:	c9                   	leave
+    2eb1:	c3                   	ret
+
+0000000000002eb2 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    2eb2:	55                   	push   %rbp
+    2eb3:	48 89 e5             	mov    %rsp,%rbp
+    2eb6:	48 83 ec 20          	sub    $0x20,%rsp
+    2eba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2ebe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2ec2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    2ec6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2eca:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2ece:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ed2:	48 89 ce             	mov    %rcx,%rsi
+    2ed5:	48 89 c7             	mov    %rax,%rdi
+    2ed8:	e8 a3 e1 ff ff       	call   1080 <memcmp@plt>
+    2edd:	85 c0                	test   %eax,%eax
+    2edf:	0f 95 c0             	setne  %al
+}
+    2ee2:	c9                   	leave
+    2ee3:	c3                   	ret
+
+0000000000002ee4 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>:
+
+// d[i] = p[i % 16] for i in [0, n), with normal stores:
+// the pattern once, then doubling the filled region.
+static void set_pattern(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    2ee4:	       55                   	push   %rbp
+    2ee5:	       48 89 e5             	mov    %rsp,%rbp
+    2ee8:	       48 83 ec 30          	sub    $0x30,%rsp
+    2eec:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2ef0:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2ef4:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    Length done = (n < 16) ? n : 16;
+    2ef8:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2efc:	       ba 10 00 00 00       	mov    $0x10,%edx
+    2f01:	       48 39 d0             	cmp    %rdx,%rax
+    2f04:	       48 0f 47 c2          	cmova  %rdx,%rax
+    2f08:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    copy(d, p, done);
+    2f0c:	       48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2f10:	       48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2f14:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f18:	       48 89 ce             	mov    %rcx,%rsi
+    2f1b:	       48 89 c7             	mov    %rax,%rdi
+    2f1e:	       e8 6a fe ff ff       	call   2d8d <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    while (done < n) {
+    2f23:	   /-- eb 3e                	jmp    2f63 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x7f>
+        Length const m = (done < n - done) ? done : n - done;
+    2f25:	/--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2f29:	|  |   48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    2f2d:	|  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2f31:	|  |   48 39 c2             	cmp    %rax,%rdx
+    2f34:	|  |   48 0f 46 c2          	cmovbe %rdx,%rax
+    2f38:	|  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        copy(d + done, d, m);
+    2f3c:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2f40:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f44:	|  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    2f48:	|  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2f4c:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f50:	|  |   48 89 c6             	mov    %rax,%rsi
+    2f53:	|  |   48 89 cf             	mov    %rcx,%rdi
+    2f56:	|  |   e8 32 fe ff ff       	call   2d8d <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        done += m;
+    2f5b:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2f5f:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+    while (done < n) {
+    2f63:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f67:	|      48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    2f6b:	\----- 72 b8                	jb     2f25 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x41>
+    }
+}
+    2f6d:	       90                   	nop
+    2f6e:	       90                   	nop
+    2f6f:	       c9                   	leave
+    2f70:	       c3                   	ret
+
+0000000000002f71 <nel::elem::load16(unsigned char const*)>:
+static constexpr Length streaming_min = 256;
+
+typedef long long int Line16 __attribute__((vector_size(16)));
+
+static inline Line16 load16(uint8_t const *const s)
+{
+    2f71:	55                   	push   %rbp
+    2f72:	48 89 e5             	mov    %rsp,%rbp
+    2f75:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Line16 v;
+    std::memcpy(&v, s, sizeof(v));
+    2f79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f7d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2f81:	48 8b 00             	mov    (%rax),%rax
+    2f84:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2f88:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    return v;
+    2f8c:	66 0f 6f 45 f0       	movdqa -0x10(%rbp),%xmm0
+}
+    2f91:	5d                   	pop    %rbp
+    2f92:	c3                   	ret
+
+0000000000002f93 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>:
+
+static inline void stream16(uint8_t *const d, Line16 const &v)
+{
+    2f93:	55                   	push   %rbp
+    2f94:	48 89 e5             	mov    %rsp,%rbp
+    2f97:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2f9b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2f9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2fa3:	66 0f 6f 00          	movdqa (%rax),%xmm0
+    2fa7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2fab:	66 0f e7 00          	movntdq %xmm0,(%rax)
+}
+    2faf:	90                   	nop
+    2fb0:	5d                   	pop    %rbp
+    2fb1:	c3                   	ret
+
+0000000000002fb2 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    2fb2:	          55                   	push   %rbp
+    2fb3:	          48 89 e5             	mov    %rsp,%rbp
+    2fb6:	          48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    2fba:	          48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    2fbe:	          48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    2fc2:	          48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    if (n < streaming_min) {
+    2fc6:	          48 81 7d 88 ff 00 00 	cmpq   $0xff,-0x78(%rbp)
+    2fcd:	          00 
+    2fce:	      /-- 77 1c                	ja     2fec <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        copy(d, s, n);
+    2fd0:	      |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    2fd4:	      |   48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    2fd8:	      |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2fdc:	      |   48 89 ce             	mov    %rcx,%rsi
+    2fdf:	      |   48 89 c7             	mov    %rax,%rdi
+    2fe2:	      |   e8 a6 fd ff ff       	call   2d8d <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        return;
+    2fe7:	/-----|-- e9 98 01 00 00       	jmp    3184 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1d2>
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2fec:	|     \-> 48 8b 45 98          	mov    -0x68(%rbp),%rax
+    2ff0:	|         48 f7 d8             	neg    %rax
+    2ff3:	|         83 e0 0f             	and    $0xf,%eax
+    2ff6:	|         48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    copy(d, s, head);
+    2ffa:	|         48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2ffe:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    3002:	|         48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3006:	|         48 89 ce             	mov    %rcx,%rsi
+    3009:	|         48 89 c7             	mov    %rax,%rdi
+    300c:	|         e8 7c fd ff ff       	call   2d8d <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    Index i = head;
+    3011:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3015:	|         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    3019:	|     /-- e9 e1 00 00 00       	jmp    30ff <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        Line16 const a = load16(s + i);
+    301e:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3022:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3026:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3029:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    302c:	|  |  |   e8 40 ff ff ff       	call   2f71 <nel::elem::load16(unsigned char const*)>
+    3031:	|  |  |   0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+        Line16 const b = load16(s + i + 16);
+    3035:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3039:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    303d:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3041:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3044:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3047:	|  |  |   e8 25 ff ff ff       	call   2f71 <nel::elem::load16(unsigned char const*)>
+    304c:	|  |  |   0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+        Line16 const c = load16(s + i + 32);
+    3050:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3054:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    3058:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    305c:	|  |  |   48 01 d0             	add    %rdx,%rax
+    305f:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3062:	|  |  |   e8 0a ff ff ff       	call   2f71 <nel::elem::load16(unsigned char const*)>
+    3067:	|  |  |   0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+        Line16 const e = load16(s + i + 48);
+    306b:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    306f:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    3073:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3077:	|  |  |   48 01 d0             	add    %rdx,%rax
+    307a:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    307d:	|  |  |   e8 ef fe ff ff       	call   2f71 <nel::elem::load16(unsigned char const*)>
+    3082:	|  |  |   0f 29 45 a0          	movaps %xmm0,-0x60(%rbp)
+        stream16(d + i, a);
+    3086:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    308a:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    308e:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3091:	|  |  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    3095:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3098:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    309b:	|  |  |   e8 f3 fe ff ff       	call   2f93 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, b);
+    30a0:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30a4:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    30a8:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    30ac:	|  |  |   48 01 c2             	add    %rax,%rdx
+    30af:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    30b3:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    30b6:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    30b9:	|  |  |   e8 d5 fe ff ff       	call   2f93 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, c);
+    30be:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30c2:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    30c6:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    30ca:	|  |  |   48 01 c2             	add    %rax,%rdx
+    30cd:	|  |  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    30d1:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    30d4:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    30d7:	|  |  |   e8 b7 fe ff ff       	call   2f93 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, e);
+    30dc:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30e0:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    30e4:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    30e8:	|  |  |   48 01 c2             	add    %rax,%rdx
+    30eb:	|  |  |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    30ef:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    30f2:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    30f5:	|  |  |   e8 99 fe ff ff       	call   2f93 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    30fa:	|  |  |   48 83 45 f8 40       	addq   $0x40,-0x8(%rbp)
+    30ff:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3103:	|  |      48 83 c0 40          	add    $0x40,%rax
+    3107:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    310b:	|  \----- 0f 83 0d ff ff ff    	jae    301e <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x6c>
+    }
+    for (; i + 16 <= n; i += 16) {
+    3111:	|     /-- eb 36                	jmp    3149 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x197>
+        stream16(d + i, load16(s + i));
+    3113:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3117:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    311b:	|  |  |   48 01 d0             	add    %rdx,%rax
+    311e:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3121:	|  |  |   e8 4b fe ff ff       	call   2f71 <nel::elem::load16(unsigned char const*)>
+    3126:	|  |  |   0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+    312a:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    312e:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3132:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3135:	|  |  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    3139:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    313c:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    313f:	|  |  |   e8 4f fe ff ff       	call   2f93 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    3144:	|  |  |   48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+    3149:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    314d:	|  |      48 83 c0 10          	add    $0x10,%rax
+    3151:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    3155:	|  \----- 73 bc                	jae    3113 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    3157:	|         0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    315a:	|         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    315e:	|         48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    3162:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    3166:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    316a:	|         48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    316e:	|         48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+    3172:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3176:	|         48 01 d1             	add    %rdx,%rcx
+    3179:	|         48 89 c2             	mov    %rax,%rdx
+    317c:	|         48 89 cf             	mov    %rcx,%rdi
+    317f:	|         e8 09 fc ff ff       	call   2d8d <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+}
+    3184:	\-------> c9                   	leave
+    3185:	          c3                   	ret
+
+0000000000003186 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    3186:	          55                   	push   %rbp
+    3187:	          48 89 e5             	mov    %rsp,%rbp
+    318a:	          48 83 ec 60          	sub    $0x60,%rsp
+    318e:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    3192:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    3196:	          48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    if (n < streaming_min) {
+    319a:	          48 81 7d a8 ff 00 00 	cmpq   $0xff,-0x58(%rbp)
+    31a1:	          00 
+    31a2:	      /-- 77 1c                	ja     31c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        set_pattern(d, p, n);
+    31a4:	      |   48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    31a8:	      |   48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+    31ac:	      |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    31b0:	      |   48 89 ce             	mov    %rcx,%rsi
+    31b3:	      |   48 89 c7             	mov    %rax,%rdi
+    31b6:	      |   e8 29 fd ff ff       	call   2ee4 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>
+    31bb:	/-----|-- e9 89 01 00 00       	jmp    3349 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c3>
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    31c0:	|     \-> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    31c4:	|         48 f7 d8             	neg    %rax
+    31c7:	|         83 e0 0f             	and    $0xf,%eax
+    31ca:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    for (Index i = 0; i < head; ++i) {
+    31ce:	|         48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    31d5:	|         00 
+    31d6:	|     /-- eb 20                	jmp    31f8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x72>
+        d[i] = p[i];
+    31d8:	|  /--|-> 48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    31dc:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31e0:	|  |  |   48 01 d0             	add    %rdx,%rax
+    31e3:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    31e7:	|  |  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    31eb:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    31ee:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    31f1:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < head; ++i) {
+    31f3:	|  |  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    31f8:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31fc:	|  |      48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    3200:	|  \----- 72 d6                	jb     31d8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x52>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    3202:	|         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    3209:	|         00 
+    320a:	|     /-- eb 2d                	jmp    3239 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xb3>
+        rotated[i] = p[(head + i) % 16];
+    320c:	|  /--|-> 48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    3210:	|  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3214:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3217:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    321a:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    321d:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3221:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3224:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    3227:	|  |  |   48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    322b:	|  |  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    322f:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    3232:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < 16; ++i) {
+    3234:	|  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    3239:	|  |  \-> 48 83 7d f0 0f       	cmpq   $0xf,-0x10(%rbp)
+    323e:	|  \----- 76 cc                	jbe    320c <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x86>
+    }
+    Line16 const v = load16(rotated);
+    3240:	|         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    3244:	|         48 89 c7             	mov    %rax,%rdi
+    3247:	|         e8 25 fd ff ff       	call   2f71 <nel::elem::load16(unsigned char const*)>
+    324c:	|         0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+    Index i = head;
+    3250:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3254:	|         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    3258:	|     /-- eb 79                	jmp    32d3 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        stream16(d + i, v);
+    325a:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    325e:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3262:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3265:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3269:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    326c:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    326f:	|  |  |   e8 1f fd ff ff       	call   2f93 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, v);
+    3274:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3278:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    327c:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3280:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3283:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3287:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    328a:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    328d:	|  |  |   e8 01 fd ff ff       	call   2f93 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, v);
+    3292:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3296:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    329a:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    329e:	|  |  |   48 01 c2             	add    %rax,%rdx
+    32a1:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    32a5:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    32a8:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    32ab:	|  |  |   e8 e3 fc ff ff       	call   2f93 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, v);
+    32b0:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    32b4:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    32b8:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    32bc:	|  |  |   48 01 c2             	add    %rax,%rdx
+    32bf:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    32c3:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    32c6:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    32c9:	|  |  |   e8 c5 fc ff ff       	call   2f93 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    32ce:	|  |  |   48 83 45 e8 40       	addq   $0x40,-0x18(%rbp)
+    32d3:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    32d7:	|  |      48 83 c0 40          	add    $0x40,%rax
+    32db:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    32df:	|  \----- 0f 83 75 ff ff ff    	jae    325a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd4>
+    }
+    for (; i + 16 <= n; i += 16) {
+    32e5:	|     /-- eb 1f                	jmp    3306 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x180>
+        stream16(d + i, v);
+    32e7:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    32eb:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    32ef:	|  |  |   48 01 c2             	add    %rax,%rdx
+    32f2:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    32f6:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    32f9:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    32fc:	|  |  |   e8 92 fc ff ff       	call   2f93 <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    3301:	|  |  |   48 83 45 e8 10       	addq   $0x10,-0x18(%rbp)
+    3306:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    330a:	|  |      48 83 c0 10          	add    $0x10,%rax
+    330e:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    3312:	|  \----- 73 d3                	jae    32e7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    __builtin_ia32_sfence();
+    3314:	|         0f ae f8             	sfence
+    for (; i < n; ++i) {
+    3317:	|     /-- eb 26                	jmp    333f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1b9>
+        d[i] = p[i % 16];
+    3319:	|  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    331d:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    3320:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    3323:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3327:	|  |  |   48 01 d0             	add    %rdx,%rax
+    332a:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    332e:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3332:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    3335:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    3338:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (; i < n; ++i) {
+    333a:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    333f:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3343:	|  |      48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    3347:	|  \----- 72 d0                	jb     3319 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x193>
+    }
+}
+    3349:	\-------> c9                   	leave
+    334a:	          c3                   	ret
+
+000000000000334b <nel::offset_of(unsigned char*, unsigned long)>:
+// The payload is the first align boundary leaving room for a Length in front,
+// which holds the offset from the start of the underlying allocation.
+// Malloc alignment is at least alignof(Length), so the payload is at most
+// align bytes in.
+static Length offset_of(uint8_t *const base, Length const align)
+{
+    334b:	55                   	push   %rbp
+    334c:	48 89 e5             	mov    %rsp,%rbp
+    334f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3353:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    USize const a = reinterpret_cast<USize>(base) + sizeof(Length);
+    3357:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    335b:	48 83 c0 08          	add    $0x8,%rax
+    335f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    3363:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3367:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    336b:	48 01 d0             	add    %rdx,%rax
+    336e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    3372:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3376:	48 f7 d8             	neg    %rax
+    3379:	48 21 c2             	and    %rax,%rdx
+    337c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3380:	48 29 c2             	sub    %rax,%rdx
+    3383:	48 89 d0             	mov    %rdx,%rax
+}
+    3386:	5d                   	pop    %rbp
+    3387:	c3                   	ret
+
+0000000000003388 <nel::offset_field(unsigned char*)>:
+
+static Length &offset_field(uint8_t *const p)
+{
+    3388:	55                   	push   %rbp
+    3389:	48 89 e5             	mov    %rsp,%rbp
+    338c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return reinterpret_cast<Length *>(p)[-1];
+    3390:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3394:	48 83 e8 08          	sub    $0x8,%rax
+}
+    3398:	5d                   	pop    %rbp
+    3399:	c3                   	ret
+
+000000000000339a <nel::free_aligned(void*)>:
+
+void free_aligned(void *const p)
+{
+    339a:	       55                   	push   %rbp
+    339b:	       48 89 e5             	mov    %rsp,%rbp
+    339e:	       48 83 ec 20          	sub    $0x20,%rsp
+    33a2:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (p == nullptr) { return; }
+    33a6:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    33ab:	/----- 74 2e                	je     33db <nel::free_aligned(void*)+0x41>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    33ad:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    33b1:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    std::free(u8p - offset_field(u8p));
+    33b5:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33b9:	|      48 89 c7             	mov    %rax,%rdi
+    33bc:	|      e8 c7 ff ff ff       	call   3388 <nel::offset_field(unsigned char*)>
+    33c1:	|      48 8b 00             	mov    (%rax),%rax
+    33c4:	|      48 f7 d8             	neg    %rax
+    33c7:	|      48 89 c2             	mov    %rax,%rdx
+    33ca:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33ce:	|      48 01 d0             	add    %rdx,%rax
+    33d1:	|      48 89 c7             	mov    %rax,%rdi
+    33d4:	|      e8 57 dc ff ff       	call   1030 <free@plt>
+    33d9:	|  /-- eb 01                	jmp    33dc <nel::free_aligned(void*)+0x42>
+    if (p == nullptr) { return; }
+    33db:	\--|-> 90                   	nop
+}
+    33dc:	   \-> c9                   	leave
+    33dd:	       c3                   	ret
+
+00000000000033de <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    33de:	             55                   	push   %rbp
+    33df:	             48 89 e5             	mov    %rsp,%rbp
+    33e2:	             53                   	push   %rbx
+    33e3:	             48 83 ec 78          	sub    $0x78,%rsp
+    33e7:	             48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    33eb:	             48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    33ef:	             48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    33f3:	             48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    33f7:	             48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    33fb:	             b9 f3 00 00 00       	mov    $0xf3,%ecx
+    3400:	             48 8d 15 31 0d 00 00 	lea    0xd31(%rip),%rdx        # 4138 <nel::elem::streaming_min+0x8>
+    3407:	             48 8d 35 3c 0d 00 00 	lea    0xd3c(%rip),%rsi        # 414a <nel::elem::streaming_min+0x1a>
+    340e:	             48 89 c7             	mov    %rax,%rdi
+    3411:	             e8 96 e0 ff ff       	call   14ac <nel::Context::Context(char const*, char const*, int)>
+    3416:	             48 83 7d 90 00       	cmpq   $0x0,-0x70(%rbp)
+    341b:	      /----- 74 18                	je     3435 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    341d:	      |      48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3421:	      |      48 83 e8 01          	sub    $0x1,%rax
+    3425:	      |      48 23 45 90          	and    -0x70(%rbp),%rax
+    3429:	      |      48 85 c0             	test   %rax,%rax
+    342c:	      +----- 75 07                	jne    3435 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    342e:	      |      b8 01 00 00 00       	mov    $0x1,%eax
+    3433:	      |  /-- eb 05                	jmp    343a <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x5c>
+    3435:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    343a:	         \-> 0f b6 c0             	movzbl %al,%eax
+    343d:	             48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    3441:	             48 8d 0d 12 0d 00 00 	lea    0xd12(%rip),%rcx        # 415a <nel::elem::streaming_min+0x2a>
+    3448:	             48 89 ce             	mov    %rcx,%rsi
+    344b:	             89 c7                	mov    %eax,%edi
+    344d:	             e8 91 e0 ff ff       	call   14e3 <nel::assert(bool, char const*, nel::Context const&)>
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    3452:	             48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3456:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    345a:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    345f:	      /----- 74 11                	je     3472 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x94>
+    3461:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3465:	      |      48 89 c7             	mov    %rax,%rdi
+    3468:	      |      e8 1b ff ff ff       	call   3388 <nel::offset_field(unsigned char*)>
+    346d:	      |      48 8b 00             	mov    (%rax),%rax
+    3470:	      |  /-- eb 05                	jmp    3477 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x99>
+    3472:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3477:	         \-> 48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    347b:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3480:	      /----- 74 13                	je     3495 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb7>
+    3482:	      |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3486:	      |      48 f7 d8             	neg    %rax
+    3489:	      |      48 89 c2             	mov    %rax,%rdx
+    348c:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3490:	      |      48 01 d0             	add    %rdx,%rax
+    3493:	      |  /-- eb 05                	jmp    349a <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xbc>
+    3495:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    349a:	         \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    349e:	             48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    34a2:	             48 8b 45 90          	mov    -0x70(%rbp),%rax
+    34a6:	             48 01 c2             	add    %rax,%rdx
+    34a9:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    34ad:	             48 89 d6             	mov    %rdx,%rsi
+    34b0:	             48 89 c7             	mov    %rax,%rdi
+    34b3:	             e8 f8 db ff ff       	call   10b0 <realloc@plt>
+    34b8:	             48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if (new_base == nullptr) { return nullptr; }
+    34bc:	             48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    34c1:	         /-- 75 0a                	jne    34cd <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    34c3:	         |   b8 00 00 00 00       	mov    $0x0,%eax
+    34c8:	/--------|-- e9 85 00 00 00       	jmp    3552 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x174>
+
+    Length const new_offset = offset_of(new_base, align);
+    34cd:	|        \-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    34d1:	|            48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    34d5:	|            48 89 d6             	mov    %rdx,%rsi
+    34d8:	|            48 89 c7             	mov    %rax,%rdi
+    34db:	|            e8 6b fe ff ff       	call   334b <nel::offset_of(unsigned char*, unsigned long)>
+    34e0:	|            48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    uint8_t *const new_p = new_base + new_offset;
+    34e4:	|            48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    34e8:	|            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    34ec:	|            48 01 d0             	add    %rdx,%rax
+    34ef:	|            48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    if (old_p != nullptr && new_offset != old_offset) {
+    34f3:	|            48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    34f8:	|  /-------- 74 41                	je     353b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+    34fa:	|  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    34fe:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    3502:	|  +-------- 74 37                	je     353b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+    3504:	|  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3508:	|  |         48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    350c:	|  |  /----- 73 06                	jae    3514 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x136>
+    350e:	|  |  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3512:	|  |  |  /-- eb 04                	jmp    3518 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x13a>
+    3514:	|  |  \--|-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    3518:	|  |     \-> 48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        std::memmove(new_p, new_base + old_offset, n);
+    351c:	|  |         48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    3520:	|  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3524:	|  |         48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    3528:	|  |         48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    352c:	|  |         48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    3530:	|  |         48 89 ce             	mov    %rcx,%rsi
+    3533:	|  |         48 89 c7             	mov    %rax,%rdi
+    3536:	|  |         e8 85 db ff ff       	call   10c0 <memmove@plt>
+    }
+    offset_field(new_p) = new_offset;
+    353b:	|  \-------> 48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+    353f:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    3543:	|            48 89 c7             	mov    %rax,%rdi
+    3546:	|            e8 3d fe ff ff       	call   3388 <nel::offset_field(unsigned char*)>
+    354b:	|            48 89 18             	mov    %rbx,(%rax)
+    return new_p;
+    354e:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+}
+    3552:	\----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3556:	             c9                   	leave
+    3557:	             c3                   	ret
+
+0000000000003558 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    3558:	55                   	push   %rbp
+    3559:	48 89 e5             	mov    %rsp,%rbp
+    355c:	48 83 ec 10          	sub    $0x10,%rsp
+    3560:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3564:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return realloc_aligned(nullptr, align, 0, size);
+    3568:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    356c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3570:	48 89 d1             	mov    %rdx,%rcx
+    3573:	ba 00 00 00 00       	mov    $0x0,%edx
+    3578:	48 89 c6             	mov    %rax,%rsi
+    357b:	bf 00 00 00 00       	mov    $0x0,%edi
+    3580:	e8 59 fe ff ff       	call   33de <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+}
+    3585:	c9                   	leave
+    3586:	c3                   	ret
+
+0000000000003587 <nel::elem::poison(unsigned char*, unsigned long)>:
+{
+    3587:	55                   	push   %rbp
+    3588:	48 89 e5             	mov    %rsp,%rbp
+    358b:	48 83 ec 10          	sub    $0x10,%rsp
+    358f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3593:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    copy(d, s, n);
+    3597:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    359b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    359f:	48 89 d6             	mov    %rdx,%rsi
+    35a2:	48 89 c7             	mov    %rax,%rdi
+    35a5:	e8 ae f8 ff ff       	call   2e58 <nel::elem::wipe(unsigned char*, unsigned long)>
+}
+    35aa:	90                   	nop
+    35ab:	c9                   	leave
+    35ac:	c3                   	ret
+
+00000000000035ad <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    35ad:	55                   	push   %rbp
+    35ae:	48 89 e5             	mov    %rsp,%rbp
+    35b1:	48 83 ec 10          	sub    $0x10,%rsp
+    35b5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    35b9:	89 f0                	mov    %esi,%eax
+    35bb:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    35be:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    35c2:	48 8b 15 97 3a 00 00 	mov    0x3a97(%rip),%rdx        # 7060 <stderr@GLIBC_2.2.5>
+    35c9:	48 89 d6             	mov    %rdx,%rsi
+    35cc:	89 c7                	mov    %eax,%edi
+    35ce:	e8 9d da ff ff       	call   1070 <fputc@plt>
+    return outs;
+    35d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    35d7:	c9                   	leave
+    35d8:	c3                   	ret
+
+00000000000035d9 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    35d9:	55                   	push   %rbp
+    35da:	48 89 e5             	mov    %rsp,%rbp
+    35dd:	48 83 ec 10          	sub    $0x10,%rsp
+    35e1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    35e5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    35e9:	48 8b 15 70 3a 00 00 	mov    0x3a70(%rip),%rdx        # 7060 <stderr@GLIBC_2.2.5>
+    35f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    35f4:	48 89 d6             	mov    %rdx,%rsi
+    35f7:	48 89 c7             	mov    %rax,%rdi
+    35fa:	e8 51 da ff ff       	call   1050 <fputs@plt>
+    return outs;
+    35ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3603:	c9                   	leave
+    3604:	c3                   	ret
+
+0000000000003605 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    3605:	55                   	push   %rbp
+    3606:	48 89 e5             	mov    %rsp,%rbp
+    3609:	48 83 ec 10          	sub    $0x10,%rsp
+    360d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3611:	89 f0                	mov    %esi,%eax
+    3613:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    3616:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    361a:	48 8b 05 3f 3a 00 00 	mov    0x3a3f(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    3621:	48 8d 0d 4d 0b 00 00 	lea    0xb4d(%rip),%rcx        # 4175 <nel::elem::streaming_min+0x45>
+    3628:	48 89 ce             	mov    %rcx,%rsi
+    362b:	48 89 c7             	mov    %rax,%rdi
+    362e:	b8 00 00 00 00       	mov    $0x0,%eax
+    3633:	e8 58 da ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    3638:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    363c:	c9                   	leave
+    363d:	c3                   	ret
+
+000000000000363e <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    363e:	55                   	push   %rbp
+    363f:	48 89 e5             	mov    %rsp,%rbp
+    3642:	48 83 ec 10          	sub    $0x10,%rsp
+    3646:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    364a:	89 f0                	mov    %esi,%eax
+    364c:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    3650:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    3654:	48 8b 05 05 3a 00 00 	mov    0x3a05(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    365b:	48 8d 0d 13 0b 00 00 	lea    0xb13(%rip),%rcx        # 4175 <nel::elem::streaming_min+0x45>
+    3662:	48 89 ce             	mov    %rcx,%rsi
+    3665:	48 89 c7             	mov    %rax,%rdi
+    3668:	b8 00 00 00 00       	mov    $0x0,%eax
+    366d:	e8 1e da ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    3672:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3676:	c9                   	leave
+    3677:	c3                   	ret
+
+0000000000003678 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    3678:	55                   	push   %rbp
+    3679:	48 89 e5             	mov    %rsp,%rbp
+    367c:	48 83 ec 10          	sub    $0x10,%rsp
+    3680:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3684:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    3687:	48 8b 05 d2 39 00 00 	mov    0x39d2(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    368e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    3691:	48 8d 0d dd 0a 00 00 	lea    0xadd(%rip),%rcx        # 4175 <nel::elem::streaming_min+0x45>
+    3698:	48 89 ce             	mov    %rcx,%rsi
+    369b:	48 89 c7             	mov    %rax,%rdi
+    369e:	b8 00 00 00 00       	mov    $0x0,%eax
+    36a3:	e8 e8 d9 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    36a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    36ac:	c9                   	leave
+    36ad:	c3                   	ret
+
+00000000000036ae <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    36ae:	55                   	push   %rbp
+    36af:	48 89 e5             	mov    %rsp,%rbp
+    36b2:	48 83 ec 10          	sub    $0x10,%rsp
+    36b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    36ba:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    36bd:	48 8b 05 9c 39 00 00 	mov    0x399c(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    36c4:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    36c7:	48 8d 0d a7 0a 00 00 	lea    0xaa7(%rip),%rcx        # 4175 <nel::elem::streaming_min+0x45>
+    36ce:	48 89 ce             	mov    %rcx,%rsi
+    36d1:	48 89 c7             	mov    %rax,%rdi
+    36d4:	b8 00 00 00 00       	mov    $0x0,%eax
+    36d9:	e8 b2 d9 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    36de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    36e2:	c9                   	leave
+    36e3:	c3                   	ret
+
+00000000000036e4 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    36e4:	55                   	push   %rbp
+    36e5:	48 89 e5             	mov    %rsp,%rbp
+    36e8:	48 83 ec 10          	sub    $0x10,%rsp
+    36ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    36f0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    36f4:	48 8b 05 65 39 00 00 	mov    0x3965(%rip),%rax        # 7060 <stderr@GLIBC_2.2.5>
+    36fb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    36ff:	48 8d 0d 72 0a 00 00 	lea    0xa72(%rip),%rcx        # 4178 <nel::elem::streaming_min+0x48>
+    3706:	48 89 ce             	mov    %rcx,%rsi
+    3709:	48 89 c7             	mov    %rax,%rdi
+    370c:	b8 00 00 00 00       	mov    $0x0,%eax
+    3711:	e8 7a d9 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    3716:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    371a:	c9                   	leave
+    371b:	c3                   	ret
+
+Disassembly of section .fini:
+
+000000000000371c <_fini>:
+    371c:	48 83 ec 08          	sub    $0x8,%rsp
+    3720:	48 83 c4 08          	add    $0x8,%rsp
+    3724:	c3                   	ret
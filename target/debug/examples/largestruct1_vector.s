@@ -0,0 +1,5072 @@
+
+target/debug/examples/largestruct1_vector:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 6f 00 00 	mov    0x6fc5(%rip),%rax        # 7fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 6f 00 00    	push   0x6fca(%rip)        # 7ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 6f 00 00    	jmp    *0x6fcc(%rip)        # 7ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 6f 00 00    	jmp    *0x6fca(%rip)        # 8000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 6f 00 00    	jmp    *0x6fc2(%rip)        # 8008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 6f 00 00    	jmp    *0x6fba(%rip)        # 8010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memset@plt>:
+    1060:	ff 25 b2 6f 00 00    	jmp    *0x6fb2(%rip)        # 8018 <memset@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 6f 00 00    	jmp    *0x6faa(%rip)        # 8020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 6f 00 00    	jmp    *0x6fa2(%rip)        # 8028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 6f 00 00    	jmp    *0x6f9a(%rip)        # 8030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcpy@plt>:
+    10a0:	ff 25 92 6f 00 00    	jmp    *0x6f92(%rip)        # 8038 <memcpy@GLIBC_2.14>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <realloc@plt>:
+    10b0:	ff 25 8a 6f 00 00    	jmp    *0x6f8a(%rip)        # 8040 <realloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <memmove@plt>:
+    10c0:	ff 25 82 6f 00 00    	jmp    *0x6f82(%rip)        # 8048 <memmove@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010d0 <__cxa_finalize@plt>:
+    10d0:	ff 25 0a 6f 00 00    	jmp    *0x6f0a(%rip)        # 7fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10d6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010e0 <_start>:
+    10e0:	31 ed                	xor    %ebp,%ebp
+    10e2:	49 89 d1             	mov    %rdx,%r9
+    10e5:	5e                   	pop    %rsi
+    10e6:	48 89 e2             	mov    %rsp,%rdx
+    10e9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    10ed:	50                   	push   %rax
+    10ee:	54                   	push   %rsp
+    10ef:	45 31 c0             	xor    %r8d,%r8d
+    10f2:	31 c9                	xor    %ecx,%ecx
+    10f4:	48 8d 3d 26 07 00 00 	lea    0x726(%rip),%rdi        # 1821 <main>
+    10fb:	ff 15 bf 6e 00 00    	call   *0x6ebf(%rip)        # 7fc0 <__libc_start_main@GLIBC_2.34>
+    1101:	f4                   	hlt
+    1102:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1109:	00 00 00 
+    110c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001110 <deregister_tm_clones>:
+    1110:	    48 8d 3d 49 6f 00 00 	lea    0x6f49(%rip),%rdi        # 8060 <stderr@GLIBC_2.2.5>
+    1117:	    48 8d 05 42 6f 00 00 	lea    0x6f42(%rip),%rax        # 8060 <stderr@GLIBC_2.2.5>
+    111e:	    48 39 f8             	cmp    %rdi,%rax
+    1121:	/-- 74 15                	je     1138 <deregister_tm_clones+0x28>
+    1123:	|   48 8b 05 9e 6e 00 00 	mov    0x6e9e(%rip),%rax        # 7fc8 <_ITM_deregisterTMCloneTable@Base>
+    112a:	|   48 85 c0             	test   %rax,%rax
+    112d:	+-- 74 09                	je     1138 <deregister_tm_clones+0x28>
+    112f:	|   ff e0                	jmp    *%rax
+    1131:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1138:	\-> c3                   	ret
+    1139:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001140 <register_tm_clones>:
+    1140:	    48 8d 3d 19 6f 00 00 	lea    0x6f19(%rip),%rdi        # 8060 <stderr@GLIBC_2.2.5>
+    1147:	    48 8d 35 12 6f 00 00 	lea    0x6f12(%rip),%rsi        # 8060 <stderr@GLIBC_2.2.5>
+    114e:	    48 29 fe             	sub    %rdi,%rsi
+    1151:	    48 89 f0             	mov    %rsi,%rax
+    1154:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1158:	    48 c1 f8 03          	sar    $0x3,%rax
+    115c:	    48 01 c6             	add    %rax,%rsi
+    115f:	    48 d1 fe             	sar    %rsi
+    1162:	/-- 74 14                	je     1178 <register_tm_clones+0x38>
+    1164:	|   48 8b 05 6d 6e 00 00 	mov    0x6e6d(%rip),%rax        # 7fd8 <_ITM_registerTMCloneTable@Base>
+    116b:	|   48 85 c0             	test   %rax,%rax
+    116e:	+-- 74 08                	je     1178 <register_tm_clones+0x38>
+    1170:	|   ff e0                	jmp    *%rax
+    1172:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1178:	\-> c3                   	ret
+    1179:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001180 <__do_global_dtors_aux>:
+    1180:	       f3 0f 1e fa          	endbr64
+    1184:	       80 3d dd 6e 00 00 00 	cmpb   $0x0,0x6edd(%rip)        # 8068 <completed.0>
+    118b:	/----- 75 2b                	jne    11b8 <__do_global_dtors_aux+0x38>
+    118d:	|      55                   	push   %rbp
+    118e:	|      48 83 3d 4a 6e 00 00 	cmpq   $0x0,0x6e4a(%rip)        # 7fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1195:	|      00 
+    1196:	|      48 89 e5             	mov    %rsp,%rbp
+    1199:	|  /-- 74 0c                	je     11a7 <__do_global_dtors_aux+0x27>
+    119b:	|  |   48 8b 3d b6 6e 00 00 	mov    0x6eb6(%rip),%rdi        # 8058 <__dso_handle>
+    11a2:	|  |   e8 29 ff ff ff       	call   10d0 <__cxa_finalize@plt>
+    11a7:	|  \-> e8 64 ff ff ff       	call   1110 <deregister_tm_clones>
+    11ac:	|      c6 05 b5 6e 00 00 01 	movb   $0x1,0x6eb5(%rip)        # 8068 <completed.0>
+    11b3:	|      5d                   	pop    %rbp
+    11b4:	|      c3                   	ret
+    11b5:	|      0f 1f 00             	nopl   (%rax)
+    11b8:	\----> c3                   	ret
+    11b9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011c0 <frame_dummy>:
+    11c0:	f3 0f 1e fa          	endbr64
+    11c4:	e9 77 ff ff ff       	jmp    1140 <register_tm_clones>
+    11c9:	90                   	nop
+
+00000000000011ca <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    11ca:	55                   	push   %rbp
+    11cb:	48 89 e5             	mov    %rsp,%rbp
+    11ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11d2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    11d5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11da:	5d                   	pop    %rbp
+    11db:	c3                   	ret
+
+00000000000011dc <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    11dc:	55                   	push   %rbp
+    11dd:	48 89 e5             	mov    %rsp,%rbp
+    11e0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11e4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11e7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return -1;
+    11eb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    11f0:	5d                   	pop    %rbp
+    11f1:	c3                   	ret
+
+00000000000011f2 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    11f2:	55                   	push   %rbp
+    11f3:	48 89 e5             	mov    %rsp,%rbp
+    11f6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11fa:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11fd:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    return -1;
+    1200:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1205:	5d                   	pop    %rbp
+    1206:	c3                   	ret
+
+0000000000001207 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    1207:	55                   	push   %rbp
+    1208:	48 89 e5             	mov    %rsp,%rbp
+    120b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    120f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1212:	89 55 f0             	mov    %edx,-0x10(%rbp)
+    1215:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    return -1;
+    1218:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    121d:	5d                   	pop    %rbp
+    121e:	c3                   	ret
+
+000000000000121f <_read_r>:
+int _read_r(struct _reent *, int) {
+    121f:	55                   	push   %rbp
+    1220:	48 89 e5             	mov    %rsp,%rbp
+    1223:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1227:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    122a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    122f:	5d                   	pop    %rbp
+    1230:	c3                   	ret
+
+0000000000001231 <_write_r>:
+int _write_r(struct _reent *, int, char *, int) {
+    1231:	55                   	push   %rbp
+    1232:	48 89 e5             	mov    %rsp,%rbp
+    1235:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1239:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    123c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1240:	89 4d f0             	mov    %ecx,-0x10(%rbp)
+    return -1;
+    1243:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1248:	5d                   	pop    %rbp
+    1249:	c3                   	ret
+
+000000000000124a <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    124a:	55                   	push   %rbp
+    124b:	48 89 e5             	mov    %rsp,%rbp
+    124e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return -1;
+    1252:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1257:	5d                   	pop    %rbp
+    1258:	c3                   	ret
+
+0000000000001259 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1259:	55                   	push   %rbp
+    125a:	48 89 e5             	mov    %rsp,%rbp
+    125d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1261:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    return -1;
+    1264:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1269:	5d                   	pop    %rbp
+    126a:	c3                   	ret
+
+000000000000126b <ex1()>:
+#include "libnosys_stubs.cx"
+
+typedef nel::heaped::Vector<U8Buf<256>> Vec1;
+
+void ex1()
+{
+    126b:	55                   	push   %rbp
+    126c:	48 89 e5             	mov    %rsp,%rbp
+    126f:	48 83 ec 10          	sub    $0x10,%rsp
+    Vec1 vec1 = Vec1::with_capacity(5);
+    1273:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1277:	be 05 00 00 00       	mov    $0x5,%esi
+    127c:	48 89 c7             	mov    %rax,%rdi
+    127f:	e8 20 0b 00 00       	call   1da4 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+
+    nel::log << vec1 << '\n';
+    1284:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1288:	48 89 c6             	mov    %rax,%rsi
+    128b:	48 8d 05 d7 6d 00 00 	lea    0x6dd7(%rip),%rax        # 8069 <nel::log>
+    1292:	48 89 c7             	mov    %rax,%rdi
+    1295:	e8 90 0b 00 00       	call   1e2a <nel::heaped::operator<<(nel::Log&, nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > const&)>
+    129a:	be 0a 00 00 00       	mov    $0xa,%esi
+    129f:	48 89 c7             	mov    %rax,%rdi
+    12a2:	e8 e2 2c 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+}
+    12a7:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    12ab:	48 89 c7             	mov    %rax,%rdi
+    12ae:	e8 59 0b 00 00       	call   1e0c <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    12b3:	c9                   	leave
+    12b4:	c3                   	ret
+
+00000000000012b5 <ex2()>:
+
+void ex2()
+{
+    12b5:	55                   	push   %rbp
+    12b6:	48 89 e5             	mov    %rsp,%rbp
+    12b9:	48 81 ec 40 02 00 00 	sub    $0x240,%rsp
+    Vec1 vec1 = Vec1::with_capacity(5);
+    12c0:	48 8d 85 c8 fe ff ff 	lea    -0x138(%rbp),%rax
+    12c7:	be 05 00 00 00       	mov    $0x5,%esi
+    12cc:	48 89 c7             	mov    %rax,%rdi
+    12cf:	e8 d0 0a 00 00       	call   1da4 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+
+    U8Buf<256> v = U8Buf<256>((uint8_t)0x66);
+    12d4:	48 8d 85 c0 fd ff ff 	lea    -0x240(%rbp),%rax
+    12db:	be 66 00 00 00       	mov    $0x66,%esi
+    12e0:	48 89 c7             	mov    %rax,%rdi
+    12e3:	e8 22 09 00 00       	call   1c0a <U8Buf<256ul>::U8Buf(unsigned char)>
+    vec1.push(nel::move(v)).is_ok();
+    12e8:	48 8d 85 c0 fd ff ff 	lea    -0x240(%rbp),%rax
+    12ef:	48 89 c7             	mov    %rax,%rdi
+    12f2:	e8 fc 0b 00 00       	call   1ef3 <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    12f7:	48 89 c2             	mov    %rax,%rdx
+    12fa:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    1301:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+    1308:	48 89 ce             	mov    %rcx,%rsi
+    130b:	48 89 c7             	mov    %rax,%rdi
+    130e:	e8 ef 0b 00 00       	call   1f02 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(U8Buf<256ul>&&)>
+    1313:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1317:	b9 18 00 00 00       	mov    $0x18,%ecx
+    131c:	48 8d 15 05 3d 00 00 	lea    0x3d05(%rip),%rdx        # 5028 <nel::sort::ninther_n+0x8>
+    1323:	48 8d 35 1e 3d 00 00 	lea    0x3d1e(%rip),%rsi        # 5048 <nel::sort::ninther_n+0x28>
+    132a:	48 89 c7             	mov    %rax,%rdi
+    132d:	e8 0e 07 00 00       	call   1a40 <nel::Context::Context(char const*, char const*, int)>
+    1332:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1336:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    133d:	48 89 d6             	mov    %rdx,%rsi
+    1340:	48 89 c7             	mov    %rax,%rdi
+    1343:	e8 f6 0c 00 00       	call   203e <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    1348:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    134f:	48 89 c7             	mov    %rax,%rdi
+    1352:	e8 51 0c 00 00       	call   1fa8 <nel::Result<void, U8Buf<256ul> >::~Result()>
+
+    nel::log << vec1 << '\n';
+    1357:	48 8d 85 c8 fe ff ff 	lea    -0x138(%rbp),%rax
+    135e:	48 89 c6             	mov    %rax,%rsi
+    1361:	48 8d 05 01 6d 00 00 	lea    0x6d01(%rip),%rax        # 8069 <nel::log>
+    1368:	48 89 c7             	mov    %rax,%rdi
+    136b:	e8 ba 0a 00 00       	call   1e2a <nel::heaped::operator<<(nel::Log&, nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > const&)>
+    1370:	be 0a 00 00 00       	mov    $0xa,%esi
+    1375:	48 89 c7             	mov    %rax,%rdi
+    1378:	e8 0c 2c 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+}
+    137d:	48 8d 85 c0 fd ff ff 	lea    -0x240(%rbp),%rax
+    1384:	48 89 c7             	mov    %rax,%rdi
+    1387:	e8 42 0b 00 00       	call   1ece <U8Buf<256ul>::~U8Buf()>
+    138c:	48 8d 85 c8 fe ff ff 	lea    -0x138(%rbp),%rax
+    1393:	48 89 c7             	mov    %rax,%rdi
+    1396:	e8 71 0a 00 00       	call   1e0c <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    139b:	c9                   	leave
+    139c:	c3                   	ret
+
+000000000000139d <ex3()>:
+
+void ex3()
+{
+    139d:	55                   	push   %rbp
+    139e:	48 89 e5             	mov    %rsp,%rbp
+    13a1:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+    Vec1 vec1 = Vec1::with_capacity(5);
+    13a8:	48 8d 85 c8 fe ff ff 	lea    -0x138(%rbp),%rax
+    13af:	be 05 00 00 00       	mov    $0x5,%esi
+    13b4:	48 89 c7             	mov    %rax,%rdi
+    13b7:	e8 e8 09 00 00       	call   1da4 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+
+    vec1.push((uint8_t)0x67).is_ok();
+    13bc:	c6 45 df 67          	movb   $0x67,-0x21(%rbp)
+    13c0:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    13c7:	48 8d 55 df          	lea    -0x21(%rbp),%rdx
+    13cb:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+    13d2:	48 89 ce             	mov    %rcx,%rsi
+    13d5:	48 89 c7             	mov    %rax,%rdi
+    13d8:	e8 8b 0c 00 00       	call   2068 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    13dd:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    13e1:	b9 21 00 00 00       	mov    $0x21,%ecx
+    13e6:	48 8d 15 3b 3c 00 00 	lea    0x3c3b(%rip),%rdx        # 5028 <nel::sort::ninther_n+0x8>
+    13ed:	48 8d 35 58 3c 00 00 	lea    0x3c58(%rip),%rsi        # 504c <nel::sort::ninther_n+0x2c>
+    13f4:	48 89 c7             	mov    %rax,%rdi
+    13f7:	e8 44 06 00 00       	call   1a40 <nel::Context::Context(char const*, char const*, int)>
+    13fc:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1400:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    1407:	48 89 d6             	mov    %rdx,%rsi
+    140a:	48 89 c7             	mov    %rax,%rdi
+    140d:	e8 2c 0c 00 00       	call   203e <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    1412:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    1419:	48 89 c7             	mov    %rax,%rdi
+    141c:	e8 87 0b 00 00       	call   1fa8 <nel::Result<void, U8Buf<256ul> >::~Result()>
+
+    nel::log << vec1 << '\n';
+    1421:	48 8d 85 c8 fe ff ff 	lea    -0x138(%rbp),%rax
+    1428:	48 89 c6             	mov    %rax,%rsi
+    142b:	48 8d 05 37 6c 00 00 	lea    0x6c37(%rip),%rax        # 8069 <nel::log>
+    1432:	48 89 c7             	mov    %rax,%rdi
+    1435:	e8 f0 09 00 00       	call   1e2a <nel::heaped::operator<<(nel::Log&, nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > const&)>
+    143a:	be 0a 00 00 00       	mov    $0xa,%esi
+    143f:	48 89 c7             	mov    %rax,%rdi
+    1442:	e8 42 2b 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+}
+    1447:	48 8d 85 c8 fe ff ff 	lea    -0x138(%rbp),%rax
+    144e:	48 89 c7             	mov    %rax,%rdi
+    1451:	e8 b6 09 00 00       	call   1e0c <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    1456:	c9                   	leave
+    1457:	c3                   	ret
+
+0000000000001458 <ex42()::{lambda(U8Buf<256ul>&)#1}::operator()(U8Buf<256ul>&) const>:
+    vec1.push((uint8_t)0x67).is_ok();
+    vec1.push((uint8_t)0x68).is_ok();
+    vec1.push((uint8_t)0x69).is_ok();
+
+    auto it = vec1.iter();
+    it.for_each([&](U8Buf<256> &e) -> void { nel::log << e << '\n'; });
+    1458:	55                   	push   %rbp
+    1459:	48 89 e5             	mov    %rsp,%rbp
+    145c:	48 83 ec 10          	sub    $0x10,%rsp
+    1460:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1464:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1468:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    146c:	48 89 c6             	mov    %rax,%rsi
+    146f:	48 8d 05 f3 6b 00 00 	lea    0x6bf3(%rip),%rax        # 8069 <nel::log>
+    1476:	48 89 c7             	mov    %rax,%rdi
+    1479:	e8 40 0d 00 00       	call   21be <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    147e:	be 0a 00 00 00       	mov    $0xa,%esi
+    1483:	48 89 c7             	mov    %rax,%rdi
+    1486:	e8 fe 2a 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+    148b:	90                   	nop
+    148c:	c9                   	leave
+    148d:	c3                   	ret
+
+000000000000148e <ex42()>:
+{
+    148e:	55                   	push   %rbp
+    148f:	48 89 e5             	mov    %rsp,%rbp
+    1492:	48 81 ec b0 03 00 00 	sub    $0x3b0,%rsp
+    Vec1 vec1 = Vec1::with_capacity(5);
+    1499:	48 8d 85 68 fc ff ff 	lea    -0x398(%rbp),%rax
+    14a0:	be 05 00 00 00       	mov    $0x5,%esi
+    14a5:	48 89 c7             	mov    %rax,%rdi
+    14a8:	e8 f7 08 00 00       	call   1da4 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+    vec1.push((uint8_t)0x67).is_ok();
+    14ad:	c6 85 7f fd ff ff 67 	movb   $0x67,-0x281(%rbp)
+    14b4:	48 8d 85 70 fc ff ff 	lea    -0x390(%rbp),%rax
+    14bb:	48 8d 95 7f fd ff ff 	lea    -0x281(%rbp),%rdx
+    14c2:	48 8d 8d 68 fc ff ff 	lea    -0x398(%rbp),%rcx
+    14c9:	48 89 ce             	mov    %rcx,%rsi
+    14cc:	48 89 c7             	mov    %rax,%rdi
+    14cf:	e8 94 0b 00 00       	call   2068 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    14d4:	48 8d 85 80 fd ff ff 	lea    -0x280(%rbp),%rax
+    14db:	b9 46 00 00 00       	mov    $0x46,%ecx
+    14e0:	48 8d 15 41 3b 00 00 	lea    0x3b41(%rip),%rdx        # 5028 <nel::sort::ninther_n+0x8>
+    14e7:	48 8d 35 62 3b 00 00 	lea    0x3b62(%rip),%rsi        # 5050 <nel::sort::ninther_n+0x30>
+    14ee:	48 89 c7             	mov    %rax,%rdi
+    14f1:	e8 4a 05 00 00       	call   1a40 <nel::Context::Context(char const*, char const*, int)>
+    14f6:	48 8d 95 80 fd ff ff 	lea    -0x280(%rbp),%rdx
+    14fd:	48 8d 85 70 fc ff ff 	lea    -0x390(%rbp),%rax
+    1504:	48 89 d6             	mov    %rdx,%rsi
+    1507:	48 89 c7             	mov    %rax,%rdi
+    150a:	e8 2f 0b 00 00       	call   203e <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    150f:	48 8d 85 70 fc ff ff 	lea    -0x390(%rbp),%rax
+    1516:	48 89 c7             	mov    %rax,%rdi
+    1519:	e8 8a 0a 00 00       	call   1fa8 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    vec1.push((uint8_t)0x68).is_ok();
+    151e:	c6 85 af fe ff ff 68 	movb   $0x68,-0x151(%rbp)
+    1525:	48 8d 85 a0 fd ff ff 	lea    -0x260(%rbp),%rax
+    152c:	48 8d 95 af fe ff ff 	lea    -0x151(%rbp),%rdx
+    1533:	48 8d 8d 68 fc ff ff 	lea    -0x398(%rbp),%rcx
+    153a:	48 89 ce             	mov    %rcx,%rsi
+    153d:	48 89 c7             	mov    %rax,%rdi
+    1540:	e8 23 0b 00 00       	call   2068 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    1545:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    154c:	b9 47 00 00 00       	mov    $0x47,%ecx
+    1551:	48 8d 15 d0 3a 00 00 	lea    0x3ad0(%rip),%rdx        # 5028 <nel::sort::ninther_n+0x8>
+    1558:	48 8d 35 f1 3a 00 00 	lea    0x3af1(%rip),%rsi        # 5050 <nel::sort::ninther_n+0x30>
+    155f:	48 89 c7             	mov    %rax,%rdi
+    1562:	e8 d9 04 00 00       	call   1a40 <nel::Context::Context(char const*, char const*, int)>
+    1567:	48 8d 95 b0 fe ff ff 	lea    -0x150(%rbp),%rdx
+    156e:	48 8d 85 a0 fd ff ff 	lea    -0x260(%rbp),%rax
+    1575:	48 89 d6             	mov    %rdx,%rsi
+    1578:	48 89 c7             	mov    %rax,%rdi
+    157b:	e8 be 0a 00 00       	call   203e <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    1580:	48 8d 85 a0 fd ff ff 	lea    -0x260(%rbp),%rax
+    1587:	48 89 c7             	mov    %rax,%rdi
+    158a:	e8 19 0a 00 00       	call   1fa8 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    vec1.push((uint8_t)0x69).is_ok();
+    158f:	c6 45 df 69          	movb   $0x69,-0x21(%rbp)
+    1593:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    159a:	48 8d 55 df          	lea    -0x21(%rbp),%rdx
+    159e:	48 8d 8d 68 fc ff ff 	lea    -0x398(%rbp),%rcx
+    15a5:	48 89 ce             	mov    %rcx,%rsi
+    15a8:	48 89 c7             	mov    %rax,%rdi
+    15ab:	e8 b8 0a 00 00       	call   2068 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    15b0:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    15b4:	b9 48 00 00 00       	mov    $0x48,%ecx
+    15b9:	48 8d 15 68 3a 00 00 	lea    0x3a68(%rip),%rdx        # 5028 <nel::sort::ninther_n+0x8>
+    15c0:	48 8d 35 89 3a 00 00 	lea    0x3a89(%rip),%rsi        # 5050 <nel::sort::ninther_n+0x30>
+    15c7:	48 89 c7             	mov    %rax,%rdi
+    15ca:	e8 71 04 00 00       	call   1a40 <nel::Context::Context(char const*, char const*, int)>
+    15cf:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    15d3:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    15da:	48 89 d6             	mov    %rdx,%rsi
+    15dd:	48 89 c7             	mov    %rax,%rdi
+    15e0:	e8 59 0a 00 00       	call   203e <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    15e5:	48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    15ec:	48 89 c7             	mov    %rax,%rdi
+    15ef:	e8 b4 09 00 00       	call   1fa8 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    auto it = vec1.iter();
+    15f4:	48 8d 85 50 fc ff ff 	lea    -0x3b0(%rbp),%rax
+    15fb:	48 8d 95 68 fc ff ff 	lea    -0x398(%rbp),%rdx
+    1602:	48 89 d6             	mov    %rdx,%rsi
+    1605:	48 89 c7             	mov    %rax,%rdi
+    1608:	e8 29 06 00 00       	call   1c36 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::iter()>
+    it.for_each([&](U8Buf<256> &e) -> void { nel::log << e << '\n'; });
+    160d:	48 8d 55 ff          	lea    -0x1(%rbp),%rdx
+    1611:	48 8d 85 50 fc ff ff 	lea    -0x3b0(%rbp),%rax
+    1618:	48 89 d6             	mov    %rdx,%rsi
+    161b:	48 89 c7             	mov    %rax,%rdi
+    161e:	e8 9f 03 00 00       	call   19c2 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<ex42()::{lambda(U8Buf<256ul>&)#1}>(ex42()::{lambda(U8Buf<256ul>&)#1}&&)>
+}
+    1623:	48 8d 85 68 fc ff ff 	lea    -0x398(%rbp),%rax
+    162a:	48 89 c7             	mov    %rax,%rdi
+    162d:	e8 da 07 00 00       	call   1e0c <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    1632:	c9                   	leave
+    1633:	c3                   	ret
+
+0000000000001634 <ex43()>:
+
+void ex43()
+{
+    1634:	       55                   	push   %rbp
+    1635:	       48 89 e5             	mov    %rsp,%rbp
+    1638:	       48 81 ec b0 03 00 00 	sub    $0x3b0,%rsp
+    Vec1 vec1 = Vec1::with_capacity(5);
+    163f:	       48 8d 85 68 fc ff ff 	lea    -0x398(%rbp),%rax
+    1646:	       be 05 00 00 00       	mov    $0x5,%esi
+    164b:	       48 89 c7             	mov    %rax,%rdi
+    164e:	       e8 51 07 00 00       	call   1da4 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+
+    vec1.push((uint8_t)0x67).is_ok();
+    1653:	       c6 85 7f fd ff ff 67 	movb   $0x67,-0x281(%rbp)
+    165a:	       48 8d 85 70 fc ff ff 	lea    -0x390(%rbp),%rax
+    1661:	       48 8d 95 7f fd ff ff 	lea    -0x281(%rbp),%rdx
+    1668:	       48 8d 8d 68 fc ff ff 	lea    -0x398(%rbp),%rcx
+    166f:	       48 89 ce             	mov    %rcx,%rsi
+    1672:	       48 89 c7             	mov    %rax,%rdi
+    1675:	       e8 ee 09 00 00       	call   2068 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    167a:	       48 8d 85 80 fd ff ff 	lea    -0x280(%rbp),%rax
+    1681:	       b9 52 00 00 00       	mov    $0x52,%ecx
+    1686:	       48 8d 15 9b 39 00 00 	lea    0x399b(%rip),%rdx        # 5028 <nel::sort::ninther_n+0x8>
+    168d:	       48 8d 35 c1 39 00 00 	lea    0x39c1(%rip),%rsi        # 5055 <nel::sort::ninther_n+0x35>
+    1694:	       48 89 c7             	mov    %rax,%rdi
+    1697:	       e8 a4 03 00 00       	call   1a40 <nel::Context::Context(char const*, char const*, int)>
+    169c:	       48 8d 95 80 fd ff ff 	lea    -0x280(%rbp),%rdx
+    16a3:	       48 8d 85 70 fc ff ff 	lea    -0x390(%rbp),%rax
+    16aa:	       48 89 d6             	mov    %rdx,%rsi
+    16ad:	       48 89 c7             	mov    %rax,%rdi
+    16b0:	       e8 89 09 00 00       	call   203e <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    16b5:	       48 8d 85 70 fc ff ff 	lea    -0x390(%rbp),%rax
+    16bc:	       48 89 c7             	mov    %rax,%rdi
+    16bf:	       e8 e4 08 00 00       	call   1fa8 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    vec1.push((uint8_t)0x68).is_ok();
+    16c4:	       c6 85 af fe ff ff 68 	movb   $0x68,-0x151(%rbp)
+    16cb:	       48 8d 85 a0 fd ff ff 	lea    -0x260(%rbp),%rax
+    16d2:	       48 8d 95 af fe ff ff 	lea    -0x151(%rbp),%rdx
+    16d9:	       48 8d 8d 68 fc ff ff 	lea    -0x398(%rbp),%rcx
+    16e0:	       48 89 ce             	mov    %rcx,%rsi
+    16e3:	       48 89 c7             	mov    %rax,%rdi
+    16e6:	       e8 7d 09 00 00       	call   2068 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    16eb:	       48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+    16f2:	       b9 53 00 00 00       	mov    $0x53,%ecx
+    16f7:	       48 8d 15 2a 39 00 00 	lea    0x392a(%rip),%rdx        # 5028 <nel::sort::ninther_n+0x8>
+    16fe:	       48 8d 35 50 39 00 00 	lea    0x3950(%rip),%rsi        # 5055 <nel::sort::ninther_n+0x35>
+    1705:	       48 89 c7             	mov    %rax,%rdi
+    1708:	       e8 33 03 00 00       	call   1a40 <nel::Context::Context(char const*, char const*, int)>
+    170d:	       48 8d 95 b0 fe ff ff 	lea    -0x150(%rbp),%rdx
+    1714:	       48 8d 85 a0 fd ff ff 	lea    -0x260(%rbp),%rax
+    171b:	       48 89 d6             	mov    %rdx,%rsi
+    171e:	       48 89 c7             	mov    %rax,%rdi
+    1721:	       e8 18 09 00 00       	call   203e <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    1726:	       48 8d 85 a0 fd ff ff 	lea    -0x260(%rbp),%rax
+    172d:	       48 89 c7             	mov    %rax,%rdi
+    1730:	       e8 73 08 00 00       	call   1fa8 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    vec1.push((uint8_t)0x69).is_ok();
+    1735:	       c6 45 df 69          	movb   $0x69,-0x21(%rbp)
+    1739:	       48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    1740:	       48 8d 55 df          	lea    -0x21(%rbp),%rdx
+    1744:	       48 8d 8d 68 fc ff ff 	lea    -0x398(%rbp),%rcx
+    174b:	       48 89 ce             	mov    %rcx,%rsi
+    174e:	       48 89 c7             	mov    %rax,%rdi
+    1751:	       e8 12 09 00 00       	call   2068 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    1756:	       48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    175a:	       b9 54 00 00 00       	mov    $0x54,%ecx
+    175f:	       48 8d 15 c2 38 00 00 	lea    0x38c2(%rip),%rdx        # 5028 <nel::sort::ninther_n+0x8>
+    1766:	       48 8d 35 e8 38 00 00 	lea    0x38e8(%rip),%rsi        # 5055 <nel::sort::ninther_n+0x35>
+    176d:	       48 89 c7             	mov    %rax,%rdi
+    1770:	       e8 cb 02 00 00       	call   1a40 <nel::Context::Context(char const*, char const*, int)>
+    1775:	       48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    1779:	       48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    1780:	       48 89 d6             	mov    %rdx,%rsi
+    1783:	       48 89 c7             	mov    %rax,%rdi
+    1786:	       e8 b3 08 00 00       	call   203e <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>
+    178b:	       48 8d 85 d0 fe ff ff 	lea    -0x130(%rbp),%rax
+    1792:	       48 89 c7             	mov    %rax,%rdi
+    1795:	       e8 0e 08 00 00       	call   1fa8 <nel::Result<void, U8Buf<256ul> >::~Result()>
+
+    auto it = vec1.iter();
+    179a:	       48 8d 85 50 fc ff ff 	lea    -0x3b0(%rbp),%rax
+    17a1:	       48 8d 95 68 fc ff ff 	lea    -0x398(%rbp),%rdx
+    17a8:	       48 89 d6             	mov    %rdx,%rsi
+    17ab:	       48 89 c7             	mov    %rax,%rdi
+    17ae:	       e8 83 04 00 00       	call   1c36 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::iter()>
+    for (; !it.is_done(); it.inc()) {
+    17b3:	   /-- eb 45                	jmp    17fa <ex43()+0x1c6>
+        auto &e = it.deref();
+    17b5:	/--|-> 48 8d 85 50 fc ff ff 	lea    -0x3b0(%rbp),%rax
+    17bc:	|  |   48 89 c7             	mov    %rax,%rdi
+    17bf:	|  |   e8 0e 0b 00 00       	call   22d2 <nel::SliceIterator<U8Buf<256ul> >::deref()>
+    17c4:	|  |   48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        nel::log << e << '\n';
+    17c8:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17cc:	|  |   48 89 c6             	mov    %rax,%rsi
+    17cf:	|  |   48 8d 05 93 68 00 00 	lea    0x6893(%rip),%rax        # 8069 <nel::log>
+    17d6:	|  |   48 89 c7             	mov    %rax,%rdi
+    17d9:	|  |   e8 e0 09 00 00       	call   21be <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    17de:	|  |   be 0a 00 00 00       	mov    $0xa,%esi
+    17e3:	|  |   48 89 c7             	mov    %rax,%rdi
+    17e6:	|  |   e8 9e 27 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+    for (; !it.is_done(); it.inc()) {
+    17eb:	|  |   48 8d 85 50 fc ff ff 	lea    -0x3b0(%rbp),%rax
+    17f2:	|  |   48 89 c7             	mov    %rax,%rdi
+    17f5:	|  |   e8 b8 0a 00 00       	call   22b2 <nel::SliceIterator<U8Buf<256ul> >::inc()>
+    17fa:	|  \-> 48 8d 85 50 fc ff ff 	lea    -0x3b0(%rbp),%rax
+    1801:	|      48 89 c7             	mov    %rax,%rdi
+    1804:	|      e8 af 04 00 00       	call   1cb8 <nel::SliceIterator<U8Buf<256ul> >::is_done() const>
+    1809:	|      83 f0 01             	xor    $0x1,%eax
+    180c:	|      84 c0                	test   %al,%al
+    180e:	\----- 75 a5                	jne    17b5 <ex43()+0x181>
+    }
+}
+    1810:	       48 8d 85 68 fc ff ff 	lea    -0x398(%rbp),%rax
+    1817:	       48 89 c7             	mov    %rax,%rdi
+    181a:	       e8 ed 05 00 00       	call   1e0c <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    181f:	       c9                   	leave
+    1820:	       c3                   	ret
+
+0000000000001821 <main>:
+    it.for_each2([&](U8Buf<256> &e) -> void { nel::log << e << '\n'; });
+}
+#endif
+
+int main()
+{
+    1821:	55                   	push   %rbp
+    1822:	48 89 e5             	mov    %rsp,%rbp
+    nel::log << "ex1:b" << '\n';
+    1825:	48 8d 05 2e 38 00 00 	lea    0x382e(%rip),%rax        # 505a <nel::sort::ninther_n+0x3a>
+    182c:	48 89 c6             	mov    %rax,%rsi
+    182f:	48 8d 05 33 68 00 00 	lea    0x6833(%rip),%rax        # 8069 <nel::log>
+    1836:	48 89 c7             	mov    %rax,%rdi
+    1839:	e8 77 27 00 00       	call   3fb5 <nel::operator<<(nel::Log&, char const*)>
+    183e:	be 0a 00 00 00       	mov    $0xa,%esi
+    1843:	48 89 c7             	mov    %rax,%rdi
+    1846:	e8 3e 27 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    184b:	e8 1b fa ff ff       	call   126b <ex1()>
+    nel::log << "ex1:e" << '\n';
+    1850:	48 8d 05 09 38 00 00 	lea    0x3809(%rip),%rax        # 5060 <nel::sort::ninther_n+0x40>
+    1857:	48 89 c6             	mov    %rax,%rsi
+    185a:	48 8d 05 08 68 00 00 	lea    0x6808(%rip),%rax        # 8069 <nel::log>
+    1861:	48 89 c7             	mov    %rax,%rdi
+    1864:	e8 4c 27 00 00       	call   3fb5 <nel::operator<<(nel::Log&, char const*)>
+    1869:	be 0a 00 00 00       	mov    $0xa,%esi
+    186e:	48 89 c7             	mov    %rax,%rdi
+    1871:	e8 13 27 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex2:b" << '\n';
+    1876:	48 8d 05 e9 37 00 00 	lea    0x37e9(%rip),%rax        # 5066 <nel::sort::ninther_n+0x46>
+    187d:	48 89 c6             	mov    %rax,%rsi
+    1880:	48 8d 05 e2 67 00 00 	lea    0x67e2(%rip),%rax        # 8069 <nel::log>
+    1887:	48 89 c7             	mov    %rax,%rdi
+    188a:	e8 26 27 00 00       	call   3fb5 <nel::operator<<(nel::Log&, char const*)>
+    188f:	be 0a 00 00 00       	mov    $0xa,%esi
+    1894:	48 89 c7             	mov    %rax,%rdi
+    1897:	e8 ed 26 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+    ex2();
+    189c:	e8 14 fa ff ff       	call   12b5 <ex2()>
+    nel::log << "ex2:e" << '\n';
+    18a1:	48 8d 05 c4 37 00 00 	lea    0x37c4(%rip),%rax        # 506c <nel::sort::ninther_n+0x4c>
+    18a8:	48 89 c6             	mov    %rax,%rsi
+    18ab:	48 8d 05 b7 67 00 00 	lea    0x67b7(%rip),%rax        # 8069 <nel::log>
+    18b2:	48 89 c7             	mov    %rax,%rdi
+    18b5:	e8 fb 26 00 00       	call   3fb5 <nel::operator<<(nel::Log&, char const*)>
+    18ba:	be 0a 00 00 00       	mov    $0xa,%esi
+    18bf:	48 89 c7             	mov    %rax,%rdi
+    18c2:	e8 c2 26 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex3:b" << '\n';
+    18c7:	48 8d 05 a4 37 00 00 	lea    0x37a4(%rip),%rax        # 5072 <nel::sort::ninther_n+0x52>
+    18ce:	48 89 c6             	mov    %rax,%rsi
+    18d1:	48 8d 05 91 67 00 00 	lea    0x6791(%rip),%rax        # 8069 <nel::log>
+    18d8:	48 89 c7             	mov    %rax,%rdi
+    18db:	e8 d5 26 00 00       	call   3fb5 <nel::operator<<(nel::Log&, char const*)>
+    18e0:	be 0a 00 00 00       	mov    $0xa,%esi
+    18e5:	48 89 c7             	mov    %rax,%rdi
+    18e8:	e8 9c 26 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+    ex3();
+    18ed:	e8 ab fa ff ff       	call   139d <ex3()>
+    nel::log << "ex3:e" << '\n';
+    18f2:	48 8d 05 7f 37 00 00 	lea    0x377f(%rip),%rax        # 5078 <nel::sort::ninther_n+0x58>
+    18f9:	48 89 c6             	mov    %rax,%rsi
+    18fc:	48 8d 05 66 67 00 00 	lea    0x6766(%rip),%rax        # 8069 <nel::log>
+    1903:	48 89 c7             	mov    %rax,%rdi
+    1906:	e8 aa 26 00 00       	call   3fb5 <nel::operator<<(nel::Log&, char const*)>
+    190b:	be 0a 00 00 00       	mov    $0xa,%esi
+    1910:	48 89 c7             	mov    %rax,%rdi
+    1913:	e8 71 26 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+#if defined(RUST_LIKE)
+    nel::log << "ex41:b" << '\n';
+    ex41();
+    nel::log << "ex41:e" << '\n';
+#endif
+    nel::log << "ex42:b" << '\n';
+    1918:	48 8d 05 5f 37 00 00 	lea    0x375f(%rip),%rax        # 507e <nel::sort::ninther_n+0x5e>
+    191f:	48 89 c6             	mov    %rax,%rsi
+    1922:	48 8d 05 40 67 00 00 	lea    0x6740(%rip),%rax        # 8069 <nel::log>
+    1929:	48 89 c7             	mov    %rax,%rdi
+    192c:	e8 84 26 00 00       	call   3fb5 <nel::operator<<(nel::Log&, char const*)>
+    1931:	be 0a 00 00 00       	mov    $0xa,%esi
+    1936:	48 89 c7             	mov    %rax,%rdi
+    1939:	e8 4b 26 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+    ex42();
+    193e:	e8 4b fb ff ff       	call   148e <ex42()>
+    nel::log << "ex42:e" << '\n';
+    1943:	48 8d 05 3b 37 00 00 	lea    0x373b(%rip),%rax        # 5085 <nel::sort::ninther_n+0x65>
+    194a:	48 89 c6             	mov    %rax,%rsi
+    194d:	48 8d 05 15 67 00 00 	lea    0x6715(%rip),%rax        # 8069 <nel::log>
+    1954:	48 89 c7             	mov    %rax,%rdi
+    1957:	e8 59 26 00 00       	call   3fb5 <nel::operator<<(nel::Log&, char const*)>
+    195c:	be 0a 00 00 00       	mov    $0xa,%esi
+    1961:	48 89 c7             	mov    %rax,%rdi
+    1964:	e8 20 26 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex43:b" << '\n';
+    1969:	48 8d 05 1c 37 00 00 	lea    0x371c(%rip),%rax        # 508c <nel::sort::ninther_n+0x6c>
+    1970:	48 89 c6             	mov    %rax,%rsi
+    1973:	48 8d 05 ef 66 00 00 	lea    0x66ef(%rip),%rax        # 8069 <nel::log>
+    197a:	48 89 c7             	mov    %rax,%rdi
+    197d:	e8 33 26 00 00       	call   3fb5 <nel::operator<<(nel::Log&, char const*)>
+    1982:	be 0a 00 00 00       	mov    $0xa,%esi
+    1987:	48 89 c7             	mov    %rax,%rdi
+    198a:	e8 fa 25 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+    ex43();
+    198f:	e8 a0 fc ff ff       	call   1634 <ex43()>
+    nel::log << "ex43:e" << '\n';
+    1994:	48 8d 05 f8 36 00 00 	lea    0x36f8(%rip),%rax        # 5093 <nel::sort::ninther_n+0x73>
+    199b:	48 89 c6             	mov    %rax,%rsi
+    199e:	48 8d 05 c4 66 00 00 	lea    0x66c4(%rip),%rax        # 8069 <nel::log>
+    19a5:	48 89 c7             	mov    %rax,%rdi
+    19a8:	e8 08 26 00 00       	call   3fb5 <nel::operator<<(nel::Log&, char const*)>
+    19ad:	be 0a 00 00 00       	mov    $0xa,%esi
+    19b2:	48 89 c7             	mov    %rax,%rdi
+    19b5:	e8 cf 25 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+#if defined(RUST_LIKE)
+    nel::log << "ex44:b" << '\n';
+    ex44();
+    nel::log << "ex44:e" << '\n';
+#endif
+}
+    19ba:	b8 00 00 00 00       	mov    $0x0,%eax
+    19bf:	5d                   	pop    %rbp
+    19c0:	c3                   	ret
+    19c1:	90                   	nop
+
+00000000000019c2 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<ex42()::{lambda(U8Buf<256ul>&)#1}>(ex42()::{lambda(U8Buf<256ul>&)#1}&&)>:
+         * @param fn func to apply to each item in iterator
+         */
+        // void for_each(std::function<void(OutT)> fn)
+#    if defined(C_LIKE) || defined(RUST_LIKE)
+        template<typename F>
+        void for_each(F &&fn)
+    19c2:	       55                   	push   %rbp
+    19c3:	       48 89 e5             	mov    %rsp,%rbp
+    19c6:	       48 83 ec 10          	sub    $0x10,%rsp
+    19ca:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    19ce:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        template<typename F>
+        void for_each2(F &&fn)
+#        endif
+        {
+#        if 1
+            for (; !self().is_done(); self().inc()) {
+    19d2:	   /-- eb 3a                	jmp    1a0e <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<ex42()::{lambda(U8Buf<256ul>&)#1}>(ex42()::{lambda(U8Buf<256ul>&)#1}&&)+0x4c>
+                fn(self().deref());
+    19d4:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19d8:	|  |   48 89 c7             	mov    %rax,%rdi
+    19db:	|  |   e8 1c 0f 00 00       	call   28fc <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    19e0:	|  |   48 89 c7             	mov    %rax,%rdi
+    19e3:	|  |   e8 ea 08 00 00       	call   22d2 <nel::SliceIterator<U8Buf<256ul> >::deref()>
+    19e8:	|  |   48 89 c2             	mov    %rax,%rdx
+    19eb:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19ef:	|  |   48 89 d6             	mov    %rdx,%rsi
+    19f2:	|  |   48 89 c7             	mov    %rax,%rdi
+    19f5:	|  |   e8 5e fa ff ff       	call   1458 <ex42()::{lambda(U8Buf<256ul>&)#1}::operator()(U8Buf<256ul>&) const>
+            for (; !self().is_done(); self().inc()) {
+    19fa:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19fe:	|  |   48 89 c7             	mov    %rax,%rdi
+    1a01:	|  |   e8 f6 0e 00 00       	call   28fc <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    1a06:	|  |   48 89 c7             	mov    %rax,%rdi
+    1a09:	|  |   e8 a4 08 00 00       	call   22b2 <nel::SliceIterator<U8Buf<256ul> >::inc()>
+    1a0e:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a12:	|      48 89 c7             	mov    %rax,%rdi
+    1a15:	|      e8 e2 0e 00 00       	call   28fc <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>
+    1a1a:	|      48 89 c7             	mov    %rax,%rdi
+    1a1d:	|      e8 96 02 00 00       	call   1cb8 <nel::SliceIterator<U8Buf<256ul> >::is_done() const>
+    1a22:	|      83 f0 01             	xor    $0x1,%eax
+    1a25:	|      84 c0                	test   %al,%al
+    1a27:	\----- 75 ab                	jne    19d4 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<ex42()::{lambda(U8Buf<256ul>&)#1}>(ex42()::{lambda(U8Buf<256ul>&)#1}&&)+0x12>
+            fn(self().deref());
+            self().inc();
+enter:
+            if (!self().is_done()) { goto loop; }
+#        endif
+        }
+    1a29:	       90                   	nop
+    1a2a:	       90                   	nop
+    1a2b:	       c9                   	leave
+    1a2c:	       c3                   	ret
+
+0000000000001a2d <operator new(unsigned long, void*)>:
+
+    1a2d:	55                   	push   %rbp
+    1a2e:	48 89 e5             	mov    %rsp,%rbp
+    1a31:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a35:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+void ex1()
+    1a39:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+{
+    1a3d:	5d                   	pop    %rbp
+    1a3e:	c3                   	ret
+    1a3f:	90                   	nop
+
+0000000000001a40 <nel::Context::Context(char const*, char const*, int)>:
+        char const *fn_name_;
+        char const *file_name_;
+        int line_num_;
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+    1a40:	55                   	push   %rbp
+    1a41:	48 89 e5             	mov    %rsp,%rbp
+    1a44:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a48:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1a4c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1a50:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1a53:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a57:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1a5b:	48 89 10             	mov    %rdx,(%rax)
+            , file_name_(file_name)
+    1a5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a62:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1a66:	48 89 50 08          	mov    %rdx,0x8(%rax)
+            , line_num_(line_num)
+    1a6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a6e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1a71:	89 50 10             	mov    %edx,0x10(%rax)
+        {
+        }
+    1a74:	90                   	nop
+    1a75:	5d                   	pop    %rbp
+    1a76:	c3                   	ret
+
+0000000000001a77 <nel::assert(bool, char const*, nel::Context const&)>:
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx);
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    1a77:	    55                   	push   %rbp
+    1a78:	    48 89 e5             	mov    %rsp,%rbp
+    1a7b:	    48 83 ec 20          	sub    $0x20,%rsp
+    1a7f:	    89 f8                	mov    %edi,%eax
+    1a81:	    48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1a85:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1a89:	    88 45 fc             	mov    %al,-0x4(%rbp)
+    if (!pred) { assert_fail(msg, ctx); }
+    1a8c:	    0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+    1a90:	    83 f0 01             	xor    $0x1,%eax
+    1a93:	    84 c0                	test   %al,%al
+    1a95:	/-- 74 13                	je     1aaa <nel::assert(bool, char const*, nel::Context const&)+0x33>
+    1a97:	|   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1a9b:	|   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a9f:	|   48 89 d6             	mov    %rdx,%rsi
+    1aa2:	|   48 89 c7             	mov    %rax,%rdi
+    1aa5:	|   e8 64 1c 00 00       	call   370e <nel::assert_fail(char const*, nel::Context const&)>
+}
+    1aaa:	\-> 90                   	nop
+    1aab:	    c9                   	leave
+    1aac:	    c3                   	ret
+
+0000000000001aad <nel::heaped::Malloc::try_malloc(unsigned long, unsigned long)>:
+ * and friends (see memory.hh).
+ */
+struct Malloc
+{
+    public:
+        static Result<void *, AllocError> try_malloc(Length const align, Length const size)
+    1aad:	55                   	push   %rbp
+    1aae:	48 89 e5             	mov    %rsp,%rbp
+    1ab1:	48 83 ec 20          	sub    $0x20,%rsp
+    1ab5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1ab9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1abd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            return try_realloc(nullptr, align, 0, size);
+    1ac1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ac5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1ac9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1acd:	49 89 c8             	mov    %rcx,%r8
+    1ad0:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1ad5:	be 00 00 00 00       	mov    $0x0,%esi
+    1ada:	48 89 c7             	mov    %rax,%rdi
+    1add:	e8 06 00 00 00       	call   1ae8 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>
+        }
+    1ae2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ae6:	c9                   	leave
+    1ae7:	c3                   	ret
+
+0000000000001ae8 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)>:
+
+        static Result<void *, AllocError> try_realloc(void *const p,
+    1ae8:	          55                   	push   %rbp
+    1ae9:	          48 89 e5             	mov    %rsp,%rbp
+    1aec:	          48 83 ec 40          	sub    $0x40,%rsp
+    1af0:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1af4:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1af8:	          48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    1afc:	          48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    1b00:	          4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+                                                      Length const align,
+                                                      Length const old_size,
+                                                      Length const new_size)
+        {
+            if (align == 0 || (align & (align - 1)) != 0) {
+    1b04:	          48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    1b09:	      /-- 74 11                	je     1b1c <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x34>
+    1b0b:	      |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1b0f:	      |   48 83 e8 01          	sub    $0x1,%rax
+    1b13:	      |   48 23 45 d8          	and    -0x28(%rbp),%rax
+    1b17:	      |   48 85 c0             	test   %rax,%rax
+    1b1a:	   /--|-- 74 1c                	je     1b38 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x50>
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+    1b1c:	   |  \-> c7 45 f8 02 00 00 00 	movl   $0x2,-0x8(%rbp)
+    1b23:	   |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b27:	   |      48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    1b2b:	   |      48 89 d6             	mov    %rdx,%rsi
+    1b2e:	   |      48 89 c7             	mov    %rax,%rdi
+    1b31:	   |      e8 06 02 00 00       	call   1d3c <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+                                    : std::realloc(p, new_size);
+            if (new_p == nullptr) {
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+            }
+            return Result<void *, AllocError>::Ok(new_p);
+        }
+    1b36:	/--|----- eb 79                	jmp    1bb1 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            void *const new_p = is_over_aligned(align)
+    1b38:	|  \----> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1b3c:	|         48 89 c7             	mov    %rax,%rdi
+    1b3f:	|         e8 b4 00 00 00       	call   1bf8 <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+                                    ? realloc_aligned(p, align, old_size, new_size)
+    1b44:	|         84 c0                	test   %al,%al
+    1b46:	|  /----- 74 1a                	je     1b62 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x7a>
+    1b48:	|  |      48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+    1b4c:	|  |      48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1b50:	|  |      48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+    1b54:	|  |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1b58:	|  |      48 89 c7             	mov    %rax,%rdi
+    1b5b:	|  |      e8 5a 22 00 00       	call   3dba <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+    1b60:	|  |  /-- eb 13                	jmp    1b75 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0x8d>
+                                    : std::realloc(p, new_size);
+    1b62:	|  \--|-> 48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    1b66:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1b6a:	|     |   48 89 d6             	mov    %rdx,%rsi
+    1b6d:	|     |   48 89 c7             	mov    %rax,%rdi
+    1b70:	|     |   e8 3b f5 ff ff       	call   10b0 <realloc@plt>
+    1b75:	|     \-> 48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            if (new_p == nullptr) {
+    1b79:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b7d:	|         48 85 c0             	test   %rax,%rax
+    1b80:	|     /-- 75 1c                	jne    1b9e <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xb6>
+                return Result<void *, AllocError>::Err(AllocError::OutOfMemory);
+    1b82:	|     |   c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1b89:	|     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b8d:	|     |   48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    1b91:	|     |   48 89 d6             	mov    %rdx,%rsi
+    1b94:	|     |   48 89 c7             	mov    %rax,%rdi
+    1b97:	|     |   e8 a0 01 00 00       	call   1d3c <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>
+        }
+    1b9c:	+-----|-- eb 13                	jmp    1bb1 <nel::heaped::Malloc::try_realloc(void*, unsigned long, unsigned long, unsigned long)+0xc9>
+            return Result<void *, AllocError>::Ok(new_p);
+    1b9e:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ba2:	|         48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    1ba6:	|         48 89 d6             	mov    %rdx,%rsi
+    1ba9:	|         48 89 c7             	mov    %rax,%rdi
+    1bac:	|         e8 bf 01 00 00       	call   1d70 <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>
+        }
+    1bb1:	\-------> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bb5:	          c9                   	leave
+    1bb6:	          c3                   	ret
+
+0000000000001bb7 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>:
+
+        static void free(void *const p, Length const align, Length const size)
+    1bb7:	       55                   	push   %rbp
+    1bb8:	       48 89 e5             	mov    %rsp,%rbp
+    1bbb:	       48 83 ec 20          	sub    $0x20,%rsp
+    1bbf:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1bc3:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1bc7:	       48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+    1bcb:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bcf:	       48 89 c7             	mov    %rax,%rdi
+    1bd2:	       e8 21 00 00 00       	call   1bf8 <nel::heaped::Malloc::is_over_aligned(unsigned long)>
+    1bd7:	       84 c0                	test   %al,%al
+    1bd9:	/----- 74 0e                	je     1be9 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x32>
+                free_aligned(p);
+    1bdb:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bdf:	|      48 89 c7             	mov    %rax,%rdi
+    1be2:	|      e8 8f 21 00 00       	call   3d76 <nel::free_aligned(void*)>
+            } else {
+                std::free(p);
+            }
+        }
+    1be7:	|  /-- eb 0c                	jmp    1bf5 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)+0x3e>
+                std::free(p);
+    1be9:	\--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bed:	   |   48 89 c7             	mov    %rax,%rdi
+    1bf0:	   |   e8 3b f4 ff ff       	call   1030 <free@plt>
+        }
+    1bf5:	   \-> 90                   	nop
+    1bf6:	       c9                   	leave
+    1bf7:	       c3                   	ret
+
+0000000000001bf8 <nel::heaped::Malloc::is_over_aligned(unsigned long)>:
+
+    private:
+        static constexpr bool is_over_aligned(Length const align)
+    1bf8:	55                   	push   %rbp
+    1bf9:	48 89 e5             	mov    %rsp,%rbp
+    1bfc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return align > alignof(std::max_align_t);
+    1c00:	48 83 7d f8 10       	cmpq   $0x10,-0x8(%rbp)
+    1c05:	0f 97 c0             	seta   %al
+        }
+    1c08:	5d                   	pop    %rbp
+    1c09:	c3                   	ret
+
+0000000000001c0a <U8Buf<256ul>::U8Buf(unsigned char)>:
+            nel::elem::move(data_, o.data_, N);
+            return *this;
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+    1c0a:	55                   	push   %rbp
+    1c0b:	48 89 e5             	mov    %rsp,%rbp
+    1c0e:	48 83 ec 10          	sub    $0x10,%rsp
+    1c12:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1c16:	89 f0                	mov    %esi,%eax
+    1c18:	88 45 f4             	mov    %al,-0xc(%rbp)
+        {
+            nel::elem::set(data_, f, N);
+    1c1b:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    1c1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c23:	ba 00 01 00 00       	mov    $0x100,%edx
+    1c28:	89 ce                	mov    %ecx,%esi
+    1c2a:	48 89 c7             	mov    %rax,%rdi
+    1c2d:	e8 65 1b 00 00       	call   3797 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    1c32:	90                   	nop
+    1c33:	c9                   	leave
+    1c34:	c3                   	ret
+    1c35:	90                   	nop
+
+0000000000001c36 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::iter()>:
+        constexpr auto iter(void) const
+        {
+            return slice().iter();
+        }
+
+        constexpr auto iter(void)
+    1c36:	55                   	push   %rbp
+    1c37:	48 89 e5             	mov    %rsp,%rbp
+    1c3a:	48 83 ec 20          	sub    $0x20,%rsp
+    1c3e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1c42:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            return slice().iter();
+    1c46:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1c4a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1c4e:	48 89 d6             	mov    %rdx,%rsi
+    1c51:	48 89 c7             	mov    %rax,%rdi
+    1c54:	e8 19 00 00 00       	call   1c72 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()>
+    1c59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c5d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    1c61:	48 89 d6             	mov    %rdx,%rsi
+    1c64:	48 89 c7             	mov    %rax,%rdi
+    1c67:	e8 ac 04 00 00       	call   2118 <nel::Slice<U8Buf<256ul> >::iter() const>
+        }
+    1c6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c70:	c9                   	leave
+    1c71:	c3                   	ret
+
+0000000000001c72 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()>:
+        constexpr Slice<Type> slice(void)
+    1c72:	       55                   	push   %rbp
+    1c73:	       48 89 e5             	mov    %rsp,%rbp
+    1c76:	       48 83 ec 10          	sub    $0x10,%rsp
+    1c7a:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1c7e:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return (item_ == nullptr) ? Slice<Type>::empty() : item_->slice();
+    1c82:	       48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c86:	       48 8b 00             	mov    (%rax),%rax
+    1c89:	       48 85 c0             	test   %rax,%rax
+    1c8c:	   /-- 75 0e                	jne    1c9c <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()+0x2a>
+    1c8e:	   |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c92:	   |   48 89 c7             	mov    %rax,%rdi
+    1c95:	   |   e8 c9 04 00 00       	call   2163 <nel::Slice<U8Buf<256ul> >::empty()>
+    1c9a:	/--|-- eb 16                	jmp    1cb2 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice()+0x40>
+    1c9c:	|  \-> 48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ca0:	|      48 8b 10             	mov    (%rax),%rdx
+    1ca3:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ca7:	|      48 89 d6             	mov    %rdx,%rsi
+    1caa:	|      48 89 c7             	mov    %rax,%rdi
+    1cad:	|      e8 d0 04 00 00       	call   2182 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::slice()>
+        }
+    1cb2:	\----> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cb6:	       c9                   	leave
+    1cb7:	       c3                   	ret
+
+0000000000001cb8 <nel::SliceIterator<U8Buf<256ul> >::is_done() const>:
+        }
+#    endif
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+    1cb8:	55                   	push   %rbp
+    1cb9:	48 89 e5             	mov    %rsp,%rbp
+    1cbc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return (b_ == e_);
+    1cc0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cc4:	48 8b 10             	mov    (%rax),%rdx
+    1cc7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ccb:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1ccf:	48 39 c2             	cmp    %rax,%rdx
+    1cd2:	0f 94 c0             	sete   %al
+        }
+    1cd5:	5d                   	pop    %rbp
+    1cd6:	c3                   	ret
+    1cd7:	90                   	nop
+
+0000000000001cd8 <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+                Element<T> ok_;
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    1cd8:	             55                   	push   %rbp
+    1cd9:	             48 89 e5             	mov    %rsp,%rbp
+    1cdc:	             48 83 ec 30          	sub    $0x30,%rsp
+    1ce0:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result::dtor
+    1ce4:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1ce8:	             8b 00                	mov    (%rax),%eax
+    1cea:	             83 f8 02             	cmp    $0x2,%eax
+    1ced:	/----------- 74 43                	je     1d32 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5a>
+    1cef:	|            83 f8 02             	cmp    $0x2,%eax
+    1cf2:	|        /-- 7f 09                	jg     1cfd <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x25>
+    1cf4:	|        |   85 c0                	test   %eax,%eax
+    1cf6:	|  /-----|-- 74 3d                	je     1d35 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x5d>
+    1cf8:	|  |     |   83 f8 01             	cmp    $0x1,%eax
+    1cfb:	|  |  /--|-- 74 3b                	je     1d38 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x60>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    1cfd:	|  |  |  \-> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1d01:	|  |  |      b9 72 00 00 00       	mov    $0x72,%ecx
+    1d06:	|  |  |      48 8d 15 8d 33 00 00 	lea    0x338d(%rip),%rdx        # 509a <nel::sort::ninther_n+0x7a>
+    1d0d:	|  |  |      48 8d 35 98 33 00 00 	lea    0x3398(%rip),%rsi        # 50ac <nel::sort::ninther_n+0x8c>
+    1d14:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1d17:	|  |  |      e8 24 fd ff ff       	call   1a40 <nel::Context::Context(char const*, char const*, int)>
+    1d1c:	|  |  |      48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1d20:	|  |  |      48 89 c6             	mov    %rax,%rsi
+    1d23:	|  |  |      48 8d 05 8a 33 00 00 	lea    0x338a(%rip),%rax        # 50b4 <nel::sort::ninther_n+0x94>
+    1d2a:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1d2d:	|  |  |      e8 81 19 00 00       	call   36b3 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    1d32:	\--|--|----> 90                   	nop
+    1d33:	   |  |  /-- eb 04                	jmp    1d39 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    1d35:	   \--|--|-> 90                   	nop
+    1d36:	      |  +-- eb 01                	jmp    1d39 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x61>
+                    break;
+    1d38:	      \--|-> 90                   	nop
+                    break;
+            }
+        }
+    1d39:	         \-> 90                   	nop
+    1d3a:	             c9                   	leave
+    1d3b:	             c3                   	ret
+
+0000000000001d3c <nel::Result<void*, nel::heaped::AllocError>::Err(nel::heaped::AllocError&&)>:
+         *
+         * @param val The value to move into the result as an err value.
+         *
+         * @returns a Result 'wrapping' the value given as an err value.
+         */
+        constexpr static Result Err(E &&val)
+    1d3c:	55                   	push   %rbp
+    1d3d:	48 89 e5             	mov    %rsp,%rbp
+    1d40:	48 83 ec 10          	sub    $0x10,%rsp
+    1d44:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1d48:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            return Result(Phantom<Tag::ERR>(), forward<E>(val));
+    1d4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d50:	48 89 c7             	mov    %rax,%rdi
+    1d53:	e8 8b 05 00 00       	call   22e3 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    1d58:	48 89 c2             	mov    %rax,%rdx
+    1d5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d5f:	48 89 d6             	mov    %rdx,%rsi
+    1d62:	48 89 c7             	mov    %rax,%rdi
+    1d65:	e8 88 05 00 00       	call   22f2 <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>
+        }
+    1d6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d6e:	c9                   	leave
+    1d6f:	c3                   	ret
+
+0000000000001d70 <nel::Result<void*, nel::heaped::AllocError> nel::Result<void*, nel::heaped::AllocError>::Ok<void* const&>(void* const&)>:
+        constexpr static Result Ok(Args &&...args)
+    1d70:	55                   	push   %rbp
+    1d71:	48 89 e5             	mov    %rsp,%rbp
+    1d74:	48 83 ec 10          	sub    $0x10,%rsp
+    1d78:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1d7c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::OK>(), forward<Args>(args)...);
+    1d80:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d84:	48 89 c7             	mov    %rax,%rdi
+    1d87:	e8 a7 05 00 00       	call   2333 <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    1d8c:	48 89 c2             	mov    %rax,%rdx
+    1d8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d93:	48 89 d6             	mov    %rdx,%rsi
+    1d96:	48 89 c7             	mov    %rax,%rdi
+    1d99:	e8 a4 05 00 00       	call   2342 <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>
+        }
+    1d9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1da2:	c9                   	leave
+    1da3:	c3                   	ret
+
+0000000000001da4 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>:
+        static constexpr Vector with_capacity(Count cap)
+    1da4:	       55                   	push   %rbp
+    1da5:	       48 89 e5             	mov    %rsp,%rbp
+    1da8:	       48 83 ec 20          	sub    $0x20,%rsp
+    1dac:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1db0:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            if (cap == 0) { return Vector(); }
+    1db4:	       48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1db9:	   /-- 75 0e                	jne    1dc9 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x25>
+    1dbb:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1dbf:	   |   48 89 c7             	mov    %rax,%rdi
+    1dc2:	   |   e8 bd 05 00 00       	call   2384 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector()>
+    1dc7:	/--|-- eb 3d                	jmp    1e06 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x62>
+            Vector a(VectorNode::malloc(cap));
+    1dc9:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1dcd:	|      48 89 c7             	mov    %rax,%rdi
+    1dd0:	|      e8 c5 05 00 00       	call   239a <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::malloc(unsigned long)>
+    1dd5:	|      48 89 c2             	mov    %rax,%rdx
+    1dd8:	|      48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1ddc:	|      48 89 d6             	mov    %rdx,%rsi
+    1ddf:	|      48 89 c7             	mov    %rax,%rdi
+    1de2:	|      e8 ed 05 00 00       	call   23d4 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*)>
+            return a;
+    1de7:	|      48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    1deb:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1def:	|      48 89 d6             	mov    %rdx,%rsi
+    1df2:	|      48 89 c7             	mov    %rax,%rdi
+    1df5:	|      e8 f4 05 00 00       	call   23ee <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >&&)>
+        }
+    1dfa:	|      48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1dfe:	|      48 89 c7             	mov    %rax,%rdi
+    1e01:	|      e8 06 00 00 00       	call   1e0c <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    1e06:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e0a:	       c9                   	leave
+    1e0b:	       c3                   	ret
+
+0000000000001e0c <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>:
+        ~Vector(void)
+    1e0c:	55                   	push   %rbp
+    1e0d:	48 89 e5             	mov    %rsp,%rbp
+    1e10:	48 83 ec 10          	sub    $0x10,%rsp
+    1e14:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            VectorNode::free(item_);
+    1e18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e1c:	48 8b 00             	mov    (%rax),%rax
+    1e1f:	48 89 c7             	mov    %rax,%rdi
+    1e22:	e8 11 06 00 00       	call   2438 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*)>
+        }
+    1e27:	90                   	nop
+    1e28:	c9                   	leave
+    1e29:	c3                   	ret
+
+0000000000001e2a <nel::heaped::operator<<(nel::Log&, nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > const&)>:
+         * @param outs the stream to dump the representation into.
+         */
+        // TODO: replace <<(Log ) with dbgfmt, so separate out from
+        // any other form of conversion to charstring.
+        // TODO: insert into formatter and not final dest type.
+        friend Log &operator<<(Log &outs, Vector const &v)
+    1e2a:	    55                   	push   %rbp
+    1e2b:	    48 89 e5             	mov    %rsp,%rbp
+    1e2e:	    53                   	push   %rbx
+    1e2f:	    48 83 ec 18          	sub    $0x18,%rsp
+    1e33:	    48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1e37:	    48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            outs << "Vector(" << v.len() << "){";
+    1e3b:	    48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e3f:	    48 8d 15 79 32 00 00 	lea    0x3279(%rip),%rdx        # 50bf <nel::sort::ninther_n+0x9f>
+    1e46:	    48 89 d6             	mov    %rdx,%rsi
+    1e49:	    48 89 c7             	mov    %rax,%rdi
+    1e4c:	    e8 64 21 00 00       	call   3fb5 <nel::operator<<(nel::Log&, char const*)>
+    1e51:	    48 89 c3             	mov    %rax,%rbx
+    1e54:	    48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e58:	    48 89 c7             	mov    %rax,%rdi
+    1e5b:	    e8 24 06 00 00       	call   2484 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    1e60:	    48 89 c6             	mov    %rax,%rsi
+    1e63:	    48 89 df             	mov    %rbx,%rdi
+    1e66:	    e8 55 22 00 00       	call   40c0 <nel::operator<<(nel::Log&, unsigned long)>
+    1e6b:	    48 89 c2             	mov    %rax,%rdx
+    1e6e:	    48 8d 05 52 32 00 00 	lea    0x3252(%rip),%rax        # 50c7 <nel::sort::ninther_n+0xa7>
+    1e75:	    48 89 c6             	mov    %rax,%rsi
+    1e78:	    48 89 d7             	mov    %rdx,%rdi
+    1e7b:	    e8 35 21 00 00       	call   3fb5 <nel::operator<<(nel::Log&, char const*)>
+#    if 1
+            outs << '\n';
+    1e80:	    48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e84:	    be 0a 00 00 00       	mov    $0xa,%esi
+    1e89:	    48 89 c7             	mov    %rax,%rdi
+    1e8c:	    e8 f8 20 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+            if (v.item_ != nullptr) { outs << *v.item_; }
+    1e91:	    48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e95:	    48 8b 00             	mov    (%rax),%rax
+    1e98:	    48 85 c0             	test   %rax,%rax
+    1e9b:	/-- 74 16                	je     1eb3 <nel::heaped::operator<<(nel::Log&, nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > const&)+0x89>
+    1e9d:	|   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ea1:	|   48 8b 10             	mov    (%rax),%rdx
+    1ea4:	|   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ea8:	|   48 89 d6             	mov    %rdx,%rsi
+    1eab:	|   48 89 c7             	mov    %rax,%rdi
+    1eae:	|   e8 3d 06 00 00       	call   24f0 <nel::heaped::operator<<(nel::Log&, nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc> const&)>
+#    else
+            if (v.item_ != nullptr) { outs << *v.item_; }
+#    endif
+            outs << '}';
+    1eb3:	\-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1eb7:	    be 7d 00 00 00       	mov    $0x7d,%esi
+    1ebc:	    48 89 c7             	mov    %rax,%rdi
+    1ebf:	    e8 c5 20 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+            return outs;
+    1ec4:	    48 8b 45 e8          	mov    -0x18(%rbp),%rax
+        }
+    1ec8:	    48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1ecc:	    c9                   	leave
+    1ecd:	    c3                   	ret
+
+0000000000001ece <U8Buf<256ul>::~U8Buf()>:
+        constexpr ~U8Buf(void)
+    1ece:	55                   	push   %rbp
+    1ecf:	48 89 e5             	mov    %rsp,%rbp
+    1ed2:	48 83 ec 10          	sub    $0x10,%rsp
+    1ed6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            nel::elem::set(data_, 0xa5, N);
+    1eda:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ede:	ba 00 01 00 00       	mov    $0x100,%edx
+    1ee3:	be a5 00 00 00       	mov    $0xa5,%esi
+    1ee8:	48 89 c7             	mov    %rax,%rdi
+    1eeb:	e8 a7 18 00 00       	call   3797 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    1ef0:	90                   	nop
+    1ef1:	c9                   	leave
+    1ef2:	c3                   	ret
+
+0000000000001ef3 <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel is to not need std.
+ */
+template<typename T>
+constexpr T &&move(T &v)
+    1ef3:	55                   	push   %rbp
+    1ef4:	48 89 e5             	mov    %rsp,%rbp
+    1ef7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<T &&>(v);
+    1efb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1eff:	5d                   	pop    %rbp
+    1f00:	c3                   	ret
+    1f01:	90                   	nop
+
+0000000000001f02 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(U8Buf<256ul>&&)>:
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+    1f02:	       55                   	push   %rbp
+    1f03:	       48 89 e5             	mov    %rsp,%rbp
+    1f06:	       48 83 ec 30          	sub    $0x30,%rsp
+    1f0a:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1f0e:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1f12:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            ok = try_reserve_for(1);
+    1f16:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f1a:	       be 01 00 00 00       	mov    $0x1,%esi
+    1f1f:	       48 89 c7             	mov    %rax,%rdi
+    1f22:	       e8 05 06 00 00       	call   252c <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>
+    1f27:	       88 45 ff             	mov    %al,-0x1(%rbp)
+            if (!ok) { return Result<void, Type>::Err(val); }
+    1f2a:	       0f b6 45 ff          	movzbl -0x1(%rbp),%eax
+    1f2e:	       83 f0 01             	xor    $0x1,%eax
+    1f31:	       84 c0                	test   %al,%al
+    1f33:	   /-- 74 15                	je     1f4a <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(U8Buf<256ul>&&)+0x48>
+    1f35:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f39:	   |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1f3d:	   |   48 89 d6             	mov    %rdx,%rsi
+    1f40:	   |   48 89 c7             	mov    %rax,%rdi
+    1f43:	   |   e8 4f 06 00 00       	call   2597 <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<U8Buf<256ul>&>(U8Buf<256ul>&)>
+    1f48:	/--|-- eb 3b                	jmp    1f85 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(U8Buf<256ul>&&)+0x83>
+            if (item_ == nullptr) { return Result<void, Type>::Err(val); }
+    1f4a:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f4e:	|      48 8b 00             	mov    (%rax),%rax
+    1f51:	|      48 85 c0             	test   %rax,%rax
+    1f54:	|  /-- 75 15                	jne    1f6b <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(U8Buf<256ul>&&)+0x69>
+    1f56:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f5a:	|  |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1f5e:	|  |   48 89 d6             	mov    %rdx,%rsi
+    1f61:	|  |   48 89 c7             	mov    %rax,%rdi
+    1f64:	|  |   e8 2e 06 00 00       	call   2597 <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<U8Buf<256ul>&>(U8Buf<256ul>&)>
+    1f69:	+--|-- eb 1a                	jmp    1f85 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(U8Buf<256ul>&&)+0x83>
+            return item_->push_back(val);
+    1f6b:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f6f:	|      48 8b 08             	mov    (%rax),%rcx
+    1f72:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f76:	|      48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1f7a:	|      48 89 ce             	mov    %rcx,%rsi
+    1f7d:	|      48 89 c7             	mov    %rax,%rdi
+    1f80:	|      e8 47 06 00 00       	call   25cc <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::push_back<U8Buf<256ul>&>(U8Buf<256ul>&)>
+        }
+    1f85:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f89:	       c9                   	leave
+    1f8a:	       c3                   	ret
+    1f8b:	       90                   	nop
+
+0000000000001f8c <nel::Element<U8Buf<256ul> >::~Element()>:
+
+    private:
+        Type value_;
+
+    public:
+        constexpr ~Element(void) = default;
+    1f8c:	55                   	push   %rbp
+    1f8d:	48 89 e5             	mov    %rsp,%rbp
+    1f90:	48 83 ec 10          	sub    $0x10,%rsp
+    1f94:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f9c:	48 89 c7             	mov    %rax,%rdi
+    1f9f:	e8 2a ff ff ff       	call   1ece <U8Buf<256ul>::~U8Buf()>
+    1fa4:	90                   	nop
+    1fa5:	c9                   	leave
+    1fa6:	c3                   	ret
+    1fa7:	90                   	nop
+
+0000000000001fa8 <nel::Result<void, U8Buf<256ul> >::~Result()>:
+        union {
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    1fa8:	             55                   	push   %rbp
+    1fa9:	             48 89 e5             	mov    %rsp,%rbp
+    1fac:	             48 83 ec 30          	sub    $0x30,%rsp
+    1fb0:	             48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+        {
+            switch (tag_) { // result<void>-dtor
+    1fb4:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1fb8:	             8b 00                	mov    (%rax),%eax
+    1fba:	             83 f8 02             	cmp    $0x2,%eax
+    1fbd:	         /-- 74 10                	je     1fcf <nel::Result<void, U8Buf<256ul> >::~Result()+0x27>
+    1fbf:	         |   83 f8 02             	cmp    $0x2,%eax
+    1fc2:	      /--|-- 7f 1d                	jg     1fe1 <nel::Result<void, U8Buf<256ul> >::~Result()+0x39>
+    1fc4:	      |  |   85 c0                	test   %eax,%eax
+    1fc6:	/-----|--|-- 74 4e                	je     2016 <nel::Result<void, U8Buf<256ul> >::~Result()+0x6e>
+    1fc8:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    1fcb:	|     +--|-- 75 14                	jne    1fe1 <nel::Result<void, U8Buf<256ul> >::~Result()+0x39>
+                case Tag::OK:
+                    break;
+    1fcd:	|  /--|--|-- eb 48                	jmp    2017 <nel::Result<void, U8Buf<256ul> >::~Result()+0x6f>
+
+                case Tag::ERR:
+                    err_.~Element<E>();
+    1fcf:	|  |  |  \-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1fd3:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    1fd7:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1fda:	|  |  |      e8 ad ff ff ff       	call   1f8c <nel::Element<U8Buf<256ul> >::~Element()>
+                    break;
+    1fdf:	|  +--|----- eb 36                	jmp    2017 <nel::Result<void, U8Buf<256ul> >::~Result()+0x6f>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    1fe1:	|  |  \----> 48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    1fe5:	|  |         b9 dd 02 00 00       	mov    $0x2dd,%ecx
+    1fea:	|  |         48 8d 15 a9 30 00 00 	lea    0x30a9(%rip),%rdx        # 509a <nel::sort::ninther_n+0x7a>
+    1ff1:	|  |         48 8d 35 b4 30 00 00 	lea    0x30b4(%rip),%rsi        # 50ac <nel::sort::ninther_n+0x8c>
+    1ff8:	|  |         48 89 c7             	mov    %rax,%rdi
+    1ffb:	|  |         e8 40 fa ff ff       	call   1a40 <nel::Context::Context(char const*, char const*, int)>
+    2000:	|  |         48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2004:	|  |         48 89 c6             	mov    %rax,%rsi
+    2007:	|  |         48 8d 05 a6 30 00 00 	lea    0x30a6(%rip),%rax        # 50b4 <nel::sort::ninther_n+0x94>
+    200e:	|  |         48 89 c7             	mov    %rax,%rdi
+    2011:	|  |         e8 9d 16 00 00       	call   36b3 <nel::panic(char const*, nel::Context const&)>
+                    break;
+    2016:	\--|-------> 90                   	nop
+                    break;
+            }
+        }
+    2017:	   \-------> 90                   	nop
+    2018:	             c9                   	leave
+    2019:	             c3                   	ret
+
+000000000000201a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}::operator()() const>:
+         *
+         * `this` is not consumed by this op.
+         */
+        constexpr bool is_ok(Context const &ctx = Context()) const
+        {
+            return match<bool>([](void) -> bool { return true; },
+    201a:	55                   	push   %rbp
+    201b:	48 89 e5             	mov    %rsp,%rbp
+    201e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2022:	b8 01 00 00 00       	mov    $0x1,%eax
+    2027:	5d                   	pop    %rbp
+    2028:	c3                   	ret
+    2029:	90                   	nop
+
+000000000000202a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}::operator()(U8Buf<256ul> const&) const>:
+                               [](E const &) -> bool { return false; },
+    202a:	55                   	push   %rbp
+    202b:	48 89 e5             	mov    %rsp,%rbp
+    202e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2032:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2036:	b8 00 00 00 00       	mov    $0x0,%eax
+    203b:	5d                   	pop    %rbp
+    203c:	c3                   	ret
+    203d:	90                   	nop
+
+000000000000203e <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const>:
+        constexpr bool is_ok(Context const &ctx = Context()) const
+    203e:	55                   	push   %rbp
+    203f:	48 89 e5             	mov    %rsp,%rbp
+    2042:	48 83 ec 20          	sub    $0x20,%rsp
+    2046:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    204a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](void) -> bool { return true; },
+    204e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2052:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    2056:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    205a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    205e:	48 89 c7             	mov    %rax,%rdi
+    2061:	e8 2c 06 00 00       	call   2692 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const>
+                               ctx);
+        }
+    2066:	c9                   	leave
+    2067:	c3                   	ret
+
+0000000000002068 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>:
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Args &&...args)
+    2068:	       55                   	push   %rbp
+    2069:	       48 89 e5             	mov    %rsp,%rbp
+    206c:	       53                   	push   %rbx
+    206d:	       48 83 ec 38          	sub    $0x38,%rsp
+    2071:	       48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    2075:	       48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    2079:	       48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+            ok = try_reserve_for(1);
+    207d:	       48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2081:	       be 01 00 00 00       	mov    $0x1,%esi
+    2086:	       48 89 c7             	mov    %rax,%rdi
+    2089:	       e8 9e 04 00 00       	call   252c <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>
+    208e:	       88 45 ef             	mov    %al,-0x11(%rbp)
+            if (!ok) { return Result<void, Type>::Err(forward<Args>(args)...); }
+    2091:	       0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+    2095:	       83 f0 01             	xor    $0x1,%eax
+    2098:	       84 c0                	test   %al,%al
+    209a:	   /-- 74 20                	je     20bc <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x54>
+    209c:	   |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    20a0:	   |   48 89 c7             	mov    %rax,%rdi
+    20a3:	   |   e8 7b 06 00 00       	call   2723 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    20a8:	   |   48 89 c2             	mov    %rax,%rdx
+    20ab:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    20af:	   |   48 89 d6             	mov    %rdx,%rsi
+    20b2:	   |   48 89 c7             	mov    %rax,%rdi
+    20b5:	   |   e8 77 06 00 00       	call   2731 <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<unsigned char>(unsigned char&&)>
+    20ba:	/--|-- eb 51                	jmp    210d <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0xa5>
+            if (item_ == nullptr) { return Result<void, Type>::Err(forward<Args>(args)...); }
+    20bc:	|  \-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    20c0:	|      48 8b 00             	mov    (%rax),%rax
+    20c3:	|      48 85 c0             	test   %rax,%rax
+    20c6:	|  /-- 75 20                	jne    20e8 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x80>
+    20c8:	|  |   48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    20cc:	|  |   48 89 c7             	mov    %rax,%rdi
+    20cf:	|  |   e8 4f 06 00 00       	call   2723 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    20d4:	|  |   48 89 c2             	mov    %rax,%rdx
+    20d7:	|  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    20db:	|  |   48 89 d6             	mov    %rdx,%rsi
+    20de:	|  |   48 89 c7             	mov    %rax,%rdi
+    20e1:	|  |   e8 4b 06 00 00       	call   2731 <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<unsigned char>(unsigned char&&)>
+    20e6:	+--|-- eb 25                	jmp    210d <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0xa5>
+            return item_->push_back(forward<Args>(args)...);
+    20e8:	|  \-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    20ec:	|      48 8b 18             	mov    (%rax),%rbx
+    20ef:	|      48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    20f3:	|      48 89 c7             	mov    %rax,%rdi
+    20f6:	|      e8 28 06 00 00       	call   2723 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    20fb:	|      48 89 c2             	mov    %rax,%rdx
+    20fe:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2102:	|      48 89 de             	mov    %rbx,%rsi
+    2105:	|      48 89 c7             	mov    %rax,%rdi
+    2108:	|      e8 59 06 00 00       	call   2766 <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::push_back<unsigned char>(unsigned char&&)>
+        }
+    210d:	\----> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2111:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2115:	       c9                   	leave
+    2116:	       c3                   	ret
+    2117:	       90                   	nop
+
+0000000000002118 <nel::Slice<U8Buf<256ul> >::iter() const>:
+        constexpr Iterator iter(void) const
+    2118:	55                   	push   %rbp
+    2119:	48 89 e5             	mov    %rsp,%rbp
+    211c:	53                   	push   %rbx
+    211d:	48 83 ec 18          	sub    $0x18,%rsp
+    2121:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2125:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return Iterator(ptr(), len());
+    2129:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    212d:	48 89 c7             	mov    %rax,%rdi
+    2130:	e8 0f 07 00 00       	call   2844 <nel::Slice<U8Buf<256ul> >::len() const>
+    2135:	48 89 c3             	mov    %rax,%rbx
+    2138:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    213c:	48 89 c7             	mov    %rax,%rdi
+    213f:	e8 ee 06 00 00       	call   2832 <nel::Slice<U8Buf<256ul> >::ptr() const>
+    2144:	48 89 c1             	mov    %rax,%rcx
+    2147:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    214b:	48 89 da             	mov    %rbx,%rdx
+    214e:	48 89 ce             	mov    %rcx,%rsi
+    2151:	48 89 c7             	mov    %rax,%rdi
+    2154:	e8 fd 06 00 00       	call   2856 <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(U8Buf<256ul>*, unsigned long)>
+        }
+    2159:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    215d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2161:	c9                   	leave
+    2162:	c3                   	ret
+
+0000000000002163 <nel::Slice<U8Buf<256ul> >::empty()>:
+        static constexpr Slice empty(void)
+    2163:	55                   	push   %rbp
+    2164:	48 89 e5             	mov    %rsp,%rbp
+    2167:	48 83 ec 10          	sub    $0x10,%rsp
+    216b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Slice();
+    216f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2173:	48 89 c7             	mov    %rax,%rdi
+    2176:	e8 13 07 00 00       	call   288e <nel::Slice<U8Buf<256ul> >::Slice()>
+        }
+    217b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    217f:	c9                   	leave
+    2180:	c3                   	ret
+    2181:	90                   	nop
+
+0000000000002182 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::slice()>:
+        {
+            return len() == 0;
+        }
+
+    public:
+        constexpr Slice<Type> slice(void)
+    2182:	55                   	push   %rbp
+    2183:	48 89 e5             	mov    %rsp,%rbp
+    2186:	48 83 ec 10          	sub    $0x10,%rsp
+    218a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    218e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+        {
+            return Slice(values_, len());
+    2192:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2196:	48 89 c7             	mov    %rax,%rdi
+    2199:	e8 12 07 00 00       	call   28b0 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::len() const>
+    219e:	48 89 c2             	mov    %rax,%rdx
+    21a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    21a5:	48 8d 48 10          	lea    0x10(%rax),%rcx
+    21a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21ad:	48 89 ce             	mov    %rcx,%rsi
+    21b0:	48 89 c7             	mov    %rax,%rdi
+    21b3:	e8 0a 07 00 00       	call   28c2 <nel::Slice<U8Buf<256ul> >::Slice(U8Buf<256ul>*, unsigned long)>
+        }
+    21b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21bc:	c9                   	leave
+    21bd:	c3                   	ret
+
+00000000000021be <operator<<(nel::Log&, U8Buf<256ul> const&)>:
+        void fill(uint8_t f)
+        {
+            nel::elem::set(data_, f, N);
+        }
+
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+    21be:	          55                   	push   %rbp
+    21bf:	          48 89 e5             	mov    %rsp,%rbp
+    21c2:	          53                   	push   %rbx
+    21c3:	          48 83 ec 28          	sub    $0x28,%rsp
+    21c7:	          48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    21cb:	          48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+        {
+            outs << "U8Buf<" << val.len() << ">{";
+    21cf:	          48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    21d3:	          48 8d 15 f0 2e 00 00 	lea    0x2ef0(%rip),%rdx        # 50ca <nel::sort::ninther_n+0xaa>
+    21da:	          48 89 d6             	mov    %rdx,%rsi
+    21dd:	          48 89 c7             	mov    %rax,%rdi
+    21e0:	          e8 d0 1d 00 00       	call   3fb5 <nel::operator<<(nel::Log&, char const*)>
+    21e5:	          48 89 c3             	mov    %rax,%rbx
+    21e8:	          48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    21ec:	          48 89 c7             	mov    %rax,%rdi
+    21ef:	          e8 f8 06 00 00       	call   28ec <U8Buf<256ul>::len() const>
+    21f4:	          48 89 c6             	mov    %rax,%rsi
+    21f7:	          48 89 df             	mov    %rbx,%rdi
+    21fa:	          e8 c1 1e 00 00       	call   40c0 <nel::operator<<(nel::Log&, unsigned long)>
+    21ff:	          48 89 c2             	mov    %rax,%rdx
+    2202:	          48 8d 05 c8 2e 00 00 	lea    0x2ec8(%rip),%rax        # 50d1 <nel::sort::ninther_n+0xb1>
+    2209:	          48 89 c6             	mov    %rax,%rsi
+    220c:	          48 89 d7             	mov    %rdx,%rdi
+    220f:	          e8 a1 1d 00 00       	call   3fb5 <nel::operator<<(nel::Log&, char const*)>
+            if (val.len() > 0) {
+    2214:	          48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2218:	          48 89 c7             	mov    %rax,%rdi
+    221b:	          e8 cc 06 00 00       	call   28ec <U8Buf<256ul>::len() const>
+    2220:	          48 85 c0             	test   %rax,%rax
+    2223:	          0f 95 c0             	setne  %al
+    2226:	          84 c0                	test   %al,%al
+    2228:	/-------- 74 6d                	je     2297 <operator<<(nel::Log&, U8Buf<256ul> const&)+0xd9>
+                outs << val.data_[0];
+    222a:	|         48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    222e:	|         0f b6 00             	movzbl (%rax),%eax
+    2231:	|         0f b6 d0             	movzbl %al,%edx
+    2234:	|         48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2238:	|         89 d6                	mov    %edx,%esi
+    223a:	|         48 89 c7             	mov    %rax,%rdi
+    223d:	|         e8 9f 1d 00 00       	call   3fe1 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    2242:	|         48 c7 45 e8 01 00 00 	movq   $0x1,-0x18(%rbp)
+    2249:	|         00 
+    224a:	|     /-- eb 34                	jmp    2280 <operator<<(nel::Log&, U8Buf<256ul> const&)+0xc2>
+                    outs << ' ' << val.data_[i];
+    224c:	|  /--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2250:	|  |  |   be 20 00 00 00       	mov    $0x20,%esi
+    2255:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2258:	|  |  |   e8 2c 1d 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+    225d:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    2260:	|  |  |   48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    2264:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2268:	|  |  |   48 01 c8             	add    %rcx,%rax
+    226b:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    226e:	|  |  |   0f b6 c0             	movzbl %al,%eax
+    2271:	|  |  |   89 c6                	mov    %eax,%esi
+    2273:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    2276:	|  |  |   e8 66 1d 00 00       	call   3fe1 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    227b:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    2280:	|  |  \-> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2284:	|  |      48 89 c7             	mov    %rax,%rdi
+    2287:	|  |      e8 60 06 00 00       	call   28ec <U8Buf<256ul>::len() const>
+    228c:	|  |      48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    2290:	|  |      0f 92 c0             	setb   %al
+    2293:	|  |      84 c0                	test   %al,%al
+    2295:	|  \----- 75 b5                	jne    224c <operator<<(nel::Log&, U8Buf<256ul> const&)+0x8e>
+                }
+            }
+            outs << '}';
+    2297:	\-------> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    229b:	          be 7d 00 00 00       	mov    $0x7d,%esi
+    22a0:	          48 89 c7             	mov    %rax,%rdi
+    22a3:	          e8 e1 1c 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+            return outs;
+    22a8:	          48 8b 45 d8          	mov    -0x28(%rbp),%rax
+        }
+    22ac:	          48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    22b0:	          c9                   	leave
+    22b1:	          c3                   	ret
+
+00000000000022b2 <nel::SliceIterator<U8Buf<256ul> >::inc()>:
+
+        void inc(void)
+    22b2:	55                   	push   %rbp
+    22b3:	48 89 e5             	mov    %rsp,%rbp
+    22b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            ++b_;
+    22ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22be:	48 8b 00             	mov    (%rax),%rax
+    22c1:	48 8d 90 00 01 00 00 	lea    0x100(%rax),%rdx
+    22c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22cc:	48 89 10             	mov    %rdx,(%rax)
+        }
+    22cf:	90                   	nop
+    22d0:	5d                   	pop    %rbp
+    22d1:	c3                   	ret
+
+00000000000022d2 <nel::SliceIterator<U8Buf<256ul> >::deref()>:
+
+        OutT deref(void)
+    22d2:	55                   	push   %rbp
+    22d3:	48 89 e5             	mov    %rsp,%rbp
+    22d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return *b_;
+    22da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22de:	48 8b 00             	mov    (%rax),%rax
+        }
+    22e1:	5d                   	pop    %rbp
+    22e2:	c3                   	ret
+
+00000000000022e3 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>:
+ * probably not as complete as though.
+ *
+ * having own implementation as nel so to not need std.
+ */
+template<typename U, typename T>
+constexpr U &&forward(T &t)
+    22e3:	55                   	push   %rbp
+    22e4:	48 89 e5             	mov    %rsp,%rbp
+    22e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+{
+    return static_cast<U &&>(t);
+    22eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    22ef:	5d                   	pop    %rbp
+    22f0:	c3                   	ret
+    22f1:	90                   	nop
+
+00000000000022f2 <nel::Result<void*, nel::heaped::AllocError>::Result(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)2>, nel::heaped::AllocError&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+    22f2:	55                   	push   %rbp
+    22f3:	48 89 e5             	mov    %rsp,%rbp
+    22f6:	53                   	push   %rbx
+    22f7:	48 83 ec 18          	sub    $0x18,%rsp
+    22fb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    22ff:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    2303:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2307:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<E>(v))
+    230d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2311:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    2315:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2319:	48 89 c7             	mov    %rax,%rdi
+    231c:	e8 c2 ff ff ff       	call   22e3 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    2321:	48 89 c6             	mov    %rax,%rsi
+    2324:	48 89 df             	mov    %rbx,%rdi
+    2327:	e8 e6 05 00 00       	call   2912 <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>
+        }
+    232c:	90                   	nop
+    232d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2331:	c9                   	leave
+    2332:	c3                   	ret
+
+0000000000002333 <void* const& nel::forward<void* const&, void* const>(void* const&)>:
+constexpr U &&forward(T &t)
+    2333:	55                   	push   %rbp
+    2334:	48 89 e5             	mov    %rsp,%rbp
+    2337:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    233b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    233f:	5d                   	pop    %rbp
+    2340:	c3                   	ret
+    2341:	90                   	nop
+
+0000000000002342 <nel::Result<void*, nel::heaped::AllocError>::Result<void* const&>(nel::Result<void*, nel::heaped::AllocError>::Phantom<(nel::Result<void*, nel::heaped::AllocError>::Tag)1>, void* const&)>:
+        constexpr Result(Phantom<Tag::OK> const, Args &&...args)
+    2342:	55                   	push   %rbp
+    2343:	48 89 e5             	mov    %rsp,%rbp
+    2346:	53                   	push   %rbx
+    2347:	48 83 ec 18          	sub    $0x18,%rsp
+    234b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    234f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::OK)
+    2353:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2357:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+            , ok_(forward<Args>(args)...)
+    235d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2361:	48 8d 58 08          	lea    0x8(%rax),%rbx
+    2365:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2369:	48 89 c7             	mov    %rax,%rdi
+    236c:	e8 c2 ff ff ff       	call   2333 <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    2371:	48 89 c6             	mov    %rax,%rsi
+    2374:	48 89 df             	mov    %rbx,%rdi
+    2377:	e8 be 05 00 00       	call   293a <nel::Element<void*>::Element<void* const&>(void* const&)>
+        }
+    237c:	90                   	nop
+    237d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2381:	c9                   	leave
+    2382:	c3                   	ret
+    2383:	90                   	nop
+
+0000000000002384 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector()>:
+        constexpr Vector(void)
+    2384:	55                   	push   %rbp
+    2385:	48 89 e5             	mov    %rsp,%rbp
+    2388:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : item_(nullptr)
+    238c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2390:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        }
+    2397:	90                   	nop
+    2398:	5d                   	pop    %rbp
+    2399:	c3                   	ret
+
+000000000000239a <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::malloc(unsigned long)>:
+        static Node *malloc(Count capacity)
+    239a:	    55                   	push   %rbp
+    239b:	    48 89 e5             	mov    %rsp,%rbp
+    239e:	    48 83 ec 20          	sub    $0x20,%rsp
+    23a2:	    48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            Node *new_n = realloc(nullptr, capacity);
+    23a6:	    48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    23aa:	    48 89 c6             	mov    %rax,%rsi
+    23ad:	    bf 00 00 00 00       	mov    $0x0,%edi
+    23b2:	    e8 a6 06 00 00       	call   2a5d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)>
+    23b7:	    48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    23bb:	    48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    23c0:	/-- 74 0c                	je     23ce <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::malloc(unsigned long)+0x34>
+    23c2:	|   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23c6:	|   48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    23cd:	|   00 
+            return new_n;
+    23ce:	\-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    23d2:	    c9                   	leave
+    23d3:	    c3                   	ret
+
+00000000000023d4 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*)>:
+        constexpr Vector(VectorNode *const n)
+    23d4:	55                   	push   %rbp
+    23d5:	48 89 e5             	mov    %rsp,%rbp
+    23d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    23dc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : item_(n)
+    23e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23e4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    23e8:	48 89 10             	mov    %rdx,(%rax)
+        }
+    23eb:	90                   	nop
+    23ec:	5d                   	pop    %rbp
+    23ed:	c3                   	ret
+
+00000000000023ee <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::Vector(nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >&&)>:
+        constexpr Vector(Vector &&o)
+    23ee:	55                   	push   %rbp
+    23ef:	48 89 e5             	mov    %rsp,%rbp
+    23f2:	48 83 ec 10          	sub    $0x10,%rsp
+    23f6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    23fa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : item_(move(o.item_))
+    23fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2402:	48 89 c7             	mov    %rax,%rdi
+    2405:	e8 73 08 00 00       	call   2c7d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*&& nel::move<nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*>(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*&)>
+    240a:	48 8b 10             	mov    (%rax),%rdx
+    240d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2411:	48 89 10             	mov    %rdx,(%rax)
+            o.item_ = nullptr;
+    2414:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2418:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+        }
+    241f:	90                   	nop
+    2420:	c9                   	leave
+    2421:	c3                   	ret
+
+0000000000002422 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::size_of(unsigned long)>:
+        static constexpr Length size_of(Count const cap)
+    2422:	55                   	push   %rbp
+    2423:	48 89 e5             	mov    %rsp,%rbp
+    2426:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    242a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    242e:	48 c1 e0 08          	shl    $0x8,%rax
+    2432:	48 83 c0 10          	add    $0x10,%rax
+        }
+    2436:	5d                   	pop    %rbp
+    2437:	c3                   	ret
+
+0000000000002438 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*)>:
+        static void free(Node *old)
+    2438:	       55                   	push   %rbp
+    2439:	       48 89 e5             	mov    %rsp,%rbp
+    243c:	       48 83 ec 20          	sub    $0x20,%rsp
+    2440:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            if (old == nullptr) { return; }
+    2444:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    2449:	/----- 74 36                	je     2481 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*)+0x49>
+            Length const sz = size_of(old->alloc_);
+    244b:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    244f:	|      48 8b 00             	mov    (%rax),%rax
+    2452:	|      48 89 c7             	mov    %rax,%rdi
+    2455:	|      e8 c8 ff ff ff       	call   2422 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::size_of(unsigned long)>
+    245a:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            old->~Node();
+    245e:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2462:	|      48 89 c7             	mov    %rax,%rdi
+    2465:	|      e8 22 08 00 00       	call   2c8c <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::~Node()>
+            Allocator::free(old, alignof(Node), sz);
+    246a:	|      48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    246e:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2472:	|      be 08 00 00 00       	mov    $0x8,%esi
+    2477:	|      48 89 c7             	mov    %rax,%rdi
+    247a:	|      e8 38 f7 ff ff       	call   1bb7 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>
+    247f:	|  /-- eb 01                	jmp    2482 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*)+0x4a>
+            if (old == nullptr) { return; }
+    2481:	\--|-> 90                   	nop
+        }
+    2482:	   \-> c9                   	leave
+    2483:	       c3                   	ret
+
+0000000000002484 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>:
+        constexpr Length len(void) const
+    2484:	       55                   	push   %rbp
+    2485:	       48 89 e5             	mov    %rsp,%rbp
+    2488:	       48 83 ec 10          	sub    $0x10,%rsp
+    248c:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->len();
+    2490:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2494:	       48 8b 00             	mov    (%rax),%rax
+    2497:	       48 85 c0             	test   %rax,%rax
+    249a:	/----- 74 11                	je     24ad <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x29>
+    249c:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24a0:	|      48 8b 00             	mov    (%rax),%rax
+    24a3:	|      48 89 c7             	mov    %rax,%rdi
+    24a6:	|      e8 05 04 00 00       	call   28b0 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::len() const>
+    24ab:	|  /-- eb 05                	jmp    24b2 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const+0x2e>
+    24ad:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    24b2:	   \-> c9                   	leave
+    24b3:	       c3                   	ret
+
+00000000000024b4 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::iter() const>:
+            w += len() - run;
+            len_ = w;
+        }
+
+    public:
+        constexpr auto iter(void) const
+    24b4:	55                   	push   %rbp
+    24b5:	48 89 e5             	mov    %rsp,%rbp
+    24b8:	48 83 ec 20          	sub    $0x20,%rsp
+    24bc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    24c0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            return slice().iter();
+    24c4:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    24c8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    24cc:	48 89 d6             	mov    %rdx,%rsi
+    24cf:	48 89 c7             	mov    %rax,%rdi
+    24d2:	e8 07 08 00 00       	call   2cde <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::slice() const>
+    24d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24db:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    24df:	48 89 d6             	mov    %rdx,%rsi
+    24e2:	48 89 c7             	mov    %rax,%rdi
+    24e5:	e8 30 08 00 00       	call   2d1a <nel::Slice<U8Buf<256ul> const>::iter() const>
+        }
+    24ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24ee:	c9                   	leave
+    24ef:	c3                   	ret
+
+00000000000024f0 <nel::heaped::operator<<(nel::Log&, nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc> const&)>:
+        {
+            return slice().iter();
+        }
+
+    public:
+        friend Log &operator<<(Log &outs, Node const &v)
+    24f0:	55                   	push   %rbp
+    24f1:	48 89 e5             	mov    %rsp,%rbp
+    24f4:	48 83 ec 20          	sub    $0x20,%rsp
+    24f8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    24fc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            outs << v.iter();
+    2500:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    2504:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2508:	48 89 d6             	mov    %rdx,%rsi
+    250b:	48 89 c7             	mov    %rax,%rdi
+    250e:	e8 a1 ff ff ff       	call   24b4 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::iter() const>
+    2513:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    2517:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    251b:	48 89 d6             	mov    %rdx,%rsi
+    251e:	48 89 c7             	mov    %rax,%rdi
+    2521:	e8 99 08 00 00       	call   2dbf <nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)>
+            return outs;
+    2526:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+        }
+    252a:	c9                   	leave
+    252b:	c3                   	ret
+
+000000000000252c <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>:
+        bool try_reserve_for(Count const n)
+    252c:	       55                   	push   %rbp
+    252d:	       48 89 e5             	mov    %rsp,%rbp
+    2530:	       53                   	push   %rbx
+    2531:	       48 83 ec 18          	sub    $0x18,%rsp
+    2535:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2539:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            if (len() + n <= capacity()) { return true; }
+    253d:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2541:	       48 89 c7             	mov    %rax,%rdi
+    2544:	       e8 3b ff ff ff       	call   2484 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    2549:	       48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    254d:	       48 8d 1c 10          	lea    (%rax,%rdx,1),%rbx
+    2551:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2555:	       48 89 c7             	mov    %rax,%rdi
+    2558:	       e8 05 09 00 00       	call   2e62 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    255d:	       48 39 d8             	cmp    %rbx,%rax
+    2560:	       0f 93 c0             	setae  %al
+    2563:	       84 c0                	test   %al,%al
+    2565:	   /-- 74 07                	je     256e <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x42>
+    2567:	   |   b8 01 00 00 00       	mov    $0x1,%eax
+    256c:	/--|-- eb 23                	jmp    2591 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x65>
+            return try_reserve(len() + n);
+    256e:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2572:	|      48 89 c7             	mov    %rax,%rdi
+    2575:	|      e8 0a ff ff ff       	call   2484 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    257a:	|      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    257e:	|      48 01 c2             	add    %rax,%rdx
+    2581:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2585:	|      48 89 d6             	mov    %rdx,%rsi
+    2588:	|      48 89 c7             	mov    %rax,%rdi
+    258b:	|      e8 02 09 00 00       	call   2e92 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>
+    2590:	|      90                   	nop
+        }
+    2591:	\----> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2595:	       c9                   	leave
+    2596:	       c3                   	ret
+
+0000000000002597 <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<U8Buf<256ul>&>(U8Buf<256ul>&)>:
+        constexpr static Result Err(Args &&...args)
+    2597:	55                   	push   %rbp
+    2598:	48 89 e5             	mov    %rsp,%rbp
+    259b:	48 83 ec 10          	sub    $0x10,%rsp
+    259f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    25a3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    25a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25ab:	48 89 c7             	mov    %rax,%rdi
+    25ae:	e8 32 0a 00 00       	call   2fe5 <U8Buf<256ul>& nel::forward<U8Buf<256ul>&, U8Buf<256ul> >(U8Buf<256ul>&)>
+    25b3:	48 89 c2             	mov    %rax,%rdx
+    25b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25ba:	48 89 d6             	mov    %rdx,%rsi
+    25bd:	48 89 c7             	mov    %rax,%rdi
+    25c0:	e8 2f 0a 00 00       	call   2ff4 <nel::Result<void, U8Buf<256ul> >::Result<U8Buf<256ul>&>(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)2>, U8Buf<256ul>&)>
+        }
+    25c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25c9:	c9                   	leave
+    25ca:	c3                   	ret
+    25cb:	90                   	nop
+
+00000000000025cc <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::push_back<U8Buf<256ul>&>(U8Buf<256ul>&)>:
+        Result<void, T> push_back(Args &&...args)
+    25cc:	       55                   	push   %rbp
+    25cd:	       48 89 e5             	mov    %rsp,%rbp
+    25d0:	       53                   	push   %rbx
+    25d1:	       48 83 ec 28          	sub    $0x28,%rsp
+    25d5:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    25d9:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    25dd:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            if (len() >= capacity()) {
+    25e1:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    25e5:	       48 89 c7             	mov    %rax,%rdi
+    25e8:	       e8 c3 02 00 00       	call   28b0 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::len() const>
+    25ed:	       48 89 c3             	mov    %rax,%rbx
+    25f0:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    25f4:	       48 89 c7             	mov    %rax,%rdi
+    25f7:	       e8 3a 0a 00 00       	call   3036 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::capacity() const>
+    25fc:	       48 39 c3             	cmp    %rax,%rbx
+    25ff:	       0f 93 c0             	setae  %al
+    2602:	       84 c0                	test   %al,%al
+    2604:	   /-- 74 20                	je     2626 <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::push_back<U8Buf<256ul>&>(U8Buf<256ul>&)+0x5a>
+                return Result<void, Type>::Err(forward<Args>(args)...);
+    2606:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    260a:	   |   48 89 c7             	mov    %rax,%rdi
+    260d:	   |   e8 d3 09 00 00       	call   2fe5 <U8Buf<256ul>& nel::forward<U8Buf<256ul>&, U8Buf<256ul> >(U8Buf<256ul>&)>
+    2612:	   |   48 89 c2             	mov    %rax,%rdx
+    2615:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2619:	   |   48 89 d6             	mov    %rdx,%rsi
+    261c:	   |   48 89 c7             	mov    %rax,%rdi
+    261f:	   |   e8 73 ff ff ff       	call   2597 <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<U8Buf<256ul>&>(U8Buf<256ul>&)>
+    2624:	/--|-- eb 62                	jmp    2688 <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::push_back<U8Buf<256ul>&>(U8Buf<256ul>&)+0xbc>
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    2626:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    262a:	|      48 89 c7             	mov    %rax,%rdi
+    262d:	|      e8 7e 02 00 00       	call   28b0 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::len() const>
+    2632:	|      48 c1 e0 08          	shl    $0x8,%rax
+    2636:	|      48 8d 50 10          	lea    0x10(%rax),%rdx
+    263a:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    263e:	|      48 01 d0             	add    %rdx,%rax
+    2641:	|      48 89 c6             	mov    %rax,%rsi
+    2644:	|      bf 00 01 00 00       	mov    $0x100,%edi
+    2649:	|      e8 df f3 ff ff       	call   1a2d <operator new(unsigned long, void*)>
+    264e:	|      48 89 c3             	mov    %rax,%rbx
+    2651:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2655:	|      48 89 c7             	mov    %rax,%rdi
+    2658:	|      e8 88 09 00 00       	call   2fe5 <U8Buf<256ul>& nel::forward<U8Buf<256ul>&, U8Buf<256ul> >(U8Buf<256ul>&)>
+    265d:	|      48 89 c6             	mov    %rax,%rsi
+    2660:	|      48 89 df             	mov    %rbx,%rdi
+    2663:	|      e8 e0 09 00 00       	call   3048 <U8Buf<256ul>::U8Buf(U8Buf<256ul> const&)>
+            len_ += 1;
+    2668:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    266c:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    2670:	|      48 8d 50 01          	lea    0x1(%rax),%rdx
+    2674:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2678:	|      48 89 50 08          	mov    %rdx,0x8(%rax)
+            return Result<void, Type>::Ok();
+    267c:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2680:	|      48 89 c7             	mov    %rax,%rdi
+    2683:	|      e8 eb 09 00 00       	call   3073 <nel::Result<void, U8Buf<256ul> >::Ok()>
+        }
+    2688:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    268c:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2690:	       c9                   	leave
+    2691:	       c3                   	ret
+
+0000000000002692 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    2692:	             55                   	push   %rbp
+    2693:	             48 89 e5             	mov    %rsp,%rbp
+    2696:	             48 83 ec 20          	sub    $0x20,%rsp
+    269a:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    269e:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    26a2:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    26a6:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result<void>-match
+    26aa:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26ae:	             8b 00                	mov    (%rax),%eax
+    26b0:	             83 f8 02             	cmp    $0x2,%eax
+    26b3:	         /-- 74 1c                	je     26d1 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x3f>
+    26b5:	         |   83 f8 02             	cmp    $0x2,%eax
+    26b8:	/--------|-- 7f 51                	jg     270b <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x79>
+    26ba:	|        |   85 c0                	test   %eax,%eax
+    26bc:	|     /--|-- 74 37                	je     26f5 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x63>
+    26be:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    26c1:	+-----|--|-- 75 48                	jne    270b <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x79>
+                    return on_ok();
+    26c3:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26c7:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    26ca:	|     |  |   e8 4b f9 ff ff       	call   201a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}::operator()() const>
+    26cf:	|  /--|--|-- eb 50                	jmp    2721 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_err(*err_);
+    26d1:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26d5:	|  |  |      48 83 c0 04          	add    $0x4,%rax
+    26d9:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    26dc:	|  |  |      e8 b1 09 00 00       	call   3092 <nel::Element<U8Buf<256ul> >::operator*() const>
+    26e1:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    26e4:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26e8:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    26eb:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    26ee:	|  |  |      e8 37 f9 ff ff       	call   202a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}::operator()(U8Buf<256ul> const&) const>
+    26f3:	|  +--|----- eb 2c                	jmp    2721 <bool nel::Result<void, U8Buf<256ul> >::match<bool, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}>(nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda()#1}&&, nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const::{lambda(U8Buf<256ul> const&)#2}&&, nel::Context const&) const+0x8f>
+                    nel::panic("invalid Result", ctx);
+    26f5:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    26f9:	|  |         48 89 c6             	mov    %rax,%rsi
+    26fc:	|  |         48 8d 05 d1 29 00 00 	lea    0x29d1(%rip),%rax        # 50d4 <nel::sort::ninther_n+0xb4>
+    2703:	|  |         48 89 c7             	mov    %rax,%rdi
+    2706:	|  |         e8 a8 0f 00 00       	call   36b3 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    270b:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    270f:	   |         48 89 c6             	mov    %rax,%rsi
+    2712:	   |         48 8d 05 9b 29 00 00 	lea    0x299b(%rip),%rax        # 50b4 <nel::sort::ninther_n+0x94>
+    2719:	   |         48 89 c7             	mov    %rax,%rdi
+    271c:	   |         e8 92 0f 00 00       	call   36b3 <nel::panic(char const*, nel::Context const&)>
+        }
+    2721:	   \-------> c9                   	leave
+    2722:	             c3                   	ret
+
+0000000000002723 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>:
+constexpr U &&forward(T &t)
+    2723:	55                   	push   %rbp
+    2724:	48 89 e5             	mov    %rsp,%rbp
+    2727:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    272b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    272f:	5d                   	pop    %rbp
+    2730:	c3                   	ret
+
+0000000000002731 <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<unsigned char>(unsigned char&&)>:
+        constexpr static Result Err(Args &&...args)
+    2731:	55                   	push   %rbp
+    2732:	48 89 e5             	mov    %rsp,%rbp
+    2735:	48 83 ec 10          	sub    $0x10,%rsp
+    2739:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    273d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    2741:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2745:	48 89 c7             	mov    %rax,%rdi
+    2748:	e8 d6 ff ff ff       	call   2723 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    274d:	48 89 c2             	mov    %rax,%rdx
+    2750:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2754:	48 89 d6             	mov    %rdx,%rsi
+    2757:	48 89 c7             	mov    %rax,%rdi
+    275a:	e8 4d 09 00 00       	call   30ac <nel::Result<void, U8Buf<256ul> >::Result<unsigned char>(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)2>, unsigned char&&)>
+        }
+    275f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2763:	c9                   	leave
+    2764:	c3                   	ret
+    2765:	90                   	nop
+
+0000000000002766 <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::push_back<unsigned char>(unsigned char&&)>:
+        Result<void, T> push_back(Args &&...args)
+    2766:	       55                   	push   %rbp
+    2767:	       48 89 e5             	mov    %rsp,%rbp
+    276a:	       53                   	push   %rbx
+    276b:	       48 83 ec 28          	sub    $0x28,%rsp
+    276f:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2773:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2777:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+            if (len() >= capacity()) {
+    277b:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    277f:	       48 89 c7             	mov    %rax,%rdi
+    2782:	       e8 29 01 00 00       	call   28b0 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::len() const>
+    2787:	       48 89 c3             	mov    %rax,%rbx
+    278a:	       48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    278e:	       48 89 c7             	mov    %rax,%rdi
+    2791:	       e8 a0 08 00 00       	call   3036 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::capacity() const>
+    2796:	       48 39 c3             	cmp    %rax,%rbx
+    2799:	       0f 93 c0             	setae  %al
+    279c:	       84 c0                	test   %al,%al
+    279e:	   /-- 74 20                	je     27c0 <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::push_back<unsigned char>(unsigned char&&)+0x5a>
+                return Result<void, Type>::Err(forward<Args>(args)...);
+    27a0:	   |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    27a4:	   |   48 89 c7             	mov    %rax,%rdi
+    27a7:	   |   e8 77 ff ff ff       	call   2723 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    27ac:	   |   48 89 c2             	mov    %rax,%rdx
+    27af:	   |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27b3:	   |   48 89 d6             	mov    %rdx,%rsi
+    27b6:	   |   48 89 c7             	mov    %rax,%rdi
+    27b9:	   |   e8 73 ff ff ff       	call   2731 <nel::Result<void, U8Buf<256ul> > nel::Result<void, U8Buf<256ul> >::Err<unsigned char>(unsigned char&&)>
+    27be:	/--|-- eb 67                	jmp    2827 <nel::Result<void, U8Buf<256ul> > nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::push_back<unsigned char>(unsigned char&&)+0xc1>
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    27c0:	|  \-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    27c4:	|      48 89 c7             	mov    %rax,%rdi
+    27c7:	|      e8 e4 00 00 00       	call   28b0 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::len() const>
+    27cc:	|      48 c1 e0 08          	shl    $0x8,%rax
+    27d0:	|      48 8d 50 10          	lea    0x10(%rax),%rdx
+    27d4:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    27d8:	|      48 01 d0             	add    %rdx,%rax
+    27db:	|      48 89 c6             	mov    %rax,%rsi
+    27de:	|      bf 00 01 00 00       	mov    $0x100,%edi
+    27e3:	|      e8 45 f2 ff ff       	call   1a2d <operator new(unsigned long, void*)>
+    27e8:	|      48 89 c3             	mov    %rax,%rbx
+    27eb:	|      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    27ef:	|      48 89 c7             	mov    %rax,%rdi
+    27f2:	|      e8 2c ff ff ff       	call   2723 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    27f7:	|      0f b6 00             	movzbl (%rax),%eax
+    27fa:	|      0f b6 c0             	movzbl %al,%eax
+    27fd:	|      89 c6                	mov    %eax,%esi
+    27ff:	|      48 89 df             	mov    %rbx,%rdi
+    2802:	|      e8 03 f4 ff ff       	call   1c0a <U8Buf<256ul>::U8Buf(unsigned char)>
+            len_ += 1;
+    2807:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    280b:	|      48 8b 40 08          	mov    0x8(%rax),%rax
+    280f:	|      48 8d 50 01          	lea    0x1(%rax),%rdx
+    2813:	|      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2817:	|      48 89 50 08          	mov    %rdx,0x8(%rax)
+            return Result<void, Type>::Ok();
+    281b:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    281f:	|      48 89 c7             	mov    %rax,%rdi
+    2822:	|      e8 4c 08 00 00       	call   3073 <nel::Result<void, U8Buf<256ul> >::Ok()>
+        }
+    2827:	\----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    282b:	       48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    282f:	       c9                   	leave
+    2830:	       c3                   	ret
+    2831:	       90                   	nop
+
+0000000000002832 <nel::Slice<U8Buf<256ul> >::ptr() const>:
+        constexpr Type *ptr(void) const
+    2832:	55                   	push   %rbp
+    2833:	48 89 e5             	mov    %rsp,%rbp
+    2836:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return content_;
+    283a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    283e:	48 8b 00             	mov    (%rax),%rax
+        }
+    2841:	5d                   	pop    %rbp
+    2842:	c3                   	ret
+    2843:	90                   	nop
+
+0000000000002844 <nel::Slice<U8Buf<256ul> >::len() const>:
+        constexpr Length len(void) const
+    2844:	55                   	push   %rbp
+    2845:	48 89 e5             	mov    %rsp,%rbp
+    2848:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    284c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2850:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    2854:	5d                   	pop    %rbp
+    2855:	c3                   	ret
+
+0000000000002856 <nel::SliceIterator<U8Buf<256ul> >::SliceIterator(U8Buf<256ul>*, unsigned long)>:
+        constexpr SliceIterator(T arr[], Count len)
+    2856:	55                   	push   %rbp
+    2857:	48 89 e5             	mov    %rsp,%rbp
+    285a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    285e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2862:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : b_(arr)
+    2866:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    286a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    286e:	48 89 10             	mov    %rdx,(%rax)
+            , e_(arr + len)
+    2871:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2875:	48 c1 e0 08          	shl    $0x8,%rax
+    2879:	48 89 c2             	mov    %rax,%rdx
+    287c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2880:	48 01 c2             	add    %rax,%rdx
+    2883:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2887:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    288b:	90                   	nop
+    288c:	5d                   	pop    %rbp
+    288d:	c3                   	ret
+
+000000000000288e <nel::Slice<U8Buf<256ul> >::Slice()>:
+        constexpr Slice(void)
+    288e:	55                   	push   %rbp
+    288f:	48 89 e5             	mov    %rsp,%rbp
+    2892:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : content_(nullptr)
+    2896:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    289a:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+            , len_(0)
+    28a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28a5:	48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    28ac:	00 
+        }
+    28ad:	90                   	nop
+    28ae:	5d                   	pop    %rbp
+    28af:	c3                   	ret
+
+00000000000028b0 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::len() const>:
+        constexpr Length len(void) const
+    28b0:	55                   	push   %rbp
+    28b1:	48 89 e5             	mov    %rsp,%rbp
+    28b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    28b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28bc:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    28c0:	5d                   	pop    %rbp
+    28c1:	c3                   	ret
+
+00000000000028c2 <nel::Slice<U8Buf<256ul> >::Slice(U8Buf<256ul>*, unsigned long)>:
+        constexpr Slice(Type *const p, Length len)
+    28c2:	55                   	push   %rbp
+    28c3:	48 89 e5             	mov    %rsp,%rbp
+    28c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    28ca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    28ce:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : content_(p)
+    28d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28d6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    28da:	48 89 10             	mov    %rdx,(%rax)
+            , len_(len)
+    28dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28e1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    28e5:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    28e9:	90                   	nop
+    28ea:	5d                   	pop    %rbp
+    28eb:	c3                   	ret
+
+00000000000028ec <U8Buf<256ul>::len() const>:
+        constexpr Length len(void) const
+    28ec:	55                   	push   %rbp
+    28ed:	48 89 e5             	mov    %rsp,%rbp
+    28f0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return N;
+    28f4:	b8 00 01 00 00       	mov    $0x100,%eax
+        }
+    28f9:	5d                   	pop    %rbp
+    28fa:	c3                   	ret
+    28fb:	90                   	nop
+
+00000000000028fc <nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::self()>:
+        constexpr ItT &self(void)
+    28fc:	55                   	push   %rbp
+    28fd:	48 89 e5             	mov    %rsp,%rbp
+    2900:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    2904:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2908:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    290c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    2910:	5d                   	pop    %rbp
+    2911:	c3                   	ret
+
+0000000000002912 <nel::Element<nel::heaped::AllocError>::Element(nel::heaped::AllocError&&)>:
+        constexpr Element &operator=(Element const &) const = delete;
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+    2912:	55                   	push   %rbp
+    2913:	48 89 e5             	mov    %rsp,%rbp
+    2916:	48 83 ec 10          	sub    $0x10,%rsp
+    291a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    291e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Type>(val))
+    2922:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2926:	48 89 c7             	mov    %rax,%rdi
+    2929:	e8 b5 f9 ff ff       	call   22e3 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    292e:	8b 10                	mov    (%rax),%edx
+    2930:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2934:	89 10                	mov    %edx,(%rax)
+        {
+        }
+    2936:	90                   	nop
+    2937:	c9                   	leave
+    2938:	c3                   	ret
+    2939:	90                   	nop
+
+000000000000293a <nel::Element<void*>::Element<void* const&>(void* const&)>:
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+    293a:	55                   	push   %rbp
+    293b:	48 89 e5             	mov    %rsp,%rbp
+    293e:	48 83 ec 10          	sub    $0x10,%rsp
+    2942:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2946:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            : value_(forward<Args>(args)...)
+    294a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    294e:	48 89 c7             	mov    %rax,%rdi
+    2951:	e8 dd f9 ff ff       	call   2333 <void* const& nel::forward<void* const&, void* const>(void* const&)>
+    2956:	48 8b 10             	mov    (%rax),%rdx
+    2959:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    295d:	48 89 10             	mov    %rdx,(%rax)
+        {
+        }
+    2960:	90                   	nop
+    2961:	c9                   	leave
+    2962:	c3                   	ret
+    2963:	90                   	nop
+
+0000000000002964 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>:
+            return match<bool>([](T const &) -> bool { return false; },
+    2964:	55                   	push   %rbp
+    2965:	48 89 e5             	mov    %rsp,%rbp
+    2968:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    296c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2970:	b8 00 00 00 00       	mov    $0x0,%eax
+    2975:	5d                   	pop    %rbp
+    2976:	c3                   	ret
+    2977:	90                   	nop
+
+0000000000002978 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>:
+                               [](E const &) -> bool { return true; },
+    2978:	55                   	push   %rbp
+    2979:	48 89 e5             	mov    %rsp,%rbp
+    297c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2980:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2984:	b8 01 00 00 00       	mov    $0x1,%eax
+    2989:	5d                   	pop    %rbp
+    298a:	c3                   	ret
+    298b:	90                   	nop
+
+000000000000298c <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>:
+        constexpr bool is_err(Context const &ctx = Context()) const
+    298c:	55                   	push   %rbp
+    298d:	48 89 e5             	mov    %rsp,%rbp
+    2990:	48 83 ec 20          	sub    $0x20,%rsp
+    2994:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2998:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return match<bool>([](T const &) -> bool { return false; },
+    299c:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    29a0:	48 8d 55 fe          	lea    -0x2(%rbp),%rdx
+    29a4:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    29a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    29ac:	48 89 c7             	mov    %rax,%rdi
+    29af:	e8 02 00 00 00       	call   29b6 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>
+        }
+    29b4:	c9                   	leave
+    29b5:	c3                   	ret
+
+00000000000029b6 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const>:
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    29b6:	             55                   	push   %rbp
+    29b7:	             48 89 e5             	mov    %rsp,%rbp
+    29ba:	             48 83 ec 20          	sub    $0x20,%rsp
+    29be:	             48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    29c2:	             48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    29c6:	             48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    29ca:	             48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+            switch (tag_) { // result-match
+    29ce:	             48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29d2:	             8b 00                	mov    (%rax),%eax
+    29d4:	             83 f8 02             	cmp    $0x2,%eax
+    29d7:	         /-- 74 32                	je     2a0b <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x55>
+    29d9:	         |   83 f8 02             	cmp    $0x2,%eax
+    29dc:	/--------|-- 7f 67                	jg     2a45 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+    29de:	|        |   85 c0                	test   %eax,%eax
+    29e0:	|     /--|-- 74 4d                	je     2a2f <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x79>
+    29e2:	|     |  |   83 f8 01             	cmp    $0x1,%eax
+    29e5:	+-----|--|-- 75 5e                	jne    2a45 <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0x8f>
+                    return on_ok(*ok_);
+    29e7:	|     |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29eb:	|     |  |   48 83 c0 08          	add    $0x8,%rax
+    29ef:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    29f2:	|     |  |   e8 f7 06 00 00       	call   30ee <nel::Element<void*>::operator*() const>
+    29f7:	|     |  |   48 89 c2             	mov    %rax,%rdx
+    29fa:	|     |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    29fe:	|     |  |   48 89 d6             	mov    %rdx,%rsi
+    2a01:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    2a04:	|     |  |   e8 5b ff ff ff       	call   2964 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}::operator()(void* const&) const>
+    2a09:	|  /--|--|-- eb 50                	jmp    2a5b <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    return on_err(*err_);
+    2a0b:	|  |  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a0f:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    2a13:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2a16:	|  |  |      e8 ed 06 00 00       	call   3108 <nel::Element<nel::heaped::AllocError>::operator*() const>
+    2a1b:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    2a1e:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a22:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    2a25:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2a28:	|  |  |      e8 4b ff ff ff       	call   2978 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}::operator()(nel::heaped::AllocError const&) const>
+    2a2d:	|  +--|----- eb 2c                	jmp    2a5b <bool nel::Result<void*, nel::heaped::AllocError>::match<bool, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}>(nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(void* const&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const::{lambda(nel::heaped::AllocError const&)#2}&&, nel::Context const&) const+0xa5>
+                    nel::panic("invalid Result", ctx);
+    2a2f:	|  |  \----> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a33:	|  |         48 89 c6             	mov    %rax,%rsi
+    2a36:	|  |         48 8d 05 97 26 00 00 	lea    0x2697(%rip),%rax        # 50d4 <nel::sort::ninther_n+0xb4>
+    2a3d:	|  |         48 89 c7             	mov    %rax,%rdi
+    2a40:	|  |         e8 6e 0c 00 00       	call   36b3 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    2a45:	\--|-------> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a49:	   |         48 89 c6             	mov    %rax,%rsi
+    2a4c:	   |         48 8d 05 61 26 00 00 	lea    0x2661(%rip),%rax        # 50b4 <nel::sort::ninther_n+0x94>
+    2a53:	   |         48 89 c7             	mov    %rax,%rdi
+    2a56:	   |         e8 58 0c 00 00       	call   36b3 <nel::panic(char const*, nel::Context const&)>
+        }
+    2a5b:	   \-------> c9                   	leave
+    2a5c:	             c3                   	ret
+
+0000000000002a5d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)>:
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    2a5d:	          55                   	push   %rbp
+    2a5e:	          48 89 e5             	mov    %rsp,%rbp
+    2a61:	          41 54                	push   %r12
+    2a63:	          53                   	push   %rbx
+    2a64:	          48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+    2a6b:	          48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+    2a72:	          48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+            if (new_cap > max_capacity) { return nullptr; }
+    2a79:	          48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    2a80:	          ff 7f 00 
+    2a83:	          48 3b 85 60 ff ff ff 	cmp    -0xa0(%rbp),%rax
+    2a8a:	      /-- 73 0a                	jae    2a96 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x39>
+    2a8c:	      |   bb 00 00 00 00       	mov    $0x0,%ebx
+    2a91:	/-----|-- e9 d8 01 00 00       	jmp    2c6e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x211>
+            Length const new_sz = size_of(new_cap);
+    2a96:	|     \-> 48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+    2a9d:	|         48 89 c7             	mov    %rax,%rdi
+    2aa0:	|         e8 7d f9 ff ff       	call   2422 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::size_of(unsigned long)>
+    2aa5:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            Length const old_sz = (old_n == nullptr) ? 0 : size_of(old_n->alloc_);
+    2aa9:	|         48 83 bd 68 ff ff ff 	cmpq   $0x0,-0x98(%rbp)
+    2ab0:	|         00 
+    2ab1:	|  /----- 74 14                	je     2ac7 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x6a>
+    2ab3:	|  |      48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2aba:	|  |      48 8b 00             	mov    (%rax),%rax
+    2abd:	|  |      48 89 c7             	mov    %rax,%rdi
+    2ac0:	|  |      e8 5d f9 ff ff       	call   2422 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::size_of(unsigned long)>
+    2ac5:	|  |  /-- eb 05                	jmp    2acc <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x6f>
+    2ac7:	|  \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    2acc:	|     \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+                auto r = Allocator::try_malloc(alignof(Node), new_sz);
+    2ad0:	|         48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    2ad7:	|         48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2adb:	|         be 08 00 00 00       	mov    $0x8,%esi
+    2ae0:	|         48 89 c7             	mov    %rax,%rdi
+    2ae3:	|         e8 c5 ef ff ff       	call   1aad <nel::heaped::Malloc::try_malloc(unsigned long, unsigned long)>
+                if (r.is_err()) { return nullptr; }
+    2ae8:	|         48 8d 45 80          	lea    -0x80(%rbp),%rax
+    2aec:	|         b9 8e 00 00 00       	mov    $0x8e,%ecx
+    2af1:	|         48 8d 15 eb 25 00 00 	lea    0x25eb(%rip),%rdx        # 50e3 <nel::sort::ninther_n+0xc3>
+    2af8:	|         48 8d 35 fb 25 00 00 	lea    0x25fb(%rip),%rsi        # 50fa <nel::sort::ninther_n+0xda>
+    2aff:	|         48 89 c7             	mov    %rax,%rdi
+    2b02:	|         e8 39 ef ff ff       	call   1a40 <nel::Context::Context(char const*, char const*, int)>
+    2b07:	|         48 8d 55 80          	lea    -0x80(%rbp),%rdx
+    2b0b:	|         48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    2b12:	|         48 89 d6             	mov    %rdx,%rsi
+    2b15:	|         48 89 c7             	mov    %rax,%rdi
+    2b18:	|         e8 6f fe ff ff       	call   298c <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const>
+    2b1d:	|         84 c0                	test   %al,%al
+    2b1f:	|     /-- 74 10                	je     2b31 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0xd4>
+    2b21:	|     |   bb 00 00 00 00       	mov    $0x0,%ebx
+    2b26:	|     |   41 bc 00 00 00 00    	mov    $0x0,%r12d
+    2b2c:	|  /--|-- e9 ed 00 00 00       	jmp    2c1e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x1c1>
+                new_n = reinterpret_cast<Node *>(r.unwrap());
+    2b31:	|  |  \-> 48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    2b35:	|  |      b9 8f 00 00 00       	mov    $0x8f,%ecx
+    2b3a:	|  |      48 8d 15 a2 25 00 00 	lea    0x25a2(%rip),%rdx        # 50e3 <nel::sort::ninther_n+0xc3>
+    2b41:	|  |      48 8d 35 b2 25 00 00 	lea    0x25b2(%rip),%rsi        # 50fa <nel::sort::ninther_n+0xda>
+    2b48:	|  |      48 89 c7             	mov    %rax,%rdi
+    2b4b:	|  |      e8 f0 ee ff ff       	call   1a40 <nel::Context::Context(char const*, char const*, int)>
+    2b50:	|  |      48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    2b54:	|  |      48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    2b5b:	|  |      48 89 d6             	mov    %rdx,%rsi
+    2b5e:	|  |      48 89 c7             	mov    %rax,%rdi
+    2b61:	|  |      e8 08 06 00 00       	call   316e <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+    2b66:	|  |      48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                if (old_n != nullptr) {
+    2b6a:	|  |      48 83 bd 68 ff ff ff 	cmpq   $0x0,-0x98(%rbp)
+    2b71:	|  |      00 
+    2b72:	|  |  /-- 0f 84 a0 00 00 00    	je     2c18 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x1bb>
+                    nel::assert(old_n->len_ <= new_cap, "heaped::Node: shrinking below len");
+    2b78:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    2b7c:	|  |  |   b9 91 00 00 00       	mov    $0x91,%ecx
+    2b81:	|  |  |   48 8d 15 5b 25 00 00 	lea    0x255b(%rip),%rdx        # 50e3 <nel::sort::ninther_n+0xc3>
+    2b88:	|  |  |   48 8d 35 6b 25 00 00 	lea    0x256b(%rip),%rsi        # 50fa <nel::sort::ninther_n+0xda>
+    2b8f:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2b92:	|  |  |   e8 a9 ee ff ff       	call   1a40 <nel::Context::Context(char const*, char const*, int)>
+    2b97:	|  |  |   48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2b9e:	|  |  |   48 8b 40 08          	mov    0x8(%rax),%rax
+    2ba2:	|  |  |   48 39 85 60 ff ff ff 	cmp    %rax,-0xa0(%rbp)
+    2ba9:	|  |  |   0f 93 c0             	setae  %al
+    2bac:	|  |  |   0f b6 c0             	movzbl %al,%eax
+    2baf:	|  |  |   48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+    2bb3:	|  |  |   48 8d 0d 4e 25 00 00 	lea    0x254e(%rip),%rcx        # 5108 <nel::sort::ninther_n+0xe8>
+    2bba:	|  |  |   48 89 ce             	mov    %rcx,%rsi
+    2bbd:	|  |  |   89 c7                	mov    %eax,%edi
+    2bbf:	|  |  |   e8 b3 ee ff ff       	call   1a77 <nel::assert(bool, char const*, nel::Context const&)>
+                    new_n->len_ = old_n->len_;
+    2bc4:	|  |  |   48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2bcb:	|  |  |   48 8b 50 08          	mov    0x8(%rax),%rdx
+    2bcf:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2bd3:	|  |  |   48 89 50 08          	mov    %rdx,0x8(%rax)
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    2bd7:	|  |  |   48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2bde:	|  |  |   48 8b 40 08          	mov    0x8(%rax),%rax
+    2be2:	|  |  |   48 8b 95 68 ff ff ff 	mov    -0x98(%rbp),%rdx
+    2be9:	|  |  |   48 8d 72 10          	lea    0x10(%rdx),%rsi
+    2bed:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2bf1:	|  |  |   48 8d 4a 10          	lea    0x10(%rdx),%rcx
+    2bf5:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    2bf8:	|  |  |   48 89 cf             	mov    %rcx,%rdi
+    2bfb:	|  |  |   e8 a0 05 00 00       	call   31a0 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)>
+                    Allocator::free(old_n, alignof(Node), old_sz);
+    2c00:	|  |  |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2c04:	|  |  |   48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+    2c0b:	|  |  |   be 08 00 00 00       	mov    $0x8,%esi
+    2c10:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    2c13:	|  |  |   e8 9f ef ff ff       	call   1bb7 <nel::heaped::Malloc::free(void*, unsigned long, unsigned long)>
+            }
+    2c18:	|  |  \-> 41 bc 01 00 00 00    	mov    $0x1,%r12d
+    2c1e:	|  \----> 48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+    2c25:	|         48 89 c7             	mov    %rax,%rdi
+    2c28:	|         e8 ab f0 ff ff       	call   1cd8 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+    2c2d:	|         41 83 fc 01          	cmp    $0x1,%r12d
+    2c31:	+-------- 75 3b                	jne    2c6e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x211>
+    2c33:	|         90                   	nop
+                if (new_sz > old_sz) {
+    2c34:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2c38:	|         48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    2c3c:	|     /-- 73 1e                	jae    2c5c <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x1ff>
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+    2c3e:	|     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2c42:	|     |   48 2b 45 d8          	sub    -0x28(%rbp),%rax
+    2c46:	|     |   48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    2c4a:	|     |   48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2c4e:	|     |   48 01 ca             	add    %rcx,%rdx
+    2c51:	|     |   48 89 c6             	mov    %rax,%rsi
+    2c54:	|     |   48 89 d7             	mov    %rdx,%rdi
+    2c57:	|     |   e8 d8 0b 00 00       	call   3834 <nel::elem::wipe(unsigned char*, unsigned long)>
+            new_n->alloc_ = new_cap;
+    2c5c:	|     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c60:	|         48 8b 95 60 ff ff ff 	mov    -0xa0(%rbp),%rdx
+    2c67:	|         48 89 10             	mov    %rdx,(%rax)
+            return new_n;
+    2c6a:	|         48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+        }
+    2c6e:	\-------> 48 89 d8             	mov    %rbx,%rax
+    2c71:	          48 81 c4 90 00 00 00 	add    $0x90,%rsp
+    2c78:	          5b                   	pop    %rbx
+    2c79:	          41 5c                	pop    %r12
+    2c7b:	          5d                   	pop    %rbp
+    2c7c:	          c3                   	ret
+
+0000000000002c7d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*&& nel::move<nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*>(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*&)>:
+constexpr T &&move(T &v)
+    2c7d:	55                   	push   %rbp
+    2c7e:	48 89 e5             	mov    %rsp,%rbp
+    2c81:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<T &&>(v);
+    2c85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2c89:	5d                   	pop    %rbp
+    2c8a:	c3                   	ret
+    2c8b:	90                   	nop
+
+0000000000002c8c <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::~Node()>:
+        constexpr ~Node(void)
+    2c8c:	       55                   	push   %rbp
+    2c8d:	       48 89 e5             	mov    %rsp,%rbp
+    2c90:	       48 83 ec 20          	sub    $0x20,%rsp
+    2c94:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            for (Index i = 0; i < len(); ++i) {
+    2c98:	       48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    2c9f:	       00 
+    2ca0:	   /-- eb 20                	jmp    2cc2 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::~Node()+0x36>
+                values_[i].~Type();
+    2ca2:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ca6:	|  |   48 c1 e0 08          	shl    $0x8,%rax
+    2caa:	|  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    2cae:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2cb2:	|  |   48 01 d0             	add    %rdx,%rax
+    2cb5:	|  |   48 89 c7             	mov    %rax,%rdi
+    2cb8:	|  |   e8 11 f2 ff ff       	call   1ece <U8Buf<256ul>::~U8Buf()>
+            for (Index i = 0; i < len(); ++i) {
+    2cbd:	|  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    2cc2:	|  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2cc6:	|      48 89 c7             	mov    %rax,%rdi
+    2cc9:	|      e8 e2 fb ff ff       	call   28b0 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::len() const>
+    2cce:	|      48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2cd2:	|      0f 92 c0             	setb   %al
+    2cd5:	|      84 c0                	test   %al,%al
+    2cd7:	\----- 75 c9                	jne    2ca2 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::~Node()+0x16>
+        }
+    2cd9:	       90                   	nop
+    2cda:	       90                   	nop
+    2cdb:	       c9                   	leave
+    2cdc:	       c3                   	ret
+    2cdd:	       90                   	nop
+
+0000000000002cde <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::slice() const>:
+        constexpr Slice<Type const> slice(void) const
+    2cde:	55                   	push   %rbp
+    2cdf:	48 89 e5             	mov    %rsp,%rbp
+    2ce2:	48 83 ec 10          	sub    $0x10,%rsp
+    2ce6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2cea:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            return Slice(values_, len());
+    2cee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2cf2:	48 89 c7             	mov    %rax,%rdi
+    2cf5:	e8 b6 fb ff ff       	call   28b0 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::len() const>
+    2cfa:	48 89 c2             	mov    %rax,%rdx
+    2cfd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2d01:	48 8d 48 10          	lea    0x10(%rax),%rcx
+    2d05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d09:	48 89 ce             	mov    %rcx,%rsi
+    2d0c:	48 89 c7             	mov    %rax,%rdi
+    2d0f:	e8 c4 05 00 00       	call   32d8 <nel::Slice<U8Buf<256ul> const>::Slice(U8Buf<256ul> const*, unsigned long)>
+        }
+    2d14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d18:	c9                   	leave
+    2d19:	c3                   	ret
+
+0000000000002d1a <nel::Slice<U8Buf<256ul> const>::iter() const>:
+        constexpr Iterator iter(void) const
+    2d1a:	55                   	push   %rbp
+    2d1b:	48 89 e5             	mov    %rsp,%rbp
+    2d1e:	53                   	push   %rbx
+    2d1f:	48 83 ec 18          	sub    $0x18,%rsp
+    2d23:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2d27:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            return Iterator(ptr(), len());
+    2d2b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2d2f:	48 89 c7             	mov    %rax,%rdi
+    2d32:	e8 dd 05 00 00       	call   3314 <nel::Slice<U8Buf<256ul> const>::len() const>
+    2d37:	48 89 c3             	mov    %rax,%rbx
+    2d3a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2d3e:	48 89 c7             	mov    %rax,%rdi
+    2d41:	e8 bc 05 00 00       	call   3302 <nel::Slice<U8Buf<256ul> const>::ptr() const>
+    2d46:	48 89 c1             	mov    %rax,%rcx
+    2d49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d4d:	48 89 da             	mov    %rbx,%rdx
+    2d50:	48 89 ce             	mov    %rcx,%rsi
+    2d53:	48 89 c7             	mov    %rax,%rdi
+    2d56:	e8 cb 05 00 00       	call   3326 <nel::SliceIterator<U8Buf<256ul> const>::SliceIterator(U8Buf<256ul> const*, unsigned long)>
+        }
+    2d5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d5f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2d63:	c9                   	leave
+    2d64:	c3                   	ret
+    2d65:	90                   	nop
+
+0000000000002d66 <nel::SliceIterator<U8Buf<256ul> const>::is_done() const>:
+        constexpr bool is_done(void) const
+    2d66:	55                   	push   %rbp
+    2d67:	48 89 e5             	mov    %rsp,%rbp
+    2d6a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (b_ == e_);
+    2d6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d72:	48 8b 10             	mov    (%rax),%rdx
+    2d75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d79:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2d7d:	48 39 c2             	cmp    %rax,%rdx
+    2d80:	0f 94 c0             	sete   %al
+        }
+    2d83:	5d                   	pop    %rbp
+    2d84:	c3                   	ret
+    2d85:	90                   	nop
+
+0000000000002d86 <nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}::operator()(U8Buf<256ul> const&) const>:
+                //     ++i;
+                // });
+#        if defined(RUST_LIKE)
+                it2.for_each2([&outs](OutT const &e) { outs << ',' << e; });
+#        elif defined(C_LIKE)
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    2d86:	55                   	push   %rbp
+    2d87:	48 89 e5             	mov    %rsp,%rbp
+    2d8a:	48 83 ec 10          	sub    $0x10,%rsp
+    2d8e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2d92:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2d96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d9a:	48 8b 00             	mov    (%rax),%rax
+    2d9d:	be 2c 00 00 00       	mov    $0x2c,%esi
+    2da2:	48 89 c7             	mov    %rax,%rdi
+    2da5:	e8 df 11 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+    2daa:	48 89 c2             	mov    %rax,%rdx
+    2dad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2db1:	48 89 c6             	mov    %rax,%rsi
+    2db4:	48 89 d7             	mov    %rdx,%rdi
+    2db7:	e8 02 f4 ff ff       	call   21be <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    2dbc:	90                   	nop
+    2dbd:	c9                   	leave
+    2dbe:	c3                   	ret
+
+0000000000002dbf <nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)>:
+        friend Log &operator<<(Log &outs, ItT const &it)
+    2dbf:	    55                   	push   %rbp
+    2dc0:	    48 89 e5             	mov    %rsp,%rbp
+    2dc3:	    48 83 ec 30          	sub    $0x30,%rsp
+    2dc7:	    48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    2dcb:	    48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+            outs << '[';
+    2dcf:	    48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2dd3:	    be 5b 00 00 00       	mov    $0x5b,%esi
+    2dd8:	    48 89 c7             	mov    %rax,%rdi
+    2ddb:	    e8 a9 11 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+            ItT it2 = it;
+    2de0:	    48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2de4:	    48 8b 50 08          	mov    0x8(%rax),%rdx
+    2de8:	    48 8b 00             	mov    (%rax),%rax
+    2deb:	    48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2def:	    48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            if (!it2.is_done()) {
+    2df3:	    48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2df7:	    48 89 c7             	mov    %rax,%rdi
+    2dfa:	    e8 67 ff ff ff       	call   2d66 <nel::SliceIterator<U8Buf<256ul> const>::is_done() const>
+    2dff:	    83 f0 01             	xor    $0x1,%eax
+    2e02:	    84 c0                	test   %al,%al
+    2e04:	/-- 74 45                	je     2e4b <nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)+0x8c>
+                outs << it2.deref();
+    2e06:	|   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2e0a:	|   48 89 c7             	mov    %rax,%rdi
+    2e0d:	|   e8 4c 05 00 00       	call   335e <nel::SliceIterator<U8Buf<256ul> const>::deref()>
+    2e12:	|   48 89 c2             	mov    %rax,%rdx
+    2e15:	|   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2e19:	|   48 89 d6             	mov    %rdx,%rsi
+    2e1c:	|   48 89 c7             	mov    %rax,%rdi
+    2e1f:	|   e8 9a f3 ff ff       	call   21be <operator<<(nel::Log&, U8Buf<256ul> const&)>
+                it2.inc();
+    2e24:	|   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2e28:	|   48 89 c7             	mov    %rax,%rdi
+    2e2b:	|   e8 40 05 00 00       	call   3370 <nel::SliceIterator<U8Buf<256ul> const>::inc()>
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    2e30:	|   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2e34:	|   48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2e38:	|   48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+    2e3c:	|   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    2e40:	|   48 89 d6             	mov    %rdx,%rsi
+    2e43:	|   48 89 c7             	mov    %rax,%rdi
+    2e46:	|   e8 45 05 00 00       	call   3390 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}>(nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}&&)>
+#        endif
+            }
+#    endif
+            outs << ']';
+    2e4b:	\-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2e4f:	    be 5d 00 00 00       	mov    $0x5d,%esi
+    2e54:	    48 89 c7             	mov    %rax,%rdi
+    2e57:	    e8 2d 11 00 00       	call   3f89 <nel::operator<<(nel::Log&, char)>
+
+            return outs;
+    2e5c:	    48 8b 45 d8          	mov    -0x28(%rbp),%rax
+        }
+    2e60:	    c9                   	leave
+    2e61:	    c3                   	ret
+
+0000000000002e62 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>:
+        constexpr Count capacity(void) const
+    2e62:	       55                   	push   %rbp
+    2e63:	       48 89 e5             	mov    %rsp,%rbp
+    2e66:	       48 83 ec 10          	sub    $0x10,%rsp
+    2e6a:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return (item_ == nullptr) ? 0 : item_->capacity();
+    2e6e:	       48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e72:	       48 8b 00             	mov    (%rax),%rax
+    2e75:	       48 85 c0             	test   %rax,%rax
+    2e78:	/----- 74 11                	je     2e8b <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x29>
+    2e7a:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e7e:	|      48 8b 00             	mov    (%rax),%rax
+    2e81:	|      48 89 c7             	mov    %rax,%rdi
+    2e84:	|      e8 ad 01 00 00       	call   3036 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::capacity() const>
+    2e89:	|  /-- eb 05                	jmp    2e90 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const+0x2e>
+    2e8b:	\--|-> b8 00 00 00 00       	mov    $0x0,%eax
+        }
+    2e90:	   \-> c9                   	leave
+    2e91:	       c3                   	ret
+
+0000000000002e92 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)>:
+        bool try_reserve(Count new_cap)
+    2e92:	             55                   	push   %rbp
+    2e93:	             48 89 e5             	mov    %rsp,%rbp
+    2e96:	             48 83 ec 20          	sub    $0x20,%rsp
+    2e9a:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2e9e:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            new_cap = Growth::capacity_for(capacity(), new_cap);
+    2ea2:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ea6:	             48 89 c7             	mov    %rax,%rdi
+    2ea9:	             e8 b4 ff ff ff       	call   2e62 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::capacity() const>
+    2eae:	             48 89 c2             	mov    %rax,%rdx
+    2eb1:	             48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2eb5:	             48 89 c6             	mov    %rax,%rsi
+    2eb8:	             48 89 d7             	mov    %rdx,%rdi
+    2ebb:	             e8 3b 05 00 00       	call   33fb <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>
+    2ec0:	             48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (new_cap < len()) { new_cap = len(); }
+    2ec4:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ec8:	             48 89 c7             	mov    %rax,%rdi
+    2ecb:	             e8 b4 f5 ff ff       	call   2484 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    2ed0:	             48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    2ed4:	             0f 92 c0             	setb   %al
+    2ed7:	             84 c0                	test   %al,%al
+    2ed9:	         /-- 74 10                	je     2eeb <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x59>
+    2edb:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2edf:	         |   48 89 c7             	mov    %rax,%rdi
+    2ee2:	         |   e8 9d f5 ff ff       	call   2484 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::len() const>
+    2ee7:	         |   48 89 45 e0          	mov    %rax,-0x20(%rbp)
+            if (item_ == nullptr) {
+    2eeb:	         \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2eef:	             48 8b 00             	mov    (%rax),%rax
+    2ef2:	             48 85 c0             	test   %rax,%rax
+    2ef5:	         /-- 75 2d                	jne    2f24 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x92>
+                item_ = VectorNode::malloc(new_cap);
+    2ef7:	         |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2efb:	         |   48 89 c7             	mov    %rax,%rdi
+    2efe:	         |   e8 97 f4 ff ff       	call   239a <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::malloc(unsigned long)>
+    2f03:	         |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2f07:	         |   48 89 02             	mov    %rax,(%rdx)
+                if (item_ == nullptr) { return false; }
+    2f0a:	         |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f0e:	         |   48 8b 00             	mov    (%rax),%rax
+    2f11:	         |   48 85 c0             	test   %rax,%rax
+    2f14:	/--------|-- 0f 85 c4 00 00 00    	jne    2fde <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+    2f1a:	|        |   b8 00 00 00 00       	mov    $0x0,%eax
+    2f1f:	|  /-----|-- e9 bf 00 00 00       	jmp    2fe3 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+            } else if (new_cap == item_->capacity()) {
+    2f24:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f28:	|  |         48 8b 00             	mov    (%rax),%rax
+    2f2b:	|  |         48 89 c7             	mov    %rax,%rdi
+    2f2e:	|  |         e8 03 01 00 00       	call   3036 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::capacity() const>
+    2f33:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    2f37:	|  |         0f 94 c0             	sete   %al
+    2f3a:	|  |         84 c0                	test   %al,%al
+    2f3c:	+--|-------- 0f 85 9c 00 00 00    	jne    2fde <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap > item_->capacity()) {
+    2f42:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f46:	|  |         48 8b 00             	mov    (%rax),%rax
+    2f49:	|  |         48 89 c7             	mov    %rax,%rdi
+    2f4c:	|  |         e8 e5 00 00 00       	call   3036 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::capacity() const>
+    2f51:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    2f55:	|  |         0f 92 c0             	setb   %al
+    2f58:	|  |         84 c0                	test   %al,%al
+    2f5a:	|  |  /----- 74 35                	je     2f91 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xff>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    2f5c:	|  |  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f60:	|  |  |      48 8b 00             	mov    (%rax),%rax
+    2f63:	|  |  |      48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2f67:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    2f6a:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    2f6d:	|  |  |      e8 eb fa ff ff       	call   2a5d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)>
+    2f72:	|  |  |      48 89 45 f0          	mov    %rax,-0x10(%rbp)
+                if (p == nullptr) { return false; }
+    2f76:	|  |  |      48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2f7b:	|  |  |  /-- 75 07                	jne    2f84 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0xf2>
+    2f7d:	|  |  |  |   b8 00 00 00 00       	mov    $0x0,%eax
+    2f82:	|  +--|--|-- eb 5f                	jmp    2fe3 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    2f84:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f88:	|  |  |      48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2f8c:	|  |  |      48 89 10             	mov    %rdx,(%rax)
+    2f8f:	+--|--|----- eb 4d                	jmp    2fde <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+            } else if (new_cap < item_->capacity()) {
+    2f91:	|  |  \----> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f95:	|  |         48 8b 00             	mov    (%rax),%rax
+    2f98:	|  |         48 89 c7             	mov    %rax,%rdi
+    2f9b:	|  |         e8 96 00 00 00       	call   3036 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::capacity() const>
+    2fa0:	|  |         48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+    2fa4:	|  |         0f 92 c0             	setb   %al
+    2fa7:	|  |         84 c0                	test   %al,%al
+    2fa9:	+--|-------- 74 33                	je     2fde <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x14c>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    2fab:	|  |         48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2faf:	|  |         48 8b 00             	mov    (%rax),%rax
+    2fb2:	|  |         48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2fb6:	|  |         48 89 d6             	mov    %rdx,%rsi
+    2fb9:	|  |         48 89 c7             	mov    %rax,%rdi
+    2fbc:	|  |         e8 9c fa ff ff       	call   2a5d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)>
+    2fc1:	|  |         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+                if (p == nullptr) { return false; }
+    2fc5:	|  |         48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2fca:	|  |     /-- 75 07                	jne    2fd3 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x141>
+    2fcc:	|  |     |   b8 00 00 00 00       	mov    $0x0,%eax
+    2fd1:	|  +-----|-- eb 10                	jmp    2fe3 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve(unsigned long)+0x151>
+                item_ = p;
+    2fd3:	|  |     \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2fd7:	|  |         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2fdb:	|  |         48 89 10             	mov    %rdx,(%rax)
+            return true;
+    2fde:	\--|-------> b8 01 00 00 00       	mov    $0x1,%eax
+        }
+    2fe3:	   \-------> c9                   	leave
+    2fe4:	             c3                   	ret
+
+0000000000002fe5 <U8Buf<256ul>& nel::forward<U8Buf<256ul>&, U8Buf<256ul> >(U8Buf<256ul>&)>:
+constexpr U &&forward(T &t)
+    2fe5:	55                   	push   %rbp
+    2fe6:	48 89 e5             	mov    %rsp,%rbp
+    2fe9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    2fed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2ff1:	5d                   	pop    %rbp
+    2ff2:	c3                   	ret
+    2ff3:	90                   	nop
+
+0000000000002ff4 <nel::Result<void, U8Buf<256ul> >::Result<U8Buf<256ul>&>(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)2>, U8Buf<256ul>&)>:
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+    2ff4:	55                   	push   %rbp
+    2ff5:	48 89 e5             	mov    %rsp,%rbp
+    2ff8:	53                   	push   %rbx
+    2ff9:	48 83 ec 18          	sub    $0x18,%rsp
+    2ffd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3001:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    3005:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3009:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<Args>(args)...)
+    300f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3013:	48 8d 58 04          	lea    0x4(%rax),%rbx
+    3017:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    301b:	48 89 c7             	mov    %rax,%rdi
+    301e:	e8 c2 ff ff ff       	call   2fe5 <U8Buf<256ul>& nel::forward<U8Buf<256ul>&, U8Buf<256ul> >(U8Buf<256ul>&)>
+    3023:	48 89 c6             	mov    %rax,%rsi
+    3026:	48 89 df             	mov    %rbx,%rdi
+    3029:	e8 1a 04 00 00       	call   3448 <nel::Element<U8Buf<256ul> >::Element<U8Buf<256ul>&>(U8Buf<256ul>&)>
+        }
+    302e:	90                   	nop
+    302f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3033:	c9                   	leave
+    3034:	c3                   	ret
+    3035:	90                   	nop
+
+0000000000003036 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::capacity() const>:
+        constexpr Count capacity(void) const
+    3036:	55                   	push   %rbp
+    3037:	48 89 e5             	mov    %rsp,%rbp
+    303a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return alloc_;
+    303e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3042:	48 8b 00             	mov    (%rax),%rax
+        }
+    3045:	5d                   	pop    %rbp
+    3046:	c3                   	ret
+    3047:	90                   	nop
+
+0000000000003048 <U8Buf<256ul>::U8Buf(U8Buf<256ul> const&)>:
+        constexpr U8Buf(U8Buf const &o)
+    3048:	55                   	push   %rbp
+    3049:	48 89 e5             	mov    %rsp,%rbp
+    304c:	48 83 ec 10          	sub    $0x10,%rsp
+    3050:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3054:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            nel::elem::copy(data_, o.data_, N);
+    3058:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    305c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3060:	ba 00 01 00 00       	mov    $0x100,%edx
+    3065:	48 89 ce             	mov    %rcx,%rsi
+    3068:	48 89 c7             	mov    %rax,%rdi
+    306b:	e8 f9 06 00 00       	call   3769 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        }
+    3070:	90                   	nop
+    3071:	c9                   	leave
+    3072:	c3                   	ret
+
+0000000000003073 <nel::Result<void, U8Buf<256ul> >::Ok()>:
+        constexpr static Result Ok(void)
+    3073:	55                   	push   %rbp
+    3074:	48 89 e5             	mov    %rsp,%rbp
+    3077:	48 83 ec 10          	sub    $0x10,%rsp
+    307b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return Result(Phantom<Tag::OK>());
+    307f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3083:	48 89 c7             	mov    %rax,%rdi
+    3086:	e8 f1 03 00 00       	call   347c <nel::Result<void, U8Buf<256ul> >::Result(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)1>)>
+        }
+    308b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    308f:	c9                   	leave
+    3090:	c3                   	ret
+    3091:	90                   	nop
+
+0000000000003092 <nel::Element<U8Buf<256ul> >::operator*() const>:
+        constexpr Type &ref(void)
+        {
+            return value_;
+        }
+
+        constexpr Type const &operator*(void) const
+    3092:	55                   	push   %rbp
+    3093:	48 89 e5             	mov    %rsp,%rbp
+    3096:	48 83 ec 10          	sub    $0x10,%rsp
+    309a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    309e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30a2:	48 89 c7             	mov    %rax,%rdi
+    30a5:	e8 e8 03 00 00       	call   3492 <nel::Element<U8Buf<256ul> >::ref() const>
+        }
+    30aa:	c9                   	leave
+    30ab:	c3                   	ret
+
+00000000000030ac <nel::Result<void, U8Buf<256ul> >::Result<unsigned char>(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)2>, unsigned char&&)>:
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+    30ac:	55                   	push   %rbp
+    30ad:	48 89 e5             	mov    %rsp,%rbp
+    30b0:	53                   	push   %rbx
+    30b1:	48 83 ec 18          	sub    $0x18,%rsp
+    30b5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    30b9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : tag_(Tag::ERR)
+    30bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    30c1:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+            , err_(forward<Args>(args)...)
+    30c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    30cb:	48 8d 58 04          	lea    0x4(%rax),%rbx
+    30cf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    30d3:	48 89 c7             	mov    %rax,%rdi
+    30d6:	e8 48 f6 ff ff       	call   2723 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    30db:	48 89 c6             	mov    %rax,%rsi
+    30de:	48 89 df             	mov    %rbx,%rdi
+    30e1:	e8 ba 03 00 00       	call   34a0 <nel::Element<U8Buf<256ul> >::Element<unsigned char>(unsigned char&&)>
+        }
+    30e6:	90                   	nop
+    30e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    30eb:	c9                   	leave
+    30ec:	c3                   	ret
+    30ed:	90                   	nop
+
+00000000000030ee <nel::Element<void*>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    30ee:	55                   	push   %rbp
+    30ef:	48 89 e5             	mov    %rsp,%rbp
+    30f2:	48 83 ec 10          	sub    $0x10,%rsp
+    30f6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    30fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30fe:	48 89 c7             	mov    %rax,%rdi
+    3101:	e8 d2 03 00 00       	call   34d8 <nel::Element<void*>::ref() const>
+        }
+    3106:	c9                   	leave
+    3107:	c3                   	ret
+
+0000000000003108 <nel::Element<nel::heaped::AllocError>::operator*() const>:
+        constexpr Type const &operator*(void) const
+    3108:	55                   	push   %rbp
+    3109:	48 89 e5             	mov    %rsp,%rbp
+    310c:	48 83 ec 10          	sub    $0x10,%rsp
+    3110:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    3114:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3118:	48 89 c7             	mov    %rax,%rdi
+    311b:	e8 c6 03 00 00       	call   34e6 <nel::Element<nel::heaped::AllocError>::ref() const>
+        }
+    3120:	c9                   	leave
+    3121:	c3                   	ret
+
+0000000000003122 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>:
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    3122:	55                   	push   %rbp
+    3123:	48 89 e5             	mov    %rsp,%rbp
+    3126:	48 83 ec 10          	sub    $0x10,%rsp
+    312a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    312e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3132:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3136:	48 89 c7             	mov    %rax,%rdi
+    3139:	e8 b6 03 00 00       	call   34f4 <void*&& nel::forward<void*, void*>(void*&)>
+    313e:	48 8b 00             	mov    (%rax),%rax
+    3141:	c9                   	leave
+    3142:	c3                   	ret
+    3143:	90                   	nop
+
+0000000000003144 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>:
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    3144:	55                   	push   %rbp
+    3145:	48 89 e5             	mov    %rsp,%rbp
+    3148:	48 83 ec 10          	sub    $0x10,%rsp
+    314c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3150:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3154:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3158:	48 8b 00             	mov    (%rax),%rax
+    315b:	48 89 c6             	mov    %rax,%rsi
+    315e:	48 8d 05 c5 1f 00 00 	lea    0x1fc5(%rip),%rax        # 512a <nel::sort::ninther_n+0x10a>
+    3165:	48 89 c7             	mov    %rax,%rdi
+    3168:	e8 46 05 00 00       	call   36b3 <nel::panic(char const*, nel::Context const&)>
+    316d:	90                   	nop
+
+000000000000316e <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>:
+        constexpr T unwrap(Context const &ctx = Context())
+    316e:	55                   	push   %rbp
+    316f:	48 89 e5             	mov    %rsp,%rbp
+    3172:	48 83 ec 20          	sub    $0x20,%rsp
+    3176:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    317a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    317e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3182:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    3186:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    318a:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+    318e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+    3192:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3196:	48 89 c7             	mov    %rax,%rdi
+    3199:	e8 64 03 00 00       	call   3502 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>
+        }
+    319e:	c9                   	leave
+    319f:	c3                   	ret
+
+00000000000031a0 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)>:
+ * @warning UB if [s, s+n) is not initialised.
+ */
+void relocate(uint8_t *const d, uint8_t *const s, Length const n);
+
+template<typename T>
+void relocate(T d[], T s[], Length const n)
+    31a0:	                55                   	push   %rbp
+    31a1:	                48 89 e5             	mov    %rsp,%rbp
+    31a4:	                53                   	push   %rbx
+    31a5:	                48 83 ec 38          	sub    $0x38,%rsp
+    31a9:	                48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    31ad:	                48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    31b1:	                48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+{
+    if (d == s) { return; }
+    31b5:	                48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    31b9:	                48 3b 45 d0          	cmp    -0x30(%rbp),%rax
+    31bd:	/-------------- 0f 84 0e 01 00 00    	je     32d1 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x131>
+    if constexpr (is_trivially_relocatable<T>) {
+        relocate(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t *>(s), n * sizeof(T));
+    } else if (d < s) {
+    31c3:	|               48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    31c7:	|               48 3b 45 d0          	cmp    -0x30(%rbp),%rax
+    31cb:	|     /-------- 73 7f                	jae    324c <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0xac>
+        // forwards, so overlap is not overwritten before it is read.
+        for (Index i = 0; i < n; ++i) {
+    31cd:	|     |         48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+    31d4:	|     |         00 
+    31d5:	|     |     /-- eb 66                	jmp    323d <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x9d>
+            new (&d[i]) T(nel::move(s[i]));
+    31d7:	|     |  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31db:	|     |  |  |   48 c1 e0 08          	shl    $0x8,%rax
+    31df:	|     |  |  |   48 89 c2             	mov    %rax,%rdx
+    31e2:	|     |  |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    31e6:	|     |  |  |   48 01 d0             	add    %rdx,%rax
+    31e9:	|     |  |  |   48 89 c6             	mov    %rax,%rsi
+    31ec:	|     |  |  |   bf 00 01 00 00       	mov    $0x100,%edi
+    31f1:	|     |  |  |   e8 37 e8 ff ff       	call   1a2d <operator new(unsigned long, void*)>
+    31f6:	|     |  |  |   48 89 c3             	mov    %rax,%rbx
+    31f9:	|     |  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31fd:	|     |  |  |   48 c1 e0 08          	shl    $0x8,%rax
+    3201:	|     |  |  |   48 89 c2             	mov    %rax,%rdx
+    3204:	|     |  |  |   48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3208:	|     |  |  |   48 01 d0             	add    %rdx,%rax
+    320b:	|     |  |  |   48 89 c7             	mov    %rax,%rdi
+    320e:	|     |  |  |   e8 e0 ec ff ff       	call   1ef3 <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    3213:	|     |  |  |   48 89 c6             	mov    %rax,%rsi
+    3216:	|     |  |  |   48 89 df             	mov    %rbx,%rdi
+    3219:	|     |  |  |   e8 ae 03 00 00       	call   35cc <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>
+            s[i].~T();
+    321e:	|     |  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3222:	|     |  |  |   48 c1 e0 08          	shl    $0x8,%rax
+    3226:	|     |  |  |   48 89 c2             	mov    %rax,%rdx
+    3229:	|     |  |  |   48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    322d:	|     |  |  |   48 01 d0             	add    %rdx,%rax
+    3230:	|     |  |  |   48 89 c7             	mov    %rax,%rdi
+    3233:	|     |  |  |   e8 96 ec ff ff       	call   1ece <U8Buf<256ul>::~U8Buf()>
+        for (Index i = 0; i < n; ++i) {
+    3238:	|     |  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    323d:	|     |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3241:	|     |  |      48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+    3245:	|     |  \----- 72 90                	jb     31d7 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x37>
+    3247:	|  /--|-------- e9 86 00 00 00       	jmp    32d2 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x132>
+        }
+    } else {
+        // backwards, so overlap is not overwritten before it is read.
+        for (Index i = n; i > 0; --i) {
+    324c:	|  |  \-------> 48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3250:	|  |            48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    3254:	|  |        /-- eb 72                	jmp    32c8 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x128>
+            new (&d[i - 1]) T(nel::move(s[i - 1]));
+    3256:	|  |     /--|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    325a:	|  |     |  |   48 c1 e0 08          	shl    $0x8,%rax
+    325e:	|  |     |  |   48 8d 90 00 ff ff ff 	lea    -0x100(%rax),%rdx
+    3265:	|  |     |  |   48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3269:	|  |     |  |   48 01 d0             	add    %rdx,%rax
+    326c:	|  |     |  |   48 89 c6             	mov    %rax,%rsi
+    326f:	|  |     |  |   bf 00 01 00 00       	mov    $0x100,%edi
+    3274:	|  |     |  |   e8 b4 e7 ff ff       	call   1a2d <operator new(unsigned long, void*)>
+    3279:	|  |     |  |   48 89 c3             	mov    %rax,%rbx
+    327c:	|  |     |  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3280:	|  |     |  |   48 c1 e0 08          	shl    $0x8,%rax
+    3284:	|  |     |  |   48 8d 90 00 ff ff ff 	lea    -0x100(%rax),%rdx
+    328b:	|  |     |  |   48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    328f:	|  |     |  |   48 01 d0             	add    %rdx,%rax
+    3292:	|  |     |  |   48 89 c7             	mov    %rax,%rdi
+    3295:	|  |     |  |   e8 59 ec ff ff       	call   1ef3 <U8Buf<256ul>&& nel::move<U8Buf<256ul> >(U8Buf<256ul>&)>
+    329a:	|  |     |  |   48 89 c6             	mov    %rax,%rsi
+    329d:	|  |     |  |   48 89 df             	mov    %rbx,%rdi
+    32a0:	|  |     |  |   e8 27 03 00 00       	call   35cc <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>
+            s[i - 1].~T();
+    32a5:	|  |     |  |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    32a9:	|  |     |  |   48 c1 e0 08          	shl    $0x8,%rax
+    32ad:	|  |     |  |   48 8d 90 00 ff ff ff 	lea    -0x100(%rax),%rdx
+    32b4:	|  |     |  |   48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    32b8:	|  |     |  |   48 01 d0             	add    %rdx,%rax
+    32bb:	|  |     |  |   48 89 c7             	mov    %rax,%rdi
+    32be:	|  |     |  |   e8 0b ec ff ff       	call   1ece <U8Buf<256ul>::~U8Buf()>
+        for (Index i = n; i > 0; --i) {
+    32c3:	|  |     |  |   48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+    32c8:	|  |     |  \-> 48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    32cd:	|  |     \----- 75 87                	jne    3256 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0xb6>
+    32cf:	|  +----------- eb 01                	jmp    32d2 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x132>
+    if (d == s) { return; }
+    32d1:	\--|----------> 90                   	nop
+        }
+    }
+}
+    32d2:	   \----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    32d6:	                c9                   	leave
+    32d7:	                c3                   	ret
+
+00000000000032d8 <nel::Slice<U8Buf<256ul> const>::Slice(U8Buf<256ul> const*, unsigned long)>:
+        constexpr Slice(Type *const p, Length len)
+    32d8:	55                   	push   %rbp
+    32d9:	48 89 e5             	mov    %rsp,%rbp
+    32dc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    32e0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    32e4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : content_(p)
+    32e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32ec:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    32f0:	48 89 10             	mov    %rdx,(%rax)
+            , len_(len)
+    32f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32f7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    32fb:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    32ff:	90                   	nop
+    3300:	5d                   	pop    %rbp
+    3301:	c3                   	ret
+
+0000000000003302 <nel::Slice<U8Buf<256ul> const>::ptr() const>:
+        constexpr Type *ptr(void) const
+    3302:	55                   	push   %rbp
+    3303:	48 89 e5             	mov    %rsp,%rbp
+    3306:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return content_;
+    330a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    330e:	48 8b 00             	mov    (%rax),%rax
+        }
+    3311:	5d                   	pop    %rbp
+    3312:	c3                   	ret
+    3313:	90                   	nop
+
+0000000000003314 <nel::Slice<U8Buf<256ul> const>::len() const>:
+        constexpr Length len(void) const
+    3314:	55                   	push   %rbp
+    3315:	48 89 e5             	mov    %rsp,%rbp
+    3318:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return len_;
+    331c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3320:	48 8b 40 08          	mov    0x8(%rax),%rax
+        }
+    3324:	5d                   	pop    %rbp
+    3325:	c3                   	ret
+
+0000000000003326 <nel::SliceIterator<U8Buf<256ul> const>::SliceIterator(U8Buf<256ul> const*, unsigned long)>:
+        constexpr SliceIterator(T arr[], Count len)
+    3326:	55                   	push   %rbp
+    3327:	48 89 e5             	mov    %rsp,%rbp
+    332a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    332e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3332:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+            : b_(arr)
+    3336:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    333a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    333e:	48 89 10             	mov    %rdx,(%rax)
+            , e_(arr + len)
+    3341:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3345:	48 c1 e0 08          	shl    $0x8,%rax
+    3349:	48 89 c2             	mov    %rax,%rdx
+    334c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3350:	48 01 c2             	add    %rax,%rdx
+    3353:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3357:	48 89 50 08          	mov    %rdx,0x8(%rax)
+        }
+    335b:	90                   	nop
+    335c:	5d                   	pop    %rbp
+    335d:	c3                   	ret
+
+000000000000335e <nel::SliceIterator<U8Buf<256ul> const>::deref()>:
+        OutT deref(void)
+    335e:	55                   	push   %rbp
+    335f:	48 89 e5             	mov    %rsp,%rbp
+    3362:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return *b_;
+    3366:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    336a:	48 8b 00             	mov    (%rax),%rax
+        }
+    336d:	5d                   	pop    %rbp
+    336e:	c3                   	ret
+    336f:	90                   	nop
+
+0000000000003370 <nel::SliceIterator<U8Buf<256ul> const>::inc()>:
+        void inc(void)
+    3370:	55                   	push   %rbp
+    3371:	48 89 e5             	mov    %rsp,%rbp
+    3374:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            ++b_;
+    3378:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    337c:	48 8b 00             	mov    (%rax),%rax
+    337f:	48 8d 90 00 01 00 00 	lea    0x100(%rax),%rdx
+    3386:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    338a:	48 89 10             	mov    %rdx,(%rax)
+        }
+    338d:	90                   	nop
+    338e:	5d                   	pop    %rbp
+    338f:	c3                   	ret
+
+0000000000003390 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}>(nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}&&)>:
+        void for_each(F &&fn)
+    3390:	       55                   	push   %rbp
+    3391:	       48 89 e5             	mov    %rsp,%rbp
+    3394:	       48 83 ec 10          	sub    $0x10,%rsp
+    3398:	       48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    339c:	       48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            for (; !self().is_done(); self().inc()) {
+    33a0:	   /-- eb 3a                	jmp    33dc <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}>(nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}&&)+0x4c>
+                fn(self().deref());
+    33a2:	/--|-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33a6:	|  |   48 89 c7             	mov    %rax,%rdi
+    33a9:	|  |   e8 4a 02 00 00       	call   35f8 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::self()>
+    33ae:	|  |   48 89 c7             	mov    %rax,%rdi
+    33b1:	|  |   e8 a8 ff ff ff       	call   335e <nel::SliceIterator<U8Buf<256ul> const>::deref()>
+    33b6:	|  |   48 89 c2             	mov    %rax,%rdx
+    33b9:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    33bd:	|  |   48 89 d6             	mov    %rdx,%rsi
+    33c0:	|  |   48 89 c7             	mov    %rax,%rdi
+    33c3:	|  |   e8 be f9 ff ff       	call   2d86 <nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}::operator()(U8Buf<256ul> const&) const>
+            for (; !self().is_done(); self().inc()) {
+    33c8:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33cc:	|  |   48 89 c7             	mov    %rax,%rdi
+    33cf:	|  |   e8 24 02 00 00       	call   35f8 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::self()>
+    33d4:	|  |   48 89 c7             	mov    %rax,%rdi
+    33d7:	|  |   e8 94 ff ff ff       	call   3370 <nel::SliceIterator<U8Buf<256ul> const>::inc()>
+    33dc:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33e0:	|      48 89 c7             	mov    %rax,%rdi
+    33e3:	|      e8 10 02 00 00       	call   35f8 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::self()>
+    33e8:	|      48 89 c7             	mov    %rax,%rdi
+    33eb:	|      e8 76 f9 ff ff       	call   2d66 <nel::SliceIterator<U8Buf<256ul> const>::is_done() const>
+    33f0:	|      83 f0 01             	xor    $0x1,%eax
+    33f3:	|      84 c0                	test   %al,%al
+    33f5:	\----- 75 ab                	jne    33a2 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}>(nel::operator<<(nel::Log&, nel::SliceIterator<U8Buf<256ul> const> const&)::{lambda(U8Buf<256ul> const&)#1}&&)+0x12>
+        }
+    33f7:	       90                   	nop
+    33f8:	       90                   	nop
+    33f9:	       c9                   	leave
+    33fa:	       c3                   	ret
+
+00000000000033fb <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)>:
+
+    public:
+        // Smallest non-zero capacity grown to, saves the first few tiny reallocs.
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+    33fb:	          55                   	push   %rbp
+    33fc:	          48 89 e5             	mov    %rsp,%rbp
+    33ff:	          48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3403:	          48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+        {
+            if (cap <= cur) { return cap; }
+    3407:	          48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    340b:	          48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+    340f:	      /-- 72 06                	jb     3417 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x1c>
+    3411:	      |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3415:	/-----|-- eb 2e                	jmp    3445 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x4a>
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    3417:	|     \-> 48 83 7d e8 03       	cmpq   $0x3,-0x18(%rbp)
+    341c:	|  /----- 76 09                	jbe    3427 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x2c>
+    341e:	|  |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3422:	|  |      48 01 c0             	add    %rax,%rax
+    3425:	|  |  /-- eb 05                	jmp    342c <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x31>
+    3427:	|  \--|-> b8 04 00 00 00       	mov    $0x4,%eax
+    342c:	|     \-> 48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return (cap < g) ? g : cap;
+    3430:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3434:	|         48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    3438:	|  /----- 73 06                	jae    3440 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x45>
+    343a:	|  |      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    343e:	|  |  /-- eb 04                	jmp    3444 <nel::heaped::GeometricGrowth<2ul, 1ul>::capacity_for(unsigned long, unsigned long)+0x49>
+    3440:	|  \--|-> 48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3444:	|     \-> 90                   	nop
+        }
+    3445:	\-------> 5d                   	pop    %rbp
+    3446:	          c3                   	ret
+    3447:	          90                   	nop
+
+0000000000003448 <nel::Element<U8Buf<256ul> >::Element<U8Buf<256ul>&>(U8Buf<256ul>&)>:
+        constexpr Element(Args &&...args)
+    3448:	55                   	push   %rbp
+    3449:	48 89 e5             	mov    %rsp,%rbp
+    344c:	53                   	push   %rbx
+    344d:	48 83 ec 18          	sub    $0x18,%rsp
+    3451:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3455:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : value_(forward<Args>(args)...)
+    3459:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    345d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3461:	48 89 c7             	mov    %rax,%rdi
+    3464:	e8 7c fb ff ff       	call   2fe5 <U8Buf<256ul>& nel::forward<U8Buf<256ul>&, U8Buf<256ul> >(U8Buf<256ul>&)>
+    3469:	48 89 c6             	mov    %rax,%rsi
+    346c:	48 89 df             	mov    %rbx,%rdi
+    346f:	e8 d4 fb ff ff       	call   3048 <U8Buf<256ul>::U8Buf(U8Buf<256ul> const&)>
+        }
+    3474:	90                   	nop
+    3475:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3479:	c9                   	leave
+    347a:	c3                   	ret
+    347b:	90                   	nop
+
+000000000000347c <nel::Result<void, U8Buf<256ul> >::Result(nel::Result<void, U8Buf<256ul> >::Phantom<(nel::Result<void, U8Buf<256ul> >::Tag)1>)>:
+        constexpr Result(Phantom<Tag::OK> const)
+    347c:	55                   	push   %rbp
+    347d:	48 89 e5             	mov    %rsp,%rbp
+    3480:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            : tag_(Tag::OK)
+    3484:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3488:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+        }
+    348e:	90                   	nop
+    348f:	5d                   	pop    %rbp
+    3490:	c3                   	ret
+    3491:	90                   	nop
+
+0000000000003492 <nel::Element<U8Buf<256ul> >::ref() const>:
+        constexpr Type const &ref(void) const
+    3492:	55                   	push   %rbp
+    3493:	48 89 e5             	mov    %rsp,%rbp
+    3496:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    349a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    349e:	5d                   	pop    %rbp
+    349f:	c3                   	ret
+
+00000000000034a0 <nel::Element<U8Buf<256ul> >::Element<unsigned char>(unsigned char&&)>:
+        constexpr Element(Args &&...args)
+    34a0:	55                   	push   %rbp
+    34a1:	48 89 e5             	mov    %rsp,%rbp
+    34a4:	53                   	push   %rbx
+    34a5:	48 83 ec 18          	sub    $0x18,%rsp
+    34a9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    34ad:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+            : value_(forward<Args>(args)...)
+    34b1:	48 8b 5d e8          	mov    -0x18(%rbp),%rbx
+    34b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    34b9:	48 89 c7             	mov    %rax,%rdi
+    34bc:	e8 62 f2 ff ff       	call   2723 <unsigned char&& nel::forward<unsigned char, unsigned char>(unsigned char&)>
+    34c1:	0f b6 00             	movzbl (%rax),%eax
+    34c4:	0f b6 c0             	movzbl %al,%eax
+    34c7:	89 c6                	mov    %eax,%esi
+    34c9:	48 89 df             	mov    %rbx,%rdi
+    34cc:	e8 39 e7 ff ff       	call   1c0a <U8Buf<256ul>::U8Buf(unsigned char)>
+        }
+    34d1:	90                   	nop
+    34d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    34d6:	c9                   	leave
+    34d7:	c3                   	ret
+
+00000000000034d8 <nel::Element<void*>::ref() const>:
+        constexpr Type const &ref(void) const
+    34d8:	55                   	push   %rbp
+    34d9:	48 89 e5             	mov    %rsp,%rbp
+    34dc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    34e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    34e4:	5d                   	pop    %rbp
+    34e5:	c3                   	ret
+
+00000000000034e6 <nel::Element<nel::heaped::AllocError>::ref() const>:
+        constexpr Type const &ref(void) const
+    34e6:	55                   	push   %rbp
+    34e7:	48 89 e5             	mov    %rsp,%rbp
+    34ea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    34ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    34f2:	5d                   	pop    %rbp
+    34f3:	c3                   	ret
+
+00000000000034f4 <void*&& nel::forward<void*, void*>(void*&)>:
+constexpr U &&forward(T &t)
+    34f4:	55                   	push   %rbp
+    34f5:	48 89 e5             	mov    %rsp,%rbp
+    34f8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return static_cast<U &&>(t);
+    34fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3500:	5d                   	pop    %rbp
+    3501:	c3                   	ret
+
+0000000000003502 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)>:
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+    3502:	             55                   	push   %rbp
+    3503:	             48 89 e5             	mov    %rsp,%rbp
+    3506:	             48 83 ec 30          	sub    $0x30,%rsp
+    350a:	             48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    350e:	             48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    3512:	             48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    3516:	             48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+            auto tag = tag_;
+    351a:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    351e:	             8b 00                	mov    (%rax),%eax
+    3520:	             89 45 fc             	mov    %eax,-0x4(%rbp)
+            tag_ = Tag::INVAL;
+    3523:	             48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3527:	             c7 00 00 00 00 00    	movl   $0x0,(%rax)
+            switch (tag) { // result-consume
+    352d:	             83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    3531:	         /-- 74 3e                	je     3571 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x6f>
+    3533:	         |   83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    3537:	/--------|-- 7f 7a                	jg     35b3 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+    3539:	|        |   83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    353d:	|  /-----|-- 74 5e                	je     359d <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0x9b>
+    353f:	|  |     |   83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+    3543:	+--|-----|-- 75 6e                	jne    35b3 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xb1>
+                    return on_ok(forward<T>(*ok_));
+    3545:	|  |     |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3549:	|  |     |   48 83 c0 08          	add    $0x8,%rax
+    354d:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    3550:	|  |     |   e8 b9 00 00 00       	call   360e <nel::Element<void*>::operator*()>
+    3555:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    3558:	|  |     |   e8 97 ff ff ff       	call   34f4 <void*&& nel::forward<void*, void*>(void*&)>
+    355d:	|  |     |   48 89 c2             	mov    %rax,%rdx
+    3560:	|  |     |   48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3564:	|  |     |   48 89 d6             	mov    %rdx,%rsi
+    3567:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    356a:	|  |     |   e8 b3 fb ff ff       	call   3122 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}::operator()(void*&&) const>
+    356f:	|  |  /--|-- eb 58                	jmp    35c9 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    return on_err(forward<E>(*err_));
+    3571:	|  |  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3575:	|  |  |      48 83 c0 08          	add    $0x8,%rax
+    3579:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    357c:	|  |  |      e8 a7 00 00 00       	call   3628 <nel::Element<nel::heaped::AllocError>::operator*()>
+    3581:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3584:	|  |  |      e8 5a ed ff ff       	call   22e3 <nel::heaped::AllocError&& nel::forward<nel::heaped::AllocError, nel::heaped::AllocError>(nel::heaped::AllocError&)>
+    3589:	|  |  |      48 89 c2             	mov    %rax,%rdx
+    358c:	|  |  |      48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3590:	|  |  |      48 89 d6             	mov    %rdx,%rsi
+    3593:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    3596:	|  |  |      e8 a9 fb ff ff       	call   3144 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}::operator()(nel::heaped::AllocError&&) const>
+    359b:	|  |  +----- eb 2c                	jmp    35c9 <void* nel::Result<void*, nel::heaped::AllocError>::consume<void*, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}>(nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(void*&&)#1}&&, nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)::{lambda(nel::heaped::AllocError&&)#2}&&, nel::Context const&)+0xc7>
+                    nel::panic("invalid Result", ctx);
+    359d:	|  \--|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    35a1:	|     |      48 89 c6             	mov    %rax,%rsi
+    35a4:	|     |      48 8d 05 29 1b 00 00 	lea    0x1b29(%rip),%rax        # 50d4 <nel::sort::ninther_n+0xb4>
+    35ab:	|     |      48 89 c7             	mov    %rax,%rdi
+    35ae:	|     |      e8 00 01 00 00       	call   36b3 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    35b3:	\-----|----> 48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    35b7:	      |      48 89 c6             	mov    %rax,%rsi
+    35ba:	      |      48 8d 05 f3 1a 00 00 	lea    0x1af3(%rip),%rax        # 50b4 <nel::sort::ninther_n+0x94>
+    35c1:	      |      48 89 c7             	mov    %rax,%rdi
+    35c4:	      |      e8 ea 00 00 00       	call   36b3 <nel::panic(char const*, nel::Context const&)>
+        }
+    35c9:	      \----> c9                   	leave
+    35ca:	             c3                   	ret
+    35cb:	             90                   	nop
+
+00000000000035cc <U8Buf<256ul>::U8Buf(U8Buf<256ul>&&)>:
+        constexpr U8Buf(U8Buf &&o)
+    35cc:	55                   	push   %rbp
+    35cd:	48 89 e5             	mov    %rsp,%rbp
+    35d0:	48 83 ec 10          	sub    $0x10,%rsp
+    35d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    35d8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+            nel::elem::move(data_, o.data_, N);
+    35dc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    35e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    35e4:	ba 00 01 00 00       	mov    $0x100,%edx
+    35e9:	48 89 ce             	mov    %rcx,%rsi
+    35ec:	48 89 c7             	mov    %rax,%rdi
+    35ef:	e8 d1 01 00 00       	call   37c5 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+        }
+    35f4:	90                   	nop
+    35f5:	c9                   	leave
+    35f6:	c3                   	ret
+    35f7:	90                   	nop
+
+00000000000035f8 <nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::self()>:
+        constexpr ItT &self(void)
+    35f8:	55                   	push   %rbp
+    35f9:	48 89 e5             	mov    %rsp,%rbp
+    35fc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+            ItT &it = static_cast<ItT &>(*this);
+    3600:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3604:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+            return it;
+    3608:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    360c:	5d                   	pop    %rbp
+    360d:	c3                   	ret
+
+000000000000360e <nel::Element<void*>::operator*()>:
+
+        constexpr Type &operator*(void)
+    360e:	55                   	push   %rbp
+    360f:	48 89 e5             	mov    %rsp,%rbp
+    3612:	48 83 ec 10          	sub    $0x10,%rsp
+    3616:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+        {
+            return ref();
+    361a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    361e:	48 89 c7             	mov    %rax,%rdi
+    3621:	e8 1c 00 00 00       	call   3642 <nel::Element<void*>::ref()>
+        }
+    3626:	c9                   	leave
+    3627:	c3                   	ret
+
+0000000000003628 <nel::Element<nel::heaped::AllocError>::operator*()>:
+        constexpr Type &operator*(void)
+    3628:	55                   	push   %rbp
+    3629:	48 89 e5             	mov    %rsp,%rbp
+    362c:	48 83 ec 10          	sub    $0x10,%rsp
+    3630:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return ref();
+    3634:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3638:	48 89 c7             	mov    %rax,%rdi
+    363b:	e8 10 00 00 00       	call   3650 <nel::Element<nel::heaped::AllocError>::ref()>
+        }
+    3640:	c9                   	leave
+    3641:	c3                   	ret
+
+0000000000003642 <nel::Element<void*>::ref()>:
+        constexpr Type &ref(void)
+    3642:	55                   	push   %rbp
+    3643:	48 89 e5             	mov    %rsp,%rbp
+    3646:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    364a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    364e:	5d                   	pop    %rbp
+    364f:	c3                   	ret
+
+0000000000003650 <nel::Element<nel::heaped::AllocError>::ref()>:
+        constexpr Type &ref(void)
+    3650:	55                   	push   %rbp
+    3651:	48 89 e5             	mov    %rsp,%rbp
+    3654:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+            return value_;
+    3658:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+        }
+    365c:	5d                   	pop    %rbp
+    365d:	c3                   	ret
+
+000000000000365e <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    365e:	55                   	push   %rbp
+    365f:	48 89 e5             	mov    %rsp,%rbp
+    std::abort();
+    3662:	e8 d9 d9 ff ff       	call   1040 <abort@plt>
+
+0000000000003667 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    3667:	55                   	push   %rbp
+    3668:	48 89 e5             	mov    %rsp,%rbp
+    366b:	48 83 ec 10          	sub    $0x10,%rsp
+    366f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    3673:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3677:	48 8b 30             	mov    (%rax),%rsi
+    367a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    367e:	8b 48 10             	mov    0x10(%rax),%ecx
+    3681:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3685:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    3689:	48 8b 05 d0 49 00 00 	mov    0x49d0(%rip),%rax        # 8060 <stderr@GLIBC_2.2.5>
+    3690:	4c 8d 0d 9e 1a 00 00 	lea    0x1a9e(%rip),%r9        # 5135 <nel::is_trivially_relocatable<U8Buf<256ul> >+0x1>
+    3697:	49 89 f0             	mov    %rsi,%r8
+    369a:	48 8d 35 9a 1a 00 00 	lea    0x1a9a(%rip),%rsi        # 513b <nel::is_trivially_relocatable<U8Buf<256ul> >+0x7>
+    36a1:	48 89 c7             	mov    %rax,%rdi
+    36a4:	b8 00 00 00 00       	mov    $0x0,%eax
+    36a9:	e8 e2 d9 ff ff       	call   1090 <fprintf@plt>
+    abort();
+    36ae:	e8 ab ff ff ff       	call   365e <nel::abort()>
+
+00000000000036b3 <nel::panic(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    36b3:	55                   	push   %rbp
+    36b4:	48 89 e5             	mov    %rsp,%rbp
+    36b7:	48 83 ec 10          	sub    $0x10,%rsp
+    36bb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    36bf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    36c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    36c7:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    36ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    36ce:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    36d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    36d5:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    36d9:	48 8b 05 80 49 00 00 	mov    0x4980(%rip),%rax        # 8060 <stderr@GLIBC_2.2.5>
+    36e0:	48 83 ec 08          	sub    $0x8,%rsp
+    36e4:	ff 75 f8             	push   -0x8(%rbp)
+    36e7:	4c 8d 0d 47 1a 00 00 	lea    0x1a47(%rip),%r9        # 5135 <nel::is_trivially_relocatable<U8Buf<256ul> >+0x1>
+    36ee:	49 89 f0             	mov    %rsi,%r8
+    36f1:	48 8d 35 54 1a 00 00 	lea    0x1a54(%rip),%rsi        # 514c <nel::is_trivially_relocatable<U8Buf<256ul> >+0x18>
+    36f8:	48 89 c7             	mov    %rax,%rdi
+    36fb:	b8 00 00 00 00       	mov    $0x0,%eax
+    3700:	e8 8b d9 ff ff       	call   1090 <fprintf@plt>
+    3705:	48 83 c4 10          	add    $0x10,%rsp
+            "PANIC",
+            msg);
+    abort();
+    3709:	e8 50 ff ff ff       	call   365e <nel::abort()>
+
+000000000000370e <nel::assert_fail(char const*, nel::Context const&)>:
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    370e:	55                   	push   %rbp
+    370f:	48 89 e5             	mov    %rsp,%rbp
+    3712:	48 83 ec 10          	sub    $0x10,%rsp
+    3716:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    371a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+#else
+    fprintf(stderr,
+            "\n%s:%d:[%s]: %s: %s\n",
+            ctx.file_name_,
+            ctx.line_num_,
+            ctx.fn_name_,
+    371e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3722:	48 8b 30             	mov    (%rax),%rsi
+            ctx.line_num_,
+    3725:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3729:	8b 48 10             	mov    0x10(%rax),%ecx
+            ctx.file_name_,
+    372c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3730:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    fprintf(stderr,
+    3734:	48 8b 05 25 49 00 00 	mov    0x4925(%rip),%rax        # 8060 <stderr@GLIBC_2.2.5>
+    373b:	48 83 ec 08          	sub    $0x8,%rsp
+    373f:	ff 75 f8             	push   -0x8(%rbp)
+    3742:	4c 8d 0d 18 1a 00 00 	lea    0x1a18(%rip),%r9        # 5161 <nel::is_trivially_relocatable<U8Buf<256ul> >+0x2d>
+    3749:	49 89 f0             	mov    %rsi,%r8
+    374c:	48 8d 35 f9 19 00 00 	lea    0x19f9(%rip),%rsi        # 514c <nel::is_trivially_relocatable<U8Buf<256ul> >+0x18>
+    3753:	48 89 c7             	mov    %rax,%rdi
+    3756:	b8 00 00 00 00       	mov    $0x0,%eax
+    375b:	e8 30 d9 ff ff       	call   1090 <fprintf@plt>
+    3760:	48 83 c4 10          	add    $0x10,%rsp
+            "ASSERT FAIL",
+            msg);
+    abort();
+    3764:	e8 f5 fe ff ff       	call   365e <nel::abort()>
+
+0000000000003769 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    3769:	55                   	push   %rbp
+    376a:	48 89 e5             	mov    %rsp,%rbp
+    376d:	48 83 ec 20          	sub    $0x20,%rsp
+    3771:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3775:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3779:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    377d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3781:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3785:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3789:	48 89 ce             	mov    %rcx,%rsi
+    378c:	48 89 c7             	mov    %rax,%rdi
+    378f:	e8 0c d9 ff ff       	call   10a0 <memcpy@plt>
+}
+    3794:	90                   	nop
+    3795:	c9                   	leave
+    3796:	c3                   	ret
+
+0000000000003797 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    3797:	55                   	push   %rbp
+    3798:	48 89 e5             	mov    %rsp,%rbp
+    379b:	48 83 ec 20          	sub    $0x20,%rsp
+    379f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    37a3:	89 f0                	mov    %esi,%eax
+    37a5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    37a9:	88 45 f4             	mov    %al,-0xc(%rbp)
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    37ac:	0f b6 4d f4          	movzbl -0xc(%rbp),%ecx
+    37b0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    37b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    37b8:	89 ce                	mov    %ecx,%esi
+    37ba:	48 89 c7             	mov    %rax,%rdi
+    37bd:	e8 9e d8 ff ff       	call   1060 <memset@plt>
+}
+    37c2:	90                   	nop
+    37c3:	c9                   	leave
+    37c4:	c3                   	ret
+
+00000000000037c5 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    37c5:	55                   	push   %rbp
+    37c6:	48 89 e5             	mov    %rsp,%rbp
+    37c9:	48 83 ec 20          	sub    $0x20,%rsp
+    37cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    37d1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    37d5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    //     *id = *is;
+    // }
+    // for (uint8_t *id = d, *is = s, *const e = (d + n); id != e; ++is, ++id) {
+    //     *is = 0xa5;
+    // }
+    copy(d, s, n);
+    37d9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    37dd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    37e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    37e5:	48 89 ce             	mov    %rcx,%rsi
+    37e8:	48 89 c7             	mov    %rax,%rdi
+    37eb:	e8 79 ff ff ff       	call   3769 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    poison(s, n);
+    37f0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    37f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    37f8:	48 89 d6             	mov    %rdx,%rsi
+    37fb:	48 89 c7             	mov    %rax,%rdi
+    37fe:	e8 60 07 00 00       	call   3f63 <nel::elem::poison(unsigned char*, unsigned long)>
+}
+    3803:	90                   	nop
+    3804:	c9                   	leave
+    3805:	c3                   	ret
+
+0000000000003806 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    3806:	55                   	push   %rbp
+    3807:	48 89 e5             	mov    %rsp,%rbp
+    380a:	48 83 ec 20          	sub    $0x20,%rsp
+    380e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3812:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    3816:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    std::memmove(d, s, n);
+    381a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    381e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3822:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3826:	48 89 ce             	mov    %rcx,%rsi
+    3829:	48 89 c7             	mov    %rax,%rdi
+    382c:	e8 8f d8 ff ff       	call   10c0 <memmove@plt>
+}
+    3831:	90                   	nop
+    3832:	c9                   	leave
+    3833:	c3                   	ret
+
+0000000000003834 <nel::elem::wipe(unsigned char*, unsigned long)>:
+
+void wipe(uint8_t *const d, Length const n)
+{
+    3834:	55                   	push   %rbp
+    3835:	48 89 e5             	mov    %rsp,%rbp
+    3838:	48 83 ec 10          	sub    $0x10,%rsp
+    383c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3840:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    set(d, 0xa5, n);
+    3844:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3848:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    384c:	be a5 00 00 00       	mov    $0xa5,%esi
+    3851:	48 89 c7             	mov    %rax,%rdi
+    3854:	e8 3e ff ff ff       	call   3797 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    3859:	90                   	nop
+    385a:	c9                   	leave
+    385b:	c3                   	ret
+
+000000000000385c <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    385c:	55                   	push   %rbp
+    385d:	48 89 e5             	mov    %rsp,%rbp
+    3860:	48 83 ec 20          	sub    $0x20,%rsp
+    3864:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3868:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    386c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    3870:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3874:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3878:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    387c:	48 89 ce             	mov    %rcx,%rsi
+    387f:	48 89 c7             	mov    %rax,%rdi
+    3882:	e8 f9 d7 ff ff       	call   1080 <memcmp@plt>
+    3887:	85 c0                	test   %eax,%eax
+    3889:	0f 94 c0             	sete   %al
+}
+    388c:	c9                   	leave
+    388d:	c3                   	ret
+
+000000000000388e <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    388e:	55                   	push   %rbp
+    388f:	48 89 e5             	mov    %rsp,%rbp
+    3892:	48 83 ec 20          	sub    $0x20,%rsp
+    3896:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    389a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    389e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    38a2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    38a6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    38aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    38ae:	48 89 ce             	mov    %rcx,%rsi
+    38b1:	48 89 c7             	mov    %rax,%rdi
+    38b4:	e8 c7 d7 ff ff       	call   1080 <memcmp@plt>
+    38b9:	85 c0                	test   %eax,%eax
+    38bb:	0f 95 c0             	setne  %al
+}
+    38be:	c9                   	leave
+    38bf:	c3                   	ret
+
+00000000000038c0 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>:
+
+// d[i] = p[i % 16] for i in [0, n), with normal stores:
+// the pattern once, then doubling the filled region.
+static void set_pattern(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    38c0:	       55                   	push   %rbp
+    38c1:	       48 89 e5             	mov    %rsp,%rbp
+    38c4:	       48 83 ec 30          	sub    $0x30,%rsp
+    38c8:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    38cc:	       48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    38d0:	       48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    Length done = (n < 16) ? n : 16;
+    38d4:	       48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    38d8:	       ba 10 00 00 00       	mov    $0x10,%edx
+    38dd:	       48 39 d0             	cmp    %rdx,%rax
+    38e0:	       48 0f 47 c2          	cmova  %rdx,%rax
+    38e4:	       48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    copy(d, p, done);
+    38e8:	       48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    38ec:	       48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    38f0:	       48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    38f4:	       48 89 ce             	mov    %rcx,%rsi
+    38f7:	       48 89 c7             	mov    %rax,%rdi
+    38fa:	       e8 6a fe ff ff       	call   3769 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    while (done < n) {
+    38ff:	   /-- eb 3e                	jmp    393f <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x7f>
+        Length const m = (done < n - done) ? done : n - done;
+    3901:	/--|-> 48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3905:	|  |   48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    3909:	|  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    390d:	|  |   48 39 c2             	cmp    %rax,%rdx
+    3910:	|  |   48 0f 46 c2          	cmovbe %rdx,%rax
+    3914:	|  |   48 89 45 f0          	mov    %rax,-0x10(%rbp)
+        copy(d + done, d, m);
+    3918:	|  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    391c:	|  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3920:	|  |   48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    3924:	|  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3928:	|  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    392c:	|  |   48 89 c6             	mov    %rax,%rsi
+    392f:	|  |   48 89 cf             	mov    %rcx,%rdi
+    3932:	|  |   e8 32 fe ff ff       	call   3769 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        done += m;
+    3937:	|  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    393b:	|  |   48 01 45 f8          	add    %rax,-0x8(%rbp)
+    while (done < n) {
+    393f:	|  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3943:	|      48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    3947:	\----- 72 b8                	jb     3901 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)+0x41>
+    }
+}
+    3949:	       90                   	nop
+    394a:	       90                   	nop
+    394b:	       c9                   	leave
+    394c:	       c3                   	ret
+
+000000000000394d <nel::elem::load16(unsigned char const*)>:
+static constexpr Length streaming_min = 256;
+
+typedef long long int Line16 __attribute__((vector_size(16)));
+
+static inline Line16 load16(uint8_t const *const s)
+{
+    394d:	55                   	push   %rbp
+    394e:	48 89 e5             	mov    %rsp,%rbp
+    3951:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    Line16 v;
+    std::memcpy(&v, s, sizeof(v));
+    3955:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3959:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    395d:	48 8b 00             	mov    (%rax),%rax
+    3960:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    3964:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    return v;
+    3968:	66 0f 6f 45 f0       	movdqa -0x10(%rbp),%xmm0
+}
+    396d:	5d                   	pop    %rbp
+    396e:	c3                   	ret
+
+000000000000396f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>:
+
+static inline void stream16(uint8_t *const d, Line16 const &v)
+{
+    396f:	55                   	push   %rbp
+    3970:	48 89 e5             	mov    %rsp,%rbp
+    3973:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3977:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    397b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    397f:	66 0f 6f 00          	movdqa (%rax),%xmm0
+    3983:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3987:	66 0f e7 00          	movntdq %xmm0,(%rax)
+}
+    398b:	90                   	nop
+    398c:	5d                   	pop    %rbp
+    398d:	c3                   	ret
+
+000000000000398e <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    398e:	          55                   	push   %rbp
+    398f:	          48 89 e5             	mov    %rsp,%rbp
+    3992:	          48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+    3996:	          48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    399a:	          48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    399e:	          48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    if (n < streaming_min) {
+    39a2:	          48 81 7d 88 ff 00 00 	cmpq   $0xff,-0x78(%rbp)
+    39a9:	          00 
+    39aa:	      /-- 77 1c                	ja     39c8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        copy(d, s, n);
+    39ac:	      |   48 8b 55 88          	mov    -0x78(%rbp),%rdx
+    39b0:	      |   48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    39b4:	      |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    39b8:	      |   48 89 ce             	mov    %rcx,%rsi
+    39bb:	      |   48 89 c7             	mov    %rax,%rdi
+    39be:	      |   e8 a6 fd ff ff       	call   3769 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        return;
+    39c3:	/-----|-- e9 98 01 00 00       	jmp    3b60 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1d2>
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    39c8:	|     \-> 48 8b 45 98          	mov    -0x68(%rbp),%rax
+    39cc:	|         48 f7 d8             	neg    %rax
+    39cf:	|         83 e0 0f             	and    $0xf,%eax
+    39d2:	|         48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    copy(d, s, head);
+    39d6:	|         48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    39da:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    39de:	|         48 8b 45 98          	mov    -0x68(%rbp),%rax
+    39e2:	|         48 89 ce             	mov    %rcx,%rsi
+    39e5:	|         48 89 c7             	mov    %rax,%rdi
+    39e8:	|         e8 7c fd ff ff       	call   3769 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    Index i = head;
+    39ed:	|         48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    39f1:	|         48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    39f5:	|     /-- e9 e1 00 00 00       	jmp    3adb <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        Line16 const a = load16(s + i);
+    39fa:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    39fe:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a02:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3a05:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3a08:	|  |  |   e8 40 ff ff ff       	call   394d <nel::elem::load16(unsigned char const*)>
+    3a0d:	|  |  |   0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+        Line16 const b = load16(s + i + 16);
+    3a11:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a15:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    3a19:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3a1d:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3a20:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3a23:	|  |  |   e8 25 ff ff ff       	call   394d <nel::elem::load16(unsigned char const*)>
+    3a28:	|  |  |   0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+        Line16 const c = load16(s + i + 32);
+    3a2c:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a30:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    3a34:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3a38:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3a3b:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3a3e:	|  |  |   e8 0a ff ff ff       	call   394d <nel::elem::load16(unsigned char const*)>
+    3a43:	|  |  |   0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+        Line16 const e = load16(s + i + 48);
+    3a47:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a4b:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    3a4f:	|  |  |   48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3a53:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3a56:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3a59:	|  |  |   e8 ef fe ff ff       	call   394d <nel::elem::load16(unsigned char const*)>
+    3a5e:	|  |  |   0f 29 45 a0          	movaps %xmm0,-0x60(%rbp)
+        stream16(d + i, a);
+    3a62:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    3a66:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a6a:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3a6d:	|  |  |   48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    3a71:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3a74:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3a77:	|  |  |   e8 f3 fe ff ff       	call   396f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, b);
+    3a7c:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a80:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    3a84:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3a88:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3a8b:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3a8f:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3a92:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3a95:	|  |  |   e8 d5 fe ff ff       	call   396f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, c);
+    3a9a:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a9e:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    3aa2:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3aa6:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3aa9:	|  |  |   48 8d 45 b0          	lea    -0x50(%rbp),%rax
+    3aad:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3ab0:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3ab3:	|  |  |   e8 b7 fe ff ff       	call   396f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, e);
+    3ab8:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3abc:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    3ac0:	|  |  |   48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3ac4:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3ac7:	|  |  |   48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    3acb:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3ace:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3ad1:	|  |  |   e8 99 fe ff ff       	call   396f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    3ad6:	|  |  |   48 83 45 f8 40       	addq   $0x40,-0x8(%rbp)
+    3adb:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3adf:	|  |      48 83 c0 40          	add    $0x40,%rax
+    3ae3:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    3ae7:	|  \----- 0f 83 0d ff ff ff    	jae    39fa <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x6c>
+    }
+    for (; i + 16 <= n; i += 16) {
+    3aed:	|     /-- eb 36                	jmp    3b25 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x197>
+        stream16(d + i, load16(s + i));
+    3aef:	|  /--|-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3af3:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3af7:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3afa:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    3afd:	|  |  |   e8 4b fe ff ff       	call   394d <nel::elem::load16(unsigned char const*)>
+    3b02:	|  |  |   0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+    3b06:	|  |  |   48 8b 55 98          	mov    -0x68(%rbp),%rdx
+    3b0a:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3b0e:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3b11:	|  |  |   48 8d 45 e0          	lea    -0x20(%rbp),%rax
+    3b15:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3b18:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3b1b:	|  |  |   e8 4f fe ff ff       	call   396f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    3b20:	|  |  |   48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+    3b25:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3b29:	|  |      48 83 c0 10          	add    $0x10,%rax
+    3b2d:	|  |      48 39 45 88          	cmp    %rax,-0x78(%rbp)
+    3b31:	|  \----- 73 bc                	jae    3aef <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    3b33:	|         0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    3b36:	|         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3b3a:	|         48 2b 45 f8          	sub    -0x8(%rbp),%rax
+    3b3e:	|         48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+    3b42:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3b46:	|         48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    3b4a:	|         48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+    3b4e:	|         48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3b52:	|         48 01 d1             	add    %rdx,%rcx
+    3b55:	|         48 89 c2             	mov    %rax,%rdx
+    3b58:	|         48 89 cf             	mov    %rcx,%rdi
+    3b5b:	|         e8 09 fc ff ff       	call   3769 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+}
+    3b60:	\-------> c9                   	leave
+    3b61:	          c3                   	ret
+
+0000000000003b62 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    3b62:	          55                   	push   %rbp
+    3b63:	          48 89 e5             	mov    %rsp,%rbp
+    3b66:	          48 83 ec 60          	sub    $0x60,%rsp
+    3b6a:	          48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    3b6e:	          48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+    3b72:	          48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    if (n < streaming_min) {
+    3b76:	          48 81 7d a8 ff 00 00 	cmpq   $0xff,-0x58(%rbp)
+    3b7d:	          00 
+    3b7e:	      /-- 77 1c                	ja     3b9c <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3a>
+        set_pattern(d, p, n);
+    3b80:	      |   48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+    3b84:	      |   48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+    3b88:	      |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3b8c:	      |   48 89 ce             	mov    %rcx,%rsi
+    3b8f:	      |   48 89 c7             	mov    %rax,%rdi
+    3b92:	      |   e8 29 fd ff ff       	call   38c0 <nel::elem::set_pattern(unsigned char*, unsigned char const*, unsigned long)>
+    3b97:	/-----|-- e9 89 01 00 00       	jmp    3d25 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c3>
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    3b9c:	|     \-> 48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3ba0:	|         48 f7 d8             	neg    %rax
+    3ba3:	|         83 e0 0f             	and    $0xf,%eax
+    3ba6:	|         48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    for (Index i = 0; i < head; ++i) {
+    3baa:	|         48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    3bb1:	|         00 
+    3bb2:	|     /-- eb 20                	jmp    3bd4 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x72>
+        d[i] = p[i];
+    3bb4:	|  /--|-> 48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+    3bb8:	|  |  |   48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3bbc:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3bbf:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    3bc3:	|  |  |   48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3bc7:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    3bca:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    3bcd:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < head; ++i) {
+    3bcf:	|  |  |   48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    3bd4:	|  |  \-> 48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3bd8:	|  |      48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    3bdc:	|  \----- 72 d6                	jb     3bb4 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x52>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    3bde:	|         48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    3be5:	|         00 
+    3be6:	|     /-- eb 2d                	jmp    3c15 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xb3>
+        rotated[i] = p[(head + i) % 16];
+    3be8:	|  /--|-> 48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    3bec:	|  |  |   48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3bf0:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3bf3:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    3bf6:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    3bf9:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3bfd:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3c00:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    3c03:	|  |  |   48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+    3c07:	|  |  |   48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3c0b:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    3c0e:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (Index i = 0; i < 16; ++i) {
+    3c10:	|  |  |   48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+    3c15:	|  |  \-> 48 83 7d f0 0f       	cmpq   $0xf,-0x10(%rbp)
+    3c1a:	|  \----- 76 cc                	jbe    3be8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x86>
+    }
+    Line16 const v = load16(rotated);
+    3c1c:	|         48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    3c20:	|         48 89 c7             	mov    %rax,%rdi
+    3c23:	|         e8 25 fd ff ff       	call   394d <nel::elem::load16(unsigned char const*)>
+    3c28:	|         0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+    Index i = head;
+    3c2c:	|         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3c30:	|         48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (; i + 64 <= n; i += 64) {
+    3c34:	|     /-- eb 79                	jmp    3caf <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14d>
+        stream16(d + i, v);
+    3c36:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    3c3a:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3c3e:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3c41:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3c45:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3c48:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3c4b:	|  |  |   e8 1f fd ff ff       	call   396f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 16, v);
+    3c50:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3c54:	|  |  |   48 8d 50 10          	lea    0x10(%rax),%rdx
+    3c58:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3c5c:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3c5f:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3c63:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3c66:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3c69:	|  |  |   e8 01 fd ff ff       	call   396f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 32, v);
+    3c6e:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3c72:	|  |  |   48 8d 50 20          	lea    0x20(%rax),%rdx
+    3c76:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3c7a:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3c7d:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3c81:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3c84:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3c87:	|  |  |   e8 e3 fc ff ff       	call   396f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+        stream16(d + i + 48, v);
+    3c8c:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3c90:	|  |  |   48 8d 50 30          	lea    0x30(%rax),%rdx
+    3c94:	|  |  |   48 8b 45 b8          	mov    -0x48(%rbp),%rax
+    3c98:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3c9b:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3c9f:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3ca2:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3ca5:	|  |  |   e8 c5 fc ff ff       	call   396f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 64 <= n; i += 64) {
+    3caa:	|  |  |   48 83 45 e8 40       	addq   $0x40,-0x18(%rbp)
+    3caf:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3cb3:	|  |      48 83 c0 40          	add    $0x40,%rax
+    3cb7:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    3cbb:	|  \----- 0f 83 75 ff ff ff    	jae    3c36 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd4>
+    }
+    for (; i + 16 <= n; i += 16) {
+    3cc1:	|     /-- eb 1f                	jmp    3ce2 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x180>
+        stream16(d + i, v);
+    3cc3:	|  /--|-> 48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    3cc7:	|  |  |   48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3ccb:	|  |  |   48 01 c2             	add    %rax,%rdx
+    3cce:	|  |  |   48 8d 45 c0          	lea    -0x40(%rbp),%rax
+    3cd2:	|  |  |   48 89 c6             	mov    %rax,%rsi
+    3cd5:	|  |  |   48 89 d7             	mov    %rdx,%rdi
+    3cd8:	|  |  |   e8 92 fc ff ff       	call   396f <nel::elem::stream16(unsigned char*, long long __vector(2) const&)>
+    for (; i + 16 <= n; i += 16) {
+    3cdd:	|  |  |   48 83 45 e8 10       	addq   $0x10,-0x18(%rbp)
+    3ce2:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3ce6:	|  |      48 83 c0 10          	add    $0x10,%rax
+    3cea:	|  |      48 39 45 a8          	cmp    %rax,-0x58(%rbp)
+    3cee:	|  \----- 73 d3                	jae    3cc3 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x161>
+    }
+    __builtin_ia32_sfence();
+    3cf0:	|         0f ae f8             	sfence
+    for (; i < n; ++i) {
+    3cf3:	|     /-- eb 26                	jmp    3d1b <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1b9>
+        d[i] = p[i % 16];
+    3cf5:	|  /--|-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3cf9:	|  |  |   83 e0 0f             	and    $0xf,%eax
+    3cfc:	|  |  |   48 89 c2             	mov    %rax,%rdx
+    3cff:	|  |  |   48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    3d03:	|  |  |   48 01 d0             	add    %rdx,%rax
+    3d06:	|  |  |   48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+    3d0a:	|  |  |   48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3d0e:	|  |  |   48 01 ca             	add    %rcx,%rdx
+    3d11:	|  |  |   0f b6 00             	movzbl (%rax),%eax
+    3d14:	|  |  |   88 02                	mov    %al,(%rdx)
+    for (; i < n; ++i) {
+    3d16:	|  |  |   48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+    3d1b:	|  |  \-> 48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3d1f:	|  |      48 3b 45 a8          	cmp    -0x58(%rbp),%rax
+    3d23:	|  \----- 72 d0                	jb     3cf5 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x193>
+    }
+}
+    3d25:	\-------> c9                   	leave
+    3d26:	          c3                   	ret
+
+0000000000003d27 <nel::offset_of(unsigned char*, unsigned long)>:
+// The payload is the first align boundary leaving room for a Length in front,
+// which holds the offset from the start of the underlying allocation.
+// Malloc alignment is at least alignof(Length), so the payload is at most
+// align bytes in.
+static Length offset_of(uint8_t *const base, Length const align)
+{
+    3d27:	55                   	push   %rbp
+    3d28:	48 89 e5             	mov    %rsp,%rbp
+    3d2b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3d2f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    USize const a = reinterpret_cast<USize>(base) + sizeof(Length);
+    3d33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3d37:	48 83 c0 08          	add    $0x8,%rax
+    3d3b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    3d3f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3d43:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3d47:	48 01 d0             	add    %rdx,%rax
+    3d4a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    3d4e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3d52:	48 f7 d8             	neg    %rax
+    3d55:	48 21 c2             	and    %rax,%rdx
+    3d58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3d5c:	48 29 c2             	sub    %rax,%rdx
+    3d5f:	48 89 d0             	mov    %rdx,%rax
+}
+    3d62:	5d                   	pop    %rbp
+    3d63:	c3                   	ret
+
+0000000000003d64 <nel::offset_field(unsigned char*)>:
+
+static Length &offset_field(uint8_t *const p)
+{
+    3d64:	55                   	push   %rbp
+    3d65:	48 89 e5             	mov    %rsp,%rbp
+    3d68:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    return reinterpret_cast<Length *>(p)[-1];
+    3d6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3d70:	48 83 e8 08          	sub    $0x8,%rax
+}
+    3d74:	5d                   	pop    %rbp
+    3d75:	c3                   	ret
+
+0000000000003d76 <nel::free_aligned(void*)>:
+
+void free_aligned(void *const p)
+{
+    3d76:	       55                   	push   %rbp
+    3d77:	       48 89 e5             	mov    %rsp,%rbp
+    3d7a:	       48 83 ec 20          	sub    $0x20,%rsp
+    3d7e:	       48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    if (p == nullptr) { return; }
+    3d82:	       48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3d87:	/----- 74 2e                	je     3db7 <nel::free_aligned(void*)+0x41>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    3d89:	|      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3d8d:	|      48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    std::free(u8p - offset_field(u8p));
+    3d91:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3d95:	|      48 89 c7             	mov    %rax,%rdi
+    3d98:	|      e8 c7 ff ff ff       	call   3d64 <nel::offset_field(unsigned char*)>
+    3d9d:	|      48 8b 00             	mov    (%rax),%rax
+    3da0:	|      48 f7 d8             	neg    %rax
+    3da3:	|      48 89 c2             	mov    %rax,%rdx
+    3da6:	|      48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3daa:	|      48 01 d0             	add    %rdx,%rax
+    3dad:	|      48 89 c7             	mov    %rax,%rdi
+    3db0:	|      e8 7b d2 ff ff       	call   1030 <free@plt>
+    3db5:	|  /-- eb 01                	jmp    3db8 <nel::free_aligned(void*)+0x42>
+    if (p == nullptr) { return; }
+    3db7:	\--|-> 90                   	nop
+}
+    3db8:	   \-> c9                   	leave
+    3db9:	       c3                   	ret
+
+0000000000003dba <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    3dba:	             55                   	push   %rbp
+    3dbb:	             48 89 e5             	mov    %rsp,%rbp
+    3dbe:	             53                   	push   %rbx
+    3dbf:	             48 83 ec 78          	sub    $0x78,%rsp
+    3dc3:	             48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+    3dc7:	             48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    3dcb:	             48 89 55 88          	mov    %rdx,-0x78(%rbp)
+    3dcf:	             48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    3dd3:	             48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    3dd7:	             b9 f3 00 00 00       	mov    $0xf3,%ecx
+    3ddc:	             48 8d 15 9d 13 00 00 	lea    0x139d(%rip),%rdx        # 5180 <nel::elem::streaming_min+0x8>
+    3de3:	             48 8d 35 a8 13 00 00 	lea    0x13a8(%rip),%rsi        # 5192 <nel::elem::streaming_min+0x1a>
+    3dea:	             48 89 c7             	mov    %rax,%rdi
+    3ded:	             e8 4e dc ff ff       	call   1a40 <nel::Context::Context(char const*, char const*, int)>
+    3df2:	             48 83 7d 90 00       	cmpq   $0x0,-0x70(%rbp)
+    3df7:	      /----- 74 18                	je     3e11 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    3df9:	      |      48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3dfd:	      |      48 83 e8 01          	sub    $0x1,%rax
+    3e01:	      |      48 23 45 90          	and    -0x70(%rbp),%rax
+    3e05:	      |      48 85 c0             	test   %rax,%rax
+    3e08:	      +----- 75 07                	jne    3e11 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x57>
+    3e0a:	      |      b8 01 00 00 00       	mov    $0x1,%eax
+    3e0f:	      |  /-- eb 05                	jmp    3e16 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x5c>
+    3e11:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3e16:	         \-> 0f b6 c0             	movzbl %al,%eax
+    3e19:	             48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    3e1d:	             48 8d 0d 7e 13 00 00 	lea    0x137e(%rip),%rcx        # 51a2 <nel::elem::streaming_min+0x2a>
+    3e24:	             48 89 ce             	mov    %rcx,%rsi
+    3e27:	             89 c7                	mov    %eax,%edi
+    3e29:	             e8 49 dc ff ff       	call   1a77 <nel::assert(bool, char const*, nel::Context const&)>
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    3e2e:	             48 8b 45 98          	mov    -0x68(%rbp),%rax
+    3e32:	             48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    3e36:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3e3b:	      /----- 74 11                	je     3e4e <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x94>
+    3e3d:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3e41:	      |      48 89 c7             	mov    %rax,%rdi
+    3e44:	      |      e8 1b ff ff ff       	call   3d64 <nel::offset_field(unsigned char*)>
+    3e49:	      |      48 8b 00             	mov    (%rax),%rax
+    3e4c:	      |  /-- eb 05                	jmp    3e53 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x99>
+    3e4e:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3e53:	         \-> 48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    3e57:	             48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3e5c:	      /----- 74 13                	je     3e71 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb7>
+    3e5e:	      |      48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3e62:	      |      48 f7 d8             	neg    %rax
+    3e65:	      |      48 89 c2             	mov    %rax,%rdx
+    3e68:	      |      48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3e6c:	      |      48 01 d0             	add    %rdx,%rax
+    3e6f:	      |  /-- eb 05                	jmp    3e76 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xbc>
+    3e71:	      \--|-> b8 00 00 00 00       	mov    $0x0,%eax
+    3e76:	         \-> 48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    3e7a:	             48 8b 55 80          	mov    -0x80(%rbp),%rdx
+    3e7e:	             48 8b 45 90          	mov    -0x70(%rbp),%rax
+    3e82:	             48 01 c2             	add    %rax,%rdx
+    3e85:	             48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3e89:	             48 89 d6             	mov    %rdx,%rsi
+    3e8c:	             48 89 c7             	mov    %rax,%rdi
+    3e8f:	             e8 1c d2 ff ff       	call   10b0 <realloc@plt>
+    3e94:	             48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if (new_base == nullptr) { return nullptr; }
+    3e98:	             48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    3e9d:	         /-- 75 0a                	jne    3ea9 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    3e9f:	         |   b8 00 00 00 00       	mov    $0x0,%eax
+    3ea4:	/--------|-- e9 85 00 00 00       	jmp    3f2e <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x174>
+
+    Length const new_offset = offset_of(new_base, align);
+    3ea9:	|        \-> 48 8b 55 90          	mov    -0x70(%rbp),%rdx
+    3ead:	|            48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3eb1:	|            48 89 d6             	mov    %rdx,%rsi
+    3eb4:	|            48 89 c7             	mov    %rax,%rdi
+    3eb7:	|            e8 6b fe ff ff       	call   3d27 <nel::offset_of(unsigned char*, unsigned long)>
+    3ebc:	|            48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    uint8_t *const new_p = new_base + new_offset;
+    3ec0:	|            48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    3ec4:	|            48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3ec8:	|            48 01 d0             	add    %rdx,%rax
+    3ecb:	|            48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    if (old_p != nullptr && new_offset != old_offset) {
+    3ecf:	|            48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3ed4:	|  /-------- 74 41                	je     3f17 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+    3ed6:	|  |         48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3eda:	|  |         48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+    3ede:	|  +-------- 74 37                	je     3f17 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x15d>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+    3ee0:	|  |         48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3ee4:	|  |         48 3b 45 80          	cmp    -0x80(%rbp),%rax
+    3ee8:	|  |  /----- 73 06                	jae    3ef0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x136>
+    3eea:	|  |  |      48 8b 45 88          	mov    -0x78(%rbp),%rax
+    3eee:	|  |  |  /-- eb 04                	jmp    3ef4 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x13a>
+    3ef0:	|  |  \--|-> 48 8b 45 80          	mov    -0x80(%rbp),%rax
+    3ef4:	|  |     \-> 48 89 45 b8          	mov    %rax,-0x48(%rbp)
+        std::memmove(new_p, new_base + old_offset, n);
+    3ef8:	|  |         48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    3efc:	|  |         48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3f00:	|  |         48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    3f04:	|  |         48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+    3f08:	|  |         48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    3f0c:	|  |         48 89 ce             	mov    %rcx,%rsi
+    3f0f:	|  |         48 89 c7             	mov    %rax,%rdi
+    3f12:	|  |         e8 a9 d1 ff ff       	call   10c0 <memmove@plt>
+    }
+    offset_field(new_p) = new_offset;
+    3f17:	|  \-------> 48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+    3f1b:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    3f1f:	|            48 89 c7             	mov    %rax,%rdi
+    3f22:	|            e8 3d fe ff ff       	call   3d64 <nel::offset_field(unsigned char*)>
+    3f27:	|            48 89 18             	mov    %rbx,(%rax)
+    return new_p;
+    3f2a:	|            48 8b 45 c0          	mov    -0x40(%rbp),%rax
+}
+    3f2e:	\----------> 48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    3f32:	             c9                   	leave
+    3f33:	             c3                   	ret
+
+0000000000003f34 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    3f34:	55                   	push   %rbp
+    3f35:	48 89 e5             	mov    %rsp,%rbp
+    3f38:	48 83 ec 10          	sub    $0x10,%rsp
+    3f3c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3f40:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    return realloc_aligned(nullptr, align, 0, size);
+    3f44:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3f48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f4c:	48 89 d1             	mov    %rdx,%rcx
+    3f4f:	ba 00 00 00 00       	mov    $0x0,%edx
+    3f54:	48 89 c6             	mov    %rax,%rsi
+    3f57:	bf 00 00 00 00       	mov    $0x0,%edi
+    3f5c:	e8 59 fe ff ff       	call   3dba <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+}
+    3f61:	c9                   	leave
+    3f62:	c3                   	ret
+
+0000000000003f63 <nel::elem::poison(unsigned char*, unsigned long)>:
+{
+    3f63:	55                   	push   %rbp
+    3f64:	48 89 e5             	mov    %rsp,%rbp
+    3f67:	48 83 ec 10          	sub    $0x10,%rsp
+    3f6b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3f6f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    copy(d, s, n);
+    3f73:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3f77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f7b:	48 89 d6             	mov    %rdx,%rsi
+    3f7e:	48 89 c7             	mov    %rax,%rdi
+    3f81:	e8 ae f8 ff ff       	call   3834 <nel::elem::wipe(unsigned char*, unsigned long)>
+}
+    3f86:	90                   	nop
+    3f87:	c9                   	leave
+    3f88:	c3                   	ret
+
+0000000000003f89 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    3f89:	55                   	push   %rbp
+    3f8a:	48 89 e5             	mov    %rsp,%rbp
+    3f8d:	48 83 ec 10          	sub    $0x10,%rsp
+    3f91:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3f95:	89 f0                	mov    %esi,%eax
+    3f97:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%c", v);
+    3f9a:	0f be 45 f4          	movsbl -0xc(%rbp),%eax
+    3f9e:	48 8b 15 bb 40 00 00 	mov    0x40bb(%rip),%rdx        # 8060 <stderr@GLIBC_2.2.5>
+    3fa5:	48 89 d6             	mov    %rdx,%rsi
+    3fa8:	89 c7                	mov    %eax,%edi
+    3faa:	e8 c1 d0 ff ff       	call   1070 <fputc@plt>
+    return outs;
+    3faf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3fb3:	c9                   	leave
+    3fb4:	c3                   	ret
+
+0000000000003fb5 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    3fb5:	55                   	push   %rbp
+    3fb6:	48 89 e5             	mov    %rsp,%rbp
+    3fb9:	48 83 ec 10          	sub    $0x10,%rsp
+    3fbd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3fc1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%s", v);
+    3fc5:	48 8b 15 94 40 00 00 	mov    0x4094(%rip),%rdx        # 8060 <stderr@GLIBC_2.2.5>
+    3fcc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3fd0:	48 89 d6             	mov    %rdx,%rsi
+    3fd3:	48 89 c7             	mov    %rax,%rdi
+    3fd6:	e8 75 d0 ff ff       	call   1050 <fputs@plt>
+    return outs;
+    3fdb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3fdf:	c9                   	leave
+    3fe0:	c3                   	ret
+
+0000000000003fe1 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    3fe1:	55                   	push   %rbp
+    3fe2:	48 89 e5             	mov    %rsp,%rbp
+    3fe5:	48 83 ec 10          	sub    $0x10,%rsp
+    3fe9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3fed:	89 f0                	mov    %esi,%eax
+    3fef:	88 45 f4             	mov    %al,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu8, v);
+    3ff2:	0f b6 55 f4          	movzbl -0xc(%rbp),%edx
+    3ff6:	48 8b 05 63 40 00 00 	mov    0x4063(%rip),%rax        # 8060 <stderr@GLIBC_2.2.5>
+    3ffd:	48 8d 0d b9 11 00 00 	lea    0x11b9(%rip),%rcx        # 51bd <nel::elem::streaming_min+0x45>
+    4004:	48 89 ce             	mov    %rcx,%rsi
+    4007:	48 89 c7             	mov    %rax,%rdi
+    400a:	b8 00 00 00 00       	mov    $0x0,%eax
+    400f:	e8 7c d0 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    4014:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    4018:	c9                   	leave
+    4019:	c3                   	ret
+
+000000000000401a <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    401a:	55                   	push   %rbp
+    401b:	48 89 e5             	mov    %rsp,%rbp
+    401e:	48 83 ec 10          	sub    $0x10,%rsp
+    4022:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4026:	89 f0                	mov    %esi,%eax
+    4028:	66 89 45 f4          	mov    %ax,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu16, v);
+    402c:	0f b7 55 f4          	movzwl -0xc(%rbp),%edx
+    4030:	48 8b 05 29 40 00 00 	mov    0x4029(%rip),%rax        # 8060 <stderr@GLIBC_2.2.5>
+    4037:	48 8d 0d 7f 11 00 00 	lea    0x117f(%rip),%rcx        # 51bd <nel::elem::streaming_min+0x45>
+    403e:	48 89 ce             	mov    %rcx,%rsi
+    4041:	48 89 c7             	mov    %rax,%rdi
+    4044:	b8 00 00 00 00       	mov    $0x0,%eax
+    4049:	e8 42 d0 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    404e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    4052:	c9                   	leave
+    4053:	c3                   	ret
+
+0000000000004054 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    4054:	55                   	push   %rbp
+    4055:	48 89 e5             	mov    %rsp,%rbp
+    4058:	48 83 ec 10          	sub    $0x10,%rsp
+    405c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4060:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%" PRIu32, v);
+    4063:	48 8b 05 f6 3f 00 00 	mov    0x3ff6(%rip),%rax        # 8060 <stderr@GLIBC_2.2.5>
+    406a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    406d:	48 8d 0d 49 11 00 00 	lea    0x1149(%rip),%rcx        # 51bd <nel::elem::streaming_min+0x45>
+    4074:	48 89 ce             	mov    %rcx,%rsi
+    4077:	48 89 c7             	mov    %rax,%rdi
+    407a:	b8 00 00 00 00       	mov    $0x0,%eax
+    407f:	e8 0c d0 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    4084:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    4088:	c9                   	leave
+    4089:	c3                   	ret
+
+000000000000408a <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    408a:	55                   	push   %rbp
+    408b:	48 89 e5             	mov    %rsp,%rbp
+    408e:	48 83 ec 10          	sub    $0x10,%rsp
+    4092:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    4096:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    fprintf(stderr, "%u", v);
+    4099:	48 8b 05 c0 3f 00 00 	mov    0x3fc0(%rip),%rax        # 8060 <stderr@GLIBC_2.2.5>
+    40a0:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    40a3:	48 8d 0d 13 11 00 00 	lea    0x1113(%rip),%rcx        # 51bd <nel::elem::streaming_min+0x45>
+    40aa:	48 89 ce             	mov    %rcx,%rsi
+    40ad:	48 89 c7             	mov    %rax,%rdi
+    40b0:	b8 00 00 00 00       	mov    $0x0,%eax
+    40b5:	e8 d6 cf ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    40ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    40be:	c9                   	leave
+    40bf:	c3                   	ret
+
+00000000000040c0 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    40c0:	55                   	push   %rbp
+    40c1:	48 89 e5             	mov    %rsp,%rbp
+    40c4:	48 83 ec 10          	sub    $0x10,%rsp
+    40c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    40cc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    fprintf(stderr, "%lu", v);
+    40d0:	48 8b 05 89 3f 00 00 	mov    0x3f89(%rip),%rax        # 8060 <stderr@GLIBC_2.2.5>
+    40d7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    40db:	48 8d 0d de 10 00 00 	lea    0x10de(%rip),%rcx        # 51c0 <nel::elem::streaming_min+0x48>
+    40e2:	48 89 ce             	mov    %rcx,%rsi
+    40e5:	48 89 c7             	mov    %rax,%rdi
+    40e8:	b8 00 00 00 00       	mov    $0x0,%eax
+    40ed:	e8 9e cf ff ff       	call   1090 <fprintf@plt>
+    return outs;
+    40f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    40f6:	c9                   	leave
+    40f7:	c3                   	ret
+
+Disassembly of section .fini:
+
+00000000000040f8 <_fini>:
+    40f8:	48 83 ec 08          	sub    $0x8,%rsp
+    40fc:	48 83 c4 08          	add    $0x8,%rsp
+    4100:	c3                   	ret
@@ -0,0 +1,1022 @@
+
+target/fast/examples/bench_growth:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <clock_gettime@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <clock_gettime@GLIBC_2.17>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputc@plt>:
+    1060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 4018 <fputc@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fprintf@plt>:
+    1070:	ff 25 aa 2f 00 00    	jmp    *0x2faa(%rip)        # 4020 <fprintf@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <malloc@plt>:
+    1080:	ff 25 a2 2f 00 00    	jmp    *0x2fa2(%rip)        # 4028 <malloc@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <realloc@plt>:
+    1090:	ff 25 9a 2f 00 00    	jmp    *0x2f9a(%rip)        # 4030 <realloc@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010a0 <__cxa_finalize@plt>:
+    10a0:	ff 25 3a 2f 00 00    	jmp    *0x2f3a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10a6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010b0 <main>:
+    nel::log << "  reallocs: " << Counting::reallocs << ", bytes moved (at most): "
+             << Counting::bytes << '\n';
+}
+
+int main()
+{
+    10b0:	48 83 ec 08          	sub    $0x8,%rsp
+    bench_push<nel::heaped::GeometricGrowth<2, 1>>("push 10M, geometric 2x");
+    10b4:	48 8d 3d 73 0f 00 00 	lea    0xf73(%rip),%rdi        # 202e <_IO_stdin_used+0x2e>
+    10bb:	e8 90 01 00 00       	call   1250 <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)>
+    bench_push<nel::heaped::GeometricGrowth<3, 2>>("push 10M, geometric 1.5x");
+    10c0:	48 8d 3d 7e 0f 00 00 	lea    0xf7e(%rip),%rdi        # 2045 <_IO_stdin_used+0x45>
+    10c7:	e8 e4 03 00 00       	call   14b0 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)>
+    bench_push<nel::heaped::LinearGrowth<16>>("push 10M, linear 16");
+    10cc:	48 8d 3d 8b 0f 00 00 	lea    0xf8b(%rip),%rdi        # 205e <_IO_stdin_used+0x5e>
+    10d3:	e8 48 06 00 00       	call   1720 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)>
+}
+    10d8:	31 c0                	xor    %eax,%eax
+    10da:	48 83 c4 08          	add    $0x8,%rsp
+    10de:	c3                   	ret
+    10df:	90                   	nop
+
+00000000000010e0 <_start>:
+    10e0:	31 ed                	xor    %ebp,%ebp
+    10e2:	49 89 d1             	mov    %rdx,%r9
+    10e5:	5e                   	pop    %rsi
+    10e6:	48 89 e2             	mov    %rsp,%rdx
+    10e9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    10ed:	50                   	push   %rax
+    10ee:	54                   	push   %rsp
+    10ef:	45 31 c0             	xor    %r8d,%r8d
+    10f2:	31 c9                	xor    %ecx,%ecx
+    10f4:	48 8d 3d b5 ff ff ff 	lea    -0x4b(%rip),%rdi        # 10b0 <main>
+    10fb:	ff 15 bf 2e 00 00    	call   *0x2ebf(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    1101:	f4                   	hlt
+    1102:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1109:	00 00 00 
+    110c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001110 <deregister_tm_clones>:
+    1110:	    48 8d 3d 31 2f 00 00 	lea    0x2f31(%rip),%rdi        # 4048 <__TMC_END__>
+    1117:	    48 8d 05 2a 2f 00 00 	lea    0x2f2a(%rip),%rax        # 4048 <__TMC_END__>
+    111e:	    48 39 f8             	cmp    %rdi,%rax
+    1121:	/-- 74 15                	je     1138 <deregister_tm_clones+0x28>
+    1123:	|   48 8b 05 9e 2e 00 00 	mov    0x2e9e(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    112a:	|   48 85 c0             	test   %rax,%rax
+    112d:	+-- 74 09                	je     1138 <deregister_tm_clones+0x28>
+    112f:	|   ff e0                	jmp    *%rax
+    1131:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1138:	\-> c3                   	ret
+    1139:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001140 <register_tm_clones>:
+    1140:	    48 8d 3d 01 2f 00 00 	lea    0x2f01(%rip),%rdi        # 4048 <__TMC_END__>
+    1147:	    48 8d 35 fa 2e 00 00 	lea    0x2efa(%rip),%rsi        # 4048 <__TMC_END__>
+    114e:	    48 29 fe             	sub    %rdi,%rsi
+    1151:	    48 89 f0             	mov    %rsi,%rax
+    1154:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1158:	    48 c1 f8 03          	sar    $0x3,%rax
+    115c:	    48 01 c6             	add    %rax,%rsi
+    115f:	    48 d1 fe             	sar    %rsi
+    1162:	/-- 74 14                	je     1178 <register_tm_clones+0x38>
+    1164:	|   48 8b 05 6d 2e 00 00 	mov    0x2e6d(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    116b:	|   48 85 c0             	test   %rax,%rax
+    116e:	+-- 74 08                	je     1178 <register_tm_clones+0x38>
+    1170:	|   ff e0                	jmp    *%rax
+    1172:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1178:	\-> c3                   	ret
+    1179:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001180 <__do_global_dtors_aux>:
+    1180:	       f3 0f 1e fa          	endbr64
+    1184:	       80 3d dd 2e 00 00 00 	cmpb   $0x0,0x2edd(%rip)        # 4068 <completed.0>
+    118b:	/----- 75 2b                	jne    11b8 <__do_global_dtors_aux+0x38>
+    118d:	|      55                   	push   %rbp
+    118e:	|      48 83 3d 4a 2e 00 00 	cmpq   $0x0,0x2e4a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1195:	|      00 
+    1196:	|      48 89 e5             	mov    %rsp,%rbp
+    1199:	|  /-- 74 0c                	je     11a7 <__do_global_dtors_aux+0x27>
+    119b:	|  |   48 8b 3d 9e 2e 00 00 	mov    0x2e9e(%rip),%rdi        # 4040 <__dso_handle>
+    11a2:	|  |   e8 f9 fe ff ff       	call   10a0 <__cxa_finalize@plt>
+    11a7:	|  \-> e8 64 ff ff ff       	call   1110 <deregister_tm_clones>
+    11ac:	|      c6 05 b5 2e 00 00 01 	movb   $0x1,0x2eb5(%rip)        # 4068 <completed.0>
+    11b3:	|      5d                   	pop    %rbp
+    11b4:	|      c3                   	ret
+    11b5:	|      0f 1f 00             	nopl   (%rax)
+    11b8:	\----> c3                   	ret
+    11b9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011c0 <frame_dummy>:
+    11c0:	f3 0f 1e fa          	endbr64
+    11c4:	e9 77 ff ff ff       	jmp    1140 <register_tm_clones>
+    11c9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011d0 <_close_r>:
+#include <nel/heaped/vector.hh>
+    11d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11d5:	c3                   	ret
+    11d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    11dd:	00 00 00 
+
+00000000000011e0 <_fstat_r>:
+#include <nel/log.hh>
+    11e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11e5:	c3                   	ret
+    11e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    11ed:	00 00 00 
+
+00000000000011f0 <_kill_r>:
+
+    11f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11f5:	c3                   	ret
+    11f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    11fd:	00 00 00 
+
+0000000000001200 <_lseek_r>:
+// Allocator counting reallocs and the bytes they may have had to copy.
+    1200:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1205:	c3                   	ret
+    1206:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    120d:	00 00 00 
+
+0000000000001210 <_read_r>:
+struct Counting
+    1210:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1215:	c3                   	ret
+    1216:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    121d:	00 00 00 
+
+0000000000001220 <_write_r>:
+
+    1220:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1225:	c3                   	ret
+    1226:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    122d:	00 00 00 
+
+0000000000001230 <_getpid_r>:
+        {
+    1230:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1235:	c3                   	ret
+    1236:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    123d:	00 00 00 
+
+0000000000001240 <_isatty_r>:
+            return try_realloc(nullptr, align, 0, size);
+    1240:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1245:	c3                   	ret
+    1246:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    124d:	00 00 00 
+
+0000000000001250 <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)>:
+void bench_push(char const *const name)
+    1250:	                               41 57                	push   %r15
+    1252:	                               41 56                	push   %r14
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    1254:	                               45 31 f6             	xor    %r14d,%r14d
+void bench_push(char const *const name)
+    1257:	                               41 55                	push   %r13
+    1259:	                               41 54                	push   %r12
+    125b:	                               55                   	push   %rbp
+    125c:	                               53                   	push   %rbx
+    125d:	                               48 83 ec 28          	sub    $0x28,%rsp
+    Counting::reallocs = 0;
+    1261:	                               48 c7 05 0c 2e 00 00 	movq   $0x0,0x2e0c(%rip)        # 4078 <Counting::reallocs>
+    1268:	                               00 00 00 00 
+{
+
+inline long unsigned int now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    126c:	                               4c 8d 6c 24 10       	lea    0x10(%rsp),%r13
+void bench_push(char const *const name)
+    1271:	                               48 89 7c 24 08       	mov    %rdi,0x8(%rsp)
+    1276:	                               bf 01 00 00 00       	mov    $0x1,%edi
+    Counting::bytes = 0;
+    127b:	                               48 c7 05 ea 2d 00 00 	movq   $0x0,0x2dea(%rip)        # 4070 <Counting::bytes>
+    1282:	                               00 00 00 00 
+    1286:	                               4c 89 ee             	mov    %r13,%rsi
+    1289:	                               e8 b2 fd ff ff       	call   1040 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    128e:	                               4c 8b 7c 24 18       	mov    0x18(%rsp),%r15
+    1293:	                               48 69 44 24 10 00 ca 	imul   $0x3b9aca00,0x10(%rsp),%rax
+    129a:	                               9a 3b 
+    129c:	                               48 89 04 24          	mov    %rax,(%rsp)
+            if (align == 0 || (align & (align - 1)) != 0) {
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+            }
+            void *const new_p = is_over_aligned(align)
+                                    ? realloc_aligned(p, align, old_size, new_size)
+                                    : std::realloc(p, new_size);
+    12a0:	/----------------------------> bf 24 00 00 00       	mov    $0x24,%edi
+            reallocs += 1;
+    12a5:	|                              48 83 05 cb 2d 00 00 	addq   $0x1,0x2dcb(%rip)        # 4078 <Counting::reallocs>
+    12ac:	|                              01 
+    12ad:	|                              e8 ce fd ff ff       	call   1080 <malloc@plt>
+    12b2:	|                              49 89 c4             	mov    %rax,%r12
+            if (new_p == nullptr) {
+    12b5:	|                              48 85 c0             	test   %rax,%rax
+    12b8:	|  /-------------------------- 0f 84 da 01 00 00    	je     1498 <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0x248>
+                    // poison new memory,
+                    // assumes realloc adds to end
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+                }
+            }
+            new_n->alloc_ = new_cap;
+    12be:	|  |                           66 0f 6f 05 ba 0d 00 	movdqa 0xdba(%rip),%xmm0        # 2080 <_IO_stdin_used+0x80>
+    12c5:	|  |                           00 
+            return alloc_;
+        }
+
+        constexpr Length len(void) const
+        {
+            return len_;
+    12c6:	|  |                           31 d2                	xor    %edx,%edx
+            if (new_cap > max_capacity) { return nullptr; }
+    12c8:	|  |                           48 bd f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rbp
+    12cf:	|  |                           ff ff 1f 
+            new_n->alloc_ = new_cap;
+    12d2:	|  |                           0f 11 00             	movups %xmm0,(%rax)
+    12d5:	|  |                           b8 01 00 00 00       	mov    $0x1,%eax
+            v.push(int(i)).is_ok();
+    12da:	|  |  /----------------------> 45 89 74 94 10       	mov    %r14d,0x10(%r12,%rdx,4)
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    12df:	|  |  |                        49 83 c6 01          	add    $0x1,%r14
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+            len_ += 1;
+    12e3:	|  |  |                        49 89 44 24 08       	mov    %rax,0x8(%r12)
+    12e8:	|  |  |                        49 81 fe 80 96 98 00 	cmp    $0x989680,%r14
+    12ef:	|  |  |                 /----- 74 2c                	je     131d <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0xcd>
+            return len_;
+    12f1:	|  |  |                 |  /-> 49 8b 54 24 08       	mov    0x8(%r12),%rdx
+            return alloc_;
+    12f6:	|  |  |                 |  |   49 8b 0c 24          	mov    (%r12),%rcx
+
+    private:
+        // Make room for n more values, only ever grows.
+        bool try_reserve_for(Count const n)
+        {
+            if (len() + n <= capacity()) { return true; }
+    12fa:	|  |  |                 |  |   48 8d 42 01          	lea    0x1(%rdx),%rax
+    12fe:	|  |  |                 |  |   48 39 c1             	cmp    %rax,%rcx
+    1301:	|  |  |              /--|--|-- 0f 82 f9 00 00 00    	jb     1400 <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0x1b0>
+            if (len() >= capacity()) {
+    1307:	|  |  |  /-----------|--|--|-> 48 39 ca             	cmp    %rcx,%rdx
+    130a:	|  |  |  |     /-----|--|--|-- 0f 82 5b 01 00 00    	jb     146b <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0x21b>
+    1310:	|  |  |  |     |  /--|--|--|-> 49 83 c6 01          	add    $0x1,%r14
+    1314:	|  |  |  |     |  |  |  |  |   49 81 fe 80 96 98 00 	cmp    $0x989680,%r14
+    131b:	|  |  |  |     |  |  |  |  \-- 75 d4                	jne    12f1 <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0xa1>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    131d:	|  |  |  |     |  |  |  \----> 4c 89 e7             	mov    %r12,%rdi
+    1320:	|  |  |  |     |  |  |         e8 0b fd ff ff       	call   1030 <free@plt>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1325:	|  |  |  |  /--|--|--|-------> 4c 89 ee             	mov    %r13,%rsi
+    1328:	|  |  |  |  |  |  |  |         bf 01 00 00 00       	mov    $0x1,%edi
+
+// Log a result line: name, time and (if bytes given) bandwidth.
+inline void report(char const *const name, long unsigned int const ns,
+                   long unsigned int const bytes = 0)
+{
+    nel::log << name << ": " << ns / 1000UL << "us";
+    132d:	|  |  |  |  |  |  |  |         48 8d 2d 4c 2d 00 00 	lea    0x2d4c(%rip),%rbp        # 4080 <nel::log>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1334:	|  |  |  |  |  |  |  |         e8 07 fd ff ff       	call   1040 <clock_gettime@plt>
+    return now_ns() - b;
+    1339:	|  |  |  |  |  |  |  |         48 8b 04 24          	mov    (%rsp),%rax
+    nel::log << name << ": " << ns / 1000UL << "us";
+    133d:	|  |  |  |  |  |  |  |         48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    1342:	|  |  |  |  |  |  |  |         48 89 ef             	mov    %rbp,%rdi
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1345:	|  |  |  |  |  |  |  |         48 69 5c 24 10 00 ca 	imul   $0x3b9aca00,0x10(%rsp),%rbx
+    134c:	|  |  |  |  |  |  |  |         9a 3b 
+    134e:	|  |  |  |  |  |  |  |         4c 29 fb             	sub    %r15,%rbx
+    return now_ns() - b;
+    1351:	|  |  |  |  |  |  |  |         48 03 5c 24 18       	add    0x18(%rsp),%rbx
+    1356:	|  |  |  |  |  |  |  |         48 29 c3             	sub    %rax,%rbx
+    nel::log << name << ": " << ns / 1000UL << "us";
+    1359:	|  |  |  |  |  |  |  |         e8 22 06 00 00       	call   1980 <nel::operator<<(nel::Log&, char const*)>
+    135e:	|  |  |  |  |  |  |  |         48 8d 35 c6 0c 00 00 	lea    0xcc6(%rip),%rsi        # 202b <_IO_stdin_used+0x2b>
+    1365:	|  |  |  |  |  |  |  |         48 c1 eb 03          	shr    $0x3,%rbx
+    1369:	|  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    136c:	|  |  |  |  |  |  |  |         e8 0f 06 00 00       	call   1980 <nel::operator<<(nel::Log&, char const*)>
+    1371:	|  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    1374:	|  |  |  |  |  |  |  |         48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    137b:	|  |  |  |  |  |  |  |         9b c4 20 
+    137e:	|  |  |  |  |  |  |  |         48 f7 e3             	mul    %rbx
+    1381:	|  |  |  |  |  |  |  |         48 89 d6             	mov    %rdx,%rsi
+    1384:	|  |  |  |  |  |  |  |         48 c1 ee 04          	shr    $0x4,%rsi
+    1388:	|  |  |  |  |  |  |  |         e8 b3 06 00 00       	call   1a40 <nel::operator<<(nel::Log&, unsigned long)>
+    138d:	|  |  |  |  |  |  |  |         48 8d 35 70 0c 00 00 	lea    0xc70(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    1394:	|  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    1397:	|  |  |  |  |  |  |  |         e8 e4 05 00 00       	call   1980 <nel::operator<<(nel::Log&, char const*)>
+    if (bytes != 0 && ns != 0) {
+        // bytes/ns == GB/s, scaled to MB/s
+        nel::log << ", " << (bytes * 1000UL) / ns << "MB/s";
+    }
+    nel::log << '\n';
+    139c:	|  |  |  |  |  |  |  |         48 89 ef             	mov    %rbp,%rdi
+    139f:	|  |  |  |  |  |  |  |         be 0a 00 00 00       	mov    $0xa,%esi
+    13a4:	|  |  |  |  |  |  |  |         e8 b7 05 00 00       	call   1960 <nel::operator<<(nel::Log&, char)>
+             << Counting::bytes << '\n';
+    13a9:	|  |  |  |  |  |  |  |         48 89 ef             	mov    %rbp,%rdi
+    13ac:	|  |  |  |  |  |  |  |         48 8d 35 54 0c 00 00 	lea    0xc54(%rip),%rsi        # 2007 <_IO_stdin_used+0x7>
+    13b3:	|  |  |  |  |  |  |  |         e8 c8 05 00 00       	call   1980 <nel::operator<<(nel::Log&, char const*)>
+    13b8:	|  |  |  |  |  |  |  |         48 8b 35 b9 2c 00 00 	mov    0x2cb9(%rip),%rsi        # 4078 <Counting::reallocs>
+    13bf:	|  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    13c2:	|  |  |  |  |  |  |  |         e8 79 06 00 00       	call   1a40 <nel::operator<<(nel::Log&, unsigned long)>
+    13c7:	|  |  |  |  |  |  |  |         48 8d 35 46 0c 00 00 	lea    0xc46(%rip),%rsi        # 2014 <_IO_stdin_used+0x14>
+    13ce:	|  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    13d1:	|  |  |  |  |  |  |  |         e8 aa 05 00 00       	call   1980 <nel::operator<<(nel::Log&, char const*)>
+    13d6:	|  |  |  |  |  |  |  |         48 8b 35 93 2c 00 00 	mov    0x2c93(%rip),%rsi        # 4070 <Counting::bytes>
+    13dd:	|  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    13e0:	|  |  |  |  |  |  |  |         e8 5b 06 00 00       	call   1a40 <nel::operator<<(nel::Log&, unsigned long)>
+}
+    13e5:	|  |  |  |  |  |  |  |         48 83 c4 28          	add    $0x28,%rsp
+             << Counting::bytes << '\n';
+    13e9:	|  |  |  |  |  |  |  |         be 0a 00 00 00       	mov    $0xa,%esi
+}
+    13ee:	|  |  |  |  |  |  |  |         5b                   	pop    %rbx
+             << Counting::bytes << '\n';
+    13ef:	|  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+}
+    13f2:	|  |  |  |  |  |  |  |         5d                   	pop    %rbp
+    13f3:	|  |  |  |  |  |  |  |         41 5c                	pop    %r12
+    13f5:	|  |  |  |  |  |  |  |         41 5d                	pop    %r13
+    13f7:	|  |  |  |  |  |  |  |         41 5e                	pop    %r14
+    13f9:	|  |  |  |  |  |  |  |         41 5f                	pop    %r15
+             << Counting::bytes << '\n';
+    13fb:	|  |  |  |  |  |  |  |         e9 60 05 00 00       	jmp    1960 <nel::operator<<(nel::Log&, char)>
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            if (cap <= cur) { return cap; }
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    1400:	|  |  |  |  |  |  |  \-------> 48 83 f9 03          	cmp    $0x3,%rcx
+    1404:	|  |  |  |  |  |  |     /----- 77 72                	ja     1478 <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0x228>
+    1406:	|  |  |  |  |  |  |     |      be 04 00 00 00       	mov    $0x4,%esi
+    140b:	|  |  |  |  |  |  |     |      48 39 f0             	cmp    %rsi,%rax
+    140e:	|  |  |  |  |  |  |     |      48 0f 42 c6          	cmovb  %rsi,%rax
+    1412:	|  |  |  |  |  |  |     |      48 39 d0             	cmp    %rdx,%rax
+    1415:	|  |  |  |  |  |  |     |      48 0f 43 d0          	cmovae %rax,%rdx
+    1419:	|  |  |  |  |  |  |     |      48 89 d3             	mov    %rdx,%rbx
+            if (new_cap > max_capacity) { return nullptr; }
+    141c:	|  |  |  |  |  |  |     |  /-> 48 39 dd             	cmp    %rbx,%rbp
+    141f:	|  |  |  |  |  |  +-----|--|-- 0f 82 eb fe ff ff    	jb     1310 <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0xc0>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1425:	|  |  |  |  |  |  |     |  |   48 8d 34 9d 14 00 00 	lea    0x14(,%rbx,4),%rsi
+    142c:	|  |  |  |  |  |  |     |  |   00 
+                                    : std::realloc(p, new_size);
+    142d:	|  |  |  |  |  |  |     |  |   4c 89 e7             	mov    %r12,%rdi
+            reallocs += 1;
+    1430:	|  |  |  |  |  |  |     |  |   48 83 05 40 2c 00 00 	addq   $0x1,0x2c40(%rip)        # 4078 <Counting::reallocs>
+    1437:	|  |  |  |  |  |  |     |  |   01 
+    1438:	|  |  |  |  |  |  |     |  |   48 8d 04 8d 14 00 00 	lea    0x14(,%rcx,4),%rax
+    143f:	|  |  |  |  |  |  |     |  |   00 
+            bytes += old_size;
+    1440:	|  |  |  |  |  |  |     |  |   48 01 05 29 2c 00 00 	add    %rax,0x2c29(%rip)        # 4070 <Counting::bytes>
+    1447:	|  |  |  |  |  |  |     |  |   e8 44 fc ff ff       	call   1090 <realloc@plt>
+            if (new_p == nullptr) {
+    144c:	|  |  |  |  |  |  |     |  |   48 85 c0             	test   %rax,%rax
+    144f:	|  |  |  |  |  |  +-----|--|-- 0f 84 bb fe ff ff    	je     1310 <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0xc0>
+            return len_;
+    1455:	|  |  |  |  |  |  |     |  |   48 8b 50 08          	mov    0x8(%rax),%rdx
+    1459:	|  |  |  |  |  |  |     |  |   48 89 d9             	mov    %rbx,%rcx
+            new_n->alloc_ = new_cap;
+    145c:	|  |  |  |  |  |  |     |  |   48 89 18             	mov    %rbx,(%rax)
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+        {
+            bool ok;
+            ok = try_reserve_for(1);
+            if (!ok) { return Result<void, Type>::Err(val); }
+            if (item_ == nullptr) { return Result<void, Type>::Err(val); }
+    145f:	|  |  |  |  |  |  |     |  |   49 89 c4             	mov    %rax,%r12
+            if (len() >= capacity()) {
+    1462:	|  |  |  |  |  |  |     |  |   48 39 ca             	cmp    %rcx,%rdx
+    1465:	|  |  |  |  |  |  \-----|--|-- 0f 83 a5 fe ff ff    	jae    1310 <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0xc0>
+            len_ += 1;
+    146b:	|  |  |  |  |  \--------|--|-> 48 8d 42 01          	lea    0x1(%rdx),%rax
+    146f:	|  |  \--|--|-----------|--|-- e9 66 fe ff ff       	jmp    12da <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0x8a>
+    1474:	|  |     |  |           |  |   0f 1f 40 00          	nopl   0x0(%rax)
+    1478:	|  |     |  |           \--|-> 48 8d 1c 09          	lea    (%rcx,%rcx,1),%rbx
+    147c:	|  |     |  |              |   48 39 c3             	cmp    %rax,%rbx
+    147f:	|  |     |  |              |   48 0f 42 d8          	cmovb  %rax,%rbx
+    1483:	|  |     |  |              |   48 39 d3             	cmp    %rdx,%rbx
+    1486:	|  |     |  |              |   48 0f 42 da          	cmovb  %rdx,%rbx
+            } else if (new_cap == item_->capacity()) {
+    148a:	|  |     |  |              |   48 39 d9             	cmp    %rbx,%rcx
+    148d:	|  |     |  |              \-- 75 8d                	jne    141c <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0x1cc>
+    148f:	|  |     \--|----------------- e9 73 fe ff ff       	jmp    1307 <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0xb7>
+    1494:	|  |        |                  0f 1f 40 00          	nopl   0x0(%rax)
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    1498:	|  \--------|----------------> 49 83 c6 01          	add    $0x1,%r14
+    149c:	|           |                  49 81 fe 80 96 98 00 	cmp    $0x989680,%r14
+    14a3:	\-----------|----------------- 0f 85 f7 fd ff ff    	jne    12a0 <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0x50>
+    14a9:	            \----------------- e9 77 fe ff ff       	jmp    1325 <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0xd5>
+    14ae:	                               66 90                	xchg   %ax,%ax
+
+00000000000014b0 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)>:
+void bench_push(char const *const name)
+    14b0:	                               41 57                	push   %r15
+    14b2:	                               41 56                	push   %r14
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    14b4:	                               45 31 f6             	xor    %r14d,%r14d
+void bench_push(char const *const name)
+    14b7:	                               41 55                	push   %r13
+    14b9:	                               41 54                	push   %r12
+    14bb:	                               55                   	push   %rbp
+    14bc:	                               53                   	push   %rbx
+    14bd:	                               48 83 ec 28          	sub    $0x28,%rsp
+    Counting::reallocs = 0;
+    14c1:	                               48 c7 05 ac 2b 00 00 	movq   $0x0,0x2bac(%rip)        # 4078 <Counting::reallocs>
+    14c8:	                               00 00 00 00 
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    14cc:	                               4c 8d 6c 24 10       	lea    0x10(%rsp),%r13
+void bench_push(char const *const name)
+    14d1:	                               48 89 7c 24 08       	mov    %rdi,0x8(%rsp)
+    14d6:	                               bf 01 00 00 00       	mov    $0x1,%edi
+    Counting::bytes = 0;
+    14db:	                               48 c7 05 8a 2b 00 00 	movq   $0x0,0x2b8a(%rip)        # 4070 <Counting::bytes>
+    14e2:	                               00 00 00 00 
+    14e6:	                               4c 89 ee             	mov    %r13,%rsi
+    14e9:	                               e8 52 fb ff ff       	call   1040 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    14ee:	                               4c 8b 7c 24 18       	mov    0x18(%rsp),%r15
+    14f3:	                               48 69 44 24 10 00 ca 	imul   $0x3b9aca00,0x10(%rsp),%rax
+    14fa:	                               9a 3b 
+    14fc:	                               48 89 04 24          	mov    %rax,(%rsp)
+                                    : std::realloc(p, new_size);
+    1500:	/----------------------------> bf 24 00 00 00       	mov    $0x24,%edi
+            reallocs += 1;
+    1505:	|                              48 83 05 6b 2b 00 00 	addq   $0x1,0x2b6b(%rip)        # 4078 <Counting::reallocs>
+    150c:	|                              01 
+    150d:	|                              e8 6e fb ff ff       	call   1080 <malloc@plt>
+    1512:	|                              49 89 c4             	mov    %rax,%r12
+            if (new_p == nullptr) {
+    1515:	|                              48 85 c0             	test   %rax,%rax
+    1518:	|  /-------------------------- 0f 84 e2 01 00 00    	je     1700 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0x250>
+            new_n->alloc_ = new_cap;
+    151e:	|  |                           66 0f 6f 05 5a 0b 00 	movdqa 0xb5a(%rip),%xmm0        # 2080 <_IO_stdin_used+0x80>
+    1525:	|  |                           00 
+            return len_;
+    1526:	|  |                           31 f6                	xor    %esi,%esi
+            if (new_cap > max_capacity) { return nullptr; }
+    1528:	|  |                           48 bd f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rbp
+    152f:	|  |                           ff ff 1f 
+            new_n->alloc_ = new_cap;
+    1532:	|  |                           0f 11 00             	movups %xmm0,(%rax)
+    1535:	|  |                           b8 01 00 00 00       	mov    $0x1,%eax
+            v.push(int(i)).is_ok();
+    153a:	|  |  /----------------------> 45 89 74 b4 10       	mov    %r14d,0x10(%r12,%rsi,4)
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    153f:	|  |  |                        49 83 c6 01          	add    $0x1,%r14
+            len_ += 1;
+    1543:	|  |  |                        49 89 44 24 08       	mov    %rax,0x8(%r12)
+    1548:	|  |  |                        49 81 fe 80 96 98 00 	cmp    $0x989680,%r14
+    154f:	|  |  |                 /----- 74 2c                	je     157d <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0xcd>
+            return len_;
+    1551:	|  |  |                 |  /-> 49 8b 74 24 08       	mov    0x8(%r12),%rsi
+            return alloc_;
+    1556:	|  |  |                 |  |   49 8b 0c 24          	mov    (%r12),%rcx
+            if (len() + n <= capacity()) { return true; }
+    155a:	|  |  |                 |  |   48 8d 46 01          	lea    0x1(%rsi),%rax
+    155e:	|  |  |                 |  |   48 39 c1             	cmp    %rax,%rcx
+    1561:	|  |  |              /--|--|-- 0f 82 f9 00 00 00    	jb     1660 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0x1b0>
+            if (len() >= capacity()) {
+    1567:	|  |  |  /-----------|--|--|-> 48 39 ce             	cmp    %rcx,%rsi
+    156a:	|  |  |  |     /-----|--|--|-- 0f 82 5c 01 00 00    	jb     16cc <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0x21c>
+    1570:	|  |  |  |     |  /--|--|--|-> 49 83 c6 01          	add    $0x1,%r14
+    1574:	|  |  |  |     |  |  |  |  |   49 81 fe 80 96 98 00 	cmp    $0x989680,%r14
+    157b:	|  |  |  |     |  |  |  |  \-- 75 d4                	jne    1551 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0xa1>
+                std::free(p);
+    157d:	|  |  |  |     |  |  |  \----> 4c 89 e7             	mov    %r12,%rdi
+    1580:	|  |  |  |     |  |  |         e8 ab fa ff ff       	call   1030 <free@plt>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1585:	|  |  |  |  /--|--|--|-------> 4c 89 ee             	mov    %r13,%rsi
+    1588:	|  |  |  |  |  |  |  |         bf 01 00 00 00       	mov    $0x1,%edi
+    nel::log << name << ": " << ns / 1000UL << "us";
+    158d:	|  |  |  |  |  |  |  |         48 8d 2d ec 2a 00 00 	lea    0x2aec(%rip),%rbp        # 4080 <nel::log>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1594:	|  |  |  |  |  |  |  |         e8 a7 fa ff ff       	call   1040 <clock_gettime@plt>
+    return now_ns() - b;
+    1599:	|  |  |  |  |  |  |  |         48 8b 04 24          	mov    (%rsp),%rax
+    nel::log << name << ": " << ns / 1000UL << "us";
+    159d:	|  |  |  |  |  |  |  |         48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    15a2:	|  |  |  |  |  |  |  |         48 89 ef             	mov    %rbp,%rdi
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    15a5:	|  |  |  |  |  |  |  |         48 69 5c 24 10 00 ca 	imul   $0x3b9aca00,0x10(%rsp),%rbx
+    15ac:	|  |  |  |  |  |  |  |         9a 3b 
+    15ae:	|  |  |  |  |  |  |  |         4c 29 fb             	sub    %r15,%rbx
+    return now_ns() - b;
+    15b1:	|  |  |  |  |  |  |  |         48 03 5c 24 18       	add    0x18(%rsp),%rbx
+    15b6:	|  |  |  |  |  |  |  |         48 29 c3             	sub    %rax,%rbx
+    nel::log << name << ": " << ns / 1000UL << "us";
+    15b9:	|  |  |  |  |  |  |  |         e8 c2 03 00 00       	call   1980 <nel::operator<<(nel::Log&, char const*)>
+    15be:	|  |  |  |  |  |  |  |         48 8d 35 66 0a 00 00 	lea    0xa66(%rip),%rsi        # 202b <_IO_stdin_used+0x2b>
+    15c5:	|  |  |  |  |  |  |  |         48 c1 eb 03          	shr    $0x3,%rbx
+    15c9:	|  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    15cc:	|  |  |  |  |  |  |  |         e8 af 03 00 00       	call   1980 <nel::operator<<(nel::Log&, char const*)>
+    15d1:	|  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    15d4:	|  |  |  |  |  |  |  |         48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    15db:	|  |  |  |  |  |  |  |         9b c4 20 
+    15de:	|  |  |  |  |  |  |  |         48 f7 e3             	mul    %rbx
+    15e1:	|  |  |  |  |  |  |  |         48 c1 ea 04          	shr    $0x4,%rdx
+    15e5:	|  |  |  |  |  |  |  |         48 89 d6             	mov    %rdx,%rsi
+    15e8:	|  |  |  |  |  |  |  |         e8 53 04 00 00       	call   1a40 <nel::operator<<(nel::Log&, unsigned long)>
+    15ed:	|  |  |  |  |  |  |  |         48 8d 35 10 0a 00 00 	lea    0xa10(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    15f4:	|  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    15f7:	|  |  |  |  |  |  |  |         e8 84 03 00 00       	call   1980 <nel::operator<<(nel::Log&, char const*)>
+    nel::log << '\n';
+    15fc:	|  |  |  |  |  |  |  |         48 89 ef             	mov    %rbp,%rdi
+    15ff:	|  |  |  |  |  |  |  |         be 0a 00 00 00       	mov    $0xa,%esi
+    1604:	|  |  |  |  |  |  |  |         e8 57 03 00 00       	call   1960 <nel::operator<<(nel::Log&, char)>
+             << Counting::bytes << '\n';
+    1609:	|  |  |  |  |  |  |  |         48 89 ef             	mov    %rbp,%rdi
+    160c:	|  |  |  |  |  |  |  |         48 8d 35 f4 09 00 00 	lea    0x9f4(%rip),%rsi        # 2007 <_IO_stdin_used+0x7>
+    1613:	|  |  |  |  |  |  |  |         e8 68 03 00 00       	call   1980 <nel::operator<<(nel::Log&, char const*)>
+    1618:	|  |  |  |  |  |  |  |         48 8b 35 59 2a 00 00 	mov    0x2a59(%rip),%rsi        # 4078 <Counting::reallocs>
+    161f:	|  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    1622:	|  |  |  |  |  |  |  |         e8 19 04 00 00       	call   1a40 <nel::operator<<(nel::Log&, unsigned long)>
+    1627:	|  |  |  |  |  |  |  |         48 8d 35 e6 09 00 00 	lea    0x9e6(%rip),%rsi        # 2014 <_IO_stdin_used+0x14>
+    162e:	|  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    1631:	|  |  |  |  |  |  |  |         e8 4a 03 00 00       	call   1980 <nel::operator<<(nel::Log&, char const*)>
+    1636:	|  |  |  |  |  |  |  |         48 8b 35 33 2a 00 00 	mov    0x2a33(%rip),%rsi        # 4070 <Counting::bytes>
+    163d:	|  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    1640:	|  |  |  |  |  |  |  |         e8 fb 03 00 00       	call   1a40 <nel::operator<<(nel::Log&, unsigned long)>
+}
+    1645:	|  |  |  |  |  |  |  |         48 83 c4 28          	add    $0x28,%rsp
+             << Counting::bytes << '\n';
+    1649:	|  |  |  |  |  |  |  |         be 0a 00 00 00       	mov    $0xa,%esi
+}
+    164e:	|  |  |  |  |  |  |  |         5b                   	pop    %rbx
+             << Counting::bytes << '\n';
+    164f:	|  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+}
+    1652:	|  |  |  |  |  |  |  |         5d                   	pop    %rbp
+    1653:	|  |  |  |  |  |  |  |         41 5c                	pop    %r12
+    1655:	|  |  |  |  |  |  |  |         41 5d                	pop    %r13
+    1657:	|  |  |  |  |  |  |  |         41 5e                	pop    %r14
+    1659:	|  |  |  |  |  |  |  |         41 5f                	pop    %r15
+             << Counting::bytes << '\n';
+    165b:	|  |  |  |  |  |  |  |         e9 00 03 00 00       	jmp    1960 <nel::operator<<(nel::Log&, char)>
+    1660:	|  |  |  |  |  |  |  \-------> 48 83 f9 03          	cmp    $0x3,%rcx
+    1664:	|  |  |  |  |  |  |        /-- 77 72                	ja     16d8 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0x228>
+    1666:	|  |  |  |  |  |  |        |   41 b8 04 00 00 00    	mov    $0x4,%r8d
+    166c:	|  |  |  |  |  |  |        |   4c 39 c0             	cmp    %r8,%rax
+    166f:	|  |  |  |  |  |  |        |   49 0f 42 c0          	cmovb  %r8,%rax
+    1673:	|  |  |  |  |  |  |        |   48 39 f0             	cmp    %rsi,%rax
+    1676:	|  |  |  |  |  |  |        |   48 0f 43 f0          	cmovae %rax,%rsi
+    167a:	|  |  |  |  |  |  |        |   48 89 f3             	mov    %rsi,%rbx
+            if (new_cap > max_capacity) { return nullptr; }
+    167d:	|  |  |  |  |  |  |     /--|-> 48 39 dd             	cmp    %rbx,%rbp
+    1680:	|  |  |  |  |  |  +-----|--|-- 0f 82 ea fe ff ff    	jb     1570 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0xc0>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1686:	|  |  |  |  |  |  |     |  |   48 8d 34 9d 14 00 00 	lea    0x14(,%rbx,4),%rsi
+    168d:	|  |  |  |  |  |  |     |  |   00 
+                                    : std::realloc(p, new_size);
+    168e:	|  |  |  |  |  |  |     |  |   4c 89 e7             	mov    %r12,%rdi
+            reallocs += 1;
+    1691:	|  |  |  |  |  |  |     |  |   48 83 05 df 29 00 00 	addq   $0x1,0x29df(%rip)        # 4078 <Counting::reallocs>
+    1698:	|  |  |  |  |  |  |     |  |   01 
+    1699:	|  |  |  |  |  |  |     |  |   48 8d 04 8d 14 00 00 	lea    0x14(,%rcx,4),%rax
+    16a0:	|  |  |  |  |  |  |     |  |   00 
+            bytes += old_size;
+    16a1:	|  |  |  |  |  |  |     |  |   48 01 05 c8 29 00 00 	add    %rax,0x29c8(%rip)        # 4070 <Counting::bytes>
+    16a8:	|  |  |  |  |  |  |     |  |   e8 e3 f9 ff ff       	call   1090 <realloc@plt>
+            if (new_p == nullptr) {
+    16ad:	|  |  |  |  |  |  |     |  |   48 85 c0             	test   %rax,%rax
+    16b0:	|  |  |  |  |  |  +-----|--|-- 0f 84 ba fe ff ff    	je     1570 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0xc0>
+            return len_;
+    16b6:	|  |  |  |  |  |  |     |  |   48 8b 70 08          	mov    0x8(%rax),%rsi
+    16ba:	|  |  |  |  |  |  |     |  |   48 89 d9             	mov    %rbx,%rcx
+            new_n->alloc_ = new_cap;
+    16bd:	|  |  |  |  |  |  |     |  |   48 89 18             	mov    %rbx,(%rax)
+            if (item_ == nullptr) { return Result<void, Type>::Err(val); }
+    16c0:	|  |  |  |  |  |  |     |  |   49 89 c4             	mov    %rax,%r12
+            if (len() >= capacity()) {
+    16c3:	|  |  |  |  |  |  |     |  |   48 39 ce             	cmp    %rcx,%rsi
+    16c6:	|  |  |  |  |  |  \-----|--|-- 0f 83 a4 fe ff ff    	jae    1570 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0xc0>
+            len_ += 1;
+    16cc:	|  |  |  |  |  \--------|--|-> 48 8d 46 01          	lea    0x1(%rsi),%rax
+    16d0:	|  |  \--|--|-----------|--|-- e9 65 fe ff ff       	jmp    153a <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0x8a>
+    16d5:	|  |     |  |           |  |   0f 1f 00             	nopl   (%rax)
+    16d8:	|  |     |  |           |  \-> 48 89 cb             	mov    %rcx,%rbx
+    16db:	|  |     |  |           |      48 d1 eb             	shr    %rbx
+    16de:	|  |     |  |           |      48 01 cb             	add    %rcx,%rbx
+    16e1:	|  |     |  |           |      48 39 c3             	cmp    %rax,%rbx
+    16e4:	|  |     |  |           |      48 0f 42 d8          	cmovb  %rax,%rbx
+    16e8:	|  |     |  |           |      48 39 f3             	cmp    %rsi,%rbx
+    16eb:	|  |     |  |           |      48 0f 42 de          	cmovb  %rsi,%rbx
+            } else if (new_cap == item_->capacity()) {
+    16ef:	|  |     |  |           |      48 39 d9             	cmp    %rbx,%rcx
+    16f2:	|  |     |  |           \----- 75 89                	jne    167d <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0x1cd>
+    16f4:	|  |     \--|----------------- e9 6e fe ff ff       	jmp    1567 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0xb7>
+    16f9:	|  |        |                  0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    1700:	|  \--------|----------------> 49 83 c6 01          	add    $0x1,%r14
+    1704:	|           |                  49 81 fe 80 96 98 00 	cmp    $0x989680,%r14
+    170b:	\-----------|----------------- 0f 85 ef fd ff ff    	jne    1500 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0x50>
+    1711:	            \----------------- e9 6f fe ff ff       	jmp    1585 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0xd5>
+    1716:	                               66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    171d:	                               00 00 00 
+
+0000000000001720 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)>:
+void bench_push(char const *const name)
+    1720:	                            41 57                	push   %r15
+    1722:	                            41 56                	push   %r14
+    1724:	                            41 55                	push   %r13
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    1726:	                            45 31 ed             	xor    %r13d,%r13d
+void bench_push(char const *const name)
+    1729:	                            41 54                	push   %r12
+    172b:	                            55                   	push   %rbp
+    172c:	                            53                   	push   %rbx
+    172d:	                            48 83 ec 28          	sub    $0x28,%rsp
+    Counting::reallocs = 0;
+    1731:	                            48 c7 05 3c 29 00 00 	movq   $0x0,0x293c(%rip)        # 4078 <Counting::reallocs>
+    1738:	                            00 00 00 00 
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    173c:	                            4c 8d 64 24 10       	lea    0x10(%rsp),%r12
+void bench_push(char const *const name)
+    1741:	                            48 89 7c 24 08       	mov    %rdi,0x8(%rsp)
+    1746:	                            bf 01 00 00 00       	mov    $0x1,%edi
+    Counting::bytes = 0;
+    174b:	                            48 c7 05 1a 29 00 00 	movq   $0x0,0x291a(%rip)        # 4070 <Counting::bytes>
+    1752:	                            00 00 00 00 
+    1756:	                            4c 89 e6             	mov    %r12,%rsi
+    1759:	                            e8 e2 f8 ff ff       	call   1040 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    175e:	                            4c 8b 74 24 18       	mov    0x18(%rsp),%r14
+    1763:	                            48 69 44 24 10 00 ca 	imul   $0x3b9aca00,0x10(%rsp),%rax
+    176a:	                            9a 3b 
+    176c:	                            48 89 04 24          	mov    %rax,(%rsp)
+                                    : std::realloc(p, new_size);
+    1770:	/-------------------------> bf 54 00 00 00       	mov    $0x54,%edi
+            reallocs += 1;
+    1775:	|                           48 83 05 fb 28 00 00 	addq   $0x1,0x28fb(%rip)        # 4078 <Counting::reallocs>
+    177c:	|                           01 
+    177d:	|                           e8 fe f8 ff ff       	call   1080 <malloc@plt>
+    1782:	|                           48 89 c5             	mov    %rax,%rbp
+            if (new_p == nullptr) {
+    1785:	|                           48 85 c0             	test   %rax,%rax
+    1788:	|  /----------------------- 0f 84 b2 01 00 00    	je     1940 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0x220>
+            new_n->alloc_ = new_cap;
+    178e:	|  |                        66 0f 6f 05 fa 08 00 	movdqa 0x8fa(%rip),%xmm0        # 2090 <_IO_stdin_used+0x90>
+    1795:	|  |                        00 
+            return len_;
+    1796:	|  |                        31 d2                	xor    %edx,%edx
+            if (new_cap > max_capacity) { return nullptr; }
+    1798:	|  |                        48 bb f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rbx
+    179f:	|  |                        ff ff 1f 
+            new_n->alloc_ = new_cap;
+    17a2:	|  |                        0f 11 00             	movups %xmm0,(%rax)
+    17a5:	|  |                        b8 01 00 00 00       	mov    $0x1,%eax
+            v.push(int(i)).is_ok();
+    17aa:	|  |  /-------------------> 44 89 6c 95 10       	mov    %r13d,0x10(%rbp,%rdx,4)
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    17af:	|  |  |                     49 83 c5 01          	add    $0x1,%r13
+            len_ += 1;
+    17b3:	|  |  |                     48 89 45 08          	mov    %rax,0x8(%rbp)
+    17b7:	|  |  |                     49 81 fd 80 96 98 00 	cmp    $0x989680,%r13
+    17be:	|  |  |              /----- 74 2d                	je     17ed <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0xcd>
+            return len_;
+    17c0:	|  |  |              |  /-> 48 8b 55 08          	mov    0x8(%rbp),%rdx
+            return alloc_;
+    17c4:	|  |  |              |  |   48 8b 75 00          	mov    0x0(%rbp),%rsi
+            if (len() + n <= capacity()) { return true; }
+    17c8:	|  |  |              |  |   48 8d 42 01          	lea    0x1(%rdx),%rax
+    17cc:	|  |  |              |  |   48 39 c6             	cmp    %rax,%rsi
+    17cf:	|  |  |           /--|--|-- 0f 82 fb 00 00 00    	jb     18d0 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0x1b0>
+            if (len() >= capacity()) {
+    17d5:	|  |  |        /--|--|--|-> 48 39 f2             	cmp    %rsi,%rdx
+    17d8:	|  |  |  /-----|--|--|--|-- 0f 82 59 01 00 00    	jb     1937 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0x217>
+    17de:	|  |  |  |     |  |  |  |   66 90                	xchg   %ax,%ax
+    17e0:	|  |  |  |  /--|--|--|--|-> 49 83 c5 01          	add    $0x1,%r13
+    17e4:	|  |  |  |  |  |  |  |  |   49 81 fd 80 96 98 00 	cmp    $0x989680,%r13
+    17eb:	|  |  |  |  |  |  |  |  \-- 75 d3                	jne    17c0 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0xa0>
+                std::free(p);
+    17ed:	|  |  |  |  |  |  |  \----> 48 89 ef             	mov    %rbp,%rdi
+    17f0:	|  |  |  |  |  |  |         e8 3b f8 ff ff       	call   1030 <free@plt>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    17f5:	|  |  |  |  |  |  |     /-> 4c 89 e6             	mov    %r12,%rsi
+    17f8:	|  |  |  |  |  |  |     |   bf 01 00 00 00       	mov    $0x1,%edi
+    nel::log << name << ": " << ns / 1000UL << "us";
+    17fd:	|  |  |  |  |  |  |     |   48 8d 2d 7c 28 00 00 	lea    0x287c(%rip),%rbp        # 4080 <nel::log>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1804:	|  |  |  |  |  |  |     |   e8 37 f8 ff ff       	call   1040 <clock_gettime@plt>
+    return now_ns() - b;
+    1809:	|  |  |  |  |  |  |     |   48 8b 04 24          	mov    (%rsp),%rax
+    nel::log << name << ": " << ns / 1000UL << "us";
+    180d:	|  |  |  |  |  |  |     |   48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    1812:	|  |  |  |  |  |  |     |   48 89 ef             	mov    %rbp,%rdi
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1815:	|  |  |  |  |  |  |     |   48 69 5c 24 10 00 ca 	imul   $0x3b9aca00,0x10(%rsp),%rbx
+    181c:	|  |  |  |  |  |  |     |   9a 3b 
+    181e:	|  |  |  |  |  |  |     |   4c 29 f3             	sub    %r14,%rbx
+    return now_ns() - b;
+    1821:	|  |  |  |  |  |  |     |   48 03 5c 24 18       	add    0x18(%rsp),%rbx
+    1826:	|  |  |  |  |  |  |     |   48 29 c3             	sub    %rax,%rbx
+    nel::log << name << ": " << ns / 1000UL << "us";
+    1829:	|  |  |  |  |  |  |     |   e8 52 01 00 00       	call   1980 <nel::operator<<(nel::Log&, char const*)>
+    182e:	|  |  |  |  |  |  |     |   48 8d 35 f6 07 00 00 	lea    0x7f6(%rip),%rsi        # 202b <_IO_stdin_used+0x2b>
+    1835:	|  |  |  |  |  |  |     |   48 c1 eb 03          	shr    $0x3,%rbx
+    1839:	|  |  |  |  |  |  |     |   48 89 c7             	mov    %rax,%rdi
+    183c:	|  |  |  |  |  |  |     |   e8 3f 01 00 00       	call   1980 <nel::operator<<(nel::Log&, char const*)>
+    1841:	|  |  |  |  |  |  |     |   48 89 c7             	mov    %rax,%rdi
+    1844:	|  |  |  |  |  |  |     |   48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    184b:	|  |  |  |  |  |  |     |   9b c4 20 
+    184e:	|  |  |  |  |  |  |     |   48 f7 e3             	mul    %rbx
+    1851:	|  |  |  |  |  |  |     |   48 c1 ea 04          	shr    $0x4,%rdx
+    1855:	|  |  |  |  |  |  |     |   48 89 d6             	mov    %rdx,%rsi
+    1858:	|  |  |  |  |  |  |     |   e8 e3 01 00 00       	call   1a40 <nel::operator<<(nel::Log&, unsigned long)>
+    185d:	|  |  |  |  |  |  |     |   48 8d 35 a0 07 00 00 	lea    0x7a0(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    1864:	|  |  |  |  |  |  |     |   48 89 c7             	mov    %rax,%rdi
+    1867:	|  |  |  |  |  |  |     |   e8 14 01 00 00       	call   1980 <nel::operator<<(nel::Log&, char const*)>
+    nel::log << '\n';
+    186c:	|  |  |  |  |  |  |     |   48 89 ef             	mov    %rbp,%rdi
+    186f:	|  |  |  |  |  |  |     |   be 0a 00 00 00       	mov    $0xa,%esi
+    1874:	|  |  |  |  |  |  |     |   e8 e7 00 00 00       	call   1960 <nel::operator<<(nel::Log&, char)>
+             << Counting::bytes << '\n';
+    1879:	|  |  |  |  |  |  |     |   48 89 ef             	mov    %rbp,%rdi
+    187c:	|  |  |  |  |  |  |     |   48 8d 35 84 07 00 00 	lea    0x784(%rip),%rsi        # 2007 <_IO_stdin_used+0x7>
+    1883:	|  |  |  |  |  |  |     |   e8 f8 00 00 00       	call   1980 <nel::operator<<(nel::Log&, char const*)>
+    1888:	|  |  |  |  |  |  |     |   48 8b 35 e9 27 00 00 	mov    0x27e9(%rip),%rsi        # 4078 <Counting::reallocs>
+    188f:	|  |  |  |  |  |  |     |   48 89 c7             	mov    %rax,%rdi
+    1892:	|  |  |  |  |  |  |     |   e8 a9 01 00 00       	call   1a40 <nel::operator<<(nel::Log&, unsigned long)>
+    1897:	|  |  |  |  |  |  |     |   48 8d 35 76 07 00 00 	lea    0x776(%rip),%rsi        # 2014 <_IO_stdin_used+0x14>
+    189e:	|  |  |  |  |  |  |     |   48 89 c7             	mov    %rax,%rdi
+    18a1:	|  |  |  |  |  |  |     |   e8 da 00 00 00       	call   1980 <nel::operator<<(nel::Log&, char const*)>
+    18a6:	|  |  |  |  |  |  |     |   48 8b 35 c3 27 00 00 	mov    0x27c3(%rip),%rsi        # 4070 <Counting::bytes>
+    18ad:	|  |  |  |  |  |  |     |   48 89 c7             	mov    %rax,%rdi
+    18b0:	|  |  |  |  |  |  |     |   e8 8b 01 00 00       	call   1a40 <nel::operator<<(nel::Log&, unsigned long)>
+}
+    18b5:	|  |  |  |  |  |  |     |   48 83 c4 28          	add    $0x28,%rsp
+             << Counting::bytes << '\n';
+    18b9:	|  |  |  |  |  |  |     |   be 0a 00 00 00       	mov    $0xa,%esi
+}
+    18be:	|  |  |  |  |  |  |     |   5b                   	pop    %rbx
+             << Counting::bytes << '\n';
+    18bf:	|  |  |  |  |  |  |     |   48 89 c7             	mov    %rax,%rdi
+}
+    18c2:	|  |  |  |  |  |  |     |   5d                   	pop    %rbp
+    18c3:	|  |  |  |  |  |  |     |   41 5c                	pop    %r12
+    18c5:	|  |  |  |  |  |  |     |   41 5d                	pop    %r13
+    18c7:	|  |  |  |  |  |  |     |   41 5e                	pop    %r14
+    18c9:	|  |  |  |  |  |  |     |   41 5f                	pop    %r15
+             << Counting::bytes << '\n';
+    18cb:	|  |  |  |  |  |  |     |   e9 90 00 00 00       	jmp    1960 <nel::operator<<(nel::Log&, char)>
+    public:
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            NEL_UNUSED(cur);
+            if (cap == 0) { return 0; }
+            return cap - cap % Q + Q;
+    18d0:	|  |  |  |  |  |  \-----|-> 48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+    18d4:	|  |  |  |  |  |        |   4c 8d 78 10          	lea    0x10(%rax),%r15
+    18d8:	|  |  |  |  |  |        |   49 39 d7             	cmp    %rdx,%r15
+    18db:	|  |  |  |  |  |        |   4c 0f 42 fa          	cmovb  %rdx,%r15
+            } else if (new_cap == item_->capacity()) {
+    18df:	|  |  |  |  |  |        |   4c 39 fe             	cmp    %r15,%rsi
+    18e2:	|  |  |  |  |  \--------|-- 0f 84 ed fe ff ff    	je     17d5 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0xb5>
+            if (new_cap > max_capacity) { return nullptr; }
+    18e8:	|  |  |  |  |           |   4c 39 fb             	cmp    %r15,%rbx
+    18eb:	|  |  |  |  +-----------|-- 0f 82 ef fe ff ff    	jb     17e0 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0xc0>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    18f1:	|  |  |  |  |           |   48 8d 04 b5 14 00 00 	lea    0x14(,%rsi,4),%rax
+    18f8:	|  |  |  |  |           |   00 
+                                    : std::realloc(p, new_size);
+    18f9:	|  |  |  |  |           |   48 89 ef             	mov    %rbp,%rdi
+    18fc:	|  |  |  |  |           |   4a 8d 34 bd 14 00 00 	lea    0x14(,%r15,4),%rsi
+    1903:	|  |  |  |  |           |   00 
+            reallocs += 1;
+    1904:	|  |  |  |  |           |   48 83 05 6c 27 00 00 	addq   $0x1,0x276c(%rip)        # 4078 <Counting::reallocs>
+    190b:	|  |  |  |  |           |   01 
+            bytes += old_size;
+    190c:	|  |  |  |  |           |   48 01 05 5d 27 00 00 	add    %rax,0x275d(%rip)        # 4070 <Counting::bytes>
+    1913:	|  |  |  |  |           |   e8 78 f7 ff ff       	call   1090 <realloc@plt>
+            if (new_p == nullptr) {
+    1918:	|  |  |  |  |           |   48 85 c0             	test   %rax,%rax
+    191b:	|  |  |  |  +-----------|-- 0f 84 bf fe ff ff    	je     17e0 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0xc0>
+            return len_;
+    1921:	|  |  |  |  |           |   48 8b 50 08          	mov    0x8(%rax),%rdx
+    1925:	|  |  |  |  |           |   4c 89 fe             	mov    %r15,%rsi
+            new_n->alloc_ = new_cap;
+    1928:	|  |  |  |  |           |   4c 89 38             	mov    %r15,(%rax)
+            if (item_ == nullptr) { return Result<void, Type>::Err(val); }
+    192b:	|  |  |  |  |           |   48 89 c5             	mov    %rax,%rbp
+            if (len() >= capacity()) {
+    192e:	|  |  |  |  |           |   48 39 f2             	cmp    %rsi,%rdx
+    1931:	|  |  |  |  \-----------|-- 0f 83 a9 fe ff ff    	jae    17e0 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0xc0>
+            len_ += 1;
+    1937:	|  |  |  \--------------|-> 48 8d 42 01          	lea    0x1(%rdx),%rax
+    193b:	|  |  \-----------------|-- e9 6a fe ff ff       	jmp    17aa <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0x8a>
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    1940:	|  \--------------------|-> 49 83 c5 01          	add    $0x1,%r13
+    1944:	|                       |   49 81 fd 80 96 98 00 	cmp    $0x989680,%r13
+    194b:	\-----------------------|-- 0f 85 1f fe ff ff    	jne    1770 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0x50>
+    1951:	                        \-- e9 9f fe ff ff       	jmp    17f5 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0xd5>
+    1956:	                            66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    195d:	                            00 00 00 
+
+0000000000001960 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1960:	53                   	push   %rbx
+    1961:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    1964:	40 0f be fe          	movsbl %sil,%edi
+    1968:	48 8b 35 f1 26 00 00 	mov    0x26f1(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    196f:	e8 ec f6 ff ff       	call   1060 <fputc@plt>
+    return outs;
+}
+    1974:	48 89 d8             	mov    %rbx,%rax
+    1977:	5b                   	pop    %rbx
+    1978:	c3                   	ret
+    1979:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001980 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1980:	53                   	push   %rbx
+    1981:	48 89 fb             	mov    %rdi,%rbx
+    1984:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    1987:	48 8b 35 d2 26 00 00 	mov    0x26d2(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    198e:	e8 bd f6 ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    1993:	48 89 d8             	mov    %rbx,%rax
+    1996:	5b                   	pop    %rbx
+    1997:	c3                   	ret
+    1998:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    199f:	00 
+
+00000000000019a0 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    19a0:	53                   	push   %rbx
+    19a1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    19a4:	48 8b 3d b5 26 00 00 	mov    0x26b5(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    19ab:	40 0f b6 d6          	movzbl %sil,%edx
+    19af:	31 c0                	xor    %eax,%eax
+    19b1:	48 8d 35 e8 06 00 00 	lea    0x6e8(%rip),%rsi        # 20a0 <_IO_stdin_used+0xa0>
+    19b8:	e8 b3 f6 ff ff       	call   1070 <fprintf@plt>
+    return outs;
+}
+    19bd:	48 89 d8             	mov    %rbx,%rax
+    19c0:	5b                   	pop    %rbx
+    19c1:	c3                   	ret
+    19c2:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    19c9:	00 00 00 00 
+    19cd:	0f 1f 00             	nopl   (%rax)
+
+00000000000019d0 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    19d0:	53                   	push   %rbx
+    19d1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    19d4:	48 8b 3d 85 26 00 00 	mov    0x2685(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    19db:	0f b7 d6             	movzwl %si,%edx
+    19de:	31 c0                	xor    %eax,%eax
+    19e0:	48 8d 35 b9 06 00 00 	lea    0x6b9(%rip),%rsi        # 20a0 <_IO_stdin_used+0xa0>
+    19e7:	e8 84 f6 ff ff       	call   1070 <fprintf@plt>
+    return outs;
+}
+    19ec:	48 89 d8             	mov    %rbx,%rax
+    19ef:	5b                   	pop    %rbx
+    19f0:	c3                   	ret
+    19f1:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    19f8:	00 00 00 00 
+    19fc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001a00 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    1a00:	53                   	push   %rbx
+    1a01:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    1a04:	48 8b 3d 55 26 00 00 	mov    0x2655(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1a0b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    1a0d:	31 c0                	xor    %eax,%eax
+    1a0f:	48 8d 35 8a 06 00 00 	lea    0x68a(%rip),%rsi        # 20a0 <_IO_stdin_used+0xa0>
+    1a16:	e8 55 f6 ff ff       	call   1070 <fprintf@plt>
+    return outs;
+}
+    1a1b:	48 89 d8             	mov    %rbx,%rax
+    1a1e:	5b                   	pop    %rbx
+    1a1f:	c3                   	ret
+
+0000000000001a20 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    1a20:	53                   	push   %rbx
+    1a21:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    1a24:	48 8b 3d 35 26 00 00 	mov    0x2635(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1a2b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    1a2d:	31 c0                	xor    %eax,%eax
+    1a2f:	48 8d 35 6a 06 00 00 	lea    0x66a(%rip),%rsi        # 20a0 <_IO_stdin_used+0xa0>
+    1a36:	e8 35 f6 ff ff       	call   1070 <fprintf@plt>
+    return outs;
+}
+    1a3b:	48 89 d8             	mov    %rbx,%rax
+    1a3e:	5b                   	pop    %rbx
+    1a3f:	c3                   	ret
+
+0000000000001a40 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    1a40:	53                   	push   %rbx
+    1a41:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    1a44:	48 8b 3d 15 26 00 00 	mov    0x2615(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1a4b:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    1a4e:	31 c0                	xor    %eax,%eax
+    1a50:	48 8d 35 4c 06 00 00 	lea    0x64c(%rip),%rsi        # 20a3 <_IO_stdin_used+0xa3>
+    1a57:	e8 14 f6 ff ff       	call   1070 <fprintf@plt>
+    return outs;
+}
+    1a5c:	48 89 d8             	mov    %rbx,%rax
+    1a5f:	5b                   	pop    %rbx
+    1a60:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000001a64 <_fini>:
+    1a64:	48 83 ec 08          	sub    $0x8,%rsp
+    1a68:	48 83 c4 08          	add    $0x8,%rsp
+    1a6c:	c3                   	ret
@@ -0,0 +1,4462 @@
+
+target/fast/examples/bench_iterator:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 5f 00 00 	mov    0x5fc5(%rip),%rax        # 6fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 5f 00 00    	push   0x5fca(%rip)        # 6ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 5f 00 00    	jmp    *0x5fcc(%rip)        # 6ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 5f 00 00    	jmp    *0x5fca(%rip)        # 7000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 5f 00 00    	jmp    *0x5fc2(%rip)        # 7008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <clock_gettime@plt>:
+    1050:	ff 25 ba 5f 00 00    	jmp    *0x5fba(%rip)        # 7010 <clock_gettime@GLIBC_2.17>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputs@plt>:
+    1060:	ff 25 b2 5f 00 00    	jmp    *0x5fb2(%rip)        # 7018 <fputs@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 5f 00 00    	jmp    *0x5faa(%rip)        # 7020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fprintf@plt>:
+    1080:	ff 25 a2 5f 00 00    	jmp    *0x5fa2(%rip)        # 7028 <fprintf@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <malloc@plt>:
+    1090:	ff 25 9a 5f 00 00    	jmp    *0x5f9a(%rip)        # 7030 <malloc@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <realloc@plt>:
+    10a0:	ff 25 92 5f 00 00    	jmp    *0x5f92(%rip)        # 7038 <realloc@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <__cxa_atexit@plt>:
+    10b0:	ff 25 8a 5f 00 00    	jmp    *0x5f8a(%rip)        # 7040 <__cxa_atexit@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010c0 <__cxa_finalize@plt>:
+    10c0:	ff 25 1a 5f 00 00    	jmp    *0x5f1a(%rip)        # 6fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10c6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010d0 <bench_queue(nel::Slice<int> const&) [clone .cold]>:
+static volatile long unsigned int sink = 0;
+
+typedef long unsigned int Acc;
+
+template<typename F>
+void run(char const *const name, nel::Slice<int> const &s, F &&f)
+    10d0:	0f 0b                	ud2
+
+00000000000010d2 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10d2:	50                   	push   %rax
+    std::abort();
+    10d3:	e8 68 ff ff ff       	call   1040 <abort@plt>
+
+00000000000010d8 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10d8:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10d9:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10dc:	4c 8d 0d 6d 41 00 00 	lea    0x416d(%rip),%r9        # 5250 <sizes+0x30>
+    10e3:	31 c0                	xor    %eax,%eax
+    10e5:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10e9:	4c 8b 07             	mov    (%rdi),%r8
+    10ec:	48 8d 35 63 41 00 00 	lea    0x4163(%rip),%rsi        # 5256 <sizes+0x36>
+    10f3:	48 8b 3d 66 5f 00 00 	mov    0x5f66(%rip),%rdi        # 7060 <stderr@GLIBC_2.2.5>
+    10fa:	e8 81 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    10ff:	e8 3c ff ff ff       	call   1040 <abort@plt>
+
+0000000000001104 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1104:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1108:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    110b:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    110f:	31 c0                	xor    %eax,%eax
+    1111:	57                   	push   %rdi
+    1112:	48 8b 3d 47 5f 00 00 	mov    0x5f47(%rip),%rdi        # 7060 <stderr@GLIBC_2.2.5>
+    1119:	4c 8d 0d 30 41 00 00 	lea    0x4130(%rip),%r9        # 5250 <sizes+0x30>
+    1120:	4c 8b 06             	mov    (%rsi),%r8
+    1123:	48 8d 35 3d 41 00 00 	lea    0x413d(%rip),%rsi        # 5267 <sizes+0x47>
+    112a:	e8 51 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    112f:	e8 0c ff ff ff       	call   1040 <abort@plt>
+
+0000000000001134 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1134:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1138:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    113b:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    113f:	31 c0                	xor    %eax,%eax
+    1141:	57                   	push   %rdi
+    1142:	48 8b 3d 17 5f 00 00 	mov    0x5f17(%rip),%rdi        # 7060 <stderr@GLIBC_2.2.5>
+    1149:	4c 8d 0d 2c 41 00 00 	lea    0x412c(%rip),%r9        # 527c <sizes+0x5c>
+    1150:	4c 8b 06             	mov    (%rsi),%r8
+    1153:	48 8d 35 0d 41 00 00 	lea    0x410d(%rip),%rsi        # 5267 <sizes+0x47>
+    115a:	e8 21 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    115f:	e8 dc fe ff ff       	call   1040 <abort@plt>
+    1164:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    116b:	00 00 00 
+    116e:	66 90                	xchg   %ax,%ax
+
+0000000000001170 <main>:
+        return acc;
+    });
+}
+
+int main()
+{
+    1170:	                         41 57                	push   %r15
+        //     // p % alignment == 0?
+        //     return ((Length)p & (align-1)) == 0;
+        // }
+        static Node *malloc(Count capacity)
+        {
+            Node *new_n = realloc(nullptr, capacity);
+    1172:	                         31 ff                	xor    %edi,%edi
+    1174:	                         be 00 00 00 01       	mov    $0x1000000,%esi
+    1179:	                         41 56                	push   %r14
+    117b:	                         41 55                	push   %r13
+    117d:	                         41 54                	push   %r12
+    117f:	                         55                   	push   %rbp
+    1180:	                         53                   	push   %rbx
+    1181:	                         48 83 ec 38          	sub    $0x38,%rsp
+    1185:	                         e8 16 31 00 00       	call   42a0 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    118a:	                         48 85 c0             	test   %rax,%rax
+    118d:	/----------------------- 0f 84 39 01 00 00    	je     12cc <main+0x15c>
+    1193:	|                        48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    119a:	|                        00 
+        /**
+         * Returns the number of items currently in use.
+         *
+         * @returns the current in use count.
+         */
+        constexpr Length len(void) const
+    119b:	|                        49 89 c5             	mov    %rax,%r13
+    nel::Length const max_len = sizes[sizeof(sizes) / sizeof(sizes[0]) - 1] / sizeof(int);
+    auto v = nel::heaped::Vector<int>::with_capacity(max_len);
+    for (nel::Index i = 0; i < max_len; ++i) {
+    119e:	|                        31 db                	xor    %ebx,%ebx
+        v.push(int(i % 1000)).unwrap();
+    11a0:	|                        45 31 e4             	xor    %r12d,%r12d
+    11a3:	|                        0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+            return alloc_;
+        }
+
+        constexpr Length len(void) const
+        {
+            return len_;
+    11a8:	|              /-------> 49 8b 45 08          	mov    0x8(%r13),%rax
+            return alloc_;
+    11ac:	|              |         49 8b 55 00          	mov    0x0(%r13),%rdx
+
+    private:
+        // Make room for n more values, only ever grows.
+        bool try_reserve_for(Count const n)
+        {
+            if (len() + n <= capacity()) { return true; }
+    11b0:	|              |         48 8d 70 01          	lea    0x1(%rax),%rsi
+    11b4:	|              |         48 39 f2             	cmp    %rsi,%rdx
+    11b7:	|              |  /----- 0f 82 93 00 00 00    	jb     1250 <main+0xe0>
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+        {
+            if (len() >= capacity()) {
+    11bd:	|     /--------|--|----> 48 39 d0             	cmp    %rdx,%rax
+    11c0:	|     |        |  |  /-- 72 3e                	jb     1200 <main+0x90>
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    11c2:	|  /--|--------|--|--|-> 48 8d 05 f5 3f 00 00 	lea    0x3ff5(%rip),%rax        # 51be <_IO_stdin_used+0x1be>
+    11c9:	|  |  |        |  |  |   48 8d 0d e3 3f 00 00 	lea    0x3fe3(%rip),%rcx        # 51b3 <_IO_stdin_used+0x1b3>
+            , file_name_(file_name)
+            , line_num_(line_num)
+    11d0:	|  |  |        |  |  |   c7 44 24 20 1f 04 00 	movl   $0x41f,0x20(%rsp)
+    11d7:	|  |  |        |  |  |   00 
+            : fn_name_(fn_name)
+    11d8:	|  |  |        |  |  |   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    11dd:	|  |  |        |  |  |   66 48 0f 6e c8       	movq   %rax,%xmm1
+         *
+         * `this` is consumed by the operation.
+         */
+        constexpr void unwrap(Context const &ctx = Context())
+        {
+            return consumev([](void) {}, [](E &&) { nel::panic("not an ok"); }, ctx);
+    11e2:	|  |  |        |  |  |   48 8d 74 24 10       	lea    0x10(%rsp),%rsi
+    11e7:	|  |  |        |  |  |   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    11eb:	|  |  |        |  |  |   48 8d 3d de 3f 00 00 	lea    0x3fde(%rip),%rdi        # 51d0 <_IO_stdin_used+0x1d0>
+    11f2:	|  |  |        |  |  |   0f 29 44 24 10       	movaps %xmm0,0x10(%rsp)
+    11f7:	|  |  |        |  |  |   e8 08 ff ff ff       	call   1104 <nel::panic(char const*, nel::Context const&)>
+    11fc:	|  |  |        |  |  |   0f 1f 40 00          	nopl   0x0(%rax)
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    1200:	|  |  |        |  |  \-> 45 89 64 85 10       	mov    %r12d,0x10(%r13,%rax,4)
+    for (nel::Index i = 0; i < max_len; ++i) {
+    1205:	|  |  |        |  |      48 83 c3 01          	add    $0x1,%rbx
+            len_ += 1;
+    1209:	|  |  |        |  |      48 83 c0 01          	add    $0x1,%rax
+    120d:	|  |  |        |  |      49 89 45 08          	mov    %rax,0x8(%r13)
+    1211:	|  |  |        |  |      48 81 fb 00 00 00 01 	cmp    $0x1000000,%rbx
+    1218:	|  |  |  /-----|--|----- 0f 84 eb 00 00 00    	je     1309 <main+0x199>
+        v.push(int(i % 1000)).unwrap();
+    121e:	|  |  |  |  /--|--|----> 48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    1225:	|  |  |  |  |  |  |      9b c4 20 
+    1228:	|  |  |  |  |  |  |      48 89 da             	mov    %rbx,%rdx
+    122b:	|  |  |  |  |  |  |      41 89 dc             	mov    %ebx,%r12d
+    122e:	|  |  |  |  |  |  |      48 c1 ea 03          	shr    $0x3,%rdx
+    1232:	|  |  |  |  |  |  |      48 f7 e2             	mul    %rdx
+    1235:	|  |  |  |  |  |  |      48 c1 ea 04          	shr    $0x4,%rdx
+    1239:	|  |  |  |  |  |  |      48 69 d2 e8 03 00 00 	imul   $0x3e8,%rdx,%rdx
+    1240:	|  |  |  |  |  |  |      41 29 d4             	sub    %edx,%r12d
+        constexpr Length len(void) const
+    1243:	|  |  |  |  |  \--|----- e9 60 ff ff ff       	jmp    11a8 <main+0x38>
+    1248:	|  |  |  |  |     |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    124f:	|  |  |  |  |     |      00 
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            if (cap <= cur) { return cap; }
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    1250:	|  |  |  |  |     \----> 48 83 fa 03          	cmp    $0x3,%rdx
+    1254:	|  |  |  |  |     /----- 77 5a                	ja     12b0 <main+0x140>
+    1256:	|  |  |  |  |     |      ba 04 00 00 00       	mov    $0x4,%edx
+    125b:	|  |  |  |  |     |      48 39 d6             	cmp    %rdx,%rsi
+    125e:	|  |  |  |  |     |      48 0f 42 f2          	cmovb  %rdx,%rsi
+    1262:	|  |  |  |  |     |      48 39 c6             	cmp    %rax,%rsi
+    1265:	|  |  |  |  |     |      48 0f 43 c6          	cmovae %rsi,%rax
+    1269:	|  |  |  |  |     |      48 89 c5             	mov    %rax,%rbp
+            if (new_cap > max_capacity) { return nullptr; }
+    126c:	|  |  |  |  |     |  /-> 48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    1273:	|  |  |  |  |     |  |   ff ff 1f 
+    1276:	|  |  |  |  |     |  |   48 39 e8             	cmp    %rbp,%rax
+    1279:	|  +--|--|--|-----|--|-- 0f 82 43 ff ff ff    	jb     11c2 <main+0x52>
+            if (align == 0 || (align & (align - 1)) != 0) {
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+            }
+            void *const new_p = is_over_aligned(align)
+                                    ? realloc_aligned(p, align, old_size, new_size)
+                                    : std::realloc(p, new_size);
+    127f:	|  |  |  |  |     |  |   4c 89 ef             	mov    %r13,%rdi
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1282:	|  |  |  |  |     |  |   48 8d 34 ad 14 00 00 	lea    0x14(,%rbp,4),%rsi
+    1289:	|  |  |  |  |     |  |   00 
+    128a:	|  |  |  |  |     |  |   e8 11 fe ff ff       	call   10a0 <realloc@plt>
+    128f:	|  |  |  |  |     |  |   49 89 c5             	mov    %rax,%r13
+            if (new_p == nullptr) {
+    1292:	|  |  |  |  |     |  |   48 85 c0             	test   %rax,%rax
+    1295:	|  +--|--|--|-----|--|-- 0f 84 27 ff ff ff    	je     11c2 <main+0x52>
+            new_n->alloc_ = new_cap;
+    129b:	|  |  |  |  |     |  |   48 89 28             	mov    %rbp,(%rax)
+            return len_;
+    129e:	|  |  |  |  |     |  |   48 89 ea             	mov    %rbp,%rdx
+    12a1:	|  |  |  |  |     |  |   48 8b 40 08          	mov    0x8(%rax),%rax
+    12a5:	|  |  +--|--|-----|--|-- e9 13 ff ff ff       	jmp    11bd <main+0x4d>
+    12aa:	|  |  |  |  |     |  |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    12b0:	|  |  |  |  |     \--|-> 48 8d 2c 12          	lea    (%rdx,%rdx,1),%rbp
+    12b4:	|  |  |  |  |        |   48 39 f5             	cmp    %rsi,%rbp
+    12b7:	|  |  |  |  |        |   48 0f 42 ee          	cmovb  %rsi,%rbp
+    12bb:	|  |  |  |  |        |   48 39 c5             	cmp    %rax,%rbp
+    12be:	|  |  |  |  |        |   48 0f 42 e8          	cmovb  %rax,%rbp
+            } else if (new_cap == item_->capacity()) {
+    12c2:	|  |  |  |  |        |   48 39 d5             	cmp    %rdx,%rbp
+    12c5:	|  |  |  |  |        \-- 75 a5                	jne    126c <main+0xfc>
+    12c7:	|  |  \--|--|----------- e9 f1 fe ff ff       	jmp    11bd <main+0x4d>
+                                    : std::realloc(p, new_size);
+    12cc:	\--|-----|--|----------> bf 24 00 00 00       	mov    $0x24,%edi
+    12d1:	   |     |  |            e8 ba fd ff ff       	call   1090 <malloc@plt>
+    12d6:	   |     |  |            49 89 c5             	mov    %rax,%r13
+            if (new_p == nullptr) {
+    12d9:	   |     |  |            48 85 c0             	test   %rax,%rax
+    12dc:	   \-----|--|----------- 0f 84 e0 fe ff ff    	je     11c2 <main+0x52>
+            new_n->alloc_ = new_cap;
+    12e2:	         |  |            66 0f 6f 05 56 3f 00 	movdqa 0x3f56(%rip),%xmm0        # 5240 <sizes+0x20>
+    12e9:	         |  |            00 
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    12ea:	         |  |            41 c7 45 10 00 00 00 	movl   $0x0,0x10(%r13)
+    12f1:	         |  |            00 
+    for (nel::Index i = 0; i < max_len; ++i) {
+    12f2:	         |  |            bb 01 00 00 00       	mov    $0x1,%ebx
+            new_n->alloc_ = new_cap;
+    12f7:	         |  |            41 0f 11 45 00       	movups %xmm0,0x0(%r13)
+            len_ += 1;
+    12fc:	         |  |            49 c7 45 08 01 00 00 	movq   $0x1,0x8(%r13)
+    1303:	         |  |            00 
+    1304:	         |  \----------- e9 15 ff ff ff       	jmp    121e <main+0xae>
+    1309:	         \-------------> 49 8d 45 10          	lea    0x10(%r13),%rax
+    130d:	                         4c 8d 35 0c 3f 00 00 	lea    0x3f0c(%rip),%r14        # 5220 <sizes>
+    1314:	                         48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1319:	                         48 8d 5c 24 10       	lea    0x10(%rsp),%rbx
+    131e:	                         4c 8d 25 7b 9d 00 00 	lea    0x9d7b(%rip),%r12        # b0a0 <nel::log>
+    }
+
+    for (nel::Length const bytes: sizes) {
+    1325:	                     /-> 4d 8b 3e             	mov    (%r14),%r15
+         * @returns if e > array len, clamp to last elem.
+         * @returns else return slice over region b..e of slice.
+         */
+        Slice slice(Index b, Index e) const
+        {
+            if (b >= e) { return Slice::empty(); }
+    1328:	                     |   49 83 ff 03          	cmp    $0x3,%r15
+    132c:	               /-----|-- 0f 86 2e 01 00 00    	jbe    1460 <main+0x2f0>
+            return len_;
+    1332:	               |     |   49 8b 45 08          	mov    0x8(%r13),%rax
+            if (b >= len_) { return Slice::empty(); }
+    1336:	               |     |   48 85 c0             	test   %rax,%rax
+    1339:	               +-----|-- 0f 84 21 01 00 00    	je     1460 <main+0x2f0>
+        auto s = v.slice(0, bytes / sizeof(int));
+    133f:	               |     |   4c 89 fd             	mov    %r15,%rbp
+    1342:	               |     |   48 c1 ed 02          	shr    $0x2,%rbp
+    1346:	               |     |   48 39 c5             	cmp    %rax,%rbp
+    1349:	               |     |   48 0f 47 e8          	cmova  %rax,%rbp
+            return Slice(values_, len());
+    134d:	               |     |   48 8b 44 24 08       	mov    0x8(%rsp),%rax
+            , len_(len)
+    1352:	               |     |   48 89 6c 24 18       	mov    %rbp,0x18(%rsp)
+    1357:	               |     |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+        nel::log << "working set " << bytes / 1024 << "KiB, " << s.len() << " ints\n";
+    135c:	               |  /--|-> 48 8d 35 77 3e 00 00 	lea    0x3e77(%rip),%rsi        # 51da <_IO_stdin_used+0x1da>
+    1363:	               |  |  |   4c 89 e7             	mov    %r12,%rdi
+    for (nel::Length const bytes: sizes) {
+    1366:	               |  |  |   49 83 c6 08          	add    $0x8,%r14
+        nel::log << "working set " << bytes / 1024 << "KiB, " << s.len() << " ints\n";
+    136a:	               |  |  |   e8 91 2f 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    136f:	               |  |  |   4c 89 fe             	mov    %r15,%rsi
+    1372:	               |  |  |   48 89 c7             	mov    %rax,%rdi
+    1375:	               |  |  |   48 c1 ee 0a          	shr    $0xa,%rsi
+    1379:	               |  |  |   e8 42 30 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    137e:	               |  |  |   48 8d 35 62 3e 00 00 	lea    0x3e62(%rip),%rsi        # 51e7 <_IO_stdin_used+0x1e7>
+    1385:	               |  |  |   48 89 c7             	mov    %rax,%rdi
+    1388:	               |  |  |   e8 73 2f 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    138d:	               |  |  |   48 89 ee             	mov    %rbp,%rsi
+    1390:	               |  |  |   48 89 c7             	mov    %rax,%rdi
+    1393:	               |  |  |   e8 28 30 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    1398:	               |  |  |   48 8d 35 4e 3e 00 00 	lea    0x3e4e(%rip),%rsi        # 51ed <_IO_stdin_used+0x1ed>
+    139f:	               |  |  |   48 89 c7             	mov    %rax,%rdi
+    13a2:	               |  |  |   e8 59 2f 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+        bench_for_each(s);
+    13a7:	               |  |  |   48 89 df             	mov    %rbx,%rdi
+    13aa:	               |  |  |   e8 61 02 00 00       	call   1610 <bench_for_each(nel::Slice<int> const&)>
+        bench_map_first_n_fold(s);
+    13af:	               |  |  |   48 89 df             	mov    %rbx,%rdi
+    13b2:	               |  |  |   e8 09 0a 00 00       	call   1dc0 <bench_map_first_n_fold(nel::Slice<int> const&)>
+        bench_chain(s);
+    13b7:	               |  |  |   48 89 df             	mov    %rbx,%rdi
+    13ba:	               |  |  |   e8 e1 0f 00 00       	call   23a0 <bench_chain(nel::Slice<int> const&)>
+    for (nel::Length const bytes: sizes) {
+    13bf:	               |  |  |   48 8d 05 7a 3e 00 00 	lea    0x3e7a(%rip),%rax        # 5240 <sizes+0x20>
+    13c6:	               |  |  |   49 39 c6             	cmp    %rax,%r14
+    13c9:	               |  |  \-- 0f 85 56 ff ff ff    	jne    1325 <main+0x1b5>
+    }
+    nel::log << "queue " << queue_len << " ints, wrapped\n";
+    13cf:	               |  |      4c 89 e7             	mov    %r12,%rdi
+    13d2:	               |  |      48 8d 35 1b 3e 00 00 	lea    0x3e1b(%rip),%rsi        # 51f4 <_IO_stdin_used+0x1f4>
+    13d9:	               |  |      e8 22 2f 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    13de:	               |  |      be 00 10 00 00       	mov    $0x1000,%esi
+    13e3:	               |  |      48 89 c7             	mov    %rax,%rdi
+    13e6:	               |  |      e8 d5 2f 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    13eb:	               |  |      48 8d 35 09 3e 00 00 	lea    0x3e09(%rip),%rsi        # 51fb <_IO_stdin_used+0x1fb>
+    13f2:	               |  |      48 89 c7             	mov    %rax,%rdi
+    13f5:	               |  |      e8 06 2f 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    13fa:	               |  |      48 8b 4c 24 08       	mov    0x8(%rsp),%rcx
+            return len_;
+    13ff:	               |  |      49 8b 45 08          	mov    0x8(%r13),%rax
+    bench_queue(v.slice());
+    1403:	               |  |      48 89 df             	mov    %rbx,%rdi
+            return Slice(values_, len());
+    1406:	               |  |      48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+    140b:	               |  |      48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    1410:	               |  |      e8 4b 21 00 00       	call   3560 <bench_queue(nel::Slice<int> const&)>
+    nel::log << "sink: " << (long unsigned int)sink << '\n';
+    1415:	               |  |      4c 89 e7             	mov    %r12,%rdi
+    1418:	               |  |      48 8d 35 ec 3d 00 00 	lea    0x3dec(%rip),%rsi        # 520b <_IO_stdin_used+0x20b>
+    141f:	               |  |      e8 dc 2e 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    1424:	               |  |      48 8b 35 6d 9c 00 00 	mov    0x9c6d(%rip),%rsi        # b098 <sink>
+    142b:	               |  |      48 89 c7             	mov    %rax,%rdi
+    142e:	               |  |      e8 8d 2f 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    1433:	               |  |      be 0a 00 00 00       	mov    $0xa,%esi
+    1438:	               |  |      48 89 c7             	mov    %rax,%rdi
+    143b:	               |  |      e8 a0 2e 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    1440:	               |  |      4c 89 ef             	mov    %r13,%rdi
+    1443:	               |  |      e8 e8 fb ff ff       	call   1030 <free@plt>
+}
+    1448:	               |  |      48 83 c4 38          	add    $0x38,%rsp
+    144c:	               |  |      31 c0                	xor    %eax,%eax
+    144e:	               |  |      5b                   	pop    %rbx
+    144f:	               |  |      5d                   	pop    %rbp
+    1450:	               |  |      41 5c                	pop    %r12
+    1452:	               |  |      41 5d                	pop    %r13
+    1454:	               |  |      41 5e                	pop    %r14
+    1456:	               |  |      41 5f                	pop    %r15
+    1458:	               |  |      c3                   	ret
+    1459:	               |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            : content_(nullptr)
+    1460:	               \--|----> 48 c7 44 24 10 00 00 	movq   $0x0,0x10(%rsp)
+    1467:	                  |      00 00 
+    for (nel::Index i = 0; i < max_len; ++i) {
+    1469:	                  |      31 ed                	xor    %ebp,%ebp
+            , len_(0)
+    146b:	                  |      48 c7 44 24 18 00 00 	movq   $0x0,0x18(%rsp)
+    1472:	                  |      00 00 
+    1474:	                  \----- e9 e3 fe ff ff       	jmp    135c <main+0x1ec>
+    1479:	                         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001480 <_GLOBAL__sub_I__close_r>:
+static Queue queue = Queue::empty();
+    1480:	48 8d 15 c9 5b 00 00 	lea    0x5bc9(%rip),%rdx        # 7050 <__dso_handle>
+    1487:	48 8d 35 f2 5b 00 00 	lea    0x5bf2(%rip),%rsi        # 7080 <queue>
+    148e:	48 8d 3d 9b 2d 00 00 	lea    0x2d9b(%rip),%rdi        # 4230 <nel::heapless::Queue<int, 4096ul>::~Queue()>
+    1495:	e9 16 fc ff ff       	jmp    10b0 <__cxa_atexit@plt>
+    149a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000000014a0 <_start>:
+    14a0:	31 ed                	xor    %ebp,%ebp
+    14a2:	49 89 d1             	mov    %rdx,%r9
+    14a5:	5e                   	pop    %rsi
+    14a6:	48 89 e2             	mov    %rsp,%rdx
+    14a9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    14ad:	50                   	push   %rax
+    14ae:	54                   	push   %rsp
+    14af:	45 31 c0             	xor    %r8d,%r8d
+    14b2:	31 c9                	xor    %ecx,%ecx
+    14b4:	48 8d 3d b5 fc ff ff 	lea    -0x34b(%rip),%rdi        # 1170 <main>
+    14bb:	ff 15 ff 5a 00 00    	call   *0x5aff(%rip)        # 6fc0 <__libc_start_main@GLIBC_2.34>
+    14c1:	f4                   	hlt
+    14c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    14c9:	00 00 00 
+    14cc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000014d0 <deregister_tm_clones>:
+    14d0:	    48 8d 3d 81 5b 00 00 	lea    0x5b81(%rip),%rdi        # 7058 <__TMC_END__>
+    14d7:	    48 8d 05 7a 5b 00 00 	lea    0x5b7a(%rip),%rax        # 7058 <__TMC_END__>
+    14de:	    48 39 f8             	cmp    %rdi,%rax
+    14e1:	/-- 74 15                	je     14f8 <deregister_tm_clones+0x28>
+    14e3:	|   48 8b 05 de 5a 00 00 	mov    0x5ade(%rip),%rax        # 6fc8 <_ITM_deregisterTMCloneTable@Base>
+    14ea:	|   48 85 c0             	test   %rax,%rax
+    14ed:	+-- 74 09                	je     14f8 <deregister_tm_clones+0x28>
+    14ef:	|   ff e0                	jmp    *%rax
+    14f1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    14f8:	\-> c3                   	ret
+    14f9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001500 <register_tm_clones>:
+    1500:	    48 8d 3d 51 5b 00 00 	lea    0x5b51(%rip),%rdi        # 7058 <__TMC_END__>
+    1507:	    48 8d 35 4a 5b 00 00 	lea    0x5b4a(%rip),%rsi        # 7058 <__TMC_END__>
+    150e:	    48 29 fe             	sub    %rdi,%rsi
+    1511:	    48 89 f0             	mov    %rsi,%rax
+    1514:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1518:	    48 c1 f8 03          	sar    $0x3,%rax
+    151c:	    48 01 c6             	add    %rax,%rsi
+    151f:	    48 d1 fe             	sar    %rsi
+    1522:	/-- 74 14                	je     1538 <register_tm_clones+0x38>
+    1524:	|   48 8b 05 ad 5a 00 00 	mov    0x5aad(%rip),%rax        # 6fd8 <_ITM_registerTMCloneTable@Base>
+    152b:	|   48 85 c0             	test   %rax,%rax
+    152e:	+-- 74 08                	je     1538 <register_tm_clones+0x38>
+    1530:	|   ff e0                	jmp    *%rax
+    1532:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1538:	\-> c3                   	ret
+    1539:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001540 <__do_global_dtors_aux>:
+    1540:	       f3 0f 1e fa          	endbr64
+    1544:	       80 3d 1d 5b 00 00 00 	cmpb   $0x0,0x5b1d(%rip)        # 7068 <completed.0>
+    154b:	/----- 75 2b                	jne    1578 <__do_global_dtors_aux+0x38>
+    154d:	|      55                   	push   %rbp
+    154e:	|      48 83 3d 8a 5a 00 00 	cmpq   $0x0,0x5a8a(%rip)        # 6fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1555:	|      00 
+    1556:	|      48 89 e5             	mov    %rsp,%rbp
+    1559:	|  /-- 74 0c                	je     1567 <__do_global_dtors_aux+0x27>
+    155b:	|  |   48 8b 3d ee 5a 00 00 	mov    0x5aee(%rip),%rdi        # 7050 <__dso_handle>
+    1562:	|  |   e8 59 fb ff ff       	call   10c0 <__cxa_finalize@plt>
+    1567:	|  \-> e8 64 ff ff ff       	call   14d0 <deregister_tm_clones>
+    156c:	|      c6 05 f5 5a 00 00 01 	movb   $0x1,0x5af5(%rip)        # 7068 <completed.0>
+    1573:	|      5d                   	pop    %rbp
+    1574:	|      c3                   	ret
+    1575:	|      0f 1f 00             	nopl   (%rax)
+    1578:	\----> c3                   	ret
+    1579:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001580 <frame_dummy>:
+    1580:	f3 0f 1e fa          	endbr64
+    1584:	e9 77 ff ff ff       	jmp    1500 <register_tm_clones>
+    1589:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001590 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    1590:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1595:	c3                   	ret
+    1596:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    159d:	00 00 00 
+
+00000000000015a0 <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    15a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    15a5:	c3                   	ret
+    15a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    15ad:	00 00 00 
+
+00000000000015b0 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    15b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    15b5:	c3                   	ret
+    15b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    15bd:	00 00 00 
+
+00000000000015c0 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    15c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    15c5:	c3                   	ret
+    15c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    15cd:	00 00 00 
+
+00000000000015d0 <_read_r>:
+int _read_r(struct _reent *, int) {
+    15d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    15d5:	c3                   	ret
+    15d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    15dd:	00 00 00 
+
+00000000000015e0 <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    15e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    15e5:	c3                   	ret
+    15e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    15ed:	00 00 00 
+
+00000000000015f0 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    15f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    15f5:	c3                   	ret
+    15f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    15fd:	00 00 00 
+
+0000000000001600 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1600:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1605:	c3                   	ret
+    1606:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    160d:	00 00 00 
+
+0000000000001610 <bench_for_each(nel::Slice<int> const&)>:
+{
+    1610:	                                                          41 57                	push   %r15
+    nel::Count const reps = n_total / s.len();
+    1612:	                                                          b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    1617:	                                                          31 d2                	xor    %edx,%edx
+{
+    1619:	                                                          49 89 ff             	mov    %rdi,%r15
+    161c:	                                                          41 56                	push   %r14
+    161e:	                                                          41 55                	push   %r13
+    1620:	                                                          41 54                	push   %r12
+    1622:	                                                          55                   	push   %rbp
+    1623:	                                                          53                   	push   %rbx
+    1624:	                                                          48 83 ec 48          	sub    $0x48,%rsp
+            return len_;
+    1628:	                                                          4c 8b 6f 08          	mov    0x8(%rdi),%r13
+{
+
+inline long unsigned int now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    162c:	                                                          bf 01 00 00 00       	mov    $0x1,%edi
+    1631:	                                                          48 8d 74 24 30       	lea    0x30(%rsp),%rsi
+    nel::Count const reps = n_total / s.len();
+    1636:	                                                          49 f7 f5             	div    %r13
+    1639:	                                                          48 89 74 24 08       	mov    %rsi,0x8(%rsp)
+    163e:	                                                          49 89 c4             	mov    %rax,%r12
+    1641:	                                                          e8 0a fa ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1646:	                                                          48 8b 44 24 30       	mov    0x30(%rsp),%rax
+    164b:	                                                          48 8b 6c 24 38       	mov    0x38(%rsp),%rbp
+    1650:	                                                          48 89 44 24 10       	mov    %rax,0x10(%rsp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    1655:	                                                          49 81 fd 00 90 d0 03 	cmp    $0x3d09000,%r13
+    165c:	/-------------------------------------------------------- 0f 87 d7 05 00 00    	ja     1c39 <bench_for_each(nel::Slice<int> const&)+0x629>
+    1662:	|                                                         49 8b 47 08          	mov    0x8(%r15),%rax
+            return content_;
+    1666:	|                                                         4d 8b 07             	mov    (%r15),%r8
+    1669:	|                                                         31 ff                	xor    %edi,%edi
+    166b:	|                                                         48 89 c1             	mov    %rax,%rcx
+    166e:	|                                                         48 89 c3             	mov    %rax,%rbx
+    1671:	|                                                         4c 8d 58 ff          	lea    -0x1(%rax),%r11
+    1675:	|                                                         48 c1 e9 02          	shr    $0x2,%rcx
+    1679:	|                                                         48 83 e3 fc          	and    $0xfffffffffffffffc,%rbx
+    167d:	|                                                         48 c1 e1 04          	shl    $0x4,%rcx
+    1681:	|                                                         4c 01 c1             	add    %r8,%rcx
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    1684:	|                                                         48 85 c0             	test   %rax,%rax
+    1687:	|  /----------------------------------------------------- 0f 84 a3 05 00 00    	je     1c30 <bench_for_each(nel::Slice<int> const&)+0x620>
+    168d:	|  |                                                      49 89 c6             	mov    %rax,%r14
+    1690:	|  |                                                      45 31 ed             	xor    %r13d,%r13d
+            acc += Acc(p[i]);
+    1693:	|  |                                                      66 0f ef e4          	pxor   %xmm4,%xmm4
+    1697:	|  |                                                      41 83 e6 03          	and    $0x3,%r14d
+    169b:	|  |                                                      0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    16a0:	|  |                                               /----> 49 83 fb 02          	cmp    $0x2,%r11
+    16a4:	|  |  /--------------------------------------------|----- 0f 86 97 05 00 00    	jbe    1c41 <bench_for_each(nel::Slice<int> const&)+0x631>
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    16aa:	|  |  |                                            |      4c 89 c2             	mov    %r8,%rdx
+    16ad:	|  |  |                                            |      66 0f ef d2          	pxor   %xmm2,%xmm2
+    16b1:	|  |  |                                            |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            acc += Acc(p[i]);
+    16b8:	|  |  |                                            |  /-> f3 0f 6f 02          	movdqu (%rdx),%xmm0
+    16bc:	|  |  |                                            |  |   66 0f 6f cc          	movdqa %xmm4,%xmm1
+    16c0:	|  |  |                                            |  |   48 83 c2 10          	add    $0x10,%rdx
+    16c4:	|  |  |                                            |  |   66 0f 66 c8          	pcmpgtd %xmm0,%xmm1
+    16c8:	|  |  |                                            |  |   66 0f 6f d8          	movdqa %xmm0,%xmm3
+    16cc:	|  |  |                                            |  |   66 0f 62 d9          	punpckldq %xmm1,%xmm3
+    16d0:	|  |  |                                            |  |   66 0f 6a c1          	punpckhdq %xmm1,%xmm0
+    16d4:	|  |  |                                            |  |   66 0f d4 c3          	paddq  %xmm3,%xmm0
+    16d8:	|  |  |                                            |  |   66 0f d4 d0          	paddq  %xmm0,%xmm2
+        constexpr Length len(void) const
+    16dc:	|  |  |                                            |  |   48 39 ca             	cmp    %rcx,%rdx
+    16df:	|  |  |                                            |  \-- 75 d7                	jne    16b8 <bench_for_each(nel::Slice<int> const&)+0xa8>
+    16e1:	|  |  |                                            |      66 0f 6f c2          	movdqa %xmm2,%xmm0
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    16e5:	|  |  |                                            |      48 89 de             	mov    %rbx,%rsi
+    16e8:	|  |  |                                            |      66 0f 73 d8 08       	psrldq $0x8,%xmm0
+    16ed:	|  |  |                                            |      66 0f d4 d0          	paddq  %xmm0,%xmm2
+    16f1:	|  |  |                                            |      66 48 0f 7e d2       	movq   %xmm2,%rdx
+    16f6:	|  |  |                                            |      4d 85 f6             	test   %r14,%r14
+    16f9:	|  |  |                                            |  /-- 74 31                	je     172c <bench_for_each(nel::Slice<int> const&)+0x11c>
+            acc += Acc(p[i]);
+    16fb:	|  |  |  /-----------------------------------------|--|-> 4d 63 14 b0          	movslq (%r8,%rsi,4),%r10
+    16ff:	|  |  |  |                                         |  |   4c 8d 0c b5 00 00 00 	lea    0x0(,%rsi,4),%r9
+    1706:	|  |  |  |                                         |  |   00 
+    1707:	|  |  |  |                                         |  |   4c 01 d2             	add    %r10,%rdx
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    170a:	|  |  |  |                                         |  |   4c 8d 56 01          	lea    0x1(%rsi),%r10
+    170e:	|  |  |  |                                         |  |   49 39 c2             	cmp    %rax,%r10
+    1711:	|  |  |  |                                         |  +-- 73 19                	jae    172c <bench_for_each(nel::Slice<int> const&)+0x11c>
+            acc += Acc(p[i]);
+    1713:	|  |  |  |                                         |  |   4f 63 54 08 04       	movslq 0x4(%r8,%r9,1),%r10
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    1718:	|  |  |  |                                         |  |   48 83 c6 02          	add    $0x2,%rsi
+            acc += Acc(p[i]);
+    171c:	|  |  |  |                                         |  |   4c 01 d2             	add    %r10,%rdx
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    171f:	|  |  |  |                                         |  |   48 39 c6             	cmp    %rax,%rsi
+    1722:	|  |  |  |                                         |  +-- 73 08                	jae    172c <bench_for_each(nel::Slice<int> const&)+0x11c>
+            acc += Acc(p[i]);
+    1724:	|  |  |  |                                         |  |   4b 63 74 08 08       	movslq 0x8(%r8,%r9,1),%rsi
+    1729:	|  |  |  |                                         |  |   48 01 f2             	add    %rsi,%rdx
+        for (nel::Index i = 0; i < reps; ++i) {
+    172c:	|  |  |  |                                         |  \-> 48 83 c7 01          	add    $0x1,%rdi
+            r += f(s);
+    1730:	|  |  |  |                                         |      49 01 d5             	add    %rdx,%r13
+        for (nel::Index i = 0; i < reps; ++i) {
+    1733:	|  |  |  |                                         |      4c 39 e7             	cmp    %r12,%rdi
+    1736:	|  |  |  |                                         \----- 0f 82 64 ff ff ff    	jb     16a0 <bench_for_each(nel::Slice<int> const&)+0x90>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    173c:	|  |  |  |     /----------------------------------------> 48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    1741:	|  |  |  |     |                                          bf 01 00 00 00       	mov    $0x1,%edi
+    1746:	|  |  |  |     |                                          e8 05 f9 ff ff       	call   1050 <clock_gettime@plt>
+    bench::report_per_item(name, t, reps * s.len());
+    174b:	|  |  |  |     |                                          4d 0f af 67 08       	imul   0x8(%r15),%r12
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1750:	|  |  |  |     |                                          48 8b 44 24 30       	mov    0x30(%rsp),%rax
+    sink = sink + r;
+    1755:	|  |  |  |     |                                          48 8b 15 3c 99 00 00 	mov    0x993c(%rip),%rdx        # b098 <sink>
+    175c:	|  |  |  |     |                                          48 8b 4c 24 38       	mov    0x38(%rsp),%rcx
+    1761:	|  |  |  |     |                                          4c 01 ea             	add    %r13,%rdx
+    1764:	|  |  |  |     |                                          48 89 15 2d 99 00 00 	mov    %rdx,0x992d(%rip)        # b098 <sink>
+
+// Log a result line: name, and time per item in ns (to 2 decimal places).
+inline void report_per_item(char const *const name, long unsigned int const ns,
+                            long unsigned int const items)
+{
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    176b:	|  |  |  |     |                                          4d 85 e4             	test   %r12,%r12
+    176e:	|  |  |  |     |  /-------------------------------------- 0f 84 d6 04 00 00    	je     1c4a <bench_for_each(nel::Slice<int> const&)+0x63a>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1774:	|  |  |  |     |  |                                       48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    177b:	|  |  |  |     |  |                                       31 d2                	xor    %edx,%edx
+    long unsigned int const frac = cns % 100UL;
+    nel::log << name << ": " << cns / 100UL << '.' << (frac < 10 ? "0" : "") << frac
+             << "ns/item\n";
+    177d:	|  |  |  |     |  |                                       48 8d 35 82 38 00 00 	lea    0x3882(%rip),%rsi        # 5006 <_IO_stdin_used+0x6>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1784:	|  |  |  |     |  |                                       48 69 5c 24 10 00 ca 	imul   $0x3b9aca00,0x10(%rsp),%rbx
+    178b:	|  |  |  |     |  |                                       9a 3b 
+    return now_ns() - b;
+    178d:	|  |  |  |     |  |                                       48 29 e8             	sub    %rbp,%rax
+    1790:	|  |  |  |     |  |                                       48 01 c8             	add    %rcx,%rax
+    1793:	|  |  |  |     |  |                                       48 29 d8             	sub    %rbx,%rax
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1796:	|  |  |  |     |  |                                       48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    179a:	|  |  |  |     |  |                                       48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    179e:	|  |  |  |     |  |                                       48 c1 e0 02          	shl    $0x2,%rax
+    17a2:	|  |  |  |     |  |                                       49 f7 f4             	div    %r12
+    long unsigned int const frac = cns % 100UL;
+    17a5:	|  |  |  |     |  |                                       49 89 c4             	mov    %rax,%r12
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    17a8:	|  |  |  |     |  |                                       48 89 c1             	mov    %rax,%rcx
+    long unsigned int const frac = cns % 100UL;
+    17ab:	|  |  |  |     |  |                                       48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    17b2:	|  |  |  |     |  |                                       c2 f5 28 
+    17b5:	|  |  |  |     |  |                                       49 c1 ec 02          	shr    $0x2,%r12
+    17b9:	|  |  |  |     |  |                                       49 f7 e4             	mul    %r12
+    17bc:	|  |  |  |     |  |                                       49 89 d4             	mov    %rdx,%r12
+    17bf:	|  |  |  |     |  |                                       49 c1 ec 02          	shr    $0x2,%r12
+    17c3:	|  |  |  |     |  |                                       4b 8d 04 a4          	lea    (%r12,%r12,4),%rax
+    17c7:	|  |  |  |     |  |                                       4c 89 e3             	mov    %r12,%rbx
+    17ca:	|  |  |  |     |  |                                       48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    17ce:	|  |  |  |     |  |                                       48 c1 e0 02          	shl    $0x2,%rax
+    17d2:	|  |  |  |     |  |                                       48 29 c1             	sub    %rax,%rcx
+             << "ns/item\n";
+    17d5:	|  |  |  |     |  |                                       48 8d 05 c4 98 00 00 	lea    0x98c4(%rip),%rax        # b0a0 <nel::log>
+    17dc:	|  |  |  |     |  |                                       48 89 c7             	mov    %rax,%rdi
+    long unsigned int const frac = cns % 100UL;
+    17df:	|  |  |  |     |  |                                       49 89 cc             	mov    %rcx,%r12
+             << "ns/item\n";
+    17e2:	|  |  |  |     |  |                                       48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    17e7:	|  |  |  |     |  |                                       e8 14 2b 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    17ec:	|  |  |  |     |  |                                       48 89 c7             	mov    %rax,%rdi
+    17ef:	|  |  |  |     |  |                                       48 8d 05 19 3a 00 00 	lea    0x3a19(%rip),%rax        # 520f <_IO_stdin_used+0x20f>
+    17f6:	|  |  |  |     |  |                                       48 89 c6             	mov    %rax,%rsi
+    17f9:	|  |  |  |     |  |                                       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    17fe:	|  |  |  |     |  |                                       e8 fd 2a 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    1803:	|  |  |  |     |  |                                       48 89 de             	mov    %rbx,%rsi
+    1806:	|  |  |  |     |  |                                       48 89 c7             	mov    %rax,%rdi
+    1809:	|  |  |  |     |  |                                       e8 b2 2b 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    180e:	|  |  |  |     |  |                                       be 2e 00 00 00       	mov    $0x2e,%esi
+    1813:	|  |  |  |     |  |                                       48 89 c7             	mov    %rax,%rdi
+    1816:	|  |  |  |     |  |                                       e8 c5 2a 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    181b:	|  |  |  |     |  |                                       49 83 fc 0a          	cmp    $0xa,%r12
+    181f:	|  |  |  |     |  |                                       48 8d 35 de 37 00 00 	lea    0x37de(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    1826:	|  |  |  |     |  |                                       48 89 c7             	mov    %rax,%rdi
+    1829:	|  |  |  |     |  |                                       48 8d 05 da 39 00 00 	lea    0x39da(%rip),%rax        # 520a <_IO_stdin_used+0x20a>
+    1830:	|  |  |  |     |  |                                       48 0f 43 f0          	cmovae %rax,%rsi
+    1834:	|  |  |  |     |  |     /-------------------------------> e8 c7 2a 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    1839:	|  |  |  |     |  |     |                                 4c 89 e6             	mov    %r12,%rsi
+    183c:	|  |  |  |     |  |     |                                 4c 8d 35 df 37 00 00 	lea    0x37df(%rip),%r14        # 5022 <_IO_stdin_used+0x22>
+    1843:	|  |  |  |     |  |     |                                 48 89 c7             	mov    %rax,%rdi
+    1846:	|  |  |  |     |  |     |                                 e8 75 2b 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    184b:	|  |  |  |     |  |     |                                 4c 89 f6             	mov    %r14,%rsi
+    184e:	|  |  |  |     |  |     |                                 48 89 c7             	mov    %rax,%rdi
+    1851:	|  |  |  |     |  |     |                                 e8 aa 2a 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+            return len_;
+    1856:	|  |  |  |     |  |     |                                 49 8b 5f 08          	mov    0x8(%r15),%rbx
+    nel::Count const reps = n_total / s.len();
+    185a:	|  |  |  |     |  |     |                                 b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    185f:	|  |  |  |     |  |     |                                 31 d2                	xor    %edx,%edx
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1861:	|  |  |  |     |  |     |                                 48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    1866:	|  |  |  |     |  |     |                                 bf 01 00 00 00       	mov    $0x1,%edi
+    186b:	|  |  |  |     |  |     |                                 48 f7 f3             	div    %rbx
+    186e:	|  |  |  |     |  |     |                                 48 89 c5             	mov    %rax,%rbp
+    1871:	|  |  |  |     |  |     |                                 e8 da f7 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1876:	|  |  |  |     |  |     |                                 48 8b 44 24 30       	mov    0x30(%rsp),%rax
+    187b:	|  |  |  |     |  |     |                                 4c 8b 6c 24 38       	mov    0x38(%rsp),%r13
+    1880:	|  |  |  |     |  |     |                                 48 89 44 24 20       	mov    %rax,0x20(%rsp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    1885:	|  |  |  |     |  |     |                                 48 81 fb 00 90 d0 03 	cmp    $0x3d09000,%rbx
+    188c:	|  |  |  |  /--|--|-----|-------------------------------- 0f 87 15 05 00 00    	ja     1da7 <bench_for_each(nel::Slice<int> const&)+0x797>
+        }
+
+    public:
+        constexpr SliceIterator(T arr[], Count len)
+            : b_(arr)
+            , e_(arr + len)
+    1892:	|  |  |  |  |  |  |     |                                 49 8b 47 08          	mov    0x8(%r15),%rax
+            return content_;
+    1896:	|  |  |  |  |  |  |     |                                 49 8b 3f             	mov    (%r15),%rdi
+    Acc r = 0;
+    1899:	|  |  |  |  |  |  |     |                                 31 db                	xor    %ebx,%ebx
+        for (nel::Index i = 0; i < reps; ++i) {
+    189b:	|  |  |  |  |  |  |     |                                 31 c9                	xor    %ecx,%ecx
+        s.iter().for_each([&acc](int const &e) { acc += Acc(e); });
+    189d:	|  |  |  |  |  |  |     |                                 66 0f ef e4          	pxor   %xmm4,%xmm4
+    18a1:	|  |  |  |  |  |  |     |                                 4c 8d 1c 85 fc ff ff 	lea    -0x4(,%rax,4),%r11
+    18a8:	|  |  |  |  |  |  |     |                                 ff 
+            , e_(arr + len)
+    18a9:	|  |  |  |  |  |  |     |                                 4c 8d 04 87          	lea    (%rdi,%rax,4),%r8
+    18ad:	|  |  |  |  |  |  |     |                                 4d 89 d9             	mov    %r11,%r9
+    18b0:	|  |  |  |  |  |  |     |                                 49 c1 e9 02          	shr    $0x2,%r9
+    18b4:	|  |  |  |  |  |  |     |                                 49 83 c1 01          	add    $0x1,%r9
+    18b8:	|  |  |  |  |  |  |     |                                 4c 89 ce             	mov    %r9,%rsi
+    18bb:	|  |  |  |  |  |  |     |                                 4c 89 c8             	mov    %r9,%rax
+    18be:	|  |  |  |  |  |  |     |                                 41 83 e1 03          	and    $0x3,%r9d
+    18c2:	|  |  |  |  |  |  |     |                                 48 c1 ee 02          	shr    $0x2,%rsi
+    18c6:	|  |  |  |  |  |  |     |                                 48 83 e0 fc          	and    $0xfffffffffffffffc,%rax
+    18ca:	|  |  |  |  |  |  |     |                                 48 c1 e6 04          	shl    $0x4,%rsi
+    18ce:	|  |  |  |  |  |  |     |                                 4c 8d 24 87          	lea    (%rdi,%rax,4),%r12
+    18d2:	|  |  |  |  |  |  |     |                                 48 01 fe             	add    %rdi,%rsi
+    18d5:	|  |  |  |  |  |  |     |                                 0f 1f 00             	nopl   (%rax)
+        Acc acc = 0;
+    18d8:	|  |  |  |  |  |  |     |                       /-------> 31 c0                	xor    %eax,%eax
+        // non-mutating.non-consuming
+        Optional<OutT> next(void)
+        {
+            // Some() takes a move, so want to move the reference into the optional.
+            // ref(),
+            if (b_ == e_) { return None; }
+    18da:	|  |  |  |  |  |  |     |                       |         4c 39 c7             	cmp    %r8,%rdi
+    18dd:	|  |  |  |  |  |  |     |                       |  /----- 74 7a                	je     1959 <bench_for_each(nel::Slice<int> const&)+0x349>
+    18df:	|  |  |  |  |  |  |     |                       |  |      49 83 fb 08          	cmp    $0x8,%r11
+    18e3:	|  |  |  |  |  |  |  /--|-----------------------|--|----- 0f 86 72 04 00 00    	jbe    1d5b <bench_for_each(nel::Slice<int> const&)+0x74b>
+    18e9:	|  |  |  |  |  |  |  |  |                       |  |      48 89 f8             	mov    %rdi,%rax
+    18ec:	|  |  |  |  |  |  |  |  |                       |  |      66 0f ef d2          	pxor   %xmm2,%xmm2
+        s.iter().for_each([&acc](int const &e) { acc += Acc(e); });
+    18f0:	|  |  |  |  |  |  |  |  |                       |  |  /-> f3 0f 6f 00          	movdqu (%rax),%xmm0
+    18f4:	|  |  |  |  |  |  |  |  |                       |  |  |   66 0f 6f cc          	movdqa %xmm4,%xmm1
+    18f8:	|  |  |  |  |  |  |  |  |                       |  |  |   48 83 c0 10          	add    $0x10,%rax
+    18fc:	|  |  |  |  |  |  |  |  |                       |  |  |   66 0f 66 c8          	pcmpgtd %xmm0,%xmm1
+    1900:	|  |  |  |  |  |  |  |  |                       |  |  |   66 0f 6f d8          	movdqa %xmm0,%xmm3
+    1904:	|  |  |  |  |  |  |  |  |                       |  |  |   66 0f 62 d9          	punpckldq %xmm1,%xmm3
+    1908:	|  |  |  |  |  |  |  |  |                       |  |  |   66 0f 6a c1          	punpckhdq %xmm1,%xmm0
+    190c:	|  |  |  |  |  |  |  |  |                       |  |  |   66 0f d4 c3          	paddq  %xmm3,%xmm0
+    1910:	|  |  |  |  |  |  |  |  |                       |  |  |   66 0f d4 d0          	paddq  %xmm0,%xmm2
+        Optional<OutT> next(void)
+    1914:	|  |  |  |  |  |  |  |  |                       |  |  |   48 39 c6             	cmp    %rax,%rsi
+    1917:	|  |  |  |  |  |  |  |  |                       |  |  \-- 75 d7                	jne    18f0 <bench_for_each(nel::Slice<int> const&)+0x2e0>
+    1919:	|  |  |  |  |  |  |  |  |                       |  |      66 0f 6f c2          	movdqa %xmm2,%xmm0
+            : b_(arr)
+    191d:	|  |  |  |  |  |  |  |  |                       |  |      4c 89 e2             	mov    %r12,%rdx
+    1920:	|  |  |  |  |  |  |  |  |                       |  |      66 0f 73 d8 08       	psrldq $0x8,%xmm0
+    1925:	|  |  |  |  |  |  |  |  |                       |  |      66 0f d4 d0          	paddq  %xmm0,%xmm2
+    1929:	|  |  |  |  |  |  |  |  |                       |  |      66 48 0f 7e d0       	movq   %xmm2,%rax
+    192e:	|  |  |  |  |  |  |  |  |                       |  |      4d 85 c9             	test   %r9,%r9
+    1931:	|  |  |  |  |  |  |  |  |                       |  +----- 74 26                	je     1959 <bench_for_each(nel::Slice<int> const&)+0x349>
+    1933:	|  |  |  |  |  |  |  |  |     /-----------------|--|----> 4c 63 12             	movslq (%rdx),%r10
+    1936:	|  |  |  |  |  |  |  |  |     |                 |  |      4c 01 d0             	add    %r10,%rax
+            return Some(*b_++);
+    1939:	|  |  |  |  |  |  |  |  |     |                 |  |      4c 8d 52 04          	lea    0x4(%rdx),%r10
+            if (b_ == e_) { return None; }
+    193d:	|  |  |  |  |  |  |  |  |     |                 |  |      4d 39 d0             	cmp    %r10,%r8
+    1940:	|  |  |  |  |  |  |  |  |     |                 |  +----- 74 17                	je     1959 <bench_for_each(nel::Slice<int> const&)+0x349>
+    1942:	|  |  |  |  |  |  |  |  |     |                 |  |      4c 63 52 04          	movslq 0x4(%rdx),%r10
+    1946:	|  |  |  |  |  |  |  |  |     |                 |  |      4c 01 d0             	add    %r10,%rax
+            return Some(*b_++);
+    1949:	|  |  |  |  |  |  |  |  |     |                 |  |      4c 8d 52 08          	lea    0x8(%rdx),%r10
+            if (b_ == e_) { return None; }
+    194d:	|  |  |  |  |  |  |  |  |     |                 |  |      4d 39 d0             	cmp    %r10,%r8
+    1950:	|  |  |  |  |  |  |  |  |     |                 |  +----- 74 07                	je     1959 <bench_for_each(nel::Slice<int> const&)+0x349>
+    1952:	|  |  |  |  |  |  |  |  |     |                 |  |      48 63 52 08          	movslq 0x8(%rdx),%rdx
+    1956:	|  |  |  |  |  |  |  |  |     |                 |  |      48 01 d0             	add    %rdx,%rax
+        for (nel::Index i = 0; i < reps; ++i) {
+    1959:	|  |  |  |  |  |  |  |  |     |                 |  \----> 48 83 c1 01          	add    $0x1,%rcx
+            r += f(s);
+    195d:	|  |  |  |  |  |  |  |  |     |                 |         48 01 c3             	add    %rax,%rbx
+        for (nel::Index i = 0; i < reps; ++i) {
+    1960:	|  |  |  |  |  |  |  |  |     |                 |         48 39 e9             	cmp    %rbp,%rcx
+    1963:	|  |  |  |  |  |  |  |  |     |                 \-------- 0f 82 6f ff ff ff    	jb     18d8 <bench_for_each(nel::Slice<int> const&)+0x2c8>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1969:	|  |  |  |  |  |  |  |  |  /--|-------------------------> 48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    196e:	|  |  |  |  |  |  |  |  |  |  |                           bf 01 00 00 00       	mov    $0x1,%edi
+    1973:	|  |  |  |  |  |  |  |  |  |  |                           e8 d8 f6 ff ff       	call   1050 <clock_gettime@plt>
+    bench::report_per_item(name, t, reps * s.len());
+    1978:	|  |  |  |  |  |  |  |  |  |  |                           49 0f af 6f 08       	imul   0x8(%r15),%rbp
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    197d:	|  |  |  |  |  |  |  |  |  |  |                           48 8b 44 24 30       	mov    0x30(%rsp),%rax
+    sink = sink + r;
+    1982:	|  |  |  |  |  |  |  |  |  |  |                           48 8b 15 0f 97 00 00 	mov    0x970f(%rip),%rdx        # b098 <sink>
+    1989:	|  |  |  |  |  |  |  |  |  |  |                           48 8b 4c 24 38       	mov    0x38(%rsp),%rcx
+    198e:	|  |  |  |  |  |  |  |  |  |  |                           48 01 da             	add    %rbx,%rdx
+    1991:	|  |  |  |  |  |  |  |  |  |  |                           48 89 15 00 97 00 00 	mov    %rdx,0x9700(%rip)        # b098 <sink>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1998:	|  |  |  |  |  |  |  |  |  |  |                           48 85 ed             	test   %rbp,%rbp
+    199b:	|  |  |  |  |  |  |  |  |  |  |        /----------------- 0f 85 01 03 00 00    	jne    1ca2 <bench_for_each(nel::Slice<int> const&)+0x692>
+             << "ns/item\n";
+    19a1:	|  |  |  |  |  |  |  |  |  |  |        |                  48 8b 7c 24 18       	mov    0x18(%rsp),%rdi
+    19a6:	|  |  |  |  |  |  |  |  |  |  |        |                  48 8d 35 7e 36 00 00 	lea    0x367e(%rip),%rsi        # 502b <_IO_stdin_used+0x2b>
+    19ad:	|  |  |  |  |  |  |  |  |  |  |        |                  e8 4e 29 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    19b2:	|  |  |  |  |  |  |  |  |  |  |        |                  48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    19b7:	|  |  |  |  |  |  |  |  |  |  |        |                  48 89 c7             	mov    %rax,%rdi
+    19ba:	|  |  |  |  |  |  |  |  |  |  |        |                  e8 41 29 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    19bf:	|  |  |  |  |  |  |  |  |  |  |        |                  31 f6                	xor    %esi,%esi
+    19c1:	|  |  |  |  |  |  |  |  |  |  |        |                  48 89 c7             	mov    %rax,%rdi
+    19c4:	|  |  |  |  |  |  |  |  |  |  |        |                  e8 f7 29 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    19c9:	|  |  |  |  |  |  |  |  |  |  |        |                  be 2e 00 00 00       	mov    $0x2e,%esi
+    19ce:	|  |  |  |  |  |  |  |  |  |  |        |                  48 89 c7             	mov    %rax,%rdi
+    19d1:	|  |  |  |  |  |  |  |  |  |  |        |                  e8 0a 29 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    19d6:	|  |  |  |  |  |  |  |  |  |  |        |                  48 8d 35 27 36 00 00 	lea    0x3627(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    19dd:	|  |  |  |  |  |  |  |  |  |  |        |                  48 89 c7             	mov    %rax,%rdi
+    19e0:	|  |  |  |  |  |  |  |  |  |  |     /--|----------------> e8 1b 29 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    19e5:	|  |  |  |  |  |  |  |  |  |  |     |  |                  48 89 ee             	mov    %rbp,%rsi
+    19e8:	|  |  |  |  |  |  |  |  |  |  |     |  |                  48 89 c7             	mov    %rax,%rdi
+    19eb:	|  |  |  |  |  |  |  |  |  |  |     |  |                  e8 d0 29 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    19f0:	|  |  |  |  |  |  |  |  |  |  |     |  |                  4c 89 f6             	mov    %r14,%rsi
+    19f3:	|  |  |  |  |  |  |  |  |  |  |     |  |                  48 89 c7             	mov    %rax,%rdi
+    19f6:	|  |  |  |  |  |  |  |  |  |  |     |  |                  e8 05 29 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+            return len_;
+    19fb:	|  |  |  |  |  |  |  |  |  |  |     |  |                  49 8b 6f 08          	mov    0x8(%r15),%rbp
+    nel::Count const reps = n_total / s.len();
+    19ff:	|  |  |  |  |  |  |  |  |  |  |     |  |                  b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    1a04:	|  |  |  |  |  |  |  |  |  |  |     |  |                  31 d2                	xor    %edx,%edx
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1a06:	|  |  |  |  |  |  |  |  |  |  |     |  |                  48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    1a0b:	|  |  |  |  |  |  |  |  |  |  |     |  |                  bf 01 00 00 00       	mov    $0x1,%edi
+    1a10:	|  |  |  |  |  |  |  |  |  |  |     |  |                  48 f7 f5             	div    %rbp
+    1a13:	|  |  |  |  |  |  |  |  |  |  |     |  |                  48 89 c3             	mov    %rax,%rbx
+    1a16:	|  |  |  |  |  |  |  |  |  |  |     |  |                  e8 35 f6 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1a1b:	|  |  |  |  |  |  |  |  |  |  |     |  |                  48 8b 44 24 30       	mov    0x30(%rsp),%rax
+    1a20:	|  |  |  |  |  |  |  |  |  |  |     |  |                  48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    1a25:	|  |  |  |  |  |  |  |  |  |  |     |  |                  48 8b 44 24 38       	mov    0x38(%rsp),%rax
+    1a2a:	|  |  |  |  |  |  |  |  |  |  |     |  |                  48 89 44 24 28       	mov    %rax,0x28(%rsp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    1a2f:	|  |  |  |  |  |  |  |  |  |  |     |  |                  48 81 fd 00 90 d0 03 	cmp    $0x3d09000,%rbp
+    1a36:	|  |  |  |  |  |  |  |  |  |  |  /--|--|----------------- 0f 87 72 03 00 00    	ja     1dae <bench_for_each(nel::Slice<int> const&)+0x79e>
+            , e_(arr + len)
+    1a3c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  49 8b 57 08          	mov    0x8(%r15),%rdx
+            return content_;
+    1a40:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  4d 8b 07             	mov    (%r15),%r8
+        s.iter().for_each2([&acc](int const &e) { acc += Acc(e); });
+    1a43:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  66 0f ef e4          	pxor   %xmm4,%xmm4
+    1a47:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  4c 8d 1c 95 fc ff ff 	lea    -0x4(,%rdx,4),%r11
+    1a4e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  ff 
+            , e_(arr + len)
+    1a4f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  49 8d 04 90          	lea    (%r8,%rdx,4),%rax
+    1a53:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  4d 89 d9             	mov    %r11,%r9
+    1a56:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  49 c1 e9 02          	shr    $0x2,%r9
+    1a5a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  49 83 c1 01          	add    $0x1,%r9
+    1a5e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  4c 89 c9             	mov    %r9,%rcx
+    1a61:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  4c 89 ca             	mov    %r9,%rdx
+    1a64:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  48 c1 e9 02          	shr    $0x2,%rcx
+    1a68:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+    1a6c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  48 c1 e1 04          	shl    $0x4,%rcx
+    1a70:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  49 8d 3c 90          	lea    (%r8,%rdx,4),%rdi
+    1a74:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  4c 01 c1             	add    %r8,%rcx
+    1a77:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  49 83 fb 08          	cmp    $0x8,%r11
+    1a7b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  49 0f 46 f8          	cmovbe %r8,%rdi
+    Acc r = 0;
+    1a7f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  31 ed                	xor    %ebp,%ebp
+        for (nel::Index i = 0; i < reps; ++i) {
+    1a81:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  31 f6                	xor    %esi,%esi
+    1a83:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  41 83 e1 03          	and    $0x3,%r9d
+            return (b_ == e_);
+        }
+
+        void inc(void)
+        {
+            ++b_;
+    1a87:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  4c 8d 67 04          	lea    0x4(%rdi),%r12
+    1a8b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  4c 8d 6f 08          	lea    0x8(%rdi),%r13
+    1a8f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  90                   	nop
+        template<typename F>
+        void for_each2(F &&fn)
+#        endif
+        {
+#        if 1
+            for (; !self().is_done(); self().inc()) {
+    1a90:	|  |  |  |  |  |  |  |  |  |  |  |  |  |        /-------> 49 39 c0             	cmp    %rax,%r8
+    1a93:	|  |  |  |  |  |  |  |  |  |  |  |  |  |        |  /----- 74 7c                	je     1b11 <bench_for_each(nel::Slice<int> const&)+0x501>
+    1a95:	|  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |      49 83 fb 08          	cmp    $0x8,%r11
+    1a99:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  /-----|--|----- 0f 86 b5 02 00 00    	jbe    1d54 <bench_for_each(nel::Slice<int> const&)+0x744>
+    1a9f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |      4c 89 c2             	mov    %r8,%rdx
+    1aa2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |      66 0f ef d2          	pxor   %xmm2,%xmm2
+    1aa6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |      66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1aad:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |      00 00 00 
+        s.iter().for_each2([&acc](int const &e) { acc += Acc(e); });
+    1ab0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  /-> f3 0f 6f 02          	movdqu (%rdx),%xmm0
+    1ab4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |   66 0f 6f cc          	movdqa %xmm4,%xmm1
+    1ab8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |   48 83 c2 10          	add    $0x10,%rdx
+    1abc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |   66 0f 66 c8          	pcmpgtd %xmm0,%xmm1
+    1ac0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |   66 0f 6f d8          	movdqa %xmm0,%xmm3
+    1ac4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |   66 0f 62 d9          	punpckldq %xmm1,%xmm3
+    1ac8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |   66 0f 6a c1          	punpckhdq %xmm1,%xmm0
+    1acc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |   66 0f d4 c3          	paddq  %xmm3,%xmm0
+    1ad0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |   66 0f d4 d0          	paddq  %xmm0,%xmm2
+    1ad4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |   48 39 ca             	cmp    %rcx,%rdx
+    1ad7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  \-- 75 d7                	jne    1ab0 <bench_for_each(nel::Slice<int> const&)+0x4a0>
+    1ad9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |      66 0f 6f c2          	movdqa %xmm2,%xmm0
+    1add:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |      66 0f 73 d8 08       	psrldq $0x8,%xmm0
+    1ae2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |      66 0f d4 d0          	paddq  %xmm0,%xmm2
+    1ae6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |      66 48 0f 7e d2       	movq   %xmm2,%rdx
+    1aeb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |      4d 85 c9             	test   %r9,%r9
+    1aee:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  /-- 74 1e                	je     1b0e <bench_for_each(nel::Slice<int> const&)+0x4fe>
+    1af0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|--|-> 4c 63 17             	movslq (%rdi),%r10
+    1af3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   4c 01 d2             	add    %r10,%rdx
+    1af6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   49 39 c4             	cmp    %rax,%r12
+    1af9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  +-- 74 13                	je     1b0e <bench_for_each(nel::Slice<int> const&)+0x4fe>
+    1afb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   4c 63 57 04          	movslq 0x4(%rdi),%r10
+    1aff:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   4c 01 d2             	add    %r10,%rdx
+    1b02:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   49 39 c5             	cmp    %rax,%r13
+    1b05:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  +-- 74 07                	je     1b0e <bench_for_each(nel::Slice<int> const&)+0x4fe>
+    1b07:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   4c 63 57 08          	movslq 0x8(%rdi),%r10
+    1b0b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   4c 01 d2             	add    %r10,%rdx
+            r += f(s);
+    1b0e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \-> 48 01 d5             	add    %rdx,%rbp
+        for (nel::Index i = 0; i < reps; ++i) {
+    1b11:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \----> 48 83 c6 01          	add    $0x1,%rsi
+    1b15:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 39 de             	cmp    %rbx,%rsi
+    1b18:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \-------- 0f 82 72 ff ff ff    	jb     1a90 <bench_for_each(nel::Slice<int> const&)+0x480>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1b1e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-------> 48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    1b23:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         bf 01 00 00 00       	mov    $0x1,%edi
+    1b28:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 23 f5 ff ff       	call   1050 <clock_gettime@plt>
+    bench::report_per_item(name, t, reps * s.len());
+    1b2d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         49 0f af 5f 08       	imul   0x8(%r15),%rbx
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1b32:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8b 44 24 30       	mov    0x30(%rsp),%rax
+    sink = sink + r;
+    1b37:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8b 15 5a 95 00 00 	mov    0x955a(%rip),%rdx        # b098 <sink>
+    1b3e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8b 4c 24 38       	mov    0x38(%rsp),%rcx
+    1b43:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 01 ea             	add    %rbp,%rdx
+    1b46:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 15 4b 95 00 00 	mov    %rdx,0x954b(%rip)        # b098 <sink>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1b4d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 85 db             	test   %rbx,%rbx
+    1b50:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /----- 0f 84 0d 02 00 00    	je     1d63 <bench_for_each(nel::Slice<int> const&)+0x753>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1b56:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+    return now_ns() - b;
+    1b5d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 8b 74 24 28       	mov    0x28(%rsp),%rsi
+             << "ns/item\n";
+    1b62:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 8b 7c 24 18       	mov    0x18(%rsp),%rdi
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1b67:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 69 54 24 20 00 ca 	imul   $0x3b9aca00,0x20(%rsp),%rdx
+    1b6e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      9a 3b 
+    return now_ns() - b;
+    1b70:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 29 f0             	sub    %rsi,%rax
+             << "ns/item\n";
+    1b73:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 35 cd 34 00 00 	lea    0x34cd(%rip),%rsi        # 5047 <_IO_stdin_used+0x47>
+    return now_ns() - b;
+    1b7a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 01 c8             	add    %rcx,%rax
+    1b7d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 29 d0             	sub    %rdx,%rax
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1b80:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      31 d2                	xor    %edx,%edx
+    1b82:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    1b86:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    1b8a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 c1 e0 02          	shl    $0x2,%rax
+    1b8e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 f7 f3             	div    %rbx
+    long unsigned int const frac = cns % 100UL;
+    1b91:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 89 c3             	mov    %rax,%rbx
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1b94:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 89 c1             	mov    %rax,%rcx
+    long unsigned int const frac = cns % 100UL;
+    1b97:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    1b9e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      c2 f5 28 
+    1ba1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 c1 eb 02          	shr    $0x2,%rbx
+    1ba5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 f7 e3             	mul    %rbx
+    1ba8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 89 d3             	mov    %rdx,%rbx
+    1bab:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 c1 eb 02          	shr    $0x2,%rbx
+    1baf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 04 9b          	lea    (%rbx,%rbx,4),%rax
+    1bb3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 89 dd             	mov    %rbx,%rbp
+    1bb6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 89 cb             	mov    %rcx,%rbx
+    1bb9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    1bbd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 c1 e0 02          	shl    $0x2,%rax
+    1bc1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 29 c3             	sub    %rax,%rbx
+             << "ns/item\n";
+    1bc4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      e8 37 27 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    1bc9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1bce:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1bd1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      e8 2a 27 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    1bd6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 89 ee             	mov    %rbp,%rsi
+    1bd9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1bdc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      e8 df 27 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    1be1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      be 2e 00 00 00       	mov    $0x2e,%esi
+    1be6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1be9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      e8 f2 26 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    1bee:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 83 fb 0a          	cmp    $0xa,%rbx
+    1bf2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 35 0b 34 00 00 	lea    0x340b(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    1bf9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1bfc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 05 07 36 00 00 	lea    0x3607(%rip),%rax        # 520a <_IO_stdin_used+0x20a>
+    1c03:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 0f 43 f0          	cmovae %rax,%rsi
+    1c07:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-> e8 f4 26 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    1c0c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 89 de             	mov    %rbx,%rsi
+    1c0f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1c12:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   e8 a9 27 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+}
+    1c17:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 83 c4 48          	add    $0x48,%rsp
+    1c1b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   4c 89 f6             	mov    %r14,%rsi
+    1c1e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   5b                   	pop    %rbx
+    1c1f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1c22:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   5d                   	pop    %rbp
+    1c23:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   41 5c                	pop    %r12
+    1c25:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   41 5d                	pop    %r13
+    1c27:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   41 5e                	pop    %r14
+    1c29:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   41 5f                	pop    %r15
+    1c2b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   e9 d0 26 00 00       	jmp    4300 <nel::operator<<(nel::Log&, char const*)>
+        for (nel::Index i = 0; i < reps; ++i) {
+    1c30:	|  >--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-> 48 83 c7 01          	add    $0x1,%rdi
+    1c34:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   4c 39 e7             	cmp    %r12,%rdi
+    1c37:	|  \--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-- 72 f7                	jb     1c30 <bench_for_each(nel::Slice<int> const&)+0x620>
+    1c39:	\-----|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-> 45 31 ed             	xor    %r13d,%r13d
+    1c3c:	      |  |  |  \--|--|--|--|--|--|--|--|--|--|--|--|--|-- e9 fb fa ff ff       	jmp    173c <bench_for_each(nel::Slice<int> const&)+0x12c>
+        Acc acc = 0;
+    1c41:	      \--|--|-----|--|--|--|--|--|--|--|--|--|--|--|--|-> 31 d2                	xor    %edx,%edx
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    1c43:	         |  |     |  |  |  |  |  |  |  |  |  |  |  |  |   31 f6                	xor    %esi,%esi
+    1c45:	         \--|-----|--|--|--|--|--|--|--|--|--|--|--|--|-- e9 b1 fa ff ff       	jmp    16fb <bench_for_each(nel::Slice<int> const&)+0xeb>
+    1c4a:	            |     \--|--|--|--|--|--|--|--|--|--|--|--|-> 48 8d 05 4f 94 00 00 	lea    0x944f(%rip),%rax        # b0a0 <nel::log>
+    1c51:	            |        |  |  |  |  |  |  |  |  |  |  |  |   48 8d 35 ae 33 00 00 	lea    0x33ae(%rip),%rsi        # 5006 <_IO_stdin_used+0x6>
+    1c58:	            |        |  |  |  |  |  |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1c5b:	            |        |  |  |  |  |  |  |  |  |  |  |  |   48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    1c60:	            |        |  |  |  |  |  |  |  |  |  |  |  |   e8 9b 26 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    1c65:	            |        |  |  |  |  |  |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1c68:	            |        |  |  |  |  |  |  |  |  |  |  |  |   48 8d 05 a0 35 00 00 	lea    0x35a0(%rip),%rax        # 520f <_IO_stdin_used+0x20f>
+    1c6f:	            |        |  |  |  |  |  |  |  |  |  |  |  |   48 89 c6             	mov    %rax,%rsi
+    1c72:	            |        |  |  |  |  |  |  |  |  |  |  |  |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    1c77:	            |        |  |  |  |  |  |  |  |  |  |  |  |   e8 84 26 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    1c7c:	            |        |  |  |  |  |  |  |  |  |  |  |  |   31 f6                	xor    %esi,%esi
+    1c7e:	            |        |  |  |  |  |  |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1c81:	            |        |  |  |  |  |  |  |  |  |  |  |  |   e8 3a 27 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    1c86:	            |        |  |  |  |  |  |  |  |  |  |  |  |   be 2e 00 00 00       	mov    $0x2e,%esi
+    1c8b:	            |        |  |  |  |  |  |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1c8e:	            |        |  |  |  |  |  |  |  |  |  |  |  |   e8 4d 26 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    1c93:	            |        |  |  |  |  |  |  |  |  |  |  |  |   48 8d 35 6a 33 00 00 	lea    0x336a(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    1c9a:	            |        |  |  |  |  |  |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1c9d:	            |        |  \--|--|--|--|--|--|--|--|--|--|-- e9 92 fb ff ff       	jmp    1834 <bench_for_each(nel::Slice<int> const&)+0x224>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1ca2:	            |        |     |  |  |  |  \--|--|--|--|--|-> 48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+             << "ns/item\n";
+    1ca9:	            |        |     |  |  |  |     |  |  |  |  |   48 8b 7c 24 18       	mov    0x18(%rsp),%rdi
+    1cae:	            |        |     |  |  |  |     |  |  |  |  |   48 8d 35 76 33 00 00 	lea    0x3376(%rip),%rsi        # 502b <_IO_stdin_used+0x2b>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1cb5:	            |        |     |  |  |  |     |  |  |  |  |   48 69 54 24 20 00 ca 	imul   $0x3b9aca00,0x20(%rsp),%rdx
+    1cbc:	            |        |     |  |  |  |     |  |  |  |  |   9a 3b 
+    return now_ns() - b;
+    1cbe:	            |        |     |  |  |  |     |  |  |  |  |   4c 29 e8             	sub    %r13,%rax
+    1cc1:	            |        |     |  |  |  |     |  |  |  |  |   48 01 c8             	add    %rcx,%rax
+    1cc4:	            |        |     |  |  |  |     |  |  |  |  |   48 29 d0             	sub    %rdx,%rax
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1cc7:	            |        |     |  |  |  |     |  |  |  |  |   31 d2                	xor    %edx,%edx
+    1cc9:	            |        |     |  |  |  |     |  |  |  |  |   48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    1ccd:	            |        |     |  |  |  |     |  |  |  |  |   48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    1cd1:	            |        |     |  |  |  |     |  |  |  |  |   48 c1 e0 02          	shl    $0x2,%rax
+    1cd5:	            |        |     |  |  |  |     |  |  |  |  |   48 f7 f5             	div    %rbp
+    long unsigned int const frac = cns % 100UL;
+    1cd8:	            |        |     |  |  |  |     |  |  |  |  |   48 89 c5             	mov    %rax,%rbp
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1cdb:	            |        |     |  |  |  |     |  |  |  |  |   48 89 c1             	mov    %rax,%rcx
+    long unsigned int const frac = cns % 100UL;
+    1cde:	            |        |     |  |  |  |     |  |  |  |  |   48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    1ce5:	            |        |     |  |  |  |     |  |  |  |  |   c2 f5 28 
+    1ce8:	            |        |     |  |  |  |     |  |  |  |  |   48 c1 ed 02          	shr    $0x2,%rbp
+    1cec:	            |        |     |  |  |  |     |  |  |  |  |   48 f7 e5             	mul    %rbp
+    1cef:	            |        |     |  |  |  |     |  |  |  |  |   48 89 d5             	mov    %rdx,%rbp
+    1cf2:	            |        |     |  |  |  |     |  |  |  |  |   48 c1 ed 02          	shr    $0x2,%rbp
+    1cf6:	            |        |     |  |  |  |     |  |  |  |  |   48 8d 44 ad 00       	lea    0x0(%rbp,%rbp,4),%rax
+    1cfb:	            |        |     |  |  |  |     |  |  |  |  |   48 89 eb             	mov    %rbp,%rbx
+    1cfe:	            |        |     |  |  |  |     |  |  |  |  |   48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    1d02:	            |        |     |  |  |  |     |  |  |  |  |   48 c1 e0 02          	shl    $0x2,%rax
+    1d06:	            |        |     |  |  |  |     |  |  |  |  |   48 29 c1             	sub    %rax,%rcx
+    1d09:	            |        |     |  |  |  |     |  |  |  |  |   48 89 cd             	mov    %rcx,%rbp
+             << "ns/item\n";
+    1d0c:	            |        |     |  |  |  |     |  |  |  |  |   e8 ef 25 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    1d11:	            |        |     |  |  |  |     |  |  |  |  |   48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1d16:	            |        |     |  |  |  |     |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1d19:	            |        |     |  |  |  |     |  |  |  |  |   e8 e2 25 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    1d1e:	            |        |     |  |  |  |     |  |  |  |  |   48 89 de             	mov    %rbx,%rsi
+    1d21:	            |        |     |  |  |  |     |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1d24:	            |        |     |  |  |  |     |  |  |  |  |   e8 97 26 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    1d29:	            |        |     |  |  |  |     |  |  |  |  |   be 2e 00 00 00       	mov    $0x2e,%esi
+    1d2e:	            |        |     |  |  |  |     |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1d31:	            |        |     |  |  |  |     |  |  |  |  |   e8 aa 25 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    1d36:	            |        |     |  |  |  |     |  |  |  |  |   48 83 fd 0a          	cmp    $0xa,%rbp
+    1d3a:	            |        |     |  |  |  |     |  |  |  |  |   48 8d 35 c3 32 00 00 	lea    0x32c3(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    1d41:	            |        |     |  |  |  |     |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1d44:	            |        |     |  |  |  |     |  |  |  |  |   48 8d 05 bf 34 00 00 	lea    0x34bf(%rip),%rax        # 520a <_IO_stdin_used+0x20a>
+    1d4b:	            |        |     |  |  |  |     |  |  |  |  |   48 0f 43 f0          	cmovae %rax,%rsi
+    1d4f:	            |        |     |  |  |  \-----|--|--|--|--|-- e9 8c fc ff ff       	jmp    19e0 <bench_for_each(nel::Slice<int> const&)+0x3d0>
+        Acc acc = 0;
+    1d54:	            |        |     |  |  |        \--|--|--|--|-> 31 d2                	xor    %edx,%edx
+    1d56:	            |        |     |  |  |           \--|--|--|-- e9 95 fd ff ff       	jmp    1af0 <bench_for_each(nel::Slice<int> const&)+0x4e0>
+            : b_(arr)
+    1d5b:	            |        \-----|--|--|--------------|--|--|-> 48 89 fa             	mov    %rdi,%rdx
+    1d5e:	            |              |  \--|--------------|--|--|-- e9 d0 fb ff ff       	jmp    1933 <bench_for_each(nel::Slice<int> const&)+0x323>
+    1d63:	            |              |     |              |  \--|-> 48 8b 7c 24 18       	mov    0x18(%rsp),%rdi
+    1d68:	            |              |     |              |     |   48 8d 35 d8 32 00 00 	lea    0x32d8(%rip),%rsi        # 5047 <_IO_stdin_used+0x47>
+    1d6f:	            |              |     |              |     |   e8 8c 25 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    1d74:	            |              |     |              |     |   48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1d79:	            |              |     |              |     |   48 89 c7             	mov    %rax,%rdi
+    1d7c:	            |              |     |              |     |   e8 7f 25 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    1d81:	            |              |     |              |     |   31 f6                	xor    %esi,%esi
+    1d83:	            |              |     |              |     |   48 89 c7             	mov    %rax,%rdi
+    1d86:	            |              |     |              |     |   e8 35 26 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    1d8b:	            |              |     |              |     |   be 2e 00 00 00       	mov    $0x2e,%esi
+    1d90:	            |              |     |              |     |   48 89 c7             	mov    %rax,%rdi
+    1d93:	            |              |     |              |     |   e8 48 25 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    1d98:	            |              |     |              |     |   48 8d 35 65 32 00 00 	lea    0x3265(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    1d9f:	            |              |     |              |     |   48 89 c7             	mov    %rax,%rdi
+    1da2:	            |              |     |              |     \-- e9 60 fe ff ff       	jmp    1c07 <bench_for_each(nel::Slice<int> const&)+0x5f7>
+    Acc r = 0;
+    1da7:	            \--------------|-----|--------------|-------> 31 db                	xor    %ebx,%ebx
+    1da9:	                           \-----|--------------|-------- e9 bb fb ff ff       	jmp    1969 <bench_for_each(nel::Slice<int> const&)+0x359>
+    1dae:	                                 \--------------|-------> 31 ed                	xor    %ebp,%ebp
+    1db0:	                                                \-------- e9 69 fd ff ff       	jmp    1b1e <bench_for_each(nel::Slice<int> const&)+0x50e>
+    1db5:	                                                          66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1dbc:	                                                          00 00 00 00 
+
+0000000000001dc0 <bench_map_first_n_fold(nel::Slice<int> const&)>:
+{
+    1dc0:	                                              41 57                	push   %r15
+    nel::Count const reps = n_total / s.len();
+    1dc2:	                                              b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    1dc7:	                                              31 d2                	xor    %edx,%edx
+{
+    1dc9:	                                              41 56                	push   %r14
+    1dcb:	                                              41 55                	push   %r13
+    1dcd:	                                              41 54                	push   %r12
+    1dcf:	                                              55                   	push   %rbp
+    1dd0:	                                              53                   	push   %rbx
+    1dd1:	                                              48 89 fb             	mov    %rdi,%rbx
+    1dd4:	                                              48 83 ec 38          	sub    $0x38,%rsp
+            return len_;
+    1dd8:	                                              4c 8b 7f 08          	mov    0x8(%rdi),%r15
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1ddc:	                                              bf 01 00 00 00       	mov    $0x1,%edi
+    1de1:	                                              48 8d 6c 24 20       	lea    0x20(%rsp),%rbp
+    nel::Count const reps = n_total / s.len();
+    1de6:	                                              49 f7 f7             	div    %r15
+    1de9:	                                              48 89 ee             	mov    %rbp,%rsi
+    nel::Count const limit = s.len() - 1;
+    1dec:	                                              4d 8d 6f ff          	lea    -0x1(%r15),%r13
+    nel::Count const reps = n_total / s.len();
+    1df0:	                                              49 89 c6             	mov    %rax,%r14
+    1df3:	                                              e8 58 f2 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1df8:	                                              48 8b 44 24 20       	mov    0x20(%rsp),%rax
+    1dfd:	                                              4c 8b 64 24 28       	mov    0x28(%rsp),%r12
+    1e02:	                                              48 89 04 24          	mov    %rax,(%rsp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    1e06:	                                              49 81 ff 00 90 d0 03 	cmp    $0x3d09000,%r15
+    1e0d:	   /----------------------------------------- 0f 87 51 04 00 00    	ja     2264 <bench_map_first_n_fold(nel::Slice<int> const&)+0x4a4>
+    1e13:	   |                                          4c 8b 0b             	mov    (%rbx),%r9
+    1e16:	   |                                          31 c0                	xor    %eax,%eax
+        for (nel::Index i = 0; i < limit; ++i) {
+    1e18:	   |                                          4b 8d 7c b9 fc       	lea    -0x4(%r9,%r15,4),%rdi
+    1e1d:	   |                                          4d 85 ed             	test   %r13,%r13
+    1e20:	   |  /-------------------------------------- 0f 84 32 04 00 00    	je     2258 <bench_map_first_n_fold(nel::Slice<int> const&)+0x498>
+    1e26:	   |  |                                       45 31 ff             	xor    %r15d,%r15d
+    1e29:	   |  |                                       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1e30:	   |  |                                /----> 4c 89 ca             	mov    %r9,%rdx
+        Acc acc = 0;
+    1e33:	   |  |                                |      31 f6                	xor    %esi,%esi
+    1e35:	   |  |                                |      0f 1f 00             	nopl   (%rax)
+            acc += Acc(p[i]) * 3;
+    1e38:	   |  |                                |  /-> 48 63 0a             	movslq (%rdx),%rcx
+        for (nel::Index i = 0; i < limit; ++i) {
+    1e3b:	   |  |                                |  |   48 83 c2 04          	add    $0x4,%rdx
+            acc += Acc(p[i]) * 3;
+    1e3f:	   |  |                                |  |   48 8d 0c 49          	lea    (%rcx,%rcx,2),%rcx
+    1e43:	   |  |                                |  |   48 01 ce             	add    %rcx,%rsi
+        for (nel::Index i = 0; i < limit; ++i) {
+    1e46:	   |  |                                |  |   48 39 d7             	cmp    %rdx,%rdi
+    1e49:	   |  |                                |  \-- 75 ed                	jne    1e38 <bench_map_first_n_fold(nel::Slice<int> const&)+0x78>
+        for (nel::Index i = 0; i < reps; ++i) {
+    1e4b:	   |  |                                |      48 83 c0 01          	add    $0x1,%rax
+            r += f(s);
+    1e4f:	   |  |                                |      49 01 f7             	add    %rsi,%r15
+        for (nel::Index i = 0; i < reps; ++i) {
+    1e52:	   |  |                                |      4c 39 f0             	cmp    %r14,%rax
+    1e55:	   |  |                                \----- 72 d9                	jb     1e30 <bench_map_first_n_fold(nel::Slice<int> const&)+0x70>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1e57:	   |  |                          /----------> 48 89 ee             	mov    %rbp,%rsi
+    1e5a:	   |  |                          |            bf 01 00 00 00       	mov    $0x1,%edi
+    1e5f:	   |  |                          |            e8 ec f1 ff ff       	call   1050 <clock_gettime@plt>
+    bench::report_per_item(name, t, reps * s.len());
+    1e64:	   |  |                          |            4c 0f af 73 08       	imul   0x8(%rbx),%r14
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1e69:	   |  |                          |            48 8b 44 24 20       	mov    0x20(%rsp),%rax
+    sink = sink + r;
+    1e6e:	   |  |                          |            48 8b 15 23 92 00 00 	mov    0x9223(%rip),%rdx        # b098 <sink>
+    1e75:	   |  |                          |            48 8b 4c 24 28       	mov    0x28(%rsp),%rcx
+    1e7a:	   |  |                          |            4c 01 fa             	add    %r15,%rdx
+    1e7d:	   |  |                          |            48 89 15 14 92 00 00 	mov    %rdx,0x9214(%rip)        # b098 <sink>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1e84:	   |  |                          |            4d 85 f6             	test   %r14,%r14
+    1e87:	/--|--|--------------------------|----------- 0f 84 6b 04 00 00    	je     22f8 <bench_map_first_n_fold(nel::Slice<int> const&)+0x538>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1e8d:	|  |  |                          |            48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1e94:	|  |  |                          |            31 d2                	xor    %edx,%edx
+             << "ns/item\n";
+    1e96:	|  |  |                          |            48 8d 35 c6 31 00 00 	lea    0x31c6(%rip),%rsi        # 5063 <_IO_stdin_used+0x63>
+    return now_ns() - b;
+    1e9d:	|  |  |                          |            4c 29 e0             	sub    %r12,%rax
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1ea0:	|  |  |                          |            4c 69 24 24 00 ca 9a 	imul   $0x3b9aca00,(%rsp),%r12
+    1ea7:	|  |  |                          |            3b 
+    return now_ns() - b;
+    1ea8:	|  |  |                          |            48 01 c8             	add    %rcx,%rax
+    1eab:	|  |  |                          |            4c 29 e0             	sub    %r12,%rax
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1eae:	|  |  |                          |            48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    1eb2:	|  |  |                          |            48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    1eb6:	|  |  |                          |            48 c1 e0 02          	shl    $0x2,%rax
+    1eba:	|  |  |                          |            49 f7 f6             	div    %r14
+    long unsigned int const frac = cns % 100UL;
+    1ebd:	|  |  |                          |            49 89 c6             	mov    %rax,%r14
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1ec0:	|  |  |                          |            48 89 c1             	mov    %rax,%rcx
+    long unsigned int const frac = cns % 100UL;
+    1ec3:	|  |  |                          |            48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    1eca:	|  |  |                          |            c2 f5 28 
+    1ecd:	|  |  |                          |            49 c1 ee 02          	shr    $0x2,%r14
+    1ed1:	|  |  |                          |            49 f7 e6             	mul    %r14
+    1ed4:	|  |  |                          |            49 89 d6             	mov    %rdx,%r14
+    1ed7:	|  |  |                          |            49 c1 ee 02          	shr    $0x2,%r14
+    1edb:	|  |  |                          |            4b 8d 04 b6          	lea    (%r14,%r14,4),%rax
+    1edf:	|  |  |                          |            4d 89 f4             	mov    %r14,%r12
+    1ee2:	|  |  |                          |            48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    1ee6:	|  |  |                          |            48 c1 e0 02          	shl    $0x2,%rax
+    1eea:	|  |  |                          |            48 29 c1             	sub    %rax,%rcx
+             << "ns/item\n";
+    1eed:	|  |  |                          |            48 8d 05 ac 91 00 00 	lea    0x91ac(%rip),%rax        # b0a0 <nel::log>
+    1ef4:	|  |  |                          |            48 89 c7             	mov    %rax,%rdi
+    long unsigned int const frac = cns % 100UL;
+    1ef7:	|  |  |                          |            49 89 ce             	mov    %rcx,%r14
+             << "ns/item\n";
+    1efa:	|  |  |                          |            48 89 04 24          	mov    %rax,(%rsp)
+    1efe:	|  |  |                          |            e8 fd 23 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    1f03:	|  |  |                          |            48 89 c7             	mov    %rax,%rdi
+    1f06:	|  |  |                          |            48 8d 05 02 33 00 00 	lea    0x3302(%rip),%rax        # 520f <_IO_stdin_used+0x20f>
+    1f0d:	|  |  |                          |            48 89 c6             	mov    %rax,%rsi
+    1f10:	|  |  |                          |            48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1f15:	|  |  |                          |            e8 e6 23 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    1f1a:	|  |  |                          |            4c 89 e6             	mov    %r12,%rsi
+    1f1d:	|  |  |                          |            48 89 c7             	mov    %rax,%rdi
+    1f20:	|  |  |                          |            e8 9b 24 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    1f25:	|  |  |                          |            be 2e 00 00 00       	mov    $0x2e,%esi
+    1f2a:	|  |  |                          |            48 89 c7             	mov    %rax,%rdi
+    1f2d:	|  |  |                          |            e8 ae 23 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    1f32:	|  |  |                          |            49 83 fe 0a          	cmp    $0xa,%r14
+    1f36:	|  |  |                          |            48 8d 35 c7 30 00 00 	lea    0x30c7(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    1f3d:	|  |  |                          |            48 89 c7             	mov    %rax,%rdi
+    1f40:	|  |  |                          |            48 8d 05 c3 32 00 00 	lea    0x32c3(%rip),%rax        # 520a <_IO_stdin_used+0x20a>
+    1f47:	|  |  |                          |            48 0f 43 f0          	cmovae %rax,%rsi
+    1f4b:	|  |  |  /-----------------------|----------> e8 b0 23 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    1f50:	|  |  |  |                       |            4c 89 f6             	mov    %r14,%rsi
+    1f53:	|  |  |  |                       |            4c 8d 25 c8 30 00 00 	lea    0x30c8(%rip),%r12        # 5022 <_IO_stdin_used+0x22>
+    1f5a:	|  |  |  |                       |            48 89 c7             	mov    %rax,%rdi
+    1f5d:	|  |  |  |                       |            e8 5e 24 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    1f62:	|  |  |  |                       |            4c 89 e6             	mov    %r12,%rsi
+    1f65:	|  |  |  |                       |            48 89 c7             	mov    %rax,%rdi
+    1f68:	|  |  |  |                       |            e8 93 23 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    1f6d:	|  |  |  |                       |            4c 8b 7b 08          	mov    0x8(%rbx),%r15
+    nel::Count const reps = n_total / s.len();
+    1f71:	|  |  |  |                       |            b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    1f76:	|  |  |  |                       |            31 d2                	xor    %edx,%edx
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1f78:	|  |  |  |                       |            48 89 ee             	mov    %rbp,%rsi
+    1f7b:	|  |  |  |                       |            bf 01 00 00 00       	mov    $0x1,%edi
+    1f80:	|  |  |  |                       |            49 f7 f7             	div    %r15
+    1f83:	|  |  |  |                       |            49 89 c6             	mov    %rax,%r14
+    1f86:	|  |  |  |                       |            e8 c5 f0 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1f8b:	|  |  |  |                       |            48 8b 44 24 20       	mov    0x20(%rsp),%rax
+    1f90:	|  |  |  |                       |            48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    1f95:	|  |  |  |                       |            48 8b 44 24 28       	mov    0x28(%rsp),%rax
+    1f9a:	|  |  |  |                       |            48 89 44 24 18       	mov    %rax,0x18(%rsp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    1f9f:	|  |  |  |                       |            49 81 ff 00 90 d0 03 	cmp    $0x3d09000,%r15
+    1fa6:	|  |  |  |                       |     /----- 77 1c                	ja     1fc4 <bench_map_first_n_fold(nel::Slice<int> const&)+0x204>
+    1fa8:	|  |  |  |                       |     |      4c 8b 13             	mov    (%rbx),%r10
+    1fab:	|  |  |  |                       |     |      48 8b 43 08          	mov    0x8(%rbx),%rax
+    1faf:	|  |  |  |                       |     |      45 31 c9             	xor    %r9d,%r9d
+    public:
+        // Count inside inner's own loop, stopping it at the limit.
+        template<typename F>
+        void for_each(F &&fn)
+        {
+            if (current_ >= limit_) { return; }
+    1fb2:	|  |  |  |                       |     |      4d 85 ed             	test   %r13,%r13
+    1fb5:	|  |  |  |                       |  /--|----- 0f 85 b1 02 00 00    	jne    226c <bench_map_first_n_fold(nel::Slice<int> const&)+0x4ac>
+    1fbb:	|  |  |  |                       |  |  |  /-> 49 83 c1 01          	add    $0x1,%r9
+    1fbf:	|  |  |  |                       |  |  |  |   4d 39 f1             	cmp    %r14,%r9
+    1fc2:	|  |  |  |                       |  |  |  \-- 72 f7                	jb     1fbb <bench_map_first_n_fold(nel::Slice<int> const&)+0x1fb>
+            U acc = move(initial);
+    1fc4:	|  |  |  |                       |  |  \----> 45 31 ff             	xor    %r15d,%r15d
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1fc7:	|  |  |  |  /--------------------|--|-------> 48 89 ee             	mov    %rbp,%rsi
+    1fca:	|  |  |  |  |                    |  |         bf 01 00 00 00       	mov    $0x1,%edi
+    1fcf:	|  |  |  |  |                    |  |         e8 7c f0 ff ff       	call   1050 <clock_gettime@plt>
+    bench::report_per_item(name, t, reps * s.len());
+    1fd4:	|  |  |  |  |                    |  |         4c 0f af 73 08       	imul   0x8(%rbx),%r14
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1fd9:	|  |  |  |  |                    |  |         48 8b 44 24 20       	mov    0x20(%rsp),%rax
+    sink = sink + r;
+    1fde:	|  |  |  |  |                    |  |         48 8b 15 b3 90 00 00 	mov    0x90b3(%rip),%rdx        # b098 <sink>
+    1fe5:	|  |  |  |  |                    |  |         48 8b 4c 24 28       	mov    0x28(%rsp),%rcx
+    1fea:	|  |  |  |  |                    |  |         4c 01 fa             	add    %r15,%rdx
+    1fed:	|  |  |  |  |                    |  |         48 89 15 a4 90 00 00 	mov    %rdx,0x90a4(%rip)        # b098 <sink>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1ff4:	|  |  |  |  |                    |  |         4d 85 f6             	test   %r14,%r14
+    1ff7:	|  |  |  |  |  /-----------------|--|-------- 0f 84 b8 02 00 00    	je     22b5 <bench_map_first_n_fold(nel::Slice<int> const&)+0x4f5>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1ffd:	|  |  |  |  |  |                 |  |         48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+    return now_ns() - b;
+    2004:	|  |  |  |  |  |                 |  |         48 8b 7c 24 18       	mov    0x18(%rsp),%rdi
+             << "ns/item\n";
+    2009:	|  |  |  |  |  |                 |  |         48 8d 35 6f 30 00 00 	lea    0x306f(%rip),%rsi        # 507f <_IO_stdin_used+0x7f>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2010:	|  |  |  |  |  |                 |  |         48 69 54 24 10 00 ca 	imul   $0x3b9aca00,0x10(%rsp),%rdx
+    2017:	|  |  |  |  |  |                 |  |         9a 3b 
+    return now_ns() - b;
+    2019:	|  |  |  |  |  |                 |  |         48 29 f8             	sub    %rdi,%rax
+             << "ns/item\n";
+    201c:	|  |  |  |  |  |                 |  |         48 8b 3c 24          	mov    (%rsp),%rdi
+    return now_ns() - b;
+    2020:	|  |  |  |  |  |                 |  |         48 01 c8             	add    %rcx,%rax
+    2023:	|  |  |  |  |  |                 |  |         48 29 d0             	sub    %rdx,%rax
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    2026:	|  |  |  |  |  |                 |  |         31 d2                	xor    %edx,%edx
+    2028:	|  |  |  |  |  |                 |  |         48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    202c:	|  |  |  |  |  |                 |  |         48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    2030:	|  |  |  |  |  |                 |  |         48 c1 e0 02          	shl    $0x2,%rax
+    2034:	|  |  |  |  |  |                 |  |         49 f7 f6             	div    %r14
+    long unsigned int const frac = cns % 100UL;
+    2037:	|  |  |  |  |  |                 |  |         49 89 c6             	mov    %rax,%r14
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    203a:	|  |  |  |  |  |                 |  |         48 89 c1             	mov    %rax,%rcx
+    long unsigned int const frac = cns % 100UL;
+    203d:	|  |  |  |  |  |                 |  |         48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    2044:	|  |  |  |  |  |                 |  |         c2 f5 28 
+    2047:	|  |  |  |  |  |                 |  |         49 c1 ee 02          	shr    $0x2,%r14
+    204b:	|  |  |  |  |  |                 |  |         49 f7 e6             	mul    %r14
+    204e:	|  |  |  |  |  |                 |  |         49 89 d6             	mov    %rdx,%r14
+    2051:	|  |  |  |  |  |                 |  |         49 c1 ee 02          	shr    $0x2,%r14
+    2055:	|  |  |  |  |  |                 |  |         4b 8d 04 b6          	lea    (%r14,%r14,4),%rax
+    2059:	|  |  |  |  |  |                 |  |         4d 89 f7             	mov    %r14,%r15
+    205c:	|  |  |  |  |  |                 |  |         48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    2060:	|  |  |  |  |  |                 |  |         48 c1 e0 02          	shl    $0x2,%rax
+    2064:	|  |  |  |  |  |                 |  |         48 29 c1             	sub    %rax,%rcx
+    2067:	|  |  |  |  |  |                 |  |         49 89 ce             	mov    %rcx,%r14
+             << "ns/item\n";
+    206a:	|  |  |  |  |  |                 |  |         e8 91 22 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    206f:	|  |  |  |  |  |                 |  |         48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    2074:	|  |  |  |  |  |                 |  |         48 89 c7             	mov    %rax,%rdi
+    2077:	|  |  |  |  |  |                 |  |         e8 84 22 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    207c:	|  |  |  |  |  |                 |  |         4c 89 fe             	mov    %r15,%rsi
+    207f:	|  |  |  |  |  |                 |  |         48 89 c7             	mov    %rax,%rdi
+    2082:	|  |  |  |  |  |                 |  |         e8 39 23 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    2087:	|  |  |  |  |  |                 |  |         be 2e 00 00 00       	mov    $0x2e,%esi
+    208c:	|  |  |  |  |  |                 |  |         48 89 c7             	mov    %rax,%rdi
+    208f:	|  |  |  |  |  |                 |  |         e8 4c 22 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    2094:	|  |  |  |  |  |                 |  |         49 83 fe 0a          	cmp    $0xa,%r14
+    2098:	|  |  |  |  |  |                 |  |         48 8d 35 65 2f 00 00 	lea    0x2f65(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    209f:	|  |  |  |  |  |                 |  |         48 89 c7             	mov    %rax,%rdi
+    20a2:	|  |  |  |  |  |                 |  |         48 8d 05 61 31 00 00 	lea    0x3161(%rip),%rax        # 520a <_IO_stdin_used+0x20a>
+    20a9:	|  |  |  |  |  |                 |  |         48 0f 43 f0          	cmovae %rax,%rsi
+    20ad:	|  |  |  |  |  |        /--------|--|-------> e8 4e 22 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    20b2:	|  |  |  |  |  |        |        |  |         4c 89 f6             	mov    %r14,%rsi
+    20b5:	|  |  |  |  |  |        |        |  |         48 89 c7             	mov    %rax,%rdi
+    20b8:	|  |  |  |  |  |        |        |  |         e8 03 23 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    20bd:	|  |  |  |  |  |        |        |  |         4c 89 e6             	mov    %r12,%rsi
+    20c0:	|  |  |  |  |  |        |        |  |         48 89 c7             	mov    %rax,%rdi
+    20c3:	|  |  |  |  |  |        |        |  |         e8 38 22 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    20c8:	|  |  |  |  |  |        |        |  |         4c 8b 7b 08          	mov    0x8(%rbx),%r15
+    nel::Count const reps = n_total / s.len();
+    20cc:	|  |  |  |  |  |        |        |  |         b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    20d1:	|  |  |  |  |  |        |        |  |         31 d2                	xor    %edx,%edx
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    20d3:	|  |  |  |  |  |        |        |  |         48 89 ee             	mov    %rbp,%rsi
+    20d6:	|  |  |  |  |  |        |        |  |         bf 01 00 00 00       	mov    $0x1,%edi
+    20db:	|  |  |  |  |  |        |        |  |         49 f7 f7             	div    %r15
+    20de:	|  |  |  |  |  |        |        |  |         49 89 c6             	mov    %rax,%r14
+    20e1:	|  |  |  |  |  |        |        |  |         e8 6a ef ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    20e6:	|  |  |  |  |  |        |        |  |         48 8b 44 24 20       	mov    0x20(%rsp),%rax
+    20eb:	|  |  |  |  |  |        |        |  |         48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    20f0:	|  |  |  |  |  |        |        |  |         48 8b 44 24 28       	mov    0x28(%rsp),%rax
+    20f5:	|  |  |  |  |  |        |        |  |         48 89 44 24 18       	mov    %rax,0x18(%rsp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    20fa:	|  |  |  |  |  |        |        |  |         49 81 ff 00 90 d0 03 	cmp    $0x3d09000,%r15
+    2101:	|  |  |  |  |  |  /-----|--------|--|-------- 0f 87 8b 02 00 00    	ja     2392 <bench_map_first_n_fold(nel::Slice<int> const&)+0x5d2>
+            return content_;
+    2107:	|  |  |  |  |  |  |     |        |  |         48 8b 3b             	mov    (%rbx),%rdi
+    Acc r = 0;
+    210a:	|  |  |  |  |  |  |     |        |  |         45 31 ff             	xor    %r15d,%r15d
+            for (; !self().is_done(); self().inc()) {
+    210d:	|  |  |  |  |  |  |     |        |  |         4d 85 ed             	test   %r13,%r13
+    2110:	|  |  |  |  |  |  |  /--|--------|--|-------- 74 2e                	je     2140 <bench_map_first_n_fold(nel::Slice<int> const&)+0x380>
+        for (nel::Index i = 0; i < reps; ++i) {
+    2112:	|  |  |  |  |  |  |  |  |        |  |         45 31 db             	xor    %r11d,%r11d
+    2115:	|  |  |  |  |  |  |  |  |        |  |         0f 1f 00             	nopl   (%rax)
+            , current_(0)
+    2118:	|  |  |  |  |  |  |  |  |        |  |  /----> 31 c0                	xor    %eax,%eax
+            U acc = move(initial);
+    211a:	|  |  |  |  |  |  |  |  |        |  |  |      31 c9                	xor    %ecx,%ecx
+    211c:	|  |  |  |  |  |  |  |  |        |  |  |      0f 1f 40 00          	nopl   0x0(%rax)
+            .map<Acc>([](int const &e) -> Acc { return Acc(e) * 3; })
+    2120:	|  |  |  |  |  |  |  |  |        |  |  |  /-> 48 63 14 87          	movslq (%rdi,%rax,4),%rdx
+            ++current_;
+    2124:	|  |  |  |  |  |  |  |  |        |  |  |  |   48 83 c0 01          	add    $0x1,%rax
+    2128:	|  |  |  |  |  |  |  |  |        |  |  |  |   48 8d 14 52          	lea    (%rdx,%rdx,2),%rdx
+            .fold2(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    212c:	|  |  |  |  |  |  |  |  |        |  |  |  |   48 01 d1             	add    %rdx,%rcx
+            for (; !self().is_done(); self().inc()) {
+    212f:	|  |  |  |  |  |  |  |  |        |  |  |  |   49 39 c5             	cmp    %rax,%r13
+    2132:	|  |  |  |  |  |  |  |  |        |  |  |  \-- 75 ec                	jne    2120 <bench_map_first_n_fold(nel::Slice<int> const&)+0x360>
+        for (nel::Index i = 0; i < reps; ++i) {
+    2134:	|  |  |  |  |  |  |  |  |        |  |  |      49 83 c3 01          	add    $0x1,%r11
+            r += f(s);
+    2138:	|  |  |  |  |  |  |  |  |        |  |  |      49 01 cf             	add    %rcx,%r15
+        for (nel::Index i = 0; i < reps; ++i) {
+    213b:	|  |  |  |  |  |  |  |  |        |  |  |      4d 39 f3             	cmp    %r14,%r11
+    213e:	|  |  |  |  |  |  |  |  |        |  |  \----- 72 d8                	jb     2118 <bench_map_first_n_fold(nel::Slice<int> const&)+0x358>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    2140:	|  |  |  |  |  |  |  >--|--------|--|-------> 48 89 ee             	mov    %rbp,%rsi
+    2143:	|  |  |  |  |  |  |  |  |        |  |         bf 01 00 00 00       	mov    $0x1,%edi
+    2148:	|  |  |  |  |  |  |  |  |        |  |         e8 03 ef ff ff       	call   1050 <clock_gettime@plt>
+    bench::report_per_item(name, t, reps * s.len());
+    214d:	|  |  |  |  |  |  |  |  |        |  |         4c 0f af 73 08       	imul   0x8(%rbx),%r14
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2152:	|  |  |  |  |  |  |  |  |        |  |         48 8b 44 24 20       	mov    0x20(%rsp),%rax
+    sink = sink + r;
+    2157:	|  |  |  |  |  |  |  |  |        |  |         48 8b 15 3a 8f 00 00 	mov    0x8f3a(%rip),%rdx        # b098 <sink>
+    215e:	|  |  |  |  |  |  |  |  |        |  |         48 8b 4c 24 28       	mov    0x28(%rsp),%rcx
+    2163:	|  |  |  |  |  |  |  |  |        |  |         4c 01 fa             	add    %r15,%rdx
+    bench::report_per_item(name, t, reps * s.len());
+    2166:	|  |  |  |  |  |  |  |  |        |  |         4c 89 f3             	mov    %r14,%rbx
+    sink = sink + r;
+    2169:	|  |  |  |  |  |  |  |  |        |  |         48 89 15 28 8f 00 00 	mov    %rdx,0x8f28(%rip)        # b098 <sink>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    2170:	|  |  |  |  |  |  |  |  |        |  |         4d 85 f6             	test   %r14,%r14
+    2173:	|  |  |  |  |  |  |  |  |  /-----|--|-------- 0f 84 d6 01 00 00    	je     234f <bench_map_first_n_fold(nel::Slice<int> const&)+0x58f>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2179:	|  |  |  |  |  |  |  |  |  |     |  |         48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+    return now_ns() - b;
+    2180:	|  |  |  |  |  |  |  |  |  |     |  |         48 8b 7c 24 18       	mov    0x18(%rsp),%rdi
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    2185:	|  |  |  |  |  |  |  |  |  |     |  |         31 d2                	xor    %edx,%edx
+             << "ns/item\n";
+    2187:	|  |  |  |  |  |  |  |  |  |     |  |         48 8d 35 0d 2f 00 00 	lea    0x2f0d(%rip),%rsi        # 509b <_IO_stdin_used+0x9b>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    218e:	|  |  |  |  |  |  |  |  |  |     |  |         4c 69 74 24 10 00 ca 	imul   $0x3b9aca00,0x10(%rsp),%r14
+    2195:	|  |  |  |  |  |  |  |  |  |     |  |         9a 3b 
+    return now_ns() - b;
+    2197:	|  |  |  |  |  |  |  |  |  |     |  |         48 29 f8             	sub    %rdi,%rax
+             << "ns/item\n";
+    219a:	|  |  |  |  |  |  |  |  |  |     |  |         48 8b 3c 24          	mov    (%rsp),%rdi
+    return now_ns() - b;
+    219e:	|  |  |  |  |  |  |  |  |  |     |  |         48 01 c8             	add    %rcx,%rax
+    21a1:	|  |  |  |  |  |  |  |  |  |     |  |         4c 29 f0             	sub    %r14,%rax
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    21a4:	|  |  |  |  |  |  |  |  |  |     |  |         48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    21a8:	|  |  |  |  |  |  |  |  |  |     |  |         48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    21ac:	|  |  |  |  |  |  |  |  |  |     |  |         48 c1 e0 02          	shl    $0x2,%rax
+    21b0:	|  |  |  |  |  |  |  |  |  |     |  |         48 f7 f3             	div    %rbx
+    long unsigned int const frac = cns % 100UL;
+    21b3:	|  |  |  |  |  |  |  |  |  |     |  |         49 89 c1             	mov    %rax,%r9
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    21b6:	|  |  |  |  |  |  |  |  |  |     |  |         48 89 c1             	mov    %rax,%rcx
+    long unsigned int const frac = cns % 100UL;
+    21b9:	|  |  |  |  |  |  |  |  |  |     |  |         48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    21c0:	|  |  |  |  |  |  |  |  |  |     |  |         c2 f5 28 
+    21c3:	|  |  |  |  |  |  |  |  |  |     |  |         49 c1 e9 02          	shr    $0x2,%r9
+    21c7:	|  |  |  |  |  |  |  |  |  |     |  |         49 f7 e1             	mul    %r9
+    21ca:	|  |  |  |  |  |  |  |  |  |     |  |         48 89 d3             	mov    %rdx,%rbx
+    21cd:	|  |  |  |  |  |  |  |  |  |     |  |         48 c1 eb 02          	shr    $0x2,%rbx
+    21d1:	|  |  |  |  |  |  |  |  |  |     |  |         48 8d 04 9b          	lea    (%rbx,%rbx,4),%rax
+    21d5:	|  |  |  |  |  |  |  |  |  |     |  |         48 89 dd             	mov    %rbx,%rbp
+    21d8:	|  |  |  |  |  |  |  |  |  |     |  |         48 89 cb             	mov    %rcx,%rbx
+    21db:	|  |  |  |  |  |  |  |  |  |     |  |         48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    21df:	|  |  |  |  |  |  |  |  |  |     |  |         48 c1 e0 02          	shl    $0x2,%rax
+    21e3:	|  |  |  |  |  |  |  |  |  |     |  |         48 29 c3             	sub    %rax,%rbx
+             << "ns/item\n";
+    21e6:	|  |  |  |  |  |  |  |  |  |     |  |         e8 15 21 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    21eb:	|  |  |  |  |  |  |  |  |  |     |  |         48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    21f0:	|  |  |  |  |  |  |  |  |  |     |  |         48 89 c7             	mov    %rax,%rdi
+    21f3:	|  |  |  |  |  |  |  |  |  |     |  |         e8 08 21 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    21f8:	|  |  |  |  |  |  |  |  |  |     |  |         48 89 ee             	mov    %rbp,%rsi
+    21fb:	|  |  |  |  |  |  |  |  |  |     |  |         48 89 c7             	mov    %rax,%rdi
+    21fe:	|  |  |  |  |  |  |  |  |  |     |  |         e8 bd 21 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    2203:	|  |  |  |  |  |  |  |  |  |     |  |         be 2e 00 00 00       	mov    $0x2e,%esi
+    2208:	|  |  |  |  |  |  |  |  |  |     |  |         48 89 c7             	mov    %rax,%rdi
+    220b:	|  |  |  |  |  |  |  |  |  |     |  |         e8 d0 20 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    2210:	|  |  |  |  |  |  |  |  |  |     |  |         48 83 fb 0a          	cmp    $0xa,%rbx
+    2214:	|  |  |  |  |  |  |  |  |  |     |  |         48 8d 35 e9 2d 00 00 	lea    0x2de9(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    221b:	|  |  |  |  |  |  |  |  |  |     |  |         48 89 c7             	mov    %rax,%rdi
+    221e:	|  |  |  |  |  |  |  |  |  |     |  |         48 8d 05 e5 2f 00 00 	lea    0x2fe5(%rip),%rax        # 520a <_IO_stdin_used+0x20a>
+    2225:	|  |  |  |  |  |  |  |  |  |     |  |         48 0f 43 f0          	cmovae %rax,%rsi
+    2229:	|  |  |  |  |  |  |  |  |  |  /--|--|-------> e8 d2 20 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    222e:	|  |  |  |  |  |  |  |  |  |  |  |  |         48 89 de             	mov    %rbx,%rsi
+    2231:	|  |  |  |  |  |  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    2234:	|  |  |  |  |  |  |  |  |  |  |  |  |         e8 87 21 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+}
+    2239:	|  |  |  |  |  |  |  |  |  |  |  |  |         48 83 c4 38          	add    $0x38,%rsp
+    223d:	|  |  |  |  |  |  |  |  |  |  |  |  |         4c 89 e6             	mov    %r12,%rsi
+    2240:	|  |  |  |  |  |  |  |  |  |  |  |  |         5b                   	pop    %rbx
+    2241:	|  |  |  |  |  |  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    2244:	|  |  |  |  |  |  |  |  |  |  |  |  |         5d                   	pop    %rbp
+    2245:	|  |  |  |  |  |  |  |  |  |  |  |  |         41 5c                	pop    %r12
+    2247:	|  |  |  |  |  |  |  |  |  |  |  |  |         41 5d                	pop    %r13
+    2249:	|  |  |  |  |  |  |  |  |  |  |  |  |         41 5e                	pop    %r14
+    224b:	|  |  |  |  |  |  |  |  |  |  |  |  |         41 5f                	pop    %r15
+    224d:	|  |  |  |  |  |  |  |  |  |  |  |  |         e9 ae 20 00 00       	jmp    4300 <nel::operator<<(nel::Log&, char const*)>
+    2252:	|  |  |  |  |  |  |  |  |  |  |  |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2258:	|  |  >--|--|--|--|--|--|--|--|--|--|-------> 48 83 c0 01          	add    $0x1,%rax
+    225c:	|  |  |  |  |  |  |  |  |  |  |  |  |         48 3d 00 90 d0 03    	cmp    $0x3d09000,%rax
+    2262:	|  |  \--|--|--|--|--|--|--|--|--|--|-------- 75 f4                	jne    2258 <bench_map_first_n_fold(nel::Slice<int> const&)+0x498>
+    2264:	|  \-----|--|--|--|--|--|--|--|--|--|-------> 45 31 ff             	xor    %r15d,%r15d
+    2267:	|        |  |  |  |  |  |  |  |  \--|-------- e9 eb fb ff ff       	jmp    1e57 <bench_map_first_n_fold(nel::Slice<int> const&)+0x97>
+            , e_(arr + len)
+    226c:	|        |  |  |  |  |  |  |  |     \-------> 49 8d 04 82          	lea    (%r10,%rax,4),%rax
+    2270:	|        |  |  |  |  |  |  |  |               45 31 ff             	xor    %r15d,%r15d
+    2273:	|        |  |  |  |  |  |  |  |               0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    2278:	|        |  |  |  |  |  |  |  |  /----------> 4c 89 d2             	mov    %r10,%rdx
+    227b:	|        |  |  |  |  |  |  |  |  |            31 c9                	xor    %ecx,%ecx
+            U acc = move(initial);
+    227d:	|        |  |  |  |  |  |  |  |  |            31 ff                	xor    %edi,%edi
+    227f:	|        |  |  |  |  |  |  |  |  |  /-------- eb 1e                	jmp    229f <bench_map_first_n_fold(nel::Slice<int> const&)+0x4df>
+    2281:	|        |  |  |  |  |  |  |  |  |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            .map<Acc>([](int const &e) -> Acc { return Acc(e) * 3; })
+    2288:	|        |  |  |  |  |  |  |  |  |  |  /----> 48 63 32             	movslq (%rdx),%rsi
+                if (!fn(acc, forward<OutT>(e))) { return false; }
+    228b:	|        |  |  |  |  |  |  |  |  |  |  |      48 83 c1 01          	add    $0x1,%rcx
+    228f:	|        |  |  |  |  |  |  |  |  |  |  |      48 83 c2 04          	add    $0x4,%rdx
+    2293:	|        |  |  |  |  |  |  |  |  |  |  |      48 8d 34 76          	lea    (%rsi,%rsi,2),%rsi
+            .fold(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    2297:	|        |  |  |  |  |  |  |  |  |  |  |      48 01 f7             	add    %rsi,%rdi
+    229a:	|        |  |  |  |  |  |  |  |  |  |  |      49 39 cd             	cmp    %rcx,%r13
+    229d:	|        |  |  |  |  |  |  |  |  |  |  |  /-- 74 05                	je     22a4 <bench_map_first_n_fold(nel::Slice<int> const&)+0x4e4>
+            while (!self().is_done()) {
+    229f:	|        |  |  |  |  |  |  |  |  |  \--|--|-> 48 39 d0             	cmp    %rdx,%rax
+    22a2:	|        |  |  |  |  |  |  |  |  |     \--|-- 75 e4                	jne    2288 <bench_map_first_n_fold(nel::Slice<int> const&)+0x4c8>
+        for (nel::Index i = 0; i < reps; ++i) {
+    22a4:	|        |  |  |  |  |  |  |  |  |        \-> 49 83 c1 01          	add    $0x1,%r9
+            r += f(s);
+    22a8:	|        |  |  |  |  |  |  |  |  |            49 01 ff             	add    %rdi,%r15
+        for (nel::Index i = 0; i < reps; ++i) {
+    22ab:	|        |  |  |  |  |  |  |  |  |            4d 39 f1             	cmp    %r14,%r9
+    22ae:	|        |  |  |  |  |  |  |  |  \----------- 72 c8                	jb     2278 <bench_map_first_n_fold(nel::Slice<int> const&)+0x4b8>
+    22b0:	|        |  \--|--|--|--|--|--|-------------- e9 12 fd ff ff       	jmp    1fc7 <bench_map_first_n_fold(nel::Slice<int> const&)+0x207>
+    22b5:	|        |     \--|--|--|--|--|-------------> 48 8b 3c 24          	mov    (%rsp),%rdi
+    22b9:	|        |        |  |  |  |  |               48 8d 35 bf 2d 00 00 	lea    0x2dbf(%rip),%rsi        # 507f <_IO_stdin_used+0x7f>
+    22c0:	|        |        |  |  |  |  |               e8 3b 20 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    22c5:	|        |        |  |  |  |  |               48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    22ca:	|        |        |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    22cd:	|        |        |  |  |  |  |               e8 2e 20 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    22d2:	|        |        |  |  |  |  |               31 f6                	xor    %esi,%esi
+    22d4:	|        |        |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    22d7:	|        |        |  |  |  |  |               e8 e4 20 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    22dc:	|        |        |  |  |  |  |               be 2e 00 00 00       	mov    $0x2e,%esi
+    22e1:	|        |        |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    22e4:	|        |        |  |  |  |  |               e8 f7 1f 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    22e9:	|        |        |  |  |  |  |               48 8d 35 14 2d 00 00 	lea    0x2d14(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    22f0:	|        |        |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    22f3:	|        |        |  |  \--|--|-------------- e9 b5 fd ff ff       	jmp    20ad <bench_map_first_n_fold(nel::Slice<int> const&)+0x2ed>
+    22f8:	\--------|--------|--|-----|--|-------------> 48 8d 05 a1 8d 00 00 	lea    0x8da1(%rip),%rax        # b0a0 <nel::log>
+    22ff:	         |        |  |     |  |               48 8d 35 5d 2d 00 00 	lea    0x2d5d(%rip),%rsi        # 5063 <_IO_stdin_used+0x63>
+    2306:	         |        |  |     |  |               48 89 c7             	mov    %rax,%rdi
+    2309:	         |        |  |     |  |               48 89 04 24          	mov    %rax,(%rsp)
+    230d:	         |        |  |     |  |               e8 ee 1f 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    2312:	         |        |  |     |  |               48 89 c7             	mov    %rax,%rdi
+    2315:	         |        |  |     |  |               48 8d 05 f3 2e 00 00 	lea    0x2ef3(%rip),%rax        # 520f <_IO_stdin_used+0x20f>
+    231c:	         |        |  |     |  |               48 89 c6             	mov    %rax,%rsi
+    231f:	         |        |  |     |  |               48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    2324:	         |        |  |     |  |               e8 d7 1f 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    2329:	         |        |  |     |  |               31 f6                	xor    %esi,%esi
+    232b:	         |        |  |     |  |               48 89 c7             	mov    %rax,%rdi
+    232e:	         |        |  |     |  |               e8 8d 20 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    2333:	         |        |  |     |  |               be 2e 00 00 00       	mov    $0x2e,%esi
+    2338:	         |        |  |     |  |               48 89 c7             	mov    %rax,%rdi
+    233b:	         |        |  |     |  |               e8 a0 1f 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    2340:	         |        |  |     |  |               48 8d 35 bd 2c 00 00 	lea    0x2cbd(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    2347:	         |        |  |     |  |               48 89 c7             	mov    %rax,%rdi
+    234a:	         \--------|--|-----|--|-------------- e9 fc fb ff ff       	jmp    1f4b <bench_map_first_n_fold(nel::Slice<int> const&)+0x18b>
+    234f:	                  |  |     \--|-------------> 48 8b 3c 24          	mov    (%rsp),%rdi
+    2353:	                  |  |        |               48 8d 35 41 2d 00 00 	lea    0x2d41(%rip),%rsi        # 509b <_IO_stdin_used+0x9b>
+    235a:	                  |  |        |               e8 a1 1f 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    235f:	                  |  |        |               48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    2364:	                  |  |        |               48 89 c7             	mov    %rax,%rdi
+    2367:	                  |  |        |               e8 94 1f 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    236c:	                  |  |        |               31 f6                	xor    %esi,%esi
+    236e:	                  |  |        |               48 89 c7             	mov    %rax,%rdi
+    2371:	                  |  |        |               e8 4a 20 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    2376:	                  |  |        |               be 2e 00 00 00       	mov    $0x2e,%esi
+    237b:	                  |  |        |               48 89 c7             	mov    %rax,%rdi
+    237e:	                  |  |        |               e8 5d 1f 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    2383:	                  |  |        |               48 8d 35 7a 2c 00 00 	lea    0x2c7a(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    238a:	                  |  |        |               48 89 c7             	mov    %rax,%rdi
+    238d:	                  |  |        \-------------- e9 97 fe ff ff       	jmp    2229 <bench_map_first_n_fold(nel::Slice<int> const&)+0x469>
+    2392:	                  \--|----------------------> 45 31 ff             	xor    %r15d,%r15d
+    2395:	                     \----------------------- e9 a6 fd ff ff       	jmp    2140 <bench_map_first_n_fold(nel::Slice<int> const&)+0x380>
+    239a:	                                              66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000000023a0 <bench_chain(nel::Slice<int> const&)>:
+{
+    23a0:	                                                                                                                                        41 57                	push   %r15
+    nel::Count const reps = n_total / s.len();
+    23a2:	                                                                                                                                        b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    23a7:	                                                                                                                                        31 d2                	xor    %edx,%edx
+{
+    23a9:	                                                                                                                                        41 56                	push   %r14
+    23ab:	                                                                                                                                        49 89 fe             	mov    %rdi,%r14
+    23ae:	                                                                                                                                        41 55                	push   %r13
+    23b0:	                                                                                                                                        41 54                	push   %r12
+    23b2:	                                                                                                                                        55                   	push   %rbp
+    23b3:	                                                                                                                                        53                   	push   %rbx
+    23b4:	                                                                                                                                        48 83 ec 78          	sub    $0x78,%rsp
+            return len_;
+    23b8:	                                                                                                                                        4c 8b 67 08          	mov    0x8(%rdi),%r12
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    23bc:	                                                                                                                                        bf 01 00 00 00       	mov    $0x1,%edi
+    23c1:	                                                                                                                                        48 8d 74 24 60       	lea    0x60(%rsp),%rsi
+    nel::Count const reps = n_total / s.len();
+    23c6:	                                                                                                                                        49 f7 f4             	div    %r12
+    23c9:	                                                                                                                                        48 89 74 24 18       	mov    %rsi,0x18(%rsp)
+    nel::Length const h = s.len() / 2;
+    23ce:	                                                                                                                                        4c 89 e3             	mov    %r12,%rbx
+    23d1:	                                                                                                                                        48 d1 eb             	shr    %rbx
+    nel::Count const reps = n_total / s.len();
+    23d4:	                                                                                                                                        48 89 c5             	mov    %rax,%rbp
+    23d7:	                                                                                                                                        e8 74 ec ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    23dc:	                                                                                                                                        48 8b 44 24 60       	mov    0x60(%rsp),%rax
+    23e1:	                                                                                                                                        48 89 44 24 50       	mov    %rax,0x50(%rsp)
+    23e6:	                                                                                                                                        48 8b 44 24 68       	mov    0x68(%rsp),%rax
+    23eb:	                                                                                                                                        48 89 44 24 58       	mov    %rax,0x58(%rsp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    23f0:	                                                                                                                                        49 81 fc 00 90 d0 03 	cmp    $0x3d09000,%r12
+    23f7:	/-------------------------------------------------------------------------------------------------------------------------------------- 0f 87 14 11 00 00    	ja     3511 <bench_chain(nel::Slice<int> const&)+0x1171>
+    23fd:	|                                                                                                                                       4d 8b 5e 08          	mov    0x8(%r14),%r11
+            return content_;
+    2401:	|                                                                                                                                       4d 8b 06             	mov    (%r14),%r8
+    2404:	|                                                                                                                                       48 8d 43 ff          	lea    -0x1(%rbx),%rax
+    2408:	|                                                                                                                                       49 c1 ec 03          	shr    $0x3,%r12
+    240c:	|                                                                                                                                       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    2411:	|                                                                                                                                       4c 89 e6             	mov    %r12,%rsi
+            acc += Acc(p[i]);
+    2414:	|                                                                                                                                       66 0f ef db          	pxor   %xmm3,%xmm3
+    2418:	|                                                                                                                                       4e 8d 14 a5 00 00 00 	lea    0x0(,%r12,4),%r10
+    241f:	|                                                                                                                                       00 
+    2420:	|                                                                                                                                       4d 89 dd             	mov    %r11,%r13
+    2423:	|                                                                                                                                       49 8d 04 98          	lea    (%r8,%rbx,4),%rax
+    2427:	|                                                                                                                                       48 c1 e6 04          	shl    $0x4,%rsi
+    242b:	|                                                                                                                                       4c 89 74 24 48       	mov    %r14,0x48(%rsp)
+    2430:	|                                                                                                                                       49 29 dd             	sub    %rbx,%r13
+    2433:	|                                                                                                                                       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    2438:	|                                                                                                                                       4c 01 c6             	add    %r8,%rsi
+    243b:	|                                                                                                                                       4c 89 e9             	mov    %r13,%rcx
+    243e:	|                                                                                                                                       4d 8d 7d ff          	lea    -0x1(%r13),%r15
+    2442:	|                                                                                                                                       48 c1 e9 02          	shr    $0x2,%rcx
+    2446:	|                                                                                                                                       48 c1 e1 04          	shl    $0x4,%rcx
+    244a:	|                                                                                                                                       48 01 c1             	add    %rax,%rcx
+    244d:	|                                                                                                                                       4c 89 e8             	mov    %r13,%rax
+    2450:	|                                                                                                                                       48 83 e0 fc          	and    $0xfffffffffffffffc,%rax
+    2454:	|                                                                                                                                       48 01 d8             	add    %rbx,%rax
+    2457:	|                                                                                                                                       49 83 ff 02          	cmp    $0x2,%r15
+    245b:	|                                                                                                                                       48 0f 46 c3          	cmovbe %rbx,%rax
+    Acc r = 0;
+    245f:	|                                                                                                                                       45 31 e4             	xor    %r12d,%r12d
+        for (nel::Index i = 0; i < reps; ++i) {
+    2462:	|                                                                                                                                       45 31 c9             	xor    %r9d,%r9d
+    2465:	|                                                                                                                                       41 83 e5 03          	and    $0x3,%r13d
+            acc += Acc(p[i]);
+    2469:	|                                                                                                                                       48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2470:	|                                                                                                                                       00 
+    2471:	|                                                                                                                                       49 8d 3c 10          	lea    (%r8,%rdx,1),%rdi
+    2475:	|                                                                                                                                       48 89 7c 24 20       	mov    %rdi,0x20(%rsp)
+        for (nel::Index i = h; i < s.len(); ++i) {
+    247a:	|                                                                                                                                       48 8d 78 01          	lea    0x1(%rax),%rdi
+    247e:	|                                                                                                                                       48 83 c0 02          	add    $0x2,%rax
+    2482:	|                                                                                                                                       48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+            acc += Acc(p[i]);
+    2487:	|                                                                                                                                       49 8d 7c 10 04       	lea    0x4(%r8,%rdx,1),%rdi
+        for (nel::Index i = h; i < s.len(); ++i) {
+    248c:	|                                                                                                                                       48 89 44 24 38       	mov    %rax,0x38(%rsp)
+            acc += Acc(p[i]);
+    2491:	|                                                                                                                                       49 8d 44 10 08       	lea    0x8(%r8,%rdx,1),%rax
+    2496:	|                                                                                                                                       48 89 7c 24 30       	mov    %rdi,0x30(%rsp)
+    249b:	|                                                                                                                                       48 89 44 24 40       	mov    %rax,0x40(%rsp)
+        for (nel::Index i = 0; i < h; ++i) {
+    24a0:	|                                                                                                                          /----------> 48 85 db             	test   %rbx,%rbx
+    24a3:	|     /--------------------------------------------------------------------------------------------------------------------|----------- 0f 84 07 0e 00 00    	je     32b0 <bench_chain(nel::Slice<int> const&)+0xf10>
+    24a9:	|     |                                                                                                                    |            48 83 7c 24 08 02    	cmpq   $0x2,0x8(%rsp)
+    24af:	|     |  /-----------------------------------------------------------------------------------------------------------------|----------- 0f 86 02 0e 00 00    	jbe    32b7 <bench_chain(nel::Slice<int> const&)+0xf17>
+    24b5:	|     |  |                                                                                                                 |            4c 89 c0             	mov    %r8,%rax
+    24b8:	|     |  |                                                                                                                 |            66 0f ef d2          	pxor   %xmm2,%xmm2
+    24bc:	|     |  |                                                                                                                 |            0f 1f 40 00          	nopl   0x0(%rax)
+            acc += Acc(p[i]);
+    24c0:	|     |  |                                                                                                                 |        /-> f3 0f 6f 00          	movdqu (%rax),%xmm0
+    24c4:	|     |  |                                                                                                                 |        |   66 0f 6f cb          	movdqa %xmm3,%xmm1
+    24c8:	|     |  |                                                                                                                 |        |   48 83 c0 10          	add    $0x10,%rax
+    24cc:	|     |  |                                                                                                                 |        |   66 0f 66 c8          	pcmpgtd %xmm0,%xmm1
+    24d0:	|     |  |                                                                                                                 |        |   66 0f 6f e0          	movdqa %xmm0,%xmm4
+    24d4:	|     |  |                                                                                                                 |        |   66 0f 62 e1          	punpckldq %xmm1,%xmm4
+    24d8:	|     |  |                                                                                                                 |        |   66 0f 6a c1          	punpckhdq %xmm1,%xmm0
+    24dc:	|     |  |                                                                                                                 |        |   66 0f d4 c4          	paddq  %xmm4,%xmm0
+    24e0:	|     |  |                                                                                                                 |        |   66 0f d4 d0          	paddq  %xmm0,%xmm2
+        for (nel::Index i = 0; i < h; ++i) {
+    24e4:	|     |  |                                                                                                                 |        |   48 39 c6             	cmp    %rax,%rsi
+    24e7:	|     |  |                                                                                                                 |        \-- 75 d7                	jne    24c0 <bench_chain(nel::Slice<int> const&)+0x120>
+    24e9:	|     |  |                                                                                                                 |            66 0f 6f c2          	movdqa %xmm2,%xmm0
+    24ed:	|     |  |                                                                                                                 |            4c 89 d2             	mov    %r10,%rdx
+    24f0:	|     |  |                                                                                                                 |            66 0f 73 d8 08       	psrldq $0x8,%xmm0
+    24f5:	|     |  |                                                                                                                 |            66 0f d4 d0          	paddq  %xmm0,%xmm2
+    24f9:	|     |  |                                                                                                                 |            66 48 0f 7e d0       	movq   %xmm2,%rax
+    24fe:	|     |  |                                                                                                                 |            4c 39 d3             	cmp    %r10,%rbx
+    2501:	|     |  |        /--------------------------------------------------------------------------------------------------------|----------- 74 31                	je     2534 <bench_chain(nel::Slice<int> const&)+0x194>
+            acc += Acc(p[i]);
+    2503:	|     |  |     /--|--------------------------------------------------------------------------------------------------------|----------> 4d 63 34 90          	movslq (%r8,%rdx,4),%r14
+    2507:	|     |  |     |  |                                                                                                        |            48 8d 3c 95 00 00 00 	lea    0x0(,%rdx,4),%rdi
+    250e:	|     |  |     |  |                                                                                                        |            00 
+    250f:	|     |  |     |  |                                                                                                        |            4c 01 f0             	add    %r14,%rax
+        for (nel::Index i = 0; i < h; ++i) {
+    2512:	|     |  |     |  |                                                                                                        |            4c 8d 72 01          	lea    0x1(%rdx),%r14
+    2516:	|     |  |     |  |                                                                                                        |            49 39 de             	cmp    %rbx,%r14
+    2519:	|     |  |     |  +--------------------------------------------------------------------------------------------------------|----------- 73 19                	jae    2534 <bench_chain(nel::Slice<int> const&)+0x194>
+            acc += Acc(p[i]);
+    251b:	|     |  |     |  |                                                                                                        |            4d 63 74 38 04       	movslq 0x4(%r8,%rdi,1),%r14
+        for (nel::Index i = 0; i < h; ++i) {
+    2520:	|     |  |     |  |                                                                                                        |            48 83 c2 02          	add    $0x2,%rdx
+            acc += Acc(p[i]);
+    2524:	|     |  |     |  |                                                                                                        |            4c 01 f0             	add    %r14,%rax
+        for (nel::Index i = 0; i < h; ++i) {
+    2527:	|     |  |     |  |                                                                                                        |            48 39 da             	cmp    %rbx,%rdx
+    252a:	|     |  |     |  +--------------------------------------------------------------------------------------------------------|----------- 73 08                	jae    2534 <bench_chain(nel::Slice<int> const&)+0x194>
+            acc += Acc(p[i]);
+    252c:	|     |  |     |  |                                                                                                        |            49 63 54 38 08       	movslq 0x8(%r8,%rdi,1),%rdx
+    2531:	|     |  |     |  |                                                                                                        |            48 01 d0             	add    %rdx,%rax
+        for (nel::Index i = h; i < s.len(); ++i) {
+    2534:	|     |  |     |  >--------------------------------------------------------------------------------------------------------|----------> 4c 39 db             	cmp    %r11,%rbx
+    2537:	|     |  |     |  |                                                                                                        |  /-------- 0f 83 85 00 00 00    	jae    25c2 <bench_chain(nel::Slice<int> const&)+0x222>
+    253d:	|     |  |     |  |                                                                                                        |  |         49 83 ff 02          	cmp    $0x2,%r15
+    2541:	|     |  |     |  |                                                                                                        |  |  /----- 76 50                	jbe    2593 <bench_chain(nel::Slice<int> const&)+0x1f3>
+    2543:	|     |  |     |  |                                                                                                        |  |  |      48 8b 54 24 10       	mov    0x10(%rsp),%rdx
+    2548:	|     |  |     |  |                                                                                                        |  |  |      66 0f ef d2          	pxor   %xmm2,%xmm2
+    254c:	|     |  |     |  |                                                                                                        |  |  |      0f 1f 40 00          	nopl   0x0(%rax)
+            acc += Acc(p[i]);
+    2550:	|     |  |     |  |                                                                                                        |  |  |  /-> f3 0f 6f 02          	movdqu (%rdx),%xmm0
+    2554:	|     |  |     |  |                                                                                                        |  |  |  |   66 0f 6f cb          	movdqa %xmm3,%xmm1
+    2558:	|     |  |     |  |                                                                                                        |  |  |  |   48 83 c2 10          	add    $0x10,%rdx
+    255c:	|     |  |     |  |                                                                                                        |  |  |  |   66 0f 66 c8          	pcmpgtd %xmm0,%xmm1
+    2560:	|     |  |     |  |                                                                                                        |  |  |  |   66 0f 6f e0          	movdqa %xmm0,%xmm4
+    2564:	|     |  |     |  |                                                                                                        |  |  |  |   66 0f 62 e1          	punpckldq %xmm1,%xmm4
+    2568:	|     |  |     |  |                                                                                                        |  |  |  |   66 0f 6a c1          	punpckhdq %xmm1,%xmm0
+    256c:	|     |  |     |  |                                                                                                        |  |  |  |   66 0f d4 c4          	paddq  %xmm4,%xmm0
+    2570:	|     |  |     |  |                                                                                                        |  |  |  |   66 0f d4 d0          	paddq  %xmm0,%xmm2
+        constexpr Length len(void) const
+    2574:	|     |  |     |  |                                                                                                        |  |  |  |   48 39 ca             	cmp    %rcx,%rdx
+    2577:	|     |  |     |  |                                                                                                        |  |  |  \-- 75 d7                	jne    2550 <bench_chain(nel::Slice<int> const&)+0x1b0>
+    2579:	|     |  |     |  |                                                                                                        |  |  |      66 0f 6f c2          	movdqa %xmm2,%xmm0
+    257d:	|     |  |     |  |                                                                                                        |  |  |      66 0f 73 d8 08       	psrldq $0x8,%xmm0
+    2582:	|     |  |     |  |                                                                                                        |  |  |      66 0f d4 d0          	paddq  %xmm0,%xmm2
+    2586:	|     |  |     |  |                                                                                                        |  |  |      66 48 0f 7e d2       	movq   %xmm2,%rdx
+    258b:	|     |  |     |  |                                                                                                        |  |  |      48 01 d0             	add    %rdx,%rax
+    258e:	|     |  |     |  |                                                                                                        |  |  |      4d 85 ed             	test   %r13,%r13
+    2591:	|     |  |     |  |                                                                                                        |  +--|----- 74 2f                	je     25c2 <bench_chain(nel::Slice<int> const&)+0x222>
+    2593:	|     |  |     |  |                                                                                                        |  |  \----> 48 8b 7c 24 20       	mov    0x20(%rsp),%rdi
+    2598:	|     |  |     |  |                                                                                                        |  |         48 63 17             	movslq (%rdi),%rdx
+    259b:	|     |  |     |  |                                                                                                        |  |         48 01 d0             	add    %rdx,%rax
+        for (nel::Index i = h; i < s.len(); ++i) {
+    259e:	|     |  |     |  |                                                                                                        |  |         4c 39 5c 24 28       	cmp    %r11,0x28(%rsp)
+    25a3:	|     |  |     |  |                                                                                                        |  +-------- 73 1d                	jae    25c2 <bench_chain(nel::Slice<int> const&)+0x222>
+            acc += Acc(p[i]);
+    25a5:	|     |  |     |  |                                                                                                        |  |         48 8b 7c 24 30       	mov    0x30(%rsp),%rdi
+    25aa:	|     |  |     |  |                                                                                                        |  |         48 63 17             	movslq (%rdi),%rdx
+    25ad:	|     |  |     |  |                                                                                                        |  |         48 01 d0             	add    %rdx,%rax
+        for (nel::Index i = h; i < s.len(); ++i) {
+    25b0:	|     |  |     |  |                                                                                                        |  |         4c 39 5c 24 38       	cmp    %r11,0x38(%rsp)
+    25b5:	|     |  |     |  |                                                                                                        |  +-------- 73 0b                	jae    25c2 <bench_chain(nel::Slice<int> const&)+0x222>
+            acc += Acc(p[i]);
+    25b7:	|     |  |     |  |                                                                                                        |  |         48 8b 7c 24 40       	mov    0x40(%rsp),%rdi
+    25bc:	|     |  |     |  |                                                                                                        |  |         48 63 17             	movslq (%rdi),%rdx
+    25bf:	|     |  |     |  |                                                                                                        |  |         48 01 d0             	add    %rdx,%rax
+        for (nel::Index i = 0; i < reps; ++i) {
+    25c2:	|     |  |     |  |                                                                                                        |  \-------> 49 83 c1 01          	add    $0x1,%r9
+            r += f(s);
+    25c6:	|     |  |     |  |                                                                                                        |            49 01 c4             	add    %rax,%r12
+        for (nel::Index i = 0; i < reps; ++i) {
+    25c9:	|     |  |     |  |                                                                                                        |            49 39 e9             	cmp    %rbp,%r9
+    25cc:	|     |  |     |  |                                                                                                        \----------- 0f 82 ce fe ff ff    	jb     24a0 <bench_chain(nel::Slice<int> const&)+0x100>
+    25d2:	|     |  |     |  |                                                                                                                     4c 8b 74 24 48       	mov    0x48(%rsp),%r14
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    25d7:	|  /--|--|-----|--|-------------------------------------------------------------------------------------------------------------------> 48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    25dc:	|  |  |  |     |  |                                                                                                                     bf 01 00 00 00       	mov    $0x1,%edi
+    25e1:	|  |  |  |     |  |                                                                                                                     e8 6a ea ff ff       	call   1050 <clock_gettime@plt>
+    bench::report_per_item(name, t, reps * s.len());
+    25e6:	|  |  |  |     |  |                                                                                                                     49 0f af 6e 08       	imul   0x8(%r14),%rbp
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    25eb:	|  |  |  |     |  |                                                                                                                     48 8b 44 24 60       	mov    0x60(%rsp),%rax
+    sink = sink + r;
+    25f0:	|  |  |  |     |  |                                                                                                                     48 8b 15 a1 8a 00 00 	mov    0x8aa1(%rip),%rdx        # b098 <sink>
+    25f7:	|  |  |  |     |  |                                                                                                                     48 8b 4c 24 68       	mov    0x68(%rsp),%rcx
+    25fc:	|  |  |  |     |  |                                                                                                                     4c 01 e2             	add    %r12,%rdx
+    25ff:	|  |  |  |     |  |                                                                                                                     48 89 15 92 8a 00 00 	mov    %rdx,0x8a92(%rip)        # b098 <sink>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    2606:	|  |  |  |     |  |                                                                                                                     48 85 ed             	test   %rbp,%rbp
+    2609:	|  |  |  |     |  |  /----------------------------------------------------------------------------------------------------------------- 0f 84 b1 0c 00 00    	je     32c0 <bench_chain(nel::Slice<int> const&)+0xf20>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    260f:	|  |  |  |     |  |  |                                                                                                                  48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+    return now_ns() - b;
+    2616:	|  |  |  |     |  |  |                                                                                                                  48 8b 74 24 58       	mov    0x58(%rsp),%rsi
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    261b:	|  |  |  |     |  |  |                                                                                                                  48 69 54 24 50 00 ca 	imul   $0x3b9aca00,0x50(%rsp),%rdx
+    2622:	|  |  |  |     |  |  |                                                                                                                  9a 3b 
+    return now_ns() - b;
+    2624:	|  |  |  |     |  |  |                                                                                                                  48 29 f0             	sub    %rsi,%rax
+             << "ns/item\n";
+    2627:	|  |  |  |     |  |  |                                                                                                                  48 8d 35 89 2a 00 00 	lea    0x2a89(%rip),%rsi        # 50b7 <_IO_stdin_used+0xb7>
+    return now_ns() - b;
+    262e:	|  |  |  |     |  |  |                                                                                                                  48 01 c8             	add    %rcx,%rax
+    2631:	|  |  |  |     |  |  |                                                                                                                  48 29 d0             	sub    %rdx,%rax
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    2634:	|  |  |  |     |  |  |                                                                                                                  31 d2                	xor    %edx,%edx
+    2636:	|  |  |  |     |  |  |                                                                                                                  48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    263a:	|  |  |  |     |  |  |                                                                                                                  48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    263e:	|  |  |  |     |  |  |                                                                                                                  48 c1 e0 02          	shl    $0x2,%rax
+    2642:	|  |  |  |     |  |  |                                                                                                                  48 f7 f5             	div    %rbp
+    long unsigned int const frac = cns % 100UL;
+    2645:	|  |  |  |     |  |  |                                                                                                                  48 89 c5             	mov    %rax,%rbp
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    2648:	|  |  |  |     |  |  |                                                                                                                  48 89 c1             	mov    %rax,%rcx
+    long unsigned int const frac = cns % 100UL;
+    264b:	|  |  |  |     |  |  |                                                                                                                  48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    2652:	|  |  |  |     |  |  |                                                                                                                  c2 f5 28 
+    2655:	|  |  |  |     |  |  |                                                                                                                  48 c1 ed 02          	shr    $0x2,%rbp
+    2659:	|  |  |  |     |  |  |                                                                                                                  48 f7 e5             	mul    %rbp
+    265c:	|  |  |  |     |  |  |                                                                                                                  48 89 d5             	mov    %rdx,%rbp
+    265f:	|  |  |  |     |  |  |                                                                                                                  48 c1 ed 02          	shr    $0x2,%rbp
+    2663:	|  |  |  |     |  |  |                                                                                                                  48 8d 44 ad 00       	lea    0x0(%rbp,%rbp,4),%rax
+    2668:	|  |  |  |     |  |  |                                                                                                                  49 89 ec             	mov    %rbp,%r12
+    266b:	|  |  |  |     |  |  |                                                                                                                  48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    266f:	|  |  |  |     |  |  |                                                                                                                  48 c1 e0 02          	shl    $0x2,%rax
+    2673:	|  |  |  |     |  |  |                                                                                                                  48 29 c1             	sub    %rax,%rcx
+             << "ns/item\n";
+    2676:	|  |  |  |     |  |  |                                                                                                                  48 8d 05 23 8a 00 00 	lea    0x8a23(%rip),%rax        # b0a0 <nel::log>
+    267d:	|  |  |  |     |  |  |                                                                                                                  48 89 c7             	mov    %rax,%rdi
+    long unsigned int const frac = cns % 100UL;
+    2680:	|  |  |  |     |  |  |                                                                                                                  48 89 cd             	mov    %rcx,%rbp
+             << "ns/item\n";
+    2683:	|  |  |  |     |  |  |                                                                                                                  48 89 44 24 40       	mov    %rax,0x40(%rsp)
+    2688:	|  |  |  |     |  |  |                                                                                                                  e8 73 1c 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    268d:	|  |  |  |     |  |  |                                                                                                                  48 89 c7             	mov    %rax,%rdi
+    2690:	|  |  |  |     |  |  |                                                                                                                  48 8d 05 78 2b 00 00 	lea    0x2b78(%rip),%rax        # 520f <_IO_stdin_used+0x20f>
+    2697:	|  |  |  |     |  |  |                                                                                                                  48 89 c6             	mov    %rax,%rsi
+    269a:	|  |  |  |     |  |  |                                                                                                                  48 89 44 24 38       	mov    %rax,0x38(%rsp)
+    269f:	|  |  |  |     |  |  |                                                                                                                  e8 5c 1c 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    26a4:	|  |  |  |     |  |  |                                                                                                                  4c 89 e6             	mov    %r12,%rsi
+    26a7:	|  |  |  |     |  |  |                                                                                                                  48 89 c7             	mov    %rax,%rdi
+    26aa:	|  |  |  |     |  |  |                                                                                                                  e8 11 1d 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    26af:	|  |  |  |     |  |  |                                                                                                                  be 2e 00 00 00       	mov    $0x2e,%esi
+    26b4:	|  |  |  |     |  |  |                                                                                                                  48 89 c7             	mov    %rax,%rdi
+    26b7:	|  |  |  |     |  |  |                                                                                                                  e8 24 1c 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    26bc:	|  |  |  |     |  |  |                                                                                                                  48 83 fd 0a          	cmp    $0xa,%rbp
+    26c0:	|  |  |  |     |  |  |                                                                                                                  48 8d 35 3d 29 00 00 	lea    0x293d(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    26c7:	|  |  |  |     |  |  |                                                                                                                  48 89 c7             	mov    %rax,%rdi
+    26ca:	|  |  |  |     |  |  |                                                                                                                  48 8d 05 39 2b 00 00 	lea    0x2b39(%rip),%rax        # 520a <_IO_stdin_used+0x20a>
+    26d1:	|  |  |  |     |  |  |                                                                                                                  48 0f 43 f0          	cmovae %rax,%rsi
+    26d5:	|  |  |  |     |  |  |     /----------------------------------------------------------------------------------------------------------> e8 26 1c 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    26da:	|  |  |  |     |  |  |     |                                                                                                            48 89 ee             	mov    %rbp,%rsi
+    26dd:	|  |  |  |     |  |  |     |                                                                                                            48 89 c7             	mov    %rax,%rdi
+    26e0:	|  |  |  |     |  |  |     |                                                                                                            e8 db 1c 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    26e5:	|  |  |  |     |  |  |     |                                                                                                            48 8d 35 36 29 00 00 	lea    0x2936(%rip),%rsi        # 5022 <_IO_stdin_used+0x22>
+    26ec:	|  |  |  |     |  |  |     |                                                                                                            48 89 c7             	mov    %rax,%rdi
+    26ef:	|  |  |  |     |  |  |     |                                                                                                            e8 0c 1c 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+            return len_;
+    26f4:	|  |  |  |     |  |  |     |                                                                                                            49 8b 6e 08          	mov    0x8(%r14),%rbp
+    nel::Count const reps = n_total / s.len();
+    26f8:	|  |  |  |     |  |  |     |                                                                                                            b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    26fd:	|  |  |  |     |  |  |     |                                                                                                            31 d2                	xor    %edx,%edx
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    26ff:	|  |  |  |     |  |  |     |                                                                                                            48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    2704:	|  |  |  |     |  |  |     |                                                                                                            bf 01 00 00 00       	mov    $0x1,%edi
+    2709:	|  |  |  |     |  |  |     |                                                                                                            48 f7 f5             	div    %rbp
+    270c:	|  |  |  |     |  |  |     |                                                                                                            49 89 c4             	mov    %rax,%r12
+    270f:	|  |  |  |     |  |  |     |                                                                                                            e8 3c e9 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2714:	|  |  |  |     |  |  |     |                                                                                                            48 8b 44 24 60       	mov    0x60(%rsp),%rax
+    2719:	|  |  |  |     |  |  |     |                                                                                                            48 89 44 24 48       	mov    %rax,0x48(%rsp)
+    271e:	|  |  |  |     |  |  |     |                                                                                                            48 8b 44 24 68       	mov    0x68(%rsp),%rax
+    2723:	|  |  |  |     |  |  |     |                                                                                                            48 89 44 24 50       	mov    %rax,0x50(%rsp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2728:	|  |  |  |     |  |  |     |                                                                                                            48 81 fd 00 90 d0 03 	cmp    $0x3d09000,%rbp
+    272f:	|  |  |  |  /--|--|--|-----|----------------------------------------------------------------------------------------------------------- 0f 87 e4 0d 00 00    	ja     3519 <bench_chain(nel::Slice<int> const&)+0x1179>
+    2735:	|  |  |  |  |  |  |  |     |                                                                                                            31 c9                	xor    %ecx,%ecx
+    2737:	|  |  |  |  |  |  |  |     |                                                                                                            49 8b 16             	mov    (%r14),%rdx
+    273a:	|  |  |  |  |  |  |  |     |                                                                                                            4d 8b 6e 08          	mov    0x8(%r14),%r13
+    273e:	|  |  |  |  |  |  |  |     |                                                                                                            48 85 db             	test   %rbx,%rbx
+    2741:	|  |  |  |  |  |  |  |     |                                                                                                            49 89 cb             	mov    %rcx,%r11
+    2744:	|  |  |  |  |  |  |  |     |                                                                                                            4c 0f 45 da          	cmovne %rdx,%r11
+            , e_(arr + len)
+    2748:	|  |  |  |  |  |  |  |     |                                                                                                            4c 89 e8             	mov    %r13,%rax
+    274b:	|  |  |  |  |  |  |  |     |                                                                                                            4c 39 eb             	cmp    %r13,%rbx
+    274e:	|  |  |  |  |  |  |  |     |                                                                                                            48 0f 46 c3          	cmovbe %rbx,%rax
+    2752:	|  |  |  |  |  |  |  |     |                                                                                                            48 85 db             	test   %rbx,%rbx
+    2755:	|  |  |  |  |  |  |  |     |                                                                                                            48 0f 44 c1          	cmove  %rcx,%rax
+            return Slice(&content_[b], e - b);
+    2759:	|  |  |  |  |  |  |  |     |                                                                                                            48 8d 0c 9a          	lea    (%rdx,%rbx,4),%rcx
+    275d:	|  |  |  |  |  |  |  |     |                                                                                                            4c 89 ea             	mov    %r13,%rdx
+    Acc r = 0;
+    2760:	|  |  |  |  |  |  |  |     |                                                                                                            31 ed                	xor    %ebp,%ebp
+    2762:	|  |  |  |  |  |  |  |     |                                                                                                            48 29 da             	sub    %rbx,%rdx
+    2765:	|  |  |  |  |  |  |  |     |                                                                                                            48 89 4c 24 28       	mov    %rcx,0x28(%rsp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    276a:	|  |  |  |  |  |  |  |     |                                                                                                            45 31 c9             	xor    %r9d,%r9d
+    276d:	|  |  |  |  |  |  |  |     |                                                                                                            4d 8d 3c 83          	lea    (%r11,%rax,4),%r15
+    2771:	|  |  |  |  |  |  |  |     |                                                                                                            48 8d 04 85 fc ff ff 	lea    -0x4(,%rax,4),%rax
+    2778:	|  |  |  |  |  |  |  |     |                                                                                                            ff 
+            , e_(arr + len)
+    2779:	|  |  |  |  |  |  |  |     |                                                                                                            48 8d 0c 91          	lea    (%rcx,%rdx,4),%rcx
+    277d:	|  |  |  |  |  |  |  |     |                                                                                                            48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    2782:	|  |  |  |  |  |  |  |     |                                                                                                            48 c1 e8 02          	shr    $0x2,%rax
+    2786:	|  |  |  |  |  |  |  |     |                                                                                                            48 89 4c 24 30       	mov    %rcx,0x30(%rsp)
+    278b:	|  |  |  |  |  |  |  |     |                                                                                                            48 8d 48 01          	lea    0x1(%rax),%rcx
+    278f:	|  |  |  |  |  |  |  |     |                                                                                                            48 89 c8             	mov    %rcx,%rax
+    2792:	|  |  |  |  |  |  |  |     |                                                                                                            48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+    2797:	|  |  |  |  |  |  |  |     |                                                                                                            48 83 e1 fc          	and    $0xfffffffffffffffc,%rcx
+    279b:	|  |  |  |  |  |  |  |     |                                                                                                            49 8d 0c 8b          	lea    (%r11,%rcx,4),%rcx
+    279f:	|  |  |  |  |  |  |  |     |                                                                                                            48 c1 e8 02          	shr    $0x2,%rax
+    27a3:	|  |  |  |  |  |  |  |     |                                                                                                            48 89 4c 24 20       	mov    %rcx,0x20(%rsp)
+    27a8:	|  |  |  |  |  |  |  |     |                                                                                                            48 c1 e0 04          	shl    $0x4,%rax
+    27ac:	|  |  |  |  |  |  |  |     |                                                                                                            4c 01 d8             	add    %r11,%rax
+    27af:	|  |  |  |  |  |  |  |     |                                                                                                            90                   	nop
+            if (b >= e) { return Slice::empty(); }
+    27b0:	|  |  |  |  |  |  |  |     |                                                                                                  /-------> 48 85 db             	test   %rbx,%rbx
+    27b3:	|  |  |  |  |  |  |  |     |                                                                                                  |     /-- 74 09                	je     27be <bench_chain(nel::Slice<int> const&)+0x41e>
+            if (b >= len_) { return Slice::empty(); }
+    27b5:	|  |  |  |  |  |  |  |     |                                                                                                  |     |   4d 85 ed             	test   %r13,%r13
+    27b8:	|  |  |  |  |  |  |  |     |                 /--------------------------------------------------------------------------------|-----|-- 0f 84 e2 0a 00 00    	je     32a0 <bench_chain(nel::Slice<int> const&)+0xf00>
+            if (b >= e) { return Slice::empty(); }
+    27be:	|  |  |  |  |  |  |  |     |                 |                                                                                |     \-> 4c 39 eb             	cmp    %r13,%rbx
+    27c1:	|  |  |  |  |  |  |  |     |                 |     /--------------------------------------------------------------------------|-------- 0f 83 c1 0a 00 00    	jae    3288 <bench_chain(nel::Slice<int> const&)+0xee8>
+            : content_(p)
+    27c7:	|  |  |  |  |  |  |  |     |                 |     |                                                                          |         48 8b 4c 24 28       	mov    0x28(%rsp),%rcx
+            if (b_ == e_) { return None; }
+    27cc:	|  |  |  |  |  |  |  |     |                 |     |                                                                          |         4c 8b 54 24 30       	mov    0x30(%rsp),%r10
+    27d1:	|  |  |  |  |  |  |  |     |                 |     |                                                                          |         4d 39 fb             	cmp    %r15,%r11
+    27d4:	|  |  |  |  |  |  |  |  /--|-----------------|-----|--------------------------------------------------------------------------|-------- 0f 84 90 0c 00 00    	je     346a <bench_chain(nel::Slice<int> const&)+0x10ca>
+    27da:	|  |  |  |  |  |  |  |  |  |                 |     |     /--------------------------------------------------------------------|-------> 48 83 7c 24 08 08    	cmpq   $0x8,0x8(%rsp)
+    27e0:	|  |  |  |  |  |  |  |  |  |                 |     |     |                                                                    |         4c 89 da             	mov    %r11,%rdx
+    27e3:	|  |  |  |  |  |  |  |  |  |  /--------------|-----|-----|--------------------------------------------------------------------|-------- 0f 86 33 0c 00 00    	jbe    341c <bench_chain(nel::Slice<int> const&)+0x107c>
+    27e9:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |         66 0f ef d2          	pxor   %xmm2,%xmm2
+            acc += Acc(e);
+    27ed:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |         66 0f ef e4          	pxor   %xmm4,%xmm4
+    27f1:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    27f8:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |     /-> f3 0f 6f 02          	movdqu (%rdx),%xmm0
+    27fc:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |     |   66 0f 6f cc          	movdqa %xmm4,%xmm1
+    2800:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |     |   48 83 c2 10          	add    $0x10,%rdx
+    2804:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |     |   66 0f 66 c8          	pcmpgtd %xmm0,%xmm1
+    2808:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |     |   66 0f 6f d8          	movdqa %xmm0,%xmm3
+    280c:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |     |   66 0f 62 d9          	punpckldq %xmm1,%xmm3
+    2810:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |     |   66 0f 6a c1          	punpckhdq %xmm1,%xmm0
+    2814:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |     |   66 0f d4 c3          	paddq  %xmm3,%xmm0
+    2818:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |     |   66 0f d4 d0          	paddq  %xmm0,%xmm2
+        Optional<OutT> next(void)
+    281c:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |     |   48 39 d0             	cmp    %rdx,%rax
+    281f:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |     \-- 75 d7                	jne    27f8 <bench_chain(nel::Slice<int> const&)+0x458>
+    2821:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |         66 0f 6f c2          	movdqa %xmm2,%xmm0
+    2825:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |         48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+    282a:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |         66 0f 73 d8 08       	psrldq $0x8,%xmm0
+    282f:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |         66 0f d4 d0          	paddq  %xmm0,%xmm2
+    2833:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |         66 48 0f 7e d6       	movq   %xmm2,%rsi
+    2838:	|  |  |  |  |  |  |  |  |  |  |              |     |     |                                                                    |         f6 44 24 10 03       	testb  $0x3,0x10(%rsp)
+    283d:	|  |  |  |  |  |  |  |  |  |  |  /-----------|-----|-----|--------------------------------------------------------------------|-------- 74 26                	je     2865 <bench_chain(nel::Slice<int> const&)+0x4c5>
+    283f:	|  |  |  |  |  |  |  |  |  |  |  |     /-----|-----|-----|--------------------------------------------------------------------|-------> 48 63 3a             	movslq (%rdx),%rdi
+    2842:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |                                                                    |         48 01 fe             	add    %rdi,%rsi
+            return Some(*b_++);
+    2845:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |                                                                    |         48 8d 7a 04          	lea    0x4(%rdx),%rdi
+            if (b_ == e_) { return None; }
+    2849:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |                                                                    |         49 39 ff             	cmp    %rdi,%r15
+    284c:	|  |  |  |  |  |  |  |  |  |  |  +-----|-----|-----|-----|--------------------------------------------------------------------|-------- 74 17                	je     2865 <bench_chain(nel::Slice<int> const&)+0x4c5>
+    284e:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |                                                                    |         48 63 7a 04          	movslq 0x4(%rdx),%rdi
+    2852:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |                                                                    |         48 01 fe             	add    %rdi,%rsi
+            return Some(*b_++);
+    2855:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |                                                                    |         48 8d 7a 08          	lea    0x8(%rdx),%rdi
+            if (b_ == e_) { return None; }
+    2859:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |                                                                    |         49 39 ff             	cmp    %rdi,%r15
+    285c:	|  |  |  |  |  |  |  |  |  |  |  +-----|-----|-----|-----|--------------------------------------------------------------------|-------- 74 07                	je     2865 <bench_chain(nel::Slice<int> const&)+0x4c5>
+    285e:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |                                                                    |         48 63 52 08          	movslq 0x8(%rdx),%rdx
+    2862:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |                                                                    |         48 01 d6             	add    %rdx,%rsi
+    2865:	|  |  |  |  |  |  |  |  |  |  |  >-----|-----|-----|-----|--------------------------------------------------------------------|-------> 4c 39 d1             	cmp    %r10,%rcx
+    2868:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     /--------------------------------------------------------------|-------- 0f 84 a6 00 00 00    	je     2914 <bench_chain(nel::Slice<int> const&)+0x574>
+    286e:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |         49 8d 7a fc          	lea    -0x4(%r10),%rdi
+    2872:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |         48 89 ca             	mov    %rcx,%rdx
+    2875:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |         48 29 cf             	sub    %rcx,%rdi
+    2878:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |         49 89 f8             	mov    %rdi,%r8
+    287b:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |         49 c1 e8 02          	shr    $0x2,%r8
+    287f:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |         49 83 c0 01          	add    $0x1,%r8
+    2883:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |         48 83 ff 08          	cmp    $0x8,%rdi
+    2887:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  /----- 76 65                	jbe    28ee <bench_chain(nel::Slice<int> const&)+0x54e>
+    2889:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |      4c 89 c7             	mov    %r8,%rdi
+    288c:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |      66 0f ef c9          	pxor   %xmm1,%xmm1
+    2890:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |      66 0f ef e4          	pxor   %xmm4,%xmm4
+    2894:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |      48 c1 ef 02          	shr    $0x2,%rdi
+    2898:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |      48 c1 e7 04          	shl    $0x4,%rdi
+    289c:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |      48 01 cf             	add    %rcx,%rdi
+    289f:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |  /-> f3 0f 6f 02          	movdqu (%rdx),%xmm0
+    28a3:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |  |   66 0f 6f d4          	movdqa %xmm4,%xmm2
+    28a7:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |  |   48 83 c2 10          	add    $0x10,%rdx
+    28ab:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |  |   66 0f 66 d0          	pcmpgtd %xmm0,%xmm2
+    28af:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |  |   66 0f 6f d8          	movdqa %xmm0,%xmm3
+    28b3:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |  |   66 0f 62 da          	punpckldq %xmm2,%xmm3
+    28b7:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |  |   66 0f 6a c2          	punpckhdq %xmm2,%xmm0
+    28bb:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |  |   66 0f d4 c3          	paddq  %xmm3,%xmm0
+    28bf:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |  |   66 0f d4 c8          	paddq  %xmm0,%xmm1
+        Optional<OutT> next(void)
+    28c3:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |  |   48 39 d7             	cmp    %rdx,%rdi
+    28c6:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |  \-- 75 d7                	jne    289f <bench_chain(nel::Slice<int> const&)+0x4ff>
+    28c8:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |      66 0f 6f c1          	movdqa %xmm1,%xmm0
+    28cc:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |      66 0f 73 d8 08       	psrldq $0x8,%xmm0
+    28d1:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |      66 0f d4 c8          	paddq  %xmm0,%xmm1
+    28d5:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |      66 48 0f 7e ca       	movq   %xmm1,%rdx
+    28da:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |      48 01 d6             	add    %rdx,%rsi
+    28dd:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |      4c 89 c2             	mov    %r8,%rdx
+    28e0:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |      48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+    28e4:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |      41 83 e0 03          	and    $0x3,%r8d
+    28e8:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  |      48 8d 0c 91          	lea    (%rcx,%rdx,4),%rcx
+    28ec:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     +--------------------------------------------------------------|--|----- 74 26                	je     2914 <bench_chain(nel::Slice<int> const&)+0x574>
+    28ee:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |  \----> 48 63 11             	movslq (%rcx),%rdx
+    28f1:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |         48 01 d6             	add    %rdx,%rsi
+            return Some(*b_++);
+    28f4:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |         48 8d 51 04          	lea    0x4(%rcx),%rdx
+            if (b_ == e_) { return None; }
+    28f8:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |         49 39 d2             	cmp    %rdx,%r10
+    28fb:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     +--------------------------------------------------------------|-------- 74 17                	je     2914 <bench_chain(nel::Slice<int> const&)+0x574>
+    28fd:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |         48 63 51 04          	movslq 0x4(%rcx),%rdx
+    2901:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |         48 01 d6             	add    %rdx,%rsi
+            return Some(*b_++);
+    2904:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |         48 8d 51 08          	lea    0x8(%rcx),%rdx
+            if (b_ == e_) { return None; }
+    2908:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |         49 39 d2             	cmp    %rdx,%r10
+    290b:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     +--------------------------------------------------------------|-------- 74 07                	je     2914 <bench_chain(nel::Slice<int> const&)+0x574>
+    290d:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |         48 63 51 08          	movslq 0x8(%rcx),%rdx
+    2911:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |         48 01 d6             	add    %rdx,%rsi
+        for (nel::Index i = 0; i < reps; ++i) {
+    2914:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     >--------------------------------------------------------------|-------> 49 83 c1 01          	add    $0x1,%r9
+            r += f(s);
+    2918:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |         48 01 f5             	add    %rsi,%rbp
+        for (nel::Index i = 0; i < reps; ++i) {
+    291b:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              |         4d 39 e1             	cmp    %r12,%r9
+    291e:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                              \-------- 0f 82 8c fe ff ff    	jb     27b0 <bench_chain(nel::Slice<int> const&)+0x410>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    2924:	|  |  |  |  |  |  |  |  |  |  |  |  /--|-----|-----|-----|-----|----------------------------------------------------------------------> 48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    2929:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |                                                                        bf 01 00 00 00       	mov    $0x1,%edi
+    292e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |                                                                        e8 1d e7 ff ff       	call   1050 <clock_gettime@plt>
+    bench::report_per_item(name, t, reps * s.len());
+    2933:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |                                                                        4d 0f af 66 08       	imul   0x8(%r14),%r12
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2938:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |                                                                        48 8b 44 24 60       	mov    0x60(%rsp),%rax
+    sink = sink + r;
+    293d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |                                                                        48 8b 15 54 87 00 00 	mov    0x8754(%rip),%rdx        # b098 <sink>
+    2944:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |                                                                        48 8b 4c 24 68       	mov    0x68(%rsp),%rcx
+    2949:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |                                                                        48 01 ea             	add    %rbp,%rdx
+    294c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |                                                                        48 89 15 45 87 00 00 	mov    %rdx,0x8745(%rip)        # b098 <sink>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    2953:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |                                                                        4d 85 e4             	test   %r12,%r12
+    2956:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     /----------------------------------------------------------------- 0f 85 bc 09 00 00    	jne    3318 <bench_chain(nel::Slice<int> const&)+0xf78>
+             << "ns/item\n";
+    295c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                                  48 8b 7c 24 40       	mov    0x40(%rsp),%rdi
+    2961:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                                  48 8d 35 6b 27 00 00 	lea    0x276b(%rip),%rsi        # 50d3 <_IO_stdin_used+0xd3>
+    2968:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                                  e8 93 19 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    296d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                                  48 8b 74 24 38       	mov    0x38(%rsp),%rsi
+    2972:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                                  48 89 c7             	mov    %rax,%rdi
+    2975:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                                  e8 86 19 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    297a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                                  31 f6                	xor    %esi,%esi
+    297c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                                  48 89 c7             	mov    %rax,%rdi
+    297f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                                  e8 3c 1a 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    2984:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                                  be 2e 00 00 00       	mov    $0x2e,%esi
+    2989:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                                  48 89 c7             	mov    %rax,%rdi
+    298c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                                  e8 4f 19 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    2991:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                                  48 8d 35 6c 26 00 00 	lea    0x266c(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    2998:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |     |                                                                  48 89 c7             	mov    %rax,%rdi
+    299b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  /--|----------------------------------------------------------------> e8 60 19 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    29a0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |                                                                  4c 89 e6             	mov    %r12,%rsi
+    29a3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |                                                                  48 89 c7             	mov    %rax,%rdi
+    29a6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |                                                                  e8 15 1a 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    29ab:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |                                                                  48 8d 35 70 26 00 00 	lea    0x2670(%rip),%rsi        # 5022 <_IO_stdin_used+0x22>
+    29b2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |                                                                  48 89 c7             	mov    %rax,%rdi
+    29b5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |                                                                  e8 46 19 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+            return len_;
+    29ba:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |                                                                  4d 8b 66 08          	mov    0x8(%r14),%r12
+    nel::Count const reps = n_total / s.len();
+    29be:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |                                                                  b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    29c3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |                                                                  31 d2                	xor    %edx,%edx
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    29c5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |                                                                  48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    29ca:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |                                                                  bf 01 00 00 00       	mov    $0x1,%edi
+    29cf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |                                                                  49 f7 f4             	div    %r12
+    29d2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |                                                                  48 89 c5             	mov    %rax,%rbp
+    29d5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |                                                                  e8 76 e6 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    29da:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |                                                                  48 8b 44 24 60       	mov    0x60(%rsp),%rax
+    29df:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |                                                                  4c 8b 7c 24 68       	mov    0x68(%rsp),%r15
+    29e4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |                                                                  48 89 44 24 48       	mov    %rax,0x48(%rsp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    29e9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |                                                                  49 81 fc 00 90 d0 03 	cmp    $0x3d09000,%r12
+    29f0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|-----|-----|-----|--|--|----------------------------------------------------------------- 0f 87 31 0b 00 00    	ja     3527 <bench_chain(nel::Slice<int> const&)+0x1187>
+    29f6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  49 8b 46 08          	mov    0x8(%r14),%rax
+    29fa:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  49 8b 0e             	mov    (%r14),%rcx
+            acc += Acc(e);
+    29fd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  4c 89 7c 24 28       	mov    %r15,0x28(%rsp)
+    2a02:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  66 0f ef e4          	pxor   %xmm4,%xmm4
+    2a06:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  4c 89 74 24 30       	mov    %r14,0x30(%rsp)
+            , e_(arr + len)
+    2a0b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  48 39 c3             	cmp    %rax,%rbx
+    2a0e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  48 89 c2             	mov    %rax,%rdx
+    2a11:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  49 89 cd             	mov    %rcx,%r13
+    2a14:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+    2a19:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  48 0f 46 d3          	cmovbe %rbx,%rdx
+    2a1d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  45 31 db             	xor    %r11d,%r11d
+    2a20:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  48 85 db             	test   %rbx,%rbx
+    2a23:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  4d 0f 44 eb          	cmove  %r11,%r13
+    2a27:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  48 8d 34 91          	lea    (%rcx,%rdx,4),%rsi
+            return Slice(&content_[b], e - b);
+    2a2b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  48 8d 0c 99          	lea    (%rcx,%rbx,4),%rcx
+    2a2f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  48 89 c2             	mov    %rax,%rdx
+    2a32:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  4c 0f 45 de          	cmovne %rsi,%r11
+    2a36:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  48 29 da             	sub    %rbx,%rdx
+            , e_(arr + len)
+    2a39:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+    Acc r = 0;
+    2a3e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  45 31 e4             	xor    %r12d,%r12d
+    2a41:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  48 8d 34 91          	lea    (%rcx,%rdx,4),%rsi
+        for (nel::Index i = 0; i < reps; ++i) {
+    2a45:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  45 31 c9             	xor    %r9d,%r9d
+            acc += Acc(e);
+    2a48:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  49 89 ce             	mov    %rcx,%r14
+    2a4b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                                  48 89 74 24 08       	mov    %rsi,0x8(%rsp)
+            if (b >= e) { return Slice::empty(); }
+    2a50:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |                                                  /-------------> 48 85 db             	test   %rbx,%rbx
+    2a53:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  /-----------------------------------------------|-------------- 0f 84 97 09 00 00    	je     33f0 <bench_chain(nel::Slice<int> const&)+0x1050>
+            if (b >= len_) { return Slice::empty(); }
+    2a59:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|-----|-----|--|--|--|-----------------------------------------------|-------------> 48 85 c0             	test   %rax,%rax
+    2a5c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |  |                                               |  /----------- 0f 84 86 01 00 00    	je     2be8 <bench_chain(nel::Slice<int> const&)+0x848>
+            if (b >= e) { return Slice::empty(); }
+    2a62:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |  |                                               |  |            48 39 c3             	cmp    %rax,%rbx
+    2a65:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |  |  /--------------------------------------------|--|----------- 0f 82 8e 09 00 00    	jb     33f9 <bench_chain(nel::Slice<int> const&)+0x1059>
+            for (; !self().is_done(); self().inc()) {
+    2a6b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |  |  |                                            |  |            48 8b 74 24 20       	mov    0x20(%rsp),%rsi
+    2a70:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |  |  |                                            |  |            48 39 74 24 10       	cmp    %rsi,0x10(%rsp)
+    2a75:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|-----|--|--|--|--|--------------------------------------------|--|----------- 0f 84 bc 0a 00 00    	je     3537 <bench_chain(nel::Slice<int> const&)+0x1197>
+    2a7b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |                                            |  |            49 89 f2             	mov    %rsi,%r10
+            : content_(p)
+    2a7e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |                                            |  |            48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    2a83:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |                                            |  |            45 31 c0             	xor    %r8d,%r8d
+            : content_(nullptr)
+    2a86:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |                                            |  |            31 c9                	xor    %ecx,%ecx
+    2a88:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  /-----------------------------------------|--|----------> 4d 8d 7a fc          	lea    -0x4(%r10),%r15
+    2a8c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |                                         |  |            48 89 f2             	mov    %rsi,%rdx
+    2a8f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |                                         |  |            49 29 f7             	sub    %rsi,%r15
+    2a92:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |                                         |  |            4c 89 ff             	mov    %r15,%rdi
+    2a95:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |                                         |  |            48 c1 ef 02          	shr    $0x2,%rdi
+    2a99:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |                                         |  |            48 83 c7 01          	add    $0x1,%rdi
+    2a9d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |                                         |  |            49 83 ff 08          	cmp    $0x8,%r15
+    2aa1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  /--------------------------------------|--|----------- 0f 86 6e 09 00 00    	jbe    3415 <bench_chain(nel::Slice<int> const&)+0x1075>
+    2aa7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |            49 89 ff             	mov    %rdi,%r15
+    2aaa:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |            66 0f ef d2          	pxor   %xmm2,%xmm2
+    2aae:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |            49 c1 ef 02          	shr    $0x2,%r15
+    2ab2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |            49 c1 e7 04          	shl    $0x4,%r15
+    2ab6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |            49 01 f7             	add    %rsi,%r15
+    2ab9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |            0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    2ac0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |        /-> f3 0f 6f 02          	movdqu (%rdx),%xmm0
+    2ac4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |        |   66 0f 6f cc          	movdqa %xmm4,%xmm1
+    2ac8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |        |   48 83 c2 10          	add    $0x10,%rdx
+    2acc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |        |   66 0f 66 c8          	pcmpgtd %xmm0,%xmm1
+    2ad0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |        |   66 0f 6f d8          	movdqa %xmm0,%xmm3
+    2ad4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |        |   66 0f 62 d9          	punpckldq %xmm1,%xmm3
+    2ad8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |        |   66 0f 6a c1          	punpckhdq %xmm1,%xmm0
+    2adc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |        |   66 0f d4 c3          	paddq  %xmm3,%xmm0
+    2ae0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |        |   66 0f d4 d0          	paddq  %xmm0,%xmm2
+    2ae4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |        |   4c 39 fa             	cmp    %r15,%rdx
+    2ae7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |        \-- 75 d7                	jne    2ac0 <bench_chain(nel::Slice<int> const&)+0x720>
+    2ae9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |            66 0f 6f c2          	movdqa %xmm2,%xmm0
+    2aed:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |            49 89 ff             	mov    %rdi,%r15
+    2af0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |            66 0f 73 d8 08       	psrldq $0x8,%xmm0
+    2af5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |            49 83 e7 fc          	and    $0xfffffffffffffffc,%r15
+    2af9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |            83 e7 03             	and    $0x3,%edi
+    2afc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |            66 0f d4 d0          	paddq  %xmm0,%xmm2
+    2b00:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |            4a 8d 34 be          	lea    (%rsi,%r15,4),%rsi
+    2b04:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |                                      |  |            66 48 0f 7e d2       	movq   %xmm2,%rdx
+    2b09:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|--|--|--|--|--|--------------------------------------|--|----------- 74 26                	je     2b31 <bench_chain(nel::Slice<int> const&)+0x791>
+    2b0b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        /-----------------------------|--|----------> 48 63 3e             	movslq (%rsi),%rdi
+    2b0e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |            48 01 fa             	add    %rdi,%rdx
+            ++b_;
+    2b11:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |            48 8d 7e 04          	lea    0x4(%rsi),%rdi
+    2b15:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |            49 39 fa             	cmp    %rdi,%r10
+    2b18:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  +--|--|--|--|--|--|--|--------|-----------------------------|--|----------- 74 17                	je     2b31 <bench_chain(nel::Slice<int> const&)+0x791>
+    2b1a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |            48 63 7e 04          	movslq 0x4(%rsi),%rdi
+    2b1e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |            48 01 fa             	add    %rdi,%rdx
+    2b21:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |            48 8d 7e 08          	lea    0x8(%rsi),%rdi
+    2b25:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |            49 39 fa             	cmp    %rdi,%r10
+    2b28:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  +--|--|--|--|--|--|--|--------|-----------------------------|--|----------- 74 07                	je     2b31 <bench_chain(nel::Slice<int> const&)+0x791>
+    2b2a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |            48 63 76 08          	movslq 0x8(%rsi),%rsi
+    2b2e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |            48 01 f2             	add    %rsi,%rdx
+    2b31:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  >--|--|--|--|--|--|--|--------|-----------------------------|--|----------> 4c 39 c1             	cmp    %r8,%rcx
+    2b34:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  /-------- 0f 84 ab 00 00 00    	je     2be5 <bench_chain(nel::Slice<int> const&)+0x845>
+    2b3a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |         49 8d 78 fc          	lea    -0x4(%r8),%rdi
+    2b3e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |         48 89 ce             	mov    %rcx,%rsi
+    2b41:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |         48 29 cf             	sub    %rcx,%rdi
+    2b44:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |         49 89 fa             	mov    %rdi,%r10
+    2b47:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |         49 c1 ea 02          	shr    $0x2,%r10
+    2b4b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |         49 83 c2 01          	add    $0x1,%r10
+    2b4f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |         48 83 ff 08          	cmp    $0x8,%rdi
+    2b53:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  /----- 76 6a                	jbe    2bbf <bench_chain(nel::Slice<int> const&)+0x81f>
+    2b55:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |      4c 89 d7             	mov    %r10,%rdi
+    2b58:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |      66 0f ef d2          	pxor   %xmm2,%xmm2
+    2b5c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |      48 c1 ef 02          	shr    $0x2,%rdi
+    2b60:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |      48 c1 e7 04          	shl    $0x4,%rdi
+    2b64:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |      48 01 cf             	add    %rcx,%rdi
+    2b67:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |      66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    2b6e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |      00 00 
+    2b70:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |  /-> f3 0f 6f 06          	movdqu (%rsi),%xmm0
+    2b74:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |  |   66 0f 6f cc          	movdqa %xmm4,%xmm1
+    2b78:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |  |   48 83 c6 10          	add    $0x10,%rsi
+    2b7c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |  |   66 0f 66 c8          	pcmpgtd %xmm0,%xmm1
+    2b80:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |  |   66 0f 6f d8          	movdqa %xmm0,%xmm3
+    2b84:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |  |   66 0f 6a d9          	punpckhdq %xmm1,%xmm3
+    2b88:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |  |   66 0f 62 c1          	punpckldq %xmm1,%xmm0
+    2b8c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |  |   66 0f d4 c3          	paddq  %xmm3,%xmm0
+    2b90:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |  |   66 0f d4 d0          	paddq  %xmm0,%xmm2
+    2b94:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |  |   48 39 fe             	cmp    %rdi,%rsi
+    2b97:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |  \-- 75 d7                	jne    2b70 <bench_chain(nel::Slice<int> const&)+0x7d0>
+    2b99:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |      66 0f 6f c2          	movdqa %xmm2,%xmm0
+    2b9d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |      66 0f 73 d8 08       	psrldq $0x8,%xmm0
+    2ba2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |      66 0f d4 d0          	paddq  %xmm0,%xmm2
+    2ba6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |      66 48 0f 7e d6       	movq   %xmm2,%rsi
+    2bab:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |      48 01 f2             	add    %rsi,%rdx
+    2bae:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |      4c 89 d6             	mov    %r10,%rsi
+    2bb1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |      48 83 e6 fc          	and    $0xfffffffffffffffc,%rsi
+    2bb5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |      41 83 e2 03          	and    $0x3,%r10d
+    2bb9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  |      48 8d 0c b1          	lea    (%rcx,%rsi,4),%rcx
+    2bbd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  +--|----- 74 26                	je     2be5 <bench_chain(nel::Slice<int> const&)+0x845>
+    2bbf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |  \----> 48 63 31             	movslq (%rcx),%rsi
+    2bc2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |         48 01 f2             	add    %rsi,%rdx
+    2bc5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |         48 8d 71 04          	lea    0x4(%rcx),%rsi
+    2bc9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |         49 39 f0             	cmp    %rsi,%r8
+    2bcc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  +-------- 74 17                	je     2be5 <bench_chain(nel::Slice<int> const&)+0x845>
+    2bce:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |         48 63 71 04          	movslq 0x4(%rcx),%rsi
+    2bd2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |         48 01 f2             	add    %rsi,%rdx
+    2bd5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |         48 8d 71 08          	lea    0x8(%rcx),%rsi
+    2bd9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |         49 39 f0             	cmp    %rsi,%r8
+    2bdc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  +-------- 74 07                	je     2be5 <bench_chain(nel::Slice<int> const&)+0x845>
+    2bde:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |         48 63 49 08          	movslq 0x8(%rcx),%rcx
+    2be2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  |         48 01 ca             	add    %rcx,%rdx
+            r += f(s);
+    2be5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  |  \-------> 49 01 d4             	add    %rdx,%r12
+        for (nel::Index i = 0; i < reps; ++i) {
+    2be8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |  \----------> 49 83 c1 01          	add    $0x1,%r9
+    2bec:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             |               49 39 e9             	cmp    %rbp,%r9
+    2bef:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |                             \-------------- 0f 82 5b fe ff ff    	jb     2a50 <bench_chain(nel::Slice<int> const&)+0x6b0>
+    2bf5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-----|-------------------------------------------> 4c 8b 7c 24 28       	mov    0x28(%rsp),%r15
+    2bfa:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                             4c 8b 74 24 30       	mov    0x30(%rsp),%r14
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    2bff:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|-------------------------------------------> 48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    2c04:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                             bf 01 00 00 00       	mov    $0x1,%edi
+    2c09:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                             e8 42 e4 ff ff       	call   1050 <clock_gettime@plt>
+    bench::report_per_item(name, t, reps * s.len());
+    2c0e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                             49 0f af 6e 08       	imul   0x8(%r14),%rbp
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2c13:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                             48 8b 44 24 60       	mov    0x60(%rsp),%rax
+    sink = sink + r;
+    2c18:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                             48 8b 15 79 84 00 00 	mov    0x8479(%rip),%rdx        # b098 <sink>
+    2c1f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                             48 8b 4c 24 68       	mov    0x68(%rsp),%rcx
+    2c24:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                             4c 01 e2             	add    %r12,%rdx
+    2c27:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                             48 89 15 6a 84 00 00 	mov    %rdx,0x846a(%rip)        # b098 <sink>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    2c2e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                             48 85 ed             	test   %rbp,%rbp
+    2c31:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /----------------------------------------- 0f 84 ef 07 00 00    	je     3426 <bench_chain(nel::Slice<int> const&)+0x1086>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2c37:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+             << "ns/item\n";
+    2c3e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 8b 7c 24 40       	mov    0x40(%rsp),%rdi
+    2c43:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 8d 35 a5 24 00 00 	lea    0x24a5(%rip),%rsi        # 50ef <_IO_stdin_used+0xef>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2c4a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 69 54 24 48 00 ca 	imul   $0x3b9aca00,0x48(%rsp),%rdx
+    2c51:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          9a 3b 
+    return now_ns() - b;
+    2c53:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          4c 29 f8             	sub    %r15,%rax
+    2c56:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 01 c8             	add    %rcx,%rax
+    2c59:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 29 d0             	sub    %rdx,%rax
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    2c5c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          31 d2                	xor    %edx,%edx
+    2c5e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    2c62:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    2c66:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 c1 e0 02          	shl    $0x2,%rax
+    2c6a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 f7 f5             	div    %rbp
+    long unsigned int const frac = cns % 100UL;
+    2c6d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 89 c5             	mov    %rax,%rbp
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    2c70:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 89 c1             	mov    %rax,%rcx
+    long unsigned int const frac = cns % 100UL;
+    2c73:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    2c7a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          c2 f5 28 
+    2c7d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 c1 ed 02          	shr    $0x2,%rbp
+    2c81:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 f7 e5             	mul    %rbp
+    2c84:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 89 d5             	mov    %rdx,%rbp
+    2c87:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 c1 ed 02          	shr    $0x2,%rbp
+    2c8b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 8d 44 ad 00       	lea    0x0(%rbp,%rbp,4),%rax
+    2c90:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          49 89 ec             	mov    %rbp,%r12
+    2c93:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    2c97:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 c1 e0 02          	shl    $0x2,%rax
+    2c9b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 29 c1             	sub    %rax,%rcx
+    2c9e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 89 cd             	mov    %rcx,%rbp
+             << "ns/item\n";
+    2ca1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          e8 5a 16 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    2ca6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 8b 74 24 38       	mov    0x38(%rsp),%rsi
+    2cab:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 89 c7             	mov    %rax,%rdi
+    2cae:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          e8 4d 16 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    2cb3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          4c 89 e6             	mov    %r12,%rsi
+    2cb6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 89 c7             	mov    %rax,%rdi
+    2cb9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          e8 02 17 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    2cbe:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          be 2e 00 00 00       	mov    $0x2e,%esi
+    2cc3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 89 c7             	mov    %rax,%rdi
+    2cc6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          e8 15 16 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    2ccb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 83 fd 0a          	cmp    $0xa,%rbp
+    2ccf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 8d 35 2e 23 00 00 	lea    0x232e(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    2cd6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 89 c7             	mov    %rax,%rdi
+    2cd9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 8d 05 2a 25 00 00 	lea    0x252a(%rip),%rax        # 520a <_IO_stdin_used+0x20a>
+    2ce0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                          48 0f 43 f0          	cmovae %rax,%rsi
+    2ce4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     /----------------------------------> e8 17 16 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    2ce9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    48 89 ee             	mov    %rbp,%rsi
+    2cec:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    48 89 c7             	mov    %rax,%rdi
+    2cef:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    e8 cc 16 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    2cf4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    48 8d 35 27 23 00 00 	lea    0x2327(%rip),%rsi        # 5022 <_IO_stdin_used+0x22>
+    2cfb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    48 89 c7             	mov    %rax,%rdi
+    2cfe:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    e8 fd 15 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+            return len_;
+    2d03:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    49 8b 6e 08          	mov    0x8(%r14),%rbp
+    nel::Count const reps = n_total / s.len();
+    2d07:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    2d0c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    31 d2                	xor    %edx,%edx
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    2d0e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    2d13:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    bf 01 00 00 00       	mov    $0x1,%edi
+    2d18:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    48 f7 f5             	div    %rbp
+    2d1b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    49 89 c4             	mov    %rax,%r12
+    2d1e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    e8 2d e3 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2d23:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    48 8b 44 24 60       	mov    0x60(%rsp),%rax
+    2d28:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    2d2d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    48 8b 44 24 68       	mov    0x68(%rsp),%rax
+    2d32:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    48 89 44 24 28       	mov    %rax,0x28(%rsp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2d37:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                                    48 81 fd 00 90 d0 03 	cmp    $0x3d09000,%rbp
+    2d3e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|----------------------------------- 0f 87 dc 07 00 00    	ja     3520 <bench_chain(nel::Slice<int> const&)+0x1180>
+    2d44:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    49 8b 0e             	mov    (%r14),%rcx
+    2d47:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    49 8b 46 08          	mov    0x8(%r14),%rax
+    2d4b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    31 f6                	xor    %esi,%esi
+    2d4d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    48 85 db             	test   %rbx,%rbx
+    2d50:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    49 89 f7             	mov    %rsi,%r15
+            acc += Acc(v.unwrap());
+    2d53:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    4c 89 74 24 10       	mov    %r14,0x10(%rsp)
+    2d58:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    66 0f ef e4          	pxor   %xmm4,%xmm4
+    2d5c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    4c 0f 45 f9          	cmovne %rcx,%r15
+            , e_(arr + len)
+    2d60:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    48 89 c2             	mov    %rax,%rdx
+            return Slice(&content_[b], e - b);
+    2d63:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    4c 8d 2c 99          	lea    (%rcx,%rbx,4),%r13
+            , e_(arr + len)
+    2d67:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    48 39 c3             	cmp    %rax,%rbx
+    2d6a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    48 0f 46 d3          	cmovbe %rbx,%rdx
+    2d6e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    48 85 db             	test   %rbx,%rbx
+    2d71:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    48 0f 44 d6          	cmove  %rsi,%rdx
+    Acc r = 0;
+    2d75:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    31 ed                	xor    %ebp,%ebp
+        for (nel::Index i = 0; i < reps; ++i) {
+    2d77:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    45 31 d2             	xor    %r10d,%r10d
+            if (b >= e) { return Slice::empty(); }
+    2d7a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    45 31 db             	xor    %r11d,%r11d
+            , e_(arr + len)
+    2d7d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    49 8d 34 97          	lea    (%r15,%rdx,4),%rsi
+            return Slice(&content_[b], e - b);
+    2d81:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    48 89 c2             	mov    %rax,%rdx
+    2d84:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    48 29 da             	sub    %rbx,%rdx
+            acc += Acc(v.unwrap());
+    2d87:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    49 89 f6             	mov    %rsi,%r14
+            , e_(arr + len)
+    2d8a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    49 8d 4c 95 00       	lea    0x0(%r13,%rdx,4),%rcx
+    2d8f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    48 89 4c 24 08       	mov    %rcx,0x8(%rsp)
+    2d94:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                                    0f 1f 40 00          	nopl   0x0(%rax)
+            if (b >= e) { return Slice::empty(); }
+    2d98:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                       /----------> 48 85 db             	test   %rbx,%rbx
+    2d9b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        /--------------|----------- 0f 84 2f 06 00 00    	je     33d0 <bench_chain(nel::Slice<int> const&)+0x1030>
+            if (b >= len_) { return Slice::empty(); }
+    2da1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |              |            48 85 c0             	test   %rax,%rax
+    2da4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        +--------------|----------- 0f 85 26 06 00 00    	jne    33d0 <bench_chain(nel::Slice<int> const&)+0x1030>
+    2daa:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |              |            45 31 c9             	xor    %r9d,%r9d
+            , e_(arr + len)
+    2dad:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |              |            45 31 c0             	xor    %r8d,%r8d
+            : content_(nullptr)
+    2db0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |              |            31 d2                	xor    %edx,%edx
+    2db2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |              |            31 ff                	xor    %edi,%edi
+        Acc acc = 0;
+    2db4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     /--|--------------|----------> 31 c9                	xor    %ecx,%ecx
+    2db6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |     /----- eb 12                	jmp    2dca <bench_chain(nel::Slice<int> const&)+0xa2a>
+    2db8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |     |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    2dbf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |     |      00 
+            acc += Acc(v.unwrap());
+    2dc0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |     |  /-> 48 63 32             	movslq (%rdx),%rsi
+            return Some(*b_++);
+    2dc3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |     |  |   48 83 c2 04          	add    $0x4,%rdx
+    2dc7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |     |  |   48 01 f1             	add    %rsi,%rcx
+            if (b_ == e_) { return None; }
+    2dca:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |     \--|-> 49 39 d0             	cmp    %rdx,%r8
+    2dcd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |        \-- 75 f1                	jne    2dc0 <bench_chain(nel::Slice<int> const&)+0xa20>
+    2dcf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |            4c 39 cf             	cmp    %r9,%rdi
+    2dd2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  /-------- 0f 84 c0 00 00 00    	je     2e98 <bench_chain(nel::Slice<int> const&)+0xaf8>
+    2dd8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         48 63 37             	movslq (%rdi),%rsi
+            return Some(*b_++);
+    2ddb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         48 8d 57 04          	lea    0x4(%rdi),%rdx
+    2ddf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         48 01 f1             	add    %rsi,%rcx
+            if (b_ == e_) { return None; }
+    2de2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         4c 39 ca             	cmp    %r9,%rdx
+    2de5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  +-------- 0f 84 ad 00 00 00    	je     2e98 <bench_chain(nel::Slice<int> const&)+0xaf8>
+    2deb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         49 8d 79 fc          	lea    -0x4(%r9),%rdi
+    2def:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         48 89 d6             	mov    %rdx,%rsi
+    2df2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         48 29 d7             	sub    %rdx,%rdi
+    2df5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         49 89 f8             	mov    %rdi,%r8
+    2df8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         49 c1 e8 02          	shr    $0x2,%r8
+    2dfc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         49 83 c0 01          	add    $0x1,%r8
+    2e00:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         48 83 ff 08          	cmp    $0x8,%rdi
+    2e04:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  /----- 76 69                	jbe    2e6f <bench_chain(nel::Slice<int> const&)+0xacf>
+    2e06:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |      4c 89 c7             	mov    %r8,%rdi
+    2e09:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |      66 0f ef d2          	pxor   %xmm2,%xmm2
+    2e0d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |      48 c1 ef 02          	shr    $0x2,%rdi
+    2e11:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |      48 c1 e7 04          	shl    $0x4,%rdi
+    2e15:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |      48 01 d7             	add    %rdx,%rdi
+    2e18:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    2e1f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |      00 
+    2e20:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |  /-> f3 0f 6f 06          	movdqu (%rsi),%xmm0
+    2e24:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |  |   66 0f 6f cc          	movdqa %xmm4,%xmm1
+    2e28:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |  |   48 83 c6 10          	add    $0x10,%rsi
+    2e2c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |  |   66 0f 66 c8          	pcmpgtd %xmm0,%xmm1
+    2e30:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |  |   66 0f 6f d8          	movdqa %xmm0,%xmm3
+    2e34:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |  |   66 0f 6a d9          	punpckhdq %xmm1,%xmm3
+    2e38:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |  |   66 0f 62 c1          	punpckldq %xmm1,%xmm0
+    2e3c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |  |   66 0f d4 c3          	paddq  %xmm3,%xmm0
+    2e40:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |  |   66 0f d4 d0          	paddq  %xmm0,%xmm2
+        Optional<OutT> next(void)
+    2e44:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |  |   48 39 fe             	cmp    %rdi,%rsi
+    2e47:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |  \-- 75 d7                	jne    2e20 <bench_chain(nel::Slice<int> const&)+0xa80>
+    2e49:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |      66 0f 6f c2          	movdqa %xmm2,%xmm0
+    2e4d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |      66 0f 73 d8 08       	psrldq $0x8,%xmm0
+    2e52:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |      66 0f d4 d0          	paddq  %xmm0,%xmm2
+    2e56:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |      66 48 0f 7e d6       	movq   %xmm2,%rsi
+    2e5b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |      48 01 f1             	add    %rsi,%rcx
+    2e5e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |      4c 89 c6             	mov    %r8,%rsi
+    2e61:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |      48 83 e6 fc          	and    $0xfffffffffffffffc,%rsi
+    2e65:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |      41 83 e0 03          	and    $0x3,%r8d
+    2e69:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  |      48 8d 14 b2          	lea    (%rdx,%rsi,4),%rdx
+    2e6d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  +--|----- 74 29                	je     2e98 <bench_chain(nel::Slice<int> const&)+0xaf8>
+    2e6f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |  \----> 48 63 32             	movslq (%rdx),%rsi
+    2e72:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         48 01 f1             	add    %rsi,%rcx
+            return Some(*b_++);
+    2e75:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         48 8d 72 04          	lea    0x4(%rdx),%rsi
+            if (b_ == e_) { return None; }
+    2e79:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         49 39 f1             	cmp    %rsi,%r9
+    2e7c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  +-------- 74 1a                	je     2e98 <bench_chain(nel::Slice<int> const&)+0xaf8>
+    2e7e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         48 63 72 04          	movslq 0x4(%rdx),%rsi
+    2e82:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         48 01 f1             	add    %rsi,%rcx
+            return Some(*b_++);
+    2e85:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         48 8d 72 08          	lea    0x8(%rdx),%rsi
+            if (b_ == e_) { return None; }
+    2e89:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         49 39 f1             	cmp    %rsi,%r9
+    2e8c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  +-------- 74 0a                	je     2e98 <bench_chain(nel::Slice<int> const&)+0xaf8>
+    2e8e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         48 63 52 08          	movslq 0x8(%rdx),%rdx
+    2e92:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         48 01 d1             	add    %rdx,%rcx
+        Optional<OutT> next(void)
+    2e95:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |         0f 1f 00             	nopl   (%rax)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2e98:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |  \-------> 49 83 c2 01          	add    $0x1,%r10
+            r += f(s);
+    2e9c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |            48 01 cd             	add    %rcx,%rbp
+        for (nel::Index i = 0; i < reps; ++i) {
+    2e9f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              |            4d 39 e2             	cmp    %r12,%r10
+    2ea2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |              \----------- 0f 82 f0 fe ff ff    	jb     2d98 <bench_chain(nel::Slice<int> const&)+0x9f8>
+    2ea8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |                           4c 8b 74 24 10       	mov    0x10(%rsp),%r14
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    2ead:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|-------------------------> 48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    2eb2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                           bf 01 00 00 00       	mov    $0x1,%edi
+    2eb7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                           e8 94 e1 ff ff       	call   1050 <clock_gettime@plt>
+    bench::report_per_item(name, t, reps * s.len());
+    2ebc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                           4d 0f af 66 08       	imul   0x8(%r14),%r12
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2ec1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                           48 8b 44 24 60       	mov    0x60(%rsp),%rax
+    sink = sink + r;
+    2ec6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                           48 8b 15 cb 81 00 00 	mov    0x81cb(%rip),%rdx        # b098 <sink>
+    2ecd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                           48 8b 4c 24 68       	mov    0x68(%rsp),%rcx
+    2ed2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                           48 01 ea             	add    %rbp,%rdx
+    2ed5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                           48 89 15 bc 81 00 00 	mov    %rdx,0x81bc(%rip)        # b098 <sink>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    2edc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                           4d 85 e4             	test   %r12,%r12
+    2edf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /----------------------- 0f 84 8c 05 00 00    	je     3471 <bench_chain(nel::Slice<int> const&)+0x10d1>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2ee5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+    return now_ns() - b;
+    2eec:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 8b 74 24 28       	mov    0x28(%rsp),%rsi
+             << "ns/item\n";
+    2ef1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 8b 7c 24 40       	mov    0x40(%rsp),%rdi
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2ef6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 69 54 24 20 00 ca 	imul   $0x3b9aca00,0x20(%rsp),%rdx
+    2efd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        9a 3b 
+    return now_ns() - b;
+    2eff:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 29 f0             	sub    %rsi,%rax
+             << "ns/item\n";
+    2f02:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 8d 35 02 22 00 00 	lea    0x2202(%rip),%rsi        # 510b <_IO_stdin_used+0x10b>
+    return now_ns() - b;
+    2f09:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 01 c8             	add    %rcx,%rax
+    2f0c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 29 d0             	sub    %rdx,%rax
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    2f0f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        31 d2                	xor    %edx,%edx
+    2f11:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    2f15:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    2f19:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 c1 e0 02          	shl    $0x2,%rax
+    2f1d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        49 f7 f4             	div    %r12
+    long unsigned int const frac = cns % 100UL;
+    2f20:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        49 89 c4             	mov    %rax,%r12
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    2f23:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 89 c1             	mov    %rax,%rcx
+    long unsigned int const frac = cns % 100UL;
+    2f26:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    2f2d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        c2 f5 28 
+    2f30:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        49 c1 ec 02          	shr    $0x2,%r12
+    2f34:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        49 f7 e4             	mul    %r12
+    2f37:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        49 89 d4             	mov    %rdx,%r12
+    2f3a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        49 c1 ec 02          	shr    $0x2,%r12
+    2f3e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        4b 8d 04 a4          	lea    (%r12,%r12,4),%rax
+    2f42:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        4c 89 e5             	mov    %r12,%rbp
+    2f45:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    2f49:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 c1 e0 02          	shl    $0x2,%rax
+    2f4d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 29 c1             	sub    %rax,%rcx
+    2f50:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        49 89 cc             	mov    %rcx,%r12
+             << "ns/item\n";
+    2f53:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        e8 a8 13 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    2f58:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 8b 74 24 38       	mov    0x38(%rsp),%rsi
+    2f5d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 89 c7             	mov    %rax,%rdi
+    2f60:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        e8 9b 13 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    2f65:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 89 ee             	mov    %rbp,%rsi
+    2f68:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 89 c7             	mov    %rax,%rdi
+    2f6b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        e8 50 14 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    2f70:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        be 2e 00 00 00       	mov    $0x2e,%esi
+    2f75:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 89 c7             	mov    %rax,%rdi
+    2f78:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        e8 63 13 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    2f7d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        49 83 fc 0a          	cmp    $0xa,%r12
+    2f81:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 8d 35 7c 20 00 00 	lea    0x207c(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    2f88:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 89 c7             	mov    %rax,%rdi
+    2f8b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 8d 05 78 22 00 00 	lea    0x2278(%rip),%rax        # 520a <_IO_stdin_used+0x20a>
+    2f92:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 0f 43 f0          	cmovae %rax,%rsi
+    2f96:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     /----------------> e8 65 13 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    2f9b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  4c 89 e6             	mov    %r12,%rsi
+    2f9e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  48 89 c7             	mov    %rax,%rdi
+    2fa1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  e8 1a 14 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    2fa6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  48 8d 35 75 20 00 00 	lea    0x2075(%rip),%rsi        # 5022 <_IO_stdin_used+0x22>
+    2fad:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  48 89 c7             	mov    %rax,%rdi
+    2fb0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  e8 4b 13 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+            return len_;
+    2fb5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  4d 8b 66 08          	mov    0x8(%r14),%r12
+    nel::Count const reps = n_total / s.len();
+    2fb9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    2fbe:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  31 d2                	xor    %edx,%edx
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    2fc0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    2fc5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  bf 01 00 00 00       	mov    $0x1,%edi
+    2fca:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  49 f7 f4             	div    %r12
+    2fcd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  48 89 c5             	mov    %rax,%rbp
+    2fd0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  e8 7b e0 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2fd5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  48 8b 44 24 60       	mov    0x60(%rsp),%rax
+    2fda:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  4c 8b 6c 24 68       	mov    0x68(%rsp),%r13
+    2fdf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  48 89 44 24 28       	mov    %rax,0x28(%rsp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    2fe4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  49 81 fc 00 90 d0 03 	cmp    $0x3d09000,%r12
+    2feb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|----------------- 0f 87 3e 05 00 00    	ja     352f <bench_chain(nel::Slice<int> const&)+0x118f>
+    2ff1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  4d 8b 56 08          	mov    0x8(%r14),%r10
+    2ff5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  31 c9                	xor    %ecx,%ecx
+    2ff7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  49 8b 16             	mov    (%r14),%rdx
+    2ffa:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  48 85 db             	test   %rbx,%rbx
+    2ffd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  49 89 cf             	mov    %rcx,%r15
+            acc += Acc(*it);
+    3000:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  4c 89 6c 24 10       	mov    %r13,0x10(%rsp)
+    3005:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  66 0f ef e4          	pxor   %xmm4,%xmm4
+    3009:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  4c 0f 45 fa          	cmovne %rdx,%r15
+            , e_(arr + len)
+    300d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  4c 89 d0             	mov    %r10,%rax
+    3010:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  4c 39 d3             	cmp    %r10,%rbx
+    3013:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  4c 89 74 24 20       	mov    %r14,0x20(%rsp)
+    3018:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  48 0f 46 c3          	cmovbe %rbx,%rax
+    301c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  48 85 db             	test   %rbx,%rbx
+    301f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  48 0f 44 c1          	cmove  %rcx,%rax
+            return Slice(&content_[b], e - b);
+    3023:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  48 8d 0c 9a          	lea    (%rdx,%rbx,4),%rcx
+    Acc r = 0;
+    3027:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  45 31 e4             	xor    %r12d,%r12d
+        for (nel::Index i = 0; i < reps; ++i) {
+    302a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  45 31 c9             	xor    %r9d,%r9d
+    302d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  48 89 4c 24 08       	mov    %rcx,0x8(%rsp)
+            if (b >= e) { return Slice::empty(); }
+    3032:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  45 31 db             	xor    %r11d,%r11d
+            , e_(arr + len)
+    3035:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  49 8d 34 87          	lea    (%r15,%rax,4),%rsi
+            return Slice(&content_[b], e - b);
+    3039:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  4c 89 d0             	mov    %r10,%rax
+    303c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  48 29 d8             	sub    %rbx,%rax
+            , e_(arr + len)
+    303f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  48 8d 04 81          	lea    (%rcx,%rax,4),%rax
+            acc += Acc(*it);
+    3043:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  49 89 c6             	mov    %rax,%r14
+    3046:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    304d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  00 00 00 
+            if (b >= e) { return Slice::empty(); }
+    3050:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     /----------> 48 85 db             	test   %rbx,%rbx
+    3053:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        /-- 74 0b                	je     3060 <bench_chain(nel::Slice<int> const&)+0xcc0>
+        Acc acc = 0;
+    3055:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |   31 c0                	xor    %eax,%eax
+            if (b >= len_) { return Slice::empty(); }
+    3057:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |   4d 85 d2             	test   %r10,%r10
+    305a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  /-----|-- 0f 84 f8 00 00 00    	je     3158 <bench_chain(nel::Slice<int> const&)+0xdb8>
+            if (b >= e) { return Slice::empty(); }
+    3060:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     \-> 48 8b 54 24 08       	mov    0x8(%rsp),%rdx
+    3065:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         4c 39 d3             	cmp    %r10,%rbx
+    3068:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         4c 89 d9             	mov    %r11,%rcx
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return it1_.is_done() && it2_.is_done();
+    306b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         4c 89 ff             	mov    %r15,%rdi
+    306e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         49 0f 42 ce          	cmovb  %r14,%rcx
+    3072:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         49 0f 43 d3          	cmovae %r11,%rdx
+    3076:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         31 c0                	xor    %eax,%eax
+    3078:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  /----- eb 10                	jmp    308a <bench_chain(nel::Slice<int> const&)+0xcea>
+    307a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+            acc += Acc(*it);
+    3080:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  /-> 4c 63 07             	movslq (%rdi),%r8
+            ++b_;
+    3083:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |   48 83 c7 04          	add    $0x4,%rdi
+    3087:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |   4c 01 c0             	add    %r8,%rax
+    308a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  \--|-> 48 39 fe             	cmp    %rdi,%rsi
+    308d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     \-- 75 f1                	jne    3080 <bench_chain(nel::Slice<int> const&)+0xce0>
+    308f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 39 ca             	cmp    %rcx,%rdx
+    3092:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  +-------- 0f 84 c0 00 00 00    	je     3158 <bench_chain(nel::Slice<int> const&)+0xdb8>
+    3098:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 63 3a             	movslq (%rdx),%rdi
+    309b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 83 c2 04          	add    $0x4,%rdx
+    309f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 01 f8             	add    %rdi,%rax
+    30a2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 39 ca             	cmp    %rcx,%rdx
+    30a5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  +-------- 0f 84 ad 00 00 00    	je     3158 <bench_chain(nel::Slice<int> const&)+0xdb8>
+    30ab:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         4c 8d 41 fc          	lea    -0x4(%rcx),%r8
+    30af:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 89 d7             	mov    %rdx,%rdi
+    30b2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         49 29 d0             	sub    %rdx,%r8
+    30b5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         4d 89 c5             	mov    %r8,%r13
+    30b8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         49 c1 ed 02          	shr    $0x2,%r13
+    30bc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         49 83 c5 01          	add    $0x1,%r13
+    30c0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         49 83 f8 08          	cmp    $0x8,%r8
+    30c4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  /----- 76 69                	jbe    312f <bench_chain(nel::Slice<int> const&)+0xd8f>
+    30c6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      4d 89 e8             	mov    %r13,%r8
+    30c9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      66 0f ef d2          	pxor   %xmm2,%xmm2
+    30cd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      49 c1 e8 02          	shr    $0x2,%r8
+    30d1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      49 c1 e0 04          	shl    $0x4,%r8
+    30d5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      49 01 d0             	add    %rdx,%r8
+    30d8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    30df:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      00 
+    30e0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  /-> f3 0f 6f 07          	movdqu (%rdi),%xmm0
+    30e4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |   66 0f 6f cc          	movdqa %xmm4,%xmm1
+    30e8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |   48 83 c7 10          	add    $0x10,%rdi
+    30ec:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |   66 0f 66 c8          	pcmpgtd %xmm0,%xmm1
+    30f0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |   66 0f 6f d8          	movdqa %xmm0,%xmm3
+    30f4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |   66 0f 6a d9          	punpckhdq %xmm1,%xmm3
+    30f8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |   66 0f 62 c1          	punpckldq %xmm1,%xmm0
+    30fc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |   66 0f d4 c3          	paddq  %xmm3,%xmm0
+    3100:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |   66 0f d4 d0          	paddq  %xmm0,%xmm2
+        constexpr bool is_done(void) const
+    3104:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |   4c 39 c7             	cmp    %r8,%rdi
+    3107:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  \-- 75 d7                	jne    30e0 <bench_chain(nel::Slice<int> const&)+0xd40>
+    3109:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      66 0f 6f c2          	movdqa %xmm2,%xmm0
+    310d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      66 0f 73 d8 08       	psrldq $0x8,%xmm0
+    3112:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      66 0f d4 d0          	paddq  %xmm0,%xmm2
+    3116:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      66 48 0f 7e d7       	movq   %xmm2,%rdi
+    311b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      48 01 f8             	add    %rdi,%rax
+    311e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      4c 89 ef             	mov    %r13,%rdi
+    3121:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      48 83 e7 fc          	and    $0xfffffffffffffffc,%rdi
+    3125:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      41 83 e5 03          	and    $0x3,%r13d
+    3129:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      48 8d 14 ba          	lea    (%rdx,%rdi,4),%rdx
+    312d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  +--|----- 74 29                	je     3158 <bench_chain(nel::Slice<int> const&)+0xdb8>
+    312f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  \----> 48 63 3a             	movslq (%rdx),%rdi
+    3132:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 01 f8             	add    %rdi,%rax
+    3135:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 8d 7a 04          	lea    0x4(%rdx),%rdi
+            return it1_.is_done() && it2_.is_done();
+    3139:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 39 f9             	cmp    %rdi,%rcx
+    313c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  +-------- 74 1a                	je     3158 <bench_chain(nel::Slice<int> const&)+0xdb8>
+    313e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 63 7a 04          	movslq 0x4(%rdx),%rdi
+    3142:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 01 f8             	add    %rdi,%rax
+    3145:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 8d 7a 08          	lea    0x8(%rdx),%rdi
+    3149:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 39 f9             	cmp    %rdi,%rcx
+    314c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  +-------- 74 0a                	je     3158 <bench_chain(nel::Slice<int> const&)+0xdb8>
+    314e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 63 52 08          	movslq 0x8(%rdx),%rdx
+    3152:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 01 d0             	add    %rdx,%rax
+        constexpr bool is_done(void) const
+    3155:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         0f 1f 00             	nopl   (%rax)
+        for (nel::Index i = 0; i < reps; ++i) {
+    3158:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  \-------> 49 83 c1 01          	add    $0x1,%r9
+            r += f(s);
+    315c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |            49 01 c4             	add    %rax,%r12
+        for (nel::Index i = 0; i < reps; ++i) {
+    315f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |            49 39 e9             	cmp    %rbp,%r9
+    3162:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     \----------- 0f 82 e8 fe ff ff    	jb     3050 <bench_chain(nel::Slice<int> const&)+0xcb0>
+    3168:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+    316d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  4c 8b 74 24 20       	mov    0x20(%rsp),%r14
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    3172:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-------------> 48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    3177:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               bf 01 00 00 00       	mov    $0x1,%edi
+    317c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               e8 cf de ff ff       	call   1050 <clock_gettime@plt>
+    bench::report_per_item(name, t, reps * s.len());
+    3181:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               49 0f af 6e 08       	imul   0x8(%r14),%rbp
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    3186:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 8b 44 24 60       	mov    0x60(%rsp),%rax
+    sink = sink + r;
+    318b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 8b 15 06 7f 00 00 	mov    0x7f06(%rip),%rdx        # b098 <sink>
+    3192:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 8b 4c 24 68       	mov    0x68(%rsp),%rcx
+    3197:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               4c 01 e2             	add    %r12,%rdx
+    319a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 89 15 f7 7e 00 00 	mov    %rdx,0x7ef7(%rip)        # b098 <sink>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    31a1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 85 ed             	test   %rbp,%rbp
+    31a4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /----------- 0f 84 0b 03 00 00    	je     34b5 <bench_chain(nel::Slice<int> const&)+0x1115>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    31aa:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+             << "ns/item\n";
+    31b1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 8b 7c 24 40       	mov    0x40(%rsp),%rdi
+    31b6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 8d 35 6a 1f 00 00 	lea    0x1f6a(%rip),%rsi        # 5127 <_IO_stdin_used+0x127>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    31bd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 69 54 24 28 00 ca 	imul   $0x3b9aca00,0x28(%rsp),%rdx
+    31c4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            9a 3b 
+    return now_ns() - b;
+    31c6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            4c 29 e8             	sub    %r13,%rax
+    31c9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 01 c8             	add    %rcx,%rax
+    31cc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 29 d0             	sub    %rdx,%rax
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    31cf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            31 d2                	xor    %edx,%edx
+    31d1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    31d5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    31d9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 c1 e0 02          	shl    $0x2,%rax
+    31dd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 f7 f5             	div    %rbp
+    long unsigned int const frac = cns % 100UL;
+    31e0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 89 c5             	mov    %rax,%rbp
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    31e3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 89 c1             	mov    %rax,%rcx
+    long unsigned int const frac = cns % 100UL;
+    31e6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    31ed:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            c2 f5 28 
+    31f0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 c1 ed 02          	shr    $0x2,%rbp
+    31f4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 f7 e5             	mul    %rbp
+    31f7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 89 d5             	mov    %rdx,%rbp
+    31fa:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 c1 ed 02          	shr    $0x2,%rbp
+    31fe:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 8d 44 ad 00       	lea    0x0(%rbp,%rbp,4),%rax
+    3203:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 89 eb             	mov    %rbp,%rbx
+    3206:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    320a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 c1 e0 02          	shl    $0x2,%rax
+    320e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 29 c1             	sub    %rax,%rcx
+    3211:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 89 cd             	mov    %rcx,%rbp
+             << "ns/item\n";
+    3214:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            e8 e7 10 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    3219:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 8b 74 24 38       	mov    0x38(%rsp),%rsi
+    321e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    3221:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            e8 da 10 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    3226:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 89 de             	mov    %rbx,%rsi
+    3229:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    322c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            e8 8f 11 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    3231:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            be 2e 00 00 00       	mov    $0x2e,%esi
+    3236:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    3239:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            e8 a2 10 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    323e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 83 fd 0a          	cmp    $0xa,%rbp
+    3242:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 8d 35 bb 1d 00 00 	lea    0x1dbb(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    3249:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    324c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 8d 05 b7 1f 00 00 	lea    0x1fb7(%rip),%rax        # 520a <_IO_stdin_used+0x20a>
+    3253:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 0f 43 f0          	cmovae %rax,%rsi
+    3257:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-------> e8 a4 10 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    325c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 ee             	mov    %rbp,%rsi
+    325f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    3262:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 59 11 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+}
+    3267:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 83 c4 78          	add    $0x78,%rsp
+    326b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8d 35 b0 1d 00 00 	lea    0x1db0(%rip),%rsi        # 5022 <_IO_stdin_used+0x22>
+    3272:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         5b                   	pop    %rbx
+    3273:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    3276:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         5d                   	pop    %rbp
+    3277:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         41 5c                	pop    %r12
+    3279:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         41 5d                	pop    %r13
+    327b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         41 5e                	pop    %r14
+    327d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         41 5f                	pop    %r15
+    327f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e9 7c 10 00 00       	jmp    4300 <nel::operator<<(nel::Log&, char const*)>
+    3284:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         0f 1f 40 00          	nopl   0x0(%rax)
+            : content_(nullptr)
+    3288:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-------> 31 c9                	xor    %ecx,%ecx
+            if (b_ == e_) { return None; }
+    328a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         45 31 d2             	xor    %r10d,%r10d
+    328d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         4d 39 fb             	cmp    %r15,%r11
+    3290:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  \--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-------- 0f 85 44 f5 ff ff    	jne    27da <bench_chain(nel::Slice<int> const&)+0x43a>
+    3296:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    329d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         00 00 00 
+        Acc acc = 0;
+    32a0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \--|-----|-----|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-------> 31 f6                	xor    %esi,%esi
+    32a2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  \--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-------- e9 6d f6 ff ff       	jmp    2914 <bench_chain(nel::Slice<int> const&)+0x574>
+    32a7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    32ae:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         00 00 
+        Acc acc = 0;
+    32b0:	|  |  \--|--|--|--|--|--|--|--|--|--|--|--|-----|-----|-----|-----|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-------> 31 c0                	xor    %eax,%eax
+    32b2:	|  |     |  |  |  \--|--|--|--|--|--|--|--|-----|-----|-----|-----|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-------- e9 7d f2 ff ff       	jmp    2534 <bench_chain(nel::Slice<int> const&)+0x194>
+    32b7:	|  |     \--|--|-----|--|--|--|--|--|--|--|-----|-----|-----|-----|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-------> 31 c0                	xor    %eax,%eax
+        for (nel::Index i = 0; i < h; ++i) {
+    32b9:	|  |        |  |     |  |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         31 d2                	xor    %edx,%edx
+    32bb:	|  |        |  \-----|--|--|--|--|--|--|--|-----|-----|-----|-----|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-------- e9 43 f2 ff ff       	jmp    2503 <bench_chain(nel::Slice<int> const&)+0x163>
+    32c0:	|  |        |        \--|--|--|--|--|--|--|-----|-----|-----|-----|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-------> 48 8d 05 d9 7d 00 00 	lea    0x7dd9(%rip),%rax        # b0a0 <nel::log>
+    32c7:	|  |        |           |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8d 35 e9 1d 00 00 	lea    0x1de9(%rip),%rsi        # 50b7 <_IO_stdin_used+0xb7>
+    32ce:	|  |        |           |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    32d1:	|  |        |           |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 44 24 40       	mov    %rax,0x40(%rsp)
+    32d6:	|  |        |           |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 25 10 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    32db:	|  |        |           |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    32de:	|  |        |           |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8d 05 2a 1f 00 00 	lea    0x1f2a(%rip),%rax        # 520f <_IO_stdin_used+0x20f>
+    32e5:	|  |        |           |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 c6             	mov    %rax,%rsi
+    32e8:	|  |        |           |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 44 24 38       	mov    %rax,0x38(%rsp)
+    32ed:	|  |        |           |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 0e 10 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    32f2:	|  |        |           |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         31 f6                	xor    %esi,%esi
+    32f4:	|  |        |           |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    32f7:	|  |        |           |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 c4 10 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    32fc:	|  |        |           |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         be 2e 00 00 00       	mov    $0x2e,%esi
+    3301:	|  |        |           |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    3304:	|  |        |           |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 d7 0f 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    3309:	|  |        |           |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8d 35 f4 1c 00 00 	lea    0x1cf4(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    3310:	|  |        |           |  |  |  |  |  |  |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    3313:	|  |        |           |  \--|--|--|--|--|-----|-----|-----|-----|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-------- e9 bd f3 ff ff       	jmp    26d5 <bench_chain(nel::Slice<int> const&)+0x335>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    3318:	|  |        |           |     |  |  |  |  |     |     |     |     |  \--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-------> 48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+    return now_ns() - b;
+    331f:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8b 74 24 50       	mov    0x50(%rsp),%rsi
+             << "ns/item\n";
+    3324:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8b 7c 24 40       	mov    0x40(%rsp),%rdi
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    3329:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 69 54 24 48 00 ca 	imul   $0x3b9aca00,0x48(%rsp),%rdx
+    3330:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         9a 3b 
+    return now_ns() - b;
+    3332:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 29 f0             	sub    %rsi,%rax
+             << "ns/item\n";
+    3335:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8d 35 97 1d 00 00 	lea    0x1d97(%rip),%rsi        # 50d3 <_IO_stdin_used+0xd3>
+    return now_ns() - b;
+    333c:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 01 c8             	add    %rcx,%rax
+    333f:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 29 d0             	sub    %rdx,%rax
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    3342:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         31 d2                	xor    %edx,%edx
+    3344:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    3348:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    334c:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 c1 e0 02          	shl    $0x2,%rax
+    3350:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         49 f7 f4             	div    %r12
+    long unsigned int const frac = cns % 100UL;
+    3353:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         49 89 c4             	mov    %rax,%r12
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    3356:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 c1             	mov    %rax,%rcx
+    long unsigned int const frac = cns % 100UL;
+    3359:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    3360:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         c2 f5 28 
+    3363:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         49 c1 ec 02          	shr    $0x2,%r12
+    3367:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         49 f7 e4             	mul    %r12
+    336a:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         49 89 d4             	mov    %rdx,%r12
+    336d:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         49 c1 ec 02          	shr    $0x2,%r12
+    3371:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         4b 8d 04 a4          	lea    (%r12,%r12,4),%rax
+    3375:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         4c 89 e5             	mov    %r12,%rbp
+    3378:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    337c:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 c1 e0 02          	shl    $0x2,%rax
+    3380:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 29 c1             	sub    %rax,%rcx
+    3383:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         49 89 cc             	mov    %rcx,%r12
+             << "ns/item\n";
+    3386:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 75 0f 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    338b:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8b 74 24 38       	mov    0x38(%rsp),%rsi
+    3390:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    3393:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 68 0f 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    3398:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 ee             	mov    %rbp,%rsi
+    339b:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    339e:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 1d 10 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    33a3:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         be 2e 00 00 00       	mov    $0x2e,%esi
+    33a8:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    33ab:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 30 0f 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    33b0:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         49 83 fc 0a          	cmp    $0xa,%r12
+    33b4:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8d 35 49 1c 00 00 	lea    0x1c49(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    33bb:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    33be:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8d 05 45 1e 00 00 	lea    0x1e45(%rip),%rax        # 520a <_IO_stdin_used+0x20a>
+    33c5:	|  |        |           |     |  |  |  |  |     |     |     |     |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 0f 43 f0          	cmovae %rax,%rsi
+    33c9:	|  |        |           |     |  |  |  |  |     |     |     |     \-----|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-------- e9 cd f5 ff ff       	jmp    299b <bench_chain(nel::Slice<int> const&)+0x5fb>
+    33ce:	|  |        |           |     |  |  |  |  |     |     |     |           |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         66 90                	xchg   %ax,%ax
+            if (b >= e) { return Slice::empty(); }
+    33d0:	|  |        |           |     |  |  |  |  |     |     |     |           |  |  |  |  |  |  |  |  |  |  |  |  \--|--|--|--|--|--|-------> 4c 8b 4c 24 08       	mov    0x8(%rsp),%r9
+    33d5:	|  |        |           |     |  |  |  |  |     |     |     |           |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |         48 39 c3             	cmp    %rax,%rbx
+    33d8:	|  |        |           |     |  |  |  |  |     |     |     |           |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |         4c 89 df             	mov    %r11,%rdi
+    33db:	|  |        |           |     |  |  |  |  |     |     |     |           |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |         4d 89 f0             	mov    %r14,%r8
+    33de:	|  |        |           |     |  |  |  |  |     |     |     |           |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |         49 0f 42 fd          	cmovb  %r13,%rdi
+    33e2:	|  |        |           |     |  |  |  |  |     |     |     |           |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |         4c 89 fa             	mov    %r15,%rdx
+    33e5:	|  |        |           |     |  |  |  |  |     |     |     |           |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |         4d 0f 43 cb          	cmovae %r11,%r9
+    33e9:	|  |        |           |     |  |  |  |  |     |     |     |           |  |  |  |  |  |  |  |  |  |  |  \-----|--|--|--|--|--|-------- e9 c6 f9 ff ff       	jmp    2db4 <bench_chain(nel::Slice<int> const&)+0xa14>
+    33ee:	|  |        |           |     |  |  |  |  |     |     |     |           |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |         66 90                	xchg   %ax,%ax
+    33f0:	|  |        |           |     |  |  |  |  |     |     |     |           \--|--|--|--|--|--|--|--|--|--|--------|--|--|--|--|--|-------> 48 85 c0             	test   %rax,%rax
+    33f3:	|  |        |           |     |  |  |  |  |     |     |     |              |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |     /-- 0f 84 00 01 00 00    	je     34f9 <bench_chain(nel::Slice<int> const&)+0x1159>
+            for (; !self().is_done(); self().inc()) {
+    33f9:	|  |        |           |     |  |  |  |  |     |     |     |              \--|--|--|--|--|--|--|--|--|--------|--|--|--|--|--|-----|-> 4d 39 dd             	cmp    %r11,%r13
+    33fc:	|  |        |           |     |  |  |  |  |     |     |     |                 |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  /--|-- 0f 84 47 01 00 00    	je     3549 <bench_chain(nel::Slice<int> const&)+0x11a9>
+    3402:	|  |        |           |     |  |  |  |  |     |     |     |                 |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |  |   4c 8b 44 24 08       	mov    0x8(%rsp),%r8
+    3407:	|  |        |           |     |  |  |  |  |     |     |     |                 |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |  |   4c 89 ee             	mov    %r13,%rsi
+    340a:	|  |        |           |     |  |  |  |  |     |     |     |                 |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |  |   4d 89 da             	mov    %r11,%r10
+            : content_(p)
+    340d:	|  |        |           |     |  |  |  |  |     |     |     |                 |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |  |   4c 89 f1             	mov    %r14,%rcx
+    3410:	|  |        |           |     |  |  |  |  |     |     |     |                 \--|--|--|--|--|--|--|--|--------|--|--|--|--|--|--|--|-- e9 73 f6 ff ff       	jmp    2a88 <bench_chain(nel::Slice<int> const&)+0x6e8>
+        Acc acc = 0;
+    3415:	|  |        |           |     |  |  |  |  |     |     |     |                    \--|--|--|--|--|--|--|--------|--|--|--|--|--|--|--|-> 31 d2                	xor    %edx,%edx
+    3417:	|  |        |           |     |  |  |  |  |     |     |     |                       |  |  \--|--|--|--|--------|--|--|--|--|--|--|--|-- e9 ef f6 ff ff       	jmp    2b0b <bench_chain(nel::Slice<int> const&)+0x76b>
+        for (nel::Index i = 0; i < reps; ++i) {
+    341c:	|  |        |           |     \--|--|--|--|-----|-----|-----|-----------------------|--|-----|--|--|--|--------|--|--|--|--|--|--|--|-> 4c 89 da             	mov    %r11,%rdx
+        Acc acc = 0;
+    341f:	|  |        |           |        |  |  |  |     |     |     |                       |  |     |  |  |  |        |  |  |  |  |  |  |  |   31 f6                	xor    %esi,%esi
+    3421:	|  |        |           |        |  |  \--|-----|-----|-----|-----------------------|--|-----|--|--|--|--------|--|--|--|--|--|--|--|-- e9 19 f4 ff ff       	jmp    283f <bench_chain(nel::Slice<int> const&)+0x49f>
+    3426:	|  |        |           |        |  |     |     |     |     |                       |  |     \--|--|--|--------|--|--|--|--|--|--|--|-> 48 8b 7c 24 40       	mov    0x40(%rsp),%rdi
+    342b:	|  |        |           |        |  |     |     |     |     |                       |  |        |  |  |        |  |  |  |  |  |  |  |   48 8d 35 bd 1c 00 00 	lea    0x1cbd(%rip),%rsi        # 50ef <_IO_stdin_used+0xef>
+    3432:	|  |        |           |        |  |     |     |     |     |                       |  |        |  |  |        |  |  |  |  |  |  |  |   e8 c9 0e 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    3437:	|  |        |           |        |  |     |     |     |     |                       |  |        |  |  |        |  |  |  |  |  |  |  |   48 8b 74 24 38       	mov    0x38(%rsp),%rsi
+    343c:	|  |        |           |        |  |     |     |     |     |                       |  |        |  |  |        |  |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    343f:	|  |        |           |        |  |     |     |     |     |                       |  |        |  |  |        |  |  |  |  |  |  |  |   e8 bc 0e 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    3444:	|  |        |           |        |  |     |     |     |     |                       |  |        |  |  |        |  |  |  |  |  |  |  |   31 f6                	xor    %esi,%esi
+    3446:	|  |        |           |        |  |     |     |     |     |                       |  |        |  |  |        |  |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    3449:	|  |        |           |        |  |     |     |     |     |                       |  |        |  |  |        |  |  |  |  |  |  |  |   e8 72 0f 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    344e:	|  |        |           |        |  |     |     |     |     |                       |  |        |  |  |        |  |  |  |  |  |  |  |   be 2e 00 00 00       	mov    $0x2e,%esi
+    3453:	|  |        |           |        |  |     |     |     |     |                       |  |        |  |  |        |  |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    3456:	|  |        |           |        |  |     |     |     |     |                       |  |        |  |  |        |  |  |  |  |  |  |  |   e8 85 0e 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    345b:	|  |        |           |        |  |     |     |     |     |                       |  |        |  |  |        |  |  |  |  |  |  |  |   48 8d 35 a2 1b 00 00 	lea    0x1ba2(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    3462:	|  |        |           |        |  |     |     |     |     |                       |  |        |  |  |        |  |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    3465:	|  |        |           |        |  |     |     |     |     |                       |  |        |  \--|--------|--|--|--|--|--|--|--|-- e9 7a f8 ff ff       	jmp    2ce4 <bench_chain(nel::Slice<int> const&)+0x944>
+    346a:	|  |        |           \--------|--|-----|-----|-----|-----|-----------------------|--|--------|-----|--------|--|--|--|--|--|--|--|-> 31 f6                	xor    %esi,%esi
+    346c:	|  |        |                    \--|-----|-----|-----|-----|-----------------------|--|--------|-----|--------|--|--|--|--|--|--|--|-- e9 f4 f3 ff ff       	jmp    2865 <bench_chain(nel::Slice<int> const&)+0x4c5>
+    3471:	|  |        |                       |     |     |     |     |                       |  |        |     |        \--|--|--|--|--|--|--|-> 48 8b 7c 24 40       	mov    0x40(%rsp),%rdi
+    3476:	|  |        |                       |     |     |     |     |                       |  |        |     |           |  |  |  |  |  |  |   48 8d 35 8e 1c 00 00 	lea    0x1c8e(%rip),%rsi        # 510b <_IO_stdin_used+0x10b>
+    347d:	|  |        |                       |     |     |     |     |                       |  |        |     |           |  |  |  |  |  |  |   e8 7e 0e 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    3482:	|  |        |                       |     |     |     |     |                       |  |        |     |           |  |  |  |  |  |  |   48 8b 74 24 38       	mov    0x38(%rsp),%rsi
+    3487:	|  |        |                       |     |     |     |     |                       |  |        |     |           |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    348a:	|  |        |                       |     |     |     |     |                       |  |        |     |           |  |  |  |  |  |  |   e8 71 0e 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    348f:	|  |        |                       |     |     |     |     |                       |  |        |     |           |  |  |  |  |  |  |   31 f6                	xor    %esi,%esi
+    3491:	|  |        |                       |     |     |     |     |                       |  |        |     |           |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    3494:	|  |        |                       |     |     |     |     |                       |  |        |     |           |  |  |  |  |  |  |   e8 27 0f 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    3499:	|  |        |                       |     |     |     |     |                       |  |        |     |           |  |  |  |  |  |  |   be 2e 00 00 00       	mov    $0x2e,%esi
+    349e:	|  |        |                       |     |     |     |     |                       |  |        |     |           |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    34a1:	|  |        |                       |     |     |     |     |                       |  |        |     |           |  |  |  |  |  |  |   e8 3a 0e 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    34a6:	|  |        |                       |     |     |     |     |                       |  |        |     |           |  |  |  |  |  |  |   48 8d 35 57 1b 00 00 	lea    0x1b57(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    34ad:	|  |        |                       |     |     |     |     |                       |  |        |     |           |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    34b0:	|  |        |                       |     |     |     |     |                       |  |        |     |           |  \--|--|--|--|--|-- e9 e1 fa ff ff       	jmp    2f96 <bench_chain(nel::Slice<int> const&)+0xbf6>
+    34b5:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |  \--|--|--|-> 48 8b 7c 24 40       	mov    0x40(%rsp),%rdi
+    34ba:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |     |  |  |   48 8d 35 66 1c 00 00 	lea    0x1c66(%rip),%rsi        # 5127 <_IO_stdin_used+0x127>
+    34c1:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |     |  |  |   e8 3a 0e 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    34c6:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |     |  |  |   48 8b 74 24 38       	mov    0x38(%rsp),%rsi
+    34cb:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |     |  |  |   48 89 c7             	mov    %rax,%rdi
+    34ce:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |     |  |  |   e8 2d 0e 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    34d3:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |     |  |  |   31 f6                	xor    %esi,%esi
+    34d5:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |     |  |  |   48 89 c7             	mov    %rax,%rdi
+    34d8:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |     |  |  |   e8 e3 0e 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    34dd:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |     |  |  |   be 2e 00 00 00       	mov    $0x2e,%esi
+    34e2:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |     |  |  |   48 89 c7             	mov    %rax,%rdi
+    34e5:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |     |  |  |   e8 f6 0d 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    34ea:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |     |  |  |   48 8d 35 13 1b 00 00 	lea    0x1b13(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    34f1:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |     |  |  |   48 89 c7             	mov    %rax,%rdi
+    34f4:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |     \--|--|-- e9 5e fd ff ff       	jmp    3257 <bench_chain(nel::Slice<int> const&)+0xeb7>
+    34f9:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |        |  \-> 4c 8b 7c 24 28       	mov    0x28(%rsp),%r15
+    34fe:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |        |      4c 8b 74 24 30       	mov    0x30(%rsp),%r14
+        for (nel::Index i = 0; i < reps; ++i) {
+    3503:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |        |  /-> 49 83 c1 01          	add    $0x1,%r9
+    3507:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |        |  |   49 39 e9             	cmp    %rbp,%r9
+    350a:	|  |        |                       |     |     |     |     |                       |  |        |     |           |     |        |  \-- 72 f7                	jb     3503 <bench_chain(nel::Slice<int> const&)+0x1163>
+    350c:	|  |        |                       |     |     |     |     |                       |  +--------|-----|-----------|-----|--------|----- e9 ee f6 ff ff       	jmp    2bff <bench_chain(nel::Slice<int> const&)+0x85f>
+    Acc r = 0;
+    3511:	\--|--------|-----------------------|-----|-----|-----|-----|-----------------------|--|--------|-----|-----------|-----|--------|----> 45 31 e4             	xor    %r12d,%r12d
+    3514:	   \--------|-----------------------|-----|-----|-----|-----|-----------------------|--|--------|-----|-----------|-----|--------|----- e9 be f0 ff ff       	jmp    25d7 <bench_chain(nel::Slice<int> const&)+0x237>
+    3519:	            \-----------------------|-----|-----|-----|-----|-----------------------|--|--------|-----|-----------|-----|--------|----> 31 ed                	xor    %ebp,%ebp
+    351b:	                                    \-----|-----|-----|-----|-----------------------|--|--------|-----|-----------|-----|--------|----- e9 04 f4 ff ff       	jmp    2924 <bench_chain(nel::Slice<int> const&)+0x584>
+    3520:	                                          |     |     |     |                       |  |        \-----|-----------|-----|--------|----> 31 ed                	xor    %ebp,%ebp
+    3522:	                                          |     |     |     |                       |  |              \-----------|-----|--------|----- e9 86 f9 ff ff       	jmp    2ead <bench_chain(nel::Slice<int> const&)+0xb0d>
+    3527:	                                          \-----|-----|-----|-----------------------|--|--------------------------|-----|--------|----> 45 31 e4             	xor    %r12d,%r12d
+    352a:	                                                |     |     |                       |  \--------------------------|-----|--------|----- e9 d0 f6 ff ff       	jmp    2bff <bench_chain(nel::Slice<int> const&)+0x85f>
+    352f:	                                                |     |     |                       |                             \-----|--------|----> 45 31 e4             	xor    %r12d,%r12d
+    3532:	                                                |     |     |                       |                                   \--------|----- e9 3b fc ff ff       	jmp    3172 <bench_chain(nel::Slice<int> const&)+0xdd2>
+        for (nel::Index i = 0; i < reps; ++i) {
+    3537:	                                                |     \-----|-----------------------|--------------------------------------------|----> 49 83 c1 01          	add    $0x1,%r9
+    353b:	                                                |           |                       |                                            |      49 39 e9             	cmp    %rbp,%r9
+    353e:	                                                \-----------|-----------------------|--------------------------------------------|----- 0f 82 15 f5 ff ff    	jb     2a59 <bench_chain(nel::Slice<int> const&)+0x6b9>
+    3544:	                                                            |                       \--------------------------------------------|----- e9 ac f6 ff ff       	jmp    2bf5 <bench_chain(nel::Slice<int> const&)+0x855>
+    3549:	                                                            |                                                                    \----> 4c 8b 44 24 08       	mov    0x8(%rsp),%r8
+    354e:	                                                            |                                                                           4c 89 f1             	mov    %r14,%rcx
+        Acc acc = 0;
+    3551:	                                                            |                                                                           31 d2                	xor    %edx,%edx
+    3553:	                                                            \-------------------------------------------------------------------------- e9 d9 f5 ff ff       	jmp    2b31 <bench_chain(nel::Slice<int> const&)+0x791>
+    3558:	                                                                                                                                        0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    355f:	                                                                                                                                        00 
+
+0000000000003560 <bench_queue(nel::Slice<int> const&)>:
+{
+    3560:	                                                                         41 57                	push   %r15
+    3562:	                                                                         49 89 f8             	mov    %rdi,%r8
+    for (nel::Index i = 0; i < queue_len + queue_len / 2; ++i) {
+    3565:	                                                                         31 f6                	xor    %esi,%esi
+            return Result<void, T>::Ok();
+#    else
+            if (is_full()) {
+                // here , rp_ == wp_.
+                rp_ += 1;
+                if (rp_ >= capacity()) { rp_ = 0; }
+    3567:	                                                                         45 31 c9             	xor    %r9d,%r9d
+        queue.push(int(i % 1000)).unwrap();
+    356a:	                                                                         49 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%r10
+    3571:	                                                                         9b c4 20 
+{
+    3574:	                                                                         41 56                	push   %r14
+    3576:	                                                                         41 55                	push   %r13
+    3578:	                                                                         41 54                	push   %r12
+    357a:	                                                                         55                   	push   %rbp
+    357b:	                                                                         53                   	push   %rbx
+    357c:	                                                                         48 8d 1d 15 3b 00 00 	lea    0x3b15(%rip),%rbx        # 7098 <queue+0x18>
+    3583:	                                                                         48 83 ec 48          	sub    $0x48,%rsp
+                *ptr(wp_) = move(val);
+    3587:	                                                                         48 8b 0d fa 3a 00 00 	mov    0x3afa(%rip),%rcx        # 7088 <queue+0x8>
+            return len_ == N;
+    358e:	                                                                         48 8b 3d eb 3a 00 00 	mov    0x3aeb(%rip),%rdi        # 7080 <queue>
+    3595:	                                                                         0f 1f 00             	nopl   (%rax)
+        queue.push(int(i % 1000)).unwrap();
+    3598:	                                                            /----------> 48 89 f2             	mov    %rsi,%rdx
+    359b:	                                                            |            49 89 f3             	mov    %rsi,%r11
+    359e:	                                                            |            48 c1 ea 03          	shr    $0x3,%rdx
+    35a2:	                                                            |            48 89 d0             	mov    %rdx,%rax
+    35a5:	                                                            |            49 f7 e2             	mul    %r10
+    35a8:	                                                            |            48 c1 ea 04          	shr    $0x4,%rdx
+    35ac:	                                                            |            48 69 d2 e8 03 00 00 	imul   $0x3e8,%rdx,%rdx
+    35b3:	                                                            |            49 29 d3             	sub    %rdx,%r11
+            return &ptr()[d];
+    35b6:	                                                            |            48 8d 14 8b          	lea    (%rbx,%rcx,4),%rdx
+            if (is_full()) {
+    35ba:	                                                            |            48 81 ff 00 10 00 00 	cmp    $0x1000,%rdi
+    35c1:	                                                            |     /----- 74 3d                	je     3600 <bench_queue(nel::Slice<int> const&)+0xa0>
+            } else {
+                len_ += 1;
+    35c3:	                                                            |     |      48 8d 47 01          	lea    0x1(%rdi),%rax
+    35c7:	                                                            |     |      48 89 05 b2 3a 00 00 	mov    %rax,0x3ab2(%rip)        # 7080 <queue>
+                new (ptr(wp_)) Type(move(val));
+            }
+            wp_ += 1;
+    35ce:	                                                            |  /--|----> 48 83 c1 01          	add    $0x1,%rcx
+                *ptr(wp_) = move(val);
+    35d2:	                                                            |  |  |      44 89 1a             	mov    %r11d,(%rdx)
+            if (wp_ >= capacity()) { wp_ = 0; }
+    35d5:	                                                            |  |  |      48 81 f9 00 10 00 00 	cmp    $0x1000,%rcx
+    35dc:	                                                            |  |  |      49 0f 43 c9          	cmovae %r9,%rcx
+    for (nel::Index i = 0; i < queue_len + queue_len / 2; ++i) {
+    35e0:	                                                            |  |  |      48 83 c6 01          	add    $0x1,%rsi
+    35e4:	                                                            |  |  |      48 81 fe 00 18 00 00 	cmp    $0x1800,%rsi
+    35eb:	                                                      /-----|--|--|----- 0f 84 a1 00 00 00    	je     3692 <bench_queue(nel::Slice<int> const&)+0x132>
+    35f1:	                                                      |     |  |  |      48 81 ff 00 10 00 00 	cmp    $0x1000,%rdi
+    35f8:	                                                      |     |  |  |  /-- 74 2e                	je     3628 <bench_queue(nel::Slice<int> const&)+0xc8>
+    35fa:	                                                      |     |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    35fd:	                                                      |     \--|--|--|-- eb 99                	jmp    3598 <bench_queue(nel::Slice<int> const&)+0x38>
+    35ff:	                                                      |        |  |  |   90                   	nop
+                rp_ += 1;
+    3600:	                                                      |        |  \--|-> 48 8b 05 89 3a 00 00 	mov    0x3a89(%rip),%rax        # 7090 <queue+0x10>
+    3607:	                                                      |        |     |   48 83 c0 01          	add    $0x1,%rax
+                if (rp_ >= capacity()) { rp_ = 0; }
+    360b:	                                                      |        |     |   48 3d 00 10 00 00    	cmp    $0x1000,%rax
+    3611:	                                                      |        |     |   49 0f 43 c1          	cmovae %r9,%rax
+    3615:	                                                      |        |     |   48 89 05 74 3a 00 00 	mov    %rax,0x3a74(%rip)        # 7090 <queue+0x10>
+
+        // private:
+    public:
+        // only if you know there's a value there..
+        // TODO: must have no bare pointers.. safety feature.
+        constexpr Type *ptr()
+    361c:	                                                      |        |     |   b8 00 10 00 00       	mov    $0x1000,%eax
+    3621:	                                                      |        \-----|-- eb ab                	jmp    35ce <bench_queue(nel::Slice<int> const&)+0x6e>
+    3623:	                                                      |              |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        queue.push(int(i % 1000)).unwrap();
+    3628:	                                                      |              \-> 49 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%r10
+    362f:	                                                      |                  9b c4 20 
+    3632:	                                                      |                  45 31 c9             	xor    %r9d,%r9d
+    3635:	                                                      |  /-------------> 48 89 f2             	mov    %rsi,%rdx
+    3638:	                                                      |  |               48 89 f7             	mov    %rsi,%rdi
+    363b:	                                                      |  |               48 c1 ea 03          	shr    $0x3,%rdx
+    363f:	                                                      |  |               48 89 d0             	mov    %rdx,%rax
+    3642:	                                                      |  |               49 f7 e2             	mul    %r10
+                rp_ += 1;
+    3645:	                                                      |  |               48 8b 05 44 3a 00 00 	mov    0x3a44(%rip),%rax        # 7090 <queue+0x10>
+    364c:	                                                      |  |               48 83 c0 01          	add    $0x1,%rax
+    3650:	                                                      |  |               48 c1 ea 04          	shr    $0x4,%rdx
+    3654:	                                                      |  |               48 69 d2 e8 03 00 00 	imul   $0x3e8,%rdx,%rdx
+    365b:	                                                      |  |               48 29 d7             	sub    %rdx,%rdi
+                if (rp_ >= capacity()) { rp_ = 0; }
+    365e:	                                                      |  |               48 3d 00 10 00 00    	cmp    $0x1000,%rax
+    3664:	                                                      |  |               49 0f 43 c1          	cmovae %r9,%rax
+    for (nel::Index i = 0; i < queue_len + queue_len / 2; ++i) {
+    3668:	                                                      |  |               48 83 c6 01          	add    $0x1,%rsi
+    366c:	                                                      |  |               48 89 05 1d 3a 00 00 	mov    %rax,0x3a1d(%rip)        # 7090 <queue+0x10>
+                *ptr(wp_) = move(val);
+    3673:	                                                      |  |               89 3c 8b             	mov    %edi,(%rbx,%rcx,4)
+            wp_ += 1;
+    3676:	                                                      |  |               48 83 c1 01          	add    $0x1,%rcx
+            if (wp_ >= capacity()) { wp_ = 0; }
+    367a:	                                                      |  |               48 81 f9 00 10 00 00 	cmp    $0x1000,%rcx
+    3681:	                                                      |  |  /----------- 0f 85 b9 07 00 00    	jne    3e40 <bench_queue(nel::Slice<int> const&)+0x8e0>
+    3687:	                                                      |  |  |            31 c9                	xor    %ecx,%ecx
+    3689:	                                                      |  |  |            48 81 fe 00 18 00 00 	cmp    $0x1800,%rsi
+    3690:	                                                      |  +--|----------- 75 a3                	jne    3635 <bench_queue(nel::Slice<int> const&)+0xd5>
+    3692:	                                                      >--|--|----------> 48 89 0d ef 39 00 00 	mov    %rcx,0x39ef(%rip)        # 7088 <queue+0x8>
+            if (b >= len_) { return Slice::empty(); }
+    3699:	                                                      |  |  |            49 8b 68 08          	mov    0x8(%r8),%rbp
+    369d:	                                                      |  |  |            48 85 ed             	test   %rbp,%rbp
+    36a0:	                                                      |  |  |            0f 84 2a da ff ff    	je     10d0 <bench_queue(nel::Slice<int> const&) [clone .cold]>
+    36a6:	                                                      |  |  |            b8 00 10 00 00       	mov    $0x1000,%eax
+            return Slice(&content_[b], e - b);
+    36ab:	                                                      |  |  |            4d 8b 00             	mov    (%r8),%r8
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    36ae:	                                                      |  |  |            4c 8d 6c 24 30       	lea    0x30(%rsp),%r13
+    36b3:	                                                      |  |  |            bf 01 00 00 00       	mov    $0x1,%edi
+    36b8:	                                                      |  |  |            48 39 c5             	cmp    %rax,%rbp
+    36bb:	                                                      |  |  |            4c 89 ee             	mov    %r13,%rsi
+    36be:	                                                      |  |  |            48 0f 47 e8          	cmova  %rax,%rbp
+    nel::Count const reps = n_total / s.len();
+    36c2:	                                                      |  |  |            b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    36c7:	                                                      |  |  |            31 d2                	xor    %edx,%edx
+    36c9:	                                                      |  |  |            4c 89 44 24 10       	mov    %r8,0x10(%rsp)
+    36ce:	                                                      |  |  |            48 f7 f5             	div    %rbp
+    36d1:	                                                      |  |  |            49 89 c7             	mov    %rax,%r15
+    36d4:	                                                      |  |  |            e8 77 d9 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    36d9:	                                                      |  |  |            4c 8b 44 24 10       	mov    0x10(%rsp),%r8
+    36de:	                                                      |  |  |            4c 89 ff             	mov    %r15,%rdi
+    36e1:	                                                      |  |  |            31 f6                	xor    %esi,%esi
+    36e3:	                                                      |  |  |            4c 8b 74 24 38       	mov    0x38(%rsp),%r14
+        for (nel::Index i = 0; i < reps; ++i) {
+    36e8:	                                                      |  |  |            48 c1 ef 02          	shr    $0x2,%rdi
+    36ec:	                                                      |  |  |            66 0f ef f6          	pxor   %xmm6,%xmm6
+            acc += Acc(p[i]);
+    36f0:	                                                      |  |  |            66 0f ef ed          	pxor   %xmm5,%xmm5
+    36f4:	                                                      |  |  |            48 69 44 24 30 00 ca 	imul   $0x3b9aca00,0x30(%rsp),%rax
+    36fb:	                                                      |  |  |            9a 3b 
+    36fd:	                                                      |  |  |            48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    3702:	                                                      |  |  |            48 8d 04 ad 00 00 00 	lea    0x0(,%rbp,4),%rax
+    3709:	                                                      |  |  |            00 
+    370a:	                                                      |  |  |            49 8d 0c 00          	lea    (%r8,%rax,1),%rcx
+    370e:	                                                      |  |  |            66 90                	xchg   %ax,%ax
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    3710:	                                                      |  |  |     /----> 66 0f ef db          	pxor   %xmm3,%xmm3
+    3714:	                                                      |  |  |     |      4c 89 c2             	mov    %r8,%rdx
+    3717:	                                                      |  |  |     |      66 0f 6f d3          	movdqa %xmm3,%xmm2
+    371b:	                                                      |  |  |     |      0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+            acc += Acc(p[i]);
+    3720:	                                                      |  |  |     |  /-> 66 0f 6e 3a          	movd   (%rdx),%xmm7
+    3724:	                                                      |  |  |     |  |   66 0f 6f cd          	movdqa %xmm5,%xmm1
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    3728:	                                                      |  |  |     |  |   48 83 c2 04          	add    $0x4,%rdx
+            acc += Acc(p[i]);
+    372c:	                                                      |  |  |     |  |   66 0f 70 c7 00       	pshufd $0x0,%xmm7,%xmm0
+    3731:	                                                      |  |  |     |  |   66 0f 66 c8          	pcmpgtd %xmm0,%xmm1
+    3735:	                                                      |  |  |     |  |   66 0f 6f e0          	movdqa %xmm0,%xmm4
+    3739:	                                                      |  |  |     |  |   66 0f 62 e1          	punpckldq %xmm1,%xmm4
+    373d:	                                                      |  |  |     |  |   66 0f 6a c1          	punpckhdq %xmm1,%xmm0
+    3741:	                                                      |  |  |     |  |   66 0f d4 d4          	paddq  %xmm4,%xmm2
+    3745:	                                                      |  |  |     |  |   66 0f d4 d8          	paddq  %xmm0,%xmm3
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    3749:	                                                      |  |  |     |  |   48 39 d1             	cmp    %rdx,%rcx
+    374c:	                                                      |  |  |     |  \-- 75 d2                	jne    3720 <bench_queue(nel::Slice<int> const&)+0x1c0>
+            r += f(s);
+    374e:	                                                      |  |  |     |      66 0f d4 d3          	paddq  %xmm3,%xmm2
+    3752:	                                                      |  |  |     |      83 c6 01             	add    $0x1,%esi
+    3755:	                                                      |  |  |     |      66 0f d4 f2          	paddq  %xmm2,%xmm6
+        for (nel::Index i = 0; i < reps; ++i) {
+    3759:	                                                      |  |  |     |      39 f7                	cmp    %esi,%edi
+    375b:	                                                      |  |  |     \----- 75 b3                	jne    3710 <bench_queue(nel::Slice<int> const&)+0x1b0>
+    375d:	                                                      |  |  |            66 0f 6f c6          	movdqa %xmm6,%xmm0
+    3761:	                                                      |  |  |            4c 89 ff             	mov    %r15,%rdi
+    3764:	                                                      |  |  |            66 0f 73 d8 08       	psrldq $0x8,%xmm0
+    3769:	                                                      |  |  |            48 83 e7 fc          	and    $0xfffffffffffffffc,%rdi
+    376d:	                                                      |  |  |            66 0f d4 f0          	paddq  %xmm0,%xmm6
+    3771:	                                                      |  |  |            66 49 0f 7e f4       	movq   %xmm6,%r12
+    3776:	                                                      |  |  |            41 f6 c7 03          	test   $0x3,%r15b
+    377a:	                                                      |  |  |  /-------- 74 27                	je     37a3 <bench_queue(nel::Slice<int> const&)+0x243>
+    377c:	                                                      |  |  |  |         4c 01 c0             	add    %r8,%rax
+    377f:	                                                      |  |  |  |         90                   	nop
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    3780:	                                                      |  |  |  |  /----> 4c 89 c2             	mov    %r8,%rdx
+        Acc acc = 0;
+    3783:	                                                      |  |  |  |  |      31 c9                	xor    %ecx,%ecx
+    3785:	                                                      |  |  |  |  |      0f 1f 00             	nopl   (%rax)
+            acc += Acc(p[i]);
+    3788:	                                                      |  |  |  |  |  /-> 48 63 32             	movslq (%rdx),%rsi
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    378b:	                                                      |  |  |  |  |  |   48 83 c2 04          	add    $0x4,%rdx
+            acc += Acc(p[i]);
+    378f:	                                                      |  |  |  |  |  |   48 01 f1             	add    %rsi,%rcx
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    3792:	                                                      |  |  |  |  |  |   48 39 d0             	cmp    %rdx,%rax
+    3795:	                                                      |  |  |  |  |  \-- 75 f1                	jne    3788 <bench_queue(nel::Slice<int> const&)+0x228>
+        for (nel::Index i = 0; i < reps; ++i) {
+    3797:	                                                      |  |  |  |  |      48 83 c7 01          	add    $0x1,%rdi
+            r += f(s);
+    379b:	                                                      |  |  |  |  |      49 01 cc             	add    %rcx,%r12
+        for (nel::Index i = 0; i < reps; ++i) {
+    379e:	                                                      |  |  |  |  |      4c 39 ff             	cmp    %r15,%rdi
+    37a1:	                                                      |  |  |  |  \----- 72 dd                	jb     3780 <bench_queue(nel::Slice<int> const&)+0x220>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    37a3:	                                                      |  |  |  \-------> 4c 89 ee             	mov    %r13,%rsi
+    bench::report_per_item(name, t, reps * s.len());
+    37a6:	                                                      |  |  |            49 0f af ef          	imul   %r15,%rbp
+    37aa:	                                                      |  |  |            bf 01 00 00 00       	mov    $0x1,%edi
+    37af:	                                                      |  |  |            e8 9c d8 ff ff       	call   1050 <clock_gettime@plt>
+    sink = sink + r;
+    37b4:	                                                      |  |  |            48 8b 05 dd 78 00 00 	mov    0x78dd(%rip),%rax        # b098 <sink>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    37bb:	                                                      |  |  |            31 d2                	xor    %edx,%edx
+    return now_ns() - b;
+    37bd:	                                                      |  |  |            48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+             << "ns/item\n";
+    37c2:	                                                      |  |  |            48 8d 35 7a 19 00 00 	lea    0x197a(%rip),%rsi        # 5143 <_IO_stdin_used+0x143>
+    37c9:	                                                      |  |  |            4c 01 e0             	add    %r12,%rax
+    37cc:	                                                      |  |  |            48 89 05 c5 78 00 00 	mov    %rax,0x78c5(%rip)        # b098 <sink>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    37d3:	                                                      |  |  |            48 69 44 24 30 00 ca 	imul   $0x3b9aca00,0x30(%rsp),%rax
+    37da:	                                                      |  |  |            9a 3b 
+    return now_ns() - b;
+    37dc:	                                                      |  |  |            4c 29 f0             	sub    %r14,%rax
+    37df:	                                                      |  |  |            48 03 44 24 38       	add    0x38(%rsp),%rax
+    37e4:	                                                      |  |  |            48 29 f8             	sub    %rdi,%rax
+             << "ns/item\n";
+    37e7:	                                                      |  |  |            48 8d 3d b2 78 00 00 	lea    0x78b2(%rip),%rdi        # b0a0 <nel::log>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    37ee:	                                                      |  |  |            48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    37f2:	                                                      |  |  |            48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    37f6:	                                                      |  |  |            48 c1 e0 02          	shl    $0x2,%rax
+    37fa:	                                                      |  |  |            48 f7 f5             	div    %rbp
+    long unsigned int const frac = cns % 100UL;
+    37fd:	                                                      |  |  |            48 89 c2             	mov    %rax,%rdx
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    3800:	                                                      |  |  |            48 89 c1             	mov    %rax,%rcx
+    long unsigned int const frac = cns % 100UL;
+    3803:	                                                      |  |  |            48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    380a:	                                                      |  |  |            c2 f5 28 
+    380d:	                                                      |  |  |            48 c1 ea 02          	shr    $0x2,%rdx
+    3811:	                                                      |  |  |            48 f7 e2             	mul    %rdx
+    3814:	                                                      |  |  |            48 c1 ea 02          	shr    $0x2,%rdx
+    3818:	                                                      |  |  |            48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+    381c:	                                                      |  |  |            49 89 d4             	mov    %rdx,%r12
+    381f:	                                                      |  |  |            48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    3823:	                                                      |  |  |            48 c1 e0 02          	shl    $0x2,%rax
+    3827:	                                                      |  |  |            48 29 c1             	sub    %rax,%rcx
+    382a:	                                                      |  |  |            48 89 cd             	mov    %rcx,%rbp
+             << "ns/item\n";
+    382d:	                                                      |  |  |            e8 ce 0a 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    3832:	                                                      |  |  |            48 8d 35 d6 19 00 00 	lea    0x19d6(%rip),%rsi        # 520f <_IO_stdin_used+0x20f>
+    3839:	                                                      |  |  |            48 89 c7             	mov    %rax,%rdi
+    383c:	                                                      |  |  |            e8 bf 0a 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    3841:	                                                      |  |  |            4c 89 e6             	mov    %r12,%rsi
+    3844:	                                                      |  |  |            48 89 c7             	mov    %rax,%rdi
+    3847:	                                                      |  |  |            e8 74 0b 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    384c:	                                                      |  |  |            be 2e 00 00 00       	mov    $0x2e,%esi
+    3851:	                                                      |  |  |            48 89 c7             	mov    %rax,%rdi
+    3854:	                                                      |  |  |            e8 87 0a 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    3859:	                                                      |  |  |            48 83 fd 0a          	cmp    $0xa,%rbp
+    385d:	                                                      |  |  |            48 8d 35 a0 17 00 00 	lea    0x17a0(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    3864:	                                                      |  |  |            48 89 c7             	mov    %rax,%rdi
+    3867:	                                                      |  |  |            48 8d 05 9c 19 00 00 	lea    0x199c(%rip),%rax        # 520a <_IO_stdin_used+0x20a>
+    386e:	                                                      |  |  |            48 0f 43 f0          	cmovae %rax,%rsi
+    3872:	                                                      |  |  |            e8 89 0a 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    3877:	                                                      |  |  |            48 89 ee             	mov    %rbp,%rsi
+    Acc r = 0;
+    387a:	                                                      |  |  |            31 ed                	xor    %ebp,%ebp
+    387c:	                                                      |  |  |            48 89 c7             	mov    %rax,%rdi
+    387f:	                                                      |  |  |            e8 3c 0b 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    3884:	                                                      |  |  |            48 8d 35 97 17 00 00 	lea    0x1797(%rip),%rsi        # 5022 <_IO_stdin_used+0x22>
+    388b:	                                                      |  |  |            48 89 c7             	mov    %rax,%rdi
+    388e:	                                                      |  |  |            e8 6d 0a 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    3893:	                                                      |  |  |            bf 01 00 00 00       	mov    $0x1,%edi
+    3898:	                                                      |  |  |            4c 89 ee             	mov    %r13,%rsi
+    389b:	                                                      |  |  |            e8 b0 d7 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    38a0:	                                                      |  |  |            48 8b 54 24 30       	mov    0x30(%rsp),%rdx
+    38a5:	                                                      |  |  |            4c 8b 7c 24 38       	mov    0x38(%rsp),%r15
+    38aa:	                                                      |  |  |            4c 89 6c 24 20       	mov    %r13,0x20(%rsp)
+            return len_;
+    38af:	                                                      |  |  |            48 8b 05 ca 37 00 00 	mov    0x37ca(%rip),%rax        # 7080 <queue>
+        {
+            if (len() == 0) {
+                auto s1 = Slice<Type>::empty();
+                auto s2 = s1;
+                return QueueIteratorMut(s1.iter(), s2.iter());
+            } else if (rp_ < wp_) {
+    38b6:	                                                      |  |  |            4c 8b 1d d3 37 00 00 	mov    0x37d3(%rip),%r11        # 7090 <queue+0x10>
+    38bd:	                                                      |  |  |            4c 8b 15 c4 37 00 00 	mov    0x37c4(%rip),%r10        # 7088 <queue+0x8>
+    38c4:	                                                      |  |  |            48 89 54 24 10       	mov    %rdx,0x10(%rsp)
+    38c9:	                                                      |  |  |            4c 89 7c 24 18       	mov    %r15,0x18(%rsp)
+            return &ptr()[d];
+    38ce:	                                                      |  |  |            4a 8d 3c 9d 00 00 00 	lea    0x0(,%r11,4),%rdi
+    38d5:	                                                      |  |  |            00 
+    38d6:	                                                      |  |  |            48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    38db:	                                                      |  |  |            4e 8d 34 95 00 00 00 	lea    0x0(,%r10,4),%r14
+    38e2:	                                                      |  |  |            00 
+    38e3:	                                                      |  |  |            4c 8d 0c 3b          	lea    (%rbx,%rdi,1),%r9
+    38e7:	                                                      |  |  |            48 89 7c 24 08       	mov    %rdi,0x8(%rsp)
+            , e_(arr + len)
+    38ec:	                                                      |  |  |            4e 8d 24 33          	lea    (%rbx,%r14,1),%r12
+    38f0:	                                                      |  |  |            bf 09 3d 00 00       	mov    $0x3d09,%edi
+            if (len() == 0) {
+    38f5:	                                                      |  |  |        /-> 48 83 7c 24 28 00    	cmpq   $0x0,0x28(%rsp)
+        q.iter().for_each([&acc](int const &e) { acc += Acc(e); });
+    38fb:	                                                      |  |  |        |   66 0f ef e4          	pxor   %xmm4,%xmm4
+            if (b_ == e_) { return None; }
+    38ff:	                                                      |  |  |        |   4c 8d 2d 92 77 00 00 	lea    0x7792(%rip),%r13        # b098 <sink>
+    3906:	/-----------------------------------------------------|--|--|--------|-- 0f 85 59 05 00 00    	jne    3e65 <bench_queue(nel::Slice<int> const&)+0x905>
+        Acc acc = 0;
+    390c:	|                                                     |  |  |        |   31 d2                	xor    %edx,%edx
+            r += f(queue);
+    390e:	|                                               /-----|--|--|--------|-> 48 01 d5             	add    %rdx,%rbp
+        for (nel::Index i = 0; i < reps; ++i) {
+    3911:	|                                               |     |  |  |        |   48 83 ef 01          	sub    $0x1,%rdi
+    3915:	|                                               |     |  |  |        \-- 75 de                	jne    38f5 <bench_queue(nel::Slice<int> const&)+0x395>
+    3917:	|  /--------------------------------------------|-----|--|--|----------> 4c 8b 6c 24 20       	mov    0x20(%rsp),%r13
+    391c:	|  |                                            |     |  |  |            48 8b 54 24 10       	mov    0x10(%rsp),%rdx
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    3921:	|  |                                            |     |  |  |            bf 01 00 00 00       	mov    $0x1,%edi
+    3926:	|  |                                            |     |  |  |            4c 8b 7c 24 18       	mov    0x18(%rsp),%r15
+    392b:	|  |                                            |     |  |  |            4c 89 ee             	mov    %r13,%rsi
+    392e:	|  |                                            |     |  |  |            48 89 54 24 08       	mov    %rdx,0x8(%rsp)
+    3933:	|  |                                            |     |  |  |            e8 18 d7 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    3938:	|  |                                            |     |  |  |            48 8b 54 24 08       	mov    0x8(%rsp),%rdx
+    393d:	|  |                                            |     |  |  |            48 69 44 24 30 00 ca 	imul   $0x3b9aca00,0x30(%rsp),%rax
+    3944:	|  |                                            |     |  |  |            9a 3b 
+             << "ns/item\n";
+    3946:	|  |                                            |     |  |  |            48 8d 35 12 18 00 00 	lea    0x1812(%rip),%rsi        # 515f <_IO_stdin_used+0x15f>
+    sink = sink + r;
+    394d:	|  |                                            |     |  |  |            48 8b 0d 44 77 00 00 	mov    0x7744(%rip),%rcx        # b098 <sink>
+    3954:	|  |                                            |     |  |  |            48 8d 3d 45 77 00 00 	lea    0x7745(%rip),%rdi        # b0a0 <nel::log>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    395b:	|  |                                            |     |  |  |            48 69 d2 00 ca 9a 3b 	imul   $0x3b9aca00,%rdx,%rdx
+    3962:	|  |                                            |     |  |  |            4c 29 f8             	sub    %r15,%rax
+    return now_ns() - b;
+    3965:	|  |                                            |     |  |  |            48 03 44 24 38       	add    0x38(%rsp),%rax
+    396a:	|  |                                            |     |  |  |            48 01 e9             	add    %rbp,%rcx
+    396d:	|  |                                            |     |  |  |            48 89 0d 24 77 00 00 	mov    %rcx,0x7724(%rip)        # b098 <sink>
+    3974:	|  |                                            |     |  |  |            48 29 d0             	sub    %rdx,%rax
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    3977:	|  |                                            |     |  |  |            48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    397b:	|  |                                            |     |  |  |            48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+    397f:	|  |                                            |     |  |  |            48 b8 db 34 b6 d7 82 	movabs $0x431bde82d7b634db,%rax
+    3986:	|  |                                            |     |  |  |            de 1b 43 
+    3989:	|  |                                            |     |  |  |            48 c1 e2 02          	shl    $0x2,%rdx
+    398d:	|  |                                            |     |  |  |            48 f7 e2             	mul    %rdx
+    long unsigned int const frac = cns % 100UL;
+    3990:	|  |                                            |     |  |  |            48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    3997:	|  |                                            |     |  |  |            c2 f5 28 
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    399a:	|  |                                            |     |  |  |            48 89 d1             	mov    %rdx,%rcx
+    long unsigned int const frac = cns % 100UL;
+    399d:	|  |                                            |     |  |  |            48 c1 ea 1a          	shr    $0x1a,%rdx
+    39a1:	|  |                                            |     |  |  |            48 f7 e2             	mul    %rdx
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    39a4:	|  |                                            |     |  |  |            48 c1 e9 18          	shr    $0x18,%rcx
+    long unsigned int const frac = cns % 100UL;
+    39a8:	|  |                                            |     |  |  |            48 c1 ea 02          	shr    $0x2,%rdx
+    39ac:	|  |                                            |     |  |  |            48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+    39b0:	|  |                                            |     |  |  |            49 89 d4             	mov    %rdx,%r12
+    39b3:	|  |                                            |     |  |  |            48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    39b7:	|  |                                            |     |  |  |            48 c1 e0 02          	shl    $0x2,%rax
+    39bb:	|  |                                            |     |  |  |            48 29 c1             	sub    %rax,%rcx
+    39be:	|  |                                            |     |  |  |            48 89 cd             	mov    %rcx,%rbp
+             << "ns/item\n";
+    39c1:	|  |                                            |     |  |  |            e8 3a 09 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    39c6:	|  |                                            |     |  |  |            48 8d 35 42 18 00 00 	lea    0x1842(%rip),%rsi        # 520f <_IO_stdin_used+0x20f>
+    39cd:	|  |                                            |     |  |  |            48 89 c7             	mov    %rax,%rdi
+    39d0:	|  |                                            |     |  |  |            e8 2b 09 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    39d5:	|  |                                            |     |  |  |            4c 89 e6             	mov    %r12,%rsi
+    39d8:	|  |                                            |     |  |  |            48 89 c7             	mov    %rax,%rdi
+    39db:	|  |                                            |     |  |  |            e8 e0 09 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    39e0:	|  |                                            |     |  |  |            be 2e 00 00 00       	mov    $0x2e,%esi
+    39e5:	|  |                                            |     |  |  |            48 89 c7             	mov    %rax,%rdi
+    39e8:	|  |                                            |     |  |  |            e8 f3 08 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    39ed:	|  |                                            |     |  |  |            48 83 fd 0a          	cmp    $0xa,%rbp
+    39f1:	|  |                                            |     |  |  |            48 8d 35 0c 16 00 00 	lea    0x160c(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    39f8:	|  |                                            |     |  |  |            48 89 c7             	mov    %rax,%rdi
+    39fb:	|  |                                            |     |  |  |            48 8d 05 08 18 00 00 	lea    0x1808(%rip),%rax        # 520a <_IO_stdin_used+0x20a>
+    3a02:	|  |                                            |     |  |  |            48 0f 43 f0          	cmovae %rax,%rsi
+    3a06:	|  |                                            |     |  |  |            e8 f5 08 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    3a0b:	|  |                                            |     |  |  |            48 89 ee             	mov    %rbp,%rsi
+    Acc r = 0;
+    3a0e:	|  |                                            |     |  |  |            31 ed                	xor    %ebp,%ebp
+    3a10:	|  |                                            |     |  |  |            48 89 c7             	mov    %rax,%rdi
+    3a13:	|  |                                            |     |  |  |            e8 a8 09 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    3a18:	|  |                                            |     |  |  |            48 8d 35 03 16 00 00 	lea    0x1603(%rip),%rsi        # 5022 <_IO_stdin_used+0x22>
+    3a1f:	|  |                                            |     |  |  |            48 89 c7             	mov    %rax,%rdi
+    3a22:	|  |                                            |     |  |  |            e8 d9 08 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    3a27:	|  |                                            |     |  |  |            bf 01 00 00 00       	mov    $0x1,%edi
+    3a2c:	|  |                                            |     |  |  |            4c 89 ee             	mov    %r13,%rsi
+    3a2f:	|  |                                            |     |  |  |            e8 1c d6 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    3a34:	|  |                                            |     |  |  |            48 8b 44 24 30       	mov    0x30(%rsp),%rax
+    3a39:	|  |                                            |     |  |  |            48 8b 54 24 38       	mov    0x38(%rsp),%rdx
+            } else if (rp_ < wp_) {
+    3a3e:	|  |                                            |     |  |  |            4c 8b 35 4b 36 00 00 	mov    0x364b(%rip),%r14        # 7090 <queue+0x10>
+    3a45:	|  |                                            |     |  |  |            4c 8b 25 3c 36 00 00 	mov    0x363c(%rip),%r12        # 7088 <queue+0x8>
+    3a4c:	|  |                                            |     |  |  |            48 89 44 24 20       	mov    %rax,0x20(%rsp)
+            return len_;
+    3a51:	|  |                                            |     |  |  |            48 8b 05 28 36 00 00 	mov    0x3628(%rip),%rax        # 7080 <queue>
+            return &ptr()[d];
+    3a58:	|  |                                            |     |  |  |            4a 8d 3c b5 00 00 00 	lea    0x0(,%r14,4),%rdi
+    3a5f:	|  |                                            |     |  |  |            00 
+    3a60:	|  |                                            |     |  |  |            48 89 54 24 08       	mov    %rdx,0x8(%rsp)
+    3a65:	|  |                                            |     |  |  |            4c 89 ea             	mov    %r13,%rdx
+    3a68:	|  |                                            |     |  |  |            48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    3a6d:	|  |                                            |     |  |  |            4c 8d 0c 3b          	lea    (%rbx,%rdi,1),%r9
+    3a71:	|  |                                            |     |  |  |            48 89 7c 24 10       	mov    %rdi,0x10(%rsp)
+    3a76:	|  |                                            |     |  |  |            4a 8d 3c a5 00 00 00 	lea    0x0(,%r12,4),%rdi
+    3a7d:	|  |                                            |     |  |  |            00 
+    3a7e:	|  |                                            |     |  |  |            48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+            , e_(arr + len)
+    3a83:	|  |                                            |     |  |  |            4c 8d 3c 3b          	lea    (%rbx,%rdi,1),%r15
+    3a87:	|  |                                            |     |  |  |            bf 09 3d 00 00       	mov    $0x3d09,%edi
+            if (len() == 0) {
+    3a8c:	|  |                                            |     |  |  |        /-> 48 83 7c 24 28 00    	cmpq   $0x0,0x28(%rsp)
+            .map<Acc>([](int const &e) -> Acc { return Acc(e); })
+    3a92:	|  |                                            |     |  |  |        |   66 0f ef e4          	pxor   %xmm4,%xmm4
+            if (b_ == e_) { return None; }
+    3a96:	|  |                                            |     |  |  |        |   4c 8d 1d fb 75 00 00 	lea    0x75fb(%rip),%r11        # b098 <sink>
+    3a9d:	|  |     /--------------------------------------|-----|--|--|--------|-- 0f 85 68 06 00 00    	jne    410b <bench_queue(nel::Slice<int> const&)+0xbab>
+            U acc = move(initial);
+    3aa3:	|  |     |                                      |     |  |  |        |   31 c9                	xor    %ecx,%ecx
+            r += f(queue);
+    3aa5:	|  |     |                                      |  /--|--|--|--------|-> 48 01 cd             	add    %rcx,%rbp
+        for (nel::Index i = 0; i < reps; ++i) {
+    3aa8:	|  |     |                                      |  |  |  |  |        |   48 83 ef 01          	sub    $0x1,%rdi
+    3aac:	|  |     |                                      |  |  |  |  |        \-- 75 de                	jne    3a8c <bench_queue(nel::Slice<int> const&)+0x52c>
+    3aae:	|  |  /--|--------------------------------------|--|--|--|--|----------> 49 89 d5             	mov    %rdx,%r13
+    3ab1:	|  |  |  |                                      |  |  |  |  |            48 8b 54 24 08       	mov    0x8(%rsp),%rdx
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    3ab6:	|  |  |  |                                      |  |  |  |  |            bf 01 00 00 00       	mov    $0x1,%edi
+    3abb:	|  |  |  |                                      |  |  |  |  |            4c 89 ee             	mov    %r13,%rsi
+    3abe:	|  |  |  |                                      |  |  |  |  |            48 89 54 24 08       	mov    %rdx,0x8(%rsp)
+    3ac3:	|  |  |  |                                      |  |  |  |  |            e8 88 d5 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    3ac8:	|  |  |  |                                      |  |  |  |  |            48 8b 54 24 08       	mov    0x8(%rsp),%rdx
+    3acd:	|  |  |  |                                      |  |  |  |  |            48 69 44 24 30 00 ca 	imul   $0x3b9aca00,0x30(%rsp),%rax
+    3ad4:	|  |  |  |                                      |  |  |  |  |            9a 3b 
+             << "ns/item\n";
+    3ad6:	|  |  |  |                                      |  |  |  |  |            48 8d 35 9e 16 00 00 	lea    0x169e(%rip),%rsi        # 517b <_IO_stdin_used+0x17b>
+    3add:	|  |  |  |                                      |  |  |  |  |            48 8d 3d bc 75 00 00 	lea    0x75bc(%rip),%rdi        # b0a0 <nel::log>
+    3ae4:	|  |  |  |                                      |  |  |  |  |            48 29 d0             	sub    %rdx,%rax
+    sink = sink + r;
+    3ae7:	|  |  |  |                                      |  |  |  |  |            48 8b 15 aa 75 00 00 	mov    0x75aa(%rip),%rdx        # b098 <sink>
+    return now_ns() - b;
+    3aee:	|  |  |  |                                      |  |  |  |  |            48 03 44 24 38       	add    0x38(%rsp),%rax
+    3af3:	|  |  |  |                                      |  |  |  |  |            48 01 ea             	add    %rbp,%rdx
+    3af6:	|  |  |  |                                      |  |  |  |  |            48 89 15 9b 75 00 00 	mov    %rdx,0x759b(%rip)        # b098 <sink>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    3afd:	|  |  |  |                                      |  |  |  |  |            48 69 54 24 20 00 ca 	imul   $0x3b9aca00,0x20(%rsp),%rdx
+    3b04:	|  |  |  |                                      |  |  |  |  |            9a 3b 
+    return now_ns() - b;
+    3b06:	|  |  |  |                                      |  |  |  |  |            48 29 d0             	sub    %rdx,%rax
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    3b09:	|  |  |  |                                      |  |  |  |  |            48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    3b0d:	|  |  |  |                                      |  |  |  |  |            48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+    3b11:	|  |  |  |                                      |  |  |  |  |            48 b8 db 34 b6 d7 82 	movabs $0x431bde82d7b634db,%rax
+    3b18:	|  |  |  |                                      |  |  |  |  |            de 1b 43 
+    3b1b:	|  |  |  |                                      |  |  |  |  |            48 c1 e2 02          	shl    $0x2,%rdx
+    3b1f:	|  |  |  |                                      |  |  |  |  |            48 f7 e2             	mul    %rdx
+    long unsigned int const frac = cns % 100UL;
+    3b22:	|  |  |  |                                      |  |  |  |  |            48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    3b29:	|  |  |  |                                      |  |  |  |  |            c2 f5 28 
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    3b2c:	|  |  |  |                                      |  |  |  |  |            48 89 d1             	mov    %rdx,%rcx
+    long unsigned int const frac = cns % 100UL;
+    3b2f:	|  |  |  |                                      |  |  |  |  |            48 c1 ea 1a          	shr    $0x1a,%rdx
+    3b33:	|  |  |  |                                      |  |  |  |  |            48 f7 e2             	mul    %rdx
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    3b36:	|  |  |  |                                      |  |  |  |  |            48 c1 e9 18          	shr    $0x18,%rcx
+    long unsigned int const frac = cns % 100UL;
+    3b3a:	|  |  |  |                                      |  |  |  |  |            48 c1 ea 02          	shr    $0x2,%rdx
+    3b3e:	|  |  |  |                                      |  |  |  |  |            48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+    3b42:	|  |  |  |                                      |  |  |  |  |            49 89 d4             	mov    %rdx,%r12
+    3b45:	|  |  |  |                                      |  |  |  |  |            48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    3b49:	|  |  |  |                                      |  |  |  |  |            48 c1 e0 02          	shl    $0x2,%rax
+    3b4d:	|  |  |  |                                      |  |  |  |  |            48 29 c1             	sub    %rax,%rcx
+    3b50:	|  |  |  |                                      |  |  |  |  |            48 89 cd             	mov    %rcx,%rbp
+             << "ns/item\n";
+    3b53:	|  |  |  |                                      |  |  |  |  |            e8 a8 07 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    3b58:	|  |  |  |                                      |  |  |  |  |            48 8d 35 b0 16 00 00 	lea    0x16b0(%rip),%rsi        # 520f <_IO_stdin_used+0x20f>
+    3b5f:	|  |  |  |                                      |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    3b62:	|  |  |  |                                      |  |  |  |  |            e8 99 07 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    3b67:	|  |  |  |                                      |  |  |  |  |            4c 89 e6             	mov    %r12,%rsi
+    3b6a:	|  |  |  |                                      |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    3b6d:	|  |  |  |                                      |  |  |  |  |            e8 4e 08 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    3b72:	|  |  |  |                                      |  |  |  |  |            be 2e 00 00 00       	mov    $0x2e,%esi
+    3b77:	|  |  |  |                                      |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    3b7a:	|  |  |  |                                      |  |  |  |  |            e8 61 07 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    3b7f:	|  |  |  |                                      |  |  |  |  |            48 83 fd 0a          	cmp    $0xa,%rbp
+    3b83:	|  |  |  |                                      |  |  |  |  |            48 8d 35 7a 14 00 00 	lea    0x147a(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    3b8a:	|  |  |  |                                      |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    3b8d:	|  |  |  |                                      |  |  |  |  |            48 8d 05 76 16 00 00 	lea    0x1676(%rip),%rax        # 520a <_IO_stdin_used+0x20a>
+    3b94:	|  |  |  |                                      |  |  |  |  |            48 0f 43 f0          	cmovae %rax,%rsi
+    3b98:	|  |  |  |                                      |  |  |  |  |            e8 63 07 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    3b9d:	|  |  |  |                                      |  |  |  |  |            48 89 ee             	mov    %rbp,%rsi
+    3ba0:	|  |  |  |                                      |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    3ba3:	|  |  |  |                                      |  |  |  |  |            e8 18 08 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    3ba8:	|  |  |  |                                      |  |  |  |  |            48 8d 35 73 14 00 00 	lea    0x1473(%rip),%rsi        # 5022 <_IO_stdin_used+0x22>
+    3baf:	|  |  |  |                                      |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    3bb2:	|  |  |  |                                      |  |  |  |  |            e8 49 07 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    3bb7:	|  |  |  |                                      |  |  |  |  |            4c 89 ee             	mov    %r13,%rsi
+    3bba:	|  |  |  |                                      |  |  |  |  |            bf 01 00 00 00       	mov    $0x1,%edi
+    3bbf:	|  |  |  |                                      |  |  |  |  |            e8 8c d4 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    3bc4:	|  |  |  |                                      |  |  |  |  |            48 8b 6c 24 38       	mov    0x38(%rsp),%rbp
+            , e_(move(o.e_))
+    3bc9:	|  |  |  |                                      |  |  |  |  |            45 31 c9             	xor    %r9d,%r9d
+    3bcc:	|  |  |  |                                      |  |  |  |  |            48 69 4c 24 30 00 ca 	imul   $0x3b9aca00,0x30(%rsp),%rcx
+    3bd3:	|  |  |  |                                      |  |  |  |  |            9a 3b 
+            } else if (rp_ < wp_) {
+    3bd5:	|  |  |  |                                      |  |  |  |  |            4c 8b 35 b4 34 00 00 	mov    0x34b4(%rip),%r14        # 7090 <queue+0x10>
+            , e_(arr + len)
+    3bdc:	|  |  |  |                                      |  |  |  |  |            41 b8 09 3d 00 00    	mov    $0x3d09,%r8d
+            acc += Acc(*it);
+    3be2:	|  |  |  |                                      |  |  |  |  |            66 0f ef e4          	pxor   %xmm4,%xmm4
+    3be6:	|  |  |  |                                      |  |  |  |  |            4c 8b 25 9b 34 00 00 	mov    0x349b(%rip),%r12        # 7088 <queue+0x8>
+    3bed:	|  |  |  |                                      |  |  |  |  |            48 89 6c 24 10       	mov    %rbp,0x10(%rsp)
+            return len_;
+    3bf2:	|  |  |  |                                      |  |  |  |  |            48 8b 05 87 34 00 00 	mov    0x3487(%rip),%rax        # 7080 <queue>
+            return &ptr()[d];
+    3bf9:	|  |  |  |                                      |  |  |  |  |            4e 8d 3c b3          	lea    (%rbx,%r14,4),%r15
+    3bfd:	|  |  |  |                                      |  |  |  |  |            4e 8d 14 a3          	lea    (%rbx,%r12,4),%r10
+    3c01:	|  |  |  |                                      |  |  |  |  |            48 89 4c 24 08       	mov    %rcx,0x8(%rsp)
+    Acc r = 0;
+    3c06:	|  |  |  |                                      |  |  |  |  |            31 db                	xor    %ebx,%ebx
+    3c08:	|  |  |  |                                      |  |  |  |  |        /-- eb 13                	jmp    3c1d <bench_queue(nel::Slice<int> const&)+0x6bd>
+    3c0a:	|  |  |  |                                      |  |  |  |  |        |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+            r += f(queue);
+    3c10:	|  |  |  |                                      |  |  |  |  |  /-----|-> 48 01 cb             	add    %rcx,%rbx
+        for (nel::Index i = 0; i < reps; ++i) {
+    3c13:	|  |  |  |                                      |  |  |  |  |  |     |   49 83 e8 01          	sub    $0x1,%r8
+    3c17:	|  |  |  |  /-----------------------------------|--|--|--|--|--|-----|-- 0f 84 10 01 00 00    	je     3d2d <bench_queue(nel::Slice<int> const&)+0x7cd>
+        constexpr Length len(void) const
+    3c1d:	|  |  |  |  |                                   |  |  |  |  |  |     \-> 31 c9                	xor    %ecx,%ecx
+            if (len() == 0) {
+    3c1f:	|  |  |  |  |                                   |  |  |  |  |  |         48 85 c0             	test   %rax,%rax
+    3c22:	|  |  |  |  |                                   |  |  |  |  |  +-------- 74 ec                	je     3c10 <bench_queue(nel::Slice<int> const&)+0x6b0>
+            , e_(move(o.e_))
+    3c24:	|  |  |  |  |  /--------------------------------|--|--|--|--|--|-------> 4d 39 e6             	cmp    %r12,%r14
+    3c27:	|  |  |  |  |  |                                |  |  |  |  |  |         4d 89 cb             	mov    %r9,%r11
+    3c2a:	|  |  |  |  |  |                                |  |  |  |  |  |         48 8d 3d 67 34 00 00 	lea    0x3467(%rip),%rdi        # 7098 <queue+0x18>
+            return it1_.is_done() && it2_.is_done();
+    3c31:	|  |  |  |  |  |                                |  |  |  |  |  |         4c 89 fa             	mov    %r15,%rdx
+    3c34:	|  |  |  |  |  |                                |  |  |  |  |  |         48 8d 2d 5d 74 00 00 	lea    0x745d(%rip),%rbp        # b098 <sink>
+    3c3b:	|  |  |  |  |  |                                |  |  |  |  |  |         4d 0f 43 da          	cmovae %r10,%r11
+    3c3f:	|  |  |  |  |  |                                |  |  |  |  |  |         49 0f 42 f9          	cmovb  %r9,%rdi
+    3c43:	|  |  |  |  |  |                                |  |  |  |  |  |         49 0f 42 ea          	cmovb  %r10,%rbp
+    3c47:	|  |  |  |  |  |                                |  |  |  |  |  |         31 c9                	xor    %ecx,%ecx
+    3c49:	|  |  |  |  |  |                                |  |  |  |  |  |  /----- eb 0f                	jmp    3c5a <bench_queue(nel::Slice<int> const&)+0x6fa>
+    3c4b:	|  |  |  |  |  |                                |  |  |  |  |  |  |      0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+            acc += Acc(*it);
+    3c50:	|  |  |  |  |  |                                |  |  |  |  |  |  |  /-> 48 63 32             	movslq (%rdx),%rsi
+            ++b_;
+    3c53:	|  |  |  |  |  |                                |  |  |  |  |  |  |  |   48 83 c2 04          	add    $0x4,%rdx
+    3c57:	|  |  |  |  |  |                                |  |  |  |  |  |  |  |   48 01 f1             	add    %rsi,%rcx
+    3c5a:	|  |  |  |  |  |                                |  |  |  |  |  |  \--|-> 48 39 ea             	cmp    %rbp,%rdx
+    3c5d:	|  |  |  |  |  |                                |  |  |  |  |  |     \-- 75 f1                	jne    3c50 <bench_queue(nel::Slice<int> const&)+0x6f0>
+    3c5f:	|  |  |  |  |  |                                |  |  |  |  |  |         4c 39 df             	cmp    %r11,%rdi
+    3c62:	|  |  |  |  |  |                                |  |  |  |  |  +-------- 74 ac                	je     3c10 <bench_queue(nel::Slice<int> const&)+0x6b0>
+    3c64:	|  |  |  |  |  |                                |  |  |  |  |  |         48 63 17             	movslq (%rdi),%rdx
+    3c67:	|  |  |  |  |  |                                |  |  |  |  |  |         48 83 c7 04          	add    $0x4,%rdi
+    3c6b:	|  |  |  |  |  |                                |  |  |  |  |  |         48 01 d1             	add    %rdx,%rcx
+    3c6e:	|  |  |  |  |  |                                |  |  |  |  |  |         4c 39 df             	cmp    %r11,%rdi
+    3c71:	|  |  |  |  |  |                                |  |  |  |  |  \-------- 74 9d                	je     3c10 <bench_queue(nel::Slice<int> const&)+0x6b0>
+    3c73:	|  |  |  |  |  |                                |  |  |  |  |            49 8d 73 fc          	lea    -0x4(%r11),%rsi
+    3c77:	|  |  |  |  |  |                                |  |  |  |  |            48 89 fa             	mov    %rdi,%rdx
+    3c7a:	|  |  |  |  |  |                                |  |  |  |  |            48 29 fe             	sub    %rdi,%rsi
+    3c7d:	|  |  |  |  |  |                                |  |  |  |  |            48 89 f5             	mov    %rsi,%rbp
+    3c80:	|  |  |  |  |  |                                |  |  |  |  |            48 c1 ed 02          	shr    $0x2,%rbp
+    3c84:	|  |  |  |  |  |                                |  |  |  |  |            48 83 c5 01          	add    $0x1,%rbp
+    3c88:	|  |  |  |  |  |                                |  |  |  |  |            48 83 fe 08          	cmp    $0x8,%rsi
+    3c8c:	|  |  |  |  |  |                                |  |  |  |  |     /----- 76 64                	jbe    3cf2 <bench_queue(nel::Slice<int> const&)+0x792>
+    3c8e:	|  |  |  |  |  |                                |  |  |  |  |     |      48 89 ee             	mov    %rbp,%rsi
+    3c91:	|  |  |  |  |  |                                |  |  |  |  |     |      66 0f ef d2          	pxor   %xmm2,%xmm2
+    3c95:	|  |  |  |  |  |                                |  |  |  |  |     |      48 c1 ee 02          	shr    $0x2,%rsi
+    3c99:	|  |  |  |  |  |                                |  |  |  |  |     |      48 c1 e6 04          	shl    $0x4,%rsi
+    3c9d:	|  |  |  |  |  |                                |  |  |  |  |     |      48 01 fe             	add    %rdi,%rsi
+    3ca0:	|  |  |  |  |  |                                |  |  |  |  |     |  /-> f3 0f 6f 02          	movdqu (%rdx),%xmm0
+    3ca4:	|  |  |  |  |  |                                |  |  |  |  |     |  |   66 0f 6f cc          	movdqa %xmm4,%xmm1
+    3ca8:	|  |  |  |  |  |                                |  |  |  |  |     |  |   48 83 c2 10          	add    $0x10,%rdx
+    3cac:	|  |  |  |  |  |                                |  |  |  |  |     |  |   66 0f 66 c8          	pcmpgtd %xmm0,%xmm1
+    3cb0:	|  |  |  |  |  |                                |  |  |  |  |     |  |   66 0f 6f d8          	movdqa %xmm0,%xmm3
+    3cb4:	|  |  |  |  |  |                                |  |  |  |  |     |  |   66 0f 6a d9          	punpckhdq %xmm1,%xmm3
+    3cb8:	|  |  |  |  |  |                                |  |  |  |  |     |  |   66 0f 62 c1          	punpckldq %xmm1,%xmm0
+    3cbc:	|  |  |  |  |  |                                |  |  |  |  |     |  |   66 0f d4 c3          	paddq  %xmm3,%xmm0
+    3cc0:	|  |  |  |  |  |                                |  |  |  |  |     |  |   66 0f d4 d0          	paddq  %xmm0,%xmm2
+        constexpr bool is_done(void) const
+    3cc4:	|  |  |  |  |  |                                |  |  |  |  |     |  |   48 39 d6             	cmp    %rdx,%rsi
+    3cc7:	|  |  |  |  |  |                                |  |  |  |  |     |  \-- 75 d7                	jne    3ca0 <bench_queue(nel::Slice<int> const&)+0x740>
+    3cc9:	|  |  |  |  |  |                                |  |  |  |  |     |      66 0f 6f c2          	movdqa %xmm2,%xmm0
+    3ccd:	|  |  |  |  |  |                                |  |  |  |  |     |      66 0f 73 d8 08       	psrldq $0x8,%xmm0
+    3cd2:	|  |  |  |  |  |                                |  |  |  |  |     |      66 0f d4 d0          	paddq  %xmm0,%xmm2
+    3cd6:	|  |  |  |  |  |                                |  |  |  |  |     |      66 48 0f 7e d2       	movq   %xmm2,%rdx
+    3cdb:	|  |  |  |  |  |                                |  |  |  |  |     |      48 01 d1             	add    %rdx,%rcx
+    3cde:	|  |  |  |  |  |                                |  |  |  |  |     |      48 89 ea             	mov    %rbp,%rdx
+    3ce1:	|  |  |  |  |  |                                |  |  |  |  |     |      48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+    3ce5:	|  |  |  |  |  |                                |  |  |  |  |     |      83 e5 03             	and    $0x3,%ebp
+    3ce8:	|  |  |  |  |  |                                |  |  |  |  |     |      48 8d 3c 97          	lea    (%rdi,%rdx,4),%rdi
+    3cec:	|  |  |  |  |  |  /-----------------------------|--|--|--|--|-----|----- 0f 84 28 05 00 00    	je     421a <bench_queue(nel::Slice<int> const&)+0xcba>
+    3cf2:	|  |  |  |  |  |  |                             |  |  |  |  |     \----> 48 63 17             	movslq (%rdi),%rdx
+    3cf5:	|  |  |  |  |  |  |                             |  |  |  |  |            48 01 ca             	add    %rcx,%rdx
+    3cf8:	|  |  |  |  |  |  |                             |  |  |  |  |            48 8d 4f 04          	lea    0x4(%rdi),%rcx
+            return it1_.is_done() && it2_.is_done();
+    3cfc:	|  |  |  |  |  |  |                             |  |  |  |  |            49 39 cb             	cmp    %rcx,%r11
+    3cff:	|  |  |  |  |  |  |  /--------------------------|--|--|--|--|----------- 0f 84 f6 04 00 00    	je     41fb <bench_queue(nel::Slice<int> const&)+0xc9b>
+    3d05:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 63 4f 04          	movslq 0x4(%rdi),%rcx
+    3d09:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 01 ca             	add    %rcx,%rdx
+    3d0c:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 8d 4f 08          	lea    0x8(%rdi),%rcx
+    3d10:	|  |  |  |  |  |  |  |                          |  |  |  |  |            49 39 cb             	cmp    %rcx,%r11
+    3d13:	|  |  |  |  |  |  |  +--------------------------|--|--|--|--|----------- 0f 84 e2 04 00 00    	je     41fb <bench_queue(nel::Slice<int> const&)+0xc9b>
+    3d19:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 63 4f 08          	movslq 0x8(%rdi),%rcx
+    3d1d:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 01 ca             	add    %rcx,%rdx
+            r += f(queue);
+    3d20:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 01 d3             	add    %rdx,%rbx
+        for (nel::Index i = 0; i < reps; ++i) {
+    3d23:	|  |  |  |  |  |  |  |                          |  |  |  |  |            49 83 e8 01          	sub    $0x1,%r8
+    3d27:	|  |  |  |  |  +--|--|--------------------------|--|--|--|--|----------- 0f 85 f7 fe ff ff    	jne    3c24 <bench_queue(nel::Slice<int> const&)+0x6c4>
+    3d2d:	|  |  |  |  >--|--|--|--------------------------|--|--|--|--|----------> 48 8b 4c 24 08       	mov    0x8(%rsp),%rcx
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    3d32:	|  |  |  |  |  |  |  |                          |  |  |  |  |            4c 89 ee             	mov    %r13,%rsi
+    3d35:	|  |  |  |  |  |  |  |                          |  |  |  |  |            bf 01 00 00 00       	mov    $0x1,%edi
+    3d3a:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 8b 6c 24 10       	mov    0x10(%rsp),%rbp
+    3d3f:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 89 4c 24 08       	mov    %rcx,0x8(%rsp)
+    3d44:	|  |  |  |  |  |  |  |                          |  |  |  |  |            e8 07 d3 ff ff       	call   1050 <clock_gettime@plt>
+    return now_ns() - b;
+    3d49:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 8b 4c 24 08       	mov    0x8(%rsp),%rcx
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    3d4e:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 69 44 24 30 00 ca 	imul   $0x3b9aca00,0x30(%rsp),%rax
+    3d55:	|  |  |  |  |  |  |  |                          |  |  |  |  |            9a 3b 
+             << "ns/item\n";
+    3d57:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 8d 35 39 14 00 00 	lea    0x1439(%rip),%rsi        # 5197 <_IO_stdin_used+0x197>
+    sink = sink + r;
+    3d5e:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 8b 15 33 73 00 00 	mov    0x7333(%rip),%rdx        # b098 <sink>
+    3d65:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 8d 3d 34 73 00 00 	lea    0x7334(%rip),%rdi        # b0a0 <nel::log>
+    3d6c:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 29 e8             	sub    %rbp,%rax
+    return now_ns() - b;
+    3d6f:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 03 44 24 38       	add    0x38(%rsp),%rax
+    3d74:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 01 da             	add    %rbx,%rdx
+    3d77:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 29 c8             	sub    %rcx,%rax
+    3d7a:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 89 15 17 73 00 00 	mov    %rdx,0x7317(%rip)        # b098 <sink>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    3d81:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    3d85:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+    3d89:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 b8 db 34 b6 d7 82 	movabs $0x431bde82d7b634db,%rax
+    3d90:	|  |  |  |  |  |  |  |                          |  |  |  |  |            de 1b 43 
+    3d93:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 c1 e2 02          	shl    $0x2,%rdx
+    3d97:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 f7 e2             	mul    %rdx
+    long unsigned int const frac = cns % 100UL;
+    3d9a:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    3da1:	|  |  |  |  |  |  |  |                          |  |  |  |  |            c2 f5 28 
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    3da4:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 89 d1             	mov    %rdx,%rcx
+    long unsigned int const frac = cns % 100UL;
+    3da7:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 c1 ea 1a          	shr    $0x1a,%rdx
+    3dab:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 f7 e2             	mul    %rdx
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    3dae:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 c1 e9 18          	shr    $0x18,%rcx
+    long unsigned int const frac = cns % 100UL;
+    3db2:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 89 d3             	mov    %rdx,%rbx
+    3db5:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 c1 eb 02          	shr    $0x2,%rbx
+    3db9:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 8d 04 9b          	lea    (%rbx,%rbx,4),%rax
+    3dbd:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 89 dd             	mov    %rbx,%rbp
+    3dc0:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 89 cb             	mov    %rcx,%rbx
+    3dc3:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    3dc7:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 c1 e0 02          	shl    $0x2,%rax
+    3dcb:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 29 c3             	sub    %rax,%rbx
+             << "ns/item\n";
+    3dce:	|  |  |  |  |  |  |  |                          |  |  |  |  |            e8 2d 05 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    3dd3:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 8d 35 35 14 00 00 	lea    0x1435(%rip),%rsi        # 520f <_IO_stdin_used+0x20f>
+    3dda:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    3ddd:	|  |  |  |  |  |  |  |                          |  |  |  |  |            e8 1e 05 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    3de2:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 89 ee             	mov    %rbp,%rsi
+    3de5:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    3de8:	|  |  |  |  |  |  |  |                          |  |  |  |  |            e8 d3 05 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+    3ded:	|  |  |  |  |  |  |  |                          |  |  |  |  |            be 2e 00 00 00       	mov    $0x2e,%esi
+    3df2:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    3df5:	|  |  |  |  |  |  |  |                          |  |  |  |  |            e8 e6 04 00 00       	call   42e0 <nel::operator<<(nel::Log&, char)>
+    3dfa:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 83 fb 0a          	cmp    $0xa,%rbx
+    3dfe:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 8d 35 ff 11 00 00 	lea    0x11ff(%rip),%rsi        # 5004 <_IO_stdin_used+0x4>
+    3e05:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    3e08:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 8d 05 fb 13 00 00 	lea    0x13fb(%rip),%rax        # 520a <_IO_stdin_used+0x20a>
+    3e0f:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 0f 43 f0          	cmovae %rax,%rsi
+    3e13:	|  |  |  |  |  |  |  |                          |  |  |  |  |            e8 e8 04 00 00       	call   4300 <nel::operator<<(nel::Log&, char const*)>
+    3e18:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 89 de             	mov    %rbx,%rsi
+    3e1b:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    3e1e:	|  |  |  |  |  |  |  |                          |  |  |  |  |            e8 9d 05 00 00       	call   43c0 <nel::operator<<(nel::Log&, unsigned long)>
+}
+    3e23:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 83 c4 48          	add    $0x48,%rsp
+    3e27:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 8d 35 f4 11 00 00 	lea    0x11f4(%rip),%rsi        # 5022 <_IO_stdin_used+0x22>
+    3e2e:	|  |  |  |  |  |  |  |                          |  |  |  |  |            5b                   	pop    %rbx
+    3e2f:	|  |  |  |  |  |  |  |                          |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    3e32:	|  |  |  |  |  |  |  |                          |  |  |  |  |            5d                   	pop    %rbp
+    3e33:	|  |  |  |  |  |  |  |                          |  |  |  |  |            41 5c                	pop    %r12
+    3e35:	|  |  |  |  |  |  |  |                          |  |  |  |  |            41 5d                	pop    %r13
+    3e37:	|  |  |  |  |  |  |  |                          |  |  |  |  |            41 5e                	pop    %r14
+    3e39:	|  |  |  |  |  |  |  |                          |  |  |  |  |            41 5f                	pop    %r15
+    3e3b:	|  |  |  |  |  |  |  |                          |  |  |  |  |            e9 c0 04 00 00       	jmp    4300 <nel::operator<<(nel::Log&, char const*)>
+    for (nel::Index i = 0; i < queue_len + queue_len / 2; ++i) {
+    3e40:	|  |  |  |  |  |  |  |                          |  |  |  |  \----------> 48 81 fe 00 18 00 00 	cmp    $0x1800,%rsi
+    3e47:	|  |  |  |  |  |  |  |                          |  |  |  \-------------- 0f 85 e8 f7 ff ff    	jne    3635 <bench_queue(nel::Slice<int> const&)+0xd5>
+    3e4d:	|  |  |  |  |  |  |  |                          |  |  \----------------- e9 40 f8 ff ff       	jmp    3692 <bench_queue(nel::Slice<int> const&)+0x132>
+    3e52:	|  |  |  |  |  |  |  |                          |  |                     66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+            r += f(queue);
+    3e58:	|  |  |  |  |  |  |  |                          |  |           /-------> 48 01 d5             	add    %rdx,%rbp
+        for (nel::Index i = 0; i < reps; ++i) {
+    3e5b:	|  |  |  |  |  |  |  |                          |  |           |     /-> 48 83 ef 01          	sub    $0x1,%rdi
+    3e5f:	|  +--|--|--|--|--|--|--------------------------|--|-----------|-----|-- 0f 84 b2 fa ff ff    	je     3917 <bench_queue(nel::Slice<int> const&)+0x3b7>
+            } else if (rp_ < wp_) {
+    3e65:	>--|--|--|--|--|--|--|--------------------------|--|-----------|-----|-> 4d 39 d3             	cmp    %r10,%r11
+    3e68:	|  |  |  |  |  |  |  |                          |  |  /--------|-----|-- 0f 83 7b 01 00 00    	jae    3fe9 <bench_queue(nel::Slice<int> const&)+0xa89>
+    3e6e:	|  |  |  |  |  |  |  |                          |  |  |        |     |   66 90                	xchg   %ax,%ax
+            , e_(move(o.e_))
+    3e70:	|  |  |  |  |  |  |  |                          |  |  |     /--|-----|-> 4d 89 e0             	mov    %r12,%r8
+    3e73:	|  |  |  |  |  |  |  |                          |  |  |     |  |     |   45 31 ff             	xor    %r15d,%r15d
+            : b_(move(o.b_))
+    3e76:	|  |  |  |  |  |  |  |                          |  |  |     |  |     |   31 c9                	xor    %ecx,%ecx
+            if (b_ == e_) { return None; }
+    3e78:	|  |  |  |  |  |  |  |                          |  |  |     |  |     |   4c 39 74 24 08       	cmp    %r14,0x8(%rsp)
+    3e7d:	|  |  |  |  |  |  |  |                          |  |  |     |  |     \-- 74 dc                	je     3e5b <bench_queue(nel::Slice<int> const&)+0x8fb>
+    3e7f:	|  |  |  |  |  |  |  |                          |  |  |  /--|--|-------> 49 8d 50 fc          	lea    -0x4(%r8),%rdx
+    3e83:	|  |  |  |  |  |  |  |                          |  |  |  |  |  |         4c 89 c8             	mov    %r9,%rax
+    3e86:	|  |  |  |  |  |  |  |                          |  |  |  |  |  |         4c 29 ca             	sub    %r9,%rdx
+    3e89:	|  |  |  |  |  |  |  |                          |  |  |  |  |  |         48 89 d6             	mov    %rdx,%rsi
+    3e8c:	|  |  |  |  |  |  |  |                          |  |  |  |  |  |         48 c1 ee 02          	shr    $0x2,%rsi
+    3e90:	|  |  |  |  |  |  |  |                          |  |  |  |  |  |         48 83 c6 01          	add    $0x1,%rsi
+    3e94:	|  |  |  |  |  |  |  |                          |  |  |  |  |  |         48 83 fa 08          	cmp    $0x8,%rdx
+    3e98:	|  |  |  |  |  |  |  |  /-----------------------|--|--|--|--|--|-------- 0f 86 45 03 00 00    	jbe    41e3 <bench_queue(nel::Slice<int> const&)+0xc83>
+    3e9e:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |         48 89 f2             	mov    %rsi,%rdx
+            : b_(move(o.b_))
+    3ea1:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |         66 0f ef d2          	pxor   %xmm2,%xmm2
+    3ea5:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |         48 c1 ea 02          	shr    $0x2,%rdx
+    3ea9:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |         48 c1 e2 04          	shl    $0x4,%rdx
+    3ead:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |         4c 01 ca             	add    %r9,%rdx
+        q.iter().for_each([&acc](int const &e) { acc += Acc(e); });
+    3eb0:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |     /-> f3 0f 6f 00          	movdqu (%rax),%xmm0
+    3eb4:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |     |   66 0f 6f cc          	movdqa %xmm4,%xmm1
+    3eb8:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |     |   48 83 c0 10          	add    $0x10,%rax
+    3ebc:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |     |   66 0f 66 c8          	pcmpgtd %xmm0,%xmm1
+    3ec0:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |     |   66 0f 6f d8          	movdqa %xmm0,%xmm3
+    3ec4:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |     |   66 0f 6a d9          	punpckhdq %xmm1,%xmm3
+    3ec8:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |     |   66 0f 62 c1          	punpckldq %xmm1,%xmm0
+    3ecc:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |     |   66 0f d4 c3          	paddq  %xmm3,%xmm0
+    3ed0:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |     |   66 0f d4 d0          	paddq  %xmm0,%xmm2
+        Optional<OutT> next(void)
+    3ed4:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |     |   48 39 d0             	cmp    %rdx,%rax
+    3ed7:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |     \-- 75 d7                	jne    3eb0 <bench_queue(nel::Slice<int> const&)+0x950>
+    3ed9:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |         66 0f 6f c2          	movdqa %xmm2,%xmm0
+    3edd:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |         66 0f 73 d8 08       	psrldq $0x8,%xmm0
+    3ee2:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |         66 0f d4 d0          	paddq  %xmm0,%xmm2
+    3ee6:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |         66 48 0f 7e d2       	movq   %xmm2,%rdx
+    3eeb:	|  |  |  |  |  |  |  |  |                       |  |  |  |  |  |         40 f6 c6 03          	test   $0x3,%sil
+    3eef:	|  |  |  |  |  |  |  |  |  /--------------------|--|--|--|--|--|-------- 74 2e                	je     3f1f <bench_queue(nel::Slice<int> const&)+0x9bf>
+    3ef1:	|  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |         48 83 e6 fc          	and    $0xfffffffffffffffc,%rsi
+    3ef5:	|  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |         49 8d 04 b1          	lea    (%r9,%rsi,4),%rax
+    3ef9:	|  |  |  |  |  |  |  |  |  |  /-----------------|--|--|--|--|--|-------> 48 63 30             	movslq (%rax),%rsi
+    3efc:	|  |  |  |  |  |  |  |  |  |  |                 |  |  |  |  |  |         48 01 f2             	add    %rsi,%rdx
+            return Some(*b_++);
+    3eff:	|  |  |  |  |  |  |  |  |  |  |                 |  |  |  |  |  |         48 8d 70 04          	lea    0x4(%rax),%rsi
+            if (b_ == e_) { return None; }
+    3f03:	|  |  |  |  |  |  |  |  |  |  |                 |  |  |  |  |  |         49 39 f0             	cmp    %rsi,%r8
+    3f06:	|  |  |  |  |  |  |  |  |  +--|-----------------|--|--|--|--|--|-------- 74 17                	je     3f1f <bench_queue(nel::Slice<int> const&)+0x9bf>
+    3f08:	|  |  |  |  |  |  |  |  |  |  |                 |  |  |  |  |  |         48 63 70 04          	movslq 0x4(%rax),%rsi
+    3f0c:	|  |  |  |  |  |  |  |  |  |  |                 |  |  |  |  |  |         48 01 f2             	add    %rsi,%rdx
+            return Some(*b_++);
+    3f0f:	|  |  |  |  |  |  |  |  |  |  |                 |  |  |  |  |  |         48 8d 70 08          	lea    0x8(%rax),%rsi
+            if (b_ == e_) { return None; }
+    3f13:	|  |  |  |  |  |  |  |  |  |  |                 |  |  |  |  |  |         49 39 f0             	cmp    %rsi,%r8
+    3f16:	|  |  |  |  |  |  |  |  |  +--|-----------------|--|--|--|--|--|-------- 74 07                	je     3f1f <bench_queue(nel::Slice<int> const&)+0x9bf>
+    3f18:	|  |  |  |  |  |  |  |  |  |  |                 |  |  |  |  |  |         48 63 40 08          	movslq 0x8(%rax),%rax
+    3f1c:	|  |  |  |  |  |  |  |  |  |  |                 |  |  |  |  |  |         48 01 c2             	add    %rax,%rdx
+    3f1f:	|  |  |  |  |  |  |  |  |  >--|-----------------|--|--|--|--|--|-------> 4c 39 f9             	cmp    %r15,%rcx
+    3f22:	|  |  |  |  |  |  |  |  |  |  |                 \--|--|--|--|--|-------- 0f 84 e6 f9 ff ff    	je     390e <bench_queue(nel::Slice<int> const&)+0x3ae>
+    3f28:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |         49 8d 77 fc          	lea    -0x4(%r15),%rsi
+    3f2c:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |         48 89 c8             	mov    %rcx,%rax
+    3f2f:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |         48 29 ce             	sub    %rcx,%rsi
+    3f32:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |         49 89 f0             	mov    %rsi,%r8
+    3f35:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |         49 c1 e8 02          	shr    $0x2,%r8
+    3f39:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |         49 83 c0 01          	add    $0x1,%r8
+    3f3d:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |         48 83 fe 08          	cmp    $0x8,%rsi
+    3f41:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  /----- 76 62                	jbe    3fa5 <bench_queue(nel::Slice<int> const&)+0xa45>
+    3f43:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |      4c 89 c6             	mov    %r8,%rsi
+    3f46:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |      66 0f ef c9          	pxor   %xmm1,%xmm1
+    3f4a:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |      48 c1 ee 02          	shr    $0x2,%rsi
+    3f4e:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |      48 c1 e6 04          	shl    $0x4,%rsi
+    3f52:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |      48 01 ce             	add    %rcx,%rsi
+    3f55:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |  /-> f3 0f 6f 00          	movdqu (%rax),%xmm0
+    3f59:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |  |   66 0f 6f d4          	movdqa %xmm4,%xmm2
+    3f5d:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    3f61:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |  |   66 0f 66 d0          	pcmpgtd %xmm0,%xmm2
+    3f65:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |  |   66 0f 6f d8          	movdqa %xmm0,%xmm3
+    3f69:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |  |   66 0f 6a da          	punpckhdq %xmm2,%xmm3
+    3f6d:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |  |   66 0f 62 c2          	punpckldq %xmm2,%xmm0
+    3f71:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |  |   66 0f d4 c3          	paddq  %xmm3,%xmm0
+    3f75:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |  |   66 0f d4 c8          	paddq  %xmm0,%xmm1
+        Optional<OutT> next(void)
+    3f79:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |  |   48 39 f0             	cmp    %rsi,%rax
+    3f7c:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |  \-- 75 d7                	jne    3f55 <bench_queue(nel::Slice<int> const&)+0x9f5>
+    3f7e:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |      66 0f 6f c1          	movdqa %xmm1,%xmm0
+    3f82:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |      66 0f 73 d8 08       	psrldq $0x8,%xmm0
+    3f87:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |      66 0f d4 c8          	paddq  %xmm0,%xmm1
+    3f8b:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |      66 48 0f 7e c8       	movq   %xmm1,%rax
+    3f90:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |      48 01 c2             	add    %rax,%rdx
+    3f93:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |      41 f6 c0 03          	test   $0x3,%r8b
+    3f97:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  +--|----- 0f 84 bb fe ff ff    	je     3e58 <bench_queue(nel::Slice<int> const&)+0x8f8>
+    3f9d:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |      49 83 e0 fc          	and    $0xfffffffffffffffc,%r8
+    3fa1:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  |      4a 8d 0c 81          	lea    (%rcx,%r8,4),%rcx
+    3fa5:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |  \----> 48 63 01             	movslq (%rcx),%rax
+    3fa8:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |         48 01 d0             	add    %rdx,%rax
+            return Some(*b_++);
+    3fab:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |         48 8d 51 04          	lea    0x4(%rcx),%rdx
+            if (b_ == e_) { return None; }
+    3faf:	|  |  |  |  |  |  |  |  |  |  |                    |  |  |  |  |         49 39 d7             	cmp    %rdx,%r15
+    3fb2:	|  |  |  |  |  |  |  |  |  |  |        /-----------|--|--|--|--|-------- 0f 84 d8 01 00 00    	je     4190 <bench_queue(nel::Slice<int> const&)+0xc30>
+    3fb8:	|  |  |  |  |  |  |  |  |  |  |        |           |  |  |  |  |         48 63 51 04          	movslq 0x4(%rcx),%rdx
+    3fbc:	|  |  |  |  |  |  |  |  |  |  |        |           |  |  |  |  |         48 01 c2             	add    %rax,%rdx
+            return Some(*b_++);
+    3fbf:	|  |  |  |  |  |  |  |  |  |  |        |           |  |  |  |  |         48 8d 41 08          	lea    0x8(%rcx),%rax
+            if (b_ == e_) { return None; }
+    3fc3:	|  |  |  |  |  |  |  |  |  |  |        |           |  |  |  |  |         49 39 c7             	cmp    %rax,%r15
+    3fc6:	|  |  |  |  |  |  |  |  |  |  |        |           |  |  |  |  \-------- 0f 84 8c fe ff ff    	je     3e58 <bench_queue(nel::Slice<int> const&)+0x8f8>
+    3fcc:	|  |  |  |  |  |  |  |  |  |  |        |           |  |  |  |            48 63 41 08          	movslq 0x8(%rcx),%rax
+    3fd0:	|  |  |  |  |  |  |  |  |  |  |        |           |  |  |  |            48 01 d0             	add    %rdx,%rax
+            r += f(queue);
+    3fd3:	|  |  |  |  |  |  |  |  |  |  |        |           |  |  |  |            48 01 c5             	add    %rax,%rbp
+        for (nel::Index i = 0; i < reps; ++i) {
+    3fd6:	|  |  |  |  |  |  |  |  |  |  |        |           |  |  |  |            48 83 ef 01          	sub    $0x1,%rdi
+    3fda:	|  +--|--|--|--|--|--|--|--|--|--------|-----------|--|--|--|----------- 0f 84 37 f9 ff ff    	je     3917 <bench_queue(nel::Slice<int> const&)+0x3b7>
+    3fe0:	|  |  |  |  |  |  |  |  |  |  |        |           |  |  |  |            4d 39 d3             	cmp    %r10,%r11
+    3fe3:	|  |  |  |  |  |  |  |  |  |  |        |           |  |  |  \----------- 0f 82 87 fe ff ff    	jb     3e70 <bench_queue(nel::Slice<int> const&)+0x910>
+            , e_(move(o.e_))
+    3fe9:	|  |  |  |  |  |  |  |  |  |  |        |           |  \--|-------------> 4d 89 e7             	mov    %r12,%r15
+            if (b_ == e_) { return None; }
+    3fec:	|  |  |  |  |  |  |  |  |  |  |        |           |     |               4d 39 e9             	cmp    %r13,%r9
+    3fef:	|  |  |  |  |  |  |  |  |  |  |  /-----|-----------|-----|-------------- 0f 84 f8 01 00 00    	je     41ed <bench_queue(nel::Slice<int> const&)+0xc8d>
+            , e_(move(o.e_))
+    3ff5:	|  |  |  |  |  |  |  |  |  |  |  |     |           |     |               4d 89 e8             	mov    %r13,%r8
+            : b_(move(o.b_))
+    3ff8:	|  |  |  |  |  |  |  |  |  |  |  |     |           |     |               48 8d 0d 99 30 00 00 	lea    0x3099(%rip),%rcx        # 7098 <queue+0x18>
+    3fff:	|  |  |  |  |  |  |  |  |  |  |  |     |           |     \-------------- e9 7b fe ff ff       	jmp    3e7f <bench_queue(nel::Slice<int> const&)+0x91f>
+    4004:	|  |  |  |  |  |  |  |  |  |  |  |     |           |                     0f 1f 40 00          	nopl   0x0(%rax)
+    4008:	|  |  |  |  |  |  |  |  |  |  |  |     |     /-----|-------------------> 66 0f 6f c2          	movdqa %xmm2,%xmm0
+    400c:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |                     66 0f 73 d8 08       	psrldq $0x8,%xmm0
+    4011:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |                     66 0f d4 d0          	paddq  %xmm0,%xmm2
+    4015:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |                     66 48 0f 7e d1       	movq   %xmm2,%rcx
+    401a:	|  |  |  |  |  |  |  |  |  |  |  |     |     |     |                     41 f6 c0 03          	test   $0x3,%r8b
+    401e:	|  |  |  |  |  |  |  |  |  |  |  |     |  /--|-----|-------------------- 74 2e                	je     404e <bench_queue(nel::Slice<int> const&)+0xaee>
+    4020:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |                     49 83 e0 fc          	and    $0xfffffffffffffffc,%r8
+    4024:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |                     4b 8d 04 81          	lea    (%r9,%r8,4),%rax
+            .map<Acc>([](int const &e) -> Acc { return Acc(e); })
+    4028:	|  |  |  |  |  |  |  |  |  |  |  |  /--|--|--|-----|-------------------> 4c 63 00             	movslq (%rax),%r8
+            .fold(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    402b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                     4c 01 c1             	add    %r8,%rcx
+            return Some(*b_++);
+    402e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                     4c 8d 40 04          	lea    0x4(%rax),%r8
+            if (b_ == e_) { return None; }
+    4032:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                     4d 39 c2             	cmp    %r8,%r10
+    4035:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  +--|-----|-------------------- 74 17                	je     404e <bench_queue(nel::Slice<int> const&)+0xaee>
+            .map<Acc>([](int const &e) -> Acc { return Acc(e); })
+    4037:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                     4c 63 40 04          	movslq 0x4(%rax),%r8
+            .fold(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    403b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                     4c 01 c1             	add    %r8,%rcx
+            return Some(*b_++);
+    403e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                     4c 8d 40 08          	lea    0x8(%rax),%r8
+            if (b_ == e_) { return None; }
+    4042:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                     4d 39 c2             	cmp    %r8,%r10
+    4045:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  +--|-----|-------------------- 74 07                	je     404e <bench_queue(nel::Slice<int> const&)+0xaee>
+            .map<Acc>([](int const &e) -> Acc { return Acc(e); })
+    4047:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                     48 63 40 08          	movslq 0x8(%rax),%rax
+            .fold(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    404b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                     48 01 c1             	add    %rax,%rcx
+    404e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  >--|-----|-------------------> 4c 39 ee             	cmp    %r13,%rsi
+    4051:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     \-------------------- 0f 84 4e fa ff ff    	je     3aa5 <bench_queue(nel::Slice<int> const&)+0x545>
+    4057:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                           4d 8d 45 fc          	lea    -0x4(%r13),%r8
+    405b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                           48 89 f0             	mov    %rsi,%rax
+    405e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                           49 29 f0             	sub    %rsi,%r8
+    4061:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                           4d 89 c2             	mov    %r8,%r10
+    4064:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                           49 c1 ea 02          	shr    $0x2,%r10
+    4068:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                           49 83 c2 01          	add    $0x1,%r10
+    406c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                           49 83 f8 08          	cmp    $0x8,%r8
+    4070:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    /----- 76 62                	jbe    40d4 <bench_queue(nel::Slice<int> const&)+0xb74>
+    4072:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |      4d 89 d0             	mov    %r10,%r8
+    4075:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |      66 0f ef c9          	pxor   %xmm1,%xmm1
+    4079:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |      49 c1 e8 02          	shr    $0x2,%r8
+    407d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |      49 c1 e0 04          	shl    $0x4,%r8
+    4081:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |      49 01 f0             	add    %rsi,%r8
+            .map<Acc>([](int const &e) -> Acc { return Acc(e); })
+    4084:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |  /-> f3 0f 6f 00          	movdqu (%rax),%xmm0
+    4088:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |  |   66 0f 6f d4          	movdqa %xmm4,%xmm2
+    408c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |  |   48 83 c0 10          	add    $0x10,%rax
+    4090:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |  |   66 0f 66 d0          	pcmpgtd %xmm0,%xmm2
+    4094:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |  |   66 0f 6f d8          	movdqa %xmm0,%xmm3
+    4098:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |  |   66 0f 6a da          	punpckhdq %xmm2,%xmm3
+    409c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |  |   66 0f 62 c2          	punpckldq %xmm2,%xmm0
+            .fold(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    40a0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |  |   66 0f d4 c3          	paddq  %xmm3,%xmm0
+    40a4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |  |   66 0f d4 c8          	paddq  %xmm0,%xmm1
+        Optional<OutT> next(void)
+    40a8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |  |   49 39 c0             	cmp    %rax,%r8
+    40ab:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |  \-- 75 d7                	jne    4084 <bench_queue(nel::Slice<int> const&)+0xb24>
+    40ad:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |      66 0f 6f c1          	movdqa %xmm1,%xmm0
+    40b1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |      66 0f 73 d8 08       	psrldq $0x8,%xmm0
+    40b6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |      66 0f d4 c8          	paddq  %xmm0,%xmm1
+    40ba:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |      66 48 0f 7e c8       	movq   %xmm1,%rax
+    40bf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |      48 01 c1             	add    %rax,%rcx
+    40c2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                    |      41 f6 c2 03          	test   $0x3,%r10b
+    40c6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-----------------|----- 0f 84 e4 00 00 00    	je     41b0 <bench_queue(nel::Slice<int> const&)+0xc50>
+    40cc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                 |      49 83 e2 fc          	and    $0xfffffffffffffffc,%r10
+    40d0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                 |      4a 8d 34 96          	lea    (%rsi,%r10,4),%rsi
+            .map<Acc>([](int const &e) -> Acc { return Acc(e); })
+    40d4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                 \----> 48 63 06             	movslq (%rsi),%rax
+            .fold(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    40d7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 01 c1             	add    %rax,%rcx
+            return Some(*b_++);
+    40da:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        48 8d 46 04          	lea    0x4(%rsi),%rax
+            if (b_ == e_) { return None; }
+    40de:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                        49 39 c5             	cmp    %rax,%r13
+    40e1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     /----------------- 0f 84 c1 00 00 00    	je     41a8 <bench_queue(nel::Slice<int> const&)+0xc48>
+            .map<Acc>([](int const &e) -> Acc { return Acc(e); })
+    40e7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  48 63 46 04          	movslq 0x4(%rsi),%rax
+            .fold(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    40eb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  48 01 c8             	add    %rcx,%rax
+            return Some(*b_++);
+    40ee:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  48 8d 4e 08          	lea    0x8(%rsi),%rcx
+            if (b_ == e_) { return None; }
+    40f2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |                  49 39 cd             	cmp    %rcx,%r13
+    40f5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |              /-- 74 07                	je     40fe <bench_queue(nel::Slice<int> const&)+0xb9e>
+            .map<Acc>([](int const &e) -> Acc { return Acc(e); })
+    40f7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |              |   48 63 4e 08          	movslq 0x8(%rsi),%rcx
+            .fold(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    40fb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |              |   48 01 c8             	add    %rcx,%rax
+            r += f(queue);
+    40fe:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |              \-> 48 01 c5             	add    %rax,%rbp
+        for (nel::Index i = 0; i < reps; ++i) {
+    4101:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |           /----> 48 83 ef 01          	sub    $0x1,%rdi
+    4105:	|  |  +--|--|--|--|--|--|--|--|--|--|--|--|--|--|-----|-----------|----- 0f 84 a3 f9 ff ff    	je     3aae <bench_queue(nel::Slice<int> const&)+0x54e>
+    410b:	|  |  |  \--|--|--|--|--|--|--|--|--|--|--|--|--|-----|-----------|----> 4d 39 e6             	cmp    %r12,%r14
+    410e:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     |  /--------|----- 0f 83 b2 00 00 00    	jae    41c6 <bench_queue(nel::Slice<int> const&)+0xc66>
+    4114:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     /--|----> 48 8b 4c 24 18       	mov    0x18(%rsp),%rcx
+    4119:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |      48 39 4c 24 10       	cmp    %rcx,0x10(%rsp)
+    411e:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  +----- 74 e1                	je     4101 <bench_queue(nel::Slice<int> const&)+0xba1>
+            , e_(move(o.e_))
+    4120:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |      4d 89 fa             	mov    %r15,%r10
+    4123:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |      45 31 ed             	xor    %r13d,%r13d
+            : b_(move(o.b_))
+    4126:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |      31 f6                	xor    %esi,%esi
+    4128:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  /--|--|----> 49 8d 4a fc          	lea    -0x4(%r10),%rcx
+    412c:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |      4c 89 c8             	mov    %r9,%rax
+    412f:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |      4c 29 c9             	sub    %r9,%rcx
+    4132:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |      49 89 c8             	mov    %rcx,%r8
+    4135:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |      49 c1 e8 02          	shr    $0x2,%r8
+    4139:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |      49 83 c0 01          	add    $0x1,%r8
+    413d:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |      48 83 f9 08          	cmp    $0x8,%rcx
+    4141:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|--|--|--|----- 0f 86 c9 00 00 00    	jbe    4210 <bench_queue(nel::Slice<int> const&)+0xcb0>
+    4147:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      4c 89 c1             	mov    %r8,%rcx
+    414a:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      66 0f ef d2          	pxor   %xmm2,%xmm2
+    414e:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 c1 e9 02          	shr    $0x2,%rcx
+    4152:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 c1 e1 04          	shl    $0x4,%rcx
+    4156:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      4c 01 c9             	add    %r9,%rcx
+    4159:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            .map<Acc>([](int const &e) -> Acc { return Acc(e); })
+    4160:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-> f3 0f 6f 00          	movdqu (%rax),%xmm0
+    4164:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   66 0f 6f cc          	movdqa %xmm4,%xmm1
+    4168:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    416c:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   66 0f 66 c8          	pcmpgtd %xmm0,%xmm1
+    4170:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   66 0f 6f d8          	movdqa %xmm0,%xmm3
+    4174:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   66 0f 6a d9          	punpckhdq %xmm1,%xmm3
+    4178:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   66 0f 62 c1          	punpckldq %xmm1,%xmm0
+            .fold(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    417c:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   66 0f d4 c3          	paddq  %xmm3,%xmm0
+    4180:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   66 0f d4 d0          	paddq  %xmm0,%xmm2
+        Optional<OutT> next(void)
+    4184:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 39 c1             	cmp    %rax,%rcx
+    4187:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \-- 75 d7                	jne    4160 <bench_queue(nel::Slice<int> const&)+0xc00>
+    4189:	|  |  |     |  |  |  |  |  |  |  |  |  |  |  \--|--|--|--|--|--|--|----- e9 7a fe ff ff       	jmp    4008 <bench_queue(nel::Slice<int> const&)+0xaa8>
+    418e:	|  |  |     |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |      66 90                	xchg   %ax,%ax
+            r += f(queue);
+    4190:	|  |  |     |  |  |  |  |  |  |  |  |  \--|-----|--|--|--|--|--|--|----> 48 01 c5             	add    %rax,%rbp
+        for (nel::Index i = 0; i < reps; ++i) {
+    4193:	|  |  |     |  |  |  |  |  |  |  |  |     |     |  |  |  |  |  |  |      48 83 ef 01          	sub    $0x1,%rdi
+    4197:	\--|--|-----|--|--|--|--|--|--|--|--|-----|-----|--|--|--|--|--|--|----- 0f 85 c8 fc ff ff    	jne    3e65 <bench_queue(nel::Slice<int> const&)+0x905>
+    419d:	   \--|-----|--|--|--|--|--|--|--|--|-----|-----|--|--|--|--|--|--|----- e9 75 f7 ff ff       	jmp    3917 <bench_queue(nel::Slice<int> const&)+0x3b7>
+    41a2:	      |     |  |  |  |  |  |  |  |  |     |     |  |  |  |  |  |  |      66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+            r += f(queue);
+    41a8:	      |     |  |  |  |  |  |  |  |  |     |     |  |  \--|--|--|--|----> 48 01 cd             	add    %rcx,%rbp
+        for (nel::Index i = 0; i < reps; ++i) {
+    41ab:	      |     |  |  |  |  |  |  |  |  |     |     |  |     |  |  |  \----- e9 51 ff ff ff       	jmp    4101 <bench_queue(nel::Slice<int> const&)+0xba1>
+            r += f(queue);
+    41b0:	      |     |  |  |  |  |  |  |  |  |     |     \--|-----|--|--|-------> 48 01 cd             	add    %rcx,%rbp
+        for (nel::Index i = 0; i < reps; ++i) {
+    41b3:	      |     |  |  |  |  |  |  |  |  |     |        |     |  |  |         48 83 ef 01          	sub    $0x1,%rdi
+    41b7:	      \-----|--|--|--|--|--|--|--|--|-----|--------|-----|--|--|-------- 0f 84 f1 f8 ff ff    	je     3aae <bench_queue(nel::Slice<int> const&)+0x54e>
+    41bd:	            |  |  |  |  |  |  |  |  |     |        |     |  |  |         4d 39 e6             	cmp    %r12,%r14
+    41c0:	            |  |  |  |  |  |  |  |  |     |        |     |  |  \-------- 0f 82 4e ff ff ff    	jb     4114 <bench_queue(nel::Slice<int> const&)+0xbb4>
+            , e_(move(o.e_))
+    41c6:	            |  |  |  |  |  |  |  |  |     |        |     \--|----------> 4d 89 fd             	mov    %r15,%r13
+            : b_(move(o.b_))
+    41c9:	            |  |  |  |  |  |  |  |  |     |        |        |            48 8d 35 c8 2e 00 00 	lea    0x2ec8(%rip),%rsi        # 7098 <queue+0x18>
+            , e_(move(o.e_))
+    41d0:	            |  |  |  |  |  |  |  |  |     |        |        |            4d 89 da             	mov    %r11,%r10
+            if (b_ == e_) { return None; }
+    41d3:	            |  |  |  |  |  |  |  |  |     |        |        |            4d 39 d9             	cmp    %r11,%r9
+    41d6:	            |  |  |  |  |  |  |  |  |     |        |        \----------- 0f 85 4c ff ff ff    	jne    4128 <bench_queue(nel::Slice<int> const&)+0xbc8>
+            U acc = move(initial);
+    41dc:	            |  |  |  |  |  |  |  |  |     |        |                     31 c9                	xor    %ecx,%ecx
+    41de:	            |  |  |  |  |  |  |  |  |     \--------|-------------------- e9 6b fe ff ff       	jmp    404e <bench_queue(nel::Slice<int> const&)+0xaee>
+    Acc r = 0;
+    41e3:	            |  |  |  |  \--|--|--|--|--------------|-------------------> 4c 89 c8             	mov    %r9,%rax
+        Acc acc = 0;
+    41e6:	            |  |  |  |     |  |  |  |              |                     31 d2                	xor    %edx,%edx
+    41e8:	            |  |  |  |     |  \--|--|--------------|-------------------- e9 0c fd ff ff       	jmp    3ef9 <bench_queue(nel::Slice<int> const&)+0x999>
+            : b_(move(o.b_))
+    41ed:	            |  |  |  |     |     \--|--------------|-------------------> 48 8d 0d a4 2e 00 00 	lea    0x2ea4(%rip),%rcx        # 7098 <queue+0x18>
+    41f4:	            |  |  |  |     |        |              |                     31 d2                	xor    %edx,%edx
+    41f6:	            |  |  |  |     \--------|--------------|-------------------- e9 24 fd ff ff       	jmp    3f1f <bench_queue(nel::Slice<int> const&)+0x9bf>
+            r += f(queue);
+    41fb:	            |  |  |  \--------------|--------------|-------------------> 48 01 d3             	add    %rdx,%rbx
+        for (nel::Index i = 0; i < reps; ++i) {
+    41fe:	            |  |  |                 |              |                     49 83 e8 01          	sub    $0x1,%r8
+    4202:	            |  +--|-----------------|--------------|-------------------- 0f 85 1c fa ff ff    	jne    3c24 <bench_queue(nel::Slice<int> const&)+0x6c4>
+    4208:	            +--|--|-----------------|--------------|-------------------- e9 20 fb ff ff       	jmp    3d2d <bench_queue(nel::Slice<int> const&)+0x7cd>
+    420d:	            |  |  |                 |              |                     0f 1f 00             	nopl   (%rax)
+    Acc r = 0;
+    4210:	            |  |  |                 |              \-------------------> 4c 89 c8             	mov    %r9,%rax
+    4213:	            |  |  |                 |                                    31 c9                	xor    %ecx,%ecx
+    4215:	            |  |  |                 \----------------------------------- e9 0e fe ff ff       	jmp    4028 <bench_queue(nel::Slice<int> const&)+0xac8>
+            r += f(queue);
+    421a:	            |  |  \----------------------------------------------------> 48 01 cb             	add    %rcx,%rbx
+        for (nel::Index i = 0; i < reps; ++i) {
+    421d:	            |  |                                                         49 83 e8 01          	sub    $0x1,%r8
+    4221:	            |  \-------------------------------------------------------- 0f 85 fd f9 ff ff    	jne    3c24 <bench_queue(nel::Slice<int> const&)+0x6c4>
+    4227:	            \----------------------------------------------------------- e9 01 fb ff ff       	jmp    3d2d <bench_queue(nel::Slice<int> const&)+0x7cd>
+    422c:	                                                                         0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000004230 <nel::heapless::Queue<int, 4096ul>::~Queue()>:
+    4230:	                      48 83 3f 00          	cmpq   $0x0,(%rdi)
+    4234:	   /----------------- 74 3a                	je     4270 <nel::heapless::Queue<int, 4096ul>::~Queue()+0x40>
+    4236:	   |                  4c 8b 47 10          	mov    0x10(%rdi),%r8
+    423a:	   |                  48 8b 57 08          	mov    0x8(%rdi),%rdx
+        {
+            return &u_.elem_;
+    423e:	   |                  48 8d 77 18          	lea    0x18(%rdi),%rsi
+            return &ptr()[d];
+    4242:	   |                  4a 8d 0c 86          	lea    (%rsi,%r8,4),%rcx
+    4246:	   |                  48 8d 04 96          	lea    (%rsi,%rdx,4),%rax
+            } else if (rp_ < wp_) {
+    424a:	   |                  49 39 d0             	cmp    %rdx,%r8
+    424d:	/--|----------------- 73 41                	jae    4290 <nel::heapless::Queue<int, 4096ul>::~Queue()+0x60>
+            , e_(move(o.e_))
+    424f:	|  |                  31 d2                	xor    %edx,%edx
+            : b_(move(o.b_))
+    4251:	|  |                  31 f6                	xor    %esi,%esi
+            if (b_ == e_) { return None; }
+    4253:	|  |                  48 39 f2             	cmp    %rsi,%rdx
+    4256:	|  |     /----------- 75 28                	jne    4280 <nel::heapless::Queue<int, 4096ul>::~Queue()+0x50>
+    4258:	|  |     |            48 39 c8             	cmp    %rcx,%rax
+    425b:	|  |  /--|----------- 74 31                	je     428e <nel::heapless::Queue<int, 4096ul>::~Queue()+0x5e>
+            return Some(*--e_);
+    425d:	|  |  |  |  /-------> 48 83 e8 04          	sub    $0x4,%rax
+            if (b_ == e_) { return None; }
+    4261:	|  |  |  |  |         48 39 c8             	cmp    %rcx,%rax
+    4264:	|  |  |  |  |  /----- 74 09                	je     426f <nel::heapless::Queue<int, 4096ul>::~Queue()+0x3f>
+    4266:	|  |  |  |  |  |  /-> 48 83 e8 04          	sub    $0x4,%rax
+    426a:	|  |  |  |  |  |  |   48 39 c1             	cmp    %rax,%rcx
+    426d:	|  |  |  |  |  |  \-- 75 f7                	jne    4266 <nel::heapless::Queue<int, 4096ul>::~Queue()+0x36>
+        }
+    426f:	|  |  |  |  |  \----> c3                   	ret
+            , e_(move(o.e_))
+    4270:	|  \--|--|--|-------> 31 d2                	xor    %edx,%edx
+            : b_(move(o.b_))
+    4272:	|     |  |  |         31 f6                	xor    %esi,%esi
+            , e_(move(o.e_))
+    4274:	|     |  |  |         31 c0                	xor    %eax,%eax
+            : b_(move(o.b_))
+    4276:	|     |  |  |         31 c9                	xor    %ecx,%ecx
+    4278:	|     |  |  |     /-- eb 0a                	jmp    4284 <nel::heapless::Queue<int, 4096ul>::~Queue()+0x54>
+    427a:	|     |  |  |     |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+            return Some(*--e_);
+    4280:	|     |  >--|-----|-> 48 83 ea 04          	sub    $0x4,%rdx
+            if (b_ == e_) { return None; }
+    4284:	|     |  |  |     >-> 48 39 f2             	cmp    %rsi,%rdx
+    4287:	|     |  \--|-----|-- 75 f7                	jne    4280 <nel::heapless::Queue<int, 4096ul>::~Queue()+0x50>
+    4289:	|     |     |     |   48 39 c8             	cmp    %rcx,%rax
+    428c:	|     |     \-----|-- 75 cf                	jne    425d <nel::heapless::Queue<int, 4096ul>::~Queue()+0x2d>
+    428e:	|     \-----------|-> c3                   	ret
+    428f:	|                 |   90                   	nop
+            , e_(move(o.e_))
+    4290:	\-----------------|-> 48 89 c2             	mov    %rax,%rdx
+    4293:	                  |   48 8d 87 18 40 00 00 	lea    0x4018(%rdi),%rax
+    429a:	                  \-- eb e8                	jmp    4284 <nel::heapless::Queue<int, 4096ul>::~Queue()+0x54>
+    429c:	                      0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000042a0 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>:
+            if (new_cap > max_capacity) { return nullptr; }
+    42a0:	       48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    42a7:	       ff ff 1f 
+    42aa:	       48 39 f0             	cmp    %rsi,%rax
+    42ad:	/----- 72 29                	jb     42d8 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x38>
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    42af:	|      53                   	push   %rbx
+    42b0:	|      48 89 f3             	mov    %rsi,%rbx
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    42b3:	|      48 8d 34 b5 14 00 00 	lea    0x14(,%rsi,4),%rsi
+    42ba:	|      00 
+                                    : std::realloc(p, new_size);
+    42bb:	|      e8 e0 cd ff ff       	call   10a0 <realloc@plt>
+            if (new_p == nullptr) {
+    42c0:	|      48 85 c0             	test   %rax,%rax
+    42c3:	|  /-- 74 0b                	je     42d0 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x30>
+            new_n->alloc_ = new_cap;
+    42c5:	|  |   48 89 18             	mov    %rbx,(%rax)
+        }
+    42c8:	|  |   5b                   	pop    %rbx
+    42c9:	|  |   c3                   	ret
+    42ca:	|  |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+            if (new_cap > max_capacity) { return nullptr; }
+    42d0:	|  \-> 31 c0                	xor    %eax,%eax
+        }
+    42d2:	|      5b                   	pop    %rbx
+    42d3:	|      c3                   	ret
+    42d4:	|      0f 1f 40 00          	nopl   0x0(%rax)
+            if (new_cap > max_capacity) { return nullptr; }
+    42d8:	\----> 31 c0                	xor    %eax,%eax
+        }
+    42da:	       c3                   	ret
+    42db:	       0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000000042e0 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    42e0:	53                   	push   %rbx
+    42e1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    42e4:	40 0f be fe          	movsbl %sil,%edi
+    42e8:	48 8b 35 71 2d 00 00 	mov    0x2d71(%rip),%rsi        # 7060 <stderr@GLIBC_2.2.5>
+    42ef:	e8 7c cd ff ff       	call   1070 <fputc@plt>
+    return outs;
+}
+    42f4:	48 89 d8             	mov    %rbx,%rax
+    42f7:	5b                   	pop    %rbx
+    42f8:	c3                   	ret
+    42f9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000004300 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    4300:	53                   	push   %rbx
+    4301:	48 89 fb             	mov    %rdi,%rbx
+    4304:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    4307:	48 8b 35 52 2d 00 00 	mov    0x2d52(%rip),%rsi        # 7060 <stderr@GLIBC_2.2.5>
+    430e:	e8 4d cd ff ff       	call   1060 <fputs@plt>
+    return outs;
+}
+    4313:	48 89 d8             	mov    %rbx,%rax
+    4316:	5b                   	pop    %rbx
+    4317:	c3                   	ret
+    4318:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    431f:	00 
+
+0000000000004320 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    4320:	53                   	push   %rbx
+    4321:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    4324:	48 8b 3d 35 2d 00 00 	mov    0x2d35(%rip),%rdi        # 7060 <stderr@GLIBC_2.2.5>
+    432b:	40 0f b6 d6          	movzbl %sil,%edx
+    432f:	31 c0                	xor    %eax,%eax
+    4331:	48 8d 35 50 0f 00 00 	lea    0xf50(%rip),%rsi        # 5288 <sizes+0x68>
+    4338:	e8 43 cd ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    433d:	48 89 d8             	mov    %rbx,%rax
+    4340:	5b                   	pop    %rbx
+    4341:	c3                   	ret
+    4342:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    4349:	00 00 00 00 
+    434d:	0f 1f 00             	nopl   (%rax)
+
+0000000000004350 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    4350:	53                   	push   %rbx
+    4351:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    4354:	48 8b 3d 05 2d 00 00 	mov    0x2d05(%rip),%rdi        # 7060 <stderr@GLIBC_2.2.5>
+    435b:	0f b7 d6             	movzwl %si,%edx
+    435e:	31 c0                	xor    %eax,%eax
+    4360:	48 8d 35 21 0f 00 00 	lea    0xf21(%rip),%rsi        # 5288 <sizes+0x68>
+    4367:	e8 14 cd ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    436c:	48 89 d8             	mov    %rbx,%rax
+    436f:	5b                   	pop    %rbx
+    4370:	c3                   	ret
+    4371:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    4378:	00 00 00 00 
+    437c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000004380 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    4380:	53                   	push   %rbx
+    4381:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    4384:	48 8b 3d d5 2c 00 00 	mov    0x2cd5(%rip),%rdi        # 7060 <stderr@GLIBC_2.2.5>
+{
+    438b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    438d:	31 c0                	xor    %eax,%eax
+    438f:	48 8d 35 f2 0e 00 00 	lea    0xef2(%rip),%rsi        # 5288 <sizes+0x68>
+    4396:	e8 e5 cc ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    439b:	48 89 d8             	mov    %rbx,%rax
+    439e:	5b                   	pop    %rbx
+    439f:	c3                   	ret
+
+00000000000043a0 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    43a0:	53                   	push   %rbx
+    43a1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    43a4:	48 8b 3d b5 2c 00 00 	mov    0x2cb5(%rip),%rdi        # 7060 <stderr@GLIBC_2.2.5>
+{
+    43ab:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    43ad:	31 c0                	xor    %eax,%eax
+    43af:	48 8d 35 d2 0e 00 00 	lea    0xed2(%rip),%rsi        # 5288 <sizes+0x68>
+    43b6:	e8 c5 cc ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    43bb:	48 89 d8             	mov    %rbx,%rax
+    43be:	5b                   	pop    %rbx
+    43bf:	c3                   	ret
+
+00000000000043c0 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    43c0:	53                   	push   %rbx
+    43c1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    43c4:	48 8b 3d 95 2c 00 00 	mov    0x2c95(%rip),%rdi        # 7060 <stderr@GLIBC_2.2.5>
+{
+    43cb:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    43ce:	31 c0                	xor    %eax,%eax
+    43d0:	48 8d 35 b4 0e 00 00 	lea    0xeb4(%rip),%rsi        # 528b <sizes+0x6b>
+    43d7:	e8 a4 cc ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    43dc:	48 89 d8             	mov    %rbx,%rax
+    43df:	5b                   	pop    %rbx
+    43e0:	c3                   	ret
+
+Disassembly of section .fini:
+
+00000000000043e4 <_fini>:
+    43e4:	48 83 ec 08          	sub    $0x8,%rsp
+    43e8:	48 83 c4 08          	add    $0x8,%rsp
+    43ec:	c3                   	ret
@@ -0,0 +1,3504 @@
+
+target/fast/examples/bench_parse:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 7f 00 00 	mov    0x7fc5(%rip),%rax        # 8fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <abort@plt-0x10>:
+    1020:	ff 35 ca 7f 00 00    	push   0x7fca(%rip)        # 8ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 7f 00 00    	jmp    *0x7fcc(%rip)        # 8ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <abort@plt>:
+    1030:	ff 25 ca 7f 00 00    	jmp    *0x7fca(%rip)        # 9000 <abort@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <strtod@plt>:
+    1040:	ff 25 c2 7f 00 00    	jmp    *0x7fc2(%rip)        # 9008 <strtod@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <clock_gettime@plt>:
+    1050:	ff 25 ba 7f 00 00    	jmp    *0x7fba(%rip)        # 9010 <clock_gettime@GLIBC_2.17>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputs@plt>:
+    1060:	ff 25 b2 7f 00 00    	jmp    *0x7fb2(%rip)        # 9018 <fputs@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 7f 00 00    	jmp    *0x7faa(%rip)        # 9020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <strtoull@plt>:
+    1080:	ff 25 a2 7f 00 00    	jmp    *0x7fa2(%rip)        # 9028 <strtoull@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 7f 00 00    	jmp    *0x7f9a(%rip)        # 9030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010a0 <__cxa_finalize@plt>:
+    10a0:	ff 25 3a 7f 00 00    	jmp    *0x7f3a(%rip)        # 8fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10a6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010b0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10b0:	50                   	push   %rax
+    std::abort();
+    10b1:	e8 7a ff ff ff       	call   1030 <abort@plt>
+
+00000000000010b6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10b6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10b7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10ba:	4c 8d 0d f7 2f 00 00 	lea    0x2ff7(%rip),%r9        # 40b8 <_IO_stdin_used+0xb8>
+    10c1:	31 c0                	xor    %eax,%eax
+    10c3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10c7:	4c 8b 07             	mov    (%rdi),%r8
+    10ca:	48 8d 35 ed 2f 00 00 	lea    0x2fed(%rip),%rsi        # 40be <_IO_stdin_used+0xbe>
+    10d1:	48 8b 3d 88 7f 00 00 	mov    0x7f88(%rip),%rdi        # 9060 <stderr@GLIBC_2.2.5>
+    10d8:	e8 b3 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    10dd:	e8 4e ff ff ff       	call   1030 <abort@plt>
+
+00000000000010e2 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    10e2:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    10e6:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    10e9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    10ed:	31 c0                	xor    %eax,%eax
+    10ef:	57                   	push   %rdi
+    10f0:	48 8b 3d 69 7f 00 00 	mov    0x7f69(%rip),%rdi        # 9060 <stderr@GLIBC_2.2.5>
+    10f7:	4c 8d 0d ba 2f 00 00 	lea    0x2fba(%rip),%r9        # 40b8 <_IO_stdin_used+0xb8>
+    10fe:	4c 8b 06             	mov    (%rsi),%r8
+    1101:	48 8d 35 c7 2f 00 00 	lea    0x2fc7(%rip),%rsi        # 40cf <_IO_stdin_used+0xcf>
+    1108:	e8 83 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    110d:	e8 1e ff ff ff       	call   1030 <abort@plt>
+
+0000000000001112 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1112:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1116:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1119:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    111d:	31 c0                	xor    %eax,%eax
+    111f:	57                   	push   %rdi
+    1120:	48 8b 3d 39 7f 00 00 	mov    0x7f39(%rip),%rdi        # 9060 <stderr@GLIBC_2.2.5>
+    1127:	4c 8d 0d b6 2f 00 00 	lea    0x2fb6(%rip),%r9        # 40e4 <_IO_stdin_used+0xe4>
+    112e:	4c 8b 06             	mov    (%rsi),%r8
+    1131:	48 8d 35 97 2f 00 00 	lea    0x2f97(%rip),%rsi        # 40cf <_IO_stdin_used+0xcf>
+    1138:	e8 53 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    113d:	e8 ee fe ff ff       	call   1030 <abort@plt>
+    1142:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1149:	00 00 00 
+    114c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001150 <main>:
+{
+    return nel::Slice<unsigned char const>(reinterpret_cast<unsigned char const *>(p), n);
+}
+
+int main()
+{
+    1150:	                               41 57                	push   %r15
+    1152:	                               48 8d 05 c1 2e 00 00 	lea    0x2ec1(%rip),%rax        # 401a <_IO_stdin_used+0x1a>
+    1159:	                               48 8d 15 af 2e 00 00 	lea    0x2eaf(%rip),%rdx        # 400f <_IO_stdin_used+0xf>
+                                                         : 1 + next_rand(seed) % 6;
+    1160:	                               41 bb ab aa aa aa    	mov    $0xaaaaaaab,%r11d
+{
+    1166:	                               41 56                	push   %r14
+    1168:	                               66 48 0f 6e e0       	movq   %rax,%xmm4
+    116d:	                               66 48 0f 6e da       	movq   %rdx,%xmm3
+    unsigned int seed = 0x12345678;
+    1172:	                               b8 78 56 34 12       	mov    $0x12345678,%eax
+{
+    1177:	                               41 55                	push   %r13
+    1179:	                               66 0f 6c dc          	punpcklqdq %xmm4,%xmm3
+        nel::Length const n = (next_rand(seed) % 4 == 0) ? 1 + next_rand(seed) % 19
+    117d:	                               41 ba cb 6b 28 af    	mov    $0xaf286bcb,%r10d
+        buf[i++] = char('0' + next_rand(seed) % 10);
+    1183:	                               bf cd cc cc cc       	mov    $0xcccccccd,%edi
+{
+    1188:	                               41 54                	push   %r12
+    118a:	                               55                   	push   %rbp
+    nel::Index i = 0;
+    118b:	                               31 ed                	xor    %ebp,%ebp
+{
+    118d:	                               53                   	push   %rbx
+    118e:	                               48 8d 1d eb 7e 00 00 	lea    0x7eeb(%rip),%rbx        # 9080 <buf>
+    1195:	                               4c 8d 4b ff          	lea    -0x1(%rbx),%r9
+    1199:	                               48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+    11a0:	                               0f 29 1c 24          	movaps %xmm3,(%rsp)
+    while (i + 64 < n_bytes) {
+    11a4:	                               0f 1f 40 00          	nopl   0x0(%rax)
+    s ^= s << 13;
+    11a8:	                        /----> 89 c2                	mov    %eax,%edx
+    11aa:	                        |      c1 e2 0d             	shl    $0xd,%edx
+    11ad:	                        |      31 c2                	xor    %eax,%edx
+    s ^= s >> 17;
+    11af:	                        |      89 d0                	mov    %edx,%eax
+    11b1:	                        |      c1 e8 11             	shr    $0x11,%eax
+    11b4:	                        |      31 d0                	xor    %edx,%eax
+    s ^= s << 5;
+    11b6:	                        |      89 c2                	mov    %eax,%edx
+    11b8:	                        |      c1 e2 05             	shl    $0x5,%edx
+    11bb:	                        |      31 c2                	xor    %eax,%edx
+    s ^= s << 13;
+    11bd:	                        |      89 d0                	mov    %edx,%eax
+    11bf:	                        |      c1 e0 0d             	shl    $0xd,%eax
+    11c2:	                        |      31 d0                	xor    %edx,%eax
+    s ^= s >> 17;
+    11c4:	                        |      89 c1                	mov    %eax,%ecx
+    11c6:	                        |      c1 e9 11             	shr    $0x11,%ecx
+    11c9:	                        |      31 c1                	xor    %eax,%ecx
+    s ^= s << 5;
+    11cb:	                        |      89 c8                	mov    %ecx,%eax
+    11cd:	                        |      c1 e0 05             	shl    $0x5,%eax
+    11d0:	                        |      31 c8                	xor    %ecx,%eax
+        nel::Length const n = (next_rand(seed) % 4 == 0) ? 1 + next_rand(seed) % 19
+    11d2:	                        |      83 e2 03             	and    $0x3,%edx
+    11d5:	      /-----------------|----- 0f 85 15 07 00 00    	jne    18f0 <main+0x7a0>
+    11db:	      |                 |      89 c1                	mov    %eax,%ecx
+    11dd:	      |                 |      89 c2                	mov    %eax,%edx
+    11df:	      |                 |      49 0f af ca          	imul   %r10,%rcx
+    11e3:	      |                 |      48 c1 e9 20          	shr    $0x20,%rcx
+    11e7:	      |                 |      29 ca                	sub    %ecx,%edx
+    11e9:	      |                 |      d1 ea                	shr    %edx
+    11eb:	      |                 |      01 ca                	add    %ecx,%edx
+    11ed:	      |                 |      c1 ea 04             	shr    $0x4,%edx
+    11f0:	      |                 |      8d 0c d2             	lea    (%rdx,%rdx,8),%ecx
+    11f3:	      |                 |      8d 0c 4a             	lea    (%rdx,%rcx,2),%ecx
+    11f6:	      |                 |      89 c2                	mov    %eax,%edx
+    11f8:	      |                 |      29 ca                	sub    %ecx,%edx
+    11fa:	      |                 |      44 8d 42 01          	lea    0x1(%rdx),%r8d
+    s ^= s << 13;
+    11fe:	      |  /--------------|----> 89 c2                	mov    %eax,%edx
+    1200:	      |  |              |      49 8d 34 29          	lea    (%r9,%rbp,1),%rsi
+    1204:	      |  |              |      c1 e2 0d             	shl    $0xd,%edx
+    1207:	      |  |              |      4c 01 c6             	add    %r8,%rsi
+    120a:	      |  |              |      31 d0                	xor    %edx,%eax
+    s ^= s >> 17;
+    120c:	      |  |              |      89 c2                	mov    %eax,%edx
+    120e:	      |  |              |      c1 ea 11             	shr    $0x11,%edx
+    1211:	      |  |              |      31 c2                	xor    %eax,%edx
+    s ^= s << 5;
+    1213:	      |  |              |      89 d0                	mov    %edx,%eax
+    1215:	      |  |              |      c1 e0 05             	shl    $0x5,%eax
+    1218:	      |  |              |      31 d0                	xor    %edx,%eax
+    buf[i++] = char('1' + next_rand(seed) % 9);
+    121a:	      |  |              |      89 c2                	mov    %eax,%edx
+    121c:	      |  |              |      48 69 d2 39 8e e3 38 	imul   $0x38e38e39,%rdx,%rdx
+    1223:	      |  |              |      48 c1 ea 21          	shr    $0x21,%rdx
+    1227:	      |  |              |      8d 0c d2             	lea    (%rdx,%rdx,8),%ecx
+    122a:	      |  |              |      89 c2                	mov    %eax,%edx
+    122c:	      |  |              |      29 ca                	sub    %ecx,%edx
+    122e:	      |  |              |      48 8d 0c 2b          	lea    (%rbx,%rbp,1),%rcx
+    1232:	      |  |              |      83 c2 31             	add    $0x31,%edx
+    1235:	      |  |              |      88 14 2b             	mov    %dl,(%rbx,%rbp,1)
+    for (nel::Index k = 1; k < n; ++k) {
+    1238:	      |  |              |      49 83 f8 01          	cmp    $0x1,%r8
+    123c:	/-----|--|--------------|----- 0f 84 62 07 00 00    	je     19a4 <main+0x854>
+    1242:	|     |  |              |      66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    s ^= s << 13;
+    1248:	|     |  |              |  /-> 89 c2                	mov    %eax,%edx
+    for (nel::Index k = 1; k < n; ++k) {
+    124a:	|     |  |              |  |   48 83 c1 01          	add    $0x1,%rcx
+    s ^= s << 13;
+    124e:	|     |  |              |  |   c1 e2 0d             	shl    $0xd,%edx
+    1251:	|     |  |              |  |   31 d0                	xor    %edx,%eax
+    s ^= s >> 17;
+    1253:	|     |  |              |  |   89 c2                	mov    %eax,%edx
+    1255:	|     |  |              |  |   c1 ea 11             	shr    $0x11,%edx
+    1258:	|     |  |              |  |   31 c2                	xor    %eax,%edx
+    s ^= s << 5;
+    125a:	|     |  |              |  |   89 d0                	mov    %edx,%eax
+    125c:	|     |  |              |  |   c1 e0 05             	shl    $0x5,%eax
+    125f:	|     |  |              |  |   31 d0                	xor    %edx,%eax
+        buf[i++] = char('0' + next_rand(seed) % 10);
+    1261:	|     |  |              |  |   89 c2                	mov    %eax,%edx
+    1263:	|     |  |              |  |   48 0f af d7          	imul   %rdi,%rdx
+    1267:	|     |  |              |  |   48 c1 ea 23          	shr    $0x23,%rdx
+    126b:	|     |  |              |  |   44 8d 24 92          	lea    (%rdx,%rdx,4),%r12d
+    126f:	|     |  |              |  |   89 c2                	mov    %eax,%edx
+    1271:	|     |  |              |  |   45 01 e4             	add    %r12d,%r12d
+    1274:	|     |  |              |  |   44 29 e2             	sub    %r12d,%edx
+    1277:	|     |  |              |  |   83 c2 30             	add    $0x30,%edx
+    127a:	|     |  |              |  |   88 11                	mov    %dl,(%rcx)
+    for (nel::Index k = 1; k < n; ++k) {
+    127c:	|     |  |              |  |   48 39 f1             	cmp    %rsi,%rcx
+    127f:	|     |  |              |  \-- 75 c7                	jne    1248 <main+0xf8>
+        buf[i++] = char('0' + next_rand(seed) % 10);
+    1281:	|     |  |              |      49 01 e8             	add    %rbp,%r8
+    while (i + 64 < n_bytes) {
+    1284:	|  /--|--|--------------|----> 49 8d 50 41          	lea    0x41(%r8),%rdx
+        buf[i++] = '\n';
+    1288:	|  |  |  |              |      42 c6 04 03 0a       	movb   $0xa,(%rbx,%r8,1)
+    128d:	|  |  |  |              |      49 8d 68 01          	lea    0x1(%r8),%rbp
+    while (i + 64 < n_bytes) {
+    1291:	|  |  |  |              |      48 81 fa ff ff 0f 00 	cmp    $0xfffff,%rdx
+    1298:	|  |  |  |              \----- 0f 86 0a ff ff ff    	jbe    11a8 <main+0x58>
+    {
+        nel::Length const n = fill_ints();
+        nel::log << n << " bytes of ints\n";
+    129e:	|  |  |  |                     48 89 ee             	mov    %rbp,%rsi
+    12a1:	|  |  |  |                     48 8d 3d d9 7d 10 00 	lea    0x107dd9(%rip),%rdi        # 109081 <nel::log>
+{
+
+inline long unsigned int now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    12a8:	|  |  |  |                     4c 8d 64 24 70       	lea    0x70(%rsp),%r12
+    Sum r = 0;
+    12ad:	|  |  |  |                     45 31 ed             	xor    %r13d,%r13d
+    buf[i] = '\0';
+    12b0:	|  |  |  |                     42 c6 44 03 01 00    	movb   $0x0,0x1(%rbx,%r8,1)
+        nel::log << n << " bytes of ints\n";
+    12b6:	|  |  |  |                     e8 35 0a 00 00       	call   1cf0 <nel::operator<<(nel::Log&, unsigned long)>
+    12bb:	|  |  |  |                     48 8d 35 70 2d 00 00 	lea    0x2d70(%rip),%rsi        # 4032 <_IO_stdin_used+0x32>
+    12c2:	|  |  |  |                     48 89 c7             	mov    %rax,%rdi
+    12c5:	|  |  |  |                     e8 66 09 00 00       	call   1c30 <nel::operator<<(nel::Log&, char const*)>
+    12ca:	|  |  |  |                     4c 89 e6             	mov    %r12,%rsi
+    12cd:	|  |  |  |                     bf 01 00 00 00       	mov    $0x1,%edi
+    12d2:	|  |  |  |                     e8 79 fd ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    12d7:	|  |  |  |                     48 69 44 24 70 00 ca 	imul   $0x3b9aca00,0x70(%rsp),%rax
+    12de:	|  |  |  |                     9a 3b 
+    12e0:	|  |  |  |                     48 c7 44 24 18 0a 00 	movq   $0xa,0x18(%rsp)
+    12e7:	|  |  |  |                     00 00 
+    12e9:	|  |  |  |                     48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    12ee:	|  |  |  |                     48 8b 44 24 78       	mov    0x78(%rsp),%rax
+    12f3:	|  |  |  |                     48 89 44 24 28       	mov    %rax,0x28(%rsp)
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    12f8:	|  |  |  |                     0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    12ff:	|  |  |  |                     00 
+            nel::Index i = 0;
+    1300:	|  |  |  |              /----> 45 31 ff             	xor    %r15d,%r15d
+    1303:	|  |  |  |              |      0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+                i += parse_one(buf + i, n - i, r) + 1;
+    1308:	|  |  |  |              |  /-> 4e 8d 34 3b          	lea    (%rbx,%r15,1),%r14
+        run("  strtoull   ", n, [](char const *p, nel::Length, Sum &r) -> nel::Length {
+            char *e;
+            r += std::strtoull(p, &e, 10);
+    130c:	|  |  |  |              |  |   ba 0a 00 00 00       	mov    $0xa,%edx
+    1311:	|  |  |  |              |  |   4c 89 e6             	mov    %r12,%rsi
+    1314:	|  |  |  |              |  |   4c 89 f7             	mov    %r14,%rdi
+    1317:	|  |  |  |              |  |   e8 64 fd ff ff       	call   1080 <strtoull@plt>
+    131c:	|  |  |  |              |  |   49 01 c5             	add    %rax,%r13
+            return nel::Length(e - p);
+    131f:	|  |  |  |              |  |   48 8b 44 24 70       	mov    0x70(%rsp),%rax
+    1324:	|  |  |  |              |  |   4c 29 f0             	sub    %r14,%rax
+                i += parse_one(buf + i, n - i, r) + 1;
+    1327:	|  |  |  |              |  |   4e 8d 7c 38 01       	lea    0x1(%rax,%r15,1),%r15
+            while (i < n) {
+    132c:	|  |  |  |              |  |   49 39 ef             	cmp    %rbp,%r15
+    132f:	|  |  |  |              |  \-- 72 d7                	jb     1308 <main+0x1b8>
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    1331:	|  |  |  |              |      48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+    1337:	|  |  |  |              \----- 75 c7                	jne    1300 <main+0x1b0>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1339:	|  |  |  |                     4c 89 e6             	mov    %r12,%rsi
+    133c:	|  |  |  |                     bf 01 00 00 00       	mov    $0x1,%edi
+    1341:	|  |  |  |                     41 bf 0a 00 00 00    	mov    $0xa,%r15d
+    1347:	|  |  |  |                     e8 04 fd ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    134c:	|  |  |  |                     48 8b 44 24 28       	mov    0x28(%rsp),%rax
+    1351:	|  |  |  |                     48 69 74 24 70 00 ca 	imul   $0x3b9aca00,0x70(%rsp),%rsi
+    1358:	|  |  |  |                     9a 3b 
+    bench::report(name, t, n_reps * n);
+    135a:	|  |  |  |                     48 8d 3d e1 2c 00 00 	lea    0x2ce1(%rip),%rdi        # 4042 <_IO_stdin_used+0x42>
+    1361:	|  |  |  |                     48 29 c6             	sub    %rax,%rsi
+    1364:	|  |  |  |                     48 8d 44 ad 00       	lea    0x0(%rbp,%rbp,4),%rax
+template<typename F>
+long unsigned int time_ns(F &&f)
+{
+    long unsigned int const b = now_ns();
+    f();
+    return now_ns() - b;
+    1369:	|  |  |  |                     48 03 74 24 78       	add    0x78(%rsp),%rsi
+    136e:	|  |  |  |                     48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+    1372:	|  |  |  |                     48 8b 44 24 20       	mov    0x20(%rsp),%rax
+    1377:	|  |  |  |                     48 89 54 24 38       	mov    %rdx,0x38(%rsp)
+    137c:	|  |  |  |                     48 29 c6             	sub    %rax,%rsi
+    137f:	|  |  |  |                     e8 cc 07 00 00       	call   1b50 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << r << '\n';
+    1384:	|  |  |  |                     48 8d 35 c5 2c 00 00 	lea    0x2cc5(%rip),%rsi        # 4050 <_IO_stdin_used+0x50>
+    138b:	|  |  |  |                     48 8d 3d ef 7c 10 00 	lea    0x107cef(%rip),%rdi        # 109081 <nel::log>
+    1392:	|  |  |  |                     e8 99 08 00 00       	call   1c30 <nel::operator<<(nel::Log&, char const*)>
+    1397:	|  |  |  |                     4c 89 ee             	mov    %r13,%rsi
+    Sum r = 0;
+    139a:	|  |  |  |                     45 31 ed             	xor    %r13d,%r13d
+    nel::log << "  sum: " << r << '\n';
+    139d:	|  |  |  |                     48 89 c7             	mov    %rax,%rdi
+    13a0:	|  |  |  |                     e8 4b 09 00 00       	call   1cf0 <nel::operator<<(nel::Log&, unsigned long)>
+    13a5:	|  |  |  |                     be 0a 00 00 00       	mov    $0xa,%esi
+    13aa:	|  |  |  |                     48 89 c7             	mov    %rax,%rdi
+    13ad:	|  |  |  |                     e8 5e 08 00 00       	call   1c10 <nel::operator<<(nel::Log&, char)>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    13b2:	|  |  |  |                     4c 89 e6             	mov    %r12,%rsi
+    13b5:	|  |  |  |                     bf 01 00 00 00       	mov    $0x1,%edi
+    13ba:	|  |  |  |                     e8 91 fc ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    13bf:	|  |  |  |                     48 69 44 24 70 00 ca 	imul   $0x3b9aca00,0x70(%rsp),%rax
+    13c6:	|  |  |  |                     9a 3b 
+    13c8:	|  |  |  |                     48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    13cd:	|  |  |  |                     48 8b 44 24 78       	mov    0x78(%rsp),%rax
+    13d2:	|  |  |  |                     48 89 44 24 30       	mov    %rax,0x30(%rsp)
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    13d7:	|  |  |  |                     48 8d 44 24 50       	lea    0x50(%rsp),%rax
+    13dc:	|  |  |  |                     48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    13e1:	|  |  |  |                     48 8d 44 24 40       	lea    0x40(%rsp),%rax
+    13e6:	|  |  |  |                     48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    13eb:	|  |  |  |                     0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+            nel::Index i = 0;
+    13f0:	|  |  |  |              /----> 45 31 f6             	xor    %r14d,%r14d
+    13f3:	|  |  |  |              |      0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+                i += parse_one(buf + i, n - i, r) + 1;
+    13f8:	|  |  |  |              |  /-> 4a 8d 14 33          	lea    (%rbx,%r14,1),%rdx
+        });
+        run("  parse_u64  ", n, [](char const *p, nel::Length const n, Sum &r) {
+            auto const v = nel::parse_u64(field(p, n)).unwrap();
+    13fc:	|  |  |  |              |  |   48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    1401:	|  |  |  |              |  |   48 8b 7c 24 20       	mov    0x20(%rsp),%rdi
+                i += parse_one(buf + i, n - i, r) + 1;
+    1406:	|  |  |  |              |  |   48 89 54 24 40       	mov    %rdx,0x40(%rsp)
+    140b:	|  |  |  |              |  |   48 89 ea             	mov    %rbp,%rdx
+    140e:	|  |  |  |              |  |   4c 29 f2             	sub    %r14,%rdx
+    1411:	|  |  |  |              |  |   48 89 54 24 48       	mov    %rdx,0x48(%rsp)
+            auto const v = nel::parse_u64(field(p, n)).unwrap();
+    1416:	|  |  |  |              |  |   e8 d5 0d 00 00       	call   21f0 <nel::parse_u64(nel::Slice<unsigned char const> const&)>
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    141b:	|  |  |  |              |  |   66 0f 6f 0c 24       	movdqa (%rsp),%xmm1
+        template<typename V, typename Fn1, typename Fn2>
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+        {
+            // a consuming matcher..
+            // that moves the value to the closures..
+            auto tag = tag_;
+    1420:	|  |  |  |              |  |   8b 54 24 50          	mov    0x50(%rsp),%edx
+            , file_name_(file_name)
+            , line_num_(line_num)
+    1424:	|  |  |  |              |  |   c7 84 24 80 00 00 00 	movl   $0x75,0x80(%rsp)
+    142b:	|  |  |  |              |  |   75 00 00 00 
+            tag_ = Tag::INVAL;
+    142f:	|  |  |  |              |  |   c7 44 24 50 00 00 00 	movl   $0x0,0x50(%rsp)
+    1436:	|  |  |  |              |  |   00 
+            : fn_name_(fn_name)
+    1437:	|  |  |  |              |  |   0f 29 4c 24 70       	movaps %xmm1,0x70(%rsp)
+            switch (tag) { // result-consume
+    143c:	|  |  |  |              |  |   83 fa 01             	cmp    $0x1,%edx
+    143f:	|  |  |  |  /-----------|--|-- 0f 85 8b 04 00 00    	jne    18d0 <main+0x780>
+                i += parse_one(buf + i, n - i, r) + 1;
+    1445:	|  |  |  |  |           |  |   48 8b 54 24 60       	mov    0x60(%rsp),%rdx
+            r += v.first;
+    144a:	|  |  |  |  |           |  |   4c 03 6c 24 58       	add    0x58(%rsp),%r13
+                i += parse_one(buf + i, n - i, r) + 1;
+    144f:	|  |  |  |  |           |  |   4d 8d 74 16 01       	lea    0x1(%r14,%rdx,1),%r14
+            while (i < n) {
+    1454:	|  |  |  |  |           |  |   49 39 ee             	cmp    %rbp,%r14
+    1457:	|  |  |  |  |           |  \-- 72 9f                	jb     13f8 <main+0x2a8>
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    1459:	|  |  |  |  |           |      4c 89 f8             	mov    %r15,%rax
+    145c:	|  |  |  |  |           |      48 83 e8 01          	sub    $0x1,%rax
+    1460:	|  |  |  |  |           |      49 89 c7             	mov    %rax,%r15
+    1463:	|  |  |  |  |           \----- 75 8b                	jne    13f0 <main+0x2a0>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1465:	|  |  |  |  |                  4c 89 e6             	mov    %r12,%rsi
+    1468:	|  |  |  |  |                  bf 01 00 00 00       	mov    $0x1,%edi
+    nel::Index i = 0;
+    146d:	|  |  |  |  |                  31 ed                	xor    %ebp,%ebp
+    146f:	|  |  |  |  |                  e8 dc fb ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1474:	|  |  |  |  |                  48 8b 44 24 30       	mov    0x30(%rsp),%rax
+    1479:	|  |  |  |  |                  48 69 74 24 70 00 ca 	imul   $0x3b9aca00,0x70(%rsp),%rsi
+    1480:	|  |  |  |  |                  9a 3b 
+    bench::report(name, t, n_reps * n);
+    1482:	|  |  |  |  |                  48 8d 3d f3 2b 00 00 	lea    0x2bf3(%rip),%rdi        # 407c <_IO_stdin_used+0x7c>
+    1489:	|  |  |  |  |                  48 8b 54 24 38       	mov    0x38(%rsp),%rdx
+    148e:	|  |  |  |  |                  48 29 c6             	sub    %rax,%rsi
+    return now_ns() - b;
+    1491:	|  |  |  |  |                  48 8b 44 24 28       	mov    0x28(%rsp),%rax
+    1496:	|  |  |  |  |                  48 03 74 24 78       	add    0x78(%rsp),%rsi
+    149b:	|  |  |  |  |                  48 29 c6             	sub    %rax,%rsi
+    149e:	|  |  |  |  |                  e8 ad 06 00 00       	call   1b50 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << r << '\n';
+    14a3:	|  |  |  |  |                  48 8d 35 a6 2b 00 00 	lea    0x2ba6(%rip),%rsi        # 4050 <_IO_stdin_used+0x50>
+    14aa:	|  |  |  |  |                  48 8d 3d d0 7b 10 00 	lea    0x107bd0(%rip),%rdi        # 109081 <nel::log>
+    14b1:	|  |  |  |  |                  e8 7a 07 00 00       	call   1c30 <nel::operator<<(nel::Log&, char const*)>
+    14b6:	|  |  |  |  |                  4c 89 ee             	mov    %r13,%rsi
+    14b9:	|  |  |  |  |                  48 89 c7             	mov    %rax,%rdi
+    14bc:	|  |  |  |  |                  e8 2f 08 00 00       	call   1cf0 <nel::operator<<(nel::Log&, unsigned long)>
+    14c1:	|  |  |  |  |                  be 0a 00 00 00       	mov    $0xa,%esi
+    14c6:	|  |  |  |  |                  48 89 c7             	mov    %rax,%rdi
+    14c9:	|  |  |  |  |                  e8 42 07 00 00       	call   1c10 <nel::operator<<(nel::Log&, char)>
+    unsigned int seed = 0x12345678;
+    14ce:	|  |  |  |  |                  b8 78 56 34 12       	mov    $0x12345678,%eax
+        put_digits(i, seed, 1 + next_rand(seed) % 5);
+    14d3:	|  |  |  |  |                  be cd cc cc cc       	mov    $0xcccccccd,%esi
+        put_digits(i, seed, 1 + next_rand(seed) % 12);
+    14d8:	|  |  |  |  |                  41 b9 ab aa aa aa    	mov    $0xaaaaaaab,%r9d
+    14de:	|  |  |  |  |                  66 90                	xchg   %ax,%ax
+    s ^= s << 13;
+    14e0:	|  |  |  |  |        /-------> 89 c2                	mov    %eax,%edx
+    14e2:	|  |  |  |  |        |         c1 e2 0d             	shl    $0xd,%edx
+    14e5:	|  |  |  |  |        |         31 c2                	xor    %eax,%edx
+    s ^= s >> 17;
+    14e7:	|  |  |  |  |        |         89 d0                	mov    %edx,%eax
+    14e9:	|  |  |  |  |        |         c1 e8 11             	shr    $0x11,%eax
+    14ec:	|  |  |  |  |        |         31 d0                	xor    %edx,%eax
+    s ^= s << 5;
+    14ee:	|  |  |  |  |        |         89 c2                	mov    %eax,%edx
+    14f0:	|  |  |  |  |        |         c1 e2 05             	shl    $0x5,%edx
+    14f3:	|  |  |  |  |        |         31 c2                	xor    %eax,%edx
+        if (next_rand(seed) % 2 == 0) { buf[i++] = '-'; }
+    14f5:	|  |  |  |  |        |         a8 01                	test   $0x1,%al
+    14f7:	|  |  |  |  |        |     /-- 75 08                	jne    1501 <main+0x3b1>
+    14f9:	|  |  |  |  |        |     |   c6 04 2b 2d          	movb   $0x2d,(%rbx,%rbp,1)
+    14fd:	|  |  |  |  |        |     |   48 83 c5 01          	add    $0x1,%rbp
+    s ^= s << 13;
+    1501:	|  |  |  |  |        |     \-> 89 d0                	mov    %edx,%eax
+    1503:	|  |  |  |  |        |         c1 e0 0d             	shl    $0xd,%eax
+    1506:	|  |  |  |  |        |         31 d0                	xor    %edx,%eax
+    s ^= s >> 17;
+    1508:	|  |  |  |  |        |         89 c2                	mov    %eax,%edx
+    150a:	|  |  |  |  |        |         c1 ea 11             	shr    $0x11,%edx
+    150d:	|  |  |  |  |        |         31 c2                	xor    %eax,%edx
+    s ^= s << 5;
+    150f:	|  |  |  |  |        |         89 d0                	mov    %edx,%eax
+    1511:	|  |  |  |  |        |         c1 e0 05             	shl    $0x5,%eax
+    1514:	|  |  |  |  |        |         31 d0                	xor    %edx,%eax
+        put_digits(i, seed, 1 + next_rand(seed) % 5);
+    1516:	|  |  |  |  |        |         41 89 c0             	mov    %eax,%r8d
+    1519:	|  |  |  |  |        |         4c 0f af c6          	imul   %rsi,%r8
+    151d:	|  |  |  |  |        |         49 c1 e8 22          	shr    $0x22,%r8
+    1521:	|  |  |  |  |        |         43 8d 14 80          	lea    (%r8,%r8,4),%edx
+    1525:	|  |  |  |  |        |         41 89 c0             	mov    %eax,%r8d
+    1528:	|  |  |  |  |        |         41 29 d0             	sub    %edx,%r8d
+    s ^= s << 13;
+    152b:	|  |  |  |  |        |         89 c2                	mov    %eax,%edx
+    152d:	|  |  |  |  |        |         c1 e2 0d             	shl    $0xd,%edx
+        put_digits(i, seed, 1 + next_rand(seed) % 5);
+    1530:	|  |  |  |  |        |         45 8d 50 01          	lea    0x1(%r8),%r10d
+    s ^= s << 13;
+    1534:	|  |  |  |  |        |         31 d0                	xor    %edx,%eax
+    s ^= s >> 17;
+    1536:	|  |  |  |  |        |         89 c2                	mov    %eax,%edx
+    1538:	|  |  |  |  |        |         c1 ea 11             	shr    $0x11,%edx
+    153b:	|  |  |  |  |        |         31 c2                	xor    %eax,%edx
+    s ^= s << 5;
+    153d:	|  |  |  |  |        |         89 d0                	mov    %edx,%eax
+    153f:	|  |  |  |  |        |         c1 e0 05             	shl    $0x5,%eax
+    1542:	|  |  |  |  |        |         31 d0                	xor    %edx,%eax
+    buf[i++] = char('1' + next_rand(seed) % 9);
+    1544:	|  |  |  |  |        |         48 8d 55 01          	lea    0x1(%rbp),%rdx
+    1548:	|  |  |  |  |        |         89 c1                	mov    %eax,%ecx
+    154a:	|  |  |  |  |        |         48 69 c9 39 8e e3 38 	imul   $0x38e38e39,%rcx,%rcx
+    1551:	|  |  |  |  |        |         48 c1 e9 21          	shr    $0x21,%rcx
+    1555:	|  |  |  |  |        |         8d 3c c9             	lea    (%rcx,%rcx,8),%edi
+    1558:	|  |  |  |  |        |         89 c1                	mov    %eax,%ecx
+    155a:	|  |  |  |  |        |         29 f9                	sub    %edi,%ecx
+    155c:	|  |  |  |  |        |         83 c1 31             	add    $0x31,%ecx
+    155f:	|  |  |  |  |        |         88 0c 2b             	mov    %cl,(%rbx,%rbp,1)
+    for (nel::Index k = 1; k < n; ++k) {
+    1562:	|  |  |  |  |        |         45 85 c0             	test   %r8d,%r8d
+    1565:	|  |  |  |  |        |  /----- 74 4f                	je     15b6 <main+0x466>
+    1567:	|  |  |  |  |        |  |      49 01 d8             	add    %rbx,%r8
+    156a:	|  |  |  |  |        |  |      48 8d 3c 2b          	lea    (%rbx,%rbp,1),%rdi
+    156e:	|  |  |  |  |        |  |      49 01 e8             	add    %rbp,%r8
+    1571:	|  |  |  |  |        |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    s ^= s << 13;
+    1578:	|  |  |  |  |        |  |  /-> 89 c1                	mov    %eax,%ecx
+    for (nel::Index k = 1; k < n; ++k) {
+    157a:	|  |  |  |  |        |  |  |   48 83 c7 01          	add    $0x1,%rdi
+    s ^= s << 13;
+    157e:	|  |  |  |  |        |  |  |   c1 e1 0d             	shl    $0xd,%ecx
+    1581:	|  |  |  |  |        |  |  |   31 c8                	xor    %ecx,%eax
+    s ^= s >> 17;
+    1583:	|  |  |  |  |        |  |  |   89 c1                	mov    %eax,%ecx
+    1585:	|  |  |  |  |        |  |  |   c1 e9 11             	shr    $0x11,%ecx
+    1588:	|  |  |  |  |        |  |  |   31 c1                	xor    %eax,%ecx
+    s ^= s << 5;
+    158a:	|  |  |  |  |        |  |  |   89 c8                	mov    %ecx,%eax
+    158c:	|  |  |  |  |        |  |  |   c1 e0 05             	shl    $0x5,%eax
+    158f:	|  |  |  |  |        |  |  |   31 c8                	xor    %ecx,%eax
+        buf[i++] = char('0' + next_rand(seed) % 10);
+    1591:	|  |  |  |  |        |  |  |   89 c1                	mov    %eax,%ecx
+    1593:	|  |  |  |  |        |  |  |   48 0f af ce          	imul   %rsi,%rcx
+    1597:	|  |  |  |  |        |  |  |   48 c1 e9 23          	shr    $0x23,%rcx
+    159b:	|  |  |  |  |        |  |  |   44 8d 1c 89          	lea    (%rcx,%rcx,4),%r11d
+    159f:	|  |  |  |  |        |  |  |   89 c1                	mov    %eax,%ecx
+    15a1:	|  |  |  |  |        |  |  |   45 01 db             	add    %r11d,%r11d
+    15a4:	|  |  |  |  |        |  |  |   44 29 d9             	sub    %r11d,%ecx
+    15a7:	|  |  |  |  |        |  |  |   83 c1 30             	add    $0x30,%ecx
+    15aa:	|  |  |  |  |        |  |  |   88 0f                	mov    %cl,(%rdi)
+    for (nel::Index k = 1; k < n; ++k) {
+    15ac:	|  |  |  |  |        |  |  |   4c 39 c7             	cmp    %r8,%rdi
+    15af:	|  |  |  |  |        |  |  \-- 75 c7                	jne    1578 <main+0x428>
+        buf[i++] = char('0' + next_rand(seed) % 10);
+    15b1:	|  |  |  |  |        |  |      49 8d 54 12 ff       	lea    -0x1(%r10,%rdx,1),%rdx
+    s ^= s << 13;
+    15b6:	|  |  |  |  |        |  \----> 89 c1                	mov    %eax,%ecx
+        buf[i++] = '.';
+    15b8:	|  |  |  |  |        |         c6 04 13 2e          	movb   $0x2e,(%rbx,%rdx,1)
+    15bc:	|  |  |  |  |        |         4c 8d 42 01          	lea    0x1(%rdx),%r8
+    s ^= s << 13;
+    15c0:	|  |  |  |  |        |         c1 e1 0d             	shl    $0xd,%ecx
+    15c3:	|  |  |  |  |        |         31 c8                	xor    %ecx,%eax
+    s ^= s >> 17;
+    15c5:	|  |  |  |  |        |         89 c1                	mov    %eax,%ecx
+    15c7:	|  |  |  |  |        |         c1 e9 11             	shr    $0x11,%ecx
+    15ca:	|  |  |  |  |        |         31 c1                	xor    %eax,%ecx
+    s ^= s << 5;
+    15cc:	|  |  |  |  |        |         89 c8                	mov    %ecx,%eax
+    15ce:	|  |  |  |  |        |         c1 e0 05             	shl    $0x5,%eax
+    15d1:	|  |  |  |  |        |         31 c8                	xor    %ecx,%eax
+        put_digits(i, seed, 1 + next_rand(seed) % 12);
+    15d3:	|  |  |  |  |        |         41 89 c3             	mov    %eax,%r11d
+    15d6:	|  |  |  |  |        |         4d 0f af d9          	imul   %r9,%r11
+    15da:	|  |  |  |  |        |         49 c1 eb 23          	shr    $0x23,%r11
+    15de:	|  |  |  |  |        |         43 8d 0c 5b          	lea    (%r11,%r11,2),%ecx
+    15e2:	|  |  |  |  |        |         41 89 c3             	mov    %eax,%r11d
+    15e5:	|  |  |  |  |        |         c1 e1 02             	shl    $0x2,%ecx
+    15e8:	|  |  |  |  |        |         41 29 cb             	sub    %ecx,%r11d
+    s ^= s << 13;
+    15eb:	|  |  |  |  |        |         89 c1                	mov    %eax,%ecx
+    15ed:	|  |  |  |  |        |         c1 e1 0d             	shl    $0xd,%ecx
+        put_digits(i, seed, 1 + next_rand(seed) % 12);
+    15f0:	|  |  |  |  |        |         45 8d 53 01          	lea    0x1(%r11),%r10d
+    s ^= s << 13;
+    15f4:	|  |  |  |  |        |         31 c8                	xor    %ecx,%eax
+    s ^= s >> 17;
+    15f6:	|  |  |  |  |        |         89 c1                	mov    %eax,%ecx
+    15f8:	|  |  |  |  |        |         c1 e9 11             	shr    $0x11,%ecx
+    15fb:	|  |  |  |  |        |         31 c1                	xor    %eax,%ecx
+    s ^= s << 5;
+    15fd:	|  |  |  |  |        |         89 c8                	mov    %ecx,%eax
+    15ff:	|  |  |  |  |        |         c1 e0 05             	shl    $0x5,%eax
+    1602:	|  |  |  |  |        |         31 c8                	xor    %ecx,%eax
+    buf[i++] = char('1' + next_rand(seed) % 9);
+    1604:	|  |  |  |  |        |         89 c1                	mov    %eax,%ecx
+    1606:	|  |  |  |  |        |         48 69 c9 39 8e e3 38 	imul   $0x38e38e39,%rcx,%rcx
+    160d:	|  |  |  |  |        |         48 c1 e9 21          	shr    $0x21,%rcx
+    1611:	|  |  |  |  |        |         8d 3c c9             	lea    (%rcx,%rcx,8),%edi
+    1614:	|  |  |  |  |        |         89 c1                	mov    %eax,%ecx
+    1616:	|  |  |  |  |        |         29 f9                	sub    %edi,%ecx
+    1618:	|  |  |  |  |        |         44 89 df             	mov    %r11d,%edi
+    161b:	|  |  |  |  |        |         83 c1 31             	add    $0x31,%ecx
+    161e:	|  |  |  |  |        |         88 4c 13 01          	mov    %cl,0x1(%rbx,%rdx,1)
+    for (nel::Index k = 1; k < n; ++k) {
+    1622:	|  |  |  |  |        |         48 8d 0c 13          	lea    (%rbx,%rdx,1),%rcx
+    buf[i++] = char('1' + next_rand(seed) % 9);
+    1626:	|  |  |  |  |        |         48 83 c2 02          	add    $0x2,%rdx
+    162a:	|  |  |  |  |        |         48 01 cf             	add    %rcx,%rdi
+    for (nel::Index k = 1; k < n; ++k) {
+    162d:	|  |  |  |  |        |         45 85 db             	test   %r11d,%r11d
+    1630:	|  |  |  |  |        |  /----- 74 44                	je     1676 <main+0x526>
+    1632:	|  |  |  |  |        |  |      66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    s ^= s << 13;
+    1638:	|  |  |  |  |        |  |  /-> 89 c2                	mov    %eax,%edx
+    for (nel::Index k = 1; k < n; ++k) {
+    163a:	|  |  |  |  |        |  |  |   48 83 c1 01          	add    $0x1,%rcx
+    s ^= s << 13;
+    163e:	|  |  |  |  |        |  |  |   c1 e2 0d             	shl    $0xd,%edx
+    1641:	|  |  |  |  |        |  |  |   31 d0                	xor    %edx,%eax
+    s ^= s >> 17;
+    1643:	|  |  |  |  |        |  |  |   89 c2                	mov    %eax,%edx
+    1645:	|  |  |  |  |        |  |  |   c1 ea 11             	shr    $0x11,%edx
+    1648:	|  |  |  |  |        |  |  |   31 c2                	xor    %eax,%edx
+    s ^= s << 5;
+    164a:	|  |  |  |  |        |  |  |   89 d0                	mov    %edx,%eax
+    164c:	|  |  |  |  |        |  |  |   c1 e0 05             	shl    $0x5,%eax
+    164f:	|  |  |  |  |        |  |  |   31 d0                	xor    %edx,%eax
+        buf[i++] = char('0' + next_rand(seed) % 10);
+    1651:	|  |  |  |  |        |  |  |   89 c2                	mov    %eax,%edx
+    1653:	|  |  |  |  |        |  |  |   48 0f af d6          	imul   %rsi,%rdx
+    1657:	|  |  |  |  |        |  |  |   48 c1 ea 23          	shr    $0x23,%rdx
+    165b:	|  |  |  |  |        |  |  |   44 8d 1c 92          	lea    (%rdx,%rdx,4),%r11d
+    165f:	|  |  |  |  |        |  |  |   89 c2                	mov    %eax,%edx
+    1661:	|  |  |  |  |        |  |  |   45 01 db             	add    %r11d,%r11d
+    1664:	|  |  |  |  |        |  |  |   44 29 da             	sub    %r11d,%edx
+    1667:	|  |  |  |  |        |  |  |   83 c2 30             	add    $0x30,%edx
+    166a:	|  |  |  |  |        |  |  |   88 51 01             	mov    %dl,0x1(%rcx)
+    for (nel::Index k = 1; k < n; ++k) {
+    166d:	|  |  |  |  |        |  |  |   48 39 f9             	cmp    %rdi,%rcx
+    1670:	|  |  |  |  |        |  |  \-- 75 c6                	jne    1638 <main+0x4e8>
+        buf[i++] = char('0' + next_rand(seed) % 10);
+    1672:	|  |  |  |  |        |  |      4b 8d 14 10          	lea    (%r8,%r10,1),%rdx
+    s ^= s << 13;
+    1676:	|  |  |  |  |        |  \----> 89 c1                	mov    %eax,%ecx
+    1678:	|  |  |  |  |        |         c1 e1 0d             	shl    $0xd,%ecx
+    167b:	|  |  |  |  |        |         31 c8                	xor    %ecx,%eax
+    s ^= s >> 17;
+    167d:	|  |  |  |  |        |         89 c1                	mov    %eax,%ecx
+    167f:	|  |  |  |  |        |         c1 e9 11             	shr    $0x11,%ecx
+    1682:	|  |  |  |  |        |         31 c1                	xor    %eax,%ecx
+    s ^= s << 5;
+    1684:	|  |  |  |  |        |         89 c8                	mov    %ecx,%eax
+    1686:	|  |  |  |  |        |         c1 e0 05             	shl    $0x5,%eax
+    1689:	|  |  |  |  |        |         31 c8                	xor    %ecx,%eax
+        if (next_rand(seed) % 4 == 0) {
+    168b:	|  |  |  |  |        |         83 e1 03             	and    $0x3,%ecx
+    168e:	|  |  |  |  |     /--|-------- 0f 84 7c 02 00 00    	je     1910 <main+0x7c0>
+    1694:	|  |  |  |  |     |  |         0f 1f 40 00          	nopl   0x0(%rax)
+    while (i + 64 < n_bytes) {
+    1698:	|  |  |  |  |  /--|--|-------> 48 8d 4a 41          	lea    0x41(%rdx),%rcx
+        buf[i++] = '\n';
+    169c:	|  |  |  |  |  |  |  |         c6 04 13 0a          	movb   $0xa,(%rbx,%rdx,1)
+    16a0:	|  |  |  |  |  |  |  |         48 8d 6a 01          	lea    0x1(%rdx),%rbp
+    while (i + 64 < n_bytes) {
+    16a4:	|  |  |  |  |  |  |  |         48 81 f9 ff ff 0f 00 	cmp    $0xfffff,%rcx
+    16ab:	|  |  |  |  |  |  |  \-------- 0f 86 2f fe ff ff    	jbe    14e0 <main+0x390>
+            return v.second;
+        });
+    }
+    {
+        nel::Length const n = fill_floats();
+        nel::log << n << " bytes of floats\n";
+    16b1:	|  |  |  |  |  |  |            48 89 ee             	mov    %rbp,%rsi
+    16b4:	|  |  |  |  |  |  |            48 8d 3d c6 79 10 00 	lea    0x1079c6(%rip),%rdi        # 109081 <nel::log>
+    buf[i] = '\0';
+    16bb:	|  |  |  |  |  |  |            c6 44 13 01 00       	movb   $0x0,0x1(%rbx,%rdx,1)
+    Sum r = 0;
+    16c0:	|  |  |  |  |  |  |            45 31 ed             	xor    %r13d,%r13d
+        nel::log << n << " bytes of floats\n";
+    16c3:	|  |  |  |  |  |  |            e8 28 06 00 00       	call   1cf0 <nel::operator<<(nel::Log&, unsigned long)>
+    16c8:	|  |  |  |  |  |  |            48 8d 35 bb 29 00 00 	lea    0x29bb(%rip),%rsi        # 408a <_IO_stdin_used+0x8a>
+    16cf:	|  |  |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    16d2:	|  |  |  |  |  |  |            e8 59 05 00 00       	call   1c30 <nel::operator<<(nel::Log&, char const*)>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    16d7:	|  |  |  |  |  |  |            4c 89 e6             	mov    %r12,%rsi
+    16da:	|  |  |  |  |  |  |            bf 01 00 00 00       	mov    $0x1,%edi
+    16df:	|  |  |  |  |  |  |            e8 6c f9 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    16e4:	|  |  |  |  |  |  |            48 69 44 24 70 00 ca 	imul   $0x3b9aca00,0x70(%rsp),%rax
+    16eb:	|  |  |  |  |  |  |            9a 3b 
+    16ed:	|  |  |  |  |  |  |            48 c7 44 24 28 0a 00 	movq   $0xa,0x28(%rsp)
+    16f4:	|  |  |  |  |  |  |            00 00 
+    16f6:	|  |  |  |  |  |  |            48 89 44 24 30       	mov    %rax,0x30(%rsp)
+    16fb:	|  |  |  |  |  |  |            48 8b 44 24 78       	mov    0x78(%rsp),%rax
+    1700:	|  |  |  |  |  |  |            48 89 44 24 38       	mov    %rax,0x38(%rsp)
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    1705:	|  |  |  |  |  |  |            0f 1f 00             	nopl   (%rax)
+            nel::Index i = 0;
+    1708:	|  |  |  |  |  |  |     /----> 45 31 f6             	xor    %r14d,%r14d
+    170b:	|  |  |  |  |  |  |     |      0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+                i += parse_one(buf + i, n - i, r) + 1;
+    1710:	|  |  |  |  |  |  |     |  /-> 4e 8d 3c 33          	lea    (%rbx,%r14,1),%r15
+        run("  strtod     ", n, [](char const *p, nel::Length, Sum &r) -> nel::Length {
+            char *e;
+            r += bits(std::strtod(p, &e));
+    1714:	|  |  |  |  |  |  |     |  |   4c 89 e6             	mov    %r12,%rsi
+    1717:	|  |  |  |  |  |  |     |  |   4c 89 ff             	mov    %r15,%rdi
+    171a:	|  |  |  |  |  |  |     |  |   e8 21 f9 ff ff       	call   1040 <strtod@plt>
+            return nel::Length(e - p);
+    171f:	|  |  |  |  |  |  |     |  |   48 8b 54 24 70       	mov    0x70(%rsp),%rdx
+            r += bits(std::strtod(p, &e));
+    1724:	|  |  |  |  |  |  |     |  |   66 48 0f 7e c0       	movq   %xmm0,%rax
+            return nel::Length(e - p);
+    1729:	|  |  |  |  |  |  |     |  |   4c 29 fa             	sub    %r15,%rdx
+            r += bits(std::strtod(p, &e));
+    172c:	|  |  |  |  |  |  |     |  |   49 01 c5             	add    %rax,%r13
+                i += parse_one(buf + i, n - i, r) + 1;
+    172f:	|  |  |  |  |  |  |     |  |   4e 8d 74 32 01       	lea    0x1(%rdx,%r14,1),%r14
+            while (i < n) {
+    1734:	|  |  |  |  |  |  |     |  |   49 39 ee             	cmp    %rbp,%r14
+    1737:	|  |  |  |  |  |  |     |  \-- 72 d7                	jb     1710 <main+0x5c0>
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    1739:	|  |  |  |  |  |  |     |      48 83 6c 24 28 01    	subq   $0x1,0x28(%rsp)
+    173f:	|  |  |  |  |  |  |     \----- 75 c7                	jne    1708 <main+0x5b8>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1741:	|  |  |  |  |  |  |            4c 89 e6             	mov    %r12,%rsi
+    1744:	|  |  |  |  |  |  |            bf 01 00 00 00       	mov    $0x1,%edi
+    1749:	|  |  |  |  |  |  |            41 bf 0a 00 00 00    	mov    $0xa,%r15d
+    174f:	|  |  |  |  |  |  |            e8 fc f8 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1754:	|  |  |  |  |  |  |            48 8b 44 24 38       	mov    0x38(%rsp),%rax
+    1759:	|  |  |  |  |  |  |            48 69 74 24 70 00 ca 	imul   $0x3b9aca00,0x70(%rsp),%rsi
+    1760:	|  |  |  |  |  |  |            9a 3b 
+    bench::report(name, t, n_reps * n);
+    1762:	|  |  |  |  |  |  |            48 8d 3d 33 29 00 00 	lea    0x2933(%rip),%rdi        # 409c <_IO_stdin_used+0x9c>
+    1769:	|  |  |  |  |  |  |            48 29 c6             	sub    %rax,%rsi
+    176c:	|  |  |  |  |  |  |            48 8d 44 ad 00       	lea    0x0(%rbp,%rbp,4),%rax
+    return now_ns() - b;
+    1771:	|  |  |  |  |  |  |            48 03 74 24 78       	add    0x78(%rsp),%rsi
+    1776:	|  |  |  |  |  |  |            48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+    177a:	|  |  |  |  |  |  |            48 8b 44 24 30       	mov    0x30(%rsp),%rax
+    177f:	|  |  |  |  |  |  |            48 89 54 24 38       	mov    %rdx,0x38(%rsp)
+    1784:	|  |  |  |  |  |  |            48 29 c6             	sub    %rax,%rsi
+    1787:	|  |  |  |  |  |  |            e8 c4 03 00 00       	call   1b50 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << r << '\n';
+    178c:	|  |  |  |  |  |  |            48 8d 35 bd 28 00 00 	lea    0x28bd(%rip),%rsi        # 4050 <_IO_stdin_used+0x50>
+    1793:	|  |  |  |  |  |  |            48 8d 3d e7 78 10 00 	lea    0x1078e7(%rip),%rdi        # 109081 <nel::log>
+    179a:	|  |  |  |  |  |  |            e8 91 04 00 00       	call   1c30 <nel::operator<<(nel::Log&, char const*)>
+    179f:	|  |  |  |  |  |  |            4c 89 ee             	mov    %r13,%rsi
+    Sum r = 0;
+    17a2:	|  |  |  |  |  |  |            45 31 ed             	xor    %r13d,%r13d
+    nel::log << "  sum: " << r << '\n';
+    17a5:	|  |  |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    17a8:	|  |  |  |  |  |  |            e8 43 05 00 00       	call   1cf0 <nel::operator<<(nel::Log&, unsigned long)>
+    17ad:	|  |  |  |  |  |  |            be 0a 00 00 00       	mov    $0xa,%esi
+    17b2:	|  |  |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    17b5:	|  |  |  |  |  |  |            e8 56 04 00 00       	call   1c10 <nel::operator<<(nel::Log&, char)>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    17ba:	|  |  |  |  |  |  |            4c 89 e6             	mov    %r12,%rsi
+    17bd:	|  |  |  |  |  |  |            bf 01 00 00 00       	mov    $0x1,%edi
+    17c2:	|  |  |  |  |  |  |            e8 89 f8 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    17c7:	|  |  |  |  |  |  |            48 69 44 24 70 00 ca 	imul   $0x3b9aca00,0x70(%rsp),%rax
+    17ce:	|  |  |  |  |  |  |            9a 3b 
+    17d0:	|  |  |  |  |  |  |            48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    17d5:	|  |  |  |  |  |  |            48 8b 44 24 78       	mov    0x78(%rsp),%rax
+    17da:	|  |  |  |  |  |  |            48 89 44 24 30       	mov    %rax,0x30(%rsp)
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    17df:	|  |  |  |  |  |  |            90                   	nop
+            nel::Index i = 0;
+    17e0:	|  |  |  |  |  |  |     /----> 45 31 f6             	xor    %r14d,%r14d
+    17e3:	|  |  |  |  |  |  |     |      0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+                i += parse_one(buf + i, n - i, r) + 1;
+    17e8:	|  |  |  |  |  |  |     |  /-> 4a 8d 14 33          	lea    (%rbx,%r14,1),%rdx
+        });
+        run("  parse_f64  ", n, [](char const *p, nel::Length const n, Sum &r) {
+            auto const v = nel::parse_f64(field(p, n)).unwrap();
+    17ec:	|  |  |  |  |  |  |     |  |   48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    17f1:	|  |  |  |  |  |  |     |  |   48 8b 7c 24 20       	mov    0x20(%rsp),%rdi
+                i += parse_one(buf + i, n - i, r) + 1;
+    17f6:	|  |  |  |  |  |  |     |  |   48 89 54 24 40       	mov    %rdx,0x40(%rsp)
+    17fb:	|  |  |  |  |  |  |     |  |   48 89 ea             	mov    %rbp,%rdx
+    17fe:	|  |  |  |  |  |  |     |  |   4c 29 f2             	sub    %r14,%rdx
+    1801:	|  |  |  |  |  |  |     |  |   48 89 54 24 48       	mov    %rdx,0x48(%rsp)
+            auto const v = nel::parse_f64(field(p, n)).unwrap();
+    1806:	|  |  |  |  |  |  |     |  |   e8 a5 0f 00 00       	call   27b0 <nel::parse_f64(nel::Slice<unsigned char const> const&)>
+    180b:	|  |  |  |  |  |  |     |  |   66 0f 6f 14 24       	movdqa (%rsp),%xmm2
+            auto tag = tag_;
+    1810:	|  |  |  |  |  |  |     |  |   8b 54 24 50          	mov    0x50(%rsp),%edx
+            , line_num_(line_num)
+    1814:	|  |  |  |  |  |  |     |  |   c7 84 24 80 00 00 00 	movl   $0x83,0x80(%rsp)
+    181b:	|  |  |  |  |  |  |     |  |   83 00 00 00 
+            tag_ = Tag::INVAL;
+    181f:	|  |  |  |  |  |  |     |  |   c7 44 24 50 00 00 00 	movl   $0x0,0x50(%rsp)
+    1826:	|  |  |  |  |  |  |     |  |   00 
+            : fn_name_(fn_name)
+    1827:	|  |  |  |  |  |  |     |  |   0f 29 54 24 70       	movaps %xmm2,0x70(%rsp)
+            switch (tag) { // result-consume
+    182c:	|  |  |  |  |  |  |     |  |   83 fa 01             	cmp    $0x1,%edx
+    182f:	|  |  |  |  +--|--|-----|--|-- 0f 85 9b 00 00 00    	jne    18d0 <main+0x780>
+                i += parse_one(buf + i, n - i, r) + 1;
+    1835:	|  |  |  |  |  |  |     |  |   48 8b 54 24 60       	mov    0x60(%rsp),%rdx
+            r += bits(v.first);
+    183a:	|  |  |  |  |  |  |     |  |   4c 03 6c 24 58       	add    0x58(%rsp),%r13
+                i += parse_one(buf + i, n - i, r) + 1;
+    183f:	|  |  |  |  |  |  |     |  |   4d 8d 74 16 01       	lea    0x1(%r14,%rdx,1),%r14
+            while (i < n) {
+    1844:	|  |  |  |  |  |  |     |  |   49 39 ee             	cmp    %rbp,%r14
+    1847:	|  |  |  |  |  |  |     |  \-- 72 9f                	jb     17e8 <main+0x698>
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    1849:	|  |  |  |  |  |  |     |      4c 89 f8             	mov    %r15,%rax
+    184c:	|  |  |  |  |  |  |     |      48 83 e8 01          	sub    $0x1,%rax
+    1850:	|  |  |  |  |  |  |     |      49 89 c7             	mov    %rax,%r15
+    1853:	|  |  |  |  |  |  |     \----- 75 8b                	jne    17e0 <main+0x690>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1855:	|  |  |  |  |  |  |            4c 89 e6             	mov    %r12,%rsi
+    1858:	|  |  |  |  |  |  |            bf 01 00 00 00       	mov    $0x1,%edi
+    185d:	|  |  |  |  |  |  |            e8 ee f7 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1862:	|  |  |  |  |  |  |            48 8b 44 24 30       	mov    0x30(%rsp),%rax
+    1867:	|  |  |  |  |  |  |            48 69 74 24 70 00 ca 	imul   $0x3b9aca00,0x70(%rsp),%rsi
+    186e:	|  |  |  |  |  |  |            9a 3b 
+    bench::report(name, t, n_reps * n);
+    1870:	|  |  |  |  |  |  |            48 8d 3d 33 28 00 00 	lea    0x2833(%rip),%rdi        # 40aa <_IO_stdin_used+0xaa>
+    1877:	|  |  |  |  |  |  |            48 8b 54 24 38       	mov    0x38(%rsp),%rdx
+    187c:	|  |  |  |  |  |  |            48 29 c6             	sub    %rax,%rsi
+    return now_ns() - b;
+    187f:	|  |  |  |  |  |  |            48 8b 44 24 28       	mov    0x28(%rsp),%rax
+    1884:	|  |  |  |  |  |  |            48 03 74 24 78       	add    0x78(%rsp),%rsi
+    1889:	|  |  |  |  |  |  |            48 29 c6             	sub    %rax,%rsi
+    188c:	|  |  |  |  |  |  |            e8 bf 02 00 00       	call   1b50 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << r << '\n';
+    1891:	|  |  |  |  |  |  |            48 8d 35 b8 27 00 00 	lea    0x27b8(%rip),%rsi        # 4050 <_IO_stdin_used+0x50>
+    1898:	|  |  |  |  |  |  |            48 8d 3d e2 77 10 00 	lea    0x1077e2(%rip),%rdi        # 109081 <nel::log>
+    189f:	|  |  |  |  |  |  |            e8 8c 03 00 00       	call   1c30 <nel::operator<<(nel::Log&, char const*)>
+    18a4:	|  |  |  |  |  |  |            4c 89 ee             	mov    %r13,%rsi
+    18a7:	|  |  |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    18aa:	|  |  |  |  |  |  |            e8 41 04 00 00       	call   1cf0 <nel::operator<<(nel::Log&, unsigned long)>
+    18af:	|  |  |  |  |  |  |            be 0a 00 00 00       	mov    $0xa,%esi
+    18b4:	|  |  |  |  |  |  |            48 89 c7             	mov    %rax,%rdi
+    18b7:	|  |  |  |  |  |  |            e8 54 03 00 00       	call   1c10 <nel::operator<<(nel::Log&, char)>
+            return v.second;
+        });
+    }
+}
+    18bc:	|  |  |  |  |  |  |            48 81 c4 98 00 00 00 	add    $0x98,%rsp
+    18c3:	|  |  |  |  |  |  |            31 c0                	xor    %eax,%eax
+    18c5:	|  |  |  |  |  |  |            5b                   	pop    %rbx
+    18c6:	|  |  |  |  |  |  |            5d                   	pop    %rbp
+    18c7:	|  |  |  |  |  |  |            41 5c                	pop    %r12
+    18c9:	|  |  |  |  |  |  |            41 5d                	pop    %r13
+    18cb:	|  |  |  |  |  |  |            41 5e                	pop    %r14
+    18cd:	|  |  |  |  |  |  |            41 5f                	pop    %r15
+    18cf:	|  |  |  |  |  |  |            c3                   	ret
+    18d0:	|  |  |  |  \--|--|----------> 83 fa 02             	cmp    $0x2,%edx
+    18d3:	|  |  |  |     |  |  /-------- 0f 84 eb 00 00 00    	je     19c4 <main+0x874>
+    18d9:	|  |  |  |     |  |  |         85 d2                	test   %edx,%edx
+    18db:	|  |  |  |     |  |  |  /----- 0f 84 d4 00 00 00    	je     19b5 <main+0x865>
+                    // if they do it's a use-after-move-from op so must panic.
+                    // or a use-before-initialised so again must panic.
+                    nel::panic("invalid Result", ctx);
+                    break;
+                default:
+                    nel::panic("bad Result", ctx);
+    18e1:	|  |  |  |     |  |  |  |      4c 89 e6             	mov    %r12,%rsi
+    18e4:	|  |  |  |     |  |  |  |      48 8d 3d 86 27 00 00 	lea    0x2786(%rip),%rdi        # 4071 <_IO_stdin_used+0x71>
+    18eb:	|  |  |  |     |  |  |  |      e8 f2 f7 ff ff       	call   10e2 <nel::panic(char const*, nel::Context const&)>
+                                                         : 1 + next_rand(seed) % 6;
+    18f0:	|  |  \--|-----|--|--|--|----> 89 c2                	mov    %eax,%edx
+    18f2:	|  |     |     |  |  |  |      89 c1                	mov    %eax,%ecx
+    18f4:	|  |     |     |  |  |  |      49 0f af d3          	imul   %r11,%rdx
+    18f8:	|  |     |     |  |  |  |      48 c1 ea 22          	shr    $0x22,%rdx
+    18fc:	|  |     |     |  |  |  |      8d 14 52             	lea    (%rdx,%rdx,2),%edx
+    18ff:	|  |     |     |  |  |  |      01 d2                	add    %edx,%edx
+    1901:	|  |     |     |  |  |  |      29 d1                	sub    %edx,%ecx
+        nel::Length const n = (next_rand(seed) % 4 == 0) ? 1 + next_rand(seed) % 19
+    1903:	|  |     |     |  |  |  |      44 8d 41 01          	lea    0x1(%rcx),%r8d
+    1907:	|  |     \-----|--|--|--|----- e9 f2 f8 ff ff       	jmp    11fe <main+0xae>
+    190c:	|  |           |  |  |  |      0f 1f 40 00          	nopl   0x0(%rax)
+    s ^= s << 13;
+    1910:	|  |           |  \--|--|----> 89 c1                	mov    %eax,%ecx
+            buf[i++] = 'e';
+    1912:	|  |           |     |  |      c6 04 13 65          	movb   $0x65,(%rbx,%rdx,1)
+    buf[i++] = char('1' + next_rand(seed) % 9);
+    1916:	|  |           |     |  |      48 8d 7a 02          	lea    0x2(%rdx),%rdi
+    s ^= s << 13;
+    191a:	|  |           |     |  |      c1 e1 0d             	shl    $0xd,%ecx
+    191d:	|  |           |     |  |      31 c1                	xor    %eax,%ecx
+    s ^= s >> 17;
+    191f:	|  |           |     |  |      89 c8                	mov    %ecx,%eax
+    1921:	|  |           |     |  |      c1 e8 11             	shr    $0x11,%eax
+    1924:	|  |           |     |  |      31 c8                	xor    %ecx,%eax
+    s ^= s << 5;
+    1926:	|  |           |     |  |      41 89 c0             	mov    %eax,%r8d
+    1929:	|  |           |     |  |      41 c1 e0 05          	shl    $0x5,%r8d
+    192d:	|  |           |     |  |      41 31 c0             	xor    %eax,%r8d
+    s ^= s << 13;
+    1930:	|  |           |     |  |      44 89 c0             	mov    %r8d,%eax
+    1933:	|  |           |     |  |      c1 e0 0d             	shl    $0xd,%eax
+    1936:	|  |           |     |  |      44 31 c0             	xor    %r8d,%eax
+    s ^= s >> 17;
+    1939:	|  |           |     |  |      89 c1                	mov    %eax,%ecx
+    193b:	|  |           |     |  |      c1 e9 11             	shr    $0x11,%ecx
+    193e:	|  |           |     |  |      31 c1                	xor    %eax,%ecx
+    s ^= s << 5;
+    1940:	|  |           |     |  |      89 c8                	mov    %ecx,%eax
+    1942:	|  |           |     |  |      c1 e0 05             	shl    $0x5,%eax
+    1945:	|  |           |     |  |      31 c8                	xor    %ecx,%eax
+    buf[i++] = char('1' + next_rand(seed) % 9);
+    1947:	|  |           |     |  |      89 c1                	mov    %eax,%ecx
+    1949:	|  |           |     |  |      48 69 c9 39 8e e3 38 	imul   $0x38e38e39,%rcx,%rcx
+    1950:	|  |           |     |  |      48 c1 e9 21          	shr    $0x21,%rcx
+    1954:	|  |           |     |  |      44 8d 14 c9          	lea    (%rcx,%rcx,8),%r10d
+    1958:	|  |           |     |  |      89 c1                	mov    %eax,%ecx
+    195a:	|  |           |     |  |      44 29 d1             	sub    %r10d,%ecx
+    195d:	|  |           |     |  |      83 c1 31             	add    $0x31,%ecx
+    for (nel::Index k = 1; k < n; ++k) {
+    1960:	|  |           |     |  |      41 83 e0 01          	and    $0x1,%r8d
+    buf[i++] = char('1' + next_rand(seed) % 9);
+    1964:	|  |           |     |  |      88 4c 13 01          	mov    %cl,0x1(%rbx,%rdx,1)
+    for (nel::Index k = 1; k < n; ++k) {
+    1968:	|  |           |     |  |  /-- 74 43                	je     19ad <main+0x85d>
+    s ^= s << 13;
+    196a:	|  |           |     |  |  |   89 c1                	mov    %eax,%ecx
+        buf[i++] = char('0' + next_rand(seed) % 10);
+    196c:	|  |           |     |  |  |   48 83 c2 03          	add    $0x3,%rdx
+    s ^= s << 13;
+    1970:	|  |           |     |  |  |   c1 e1 0d             	shl    $0xd,%ecx
+    1973:	|  |           |     |  |  |   31 c8                	xor    %ecx,%eax
+    s ^= s >> 17;
+    1975:	|  |           |     |  |  |   89 c1                	mov    %eax,%ecx
+    1977:	|  |           |     |  |  |   c1 e9 11             	shr    $0x11,%ecx
+    197a:	|  |           |     |  |  |   31 c1                	xor    %eax,%ecx
+    s ^= s << 5;
+    197c:	|  |           |     |  |  |   89 c8                	mov    %ecx,%eax
+    197e:	|  |           |     |  |  |   c1 e0 05             	shl    $0x5,%eax
+    1981:	|  |           |     |  |  |   31 c8                	xor    %ecx,%eax
+        buf[i++] = char('0' + next_rand(seed) % 10);
+    1983:	|  |           |     |  |  |   89 c1                	mov    %eax,%ecx
+    1985:	|  |           |     |  |  |   48 0f af ce          	imul   %rsi,%rcx
+    1989:	|  |           |     |  |  |   48 c1 e9 23          	shr    $0x23,%rcx
+    198d:	|  |           |     |  |  |   44 8d 04 89          	lea    (%rcx,%rcx,4),%r8d
+    1991:	|  |           |     |  |  |   89 c1                	mov    %eax,%ecx
+    1993:	|  |           |     |  |  |   45 01 c0             	add    %r8d,%r8d
+    1996:	|  |           |     |  |  |   44 29 c1             	sub    %r8d,%ecx
+    1999:	|  |           |     |  |  |   83 c1 30             	add    $0x30,%ecx
+    199c:	|  |           |     |  |  |   88 0c 3b             	mov    %cl,(%rbx,%rdi,1)
+    for (nel::Index k = 1; k < n; ++k) {
+    199f:	|  |           +-----|--|--|-- e9 f4 fc ff ff       	jmp    1698 <main+0x548>
+    buf[i++] = char('1' + next_rand(seed) % 9);
+    19a4:	\--|-----------|-----|--|--|-> 4c 8d 45 01          	lea    0x1(%rbp),%r8
+    19a8:	   \-----------|-----|--|--|-- e9 d7 f8 ff ff       	jmp    1284 <main+0x134>
+    19ad:	               |     |  |  \-> 48 89 fa             	mov    %rdi,%rdx
+    19b0:	               \-----|--|----- e9 e3 fc ff ff       	jmp    1698 <main+0x548>
+                    nel::panic("invalid Result", ctx);
+    19b5:	                     |  \----> 4c 89 e6             	mov    %r12,%rsi
+    19b8:	                     |         48 8d 3d a3 26 00 00 	lea    0x26a3(%rip),%rdi        # 4062 <_IO_stdin_used+0x62>
+    19bf:	                     |         e8 1e f7 ff ff       	call   10e2 <nel::panic(char const*, nel::Context const&)>
+         * `this` is consumed by the operation.
+         */
+        constexpr T unwrap(Context const &ctx = Context())
+        {
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    19c4:	                     \-------> 4c 89 e6             	mov    %r12,%rsi
+    19c7:	                               48 8d 3d 8a 26 00 00 	lea    0x268a(%rip),%rdi        # 4058 <_IO_stdin_used+0x58>
+    19ce:	                               e8 0f f7 ff ff       	call   10e2 <nel::panic(char const*, nel::Context const&)>
+    19d3:	                               66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    19da:	                               00 00 00 
+    19dd:	                               0f 1f 00             	nopl   (%rax)
+
+00000000000019e0 <_start>:
+    19e0:	31 ed                	xor    %ebp,%ebp
+    19e2:	49 89 d1             	mov    %rdx,%r9
+    19e5:	5e                   	pop    %rsi
+    19e6:	48 89 e2             	mov    %rsp,%rdx
+    19e9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    19ed:	50                   	push   %rax
+    19ee:	54                   	push   %rsp
+    19ef:	45 31 c0             	xor    %r8d,%r8d
+    19f2:	31 c9                	xor    %ecx,%ecx
+    19f4:	48 8d 3d 55 f7 ff ff 	lea    -0x8ab(%rip),%rdi        # 1150 <main>
+    19fb:	ff 15 bf 75 00 00    	call   *0x75bf(%rip)        # 8fc0 <__libc_start_main@GLIBC_2.34>
+    1a01:	f4                   	hlt
+    1a02:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1a09:	00 00 00 
+    1a0c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001a10 <deregister_tm_clones>:
+    1a10:	    48 8d 3d 31 76 00 00 	lea    0x7631(%rip),%rdi        # 9048 <__TMC_END__>
+    1a17:	    48 8d 05 2a 76 00 00 	lea    0x762a(%rip),%rax        # 9048 <__TMC_END__>
+    1a1e:	    48 39 f8             	cmp    %rdi,%rax
+    1a21:	/-- 74 15                	je     1a38 <deregister_tm_clones+0x28>
+    1a23:	|   48 8b 05 9e 75 00 00 	mov    0x759e(%rip),%rax        # 8fc8 <_ITM_deregisterTMCloneTable@Base>
+    1a2a:	|   48 85 c0             	test   %rax,%rax
+    1a2d:	+-- 74 09                	je     1a38 <deregister_tm_clones+0x28>
+    1a2f:	|   ff e0                	jmp    *%rax
+    1a31:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1a38:	\-> c3                   	ret
+    1a39:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001a40 <register_tm_clones>:
+    1a40:	    48 8d 3d 01 76 00 00 	lea    0x7601(%rip),%rdi        # 9048 <__TMC_END__>
+    1a47:	    48 8d 35 fa 75 00 00 	lea    0x75fa(%rip),%rsi        # 9048 <__TMC_END__>
+    1a4e:	    48 29 fe             	sub    %rdi,%rsi
+    1a51:	    48 89 f0             	mov    %rsi,%rax
+    1a54:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1a58:	    48 c1 f8 03          	sar    $0x3,%rax
+    1a5c:	    48 01 c6             	add    %rax,%rsi
+    1a5f:	    48 d1 fe             	sar    %rsi
+    1a62:	/-- 74 14                	je     1a78 <register_tm_clones+0x38>
+    1a64:	|   48 8b 05 6d 75 00 00 	mov    0x756d(%rip),%rax        # 8fd8 <_ITM_registerTMCloneTable@Base>
+    1a6b:	|   48 85 c0             	test   %rax,%rax
+    1a6e:	+-- 74 08                	je     1a78 <register_tm_clones+0x38>
+    1a70:	|   ff e0                	jmp    *%rax
+    1a72:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1a78:	\-> c3                   	ret
+    1a79:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001a80 <__do_global_dtors_aux>:
+    1a80:	       f3 0f 1e fa          	endbr64
+    1a84:	       80 3d dd 75 00 00 00 	cmpb   $0x0,0x75dd(%rip)        # 9068 <completed.0>
+    1a8b:	/----- 75 2b                	jne    1ab8 <__do_global_dtors_aux+0x38>
+    1a8d:	|      55                   	push   %rbp
+    1a8e:	|      48 83 3d 4a 75 00 00 	cmpq   $0x0,0x754a(%rip)        # 8fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1a95:	|      00 
+    1a96:	|      48 89 e5             	mov    %rsp,%rbp
+    1a99:	|  /-- 74 0c                	je     1aa7 <__do_global_dtors_aux+0x27>
+    1a9b:	|  |   48 8b 3d 9e 75 00 00 	mov    0x759e(%rip),%rdi        # 9040 <__dso_handle>
+    1aa2:	|  |   e8 f9 f5 ff ff       	call   10a0 <__cxa_finalize@plt>
+    1aa7:	|  \-> e8 64 ff ff ff       	call   1a10 <deregister_tm_clones>
+    1aac:	|      c6 05 b5 75 00 00 01 	movb   $0x1,0x75b5(%rip)        # 9068 <completed.0>
+    1ab3:	|      5d                   	pop    %rbp
+    1ab4:	|      c3                   	ret
+    1ab5:	|      0f 1f 00             	nopl   (%rax)
+    1ab8:	\----> c3                   	ret
+    1ab9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001ac0 <frame_dummy>:
+    1ac0:	f3 0f 1e fa          	endbr64
+    1ac4:	e9 77 ff ff ff       	jmp    1a40 <register_tm_clones>
+    1ac9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001ad0 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    1ad0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ad5:	c3                   	ret
+    1ad6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1add:	00 00 00 
+
+0000000000001ae0 <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    1ae0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ae5:	c3                   	ret
+    1ae6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1aed:	00 00 00 
+
+0000000000001af0 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    1af0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1af5:	c3                   	ret
+    1af6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1afd:	00 00 00 
+
+0000000000001b00 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    1b00:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1b05:	c3                   	ret
+    1b06:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1b0d:	00 00 00 
+
+0000000000001b10 <_read_r>:
+int _read_r(struct _reent *, int) {
+    1b10:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1b15:	c3                   	ret
+    1b16:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1b1d:	00 00 00 
+
+0000000000001b20 <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    1b20:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1b25:	c3                   	ret
+    1b26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1b2d:	00 00 00 
+
+0000000000001b30 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    1b30:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1b35:	c3                   	ret
+    1b36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1b3d:	00 00 00 
+
+0000000000001b40 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1b40:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1b45:	c3                   	ret
+    1b46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1b4d:	00 00 00 
+
+0000000000001b50 <bench::report(char const*, unsigned long, unsigned long)>:
+{
+    1b50:	       41 54                	push   %r12
+    unsigned int seed = 0x12345678;
+    1b52:	       4c 8d 25 28 75 10 00 	lea    0x107528(%rip),%r12        # 109081 <nel::log>
+{
+    1b59:	       55                   	push   %rbp
+    1b5a:	       48 89 f5             	mov    %rsi,%rbp
+    unsigned int seed = 0x12345678;
+    1b5d:	       48 89 fe             	mov    %rdi,%rsi
+    1b60:	       4c 89 e7             	mov    %r12,%rdi
+{
+    1b63:	       53                   	push   %rbx
+    1b64:	       48 89 d3             	mov    %rdx,%rbx
+    unsigned int seed = 0x12345678;
+    1b67:	       e8 c4 00 00 00       	call   1c30 <nel::operator<<(nel::Log&, char const*)>
+    1b6c:	       48 8d 35 e2 24 00 00 	lea    0x24e2(%rip),%rsi        # 4055 <_IO_stdin_used+0x55>
+    1b73:	       48 89 c7             	mov    %rax,%rdi
+    1b76:	       e8 b5 00 00 00       	call   1c30 <nel::operator<<(nel::Log&, char const*)>
+    1b7b:	       48 89 ea             	mov    %rbp,%rdx
+    1b7e:	       48 89 c7             	mov    %rax,%rdi
+    1b81:	       48 c1 ea 03          	shr    $0x3,%rdx
+    1b85:	       48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    1b8c:	       9b c4 20 
+    1b8f:	       48 f7 e2             	mul    %rdx
+    1b92:	       48 c1 ea 04          	shr    $0x4,%rdx
+    1b96:	       48 89 d6             	mov    %rdx,%rsi
+    1b99:	       e8 52 01 00 00       	call   1cf0 <nel::operator<<(nel::Log&, unsigned long)>
+    1b9e:	       48 8d 35 5f 24 00 00 	lea    0x245f(%rip),%rsi        # 4004 <_IO_stdin_used+0x4>
+    1ba5:	       48 89 c7             	mov    %rax,%rdi
+    1ba8:	       e8 83 00 00 00       	call   1c30 <nel::operator<<(nel::Log&, char const*)>
+    nel::Index i = 0;
+    1bad:	       48 85 db             	test   %rbx,%rbx
+    1bb0:	/----- 74 05                	je     1bb7 <bench::report(char const*, unsigned long, unsigned long)+0x67>
+    1bb2:	|      48 85 ed             	test   %rbp,%rbp
+    1bb5:	|  /-- 75 19                	jne    1bd0 <bench::report(char const*, unsigned long, unsigned long)+0x80>
+    buf[i] = '\0';
+    1bb7:	>--|-> 5b                   	pop    %rbx
+    }
+    1bb8:	|  |   4c 89 e7             	mov    %r12,%rdi
+    buf[i] = '\0';
+    1bbb:	|  |   5d                   	pop    %rbp
+    }
+    1bbc:	|  |   be 0a 00 00 00       	mov    $0xa,%esi
+    buf[i] = '\0';
+    1bc1:	|  |   41 5c                	pop    %r12
+    }
+    1bc3:	|  |   e9 48 00 00 00       	jmp    1c10 <nel::operator<<(nel::Log&, char)>
+    1bc8:	|  |   0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    1bcf:	|  |   00 
+        put(i, seed);
+    1bd0:	|  \-> 4c 89 e7             	mov    %r12,%rdi
+    1bd3:	|      48 8d 35 2d 24 00 00 	lea    0x242d(%rip),%rsi        # 4007 <_IO_stdin_used+0x7>
+    1bda:	|      e8 51 00 00 00       	call   1c30 <nel::operator<<(nel::Log&, char const*)>
+    1bdf:	|      31 d2                	xor    %edx,%edx
+    1be1:	|      48 89 c7             	mov    %rax,%rdi
+    1be4:	|      48 69 c3 e8 03 00 00 	imul   $0x3e8,%rbx,%rax
+    1beb:	|      48 f7 f5             	div    %rbp
+    1bee:	|      48 89 c6             	mov    %rax,%rsi
+    1bf1:	|      e8 fa 00 00 00       	call   1cf0 <nel::operator<<(nel::Log&, unsigned long)>
+    1bf6:	|      48 8d 35 0d 24 00 00 	lea    0x240d(%rip),%rsi        # 400a <_IO_stdin_used+0xa>
+    1bfd:	|      48 89 c7             	mov    %rax,%rdi
+    1c00:	|      e8 2b 00 00 00       	call   1c30 <nel::operator<<(nel::Log&, char const*)>
+    1c05:	\----- eb b0                	jmp    1bb7 <bench::report(char const*, unsigned long, unsigned long)+0x67>
+    1c07:	       66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    1c0e:	       00 00 
+
+0000000000001c10 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1c10:	53                   	push   %rbx
+    1c11:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    1c14:	40 0f be fe          	movsbl %sil,%edi
+    1c18:	48 8b 35 41 74 00 00 	mov    0x7441(%rip),%rsi        # 9060 <stderr@GLIBC_2.2.5>
+    1c1f:	e8 4c f4 ff ff       	call   1070 <fputc@plt>
+    return outs;
+}
+    1c24:	48 89 d8             	mov    %rbx,%rax
+    1c27:	5b                   	pop    %rbx
+    1c28:	c3                   	ret
+    1c29:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001c30 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1c30:	53                   	push   %rbx
+    1c31:	48 89 fb             	mov    %rdi,%rbx
+    1c34:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    1c37:	48 8b 35 22 74 00 00 	mov    0x7422(%rip),%rsi        # 9060 <stderr@GLIBC_2.2.5>
+    1c3e:	e8 1d f4 ff ff       	call   1060 <fputs@plt>
+    return outs;
+}
+    1c43:	48 89 d8             	mov    %rbx,%rax
+    1c46:	5b                   	pop    %rbx
+    1c47:	c3                   	ret
+    1c48:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    1c4f:	00 
+
+0000000000001c50 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1c50:	53                   	push   %rbx
+    1c51:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    1c54:	48 8b 3d 05 74 00 00 	mov    0x7405(%rip),%rdi        # 9060 <stderr@GLIBC_2.2.5>
+    1c5b:	40 0f b6 d6          	movzbl %sil,%edx
+    1c5f:	31 c0                	xor    %eax,%eax
+    1c61:	48 8d 35 88 24 00 00 	lea    0x2488(%rip),%rsi        # 40f0 <_IO_stdin_used+0xf0>
+    1c68:	e8 23 f4 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1c6d:	48 89 d8             	mov    %rbx,%rax
+    1c70:	5b                   	pop    %rbx
+    1c71:	c3                   	ret
+    1c72:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1c79:	00 00 00 00 
+    1c7d:	0f 1f 00             	nopl   (%rax)
+
+0000000000001c80 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    1c80:	53                   	push   %rbx
+    1c81:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    1c84:	48 8b 3d d5 73 00 00 	mov    0x73d5(%rip),%rdi        # 9060 <stderr@GLIBC_2.2.5>
+    1c8b:	0f b7 d6             	movzwl %si,%edx
+    1c8e:	31 c0                	xor    %eax,%eax
+    1c90:	48 8d 35 59 24 00 00 	lea    0x2459(%rip),%rsi        # 40f0 <_IO_stdin_used+0xf0>
+    1c97:	e8 f4 f3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1c9c:	48 89 d8             	mov    %rbx,%rax
+    1c9f:	5b                   	pop    %rbx
+    1ca0:	c3                   	ret
+    1ca1:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1ca8:	00 00 00 00 
+    1cac:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001cb0 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    1cb0:	53                   	push   %rbx
+    1cb1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    1cb4:	48 8b 3d a5 73 00 00 	mov    0x73a5(%rip),%rdi        # 9060 <stderr@GLIBC_2.2.5>
+{
+    1cbb:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    1cbd:	31 c0                	xor    %eax,%eax
+    1cbf:	48 8d 35 2a 24 00 00 	lea    0x242a(%rip),%rsi        # 40f0 <_IO_stdin_used+0xf0>
+    1cc6:	e8 c5 f3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1ccb:	48 89 d8             	mov    %rbx,%rax
+    1cce:	5b                   	pop    %rbx
+    1ccf:	c3                   	ret
+
+0000000000001cd0 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    1cd0:	53                   	push   %rbx
+    1cd1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    1cd4:	48 8b 3d 85 73 00 00 	mov    0x7385(%rip),%rdi        # 9060 <stderr@GLIBC_2.2.5>
+{
+    1cdb:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    1cdd:	31 c0                	xor    %eax,%eax
+    1cdf:	48 8d 35 0a 24 00 00 	lea    0x240a(%rip),%rsi        # 40f0 <_IO_stdin_used+0xf0>
+    1ce6:	e8 a5 f3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1ceb:	48 89 d8             	mov    %rbx,%rax
+    1cee:	5b                   	pop    %rbx
+    1cef:	c3                   	ret
+
+0000000000001cf0 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    1cf0:	53                   	push   %rbx
+    1cf1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    1cf4:	48 8b 3d 65 73 00 00 	mov    0x7365(%rip),%rdi        # 9060 <stderr@GLIBC_2.2.5>
+{
+    1cfb:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    1cfe:	31 c0                	xor    %eax,%eax
+    1d00:	48 8d 35 ec 23 00 00 	lea    0x23ec(%rip),%rsi        # 40f3 <_IO_stdin_used+0xf3>
+    1d07:	e8 84 f3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1d0c:	48 89 d8             	mov    %rbx,%rax
+    1d0f:	5b                   	pop    %rbx
+    1d10:	c3                   	ret
+    1d11:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1d18:	00 00 00 
+    1d1b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000001d20 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>:
+}
+
+// The value of the d digits p[0..d), d <= 19 so it fits.
+// avail is how many bytes may be read from p, at least d.
+Word digits_value(unsigned char const p[], Length const d, Length const avail)
+{
+    1d20:	             55                   	push   %rbp
+    1d21:	             49 89 f8             	mov    %rdi,%r8
+    Word v = 0;
+    1d24:	             31 c0                	xor    %eax,%eax
+{
+    1d26:	             53                   	push   %rbx
+    1d27:	             48 89 d3             	mov    %rdx,%rbx
+    Index i = 0;
+    for (; i + 8 <= d; i += 8) {
+    1d2a:	             48 83 fe 07          	cmp    $0x7,%rsi
+    1d2e:	      /----- 0f 86 1c 01 00 00    	jbe    1e50 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x130>
+    v -= 0x3030303030303030ULL;
+    1d34:	      |      49 bb d0 cf cf cf cf 	movabs $0xcfcfcfcfcfcfcfd0,%r11
+    1d3b:	      |      cf cf cf 
+    for (; i + 8 <= d; i += 8) {
+    1d3e:	      |      b9 08 00 00 00       	mov    $0x8,%ecx
+    return (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+    1d43:	      |      48 bf ff 00 00 00 ff 	movabs $0xff000000ff,%rdi
+    1d4a:	      |      00 00 00 
+    1d4d:	      |      49 ba 01 00 00 00 10 	movabs $0x271000000001,%r10
+    1d54:	      |      27 00 00 
+    1d57:	      |      49 b9 64 00 00 00 40 	movabs $0xf424000000064,%r9
+    1d5e:	      |      42 0f 00 
+    1d61:	      |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        v = v * 100000000ULL + parse8(load8(p + i));
+    1d68:	      |  /-> 48 69 e8 00 e1 f5 05 	imul   $0x5f5e100,%rax,%rbp
+    v -= 0x3030303030303030ULL;
+    1d6f:	      |  |   49 8b 44 08 f8       	mov    -0x8(%r8,%rcx,1),%rax
+    1d74:	      |  |   4c 01 d8             	add    %r11,%rax
+    v = (v * 10) + (v >> 8);
+    1d77:	      |  |   48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+    1d7b:	      |  |   48 c1 e8 08          	shr    $0x8,%rax
+    1d7f:	      |  |   48 8d 14 50          	lea    (%rax,%rdx,2),%rdx
+    return (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+    1d83:	      |  |   48 89 d0             	mov    %rdx,%rax
+    1d86:	      |  |   48 21 fa             	and    %rdi,%rdx
+    1d89:	      |  |   48 c1 e8 10          	shr    $0x10,%rax
+    1d8d:	      |  |   49 0f af d1          	imul   %r9,%rdx
+    1d91:	      |  |   48 21 f8             	and    %rdi,%rax
+    1d94:	      |  |   49 0f af c2          	imul   %r10,%rax
+    1d98:	      |  |   48 01 d0             	add    %rdx,%rax
+    1d9b:	      |  |   48 89 ca             	mov    %rcx,%rdx
+    for (; i + 8 <= d; i += 8) {
+    1d9e:	      |  |   48 8d 49 08          	lea    0x8(%rcx),%rcx
+    return (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+    1da2:	      |  |   48 c1 e8 20          	shr    $0x20,%rax
+        v = v * 100000000ULL + parse8(load8(p + i));
+    1da6:	      |  |   48 01 e8             	add    %rbp,%rax
+    for (; i + 8 <= d; i += 8) {
+    1da9:	      |  |   48 39 ce             	cmp    %rcx,%rsi
+    1dac:	      |  \-- 73 ba                	jae    1d68 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x48>
+    }
+    Length const r = d - i;
+    if (r == 0) { return v; }
+    1dae:	      |      48 89 f7             	mov    %rsi,%rdi
+    1db1:	      |      48 29 d7             	sub    %rdx,%rdi
+    1db4:	      |  /-- 0f 84 90 00 00 00    	je     1e4a <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x12a>
+    if (i + 8 <= avail) {
+    1dba:	      |  |   48 39 cb             	cmp    %rcx,%rbx
+    1dbd:	   /--|--|-- 0f 82 b3 00 00 00    	jb     1e76 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x156>
+        Word const w =
+            (load8(p + i) << (8 * (8 - r))) | (0x3030303030303030ULL >> (8 * r));
+        return v * pow10_u64[r] + parse8(w);
+    }
+    for (; i < d; ++i) {
+        v = v * 10 + Word(p[i] - '0');
+    1dc3:	   |  |  |   49 01 d0             	add    %rdx,%r8
+            (load8(p + i) << (8 * (8 - r))) | (0x3030303030303030ULL >> (8 * r));
+    1dc6:	/--|--|--|-> 48 29 f2             	sub    %rsi,%rdx
+    1dc9:	|  |  |  |   48 be 30 30 30 30 30 	movabs $0x3030303030303030,%rsi
+    1dd0:	|  |  |  |   30 30 30 
+    1dd3:	|  |  |  |   48 8d 0c d5 40 00 00 	lea    0x40(,%rdx,8),%rcx
+    1dda:	|  |  |  |   00 
+    1ddb:	|  |  |  |   49 8b 10             	mov    (%r8),%rdx
+    1dde:	|  |  |  |   48 89 f3             	mov    %rsi,%rbx
+    return (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+    1de1:	|  |  |  |   49 b8 01 00 00 00 10 	movabs $0x271000000001,%r8
+    1de8:	|  |  |  |   27 00 00 
+            (load8(p + i) << (8 * (8 - r))) | (0x3030303030303030ULL >> (8 * r));
+    1deb:	|  |  |  |   48 d3 e2             	shl    %cl,%rdx
+    1dee:	|  |  |  |   48 8d 0c fd 00 00 00 	lea    0x0(,%rdi,8),%rcx
+    1df5:	|  |  |  |   00 
+    1df6:	|  |  |  |   48 d3 eb             	shr    %cl,%rbx
+    1df9:	|  |  |  |   48 09 da             	or     %rbx,%rdx
+    v -= 0x3030303030303030ULL;
+    1dfc:	|  |  |  |   48 29 f2             	sub    %rsi,%rdx
+    return (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+    1dff:	|  |  |  |   48 be ff 00 00 00 ff 	movabs $0xff000000ff,%rsi
+    1e06:	|  |  |  |   00 00 00 
+    v = (v * 10) + (v >> 8);
+    1e09:	|  |  |  |   48 8d 0c 92          	lea    (%rdx,%rdx,4),%rcx
+    1e0d:	|  |  |  |   48 c1 ea 08          	shr    $0x8,%rdx
+    1e11:	|  |  |  |   48 8d 0c 4a          	lea    (%rdx,%rcx,2),%rcx
+    return (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+    1e15:	|  |  |  |   48 89 ca             	mov    %rcx,%rdx
+    1e18:	|  |  |  |   48 21 f1             	and    %rsi,%rcx
+    1e1b:	|  |  |  |   48 c1 ea 10          	shr    $0x10,%rdx
+    1e1f:	|  |  |  |   48 21 f2             	and    %rsi,%rdx
+    1e22:	|  |  |  |   48 be 64 00 00 00 40 	movabs $0xf424000000064,%rsi
+    1e29:	|  |  |  |   42 0f 00 
+    1e2c:	|  |  |  |   48 0f af ce          	imul   %rsi,%rcx
+    1e30:	|  |  |  |   49 0f af d0          	imul   %r8,%rdx
+    1e34:	|  |  |  |   48 01 ca             	add    %rcx,%rdx
+        return v * pow10_u64[r] + parse8(w);
+    1e37:	|  |  |  |   48 8d 0d 62 4c 00 00 	lea    0x4c62(%rip),%rcx        # 6aa0 <nel::(anonymous namespace)::pow10_u64>
+    1e3e:	|  |  |  |   48 0f af 04 f9       	imul   (%rcx,%rdi,8),%rax
+    return (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+    1e43:	|  |  |  |   48 c1 ea 20          	shr    $0x20,%rdx
+        return v * pow10_u64[r] + parse8(w);
+    1e47:	|  |  |  |   48 01 d0             	add    %rdx,%rax
+    }
+    return v;
+}
+    1e4a:	|  |  |  >-> 5b                   	pop    %rbx
+    1e4b:	|  |  |  |   5d                   	pop    %rbp
+    1e4c:	|  |  |  |   c3                   	ret
+    1e4d:	|  |  |  |   0f 1f 00             	nopl   (%rax)
+    if (r == 0) { return v; }
+    1e50:	|  |  \--|-> 48 85 f6             	test   %rsi,%rsi
+    1e53:	|  |     \-- 74 f5                	je     1e4a <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x12a>
+    Index i = 0;
+    1e55:	|  |         31 d2                	xor    %edx,%edx
+    if (i + 8 <= avail) {
+    1e57:	|  |         48 83 fb 07          	cmp    $0x7,%rbx
+    1e5b:	|  |  /----- 77 21                	ja     1e7e <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x15e>
+    1e5d:	|  |  |      0f 1f 00             	nopl   (%rax)
+        v = v * 10 + Word(p[i] - '0');
+    1e60:	|  |  |  /-> 48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+    1e64:	|  |  |  |   41 0f b6 04 10       	movzbl (%r8,%rdx,1),%eax
+    for (; i < d; ++i) {
+    1e69:	|  |  |  |   48 83 c2 01          	add    $0x1,%rdx
+        v = v * 10 + Word(p[i] - '0');
+    1e6d:	|  |  |  |   83 e8 30             	sub    $0x30,%eax
+    1e70:	|  |  |  |   48 98                	cltq
+    1e72:	|  |  |  |   48 8d 04 48          	lea    (%rax,%rcx,2),%rax
+    for (; i < d; ++i) {
+    1e76:	|  \--|--|-> 48 39 f2             	cmp    %rsi,%rdx
+    1e79:	|     |  \-- 72 e5                	jb     1e60 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x140>
+}
+    1e7b:	|     |      5b                   	pop    %rbx
+    1e7c:	|     |      5d                   	pop    %rbp
+    1e7d:	|     |      c3                   	ret
+    Length const r = d - i;
+    1e7e:	|     \----> 48 89 f7             	mov    %rsi,%rdi
+    Index i = 0;
+    1e81:	|            31 d2                	xor    %edx,%edx
+    1e83:	\----------- e9 3e ff ff ff       	jmp    1dc6 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0xa6>
+    1e88:	             0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    1e8f:	             00 
+
+0000000000001e90 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)>:
+
+// The double nearest digits * 10^q, for numbers too long for compute_float to round alone.
+// Enough leading digits to decide the rounding are passed to strtod,
+// with a '1' after them if any of the rest are not 0, to break ties the right way.
+__attribute__((noinline)) double slow_path(Digits const &ds, long long int q)
+{
+    1e90:	                               53                   	push   %rbx
+    1e91:	                               48 89 f1             	mov    %rsi,%rcx
+    constexpr Length max_digits = 768;
+    char buf[max_digits + 32];
+    Length const n = ds.an + ds.bn;
+    Length const kept = (n < max_digits) ? n : max_digits;
+    1e94:	                               41 ba 00 03 00 00    	mov    $0x300,%r10d
+{
+    1e9a:	                               48 81 ec 40 03 00 00 	sub    $0x340,%rsp
+    Length const n = ds.an + ds.bn;
+    1ea1:	                               48 8b 77 08          	mov    0x8(%rdi),%rsi
+    1ea5:	                               4c 8b 47 18          	mov    0x18(%rdi),%r8
+    1ea9:	                               49 01 f0             	add    %rsi,%r8
+    Length const kept = (n < max_digits) ? n : max_digits;
+    1eac:	                               4d 39 d0             	cmp    %r10,%r8
+    1eaf:	                               4d 0f 46 d0          	cmovbe %r8,%r10
+    Index o = 0;
+    for (Index i = 0; i < kept; ++i) {
+    1eb3:	                               4d 85 c0             	test   %r8,%r8
+    1eb6:	/----------------------------- 0f 84 b4 01 00 00    	je     2070 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x1e0>
+    1ebc:	|                              49 89 fb             	mov    %rdi,%r11
+    1ebf:	|                              48 85 f6             	test   %rsi,%rsi
+    1ec2:	|  /-------------------------- 0f 84 78 01 00 00    	je     2040 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x1b0>
+    1ec8:	|  |                           4c 39 d6             	cmp    %r10,%rsi
+    1ecb:	|  |                           4c 89 d3             	mov    %r10,%rbx
+    1ece:	|  |                           4c 8b 0f             	mov    (%rdi),%r9
+    1ed1:	|  |                           48 8d 7c 24 1f       	lea    0x1f(%rsp),%rdi
+    1ed6:	|  |                           48 0f 46 de          	cmovbe %rsi,%rbx
+    Index o = 0;
+    1eda:	|  |                           31 c0                	xor    %eax,%eax
+    1edc:	|  |                           0f 1f 40 00          	nopl   0x0(%rax)
+        buf[o++] = char(ds[i]);
+    1ee0:	|  |                       /-> 41 0f b6 14 01       	movzbl (%r9,%rax,1),%edx
+    1ee5:	|  |                       |   48 83 c0 01          	add    $0x1,%rax
+    1ee9:	|  |                       |   88 14 07             	mov    %dl,(%rdi,%rax,1)
+    for (Index i = 0; i < kept; ++i) {
+    1eec:	|  |                       |   48 39 d8             	cmp    %rbx,%rax
+    1eef:	|  |                       \-- 72 ef                	jb     1ee0 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x50>
+    1ef1:	|  |                           4c 39 d0             	cmp    %r10,%rax
+    1ef4:	|  |  /----------------------- 0f 83 66 01 00 00    	jae    2060 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x1d0>
+    1efa:	|  |  |  /-------------------> 48 8d 7c 24 20       	lea    0x20(%rsp),%rdi
+    1eff:	|  |  |  |                     49 8b 5b 10          	mov    0x10(%r11),%rbx
+    1f03:	|  |  |  |                     48 29 f0             	sub    %rsi,%rax
+        buf[o++] = char(ds[i]);
+    1f06:	|  |  |  |                     4c 8d 0c 37          	lea    (%rdi,%rsi,1),%r9
+    1f0a:	|  |  |  |                     66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1f10:	|  |  |  |                 /-> 0f b6 14 03          	movzbl (%rbx,%rax,1),%edx
+    1f14:	|  |  |  |                 |   41 88 14 01          	mov    %dl,(%r9,%rax,1)
+    for (Index i = 0; i < kept; ++i) {
+    1f18:	|  |  |  |                 |   48 83 c0 01          	add    $0x1,%rax
+    1f1c:	|  |  |  |                 |   48 8d 14 06          	lea    (%rsi,%rax,1),%rdx
+    1f20:	|  |  |  |                 |   4c 39 d2             	cmp    %r10,%rdx
+    1f23:	|  |  |  |                 \-- 72 eb                	jb     1f10 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x80>
+        buf[o++] = char(ds[i]);
+    1f25:	|  |  |  |  /----------------> 4d 85 c0             	test   %r8,%r8
+    1f28:	|  |  |  |  |                  bb 01 00 00 00       	mov    $0x1,%ebx
+    }
+    q += (long long int)(n - kept);
+    1f2d:	|  |  |  |  |                  4c 89 c0             	mov    %r8,%rax
+        buf[o++] = char(ds[i]);
+    1f30:	|  |  |  |  |                  49 0f 45 da          	cmovne %r10,%rbx
+    q += (long long int)(n - kept);
+    1f34:	|  |  |  |  |                  4c 29 d0             	sub    %r10,%rax
+    1f37:	|  |  |  |  |                  48 01 c1             	add    %rax,%rcx
+    for (Index i = kept; i < n; ++i) {
+    1f3a:	|  |  |  |  |                  4d 39 c2             	cmp    %r8,%r10
+    1f3d:	|  |  |  |  |  /-------------- 0f 83 0d 01 00 00    	jae    2050 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x1c0>
+    1f43:	|  |  |  |  |  |               4c 89 d2             	mov    %r10,%rdx
+    1f46:	|  |  |  |  |  |               4c 89 d0             	mov    %r10,%rax
+    1f49:	|  |  |  |  |  |               48 29 f2             	sub    %rsi,%rdx
+    1f4c:	|  |  |  |  |  |        /----- eb 21                	jmp    1f6f <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0xdf>
+    1f4e:	|  |  |  |  |  |        |      66 90                	xchg   %ax,%ax
+            return (i < an) ? a[i] : b[i - an];
+    1f50:	|  |  |  |  |  |        |  /-> 4d 8b 0b             	mov    (%r11),%r9
+    1f53:	|  |  |  |  |  |        |  |   45 0f b6 0c 01       	movzbl (%r9,%rax,1),%r9d
+        if (ds[i] != '0') {
+    1f58:	|  |  |  |  |  |        |  |   41 80 f9 30          	cmp    $0x30,%r9b
+    1f5c:	|  |  |  |  |  |  /-----|--|-- 75 25                	jne    1f83 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0xf3>
+    for (Index i = kept; i < n; ++i) {
+    1f5e:	|  |  |  |  |  |  |  /--|--|-> 48 83 c0 01          	add    $0x1,%rax
+    1f62:	|  |  |  |  |  |  |  |  |  |   48 83 c2 01          	add    $0x1,%rdx
+    1f66:	|  |  |  |  |  |  |  |  |  |   4c 39 c0             	cmp    %r8,%rax
+    1f69:	|  |  |  |  |  +--|--|--|--|-- 0f 83 e1 00 00 00    	jae    2050 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x1c0>
+            return (i < an) ? a[i] : b[i - an];
+    1f6f:	|  |  |  |  |  |  |  |  \--|-> 48 39 f0             	cmp    %rsi,%rax
+    1f72:	|  |  |  |  |  |  |  |     \-- 72 dc                	jb     1f50 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0xc0>
+    1f74:	|  |  |  |  |  |  |  |         4d 8b 4b 10          	mov    0x10(%r11),%r9
+    1f78:	|  |  |  |  |  |  |  |         45 0f b6 0c 11       	movzbl (%r9,%rdx,1),%r9d
+        if (ds[i] != '0') {
+    1f7d:	|  |  |  |  |  |  |  |         41 80 f9 30          	cmp    $0x30,%r9b
+    1f81:	|  |  |  |  |  |  |  \-------- 74 db                	je     1f5e <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0xce>
+    1f83:	|  |  |  |  |  |  \----------> 49 83 ea 01          	sub    $0x1,%r10
+    1f87:	|  |  |  |  |  |               31 c0                	xor    %eax,%eax
+    1f89:	|  |  |  |  |  |               4d 85 c0             	test   %r8,%r8
+            buf[o++] = '1';
+    1f8c:	|  |  |  |  |  |               c6 44 1c 20 31       	movb   $0x31,0x20(%rsp,%rbx,1)
+    1f91:	|  |  |  |  |  |               4c 0f 44 d0          	cmove  %rax,%r10
+            q -= 1;
+    1f95:	|  |  |  |  |  |               48 83 e9 01          	sub    $0x1,%rcx
+            buf[o++] = '1';
+    1f99:	|  |  |  |  |  |               4d 8d 42 02          	lea    0x2(%r10),%r8
+            break;
+        }
+    }
+    buf[o++] = 'e';
+    1f9d:	|  |  |  |  |  |               49 83 c2 03          	add    $0x3,%r10
+    1fa1:	|  |  |  |  |  |        /----> 42 c6 44 04 20 65    	movb   $0x65,0x20(%rsp,%r8,1)
+    if (q < 0) {
+    1fa7:	|  |  |  |  |  |        |      48 85 c9             	test   %rcx,%rcx
+    1faa:	|  |  |  |  |  |        |  /-- 79 0d                	jns    1fb9 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x129>
+        buf[o++] = '-';
+    1fac:	|  |  |  |  |  |        |  |   42 c6 44 14 20 2d    	movb   $0x2d,0x20(%rsp,%r10,1)
+        q = -q;
+    1fb2:	|  |  |  |  |  |        |  |   48 f7 d9             	neg    %rcx
+        buf[o++] = '-';
+    1fb5:	|  |  |  |  |  |        |  |   4d 8d 50 02          	lea    0x2(%r8),%r10
+    }
+    char e[24];
+    Index en = 0;
+    1fb9:	|  |  |  |  |  |        |  \-> 31 f6                	xor    %esi,%esi
+    1fbb:	|  |  |  |  |  |        |      49 89 e0             	mov    %rsp,%r8
+    1fbe:	|  |  |  |  |  |        |      4c 8d 5c 24 ff       	lea    -0x1(%rsp),%r11
+    do {
+        e[en++] = char('0' + q % 10);
+    1fc3:	|  |  |  |  |  |        |      49 b9 cd cc cc cc cc 	movabs $0xcccccccccccccccd,%r9
+    1fca:	|  |  |  |  |  |        |      cc cc cc 
+    1fcd:	|  |  |  |  |  |        |      0f 1f 00             	nopl   (%rax)
+    1fd0:	|  |  |  |  |  |        |  /-> 48 89 c8             	mov    %rcx,%rax
+    1fd3:	|  |  |  |  |  |        |  |   48 83 c6 01          	add    $0x1,%rsi
+    1fd7:	|  |  |  |  |  |        |  |   49 f7 e1             	mul    %r9
+    1fda:	|  |  |  |  |  |        |  |   48 c1 ea 03          	shr    $0x3,%rdx
+    1fde:	|  |  |  |  |  |        |  |   48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+    1fe2:	|  |  |  |  |  |        |  |   48 01 c0             	add    %rax,%rax
+    1fe5:	|  |  |  |  |  |        |  |   48 29 c1             	sub    %rax,%rcx
+    1fe8:	|  |  |  |  |  |        |  |   83 c1 30             	add    $0x30,%ecx
+    1feb:	|  |  |  |  |  |        |  |   41 88 0c 33          	mov    %cl,(%r11,%rsi,1)
+        q /= 10;
+    1fef:	|  |  |  |  |  |        |  |   48 89 d1             	mov    %rdx,%rcx
+    } while (q != 0);
+    1ff2:	|  |  |  |  |  |        |  |   48 85 d2             	test   %rdx,%rdx
+    1ff5:	|  |  |  |  |  |        |  \-- 75 d9                	jne    1fd0 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x140>
+    1ff7:	|  |  |  |  |  |        |      49 8d 04 30          	lea    (%r8,%rsi,1),%rax
+    1ffb:	|  |  |  |  |  |        |      4a 8d 14 17          	lea    (%rdi,%r10,1),%rdx
+    1fff:	|  |  |  |  |  |        |      90                   	nop
+    while (en > 0) {
+        buf[o++] = e[--en];
+    2000:	|  |  |  |  |  |        |  /-> 0f b6 48 ff          	movzbl -0x1(%rax),%ecx
+    while (en > 0) {
+    2004:	|  |  |  |  |  |        |  |   48 83 e8 01          	sub    $0x1,%rax
+    2008:	|  |  |  |  |  |        |  |   48 83 c2 01          	add    $0x1,%rdx
+        buf[o++] = e[--en];
+    200c:	|  |  |  |  |  |        |  |   88 4a ff             	mov    %cl,-0x1(%rdx)
+    while (en > 0) {
+    200f:	|  |  |  |  |  |        |  |   49 39 c0             	cmp    %rax,%r8
+    2012:	|  |  |  |  |  |        |  \-- 75 ec                	jne    2000 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x170>
+    }
+    buf[o] = '\0';
+    2014:	|  |  |  |  |  |        |      49 8d 82 40 03 00 00 	lea    0x340(%r10),%rax
+    201b:	|  |  |  |  |  |        |      4c 8d 14 04          	lea    (%rsp,%rax,1),%r10
+    201f:	|  |  |  |  |  |        |      42 c6 84 16 e0 fc ff 	movb   $0x0,-0x320(%rsi,%r10,1)
+    2026:	|  |  |  |  |  |        |      ff 00 
+    return std::strtod(buf, nullptr);
+    2028:	|  |  |  |  |  |        |      31 f6                	xor    %esi,%esi
+    202a:	|  |  |  |  |  |        |      e8 11 f0 ff ff       	call   1040 <strtod@plt>
+}
+    202f:	|  |  |  |  |  |        |      48 81 c4 40 03 00 00 	add    $0x340,%rsp
+    2036:	|  |  |  |  |  |        |      5b                   	pop    %rbx
+    2037:	|  |  |  |  |  |        |      c3                   	ret
+    2038:	|  |  |  |  |  |        |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    203f:	|  |  |  |  |  |        |      00 
+    for (Index i = 0; i < kept; ++i) {
+    2040:	|  \--|--|--|--|--------|----> 31 c0                	xor    %eax,%eax
+    2042:	|     |  \--|--|--------|----- e9 b3 fe ff ff       	jmp    1efa <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x6a>
+    2047:	|     |     |  |        |      66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    204e:	|     |     |  |        |      00 00 
+    buf[o++] = 'e';
+    2050:	|     |     |  \--------|----> 4c 8d 53 01          	lea    0x1(%rbx),%r10
+        buf[o++] = char(ds[i]);
+    2054:	|     |     |           |      49 89 d8             	mov    %rbx,%r8
+    2057:	|     |     |           +----- e9 45 ff ff ff       	jmp    1fa1 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x111>
+    205c:	|     |     |           |      0f 1f 40 00          	nopl   0x0(%rax)
+    2060:	|     \-----|-----------|----> 48 8d 7c 24 20       	lea    0x20(%rsp),%rdi
+    2065:	|           \-----------|----- e9 bb fe ff ff       	jmp    1f25 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x95>
+    206a:	|                       |      66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    for (Index i = 0; i < kept; ++i) {
+    2070:	\-----------------------|----> 41 ba 01 00 00 00    	mov    $0x1,%r10d
+    2076:	                        |      48 8d 7c 24 20       	lea    0x20(%rsp),%rdi
+    207b:	                        \----- e9 21 ff ff ff       	jmp    1fa1 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x111>
+
+0000000000002080 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)>:
+    if (w == 0 || q < pow5_min) { return Binary{0, 0}; }
+    2080:	                         48 85 f6             	test   %rsi,%rsi
+    2083:	                  /----- 74 1b                	je     20a0 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x20>
+    2085:	                  |      48 81 ff aa fe ff ff 	cmp    $0xfffffffffffffeaa,%rdi
+    208c:	                  +----- 7c 12                	jl     20a0 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x20>
+    if (q > pow5_max) { return Binary{0, infinite_power}; }
+    208e:	                  |      48 81 ff 34 01 00 00 	cmp    $0x134,%rdi
+    2095:	                  |  /-- 7e 11                	jle    20a8 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x28>
+    2097:	                  |  |   31 c0                	xor    %eax,%eax
+    2099:	                  |  |   ba ff 07 00 00       	mov    $0x7ff,%edx
+}
+    209e:	      /-----------|--|-> c3                   	ret
+    209f:	      |           |  |   90                   	nop
+    20a0:	      |           \--|-> 31 c0                	xor    %eax,%eax
+    20a2:	      |              |   31 d2                	xor    %edx,%edx
+    20a4:	      |              |   c3                   	ret
+    20a5:	      |              |   0f 1f 00             	nopl   (%rax)
+    int const lz = __builtin_clzll(w);
+    20a8:	      |              \-> 4c 0f bd ce          	bsr    %rsi,%r9
+    Index const k = Index(2 * (q - pow5_min));
+    20ac:	      |                  4c 8d 9c 3f ac 02 00 	lea    0x2ac(%rdi,%rdi,1),%r11
+    20b3:	      |                  00 
+    int const lz = __builtin_clzll(w);
+    20b4:	      |                  49 83 f1 3f          	xor    $0x3f,%r9
+    w <<= lz;
+    20b8:	      |                  44 89 c9             	mov    %r9d,%ecx
+    20bb:	      |                  48 d3 e6             	shl    %cl,%rsi
+    Wide p = mul_wide(w, pow5_128[k]);
+    20be:	      |                  48 8d 0d 5b 20 00 00 	lea    0x205b(%rip),%rcx        # 4120 <nel::(anonymous namespace)::pow5_128>
+    U128 const r = U128(a) * b;
+    20c5:	      |                  48 89 f0             	mov    %rsi,%rax
+    20c8:	      |                  4a f7 24 d9          	mulq   (%rcx,%r11,8)
+    return Wide{Word(r), Word(r >> 64)};
+    20cc:	      |                  49 89 c2             	mov    %rax,%r10
+    if ((p.hi & precision_mask) == precision_mask) {
+    20cf:	      |                  48 89 d0             	mov    %rdx,%rax
+    return Wide{Word(r), Word(r >> 64)};
+    20d2:	      |                  49 89 d0             	mov    %rdx,%r8
+    if ((p.hi & precision_mask) == precision_mask) {
+    20d5:	      |                  25 ff 01 00 00       	and    $0x1ff,%eax
+    20da:	      |                  48 3d ff 01 00 00    	cmp    $0x1ff,%rax
+    20e0:	      |     /----------- 0f 84 8a 00 00 00    	je     2170 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0xf0>
+    r.power2 = int((((152170 + 65536) * q) >> 16) + 63) + upperbit - lz + 1023;
+    20e6:	   /--|-----|----------> 48 69 f7 6a 52 03 00 	imul   $0x3526a,%rdi,%rsi
+    int const upperbit = int(p.hi >> 63);
+    20ed:	   |  |     |            4c 89 c2             	mov    %r8,%rdx
+    r.mantissa = p.hi >> shift;
+    20f0:	   |  |     |            4c 89 c0             	mov    %r8,%rax
+    int const upperbit = int(p.hi >> 63);
+    20f3:	   |  |     |            48 c1 ea 3f          	shr    $0x3f,%rdx
+    int const shift = upperbit + 64 - mantissa_bits - 3;
+    20f7:	   |  |     |            8d 4a 09             	lea    0x9(%rdx),%ecx
+    r.power2 = int((((152170 + 65536) * q) >> 16) + 63) + upperbit - lz + 1023;
+    20fa:	   |  |     |            48 c1 fe 10          	sar    $0x10,%rsi
+    r.mantissa = p.hi >> shift;
+    20fe:	   |  |     |            48 d3 e8             	shr    %cl,%rax
+    r.power2 = int((((152170 + 65536) * q) >> 16) + 63) + upperbit - lz + 1023;
+    2101:	   |  |     |            44 29 ce             	sub    %r9d,%esi
+    2104:	   |  |     |            01 d6                	add    %edx,%esi
+    2106:	   |  |     |            8d 96 3e 04 00 00    	lea    0x43e(%rsi),%edx
+    if (r.power2 <= 0) {
+    210c:	   |  |     |            85 d2                	test   %edx,%edx
+    210e:	   |  |     |        /-- 7e 38                	jle    2148 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0xc8>
+    if (p.lo <= 1 && q >= -4 && q <= 23 && (r.mantissa & 3) == 1 &&
+    2110:	   |  |     |        |   49 83 fa 01          	cmp    $0x1,%r10
+    2114:	   |  |  /--|--------|-- 0f 86 8e 00 00 00    	jbe    21a8 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x128>
+    r.mantissa += (r.mantissa & 1);
+    211a:	/--|--|--|--|--------|-> 48 8d 48 01          	lea    0x1(%rax),%rcx
+    211e:	|  |  |  |  |        |   48 89 c8             	mov    %rcx,%rax
+    2121:	|  |  |  |  |        |   48 d1 e8             	shr    %rax
+    if (r.mantissa >= (2ULL << mantissa_bits)) {
+    2124:	|  |  |  |  |        |   48 c1 e9 36          	shr    $0x36,%rcx
+    2128:	|  |  |  |  |     /--|-- 75 6e                	jne    2198 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x118>
+    r.mantissa &= ~(1ULL << mantissa_bits);
+    212a:	|  |  |  |  |     |  |   48 0f ba f0 34       	btr    $0x34,%rax
+    if (r.power2 >= infinite_power) { return Binary{0, infinite_power}; }
+    212f:	|  |  |  |  |  /--|--|-> 81 fa fe 07 00 00    	cmp    $0x7fe,%edx
+    2135:	|  |  \--|--|--|--|--|-- 0f 8e 63 ff ff ff    	jle    209e <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x1e>
+    213b:	|  |     |  |  |  |  |   ba ff 07 00 00       	mov    $0x7ff,%edx
+    2140:	|  |     |  |  |  |  |   31 c0                	xor    %eax,%eax
+    2142:	|  |     |  |  |  |  |   c3                   	ret
+    2143:	|  |     |  |  |  |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        if (-r.power2 + 1 >= 64) { return Binary{0, 0}; }
+    2148:	|  |     |  |  |  |  \-> b9 01 00 00 00       	mov    $0x1,%ecx
+    214d:	|  |     |  |  |  |      29 d1                	sub    %edx,%ecx
+    214f:	|  |     |  |  |  |      83 f9 3f             	cmp    $0x3f,%ecx
+    2152:	|  |     |  |  |  |  /-- 0f 8f 88 00 00 00    	jg     21e0 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x160>
+        r.mantissa >>= -r.power2 + 1;
+    2158:	|  |     |  |  |  |  |   48 d3 e8             	shr    %cl,%rax
+        r.mantissa += (r.mantissa & 1);
+    215b:	|  |     |  |  |  |  |   48 8d 50 01          	lea    0x1(%rax),%rdx
+    215f:	|  |     |  |  |  |  |   48 89 d0             	mov    %rdx,%rax
+    2162:	|  |     |  |  |  |  |   48 d1 e8             	shr    %rax
+        r.power2 = (r.mantissa < (1ULL << mantissa_bits)) ? 0 : 1;
+    2165:	|  |     |  |  |  |  |   48 c1 ea 35          	shr    $0x35,%rdx
+    2169:	|  |     |  |  |  |  |   0f 95 c2             	setne  %dl
+    216c:	|  |     |  |  |  |  |   0f b6 d2             	movzbl %dl,%edx
+        return r;
+    216f:	|  |     |  |  |  |  |   c3                   	ret
+    return Wide{Word(r), Word(r >> 64)};
+    2170:	|  |     |  \--|--|--|-> 48 89 f0             	mov    %rsi,%rax
+    2173:	|  |     |     |  |  |   4a f7 64 d9 08       	mulq   0x8(%rcx,%r11,8)
+    2178:	|  |     |     |  |  |   31 c0                	xor    %eax,%eax
+    217a:	|  |     |     |  |  |   48 89 d6             	mov    %rdx,%rsi
+    217d:	|  |     |     |  |  |   4c 01 d6             	add    %r10,%rsi
+    2180:	|  |     |     |  |  |   0f 92 c0             	setb   %al
+        p.lo += p2.hi;
+    2183:	|  |     |     |  |  |   49 89 f2             	mov    %rsi,%r10
+        if (p2.hi > p.lo) { p.hi += 1; }
+    2186:	|  |     |     |  |  |   48 83 f8 01          	cmp    $0x1,%rax
+    218a:	|  |     |     |  |  |   49 83 d8 ff          	sbb    $0xffffffffffffffff,%r8
+    218e:	|  \-----|-----|--|--|-- e9 53 ff ff ff       	jmp    20e6 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x66>
+    2193:	|        |     |  |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        r.power2 += 1;
+    2198:	|        |     |  \--|-> 8d 96 3f 04 00 00    	lea    0x43f(%rsi),%edx
+    219e:	|        |     |     |   31 c0                	xor    %eax,%eax
+    21a0:	|        |     \-----|-- eb 8d                	jmp    212f <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0xaf>
+    21a2:	|        |           |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    if (p.lo <= 1 && q >= -4 && q <= 23 && (r.mantissa & 3) == 1 &&
+    21a8:	|        \-----------|-> 48 83 c7 04          	add    $0x4,%rdi
+    21ac:	|                    |   48 83 ff 1b          	cmp    $0x1b,%rdi
+    21b0:	+--------------------|-- 0f 87 64 ff ff ff    	ja     211a <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x9a>
+    21b6:	|                    |   48 89 c7             	mov    %rax,%rdi
+    21b9:	|                    |   83 e7 03             	and    $0x3,%edi
+    21bc:	|                    |   48 83 ff 01          	cmp    $0x1,%rdi
+    21c0:	+--------------------|-- 0f 85 54 ff ff ff    	jne    211a <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x9a>
+        (r.mantissa << shift) == p.hi) {
+    21c6:	|                    |   48 89 c7             	mov    %rax,%rdi
+    21c9:	|                    |   48 d3 e7             	shl    %cl,%rdi
+        r.mantissa &= ~1ULL;
+    21cc:	|                    |   48 89 c1             	mov    %rax,%rcx
+    21cf:	|                    |   48 83 e1 fe          	and    $0xfffffffffffffffe,%rcx
+    21d3:	|                    |   49 39 f8             	cmp    %rdi,%r8
+    21d6:	|                    |   48 0f 44 c1          	cmove  %rcx,%rax
+    21da:	\--------------------|-- e9 3b ff ff ff       	jmp    211a <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x9a>
+    21df:	                     |   90                   	nop
+        if (-r.power2 + 1 >= 64) { return Binary{0, 0}; }
+    21e0:	                     \-> 31 d2                	xor    %edx,%edx
+    21e2:	                         31 c0                	xor    %eax,%eax
+    21e4:	                         c3                   	ret
+    21e5:	                         66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    21ec:	                         00 00 00 00 
+
+00000000000021f0 <nel::parse_u64(nel::Slice<unsigned char const> const&)>:
+
+} // namespace
+
+Result<Pair<long long unsigned int, Length>, ParseError>
+parse_u64(Slice<unsigned char const> const &s)
+{
+    21f0:	                                  41 55                	push   %r13
+    21f2:	                                  41 54                	push   %r12
+    21f4:	                                  55                   	push   %rbp
+    21f5:	                                  48 89 fd             	mov    %rdi,%rbp
+    21f8:	                                  53                   	push   %rbx
+         *
+         * @returns number of elements in the slice.
+         */
+        constexpr Length len(void) const
+        {
+            return len_;
+    21f9:	                                  48 8b 4e 08          	mov    0x8(%rsi),%rcx
+            return content_;
+    21fd:	                                  4c 8b 26             	mov    (%rsi),%r12
+    if (n == 0) { return R::Err(ParseError::Empty); }
+    2200:	                                  48 85 c9             	test   %rcx,%rcx
+    2203:	                              /-- 75 1b                	jne    2220 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x30>
+            : tag_(Tag::ERR)
+    2205:	                              |   c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+            : value_(forward<Type>(val))
+    220b:	                              |   c7 47 08 01 00 00 00 	movl   $0x1,0x8(%rdi)
+    return parse_magnitude(s.ptr(), s.len());
+}
+    2212:	/-----------------------------|-> 5b                   	pop    %rbx
+    2213:	|                             |   48 89 e8             	mov    %rbp,%rax
+    2216:	|                             |   5d                   	pop    %rbp
+    2217:	|                             |   41 5c                	pop    %r12
+    2219:	|                             |   41 5d                	pop    %r13
+    221b:	|                             |   c3                   	ret
+    221c:	|                             |   0f 1f 40 00          	nopl   0x0(%rax)
+    return (unsigned char)(c - '0') < 10;
+    2220:	|                             \-> 41 0f b6 04 24       	movzbl (%r12),%eax
+    2225:	|                                 83 e8 30             	sub    $0x30,%eax
+    if (!is_digit(p[0])) { return R::Err(ParseError::InvalidDigit); }
+    2228:	|                                 3c 09                	cmp    $0x9,%al
+    222a:	|                             /-- 76 1c                	jbe    2248 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x58>
+    222c:	|                             |   c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+}
+    2232:	|                             |   48 89 e8             	mov    %rbp,%rax
+    2235:	|                             |   c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    223c:	|                             |   5b                   	pop    %rbx
+    223d:	|                             |   5d                   	pop    %rbp
+    223e:	|                             |   41 5c                	pop    %r12
+    2240:	|                             |   41 5d                	pop    %r13
+    2242:	|                             |   c3                   	ret
+    2243:	|                             |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    Index z = 0;
+    2248:	|                             \-> 31 db                	xor    %ebx,%ebx
+    224a:	|                          /----- eb 11                	jmp    225d <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x6d>
+    224c:	|                          |      0f 1f 40 00          	nopl   0x0(%rax)
+        z += 1;
+    2250:	|                          |  /-> 48 83 c3 01          	add    $0x1,%rbx
+    while (z < n && p[z] == '0') {
+    2254:	|                          |  |   48 39 d9             	cmp    %rbx,%rcx
+    2257:	|     /--------------------|--|-- 0f 84 b3 01 00 00    	je     2410 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x220>
+    225d:	|     |                    \--|-> 41 80 3c 1c 30       	cmpb   $0x30,(%r12,%rbx,1)
+    2262:	|     |                       \-- 74 ec                	je     2250 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x60>
+    2264:	|     |                           49 8d 3c 1c          	lea    (%r12,%rbx,1),%rdi
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    2268:	|     |     /-------------------> 49 bb 46 46 46 46 46 	movabs $0x4646464646464646,%r11
+    226f:	|     |     |                     46 46 46 
+    Length const d = digit_run(p + z, n - z);
+    2272:	|     |     |                     48 29 d9             	sub    %rbx,%rcx
+    Index i = 0;
+    2275:	|     |     |                     31 f6                	xor    %esi,%esi
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    2277:	|     |     |                     49 ba d0 cf cf cf cf 	movabs $0xcfcfcfcfcfcfcfd0,%r10
+    227e:	|     |     |                     cf cf cf 
+    2281:	|     |     |                     49 b9 80 80 80 80 80 	movabs $0x8080808080808080,%r9
+    2288:	|     |     |                     80 80 80 
+    while (i + 8 <= n) {
+    228b:	|     |     |                 /-- eb 1b                	jmp    22a8 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0xb8>
+    228d:	|     |     |                 |   0f 1f 00             	nopl   (%rax)
+    __builtin_memcpy(&v, p, sizeof(v));
+    2290:	|     |     |              /--|-> 48 8b 54 37 f8       	mov    -0x8(%rdi,%rsi,1),%rdx
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    2295:	|     |     |              |  |   4a 8d 04 1a          	lea    (%rdx,%r11,1),%rax
+    2299:	|     |     |              |  |   4c 01 d2             	add    %r10,%rdx
+    229c:	|     |     |              |  |   48 09 d0             	or     %rdx,%rax
+        if (m != 0) { return i + Length(__builtin_ctzll(m) / 8); }
+    229f:	|     |     |              |  |   4c 21 c8             	and    %r9,%rax
+    22a2:	|     |     |     /--------|--|-- 0f 85 28 01 00 00    	jne    23d0 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x1e0>
+    while (i + 8 <= n) {
+    22a8:	|     |     |     |        |  \-> 49 89 f0             	mov    %rsi,%r8
+    22ab:	|     |     |     |        |      48 83 c6 08          	add    $0x8,%rsi
+    22af:	|     |     |     |        |      48 39 f1             	cmp    %rsi,%rcx
+    22b2:	|     |     |     |        \----- 73 dc                	jae    2290 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0xa0>
+    while (i < n && is_digit(p[i])) {
+    22b4:	|     |     |     |               49 39 c8             	cmp    %rcx,%r8
+    22b7:	|     |  /--|-----|-------------- 0f 83 af 01 00 00    	jae    246c <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x27c>
+    return (unsigned char)(c - '0') < 10;
+    22bd:	|     |  |  |     |               42 0f b6 04 07       	movzbl (%rdi,%r8,1),%eax
+    22c2:	|     |  |  |     |               83 e8 30             	sub    $0x30,%eax
+    while (i < n && is_digit(p[i])) {
+    22c5:	|     |  |  |     |               3c 09                	cmp    $0x9,%al
+    22c7:	|  /--|--|--|-----|-------------- 0f 87 b5 01 00 00    	ja     2482 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x292>
+        i += 1;
+    22cd:	|  |  |  |  |     |               49 8d 50 01          	lea    0x1(%r8),%rdx
+    while (i < n && is_digit(p[i])) {
+    22d1:	|  |  |  |  |     |               48 39 ca             	cmp    %rcx,%rdx
+    22d4:	|  |  |  |  |  /--|-------------- 0f 83 46 01 00 00    	jae    2420 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x230>
+    return (unsigned char)(c - '0') < 10;
+    22da:	|  |  |  |  |  |  |               42 0f b6 44 07 01    	movzbl 0x1(%rdi,%r8,1),%eax
+    22e0:	|  |  |  |  |  |  |               83 e8 30             	sub    $0x30,%eax
+    while (i < n && is_digit(p[i])) {
+    22e3:	|  |  |  |  |  |  |               3c 09                	cmp    $0x9,%al
+    22e5:	|  |  |  |  |  +--|-------------- 0f 87 35 01 00 00    	ja     2420 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x230>
+        i += 1;
+    22eb:	|  |  |  |  |  |  |               49 8d 50 02          	lea    0x2(%r8),%rdx
+    while (i < n && is_digit(p[i])) {
+    22ef:	|  |  |  |  |  |  |               48 39 ca             	cmp    %rcx,%rdx
+    22f2:	|  |  |  |  |  +--|-------------- 0f 83 28 01 00 00    	jae    2420 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x230>
+    return (unsigned char)(c - '0') < 10;
+    22f8:	|  |  |  |  |  |  |               42 0f b6 44 07 02    	movzbl 0x2(%rdi,%r8,1),%eax
+    22fe:	|  |  |  |  |  |  |               83 e8 30             	sub    $0x30,%eax
+    while (i < n && is_digit(p[i])) {
+    2301:	|  |  |  |  |  |  |               3c 09                	cmp    $0x9,%al
+    2303:	|  |  |  |  |  +--|-------------- 0f 87 17 01 00 00    	ja     2420 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x230>
+        i += 1;
+    2309:	|  |  |  |  |  |  |               49 8d 50 03          	lea    0x3(%r8),%rdx
+    while (i < n && is_digit(p[i])) {
+    230d:	|  |  |  |  |  |  |               48 39 ca             	cmp    %rcx,%rdx
+    2310:	|  |  |  |  |  +--|-------------- 0f 83 0a 01 00 00    	jae    2420 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x230>
+    return (unsigned char)(c - '0') < 10;
+    2316:	|  |  |  |  |  |  |               42 0f b6 44 07 03    	movzbl 0x3(%rdi,%r8,1),%eax
+    231c:	|  |  |  |  |  |  |               83 e8 30             	sub    $0x30,%eax
+    while (i < n && is_digit(p[i])) {
+    231f:	|  |  |  |  |  |  |               3c 09                	cmp    $0x9,%al
+    2321:	|  |  |  |  |  +--|-------------- 0f 87 f9 00 00 00    	ja     2420 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x230>
+        i += 1;
+    2327:	|  |  |  |  |  |  |               49 8d 50 04          	lea    0x4(%r8),%rdx
+    while (i < n && is_digit(p[i])) {
+    232b:	|  |  |  |  |  |  |               48 39 ca             	cmp    %rcx,%rdx
+    232e:	|  |  |  |  |  +--|-------------- 0f 83 ec 00 00 00    	jae    2420 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x230>
+    return (unsigned char)(c - '0') < 10;
+    2334:	|  |  |  |  |  |  |               42 0f b6 44 07 04    	movzbl 0x4(%rdi,%r8,1),%eax
+    233a:	|  |  |  |  |  |  |               83 e8 30             	sub    $0x30,%eax
+    while (i < n && is_digit(p[i])) {
+    233d:	|  |  |  |  |  |  |               3c 09                	cmp    $0x9,%al
+    233f:	|  |  |  |  |  +--|-------------- 0f 87 db 00 00 00    	ja     2420 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x230>
+        i += 1;
+    2345:	|  |  |  |  |  |  |               49 8d 50 05          	lea    0x5(%r8),%rdx
+    while (i < n && is_digit(p[i])) {
+    2349:	|  |  |  |  |  |  |               48 39 ca             	cmp    %rcx,%rdx
+    234c:	|  |  |  |  |  +--|-------------- 0f 83 ce 00 00 00    	jae    2420 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x230>
+    return (unsigned char)(c - '0') < 10;
+    2352:	|  |  |  |  |  |  |               42 0f b6 44 07 05    	movzbl 0x5(%rdi,%r8,1),%eax
+    2358:	|  |  |  |  |  |  |               83 e8 30             	sub    $0x30,%eax
+    while (i < n && is_digit(p[i])) {
+    235b:	|  |  |  |  |  |  |               3c 09                	cmp    $0x9,%al
+    235d:	|  |  |  |  |  +--|-------------- 0f 87 bd 00 00 00    	ja     2420 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x230>
+        i += 1;
+    2363:	|  |  |  |  |  |  |               49 8d 50 06          	lea    0x6(%r8),%rdx
+    while (i < n && is_digit(p[i])) {
+    2367:	|  |  |  |  |  |  |               48 39 ca             	cmp    %rcx,%rdx
+    236a:	|  |  |  |  |  +--|-------------- 0f 83 b0 00 00 00    	jae    2420 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x230>
+    return (unsigned char)(c - '0') < 10;
+    2370:	|  |  |  |  |  |  |               42 0f b6 44 07 06    	movzbl 0x6(%rdi,%r8,1),%eax
+    2376:	|  |  |  |  |  |  |               83 e8 30             	sub    $0x30,%eax
+    while (i < n && is_digit(p[i])) {
+    2379:	|  |  |  |  |  |  |               3c 09                	cmp    $0x9,%al
+    237b:	|  |  |  |  |  +--|-------------- 0f 87 9f 00 00 00    	ja     2420 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x230>
+        i += 1;
+    2381:	|  |  |  |  |  |  |               49 8d 50 07          	lea    0x7(%r8),%rdx
+    while (i < n && is_digit(p[i])) {
+    2385:	|  |  |  |  |  |  |               48 39 ca             	cmp    %rcx,%rdx
+    2388:	|  |  |  |  |  +--|-------------- 0f 83 92 00 00 00    	jae    2420 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x230>
+    return (unsigned char)(c - '0') < 10;
+    238e:	|  |  |  |  |  |  |               42 0f b6 44 07 07    	movzbl 0x7(%rdi,%r8,1),%eax
+    2394:	|  |  |  |  |  |  |               83 e8 30             	sub    $0x30,%eax
+        i += 1;
+    2397:	|  |  |  |  |  |  |               3c 0a                	cmp    $0xa,%al
+    2399:	|  |  |  |  |  |  |               48 0f 43 f2          	cmovae %rdx,%rsi
+    Length const used = z + d;
+    239d:	|  |  |  |  |  |  |  /----------> 4c 8d 2c 1e          	lea    (%rsi,%rbx,1),%r13
+    if (d <= 19) { return R::Ok(Pair<Word, Length>{digits_value(p + z, d, n - z), used}); }
+    23a1:	|  |  |  |  |  |  |  |            48 83 fe 13          	cmp    $0x13,%rsi
+    23a5:	|  |  |  |  |  |  |  |        /-- 77 41                	ja     23e8 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x1f8>
+    23a7:	|  |  |  |  |  |  |  |  /-----|-> 48 89 ca             	mov    %rcx,%rdx
+    23aa:	|  |  |  |  |  |  |  |  |     |   e8 71 f9 ff ff       	call   1d20 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+            : tag_(Tag::OK)
+    23af:	|  |  |  |  |  |  |  |  |     |   c7 45 00 01 00 00 00 	movl   $0x1,0x0(%rbp)
+    23b6:	|  |  |  |  |  |  |  |  |     |   48 89 45 08          	mov    %rax,0x8(%rbp)
+}
+    23ba:	|  |  |  |  |  |  |  |  |     |   48 89 e8             	mov    %rbp,%rax
+    23bd:	|  |  |  |  |  |  |  |  |     |   4c 89 6d 10          	mov    %r13,0x10(%rbp)
+    23c1:	|  |  |  |  |  |  |  |  |     |   5b                   	pop    %rbx
+    23c2:	|  |  |  |  |  |  |  |  |     |   5d                   	pop    %rbp
+    23c3:	|  |  |  |  |  |  |  |  |     |   41 5c                	pop    %r12
+    23c5:	|  |  |  |  |  |  |  |  |     |   41 5d                	pop    %r13
+    23c7:	|  |  |  |  |  |  |  |  |     |   c3                   	ret
+    23c8:	|  |  |  |  |  |  |  |  |     |   0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    23cf:	|  |  |  |  |  |  |  |  |     |   00 
+        if (m != 0) { return i + Length(__builtin_ctzll(m) / 8); }
+    23d0:	|  |  |  |  |  |  \--|--|-----|-> f3 48 0f bc c0       	tzcnt  %rax,%rax
+    23d5:	|  |  |  |  |  |     |  |     |   c1 f8 03             	sar    $0x3,%eax
+    23d8:	|  |  |  |  |  |     |  |     |   48 98                	cltq
+    23da:	|  |  |  |  |  |     |  |     |   4a 8d 34 00          	lea    (%rax,%r8,1),%rsi
+    Length const used = z + d;
+    23de:	|  |  |  |  |  |     |  |     |   4c 8d 2c 1e          	lea    (%rsi,%rbx,1),%r13
+    if (d <= 19) { return R::Ok(Pair<Word, Length>{digits_value(p + z, d, n - z), used}); }
+    23e2:	|  |  |  |  |  |     |  |     |   48 83 fe 13          	cmp    $0x13,%rsi
+    23e6:	|  |  |  |  |  |     |  +-----|-- 76 bf                	jbe    23a7 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x1b7>
+    if (d > 20) { return R::Err(ParseError::Overflow); }
+    23e8:	|  |  |  |  |  |     |  |     \-> 48 83 fe 14          	cmp    $0x14,%rsi
+    23ec:	|  |  |  |  |  |     |  |     /-- 74 42                	je     2430 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x240>
+            : tag_(Tag::ERR)
+    23ee:	|  |  |  |  |  |     |  |  /--|-> c7 45 00 02 00 00 00 	movl   $0x2,0x0(%rbp)
+}
+    23f5:	|  |  |  |  |  |     |  |  |  |   48 89 e8             	mov    %rbp,%rax
+    23f8:	|  |  |  |  |  |     |  |  |  |   c7 45 08 03 00 00 00 	movl   $0x3,0x8(%rbp)
+    23ff:	|  |  |  |  |  |     |  |  |  |   5b                   	pop    %rbx
+    2400:	|  |  |  |  |  |     |  |  |  |   5d                   	pop    %rbp
+    2401:	|  |  |  |  |  |     |  |  |  |   41 5c                	pop    %r12
+    2403:	|  |  |  |  |  |     |  |  |  |   41 5d                	pop    %r13
+    2405:	|  |  |  |  |  |     |  |  |  |   c3                   	ret
+    2406:	|  |  |  |  |  |     |  |  |  |   66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    240d:	|  |  |  |  |  |     |  |  |  |   00 00 00 
+    Length const d = digit_run(p + z, n - z);
+    2410:	|  |  \--|--|--|-----|--|--|--|-> 49 8d 3c 0c          	lea    (%r12,%rcx,1),%rdi
+    2414:	|  |     |  \--|-----|--|--|--|-- e9 4f fe ff ff       	jmp    2268 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x78>
+    2419:	|  |     |     |     |  |  |  |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        i += 1;
+    2420:	|  |     |     \-----|--|--|--|-> 48 89 d6             	mov    %rdx,%rsi
+    2423:	|  |     |           +--|--|--|-- e9 75 ff ff ff       	jmp    239d <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x1ad>
+    2428:	|  |     |           |  |  |  |   0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    242f:	|  |     |           |  |  |  |   00 
+    Word v = digits_value(p + z, 19, n - z);
+    2430:	|  |     |           |  |  |  \-> 48 89 ca             	mov    %rcx,%rdx
+    2433:	|  |     |           |  |  |      be 13 00 00 00       	mov    $0x13,%esi
+    2438:	|  |     |           |  |  |      e8 e3 f8 ff ff       	call   1d20 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    if (__builtin_mul_overflow(v, Word(10), &v) ||
+    243d:	|  |     |           |  |  |      ba 0a 00 00 00       	mov    $0xa,%edx
+    2442:	|  |     |           |  |  |      48 f7 e2             	mul    %rdx
+    2445:	|  |     |           |  |  +----- 70 a7                	jo     23ee <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x1fe>
+        __builtin_add_overflow(v, Word(p[z + 19] - '0'), &v)) {
+    2447:	|  |     |           |  |  |      41 0f b6 54 1c 13    	movzbl 0x13(%r12,%rbx,1),%edx
+    244d:	|  |     |           |  |  |      83 ea 30             	sub    $0x30,%edx
+    2450:	|  |     |           |  |  |      48 63 d2             	movslq %edx,%rdx
+    2453:	|  |     |           |  |  |      48 01 d0             	add    %rdx,%rax
+    2456:	|  |     |           |  |  +----- 72 96                	jb     23ee <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x1fe>
+            : tag_(Tag::OK)
+    2458:	|  |     |           |  |  |      c7 45 00 01 00 00 00 	movl   $0x1,0x0(%rbp)
+    245f:	|  |     |           |  |  |      48 89 45 08          	mov    %rax,0x8(%rbp)
+    2463:	|  |     |           |  |  |      4c 89 6d 10          	mov    %r13,0x10(%rbp)
+    return parse_magnitude(s.ptr(), s.len());
+    2467:	\--|-----|-----------|--|--|----- e9 a6 fd ff ff       	jmp    2212 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x22>
+    if (d <= 19) { return R::Ok(Pair<Word, Length>{digits_value(p + z, d, n - z), used}); }
+    246c:	   |     \-----------|--|--|----> 49 83 f8 13          	cmp    $0x13,%r8
+    2470:	   |                 |  |  \----- 0f 87 78 ff ff ff    	ja     23ee <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x1fe>
+    Length const used = z + d;
+    2476:	   |                 |  |         4d 8d 2c 18          	lea    (%r8,%rbx,1),%r13
+    247a:	   |                 |  |         4c 89 c6             	mov    %r8,%rsi
+    247d:	   |                 |  \-------- e9 25 ff ff ff       	jmp    23a7 <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x1b7>
+    while (i < n && is_digit(p[i])) {
+    2482:	   \-----------------|----------> 4c 89 c6             	mov    %r8,%rsi
+    2485:	                     \----------- e9 13 ff ff ff       	jmp    239d <nel::parse_u64(nel::Slice<unsigned char const> const&)+0x1ad>
+    248a:	                                  66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000002490 <nel::parse_i64(nel::Slice<unsigned char const> const&)>:
+
+Result<Pair<long long int, Length>, ParseError> parse_i64(Slice<unsigned char const> const &s)
+{
+    2490:	                                              41 57                	push   %r15
+    2492:	                                              41 56                	push   %r14
+    2494:	                                              41 55                	push   %r13
+    2496:	                                              41 54                	push   %r12
+    2498:	                                              55                   	push   %rbp
+    2499:	                                              53                   	push   %rbx
+            return len_;
+    249a:	                                              48 8b 56 08          	mov    0x8(%rsi),%rdx
+    249e:	                                              48 89 fb             	mov    %rdi,%rbx
+            return content_;
+    24a1:	                                              4c 8b 26             	mov    (%rsi),%r12
+    typedef Result<Pair<long long int, Length>, ParseError> R;
+    unsigned char const *const p = s.ptr();
+    Length const n = s.len();
+    if (n == 0) { return R::Err(ParseError::Empty); }
+    24a4:	                                              48 85 d2             	test   %rdx,%rdx
+    24a7:	                                          /-- 75 1f                	jne    24c8 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x38>
+            : tag_(Tag::ERR)
+    24a9:	                                          |   c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+    24af:	                                          |   c7 47 08 01 00 00 00 	movl   $0x1,0x8(%rdi)
+    auto const v = m.unwrap();
+    Word const limit = neg ? (1ULL << 63) : (1ULL << 63) - 1;
+    if (v.first > limit) { return R::Err(ParseError::Overflow); }
+    long long int const r = neg ? (long long int)(0 - v.first) : (long long int)v.first;
+    return R::Ok(Pair<long long int, Length>{r, i + v.second});
+}
+    24b6:	/-----------------------------------------|-> 48 89 d8             	mov    %rbx,%rax
+    24b9:	|                                         |   5b                   	pop    %rbx
+    24ba:	|                                         |   5d                   	pop    %rbp
+    24bb:	|                                         |   41 5c                	pop    %r12
+    24bd:	|                                         |   41 5d                	pop    %r13
+    24bf:	|                                         |   41 5e                	pop    %r14
+    24c1:	|                                         |   41 5f                	pop    %r15
+    24c3:	|                                         |   c3                   	ret
+    24c4:	|                                         |   0f 1f 40 00          	nopl   0x0(%rax)
+    bool const neg = p[0] == '-';
+    24c8:	|                                         \-> 45 0f b6 2c 24       	movzbl (%r12),%r13d
+    Index const i = (neg || p[0] == '+') ? 1 : 0;
+    24cd:	|                                             41 8d 45 d5          	lea    -0x2b(%r13),%eax
+    24d1:	|                                             a8 fd                	test   $0xfd,%al
+    24d3:	|                                         /-- 75 2b                	jne    2500 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x70>
+    if (n == 0) { return R::Err(ParseError::Empty); }
+    24d5:	|                                         |   48 83 ea 01          	sub    $0x1,%rdx
+    24d9:	|  /--------------------------------------|-- 0f 85 21 02 00 00    	jne    2700 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x270>
+    24df:	|  |                                      |   c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+}
+    24e5:	|  |                                      |   48 89 d8             	mov    %rbx,%rax
+    24e8:	|  |                                      |   c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    24ef:	|  |                                      |   5b                   	pop    %rbx
+    24f0:	|  |                                      |   5d                   	pop    %rbp
+    24f1:	|  |                                      |   41 5c                	pop    %r12
+    24f3:	|  |                                      |   41 5d                	pop    %r13
+    24f5:	|  |                                      |   41 5e                	pop    %r14
+    24f7:	|  |                                      |   41 5f                	pop    %r15
+    24f9:	|  |                                      |   c3                   	ret
+    24fa:	|  |                                      |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    return (unsigned char)(c - '0') < 10;
+    2500:	|  |                                      \-> 41 8d 45 d0          	lea    -0x30(%r13),%eax
+    if (!is_digit(p[0])) { return R::Err(ParseError::InvalidDigit); }
+    2504:	|  |                                          3c 09                	cmp    $0x9,%al
+    2506:	|  |                                      /-- 76 20                	jbe    2528 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x98>
+    Length const used = z + d;
+    2508:	|  |  /-----------------------------------|-> b8 02 00 00 00       	mov    $0x2,%eax
+    250d:	|  |  |                          /--------|-> 89 43 08             	mov    %eax,0x8(%rbx)
+}
+    2510:	|  |  |                          |        |   48 89 d8             	mov    %rbx,%rax
+    2513:	|  |  |                          |        |   c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+    2519:	|  |  |                          |        |   5b                   	pop    %rbx
+    251a:	|  |  |                          |        |   5d                   	pop    %rbp
+    251b:	|  |  |                          |        |   41 5c                	pop    %r12
+    251d:	|  |  |                          |        |   41 5d                	pop    %r13
+    251f:	|  |  |                          |        |   41 5e                	pop    %r14
+    2521:	|  |  |                          |        |   41 5f                	pop    %r15
+    2523:	|  |  |                          |        |   c3                   	ret
+    2524:	|  |  |                          |        |   0f 1f 40 00          	nopl   0x0(%rax)
+    Index const i = (neg || p[0] == '+') ? 1 : 0;
+    2528:	|  |  |                          |        \-> 45 31 f6             	xor    %r14d,%r14d
+    Index z = 0;
+    252b:	|  |  |        /-----------------|----------> 31 ed                	xor    %ebp,%ebp
+    252d:	|  |  |        |                 |     /----- eb 0a                	jmp    2539 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0xa9>
+    252f:	|  |  |        |                 |     |      90                   	nop
+        z += 1;
+    2530:	|  |  |        |                 |  /--|----> 48 83 c5 01          	add    $0x1,%rbp
+    while (z < n && p[z] == '0') {
+    2534:	|  |  |        |                 |  |  |      48 39 d5             	cmp    %rdx,%rbp
+    2537:	|  |  |        |                 |  |  |  /-- 74 07                	je     2540 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0xb0>
+    2539:	|  |  |        |                 |  |  \--|-> 41 80 3c 2c 30       	cmpb   $0x30,(%r12,%rbp,1)
+    253e:	|  |  |        |                 |  \-----|-- 74 f0                	je     2530 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0xa0>
+    2540:	|  |  |        |                 |        \-> 49 8d 3c 2c          	lea    (%r12,%rbp,1),%rdi
+    Length const d = digit_run(p + z, n - z);
+    2544:	|  |  |        |                 |            48 29 ea             	sub    %rbp,%rdx
+    Index i = 0;
+    2547:	|  |  |        |                 |            31 f6                	xor    %esi,%esi
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    2549:	|  |  |        |                 |            49 ba 46 46 46 46 46 	movabs $0x4646464646464646,%r10
+    2550:	|  |  |        |                 |            46 46 46 
+    2553:	|  |  |        |                 |            49 b9 d0 cf cf cf cf 	movabs $0xcfcfcfcfcfcfcfd0,%r9
+    255a:	|  |  |        |                 |            cf cf cf 
+    255d:	|  |  |        |                 |            49 b8 80 80 80 80 80 	movabs $0x8080808080808080,%r8
+    2564:	|  |  |        |                 |            80 80 80 
+    while (i + 8 <= n) {
+    2567:	|  |  |        |                 |        /-- eb 1f                	jmp    2588 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0xf8>
+    2569:	|  |  |        |                 |        |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    __builtin_memcpy(&v, p, sizeof(v));
+    2570:	|  |  |        |                 |     /--|-> 4c 8b 5c 37 f8       	mov    -0x8(%rdi,%rsi,1),%r11
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    2575:	|  |  |        |                 |     |  |   4b 8d 04 13          	lea    (%r11,%r10,1),%rax
+    2579:	|  |  |        |                 |     |  |   4d 01 cb             	add    %r9,%r11
+    257c:	|  |  |        |                 |     |  |   4c 09 d8             	or     %r11,%rax
+        if (m != 0) { return i + Length(__builtin_ctzll(m) / 8); }
+    257f:	|  |  |        |                 |     |  |   4c 21 c0             	and    %r8,%rax
+    2582:	|  |  |        |                 |  /--|--|-- 0f 85 08 01 00 00    	jne    2690 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x200>
+    while (i + 8 <= n) {
+    2588:	|  |  |        |                 |  |  |  \-> 48 89 f1             	mov    %rsi,%rcx
+    258b:	|  |  |        |                 |  |  |      48 83 c6 08          	add    $0x8,%rsi
+    258f:	|  |  |        |                 |  |  |      48 39 f2             	cmp    %rsi,%rdx
+    2592:	|  |  |        |                 |  |  \----- 73 dc                	jae    2570 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0xe0>
+    while (i < n && is_digit(p[i])) {
+    2594:	|  |  |        |                 |  |         48 39 d1             	cmp    %rdx,%rcx
+    2597:	|  |  |     /--|-----------------|--|-------- 0f 83 eb 01 00 00    	jae    2788 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x2f8>
+    return (unsigned char)(c - '0') < 10;
+    259d:	|  |  |     |  |                 |  |         0f b6 04 0f          	movzbl (%rdi,%rcx,1),%eax
+    25a1:	|  |  |     |  |                 |  |         83 e8 30             	sub    $0x30,%eax
+    while (i < n && is_digit(p[i])) {
+    25a4:	|  |  |     |  |                 |  |         3c 09                	cmp    $0x9,%al
+    25a6:	|  |  |  /--|--|-----------------|--|-------- 0f 87 f3 01 00 00    	ja     279f <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x30f>
+        i += 1;
+    25ac:	|  |  |  |  |  |                 |  |         4c 8d 41 01          	lea    0x1(%rcx),%r8
+    while (i < n && is_digit(p[i])) {
+    25b0:	|  |  |  |  |  |                 |  |         49 39 d0             	cmp    %rdx,%r8
+    25b3:	|  |  |  |  |  |  /--------------|--|-------- 0f 83 c7 01 00 00    	jae    2780 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x2f0>
+    return (unsigned char)(c - '0') < 10;
+    25b9:	|  |  |  |  |  |  |              |  |         0f b6 44 0f 01       	movzbl 0x1(%rdi,%rcx,1),%eax
+    25be:	|  |  |  |  |  |  |              |  |         83 e8 30             	sub    $0x30,%eax
+    while (i < n && is_digit(p[i])) {
+    25c1:	|  |  |  |  |  |  |              |  |         3c 09                	cmp    $0x9,%al
+    25c3:	|  |  |  |  |  |  +--------------|--|-------- 0f 87 b7 01 00 00    	ja     2780 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x2f0>
+        i += 1;
+    25c9:	|  |  |  |  |  |  |              |  |         4c 8d 41 02          	lea    0x2(%rcx),%r8
+    while (i < n && is_digit(p[i])) {
+    25cd:	|  |  |  |  |  |  |              |  |         49 39 d0             	cmp    %rdx,%r8
+    25d0:	|  |  |  |  |  |  +--------------|--|-------- 0f 83 aa 01 00 00    	jae    2780 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x2f0>
+    return (unsigned char)(c - '0') < 10;
+    25d6:	|  |  |  |  |  |  |              |  |         0f b6 44 0f 02       	movzbl 0x2(%rdi,%rcx,1),%eax
+    25db:	|  |  |  |  |  |  |              |  |         83 e8 30             	sub    $0x30,%eax
+    while (i < n && is_digit(p[i])) {
+    25de:	|  |  |  |  |  |  |              |  |         3c 09                	cmp    $0x9,%al
+    25e0:	|  |  |  |  |  |  +--------------|--|-------- 0f 87 9a 01 00 00    	ja     2780 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x2f0>
+        i += 1;
+    25e6:	|  |  |  |  |  |  |              |  |         4c 8d 41 03          	lea    0x3(%rcx),%r8
+    while (i < n && is_digit(p[i])) {
+    25ea:	|  |  |  |  |  |  |              |  |         49 39 d0             	cmp    %rdx,%r8
+    25ed:	|  |  |  |  |  |  +--------------|--|-------- 0f 83 8d 01 00 00    	jae    2780 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x2f0>
+    return (unsigned char)(c - '0') < 10;
+    25f3:	|  |  |  |  |  |  |              |  |         0f b6 44 0f 03       	movzbl 0x3(%rdi,%rcx,1),%eax
+    25f8:	|  |  |  |  |  |  |              |  |         83 e8 30             	sub    $0x30,%eax
+    while (i < n && is_digit(p[i])) {
+    25fb:	|  |  |  |  |  |  |              |  |         3c 09                	cmp    $0x9,%al
+    25fd:	|  |  |  |  |  |  +--------------|--|-------- 0f 87 7d 01 00 00    	ja     2780 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x2f0>
+        i += 1;
+    2603:	|  |  |  |  |  |  |              |  |         4c 8d 41 04          	lea    0x4(%rcx),%r8
+    while (i < n && is_digit(p[i])) {
+    2607:	|  |  |  |  |  |  |              |  |         49 39 d0             	cmp    %rdx,%r8
+    260a:	|  |  |  |  |  |  +--------------|--|-------- 0f 83 70 01 00 00    	jae    2780 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x2f0>
+    return (unsigned char)(c - '0') < 10;
+    2610:	|  |  |  |  |  |  |              |  |         0f b6 44 0f 04       	movzbl 0x4(%rdi,%rcx,1),%eax
+    2615:	|  |  |  |  |  |  |              |  |         83 e8 30             	sub    $0x30,%eax
+    while (i < n && is_digit(p[i])) {
+    2618:	|  |  |  |  |  |  |              |  |         3c 09                	cmp    $0x9,%al
+    261a:	|  |  |  |  |  |  +--------------|--|-------- 0f 87 60 01 00 00    	ja     2780 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x2f0>
+        i += 1;
+    2620:	|  |  |  |  |  |  |              |  |         4c 8d 41 05          	lea    0x5(%rcx),%r8
+    while (i < n && is_digit(p[i])) {
+    2624:	|  |  |  |  |  |  |              |  |         49 39 d0             	cmp    %rdx,%r8
+    2627:	|  |  |  |  |  |  +--------------|--|-------- 0f 83 53 01 00 00    	jae    2780 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x2f0>
+    return (unsigned char)(c - '0') < 10;
+    262d:	|  |  |  |  |  |  |              |  |         0f b6 44 0f 05       	movzbl 0x5(%rdi,%rcx,1),%eax
+    2632:	|  |  |  |  |  |  |              |  |         83 e8 30             	sub    $0x30,%eax
+    while (i < n && is_digit(p[i])) {
+    2635:	|  |  |  |  |  |  |              |  |         3c 09                	cmp    $0x9,%al
+    2637:	|  |  |  |  |  |  +--------------|--|-------- 0f 87 43 01 00 00    	ja     2780 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x2f0>
+        i += 1;
+    263d:	|  |  |  |  |  |  |              |  |         4c 8d 41 06          	lea    0x6(%rcx),%r8
+    while (i < n && is_digit(p[i])) {
+    2641:	|  |  |  |  |  |  |              |  |         49 39 d0             	cmp    %rdx,%r8
+    2644:	|  |  |  |  |  |  +--------------|--|-------- 0f 83 36 01 00 00    	jae    2780 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x2f0>
+    return (unsigned char)(c - '0') < 10;
+    264a:	|  |  |  |  |  |  |              |  |         0f b6 44 0f 06       	movzbl 0x6(%rdi,%rcx,1),%eax
+    264f:	|  |  |  |  |  |  |              |  |         83 e8 30             	sub    $0x30,%eax
+    while (i < n && is_digit(p[i])) {
+    2652:	|  |  |  |  |  |  |              |  |         3c 09                	cmp    $0x9,%al
+    2654:	|  |  |  |  |  |  +--------------|--|-------- 0f 87 26 01 00 00    	ja     2780 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x2f0>
+        i += 1;
+    265a:	|  |  |  |  |  |  |              |  |         4c 8d 41 07          	lea    0x7(%rcx),%r8
+    while (i < n && is_digit(p[i])) {
+    265e:	|  |  |  |  |  |  |              |  |         49 39 d0             	cmp    %rdx,%r8
+    2661:	|  |  |  |  |  |  +--------------|--|-------- 0f 83 19 01 00 00    	jae    2780 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x2f0>
+    return (unsigned char)(c - '0') < 10;
+    2667:	|  |  |  |  |  |  |              |  |         0f b6 44 0f 07       	movzbl 0x7(%rdi,%rcx,1),%eax
+    266c:	|  |  |  |  |  |  |              |  |         83 e8 30             	sub    $0x30,%eax
+    while (i < n && is_digit(p[i])) {
+    266f:	|  |  |  |  |  |  |              |  |         3c 09                	cmp    $0x9,%al
+    2671:	|  |  |  |  |  |  +--------------|--|-------- 0f 87 09 01 00 00    	ja     2780 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x2f0>
+    Length const used = z + d;
+    2677:	|  |  |  |  |  |  |  /-----------|--|-------> 4c 8d 7c 35 00       	lea    0x0(%rbp,%rsi,1),%r15
+    if (d <= 19) { return R::Ok(Pair<Word, Length>{digits_value(p + z, d, n - z), used}); }
+    267c:	|  |  |  |  |  |  |  |           |  |         48 83 fe 13          	cmp    $0x13,%rsi
+    2680:	|  |  |  |  |  |  |  |  /--------|--|-------- 76 27                	jbe    26a9 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x219>
+    Length const used = z + d;
+    2682:	|  |  |  |  |  |  |  |  |  /-----|--|-------> b8 03 00 00 00       	mov    $0x3,%eax
+    2687:	|  |  |  |  |  |  |  |  |  |     \--|-------- e9 81 fe ff ff       	jmp    250d <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x7d>
+    268c:	|  |  |  |  |  |  |  |  |  |        |         0f 1f 40 00          	nopl   0x0(%rax)
+        if (m != 0) { return i + Length(__builtin_ctzll(m) / 8); }
+    2690:	|  |  |  |  |  |  |  |  |  |        \-------> f3 48 0f bc c0       	tzcnt  %rax,%rax
+    2695:	|  |  |  |  |  |  |  |  |  |                  c1 f8 03             	sar    $0x3,%eax
+    2698:	|  |  |  |  |  |  |  |  |  |                  48 98                	cltq
+    269a:	|  |  |  |  |  |  |  |  |  |                  48 8d 34 08          	lea    (%rax,%rcx,1),%rsi
+    Length const used = z + d;
+    269e:	|  |  |  |  |  |  |  |  |  |  /-------------> 4c 8d 7c 35 00       	lea    0x0(%rbp,%rsi,1),%r15
+    if (d <= 19) { return R::Ok(Pair<Word, Length>{digits_value(p + z, d, n - z), used}); }
+    26a3:	|  |  |  |  |  |  |  |  |  |  |               48 83 fe 13          	cmp    $0x13,%rsi
+    26a7:	|  |  |  |  |  |  |  |  |  |  |     /-------- 77 77                	ja     2720 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x290>
+    26a9:	|  |  |  |  |  |  |  |  >--|--|-----|-------> e8 72 f6 ff ff       	call   1d20 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    Word const limit = neg ? (1ULL << 63) : (1ULL << 63) - 1;
+    26ae:	|  |  |  |  |  |  |  |  |  |  |  /--|-------> 41 80 fd 2d          	cmp    $0x2d,%r13b
+    26b2:	|  |  |  |  |  |  |  |  |  |  |  |  |     /-- 74 1c                	je     26d0 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x240>
+    if (v.first > limit) { return R::Err(ParseError::Overflow); }
+    26b4:	|  |  |  |  |  |  |  |  |  |  |  |  |     |   48 85 c0             	test   %rax,%rax
+    26b7:	|  |  |  |  |  |  |  |  |  |  |  |  |  /--|-- 78 2a                	js     26e3 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x253>
+    return R::Ok(Pair<long long int, Length>{r, i + v.second});
+    26b9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 01 f7             	add    %r14,%r15
+            : tag_(Tag::OK)
+    26bc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |   c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+    26c2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 89 43 08          	mov    %rax,0x8(%rbx)
+    26c6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |   4c 89 7b 10          	mov    %r15,0x10(%rbx)
+        constexpr ~Result(void)
+    26ca:	+--|--|--|--|--|--|--|--|--|--|--|--|--|--|-- e9 e7 fd ff ff       	jmp    24b6 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x26>
+    26cf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |   90                   	nop
+    if (v.first > limit) { return R::Err(ParseError::Overflow); }
+    26d0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  \-> 48 ba 00 00 00 00 00 	movabs $0x8000000000000000,%rdx
+    26d7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |      00 00 80 
+    26da:	|  |  |  |  |  |  |  |  |  |  |  |  |  |      48 39 c2             	cmp    %rax,%rdx
+    26dd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  /-- 0f 83 7d 00 00 00    	jae    2760 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x2d0>
+            : tag_(Tag::ERR)
+    26e3:	|  |  |  |  |  |  |  |  |  |  |  |  |  \--|-> c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+}
+    26e9:	|  |  |  |  |  |  |  |  |  |  |  |  |     |   48 89 d8             	mov    %rbx,%rax
+    26ec:	|  |  |  |  |  |  |  |  |  |  |  |  |     |   c7 43 08 03 00 00 00 	movl   $0x3,0x8(%rbx)
+    26f3:	|  |  |  |  |  |  |  |  |  |  |  |  |     |   5b                   	pop    %rbx
+    26f4:	|  |  |  |  |  |  |  |  |  |  |  |  |     |   5d                   	pop    %rbp
+    26f5:	|  |  |  |  |  |  |  |  |  |  |  |  |     |   41 5c                	pop    %r12
+    26f7:	|  |  |  |  |  |  |  |  |  |  |  |  |     |   41 5d                	pop    %r13
+    26f9:	|  |  |  |  |  |  |  |  |  |  |  |  |     |   41 5e                	pop    %r14
+    26fb:	|  |  |  |  |  |  |  |  |  |  |  |  |     |   41 5f                	pop    %r15
+    26fd:	|  |  |  |  |  |  |  |  |  |  |  |  |     |   c3                   	ret
+    26fe:	|  |  |  |  |  |  |  |  |  |  |  |  |     |   66 90                	xchg   %ax,%ax
+    return (unsigned char)(c - '0') < 10;
+    2700:	|  \--|--|--|--|--|--|--|--|--|--|--|-----|-> 41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+    2706:	|     |  |  |  |  |  |  |  |  |  |  |     |   83 e8 30             	sub    $0x30,%eax
+    if (!is_digit(p[0])) { return R::Err(ParseError::InvalidDigit); }
+    2709:	|     |  |  |  |  |  |  |  |  |  |  |     |   3c 09                	cmp    $0x9,%al
+    270b:	|     \--|--|--|--|--|--|--|--|--|--|-----|-- 0f 87 f7 fd ff ff    	ja     2508 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x78>
+    auto m = parse_magnitude(p + i, n - i);
+    2711:	|        |  |  |  |  |  |  |  |  |  |     |   49 83 c4 01          	add    $0x1,%r12
+    Index const i = (neg || p[0] == '+') ? 1 : 0;
+    2715:	|        |  |  |  |  |  |  |  |  |  |     |   41 be 01 00 00 00    	mov    $0x1,%r14d
+    271b:	|        |  |  \--|--|--|--|--|--|--|-----|-- e9 0b fe ff ff       	jmp    252b <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x9b>
+    if (d > 20) { return R::Err(ParseError::Overflow); }
+    2720:	|        |  |     |  |  |  |  |  |  \-----|-> 48 83 fe 14          	cmp    $0x14,%rsi
+    2724:	|        |  |     |  |  |  +--|--|--------|-- 0f 85 58 ff ff ff    	jne    2682 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x1f2>
+    Word v = digits_value(p + z, 19, n - z);
+    272a:	|        |  |     |  |  |  |  |  |        |   be 13 00 00 00       	mov    $0x13,%esi
+    272f:	|        |  |     |  |  |  |  |  |        |   e8 ec f5 ff ff       	call   1d20 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    if (__builtin_mul_overflow(v, Word(10), &v) ||
+    2734:	|        |  |     |  |  |  |  |  |        |   ba 0a 00 00 00       	mov    $0xa,%edx
+    2739:	|        |  |     |  |  |  |  |  |        |   48 f7 e2             	mul    %rdx
+    273c:	|        |  |     |  |  |  +--|--|--------|-- 0f 80 40 ff ff ff    	jo     2682 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x1f2>
+        __builtin_add_overflow(v, Word(p[z + 19] - '0'), &v)) {
+    2742:	|        |  |     |  |  |  |  |  |        |   41 0f b6 54 2c 13    	movzbl 0x13(%r12,%rbp,1),%edx
+    2748:	|        |  |     |  |  |  |  |  |        |   83 ea 30             	sub    $0x30,%edx
+    274b:	|        |  |     |  |  |  |  |  |        |   48 63 d2             	movslq %edx,%rdx
+    274e:	|        |  |     |  |  |  |  |  |        |   48 01 d0             	add    %rdx,%rax
+    2751:	|        |  |     |  |  |  |  |  \--------|-- 0f 83 57 ff ff ff    	jae    26ae <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x21e>
+    2757:	|        |  |     |  |  |  +--|-----------|-- e9 26 ff ff ff       	jmp    2682 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x1f2>
+    275c:	|        |  |     |  |  |  |  |           |   0f 1f 40 00          	nopl   0x0(%rax)
+    long long int const r = neg ? (long long int)(0 - v.first) : (long long int)v.first;
+    2760:	|        |  |     |  |  |  |  |           \-> 48 f7 d8             	neg    %rax
+    return R::Ok(Pair<long long int, Length>{r, i + v.second});
+    2763:	|        |  |     |  |  |  |  |               4d 01 f7             	add    %r14,%r15
+            : tag_(Tag::OK)
+    2766:	|        |  |     |  |  |  |  |               c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+    long long int const r = neg ? (long long int)(0 - v.first) : (long long int)v.first;
+    276c:	|        |  |     |  |  |  |  |               48 89 43 08          	mov    %rax,0x8(%rbx)
+    return R::Ok(Pair<long long int, Length>{r, i + v.second});
+    2770:	|        |  |     |  |  |  |  |               4c 89 7b 10          	mov    %r15,0x10(%rbx)
+        }
+    2774:	\--------|--|-----|--|--|--|--|-------------- e9 3d fd ff ff       	jmp    24b6 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x26>
+    2779:	         |  |     |  |  |  |  |               0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        i += 1;
+    2780:	         |  |     \--|--|--|--|-------------> 4c 89 c6             	mov    %r8,%rsi
+    2783:	         |  |        |  |  |  \-------------- e9 16 ff ff ff       	jmp    269e <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x20e>
+    if (d <= 19) { return R::Ok(Pair<Word, Length>{digits_value(p + z, d, n - z), used}); }
+    2788:	         |  \--------|--|--|----------------> 48 83 f9 13          	cmp    $0x13,%rcx
+    278c:	         |           |  |  \----------------- 0f 87 f0 fe ff ff    	ja     2682 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x1f2>
+    Length const used = z + d;
+    2792:	         |           |  |                     4c 8d 7c 0d 00       	lea    0x0(%rbp,%rcx,1),%r15
+    2797:	         |           |  |                     48 89 ce             	mov    %rcx,%rsi
+    279a:	         |           |  \-------------------- e9 0a ff ff ff       	jmp    26a9 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x219>
+    while (i < n && is_digit(p[i])) {
+    279f:	         \-----------|----------------------> 48 89 ce             	mov    %rcx,%rsi
+    27a2:	                     \----------------------- e9 d0 fe ff ff       	jmp    2677 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x1e7>
+    27a7:	                                              66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    27ae:	                                              00 00 
+
+00000000000027b0 <nel::parse_f64(nel::Slice<unsigned char const> const&)>:
+
+Result<Pair<double, Length>, ParseError> parse_f64(Slice<unsigned char const> const &s)
+{
+    27b0:	                                                                                                                                  41 57                	push   %r15
+    27b2:	                                                                                                                                  41 56                	push   %r14
+    27b4:	                                                                                                                                  49 89 fe             	mov    %rdi,%r14
+    27b7:	                                                                                                                                  41 55                	push   %r13
+    27b9:	                                                                                                                                  41 54                	push   %r12
+    27bb:	                                                                                                                                  55                   	push   %rbp
+    27bc:	                                                                                                                                  53                   	push   %rbx
+    27bd:	                                                                                                                                  48 83 ec 68          	sub    $0x68,%rsp
+            return len_;
+    27c1:	                                                                                                                                  4c 8b 46 08          	mov    0x8(%rsi),%r8
+            return content_;
+    27c5:	                                                                                                                                  48 8b 06             	mov    (%rsi),%rax
+    typedef Result<Pair<double, Length>, ParseError> R;
+    unsigned char const *const p = s.ptr();
+    Length const n = s.len();
+    if (n == 0) { return R::Err(ParseError::Empty); }
+    27c8:	                                                                                                                                  4d 85 c0             	test   %r8,%r8
+    27cb:	                                                                                                                              /-- 75 23                	jne    27f0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x40>
+            : tag_(Tag::ERR)
+    27cd:	                                                                                                                              |   c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+    27d3:	                                                                                                                              |   c7 47 08 01 00 00 00 	movl   $0x1,0x8(%rdi)
+    if (truncated && !(b == compute_float(q, w + 1))) {
+        double const d = slow_path(ds, e - (long long int)(frac_e - frac_b));
+        return R::Ok(Pair<double, Length>{neg ? -d : d, used});
+    }
+    return R::Ok(Pair<double, Length>{to_double(b, neg), used});
+}
+    27da:	   /--------------------------------------------------------------------------------------------------------------------------|-> 48 83 c4 68          	add    $0x68,%rsp
+    27de:	   |                                                                                                                          |   4c 89 f0             	mov    %r14,%rax
+    27e1:	   |                                                                                                                          |   5b                   	pop    %rbx
+    27e2:	   |                                                                                                                          |   5d                   	pop    %rbp
+    27e3:	   |                                                                                                                          |   41 5c                	pop    %r12
+    27e5:	   |                                                                                                                          |   41 5d                	pop    %r13
+    27e7:	   |                                                                                                                          |   41 5e                	pop    %r14
+    27e9:	   |                                                                                                                          |   41 5f                	pop    %r15
+    27eb:	   |                                                                                                                          |   c3                   	ret
+    27ec:	   |                                                                                                                          |   0f 1f 40 00          	nopl   0x0(%rax)
+    bool const neg = p[0] == '-';
+    27f0:	   |                                                                                                                          \-> 0f b6 38             	movzbl (%rax),%edi
+    if (neg || p[0] == '+') { i = 1; }
+    27f3:	   |                                                                                                                              8d 57 d5             	lea    -0x2b(%rdi),%edx
+    bool const neg = p[0] == '-';
+    27f6:	   |                                                                                                                              40 88 7c 24 3e       	mov    %dil,0x3e(%rsp)
+    if (neg || p[0] == '+') { i = 1; }
+    27fb:	   |                                                                                                                              81 e2 fd 00 00 00    	and    $0xfd,%edx
+    2801:	   |                                                                                                        /-------------------- 0f 85 19 02 00 00    	jne    2a20 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x270>
+    Index const int_e = int_b + digit_run(p + int_b, n - int_b);
+    2807:	   |                                                                                                        |                     4c 8d 78 01          	lea    0x1(%rax),%r15
+    280b:	   |                                                                                                        |                     bd 01 00 00 00       	mov    $0x1,%ebp
+    2810:	   |                                                                                                        |                     31 ff                	xor    %edi,%edi
+    if (i < n && !is_digit(p[i]) && p[i] != '.') {
+    2812:	   |                                                                                                        |                     49 83 f8 01          	cmp    $0x1,%r8
+    2816:	   |                                                                             /--------------------------|-------------------- 0f 85 ec 05 00 00    	jne    2e08 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x658>
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    281c:	   |                                                                             |                          |  /----------------> 49 ba 46 46 46 46 46 	movabs $0x4646464646464646,%r10
+    2823:	   |                                                                             |                          |  |                  46 46 46 
+    Index i = 0;
+    2826:	   |                                                                             |                          |  |                  31 db                	xor    %ebx,%ebx
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    2828:	   |                                                                             |                          |  |                  49 b9 d0 cf cf cf cf 	movabs $0xcfcfcfcfcfcfcfd0,%r9
+    282f:	   |                                                                             |                          |  |                  cf cf cf 
+    2832:	   |                                                                             |                          |  |                  48 b9 80 80 80 80 80 	movabs $0x8080808080808080,%rcx
+    2839:	   |                                                                             |                          |  |                  80 80 80 
+    while (i + 8 <= n) {
+    283c:	   |                                                                             |                          |  |              /-- eb 1a                	jmp    2858 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xa8>
+    283e:	   |                                                                             |                          |  |              |   66 90                	xchg   %ax,%ax
+    __builtin_memcpy(&v, p, sizeof(v));
+    2840:	   |                                                                             |                          |  |           /--|-> 4d 8b 5c 1f f8       	mov    -0x8(%r15,%rbx,1),%r11
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    2845:	   |                                                                             |                          |  |           |  |   4b 8d 14 13          	lea    (%r11,%r10,1),%rdx
+    2849:	   |                                                                             |                          |  |           |  |   4d 01 cb             	add    %r9,%r11
+    284c:	   |                                                                             |                          |  |           |  |   4c 09 da             	or     %r11,%rdx
+        if (m != 0) { return i + Length(__builtin_ctzll(m) / 8); }
+    284f:	   |                                                                             |                          |  |           |  |   48 21 ca             	and    %rcx,%rdx
+    2852:	   |                                                                             |                       /--|--|-----------|--|-- 0f 85 b0 02 00 00    	jne    2b08 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x358>
+    while (i + 8 <= n) {
+    2858:	   |                                                                             |                       |  |  |           |  \-> 48 89 de             	mov    %rbx,%rsi
+    285b:	   |                                                                             |                       |  |  |           |      48 83 c3 08          	add    $0x8,%rbx
+    285f:	   |                                                                             |                       |  |  |           |      48 39 df             	cmp    %rbx,%rdi
+    2862:	   |                                                                             |                       |  |  |           \----- 73 dc                	jae    2840 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x90>
+    while (i < n && is_digit(p[i])) {
+    2864:	   |                                                                             |                       |  |  |                  48 39 fe             	cmp    %rdi,%rsi
+    2867:	   |  /--------------------------------------------------------------------------|-----------------------|--|--|----------------- 0f 83 ef 0a 00 00    	jae    335c <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbac>
+    return (unsigned char)(c - '0') < 10;
+    286d:	   |  |                                                                          |                       |  |  |                  41 0f b6 0c 37       	movzbl (%r15,%rsi,1),%ecx
+    2872:	   |  |                                                                          |                       |  |  |                  8d 51 d0             	lea    -0x30(%rcx),%edx
+    while (i < n && is_digit(p[i])) {
+    2875:	   |  |                                                                          |                       |  |  |                  80 fa 09             	cmp    $0x9,%dl
+    2878:	   |  |                                            /-----------------------------|-----------------------|--|--|----------------- 0f 87 d0 06 00 00    	ja     2f4e <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x79e>
+        i += 1;
+    287e:	   |  |                                            |                             |                       |  |  |                  4c 8d 4e 01          	lea    0x1(%rsi),%r9
+    while (i < n && is_digit(p[i])) {
+    2882:	   |  |                                            |                             |                       |  |  |                  49 39 f9             	cmp    %rdi,%r9
+    2885:	/--|--|--------------------------------------------|-----------------------------|-----------------------|--|--|----------------- 0f 83 51 0b 00 00    	jae    33dc <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xc2c>
+    return (unsigned char)(c - '0') < 10;
+    288b:	|  |  |                                            |                             |                       |  |  |                  41 0f b6 4c 37 01    	movzbl 0x1(%r15,%rsi,1),%ecx
+    2891:	|  |  |                                            |                             |                       |  |  |                  8d 51 d0             	lea    -0x30(%rcx),%edx
+    while (i < n && is_digit(p[i])) {
+    2894:	|  |  |                                            |                             |                       |  |  |                  80 fa 09             	cmp    $0x9,%dl
+    2897:	|  |  |                                            |                             |  /--------------------|--|--|----------------- 0f 87 43 04 00 00    	ja     2ce0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x530>
+        i += 1;
+    289d:	|  |  |                                            |                             |  |                    |  |  |                  4c 8d 4e 02          	lea    0x2(%rsi),%r9
+    while (i < n && is_digit(p[i])) {
+    28a1:	|  |  |                                            |                             |  |                    |  |  |                  49 39 f9             	cmp    %rdi,%r9
+    28a4:	|  |  |                                      /-----|-----------------------------|--|--------------------|--|--|----------------- 0f 83 d6 06 00 00    	jae    2f80 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x7d0>
+    return (unsigned char)(c - '0') < 10;
+    28aa:	|  |  |                                      |     |                             |  |                    |  |  |                  41 0f b6 4c 37 02    	movzbl 0x2(%r15,%rsi,1),%ecx
+    28b0:	|  |  |                                      |     |                             |  |                    |  |  |                  8d 51 d0             	lea    -0x30(%rcx),%edx
+    while (i < n && is_digit(p[i])) {
+    28b3:	|  |  |                                      |     |                             |  |                    |  |  |                  80 fa 09             	cmp    $0x9,%dl
+    28b6:	|  |  |                                      |     |                             |  +--------------------|--|--|----------------- 0f 87 24 04 00 00    	ja     2ce0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x530>
+        i += 1;
+    28bc:	|  |  |                                      |     |                             |  |                    |  |  |                  4c 8d 4e 03          	lea    0x3(%rsi),%r9
+    while (i < n && is_digit(p[i])) {
+    28c0:	|  |  |                                      |     |                             |  |                    |  |  |                  49 39 f9             	cmp    %rdi,%r9
+    28c3:	|  |  |                                      +-----|-----------------------------|--|--------------------|--|--|----------------- 0f 83 b7 06 00 00    	jae    2f80 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x7d0>
+    return (unsigned char)(c - '0') < 10;
+    28c9:	|  |  |                                      |     |                             |  |                    |  |  |                  41 0f b6 4c 37 03    	movzbl 0x3(%r15,%rsi,1),%ecx
+    28cf:	|  |  |                                      |     |                             |  |                    |  |  |                  8d 51 d0             	lea    -0x30(%rcx),%edx
+    while (i < n && is_digit(p[i])) {
+    28d2:	|  |  |                                      |     |                             |  |                    |  |  |                  80 fa 09             	cmp    $0x9,%dl
+    28d5:	|  |  |                                      |     |                             |  +--------------------|--|--|----------------- 0f 87 05 04 00 00    	ja     2ce0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x530>
+        i += 1;
+    28db:	|  |  |                                      |     |                             |  |                    |  |  |                  4c 8d 4e 04          	lea    0x4(%rsi),%r9
+    while (i < n && is_digit(p[i])) {
+    28df:	|  |  |                                      |     |                             |  |                    |  |  |                  49 39 f9             	cmp    %rdi,%r9
+    28e2:	|  |  |                                      +-----|-----------------------------|--|--------------------|--|--|----------------- 0f 83 98 06 00 00    	jae    2f80 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x7d0>
+    return (unsigned char)(c - '0') < 10;
+    28e8:	|  |  |                                      |     |                             |  |                    |  |  |                  41 0f b6 4c 37 04    	movzbl 0x4(%r15,%rsi,1),%ecx
+    28ee:	|  |  |                                      |     |                             |  |                    |  |  |                  8d 51 d0             	lea    -0x30(%rcx),%edx
+    while (i < n && is_digit(p[i])) {
+    28f1:	|  |  |                                      |     |                             |  |                    |  |  |                  80 fa 09             	cmp    $0x9,%dl
+    28f4:	|  |  |                                      |     |                             |  +--------------------|--|--|----------------- 0f 87 e6 03 00 00    	ja     2ce0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x530>
+        i += 1;
+    28fa:	|  |  |                                      |     |                             |  |                    |  |  |                  4c 8d 4e 05          	lea    0x5(%rsi),%r9
+    while (i < n && is_digit(p[i])) {
+    28fe:	|  |  |                                      |     |                             |  |                    |  |  |                  49 39 f9             	cmp    %rdi,%r9
+    2901:	|  |  |                                      +-----|-----------------------------|--|--------------------|--|--|----------------- 0f 83 79 06 00 00    	jae    2f80 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x7d0>
+    return (unsigned char)(c - '0') < 10;
+    2907:	|  |  |                                      |     |                             |  |                    |  |  |                  41 0f b6 4c 37 05    	movzbl 0x5(%r15,%rsi,1),%ecx
+    290d:	|  |  |                                      |     |                             |  |                    |  |  |                  8d 51 d0             	lea    -0x30(%rcx),%edx
+    while (i < n && is_digit(p[i])) {
+    2910:	|  |  |                                      |     |                             |  |                    |  |  |                  80 fa 09             	cmp    $0x9,%dl
+    2913:	|  |  |                                      |     |                             |  +--------------------|--|--|----------------- 0f 87 c7 03 00 00    	ja     2ce0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x530>
+        i += 1;
+    2919:	|  |  |                                      |     |                             |  |                    |  |  |                  4c 8d 4e 06          	lea    0x6(%rsi),%r9
+    while (i < n && is_digit(p[i])) {
+    291d:	|  |  |                                      |     |                             |  |                    |  |  |                  49 39 f9             	cmp    %rdi,%r9
+    2920:	|  |  |                                      +-----|-----------------------------|--|--------------------|--|--|----------------- 0f 83 5a 06 00 00    	jae    2f80 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x7d0>
+    return (unsigned char)(c - '0') < 10;
+    2926:	|  |  |                                      |     |                             |  |                    |  |  |                  41 0f b6 4c 37 06    	movzbl 0x6(%r15,%rsi,1),%ecx
+    292c:	|  |  |                                      |     |                             |  |                    |  |  |                  8d 51 d0             	lea    -0x30(%rcx),%edx
+    while (i < n && is_digit(p[i])) {
+    292f:	|  |  |                                      |     |                             |  |                    |  |  |                  80 fa 09             	cmp    $0x9,%dl
+    2932:	|  |  |                                      |     |                             |  +--------------------|--|--|----------------- 0f 87 a8 03 00 00    	ja     2ce0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x530>
+        i += 1;
+    2938:	|  |  |                                      |     |                             |  |                    |  |  |                  4c 8d 4e 07          	lea    0x7(%rsi),%r9
+    while (i < n && is_digit(p[i])) {
+    293c:	|  |  |                                      |     |                             |  |                    |  |  |                  49 39 f9             	cmp    %rdi,%r9
+    293f:	|  |  |                                      +-----|-----------------------------|--|--------------------|--|--|----------------- 0f 83 3b 06 00 00    	jae    2f80 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x7d0>
+    return (unsigned char)(c - '0') < 10;
+    2945:	|  |  |                                      |     |                             |  |                    |  |  |                  41 0f b6 54 37 07    	movzbl 0x7(%r15,%rsi,1),%edx
+    294b:	|  |  |                                      |     |                             |  |                    |  |  |                  83 ea 30             	sub    $0x30,%edx
+    while (i < n && is_digit(p[i])) {
+    294e:	|  |  |                                      |     |                             |  |                    |  |  |                  80 fa 09             	cmp    $0x9,%dl
+    2951:	|  |  |                                      |     |                             |  +--------------------|--|--|----------------- 0f 87 89 03 00 00    	ja     2ce0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x530>
+    Index const int_e = int_b + digit_run(p + int_b, n - int_b);
+    2957:	|  |  |                                      |     |                             |  |                    |  |  |                  48 8d 4c 1d 00       	lea    0x0(%rbp,%rbx,1),%rcx
+    if (int_e < n && p[int_e] == '.') {
+    295c:	|  |  |                                      |     |                             |  |                    |  |  |                  4c 39 c1             	cmp    %r8,%rcx
+    295f:	|  |  |                                      |     |           /-----------------|--|--------------------|--|--|----------------- 0f 83 95 03 00 00    	jae    2cfa <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x54a>
+    2965:	|  |  |                                      |     |           |                 |  |                    |  |  |                  0f 1f 00             	nopl   (%rax)
+    2968:	|  |  |  /-----------------------------------|-----|-----------|-----------------|--|--------------------|--|--|----------------> 4c 8d 14 08          	lea    (%rax,%rcx,1),%r10
+    296c:	|  |  |  |                                   |     |           |                 |  |                    |  |  |                  41 0f b6 12          	movzbl (%r10),%edx
+    2970:	|  |  |  |                                   |     |           |                 |  |                    |  |  |                  80 fa 2e             	cmp    $0x2e,%dl
+    2973:	|  |  |  |                                   |     |           |                 |  |                    |  |  |  /-------------- 0f 84 df 01 00 00    	je     2b58 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x3a8>
+    if (int_e == int_b && frac_e == frac_b) { return R::Err(ParseError::InvalidDigit); }
+    2979:	|  |  |  |                                   |     |           |                 |  |                    |  |  |  |               48 39 cd             	cmp    %rcx,%rbp
+    297c:	|  |  |  |     /-----------------------------|-----|-----------|-----------------|--|--------------------|--|--|--|-------------- 0f 84 6e 01 00 00    	je     2af0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x340>
+    2982:	|  |  |  |     |                             |     |           |                 |  |                    |  |  |  |               48 c7 04 24 00 00 00 	movq   $0x0,(%rsp)
+    2989:	|  |  |  |     |                             |     |           |                 |  |                    |  |  |  |               00 
+    298a:	|  |  |  |     |                             |     |           |                 |  |                    |  |  |  |               48 89 ce             	mov    %rcx,%rsi
+    298d:	|  |  |  |     |                             |     |           |                 |  |                    |  |  |  |               49 89 cb             	mov    %rcx,%r11
+    2990:	|  |  |  |     |                             |     |           |                 |  |                    |  |  |  |               45 31 e4             	xor    %r12d,%r12d
+    if (i < n && (p[i] | 0x20) == 'e') {
+    2993:	|  |  |  |     |                             |     |           |                 |  |                 /--|--|--|--|-------------> 83 ca 20             	or     $0x20,%edx
+    2996:	|  |  |  |     |                             |     |           |                 |  |                 |  |  |  |  |               49 89 f5             	mov    %rsi,%r13
+    long long int e = 0;
+    2999:	|  |  |  |     |                             |     |           |                 |  |                 |  |  |  |  |               45 31 c9             	xor    %r9d,%r9d
+    if (i < n && (p[i] | 0x20) == 'e') {
+    299c:	|  |  |  |     |                             |     |           |                 |  |                 |  |  |  |  |               80 fa 65             	cmp    $0x65,%dl
+    299f:	|  |  |  |     |                             |     |        /--|-----------------|--|-----------------|--|--|--|--|-------------- 0f 84 61 06 00 00    	je     3006 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x856>
+    long long int q = e - (long long int)(frac_e - frac_b);
+    29a5:	|  |  |  |  /--|-----------------------------|-----|--------|--|-----------------|--|-----------------|--|--|--|--|-------------> 48 8b 3c 24          	mov    (%rsp),%rdi
+    29a9:	|  |  |  |  |  |                             |     |        |  |                 |  |                 |  |  |  |  |               49 29 f9             	sub    %rdi,%r9
+    29ac:	|  |  |  |  |  |                             |     |        |  |                 |  |                 |  |  |  |  |               4c 89 0c 24          	mov    %r9,(%rsp)
+    while (a < int_e && p[a] == '0') {
+    29b0:	|  |  |  |  |  |                             |     |        |  |                 |  |                 |  |  |  |  |               48 39 cd             	cmp    %rcx,%rbp
+    29b3:	|  |  |  |  |  |                             |     |        |  |                 |  |                 |  |  |  |  |  /----------- 72 14                	jb     29c9 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x219>
+    29b5:	|  |  |  |  |  |                             |     |        |  |                 |  |                 |  |  |  |  |  |  /-------- eb 22                	jmp    29d9 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x229>
+    29b7:	|  |  |  |  |  |                             |     |        |  |                 |  |                 |  |  |  |  |  |  |         66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    29be:	|  |  |  |  |  |                             |     |        |  |                 |  |                 |  |  |  |  |  |  |         00 00 
+        a += 1;
+    29c0:	|  |  |  |  |  |                             |     |        |  |                 |  |                 |  |  |  |  |  |  |  /----> 48 83 c5 01          	add    $0x1,%rbp
+    while (a < int_e && p[a] == '0') {
+    29c4:	|  |  |  |  |  |                             |     |        |  |                 |  |                 |  |  |  |  |  |  |  |      48 39 cd             	cmp    %rcx,%rbp
+    29c7:	|  |  |  |  |  |                             |     |        |  |                 |  |                 |  |  |  |  |  |  |  |  /-- 73 06                	jae    29cf <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x21f>
+    29c9:	|  |  |  |  |  |                             |     |        |  |                 |  |                 |  |  |  |  |  >--|--|--|-> 80 3c 28 30          	cmpb   $0x30,(%rax,%rbp,1)
+    29cd:	|  |  |  |  |  |                             |     |        |  |                 |  |                 |  |  |  |  |  |  |  \--|-- 74 f1                	je     29c0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x210>
+    Digits const ds = {p + a, int_e - a, p + f, frac_e - f};
+    29cf:	|  |  |  |  |  |                             |     |        |  |                 |  |                 |  |  |  |  |  |  |     \-> 48 89 cb             	mov    %rcx,%rbx
+    while (a < int_e && p[a] == '0') {
+    29d2:	|  |  |  |  |  |                             |     |        |  |                 |  |                 |  |  |  |  |  |  |         4c 8d 3c 28          	lea    (%rax,%rbp,1),%r15
+    Digits const ds = {p + a, int_e - a, p + f, frac_e - f};
+    29d6:	|  |  |  |  |  |                             |     |        |  |                 |  |                 |  |  |  |  |  |  |         48 29 eb             	sub    %rbp,%rbx
+    if (a == int_e) {
+    29d9:	|  |  |  |  |  |                             |     |        |  |                 |  |                 |  |  |  |  |  |  \-------> 48 39 e9             	cmp    %rbp,%rcx
+    29dc:	|  |  |  |  |  |                             |     |        |  |                 |  |        /--------|--|--|--|--|--|----------- 0f 84 ee 03 00 00    	je     2dd0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x620>
+    Length const n_sig = ds.an + ds.bn;
+    29e2:	|  |  |  |  |  |                             |     |        |  |                 |  |     /--|--------|--|--|--|--|--|----------> 4e 8d 0c 23          	lea    (%rbx,%r12,1),%r9
+    Digits const ds = {p + a, int_e - a, p + f, frac_e - f};
+    29e6:	|  |  |  |  |  |        /--------------------|-----|--------|--|-----------------|--|-----|--|--------|--|--|--|--|--|----------> 4c 89 7c 24 40       	mov    %r15,0x40(%rsp)
+    29eb:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |        |  |  |  |  |  |            48 89 5c 24 48       	mov    %rbx,0x48(%rsp)
+    29f0:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |        |  |  |  |  |  |            4c 89 54 24 50       	mov    %r10,0x50(%rsp)
+    29f5:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |        |  |  |  |  |  |            4c 89 64 24 58       	mov    %r12,0x58(%rsp)
+    if (n_sig == 0) { return R::Ok(Pair<double, Length>{neg ? -0.0 : 0.0, used}); }
+    29fa:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |        |  |  |  |  |  |            4d 85 c9             	test   %r9,%r9
+    29fd:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |     /--|--|--|--|--|--|----------- 0f 85 05 03 00 00    	jne    2d08 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x558>
+    2a03:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |     |  |  |  |  |  |  |            48 8b 05 56 41 00 00 	mov    0x4156(%rip),%rax        # 6b60 <nel::(anonymous namespace)::pow10_u64+0xc0>
+            : tag_(Tag::OK)
+    2a0a:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |     |  |  |  |  |  |  |            41 c7 06 01 00 00 00 	movl   $0x1,(%r14)
+    2a11:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |     |  |  |  |  |  |  |            4d 89 6e 10          	mov    %r13,0x10(%r14)
+    2a15:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |     |  |  |  |  |  |  |            49 89 46 08          	mov    %rax,0x8(%r14)
+    2a19:	|  +--|--|--|--|--------|--------------------|-----|--------|--|-----------------|--|-----|--|-----|--|--|--|--|--|--|----------- e9 bc fd ff ff       	jmp    27da <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x2a>
+    2a1e:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |     |  |  |  |  |  |  |            66 90                	xchg   %ax,%ax
+    2a20:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |     |  |  |  \--|--|--|----------> 89 fa                	mov    %edi,%edx
+    2a22:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |     |  |  |     |  |  |            49 89 c7             	mov    %rax,%r15
+    2a25:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |     |  |  |     |  |  |            4c 89 c7             	mov    %r8,%rdi
+    Index i = 0;
+    2a28:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |     |  |  |     |  |  |            31 ed                	xor    %ebp,%ebp
+    return (unsigned char)(c - '0') < 10;
+    2a2a:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |  /--|--|--|-----|--|--|----------> 8d 4a d0             	lea    -0x30(%rdx),%ecx
+    if (i < n && !is_digit(p[i]) && p[i] != '.') {
+    2a2d:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |  |  |  |  |     |  |  |            80 f9 09             	cmp    $0x9,%cl
+    2a30:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |  |  |  |  |     +--|--|----------- 0f 86 e6 fd ff ff    	jbe    281c <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x6c>
+    2a36:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |  |  |  |  |     |  |  |            80 fa 2e             	cmp    $0x2e,%dl
+    2a39:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |  |  |  |  |     \--|--|----------- 0f 84 dd fd ff ff    	je     281c <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x6c>
+    for (; word[i] != '\0'; ++i) {
+    2a3f:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |  |  |  |  |        |  |            b9 69 00 00 00       	mov    $0x69,%ecx
+    Index i = 0;
+    2a44:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |  |  |  |  |        |  |            31 d2                	xor    %edx,%edx
+    2a46:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |  |  |  |  |        |  |            48 8d 34 28          	lea    (%rax,%rbp,1),%rsi
+    for (; word[i] != '\0'; ++i) {
+    2a4a:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |  |  |  |  |        |  |            4c 8d 05 a6 16 00 00 	lea    0x16a6(%rip),%r8        # 40f7 <_IO_stdin_used+0xf7>
+    2a51:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |  |  |  |  |        |  |     /----- eb 1b                	jmp    2a6e <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x2be>
+    2a53:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |  |  |  |  |        |  |     |      0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    2a58:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |  |  |  |  |        |  |  /--|----> 48 83 c2 01          	add    $0x1,%rdx
+    2a5c:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |  |  |  |  |        |  |  |  |      41 0f b6 0c 10       	movzbl (%r8,%rdx,1),%ecx
+    2a61:	|  |  |  |  |  |        |                    |     |        |  |                 |  |     |  |  |  |  |  |        |  |  |  |      84 c9                	test   %cl,%cl
+    2a63:	|  |  |  |  |  |        |                    |     |        |  |        /--------|--|-----|--|--|--|--|--|--------|--|--|--|----- 0f 84 2d 05 00 00    	je     2f96 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x7e6>
+        if (i >= n || (p[i] | 0x20) != (unsigned char)word[i]) { return false; }
+    2a69:	|  |  |  |  |  |        |                    |     |        |  |        |        |  |     |  |  |  |  |  |        |  |  |  |      48 39 fa             	cmp    %rdi,%rdx
+    2a6c:	|  |  |  |  |  |        |                    |     |        |  |        |        |  |     |  |  |  |  |  |        |  |  |  |  /-- 73 0b                	jae    2a79 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x2c9>
+    2a6e:	|  |  |  |  |  |        |                    |     |        |  |        |        |  |     |  |  |  |  |  |        |  |  |  \--|-> 0f b6 04 16          	movzbl (%rsi,%rdx,1),%eax
+    2a72:	|  |  |  |  |  |        |                    |     |        |  |        |        |  |     |  |  |  |  |  |        |  |  |     |   83 c8 20             	or     $0x20,%eax
+    2a75:	|  |  |  |  |  |        |                    |     |        |  |        |        |  |     |  |  |  |  |  |        |  |  |     |   38 c8                	cmp    %cl,%al
+    2a77:	|  |  |  |  |  |        |                    |     |        |  |        |        |  |     |  |  |  |  |  |        |  |  \-----|-- 74 df                	je     2a58 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x2a8>
+    2a79:	|  |  |  |  |  |        |                    |     |        |  |        |        |  |     |  |  |  |  |  |        |  |        \-> b9 69 00 00 00       	mov    $0x69,%ecx
+    2a7e:	|  |  |  |  |  |        |                    |     |        |  |        |        |  |     |  |  |  |  |  |        |  |            31 c0                	xor    %eax,%eax
+    for (; word[i] != '\0'; ++i) {
+    2a80:	|  |  |  |  |  |        |                    |     |        |  |        |        |  |     |  |  |  |  |  |        |  |            4c 8d 05 79 16 00 00 	lea    0x1679(%rip),%r8        # 4100 <_IO_stdin_used+0x100>
+    2a87:	|  |  |  |  |  |        |                    |     |        |  |        |        |  |     |  |  |  |  |  |        |  |     /----- eb 1d                	jmp    2aa6 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x2f6>
+    2a89:	|  |  |  |  |  |        |                    |     |        |  |        |        |  |     |  |  |  |  |  |        |  |     |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    2a90:	|  |  |  |  |  |        |                    |     |        |  |        |        |  |     |  |  |  |  |  |        |  |  /--|----> 48 83 c0 01          	add    $0x1,%rax
+    2a94:	|  |  |  |  |  |        |                    |     |        |  |        |        |  |     |  |  |  |  |  |        |  |  |  |      41 0f b6 0c 00       	movzbl (%r8,%rax,1),%ecx
+    2a99:	|  |  |  |  |  |        |                    |     |        |  |        |        |  |     |  |  |  |  |  |        |  |  |  |      84 c9                	test   %cl,%cl
+    2a9b:	|  |  |  |  |  |        |     /--------------|-----|--------|--|--------|--------|--|-----|--|--|--|--|--|--------|--|--|--|----- 0f 84 11 08 00 00    	je     32b2 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xb02>
+        if (i >= n || (p[i] | 0x20) != (unsigned char)word[i]) { return false; }
+    2aa1:	|  |  |  |  |  |        |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |  |  |      48 39 f8             	cmp    %rdi,%rax
+    2aa4:	|  |  |  |  |  |        |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |  |  |  /-- 73 0b                	jae    2ab1 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x301>
+    2aa6:	|  |  |  |  |  |        |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |  |  \--|-> 0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+    2aaa:	|  |  |  |  |  |        |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |  |     |   83 ca 20             	or     $0x20,%edx
+    2aad:	|  |  |  |  |  |        |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |  |     |   38 ca                	cmp    %cl,%dl
+    2aaf:	|  |  |  |  |  |        |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |  \-----|-- 74 df                	je     2a90 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x2e0>
+    2ab1:	|  |  |  |  |  |        |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |        \-> b9 6e 00 00 00       	mov    $0x6e,%ecx
+    2ab6:	|  |  |  |  |  |        |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |            31 c0                	xor    %eax,%eax
+    for (; word[i] != '\0'; ++i) {
+    2ab8:	|  |  |  |  |  |        |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |            4c 8d 05 45 16 00 00 	lea    0x1645(%rip),%r8        # 4104 <_IO_stdin_used+0x104>
+    2abf:	|  |  |  |  |  |        |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |        /-- eb 1d                	jmp    2ade <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x32e>
+    2ac1:	|  |  |  |  |  |        |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |        |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    2ac8:	|  |  |  |  |  |        |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |     /--|-> 48 83 c0 01          	add    $0x1,%rax
+    2acc:	|  |  |  |  |  |        |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |     |  |   41 0f b6 0c 00       	movzbl (%r8,%rax,1),%ecx
+    2ad1:	|  |  |  |  |  |        |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |     |  |   84 c9                	test   %cl,%cl
+    2ad3:	|  |  |  |  |  |     /--|-----|--------------|-----|--------|--|--------|--------|--|-----|--|--|--|--|--|--------|--|-----|--|-- 0f 84 9f 08 00 00    	je     3378 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbc8>
+        if (i >= n || (p[i] | 0x20) != (unsigned char)word[i]) { return false; }
+    2ad9:	|  |  |  |  |  |     |  |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |     |  |   48 39 f8             	cmp    %rdi,%rax
+    2adc:	|  |  |  |  |  +-----|--|-----|--------------|-----|--------|--|--------|--------|--|-----|--|--|--|--|--|--------|--|-----|--|-- 73 12                	jae    2af0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x340>
+    2ade:	|  |  |  |  |  |     |  |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |     |  \-> 0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+    2ae2:	|  |  |  |  |  |     |  |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |     |      83 ca 20             	or     $0x20,%edx
+    2ae5:	|  |  |  |  |  |     |  |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |     |      38 ca                	cmp    %cl,%dl
+    2ae7:	|  |  |  |  |  |     |  |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |     \----- 74 df                	je     2ac8 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x318>
+    2ae9:	|  |  |  |  |  |     |  |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |            0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            : tag_(Tag::ERR)
+    2af0:	|  |  |  |  |  >-----|--|-----|--------------|-----|--------|--|--------|--------|--|-----|--|--|--|--|--|--------|--|----------> 41 c7 06 02 00 00 00 	movl   $0x2,(%r14)
+    2af7:	|  |  |  |  |  |     |  |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |            41 c7 46 08 02 00 00 	movl   $0x2,0x8(%r14)
+    2afe:	|  |  |  |  |  |     |  |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |            00 
+    2aff:	|  +--|--|--|--|-----|--|-----|--------------|-----|--------|--|--------|--------|--|-----|--|--|--|--|--|--------|--|----------- e9 d6 fc ff ff       	jmp    27da <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x2a>
+    2b04:	|  |  |  |  |  |     |  |     |              |     |        |  |        |        |  |     |  |  |  |  |  |        |  |            0f 1f 40 00          	nopl   0x0(%rax)
+        if (m != 0) { return i + Length(__builtin_ctzll(m) / 8); }
+    2b08:	|  |  |  |  |  |     |  |     |              |     |        |  |        |        |  |     |  |  |  |  |  \--------|--|----------> 31 db                	xor    %ebx,%ebx
+    2b0a:	|  |  |  |  |  |     |  |     |              |     |        |  |        |        |  |     |  |  |  |  |           |  |            f3 48 0f bc da       	tzcnt  %rdx,%rbx
+    2b0f:	|  |  |  |  |  |     |  |     |              |     |        |  |        |        |  |     |  |  |  |  |           |  |            89 da                	mov    %ebx,%edx
+    2b11:	|  |  |  |  |  |     |  |     |              |     |        |  |        |        |  |     |  |  |  |  |           |  |            c1 fa 03             	sar    $0x3,%edx
+    2b14:	|  |  |  |  |  |     |  |     |              |     |        |  |        |        |  |     |  |  |  |  |           |  |            48 63 da             	movslq %edx,%rbx
+    2b17:	|  |  |  |  |  |     |  |     |              |     |        |  |        |        |  |     |  |  |  |  |           |  |            48 01 f3             	add    %rsi,%rbx
+    Index const int_e = int_b + digit_run(p + int_b, n - int_b);
+    2b1a:	|  |  |  |  |  |     |  |  /--|--------------|-----|--------|--|--------|--------|--|-----|--|--|--|--|-----------|--|----------> 48 8d 4c 1d 00       	lea    0x0(%rbp,%rbx,1),%rcx
+    if (int_e < n && p[int_e] == '.') {
+    2b1f:	|  |  |  |  |  |     |  |  |  |              |     |        |  |        |        |  |     |  |  |  |  |           |  |            4c 39 c1             	cmp    %r8,%rcx
+    2b22:	|  |  |  +--|--|-----|--|--|--|--------------|-----|--------|--|--------|--------|--|-----|--|--|--|--|-----------|--|----------- 0f 82 40 fe ff ff    	jb     2968 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x1b8>
+    if (int_e == int_b && frac_e == frac_b) { return R::Err(ParseError::InvalidDigit); }
+    2b28:	|  |  |  |  |  |     |  |  |  |              |     |        |  |        |        |  |     |  |  |  |  |           |  |            48 39 cd             	cmp    %rcx,%rbp
+    2b2b:	|  |  |  |  |  +-----|--|--|--|--------------|-----|--------|--|--------|--------|--|-----|--|--|--|--|-----------|--|----------- 74 c3                	je     2af0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x340>
+    if (int_e < n && p[int_e] == '.') {
+    2b2d:	|  |  |  |  |  |  /--|--|--|--|--------------|-----|--------|--|--------|--------|--|-----|--|--|--|--|-----------|--|----------> 4c 8d 14 08          	lea    (%rax,%rcx,1),%r10
+    while (a < int_e && p[a] == '0') {
+    2b31:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |     |  |  |  |  |           |  |            48 39 cd             	cmp    %rcx,%rbp
+    2b34:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  /--|--|--|--|--|-----------|--|----------- 0f 83 1c 04 00 00    	jae    2f56 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x7a6>
+    2b3a:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |           |  |  /-------> 48 89 ce             	mov    %rcx,%rsi
+    2b3d:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |           |  |  |         49 89 cb             	mov    %rcx,%r11
+    2b40:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |           |  |  |         49 89 cd             	mov    %rcx,%r13
+    2b43:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |           |  |  |         45 31 e4             	xor    %r12d,%r12d
+    2b46:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |           |  |  |         48 c7 04 24 00 00 00 	movq   $0x0,(%rsp)
+    2b4d:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |           |  |  |         00 
+    2b4e:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |           |  \--|-------- e9 76 fe ff ff       	jmp    29c9 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x219>
+    2b53:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |           |     |         0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        frac_b = int_e + 1;
+    2b58:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |           \-----|-------> 4c 8d 59 01          	lea    0x1(%rcx),%r11
+        frac_e = frac_b + digit_run(p + frac_b, n - frac_b);
+    2b5c:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |                 |         4c 89 c7             	mov    %r8,%rdi
+    2b5f:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |                 |         48 89 04 24          	mov    %rax,(%rsp)
+    Index i = 0;
+    2b63:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |                 |         45 31 e4             	xor    %r12d,%r12d
+        frac_e = frac_b + digit_run(p + frac_b, n - frac_b);
+    2b66:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |                 |         4c 29 df             	sub    %r11,%rdi
+    2b69:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |                 |         4e 8d 14 18          	lea    (%rax,%r11,1),%r10
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    2b6d:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |                 |         49 bd 46 46 46 46 46 	movabs $0x4646464646464646,%r13
+    2b74:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |                 |         46 46 46 
+    while (i + 8 <= n) {
+    2b77:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |                 |     /-- eb 33                	jmp    2bac <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x3fc>
+    2b79:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |                 |     |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    2b80:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |                 |  /--|-> 48 b8 d0 cf cf cf cf 	movabs $0xcfcfcfcfcfcfcfd0,%rax
+    2b87:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |                 |  |  |   cf cf cf 
+    __builtin_memcpy(&v, p, sizeof(v));
+    2b8a:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |                 |  |  |   4b 8b 74 22 f8       	mov    -0x8(%r10,%r12,1),%rsi
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    2b8f:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |                 |  |  |   4a 8d 14 2e          	lea    (%rsi,%r13,1),%rdx
+    2b93:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |                 |  |  |   48 01 c6             	add    %rax,%rsi
+        if (m != 0) { return i + Length(__builtin_ctzll(m) / 8); }
+    2b96:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |                 |  |  |   48 b8 80 80 80 80 80 	movabs $0x8080808080808080,%rax
+    2b9d:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |                 |  |  |   80 80 80 
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    2ba0:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |                 |  |  |   48 09 f2             	or     %rsi,%rdx
+        if (m != 0) { return i + Length(__builtin_ctzll(m) / 8); }
+    2ba3:	|  |  |  |  |  |  |  |  |  |  |              |     |        |  |        |        |  |  |  |  |  |  |  |                 |  |  |   48 21 c2             	and    %rax,%rdx
+    2ba6:	|  |  |  |  |  |  |  |  |  |  |              |     |  /-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|--|--|-- 0f 85 a0 06 00 00    	jne    324c <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xa9c>
+    while (i + 8 <= n) {
+    2bac:	|  |  |  |  |  |  |  |  |  |  |              |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |  |  \-> 4d 89 e1             	mov    %r12,%r9
+    2baf:	|  |  |  |  |  |  |  |  |  |  |              |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |  |      49 83 c4 08          	add    $0x8,%r12
+    2bb3:	|  |  |  |  |  |  |  |  |  |  |              |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |  |      4c 39 e7             	cmp    %r12,%rdi
+    2bb6:	|  |  |  |  |  |  |  |  |  |  |              |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |  \----- 73 c8                	jae    2b80 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x3d0>
+    while (i < n && is_digit(p[i])) {
+    2bb8:	|  |  |  |  |  |  |  |  |  |  |              |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         48 8b 04 24          	mov    (%rsp),%rax
+    2bbc:	|  |  |  |  |  |  |  |  |  |  |              |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         49 39 f9             	cmp    %rdi,%r9
+    2bbf:	|  |  |  |  |  |  |  |  |  |  |  /-----------|-----|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------- 0f 83 f2 07 00 00    	jae    33b7 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xc07>
+    return (unsigned char)(c - '0') < 10;
+    2bc5:	|  |  |  |  |  |  |  |  |  |  |  |           |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         43 0f b6 34 0a       	movzbl (%r10,%r9,1),%esi
+    2bca:	|  |  |  |  |  |  |  |  |  |  |  |           |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         8d 56 d0             	lea    -0x30(%rsi),%edx
+    while (i < n && is_digit(p[i])) {
+    2bcd:	|  |  |  |  |  |  |  |  |  |  |  |           |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         80 fa 09             	cmp    $0x9,%dl
+    2bd0:	|  |  |  |  |  |  |  |  |  |  |  +-----------|-----|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------- 0f 87 e1 07 00 00    	ja     33b7 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xc07>
+        i += 1;
+    2bd6:	|  |  |  |  |  |  |  |  |  |  |  |           |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         49 8d 51 01          	lea    0x1(%r9),%rdx
+    while (i < n && is_digit(p[i])) {
+    2bda:	|  |  |  |  |  |  |  |  |  |  |  |           |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         48 39 fa             	cmp    %rdi,%rdx
+    2bdd:	|  |  |  |  |  |  |  |  |  |  |  |  /--------|-----|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------- 0f 83 a9 07 00 00    	jae    338c <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbdc>
+    return (unsigned char)(c - '0') < 10;
+    2be3:	|  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         43 0f b6 74 0a 01    	movzbl 0x1(%r10,%r9,1),%esi
+    2be9:	|  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         83 ee 30             	sub    $0x30,%esi
+    while (i < n && is_digit(p[i])) {
+    2bec:	|  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         40 80 fe 09          	cmp    $0x9,%sil
+    2bf0:	|  |  |  |  |  |  |  |  |  |  |  |  |  /-----|-----|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------- 0f 87 9e 07 00 00    	ja     3394 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbe4>
+        i += 1;
+    2bf6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         49 8d 51 02          	lea    0x2(%r9),%rdx
+    while (i < n && is_digit(p[i])) {
+    2bfa:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         48 39 fa             	cmp    %rdi,%rdx
+    2bfd:	|  |  |  |  |  |  |  |  |  |  |  |  +--|-----|-----|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------- 0f 83 89 07 00 00    	jae    338c <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbdc>
+    return (unsigned char)(c - '0') < 10;
+    2c03:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         43 0f b6 74 0a 02    	movzbl 0x2(%r10,%r9,1),%esi
+    2c09:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         83 ee 30             	sub    $0x30,%esi
+    while (i < n && is_digit(p[i])) {
+    2c0c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         40 80 fe 09          	cmp    $0x9,%sil
+    2c10:	|  |  |  |  |  |  |  |  |  |  |  |  |  +-----|-----|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------- 0f 87 7e 07 00 00    	ja     3394 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbe4>
+        i += 1;
+    2c16:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         49 8d 51 03          	lea    0x3(%r9),%rdx
+    while (i < n && is_digit(p[i])) {
+    2c1a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         48 39 fa             	cmp    %rdi,%rdx
+    2c1d:	|  |  |  |  |  |  |  |  |  |  |  |  +--|-----|-----|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------- 0f 83 69 07 00 00    	jae    338c <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbdc>
+    return (unsigned char)(c - '0') < 10;
+    2c23:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         43 0f b6 74 0a 03    	movzbl 0x3(%r10,%r9,1),%esi
+    2c29:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         83 ee 30             	sub    $0x30,%esi
+    while (i < n && is_digit(p[i])) {
+    2c2c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         40 80 fe 09          	cmp    $0x9,%sil
+    2c30:	|  |  |  |  |  |  |  |  |  |  |  |  |  +-----|-----|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------- 0f 87 5e 07 00 00    	ja     3394 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbe4>
+        i += 1;
+    2c36:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         49 8d 51 04          	lea    0x4(%r9),%rdx
+    while (i < n && is_digit(p[i])) {
+    2c3a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         48 39 fa             	cmp    %rdi,%rdx
+    2c3d:	|  |  |  |  |  |  |  |  |  |  |  |  +--|-----|-----|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------- 0f 83 49 07 00 00    	jae    338c <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbdc>
+    return (unsigned char)(c - '0') < 10;
+    2c43:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         43 0f b6 74 0a 04    	movzbl 0x4(%r10,%r9,1),%esi
+    2c49:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         83 ee 30             	sub    $0x30,%esi
+    while (i < n && is_digit(p[i])) {
+    2c4c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         40 80 fe 09          	cmp    $0x9,%sil
+    2c50:	|  |  |  |  |  |  |  |  |  |  |  |  |  +-----|-----|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------- 0f 87 3e 07 00 00    	ja     3394 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbe4>
+        i += 1;
+    2c56:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         49 8d 51 05          	lea    0x5(%r9),%rdx
+    while (i < n && is_digit(p[i])) {
+    2c5a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         48 39 fa             	cmp    %rdi,%rdx
+    2c5d:	|  |  |  |  |  |  |  |  |  |  |  |  +--|-----|-----|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------- 0f 83 29 07 00 00    	jae    338c <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbdc>
+    return (unsigned char)(c - '0') < 10;
+    2c63:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         43 0f b6 74 0a 05    	movzbl 0x5(%r10,%r9,1),%esi
+    2c69:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         83 ee 30             	sub    $0x30,%esi
+    while (i < n && is_digit(p[i])) {
+    2c6c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         40 80 fe 09          	cmp    $0x9,%sil
+    2c70:	|  |  |  |  |  |  |  |  |  |  |  |  |  +-----|-----|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------- 0f 87 1e 07 00 00    	ja     3394 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbe4>
+        i += 1;
+    2c76:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         49 8d 51 06          	lea    0x6(%r9),%rdx
+    while (i < n && is_digit(p[i])) {
+    2c7a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         48 39 fa             	cmp    %rdi,%rdx
+    2c7d:	|  |  |  |  |  |  |  |  |  |  |  |  +--|-----|-----|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------- 0f 83 09 07 00 00    	jae    338c <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbdc>
+    return (unsigned char)(c - '0') < 10;
+    2c83:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         43 0f b6 74 0a 06    	movzbl 0x6(%r10,%r9,1),%esi
+    2c89:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         83 ee 30             	sub    $0x30,%esi
+    while (i < n && is_digit(p[i])) {
+    2c8c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         40 80 fe 09          	cmp    $0x9,%sil
+    2c90:	|  |  |  |  |  |  |  |  |  |  |  |  |  +-----|-----|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------- 0f 87 fe 06 00 00    	ja     3394 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbe4>
+        i += 1;
+    2c96:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         49 8d 51 07          	lea    0x7(%r9),%rdx
+    while (i < n && is_digit(p[i])) {
+    2c9a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         48 39 fa             	cmp    %rdi,%rdx
+    2c9d:	|  |  |  |  |  |  |  |  |  |  |  |  +--|-----|-----|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------- 0f 83 e9 06 00 00    	jae    338c <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbdc>
+    return (unsigned char)(c - '0') < 10;
+    2ca3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         43 0f b6 74 0a 07    	movzbl 0x7(%r10,%r9,1),%esi
+    2ca9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         83 ee 30             	sub    $0x30,%esi
+    while (i < n && is_digit(p[i])) {
+    2cac:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |  |        |        |  |  |  |  |  |  |  |                 |         40 80 fe 09          	cmp    $0x9,%sil
+    2cb0:	|  |  |  |  |  |  |  |  |  |  |  |  |  +-----|-----|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------- 0f 87 de 06 00 00    	ja     3394 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbe4>
+        frac_e = frac_b + digit_run(p + frac_b, n - frac_b);
+    2cb6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  /--|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------> 4f 8d 2c 23          	lea    (%r11,%r12,1),%r13
+    long long int q = e - (long long int)(frac_e - frac_b);
+    2cba:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|--|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------> 4c 89 24 24          	mov    %r12,(%rsp)
+    2cbe:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |  |  |  |  |  |  |  |                 |         4c 89 ee             	mov    %r13,%rsi
+    long long int e = 0;
+    2cc1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |  |  |  |  |  |  |  |                 |         45 31 c9             	xor    %r9d,%r9d
+    if (i < n && (p[i] | 0x20) == 'e') {
+    2cc4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |  |  |  |  |  |  |  |                 |         4d 39 c5             	cmp    %r8,%r13
+    2cc7:	|  |  |  |  +--|--|--|--|--|--|--|--|--|--|--|--|--|--|-----|--|--------|--------|--|--|--|--|--|--|--|-----------------|-------- 0f 83 d8 fc ff ff    	jae    29a5 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x1f5>
+    2ccd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |  |  |  |  |  |  |  |                 |         42 0f b6 14 28       	movzbl (%rax,%r13,1),%edx
+    2cd2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |  |  |  |  |  |  |  \-----------------|-------- e9 bc fc ff ff       	jmp    2993 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x1e3>
+    2cd7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |  |  |  |  |  |  |                    |         66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    2cde:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |  |  |  |  |  |  |                    |         00 00 
+        i += 1;
+    2ce0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |  \--|--|--|--|--|--------------------|-------> 4c 89 cb             	mov    %r9,%rbx
+    Index const int_e = int_b + digit_run(p + int_b, n - int_b);
+    2ce3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |  |  /-----------------|-------> 48 8d 4c 1d 00       	lea    0x0(%rbp,%rbx,1),%rcx
+    if (int_e < n && p[int_e] == '.') {
+    2ce8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |  |  |                 |         4c 39 c1             	cmp    %r8,%rcx
+    2ceb:	|  |  |  +--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-----|--|--------|--------|-----|--|--|--|--|--|-----------------|-------- 0f 82 77 fc ff ff    	jb     2968 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x1b8>
+    if (int_e == int_b && frac_e == frac_b) { return R::Err(ParseError::InvalidDigit); }
+    2cf1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |  |  |                 |         48 39 cd             	cmp    %rcx,%rbp
+    2cf4:	|  |  |  |  |  +--|--|--|--|--|--|--|--|--|--|--|--|--|-----|--|--------|--------|-----|--|--|--|--|--|-----------------|-------- 0f 84 f6 fd ff ff    	je     2af0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x340>
+    if (int_e < n && p[int_e] == '.') {
+    2cfa:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  >--------|--------|-----|--|--|--|--|--|-----------------|-------> 4c 8d 14 08          	lea    (%rax,%rcx,1),%r10
+    2cfe:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |  |  |                 \-------- e9 37 fe ff ff       	jmp    2b3a <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x38a>
+    2d03:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |  |  |                           0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        w = digits_value(ds.a, ds.an, n - a) * pow10_u64[ds.bn] + digits_value(ds.b, ds.bn, n - f);
+    2d08:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |  \--|-------------------------> 4c 89 c2             	mov    %r8,%rdx
+    2d0b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                           48 29 ea             	sub    %rbp,%rdx
+    if (n_sig <= 19) {
+    2d0e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                           49 83 f9 13          	cmp    $0x13,%r9
+    2d12:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 /-------- 0f 87 00 01 00 00    	ja     2e18 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x668>
+        w = digits_value(ds.a, ds.an, n - a) * pow10_u64[ds.bn] + digits_value(ds.b, ds.bn, n - f);
+    2d18:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         48 89 de             	mov    %rbx,%rsi
+    2d1b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         4c 89 ff             	mov    %r15,%rdi
+    2d1e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         4c 89 54 24 18       	mov    %r10,0x18(%rsp)
+    2d23:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         4c 89 5c 24 10       	mov    %r11,0x10(%rsp)
+    2d28:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         4c 89 44 24 08       	mov    %r8,0x8(%rsp)
+    2d2d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         e8 ee ef ff ff       	call   1d20 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    2d32:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         4c 8b 5c 24 10       	mov    0x10(%rsp),%r11
+    2d37:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         48 8b 54 24 08       	mov    0x8(%rsp),%rdx
+    2d3c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         4c 89 e6             	mov    %r12,%rsi
+    2d3f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         48 89 c3             	mov    %rax,%rbx
+    2d42:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         48 8d 05 57 3d 00 00 	lea    0x3d57(%rip),%rax        # 6aa0 <nel::(anonymous namespace)::pow10_u64>
+    2d49:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         48 8b 7c 24 18       	mov    0x18(%rsp),%rdi
+    2d4e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         4a 0f af 1c e0       	imul   (%rax,%r12,8),%rbx
+    2d53:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         4c 29 da             	sub    %r11,%rdx
+    2d56:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         e8 c5 ef ff ff       	call   1d20 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    2d5b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         48 8d 34 03          	lea    (%rbx,%rax,1),%rsi
+    if (!truncated && w <= (1ULL << 53) && q >= -22 && q <= 22) {
+    2d5f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         48 b8 00 00 00 00 00 	movabs $0x20000000000000,%rax
+    2d66:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         00 20 00 
+    2d69:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |                 |         48 39 f0             	cmp    %rsi,%rax
+    2d6c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |        |     |  |  |  |     |  /--------------|-------- 0f 82 a4 01 00 00    	jb     2f16 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x766>
+    2d72:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|--------|--------|-----|--|--|--|-----|--|--------------|-------> 48 8b 3c 24          	mov    (%rsp),%rdi
+    2d76:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |        |     |  |  |  |     |  |              |         48 8d 47 16          	lea    0x16(%rdi),%rax
+    2d7a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |        |     |  |  |  |     |  |              |         48 83 f8 2c          	cmp    $0x2c,%rax
+    2d7e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |        |     |  |  |  |     |  |  /-----------|-------- 0f 87 96 01 00 00    	ja     2f1a <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x76a>
+        double d = double(w);
+    2d84:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |        |     |  |  |  |     |  |  |           |         66 0f ef c0          	pxor   %xmm0,%xmm0
+    2d88:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |        |     |  |  |  |     |  |  |           |         f2 48 0f 2a c6       	cvtsi2sd %rsi,%xmm0
+        d = (q < 0) ? d / pow10_f64[-q] : d * pow10_f64[q];
+    2d8d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |        |     |  |  |  |     |  |  |           |         48 85 ff             	test   %rdi,%rdi
+    2d90:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-----|--------|-----|--|--|--|-----|--|--|-----------|-------- 0f 88 ce 05 00 00    	js     3364 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbb4>
+    2d96:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |     |  |  |  |     |  |  |           |         48 8d 05 43 3c 00 00 	lea    0x3c43(%rip),%rax        # 69e0 <nel::(anonymous namespace)::pow10_f64>
+    2d9d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |     |  |  |  |     |  |  |           |         f2 0f 59 04 f8       	mulsd  (%rax,%rdi,8),%xmm0
+        return R::Ok(Pair<double, Length>{neg ? -d : d, used});
+    2da2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|--------|-----|--|--|--|-----|--|--|-----------|-------> 80 7c 24 3e 2d       	cmpb   $0x2d,0x3e(%rsp)
+    2da7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |  |     |  |  |           |     /-- 75 08                	jne    2db1 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x601>
+    2da9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |  |     |  |  |           |     |   66 0f 57 05 af 3d 00 	xorpd  0x3daf(%rip),%xmm0        # 6b60 <nel::(anonymous namespace)::pow10_u64+0xc0>
+    2db0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |  |     |  |  |           |     |   00 
+            : tag_(Tag::OK)
+    2db1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |  |     |  |  |           |     \-> 41 c7 06 01 00 00 00 	movl   $0x1,(%r14)
+    2db8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |  |     |  |  |           |         4d 89 6e 10          	mov    %r13,0x10(%r14)
+    2dbc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |  |     |  |  |           |         f2 41 0f 11 46 08    	movsd  %xmm0,0x8(%r14)
+    2dc2:	|  +--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--------|-----|--|--|--|-----|--|--|-----------|-------- e9 13 fa ff ff       	jmp    27da <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x2a>
+    2dc7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |  |     |  |  |           |         66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    2dce:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |  |     |  |  |           |         00 00 
+        while (f < frac_e && p[f] == '0') {
+    2dd0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  \--|-----|--|--|-----------|-------> 49 39 f3             	cmp    %rsi,%r11
+    2dd3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |     |     |  |  |           |  /----- 72 18                	jb     2ded <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x63d>
+    2dd5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  +-----|-----|--|--|-----------|--|----- e9 08 fc ff ff       	jmp    29e2 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x232>
+    2dda:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |     |     |  |  |           |  |      66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+            f += 1;
+    2de0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |     |     |  |  |           |  |  /-> 49 83 c3 01          	add    $0x1,%r11
+        while (f < frac_e && p[f] == '0') {
+    2de4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |     |     |  |  |           |  |  |   49 39 f3             	cmp    %rsi,%r11
+    2de7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-----|-----|--|-----|-----|--|--|-----------|--|--|-- 0f 84 93 04 00 00    	je     3280 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xad0>
+    2ded:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |     |  |  |           |  \--|-> 42 80 3c 18 30       	cmpb   $0x30,(%rax,%r11,1)
+    2df2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |     |  |  |           |     \-- 74 ec                	je     2de0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x630>
+    Digits const ds = {p + a, int_e - a, p + f, frac_e - f};
+    2df4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |     |  |  |           |         4c 29 de             	sub    %r11,%rsi
+        while (f < frac_e && p[f] == '0') {
+    2df7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |     |  |  |           |         4e 8d 14 18          	lea    (%rax,%r11,1),%r10
+    Digits const ds = {p + a, int_e - a, p + f, frac_e - f};
+    2dfb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |     |  |  |           |         49 89 f4             	mov    %rsi,%r12
+    2dfe:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  \-----|-----|--|--|-----------|-------- e9 df fb ff ff       	jmp    29e2 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x232>
+    2e03:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |        |     |  |  |           |         0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    if (i < n && !is_digit(p[i]) && p[i] != '.') {
+    2e08:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     \-----|--------|-----|--|--|-----------|-------> 0f b6 50 01          	movzbl 0x1(%rax),%edx
+    2e0c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |        |     |  |  |           |         49 8d 78 ff          	lea    -0x1(%r8),%rdi
+    2e10:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |        \-----|--|--|-----------|-------- e9 15 fc ff ff       	jmp    2a2a <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x27a>
+    2e15:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |           |         0f 1f 00             	nopl   (%rax)
+        if (ds.an >= 19) {
+    2e18:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |           \-------> 48 83 fb 12          	cmp    $0x12,%rbx
+    2e1c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     /-------------- 0f 87 c4 00 00 00    	ja     2ee6 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x736>
+            w = digits_value(ds.a, ds.an, n - a) * pow10_u64[19 - ds.an] +
+    2e22:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               48 89 de             	mov    %rbx,%rsi
+    2e25:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               4c 89 ff             	mov    %r15,%rdi
+    2e28:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               4c 89 4c 24 30       	mov    %r9,0x30(%rsp)
+    2e2d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               4c 89 54 24 28       	mov    %r10,0x28(%rsp)
+    2e32:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               4c 89 5c 24 20       	mov    %r11,0x20(%rsp)
+    2e37:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               4c 89 44 24 18       	mov    %r8,0x18(%rsp)
+    2e3c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               48 89 4c 24 08       	mov    %rcx,0x8(%rsp)
+    2e41:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               e8 da ee ff ff       	call   1d20 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    2e46:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               48 8b 4c 24 08       	mov    0x8(%rsp),%rcx
+                digits_value(ds.b, 19 - ds.an, n - f);
+    2e4b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+            w = digits_value(ds.a, ds.an, n - a) * pow10_u64[19 - ds.an] +
+    2e50:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               48 8d 15 49 3c 00 00 	lea    0x3c49(%rip),%rdx        # 6aa0 <nel::(anonymous namespace)::pow10_u64>
+    2e57:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               49 89 c4             	mov    %rax,%r12
+    2e5a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               48 89 e8             	mov    %rbp,%rax
+                digits_value(ds.b, 19 - ds.an, n - f);
+    2e5d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+            w = digits_value(ds.a, ds.an, n - a) * pow10_u64[19 - ds.an] +
+    2e62:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               48 29 c8             	sub    %rcx,%rax
+                digits_value(ds.b, 19 - ds.an, n - f);
+    2e65:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               4c 89 d7             	mov    %r10,%rdi
+            w = digits_value(ds.a, ds.an, n - a) * pow10_u64[19 - ds.an] +
+    2e68:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+    2e6d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               4c 0f af a4 c2 98 00 	imul   0x98(%rdx,%rax,8),%r12
+    2e74:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               00 00 
+                digits_value(ds.b, 19 - ds.an, n - f);
+    2e76:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               48 8b 54 24 18       	mov    0x18(%rsp),%rdx
+            w = digits_value(ds.a, ds.an, n - a) * pow10_u64[19 - ds.an] +
+    2e7b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               48 8d 70 13          	lea    0x13(%rax),%rsi
+                digits_value(ds.b, 19 - ds.an, n - f);
+    2e7f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               4c 89 54 24 08       	mov    %r10,0x8(%rsp)
+    2e84:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               4c 29 da             	sub    %r11,%rdx
+    2e87:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               e8 94 ee ff ff       	call   1d20 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+            w = digits_value(ds.a, ds.an, n - a) * pow10_u64[19 - ds.an] +
+    2e8c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+    2e91:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               48 8b 4c 24 10       	mov    0x10(%rsp),%rcx
+    2e96:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               4c 8b 54 24 08       	mov    0x8(%rsp),%r10
+    2e9b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |               49 8d 34 04          	lea    (%r12,%rax,1),%rsi
+        q += (long long int)(n_sig - 19);
+    2e9f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |  /----------> 48 8b 04 24          	mov    (%rsp),%rax
+            return (i < an) ? a[i] : b[i - an];
+    2ea3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |  |            48 29 cd             	sub    %rcx,%rbp
+    2ea6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |  |            49 8d 0c 2a          	lea    (%r10,%rbp,1),%rcx
+        q += (long long int)(n_sig - 19);
+    2eaa:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |  |            4e 8d 64 08 ed       	lea    -0x13(%rax,%r9,1),%r12
+        for (Index k = 19; k < n_sig; ++k) {
+    2eaf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |  |            b8 13 00 00 00       	mov    $0x13,%eax
+    2eb4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |  |  /-------- eb 25                	jmp    2edb <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x72b>
+    2eb6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |  |  |         66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2ebd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |  |  |         00 00 00 
+            return (i < an) ? a[i] : b[i - an];
+    2ec0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |  |  |     /-> 41 0f b6 14 07       	movzbl (%r15,%rax,1),%edx
+            if (ds[k] != '0') {
+    2ec5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |     |  |  |  /--|-> 80 fa 30             	cmp    $0x30,%dl
+    2ec8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |  /--|--|--|--|--|-- 0f 85 f5 00 00 00    	jne    2fc3 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x813>
+        for (Index k = 19; k < n_sig; ++k) {
+    2ece:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |  |  |  |  |  |  |   48 83 c0 01          	add    $0x1,%rax
+    2ed2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |           |              |  |  |  |  |  |  |  |  |   4c 39 c8             	cmp    %r9,%rax
+    2ed5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     /-----|--------------|--|--|--|--|--|--|--|--|-- 0f 84 b4 03 00 00    	je     328f <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xadf>
+            return (i < an) ? a[i] : b[i - an];
+    2edb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |              |  |  |  |  |  |  \--|--|-> 48 39 d8             	cmp    %rbx,%rax
+    2ede:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |              |  |  |  |  |  |     |  \-- 72 e0                	jb     2ec0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x710>
+    2ee0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |              |  |  |  |  |  |     |      0f b6 14 01          	movzbl (%rcx,%rax,1),%edx
+    2ee4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |              |  |  |  |  |  |     \----- eb df                	jmp    2ec5 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x715>
+            w = digits_value(ds.a, 19, n - a);
+    2ee6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |              |  |  |  |  \--|----------> be 13 00 00 00       	mov    $0x13,%esi
+    2eeb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |              |  |  |  |     |            4c 89 ff             	mov    %r15,%rdi
+    2eee:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |              |  |  |  |     |            4c 89 4c 24 18       	mov    %r9,0x18(%rsp)
+    2ef3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |              |  |  |  |     |            4c 89 54 24 10       	mov    %r10,0x10(%rsp)
+    2ef8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |              |  |  |  |     |            48 89 4c 24 08       	mov    %rcx,0x8(%rsp)
+    2efd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |              |  |  |  |     |            e8 1e ee ff ff       	call   1d20 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    2f02:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |              |  |  |  |     |            48 8b 4c 24 08       	mov    0x8(%rsp),%rcx
+    2f07:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |              |  |  |  |     |            4c 8b 54 24 10       	mov    0x10(%rsp),%r10
+    2f0c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |              |  |  |  |     |            4c 8b 4c 24 18       	mov    0x18(%rsp),%r9
+    2f11:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |              |  |  |  |     |            48 89 c6             	mov    %rax,%rsi
+    2f14:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |              |  |  |  |     \----------- eb 89                	jmp    2e9f <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x6ef>
+    Binary const b = compute_float(q, w);
+    2f16:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |              |  \--|--|----------------> 48 8b 3c 24          	mov    (%rsp),%rdi
+    2f1a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |              |     \--|----------------> e8 61 f1 ff ff       	call   2080 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)>
+    2f1f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |              |        |                  48 89 c5             	mov    %rax,%rbp
+    bool const neg = p[0] == '-';
+    2f22:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|-----|--------------|--------|----------------> 31 c0                	xor    %eax,%eax
+    2f24:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |              |        |                  80 7c 24 3e 2d       	cmpb   $0x2d,0x3e(%rsp)
+    2f29:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |              |        |                  41 c7 06 01 00 00 00 	movl   $0x1,(%r14)
+    2f30:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |              |        |                  0f 94 c0             	sete   %al
+    Word const bits = b.mantissa | (Word(b.power2) << mantissa_bits) | (Word(neg) << 63);
+    2f33:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |              |        |                  48 c1 e2 34          	shl    $0x34,%rdx
+    2f37:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |              |        |                  4d 89 6e 10          	mov    %r13,0x10(%r14)
+    2f3b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |              |        |                  48 c1 e0 3f          	shl    $0x3f,%rax
+    2f3f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |              |        |                  48 09 e8             	or     %rbp,%rax
+    2f42:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |              |        |                  48 09 d0             	or     %rdx,%rax
+    2f45:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |              |        |                  49 89 46 08          	mov    %rax,0x8(%r14)
+    2f49:	|  +--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-----|--------------|--------|----------------- e9 8c f8 ff ff       	jmp    27da <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x2a>
+    while (i < n && is_digit(p[i])) {
+    2f4e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \--|--|--|--|--|--|--|--|--|--|-----|--------------|--------|----------------> 48 89 f3             	mov    %rsi,%rbx
+    2f51:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |     |              \--------|----------------- e9 8d fd ff ff       	jmp    2ce3 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x533>
+    while (a < int_e && p[a] == '0') {
+    2f56:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |     \-----------------------|----------------> 49 89 d9             	mov    %rbx,%r9
+    2f59:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |                             |                  b9 01 00 00 00       	mov    $0x1,%ecx
+    2f5e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |                             |                  45 31 e4             	xor    %r12d,%r12d
+    2f61:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |                             |                  bd 01 00 00 00       	mov    $0x1,%ebp
+    2f66:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |                             |                  48 c7 04 24 00 00 00 	movq   $0x0,(%rsp)
+    2f6d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |                             |                  00 
+    2f6e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |                             |                  41 bd 01 00 00 00    	mov    $0x1,%r13d
+    2f74:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |                             |                  41 bb 01 00 00 00    	mov    $0x1,%r11d
+    2f7a:	|  |  |  |  |  |  |  |  +--|--|--|--|--|--|--|--|-----|--|--|--|--|--|--|--|--|--|-----------------------------|----------------- e9 67 fa ff ff       	jmp    29e6 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x236>
+    2f7f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |                             |                  90                   	nop
+    Index const int_e = int_b + digit_run(p + int_b, n - int_b);
+    2f80:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \--|-----|--|--|--|--|--|--|--|--|--|-----------------------------|----------------> 4a 8d 4c 0d 00       	lea    0x0(%rbp,%r9,1),%rcx
+    if (int_e < n && p[int_e] == '.') {
+    2f85:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |  |  |  |  |  |  |  |                             |                  4c 39 c1             	cmp    %r8,%rcx
+    2f88:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |  \--|--|--|--|--|--|-----------------------------|----------------- 0f 83 6c fd ff ff    	jae    2cfa <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x54a>
+        i += 1;
+    2f8e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |  |  |  |  |                             |                  4c 89 cb             	mov    %r9,%rbx
+    2f91:	|  |  |  +--|--|--|--|--|--|--|--|--|--|--|-----|-----|--|--|-----|--|--|--|--|--|-----------------------------|----------------- e9 d2 f9 ff ff       	jmp    2968 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x1b8>
+            return R::Ok(Pair<double, Length>{neg ? -__builtin_inf() : __builtin_inf(), i + 8});
+    2f96:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |  \--|--|--|-----------------------------|----------------> 80 7c 24 3e 2d       	cmpb   $0x2d,0x3e(%rsp)
+    2f9b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  /--------------------------|----------------- 0f 84 a1 03 00 00    	je     3342 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xb92>
+    2fa1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |                          |                  f2 0f 10 05 9f 3b 00 	movsd  0x3b9f(%rip),%xmm0        # 6b48 <nel::(anonymous namespace)::pow10_u64+0xa8>
+    2fa8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |                          |                  00 
+    2fa9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  /-----------------------|----------------> 48 83 c5 08          	add    $0x8,%rbp
+    2fad:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  |                       |                  41 c7 06 01 00 00 00 	movl   $0x1,(%r14)
+    2fb4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  |                       |                  49 89 6e 10          	mov    %rbp,0x10(%r14)
+    2fb8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  |                       |                  f2 41 0f 11 46 08    	movsd  %xmm0,0x8(%r14)
+    2fbe:	|  +--|--|--|--|--|--|--|--|--|--|--|--|--|-----|-----|--|--|-----|--|-----|--|--|--|--|-----------------------|----------------- e9 17 f8 ff ff       	jmp    27da <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x2a>
+    Binary const b = compute_float(q, w);
+    2fc3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  |                       \----------------> 4c 89 e7             	mov    %r12,%rdi
+    2fc6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  |                                          48 89 74 24 08       	mov    %rsi,0x8(%rsp)
+    2fcb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  |                                          e8 b0 f0 ff ff       	call   2080 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)>
+    if (truncated && !(b == compute_float(q, w + 1))) {
+    2fd0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  |                                          48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    2fd5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  |                                          4c 89 e7             	mov    %r12,%rdi
+    Binary const b = compute_float(q, w);
+    2fd8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  |                                          48 89 c5             	mov    %rax,%rbp
+    2fdb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  |                                          48 89 d3             	mov    %rdx,%rbx
+    if (truncated && !(b == compute_float(q, w + 1))) {
+    2fde:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  |                                          48 83 c6 01          	add    $0x1,%rsi
+    2fe2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  |                                          e8 99 f0 ff ff       	call   2080 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)>
+    2fe7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  |                                          48 89 c1             	mov    %rax,%rcx
+            return mantissa == o.mantissa && power2 == o.power2;
+    2fea:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  |                                          48 39 cd             	cmp    %rcx,%rbp
+    2fed:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  |  /-------------------------------------- 0f 84 5c 03 00 00    	je     334f <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xb9f>
+        double const d = slow_path(ds, e - (long long int)(frac_e - frac_b));
+    2ff3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  |  |  /----------------------------------> 48 8b 34 24          	mov    (%rsp),%rsi
+    2ff7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  |  |  |                                    48 8d 7c 24 40       	lea    0x40(%rsp),%rdi
+    2ffc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  |     |  |  |  |  |  |  |                                    e8 8f ee ff ff       	call   1e90 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)>
+    3001:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  |     |  +-----|--|--|--|--|--|--|----------------------------------- e9 9c fd ff ff       	jmp    2da2 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x5f2>
+        Index j = i + 1;
+    3006:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |  \-----|--|-----|--|--|--|--|--|--|----------------------------------> 48 8d 56 01          	lea    0x1(%rsi),%rdx
+    300a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                    c6 44 24 3f 00       	movb   $0x0,0x3f(%rsp)
+        bool const e_neg = j < n && p[j] == '-';
+    300f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                    48 8d 3c 10          	lea    (%rax,%rdx,1),%rdi
+        Index j = i + 1;
+    3013:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                    48 89 54 24 10       	mov    %rdx,0x10(%rsp)
+        bool const e_neg = j < n && p[j] == '-';
+    3018:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                    48 89 7c 24 08       	mov    %rdi,0x8(%rsp)
+    301d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                    4c 39 c2             	cmp    %r8,%rdx
+    3020:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                /-- 73 29                	jae    304b <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x89b>
+    3022:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                |   0f b6 17             	movzbl (%rdi),%edx
+        if (j < n && (p[j] == '-' || p[j] == '+')) { j += 1; }
+    3025:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                |   44 8d 4a d5          	lea    -0x2b(%rdx),%r9d
+    3029:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                |   41 81 e1 fd 00 00 00 	and    $0xfd,%r9d
+    3030:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                +-- 75 19                	jne    304b <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x89b>
+        bool const e_neg = j < n && p[j] == '-';
+    3032:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                |   80 fa 2d             	cmp    $0x2d,%dl
+        if (j < n && (p[j] == '-' || p[j] == '+')) { j += 1; }
+    3035:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                |   48 8d 7e 02          	lea    0x2(%rsi),%rdi
+    3039:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                |   48 89 7c 24 10       	mov    %rdi,0x10(%rsp)
+        bool const e_neg = j < n && p[j] == '-';
+    303e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                |   0f 94 44 24 3f       	sete   0x3f(%rsp)
+        Index const e_end = j + digit_run(p + j, n - j);
+    3043:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                |   48 01 c7             	add    %rax,%rdi
+    3046:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                |   48 89 7c 24 08       	mov    %rdi,0x8(%rsp)
+    304b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                \-> 48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    3050:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                    4c 89 c2             	mov    %r8,%rdx
+    3053:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                    48 89 6c 24 20       	mov    %rbp,0x20(%rsp)
+    Index i = 0;
+    3058:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                    45 31 ed             	xor    %r13d,%r13d
+    305b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                    48 89 4c 24 28       	mov    %rcx,0x28(%rsp)
+        Index const e_end = j + digit_run(p + j, n - j);
+    3060:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                    48 29 fa             	sub    %rdi,%rdx
+    3063:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                    48 89 44 24 30       	mov    %rax,0x30(%rsp)
+    3068:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                    48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    306d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                    48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+    while (i + 8 <= n) {
+    3072:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                                    48 89 d5             	mov    %rdx,%rbp
+    3075:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                             /----- eb 3e                	jmp    30b5 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x905>
+    3077:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                             |      66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    307e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                             |      00 00 
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    3080:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                             |  /-> 48 b8 d0 cf cf cf cf 	movabs $0xcfcfcfcfcfcfcfd0,%rax
+    3087:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                             |  |   cf cf cf 
+    __builtin_memcpy(&v, p, sizeof(v));
+    308a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                             |  |   4a 8b 4c 2f f8       	mov    -0x8(%rdi,%r13,1),%rcx
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    308f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                             |  |   48 ba 46 46 46 46 46 	movabs $0x4646464646464646,%rdx
+    3096:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                             |  |   46 46 46 
+    3099:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                             |  |   48 01 ca             	add    %rcx,%rdx
+    309c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                             |  |   48 01 c1             	add    %rax,%rcx
+        if (m != 0) { return i + Length(__builtin_ctzll(m) / 8); }
+    309f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                             |  |   48 b8 80 80 80 80 80 	movabs $0x8080808080808080,%rax
+    30a6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                             |  |   80 80 80 
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    30a9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                             |  |   48 09 ca             	or     %rcx,%rdx
+        if (m != 0) { return i + Length(__builtin_ctzll(m) / 8); }
+    30ac:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |                             |  |   48 21 c2             	and    %rax,%rdx
+    30af:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |        /--------------------|--|-- 0f 85 6b 02 00 00    	jne    3320 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xb70>
+    while (i + 8 <= n) {
+    30b5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |        |                    \--|-> 4d 89 e9             	mov    %r13,%r9
+    30b8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |        |                       |   49 83 c5 08          	add    $0x8,%r13
+    30bc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |        |                       |   4c 39 ed             	cmp    %r13,%rbp
+    30bf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |        |                       \-- 73 bf                	jae    3080 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x8d0>
+    while (i < n && is_digit(p[i])) {
+    30c1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |        |                           48 8b 54 24 18       	mov    0x18(%rsp),%rdx
+    30c6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |        |                           48 8b 6c 24 20       	mov    0x20(%rsp),%rbp
+    30cb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |        |                           48 8b 4c 24 28       	mov    0x28(%rsp),%rcx
+    30d0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |        |                           48 8b 44 24 30       	mov    0x30(%rsp),%rax
+    30d5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |        |                           49 39 d1             	cmp    %rdx,%r9
+    30d8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  /-----|-------------------------- 0f 83 ee 02 00 00    	jae    33cc <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xc1c>
+    return (unsigned char)(c - '0') < 10;
+    30de:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |     |                           48 89 7c 24 08       	mov    %rdi,0x8(%rsp)
+    30e3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |     |                           42 0f b6 3c 0f       	movzbl (%rdi,%r9,1),%edi
+    30e8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |     |                           8d 57 d0             	lea    -0x30(%rdi),%edx
+    while (i < n && is_digit(p[i])) {
+    30eb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |     |                           80 fa 09             	cmp    $0x9,%dl
+    30ee:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  +-----|-------------------------- 0f 87 d8 02 00 00    	ja     33cc <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xc1c>
+    30f4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |     |                           48 8b 54 24 18       	mov    0x18(%rsp),%rdx
+        i += 1;
+    30f9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |     |                           49 8d 79 01          	lea    0x1(%r9),%rdi
+    30fd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |     |                           48 89 7c 24 20       	mov    %rdi,0x20(%rsp)
+    while (i < n && is_digit(p[i])) {
+    3102:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |     |                           48 39 d7             	cmp    %rdx,%rdi
+    3105:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  /--|-------------------------- 0f 83 95 02 00 00    	jae    33a0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbf0>
+    return (unsigned char)(c - '0') < 10;
+    310b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    3110:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           42 0f b6 7c 0f 01    	movzbl 0x1(%rdi,%r9,1),%edi
+    3116:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           8d 57 d0             	lea    -0x30(%rdi),%edx
+    while (i < n && is_digit(p[i])) {
+    3119:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           80 fa 09             	cmp    $0x9,%dl
+    311c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  +--|-------------------------- 0f 87 7e 02 00 00    	ja     33a0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbf0>
+    3122:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 8b 54 24 18       	mov    0x18(%rsp),%rdx
+        i += 1;
+    3127:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           49 8d 79 02          	lea    0x2(%r9),%rdi
+    312b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 89 7c 24 20       	mov    %rdi,0x20(%rsp)
+    while (i < n && is_digit(p[i])) {
+    3130:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 39 d7             	cmp    %rdx,%rdi
+    3133:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  +--|-------------------------- 0f 83 67 02 00 00    	jae    33a0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbf0>
+    return (unsigned char)(c - '0') < 10;
+    3139:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    313e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           42 0f b6 7c 0f 02    	movzbl 0x2(%rdi,%r9,1),%edi
+    3144:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           8d 57 d0             	lea    -0x30(%rdi),%edx
+    while (i < n && is_digit(p[i])) {
+    3147:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           80 fa 09             	cmp    $0x9,%dl
+    314a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  +--|-------------------------- 0f 87 50 02 00 00    	ja     33a0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbf0>
+    3150:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 8b 54 24 18       	mov    0x18(%rsp),%rdx
+        i += 1;
+    3155:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           49 8d 79 03          	lea    0x3(%r9),%rdi
+    3159:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 89 7c 24 20       	mov    %rdi,0x20(%rsp)
+    while (i < n && is_digit(p[i])) {
+    315e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 39 d7             	cmp    %rdx,%rdi
+    3161:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  +--|-------------------------- 0f 83 39 02 00 00    	jae    33a0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbf0>
+    return (unsigned char)(c - '0') < 10;
+    3167:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    316c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           42 0f b6 7c 0f 03    	movzbl 0x3(%rdi,%r9,1),%edi
+    3172:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           8d 57 d0             	lea    -0x30(%rdi),%edx
+    while (i < n && is_digit(p[i])) {
+    3175:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           80 fa 09             	cmp    $0x9,%dl
+    3178:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  +--|-------------------------- 0f 87 22 02 00 00    	ja     33a0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbf0>
+    317e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 8b 54 24 18       	mov    0x18(%rsp),%rdx
+        i += 1;
+    3183:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           49 8d 79 04          	lea    0x4(%r9),%rdi
+    3187:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 89 7c 24 20       	mov    %rdi,0x20(%rsp)
+    while (i < n && is_digit(p[i])) {
+    318c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 39 d7             	cmp    %rdx,%rdi
+    318f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  +--|-------------------------- 0f 83 0b 02 00 00    	jae    33a0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbf0>
+    return (unsigned char)(c - '0') < 10;
+    3195:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    319a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           42 0f b6 7c 0f 04    	movzbl 0x4(%rdi,%r9,1),%edi
+    31a0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           8d 57 d0             	lea    -0x30(%rdi),%edx
+    while (i < n && is_digit(p[i])) {
+    31a3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           80 fa 09             	cmp    $0x9,%dl
+    31a6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  +--|-------------------------- 0f 87 f4 01 00 00    	ja     33a0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbf0>
+    31ac:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 8b 54 24 18       	mov    0x18(%rsp),%rdx
+        i += 1;
+    31b1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           49 8d 79 05          	lea    0x5(%r9),%rdi
+    31b5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 89 7c 24 20       	mov    %rdi,0x20(%rsp)
+    while (i < n && is_digit(p[i])) {
+    31ba:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 39 d7             	cmp    %rdx,%rdi
+    31bd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  +--|-------------------------- 0f 83 dd 01 00 00    	jae    33a0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbf0>
+    return (unsigned char)(c - '0') < 10;
+    31c3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    31c8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           42 0f b6 7c 0f 05    	movzbl 0x5(%rdi,%r9,1),%edi
+    31ce:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           8d 57 d0             	lea    -0x30(%rdi),%edx
+    while (i < n && is_digit(p[i])) {
+    31d1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           80 fa 09             	cmp    $0x9,%dl
+    31d4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  +--|-------------------------- 0f 87 c6 01 00 00    	ja     33a0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbf0>
+    31da:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 8b 54 24 18       	mov    0x18(%rsp),%rdx
+        i += 1;
+    31df:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           49 8d 79 06          	lea    0x6(%r9),%rdi
+    31e3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 89 7c 24 20       	mov    %rdi,0x20(%rsp)
+    while (i < n && is_digit(p[i])) {
+    31e8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 39 d7             	cmp    %rdx,%rdi
+    31eb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  +--|-------------------------- 0f 83 af 01 00 00    	jae    33a0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbf0>
+    return (unsigned char)(c - '0') < 10;
+    31f1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    31f6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           42 0f b6 7c 0f 06    	movzbl 0x6(%rdi,%r9,1),%edi
+    31fc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           8d 57 d0             	lea    -0x30(%rdi),%edx
+    while (i < n && is_digit(p[i])) {
+    31ff:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           80 fa 09             	cmp    $0x9,%dl
+    3202:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  +--|-------------------------- 0f 87 98 01 00 00    	ja     33a0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbf0>
+    3208:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 8b 7c 24 18       	mov    0x18(%rsp),%rdi
+        i += 1;
+    320d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           49 8d 51 07          	lea    0x7(%r9),%rdx
+    while (i < n && is_digit(p[i])) {
+    3211:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |                           48 39 fa             	cmp    %rdi,%rdx
+    3214:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |  /----------------------- 0f 83 ba 01 00 00    	jae    33d4 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xc24>
+    return (unsigned char)(c - '0') < 10;
+    321a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |  |                        48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    321f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |  |                        42 0f b6 7c 0f 07    	movzbl 0x7(%rdi,%r9,1),%edi
+    3225:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |  |                        83 ef 30             	sub    $0x30,%edi
+        i += 1;
+    3228:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |  |                        40 80 ff 0a          	cmp    $0xa,%dil
+    322c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |  |                        4c 0f 43 ea          	cmovae %rdx,%r13
+        Index const e_end = j + digit_run(p + j, n - j);
+    3230:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |  |  /-------------------> 48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    3235:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |  |  |                     49 01 fd             	add    %rdi,%r13
+        if (e_end > j) {
+    3238:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |  |  |                     4c 39 ef             	cmp    %r13,%rdi
+    323b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |  |  |                 /-- 0f 82 9e 00 00 00    	jb     32df <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xb2f>
+    3241:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |  |  |                 |   49 89 f5             	mov    %rsi,%r13
+    long long int e = 0;
+    3244:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |        |  |     |  |  |  |  |  |  |  |  |  |  |  |                 |   45 31 c9             	xor    %r9d,%r9d
+    3247:	|  |  |  |  +--|--|--|--|--|--|--|--|--|--|-----|-----|--|--------|--|-----|--|--|--|--|--|--|--|--|--|--|--|-----------------|-- e9 59 f7 ff ff       	jmp    29a5 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x1f5>
+        if (m != 0) { return i + Length(__builtin_ctzll(m) / 8); }
+    324c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     \--|--------|--|-----|--|--|--|--|--|--|--|--|--|--|--|-----------------|-> f3 48 0f bc d2       	tzcnt  %rdx,%rdx
+    3251:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |        |  |     |  |  |  |  |  |  |  |  |  |  |  |                 |   48 8b 04 24          	mov    (%rsp),%rax
+    3255:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |        |  |     |  |  |  |  |  |  |  |  |  |  |  |                 |   c1 fa 03             	sar    $0x3,%edx
+    3258:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |        |  |     |  |  |  |  |  |  |  |  |  |  |  |                 |   4c 63 e2             	movslq %edx,%r12
+    325b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |        |  |     |  |  |  |  |  |  |  |  |  |  |  |                 |   4d 01 cc             	add    %r9,%r12
+        frac_e = frac_b + digit_run(p + frac_b, n - frac_b);
+    325e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |        |  |     |  |  |  |  |  |  |  |  |  |  |  |  /--------------|-> 4f 8d 2c 23          	lea    (%r11,%r12,1),%r13
+    if (int_e == int_b && frac_e == frac_b) { return R::Err(ParseError::InvalidDigit); }
+    3262:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |        |  |     |  |  |  |  |  |  |  |  |  |  |  |  |              |   4d 39 eb             	cmp    %r13,%r11
+    3265:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  +-----|--------|--------|--|-----|--|--|--|--|--|--|--|--|--|--|--|--|--------------|-- 0f 85 4f fa ff ff    	jne    2cba <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x50a>
+    326b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |        |  |     |  |  |  |  |  |  |  |  |  |  |  |  |              |   48 39 cd             	cmp    %rcx,%rbp
+    326e:	|  |  |  |  |  \--|--|--|--|--|--|--|--|--|-----|--------|--------|--|-----|--|--|--|--|--|--|--|--|--|--|--|--|--------------|-- 0f 84 7c f8 ff ff    	je     2af0 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x340>
+    3274:	|  |  |  |  |     |  |  |  |  |  |  |  |  +-----|--------|--------|--|-----|--|--|--|--|--|--|--|--|--|--|--|--|--------------|-- e9 41 fa ff ff       	jmp    2cba <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x50a>
+    3279:	|  |  |  |  |     |  |  |  |  |  |  |  |  |     |        |        |  |     |  |  |  |  |  |  |  |  |  |  |  |  |              |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    Digits const ds = {p + a, int_e - a, p + f, frac_e - f};
+    3280:	|  |  |  |  |     |  |  |  |  |  |  |  |  |     |        |        |  |     \--|--|--|--|--|--|--|--|--|--|--|--|--------------|-> 4e 8d 14 18          	lea    (%rax,%r11,1),%r10
+    3284:	|  |  |  |  |     |  |  |  |  |  |  |  |  |     |        |        |  |        |  |  |  |  |  |  |  |  |  |  |  |              |   49 89 d9             	mov    %rbx,%r9
+    3287:	|  |  |  |  |     |  |  |  |  |  |  |  |  |     |        |        |  |        |  |  |  |  |  |  |  |  |  |  |  |              |   45 31 e4             	xor    %r12d,%r12d
+    328a:	|  |  |  |  |     |  |  \--|--|--|--|--|--|-----|--------|--------|--|--------|--|--|--|--|--|--|--|--|--|--|--|--------------|-- e9 57 f7 ff ff       	jmp    29e6 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x236>
+    if (!truncated && w <= (1ULL << 53) && q >= -22 && q <= 22) {
+    328f:	|  |  |  |  |     |  |     |  |  |  |  |  |     |        |        |  |        |  \--|--|--|--|--|--|--|--|--|--|--------------|-> 48 b8 00 00 00 00 00 	movabs $0x20000000000000,%rax
+    3296:	|  |  |  |  |     |  |     |  |  |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |              |   00 20 00 
+    3299:	|  |  |  |  |     |  |     |  |  |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |              |   48 39 f0             	cmp    %rsi,%rax
+    329c:	|  |  |  |  |     |  |     |  |  |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  /-----------|-- 0f 83 50 01 00 00    	jae    33f2 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xc42>
+    Binary const b = compute_float(q, w);
+    32a2:	|  |  |  |  |     |  |     |  |  |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |           |   4c 89 e7             	mov    %r12,%rdi
+    32a5:	|  |  |  |  |     |  |     |  |  |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |           |   e8 d6 ed ff ff       	call   2080 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)>
+    32aa:	|  |  |  |  |     |  |     |  |  |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |           |   48 89 c5             	mov    %rax,%rbp
+    32ad:	|  |  |  |  |     |  |     |  |  |  |  |  |     |        |        |  |        +-----|--|--|--|--|--|--|--|--|--|--|-----------|-- e9 70 fc ff ff       	jmp    2f22 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x772>
+            return R::Ok(Pair<double, Length>{neg ? -__builtin_inf() : __builtin_inf(), i + 3});
+    32b2:	|  |  |  |  |     |  |     |  \--|--|--|--|-----|--------|--------|--|--------|-----|--|--|--|--|--|--|--|--|--|--|-----------|-> 80 7c 24 3e 2d       	cmpb   $0x2d,0x3e(%rsp)
+    32b7:	|  |  |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |     /-----|-- 0f 84 ed 00 00 00    	je     33aa <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xbfa>
+    32bd:	|  |  |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |     |     |   f2 0f 10 05 83 38 00 	movsd  0x3883(%rip),%xmm0        # 6b48 <nel::(anonymous namespace)::pow10_u64+0xa8>
+    32c4:	|  |  |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |     |     |   00 
+            return R::Ok(Pair<double, Length>{neg ? -__builtin_nan("") : __builtin_nan(""), i + 3});
+    32c5:	|  |  |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  /--|-----|-> 48 83 c5 03          	add    $0x3,%rbp
+    32c9:	|  |  |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |     |   41 c7 06 01 00 00 00 	movl   $0x1,(%r14)
+    32d0:	|  |  |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |     |   49 89 6e 10          	mov    %rbp,0x10(%r14)
+    32d4:	|  |  |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |     |   f2 41 0f 11 46 08    	movsd  %xmm0,0x8(%r14)
+    32da:	|  \--|--|--|-----|--|-----|-----|--|--|--|-----|--------|--------|--|--------|-----|--|--|--|--|--|--|--|--|--|--|--|--|-----|-- e9 fb f4 ff ff       	jmp    27da <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x2a>
+    long long int e = 0;
+    32df:	|     |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |     \-> 45 31 c9             	xor    %r9d,%r9d
+                if (e < (1LL << 40)) { e = e * 10 + (p[j] - '0'); }
+    32e2:	|     |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |  /----> 0f b6 14 38          	movzbl (%rax,%rdi,1),%edx
+    32e6:	|     |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |  |      4f 8d 0c 89          	lea    (%r9,%r9,4),%r9
+            for (; j < e_end; ++j) {
+    32ea:	|     |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 83 c7 01          	add    $0x1,%rdi
+                if (e < (1LL << 40)) { e = e * 10 + (p[j] - '0'); }
+    32ee:	|     |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |  |      83 ea 30             	sub    $0x30,%edx
+    32f1:	|     |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 63 d2             	movslq %edx,%rdx
+    32f4:	|     |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |  |      4e 8d 0c 4a          	lea    (%rdx,%r9,2),%r9
+            for (; j < e_end; ++j) {
+    32f8:	|     |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |  |      49 39 fd             	cmp    %rdi,%r13
+    32fb:	|     |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-- 74 0f                	je     330c <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xb5c>
+                if (e < (1LL << 40)) { e = e * 10 + (p[j] - '0'); }
+    32fd:	|     |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 ba ff ff ff ff ff 	movabs $0xffffffffff,%rdx
+    3304:	|     |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   00 00 00 
+    3307:	|     |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   49 39 d1             	cmp    %rdx,%r9
+    330a:	|     |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |  \--|-- 7e d6                	jle    32e2 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xb32>
+            e = e_neg ? -e : e;
+    330c:	|     |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |     \-> 4c 89 ca             	mov    %r9,%rdx
+    330f:	|     |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |         48 f7 da             	neg    %rdx
+    3312:	|     |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |         80 7c 24 3f 00       	cmpb   $0x0,0x3f(%rsp)
+    3317:	|     |  |  |     |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  |  |  |  |  |  |  |         4c 0f 45 ca          	cmovne %rdx,%r9
+    331b:	|     |  |  \-----|--|-----|-----|--|--|--|-----|--------|--------|--|--------|-----|--|--|--|--|--|--|--|--|--|--|--|--|-------- e9 85 f6 ff ff       	jmp    29a5 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x1f5>
+        if (m != 0) { return i + Length(__builtin_ctzll(m) / 8); }
+    3320:	|     |  |        |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |  \--|--|--|--|--|--|-------> f3 48 0f bc d2       	tzcnt  %rdx,%rdx
+    3325:	|     |  |        |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |     |  |  |  |  |  |         48 8b 6c 24 20       	mov    0x20(%rsp),%rbp
+    332a:	|     |  |        |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |     |  |  |  |  |  |         48 8b 4c 24 28       	mov    0x28(%rsp),%rcx
+    332f:	|     |  |        |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |     |  |  |  |  |  |         c1 fa 03             	sar    $0x3,%edx
+    3332:	|     |  |        |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |     |  |  |  |  |  |         48 8b 44 24 30       	mov    0x30(%rsp),%rax
+    3337:	|     |  |        |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |     |  |  |  |  |  |         4c 63 ea             	movslq %edx,%r13
+    333a:	|     |  |        |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |     |  |  |  |  |  |         4d 01 cd             	add    %r9,%r13
+    333d:	|     |  |        |  |     |     |  |  |  |     |        |        |  |        |     |  |  |  |  |  |     |  +--|--|--|--|-------- e9 ee fe ff ff       	jmp    3230 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xa80>
+            return R::Ok(Pair<double, Length>{neg ? -__builtin_inf() : __builtin_inf(), i + 8});
+    3342:	|     |  |        |  |     |     |  |  |  |     |        |        |  |        |     \--|--|--|--|--|-----|--|--|--|--|--|-------> f2 0f 10 05 f6 37 00 	movsd  0x37f6(%rip),%xmm0        # 6b40 <nel::(anonymous namespace)::pow10_u64+0xa0>
+    3349:	|     |  |        |  |     |     |  |  |  |     |        |        |  |        |        |  |  |  |  |     |  |  |  |  |  |         00 
+    334a:	|     |  |        |  |     |     |  |  |  |     |        |        |  |        |        \--|--|--|--|-----|--|--|--|--|--|-------- e9 5a fc ff ff       	jmp    2fa9 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x7f9>
+            return mantissa == o.mantissa && power2 == o.power2;
+    334f:	|     |  |        |  |     |     |  |  |  |     |        |        |  |        |           \--|--|--|-----|--|--|--|--|--|-------> 39 da                	cmp    %ebx,%edx
+    3351:	|     |  |        |  |     |     |  |  |  |     |        |        |  |        |              \--|--|-----|--|--|--|--|--|-------- 0f 85 9c fc ff ff    	jne    2ff3 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x843>
+    3357:	|     |  |        |  |     |     |  |  |  |     |        |        |  |        \-----------------|--|-----|--|--|--|--|--|-------- e9 c6 fb ff ff       	jmp    2f22 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x772>
+    while (i < n && is_digit(p[i])) {
+    335c:	|     \--|--------|--|-----|-----|--|--|--|-----|--------|--------|--|--------------------------|--|-----|--|--|--|--|--|-------> 48 89 f3             	mov    %rsi,%rbx
+    335f:	|        |        |  |     \-----|--|--|--|-----|--------|--------|--|--------------------------|--|-----|--|--|--|--|--|-------- e9 b6 f7 ff ff       	jmp    2b1a <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x36a>
+        d = (q < 0) ? d / pow10_f64[-q] : d * pow10_f64[q];
+    3364:	|        |        |  |           |  |  |  |     |        |        \--|--------------------------|--|-----|--|--|--|--|--|-------> 48 f7 df             	neg    %rdi
+    3367:	|        |        |  |           |  |  |  |     |        |           |                          |  |     |  |  |  |  |  |         48 8d 05 72 36 00 00 	lea    0x3672(%rip),%rax        # 69e0 <nel::(anonymous namespace)::pow10_f64>
+    336e:	|        |        |  |           |  |  |  |     |        |           |                          |  |     |  |  |  |  |  |         f2 0f 5e 04 f8       	divsd  (%rax,%rdi,8),%xmm0
+    3373:	|        |        |  |           |  |  |  |     |        |           \--------------------------|--|-----|--|--|--|--|--|-------- e9 2a fa ff ff       	jmp    2da2 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x5f2>
+            return R::Ok(Pair<double, Length>{neg ? -__builtin_nan("") : __builtin_nan(""), i + 3});
+    3378:	|        |        |  \-----------|--|--|--|-----|--------|--------------------------------------|--|-----|--|--|--|--|--|-------> 80 7c 24 3e 2d       	cmpb   $0x2d,0x3e(%rsp)
+    337d:	|        |        |              |  |  |  |     |        |                                      |  |     |  |  |  |  |  |     /-- 74 40                	je     33bf <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xc0f>
+    337f:	|        |        |              |  |  |  |     |        |                                      |  |     |  |  |  |  |  |     |   f2 0f 10 05 d1 37 00 	movsd  0x37d1(%rip),%xmm0        # 6b58 <nel::(anonymous namespace)::pow10_u64+0xb8>
+    3386:	|        |        |              |  |  |  |     |        |                                      |  |     |  |  |  |  |  |     |   00 
+    3387:	|        |        |              |  |  |  |     |        |                                      |  |     |  |  |  |  +--|-----|-- e9 39 ff ff ff       	jmp    32c5 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xb15>
+        i += 1;
+    338c:	|        |        |              |  \--|--|-----|--------|--------------------------------------|--|-----|--|--|--|--|--|-----|-> 49 89 d4             	mov    %rdx,%r12
+    338f:	|        |        |              |     |  |     \--------|--------------------------------------|--|-----|--|--|--|--|--|-----|-- e9 22 f9 ff ff       	jmp    2cb6 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x506>
+        frac_e = frac_b + digit_run(p + frac_b, n - frac_b);
+    3394:	|        |        |              |     \--|--------------|--------------------------------------|--|-----|--|--|--|--|--|-----|-> 4d 8d 2c 13          	lea    (%r11,%rdx,1),%r13
+        i += 1;
+    3398:	|        |        |              |        |              |                                      |  |     |  |  |  |  |  |     |   49 89 d4             	mov    %rdx,%r12
+    339b:	|        |        |              |        \--------------|--------------------------------------|--|-----|--|--|--|--|--|-----|-- e9 1a f9 ff ff       	jmp    2cba <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x50a>
+    33a0:	|        |        |              |                       |                                      |  \-----|--|--|--|--|--|-----|-> 4c 8b 6c 24 20       	mov    0x20(%rsp),%r13
+    33a5:	|        |        |              |                       |                                      |        |  +--|--|--|--|-----|-- e9 86 fe ff ff       	jmp    3230 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xa80>
+            return R::Ok(Pair<double, Length>{neg ? -__builtin_inf() : __builtin_inf(), i + 3});
+    33aa:	|        |        |              |                       |                                      |        |  |  |  |  |  \-----|-> f2 0f 10 05 8e 37 00 	movsd  0x378e(%rip),%xmm0        # 6b40 <nel::(anonymous namespace)::pow10_u64+0xa0>
+    33b1:	|        |        |              |                       |                                      |        |  |  |  |  |        |   00 
+        constexpr Result(Phantom<Tag::OK> const, T &&v)
+    33b2:	|        |        |              |                       |                                      |        |  |  |  |  +--------|-- e9 0e ff ff ff       	jmp    32c5 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xb15>
+    while (i < n && is_digit(p[i])) {
+    33b7:	|        |        |              \-----------------------|--------------------------------------|--------|--|--|--|--|--------|-> 4d 89 cc             	mov    %r9,%r12
+    33ba:	|        |        |                                      |                                      |        |  |  \--|--|--------|-- e9 9f fe ff ff       	jmp    325e <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xaae>
+            return R::Ok(Pair<double, Length>{neg ? -__builtin_nan("") : __builtin_nan(""), i + 3});
+    33bf:	|        |        |                                      |                                      |        |  |     |  |        \-> f2 0f 10 05 89 37 00 	movsd  0x3789(%rip),%xmm0        # 6b50 <nel::(anonymous namespace)::pow10_u64+0xb0>
+    33c6:	|        |        |                                      |                                      |        |  |     |  |            00 
+    33c7:	|        |        |                                      |                                      |        |  |     |  \----------- e9 f9 fe ff ff       	jmp    32c5 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xb15>
+    while (i < n && is_digit(p[i])) {
+    33cc:	|        |        |                                      |                                      \--------|--|-----|-------------> 4d 89 cd             	mov    %r9,%r13
+    33cf:	|        |        |                                      |                                               |  +-----|-------------- e9 5c fe ff ff       	jmp    3230 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xa80>
+        i += 1;
+    33d4:	|        |        |                                      |                                               \--|-----|-------------> 49 89 d5             	mov    %rdx,%r13
+    33d7:	|        |        |                                      |                                                  \-----|-------------- e9 54 fe ff ff       	jmp    3230 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xa80>
+    Index const int_e = int_b + digit_run(p + int_b, n - int_b);
+    33dc:	\--------|--------|--------------------------------------|--------------------------------------------------------|-------------> 4a 8d 4c 0d 00       	lea    0x0(%rbp,%r9,1),%rcx
+        i += 1;
+    33e1:	         |        |                                      |                                                        |               4c 89 cb             	mov    %r9,%rbx
+    if (int_e < n && p[int_e] == '.') {
+    33e4:	         |        |                                      |                                                        |               4c 39 c1             	cmp    %r8,%rcx
+    33e7:	         \--------|--------------------------------------|--------------------------------------------------------|-------------- 0f 82 7b f5 ff ff    	jb     2968 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x1b8>
+    33ed:	                  \--------------------------------------|--------------------------------------------------------|-------------- e9 3b f7 ff ff       	jmp    2b2d <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x37d>
+    if (!truncated && w <= (1ULL << 53) && q >= -22 && q <= 22) {
+    33f2:	                                                         |                                                        \-------------> 4c 89 24 24          	mov    %r12,(%rsp)
+    33f6:	                                                         \----------------------------------------------------------------------- e9 77 f9 ff ff       	jmp    2d72 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x5c2>
+
+Disassembly of section .fini:
+
+00000000000033fc <_fini>:
+    33fc:	48 83 ec 08          	sub    $0x8,%rsp
+    3400:	48 83 c4 08          	add    $0x8,%rsp
+    3404:	c3                   	ret
@@ -0,0 +1,2651 @@
+
+target/fast/examples/bench_poison:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 cd 3f 00 00 	mov    0x3fcd(%rip),%rax        # 4fd8 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <memcmp@plt-0x10>:
+    1020:	ff 35 ca 3f 00 00    	push   0x3fca(%rip)        # 4ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 3f 00 00    	jmp    *0x3fcc(%rip)        # 4ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <memcmp@plt>:
+    1030:	ff 25 ca 3f 00 00    	jmp    *0x3fca(%rip)        # 5000 <memcmp@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <memset@plt>:
+    1040:	ff 25 c2 3f 00 00    	jmp    *0x3fc2(%rip)        # 5008 <memset@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <abort@plt>:
+    1050:	ff 25 ba 3f 00 00    	jmp    *0x3fba(%rip)        # 5010 <abort@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memcpy@plt>:
+    1060:	ff 25 b2 3f 00 00    	jmp    *0x3fb2(%rip)        # 5018 <memcpy@GLIBC_2.14>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <clock_gettime@plt>:
+    1070:	ff 25 aa 3f 00 00    	jmp    *0x3faa(%rip)        # 5020 <clock_gettime@GLIBC_2.17>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <operator new(unsigned long)@plt>:
+    1080:	ff 25 a2 3f 00 00    	jmp    *0x3fa2(%rip)        # 5028 <operator new(unsigned long)@GLIBCXX_3.4>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <operator delete(void*, unsigned long)@plt>:
+    1090:	ff 25 9a 3f 00 00    	jmp    *0x3f9a(%rip)        # 5030 <operator delete(void*, unsigned long)@CXXABI_1.3.9>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <fputs@plt>:
+    10a0:	ff 25 92 3f 00 00    	jmp    *0x3f92(%rip)        # 5038 <fputs@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <free@plt>:
+    10b0:	ff 25 8a 3f 00 00    	jmp    *0x3f8a(%rip)        # 5040 <free@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <fputc@plt>:
+    10c0:	ff 25 82 3f 00 00    	jmp    *0x3f82(%rip)        # 5048 <fputc@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <malloc@plt>:
+    10d0:	ff 25 7a 3f 00 00    	jmp    *0x3f7a(%rip)        # 5050 <malloc@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010e0 <fprintf@plt>:
+    10e0:	ff 25 72 3f 00 00    	jmp    *0x3f72(%rip)        # 5058 <fprintf@GLIBC_2.2.5>
+    10e6:	68 0b 00 00 00       	push   $0xb
+    10eb:	e9 30 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010f0 <memmove@plt>:
+    10f0:	ff 25 6a 3f 00 00    	jmp    *0x3f6a(%rip)        # 5060 <memmove@GLIBC_2.2.5>
+    10f6:	68 0c 00 00 00       	push   $0xc
+    10fb:	e9 20 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001100 <realloc@plt>:
+    1100:	ff 25 62 3f 00 00    	jmp    *0x3f62(%rip)        # 5068 <realloc@GLIBC_2.2.5>
+    1106:	68 0d 00 00 00       	push   $0xd
+    110b:	e9 10 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+0000000000001110 <__cxa_finalize@plt>:
+    1110:	ff 25 aa 3e 00 00    	jmp    *0x3eaa(%rip)        # 4fc0 <__cxa_finalize@GLIBC_2.2.5>
+    1116:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+0000000000001120 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    1120:	50                   	push   %rax
+    std::abort();
+    1121:	e8 2a ff ff ff       	call   1050 <abort@plt>
+
+0000000000001126 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    1126:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    1127:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    112a:	4c 8d 0d ff 1f 00 00 	lea    0x1fff(%rip),%r9        # 3130 <_IO_stdin_used+0x130>
+    1131:	31 c0                	xor    %eax,%eax
+    1133:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    1137:	4c 8b 07             	mov    (%rdi),%r8
+    113a:	48 8d 35 f5 1f 00 00 	lea    0x1ff5(%rip),%rsi        # 3136 <_IO_stdin_used+0x136>
+    1141:	48 8b 3d 38 3f 00 00 	mov    0x3f38(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1148:	e8 93 ff ff ff       	call   10e0 <fprintf@plt>
+    std::abort();
+    114d:	e8 fe fe ff ff       	call   1050 <abort@plt>
+
+0000000000001152 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1152:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1156:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1159:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    115d:	31 c0                	xor    %eax,%eax
+    115f:	57                   	push   %rdi
+    1160:	48 8b 3d 19 3f 00 00 	mov    0x3f19(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1167:	4c 8d 0d c2 1f 00 00 	lea    0x1fc2(%rip),%r9        # 3130 <_IO_stdin_used+0x130>
+    116e:	4c 8b 06             	mov    (%rsi),%r8
+    1171:	48 8d 35 cf 1f 00 00 	lea    0x1fcf(%rip),%rsi        # 3147 <_IO_stdin_used+0x147>
+    1178:	e8 63 ff ff ff       	call   10e0 <fprintf@plt>
+    std::abort();
+    117d:	e8 ce fe ff ff       	call   1050 <abort@plt>
+
+0000000000001182 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1182:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1186:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1189:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    118d:	31 c0                	xor    %eax,%eax
+    118f:	57                   	push   %rdi
+    1190:	48 8b 3d e9 3e 00 00 	mov    0x3ee9(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1197:	4c 8d 0d be 1f 00 00 	lea    0x1fbe(%rip),%r9        # 315c <_IO_stdin_used+0x15c>
+    119e:	4c 8b 06             	mov    (%rsi),%r8
+    11a1:	48 8d 35 9f 1f 00 00 	lea    0x1f9f(%rip),%rsi        # 3147 <_IO_stdin_used+0x147>
+    11a8:	e8 33 ff ff ff       	call   10e0 <fprintf@plt>
+    std::abort();
+    11ad:	e8 9e fe ff ff       	call   1050 <abort@plt>
+    11b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    11b9:	00 00 00 
+    11bc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000011c0 <main>:
+    });
+    bench::report(name, t);
+}
+
+int main()
+{
+    11c0:	                                                                                              41 57                	push   %r15
+    11c2:	                                                                                              48 8d 05 76 1e 00 00 	lea    0x1e76(%rip),%rax        # 303f <_IO_stdin_used+0x3f>
+    11c9:	                                                                                              48 8d 15 64 1e 00 00 	lea    0x1e64(%rip),%rdx        # 3034 <_IO_stdin_used+0x34>
+    11d0:	                                                                                              41 56                	push   %r14
+    11d2:	                                                                                              66 48 0f 6e f0       	movq   %rax,%xmm6
+    11d7:	                                                                                              66 48 0f 6e ea       	movq   %rdx,%xmm5
+    11dc:	                                                                                              48 8d 05 7d 1e 00 00 	lea    0x1e7d(%rip),%rax        # 3060 <_IO_stdin_used+0x60>
+    11e3:	                                                                                              41 55                	push   %r13
+    11e5:	                                                                                              66 0f 6c ee          	punpcklqdq %xmm6,%xmm5
+    11e9:	                                                                                              48 8d 15 68 1e 00 00 	lea    0x1e68(%rip),%rdx        # 3058 <_IO_stdin_used+0x58>
+    11f0:	                                                                                              41 be 64 00 00 00    	mov    $0x64,%r14d
+    11f6:	                                                                                              41 54                	push   %r12
+    11f8:	                                                                                              66 48 0f 6e f2       	movq   %rdx,%xmm6
+         * @returns on fail, nullptr, old_n is then untouched and still valid.
+         */
+        static Node *realloc(Node *const old_n, Count const new_cap)
+        {
+            // Too big to address, size_of() would overflow.
+            if (new_cap > max_capacity) { return nullptr; }
+    11fd:	                                                                                              4d 89 f5             	mov    %r14,%r13
+    1200:	                                                                                              55                   	push   %rbp
+    1201:	                                                                                              53                   	push   %rbx
+    1202:	                                                                                              48 81 ec b8 01 00 00 	sub    $0x1b8,%rsp
+    1209:	                                                                                              0f 29 6c 24 30       	movaps %xmm5,0x30(%rsp)
+    120e:	                                                                                              66 48 0f 6e e8       	movq   %rax,%xmm5
+{
+
+inline long unsigned int now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1213:	                                                                                              4c 8d bc 24 a0 00 00 	lea    0xa0(%rsp),%r15
+    121a:	                                                                                              00 
+    121b:	                                                                                              66 0f 6c f5          	punpcklqdq %xmm5,%xmm6
+    121f:	                                                                                              0f 29 74 24 20       	movaps %xmm6,0x20(%rsp)
+    bench_moves();
+    1224:	                                                                                              e8 d7 0c 00 00       	call   1f00 <bench_moves()>
+    1229:	                                                                                              4c 89 fe             	mov    %r15,%rsi
+    122c:	                                                                                              bf 01 00 00 00       	mov    $0x1,%edi
+    1231:	                                                                                              e8 3a fe ff ff       	call   1070 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1236:	                                                                                              48 8b ac 24 a0 00 00 	mov    0xa0(%rsp),%rbp
+    123d:	                                                                                              00 
+    123e:	                                                                                              4c 89 7c 24 68       	mov    %r15,0x68(%rsp)
+    1243:	                                                                                              4c 8b a4 24 a8 00 00 	mov    0xa8(%rsp),%r12
+    124a:	                                                                                              00 
+    124b:	                                                                                              48 89 6c 24 70       	mov    %rbp,0x70(%rsp)
+    1250:	                                                                                              4c 89 64 24 78       	mov    %r12,0x78(%rsp)
+    1255:	                                                                                              0f 1f 00             	nopl   (%rax)
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+        {
+            nel::elem::set(data_, f, N);
+    1258:	                                                                                 /----------> 48 8d 84 24 a4 00 00 	lea    0xa4(%rsp),%rax
+    125f:	                                                                                 |            00 
+    1260:	                                                                                 |            4c 89 6c 24 60       	mov    %r13,0x60(%rsp)
+        }
+
+        // default ctor is ok since it cannot throw.
+        // TODO: but is it 'correct'? i.e. must arrays be created initialised?
+        constexpr Vector(void)
+            : item_(nullptr)
+    1265:	                                                                                 |            31 db                	xor    %ebx,%ebx
+            for (Index i = 0; i < n; ++i) {
+    1267:	                                                                                 |            45 31 ff             	xor    %r15d,%r15d
+    126a:	                                                                                 |            48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    126f:	                                                                                 |            90                   	nop
+    1270:	                                                                                 |     /----> 44 88 7c 24 08       	mov    %r15b,0x8(%rsp)
+         *
+         * @returns the current in use count.
+         */
+        constexpr Length len(void) const
+        {
+            return (item_ == nullptr) ? 0 : item_->len();
+    1275:	                                                                                 |     |      48 85 db             	test   %rbx,%rbx
+    1278:	                                       /-----------------------------------------|-----|----- 0f 84 1a 06 00 00    	je     1898 <main+0x6d8>
+            return alloc_;
+        }
+
+        constexpr Length len(void) const
+        {
+            return len_;
+    127e:	                                       |  /--------------------------------------|-----|----> 4c 8b 63 08          	mov    0x8(%rbx),%r12
+            return alloc_;
+    1282:	                                       |  |                                      |     |      4c 8b 2b             	mov    (%rbx),%r13
+
+    private:
+        // Make room for n more values, only ever grows.
+        bool try_reserve_for(Count const n)
+        {
+            if (len() + n <= capacity()) { return true; }
+    1285:	                                       |  |                                      |     |      49 8d 54 24 01       	lea    0x1(%r12),%rdx
+    128a:	                                       |  |                                      |     |      49 39 d5             	cmp    %rdx,%r13
+    128d:	            /--------------------------|--|--------------------------------------|-----|----- 0f 83 3a 01 00 00    	jae    13cd <main+0x20d>
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            if (cap <= cur) { return cap; }
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    1293:	            |                          |  |                                      |     |      49 83 fd 03          	cmp    $0x3,%r13
+    1297:	            |              /-----------|--|--------------------------------------|-----|----- 0f 87 cb 06 00 00    	ja     1968 <main+0x7a8>
+    129d:	            |              |           |  |                                      |     |      b8 04 00 00 00       	mov    $0x4,%eax
+    12a2:	            |              |           |  |                                      |     |      48 39 c2             	cmp    %rax,%rdx
+    12a5:	            |              |           |  |                                      |     |      48 0f 42 d0          	cmovb  %rax,%rdx
+    12a9:	            |              |           |  |                                      |     |      4c 39 e2             	cmp    %r12,%rdx
+    12ac:	            |              |           |  |                                      |     |      49 0f 42 d4          	cmovb  %r12,%rdx
+    12b0:	            |              |           |  |                                      |     |      48 89 d5             	mov    %rdx,%rbp
+            if (new_cap > max_capacity) { return nullptr; }
+    12b3:	            |           /--|-----------|--|--------------------------------------|-----|----> 48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    12ba:	            |           |  |           |  |                                      |     |      ff 7f 00 
+    12bd:	            |           |  |           |  |                                      |     |      48 39 e8             	cmp    %rbp,%rax
+    12c0:	         /--|-----------|--|-----------|--|--------------------------------------|-----|----- 0f 82 10 01 00 00    	jb     13d6 <main+0x216>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    12c6:	         |  |           |  |           |  |                                      |     |      49 89 ee             	mov    %rbp,%r14
+    12c9:	         |  |           |  |           |  |                                      |     |      4c 89 e8             	mov    %r13,%rax
+    12cc:	         |  |           |  |           |  |                                      |     |      49 c1 e6 08          	shl    $0x8,%r14
+    12d0:	         |  |           |  |           |  |                                      |     |      48 c1 e0 08          	shl    $0x8,%rax
+    12d4:	         |  |           |  |           |  |                                      |     |      49 8d 7e 10          	lea    0x10(%r14),%rdi
+    12d8:	         |  |           |  |           |  |                                      |     |      48 83 c0 10          	add    $0x10,%rax
+    12dc:	         |  |           |  |           |  |                                      |     |      48 89 7c 24 40       	mov    %rdi,0x40(%rsp)
+    12e1:	         |  |           |  |           |  |                                      |     |      48 89 44 24 18       	mov    %rax,0x18(%rsp)
+            if (align == 0 || (align & (align - 1)) != 0) {
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+            }
+            void *const new_p = is_over_aligned(align)
+                                    ? realloc_aligned(p, align, old_size, new_size)
+                                    : std::realloc(p, new_size);
+    12e6:	         |  |           |  |           |  |                                      |     |      e8 e5 fd ff ff       	call   10d0 <malloc@plt>
+    12eb:	         |  |           |  |           |  |                                      |     |      49 89 c6             	mov    %rax,%r14
+            if (new_p == nullptr) {
+    12ee:	         |  |           |  |           |  |                                      |     |      48 85 c0             	test   %rax,%rax
+    12f1:	         +--|-----------|--|-----------|--|--------------------------------------|-----|----- 0f 84 df 00 00 00    	je     13d6 <main+0x216>
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    12f7:	         |  |           |  |           |  |                                      |     |      66 0f 6f 4c 24 20    	movdqa 0x20(%rsp),%xmm1
+            , file_name_(file_name)
+            , line_num_(line_num)
+    12fd:	         |  |           |  |           |  |                                      |     |      c7 84 24 b0 00 00 00 	movl   $0x91,0xb0(%rsp)
+    1304:	         |  |           |  |           |  |                                      |     |      91 00 00 00 
+            : fn_name_(fn_name)
+    1308:	         |  |           |  |           |  |                                      |     |      0f 29 8c 24 a0 00 00 	movaps %xmm1,0xa0(%rsp)
+    130f:	         |  |           |  |           |  |                                      |     |      00 
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    1310:	         |  |           |  |           |  |                                      |     |      4c 39 e5             	cmp    %r12,%rbp
+    1313:	/--------|--|-----------|--|-----------|--|--------------------------------------|-----|----- 0f 82 55 0a 00 00    	jb     1d6e <main+0xbae>
+                    new_n->len_ = old_n->len_;
+    1319:	|        |  |           |  |           |  |                                      |     |      4c 89 60 08          	mov    %r12,0x8(%rax)
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    131d:	|        |  |           |  |           |  |                                      |     |      48 8d 48 10          	lea    0x10(%rax),%rcx
+    1321:	|        |  |           |  |           |  |                                      |     |      4c 8d 63 10          	lea    0x10(%rbx),%r12
+void relocate(uint8_t *const d, uint8_t *const s, Length const n);
+
+template<typename T>
+void relocate(T d[], T s[], Length const n)
+{
+    if (d == s) { return; }
+    1325:	|        |  |           |  |           |  |                                      |     |      49 39 cc             	cmp    %rcx,%r12
+    1328:	|  /-----|--|-----------|--|-----------|--|--------------------------------------|-----|----- 74 7e                	je     13a8 <main+0x1e8>
+    132a:	|  |     |  |           |  |           |  |                                      |     |      48 8b 43 08          	mov    0x8(%rbx),%rax
+    if constexpr (is_trivially_relocatable<T>) {
+        relocate(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t *>(s), n * sizeof(T));
+    } else if (d < s) {
+    132e:	|  |     |  |           |  |           |  |                                      |     |      4c 39 e1             	cmp    %r12,%rcx
+    1331:	|  |     |  |           |  |           |  |  /-----------------------------------|-----|----- 0f 82 b9 05 00 00    	jb     18f0 <main+0x730>
+            new (&d[i]) T(nel::move(s[i]));
+            s[i].~T();
+        }
+    } else {
+        // backwards, so overlap is not overwritten before it is read.
+        for (Index i = n; i > 0; --i) {
+    1337:	|  |     |  |           |  |           |  |  |                                   |     |      48 85 c0             	test   %rax,%rax
+    133a:	|  +-----|--|-----------|--|-----------|--|--|-----------------------------------|-----|----- 74 6c                	je     13a8 <main+0x1e8>
+    133c:	|  |     |  |           |  |           |  |  |                                   |     |      49 89 c4             	mov    %rax,%r12
+    133f:	|  |     |  |           |  |           |  |  |                                   |     |      4c 89 7c 24 48       	mov    %r15,0x48(%rsp)
+    1344:	|  |     |  |           |  |           |  |  |                                   |     |      49 89 c7             	mov    %rax,%r15
+    1347:	|  |     |  |           |  |           |  |  |                                   |     |      49 c1 e4 08          	shl    $0x8,%r12
+    134b:	|  |     |  |           |  |           |  |  |                                   |     |      48 89 5c 24 50       	mov    %rbx,0x50(%rsp)
+    1350:	|  |     |  |           |  |           |  |  |                                   |     |      49 81 ec f0 00 00 00 	sub    $0xf0,%r12
+    1357:	|  |     |  |           |  |           |  |  |                                   |     |      4b 8d 0c 26          	lea    (%r14,%r12,1),%rcx
+    135b:	|  |     |  |           |  |           |  |  |                                   |     |      49 01 dc             	add    %rbx,%r12
+    135e:	|  |     |  |           |  |           |  |  |                                   |     |      48 89 cb             	mov    %rcx,%rbx
+    1361:	|  |     |  |           |  |           |  |  |                                   |     |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            nel::elem::move(data_, o.data_, N);
+    1368:	|  |     |  |           |  |           |  |  |                                   |     |  /-> 4c 89 e6             	mov    %r12,%rsi
+    136b:	|  |     |  |           |  |           |  |  |                                   |     |  |   48 89 df             	mov    %rbx,%rdi
+    136e:	|  |     |  |           |  |           |  |  |                                   |     |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1373:	|  |     |  |           |  |           |  |  |                                   |     |  |   48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    137a:	|  |     |  |           |  |           |  |  |                                   |     |  |   e8 d1 0f 00 00       	call   2350 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    137f:	|  |     |  |           |  |           |  |  |                                   |     |  |   4c 89 e7             	mov    %r12,%rdi
+    1382:	|  |     |  |           |  |           |  |  |                                   |     |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1387:	|  |     |  |           |  |           |  |  |                                   |     |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    138c:	|  |     |  |           |  |           |  |  |                                   |     |  |   e8 af 0f 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1391:	|  |     |  |           |  |           |  |  |                                   |     |  |   49 81 ec 00 01 00 00 	sub    $0x100,%r12
+    1398:	|  |     |  |           |  |           |  |  |                                   |     |  |   49 83 ef 01          	sub    $0x1,%r15
+    139c:	|  |     |  |           |  |           |  |  |                                   |     |  \-- 75 ca                	jne    1368 <main+0x1a8>
+    139e:	|  |     |  |     /-----|--|-----------|--|--|-----------------------------------|-----|----> 4c 8b 7c 24 48       	mov    0x48(%rsp),%r15
+    13a3:	|  |     |  |     |     |  |           |  |  |                                   |     |      48 8b 5c 24 50       	mov    0x50(%rsp),%rbx
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    13a8:	|  >-----|--|-----|-----|--|-----------|--|--|-----------------------------------|-----|----> 48 89 df             	mov    %rbx,%rdi
+    13ab:	|  |     |  |     |     |  |           |  |  |                                   |     |      e8 00 fd ff ff       	call   10b0 <free@plt>
+                if (new_sz > old_sz) {
+    13b0:	|  |     |  |     |     |  |           |  |  |                                   |     |      48 8b 4c 24 40       	mov    0x40(%rsp),%rcx
+    13b5:	|  |     |  |     |     |  |           |  |  |                                   |     |      48 39 4c 24 18       	cmp    %rcx,0x18(%rsp)
+    13ba:	|  |     |  |     |     |  |           |  |  |                    /--------------|-----|----- 0f 82 10 05 00 00    	jb     18d0 <main+0x710>
+            new_n->alloc_ = new_cap;
+    13c0:	|  |     |  |     |     |  |           |  |  |                 /--|--------------|-----|----> 49 89 2e             	mov    %rbp,(%r14)
+            return len_;
+    13c3:	|  |     |  |     |     |  |           |  |  |                 |  |              |     |      4d 8b 66 08          	mov    0x8(%r14),%r12
+    13c7:	|  |     |  |     |     |  |           |  |  |                 |  |              |     |      49 89 ed             	mov    %rbp,%r13
+                item_ = p;
+    13ca:	|  |     |  |     |     |  |           |  |  |                 |  |              |     |      4c 89 f3             	mov    %r14,%rbx
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+        {
+            if (len() >= capacity()) {
+    13cd:	|  |     |  >-----|-----|--|-----------|--|--|-----------------|--|--------------|-----|----> 4d 39 ec             	cmp    %r13,%r12
+    13d0:	|  |     |  |     |     |  |           |  |  |                 |  |     /--------|-----|----- 0f 82 82 04 00 00    	jb     1858 <main+0x698>
+        {
+        }
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+            : value_(forward<Args>(args)...)
+    13d6:	|  |     >--|-----|-----|--|-----------|--|--|-----------------|--|-----|--------|-----|----> 0f b6 74 24 08       	movzbl 0x8(%rsp),%esi
+            nel::elem::set(data_, f, N);
+    13db:	|  |     |  |     |     |  |           |  |  |                 |  |     |        |     |      48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    13e0:	|  |     |  |     |     |  |           |  |  |                 |  |     |        |     |      ba 00 01 00 00       	mov    $0x100,%edx
+        {
+        }
+
+        template<typename... Args>
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+            : tag_(Tag::ERR)
+    13e5:	|  |     |  |     |     |  |           |  |  |                 |  |     |        |     |      c7 84 24 a0 00 00 00 	movl   $0x2,0xa0(%rsp)
+    13ec:	|  |     |  |     |     |  |           |  |  |                 |  |     |        |     |      02 00 00 00 
+    13f0:	|  |     |  |     |     |  |           |  |  |                 |  |     |        |     |      e8 4b 0f 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            : fn_name_(fn_name)
+    13f5:	|  |     |  |     |     |  |           |  |  |                 |  |     |        |     |      66 0f 6f 44 24 30    	movdqa 0x30(%rsp),%xmm0
+    13fb:	|  |     |  |     |     |  |           |  |  |                 |  |     |        |     |      8b 84 24 a0 00 00 00 	mov    0xa0(%rsp),%eax
+            , line_num_(line_num)
+    1402:	|  |     |  |     |     |  |           |  |  |                 |  |     |        |     |      c7 84 24 90 00 00 00 	movl   $0x47,0x90(%rsp)
+    1409:	|  |     |  |     |     |  |           |  |  |                 |  |     |        |     |      47 00 00 00 
+            : fn_name_(fn_name)
+    140d:	|  |     |  |     |     |  |           |  |  |                 |  |     |        |     |      0f 29 84 24 80 00 00 	movaps %xmm0,0x80(%rsp)
+    1414:	|  |     |  |     |     |  |           |  |  |                 |  |     |        |     |      00 
+        // match(Tag tag, std::function<V(void)> on_ok, std::function<V(void)> on_err) const
+        //
+        template<typename V, typename Fn1, typename Fn2>
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+        {
+            switch (tag_) { // result<void>-match
+    1415:	|  |     |  |     |     |  |           |  |  |                 |  |     |        |     |      83 f8 01             	cmp    $0x1,%eax
+    1418:	|  |     |  |     |     |  |           |  |  |                 |  |     |        |     |  /-- 74 1d                	je     1437 <main+0x277>
+    141a:	|  |     |  |     |     |  |           |  |  |                 |  |     |        |     |  |   83 f8 02             	cmp    $0x2,%eax
+    141d:	|  |     |  |     |     |  |           |  |  |                 |  |     |     /--|-----|--|-- 0f 85 15 04 00 00    	jne    1838 <main+0x678>
+            nel::elem::set(data_, 0xa5, N);
+    1423:	|  |     |  |     |     |  |           |  |  |                 |  |     |     |  |     |  |   48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    1428:	|  |     |  |     |     |  |           |  |  |                 |  |     |     |  |     |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    142d:	|  |     |  |     |     |  |           |  |  |                 |  |     |     |  |     |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    1432:	|  |     |  |     |     |  |           |  |  |                 |  |     |     |  |     |  |   e8 09 0f 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1437:	|  |     |  |     |     |  |           |  |  |                 |  |     |     |  |     |  \-> 49 83 c7 01          	add    $0x1,%r15
+    143b:	|  |     |  |     |     |  |           |  |  |                 |  |     |     |  |     |      49 81 ff e8 03 00 00 	cmp    $0x3e8,%r15
+    1442:	|  |     |  |     |     |  |           |  |  |                 |  |     |     |  |     \----- 0f 85 28 fe ff ff    	jne    1270 <main+0xb0>
+    1448:	|  |     |  |     |     |  |           |  |  |                 |  |     |  /--|--|----------> 4c 8b 6c 24 60       	mov    0x60(%rsp),%r13
+            if (old == nullptr) { return; }
+    144d:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |            48 85 db             	test   %rbx,%rbx
+    1450:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |  /-------- 74 39                	je     148b <main+0x2cb>
+            for (Index i = 0; i < len(); ++i) {
+    1452:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |  |         31 ed                	xor    %ebp,%ebp
+    1454:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |  |         48 83 7b 08 00       	cmpq   $0x0,0x8(%rbx)
+    1459:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |  |         4c 8d 63 10          	lea    0x10(%rbx),%r12
+    145d:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |  |  /----- 74 24                	je     1483 <main+0x2c3>
+    145f:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |  |  |      90                   	nop
+    1460:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |  |  |  /-> 4c 89 e7             	mov    %r12,%rdi
+    1463:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |  |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1468:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |  |  |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    146d:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |  |  |  |   48 83 c5 01          	add    $0x1,%rbp
+    1471:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |  |  |  |   e8 ca 0e 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1476:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |  |  |  |   49 81 c4 00 01 00 00 	add    $0x100,%r12
+    147d:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |  |  |  |   48 3b 6b 08          	cmp    0x8(%rbx),%rbp
+    1481:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |  |  |  \-- 72 dd                	jb     1460 <main+0x2a0>
+    1483:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |  |  \----> 48 89 df             	mov    %rbx,%rdi
+    1486:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |  |         e8 25 fc ff ff       	call   10b0 <free@plt>
+        for (Index r = 0; r < 100; ++r) {
+    148b:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |  \-------> 49 83 ed 01          	sub    $0x1,%r13
+    148f:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  \----------- 0f 85 c3 fd ff ff    	jne    1258 <main+0x98>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1495:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               4c 8b 7c 24 68       	mov    0x68(%rsp),%r15
+    149a:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               48 8b 6c 24 70       	mov    0x70(%rsp),%rbp
+    149f:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               bf 01 00 00 00       	mov    $0x1,%edi
+    14a4:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               4c 8b 64 24 78       	mov    0x78(%rsp),%r12
+    14a9:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               4c 89 fe             	mov    %r15,%rsi
+    14ac:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               e8 bf fb ff ff       	call   1070 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    14b1:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               48 69 c5 00 ca 9a 3b 	imul   $0x3b9aca00,%rbp,%rax
+
+// Log a result line: name, time and (if bytes given) bandwidth.
+inline void report(char const *const name, long unsigned int const ns,
+                   long unsigned int const bytes = 0)
+{
+    nel::log << name << ": " << ns / 1000UL << "us";
+    14b8:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               48 8d 35 d2 1b 00 00 	lea    0x1bd2(%rip),%rsi        # 3091 <_IO_stdin_used+0x91>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    14bf:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               48 69 9c 24 a0 00 00 	imul   $0x3b9aca00,0xa0(%rsp),%rbx
+    14c6:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               00 00 ca 9a 3b 
+    nel::log << name << ": " << ns / 1000UL << "us";
+    14cb:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               48 8d 3d ce 3b 02 00 	lea    0x23bce(%rip),%rdi        # 250a0 <nel::log>
+    14d2:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               4c 29 e3             	sub    %r12,%rbx
+    return now_ns() - b;
+    14d5:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               48 03 9c 24 a8 00 00 	add    0xa8(%rsp),%rbx
+    14dc:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               00 
+    14dd:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               48 29 c3             	sub    %rax,%rbx
+    nel::log << name << ": " << ns / 1000UL << "us";
+    14e0:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               e8 eb 16 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    14e5:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               48 8d 35 27 1b 00 00 	lea    0x1b27(%rip),%rsi        # 3013 <_IO_stdin_used+0x13>
+    14ec:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               48 89 c7             	mov    %rax,%rdi
+    14ef:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               e8 dc 16 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    14f4:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               b9 e8 03 00 00       	mov    $0x3e8,%ecx
+    14f9:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               31 d2                	xor    %edx,%edx
+    14fb:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               48 89 c7             	mov    %rax,%rdi
+    14fe:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               48 89 d8             	mov    %rbx,%rax
+    1501:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               48 f7 f1             	div    %rcx
+    1504:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               48 89 c6             	mov    %rax,%rsi
+    1507:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               e8 84 17 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned long)>
+    150c:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               48 8d 35 03 1b 00 00 	lea    0x1b03(%rip),%rsi        # 3016 <_IO_stdin_used+0x16>
+    1513:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               48 89 c7             	mov    %rax,%rdi
+    1516:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               e8 b5 16 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    if (bytes != 0 && ns != 0) {
+        // bytes/ns == GB/s, scaled to MB/s
+        nel::log << ", " << (bytes * 1000UL) / ns << "MB/s";
+    }
+    nel::log << '\n';
+    151b:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               be 0a 00 00 00       	mov    $0xa,%esi
+    1520:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               48 8d 3d 79 3b 02 00 	lea    0x23b79(%rip),%rdi        # 250a0 <nel::log>
+    1527:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               e8 84 16 00 00       	call   2bb0 <nel::operator<<(nel::Log&, char)>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    152c:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               4c 89 fe             	mov    %r15,%rsi
+    152f:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               bf 01 00 00 00       	mov    $0x1,%edi
+    1534:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               e8 37 fb ff ff       	call   1070 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1539:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               4c 8b ac 24 a0 00 00 	mov    0xa0(%rsp),%r13
+    1540:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               00 
+    1541:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               48 c7 44 24 48 64 00 	movq   $0x64,0x48(%rsp)
+    1548:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               00 00 
+    154a:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               48 8b 9c 24 a8 00 00 	mov    0xa8(%rsp),%rbx
+    1551:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |               00 
+            nel::elem::set(data_, f, N);
+    1552:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  /----------> 4c 89 7c 24 10       	mov    %r15,0x10(%rsp)
+            : item_(nullptr)
+    1557:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |            45 31 f6             	xor    %r14d,%r14d
+    155a:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |            48 8d 84 24 a4 00 00 	lea    0xa4(%rsp),%rax
+    1561:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |            00 
+            for (Index i = 0; i < n; ++i) {
+    1562:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |            45 31 e4             	xor    %r12d,%r12d
+    1565:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |            4c 89 6c 24 18       	mov    %r13,0x18(%rsp)
+    156a:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |            4d 89 f5             	mov    %r14,%r13
+    156d:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |            48 89 5c 24 40       	mov    %rbx,0x40(%rsp)
+    1572:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |            48 89 c3             	mov    %rax,%rbx
+    1575:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |            0f 1f 00             	nopl   (%rax)
+    1578:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |     /----> 45 89 e6             	mov    %r12d,%r14d
+            return (item_ == nullptr) ? 0 : item_->len();
+    157b:	|  |     |  |     |     |  |           |  |  |                 |  |     |  |  |  |     |      4d 85 ed             	test   %r13,%r13
+    157e:	|  |     |  |     |  /--|--|-----------|--|--|-----------------|--|-----|--|--|--|-----|----- 0f 84 d4 06 00 00    	je     1c58 <main+0xa98>
+            return len_;
+    1584:	|  |     |  |     |  |  |  |  /--------|--|--|-----------------|--|-----|--|--|--|-----|----> 49 8b 6d 08          	mov    0x8(%r13),%rbp
+            return alloc_;
+    1588:	|  |     |  |     |  |  |  |  |        |  |  |                 |  |     |  |  |  |     |      49 8b 45 00          	mov    0x0(%r13),%rax
+            if (len() + n <= capacity()) { return true; }
+    158c:	|  |     |  |     |  |  |  |  |        |  |  |                 |  |     |  |  |  |     |      48 8d 7d 01          	lea    0x1(%rbp),%rdi
+    1590:	|  |     |  |     |  |  |  |  |        |  |  |                 |  |     |  |  |  |     |      48 39 f8             	cmp    %rdi,%rax
+    1593:	|  |     |  |     |  |  |  |  |        |  |  |  /--------------|--|-----|--|--|--|-----|----- 0f 83 2b 01 00 00    	jae    16c4 <main+0x504>
+    1599:	|  |     |  |     |  |  |  |  |        |  |  |  |              |  |     |  |  |  |     |      48 83 f8 03          	cmp    $0x3,%rax
+    159d:	|  |     |  |     |  |  |  |  |        |  |  |  |        /-----|--|-----|--|--|--|-----|----- 0f 87 6d 05 00 00    	ja     1b10 <main+0x950>
+    15a3:	|  |     |  |     |  |  |  |  |        |  |  |  |        |     |  |     |  |  |  |     |      b8 04 00 00 00       	mov    $0x4,%eax
+    15a8:	|  |     |  |     |  |  |  |  |        |  |  |  |        |     |  |     |  |  |  |     |      48 39 c7             	cmp    %rax,%rdi
+    15ab:	|  |     |  |     |  |  |  |  |        |  |  |  |        |     |  |     |  |  |  |     |      48 0f 42 f8          	cmovb  %rax,%rdi
+    15af:	|  |     |  |     |  |  |  |  |        |  |  |  |        |     |  |     |  |  |  |     |      48 39 ef             	cmp    %rbp,%rdi
+    15b2:	|  |     |  |     |  |  |  |  |        |  |  |  |        |     |  |     |  |  |  |     |      48 0f 42 fd          	cmovb  %rbp,%rdi
+    15b6:	|  |     |  |     |  |  |  |  |        |  |  |  |        |     |  |     |  |  |  |     |      49 89 ff             	mov    %rdi,%r15
+            if (new_cap > max_capacity) { return nullptr; }
+    15b9:	|  |     |  |     |  |  |  |  |        |  |  |  |     /--|-----|--|-----|--|--|--|-----|----> 48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    15c0:	|  |     |  |     |  |  |  |  |        |  |  |  |     |  |     |  |     |  |  |  |     |      ff 7f 00 
+    15c3:	|  |     |  |     |  |  |  |  |        |  |  |  |     |  |     |  |     |  |  |  |     |      4c 39 f8             	cmp    %r15,%rax
+    15c6:	|  |     |  |     |  |  |  |  |  /-----|--|--|--|-----|--|-----|--|-----|--|--|--|-----|----- 0f 82 01 01 00 00    	jb     16cd <main+0x50d>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    15cc:	|  |     |  |     |  |  |  |  |  |     |  |  |  |     |  |     |  |     |  |  |  |     |      4c 89 ff             	mov    %r15,%rdi
+    15cf:	|  |     |  |     |  |  |  |  |  |     |  |  |  |     |  |     |  |     |  |  |  |     |      48 c1 e7 08          	shl    $0x8,%rdi
+    15d3:	|  |     |  |     |  |  |  |  |  |     |  |  |  |     |  |     |  |     |  |  |  |     |      48 83 c7 10          	add    $0x10,%rdi
+                                    : std::realloc(p, new_size);
+    15d7:	|  |     |  |     |  |  |  |  |  |     |  |  |  |     |  |     |  |     |  |  |  |     |      e8 f4 fa ff ff       	call   10d0 <malloc@plt>
+    15dc:	|  |     |  |     |  |  |  |  |  |     |  |  |  |     |  |     |  |     |  |  |  |     |      49 89 c0             	mov    %rax,%r8
+            if (new_p == nullptr) {
+    15df:	|  |     |  |     |  |  |  |  |  |     |  |  |  |     |  |     |  |     |  |  |  |     |      48 85 c0             	test   %rax,%rax
+    15e2:	|  |     |  |     |  |  |  |  |  +-----|--|--|--|-----|--|-----|--|-----|--|--|--|-----|----- 0f 84 e5 00 00 00    	je     16cd <main+0x50d>
+    15e8:	|  |     |  |     |  |  |  |  |  |     |  |  |  |     |  |     |  |     |  |  |  |     |      66 0f 6f 7c 24 20    	movdqa 0x20(%rsp),%xmm7
+            , line_num_(line_num)
+    15ee:	|  |     |  |     |  |  |  |  |  |     |  |  |  |     |  |     |  |     |  |  |  |     |      c7 84 24 b0 00 00 00 	movl   $0x91,0xb0(%rsp)
+    15f5:	|  |     |  |     |  |  |  |  |  |     |  |  |  |     |  |     |  |     |  |  |  |     |      91 00 00 00 
+            : fn_name_(fn_name)
+    15f9:	|  |     |  |     |  |  |  |  |  |     |  |  |  |     |  |     |  |     |  |  |  |     |      0f 29 bc 24 a0 00 00 	movaps %xmm7,0xa0(%rsp)
+    1600:	|  |     |  |     |  |  |  |  |  |     |  |  |  |     |  |     |  |     |  |  |  |     |      00 
+    if (!pred) { assert_fail(msg, ctx); }
+    1601:	|  |     |  |     |  |  |  |  |  |     |  |  |  |     |  |     |  |     |  |  |  |     |      49 39 ef             	cmp    %rbp,%r15
+    1604:	|  |  /--|--|-----|--|--|--|--|--|-----|--|--|--|-----|--|-----|--|-----|--|--|--|-----|----- 0f 82 75 07 00 00    	jb     1d7f <main+0xbbf>
+                    new_n->len_ = old_n->len_;
+    160a:	|  |  |  |  |     |  |  |  |  |  |     |  |  |  |     |  |     |  |     |  |  |  |     |      48 89 68 08          	mov    %rbp,0x8(%rax)
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    160e:	|  |  |  |  |     |  |  |  |  |  |     |  |  |  |     |  |     |  |     |  |  |  |     |      49 8d 6d 10          	lea    0x10(%r13),%rbp
+    1612:	|  |  |  |  |     |  |  |  |  |  |     |  |  |  |     |  |     |  |     |  |  |  |     |      48 8d 40 10          	lea    0x10(%rax),%rax
+    if (d == s) { return; }
+    1616:	|  |  |  |  |     |  |  |  |  |  |     |  |  |  |     |  |     |  |     |  |  |  |     |      48 39 c5             	cmp    %rax,%rbp
+    1619:	|  |  |  |  |  /--|--|--|--|--|--|-----|--|--|--|-----|--|-----|--|-----|--|--|--|-----|----- 0f 84 86 00 00 00    	je     16a5 <main+0x4e5>
+    161f:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |     |  |     |  |  |  |     |      49 8b 7d 08          	mov    0x8(%r13),%rdi
+    } else if (d < s) {
+    1623:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |     |  |     |  |  |  |     |      48 39 e8             	cmp    %rbp,%rax
+    1626:	|  |  |  |  |  |  |  |  |  |  |  |  /--|--|--|--|-----|--|-----|--|-----|--|--|--|-----|----- 0f 82 54 06 00 00    	jb     1c80 <main+0xac0>
+        for (Index i = n; i > 0; --i) {
+    162c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |      48 85 ff             	test   %rdi,%rdi
+    162f:	|  |  |  |  |  +--|--|--|--|--|--|--|--|--|--|--|-----|--|-----|--|-----|--|--|--|-----|----- 74 74                	je     16a5 <main+0x4e5>
+    1631:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |      48 89 fd             	mov    %rdi,%rbp
+    1634:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |      4c 89 44 24 50       	mov    %r8,0x50(%rsp)
+    1639:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |      48 c1 e5 08          	shl    $0x8,%rbp
+    163d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |      4c 89 7c 24 08       	mov    %r15,0x8(%rsp)
+    1642:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |      49 89 ff             	mov    %rdi,%r15
+    1645:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |      48 81 ed f0 00 00 00 	sub    $0xf0,%rbp
+    164c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |      48 89 5c 24 58       	mov    %rbx,0x58(%rsp)
+    1651:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |      49 8d 04 28          	lea    (%r8,%rbp,1),%rax
+    1655:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |      4c 01 ed             	add    %r13,%rbp
+    1658:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |      48 89 c3             	mov    %rax,%rbx
+    165b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |      0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+            nel::elem::move(data_, o.data_, N);
+    1660:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |  /-> 48 89 ee             	mov    %rbp,%rsi
+    1663:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |  |   48 89 df             	mov    %rbx,%rdi
+    1666:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    166b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |  |   48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    1672:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |  |   e8 d9 0c 00 00       	call   2350 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1677:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |  |   48 89 ef             	mov    %rbp,%rdi
+    167a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    167f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    1684:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |  |   e8 b7 0c 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1689:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |  |   48 81 ed 00 01 00 00 	sub    $0x100,%rbp
+    1690:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |  |   49 83 ef 01          	sub    $0x1,%r15
+    1694:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |     |  |  |  |     |  \-- 75 ca                	jne    1660 <main+0x4a0>
+    1696:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|-----|--|-----|--|--|--|-----|----> 4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+    169b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |  |  |     |      4c 8b 44 24 50       	mov    0x50(%rsp),%r8
+    16a0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |  |  |     |      48 8b 5c 24 58       	mov    0x58(%rsp),%rbx
+                std::free(p);
+    16a5:	|  |  |  |  |  >--|--|--|--|--|--|--|--|--|--|--|--|--|--|-----|--|-----|--|--|--|-----|----> 4c 89 ef             	mov    %r13,%rdi
+    16a8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |  |  |     |      4c 89 44 24 08       	mov    %r8,0x8(%rsp)
+    16ad:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |  |  |     |      e8 fe f9 ff ff       	call   10b0 <free@plt>
+            new_n->alloc_ = new_cap;
+    16b2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |  |  |     |      4c 8b 44 24 08       	mov    0x8(%rsp),%r8
+            return len_;
+    16b7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |  |  |     |      4c 89 f8             	mov    %r15,%rax
+            new_n->alloc_ = new_cap;
+    16ba:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |  |  |     |      4d 89 38             	mov    %r15,(%r8)
+            return len_;
+    16bd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |  |  |     |      49 8b 68 08          	mov    0x8(%r8),%rbp
+                item_ = p;
+    16c1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |  |  |     |      4d 89 c5             	mov    %r8,%r13
+            if (len() >= capacity()) {
+    16c4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  >--|--|--|-----|--|-----|--|--|--|-----|----> 48 39 c5             	cmp    %rax,%rbp
+    16c7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|-----|--|--|--|-----|----- 0f 82 4e 05 00 00    	jb     1c1b <main+0xa5b>
+    16cd:	|  |  |  |  |  |  |  |  |  |  |  >--|--|--|--|--|--|--|--|--|--|--|-----|--|--|--|-----|----> 41 0f b6 f6          	movzbl %r14b,%esi
+            nel::elem::set(data_, f, N);
+    16d1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |      ba 00 01 00 00       	mov    $0x100,%edx
+    16d6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |      48 89 df             	mov    %rbx,%rdi
+            : tag_(Tag::ERR)
+    16d9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |      c7 84 24 a0 00 00 00 	movl   $0x2,0xa0(%rsp)
+    16e0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |      02 00 00 00 
+    16e4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |      e8 57 0c 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            : fn_name_(fn_name)
+    16e9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |      66 0f 6f 64 24 30    	movdqa 0x30(%rsp),%xmm4
+    16ef:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |      8b 84 24 a0 00 00 00 	mov    0xa0(%rsp),%eax
+            , line_num_(line_num)
+    16f6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |      c7 84 24 90 00 00 00 	movl   $0x47,0x90(%rsp)
+    16fd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |      47 00 00 00 
+            : fn_name_(fn_name)
+    1701:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |      0f 29 a4 24 80 00 00 	movaps %xmm4,0x80(%rsp)
+    1708:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |      00 
+            switch (tag_) { // result<void>-match
+    1709:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |      83 f8 01             	cmp    $0x1,%eax
+    170c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  /-- 74 1b                	je     1729 <main+0x569>
+    170e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |   83 f8 02             	cmp    $0x2,%eax
+    1711:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  +--|-----|--|-- 0f 85 21 01 00 00    	jne    1838 <main+0x678>
+            nel::elem::set(data_, 0xa5, N);
+    1717:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    171c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    1721:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |   48 89 df             	mov    %rbx,%rdi
+    1724:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |   e8 17 0c 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1729:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  \-> 49 83 c4 01          	add    $0x1,%r12
+    172d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |      49 81 fc e8 03 00 00 	cmp    $0x3e8,%r12
+    1734:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     \----- 0f 85 3e fe ff ff    	jne    1578 <main+0x3b8>
+    173a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|--|--|----------> 4d 89 ee             	mov    %r13,%r14
+    173d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 8b 5c 24 40       	mov    0x40(%rsp),%rbx
+    1742:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            4c 8b 6c 24 18       	mov    0x18(%rsp),%r13
+    1747:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            4c 8b 7c 24 10       	mov    0x10(%rsp),%r15
+            if (old == nullptr) { return; }
+    174c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            4d 85 f6             	test   %r14,%r14
+    174f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-------- 74 38                	je     1789 <main+0x5c9>
+            for (Index i = 0; i < len(); ++i) {
+    1751:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         31 ed                	xor    %ebp,%ebp
+    1753:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         49 83 7e 08 00       	cmpq   $0x0,0x8(%r14)
+    1758:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         4d 8d 66 10          	lea    0x10(%r14),%r12
+    175c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /----- 74 23                	je     1781 <main+0x5c1>
+    175e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-> 4c 89 e7             	mov    %r12,%rdi
+    1761:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1766:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    176b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 83 c5 01          	add    $0x1,%rbp
+    176f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   e8 cc 0b 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1774:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   49 81 c4 00 01 00 00 	add    $0x100,%r12
+    177b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   49 3b 6e 08          	cmp    0x8(%r14),%rbp
+    177f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \-- 72 dd                	jb     175e <main+0x59e>
+    1781:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \----> 4c 89 f7             	mov    %r14,%rdi
+    1784:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 27 f9 ff ff       	call   10b0 <free@plt>
+        for (Index r = 0; r < 100; ++r) {
+    1789:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \-------> 48 83 6c 24 48 01    	subq   $0x1,0x48(%rsp)
+    178f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \----------- 0f 85 bd fd ff ff    	jne    1552 <main+0x392>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1795:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               4c 89 fe             	mov    %r15,%rsi
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1798:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               4d 69 ed 00 ca 9a 3b 	imul   $0x3b9aca00,%r13,%r13
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    179f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               bf 01 00 00 00       	mov    $0x1,%edi
+    17a4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               e8 c7 f8 ff ff       	call   1070 <clock_gettime@plt>
+    nel::log << name << ": " << ns / 1000UL << "us";
+    17a9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 35 f9 18 00 00 	lea    0x18f9(%rip),%rsi        # 30a9 <_IO_stdin_used+0xa9>
+    17b0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 3d e9 38 02 00 	lea    0x238e9(%rip),%rdi        # 250a0 <nel::log>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    17b7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 69 84 24 a0 00 00 	imul   $0x3b9aca00,0xa0(%rsp),%rax
+    17be:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               00 00 ca 9a 3b 
+    17c3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 29 d8             	sub    %rbx,%rax
+    return now_ns() - b;
+    17c6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 03 84 24 a8 00 00 	add    0xa8(%rsp),%rax
+    17cd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               00 
+    17ce:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 89 c3             	mov    %rax,%rbx
+    nel::log << name << ": " << ns / 1000UL << "us";
+    17d1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               e8 fa 13 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    17d6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 35 36 18 00 00 	lea    0x1836(%rip),%rsi        # 3013 <_IO_stdin_used+0x13>
+    return now_ns() - b;
+    17dd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               4c 29 eb             	sub    %r13,%rbx
+    nel::log << name << ": " << ns / 1000UL << "us";
+    17e0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    17e3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               e8 e8 13 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    17e8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               b9 e8 03 00 00       	mov    $0x3e8,%ecx
+    17ed:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               31 d2                	xor    %edx,%edx
+    17ef:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    17f2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 89 d8             	mov    %rbx,%rax
+    17f5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 f7 f1             	div    %rcx
+    17f8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 89 c6             	mov    %rax,%rsi
+    17fb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               e8 90 14 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned long)>
+    1800:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 35 0f 18 00 00 	lea    0x180f(%rip),%rsi        # 3016 <_IO_stdin_used+0x16>
+    1807:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    180a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               e8 c1 13 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    nel::log << '\n';
+    180f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               be 0a 00 00 00       	mov    $0xa,%esi
+    1814:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 3d 85 38 02 00 	lea    0x23885(%rip),%rdi        # 250a0 <nel::log>
+    181b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               e8 90 13 00 00       	call   2bb0 <nel::operator<<(nel::Log&, char)>
+    bench_growth<nel::heaped::Poisoned<true>>("vector growth, poisoned");
+    bench_growth<nel::heaped::Poisoned<false>>("vector growth, not poisoned");
+}
+    1820:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 81 c4 b8 01 00 00 	add    $0x1b8,%rsp
+    1827:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               31 c0                	xor    %eax,%eax
+    1829:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               5b                   	pop    %rbx
+    182a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               5d                   	pop    %rbp
+    182b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               41 5c                	pop    %r12
+    182d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               41 5d                	pop    %r13
+    182f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               41 5e                	pop    %r14
+    1831:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               41 5f                	pop    %r15
+    1833:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               c3                   	ret
+    1834:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               0f 1f 40 00          	nopl   0x0(%rax)
+                    // if they do it's a use-after-move-from op so must panic.
+                    // or a use-before-initialised so again must panic.
+                    nel::panic("invalid Result", ctx);
+                    break;
+                default:
+                    nel::panic("bad Result", ctx);
+    1838:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \-------------> 48 8d b4 24 80 00 00 	lea    0x80(%rsp),%rsi
+    183f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  00 
+            switch (tag_) { // result<void>-match
+    1840:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |                  85 c0                	test   %eax,%eax
+    1842:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        /-------- 0f 84 b5 02 00 00    	je     1afd <main+0x93d>
+                    nel::panic("bad Result", ctx);
+    1848:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |         48 8d 3d 37 18 00 00 	lea    0x1837(%rip),%rdi        # 3086 <_IO_stdin_used+0x86>
+    184f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |         e8 fe f8 ff ff       	call   1152 <nel::panic(char const*, nel::Context const&)>
+    1854:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |         0f 1f 40 00          	nopl   0x0(%rax)
+    1858:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \--|--------|-------> 49 c1 e4 08          	shl    $0x8,%r12
+    185c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |         49 8d 7c 24 10       	lea    0x10(%r12),%rdi
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    1861:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |     /-> 0f b6 74 24 08       	movzbl 0x8(%rsp),%esi
+            nel::elem::set(data_, f, N);
+    1866:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |     |   48 01 df             	add    %rbx,%rdi
+    1869:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |     |   ba 00 01 00 00       	mov    $0x100,%edx
+            for (Index i = 0; i < n; ++i) {
+    186e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |     |   49 83 c7 01          	add    $0x1,%r15
+    1872:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |     |   e8 c9 0a 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            len_ += 1;
+    1877:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |     |   48 83 43 08 01       	addq   $0x1,0x8(%rbx)
+    187c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |     |   49 81 ff e8 03 00 00 	cmp    $0x3e8,%r15
+    1883:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     \--------|-----|-- 0f 84 bf fb ff ff    	je     1448 <main+0x288>
+    1889:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |              |     |   44 88 7c 24 08       	mov    %r15b,0x8(%rsp)
+        constexpr Length len(void) const
+    188e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  \--|--|--|--|--|--|--|--|--|--------------|-----|-- e9 eb f9 ff ff       	jmp    127e <main+0xbe>
+    1893:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |              |     |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+                                    : std::realloc(p, new_size);
+    1898:	|  |  |  |  |  |  |  |  |  |  |  |  |  \-----|--|--|--|--|--|--|--|--|--------------|-----|-> bf 10 04 00 00       	mov    $0x410,%edi
+    189d:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |  |  |              |     |   e8 2e f8 ff ff       	call   10d0 <malloc@plt>
+    18a2:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |  |  |              |     |   48 89 c3             	mov    %rax,%rbx
+            if (new_p == nullptr) {
+    18a5:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |  |  |              |     |   48 85 c0             	test   %rax,%rax
+    18a8:	|  |  |  +--|--|--|--|--|--|--|--|--|--------|--|--|--|--|--|--|--|--|--------------|-----|-- 0f 84 28 fb ff ff    	je     13d6 <main+0x216>
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+    18ae:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |  |  |              |     |   48 89 c7             	mov    %rax,%rdi
+    18b1:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |  |  |              |     |   be 10 04 00 00       	mov    $0x410,%esi
+    18b6:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |  |  |              |     |   e8 b5 0a 00 00       	call   2370 <nel::elem::wipe(unsigned char*, unsigned long)>
+            new_n->alloc_ = new_cap;
+    18bb:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |  |  |              |     |   66 0f 6f 1d 5d 18 00 	movdqa 0x185d(%rip),%xmm3        # 3120 <_IO_stdin_used+0x120>
+    18c2:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |  |  |              |     |   00 
+    18c3:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |  |  |              |     |   bf 10 00 00 00       	mov    $0x10,%edi
+    18c8:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |  |  |              |     |   0f 11 1b             	movups %xmm3,(%rbx)
+        constexpr Length len(void) const
+    18cb:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |  |  |              |     \-- eb 94                	jmp    1861 <main+0x6a1>
+    18cd:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |  |  |              |         0f 1f 00             	nopl   (%rax)
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+    18d0:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |  \--|--------------|-------> 48 8b 7c 24 18       	mov    0x18(%rsp),%rdi
+    18d5:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |     |              |         48 89 ee             	mov    %rbp,%rsi
+    18d8:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |     |              |         4c 29 ee             	sub    %r13,%rsi
+    18db:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |     |              |         48 c1 e6 08          	shl    $0x8,%rsi
+    18df:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |     |              |         4c 01 f7             	add    %r14,%rdi
+    18e2:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |     |              |         e8 89 0a 00 00       	call   2370 <nel::elem::wipe(unsigned char*, unsigned long)>
+    18e7:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  \-----|--------------|-------- e9 d4 fa ff ff       	jmp    13c0 <main+0x200>
+    18ec:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |        |              |         0f 1f 40 00          	nopl   0x0(%rax)
+        for (Index i = 0; i < n; ++i) {
+    18f0:	|  |  |  |  |  |  |  |  |  |  |  |  |        \--|--|--|--|--|--------|--------------|-------> 48 85 c0             	test   %rax,%rax
+    18f3:	|  +--|--|--|--|--|--|--|--|--|--|--|-----------|--|--|--|--|--------|--------------|-------- 0f 84 af fa ff ff    	je     13a8 <main+0x1e8>
+    18f9:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |         45 31 c9             	xor    %r9d,%r9d
+    18fc:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |         4c 89 7c 24 48       	mov    %r15,0x48(%rsp)
+    1901:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |         49 89 c7             	mov    %rax,%r15
+    1904:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |         48 89 5c 24 50       	mov    %rbx,0x50(%rsp)
+    1909:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |         4c 89 cb             	mov    %r9,%rbx
+    190c:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |         48 89 6c 24 58       	mov    %rbp,0x58(%rsp)
+    1911:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |         48 89 cd             	mov    %rcx,%rbp
+    1914:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |         0f 1f 40 00          	nopl   0x0(%rax)
+            nel::elem::move(data_, o.data_, N);
+    1918:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |     /-> 4c 89 e6             	mov    %r12,%rsi
+    191b:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |     |   48 89 ef             	mov    %rbp,%rdi
+    191e:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    1923:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |     |   48 83 c3 01          	add    $0x1,%rbx
+    1927:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |     |   e8 24 0a 00 00       	call   2350 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    192c:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |     |   4c 89 e7             	mov    %r12,%rdi
+    192f:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    1934:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    1939:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |     |   e8 02 0a 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    193e:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |     |   48 81 c5 00 01 00 00 	add    $0x100,%rbp
+    1945:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |     |   49 81 c4 00 01 00 00 	add    $0x100,%r12
+    194c:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |     |   49 39 df             	cmp    %rbx,%r15
+    194f:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |     \-- 75 c7                	jne    1918 <main+0x758>
+    1951:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |         4c 8b 7c 24 48       	mov    0x48(%rsp),%r15
+    1956:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |         48 8b 5c 24 50       	mov    0x50(%rsp),%rbx
+    195b:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |         48 8b 6c 24 58       	mov    0x58(%rsp),%rbp
+    1960:	|  +--|--|--|--|--|--|--|--|--|--|--|-----------|--|--|--|--|--------|--------------|-------- e9 43 fa ff ff       	jmp    13a8 <main+0x1e8>
+    1965:	|  |  |  |  |  |  |  |  |  |  |  |  |           |  |  |  |  |        |              |         0f 1f 00             	nopl   (%rax)
+    1968:	|  |  |  |  |  |  |  |  |  \--|--|--|-----------|--|--|--|--|--------|--------------|-------> 4b 8d 44 2d 00       	lea    0x0(%r13,%r13,1),%rax
+    196d:	|  |  |  |  |  |  |  |  |     |  |  |           |  |  |  |  |        |              |         48 39 d0             	cmp    %rdx,%rax
+    1970:	|  |  |  |  |  |  |  |  |     |  |  |           |  |  |  |  |        |              |         48 0f 42 c2          	cmovb  %rdx,%rax
+    1974:	|  |  |  |  |  |  |  |  |     |  |  |           |  |  |  |  |        |              |         4c 39 e0             	cmp    %r12,%rax
+    1977:	|  |  |  |  |  |  |  |  |     |  |  |           |  |  |  |  |        |              |         49 0f 42 c4          	cmovb  %r12,%rax
+    197b:	|  |  |  |  |  |  |  |  |     |  |  |           |  |  |  |  |        |              |         48 89 c5             	mov    %rax,%rbp
+            } else if (new_cap == item_->capacity()) {
+    197e:	|  |  |  |  |  |  |  |  |     |  |  |           |  |  |  |  |        |              |         4c 39 e8             	cmp    %r13,%rax
+    1981:	|  |  |  |  \--|--|--|--|-----|--|--|-----------|--|--|--|--|--------|--------------|-------- 0f 84 46 fa ff ff    	je     13cd <main+0x20d>
+            } else if (new_cap > item_->capacity()) {
+    1987:	|  |  |  |     |  |  |  |     |  |  |           |  |  |  |  |        |              |         49 39 c5             	cmp    %rax,%r13
+    198a:	|  |  |  |     |  |  |  \-----|--|--|-----------|--|--|--|--|--------|--------------|-------- 0f 82 23 f9 ff ff    	jb     12b3 <main+0xf3>
+            if (new_cap > max_capacity) { return nullptr; }
+    1990:	|  |  |  |     |  |  |        |  |  |           |  |  |  |  |        |              |         48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    1997:	|  |  |  |     |  |  |        |  |  |           |  |  |  |  |        |              |         ff 7f 00 
+    199a:	|  |  |  |     |  |  |        |  |  |           |  |  |  |  |        |              |         48 39 e8             	cmp    %rbp,%rax
+    199d:	|  |  |  +-----|--|--|--------|--|--|-----------|--|--|--|--|--------|--------------|-------- 0f 82 33 fa ff ff    	jb     13d6 <main+0x216>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    19a3:	|  |  |  |     |  |  |        |  |  |           |  |  |  |  |        |              |         49 89 ee             	mov    %rbp,%r14
+    19a6:	|  |  |  |     |  |  |        |  |  |           |  |  |  |  |        |              |         4c 89 e8             	mov    %r13,%rax
+    19a9:	|  |  |  |     |  |  |        |  |  |           |  |  |  |  |        |              |         49 c1 e6 08          	shl    $0x8,%r14
+    19ad:	|  |  |  |     |  |  |        |  |  |           |  |  |  |  |        |              |         48 c1 e0 08          	shl    $0x8,%rax
+    19b1:	|  |  |  |     |  |  |        |  |  |           |  |  |  |  |        |              |         49 8d 7e 10          	lea    0x10(%r14),%rdi
+    19b5:	|  |  |  |     |  |  |        |  |  |           |  |  |  |  |        |              |         48 83 c0 10          	add    $0x10,%rax
+    19b9:	|  |  |  |     |  |  |        |  |  |           |  |  |  |  |        |              |         48 89 7c 24 40       	mov    %rdi,0x40(%rsp)
+    19be:	|  |  |  |     |  |  |        |  |  |           |  |  |  |  |        |              |         48 89 44 24 18       	mov    %rax,0x18(%rsp)
+                                    : std::realloc(p, new_size);
+    19c3:	|  |  |  |     |  |  |        |  |  |           |  |  |  |  |        |              |         e8 08 f7 ff ff       	call   10d0 <malloc@plt>
+    19c8:	|  |  |  |     |  |  |        |  |  |           |  |  |  |  |        |              |         49 89 c6             	mov    %rax,%r14
+            if (new_p == nullptr) {
+    19cb:	|  |  |  |     |  |  |        |  |  |           |  |  |  |  |        |              |         48 85 c0             	test   %rax,%rax
+    19ce:	|  |  |  \-----|--|--|--------|--|--|-----------|--|--|--|--|--------|--------------|-------- 0f 84 02 fa ff ff    	je     13d6 <main+0x216>
+    19d4:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |         66 0f 6f 54 24 20    	movdqa 0x20(%rsp),%xmm2
+            , line_num_(line_num)
+    19da:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |         c7 84 24 b0 00 00 00 	movl   $0x91,0xb0(%rsp)
+    19e1:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |         91 00 00 00 
+            : fn_name_(fn_name)
+    19e5:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |         0f 29 94 24 a0 00 00 	movaps %xmm2,0xa0(%rsp)
+    19ec:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |         00 
+    if (!pred) { assert_fail(msg, ctx); }
+    19ed:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |         4c 39 e5             	cmp    %r12,%rbp
+    19f0:	+--|--|--------|--|--|--------|--|--|-----------|--|--|--|--|--------|--------------|-------- 0f 82 78 03 00 00    	jb     1d6e <main+0xbae>
+                    new_n->len_ = old_n->len_;
+    19f6:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |         4c 89 60 08          	mov    %r12,0x8(%rax)
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    19fa:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |         48 8d 48 10          	lea    0x10(%rax),%rcx
+    19fe:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |         4c 8d 63 10          	lea    0x10(%rbx),%r12
+    if (d == s) { return; }
+    1a02:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |         49 39 cc             	cmp    %rcx,%r12
+    1a05:	|  +--|--------|--|--|--------|--|--|-----------|--|--|--|--|--------|--------------|-------- 0f 84 9d f9 ff ff    	je     13a8 <main+0x1e8>
+    1a0b:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |         48 8b 43 08          	mov    0x8(%rbx),%rax
+    } else if (d < s) {
+    1a0f:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |         4c 39 e1             	cmp    %r12,%rcx
+    1a12:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  /----- 72 74                	jb     1a88 <main+0x8c8>
+        for (Index i = n; i > 0; --i) {
+    1a14:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |      48 85 c0             	test   %rax,%rax
+    1a17:	|  +--|--------|--|--|--------|--|--|-----------|--|--|--|--|--------|--------------|--|----- 0f 84 8b f9 ff ff    	je     13a8 <main+0x1e8>
+    1a1d:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |      49 89 c4             	mov    %rax,%r12
+    1a20:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |      4c 89 7c 24 48       	mov    %r15,0x48(%rsp)
+    1a25:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |      49 89 c7             	mov    %rax,%r15
+    1a28:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |      49 c1 e4 08          	shl    $0x8,%r12
+    1a2c:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |      48 89 5c 24 50       	mov    %rbx,0x50(%rsp)
+    1a31:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |      49 81 ec f0 00 00 00 	sub    $0xf0,%r12
+    1a38:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |      4b 8d 0c 26          	lea    (%r14,%r12,1),%rcx
+    1a3c:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |      49 01 dc             	add    %rbx,%r12
+    1a3f:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |      48 89 cb             	mov    %rcx,%rbx
+    1a42:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |      66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+            nel::elem::move(data_, o.data_, N);
+    1a48:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |  /-> 4c 89 e6             	mov    %r12,%rsi
+    1a4b:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |  |   48 89 df             	mov    %rbx,%rdi
+    1a4e:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1a53:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |  |   48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    1a5a:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |  |   e8 f1 08 00 00       	call   2350 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1a5f:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |  |   4c 89 e7             	mov    %r12,%rdi
+    1a62:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1a67:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    1a6c:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |  |   e8 cf 08 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1a71:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |  |   49 81 ec 00 01 00 00 	sub    $0x100,%r12
+    1a78:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |  |   49 83 ef 01          	sub    $0x1,%r15
+    1a7c:	|  |  |        |  |  |        |  |  |           |  |  |  |  |        |              |  |  \-- 75 ca                	jne    1a48 <main+0x888>
+    1a7e:	|  |  |        |  \--|--------|--|--|-----------|--|--|--|--|--------|--------------|--|----- e9 1b f9 ff ff       	jmp    139e <main+0x1de>
+    1a83:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |  |      0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        for (Index i = 0; i < n; ++i) {
+    1a88:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |  \----> 48 85 c0             	test   %rax,%rax
+    1a8b:	|  +--|--------|-----|--------|--|--|-----------|--|--|--|--|--------|--------------|-------- 0f 84 17 f9 ff ff    	je     13a8 <main+0x1e8>
+    1a91:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |         45 31 c9             	xor    %r9d,%r9d
+    1a94:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |         4c 89 7c 24 48       	mov    %r15,0x48(%rsp)
+    1a99:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |         49 89 c7             	mov    %rax,%r15
+    1a9c:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |         48 89 5c 24 50       	mov    %rbx,0x50(%rsp)
+    1aa1:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |         4c 89 cb             	mov    %r9,%rbx
+    1aa4:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |         48 89 6c 24 58       	mov    %rbp,0x58(%rsp)
+    1aa9:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |         48 89 cd             	mov    %rcx,%rbp
+    1aac:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |         0f 1f 40 00          	nopl   0x0(%rax)
+            nel::elem::move(data_, o.data_, N);
+    1ab0:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |     /-> 4c 89 e6             	mov    %r12,%rsi
+    1ab3:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |     |   48 89 ef             	mov    %rbp,%rdi
+    1ab6:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    1abb:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |     |   48 83 c3 01          	add    $0x1,%rbx
+    1abf:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |     |   e8 8c 08 00 00       	call   2350 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1ac4:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |     |   4c 89 e7             	mov    %r12,%rdi
+    1ac7:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    1acc:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    1ad1:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |     |   e8 6a 08 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1ad6:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |     |   49 81 c4 00 01 00 00 	add    $0x100,%r12
+    1add:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |     |   48 81 c5 00 01 00 00 	add    $0x100,%rbp
+    1ae4:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |     |   49 39 df             	cmp    %rbx,%r15
+    1ae7:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |     \-- 75 c7                	jne    1ab0 <main+0x8f0>
+    1ae9:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |         4c 8b 7c 24 48       	mov    0x48(%rsp),%r15
+    1aee:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |         48 8b 5c 24 50       	mov    0x50(%rsp),%rbx
+    1af3:	|  |  |        |     |        |  |  |           |  |  |  |  |        |              |         48 8b 6c 24 58       	mov    0x58(%rsp),%rbp
+    1af8:	|  \--|--------|-----|--------|--|--|-----------|--|--|--|--|--------|--------------|-------- e9 ab f8 ff ff       	jmp    13a8 <main+0x1e8>
+                    nel::panic("invalid Result", ctx);
+    1afd:	|     |        |     |        |  |  |           |  |  |  |  |        |              \-------> 48 8d 3d 73 15 00 00 	lea    0x1573(%rip),%rdi        # 3077 <_IO_stdin_used+0x77>
+    1b04:	|     |        |     |        |  |  |           |  |  |  |  |        |                        e8 49 f6 ff ff       	call   1152 <nel::panic(char const*, nel::Context const&)>
+    1b09:	|     |        |     |        |  |  |           |  |  |  |  |        |                        0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1b10:	|     |        |     |        |  |  |           |  |  |  \--|--------|----------------------> 48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+    1b14:	|     |        |     |        |  |  |           |  |  |     |        |                        48 39 fa             	cmp    %rdi,%rdx
+    1b17:	|     |        |     |        |  |  |           |  |  |     |        |                        48 0f 42 d7          	cmovb  %rdi,%rdx
+    1b1b:	|     |        |     |        |  |  |           |  |  |     |        |                        48 39 ea             	cmp    %rbp,%rdx
+    1b1e:	|     |        |     |        |  |  |           |  |  |     |        |                        48 0f 42 d5          	cmovb  %rbp,%rdx
+    1b22:	|     |        |     |        |  |  |           |  |  |     |        |                        49 89 d7             	mov    %rdx,%r15
+            } else if (new_cap == item_->capacity()) {
+    1b25:	|     |        |     |        |  |  |           |  |  |     |        |                        48 39 c2             	cmp    %rax,%rdx
+    1b28:	|     |        |     |        |  |  |           \--|--|-----|--------|----------------------- 0f 84 96 fb ff ff    	je     16c4 <main+0x504>
+            } else if (new_cap > item_->capacity()) {
+    1b2e:	|     |        |     |        |  |  |              |  |     |        |                        48 39 d0             	cmp    %rdx,%rax
+    1b31:	|     |        |     |        |  |  |              |  \-----|--------|----------------------- 0f 82 82 fa ff ff    	jb     15b9 <main+0x3f9>
+            if (new_cap > max_capacity) { return nullptr; }
+    1b37:	|     |        |     |        |  |  |              |        |        |                        48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    1b3e:	|     |        |     |        |  |  |              |        |        |                        ff 7f 00 
+    1b41:	|     |        |     |        |  |  |              |        |        |                        48 39 d0             	cmp    %rdx,%rax
+    1b44:	|     |        |     |        |  +--|--------------|--------|--------|----------------------- 0f 82 83 fb ff ff    	jb     16cd <main+0x50d>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1b4a:	|     |        |     |        |  |  |              |        |        |                        48 89 d7             	mov    %rdx,%rdi
+    1b4d:	|     |        |     |        |  |  |              |        |        |                        48 c1 e7 08          	shl    $0x8,%rdi
+    1b51:	|     |        |     |        |  |  |              |        |        |                        48 83 c7 10          	add    $0x10,%rdi
+                                    : std::realloc(p, new_size);
+    1b55:	|     |        |     |        |  |  |              |        |        |                        e8 76 f5 ff ff       	call   10d0 <malloc@plt>
+    1b5a:	|     |        |     |        |  |  |              |        |        |                        49 89 c0             	mov    %rax,%r8
+            if (new_p == nullptr) {
+    1b5d:	|     |        |     |        |  |  |              |        |        |                        48 85 c0             	test   %rax,%rax
+    1b60:	|     |        |     |        |  +--|--------------|--------|--------|----------------------- 0f 84 67 fb ff ff    	je     16cd <main+0x50d>
+            : fn_name_(fn_name)
+    1b66:	|     |        |     |        |  |  |              |        |        |                        66 0f 6f 7c 24 20    	movdqa 0x20(%rsp),%xmm7
+            , line_num_(line_num)
+    1b6c:	|     |        |     |        |  |  |              |        |        |                        c7 84 24 b0 00 00 00 	movl   $0x91,0xb0(%rsp)
+    1b73:	|     |        |     |        |  |  |              |        |        |                        91 00 00 00 
+            : fn_name_(fn_name)
+    1b77:	|     |        |     |        |  |  |              |        |        |                        0f 29 bc 24 a0 00 00 	movaps %xmm7,0xa0(%rsp)
+    1b7e:	|     |        |     |        |  |  |              |        |        |                        00 
+    if (!pred) { assert_fail(msg, ctx); }
+    1b7f:	|     |        |     |        |  |  |              |        |        |                        49 39 ef             	cmp    %rbp,%r15
+    1b82:	|     +--------|-----|--------|--|--|--------------|--------|--------|----------------------- 0f 82 f7 01 00 00    	jb     1d7f <main+0xbbf>
+                    new_n->len_ = old_n->len_;
+    1b88:	|     |        |     |        |  |  |              |        |        |                        48 89 68 08          	mov    %rbp,0x8(%rax)
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    1b8c:	|     |        |     |        |  |  |              |        |        |                        49 8d 6d 10          	lea    0x10(%r13),%rbp
+    1b90:	|     |        |     |        |  |  |              |        |        |                        48 8d 40 10          	lea    0x10(%rax),%rax
+    if (d == s) { return; }
+    1b94:	|     |        |     |        |  |  |              |        |        |                        48 39 c5             	cmp    %rax,%rbp
+    1b97:	|     |        +-----|--------|--|--|--------------|--------|--------|----------------------- 0f 84 08 fb ff ff    	je     16a5 <main+0x4e5>
+    1b9d:	|     |        |     |        |  |  |              |        |        |                        49 8b 7d 08          	mov    0x8(%r13),%rdi
+    } else if (d < s) {
+    1ba1:	|     |        |     |        |  |  |              |        |        |                        48 39 e8             	cmp    %rbp,%rax
+    1ba4:	|     |        |     |        |  |  |              |        |        |              /-------- 0f 82 58 01 00 00    	jb     1d02 <main+0xb42>
+        for (Index i = n; i > 0; --i) {
+    1baa:	|     |        |     |        |  |  |              |        |        |              |         48 85 ff             	test   %rdi,%rdi
+    1bad:	|     |        +-----|--------|--|--|--------------|--------|--------|--------------|-------- 0f 84 f2 fa ff ff    	je     16a5 <main+0x4e5>
+    1bb3:	|     |        |     |        |  |  |              |        |        |              |         48 89 fd             	mov    %rdi,%rbp
+    1bb6:	|     |        |     |        |  |  |              |        |        |              |         4c 89 44 24 50       	mov    %r8,0x50(%rsp)
+    1bbb:	|     |        |     |        |  |  |              |        |        |              |         48 c1 e5 08          	shl    $0x8,%rbp
+    1bbf:	|     |        |     |        |  |  |              |        |        |              |         4c 89 7c 24 08       	mov    %r15,0x8(%rsp)
+    1bc4:	|     |        |     |        |  |  |              |        |        |              |         49 89 ff             	mov    %rdi,%r15
+    1bc7:	|     |        |     |        |  |  |              |        |        |              |         48 81 ed f0 00 00 00 	sub    $0xf0,%rbp
+    1bce:	|     |        |     |        |  |  |              |        |        |              |         48 89 5c 24 58       	mov    %rbx,0x58(%rsp)
+    1bd3:	|     |        |     |        |  |  |              |        |        |              |         49 8d 04 28          	lea    (%r8,%rbp,1),%rax
+    1bd7:	|     |        |     |        |  |  |              |        |        |              |         4c 01 ed             	add    %r13,%rbp
+    1bda:	|     |        |     |        |  |  |              |        |        |              |         48 89 c3             	mov    %rax,%rbx
+    1bdd:	|     |        |     |        |  |  |              |        |        |              |         0f 1f 00             	nopl   (%rax)
+            nel::elem::move(data_, o.data_, N);
+    1be0:	|     |        |     |        |  |  |              |        |        |              |     /-> 48 89 ee             	mov    %rbp,%rsi
+    1be3:	|     |        |     |        |  |  |              |        |        |              |     |   48 89 df             	mov    %rbx,%rdi
+    1be6:	|     |        |     |        |  |  |              |        |        |              |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    1beb:	|     |        |     |        |  |  |              |        |        |              |     |   48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    1bf2:	|     |        |     |        |  |  |              |        |        |              |     |   e8 59 07 00 00       	call   2350 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1bf7:	|     |        |     |        |  |  |              |        |        |              |     |   48 89 ef             	mov    %rbp,%rdi
+    1bfa:	|     |        |     |        |  |  |              |        |        |              |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    1bff:	|     |        |     |        |  |  |              |        |        |              |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    1c04:	|     |        |     |        |  |  |              |        |        |              |     |   e8 37 07 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1c09:	|     |        |     |        |  |  |              |        |        |              |     |   48 81 ed 00 01 00 00 	sub    $0x100,%rbp
+    1c10:	|     |        |     |        |  |  |              |        |        |              |     |   49 83 ef 01          	sub    $0x1,%r15
+    1c14:	|     |        |     |        |  |  |              |        |        |              |     \-- 75 ca                	jne    1be0 <main+0xa20>
+    1c16:	|     |        |     |        |  |  |              \--------|--------|--------------|-------- e9 7b fa ff ff       	jmp    1696 <main+0x4d6>
+    1c1b:	|     |        |     |        |  |  |                       \--------|--------------|-------> 48 c1 e5 08          	shl    $0x8,%rbp
+    1c1f:	|     |        |     |        |  |  |                                |              |         48 8d 7d 10          	lea    0x10(%rbp),%rdi
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    1c23:	|     |        |     |        |  |  |                                |              |     /-> 41 0f b6 f6          	movzbl %r14b,%esi
+            nel::elem::set(data_, f, N);
+    1c27:	|     |        |     |        |  |  |                                |              |     |   4c 01 ef             	add    %r13,%rdi
+    1c2a:	|     |        |     |        |  |  |                                |              |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    1c2f:	|     |        |     |        |  |  |                                |              |     |   49 83 c4 01          	add    $0x1,%r12
+    1c33:	|     |        |     |        |  |  |                                |              |     |   e8 08 07 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            len_ += 1;
+    1c38:	|     |        |     |        |  |  |                                |              |     |   49 83 45 08 01       	addq   $0x1,0x8(%r13)
+    1c3d:	|     |        |     |        |  |  |                                |              |     |   49 81 fc e8 03 00 00 	cmp    $0x3e8,%r12
+    1c44:	|     |        |     |        |  |  |                                \--------------|-----|-- 0f 84 f0 fa ff ff    	je     173a <main+0x57a>
+    1c4a:	|     |        |     |        |  |  |                                               |     |   45 89 e6             	mov    %r12d,%r14d
+        constexpr Length len(void) const
+    1c4d:	|     |        |     |        \--|--|-----------------------------------------------|-----|-- e9 32 f9 ff ff       	jmp    1584 <main+0x3c4>
+    1c52:	|     |        |     |           |  |                                               |     |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+                                    : std::realloc(p, new_size);
+    1c58:	|     |        |     \-----------|--|-----------------------------------------------|-----|-> bf 10 04 00 00       	mov    $0x410,%edi
+    1c5d:	|     |        |                 |  |                                               |     |   e8 6e f4 ff ff       	call   10d0 <malloc@plt>
+    1c62:	|     |        |                 |  |                                               |     |   49 89 c5             	mov    %rax,%r13
+            if (new_p == nullptr) {
+    1c65:	|     |        |                 |  |                                               |     |   48 85 c0             	test   %rax,%rax
+    1c68:	|     |        |                 \--|-----------------------------------------------|-----|-- 0f 84 5f fa ff ff    	je     16cd <main+0x50d>
+            new_n->alloc_ = new_cap;
+    1c6e:	|     |        |                    |                                               |     |   66 0f 6f 2d aa 14 00 	movdqa 0x14aa(%rip),%xmm5        # 3120 <_IO_stdin_used+0x120>
+    1c75:	|     |        |                    |                                               |     |   00 
+    1c76:	|     |        |                    |                                               |     |   bf 10 00 00 00       	mov    $0x10,%edi
+    1c7b:	|     |        |                    |                                               |     |   0f 11 28             	movups %xmm5,(%rax)
+        constexpr Length len(void) const
+    1c7e:	|     |        |                    |                                               |     \-- eb a3                	jmp    1c23 <main+0xa63>
+        for (Index i = 0; i < n; ++i) {
+    1c80:	|     |        |                    \-----------------------------------------------|-------> 48 85 ff             	test   %rdi,%rdi
+    1c83:	|     |        +--------------------------------------------------------------------|-------- 0f 84 1c fa ff ff    	je     16a5 <main+0x4e5>
+    1c89:	|     |        |                                                                    |         4c 89 44 24 58       	mov    %r8,0x58(%rsp)
+    1c8e:	|     |        |                                                                    |         45 31 c9             	xor    %r9d,%r9d
+    1c91:	|     |        |                                                                    |         4c 89 7c 24 08       	mov    %r15,0x8(%rsp)
+    1c96:	|     |        |                                                                    |         49 89 ff             	mov    %rdi,%r15
+    1c99:	|     |        |                                                                    |         4c 89 64 24 50       	mov    %r12,0x50(%rsp)
+    1c9e:	|     |        |                                                                    |         49 89 c4             	mov    %rax,%r12
+    1ca1:	|     |        |                                                                    |         48 89 5c 24 60       	mov    %rbx,0x60(%rsp)
+    1ca6:	|     |        |                                                                    |         4c 89 cb             	mov    %r9,%rbx
+    1ca9:	|     |        |                                                                    |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            nel::elem::move(data_, o.data_, N);
+    1cb0:	|     |        |                                                                    |     /-> 48 89 ee             	mov    %rbp,%rsi
+    1cb3:	|     |        |                                                                    |     |   4c 89 e7             	mov    %r12,%rdi
+    1cb6:	|     |        |                                                                    |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    1cbb:	|     |        |                                                                    |     |   48 83 c3 01          	add    $0x1,%rbx
+    1cbf:	|     |        |                                                                    |     |   e8 8c 06 00 00       	call   2350 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1cc4:	|     |        |                                                                    |     |   48 89 ef             	mov    %rbp,%rdi
+    1cc7:	|     |        |                                                                    |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    1ccc:	|     |        |                                                                    |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    1cd1:	|     |        |                                                                    |     |   e8 6a 06 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1cd6:	|     |        |                                                                    |     |   49 81 c4 00 01 00 00 	add    $0x100,%r12
+    1cdd:	|     |        |                                                                    |     |   48 81 c5 00 01 00 00 	add    $0x100,%rbp
+    1ce4:	|     |        |                                                                    |     |   49 39 df             	cmp    %rbx,%r15
+    1ce7:	|     |        |                                                                    |     \-- 75 c7                	jne    1cb0 <main+0xaf0>
+    1ce9:	|     |        |                                                                    |  /----> 4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+    1cee:	|     |        |                                                                    |  |      4c 8b 64 24 50       	mov    0x50(%rsp),%r12
+    1cf3:	|     |        |                                                                    |  |      4c 8b 44 24 58       	mov    0x58(%rsp),%r8
+    1cf8:	|     |        |                                                                    |  |      48 8b 5c 24 60       	mov    0x60(%rsp),%rbx
+    1cfd:	|     |        +--------------------------------------------------------------------|--|----- e9 a3 f9 ff ff       	jmp    16a5 <main+0x4e5>
+    1d02:	|     |        |                                                                    \--|----> 48 85 ff             	test   %rdi,%rdi
+    1d05:	|     |        \-----------------------------------------------------------------------|----- 0f 84 9a f9 ff ff    	je     16a5 <main+0x4e5>
+    1d0b:	|     |                                                                                |      4c 89 44 24 58       	mov    %r8,0x58(%rsp)
+    1d10:	|     |                                                                                |      45 31 c9             	xor    %r9d,%r9d
+    1d13:	|     |                                                                                |      4c 89 7c 24 08       	mov    %r15,0x8(%rsp)
+    1d18:	|     |                                                                                |      49 89 ff             	mov    %rdi,%r15
+    1d1b:	|     |                                                                                |      4c 89 64 24 50       	mov    %r12,0x50(%rsp)
+    1d20:	|     |                                                                                |      4d 89 cc             	mov    %r9,%r12
+    1d23:	|     |                                                                                |      48 89 5c 24 60       	mov    %rbx,0x60(%rsp)
+    1d28:	|     |                                                                                |      48 89 c3             	mov    %rax,%rbx
+    1d2b:	|     |                                                                                |      0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+            nel::elem::move(data_, o.data_, N);
+    1d30:	|     |                                                                                |  /-> 48 89 ee             	mov    %rbp,%rsi
+    1d33:	|     |                                                                                |  |   48 89 df             	mov    %rbx,%rdi
+    1d36:	|     |                                                                                |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1d3b:	|     |                                                                                |  |   49 83 c4 01          	add    $0x1,%r12
+    1d3f:	|     |                                                                                |  |   e8 0c 06 00 00       	call   2350 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1d44:	|     |                                                                                |  |   48 89 ef             	mov    %rbp,%rdi
+    1d47:	|     |                                                                                |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1d4c:	|     |                                                                                |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    1d51:	|     |                                                                                |  |   e8 ea 05 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1d56:	|     |                                                                                |  |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    1d5d:	|     |                                                                                |  |   48 81 c5 00 01 00 00 	add    $0x100,%rbp
+    1d64:	|     |                                                                                |  |   4d 39 e7             	cmp    %r12,%r15
+    1d67:	|     |                                                                                |  \-- 75 c7                	jne    1d30 <main+0xb70>
+    1d69:	|     |                                                                                \----- e9 7b ff ff ff       	jmp    1ce9 <main+0xb29>
+    1d6e:	\-----|-------------------------------------------------------------------------------------> 48 8b 74 24 68       	mov    0x68(%rsp),%rsi
+    1d73:	      |                                                                                       48 8d 3d 7e 13 00 00 	lea    0x137e(%rip),%rdi        # 30f8 <_IO_stdin_used+0xf8>
+    1d7a:	      |                                                                                       e8 03 f4 ff ff       	call   1182 <nel::assert_fail(char const*, nel::Context const&)>
+    1d7f:	      \-------------------------------------------------------------------------------------> 48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1d84:	                                                                                              48 8d 3d 6d 13 00 00 	lea    0x136d(%rip),%rdi        # 30f8 <_IO_stdin_used+0xf8>
+    1d8b:	                                                                                              e8 f2 f3 ff ff       	call   1182 <nel::assert_fail(char const*, nel::Context const&)>
+
+0000000000001d90 <_start>:
+    1d90:	31 ed                	xor    %ebp,%ebp
+    1d92:	49 89 d1             	mov    %rdx,%r9
+    1d95:	5e                   	pop    %rsi
+    1d96:	48 89 e2             	mov    %rsp,%rdx
+    1d99:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    1d9d:	50                   	push   %rax
+    1d9e:	54                   	push   %rsp
+    1d9f:	45 31 c0             	xor    %r8d,%r8d
+    1da2:	31 c9                	xor    %ecx,%ecx
+    1da4:	48 8d 3d 15 f4 ff ff 	lea    -0xbeb(%rip),%rdi        # 11c0 <main>
+    1dab:	ff 15 17 32 00 00    	call   *0x3217(%rip)        # 4fc8 <__libc_start_main@GLIBC_2.34>
+    1db1:	f4                   	hlt
+    1db2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1db9:	00 00 00 
+    1dbc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001dc0 <deregister_tm_clones>:
+    1dc0:	    48 8d 3d b9 32 00 00 	lea    0x32b9(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1dc7:	    48 8d 05 b2 32 00 00 	lea    0x32b2(%rip),%rax        # 5080 <stderr@GLIBC_2.2.5>
+    1dce:	    48 39 f8             	cmp    %rdi,%rax
+    1dd1:	/-- 74 15                	je     1de8 <deregister_tm_clones+0x28>
+    1dd3:	|   48 8b 05 f6 31 00 00 	mov    0x31f6(%rip),%rax        # 4fd0 <_ITM_deregisterTMCloneTable@Base>
+    1dda:	|   48 85 c0             	test   %rax,%rax
+    1ddd:	+-- 74 09                	je     1de8 <deregister_tm_clones+0x28>
+    1ddf:	|   ff e0                	jmp    *%rax
+    1de1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1de8:	\-> c3                   	ret
+    1de9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001df0 <register_tm_clones>:
+    1df0:	    48 8d 3d 89 32 00 00 	lea    0x3289(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1df7:	    48 8d 35 82 32 00 00 	lea    0x3282(%rip),%rsi        # 5080 <stderr@GLIBC_2.2.5>
+    1dfe:	    48 29 fe             	sub    %rdi,%rsi
+    1e01:	    48 89 f0             	mov    %rsi,%rax
+    1e04:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1e08:	    48 c1 f8 03          	sar    $0x3,%rax
+    1e0c:	    48 01 c6             	add    %rax,%rsi
+    1e0f:	    48 d1 fe             	sar    %rsi
+    1e12:	/-- 74 14                	je     1e28 <register_tm_clones+0x38>
+    1e14:	|   48 8b 05 c5 31 00 00 	mov    0x31c5(%rip),%rax        # 4fe0 <_ITM_registerTMCloneTable@Base>
+    1e1b:	|   48 85 c0             	test   %rax,%rax
+    1e1e:	+-- 74 08                	je     1e28 <register_tm_clones+0x38>
+    1e20:	|   ff e0                	jmp    *%rax
+    1e22:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1e28:	\-> c3                   	ret
+    1e29:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001e30 <__do_global_dtors_aux>:
+    1e30:	       f3 0f 1e fa          	endbr64
+    1e34:	       80 3d 4d 32 00 00 00 	cmpb   $0x0,0x324d(%rip)        # 5088 <completed.0>
+    1e3b:	/----- 75 2b                	jne    1e68 <__do_global_dtors_aux+0x38>
+    1e3d:	|      55                   	push   %rbp
+    1e3e:	|      48 83 3d 7a 31 00 00 	cmpq   $0x0,0x317a(%rip)        # 4fc0 <__cxa_finalize@GLIBC_2.2.5>
+    1e45:	|      00 
+    1e46:	|      48 89 e5             	mov    %rsp,%rbp
+    1e49:	|  /-- 74 0c                	je     1e57 <__do_global_dtors_aux+0x27>
+    1e4b:	|  |   48 8b 3d 26 32 00 00 	mov    0x3226(%rip),%rdi        # 5078 <__dso_handle>
+    1e52:	|  |   e8 b9 f2 ff ff       	call   1110 <__cxa_finalize@plt>
+    1e57:	|  \-> e8 64 ff ff ff       	call   1dc0 <deregister_tm_clones>
+    1e5c:	|      c6 05 25 32 00 00 01 	movb   $0x1,0x3225(%rip)        # 5088 <completed.0>
+    1e63:	|      5d                   	pop    %rbp
+    1e64:	|      c3                   	ret
+    1e65:	|      0f 1f 00             	nopl   (%rax)
+    1e68:	\----> c3                   	ret
+    1e69:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001e70 <frame_dummy>:
+    1e70:	f3 0f 1e fa          	endbr64
+    1e74:	e9 77 ff ff ff       	jmp    1df0 <register_tm_clones>
+    1e79:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001e80 <_close_r>:
+// The explicit on/off runs are the same in all builds.
+    1e80:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1e85:	c3                   	ret
+    1e86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1e8d:	00 00 00 
+
+0000000000001e90 <_fstat_r>:
+
+    1e90:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1e95:	c3                   	ret
+    1e96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1e9d:	00 00 00 
+
+0000000000001ea0 <_kill_r>:
+#include <nel/log.hh>
+    1ea0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ea5:	c3                   	ret
+    1ea6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1ead:	00 00 00 
+
+0000000000001eb0 <_lseek_r>:
+#include "libnosys_stubs.cx"
+    1eb0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1eb5:	c3                   	ret
+    1eb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1ebd:	00 00 00 
+
+0000000000001ec0 <_read_r>:
+
+    1ec0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ec5:	c3                   	ret
+    1ec6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1ecd:	00 00 00 
+
+0000000000001ed0 <_write_r>:
+static uint8_t buf1[buf_size];
+    1ed0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ed5:	c3                   	ret
+    1ed6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1edd:	00 00 00 
+
+0000000000001ee0 <_getpid_r>:
+void bench_moves(void)
+    1ee0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ee5:	c3                   	ret
+    1ee6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1eed:	00 00 00 
+
+0000000000001ef0 <_isatty_r>:
+{
+    1ef0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ef5:	c3                   	ret
+    1ef6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1efd:	00 00 00 
+
+0000000000001f00 <bench_moves()>:
+    1f00:	                   41 57                	push   %r15
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1f02:	                   bf 01 00 00 00       	mov    $0x1,%edi
+    1f07:	                   41 56                	push   %r14
+    1f09:	                   41 55                	push   %r13
+    1f0b:	                   41 54                	push   %r12
+    1f0d:	                   41 bc 00 10 00 00    	mov    $0x1000,%r12d
+    1f13:	                   55                   	push   %rbp
+    1f14:	                   48 8d 2d 85 31 00 00 	lea    0x3185(%rip),%rbp        # 50a0 <buf2>
+    1f1b:	                   53                   	push   %rbx
+    1f1c:	                   48 8d 1d 7d 31 01 00 	lea    0x1317d(%rip),%rbx        # 150a0 <buf1>
+    1f23:	                   48 83 ec 28          	sub    $0x28,%rsp
+    1f27:	                   4c 8d 6c 24 10       	lea    0x10(%rsp),%r13
+    1f2c:	                   4c 89 ee             	mov    %r13,%rsi
+    1f2f:	                   e8 3c f1 ff ff       	call   1070 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1f34:	                   4c 8b 7c 24 18       	mov    0x18(%rsp),%r15
+    1f39:	                   4c 69 74 24 10 00 ca 	imul   $0x3b9aca00,0x10(%rsp),%r14
+    1f40:	                   9a 3b 
+        for (Index i = 0; i < n_moves; ++i) {
+    1f42:	                   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+            nel::elem::copy(buf2, buf1, buf_size);
+    1f48:	               /-> ba 00 00 01 00       	mov    $0x10000,%edx
+    1f4d:	               |   48 89 de             	mov    %rbx,%rsi
+    1f50:	               |   48 89 ef             	mov    %rbp,%rdi
+    1f53:	               |   e8 d8 03 00 00       	call   2330 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+            nel::elem::wipe(buf1, buf_size);
+    1f58:	               |   be 00 00 01 00       	mov    $0x10000,%esi
+    1f5d:	               |   48 89 df             	mov    %rbx,%rdi
+    1f60:	               |   e8 0b 04 00 00       	call   2370 <nel::elem::wipe(unsigned char*, unsigned long)>
+            nel::elem::copy(buf1, buf2, buf_size);
+    1f65:	               |   48 89 ee             	mov    %rbp,%rsi
+    1f68:	               |   48 89 df             	mov    %rbx,%rdi
+    1f6b:	               |   ba 00 00 01 00       	mov    $0x10000,%edx
+    1f70:	               |   e8 bb 03 00 00       	call   2330 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+            nel::elem::wipe(buf2, buf_size);
+    1f75:	               |   be 00 00 01 00       	mov    $0x10000,%esi
+    1f7a:	               |   48 89 ef             	mov    %rbp,%rdi
+    1f7d:	               |   e8 ee 03 00 00       	call   2370 <nel::elem::wipe(unsigned char*, unsigned long)>
+        for (Index i = 0; i < n_moves; ++i) {
+    1f82:	               |   49 83 ec 01          	sub    $0x1,%r12
+    1f86:	               \-- 75 c0                	jne    1f48 <bench_moves()+0x48>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1f88:	                   4c 89 ee             	mov    %r13,%rsi
+    1f8b:	                   bf 01 00 00 00       	mov    $0x1,%edi
+    nel::log << name << ": " << ns / 1000UL << "us";
+    1f90:	                   4c 8d 25 09 31 02 00 	lea    0x23109(%rip),%r12        # 250a0 <nel::log>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1f97:	                   e8 d4 f0 ff ff       	call   1070 <clock_gettime@plt>
+    nel::log << name << ": " << ns / 1000UL << "us";
+    1f9c:	                   48 8d 35 61 10 00 00 	lea    0x1061(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+    1fa3:	                   4c 89 e7             	mov    %r12,%rdi
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1fa6:	                   48 69 44 24 10 00 ca 	imul   $0x3b9aca00,0x10(%rsp),%rax
+    1fad:	                   9a 3b 
+    1faf:	                   4c 29 f8             	sub    %r15,%rax
+    return now_ns() - b;
+    1fb2:	                   48 03 44 24 18       	add    0x18(%rsp),%rax
+    1fb7:	                   4c 29 f0             	sub    %r14,%rax
+    nel::log << name << ": " << ns / 1000UL << "us";
+    1fba:	                   4c 8d 35 52 10 00 00 	lea    0x1052(%rip),%r14        # 3013 <_IO_stdin_used+0x13>
+    return now_ns() - b;
+    1fc1:	                   49 89 c7             	mov    %rax,%r15
+    nel::log << name << ": " << ns / 1000UL << "us";
+    1fc4:	                   e8 07 0c 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    1fc9:	                   4c 89 f6             	mov    %r14,%rsi
+    1fcc:	                   48 89 c7             	mov    %rax,%rdi
+    1fcf:	                   e8 fc 0b 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    1fd4:	                   4c 89 fa             	mov    %r15,%rdx
+    1fd7:	                   48 89 c7             	mov    %rax,%rdi
+    1fda:	                   48 c1 ea 03          	shr    $0x3,%rdx
+    1fde:	                   48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    1fe5:	                   9b c4 20 
+    1fe8:	                   48 f7 e2             	mul    %rdx
+    1feb:	                   48 c1 ea 04          	shr    $0x4,%rdx
+    1fef:	                   48 89 d6             	mov    %rdx,%rsi
+    1ff2:	                   e8 99 0c 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned long)>
+    1ff7:	                   48 8d 35 18 10 00 00 	lea    0x1018(%rip),%rsi        # 3016 <_IO_stdin_used+0x16>
+    1ffe:	                   48 89 c7             	mov    %rax,%rdi
+    2001:	                   e8 ca 0b 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    if (bytes != 0 && ns != 0) {
+    2006:	                   4d 85 ff             	test   %r15,%r15
+    2009:	   /-------------- 0f 85 5f 02 00 00    	jne    226e <bench_moves()+0x36e>
+    nel::log << '\n';
+    200f:	/--|-------------> be 0a 00 00 00       	mov    $0xa,%esi
+    2014:	|  |               4c 89 e7             	mov    %r12,%rdi
+    2017:	|  |               41 bf 00 10 00 00    	mov    $0x1000,%r15d
+    201d:	|  |               e8 8e 0b 00 00       	call   2bb0 <nel::operator<<(nel::Log&, char)>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    2022:	|  |               4c 89 ee             	mov    %r13,%rsi
+    2025:	|  |               bf 01 00 00 00       	mov    $0x1,%edi
+    202a:	|  |               e8 41 f0 ff ff       	call   1070 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    202f:	|  |               48 69 44 24 10 00 ca 	imul   $0x3b9aca00,0x10(%rsp),%rax
+    2036:	|  |               9a 3b 
+    2038:	|  |               48 89 04 24          	mov    %rax,(%rsp)
+    203c:	|  |               48 8b 44 24 18       	mov    0x18(%rsp),%rax
+    2041:	|  |               48 89 44 24 08       	mov    %rax,0x8(%rsp)
+        for (Index i = 0; i < n_moves; ++i) {
+    2046:	|  |               66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    204d:	|  |               00 00 00 
+            nel::elem::copy(buf2, buf1, buf_size);
+    2050:	|  |           /-> ba 00 00 01 00       	mov    $0x10000,%edx
+    2055:	|  |           |   48 89 de             	mov    %rbx,%rsi
+    2058:	|  |           |   48 89 ef             	mov    %rbp,%rdi
+    205b:	|  |           |   e8 d0 02 00 00       	call   2330 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+            nel::elem::copy(buf1, buf2, buf_size);
+    2060:	|  |           |   ba 00 00 01 00       	mov    $0x10000,%edx
+    2065:	|  |           |   48 89 ee             	mov    %rbp,%rsi
+    2068:	|  |           |   48 89 df             	mov    %rbx,%rdi
+    206b:	|  |           |   e8 c0 02 00 00       	call   2330 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        for (Index i = 0; i < n_moves; ++i) {
+    2070:	|  |           |   49 83 ef 01          	sub    $0x1,%r15
+    2074:	|  |           \-- 75 da                	jne    2050 <bench_moves()+0x150>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    2076:	|  |               4c 89 ee             	mov    %r13,%rsi
+    2079:	|  |               bf 01 00 00 00       	mov    $0x1,%edi
+    207e:	|  |               e8 ed ef ff ff       	call   1070 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2083:	|  |               48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    nel::log << name << ": " << ns / 1000UL << "us";
+    2088:	|  |               48 8d 35 92 0f 00 00 	lea    0xf92(%rip),%rsi        # 3021 <_IO_stdin_used+0x21>
+    208f:	|  |               4c 89 e7             	mov    %r12,%rdi
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2092:	|  |               48 69 5c 24 10 00 ca 	imul   $0x3b9aca00,0x10(%rsp),%rbx
+    2099:	|  |               9a 3b 
+    209b:	|  |               48 29 c3             	sub    %rax,%rbx
+    return now_ns() - b;
+    209e:	|  |               48 8b 04 24          	mov    (%rsp),%rax
+    20a2:	|  |               48 03 5c 24 18       	add    0x18(%rsp),%rbx
+    20a7:	|  |               48 29 c3             	sub    %rax,%rbx
+    nel::log << name << ": " << ns / 1000UL << "us";
+    20aa:	|  |               e8 21 0b 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    20af:	|  |               4c 89 f6             	mov    %r14,%rsi
+    20b2:	|  |               48 89 c7             	mov    %rax,%rdi
+    20b5:	|  |               e8 16 0b 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    20ba:	|  |               48 89 da             	mov    %rbx,%rdx
+    20bd:	|  |               48 89 c7             	mov    %rax,%rdi
+    20c0:	|  |               48 c1 ea 03          	shr    $0x3,%rdx
+    20c4:	|  |               48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    20cb:	|  |               9b c4 20 
+    20ce:	|  |               48 f7 e2             	mul    %rdx
+    20d1:	|  |               48 c1 ea 04          	shr    $0x4,%rdx
+    20d5:	|  |               48 89 d6             	mov    %rdx,%rsi
+    20d8:	|  |               e8 b3 0b 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned long)>
+    20dd:	|  |               48 8d 35 32 0f 00 00 	lea    0xf32(%rip),%rsi        # 3016 <_IO_stdin_used+0x16>
+    20e4:	|  |               48 89 c7             	mov    %rax,%rdi
+    20e7:	|  |               e8 e4 0a 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    if (bytes != 0 && ns != 0) {
+    20ec:	|  |               48 85 db             	test   %rbx,%rbx
+    20ef:	|  |     /-------- 0f 85 f3 01 00 00    	jne    22e8 <bench_moves()+0x3e8>
+    nel::log << '\n';
+    20f5:	|  |  /--|-------> be 0a 00 00 00       	mov    $0xa,%esi
+    20fa:	|  |  |  |         4c 89 e7             	mov    %r12,%rdi
+    20fd:	|  |  |  |         bb 00 10 00 00       	mov    $0x1000,%ebx
+    2102:	|  |  |  |         e8 a9 0a 00 00       	call   2bb0 <nel::operator<<(nel::Log&, char)>
+    U8Buf<buf_size> *a = new U8Buf<buf_size>((uint8_t)0x12);
+    2107:	|  |  |  |         bf 00 00 01 00       	mov    $0x10000,%edi
+    210c:	|  |  |  |         e8 6f ef ff ff       	call   1080 <operator new(unsigned long)@plt>
+            nel::elem::set(data_, f, N);
+    2111:	|  |  |  |         ba 00 00 01 00       	mov    $0x10000,%edx
+    2116:	|  |  |  |         be 12 00 00 00       	mov    $0x12,%esi
+    211b:	|  |  |  |         48 89 c7             	mov    %rax,%rdi
+    211e:	|  |  |  |         49 89 c7             	mov    %rax,%r15
+    2121:	|  |  |  |         e8 1a 02 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    U8Buf<buf_size> *b = new U8Buf<buf_size>((uint8_t)0x34);
+    2126:	|  |  |  |         bf 00 00 01 00       	mov    $0x10000,%edi
+    212b:	|  |  |  |         e8 50 ef ff ff       	call   1080 <operator new(unsigned long)@plt>
+    2130:	|  |  |  |         ba 00 00 01 00       	mov    $0x10000,%edx
+    2135:	|  |  |  |         be 34 00 00 00       	mov    $0x34,%esi
+    213a:	|  |  |  |         48 89 c7             	mov    %rax,%rdi
+    213d:	|  |  |  |         48 89 c5             	mov    %rax,%rbp
+    2140:	|  |  |  |         e8 fb 01 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    2145:	|  |  |  |         4c 89 ee             	mov    %r13,%rsi
+    2148:	|  |  |  |         bf 01 00 00 00       	mov    $0x1,%edi
+    214d:	|  |  |  |         e8 1e ef ff ff       	call   1070 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2152:	|  |  |  |         48 69 44 24 10 00 ca 	imul   $0x3b9aca00,0x10(%rsp),%rax
+    2159:	|  |  |  |         9a 3b 
+    215b:	|  |  |  |         48 89 04 24          	mov    %rax,(%rsp)
+    215f:	|  |  |  |         48 8b 44 24 18       	mov    0x18(%rsp),%rax
+    2164:	|  |  |  |         48 89 44 24 08       	mov    %rax,0x8(%rsp)
+        for (Index i = 0; i < n_moves; ++i) {
+    2169:	|  |  |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            nel::elem::move(data_, o.data_, N);
+    2170:	|  |  |  |     /-> ba 00 00 01 00       	mov    $0x10000,%edx
+    2175:	|  |  |  |     |   4c 89 fe             	mov    %r15,%rsi
+    2178:	|  |  |  |     |   48 89 ef             	mov    %rbp,%rdi
+    217b:	|  |  |  |     |   e8 d0 01 00 00       	call   2350 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    2180:	|  |  |  |     |   ba 00 00 01 00       	mov    $0x10000,%edx
+    2185:	|  |  |  |     |   48 89 ee             	mov    %rbp,%rsi
+    2188:	|  |  |  |     |   4c 89 ff             	mov    %r15,%rdi
+    218b:	|  |  |  |     |   e8 c0 01 00 00       	call   2350 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    2190:	|  |  |  |     |   48 83 eb 01          	sub    $0x1,%rbx
+    2194:	|  |  |  |     \-- 75 da                	jne    2170 <bench_moves()+0x270>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    2196:	|  |  |  |         4c 89 ee             	mov    %r13,%rsi
+    2199:	|  |  |  |         bf 01 00 00 00       	mov    $0x1,%edi
+    219e:	|  |  |  |         e8 cd ee ff ff       	call   1070 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    21a3:	|  |  |  |         48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    nel::log << name << ": " << ns / 1000UL << "us";
+    21a8:	|  |  |  |         48 8d 35 19 0f 00 00 	lea    0xf19(%rip),%rsi        # 30c8 <_IO_stdin_used+0xc8>
+    21af:	|  |  |  |         4c 89 e7             	mov    %r12,%rdi
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    21b2:	|  |  |  |         48 69 5c 24 10 00 ca 	imul   $0x3b9aca00,0x10(%rsp),%rbx
+    21b9:	|  |  |  |         9a 3b 
+    21bb:	|  |  |  |         48 29 c3             	sub    %rax,%rbx
+    return now_ns() - b;
+    21be:	|  |  |  |         48 8b 04 24          	mov    (%rsp),%rax
+    21c2:	|  |  |  |         48 03 5c 24 18       	add    0x18(%rsp),%rbx
+    21c7:	|  |  |  |         48 29 c3             	sub    %rax,%rbx
+    nel::log << name << ": " << ns / 1000UL << "us";
+    21ca:	|  |  |  |         e8 01 0a 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    21cf:	|  |  |  |         4c 89 f6             	mov    %r14,%rsi
+    21d2:	|  |  |  |         48 89 c7             	mov    %rax,%rdi
+    21d5:	|  |  |  |         e8 f6 09 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    21da:	|  |  |  |         48 89 da             	mov    %rbx,%rdx
+    21dd:	|  |  |  |         48 89 c7             	mov    %rax,%rdi
+    21e0:	|  |  |  |         48 c1 ea 03          	shr    $0x3,%rdx
+    21e4:	|  |  |  |         48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    21eb:	|  |  |  |         9b c4 20 
+    21ee:	|  |  |  |         48 f7 e2             	mul    %rdx
+    21f1:	|  |  |  |         48 c1 ea 04          	shr    $0x4,%rdx
+    21f5:	|  |  |  |         48 89 d6             	mov    %rdx,%rsi
+    21f8:	|  |  |  |         e8 93 0a 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned long)>
+    21fd:	|  |  |  |         48 8d 35 12 0e 00 00 	lea    0xe12(%rip),%rsi        # 3016 <_IO_stdin_used+0x16>
+    2204:	|  |  |  |         48 89 c7             	mov    %rax,%rdi
+    2207:	|  |  |  |         e8 c4 09 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    if (bytes != 0 && ns != 0) {
+    220c:	|  |  |  |         48 85 db             	test   %rbx,%rbx
+    220f:	|  |  |  |     /-- 0f 85 96 00 00 00    	jne    22ab <bench_moves()+0x3ab>
+    nel::log << '\n';
+    2215:	|  |  |  |  /--|-> 4c 89 e7             	mov    %r12,%rdi
+    2218:	|  |  |  |  |  |   be 0a 00 00 00       	mov    $0xa,%esi
+    221d:	|  |  |  |  |  |   e8 8e 09 00 00       	call   2bb0 <nel::operator<<(nel::Log&, char)>
+            nel::elem::set(data_, 0xa5, N);
+    2222:	|  |  |  |  |  |   ba 00 00 01 00       	mov    $0x10000,%edx
+    2227:	|  |  |  |  |  |   4c 89 ff             	mov    %r15,%rdi
+    222a:	|  |  |  |  |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    222f:	|  |  |  |  |  |   e8 0c 01 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    delete a;
+    2234:	|  |  |  |  |  |   4c 89 ff             	mov    %r15,%rdi
+    2237:	|  |  |  |  |  |   be 00 00 01 00       	mov    $0x10000,%esi
+    223c:	|  |  |  |  |  |   e8 4f ee ff ff       	call   1090 <operator delete(void*, unsigned long)@plt>
+    2241:	|  |  |  |  |  |   48 89 ef             	mov    %rbp,%rdi
+    2244:	|  |  |  |  |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    2249:	|  |  |  |  |  |   ba 00 00 01 00       	mov    $0x10000,%edx
+    224e:	|  |  |  |  |  |   e8 ed 00 00 00       	call   2340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    2253:	|  |  |  |  |  |   48 83 c4 28          	add    $0x28,%rsp
+    delete b;
+    2257:	|  |  |  |  |  |   48 89 ef             	mov    %rbp,%rdi
+    225a:	|  |  |  |  |  |   be 00 00 01 00       	mov    $0x10000,%esi
+}
+    225f:	|  |  |  |  |  |   5b                   	pop    %rbx
+    2260:	|  |  |  |  |  |   5d                   	pop    %rbp
+    2261:	|  |  |  |  |  |   41 5c                	pop    %r12
+    2263:	|  |  |  |  |  |   41 5d                	pop    %r13
+    2265:	|  |  |  |  |  |   41 5e                	pop    %r14
+    2267:	|  |  |  |  |  |   41 5f                	pop    %r15
+    delete b;
+    2269:	|  |  |  |  |  |   e9 22 ee ff ff       	jmp    1090 <operator delete(void*, unsigned long)@plt>
+        nel::log << ", " << (bytes * 1000UL) / ns << "MB/s";
+    226e:	|  \--|--|--|--|-> 4c 89 e7             	mov    %r12,%rdi
+    2271:	|     |  |  |  |   48 8d 35 a1 0d 00 00 	lea    0xda1(%rip),%rsi        # 3019 <_IO_stdin_used+0x19>
+    2278:	|     |  |  |  |   e8 53 09 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    227d:	|     |  |  |  |   31 d2                	xor    %edx,%edx
+    227f:	|     |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    2282:	|     |  |  |  |   48 b8 00 00 00 00 7d 	movabs $0x7d00000000,%rax
+    2289:	|     |  |  |  |   00 00 00 
+    228c:	|     |  |  |  |   49 f7 f7             	div    %r15
+    228f:	|     |  |  |  |   48 89 c6             	mov    %rax,%rsi
+    2292:	|     |  |  |  |   e8 f9 09 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned long)>
+    2297:	|     |  |  |  |   48 8d 35 7e 0d 00 00 	lea    0xd7e(%rip),%rsi        # 301c <_IO_stdin_used+0x1c>
+    229e:	|     |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    22a1:	|     |  |  |  |   e8 2a 09 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    22a6:	\-----|--|--|--|-- e9 64 fd ff ff       	jmp    200f <bench_moves()+0x10f>
+    22ab:	      |  |  |  \-> 4c 89 e7             	mov    %r12,%rdi
+    22ae:	      |  |  |      48 8d 35 64 0d 00 00 	lea    0xd64(%rip),%rsi        # 3019 <_IO_stdin_used+0x19>
+    22b5:	      |  |  |      e8 16 09 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    22ba:	      |  |  |      31 d2                	xor    %edx,%edx
+    22bc:	      |  |  |      48 89 c7             	mov    %rax,%rdi
+    22bf:	      |  |  |      48 b8 00 00 00 00 7d 	movabs $0x7d00000000,%rax
+    22c6:	      |  |  |      00 00 00 
+    22c9:	      |  |  |      48 f7 f3             	div    %rbx
+    22cc:	      |  |  |      48 89 c6             	mov    %rax,%rsi
+    22cf:	      |  |  |      e8 bc 09 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned long)>
+    22d4:	      |  |  |      48 8d 35 41 0d 00 00 	lea    0xd41(%rip),%rsi        # 301c <_IO_stdin_used+0x1c>
+    22db:	      |  |  |      48 89 c7             	mov    %rax,%rdi
+    22de:	      |  |  |      e8 ed 08 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    22e3:	      |  |  \----- e9 2d ff ff ff       	jmp    2215 <bench_moves()+0x315>
+    22e8:	      |  \-------> 4c 89 e7             	mov    %r12,%rdi
+    22eb:	      |            48 8d 35 27 0d 00 00 	lea    0xd27(%rip),%rsi        # 3019 <_IO_stdin_used+0x19>
+    22f2:	      |            e8 d9 08 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    22f7:	      |            31 d2                	xor    %edx,%edx
+    22f9:	      |            48 89 c7             	mov    %rax,%rdi
+    22fc:	      |            48 b8 00 00 00 00 7d 	movabs $0x7d00000000,%rax
+    2303:	      |            00 00 00 
+    2306:	      |            48 f7 f3             	div    %rbx
+    2309:	      |            48 89 c6             	mov    %rax,%rsi
+    230c:	      |            e8 7f 09 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned long)>
+    2311:	      |            48 8d 35 04 0d 00 00 	lea    0xd04(%rip),%rsi        # 301c <_IO_stdin_used+0x1c>
+    2318:	      |            48 89 c7             	mov    %rax,%rdi
+    231b:	      |            e8 b0 08 00 00       	call   2bd0 <nel::operator<<(nel::Log&, char const*)>
+    2320:	      \----------- e9 d0 fd ff ff       	jmp    20f5 <bench_moves()+0x1f5>
+    2325:	                   66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    232c:	                   00 00 00 
+    232f:	                   90                   	nop
+
+0000000000002330 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    2330:	e9 2b ed ff ff       	jmp    1060 <memcpy@plt>
+    2335:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    233c:	00 00 00 00 
+
+0000000000002340 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    2340:	40 0f b6 f6          	movzbl %sil,%esi
+    2344:	e9 f7 ec ff ff       	jmp    1040 <memset@plt>
+    2349:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002350 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+}
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    2350:	e9 0b ed ff ff       	jmp    1060 <memcpy@plt>
+    2355:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    235c:	00 00 00 00 
+
+0000000000002360 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    2360:	e9 8b ed ff ff       	jmp    10f0 <memmove@plt>
+    2365:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    236c:	00 00 00 00 
+
+0000000000002370 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    2370:	48 89 f2             	mov    %rsi,%rdx
+    std::memset(d, s, n);
+    2373:	be a5 00 00 00       	mov    $0xa5,%esi
+    2378:	e9 c3 ec ff ff       	jmp    1040 <memset@plt>
+    237d:	0f 1f 00             	nopl   (%rax)
+
+0000000000002380 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+    set(d, 0xa5, n);
+}
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    2380:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    2384:	e8 a7 ec ff ff       	call   1030 <memcmp@plt>
+    2389:	85 c0                	test   %eax,%eax
+    238b:	0f 94 c0             	sete   %al
+}
+    238e:	48 83 c4 08          	add    $0x8,%rsp
+    2392:	c3                   	ret
+    2393:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    239a:	00 00 00 00 
+    239e:	66 90                	xchg   %ax,%ax
+
+00000000000023a0 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    23a0:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    23a4:	e8 87 ec ff ff       	call   1030 <memcmp@plt>
+    23a9:	85 c0                	test   %eax,%eax
+    23ab:	0f 95 c0             	setne  %al
+}
+    23ae:	48 83 c4 08          	add    $0x8,%rsp
+    23b2:	c3                   	ret
+    23b3:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    23ba:	00 00 00 00 
+    23be:	66 90                	xchg   %ax,%ax
+
+00000000000023c0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    if (n < streaming_min) {
+    23c0:	                48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    23c7:	/-------------- 0f 86 d7 00 00 00    	jbe    24a4 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xe4>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    23cd:	|               48 89 f9             	mov    %rdi,%rcx
+{
+    23d0:	|               53                   	push   %rbx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    23d1:	|               48 f7 d9             	neg    %rcx
+    23d4:	|               83 e1 0f             	and    $0xf,%ecx
+    std::memcpy(d, s, n);
+    23d7:	|               83 f9 08             	cmp    $0x8,%ecx
+    23da:	|     /-------- 0f 82 d0 00 00 00    	jb     24b0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xf0>
+    23e0:	|     |         48 8b 06             	mov    (%rsi),%rax
+    23e3:	|     |         4c 8d 57 08          	lea    0x8(%rdi),%r10
+    23e7:	|     |         48 89 f3             	mov    %rsi,%rbx
+    23ea:	|     |         49 83 e2 f8          	and    $0xfffffffffffffff8,%r10
+    23ee:	|     |         48 89 07             	mov    %rax,(%rdi)
+    23f1:	|     |         48 8b 44 0e f8       	mov    -0x8(%rsi,%rcx,1),%rax
+    23f6:	|     |         48 89 44 0f f8       	mov    %rax,-0x8(%rdi,%rcx,1)
+    23fb:	|     |         48 89 f8             	mov    %rdi,%rax
+    23fe:	|     |         4c 29 d0             	sub    %r10,%rax
+    2401:	|     |         48 29 c3             	sub    %rax,%rbx
+    2404:	|     |         01 c8                	add    %ecx,%eax
+    2406:	|     |         83 e0 f8             	and    $0xfffffff8,%eax
+    2409:	|     |         83 f8 08             	cmp    $0x8,%eax
+    240c:	|  /--|-------- 72 1a                	jb     2428 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    240e:	|  |  |         83 e0 f8             	and    $0xfffffff8,%eax
+    2411:	|  |  |         45 31 c0             	xor    %r8d,%r8d
+    2414:	|  |  |     /-> 45 89 c1             	mov    %r8d,%r9d
+    2417:	|  |  |     |   41 83 c0 08          	add    $0x8,%r8d
+    241b:	|  |  |     |   4e 8b 1c 0b          	mov    (%rbx,%r9,1),%r11
+    241f:	|  |  |     |   4f 89 1c 0a          	mov    %r11,(%r10,%r9,1)
+    2423:	|  |  |     |   41 39 c0             	cmp    %eax,%r8d
+    2426:	|  |  |     \-- 72 ec                	jb     2414 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x54>
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    2428:	|  >--|-------> 48 8d 41 40          	lea    0x40(%rcx),%rax
+    242c:	|  |  |         48 01 f9             	add    %rdi,%rcx
+    242f:	|  |  |         90                   	nop
+    std::memcpy(&v, s, sizeof(v));
+    2430:	|  |  |     /-> f3 0f 6f 54 06 d0    	movdqu -0x30(%rsi,%rax,1),%xmm2
+    2436:	|  |  |     |   f3 0f 6f 4c 06 e0    	movdqu -0x20(%rsi,%rax,1),%xmm1
+    243c:	|  |  |     |   49 89 c0             	mov    %rax,%r8
+    for (; i + 64 <= n; i += 64) {
+    243f:	|  |  |     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    2443:	|  |  |     |   f3 0f 6f 44 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2449:	|  |  |     |   f3 0f 6f 5c 06 c0    	movdqu -0x40(%rsi,%rax,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    244f:	|  |  |     |   48 83 c0 40          	add    $0x40,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2453:	|  |  |     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    2458:	|  |  |     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    245d:	|  |  |     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    2462:	|  |  |     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    2467:	|  |  |     |   48 39 c2             	cmp    %rax,%rdx
+    246a:	|  |  |     \-- 73 c4                	jae    2430 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x70>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    246c:	|  |  |         49 8d 40 10          	lea    0x10(%r8),%rax
+    2470:	|  |  |         48 39 c2             	cmp    %rax,%rdx
+    2473:	|  |  |  /----- 72 22                	jb     2497 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd7>
+    2475:	|  |  |  |      48 8d 4f f0          	lea    -0x10(%rdi),%rcx
+    2479:	|  |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2480:	|  |  |  |  /-> f3 0f 6f 64 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm4
+    2486:	|  |  |  |  |   49 89 c0             	mov    %rax,%r8
+    2489:	|  |  |  |  |   66 0f e7 24 01       	movntdq %xmm4,(%rcx,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    248e:	|  |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    2492:	|  |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    2495:	|  |  |  |  \-- 73 e9                	jae    2480 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc0>
+        stream16(d + i, load16(s + i));
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    2497:	|  |  |  \----> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    249a:	|  |  |         4c 01 c7             	add    %r8,%rdi
+    249d:	|  |  |         4c 29 c2             	sub    %r8,%rdx
+    24a0:	|  |  |         4c 01 c6             	add    %r8,%rsi
+}
+    24a3:	|  |  |         5b                   	pop    %rbx
+    std::memcpy(d, s, n);
+    24a4:	\--|--|-------> e9 b7 eb ff ff       	jmp    1060 <memcpy@plt>
+    24a9:	   |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    24b0:	   |  \-------> f6 c1 04             	test   $0x4,%cl
+    24b3:	   |        /-- 75 25                	jne    24da <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x11a>
+    24b5:	   |        |   85 c9                	test   %ecx,%ecx
+    24b7:	   +--------|-- 0f 84 6b ff ff ff    	je     2428 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    24bd:	   |        |   0f b6 06             	movzbl (%rsi),%eax
+    24c0:	   |        |   88 07                	mov    %al,(%rdi)
+    24c2:	   |        |   f6 c1 02             	test   $0x2,%cl
+    24c5:	   +--------|-- 0f 84 5d ff ff ff    	je     2428 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    24cb:	   |        |   0f b7 44 0e fe       	movzwl -0x2(%rsi,%rcx,1),%eax
+    24d0:	   |        |   66 89 44 0f fe       	mov    %ax,-0x2(%rdi,%rcx,1)
+    24d5:	   +--------|-- e9 4e ff ff ff       	jmp    2428 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    24da:	   |        \-> 8b 06                	mov    (%rsi),%eax
+    24dc:	   |            89 07                	mov    %eax,(%rdi)
+    24de:	   |            8b 44 0e fc          	mov    -0x4(%rsi,%rcx,1),%eax
+    24e2:	   |            89 44 0f fc          	mov    %eax,-0x4(%rdi,%rcx,1)
+    24e6:	   \----------- e9 3d ff ff ff       	jmp    2428 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    24eb:	                0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000000024f0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    24f0:	                                           49 89 f8             	mov    %rdi,%r8
+    24f3:	                                           48 89 f1             	mov    %rsi,%rcx
+    if (n < streaming_min) {
+    24f6:	                                           48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    24fd:	                              /----------- 0f 86 85 03 00 00    	jbe    2888 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x398>
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2503:	                              |            48 89 fe             	mov    %rdi,%rsi
+{
+    2506:	                              |            41 57                	push   %r15
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2508:	                              |            48 f7 de             	neg    %rsi
+{
+    250b:	                              |            41 56                	push   %r14
+    for (Index i = 0; i < head; ++i) {
+    250d:	                              |            48 89 f0             	mov    %rsi,%rax
+{
+    2510:	                              |            41 55                	push   %r13
+    2512:	                              |            41 54                	push   %r12
+    2514:	                              |            55                   	push   %rbp
+    2515:	                              |            53                   	push   %rbx
+    for (Index i = 0; i < head; ++i) {
+    2516:	                              |            83 e0 0f             	and    $0xf,%eax
+    2519:	/-----------------------------|----------- 0f 84 01 01 00 00    	je     2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    251f:	|                             |            48 8d 78 ff          	lea    -0x1(%rax),%rdi
+    2523:	|                             |            48 83 ff 02          	cmp    $0x2,%rdi
+    2527:	|  /--------------------------|----------- 0f 86 8a 04 00 00    	jbe    29b7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4c7>
+    252d:	|  |                          |            4c 8d 51 01          	lea    0x1(%rcx),%r10
+    2531:	|  |                          |            4d 89 c1             	mov    %r8,%r9
+    2534:	|  |                          |            4d 29 d1             	sub    %r10,%r9
+    2537:	|  |                          |            49 83 f9 06          	cmp    $0x6,%r9
+    253b:	|  |                          |  /-------- 0f 87 c7 02 00 00    	ja     2808 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x318>
+        d[i] = p[i];
+    2541:	|  |                          |  |         0f b6 39             	movzbl (%rcx),%edi
+    2544:	|  |                          |  |         41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2547:	|  |                          |  |         40 f6 c6 0e          	test   $0xe,%sil
+    254b:	+--|--------------------------|--|-------- 0f 84 cf 00 00 00    	je     2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2551:	|  |                          |  |         0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    2555:	|  |                          |  |         41 88 78 01          	mov    %dil,0x1(%r8)
+    2559:	|  |  /-----------------------|--|-------> 0f b6 79 02          	movzbl 0x2(%rcx),%edi
+    255d:	|  |  |                       |  |         41 88 78 02          	mov    %dil,0x2(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2561:	|  |  |                       |  |         40 f6 c6 0c          	test   $0xc,%sil
+    2565:	+--|--|-----------------------|--|-------- 0f 84 b5 00 00 00    	je     2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    256b:	|  |  |                       |  |         0f b6 79 03          	movzbl 0x3(%rcx),%edi
+    256f:	|  |  |                       |  |         41 88 78 03          	mov    %dil,0x3(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2573:	|  |  |                       |  |         48 83 f8 04          	cmp    $0x4,%rax
+    2577:	+--|--|-----------------------|--|-------- 0f 86 a3 00 00 00    	jbe    2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    257d:	|  |  |                       |  |         0f b6 79 04          	movzbl 0x4(%rcx),%edi
+    2581:	|  |  |                       |  |         41 88 78 04          	mov    %dil,0x4(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2585:	|  |  |                       |  |         48 83 f8 05          	cmp    $0x5,%rax
+    2589:	+--|--|-----------------------|--|-------- 0f 84 91 00 00 00    	je     2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    258f:	|  |  |                       |  |         0f b6 79 05          	movzbl 0x5(%rcx),%edi
+    2593:	|  |  |                       |  |         41 88 78 05          	mov    %dil,0x5(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2597:	|  |  |                       |  |         48 83 f8 06          	cmp    $0x6,%rax
+    259b:	+--|--|-----------------------|--|-------- 0f 84 7f 00 00 00    	je     2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    25a1:	|  |  |                       |  |         0f b6 79 06          	movzbl 0x6(%rcx),%edi
+    for (Index i = 0; i < head; ++i) {
+    25a5:	|  |  |                       |  |         83 e6 08             	and    $0x8,%esi
+        d[i] = p[i];
+    25a8:	|  |  |                       |  |         41 88 78 06          	mov    %dil,0x6(%r8)
+    for (Index i = 0; i < head; ++i) {
+    25ac:	+--|--|-----------------------|--|-------- 74 72                	je     2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    25ae:	|  |  |                       |  |         0f b6 71 07          	movzbl 0x7(%rcx),%esi
+    25b2:	|  |  |                       |  |         41 88 70 07          	mov    %sil,0x7(%r8)
+    for (Index i = 0; i < head; ++i) {
+    25b6:	|  |  |                       |  |         48 83 f8 08          	cmp    $0x8,%rax
+    25ba:	+--|--|-----------------------|--|-------- 76 64                	jbe    2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    25bc:	|  |  |                       |  |         0f b6 71 08          	movzbl 0x8(%rcx),%esi
+    25c0:	|  |  |                       |  |         41 88 70 08          	mov    %sil,0x8(%r8)
+    for (Index i = 0; i < head; ++i) {
+    25c4:	|  |  |                       |  |         48 83 f8 09          	cmp    $0x9,%rax
+    25c8:	+--|--|-----------------------|--|-------- 74 56                	je     2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    25ca:	|  |  |                       |  |         0f b6 71 09          	movzbl 0x9(%rcx),%esi
+    25ce:	|  |  |                       |  |         41 88 70 09          	mov    %sil,0x9(%r8)
+    for (Index i = 0; i < head; ++i) {
+    25d2:	|  |  |                       |  |         48 83 f8 0a          	cmp    $0xa,%rax
+    25d6:	+--|--|-----------------------|--|-------- 74 48                	je     2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    25d8:	|  |  |                       |  |         0f b6 71 0a          	movzbl 0xa(%rcx),%esi
+    25dc:	|  |  |                       |  |         41 88 70 0a          	mov    %sil,0xa(%r8)
+    for (Index i = 0; i < head; ++i) {
+    25e0:	|  |  |                       |  |         48 83 f8 0b          	cmp    $0xb,%rax
+    25e4:	+--|--|-----------------------|--|-------- 74 3a                	je     2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    25e6:	|  |  |                       |  |         0f b6 71 0b          	movzbl 0xb(%rcx),%esi
+    25ea:	|  |  |                       |  |         41 88 70 0b          	mov    %sil,0xb(%r8)
+    for (Index i = 0; i < head; ++i) {
+    25ee:	|  |  |                       |  |         48 83 f8 0c          	cmp    $0xc,%rax
+    25f2:	+--|--|-----------------------|--|-------- 74 2c                	je     2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    25f4:	|  |  |                       |  |         0f b6 71 0c          	movzbl 0xc(%rcx),%esi
+    25f8:	|  |  |                       |  |         41 88 70 0c          	mov    %sil,0xc(%r8)
+    for (Index i = 0; i < head; ++i) {
+    25fc:	|  |  |                       |  |         48 83 f8 0d          	cmp    $0xd,%rax
+    2600:	+--|--|-----------------------|--|-------- 74 1e                	je     2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2602:	|  |  |                       |  |         0f b6 71 0d          	movzbl 0xd(%rcx),%esi
+    2606:	|  |  |                       |  |         41 88 70 0d          	mov    %sil,0xd(%r8)
+    for (Index i = 0; i < head; ++i) {
+    260a:	|  |  |                       |  |         49 8d 70 ff          	lea    -0x1(%r8),%rsi
+    260e:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    2611:	+--|--|-----------------------|--|-------- 75 0d                	jne    2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2613:	|  |  |                       |  |         0f b6 71 0e          	movzbl 0xe(%rcx),%esi
+    2617:	|  |  |                       |  |         41 88 70 0e          	mov    %sil,0xe(%r8)
+    for (Index i = 0; i < head; ++i) {
+    261b:	|  |  |                       |  |         0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+        rotated[i] = p[(head + i) % 16];
+    2620:	>--|--|-----------------------|--|-------> 48 8d 70 07          	lea    0x7(%rax),%rsi
+    2624:	|  |  |                       |  |         4c 8d 78 06          	lea    0x6(%rax),%r15
+    2628:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    262b:	|  |  |                       |  |         4c 8d 70 05          	lea    0x5(%rax),%r14
+    262f:	|  |  |                       |  |         4c 8d 68 04          	lea    0x4(%rax),%r13
+    2633:	|  |  |                       |  |         41 83 e7 0f          	and    $0xf,%r15d
+    std::memcpy(&v, s, sizeof(v));
+    2637:	|  |  |                       |  |         0f b6 34 31          	movzbl (%rcx,%rsi,1),%esi
+        rotated[i] = p[(head + i) % 16];
+    263b:	|  |  |                       |  |         41 83 e6 0f          	and    $0xf,%r14d
+    263f:	|  |  |                       |  |         41 83 e5 0f          	and    $0xf,%r13d
+    2643:	|  |  |                       |  |         4c 8d 60 03          	lea    0x3(%rax),%r12
+    std::memcpy(&v, s, sizeof(v));
+    2647:	|  |  |                       |  |         46 0f b6 3c 39       	movzbl (%rcx,%r15,1),%r15d
+    264c:	|  |  |                       |  |         46 0f b6 34 31       	movzbl (%rcx,%r14,1),%r14d
+        rotated[i] = p[(head + i) % 16];
+    2651:	|  |  |                       |  |         48 8d 78 08          	lea    0x8(%rax),%rdi
+    2655:	|  |  |                       |  |         41 83 e4 0f          	and    $0xf,%r12d
+    std::memcpy(&v, s, sizeof(v));
+    2659:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    265d:	|  |  |                       |  |         46 0f b6 2c 29       	movzbl (%rcx,%r13,1),%r13d
+        rotated[i] = p[(head + i) % 16];
+    2662:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    2665:	|  |  |                       |  |         48 8d 68 02          	lea    0x2(%rax),%rbp
+    std::memcpy(&v, s, sizeof(v));
+    2669:	|  |  |                       |  |         4c 09 fe             	or     %r15,%rsi
+        rotated[i] = p[(head + i) % 16];
+    266c:	|  |  |                       |  |         48 89 7c 24 c8       	mov    %rdi,-0x38(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    2671:	|  |  |                       |  |         46 0f b6 24 21       	movzbl (%rcx,%r12,1),%r12d
+        rotated[i] = p[(head + i) % 16];
+    2676:	|  |  |                       |  |         83 e5 0f             	and    $0xf,%ebp
+    std::memcpy(&v, s, sizeof(v));
+    2679:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    267d:	|  |  |                       |  |         48 8d 78 09          	lea    0x9(%rax),%rdi
+    std::memcpy(&v, s, sizeof(v));
+    2681:	|  |  |                       |  |         0f b6 2c 29          	movzbl (%rcx,%rbp,1),%ebp
+        rotated[i] = p[(head + i) % 16];
+    2685:	|  |  |                       |  |         48 8d 58 01          	lea    0x1(%rax),%rbx
+    std::memcpy(&v, s, sizeof(v));
+    2689:	|  |  |                       |  |         4c 09 f6             	or     %r14,%rsi
+        rotated[i] = p[(head + i) % 16];
+    268c:	|  |  |                       |  |         49 89 fb             	mov    %rdi,%r11
+    268f:	|  |  |                       |  |         48 8d 78 0a          	lea    0xa(%rax),%rdi
+    2693:	|  |  |                       |  |         83 e3 0f             	and    $0xf,%ebx
+    std::memcpy(&v, s, sizeof(v));
+    2696:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    269a:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    269e:	|  |  |                       |  |         49 89 fa             	mov    %rdi,%r10
+    std::memcpy(&v, s, sizeof(v));
+    26a1:	|  |  |                       |  |         4c 09 ee             	or     %r13,%rsi
+        rotated[i] = p[(head + i) % 16];
+    26a4:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    26a8:	|  |  |                       |  |         48 8d 78 0b          	lea    0xb(%rax),%rdi
+    26ac:	|  |  |                       |  |         4c 89 5c 24 e0       	mov    %r11,-0x20(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    26b1:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    26b5:	|  |  |                       |  |         4c 8d 58 0f          	lea    0xf(%rax),%r11
+    26b9:	|  |  |                       |  |         4c 89 54 24 e8       	mov    %r10,-0x18(%rsp)
+    26be:	|  |  |                       |  |         49 89 f9             	mov    %rdi,%r9
+    std::memcpy(&v, s, sizeof(v));
+    26c1:	|  |  |                       |  |         4c 09 e6             	or     %r12,%rsi
+        rotated[i] = p[(head + i) % 16];
+    26c4:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    26c8:	|  |  |                       |  |         4c 8d 50 0e          	lea    0xe(%rax),%r10
+    26cc:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    26d0:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    26d4:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    26d8:	|  |  |                       |  |         4c 89 4c 24 f0       	mov    %r9,-0x10(%rsp)
+    26dd:	|  |  |                       |  |         4c 8d 48 0d          	lea    0xd(%rax),%r9
+    std::memcpy(&v, s, sizeof(v));
+    26e1:	|  |  |                       |  |         48 09 ee             	or     %rbp,%rsi
+    26e4:	|  |  |                       |  |         0f b6 2c 19          	movzbl (%rcx,%rbx,1),%ebp
+    26e8:	|  |  |                       |  |         46 0f b6 14 11       	movzbl (%rcx,%r10,1),%r10d
+        rotated[i] = p[(head + i) % 16];
+    26ed:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    26f1:	|  |  |                       |  |         48 89 f3             	mov    %rsi,%rbx
+    26f4:	|  |  |                       |  |         42 0f b6 34 19       	movzbl (%rcx,%r11,1),%esi
+    26f9:	|  |  |                       |  |         46 0f b6 0c 09       	movzbl (%rcx,%r9,1),%r9d
+        rotated[i] = p[(head + i) % 16];
+    26fe:	|  |  |                       |  |         48 8d 78 0c          	lea    0xc(%rax),%rdi
+    2702:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    std::memcpy(&v, s, sizeof(v));
+    2705:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    2709:	|  |  |                       |  |         4c 8b 5c 24 e0       	mov    -0x20(%rsp),%r11
+    270e:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2712:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    2715:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    2719:	|  |  |                       |  |         0f b6 2c 01          	movzbl (%rcx,%rax,1),%ebp
+    271d:	|  |  |                       |  |         4c 09 d6             	or     %r10,%rsi
+    2720:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    2724:	|  |  |                       |  |         4c 8b 54 24 e8       	mov    -0x18(%rsp),%r10
+    2729:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    272d:	|  |  |                       |  |         4c 09 ce             	or     %r9,%rsi
+    2730:	|  |  |                       |  |         4c 8b 4c 24 f0       	mov    -0x10(%rsp),%r9
+    2735:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2739:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    273c:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    273f:	|  |  |                       |  |         42 0f b6 3c 09       	movzbl (%rcx,%r9,1),%edi
+    2744:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2748:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    274b:	|  |  |                       |  |         42 0f b6 3c 11       	movzbl (%rcx,%r10,1),%edi
+    2750:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2754:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    2757:	|  |  |                       |  |         42 0f b6 3c 19       	movzbl (%rcx,%r11,1),%edi
+    275c:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2760:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    2763:	|  |  |                       |  |         48 8b 7c 24 c8       	mov    -0x38(%rsp),%rdi
+    2768:	|  |  |                       |  |         48 89 5c 24 c8       	mov    %rbx,-0x38(%rsp)
+    276d:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2771:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    2775:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    2778:	|  |  |                       |  |         48 8d 78 40          	lea    0x40(%rax),%rdi
+    277c:	|  |  |                       |  |         4c 01 c0             	add    %r8,%rax
+    std::memcpy(&v, s, sizeof(v));
+    277f:	|  |  |                       |  |         48 89 74 24 d0       	mov    %rsi,-0x30(%rsp)
+    2784:	|  |  |                       |  |         66 0f 6f 44 24 c8    	movdqa -0x38(%rsp),%xmm0
+    for (; i + 64 <= n; i += 64) {
+    278a:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2790:	|  |  |                       |  |     /-> 48 89 fe             	mov    %rdi,%rsi
+    for (; i + 64 <= n; i += 64) {
+    2793:	|  |  |                       |  |     |   48 83 c7 40          	add    $0x40,%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2797:	|  |  |                       |  |     |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    279b:	|  |  |                       |  |     |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    27a0:	|  |  |                       |  |     |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    27a5:	|  |  |                       |  |     |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    27aa:	|  |  |                       |  |     |   48 83 c0 40          	add    $0x40,%rax
+    27ae:	|  |  |                       |  |     |   48 39 fa             	cmp    %rdi,%rdx
+    27b1:	|  |  |                       |  |     \-- 73 dd                	jae    2790 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2a0>
+        stream16(d + i, v);
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+    27b3:	|  |  |                       |  |         48 8d 46 10          	lea    0x10(%rsi),%rax
+    27b7:	|  |  |                       |  |         48 39 c2             	cmp    %rax,%rdx
+    27ba:	|  |  |                       |  |  /----- 72 15                	jb     27d1 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2e1>
+    27bc:	|  |  |                       |  |  |      49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    27c0:	|  |  |                       |  |  |  /-> 48 89 c6             	mov    %rax,%rsi
+    27c3:	|  |  |                       |  |  |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    27c8:	|  |  |                       |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    27cc:	|  |  |                       |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    27cf:	|  |  |                       |  |  |  \-- 73 ef                	jae    27c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2d0>
+        stream16(d + i, v);
+    }
+    __builtin_ia32_sfence();
+    27d1:	|  |  |                       |  |  \----> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    27d4:	|  |  |                       |  |         48 39 d6             	cmp    %rdx,%rsi
+    27d7:	|  |  |                       |  |  /----- 73 1e                	jae    27f7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x307>
+    27d9:	|  |  |                       |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        d[i] = p[i % 16];
+    27e0:	|  |  |                       |  |  |  /-> 48 89 f0             	mov    %rsi,%rax
+    27e3:	|  |  |                       |  |  |  |   83 e0 0f             	and    $0xf,%eax
+    27e6:	|  |  |                       |  |  |  |   0f b6 04 01          	movzbl (%rcx,%rax,1),%eax
+    27ea:	|  |  |                       |  |  |  |   41 88 04 30          	mov    %al,(%r8,%rsi,1)
+    for (; i < n; ++i) {
+    27ee:	|  |  |                       |  |  |  |   48 83 c6 01          	add    $0x1,%rsi
+    27f2:	|  |  |                       |  |  |  |   48 39 f2             	cmp    %rsi,%rdx
+    27f5:	|  |  |                       |  |  |  \-- 75 e9                	jne    27e0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2f0>
+    }
+}
+    27f7:	|  |  |                       |  |  \----> 5b                   	pop    %rbx
+    27f8:	|  |  |                       |  |         5d                   	pop    %rbp
+    27f9:	|  |  |                       |  |         41 5c                	pop    %r12
+    27fb:	|  |  |                       |  |         41 5d                	pop    %r13
+    27fd:	|  |  |                       |  |         41 5e                	pop    %r14
+    27ff:	|  |  |                       |  |         41 5f                	pop    %r15
+    2801:	|  |  |                       |  |         c3                   	ret
+    2802:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    2808:	|  |  |                       |  \-------> 48 83 ff 06          	cmp    $0x6,%rdi
+    280c:	|  |  |  /--------------------|----------- 0f 86 e1 01 00 00    	jbe    29f3 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x503>
+        d[i] = p[i];
+    2812:	|  |  |  |                    |            48 8b 31             	mov    (%rcx),%rsi
+    2815:	|  |  |  |                    |            49 89 30             	mov    %rsi,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2818:	|  |  |  |                    |            48 83 f8 08          	cmp    $0x8,%rax
+    281c:	+--|--|--|--------------------|----------- 0f 84 fe fd ff ff    	je     2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    2822:	|  |  |  |                    |            48 8d 70 f7          	lea    -0x9(%rax),%rsi
+    2826:	|  |  |  |                    |            4c 8d 48 f8          	lea    -0x8(%rax),%r9
+    282a:	|  |  |  |                    |            48 83 fe 02          	cmp    $0x2,%rsi
+    282e:	|  |  |  |                    |            be 08 00 00 00       	mov    $0x8,%esi
+    2833:	|  |  |  |                    |        /-- 76 15                	jbe    284a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x35a>
+        d[i] = p[i];
+    2835:	|  |  |  |  /-----------------|--------|-> 8b 3c 31             	mov    (%rcx,%rsi,1),%edi
+    2838:	|  |  |  |  |                 |        |   41 89 3c 30          	mov    %edi,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    283c:	|  |  |  |  |                 |        |   48 83 c6 04          	add    $0x4,%rsi
+    2840:	|  |  |  |  |                 |        |   49 83 f9 04          	cmp    $0x4,%r9
+    2844:	+--|--|--|--|-----------------|--------|-- 0f 84 d6 fd ff ff    	je     2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    284a:	|  |  |  |  |                 |        \-> 0f b6 3c 31          	movzbl (%rcx,%rsi,1),%edi
+    284e:	|  |  |  |  |                 |            41 88 3c 30          	mov    %dil,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    2852:	|  |  |  |  |                 |            48 8d 7e 01          	lea    0x1(%rsi),%rdi
+    2856:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    2859:	+--|--|--|--|-----------------|----------- 0f 83 c1 fd ff ff    	jae    2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    285f:	|  |  |  |  |                 |            0f b6 7c 31 01       	movzbl 0x1(%rcx,%rsi,1),%edi
+    2864:	|  |  |  |  |                 |            41 88 7c 30 01       	mov    %dil,0x1(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    2869:	|  |  |  |  |                 |            48 8d 7e 02          	lea    0x2(%rsi),%rdi
+    286d:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    2870:	+--|--|--|--|-----------------|----------- 0f 83 aa fd ff ff    	jae    2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2876:	|  |  |  |  |                 |            0f b6 7c 31 02       	movzbl 0x2(%rcx,%rsi,1),%edi
+    287b:	|  |  |  |  |                 |            41 88 7c 30 02       	mov    %dil,0x2(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    2880:	+--|--|--|--|-----------------|----------- e9 9b fd ff ff       	jmp    2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    2885:	|  |  |  |  |                 |            0f 1f 00             	nopl   (%rax)
+    Length done = (n < 16) ? n : 16;
+    2888:	|  |  |  |  |                 \----------> 41 ba 10 00 00 00    	mov    $0x10,%r10d
+    288e:	|  |  |  |  |                              4c 39 d2             	cmp    %r10,%rdx
+    2891:	|  |  |  |  |                              4c 0f 46 d2          	cmovbe %rdx,%r10
+    std::memcpy(d, s, n);
+    2895:	|  |  |  |  |                              44 89 d0             	mov    %r10d,%eax
+    2898:	|  |  |  |  |                              41 83 fa 08          	cmp    $0x8,%r10d
+    289c:	|  |  |  |  |        /-------------------- 0f 82 cc 00 00 00    	jb     296e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47e>
+    28a2:	|  |  |  |  |        |                     48 8b 06             	mov    (%rsi),%rax
+    28a5:	|  |  |  |  |        |                     4c 8d 4f 08          	lea    0x8(%rdi),%r9
+    28a9:	|  |  |  |  |        |                     49 83 e1 f8          	and    $0xfffffffffffffff8,%r9
+    28ad:	|  |  |  |  |        |                     48 89 07             	mov    %rax,(%rdi)
+    28b0:	|  |  |  |  |        |                     44 89 d0             	mov    %r10d,%eax
+    28b3:	|  |  |  |  |        |                     48 8b 74 06 f8       	mov    -0x8(%rsi,%rax,1),%rsi
+    28b8:	|  |  |  |  |        |                     48 89 74 07 f8       	mov    %rsi,-0x8(%rdi,%rax,1)
+    28bd:	|  |  |  |  |        |                     48 89 f8             	mov    %rdi,%rax
+    28c0:	|  |  |  |  |        |                     4c 29 c8             	sub    %r9,%rax
+    28c3:	|  |  |  |  |        |                     48 29 c1             	sub    %rax,%rcx
+    28c6:	|  |  |  |  |        |                     44 01 d0             	add    %r10d,%eax
+    28c9:	|  |  |  |  |        |                     83 e0 f8             	and    $0xfffffff8,%eax
+    28cc:	|  |  |  |  |        |                     83 f8 08             	cmp    $0x8,%eax
+    28cf:	|  |  |  |  |  /-----|-------------------- 72 16                	jb     28e7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    28d1:	|  |  |  |  |  |     |                     83 e0 f8             	and    $0xfffffff8,%eax
+    28d4:	|  |  |  |  |  |     |                     31 f6                	xor    %esi,%esi
+    28d6:	|  |  |  |  |  |     |                 /-> 89 f7                	mov    %esi,%edi
+    28d8:	|  |  |  |  |  |     |                 |   83 c6 08             	add    $0x8,%esi
+    28db:	|  |  |  |  |  |     |                 |   4c 8b 1c 39          	mov    (%rcx,%rdi,1),%r11
+    28df:	|  |  |  |  |  |     |                 |   4d 89 1c 39          	mov    %r11,(%r9,%rdi,1)
+    28e3:	|  |  |  |  |  |     |                 |   39 c6                	cmp    %eax,%esi
+    28e5:	|  |  |  |  |  |     |                 \-- 72 ef                	jb     28d6 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3e6>
+    while (done < n) {
+    28e7:	|  |  |  |  |  >-----|-------------------> 49 39 d2             	cmp    %rdx,%r10
+    28ea:	|  |  |  |  |  |     |           /-------- 72 33                	jb     291f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    28ec:	|  |  |  |  |  |     |     /-----|-------- e9 af 00 00 00       	jmp    29a0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b0>
+    28f1:	|  |  |  |  |  |     |     |     |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    std::memcpy(d, s, n);
+    28f8:	|  |  |  |  |  |     |     |     |     /-> 41 f6 c1 04          	test   $0x4,%r9b
+    28fc:	|  |  |  |  |  |     |     |  /--|-----|-- 0f 85 9f 00 00 00    	jne    29a1 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b1>
+    2902:	|  |  |  |  |  |     |     |  |  |     |   45 85 c9             	test   %r9d,%r9d
+    2905:	|  |  |  |  |  |  /--|-----|--|--|-----|-- 74 10                	je     2917 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    2907:	|  |  |  |  |  |  |  |     |  |  |     |   41 0f b6 08          	movzbl (%r8),%ecx
+    290b:	|  |  |  |  |  |  |  |     |  |  |     |   88 08                	mov    %cl,(%rax)
+    290d:	|  |  |  |  |  |  |  |     |  |  |     |   41 f6 c1 02          	test   $0x2,%r9b
+    2911:	|  |  |  |  |  |  |  |  /--|--|--|-----|-- 0f 85 c9 00 00 00    	jne    29e0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4f0>
+        done += m;
+    2917:	|  |  |  |  |  |  >--|--|--|--|--|-----|-> 4d 01 ca             	add    %r9,%r10
+    while (done < n) {
+    291a:	|  |  |  |  |  |  |  |  |  |  |  |     |   49 39 d2             	cmp    %rdx,%r10
+    291d:	|  |  |  |  |  |  |  |  |  |  |  |  /--|-- 73 4e                	jae    296d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47d>
+        Length const m = (done < n - done) ? done : n - done;
+    291f:	|  |  |  |  |  |  |  |  |  |  |  >--|--|-> 49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    2922:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4b 8d 04 10          	lea    (%r8,%r10,1),%rax
+        Length const m = (done < n - done) ? done : n - done;
+    2926:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 29 d1             	sub    %r10,%r9
+    2929:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 39 d1             	cmp    %r10,%r9
+    292c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 0f 47 ca          	cmova  %r10,%r9
+    std::memcpy(d, s, n);
+    2930:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   41 83 f9 08          	cmp    $0x8,%r9d
+    2934:	|  |  |  |  |  |  |  |  |  |  |  |  |  \-- 72 c2                	jb     28f8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x408>
+    2936:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 08             	mov    (%r8),%rcx
+    2939:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 78 08          	lea    0x8(%rax),%rdi
+        done += m;
+    293d:	|  |  |  |  |  |  |  |  |  |  |  |  |      4d 01 ca             	add    %r9,%r10
+    std::memcpy(d, s, n);
+    2940:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 83 e7 f8          	and    $0xfffffffffffffff8,%rdi
+    2944:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 08             	mov    %rcx,(%rax)
+    2947:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 89 c9             	mov    %r9d,%ecx
+    294a:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 74 08 f8       	mov    -0x8(%r8,%rcx,1),%rsi
+    294f:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 74 08 f8       	mov    %rsi,-0x8(%rax,%rcx,1)
+    2954:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 f8             	sub    %rdi,%rax
+    2957:	|  |  |  |  |  |  |  |  |  |  |  |  |      4c 89 c6             	mov    %r8,%rsi
+    295a:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 c6             	sub    %rax,%rsi
+    295d:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 01 c8             	add    %r9d,%eax
+    2960:	|  |  |  |  |  |  |  |  |  |  |  |  |      c1 e8 03             	shr    $0x3,%eax
+    2963:	|  |  |  |  |  |  |  |  |  |  |  |  |      89 c1                	mov    %eax,%ecx
+    2965:	|  |  |  |  |  |  |  |  |  |  |  |  |      f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    2968:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 39 d2             	cmp    %rdx,%r10
+    296b:	|  |  |  |  |  |  |  |  |  |  |  \--|----- 72 b2                	jb     291f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    296d:	|  |  |  |  |  |  |  |  |  |  |     \----> c3                   	ret
+    std::memcpy(d, s, n);
+    296e:	|  |  |  |  |  |  |  \--|--|--|----------> 41 f6 c2 04          	test   $0x4,%r10b
+    2972:	|  |  |  |  |  |  |     |  |  |        /-- 0f 85 85 00 00 00    	jne    29fd <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x50d>
+    2978:	|  |  |  |  |  |  |     |  |  |        |   85 c0                	test   %eax,%eax
+    297a:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 67 ff ff ff    	je     28e7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    2980:	|  |  |  |  |  |  |     |  |  |        |   0f b6 36             	movzbl (%rsi),%esi
+    2983:	|  |  |  |  |  |  |     |  |  |        |   40 88 37             	mov    %sil,(%rdi)
+    2986:	|  |  |  |  |  |  |     |  |  |        |   a8 02                	test   $0x2,%al
+    2988:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 59 ff ff ff    	je     28e7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    298e:	|  |  |  |  |  |  |     |  |  |        |   0f b7 4c 01 fe       	movzwl -0x2(%rcx,%rax,1),%ecx
+    2993:	|  |  |  |  |  |  |     |  |  |        |   66 89 4c 07 fe       	mov    %cx,-0x2(%rdi,%rax,1)
+    2998:	|  |  |  |  |  +--|-----|--|--|--------|-- e9 4a ff ff ff       	jmp    28e7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    299d:	|  |  |  |  |  |  |     |  |  |        |   0f 1f 00             	nopl   (%rax)
+    29a0:	|  |  |  |  |  |  |     |  \--|--------|-> c3                   	ret
+    29a1:	|  |  |  |  |  |  |     |     \--------|-> 41 8b 08             	mov    (%r8),%ecx
+    29a4:	|  |  |  |  |  |  |     |              |   89 08                	mov    %ecx,(%rax)
+    29a6:	|  |  |  |  |  |  |     |              |   44 89 c9             	mov    %r9d,%ecx
+    29a9:	|  |  |  |  |  |  |     |              |   41 8b 74 08 fc       	mov    -0x4(%r8,%rcx,1),%esi
+    29ae:	|  |  |  |  |  |  |     |              |   89 74 08 fc          	mov    %esi,-0x4(%rax,%rcx,1)
+    29b2:	|  |  |  |  |  |  +-----|--------------|-- e9 60 ff ff ff       	jmp    2917 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+        d[i] = p[i];
+    29b7:	|  \--|--|--|--|--|-----|--------------|-> 0f b6 39             	movzbl (%rcx),%edi
+    29ba:	|     |  |  |  |  |     |              |   41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    29bd:	|     |  |  |  |  |     |              |   40 f6 c6 0e          	test   $0xe,%sil
+    29c1:	+-----|--|--|--|--|-----|--------------|-- 0f 84 59 fc ff ff    	je     2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    29c7:	|     |  |  |  |  |     |              |   0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    29cb:	|     |  |  |  |  |     |              |   41 88 78 01          	mov    %dil,0x1(%r8)
+    for (Index i = 0; i < head; ++i) {
+    29cf:	|     |  |  |  |  |     |              |   48 83 f8 03          	cmp    $0x3,%rax
+    29d3:	\-----|--|--|--|--|-----|--------------|-- 0f 85 47 fc ff ff    	jne    2620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    29d9:	      \--|--|--|--|-----|--------------|-- e9 7b fb ff ff       	jmp    2559 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x69>
+    29de:	         |  |  |  |     |              |   66 90                	xchg   %ax,%ax
+    std::memcpy(d, s, n);
+    29e0:	         |  |  |  |     \--------------|-> 44 89 c9             	mov    %r9d,%ecx
+    29e3:	         |  |  |  |                    |   41 0f b7 74 08 fe    	movzwl -0x2(%r8,%rcx,1),%esi
+    29e9:	         |  |  |  |                    |   66 89 74 08 fe       	mov    %si,-0x2(%rax,%rcx,1)
+    29ee:	         |  |  |  \--------------------|-- e9 24 ff ff ff       	jmp    2917 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    for (Index i = 0; i < head; ++i) {
+    29f3:	         \--|--|-----------------------|-> 49 89 c1             	mov    %rax,%r9
+    29f6:	            |  |                       |   31 f6                	xor    %esi,%esi
+    29f8:	            \--|-----------------------|-- e9 38 fe ff ff       	jmp    2835 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x345>
+    std::memcpy(d, s, n);
+    29fd:	               |                       \-> 8b 36                	mov    (%rsi),%esi
+    29ff:	               |                           89 37                	mov    %esi,(%rdi)
+    2a01:	               |                           8b 4c 01 fc          	mov    -0x4(%rcx,%rax,1),%ecx
+    2a05:	               |                           89 4c 07 fc          	mov    %ecx,-0x4(%rdi,%rax,1)
+    2a09:	               \-------------------------- e9 d9 fe ff ff       	jmp    28e7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    2a0e:	                                           66 90                	xchg   %ax,%ax
+
+0000000000002a10 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    2a10:	    48 85 ff             	test   %rdi,%rdi
+    2a13:	/-- 74 0b                	je     2a20 <nel::free_aligned(void*)+0x10>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    2a15:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    2a19:	|   e9 92 e6 ff ff       	jmp    10b0 <free@plt>
+    2a1e:	|   66 90                	xchg   %ax,%ax
+}
+    2a20:	\-> c3                   	ret
+    2a21:	    66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2a28:	    00 00 00 00 
+    2a2c:	    0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002a30 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    2a30:	                   41 56                	push   %r14
+            : fn_name_(fn_name)
+    2a32:	                   48 8d 05 3f 07 00 00 	lea    0x73f(%rip),%rax        # 3178 <_IO_stdin_used+0x178>
+    2a39:	                   41 55                	push   %r13
+    2a3b:	                   66 48 0f 6e c8       	movq   %rax,%xmm1
+    2a40:	                   41 54                	push   %r12
+    2a42:	                   55                   	push   %rbp
+    2a43:	                   48 89 cd             	mov    %rcx,%rbp
+    2a46:	                   48 8d 0d 1b 07 00 00 	lea    0x71b(%rip),%rcx        # 3168 <_IO_stdin_used+0x168>
+    2a4d:	                   53                   	push   %rbx
+    2a4e:	                   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    2a53:	                   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2a57:	                   48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    2a5b:	                   c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    2a62:	                   00 
+            : fn_name_(fn_name)
+    2a63:	                   0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    2a67:	                   48 85 f6             	test   %rsi,%rsi
+    2a6a:	/----------------- 0f 84 a0 00 00 00    	je     2b10 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    2a70:	|                  48 8d 46 ff          	lea    -0x1(%rsi),%rax
+    2a74:	|                  48 89 f3             	mov    %rsi,%rbx
+    2a77:	|                  48 85 f0             	test   %rsi,%rax
+    2a7a:	+----------------- 0f 85 90 00 00 00    	jne    2b10 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2a80:	|                  48 8d 34 2e          	lea    (%rsi,%rbp,1),%rsi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    2a84:	|                  48 85 ff             	test   %rdi,%rdi
+    2a87:	|     /----------- 74 67                	je     2af0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xc0>
+    2a89:	|     |            4c 8b 6f f8          	mov    -0x8(%rdi),%r13
+    uint8_t *const new_base =
+    2a8d:	|     |            49 89 d4             	mov    %rdx,%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    2a90:	|     |            4c 29 ef             	sub    %r13,%rdi
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2a93:	|     |            e8 68 e6 ff ff       	call   1100 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    2a98:	|     |            48 85 c0             	test   %rax,%rax
+    2a9b:	|  /--|----------- 0f 84 7e 00 00 00    	je     2b1f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    2aa1:	|  |  |            48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    2aa6:	|  |  |            48 f7 db             	neg    %rbx
+    2aa9:	|  |  |            48 21 cb             	and    %rcx,%rbx
+    2aac:	|  |  |            49 89 de             	mov    %rbx,%r14
+    2aaf:	|  |  |            49 29 c6             	sub    %rax,%r14
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    2ab2:	|  |  |            4d 39 f5             	cmp    %r14,%r13
+    2ab5:	|  |  |        /-- 75 19                	jne    2ad0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xa0>
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    }
+    offset_field(new_p) = new_offset;
+    2ab7:	|  |  |     /--|-> 4c 89 73 f8          	mov    %r14,-0x8(%rbx)
+    return new_p;
+}
+    2abb:	|  |  |  /--|--|-> 48 83 c4 20          	add    $0x20,%rsp
+    2abf:	|  |  |  |  |  |   48 89 d8             	mov    %rbx,%rax
+    2ac2:	|  |  |  |  |  |   5b                   	pop    %rbx
+    2ac3:	|  |  |  |  |  |   5d                   	pop    %rbp
+    2ac4:	|  |  |  |  |  |   41 5c                	pop    %r12
+    2ac6:	|  |  |  |  |  |   41 5d                	pop    %r13
+    2ac8:	|  |  |  |  |  |   41 5e                	pop    %r14
+    2aca:	|  |  |  |  |  |   c3                   	ret
+    2acb:	|  |  |  |  |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        std::memmove(new_p, new_base + old_offset, n);
+    2ad0:	|  |  |  |  |  \-> 4c 39 e5             	cmp    %r12,%rbp
+    2ad3:	|  |  |  |  |      4c 89 e2             	mov    %r12,%rdx
+    2ad6:	|  |  |  |  |      4a 8d 34 28          	lea    (%rax,%r13,1),%rsi
+    2ada:	|  |  |  |  |      48 89 df             	mov    %rbx,%rdi
+    2add:	|  |  |  |  |      48 0f 46 d5          	cmovbe %rbp,%rdx
+    2ae1:	|  |  |  |  |      e8 0a e6 ff ff       	call   10f0 <memmove@plt>
+    2ae6:	|  |  |  |  +----- eb cf                	jmp    2ab7 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+    2ae8:	|  |  |  |  |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    2aef:	|  |  |  |  |      00 
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2af0:	|  |  \--|--|----> 48 89 f7             	mov    %rsi,%rdi
+    2af3:	|  |     |  |      e8 d8 e5 ff ff       	call   10d0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    2af8:	|  |     |  |      48 85 c0             	test   %rax,%rax
+    2afb:	|  +-----|--|----- 74 22                	je     2b1f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    2afd:	|  |     |  |      48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    2b02:	|  |     |  |      48 f7 db             	neg    %rbx
+    2b05:	|  |     |  |      48 21 d3             	and    %rdx,%rbx
+    2b08:	|  |     |  |      49 89 de             	mov    %rbx,%r14
+    2b0b:	|  |     |  |      49 29 c6             	sub    %rax,%r14
+    if (old_p != nullptr && new_offset != old_offset) {
+    2b0e:	|  |     |  \----- eb a7                	jmp    2ab7 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+    if (!pred) { assert_fail(msg, ctx); }
+    2b10:	\--|-----|-------> 48 89 e6             	mov    %rsp,%rsi
+    2b13:	   |     |         48 8d 3d 70 06 00 00 	lea    0x670(%rip),%rdi        # 318a <_IO_stdin_used+0x18a>
+    2b1a:	   |     |         e8 63 e6 ff ff       	call   1182 <nel::assert_fail(char const*, nel::Context const&)>
+    if (new_base == nullptr) { return nullptr; }
+    2b1f:	   \-----|-------> 31 db                	xor    %ebx,%ebx
+    2b21:	         \-------- eb 98                	jmp    2abb <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x8b>
+    2b23:	                   66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2b2a:	                   00 00 00 00 
+    2b2e:	                   66 90                	xchg   %ax,%ax
+
+0000000000002b30 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    2b30:	       53                   	push   %rbx
+            : fn_name_(fn_name)
+    2b31:	       48 8d 05 40 06 00 00 	lea    0x640(%rip),%rax        # 3178 <_IO_stdin_used+0x178>
+    2b38:	       48 8d 0d 29 06 00 00 	lea    0x629(%rip),%rcx        # 3168 <_IO_stdin_used+0x168>
+    2b3f:	       66 48 0f 6e c1       	movq   %rcx,%xmm0
+    2b44:	       66 48 0f 6e c8       	movq   %rax,%xmm1
+    2b49:	       66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2b4d:	       48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    2b51:	       c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    2b58:	       00 
+            : fn_name_(fn_name)
+    2b59:	       0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    2b5d:	       48 85 ff             	test   %rdi,%rdi
+    2b60:	/----- 74 35                	je     2b97 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+    2b62:	|      48 8d 47 ff          	lea    -0x1(%rdi),%rax
+    2b66:	|      48 89 fb             	mov    %rdi,%rbx
+    2b69:	|      48 85 f8             	test   %rdi,%rax
+    2b6c:	+----- 75 29                	jne    2b97 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2b6e:	|      48 8d 3c 37          	lea    (%rdi,%rsi,1),%rdi
+    2b72:	|      e8 59 e5 ff ff       	call   10d0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    2b77:	|      48 85 c0             	test   %rax,%rax
+    2b7a:	|  /-- 74 15                	je     2b91 <nel::malloc_aligned(unsigned long, unsigned long)+0x61>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    2b7c:	|  |   48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    2b81:	|  |   48 f7 db             	neg    %rbx
+    2b84:	|  |   48 21 da             	and    %rbx,%rdx
+    2b87:	|  |   48 29 c2             	sub    %rax,%rdx
+    uint8_t *const new_p = new_base + new_offset;
+    2b8a:	|  |   48 01 d0             	add    %rdx,%rax
+    offset_field(new_p) = new_offset;
+    2b8d:	|  |   48 89 50 f8          	mov    %rdx,-0x8(%rax)
+    return realloc_aligned(nullptr, align, 0, size);
+}
+    2b91:	|  \-> 48 83 c4 20          	add    $0x20,%rsp
+    2b95:	|      5b                   	pop    %rbx
+    2b96:	|      c3                   	ret
+    if (!pred) { assert_fail(msg, ctx); }
+    2b97:	\----> 48 89 e6             	mov    %rsp,%rsi
+    2b9a:	       48 8d 3d e9 05 00 00 	lea    0x5e9(%rip),%rdi        # 318a <_IO_stdin_used+0x18a>
+    2ba1:	       e8 dc e5 ff ff       	call   1182 <nel::assert_fail(char const*, nel::Context const&)>
+    2ba6:	       66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2bad:	       00 00 00 
+
+0000000000002bb0 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    2bb0:	53                   	push   %rbx
+    2bb1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    2bb4:	40 0f be fe          	movsbl %sil,%edi
+    2bb8:	48 8b 35 c1 24 00 00 	mov    0x24c1(%rip),%rsi        # 5080 <stderr@GLIBC_2.2.5>
+    2bbf:	e8 fc e4 ff ff       	call   10c0 <fputc@plt>
+    return outs;
+}
+    2bc4:	48 89 d8             	mov    %rbx,%rax
+    2bc7:	5b                   	pop    %rbx
+    2bc8:	c3                   	ret
+    2bc9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002bd0 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    2bd0:	53                   	push   %rbx
+    2bd1:	48 89 fb             	mov    %rdi,%rbx
+    2bd4:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    2bd7:	48 8b 35 a2 24 00 00 	mov    0x24a2(%rip),%rsi        # 5080 <stderr@GLIBC_2.2.5>
+    2bde:	e8 bd e4 ff ff       	call   10a0 <fputs@plt>
+    return outs;
+}
+    2be3:	48 89 d8             	mov    %rbx,%rax
+    2be6:	5b                   	pop    %rbx
+    2be7:	c3                   	ret
+    2be8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    2bef:	00 
+
+0000000000002bf0 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    2bf0:	53                   	push   %rbx
+    2bf1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    2bf4:	48 8b 3d 85 24 00 00 	mov    0x2485(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    2bfb:	40 0f b6 d6          	movzbl %sil,%edx
+    2bff:	31 c0                	xor    %eax,%eax
+    2c01:	48 8d 35 9d 05 00 00 	lea    0x59d(%rip),%rsi        # 31a5 <_IO_stdin_used+0x1a5>
+    2c08:	e8 d3 e4 ff ff       	call   10e0 <fprintf@plt>
+    return outs;
+}
+    2c0d:	48 89 d8             	mov    %rbx,%rax
+    2c10:	5b                   	pop    %rbx
+    2c11:	c3                   	ret
+    2c12:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2c19:	00 00 00 00 
+    2c1d:	0f 1f 00             	nopl   (%rax)
+
+0000000000002c20 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    2c20:	53                   	push   %rbx
+    2c21:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    2c24:	48 8b 3d 55 24 00 00 	mov    0x2455(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    2c2b:	0f b7 d6             	movzwl %si,%edx
+    2c2e:	31 c0                	xor    %eax,%eax
+    2c30:	48 8d 35 6e 05 00 00 	lea    0x56e(%rip),%rsi        # 31a5 <_IO_stdin_used+0x1a5>
+    2c37:	e8 a4 e4 ff ff       	call   10e0 <fprintf@plt>
+    return outs;
+}
+    2c3c:	48 89 d8             	mov    %rbx,%rax
+    2c3f:	5b                   	pop    %rbx
+    2c40:	c3                   	ret
+    2c41:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2c48:	00 00 00 00 
+    2c4c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002c50 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    2c50:	53                   	push   %rbx
+    2c51:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    2c54:	48 8b 3d 25 24 00 00 	mov    0x2425(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    2c5b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    2c5d:	31 c0                	xor    %eax,%eax
+    2c5f:	48 8d 35 3f 05 00 00 	lea    0x53f(%rip),%rsi        # 31a5 <_IO_stdin_used+0x1a5>
+    2c66:	e8 75 e4 ff ff       	call   10e0 <fprintf@plt>
+    return outs;
+}
+    2c6b:	48 89 d8             	mov    %rbx,%rax
+    2c6e:	5b                   	pop    %rbx
+    2c6f:	c3                   	ret
+
+0000000000002c70 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    2c70:	53                   	push   %rbx
+    2c71:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    2c74:	48 8b 3d 05 24 00 00 	mov    0x2405(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    2c7b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    2c7d:	31 c0                	xor    %eax,%eax
+    2c7f:	48 8d 35 1f 05 00 00 	lea    0x51f(%rip),%rsi        # 31a5 <_IO_stdin_used+0x1a5>
+    2c86:	e8 55 e4 ff ff       	call   10e0 <fprintf@plt>
+    return outs;
+}
+    2c8b:	48 89 d8             	mov    %rbx,%rax
+    2c8e:	5b                   	pop    %rbx
+    2c8f:	c3                   	ret
+
+0000000000002c90 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    2c90:	53                   	push   %rbx
+    2c91:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    2c94:	48 8b 3d e5 23 00 00 	mov    0x23e5(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    2c9b:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    2c9e:	31 c0                	xor    %eax,%eax
+    2ca0:	48 8d 35 01 05 00 00 	lea    0x501(%rip),%rsi        # 31a8 <_IO_stdin_used+0x1a8>
+    2ca7:	e8 34 e4 ff ff       	call   10e0 <fprintf@plt>
+    return outs;
+}
+    2cac:	48 89 d8             	mov    %rbx,%rax
+    2caf:	5b                   	pop    %rbx
+    2cb0:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000002cb4 <_fini>:
+    2cb4:	48 83 ec 08          	sub    $0x8,%rsp
+    2cb8:	48 83 c4 08          	add    $0x8,%rsp
+    2cbc:	c3                   	ret
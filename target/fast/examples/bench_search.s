@@ -0,0 +1,1651 @@
+
+target/fast/examples/bench_search:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 3f 00 00 	mov    0x3fc5(%rip),%rax        # 4fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 3f 00 00    	push   0x3fca(%rip)        # 4ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 3f 00 00    	jmp    *0x3fcc(%rip)        # 4ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 3f 00 00    	jmp    *0x3fca(%rip)        # 5000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 3f 00 00    	jmp    *0x3fc2(%rip)        # 5008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <clock_gettime@plt>:
+    1050:	ff 25 ba 3f 00 00    	jmp    *0x3fba(%rip)        # 5010 <clock_gettime@GLIBC_2.17>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputs@plt>:
+    1060:	ff 25 b2 3f 00 00    	jmp    *0x3fb2(%rip)        # 5018 <fputs@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 3f 00 00    	jmp    *0x3faa(%rip)        # 5020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fprintf@plt>:
+    1080:	ff 25 a2 3f 00 00    	jmp    *0x3fa2(%rip)        # 5028 <fprintf@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <malloc@plt>:
+    1090:	ff 25 9a 3f 00 00    	jmp    *0x3f9a(%rip)        # 5030 <malloc@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <realloc@plt>:
+    10a0:	ff 25 92 3f 00 00    	jmp    *0x3f92(%rip)        # 5038 <realloc@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010b0 <__cxa_finalize@plt>:
+    10b0:	ff 25 2a 3f 00 00    	jmp    *0x3f2a(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10b6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010c0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10c0:	50                   	push   %rax
+    std::abort();
+    10c1:	e8 7a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010c6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10c6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10c7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10ca:	4c 8d 0d 0f 20 00 00 	lea    0x200f(%rip),%r9        # 30e0 <sizes+0x40>
+    10d1:	31 c0                	xor    %eax,%eax
+    10d3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10d7:	4c 8b 07             	mov    (%rdi),%r8
+    10da:	48 8d 35 05 20 00 00 	lea    0x2005(%rip),%rsi        # 30e6 <sizes+0x46>
+    10e1:	48 8b 3d 78 3f 00 00 	mov    0x3f78(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+    10e8:	e8 93 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    10ed:	e8 4e ff ff ff       	call   1040 <abort@plt>
+
+00000000000010f2 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    10f2:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    10f6:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    10f9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    10fd:	31 c0                	xor    %eax,%eax
+    10ff:	57                   	push   %rdi
+    1100:	48 8b 3d 59 3f 00 00 	mov    0x3f59(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+    1107:	4c 8d 0d d2 1f 00 00 	lea    0x1fd2(%rip),%r9        # 30e0 <sizes+0x40>
+    110e:	4c 8b 06             	mov    (%rsi),%r8
+    1111:	48 8d 35 df 1f 00 00 	lea    0x1fdf(%rip),%rsi        # 30f7 <sizes+0x57>
+    1118:	e8 63 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    111d:	e8 1e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001122 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1122:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1126:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1129:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    112d:	31 c0                	xor    %eax,%eax
+    112f:	57                   	push   %rdi
+    1130:	48 8b 3d 29 3f 00 00 	mov    0x3f29(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+    1137:	4c 8d 0d ce 1f 00 00 	lea    0x1fce(%rip),%r9        # 310c <sizes+0x6c>
+    113e:	4c 8b 06             	mov    (%rsi),%r8
+    1141:	48 8d 35 af 1f 00 00 	lea    0x1faf(%rip),%rsi        # 30f7 <sizes+0x57>
+    1148:	e8 33 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    114d:	e8 ee fe ff ff       	call   1040 <abort@plt>
+    1152:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1159:	00 00 00 
+    115c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001160 <main>:
+    sink = sink + r;
+    bench::report_per_item(name, t, n_lookups);
+}
+
+int main()
+{
+    1160:	                                                    41 57                	push   %r15
+    1162:	                                                    48 8d 15 9d 1e 00 00 	lea    0x1e9d(%rip),%rdx        # 3006 <_IO_stdin_used+0x6>
+        //     // p % alignment == 0?
+        //     return ((Length)p & (align-1)) == 0;
+        // }
+        static Node *malloc(Count capacity)
+        {
+            Node *new_n = realloc(nullptr, capacity);
+    1169:	                                                    be 00 00 00 01       	mov    $0x1000000,%esi
+    116e:	                                                    31 ff                	xor    %edi,%edi
+    1170:	                                                    41 56                	push   %r14
+    1172:	                                                    48 8d 05 98 1e 00 00 	lea    0x1e98(%rip),%rax        # 3011 <_IO_stdin_used+0x11>
+    1179:	                                                    66 48 0f 6e ca       	movq   %rdx,%xmm1
+    117e:	                                                    41 55                	push   %r13
+    1180:	                                                    66 48 0f 6e d0       	movq   %rax,%xmm2
+    1185:	                                                    41 54                	push   %r12
+    1187:	                                                    66 0f 6c ca          	punpcklqdq %xmm2,%xmm1
+    118b:	                                                    55                   	push   %rbp
+    118c:	                                                    53                   	push   %rbx
+    118d:	                                                    48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+    1194:	                                                    0f 29 4c 24 10       	movaps %xmm1,0x10(%rsp)
+    1199:	                                                    e8 02 0e 00 00       	call   1fa0 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    119e:	                                                    48 89 c2             	mov    %rax,%rdx
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    11a1:	                                                    48 85 c0             	test   %rax,%rax
+    11a4:	                                                /-- 74 08                	je     11ae <main+0x4e>
+    11a6:	                                                |   48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    11ad:	                                                |   00 
+            Node *new_n = realloc(nullptr, capacity);
+    11ae:	                                                \-> 31 ff                	xor    %edi,%edi
+    11b0:	                                                    be 00 00 00 01       	mov    $0x1000000,%esi
+    11b5:	                                                    48 89 54 24 08       	mov    %rdx,0x8(%rsp)
+    11ba:	                                                    e8 e1 0d 00 00       	call   1fa0 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    11bf:	                                                    48 8b 54 24 08       	mov    0x8(%rsp),%rdx
+    11c4:	                                                    48 85 c0             	test   %rax,%rax
+            Node *new_n = realloc(nullptr, capacity);
+    11c7:	                                                    49 89 c3             	mov    %rax,%r11
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    11ca:	                                                /-- 74 08                	je     11d4 <main+0x74>
+    11cc:	                                                |   48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    11d3:	                                                |   00 
+         *
+         * @returns the current in use count.
+         */
+        constexpr Length len(void) const
+        {
+            return (item_ == nullptr) ? 0 : item_->len();
+    11d4:	                                                \-> 48 85 d2             	test   %rdx,%rdx
+    11d7:	/-------------------------------------------------- 0f 85 5a 08 00 00    	jne    1a37 <main+0x8d7>
+            if (align == 0 || (align & (align - 1)) != 0) {
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+            }
+            void *const new_p = is_over_aligned(align)
+                                    ? realloc_aligned(p, align, old_size, new_size)
+                                    : std::realloc(p, new_size);
+    11dd:	|                                                   bf 24 00 00 00       	mov    $0x24,%edi
+    11e2:	|                                                   4c 89 5c 24 08       	mov    %r11,0x8(%rsp)
+    11e7:	|                                                   e8 a4 fe ff ff       	call   1090 <malloc@plt>
+    11ec:	|                                                   48 89 c2             	mov    %rax,%rdx
+            if (new_p == nullptr) {
+    11ef:	|                                                   48 85 c0             	test   %rax,%rax
+    11f2:	|              /----------------------------------- 0f 84 10 01 00 00    	je     1308 <main+0x1a8>
+                Element<T> ok_;
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    11f8:	|              |                                    4c 8b 5c 24 08       	mov    0x8(%rsp),%r11
+    nel::Length const max_n = sizes[sizeof(sizes) / sizeof(sizes[0]) - 1];
+    auto sorted = nel::heaped::Vector<int>::with_capacity(max_n);
+    auto layout = nel::heaped::Vector<int>::with_capacity(max_n);
+    for (nel::Index i = 0; i < max_n; ++i) {
+        sorted.push(int(2 * i)).unwrap();
+    11fd:	|              |                                    45 31 ed             	xor    %r13d,%r13d
+                    // poison new memory,
+                    // assumes realloc adds to end
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+                }
+            }
+            new_n->alloc_ = new_cap;
+    1200:	|              |                                    b9 01 00 00 00       	mov    $0x1,%ecx
+    1205:	|              |                                    31 db                	xor    %ebx,%ebx
+    1207:	|              |                                    66 0f 6f 05 c1 1e 00 	movdqa 0x1ec1(%rip),%xmm0        # 30d0 <sizes+0x30>
+    120e:	|              |                                    00 
+    120f:	|              |                                    0f 11 00             	movups %xmm0,(%rax)
+            return alloc_;
+        }
+
+        constexpr Length len(void) const
+        {
+            return len_;
+    1212:	|              |                                    31 c0                	xor    %eax,%eax
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    1214:	|              |                                    44 89 6c 82 10       	mov    %r13d,0x10(%rdx,%rax,4)
+            len_ += 1;
+    1219:	|              |                                    48 89 4a 08          	mov    %rcx,0x8(%rdx)
+    121d:	|              |                                    4d 85 db             	test   %r11,%r11
+    1220:	|              |  /-------------------------------- 0f 84 a5 01 00 00    	je     13cb <main+0x26b>
+            return len_;
+    1226:	|              |  |     /-------------------------> 49 8b 43 08          	mov    0x8(%r11),%rax
+            return alloc_;
+    122a:	|              |  |     |                           49 8b 0b             	mov    (%r11),%rcx
+
+    private:
+        // Make room for n more values, only ever grows.
+        bool try_reserve_for(Count const n)
+        {
+            if (len() + n <= capacity()) { return true; }
+    122d:	|              |  |     |                           48 8d 70 01          	lea    0x1(%rax),%rsi
+    1231:	|              |  |     |                           48 39 f1             	cmp    %rsi,%rcx
+    1234:	|              |  |     |                       /-- 72 32                	jb     1268 <main+0x108>
+            if (len() >= capacity()) {
+    1236:	|              |  |     |           /-----------|-> 48 39 c8             	cmp    %rcx,%rax
+    1239:	|              |  |     |           |        /--|-- 0f 82 8d 00 00 00    	jb     12cc <main+0x16c>
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    123f:	|              |  |  /--|-----------|--------|--|-> 66 0f 6f 64 24 10    	movdqa 0x10(%rsp),%xmm4
+         *
+         * `this` is consumed by the operation.
+         */
+        constexpr void unwrap(Context const &ctx = Context())
+        {
+            return consumev([](void) {}, [](E &&) { nel::panic("not an ok"); }, ctx);
+    1245:	|              |  |  |  |           |        |  |   48 8d 74 24 60       	lea    0x60(%rsp),%rsi
+    124a:	|              |  |  |  |           |        |  |   48 8d 3d d2 1d 00 00 	lea    0x1dd2(%rip),%rdi        # 3023 <_IO_stdin_used+0x23>
+            , file_name_(file_name)
+            , line_num_(line_num)
+    1251:	|              |  |  |  |           |        |  |   c7 44 24 70 1f 04 00 	movl   $0x41f,0x70(%rsp)
+    1258:	|              |  |  |  |           |        |  |   00 
+            : fn_name_(fn_name)
+    1259:	|              |  |  |  |           |        |  |   0f 29 64 24 60       	movaps %xmm4,0x60(%rsp)
+    125e:	|              |  |  |  |           |        |  |   e8 8f fe ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+    1263:	|              |  |  |  |           |        |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            if (cap <= cur) { return cap; }
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    1268:	|              |  |  |  |           |        |  \-> 48 83 f9 03          	cmp    $0x3,%rcx
+    126c:	|              |  |  |  |           |  /-----|----- 0f 87 be 00 00 00    	ja     1330 <main+0x1d0>
+    1272:	|              |  |  |  |           |  |     |      b9 04 00 00 00       	mov    $0x4,%ecx
+    1277:	|              |  |  |  |           |  |     |      48 39 ce             	cmp    %rcx,%rsi
+    127a:	|              |  |  |  |           |  |     |      48 0f 42 f1          	cmovb  %rcx,%rsi
+    127e:	|              |  |  |  |           |  |     |      48 39 c6             	cmp    %rax,%rsi
+    1281:	|              |  |  |  |           |  |     |      48 0f 43 c6          	cmovae %rsi,%rax
+    1285:	|              |  |  |  |           |  |     |      48 89 c5             	mov    %rax,%rbp
+            if (new_cap > max_capacity) { return nullptr; }
+    1288:	|              |  |  |  |           |  |  /--|----> 48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    128f:	|              |  |  |  |           |  |  |  |      ff ff 1f 
+    1292:	|              |  |  |  |           |  |  |  |      48 89 54 24 08       	mov    %rdx,0x8(%rsp)
+    1297:	|              |  |  |  |           |  |  |  |      48 39 e8             	cmp    %rbp,%rax
+    129a:	|              |  |  +--|-----------|--|--|--|----- 72 a3                	jb     123f <main+0xdf>
+                                    : std::realloc(p, new_size);
+    129c:	|              |  |  |  |           |  |  |  |      4c 89 df             	mov    %r11,%rdi
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    129f:	|              |  |  |  |           |  |  |  |      48 8d 34 ad 14 00 00 	lea    0x14(,%rbp,4),%rsi
+    12a6:	|              |  |  |  |           |  |  |  |      00 
+    12a7:	|              |  |  |  |           |  |  |  |      e8 f4 fd ff ff       	call   10a0 <realloc@plt>
+    12ac:	|              |  |  |  |           |  |  |  |      49 89 c3             	mov    %rax,%r11
+            if (new_p == nullptr) {
+    12af:	|              |  |  |  |           |  |  |  |      48 85 c0             	test   %rax,%rax
+    12b2:	|              |  |  +--|-----------|--|--|--|----- 74 8b                	je     123f <main+0xdf>
+            new_n->alloc_ = new_cap;
+    12b4:	|              |  |  |  |           |  |  |  |      48 89 28             	mov    %rbp,(%rax)
+            return len_;
+    12b7:	|              |  |  |  |           |  |  |  |      48 8b 40 08          	mov    0x8(%rax),%rax
+    12bb:	|              |  |  |  |           |  |  |  |      48 89 e9             	mov    %rbp,%rcx
+    12be:	|              |  |  |  |           |  |  |  |      48 8b 54 24 08       	mov    0x8(%rsp),%rdx
+            if (len() >= capacity()) {
+    12c3:	|              |  |  |  |           |  |  |  |      48 39 c8             	cmp    %rcx,%rax
+    12c6:	|              |  |  +--|-----------|--|--|--|----- 0f 83 73 ff ff ff    	jae    123f <main+0xdf>
+            len_ += 1;
+    12cc:	|              |  |  |  |           |  |  |  \----> 48 8d 48 01          	lea    0x1(%rax),%rcx
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    12d0:	|              |  |  |  |        /--|--|--|-------> 41 c7 44 83 10 00 00 	movl   $0x0,0x10(%r11,%rax,4)
+    12d7:	|              |  |  |  |        |  |  |  |         00 00 
+    for (nel::Index i = 0; i < max_n; ++i) {
+    12d9:	|              |  |  |  |        |  |  |  |         83 c3 02             	add    $0x2,%ebx
+            len_ += 1;
+    12dc:	|              |  |  |  |        |  |  |  |         49 89 4b 08          	mov    %rcx,0x8(%r11)
+    12e0:	|              |  |  |  |        |  |  |  |         81 fb 00 00 00 02    	cmp    $0x2000000,%ebx
+    12e6:	|              |  |  |  |  /-----|--|--|--|-------- 0f 84 89 01 00 00    	je     1475 <main+0x315>
+        sorted.push(int(2 * i)).unwrap();
+    12ec:	|              |  |  |  |  |     |  |  |  |         41 89 dd             	mov    %ebx,%r13d
+            return len_;
+    12ef:	|  /-----------|--|--|--|--|-----|--|--|--|-------> 48 8b 42 08          	mov    0x8(%rdx),%rax
+            return alloc_;
+    12f3:	|  |           |  |  |  |  |     |  |  |  |         48 8b 2a             	mov    (%rdx),%rbp
+    12f6:	|  |           |  |  |  |  |     |  |  |  |         48 8d 48 01          	lea    0x1(%rax),%rcx
+    12fa:	|  |           |  |  |  |  |     |  |  |  |         48 39 cd             	cmp    %rcx,%rbp
+    12fd:	|  |           |  |  |  |  |     |  |  |  |     /-- 72 51                	jb     1350 <main+0x1f0>
+            if (len() >= capacity()) {
+    12ff:	|  |           |  |  |  |  |  /--|--|--|--|-----|-> 48 39 e8             	cmp    %rbp,%rax
+    1302:	|  |           |  |  |  |  |  |  |  |  |  |  /--|-- 0f 82 ad 00 00 00    	jb     13b5 <main+0x255>
+    1308:	|  |           >--|--|--|--|--|--|--|--|--|--|--|-> 66 0f 6f 5c 24 10    	movdqa 0x10(%rsp),%xmm3
+    130e:	|  |           |  |  |  |  |  |  |  |  |  |  |  |   48 8d 74 24 60       	lea    0x60(%rsp),%rsi
+    1313:	|  |           |  |  |  |  |  |  |  |  |  |  |  |   48 8d 3d 09 1d 00 00 	lea    0x1d09(%rip),%rdi        # 3023 <_IO_stdin_used+0x23>
+            , line_num_(line_num)
+    131a:	|  |           |  |  |  |  |  |  |  |  |  |  |  |   c7 44 24 70 1f 04 00 	movl   $0x41f,0x70(%rsp)
+    1321:	|  |           |  |  |  |  |  |  |  |  |  |  |  |   00 
+            : fn_name_(fn_name)
+    1322:	|  |           |  |  |  |  |  |  |  |  |  |  |  |   0f 29 5c 24 60       	movaps %xmm3,0x60(%rsp)
+    1327:	|  |           |  |  |  |  |  |  |  |  |  |  |  |   e8 c6 fd ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+    132c:	|  |           |  |  |  |  |  |  |  |  |  |  |  |   0f 1f 40 00          	nopl   0x0(%rax)
+    1330:	|  |           |  |  |  |  |  |  |  |  \--|--|--|-> 48 8d 2c 09          	lea    (%rcx,%rcx,1),%rbp
+    1334:	|  |           |  |  |  |  |  |  |  |     |  |  |   48 39 f5             	cmp    %rsi,%rbp
+    1337:	|  |           |  |  |  |  |  |  |  |     |  |  |   48 0f 42 ee          	cmovb  %rsi,%rbp
+    133b:	|  |           |  |  |  |  |  |  |  |     |  |  |   48 39 c5             	cmp    %rax,%rbp
+    133e:	|  |           |  |  |  |  |  |  |  |     |  |  |   48 0f 42 e8          	cmovb  %rax,%rbp
+            } else if (new_cap == item_->capacity()) {
+    1342:	|  |           |  |  |  |  |  |  |  |     |  |  |   48 39 cd             	cmp    %rcx,%rbp
+    1345:	|  |           |  |  |  |  |  |  |  |     \--|--|-- 0f 85 3d ff ff ff    	jne    1288 <main+0x128>
+    134b:	|  |           |  |  |  |  |  |  |  \--------|--|-- e9 e6 fe ff ff       	jmp    1236 <main+0xd6>
+    1350:	|  |           |  |  |  |  |  |  |           |  \-> 48 83 fd 03          	cmp    $0x3,%rbp
+    1354:	|  |           |  |  |  |  |  |  |           |  /-- 0f 87 ae 00 00 00    	ja     1408 <main+0x2a8>
+    135a:	|  |           |  |  |  |  |  |  |           |  |   be 04 00 00 00       	mov    $0x4,%esi
+    135f:	|  |           |  |  |  |  |  |  |           |  |   48 39 f1             	cmp    %rsi,%rcx
+    1362:	|  |           |  |  |  |  |  |  |           |  |   48 0f 42 ce          	cmovb  %rsi,%rcx
+    1366:	|  |           |  |  |  |  |  |  |           |  |   48 39 c1             	cmp    %rax,%rcx
+    1369:	|  |           |  |  |  |  |  |  |           |  |   48 0f 43 c1          	cmovae %rcx,%rax
+    136d:	|  |           |  |  |  |  |  |  |           |  |   48 89 c5             	mov    %rax,%rbp
+            if (new_cap > max_capacity) { return nullptr; }
+    1370:	|  |  /--------|--|--|--|--|--|--|-----------|--|-> 48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    1377:	|  |  |        |  |  |  |  |  |  |           |  |   ff ff 1f 
+    137a:	|  |  |        |  |  |  |  |  |  |           |  |   4c 89 5c 24 08       	mov    %r11,0x8(%rsp)
+    137f:	|  |  |        |  |  |  |  |  |  |           |  |   48 39 e8             	cmp    %rbp,%rax
+    1382:	|  |  |        +--|--|--|--|--|--|-----------|--|-- 72 84                	jb     1308 <main+0x1a8>
+                                    : std::realloc(p, new_size);
+    1384:	|  |  |        |  |  |  |  |  |  |           |  |   48 89 d7             	mov    %rdx,%rdi
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1387:	|  |  |        |  |  |  |  |  |  |           |  |   48 8d 34 ad 14 00 00 	lea    0x14(,%rbp,4),%rsi
+    138e:	|  |  |        |  |  |  |  |  |  |           |  |   00 
+    138f:	|  |  |        |  |  |  |  |  |  |           |  |   e8 0c fd ff ff       	call   10a0 <realloc@plt>
+    1394:	|  |  |        |  |  |  |  |  |  |           |  |   48 89 c2             	mov    %rax,%rdx
+            if (new_p == nullptr) {
+    1397:	|  |  |        |  |  |  |  |  |  |           |  |   48 85 c0             	test   %rax,%rax
+    139a:	|  |  |        +--|--|--|--|--|--|-----------|--|-- 0f 84 68 ff ff ff    	je     1308 <main+0x1a8>
+            new_n->alloc_ = new_cap;
+    13a0:	|  |  |        |  |  |  |  |  |  |           |  |   48 89 28             	mov    %rbp,(%rax)
+            return len_;
+    13a3:	|  |  |        |  |  |  |  |  |  |           |  |   48 8b 40 08          	mov    0x8(%rax),%rax
+    13a7:	|  |  |        |  |  |  |  |  |  |           |  |   4c 8b 5c 24 08       	mov    0x8(%rsp),%r11
+            if (len() >= capacity()) {
+    13ac:	|  |  |        |  |  |  |  |  |  |           |  |   48 39 e8             	cmp    %rbp,%rax
+    13af:	|  |  |        +--|--|--|--|--|--|-----------|--|-- 0f 83 53 ff ff ff    	jae    1308 <main+0x1a8>
+            len_ += 1;
+    13b5:	|  |  |        |  |  |  |  |  |  |           \--|-> 48 8d 48 01          	lea    0x1(%rax),%rcx
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    13b9:	|  |  |        |  |  |  |  |  |  |              |   44 89 6c 82 10       	mov    %r13d,0x10(%rdx,%rax,4)
+            len_ += 1;
+    13be:	|  |  |        |  |  |  |  |  |  |              |   48 89 4a 08          	mov    %rcx,0x8(%rdx)
+            return (item_ == nullptr) ? 0 : item_->len();
+    13c2:	|  |  |        |  |  |  |  |  |  |              |   4d 85 db             	test   %r11,%r11
+    13c5:	|  |  |        |  |  |  \--|--|--|--------------|-- 0f 85 5b fe ff ff    	jne    1226 <main+0xc6>
+                                    : std::realloc(p, new_size);
+    13cb:	|  |  |        |  \--|-----|--|--|--------------|-> bf 24 00 00 00       	mov    $0x24,%edi
+    13d0:	|  |  |        |     |     |  |  |              |   48 89 54 24 08       	mov    %rdx,0x8(%rsp)
+    13d5:	|  |  |        |     |     |  |  |              |   e8 b6 fc ff ff       	call   1090 <malloc@plt>
+    13da:	|  |  |        |     |     |  |  |              |   49 89 c3             	mov    %rax,%r11
+            if (new_p == nullptr) {
+    13dd:	|  |  |        |     |     |  |  |              |   48 85 c0             	test   %rax,%rax
+    13e0:	|  |  |        |     \-----|--|--|--------------|-- 0f 84 59 fe ff ff    	je     123f <main+0xdf>
+            new_n->alloc_ = new_cap;
+    13e6:	|  |  |        |           |  |  |              |   66 0f 6f 05 e2 1c 00 	movdqa 0x1ce2(%rip),%xmm0        # 30d0 <sizes+0x30>
+    13ed:	|  |  |        |           |  |  |              |   00 
+    13ee:	|  |  |        |           |  |  |              |   48 8b 54 24 08       	mov    0x8(%rsp),%rdx
+    13f3:	|  |  |        |           |  |  |              |   b9 01 00 00 00       	mov    $0x1,%ecx
+    13f8:	|  |  |        |           |  |  |              |   0f 11 00             	movups %xmm0,(%rax)
+            return len_;
+    13fb:	|  |  |        |           |  |  |              |   31 c0                	xor    %eax,%eax
+    13fd:	|  |  |        |           |  |  \--------------|-- e9 ce fe ff ff       	jmp    12d0 <main+0x170>
+    1402:	|  |  |        |           |  |                 |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1408:	|  |  |        |           |  |                 \-> 4c 8d 64 2d 00       	lea    0x0(%rbp,%rbp,1),%r12
+    140d:	|  |  |        |           |  |                     49 39 cc             	cmp    %rcx,%r12
+    1410:	|  |  |        |           |  |                     4c 0f 42 e1          	cmovb  %rcx,%r12
+    1414:	|  |  |        |           |  |                     49 39 c4             	cmp    %rax,%r12
+    1417:	|  |  |        |           |  |                     4c 0f 42 e0          	cmovb  %rax,%r12
+            } else if (new_cap == item_->capacity()) {
+    141b:	|  |  |        |           |  |                     49 39 ec             	cmp    %rbp,%r12
+    141e:	|  |  |        |           |  +-------------------- 0f 84 db fe ff ff    	je     12ff <main+0x19f>
+            } else if (new_cap > item_->capacity()) {
+    1424:	|  |  |        |           |  |                     4c 39 e5             	cmp    %r12,%rbp
+    1427:	|  |  |  /-----|-----------|--|-------------------- 0f 82 6b 06 00 00    	jb     1a98 <main+0x938>
+            if (new_cap > max_capacity) { return nullptr; }
+    142d:	|  |  |  |     |           |  |                     48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    1434:	|  |  |  |     |           |  |                     ff ff 1f 
+    1437:	|  |  |  |     |           |  |                     4c 89 5c 24 08       	mov    %r11,0x8(%rsp)
+    143c:	|  |  |  |     |           |  |                     4c 39 e0             	cmp    %r12,%rax
+    143f:	|  |  |  |     +-----------|--|-------------------- 0f 82 c3 fe ff ff    	jb     1308 <main+0x1a8>
+                                    : std::realloc(p, new_size);
+    1445:	|  |  |  |     |           |  |                     48 89 d7             	mov    %rdx,%rdi
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1448:	|  |  |  |     |           |  |                     4a 8d 34 a5 14 00 00 	lea    0x14(,%r12,4),%rsi
+    144f:	|  |  |  |     |           |  |                     00 
+    1450:	|  |  |  |     |           |  |                     e8 4b fc ff ff       	call   10a0 <realloc@plt>
+    1455:	|  |  |  |     |           |  |                     48 89 c2             	mov    %rax,%rdx
+            if (new_p == nullptr) {
+    1458:	|  |  |  |     |           |  |                     48 85 c0             	test   %rax,%rax
+    145b:	|  |  |  |     \-----------|--|-------------------- 0f 84 a7 fe ff ff    	je     1308 <main+0x1a8>
+            new_n->alloc_ = new_cap;
+    1461:	|  |  |  |                 |  |                     4c 89 20             	mov    %r12,(%rax)
+            return len_;
+    1464:	|  |  |  |                 |  |                     4c 8b 5c 24 08       	mov    0x8(%rsp),%r11
+    1469:	|  |  |  |                 |  |                     4c 89 e5             	mov    %r12,%rbp
+    146c:	|  |  |  |                 |  |                     48 8b 40 08          	mov    0x8(%rax),%rax
+    1470:	|  |  |  |                 |  \-------------------- e9 8a fe ff ff       	jmp    12ff <main+0x19f>
+    1475:	|  |  |  |                 \----------------------> 48 8d 05 24 1c 00 00 	lea    0x1c24(%rip),%rax        # 30a0 <sizes>
+// Log a result line: name, and time per item in ns (to 2 decimal places).
+inline void report_per_item(char const *const name, long unsigned int const ns,
+                            long unsigned int const items)
+{
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    long unsigned int const frac = cns % 100UL;
+    147c:	|  |  |  |                                          48 89 54 24 20       	mov    %rdx,0x20(%rsp)
+    1481:	|  |  |  |                                          48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1486:	|  |  |  |                                          48 8d 44 24 60       	lea    0x60(%rsp),%rax
+    148b:	|  |  |  |                                          48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    1490:	|  |  |  |                                          4c 89 5c 24 28       	mov    %r11,0x28(%rsp)
+        layout.push(0).unwrap();
+    }
+    nel::sort::Less less;
+
+    for (nel::Length const n: sizes) {
+    1495:	|  |  |  |  /-------------------------------------> 48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    149a:	|  |  |  |  |                                       48 8b 18             	mov    (%rax),%rbx
+    149d:	|  |  |  |  |                                       48 8b 44 24 20       	mov    0x20(%rsp),%rax
+    14a2:	|  |  |  |  |                                       48 8b 40 08          	mov    0x8(%rax),%rax
+         * @returns if e > array len, clamp to last elem.
+         * @returns else return slice over region b..e of slice.
+         */
+        Slice slice(Index b, Index e) const
+        {
+            if (b >= e) { return Slice::empty(); }
+    14a6:	|  |  |  |  |                                       48 85 db             	test   %rbx,%rbx
+    14a9:	|  |  |  |  |                             /-------- 0f 85 b2 00 00 00    	jne    1561 <main+0x401>
+            , len_(0)
+    14af:	|  |  |  |  |                             |         31 f6                	xor    %esi,%esi
+        auto s = sorted.slice(0, n);
+        auto e = layout.slice(0, n);
+        nel::search::eytzinger_from(e.ptr(), s.ptr(), n);
+        nel::log << "table of " << n << " ints\n";
+    14b1:	|  |  |  |  |                             |         48 8d 3d c0 3b 00 00 	lea    0x3bc0(%rip),%rdi        # 5078 <nel::log>
+    14b8:	|  |  |  |  |                             |         45 31 f6             	xor    %r14d,%r14d
+    14bb:	|  |  |  |  |                             |         31 ed                	xor    %ebp,%ebp
+    14bd:	|  |  |  |  |                             |         48 89 74 24 48       	mov    %rsi,0x48(%rsp)
+    14c2:	|  |  |  |  |                             |         48 8d 35 64 1b 00 00 	lea    0x1b64(%rip),%rsi        # 302d <_IO_stdin_used+0x2d>
+    14c9:	|  |  |  |  |                             |         e8 32 0b 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+    14ce:	|  |  |  |  |                             |         31 f6                	xor    %esi,%esi
+    14d0:	|  |  |  |  |                             |         48 89 c7             	mov    %rax,%rdi
+    14d3:	|  |  |  |  |                             |         e8 e8 0b 00 00       	call   20c0 <nel::operator<<(nel::Log&, unsigned long)>
+    14d8:	|  |  |  |  |                             |         48 8d 35 58 1b 00 00 	lea    0x1b58(%rip),%rsi        # 3037 <_IO_stdin_used+0x37>
+    14df:	|  |  |  |  |                             |         48 89 c7             	mov    %rax,%rdi
+    14e2:	|  |  |  |  |                             |         e8 19 0b 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    14e7:	|  |  |  |  |                          /--|-------> 48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    14ec:	|  |  |  |  |                          |  |         bf 01 00 00 00       	mov    $0x1,%edi
+    long unsigned int r = 0;
+    14f1:	|  |  |  |  |                          |  |         45 31 ed             	xor    %r13d,%r13d
+    14f4:	|  |  |  |  |                          |  |         e8 57 fb ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    14f9:	|  |  |  |  |                          |  |         4c 8b 64 24 60       	mov    0x60(%rsp),%r12
+    14fe:	|  |  |  |  |                          |  |         4c 8b 7c 24 68       	mov    0x68(%rsp),%r15
+            int const key = int(next_rand(seed) % (2 * n));
+    1503:	|  |  |  |  |                          |  |         4c 8d 04 1b          	lea    (%rbx,%rbx,1),%r8
+            return (idx >= len_) ? None : Optional<Type &>::Some(content_[idx]);
+    1507:	|  |  |  |  |                          |  |         48 8b 4c 24 48       	mov    0x48(%rsp),%rcx
+    150c:	|  |  |  |  |                          |  |         bf 00 09 3d 00       	mov    $0x3d0900,%edi
+    unsigned int seed = 0x9e3779b9;
+    1511:	|  |  |  |  |                          |  |         be b9 79 37 9e       	mov    $0x9e3779b9,%esi
+    1516:	|  |  |  |  |                          |  |     /-- eb 15                	jmp    152d <main+0x3cd>
+    1518:	|  |  |  |  |                          |  |     |   0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    151f:	|  |  |  |  |                          |  |     |   00 
+            r += f(key);
+    1520:	|  |  |  |  |                          |  |  /--|-> 49 01 c5             	add    %rax,%r13
+        for (nel::Index i = 0; i < n_lookups; ++i) {
+    1523:	|  |  |  |  |                          |  |  |  |   48 83 ef 01          	sub    $0x1,%rdi
+    1527:	|  |  |  |  |  /-----------------------|--|--|--|-- 0f 84 7f 05 00 00    	je     1aac <main+0x94c>
+    s ^= s << 13;
+    152d:	|  |  |  |  |  |                       |  |  |  \-> 89 f2                	mov    %esi,%edx
+    152f:	|  |  |  |  |  |                       |  |  |      c1 e2 0d             	shl    $0xd,%edx
+    1532:	|  |  |  |  |  |                       |  |  |      31 f2                	xor    %esi,%edx
+    s ^= s >> 17;
+    1534:	|  |  |  |  |  |                       |  |  |      89 d0                	mov    %edx,%eax
+    1536:	|  |  |  |  |  |                       |  |  |      c1 e8 11             	shr    $0x11,%eax
+    1539:	|  |  |  |  |  |                       |  |  |      31 d0                	xor    %edx,%eax
+            int const key = int(next_rand(seed) % (2 * n));
+    153b:	|  |  |  |  |  |                       |  |  |      31 d2                	xor    %edx,%edx
+    s ^= s << 5;
+    153d:	|  |  |  |  |  |                       |  |  |      89 c6                	mov    %eax,%esi
+    153f:	|  |  |  |  |  |                       |  |  |      c1 e6 05             	shl    $0x5,%esi
+    1542:	|  |  |  |  |  |                       |  |  |      31 c6                	xor    %eax,%esi
+            int const key = int(next_rand(seed) % (2 * n));
+    1544:	|  |  |  |  |  |                       |  |  |      89 f0                	mov    %esi,%eax
+    1546:	|  |  |  |  |  |                       |  |  |      49 f7 f0             	div    %r8
+
+        if (n <= max_linear) {
+            run("  linear, try_get   ", n, [&s](int const key) -> nel::Index {
+                nel::Index i = 0;
+    1549:	|  |  |  |  |  |                       |  |  |      31 c0                	xor    %eax,%eax
+    154b:	|  |  |  |  |  |                       |  |  |      0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    1550:	|  |  |  |  |  |                       |  |  |  /-> 48 39 c8             	cmp    %rcx,%rax
+    1553:	|  |  |  |  |  |                       |  |  +--|-- 74 cb                	je     1520 <main+0x3c0>
+                while (s.try_get(i).is_some() && s[i] < key) {
+    1555:	|  |  |  |  |  |                       |  |  |  |   41 3b 14 86          	cmp    (%r14,%rax,4),%edx
+    1559:	|  |  |  |  |  |                       |  |  \--|-- 7e c5                	jle    1520 <main+0x3c0>
+                    i += 1;
+    155b:	|  |  |  |  |  |                       |  |     |   48 83 c0 01          	add    $0x1,%rax
+    155f:	|  |  |  |  |  |                       |  |     \-- eb ef                	jmp    1550 <main+0x3f0>
+    1561:	|  |  |  |  |  |                       |  \-------> 48 8b 7c 24 28       	mov    0x28(%rsp),%rdi
+    1566:	|  |  |  |  |  |                       |            48 8b 57 08          	mov    0x8(%rdi),%rdx
+            if (b >= len_) { return Slice::empty(); }
+    156a:	|  |  |  |  |  |                       |            48 85 c0             	test   %rax,%rax
+    156d:	|  |  |  |  |  |     /-----------------|----------- 0f 84 14 05 00 00    	je     1a87 <main+0x927>
+            return Slice(values_, len());
+    1573:	|  |  |  |  |  |     |                 |            48 8b 7c 24 20       	mov    0x20(%rsp),%rdi
+            , len_(len)
+    1578:	|  |  |  |  |  |     |                 |            48 39 c3             	cmp    %rax,%rbx
+    157b:	|  |  |  |  |  |     |                 |            48 0f 46 c3          	cmovbe %rbx,%rax
+    157f:	|  |  |  |  |  |     |                 |            48 8d 4f 10          	lea    0x10(%rdi),%rcx
+    1583:	|  |  |  |  |  |     |                 |            48 89 4c 24 40       	mov    %rcx,0x40(%rsp)
+    1588:	|  |  |  |  |  |     |                 |            48 89 44 24 48       	mov    %rax,0x48(%rsp)
+            if (b >= len_) { return Slice::empty(); }
+    158d:	|  |  |  |  |  |     |     /-----------|----------> 48 85 d2             	test   %rdx,%rdx
+    1590:	|  |  |  |  |  |     |  /--|-----------|----------- 0f 84 0a 05 00 00    	je     1aa0 <main+0x940>
+    1596:	|  |  |  |  |  |     |  |  |           |            48 8b 44 24 28       	mov    0x28(%rsp),%rax
+    159b:	|  |  |  |  |  |     |  |  |           |            48 83 c0 10          	add    $0x10,%rax
+    159f:	|  |  |  |  |  |     |  |  |           |            48 89 44 24 50       	mov    %rax,0x50(%rsp)
+            return content_;
+    15a4:	|  |  |  |  |  |     |  |  |  /--------|----------> 4c 8b 74 24 40       	mov    0x40(%rsp),%r14
+    15a9:	|  |  |  |  |  |     |  |  |  |        |            48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+    15ae:	|  |  |  |  |  |     |  |  |  |        |            45 31 c0             	xor    %r8d,%r8d
+    15b1:	|  |  |  |  |  |     |  |  |  |        |            41 bc 01 00 00 00    	mov    $0x1,%r12d
+// In-order walk of the tree at node i (1-based) filling it from src[k..].
+template<typename T>
+Index eytzinger_fill(T dst[], T const src[], Length const n, Index const i, Index k)
+{
+    if (i <= n) {
+        k = eytzinger_fill(dst, src, n, 2 * i, k);
+    15b7:	|  |  |  |  |  |     |  |  |  |        |        /-> 4f 8d 2c 24          	lea    (%r12,%r12,1),%r13
+    15bb:	|  |  |  |  |  |     |  |  |  |        |        |   48 89 da             	mov    %rbx,%rdx
+    15be:	|  |  |  |  |  |     |  |  |  |        |        |   4c 89 f6             	mov    %r14,%rsi
+    15c1:	|  |  |  |  |  |     |  |  |  |        |        |   48 89 ef             	mov    %rbp,%rdi
+    15c4:	|  |  |  |  |  |     |  |  |  |        |        |   4c 89 e9             	mov    %r13,%rcx
+    15c7:	|  |  |  |  |  |     |  |  |  |        |        |   e8 24 07 00 00       	call   1cf0 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)>
+        dst[i - 1] = src[k];
+    15cc:	|  |  |  |  |  |     |  |  |  |        |        |   41 8b 14 86          	mov    (%r14,%rax,4),%edx
+        k += 1;
+    15d0:	|  |  |  |  |  |     |  |  |  |        |        |   4c 8d 40 01          	lea    0x1(%rax),%r8
+        dst[i - 1] = src[k];
+    15d4:	|  |  |  |  |  |     |  |  |  |        |        |   42 89 54 a5 fc       	mov    %edx,-0x4(%rbp,%r12,4)
+        k = eytzinger_fill(dst, src, n, 2 * i + 1, k);
+    15d9:	|  |  |  |  |  |     |  |  |  |        |        |   4d 8d 65 01          	lea    0x1(%r13),%r12
+    if (i <= n) {
+    15dd:	|  |  |  |  |  |     |  |  |  |        |        |   4c 39 e3             	cmp    %r12,%rbx
+    15e0:	|  |  |  |  |  |     |  |  |  |        |        \-- 73 d5                	jae    15b7 <main+0x457>
+        nel::log << "table of " << n << " ints\n";
+    15e2:	|  |  |  |  |  |     |  |  |  |        |            48 8d 35 44 1a 00 00 	lea    0x1a44(%rip),%rsi        # 302d <_IO_stdin_used+0x2d>
+    15e9:	|  |  |  |  |  |     |  |  |  |        |            48 8d 3d 88 3a 00 00 	lea    0x3a88(%rip),%rdi        # 5078 <nel::log>
+    15f0:	|  |  |  |  |  |     |  |  |  |        |            e8 0b 0a 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+    15f5:	|  |  |  |  |  |     |  |  |  |        |            48 89 de             	mov    %rbx,%rsi
+    15f8:	|  |  |  |  |  |     |  |  |  |        |            48 89 c7             	mov    %rax,%rdi
+    15fb:	|  |  |  |  |  |     |  |  |  |        |            e8 c0 0a 00 00       	call   20c0 <nel::operator<<(nel::Log&, unsigned long)>
+    1600:	|  |  |  |  |  |     |  |  |  |        |            48 8d 35 30 1a 00 00 	lea    0x1a30(%rip),%rsi        # 3037 <_IO_stdin_used+0x37>
+    1607:	|  |  |  |  |  |     |  |  |  |        |            48 89 c7             	mov    %rax,%rdi
+    160a:	|  |  |  |  |  |     |  |  |  |        |            e8 f1 09 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+        if (n <= max_linear) {
+    160f:	|  |  |  |  |  |     |  |  |  |        |            48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+    1616:	|  |  |  |  |  |     |  |  |  |        \----------- 0f 86 cb fe ff ff    	jbe    14e7 <main+0x387>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    161c:	|  |  |  |  |  |  /--|--|--|--|-------------------> 48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1621:	|  |  |  |  |  |  |  |  |  |  |                     bf 01 00 00 00       	mov    $0x1,%edi
+            int const key = int(next_rand(seed) % (2 * n));
+    1626:	|  |  |  |  |  |  |  |  |  |  |                     4c 8d 2c 1b          	lea    (%rbx,%rbx,1),%r13
+    long unsigned int r = 0;
+    162a:	|  |  |  |  |  |  |  |  |  |  |                     45 31 ff             	xor    %r15d,%r15d
+            int const key = int(next_rand(seed) % (2 * n));
+    162d:	|  |  |  |  |  |  |  |  |  |  |                     41 bc 00 09 3d 00    	mov    $0x3d0900,%r12d
+    1633:	|  |  |  |  |  |  |  |  |  |  |                     e8 18 fa ff ff       	call   1050 <clock_gettime@plt>
+    unsigned int seed = 0x9e3779b9;
+    1638:	|  |  |  |  |  |  |  |  |  |  |                     48 89 5c 24 30       	mov    %rbx,0x30(%rsp)
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    163d:	|  |  |  |  |  |  |  |  |  |  |                     48 8b 4c 24 68       	mov    0x68(%rsp),%rcx
+    1642:	|  |  |  |  |  |  |  |  |  |  |                     41 b8 b9 79 37 9e    	mov    $0x9e3779b9,%r8d
+    1648:	|  |  |  |  |  |  |  |  |  |  |                     4c 69 4c 24 60 00 ca 	imul   $0x3b9aca00,0x60(%rsp),%r9
+    164f:	|  |  |  |  |  |  |  |  |  |  |                     9a 3b 
+        for (nel::Index i = 0; i < n_lookups; ++i) {
+    1651:	|  |  |  |  |  |  |  |  |  |  |                     4c 8b 54 24 48       	mov    0x48(%rsp),%r10
+    unsigned int seed = 0x9e3779b9;
+    1656:	|  |  |  |  |  |  |  |  |  |  |                     48 89 6c 24 38       	mov    %rbp,0x38(%rsp)
+    165b:	|  |  |  |  |  |  |  |  |  |  |                     0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    s ^= s << 13;
+    1660:	|  |  |  |  |  |  |  |  |  |  |        /----------> 44 89 c2             	mov    %r8d,%edx
+    1663:	|  |  |  |  |  |  |  |  |  |  |        |            c1 e2 0d             	shl    $0xd,%edx
+    1666:	|  |  |  |  |  |  |  |  |  |  |        |            44 31 c2             	xor    %r8d,%edx
+    s ^= s >> 17;
+    1669:	|  |  |  |  |  |  |  |  |  |  |        |            89 d0                	mov    %edx,%eax
+    166b:	|  |  |  |  |  |  |  |  |  |  |        |            c1 e8 11             	shr    $0x11,%eax
+    166e:	|  |  |  |  |  |  |  |  |  |  |        |            31 d0                	xor    %edx,%eax
+    s ^= s << 5;
+    1670:	|  |  |  |  |  |  |  |  |  |  |        |            41 89 c0             	mov    %eax,%r8d
+    1673:	|  |  |  |  |  |  |  |  |  |  |        |            41 c1 e0 05          	shl    $0x5,%r8d
+    1677:	|  |  |  |  |  |  |  |  |  |  |        |            41 31 c0             	xor    %eax,%r8d
+    if (n == 0) { return 0; }
+    167a:	|  |  |  |  |  |  |  |  |  |  |        |            4d 85 d2             	test   %r10,%r10
+    167d:	|  |  |  |  |  |  |  |  |  |  |        |  /-------- 74 79                	je     16f8 <main+0x598>
+            int const key = int(next_rand(seed) % (2 * n));
+    167f:	|  |  |  |  |  |  |  |  |  |  |        |  |         44 89 c0             	mov    %r8d,%eax
+    1682:	|  |  |  |  |  |  |  |  |  |  |        |  |         31 d2                	xor    %edx,%edx
+    while (n > 1) {
+    1684:	|  |  |  |  |  |  |  |  |  |  |        |  |         4c 89 f7             	mov    %r14,%rdi
+    1687:	|  |  |  |  |  |  |  |  |  |  |        |  |         49 f7 f5             	div    %r13
+    168a:	|  |  |  |  |  |  |  |  |  |  |        |  |         89 d5                	mov    %edx,%ebp
+    168c:	|  |  |  |  |  |  |  |  |  |  |        |  |         49 83 fa 01          	cmp    $0x1,%r10
+    1690:	|  |  |  |  |  |  |  |  |  |  |  /-----|--|-------- 0f 84 9a 03 00 00    	je     1a30 <main+0x8d0>
+    1696:	|  |  |  |  |  |  |  |  |  |  |  |     |  |         4c 89 d6             	mov    %r10,%rsi
+    1699:	|  |  |  |  |  |  |  |  |  |  |  |     |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        Length const h = n / 2;
+    16a0:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  /----> 49 89 f3             	mov    %rsi,%r11
+    16a3:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |      49 d1 eb             	shr    %r11
+        if (h * sizeof(T) > prefetch_bytes) {
+    16a6:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |      4a 8d 04 9d 00 00 00 	lea    0x0(,%r11,4),%rax
+    16ad:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |      00 
+    16ae:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |      48 3d 00 01 00 00    	cmp    $0x100,%rax
+    16b4:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  /-- 76 19                	jbe    16cf <main+0x56f>
+                reinterpret_cast<void const *>(uintptr_t(b) + (h / 2) * sizeof(T)));
+    16b6:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |   48 89 f3             	mov    %rsi,%rbx
+    16b9:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |   48 83 e3 fc          	and    $0xfffffffffffffffc,%rbx
+            __builtin_prefetch(
+    16bd:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |   0f 18 0c 1f          	prefetcht0 (%rdi,%rbx,1)
+                reinterpret_cast<void const *>(uintptr_t(b) + (h / 2) * sizeof(T)));
+    16c1:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |   48 89 f3             	mov    %rsi,%rbx
+    16c4:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |   48 c1 eb 02          	shr    $0x2,%rbx
+                reinterpret_cast<void const *>(uintptr_t(b) + (h + h / 2) * sizeof(T)));
+    16c8:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |   4c 01 db             	add    %r11,%rbx
+            __builtin_prefetch(
+    16cb:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |   0f 18 0c 9f          	prefetcht0 (%rdi,%rbx,4)
+        b = pred(b[h]) ? b + h : b;
+    16cf:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  \-> 48 01 f8             	add    %rdi,%rax
+ * The default comparator, a < b.
+ */
+struct Less
+{
+        template<typename T>
+        constexpr bool operator()(T const &a, T const &b) const
+    16d2:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |      3b 28                	cmp    (%rax),%ebp
+    16d4:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |      48 0f 4f f8          	cmovg  %rax,%rdi
+        n -= h;
+    16d8:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |      4c 29 de             	sub    %r11,%rsi
+    while (n > 1) {
+    16db:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |      48 83 fe 01          	cmp    $0x1,%rsi
+    16df:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  \----- 77 bf                	ja     16a0 <main+0x540>
+    return Index(b - p) + (pred(*b) ? 1 : 0);
+    16e1:	|  |  |  |  |  |  |  |  |  |  |  |     |  |         48 89 fe             	mov    %rdi,%rsi
+    16e4:	|  |  |  |  |  |  |  |  |  |  |  |     |  |         4c 29 f6             	sub    %r14,%rsi
+    16e7:	|  |  |  |  |  |  |  |  |  |  |  |     |  |         48 c1 fe 02          	sar    $0x2,%rsi
+    16eb:	|  |  |  |  |  |  |  |  |  |  |  |  /--|--|-------> 31 c0                	xor    %eax,%eax
+    16ed:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |         3b 17                	cmp    (%rdi),%edx
+    16ef:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |         0f 9f c0             	setg   %al
+    16f2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 01 f0             	add    %rsi,%rax
+            r += f(key);
+    16f5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |         49 01 c7             	add    %rax,%r15
+        for (nel::Index i = 0; i < n_lookups; ++i) {
+    16f8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  \-------> 49 83 ec 01          	sub    $0x1,%r12
+    16fc:	|  |  |  |  |  |  |  |  |  |  |  |  |  \----------- 0f 85 5e ff ff ff    	jne    1660 <main+0x500>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1702:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1707:	|  |  |  |  |  |  |  |  |  |  |  |  |               bf 01 00 00 00       	mov    $0x1,%edi
+    170c:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8b 6c 24 38       	mov    0x38(%rsp),%rbp
+    1711:	|  |  |  |  |  |  |  |  |  |  |  |  |               4c 89 4c 24 38       	mov    %r9,0x38(%rsp)
+    1716:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8b 5c 24 30       	mov    0x30(%rsp),%rbx
+    171b:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 89 4c 24 30       	mov    %rcx,0x30(%rsp)
+    1720:	|  |  |  |  |  |  |  |  |  |  |  |  |               e8 2b f9 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1725:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8b 4c 24 30       	mov    0x30(%rsp),%rcx
+    172a:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 69 44 24 60 00 ca 	imul   $0x3b9aca00,0x60(%rsp),%rax
+    1731:	|  |  |  |  |  |  |  |  |  |  |  |  |               9a 3b 
+    nel::log << name << ": " << cns / 100UL << '.' << (frac < 10 ? "0" : "") << frac
+             << "ns/item\n";
+    1733:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 35 22 19 00 00 	lea    0x1922(%rip),%rsi        # 305c <_IO_stdin_used+0x5c>
+    return now_ns() - b;
+    173a:	|  |  |  |  |  |  |  |  |  |  |  |  |               4c 8b 4c 24 38       	mov    0x38(%rsp),%r9
+    sink = sink + r;
+    173f:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8b 15 2a 39 00 00 	mov    0x392a(%rip),%rdx        # 5070 <sink>
+             << "ns/item\n";
+    1746:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 3d 2b 39 00 00 	lea    0x392b(%rip),%rdi        # 5078 <nel::log>
+    174d:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 29 c8             	sub    %rcx,%rax
+    return now_ns() - b;
+    1750:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 03 44 24 68       	add    0x68(%rsp),%rax
+    1755:	|  |  |  |  |  |  |  |  |  |  |  |  |               4c 01 fa             	add    %r15,%rdx
+    1758:	|  |  |  |  |  |  |  |  |  |  |  |  |               4c 29 c8             	sub    %r9,%rax
+    175b:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 89 15 0e 39 00 00 	mov    %rdx,0x390e(%rip)        # 5070 <sink>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1762:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    1766:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+    176a:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 b8 db 34 b6 d7 82 	movabs $0x431bde82d7b634db,%rax
+    1771:	|  |  |  |  |  |  |  |  |  |  |  |  |               de 1b 43 
+    1774:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 c1 e2 02          	shl    $0x2,%rdx
+    1778:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 f7 e2             	mul    %rdx
+    long unsigned int const frac = cns % 100UL;
+    177b:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    1782:	|  |  |  |  |  |  |  |  |  |  |  |  |               c2 f5 28 
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1785:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 89 d1             	mov    %rdx,%rcx
+    long unsigned int const frac = cns % 100UL;
+    1788:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 c1 ea 16          	shr    $0x16,%rdx
+    178c:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 f7 e2             	mul    %rdx
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    178f:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 c1 e9 14          	shr    $0x14,%rcx
+    long unsigned int const frac = cns % 100UL;
+    1793:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 c1 ea 02          	shr    $0x2,%rdx
+    1797:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+    179b:	|  |  |  |  |  |  |  |  |  |  |  |  |               49 89 d7             	mov    %rdx,%r15
+    179e:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    17a2:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 c1 e0 02          	shl    $0x2,%rax
+    17a6:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 29 c1             	sub    %rax,%rcx
+    17a9:	|  |  |  |  |  |  |  |  |  |  |  |  |               49 89 ce             	mov    %rcx,%r14
+             << "ns/item\n";
+    17ac:	|  |  |  |  |  |  |  |  |  |  |  |  |               e8 4f 08 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+    17b1:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 35 d2 18 00 00 	lea    0x18d2(%rip),%rsi        # 308a <_IO_stdin_used+0x8a>
+    17b8:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    17bb:	|  |  |  |  |  |  |  |  |  |  |  |  |               e8 40 08 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+    17c0:	|  |  |  |  |  |  |  |  |  |  |  |  |               4c 89 fe             	mov    %r15,%rsi
+    17c3:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    17c6:	|  |  |  |  |  |  |  |  |  |  |  |  |               e8 f5 08 00 00       	call   20c0 <nel::operator<<(nel::Log&, unsigned long)>
+    17cb:	|  |  |  |  |  |  |  |  |  |  |  |  |               be 2e 00 00 00       	mov    $0x2e,%esi
+    17d0:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    17d3:	|  |  |  |  |  |  |  |  |  |  |  |  |               e8 08 08 00 00       	call   1fe0 <nel::operator<<(nel::Log&, char)>
+    17d8:	|  |  |  |  |  |  |  |  |  |  |  |  |               49 83 fe 0a          	cmp    $0xa,%r14
+    17dc:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 35 21 18 00 00 	lea    0x1821(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+    17e3:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    17e6:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 05 6e 18 00 00 	lea    0x186e(%rip),%rax        # 305b <_IO_stdin_used+0x5b>
+    17ed:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 0f 43 f0          	cmovae %rax,%rsi
+    17f1:	|  |  |  |  |  |  |  |  |  |  |  |  |               e8 0a 08 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+    17f6:	|  |  |  |  |  |  |  |  |  |  |  |  |               4c 89 f6             	mov    %r14,%rsi
+    17f9:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    17fc:	|  |  |  |  |  |  |  |  |  |  |  |  |               e8 bf 08 00 00       	call   20c0 <nel::operator<<(nel::Log&, unsigned long)>
+    1801:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 35 4b 18 00 00 	lea    0x184b(%rip),%rsi        # 3053 <_IO_stdin_used+0x53>
+    1808:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    180b:	|  |  |  |  |  |  |  |  |  |  |  |  |               e8 f0 07 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1810:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1815:	|  |  |  |  |  |  |  |  |  |  |  |  |               bf 01 00 00 00       	mov    $0x1,%edi
+    181a:	|  |  |  |  |  |  |  |  |  |  |  |  |               e8 31 f8 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    181f:	|  |  |  |  |  |  |  |  |  |  |  |  |               4c 8b 7c 24 68       	mov    0x68(%rsp),%r15
+    1824:	|  |  |  |  |  |  |  |  |  |  |  |  |               41 b8 00 09 3d 00    	mov    $0x3d0900,%r8d
+    182a:	|  |  |  |  |  |  |  |  |  |  |  |  |               4c 69 74 24 60 00 ca 	imul   $0x3b9aca00,0x60(%rsp),%r14
+    1831:	|  |  |  |  |  |  |  |  |  |  |  |  |               9a 3b 
+    unsigned int seed = 0x9e3779b9;
+    1833:	|  |  |  |  |  |  |  |  |  |  |  |  |               be b9 79 37 9e       	mov    $0x9e3779b9,%esi
+    1838:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 7d fc          	lea    -0x4(%rbp),%rdi
+            reinterpret_cast<void const *>(uintptr_t(e) + (ahead * i - 1) * sizeof(T)));
+        i = 2 * i + (less(e[i - 1], key) ? 1 : 0);
+    }
+    // The trailing 1s of i are the steps right (less) after the last step left,
+    // which was at the answer.
+    i >>= __builtin_ffsll((long long)(~i));
+    183c:	|  |  |  |  |  |  |  |  |  |  |  |  |               49 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%r9
+    1843:	|  |  |  |  |  |  |  |  |  |  |  |  |               0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    s ^= s << 13;
+    1848:	|  |  |  |  |  |  |  |  |  |  |  |  |     /-------> 89 f2                	mov    %esi,%edx
+    184a:	|  |  |  |  |  |  |  |  |  |  |  |  |     |         c1 e2 0d             	shl    $0xd,%edx
+    184d:	|  |  |  |  |  |  |  |  |  |  |  |  |     |         31 f2                	xor    %esi,%edx
+    s ^= s >> 17;
+    184f:	|  |  |  |  |  |  |  |  |  |  |  |  |     |         89 d0                	mov    %edx,%eax
+    1851:	|  |  |  |  |  |  |  |  |  |  |  |  |     |         c1 e8 11             	shr    $0x11,%eax
+    1854:	|  |  |  |  |  |  |  |  |  |  |  |  |     |         31 d0                	xor    %edx,%eax
+            int const key = int(next_rand(seed) % (2 * n));
+    1856:	|  |  |  |  |  |  |  |  |  |  |  |  |     |         31 d2                	xor    %edx,%edx
+    s ^= s << 5;
+    1858:	|  |  |  |  |  |  |  |  |  |  |  |  |     |         89 c6                	mov    %eax,%esi
+    185a:	|  |  |  |  |  |  |  |  |  |  |  |  |     |         c1 e6 05             	shl    $0x5,%esi
+    185d:	|  |  |  |  |  |  |  |  |  |  |  |  |     |         31 c6                	xor    %eax,%esi
+            int const key = int(next_rand(seed) % (2 * n));
+    185f:	|  |  |  |  |  |  |  |  |  |  |  |  |     |         89 f0                	mov    %esi,%eax
+    1861:	|  |  |  |  |  |  |  |  |  |  |  |  |     |         49 f7 f5             	div    %r13
+    while (i <= n) {
+    1864:	|  |  |  |  |  |  |  |  |  |  |  |  |     |         48 85 db             	test   %rbx,%rbx
+    1867:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  /----- 74 49                	je     18b2 <main+0x752>
+    Index i = 1;
+    1869:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |      b8 01 00 00 00       	mov    $0x1,%eax
+    186e:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |      66 90                	xchg   %ax,%ax
+            reinterpret_cast<void const *>(uintptr_t(e) + (ahead * i - 1) * sizeof(T)));
+    1870:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  /-> 48 89 c1             	mov    %rax,%rcx
+    1873:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |   48 c1 e1 06          	shl    $0x6,%rcx
+        __builtin_prefetch(
+    1877:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |   0f 18 0c 0f          	prefetcht0 (%rdi,%rcx,1)
+        i = 2 * i + (less(e[i - 1], key) ? 1 : 0);
+    187b:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |   31 c9                	xor    %ecx,%ecx
+    187d:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |   3b 54 85 fc          	cmp    -0x4(%rbp,%rax,4),%edx
+    1881:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |   0f 9f c1             	setg   %cl
+    1884:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |   48 8d 04 41          	lea    (%rcx,%rax,2),%rax
+    while (i <= n) {
+    1888:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |   48 39 c3             	cmp    %rax,%rbx
+    188b:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  \-- 73 e3                	jae    1870 <main+0x710>
+    i >>= __builtin_ffsll((long long)(~i));
+    188d:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |      48 89 c1             	mov    %rax,%rcx
+            r += f(key);
+    1890:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |      49 8d 14 1c          	lea    (%r12,%rbx,1),%rdx
+    1894:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |      48 f7 d1             	not    %rcx
+    1897:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |      48 0f bc c9          	bsf    %rcx,%rcx
+    189b:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |      49 0f 44 c9          	cmove  %r9,%rcx
+    189f:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |      48 83 c1 01          	add    $0x1,%rcx
+    18a3:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |      48 d3 e8             	shr    %cl,%rax
+    18a6:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |      4e 8d 64 20 ff       	lea    -0x1(%rax,%r12,1),%r12
+    18ab:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |      48 85 c0             	test   %rax,%rax
+    18ae:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |      4c 0f 44 e2          	cmove  %rdx,%r12
+        for (nel::Index i = 0; i < n_lookups; ++i) {
+    18b2:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  \----> 49 83 e8 01          	sub    $0x1,%r8
+    18b6:	|  |  |  |  |  |  |  |  |  |  |  |  |     \-------- 75 90                	jne    1848 <main+0x6e8>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    18b8:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    18bd:	|  |  |  |  |  |  |  |  |  |  |  |  |               bf 01 00 00 00       	mov    $0x1,%edi
+    18c2:	|  |  |  |  |  |  |  |  |  |  |  |  |               e8 89 f7 ff ff       	call   1050 <clock_gettime@plt>
+    sink = sink + r;
+    18c7:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8b 15 a2 37 00 00 	mov    0x37a2(%rip),%rdx        # 5070 <sink>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    18ce:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 69 44 24 60 00 ca 	imul   $0x3b9aca00,0x60(%rsp),%rax
+    18d5:	|  |  |  |  |  |  |  |  |  |  |  |  |               9a 3b 
+             << "ns/item\n";
+    18d7:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 35 93 17 00 00 	lea    0x1793(%rip),%rsi        # 3071 <_IO_stdin_used+0x71>
+    18de:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 3d 93 37 00 00 	lea    0x3793(%rip),%rdi        # 5078 <nel::log>
+    18e5:	|  |  |  |  |  |  |  |  |  |  |  |  |               4c 01 e2             	add    %r12,%rdx
+    18e8:	|  |  |  |  |  |  |  |  |  |  |  |  |               4c 29 f8             	sub    %r15,%rax
+    return now_ns() - b;
+    18eb:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 03 44 24 68       	add    0x68(%rsp),%rax
+    18f0:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 89 15 79 37 00 00 	mov    %rdx,0x3779(%rip)        # 5070 <sink>
+    18f7:	|  |  |  |  |  |  |  |  |  |  |  |  |               4c 29 f0             	sub    %r14,%rax
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    18fa:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    18fe:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 14 80          	lea    (%rax,%rax,4),%rdx
+    1902:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 b8 db 34 b6 d7 82 	movabs $0x431bde82d7b634db,%rax
+    1909:	|  |  |  |  |  |  |  |  |  |  |  |  |               de 1b 43 
+    190c:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 c1 e2 02          	shl    $0x2,%rdx
+    1910:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 f7 e2             	mul    %rdx
+    long unsigned int const frac = cns % 100UL;
+    1913:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    191a:	|  |  |  |  |  |  |  |  |  |  |  |  |               c2 f5 28 
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    191d:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 89 d1             	mov    %rdx,%rcx
+    long unsigned int const frac = cns % 100UL;
+    1920:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 c1 ea 16          	shr    $0x16,%rdx
+    1924:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 f7 e2             	mul    %rdx
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1927:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 c1 e9 14          	shr    $0x14,%rcx
+    long unsigned int const frac = cns % 100UL;
+    192b:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 89 cb             	mov    %rcx,%rbx
+    192e:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 c1 ea 02          	shr    $0x2,%rdx
+    1932:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+    1936:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 89 d5             	mov    %rdx,%rbp
+    1939:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    193d:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 c1 e0 02          	shl    $0x2,%rax
+    1941:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 29 c3             	sub    %rax,%rbx
+             << "ns/item\n";
+    1944:	|  |  |  |  |  |  |  |  |  |  |  |  |               e8 b7 06 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+    1949:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 35 3a 17 00 00 	lea    0x173a(%rip),%rsi        # 308a <_IO_stdin_used+0x8a>
+    1950:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    1953:	|  |  |  |  |  |  |  |  |  |  |  |  |               e8 a8 06 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+    1958:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 89 ee             	mov    %rbp,%rsi
+    195b:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    195e:	|  |  |  |  |  |  |  |  |  |  |  |  |               e8 5d 07 00 00       	call   20c0 <nel::operator<<(nel::Log&, unsigned long)>
+    1963:	|  |  |  |  |  |  |  |  |  |  |  |  |               be 2e 00 00 00       	mov    $0x2e,%esi
+    1968:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    196b:	|  |  |  |  |  |  |  |  |  |  |  |  |               e8 70 06 00 00       	call   1fe0 <nel::operator<<(nel::Log&, char)>
+    1970:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    1973:	|  |  |  |  |  |  |  |  |  |  |  |  |               48 83 fb 09          	cmp    $0x9,%rbx
+    1977:	|  |  |  |  |  |  |  |  |  |  |  |  |        /----- 0f 86 c4 00 00 00    	jbe    1a41 <main+0x8e1>
+    197d:	|  |  |  |  |  |  |  |  |  |  |  |  |        |      48 8d 35 d7 16 00 00 	lea    0x16d7(%rip),%rsi        # 305b <_IO_stdin_used+0x5b>
+    1984:	|  |  |  |  |  |  |  |  |  |  |  |  |        |      e8 77 06 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+    1989:	|  |  |  |  |  |  |  |  |  |  |  |  |        |      48 89 de             	mov    %rbx,%rsi
+    198c:	|  |  |  |  |  |  |  |  |  |  |  |  |        |      48 89 c7             	mov    %rax,%rdi
+    198f:	|  |  |  |  |  |  |  |  |  |  |  |  |        |      e8 2c 07 00 00       	call   20c0 <nel::operator<<(nel::Log&, unsigned long)>
+    1994:	|  |  |  |  |  |  |  |  |  |  |  |  |        |      48 8d 35 b8 16 00 00 	lea    0x16b8(%rip),%rsi        # 3053 <_IO_stdin_used+0x53>
+    199b:	|  |  |  |  |  |  |  |  |  |  |  |  |        |      48 89 c7             	mov    %rax,%rdi
+    199e:	|  |  |  |  |  |  |  |  |  |  |  |  |        |      e8 5d 06 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+    for (nel::Length const n: sizes) {
+    19a3:	|  |  |  |  |  |  |  |  |  |  |  |  |        |      48 83 44 24 08 08    	addq   $0x8,0x8(%rsp)
+    19a9:	|  |  |  |  |  |  |  |  |  |  |  |  |        |      48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    19ae:	|  |  |  |  |  |  |  |  |  |  |  |  |        |      48 8d 3d 1b 17 00 00 	lea    0x171b(%rip),%rdi        # 30d0 <sizes+0x30>
+    19b5:	|  |  |  |  |  |  |  |  |  |  |  |  |        |      48 39 f8             	cmp    %rdi,%rax
+    19b8:	|  |  |  |  +--|--|--|--|--|--|--|--|--------|----- 0f 85 d7 fa ff ff    	jne    1495 <main+0x335>
+    19be:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  /-> 48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+    19c3:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   4c 8b 5c 24 28       	mov    0x28(%rsp),%r11
+        });
+        run("  eytzinger         ", n, [&e, &less, n](int const key) -> nel::Index {
+            return nel::search::eytzinger_lower_bound(e.ptr(), n, key, less);
+        });
+    }
+    nel::log << "sink: " << (long unsigned int)sink << '\n';
+    19c8:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   48 8d 35 b7 16 00 00 	lea    0x16b7(%rip),%rsi        # 3086 <_IO_stdin_used+0x86>
+    19cf:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   48 8d 3d a2 36 00 00 	lea    0x36a2(%rip),%rdi        # 5078 <nel::log>
+    19d6:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   4c 89 5c 24 10       	mov    %r11,0x10(%rsp)
+    19db:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   48 89 54 24 08       	mov    %rdx,0x8(%rsp)
+    19e0:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   e8 1b 06 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+    19e5:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   48 8b 35 84 36 00 00 	mov    0x3684(%rip),%rsi        # 5070 <sink>
+    19ec:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   48 89 c7             	mov    %rax,%rdi
+    19ef:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   e8 cc 06 00 00       	call   20c0 <nel::operator<<(nel::Log&, unsigned long)>
+    19f4:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   be 0a 00 00 00       	mov    $0xa,%esi
+    19f9:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   48 89 c7             	mov    %rax,%rdi
+    19fc:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   e8 df 05 00 00       	call   1fe0 <nel::operator<<(nel::Log&, char)>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    1a01:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    1a06:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   e8 25 f6 ff ff       	call   1030 <free@plt>
+    1a0b:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    1a10:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   e8 1b f6 ff ff       	call   1030 <free@plt>
+}
+    1a15:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   48 81 c4 88 00 00 00 	add    $0x88,%rsp
+    1a1c:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   31 c0                	xor    %eax,%eax
+    1a1e:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   5b                   	pop    %rbx
+    1a1f:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   5d                   	pop    %rbp
+    1a20:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   41 5c                	pop    %r12
+    1a22:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   41 5d                	pop    %r13
+    1a24:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   41 5e                	pop    %r14
+    1a26:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   41 5f                	pop    %r15
+    1a28:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   c3                   	ret
+    1a29:	|  |  |  |  |  |  |  |  |  |  |  |  |        |  |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    while (n > 1) {
+    1a30:	|  |  |  |  |  |  |  |  |  |  |  \--|--------|--|-> 31 f6                	xor    %esi,%esi
+    1a32:	|  |  |  |  |  |  |  |  |  |  |     \--------|--|-- e9 b4 fc ff ff       	jmp    16eb <main+0x58b>
+    1a37:	\--|--|--|--|--|--|--|--|--|--|--------------|--|-> 31 db                	xor    %ebx,%ebx
+        sorted.push(int(2 * i)).unwrap();
+    1a39:	   |  |  |  |  |  |  |  |  |  |              |  |   45 31 ed             	xor    %r13d,%r13d
+    1a3c:	   \--|--|--|--|--|--|--|--|--|--------------|--|-- e9 ae f8 ff ff       	jmp    12ef <main+0x18f>
+    1a41:	      |  |  |  |  |  |  |  |  |              \--|-> 48 8d 35 bc 15 00 00 	lea    0x15bc(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+    1a48:	      |  |  |  |  |  |  |  |  |                 |   e8 b3 05 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+    1a4d:	      |  |  |  |  |  |  |  |  |                 |   48 89 de             	mov    %rbx,%rsi
+    1a50:	      |  |  |  |  |  |  |  |  |                 |   48 89 c7             	mov    %rax,%rdi
+    1a53:	      |  |  |  |  |  |  |  |  |                 |   e8 68 06 00 00       	call   20c0 <nel::operator<<(nel::Log&, unsigned long)>
+    1a58:	      |  |  |  |  |  |  |  |  |                 |   48 8d 35 f4 15 00 00 	lea    0x15f4(%rip),%rsi        # 3053 <_IO_stdin_used+0x53>
+    1a5f:	      |  |  |  |  |  |  |  |  |                 |   48 89 c7             	mov    %rax,%rdi
+    1a62:	      |  |  |  |  |  |  |  |  |                 |   e8 99 05 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+    for (nel::Length const n: sizes) {
+    1a67:	      |  |  |  |  |  |  |  |  |                 |   48 83 44 24 08 08    	addq   $0x8,0x8(%rsp)
+    1a6d:	      |  |  |  |  |  |  |  |  |                 |   48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    1a72:	      |  |  |  |  |  |  |  |  |                 |   48 8d 3d 57 16 00 00 	lea    0x1657(%rip),%rdi        # 30d0 <sizes+0x30>
+    1a79:	      |  |  |  |  |  |  |  |  |                 |   48 39 c7             	cmp    %rax,%rdi
+    1a7c:	      |  |  \--|--|--|--|--|--|-----------------|-- 0f 85 13 fa ff ff    	jne    1495 <main+0x335>
+    1a82:	      |  |     |  |  |  |  |  |                 \-- e9 37 ff ff ff       	jmp    19be <main+0x85e>
+            , len_(0)
+    1a87:	      |  |     |  |  \--|--|--|-------------------> 31 c9                	xor    %ecx,%ecx
+    1a89:	      |  |     |  |     |  |  |                     48 89 4c 24 40       	mov    %rcx,0x40(%rsp)
+    1a8e:	      |  |     |  |     |  |  |                     48 89 4c 24 48       	mov    %rcx,0x48(%rsp)
+        Slice slice(Index b, Index e) const
+    1a93:	      |  |     |  |     |  \--|-------------------- e9 f5 fa ff ff       	jmp    158d <main+0x42d>
+    1a98:	      |  \-----|--|-----|-----|-------------------> 4c 89 e5             	mov    %r12,%rbp
+    1a9b:	      \--------|--|-----|-----|-------------------- e9 d0 f8 ff ff       	jmp    1370 <main+0x210>
+            : content_(nullptr)
+    1aa0:	               |  |     \-----|-------------------> 31 c0                	xor    %eax,%eax
+    1aa2:	               |  |           |                     48 89 44 24 50       	mov    %rax,0x50(%rsp)
+            return Slice();
+    1aa7:	               |  |           \-------------------- e9 f8 fa ff ff       	jmp    15a4 <main+0x444>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1aac:	               \--|-------------------------------> 48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1ab1:	                  |                                 bf 01 00 00 00       	mov    $0x1,%edi
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1ab6:	                  |                                 4d 69 e4 00 ca 9a 3b 	imul   $0x3b9aca00,%r12,%r12
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1abd:	                  |                                 e8 8e f5 ff ff       	call   1050 <clock_gettime@plt>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1ac2:	                  |                                 b9 00 09 3d 00       	mov    $0x3d0900,%ecx
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1ac7:	                  |                                 48 69 44 24 60 00 ca 	imul   $0x3b9aca00,0x60(%rsp),%rax
+    1ace:	                  |                                 9a 3b 
+    sink = sink + r;
+    1ad0:	                  |                                 48 8b 15 99 35 00 00 	mov    0x3599(%rip),%rdx        # 5070 <sink>
+    long unsigned int const frac = cns % 100UL;
+    1ad7:	                  |                                 bf 64 00 00 00       	mov    $0x64,%edi
+             << "ns/item\n";
+    1adc:	                  |                                 48 8d 35 5b 15 00 00 	lea    0x155b(%rip),%rsi        # 303e <_IO_stdin_used+0x3e>
+    1ae3:	                  |                                 4c 01 ea             	add    %r13,%rdx
+    1ae6:	                  |                                 4c 29 f8             	sub    %r15,%rax
+    return now_ns() - b;
+    1ae9:	                  |                                 48 03 44 24 68       	add    0x68(%rsp),%rax
+    1aee:	                  |                                 48 89 15 7b 35 00 00 	mov    %rdx,0x357b(%rip)        # 5070 <sink>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1af5:	                  |                                 31 d2                	xor    %edx,%edx
+    return now_ns() - b;
+    1af7:	                  |                                 4c 29 e0             	sub    %r12,%rax
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1afa:	                  |                                 48 6b c0 64          	imul   $0x64,%rax,%rax
+    1afe:	                  |                                 48 f7 f1             	div    %rcx
+    long unsigned int const frac = cns % 100UL;
+    1b01:	                  |                                 31 d2                	xor    %edx,%edx
+    1b03:	                  |                                 48 f7 f7             	div    %rdi
+             << "ns/item\n";
+    1b06:	                  |                                 48 8d 3d 6b 35 00 00 	lea    0x356b(%rip),%rdi        # 5078 <nel::log>
+    long unsigned int const frac = cns % 100UL;
+    1b0d:	                  |                                 49 89 d4             	mov    %rdx,%r12
+    1b10:	                  |                                 49 89 c5             	mov    %rax,%r13
+             << "ns/item\n";
+    1b13:	                  |                                 e8 e8 04 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+    1b18:	                  |                                 48 8d 35 6b 15 00 00 	lea    0x156b(%rip),%rsi        # 308a <_IO_stdin_used+0x8a>
+    1b1f:	                  |                                 48 89 c7             	mov    %rax,%rdi
+    1b22:	                  |                                 e8 d9 04 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+    1b27:	                  |                                 4c 89 ee             	mov    %r13,%rsi
+    1b2a:	                  |                                 48 89 c7             	mov    %rax,%rdi
+    1b2d:	                  |                                 e8 8e 05 00 00       	call   20c0 <nel::operator<<(nel::Log&, unsigned long)>
+    1b32:	                  |                                 be 2e 00 00 00       	mov    $0x2e,%esi
+    1b37:	                  |                                 48 89 c7             	mov    %rax,%rdi
+    1b3a:	                  |                                 e8 a1 04 00 00       	call   1fe0 <nel::operator<<(nel::Log&, char)>
+    1b3f:	                  |                                 49 83 fc 0a          	cmp    $0xa,%r12
+    1b43:	                  |                                 48 8d 35 ba 14 00 00 	lea    0x14ba(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+    1b4a:	                  |                                 48 89 c7             	mov    %rax,%rdi
+    1b4d:	                  |                                 48 8d 05 07 15 00 00 	lea    0x1507(%rip),%rax        # 305b <_IO_stdin_used+0x5b>
+    1b54:	                  |                                 48 0f 43 f0          	cmovae %rax,%rsi
+    1b58:	                  |                                 e8 a3 04 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+    1b5d:	                  |                                 4c 89 e6             	mov    %r12,%rsi
+    1b60:	                  |                                 48 89 c7             	mov    %rax,%rdi
+    1b63:	                  |                                 e8 58 05 00 00       	call   20c0 <nel::operator<<(nel::Log&, unsigned long)>
+    1b68:	                  |                                 48 8d 35 e4 14 00 00 	lea    0x14e4(%rip),%rsi        # 3053 <_IO_stdin_used+0x53>
+    1b6f:	                  |                                 48 89 c7             	mov    %rax,%rdi
+    1b72:	                  |                                 e8 89 04 00 00       	call   2000 <nel::operator<<(nel::Log&, char const*)>
+    1b77:	                  \-------------------------------- e9 a0 fa ff ff       	jmp    161c <main+0x4bc>
+    1b7c:	                                                    0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001b80 <_start>:
+    1b80:	31 ed                	xor    %ebp,%ebp
+    1b82:	49 89 d1             	mov    %rdx,%r9
+    1b85:	5e                   	pop    %rsi
+    1b86:	48 89 e2             	mov    %rsp,%rdx
+    1b89:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    1b8d:	50                   	push   %rax
+    1b8e:	54                   	push   %rsp
+    1b8f:	45 31 c0             	xor    %r8d,%r8d
+    1b92:	31 c9                	xor    %ecx,%ecx
+    1b94:	48 8d 3d c5 f5 ff ff 	lea    -0xa3b(%rip),%rdi        # 1160 <main>
+    1b9b:	ff 15 1f 34 00 00    	call   *0x341f(%rip)        # 4fc0 <__libc_start_main@GLIBC_2.34>
+    1ba1:	f4                   	hlt
+    1ba2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1ba9:	00 00 00 
+    1bac:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001bb0 <deregister_tm_clones>:
+    1bb0:	    48 8d 3d 99 34 00 00 	lea    0x3499(%rip),%rdi        # 5050 <__TMC_END__>
+    1bb7:	    48 8d 05 92 34 00 00 	lea    0x3492(%rip),%rax        # 5050 <__TMC_END__>
+    1bbe:	    48 39 f8             	cmp    %rdi,%rax
+    1bc1:	/-- 74 15                	je     1bd8 <deregister_tm_clones+0x28>
+    1bc3:	|   48 8b 05 fe 33 00 00 	mov    0x33fe(%rip),%rax        # 4fc8 <_ITM_deregisterTMCloneTable@Base>
+    1bca:	|   48 85 c0             	test   %rax,%rax
+    1bcd:	+-- 74 09                	je     1bd8 <deregister_tm_clones+0x28>
+    1bcf:	|   ff e0                	jmp    *%rax
+    1bd1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1bd8:	\-> c3                   	ret
+    1bd9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001be0 <register_tm_clones>:
+    1be0:	    48 8d 3d 69 34 00 00 	lea    0x3469(%rip),%rdi        # 5050 <__TMC_END__>
+    1be7:	    48 8d 35 62 34 00 00 	lea    0x3462(%rip),%rsi        # 5050 <__TMC_END__>
+    1bee:	    48 29 fe             	sub    %rdi,%rsi
+    1bf1:	    48 89 f0             	mov    %rsi,%rax
+    1bf4:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1bf8:	    48 c1 f8 03          	sar    $0x3,%rax
+    1bfc:	    48 01 c6             	add    %rax,%rsi
+    1bff:	    48 d1 fe             	sar    %rsi
+    1c02:	/-- 74 14                	je     1c18 <register_tm_clones+0x38>
+    1c04:	|   48 8b 05 cd 33 00 00 	mov    0x33cd(%rip),%rax        # 4fd8 <_ITM_registerTMCloneTable@Base>
+    1c0b:	|   48 85 c0             	test   %rax,%rax
+    1c0e:	+-- 74 08                	je     1c18 <register_tm_clones+0x38>
+    1c10:	|   ff e0                	jmp    *%rax
+    1c12:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1c18:	\-> c3                   	ret
+    1c19:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001c20 <__do_global_dtors_aux>:
+    1c20:	       f3 0f 1e fa          	endbr64
+    1c24:	       80 3d 3d 34 00 00 00 	cmpb   $0x0,0x343d(%rip)        # 5068 <completed.0>
+    1c2b:	/----- 75 2b                	jne    1c58 <__do_global_dtors_aux+0x38>
+    1c2d:	|      55                   	push   %rbp
+    1c2e:	|      48 83 3d aa 33 00 00 	cmpq   $0x0,0x33aa(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1c35:	|      00 
+    1c36:	|      48 89 e5             	mov    %rsp,%rbp
+    1c39:	|  /-- 74 0c                	je     1c47 <__do_global_dtors_aux+0x27>
+    1c3b:	|  |   48 8b 3d 06 34 00 00 	mov    0x3406(%rip),%rdi        # 5048 <__dso_handle>
+    1c42:	|  |   e8 69 f4 ff ff       	call   10b0 <__cxa_finalize@plt>
+    1c47:	|  \-> e8 64 ff ff ff       	call   1bb0 <deregister_tm_clones>
+    1c4c:	|      c6 05 15 34 00 00 01 	movb   $0x1,0x3415(%rip)        # 5068 <completed.0>
+    1c53:	|      5d                   	pop    %rbp
+    1c54:	|      c3                   	ret
+    1c55:	|      0f 1f 00             	nopl   (%rax)
+    1c58:	\----> c3                   	ret
+    1c59:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001c60 <frame_dummy>:
+    1c60:	f3 0f 1e fa          	endbr64
+    1c64:	e9 77 ff ff ff       	jmp    1be0 <register_tm_clones>
+    1c69:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001c70 <_close_r>:
+#include <nel/heaped/vector.hh>
+    1c70:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1c75:	c3                   	ret
+    1c76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1c7d:	00 00 00 
+
+0000000000001c80 <_fstat_r>:
+#include <nel/sort.hh>
+    1c80:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1c85:	c3                   	ret
+    1c86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1c8d:	00 00 00 
+
+0000000000001c90 <_kill_r>:
+#include "libnosys_stubs.cx"
+    1c90:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1c95:	c3                   	ret
+    1c96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1c9d:	00 00 00 
+
+0000000000001ca0 <_lseek_r>:
+
+    1ca0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ca5:	c3                   	ret
+    1ca6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1cad:	00 00 00 
+
+0000000000001cb0 <_read_r>:
+// table sizes, in items.
+    1cb0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1cb5:	c3                   	ret
+    1cb6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1cbd:	00 00 00 
+
+0000000000001cc0 <_write_r>:
+// above this, a linear scan would take all day.
+    1cc0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1cc5:	c3                   	ret
+    1cc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1ccd:	00 00 00 
+
+0000000000001cd0 <_getpid_r>:
+static unsigned int next_rand(unsigned int &s)
+    1cd0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1cd5:	c3                   	ret
+    1cd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1cdd:	00 00 00 
+
+0000000000001ce0 <_isatty_r>:
+{
+    1ce0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ce5:	c3                   	ret
+    1ce6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1ced:	00 00 00 
+
+0000000000001cf0 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)>:
+    if (i <= n) {
+    1cf0:	                                 /----------------------> 48 39 ca             	cmp    %rcx,%rdx
+    1cf3:	/--------------------------------|----------------------- 0f 82 9c 02 00 00    	jb     1f95 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0x2a5>
+Index eytzinger_fill(T dst[], T const src[], Length const n, Index const i, Index k)
+    1cf9:	|                                |                        41 57                	push   %r15
+    1cfb:	|                                |                        41 56                	push   %r14
+    1cfd:	|                                |                        41 55                	push   %r13
+    1cff:	|                                |                        49 89 cd             	mov    %rcx,%r13
+    1d02:	|                                |                        41 54                	push   %r12
+    1d04:	|                                |                        55                   	push   %rbp
+    1d05:	|                                |                        53                   	push   %rbx
+    1d06:	|                                |                        48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+        k = eytzinger_fill(dst, src, n, 2 * i, k);
+    1d0d:	|  /-----------------------------|----------------------> 4b 8d 5c 2d 00       	lea    0x0(%r13,%r13,1),%rbx
+    if (i <= n) {
+    1d12:	|  |                             |                        48 39 da             	cmp    %rbx,%rdx
+    1d15:	|  |  /--------------------------|----------------------- 0f 82 4b 02 00 00    	jb     1f66 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0x276>
+    1d1b:	|  |  |                          |                        48 89 5c 24 28       	mov    %rbx,0x28(%rsp)
+    1d20:	|  |  |                          |                        49 89 de             	mov    %rbx,%r14
+    1d23:	|  |  |                          |                        49 89 f4             	mov    %rsi,%r12
+    1d26:	|  |  |                          |                        4c 89 eb             	mov    %r13,%rbx
+        k = eytzinger_fill(dst, src, n, 2 * i, k);
+    1d29:	|  |  |  /-----------------------|----------------------> 4b 8d 04 36          	lea    (%r14,%r14,1),%rax
+    if (i <= n) {
+    1d2d:	|  |  |  |                       |                        48 39 c2             	cmp    %rax,%rdx
+    1d30:	|  |  |  |  /--------------------|----------------------- 0f 82 0b 02 00 00    	jb     1f41 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0x251>
+    1d36:	|  |  |  |  |                    |                        4c 89 74 24 30       	mov    %r14,0x30(%rsp)
+    1d3b:	|  |  |  |  |                    |                        49 89 df             	mov    %rbx,%r15
+    1d3e:	|  |  |  |  |                    |                        49 89 fe             	mov    %rdi,%r14
+    1d41:	|  |  |  |  |                    |                        49 89 c5             	mov    %rax,%r13
+    1d44:	|  |  |  |  |                    |                        48 89 c7             	mov    %rax,%rdi
+    1d47:	|  |  |  |  |                    |                        48 89 d3             	mov    %rdx,%rbx
+        k = eytzinger_fill(dst, src, n, 2 * i, k);
+    1d4a:	|  |  |  |  |  /-----------------|----------------------> 4b 8d 74 2d 00       	lea    0x0(%r13,%r13,1),%rsi
+    if (i <= n) {
+    1d4f:	|  |  |  |  |  |                 |                        48 39 f3             	cmp    %rsi,%rbx
+    1d52:	|  |  |  |  |  |  /--------------|----------------------- 0f 82 be 01 00 00    	jb     1f16 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0x226>
+    1d58:	|  |  |  |  |  |  |              |                        48 89 f5             	mov    %rsi,%rbp
+    1d5b:	|  |  |  |  |  |  |              |                        4c 89 e8             	mov    %r13,%rax
+        k = eytzinger_fill(dst, src, n, 2 * i, k);
+    1d5e:	|  |  |  |  |  |  |  /-----------|----------------------> 48 8d 54 2d 00       	lea    0x0(%rbp,%rbp,1),%rdx
+    if (i <= n) {
+    1d63:	|  |  |  |  |  |  |  |           |                        48 39 d3             	cmp    %rdx,%rbx
+    1d66:	|  |  |  |  |  |  |  |  /--------|----------------------- 0f 82 8d 01 00 00    	jb     1ef9 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0x209>
+    1d6c:	|  |  |  |  |  |  |  |  |        |                        49 89 c3             	mov    %rax,%r11
+    1d6f:	|  |  |  |  |  |  |  |  |        |                        4c 89 f8             	mov    %r15,%rax
+    1d72:	|  |  |  |  |  |  |  |  |        |                        48 89 7c 24 38       	mov    %rdi,0x38(%rsp)
+    1d77:	|  |  |  |  |  |  |  |  |        |                        49 89 ef             	mov    %rbp,%r15
+    1d7a:	|  |  |  |  |  |  |  |  |        |                        48 89 74 24 40       	mov    %rsi,0x40(%rsp)
+    1d7f:	|  |  |  |  |  |  |  |  |        |                        49 89 d5             	mov    %rdx,%r13
+    1d82:	|  |  |  |  |  |  |  |  |        |                        49 89 d2             	mov    %rdx,%r10
+    1d85:	|  |  |  |  |  |  |  |  |        |                        4c 89 f7             	mov    %r14,%rdi
+    1d88:	|  |  |  |  |  |  |  |  |        |                        4c 89 e6             	mov    %r12,%rsi
+    1d8b:	|  |  |  |  |  |  |  |  |        |                        48 89 c5             	mov    %rax,%rbp
+        k = eytzinger_fill(dst, src, n, 2 * i, k);
+    1d8e:	|  |  |  |  |  |  |  |  |  /-----|----------------------> 4f 8d 64 2d 00       	lea    0x0(%r13,%r13,1),%r12
+    if (i <= n) {
+    1d93:	|  |  |  |  |  |  |  |  |  |     |                        4c 39 e3             	cmp    %r12,%rbx
+    1d96:	|  |  |  |  |  |  |  |  |  |  /--|----------------------- 0f 82 23 01 00 00    	jb     1ebf <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0x1cf>
+    1d9c:	|  |  |  |  |  |  |  |  |  |  |  |                        4d 89 e1             	mov    %r12,%r9
+    1d9f:	|  |  |  |  |  |  |  |  |  |  |  |                        4d 89 de             	mov    %r11,%r14
+        k = eytzinger_fill(dst, src, n, 2 * i, k);
+    1da2:	|  |  |  |  |  |  |  |  |  |  |  |  /-------------------> 4b 8d 04 09          	lea    (%r9,%r9,1),%rax
+    if (i <= n) {
+    1da6:	|  |  |  |  |  |  |  |  |  |  |  |  |                     48 39 c3             	cmp    %rax,%rbx
+    1da9:	|  |  |  |  |  |  |  |  |  |  |  |  |  /----------------- 0f 82 f3 00 00 00    	jb     1ea2 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0x1b2>
+    1daf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  48 89 da             	mov    %rbx,%rdx
+    1db2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  49 89 c3             	mov    %rax,%r11
+    1db5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |                  4c 89 d3             	mov    %r10,%rbx
+        k = eytzinger_fill(dst, src, n, 2 * i, k);
+    1db8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  /-------------> 4b 8d 0c 1b          	lea    (%r11,%r11,1),%rcx
+    1dbc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 89 4c 24 20       	mov    %rcx,0x20(%rsp)
+    if (i <= n) {
+    1dc1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 39 ca             	cmp    %rcx,%rdx
+    1dc4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /----------- 0f 82 b3 00 00 00    	jb     1e7d <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0x18d>
+    1dca:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1dcf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            49 89 ca             	mov    %rcx,%r10
+    1dd2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            4c 89 4c 24 10       	mov    %r9,0x10(%rsp)
+    1dd7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 89 6c 24 18       	mov    %rbp,0x18(%rsp)
+    1ddc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 89 dd             	mov    %rbx,%rbp
+        k = eytzinger_fill(dst, src, n, 2 * i, k);
+    1ddf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-------> 4f 8d 0c 12          	lea    (%r10,%r10,1),%r9
+    if (i <= n) {
+    1de3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         4c 39 ca             	cmp    %r9,%rdx
+    1de6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /----- 72 69                	jb     1e51 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0x161>
+    1de8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      4c 89 cb             	mov    %r9,%rbx
+        k = eytzinger_fill(dst, src, n, 2 * i, k);
+    1deb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-> 48 8d 0c 1b          	lea    (%rbx,%rbx,1),%rcx
+    1def:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   4c 89 54 24 78       	mov    %r10,0x78(%rsp)
+    1df4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   4c 89 4c 24 70       	mov    %r9,0x70(%rsp)
+    1df9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   4c 89 5c 24 68       	mov    %r11,0x68(%rsp)
+    1dfe:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 89 4c 24 60       	mov    %rcx,0x60(%rsp)
+    1e03:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 89 54 24 58       	mov    %rdx,0x58(%rsp)
+    1e08:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 89 74 24 50       	mov    %rsi,0x50(%rsp)
+    1e0d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 89 7c 24 48       	mov    %rdi,0x48(%rsp)
+    1e12:	|  |  |  |  |  |  |  |  |  |  |  \--|--|--|--|--|--|--|-- e8 d9 fe ff ff       	call   1cf0 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)>
+        dst[i - 1] = src[k];
+    1e17:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   48 8b 74 24 50       	mov    0x50(%rsp),%rsi
+    1e1c:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+        k = eytzinger_fill(dst, src, n, 2 * i, k);
+    1e21:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   49 89 c0             	mov    %rax,%r8
+        k = eytzinger_fill(dst, src, n, 2 * i + 1, k);
+    1e24:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+    if (i <= n) {
+    1e29:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+        dst[i - 1] = src[k];
+    1e2e:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   8b 04 86             	mov    (%rsi,%rax,4),%eax
+        k += 1;
+    1e31:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   49 83 c0 01          	add    $0x1,%r8
+    if (i <= n) {
+    1e35:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   4c 8b 5c 24 68       	mov    0x68(%rsp),%r11
+    1e3a:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   4c 8b 4c 24 70       	mov    0x70(%rsp),%r9
+    1e3f:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   4c 8b 54 24 78       	mov    0x78(%rsp),%r10
+        dst[i - 1] = src[k];
+    1e44:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   89 44 9f fc          	mov    %eax,-0x4(%rdi,%rbx,4)
+        k = eytzinger_fill(dst, src, n, 2 * i + 1, k);
+    1e48:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   48 8d 59 01          	lea    0x1(%rcx),%rbx
+    if (i <= n) {
+    1e4c:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   48 39 da             	cmp    %rbx,%rdx
+    1e4f:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  \-- 73 9a                	jae    1deb <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0xfb>
+        dst[i - 1] = src[k];
+    1e51:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  \----> 42 8b 0c 86          	mov    (%rsi,%r8,4),%ecx
+        k += 1;
+    1e55:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |         49 83 c0 01          	add    $0x1,%r8
+        dst[i - 1] = src[k];
+    1e59:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |         42 89 4c 97 fc       	mov    %ecx,-0x4(%rdi,%r10,4)
+        k = eytzinger_fill(dst, src, n, 2 * i + 1, k);
+    1e5e:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |         4d 8d 51 01          	lea    0x1(%r9),%r10
+    if (i <= n) {
+    1e62:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |         4c 39 d2             	cmp    %r10,%rdx
+    1e65:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |  \-------- 0f 83 74 ff ff ff    	jae    1ddf <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0xef>
+    1e6b:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |            48 89 eb             	mov    %rbp,%rbx
+    1e6e:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |            48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    1e73:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |            4c 8b 4c 24 10       	mov    0x10(%rsp),%r9
+    1e78:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  |            48 8b 6c 24 18       	mov    0x18(%rsp),%rbp
+        dst[i - 1] = src[k];
+    1e7d:	|  |  |  |  |  |  |  |  |  |  |     |  |  |  \----------> 42 8b 0c 86          	mov    (%rsi,%r8,4),%ecx
+        k += 1;
+    1e81:	|  |  |  |  |  |  |  |  |  |  |     |  |  |               49 83 c0 01          	add    $0x1,%r8
+        dst[i - 1] = src[k];
+    1e85:	|  |  |  |  |  |  |  |  |  |  |     |  |  |               42 89 4c 9f fc       	mov    %ecx,-0x4(%rdi,%r11,4)
+        k = eytzinger_fill(dst, src, n, 2 * i + 1, k);
+    1e8a:	|  |  |  |  |  |  |  |  |  |  |     |  |  |               4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+    1e8f:	|  |  |  |  |  |  |  |  |  |  |     |  |  |               49 83 c3 01          	add    $0x1,%r11
+    if (i <= n) {
+    1e93:	|  |  |  |  |  |  |  |  |  |  |     |  |  |               4c 39 da             	cmp    %r11,%rdx
+    1e96:	|  |  |  |  |  |  |  |  |  |  |     |  |  \-------------- 0f 83 1c ff ff ff    	jae    1db8 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0xc8>
+    1e9c:	|  |  |  |  |  |  |  |  |  |  |     |  |                  49 89 da             	mov    %rbx,%r10
+    1e9f:	|  |  |  |  |  |  |  |  |  |  |     |  |                  48 89 d3             	mov    %rdx,%rbx
+        dst[i - 1] = src[k];
+    1ea2:	|  |  |  |  |  |  |  |  |  |  |     |  \----------------> 42 8b 14 86          	mov    (%rsi,%r8,4),%edx
+        k += 1;
+    1ea6:	|  |  |  |  |  |  |  |  |  |  |     |                     49 83 c0 01          	add    $0x1,%r8
+        dst[i - 1] = src[k];
+    1eaa:	|  |  |  |  |  |  |  |  |  |  |     |                     42 89 54 8f fc       	mov    %edx,-0x4(%rdi,%r9,4)
+        k = eytzinger_fill(dst, src, n, 2 * i + 1, k);
+    1eaf:	|  |  |  |  |  |  |  |  |  |  |     |                     4c 8d 48 01          	lea    0x1(%rax),%r9
+    if (i <= n) {
+    1eb3:	|  |  |  |  |  |  |  |  |  |  |     |                     4c 39 cb             	cmp    %r9,%rbx
+    1eb6:	|  |  |  |  |  |  |  |  |  |  |     \-------------------- 0f 83 e6 fe ff ff    	jae    1da2 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0xb2>
+    1ebc:	|  |  |  |  |  |  |  |  |  |  |                           4d 89 f3             	mov    %r14,%r11
+        dst[i - 1] = src[k];
+    1ebf:	|  |  |  |  |  |  |  |  |  |  \-------------------------> 42 8b 04 86          	mov    (%rsi,%r8,4),%eax
+        k += 1;
+    1ec3:	|  |  |  |  |  |  |  |  |  |                              49 83 c0 01          	add    $0x1,%r8
+        dst[i - 1] = src[k];
+    1ec7:	|  |  |  |  |  |  |  |  |  |                              42 89 44 af fc       	mov    %eax,-0x4(%rdi,%r13,4)
+        k = eytzinger_fill(dst, src, n, 2 * i + 1, k);
+    1ecc:	|  |  |  |  |  |  |  |  |  |                              4d 8d 6c 24 01       	lea    0x1(%r12),%r13
+    if (i <= n) {
+    1ed1:	|  |  |  |  |  |  |  |  |  |                              4c 39 eb             	cmp    %r13,%rbx
+    1ed4:	|  |  |  |  |  |  |  |  |  \----------------------------- 0f 83 b4 fe ff ff    	jae    1d8e <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0x9e>
+    1eda:	|  |  |  |  |  |  |  |  |                                 48 89 e9             	mov    %rbp,%rcx
+    1edd:	|  |  |  |  |  |  |  |  |                                 49 89 fe             	mov    %rdi,%r14
+    1ee0:	|  |  |  |  |  |  |  |  |                                 49 89 f4             	mov    %rsi,%r12
+    1ee3:	|  |  |  |  |  |  |  |  |                                 48 8b 7c 24 38       	mov    0x38(%rsp),%rdi
+    1ee8:	|  |  |  |  |  |  |  |  |                                 48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+    1eed:	|  |  |  |  |  |  |  |  |                                 4c 89 fd             	mov    %r15,%rbp
+    1ef0:	|  |  |  |  |  |  |  |  |                                 4c 89 d8             	mov    %r11,%rax
+    1ef3:	|  |  |  |  |  |  |  |  |                                 4c 89 d2             	mov    %r10,%rdx
+    1ef6:	|  |  |  |  |  |  |  |  |                                 49 89 cf             	mov    %rcx,%r15
+        dst[i - 1] = src[k];
+    1ef9:	|  |  |  |  |  |  |  |  \-------------------------------> 47 8b 14 84          	mov    (%r12,%r8,4),%r10d
+        k += 1;
+    1efd:	|  |  |  |  |  |  |  |                                    49 83 c0 01          	add    $0x1,%r8
+        dst[i - 1] = src[k];
+    1f01:	|  |  |  |  |  |  |  |                                    45 89 54 ae fc       	mov    %r10d,-0x4(%r14,%rbp,4)
+        k = eytzinger_fill(dst, src, n, 2 * i + 1, k);
+    1f06:	|  |  |  |  |  |  |  |                                    48 8d 6a 01          	lea    0x1(%rdx),%rbp
+    if (i <= n) {
+    1f0a:	|  |  |  |  |  |  |  |                                    48 39 eb             	cmp    %rbp,%rbx
+    1f0d:	|  |  |  |  |  |  |  \----------------------------------- 0f 83 4b fe ff ff    	jae    1d5e <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0x6e>
+    1f13:	|  |  |  |  |  |  |                                       49 89 c5             	mov    %rax,%r13
+        dst[i - 1] = src[k];
+    1f16:	|  |  |  |  |  |  \-------------------------------------> 43 8b 04 84          	mov    (%r12,%r8,4),%eax
+        k += 1;
+    1f1a:	|  |  |  |  |  |                                          49 83 c0 01          	add    $0x1,%r8
+        dst[i - 1] = src[k];
+    1f1e:	|  |  |  |  |  |                                          43 89 44 ae fc       	mov    %eax,-0x4(%r14,%r13,4)
+        k = eytzinger_fill(dst, src, n, 2 * i + 1, k);
+    1f23:	|  |  |  |  |  |                                          4c 8d 6e 01          	lea    0x1(%rsi),%r13
+    if (i <= n) {
+    1f27:	|  |  |  |  |  |                                          4c 39 eb             	cmp    %r13,%rbx
+    1f2a:	|  |  |  |  |  \----------------------------------------- 0f 83 1a fe ff ff    	jae    1d4a <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0x5a>
+    1f30:	|  |  |  |  |                                             48 89 f8             	mov    %rdi,%rax
+    1f33:	|  |  |  |  |                                             4c 89 f7             	mov    %r14,%rdi
+    1f36:	|  |  |  |  |                                             4c 8b 74 24 30       	mov    0x30(%rsp),%r14
+    1f3b:	|  |  |  |  |                                             48 89 da             	mov    %rbx,%rdx
+    1f3e:	|  |  |  |  |                                             4c 89 fb             	mov    %r15,%rbx
+        dst[i - 1] = src[k];
+    1f41:	|  |  |  |  \-------------------------------------------> 43 8b 0c 84          	mov    (%r12,%r8,4),%ecx
+        k += 1;
+    1f45:	|  |  |  |                                                49 83 c0 01          	add    $0x1,%r8
+        dst[i - 1] = src[k];
+    1f49:	|  |  |  |                                                42 89 4c b7 fc       	mov    %ecx,-0x4(%rdi,%r14,4)
+        k = eytzinger_fill(dst, src, n, 2 * i + 1, k);
+    1f4e:	|  |  |  |                                                4c 8d 70 01          	lea    0x1(%rax),%r14
+    if (i <= n) {
+    1f52:	|  |  |  |                                                4c 39 f2             	cmp    %r14,%rdx
+    1f55:	|  |  |  \----------------------------------------------- 0f 83 ce fd ff ff    	jae    1d29 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0x39>
+    1f5b:	|  |  |                                                   49 89 dd             	mov    %rbx,%r13
+    1f5e:	|  |  |                                                   48 8b 5c 24 28       	mov    0x28(%rsp),%rbx
+    1f63:	|  |  |                                                   4c 89 e6             	mov    %r12,%rsi
+        dst[i - 1] = src[k];
+    1f66:	|  |  \-------------------------------------------------> 42 8b 04 86          	mov    (%rsi,%r8,4),%eax
+        k += 1;
+    1f6a:	|  |                                                      49 83 c0 01          	add    $0x1,%r8
+        dst[i - 1] = src[k];
+    1f6e:	|  |                                                      42 89 44 af fc       	mov    %eax,-0x4(%rdi,%r13,4)
+        k = eytzinger_fill(dst, src, n, 2 * i + 1, k);
+    1f73:	|  |                                                      4c 8d 6b 01          	lea    0x1(%rbx),%r13
+    if (i <= n) {
+    1f77:	|  |                                                      4c 39 ea             	cmp    %r13,%rdx
+    1f7a:	|  \----------------------------------------------------- 0f 83 8d fd ff ff    	jae    1d0d <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0x1d>
+}
+    1f80:	|                                                         48 81 c4 88 00 00 00 	add    $0x88,%rsp
+    1f87:	|                                                         4c 89 c0             	mov    %r8,%rax
+    1f8a:	|                                                         5b                   	pop    %rbx
+    1f8b:	|                                                         5d                   	pop    %rbp
+    1f8c:	|                                                         41 5c                	pop    %r12
+    1f8e:	|                                                         41 5d                	pop    %r13
+    1f90:	|                                                         41 5e                	pop    %r14
+    1f92:	|                                                         41 5f                	pop    %r15
+    1f94:	|                                                         c3                   	ret
+    1f95:	\-------------------------------------------------------> 4c 89 c0             	mov    %r8,%rax
+    1f98:	                                                          c3                   	ret
+    1f99:	                                                          0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001fa0 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>:
+            if (new_cap > max_capacity) { return nullptr; }
+    1fa0:	       48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    1fa7:	       ff ff 1f 
+    1faa:	       48 39 f0             	cmp    %rsi,%rax
+    1fad:	/----- 72 29                	jb     1fd8 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x38>
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    1faf:	|      53                   	push   %rbx
+    1fb0:	|      48 89 f3             	mov    %rsi,%rbx
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1fb3:	|      48 8d 34 b5 14 00 00 	lea    0x14(,%rsi,4),%rsi
+    1fba:	|      00 
+                                    : std::realloc(p, new_size);
+    1fbb:	|      e8 e0 f0 ff ff       	call   10a0 <realloc@plt>
+            if (new_p == nullptr) {
+    1fc0:	|      48 85 c0             	test   %rax,%rax
+    1fc3:	|  /-- 74 0b                	je     1fd0 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x30>
+            new_n->alloc_ = new_cap;
+    1fc5:	|  |   48 89 18             	mov    %rbx,(%rax)
+        }
+    1fc8:	|  |   5b                   	pop    %rbx
+    1fc9:	|  |   c3                   	ret
+    1fca:	|  |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+            if (new_cap > max_capacity) { return nullptr; }
+    1fd0:	|  \-> 31 c0                	xor    %eax,%eax
+        }
+    1fd2:	|      5b                   	pop    %rbx
+    1fd3:	|      c3                   	ret
+    1fd4:	|      0f 1f 40 00          	nopl   0x0(%rax)
+            if (new_cap > max_capacity) { return nullptr; }
+    1fd8:	\----> 31 c0                	xor    %eax,%eax
+        }
+    1fda:	       c3                   	ret
+    1fdb:	       0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000001fe0 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1fe0:	53                   	push   %rbx
+    1fe1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    1fe4:	40 0f be fe          	movsbl %sil,%edi
+    1fe8:	48 8b 35 71 30 00 00 	mov    0x3071(%rip),%rsi        # 5060 <stderr@GLIBC_2.2.5>
+    1fef:	e8 7c f0 ff ff       	call   1070 <fputc@plt>
+    return outs;
+}
+    1ff4:	48 89 d8             	mov    %rbx,%rax
+    1ff7:	5b                   	pop    %rbx
+    1ff8:	c3                   	ret
+    1ff9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002000 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    2000:	53                   	push   %rbx
+    2001:	48 89 fb             	mov    %rdi,%rbx
+    2004:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    2007:	48 8b 35 52 30 00 00 	mov    0x3052(%rip),%rsi        # 5060 <stderr@GLIBC_2.2.5>
+    200e:	e8 4d f0 ff ff       	call   1060 <fputs@plt>
+    return outs;
+}
+    2013:	48 89 d8             	mov    %rbx,%rax
+    2016:	5b                   	pop    %rbx
+    2017:	c3                   	ret
+    2018:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    201f:	00 
+
+0000000000002020 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    2020:	53                   	push   %rbx
+    2021:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    2024:	48 8b 3d 35 30 00 00 	mov    0x3035(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+    202b:	40 0f b6 d6          	movzbl %sil,%edx
+    202f:	31 c0                	xor    %eax,%eax
+    2031:	48 8d 35 e0 10 00 00 	lea    0x10e0(%rip),%rsi        # 3118 <sizes+0x78>
+    2038:	e8 43 f0 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    203d:	48 89 d8             	mov    %rbx,%rax
+    2040:	5b                   	pop    %rbx
+    2041:	c3                   	ret
+    2042:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2049:	00 00 00 00 
+    204d:	0f 1f 00             	nopl   (%rax)
+
+0000000000002050 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    2050:	53                   	push   %rbx
+    2051:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    2054:	48 8b 3d 05 30 00 00 	mov    0x3005(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+    205b:	0f b7 d6             	movzwl %si,%edx
+    205e:	31 c0                	xor    %eax,%eax
+    2060:	48 8d 35 b1 10 00 00 	lea    0x10b1(%rip),%rsi        # 3118 <sizes+0x78>
+    2067:	e8 14 f0 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    206c:	48 89 d8             	mov    %rbx,%rax
+    206f:	5b                   	pop    %rbx
+    2070:	c3                   	ret
+    2071:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2078:	00 00 00 00 
+    207c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002080 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    2080:	53                   	push   %rbx
+    2081:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    2084:	48 8b 3d d5 2f 00 00 	mov    0x2fd5(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+{
+    208b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    208d:	31 c0                	xor    %eax,%eax
+    208f:	48 8d 35 82 10 00 00 	lea    0x1082(%rip),%rsi        # 3118 <sizes+0x78>
+    2096:	e8 e5 ef ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    209b:	48 89 d8             	mov    %rbx,%rax
+    209e:	5b                   	pop    %rbx
+    209f:	c3                   	ret
+
+00000000000020a0 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    20a0:	53                   	push   %rbx
+    20a1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    20a4:	48 8b 3d b5 2f 00 00 	mov    0x2fb5(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+{
+    20ab:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    20ad:	31 c0                	xor    %eax,%eax
+    20af:	48 8d 35 62 10 00 00 	lea    0x1062(%rip),%rsi        # 3118 <sizes+0x78>
+    20b6:	e8 c5 ef ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    20bb:	48 89 d8             	mov    %rbx,%rax
+    20be:	5b                   	pop    %rbx
+    20bf:	c3                   	ret
+
+00000000000020c0 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    20c0:	53                   	push   %rbx
+    20c1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    20c4:	48 8b 3d 95 2f 00 00 	mov    0x2f95(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+{
+    20cb:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    20ce:	31 c0                	xor    %eax,%eax
+    20d0:	48 8d 35 44 10 00 00 	lea    0x1044(%rip),%rsi        # 311b <sizes+0x7b>
+    20d7:	e8 a4 ef ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    20dc:	48 89 d8             	mov    %rbx,%rax
+    20df:	5b                   	pop    %rbx
+    20e0:	c3                   	ret
+
+Disassembly of section .fini:
+
+00000000000020e4 <_fini>:
+    20e4:	48 83 ec 08          	sub    $0x8,%rsp
+    20e8:	48 83 c4 08          	add    $0x8,%rsp
+    20ec:	c3                   	ret
@@ -0,0 +1,4430 @@
+
+target/fast/examples/bench_sort:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 ad 4f 00 00 	mov    0x4fad(%rip),%rax        # 5fb8 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 4f 00 00    	push   0x4fca(%rip)        # 5ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 4f 00 00    	jmp    *0x4fcc(%rip)        # 5ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 4f 00 00    	jmp    *0x4fca(%rip)        # 6000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 4f 00 00    	jmp    *0x4fc2(%rip)        # 6008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <qsort@plt>:
+    1050:	ff 25 ba 4f 00 00    	jmp    *0x4fba(%rip)        # 6010 <qsort@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <clock_gettime@plt>:
+    1060:	ff 25 b2 4f 00 00    	jmp    *0x4fb2(%rip)        # 6018 <clock_gettime@GLIBC_2.17>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputs@plt>:
+    1070:	ff 25 aa 4f 00 00    	jmp    *0x4faa(%rip)        # 6020 <fputs@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fputc@plt>:
+    1080:	ff 25 a2 4f 00 00    	jmp    *0x4fa2(%rip)        # 6028 <fputc@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 4f 00 00    	jmp    *0x4f9a(%rip)        # 6030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <malloc@plt>:
+    10a0:	ff 25 92 4f 00 00    	jmp    *0x4f92(%rip)        # 6038 <malloc@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <realloc@plt>:
+    10b0:	ff 25 8a 4f 00 00    	jmp    *0x4f8a(%rip)        # 6040 <realloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010c0 <__cxa_finalize@plt>:
+    10c0:	ff 25 02 4f 00 00    	jmp    *0x4f02(%rip)        # 5fc8 <__cxa_finalize@GLIBC_2.2.5>
+    10c6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010d0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10d0:	50                   	push   %rax
+    std::abort();
+    10d1:	e8 6a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010d6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10d6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10d7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10da:	4c 8d 0d af 30 00 00 	lea    0x30af(%rip),%r9        # 4190 <_IO_stdin_used+0x190>
+    10e1:	31 c0                	xor    %eax,%eax
+    10e3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10e7:	4c 8b 07             	mov    (%rdi),%r8
+    10ea:	48 8d 35 a5 30 00 00 	lea    0x30a5(%rip),%rsi        # 4196 <_IO_stdin_used+0x196>
+    10f1:	48 8b 3d 68 4f 00 00 	mov    0x4f68(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+    10f8:	e8 93 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    10fd:	e8 3e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001102 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1102:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1106:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1109:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    110d:	31 c0                	xor    %eax,%eax
+    110f:	57                   	push   %rdi
+    1110:	48 8b 3d 49 4f 00 00 	mov    0x4f49(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+    1117:	4c 8d 0d 72 30 00 00 	lea    0x3072(%rip),%r9        # 4190 <_IO_stdin_used+0x190>
+    111e:	4c 8b 06             	mov    (%rsi),%r8
+    1121:	48 8d 35 7f 30 00 00 	lea    0x307f(%rip),%rsi        # 41a7 <_IO_stdin_used+0x1a7>
+    1128:	e8 63 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    112d:	e8 0e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001132 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1132:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1136:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1139:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    113d:	31 c0                	xor    %eax,%eax
+    113f:	57                   	push   %rdi
+    1140:	48 8b 3d 19 4f 00 00 	mov    0x4f19(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+    1147:	4c 8d 0d 6e 30 00 00 	lea    0x306e(%rip),%r9        # 41bc <_IO_stdin_used+0x1bc>
+    114e:	4c 8b 06             	mov    (%rsi),%r8
+    1151:	48 8d 35 4f 30 00 00 	lea    0x304f(%rip),%rsi        # 41a7 <_IO_stdin_used+0x1a7>
+    1158:	e8 33 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    115d:	e8 de fe ff ff       	call   1040 <abort@plt>
+    1162:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1169:	00 00 00 
+    116c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001170 <main>:
+    bench::report_per_item(name, t, s.len());
+    if (!sorted) { nel::log << "  not sorted!\n"; }
+}
+
+int main()
+{
+    1170:	                                                                                                 41 57                	push   %r15
+    1172:	                                                                                                 48 8d 05 9f 2e 00 00 	lea    0x2e9f(%rip),%rax        # 4018 <_IO_stdin_used+0x18>
+        //     // p % alignment == 0?
+        //     return ((Length)p & (align-1)) == 0;
+        // }
+        static Node *malloc(Count capacity)
+        {
+            Node *new_n = realloc(nullptr, capacity);
+    1179:	                                                                                                 31 ff                	xor    %edi,%edi
+    117b:	                                                                                                 be 40 42 0f 00       	mov    $0xf4240,%esi
+    1180:	                                                                                                 41 56                	push   %r14
+    1182:	                                                                                                 48 8d 15 84 2e 00 00 	lea    0x2e84(%rip),%rdx        # 400d <_IO_stdin_used+0xd>
+    1189:	                                                                                                 66 48 0f 6e d8       	movq   %rax,%xmm3
+    118e:	                                                                                                 41 55                	push   %r13
+    1190:	                                                                                                 66 48 0f 6e ca       	movq   %rdx,%xmm1
+    1195:	                                                                                                 41 54                	push   %r12
+    1197:	                                                                                                 66 0f 6c cb          	punpcklqdq %xmm3,%xmm1
+    119b:	                                                                                                 55                   	push   %rbp
+    119c:	                                                                                                 53                   	push   %rbx
+    119d:	                                                                                                 48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+    11a4:	                                                                                                 0f 29 4c 24 10       	movaps %xmm1,0x10(%rsp)
+    11a9:	                                                                                                 e8 32 22 00 00       	call   33e0 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    11ae:	                                                                                                 48 85 c0             	test   %rax,%rax
+    11b1:	   /-------------------------------------------------------------------------------------------- 0f 84 c3 0d 00 00    	je     1f7a <main+0xe0a>
+            Node *new_n = realloc(nullptr, capacity);
+    11b7:	   |                                                                                             be 20 a1 07 00       	mov    $0x7a120,%esi
+    11bc:	   |                                                                                             31 ff                	xor    %edi,%edi
+    11be:	   |                                                                                             48 89 c3             	mov    %rax,%rbx
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    11c1:	   |                                                                                             41 be 40 42 0f 00    	mov    $0xf4240,%r14d
+    11c7:	   |                                                                                             48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    11ce:	   |                                                                                             00 
+            Node *new_n = realloc(nullptr, capacity);
+    11cf:	   |                                                                                             e8 0c 22 00 00       	call   33e0 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    11d4:	   |                                                                                             49 89 c0             	mov    %rax,%r8
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    11d7:	   |                                                                                             48 85 c0             	test   %rax,%rax
+    11da:	/--|-------------------------------------------------------------------------------------------- 74 0c                	je     11e8 <main+0x78>
+    11dc:	|  |                                                                                             31 c9                	xor    %ecx,%ecx
+    11de:	|  |                                                                                             48 89 48 08          	mov    %rcx,0x8(%rax)
+        /**
+         * Returns the number of items currently in use.
+         *
+         * @returns the current in use count.
+         */
+        constexpr Length len(void) const
+    11e2:	|  |                                                                                             66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+         * @returns on fail, nullptr, old_n is then untouched and still valid.
+         */
+        static Node *realloc(Node *const old_n, Count const new_cap)
+        {
+            // Too big to address, size_of() would overflow.
+            if (new_cap > max_capacity) { return nullptr; }
+    11e8:	>--|-------------------------------------------------------------------------------------------> 49 bd f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%r13
+    11ef:	|  |                                                                                             ff ff 1f 
+    11f2:	|  |                                                                                             48 89 df             	mov    %rbx,%rdi
+    11f5:	|  |                                                                                             4c 89 c5             	mov    %r8,%rbp
+    11f8:	|  |                                                                                             0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    11ff:	|  |                                                                                             00 
+            return alloc_;
+        }
+
+        constexpr Length len(void) const
+        {
+            return len_;
+    1200:	|  |                                                                                      /----> 48 8b 47 08          	mov    0x8(%rdi),%rax
+            return alloc_;
+    1204:	|  |                                                                                      |      48 8b 17             	mov    (%rdi),%rdx
+
+    private:
+        // Make room for n more values, only ever grows.
+        bool try_reserve_for(Count const n)
+        {
+            if (len() + n <= capacity()) { return true; }
+    1207:	|  |                                                                                      |      48 8d 48 01          	lea    0x1(%rax),%rcx
+    120b:	|  |                                                                                      |      48 39 ca             	cmp    %rcx,%rdx
+    120e:	|  |                                      /-----------------------------------------------|----- 0f 82 64 09 00 00    	jb     1b78 <main+0xa08>
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+        {
+            if (len() >= capacity()) {
+    1214:	|  |                       /--------------|-----------------------------------------------|----> 48 39 d0             	cmp    %rdx,%rax
+    1217:	|  |                       |              |                                               |  /-- 72 27                	jb     1240 <main+0xd0>
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1219:	|  |  /--------------------|--------------|-----------------------------------------------|--|-> 66 0f 6f 74 24 10    	movdqa 0x10(%rsp),%xmm6
+         *
+         * `this` is consumed by the operation.
+         */
+        constexpr void unwrap(Context const &ctx = Context())
+        {
+            return consumev([](void) {}, [](E &&) { nel::panic("not an ok"); }, ctx);
+    121f:	|  |  |                    |              |                                               |  |   48 8d 74 24 60       	lea    0x60(%rsp),%rsi
+    1224:	|  |  |                    |              |                                               |  |   48 8d 3d ff 2d 00 00 	lea    0x2dff(%rip),%rdi        # 402a <_IO_stdin_used+0x2a>
+            , file_name_(file_name)
+            , line_num_(line_num)
+    122b:	|  |  |                    |              |                                               |  |   c7 44 24 70 1f 04 00 	movl   $0x41f,0x70(%rsp)
+    1232:	|  |  |                    |              |                                               |  |   00 
+            : fn_name_(fn_name)
+    1233:	|  |  |                    |              |                                               |  |   0f 29 74 24 60       	movaps %xmm6,0x60(%rsp)
+    1238:	|  |  |                    |              |                                               |  |   e8 c5 fe ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+    123d:	|  |  |                    |              |                                               |  |   0f 1f 00             	nopl   (%rax)
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    1240:	|  |  |                    |              |                                               |  \-> c7 44 87 10 00 00 00 	movl   $0x0,0x10(%rdi,%rax,4)
+    1247:	|  |  |                    |              |                                               |      00 
+            len_ += 1;
+    1248:	|  |  |                    |              |                                               |      48 83 c0 01          	add    $0x1,%rax
+    124c:	|  |  |                    |              |                                               |      48 89 47 08          	mov    %rax,0x8(%rdi)
+    auto v = nel::heaped::Vector<int>::with_capacity(n_values);
+    auto b = nel::heaped::Vector<int>::with_capacity(n_values / 2);
+    for (nel::Index i = 0; i < n_values; ++i) {
+    1250:	|  |  |                    |              |                                               |      49 83 ee 01          	sub    $0x1,%r14
+    1254:	|  |  |                    |              |                                               \----- 75 aa                	jne    1200 <main+0x90>
+    1256:	|  |  |                    |              |                                                      48 89 fb             	mov    %rdi,%rbx
+    1259:	|  |  |                    |              |                                                      49 89 e8             	mov    %rbp,%r8
+            return (item_ == nullptr) ? 0 : item_->len();
+    125c:	|  |  |                    |              |                                                      48 85 ed             	test   %rbp,%rbp
+    125f:	|  |  |     /--------------|--------------|----------------------------------------------------- 0f 85 70 0b 00 00    	jne    1dd5 <main+0xc65>
+            if (align == 0 || (align & (align - 1)) != 0) {
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+            }
+            void *const new_p = is_over_aligned(align)
+                                    ? realloc_aligned(p, align, old_size, new_size)
+                                    : std::realloc(p, new_size);
+    1265:	|  |  |     |              |              |                                                      bf 24 00 00 00       	mov    $0x24,%edi
+    126a:	|  |  |     |              |              |                                                      e8 31 fe ff ff       	call   10a0 <malloc@plt>
+    126f:	|  |  |     |              |              |                                                      49 89 c0             	mov    %rax,%r8
+            if (new_p == nullptr) {
+    1272:	|  |  |     |              |              |                                                      48 85 c0             	test   %rax,%rax
+    1275:	|  |  |     |              |  /-----------|----------------------------------------------------- 74 4a                	je     12c1 <main+0x151>
+            new_n->alloc_ = new_cap;
+    1277:	|  |  |     |              |  |           |                                                      66 0f 6f 05 01 2f 00 	movdqa 0x2f01(%rip),%xmm0        # 4180 <_IO_stdin_used+0x180>
+    127e:	|  |  |     |              |  |           |                                                      00 
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    127f:	|  |  |     |              |  |           |                                                      c7 40 10 00 00 00 00 	movl   $0x0,0x10(%rax)
+        v.push(0).unwrap();
+    }
+    for (nel::Index i = 0; i < n_values / 2; ++i) {
+    1286:	|  |  |     |              |  |           |                                                      41 bf 1f a1 07 00    	mov    $0x7a11f,%r15d
+            new_n->alloc_ = new_cap;
+    128c:	|  |  |     |              |  |           |                                                      0f 11 00             	movups %xmm0,(%rax)
+            len_ += 1;
+    128f:	|  |  |     |              |  |           |                                                      48 c7 40 08 01 00 00 	movq   $0x1,0x8(%rax)
+    1296:	|  |  |     |              |  |           |                                                      00 
+            if (new_cap > max_capacity) { return nullptr; }
+    1297:	|  |  |     |  /-----------|--|-----------|----------------------------------------------------> 48 bd f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rbp
+    129e:	|  |  |     |  |           |  |           |                                                      ff ff 1f 
+    12a1:	|  |  |     |  |           |  |           |                                                      4c 89 c7             	mov    %r8,%rdi
+    12a4:	|  |  |     |  |           |  |           |                                                      0f 1f 40 00          	nopl   0x0(%rax)
+            return len_;
+    12a8:	|  |  |     |  |           |  |           |                                               /----> 48 8b 47 08          	mov    0x8(%rdi),%rax
+            return alloc_;
+    12ac:	|  |  |     |  |           |  |           |                                               |      48 8b 17             	mov    (%rdi),%rdx
+            if (len() + n <= capacity()) { return true; }
+    12af:	|  |  |     |  |           |  |           |                                               |      48 8d 48 01          	lea    0x1(%rax),%rcx
+    12b3:	|  |  |     |  |           |  |           |                                               |      48 39 ca             	cmp    %rcx,%rdx
+    12b6:	|  |  |     |  |           |  |           |                             /-----------------|----- 0f 82 2c 09 00 00    	jb     1be8 <main+0xa78>
+            if (len() >= capacity()) {
+    12bc:	|  |  |     |  |           |  |  /--------|-----------------------------|-----------------|----> 48 39 d0             	cmp    %rdx,%rax
+    12bf:	|  |  |     |  |           |  |  |        |                             |                 |  /-- 72 27                	jb     12e8 <main+0x178>
+    12c1:	|  |  |     |  |           |  >--|--------|-----------------------------|-----------------|--|-> 66 0f 6f 7c 24 10    	movdqa 0x10(%rsp),%xmm7
+    12c7:	|  |  |     |  |           |  |  |        |                             |                 |  |   48 8d 74 24 60       	lea    0x60(%rsp),%rsi
+    12cc:	|  |  |     |  |           |  |  |        |                             |                 |  |   48 8d 3d 57 2d 00 00 	lea    0x2d57(%rip),%rdi        # 402a <_IO_stdin_used+0x2a>
+            , line_num_(line_num)
+    12d3:	|  |  |     |  |           |  |  |        |                             |                 |  |   c7 44 24 70 1f 04 00 	movl   $0x41f,0x70(%rsp)
+    12da:	|  |  |     |  |           |  |  |        |                             |                 |  |   00 
+            : fn_name_(fn_name)
+    12db:	|  |  |     |  |           |  |  |        |                             |                 |  |   0f 29 7c 24 60       	movaps %xmm7,0x60(%rsp)
+    12e0:	|  |  |     |  |           |  |  |        |                             |                 |  |   e8 1d fe ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+    12e5:	|  |  |     |  |           |  |  |        |                             |                 |  |   0f 1f 00             	nopl   (%rax)
+            len_ += 1;
+    12e8:	|  |  |     |  |           |  |  |        |                             |                 |  \-> 48 8d 50 01          	lea    0x1(%rax),%rdx
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    12ec:	|  |  |     |  |           |  |  |        |                             |                 |      c7 44 87 10 00 00 00 	movl   $0x0,0x10(%rdi,%rax,4)
+    12f3:	|  |  |     |  |           |  |  |        |                             |                 |      00 
+            len_ += 1;
+    12f4:	|  |  |     |  |           |  |  |        |                             |                 |      48 89 57 08          	mov    %rdx,0x8(%rdi)
+    12f8:	|  |  |     |  |           |  |  |        |                             |                 |      49 83 ef 01          	sub    $0x1,%r15
+    12fc:	|  |  |     |  |           |  |  |        |                             |                 \----- 75 aa                	jne    12a8 <main+0x138>
+    12fe:	|  |  |     |  |           |  |  |        |                             |                        49 89 f8             	mov    %rdi,%r8
+            return len_;
+    1301:	|  |  |     |  |           |  |  |        |                             |                        4c 8b 6b 08          	mov    0x8(%rbx),%r13
+            return Slice(values_, len());
+    1305:	|  |  |     |  |           |  |  |        |                             |                        48 8d 6b 10          	lea    0x10(%rbx),%rbp
+    1309:	|  |  |     |  |           |  |  |        |                             |                        48 89 d7             	mov    %rdx,%rdi
+    130c:	|  |  |     |  |           |  |  |        |                             |                        49 8d 40 10          	lea    0x10(%r8),%rax
+    1310:	|  |  |     |  |           |  |  |        |                             |                        31 d2                	xor    %edx,%edx
+    1312:	|  |  |     |  |           |  |  |        |                             |                        48 89 6c 24 50       	mov    %rbp,0x50(%rsp)
+    if (!sorted) { nel::log << "  not sorted!\n"; }
+    1317:	|  |  |     |  |           |  |  |        |                             |                        49 89 ec             	mov    %rbp,%r12
+    131a:	|  |  |     |  |           |  |  |        |                             |                        48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    131f:	|  |  |     |  |           |  |  |        |                             |                        48 8d 44 24 60       	lea    0x60(%rsp),%rax
+        // so Slice( int ptr, len) gets a Slice<int>(int ptr, len)
+        // but a Slice::from(int ptr, len) does not work..
+        // constexpr Slice(Type p[], Length len)
+        constexpr Slice(Type *const p, Length len)
+            : content_(p)
+            , len_(len)
+    1324:	|  |  |     |  |           |  |  |        |                             |                        4c 89 6c 24 58       	mov    %r13,0x58(%rsp)
+    1329:	|  |  |     |  |           |  |  |        |                             |                        48 89 14 24          	mov    %rdx,(%rsp)
+    132d:	|  |  |     |  |           |  |  |        |                             |                        48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    1332:	|  |  |     |  |           |  |  |        |                             |                        48 89 7c 24 30       	mov    %rdi,0x30(%rsp)
+    1337:	|  |  |     |  |           |  |  |        |                             |                        4c 89 44 24 40       	mov    %r8,0x40(%rsp)
+    133c:	|  |  |     |  |           |  |  |        |                             |                        4c 89 7c 24 48       	mov    %r15,0x48(%rsp)
+    1341:	|  |  |     |  |           |  |  |        |                             |                        48 89 5c 24 38       	mov    %rbx,0x38(%rsp)
+    1346:	|  |  |     |  |           |  |  |        |                             |                        48 89 c3             	mov    %rax,%rbx
+    1349:	|  |  |     |  |           |  |  |        |                             |                        0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1350:	|  |  |     |  |           |  |  |  /-----|-----------------------------|----------------------> 48 8b 04 24          	mov    (%rsp),%rax
+    }
+    nel::Slice<int> const s = v.slice();
+    nel::Slice<int> const scratch = b.slice();
+
+    for (int pat = 0; pat < 5; ++pat) {
+        nel::log << pat_names[pat] << ", " << n_values << " ints\n";
+    1354:	|  |  |     |  |           |  |  |  |     |                             |                        48 8d 35 45 4a 00 00 	lea    0x4a45(%rip),%rsi        # 5da0 <pat_names>
+    135b:	|  |  |     |  |           |  |  |  |     |                             |                        48 8d 3d 07 4d 00 00 	lea    0x4d07(%rip),%rdi        # 6069 <nel::log>
+    1362:	|  |  |     |  |           |  |  |  |     |                             |                        48 8b 34 c6          	mov    (%rsi,%rax,8),%rsi
+    1366:	|  |  |     |  |           |  |  |  |     |                             |                        41 89 c6             	mov    %eax,%r14d
+    1369:	|  |  |     |  |           |  |  |  |     |                             |                        e8 e2 27 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    136e:	|  |  |     |  |           |  |  |  |     |                             |                        48 8d 35 bf 2c 00 00 	lea    0x2cbf(%rip),%rsi        # 4034 <_IO_stdin_used+0x34>
+    1375:	|  |  |     |  |           |  |  |  |     |                             |                        48 89 c7             	mov    %rax,%rdi
+    1378:	|  |  |     |  |           |  |  |  |     |                             |                        e8 d3 27 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    137d:	|  |  |     |  |           |  |  |  |     |                             |                        be 40 42 0f 00       	mov    $0xf4240,%esi
+    1382:	|  |  |     |  |           |  |  |  |     |                             |                        48 89 c7             	mov    %rax,%rdi
+    1385:	|  |  |     |  |           |  |  |  |     |                             |                        e8 86 28 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    138a:	|  |  |     |  |           |  |  |  |     |                             |                        48 8d 35 a6 2c 00 00 	lea    0x2ca6(%rip),%rsi        # 4037 <_IO_stdin_used+0x37>
+    1391:	|  |  |     |  |           |  |  |  |     |                             |                        48 89 c7             	mov    %rax,%rdi
+    1394:	|  |  |     |  |           |  |  |  |     |                             |                        e8 b7 27 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    fill(s, pat);
+    1399:	|  |  |     |  |           |  |  |  |     |                             |                        44 89 f2             	mov    %r14d,%edx
+    139c:	|  |  |     |  |           |  |  |  |     |                             |                        4c 89 ee             	mov    %r13,%rsi
+    139f:	|  |  |     |  |           |  |  |  |     |                             |                        4c 89 e7             	mov    %r12,%rdi
+    13a2:	|  |  |     |  |           |  |  |  |     |                             |                        e8 19 11 00 00       	call   24c0 <fill(nel::Slice<int> const&, int) [clone .isra.0]>
+{
+
+inline long unsigned int now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    13a7:	|  |  |     |  |           |  |  |  |     |                             |                        48 89 de             	mov    %rbx,%rsi
+    13aa:	|  |  |     |  |           |  |  |  |     |                             |                        bf 01 00 00 00       	mov    $0x1,%edi
+    13af:	|  |  |     |  |           |  |  |  |     |                             |                        e8 ac fc ff ff       	call   1060 <clock_gettime@plt>
+        run("  qsort                  ", s, pat,
+            [](nel::Slice<int> const &s) { qsort(s.ptr(), s.len(), sizeof(int), cmp_int); });
+    13b4:	|  |  |     |  |           |  |  |  |     |                             |                        ba 04 00 00 00       	mov    $0x4,%edx
+    13b9:	|  |  |     |  |           |  |  |  |     |                             |                        4c 89 ee             	mov    %r13,%rsi
+    13bc:	|  |  |     |  |           |  |  |  |     |                             |                        4c 89 e7             	mov    %r12,%rdi
+    13bf:	|  |  |     |  |           |  |  |  |     |                             |                        48 8d 0d da 0d 00 00 	lea    0xdda(%rip),%rcx        # 21a0 <cmp_int(void const*, void const*)>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    13c6:	|  |  |     |  |           |  |  |  |     |                             |                        4c 8b 7c 24 60       	mov    0x60(%rsp),%r15
+    13cb:	|  |  |     |  |           |  |  |  |     |                             |                        48 8b 6c 24 68       	mov    0x68(%rsp),%rbp
+    13d0:	|  |  |     |  |           |  |  |  |     |                             |                        e8 7b fc ff ff       	call   1050 <qsort@plt>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    13d5:	|  |  |     |  |           |  |  |  |     |                             |                        48 89 de             	mov    %rbx,%rsi
+    13d8:	|  |  |     |  |           |  |  |  |     |                             |                        bf 01 00 00 00       	mov    $0x1,%edi
+    13dd:	|  |  |     |  |           |  |  |  |     |                             |                        e8 7e fc ff ff       	call   1060 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    13e2:	|  |  |     |  |           |  |  |  |     |                             |                        48 8b 54 24 60       	mov    0x60(%rsp),%rdx
+    13e7:	|  |  |     |  |           |  |  |  |     |                             |                        48 8b 74 24 68       	mov    0x68(%rsp),%rsi
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    13ec:	|  |  |     |  |           |  |  |  |     |                             |                        49 83 fd 01          	cmp    $0x1,%r13
+    13f0:	|  |  |     |  |  /--------|--|--|--|-----|-----------------------------|----------------------- 0f 86 15 0b 00 00    	jbe    1f0b <main+0xd9b>
+    13f6:	|  |  |     |  |  |        |  |  |  |     |                             |                        b8 01 00 00 00       	mov    $0x1,%eax
+    bool sorted = true;
+    13fb:	|  |  |     |  |  |        |  |  |  |     |                             |                        b9 01 00 00 00       	mov    $0x1,%ecx
+        sorted = sorted && !(s.ptr()[i] < s.ptr()[i - 1]);
+    1400:	|  |  |     |  |  |        |  |  |  |     |                             |                 /----> 84 c9                	test   %cl,%cl
+    1402:	|  |  |     |  |  |        |  |  |  |     |                             |                 |  /-- 74 0c                	je     1410 <main+0x2a0>
+    1404:	|  |  |     |  |  |        |  |  |  |     |                             |                 |  |   41 8b 4c 84 fc       	mov    -0x4(%r12,%rax,4),%ecx
+    1409:	|  |  |     |  |  |        |  |  |  |     |                             |                 |  |   41 39 0c 84          	cmp    %ecx,(%r12,%rax,4)
+    140d:	|  |  |     |  |  |        |  |  |  |     |                             |                 |  |   0f 9d c1             	setge  %cl
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    1410:	|  |  |     |  |  |        |  |  |  |     |                             |                 |  \-> 48 83 c0 01          	add    $0x1,%rax
+    1414:	|  |  |     |  |  |        |  |  |  |     |                             |                 |      4c 39 e8             	cmp    %r13,%rax
+    1417:	|  |  |     |  |  |        |  |  |  |     |                             |                 \----- 75 e7                	jne    1400 <main+0x290>
+    1419:	|  |  |  /--|--|--|--------|--|--|--|-----|-----------------------------|----------------------> 48 69 c2 00 ca 9a 3b 	imul   $0x3b9aca00,%rdx,%rax
+
+// Log a result line: name, and time per item in ns (to 2 decimal places).
+inline void report_per_item(char const *const name, long unsigned int const ns,
+                            long unsigned int const items)
+{
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1420:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        31 d2                	xor    %edx,%edx
+    long unsigned int const frac = cns % 100UL;
+    nel::log << name << ": " << cns / 100UL << '.' << (frac < 10 ? "0" : "") << frac
+             << "ns/item\n";
+    1422:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 8d 3d 40 4c 00 00 	lea    0x4c40(%rip),%rdi        # 6069 <nel::log>
+    1429:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        88 4c 24 20          	mov    %cl,0x20(%rsp)
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    142d:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        4d 69 ff 00 ca 9a 3b 	imul   $0x3b9aca00,%r15,%r15
+    return now_ns() - b;
+    1434:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 29 e8             	sub    %rbp,%rax
+    1437:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 01 f0             	add    %rsi,%rax
+    143a:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        4c 29 f8             	sub    %r15,%rax
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    143d:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    1441:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    1445:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 c1 e0 02          	shl    $0x2,%rax
+    1449:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        49 f7 f5             	div    %r13
+    long unsigned int const frac = cns % 100UL;
+    144c:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 89 c2             	mov    %rax,%rdx
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    144f:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 89 c6             	mov    %rax,%rsi
+    long unsigned int const frac = cns % 100UL;
+    1452:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    1459:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        c2 f5 28 
+    145c:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 c1 ea 02          	shr    $0x2,%rdx
+    1460:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 f7 e2             	mul    %rdx
+    1463:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 c1 ea 02          	shr    $0x2,%rdx
+    1467:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+    146b:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        49 89 d7             	mov    %rdx,%r15
+    146e:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    1472:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 c1 e0 02          	shl    $0x2,%rax
+    1476:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 29 c6             	sub    %rax,%rsi
+    1479:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 89 f5             	mov    %rsi,%rbp
+             << "ns/item\n";
+    147c:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 8d 35 bb 2b 00 00 	lea    0x2bbb(%rip),%rsi        # 403e <_IO_stdin_used+0x3e>
+    1483:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        e8 c8 26 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1488:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 8d 35 89 2c 00 00 	lea    0x2c89(%rip),%rsi        # 4118 <_IO_stdin_used+0x118>
+    148f:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 89 c7             	mov    %rax,%rdi
+    1492:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        e8 b9 26 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1497:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        4c 89 fe             	mov    %r15,%rsi
+    149a:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 89 c7             	mov    %rax,%rdi
+    149d:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        e8 6e 27 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    14a2:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        be 2e 00 00 00       	mov    $0x2e,%esi
+    14a7:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 89 c7             	mov    %rax,%rdi
+    14aa:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        e8 81 26 00 00       	call   3b30 <nel::operator<<(nel::Log&, char)>
+    14af:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 83 fd 0a          	cmp    $0xa,%rbp
+    14b3:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 8d 35 ac 2b 00 00 	lea    0x2bac(%rip),%rsi        # 4066 <_IO_stdin_used+0x66>
+    14ba:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 89 c7             	mov    %rax,%rdi
+    14bd:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 8d 05 30 2c 00 00 	lea    0x2c30(%rip),%rax        # 40f4 <_IO_stdin_used+0xf4>
+    14c4:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 0f 42 f0          	cmovb  %rax,%rsi
+    14c8:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        e8 83 26 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    14cd:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 89 ee             	mov    %rbp,%rsi
+    14d0:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 89 c7             	mov    %rax,%rdi
+    14d3:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        e8 38 27 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    14d8:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 8d 35 25 2b 00 00 	lea    0x2b25(%rip),%rsi        # 4004 <_IO_stdin_used+0x4>
+    14df:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        48 89 c7             	mov    %rax,%rdi
+    14e2:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        e8 69 26 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    if (!sorted) { nel::log << "  not sorted!\n"; }
+    14e7:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        0f b6 4c 24 20       	movzbl 0x20(%rsp),%ecx
+    14ec:	|  |  |  |  |  |  |        |  |  |  |     |                             |                        84 c9                	test   %cl,%cl
+    14ee:	|  |  |  |  |  |  |     /--|--|--|--|-----|-----------------------------|----------------------- 75 13                	jne    1503 <main+0x393>
+    14f0:	|  |  |  |  |  |  |     |  |  |  |  |     |                             |                        48 8d 35 61 2b 00 00 	lea    0x2b61(%rip),%rsi        # 4058 <_IO_stdin_used+0x58>
+    14f7:	|  |  |  |  |  |  |     |  |  |  |  |     |                             |                        48 8d 3d 6b 4b 00 00 	lea    0x4b6b(%rip),%rdi        # 6069 <nel::log>
+    14fe:	|  |  |  |  |  |  |     |  |  |  |  |     |                             |                        e8 4d 26 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    fill(s, pat);
+    1503:	|  |  |  |  |  |  |     >--|--|--|--|-----|-----------------------------|----------------------> 44 89 f2             	mov    %r14d,%edx
+    1506:	|  |  |  |  |  |  |     |  |  |  |  |     |                             |                        4c 89 ee             	mov    %r13,%rsi
+    1509:	|  |  |  |  |  |  |     |  |  |  |  |     |                             |                        4c 89 e7             	mov    %r12,%rdi
+    150c:	|  |  |  |  |  |  |     |  |  |  |  |     |                             |                        e8 af 0f 00 00       	call   24c0 <fill(nel::Slice<int> const&, int) [clone .isra.0]>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1511:	|  |  |  |  |  |  |     |  |  |  |  |     |                             |                        48 89 de             	mov    %rbx,%rsi
+    1514:	|  |  |  |  |  |  |     |  |  |  |  |     |                             |                        bf 01 00 00 00       	mov    $0x1,%edi
+    1519:	|  |  |  |  |  |  |     |  |  |  |  |     |                             |                        e8 42 fb ff ff       	call   1060 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    151e:	|  |  |  |  |  |  |     |  |  |  |  |     |                             |                        4c 69 7c 24 60 00 ca 	imul   $0x3b9aca00,0x60(%rsp),%r15
+    1525:	|  |  |  |  |  |  |     |  |  |  |  |     |                             |                        9a 3b 
+    1527:	|  |  |  |  |  |  |     |  |  |  |  |     |                             |                        4c 03 7c 24 68       	add    0x68(%rsp),%r15
+ * Equal items may be reordered.
+ */
+template<typename T, typename F>
+void unstable(T p[], Length const n, F &less)
+{
+    if (n < 2) { return; }
+    152c:	|  |  |  |  |  |  |     |  |  |  |  |     |                             |                        49 83 fd 01          	cmp    $0x1,%r13
+    1530:	|  |  |  |  |  |  |     |  |  |  |  |     |  /--------------------------|----------------------- 0f 86 4f 09 00 00    	jbe    1e85 <main+0xd15>
+    Count l = 0;
+    1536:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                        31 d2                	xor    %edx,%edx
+    1538:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                        4c 89 ed             	mov    %r13,%rbp
+    153b:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                        0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        n /= 2;
+    1540:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                    /-> 48 d1 ed             	shr    %rbp
+        l += 1;
+    1543:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                    |   48 83 c2 01          	add    $0x1,%rdx
+    while (n > 1) {
+    1547:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                    |   48 83 fd 01          	cmp    $0x1,%rbp
+    154b:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                    \-- 75 f3                	jne    1540 <main+0x3d0>
+    pdq(p, n, less, log2(n), true);
+    154d:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                        b9 01 00 00 00       	mov    $0x1,%ecx
+    1552:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                        4c 89 ee             	mov    %r13,%rsi
+    1555:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                        4c 89 e7             	mov    %r12,%rdi
+    1558:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                        e8 93 10 00 00       	call   25f0 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    155d:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                        48 89 de             	mov    %rbx,%rsi
+    1560:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                        bf 01 00 00 00       	mov    $0x1,%edi
+    1565:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                        e8 f6 fa ff ff       	call   1060 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    156a:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                        48 69 44 24 60 00 ca 	imul   $0x3b9aca00,0x60(%rsp),%rax
+    1571:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                        9a 3b 
+    1573:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                        48 03 44 24 68       	add    0x68(%rsp),%rax
+    return now_ns() - b;
+    1578:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                        4c 29 f8             	sub    %r15,%rax
+    bool sorted = true;
+    157b:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                        41 bf 01 00 00 00    	mov    $0x1,%r15d
+    1581:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                        0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        sorted = sorted && !(s.ptr()[i] < s.ptr()[i - 1]);
+    1588:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                 /----> 45 84 ff             	test   %r15b,%r15b
+    158b:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                 |  /-- 74 0d                	je     159a <main+0x42a>
+    158d:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                 |  |   41 8b 74 ac fc       	mov    -0x4(%r12,%rbp,4),%esi
+    1592:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                 |  |   41 39 34 ac          	cmp    %esi,(%r12,%rbp,4)
+    1596:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                 |  |   41 0f 9d c7          	setge  %r15b
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    159a:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                 |  \-> 48 83 c5 01          	add    $0x1,%rbp
+    159e:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                 |      4c 39 ed             	cmp    %r13,%rbp
+    15a1:	|  |  |  |  |  |  |     |  |  |  |  |     |  |                          |                 \----- 75 e5                	jne    1588 <main+0x418>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    15a3:	|  |  |  |  |  |  |  /--|--|--|--|--|-----|--|--------------------------|----------------------> 48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    15a7:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        31 d2                	xor    %edx,%edx
+             << "ns/item\n";
+    15a9:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 8d 35 b7 2a 00 00 	lea    0x2ab7(%rip),%rsi        # 4067 <_IO_stdin_used+0x67>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    15b0:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 8d 04 80          	lea    (%rax,%rax,4),%rax
+             << "ns/item\n";
+    15b4:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 8d 3d ae 4a 00 00 	lea    0x4aae(%rip),%rdi        # 6069 <nel::log>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    15bb:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 c1 e0 02          	shl    $0x2,%rax
+    15bf:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        49 f7 f5             	div    %r13
+    long unsigned int const frac = cns % 100UL;
+    15c2:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 89 c2             	mov    %rax,%rdx
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    15c5:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 89 c1             	mov    %rax,%rcx
+    long unsigned int const frac = cns % 100UL;
+    15c8:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    15cf:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        c2 f5 28 
+    15d2:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 c1 ea 02          	shr    $0x2,%rdx
+    15d6:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 f7 e2             	mul    %rdx
+    15d9:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 c1 ea 02          	shr    $0x2,%rdx
+    15dd:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+    15e1:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 89 54 24 20       	mov    %rdx,0x20(%rsp)
+    15e6:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    15ea:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 c1 e0 02          	shl    $0x2,%rax
+    15ee:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 29 c1             	sub    %rax,%rcx
+    15f1:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 89 cd             	mov    %rcx,%rbp
+             << "ns/item\n";
+    15f4:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        e8 57 25 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    15f9:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 8d 35 18 2b 00 00 	lea    0x2b18(%rip),%rsi        # 4118 <_IO_stdin_used+0x118>
+    1600:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 89 c7             	mov    %rax,%rdi
+    1603:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        e8 48 25 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1608:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 8b 74 24 20       	mov    0x20(%rsp),%rsi
+    160d:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 89 c7             	mov    %rax,%rdi
+    1610:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        e8 fb 25 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    1615:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        be 2e 00 00 00       	mov    $0x2e,%esi
+    161a:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 89 c7             	mov    %rax,%rdi
+    161d:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        e8 0e 25 00 00       	call   3b30 <nel::operator<<(nel::Log&, char)>
+    1622:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 83 fd 0a          	cmp    $0xa,%rbp
+    1626:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 8d 35 39 2a 00 00 	lea    0x2a39(%rip),%rsi        # 4066 <_IO_stdin_used+0x66>
+    162d:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 89 c7             	mov    %rax,%rdi
+    1630:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 8d 05 bd 2a 00 00 	lea    0x2abd(%rip),%rax        # 40f4 <_IO_stdin_used+0xf4>
+    1637:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 0f 42 f0          	cmovb  %rax,%rsi
+    163b:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        e8 10 25 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1640:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 89 ee             	mov    %rbp,%rsi
+    1643:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 89 c7             	mov    %rax,%rdi
+    1646:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        e8 c5 25 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    164b:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 8d 35 b2 29 00 00 	lea    0x29b2(%rip),%rsi        # 4004 <_IO_stdin_used+0x4>
+    1652:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        48 89 c7             	mov    %rax,%rdi
+    1655:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        e8 f6 24 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    if (!sorted) { nel::log << "  not sorted!\n"; }
+    165a:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                          |                        45 84 ff             	test   %r15b,%r15b
+    165d:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  /-----------------------|----------------------- 75 13                	jne    1672 <main+0x502>
+    165f:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |                       |                        48 8d 35 f2 29 00 00 	lea    0x29f2(%rip),%rsi        # 4058 <_IO_stdin_used+0x58>
+    1666:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |                       |                        48 8d 3d fc 49 00 00 	lea    0x49fc(%rip),%rdi        # 6069 <nel::log>
+    166d:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |                       |                        e8 de 24 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    fill(s, pat);
+    1672:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  >-----------------------|----------------------> 44 89 f2             	mov    %r14d,%edx
+    1675:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |                       |                        4c 89 ee             	mov    %r13,%rsi
+    1678:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |                       |                        4c 89 e7             	mov    %r12,%rdi
+    167b:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |                       |                        e8 40 0e 00 00       	call   24c0 <fill(nel::Slice<int> const&, int) [clone .isra.0]>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1680:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |                       |                        48 89 de             	mov    %rbx,%rsi
+    1683:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |                       |                        bf 01 00 00 00       	mov    $0x1,%edi
+    1688:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |                       |                        e8 d3 f9 ff ff       	call   1060 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    168d:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |                       |                        4c 69 7c 24 60 00 ca 	imul   $0x3b9aca00,0x60(%rsp),%r15
+    1694:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |                       |                        9a 3b 
+    1696:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |                       |                        4c 03 7c 24 68       	add    0x68(%rsp),%r15
+ * O(n) for already sorted items.
+ */
+template<typename T, typename F>
+void stable(T p[], Length const n, T buf[], Length const buf_n, F &less)
+{
+    if (n < small_n) {
+    169b:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |                       |                        49 83 fd 13          	cmp    $0x13,%r13
+    169f:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           /-----------|----------------------- 0f 86 c3 06 00 00    	jbe    1d68 <main+0xbf8>
+    16a5:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |           |                        49 89 d8             	mov    %rbx,%r8
+    16a8:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |           |                        31 c9                	xor    %ecx,%ecx
+    16aa:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |           |                        31 d2                	xor    %edx,%edx
+    16ac:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |           |                        4c 89 ee             	mov    %r13,%rsi
+    16af:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |           |                        4c 89 e7             	mov    %r12,%rdi
+    16b2:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |           |                        e8 e9 15 00 00       	call   2ca0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    16b7:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     /-----|-----------|----------------------> 48 89 de             	mov    %rbx,%rsi
+    16ba:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |     |           |                        bf 01 00 00 00       	mov    $0x1,%edi
+    return now_ns() - b;
+    16bf:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |     |           |                        bd 01 00 00 00       	mov    $0x1,%ebp
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    16c4:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |     |           |                        e8 97 f9 ff ff       	call   1060 <clock_gettime@plt>
+    return now_ns() - b;
+    16c9:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |     |           |                        b8 01 00 00 00       	mov    $0x1,%eax
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    16ce:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |     |           |                        48 69 54 24 60 00 ca 	imul   $0x3b9aca00,0x60(%rsp),%rdx
+    16d5:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |     |           |                        9a 3b 
+    16d7:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |     |           |                        48 03 54 24 68       	add    0x68(%rsp),%rdx
+    return now_ns() - b;
+    16dc:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |     |           |                        4c 29 fa             	sub    %r15,%rdx
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    16df:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |     |           |                        90                   	nop
+        sorted = sorted && !(s.ptr()[i] < s.ptr()[i - 1]);
+    16e0:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |     |           |                 /----> 40 84 ed             	test   %bpl,%bpl
+    16e3:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |     |           |                 |  /-- 74 0d                	je     16f2 <main+0x582>
+    16e5:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |     |           |                 |  |   41 8b 74 84 fc       	mov    -0x4(%r12,%rax,4),%esi
+    16ea:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |     |           |                 |  |   41 39 34 84          	cmp    %esi,(%r12,%rax,4)
+    16ee:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |     |           |                 |  |   40 0f 9d c5          	setge  %bpl
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    16f2:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |     |           |                 |  \-> 48 83 c0 01          	add    $0x1,%rax
+    16f6:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |     |           |                 |      4c 39 e8             	cmp    %r13,%rax
+    16f9:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |     |           |                 \----- 75 e5                	jne    16e0 <main+0x570>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    16fb:	|  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|--|-----|-----|-----------|----------------------> 48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+    16ff:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        31 d2                	xor    %edx,%edx
+             << "ns/item\n";
+    1701:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 8d 35 79 29 00 00 	lea    0x2979(%rip),%rsi        # 4081 <_IO_stdin_used+0x81>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1708:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 8d 04 80          	lea    (%rax,%rax,4),%rax
+             << "ns/item\n";
+    170c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 8d 3d 56 49 00 00 	lea    0x4956(%rip),%rdi        # 6069 <nel::log>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1713:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 c1 e0 02          	shl    $0x2,%rax
+    1717:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        49 f7 f5             	div    %r13
+    long unsigned int const frac = cns % 100UL;
+    171a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 89 c2             	mov    %rax,%rdx
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    171d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 89 c1             	mov    %rax,%rcx
+    long unsigned int const frac = cns % 100UL;
+    1720:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    1727:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        c2 f5 28 
+    172a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 c1 ea 02          	shr    $0x2,%rdx
+    172e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 f7 e2             	mul    %rdx
+    1731:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 c1 ea 02          	shr    $0x2,%rdx
+    1735:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+    1739:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 89 54 24 20       	mov    %rdx,0x20(%rsp)
+    173e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    1742:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 c1 e0 02          	shl    $0x2,%rax
+    1746:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 29 c1             	sub    %rax,%rcx
+    1749:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        49 89 cf             	mov    %rcx,%r15
+             << "ns/item\n";
+    174c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        e8 ff 23 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1751:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 8d 35 c0 29 00 00 	lea    0x29c0(%rip),%rsi        # 4118 <_IO_stdin_used+0x118>
+    1758:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 89 c7             	mov    %rax,%rdi
+    175b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        e8 f0 23 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1760:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 8b 74 24 20       	mov    0x20(%rsp),%rsi
+    1765:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 89 c7             	mov    %rax,%rdi
+    1768:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        e8 a3 24 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    176d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        be 2e 00 00 00       	mov    $0x2e,%esi
+    1772:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 89 c7             	mov    %rax,%rdi
+    1775:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        e8 b6 23 00 00       	call   3b30 <nel::operator<<(nel::Log&, char)>
+    177a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        49 83 ff 0a          	cmp    $0xa,%r15
+    177e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 8d 35 e1 28 00 00 	lea    0x28e1(%rip),%rsi        # 4066 <_IO_stdin_used+0x66>
+    1785:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 89 c7             	mov    %rax,%rdi
+    1788:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 8d 05 65 29 00 00 	lea    0x2965(%rip),%rax        # 40f4 <_IO_stdin_used+0xf4>
+    178f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 0f 42 f0          	cmovb  %rax,%rsi
+    1793:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        e8 b8 23 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1798:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        4c 89 fe             	mov    %r15,%rsi
+    179b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 89 c7             	mov    %rax,%rdi
+    179e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        e8 6d 24 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    17a3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 8d 35 5a 28 00 00 	lea    0x285a(%rip),%rsi        # 4004 <_IO_stdin_used+0x4>
+    17aa:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        48 89 c7             	mov    %rax,%rdi
+    17ad:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        e8 9e 23 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    if (!sorted) { nel::log << "  not sorted!\n"; }
+    17b2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |           |                        40 84 ed             	test   %bpl,%bpl
+    17b5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  /--|-----------|----------------------- 75 13                	jne    17ca <main+0x65a>
+    17b7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |                        48 8d 35 9a 28 00 00 	lea    0x289a(%rip),%rsi        # 4058 <_IO_stdin_used+0x58>
+    17be:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |                        48 8d 3d a4 48 00 00 	lea    0x48a4(%rip),%rdi        # 6069 <nel::log>
+    17c5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |                        e8 86 23 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    fill(s, pat);
+    17ca:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  >--|-----------|----------------------> 44 89 f2             	mov    %r14d,%edx
+    17cd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |                        4c 89 ee             	mov    %r13,%rsi
+    17d0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |                        4c 89 e7             	mov    %r12,%rdi
+    17d3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |                        e8 e8 0c 00 00       	call   24c0 <fill(nel::Slice<int> const&, int) [clone .isra.0]>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    17d8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |                        48 89 de             	mov    %rbx,%rsi
+    17db:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |                        bf 01 00 00 00       	mov    $0x1,%edi
+    17e0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |                        e8 7b f8 ff ff       	call   1060 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    17e5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |                        4c 69 74 24 60 00 ca 	imul   $0x3b9aca00,0x60(%rsp),%r14
+    17ec:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |                        9a 3b 
+    17ee:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |                        4c 03 74 24 68       	add    0x68(%rsp),%r14
+    17f3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |                        49 83 fd 13          	cmp    $0x13,%r13
+    17f7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |        /-------------- 0f 86 f3 04 00 00    	jbe    1cf0 <main+0xb80>
+    17fd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |        |               48 8b 4c 24 30       	mov    0x30(%rsp),%rcx
+    1802:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |        |               48 8b 54 24 28       	mov    0x28(%rsp),%rdx
+    1807:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |        |               49 89 d8             	mov    %rbx,%r8
+    180a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |        |               4c 89 ee             	mov    %r13,%rsi
+    180d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |        |               4c 89 e7             	mov    %r12,%rdi
+    1810:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |           |        |               e8 8b 14 00 00       	call   2ca0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1815:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |        /--|--------|-------------> 48 89 de             	mov    %rbx,%rsi
+    1818:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |  |        |               bf 01 00 00 00       	mov    $0x1,%edi
+    return now_ns() - b;
+    181d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |  |        |               bd 01 00 00 00       	mov    $0x1,%ebp
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1822:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |  |        |               e8 39 f8 ff ff       	call   1060 <clock_gettime@plt>
+    return now_ns() - b;
+    1827:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |  |        |               b8 01 00 00 00       	mov    $0x1,%eax
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    182c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |  |        |               48 69 54 24 60 00 ca 	imul   $0x3b9aca00,0x60(%rsp),%rdx
+    1833:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |  |        |               9a 3b 
+    1835:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |  |        |               48 03 54 24 68       	add    0x68(%rsp),%rdx
+    return now_ns() - b;
+    183a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |  |        |               4c 29 f2             	sub    %r14,%rdx
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    183d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |  |        |               0f 1f 00             	nopl   (%rax)
+        sorted = sorted && !(s.ptr()[i] < s.ptr()[i - 1]);
+    1840:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |  |        |        /----> 40 84 ed             	test   %bpl,%bpl
+    1843:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |  |        |        |  /-- 74 0d                	je     1852 <main+0x6e2>
+    1845:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |  |        |        |  |   41 8b 74 84 fc       	mov    -0x4(%r12,%rax,4),%esi
+    184a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |  |        |        |  |   41 39 34 84          	cmp    %esi,(%r12,%rax,4)
+    184e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |  |        |        |  |   40 0f 9d c5          	setge  %bpl
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    1852:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |  |        |        |  \-> 48 83 c0 01          	add    $0x1,%rax
+    1856:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |  |        |        |      4c 39 e8             	cmp    %r13,%rax
+    1859:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |  |        |        \----- 75 e5                	jne    1840 <main+0x6d0>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    185b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|--|--------|--|--------|-------------> 48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+    185f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               31 d2                	xor    %edx,%edx
+             << "ns/item\n";
+    1861:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 8d 35 33 28 00 00 	lea    0x2833(%rip),%rsi        # 409b <_IO_stdin_used+0x9b>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1868:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 8d 04 80          	lea    (%rax,%rax,4),%rax
+             << "ns/item\n";
+    186c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 8d 3d f6 47 00 00 	lea    0x47f6(%rip),%rdi        # 6069 <nel::log>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1873:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 c1 e0 02          	shl    $0x2,%rax
+    1877:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               49 f7 f5             	div    %r13
+    long unsigned int const frac = cns % 100UL;
+    187a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 89 c2             	mov    %rax,%rdx
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    187d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 89 c1             	mov    %rax,%rcx
+    long unsigned int const frac = cns % 100UL;
+    1880:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    1887:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               c2 f5 28 
+    188a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 c1 ea 02          	shr    $0x2,%rdx
+    188e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 f7 e2             	mul    %rdx
+    1891:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 c1 ea 02          	shr    $0x2,%rdx
+    1895:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+    1899:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               49 89 d7             	mov    %rdx,%r15
+    189c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    18a0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 c1 e0 02          	shl    $0x2,%rax
+    18a4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 29 c1             	sub    %rax,%rcx
+    18a7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               49 89 ce             	mov    %rcx,%r14
+             << "ns/item\n";
+    18aa:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               e8 a1 22 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    18af:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 8d 35 62 28 00 00 	lea    0x2862(%rip),%rsi        # 4118 <_IO_stdin_used+0x118>
+    18b6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 89 c7             	mov    %rax,%rdi
+    18b9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               e8 92 22 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    18be:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               4c 89 fe             	mov    %r15,%rsi
+    18c1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 89 c7             	mov    %rax,%rdi
+    18c4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               e8 47 23 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    18c9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               be 2e 00 00 00       	mov    $0x2e,%esi
+    18ce:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 89 c7             	mov    %rax,%rdi
+    18d1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               e8 5a 22 00 00       	call   3b30 <nel::operator<<(nel::Log&, char)>
+    18d6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               49 83 fe 0a          	cmp    $0xa,%r14
+    18da:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 8d 35 85 27 00 00 	lea    0x2785(%rip),%rsi        # 4066 <_IO_stdin_used+0x66>
+    18e1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 89 c7             	mov    %rax,%rdi
+    18e4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 8d 05 09 28 00 00 	lea    0x2809(%rip),%rax        # 40f4 <_IO_stdin_used+0xf4>
+    18eb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 0f 42 f0          	cmovb  %rax,%rsi
+    18ef:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               e8 5c 22 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    18f4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               4c 89 f6             	mov    %r14,%rsi
+    18f7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 89 c7             	mov    %rax,%rdi
+    18fa:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               e8 11 23 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    18ff:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 8d 35 fe 26 00 00 	lea    0x26fe(%rip),%rsi        # 4004 <_IO_stdin_used+0x4>
+    1906:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               48 89 c7             	mov    %rax,%rdi
+    1909:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               e8 42 22 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    if (!sorted) { nel::log << "  not sorted!\n"; }
+    190e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |               40 84 ed             	test   %bpl,%bpl
+    1911:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |  /----------- 0f 85 be 03 00 00    	jne    1cd5 <main+0xb65>
+    1917:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |  |            48 8d 35 3a 27 00 00 	lea    0x273a(%rip),%rsi        # 4058 <_IO_stdin_used+0x58>
+    191e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |  |            48 8d 3d 44 47 00 00 	lea    0x4744(%rip),%rdi        # 6069 <nel::log>
+    1925:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |  |            e8 26 22 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    for (int pat = 0; pat < 5; ++pat) {
+    192a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |  |            48 83 04 24 01       	addq   $0x1,(%rsp)
+    192f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |  |            48 8b 04 24          	mov    (%rsp),%rax
+    1933:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |  |            48 83 f8 05          	cmp    $0x5,%rax
+    1937:	|  |  |  |  |  |  |  |  |  |  |  |  +--|--|--|--|--|--|--|--|--------|--|--------|--|----------- 0f 85 13 fa ff ff    	jne    1350 <main+0x1e0>
+    193d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |  |  /-------> 48 8d 05 87 27 00 00 	lea    0x2787(%rip),%rax        # 40cb <_IO_stdin_used+0xcb>
+    1944:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |  |  |         48 8d 15 6a 27 00 00 	lea    0x276a(%rip),%rdx        # 40b5 <_IO_stdin_used+0xb5>
+    194b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |  |  |         48 8b 5c 24 38       	mov    0x38(%rsp),%rbx
+    1950:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |  |  |         4c 89 e5             	mov    %r12,%rbp
+    1953:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |  |  |         66 48 0f 6e d2       	movq   %rdx,%xmm2
+    1958:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |  |  |         66 48 0f 6e e0       	movq   %rax,%xmm4
+    195d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |  |  |         4c 8b 44 24 40       	mov    0x40(%rsp),%r8
+    1962:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |  |  |         4c 8b 7c 24 48       	mov    0x48(%rsp),%r15
+    1967:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |  |  |         66 0f 6c d4          	punpcklqdq %xmm4,%xmm2
+    196b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |  |  |         0f 29 14 24          	movaps %xmm2,(%rsp)
+    for (nel::Index i = 0; i < n; ++i) {
+    196f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |        |  |  |         4d 85 ed             	test   %r13,%r13
+    1972:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-----|--|--------|--|--|-------- 0f 84 5f 06 00 00    	je     1fd7 <main+0xe67>
+    1978:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |         4c 89 e1             	mov    %r12,%rcx
+    197b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |         4e 8d 24 ad 00 00 00 	lea    0x0(,%r13,4),%r12
+    1982:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |         00 
+    unsigned int seed = 0x12345678;
+    1983:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |         b8 78 56 34 12       	mov    $0x12345678,%eax
+    1988:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |         4a 8d 74 25 00       	lea    0x0(%rbp,%r12,1),%rsi
+    198d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |         0f 1f 00             	nopl   (%rax)
+    s ^= s << 13;
+    1990:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |     /-> 89 c2                	mov    %eax,%edx
+    for (nel::Index i = 0; i < n; ++i) {
+    1992:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |     |   48 83 c1 04          	add    $0x4,%rcx
+    s ^= s << 13;
+    1996:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |     |   c1 e2 0d             	shl    $0xd,%edx
+    1999:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |     |   31 d0                	xor    %edx,%eax
+    s ^= s >> 17;
+    199b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |     |   89 c2                	mov    %eax,%edx
+    199d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |     |   c1 ea 11             	shr    $0x11,%edx
+    19a0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |     |   31 c2                	xor    %eax,%edx
+    s ^= s << 5;
+    19a2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |     |   89 d0                	mov    %edx,%eax
+    19a4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |     |   c1 e0 05             	shl    $0x5,%eax
+    19a7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |     |   31 d0                	xor    %edx,%eax
+                p[i] = int(next_rand(seed) & 0x7fffffff);
+    19a9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |     |   89 c2                	mov    %eax,%edx
+    19ab:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |     |   81 e2 ff ff ff 7f    	and    $0x7fffffff,%edx
+    19b1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |     |   89 51 fc             	mov    %edx,-0x4(%rcx)
+    for (nel::Index i = 0; i < n; ++i) {
+    19b4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |     |   48 39 ce             	cmp    %rcx,%rsi
+    19b7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |     \-- 75 d7                	jne    1990 <main+0x820>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    19b9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |         48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    19be:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |         bf 01 00 00 00       	mov    $0x1,%edi
+    19c3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |         4c 89 44 24 20       	mov    %r8,0x20(%rsp)
+    19c8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |         e8 93 f6 ff ff       	call   1060 <clock_gettime@plt>
+         * @param k number of items to sort, sorts all if k >= len().
+         */
+        template<typename F = sort::Less>
+        void partial_sort(Length k, F &&less = F())
+        {
+            if (k < len()) {
+    19cd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |         4c 8b 44 24 20       	mov    0x20(%rsp),%r8
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    19d2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |         4c 69 74 24 60 00 ca 	imul   $0x3b9aca00,0x60(%rsp),%r14
+    19d9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |         9a 3b 
+    19db:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |         4c 03 74 24 68       	add    0x68(%rsp),%r14
+    19e0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |        |  |  |         49 81 fd e8 03 00 00 	cmp    $0x3e8,%r13
+    19e7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     /--|--|--|-------- 0f 87 f3 03 00 00    	ja     1de0 <main+0xc70>
+void unstable(T p[], Length const n, F &less)
+    19ed:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |  |  |         4c 89 ee             	mov    %r13,%rsi
+    if (n < 2) { return; }
+    19f0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |  |  |         49 83 fd 01          	cmp    $0x1,%r13
+    19f4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |  |  |  /----- 74 31                	je     1a27 <main+0x8b7>
+                sort::select_nth(ptr(), len(), k, less);
+    19f6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  /--|--|--|--|--|----> 48 89 f0             	mov    %rsi,%rax
+    19f9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        n /= 2;
+    1a00:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  /-> 48 d1 e8             	shr    %rax
+        l += 1;
+    1a03:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |   49 83 c7 01          	add    $0x1,%r15
+    while (n > 1) {
+    1a07:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |   48 83 f8 01          	cmp    $0x1,%rax
+    1a0b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  \-- 75 f3                	jne    1a00 <main+0x890>
+    pdq(p, n, less, log2(n), true);
+    1a0d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |      b9 01 00 00 00       	mov    $0x1,%ecx
+    1a12:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |      4c 89 fa             	mov    %r15,%rdx
+    1a15:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    1a18:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |      4c 89 44 24 20       	mov    %r8,0x20(%rsp)
+    1a1d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |      e8 ce 0b 00 00       	call   25f0 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]>
+    1a22:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |      4c 8b 44 24 20       	mov    0x20(%rsp),%r8
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1a27:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  \----> 48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1a2c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         bf 01 00 00 00       	mov    $0x1,%edi
+    1a31:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         4c 89 44 24 20       	mov    %r8,0x20(%rsp)
+    1a36:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         e8 25 f6 ff ff       	call   1060 <clock_gettime@plt>
+
+    // the 1000 smallest, and the median, of random ints.
+    {
+        fill(s, 0);
+        auto t = bench::time_ns([&s]() { nel::Slice<int>(s).partial_sort(1000); });
+        bench::report_per_item("random, partial_sort 1000", t, s.len());
+    1a3b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         4c 89 ea             	mov    %r13,%rdx
+    1a3e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         48 8d 3d 97 26 00 00 	lea    0x2697(%rip),%rdi        # 40dc <_IO_stdin_used+0xdc>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1a45:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         48 69 74 24 60 00 ca 	imul   $0x3b9aca00,0x60(%rsp),%rsi
+    1a4c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         9a 3b 
+    1a4e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         48 03 74 24 68       	add    0x68(%rsp),%rsi
+    return now_ns() - b;
+    1a53:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         4c 29 f6             	sub    %r14,%rsi
+    1a56:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         e8 65 18 00 00       	call   32c0 <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    for (nel::Index i = 0; i < n; ++i) {
+    1a5b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         4c 8b 44 24 20       	mov    0x20(%rsp),%r8
+    1a60:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         48 89 e9             	mov    %rbp,%rcx
+    1a63:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         4a 8d 74 25 00       	lea    0x0(%rbp,%r12,1),%rsi
+    unsigned int seed = 0x12345678;
+    1a68:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         b8 78 56 34 12       	mov    $0x12345678,%eax
+    1a6d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         0f 1f 00             	nopl   (%rax)
+    s ^= s << 13;
+    1a70:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |     /-> 89 c2                	mov    %eax,%edx
+    for (nel::Index i = 0; i < n; ++i) {
+    1a72:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |   48 83 c1 04          	add    $0x4,%rcx
+    s ^= s << 13;
+    1a76:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |   c1 e2 0d             	shl    $0xd,%edx
+    1a79:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |   31 d0                	xor    %edx,%eax
+    s ^= s >> 17;
+    1a7b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |   89 c2                	mov    %eax,%edx
+    1a7d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |   c1 ea 11             	shr    $0x11,%edx
+    1a80:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |   31 c2                	xor    %eax,%edx
+    s ^= s << 5;
+    1a82:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |   89 d0                	mov    %edx,%eax
+    1a84:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |   c1 e0 05             	shl    $0x5,%eax
+    1a87:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |   31 d0                	xor    %edx,%eax
+                p[i] = int(next_rand(seed) & 0x7fffffff);
+    1a89:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |   89 c2                	mov    %eax,%edx
+    1a8b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |   81 e2 ff ff ff 7f    	and    $0x7fffffff,%edx
+    1a91:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |   89 51 fc             	mov    %edx,-0x4(%rcx)
+    for (nel::Index i = 0; i < n; ++i) {
+    1a94:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |   48 39 ce             	cmp    %rcx,%rsi
+    1a97:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |     \-- 75 d7                	jne    1a70 <main+0x900>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1a99:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1a9e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         bf 01 00 00 00       	mov    $0x1,%edi
+    }
+    {
+        fill(s, 0);
+        int m = 0;
+        auto t = bench::time_ns(
+            [&s, &m]() { m = nel::Slice<int>(s).select_nth_unstable(s.len() / 2); });
+    1aa3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         4d 89 ef             	mov    %r13,%r15
+    1aa6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         4c 89 44 24 20       	mov    %r8,0x20(%rsp)
+    1aab:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         49 d1 ef             	shr    %r15
+    1aae:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         e8 ad f5 ff ff       	call   1060 <clock_gettime@plt>
+    1ab3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         66 0f 6f 2c 24       	movdqa (%rsp),%xmm5
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1ab8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         4c 8b 74 24 68       	mov    0x68(%rsp),%r14
+    1abd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         4c 69 64 24 60 00 ca 	imul   $0x3b9aca00,0x60(%rsp),%r12
+    1ac4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         9a 3b 
+    if (pred) { panic(msg, ctx); }
+}
+
+inline void panic_if_not(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { panic(msg, ctx); }
+    1ac6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         4d 39 ef             	cmp    %r13,%r15
+    1ac9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         4c 8b 44 24 20       	mov    0x20(%rsp),%r8
+            : fn_name_(fn_name)
+    1ace:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |         0f 29 6c 24 60       	movaps %xmm5,0x60(%rsp)
+    if (!pred) { panic(msg, ctx); }
+    1ad3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|--|--|--|--|--|-------- 0f 83 ca 05 00 00    	jae    20a3 <main+0xf33>
+            sort::select_nth(ptr(), len(), idx, less);
+    1ad9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         4c 89 fa             	mov    %r15,%rdx
+    1adc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         4c 89 ee             	mov    %r13,%rsi
+    1adf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 ef             	mov    %rbp,%rdi
+    1ae2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         4c 89 04 24          	mov    %r8,(%rsp)
+    1ae6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 95 0e 00 00       	call   2980 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1aeb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1af0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         bf 01 00 00 00       	mov    $0x1,%edi
+    1af5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         42 8b 6c bd 00       	mov    0x0(%rbp,%r15,4),%ebp
+    1afa:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 61 f5 ff ff       	call   1060 <clock_gettime@plt>
+        bench::report_per_item("random, select median    ", t, s.len());
+    1aff:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         4c 89 ea             	mov    %r13,%rdx
+    1b02:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8d 3d ed 25 00 00 	lea    0x25ed(%rip),%rdi        # 40f6 <_IO_stdin_used+0xf6>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1b09:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 69 74 24 60 00 ca 	imul   $0x3b9aca00,0x60(%rsp),%rsi
+    1b10:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         9a 3b 
+    1b12:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         4c 29 f6             	sub    %r14,%rsi
+    return now_ns() - b;
+    1b15:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 03 74 24 68       	add    0x68(%rsp),%rsi
+    1b1a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         4c 29 e6             	sub    %r12,%rsi
+    1b1d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 9e 17 00 00       	call   32c0 <bench::report_per_item(char const*, unsigned long, unsigned long)>
+        nel::log << "  median: " << m << '\n';
+    1b22:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8d 35 e7 25 00 00 	lea    0x25e7(%rip),%rsi        # 4110 <_IO_stdin_used+0x110>
+    1b29:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8d 3d 39 45 00 00 	lea    0x4539(%rip),%rdi        # 6069 <nel::log>
+    1b30:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 1b 20 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1b35:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         89 ee                	mov    %ebp,%esi
+    1b37:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    1b3a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 b1 20 00 00       	call   3bf0 <nel::operator<<(nel::Log&, int)>
+    1b3f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         be 0a 00 00 00       	mov    $0xa,%esi
+    1b44:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 c7             	mov    %rax,%rdi
+    1b47:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 e4 1f 00 00       	call   3b30 <nel::operator<<(nel::Log&, char)>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    1b4c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 8b 3c 24          	mov    (%rsp),%rdi
+    1b50:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 db f4 ff ff       	call   1030 <free@plt>
+    1b55:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 df             	mov    %rbx,%rdi
+    1b58:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 d3 f4 ff ff       	call   1030 <free@plt>
+    }
+}
+    1b5d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 81 c4 88 00 00 00 	add    $0x88,%rsp
+    1b64:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         31 c0                	xor    %eax,%eax
+    1b66:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         5b                   	pop    %rbx
+    1b67:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         5d                   	pop    %rbp
+    1b68:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         41 5c                	pop    %r12
+    1b6a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         41 5d                	pop    %r13
+    1b6c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         41 5e                	pop    %r14
+    1b6e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         41 5f                	pop    %r15
+    1b70:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         c3                   	ret
+    1b71:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            if (cap <= cur) { return cap; }
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    1b78:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  \--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-------> 48 83 fa 03          	cmp    $0x3,%rdx
+    1b7c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /----- 77 4a                	ja     1bc8 <main+0xa58>
+    1b7e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      ba 04 00 00 00       	mov    $0x4,%edx
+    1b83:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 39 d1             	cmp    %rdx,%rcx
+    1b86:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 0f 42 ca          	cmovb  %rdx,%rcx
+    1b8a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 39 c1             	cmp    %rax,%rcx
+    1b8d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 0f 43 c1          	cmovae %rcx,%rax
+    1b91:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 89 c3             	mov    %rax,%rbx
+            if (new_cap > max_capacity) { return nullptr; }
+    1b94:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-> 49 39 dd             	cmp    %rbx,%r13
+    1b97:	|  |  +--|--|--|--|--|--|--|--|--|--|--|-----|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-- 0f 82 7c f6 ff ff    	jb     1219 <main+0xa9>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1b9d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 8d 34 9d 14 00 00 	lea    0x14(,%rbx,4),%rsi
+    1ba4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   00 
+                                    : std::realloc(p, new_size);
+    1ba5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   e8 06 f5 ff ff       	call   10b0 <realloc@plt>
+    1baa:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+            if (new_p == nullptr) {
+    1bad:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 85 c0             	test   %rax,%rax
+    1bb0:	|  |  +--|--|--|--|--|--|--|--|--|--|--|-----|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-- 0f 84 63 f6 ff ff    	je     1219 <main+0xa9>
+            new_n->alloc_ = new_cap;
+    1bb6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 89 18             	mov    %rbx,(%rax)
+            return len_;
+    1bb9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 89 da             	mov    %rbx,%rdx
+    1bbc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 8b 40 08          	mov    0x8(%rax),%rax
+    1bc0:	|  |  |  |  |  |  |  |  |  +--|--|--|--|-----|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-- e9 4f f6 ff ff       	jmp    1214 <main+0xa4>
+    1bc5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   0f 1f 00             	nopl   (%rax)
+    1bc8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \--|-> 48 8d 1c 12          	lea    (%rdx,%rdx,1),%rbx
+    1bcc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 39 cb             	cmp    %rcx,%rbx
+    1bcf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 0f 42 d9          	cmovb  %rcx,%rbx
+    1bd3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 39 c3             	cmp    %rax,%rbx
+    1bd6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 0f 42 d8          	cmovb  %rax,%rbx
+            } else if (new_cap == item_->capacity()) {
+    1bda:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 39 d3             	cmp    %rdx,%rbx
+    1bdd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     \-- 75 b5                	jne    1b94 <main+0xa24>
+    1bdf:	|  |  |  |  |  |  |  |  |  \--|--|--|--|-----|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-------- e9 30 f6 ff ff       	jmp    1214 <main+0xa4>
+    1be4:	|  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         0f 1f 40 00          	nopl   0x0(%rax)
+    1be8:	|  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  |  |  |  |  |  |  \--|--|--|--|--|-------> 48 83 fa 03          	cmp    $0x3,%rdx
+    1bec:	|  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |  /----- 77 4a                	ja     1c38 <main+0xac8>
+    1bee:	|  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |  |      ba 04 00 00 00       	mov    $0x4,%edx
+    1bf3:	|  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |  |      48 39 d1             	cmp    %rdx,%rcx
+    1bf6:	|  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |  |      48 0f 42 ca          	cmovb  %rdx,%rcx
+    1bfa:	|  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |  |      48 39 c1             	cmp    %rax,%rcx
+    1bfd:	|  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |  |      48 0f 43 c1          	cmovae %rcx,%rax
+    1c01:	|  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |  |      49 89 c4             	mov    %rax,%r12
+            if (new_cap > max_capacity) { return nullptr; }
+    1c04:	|  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  /-> 4c 39 e5             	cmp    %r12,%rbp
+    1c07:	|  |  |  |  |  |  |  |  |     +--|--|--|-----|--|--|--|--|--|--|--|--|-----|--|--|--|--|--|--|-- 0f 82 b4 f6 ff ff    	jb     12c1 <main+0x151>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1c0d:	|  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   4a 8d 34 a5 14 00 00 	lea    0x14(,%r12,4),%rsi
+    1c14:	|  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   00 
+                                    : std::realloc(p, new_size);
+    1c15:	|  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   e8 96 f4 ff ff       	call   10b0 <realloc@plt>
+    1c1a:	|  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+            if (new_p == nullptr) {
+    1c1d:	|  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   48 85 c0             	test   %rax,%rax
+    1c20:	|  |  |  |  |  |  |  |  |     \--|--|--|-----|--|--|--|--|--|--|--|--|-----|--|--|--|--|--|--|-- 0f 84 9b f6 ff ff    	je     12c1 <main+0x151>
+            new_n->alloc_ = new_cap;
+    1c26:	|  |  |  |  |  |  |  |  |        |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   4c 89 20             	mov    %r12,(%rax)
+            return len_;
+    1c29:	|  |  |  |  |  |  |  |  |        |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   4c 89 e2             	mov    %r12,%rdx
+    1c2c:	|  |  |  |  |  |  |  |  |        |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   48 8b 40 08          	mov    0x8(%rax),%rax
+    1c30:	|  |  |  |  |  |  |  |  |        +--|--|-----|--|--|--|--|--|--|--|--|-----|--|--|--|--|--|--|-- e9 87 f6 ff ff       	jmp    12bc <main+0x14c>
+    1c35:	|  |  |  |  |  |  |  |  |        |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |   0f 1f 00             	nopl   (%rax)
+    1c38:	|  |  |  |  |  |  |  |  |        |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |  \--|-> 4c 8d 24 12          	lea    (%rdx,%rdx,1),%r12
+    1c3c:	|  |  |  |  |  |  |  |  |        |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |     |   49 39 cc             	cmp    %rcx,%r12
+    1c3f:	|  |  |  |  |  |  |  |  |        |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |     |   4c 0f 42 e1          	cmovb  %rcx,%r12
+    1c43:	|  |  |  |  |  |  |  |  |        |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |     |   49 39 c4             	cmp    %rax,%r12
+    1c46:	|  |  |  |  |  |  |  |  |        |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |     |   4c 0f 42 e0          	cmovb  %rax,%r12
+    1c4a:	|  |  |  |  |  |  |  |  |        |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |     |   4c 39 e2             	cmp    %r12,%rdx
+    1c4d:	|  |  |  |  |  |  |  |  |        |  |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |     \-- 75 b5                	jne    1c04 <main+0xa94>
+    1c4f:	|  |  |  |  |  |  |  |  |        \--|--|-----|--|--|--|--|--|--|--|--|-----|--|--|--|--|-------- e9 68 f6 ff ff       	jmp    12bc <main+0x14c>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1c54:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |     /-> 48 89 de             	mov    %rbx,%rsi
+    1c57:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |     |   bf 01 00 00 00       	mov    $0x1,%edi
+    1c5c:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |     |   e8 ff f3 ff ff       	call   1060 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1c61:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |     |   48 8b 44 24 60       	mov    0x60(%rsp),%rax
+    1c66:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |     |   48 8b 4c 24 68       	mov    0x68(%rsp),%rcx
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1c6b:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |     |  |  |  |  |     |   4d 85 ed             	test   %r13,%r13
+    1c6e:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  /--|--|--|--|--|-----|-- 0f 85 18 04 00 00    	jne    208c <main+0xf1c>
+             << "ns/item\n";
+    1c74:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 8d 35 20 24 00 00 	lea    0x2420(%rip),%rsi        # 409b <_IO_stdin_used+0x9b>
+    1c7b:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 8d 3d e7 43 00 00 	lea    0x43e7(%rip),%rdi        # 6069 <nel::log>
+    1c82:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   e8 c9 1e 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1c87:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 8d 35 8a 24 00 00 	lea    0x248a(%rip),%rsi        # 4118 <_IO_stdin_used+0x118>
+    1c8e:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 89 c7             	mov    %rax,%rdi
+    1c91:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   e8 ba 1e 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1c96:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   31 f6                	xor    %esi,%esi
+    1c98:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 89 c7             	mov    %rax,%rdi
+    1c9b:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   e8 70 1f 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    1ca0:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   be 2e 00 00 00       	mov    $0x2e,%esi
+    1ca5:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 89 c7             	mov    %rax,%rdi
+    1ca8:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   e8 83 1e 00 00       	call   3b30 <nel::operator<<(nel::Log&, char)>
+    1cad:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 8d 35 40 24 00 00 	lea    0x2440(%rip),%rsi        # 40f4 <_IO_stdin_used+0xf4>
+    1cb4:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 89 c7             	mov    %rax,%rdi
+    1cb7:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   e8 94 1e 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1cbc:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   31 f6                	xor    %esi,%esi
+    1cbe:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 89 c7             	mov    %rax,%rdi
+    1cc1:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   e8 4a 1f 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    1cc6:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 8d 35 37 23 00 00 	lea    0x2337(%rip),%rsi        # 4004 <_IO_stdin_used+0x4>
+    1ccd:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 89 c7             	mov    %rax,%rdi
+    1cd0:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   e8 7b 1e 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    for (int pat = 0; pat < 5; ++pat) {
+    1cd5:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  \--|-----|-> 48 83 04 24 01       	addq   $0x1,(%rsp)
+    1cda:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     |     |   48 8b 04 24          	mov    (%rsp),%rax
+    1cde:	|  |  |  |  |  |  |  |  |           |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     |     |   48 83 f8 05          	cmp    $0x5,%rax
+    1ce2:	|  |  |  |  |  |  |  |  |           \--|-----|--|--|--|--|--|--|--|--|--|--|--|--|-----|-----|-- 0f 85 68 f6 ff ff    	jne    1350 <main+0x1e0>
+    1ce8:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |  |  |  |  |  |     \-----|-- e9 50 fc ff ff       	jmp    193d <main+0x7cd>
+    1ced:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |  |  |  |  |  |           |   0f 1f 00             	nopl   (%rax)
+    for (Index i = 1; i < n; ++i) {
+    1cf0:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |  |  |  |  |  \-----------|-> 49 83 fd 01          	cmp    $0x1,%r13
+    1cf4:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |  |  |  |  |              \-- 0f 86 5a ff ff ff    	jbe    1c54 <main+0xae4>
+    1cfa:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |  |  |  |  |                  31 ff                	xor    %edi,%edi
+    1cfc:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |  |  |  |  |                  be 01 00 00 00       	mov    $0x1,%esi
+    1d01:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |  |  |  |  |              /-- eb 16                	jmp    1d19 <main+0xba9>
+    1d03:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |  |  |  |  |              |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    1d08:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |  |  |  |  |     /--------|-> 48 83 c6 01          	add    $0x1,%rsi
+    1d0c:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |  |  |  |  |     |        |   48 83 c7 04          	add    $0x4,%rdi
+    1d10:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |  |  |  |  |     |        |   49 39 f5             	cmp    %rsi,%r13
+    1d13:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |  \--|--|--|-----|--------|-- 0f 84 fc fa ff ff    	je     1815 <main+0x6a5>
+            return a < b;
+    1d19:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     |        \-> 41 8b 0c b4          	mov    (%r12,%rsi,4),%ecx
+    1d1d:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     |            48 89 f8             	mov    %rdi,%rax
+        if (!less(p[i], p[i - 1])) { continue; }
+    1d20:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     |            41 3b 0c 3c          	cmp    (%r12,%rdi,1),%ecx
+    1d24:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     +----------- 7d e2                	jge    1d08 <main+0xb98>
+            p[j] = move(p[j - 1]);
+    1d26:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     |  /-------> 41 8b 14 04          	mov    (%r12,%rax,1),%edx
+    1d2a:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     |  |         41 89 54 04 04       	mov    %edx,0x4(%r12,%rax,1)
+        } while (j > 0 && less(t, p[j - 1]));
+    1d2f:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     |  |         48 85 c0             	test   %rax,%rax
+    1d32:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     |  |     /-- 74 1c                	je     1d50 <main+0xbe0>
+    1d34:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     |  |     |   48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    1d38:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     |  |     |   41 3b 4c 04 fc       	cmp    -0x4(%r12,%rax,1),%ecx
+    1d3d:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     |  |  /--|-- 7c 21                	jl     1d60 <main+0xbf0>
+        p[j] = move(t);
+    1d3f:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     |  |  |  |   4c 01 e0             	add    %r12,%rax
+    1d42:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     |  |  |  |   89 08                	mov    %ecx,(%rax)
+    1d44:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     +--|--|--|-- eb c2                	jmp    1d08 <main+0xb98>
+    1d46:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     |  |  |  |   66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1d4d:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     |  |  |  |   00 00 00 
+    1d50:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     |  |  |  \-> 4c 89 e0             	mov    %r12,%rax
+    1d53:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     |  |  |      89 08                	mov    %ecx,(%rax)
+    1d55:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |     \--|--|----- eb b1                	jmp    1d08 <main+0xb98>
+    1d57:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |        |  |      66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    1d5e:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |        |  |      00 00 
+    1d60:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |        |  \----> 48 89 d0             	mov    %rdx,%rax
+    1d63:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |        \-------- eb c1                	jmp    1d26 <main+0xbb6>
+    1d65:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  |  |  |     |  |  |                  0f 1f 00             	nopl   (%rax)
+    for (Index i = 1; i < n; ++i) {
+    1d68:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |  \--|--|-----|--|--|----------------> 49 83 fd 01          	cmp    $0x1,%r13
+    1d6c:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |     |  |     |  |  |  /-------------- 0f 86 8d 00 00 00    	jbe    1dff <main+0xc8f>
+    1d72:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |     |  |     |  |  |  |               31 ff                	xor    %edi,%edi
+    1d74:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |     |  |     |  |  |  |               be 01 00 00 00       	mov    $0x1,%esi
+    1d79:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |     |  |     |  |  |  |           /-- eb 16                	jmp    1d91 <main+0xc21>
+    1d7b:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |     |  |     |  |  |  |           |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    1d80:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |     |  |     |  |  |  |  /--------|-> 48 83 c6 01          	add    $0x1,%rsi
+    1d84:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |     |  |     |  |  |  |  |        |   48 83 c7 04          	add    $0x4,%rdi
+    1d88:	|  |  |  |  |  |  |  |  |              |     |  |  |  |  |     |  |     |  |  |  |  |        |   49 39 f5             	cmp    %rsi,%r13
+    1d8b:	|  |  |  |  |  |  |  |  |              |     |  |  |  \--|-----|--|-----|--|--|--|--|--------|-- 0f 84 26 f9 ff ff    	je     16b7 <main+0x547>
+            return a < b;
+    1d91:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |  |        \-> 41 8b 0c b4          	mov    (%r12,%rsi,4),%ecx
+    1d95:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |  |            48 89 f8             	mov    %rdi,%rax
+        if (!less(p[i], p[i - 1])) { continue; }
+    1d98:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |  |            41 3b 0c 3c          	cmp    (%r12,%rdi,1),%ecx
+    1d9c:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |  +----------- 7d e2                	jge    1d80 <main+0xc10>
+            p[j] = move(p[j - 1]);
+    1d9e:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |  |  /-------> 41 8b 14 04          	mov    (%r12,%rax,1),%edx
+    1da2:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |  |  |         41 89 54 04 04       	mov    %edx,0x4(%r12,%rax,1)
+        } while (j > 0 && less(t, p[j - 1]));
+    1da7:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |  |  |         48 85 c0             	test   %rax,%rax
+    1daa:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |  |  |     /-- 74 14                	je     1dc0 <main+0xc50>
+    1dac:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |  |  |     |   48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    1db0:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |  |  |     |   41 3b 4c 04 fc       	cmp    -0x4(%r12,%rax,1),%ecx
+    1db5:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |  |  |  /--|-- 7c 19                	jl     1dd0 <main+0xc60>
+        p[j] = move(t);
+    1db7:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |  |  |  |  |   4c 01 e0             	add    %r12,%rax
+    1dba:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |  |  |  |  |   89 08                	mov    %ecx,(%rax)
+    1dbc:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |  +--|--|--|-- eb c2                	jmp    1d80 <main+0xc10>
+    1dbe:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |  |  |  |  |   66 90                	xchg   %ax,%ax
+    1dc0:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |  |  |  |  \-> 4c 89 e0             	mov    %r12,%rax
+    1dc3:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |  |  |  |      89 08                	mov    %ecx,(%rax)
+    1dc5:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |  \--|--|----- eb b9                	jmp    1d80 <main+0xc10>
+    1dc7:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |     |  |      66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    1dce:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |     |  |      00 00 
+    1dd0:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |     |  \----> 48 89 d0             	mov    %rdx,%rax
+    1dd3:	|  |  |  |  |  |  |  |  |              |     |  |  |     |     |  |     |  |  |  |     \-------- eb c9                	jmp    1d9e <main+0xc2e>
+    1dd5:	|  |  |  |  \--|--|--|--|--------------|-----|--|--|-----|-----|--|-----|--|--|--|-------------> 41 bf 20 a1 07 00    	mov    $0x7a120,%r15d
+    1ddb:	|  |  |  |     \--|--|--|--------------|-----|--|--|-----|-----|--|-----|--|--|--|-------------- e9 b7 f4 ff ff       	jmp    1297 <main+0x127>
+                sort::select_nth(ptr(), len(), k, less);
+    1de0:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |  |  \--|-------------> 4c 89 ee             	mov    %r13,%rsi
+    1de3:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |  |     |               ba e8 03 00 00       	mov    $0x3e8,%edx
+    1de8:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |  |     |               48 89 ef             	mov    %rbp,%rdi
+    1deb:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |  |     |               e8 90 0b 00 00       	call   2980 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]>
+void unstable(T p[], Length const n, F &less)
+    1df0:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |  |     |               4c 8b 44 24 20       	mov    0x20(%rsp),%r8
+    1df5:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |  |     |               be e8 03 00 00       	mov    $0x3e8,%esi
+    1dfa:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |  \-----|-------------- e9 f7 fb ff ff       	jmp    19f6 <main+0x886>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1dff:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |        \-------------> 48 89 de             	mov    %rbx,%rsi
+    1e02:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |                        bf 01 00 00 00       	mov    $0x1,%edi
+    1e07:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |                        e8 54 f2 ff ff       	call   1060 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1e0c:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |                        48 8b 44 24 60       	mov    0x60(%rsp),%rax
+    1e11:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |                        48 8b 4c 24 68       	mov    0x68(%rsp),%rcx
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1e16:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |                        4d 85 ed             	test   %r13,%r13
+    1e19:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           /----------- 0f 85 56 02 00 00    	jne    2075 <main+0xf05>
+             << "ns/item\n";
+    1e1f:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            48 8d 35 5b 22 00 00 	lea    0x225b(%rip),%rsi        # 4081 <_IO_stdin_used+0x81>
+    1e26:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            48 8d 3d 3c 42 00 00 	lea    0x423c(%rip),%rdi        # 6069 <nel::log>
+    1e2d:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            e8 1e 1d 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1e32:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            48 8d 35 df 22 00 00 	lea    0x22df(%rip),%rsi        # 4118 <_IO_stdin_used+0x118>
+    1e39:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            48 89 c7             	mov    %rax,%rdi
+    1e3c:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            e8 0f 1d 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1e41:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            31 f6                	xor    %esi,%esi
+    1e43:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            48 89 c7             	mov    %rax,%rdi
+    1e46:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            e8 c5 1d 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    1e4b:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            be 2e 00 00 00       	mov    $0x2e,%esi
+    1e50:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            48 89 c7             	mov    %rax,%rdi
+    1e53:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            e8 d8 1c 00 00       	call   3b30 <nel::operator<<(nel::Log&, char)>
+    1e58:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            48 8d 35 95 22 00 00 	lea    0x2295(%rip),%rsi        # 40f4 <_IO_stdin_used+0xf4>
+    1e5f:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            48 89 c7             	mov    %rax,%rdi
+    1e62:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            e8 e9 1c 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1e67:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            31 f6                	xor    %esi,%esi
+    1e69:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            48 89 c7             	mov    %rax,%rdi
+    1e6c:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            e8 9f 1d 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    1e71:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            48 8d 35 8c 21 00 00 	lea    0x218c(%rip),%rsi        # 4004 <_IO_stdin_used+0x4>
+    1e78:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            48 89 c7             	mov    %rax,%rdi
+    1e7b:	|  |  |  |        |  |  |              |     |  |  |     |     |  |     |           |            e8 d0 1c 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1e80:	|  |  |  |        |  |  |              |     |  |  |     \-----|--|-----|-----------|----------- e9 45 f9 ff ff       	jmp    17ca <main+0x65a>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1e85:	|  |  |  |        |  |  |              |     \--|--|-----------|--|-----|-----------|----------> 48 89 de             	mov    %rbx,%rsi
+    1e88:	|  |  |  |        |  |  |              |        |  |           |  |     |           |            bf 01 00 00 00       	mov    $0x1,%edi
+    1e8d:	|  |  |  |        |  |  |              |        |  |           |  |     |           |            e8 ce f1 ff ff       	call   1060 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1e92:	|  |  |  |        |  |  |              |        |  |           |  |     |           |            48 8b 44 24 60       	mov    0x60(%rsp),%rax
+    1e97:	|  |  |  |        |  |  |              |        |  |           |  |     |           |            48 8b 54 24 68       	mov    0x68(%rsp),%rdx
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1e9c:	|  |  |  |        |  |  |              |        |  |           |  |     |           |            4d 85 ed             	test   %r13,%r13
+    1e9f:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  /-------- 0f 85 b8 01 00 00    	jne    205d <main+0xeed>
+             << "ns/item\n";
+    1ea5:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         48 8d 35 bb 21 00 00 	lea    0x21bb(%rip),%rsi        # 4067 <_IO_stdin_used+0x67>
+    1eac:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         48 8d 3d b6 41 00 00 	lea    0x41b6(%rip),%rdi        # 6069 <nel::log>
+    1eb3:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         e8 98 1c 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1eb8:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         48 8d 35 59 22 00 00 	lea    0x2259(%rip),%rsi        # 4118 <_IO_stdin_used+0x118>
+    1ebf:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         48 89 c7             	mov    %rax,%rdi
+    1ec2:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         e8 89 1c 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1ec7:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         31 f6                	xor    %esi,%esi
+    1ec9:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         48 89 c7             	mov    %rax,%rdi
+    1ecc:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         e8 3f 1d 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    1ed1:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         be 2e 00 00 00       	mov    $0x2e,%esi
+    1ed6:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         48 89 c7             	mov    %rax,%rdi
+    1ed9:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         e8 52 1c 00 00       	call   3b30 <nel::operator<<(nel::Log&, char)>
+    1ede:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         48 8d 35 0f 22 00 00 	lea    0x220f(%rip),%rsi        # 40f4 <_IO_stdin_used+0xf4>
+    1ee5:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         48 89 c7             	mov    %rax,%rdi
+    1ee8:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         e8 63 1c 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1eed:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         31 f6                	xor    %esi,%esi
+    1eef:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         48 89 c7             	mov    %rax,%rdi
+    1ef2:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         e8 19 1d 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    1ef7:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         48 8d 35 06 21 00 00 	lea    0x2106(%rip),%rsi        # 4004 <_IO_stdin_used+0x4>
+    1efe:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         48 89 c7             	mov    %rax,%rdi
+    1f01:	|  |  |  |        |  |  |              |        |  |           |  |     |           |  |         e8 4a 1c 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1f06:	|  |  |  |        |  |  |              |        \--|-----------|--|-----|-----------|--|-------- e9 67 f7 ff ff       	jmp    1672 <main+0x502>
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1f0b:	|  |  |  |        \--|--|--------------|-----------|-----------|--|-----|-----------|--|-------> 4d 85 ed             	test   %r13,%r13
+    1f0e:	|  |  |  |           |  |              |           |           |  |     |           |  |  /----- 0f 85 3f 01 00 00    	jne    2053 <main+0xee3>
+             << "ns/item\n";
+    1f14:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      48 8d 35 23 21 00 00 	lea    0x2123(%rip),%rsi        # 403e <_IO_stdin_used+0x3e>
+    1f1b:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      48 8d 3d 47 41 00 00 	lea    0x4147(%rip),%rdi        # 6069 <nel::log>
+    1f22:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      e8 29 1c 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1f27:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      48 8d 35 ea 21 00 00 	lea    0x21ea(%rip),%rsi        # 4118 <_IO_stdin_used+0x118>
+    1f2e:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      48 89 c7             	mov    %rax,%rdi
+    1f31:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      e8 1a 1c 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1f36:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      31 f6                	xor    %esi,%esi
+    1f38:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      48 89 c7             	mov    %rax,%rdi
+    1f3b:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      e8 d0 1c 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    1f40:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      be 2e 00 00 00       	mov    $0x2e,%esi
+    1f45:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      48 89 c7             	mov    %rax,%rdi
+    1f48:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      e8 e3 1b 00 00       	call   3b30 <nel::operator<<(nel::Log&, char)>
+    1f4d:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      48 8d 35 a0 21 00 00 	lea    0x21a0(%rip),%rsi        # 40f4 <_IO_stdin_used+0xf4>
+    1f54:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      48 89 c7             	mov    %rax,%rdi
+    1f57:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      e8 f4 1b 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1f5c:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      31 f6                	xor    %esi,%esi
+    1f5e:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      48 89 c7             	mov    %rax,%rdi
+    1f61:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      e8 aa 1c 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    1f66:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      48 8d 35 97 20 00 00 	lea    0x2097(%rip),%rsi        # 4004 <_IO_stdin_used+0x4>
+    1f6d:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      48 89 c7             	mov    %rax,%rdi
+    1f70:	|  |  |  |           |  |              |           |           |  |     |           |  |  |      e8 db 1b 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    1f75:	|  |  |  |           |  \--------------|-----------|-----------|--|-----|-----------|--|--|----- e9 89 f5 ff ff       	jmp    1503 <main+0x393>
+            Node *new_n = realloc(nullptr, capacity);
+    1f7a:	|  \--|--|-----------|-----------------|-----------|-----------|--|-----|-----------|--|--|----> be 20 a1 07 00       	mov    $0x7a120,%esi
+    1f7f:	|     |  |           |                 |           |           |  |     |           |  |  |      31 ff                	xor    %edi,%edi
+    1f81:	|     |  |           |                 |           |           |  |     |           |  |  |      e8 5a 14 00 00       	call   33e0 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    1f86:	|     |  |           |                 |           |           |  |     |           |  |  |      49 89 c0             	mov    %rax,%r8
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    1f89:	|     |  |           |                 |           |           |  |     |           |  |  |      48 85 c0             	test   %rax,%rax
+    1f8c:	|     |  |           |                 |           |           |  |     |           |  |  |  /-- 74 06                	je     1f94 <main+0xe24>
+    1f8e:	|     |  |           |                 |           |           |  |     |           |  |  |  |   31 c0                	xor    %eax,%eax
+    1f90:	|     |  |           |                 |           |           |  |     |           |  |  |  |   49 89 40 08          	mov    %rax,0x8(%r8)
+                                    : std::realloc(p, new_size);
+    1f94:	|     |  |           |                 |           |           |  |     |           |  |  |  \-> bf 24 00 00 00       	mov    $0x24,%edi
+    1f99:	|     |  |           |                 |           |           |  |     |           |  |  |      4c 89 04 24          	mov    %r8,(%rsp)
+    1f9d:	|     |  |           |                 |           |           |  |     |           |  |  |      e8 fe f0 ff ff       	call   10a0 <malloc@plt>
+    1fa2:	|     |  |           |                 |           |           |  |     |           |  |  |      48 89 c3             	mov    %rax,%rbx
+            if (new_p == nullptr) {
+    1fa5:	|     |  |           |                 |           |           |  |     |           |  |  |      48 85 c0             	test   %rax,%rax
+    1fa8:	|     \--|-----------|-----------------|-----------|-----------|--|-----|-----------|--|--|----- 0f 84 6b f2 ff ff    	je     1219 <main+0xa9>
+            new_n->alloc_ = new_cap;
+    1fae:	|        |           |                 |           |           |  |     |           |  |  |      66 0f 6f 05 ca 21 00 	movdqa 0x21ca(%rip),%xmm0        # 4180 <_IO_stdin_used+0x180>
+    1fb5:	|        |           |                 |           |           |  |     |           |  |  |      00 
+    1fb6:	|        |           |                 |           |           |  |     |           |  |  |      4c 8b 04 24          	mov    (%rsp),%r8
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    1fba:	|        |           |                 |           |           |  |     |           |  |  |      c7 40 10 00 00 00 00 	movl   $0x0,0x10(%rax)
+    for (nel::Index i = 0; i < n_values; ++i) {
+    1fc1:	|        |           |                 |           |           |  |     |           |  |  |      41 be 3f 42 0f 00    	mov    $0xf423f,%r14d
+            new_n->alloc_ = new_cap;
+    1fc7:	|        |           |                 |           |           |  |     |           |  |  |      0f 11 00             	movups %xmm0,(%rax)
+            len_ += 1;
+    1fca:	|        |           |                 |           |           |  |     |           |  |  |      48 c7 40 08 01 00 00 	movq   $0x1,0x8(%rax)
+    1fd1:	|        |           |                 |           |           |  |     |           |  |  |      00 
+    1fd2:	\--------|-----------|-----------------|-----------|-----------|--|-----|-----------|--|--|----- e9 11 f2 ff ff       	jmp    11e8 <main+0x78>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1fd7:	         |           |                 |           |           \--|-----|-----------|--|--|----> 4c 8b 7c 24 10       	mov    0x10(%rsp),%r15
+    1fdc:	         |           |                 |           |              |     |           |  |  |      bf 01 00 00 00       	mov    $0x1,%edi
+    1fe1:	         |           |                 |           |              |     |           |  |  |      4c 89 fe             	mov    %r15,%rsi
+    1fe4:	         |           |                 |           |              |     |           |  |  |      e8 77 f0 ff ff       	call   1060 <clock_gettime@plt>
+    1fe9:	         |           |                 |           |              |     |           |  |  |      4c 89 fe             	mov    %r15,%rsi
+    1fec:	         |           |                 |           |              |     |           |  |  |      bf 01 00 00 00       	mov    $0x1,%edi
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1ff1:	         |           |                 |           |              |     |           |  |  |      48 69 5c 24 60 00 ca 	imul   $0x3b9aca00,0x60(%rsp),%rbx
+    1ff8:	         |           |                 |           |              |     |           |  |  |      9a 3b 
+    1ffa:	         |           |                 |           |              |     |           |  |  |      48 03 5c 24 68       	add    0x68(%rsp),%rbx
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1fff:	         |           |                 |           |              |     |           |  |  |      e8 5c f0 ff ff       	call   1060 <clock_gettime@plt>
+        bench::report_per_item("random, partial_sort 1000", t, s.len());
+    2004:	         |           |                 |           |              |     |           |  |  |      31 d2                	xor    %edx,%edx
+    2006:	         |           |                 |           |              |     |           |  |  |      48 8d 3d cf 20 00 00 	lea    0x20cf(%rip),%rdi        # 40dc <_IO_stdin_used+0xdc>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    200d:	         |           |                 |           |              |     |           |  |  |      48 69 74 24 60 00 ca 	imul   $0x3b9aca00,0x60(%rsp),%rsi
+    2014:	         |           |                 |           |              |     |           |  |  |      9a 3b 
+    2016:	         |           |                 |           |              |     |           |  |  |      48 03 74 24 68       	add    0x68(%rsp),%rsi
+    return now_ns() - b;
+    201b:	         |           |                 |           |              |     |           |  |  |      48 29 de             	sub    %rbx,%rsi
+    201e:	         |           |                 |           |              |     |           |  |  |      e8 9d 12 00 00       	call   32c0 <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    2023:	         |           |                 |           |              |     |           |  |  |      4c 89 fe             	mov    %r15,%rsi
+    2026:	         |           |                 |           |              |     |           |  |  |      bf 01 00 00 00       	mov    $0x1,%edi
+    202b:	         |           |                 |           |              |     |           |  |  |      e8 30 f0 ff ff       	call   1060 <clock_gettime@plt>
+            : fn_name_(fn_name)
+    2030:	         |           |                 |           |              |     |           |  |  |      66 0f 6f 34 24       	movdqa (%rsp),%xmm6
+            , line_num_(line_num)
+    2035:	         |           |                 |           |              |     |           |  |  |      c7 44 24 70 9f 02 00 	movl   $0x29f,0x70(%rsp)
+    203c:	         |           |                 |           |              |     |           |  |  |      00 
+            : fn_name_(fn_name)
+    203d:	         |           |                 |           |              |     |           |  |  |      0f 29 74 24 60       	movaps %xmm6,0x60(%rsp)
+    if (!pred) { panic(msg, ctx); }
+    2042:	         |           |                 |           |              |     |           |  |  |  /-> 48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    2047:	         |           |                 |           |              |     |           |  |  |  |   48 8d 3d fa 20 00 00 	lea    0x20fa(%rip),%rdi        # 4148 <_IO_stdin_used+0x148>
+    204e:	         |           |                 |           |              |     |           |  |  |  |   e8 af f0 ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+    bool sorted = true;
+    2053:	         |           |                 |           |              |     |           |  |  \--|-> b9 01 00 00 00       	mov    $0x1,%ecx
+    2058:	         \-----------|-----------------|-----------|--------------|-----|-----------|--|-----|-- e9 bc f3 ff ff       	jmp    1419 <main+0x2a9>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    205d:	                     |                 |           |              |     |           |  \-----|-> 48 69 c0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rax
+    2064:	                     |                 |           |              |     |           |        |   48 01 d0             	add    %rdx,%rax
+    return now_ns() - b;
+    2067:	                     |                 |           |              |     |           |        |   4c 29 f8             	sub    %r15,%rax
+    206a:	                     |                 |           |              |     |           |        |   41 bf 01 00 00 00    	mov    $0x1,%r15d
+    2070:	                     \-----------------|-----------|--------------|-----|-----------|--------|-- e9 2e f5 ff ff       	jmp    15a3 <main+0x433>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2075:	                                       |           |              |     |           \--------|-> 48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    return now_ns() - b;
+    207c:	                                       |           |              |     |                    |   bd 01 00 00 00       	mov    $0x1,%ebp
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2081:	                                       |           |              |     |                    |   48 01 ca             	add    %rcx,%rdx
+    return now_ns() - b;
+    2084:	                                       |           |              |     |                    |   4c 29 fa             	sub    %r15,%rdx
+    2087:	                                       \-----------|--------------|-----|--------------------|-- e9 6f f6 ff ff       	jmp    16fb <main+0x58b>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    208c:	                                                   |              |     \--------------------|-> 48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    return now_ns() - b;
+    2093:	                                                   |              |                          |   bd 01 00 00 00       	mov    $0x1,%ebp
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    2098:	                                                   |              |                          |   48 01 ca             	add    %rcx,%rdx
+    return now_ns() - b;
+    209b:	                                                   |              |                          |   4c 29 f2             	sub    %r14,%rdx
+    209e:	                                                   \--------------|--------------------------|-- e9 b8 f7 ff ff       	jmp    185b <main+0x6eb>
+            , line_num_(line_num)
+    20a3:	                                                                  \--------------------------|-> c7 44 24 70 9f 02 00 	movl   $0x29f,0x70(%rsp)
+    20aa:	                                                                                             |   00 
+    20ab:	                                                                                             \-- eb 95                	jmp    2042 <main+0xed2>
+    20ad:	                                                                                                 0f 1f 00             	nopl   (%rax)
+
+00000000000020b0 <_start>:
+    20b0:	31 ed                	xor    %ebp,%ebp
+    20b2:	49 89 d1             	mov    %rdx,%r9
+    20b5:	5e                   	pop    %rsi
+    20b6:	48 89 e2             	mov    %rsp,%rdx
+    20b9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    20bd:	50                   	push   %rax
+    20be:	54                   	push   %rsp
+    20bf:	45 31 c0             	xor    %r8d,%r8d
+    20c2:	31 c9                	xor    %ecx,%ecx
+    20c4:	48 8d 3d a5 f0 ff ff 	lea    -0xf5b(%rip),%rdi        # 1170 <main>
+    20cb:	ff 15 d7 3e 00 00    	call   *0x3ed7(%rip)        # 5fa8 <__libc_start_main@GLIBC_2.34>
+    20d1:	f4                   	hlt
+    20d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    20d9:	00 00 00 
+    20dc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000020e0 <deregister_tm_clones>:
+    20e0:	    48 8d 3d 71 3f 00 00 	lea    0x3f71(%rip),%rdi        # 6058 <__TMC_END__>
+    20e7:	    48 8d 05 6a 3f 00 00 	lea    0x3f6a(%rip),%rax        # 6058 <__TMC_END__>
+    20ee:	    48 39 f8             	cmp    %rdi,%rax
+    20f1:	/-- 74 15                	je     2108 <deregister_tm_clones+0x28>
+    20f3:	|   48 8b 05 b6 3e 00 00 	mov    0x3eb6(%rip),%rax        # 5fb0 <_ITM_deregisterTMCloneTable@Base>
+    20fa:	|   48 85 c0             	test   %rax,%rax
+    20fd:	+-- 74 09                	je     2108 <deregister_tm_clones+0x28>
+    20ff:	|   ff e0                	jmp    *%rax
+    2101:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    2108:	\-> c3                   	ret
+    2109:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002110 <register_tm_clones>:
+    2110:	    48 8d 3d 41 3f 00 00 	lea    0x3f41(%rip),%rdi        # 6058 <__TMC_END__>
+    2117:	    48 8d 35 3a 3f 00 00 	lea    0x3f3a(%rip),%rsi        # 6058 <__TMC_END__>
+    211e:	    48 29 fe             	sub    %rdi,%rsi
+    2121:	    48 89 f0             	mov    %rsi,%rax
+    2124:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    2128:	    48 c1 f8 03          	sar    $0x3,%rax
+    212c:	    48 01 c6             	add    %rax,%rsi
+    212f:	    48 d1 fe             	sar    %rsi
+    2132:	/-- 74 14                	je     2148 <register_tm_clones+0x38>
+    2134:	|   48 8b 05 85 3e 00 00 	mov    0x3e85(%rip),%rax        # 5fc0 <_ITM_registerTMCloneTable@Base>
+    213b:	|   48 85 c0             	test   %rax,%rax
+    213e:	+-- 74 08                	je     2148 <register_tm_clones+0x38>
+    2140:	|   ff e0                	jmp    *%rax
+    2142:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    2148:	\-> c3                   	ret
+    2149:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002150 <__do_global_dtors_aux>:
+    2150:	       f3 0f 1e fa          	endbr64
+    2154:	       80 3d 0d 3f 00 00 00 	cmpb   $0x0,0x3f0d(%rip)        # 6068 <completed.0>
+    215b:	/----- 75 2b                	jne    2188 <__do_global_dtors_aux+0x38>
+    215d:	|      55                   	push   %rbp
+    215e:	|      48 83 3d 62 3e 00 00 	cmpq   $0x0,0x3e62(%rip)        # 5fc8 <__cxa_finalize@GLIBC_2.2.5>
+    2165:	|      00 
+    2166:	|      48 89 e5             	mov    %rsp,%rbp
+    2169:	|  /-- 74 0c                	je     2177 <__do_global_dtors_aux+0x27>
+    216b:	|  |   48 8b 3d de 3e 00 00 	mov    0x3ede(%rip),%rdi        # 6050 <__dso_handle>
+    2172:	|  |   e8 49 ef ff ff       	call   10c0 <__cxa_finalize@plt>
+    2177:	|  \-> e8 64 ff ff ff       	call   20e0 <deregister_tm_clones>
+    217c:	|      c6 05 e5 3e 00 00 01 	movb   $0x1,0x3ee5(%rip)        # 6068 <completed.0>
+    2183:	|      5d                   	pop    %rbp
+    2184:	|      c3                   	ret
+    2185:	|      0f 1f 00             	nopl   (%rax)
+    2188:	\----> c3                   	ret
+    2189:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002190 <frame_dummy>:
+    2190:	f3 0f 1e fa          	endbr64
+    2194:	e9 77 ff ff ff       	jmp    2110 <register_tm_clones>
+    2199:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000021a0 <cmp_int(void const*, void const*)>:
+    return (x > y) - (x < y);
+    21a0:	8b 06                	mov    (%rsi),%eax
+    21a2:	39 07                	cmp    %eax,(%rdi)
+    21a4:	0f 9f c0             	setg   %al
+    21a7:	0f 9c c2             	setl   %dl
+    21aa:	0f b6 d2             	movzbl %dl,%edx
+    21ad:	0f b6 c0             	movzbl %al,%eax
+    21b0:	29 d0                	sub    %edx,%eax
+}
+    21b2:	c3                   	ret
+    21b3:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    21ba:	00 00 00 00 
+    21be:	66 90                	xchg   %ax,%ax
+
+00000000000021c0 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>:
+    Count moved = 0;
+    21c0:	             31 d2                	xor    %edx,%edx
+    for (Index i = 1; i < n; ++i) {
+    21c2:	             b9 01 00 00 00       	mov    $0x1,%ecx
+    21c7:	             48 83 fe 01          	cmp    $0x1,%rsi
+    21cb:	         /-- 77 0c                	ja     21d9 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x19>
+    21cd:	/--------|-- eb 51                	jmp    2220 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x60>
+    21cf:	|        |   90                   	nop
+    21d0:	|  /-----|-> 48 83 c1 01          	add    $0x1,%rcx
+    21d4:	|  |     |   48 39 f1             	cmp    %rsi,%rcx
+    21d7:	+--|-----|-- 74 47                	je     2220 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x60>
+            return a < b;
+    21d9:	|  |     \-> 44 8b 0c 8f          	mov    (%rdi,%rcx,4),%r9d
+        if (!less(p[i], p[i - 1])) { continue; }
+    21dd:	|  |         44 3b 4c 8f fc       	cmp    -0x4(%rdi,%rcx,4),%r9d
+    21e2:	|  +-------- 7d ec                	jge    21d0 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x10>
+    21e4:	|  |         48 89 c8             	mov    %rcx,%rax
+            p[j] = move(p[j - 1]);
+    21e7:	|  |     /-> 44 8b 44 87 fc       	mov    -0x4(%rdi,%rax,4),%r8d
+    21ec:	|  |     |   44 89 04 87          	mov    %r8d,(%rdi,%rax,4)
+        } while (j > 0 && less(t, p[j - 1]));
+    21f0:	|  |     |   48 83 e8 01          	sub    $0x1,%rax
+    21f4:	|  |  /--|-- 74 22                	je     2218 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x58>
+    21f6:	|  |  |  |   44 3b 4c 87 fc       	cmp    -0x4(%rdi,%rax,4),%r9d
+    21fb:	|  |  |  \-- 7c ea                	jl     21e7 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x27>
+        p[j] = move(t);
+    21fd:	|  |  |      4c 8d 04 87          	lea    (%rdi,%rax,4),%r8
+    2201:	|  |  |  /-> 48 01 ca             	add    %rcx,%rdx
+    2204:	|  |  |  |   45 89 08             	mov    %r9d,(%r8)
+        moved += i - j;
+    2207:	|  |  |  |   48 29 c2             	sub    %rax,%rdx
+        if (moved > 8) { return false; }
+    220a:	|  |  |  |   48 83 fa 08          	cmp    $0x8,%rdx
+    220e:	|  \--|--|-- 76 c0                	jbe    21d0 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x10>
+    2210:	|     |  |   31 c0                	xor    %eax,%eax
+}
+    2212:	|     |  |   c3                   	ret
+    2213:	|     |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    2218:	|     \--|-> 49 89 f8             	mov    %rdi,%r8
+    221b:	|        \-- eb e4                	jmp    2201 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x41>
+    221d:	|            0f 1f 00             	nopl   (%rax)
+    return true;
+    2220:	\----------> b8 01 00 00 00       	mov    $0x1,%eax
+    2225:	             c3                   	ret
+    2226:	             66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    222d:	             00 00 00 
+
+0000000000002230 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>:
+    for (Index i = n / 2; i > 0; --i) {
+    2230:	                         48 89 f2             	mov    %rsi,%rdx
+    2233:	                         48 d1 ea             	shr    %rdx
+    2236:	/----------------------- 0f 84 1b 01 00 00    	je     2357 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x127>
+void heap(T p[], Length const n, F &less)
+    223c:	|                        41 54                	push   %r12
+    223e:	|                        48 89 f8             	mov    %rdi,%rax
+    2241:	|                        49 89 f3             	mov    %rsi,%r11
+    2244:	|                        4c 8d 64 12 ff       	lea    -0x1(%rdx,%rdx,1),%r12
+    2249:	|                        55                   	push   %rbp
+    224a:	|                        48 8d 6a ff          	lea    -0x1(%rdx),%rbp
+    224e:	|                        53                   	push   %rbx
+    224f:	|                        90                   	nop
+        if (c >= n) { break; }
+    2250:	|     /----------------> 4d 39 dc             	cmp    %r11,%r12
+    2253:	|     |  /-------------- 73 5d                	jae    22b2 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x82>
+            return a < b;
+    2255:	|     |  |               44 8b 14 a8          	mov    (%rax,%rbp,4),%r10d
+        Index c = 2 * i + 1;
+    2259:	|     |  |               4c 89 e1             	mov    %r12,%rcx
+            return a < b;
+    225c:	|     |  |               49 89 e8             	mov    %rbp,%r8
+    225f:	|     |  |        /----- eb 32                	jmp    2293 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x63>
+    2261:	|     |  |        |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        if (c + 1 < n && less(p[c], p[c + 1])) { c += 1; }
+    2268:	|     |  |  /-----|----> 4e 8d 0c c8          	lea    (%rax,%r9,8),%r9
+            return a < b;
+    226c:	|     |  |  |     |      41 8b 19             	mov    (%r9),%ebx
+        if (c + 1 < n && less(p[c], p[c + 1])) { c += 1; }
+    226f:	|     |  |  |     |      39 f3                	cmp    %esi,%ebx
+    2271:	|     |  |  |  /--|----- 7e 33                	jle    22a6 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x76>
+    2273:	|     |  |  |  |  |      89 de                	mov    %ebx,%esi
+    2275:	|     |  |  |  |  |      4c 89 cf             	mov    %r9,%rdi
+        if (!less(p[i], p[c])) { break; }
+    2278:	|     |  |  |  |  |      4a 8d 0c 80          	lea    (%rax,%r8,4),%rcx
+    227c:	|     |  |  |  |  |      41 39 f2             	cmp    %esi,%r10d
+    227f:	|     |  +--|--|--|----- 7d 31                	jge    22b2 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x82>
+ */
+template<typename T>
+constexpr void swap(T &a, T &b)
+{
+    T t = move(a);
+    a = move(b);
+    2281:	|     |  |  |  |  |  /-> 89 31                	mov    %esi,(%rcx)
+        Index c = 2 * i + 1;
+    2283:	|     |  |  |  |  |  |   48 8d 4c 12 01       	lea    0x1(%rdx,%rdx,1),%rcx
+    b = move(t);
+    2288:	|     |  |  |  |  |  |   44 89 17             	mov    %r10d,(%rdi)
+        if (c >= n) { break; }
+    228b:	|     |  |  |  |  |  |   4c 39 d9             	cmp    %r11,%rcx
+    228e:	|     |  +--|--|--|--|-- 73 22                	jae    22b2 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x82>
+        i = c;
+    2290:	|     |  |  |  |  |  |   49 89 d0             	mov    %rdx,%r8
+    2293:	|     |  |  |  |  \--|-> 4d 8d 48 01          	lea    0x1(%r8),%r9
+        if (c + 1 < n && less(p[c], p[c + 1])) { c += 1; }
+    2297:	|     |  |  |  |     |   48 8d 3c 88          	lea    (%rax,%rcx,4),%rdi
+    229b:	|     |  |  |  |     |   4b 8d 14 09          	lea    (%r9,%r9,1),%rdx
+            return a < b;
+    229f:	|     |  |  |  |     |   8b 37                	mov    (%rdi),%esi
+        if (c + 1 < n && less(p[c], p[c + 1])) { c += 1; }
+    22a1:	|     |  |  |  |     |   4c 39 da             	cmp    %r11,%rdx
+    22a4:	|     |  |  \--|-----|-- 72 c2                	jb     2268 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x38>
+    22a6:	|     |  |     \-----|-> 48 89 ca             	mov    %rcx,%rdx
+        if (!less(p[i], p[c])) { break; }
+    22a9:	|     |  |           |   4a 8d 0c 80          	lea    (%rax,%r8,4),%rcx
+    22ad:	|     |  |           |   41 39 f2             	cmp    %esi,%r10d
+    22b0:	|     |  |           \-- 7c cf                	jl     2281 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x51>
+    for (Index i = n / 2; i > 0; --i) {
+    22b2:	|     |  \-------------> 49 83 ec 02          	sub    $0x2,%r12
+    22b6:	|     |                  48 85 ed             	test   %rbp,%rbp
+    22b9:	|     |              /-- 74 0d                	je     22c8 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x98>
+    22bb:	|     |              |   48 83 ed 01          	sub    $0x1,%rbp
+    22bf:	|     \--------------|-- eb 8f                	jmp    2250 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x20>
+    22c1:	|                    |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        swap(p[0], p[e - 1]);
+    22c8:	|                    \-> 4a 8d 54 98 fc       	lea    -0x4(%rax,%r11,4),%rdx
+    T t = move(a);
+    22cd:	|                        8b 08                	mov    (%rax),%ecx
+        sift_down(p, 0, e - 1, less);
+    22cf:	|                        4d 8d 53 ff          	lea    -0x1(%r11),%r10
+    a = move(b);
+    22d3:	|                        8b 32                	mov    (%rdx),%esi
+    22d5:	|                        89 30                	mov    %esi,(%rax)
+    b = move(t);
+    22d7:	|                        89 0a                	mov    %ecx,(%rdx)
+        if (c >= n) { break; }
+    22d9:	|                        49 83 fb 02          	cmp    $0x2,%r11
+    22dd:	|  /-------------------- 74 73                	je     2352 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x122>
+    22df:	|  |                     90                   	nop
+            return a < b;
+    22e0:	|  |  /----------------> 44 8b 18             	mov    (%rax),%r11d
+    22e3:	|  |  |                  45 31 c0             	xor    %r8d,%r8d
+        Index c = 2 * i + 1;
+    22e6:	|  |  |                  b9 01 00 00 00       	mov    $0x1,%ecx
+    22eb:	|  |  |           /----- eb 2e                	jmp    231b <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0xeb>
+    22ed:	|  |  |           |      0f 1f 00             	nopl   (%rax)
+        if (c + 1 < n && less(p[c], p[c + 1])) { c += 1; }
+    22f0:	|  |  |  /--------|----> 4e 8d 0c c8          	lea    (%rax,%r9,8),%r9
+            return a < b;
+    22f4:	|  |  |  |        |      41 8b 19             	mov    (%r9),%ebx
+        if (c + 1 < n && less(p[c], p[c + 1])) { c += 1; }
+    22f7:	|  |  |  |        |      39 f3                	cmp    %esi,%ebx
+    22f9:	|  |  |  |  /-----|----- 7e 33                	jle    232e <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0xfe>
+    22fb:	|  |  |  |  |     |      89 de                	mov    %ebx,%esi
+    22fd:	|  |  |  |  |     |      4c 89 cf             	mov    %r9,%rdi
+        if (!less(p[i], p[c])) { break; }
+    2300:	|  |  |  |  |     |      4a 8d 0c 80          	lea    (%rax,%r8,4),%rcx
+    2304:	|  |  |  |  |     |      41 39 f3             	cmp    %esi,%r11d
+    2307:	|  |  |  |  |  /--|----- 7d 31                	jge    233a <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x10a>
+    a = move(b);
+    2309:	|  |  |  |  |  |  |  /-> 89 31                	mov    %esi,(%rcx)
+        Index c = 2 * i + 1;
+    230b:	|  |  |  |  |  |  |  |   48 8d 4c 12 01       	lea    0x1(%rdx,%rdx,1),%rcx
+    b = move(t);
+    2310:	|  |  |  |  |  |  |  |   44 89 1f             	mov    %r11d,(%rdi)
+        if (c >= n) { break; }
+    2313:	|  |  |  |  |  |  |  |   4c 39 d1             	cmp    %r10,%rcx
+    2316:	|  |  |  |  |  +--|--|-- 73 22                	jae    233a <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x10a>
+        i = c;
+    2318:	|  |  |  |  |  |  |  |   49 89 d0             	mov    %rdx,%r8
+    231b:	|  |  |  |  |  |  \--|-> 4d 8d 48 01          	lea    0x1(%r8),%r9
+        if (c + 1 < n && less(p[c], p[c + 1])) { c += 1; }
+    231f:	|  |  |  |  |  |     |   48 8d 3c 88          	lea    (%rax,%rcx,4),%rdi
+    2323:	|  |  |  |  |  |     |   4b 8d 14 09          	lea    (%r9,%r9,1),%rdx
+            return a < b;
+    2327:	|  |  |  |  |  |     |   8b 37                	mov    (%rdi),%esi
+        if (c + 1 < n && less(p[c], p[c + 1])) { c += 1; }
+    2329:	|  |  |  |  |  |     |   4c 39 d2             	cmp    %r10,%rdx
+    232c:	|  |  |  \--|--|-----|-- 72 c2                	jb     22f0 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0xc0>
+    232e:	|  |  |     \--|-----|-> 48 89 ca             	mov    %rcx,%rdx
+        if (!less(p[i], p[c])) { break; }
+    2331:	|  |  |        |     |   4a 8d 0c 80          	lea    (%rax,%r8,4),%rcx
+    2335:	|  |  |        |     |   41 39 f3             	cmp    %esi,%r11d
+    2338:	|  |  |        |     \-- 7c cf                	jl     2309 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0xd9>
+    a = move(b);
+    233a:	|  |  |        \-------> 42 8b 4c 90 fc       	mov    -0x4(%rax,%r10,4),%ecx
+    T t = move(a);
+    233f:	|  |  |                  8b 10                	mov    (%rax),%edx
+    a = move(b);
+    2341:	|  |  |                  89 08                	mov    %ecx,(%rax)
+    b = move(t);
+    2343:	|  |  |                  42 89 54 90 fc       	mov    %edx,-0x4(%rax,%r10,4)
+        sift_down(p, 0, e - 1, less);
+    2348:	|  |  |                  49 83 ea 01          	sub    $0x1,%r10
+        if (c >= n) { break; }
+    234c:	|  |  |                  49 83 fa 01          	cmp    $0x1,%r10
+    2350:	|  |  \----------------- 75 8e                	jne    22e0 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0xb0>
+}
+    2352:	|  \-------------------> 5b                   	pop    %rbx
+    2353:	|                        5d                   	pop    %rbp
+    2354:	|                        41 5c                	pop    %r12
+    2356:	|                        c3                   	ret
+    2357:	\----------------------> c3                   	ret
+    2358:	                         0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    235f:	                         00 
+
+0000000000002360 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]>:
+    T pivot = move(p[0]);
+    2360:	                44 8b 07             	mov    (%rdi),%r8d
+    Index first = 0;
+    2363:	                31 c0                	xor    %eax,%eax
+    2365:	                0f 1f 00             	nopl   (%rax)
+    2368:	            /-> 49 89 c1             	mov    %rax,%r9
+        first += 1;
+    236b:	            |   48 83 c0 01          	add    $0x1,%rax
+            return a < b;
+    236f:	            |   8b 0c 87             	mov    (%rdi,%rax,4),%ecx
+    } while (less(p[first], pivot));
+    2372:	            |   41 39 c8             	cmp    %ecx,%r8d
+    2375:	            \-- 7f f1                	jg     2368 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x8>
+    if (first == 1) {
+    2377:	                48 83 f8 01          	cmp    $0x1,%rax
+    237b:	/-------------- 74 5d                	je     23da <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x7a>
+    237d:	|               0f 1f 00             	nopl   (%rax)
+            last -= 1;
+    2380:	|           /-> 48 83 ee 01          	sub    $0x1,%rsi
+        } while (!less(p[last], pivot));
+    2384:	|           |   44 3b 04 b7          	cmp    (%rdi,%rsi,4),%r8d
+    2388:	|           \-- 7e f6                	jle    2380 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x20>
+    already = first >= last;
+    238a:	|  /----------> 48 39 f0             	cmp    %rsi,%rax
+    238d:	|  |            0f 93 02             	setae  (%rdx)
+    while (first < last) {
+    2390:	|  |  /-------- 73 2f                	jae    23c1 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x61>
+    a = move(b);
+    2392:	|  |  |         8b 14 b7             	mov    (%rdi,%rsi,4),%edx
+    2395:	|  |  |         0f 1f 00             	nopl   (%rax)
+    2398:	|  |  |  /----> 89 14 87             	mov    %edx,(%rdi,%rax,4)
+    b = move(t);
+    239b:	|  |  |  |      89 0c b7             	mov    %ecx,(%rdi,%rsi,4)
+    239e:	|  |  |  |      66 90                	xchg   %ax,%ax
+    23a0:	|  |  |  |  /-> 49 89 c1             	mov    %rax,%r9
+            first += 1;
+    23a3:	|  |  |  |  |   48 83 c0 01          	add    $0x1,%rax
+            return a < b;
+    23a7:	|  |  |  |  |   8b 0c 87             	mov    (%rdi,%rax,4),%ecx
+        } while (less(p[first], pivot));
+    23aa:	|  |  |  |  |   41 39 c8             	cmp    %ecx,%r8d
+    23ad:	|  |  |  |  \-- 7f f1                	jg     23a0 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x40>
+    23af:	|  |  |  |      90                   	nop
+            last -= 1;
+    23b0:	|  |  |  |  /-> 48 83 ee 01          	sub    $0x1,%rsi
+            return a < b;
+    23b4:	|  |  |  |  |   8b 14 b7             	mov    (%rdi,%rsi,4),%edx
+        } while (!less(p[last], pivot));
+    23b7:	|  |  |  |  |   41 39 d0             	cmp    %edx,%r8d
+    23ba:	|  |  |  |  \-- 7e f4                	jle    23b0 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x50>
+    while (first < last) {
+    23bc:	|  |  |  |      48 39 f0             	cmp    %rsi,%rax
+    23bf:	|  |  |  \----- 72 d7                	jb     2398 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x38>
+    p[0] = move(p[pos]);
+    23c1:	|  |  \-------> 4a 8d 04 8f          	lea    (%rdi,%r9,4),%rax
+    23c5:	|  |            8b 10                	mov    (%rax),%edx
+    23c7:	|  |            89 17                	mov    %edx,(%rdi)
+    p[pos] = move(pivot);
+    23c9:	|  |            44 89 00             	mov    %r8d,(%rax)
+}
+    23cc:	|  |            4c 89 c8             	mov    %r9,%rax
+    23cf:	|  |            c3                   	ret
+            last -= 1;
+    23d0:	|  |        /-> 48 83 ee 01          	sub    $0x1,%rsi
+            if (less(p[last], pivot)) { break; }
+    23d4:	|  |        |   44 3b 04 b7          	cmp    (%rdi,%rsi,4),%r8d
+    23d8:	|  \--------|-- 7f b0                	jg     238a <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x2a>
+        while (first < last) {
+    23da:	\-----------|-> 48 83 fe 01          	cmp    $0x1,%rsi
+    23de:	            \-- 77 f0                	ja     23d0 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x70>
+    p[0] = move(p[pos]);
+    23e0:	                4a 8d 04 8f          	lea    (%rdi,%r9,4),%rax
+    already = first >= last;
+    23e4:	                c6 02 01             	movb   $0x1,(%rdx)
+    p[0] = move(p[pos]);
+    23e7:	                8b 10                	mov    (%rax),%edx
+    23e9:	                89 17                	mov    %edx,(%rdi)
+    p[pos] = move(pivot);
+    23eb:	                44 89 00             	mov    %r8d,(%rax)
+}
+    23ee:	                4c 89 c8             	mov    %r9,%rax
+    23f1:	                c3                   	ret
+    23f2:	                66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    23f9:	                00 00 00 00 
+    23fd:	                0f 1f 00             	nopl   (%rax)
+
+0000000000002400 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>:
+    T pivot = move(p[0]);
+    2400:	                   44 8b 0f             	mov    (%rdi),%r9d
+Index partition_left(T p[], Length const n, F &less)
+    2403:	                   48 89 f1             	mov    %rsi,%rcx
+    2406:	                   48 8d 44 b7 fc       	lea    -0x4(%rdi,%rsi,4),%rax
+    Index last = n;
+    240b:	                   49 89 f2             	mov    %rsi,%r10
+    240e:	                   66 90                	xchg   %ax,%ax
+    } while (less(pivot, p[last]));
+    2410:	               /-> 48 89 c6             	mov    %rax,%rsi
+            return a < b;
+    2413:	               |   44 8b 00             	mov    (%rax),%r8d
+    2416:	               |   4c 89 d2             	mov    %r10,%rdx
+    } while (less(pivot, p[last]));
+    2419:	               |   48 8d 40 fc          	lea    -0x4(%rax),%rax
+        last -= 1;
+    241d:	               |   49 83 ea 01          	sub    $0x1,%r10
+    } while (less(pivot, p[last]));
+    2421:	               |   45 39 c1             	cmp    %r8d,%r9d
+    2424:	               \-- 7c ea                	jl     2410 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x10>
+    if (last + 1 == n) {
+    2426:	                   48 39 ca             	cmp    %rcx,%rdx
+    Index first = 0;
+    2429:	                   ba 00 00 00 00       	mov    $0x0,%edx
+    if (last + 1 == n) {
+    242e:	/----------------- 74 7a                	je     24aa <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0xaa>
+            first += 1;
+    2430:	|              /-> 48 83 c2 01          	add    $0x1,%rdx
+        } while (!less(pivot, p[first]));
+    2434:	|              |   44 3b 0c 97          	cmp    (%rdi,%rdx,4),%r9d
+    2438:	|              \-- 7d f6                	jge    2430 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x30>
+    while (first < last) {
+    243a:	|  /-------------> 4c 39 d2             	cmp    %r10,%rdx
+    243d:	|  |  /----------- 73 52                	jae    2491 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x91>
+    T t = move(a);
+    243f:	|  |  |            8b 04 97             	mov    (%rdi,%rdx,4),%eax
+    2442:	|  |  |            66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+constexpr void swap(T &a, T &b)
+    2448:	|  |  |  /-------> 49 8d 4a ff          	lea    -0x1(%r10),%rcx
+    a = move(b);
+    244c:	|  |  |  |         44 89 04 97          	mov    %r8d,(%rdi,%rdx,4)
+    b = move(t);
+    2450:	|  |  |  |         42 89 04 97          	mov    %eax,(%rdi,%r10,4)
+    2454:	|  |  |  |         48 8d 04 8f          	lea    (%rdi,%rcx,4),%rax
+}
+    2458:	|  |  |  |     /-- eb 0a                	jmp    2464 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x64>
+    245a:	|  |  |  |     |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    2460:	|  |  |  |  /--|-> 48 83 e9 01          	sub    $0x1,%rcx
+    2464:	|  |  |  |  |  \-> 48 89 c6             	mov    %rax,%rsi
+            return a < b;
+    2467:	|  |  |  |  |      44 8b 00             	mov    (%rax),%r8d
+        } while (less(pivot, p[last]));
+    246a:	|  |  |  |  |      48 83 e8 04          	sub    $0x4,%rax
+            last -= 1;
+    246e:	|  |  |  |  |      49 89 ca             	mov    %rcx,%r10
+        } while (less(pivot, p[last]));
+    2471:	|  |  |  |  |      45 39 c1             	cmp    %r8d,%r9d
+    2474:	|  |  |  |  \----- 7c ea                	jl     2460 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x60>
+    2476:	|  |  |  |         66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    247d:	|  |  |  |         00 00 00 
+            first += 1;
+    2480:	|  |  |  |     /-> 48 83 c2 01          	add    $0x1,%rdx
+            return a < b;
+    2484:	|  |  |  |     |   8b 04 97             	mov    (%rdi,%rdx,4),%eax
+        } while (!less(pivot, p[first]));
+    2487:	|  |  |  |     |   41 39 c1             	cmp    %eax,%r9d
+    248a:	|  |  |  |     \-- 7d f4                	jge    2480 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x80>
+    while (first < last) {
+    248c:	|  |  |  |         48 39 ca             	cmp    %rcx,%rdx
+    248f:	|  |  |  \-------- 72 b7                	jb     2448 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x48>
+    p[0] = move(p[last]);
+    2491:	|  |  \----------> 44 89 07             	mov    %r8d,(%rdi)
+}
+    2494:	|  |               4c 89 d0             	mov    %r10,%rax
+    p[last] = move(pivot);
+    2497:	|  |               44 89 0e             	mov    %r9d,(%rsi)
+}
+    249a:	|  |               c3                   	ret
+    249b:	|  |               0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+            first += 1;
+    24a0:	|  |           /-> 48 83 c2 01          	add    $0x1,%rdx
+            if (less(pivot, p[first])) { break; }
+    24a4:	|  |           |   44 3b 0c 97          	cmp    (%rdi,%rdx,4),%r9d
+    24a8:	|  \-----------|-- 7c 90                	jl     243a <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x3a>
+        while (first < last) {
+    24aa:	\--------------|-> 49 39 d2             	cmp    %rdx,%r10
+    24ad:	               \-- 75 f1                	jne    24a0 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0xa0>
+    p[0] = move(p[last]);
+    24af:	                   44 89 07             	mov    %r8d,(%rdi)
+}
+    24b2:	                   4c 89 d0             	mov    %r10,%rax
+    p[last] = move(pivot);
+    24b5:	                   44 89 0e             	mov    %r9d,(%rsi)
+}
+    24b8:	                   c3                   	ret
+    24b9:	                   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000024c0 <fill(nel::Slice<int> const&, int) [clone .isra.0]>:
+static void fill(nel::Slice<int> const &s, int const pat)
+    24c0:	                      49 89 f0             	mov    %rsi,%r8
+    24c3:	                      49 89 f9             	mov    %rdi,%r9
+    24c6:	                      89 d6                	mov    %edx,%esi
+    for (nel::Index i = 0; i < n; ++i) {
+    24c8:	                      31 c9                	xor    %ecx,%ecx
+                if (i % 100 == 99) {
+    24ca:	                      49 ba c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%r10
+    24d1:	                      c2 f5 28 
+    unsigned int seed = 0x12345678;
+    24d4:	                      bf 78 56 34 12       	mov    $0x12345678,%edi
+    for (nel::Index i = 0; i < n; ++i) {
+    24d9:	                      4d 85 c0             	test   %r8,%r8
+    24dc:	         /----------- 74 54                	je     2532 <fill(nel::Slice<int> const&, int) [clone .isra.0]+0x72>
+    24de:	         |            66 90                	xchg   %ax,%ax
+        switch (pat) {
+    24e0:	         |  /-------> 83 fe 02             	cmp    $0x2,%esi
+    24e3:	/--------|--|-------- 0f 84 bf 00 00 00    	je     25a8 <fill(nel::Slice<int> const&, int) [clone .isra.0]+0xe8>
+    24e9:	|     /--|--|-------> 83 fe 02             	cmp    $0x2,%esi
+    24ec:	|     |  |  |  /----- 7f 1a                	jg     2508 <fill(nel::Slice<int> const&, int) [clone .isra.0]+0x48>
+    24ee:	|     |  |  |  |      85 f6                	test   %esi,%esi
+    24f0:	|  /--|--|--|--|----- 0f 84 8a 00 00 00    	je     2580 <fill(nel::Slice<int> const&, int) [clone .isra.0]+0xc0>
+                p[i] = int(i);
+    24f6:	|  |  |  |  |  |  /-> 41 89 0c 89          	mov    %ecx,(%r9,%rcx,4)
+    for (nel::Index i = 0; i < n; ++i) {
+    24fa:	|  |  |  |  |  |  |   48 83 c1 01          	add    $0x1,%rcx
+    24fe:	|  |  |  |  |  |  |   49 39 c8             	cmp    %rcx,%r8
+    2501:	|  |  |  |  |  |  \-- 75 f3                	jne    24f6 <fill(nel::Slice<int> const&, int) [clone .isra.0]+0x36>
+    2503:	|  |  |  |  |  |      c3                   	ret
+    2504:	|  |  |  |  |  |      0f 1f 40 00          	nopl   0x0(%rax)
+        switch (pat) {
+    2508:	|  |  |  |  |  \----> 83 fe 03             	cmp    $0x3,%esi
+    250b:	|  |  |  |  |     /-- 75 2b                	jne    2538 <fill(nel::Slice<int> const&, int) [clone .isra.0]+0x78>
+    s ^= s << 13;
+    250d:	|  |  |  |  |     |   89 fa                	mov    %edi,%edx
+    250f:	|  |  |  |  |     |   c1 e2 0d             	shl    $0xd,%edx
+    2512:	|  |  |  |  |     |   31 fa                	xor    %edi,%edx
+    s ^= s >> 17;
+    2514:	|  |  |  |  |     |   89 d0                	mov    %edx,%eax
+    2516:	|  |  |  |  |     |   c1 e8 11             	shr    $0x11,%eax
+    2519:	|  |  |  |  |     |   31 d0                	xor    %edx,%eax
+    s ^= s << 5;
+    251b:	|  |  |  |  |     |   89 c7                	mov    %eax,%edi
+    251d:	|  |  |  |  |     |   c1 e7 05             	shl    $0x5,%edi
+    2520:	|  |  |  |  |     |   31 c7                	xor    %eax,%edi
+                p[i] = int(next_rand(seed) % 16);
+    2522:	|  |  |  |  |     |   83 e0 0f             	and    $0xf,%eax
+    2525:	|  |  |  |  |     |   41 89 04 89          	mov    %eax,(%r9,%rcx,4)
+    for (nel::Index i = 0; i < n; ++i) {
+    2529:	|  |  |  |  |  /--|-> 48 83 c1 01          	add    $0x1,%rcx
+    252d:	|  |  |  |  |  |  |   4c 39 c1             	cmp    %r8,%rcx
+    2530:	|  |  |  |  \--|--|-- 75 ae                	jne    24e0 <fill(nel::Slice<int> const&, int) [clone .isra.0]+0x20>
+}
+    2532:	|  |  |  \-----|--|-> c3                   	ret
+    2533:	|  |  |        |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+                if (i % 100 == 99) {
+    2538:	|  |  |        |  \-> 48 89 ca             	mov    %rcx,%rdx
+                p[i] = int(i);
+    253b:	|  |  |        |      41 89 0c 89          	mov    %ecx,(%r9,%rcx,4)
+                if (i % 100 == 99) {
+    253f:	|  |  |        |      48 c1 ea 02          	shr    $0x2,%rdx
+    2543:	|  |  |        |      48 89 d0             	mov    %rdx,%rax
+    2546:	|  |  |        |      49 f7 e2             	mul    %r10
+    2549:	|  |  |        |      48 89 d0             	mov    %rdx,%rax
+    254c:	|  |  |        |      48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+    2550:	|  |  |        |      48 c1 e8 02          	shr    $0x2,%rax
+    2554:	|  |  |        |      48 01 c2             	add    %rax,%rdx
+    2557:	|  |  |        |      48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+    255b:	|  |  |        |      48 89 ca             	mov    %rcx,%rdx
+    255e:	|  |  |        |      48 c1 e0 02          	shl    $0x2,%rax
+    2562:	|  |  |        |      48 29 c2             	sub    %rax,%rdx
+    2565:	|  |  |        |      48 83 fa 63          	cmp    $0x63,%rdx
+    2569:	|  |  |        |  /-- 74 55                	je     25c0 <fill(nel::Slice<int> const&, int) [clone .isra.0]+0x100>
+    for (nel::Index i = 0; i < n; ++i) {
+    256b:	|  |  |        |  |   48 83 c1 01          	add    $0x1,%rcx
+    256f:	|  |  |        |  |   49 39 c8             	cmp    %rcx,%r8
+    2572:	|  |  \--------|--|-- 0f 85 71 ff ff ff    	jne    24e9 <fill(nel::Slice<int> const&, int) [clone .isra.0]+0x29>
+    2578:	|  |           |  |   c3                   	ret
+    2579:	|  |           |  |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    s ^= s << 13;
+    2580:	|  \-----------|--|-> 89 fa                	mov    %edi,%edx
+    2582:	|              |  |   c1 e2 0d             	shl    $0xd,%edx
+    2585:	|              |  |   31 fa                	xor    %edi,%edx
+    s ^= s >> 17;
+    2587:	|              |  |   89 d0                	mov    %edx,%eax
+    2589:	|              |  |   c1 e8 11             	shr    $0x11,%eax
+    258c:	|              |  |   31 d0                	xor    %edx,%eax
+    s ^= s << 5;
+    258e:	|              |  |   89 c7                	mov    %eax,%edi
+    2590:	|              |  |   c1 e7 05             	shl    $0x5,%edi
+    2593:	|              |  |   31 c7                	xor    %eax,%edi
+                p[i] = int(next_rand(seed) & 0x7fffffff);
+    2595:	|              |  |   89 f8                	mov    %edi,%eax
+    2597:	|              |  |   25 ff ff ff 7f       	and    $0x7fffffff,%eax
+    259c:	|              |  |   41 89 04 89          	mov    %eax,(%r9,%rcx,4)
+                break;
+    25a0:	|              +--|-- eb 87                	jmp    2529 <fill(nel::Slice<int> const&, int) [clone .isra.0]+0x69>
+    25a2:	|              |  |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+                p[i] = int(n - i);
+    25a8:	\--------------|--|-> 44 89 c0             	mov    %r8d,%eax
+    25ab:	               |  |   29 c8                	sub    %ecx,%eax
+    25ad:	               |  |   41 89 04 89          	mov    %eax,(%r9,%rcx,4)
+                break;
+    25b1:	               +--|-- e9 73 ff ff ff       	jmp    2529 <fill(nel::Slice<int> const&, int) [clone .isra.0]+0x69>
+    25b6:	               |  |   66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    25bd:	               |  |   00 00 00 
+    s ^= s << 13;
+    25c0:	               |  \-> 89 fa                	mov    %edi,%edx
+    25c2:	               |      c1 e2 0d             	shl    $0xd,%edx
+    25c5:	               |      31 fa                	xor    %edi,%edx
+    s ^= s >> 17;
+    25c7:	               |      89 d0                	mov    %edx,%eax
+    25c9:	               |      c1 e8 11             	shr    $0x11,%eax
+    25cc:	               |      31 d0                	xor    %edx,%eax
+                    nel::Index const j = next_rand(seed) % n;
+    25ce:	               |      31 d2                	xor    %edx,%edx
+    s ^= s << 5;
+    25d0:	               |      89 c7                	mov    %eax,%edi
+    25d2:	               |      c1 e7 05             	shl    $0x5,%edi
+    25d5:	               |      31 c7                	xor    %eax,%edi
+                    nel::Index const j = next_rand(seed) % n;
+    25d7:	               |      89 f8                	mov    %edi,%eax
+    25d9:	               |      49 f7 f0             	div    %r8
+                    p[i] = p[j];
+    25dc:	               |      49 8d 04 91          	lea    (%r9,%rdx,4),%rax
+    25e0:	               |      8b 10                	mov    (%rax),%edx
+    25e2:	               |      41 89 14 89          	mov    %edx,(%r9,%rcx,4)
+                    p[j] = t;
+    25e6:	               |      89 08                	mov    %ecx,(%rax)
+    25e8:	               \----- e9 3c ff ff ff       	jmp    2529 <fill(nel::Slice<int> const&, int) [clone .isra.0]+0x69>
+    25ed:	                      0f 1f 00             	nopl   (%rax)
+
+00000000000025f0 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]>:
+void pdq(T p[], Length n, F &less, Count bad_allowed, bool leftmost)
+    25f0:	   /-------------------------------------> 41 57                	push   %r15
+    25f2:	   |                                       49 89 f2             	mov    %rsi,%r10
+    25f5:	   |                                       41 56                	push   %r14
+    25f7:	   |                                       41 55                	push   %r13
+    25f9:	   |                                       41 54                	push   %r12
+    25fb:	   |                                       55                   	push   %rbp
+    25fc:	   |                                       53                   	push   %rbx
+    25fd:	   |                                       48 89 fb             	mov    %rdi,%rbx
+    2600:	   |                                       48 83 ec 28          	sub    $0x28,%rsp
+        if (n < small_n) {
+    2604:	   |                                       48 83 fe 13          	cmp    $0x13,%rsi
+    2608:	/--|-------------------------------------- 0f 86 62 02 00 00    	jbe    2870 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x280>
+    260e:	|  |                                       49 89 d4             	mov    %rdx,%r12
+    2611:	|  |                                       41 89 cd             	mov    %ecx,%r13d
+        Index const m = partition_right(p, n, less, already);
+    2614:	|  |                                       4c 8d 74 24 1f       	lea    0x1f(%rsp),%r14
+    2619:	|  |  /----------------------------------- e9 86 01 00 00       	jmp    27a4 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x1b4>
+    261e:	|  |  |                                    66 90                	xchg   %ax,%ax
+    if (less(b, a)) { swap(a, b); }
+    2620:	|  |  |                 /----------------> 39 d1                	cmp    %edx,%ecx
+    2622:	|  |  |                 |              /-- 7d 06                	jge    262a <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x3a>
+    a = move(b);
+    2624:	|  |  |                 |              |   89 0b                	mov    %ecx,(%rbx)
+}
+    2626:	|  |  |                 |              |   89 d1                	mov    %edx,%ecx
+    b = move(t);
+    2628:	|  |  |                 |              |   89 17                	mov    %edx,(%rdi)
+            return a < b;
+    262a:	|  |  |                 |              \-> 8b 16                	mov    (%rsi),%edx
+    if (less(c, b)) {
+    262c:	|  |  |                 |                  39 ca                	cmp    %ecx,%edx
+    262e:	|  |  |                 |              /-- 7d 10                	jge    2640 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x50>
+    a = move(b);
+    2630:	|  |  |                 |              |   89 17                	mov    %edx,(%rdi)
+    b = move(t);
+    2632:	|  |  |                 |              |   89 0e                	mov    %ecx,(%rsi)
+            return a < b;
+    2634:	|  |  |                 |              |   8b 0f                	mov    (%rdi),%ecx
+    2636:	|  |  |                 |              |   8b 13                	mov    (%rbx),%edx
+        if (less(b, a)) { swap(a, b); }
+    2638:	|  |  |                 |              |   39 d1                	cmp    %edx,%ecx
+    263a:	|  |  |                 |              +-- 7d 04                	jge    2640 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x50>
+    a = move(b);
+    263c:	|  |  |                 |              |   89 0b                	mov    %ecx,(%rbx)
+    b = move(t);
+    263e:	|  |  |                 |              |   89 17                	mov    %edx,(%rdi)
+        sort3(p[1], p[h - 1], p[n - 2], less);
+    2640:	|  |  |                 |              \-> 48 8d 74 03 fc       	lea    -0x4(%rbx,%rax,1),%rsi
+            return a < b;
+    2645:	|  |  |                 |                  8b 4b 04             	mov    0x4(%rbx),%ecx
+        sort3(p[1], p[h - 1], p[n - 2], less);
+    2648:	|  |  |                 |                  4e 8d 4c 03 f8       	lea    -0x8(%rbx,%r8,1),%r9
+            return a < b;
+    264d:	|  |  |                 |                  8b 16                	mov    (%rsi),%edx
+    if (less(b, a)) { swap(a, b); }
+    264f:	|  |  |                 |                  39 ca                	cmp    %ecx,%edx
+    2651:	|  |  |                 |              /-- 7d 07                	jge    265a <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x6a>
+    a = move(b);
+    2653:	|  |  |                 |              |   89 53 04             	mov    %edx,0x4(%rbx)
+}
+    2656:	|  |  |                 |              |   89 ca                	mov    %ecx,%edx
+    b = move(t);
+    2658:	|  |  |                 |              |   89 0e                	mov    %ecx,(%rsi)
+            return a < b;
+    265a:	|  |  |                 |              \-> 41 8b 09             	mov    (%r9),%ecx
+    if (less(c, b)) {
+    265d:	|  |  |                 |                  39 d1                	cmp    %edx,%ecx
+    265f:	|  |  |                 |              /-- 7d 13                	jge    2674 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x84>
+    a = move(b);
+    2661:	|  |  |                 |              |   89 0e                	mov    %ecx,(%rsi)
+    b = move(t);
+    2663:	|  |  |                 |              |   41 89 11             	mov    %edx,(%r9)
+            return a < b;
+    2666:	|  |  |                 |              |   8b 0e                	mov    (%rsi),%ecx
+    2668:	|  |  |                 |              |   8b 53 04             	mov    0x4(%rbx),%edx
+        if (less(b, a)) { swap(a, b); }
+    266b:	|  |  |                 |              |   39 d1                	cmp    %edx,%ecx
+    266d:	|  |  |                 |              +-- 7d 05                	jge    2674 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x84>
+    a = move(b);
+    266f:	|  |  |                 |              |   89 4b 04             	mov    %ecx,0x4(%rbx)
+    b = move(t);
+    2672:	|  |  |                 |              |   89 16                	mov    %edx,(%rsi)
+        sort3(p[2], p[h + 1], p[n - 3], less);
+    2674:	|  |  |                 |              \-> 48 8d 4c 03 04       	lea    0x4(%rbx,%rax,1),%rcx
+            return a < b;
+    2679:	|  |  |                 |                  8b 53 08             	mov    0x8(%rbx),%edx
+        sort3(p[2], p[h + 1], p[n - 3], less);
+    267c:	|  |  |                 |                  4e 8d 44 03 f4       	lea    -0xc(%rbx,%r8,1),%r8
+            return a < b;
+    2681:	|  |  |                 |                  8b 01                	mov    (%rcx),%eax
+    if (less(b, a)) { swap(a, b); }
+    2683:	|  |  |                 |                  39 d0                	cmp    %edx,%eax
+    2685:	|  |  |                 |              /-- 7d 07                	jge    268e <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x9e>
+    a = move(b);
+    2687:	|  |  |                 |              |   89 43 08             	mov    %eax,0x8(%rbx)
+}
+    268a:	|  |  |                 |              |   89 d0                	mov    %edx,%eax
+    b = move(t);
+    268c:	|  |  |                 |              |   89 11                	mov    %edx,(%rcx)
+            return a < b;
+    268e:	|  |  |                 |              \-> 41 8b 10             	mov    (%r8),%edx
+    if (less(c, b)) {
+    2691:	|  |  |                 |                  39 c2                	cmp    %eax,%edx
+    2693:	|  |  |                 |              /-- 7d 15                	jge    26aa <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0xba>
+    a = move(b);
+    2695:	|  |  |                 |              |   89 11                	mov    %edx,(%rcx)
+    b = move(t);
+    2697:	|  |  |                 |              |   41 89 00             	mov    %eax,(%r8)
+            return a < b;
+    269a:	|  |  |                 |              |   8b 01                	mov    (%rcx),%eax
+    269c:	|  |  |                 |              |   8b 53 08             	mov    0x8(%rbx),%edx
+        if (less(b, a)) { swap(a, b); }
+    269f:	|  |  |                 |              |   39 d0                	cmp    %edx,%eax
+    26a1:	|  |  |                 |              +-- 7d 07                	jge    26aa <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0xba>
+    a = move(b);
+    26a3:	|  |  |                 |              |   89 43 08             	mov    %eax,0x8(%rbx)
+}
+    26a6:	|  |  |                 |              |   89 d0                	mov    %edx,%eax
+    b = move(t);
+    26a8:	|  |  |                 |              |   89 11                	mov    %edx,(%rcx)
+            return a < b;
+    26aa:	|  |  |                 |              \-> f3 0f 7e 06          	movq   (%rsi),%xmm0
+    26ae:	|  |  |                 |                  66 0f 70 c8 e5       	pshufd $0xe5,%xmm0,%xmm1
+    26b3:	|  |  |                 |                  66 41 0f 7e c0       	movd   %xmm0,%r8d
+    26b8:	|  |  |                 |                  66 0f 7e ca          	movd   %xmm1,%edx
+    if (less(b, a)) { swap(a, b); }
+    26bc:	|  |  |                 |                  41 39 d0             	cmp    %edx,%r8d
+    26bf:	|  |  |                 |              /-- 7e 0e                	jle    26cf <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0xdf>
+            return a < b;
+    26c1:	|  |  |                 |              |   66 0f 70 c0 e1       	pshufd $0xe1,%xmm0,%xmm0
+}
+    26c6:	|  |  |                 |              |   44 89 c2             	mov    %r8d,%edx
+    a = move(b);
+    26c9:	|  |  |                 |              |   66 0f d6 06          	movq   %xmm0,(%rsi)
+    26cd:	|  |  |                 |              |   8b 01                	mov    (%rcx),%eax
+    if (less(c, b)) {
+    26cf:	|  |  |                 |              \-> 39 c2                	cmp    %eax,%edx
+    26d1:	|  |  |                 |              /-- 7e 12                	jle    26e5 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0xf5>
+    26d3:	|  |  |                 |              |   89 07                	mov    %eax,(%rdi)
+    b = move(t);
+    26d5:	|  |  |                 |              |   89 11                	mov    %edx,(%rcx)
+            return a < b;
+    26d7:	|  |  |                 |              |   8b 17                	mov    (%rdi),%edx
+    26d9:	|  |  |                 |              |   8b 06                	mov    (%rsi),%eax
+        if (less(b, a)) { swap(a, b); }
+    26db:	|  |  |                 |              |   39 c2                	cmp    %eax,%edx
+    26dd:	|  |  |                 |              +-- 7d 06                	jge    26e5 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0xf5>
+    a = move(b);
+    26df:	|  |  |                 |              |   89 16                	mov    %edx,(%rsi)
+}
+    26e1:	|  |  |                 |              |   89 c2                	mov    %eax,%edx
+    b = move(t);
+    26e3:	|  |  |                 |              |   89 07                	mov    %eax,(%rdi)
+    T t = move(a);
+    26e5:	|  |  |                 |              \-> 8b 03                	mov    (%rbx),%eax
+    a = move(b);
+    26e7:	|  |  |                 |                  89 13                	mov    %edx,(%rbx)
+    b = move(t);
+    26e9:	|  |  |                 |                  89 07                	mov    %eax,(%rdi)
+    26eb:	|  |  |                 |  /-------------> 4d 8d 7a ff          	lea    -0x1(%r10),%r15
+        if (!leftmost && !less(p[-1], p[0])) {
+    26ef:	|  |  |                 |  |               45 84 ed             	test   %r13b,%r13b
+    26f2:	|  |  |                 |  |           /-- 75 0b                	jne    26ff <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x10f>
+    26f4:	|  |  |                 |  |           |   8b 03                	mov    (%rbx),%eax
+    26f6:	|  |  |                 |  |           |   39 43 fc             	cmp    %eax,-0x4(%rbx)
+    26f9:	|  |  |     /-----------|--|-----------|-- 0f 8d 29 02 00 00    	jge    2928 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x338>
+        Index const m = partition_right(p, n, less, already);
+    26ff:	|  |  |     |           |  |           \-> 4c 89 f2             	mov    %r14,%rdx
+    2702:	|  |  |     |           |  |               4c 89 d6             	mov    %r10,%rsi
+    2705:	|  |  |     |           |  |               48 89 df             	mov    %rbx,%rdi
+    2708:	|  |  |     |           |  |               e8 53 fc ff ff       	call   2360 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]>
+    270d:	|  |  |     |           |  |               48 89 c5             	mov    %rax,%rbp
+        Length const r = n - m - 1;
+    2710:	|  |  |     |           |  |               49 29 c7             	sub    %rax,%r15
+        if (l < n / 8 || r < n / 8) {
+    2713:	|  |  |     |           |  |               4c 89 d0             	mov    %r10,%rax
+    2716:	|  |  |     |           |  |               48 c1 e8 03          	shr    $0x3,%rax
+    271a:	|  |  |     |           |  |               4c 89 fa             	mov    %r15,%rdx
+    271d:	|  |  |     |           |  |               4c 39 fd             	cmp    %r15,%rbp
+    2720:	|  |  |     |           |  |               48 0f 46 d5          	cmovbe %rbp,%rdx
+    2724:	|  |  |     |           |  |               48 39 c2             	cmp    %rax,%rdx
+    2727:	|  |  |     |  /--------|--|-------------- 0f 83 b3 01 00 00    	jae    28e0 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x2f0>
+            if (bad_allowed == 0) {
+    272d:	|  |  |     |  |        |  |               49 83 ec 01          	sub    $0x1,%r12
+    2731:	|  |  |  /--|--|--------|--|-------------- 0f 84 29 02 00 00    	je     2960 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x370>
+            break_patterns(p + m + 1, r);
+    2737:	|  |  |  |  |  |        |  |               48 8d 04 ad 04 00 00 	lea    0x4(,%rbp,4),%rax
+    273e:	|  |  |  |  |  |        |  |               00 
+    273f:	|  |  |  |  |  |        |  |               4c 8d 04 03          	lea    (%rbx,%rax,1),%r8
+    if (n >= small_n) {
+    2743:	|  |  |  |  |  |        |  |               48 83 fd 13          	cmp    $0x13,%rbp
+    2747:	|  |  |  |  |  |        |  |  /----------- 0f 86 b3 00 00 00    	jbe    2800 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x210>
+        swap(p[0], p[n / 4]);
+    274d:	|  |  |  |  |  |        |  |  |            48 89 ea             	mov    %rbp,%rdx
+    T t = move(a);
+    2750:	|  |  |  |  |  |        |  |  |            8b 0b                	mov    (%rbx),%ecx
+        swap(p[n - 1], p[n - n / 4]);
+    2752:	|  |  |  |  |  |        |  |  |            48 8d 44 03 f8       	lea    -0x8(%rbx,%rax,1),%rax
+        swap(p[0], p[n / 4]);
+    2757:	|  |  |  |  |  |        |  |  |            48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+    275b:	|  |  |  |  |  |        |  |  |            48 01 da             	add    %rbx,%rdx
+    a = move(b);
+    275e:	|  |  |  |  |  |        |  |  |            8b 32                	mov    (%rdx),%esi
+    2760:	|  |  |  |  |  |        |  |  |            89 33                	mov    %esi,(%rbx)
+    b = move(t);
+    2762:	|  |  |  |  |  |        |  |  |            89 0a                	mov    %ecx,(%rdx)
+        swap(p[n - 1], p[n - n / 4]);
+    2764:	|  |  |  |  |  |        |  |  |            48 89 e9             	mov    %rbp,%rcx
+    2767:	|  |  |  |  |  |        |  |  |            48 89 ea             	mov    %rbp,%rdx
+    276a:	|  |  |  |  |  |        |  |  |            48 c1 e9 02          	shr    $0x2,%rcx
+    276e:	|  |  |  |  |  |        |  |  |            48 29 ca             	sub    %rcx,%rdx
+    T t = move(a);
+    2771:	|  |  |  |  |  |        |  |  |            8b 08                	mov    (%rax),%ecx
+    2773:	|  |  |  |  |  |        |  |  |            48 8d 14 93          	lea    (%rbx,%rdx,4),%rdx
+    a = move(b);
+    2777:	|  |  |  |  |  |        |  |  |            8b 32                	mov    (%rdx),%esi
+    2779:	|  |  |  |  |  |        |  |  |            89 30                	mov    %esi,(%rax)
+    b = move(t);
+    277b:	|  |  |  |  |  |        |  |  |            89 0a                	mov    %ecx,(%rdx)
+    if (n >= small_n) {
+    277d:	|  |  |  |  |  |        |  |  |            49 83 ff 13          	cmp    $0x13,%r15
+    2781:	|  |  |  |  |  |        |  |  |     /----- 0f 87 7f 00 00 00    	ja     2806 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x216>
+            pdq(p + m + 1, r, less, bad_allowed, false);
+    2787:	|  |  |  |  |  |        |  |  |  /--|----> 31 c9                	xor    %ecx,%ecx
+    2789:	|  |  |  |  |  |        |  |  |  |  |      4c 89 e2             	mov    %r12,%rdx
+    278c:	|  |  |  |  |  |        |  |  |  |  |      4c 89 fe             	mov    %r15,%rsi
+    278f:	|  |  |  |  |  |        |  |  |  |  |      4c 89 c7             	mov    %r8,%rdi
+    2792:	|  +--|--|--|--|--------|--|--|--|--|----- e8 59 fe ff ff       	call   25f0 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]>
+        Index const m = partition_right(p, n, less, already);
+    2797:	|  |  |  |  |  |        |  |  |  |  |      49 89 ea             	mov    %rbp,%r10
+        if (n < small_n) {
+    279a:	|  |  |  |  |  |  /-----|--|--|--|--|----> 49 83 fa 13          	cmp    $0x13,%r10
+    279e:	+--|--|--|--|--|--|-----|--|--|--|--|----- 0f 86 cc 00 00 00    	jbe    2870 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x280>
+    Index const h = n / 2;
+    27a4:	|  |  >--|--|--|--|-----|--|--|--|--|----> 4c 89 d0             	mov    %r10,%rax
+        sort3(p[0], p[h], p[n - 1], less);
+    27a7:	|  |  |  |  |  |  |     |  |  |  |  |      4e 8d 04 95 00 00 00 	lea    0x0(,%r10,4),%r8
+    27ae:	|  |  |  |  |  |  |     |  |  |  |  |      00 
+            return a < b;
+    27af:	|  |  |  |  |  |  |     |  |  |  |  |      8b 13                	mov    (%rbx),%edx
+    Index const h = n / 2;
+    27b1:	|  |  |  |  |  |  |     |  |  |  |  |      48 d1 e8             	shr    %rax
+        sort3(p[0], p[h], p[n - 1], less);
+    27b4:	|  |  |  |  |  |  |     |  |  |  |  |      4a 8d 74 03 fc       	lea    -0x4(%rbx,%r8,1),%rsi
+    27b9:	|  |  |  |  |  |  |     |  |  |  |  |      48 c1 e0 02          	shl    $0x2,%rax
+    27bd:	|  |  |  |  |  |  |     |  |  |  |  |      48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+            return a < b;
+    27c1:	|  |  |  |  |  |  |     |  |  |  |  |      8b 0f                	mov    (%rdi),%ecx
+    if (n > ninther_n) {
+    27c3:	|  |  |  |  |  |  |     |  |  |  |  |      49 81 fa 80 00 00 00 	cmp    $0x80,%r10
+    27ca:	|  |  |  |  |  |  |     \--|--|--|--|----- 0f 87 50 fe ff ff    	ja     2620 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x30>
+    if (less(b, a)) { swap(a, b); }
+    27d0:	|  |  |  |  |  |  |        |  |  |  |      39 d1                	cmp    %edx,%ecx
+    27d2:	|  |  |  |  |  |  |        |  |  |  |  /-- 7e 06                	jle    27da <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x1ea>
+    a = move(b);
+    27d4:	|  |  |  |  |  |  |        |  |  |  |  |   89 17                	mov    %edx,(%rdi)
+}
+    27d6:	|  |  |  |  |  |  |        |  |  |  |  |   89 ca                	mov    %ecx,%edx
+    b = move(t);
+    27d8:	|  |  |  |  |  |  |        |  |  |  |  |   89 0b                	mov    %ecx,(%rbx)
+            return a < b;
+    27da:	|  |  |  |  |  |  |        |  |  |  |  \-> 8b 06                	mov    (%rsi),%eax
+    if (less(c, b)) {
+    27dc:	|  |  |  |  |  |  |        |  |  |  |      39 d0                	cmp    %edx,%eax
+    27de:	|  |  |  |  |  |  |        +--|--|--|----- 0f 8d 07 ff ff ff    	jge    26eb <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0xfb>
+    a = move(b);
+    27e4:	|  |  |  |  |  |  |        |  |  |  |      89 03                	mov    %eax,(%rbx)
+    b = move(t);
+    27e6:	|  |  |  |  |  |  |        |  |  |  |      89 16                	mov    %edx,(%rsi)
+            return a < b;
+    27e8:	|  |  |  |  |  |  |        |  |  |  |      8b 13                	mov    (%rbx),%edx
+    27ea:	|  |  |  |  |  |  |        |  |  |  |      8b 07                	mov    (%rdi),%eax
+        if (less(b, a)) { swap(a, b); }
+    27ec:	|  |  |  |  |  |  |        |  |  |  |      39 c2                	cmp    %eax,%edx
+    27ee:	|  |  |  |  |  |  |        +--|--|--|----- 0f 8d f7 fe ff ff    	jge    26eb <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0xfb>
+    a = move(b);
+    27f4:	|  |  |  |  |  |  |        |  |  |  |      89 17                	mov    %edx,(%rdi)
+    b = move(t);
+    27f6:	|  |  |  |  |  |  |        |  |  |  |      89 03                	mov    %eax,(%rbx)
+}
+    27f8:	|  |  |  |  |  |  |        \--|--|--|----- e9 ee fe ff ff       	jmp    26eb <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0xfb>
+    27fd:	|  |  |  |  |  |  |           |  |  |      0f 1f 00             	nopl   (%rax)
+    if (n >= small_n) {
+    2800:	|  |  |  |  |  |  |           \--|--|----> 49 83 ff 13          	cmp    $0x13,%r15
+    2804:	|  |  |  |  |  |  |  /-----------|--|----- 76 32                	jbe    2838 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x248>
+        swap(p[0], p[n / 4]);
+    2806:	|  |  |  |  |  |  |  |           |  \----> 4c 89 f8             	mov    %r15,%rax
+    T t = move(a);
+    2809:	|  |  |  |  |  |  |  |           |         41 8b 10             	mov    (%r8),%edx
+    280c:	|  |  |  |  |  |  |  |           |         48 83 e0 fc          	and    $0xfffffffffffffffc,%rax
+    2810:	|  |  |  |  |  |  |  |           |         4c 01 c0             	add    %r8,%rax
+    a = move(b);
+    2813:	|  |  |  |  |  |  |  |           |         8b 08                	mov    (%rax),%ecx
+    2815:	|  |  |  |  |  |  |  |           |         41 89 08             	mov    %ecx,(%r8)
+    b = move(t);
+    2818:	|  |  |  |  |  |  |  |           |         89 10                	mov    %edx,(%rax)
+        swap(p[n - 1], p[n - n / 4]);
+    281a:	|  |  |  |  |  |  |  |           |         4c 89 fa             	mov    %r15,%rdx
+    281d:	|  |  |  |  |  |  |  |           |         4c 89 f8             	mov    %r15,%rax
+    2820:	|  |  |  |  |  |  |  |           |         48 c1 ea 02          	shr    $0x2,%rdx
+    2824:	|  |  |  |  |  |  |  |           |         48 29 d0             	sub    %rdx,%rax
+    2827:	|  |  |  |  |  |  |  |           |         4b 8d 54 b8 fc       	lea    -0x4(%r8,%r15,4),%rdx
+    282c:	|  |  |  |  |  |  |  |           |         49 8d 04 80          	lea    (%r8,%rax,4),%rax
+    T t = move(a);
+    2830:	|  |  |  |  |  |  |  |           |         8b 0a                	mov    (%rdx),%ecx
+    a = move(b);
+    2832:	|  |  |  |  |  |  |  |           |         8b 30                	mov    (%rax),%esi
+    2834:	|  |  |  |  |  |  |  |           |         89 32                	mov    %esi,(%rdx)
+    b = move(t);
+    2836:	|  |  |  |  |  |  |  |           |         89 08                	mov    %ecx,(%rax)
+        if (l < r) {
+    2838:	|  |  |  |  |  |  |  >-----------|-------> 4c 39 fd             	cmp    %r15,%rbp
+    283b:	|  |  |  |  |  |  |  |           \-------- 0f 83 46 ff ff ff    	jae    2787 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x197>
+            pdq(p, l, less, bad_allowed, leftmost);
+    2841:	|  |  |  |  |  |  |  |                     41 0f b6 cd          	movzbl %r13b,%ecx
+    2845:	|  |  |  |  |  |  |  |                     48 89 df             	mov    %rbx,%rdi
+    2848:	|  |  |  |  |  |  |  |                     4c 89 e2             	mov    %r12,%rdx
+    284b:	|  |  |  |  |  |  |  |                     48 89 ee             	mov    %rbp,%rsi
+    284e:	|  |  |  |  |  |  |  |                     4c 89 44 24 08       	mov    %r8,0x8(%rsp)
+            leftmost = false;
+    2853:	|  |  |  |  |  |  |  |                     45 31 ed             	xor    %r13d,%r13d
+            pdq(p, l, less, bad_allowed, leftmost);
+    2856:	|  \--|--|--|--|--|--|-------------------- e8 95 fd ff ff       	call   25f0 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]>
+    285b:	|     |  |  |  |  |  |                     4d 89 fa             	mov    %r15,%r10
+            p += m + 1;
+    285e:	|     |  |  |  |  |  |                     48 8b 5c 24 08       	mov    0x8(%rsp),%rbx
+        if (n < small_n) {
+    2863:	|     |  |  |  |  |  |                     49 83 fa 13          	cmp    $0x13,%r10
+    2867:	|     \--|--|--|--|--|-------------------- 0f 87 37 ff ff ff    	ja     27a4 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x1b4>
+    286d:	|        |  |  |  |  |                     0f 1f 00             	nopl   (%rax)
+    for (Index i = 1; i < n; ++i) {
+    2870:	\--------|--|--|--|--|-------------------> 49 83 fa 01          	cmp    $0x1,%r10
+    2874:	         |  |  |  |  |     /-------------- 76 55                	jbe    28cb <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x2db>
+    2876:	         |  |  |  |  |     |               31 ff                	xor    %edi,%edi
+    2878:	         |  |  |  |  |     |               be 01 00 00 00       	mov    $0x1,%esi
+    287d:	         |  |  |  |  |     |        /----- eb 11                	jmp    2890 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x2a0>
+    287f:	         |  |  |  |  |     |        |  /-> 48 83 c6 01          	add    $0x1,%rsi
+    2883:	         |  |  |  |  |     |        |  |   48 83 c7 04          	add    $0x4,%rdi
+    2887:	         |  |  |  |  |     |        |  |   4c 39 d6             	cmp    %r10,%rsi
+    288a:	         |  |  |  |  |     +--------|--|-- 74 3f                	je     28cb <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x2db>
+    288c:	         |  |  |  |  |     |        |  |   0f 1f 40 00          	nopl   0x0(%rax)
+            return a < b;
+    2890:	         |  |  |  |  |     |        >--|-> 8b 0c b3             	mov    (%rbx,%rsi,4),%ecx
+    2893:	         |  |  |  |  |     |        |  |   48 89 f8             	mov    %rdi,%rax
+        if (!less(p[i], p[i - 1])) { continue; }
+    2896:	         |  |  |  |  |     |        |  |   3b 0c 3b             	cmp    (%rbx,%rdi,1),%ecx
+    2899:	         |  |  |  |  |     |        |  \-- 7d e4                	jge    287f <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x28f>
+            p[j] = move(p[j - 1]);
+    289b:	         |  |  |  |  |  /--|--------|----> 8b 14 03             	mov    (%rbx,%rax,1),%edx
+    289e:	         |  |  |  |  |  |  |        |      89 54 03 04          	mov    %edx,0x4(%rbx,%rax,1)
+        } while (j > 0 && less(t, p[j - 1]));
+    28a2:	         |  |  |  |  |  |  |        |      48 85 c0             	test   %rax,%rax
+    28a5:	         |  |  |  |  |  |  |     /--|----- 0f 84 9d 00 00 00    	je     2948 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x358>
+    28ab:	         |  |  |  |  |  |  |     |  |      48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    28af:	         |  |  |  |  |  |  |     |  |      3b 4c 03 fc          	cmp    -0x4(%rbx,%rax,1),%ecx
+    28b3:	         |  |  |  |  |  |  |  /--|--|----- 0f 8c 9f 00 00 00    	jl     2958 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x368>
+        p[j] = move(t);
+    28b9:	         |  |  |  |  |  |  |  |  |  |      48 01 d8             	add    %rbx,%rax
+    28bc:	         |  |  |  |  |  |  |  |  |  |      89 08                	mov    %ecx,(%rax)
+    for (Index i = 1; i < n; ++i) {
+    28be:	         |  |  |  |  |  |  |  |  |  |  /-> 48 83 c6 01          	add    $0x1,%rsi
+    28c2:	         |  |  |  |  |  |  |  |  |  |  |   48 83 c7 04          	add    $0x4,%rdi
+    28c6:	         |  |  |  |  |  |  |  |  |  |  |   4c 39 d6             	cmp    %r10,%rsi
+    28c9:	         |  |  |  |  |  |  |  |  |  \--|-- 75 c5                	jne    2890 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x2a0>
+}
+    28cb:	         |  |  |  |  |  |  >--|--|-----|-> 48 83 c4 28          	add    $0x28,%rsp
+    28cf:	         |  |  |  |  |  |  |  |  |     |   5b                   	pop    %rbx
+    28d0:	         |  |  |  |  |  |  |  |  |     |   5d                   	pop    %rbp
+    28d1:	         |  |  |  |  |  |  |  |  |     |   41 5c                	pop    %r12
+    28d3:	         |  |  |  |  |  |  |  |  |     |   41 5d                	pop    %r13
+    28d5:	         |  |  |  |  |  |  |  |  |     |   41 5e                	pop    %r14
+    28d7:	         |  |  |  |  |  |  |  |  |     |   41 5f                	pop    %r15
+    28d9:	         |  |  |  |  |  |  |  |  |     |   c3                   	ret
+    28da:	         |  |  |  |  |  |  |  |  |     |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+                   && partial_insertion(p + m + 1, r, less)) {
+    28e0:	         |  |  \--|--|--|--|--|--|-----|-> 80 7c 24 1f 00       	cmpb   $0x0,0x1f(%rsp)
+    28e5:	         |  |     |  |  |  |  |  |     |   4c 8d 44 ab 04       	lea    0x4(%rbx,%rbp,4),%r8
+    28ea:	         |  |     |  +--|--|--|--|-----|-- 0f 84 48 ff ff ff    	je     2838 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x248>
+        } else if (already && partial_insertion(p, l, less)
+    28f0:	         |  |     |  |  |  |  |  |     |   48 89 ee             	mov    %rbp,%rsi
+    28f3:	         |  |     |  |  |  |  |  |     |   4c 89 44 24 08       	mov    %r8,0x8(%rsp)
+    28f8:	         |  |     |  |  |  |  |  |     |   e8 c3 f8 ff ff       	call   21c0 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>
+    28fd:	         |  |     |  |  |  |  |  |     |   4c 8b 44 24 08       	mov    0x8(%rsp),%r8
+    2902:	         |  |     |  |  |  |  |  |     |   84 c0                	test   %al,%al
+    2904:	         |  |     |  +--|--|--|--|-----|-- 0f 84 2e ff ff ff    	je     2838 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x248>
+                   && partial_insertion(p + m + 1, r, less)) {
+    290a:	         |  |     |  |  |  |  |  |     |   4c 89 c7             	mov    %r8,%rdi
+    290d:	         |  |     |  |  |  |  |  |     |   4c 89 fe             	mov    %r15,%rsi
+    2910:	         |  |     |  |  |  |  |  |     |   e8 ab f8 ff ff       	call   21c0 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>
+    2915:	         |  |     |  |  |  |  |  |     |   4c 8b 44 24 08       	mov    0x8(%rsp),%r8
+    291a:	         |  |     |  |  |  |  |  |     |   84 c0                	test   %al,%al
+    291c:	         |  |     |  \--|--|--|--|-----|-- 0f 84 16 ff ff ff    	je     2838 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x248>
+    2922:	         |  |     |     |  \--|--|-----|-- eb a7                	jmp    28cb <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x2db>
+    2924:	         |  |     |     |     |  |     |   0f 1f 40 00          	nopl   0x0(%rax)
+            Index const m = partition_left(p, n, less);
+    2928:	         |  \-----|-----|-----|--|-----|-> 4c 89 d6             	mov    %r10,%rsi
+    292b:	         |        |     |     |  |     |   48 89 df             	mov    %rbx,%rdi
+    292e:	         |        |     |     |  |     |   e8 cd fa ff ff       	call   2400 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>
+            n -= m + 1;
+    2933:	         |        |     |     |  |     |   49 29 c7             	sub    %rax,%r15
+            p += m + 1;
+    2936:	         |        |     |     |  |     |   48 8d 5c 83 04       	lea    0x4(%rbx,%rax,4),%rbx
+            n -= m + 1;
+    293b:	         |        |     |     |  |     |   4d 89 fa             	mov    %r15,%r10
+    293e:	         |        \-----|-----|--|-----|-- e9 57 fe ff ff       	jmp    279a <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x1aa>
+    2943:	         |              |     |  |     |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    2948:	         |              |     |  \-----|-> 48 89 d8             	mov    %rbx,%rax
+        p[j] = move(t);
+    294b:	         |              |     |        |   89 08                	mov    %ecx,(%rax)
+    294d:	         |              |     |        \-- e9 6c ff ff ff       	jmp    28be <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x2ce>
+    2952:	         |              |     |            66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    2958:	         |              |     \----------> 48 89 d0             	mov    %rdx,%rax
+    295b:	         |              \----------------- e9 3b ff ff ff       	jmp    289b <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x2ab>
+}
+    2960:	         \-------------------------------> 48 83 c4 28          	add    $0x28,%rsp
+                heap(p, n, less);
+    2964:	                                           4c 89 d6             	mov    %r10,%rsi
+}
+    2967:	                                           5b                   	pop    %rbx
+    2968:	                                           5d                   	pop    %rbp
+    2969:	                                           41 5c                	pop    %r12
+    296b:	                                           41 5d                	pop    %r13
+    296d:	                                           41 5e                	pop    %r14
+    296f:	                                           41 5f                	pop    %r15
+                heap(p, n, less);
+    2971:	                                           e9 ba f8 ff ff       	jmp    2230 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>
+    2976:	                                           66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    297d:	                                           00 00 00 
+
+0000000000002980 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]>:
+    while (n > 1) {
+    2980:	                                     48 83 fe 01          	cmp    $0x1,%rsi
+    2984:	/----------------------------------- 0f 86 7b 02 00 00    	jbe    2c05 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x285>
+void select_nth(T p[], Length n, Index k, F &less)
+    298a:	|                                    41 56                	push   %r14
+    298c:	|                                    49 89 f3             	mov    %rsi,%r11
+    298f:	|                                    49 89 d6             	mov    %rdx,%r14
+    2992:	|                                    41 55                	push   %r13
+    2994:	|                                    45 31 ed             	xor    %r13d,%r13d
+    2997:	|                                    41 54                	push   %r12
+    2999:	|                                    55                   	push   %rbp
+    299a:	|                                    53                   	push   %rbx
+    299b:	|                                    48 89 f3             	mov    %rsi,%rbx
+    299e:	|                                    48 83 ec 10          	sub    $0x10,%rsp
+    29a2:	|                                    66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+        n /= 2;
+    29a8:	|                                /-> 48 d1 eb             	shr    %rbx
+        l += 1;
+    29ab:	|                                |   49 83 c5 01          	add    $0x1,%r13
+    while (n > 1) {
+    29af:	|                                |   48 83 fb 01          	cmp    $0x1,%rbx
+    29b3:	|                                \-- 75 f3                	jne    29a8 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x28>
+    while (n >= small_n) {
+    29b5:	|                                    49 83 fb 13          	cmp    $0x13,%r11
+    29b9:	|  /-------------------------------- 0f 86 c0 01 00 00    	jbe    2b7f <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x1ff>
+    bool leftmost = true;
+    29bf:	|  |                                 bd 01 00 00 00       	mov    $0x1,%ebp
+        Index const m = partition_right(p, n, less, already);
+    29c4:	|  |                                 4c 8d 64 24 0f       	lea    0xf(%rsp),%r12
+    29c9:	|  |  /----------------------------- e9 45 01 00 00       	jmp    2b13 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x193>
+    29ce:	|  |  |                              66 90                	xchg   %ax,%ax
+    if (less(b, a)) { swap(a, b); }
+    29d0:	|  |  |              /-------------> 39 f1                	cmp    %esi,%ecx
+    29d2:	|  |  |              |           /-- 7e 06                	jle    29da <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x5a>
+    a = move(b);
+    29d4:	|  |  |              |           |   89 37                	mov    %esi,(%rdi)
+}
+    29d6:	|  |  |              |           |   89 ce                	mov    %ecx,%esi
+    b = move(t);
+    29d8:	|  |  |              |           |   89 0a                	mov    %ecx,(%rdx)
+            return a < b;
+    29da:	|  |  |              |           \-> 41 8b 09             	mov    (%r9),%ecx
+    if (less(c, b)) {
+    29dd:	|  |  |              |               39 f1                	cmp    %esi,%ecx
+    29df:	|  |  |              |           /-- 7d 11                	jge    29f2 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x72>
+    a = move(b);
+    29e1:	|  |  |              |           |   89 0a                	mov    %ecx,(%rdx)
+    b = move(t);
+    29e3:	|  |  |              |           |   41 89 31             	mov    %esi,(%r9)
+            return a < b;
+    29e6:	|  |  |              |           |   8b 32                	mov    (%rdx),%esi
+    29e8:	|  |  |              |           |   8b 0f                	mov    (%rdi),%ecx
+        if (less(b, a)) { swap(a, b); }
+    29ea:	|  |  |              |           |   39 ce                	cmp    %ecx,%esi
+    29ec:	|  |  |              |           +-- 7d 04                	jge    29f2 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x72>
+    a = move(b);
+    29ee:	|  |  |              |           |   89 37                	mov    %esi,(%rdi)
+    b = move(t);
+    29f0:	|  |  |              |           |   89 0a                	mov    %ecx,(%rdx)
+        sort3(p[1], p[h - 1], p[n - 2], less);
+    29f2:	|  |  |              |           \-> 48 8d 74 07 fc       	lea    -0x4(%rdi,%rax,1),%rsi
+            return a < b;
+    29f7:	|  |  |              |               44 8b 4f 04          	mov    0x4(%rdi),%r9d
+        sort3(p[1], p[h - 1], p[n - 2], less);
+    29fb:	|  |  |              |               4e 8d 54 07 f8       	lea    -0x8(%rdi,%r8,1),%r10
+            return a < b;
+    2a00:	|  |  |              |               8b 0e                	mov    (%rsi),%ecx
+    if (less(b, a)) { swap(a, b); }
+    2a02:	|  |  |              |               44 39 c9             	cmp    %r9d,%ecx
+    2a05:	|  |  |              |           /-- 7d 09                	jge    2a10 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x90>
+    a = move(b);
+    2a07:	|  |  |              |           |   89 4f 04             	mov    %ecx,0x4(%rdi)
+}
+    2a0a:	|  |  |              |           |   44 89 c9             	mov    %r9d,%ecx
+    b = move(t);
+    2a0d:	|  |  |              |           |   44 89 0e             	mov    %r9d,(%rsi)
+            return a < b;
+    2a10:	|  |  |              |           \-> 45 8b 0a             	mov    (%r10),%r9d
+    if (less(c, b)) {
+    2a13:	|  |  |              |               41 39 c9             	cmp    %ecx,%r9d
+    2a16:	|  |  |              |           /-- 7d 17                	jge    2a2f <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0xaf>
+    a = move(b);
+    2a18:	|  |  |              |           |   44 89 0e             	mov    %r9d,(%rsi)
+    b = move(t);
+    2a1b:	|  |  |              |           |   41 89 0a             	mov    %ecx,(%r10)
+            return a < b;
+    2a1e:	|  |  |              |           |   44 8b 0e             	mov    (%rsi),%r9d
+    2a21:	|  |  |              |           |   8b 4f 04             	mov    0x4(%rdi),%ecx
+        if (less(b, a)) { swap(a, b); }
+    2a24:	|  |  |              |           |   41 39 c9             	cmp    %ecx,%r9d
+    2a27:	|  |  |              |           +-- 7d 06                	jge    2a2f <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0xaf>
+    a = move(b);
+    2a29:	|  |  |              |           |   44 89 4f 04          	mov    %r9d,0x4(%rdi)
+    b = move(t);
+    2a2d:	|  |  |              |           |   89 0e                	mov    %ecx,(%rsi)
+        sort3(p[2], p[h + 1], p[n - 3], less);
+    2a2f:	|  |  |              |           \-> 4e 8d 4c 07 f4       	lea    -0xc(%rdi,%r8,1),%r9
+    2a34:	|  |  |              |               4c 8d 44 07 04       	lea    0x4(%rdi,%rax,1),%r8
+            return a < b;
+    2a39:	|  |  |              |               8b 4f 08             	mov    0x8(%rdi),%ecx
+    2a3c:	|  |  |              |               41 8b 00             	mov    (%r8),%eax
+    if (less(b, a)) { swap(a, b); }
+    2a3f:	|  |  |              |               39 c8                	cmp    %ecx,%eax
+    2a41:	|  |  |              |           /-- 7d 08                	jge    2a4b <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0xcb>
+    a = move(b);
+    2a43:	|  |  |              |           |   89 47 08             	mov    %eax,0x8(%rdi)
+}
+    2a46:	|  |  |              |           |   89 c8                	mov    %ecx,%eax
+    b = move(t);
+    2a48:	|  |  |              |           |   41 89 08             	mov    %ecx,(%r8)
+            return a < b;
+    2a4b:	|  |  |              |           \-> 41 8b 09             	mov    (%r9),%ecx
+    if (less(c, b)) {
+    2a4e:	|  |  |              |               39 c1                	cmp    %eax,%ecx
+    2a50:	|  |  |              |           /-- 7d 18                	jge    2a6a <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0xea>
+    a = move(b);
+    2a52:	|  |  |              |           |   41 89 08             	mov    %ecx,(%r8)
+    b = move(t);
+    2a55:	|  |  |              |           |   41 89 01             	mov    %eax,(%r9)
+            return a < b;
+    2a58:	|  |  |              |           |   41 8b 00             	mov    (%r8),%eax
+    2a5b:	|  |  |              |           |   8b 4f 08             	mov    0x8(%rdi),%ecx
+        if (less(b, a)) { swap(a, b); }
+    2a5e:	|  |  |              |           |   39 c8                	cmp    %ecx,%eax
+    2a60:	|  |  |              |           +-- 7d 08                	jge    2a6a <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0xea>
+    a = move(b);
+    2a62:	|  |  |              |           |   89 47 08             	mov    %eax,0x8(%rdi)
+}
+    2a65:	|  |  |              |           |   89 c8                	mov    %ecx,%eax
+    b = move(t);
+    2a67:	|  |  |              |           |   41 89 08             	mov    %ecx,(%r8)
+            return a < b;
+    2a6a:	|  |  |              |           \-> f3 0f 7e 06          	movq   (%rsi),%xmm0
+    2a6e:	|  |  |              |               66 0f 70 c8 e5       	pshufd $0xe5,%xmm0,%xmm1
+    2a73:	|  |  |              |               66 41 0f 7e c1       	movd   %xmm0,%r9d
+    2a78:	|  |  |              |               66 0f 7e c9          	movd   %xmm1,%ecx
+    if (less(b, a)) { swap(a, b); }
+    2a7c:	|  |  |              |               41 39 c9             	cmp    %ecx,%r9d
+    2a7f:	|  |  |              |           /-- 7e 0f                	jle    2a90 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x110>
+            return a < b;
+    2a81:	|  |  |              |           |   66 0f 70 c0 e1       	pshufd $0xe1,%xmm0,%xmm0
+}
+    2a86:	|  |  |              |           |   44 89 c9             	mov    %r9d,%ecx
+    a = move(b);
+    2a89:	|  |  |              |           |   66 0f d6 06          	movq   %xmm0,(%rsi)
+    2a8d:	|  |  |              |           |   41 8b 00             	mov    (%r8),%eax
+    if (less(c, b)) {
+    2a90:	|  |  |              |           \-> 39 c1                	cmp    %eax,%ecx
+    2a92:	|  |  |              |           /-- 7e 13                	jle    2aa7 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x127>
+    2a94:	|  |  |              |           |   89 02                	mov    %eax,(%rdx)
+    b = move(t);
+    2a96:	|  |  |              |           |   41 89 08             	mov    %ecx,(%r8)
+            return a < b;
+    2a99:	|  |  |              |           |   8b 0a                	mov    (%rdx),%ecx
+    2a9b:	|  |  |              |           |   8b 06                	mov    (%rsi),%eax
+        if (less(b, a)) { swap(a, b); }
+    2a9d:	|  |  |              |           |   39 c1                	cmp    %eax,%ecx
+    2a9f:	|  |  |              |           +-- 7d 06                	jge    2aa7 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x127>
+    a = move(b);
+    2aa1:	|  |  |              |           |   89 0e                	mov    %ecx,(%rsi)
+}
+    2aa3:	|  |  |              |           |   89 c1                	mov    %eax,%ecx
+    b = move(t);
+    2aa5:	|  |  |              |           |   89 02                	mov    %eax,(%rdx)
+    T t = move(a);
+    2aa7:	|  |  |              |           \-> 8b 07                	mov    (%rdi),%eax
+    a = move(b);
+    2aa9:	|  |  |              |               89 0f                	mov    %ecx,(%rdi)
+    b = move(t);
+    2aab:	|  |  |              |               89 02                	mov    %eax,(%rdx)
+        if (!leftmost && !less(p[-1], p[0])) {
+    2aad:	|  |  |              |  /----------> 40 84 ed             	test   %bpl,%bpl
+    2ab0:	|  |  |              |  |        /-- 75 0b                	jne    2abd <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x13d>
+    2ab2:	|  |  |              |  |        |   8b 07                	mov    (%rdi),%eax
+    2ab4:	|  |  |              |  |        |   39 47 fc             	cmp    %eax,-0x4(%rdi)
+    2ab7:	|  |  |     /--------|--|--------|-- 0f 8d 13 01 00 00    	jge    2bd0 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x250>
+        Index const m = partition_right(p, n, less, already);
+    2abd:	|  |  |     |        |  |        \-> 4c 89 e2             	mov    %r12,%rdx
+    2ac0:	|  |  |     |        |  |            4c 89 de             	mov    %r11,%rsi
+    2ac3:	|  |  |     |        |  |            e8 98 f8 ff ff       	call   2360 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]>
+        if (m < n / 8 || n - m - 1 < n / 8) {
+    2ac8:	|  |  |     |        |  |            4c 89 da             	mov    %r11,%rdx
+    2acb:	|  |  |     |        |  |            48 c1 ea 03          	shr    $0x3,%rdx
+    2acf:	|  |  |     |        |  |            48 39 d0             	cmp    %rdx,%rax
+    2ad2:	|  |  |     |        |  |     /----- 72 0c                	jb     2ae0 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x160>
+    2ad4:	|  |  |     |        |  |     |      49 8d 4b ff          	lea    -0x1(%r11),%rcx
+    2ad8:	|  |  |     |        |  |     |      48 29 c1             	sub    %rax,%rcx
+    2adb:	|  |  |     |        |  |     |      48 39 d1             	cmp    %rdx,%rcx
+    2ade:	|  |  |     |        |  |     |  /-- 73 0a                	jae    2aea <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x16a>
+            if (bad_allowed == 0) {
+    2ae0:	|  |  |     |        |  |     \--|-> 49 83 ed 01          	sub    $0x1,%r13
+    2ae4:	|  |  |  /--|--------|--|--------|-- 0f 84 1c 01 00 00    	je     2c06 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x286>
+        if (k == m) { return; }
+    2aea:	|  |  |  |  |        |  |        \-> 4c 39 f0             	cmp    %r14,%rax
+    2aed:	|  |  |  |  |  /-----|--|----------- 0f 84 d0 00 00 00    	je     2bc3 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x243>
+        if (k < m) {
+    2af3:	|  |  |  |  |  |     |  |            49 39 c6             	cmp    %rax,%r14
+    2af6:	|  |  |  |  |  |     |  |  /-------- 72 78                	jb     2b70 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x1f0>
+    2af8:	|  |  |  |  |  |     |  |  |         49 83 eb 01          	sub    $0x1,%r11
+    2afc:	|  |  |  |  |  |     |  |  |         49 83 ee 01          	sub    $0x1,%r14
+            p += m + 1;
+    2b00:	|  |  |  |  |  |     |  |  |         48 8d 7c 87 04       	lea    0x4(%rdi,%rax,4),%rdi
+            leftmost = false;
+    2b05:	|  |  |  |  |  |     |  |  |         31 ed                	xor    %ebp,%ebp
+            n -= m + 1;
+    2b07:	|  |  |  |  |  |     |  |  |         49 29 c3             	sub    %rax,%r11
+            k -= m + 1;
+    2b0a:	|  |  |  |  |  |     |  |  |         49 29 c6             	sub    %rax,%r14
+    while (n >= small_n) {
+    2b0d:	|  |  |  |  |  |  /--|--|--|-------> 49 83 fb 13          	cmp    $0x13,%r11
+    2b11:	|  |  |  |  |  |  |  |  |  |  /----- 76 66                	jbe    2b79 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x1f9>
+    Index const h = n / 2;
+    2b13:	|  |  >--|--|--|--|--|--|--|--|----> 4c 89 d8             	mov    %r11,%rax
+        sort3(p[0], p[h], p[n - 1], less);
+    2b16:	|  |  |  |  |  |  |  |  |  |  |      4e 8d 04 9d 00 00 00 	lea    0x0(,%r11,4),%r8
+    2b1d:	|  |  |  |  |  |  |  |  |  |  |      00 
+            return a < b;
+    2b1e:	|  |  |  |  |  |  |  |  |  |  |      8b 0f                	mov    (%rdi),%ecx
+    Index const h = n / 2;
+    2b20:	|  |  |  |  |  |  |  |  |  |  |      48 d1 e8             	shr    %rax
+        sort3(p[0], p[h], p[n - 1], less);
+    2b23:	|  |  |  |  |  |  |  |  |  |  |      4e 8d 4c 07 fc       	lea    -0x4(%rdi,%r8,1),%r9
+    2b28:	|  |  |  |  |  |  |  |  |  |  |      48 c1 e0 02          	shl    $0x2,%rax
+    2b2c:	|  |  |  |  |  |  |  |  |  |  |      48 8d 14 07          	lea    (%rdi,%rax,1),%rdx
+            return a < b;
+    2b30:	|  |  |  |  |  |  |  |  |  |  |      8b 32                	mov    (%rdx),%esi
+    if (n > ninther_n) {
+    2b32:	|  |  |  |  |  |  |  |  |  |  |      49 81 fb 80 00 00 00 	cmp    $0x80,%r11
+    2b39:	|  |  |  |  |  |  |  \--|--|--|----- 0f 87 91 fe ff ff    	ja     29d0 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x50>
+    if (less(b, a)) { swap(a, b); }
+    2b3f:	|  |  |  |  |  |  |     |  |  |      39 f1                	cmp    %esi,%ecx
+    2b41:	|  |  |  |  |  |  |     |  |  |  /-- 7d 06                	jge    2b49 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x1c9>
+    a = move(b);
+    2b43:	|  |  |  |  |  |  |     |  |  |  |   89 0a                	mov    %ecx,(%rdx)
+}
+    2b45:	|  |  |  |  |  |  |     |  |  |  |   89 f1                	mov    %esi,%ecx
+    b = move(t);
+    2b47:	|  |  |  |  |  |  |     |  |  |  |   89 37                	mov    %esi,(%rdi)
+            return a < b;
+    2b49:	|  |  |  |  |  |  |     |  |  |  \-> 41 8b 01             	mov    (%r9),%eax
+    if (less(c, b)) {
+    2b4c:	|  |  |  |  |  |  |     |  |  |      39 c8                	cmp    %ecx,%eax
+    2b4e:	|  |  |  |  |  |  |     +--|--|----- 0f 8d 59 ff ff ff    	jge    2aad <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x12d>
+    a = move(b);
+    2b54:	|  |  |  |  |  |  |     |  |  |      89 07                	mov    %eax,(%rdi)
+    b = move(t);
+    2b56:	|  |  |  |  |  |  |     |  |  |      41 89 09             	mov    %ecx,(%r9)
+            return a < b;
+    2b59:	|  |  |  |  |  |  |     |  |  |      8b 0f                	mov    (%rdi),%ecx
+    2b5b:	|  |  |  |  |  |  |     |  |  |      8b 02                	mov    (%rdx),%eax
+        if (less(b, a)) { swap(a, b); }
+    2b5d:	|  |  |  |  |  |  |     |  |  |      39 c1                	cmp    %eax,%ecx
+    2b5f:	|  |  |  |  |  |  |     +--|--|----- 0f 8d 48 ff ff ff    	jge    2aad <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x12d>
+    a = move(b);
+    2b65:	|  |  |  |  |  |  |     |  |  |      89 0a                	mov    %ecx,(%rdx)
+    b = move(t);
+    2b67:	|  |  |  |  |  |  |     |  |  |      89 07                	mov    %eax,(%rdi)
+}
+    2b69:	|  |  |  |  |  |  |     \--|--|----- e9 3f ff ff ff       	jmp    2aad <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x12d>
+    2b6e:	|  |  |  |  |  |  |        |  |      66 90                	xchg   %ax,%ax
+    2b70:	|  |  |  |  |  |  |        \--|----> 49 89 c3             	mov    %rax,%r11
+    while (n >= small_n) {
+    2b73:	|  |  |  |  |  |  |           |      49 83 fb 13          	cmp    $0x13,%r11
+    2b77:	|  |  \--|--|--|--|-----------|----- 77 9a                	ja     2b13 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x193>
+    for (Index i = 1; i < n; ++i) {
+    2b79:	|  |     |  |  |  |           \----> 49 83 fb 01          	cmp    $0x1,%r11
+    2b7d:	|  |     |  |  +--|----------------- 76 44                	jbe    2bc3 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x243>
+            leftmost = false;
+    2b7f:	|  \-----|--|--|--|----------------> 31 f6                	xor    %esi,%esi
+    2b81:	|        |  |  |  |           /----- eb 0d                	jmp    2b90 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x210>
+    for (Index i = 1; i < n; ++i) {
+    2b83:	|        |  |  |  |           |  /-> 48 83 c3 01          	add    $0x1,%rbx
+    2b87:	|        |  |  |  |           |  |   48 83 c6 04          	add    $0x4,%rsi
+    2b8b:	|        |  |  |  |           |  |   49 39 db             	cmp    %rbx,%r11
+    2b8e:	|        |  |  +--|-----------|--|-- 74 33                	je     2bc3 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x243>
+            return a < b;
+    2b90:	|        |  |  |  |           >--|-> 8b 0c 9f             	mov    (%rdi,%rbx,4),%ecx
+    2b93:	|        |  |  |  |           |  |   48 89 f0             	mov    %rsi,%rax
+        if (!less(p[i], p[i - 1])) { continue; }
+    2b96:	|        |  |  |  |           |  |   3b 0c 37             	cmp    (%rdi,%rsi,1),%ecx
+    2b99:	|        |  |  |  |           |  \-- 7d e8                	jge    2b83 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x203>
+            p[j] = move(p[j - 1]);
+    2b9b:	|        |  |  |  |  /--------|----> 8b 14 07             	mov    (%rdi,%rax,1),%edx
+    2b9e:	|        |  |  |  |  |        |      89 54 07 04          	mov    %edx,0x4(%rdi,%rax,1)
+        } while (j > 0 && less(t, p[j - 1]));
+    2ba2:	|        |  |  |  |  |        |      48 85 c0             	test   %rax,%rax
+    2ba5:	|        |  |  |  |  |  /-----|----- 74 51                	je     2bf8 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x278>
+    2ba7:	|        |  |  |  |  |  |     |      48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    2bab:	|        |  |  |  |  |  |     |      3b 4c 07 fc          	cmp    -0x4(%rdi,%rax,1),%ecx
+    2baf:	|        |  |  |  |  |  |  /--|----- 7c 4f                	jl     2c00 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x280>
+        p[j] = move(t);
+    2bb1:	|        |  |  |  |  |  |  |  |      48 01 f8             	add    %rdi,%rax
+    2bb4:	|        |  |  |  |  |  |  |  |      89 08                	mov    %ecx,(%rax)
+    for (Index i = 1; i < n; ++i) {
+    2bb6:	|        |  |  |  |  |  |  |  |  /-> 48 83 c3 01          	add    $0x1,%rbx
+    2bba:	|        |  |  |  |  |  |  |  |  |   48 83 c6 04          	add    $0x4,%rsi
+    2bbe:	|        |  |  |  |  |  |  |  |  |   49 39 db             	cmp    %rbx,%r11
+    2bc1:	|        |  |  |  |  |  |  |  \--|-- 75 cd                	jne    2b90 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x210>
+}
+    2bc3:	|        |  |  >--|--|--|--|-----|-> 48 83 c4 10          	add    $0x10,%rsp
+    2bc7:	|        |  |  |  |  |  |  |     |   5b                   	pop    %rbx
+    2bc8:	|        |  |  |  |  |  |  |     |   5d                   	pop    %rbp
+    2bc9:	|        |  |  |  |  |  |  |     |   41 5c                	pop    %r12
+    2bcb:	|        |  |  |  |  |  |  |     |   41 5d                	pop    %r13
+    2bcd:	|        |  |  |  |  |  |  |     |   41 5e                	pop    %r14
+    2bcf:	|        |  |  |  |  |  |  |     |   c3                   	ret
+            Index const m = partition_left(p, n, less);
+    2bd0:	|        |  \--|--|--|--|--|-----|-> 4c 89 de             	mov    %r11,%rsi
+    2bd3:	|        |     |  |  |  |  |     |   e8 28 f8 ff ff       	call   2400 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>
+            if (k <= m) { return; }
+    2bd8:	|        |     |  |  |  |  |     |   4c 39 f0             	cmp    %r14,%rax
+    2bdb:	|        |     \--|--|--|--|-----|-- 73 e6                	jae    2bc3 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x243>
+    2bdd:	|        |        |  |  |  |     |   49 83 eb 01          	sub    $0x1,%r11
+    2be1:	|        |        |  |  |  |     |   49 83 ee 01          	sub    $0x1,%r14
+            p += m + 1;
+    2be5:	|        |        |  |  |  |     |   48 8d 7c 87 04       	lea    0x4(%rdi,%rax,4),%rdi
+            n -= m + 1;
+    2bea:	|        |        |  |  |  |     |   49 29 c3             	sub    %rax,%r11
+            k -= m + 1;
+    2bed:	|        |        |  |  |  |     |   49 29 c6             	sub    %rax,%r14
+    2bf0:	|        |        \--|--|--|-----|-- e9 18 ff ff ff       	jmp    2b0d <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x18d>
+    2bf5:	|        |           |  |  |     |   0f 1f 00             	nopl   (%rax)
+    2bf8:	|        |           |  \--|-----|-> 48 89 f8             	mov    %rdi,%rax
+        p[j] = move(t);
+    2bfb:	|        |           |     |     |   89 08                	mov    %ecx,(%rax)
+    2bfd:	|        |           |     |     \-- eb b7                	jmp    2bb6 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x236>
+    2bff:	|        |           |     |         90                   	nop
+    2c00:	|        |           |     \-------> 48 89 d0             	mov    %rdx,%rax
+    2c03:	|        |           \-------------- eb 96                	jmp    2b9b <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x21b>
+    2c05:	\--------|-------------------------> c3                   	ret
+}
+    2c06:	         \-------------------------> 48 83 c4 10          	add    $0x10,%rsp
+                heap(p, n, less);
+    2c0a:	                                     4c 89 de             	mov    %r11,%rsi
+}
+    2c0d:	                                     5b                   	pop    %rbx
+    2c0e:	                                     5d                   	pop    %rbp
+    2c0f:	                                     41 5c                	pop    %r12
+    2c11:	                                     41 5d                	pop    %r13
+    2c13:	                                     41 5e                	pop    %r14
+                heap(p, n, less);
+    2c15:	                                     e9 16 f6 ff ff       	jmp    2230 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>
+    2c1a:	                                     66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000002c20 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    2c20:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2c25:	c3                   	ret
+    2c26:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2c2d:	00 00 00 
+
+0000000000002c30 <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    2c30:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2c35:	c3                   	ret
+    2c36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2c3d:	00 00 00 
+
+0000000000002c40 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    2c40:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2c45:	c3                   	ret
+    2c46:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2c4d:	00 00 00 
+
+0000000000002c50 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    2c50:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2c55:	c3                   	ret
+    2c56:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2c5d:	00 00 00 
+
+0000000000002c60 <_read_r>:
+int _read_r(struct _reent *, int) {
+    2c60:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2c65:	c3                   	ret
+    2c66:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2c6d:	00 00 00 
+
+0000000000002c70 <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    2c70:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2c75:	c3                   	ret
+    2c76:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2c7d:	00 00 00 
+
+0000000000002c80 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    2c80:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2c85:	c3                   	ret
+    2c86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2c8d:	00 00 00 
+
+0000000000002c90 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    2c90:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2c95:	c3                   	ret
+    2c96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2c9d:	00 00 00 
+
+0000000000002ca0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]>:
+void stable(T p[], Length const n, T buf[], Length const buf_n, F &less)
+    2ca0:	                                                         /-------> 41 57                	push   %r15
+        insertion(p, n, less);
+        return;
+    }
+    Length const h = n / 2;
+    2ca2:	                                                         |         49 89 f7             	mov    %rsi,%r15
+void stable(T p[], Length const n, T buf[], Length const buf_n, F &less)
+    2ca5:	                                                         |         41 56                	push   %r14
+    Length const h = n / 2;
+    2ca7:	                                                         |         49 d1 ef             	shr    %r15
+void stable(T p[], Length const n, T buf[], Length const buf_n, F &less)
+    2caa:	                                                         |         4d 89 c6             	mov    %r8,%r14
+    2cad:	                                                         |         41 55                	push   %r13
+    2caf:	                                                         |         49 89 cd             	mov    %rcx,%r13
+    2cb2:	                                                         |         41 54                	push   %r12
+    2cb4:	                                                         |         55                   	push   %rbp
+    2cb5:	                                                         |         48 89 f5             	mov    %rsi,%rbp
+    2cb8:	                                                         |         53                   	push   %rbx
+    2cb9:	                                                         |         48 89 fb             	mov    %rdi,%rbx
+    2cbc:	                                                         |         48 83 ec 28          	sub    $0x28,%rsp
+    2cc0:	                                                         |         48 89 14 24          	mov    %rdx,(%rsp)
+    if (n < small_n) {
+    2cc4:	                                                         |         48 83 fe 27          	cmp    $0x27,%rsi
+    2cc8:	                                    /--------------------|-------- 0f 86 4a 02 00 00    	jbe    2f18 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x278>
+    Length const h = n / 2;
+    2cce:	                                    |                    |         49 89 f4             	mov    %rsi,%r12
+    2cd1:	                                    |                    |         49 c1 ec 02          	shr    $0x2,%r12
+    if (n < small_n) {
+    2cd5:	                                    |                    |         48 83 fe 4f          	cmp    $0x4f,%rsi
+    2cd9:	                                    |                    |     /-- 0f 86 d1 01 00 00    	jbe    2eb0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x210>
+    Length const h = n / 2;
+    2cdf:	                                    |                    |     |   48 89 f0             	mov    %rsi,%rax
+    2ce2:	                                    |                    |     |   48 c1 e8 03          	shr    $0x3,%rax
+    2ce6:	                                    |                    |     |   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    if (n < small_n) {
+    2ceb:	                                    |                    |     |   48 81 fe 9f 00 00 00 	cmp    $0x9f,%rsi
+    2cf2:	                  /-----------------|--------------------|-----|-- 0f 86 d0 03 00 00    	jbe    30c8 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x428>
+    Length const h = n / 2;
+    2cf8:	                  |                 |                    |     |   48 89 f0             	mov    %rsi,%rax
+    2cfb:	                  |                 |                    |     |   48 c1 e8 04          	shr    $0x4,%rax
+    if (n < small_n) {
+    2cff:	                  |                 |                    |     |   48 81 fe 3f 01 00 00 	cmp    $0x13f,%rsi
+    2d06:	                  |  /--------------|--------------------|-----|-- 0f 86 59 03 00 00    	jbe    3065 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x3c5>
+    Length const h = n / 2;
+    2d0c:	                  |  |              |                    |     |   49 89 f2             	mov    %rsi,%r10
+    2d0f:	                  |  |              |                    |     |   49 c1 ea 05          	shr    $0x5,%r10
+    if (n < small_n) {
+    2d13:	                  |  |              |                    |     |   48 81 fe 7f 02 00 00 	cmp    $0x27f,%rsi
+    2d1a:	/-----------------|--|--------------|--------------------|-----|-- 0f 86 35 05 00 00    	jbe    3255 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x5b5>
+    2d20:	|                 |  |              |                    |     |   4c 89 d6             	mov    %r10,%rsi
+    2d23:	|                 |  |              |                    |     |   48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    2d28:	|                 |  |              |                    |     |   4c 89 54 24 10       	mov    %r10,0x10(%rsp)
+    2d2d:	|                 |  |              |                    +-----|-- e8 6e ff ff ff       	call   2ca0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]>
+    2d32:	|                 |  |              |                    |     |   48 8b 44 24 18       	mov    0x18(%rsp),%rax
+    2d37:	|                 |  |              |                    |     |   4c 8b 54 24 10       	mov    0x10(%rsp),%r10
+    stable(p, h, buf, buf_n, less);
+    stable(p + h, n - h, buf, buf_n, less);
+    2d3c:	|  /--------------|--|--------------|--------------------|-----|-> 49 89 c3             	mov    %rax,%r11
+    2d3f:	|  |              |  |              |                    |     |   4a 8d 3c 93          	lea    (%rbx,%r10,4),%rdi
+    2d43:	|  |              |  |              |                    |     |   4d 29 d3             	sub    %r10,%r11
+    if (n < small_n) {
+    2d46:	|  |              |  |              |                    |     |   49 83 fb 13          	cmp    $0x13,%r11
+    2d4a:	|  |  /-----------|--|--------------|--------------------|-----|-- 0f 86 9d 04 00 00    	jbe    31ed <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x54d>
+    2d50:	|  |  |           |  |              |                    |     |   48 8b 14 24          	mov    (%rsp),%rdx
+    2d54:	|  |  |           |  |              |                    |     |   4d 89 f0             	mov    %r14,%r8
+    2d57:	|  |  |           |  |              |                    |     |   4c 89 e9             	mov    %r13,%rcx
+    2d5a:	|  |  |           |  |              |                    |     |   4c 89 de             	mov    %r11,%rsi
+    2d5d:	|  |  |           |  |              |                    |     |   4c 89 54 24 18       	mov    %r10,0x18(%rsp)
+    2d62:	|  |  |           |  |              |                    |     |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    2d67:	|  |  |           |  |              |                    +-----|-- e8 34 ff ff ff       	call   2ca0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]>
+    2d6c:	|  |  |           |  |              |                    |     |   4c 8b 54 24 18       	mov    0x18(%rsp),%r10
+    2d71:	|  |  |           |  |              |                    |     |   48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    merge(p, h, n, buf, buf_n, less);
+    2d76:	|  |  |  /--------|--|--------------|--------------------|-----|-> 48 8b 0c 24          	mov    (%rsp),%rcx
+    2d7a:	|  |  |  |        |  |              |                    |     |   48 89 c2             	mov    %rax,%rdx
+    2d7d:	|  |  |  |        |  |              |                    |     |   4d 89 f1             	mov    %r14,%r9
+    2d80:	|  |  |  |        |  |              |                    |     |   4d 89 e8             	mov    %r13,%r8
+    2d83:	|  |  |  |        |  |              |                    |     |   4c 89 d6             	mov    %r10,%rsi
+    2d86:	|  |  |  |        |  |              |                    |     |   48 89 df             	mov    %rbx,%rdi
+    2d89:	|  |  |  |        |  |              |                    |     |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    2d8e:	|  |  |  |        |  |              |                    |     |   e8 2d 07 00 00       	call   34c0 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)>
+    2d93:	|  |  |  |        |  |              |                    |     |   48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    stable(p + h, n - h, buf, buf_n, less);
+    2d98:	|  |  |  |        |  |           /--|--------------------|-----|-> 48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    2d9d:	|  |  |  |        |  |           |  |                    |     |   48 8d 3c 83          	lea    (%rbx,%rax,4),%rdi
+    2da1:	|  |  |  |        |  |           |  |                    |     |   48 29 c6             	sub    %rax,%rsi
+    if (n < small_n) {
+    2da4:	|  |  |  |        |  |           |  |                    |     |   48 83 fe 13          	cmp    $0x13,%rsi
+    2da8:	|  |  |  |  /-----|--|-----------|--|--------------------|-----|-- 0f 86 df 03 00 00    	jbe    318d <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x4ed>
+    2dae:	|  |  |  |  |     |  |           |  |                    |     |   48 8b 14 24          	mov    (%rsp),%rdx
+    2db2:	|  |  |  |  |     |  |           |  |                    |     |   4d 89 f0             	mov    %r14,%r8
+    2db5:	|  |  |  |  |     |  |           |  |                    |     |   4c 89 e9             	mov    %r13,%rcx
+    2db8:	|  |  |  |  |     |  |           |  |                    |     |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    2dbd:	|  |  |  |  |     |  |           |  |                    +-----|-- e8 de fe ff ff       	call   2ca0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]>
+    2dc2:	|  |  |  |  |     |  |           |  |                    |     |   48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    merge(p, h, n, buf, buf_n, less);
+    2dc7:	|  |  |  |  |  /--|--|-----------|--|--------------------|-----|-> 48 8b 0c 24          	mov    (%rsp),%rcx
+    2dcb:	|  |  |  |  |  |  |  |           |  |                    |     |   48 8b 54 24 08       	mov    0x8(%rsp),%rdx
+    2dd0:	|  |  |  |  |  |  |  |           |  |                    |     |   4d 89 f1             	mov    %r14,%r9
+    2dd3:	|  |  |  |  |  |  |  |           |  |                    |     |   4d 89 e8             	mov    %r13,%r8
+    2dd6:	|  |  |  |  |  |  |  |           |  |                    |     |   48 89 c6             	mov    %rax,%rsi
+    2dd9:	|  |  |  |  |  |  |  |           |  |                    |     |   48 89 df             	mov    %rbx,%rdi
+    2ddc:	|  |  |  |  |  |  |  |           |  |                    |     |   e8 df 06 00 00       	call   34c0 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)>
+    stable(p + h, n - h, buf, buf_n, less);
+    2de1:	|  |  |  |  |  |  |  |        /--|--|--------------------|-----|-> 48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    2de6:	|  |  |  |  |  |  |  |        |  |  |                    |     |   4c 89 e6             	mov    %r12,%rsi
+    2de9:	|  |  |  |  |  |  |  |        |  |  |                    |     |   48 29 c6             	sub    %rax,%rsi
+    2dec:	|  |  |  |  |  |  |  |        |  |  |                    |     |   48 8d 3c 83          	lea    (%rbx,%rax,4),%rdi
+    if (n < small_n) {
+    2df0:	|  |  |  |  |  |  |  |        |  |  |                    |     |   48 83 fe 13          	cmp    $0x13,%rsi
+    2df4:	|  |  |  |  |  |  |  |     /--|--|--|--------------------|-----|-- 0f 86 2e 03 00 00    	jbe    3128 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x488>
+    2dfa:	|  |  |  |  |  |  |  |     |  |  |  |                    |     |   48 8b 14 24          	mov    (%rsp),%rdx
+    2dfe:	|  |  |  |  |  |  |  |     |  |  |  |                    |     |   4d 89 f0             	mov    %r14,%r8
+    2e01:	|  |  |  |  |  |  |  |     |  |  |  |                    |     |   4c 89 e9             	mov    %r13,%rcx
+    2e04:	|  |  |  |  |  |  |  |     |  |  |  |                    +-----|-- e8 97 fe ff ff       	call   2ca0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]>
+    merge(p, h, n, buf, buf_n, less);
+    2e09:	|  |  |  |  |  |  |  |  /--|--|--|--|--------------------|-----|-> 48 8b 0c 24          	mov    (%rsp),%rcx
+    2e0d:	|  |  |  |  |  |  |  |  |  |  |  |  |                    |     |   48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    2e12:	|  |  |  |  |  |  |  |  |  |  |  |  |                    |     |   4d 89 f1             	mov    %r14,%r9
+    2e15:	|  |  |  |  |  |  |  |  |  |  |  |  |                    |     |   4d 89 e8             	mov    %r13,%r8
+    2e18:	|  |  |  |  |  |  |  |  |  |  |  |  |                    |     |   4c 89 e2             	mov    %r12,%rdx
+    2e1b:	|  |  |  |  |  |  |  |  |  |  |  |  |                    |     |   48 89 df             	mov    %rbx,%rdi
+    2e1e:	|  |  |  |  |  |  |  |  |  |  |  |  |                    |     |   e8 9d 06 00 00       	call   34c0 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)>
+    stable(p + h, n - h, buf, buf_n, less);
+    2e23:	|  |  |  |  |  |  |  |  |  |  |  |  |                    |  /--|-> 4c 89 fe             	mov    %r15,%rsi
+    2e26:	|  |  |  |  |  |  |  |  |  |  |  |  |                    |  |  |   4a 8d 3c a3          	lea    (%rbx,%r12,4),%rdi
+    2e2a:	|  |  |  |  |  |  |  |  |  |  |  |  |                    |  |  |   4c 29 e6             	sub    %r12,%rsi
+    if (n < small_n) {
+    2e2d:	|  |  |  |  |  |  |  |  |  |  |  |  |                    |  |  |   48 83 fe 13          	cmp    $0x13,%rsi
+    2e31:	|  |  |  |  |  |  |  |  |  |  |  |  |     /--------------|--|--|-- 0f 86 b1 01 00 00    	jbe    2fe8 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x348>
+    2e37:	|  |  |  |  |  |  |  |  |  |  |  |  |     |              |  |  |   48 8b 14 24          	mov    (%rsp),%rdx
+    2e3b:	|  |  |  |  |  |  |  |  |  |  |  |  |     |              |  |  |   4d 89 f0             	mov    %r14,%r8
+    2e3e:	|  |  |  |  |  |  |  |  |  |  |  |  |     |              |  |  |   4c 89 e9             	mov    %r13,%rcx
+    2e41:	|  |  |  |  |  |  |  |  |  |  |  |  |     |              +--|--|-- e8 5a fe ff ff       	call   2ca0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]>
+    merge(p, h, n, buf, buf_n, less);
+    2e46:	|  |  |  |  |  |  |  |  |  |  |  |  |  /--|--------------|--|--|-> 48 8b 0c 24          	mov    (%rsp),%rcx
+    2e4a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |              |  |  |   4d 89 f1             	mov    %r14,%r9
+    2e4d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |              |  |  |   4d 89 e8             	mov    %r13,%r8
+    2e50:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |              |  |  |   4c 89 fa             	mov    %r15,%rdx
+    2e53:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |              |  |  |   4c 89 e6             	mov    %r12,%rsi
+    2e56:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |              |  |  |   48 89 df             	mov    %rbx,%rdi
+    2e59:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |              |  |  |   e8 62 06 00 00       	call   34c0 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)>
+    stable(p + h, n - h, buf, buf_n, less);
+    2e5e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |        /-----|--|--|-> 48 89 ee             	mov    %rbp,%rsi
+    2e61:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |   4a 8d 3c bb          	lea    (%rbx,%r15,4),%rdi
+    2e65:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |   4c 29 fe             	sub    %r15,%rsi
+    if (n < small_n) {
+    2e68:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |   48 83 fe 13          	cmp    $0x13,%rsi
+    2e6c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     /--|-----|--|--|-- 0f 86 06 01 00 00    	jbe    2f78 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x2d8>
+    2e72:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |  |   48 8b 14 24          	mov    (%rsp),%rdx
+    2e76:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |  |   4d 89 f0             	mov    %r14,%r8
+    2e79:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |  |  |   4c 89 e9             	mov    %r13,%rcx
+    2e7c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     \--|--|-- e8 1f fe ff ff       	call   2ca0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]>
+    merge(p, h, n, buf, buf_n, less);
+    2e81:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|--------|--|-> 48 8b 0c 24          	mov    (%rsp),%rcx
+}
+    2e85:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |   48 83 c4 28          	add    $0x28,%rsp
+    merge(p, h, n, buf, buf_n, less);
+    2e89:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |   4d 89 f1             	mov    %r14,%r9
+    2e8c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |   4d 89 e8             	mov    %r13,%r8
+    2e8f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |   48 89 ea             	mov    %rbp,%rdx
+    2e92:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |   4c 89 fe             	mov    %r15,%rsi
+    2e95:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |   48 89 df             	mov    %rbx,%rdi
+}
+    2e98:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |   5b                   	pop    %rbx
+    2e99:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |   5d                   	pop    %rbp
+    2e9a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |   41 5c                	pop    %r12
+    2e9c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |   41 5d                	pop    %r13
+    2e9e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |   41 5e                	pop    %r14
+    2ea0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |   41 5f                	pop    %r15
+    merge(p, h, n, buf, buf_n, less);
+    2ea2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |   e9 19 06 00 00       	jmp    34c0 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)>
+    2ea7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |   66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    2eae:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |   00 00 
+    if (n < small_n) {
+    2eb0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  \-> 31 ff                	xor    %edi,%edi
+    for (Index i = 1; i < n; ++i) {
+    2eb2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |      be 01 00 00 00       	mov    $0x1,%esi
+    2eb7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  /-- eb 18                	jmp    2ed1 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x231>
+    2eb9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    2ec0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-----|--|-> 48 83 c6 01          	add    $0x1,%rsi
+    2ec4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |   48 83 c7 04          	add    $0x4,%rdi
+    2ec8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |   4c 39 e6             	cmp    %r12,%rsi
+    2ecb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     \--|-- 0f 84 52 ff ff ff    	je     2e23 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x183>
+            return a < b;
+    2ed1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        \-> 8b 0c b3             	mov    (%rbx,%rsi,4),%ecx
+    2ed4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            48 89 f8             	mov    %rdi,%rax
+        if (!less(p[i], p[i - 1])) { continue; }
+    2ed7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            3b 0c 3b             	cmp    (%rbx,%rdi,1),%ecx
+    2eda:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  +----------- 7d e4                	jge    2ec0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x220>
+            p[j] = move(p[j - 1]);
+    2edc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-------> 8b 14 03             	mov    (%rbx,%rax,1),%edx
+    2edf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         89 54 03 04          	mov    %edx,0x4(%rbx,%rax,1)
+        } while (j > 0 && less(t, p[j - 1]));
+    2ee3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 85 c0             	test   %rax,%rax
+    2ee6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     /-- 74 18                	je     2f00 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x260>
+    2ee8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    2eec:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   3b 4c 03 fc          	cmp    -0x4(%rbx,%rax,1),%ecx
+    2ef0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|-- 7c 1e                	jl     2f10 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x270>
+        p[j] = move(t);
+    2ef2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 01 d8             	add    %rbx,%rax
+    2ef5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   89 08                	mov    %ecx,(%rax)
+    2ef7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  +--|--|--|-- eb c7                	jmp    2ec0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x220>
+    2ef9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    2f00:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \-> 48 89 d8             	mov    %rbx,%rax
+    2f03:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      89 08                	mov    %ecx,(%rax)
+    2f05:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \--|--|----- eb b9                	jmp    2ec0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x220>
+    2f07:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |      66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    2f0e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |      00 00 
+    2f10:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  \----> 48 89 d0             	mov    %rdx,%rax
+    2f13:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     \-------- eb c7                	jmp    2edc <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x23c>
+    2f15:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               0f 1f 00             	nopl   (%rax)
+    2f18:	|  |  |  |  |  |  |  |  |  |  |  |  \--|--|--|--|--|-------------> 31 ff                	xor    %edi,%edi
+    for (Index i = 1; i < n; ++i) {
+    2f1a:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |               be 01 00 00 00       	mov    $0x1,%esi
+    2f1f:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |           /-- eb 18                	jmp    2f39 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x299>
+    2f21:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |           |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    2f28:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  /--------|-> 48 83 c6 01          	add    $0x1,%rsi
+    2f2c:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |        |   48 83 c7 04          	add    $0x4,%rdi
+    2f30:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |        |   49 39 f7             	cmp    %rsi,%r15
+    2f33:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  \--|--------|-- 0f 84 25 ff ff ff    	je     2e5e <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x1be>
+            return a < b;
+    2f39:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |        \-> 8b 0c b3             	mov    (%rbx,%rsi,4),%ecx
+    2f3c:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |            48 89 f8             	mov    %rdi,%rax
+        if (!less(p[i], p[i - 1])) { continue; }
+    2f3f:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |            3b 0c 3b             	cmp    (%rbx,%rdi,1),%ecx
+    2f42:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     +----------- 7d e4                	jge    2f28 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x288>
+            p[j] = move(p[j - 1]);
+    2f44:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  /-------> 8b 14 03             	mov    (%rbx,%rax,1),%edx
+    2f47:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |         89 54 03 04          	mov    %edx,0x4(%rbx,%rax,1)
+        } while (j > 0 && less(t, p[j - 1]));
+    2f4b:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |         48 85 c0             	test   %rax,%rax
+    2f4e:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |  /----- 74 18                	je     2f68 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x2c8>
+    2f50:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |      48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    2f54:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |      3b 4c 03 fc          	cmp    -0x4(%rbx,%rax,1),%ecx
+    2f58:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  /-- 7c 16                	jl     2f70 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x2d0>
+        p[j] = move(t);
+    2f5a:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  |   48 01 d8             	add    %rbx,%rax
+    2f5d:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  |   89 08                	mov    %ecx,(%rax)
+    2f5f:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     +--|--|--|-- eb c7                	jmp    2f28 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x288>
+    2f61:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |  |  |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    2f68:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |  \--|-> 48 89 d8             	mov    %rbx,%rax
+    2f6b:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |     |   89 08                	mov    %ecx,(%rax)
+    2f6d:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     \--|-----|-- eb b9                	jmp    2f28 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x288>
+    2f6f:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |        |     |   90                   	nop
+    2f70:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |        |     \-> 48 89 d0             	mov    %rdx,%rax
+    2f73:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |        \-------- eb cf                	jmp    2f44 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x2a4>
+    2f75:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |                  0f 1f 00             	nopl   (%rax)
+    for (Index i = 1; i < n; ++i) {
+    2f78:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  \----------------> 45 31 c9             	xor    %r9d,%r9d
+    2f7b:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |                     41 b8 01 00 00 00    	mov    $0x1,%r8d
+    2f81:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |                     48 83 fe 01          	cmp    $0x1,%rsi
+    2f85:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |                 /-- 77 1a                	ja     2fa1 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x301>
+    2f87:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  +-----------------|-- e9 f5 fe ff ff       	jmp    2e81 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x1e1>
+    2f8c:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |                 |   0f 1f 40 00          	nopl   0x0(%rax)
+    2f90:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |        /--------|-> 49 83 c0 01          	add    $0x1,%r8
+    2f94:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |        |   49 83 c1 04          	add    $0x4,%r9
+    2f98:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |        |   4c 39 c6             	cmp    %r8,%rsi
+    2f9b:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  \--------|--------|-- 0f 84 e0 fe ff ff    	je     2e81 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x1e1>
+            return a < b;
+    2fa1:	|  |  |  |  |  |  |  |  |  |  |  |     |  |           |        \-> 42 8b 0c 87          	mov    (%rdi,%r8,4),%ecx
+    2fa5:	|  |  |  |  |  |  |  |  |  |  |  |     |  |           |            4c 89 c8             	mov    %r9,%rax
+        if (!less(p[i], p[i - 1])) { continue; }
+    2fa8:	|  |  |  |  |  |  |  |  |  |  |  |     |  |           |            42 3b 0c 0f          	cmp    (%rdi,%r9,1),%ecx
+    2fac:	|  |  |  |  |  |  |  |  |  |  |  |     |  |           +----------- 7d e2                	jge    2f90 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x2f0>
+            p[j] = move(p[j - 1]);
+    2fae:	|  |  |  |  |  |  |  |  |  |  |  |     |  |           |  /-------> 8b 14 07             	mov    (%rdi,%rax,1),%edx
+    2fb1:	|  |  |  |  |  |  |  |  |  |  |  |     |  |           |  |         89 54 07 04          	mov    %edx,0x4(%rdi,%rax,1)
+        } while (j > 0 && less(t, p[j - 1]));
+    2fb5:	|  |  |  |  |  |  |  |  |  |  |  |     |  |           |  |         48 85 c0             	test   %rax,%rax
+    2fb8:	|  |  |  |  |  |  |  |  |  |  |  |     |  |           |  |     /-- 74 16                	je     2fd0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x330>
+    2fba:	|  |  |  |  |  |  |  |  |  |  |  |     |  |           |  |     |   48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    2fbe:	|  |  |  |  |  |  |  |  |  |  |  |     |  |           |  |     |   3b 4c 07 fc          	cmp    -0x4(%rdi,%rax,1),%ecx
+    2fc2:	|  |  |  |  |  |  |  |  |  |  |  |     |  |           |  |  /--|-- 7c 1c                	jl     2fe0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x340>
+        p[j] = move(t);
+    2fc4:	|  |  |  |  |  |  |  |  |  |  |  |     |  |           |  |  |  |   48 01 f8             	add    %rdi,%rax
+    2fc7:	|  |  |  |  |  |  |  |  |  |  |  |     |  |           |  |  |  |   89 08                	mov    %ecx,(%rax)
+    2fc9:	|  |  |  |  |  |  |  |  |  |  |  |     |  |           +--|--|--|-- eb c5                	jmp    2f90 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x2f0>
+    2fcb:	|  |  |  |  |  |  |  |  |  |  |  |     |  |           |  |  |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    2fd0:	|  |  |  |  |  |  |  |  |  |  |  |     |  |           |  |  |  \-> 48 89 f8             	mov    %rdi,%rax
+    2fd3:	|  |  |  |  |  |  |  |  |  |  |  |     |  |           |  |  |      89 08                	mov    %ecx,(%rax)
+    2fd5:	|  |  |  |  |  |  |  |  |  |  |  |     |  |           \--|--|----- eb b9                	jmp    2f90 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x2f0>
+    2fd7:	|  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |      66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    2fde:	|  |  |  |  |  |  |  |  |  |  |  |     |  |              |  |      00 00 
+    2fe0:	|  |  |  |  |  |  |  |  |  |  |  |     |  |              |  \----> 48 89 d0             	mov    %rdx,%rax
+    2fe3:	|  |  |  |  |  |  |  |  |  |  |  |     |  |              \-------- eb c9                	jmp    2fae <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x30e>
+    2fe5:	|  |  |  |  |  |  |  |  |  |  |  |     |  |                        0f 1f 00             	nopl   (%rax)
+    for (Index i = 1; i < n; ++i) {
+    2fe8:	|  |  |  |  |  |  |  |  |  |  |  |     |  \----------------------> 45 31 c9             	xor    %r9d,%r9d
+    2feb:	|  |  |  |  |  |  |  |  |  |  |  |     |                           41 b8 01 00 00 00    	mov    $0x1,%r8d
+    2ff1:	|  |  |  |  |  |  |  |  |  |  |  |     |                           48 83 fe 01          	cmp    $0x1,%rsi
+    2ff5:	|  |  |  |  |  |  |  |  |  |  |  |     +-------------------------- 0f 86 4b fe ff ff    	jbe    2e46 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x1a6>
+            return a < b;
+    2ffb:	|  |  |  |  |  |  |  |  |  |  |  |     |                           42 8b 0c 87          	mov    (%rdi,%r8,4),%ecx
+    2fff:	|  |  |  |  |  |  |  |  |  |  |  |     |                           4c 89 c8             	mov    %r9,%rax
+        if (!less(p[i], p[i - 1])) { continue; }
+    3002:	|  |  |  |  |  |  |  |  |  |  |  |     |                           42 3b 0c 0f          	cmp    (%rdi,%r9,1),%ecx
+    3006:	|  |  |  |  |  |  |  |  |  |  |  |     |              /----------- 7c 26                	jl     302e <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x38e>
+    3008:	|  |  |  |  |  |  |  |  |  |  |  |     |              |            0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    300f:	|  |  |  |  |  |  |  |  |  |  |  |     |              |            00 
+    for (Index i = 1; i < n; ++i) {
+    3010:	|  |  |  |  |  |  |  |  |  |  |  |     |              |  /-------> 49 83 c0 01          	add    $0x1,%r8
+    3014:	|  |  |  |  |  |  |  |  |  |  |  |     |              |  |         49 83 c1 04          	add    $0x4,%r9
+    3018:	|  |  |  |  |  |  |  |  |  |  |  |     |              |  |         4c 39 c6             	cmp    %r8,%rsi
+    301b:	|  |  |  |  |  |  |  |  |  |  |  |     \--------------|--|-------- 0f 84 25 fe ff ff    	je     2e46 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x1a6>
+            return a < b;
+    3021:	|  |  |  |  |  |  |  |  |  |  |  |                    |  |         42 8b 0c 87          	mov    (%rdi,%r8,4),%ecx
+    3025:	|  |  |  |  |  |  |  |  |  |  |  |                    |  |         4c 89 c8             	mov    %r9,%rax
+        if (!less(p[i], p[i - 1])) { continue; }
+    3028:	|  |  |  |  |  |  |  |  |  |  |  |                    |  |         42 3b 0c 0f          	cmp    (%rdi,%r9,1),%ecx
+    302c:	|  |  |  |  |  |  |  |  |  |  |  |                    |  +-------- 7d e2                	jge    3010 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x370>
+            p[j] = move(p[j - 1]);
+    302e:	|  |  |  |  |  |  |  |  |  |  |  |                    >--|-------> 8b 14 07             	mov    (%rdi,%rax,1),%edx
+    3031:	|  |  |  |  |  |  |  |  |  |  |  |                    |  |         89 54 07 04          	mov    %edx,0x4(%rdi,%rax,1)
+        } while (j > 0 && less(t, p[j - 1]));
+    3035:	|  |  |  |  |  |  |  |  |  |  |  |                    |  |         48 85 c0             	test   %rax,%rax
+    3038:	|  |  |  |  |  |  |  |  |  |  |  |                    |  |     /-- 74 16                	je     3050 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x3b0>
+    303a:	|  |  |  |  |  |  |  |  |  |  |  |                    |  |     |   48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    303e:	|  |  |  |  |  |  |  |  |  |  |  |                    |  |     |   3b 4c 07 fc          	cmp    -0x4(%rdi,%rax,1),%ecx
+    3042:	|  |  |  |  |  |  |  |  |  |  |  |                    |  |  /--|-- 7c 1c                	jl     3060 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x3c0>
+        p[j] = move(t);
+    3044:	|  |  |  |  |  |  |  |  |  |  |  |                    |  |  |  |   48 01 f8             	add    %rdi,%rax
+    3047:	|  |  |  |  |  |  |  |  |  |  |  |                    |  |  |  |   89 08                	mov    %ecx,(%rax)
+    3049:	|  |  |  |  |  |  |  |  |  |  |  |                    |  +--|--|-- eb c5                	jmp    3010 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x370>
+    304b:	|  |  |  |  |  |  |  |  |  |  |  |                    |  |  |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    3050:	|  |  |  |  |  |  |  |  |  |  |  |                    |  |  |  \-> 48 89 f8             	mov    %rdi,%rax
+    3053:	|  |  |  |  |  |  |  |  |  |  |  |                    |  |  |      89 08                	mov    %ecx,(%rax)
+    3055:	|  |  |  |  |  |  |  |  |  |  |  |                    |  \--|----- eb b9                	jmp    3010 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x370>
+    3057:	|  |  |  |  |  |  |  |  |  |  |  |                    |     |      66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    305e:	|  |  |  |  |  |  |  |  |  |  |  |                    |     |      00 00 
+    3060:	|  |  |  |  |  |  |  |  |  |  |  |                    |     \----> 48 89 d0             	mov    %rdx,%rax
+    3063:	|  |  |  |  |  |  |  |  |  |  |  |                    \----------- eb c9                	jmp    302e <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x38e>
+    if (n < small_n) {
+    3065:	|  |  |  |  |  |  |  \--|--|--|--|-------------------------------> 45 31 c0             	xor    %r8d,%r8d
+    for (Index i = 1; i < n; ++i) {
+    3068:	|  |  |  |  |  |  |     |  |  |  |                                 bf 01 00 00 00       	mov    $0x1,%edi
+    306d:	|  |  |  |  |  |  |     |  |  |  |                             /-- eb 12                	jmp    3081 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x3e1>
+    306f:	|  |  |  |  |  |  |     |  |  |  |                             |   90                   	nop
+    3070:	|  |  |  |  |  |  |     |  |  |  |                    /--------|-> 48 83 c7 01          	add    $0x1,%rdi
+    3074:	|  |  |  |  |  |  |     |  |  |  |                    |        |   49 83 c0 04          	add    $0x4,%r8
+    3078:	|  |  |  |  |  |  |     |  |  |  |                    |        |   48 39 c7             	cmp    %rax,%rdi
+    307b:	|  |  |  |  |  |  |     |  |  |  \--------------------|--------|-- 0f 84 17 fd ff ff    	je     2d98 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0xf8>
+            return a < b;
+    3081:	|  |  |  |  |  |  |     |  |  |                       |        \-> 8b 34 bb             	mov    (%rbx,%rdi,4),%esi
+    3084:	|  |  |  |  |  |  |     |  |  |                       |            4c 89 c2             	mov    %r8,%rdx
+        if (!less(p[i], p[i - 1])) { continue; }
+    3087:	|  |  |  |  |  |  |     |  |  |                       |            42 3b 34 03          	cmp    (%rbx,%r8,1),%esi
+    308b:	|  |  |  |  |  |  |     |  |  |                       +----------- 7d e3                	jge    3070 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x3d0>
+            p[j] = move(p[j - 1]);
+    308d:	|  |  |  |  |  |  |     |  |  |                       |  /-------> 8b 0c 13             	mov    (%rbx,%rdx,1),%ecx
+    3090:	|  |  |  |  |  |  |     |  |  |                       |  |         89 4c 13 04          	mov    %ecx,0x4(%rbx,%rdx,1)
+        } while (j > 0 && less(t, p[j - 1]));
+    3094:	|  |  |  |  |  |  |     |  |  |                       |  |         48 85 d2             	test   %rdx,%rdx
+    3097:	|  |  |  |  |  |  |     |  |  |                       |  |     /-- 74 17                	je     30b0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x410>
+    3099:	|  |  |  |  |  |  |     |  |  |                       |  |     |   48 8d 4a fc          	lea    -0x4(%rdx),%rcx
+    309d:	|  |  |  |  |  |  |     |  |  |                       |  |     |   3b 74 13 fc          	cmp    -0x4(%rbx,%rdx,1),%esi
+    30a1:	|  |  |  |  |  |  |     |  |  |                       |  |  /--|-- 7c 1d                	jl     30c0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x420>
+        p[j] = move(t);
+    30a3:	|  |  |  |  |  |  |     |  |  |                       |  |  |  |   48 01 da             	add    %rbx,%rdx
+    30a6:	|  |  |  |  |  |  |     |  |  |                       |  |  |  |   89 32                	mov    %esi,(%rdx)
+    30a8:	|  |  |  |  |  |  |     |  |  |                       +--|--|--|-- eb c6                	jmp    3070 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x3d0>
+    30aa:	|  |  |  |  |  |  |     |  |  |                       |  |  |  |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    30b0:	|  |  |  |  |  |  |     |  |  |                       |  |  |  \-> 48 89 da             	mov    %rbx,%rdx
+    30b3:	|  |  |  |  |  |  |     |  |  |                       |  |  |      89 32                	mov    %esi,(%rdx)
+    30b5:	|  |  |  |  |  |  |     |  |  |                       \--|--|----- eb b9                	jmp    3070 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x3d0>
+    30b7:	|  |  |  |  |  |  |     |  |  |                          |  |      66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    30be:	|  |  |  |  |  |  |     |  |  |                          |  |      00 00 
+    30c0:	|  |  |  |  |  |  |     |  |  |                          |  \----> 48 89 ca             	mov    %rcx,%rdx
+    30c3:	|  |  |  |  |  |  |     |  |  |                          \-------- eb c8                	jmp    308d <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x3ed>
+    30c5:	|  |  |  |  |  |  |     |  |  |                                    0f 1f 00             	nopl   (%rax)
+    30c8:	|  |  |  |  |  |  \-----|--|--|----------------------------------> 31 ff                	xor    %edi,%edi
+    for (Index i = 1; i < n; ++i) {
+    30ca:	|  |  |  |  |  |        |  |  |                                    be 01 00 00 00       	mov    $0x1,%esi
+    30cf:	|  |  |  |  |  |        |  |  |                                    49 89 c0             	mov    %rax,%r8
+    30d2:	|  |  |  |  |  |        |  |  |                                /-- eb 15                	jmp    30e9 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x449>
+    30d4:	|  |  |  |  |  |        |  |  |                                |   0f 1f 40 00          	nopl   0x0(%rax)
+    30d8:	|  |  |  |  |  |        |  |  |                       /--------|-> 48 83 c6 01          	add    $0x1,%rsi
+    30dc:	|  |  |  |  |  |        |  |  |                       |        |   48 83 c7 04          	add    $0x4,%rdi
+    30e0:	|  |  |  |  |  |        |  |  |                       |        |   49 39 f0             	cmp    %rsi,%r8
+    30e3:	|  |  |  |  |  |        |  |  \-----------------------|--------|-- 0f 84 f8 fc ff ff    	je     2de1 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x141>
+            return a < b;
+    30e9:	|  |  |  |  |  |        |  |                          |        \-> 8b 0c b3             	mov    (%rbx,%rsi,4),%ecx
+    30ec:	|  |  |  |  |  |        |  |                          |            48 89 f8             	mov    %rdi,%rax
+        if (!less(p[i], p[i - 1])) { continue; }
+    30ef:	|  |  |  |  |  |        |  |                          |            3b 0c 3b             	cmp    (%rbx,%rdi,1),%ecx
+    30f2:	|  |  |  |  |  |        |  |                          +----------- 7d e4                	jge    30d8 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x438>
+            p[j] = move(p[j - 1]);
+    30f4:	|  |  |  |  |  |        |  |                          |  /-------> 8b 14 03             	mov    (%rbx,%rax,1),%edx
+    30f7:	|  |  |  |  |  |        |  |                          |  |         89 54 03 04          	mov    %edx,0x4(%rbx,%rax,1)
+        } while (j > 0 && less(t, p[j - 1]));
+    30fb:	|  |  |  |  |  |        |  |                          |  |         48 85 c0             	test   %rax,%rax
+    30fe:	|  |  |  |  |  |        |  |                          |  |  /----- 74 18                	je     3118 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x478>
+    3100:	|  |  |  |  |  |        |  |                          |  |  |      48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    3104:	|  |  |  |  |  |        |  |                          |  |  |      3b 4c 03 fc          	cmp    -0x4(%rbx,%rax,1),%ecx
+    3108:	|  |  |  |  |  |        |  |                          |  |  |  /-- 7c 16                	jl     3120 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x480>
+        p[j] = move(t);
+    310a:	|  |  |  |  |  |        |  |                          |  |  |  |   48 01 d8             	add    %rbx,%rax
+    310d:	|  |  |  |  |  |        |  |                          |  |  |  |   89 08                	mov    %ecx,(%rax)
+    310f:	|  |  |  |  |  |        |  |                          +--|--|--|-- eb c7                	jmp    30d8 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x438>
+    3111:	|  |  |  |  |  |        |  |                          |  |  |  |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    3118:	|  |  |  |  |  |        |  |                          |  |  \--|-> 48 89 d8             	mov    %rbx,%rax
+    311b:	|  |  |  |  |  |        |  |                          |  |     |   89 08                	mov    %ecx,(%rax)
+    311d:	|  |  |  |  |  |        |  |                          \--|-----|-- eb b9                	jmp    30d8 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x438>
+    311f:	|  |  |  |  |  |        |  |                             |     |   90                   	nop
+    3120:	|  |  |  |  |  |        |  |                             |     \-> 48 89 d0             	mov    %rdx,%rax
+    3123:	|  |  |  |  |  |        |  |                             \-------- eb cf                	jmp    30f4 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x454>
+    3125:	|  |  |  |  |  |        |  |                                       0f 1f 00             	nopl   (%rax)
+    for (Index i = 1; i < n; ++i) {
+    3128:	|  |  |  |  |  |        |  \-------------------------------------> 45 31 c0             	xor    %r8d,%r8d
+    312b:	|  |  |  |  |  |        |                                          b9 01 00 00 00       	mov    $0x1,%ecx
+    3130:	|  |  |  |  |  |        |                                          48 83 fe 01          	cmp    $0x1,%rsi
+    3134:	|  |  |  |  |  |        |                                      /-- 77 1b                	ja     3151 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x4b1>
+    3136:	|  |  |  |  |  |        +--------------------------------------|-- e9 ce fc ff ff       	jmp    2e09 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x169>
+    313b:	|  |  |  |  |  |        |                                      |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    3140:	|  |  |  |  |  |        |                          /-----------|-> 48 83 c1 01          	add    $0x1,%rcx
+    3144:	|  |  |  |  |  |        |                          |           |   49 83 c0 04          	add    $0x4,%r8
+    3148:	|  |  |  |  |  |        |                          |           |   48 39 ce             	cmp    %rcx,%rsi
+    314b:	|  |  |  |  |  |        \--------------------------|-----------|-- 0f 84 b8 fc ff ff    	je     2e09 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x169>
+            return a < b;
+    3151:	|  |  |  |  |  |                                   |           \-> 44 8b 0c 8f          	mov    (%rdi,%rcx,4),%r9d
+    3155:	|  |  |  |  |  |                                   |               4c 89 c0             	mov    %r8,%rax
+        if (!less(p[i], p[i - 1])) { continue; }
+    3158:	|  |  |  |  |  |                                   |               46 3b 0c 07          	cmp    (%rdi,%r8,1),%r9d
+    315c:	|  |  |  |  |  |                                   +-------------- 7d e2                	jge    3140 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x4a0>
+            p[j] = move(p[j - 1]);
+    315e:	|  |  |  |  |  |                                   |  /----------> 8b 14 07             	mov    (%rdi,%rax,1),%edx
+    3161:	|  |  |  |  |  |                                   |  |            89 54 07 04          	mov    %edx,0x4(%rdi,%rax,1)
+        } while (j > 0 && less(t, p[j - 1]));
+    3165:	|  |  |  |  |  |                                   |  |            48 85 c0             	test   %rax,%rax
+    3168:	|  |  |  |  |  |                                   |  |  /-------- 74 16                	je     3180 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x4e0>
+    316a:	|  |  |  |  |  |                                   |  |  |         48 8d 50 fc          	lea    -0x4(%rax),%rdx
+    316e:	|  |  |  |  |  |                                   |  |  |         44 3b 4c 07 fc       	cmp    -0x4(%rdi,%rax,1),%r9d
+    3173:	|  |  |  |  |  |                                   |  |  |  /----- 7c 13                	jl     3188 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x4e8>
+        p[j] = move(t);
+    3175:	|  |  |  |  |  |                                   |  |  |  |      48 01 f8             	add    %rdi,%rax
+    3178:	|  |  |  |  |  |                                   |  |  |  |  /-> 44 89 08             	mov    %r9d,(%rax)
+    317b:	|  |  |  |  |  |                                   \--|--|--|--|-- eb c3                	jmp    3140 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x4a0>
+    317d:	|  |  |  |  |  |                                      |  |  |  |   0f 1f 00             	nopl   (%rax)
+    3180:	|  |  |  |  |  |                                      |  \--|--|-> 48 89 f8             	mov    %rdi,%rax
+    3183:	|  |  |  |  |  |                                      |     |  \-- eb f3                	jmp    3178 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x4d8>
+    3185:	|  |  |  |  |  |                                      |     |      0f 1f 00             	nopl   (%rax)
+    3188:	|  |  |  |  |  |                                      |     \----> 48 89 d0             	mov    %rdx,%rax
+    318b:	|  |  |  |  |  |                                      \----------- eb d1                	jmp    315e <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x4be>
+    for (Index i = 1; i < n; ++i) {
+    318d:	|  |  |  |  \--|-------------------------------------------------> 45 31 c0             	xor    %r8d,%r8d
+    3190:	|  |  |  |     |                                                   b9 01 00 00 00       	mov    $0x1,%ecx
+    3195:	|  |  |  |     |                                                   48 83 fe 01          	cmp    $0x1,%rsi
+    3199:	|  |  |  |     |                                               /-- 77 16                	ja     31b1 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x511>
+    319b:	|  |  |  |     +-----------------------------------------------|-- e9 27 fc ff ff       	jmp    2dc7 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x127>
+    31a0:	|  |  |  |     |                                   /-----------|-> 48 83 c1 01          	add    $0x1,%rcx
+    31a4:	|  |  |  |     |                                   |           |   49 83 c0 04          	add    $0x4,%r8
+    31a8:	|  |  |  |     |                                   |           |   48 39 ce             	cmp    %rcx,%rsi
+    31ab:	|  |  |  |     \-----------------------------------|-----------|-- 0f 84 16 fc ff ff    	je     2dc7 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x127>
+            return a < b;
+    31b1:	|  |  |  |                                         |           \-> 44 8b 14 8f          	mov    (%rdi,%rcx,4),%r10d
+    31b5:	|  |  |  |                                         |               4c 89 c2             	mov    %r8,%rdx
+        if (!less(p[i], p[i - 1])) { continue; }
+    31b8:	|  |  |  |                                         |               46 3b 14 07          	cmp    (%rdi,%r8,1),%r10d
+    31bc:	|  |  |  |                                         +-------------- 7d e2                	jge    31a0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x500>
+            p[j] = move(p[j - 1]);
+    31be:	|  |  |  |                                         |  /----------> 44 8b 0c 17          	mov    (%rdi,%rdx,1),%r9d
+    31c2:	|  |  |  |                                         |  |            44 89 4c 17 04       	mov    %r9d,0x4(%rdi,%rdx,1)
+        } while (j > 0 && less(t, p[j - 1]));
+    31c7:	|  |  |  |                                         |  |            48 85 d2             	test   %rdx,%rdx
+    31ca:	|  |  |  |                                         |  |  /-------- 74 14                	je     31e0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x540>
+    31cc:	|  |  |  |                                         |  |  |         4c 8d 4a fc          	lea    -0x4(%rdx),%r9
+    31d0:	|  |  |  |                                         |  |  |         44 3b 54 17 fc       	cmp    -0x4(%rdi,%rdx,1),%r10d
+    31d5:	|  |  |  |                                         |  |  |  /----- 7c 11                	jl     31e8 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x548>
+        p[j] = move(t);
+    31d7:	|  |  |  |                                         |  |  |  |      48 01 fa             	add    %rdi,%rdx
+    31da:	|  |  |  |                                         |  |  |  |  /-> 44 89 12             	mov    %r10d,(%rdx)
+    31dd:	|  |  |  |                                         \--|--|--|--|-- eb c1                	jmp    31a0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x500>
+    31df:	|  |  |  |                                            |  |  |  |   90                   	nop
+    31e0:	|  |  |  |                                            |  \--|--|-> 48 89 fa             	mov    %rdi,%rdx
+    31e3:	|  |  |  |                                            |     |  \-- eb f5                	jmp    31da <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x53a>
+    31e5:	|  |  |  |                                            |     |      0f 1f 00             	nopl   (%rax)
+    31e8:	|  |  |  |                                            |     \----> 4c 89 ca             	mov    %r9,%rdx
+    31eb:	|  |  |  |                                            \----------- eb d1                	jmp    31be <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x51e>
+    for (Index i = 1; i < n; ++i) {
+    31ed:	|  |  \--|-------------------------------------------------------> 45 31 c0             	xor    %r8d,%r8d
+    31f0:	|  |     |                                                         be 01 00 00 00       	mov    $0x1,%esi
+    31f5:	|  |     |                                                         49 83 fb 01          	cmp    $0x1,%r11
+    31f9:	|  |     |                                                     /-- 77 16                	ja     3211 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x571>
+    31fb:	|  |     +-----------------------------------------------------|-- e9 76 fb ff ff       	jmp    2d76 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0xd6>
+    3200:	|  |     |                                            /--------|-> 48 83 c6 01          	add    $0x1,%rsi
+    3204:	|  |     |                                            |        |   49 83 c0 04          	add    $0x4,%r8
+    3208:	|  |     |                                            |        |   49 39 f3             	cmp    %rsi,%r11
+    320b:	|  |     \--------------------------------------------|--------|-- 0f 84 65 fb ff ff    	je     2d76 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0xd6>
+            return a < b;
+    3211:	|  |                                                  |        \-> 8b 0c b7             	mov    (%rdi,%rsi,4),%ecx
+    3214:	|  |                                                  |            4c 89 c2             	mov    %r8,%rdx
+        if (!less(p[i], p[i - 1])) { continue; }
+    3217:	|  |                                                  |            42 3b 0c 07          	cmp    (%rdi,%r8,1),%ecx
+    321b:	|  |                                                  +----------- 7d e3                	jge    3200 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x560>
+            p[j] = move(p[j - 1]);
+    321d:	|  |                                                  |  /-------> 44 8b 0c 17          	mov    (%rdi,%rdx,1),%r9d
+    3221:	|  |                                                  |  |         44 89 4c 17 04       	mov    %r9d,0x4(%rdi,%rdx,1)
+        } while (j > 0 && less(t, p[j - 1]));
+    3226:	|  |                                                  |  |         48 85 d2             	test   %rdx,%rdx
+    3229:	|  |                                                  |  |     /-- 74 15                	je     3240 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x5a0>
+    322b:	|  |                                                  |  |     |   4c 8d 4a fc          	lea    -0x4(%rdx),%r9
+    322f:	|  |                                                  |  |     |   3b 4c 17 fc          	cmp    -0x4(%rdi,%rdx,1),%ecx
+    3233:	|  |                                                  |  |  /--|-- 7c 1b                	jl     3250 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x5b0>
+        p[j] = move(t);
+    3235:	|  |                                                  |  |  |  |   48 01 fa             	add    %rdi,%rdx
+    3238:	|  |                                                  |  |  |  |   89 0a                	mov    %ecx,(%rdx)
+    323a:	|  |                                                  +--|--|--|-- eb c4                	jmp    3200 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x560>
+    323c:	|  |                                                  |  |  |  |   0f 1f 40 00          	nopl   0x0(%rax)
+    3240:	|  |                                                  |  |  |  \-> 48 89 fa             	mov    %rdi,%rdx
+    3243:	|  |                                                  |  |  |      89 0a                	mov    %ecx,(%rdx)
+    3245:	|  |                                                  \--|--|----- eb b9                	jmp    3200 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x560>
+    3247:	|  |                                                     |  |      66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    324e:	|  |                                                     |  |      00 00 
+    3250:	|  |                                                     |  \----> 4c 89 ca             	mov    %r9,%rdx
+    3253:	|  |                                                     \-------- eb c8                	jmp    321d <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x57d>
+    if (n < small_n) {
+    3255:	\--|-------------------------------------------------------------> 45 31 c0             	xor    %r8d,%r8d
+    for (Index i = 1; i < n; ++i) {
+    3258:	   |                                                               bf 01 00 00 00       	mov    $0x1,%edi
+    325d:	   |                                                           /-- eb 12                	jmp    3271 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x5d1>
+    325f:	   |                                                           |   90                   	nop
+    3260:	   |                                                  /--------|-> 48 83 c7 01          	add    $0x1,%rdi
+    3264:	   |                                                  |        |   49 83 c0 04          	add    $0x4,%r8
+    3268:	   |                                                  |        |   4c 39 d7             	cmp    %r10,%rdi
+    326b:	   \--------------------------------------------------|--------|-- 0f 84 cb fa ff ff    	je     2d3c <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x9c>
+            return a < b;
+    3271:	                                                      |        \-> 8b 34 bb             	mov    (%rbx,%rdi,4),%esi
+    3274:	                                                      |            4c 89 c2             	mov    %r8,%rdx
+        if (!less(p[i], p[i - 1])) { continue; }
+    3277:	                                                      |            42 3b 34 03          	cmp    (%rbx,%r8,1),%esi
+    327b:	                                                      +----------- 7d e3                	jge    3260 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x5c0>
+            p[j] = move(p[j - 1]);
+    327d:	                                                      |  /-------> 8b 0c 13             	mov    (%rbx,%rdx,1),%ecx
+    3280:	                                                      |  |         89 4c 13 04          	mov    %ecx,0x4(%rbx,%rdx,1)
+        } while (j > 0 && less(t, p[j - 1]));
+    3284:	                                                      |  |         48 85 d2             	test   %rdx,%rdx
+    3287:	                                                      |  |     /-- 74 17                	je     32a0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x600>
+    3289:	                                                      |  |     |   48 8d 4a fc          	lea    -0x4(%rdx),%rcx
+    328d:	                                                      |  |     |   3b 74 13 fc          	cmp    -0x4(%rbx,%rdx,1),%esi
+    3291:	                                                      |  |  /--|-- 7c 1d                	jl     32b0 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x610>
+        p[j] = move(t);
+    3293:	                                                      |  |  |  |   48 01 da             	add    %rbx,%rdx
+    3296:	                                                      |  |  |  |   89 32                	mov    %esi,(%rdx)
+    3298:	                                                      +--|--|--|-- eb c6                	jmp    3260 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x5c0>
+    329a:	                                                      |  |  |  |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    32a0:	                                                      |  |  |  \-> 48 89 da             	mov    %rbx,%rdx
+    32a3:	                                                      |  |  |      89 32                	mov    %esi,(%rdx)
+    32a5:	                                                      \--|--|----- eb b9                	jmp    3260 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x5c0>
+    32a7:	                                                         |  |      66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    32ae:	                                                         |  |      00 00 
+    32b0:	                                                         |  \----> 48 89 ca             	mov    %rcx,%rdx
+    32b3:	                                                         \-------- eb c8                	jmp    327d <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&) [clone .part.0]+0x5dd>
+    32b5:	                                                                   66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    32bc:	                                                                   00 00 00 
+    32bf:	                                                                   90                   	nop
+
+00000000000032c0 <bench::report_per_item(char const*, unsigned long, unsigned long)>:
+{
+    32c0:	       55                   	push   %rbp
+    32c1:	       53                   	push   %rbx
+    32c2:	       48 89 d3             	mov    %rdx,%rbx
+    32c5:	       48 83 ec 08          	sub    $0x8,%rsp
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    32c9:	       48 85 d2             	test   %rdx,%rdx
+    32cc:	/----- 0f 84 be 00 00 00    	je     3390 <bench::report_per_item(char const*, unsigned long, unsigned long)+0xd0>
+    32d2:	|      48 8d 04 b6          	lea    (%rsi,%rsi,4),%rax
+    32d6:	|      31 d2                	xor    %edx,%edx
+    32d8:	|      48 8d 04 80          	lea    (%rax,%rax,4),%rax
+    32dc:	|      48 c1 e0 02          	shl    $0x2,%rax
+    32e0:	|      48 f7 f3             	div    %rbx
+    long unsigned int const frac = cns % 100UL;
+    32e3:	|      48 89 c2             	mov    %rax,%rdx
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    32e6:	|      48 89 c6             	mov    %rax,%rsi
+    long unsigned int const frac = cns % 100UL;
+    32e9:	|      48 b8 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rax
+    32f0:	|      c2 f5 28 
+    32f3:	|      48 c1 ea 02          	shr    $0x2,%rdx
+    32f7:	|      48 f7 e2             	mul    %rdx
+    32fa:	|      48 89 d3             	mov    %rdx,%rbx
+    32fd:	|      48 c1 eb 02          	shr    $0x2,%rbx
+    3301:	|      48 8d 04 9b          	lea    (%rbx,%rbx,4),%rax
+    3305:	|      48 89 dd             	mov    %rbx,%rbp
+    3308:	|      48 89 f3             	mov    %rsi,%rbx
+             << "ns/item\n";
+    330b:	|      48 89 fe             	mov    %rdi,%rsi
+    long unsigned int const frac = cns % 100UL;
+    330e:	|      48 8d 04 80          	lea    (%rax,%rax,4),%rax
+             << "ns/item\n";
+    3312:	|      48 8d 3d 50 2d 00 00 	lea    0x2d50(%rip),%rdi        # 6069 <nel::log>
+    long unsigned int const frac = cns % 100UL;
+    3319:	|      48 c1 e0 02          	shl    $0x2,%rax
+    331d:	|      48 29 c3             	sub    %rax,%rbx
+             << "ns/item\n";
+    3320:	|      e8 2b 08 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    3325:	|      48 8d 35 ec 0d 00 00 	lea    0xdec(%rip),%rsi        # 4118 <_IO_stdin_used+0x118>
+    332c:	|      48 89 c7             	mov    %rax,%rdi
+    332f:	|      e8 1c 08 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    3334:	|      48 89 ee             	mov    %rbp,%rsi
+    3337:	|      48 89 c7             	mov    %rax,%rdi
+    333a:	|      e8 d1 08 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    333f:	|      be 2e 00 00 00       	mov    $0x2e,%esi
+    3344:	|      48 89 c7             	mov    %rax,%rdi
+    3347:	|      e8 e4 07 00 00       	call   3b30 <nel::operator<<(nel::Log&, char)>
+    334c:	|      48 83 fb 0a          	cmp    $0xa,%rbx
+    3350:	|      48 8d 35 9d 0d 00 00 	lea    0xd9d(%rip),%rsi        # 40f4 <_IO_stdin_used+0xf4>
+    3357:	|      48 89 c7             	mov    %rax,%rdi
+    335a:	|      48 8d 05 05 0d 00 00 	lea    0xd05(%rip),%rax        # 4066 <_IO_stdin_used+0x66>
+    3361:	|      48 0f 43 f0          	cmovae %rax,%rsi
+    3365:	|  /-> e8 e6 07 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    336a:	|  |   48 89 de             	mov    %rbx,%rsi
+    336d:	|  |   48 89 c7             	mov    %rax,%rdi
+    3370:	|  |   e8 9b 08 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+}
+    3375:	|  |   48 83 c4 08          	add    $0x8,%rsp
+             << "ns/item\n";
+    3379:	|  |   48 8d 35 84 0c 00 00 	lea    0xc84(%rip),%rsi        # 4004 <_IO_stdin_used+0x4>
+}
+    3380:	|  |   5b                   	pop    %rbx
+             << "ns/item\n";
+    3381:	|  |   48 89 c7             	mov    %rax,%rdi
+}
+    3384:	|  |   5d                   	pop    %rbp
+             << "ns/item\n";
+    3385:	|  |   e9 c6 07 00 00       	jmp    3b50 <nel::operator<<(nel::Log&, char const*)>
+    338a:	|  |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    3390:	\--|-> 48 89 fe             	mov    %rdi,%rsi
+    3393:	   |   48 8d 3d cf 2c 00 00 	lea    0x2ccf(%rip),%rdi        # 6069 <nel::log>
+    339a:	   |   e8 b1 07 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    339f:	   |   48 8d 35 72 0d 00 00 	lea    0xd72(%rip),%rsi        # 4118 <_IO_stdin_used+0x118>
+    33a6:	   |   48 89 c7             	mov    %rax,%rdi
+    33a9:	   |   e8 a2 07 00 00       	call   3b50 <nel::operator<<(nel::Log&, char const*)>
+    33ae:	   |   31 f6                	xor    %esi,%esi
+    33b0:	   |   48 89 c7             	mov    %rax,%rdi
+    33b3:	   |   e8 58 08 00 00       	call   3c10 <nel::operator<<(nel::Log&, unsigned long)>
+    33b8:	   |   be 2e 00 00 00       	mov    $0x2e,%esi
+    33bd:	   |   48 89 c7             	mov    %rax,%rdi
+    33c0:	   |   e8 6b 07 00 00       	call   3b30 <nel::operator<<(nel::Log&, char)>
+    33c5:	   |   48 8d 35 28 0d 00 00 	lea    0xd28(%rip),%rsi        # 40f4 <_IO_stdin_used+0xf4>
+    33cc:	   |   48 89 c7             	mov    %rax,%rdi
+    33cf:	   \-- eb 94                	jmp    3365 <bench::report_per_item(char const*, unsigned long, unsigned long)+0xa5>
+    33d1:	       66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    33d8:	       00 00 00 
+    33db:	       0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000000033e0 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>:
+            if (new_cap > max_capacity) { return nullptr; }
+    33e0:	       48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    33e7:	       ff ff 1f 
+    33ea:	       48 39 f0             	cmp    %rsi,%rax
+    33ed:	/----- 72 29                	jb     3418 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x38>
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    33ef:	|      53                   	push   %rbx
+    33f0:	|      48 89 f3             	mov    %rsi,%rbx
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    33f3:	|      48 8d 34 b5 14 00 00 	lea    0x14(,%rsi,4),%rsi
+    33fa:	|      00 
+                                    : std::realloc(p, new_size);
+    33fb:	|      e8 b0 dc ff ff       	call   10b0 <realloc@plt>
+            if (new_p == nullptr) {
+    3400:	|      48 85 c0             	test   %rax,%rax
+    3403:	|  /-- 74 0b                	je     3410 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x30>
+            new_n->alloc_ = new_cap;
+    3405:	|  |   48 89 18             	mov    %rbx,(%rax)
+        }
+    3408:	|  |   5b                   	pop    %rbx
+    3409:	|  |   c3                   	ret
+    340a:	|  |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+            if (new_cap > max_capacity) { return nullptr; }
+    3410:	|  \-> 31 c0                	xor    %eax,%eax
+        }
+    3412:	|      5b                   	pop    %rbx
+    3413:	|      c3                   	ret
+    3414:	|      0f 1f 40 00          	nopl   0x0(%rax)
+            if (new_cap > max_capacity) { return nullptr; }
+    3418:	\----> 31 c0                	xor    %eax,%eax
+        }
+    341a:	       c3                   	ret
+    341b:	       0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000003420 <void nel::sort::rotate<int>(int*, unsigned long, unsigned long)>:
+void rotate(T p[], Length const l, Length const r)
+    3420:	       48 89 f8             	mov    %rdi,%rax
+    while (i + 1 < j) {
+    3423:	       48 83 fe 01          	cmp    $0x1,%rsi
+    3427:	/----- 76 2e                	jbe    3457 <void nel::sort::rotate<int>(int*, unsigned long, unsigned long)+0x37>
+    Index j = n;
+    3429:	|      48 89 f7             	mov    %rsi,%rdi
+    while (i + 1 < j) {
+    342c:	|      b9 01 00 00 00       	mov    $0x1,%ecx
+    3431:	|      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        j -= 1;
+    3438:	|  /-> 48 83 ef 01          	sub    $0x1,%rdi
+    T t = move(a);
+    343c:	|  |   44 8b 44 88 fc       	mov    -0x4(%rax,%rcx,4),%r8d
+    a = move(b);
+    3441:	|  |   44 8b 0c b8          	mov    (%rax,%rdi,4),%r9d
+    3445:	|  |   44 89 4c 88 fc       	mov    %r9d,-0x4(%rax,%rcx,4)
+    while (i + 1 < j) {
+    344a:	|  |   48 83 c1 01          	add    $0x1,%rcx
+    b = move(t);
+    344e:	|  |   44 89 04 b8          	mov    %r8d,(%rax,%rdi,4)
+    3452:	|  |   48 39 f9             	cmp    %rdi,%rcx
+    3455:	|  \-- 72 e1                	jb     3438 <void nel::sort::rotate<int>(int*, unsigned long, unsigned long)+0x18>
+    reverse(p + l, r);
+    3457:	\----> 4c 8d 04 b0          	lea    (%rax,%rsi,4),%r8
+    while (i + 1 < j) {
+    345b:	       48 83 fa 01          	cmp    $0x1,%rdx
+    345f:	/----- 76 2e                	jbe    348f <void nel::sort::rotate<int>(int*, unsigned long, unsigned long)+0x6f>
+    Index j = n;
+    3461:	|      48 89 d7             	mov    %rdx,%rdi
+    while (i + 1 < j) {
+    3464:	|      b9 01 00 00 00       	mov    $0x1,%ecx
+    3469:	|      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        j -= 1;
+    3470:	|  /-> 48 83 ef 01          	sub    $0x1,%rdi
+    T t = move(a);
+    3474:	|  |   45 8b 4c 88 fc       	mov    -0x4(%r8,%rcx,4),%r9d
+    a = move(b);
+    3479:	|  |   45 8b 14 b8          	mov    (%r8,%rdi,4),%r10d
+    347d:	|  |   45 89 54 88 fc       	mov    %r10d,-0x4(%r8,%rcx,4)
+    while (i + 1 < j) {
+    3482:	|  |   48 83 c1 01          	add    $0x1,%rcx
+    b = move(t);
+    3486:	|  |   45 89 0c b8          	mov    %r9d,(%r8,%rdi,4)
+    348a:	|  |   48 39 f9             	cmp    %rdi,%rcx
+    348d:	|  \-- 72 e1                	jb     3470 <void nel::sort::rotate<int>(int*, unsigned long, unsigned long)+0x50>
+    reverse(p, l + r);
+    348f:	\----> 48 01 d6             	add    %rdx,%rsi
+    while (i + 1 < j) {
+    3492:	       48 83 fe 01          	cmp    $0x1,%rsi
+    3496:	/----- 76 23                	jbe    34bb <void nel::sort::rotate<int>(int*, unsigned long, unsigned long)+0x9b>
+    3498:	|      ba 01 00 00 00       	mov    $0x1,%edx
+    349d:	|      0f 1f 00             	nopl   (%rax)
+        j -= 1;
+    34a0:	|  /-> 48 83 ee 01          	sub    $0x1,%rsi
+    T t = move(a);
+    34a4:	|  |   8b 4c 90 fc          	mov    -0x4(%rax,%rdx,4),%ecx
+    a = move(b);
+    34a8:	|  |   8b 3c b0             	mov    (%rax,%rsi,4),%edi
+    34ab:	|  |   89 7c 90 fc          	mov    %edi,-0x4(%rax,%rdx,4)
+    while (i + 1 < j) {
+    34af:	|  |   48 83 c2 01          	add    $0x1,%rdx
+    b = move(t);
+    34b3:	|  |   89 0c b0             	mov    %ecx,(%rax,%rsi,4)
+    34b6:	|  |   48 39 f2             	cmp    %rsi,%rdx
+    34b9:	|  \-- 72 e5                	jb     34a0 <void nel::sort::rotate<int>(int*, unsigned long, unsigned long)+0x80>
+}
+    34bb:	\----> c3                   	ret
+    34bc:	       0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000034c0 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)>:
+    if (m == 0 || m == n || !less(p[m], p[m - 1])) { return; }
+    34c0:	                                                /----------------> 48 39 d6             	cmp    %rdx,%rsi
+    34c3:	/-----------------------------------------------|----------------- 0f 84 4a 06 00 00    	je     3b13 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x653>
+    34c9:	|                                               |                  48 85 f6             	test   %rsi,%rsi
+    34cc:	+-----------------------------------------------|----------------- 0f 84 41 06 00 00    	je     3b13 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x653>
+void merge(T p[], Length const m, Length const n, T buf[], Length const buf_n, F &less)
+    34d2:	|                                               |                  41 57                	push   %r15
+    34d4:	|                                               |                  41 56                	push   %r14
+    34d6:	|                                               |                  41 55                	push   %r13
+    34d8:	|                                               |                  41 54                	push   %r12
+    34da:	|                                               |                  49 89 d4             	mov    %rdx,%r12
+    34dd:	|                                               |                  55                   	push   %rbp
+    34de:	|                                               |                  48 89 fd             	mov    %rdi,%rbp
+    34e1:	|                                               |                  53                   	push   %rbx
+    34e2:	|                                               |                  4c 89 c3             	mov    %r8,%rbx
+    34e5:	|                                               |                  48 83 ec 18          	sub    $0x18,%rsp
+    34e9:	|                                               |                  48 89 0c 24          	mov    %rcx,(%rsp)
+    34ed:	|                                               |                  4c 89 4c 24 08       	mov    %r9,0x8(%rsp)
+    if (m == 0 || m == n || !less(p[m], p[m - 1])) { return; }
+    34f2:	|                                               |  /-------------> 48 8d 0c b5 00 00 00 	lea    0x0(,%rsi,4),%rcx
+    34f9:	|                                               |  |               00 
+    34fa:	|                                               |  |               4c 8d 5c 0d 00       	lea    0x0(%rbp,%rcx,1),%r11
+            return a < b;
+    34ff:	|                                               |  |               41 8b 13             	mov    (%r11),%edx
+    if (m == 0 || m == n || !less(p[m], p[m - 1])) { return; }
+    3502:	|                                               |  |               3b 54 0d fc          	cmp    -0x4(%rbp,%rcx,1),%edx
+    3506:	|  /--------------------------------------------|--|-------------- 0f 8d 0c 02 00 00    	jge    3718 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x258>
+    Length const b = n - m;
+    350c:	|  |                                            |  |               4c 89 e0             	mov    %r12,%rax
+    if (a <= b && a <= buf_n) {
+    350f:	|  |                                            |  |               48 89 df             	mov    %rbx,%rdi
+    Length const b = n - m;
+    3512:	|  |                                            |  |               48 29 f0             	sub    %rsi,%rax
+    if (a <= b && a <= buf_n) {
+    3515:	|  |                                            |  |               48 39 d8             	cmp    %rbx,%rax
+    3518:	|  |                                            |  |               48 0f 46 f8          	cmovbe %rax,%rdi
+    351c:	|  |                                            |  |               48 39 f7             	cmp    %rsi,%rdi
+    351f:	|  |           /--------------------------------|--|-------------- 0f 83 1b 03 00 00    	jae    3840 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x380>
+    } else if (b < a && b <= buf_n) {
+    3525:	|  |           |                                |  |               48 39 f0             	cmp    %rsi,%rax
+    3528:	|  |           |                                |  |           /-- 73 09                	jae    3533 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x73>
+    352a:	|  |           |                                |  |           |   48 39 c3             	cmp    %rax,%rbx
+    352d:	|  |           |                             /--|--|-----------|-- 0f 83 fd 01 00 00    	jae    3730 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x270>
+        if (a >= b) {
+    3533:	|  |           |                             |  |  |           \-> 48 39 c6             	cmp    %rax,%rsi
+    3536:	|  |           |                             |  |  |  /----------- 0f 82 dc 00 00 00    	jb     3618 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x158>
+            c1 = a / 2;
+    353c:	|  |           |                             |  |  |  |            49 89 f7             	mov    %rsi,%r15
+    353f:	|  |           |                             |  |  |  |            49 d1 ef             	shr    %r15
+            c2 = m + search::lower_bound(p + m, b, p[c1], less);
+    3542:	|  |           |                             |  |  |  |            4e 8d 4c bd 00       	lea    0x0(%rbp,%r15,4),%r9
+template<typename T, typename F>
+Index partition_point(T const p[], Length n, F &pred)
+{
+    if (n == 0) { return 0; }
+    T const *b = p;
+    while (n > 1) {
+    3547:	|  |           |                             |  |  |  |            48 83 f8 01          	cmp    $0x1,%rax
+    354b:	|  |     /-----|-----------------------------|--|--|--|----------- 0f 84 8f 03 00 00    	je     38e0 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x420>
+    3551:	|  |     |     |                             |  |  |  |            45 8b 11             	mov    (%r9),%r10d
+    if (m == 0 || m == n || !less(p[m], p[m - 1])) { return; }
+    3554:	|  |     |     |                             |  |  |  |            4c 89 d9             	mov    %r11,%rcx
+            return a < b;
+    3557:	|  |     |     |                             |  |  |  |            45 89 d0             	mov    %r10d,%r8d
+    355a:	|  |     |     |                             |  |  |  |            66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+        Length const h = n / 2;
+    3560:	|  |     |     |                             |  |  |  |     /----> 48 89 c7             	mov    %rax,%rdi
+    3563:	|  |     |     |                             |  |  |  |     |      48 d1 ef             	shr    %rdi
+        // While far apart, fetch both possible next midpoints while this one is compared.
+        // Addresses computed as ints, a prefetch past the end is harmless.
+        if (h * sizeof(T) > prefetch_bytes) {
+    3566:	|  |     |     |                             |  |  |  |     |      48 8d 14 bd 00 00 00 	lea    0x0(,%rdi,4),%rdx
+    356d:	|  |     |     |                             |  |  |  |     |      00 
+    356e:	|  |     |     |                             |  |  |  |     |      48 81 fa 00 01 00 00 	cmp    $0x100,%rdx
+    3575:	|  |     |     |                             |  |  |  |     |  /-- 76 1b                	jbe    3592 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0xd2>
+            __builtin_prefetch(
+                reinterpret_cast<void const *>(uintptr_t(b) + (h / 2) * sizeof(T)));
+    3577:	|  |     |     |                             |  |  |  |     |  |   49 89 c5             	mov    %rax,%r13
+    357a:	|  |     |     |                             |  |  |  |     |  |   49 83 e5 fc          	and    $0xfffffffffffffffc,%r13
+            __builtin_prefetch(
+    357e:	|  |     |     |                             |  |  |  |     |  |   42 0f 18 0c 29       	prefetcht0 (%rcx,%r13,1)
+                reinterpret_cast<void const *>(uintptr_t(b) + (h / 2) * sizeof(T)));
+    3583:	|  |     |     |                             |  |  |  |     |  |   49 89 c5             	mov    %rax,%r13
+    3586:	|  |     |     |                             |  |  |  |     |  |   49 c1 ed 02          	shr    $0x2,%r13
+            __builtin_prefetch(
+                reinterpret_cast<void const *>(uintptr_t(b) + (h + h / 2) * sizeof(T)));
+    358a:	|  |     |     |                             |  |  |  |     |  |   49 01 fd             	add    %rdi,%r13
+            __builtin_prefetch(
+    358d:	|  |     |     |                             |  |  |  |     |  |   42 0f 18 0c a9       	prefetcht0 (%rcx,%r13,4)
+        }
+        b = pred(b[h]) ? b + h : b;
+    3592:	|  |     |     |                             |  |  |  |     |  \-> 48 01 ca             	add    %rcx,%rdx
+        constexpr bool operator()(T const &a, T const &b) const
+    3595:	|  |     |     |                             |  |  |  |     |      44 39 12             	cmp    %r10d,(%rdx)
+    3598:	|  |     |     |                             |  |  |  |     |      48 0f 4c ca          	cmovl  %rdx,%rcx
+        n -= h;
+    359c:	|  |     |     |                             |  |  |  |     |      48 29 f8             	sub    %rdi,%rax
+    while (n > 1) {
+    359f:	|  |     |     |                             |  |  |  |     |      48 83 f8 01          	cmp    $0x1,%rax
+    35a3:	|  |     |     |                             |  |  |  |     \----- 77 bb                	ja     3560 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0xa0>
+            return a < b;
+    35a5:	|  |     |     |                             |  |  |  |            8b 11                	mov    (%rcx),%edx
+    }
+    return Index(b - p) + (pred(*b) ? 1 : 0);
+    35a7:	|  |     |     |                             |  |  |  |            4c 29 d9             	sub    %r11,%rcx
+    35aa:	|  |     |     |                             |  |  |  |            48 c1 f9 02          	sar    $0x2,%rcx
+    35ae:	|  |     |  /--|-----------------------------|--|--|--|----------> 31 c0                	xor    %eax,%eax
+    35b0:	|  |     |  |  |                             |  |  |  |            44 39 c2             	cmp    %r8d,%edx
+    35b3:	|  |     |  |  |                             |  |  |  |            0f 9c c0             	setl   %al
+    35b6:	|  |     |  |  |                             |  |  |  |            4c 8d 34 08          	lea    (%rax,%rcx,1),%r14
+            c2 = m + search::lower_bound(p + m, b, p[c1], less);
+    35ba:	|  |     |  |  |                             |  |  |  |            4d 8d 2c 36          	lea    (%r14,%rsi,1),%r13
+        rotate(p + c1, m - c1, c2 - m);
+    35be:	|  |     |  |  |                             |  |  |  |  /-------> 4c 89 f2             	mov    %r14,%rdx
+    35c1:	|  |     |  |  |                             |  |  |  |  |         4c 89 cf             	mov    %r9,%rdi
+    35c4:	|  |     |  |  |                             |  |  |  |  |         4c 29 fe             	sub    %r15,%rsi
+        Index const nm = c1 + (c2 - m);
+    35c7:	|  |     |  |  |                             |  |  |  |  |         4d 01 fe             	add    %r15,%r14
+        rotate(p + c1, m - c1, c2 - m);
+    35ca:	|  |     |  |  |                             |  |  |  |  |         e8 51 fe ff ff       	call   3420 <void nel::sort::rotate<int>(int*, unsigned long, unsigned long)>
+        merge(p, c1, nm, buf, buf_n, less);
+    35cf:	|  |     |  |  |                             |  |  |  |  |         4c 8b 4c 24 08       	mov    0x8(%rsp),%r9
+    35d4:	|  |     |  |  |                             |  |  |  |  |         4c 89 f2             	mov    %r14,%rdx
+    35d7:	|  |     |  |  |                             |  |  |  |  |         4c 89 fe             	mov    %r15,%rsi
+    35da:	|  |     |  |  |                             |  |  |  |  |         48 8b 0c 24          	mov    (%rsp),%rcx
+    35de:	|  |     |  |  |                             |  |  |  |  |         48 89 ef             	mov    %rbp,%rdi
+    35e1:	|  |     |  |  |                             |  |  |  |  |         49 89 d8             	mov    %rbx,%r8
+        merge(p + nm, c2 - nm, n - nm, buf, buf_n, less);
+    35e4:	|  |     |  |  |                             |  |  |  |  |         4a 8d 6c b5 00       	lea    0x0(%rbp,%r14,4),%rbp
+        merge(p, c1, nm, buf, buf_n, less);
+    35e9:	|  |     |  |  |                             |  \--|--|--|-------- e8 d2 fe ff ff       	call   34c0 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)>
+        merge(p + nm, c2 - nm, n - nm, buf, buf_n, less);
+    35ee:	|  |     |  |  |                             |     |  |  |         4c 89 e2             	mov    %r12,%rdx
+    if (m == 0 || m == n || !less(p[m], p[m - 1])) { return; }
+    35f1:	|  |     |  |  |                             |     |  |  |         4c 89 ee             	mov    %r13,%rsi
+        merge(p + nm, c2 - nm, n - nm, buf, buf_n, less);
+    35f4:	|  |     |  |  |                             |     |  |  |         4c 29 f2             	sub    %r14,%rdx
+    if (m == 0 || m == n || !less(p[m], p[m - 1])) { return; }
+    35f7:	|  |     |  |  |                             |     |  |  |         4c 29 f6             	sub    %r14,%rsi
+    35fa:	|  +-----|--|--|-----------------------------|-----|--|--|-------- 0f 84 18 01 00 00    	je     3718 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x258>
+    3600:	|  |     |  |  |                             |     |  |  |         4d 39 e5             	cmp    %r12,%r13
+    3603:	|  +-----|--|--|-----------------------------|-----|--|--|-------- 0f 84 0f 01 00 00    	je     3718 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x258>
+        merge(p + nm, c2 - nm, n - nm, buf, buf_n, less);
+    3609:	|  |     |  |  |                             |     |  |  |         49 89 d4             	mov    %rdx,%r12
+    360c:	|  |     |  |  |                             |     \--|--|-------- e9 e1 fe ff ff       	jmp    34f2 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x32>
+    3611:	|  |     |  |  |                             |        |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            c2 = m + b / 2;
+    3618:	|  |     |  |  |                             |        \--|-------> 48 d1 e8             	shr    %rax
+    361b:	|  |     |  |  |                             |           |         4c 8d 2c 30          	lea    (%rax,%rsi,1),%r13
+    361f:	|  |     |  |  |                             |           |         49 89 c6             	mov    %rax,%r14
+            c1 = search::upper_bound(p, a, p[c2], less);
+    3622:	|  |     |  |  |                             |           |         4a 8d 54 ad 00       	lea    0x0(%rbp,%r13,4),%rdx
+    while (n > 1) {
+    3627:	|  |     |  |  |                             |           |         48 83 fe 01          	cmp    $0x1,%rsi
+    362b:	|  |     |  |  |           /-----------------|-----------|-------- 0f 84 9f 02 00 00    	je     38d0 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x410>
+    3631:	|  |     |  |  |           |                 |           |         44 8b 0a             	mov    (%rdx),%r9d
+    3634:	|  |     |  |  |           |                 |           |         48 89 ef             	mov    %rbp,%rdi
+    3637:	|  |     |  |  |           |                 |           |         48 89 f1             	mov    %rsi,%rcx
+            return a < b;
+    363a:	|  |     |  |  |           |                 |           |         44 89 ca             	mov    %r9d,%edx
+    363d:	|  |     |  |  |           |                 |           |         0f 1f 00             	nopl   (%rax)
+        Length const h = n / 2;
+    3640:	|  |     |  |  |           |                 |           |  /----> 49 89 c8             	mov    %rcx,%r8
+    3643:	|  |     |  |  |           |                 |           |  |      49 d1 e8             	shr    %r8
+        if (h * sizeof(T) > prefetch_bytes) {
+    3646:	|  |     |  |  |           |                 |           |  |      4a 8d 04 85 00 00 00 	lea    0x0(,%r8,4),%rax
+    364d:	|  |     |  |  |           |                 |           |  |      00 
+    364e:	|  |     |  |  |           |                 |           |  |      48 3d 00 01 00 00    	cmp    $0x100,%rax
+    3654:	|  |     |  |  |           |                 |           |  |  /-- 76 1b                	jbe    3671 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x1b1>
+                reinterpret_cast<void const *>(uintptr_t(b) + (h / 2) * sizeof(T)));
+    3656:	|  |     |  |  |           |                 |           |  |  |   49 89 ca             	mov    %rcx,%r10
+    3659:	|  |     |  |  |           |                 |           |  |  |   49 83 e2 fc          	and    $0xfffffffffffffffc,%r10
+            __builtin_prefetch(
+    365d:	|  |     |  |  |           |                 |           |  |  |   42 0f 18 0c 17       	prefetcht0 (%rdi,%r10,1)
+                reinterpret_cast<void const *>(uintptr_t(b) + (h / 2) * sizeof(T)));
+    3662:	|  |     |  |  |           |                 |           |  |  |   49 89 ca             	mov    %rcx,%r10
+    3665:	|  |     |  |  |           |                 |           |  |  |   49 c1 ea 02          	shr    $0x2,%r10
+                reinterpret_cast<void const *>(uintptr_t(b) + (h + h / 2) * sizeof(T)));
+    3669:	|  |     |  |  |           |                 |           |  |  |   4d 01 c2             	add    %r8,%r10
+            __builtin_prefetch(
+    366c:	|  |     |  |  |           |                 |           |  |  |   42 0f 18 0c 97       	prefetcht0 (%rdi,%r10,4)
+        b = pred(b[h]) ? b + h : b;
+    3671:	|  |     |  |  |           |                 |           |  |  \-> 48 01 f8             	add    %rdi,%rax
+        constexpr bool operator()(T const &a, T const &b) const
+    3674:	|  |     |  |  |           |                 |           |  |      44 3b 08             	cmp    (%rax),%r9d
+    3677:	|  |     |  |  |           |                 |           |  |      48 0f 4d f8          	cmovge %rax,%rdi
+        n -= h;
+    367b:	|  |     |  |  |           |                 |           |  |      4c 29 c1             	sub    %r8,%rcx
+    while (n > 1) {
+    367e:	|  |     |  |  |           |                 |           |  |      48 83 f9 01          	cmp    $0x1,%rcx
+    3682:	|  |     |  |  |           |                 |           |  \----- 77 bc                	ja     3640 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x180>
+    return Index(b - p) + (pred(*b) ? 1 : 0);
+    3684:	|  |     |  |  |           |                 |           |         48 89 f9             	mov    %rdi,%rcx
+    3687:	|  |     |  |  |           |                 |           |         48 29 e9             	sub    %rbp,%rcx
+    368a:	|  |     |  |  |           |                 |           |         48 c1 f9 02          	sar    $0x2,%rcx
+    368e:	|  |     |  |  |           |     /-----------|-----------|-------> 45 31 ff             	xor    %r15d,%r15d
+    3691:	|  |     |  |  |           |     |           |           |         39 17                	cmp    %edx,(%rdi)
+    3693:	|  |     |  |  |           |     |           |           |         41 0f 9e c7          	setle  %r15b
+    3697:	|  |     |  |  |           |     |           |           |         49 01 cf             	add    %rcx,%r15
+        rotate(p + c1, m - c1, c2 - m);
+    369a:	|  |     |  |  |           |     |           |           |         4e 8d 4c bd 00       	lea    0x0(%rbp,%r15,4),%r9
+    369f:	|  |     |  |  |           |     |           |           \-------- e9 1a ff ff ff       	jmp    35be <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0xfe>
+    36a4:	|  |     |  |  |           |     |           |                     0f 1f 40 00          	nopl   0x0(%rax)
+            p[o++] = less(p[j], buf[i]) ? move(p[j++]) : move(buf[i++]);
+    36a8:	|  |     |  |  |           |     |     /-----|-------------------> 48 83 c0 01          	add    $0x1,%rax
+    36ac:	|  |     |  |  |           |     |     |     |                     48 83 c2 01          	add    $0x1,%rdx
+    36b0:	|  |     |  |  |           |     |     |     |                     89 7c 85 fc          	mov    %edi,-0x4(%rbp,%rax,4)
+        while (i < a && j < n) {
+    36b4:	|  |     |  |  |           |     |     |     |                     48 39 f2             	cmp    %rsi,%rdx
+    36b7:	|  +-----|--|--|-----------|-----|-----|-----|-------------------- 73 5f                	jae    3718 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x258>
+    36b9:	|  |     |  |  |           |     |     |     |                     4c 39 e1             	cmp    %r12,%rcx
+    36bc:	|  |     |  |  |           |     |  /--|-----|-------------------- 0f 82 d6 01 00 00    	jb     3898 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x3d8>
+        while (i < a) {
+    36c2:	|  |     |  |  |           |     |  |  |  /--|-------------------> 48 39 f2             	cmp    %rsi,%rdx
+    36c5:	|  +-----|--|--|-----------|-----|--|--|--|--|-------------------- 73 51                	jae    3718 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x258>
+    36c7:	|  |     |  |  |           |     |  |  |  |  |  /----------------> 49 89 f1             	mov    %rsi,%r9
+    36ca:	|  |     |  |  |           |     |  |  |  |  |  |                  49 29 d1             	sub    %rdx,%r9
+    36cd:	|  |     |  |  |           |     |  |  |  |  |  |                  49 8d 49 ff          	lea    -0x1(%r9),%rcx
+    36d1:	|  |     |  |  |           |     |  |  |  |  |  |                  48 83 f9 02          	cmp    $0x2,%rcx
+    36d5:	|  |     |  |  |           |     |  |  |  |  |  |              /-- 76 21                	jbe    36f8 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x238>
+    36d7:	|  |  /--|--|--|-----------|-----|--|--|--|--|--|--------------|-> 48 8d 7c 85 00       	lea    0x0(%rbp,%rax,4),%rdi
+    36dc:	|  |  |  |  |  |           |     |  |  |  |  |  |              |   48 8d 0c 95 04 00 00 	lea    0x4(,%rdx,4),%rcx
+    36e3:	|  |  |  |  |  |           |     |  |  |  |  |  |              |   00 
+    36e4:	|  |  |  |  |  |           |     |  |  |  |  |  |              |   4d 8d 14 0e          	lea    (%r14,%rcx,1),%r10
+    36e8:	|  |  |  |  |  |           |     |  |  |  |  |  |              |   49 89 f8             	mov    %rdi,%r8
+    36eb:	|  |  |  |  |  |           |     |  |  |  |  |  |              |   4d 29 d0             	sub    %r10,%r8
+    36ee:	|  |  |  |  |  |           |     |  |  |  |  |  |              |   49 83 f8 08          	cmp    $0x8,%r8
+    36f2:	|  |  |  |  |  |  /--------|-----|--|--|--|--|--|--------------|-- 0f 87 06 03 00 00    	ja     39fe <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x53e>
+    36f8:	|  |  |  |  |  |  |        |     |  |  |  |  |  |              \-> 48 01 c6             	add    %rax,%rsi
+    36fb:	|  |  |  |  |  |  |        |     |  |  |  |  |  |                  48 29 d6             	sub    %rdx,%rsi
+    36fe:	|  |  |  |  |  |  |        |     |  |  |  |  |  |                  48 29 c2             	sub    %rax,%rdx
+    3701:	|  |  |  |  |  |  |        |     |  |  |  |  |  |                  49 8d 0c 96          	lea    (%r14,%rdx,4),%rcx
+    3705:	|  |  |  |  |  |  |        |     |  |  |  |  |  |                  0f 1f 00             	nopl   (%rax)
+            p[o++] = move(buf[i++]);
+    3708:	|  |  |  |  |  |  |        |     |  |  |  |  |  |              /-> 8b 14 81             	mov    (%rcx,%rax,4),%edx
+    370b:	|  |  |  |  |  |  |        |     |  |  |  |  |  |              |   48 83 c0 01          	add    $0x1,%rax
+    370f:	|  |  |  |  |  |  |        |     |  |  |  |  |  |              |   89 54 85 fc          	mov    %edx,-0x4(%rbp,%rax,4)
+        while (i < a) {
+    3713:	|  |  |  |  |  |  |        |     |  |  |  |  |  |              |   48 39 c6             	cmp    %rax,%rsi
+    3716:	|  |  |  |  |  |  |        |     |  |  |  |  |  |              \-- 75 f0                	jne    3708 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x248>
+}
+    3718:	|  >--|--|--|--|--|--------|-----|--|--|--|--|--|----------------> 48 83 c4 18          	add    $0x18,%rsp
+    371c:	|  |  |  |  |  |  |        |     |  |  |  |  |  |                  5b                   	pop    %rbx
+    371d:	|  |  |  |  |  |  |        |     |  |  |  |  |  |                  5d                   	pop    %rbp
+    371e:	|  |  |  |  |  |  |        |     |  |  |  |  |  |                  41 5c                	pop    %r12
+    3720:	|  |  |  |  |  |  |        |     |  |  |  |  |  |                  41 5d                	pop    %r13
+    3722:	|  |  |  |  |  |  |        |     |  |  |  |  |  |                  41 5e                	pop    %r14
+    3724:	|  |  |  |  |  |  |        |     |  |  |  |  |  |                  41 5f                	pop    %r15
+    3726:	|  |  |  |  |  |  |        |     |  |  |  |  |  |                  c3                   	ret
+    3727:	|  |  |  |  |  |  |        |     |  |  |  |  |  |                  66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    372e:	|  |  |  |  |  |  |        |     |  |  |  |  |  |                  00 00 
+    3730:	|  |  |  |  |  |  |        |     |  |  |  |  \--|----------------> 48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    3734:	|  |  |  |  |  |  |        |     |  |  |  |     |                  4c 8b 34 24          	mov    (%rsp),%r14
+    3738:	|  |  |  |  |  |  |        |     |  |  |  |     |                  48 83 fa 02          	cmp    $0x2,%rdx
+    373c:	|  |  |  |  |  |  |  /-----|-----|--|--|--|-----|----------------- 0f 86 ae 02 00 00    	jbe    39f0 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x530>
+    3742:	|  |  |  |  |  |  |  |     |     |  |  |  |     |                  48 8d 54 0d 04       	lea    0x4(%rbp,%rcx,1),%rdx
+    3747:	|  |  |  |  |  |  |  |     |     |  |  |  |     |                  4c 89 f1             	mov    %r14,%rcx
+    374a:	|  |  |  |  |  |  |  |     |     |  |  |  |     |                  48 29 d1             	sub    %rdx,%rcx
+    } else if (b < a && b <= buf_n) {
+    374d:	|  |  |  |  |  |  |  |     |     |  |  |  |     |                  31 d2                	xor    %edx,%edx
+    374f:	|  |  |  |  |  |  |  |     |     |  |  |  |     |                  48 83 f9 08          	cmp    $0x8,%rcx
+    3753:	|  |  |  |  |  |  |  |     |     |  |  |  |     |     /----------- 0f 87 91 01 00 00    	ja     38ea <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x42a>
+    3759:	|  |  |  |  |  |  |  |     |     |  |  |  |     |     |            0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            buf[j] = move(p[m + j]);
+    3760:	|  |  |  |  |  |  |  |     |  /--|--|--|--|-----|-----|----------> 41 8b 0c 93          	mov    (%r11,%rdx,4),%ecx
+    3764:	|  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |            41 89 0c 96          	mov    %ecx,(%r14,%rdx,4)
+        for (Index j = 0; j < b; ++j) {
+    3768:	|  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |            48 83 c2 01          	add    $0x1,%rdx
+    376c:	|  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |            48 39 c2             	cmp    %rax,%rdx
+    376f:	|  |  |  |  |  |  |  |     |  +--|--|--|--|-----|-----|----------- 75 ef                	jne    3760 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x2a0>
+    3771:	|  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |            0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            p[--o] = less(buf[j - 1], p[i - 1]) ? move(p[--i]) : move(buf[--j]);
+    3778:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  /--|-----|----------> 8b 5c b5 fc          	mov    -0x4(%rbp,%rsi,4),%ebx
+    377c:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |            41 39 5c 86 fc       	cmp    %ebx,-0x4(%r14,%rax,4)
+    3781:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  /-------- 0f 8d 89 00 00 00    	jge    3810 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x350>
+    3787:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |         48 83 ee 01          	sub    $0x1,%rsi
+    378b:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |         49 83 ec 01          	sub    $0x1,%r12
+    378f:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |         8b 54 b5 00          	mov    0x0(%rbp,%rsi,4),%edx
+    3793:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |         42 89 54 a5 00       	mov    %edx,0x0(%rbp,%r12,4)
+        while (i > 0 && j > 0) {
+    3798:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |         48 85 f6             	test   %rsi,%rsi
+    379b:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  +--|-----|--|-------- 75 db                	jne    3778 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x2b8>
+        while (j > 0) {
+    379d:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |         48 85 c0             	test   %rax,%rax
+    37a0:	|  +--|--|--|--|--|--|-----|--|--|--|--|--|--|--|-----|--|-------- 0f 84 72 ff ff ff    	je     3718 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x258>
+    37a6:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |         48 8d 50 ff          	lea    -0x1(%rax),%rdx
+    37aa:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |         4a 8d 0c a5 00 00 00 	lea    0x0(,%r12,4),%rcx
+    37b1:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |         00 
+    37b2:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |         48 83 fa 02          	cmp    $0x2,%rdx
+    37b6:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |     /-- 76 2a                	jbe    37e2 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x322>
+    37b8:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |     |   48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+    37bf:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |     |   00 
+    37c0:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |     |   48 89 ef             	mov    %rbp,%rdi
+    37c3:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |     |   4a 8d 0c a5 00 00 00 	lea    0x0(,%r12,4),%rcx
+    37ca:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |     |   00 
+    37cb:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |     |   4d 8d 44 36 f8       	lea    -0x8(%r14,%rsi,1),%r8
+    37d0:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |     |   4c 29 c7             	sub    %r8,%rdi
+    37d3:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |     |   48 8d 7c 0f 04       	lea    0x4(%rdi,%rcx,1),%rdi
+    37d8:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |     |  |     |   48 83 ff 08          	cmp    $0x8,%rdi
+    37dc:	|  |  |  |  |  |  |  |  /--|--|--|--|--|--|--|--|-----|--|-----|-- 0f 87 a2 02 00 00    	ja     3a84 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x5c4>
+    37e2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     \-> 48 f7 d8             	neg    %rax
+    37e5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 8d 04 81          	lea    (%rcx,%rax,4),%rax
+    37e9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 01 c5             	add    %rax,%rbp
+    37ec:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     /-- eb 06                	jmp    37f4 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x334>
+    37ee:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |   66 90                	xchg   %ax,%ax
+    37f0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  /--|-> 48 83 ea 01          	sub    $0x1,%rdx
+            p[--o] = move(buf[--j]);
+    37f4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  \-> 41 8b 04 96          	mov    (%r14,%rdx,4),%eax
+    37f8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      89 44 95 00          	mov    %eax,0x0(%rbp,%rdx,4)
+        while (j > 0) {
+    37fc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |      48 85 d2             	test   %rdx,%rdx
+    37ff:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  \----- 75 ef                	jne    37f0 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x330>
+}
+    3801:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 83 c4 18          	add    $0x18,%rsp
+    3805:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         5b                   	pop    %rbx
+    3806:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         5d                   	pop    %rbp
+    3807:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         41 5c                	pop    %r12
+    3809:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         41 5d                	pop    %r13
+    380b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         41 5e                	pop    %r14
+    380d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         41 5f                	pop    %r15
+    380f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         c3                   	ret
+            p[--o] = less(buf[j - 1], p[i - 1]) ? move(p[--i]) : move(buf[--j]);
+    3810:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  \-------> 48 83 e8 01          	sub    $0x1,%rax
+    3814:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |            49 83 ec 01          	sub    $0x1,%r12
+    3818:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |            41 8b 14 86          	mov    (%r14,%rax,4),%edx
+    381c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |            42 89 54 a5 00       	mov    %edx,0x0(%rbp,%r12,4)
+        while (i > 0 && j > 0) {
+    3821:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |            48 85 c0             	test   %rax,%rax
+    3824:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  +--|-----|----------- 0f 85 4e ff ff ff    	jne    3778 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x2b8>
+}
+    382a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |            48 83 c4 18          	add    $0x18,%rsp
+    382e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |            5b                   	pop    %rbx
+    382f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |            5d                   	pop    %rbp
+    3830:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |            41 5c                	pop    %r12
+    3832:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |            41 5d                	pop    %r13
+    3834:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |            41 5e                	pop    %r14
+    3836:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |            41 5f                	pop    %r15
+    3838:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |            c3                   	ret
+    3839:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |            0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    3840:	|  |  |  |  |  \--|--|--|--|--|--|--|--|--|--|--|-----|----------> 48 8d 46 ff          	lea    -0x1(%rsi),%rax
+    3844:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |     |            4c 8b 34 24          	mov    (%rsp),%r14
+        for (Index i = 0; i < a; ++i) {
+    3848:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |     |            48 83 f8 02          	cmp    $0x2,%rax
+    384c:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  /--|----------- 0f 86 a5 01 00 00    	jbe    39f7 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x537>
+    3852:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |            48 8d 45 04          	lea    0x4(%rbp),%rax
+    3856:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |            4c 89 f2             	mov    %r14,%rdx
+    3859:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |            48 29 c2             	sub    %rax,%rdx
+    if (a <= b && a <= buf_n) {
+    385c:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |            31 c0                	xor    %eax,%eax
+    385e:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |            48 83 fa 08          	cmp    $0x8,%rdx
+    3862:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     /----- 0f 87 fe 00 00 00    	ja     3966 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x4a6>
+    3868:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    386f:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |     |      00 
+            buf[i] = move(p[i]);
+    3870:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  /--|----> 8b 54 85 00          	mov    0x0(%rbp,%rax,4),%edx
+    3874:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      41 89 14 86          	mov    %edx,(%r14,%rax,4)
+        for (Index i = 0; i < a; ++i) {
+    3878:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 83 c0 01          	add    $0x1,%rax
+    387c:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 39 c6             	cmp    %rax,%rsi
+    387f:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  +--|----- 75 ef                	jne    3870 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x3b0>
+        Index o = 0;
+    3881:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      31 c0                	xor    %eax,%eax
+        Index i = 0;
+    3883:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      31 d2                	xor    %edx,%edx
+        while (i < a && j < n) {
+    3885:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      4c 39 e6             	cmp    %r12,%rsi
+    3888:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  \--|--|--|--|----- 0f 83 39 fe ff ff    	jae    36c7 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x207>
+    if (a <= b && a <= buf_n) {
+    388e:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  /--|--|--|--|----> 48 89 f1             	mov    %rsi,%rcx
+        Index o = 0;
+    3891:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      31 c0                	xor    %eax,%eax
+        Index i = 0;
+    3893:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      31 d2                	xor    %edx,%edx
+    3895:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      0f 1f 00             	nopl   (%rax)
+            return a < b;
+    3898:	|  |  |  |  |     |  |  |  |  |  |  >--|--|--|--|--|--|--|--|----> 44 8b 44 8d 00       	mov    0x0(%rbp,%rcx,4),%r8d
+    389d:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      41 8b 3c 96          	mov    (%r14,%rdx,4),%edi
+            p[o++] = less(p[j], buf[i]) ? move(p[j++]) : move(buf[i++]);
+    38a1:	|  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      44 39 c7             	cmp    %r8d,%edi
+    38a4:	|  |  |  |  |     |  |  |  |  |  |  |  \--|--|--|--|--|--|--|----- 0f 8e fe fd ff ff    	jle    36a8 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x1e8>
+    38aa:	|  |  |  |  |     |  |  |  |  |  |  |     |  |  |  |  |  |  |      48 83 c0 01          	add    $0x1,%rax
+    38ae:	|  |  |  |  |     |  |  |  |  |  |  |     |  |  |  |  |  |  |      48 83 c1 01          	add    $0x1,%rcx
+    38b2:	|  |  |  |  |     |  |  |  |  |  |  |     |  |  |  |  |  |  |      44 89 44 85 fc       	mov    %r8d,-0x4(%rbp,%rax,4)
+        while (i < a && j < n) {
+    38b7:	|  |  |  |  |     |  |  |  |  |  |  |     |  |  |  |  |  |  |      4c 39 e1             	cmp    %r12,%rcx
+    38ba:	|  |  |  |  |     |  |  |  |  |  |  |     \--|--|--|--|--|--|----- 0f 83 02 fe ff ff    	jae    36c2 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x202>
+    38c0:	|  |  |  |  |     |  |  |  |  |  |  |        |  |  |  |  |  |      48 39 f2             	cmp    %rsi,%rdx
+    38c3:	|  |  |  |  |     |  |  |  |  |  |  \--------|--|--|--|--|--|----- 72 d3                	jb     3898 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x3d8>
+    38c5:	|  +--|--|--|-----|--|--|--|--|--|-----------|--|--|--|--|--|----- e9 4e fe ff ff       	jmp    3718 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x258>
+    38ca:	|  |  |  |  |     |  |  |  |  |  |           |  |  |  |  |  |      66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+            return a < b;
+    38d0:	|  |  |  |  |     |  |  |  \--|--|-----------|--|--|--|--|--|----> 8b 12                	mov    (%rdx),%edx
+    38d2:	|  |  |  |  |     |  |  |     |  |           |  |  |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    38d5:	|  |  |  |  |     |  |  |     |  |           |  |  |  |  |  |      31 c9                	xor    %ecx,%ecx
+    38d7:	|  |  |  |  |     |  |  |     |  \-----------|--|--|--|--|--|----- e9 b2 fd ff ff       	jmp    368e <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x1ce>
+    38dc:	|  |  |  |  |     |  |  |     |              |  |  |  |  |  |      0f 1f 40 00          	nopl   0x0(%rax)
+    38e0:	|  |  |  \--|-----|--|--|-----|--------------|--|--|--|--|--|----> 45 8b 01             	mov    (%r9),%r8d
+    38e3:	|  |  |     |     |  |  |     |              |  |  |  |  |  |      31 c9                	xor    %ecx,%ecx
+    38e5:	|  |  |     \-----|--|--|-----|--------------|--|--|--|--|--|----- e9 c4 fc ff ff       	jmp    35ae <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0xee>
+    38ea:	|  |  |           |  |  |     |              |  |  |  \--|--|----> 48 89 c1             	mov    %rax,%rcx
+    38ed:	|  |  |           |  |  |     |              |  |  |     |  |      48 c1 e9 02          	shr    $0x2,%rcx
+    38f1:	|  |  |           |  |  |     |              |  |  |     |  |      48 c1 e1 04          	shl    $0x4,%rcx
+    38f5:	|  |  |           |  |  |     |              |  |  |     |  |      0f 1f 00             	nopl   (%rax)
+            buf[j] = move(p[m + j]);
+    38f8:	|  |  |           |  |  |     |              |  |  |     |  |  /-> f3 41 0f 6f 04 13    	movdqu (%r11,%rdx,1),%xmm0
+    38fe:	|  |  |           |  |  |     |              |  |  |     |  |  |   41 0f 11 04 16       	movups %xmm0,(%r14,%rdx,1)
+        for (Index j = 0; j < b; ++j) {
+    3903:	|  |  |           |  |  |     |              |  |  |     |  |  |   48 83 c2 10          	add    $0x10,%rdx
+    3907:	|  |  |           |  |  |     |              |  |  |     |  |  |   48 39 ca             	cmp    %rcx,%rdx
+    390a:	|  |  |           |  |  |     |              |  |  |     |  |  \-- 75 ec                	jne    38f8 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x438>
+    390c:	|  |  |           |  |  |     |              |  |  |     |  |      48 89 c2             	mov    %rax,%rdx
+    390f:	|  |  |           |  |  |     |              |  |  |     |  |      48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+    3913:	|  |  |           |  |  |     |              |  |  |     |  |      a8 03                	test   $0x3,%al
+    3915:	|  |  |           |  |  |     |              +--|--|-----|--|----- 0f 84 5d fe ff ff    	je     3778 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x2b8>
+            buf[j] = move(p[m + j]);
+    391b:	|  |  |           |  |  |     |              |  |  |     |  |      48 8d 0c 32          	lea    (%rdx,%rsi,1),%rcx
+    391f:	|  |  |           |  |  |     |              |  |  |     |  |      48 8d 3c 95 00 00 00 	lea    0x0(,%rdx,4),%rdi
+    3926:	|  |  |           |  |  |     |              |  |  |     |  |      00 
+    3927:	|  |  |           |  |  |     |              |  |  |     |  |      8b 4c 8d 00          	mov    0x0(%rbp,%rcx,4),%ecx
+    392b:	|  |  |           |  |  |     |              |  |  |     |  |      41 89 0c 96          	mov    %ecx,(%r14,%rdx,4)
+        for (Index j = 0; j < b; ++j) {
+    392f:	|  |  |           |  |  |     |              |  |  |     |  |      48 8d 4a 01          	lea    0x1(%rdx),%rcx
+    3933:	|  |  |           |  |  |     |              |  |  |     |  |      48 39 c1             	cmp    %rax,%rcx
+    3936:	|  |  |           |  |  |     |              +--|--|-----|--|----- 0f 83 3c fe ff ff    	jae    3778 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x2b8>
+            buf[j] = move(p[m + j]);
+    393c:	|  |  |           |  |  |     |              |  |  |     |  |      48 01 f1             	add    %rsi,%rcx
+        for (Index j = 0; j < b; ++j) {
+    393f:	|  |  |           |  |  |     |              |  |  |     |  |      48 83 c2 02          	add    $0x2,%rdx
+            buf[j] = move(p[m + j]);
+    3943:	|  |  |           |  |  |     |              |  |  |     |  |      8b 4c 8d 00          	mov    0x0(%rbp,%rcx,4),%ecx
+    3947:	|  |  |           |  |  |     |              |  |  |     |  |      41 89 4c 3e 04       	mov    %ecx,0x4(%r14,%rdi,1)
+        for (Index j = 0; j < b; ++j) {
+    394c:	|  |  |           |  |  |     |              |  |  |     |  |      48 39 c2             	cmp    %rax,%rdx
+    394f:	|  |  |           |  |  |     |              +--|--|-----|--|----- 0f 83 23 fe ff ff    	jae    3778 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x2b8>
+            buf[j] = move(p[m + j]);
+    3955:	|  |  |           |  |  |     |              |  |  |     |  |      48 01 f2             	add    %rsi,%rdx
+    3958:	|  |  |           |  |  |     |              |  |  |     |  |      8b 54 95 00          	mov    0x0(%rbp,%rdx,4),%edx
+    395c:	|  |  |           |  |  |     |              |  |  |     |  |      41 89 54 3e 08       	mov    %edx,0x8(%r14,%rdi,1)
+        for (Index j = 0; j < b; ++j) {
+    3961:	|  |  |           |  |  |     |              \--|--|-----|--|----- e9 12 fe ff ff       	jmp    3778 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x2b8>
+    3966:	|  |  |           |  |  |     |                 |  |     |  \----> 48 89 f2             	mov    %rsi,%rdx
+    3969:	|  |  |           |  |  |     |                 |  |     |         48 c1 ea 02          	shr    $0x2,%rdx
+    396d:	|  |  |           |  |  |     |                 |  |     |         48 c1 e2 04          	shl    $0x4,%rdx
+    3971:	|  |  |           |  |  |     |                 |  |     |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            buf[i] = move(p[i]);
+    3978:	|  |  |           |  |  |     |                 |  |     |     /-> f3 0f 6f 4c 05 00    	movdqu 0x0(%rbp,%rax,1),%xmm1
+    397e:	|  |  |           |  |  |     |                 |  |     |     |   41 0f 11 0c 06       	movups %xmm1,(%r14,%rax,1)
+        for (Index i = 0; i < a; ++i) {
+    3983:	|  |  |           |  |  |     |                 |  |     |     |   48 83 c0 10          	add    $0x10,%rax
+    3987:	|  |  |           |  |  |     |                 |  |     |     |   48 39 c2             	cmp    %rax,%rdx
+    398a:	|  |  |           |  |  |     |                 |  |     |     \-- 75 ec                	jne    3978 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x4b8>
+    398c:	|  |  |           |  |  |     |                 |  |     |         48 89 f2             	mov    %rsi,%rdx
+    398f:	|  |  |           |  |  |     |                 |  |     |         48 89 f0             	mov    %rsi,%rax
+    3992:	|  |  |           |  |  |     |                 |  |     |         48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+    3996:	|  |  |           |  |  |     |                 |  |     |         83 e0 03             	and    $0x3,%eax
+    3999:	|  |  |           |  |  |     |                 |  |     |  /----- 0f 84 75 01 00 00    	je     3b14 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x654>
+            buf[i] = move(p[i]);
+    399f:	|  |  |           |  |  |     |                 |  |     |  |      8b 4c 95 00          	mov    0x0(%rbp,%rdx,4),%ecx
+    39a3:	|  |  |           |  |  |     |                 |  |     |  |      48 8d 04 95 00 00 00 	lea    0x0(,%rdx,4),%rax
+    39aa:	|  |  |           |  |  |     |                 |  |     |  |      00 
+    39ab:	|  |  |           |  |  |     |                 |  |     |  |      41 89 0c 96          	mov    %ecx,(%r14,%rdx,4)
+        for (Index i = 0; i < a; ++i) {
+    39af:	|  |  |           |  |  |     |                 |  |     |  |      48 8d 4a 01          	lea    0x1(%rdx),%rcx
+    39b3:	|  |  |           |  |  |     |                 |  |     |  |      48 39 f1             	cmp    %rsi,%rcx
+    39b6:	|  |  |           |  |  |     |                 |  |     |  |  /-- 73 1b                	jae    39d3 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x513>
+            buf[i] = move(p[i]);
+    39b8:	|  |  |           |  |  |     |                 |  |     |  |  |   8b 4c 05 04          	mov    0x4(%rbp,%rax,1),%ecx
+        for (Index i = 0; i < a; ++i) {
+    39bc:	|  |  |           |  |  |     |                 |  |     |  |  |   48 83 c2 02          	add    $0x2,%rdx
+            buf[i] = move(p[i]);
+    39c0:	|  |  |           |  |  |     |                 |  |     |  |  |   41 89 4c 06 04       	mov    %ecx,0x4(%r14,%rax,1)
+        for (Index i = 0; i < a; ++i) {
+    39c5:	|  |  |           |  |  |     |                 |  |     |  |  |   48 39 f2             	cmp    %rsi,%rdx
+    39c8:	|  |  |           |  |  |     |                 |  |     |  |  +-- 73 09                	jae    39d3 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x513>
+            buf[i] = move(p[i]);
+    39ca:	|  |  |           |  |  |     |                 |  |     |  |  |   8b 54 05 08          	mov    0x8(%rbp,%rax,1),%edx
+    39ce:	|  |  |           |  |  |     |                 |  |     |  |  |   41 89 54 06 08       	mov    %edx,0x8(%r14,%rax,1)
+        while (i < a && j < n) {
+    39d3:	|  |  |           |  |  |     |                 |  |     |  |  \-> 4c 39 e6             	cmp    %r12,%rsi
+    39d6:	|  |  |           |  |  |     |                 +--|-----|--|----- 0f 82 b2 fe ff ff    	jb     388e <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x3ce>
+    39dc:	|  |  |           |  |  |     |                 |  |     |  |      49 89 f1             	mov    %rsi,%r9
+        Index i = 0;
+    39df:	|  |  |           |  |  |     |                 |  |     |  |      31 d2                	xor    %edx,%edx
+        Index o = 0;
+    39e1:	|  |  |           |  |  |     |                 |  |     |  |      31 c0                	xor    %eax,%eax
+    39e3:	|  |  +-----------|--|--|-----|-----------------|--|-----|--|----- e9 ef fc ff ff       	jmp    36d7 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x217>
+    39e8:	|  |  |           |  |  |     |                 |  |     |  |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    39ef:	|  |  |           |  |  |     |                 |  |     |  |      00 
+    } else if (b < a && b <= buf_n) {
+    39f0:	|  |  |           |  \--|-----|-----------------|--|-----|--|----> 31 d2                	xor    %edx,%edx
+    39f2:	|  |  |           |     |     \-----------------|--|-----|--|----- e9 69 fd ff ff       	jmp    3760 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x2a0>
+    if (a <= b && a <= buf_n) {
+    39f7:	|  |  |           |     |                       |  \-----|--|----> 31 c0                	xor    %eax,%eax
+    39f9:	|  |  |           |     |                       |        \--|----- e9 72 fe ff ff       	jmp    3870 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x3b0>
+    39fe:	|  |  |           \-----|-----------------------|-----------|----> 4d 89 c8             	mov    %r9,%r8
+    3a01:	|  |  |                 |                       |           |      4d 8d 54 0e fc       	lea    -0x4(%r14,%rcx,1),%r10
+        while (i < a && j < n) {
+    3a06:	|  |  |                 |                       |           |      31 c9                	xor    %ecx,%ecx
+    3a08:	|  |  |                 |                       |           |      49 c1 e8 02          	shr    $0x2,%r8
+    3a0c:	|  |  |                 |                       |           |      49 c1 e0 04          	shl    $0x4,%r8
+            p[o++] = move(buf[i++]);
+    3a10:	|  |  |                 |                       |           |  /-> f3 41 0f 6f 14 0a    	movdqu (%r10,%rcx,1),%xmm2
+    3a16:	|  |  |                 |                       |           |  |   0f 11 14 0f          	movups %xmm2,(%rdi,%rcx,1)
+        while (i < a) {
+    3a1a:	|  |  |                 |                       |           |  |   48 83 c1 10          	add    $0x10,%rcx
+    3a1e:	|  |  |                 |                       |           |  |   4c 39 c1             	cmp    %r8,%rcx
+    3a21:	|  |  |                 |                       |           |  \-- 75 ed                	jne    3a10 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x550>
+    3a23:	|  |  |                 |                       |           |      4c 89 c9             	mov    %r9,%rcx
+    3a26:	|  |  |                 |                       |           |      48 83 e1 fc          	and    $0xfffffffffffffffc,%rcx
+    3a2a:	|  |  |                 |                       |           |      48 01 ca             	add    %rcx,%rdx
+    3a2d:	|  |  |                 |                       |           |      48 01 c1             	add    %rax,%rcx
+    3a30:	|  |  |                 |                       |           |      41 83 e1 03          	and    $0x3,%r9d
+    3a34:	|  +--|-----------------|-----------------------|-----------|----- 0f 84 de fc ff ff    	je     3718 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x258>
+            p[o++] = move(buf[i++]);
+    3a3a:	|  |  |                 |                       |           |      45 8b 04 96          	mov    (%r14,%rdx,4),%r8d
+    3a3e:	|  |  |                 |                       |           |      48 8d 04 8d 00 00 00 	lea    0x0(,%rcx,4),%rax
+    3a45:	|  |  |                 |                       |           |      00 
+    3a46:	|  |  |                 |                       |           |      48 8d 3c 95 00 00 00 	lea    0x0(,%rdx,4),%rdi
+    3a4d:	|  |  |                 |                       |           |      00 
+    3a4e:	|  |  |                 |                       |           |      44 89 44 8d 00       	mov    %r8d,0x0(%rbp,%rcx,4)
+    3a53:	|  |  |                 |                       |           |      48 8d 4a 01          	lea    0x1(%rdx),%rcx
+        while (i < a) {
+    3a57:	|  |  |                 |                       |           |      48 39 f1             	cmp    %rsi,%rcx
+    3a5a:	|  +--|-----------------|-----------------------|-----------|----- 0f 83 b8 fc ff ff    	jae    3718 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x258>
+            p[o++] = move(buf[i++]);
+    3a60:	|  |  |                 |                       |           |      41 8b 4c 3e 04       	mov    0x4(%r14,%rdi,1),%ecx
+    3a65:	|  |  |                 |                       |           |      48 83 c2 02          	add    $0x2,%rdx
+    3a69:	|  |  |                 |                       |           |      89 4c 05 04          	mov    %ecx,0x4(%rbp,%rax,1)
+        while (i < a) {
+    3a6d:	|  |  |                 |                       |           |      48 39 f2             	cmp    %rsi,%rdx
+    3a70:	|  +--|-----------------|-----------------------|-----------|----- 0f 83 a2 fc ff ff    	jae    3718 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x258>
+            p[o++] = move(buf[i++]);
+    3a76:	|  |  |                 |                       |           |      41 8b 54 3e 08       	mov    0x8(%r14,%rdi,1),%edx
+    3a7b:	|  |  |                 |                       |           |      89 54 05 08          	mov    %edx,0x8(%rbp,%rax,1)
+        while (i < a) {
+    3a7f:	|  +--|-----------------|-----------------------|-----------|----- e9 94 fc ff ff       	jmp    3718 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x258>
+    3a84:	|  |  |                 \-----------------------|-----------|----> 49 8d 7c 36 f0       	lea    -0x10(%r14,%rsi,1),%rdi
+    3a89:	|  |  |                                         |           |      48 8d 74 0d f0       	lea    -0x10(%rbp,%rcx,1),%rsi
+    3a8e:	|  |  |                                         |           |      48 89 c1             	mov    %rax,%rcx
+        while (j > 0) {
+    3a91:	|  |  |                                         |           |      31 d2                	xor    %edx,%edx
+    3a93:	|  |  |                                         |           |      48 c1 e9 02          	shr    $0x2,%rcx
+    3a97:	|  |  |                                         |           |      48 f7 d9             	neg    %rcx
+    3a9a:	|  |  |                                         |           |      48 c1 e1 04          	shl    $0x4,%rcx
+    3a9e:	|  |  |                                         |           |      66 90                	xchg   %ax,%ax
+            p[--o] = move(buf[--j]);
+    3aa0:	|  |  |                                         |           |  /-> f3 0f 6f 1c 17       	movdqu (%rdi,%rdx,1),%xmm3
+    3aa5:	|  |  |                                         |           |  |   0f 11 1c 16          	movups %xmm3,(%rsi,%rdx,1)
+        while (j > 0) {
+    3aa9:	|  |  |                                         |           |  |   48 83 ea 10          	sub    $0x10,%rdx
+    3aad:	|  |  |                                         |           |  |   48 39 d1             	cmp    %rdx,%rcx
+    3ab0:	|  |  |                                         |           |  \-- 75 ee                	jne    3aa0 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x5e0>
+    3ab2:	|  |  |                                         |           |      a8 03                	test   $0x3,%al
+    3ab4:	|  +--|-----------------------------------------|-----------|----- 0f 84 5e fc ff ff    	je     3718 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x258>
+    3aba:	|  |  |                                         |           |      48 89 c2             	mov    %rax,%rdx
+    3abd:	|  |  |                                         |           |      83 e0 03             	and    $0x3,%eax
+    3ac0:	|  |  |                                         |           |      48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+            p[--o] = move(buf[--j]);
+    3ac4:	|  |  |                                         |           |      48 8d 48 ff          	lea    -0x1(%rax),%rcx
+    3ac8:	|  |  |                                         |           |      45 8b 04 8e          	mov    (%r14,%rcx,4),%r8d
+    3acc:	|  |  |                                         |           |      49 29 d4             	sub    %rdx,%r12
+    3acf:	|  |  |                                         |           |      48 8d 3c 8d 00 00 00 	lea    0x0(,%rcx,4),%rdi
+    3ad6:	|  |  |                                         |           |      00 
+    3ad7:	|  |  |                                         |           |      49 8d 54 24 ff       	lea    -0x1(%r12),%rdx
+    3adc:	|  |  |                                         |           |      44 89 44 95 00       	mov    %r8d,0x0(%rbp,%rdx,4)
+    3ae1:	|  |  |                                         |           |      48 8d 34 95 00 00 00 	lea    0x0(,%rdx,4),%rsi
+    3ae8:	|  |  |                                         |           |      00 
+        while (j > 0) {
+    3ae9:	|  |  |                                         |           |      48 85 c9             	test   %rcx,%rcx
+    3aec:	|  +--|-----------------------------------------|-----------|----- 0f 84 26 fc ff ff    	je     3718 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x258>
+            p[--o] = move(buf[--j]);
+    3af2:	|  |  |                                         |           |      41 8b 54 3e fc       	mov    -0x4(%r14,%rdi,1),%edx
+    3af7:	|  |  |                                         |           |      89 54 35 fc          	mov    %edx,-0x4(%rbp,%rsi,1)
+        while (j > 0) {
+    3afb:	|  |  |                                         |           |      48 83 f8 02          	cmp    $0x2,%rax
+    3aff:	|  +--|-----------------------------------------|-----------|----- 0f 84 13 fc ff ff    	je     3718 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x258>
+            p[--o] = move(buf[--j]);
+    3b05:	|  |  |                                         |           |      41 8b 44 3e f8       	mov    -0x8(%r14,%rdi,1),%eax
+    3b0a:	|  |  |                                         |           |      89 44 35 f8          	mov    %eax,-0x8(%rbp,%rsi,1)
+        while (j > 0) {
+    3b0e:	|  \--|-----------------------------------------|-----------|----- e9 05 fc ff ff       	jmp    3718 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x258>
+    3b13:	\-----|-----------------------------------------|-----------|----> c3                   	ret
+        Index i = 0;
+    3b14:	      |                                         |           \----> 31 d2                	xor    %edx,%edx
+        while (i < a && j < n) {
+    3b16:	      |                                         |                  49 89 f1             	mov    %rsi,%r9
+    3b19:	      |                                         |                  4c 39 e6             	cmp    %r12,%rsi
+    3b1c:	      |                                         \----------------- 0f 82 6c fd ff ff    	jb     388e <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x3ce>
+    3b22:	      \----------------------------------------------------------- e9 b0 fb ff ff       	jmp    36d7 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x217>
+    3b27:	                                                                   66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    3b2e:	                                                                   00 00 
+
+0000000000003b30 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    3b30:	53                   	push   %rbx
+    3b31:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    3b34:	40 0f be fe          	movsbl %sil,%edi
+    3b38:	48 8b 35 21 25 00 00 	mov    0x2521(%rip),%rsi        # 6060 <stderr@GLIBC_2.2.5>
+    3b3f:	e8 3c d5 ff ff       	call   1080 <fputc@plt>
+    return outs;
+}
+    3b44:	48 89 d8             	mov    %rbx,%rax
+    3b47:	5b                   	pop    %rbx
+    3b48:	c3                   	ret
+    3b49:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000003b50 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    3b50:	53                   	push   %rbx
+    3b51:	48 89 fb             	mov    %rdi,%rbx
+    3b54:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    3b57:	48 8b 35 02 25 00 00 	mov    0x2502(%rip),%rsi        # 6060 <stderr@GLIBC_2.2.5>
+    3b5e:	e8 0d d5 ff ff       	call   1070 <fputs@plt>
+    return outs;
+}
+    3b63:	48 89 d8             	mov    %rbx,%rax
+    3b66:	5b                   	pop    %rbx
+    3b67:	c3                   	ret
+    3b68:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    3b6f:	00 
+
+0000000000003b70 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    3b70:	53                   	push   %rbx
+    3b71:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    3b74:	48 8b 3d e5 24 00 00 	mov    0x24e5(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+    3b7b:	40 0f b6 d6          	movzbl %sil,%edx
+    3b7f:	31 c0                	xor    %eax,%eax
+    3b81:	48 8d 35 40 06 00 00 	lea    0x640(%rip),%rsi        # 41c8 <_IO_stdin_used+0x1c8>
+    3b88:	e8 03 d5 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    3b8d:	48 89 d8             	mov    %rbx,%rax
+    3b90:	5b                   	pop    %rbx
+    3b91:	c3                   	ret
+    3b92:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    3b99:	00 00 00 00 
+    3b9d:	0f 1f 00             	nopl   (%rax)
+
+0000000000003ba0 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    3ba0:	53                   	push   %rbx
+    3ba1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    3ba4:	48 8b 3d b5 24 00 00 	mov    0x24b5(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+    3bab:	0f b7 d6             	movzwl %si,%edx
+    3bae:	31 c0                	xor    %eax,%eax
+    3bb0:	48 8d 35 11 06 00 00 	lea    0x611(%rip),%rsi        # 41c8 <_IO_stdin_used+0x1c8>
+    3bb7:	e8 d4 d4 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    3bbc:	48 89 d8             	mov    %rbx,%rax
+    3bbf:	5b                   	pop    %rbx
+    3bc0:	c3                   	ret
+    3bc1:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    3bc8:	00 00 00 00 
+    3bcc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000003bd0 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    3bd0:	53                   	push   %rbx
+    3bd1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    3bd4:	48 8b 3d 85 24 00 00 	mov    0x2485(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+{
+    3bdb:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    3bdd:	31 c0                	xor    %eax,%eax
+    3bdf:	48 8d 35 e2 05 00 00 	lea    0x5e2(%rip),%rsi        # 41c8 <_IO_stdin_used+0x1c8>
+    3be6:	e8 a5 d4 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    3beb:	48 89 d8             	mov    %rbx,%rax
+    3bee:	5b                   	pop    %rbx
+    3bef:	c3                   	ret
+
+0000000000003bf0 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    3bf0:	53                   	push   %rbx
+    3bf1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    3bf4:	48 8b 3d 65 24 00 00 	mov    0x2465(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+{
+    3bfb:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    3bfd:	31 c0                	xor    %eax,%eax
+    3bff:	48 8d 35 c2 05 00 00 	lea    0x5c2(%rip),%rsi        # 41c8 <_IO_stdin_used+0x1c8>
+    3c06:	e8 85 d4 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    3c0b:	48 89 d8             	mov    %rbx,%rax
+    3c0e:	5b                   	pop    %rbx
+    3c0f:	c3                   	ret
+
+0000000000003c10 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    3c10:	53                   	push   %rbx
+    3c11:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    3c14:	48 8b 3d 45 24 00 00 	mov    0x2445(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+{
+    3c1b:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    3c1e:	31 c0                	xor    %eax,%eax
+    3c20:	48 8d 35 a4 05 00 00 	lea    0x5a4(%rip),%rsi        # 41cb <_IO_stdin_used+0x1cb>
+    3c27:	e8 64 d4 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    3c2c:	48 89 d8             	mov    %rbx,%rax
+    3c2f:	5b                   	pop    %rbx
+    3c30:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000003c34 <_fini>:
+    3c34:	48 83 ec 08          	sub    $0x8,%rsp
+    3c38:	48 83 c4 08          	add    $0x8,%rsp
+    3c3c:	c3                   	ret
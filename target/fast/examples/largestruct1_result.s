@@ -0,0 +1,2605 @@
+
+target/fast/examples/largestruct1_result:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 3f 00 00 	mov    0x3fc5(%rip),%rax        # 4fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 3f 00 00    	push   0x3fca(%rip)        # 4ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 3f 00 00    	jmp    *0x3fcc(%rip)        # 4ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 3f 00 00    	jmp    *0x3fca(%rip)        # 5000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 3f 00 00    	jmp    *0x3fc2(%rip)        # 5008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 3f 00 00    	jmp    *0x3fba(%rip)        # 5010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memset@plt>:
+    1060:	ff 25 b2 3f 00 00    	jmp    *0x3fb2(%rip)        # 5018 <memset@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 3f 00 00    	jmp    *0x3faa(%rip)        # 5020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 3f 00 00    	jmp    *0x3fa2(%rip)        # 5028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 3f 00 00    	jmp    *0x3f9a(%rip)        # 5030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcpy@plt>:
+    10a0:	ff 25 92 3f 00 00    	jmp    *0x3f92(%rip)        # 5038 <memcpy@GLIBC_2.14>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <malloc@plt>:
+    10b0:	ff 25 8a 3f 00 00    	jmp    *0x3f8a(%rip)        # 5040 <malloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <realloc@plt>:
+    10c0:	ff 25 82 3f 00 00    	jmp    *0x3f82(%rip)        # 5048 <realloc@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <memmove@plt>:
+    10d0:	ff 25 7a 3f 00 00    	jmp    *0x3f7a(%rip)        # 5050 <memmove@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010e0 <__cxa_finalize@plt>:
+    10e0:	ff 25 fa 3e 00 00    	jmp    *0x3efa(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10e6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010f0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10f0:	50                   	push   %rax
+    std::abort();
+    10f1:	e8 4a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010f6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10f6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10f7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10fa:	4c 8d 0d d7 1f 00 00 	lea    0x1fd7(%rip),%r9        # 30d8 <_IO_stdin_used+0xd8>
+    1101:	31 c0                	xor    %eax,%eax
+    1103:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    1107:	4c 8b 07             	mov    (%rdi),%r8
+    110a:	48 8d 35 cd 1f 00 00 	lea    0x1fcd(%rip),%rsi        # 30de <_IO_stdin_used+0xde>
+    1111:	48 8b 3d 68 3f 00 00 	mov    0x3f68(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1118:	e8 73 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    111d:	e8 1e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001122 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1122:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1126:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1129:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    112d:	31 c0                	xor    %eax,%eax
+    112f:	57                   	push   %rdi
+    1130:	48 8b 3d 49 3f 00 00 	mov    0x3f49(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1137:	4c 8d 0d 9a 1f 00 00 	lea    0x1f9a(%rip),%r9        # 30d8 <_IO_stdin_used+0xd8>
+    113e:	4c 8b 06             	mov    (%rsi),%r8
+    1141:	48 8d 35 a7 1f 00 00 	lea    0x1fa7(%rip),%rsi        # 30ef <_IO_stdin_used+0xef>
+    1148:	e8 43 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    114d:	e8 ee fe ff ff       	call   1040 <abort@plt>
+
+0000000000001152 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1152:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1156:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1159:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    115d:	31 c0                	xor    %eax,%eax
+    115f:	57                   	push   %rdi
+    1160:	48 8b 3d 19 3f 00 00 	mov    0x3f19(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1167:	4c 8d 0d 96 1f 00 00 	lea    0x1f96(%rip),%r9        # 3104 <_IO_stdin_used+0x104>
+    116e:	4c 8b 06             	mov    (%rsi),%r8
+    1171:	48 8d 35 77 1f 00 00 	lea    0x1f77(%rip),%rsi        # 30ef <_IO_stdin_used+0xef>
+    1178:	e8 13 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    117d:	e8 be fe ff ff       	call   1040 <abort@plt>
+    1182:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1189:	00 00 00 
+    118c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001190 <main>:
+        nel::log << v << '\n';
+    }
+}
+
+int main()
+{
+    1190:	48 83 ec 08          	sub    $0x8,%rsp
+    handleok1();
+    1194:	e8 87 0a 00 00       	call   1c20 <handleok1()>
+    handlefail1();
+    handleok2();
+    1199:	e8 82 0c 00 00       	call   1e20 <handleok2()>
+    handlefail2();
+    119e:	e8 7d 0e 00 00       	call   2020 <handlefail2()>
+}
+    11a3:	31 c0                	xor    %eax,%eax
+    11a5:	48 83 c4 08          	add    $0x8,%rsp
+    11a9:	c3                   	ret
+    11aa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000000011b0 <_start>:
+    11b0:	31 ed                	xor    %ebp,%ebp
+    11b2:	49 89 d1             	mov    %rdx,%r9
+    11b5:	5e                   	pop    %rsi
+    11b6:	48 89 e2             	mov    %rsp,%rdx
+    11b9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    11bd:	50                   	push   %rax
+    11be:	54                   	push   %rsp
+    11bf:	45 31 c0             	xor    %r8d,%r8d
+    11c2:	31 c9                	xor    %ecx,%ecx
+    11c4:	48 8d 3d c5 ff ff ff 	lea    -0x3b(%rip),%rdi        # 1190 <main>
+    11cb:	ff 15 ef 3d 00 00    	call   *0x3def(%rip)        # 4fc0 <__libc_start_main@GLIBC_2.34>
+    11d1:	f4                   	hlt
+    11d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    11d9:	00 00 00 
+    11dc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000011e0 <deregister_tm_clones>:
+    11e0:	    48 8d 3d 81 3e 00 00 	lea    0x3e81(%rip),%rdi        # 5068 <__TMC_END__>
+    11e7:	    48 8d 05 7a 3e 00 00 	lea    0x3e7a(%rip),%rax        # 5068 <__TMC_END__>
+    11ee:	    48 39 f8             	cmp    %rdi,%rax
+    11f1:	/-- 74 15                	je     1208 <deregister_tm_clones+0x28>
+    11f3:	|   48 8b 05 ce 3d 00 00 	mov    0x3dce(%rip),%rax        # 4fc8 <_ITM_deregisterTMCloneTable@Base>
+    11fa:	|   48 85 c0             	test   %rax,%rax
+    11fd:	+-- 74 09                	je     1208 <deregister_tm_clones+0x28>
+    11ff:	|   ff e0                	jmp    *%rax
+    1201:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1208:	\-> c3                   	ret
+    1209:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001210 <register_tm_clones>:
+    1210:	    48 8d 3d 51 3e 00 00 	lea    0x3e51(%rip),%rdi        # 5068 <__TMC_END__>
+    1217:	    48 8d 35 4a 3e 00 00 	lea    0x3e4a(%rip),%rsi        # 5068 <__TMC_END__>
+    121e:	    48 29 fe             	sub    %rdi,%rsi
+    1221:	    48 89 f0             	mov    %rsi,%rax
+    1224:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1228:	    48 c1 f8 03          	sar    $0x3,%rax
+    122c:	    48 01 c6             	add    %rax,%rsi
+    122f:	    48 d1 fe             	sar    %rsi
+    1232:	/-- 74 14                	je     1248 <register_tm_clones+0x38>
+    1234:	|   48 8b 05 9d 3d 00 00 	mov    0x3d9d(%rip),%rax        # 4fd8 <_ITM_registerTMCloneTable@Base>
+    123b:	|   48 85 c0             	test   %rax,%rax
+    123e:	+-- 74 08                	je     1248 <register_tm_clones+0x38>
+    1240:	|   ff e0                	jmp    *%rax
+    1242:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1248:	\-> c3                   	ret
+    1249:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001250 <__do_global_dtors_aux>:
+    1250:	       f3 0f 1e fa          	endbr64
+    1254:	       80 3d 2d 3e 00 00 00 	cmpb   $0x0,0x3e2d(%rip)        # 5088 <completed.0>
+    125b:	/----- 75 2b                	jne    1288 <__do_global_dtors_aux+0x38>
+    125d:	|      55                   	push   %rbp
+    125e:	|      48 83 3d 7a 3d 00 00 	cmpq   $0x0,0x3d7a(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1265:	|      00 
+    1266:	|      48 89 e5             	mov    %rsp,%rbp
+    1269:	|  /-- 74 0c                	je     1277 <__do_global_dtors_aux+0x27>
+    126b:	|  |   48 8b 3d ee 3d 00 00 	mov    0x3dee(%rip),%rdi        # 5060 <__dso_handle>
+    1272:	|  |   e8 69 fe ff ff       	call   10e0 <__cxa_finalize@plt>
+    1277:	|  \-> e8 64 ff ff ff       	call   11e0 <deregister_tm_clones>
+    127c:	|      c6 05 05 3e 00 00 01 	movb   $0x1,0x3e05(%rip)        # 5088 <completed.0>
+    1283:	|      5d                   	pop    %rbp
+    1284:	|      c3                   	ret
+    1285:	|      0f 1f 00             	nopl   (%rax)
+    1288:	\----> c3                   	ret
+    1289:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001290 <frame_dummy>:
+    1290:	f3 0f 1e fa          	endbr64
+    1294:	e9 77 ff ff ff       	jmp    1210 <register_tm_clones>
+    1299:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000012a0 <operator<<(nel::Log&, ErrorCode const&) [clone .part.0]>:
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    12a0:	48 8d 05 68 1d 00 00 	lea    0x1d68(%rip),%rax        # 300f <_IO_stdin_used+0xf>
+    12a7:	48 8d 15 56 1d 00 00 	lea    0x1d56(%rip),%rdx        # 3004 <_IO_stdin_used+0x4>
+enum class ErrorCode {
+    Failed = 1,
+};
+
+// std::ostream &operator<<(std::ostream &outs, ErrorCode const &val) {
+nel::Log &operator<<(nel::Log &outs, ErrorCode const &val)
+    12ae:	48 83 ec 28          	sub    $0x28,%rsp
+    12b2:	66 48 0f 6e c2       	movq   %rdx,%xmm0
+    12b7:	66 48 0f 6e c8       	movq   %rax,%xmm1
+            return outs << "Failed";
+            break;
+        default:
+            break;
+    }
+    nel::panic("unknown ErrorCode");
+    12bc:	48 89 e6             	mov    %rsp,%rsi
+            , file_name_(file_name)
+            , line_num_(line_num)
+    12bf:	c7 44 24 10 1a 00 00 	movl   $0x1a,0x10(%rsp)
+    12c6:	00 
+            : fn_name_(fn_name)
+    12c7:	66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    12cb:	48 8d 3d 4f 1d 00 00 	lea    0x1d4f(%rip),%rdi        # 3021 <_IO_stdin_used+0x21>
+    12d2:	0f 29 04 24          	movaps %xmm0,(%rsp)
+    12d6:	e8 47 fe ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    12db:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000000012e0 <operator<<(nel::Log&, ErrorCode const&)>:
+    switch (val) {
+    12e0:	    83 3e 01             	cmpl   $0x1,(%rsi)
+    12e3:	/-- 75 0c                	jne    12f1 <operator<<(nel::Log&, ErrorCode const&)+0x11>
+            return outs << "Failed";
+    12e5:	|   48 8d 35 47 1d 00 00 	lea    0x1d47(%rip),%rsi        # 3033 <_IO_stdin_used+0x33>
+    12ec:	|   e9 ff 16 00 00       	jmp    29f0 <nel::operator<<(nel::Log&, char const*)>
+{
+    12f1:	\-> 50                   	push   %rax
+    12f2:	    e8 a9 ff ff ff       	call   12a0 <operator<<(nel::Log&, ErrorCode const&) [clone .part.0]>
+    12f7:	    66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    12fe:	    00 00 
+
+0000000000001300 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    1300:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1305:	c3                   	ret
+    1306:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    130d:	00 00 00 
+
+0000000000001310 <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    1310:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1315:	c3                   	ret
+    1316:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    131d:	00 00 00 
+
+0000000000001320 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    1320:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1325:	c3                   	ret
+    1326:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    132d:	00 00 00 
+
+0000000000001330 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    1330:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1335:	c3                   	ret
+    1336:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    133d:	00 00 00 
+
+0000000000001340 <_read_r>:
+int _read_r(struct _reent *, int) {
+    1340:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1345:	c3                   	ret
+    1346:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    134d:	00 00 00 
+
+0000000000001350 <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    1350:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1355:	c3                   	ret
+    1356:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    135d:	00 00 00 
+
+0000000000001360 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    1360:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1365:	c3                   	ret
+    1366:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    136d:	00 00 00 
+
+0000000000001370 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1370:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1375:	c3                   	ret
+    1376:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    137d:	00 00 00 
+
+0000000000001380 <ok1()>:
+        // seems that the T&& variant is used and gets optimised to inplace create.
+        // removing this prevents moving const objects (or implicit coping).
+        // but if large >512bytes then does not get optimised out)
+        template<typename... Args>
+        constexpr Result(Phantom<Tag::OK> const, Args &&...args)
+            : tag_(Tag::OK)
+    1380:	c7 07 01 00 00 00    	movl   $0x1,(%rdi)
+{
+    1386:	48 89 f8             	mov    %rdi,%rax
+}
+    1389:	c3                   	ret
+    138a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000001390 <ok2()>:
+{
+    1390:	55                   	push   %rbp
+            nel::elem::copy(data_, o.data_, N);
+        }
+
+        constexpr U8Buf(U8Buf &&o)
+        {
+            nel::elem::move(data_, o.data_, N);
+    1391:	ba 00 01 00 00       	mov    $0x100,%edx
+    1396:	53                   	push   %rbx
+    1397:	48 89 fb             	mov    %rdi,%rbx
+    139a:	48 8d 7f 08          	lea    0x8(%rdi),%rdi
+    139e:	48 81 ec 08 01 00 00 	sub    $0x108,%rsp
+            : tag_(Tag::OK)
+    13a5:	c7 47 f8 01 00 00 00 	movl   $0x1,-0x8(%rdi)
+    13ac:	48 89 e5             	mov    %rsp,%rbp
+    13af:	48 89 ee             	mov    %rbp,%rsi
+    13b2:	e8 b9 0d 00 00       	call   2170 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    13b7:	48 89 ef             	mov    %rbp,%rdi
+    13ba:	ba 00 01 00 00       	mov    $0x100,%edx
+    13bf:	be a5 00 00 00       	mov    $0xa5,%esi
+    13c4:	e8 97 0d 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    13c9:	48 81 c4 08 01 00 00 	add    $0x108,%rsp
+    13d0:	48 89 d8             	mov    %rbx,%rax
+    13d3:	5b                   	pop    %rbx
+    13d4:	5d                   	pop    %rbp
+    13d5:	c3                   	ret
+    13d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    13dd:	00 00 00 
+
+00000000000013e0 <ok3()>:
+{
+    13e0:	55                   	push   %rbp
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+        {
+            nel::elem::set(data_, f, N);
+    13e1:	ba 00 01 00 00       	mov    $0x100,%edx
+    13e6:	be 22 00 00 00       	mov    $0x22,%esi
+    13eb:	53                   	push   %rbx
+    13ec:	48 89 fb             	mov    %rdi,%rbx
+    13ef:	48 81 ec 08 01 00 00 	sub    $0x108,%rsp
+    13f6:	48 89 e5             	mov    %rsp,%rbp
+    13f9:	48 89 ef             	mov    %rbp,%rdi
+    13fc:	e8 5f 0d 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1401:	c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+            nel::elem::move(data_, o.data_, N);
+    1407:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    140b:	48 89 ee             	mov    %rbp,%rsi
+    140e:	ba 00 01 00 00       	mov    $0x100,%edx
+    1413:	e8 58 0d 00 00       	call   2170 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1418:	48 89 ef             	mov    %rbp,%rdi
+    141b:	ba 00 01 00 00       	mov    $0x100,%edx
+    1420:	be a5 00 00 00       	mov    $0xa5,%esi
+    1425:	e8 36 0d 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    142a:	48 81 c4 08 01 00 00 	add    $0x108,%rsp
+    1431:	48 89 d8             	mov    %rbx,%rax
+    1434:	5b                   	pop    %rbx
+    1435:	5d                   	pop    %rbp
+    1436:	c3                   	ret
+    1437:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    143e:	00 00 
+
+0000000000001440 <ok4()>:
+{
+    1440:	53                   	push   %rbx
+            nel::elem::set(data_, f, N);
+    1441:	ba 00 01 00 00       	mov    $0x100,%edx
+    1446:	48 89 fb             	mov    %rdi,%rbx
+    1449:	be 33 00 00 00       	mov    $0x33,%esi
+            : tag_(Tag::OK)
+    144e:	c7 07 01 00 00 00    	movl   $0x1,(%rdi)
+    1454:	48 8d 7f 08          	lea    0x8(%rdi),%rdi
+    1458:	e8 03 0d 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    145d:	48 89 d8             	mov    %rbx,%rax
+    1460:	5b                   	pop    %rbx
+    1461:	c3                   	ret
+    1462:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1469:	00 00 00 00 
+    146d:	0f 1f 00             	nopl   (%rax)
+
+0000000000001470 <fail2()>:
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+            : value_(forward<Type>(val))
+    1470:	48 8d 15 41 1c 00 00 	lea    0x1c41(%rip),%rdx        # 30b8 <_IO_stdin_used+0xb8>
+        {
+        }
+#    endif
+
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+            : tag_(Tag::ERR)
+    1477:	c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+{
+    147d:	48 89 f8             	mov    %rdi,%rax
+    1480:	c7 47 08 01 00 00 00 	movl   $0x1,0x8(%rdi)
+    1487:	48 c7 47 10 22 00 00 	movq   $0x22,0x10(%rdi)
+    148e:	00 
+    148f:	48 89 57 18          	mov    %rdx,0x18(%rdi)
+}
+    1493:	c3                   	ret
+    1494:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    149b:	00 00 00 00 
+    149f:	90                   	nop
+
+00000000000014a0 <fail4()>:
+
+    public:
+        constexpr Error(ErrorCode const &code, char const *filename, Lineno const line)
+            : code(code)
+            , lineno(line)
+            , filename(filename)
+    14a0:	48 8d 15 11 1c 00 00 	lea    0x1c11(%rip),%rdx        # 30b8 <_IO_stdin_used+0xb8>
+#    if 1
+        // seems that the T&& variant is used and gets optimised to inplace create.
+        // removing this prevents moving const objects (or implicit coping).
+        template<typename... Args>
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+            : tag_(Tag::ERR)
+    14a7:	c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+{
+    14ad:	48 89 f8             	mov    %rdi,%rax
+            : code(code)
+    14b0:	c7 47 08 01 00 00 00 	movl   $0x1,0x8(%rdi)
+            , lineno(line)
+    14b7:	48 c7 47 10 27 00 00 	movq   $0x27,0x10(%rdi)
+    14be:	00 
+            , filename(filename)
+    14bf:	48 89 57 18          	mov    %rdx,0x18(%rdi)
+}
+    14c3:	c3                   	ret
+    14c4:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    14cb:	00 00 00 00 
+    14cf:	90                   	nop
+
+00000000000014d0 <passok3()>:
+{
+    14d0:	55                   	push   %rbp
+    14d1:	ba 00 01 00 00       	mov    $0x100,%edx
+    14d6:	be 22 00 00 00       	mov    $0x22,%esi
+    14db:	53                   	push   %rbx
+    14dc:	48 89 fb             	mov    %rdi,%rbx
+    14df:	48 81 ec 08 01 00 00 	sub    $0x108,%rsp
+    14e6:	48 89 e5             	mov    %rsp,%rbp
+    14e9:	48 89 ef             	mov    %rbp,%rdi
+    14ec:	e8 6f 0c 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            : tag_(Tag::OK)
+    14f1:	c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+            nel::elem::move(data_, o.data_, N);
+    14f7:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    14fb:	48 89 ee             	mov    %rbp,%rsi
+    14fe:	ba 00 01 00 00       	mov    $0x100,%edx
+    1503:	e8 68 0c 00 00       	call   2170 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1508:	48 89 ef             	mov    %rbp,%rdi
+    150b:	ba 00 01 00 00       	mov    $0x100,%edx
+    1510:	be a5 00 00 00       	mov    $0xa5,%esi
+    1515:	e8 46 0c 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    151a:	48 81 c4 08 01 00 00 	add    $0x108,%rsp
+    1521:	48 89 d8             	mov    %rbx,%rax
+    1524:	5b                   	pop    %rbx
+    1525:	5d                   	pop    %rbp
+    1526:	c3                   	ret
+    1527:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    152e:	00 00 
+
+0000000000001530 <passfail4()>:
+    1530:	48 8d 15 81 1b 00 00 	lea    0x1b81(%rip),%rdx        # 30b8 <_IO_stdin_used+0xb8>
+            : tag_(Tag::ERR)
+    1537:	c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+{
+    153d:	48 89 f8             	mov    %rdi,%rax
+            : code(code)
+    1540:	c7 47 08 01 00 00 00 	movl   $0x1,0x8(%rdi)
+            , lineno(line)
+    1547:	48 c7 47 10 27 00 00 	movq   $0x27,0x10(%rdi)
+    154e:	00 
+            , filename(filename)
+    154f:	48 89 57 18          	mov    %rdx,0x18(%rdi)
+}
+    1553:	c3                   	ret
+    1554:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    155b:	00 00 00 00 
+    155f:	90                   	nop
+
+0000000000001560 <passok31()>:
+{
+    1560:	                   41 54                	push   %r12
+            nel::elem::set(data_, f, N);
+    1562:	                   ba 00 01 00 00       	mov    $0x100,%edx
+    1567:	                   be 22 00 00 00       	mov    $0x22,%esi
+    156c:	                   55                   	push   %rbp
+    156d:	                   53                   	push   %rbx
+    156e:	                   48 89 fb             	mov    %rdi,%rbx
+    1571:	                   48 81 ec 10 02 00 00 	sub    $0x210,%rsp
+    1578:	                   48 89 e5             	mov    %rsp,%rbp
+            nel::elem::move(data_, o.data_, N);
+    157b:	                   4c 8d a4 24 08 01 00 	lea    0x108(%rsp),%r12
+    1582:	                   00 
+            nel::elem::set(data_, f, N);
+    1583:	                   48 89 ef             	mov    %rbp,%rdi
+    1586:	                   e8 d5 0b 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            nel::elem::move(data_, o.data_, N);
+    158b:	                   ba 00 01 00 00       	mov    $0x100,%edx
+    1590:	                   48 89 ee             	mov    %rbp,%rsi
+    1593:	                   4c 89 e7             	mov    %r12,%rdi
+            : tag_(Tag::OK)
+    1596:	                   c7 84 24 00 01 00 00 	movl   $0x1,0x100(%rsp)
+    159d:	                   01 00 00 00 
+    15a1:	                   e8 ca 0b 00 00       	call   2170 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    15a6:	                   ba 00 01 00 00       	mov    $0x100,%edx
+    15ab:	                   be a5 00 00 00       	mov    $0xa5,%esi
+    15b0:	                   48 89 ef             	mov    %rbp,%rdi
+    15b3:	                   e8 a8 0b 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    15b8:	                   48 8d 05 f9 1a 00 00 	lea    0x1af9(%rip),%rax        # 30b8 <_IO_stdin_used+0xb8>
+    15bf:	                   48 8d 0d 74 1a 00 00 	lea    0x1a74(%rip),%rcx        # 303a <_IO_stdin_used+0x3a>
+            , line_num_(line_num)
+    15c6:	                   c7 44 24 10 37 00 00 	movl   $0x37,0x10(%rsp)
+    15cd:	                   00 
+            : fn_name_(fn_name)
+    15ce:	                   66 48 0f 6e c8       	movq   %rax,%xmm1
+    15d3:	                   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    15d8:	                   8b 84 24 00 01 00 00 	mov    0x100(%rsp),%eax
+    15df:	                   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    15e3:	                   0f 29 04 24          	movaps %xmm0,(%rsp)
+        // &&on_err) const  {
+        template<typename V, typename Fn1, typename Fn2>
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+        {
+            // this match is non-consuming, for internal use only.
+            switch (tag_) { // result-match
+    15e7:	                   83 f8 01             	cmp    $0x1,%eax
+    15ea:	/----------------- 0f 84 98 00 00 00    	je     1688 <passok31()+0x128>
+    15f0:	|                  83 f8 02             	cmp    $0x2,%eax
+    15f3:	|     /----------- 75 7c                	jne    1671 <passok31()+0x111>
+            : tag_(Tag::OK)
+    15f5:	|     |            c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+            nel::elem::set(data_, f, N);
+    15fb:	|     |            48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    15ff:	|     |            ba 00 01 00 00       	mov    $0x100,%edx
+    1604:	|     |            be 31 00 00 00       	mov    $0x31,%esi
+    1609:	|     |            e8 52 0b 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            switch (tag_) { // result::dtor
+    160e:	|  /--|----------> 8b 84 24 00 01 00 00 	mov    0x100(%rsp),%eax
+    1615:	|  |  |            83 f8 01             	cmp    $0x1,%eax
+    1618:	|  |  |     /----- 74 36                	je     1650 <passok31()+0xf0>
+    161a:	|  |  |     |      83 e0 fd             	and    $0xfffffffd,%eax
+    161d:	|  |  |  /--|----- 74 43                	je     1662 <passok31()+0x102>
+    161f:	|  |  |  |  |      48 8d 05 3f 1a 00 00 	lea    0x1a3f(%rip),%rax        # 3065 <_IO_stdin_used+0x65>
+    1626:	|  |  |  |  |      48 8d 0d 30 1a 00 00 	lea    0x1a30(%rip),%rcx        # 305d <_IO_stdin_used+0x5d>
+            , line_num_(line_num)
+    162d:	|  |  |  |  |      c7 44 24 10 72 00 00 	movl   $0x72,0x10(%rsp)
+    1634:	|  |  |  |  |      00 
+                    nel::panic("bad Result");
+    1635:	|  |  |  |  |      48 89 ee             	mov    %rbp,%rsi
+            : fn_name_(fn_name)
+    1638:	|  |  |  |  |      66 48 0f 6e c1       	movq   %rcx,%xmm0
+    163d:	|  |  |  |  |      66 48 0f 6e d0       	movq   %rax,%xmm2
+    1642:	|  |  |  |  |      66 0f 6c c2          	punpcklqdq %xmm2,%xmm0
+    1646:	|  |  |  |  |      0f 29 04 24          	movaps %xmm0,(%rsp)
+    164a:	|  |  |  |  |  /-- eb 2c                	jmp    1678 <passok31()+0x118>
+    164c:	|  |  |  |  |  |   0f 1f 40 00          	nopl   0x0(%rax)
+            nel::elem::set(data_, 0xa5, N);
+    1650:	|  |  |  |  \--|-> ba 00 01 00 00       	mov    $0x100,%edx
+    1655:	|  |  |  |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    165a:	|  |  |  |     |   4c 89 e7             	mov    %r12,%rdi
+    165d:	|  |  |  |     |   e8 fe 0a 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    1662:	|  |  |  \-----|-> 48 81 c4 10 02 00 00 	add    $0x210,%rsp
+    1669:	|  |  |        |   48 89 d8             	mov    %rbx,%rax
+    166c:	|  |  |        |   5b                   	pop    %rbx
+    166d:	|  |  |        |   5d                   	pop    %rbp
+    166e:	|  |  |        |   41 5c                	pop    %r12
+    1670:	|  |  |        |   c3                   	ret
+                    // if they do it's a use-after-move-from op so must panic.
+                    // or a use-before-initialised so again must panic.
+                    nel::panic("invalid Result", ctx);
+                    break;
+                default:
+                    nel::panic("bad Result", ctx);
+    1671:	|  |  \--------|-> 48 89 ee             	mov    %rbp,%rsi
+            switch (tag_) { // result-match
+    1674:	|  |           |   85 c0                	test   %eax,%eax
+    1676:	|  |        /--|-- 74 37                	je     16af <passok31()+0x14f>
+                    nel::panic("bad Result");
+    1678:	|  |        |  \-> 48 8d 3d d3 19 00 00 	lea    0x19d3(%rip),%rdi        # 3052 <_IO_stdin_used+0x52>
+    167f:	|  |        |      e8 9e fa ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1684:	|  |        |      0f 1f 40 00          	nopl   0x0(%rax)
+            tag_ = o.tag_;
+    1688:	\--|--------|----> c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+            nel::elem::move(data_, o.data_, N);
+    168e:	   |        |      48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    1692:	   |        |      ba 00 01 00 00       	mov    $0x100,%edx
+    1697:	   |        |      4c 89 e6             	mov    %r12,%rsi
+            o.tag_ = Tag::INVAL;
+    169a:	   |        |      c7 84 24 00 01 00 00 	movl   $0x0,0x100(%rsp)
+    16a1:	   |        |      00 00 00 00 
+    16a5:	   |        |      e8 c6 0a 00 00       	call   2170 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+        constexpr Element(Element &&o) = default;
+    16aa:	   \--------|----- e9 5f ff ff ff       	jmp    160e <passok31()+0xae>
+                    nel::panic("invalid Result", ctx);
+    16af:	            \----> 48 8d 3d 8d 19 00 00 	lea    0x198d(%rip),%rdi        # 3043 <_IO_stdin_used+0x43>
+    16b6:	                   e8 67 fa ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    16bb:	                   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000000016c0 <passok32()>:
+{
+    16c0:	                41 54                	push   %r12
+            nel::elem::set(data_, f, N);
+    16c2:	                ba 00 01 00 00       	mov    $0x100,%edx
+    16c7:	                be 22 00 00 00       	mov    $0x22,%esi
+    16cc:	                55                   	push   %rbp
+    16cd:	                53                   	push   %rbx
+    16ce:	                48 89 fb             	mov    %rdi,%rbx
+    16d1:	                48 81 ec 10 02 00 00 	sub    $0x210,%rsp
+    16d8:	                48 89 e5             	mov    %rsp,%rbp
+            nel::elem::move(data_, o.data_, N);
+    16db:	                4c 8d a4 24 08 01 00 	lea    0x108(%rsp),%r12
+    16e2:	                00 
+            nel::elem::set(data_, f, N);
+    16e3:	                48 89 ef             	mov    %rbp,%rdi
+    16e6:	                e8 75 0a 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            nel::elem::move(data_, o.data_, N);
+    16eb:	                ba 00 01 00 00       	mov    $0x100,%edx
+    16f0:	                48 89 ee             	mov    %rbp,%rsi
+    16f3:	                4c 89 e7             	mov    %r12,%rdi
+            : tag_(Tag::OK)
+    16f6:	                c7 84 24 00 01 00 00 	movl   $0x1,0x100(%rsp)
+    16fd:	                01 00 00 00 
+    1701:	                e8 6a 0a 00 00       	call   2170 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1706:	                ba 00 01 00 00       	mov    $0x100,%edx
+    170b:	                be a5 00 00 00       	mov    $0xa5,%esi
+    1710:	                48 89 ef             	mov    %rbp,%rdi
+    1713:	                e8 48 0a 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1718:	                48 8d 05 99 19 00 00 	lea    0x1999(%rip),%rax        # 30b8 <_IO_stdin_used+0xb8>
+    171f:	                48 8d 0d 51 19 00 00 	lea    0x1951(%rip),%rcx        # 3077 <_IO_stdin_used+0x77>
+            , line_num_(line_num)
+    1726:	                c7 44 24 10 41 00 00 	movl   $0x41,0x10(%rsp)
+    172d:	                00 
+            : fn_name_(fn_name)
+    172e:	                66 48 0f 6e c8       	movq   %rax,%xmm1
+    1733:	                66 48 0f 6e c1       	movq   %rcx,%xmm0
+    1738:	                8b 84 24 00 01 00 00 	mov    0x100(%rsp),%eax
+    173f:	                66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    1743:	                0f 29 04 24          	movaps %xmm0,(%rsp)
+            switch (tag_) { // result-match
+    1747:	                83 f8 01             	cmp    $0x1,%eax
+    174a:	         /----- 74 54                	je     17a0 <passok32()+0xe0>
+    174c:	         |      83 f8 02             	cmp    $0x2,%eax
+    174f:	         |  /-- 75 2e                	jne    177f <passok32()+0xbf>
+                    new (&err_) Element<E>(forward<Element<E>>(o.err_));
+    1751:	         |  |   48 8b 84 24 18 01 00 	mov    0x118(%rsp),%rax
+    1758:	         |  |   00 
+            tag_ = o.tag_;
+    1759:	         |  |   c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+                    new (&err_) Element<E>(forward<Element<E>>(o.err_));
+    175f:	         |  |   f3 0f 6f 94 24 08 01 	movdqu 0x108(%rsp),%xmm2
+    1766:	         |  |   00 00 
+    1768:	         |  |   48 89 43 18          	mov    %rax,0x18(%rbx)
+    176c:	         |  |   0f 11 53 08          	movups %xmm2,0x8(%rbx)
+}
+    1770:	      /--|--|-> 48 81 c4 10 02 00 00 	add    $0x210,%rsp
+    1777:	      |  |  |   48 89 d8             	mov    %rbx,%rax
+    177a:	      |  |  |   5b                   	pop    %rbx
+    177b:	      |  |  |   5d                   	pop    %rbp
+    177c:	      |  |  |   41 5c                	pop    %r12
+    177e:	      |  |  |   c3                   	ret
+                    nel::panic("bad Result", ctx);
+    177f:	      |  |  \-> 48 89 ee             	mov    %rbp,%rsi
+            switch (tag_) { // result-match
+    1782:	      |  |      85 c0                	test   %eax,%eax
+    1784:	/-----|--|----- 0f 84 9f 00 00 00    	je     1829 <passok32()+0x169>
+                    nel::panic("bad Result");
+    178a:	|  /--|--|----> 48 8d 3d c1 18 00 00 	lea    0x18c1(%rip),%rdi        # 3052 <_IO_stdin_used+0x52>
+    1791:	|  |  |  |      e8 8c f9 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1796:	|  |  |  |      66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    179d:	|  |  |  |      00 00 00 
+            : tag_(Tag::OK)
+    17a0:	|  |  |  \----> c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+            nel::elem::set(data_, f, N);
+    17a6:	|  |  |         48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    17aa:	|  |  |         ba 00 01 00 00       	mov    $0x100,%edx
+    17af:	|  |  |         be 32 00 00 00       	mov    $0x32,%esi
+    17b4:	|  |  |         e8 a7 09 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            switch (tag_) { // result::dtor
+    17b9:	|  |  |         8b 84 24 00 01 00 00 	mov    0x100(%rsp),%eax
+    17c0:	|  |  |         83 f8 01             	cmp    $0x1,%eax
+    17c3:	|  |  |     /-- 75 2b                	jne    17f0 <passok32()+0x130>
+            nel::elem::set(data_, 0xa5, N);
+    17c5:	|  |  |     |   4c 89 e7             	mov    %r12,%rdi
+    17c8:	|  |  |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    17cd:	|  |  |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    17d2:	|  |  |     |   e8 89 09 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    17d7:	|  |  |     |   48 81 c4 10 02 00 00 	add    $0x210,%rsp
+    17de:	|  |  |     |   48 89 d8             	mov    %rbx,%rax
+    17e1:	|  |  |     |   5b                   	pop    %rbx
+    17e2:	|  |  |     |   5d                   	pop    %rbp
+    17e3:	|  |  |     |   41 5c                	pop    %r12
+    17e5:	|  |  |     |   c3                   	ret
+    17e6:	|  |  |     |   66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    17ed:	|  |  |     |   00 00 00 
+    17f0:	|  |  |     \-> 83 e0 fd             	and    $0xfffffffd,%eax
+    17f3:	|  |  \-------- 0f 84 77 ff ff ff    	je     1770 <passok32()+0xb0>
+    17f9:	|  |            48 8d 05 65 18 00 00 	lea    0x1865(%rip),%rax        # 3065 <_IO_stdin_used+0x65>
+    1800:	|  |            48 8d 0d 56 18 00 00 	lea    0x1856(%rip),%rcx        # 305d <_IO_stdin_used+0x5d>
+            , line_num_(line_num)
+    1807:	|  |            c7 44 24 10 72 00 00 	movl   $0x72,0x10(%rsp)
+    180e:	|  |            00 
+                    nel::panic("bad Result");
+    180f:	|  |            48 89 ee             	mov    %rbp,%rsi
+            : fn_name_(fn_name)
+    1812:	|  |            66 48 0f 6e c1       	movq   %rcx,%xmm0
+    1817:	|  |            66 48 0f 6e d8       	movq   %rax,%xmm3
+    181c:	|  |            66 0f 6c c3          	punpcklqdq %xmm3,%xmm0
+    1820:	|  |            0f 29 04 24          	movaps %xmm0,(%rsp)
+    1824:	|  \----------- e9 61 ff ff ff       	jmp    178a <passok32()+0xca>
+                    nel::panic("invalid Result", ctx);
+    1829:	\-------------> 48 8d 3d 13 18 00 00 	lea    0x1813(%rip),%rdi        # 3043 <_IO_stdin_used+0x43>
+    1830:	                e8 ed f8 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1835:	                66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    183c:	                00 00 00 00 
+
+0000000000001840 <passfail31()>:
+{
+    1840:	       53                   	push   %rbx
+    1841:	       48 8d 05 70 18 00 00 	lea    0x1870(%rip),%rax        # 30b8 <_IO_stdin_used+0xb8>
+    1848:	       48 89 fb             	mov    %rdi,%rbx
+            nel::elem::set(data_, f, N);
+    184b:	       ba 00 01 00 00       	mov    $0x100,%edx
+    1850:	       48 83 c7 08          	add    $0x8,%rdi
+    1854:	       be 41 00 00 00       	mov    $0x41,%esi
+    1859:	       48 81 ec 30 01 00 00 	sub    $0x130,%rsp
+            : tag_(Tag::OK)
+    1860:	       c7 47 f8 01 00 00 00 	movl   $0x1,-0x8(%rdi)
+    1867:	       48 89 44 24 38       	mov    %rax,0x38(%rsp)
+            : tag_(Tag::ERR)
+    186c:	       c7 44 24 20 02 00 00 	movl   $0x2,0x20(%rsp)
+    1873:	       00 
+            : code(code)
+    1874:	       c7 44 24 28 01 00 00 	movl   $0x1,0x28(%rsp)
+    187b:	       00 
+            , lineno(line)
+    187c:	       48 c7 44 24 30 27 00 	movq   $0x27,0x30(%rsp)
+    1883:	       00 00 
+    1885:	       e8 d6 08 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            switch (tag_) { // result::dtor
+    188a:	       8b 44 24 20          	mov    0x20(%rsp),%eax
+    188e:	       83 f8 01             	cmp    $0x1,%eax
+    1891:	   /-- 74 3d                	je     18d0 <passfail31()+0x90>
+    1893:	   |   83 e0 fd             	and    $0xfffffffd,%eax
+    1896:	/--|-- 74 4c                	je     18e4 <passfail31()+0xa4>
+    1898:	|  |   48 8d 05 c6 17 00 00 	lea    0x17c6(%rip),%rax        # 3065 <_IO_stdin_used+0x65>
+    189f:	|  |   48 8d 0d b7 17 00 00 	lea    0x17b7(%rip),%rcx        # 305d <_IO_stdin_used+0x5d>
+                    nel::panic("bad Result");
+    18a6:	|  |   48 89 e6             	mov    %rsp,%rsi
+            , line_num_(line_num)
+    18a9:	|  |   c7 44 24 10 72 00 00 	movl   $0x72,0x10(%rsp)
+    18b0:	|  |   00 
+            : fn_name_(fn_name)
+    18b1:	|  |   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    18b6:	|  |   66 48 0f 6e c8       	movq   %rax,%xmm1
+    18bb:	|  |   48 8d 3d 90 17 00 00 	lea    0x1790(%rip),%rdi        # 3052 <_IO_stdin_used+0x52>
+    18c2:	|  |   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    18c6:	|  |   0f 29 04 24          	movaps %xmm0,(%rsp)
+    18ca:	|  |   e8 53 f8 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    18cf:	|  |   90                   	nop
+            nel::elem::set(data_, 0xa5, N);
+    18d0:	|  \-> 48 8d 7c 24 28       	lea    0x28(%rsp),%rdi
+    18d5:	|      ba 00 01 00 00       	mov    $0x100,%edx
+    18da:	|      be a5 00 00 00       	mov    $0xa5,%esi
+    18df:	|      e8 7c 08 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    18e4:	\----> 48 81 c4 30 01 00 00 	add    $0x130,%rsp
+    18eb:	       48 89 d8             	mov    %rbx,%rax
+    18ee:	       5b                   	pop    %rbx
+    18ef:	       c3                   	ret
+
+00000000000018f0 <passfail32()>:
+                    new (&err_) Element<E>(forward<Element<E>>(o.err_));
+    18f0:	48 8d 15 c1 17 00 00 	lea    0x17c1(%rip),%rdx        # 30b8 <_IO_stdin_used+0xb8>
+            tag_ = o.tag_;
+    18f7:	c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+{
+    18fd:	48 89 f8             	mov    %rdi,%rax
+                    new (&err_) Element<E>(forward<Element<E>>(o.err_));
+    1900:	c7 47 08 01 00 00 00 	movl   $0x1,0x8(%rdi)
+    1907:	48 c7 47 10 27 00 00 	movq   $0x27,0x10(%rdi)
+    190e:	00 
+    190f:	48 89 57 18          	mov    %rdx,0x18(%rdi)
+}
+    1913:	c3                   	ret
+    1914:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    191b:	00 00 00 00 
+    191f:	90                   	nop
+
+0000000000001920 <passok33()>:
+{
+    1920:	                   41 56                	push   %r14
+    1922:	                   48 8d 05 34 17 00 00 	lea    0x1734(%rip),%rax        # 305d <_IO_stdin_used+0x5d>
+            nel::elem::set(data_, f, N);
+    1929:	                   be 22 00 00 00       	mov    $0x22,%esi
+    192e:	                   48 8d 15 4b 17 00 00 	lea    0x174b(%rip),%rdx        # 3080 <_IO_stdin_used+0x80>
+    1935:	                   41 55                	push   %r13
+    1937:	                   66 48 0f 6e c8       	movq   %rax,%xmm1
+    193c:	                   4c 8d 2d 22 17 00 00 	lea    0x1722(%rip),%r13        # 3065 <_IO_stdin_used+0x65>
+    1943:	                   48 8d 05 6e 17 00 00 	lea    0x176e(%rip),%rax        # 30b8 <_IO_stdin_used+0xb8>
+    194a:	                   41 54                	push   %r12
+    194c:	                   66 48 0f 6e e0       	movq   %rax,%xmm4
+    1951:	                   66 49 0f 6e dd       	movq   %r13,%xmm3
+    1956:	                   66 48 0f 6e d2       	movq   %rdx,%xmm2
+    195b:	                   55                   	push   %rbp
+    195c:	                   66 0f 6c cb          	punpcklqdq %xmm3,%xmm1
+    1960:	                   66 0f 6c d4          	punpcklqdq %xmm4,%xmm2
+    1964:	                   ba 00 01 00 00       	mov    $0x100,%edx
+    1969:	                   53                   	push   %rbx
+    196a:	                   48 89 fb             	mov    %rdi,%rbx
+    196d:	                   48 81 ec 60 03 00 00 	sub    $0x360,%rsp
+    1974:	                   48 8d ac 24 50 02 00 	lea    0x250(%rsp),%rbp
+    197b:	                   00 
+            nel::elem::move(data_, o.data_, N);
+    197c:	                   4c 8d a4 24 48 01 00 	lea    0x148(%rsp),%r12
+    1983:	                   00 
+    1984:	                   0f 29 4c 24 10       	movaps %xmm1,0x10(%rsp)
+            nel::elem::set(data_, f, N);
+    1989:	                   48 89 ef             	mov    %rbp,%rdi
+    198c:	                   0f 29 14 24          	movaps %xmm2,(%rsp)
+    1990:	                   e8 cb 07 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            nel::elem::move(data_, o.data_, N);
+    1995:	                   ba 00 01 00 00       	mov    $0x100,%edx
+    199a:	                   48 89 ee             	mov    %rbp,%rsi
+    199d:	                   4c 89 e7             	mov    %r12,%rdi
+            : tag_(Tag::OK)
+    19a0:	                   c7 84 24 40 01 00 00 	movl   $0x1,0x140(%rsp)
+    19a7:	                   01 00 00 00 
+    19ab:	                   e8 c0 07 00 00       	call   2170 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    19b0:	                   ba 00 01 00 00       	mov    $0x100,%edx
+    19b5:	                   be a5 00 00 00       	mov    $0xa5,%esi
+    19ba:	                   48 89 ef             	mov    %rbp,%rdi
+    19bd:	                   e8 9e 07 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            tag_ = o.tag_;
+    19c2:	                   8b 84 24 40 01 00 00 	mov    0x140(%rsp),%eax
+            o.tag_ = Tag::INVAL;
+    19c9:	                   c7 84 24 40 01 00 00 	movl   $0x0,0x140(%rsp)
+    19d0:	                   00 00 00 00 
+            tag_ = o.tag_;
+    19d4:	                   89 84 24 50 02 00 00 	mov    %eax,0x250(%rsp)
+            switch (tag_) { // result::move-ctor
+    19db:	                   83 f8 01             	cmp    $0x1,%eax
+    19de:	         /-------- 0f 84 0c 01 00 00    	je     1af0 <passok33()+0x1d0>
+    19e4:	         |         83 f8 02             	cmp    $0x2,%eax
+    19e7:	         |  /----- 74 5f                	je     1a48 <passok33()+0x128>
+    19e9:	         |  |      85 c0                	test   %eax,%eax
+    19eb:	         |  |  /-- 74 33                	je     1a20 <passok33()+0x100>
+    19ed:	         |  |  |   48 8d 05 62 16 00 00 	lea    0x1662(%rip),%rax        # 3056 <_IO_stdin_used+0x56>
+    19f4:	         |  |  |   66 49 0f 6e fd       	movq   %r13,%xmm7
+                    nel::panic("bad Result");
+    19f9:	         |  |  |   48 8d 74 24 40       	lea    0x40(%rsp),%rsi
+            , line_num_(line_num)
+    19fe:	         |  |  |   c7 44 24 50 92 00 00 	movl   $0x92,0x50(%rsp)
+    1a05:	         |  |  |   00 
+            : fn_name_(fn_name)
+    1a06:	         |  |  |   66 48 0f 6e c0       	movq   %rax,%xmm0
+    1a0b:	         |  |  |   48 8d 3d 40 16 00 00 	lea    0x1640(%rip),%rdi        # 3052 <_IO_stdin_used+0x52>
+    1a12:	         |  |  |   66 0f 6c c7          	punpcklqdq %xmm7,%xmm0
+    1a16:	         |  |  |   0f 29 44 24 40       	movaps %xmm0,0x40(%rsp)
+    1a1b:	         |  |  |   e8 02 f7 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1a20:	         |  |  \-> 66 0f 6f 2c 24       	movdqa (%rsp),%xmm5
+            , line_num_(line_num)
+    1a25:	         |  |      c7 44 24 50 59 00 00 	movl   $0x59,0x50(%rsp)
+    1a2c:	         |  |      00 
+            : fn_name_(fn_name)
+    1a2d:	         |  |      0f 29 6c 24 40       	movaps %xmm5,0x40(%rsp)
+                    nel::panic("invalid Result", ctx);
+    1a32:	   /-----|--|----> 48 8d 74 24 40       	lea    0x40(%rsp),%rsi
+    1a37:	   |     |  |      48 8d 3d 05 16 00 00 	lea    0x1605(%rip),%rdi        # 3043 <_IO_stdin_used+0x43>
+    1a3e:	   |     |  |      e8 df f6 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1a43:	   |     |  |      0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+                    new (&err_) Element<E>(forward<Element<E>>(o.err_));
+    1a48:	   |     |  \----> 48 8b 84 24 58 01 00 	mov    0x158(%rsp),%rax
+    1a4f:	   |     |         00 
+    1a50:	   |     |         f3 0f 6f 84 24 48 01 	movdqu 0x148(%rsp),%xmm0
+    1a57:	   |     |         00 00 
+    1a59:	   |     |         48 89 84 24 68 02 00 	mov    %rax,0x268(%rsp)
+    1a60:	   |     |         00 
+    1a61:	   |     |         0f 11 84 24 58 02 00 	movups %xmm0,0x258(%rsp)
+    1a68:	   |     |         00 
+    1a69:	   |  /--|-------> 48 8b 84 24 68 02 00 	mov    0x268(%rsp),%rax
+    1a70:	   |  |  |         00 
+            tag_ = o.tag_;
+    1a71:	   |  |  |         c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+                    new (&err_) Element<E>(forward<Element<E>>(o.err_));
+    1a77:	   |  |  |         f3 0f 6f b4 24 58 02 	movdqu 0x258(%rsp),%xmm6
+    1a7e:	   |  |  |         00 00 
+    1a80:	   |  |  |         48 89 43 18          	mov    %rax,0x18(%rbx)
+    1a84:	   |  |  |         0f 11 73 08          	movups %xmm6,0x8(%rbx)
+            switch (tag_) { // result::dtor
+    1a88:	/--|--|--|-------> 8b 84 24 40 01 00 00 	mov    0x140(%rsp),%eax
+    1a8f:	|  |  |  |         83 f8 01             	cmp    $0x1,%eax
+    1a92:	|  |  |  |     /-- 74 34                	je     1ac8 <passok33()+0x1a8>
+    1a94:	|  |  |  |     |   83 e0 fd             	and    $0xfffffffd,%eax
+    1a97:	|  |  |  |  /--|-- 74 41                	je     1ada <passok33()+0x1ba>
+    1a99:	|  |  |  |  |  |   66 0f 6f 44 24 10    	movdqa 0x10(%rsp),%xmm0
+                    nel::panic("bad Result");
+    1a9f:	|  |  |  |  |  |   48 89 ee             	mov    %rbp,%rsi
+    1aa2:	|  |  |  |  |  |   48 8d 3d a9 15 00 00 	lea    0x15a9(%rip),%rdi        # 3052 <_IO_stdin_used+0x52>
+            , line_num_(line_num)
+    1aa9:	|  |  |  |  |  |   c7 84 24 60 02 00 00 	movl   $0x72,0x260(%rsp)
+    1ab0:	|  |  |  |  |  |   72 00 00 00 
+            : fn_name_(fn_name)
+    1ab4:	|  |  |  |  |  |   0f 29 84 24 50 02 00 	movaps %xmm0,0x250(%rsp)
+    1abb:	|  |  |  |  |  |   00 
+    1abc:	|  |  |  |  |  |   e8 61 f6 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1ac1:	|  |  |  |  |  |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1ac8:	|  |  |  |  |  \-> ba 00 01 00 00       	mov    $0x100,%edx
+    1acd:	|  |  |  |  |      be a5 00 00 00       	mov    $0xa5,%esi
+    1ad2:	|  |  |  |  |      4c 89 e7             	mov    %r12,%rdi
+    1ad5:	|  |  |  |  |      e8 86 06 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    1ada:	|  |  |  |  \----> 48 81 c4 60 03 00 00 	add    $0x360,%rsp
+    1ae1:	|  |  |  |         48 89 d8             	mov    %rbx,%rax
+    1ae4:	|  |  |  |         5b                   	pop    %rbx
+    1ae5:	|  |  |  |         5d                   	pop    %rbp
+    1ae6:	|  |  |  |         41 5c                	pop    %r12
+    1ae8:	|  |  |  |         41 5d                	pop    %r13
+    1aea:	|  |  |  |         41 5e                	pop    %r14
+    1aec:	|  |  |  |         c3                   	ret
+    1aed:	|  |  |  |         0f 1f 00             	nopl   (%rax)
+            nel::elem::move(data_, o.data_, N);
+    1af0:	|  |  |  \-------> 4c 8d ac 24 58 02 00 	lea    0x258(%rsp),%r13
+    1af7:	|  |  |            00 
+    1af8:	|  |  |            ba 00 01 00 00       	mov    $0x100,%edx
+    1afd:	|  |  |            4c 89 e6             	mov    %r12,%rsi
+    1b00:	|  |  |            4c 89 ef             	mov    %r13,%rdi
+    1b03:	|  |  |            e8 68 06 00 00       	call   2170 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    1b08:	|  |  |            66 0f 6f 3c 24       	movdqa (%rsp),%xmm7
+    1b0d:	|  |  |            8b 84 24 50 02 00 00 	mov    0x250(%rsp),%eax
+            , line_num_(line_num)
+    1b14:	|  |  |            c7 44 24 50 59 00 00 	movl   $0x59,0x50(%rsp)
+    1b1b:	|  |  |            00 
+            : fn_name_(fn_name)
+    1b1c:	|  |  |            0f 29 7c 24 40       	movaps %xmm7,0x40(%rsp)
+            switch (tag_) { // result-match
+    1b21:	|  |  |            83 f8 01             	cmp    $0x1,%eax
+    1b24:	|  |  |     /----- 75 5a                	jne    1b80 <passok33()+0x260>
+    1b26:	|  |  |     |      4c 8d 74 24 40       	lea    0x40(%rsp),%r14
+    1b2b:	|  |  |     |      ba 00 01 00 00       	mov    $0x100,%edx
+    1b30:	|  |  |     |      4c 89 ee             	mov    %r13,%rsi
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+        {
+            // a consuming matcher..
+            // that moves the value to the closures..
+            auto tag = tag_;
+            tag_ = Tag::INVAL;
+    1b33:	|  |  |     |      c7 84 24 50 02 00 00 	movl   $0x0,0x250(%rsp)
+    1b3a:	|  |  |     |      00 00 00 00 
+    1b3e:	|  |  |     |      4c 89 f7             	mov    %r14,%rdi
+    1b41:	|  |  |     |      e8 2a 06 00 00       	call   2170 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            switch (tag_) { // result::dtor
+    1b46:	|  |  |     |      8b 84 24 50 02 00 00 	mov    0x250(%rsp),%eax
+    1b4d:	|  |  |     |      83 f8 01             	cmp    $0x1,%eax
+    1b50:	|  |  |     |  /-- 74 56                	je     1ba8 <passok33()+0x288>
+    1b52:	|  |  |     |  |   83 e0 fd             	and    $0xfffffffd,%eax
+    1b55:	|  |  |  /--|--|-- 74 63                	je     1bba <passok33()+0x29a>
+    1b57:	|  |  |  |  |  |   66 0f 6f 7c 24 10    	movdqa 0x10(%rsp),%xmm7
+                    nel::panic("bad Result");
+    1b5d:	|  |  |  |  |  |   48 8d 74 24 20       	lea    0x20(%rsp),%rsi
+    1b62:	|  |  |  |  |  |   48 8d 3d e9 14 00 00 	lea    0x14e9(%rip),%rdi        # 3052 <_IO_stdin_used+0x52>
+            , line_num_(line_num)
+    1b69:	|  |  |  |  |  |   c7 44 24 30 72 00 00 	movl   $0x72,0x30(%rsp)
+    1b70:	|  |  |  |  |  |   00 
+            : fn_name_(fn_name)
+    1b71:	|  |  |  |  |  |   0f 29 7c 24 20       	movaps %xmm7,0x20(%rsp)
+    1b76:	|  |  |  |  |  |   e8 a7 f5 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1b7b:	|  |  |  |  |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+            switch (tag_) { // result-match
+    1b80:	|  |  |  |  \--|-> 83 f8 02             	cmp    $0x2,%eax
+    1b83:	|  |  \--|-----|-- 0f 84 e0 fe ff ff    	je     1a69 <passok33()+0x149>
+    1b89:	|  |     |     |   85 c0                	test   %eax,%eax
+    1b8b:	|  \-----|-----|-- 0f 84 a1 fe ff ff    	je     1a32 <passok33()+0x112>
+                    nel::panic("bad Result", ctx);
+    1b91:	|        |     |   48 8d 74 24 40       	lea    0x40(%rsp),%rsi
+    1b96:	|        |     |   48 8d 3d b5 14 00 00 	lea    0x14b5(%rip),%rdi        # 3052 <_IO_stdin_used+0x52>
+    1b9d:	|        |     |   e8 80 f5 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1ba2:	|        |     |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+            nel::elem::set(data_, 0xa5, N);
+    1ba8:	|        |     \-> ba 00 01 00 00       	mov    $0x100,%edx
+    1bad:	|        |         be a5 00 00 00       	mov    $0xa5,%esi
+    1bb2:	|        |         4c 89 ef             	mov    %r13,%rdi
+    1bb5:	|        |         e8 a6 05 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1bba:	|        \-------> 4c 89 f7             	mov    %r14,%rdi
+    1bbd:	|                  ba 00 01 00 00       	mov    $0x100,%edx
+    1bc2:	|                  be a5 00 00 00       	mov    $0xa5,%esi
+    1bc7:	|                  e8 94 05 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            : tag_(Tag::OK)
+    1bcc:	|                  c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+            nel::elem::set(data_, f, N);
+    1bd2:	|                  48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    1bd6:	|                  ba 00 01 00 00       	mov    $0x100,%edx
+    1bdb:	|                  be 33 00 00 00       	mov    $0x33,%esi
+    1be0:	|                  e8 7b 05 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1be5:	\----------------- e9 9e fe ff ff       	jmp    1a88 <passok33()+0x168>
+    1bea:	                   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000001bf0 <passfail33()>:
+                    new (&err_) Element<E>(forward<Element<E>>(o.err_));
+    1bf0:	48 8d 15 c1 14 00 00 	lea    0x14c1(%rip),%rdx        # 30b8 <_IO_stdin_used+0xb8>
+            tag_ = o.tag_;
+    1bf7:	c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+{
+    1bfd:	48 89 f8             	mov    %rdi,%rax
+                    new (&err_) Element<E>(forward<Element<E>>(o.err_));
+    1c00:	c7 47 08 01 00 00 00 	movl   $0x1,0x8(%rdi)
+    1c07:	48 c7 47 10 27 00 00 	movq   $0x27,0x10(%rdi)
+    1c0e:	00 
+    1c0f:	48 89 57 18          	mov    %rdx,0x18(%rdi)
+}
+    1c13:	c3                   	ret
+    1c14:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1c1b:	00 00 00 00 
+    1c1f:	90                   	nop
+
+0000000000001c20 <handleok1()>:
+{
+    1c20:	                41 56                	push   %r14
+    1c22:	                ba 00 01 00 00       	mov    $0x100,%edx
+    1c27:	                be 22 00 00 00       	mov    $0x22,%esi
+    1c2c:	                41 55                	push   %r13
+    1c2e:	                41 54                	push   %r12
+    1c30:	                55                   	push   %rbp
+    1c31:	                53                   	push   %rbx
+    1c32:	                48 81 ec 10 02 00 00 	sub    $0x210,%rsp
+    1c39:	                49 89 e5             	mov    %rsp,%r13
+            nel::elem::move(data_, o.data_, N);
+    1c3c:	                4c 8d b4 24 08 01 00 	lea    0x108(%rsp),%r14
+    1c43:	                00 
+            nel::elem::set(data_, f, N);
+    1c44:	                4c 89 ef             	mov    %r13,%rdi
+    1c47:	                e8 14 05 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            nel::elem::move(data_, o.data_, N);
+    1c4c:	                ba 00 01 00 00       	mov    $0x100,%edx
+    1c51:	                4c 89 ee             	mov    %r13,%rsi
+    1c54:	                4c 89 f7             	mov    %r14,%rdi
+            : tag_(Tag::OK)
+    1c57:	                c7 84 24 00 01 00 00 	movl   $0x1,0x100(%rsp)
+    1c5e:	                01 00 00 00 
+    1c62:	                e8 09 05 00 00       	call   2170 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1c67:	                ba 00 01 00 00       	mov    $0x100,%edx
+    1c6c:	                be a5 00 00 00       	mov    $0xa5,%esi
+    1c71:	                4c 89 ef             	mov    %r13,%rdi
+    1c74:	                e8 e7 04 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1c79:	                48 8d 05 38 14 00 00 	lea    0x1438(%rip),%rax        # 30b8 <_IO_stdin_used+0xb8>
+    1c80:	                48 8d 0d 02 14 00 00 	lea    0x1402(%rip),%rcx        # 3089 <_IO_stdin_used+0x89>
+            , line_num_(line_num)
+    1c87:	                c7 44 24 10 67 00 00 	movl   $0x67,0x10(%rsp)
+    1c8e:	                00 
+            : fn_name_(fn_name)
+    1c8f:	                66 48 0f 6e c8       	movq   %rax,%xmm1
+    1c94:	                66 48 0f 6e c1       	movq   %rcx,%xmm0
+    1c99:	                8b 84 24 00 01 00 00 	mov    0x100(%rsp),%eax
+    1ca0:	                66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    1ca4:	                0f 29 04 24          	movaps %xmm0,(%rsp)
+            switch (tag_) { // result-match
+    1ca8:	                83 f8 01             	cmp    $0x1,%eax
+    1cab:	         /----- 74 33                	je     1ce0 <handleok1()+0xc0>
+    1cad:	         |      83 f8 02             	cmp    $0x2,%eax
+    1cb0:	         |  /-- 75 10                	jne    1cc2 <handleok1()+0xa2>
+}
+    1cb2:	      /--|--|-> 48 81 c4 10 02 00 00 	add    $0x210,%rsp
+    1cb9:	      |  |  |   5b                   	pop    %rbx
+    1cba:	      |  |  |   5d                   	pop    %rbp
+    1cbb:	      |  |  |   41 5c                	pop    %r12
+    1cbd:	      |  |  |   41 5d                	pop    %r13
+    1cbf:	      |  |  |   41 5e                	pop    %r14
+    1cc1:	      |  |  |   c3                   	ret
+                    nel::panic("bad Result", ctx);
+    1cc2:	      |  |  \-> 4c 89 ee             	mov    %r13,%rsi
+            switch (tag_) { // result-match
+    1cc5:	      |  |      85 c0                	test   %eax,%eax
+    1cc7:	/-----|--|----- 0f 84 38 01 00 00    	je     1e05 <handleok1()+0x1e5>
+                    nel::panic("bad Result");
+    1ccd:	|  /--|--|----> 48 8d 3d 7e 13 00 00 	lea    0x137e(%rip),%rdi        # 3052 <_IO_stdin_used+0x52>
+    1cd4:	|  |  |  |      e8 49 f4 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1cd9:	|  |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            nel::elem::move(data_, o.data_, N);
+    1ce0:	|  |  |  \----> ba 00 01 00 00       	mov    $0x100,%edx
+    1ce5:	|  |  |         4c 89 f6             	mov    %r14,%rsi
+    1ce8:	|  |  |         48 8d 5c 24 01       	lea    0x1(%rsp),%rbx
+    1ced:	|  |  |         4c 89 ef             	mov    %r13,%rdi
+            nel::elem::set(data_, f, N);
+        }
+
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+        {
+            outs << "U8Buf<" << val.len() << ">{";
+    1cf0:	|  |  |         48 8d 2d 92 33 00 00 	lea    0x3392(%rip),%rbp        # 5089 <nel::log>
+    1cf7:	|  |  |         4c 8d a4 24 00 01 00 	lea    0x100(%rsp),%r12
+    1cfe:	|  |  |         00 
+            tag_ = Tag::INVAL;
+    1cff:	|  |  |         c7 84 24 00 01 00 00 	movl   $0x0,0x100(%rsp)
+    1d06:	|  |  |         00 00 00 00 
+            nel::elem::move(data_, o.data_, N);
+    1d0a:	|  |  |         e8 61 04 00 00       	call   2170 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            outs << "U8Buf<" << val.len() << ">{";
+    1d0f:	|  |  |         48 8d 35 7d 13 00 00 	lea    0x137d(%rip),%rsi        # 3093 <_IO_stdin_used+0x93>
+    1d16:	|  |  |         48 89 ef             	mov    %rbp,%rdi
+    1d19:	|  |  |         e8 d2 0c 00 00       	call   29f0 <nel::operator<<(nel::Log&, char const*)>
+    1d1e:	|  |  |         be 00 01 00 00       	mov    $0x100,%esi
+    1d23:	|  |  |         48 89 c7             	mov    %rax,%rdi
+    1d26:	|  |  |         e8 85 0d 00 00       	call   2ab0 <nel::operator<<(nel::Log&, unsigned long)>
+    1d2b:	|  |  |         48 8d 35 68 13 00 00 	lea    0x1368(%rip),%rsi        # 309a <_IO_stdin_used+0x9a>
+    1d32:	|  |  |         48 89 c7             	mov    %rax,%rdi
+    1d35:	|  |  |         e8 b6 0c 00 00       	call   29f0 <nel::operator<<(nel::Log&, char const*)>
+            if (val.len() > 0) {
+                outs << val.data_[0];
+    1d3a:	|  |  |         0f b6 34 24          	movzbl (%rsp),%esi
+    1d3e:	|  |  |         48 89 ef             	mov    %rbp,%rdi
+    1d41:	|  |  |         e8 ca 0c 00 00       	call   2a10 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1d46:	|  |  |         66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1d4d:	|  |  |         00 00 00 
+                    outs << ' ' << val.data_[i];
+    1d50:	|  |  |     /-> be 20 00 00 00       	mov    $0x20,%esi
+    1d55:	|  |  |     |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1d58:	|  |  |     |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    1d5c:	|  |  |     |   e8 6f 0c 00 00       	call   29d0 <nel::operator<<(nel::Log&, char)>
+    1d61:	|  |  |     |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1d65:	|  |  |     |   48 89 c7             	mov    %rax,%rdi
+    1d68:	|  |  |     |   e8 a3 0c 00 00       	call   2a10 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1d6d:	|  |  |     |   49 39 dc             	cmp    %rbx,%r12
+    1d70:	|  |  |     \-- 75 de                	jne    1d50 <handleok1()+0x130>
+                }
+            }
+            outs << '}';
+    1d72:	|  |  |         be 7d 00 00 00       	mov    $0x7d,%esi
+    1d77:	|  |  |         48 89 ef             	mov    %rbp,%rdi
+    1d7a:	|  |  |         e8 51 0c 00 00       	call   29d0 <nel::operator<<(nel::Log&, char)>
+        nel::log << v << '\n';
+    1d7f:	|  |  |         be 0a 00 00 00       	mov    $0xa,%esi
+    1d84:	|  |  |         48 89 ef             	mov    %rbp,%rdi
+    1d87:	|  |  |         e8 44 0c 00 00       	call   29d0 <nel::operator<<(nel::Log&, char)>
+            nel::elem::set(data_, 0xa5, N);
+    1d8c:	|  |  |         ba 00 01 00 00       	mov    $0x100,%edx
+    1d91:	|  |  |         be a5 00 00 00       	mov    $0xa5,%esi
+    1d96:	|  |  |         4c 89 ef             	mov    %r13,%rdi
+    1d99:	|  |  |         e8 c2 03 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            switch (tag_) { // result::dtor
+    1d9e:	|  |  |         8b 84 24 00 01 00 00 	mov    0x100(%rsp),%eax
+    1da5:	|  |  |         83 f8 01             	cmp    $0x1,%eax
+    1da8:	|  |  |     /-- 75 22                	jne    1dcc <handleok1()+0x1ac>
+    1daa:	|  |  |     |   4c 89 f7             	mov    %r14,%rdi
+    1dad:	|  |  |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    1db2:	|  |  |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    1db7:	|  |  |     |   e8 a4 03 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    1dbc:	|  |  |     |   48 81 c4 10 02 00 00 	add    $0x210,%rsp
+    1dc3:	|  |  |     |   5b                   	pop    %rbx
+    1dc4:	|  |  |     |   5d                   	pop    %rbp
+    1dc5:	|  |  |     |   41 5c                	pop    %r12
+    1dc7:	|  |  |     |   41 5d                	pop    %r13
+    1dc9:	|  |  |     |   41 5e                	pop    %r14
+    1dcb:	|  |  |     |   c3                   	ret
+    1dcc:	|  |  |     \-> 83 e0 fd             	and    $0xfffffffd,%eax
+    1dcf:	|  |  \-------- 0f 84 dd fe ff ff    	je     1cb2 <handleok1()+0x92>
+    1dd5:	|  |            48 8d 05 89 12 00 00 	lea    0x1289(%rip),%rax        # 3065 <_IO_stdin_used+0x65>
+    1ddc:	|  |            48 8d 0d 7a 12 00 00 	lea    0x127a(%rip),%rcx        # 305d <_IO_stdin_used+0x5d>
+            , line_num_(line_num)
+    1de3:	|  |            c7 44 24 10 72 00 00 	movl   $0x72,0x10(%rsp)
+    1dea:	|  |            00 
+                    nel::panic("bad Result");
+    1deb:	|  |            4c 89 ee             	mov    %r13,%rsi
+            : fn_name_(fn_name)
+    1dee:	|  |            66 48 0f 6e c1       	movq   %rcx,%xmm0
+    1df3:	|  |            66 48 0f 6e d0       	movq   %rax,%xmm2
+    1df8:	|  |            66 0f 6c c2          	punpcklqdq %xmm2,%xmm0
+    1dfc:	|  |            0f 29 04 24          	movaps %xmm0,(%rsp)
+    1e00:	|  \----------- e9 c8 fe ff ff       	jmp    1ccd <handleok1()+0xad>
+                    nel::panic("invalid Result", ctx);
+    1e05:	\-------------> 48 8d 3d 37 12 00 00 	lea    0x1237(%rip),%rdi        # 3043 <_IO_stdin_used+0x43>
+    1e0c:	                e8 11 f3 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1e11:	                66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1e18:	                00 00 00 00 
+    1e1c:	                0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001e20 <handleok2()>:
+{
+    1e20:	                   41 57                	push   %r15
+            nel::elem::set(data_, f, N);
+    1e22:	                   ba 00 01 00 00       	mov    $0x100,%edx
+    1e27:	                   be 22 00 00 00       	mov    $0x22,%esi
+    1e2c:	                   41 56                	push   %r14
+    1e2e:	                   41 55                	push   %r13
+    1e30:	                   41 54                	push   %r12
+    1e32:	                   55                   	push   %rbp
+    1e33:	                   53                   	push   %rbx
+    1e34:	                   48 81 ec 18 02 00 00 	sub    $0x218,%rsp
+    1e3b:	                   48 89 e3             	mov    %rsp,%rbx
+            nel::elem::move(data_, o.data_, N);
+    1e3e:	                   48 8d ac 24 08 01 00 	lea    0x108(%rsp),%rbp
+    1e45:	                   00 
+            nel::elem::set(data_, f, N);
+    1e46:	                   48 89 df             	mov    %rbx,%rdi
+    1e49:	                   e8 12 03 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            nel::elem::move(data_, o.data_, N);
+    1e4e:	                   ba 00 01 00 00       	mov    $0x100,%edx
+    1e53:	                   48 89 de             	mov    %rbx,%rsi
+    1e56:	                   48 89 ef             	mov    %rbp,%rdi
+            : tag_(Tag::OK)
+    1e59:	                   c7 84 24 00 01 00 00 	movl   $0x1,0x100(%rsp)
+    1e60:	                   01 00 00 00 
+    1e64:	                   e8 07 03 00 00       	call   2170 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1e69:	                   ba 00 01 00 00       	mov    $0x100,%edx
+    1e6e:	                   be a5 00 00 00       	mov    $0xa5,%esi
+    1e73:	                   48 89 df             	mov    %rbx,%rdi
+    1e76:	                   e8 e5 02 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1e7b:	                   48 8d 05 36 12 00 00 	lea    0x1236(%rip),%rax        # 30b8 <_IO_stdin_used+0xb8>
+    1e82:	                   48 8d 0d 14 12 00 00 	lea    0x1214(%rip),%rcx        # 309d <_IO_stdin_used+0x9d>
+            , line_num_(line_num)
+    1e89:	                   c7 44 24 10 70 00 00 	movl   $0x70,0x10(%rsp)
+    1e90:	                   00 
+            : fn_name_(fn_name)
+    1e91:	                   66 48 0f 6e c8       	movq   %rax,%xmm1
+    1e96:	                   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    1e9b:	                   8b 84 24 00 01 00 00 	mov    0x100(%rsp),%eax
+    1ea2:	                   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    1ea6:	                   0f 29 04 24          	movaps %xmm0,(%rsp)
+            switch (tag_) { // result-match
+    1eaa:	                   83 f8 01             	cmp    $0x1,%eax
+    1ead:	/----------------- 0f 84 35 01 00 00    	je     1fe8 <handleok2()+0x1c8>
+    1eb3:	|                  83 f8 02             	cmp    $0x2,%eax
+    1eb6:	|  /-------------- 0f 85 14 01 00 00    	jne    1fd0 <handleok2()+0x1b0>
+
+    public:
+        // friend std::ostream &operator<<(std::ostream &outs, Error const &val) {
+        friend nel::Log &operator<<(nel::Log &outs, Error const &val)
+        {
+            outs << "Error(" << static_cast<int>(val.code) << "=" << val.code << ")";
+    1ebc:	|  |               4c 8d 25 c6 31 00 00 	lea    0x31c6(%rip),%r12        # 5089 <nel::log>
+         * this is consumed by the operation.
+         */
+        constexpr E unwrap_err(Context const &ctx = Context())
+        {
+            return consume<E>([&](T &&) -> E { nel::panic("not an err", ctx); },
+                              [](E &&err) -> E { return err; },
+    1ec3:	|  |               44 8b bc 24 08 01 00 	mov    0x108(%rsp),%r15d
+    1eca:	|  |               00 
+    1ecb:	|  |               48 8d 35 d5 11 00 00 	lea    0x11d5(%rip),%rsi        # 30a7 <_IO_stdin_used+0xa7>
+            tag_ = Tag::INVAL;
+    1ed2:	|  |               c7 84 24 00 01 00 00 	movl   $0x0,0x100(%rsp)
+    1ed9:	|  |               00 00 00 00 
+    1edd:	|  |               4c 89 e7             	mov    %r12,%rdi
+                              [](E &&err) -> E { return err; },
+    1ee0:	|  |               4c 8b ac 24 10 01 00 	mov    0x110(%rsp),%r13
+    1ee7:	|  |               00 
+    1ee8:	|  |               4c 8b b4 24 18 01 00 	mov    0x118(%rsp),%r14
+    1eef:	|  |               00 
+    1ef0:	|  |               e8 fb 0a 00 00       	call   29f0 <nel::operator<<(nel::Log&, char const*)>
+    1ef5:	|  |               44 89 fe             	mov    %r15d,%esi
+    1ef8:	|  |               48 89 c7             	mov    %rax,%rdi
+    1efb:	|  |               e8 90 0b 00 00       	call   2a90 <nel::operator<<(nel::Log&, int)>
+    1f00:	|  |               48 8d 35 a7 11 00 00 	lea    0x11a7(%rip),%rsi        # 30ae <_IO_stdin_used+0xae>
+    1f07:	|  |               48 89 c7             	mov    %rax,%rdi
+    1f0a:	|  |               e8 e1 0a 00 00       	call   29f0 <nel::operator<<(nel::Log&, char const*)>
+    1f0f:	|  |               48 89 c7             	mov    %rax,%rdi
+    switch (val) {
+    1f12:	|  |               41 83 ff 01          	cmp    $0x1,%r15d
+    1f16:	|  |  /----------- 0f 85 e0 00 00 00    	jne    1ffc <handleok2()+0x1dc>
+            return outs << "Failed";
+    1f1c:	|  |  |            48 8d 35 10 11 00 00 	lea    0x1110(%rip),%rsi        # 3033 <_IO_stdin_used+0x33>
+    1f23:	|  |  |            e8 c8 0a 00 00       	call   29f0 <nel::operator<<(nel::Log&, char const*)>
+            outs << "Error(" << static_cast<int>(val.code) << "=" << val.code << ")";
+    1f28:	|  |  |            48 8d 35 81 11 00 00 	lea    0x1181(%rip),%rsi        # 30b0 <_IO_stdin_used+0xb0>
+            return outs << "Failed";
+    1f2f:	|  |  |            48 89 c7             	mov    %rax,%rdi
+            outs << "Error(" << static_cast<int>(val.code) << "=" << val.code << ")";
+    1f32:	|  |  |            e8 b9 0a 00 00       	call   29f0 <nel::operator<<(nel::Log&, char const*)>
+            outs << "@" << val.filename << ":" << val.lineno;
+    1f37:	|  |  |            48 8d 35 74 11 00 00 	lea    0x1174(%rip),%rsi        # 30b2 <_IO_stdin_used+0xb2>
+    1f3e:	|  |  |            4c 89 e7             	mov    %r12,%rdi
+    1f41:	|  |  |            e8 aa 0a 00 00       	call   29f0 <nel::operator<<(nel::Log&, char const*)>
+    1f46:	|  |  |            4c 89 f6             	mov    %r14,%rsi
+    1f49:	|  |  |            48 89 c7             	mov    %rax,%rdi
+    1f4c:	|  |  |            e8 9f 0a 00 00       	call   29f0 <nel::operator<<(nel::Log&, char const*)>
+    1f51:	|  |  |            48 8d 35 5c 11 00 00 	lea    0x115c(%rip),%rsi        # 30b4 <_IO_stdin_used+0xb4>
+    1f58:	|  |  |            48 89 c7             	mov    %rax,%rdi
+    1f5b:	|  |  |            e8 90 0a 00 00       	call   29f0 <nel::operator<<(nel::Log&, char const*)>
+    1f60:	|  |  |            4c 89 ee             	mov    %r13,%rsi
+    1f63:	|  |  |            48 89 c7             	mov    %rax,%rdi
+    1f66:	|  |  |            e8 45 0b 00 00       	call   2ab0 <nel::operator<<(nel::Log&, unsigned long)>
+        nel::log << v << '\n';
+    1f6b:	|  |  |            be 0a 00 00 00       	mov    $0xa,%esi
+    1f70:	|  |  |            4c 89 e7             	mov    %r12,%rdi
+    1f73:	|  |  |            e8 58 0a 00 00       	call   29d0 <nel::operator<<(nel::Log&, char)>
+            switch (tag_) { // result::dtor
+    1f78:	|  |  |            8b 84 24 00 01 00 00 	mov    0x100(%rsp),%eax
+    1f7f:	|  |  |            83 f8 02             	cmp    $0x2,%eax
+    1f82:	|  |  |  /-------- 74 06                	je     1f8a <handleok2()+0x16a>
+    1f84:	|  |  |  |  /----- 7f 1b                	jg     1fa1 <handleok2()+0x181>
+    1f86:	|  |  |  |  |      85 c0                	test   %eax,%eax
+    1f88:	|  |  |  |  |  /-- 75 12                	jne    1f9c <handleok2()+0x17c>
+}
+    1f8a:	|  |  |  >--|--|-> 48 81 c4 18 02 00 00 	add    $0x218,%rsp
+    1f91:	|  |  |  |  |  |   5b                   	pop    %rbx
+    1f92:	|  |  |  |  |  |   5d                   	pop    %rbp
+    1f93:	|  |  |  |  |  |   41 5c                	pop    %r12
+    1f95:	|  |  |  |  |  |   41 5d                	pop    %r13
+    1f97:	|  |  |  |  |  |   41 5e                	pop    %r14
+    1f99:	|  |  |  |  |  |   41 5f                	pop    %r15
+    1f9b:	|  |  |  |  |  |   c3                   	ret
+    1f9c:	|  |  |  |  |  \-> 83 f8 01             	cmp    $0x1,%eax
+    1f9f:	+--|--|--|--|----- 74 47                	je     1fe8 <handleok2()+0x1c8>
+    1fa1:	|  |  |  |  \----> 48 8d 05 bd 10 00 00 	lea    0x10bd(%rip),%rax        # 3065 <_IO_stdin_used+0x65>
+    1fa8:	|  |  |  |         48 8d 0d ae 10 00 00 	lea    0x10ae(%rip),%rcx        # 305d <_IO_stdin_used+0x5d>
+            , line_num_(line_num)
+    1faf:	|  |  |  |         c7 44 24 10 72 00 00 	movl   $0x72,0x10(%rsp)
+    1fb6:	|  |  |  |         00 
+                    nel::panic("bad Result");
+    1fb7:	|  |  |  |         48 89 de             	mov    %rbx,%rsi
+            : fn_name_(fn_name)
+    1fba:	|  |  |  |         66 48 0f 6e c1       	movq   %rcx,%xmm0
+    1fbf:	|  |  |  |         66 48 0f 6e d0       	movq   %rax,%xmm2
+    1fc4:	|  |  |  |         66 0f 6c c2          	punpcklqdq %xmm2,%xmm0
+    1fc8:	|  |  |  |         0f 29 04 24          	movaps %xmm0,(%rsp)
+    1fcc:	|  |  |  |     /-- eb 09                	jmp    1fd7 <handleok2()+0x1b7>
+    1fce:	|  |  |  |     |   66 90                	xchg   %ax,%ax
+                    nel::panic("bad Result", ctx);
+    1fd0:	|  \--|--|-----|-> 48 89 de             	mov    %rbx,%rsi
+            switch (tag_) { // result-match
+    1fd3:	|     |  |     |   85 c0                	test   %eax,%eax
+    1fd5:	|     |  |  /--|-- 74 2a                	je     2001 <handleok2()+0x1e1>
+                    nel::panic("bad Result");
+    1fd7:	|     |  |  |  \-> 48 8d 3d 74 10 00 00 	lea    0x1074(%rip),%rdi        # 3052 <_IO_stdin_used+0x52>
+    1fde:	|     |  |  |      e8 3f f1 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1fe3:	|     |  |  |      0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    1fe8:	\-----|--|--|----> ba 00 01 00 00       	mov    $0x100,%edx
+    1fed:	      |  |  |      be a5 00 00 00       	mov    $0xa5,%esi
+    1ff2:	      |  |  |      48 89 ef             	mov    %rbp,%rdi
+    1ff5:	      |  |  |      e8 66 01 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        constexpr ~Element(void) = default;
+    1ffa:	      |  \--|----- eb 8e                	jmp    1f8a <handleok2()+0x16a>
+    1ffc:	      \-----|----> e8 9f f2 ff ff       	call   12a0 <operator<<(nel::Log&, ErrorCode const&) [clone .part.0]>
+                    nel::panic("invalid Result", ctx);
+    2001:	            \----> 48 8d 3d 3b 10 00 00 	lea    0x103b(%rip),%rdi        # 3043 <_IO_stdin_used+0x43>
+    2008:	                   e8 15 f1 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    200d:	                   0f 1f 00             	nopl   (%rax)
+
+0000000000002010 <handlefail1()>:
+}
+    2010:	c3                   	ret
+    2011:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2018:	00 00 00 00 
+    201c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002020 <handlefail2()>:
+{
+    2020:	       55                   	push   %rbp
+            outs << "Error(" << static_cast<int>(val.code) << "=" << val.code << ")";
+    2021:	       48 8d 35 7f 10 00 00 	lea    0x107f(%rip),%rsi        # 30a7 <_IO_stdin_used+0xa7>
+            , filename(filename)
+    2028:	       48 8d 2d 89 10 00 00 	lea    0x1089(%rip),%rbp        # 30b8 <_IO_stdin_used+0xb8>
+    202f:	       53                   	push   %rbx
+            outs << "Error(" << static_cast<int>(val.code) << "=" << val.code << ")";
+    2030:	       48 8d 1d 52 30 00 00 	lea    0x3052(%rip),%rbx        # 5089 <nel::log>
+    2037:	       48 89 df             	mov    %rbx,%rdi
+    203a:	       48 81 ec 38 01 00 00 	sub    $0x138,%rsp
+            : code(code)
+    2041:	       c7 44 24 28 01 00 00 	movl   $0x1,0x28(%rsp)
+    2048:	       00 
+            , lineno(line)
+    2049:	       48 c7 44 24 30 27 00 	movq   $0x27,0x30(%rsp)
+    2050:	       00 00 
+            , filename(filename)
+    2052:	       48 89 6c 24 38       	mov    %rbp,0x38(%rsp)
+            tag_ = Tag::INVAL;
+    2057:	       c7 44 24 20 00 00 00 	movl   $0x0,0x20(%rsp)
+    205e:	       00 
+            outs << "Error(" << static_cast<int>(val.code) << "=" << val.code << ")";
+    205f:	       e8 8c 09 00 00       	call   29f0 <nel::operator<<(nel::Log&, char const*)>
+    2064:	       be 01 00 00 00       	mov    $0x1,%esi
+    2069:	       48 89 c7             	mov    %rax,%rdi
+    206c:	       e8 1f 0a 00 00       	call   2a90 <nel::operator<<(nel::Log&, int)>
+    2071:	       48 8d 35 36 10 00 00 	lea    0x1036(%rip),%rsi        # 30ae <_IO_stdin_used+0xae>
+    2078:	       48 89 c7             	mov    %rax,%rdi
+    207b:	       e8 70 09 00 00       	call   29f0 <nel::operator<<(nel::Log&, char const*)>
+            return outs << "Failed";
+    2080:	       48 8d 35 ac 0f 00 00 	lea    0xfac(%rip),%rsi        # 3033 <_IO_stdin_used+0x33>
+            outs << "Error(" << static_cast<int>(val.code) << "=" << val.code << ")";
+    2087:	       48 89 c7             	mov    %rax,%rdi
+            return outs << "Failed";
+    208a:	       e8 61 09 00 00       	call   29f0 <nel::operator<<(nel::Log&, char const*)>
+            outs << "Error(" << static_cast<int>(val.code) << "=" << val.code << ")";
+    208f:	       48 8d 35 1a 10 00 00 	lea    0x101a(%rip),%rsi        # 30b0 <_IO_stdin_used+0xb0>
+            return outs << "Failed";
+    2096:	       48 89 c7             	mov    %rax,%rdi
+            outs << "Error(" << static_cast<int>(val.code) << "=" << val.code << ")";
+    2099:	       e8 52 09 00 00       	call   29f0 <nel::operator<<(nel::Log&, char const*)>
+            outs << "@" << val.filename << ":" << val.lineno;
+    209e:	       48 8d 35 0d 10 00 00 	lea    0x100d(%rip),%rsi        # 30b2 <_IO_stdin_used+0xb2>
+    20a5:	       48 89 df             	mov    %rbx,%rdi
+    20a8:	       e8 43 09 00 00       	call   29f0 <nel::operator<<(nel::Log&, char const*)>
+    20ad:	       48 89 ee             	mov    %rbp,%rsi
+    20b0:	       48 89 c7             	mov    %rax,%rdi
+    20b3:	       e8 38 09 00 00       	call   29f0 <nel::operator<<(nel::Log&, char const*)>
+    20b8:	       48 8d 35 f5 0f 00 00 	lea    0xff5(%rip),%rsi        # 30b4 <_IO_stdin_used+0xb4>
+    20bf:	       48 89 c7             	mov    %rax,%rdi
+    20c2:	       e8 29 09 00 00       	call   29f0 <nel::operator<<(nel::Log&, char const*)>
+    20c7:	       be 27 00 00 00       	mov    $0x27,%esi
+    20cc:	       48 89 c7             	mov    %rax,%rdi
+    20cf:	       e8 dc 09 00 00       	call   2ab0 <nel::operator<<(nel::Log&, unsigned long)>
+        nel::log << v << '\n';
+    20d4:	       be 0a 00 00 00       	mov    $0xa,%esi
+    20d9:	       48 89 df             	mov    %rbx,%rdi
+    20dc:	       e8 ef 08 00 00       	call   29d0 <nel::operator<<(nel::Log&, char)>
+            switch (tag_) { // result::dtor
+    20e1:	       8b 44 24 20          	mov    0x20(%rsp),%eax
+    20e5:	       83 f8 01             	cmp    $0x1,%eax
+    20e8:	   /-- 74 46                	je     2130 <handlefail2()+0x110>
+    20ea:	   |   83 e0 fd             	and    $0xfffffffd,%eax
+    20ed:	/--|-- 74 55                	je     2144 <handlefail2()+0x124>
+    20ef:	|  |   48 8d 05 6f 0f 00 00 	lea    0xf6f(%rip),%rax        # 3065 <_IO_stdin_used+0x65>
+    20f6:	|  |   48 8d 0d 60 0f 00 00 	lea    0xf60(%rip),%rcx        # 305d <_IO_stdin_used+0x5d>
+                    nel::panic("bad Result");
+    20fd:	|  |   48 89 e6             	mov    %rsp,%rsi
+            , line_num_(line_num)
+    2100:	|  |   c7 44 24 10 72 00 00 	movl   $0x72,0x10(%rsp)
+    2107:	|  |   00 
+            : fn_name_(fn_name)
+    2108:	|  |   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    210d:	|  |   66 48 0f 6e c8       	movq   %rax,%xmm1
+    2112:	|  |   48 8d 3d 39 0f 00 00 	lea    0xf39(%rip),%rdi        # 3052 <_IO_stdin_used+0x52>
+    2119:	|  |   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    211d:	|  |   0f 29 04 24          	movaps %xmm0,(%rsp)
+    2121:	|  |   e8 fc ef ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    2126:	|  |   66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    212d:	|  |   00 00 00 
+    2130:	|  \-> 48 8d 7c 24 28       	lea    0x28(%rsp),%rdi
+    2135:	|      ba 00 01 00 00       	mov    $0x100,%edx
+    213a:	|      be a5 00 00 00       	mov    $0xa5,%esi
+    213f:	|      e8 1c 00 00 00       	call   2160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    2144:	\----> 48 81 c4 38 01 00 00 	add    $0x138,%rsp
+    214b:	       5b                   	pop    %rbx
+    214c:	       5d                   	pop    %rbp
+    214d:	       c3                   	ret
+    214e:	       66 90                	xchg   %ax,%ax
+
+0000000000002150 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    2150:	e9 4b ef ff ff       	jmp    10a0 <memcpy@plt>
+    2155:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    215c:	00 00 00 00 
+
+0000000000002160 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    2160:	40 0f b6 f6          	movzbl %sil,%esi
+    2164:	e9 f7 ee ff ff       	jmp    1060 <memset@plt>
+    2169:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002170 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+}
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    2170:	e9 2b ef ff ff       	jmp    10a0 <memcpy@plt>
+    2175:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    217c:	00 00 00 00 
+
+0000000000002180 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    2180:	e9 4b ef ff ff       	jmp    10d0 <memmove@plt>
+    2185:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    218c:	00 00 00 00 
+
+0000000000002190 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    2190:	48 89 f2             	mov    %rsi,%rdx
+    std::memset(d, s, n);
+    2193:	be a5 00 00 00       	mov    $0xa5,%esi
+    2198:	e9 c3 ee ff ff       	jmp    1060 <memset@plt>
+    219d:	0f 1f 00             	nopl   (%rax)
+
+00000000000021a0 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+    set(d, 0xa5, n);
+}
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    21a0:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    21a4:	e8 d7 ee ff ff       	call   1080 <memcmp@plt>
+    21a9:	85 c0                	test   %eax,%eax
+    21ab:	0f 94 c0             	sete   %al
+}
+    21ae:	48 83 c4 08          	add    $0x8,%rsp
+    21b2:	c3                   	ret
+    21b3:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    21ba:	00 00 00 00 
+    21be:	66 90                	xchg   %ax,%ax
+
+00000000000021c0 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    21c0:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    21c4:	e8 b7 ee ff ff       	call   1080 <memcmp@plt>
+    21c9:	85 c0                	test   %eax,%eax
+    21cb:	0f 95 c0             	setne  %al
+}
+    21ce:	48 83 c4 08          	add    $0x8,%rsp
+    21d2:	c3                   	ret
+    21d3:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    21da:	00 00 00 00 
+    21de:	66 90                	xchg   %ax,%ax
+
+00000000000021e0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    if (n < streaming_min) {
+    21e0:	                48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    21e7:	/-------------- 0f 86 d7 00 00 00    	jbe    22c4 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xe4>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    21ed:	|               48 89 f9             	mov    %rdi,%rcx
+{
+    21f0:	|               53                   	push   %rbx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    21f1:	|               48 f7 d9             	neg    %rcx
+    21f4:	|               83 e1 0f             	and    $0xf,%ecx
+    std::memcpy(d, s, n);
+    21f7:	|               83 f9 08             	cmp    $0x8,%ecx
+    21fa:	|     /-------- 0f 82 d0 00 00 00    	jb     22d0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xf0>
+    2200:	|     |         48 8b 06             	mov    (%rsi),%rax
+    2203:	|     |         4c 8d 57 08          	lea    0x8(%rdi),%r10
+    2207:	|     |         48 89 f3             	mov    %rsi,%rbx
+    220a:	|     |         49 83 e2 f8          	and    $0xfffffffffffffff8,%r10
+    220e:	|     |         48 89 07             	mov    %rax,(%rdi)
+    2211:	|     |         48 8b 44 0e f8       	mov    -0x8(%rsi,%rcx,1),%rax
+    2216:	|     |         48 89 44 0f f8       	mov    %rax,-0x8(%rdi,%rcx,1)
+    221b:	|     |         48 89 f8             	mov    %rdi,%rax
+    221e:	|     |         4c 29 d0             	sub    %r10,%rax
+    2221:	|     |         48 29 c3             	sub    %rax,%rbx
+    2224:	|     |         01 c8                	add    %ecx,%eax
+    2226:	|     |         83 e0 f8             	and    $0xfffffff8,%eax
+    2229:	|     |         83 f8 08             	cmp    $0x8,%eax
+    222c:	|  /--|-------- 72 1a                	jb     2248 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    222e:	|  |  |         83 e0 f8             	and    $0xfffffff8,%eax
+    2231:	|  |  |         45 31 c0             	xor    %r8d,%r8d
+    2234:	|  |  |     /-> 45 89 c1             	mov    %r8d,%r9d
+    2237:	|  |  |     |   41 83 c0 08          	add    $0x8,%r8d
+    223b:	|  |  |     |   4e 8b 1c 0b          	mov    (%rbx,%r9,1),%r11
+    223f:	|  |  |     |   4f 89 1c 0a          	mov    %r11,(%r10,%r9,1)
+    2243:	|  |  |     |   41 39 c0             	cmp    %eax,%r8d
+    2246:	|  |  |     \-- 72 ec                	jb     2234 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x54>
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    2248:	|  >--|-------> 48 8d 41 40          	lea    0x40(%rcx),%rax
+    224c:	|  |  |         48 01 f9             	add    %rdi,%rcx
+    224f:	|  |  |         90                   	nop
+    std::memcpy(&v, s, sizeof(v));
+    2250:	|  |  |     /-> f3 0f 6f 54 06 d0    	movdqu -0x30(%rsi,%rax,1),%xmm2
+    2256:	|  |  |     |   f3 0f 6f 4c 06 e0    	movdqu -0x20(%rsi,%rax,1),%xmm1
+    225c:	|  |  |     |   49 89 c0             	mov    %rax,%r8
+    for (; i + 64 <= n; i += 64) {
+    225f:	|  |  |     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    2263:	|  |  |     |   f3 0f 6f 44 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2269:	|  |  |     |   f3 0f 6f 5c 06 c0    	movdqu -0x40(%rsi,%rax,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    226f:	|  |  |     |   48 83 c0 40          	add    $0x40,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2273:	|  |  |     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    2278:	|  |  |     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    227d:	|  |  |     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    2282:	|  |  |     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    2287:	|  |  |     |   48 39 c2             	cmp    %rax,%rdx
+    228a:	|  |  |     \-- 73 c4                	jae    2250 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x70>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    228c:	|  |  |         49 8d 40 10          	lea    0x10(%r8),%rax
+    2290:	|  |  |         48 39 c2             	cmp    %rax,%rdx
+    2293:	|  |  |  /----- 72 22                	jb     22b7 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd7>
+    2295:	|  |  |  |      48 8d 4f f0          	lea    -0x10(%rdi),%rcx
+    2299:	|  |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    22a0:	|  |  |  |  /-> f3 0f 6f 64 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm4
+    22a6:	|  |  |  |  |   49 89 c0             	mov    %rax,%r8
+    22a9:	|  |  |  |  |   66 0f e7 24 01       	movntdq %xmm4,(%rcx,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    22ae:	|  |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    22b2:	|  |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    22b5:	|  |  |  |  \-- 73 e9                	jae    22a0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc0>
+        stream16(d + i, load16(s + i));
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    22b7:	|  |  |  \----> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    22ba:	|  |  |         4c 01 c7             	add    %r8,%rdi
+    22bd:	|  |  |         4c 29 c2             	sub    %r8,%rdx
+    22c0:	|  |  |         4c 01 c6             	add    %r8,%rsi
+}
+    22c3:	|  |  |         5b                   	pop    %rbx
+    std::memcpy(d, s, n);
+    22c4:	\--|--|-------> e9 d7 ed ff ff       	jmp    10a0 <memcpy@plt>
+    22c9:	   |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    22d0:	   |  \-------> f6 c1 04             	test   $0x4,%cl
+    22d3:	   |        /-- 75 25                	jne    22fa <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x11a>
+    22d5:	   |        |   85 c9                	test   %ecx,%ecx
+    22d7:	   +--------|-- 0f 84 6b ff ff ff    	je     2248 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    22dd:	   |        |   0f b6 06             	movzbl (%rsi),%eax
+    22e0:	   |        |   88 07                	mov    %al,(%rdi)
+    22e2:	   |        |   f6 c1 02             	test   $0x2,%cl
+    22e5:	   +--------|-- 0f 84 5d ff ff ff    	je     2248 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    22eb:	   |        |   0f b7 44 0e fe       	movzwl -0x2(%rsi,%rcx,1),%eax
+    22f0:	   |        |   66 89 44 0f fe       	mov    %ax,-0x2(%rdi,%rcx,1)
+    22f5:	   +--------|-- e9 4e ff ff ff       	jmp    2248 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    22fa:	   |        \-> 8b 06                	mov    (%rsi),%eax
+    22fc:	   |            89 07                	mov    %eax,(%rdi)
+    22fe:	   |            8b 44 0e fc          	mov    -0x4(%rsi,%rcx,1),%eax
+    2302:	   |            89 44 0f fc          	mov    %eax,-0x4(%rdi,%rcx,1)
+    2306:	   \----------- e9 3d ff ff ff       	jmp    2248 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    230b:	                0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000002310 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    2310:	                                           49 89 f8             	mov    %rdi,%r8
+    2313:	                                           48 89 f1             	mov    %rsi,%rcx
+    if (n < streaming_min) {
+    2316:	                                           48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    231d:	                              /----------- 0f 86 85 03 00 00    	jbe    26a8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x398>
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2323:	                              |            48 89 fe             	mov    %rdi,%rsi
+{
+    2326:	                              |            41 57                	push   %r15
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2328:	                              |            48 f7 de             	neg    %rsi
+{
+    232b:	                              |            41 56                	push   %r14
+    for (Index i = 0; i < head; ++i) {
+    232d:	                              |            48 89 f0             	mov    %rsi,%rax
+{
+    2330:	                              |            41 55                	push   %r13
+    2332:	                              |            41 54                	push   %r12
+    2334:	                              |            55                   	push   %rbp
+    2335:	                              |            53                   	push   %rbx
+    for (Index i = 0; i < head; ++i) {
+    2336:	                              |            83 e0 0f             	and    $0xf,%eax
+    2339:	/-----------------------------|----------- 0f 84 01 01 00 00    	je     2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    233f:	|                             |            48 8d 78 ff          	lea    -0x1(%rax),%rdi
+    2343:	|                             |            48 83 ff 02          	cmp    $0x2,%rdi
+    2347:	|  /--------------------------|----------- 0f 86 8a 04 00 00    	jbe    27d7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4c7>
+    234d:	|  |                          |            4c 8d 51 01          	lea    0x1(%rcx),%r10
+    2351:	|  |                          |            4d 89 c1             	mov    %r8,%r9
+    2354:	|  |                          |            4d 29 d1             	sub    %r10,%r9
+    2357:	|  |                          |            49 83 f9 06          	cmp    $0x6,%r9
+    235b:	|  |                          |  /-------- 0f 87 c7 02 00 00    	ja     2628 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x318>
+        d[i] = p[i];
+    2361:	|  |                          |  |         0f b6 39             	movzbl (%rcx),%edi
+    2364:	|  |                          |  |         41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2367:	|  |                          |  |         40 f6 c6 0e          	test   $0xe,%sil
+    236b:	+--|--------------------------|--|-------- 0f 84 cf 00 00 00    	je     2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2371:	|  |                          |  |         0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    2375:	|  |                          |  |         41 88 78 01          	mov    %dil,0x1(%r8)
+    2379:	|  |  /-----------------------|--|-------> 0f b6 79 02          	movzbl 0x2(%rcx),%edi
+    237d:	|  |  |                       |  |         41 88 78 02          	mov    %dil,0x2(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2381:	|  |  |                       |  |         40 f6 c6 0c          	test   $0xc,%sil
+    2385:	+--|--|-----------------------|--|-------- 0f 84 b5 00 00 00    	je     2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    238b:	|  |  |                       |  |         0f b6 79 03          	movzbl 0x3(%rcx),%edi
+    238f:	|  |  |                       |  |         41 88 78 03          	mov    %dil,0x3(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2393:	|  |  |                       |  |         48 83 f8 04          	cmp    $0x4,%rax
+    2397:	+--|--|-----------------------|--|-------- 0f 86 a3 00 00 00    	jbe    2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    239d:	|  |  |                       |  |         0f b6 79 04          	movzbl 0x4(%rcx),%edi
+    23a1:	|  |  |                       |  |         41 88 78 04          	mov    %dil,0x4(%r8)
+    for (Index i = 0; i < head; ++i) {
+    23a5:	|  |  |                       |  |         48 83 f8 05          	cmp    $0x5,%rax
+    23a9:	+--|--|-----------------------|--|-------- 0f 84 91 00 00 00    	je     2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    23af:	|  |  |                       |  |         0f b6 79 05          	movzbl 0x5(%rcx),%edi
+    23b3:	|  |  |                       |  |         41 88 78 05          	mov    %dil,0x5(%r8)
+    for (Index i = 0; i < head; ++i) {
+    23b7:	|  |  |                       |  |         48 83 f8 06          	cmp    $0x6,%rax
+    23bb:	+--|--|-----------------------|--|-------- 0f 84 7f 00 00 00    	je     2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    23c1:	|  |  |                       |  |         0f b6 79 06          	movzbl 0x6(%rcx),%edi
+    for (Index i = 0; i < head; ++i) {
+    23c5:	|  |  |                       |  |         83 e6 08             	and    $0x8,%esi
+        d[i] = p[i];
+    23c8:	|  |  |                       |  |         41 88 78 06          	mov    %dil,0x6(%r8)
+    for (Index i = 0; i < head; ++i) {
+    23cc:	+--|--|-----------------------|--|-------- 74 72                	je     2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    23ce:	|  |  |                       |  |         0f b6 71 07          	movzbl 0x7(%rcx),%esi
+    23d2:	|  |  |                       |  |         41 88 70 07          	mov    %sil,0x7(%r8)
+    for (Index i = 0; i < head; ++i) {
+    23d6:	|  |  |                       |  |         48 83 f8 08          	cmp    $0x8,%rax
+    23da:	+--|--|-----------------------|--|-------- 76 64                	jbe    2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    23dc:	|  |  |                       |  |         0f b6 71 08          	movzbl 0x8(%rcx),%esi
+    23e0:	|  |  |                       |  |         41 88 70 08          	mov    %sil,0x8(%r8)
+    for (Index i = 0; i < head; ++i) {
+    23e4:	|  |  |                       |  |         48 83 f8 09          	cmp    $0x9,%rax
+    23e8:	+--|--|-----------------------|--|-------- 74 56                	je     2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    23ea:	|  |  |                       |  |         0f b6 71 09          	movzbl 0x9(%rcx),%esi
+    23ee:	|  |  |                       |  |         41 88 70 09          	mov    %sil,0x9(%r8)
+    for (Index i = 0; i < head; ++i) {
+    23f2:	|  |  |                       |  |         48 83 f8 0a          	cmp    $0xa,%rax
+    23f6:	+--|--|-----------------------|--|-------- 74 48                	je     2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    23f8:	|  |  |                       |  |         0f b6 71 0a          	movzbl 0xa(%rcx),%esi
+    23fc:	|  |  |                       |  |         41 88 70 0a          	mov    %sil,0xa(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2400:	|  |  |                       |  |         48 83 f8 0b          	cmp    $0xb,%rax
+    2404:	+--|--|-----------------------|--|-------- 74 3a                	je     2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2406:	|  |  |                       |  |         0f b6 71 0b          	movzbl 0xb(%rcx),%esi
+    240a:	|  |  |                       |  |         41 88 70 0b          	mov    %sil,0xb(%r8)
+    for (Index i = 0; i < head; ++i) {
+    240e:	|  |  |                       |  |         48 83 f8 0c          	cmp    $0xc,%rax
+    2412:	+--|--|-----------------------|--|-------- 74 2c                	je     2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2414:	|  |  |                       |  |         0f b6 71 0c          	movzbl 0xc(%rcx),%esi
+    2418:	|  |  |                       |  |         41 88 70 0c          	mov    %sil,0xc(%r8)
+    for (Index i = 0; i < head; ++i) {
+    241c:	|  |  |                       |  |         48 83 f8 0d          	cmp    $0xd,%rax
+    2420:	+--|--|-----------------------|--|-------- 74 1e                	je     2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2422:	|  |  |                       |  |         0f b6 71 0d          	movzbl 0xd(%rcx),%esi
+    2426:	|  |  |                       |  |         41 88 70 0d          	mov    %sil,0xd(%r8)
+    for (Index i = 0; i < head; ++i) {
+    242a:	|  |  |                       |  |         49 8d 70 ff          	lea    -0x1(%r8),%rsi
+    242e:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    2431:	+--|--|-----------------------|--|-------- 75 0d                	jne    2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2433:	|  |  |                       |  |         0f b6 71 0e          	movzbl 0xe(%rcx),%esi
+    2437:	|  |  |                       |  |         41 88 70 0e          	mov    %sil,0xe(%r8)
+    for (Index i = 0; i < head; ++i) {
+    243b:	|  |  |                       |  |         0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+        rotated[i] = p[(head + i) % 16];
+    2440:	>--|--|-----------------------|--|-------> 48 8d 70 07          	lea    0x7(%rax),%rsi
+    2444:	|  |  |                       |  |         4c 8d 78 06          	lea    0x6(%rax),%r15
+    2448:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    244b:	|  |  |                       |  |         4c 8d 70 05          	lea    0x5(%rax),%r14
+    244f:	|  |  |                       |  |         4c 8d 68 04          	lea    0x4(%rax),%r13
+    2453:	|  |  |                       |  |         41 83 e7 0f          	and    $0xf,%r15d
+    std::memcpy(&v, s, sizeof(v));
+    2457:	|  |  |                       |  |         0f b6 34 31          	movzbl (%rcx,%rsi,1),%esi
+        rotated[i] = p[(head + i) % 16];
+    245b:	|  |  |                       |  |         41 83 e6 0f          	and    $0xf,%r14d
+    245f:	|  |  |                       |  |         41 83 e5 0f          	and    $0xf,%r13d
+    2463:	|  |  |                       |  |         4c 8d 60 03          	lea    0x3(%rax),%r12
+    std::memcpy(&v, s, sizeof(v));
+    2467:	|  |  |                       |  |         46 0f b6 3c 39       	movzbl (%rcx,%r15,1),%r15d
+    246c:	|  |  |                       |  |         46 0f b6 34 31       	movzbl (%rcx,%r14,1),%r14d
+        rotated[i] = p[(head + i) % 16];
+    2471:	|  |  |                       |  |         48 8d 78 08          	lea    0x8(%rax),%rdi
+    2475:	|  |  |                       |  |         41 83 e4 0f          	and    $0xf,%r12d
+    std::memcpy(&v, s, sizeof(v));
+    2479:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    247d:	|  |  |                       |  |         46 0f b6 2c 29       	movzbl (%rcx,%r13,1),%r13d
+        rotated[i] = p[(head + i) % 16];
+    2482:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    2485:	|  |  |                       |  |         48 8d 68 02          	lea    0x2(%rax),%rbp
+    std::memcpy(&v, s, sizeof(v));
+    2489:	|  |  |                       |  |         4c 09 fe             	or     %r15,%rsi
+        rotated[i] = p[(head + i) % 16];
+    248c:	|  |  |                       |  |         48 89 7c 24 c8       	mov    %rdi,-0x38(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    2491:	|  |  |                       |  |         46 0f b6 24 21       	movzbl (%rcx,%r12,1),%r12d
+        rotated[i] = p[(head + i) % 16];
+    2496:	|  |  |                       |  |         83 e5 0f             	and    $0xf,%ebp
+    std::memcpy(&v, s, sizeof(v));
+    2499:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    249d:	|  |  |                       |  |         48 8d 78 09          	lea    0x9(%rax),%rdi
+    std::memcpy(&v, s, sizeof(v));
+    24a1:	|  |  |                       |  |         0f b6 2c 29          	movzbl (%rcx,%rbp,1),%ebp
+        rotated[i] = p[(head + i) % 16];
+    24a5:	|  |  |                       |  |         48 8d 58 01          	lea    0x1(%rax),%rbx
+    std::memcpy(&v, s, sizeof(v));
+    24a9:	|  |  |                       |  |         4c 09 f6             	or     %r14,%rsi
+        rotated[i] = p[(head + i) % 16];
+    24ac:	|  |  |                       |  |         49 89 fb             	mov    %rdi,%r11
+    24af:	|  |  |                       |  |         48 8d 78 0a          	lea    0xa(%rax),%rdi
+    24b3:	|  |  |                       |  |         83 e3 0f             	and    $0xf,%ebx
+    std::memcpy(&v, s, sizeof(v));
+    24b6:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    24ba:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    24be:	|  |  |                       |  |         49 89 fa             	mov    %rdi,%r10
+    std::memcpy(&v, s, sizeof(v));
+    24c1:	|  |  |                       |  |         4c 09 ee             	or     %r13,%rsi
+        rotated[i] = p[(head + i) % 16];
+    24c4:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    24c8:	|  |  |                       |  |         48 8d 78 0b          	lea    0xb(%rax),%rdi
+    24cc:	|  |  |                       |  |         4c 89 5c 24 e0       	mov    %r11,-0x20(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    24d1:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    24d5:	|  |  |                       |  |         4c 8d 58 0f          	lea    0xf(%rax),%r11
+    24d9:	|  |  |                       |  |         4c 89 54 24 e8       	mov    %r10,-0x18(%rsp)
+    24de:	|  |  |                       |  |         49 89 f9             	mov    %rdi,%r9
+    std::memcpy(&v, s, sizeof(v));
+    24e1:	|  |  |                       |  |         4c 09 e6             	or     %r12,%rsi
+        rotated[i] = p[(head + i) % 16];
+    24e4:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    24e8:	|  |  |                       |  |         4c 8d 50 0e          	lea    0xe(%rax),%r10
+    24ec:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    24f0:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    24f4:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    24f8:	|  |  |                       |  |         4c 89 4c 24 f0       	mov    %r9,-0x10(%rsp)
+    24fd:	|  |  |                       |  |         4c 8d 48 0d          	lea    0xd(%rax),%r9
+    std::memcpy(&v, s, sizeof(v));
+    2501:	|  |  |                       |  |         48 09 ee             	or     %rbp,%rsi
+    2504:	|  |  |                       |  |         0f b6 2c 19          	movzbl (%rcx,%rbx,1),%ebp
+    2508:	|  |  |                       |  |         46 0f b6 14 11       	movzbl (%rcx,%r10,1),%r10d
+        rotated[i] = p[(head + i) % 16];
+    250d:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    2511:	|  |  |                       |  |         48 89 f3             	mov    %rsi,%rbx
+    2514:	|  |  |                       |  |         42 0f b6 34 19       	movzbl (%rcx,%r11,1),%esi
+    2519:	|  |  |                       |  |         46 0f b6 0c 09       	movzbl (%rcx,%r9,1),%r9d
+        rotated[i] = p[(head + i) % 16];
+    251e:	|  |  |                       |  |         48 8d 78 0c          	lea    0xc(%rax),%rdi
+    2522:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    std::memcpy(&v, s, sizeof(v));
+    2525:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    2529:	|  |  |                       |  |         4c 8b 5c 24 e0       	mov    -0x20(%rsp),%r11
+    252e:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2532:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    2535:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    2539:	|  |  |                       |  |         0f b6 2c 01          	movzbl (%rcx,%rax,1),%ebp
+    253d:	|  |  |                       |  |         4c 09 d6             	or     %r10,%rsi
+    2540:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    2544:	|  |  |                       |  |         4c 8b 54 24 e8       	mov    -0x18(%rsp),%r10
+    2549:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    254d:	|  |  |                       |  |         4c 09 ce             	or     %r9,%rsi
+    2550:	|  |  |                       |  |         4c 8b 4c 24 f0       	mov    -0x10(%rsp),%r9
+    2555:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2559:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    255c:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    255f:	|  |  |                       |  |         42 0f b6 3c 09       	movzbl (%rcx,%r9,1),%edi
+    2564:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2568:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    256b:	|  |  |                       |  |         42 0f b6 3c 11       	movzbl (%rcx,%r10,1),%edi
+    2570:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2574:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    2577:	|  |  |                       |  |         42 0f b6 3c 19       	movzbl (%rcx,%r11,1),%edi
+    257c:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2580:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    2583:	|  |  |                       |  |         48 8b 7c 24 c8       	mov    -0x38(%rsp),%rdi
+    2588:	|  |  |                       |  |         48 89 5c 24 c8       	mov    %rbx,-0x38(%rsp)
+    258d:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2591:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    2595:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    2598:	|  |  |                       |  |         48 8d 78 40          	lea    0x40(%rax),%rdi
+    259c:	|  |  |                       |  |         4c 01 c0             	add    %r8,%rax
+    std::memcpy(&v, s, sizeof(v));
+    259f:	|  |  |                       |  |         48 89 74 24 d0       	mov    %rsi,-0x30(%rsp)
+    25a4:	|  |  |                       |  |         66 0f 6f 44 24 c8    	movdqa -0x38(%rsp),%xmm0
+    for (; i + 64 <= n; i += 64) {
+    25aa:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    25b0:	|  |  |                       |  |     /-> 48 89 fe             	mov    %rdi,%rsi
+    for (; i + 64 <= n; i += 64) {
+    25b3:	|  |  |                       |  |     |   48 83 c7 40          	add    $0x40,%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    25b7:	|  |  |                       |  |     |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    25bb:	|  |  |                       |  |     |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    25c0:	|  |  |                       |  |     |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    25c5:	|  |  |                       |  |     |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    25ca:	|  |  |                       |  |     |   48 83 c0 40          	add    $0x40,%rax
+    25ce:	|  |  |                       |  |     |   48 39 fa             	cmp    %rdi,%rdx
+    25d1:	|  |  |                       |  |     \-- 73 dd                	jae    25b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2a0>
+        stream16(d + i, v);
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+    25d3:	|  |  |                       |  |         48 8d 46 10          	lea    0x10(%rsi),%rax
+    25d7:	|  |  |                       |  |         48 39 c2             	cmp    %rax,%rdx
+    25da:	|  |  |                       |  |  /----- 72 15                	jb     25f1 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2e1>
+    25dc:	|  |  |                       |  |  |      49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    25e0:	|  |  |                       |  |  |  /-> 48 89 c6             	mov    %rax,%rsi
+    25e3:	|  |  |                       |  |  |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    25e8:	|  |  |                       |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    25ec:	|  |  |                       |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    25ef:	|  |  |                       |  |  |  \-- 73 ef                	jae    25e0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2d0>
+        stream16(d + i, v);
+    }
+    __builtin_ia32_sfence();
+    25f1:	|  |  |                       |  |  \----> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    25f4:	|  |  |                       |  |         48 39 d6             	cmp    %rdx,%rsi
+    25f7:	|  |  |                       |  |  /----- 73 1e                	jae    2617 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x307>
+    25f9:	|  |  |                       |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        d[i] = p[i % 16];
+    2600:	|  |  |                       |  |  |  /-> 48 89 f0             	mov    %rsi,%rax
+    2603:	|  |  |                       |  |  |  |   83 e0 0f             	and    $0xf,%eax
+    2606:	|  |  |                       |  |  |  |   0f b6 04 01          	movzbl (%rcx,%rax,1),%eax
+    260a:	|  |  |                       |  |  |  |   41 88 04 30          	mov    %al,(%r8,%rsi,1)
+    for (; i < n; ++i) {
+    260e:	|  |  |                       |  |  |  |   48 83 c6 01          	add    $0x1,%rsi
+    2612:	|  |  |                       |  |  |  |   48 39 f2             	cmp    %rsi,%rdx
+    2615:	|  |  |                       |  |  |  \-- 75 e9                	jne    2600 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2f0>
+    }
+}
+    2617:	|  |  |                       |  |  \----> 5b                   	pop    %rbx
+    2618:	|  |  |                       |  |         5d                   	pop    %rbp
+    2619:	|  |  |                       |  |         41 5c                	pop    %r12
+    261b:	|  |  |                       |  |         41 5d                	pop    %r13
+    261d:	|  |  |                       |  |         41 5e                	pop    %r14
+    261f:	|  |  |                       |  |         41 5f                	pop    %r15
+    2621:	|  |  |                       |  |         c3                   	ret
+    2622:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    2628:	|  |  |                       |  \-------> 48 83 ff 06          	cmp    $0x6,%rdi
+    262c:	|  |  |  /--------------------|----------- 0f 86 e1 01 00 00    	jbe    2813 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x503>
+        d[i] = p[i];
+    2632:	|  |  |  |                    |            48 8b 31             	mov    (%rcx),%rsi
+    2635:	|  |  |  |                    |            49 89 30             	mov    %rsi,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2638:	|  |  |  |                    |            48 83 f8 08          	cmp    $0x8,%rax
+    263c:	+--|--|--|--------------------|----------- 0f 84 fe fd ff ff    	je     2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    2642:	|  |  |  |                    |            48 8d 70 f7          	lea    -0x9(%rax),%rsi
+    2646:	|  |  |  |                    |            4c 8d 48 f8          	lea    -0x8(%rax),%r9
+    264a:	|  |  |  |                    |            48 83 fe 02          	cmp    $0x2,%rsi
+    264e:	|  |  |  |                    |            be 08 00 00 00       	mov    $0x8,%esi
+    2653:	|  |  |  |                    |        /-- 76 15                	jbe    266a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x35a>
+        d[i] = p[i];
+    2655:	|  |  |  |  /-----------------|--------|-> 8b 3c 31             	mov    (%rcx,%rsi,1),%edi
+    2658:	|  |  |  |  |                 |        |   41 89 3c 30          	mov    %edi,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    265c:	|  |  |  |  |                 |        |   48 83 c6 04          	add    $0x4,%rsi
+    2660:	|  |  |  |  |                 |        |   49 83 f9 04          	cmp    $0x4,%r9
+    2664:	+--|--|--|--|-----------------|--------|-- 0f 84 d6 fd ff ff    	je     2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    266a:	|  |  |  |  |                 |        \-> 0f b6 3c 31          	movzbl (%rcx,%rsi,1),%edi
+    266e:	|  |  |  |  |                 |            41 88 3c 30          	mov    %dil,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    2672:	|  |  |  |  |                 |            48 8d 7e 01          	lea    0x1(%rsi),%rdi
+    2676:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    2679:	+--|--|--|--|-----------------|----------- 0f 83 c1 fd ff ff    	jae    2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    267f:	|  |  |  |  |                 |            0f b6 7c 31 01       	movzbl 0x1(%rcx,%rsi,1),%edi
+    2684:	|  |  |  |  |                 |            41 88 7c 30 01       	mov    %dil,0x1(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    2689:	|  |  |  |  |                 |            48 8d 7e 02          	lea    0x2(%rsi),%rdi
+    268d:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    2690:	+--|--|--|--|-----------------|----------- 0f 83 aa fd ff ff    	jae    2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2696:	|  |  |  |  |                 |            0f b6 7c 31 02       	movzbl 0x2(%rcx,%rsi,1),%edi
+    269b:	|  |  |  |  |                 |            41 88 7c 30 02       	mov    %dil,0x2(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    26a0:	+--|--|--|--|-----------------|----------- e9 9b fd ff ff       	jmp    2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    26a5:	|  |  |  |  |                 |            0f 1f 00             	nopl   (%rax)
+    Length done = (n < 16) ? n : 16;
+    26a8:	|  |  |  |  |                 \----------> 41 ba 10 00 00 00    	mov    $0x10,%r10d
+    26ae:	|  |  |  |  |                              4c 39 d2             	cmp    %r10,%rdx
+    26b1:	|  |  |  |  |                              4c 0f 46 d2          	cmovbe %rdx,%r10
+    std::memcpy(d, s, n);
+    26b5:	|  |  |  |  |                              44 89 d0             	mov    %r10d,%eax
+    26b8:	|  |  |  |  |                              41 83 fa 08          	cmp    $0x8,%r10d
+    26bc:	|  |  |  |  |        /-------------------- 0f 82 cc 00 00 00    	jb     278e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47e>
+    26c2:	|  |  |  |  |        |                     48 8b 06             	mov    (%rsi),%rax
+    26c5:	|  |  |  |  |        |                     4c 8d 4f 08          	lea    0x8(%rdi),%r9
+    26c9:	|  |  |  |  |        |                     49 83 e1 f8          	and    $0xfffffffffffffff8,%r9
+    26cd:	|  |  |  |  |        |                     48 89 07             	mov    %rax,(%rdi)
+    26d0:	|  |  |  |  |        |                     44 89 d0             	mov    %r10d,%eax
+    26d3:	|  |  |  |  |        |                     48 8b 74 06 f8       	mov    -0x8(%rsi,%rax,1),%rsi
+    26d8:	|  |  |  |  |        |                     48 89 74 07 f8       	mov    %rsi,-0x8(%rdi,%rax,1)
+    26dd:	|  |  |  |  |        |                     48 89 f8             	mov    %rdi,%rax
+    26e0:	|  |  |  |  |        |                     4c 29 c8             	sub    %r9,%rax
+    26e3:	|  |  |  |  |        |                     48 29 c1             	sub    %rax,%rcx
+    26e6:	|  |  |  |  |        |                     44 01 d0             	add    %r10d,%eax
+    26e9:	|  |  |  |  |        |                     83 e0 f8             	and    $0xfffffff8,%eax
+    26ec:	|  |  |  |  |        |                     83 f8 08             	cmp    $0x8,%eax
+    26ef:	|  |  |  |  |  /-----|-------------------- 72 16                	jb     2707 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    26f1:	|  |  |  |  |  |     |                     83 e0 f8             	and    $0xfffffff8,%eax
+    26f4:	|  |  |  |  |  |     |                     31 f6                	xor    %esi,%esi
+    26f6:	|  |  |  |  |  |     |                 /-> 89 f7                	mov    %esi,%edi
+    26f8:	|  |  |  |  |  |     |                 |   83 c6 08             	add    $0x8,%esi
+    26fb:	|  |  |  |  |  |     |                 |   4c 8b 1c 39          	mov    (%rcx,%rdi,1),%r11
+    26ff:	|  |  |  |  |  |     |                 |   4d 89 1c 39          	mov    %r11,(%r9,%rdi,1)
+    2703:	|  |  |  |  |  |     |                 |   39 c6                	cmp    %eax,%esi
+    2705:	|  |  |  |  |  |     |                 \-- 72 ef                	jb     26f6 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3e6>
+    while (done < n) {
+    2707:	|  |  |  |  |  >-----|-------------------> 49 39 d2             	cmp    %rdx,%r10
+    270a:	|  |  |  |  |  |     |           /-------- 72 33                	jb     273f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    270c:	|  |  |  |  |  |     |     /-----|-------- e9 af 00 00 00       	jmp    27c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b0>
+    2711:	|  |  |  |  |  |     |     |     |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    std::memcpy(d, s, n);
+    2718:	|  |  |  |  |  |     |     |     |     /-> 41 f6 c1 04          	test   $0x4,%r9b
+    271c:	|  |  |  |  |  |     |     |  /--|-----|-- 0f 85 9f 00 00 00    	jne    27c1 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b1>
+    2722:	|  |  |  |  |  |     |     |  |  |     |   45 85 c9             	test   %r9d,%r9d
+    2725:	|  |  |  |  |  |  /--|-----|--|--|-----|-- 74 10                	je     2737 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    2727:	|  |  |  |  |  |  |  |     |  |  |     |   41 0f b6 08          	movzbl (%r8),%ecx
+    272b:	|  |  |  |  |  |  |  |     |  |  |     |   88 08                	mov    %cl,(%rax)
+    272d:	|  |  |  |  |  |  |  |     |  |  |     |   41 f6 c1 02          	test   $0x2,%r9b
+    2731:	|  |  |  |  |  |  |  |  /--|--|--|-----|-- 0f 85 c9 00 00 00    	jne    2800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4f0>
+        done += m;
+    2737:	|  |  |  |  |  |  >--|--|--|--|--|-----|-> 4d 01 ca             	add    %r9,%r10
+    while (done < n) {
+    273a:	|  |  |  |  |  |  |  |  |  |  |  |     |   49 39 d2             	cmp    %rdx,%r10
+    273d:	|  |  |  |  |  |  |  |  |  |  |  |  /--|-- 73 4e                	jae    278d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47d>
+        Length const m = (done < n - done) ? done : n - done;
+    273f:	|  |  |  |  |  |  |  |  |  |  |  >--|--|-> 49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    2742:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4b 8d 04 10          	lea    (%r8,%r10,1),%rax
+        Length const m = (done < n - done) ? done : n - done;
+    2746:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 29 d1             	sub    %r10,%r9
+    2749:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 39 d1             	cmp    %r10,%r9
+    274c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 0f 47 ca          	cmova  %r10,%r9
+    std::memcpy(d, s, n);
+    2750:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   41 83 f9 08          	cmp    $0x8,%r9d
+    2754:	|  |  |  |  |  |  |  |  |  |  |  |  |  \-- 72 c2                	jb     2718 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x408>
+    2756:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 08             	mov    (%r8),%rcx
+    2759:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 78 08          	lea    0x8(%rax),%rdi
+        done += m;
+    275d:	|  |  |  |  |  |  |  |  |  |  |  |  |      4d 01 ca             	add    %r9,%r10
+    std::memcpy(d, s, n);
+    2760:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 83 e7 f8          	and    $0xfffffffffffffff8,%rdi
+    2764:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 08             	mov    %rcx,(%rax)
+    2767:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 89 c9             	mov    %r9d,%ecx
+    276a:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 74 08 f8       	mov    -0x8(%r8,%rcx,1),%rsi
+    276f:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 74 08 f8       	mov    %rsi,-0x8(%rax,%rcx,1)
+    2774:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 f8             	sub    %rdi,%rax
+    2777:	|  |  |  |  |  |  |  |  |  |  |  |  |      4c 89 c6             	mov    %r8,%rsi
+    277a:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 c6             	sub    %rax,%rsi
+    277d:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 01 c8             	add    %r9d,%eax
+    2780:	|  |  |  |  |  |  |  |  |  |  |  |  |      c1 e8 03             	shr    $0x3,%eax
+    2783:	|  |  |  |  |  |  |  |  |  |  |  |  |      89 c1                	mov    %eax,%ecx
+    2785:	|  |  |  |  |  |  |  |  |  |  |  |  |      f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    2788:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 39 d2             	cmp    %rdx,%r10
+    278b:	|  |  |  |  |  |  |  |  |  |  |  \--|----- 72 b2                	jb     273f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    278d:	|  |  |  |  |  |  |  |  |  |  |     \----> c3                   	ret
+    std::memcpy(d, s, n);
+    278e:	|  |  |  |  |  |  |  \--|--|--|----------> 41 f6 c2 04          	test   $0x4,%r10b
+    2792:	|  |  |  |  |  |  |     |  |  |        /-- 0f 85 85 00 00 00    	jne    281d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x50d>
+    2798:	|  |  |  |  |  |  |     |  |  |        |   85 c0                	test   %eax,%eax
+    279a:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 67 ff ff ff    	je     2707 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    27a0:	|  |  |  |  |  |  |     |  |  |        |   0f b6 36             	movzbl (%rsi),%esi
+    27a3:	|  |  |  |  |  |  |     |  |  |        |   40 88 37             	mov    %sil,(%rdi)
+    27a6:	|  |  |  |  |  |  |     |  |  |        |   a8 02                	test   $0x2,%al
+    27a8:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 59 ff ff ff    	je     2707 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    27ae:	|  |  |  |  |  |  |     |  |  |        |   0f b7 4c 01 fe       	movzwl -0x2(%rcx,%rax,1),%ecx
+    27b3:	|  |  |  |  |  |  |     |  |  |        |   66 89 4c 07 fe       	mov    %cx,-0x2(%rdi,%rax,1)
+    27b8:	|  |  |  |  |  +--|-----|--|--|--------|-- e9 4a ff ff ff       	jmp    2707 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    27bd:	|  |  |  |  |  |  |     |  |  |        |   0f 1f 00             	nopl   (%rax)
+    27c0:	|  |  |  |  |  |  |     |  \--|--------|-> c3                   	ret
+    27c1:	|  |  |  |  |  |  |     |     \--------|-> 41 8b 08             	mov    (%r8),%ecx
+    27c4:	|  |  |  |  |  |  |     |              |   89 08                	mov    %ecx,(%rax)
+    27c6:	|  |  |  |  |  |  |     |              |   44 89 c9             	mov    %r9d,%ecx
+    27c9:	|  |  |  |  |  |  |     |              |   41 8b 74 08 fc       	mov    -0x4(%r8,%rcx,1),%esi
+    27ce:	|  |  |  |  |  |  |     |              |   89 74 08 fc          	mov    %esi,-0x4(%rax,%rcx,1)
+    27d2:	|  |  |  |  |  |  +-----|--------------|-- e9 60 ff ff ff       	jmp    2737 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+        d[i] = p[i];
+    27d7:	|  \--|--|--|--|--|-----|--------------|-> 0f b6 39             	movzbl (%rcx),%edi
+    27da:	|     |  |  |  |  |     |              |   41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    27dd:	|     |  |  |  |  |     |              |   40 f6 c6 0e          	test   $0xe,%sil
+    27e1:	+-----|--|--|--|--|-----|--------------|-- 0f 84 59 fc ff ff    	je     2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    27e7:	|     |  |  |  |  |     |              |   0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    27eb:	|     |  |  |  |  |     |              |   41 88 78 01          	mov    %dil,0x1(%r8)
+    for (Index i = 0; i < head; ++i) {
+    27ef:	|     |  |  |  |  |     |              |   48 83 f8 03          	cmp    $0x3,%rax
+    27f3:	\-----|--|--|--|--|-----|--------------|-- 0f 85 47 fc ff ff    	jne    2440 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    27f9:	      \--|--|--|--|-----|--------------|-- e9 7b fb ff ff       	jmp    2379 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x69>
+    27fe:	         |  |  |  |     |              |   66 90                	xchg   %ax,%ax
+    std::memcpy(d, s, n);
+    2800:	         |  |  |  |     \--------------|-> 44 89 c9             	mov    %r9d,%ecx
+    2803:	         |  |  |  |                    |   41 0f b7 74 08 fe    	movzwl -0x2(%r8,%rcx,1),%esi
+    2809:	         |  |  |  |                    |   66 89 74 08 fe       	mov    %si,-0x2(%rax,%rcx,1)
+    280e:	         |  |  |  \--------------------|-- e9 24 ff ff ff       	jmp    2737 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    for (Index i = 0; i < head; ++i) {
+    2813:	         \--|--|-----------------------|-> 49 89 c1             	mov    %rax,%r9
+    2816:	            |  |                       |   31 f6                	xor    %esi,%esi
+    2818:	            \--|-----------------------|-- e9 38 fe ff ff       	jmp    2655 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x345>
+    std::memcpy(d, s, n);
+    281d:	               |                       \-> 8b 36                	mov    (%rsi),%esi
+    281f:	               |                           89 37                	mov    %esi,(%rdi)
+    2821:	               |                           8b 4c 01 fc          	mov    -0x4(%rcx,%rax,1),%ecx
+    2825:	               |                           89 4c 07 fc          	mov    %ecx,-0x4(%rdi,%rax,1)
+    2829:	               \-------------------------- e9 d9 fe ff ff       	jmp    2707 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    282e:	                                           66 90                	xchg   %ax,%ax
+
+0000000000002830 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    2830:	    48 85 ff             	test   %rdi,%rdi
+    2833:	/-- 74 0b                	je     2840 <nel::free_aligned(void*)+0x10>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    2835:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    2839:	|   e9 f2 e7 ff ff       	jmp    1030 <free@plt>
+    283e:	|   66 90                	xchg   %ax,%ax
+}
+    2840:	\-> c3                   	ret
+    2841:	    66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2848:	    00 00 00 00 
+    284c:	    0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002850 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    2850:	                   41 56                	push   %r14
+    2852:	                   48 8d 05 c7 08 00 00 	lea    0x8c7(%rip),%rax        # 3120 <_IO_stdin_used+0x120>
+    2859:	                   41 55                	push   %r13
+    285b:	                   66 48 0f 6e c8       	movq   %rax,%xmm1
+    2860:	                   41 54                	push   %r12
+    2862:	                   55                   	push   %rbp
+    2863:	                   48 89 cd             	mov    %rcx,%rbp
+    2866:	                   48 8d 0d a3 08 00 00 	lea    0x8a3(%rip),%rcx        # 3110 <_IO_stdin_used+0x110>
+    286d:	                   53                   	push   %rbx
+    286e:	                   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    2873:	                   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2877:	                   48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    287b:	                   c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    2882:	                   00 
+            : fn_name_(fn_name)
+    2883:	                   0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    2887:	                   48 85 f6             	test   %rsi,%rsi
+    288a:	/----------------- 0f 84 a0 00 00 00    	je     2930 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    2890:	|                  48 8d 46 ff          	lea    -0x1(%rsi),%rax
+    2894:	|                  48 89 f3             	mov    %rsi,%rbx
+    2897:	|                  48 85 f0             	test   %rsi,%rax
+    289a:	+----------------- 0f 85 90 00 00 00    	jne    2930 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    28a0:	|                  48 8d 34 2e          	lea    (%rsi,%rbp,1),%rsi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    28a4:	|                  48 85 ff             	test   %rdi,%rdi
+    28a7:	|     /----------- 74 67                	je     2910 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xc0>
+    28a9:	|     |            4c 8b 6f f8          	mov    -0x8(%rdi),%r13
+    uint8_t *const new_base =
+    28ad:	|     |            49 89 d4             	mov    %rdx,%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    28b0:	|     |            4c 29 ef             	sub    %r13,%rdi
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    28b3:	|     |            e8 08 e8 ff ff       	call   10c0 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    28b8:	|     |            48 85 c0             	test   %rax,%rax
+    28bb:	|  /--|----------- 0f 84 7e 00 00 00    	je     293f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    28c1:	|  |  |            48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    28c6:	|  |  |            48 f7 db             	neg    %rbx
+    28c9:	|  |  |            48 21 cb             	and    %rcx,%rbx
+    28cc:	|  |  |            49 89 de             	mov    %rbx,%r14
+    28cf:	|  |  |            49 29 c6             	sub    %rax,%r14
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    28d2:	|  |  |            4d 39 f5             	cmp    %r14,%r13
+    28d5:	|  |  |        /-- 75 19                	jne    28f0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xa0>
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    }
+    offset_field(new_p) = new_offset;
+    28d7:	|  |  |     /--|-> 4c 89 73 f8          	mov    %r14,-0x8(%rbx)
+    return new_p;
+}
+    28db:	|  |  |  /--|--|-> 48 83 c4 20          	add    $0x20,%rsp
+    28df:	|  |  |  |  |  |   48 89 d8             	mov    %rbx,%rax
+    28e2:	|  |  |  |  |  |   5b                   	pop    %rbx
+    28e3:	|  |  |  |  |  |   5d                   	pop    %rbp
+    28e4:	|  |  |  |  |  |   41 5c                	pop    %r12
+    28e6:	|  |  |  |  |  |   41 5d                	pop    %r13
+    28e8:	|  |  |  |  |  |   41 5e                	pop    %r14
+    28ea:	|  |  |  |  |  |   c3                   	ret
+    28eb:	|  |  |  |  |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        std::memmove(new_p, new_base + old_offset, n);
+    28f0:	|  |  |  |  |  \-> 4c 39 e5             	cmp    %r12,%rbp
+    28f3:	|  |  |  |  |      4c 89 e2             	mov    %r12,%rdx
+    28f6:	|  |  |  |  |      4a 8d 34 28          	lea    (%rax,%r13,1),%rsi
+    28fa:	|  |  |  |  |      48 89 df             	mov    %rbx,%rdi
+    28fd:	|  |  |  |  |      48 0f 46 d5          	cmovbe %rbp,%rdx
+    2901:	|  |  |  |  |      e8 ca e7 ff ff       	call   10d0 <memmove@plt>
+    2906:	|  |  |  |  +----- eb cf                	jmp    28d7 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+    2908:	|  |  |  |  |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    290f:	|  |  |  |  |      00 
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2910:	|  |  \--|--|----> 48 89 f7             	mov    %rsi,%rdi
+    2913:	|  |     |  |      e8 98 e7 ff ff       	call   10b0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    2918:	|  |     |  |      48 85 c0             	test   %rax,%rax
+    291b:	|  +-----|--|----- 74 22                	je     293f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    291d:	|  |     |  |      48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    2922:	|  |     |  |      48 f7 db             	neg    %rbx
+    2925:	|  |     |  |      48 21 d3             	and    %rdx,%rbx
+    2928:	|  |     |  |      49 89 de             	mov    %rbx,%r14
+    292b:	|  |     |  |      49 29 c6             	sub    %rax,%r14
+    if (old_p != nullptr && new_offset != old_offset) {
+    292e:	|  |     |  \----- eb a7                	jmp    28d7 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    2930:	\--|-----|-------> 48 89 e6             	mov    %rsp,%rsi
+    2933:	   |     |         48 8d 3d f8 07 00 00 	lea    0x7f8(%rip),%rdi        # 3132 <_IO_stdin_used+0x132>
+    293a:	   |     |         e8 13 e8 ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    if (new_base == nullptr) { return nullptr; }
+    293f:	   \-----|-------> 31 db                	xor    %ebx,%ebx
+    2941:	         \-------- eb 98                	jmp    28db <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x8b>
+    2943:	                   66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    294a:	                   00 00 00 00 
+    294e:	                   66 90                	xchg   %ax,%ax
+
+0000000000002950 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    2950:	       53                   	push   %rbx
+            : fn_name_(fn_name)
+    2951:	       48 8d 05 c8 07 00 00 	lea    0x7c8(%rip),%rax        # 3120 <_IO_stdin_used+0x120>
+    2958:	       48 8d 0d b1 07 00 00 	lea    0x7b1(%rip),%rcx        # 3110 <_IO_stdin_used+0x110>
+    295f:	       66 48 0f 6e c1       	movq   %rcx,%xmm0
+    2964:	       66 48 0f 6e c8       	movq   %rax,%xmm1
+    2969:	       66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    296d:	       48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    2971:	       c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    2978:	       00 
+            : fn_name_(fn_name)
+    2979:	       0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    297d:	       48 85 ff             	test   %rdi,%rdi
+    2980:	/----- 74 35                	je     29b7 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+    2982:	|      48 8d 47 ff          	lea    -0x1(%rdi),%rax
+    2986:	|      48 89 fb             	mov    %rdi,%rbx
+    2989:	|      48 85 f8             	test   %rdi,%rax
+    298c:	+----- 75 29                	jne    29b7 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    298e:	|      48 8d 3c 37          	lea    (%rdi,%rsi,1),%rdi
+    2992:	|      e8 19 e7 ff ff       	call   10b0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    2997:	|      48 85 c0             	test   %rax,%rax
+    299a:	|  /-- 74 15                	je     29b1 <nel::malloc_aligned(unsigned long, unsigned long)+0x61>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    299c:	|  |   48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    29a1:	|  |   48 f7 db             	neg    %rbx
+    29a4:	|  |   48 21 da             	and    %rbx,%rdx
+    29a7:	|  |   48 29 c2             	sub    %rax,%rdx
+    uint8_t *const new_p = new_base + new_offset;
+    29aa:	|  |   48 01 d0             	add    %rdx,%rax
+    offset_field(new_p) = new_offset;
+    29ad:	|  |   48 89 50 f8          	mov    %rdx,-0x8(%rax)
+    return realloc_aligned(nullptr, align, 0, size);
+}
+    29b1:	|  \-> 48 83 c4 20          	add    $0x20,%rsp
+    29b5:	|      5b                   	pop    %rbx
+    29b6:	|      c3                   	ret
+    if (!pred) { assert_fail(msg, ctx); }
+    29b7:	\----> 48 89 e6             	mov    %rsp,%rsi
+    29ba:	       48 8d 3d 71 07 00 00 	lea    0x771(%rip),%rdi        # 3132 <_IO_stdin_used+0x132>
+    29c1:	       e8 8c e7 ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    29c6:	       66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    29cd:	       00 00 00 
+
+00000000000029d0 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    29d0:	53                   	push   %rbx
+    29d1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    29d4:	40 0f be fe          	movsbl %sil,%edi
+    29d8:	48 8b 35 a1 26 00 00 	mov    0x26a1(%rip),%rsi        # 5080 <stderr@GLIBC_2.2.5>
+    29df:	e8 8c e6 ff ff       	call   1070 <fputc@plt>
+    return outs;
+}
+    29e4:	48 89 d8             	mov    %rbx,%rax
+    29e7:	5b                   	pop    %rbx
+    29e8:	c3                   	ret
+    29e9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000029f0 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    29f0:	53                   	push   %rbx
+    29f1:	48 89 fb             	mov    %rdi,%rbx
+    29f4:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    29f7:	48 8b 35 82 26 00 00 	mov    0x2682(%rip),%rsi        # 5080 <stderr@GLIBC_2.2.5>
+    29fe:	e8 4d e6 ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    2a03:	48 89 d8             	mov    %rbx,%rax
+    2a06:	5b                   	pop    %rbx
+    2a07:	c3                   	ret
+    2a08:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    2a0f:	00 
+
+0000000000002a10 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    2a10:	53                   	push   %rbx
+    2a11:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    2a14:	48 8b 3d 65 26 00 00 	mov    0x2665(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    2a1b:	40 0f b6 d6          	movzbl %sil,%edx
+    2a1f:	31 c0                	xor    %eax,%eax
+    2a21:	48 8d 35 25 07 00 00 	lea    0x725(%rip),%rsi        # 314d <_IO_stdin_used+0x14d>
+    2a28:	e8 63 e6 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2a2d:	48 89 d8             	mov    %rbx,%rax
+    2a30:	5b                   	pop    %rbx
+    2a31:	c3                   	ret
+    2a32:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2a39:	00 00 00 00 
+    2a3d:	0f 1f 00             	nopl   (%rax)
+
+0000000000002a40 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    2a40:	53                   	push   %rbx
+    2a41:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    2a44:	48 8b 3d 35 26 00 00 	mov    0x2635(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    2a4b:	0f b7 d6             	movzwl %si,%edx
+    2a4e:	31 c0                	xor    %eax,%eax
+    2a50:	48 8d 35 f6 06 00 00 	lea    0x6f6(%rip),%rsi        # 314d <_IO_stdin_used+0x14d>
+    2a57:	e8 34 e6 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2a5c:	48 89 d8             	mov    %rbx,%rax
+    2a5f:	5b                   	pop    %rbx
+    2a60:	c3                   	ret
+    2a61:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2a68:	00 00 00 00 
+    2a6c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002a70 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    2a70:	53                   	push   %rbx
+    2a71:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    2a74:	48 8b 3d 05 26 00 00 	mov    0x2605(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    2a7b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    2a7d:	31 c0                	xor    %eax,%eax
+    2a7f:	48 8d 35 c7 06 00 00 	lea    0x6c7(%rip),%rsi        # 314d <_IO_stdin_used+0x14d>
+    2a86:	e8 05 e6 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2a8b:	48 89 d8             	mov    %rbx,%rax
+    2a8e:	5b                   	pop    %rbx
+    2a8f:	c3                   	ret
+
+0000000000002a90 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    2a90:	53                   	push   %rbx
+    2a91:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    2a94:	48 8b 3d e5 25 00 00 	mov    0x25e5(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    2a9b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    2a9d:	31 c0                	xor    %eax,%eax
+    2a9f:	48 8d 35 a7 06 00 00 	lea    0x6a7(%rip),%rsi        # 314d <_IO_stdin_used+0x14d>
+    2aa6:	e8 e5 e5 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2aab:	48 89 d8             	mov    %rbx,%rax
+    2aae:	5b                   	pop    %rbx
+    2aaf:	c3                   	ret
+
+0000000000002ab0 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    2ab0:	53                   	push   %rbx
+    2ab1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    2ab4:	48 8b 3d c5 25 00 00 	mov    0x25c5(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    2abb:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    2abe:	31 c0                	xor    %eax,%eax
+    2ac0:	48 8d 35 89 06 00 00 	lea    0x689(%rip),%rsi        # 3150 <_IO_stdin_used+0x150>
+    2ac7:	e8 c4 e5 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2acc:	48 89 d8             	mov    %rbx,%rax
+    2acf:	5b                   	pop    %rbx
+    2ad0:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000002ad4 <_fini>:
+    2ad4:	48 83 ec 08          	sub    $0x8,%rsp
+    2ad8:	48 83 c4 08          	add    $0x8,%rsp
+    2adc:	c3                   	ret
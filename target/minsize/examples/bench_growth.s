@@ -0,0 +1,1244 @@
+
+target/minsize/examples/bench_growth:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <clock_gettime@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <clock_gettime@GLIBC_2.17>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputs@plt>:
+    1060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 4018 <fputs@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 2f 00 00    	jmp    *0x2faa(%rip)        # 4020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fprintf@plt>:
+    1080:	ff 25 a2 2f 00 00    	jmp    *0x2fa2(%rip)        # 4028 <fprintf@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <realloc@plt>:
+    1090:	ff 25 9a 2f 00 00    	jmp    *0x2f9a(%rip)        # 4030 <realloc@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010a0 <__cxa_finalize@plt>:
+    10a0:	ff 25 3a 2f 00 00    	jmp    *0x2f3a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10a6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010b0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10b0:	50                   	push   %rax
+    std::abort();
+    10b1:	e8 8a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010b6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10b6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10b7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10ba:	4c 8d 0d 30 10 00 00 	lea    0x1030(%rip),%r9        # 20f1 <_IO_stdin_used+0xf1>
+    10c1:	31 c0                	xor    %eax,%eax
+    10c3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10c7:	4c 8b 07             	mov    (%rdi),%r8
+    10ca:	48 8d 35 26 10 00 00 	lea    0x1026(%rip),%rsi        # 20f7 <_IO_stdin_used+0xf7>
+    10d1:	48 8b 3d 88 2f 00 00 	mov    0x2f88(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    10d8:	e8 a3 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    10dd:	e8 5e ff ff ff       	call   1040 <abort@plt>
+
+00000000000010e2 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    10e2:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    10e6:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    10e9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    10ed:	31 c0                	xor    %eax,%eax
+    10ef:	57                   	push   %rdi
+    10f0:	48 8b 3d 69 2f 00 00 	mov    0x2f69(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    10f7:	4c 8d 0d f3 0f 00 00 	lea    0xff3(%rip),%r9        # 20f1 <_IO_stdin_used+0xf1>
+    10fe:	4c 8b 06             	mov    (%rsi),%r8
+    1101:	48 8d 35 00 10 00 00 	lea    0x1000(%rip),%rsi        # 2108 <_IO_stdin_used+0x108>
+    1108:	e8 73 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    110d:	e8 2e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001112 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1112:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1116:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1119:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    111d:	31 c0                	xor    %eax,%eax
+    111f:	57                   	push   %rdi
+    1120:	48 8b 3d 39 2f 00 00 	mov    0x2f39(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1127:	4c 8d 0d ef 0f 00 00 	lea    0xfef(%rip),%r9        # 211d <_IO_stdin_used+0x11d>
+    112e:	4c 8b 06             	mov    (%rsi),%r8
+    1131:	48 8d 35 d0 0f 00 00 	lea    0xfd0(%rip),%rsi        # 2108 <_IO_stdin_used+0x108>
+    1138:	e8 43 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    113d:	e8 fe fe ff ff       	call   1040 <abort@plt>
+
+0000000000001142 <main>:
+    nel::log << "  reallocs: " << Counting::reallocs << ", bytes moved (at most): "
+             << Counting::bytes << '\n';
+}
+
+int main()
+{
+    1142:	50                   	push   %rax
+    bench_push<nel::heaped::GeometricGrowth<2, 1>>("push 10M, geometric 2x");
+    1143:	48 8d 3d d4 0e 00 00 	lea    0xed4(%rip),%rdi        # 201e <_IO_stdin_used+0x1e>
+    114a:	e8 90 03 00 00       	call   14df <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)>
+    bench_push<nel::heaped::GeometricGrowth<3, 2>>("push 10M, geometric 1.5x");
+    114f:	48 8d 3d df 0e 00 00 	lea    0xedf(%rip),%rdi        # 2035 <_IO_stdin_used+0x35>
+    1156:	e8 08 05 00 00       	call   1663 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)>
+    bench_push<nel::heaped::LinearGrowth<16>>("push 10M, linear 16");
+    115b:	48 8d 3d ec 0e 00 00 	lea    0xeec(%rip),%rdi        # 204e <_IO_stdin_used+0x4e>
+    1162:	e8 85 06 00 00       	call   17ec <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)>
+}
+    1167:	31 c0                	xor    %eax,%eax
+    1169:	5a                   	pop    %rdx
+    116a:	c3                   	ret
+    116b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000001170 <_start>:
+    1170:	31 ed                	xor    %ebp,%ebp
+    1172:	49 89 d1             	mov    %rdx,%r9
+    1175:	5e                   	pop    %rsi
+    1176:	48 89 e2             	mov    %rsp,%rdx
+    1179:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    117d:	50                   	push   %rax
+    117e:	54                   	push   %rsp
+    117f:	45 31 c0             	xor    %r8d,%r8d
+    1182:	31 c9                	xor    %ecx,%ecx
+    1184:	48 8d 3d b7 ff ff ff 	lea    -0x49(%rip),%rdi        # 1142 <main>
+    118b:	ff 15 2f 2e 00 00    	call   *0x2e2f(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    1191:	f4                   	hlt
+    1192:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1199:	00 00 00 
+    119c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000011a0 <deregister_tm_clones>:
+    11a0:	    48 8d 3d a1 2e 00 00 	lea    0x2ea1(%rip),%rdi        # 4048 <__TMC_END__>
+    11a7:	    48 8d 05 9a 2e 00 00 	lea    0x2e9a(%rip),%rax        # 4048 <__TMC_END__>
+    11ae:	    48 39 f8             	cmp    %rdi,%rax
+    11b1:	/-- 74 15                	je     11c8 <deregister_tm_clones+0x28>
+    11b3:	|   48 8b 05 0e 2e 00 00 	mov    0x2e0e(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    11ba:	|   48 85 c0             	test   %rax,%rax
+    11bd:	+-- 74 09                	je     11c8 <deregister_tm_clones+0x28>
+    11bf:	|   ff e0                	jmp    *%rax
+    11c1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    11c8:	\-> c3                   	ret
+    11c9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011d0 <register_tm_clones>:
+    11d0:	    48 8d 3d 71 2e 00 00 	lea    0x2e71(%rip),%rdi        # 4048 <__TMC_END__>
+    11d7:	    48 8d 35 6a 2e 00 00 	lea    0x2e6a(%rip),%rsi        # 4048 <__TMC_END__>
+    11de:	    48 29 fe             	sub    %rdi,%rsi
+    11e1:	    48 89 f0             	mov    %rsi,%rax
+    11e4:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    11e8:	    48 c1 f8 03          	sar    $0x3,%rax
+    11ec:	    48 01 c6             	add    %rax,%rsi
+    11ef:	    48 d1 fe             	sar    %rsi
+    11f2:	/-- 74 14                	je     1208 <register_tm_clones+0x38>
+    11f4:	|   48 8b 05 dd 2d 00 00 	mov    0x2ddd(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    11fb:	|   48 85 c0             	test   %rax,%rax
+    11fe:	+-- 74 08                	je     1208 <register_tm_clones+0x38>
+    1200:	|   ff e0                	jmp    *%rax
+    1202:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1208:	\-> c3                   	ret
+    1209:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001210 <__do_global_dtors_aux>:
+    1210:	       f3 0f 1e fa          	endbr64
+    1214:	       80 3d 4d 2e 00 00 00 	cmpb   $0x0,0x2e4d(%rip)        # 4068 <completed.0>
+    121b:	/----- 75 2b                	jne    1248 <__do_global_dtors_aux+0x38>
+    121d:	|      55                   	push   %rbp
+    121e:	|      48 83 3d ba 2d 00 00 	cmpq   $0x0,0x2dba(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1225:	|      00 
+    1226:	|      48 89 e5             	mov    %rsp,%rbp
+    1229:	|  /-- 74 0c                	je     1237 <__do_global_dtors_aux+0x27>
+    122b:	|  |   48 8b 3d 0e 2e 00 00 	mov    0x2e0e(%rip),%rdi        # 4040 <__dso_handle>
+    1232:	|  |   e8 69 fe ff ff       	call   10a0 <__cxa_finalize@plt>
+    1237:	|  \-> e8 64 ff ff ff       	call   11a0 <deregister_tm_clones>
+    123c:	|      c6 05 25 2e 00 00 01 	movb   $0x1,0x2e25(%rip)        # 4068 <completed.0>
+    1243:	|      5d                   	pop    %rbp
+    1244:	|      c3                   	ret
+    1245:	|      0f 1f 00             	nopl   (%rax)
+    1248:	\----> c3                   	ret
+    1249:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001250 <frame_dummy>:
+    1250:	f3 0f 1e fa          	endbr64
+    1254:	e9 77 ff ff ff       	jmp    11d0 <register_tm_clones>
+    1259:	90                   	nop
+
+000000000000125a <nel::Result<void, int>::is_ok(nel::Context const&) const [clone .isra.0]>:
+    125a:	          52                   	push   %rdx
+    125b:	          85 ff                	test   %edi,%edi
+    125d:	   /----- 74 10                	je     126f <nel::Result<void, int>::is_ok(nel::Context const&) const [clone .isra.0]+0x15>
+    125f:	   |      ff cf                	dec    %edi
+    1261:	   |      83 ff 01             	cmp    $0x1,%edi
+    1264:	/--|----- 76 15                	jbe    127b <nel::Result<void, int>::is_ok(nel::Context const&) const [clone .isra.0]+0x21>
+    1266:	|  |      48 8d 3d a6 0d 00 00 	lea    0xda6(%rip),%rdi        # 2013 <_IO_stdin_used+0x13>
+    126d:	|  |  /-- eb 07                	jmp    1276 <nel::Result<void, int>::is_ok(nel::Context const&) const [clone .isra.0]+0x1c>
+    126f:	|  \--|-> 48 8d 3d 8e 0d 00 00 	lea    0xd8e(%rip),%rdi        # 2004 <_IO_stdin_used+0x4>
+    1276:	|     \-> e8 67 fe ff ff       	call   10e2 <nel::panic(char const*, nel::Context const&)>
+    127b:	\-------> 58                   	pop    %rax
+    127c:	          c3                   	ret
+
+000000000000127d <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    127d:	83 c8 ff             	or     $0xffffffff,%eax
+    1280:	c3                   	ret
+
+0000000000001281 <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    1281:	83 c8 ff             	or     $0xffffffff,%eax
+    1284:	c3                   	ret
+
+0000000000001285 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    1285:	83 c8 ff             	or     $0xffffffff,%eax
+    1288:	c3                   	ret
+
+0000000000001289 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    1289:	83 c8 ff             	or     $0xffffffff,%eax
+    128c:	c3                   	ret
+
+000000000000128d <_read_r>:
+int _read_r(struct _reent *, int) {
+    128d:	83 c8 ff             	or     $0xffffffff,%eax
+    1290:	c3                   	ret
+
+0000000000001291 <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    1291:	83 c8 ff             	or     $0xffffffff,%eax
+    1294:	c3                   	ret
+
+0000000000001295 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    1295:	83 c8 ff             	or     $0xffffffff,%eax
+    1298:	c3                   	ret
+
+0000000000001299 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1299:	83 c8 ff             	or     $0xffffffff,%eax
+    129c:	c3                   	ret
+
+000000000000129d <bench::now_ns()>:
+
+namespace bench
+{
+
+inline long unsigned int now_ns(void)
+{
+    129d:	48 83 ec 18          	sub    $0x18,%rsp
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    12a1:	bf 01 00 00 00       	mov    $0x1,%edi
+    12a6:	48 89 e6             	mov    %rsp,%rsi
+    12a9:	e8 a2 fd ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    12ae:	48 69 04 24 00 ca 9a 	imul   $0x3b9aca00,(%rsp),%rax
+    12b5:	3b 
+    12b6:	48 03 44 24 08       	add    0x8(%rsp),%rax
+}
+    12bb:	48 83 c4 18          	add    $0x18,%rsp
+    12bf:	c3                   	ret
+
+00000000000012c0 <bench::report(char const*, unsigned long, unsigned long)>:
+}
+
+// Log a result line: name, time and (if bytes given) bandwidth.
+inline void report(char const *const name, long unsigned int const ns,
+                   long unsigned int const bytes = 0)
+{
+    12c0:	    41 54                	push   %r12
+    nel::log << name << ": " << ns / 1000UL << "us";
+    12c2:	    4c 8d 25 b7 2d 00 00 	lea    0x2db7(%rip),%r12        # 4080 <nel::log>
+{
+    12c9:	    55                   	push   %rbp
+    12ca:	    48 89 f5             	mov    %rsi,%rbp
+    nel::log << name << ": " << ns / 1000UL << "us";
+    12cd:	    48 89 fe             	mov    %rdi,%rsi
+    12d0:	    4c 89 e7             	mov    %r12,%rdi
+{
+    12d3:	    53                   	push   %rbx
+    12d4:	    48 89 d3             	mov    %rdx,%rbx
+    nel::log << name << ": " << ns / 1000UL << "us";
+    12d7:	    e8 8f 06 00 00       	call   196b <nel::operator<<(nel::Log&, char const*)>
+    12dc:	    48 8d 35 0b 0e 00 00 	lea    0xe0b(%rip),%rsi        # 20ee <_IO_stdin_used+0xee>
+    12e3:	    48 89 c7             	mov    %rax,%rdi
+    12e6:	    e8 80 06 00 00       	call   196b <nel::operator<<(nel::Log&, char const*)>
+    12eb:	    b9 e8 03 00 00       	mov    $0x3e8,%ecx
+    12f0:	    31 d2                	xor    %edx,%edx
+    12f2:	    48 89 c7             	mov    %rax,%rdi
+    12f5:	    48 89 e8             	mov    %rbp,%rax
+    12f8:	    48 f7 f1             	div    %rcx
+    12fb:	    48 89 c6             	mov    %rax,%rsi
+    12fe:	    e8 03 07 00 00       	call   1a06 <nel::operator<<(nel::Log&, unsigned long)>
+    1303:	    48 8d 35 58 0d 00 00 	lea    0xd58(%rip),%rsi        # 2062 <_IO_stdin_used+0x62>
+    130a:	    48 89 c7             	mov    %rax,%rdi
+    130d:	    e8 59 06 00 00       	call   196b <nel::operator<<(nel::Log&, char const*)>
+    if (bytes != 0 && ns != 0) {
+    1312:	    48 85 db             	test   %rbx,%rbx
+    1315:	/-- 74 3a                	je     1351 <bench::report(char const*, unsigned long, unsigned long)+0x91>
+    1317:	|   48 85 ed             	test   %rbp,%rbp
+    131a:	+-- 74 35                	je     1351 <bench::report(char const*, unsigned long, unsigned long)+0x91>
+        // bytes/ns == GB/s, scaled to MB/s
+        nel::log << ", " << (bytes * 1000UL) / ns << "MB/s";
+    131c:	|   48 8d 35 42 0d 00 00 	lea    0xd42(%rip),%rsi        # 2065 <_IO_stdin_used+0x65>
+    1323:	|   4c 89 e7             	mov    %r12,%rdi
+    1326:	|   e8 40 06 00 00       	call   196b <nel::operator<<(nel::Log&, char const*)>
+    132b:	|   31 d2                	xor    %edx,%edx
+    132d:	|   48 89 c7             	mov    %rax,%rdi
+    1330:	|   48 69 c3 e8 03 00 00 	imul   $0x3e8,%rbx,%rax
+    1337:	|   48 f7 f5             	div    %rbp
+    133a:	|   48 89 c6             	mov    %rax,%rsi
+    133d:	|   e8 c4 06 00 00       	call   1a06 <nel::operator<<(nel::Log&, unsigned long)>
+    1342:	|   48 8d 35 1f 0d 00 00 	lea    0xd1f(%rip),%rsi        # 2068 <_IO_stdin_used+0x68>
+    1349:	|   48 89 c7             	mov    %rax,%rdi
+    134c:	|   e8 1a 06 00 00       	call   196b <nel::operator<<(nel::Log&, char const*)>
+    }
+    nel::log << '\n';
+}
+    1351:	\-> 5b                   	pop    %rbx
+    nel::log << '\n';
+    1352:	    4c 89 e7             	mov    %r12,%rdi
+}
+    1355:	    5d                   	pop    %rbp
+    nel::log << '\n';
+    1356:	    be 0a 00 00 00       	mov    $0xa,%esi
+}
+    135b:	    41 5c                	pop    %r12
+    nel::log << '\n';
+    135d:	    e9 f0 05 00 00       	jmp    1952 <nel::operator<<(nel::Log&, char)>
+
+0000000000001362 <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+    1362:	    83 3f 02             	cmpl   $0x2,(%rdi)
+    1365:	/-- 76 35                	jbe    139c <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x3a>
+    1367:	|   48 83 ec 28          	sub    $0x28,%rsp
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    136b:	|   48 8d 05 fb 0c 00 00 	lea    0xcfb(%rip),%rax        # 206d <_IO_stdin_used+0x6d>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    1372:	|   48 8d 3d 9a 0c 00 00 	lea    0xc9a(%rip),%rdi        # 2013 <_IO_stdin_used+0x13>
+    1379:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    137e:	|   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    1383:	|   48 8d 05 eb 0c 00 00 	lea    0xceb(%rip),%rax        # 2075 <_IO_stdin_used+0x75>
+    138a:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    138f:	|   c7 44 24 18 72 00 00 	movl   $0x72,0x18(%rsp)
+    1396:	|   00 
+    1397:	|   e8 46 fd ff ff       	call   10e2 <nel::panic(char const*, nel::Context const&)>
+    139c:	\-> c3                   	ret
+    139d:	    90                   	nop
+
+000000000000139e <nel::Result<void, int>::~Result()>:
+    139e:	    83 3f 02             	cmpl   $0x2,(%rdi)
+    13a1:	/-- 76 35                	jbe    13d8 <nel::Result<void, int>::~Result()+0x3a>
+    13a3:	|   48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    13a7:	|   48 8d 05 bf 0c 00 00 	lea    0xcbf(%rip),%rax        # 206d <_IO_stdin_used+0x6d>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    13ae:	|   48 8d 3d 5e 0c 00 00 	lea    0xc5e(%rip),%rdi        # 2013 <_IO_stdin_used+0x13>
+    13b5:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    13ba:	|   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    13bf:	|   48 8d 05 af 0c 00 00 	lea    0xcaf(%rip),%rax        # 2075 <_IO_stdin_used+0x75>
+    13c6:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    13cb:	|   c7 44 24 18 dd 02 00 	movl   $0x2dd,0x18(%rsp)
+    13d2:	|   00 
+    13d3:	|   e8 0a fd ff ff       	call   10e2 <nel::panic(char const*, nel::Context const&)>
+    13d8:	\-> c3                   	ret
+
+00000000000013d9 <nel::heaped::Node<int, Counting>::free(nel::heaped::Node<int, Counting>*)>:
+        // Make own using the allocator's malloc/free.
+        // But, can use realloc for better growing..
+        // Alignment is handled by the allocator, alignof(Node) includes values_align.
+        static void free(Node *old)
+        {
+            if (old == nullptr) { return; }
+    13d9:	    48 85 ff             	test   %rdi,%rdi
+    13dc:	/-- 74 05                	je     13e3 <nel::heaped::Node<int, Counting>::free(nel::heaped::Node<int, Counting>*)+0xa>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    13de:	|   e9 4d fc ff ff       	jmp    1030 <free@plt>
+            Length const sz = size_of(old->alloc_);
+            old->~Node();
+            Allocator::free(old, alignof(Node), sz);
+        }
+    13e3:	\-> c3                   	ret
+
+00000000000013e4 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)>:
+         * @returns on fail, nullptr, old_n is then untouched and still valid.
+         */
+        static Node *realloc(Node *const old_n, Count const new_cap)
+        {
+            // Too big to address, size_of() would overflow.
+            if (new_cap > max_capacity) { return nullptr; }
+    13e4:	             48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    13eb:	             ff ff 1f 
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    13ee:	             55                   	push   %rbp
+    13ef:	             53                   	push   %rbx
+    13f0:	             48 83 ec 38          	sub    $0x38,%rsp
+            if (new_cap > max_capacity) { return nullptr; }
+    13f4:	             48 39 f0             	cmp    %rsi,%rax
+    13f7:	/----------- 0f 82 be 00 00 00    	jb     14bb <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)+0xd7>
+    13fd:	|            48 89 f3             	mov    %rsi,%rbx
+
+            // Size of region to allocate excluding align padding.
+            Length const new_sz = size_of(new_cap);
+            Length const old_sz = (old_n == nullptr) ? 0 : size_of(old_n->alloc_);
+    1400:	|            31 c0                	xor    %eax,%eax
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1402:	|            48 8d 34 b5 14 00 00 	lea    0x14(,%rsi,4),%rsi
+    1409:	|            00 
+            Length const old_sz = (old_n == nullptr) ? 0 : size_of(old_n->alloc_);
+    140a:	|            48 85 ff             	test   %rdi,%rdi
+    140d:	|        /-- 74 0b                	je     141a <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)+0x36>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    140f:	|        |   48 8b 07             	mov    (%rdi),%rax
+    1412:	|        |   48 8d 04 85 14 00 00 	lea    0x14(,%rax,4),%rax
+    1419:	|        |   00 
+            reallocs += 1;
+    141a:	|        \-> 48 ff 05 57 2c 00 00 	incq   0x2c57(%rip)        # 4078 <Counting::reallocs>
+            bytes += old_size;
+    1421:	|            48 01 05 48 2c 00 00 	add    %rax,0x2c48(%rip)        # 4070 <Counting::bytes>
+                                    : std::realloc(p, new_size);
+    1428:	|            e8 63 fc ff ff       	call   1090 <realloc@plt>
+            if (new_p == nullptr) {
+    142d:	|            48 85 c0             	test   %rax,%rax
+    1430:	|     /----- 75 12                	jne    1444 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)+0x60>
+            : tag_(Tag::ERR)
+    1432:	|     |      c7 44 24 08 02 00 00 	movl   $0x2,0x8(%rsp)
+    1439:	|     |      00 
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+            : value_(forward<Type>(val))
+    143a:	|     |      c7 44 24 10 01 00 00 	movl   $0x1,0x10(%rsp)
+    1441:	|     |      00 
+    1442:	|     |  /-- eb 0d                	jmp    1451 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)+0x6d>
+            : tag_(Tag::OK)
+    1444:	|     \--|-> c7 44 24 08 01 00 00 	movl   $0x1,0x8(%rsp)
+    144b:	|        |   00 
+        {
+        }
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+            : value_(forward<Args>(args)...)
+    144c:	|        |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            : fn_name_(fn_name)
+    1451:	|        \-> 48 8d 05 2f 0c 00 00 	lea    0xc2f(%rip),%rax        # 2087 <_IO_stdin_used+0x87>
+            , line_num_(line_num)
+    1458:	|            c7 44 24 28 89 00 00 	movl   $0x89,0x28(%rsp)
+    145f:	|            00 
+    1460:	|            48 8d 7c 24 08       	lea    0x8(%rsp),%rdi
+            : fn_name_(fn_name)
+    1465:	|            48 89 44 24 18       	mov    %rax,0x18(%rsp)
+            , file_name_(file_name)
+    146a:	|            48 8d 05 1e 0c 00 00 	lea    0xc1e(%rip),%rax        # 208f <_IO_stdin_used+0x8f>
+    1471:	|            48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    1476:	|            8b 44 24 08          	mov    0x8(%rsp),%eax
+            switch (tag_) { // result-match
+    147a:	|            83 f8 01             	cmp    $0x1,%eax
+    147d:	|     /----- 74 21                	je     14a0 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)+0xbc>
+    147f:	|     |      83 f8 02             	cmp    $0x2,%eax
+    1482:	|  /--|----- 74 32                	je     14b6 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)+0xd2>
+    1484:	|  |  |      85 c0                	test   %eax,%eax
+                    nel::panic("invalid Result", ctx);
+    1486:	|  |  |      48 8d 3d 77 0b 00 00 	lea    0xb77(%rip),%rdi        # 2004 <_IO_stdin_used+0x4>
+    148d:	|  |  |      48 8d 74 24 18       	lea    0x18(%rsp),%rsi
+            switch (tag_) { // result-match
+    1492:	|  |  |  /-- 74 07                	je     149b <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)+0xb7>
+                    nel::panic("bad Result", ctx);
+    1494:	|  |  |  |   48 8d 3d 78 0b 00 00 	lea    0xb78(%rip),%rdi        # 2013 <_IO_stdin_used+0x13>
+    149b:	|  |  |  \-> e8 42 fc ff ff       	call   10e2 <nel::panic(char const*, nel::Context const&)>
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    14a0:	|  |  \----> 48 8b 6c 24 10       	mov    0x10(%rsp),%rbp
+            tag_ = Tag::INVAL;
+    14a5:	|  |         31 c0                	xor    %eax,%eax
+    14a7:	|  |         89 44 24 08          	mov    %eax,0x8(%rsp)
+                // realloc may move the values byte-wise.
+                auto r = Allocator::try_realloc(old_n, alignof(Node), old_sz, new_sz);
+                // Remember, if realloc fails, then old is still valid..
+                if (r.is_err()) { return nullptr; }
+                new_n = reinterpret_cast<Node *>(r.unwrap());
+            } else {
+    14ab:	|  |         e8 b2 fe ff ff       	call   1362 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+                    // poison new memory,
+                    // assumes realloc adds to end
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+                }
+            }
+            new_n->alloc_ = new_cap;
+    14b0:	|  |         48 89 5d 00          	mov    %rbx,0x0(%rbp)
+            return new_n;
+    14b4:	|  |     /-- eb 07                	jmp    14bd <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)+0xd9>
+            } else {
+    14b6:	|  \-----|-> e8 a7 fe ff ff       	call   1362 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+            if (new_cap > max_capacity) { return nullptr; }
+    14bb:	\--------|-> 31 ed                	xor    %ebp,%ebp
+        }
+    14bd:	         \-> 48 83 c4 38          	add    $0x38,%rsp
+    14c1:	             48 89 e8             	mov    %rbp,%rax
+    14c4:	             5b                   	pop    %rbx
+    14c5:	             5d                   	pop    %rbp
+    14c6:	             c3                   	ret
+
+00000000000014c7 <nel::heaped::Node<int, Counting>::malloc(unsigned long)>:
+        static Node *malloc(Count capacity)
+    14c7:	    56                   	push   %rsi
+    14c8:	    48 89 fe             	mov    %rdi,%rsi
+            Node *new_n = realloc(nullptr, capacity);
+    14cb:	    31 ff                	xor    %edi,%edi
+    14cd:	    e8 12 ff ff ff       	call   13e4 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)>
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    14d2:	    48 85 c0             	test   %rax,%rax
+    14d5:	/-- 74 06                	je     14dd <nel::heaped::Node<int, Counting>::malloc(unsigned long)+0x16>
+    14d7:	|   31 c9                	xor    %ecx,%ecx
+    14d9:	|   48 89 48 08          	mov    %rcx,0x8(%rax)
+        }
+    14dd:	\-> 5a                   	pop    %rdx
+    14de:	    c3                   	ret
+
+00000000000014df <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)>:
+void bench_push(char const *const name)
+    14df:	                41 57                	push   %r15
+    Counting::bytes = 0;
+    14e1:	                31 c0                	xor    %eax,%eax
+            : fn_name_(fn_name)
+    14e3:	                4c 8d 3d bc 0b 00 00 	lea    0xbbc(%rip),%r15        # 20a6 <_IO_stdin_used+0xa6>
+void bench_push(char const *const name)
+    14ea:	                41 56                	push   %r14
+    14ec:	                41 55                	push   %r13
+    14ee:	                41 54                	push   %r12
+    14f0:	                49 89 fc             	mov    %rdi,%r12
+    14f3:	                55                   	push   %rbp
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    14f4:	                31 ed                	xor    %ebp,%ebp
+void bench_push(char const *const name)
+    14f6:	                53                   	push   %rbx
+        }
+
+        // default ctor is ok since it cannot throw.
+        // TODO: but is it 'correct'? i.e. must arrays be created initialised?
+        constexpr Vector(void)
+            : item_(nullptr)
+    14f7:	                31 db                	xor    %ebx,%ebx
+    14f9:	                48 83 ec 28          	sub    $0x28,%rsp
+    Counting::bytes = 0;
+    14fd:	                48 89 05 74 2b 00 00 	mov    %rax,0x2b74(%rip)        # 4078 <Counting::reallocs>
+    1504:	                48 89 05 65 2b 00 00 	mov    %rax,0x2b65(%rip)        # 4070 <Counting::bytes>
+    long unsigned int const b = now_ns();
+    150b:	                e8 8d fd ff ff       	call   129d <bench::now_ns()>
+    1510:	                49 89 c5             	mov    %rax,%r13
+            v.push(int(i)).is_ok();
+    1513:	/-------------> 41 89 ee             	mov    %ebp,%r14d
+         *
+         * @returns the current in use count.
+         */
+        constexpr Length len(void) const
+        {
+            return (item_ == nullptr) ? 0 : item_->len();
+    1516:	|               48 85 db             	test   %rbx,%rbx
+    1519:	|           /-- 74 12                	je     152d <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0x4e>
+            return alloc_;
+        }
+
+        constexpr Length len(void) const
+        {
+            return len_;
+    151b:	|           |   48 8b 73 08          	mov    0x8(%rbx),%rsi
+            return alloc_;
+    151f:	|           |   48 8b 13             	mov    (%rbx),%rdx
+
+    private:
+        // Make room for n more values, only ever grows.
+        bool try_reserve_for(Count const n)
+        {
+            if (len() + n <= capacity()) { return true; }
+    1522:	|           |   48 8d 46 01          	lea    0x1(%rsi),%rax
+    1526:	|           |   48 39 c2             	cmp    %rax,%rdx
+    1529:	|  /--------|-- 73 58                	jae    1583 <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0xa4>
+    152b:	|  |     /--|-- eb 14                	jmp    1541 <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0x62>
+                item_ = VectorNode::malloc(new_cap);
+    152d:	|  |     |  \-> bf 04 00 00 00       	mov    $0x4,%edi
+    1532:	|  |     |      e8 90 ff ff ff       	call   14c7 <nel::heaped::Node<int, Counting>::malloc(unsigned long)>
+    1537:	|  |     |      48 89 c3             	mov    %rax,%rbx
+                if (item_ == nullptr) { return false; }
+    153a:	|  |     |      48 85 c0             	test   %rax,%rax
+    153d:	|  +-----|----- 75 44                	jne    1583 <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0xa4>
+    153f:	|  |  /--|----- eb 4b                	jmp    158c <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0xad>
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            if (cap <= cur) { return cap; }
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    1541:	|  |  |  \----> 48 83 fa 03          	cmp    $0x3,%rdx
+    1545:	|  |  |     /-- 77 15                	ja     155c <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0x7d>
+    1547:	|  |  |     |   ba 04 00 00 00       	mov    $0x4,%edx
+    154c:	|  |  |     |   48 39 d0             	cmp    %rdx,%rax
+    154f:	|  |  |     |   48 0f 42 c2          	cmovb  %rdx,%rax
+    1553:	|  |  |     |   48 39 f0             	cmp    %rsi,%rax
+    1556:	|  |  |     |   48 0f 43 f0          	cmovae %rax,%rsi
+    155a:	|  |  |  /--|-- eb 17                	jmp    1573 <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0x94>
+    155c:	|  |  |  |  \-> 48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+    1560:	|  |  |  |      48 39 c1             	cmp    %rax,%rcx
+    1563:	|  |  |  |      48 0f 43 c1          	cmovae %rcx,%rax
+    1567:	|  |  |  |      48 39 f0             	cmp    %rsi,%rax
+    156a:	|  |  |  |      48 0f 43 f0          	cmovae %rax,%rsi
+            } else if (new_cap == item_->capacity()) {
+    156e:	|  |  |  |      48 39 d6             	cmp    %rdx,%rsi
+    1571:	|  +--|--|----- 74 10                	je     1583 <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0xa4>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    1573:	|  |  |  \----> 48 89 df             	mov    %rbx,%rdi
+    1576:	|  |  |         e8 69 fe ff ff       	call   13e4 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)>
+                if (p == nullptr) { return false; }
+    157b:	|  |  |         48 85 c0             	test   %rax,%rax
+    157e:	|  |  +-------- 74 0c                	je     158c <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0xad>
+                item_ = p;
+    1580:	|  |  |         48 89 c3             	mov    %rax,%rbx
+            return len_;
+    1583:	|  \--|-------> 48 8b 43 08          	mov    0x8(%rbx),%rax
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+        {
+            if (len() >= capacity()) {
+    1587:	|     |         48 3b 03             	cmp    (%rbx),%rax
+    158a:	|     |     /-- 72 0e                	jb     159a <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0xbb>
+        {
+        }
+
+        template<typename... Args>
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+            : tag_(Tag::ERR)
+    158c:	|     \-----|-> c7 04 24 02 00 00 00 	movl   $0x2,(%rsp)
+    1593:	|           |   44 89 74 24 04       	mov    %r14d,0x4(%rsp)
+         * @returns a Result 'wrapping' the values given to construct an Err value inplace.
+         */
+        template<typename... Args>
+        constexpr static Result Err(Args &&...args)
+        {
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    1598:	|        /--|-- eb 13                	jmp    15ad <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0xce>
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    159a:	|        |  \-> 44 89 74 83 10       	mov    %r14d,0x10(%rbx,%rax,4)
+            len_ += 1;
+    159f:	|        |      48 ff c0             	inc    %rax
+    15a2:	|        |      48 89 43 08          	mov    %rax,0x8(%rbx)
+            : tag_(Tag::OK)
+    15a6:	|        |      c7 04 24 01 00 00 00 	movl   $0x1,(%rsp)
+    15ad:	|        \----> 8b 3c 24             	mov    (%rsp),%edi
+    15b0:	|               48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    15b5:	|               4c 89 7c 24 08       	mov    %r15,0x8(%rsp)
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    15ba:	|               48 ff c5             	inc    %rbp
+            , file_name_(file_name)
+    15bd:	|               48 8d 05 ed 0a 00 00 	lea    0xaed(%rip),%rax        # 20b1 <_IO_stdin_used+0xb1>
+            , line_num_(line_num)
+    15c4:	|               c7 44 24 18 38 00 00 	movl   $0x38,0x18(%rsp)
+    15cb:	|               00 
+            , file_name_(file_name)
+    15cc:	|               48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            v.push(int(i)).is_ok();
+    15d1:	|               e8 84 fc ff ff       	call   125a <nel::Result<void, int>::is_ok(nel::Context const&) const [clone .isra.0]>
+    15d6:	|               48 89 e7             	mov    %rsp,%rdi
+    15d9:	|               e8 c0 fd ff ff       	call   139e <nel::Result<void, int>::~Result()>
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    15de:	|               48 81 fd 80 96 98 00 	cmp    $0x989680,%rbp
+    15e5:	\-------------- 0f 85 28 ff ff ff    	jne    1513 <void bench_push<nel::heaped::GeometricGrowth<2ul, 1ul> >(char const*)+0x34>
+            VectorNode::free(item_);
+    15eb:	                48 89 df             	mov    %rbx,%rdi
+    15ee:	                e8 e6 fd ff ff       	call   13d9 <nel::heaped::Node<int, Counting>::free(nel::heaped::Node<int, Counting>*)>
+    return now_ns() - b;
+    15f3:	                e8 a5 fc ff ff       	call   129d <bench::now_ns()>
+    bench::report(name, t);
+    15f8:	                31 d2                	xor    %edx,%edx
+    15fa:	                4c 89 e7             	mov    %r12,%rdi
+    15fd:	                4c 29 e8             	sub    %r13,%rax
+    1600:	                48 89 c6             	mov    %rax,%rsi
+    1603:	                e8 b8 fc ff ff       	call   12c0 <bench::report(char const*, unsigned long, unsigned long)>
+             << Counting::bytes << '\n';
+    1608:	                48 8d 35 bb 0a 00 00 	lea    0xabb(%rip),%rsi        # 20ca <_IO_stdin_used+0xca>
+    160f:	                48 8d 3d 6a 2a 00 00 	lea    0x2a6a(%rip),%rdi        # 4080 <nel::log>
+    1616:	                e8 50 03 00 00       	call   196b <nel::operator<<(nel::Log&, char const*)>
+    161b:	                48 8b 35 56 2a 00 00 	mov    0x2a56(%rip),%rsi        # 4078 <Counting::reallocs>
+    1622:	                48 89 c7             	mov    %rax,%rdi
+    1625:	                e8 dc 03 00 00       	call   1a06 <nel::operator<<(nel::Log&, unsigned long)>
+    162a:	                48 8d 35 a6 0a 00 00 	lea    0xaa6(%rip),%rsi        # 20d7 <_IO_stdin_used+0xd7>
+    1631:	                48 89 c7             	mov    %rax,%rdi
+    1634:	                e8 32 03 00 00       	call   196b <nel::operator<<(nel::Log&, char const*)>
+    1639:	                48 8b 35 30 2a 00 00 	mov    0x2a30(%rip),%rsi        # 4070 <Counting::bytes>
+    1640:	                48 89 c7             	mov    %rax,%rdi
+    1643:	                e8 be 03 00 00       	call   1a06 <nel::operator<<(nel::Log&, unsigned long)>
+}
+    1648:	                48 83 c4 28          	add    $0x28,%rsp
+             << Counting::bytes << '\n';
+    164c:	                be 0a 00 00 00       	mov    $0xa,%esi
+}
+    1651:	                5b                   	pop    %rbx
+             << Counting::bytes << '\n';
+    1652:	                48 89 c7             	mov    %rax,%rdi
+}
+    1655:	                5d                   	pop    %rbp
+    1656:	                41 5c                	pop    %r12
+    1658:	                41 5d                	pop    %r13
+    165a:	                41 5e                	pop    %r14
+    165c:	                41 5f                	pop    %r15
+             << Counting::bytes << '\n';
+    165e:	                e9 ef 02 00 00       	jmp    1952 <nel::operator<<(nel::Log&, char)>
+
+0000000000001663 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)>:
+void bench_push(char const *const name)
+    1663:	                41 57                	push   %r15
+    Counting::bytes = 0;
+    1665:	                31 c0                	xor    %eax,%eax
+            : fn_name_(fn_name)
+    1667:	                4c 8d 3d 38 0a 00 00 	lea    0xa38(%rip),%r15        # 20a6 <_IO_stdin_used+0xa6>
+void bench_push(char const *const name)
+    166e:	                41 56                	push   %r14
+    1670:	                41 55                	push   %r13
+    1672:	                41 54                	push   %r12
+    1674:	                49 89 fc             	mov    %rdi,%r12
+    1677:	                55                   	push   %rbp
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    1678:	                31 ed                	xor    %ebp,%ebp
+void bench_push(char const *const name)
+    167a:	                53                   	push   %rbx
+            : item_(nullptr)
+    167b:	                31 db                	xor    %ebx,%ebx
+    167d:	                48 83 ec 28          	sub    $0x28,%rsp
+    Counting::bytes = 0;
+    1681:	                48 89 05 f0 29 00 00 	mov    %rax,0x29f0(%rip)        # 4078 <Counting::reallocs>
+    1688:	                48 89 05 e1 29 00 00 	mov    %rax,0x29e1(%rip)        # 4070 <Counting::bytes>
+    long unsigned int const b = now_ns();
+    168f:	                e8 09 fc ff ff       	call   129d <bench::now_ns()>
+    1694:	                49 89 c5             	mov    %rax,%r13
+            v.push(int(i)).is_ok();
+    1697:	/-------------> 41 89 ee             	mov    %ebp,%r14d
+            return (item_ == nullptr) ? 0 : item_->len();
+    169a:	|               48 85 db             	test   %rbx,%rbx
+    169d:	|           /-- 74 12                	je     16b1 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0x4e>
+            return len_;
+    169f:	|           |   48 8b 73 08          	mov    0x8(%rbx),%rsi
+            return alloc_;
+    16a3:	|           |   48 8b 0b             	mov    (%rbx),%rcx
+            if (len() + n <= capacity()) { return true; }
+    16a6:	|           |   48 8d 46 01          	lea    0x1(%rsi),%rax
+    16aa:	|           |   48 39 c1             	cmp    %rax,%rcx
+    16ad:	|  /--------|-- 73 5d                	jae    170c <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0xa9>
+    16af:	|  |     /--|-- eb 14                	jmp    16c5 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0x62>
+                item_ = VectorNode::malloc(new_cap);
+    16b1:	|  |     |  \-> bf 04 00 00 00       	mov    $0x4,%edi
+    16b6:	|  |     |      e8 0c fe ff ff       	call   14c7 <nel::heaped::Node<int, Counting>::malloc(unsigned long)>
+    16bb:	|  |     |      48 89 c3             	mov    %rax,%rbx
+                if (item_ == nullptr) { return false; }
+    16be:	|  |     |      48 85 c0             	test   %rax,%rax
+    16c1:	|  +-----|----- 75 49                	jne    170c <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0xa9>
+    16c3:	|  |  /--|----- eb 50                	jmp    1715 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0xb2>
+    16c5:	|  |  |  \----> 48 83 f9 03          	cmp    $0x3,%rcx
+    16c9:	|  |  |     /-- 77 15                	ja     16e0 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0x7d>
+    16cb:	|  |  |     |   ba 04 00 00 00       	mov    $0x4,%edx
+    16d0:	|  |  |     |   48 39 d0             	cmp    %rdx,%rax
+    16d3:	|  |  |     |   48 0f 42 c2          	cmovb  %rdx,%rax
+    16d7:	|  |  |     |   48 39 f0             	cmp    %rsi,%rax
+    16da:	|  |  |     |   48 0f 43 f0          	cmovae %rax,%rsi
+    16de:	|  |  |  /--|-- eb 1c                	jmp    16fc <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0x99>
+    16e0:	|  |  |  |  \-> 48 89 ca             	mov    %rcx,%rdx
+    16e3:	|  |  |  |      48 d1 ea             	shr    %rdx
+    16e6:	|  |  |  |      48 01 ca             	add    %rcx,%rdx
+    16e9:	|  |  |  |      48 39 c2             	cmp    %rax,%rdx
+    16ec:	|  |  |  |      48 0f 43 c2          	cmovae %rdx,%rax
+    16f0:	|  |  |  |      48 39 f0             	cmp    %rsi,%rax
+    16f3:	|  |  |  |      48 0f 43 f0          	cmovae %rax,%rsi
+            } else if (new_cap == item_->capacity()) {
+    16f7:	|  |  |  |      48 39 ce             	cmp    %rcx,%rsi
+    16fa:	|  +--|--|----- 74 10                	je     170c <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0xa9>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    16fc:	|  |  |  \----> 48 89 df             	mov    %rbx,%rdi
+    16ff:	|  |  |         e8 e0 fc ff ff       	call   13e4 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)>
+                if (p == nullptr) { return false; }
+    1704:	|  |  |         48 85 c0             	test   %rax,%rax
+    1707:	|  |  +-------- 74 0c                	je     1715 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0xb2>
+                item_ = p;
+    1709:	|  |  |         48 89 c3             	mov    %rax,%rbx
+            return len_;
+    170c:	|  \--|-------> 48 8b 43 08          	mov    0x8(%rbx),%rax
+            if (len() >= capacity()) {
+    1710:	|     |         48 3b 03             	cmp    (%rbx),%rax
+    1713:	|     |     /-- 72 0e                	jb     1723 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0xc0>
+            : tag_(Tag::ERR)
+    1715:	|     \-----|-> c7 04 24 02 00 00 00 	movl   $0x2,(%rsp)
+    171c:	|           |   44 89 74 24 04       	mov    %r14d,0x4(%rsp)
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    1721:	|        /--|-- eb 13                	jmp    1736 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0xd3>
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    1723:	|        |  \-> 44 89 74 83 10       	mov    %r14d,0x10(%rbx,%rax,4)
+            len_ += 1;
+    1728:	|        |      48 ff c0             	inc    %rax
+    172b:	|        |      48 89 43 08          	mov    %rax,0x8(%rbx)
+            : tag_(Tag::OK)
+    172f:	|        |      c7 04 24 01 00 00 00 	movl   $0x1,(%rsp)
+    1736:	|        \----> 8b 3c 24             	mov    (%rsp),%edi
+    1739:	|               48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    173e:	|               4c 89 7c 24 08       	mov    %r15,0x8(%rsp)
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    1743:	|               48 ff c5             	inc    %rbp
+            , file_name_(file_name)
+    1746:	|               48 8d 05 64 09 00 00 	lea    0x964(%rip),%rax        # 20b1 <_IO_stdin_used+0xb1>
+            , line_num_(line_num)
+    174d:	|               c7 44 24 18 38 00 00 	movl   $0x38,0x18(%rsp)
+    1754:	|               00 
+            , file_name_(file_name)
+    1755:	|               48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            v.push(int(i)).is_ok();
+    175a:	|               e8 fb fa ff ff       	call   125a <nel::Result<void, int>::is_ok(nel::Context const&) const [clone .isra.0]>
+    175f:	|               48 89 e7             	mov    %rsp,%rdi
+    1762:	|               e8 37 fc ff ff       	call   139e <nel::Result<void, int>::~Result()>
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    1767:	|               48 81 fd 80 96 98 00 	cmp    $0x989680,%rbp
+    176e:	\-------------- 0f 85 23 ff ff ff    	jne    1697 <void bench_push<nel::heaped::GeometricGrowth<3ul, 2ul> >(char const*)+0x34>
+            VectorNode::free(item_);
+    1774:	                48 89 df             	mov    %rbx,%rdi
+    1777:	                e8 5d fc ff ff       	call   13d9 <nel::heaped::Node<int, Counting>::free(nel::heaped::Node<int, Counting>*)>
+    return now_ns() - b;
+    177c:	                e8 1c fb ff ff       	call   129d <bench::now_ns()>
+    bench::report(name, t);
+    1781:	                31 d2                	xor    %edx,%edx
+    1783:	                4c 89 e7             	mov    %r12,%rdi
+    1786:	                4c 29 e8             	sub    %r13,%rax
+    1789:	                48 89 c6             	mov    %rax,%rsi
+    178c:	                e8 2f fb ff ff       	call   12c0 <bench::report(char const*, unsigned long, unsigned long)>
+             << Counting::bytes << '\n';
+    1791:	                48 8d 35 32 09 00 00 	lea    0x932(%rip),%rsi        # 20ca <_IO_stdin_used+0xca>
+    1798:	                48 8d 3d e1 28 00 00 	lea    0x28e1(%rip),%rdi        # 4080 <nel::log>
+    179f:	                e8 c7 01 00 00       	call   196b <nel::operator<<(nel::Log&, char const*)>
+    17a4:	                48 8b 35 cd 28 00 00 	mov    0x28cd(%rip),%rsi        # 4078 <Counting::reallocs>
+    17ab:	                48 89 c7             	mov    %rax,%rdi
+    17ae:	                e8 53 02 00 00       	call   1a06 <nel::operator<<(nel::Log&, unsigned long)>
+    17b3:	                48 8d 35 1d 09 00 00 	lea    0x91d(%rip),%rsi        # 20d7 <_IO_stdin_used+0xd7>
+    17ba:	                48 89 c7             	mov    %rax,%rdi
+    17bd:	                e8 a9 01 00 00       	call   196b <nel::operator<<(nel::Log&, char const*)>
+    17c2:	                48 8b 35 a7 28 00 00 	mov    0x28a7(%rip),%rsi        # 4070 <Counting::bytes>
+    17c9:	                48 89 c7             	mov    %rax,%rdi
+    17cc:	                e8 35 02 00 00       	call   1a06 <nel::operator<<(nel::Log&, unsigned long)>
+}
+    17d1:	                48 83 c4 28          	add    $0x28,%rsp
+             << Counting::bytes << '\n';
+    17d5:	                be 0a 00 00 00       	mov    $0xa,%esi
+}
+    17da:	                5b                   	pop    %rbx
+             << Counting::bytes << '\n';
+    17db:	                48 89 c7             	mov    %rax,%rdi
+}
+    17de:	                5d                   	pop    %rbp
+    17df:	                41 5c                	pop    %r12
+    17e1:	                41 5d                	pop    %r13
+    17e3:	                41 5e                	pop    %r14
+    17e5:	                41 5f                	pop    %r15
+             << Counting::bytes << '\n';
+    17e7:	                e9 66 01 00 00       	jmp    1952 <nel::operator<<(nel::Log&, char)>
+
+00000000000017ec <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)>:
+void bench_push(char const *const name)
+    17ec:	                41 57                	push   %r15
+    Counting::bytes = 0;
+    17ee:	                31 c0                	xor    %eax,%eax
+            : fn_name_(fn_name)
+    17f0:	                4c 8d 3d af 08 00 00 	lea    0x8af(%rip),%r15        # 20a6 <_IO_stdin_used+0xa6>
+void bench_push(char const *const name)
+    17f7:	                41 56                	push   %r14
+    17f9:	                41 55                	push   %r13
+    17fb:	                41 54                	push   %r12
+    17fd:	                49 89 fc             	mov    %rdi,%r12
+    1800:	                55                   	push   %rbp
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    1801:	                31 ed                	xor    %ebp,%ebp
+void bench_push(char const *const name)
+    1803:	                53                   	push   %rbx
+            : item_(nullptr)
+    1804:	                31 db                	xor    %ebx,%ebx
+    1806:	                48 83 ec 28          	sub    $0x28,%rsp
+    Counting::bytes = 0;
+    180a:	                48 89 05 67 28 00 00 	mov    %rax,0x2867(%rip)        # 4078 <Counting::reallocs>
+    1811:	                48 89 05 58 28 00 00 	mov    %rax,0x2858(%rip)        # 4070 <Counting::bytes>
+    long unsigned int const b = now_ns();
+    1818:	                e8 80 fa ff ff       	call   129d <bench::now_ns()>
+    181d:	                49 89 c5             	mov    %rax,%r13
+            v.push(int(i)).is_ok();
+    1820:	/-------------> 41 89 ee             	mov    %ebp,%r14d
+            return (item_ == nullptr) ? 0 : item_->len();
+    1823:	|               48 85 db             	test   %rbx,%rbx
+    1826:	|           /-- 74 12                	je     183a <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0x4e>
+            return len_;
+    1828:	|           |   48 8b 53 08          	mov    0x8(%rbx),%rdx
+            return alloc_;
+    182c:	|           |   48 8b 03             	mov    (%rbx),%rax
+            if (len() + n <= capacity()) { return true; }
+    182f:	|           |   48 8d 72 01          	lea    0x1(%rdx),%rsi
+    1833:	|           |   48 39 f0             	cmp    %rsi,%rax
+    1836:	|  /--------|-- 73 3a                	jae    1872 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0x86>
+    1838:	|  |     /--|-- eb 14                	jmp    184e <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0x62>
+                item_ = VectorNode::malloc(new_cap);
+    183a:	|  |     |  \-> bf 10 00 00 00       	mov    $0x10,%edi
+    183f:	|  |     |      e8 83 fc ff ff       	call   14c7 <nel::heaped::Node<int, Counting>::malloc(unsigned long)>
+    1844:	|  |     |      48 89 c3             	mov    %rax,%rbx
+                if (item_ == nullptr) { return false; }
+    1847:	|  |     |      48 85 c0             	test   %rax,%rax
+    184a:	|  +-----|----- 75 26                	jne    1872 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0x86>
+    184c:	|  |  /--|----- eb 2d                	jmp    187b <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0x8f>
+    public:
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            NEL_UNUSED(cur);
+            if (cap == 0) { return 0; }
+            return cap - cap % Q + Q;
+    184e:	|  |  |  \----> 48 83 e6 f0          	and    $0xfffffffffffffff0,%rsi
+    1852:	|  |  |         48 83 c6 10          	add    $0x10,%rsi
+    1856:	|  |  |         48 39 d6             	cmp    %rdx,%rsi
+    1859:	|  |  |         48 0f 42 f2          	cmovb  %rdx,%rsi
+            } else if (new_cap == item_->capacity()) {
+    185d:	|  |  |         48 39 c6             	cmp    %rax,%rsi
+    1860:	|  +--|-------- 74 10                	je     1872 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0x86>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    1862:	|  |  |         48 89 df             	mov    %rbx,%rdi
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    1865:	|  |  |         e8 7a fb ff ff       	call   13e4 <nel::heaped::Node<int, Counting>::realloc(nel::heaped::Node<int, Counting>*, unsigned long)>
+                if (p == nullptr) { return false; }
+    186a:	|  |  |         48 85 c0             	test   %rax,%rax
+    186d:	|  |  +-------- 74 0c                	je     187b <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0x8f>
+                item_ = p;
+    186f:	|  |  |         48 89 c3             	mov    %rax,%rbx
+            return len_;
+    1872:	|  \--|-------> 48 8b 43 08          	mov    0x8(%rbx),%rax
+            if (len() >= capacity()) {
+    1876:	|     |         48 3b 03             	cmp    (%rbx),%rax
+    1879:	|     |     /-- 72 0e                	jb     1889 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0x9d>
+            : tag_(Tag::ERR)
+    187b:	|     \-----|-> c7 04 24 02 00 00 00 	movl   $0x2,(%rsp)
+    1882:	|           |   44 89 74 24 04       	mov    %r14d,0x4(%rsp)
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    1887:	|        /--|-- eb 13                	jmp    189c <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0xb0>
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    1889:	|        |  \-> 44 89 74 83 10       	mov    %r14d,0x10(%rbx,%rax,4)
+            len_ += 1;
+    188e:	|        |      48 ff c0             	inc    %rax
+    1891:	|        |      48 89 43 08          	mov    %rax,0x8(%rbx)
+            : tag_(Tag::OK)
+    1895:	|        |      c7 04 24 01 00 00 00 	movl   $0x1,(%rsp)
+    189c:	|        \----> 8b 3c 24             	mov    (%rsp),%edi
+    189f:	|               48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    18a4:	|               4c 89 7c 24 08       	mov    %r15,0x8(%rsp)
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    18a9:	|               48 ff c5             	inc    %rbp
+            , file_name_(file_name)
+    18ac:	|               48 8d 05 fe 07 00 00 	lea    0x7fe(%rip),%rax        # 20b1 <_IO_stdin_used+0xb1>
+            , line_num_(line_num)
+    18b3:	|               c7 44 24 18 38 00 00 	movl   $0x38,0x18(%rsp)
+    18ba:	|               00 
+            , file_name_(file_name)
+    18bb:	|               48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            v.push(int(i)).is_ok();
+    18c0:	|               e8 95 f9 ff ff       	call   125a <nel::Result<void, int>::is_ok(nel::Context const&) const [clone .isra.0]>
+    18c5:	|               48 89 e7             	mov    %rsp,%rdi
+    18c8:	|               e8 d1 fa ff ff       	call   139e <nel::Result<void, int>::~Result()>
+        for (nel::Index i = 0; i < n_pushes; ++i) {
+    18cd:	|               48 81 fd 80 96 98 00 	cmp    $0x989680,%rbp
+    18d4:	\-------------- 0f 85 46 ff ff ff    	jne    1820 <void bench_push<nel::heaped::LinearGrowth<16ul> >(char const*)+0x34>
+            VectorNode::free(item_);
+    18da:	                48 89 df             	mov    %rbx,%rdi
+    18dd:	                e8 f7 fa ff ff       	call   13d9 <nel::heaped::Node<int, Counting>::free(nel::heaped::Node<int, Counting>*)>
+    return now_ns() - b;
+    18e2:	                e8 b6 f9 ff ff       	call   129d <bench::now_ns()>
+    bench::report(name, t);
+    18e7:	                31 d2                	xor    %edx,%edx
+    18e9:	                4c 89 e7             	mov    %r12,%rdi
+    18ec:	                4c 29 e8             	sub    %r13,%rax
+    18ef:	                48 89 c6             	mov    %rax,%rsi
+    18f2:	                e8 c9 f9 ff ff       	call   12c0 <bench::report(char const*, unsigned long, unsigned long)>
+             << Counting::bytes << '\n';
+    18f7:	                48 8d 35 cc 07 00 00 	lea    0x7cc(%rip),%rsi        # 20ca <_IO_stdin_used+0xca>
+    18fe:	                48 8d 3d 7b 27 00 00 	lea    0x277b(%rip),%rdi        # 4080 <nel::log>
+    1905:	                e8 61 00 00 00       	call   196b <nel::operator<<(nel::Log&, char const*)>
+    190a:	                48 8b 35 67 27 00 00 	mov    0x2767(%rip),%rsi        # 4078 <Counting::reallocs>
+    1911:	                48 89 c7             	mov    %rax,%rdi
+    1914:	                e8 ed 00 00 00       	call   1a06 <nel::operator<<(nel::Log&, unsigned long)>
+    1919:	                48 8d 35 b7 07 00 00 	lea    0x7b7(%rip),%rsi        # 20d7 <_IO_stdin_used+0xd7>
+    1920:	                48 89 c7             	mov    %rax,%rdi
+    1923:	                e8 43 00 00 00       	call   196b <nel::operator<<(nel::Log&, char const*)>
+    1928:	                48 8b 35 41 27 00 00 	mov    0x2741(%rip),%rsi        # 4070 <Counting::bytes>
+    192f:	                48 89 c7             	mov    %rax,%rdi
+    1932:	                e8 cf 00 00 00       	call   1a06 <nel::operator<<(nel::Log&, unsigned long)>
+}
+    1937:	                48 83 c4 28          	add    $0x28,%rsp
+             << Counting::bytes << '\n';
+    193b:	                be 0a 00 00 00       	mov    $0xa,%esi
+}
+    1940:	                5b                   	pop    %rbx
+             << Counting::bytes << '\n';
+    1941:	                48 89 c7             	mov    %rax,%rdi
+}
+    1944:	                5d                   	pop    %rbp
+    1945:	                41 5c                	pop    %r12
+    1947:	                41 5d                	pop    %r13
+    1949:	                41 5e                	pop    %r14
+    194b:	                41 5f                	pop    %r15
+             << Counting::bytes << '\n';
+    194d:	                e9 00 00 00 00       	jmp    1952 <nel::operator<<(nel::Log&, char)>
+
+0000000000001952 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1952:	53                   	push   %rbx
+    1953:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    1956:	40 0f be fe          	movsbl %sil,%edi
+    195a:	48 8b 35 ff 26 00 00 	mov    0x26ff(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    1961:	e8 0a f7 ff ff       	call   1070 <fputc@plt>
+    return outs;
+}
+    1966:	48 89 d8             	mov    %rbx,%rax
+    1969:	5b                   	pop    %rbx
+    196a:	c3                   	ret
+
+000000000000196b <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    196b:	53                   	push   %rbx
+    196c:	48 89 fb             	mov    %rdi,%rbx
+    196f:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    1972:	48 8b 35 e7 26 00 00 	mov    0x26e7(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    1979:	e8 e2 f6 ff ff       	call   1060 <fputs@plt>
+    return outs;
+}
+    197e:	48 89 d8             	mov    %rbx,%rax
+    1981:	5b                   	pop    %rbx
+    1982:	c3                   	ret
+
+0000000000001983 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1983:	53                   	push   %rbx
+    1984:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    1987:	48 8b 3d d2 26 00 00 	mov    0x26d2(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    198e:	40 0f b6 d6          	movzbl %sil,%edx
+    1992:	31 c0                	xor    %eax,%eax
+    1994:	48 8d 35 8e 07 00 00 	lea    0x78e(%rip),%rsi        # 2129 <_IO_stdin_used+0x129>
+    199b:	e8 e0 f6 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    19a0:	48 89 d8             	mov    %rbx,%rax
+    19a3:	5b                   	pop    %rbx
+    19a4:	c3                   	ret
+
+00000000000019a5 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    19a5:	53                   	push   %rbx
+    19a6:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    19a9:	48 8b 3d b0 26 00 00 	mov    0x26b0(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    19b0:	0f b7 d6             	movzwl %si,%edx
+    19b3:	31 c0                	xor    %eax,%eax
+    19b5:	48 8d 35 6d 07 00 00 	lea    0x76d(%rip),%rsi        # 2129 <_IO_stdin_used+0x129>
+    19bc:	e8 bf f6 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    19c1:	48 89 d8             	mov    %rbx,%rax
+    19c4:	5b                   	pop    %rbx
+    19c5:	c3                   	ret
+
+00000000000019c6 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    19c6:	53                   	push   %rbx
+    19c7:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    19ca:	48 8b 3d 8f 26 00 00 	mov    0x268f(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    19d1:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    19d3:	31 c0                	xor    %eax,%eax
+    19d5:	48 8d 35 4d 07 00 00 	lea    0x74d(%rip),%rsi        # 2129 <_IO_stdin_used+0x129>
+    19dc:	e8 9f f6 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    19e1:	48 89 d8             	mov    %rbx,%rax
+    19e4:	5b                   	pop    %rbx
+    19e5:	c3                   	ret
+
+00000000000019e6 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    19e6:	53                   	push   %rbx
+    19e7:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    19ea:	48 8b 3d 6f 26 00 00 	mov    0x266f(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    19f1:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    19f3:	31 c0                	xor    %eax,%eax
+    19f5:	48 8d 35 2d 07 00 00 	lea    0x72d(%rip),%rsi        # 2129 <_IO_stdin_used+0x129>
+    19fc:	e8 7f f6 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1a01:	48 89 d8             	mov    %rbx,%rax
+    1a04:	5b                   	pop    %rbx
+    1a05:	c3                   	ret
+
+0000000000001a06 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    1a06:	53                   	push   %rbx
+    1a07:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    1a0a:	48 8b 3d 4f 26 00 00 	mov    0x264f(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1a11:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    1a14:	31 c0                	xor    %eax,%eax
+    1a16:	48 8d 35 0f 07 00 00 	lea    0x70f(%rip),%rsi        # 212c <_IO_stdin_used+0x12c>
+    1a1d:	e8 5e f6 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1a22:	48 89 d8             	mov    %rbx,%rax
+    1a25:	5b                   	pop    %rbx
+    1a26:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000001a28 <_fini>:
+    1a28:	48 83 ec 08          	sub    $0x8,%rsp
+    1a2c:	48 83 c4 08          	add    $0x8,%rsp
+    1a30:	c3                   	ret
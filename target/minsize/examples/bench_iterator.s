@@ -0,0 +1,2939 @@
+
+target/minsize/examples/bench_iterator:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 4f 00 00 	mov    0x4fc5(%rip),%rax        # 5fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 4f 00 00    	push   0x4fca(%rip)        # 5ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 4f 00 00    	jmp    *0x4fcc(%rip)        # 5ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 4f 00 00    	jmp    *0x4fca(%rip)        # 6000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 4f 00 00    	jmp    *0x4fc2(%rip)        # 6008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <clock_gettime@plt>:
+    1050:	ff 25 ba 4f 00 00    	jmp    *0x4fba(%rip)        # 6010 <clock_gettime@GLIBC_2.17>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputs@plt>:
+    1060:	ff 25 b2 4f 00 00    	jmp    *0x4fb2(%rip)        # 6018 <fputs@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 4f 00 00    	jmp    *0x4faa(%rip)        # 6020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fprintf@plt>:
+    1080:	ff 25 a2 4f 00 00    	jmp    *0x4fa2(%rip)        # 6028 <fprintf@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <realloc@plt>:
+    1090:	ff 25 9a 4f 00 00    	jmp    *0x4f9a(%rip)        # 6030 <realloc@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <__cxa_atexit@plt>:
+    10a0:	ff 25 92 4f 00 00    	jmp    *0x4f92(%rip)        # 6038 <__cxa_atexit@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010b0 <__cxa_finalize@plt>:
+    10b0:	ff 25 2a 4f 00 00    	jmp    *0x4f2a(%rip)        # 5fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10b6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010c0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10c0:	50                   	push   %rax
+    std::abort();
+    10c1:	e8 7a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010c6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10c6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10c7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10ca:	4c 8d 0d af 29 00 00 	lea    0x29af(%rip),%r9        # 3a80 <sizes+0x20>
+    10d1:	31 c0                	xor    %eax,%eax
+    10d3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10d7:	4c 8b 07             	mov    (%rdi),%r8
+    10da:	48 8d 35 a5 29 00 00 	lea    0x29a5(%rip),%rsi        # 3a86 <sizes+0x26>
+    10e1:	48 8b 3d 78 4f 00 00 	mov    0x4f78(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+    10e8:	e8 93 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    10ed:	e8 4e ff ff ff       	call   1040 <abort@plt>
+
+00000000000010f2 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    10f2:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    10f6:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    10f9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    10fd:	31 c0                	xor    %eax,%eax
+    10ff:	57                   	push   %rdi
+    1100:	48 8b 3d 59 4f 00 00 	mov    0x4f59(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+    1107:	4c 8d 0d 72 29 00 00 	lea    0x2972(%rip),%r9        # 3a80 <sizes+0x20>
+    110e:	4c 8b 06             	mov    (%rsi),%r8
+    1111:	48 8d 35 7f 29 00 00 	lea    0x297f(%rip),%rsi        # 3a97 <sizes+0x37>
+    1118:	e8 63 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    111d:	e8 1e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001122 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1122:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1126:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1129:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    112d:	31 c0                	xor    %eax,%eax
+    112f:	57                   	push   %rdi
+    1130:	48 8b 3d 29 4f 00 00 	mov    0x4f29(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+    1137:	4c 8d 0d 6e 29 00 00 	lea    0x296e(%rip),%r9        # 3aac <sizes+0x4c>
+    113e:	4c 8b 06             	mov    (%rsi),%r8
+    1141:	48 8d 35 4f 29 00 00 	lea    0x294f(%rip),%rsi        # 3a97 <sizes+0x37>
+    1148:	e8 33 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    114d:	e8 ee fe ff ff       	call   1040 <abort@plt>
+
+0000000000001152 <main>:
+        return acc;
+    });
+}
+
+int main()
+{
+    1152:	                41 57                	push   %r15
+        //     // p % alignment == 0?
+        //     return ((Length)p & (align-1)) == 0;
+        // }
+        static Node *malloc(Count capacity)
+        {
+            Node *new_n = realloc(nullptr, capacity);
+    1154:	                be 00 00 00 01       	mov    $0x1000000,%esi
+    1159:	                31 ff                	xor    %edi,%edi
+    115b:	                41 56                	push   %r14
+    115d:	                41 55                	push   %r13
+    115f:	                41 54                	push   %r12
+    1161:	                55                   	push   %rbp
+    1162:	                53                   	push   %rbx
+    1163:	                48 83 ec 48          	sub    $0x48,%rsp
+    1167:	                e8 c5 17 00 00       	call   2931 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    116c:	                48 89 c3             	mov    %rax,%rbx
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    116f:	                48 85 c0             	test   %rax,%rax
+    1172:	            /-- 74 06                	je     117a <main+0x28>
+    1174:	            |   31 f6                	xor    %esi,%esi
+    1176:	            |   48 89 70 08          	mov    %rsi,0x8(%rax)
+    nel::Length const max_len = sizes[sizeof(sizes) / sizeof(sizes[0]) - 1] / sizeof(int);
+    auto v = nel::heaped::Vector<int>::with_capacity(max_len);
+    for (nel::Index i = 0; i < max_len; ++i) {
+    117a:	            \-> 31 ed                	xor    %ebp,%ebp
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    117c:	                4c 8d 2d f3 27 00 00 	lea    0x27f3(%rip),%r13        # 3976 <_IO_stdin_used+0x976>
+        v.push(int(i % 1000)).unwrap();
+    1183:	/-------------> b9 e8 03 00 00       	mov    $0x3e8,%ecx
+    1188:	|               48 89 e8             	mov    %rbp,%rax
+    118b:	|               31 d2                	xor    %edx,%edx
+    118d:	|               48 f7 f1             	div    %rcx
+    1190:	|               49 89 d4             	mov    %rdx,%r12
+         *
+         * @returns the current in use count.
+         */
+        constexpr Length len(void) const
+        {
+            return (item_ == nullptr) ? 0 : item_->len();
+    1193:	|               48 85 db             	test   %rbx,%rbx
+    1196:	|           /-- 74 12                	je     11aa <main+0x58>
+            return alloc_;
+        }
+
+        constexpr Length len(void) const
+        {
+            return len_;
+    1198:	|           |   48 8b 73 08          	mov    0x8(%rbx),%rsi
+            return alloc_;
+    119c:	|           |   48 8b 13             	mov    (%rbx),%rdx
+
+    private:
+        // Make room for n more values, only ever grows.
+        bool try_reserve_for(Count const n)
+        {
+            if (len() + n <= capacity()) { return true; }
+    119f:	|           |   48 8d 46 01          	lea    0x1(%rsi),%rax
+    11a3:	|           |   48 39 c2             	cmp    %rax,%rdx
+    11a6:	|  /--------|-- 73 60                	jae    1208 <main+0xb6>
+    11a8:	|  |     /--|-- eb 1c                	jmp    11c6 <main+0x74>
+            Node *new_n = realloc(nullptr, capacity);
+    11aa:	|  |     |  \-> be 04 00 00 00       	mov    $0x4,%esi
+    11af:	|  |     |      31 ff                	xor    %edi,%edi
+    11b1:	|  |     |      e8 7b 17 00 00       	call   2931 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    11b6:	|  |     |      48 89 c3             	mov    %rax,%rbx
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    11b9:	|  |     |      48 85 c0             	test   %rax,%rax
+    11bc:	|  |  /--|----- 74 53                	je     1211 <main+0xbf>
+    11be:	|  |  |  |      31 c9                	xor    %ecx,%ecx
+    11c0:	|  |  |  |      48 89 48 08          	mov    %rcx,0x8(%rax)
+    11c4:	|  +--|--|----- eb 42                	jmp    1208 <main+0xb6>
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            if (cap <= cur) { return cap; }
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    11c6:	|  |  |  \----> 48 83 fa 03          	cmp    $0x3,%rdx
+    11ca:	|  |  |     /-- 77 15                	ja     11e1 <main+0x8f>
+    11cc:	|  |  |     |   ba 04 00 00 00       	mov    $0x4,%edx
+    11d1:	|  |  |     |   48 39 d0             	cmp    %rdx,%rax
+    11d4:	|  |  |     |   48 0f 42 c2          	cmovb  %rdx,%rax
+    11d8:	|  |  |     |   48 39 f0             	cmp    %rsi,%rax
+    11db:	|  |  |     |   48 0f 43 f0          	cmovae %rax,%rsi
+    11df:	|  |  |  /--|-- eb 17                	jmp    11f8 <main+0xa6>
+    11e1:	|  |  |  |  \-> 48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+    11e5:	|  |  |  |      48 39 c1             	cmp    %rax,%rcx
+    11e8:	|  |  |  |      48 0f 43 c1          	cmovae %rcx,%rax
+    11ec:	|  |  |  |      48 39 f0             	cmp    %rsi,%rax
+    11ef:	|  |  |  |      48 0f 43 f0          	cmovae %rax,%rsi
+            } else if (new_cap == item_->capacity()) {
+    11f3:	|  |  |  |      48 39 d6             	cmp    %rdx,%rsi
+    11f6:	|  +--|--|----- 74 10                	je     1208 <main+0xb6>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    11f8:	|  |  |  \----> 48 89 df             	mov    %rbx,%rdi
+    11fb:	|  |  |         e8 31 17 00 00       	call   2931 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+                if (p == nullptr) { return false; }
+    1200:	|  |  |         48 85 c0             	test   %rax,%rax
+    1203:	|  |  +-------- 74 0c                	je     1211 <main+0xbf>
+                item_ = p;
+    1205:	|  |  |         48 89 c3             	mov    %rax,%rbx
+            return len_;
+    1208:	|  \--|-------> 48 8b 43 08          	mov    0x8(%rbx),%rax
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+        {
+            if (len() >= capacity()) {
+    120c:	|     |         48 3b 03             	cmp    (%rbx),%rax
+    120f:	|     |     /-- 72 0f                	jb     1220 <main+0xce>
+        {
+        }
+
+        template<typename... Args>
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+            : tag_(Tag::ERR)
+    1211:	|     \-----|-> c7 44 24 18 02 00 00 	movl   $0x2,0x18(%rsp)
+    1218:	|           |   00 
+        {
+        }
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+            : value_(forward<Args>(args)...)
+    1219:	|           |   44 89 64 24 1c       	mov    %r12d,0x1c(%rsp)
+         * @returns a Result 'wrapping' the values given to construct an Err value inplace.
+         */
+        template<typename... Args>
+        constexpr static Result Err(Args &&...args)
+        {
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    121e:	|        /--|-- eb 14                	jmp    1234 <main+0xe2>
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    1220:	|        |  \-> 44 89 64 83 10       	mov    %r12d,0x10(%rbx,%rax,4)
+            len_ += 1;
+    1225:	|        |      48 ff c0             	inc    %rax
+    1228:	|        |      48 89 43 08          	mov    %rax,0x8(%rbx)
+            : tag_(Tag::OK)
+    122c:	|        |      c7 44 24 18 01 00 00 	movl   $0x1,0x18(%rsp)
+    1233:	|        |      00 
+            , file_name_(file_name)
+    1234:	|        \----> 48 8d 05 1f 26 00 00 	lea    0x261f(%rip),%rax        # 385a <_IO_stdin_used+0x85a>
+    123b:	|               4c 8d 74 24 28       	lea    0x28(%rsp),%r14
+            : fn_name_(fn_name)
+    1240:	|               4c 89 6c 24 28       	mov    %r13,0x28(%rsp)
+    for (nel::Index i = 0; i < max_len; ++i) {
+    1245:	|               48 ff c5             	inc    %rbp
+            , file_name_(file_name)
+    1248:	|               48 89 44 24 30       	mov    %rax,0x30(%rsp)
+        v.push(int(i % 1000)).unwrap();
+    124d:	|               48 8d 44 24 18       	lea    0x18(%rsp),%rax
+    1252:	|               4c 89 f6             	mov    %r14,%rsi
+    1255:	|               48 89 c7             	mov    %rax,%rdi
+    1258:	|               48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , line_num_(line_num)
+    125d:	|               c7 44 24 38 d4 00 00 	movl   $0xd4,0x38(%rsp)
+    1264:	|               00 
+    1265:	|               e8 c2 13 00 00       	call   262c <nel::Result<void, int>::unwrap(nel::Context const&)>
+    126a:	|               48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    126f:	|               e8 7c 13 00 00       	call   25f0 <nel::Result<void, int>::~Result()>
+    for (nel::Index i = 0; i < max_len; ++i) {
+    1274:	|               48 81 fd 00 00 00 01 	cmp    $0x1000000,%rbp
+    127b:	\-------------- 0f 85 02 ff ff ff    	jne    1183 <main+0x31>
+    }
+
+    for (nel::Length const bytes: sizes) {
+    1281:	                48 8d 2d d8 27 00 00 	lea    0x27d8(%rip),%rbp        # 3a60 <sizes>
+        auto s = v.slice(0, bytes / sizeof(int));
+        nel::log << "working set " << bytes / 1024 << "KiB, " << s.len() << " ints\n";
+    1288:	                4c 8d 3d ec 26 00 00 	lea    0x26ec(%rip),%r15        # 397b <_IO_stdin_used+0x97b>
+    for (nel::Length const bytes: sizes) {
+    128f:	      /-------> 4c 8b 65 00          	mov    0x0(%rbp),%r12
+        auto s = v.slice(0, bytes / sizeof(int));
+    1293:	      |         4c 89 e1             	mov    %r12,%rcx
+    1296:	      |         48 c1 e9 02          	shr    $0x2,%rcx
+            return (item_ == nullptr) ? Slice<Type>::empty() : item_->slice();
+    129a:	      |         48 85 db             	test   %rbx,%rbx
+    129d:	      |     /-- 75 0e                	jne    12ad <main+0x15b>
+        Length len_;
+
+    private:
+        constexpr Slice(void)
+            : content_(nullptr)
+            , len_(0)
+    129f:	      |     |   31 d2                	xor    %edx,%edx
+    12a1:	      |     |   48 89 54 24 28       	mov    %rdx,0x28(%rsp)
+    12a6:	      |     |   48 89 54 24 30       	mov    %rdx,0x30(%rsp)
+         *
+         * @return fresh empty slice
+         */
+        static constexpr Slice empty(void)
+        {
+            return Slice();
+    12ab:	      |  /--|-- eb 12                	jmp    12bf <main+0x16d>
+            return len_;
+    12ad:	      |  |  \-> 48 8b 43 08          	mov    0x8(%rbx),%rax
+            return Slice(values_, len());
+    12b1:	      |  |      48 8d 53 10          	lea    0x10(%rbx),%rdx
+    12b5:	      |  |      48 89 54 24 28       	mov    %rdx,0x28(%rsp)
+            , len_(len)
+    12ba:	      |  |      48 89 44 24 30       	mov    %rax,0x30(%rsp)
+            return slice().slice(b, e);
+    12bf:	      |  \----> 48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    12c4:	      |         31 d2                	xor    %edx,%edx
+    12c6:	      |         4c 89 f6             	mov    %r14,%rsi
+    for (nel::Length const bytes: sizes) {
+    12c9:	      |         48 83 c5 08          	add    $0x8,%rbp
+        nel::log << "working set " << bytes / 1024 << "KiB, " << s.len() << " ints\n";
+    12cd:	      |         4c 8d 2d cc 8d 00 00 	lea    0x8dcc(%rip),%r13        # a0a0 <nel::log>
+    12d4:	      |         e8 6f 12 00 00       	call   2548 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+    12d9:	      |         4c 89 fe             	mov    %r15,%rsi
+    12dc:	      |         4c 89 ef             	mov    %r13,%rdi
+    12df:	      |         e8 29 17 00 00       	call   2a0d <nel::operator<<(nel::Log&, char const*)>
+    12e4:	      |         4c 89 e6             	mov    %r12,%rsi
+    12e7:	      |         48 89 c7             	mov    %rax,%rdi
+    12ea:	      |         48 c1 ee 0a          	shr    $0xa,%rsi
+    12ee:	      |         e8 b5 17 00 00       	call   2aa8 <nel::operator<<(nel::Log&, unsigned long)>
+    12f3:	      |         48 8d 35 8e 26 00 00 	lea    0x268e(%rip),%rsi        # 3988 <_IO_stdin_used+0x988>
+    12fa:	      |         48 89 c7             	mov    %rax,%rdi
+    12fd:	      |         e8 0b 17 00 00       	call   2a0d <nel::operator<<(nel::Log&, char const*)>
+    1302:	      |         48 8b 74 24 20       	mov    0x20(%rsp),%rsi
+    1307:	      |         48 89 c7             	mov    %rax,%rdi
+    130a:	      |         e8 99 17 00 00       	call   2aa8 <nel::operator<<(nel::Log&, unsigned long)>
+    130f:	      |         48 8d 35 78 26 00 00 	lea    0x2678(%rip),%rsi        # 398e <_IO_stdin_used+0x98e>
+    1316:	      |         48 89 c7             	mov    %rax,%rdi
+    1319:	      |         e8 ef 16 00 00       	call   2a0d <nel::operator<<(nel::Log&, char const*)>
+        bench_for_each(s);
+    131e:	      |         48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    1323:	      |         e8 c8 03 00 00       	call   16f0 <bench_for_each(nel::Slice<int> const&)>
+        bench_map_first_n_fold(s);
+    1328:	      |         48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    132d:	      |         e8 e8 01 00 00       	call   151a <bench_map_first_n_fold(nel::Slice<int> const&)>
+        bench_chain(s);
+    1332:	      |         48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    1337:	      |         e8 bf 0a 00 00       	call   1dfb <bench_chain(nel::Slice<int> const&)>
+    for (nel::Length const bytes: sizes) {
+    133c:	      |         48 8d 05 3d 27 00 00 	lea    0x273d(%rip),%rax        # 3a80 <sizes+0x20>
+    1343:	      |         48 39 c5             	cmp    %rax,%rbp
+    1346:	      \-------- 0f 85 43 ff ff ff    	jne    128f <main+0x13d>
+    }
+    nel::log << "queue " << queue_len << " ints, wrapped\n";
+    134c:	                48 8d 35 42 26 00 00 	lea    0x2642(%rip),%rsi        # 3995 <_IO_stdin_used+0x995>
+    1353:	                4c 89 ef             	mov    %r13,%rdi
+    1356:	                e8 b2 16 00 00       	call   2a0d <nel::operator<<(nel::Log&, char const*)>
+    135b:	                be 00 10 00 00       	mov    $0x1000,%esi
+    1360:	                48 89 c7             	mov    %rax,%rdi
+    1363:	                e8 40 17 00 00       	call   2aa8 <nel::operator<<(nel::Log&, unsigned long)>
+    1368:	                48 8d 35 2d 26 00 00 	lea    0x262d(%rip),%rsi        # 399c <_IO_stdin_used+0x99c>
+    136f:	                48 89 c7             	mov    %rax,%rdi
+    1372:	                e8 96 16 00 00       	call   2a0d <nel::operator<<(nel::Log&, char const*)>
+            return (item_ == nullptr) ? Slice<Type>::empty() : item_->slice();
+    1377:	                48 85 db             	test   %rbx,%rbx
+    137a:	            /-- 75 0e                	jne    138a <main+0x238>
+            , len_(0)
+    137c:	            |   31 c0                	xor    %eax,%eax
+    137e:	            |   48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    1383:	            |   48 89 44 24 30       	mov    %rax,0x30(%rsp)
+            return Slice();
+    1388:	         /--|-- eb 12                	jmp    139c <main+0x24a>
+            return len_;
+    138a:	         |  \-> 48 8b 43 08          	mov    0x8(%rbx),%rax
+            return Slice(values_, len());
+    138e:	         |      48 8d 53 10          	lea    0x10(%rbx),%rdx
+    1392:	         |      48 89 54 24 28       	mov    %rdx,0x28(%rsp)
+            , len_(len)
+    1397:	         |      48 89 44 24 30       	mov    %rax,0x30(%rsp)
+    bench_queue(v.slice());
+    139c:	         \----> 4c 89 f7             	mov    %r14,%rdi
+    139f:	                e8 d8 06 00 00       	call   1a7c <bench_queue(nel::Slice<int> const&)>
+    nel::log << "sink: " << (long unsigned int)sink << '\n';
+    13a4:	                48 8d 35 01 26 00 00 	lea    0x2601(%rip),%rsi        # 39ac <_IO_stdin_used+0x9ac>
+    13ab:	                4c 89 ef             	mov    %r13,%rdi
+    13ae:	                e8 5a 16 00 00       	call   2a0d <nel::operator<<(nel::Log&, char const*)>
+    13b3:	                48 8b 35 de 8c 00 00 	mov    0x8cde(%rip),%rsi        # a098 <sink>
+    13ba:	                48 89 c7             	mov    %rax,%rdi
+    13bd:	                e8 e6 16 00 00       	call   2aa8 <nel::operator<<(nel::Log&, unsigned long)>
+    13c2:	                be 0a 00 00 00       	mov    $0xa,%esi
+    13c7:	                48 89 c7             	mov    %rax,%rdi
+    13ca:	                e8 25 16 00 00       	call   29f4 <nel::operator<<(nel::Log&, char)>
+            if (old == nullptr) { return; }
+    13cf:	                48 85 db             	test   %rbx,%rbx
+    13d2:	            /-- 74 08                	je     13dc <main+0x28a>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    13d4:	            |   48 89 df             	mov    %rbx,%rdi
+    13d7:	            |   e8 54 fc ff ff       	call   1030 <free@plt>
+}
+    13dc:	            \-> 48 83 c4 48          	add    $0x48,%rsp
+    13e0:	                31 c0                	xor    %eax,%eax
+    13e2:	                5b                   	pop    %rbx
+    13e3:	                5d                   	pop    %rbp
+    13e4:	                41 5c                	pop    %r12
+    13e6:	                41 5d                	pop    %r13
+    13e8:	                41 5e                	pop    %r14
+    13ea:	                41 5f                	pop    %r15
+    13ec:	                c3                   	ret
+
+00000000000013ed <_GLOBAL__sub_I__close_r>:
+static Queue queue = Queue::empty();
+    13ed:	48 8d 15 54 4c 00 00 	lea    0x4c54(%rip),%rdx        # 6048 <__dso_handle>
+    13f4:	48 8d 35 85 4c 00 00 	lea    0x4c85(%rip),%rsi        # 6080 <queue>
+    13fb:	48 8d 3d c6 13 00 00 	lea    0x13c6(%rip),%rdi        # 27c8 <nel::heapless::Queue<int, 4096ul>::~Queue()>
+    1402:	e9 99 fc ff ff       	jmp    10a0 <__cxa_atexit@plt>
+    1407:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    140e:	00 00 
+
+0000000000001410 <_start>:
+    1410:	31 ed                	xor    %ebp,%ebp
+    1412:	49 89 d1             	mov    %rdx,%r9
+    1415:	5e                   	pop    %rsi
+    1416:	48 89 e2             	mov    %rsp,%rdx
+    1419:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    141d:	50                   	push   %rax
+    141e:	54                   	push   %rsp
+    141f:	45 31 c0             	xor    %r8d,%r8d
+    1422:	31 c9                	xor    %ecx,%ecx
+    1424:	48 8d 3d 27 fd ff ff 	lea    -0x2d9(%rip),%rdi        # 1152 <main>
+    142b:	ff 15 8f 4b 00 00    	call   *0x4b8f(%rip)        # 5fc0 <__libc_start_main@GLIBC_2.34>
+    1431:	f4                   	hlt
+    1432:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1439:	00 00 00 
+    143c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001440 <deregister_tm_clones>:
+    1440:	    48 8d 3d 09 4c 00 00 	lea    0x4c09(%rip),%rdi        # 6050 <__TMC_END__>
+    1447:	    48 8d 05 02 4c 00 00 	lea    0x4c02(%rip),%rax        # 6050 <__TMC_END__>
+    144e:	    48 39 f8             	cmp    %rdi,%rax
+    1451:	/-- 74 15                	je     1468 <deregister_tm_clones+0x28>
+    1453:	|   48 8b 05 6e 4b 00 00 	mov    0x4b6e(%rip),%rax        # 5fc8 <_ITM_deregisterTMCloneTable@Base>
+    145a:	|   48 85 c0             	test   %rax,%rax
+    145d:	+-- 74 09                	je     1468 <deregister_tm_clones+0x28>
+    145f:	|   ff e0                	jmp    *%rax
+    1461:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1468:	\-> c3                   	ret
+    1469:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001470 <register_tm_clones>:
+    1470:	    48 8d 3d d9 4b 00 00 	lea    0x4bd9(%rip),%rdi        # 6050 <__TMC_END__>
+    1477:	    48 8d 35 d2 4b 00 00 	lea    0x4bd2(%rip),%rsi        # 6050 <__TMC_END__>
+    147e:	    48 29 fe             	sub    %rdi,%rsi
+    1481:	    48 89 f0             	mov    %rsi,%rax
+    1484:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1488:	    48 c1 f8 03          	sar    $0x3,%rax
+    148c:	    48 01 c6             	add    %rax,%rsi
+    148f:	    48 d1 fe             	sar    %rsi
+    1492:	/-- 74 14                	je     14a8 <register_tm_clones+0x38>
+    1494:	|   48 8b 05 3d 4b 00 00 	mov    0x4b3d(%rip),%rax        # 5fd8 <_ITM_registerTMCloneTable@Base>
+    149b:	|   48 85 c0             	test   %rax,%rax
+    149e:	+-- 74 08                	je     14a8 <register_tm_clones+0x38>
+    14a0:	|   ff e0                	jmp    *%rax
+    14a2:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    14a8:	\-> c3                   	ret
+    14a9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000014b0 <__do_global_dtors_aux>:
+    14b0:	       f3 0f 1e fa          	endbr64
+    14b4:	       80 3d ad 4b 00 00 00 	cmpb   $0x0,0x4bad(%rip)        # 6068 <completed.0>
+    14bb:	/----- 75 2b                	jne    14e8 <__do_global_dtors_aux+0x38>
+    14bd:	|      55                   	push   %rbp
+    14be:	|      48 83 3d 1a 4b 00 00 	cmpq   $0x0,0x4b1a(%rip)        # 5fe0 <__cxa_finalize@GLIBC_2.2.5>
+    14c5:	|      00 
+    14c6:	|      48 89 e5             	mov    %rsp,%rbp
+    14c9:	|  /-- 74 0c                	je     14d7 <__do_global_dtors_aux+0x27>
+    14cb:	|  |   48 8b 3d 76 4b 00 00 	mov    0x4b76(%rip),%rdi        # 6048 <__dso_handle>
+    14d2:	|  |   e8 d9 fb ff ff       	call   10b0 <__cxa_finalize@plt>
+    14d7:	|  \-> e8 64 ff ff ff       	call   1440 <deregister_tm_clones>
+    14dc:	|      c6 05 85 4b 00 00 01 	movb   $0x1,0x4b85(%rip)        # 6068 <completed.0>
+    14e3:	|      5d                   	pop    %rbp
+    14e4:	|      c3                   	ret
+    14e5:	|      0f 1f 00             	nopl   (%rax)
+    14e8:	\----> c3                   	ret
+    14e9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000014f0 <frame_dummy>:
+    14f0:	f3 0f 1e fa          	endbr64
+    14f4:	e9 77 ff ff ff       	jmp    1470 <register_tm_clones>
+    14f9:	90                   	nop
+
+00000000000014fa <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    14fa:	83 c8 ff             	or     $0xffffffff,%eax
+    14fd:	c3                   	ret
+
+00000000000014fe <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    14fe:	83 c8 ff             	or     $0xffffffff,%eax
+    1501:	c3                   	ret
+
+0000000000001502 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    1502:	83 c8 ff             	or     $0xffffffff,%eax
+    1505:	c3                   	ret
+
+0000000000001506 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    1506:	83 c8 ff             	or     $0xffffffff,%eax
+    1509:	c3                   	ret
+
+000000000000150a <_read_r>:
+int _read_r(struct _reent *, int) {
+    150a:	83 c8 ff             	or     $0xffffffff,%eax
+    150d:	c3                   	ret
+
+000000000000150e <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    150e:	83 c8 ff             	or     $0xffffffff,%eax
+    1511:	c3                   	ret
+
+0000000000001512 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    1512:	83 c8 ff             	or     $0xffffffff,%eax
+    1515:	c3                   	ret
+
+0000000000001516 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1516:	83 c8 ff             	or     $0xffffffff,%eax
+    1519:	c3                   	ret
+
+000000000000151a <bench_map_first_n_fold(nel::Slice<int> const&)>:
+{
+    151a:	                41 57                	push   %r15
+    nel::Count const reps = n_total / s.len();
+    151c:	                b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    1521:	                31 d2                	xor    %edx,%edx
+{
+    1523:	                41 56                	push   %r14
+    Acc r = 0;
+    1525:	                45 31 f6             	xor    %r14d,%r14d
+{
+    1528:	                41 55                	push   %r13
+    152a:	                41 54                	push   %r12
+    152c:	                55                   	push   %rbp
+    152d:	                53                   	push   %rbx
+    152e:	                48 89 fb             	mov    %rdi,%rbx
+    1531:	                48 83 ec 28          	sub    $0x28,%rsp
+         *
+         * @returns number of elements in the slice.
+         */
+        constexpr Length len(void) const
+        {
+            return len_;
+    1535:	                48 8b 4f 08          	mov    0x8(%rdi),%rcx
+    nel::Count const reps = n_total / s.len();
+    1539:	                48 f7 f1             	div    %rcx
+    nel::Count const limit = s.len() - 1;
+    153c:	                4c 8d 61 ff          	lea    -0x1(%rcx),%r12
+    nel::Count const reps = n_total / s.len();
+    1540:	                48 89 c5             	mov    %rax,%rbp
+
+// Time a run of f(), in ns.
+template<typename F>
+long unsigned int time_ns(F &&f)
+{
+    long unsigned int const b = now_ns();
+    1543:	                e8 96 0e 00 00       	call   23de <bench::now_ns()>
+        for (nel::Index i = 0; i < reps; ++i) {
+    1548:	                31 d2                	xor    %edx,%edx
+    154a:	                49 89 c5             	mov    %rax,%r13
+    154d:	   /----------> 48 39 d5             	cmp    %rdx,%rbp
+    1550:	   |  /-------- 74 24                	je     1576 <bench_map_first_n_fold(nel::Slice<int> const&)+0x5c>
+    1552:	   |  |         48 8b 3b             	mov    (%rbx),%rdi
+        for (nel::Index i = 0; i < limit; ++i) {
+    1555:	   |  |         31 c0                	xor    %eax,%eax
+        Acc acc = 0;
+    1557:	   |  |         31 c9                	xor    %ecx,%ecx
+        for (nel::Index i = 0; i < limit; ++i) {
+    1559:	   |  |  /----> 4c 39 e0             	cmp    %r12,%rax
+    155c:	   |  |  |  /-- 73 10                	jae    156e <bench_map_first_n_fold(nel::Slice<int> const&)+0x54>
+            acc += Acc(p[i]) * 3;
+    155e:	   |  |  |  |   48 63 34 87          	movslq (%rdi,%rax,4),%rsi
+        for (nel::Index i = 0; i < limit; ++i) {
+    1562:	   |  |  |  |   48 ff c0             	inc    %rax
+            acc += Acc(p[i]) * 3;
+    1565:	   |  |  |  |   48 8d 34 76          	lea    (%rsi,%rsi,2),%rsi
+    1569:	   |  |  |  |   48 01 f1             	add    %rsi,%rcx
+        for (nel::Index i = 0; i < limit; ++i) {
+    156c:	   |  |  \--|-- eb eb                	jmp    1559 <bench_map_first_n_fold(nel::Slice<int> const&)+0x3f>
+            r += f(s);
+    156e:	   |  |     \-> 49 01 ce             	add    %rcx,%r14
+        for (nel::Index i = 0; i < reps; ++i) {
+    1571:	   |  |         48 ff c2             	inc    %rdx
+    1574:	   \--|-------- eb d7                	jmp    154d <bench_map_first_n_fold(nel::Slice<int> const&)+0x33>
+    f();
+    return now_ns() - b;
+    1576:	      \-------> e8 63 0e 00 00       	call   23de <bench::now_ns()>
+    sink = sink + r;
+    157b:	                48 8b 15 16 8b 00 00 	mov    0x8b16(%rip),%rdx        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    1582:	                48 8d 3d e5 1a 00 00 	lea    0x1ae5(%rip),%rdi        # 306e <_IO_stdin_used+0x6e>
+        for (nel::Index i = 0; i < reps; ++i) {
+    1589:	                45 31 ff             	xor    %r15d,%r15d
+    158c:	                4c 29 e8             	sub    %r13,%rax
+    sink = sink + r;
+    158f:	                4c 01 f2             	add    %r14,%rdx
+    1592:	                48 89 c6             	mov    %rax,%rsi
+    Acc r = 0;
+    1595:	                45 31 f6             	xor    %r14d,%r14d
+    sink = sink + r;
+    1598:	                48 89 15 f9 8a 00 00 	mov    %rdx,0x8af9(%rip)        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    159f:	                48 8b 53 08          	mov    0x8(%rbx),%rdx
+    15a3:	                48 0f af d5          	imul   %rbp,%rdx
+    15a7:	                e8 55 0e 00 00       	call   2401 <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    nel::Count const reps = n_total / s.len();
+    15ac:	                b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    15b1:	                31 d2                	xor    %edx,%edx
+    15b3:	                48 f7 73 08          	divq   0x8(%rbx)
+    15b7:	                48 89 c5             	mov    %rax,%rbp
+    long unsigned int const b = now_ns();
+    15ba:	                e8 1f 0e 00 00       	call   23de <bench::now_ns()>
+    15bf:	                49 89 c5             	mov    %rax,%r13
+        return s.iter()
+    15c2:	                48 8d 44 24 10       	lea    0x10(%rsp),%rax
+    15c7:	                48 89 44 24 08       	mov    %rax,0x8(%rsp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    15cc:	/-------------> 4c 39 fd             	cmp    %r15,%rbp
+    15cf:	|  /----------- 74 53                	je     1624 <bench_map_first_n_fold(nel::Slice<int> const&)+0x10a>
+        return s.iter()
+    15d1:	|  |            48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    15d6:	|  |            48 89 de             	mov    %rbx,%rsi
+    15d9:	|  |            e8 54 0f 00 00       	call   2532 <nel::Slice<int>::iter() const>
+        // template<typename U>
+        // U fold(U &&initial, std::function<void(U &acc, OutT e)> fn)
+        template<typename U, typename F>
+        U fold(U &&initial, F &&fn)
+        {
+            U acc = move(initial);
+    15de:	|  |            31 c0                	xor    %eax,%eax
+    public:
+        // Count inside inner's own loop, stopping it at the limit.
+        template<typename F>
+        void for_each(F &&fn)
+        {
+            if (current_ >= limit_) { return; }
+    15e0:	|  |            4d 85 e4             	test   %r12,%r12
+    15e3:	|  |  /-------- 74 37                	je     161c <bench_map_first_n_fold(nel::Slice<int> const&)+0x102>
+
+    public:
+        // move ok
+        SliceIterator(SliceIterator &&o)
+            : b_(move(o.b_))
+            , e_(move(o.e_))
+    15e5:	|  |  |         4c 8b 44 24 18       	mov    0x18(%rsp),%r8
+    15ea:	|  |  |         48 8b 54 24 10       	mov    0x10(%rsp),%rdx
+    15ef:	|  |  |         31 f6                	xor    %esi,%esi
+    15f1:	|  |  |         31 ff                	xor    %edi,%edi
+            while (!self().is_done()) {
+    15f3:	|  |  |     /-> 4c 39 c2             	cmp    %r8,%rdx
+    15f6:	|  |  |  /--|-- 74 1b                	je     1613 <bench_map_first_n_fold(nel::Slice<int> const&)+0xf9>
+            .map<Acc>([](int const &e) -> Acc { return Acc(e) * 3; })
+    15f8:	|  |  |  |  |   48 63 3a             	movslq (%rdx),%rdi
+                if (!fn(acc, forward<OutT>(e))) { return false; }
+    15fb:	|  |  |  |  |   48 ff c6             	inc    %rsi
+    15fe:	|  |  |  |  |   48 83 c2 04          	add    $0x4,%rdx
+    1602:	|  |  |  |  |   48 8d 3c 7f          	lea    (%rdi,%rdi,2),%rdi
+            .fold(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    1606:	|  |  |  |  |   48 01 f8             	add    %rdi,%rax
+    1609:	|  |  |  |  |   40 b7 01             	mov    $0x1,%dil
+    160c:	|  |  |  |  |   4c 39 e6             	cmp    %r12,%rsi
+    160f:	|  |  |  |  \-- 72 e2                	jb     15f3 <bench_map_first_n_fold(nel::Slice<int> const&)+0xd9>
+    1611:	|  |  +--|----- eb 09                	jmp    161c <bench_map_first_n_fold(nel::Slice<int> const&)+0x102>
+            U acc = move(initial);
+    1613:	|  |  |  \----> 31 d2                	xor    %edx,%edx
+    1615:	|  |  |         40 84 ff             	test   %dil,%dil
+    1618:	|  |  |         48 0f 44 c2          	cmove  %rdx,%rax
+            r += f(s);
+    161c:	|  |  \-------> 49 01 c6             	add    %rax,%r14
+        for (nel::Index i = 0; i < reps; ++i) {
+    161f:	|  |            49 ff c7             	inc    %r15
+    1622:	\--|----------- eb a8                	jmp    15cc <bench_map_first_n_fold(nel::Slice<int> const&)+0xb2>
+    return now_ns() - b;
+    1624:	   \----------> e8 b5 0d 00 00       	call   23de <bench::now_ns()>
+    sink = sink + r;
+    1629:	                48 8b 15 68 8a 00 00 	mov    0x8a68(%rip),%rdx        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    1630:	                48 8d 3d 53 1a 00 00 	lea    0x1a53(%rip),%rdi        # 308a <_IO_stdin_used+0x8a>
+        for (nel::Index i = 0; i < reps; ++i) {
+    1637:	                45 31 ff             	xor    %r15d,%r15d
+    163a:	                4c 29 e8             	sub    %r13,%rax
+    sink = sink + r;
+    163d:	                4c 01 f2             	add    %r14,%rdx
+    1640:	                48 89 c6             	mov    %rax,%rsi
+    Acc r = 0;
+    1643:	                45 31 f6             	xor    %r14d,%r14d
+    sink = sink + r;
+    1646:	                48 89 15 4b 8a 00 00 	mov    %rdx,0x8a4b(%rip)        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    164d:	                48 8b 53 08          	mov    0x8(%rbx),%rdx
+    1651:	                48 0f af d5          	imul   %rbp,%rdx
+    1655:	                e8 a7 0d 00 00       	call   2401 <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    nel::Count const reps = n_total / s.len();
+    165a:	                b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    165f:	                31 d2                	xor    %edx,%edx
+    1661:	                48 f7 73 08          	divq   0x8(%rbx)
+    1665:	                48 89 c5             	mov    %rax,%rbp
+    long unsigned int const b = now_ns();
+    1668:	                e8 71 0d 00 00       	call   23de <bench::now_ns()>
+    166d:	                49 89 c5             	mov    %rax,%r13
+        return s.iter()
+    1670:	                48 8d 44 24 10       	lea    0x10(%rsp),%rax
+    1675:	                48 89 44 24 08       	mov    %rax,0x8(%rsp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    167a:	   /----------> 4c 39 fd             	cmp    %r15,%rbp
+    167d:	   |  /-------- 74 33                	je     16b2 <bench_map_first_n_fold(nel::Slice<int> const&)+0x198>
+        return s.iter()
+    167f:	   |  |         48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    1684:	   |  |         48 89 de             	mov    %rbx,%rsi
+    1687:	   |  |         e8 a6 0e 00 00       	call   2532 <nel::Slice<int>::iter() const>
+            : b_(move(o.b_))
+    168c:	   |  |         48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+            , current_(0)
+    1691:	   |  |         31 c0                	xor    %eax,%eax
+            U acc = move(initial);
+    1693:	   |  |         31 c9                	xor    %ecx,%ecx
+            for (; !self().is_done(); self().inc()) {
+    1695:	   |  |  /----> 4c 39 e0             	cmp    %r12,%rax
+    1698:	   |  |  |  /-- 73 10                	jae    16aa <bench_map_first_n_fold(nel::Slice<int> const&)+0x190>
+            .map<Acc>([](int const &e) -> Acc { return Acc(e) * 3; })
+    169a:	   |  |  |  |   48 63 34 87          	movslq (%rdi,%rax,4),%rsi
+            ++current_;
+    169e:	   |  |  |  |   48 ff c0             	inc    %rax
+    16a1:	   |  |  |  |   48 8d 34 76          	lea    (%rsi,%rsi,2),%rsi
+            .fold2(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    16a5:	   |  |  |  |   48 01 f1             	add    %rsi,%rcx
+        }
+    16a8:	   |  |  \--|-- eb eb                	jmp    1695 <bench_map_first_n_fold(nel::Slice<int> const&)+0x17b>
+            r += f(s);
+    16aa:	   |  |     \-> 49 01 ce             	add    %rcx,%r14
+        for (nel::Index i = 0; i < reps; ++i) {
+    16ad:	   |  |         49 ff c7             	inc    %r15
+    16b0:	   \--|-------- eb c8                	jmp    167a <bench_map_first_n_fold(nel::Slice<int> const&)+0x160>
+    return now_ns() - b;
+    16b2:	      \-------> e8 27 0d 00 00       	call   23de <bench::now_ns()>
+    sink = sink + r;
+    16b7:	                48 8b 15 da 89 00 00 	mov    0x89da(%rip),%rdx        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    16be:	                48 8d 3d e1 19 00 00 	lea    0x19e1(%rip),%rdi        # 30a6 <_IO_stdin_used+0xa6>
+    16c5:	                4c 29 e8             	sub    %r13,%rax
+    sink = sink + r;
+    16c8:	                4c 01 f2             	add    %r14,%rdx
+    16cb:	                48 89 c6             	mov    %rax,%rsi
+    16ce:	                48 89 15 c3 89 00 00 	mov    %rdx,0x89c3(%rip)        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    16d5:	                48 8b 53 08          	mov    0x8(%rbx),%rdx
+}
+    16d9:	                48 83 c4 28          	add    $0x28,%rsp
+    16dd:	                5b                   	pop    %rbx
+    bench::report_per_item(name, t, reps * s.len());
+    16de:	                48 0f af d5          	imul   %rbp,%rdx
+}
+    16e2:	                5d                   	pop    %rbp
+    16e3:	                41 5c                	pop    %r12
+    16e5:	                41 5d                	pop    %r13
+    16e7:	                41 5e                	pop    %r14
+    16e9:	                41 5f                	pop    %r15
+    bench::report_per_item(name, t, reps * s.len());
+    16eb:	                e9 11 0d 00 00       	jmp    2401 <bench::report_per_item(char const*, unsigned long, unsigned long)>
+
+00000000000016f0 <bench_for_each(nel::Slice<int> const&)>:
+{
+    16f0:	             41 57                	push   %r15
+    nel::Count const reps = n_total / s.len();
+    16f2:	             b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    16f7:	             31 d2                	xor    %edx,%edx
+{
+    16f9:	             41 56                	push   %r14
+    16fb:	             41 55                	push   %r13
+    Acc r = 0;
+    16fd:	             45 31 ed             	xor    %r13d,%r13d
+{
+    1700:	             41 54                	push   %r12
+    1702:	             55                   	push   %rbp
+    1703:	             53                   	push   %rbx
+    1704:	             48 89 fb             	mov    %rdi,%rbx
+    1707:	             48 83 ec 68          	sub    $0x68,%rsp
+    nel::Count const reps = n_total / s.len();
+    170b:	             48 f7 77 08          	divq   0x8(%rdi)
+    170f:	             48 89 c5             	mov    %rax,%rbp
+    long unsigned int const b = now_ns();
+    1712:	             e8 c7 0c 00 00       	call   23de <bench::now_ns()>
+        for (nel::Index i = 0; i < reps; ++i) {
+    1717:	             31 d2                	xor    %edx,%edx
+    1719:	             49 89 c4             	mov    %rax,%r12
+    171c:	/----------> 48 39 d5             	cmp    %rdx,%rbp
+    171f:	|  /-------- 74 24                	je     1745 <bench_for_each(nel::Slice<int> const&)+0x55>
+            return content_;
+    1721:	|  |         48 8b 3b             	mov    (%rbx),%rdi
+            return len_;
+    1724:	|  |         48 8b 73 08          	mov    0x8(%rbx),%rsi
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    1728:	|  |         31 c0                	xor    %eax,%eax
+        Acc acc = 0;
+    172a:	|  |         31 c9                	xor    %ecx,%ecx
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    172c:	|  |  /----> 48 39 f0             	cmp    %rsi,%rax
+    172f:	|  |  |  /-- 74 0c                	je     173d <bench_for_each(nel::Slice<int> const&)+0x4d>
+            acc += Acc(p[i]);
+    1731:	|  |  |  |   4c 63 04 87          	movslq (%rdi,%rax,4),%r8
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    1735:	|  |  |  |   48 ff c0             	inc    %rax
+            acc += Acc(p[i]);
+    1738:	|  |  |  |   4c 01 c1             	add    %r8,%rcx
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    173b:	|  |  \--|-- eb ef                	jmp    172c <bench_for_each(nel::Slice<int> const&)+0x3c>
+            r += f(s);
+    173d:	|  |     \-> 49 01 cd             	add    %rcx,%r13
+        for (nel::Index i = 0; i < reps; ++i) {
+    1740:	|  |         48 ff c2             	inc    %rdx
+    1743:	\--|-------- eb d7                	jmp    171c <bench_for_each(nel::Slice<int> const&)+0x2c>
+    return now_ns() - b;
+    1745:	   \-------> e8 94 0c 00 00       	call   23de <bench::now_ns()>
+    sink = sink + r;
+    174a:	             48 8b 15 47 89 00 00 	mov    0x8947(%rip),%rdx        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    1751:	             48 8d 3d 6a 19 00 00 	lea    0x196a(%rip),%rdi        # 30c2 <_IO_stdin_used+0xc2>
+            : fn_name_(fn_name)
+    1758:	             4c 8d 3d 7f 19 00 00 	lea    0x197f(%rip),%r15        # 30de <_IO_stdin_used+0xde>
+    175f:	             4c 29 e0             	sub    %r12,%rax
+    sink = sink + r;
+    1762:	             4c 01 ea             	add    %r13,%rdx
+    1765:	             48 89 c6             	mov    %rax,%rsi
+        for (nel::Index i = 0; i < reps; ++i) {
+    1768:	             45 31 ed             	xor    %r13d,%r13d
+    sink = sink + r;
+    176b:	             48 89 15 26 89 00 00 	mov    %rdx,0x8926(%rip)        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    1772:	             48 8b 53 08          	mov    0x8(%rbx),%rdx
+    1776:	             48 0f af d5          	imul   %rbp,%rdx
+    Acc r = 0;
+    177a:	             31 ed                	xor    %ebp,%ebp
+    bench::report_per_item(name, t, reps * s.len());
+    177c:	             e8 80 0c 00 00       	call   2401 <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    nel::Count const reps = n_total / s.len();
+    1781:	             b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    1786:	             31 d2                	xor    %edx,%edx
+    1788:	             48 f7 73 08          	divq   0x8(%rbx)
+    178c:	             48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    long unsigned int const b = now_ns();
+    1791:	             e8 48 0c 00 00       	call   23de <bench::now_ns()>
+    1796:	             49 89 c4             	mov    %rax,%r12
+        for (nel::Index i = 0; i < reps; ++i) {
+    1799:	   /-------> 4c 39 6c 24 10       	cmp    %r13,0x10(%rsp)
+    179e:	/--|-------- 0f 84 8c 00 00 00    	je     1830 <bench_for_each(nel::Slice<int> const&)+0x140>
+        s.iter().for_each([&acc](int const &e) { acc += Acc(e); });
+    17a4:	|  |         48 8d 44 24 28       	lea    0x28(%rsp),%rax
+    17a9:	|  |         48 89 de             	mov    %rbx,%rsi
+        Acc acc = 0;
+    17ac:	|  |         45 31 f6             	xor    %r14d,%r14d
+        s.iter().for_each([&acc](int const &e) { acc += Acc(e); });
+    17af:	|  |         48 89 c7             	mov    %rax,%rdi
+    17b2:	|  |         48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    17b7:	|  |         e8 76 0d 00 00       	call   2532 <nel::Slice<int>::iter() const>
+                Optional<OutT> r = self().next();
+    17bc:	|  |  /----> 48 8d 44 24 38       	lea    0x38(%rsp),%rax
+    17c1:	|  |  |      48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    17c6:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    17c9:	|  |  |      48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    17ce:	|  |  |      e8 bb 0e 00 00       	call   268e <nel::SliceIterator<int>::next()>
+                if (r.is_none()) { break; }
+    17d3:	|  |  |      48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    17d8:	|  |  |      e8 c1 0c 00 00       	call   249e <nel::Optional<int&>::is_none() const>
+    17dd:	|  |  |      84 c0                	test   %al,%al
+    17df:	|  |  |  /-- 75 3a                	jne    181b <bench_for_each(nel::Slice<int> const&)+0x12b>
+                fn(r.unwrap());
+    17e1:	|  |  |  |   48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    17e6:	|  |  |  |   48 8d 74 24 48       	lea    0x48(%rsp),%rsi
+            , file_name_(file_name)
+    17eb:	|  |  |  |   48 8d 05 56 19 00 00 	lea    0x1956(%rip),%rax        # 3148 <_IO_stdin_used+0x148>
+            : fn_name_(fn_name)
+    17f2:	|  |  |  |   4c 89 7c 24 48       	mov    %r15,0x48(%rsp)
+            , file_name_(file_name)
+    17f7:	|  |  |  |   48 89 44 24 50       	mov    %rax,0x50(%rsp)
+            , line_num_(line_num)
+    17fc:	|  |  |  |   c7 44 24 58 ef 00 00 	movl   $0xef,0x58(%rsp)
+    1803:	|  |  |  |   00 
+    1804:	|  |  |  |   e8 af 0d 00 00       	call   25b8 <nel::Optional<int&>::unwrap(nel::Context const&)>
+            while (true) {
+    1809:	|  |  |  |   48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    180e:	|  |  |  |   48 63 00             	movslq (%rax),%rax
+    1811:	|  |  |  |   49 01 c6             	add    %rax,%r14
+    1814:	|  |  |  |   e8 63 0d 00 00       	call   257c <nel::Optional<int&>::~Optional()>
+    1819:	|  |  \--|-- eb a1                	jmp    17bc <bench_for_each(nel::Slice<int> const&)+0xcc>
+    181b:	|  |     \-> 48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+            r += f(s);
+    1820:	|  |         4c 01 f5             	add    %r14,%rbp
+        for (nel::Index i = 0; i < reps; ++i) {
+    1823:	|  |         49 ff c5             	inc    %r13
+    1826:	|  |         e8 51 0d 00 00       	call   257c <nel::Optional<int&>::~Optional()>
+    182b:	|  \-------- e9 69 ff ff ff       	jmp    1799 <bench_for_each(nel::Slice<int> const&)+0xa9>
+    return now_ns() - b;
+    1830:	\----------> e8 a9 0b 00 00       	call   23de <bench::now_ns()>
+    Acc r = 0;
+    1835:	             45 31 ed             	xor    %r13d,%r13d
+        for (nel::Index i = 0; i < reps; ++i) {
+    1838:	             45 31 ff             	xor    %r15d,%r15d
+        s.iter().for_each2([&acc](int const &e) { acc += Acc(e); });
+    183b:	             4c 8d 74 24 48       	lea    0x48(%rsp),%r14
+    sink = sink + r;
+    1840:	             48 8b 15 51 88 00 00 	mov    0x8851(%rip),%rdx        # a098 <sink>
+    1847:	             4c 29 e0             	sub    %r12,%rax
+    bench::report_per_item(name, t, reps * s.len());
+    184a:	             48 8d 3d 0b 19 00 00 	lea    0x190b(%rip),%rdi        # 315c <_IO_stdin_used+0x15c>
+    1851:	             48 89 c6             	mov    %rax,%rsi
+    sink = sink + r;
+    1854:	             48 01 d5             	add    %rdx,%rbp
+    bench::report_per_item(name, t, reps * s.len());
+    1857:	             48 8b 54 24 10       	mov    0x10(%rsp),%rdx
+    185c:	             48 0f af 53 08       	imul   0x8(%rbx),%rdx
+    sink = sink + r;
+    1861:	             48 89 2d 30 88 00 00 	mov    %rbp,0x8830(%rip)        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    1868:	             e8 94 0b 00 00       	call   2401 <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    nel::Count const reps = n_total / s.len();
+    186d:	             b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    1872:	             31 d2                	xor    %edx,%edx
+    1874:	             48 f7 73 08          	divq   0x8(%rbx)
+    1878:	             48 89 c5             	mov    %rax,%rbp
+    long unsigned int const b = now_ns();
+    187b:	             e8 5e 0b 00 00       	call   23de <bench::now_ns()>
+    1880:	             49 89 c4             	mov    %rax,%r12
+        for (nel::Index i = 0; i < reps; ++i) {
+    1883:	/----------> 4c 39 fd             	cmp    %r15,%rbp
+    1886:	|  /-------- 74 30                	je     18b8 <bench_for_each(nel::Slice<int> const&)+0x1c8>
+        s.iter().for_each2([&acc](int const &e) { acc += Acc(e); });
+    1888:	|  |         48 89 de             	mov    %rbx,%rsi
+    188b:	|  |         4c 89 f7             	mov    %r14,%rdi
+    188e:	|  |         e8 9f 0c 00 00       	call   2532 <nel::Slice<int>::iter() const>
+        void for_each2(F &&fn)
+    1893:	|  |         48 8b 44 24 48       	mov    0x48(%rsp),%rax
+    1898:	|  |         48 8b 4c 24 50       	mov    0x50(%rsp),%rcx
+        Acc acc = 0;
+    189d:	|  |         31 d2                	xor    %edx,%edx
+            for (; !self().is_done(); self().inc()) {
+    189f:	|  |  /----> 48 39 c8             	cmp    %rcx,%rax
+    18a2:	|  |  |  /-- 74 0c                	je     18b0 <bench_for_each(nel::Slice<int> const&)+0x1c0>
+        s.iter().for_each2([&acc](int const &e) { acc += Acc(e); });
+    18a4:	|  |  |  |   48 63 30             	movslq (%rax),%rsi
+    18a7:	|  |  |  |   48 83 c0 04          	add    $0x4,%rax
+    18ab:	|  |  |  |   48 01 f2             	add    %rsi,%rdx
+        }
+
+        void inc(void)
+        {
+            ++b_;
+        }
+    18ae:	|  |  \--|-- eb ef                	jmp    189f <bench_for_each(nel::Slice<int> const&)+0x1af>
+            r += f(s);
+    18b0:	|  |     \-> 49 01 d5             	add    %rdx,%r13
+        for (nel::Index i = 0; i < reps; ++i) {
+    18b3:	|  |         49 ff c7             	inc    %r15
+    18b6:	\--|-------- eb cb                	jmp    1883 <bench_for_each(nel::Slice<int> const&)+0x193>
+    return now_ns() - b;
+    18b8:	   \-------> e8 21 0b 00 00       	call   23de <bench::now_ns()>
+    sink = sink + r;
+    18bd:	             48 8b 15 d4 87 00 00 	mov    0x87d4(%rip),%rdx        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    18c4:	             48 8d 3d ad 18 00 00 	lea    0x18ad(%rip),%rdi        # 3178 <_IO_stdin_used+0x178>
+    18cb:	             4c 29 e0             	sub    %r12,%rax
+    sink = sink + r;
+    18ce:	             4c 01 ea             	add    %r13,%rdx
+    18d1:	             48 89 c6             	mov    %rax,%rsi
+    18d4:	             48 89 15 bd 87 00 00 	mov    %rdx,0x87bd(%rip)        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    18db:	             48 8b 53 08          	mov    0x8(%rbx),%rdx
+}
+    18df:	             48 83 c4 68          	add    $0x68,%rsp
+    18e3:	             5b                   	pop    %rbx
+    bench::report_per_item(name, t, reps * s.len());
+    18e4:	             48 0f af d5          	imul   %rbp,%rdx
+}
+    18e8:	             5d                   	pop    %rbp
+    18e9:	             41 5c                	pop    %r12
+    18eb:	             41 5d                	pop    %r13
+    18ed:	             41 5e                	pop    %r14
+    18ef:	             41 5f                	pop    %r15
+    bench::report_per_item(name, t, reps * s.len());
+    18f1:	             e9 0b 0b 00 00       	jmp    2401 <bench::report_per_item(char const*, unsigned long, unsigned long)>
+
+00000000000018f6 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)>:
+        void for_each(F &&fn)
+    18f6:	       41 55                	push   %r13
+            : fn_name_(fn_name)
+    18f8:	       4c 8d 2d 95 18 00 00 	lea    0x1895(%rip),%r13        # 3194 <_IO_stdin_used+0x194>
+    18ff:	       41 54                	push   %r12
+    1901:	       49 89 fc             	mov    %rdi,%r12
+    1904:	       55                   	push   %rbp
+    1905:	       48 89 f5             	mov    %rsi,%rbp
+    1908:	       53                   	push   %rbx
+    1909:	       48 83 ec 38          	sub    $0x38,%rsp
+                Optional<OutT> r = self().next();
+    190d:	/----> 48 8d 5c 24 08       	lea    0x8(%rsp),%rbx
+    1912:	|      4c 89 e6             	mov    %r12,%rsi
+    1915:	|      48 89 df             	mov    %rbx,%rdi
+    1918:	|      e8 71 0d 00 00       	call   268e <nel::SliceIterator<int>::next()>
+                if (r.is_none()) { break; }
+    191d:	|      48 89 df             	mov    %rbx,%rdi
+    1920:	|      e8 79 0b 00 00       	call   249e <nel::Optional<int&>::is_none() const>
+    1925:	|      84 c0                	test   %al,%al
+    1927:	|  /-- 75 3a                	jne    1963 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)+0x6d>
+                fn(r.unwrap());
+    1929:	|  |   48 89 df             	mov    %rbx,%rdi
+    192c:	|  |   48 8d 74 24 18       	lea    0x18(%rsp),%rsi
+            , file_name_(file_name)
+    1931:	|  |   48 8d 05 10 18 00 00 	lea    0x1810(%rip),%rax        # 3148 <_IO_stdin_used+0x148>
+            : fn_name_(fn_name)
+    1938:	|  |   4c 89 6c 24 18       	mov    %r13,0x18(%rsp)
+            , file_name_(file_name)
+    193d:	|  |   48 89 44 24 20       	mov    %rax,0x20(%rsp)
+            , line_num_(line_num)
+    1942:	|  |   c7 44 24 28 ef 00 00 	movl   $0xef,0x28(%rsp)
+    1949:	|  |   00 
+    194a:	|  |   e8 69 0c 00 00       	call   25b8 <nel::Optional<int&>::unwrap(nel::Context const&)>
+    194f:	|  |   48 8b 4d 00          	mov    0x0(%rbp),%rcx
+            while (true) {
+    1953:	|  |   48 89 df             	mov    %rbx,%rdi
+            acc += Acc(e);
+    1956:	|  |   48 63 10             	movslq (%rax),%rdx
+    1959:	|  |   48 01 11             	add    %rdx,(%rcx)
+    195c:	|  |   e8 1b 0c 00 00       	call   257c <nel::Optional<int&>::~Optional()>
+    1961:	\--|-- eb aa                	jmp    190d <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)+0x17>
+    1963:	   \-> 48 89 df             	mov    %rbx,%rdi
+    1966:	       e8 11 0c 00 00       	call   257c <nel::Optional<int&>::~Optional()>
+        }
+    196b:	       48 83 c4 38          	add    $0x38,%rsp
+    196f:	       5b                   	pop    %rbx
+    1970:	       5d                   	pop    %rbp
+    1971:	       41 5c                	pop    %r12
+    1973:	       41 5d                	pop    %r13
+    1975:	       c3                   	ret
+
+0000000000001976 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&)>:
+        void for_each(F &&fn)
+    1976:	       41 55                	push   %r13
+            : fn_name_(fn_name)
+    1978:	       4c 8d 2d 7c 18 00 00 	lea    0x187c(%rip),%r13        # 31fb <_IO_stdin_used+0x1fb>
+    197f:	       41 54                	push   %r12
+    1981:	       49 89 fc             	mov    %rdi,%r12
+    1984:	       55                   	push   %rbp
+    1985:	       48 89 f5             	mov    %rsi,%rbp
+    1988:	       53                   	push   %rbx
+    1989:	       48 83 ec 38          	sub    $0x38,%rsp
+                Optional<OutT> r = self().next();
+    198d:	/----> 48 8d 5c 24 08       	lea    0x8(%rsp),%rbx
+    1992:	|      4c 89 e6             	mov    %r12,%rsi
+    1995:	|      48 89 df             	mov    %rbx,%rdi
+    1998:	|      e8 f1 0c 00 00       	call   268e <nel::SliceIterator<int>::next()>
+                if (r.is_none()) { break; }
+    199d:	|      48 89 df             	mov    %rbx,%rdi
+    19a0:	|      e8 f9 0a 00 00       	call   249e <nel::Optional<int&>::is_none() const>
+    19a5:	|      84 c0                	test   %al,%al
+    19a7:	|  /-- 75 3a                	jne    19e3 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&)+0x6d>
+                fn(r.unwrap());
+    19a9:	|  |   48 89 df             	mov    %rbx,%rdi
+    19ac:	|  |   48 8d 74 24 18       	lea    0x18(%rsp),%rsi
+            , file_name_(file_name)
+    19b1:	|  |   48 8d 05 90 17 00 00 	lea    0x1790(%rip),%rax        # 3148 <_IO_stdin_used+0x148>
+            : fn_name_(fn_name)
+    19b8:	|  |   4c 89 6c 24 18       	mov    %r13,0x18(%rsp)
+            , file_name_(file_name)
+    19bd:	|  |   48 89 44 24 20       	mov    %rax,0x20(%rsp)
+            , line_num_(line_num)
+    19c2:	|  |   c7 44 24 28 ef 00 00 	movl   $0xef,0x28(%rsp)
+    19c9:	|  |   00 
+    19ca:	|  |   e8 e9 0b 00 00       	call   25b8 <nel::Optional<int&>::unwrap(nel::Context const&)>
+    19cf:	|  |   48 8b 4d 00          	mov    0x0(%rbp),%rcx
+            while (true) {
+    19d3:	|  |   48 89 df             	mov    %rbx,%rdi
+        q.iter().for_each([&acc](int const &e) { acc += Acc(e); });
+    19d6:	|  |   48 63 10             	movslq (%rax),%rdx
+    19d9:	|  |   48 01 11             	add    %rdx,(%rcx)
+    19dc:	|  |   e8 9b 0b 00 00       	call   257c <nel::Optional<int&>::~Optional()>
+    19e1:	\--|-- eb aa                	jmp    198d <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&)+0x17>
+    19e3:	   \-> 48 89 df             	mov    %rbx,%rdi
+    19e6:	       e8 91 0b 00 00       	call   257c <nel::Optional<int&>::~Optional()>
+        }
+    19eb:	       48 83 c4 38          	add    $0x38,%rsp
+    19ef:	       5b                   	pop    %rbx
+    19f0:	       5d                   	pop    %rbp
+    19f1:	       41 5c                	pop    %r12
+    19f3:	       41 5d                	pop    %r13
+    19f5:	       c3                   	ret
+
+00000000000019f6 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::for_each<nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(int&)#1}&>(unsigned long&&)>:
+        void for_each(F &&fn)
+    19f6:	       41 55                	push   %r13
+            : fn_name_(fn_name)
+    19f8:	       4c 8d 2d 53 18 00 00 	lea    0x1853(%rip),%r13        # 3252 <_IO_stdin_used+0x252>
+    19ff:	       41 54                	push   %r12
+    1a01:	       49 89 fc             	mov    %rdi,%r12
+    1a04:	       55                   	push   %rbp
+    1a05:	       48 89 f5             	mov    %rsi,%rbp
+    1a08:	       53                   	push   %rbx
+    1a09:	       48 83 ec 38          	sub    $0x38,%rsp
+                Optional<OutT> r = self().next();
+    1a0d:	/----> 48 8d 5c 24 08       	lea    0x8(%rsp),%rbx
+    1a12:	|      4c 89 e6             	mov    %r12,%rsi
+    1a15:	|      48 89 df             	mov    %rbx,%rdi
+    1a18:	|      e8 71 0c 00 00       	call   268e <nel::SliceIterator<int>::next()>
+                if (r.is_none()) { break; }
+    1a1d:	|      48 89 df             	mov    %rbx,%rdi
+    1a20:	|      e8 79 0a 00 00       	call   249e <nel::Optional<int&>::is_none() const>
+    1a25:	|      84 c0                	test   %al,%al
+    1a27:	|  /-- 75 40                	jne    1a69 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::for_each<nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(int&)#1}&>(unsigned long&&)+0x73>
+                fn(r.unwrap());
+    1a29:	|  |   48 89 df             	mov    %rbx,%rdi
+    1a2c:	|  |   48 8d 74 24 18       	lea    0x18(%rsp),%rsi
+            , file_name_(file_name)
+    1a31:	|  |   48 8d 05 10 17 00 00 	lea    0x1710(%rip),%rax        # 3148 <_IO_stdin_used+0x148>
+            : fn_name_(fn_name)
+    1a38:	|  |   4c 89 6c 24 18       	mov    %r13,0x18(%rsp)
+            , file_name_(file_name)
+    1a3d:	|  |   48 89 44 24 20       	mov    %rax,0x20(%rsp)
+            , line_num_(line_num)
+    1a42:	|  |   c7 44 24 28 ef 00 00 	movl   $0xef,0x28(%rsp)
+    1a49:	|  |   00 
+    1a4a:	|  |   e8 69 0b 00 00       	call   25b8 <nel::Optional<int&>::unwrap(nel::Context const&)>
+            while (true) {
+    1a4f:	|  |   48 89 df             	mov    %rbx,%rdi
+                fn(r.unwrap());
+    1a52:	|  |   48 89 c2             	mov    %rax,%rdx
+            .map<Acc>([](int const &e) -> Acc { return Acc(e); })
+    1a55:	|  |   48 8b 45 08          	mov    0x8(%rbp),%rax
+    1a59:	|  |   48 63 12             	movslq (%rdx),%rdx
+    1a5c:	|  |   48 8b 00             	mov    (%rax),%rax
+            .fold(Acc(0), [](Acc &acc, Acc const &e) { acc += e; });
+    1a5f:	|  |   48 01 10             	add    %rdx,(%rax)
+            while (true) {
+    1a62:	|  |   e8 15 0b 00 00       	call   257c <nel::Optional<int&>::~Optional()>
+    1a67:	\--|-- eb a4                	jmp    1a0d <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::for_each<nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(int&)#1}&>(unsigned long&&)+0x17>
+    1a69:	   \-> 48 89 df             	mov    %rbx,%rdi
+    1a6c:	       e8 0b 0b 00 00       	call   257c <nel::Optional<int&>::~Optional()>
+        }
+    1a71:	       48 83 c4 38          	add    $0x38,%rsp
+    1a75:	       5b                   	pop    %rbx
+    1a76:	       5d                   	pop    %rbp
+    1a77:	       41 5c                	pop    %r12
+    1a79:	       41 5d                	pop    %r13
+    1a7b:	       c3                   	ret
+
+0000000000001a7c <bench_queue(nel::Slice<int> const&)>:
+{
+    1a7c:	             41 57                	push   %r15
+    1a7e:	             41 56                	push   %r14
+    1a80:	             41 55                	push   %r13
+    for (nel::Index i = 0; i < queue_len + queue_len / 2; ++i) {
+    1a82:	             45 31 ed             	xor    %r13d,%r13d
+{
+    1a85:	             41 54                	push   %r12
+         *
+         * @returns true if queue is full, false otherwise.
+         */
+        constexpr bool is_full(void) const
+        {
+            return len_ == N;
+    1a87:	             4c 8d 25 f2 45 00 00 	lea    0x45f2(%rip),%r12        # 6080 <queue>
+    1a8e:	             55                   	push   %rbp
+    1a8f:	             48 89 fd             	mov    %rdi,%rbp
+    1a92:	             53                   	push   %rbx
+    1a93:	             48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+        queue.push(int(i % 1000)).unwrap();
+    1a9a:	   /-------> b9 e8 03 00 00       	mov    $0x3e8,%ecx
+    1a9f:	   |         4c 89 e8             	mov    %r13,%rax
+    1aa2:	   |         31 d2                	xor    %edx,%edx
+    1aa4:	   |         48 f7 f1             	div    %rcx
+#    else
+            if (is_full()) {
+                // here , rp_ == wp_.
+                rp_ += 1;
+                if (rp_ >= capacity()) { rp_ = 0; }
+                *ptr(wp_) = move(val);
+    1aa7:	   |         48 8b 05 da 45 00 00 	mov    0x45da(%rip),%rax        # 6088 <queue+0x8>
+            return len_ == N;
+    1aae:	   |         49 8b 0c 24          	mov    (%r12),%rcx
+            return &ptr()[d];
+    1ab2:	   |         48 8d 35 df 45 00 00 	lea    0x45df(%rip),%rsi        # 6098 <queue+0x18>
+    1ab9:	   |         48 8d 34 86          	lea    (%rsi,%rax,4),%rsi
+            if (is_full()) {
+    1abd:	   |         48 81 f9 00 10 00 00 	cmp    $0x1000,%rcx
+    1ac4:	   |  /----- 75 1f                	jne    1ae5 <bench_queue(nel::Slice<int> const&)+0x69>
+                rp_ += 1;
+    1ac6:	   |  |      48 8b 1d c3 45 00 00 	mov    0x45c3(%rip),%rbx        # 6090 <queue+0x10>
+    1acd:	   |  |      48 8d 4b 01          	lea    0x1(%rbx),%rcx
+                if (rp_ >= capacity()) { rp_ = 0; }
+    1ad1:	   |  |      48 81 f9 ff 0f 00 00 	cmp    $0xfff,%rcx
+    1ad8:	   |  |  /-- 76 02                	jbe    1adc <bench_queue(nel::Slice<int> const&)+0x60>
+    1ada:	   |  |  |   31 c9                	xor    %ecx,%ecx
+    1adc:	   |  |  \-> 48 89 0d ad 45 00 00 	mov    %rcx,0x45ad(%rip)        # 6090 <queue+0x10>
+
+        // private:
+    public:
+        // only if you know there's a value there..
+        // TODO: must have no bare pointers.. safety feature.
+        constexpr Type *ptr()
+    1ae3:	   |  |  /-- eb 07                	jmp    1aec <bench_queue(nel::Slice<int> const&)+0x70>
+            } else {
+                len_ += 1;
+    1ae5:	   |  \--|-> 48 ff c1             	inc    %rcx
+    1ae8:	   |     |   49 89 0c 24          	mov    %rcx,(%r12)
+                new (ptr(wp_)) Type(move(val));
+            }
+            wp_ += 1;
+    1aec:	   |     \-> 48 ff c0             	inc    %rax
+                *ptr(wp_) = move(val);
+    1aef:	   |         89 16                	mov    %edx,(%rsi)
+            if (wp_ >= capacity()) { wp_ = 0; }
+    1af1:	   |         48 3d ff 0f 00 00    	cmp    $0xfff,%rax
+    1af7:	   |     /-- 76 02                	jbe    1afb <bench_queue(nel::Slice<int> const&)+0x7f>
+    1af9:	   |     |   31 c0                	xor    %eax,%eax
+    1afb:	   |     \-> 48 89 05 86 45 00 00 	mov    %rax,0x4586(%rip)        # 6088 <queue+0x8>
+    for (nel::Index i = 0; i < queue_len + queue_len / 2; ++i) {
+    1b02:	   |         49 ff c5             	inc    %r13
+            : fn_name_(fn_name)
+    1b05:	   |         48 8d 05 42 1d 00 00 	lea    0x1d42(%rip),%rax        # 384e <_IO_stdin_used+0x84e>
+        queue.push(int(i % 1000)).unwrap();
+    1b0c:	   |         48 8d 9c 24 88 00 00 	lea    0x88(%rsp),%rbx
+    1b13:	   |         00 
+    1b14:	   |         48 89 84 24 88 00 00 	mov    %rax,0x88(%rsp)
+    1b1b:	   |         00 
+    1b1c:	   |         48 89 de             	mov    %rbx,%rsi
+            , file_name_(file_name)
+    1b1f:	   |         48 8d 05 34 1d 00 00 	lea    0x1d34(%rip),%rax        # 385a <_IO_stdin_used+0x85a>
+    1b26:	   |         48 89 84 24 90 00 00 	mov    %rax,0x90(%rsp)
+    1b2d:	   |         00 
+    1b2e:	   |         48 8d 44 24 68       	lea    0x68(%rsp),%rax
+    1b33:	   |         48 89 c7             	mov    %rax,%rdi
+    1b36:	   |         48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1b3b:	   |         c7 44 24 68 01 00 00 	movl   $0x1,0x68(%rsp)
+    1b42:	   |         00 
+            , line_num_(line_num)
+    1b43:	   |         c7 84 24 98 00 00 00 	movl   $0xb0,0x98(%rsp)
+    1b4a:	   |         b0 00 00 00 
+    1b4e:	   |         e8 d9 0a 00 00       	call   262c <nel::Result<void, int>::unwrap(nel::Context const&)>
+    1b53:	   |         48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    1b58:	   |         e8 93 0a 00 00       	call   25f0 <nel::Result<void, int>::~Result()>
+    for (nel::Index i = 0; i < queue_len + queue_len / 2; ++i) {
+    1b5d:	   |         49 81 fd 00 18 00 00 	cmp    $0x1800,%r13
+    1b64:	   \-------- 0f 85 30 ff ff ff    	jne    1a9a <bench_queue(nel::Slice<int> const&)+0x1e>
+    auto flat = s.slice(0, queue_len);
+    1b6a:	             48 89 ee             	mov    %rbp,%rsi
+    1b6d:	             48 8d 7c 24 38       	lea    0x38(%rsp),%rdi
+    1b72:	             b9 00 10 00 00       	mov    $0x1000,%ecx
+    1b77:	             31 d2                	xor    %edx,%edx
+    1b79:	             e8 ca 09 00 00       	call   2548 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+            return len_;
+    1b7e:	             48 8b 6c 24 40       	mov    0x40(%rsp),%rbp
+    nel::Count const reps = n_total / s.len();
+    1b83:	             31 d2                	xor    %edx,%edx
+    Acc r = 0;
+    1b85:	             45 31 ff             	xor    %r15d,%r15d
+    nel::Count const reps = n_total / s.len();
+    1b88:	             b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    1b8d:	             48 f7 f5             	div    %rbp
+    1b90:	             49 89 c5             	mov    %rax,%r13
+    long unsigned int const b = now_ns();
+    1b93:	             e8 46 08 00 00       	call   23de <bench::now_ns()>
+            return content_;
+    1b98:	             48 8b 74 24 38       	mov    0x38(%rsp),%rsi
+        for (nel::Index i = 0; i < reps; ++i) {
+    1b9d:	             31 d2                	xor    %edx,%edx
+    1b9f:	             49 89 c6             	mov    %rax,%r14
+    1ba2:	/----------> 49 39 d5             	cmp    %rdx,%r13
+    1ba5:	|  /-------- 74 1d                	je     1bc4 <bench_queue(nel::Slice<int> const&)+0x148>
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    1ba7:	|  |         31 c0                	xor    %eax,%eax
+        Acc acc = 0;
+    1ba9:	|  |         31 c9                	xor    %ecx,%ecx
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    1bab:	|  |  /----> 48 39 c5             	cmp    %rax,%rbp
+    1bae:	|  |  |  /-- 74 0c                	je     1bbc <bench_queue(nel::Slice<int> const&)+0x140>
+            acc += Acc(p[i]);
+    1bb0:	|  |  |  |   48 63 3c 86          	movslq (%rsi,%rax,4),%rdi
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    1bb4:	|  |  |  |   48 ff c0             	inc    %rax
+            acc += Acc(p[i]);
+    1bb7:	|  |  |  |   48 01 f9             	add    %rdi,%rcx
+        for (nel::Index i = 0; i < s.len(); ++i) {
+    1bba:	|  |  \--|-- eb ef                	jmp    1bab <bench_queue(nel::Slice<int> const&)+0x12f>
+            r += f(s);
+    1bbc:	|  |     \-> 49 01 cf             	add    %rcx,%r15
+        for (nel::Index i = 0; i < reps; ++i) {
+    1bbf:	|  |         48 ff c2             	inc    %rdx
+    1bc2:	\--|-------- eb de                	jmp    1ba2 <bench_queue(nel::Slice<int> const&)+0x126>
+    return now_ns() - b;
+    1bc4:	   \-------> e8 15 08 00 00       	call   23de <bench::now_ns()>
+    sink = sink + r;
+    1bc9:	             48 8b 15 c8 84 00 00 	mov    0x84c8(%rip),%rdx        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    1bd0:	             48 8d 3d 9e 1c 00 00 	lea    0x1c9e(%rip),%rdi        # 3875 <_IO_stdin_used+0x875>
+    1bd7:	             4c 29 f0             	sub    %r14,%rax
+        q.iter().for_each([&acc](int const &e) { acc += Acc(e); });
+    1bda:	             4c 8d 74 24 58       	lea    0x58(%rsp),%r14
+    sink = sink + r;
+    1bdf:	             4c 01 fa             	add    %r15,%rdx
+    1be2:	             48 89 c6             	mov    %rax,%rsi
+    Acc r = 0;
+    1be5:	             45 31 ff             	xor    %r15d,%r15d
+    sink = sink + r;
+    1be8:	             48 89 15 a9 84 00 00 	mov    %rdx,0x84a9(%rip)        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    1bef:	             48 89 ea             	mov    %rbp,%rdx
+    long unsigned int const b = now_ns();
+    1bf2:	             bd 09 3d 00 00       	mov    $0x3d09,%ebp
+    1bf7:	             49 0f af d5          	imul   %r13,%rdx
+    1bfb:	             e8 01 08 00 00       	call   2401 <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    1c00:	             e8 d9 07 00 00       	call   23de <bench::now_ns()>
+    1c05:	             49 89 c5             	mov    %rax,%r13
+        Acc acc = 0;
+    1c08:	         /-> 31 d2                	xor    %edx,%edx
+        q.iter().for_each([&acc](int const &e) { acc += Acc(e); });
+    1c0a:	         |   4c 89 e6             	mov    %r12,%rsi
+    1c0d:	         |   48 89 df             	mov    %rbx,%rdi
+        Acc acc = 0;
+    1c10:	         |   48 89 54 24 58       	mov    %rdx,0x58(%rsp)
+        q.iter().for_each([&acc](int const &e) { acc += Acc(e); });
+    1c15:	         |   e8 ca 0a 00 00       	call   26e4 <nel::heapless::Queue<int, 4096ul>::iter()>
+         */
+        // void for_each(std::function<void(OutT)> fn)
+        template<typename F>
+        void for_each(F &&fn)
+        {
+            it1_.for_each(fn);
+    1c1a:	         |   48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    1c1f:	         |   48 89 df             	mov    %rbx,%rdi
+    1c22:	         |   4c 89 74 24 68       	mov    %r14,0x68(%rsp)
+    1c27:	         |   e8 4a fd ff ff       	call   1976 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&)>
+            it2_.for_each(fn);
+    1c2c:	         |   48 8d 84 24 98 00 00 	lea    0x98(%rsp),%rax
+    1c33:	         |   00 
+    1c34:	         |   48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    1c39:	         |   48 89 c7             	mov    %rax,%rdi
+    1c3c:	         |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    1c41:	         |   e8 30 fd ff ff       	call   1976 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&>(bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#2}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}&)>
+            r += f(queue);
+    1c46:	         |   4c 03 7c 24 58       	add    0x58(%rsp),%r15
+        for (nel::Index i = 0; i < reps; ++i) {
+    1c4b:	         |   48 ff cd             	dec    %rbp
+    1c4e:	         \-- 75 b8                	jne    1c08 <bench_queue(nel::Slice<int> const&)+0x18c>
+    return now_ns() - b;
+    1c50:	             e8 89 07 00 00       	call   23de <bench::now_ns()>
+    sink = sink + r;
+    1c55:	             48 8b 15 3c 84 00 00 	mov    0x843c(%rip),%rdx        # a098 <sink>
+    bench::report_per_item(name, t, reps * queue_len);
+    1c5c:	             48 8d 3d 2e 1c 00 00 	lea    0x1c2e(%rip),%rdi        # 3891 <_IO_stdin_used+0x891>
+    1c63:	             4c 29 e8             	sub    %r13,%rax
+    sink = sink + r;
+    1c66:	             4c 01 fa             	add    %r15,%rdx
+    1c69:	             48 89 c6             	mov    %rax,%rsi
+            self().for_each([&acc, &fn](OutT v) { fn(acc, v); });
+    1c6c:	             4c 8d 7c 24 30       	lea    0x30(%rsp),%r15
+    1c71:	             48 89 15 20 84 00 00 	mov    %rdx,0x8420(%rip)        # a098 <sink>
+    bench::report_per_item(name, t, reps * queue_len);
+    1c78:	             ba 00 90 d0 03       	mov    $0x3d09000,%edx
+    1c7d:	             e8 7f 07 00 00       	call   2401 <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    long unsigned int const b = now_ns();
+    1c82:	             e8 57 07 00 00       	call   23de <bench::now_ns()>
+    1c87:	             49 89 c5             	mov    %rax,%r13
+    1c8a:	             b8 09 3d 00 00       	mov    $0x3d09,%eax
+        return q.iter()
+    1c8f:	         /-> 48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    1c94:	         |   4c 89 e6             	mov    %r12,%rsi
+    1c97:	         |   48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    1c9c:	         |   e8 43 0a 00 00       	call   26e4 <nel::heapless::Queue<int, 4096ul>::iter()>
+            : b_(move(o.b_))
+    1ca1:	         |   48 8b 54 24 68       	mov    0x68(%rsp),%rdx
+            U acc = move(initial);
+    1ca6:	         |   31 c0                	xor    %eax,%eax
+            it1_.for_each(fn);
+    1ca8:	         |   4c 89 f6             	mov    %r14,%rsi
+    1cab:	         |   48 89 df             	mov    %rbx,%rdi
+            U acc = move(initial);
+    1cae:	         |   48 89 44 24 30       	mov    %rax,0x30(%rsp)
+    1cb3:	         |   48 89 94 24 88 00 00 	mov    %rdx,0x88(%rsp)
+    1cba:	         |   00 
+            , e_(move(o.e_))
+    1cbb:	         |   48 8b 54 24 70       	mov    0x70(%rsp),%rdx
+            self().for_each([&acc, &fn](OutT v) { fn(acc, v); });
+    1cc0:	         |   4c 89 7c 24 48       	mov    %r15,0x48(%rsp)
+    1cc5:	         |   48 89 94 24 90 00 00 	mov    %rdx,0x90(%rsp)
+    1ccc:	         |   00 
+            : b_(move(o.b_))
+    1ccd:	         |   48 8b 54 24 78       	mov    0x78(%rsp),%rdx
+            inner_.for_each([this, &fn](typename It::OutT e) { fn(fn_(e)); });
+    1cd2:	         |   48 89 5c 24 58       	mov    %rbx,0x58(%rsp)
+    1cd7:	         |   48 89 94 24 98 00 00 	mov    %rdx,0x98(%rsp)
+    1cde:	         |   00 
+            , e_(move(o.e_))
+    1cdf:	         |   48 8b 94 24 80 00 00 	mov    0x80(%rsp),%rdx
+    1ce6:	         |   00 
+    1ce7:	         |   48 89 94 24 a0 00 00 	mov    %rdx,0xa0(%rsp)
+    1cee:	         |   00 
+            self().for_each([&acc, &fn](OutT v) { fn(acc, v); });
+    1cef:	         |   48 8d 54 24 2f       	lea    0x2f(%rsp),%rdx
+    1cf4:	         |   48 89 54 24 50       	mov    %rdx,0x50(%rsp)
+            inner_.for_each([this, &fn](typename It::OutT e) { fn(fn_(e)); });
+    1cf9:	         |   48 8d 54 24 48       	lea    0x48(%rsp),%rdx
+    1cfe:	         |   48 89 54 24 60       	mov    %rdx,0x60(%rsp)
+            it1_.for_each(fn);
+    1d03:	         |   e8 ee fc ff ff       	call   19f6 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::for_each<nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(int&)#1}&>(unsigned long&&)>
+            it2_.for_each(fn);
+    1d08:	         |   48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    1d0d:	         |   4c 89 f6             	mov    %r14,%rsi
+    1d10:	         |   e8 e1 fc ff ff       	call   19f6 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>::for_each<nel::Iterator<nel::MappingIterator<nel::ChainIterator<nel::SliceIterator<int> >, unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(int const&)#1}>, int&, unsigned long>::fold<unsigned long, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}>(unsigned long&&, bench_queue(nel::Slice<int> const&)::{lambda(nel::heapless::Queue<int, 4096ul>&)#3}::operator()(nel::heapless::Queue<int, 4096ul>&) const::{lambda(unsigned long&, unsigned long const&)#2}&&)::{lambda(unsigned long)#1}>(unsigned long&&)::{lambda(int&)#1}&>(unsigned long&&)>
+        for (nel::Index i = 0; i < reps; ++i) {
+    1d15:	         |   48 8b 44 24 18       	mov    0x18(%rsp),%rax
+            r += f(queue);
+    1d1a:	         |   48 03 6c 24 30       	add    0x30(%rsp),%rbp
+        for (nel::Index i = 0; i < reps; ++i) {
+    1d1f:	         |   48 ff c8             	dec    %rax
+    1d22:	         \-- 0f 85 67 ff ff ff    	jne    1c8f <bench_queue(nel::Slice<int> const&)+0x213>
+    return now_ns() - b;
+    1d28:	             e8 b1 06 00 00       	call   23de <bench::now_ns()>
+    sink = sink + r;
+    1d2d:	             48 8b 15 64 83 00 00 	mov    0x8364(%rip),%rdx        # a098 <sink>
+    bench::report_per_item(name, t, reps * queue_len);
+    1d34:	             48 8d 3d 72 1b 00 00 	lea    0x1b72(%rip),%rdi        # 38ad <_IO_stdin_used+0x8ad>
+    long unsigned int const b = now_ns();
+    1d3b:	             41 be 09 3d 00 00    	mov    $0x3d09,%r14d
+    return now_ns() - b;
+    1d41:	             4c 29 e8             	sub    %r13,%rax
+    Acc r = 0;
+    1d44:	             45 31 ed             	xor    %r13d,%r13d
+    sink = sink + r;
+    1d47:	             48 01 ea             	add    %rbp,%rdx
+    1d4a:	             48 89 c6             	mov    %rax,%rsi
+    1d4d:	             48 89 15 44 83 00 00 	mov    %rdx,0x8344(%rip)        # a098 <sink>
+    bench::report_per_item(name, t, reps * queue_len);
+    1d54:	             ba 00 90 d0 03       	mov    $0x3d09000,%edx
+    1d59:	             e8 a3 06 00 00       	call   2401 <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    long unsigned int const b = now_ns();
+    1d5e:	             e8 7b 06 00 00       	call   23de <bench::now_ns()>
+    1d63:	             48 89 c5             	mov    %rax,%rbp
+        for (auto it = q.iter(); it; ++it) {
+    1d66:	   /-------> 4c 89 e6             	mov    %r12,%rsi
+    1d69:	   |         48 89 df             	mov    %rbx,%rdi
+    1d6c:	   |         e8 73 09 00 00       	call   26e4 <nel::heapless::Queue<int, 4096ul>::iter()>
+            return (b_ == e_);
+    1d71:	   |         48 8b bc 24 90 00 00 	mov    0x90(%rsp),%rdi
+    1d78:	   |         00 
+        Acc acc = 0;
+    1d79:	   |         31 c0                	xor    %eax,%eax
+    1d7b:	   |         48 8b b4 24 a0 00 00 	mov    0xa0(%rsp),%rsi
+    1d82:	   |         00 
+    1d83:	   |         48 8b 94 24 98 00 00 	mov    0x98(%rsp),%rdx
+    1d8a:	   |         00 
+    1d8b:	   |         48 8b 8c 24 88 00 00 	mov    0x88(%rsp),%rcx
+    1d92:	   |         00 
+            return it1_.is_done() && it2_.is_done();
+    1d93:	   |  /----> 48 39 f9             	cmp    %rdi,%rcx
+    1d96:	   |  |  /-- 74 0c                	je     1da4 <bench_queue(nel::Slice<int> const&)+0x328>
+            acc += Acc(*it);
+    1d98:	   |  |  |   4c 63 01             	movslq (%rcx),%r8
+            ++b_;
+    1d9b:	   |  |  |   48 83 c1 04          	add    $0x4,%rcx
+    1d9f:	   |  |  |   4c 01 c0             	add    %r8,%rax
+        }
+    1da2:	   |  +--|-- eb ef                	jmp    1d93 <bench_queue(nel::Slice<int> const&)+0x317>
+    1da4:	   |  |  \-> 48 39 f2             	cmp    %rsi,%rdx
+    1da7:	   |  |  /-- 74 0c                	je     1db5 <bench_queue(nel::Slice<int> const&)+0x339>
+    1da9:	   |  |  |   4c 63 02             	movslq (%rdx),%r8
+            ++b_;
+    1dac:	   |  |  |   48 83 c2 04          	add    $0x4,%rdx
+    1db0:	   |  |  |   4c 01 c0             	add    %r8,%rax
+        }
+    1db3:	   |  \--|-- eb de                	jmp    1d93 <bench_queue(nel::Slice<int> const&)+0x317>
+            r += f(queue);
+    1db5:	   |     \-> 49 01 c5             	add    %rax,%r13
+        for (nel::Index i = 0; i < reps; ++i) {
+    1db8:	   |         49 ff ce             	dec    %r14
+    1dbb:	   \-------- 75 a9                	jne    1d66 <bench_queue(nel::Slice<int> const&)+0x2ea>
+    return now_ns() - b;
+    1dbd:	             e8 1c 06 00 00       	call   23de <bench::now_ns()>
+    sink = sink + r;
+    1dc2:	             48 8b 15 cf 82 00 00 	mov    0x82cf(%rip),%rdx        # a098 <sink>
+    bench::report_per_item(name, t, reps * queue_len);
+    1dc9:	             48 8d 3d f9 1a 00 00 	lea    0x1af9(%rip),%rdi        # 38c9 <_IO_stdin_used+0x8c9>
+    1dd0:	             48 29 e8             	sub    %rbp,%rax
+    sink = sink + r;
+    1dd3:	             4c 01 ea             	add    %r13,%rdx
+    1dd6:	             48 89 c6             	mov    %rax,%rsi
+    1dd9:	             48 89 15 b8 82 00 00 	mov    %rdx,0x82b8(%rip)        # a098 <sink>
+}
+    1de0:	             48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+    bench::report_per_item(name, t, reps * queue_len);
+    1de7:	             ba 00 90 d0 03       	mov    $0x3d09000,%edx
+}
+    1dec:	             5b                   	pop    %rbx
+    1ded:	             5d                   	pop    %rbp
+    1dee:	             41 5c                	pop    %r12
+    1df0:	             41 5d                	pop    %r13
+    1df2:	             41 5e                	pop    %r14
+    1df4:	             41 5f                	pop    %r15
+    bench::report_per_item(name, t, reps * queue_len);
+    1df6:	             e9 06 06 00 00       	jmp    2401 <bench::report_per_item(char const*, unsigned long, unsigned long)>
+
+0000000000001dfb <bench_chain(nel::Slice<int> const&)>:
+{
+    1dfb:	                      41 57                	push   %r15
+    nel::Count const reps = n_total / s.len();
+    1dfd:	                      31 d2                	xor    %edx,%edx
+{
+    1dff:	                      41 56                	push   %r14
+    1e01:	                      41 55                	push   %r13
+    Acc r = 0;
+    1e03:	                      45 31 ed             	xor    %r13d,%r13d
+{
+    1e06:	                      41 54                	push   %r12
+    1e08:	                      55                   	push   %rbp
+    1e09:	                      53                   	push   %rbx
+    1e0a:	                      48 89 fb             	mov    %rdi,%rbx
+    1e0d:	                      48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+            return len_;
+    1e14:	                      48 8b 4f 08          	mov    0x8(%rdi),%rcx
+    nel::Length const h = s.len() / 2;
+    1e18:	                      48 89 c8             	mov    %rcx,%rax
+    1e1b:	                      48 d1 e8             	shr    %rax
+    1e1e:	                      48 89 04 24          	mov    %rax,(%rsp)
+    nel::Count const reps = n_total / s.len();
+    1e22:	                      b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    1e27:	                      48 f7 f1             	div    %rcx
+    1e2a:	                      48 89 c5             	mov    %rax,%rbp
+    long unsigned int const b = now_ns();
+    1e2d:	                      e8 ac 05 00 00       	call   23de <bench::now_ns()>
+        for (nel::Index i = 0; i < reps; ++i) {
+    1e32:	                      31 d2                	xor    %edx,%edx
+    1e34:	                      49 89 c4             	mov    %rax,%r12
+    1e37:	         /----------> 48 39 d5             	cmp    %rdx,%rbp
+    1e3a:	         |  /-------- 74 36                	je     1e72 <bench_chain(nel::Slice<int> const&)+0x77>
+            return content_;
+    1e3c:	         |  |         48 8b 33             	mov    (%rbx),%rsi
+        for (nel::Index i = 0; i < h; ++i) {
+    1e3f:	         |  |         31 c9                	xor    %ecx,%ecx
+        Acc acc = 0;
+    1e41:	         |  |         31 c0                	xor    %eax,%eax
+        for (nel::Index i = 0; i < h; ++i) {
+    1e43:	         |  |  /----> 48 39 0c 24          	cmp    %rcx,(%rsp)
+    1e47:	         |  |  |  /-- 74 0c                	je     1e55 <bench_chain(nel::Slice<int> const&)+0x5a>
+            acc += Acc(p[i]);
+    1e49:	         |  |  |  |   48 63 3c 8e          	movslq (%rsi,%rcx,4),%rdi
+        for (nel::Index i = 0; i < h; ++i) {
+    1e4d:	         |  |  |  |   48 ff c1             	inc    %rcx
+            acc += Acc(p[i]);
+    1e50:	         |  |  |  |   48 01 f8             	add    %rdi,%rax
+        for (nel::Index i = 0; i < h; ++i) {
+    1e53:	         |  |  \--|-- eb ee                	jmp    1e43 <bench_chain(nel::Slice<int> const&)+0x48>
+            return len_;
+    1e55:	         |  |     \-> 48 8b 7b 08          	mov    0x8(%rbx),%rdi
+        for (nel::Index i = h; i < s.len(); ++i) {
+    1e59:	         |  |  /----> 48 39 f9             	cmp    %rdi,%rcx
+    1e5c:	         |  |  |  /-- 73 0c                	jae    1e6a <bench_chain(nel::Slice<int> const&)+0x6f>
+            acc += Acc(p[i]);
+    1e5e:	         |  |  |  |   4c 63 04 8e          	movslq (%rsi,%rcx,4),%r8
+        for (nel::Index i = h; i < s.len(); ++i) {
+    1e62:	         |  |  |  |   48 ff c1             	inc    %rcx
+            acc += Acc(p[i]);
+    1e65:	         |  |  |  |   4c 01 c0             	add    %r8,%rax
+        for (nel::Index i = h; i < s.len(); ++i) {
+    1e68:	         |  |  \--|-- eb ef                	jmp    1e59 <bench_chain(nel::Slice<int> const&)+0x5e>
+            r += f(s);
+    1e6a:	         |  |     \-> 49 01 c5             	add    %rax,%r13
+        for (nel::Index i = 0; i < reps; ++i) {
+    1e6d:	         |  |         48 ff c2             	inc    %rdx
+    1e70:	         \--|-------- eb c5                	jmp    1e37 <bench_chain(nel::Slice<int> const&)+0x3c>
+    return now_ns() - b;
+    1e72:	            \-------> e8 67 05 00 00       	call   23de <bench::now_ns()>
+    sink = sink + r;
+    1e77:	                      48 8b 15 1a 82 00 00 	mov    0x821a(%rip),%rdx        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    1e7e:	                      48 8d 3d 60 1a 00 00 	lea    0x1a60(%rip),%rdi        # 38e5 <_IO_stdin_used+0x8e5>
+    1e85:	                      4c 29 e0             	sub    %r12,%rax
+    sink = sink + r;
+    1e88:	                      4c 01 ea             	add    %r13,%rdx
+    1e8b:	                      48 89 c6             	mov    %rax,%rsi
+    Acc r = 0;
+    1e8e:	                      45 31 ed             	xor    %r13d,%r13d
+    sink = sink + r;
+    1e91:	                      48 89 15 00 82 00 00 	mov    %rdx,0x8200(%rip)        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    1e98:	                      48 8b 53 08          	mov    0x8(%rbx),%rdx
+    1e9c:	                      48 0f af d5          	imul   %rbp,%rdx
+        for (nel::Index i = 0; i < reps; ++i) {
+    1ea0:	                      31 ed                	xor    %ebp,%ebp
+    bench::report_per_item(name, t, reps * s.len());
+    1ea2:	                      e8 5a 05 00 00       	call   2401 <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    nel::Count const reps = n_total / s.len();
+    1ea7:	                      b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    1eac:	                      31 d2                	xor    %edx,%edx
+    1eae:	                      48 f7 73 08          	divq   0x8(%rbx)
+    1eb2:	                      48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    long unsigned int const b = now_ns();
+    1eb7:	                      e8 22 05 00 00       	call   23de <bench::now_ns()>
+    1ebc:	                      49 89 c4             	mov    %rax,%r12
+        s.slice(0, h).iter().chain(s.slice(h, s.len()).iter()).for_each([&acc](int const &e) {
+    1ebf:	                      48 8d 44 24 58       	lea    0x58(%rsp),%rax
+    1ec4:	                      48 89 44 24 10       	mov    %rax,0x10(%rsp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    1ec9:	                  /-> 48 39 6c 24 08       	cmp    %rbp,0x8(%rsp)
+    1ece:	               /--|-- 0f 84 a8 00 00 00    	je     1f7c <bench_chain(nel::Slice<int> const&)+0x181>
+        Acc acc = 0;
+    1ed4:	               |  |   31 c9                	xor    %ecx,%ecx
+        s.slice(0, h).iter().chain(s.slice(h, s.len()).iter()).for_each([&acc](int const &e) {
+    1ed6:	               |  |   48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    1edb:	               |  |   31 d2                	xor    %edx,%edx
+    1edd:	               |  |   48 89 de             	mov    %rbx,%rsi
+        Acc acc = 0;
+    1ee0:	               |  |   48 89 4c 24 38       	mov    %rcx,0x38(%rsp)
+        s.slice(0, h).iter().chain(s.slice(h, s.len()).iter()).for_each([&acc](int const &e) {
+    1ee5:	               |  |   48 8b 0c 24          	mov    (%rsp),%rcx
+    1ee9:	               |  |   4c 8d 74 24 48       	lea    0x48(%rsp),%r14
+        for (nel::Index i = 0; i < reps; ++i) {
+    1eee:	               |  |   48 ff c5             	inc    %rbp
+        s.slice(0, h).iter().chain(s.slice(h, s.len()).iter()).for_each([&acc](int const &e) {
+    1ef1:	               |  |   4c 8d 7c 24 78       	lea    0x78(%rsp),%r15
+    1ef6:	               |  |   e8 4d 06 00 00       	call   2548 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+    1efb:	               |  |   48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1f00:	               |  |   4c 89 f7             	mov    %r14,%rdi
+    1f03:	               |  |   e8 2a 06 00 00       	call   2532 <nel::Slice<int>::iter() const>
+    1f08:	               |  |   48 8b 4b 08          	mov    0x8(%rbx),%rcx
+    1f0c:	               |  |   48 8b 14 24          	mov    (%rsp),%rdx
+    1f10:	               |  |   4c 89 ff             	mov    %r15,%rdi
+    1f13:	               |  |   48 89 de             	mov    %rbx,%rsi
+    1f16:	               |  |   e8 2d 06 00 00       	call   2548 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+    1f1b:	               |  |   48 8d 54 24 68       	lea    0x68(%rsp),%rdx
+    1f20:	               |  |   4c 89 fe             	mov    %r15,%rsi
+            return ChainIterator<ItT>(move(self()), move(other));
+    1f23:	               |  |   4c 8d bc 24 90 00 00 	lea    0x90(%rsp),%r15
+    1f2a:	               |  |   00 
+    1f2b:	               |  |   48 89 d7             	mov    %rdx,%rdi
+    1f2e:	               |  |   48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+    1f33:	               |  |   e8 fa 05 00 00       	call   2532 <nel::Slice<int>::iter() const>
+    1f38:	               |  |   48 8b 54 24 18       	mov    0x18(%rsp),%rdx
+    1f3d:	               |  |   4c 89 f6             	mov    %r14,%rsi
+    1f40:	               |  |   4c 89 ff             	mov    %r15,%rdi
+            it1_.for_each(fn);
+    1f43:	               |  |   4c 8d 74 24 40       	lea    0x40(%rsp),%r14
+            return ChainIterator<ItT>(move(self()), move(other));
+    1f48:	               |  |   e8 67 07 00 00       	call   26b4 <nel::ChainIterator<nel::SliceIterator<int> >::ChainIterator(nel::SliceIterator<int>&&, nel::SliceIterator<int>&&)>
+    1f4d:	               |  |   48 8d 54 24 38       	lea    0x38(%rsp),%rdx
+            it1_.for_each(fn);
+    1f52:	               |  |   4c 89 f6             	mov    %r14,%rsi
+    1f55:	               |  |   4c 89 ff             	mov    %r15,%rdi
+    1f58:	               |  |   48 89 54 24 40       	mov    %rdx,0x40(%rsp)
+    1f5d:	               |  |   e8 94 f9 ff ff       	call   18f6 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)>
+            it2_.for_each(fn);
+    1f62:	               |  |   48 8d bc 24 a0 00 00 	lea    0xa0(%rsp),%rdi
+    1f69:	               |  |   00 
+    1f6a:	               |  |   4c 89 f6             	mov    %r14,%rsi
+    1f6d:	               |  |   e8 84 f9 ff ff       	call   18f6 <void nel::Iterator<nel::SliceIterator<int>, int&, int&>::for_each<bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&>(bench_chain(nel::Slice<int> const&)::{lambda(nel::Slice<int> const&)#2}::operator()(nel::Slice<int> const&) const::{lambda(int const&)#1}&)>
+            r += f(s);
+    1f72:	               |  |   4c 03 6c 24 38       	add    0x38(%rsp),%r13
+        for (nel::Index i = 0; i < reps; ++i) {
+    1f77:	               |  \-- e9 4d ff ff ff       	jmp    1ec9 <bench_chain(nel::Slice<int> const&)+0xce>
+    return now_ns() - b;
+    1f7c:	               \----> e8 5d 04 00 00       	call   23de <bench::now_ns()>
+    sink = sink + r;
+    1f81:	                      48 8b 15 10 81 00 00 	mov    0x8110(%rip),%rdx        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    1f88:	                      48 8d 3d 72 19 00 00 	lea    0x1972(%rip),%rdi        # 3901 <_IO_stdin_used+0x901>
+        for (nel::Index i = 0; i < reps; ++i) {
+    1f8f:	                      45 31 f6             	xor    %r14d,%r14d
+    1f92:	                      4c 29 e0             	sub    %r12,%rax
+    sink = sink + r;
+    1f95:	                      4c 01 ea             	add    %r13,%rdx
+    1f98:	                      48 89 c6             	mov    %rax,%rsi
+    Acc r = 0;
+    1f9b:	                      45 31 ed             	xor    %r13d,%r13d
+    sink = sink + r;
+    1f9e:	                      48 89 15 f3 80 00 00 	mov    %rdx,0x80f3(%rip)        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    1fa5:	                      48 8b 54 24 08       	mov    0x8(%rsp),%rdx
+    1faa:	                      48 0f af 53 08       	imul   0x8(%rbx),%rdx
+    1faf:	                      e8 4d 04 00 00       	call   2401 <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    nel::Count const reps = n_total / s.len();
+    1fb4:	                      b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    1fb9:	                      31 d2                	xor    %edx,%edx
+    1fbb:	                      48 f7 73 08          	divq   0x8(%rbx)
+    1fbf:	                      48 89 c5             	mov    %rax,%rbp
+    long unsigned int const b = now_ns();
+    1fc2:	                      e8 17 04 00 00       	call   23de <bench::now_ns()>
+    1fc7:	                      49 89 c4             	mov    %rax,%r12
+        s.slice(0, h).iter().chain(s.slice(h, s.len()).iter()).for_each2([&acc](int const &e) {
+    1fca:	                      48 8d 44 24 58       	lea    0x58(%rsp),%rax
+    1fcf:	                      48 89 44 24 10       	mov    %rax,0x10(%rsp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    1fd4:	            /-------> 4c 39 f5             	cmp    %r14,%rbp
+    1fd7:	         /--|-------- 0f 84 bd 00 00 00    	je     209a <bench_chain(nel::Slice<int> const&)+0x29f>
+        s.slice(0, h).iter().chain(s.slice(h, s.len()).iter()).for_each2([&acc](int const &e) {
+    1fdd:	         |  |         48 8b 0c 24          	mov    (%rsp),%rcx
+    1fe1:	         |  |         48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    1fe6:	         |  |         31 d2                	xor    %edx,%edx
+    1fe8:	         |  |         48 89 de             	mov    %rbx,%rsi
+    1feb:	         |  |         4c 8d 7c 24 78       	lea    0x78(%rsp),%r15
+    1ff0:	         |  |         e8 53 05 00 00       	call   2548 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+    1ff5:	         |  |         48 8d 44 24 48       	lea    0x48(%rsp),%rax
+    1ffa:	         |  |         48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1fff:	         |  |         48 89 c7             	mov    %rax,%rdi
+    2002:	         |  |         48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    2007:	         |  |         e8 26 05 00 00       	call   2532 <nel::Slice<int>::iter() const>
+    200c:	         |  |         48 8b 4b 08          	mov    0x8(%rbx),%rcx
+    2010:	         |  |         48 8b 14 24          	mov    (%rsp),%rdx
+    2014:	         |  |         48 89 de             	mov    %rbx,%rsi
+    2017:	         |  |         4c 89 ff             	mov    %r15,%rdi
+    201a:	         |  |         e8 29 05 00 00       	call   2548 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+    201f:	         |  |         48 8d 54 24 68       	lea    0x68(%rsp),%rdx
+    2024:	         |  |         4c 89 fe             	mov    %r15,%rsi
+    2027:	         |  |         48 89 d7             	mov    %rdx,%rdi
+    202a:	         |  |         48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+    202f:	         |  |         e8 fe 04 00 00       	call   2532 <nel::Slice<int>::iter() const>
+            return ChainIterator<ItT>(move(self()), move(other));
+    2034:	         |  |         48 8b 54 24 18       	mov    0x18(%rsp),%rdx
+    2039:	         |  |         48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    203e:	         |  |         48 8d bc 24 90 00 00 	lea    0x90(%rsp),%rdi
+    2045:	         |  |         00 
+    2046:	         |  |         e8 69 06 00 00       	call   26b4 <nel::ChainIterator<nel::SliceIterator<int> >::ChainIterator(nel::SliceIterator<int>&&, nel::SliceIterator<int>&&)>
+        void for_each2(F &&fn)
+    204b:	         |  |         48 8b 94 24 90 00 00 	mov    0x90(%rsp),%rdx
+    2052:	         |  |         00 
+    2053:	         |  |         48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+    205a:	         |  |         00 
+        Acc acc = 0;
+    205b:	         |  |         31 c0                	xor    %eax,%eax
+            for (; !self().is_done(); self().inc()) {
+    205d:	         |  |  /----> 48 39 ca             	cmp    %rcx,%rdx
+    2060:	         |  |  |  /-- 74 0c                	je     206e <bench_chain(nel::Slice<int> const&)+0x273>
+            acc += Acc(e);
+    2062:	         |  |  |  |   48 63 32             	movslq (%rdx),%rsi
+    2065:	         |  |  |  |   48 83 c2 04          	add    $0x4,%rdx
+    2069:	         |  |  |  |   48 01 f0             	add    %rsi,%rax
+        }
+    206c:	         |  |  \--|-- eb ef                	jmp    205d <bench_chain(nel::Slice<int> const&)+0x262>
+    206e:	         |  |     \-> 48 8b 94 24 a0 00 00 	mov    0xa0(%rsp),%rdx
+    2075:	         |  |         00 
+    2076:	         |  |         48 8b 8c 24 a8 00 00 	mov    0xa8(%rsp),%rcx
+    207d:	         |  |         00 
+    207e:	         |  |  /----> 48 39 ca             	cmp    %rcx,%rdx
+    2081:	         |  |  |  /-- 74 0c                	je     208f <bench_chain(nel::Slice<int> const&)+0x294>
+    2083:	         |  |  |  |   48 63 32             	movslq (%rdx),%rsi
+    2086:	         |  |  |  |   48 83 c2 04          	add    $0x4,%rdx
+    208a:	         |  |  |  |   48 01 f0             	add    %rsi,%rax
+    208d:	         |  |  \--|-- eb ef                	jmp    207e <bench_chain(nel::Slice<int> const&)+0x283>
+            r += f(s);
+    208f:	         |  |     \-> 49 01 c5             	add    %rax,%r13
+        for (nel::Index i = 0; i < reps; ++i) {
+    2092:	         |  |         49 ff c6             	inc    %r14
+    2095:	         |  \-------- e9 3a ff ff ff       	jmp    1fd4 <bench_chain(nel::Slice<int> const&)+0x1d9>
+    return now_ns() - b;
+    209a:	         \----------> e8 3f 03 00 00       	call   23de <bench::now_ns()>
+    sink = sink + r;
+    209f:	                      48 8b 15 f2 7f 00 00 	mov    0x7ff2(%rip),%rdx        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    20a6:	                      48 8d 3d 70 18 00 00 	lea    0x1870(%rip),%rdi        # 391d <_IO_stdin_used+0x91d>
+            : fn_name_(fn_name)
+    20ad:	                      4c 8d 3d 85 18 00 00 	lea    0x1885(%rip),%r15        # 3939 <_IO_stdin_used+0x939>
+    20b4:	                      4c 29 e0             	sub    %r12,%rax
+    Acc r = 0;
+    20b7:	                      45 31 e4             	xor    %r12d,%r12d
+    sink = sink + r;
+    20ba:	                      4c 01 ea             	add    %r13,%rdx
+    20bd:	                      48 89 c6             	mov    %rax,%rsi
+        for (nel::Index i = 0; i < reps; ++i) {
+    20c0:	                      45 31 ed             	xor    %r13d,%r13d
+    sink = sink + r;
+    20c3:	                      48 89 15 ce 7f 00 00 	mov    %rdx,0x7fce(%rip)        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    20ca:	                      48 8b 53 08          	mov    0x8(%rbx),%rdx
+    20ce:	                      48 0f af d5          	imul   %rbp,%rdx
+    20d2:	                      e8 2a 03 00 00       	call   2401 <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    nel::Count const reps = n_total / s.len();
+    20d7:	                      b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    20dc:	                      31 d2                	xor    %edx,%edx
+    20de:	                      48 f7 73 08          	divq   0x8(%rbx)
+    20e2:	                      48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    long unsigned int const b = now_ns();
+    20e7:	                      e8 f2 02 00 00       	call   23de <bench::now_ns()>
+    20ec:	                      48 89 c5             	mov    %rax,%rbp
+        for (nel::Index i = 0; i < reps; ++i) {
+    20ef:	   /----------------> 4c 39 6c 24 20       	cmp    %r13,0x20(%rsp)
+    20f4:	/--|----------------- 0f 84 85 01 00 00    	je     227f <bench_chain(nel::Slice<int> const&)+0x484>
+        auto it = s.slice(0, h).iter().chain(s.slice(h, s.len()).iter());
+    20fa:	|  |                  48 8d 44 24 58       	lea    0x58(%rsp),%rax
+    20ff:	|  |                  48 8b 0c 24          	mov    (%rsp),%rcx
+    2103:	|  |                  31 d2                	xor    %edx,%edx
+    2105:	|  |                  48 89 de             	mov    %rbx,%rsi
+    2108:	|  |                  48 89 c7             	mov    %rax,%rdi
+    210b:	|  |                  48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    2110:	|  |                  4c 8d 74 24 48       	lea    0x48(%rsp),%r14
+    2115:	|  |                  e8 2e 04 00 00       	call   2548 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+    211a:	|  |                  48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    211f:	|  |                  4c 89 f7             	mov    %r14,%rdi
+    2122:	|  |                  e8 0b 04 00 00       	call   2532 <nel::Slice<int>::iter() const>
+    2127:	|  |                  48 8b 4b 08          	mov    0x8(%rbx),%rcx
+    212b:	|  |                  48 8b 14 24          	mov    (%rsp),%rdx
+    212f:	|  |                  48 89 de             	mov    %rbx,%rsi
+    2132:	|  |                  48 8d 44 24 78       	lea    0x78(%rsp),%rax
+    2137:	|  |                  48 89 c7             	mov    %rax,%rdi
+    213a:	|  |                  48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    213f:	|  |                  e8 04 04 00 00       	call   2548 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+    2144:	|  |                  48 8d 44 24 68       	lea    0x68(%rsp),%rax
+    2149:	|  |                  48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    214e:	|  |                  48 89 c7             	mov    %rax,%rdi
+    2151:	|  |                  48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    2156:	|  |                  e8 d7 03 00 00       	call   2532 <nel::Slice<int>::iter() const>
+            return ChainIterator<ItT>(move(self()), move(other));
+    215b:	|  |                  48 8d 84 24 90 00 00 	lea    0x90(%rsp),%rax
+    2162:	|  |                  00 
+    2163:	|  |                  48 8b 54 24 18       	mov    0x18(%rsp),%rdx
+    2168:	|  |                  4c 89 f6             	mov    %r14,%rsi
+    216b:	|  |                  48 89 c7             	mov    %rax,%rdi
+    216e:	|  |                  48 89 44 24 28       	mov    %rax,0x28(%rsp)
+        Acc acc = 0;
+    2173:	|  |                  45 31 f6             	xor    %r14d,%r14d
+    2176:	|  |                  e8 39 05 00 00       	call   26b4 <nel::ChainIterator<nel::SliceIterator<int> >::ChainIterator(nel::SliceIterator<int>&&, nel::SliceIterator<int>&&)>
+            return it1_.next().or_else([&](void) -> Optional<OutT> { return it2_.next(); });
+    217b:	|  |  /-------------> 48 8b 74 24 28       	mov    0x28(%rsp),%rsi
+    2180:	|  |  |               48 8b 7c 24 18       	mov    0x18(%rsp),%rdi
+    2185:	|  |  |               e8 04 05 00 00       	call   268e <nel::SliceIterator<int>::next()>
+            , file_name_(file_name)
+    218a:	|  |  |               48 8d 05 b7 0f 00 00 	lea    0xfb7(%rip),%rax        # 3148 <_IO_stdin_used+0x148>
+        constexpr V consume(Fn1 &&on_some, Fn2 &&on_none, Context const &ctx = Context())
+        {
+            // a consuming matcher..
+            // that moves the value to the closures..
+            auto tag = tag_;
+            tag_ = Tag::INVAL;
+    2191:	|  |  |               31 d2                	xor    %edx,%edx
+            : fn_name_(fn_name)
+    2193:	|  |  |               4c 89 7c 24 78       	mov    %r15,0x78(%rsp)
+            , file_name_(file_name)
+    2198:	|  |  |               48 89 84 24 80 00 00 	mov    %rax,0x80(%rsp)
+    219f:	|  |  |               00 
+            auto tag = tag_;
+    21a0:	|  |  |               8b 44 24 68          	mov    0x68(%rsp),%eax
+            , line_num_(line_num)
+    21a4:	|  |  |               c7 84 24 88 00 00 00 	movl   $0x2a9,0x88(%rsp)
+    21ab:	|  |  |               a9 02 00 00 
+            tag_ = Tag::INVAL;
+    21af:	|  |  |               89 54 24 68          	mov    %edx,0x68(%rsp)
+            switch (tag) { // optional::consume
+    21b3:	|  |  |               83 f8 01             	cmp    $0x1,%eax
+    21b6:	|  |  |        /----- 74 2b                	je     21e3 <bench_chain(nel::Slice<int> const&)+0x3e8>
+    21b8:	|  |  |        |      83 f8 02             	cmp    $0x2,%eax
+    21bb:	|  |  |        |  /-- 74 12                	je     21cf <bench_chain(nel::Slice<int> const&)+0x3d4>
+    21bd:	|  |  |        |  |   85 c0                	test   %eax,%eax
+    21bf:	|  |  |  /-----|--|-- 75 36                	jne    21f7 <bench_chain(nel::Slice<int> const&)+0x3fc>
+                    return on_none();
+                case Tag::INVAL:
+                    // invalids are not values that should occur
+                    // if they do it's a use-after-move-from op so must panic.
+                    // or a use-before-initialised so again must panic.
+                    nel::panic("invalid Optional", ctx);
+    21c1:	|  |  |  |     |  |   48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    21c6:	|  |  |  |     |  |   48 8d 3d 5e 0e 00 00 	lea    0xe5e(%rip),%rdi        # 302b <_IO_stdin_used+0x2b>
+    21cd:	|  |  |  |  /--|--|-- eb 34                	jmp    2203 <bench_chain(nel::Slice<int> const&)+0x408>
+            : value_(forward<Type>(val))
+    21cf:	|  |  |  |  |  |  \-> 48 8b 44 24 70       	mov    0x70(%rsp),%rax
+            : tag_(Tag::SOME)
+    21d4:	|  |  |  |  |  |      c7 44 24 58 02 00 00 	movl   $0x2,0x58(%rsp)
+    21db:	|  |  |  |  |  |      00 
+    21dc:	|  |  |  |  |  |      48 89 44 24 60       	mov    %rax,0x60(%rsp)
+
+        template<typename Fn>
+        Optional or_else(Fn &&fn, Context const &ctx = Context())
+        {
+            return consume<Optional>([](T &&some)
+                                         -> Optional { return Optional::Some(forward<T>(some)); },
+    21e1:	|  |  |  |  |  |  /-- eb 25                	jmp    2208 <bench_chain(nel::Slice<int> const&)+0x40d>
+    21e3:	|  |  |  |  |  \--|-> 48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    21e8:	|  |  |  |  |     |   48 8d b4 24 a0 00 00 	lea    0xa0(%rsp),%rsi
+    21ef:	|  |  |  |  |     |   00 
+    21f0:	|  |  |  |  |     |   e8 99 04 00 00       	call   268e <nel::SliceIterator<int>::next()>
+    21f5:	|  |  |  |  |     +-- eb 11                	jmp    2208 <bench_chain(nel::Slice<int> const&)+0x40d>
+                    nel::panic("bad Optional", ctx);
+    21f7:	|  |  |  \--|-----|-> 48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    21fc:	|  |  |     |     |   48 8d 3d 39 0e 00 00 	lea    0xe39(%rip),%rdi        # 303c <_IO_stdin_used+0x3c>
+    2203:	|  |  |     \-----|-> e8 ea ee ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+    2208:	|  |  |           \-> 48 8b 7c 24 18       	mov    0x18(%rsp),%rdi
+    220d:	|  |  |               e8 6a 03 00 00       	call   257c <nel::Optional<int&>::~Optional()>
+            if (v.is_none()) { break; }
+    2212:	|  |  |               48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    2217:	|  |  |               e8 82 02 00 00       	call   249e <nel::Optional<int&>::is_none() const>
+    221c:	|  |  |               84 c0                	test   %al,%al
+    221e:	|  |  |           /-- 75 4a                	jne    226a <bench_chain(nel::Slice<int> const&)+0x46f>
+            acc += Acc(v.unwrap());
+    2220:	|  |  |           |   48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    2225:	|  |  |           |   48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+            : fn_name_(fn_name)
+    222a:	|  |  |           |   48 8d 05 97 17 00 00 	lea    0x1797(%rip),%rax        # 39c8 <_IO_stdin_used+0x9c8>
+            , line_num_(line_num)
+    2231:	|  |  |           |   c7 84 24 88 00 00 00 	movl   $0x8c,0x88(%rsp)
+    2238:	|  |  |           |   8c 00 00 00 
+            : fn_name_(fn_name)
+    223c:	|  |  |           |   48 89 44 24 78       	mov    %rax,0x78(%rsp)
+            , file_name_(file_name)
+    2241:	|  |  |           |   48 8d 05 12 16 00 00 	lea    0x1612(%rip),%rax        # 385a <_IO_stdin_used+0x85a>
+    2248:	|  |  |           |   48 89 84 24 80 00 00 	mov    %rax,0x80(%rsp)
+    224f:	|  |  |           |   00 
+    2250:	|  |  |           |   e8 63 03 00 00       	call   25b8 <nel::Optional<int&>::unwrap(nel::Context const&)>
+        }
+    2255:	|  |  |           |   48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+            acc += Acc(v.unwrap());
+    225a:	|  |  |           |   48 63 00             	movslq (%rax),%rax
+    225d:	|  |  |           |   49 01 c6             	add    %rax,%r14
+        }
+    2260:	|  |  |           |   e8 17 03 00 00       	call   257c <nel::Optional<int&>::~Optional()>
+    2265:	|  |  \-----------|-- e9 11 ff ff ff       	jmp    217b <bench_chain(nel::Slice<int> const&)+0x380>
+    226a:	|  |              \-> 48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+            r += f(s);
+    226f:	|  |                  4d 01 f4             	add    %r14,%r12
+        for (nel::Index i = 0; i < reps; ++i) {
+    2272:	|  |                  49 ff c5             	inc    %r13
+        }
+    2275:	|  |                  e8 02 03 00 00       	call   257c <nel::Optional<int&>::~Optional()>
+        for (nel::Index i = 0; i < reps; ++i) {
+    227a:	|  \----------------- e9 70 fe ff ff       	jmp    20ef <bench_chain(nel::Slice<int> const&)+0x2f4>
+    return now_ns() - b;
+    227f:	\-------------------> e8 5a 01 00 00       	call   23de <bench::now_ns()>
+    sink = sink + r;
+    2284:	                      48 8b 15 0d 7e 00 00 	mov    0x7e0d(%rip),%rdx        # a098 <sink>
+    Acc r = 0;
+    228b:	                      45 31 ed             	xor    %r13d,%r13d
+        for (nel::Index i = 0; i < reps; ++i) {
+    228e:	                      45 31 f6             	xor    %r14d,%r14d
+    2291:	                      48 29 e8             	sub    %rbp,%rax
+    bench::report_per_item(name, t, reps * s.len());
+    2294:	                      48 8d 3d a3 16 00 00 	lea    0x16a3(%rip),%rdi        # 393e <_IO_stdin_used+0x93e>
+    sink = sink + r;
+    229b:	                      4c 01 e2             	add    %r12,%rdx
+    229e:	                      48 89 c6             	mov    %rax,%rsi
+    22a1:	                      48 89 15 f0 7d 00 00 	mov    %rdx,0x7df0(%rip)        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    22a8:	                      48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+    22ad:	                      48 0f af 53 08       	imul   0x8(%rbx),%rdx
+    22b2:	                      e8 4a 01 00 00       	call   2401 <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    nel::Count const reps = n_total / s.len();
+    22b7:	                      b8 00 90 d0 03       	mov    $0x3d09000,%eax
+    22bc:	                      31 d2                	xor    %edx,%edx
+    22be:	                      48 f7 73 08          	divq   0x8(%rbx)
+    22c2:	                      48 89 c5             	mov    %rax,%rbp
+    long unsigned int const b = now_ns();
+    22c5:	                      e8 14 01 00 00       	call   23de <bench::now_ns()>
+    22ca:	                      49 89 c4             	mov    %rax,%r12
+        auto it = s.slice(0, h).iter().chain(s.slice(h, s.len()).iter());
+    22cd:	                      48 8d 44 24 58       	lea    0x58(%rsp),%rax
+    22d2:	                      48 89 44 24 10       	mov    %rax,0x10(%rsp)
+        for (nel::Index i = 0; i < reps; ++i) {
+    22d7:	            /-------> 4c 39 f5             	cmp    %r14,%rbp
+    22da:	         /--|-------- 0f 84 bd 00 00 00    	je     239d <bench_chain(nel::Slice<int> const&)+0x5a2>
+        auto it = s.slice(0, h).iter().chain(s.slice(h, s.len()).iter());
+    22e0:	         |  |         48 8b 0c 24          	mov    (%rsp),%rcx
+    22e4:	         |  |         48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    22e9:	         |  |         31 d2                	xor    %edx,%edx
+    22eb:	         |  |         48 89 de             	mov    %rbx,%rsi
+    22ee:	         |  |         4c 8d 7c 24 78       	lea    0x78(%rsp),%r15
+    22f3:	         |  |         e8 50 02 00 00       	call   2548 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+    22f8:	         |  |         48 8d 44 24 48       	lea    0x48(%rsp),%rax
+    22fd:	         |  |         48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    2302:	         |  |         48 89 c7             	mov    %rax,%rdi
+    2305:	         |  |         48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    230a:	         |  |         e8 23 02 00 00       	call   2532 <nel::Slice<int>::iter() const>
+    230f:	         |  |         48 8b 4b 08          	mov    0x8(%rbx),%rcx
+    2313:	         |  |         48 8b 14 24          	mov    (%rsp),%rdx
+    2317:	         |  |         48 89 de             	mov    %rbx,%rsi
+    231a:	         |  |         4c 89 ff             	mov    %r15,%rdi
+    231d:	         |  |         e8 26 02 00 00       	call   2548 <nel::Slice<int>::slice(unsigned long, unsigned long) const>
+    2322:	         |  |         48 8d 54 24 68       	lea    0x68(%rsp),%rdx
+    2327:	         |  |         4c 89 fe             	mov    %r15,%rsi
+    232a:	         |  |         48 89 d7             	mov    %rdx,%rdi
+    232d:	         |  |         48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+    2332:	         |  |         e8 fb 01 00 00       	call   2532 <nel::Slice<int>::iter() const>
+            return ChainIterator<ItT>(move(self()), move(other));
+    2337:	         |  |         48 8b 54 24 18       	mov    0x18(%rsp),%rdx
+    233c:	         |  |         48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    2341:	         |  |         48 8d bc 24 90 00 00 	lea    0x90(%rsp),%rdi
+    2348:	         |  |         00 
+    2349:	         |  |         e8 66 03 00 00       	call   26b4 <nel::ChainIterator<nel::SliceIterator<int> >::ChainIterator(nel::SliceIterator<int>&&, nel::SliceIterator<int>&&)>
+            return (b_ == e_);
+    234e:	         |  |         48 8b bc 24 98 00 00 	mov    0x98(%rsp),%rdi
+    2355:	         |  |         00 
+        Acc acc = 0;
+    2356:	         |  |         31 c0                	xor    %eax,%eax
+    2358:	         |  |         48 8b b4 24 a8 00 00 	mov    0xa8(%rsp),%rsi
+    235f:	         |  |         00 
+    2360:	         |  |         48 8b 94 24 a0 00 00 	mov    0xa0(%rsp),%rdx
+    2367:	         |  |         00 
+    2368:	         |  |         48 8b 8c 24 90 00 00 	mov    0x90(%rsp),%rcx
+    236f:	         |  |         00 
+            return it1_.is_done() && it2_.is_done();
+    2370:	         |  |  /----> 48 39 cf             	cmp    %rcx,%rdi
+    2373:	         |  |  |  /-- 74 0c                	je     2381 <bench_chain(nel::Slice<int> const&)+0x586>
+            acc += Acc(*it);
+    2375:	         |  |  |  |   4c 63 09             	movslq (%rcx),%r9
+            ++b_;
+    2378:	         |  |  |  |   48 83 c1 04          	add    $0x4,%rcx
+    237c:	         |  |  |  |   4c 01 c8             	add    %r9,%rax
+        }
+    237f:	         |  |  +--|-- eb ef                	jmp    2370 <bench_chain(nel::Slice<int> const&)+0x575>
+    2381:	         |  |  |  \-> 48 39 f2             	cmp    %rsi,%rdx
+    2384:	         |  |  |  /-- 74 0c                	je     2392 <bench_chain(nel::Slice<int> const&)+0x597>
+    2386:	         |  |  |  |   4c 63 0a             	movslq (%rdx),%r9
+            ++b_;
+    2389:	         |  |  |  |   48 83 c2 04          	add    $0x4,%rdx
+    238d:	         |  |  |  |   4c 01 c8             	add    %r9,%rax
+        }
+    2390:	         |  |  \--|-- eb de                	jmp    2370 <bench_chain(nel::Slice<int> const&)+0x575>
+            r += f(s);
+    2392:	         |  |     \-> 49 01 c5             	add    %rax,%r13
+        for (nel::Index i = 0; i < reps; ++i) {
+    2395:	         |  |         49 ff c6             	inc    %r14
+    2398:	         |  \-------- e9 3a ff ff ff       	jmp    22d7 <bench_chain(nel::Slice<int> const&)+0x4dc>
+    return now_ns() - b;
+    239d:	         \----------> e8 3c 00 00 00       	call   23de <bench::now_ns()>
+    sink = sink + r;
+    23a2:	                      48 8b 15 ef 7c 00 00 	mov    0x7cef(%rip),%rdx        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    23a9:	                      48 8d 3d aa 15 00 00 	lea    0x15aa(%rip),%rdi        # 395a <_IO_stdin_used+0x95a>
+    23b0:	                      4c 29 e0             	sub    %r12,%rax
+    sink = sink + r;
+    23b3:	                      4c 01 ea             	add    %r13,%rdx
+    23b6:	                      48 89 c6             	mov    %rax,%rsi
+    23b9:	                      48 89 15 d8 7c 00 00 	mov    %rdx,0x7cd8(%rip)        # a098 <sink>
+    bench::report_per_item(name, t, reps * s.len());
+    23c0:	                      48 8b 53 08          	mov    0x8(%rbx),%rdx
+}
+    23c4:	                      48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+    23cb:	                      5b                   	pop    %rbx
+    bench::report_per_item(name, t, reps * s.len());
+    23cc:	                      48 0f af d5          	imul   %rbp,%rdx
+}
+    23d0:	                      5d                   	pop    %rbp
+    23d1:	                      41 5c                	pop    %r12
+    23d3:	                      41 5d                	pop    %r13
+    23d5:	                      41 5e                	pop    %r14
+    23d7:	                      41 5f                	pop    %r15
+    bench::report_per_item(name, t, reps * s.len());
+    23d9:	                      e9 23 00 00 00       	jmp    2401 <bench::report_per_item(char const*, unsigned long, unsigned long)>
+
+00000000000023de <bench::now_ns()>:
+
+    23de:	48 83 ec 18          	sub    $0x18,%rsp
+#include <nel/heapless/queue.hh>
+    23e2:	bf 01 00 00 00       	mov    $0x1,%edi
+    23e7:	48 89 e6             	mov    %rsp,%rsi
+    23ea:	e8 61 ec ff ff       	call   1050 <clock_gettime@plt>
+#include <nel/iterator.hh>
+    23ef:	48 69 04 24 00 ca 9a 	imul   $0x3b9aca00,(%rsp),%rax
+    23f6:	3b 
+    23f7:	48 03 44 24 08       	add    0x8(%rsp),%rax
+#include <nel/slice.hh>
+    23fc:	48 83 c4 18          	add    $0x18,%rsp
+    2400:	c3                   	ret
+
+0000000000002401 <bench::report_per_item(char const*, unsigned long, unsigned long)>:
+    auto t = bench::time_ns([&r, &s, &f, reps]() {
+    2401:	    41 56                	push   %r14
+    2403:	    53                   	push   %rbx
+    2404:	    51                   	push   %rcx
+    2405:	    48 89 d1             	mov    %rdx,%rcx
+        for (nel::Index i = 0; i < reps; ++i) {
+    2408:	    48 85 d2             	test   %rdx,%rdx
+    240b:	/-- 74 0c                	je     2419 <bench::report_per_item(char const*, unsigned long, unsigned long)+0x18>
+    240d:	|   48 6b c6 64          	imul   $0x64,%rsi,%rax
+    2411:	|   31 d2                	xor    %edx,%edx
+    2413:	|   48 f7 f1             	div    %rcx
+    2416:	|   48 89 c1             	mov    %rax,%rcx
+            r += f(s);
+    2419:	\-> 48 89 c8             	mov    %rcx,%rax
+    241c:	    bb 64 00 00 00       	mov    $0x64,%ebx
+    2421:	    31 d2                	xor    %edx,%edx
+    });
+    2423:	    48 89 fe             	mov    %rdi,%rsi
+            r += f(s);
+    2426:	    48 f7 f3             	div    %rbx
+    });
+    2429:	    48 8d 3d 70 7c 00 00 	lea    0x7c70(%rip),%rdi        # a0a0 <nel::log>
+            r += f(s);
+    2430:	    48 89 d3             	mov    %rdx,%rbx
+    2433:	    49 89 c6             	mov    %rax,%r14
+    });
+    2436:	    e8 d2 05 00 00       	call   2a0d <nel::operator<<(nel::Log&, char const*)>
+    243b:	    48 8d 35 6e 15 00 00 	lea    0x156e(%rip),%rsi        # 39b0 <_IO_stdin_used+0x9b0>
+    2442:	    48 89 c7             	mov    %rax,%rdi
+    2445:	    e8 c3 05 00 00       	call   2a0d <nel::operator<<(nel::Log&, char const*)>
+    244a:	    4c 89 f6             	mov    %r14,%rsi
+    244d:	    48 89 c7             	mov    %rax,%rdi
+    2450:	    e8 53 06 00 00       	call   2aa8 <nel::operator<<(nel::Log&, unsigned long)>
+    2455:	    be 2e 00 00 00       	mov    $0x2e,%esi
+    245a:	    48 89 c7             	mov    %rax,%rdi
+    245d:	    e8 92 05 00 00       	call   29f4 <nel::operator<<(nel::Log&, char)>
+    2462:	    48 83 fb 0a          	cmp    $0xa,%rbx
+    2466:	    48 8d 35 97 0b 00 00 	lea    0xb97(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+    246d:	    48 89 c7             	mov    %rax,%rdi
+    2470:	    48 8d 05 34 15 00 00 	lea    0x1534(%rip),%rax        # 39ab <_IO_stdin_used+0x9ab>
+    2477:	    48 0f 43 f0          	cmovae %rax,%rsi
+    247b:	    e8 8d 05 00 00       	call   2a0d <nel::operator<<(nel::Log&, char const*)>
+    2480:	    48 89 de             	mov    %rbx,%rsi
+    2483:	    48 89 c7             	mov    %rax,%rdi
+    2486:	    e8 1d 06 00 00       	call   2aa8 <nel::operator<<(nel::Log&, unsigned long)>
+    248b:	    48 8d 35 74 0b 00 00 	lea    0xb74(%rip),%rsi        # 3006 <_IO_stdin_used+0x6>
+    2492:	    48 89 c7             	mov    %rax,%rdi
+    sink = sink + r;
+    2495:	    58                   	pop    %rax
+    2496:	    5b                   	pop    %rbx
+    2497:	    41 5e                	pop    %r14
+    });
+    2499:	    e9 6f 05 00 00       	jmp    2a0d <nel::operator<<(nel::Log&, char const*)>
+
+000000000000249e <nel::Optional<int&>::is_none() const>:
+        constexpr bool is_none(void) const
+    249e:	          48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    24a2:	          48 8d 05 66 0b 00 00 	lea    0xb66(%rip),%rax        # 300f <_IO_stdin_used+0xf>
+    24a9:	          48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , file_name_(file_name)
+    24ae:	          48 8d 05 62 0b 00 00 	lea    0xb62(%rip),%rax        # 3017 <_IO_stdin_used+0x17>
+    24b5:	          48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    24ba:	          8b 07                	mov    (%rdi),%eax
+            , line_num_(line_num)
+    24bc:	          c7 44 24 18 78 01 00 	movl   $0x178,0x18(%rsp)
+    24c3:	          00 
+            switch (tag_) { // optional::match
+    24c4:	          83 f8 01             	cmp    $0x1,%eax
+    24c7:	/-------- 74 23                	je     24ec <nel::Optional<int&>::is_none() const+0x4e>
+    24c9:	|         31 d2                	xor    %edx,%edx
+    24cb:	|         83 f8 02             	cmp    $0x2,%eax
+    24ce:	|  /----- 74 1e                	je     24ee <nel::Optional<int&>::is_none() const+0x50>
+    24d0:	|  |      85 c0                	test   %eax,%eax
+                    nel::panic("invalid Optional", ctx);
+    24d2:	|  |      48 8d 3d 52 0b 00 00 	lea    0xb52(%rip),%rdi        # 302b <_IO_stdin_used+0x2b>
+    24d9:	|  |      48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            switch (tag_) { // optional::match
+    24de:	|  |  /-- 74 07                	je     24e7 <nel::Optional<int&>::is_none() const+0x49>
+                    nel::panic("bad Optional", ctx);
+    24e0:	|  |  |   48 8d 3d 55 0b 00 00 	lea    0xb55(%rip),%rdi        # 303c <_IO_stdin_used+0x3c>
+    24e7:	|  |  \-> e8 06 ec ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+                    return on_none();
+    24ec:	\--|----> b2 01                	mov    $0x1,%dl
+        }
+    24ee:	   \----> 89 d0                	mov    %edx,%eax
+    24f0:	          48 83 c4 28          	add    $0x28,%rsp
+    24f4:	          c3                   	ret
+    24f5:	          90                   	nop
+
+00000000000024f6 <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+            switch (tag_) { // result::dtor
+    24f6:	    83 3f 02             	cmpl   $0x2,(%rdi)
+    24f9:	/-- 76 35                	jbe    2530 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x3a>
+        constexpr ~Result(void)
+    24fb:	|   48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    24ff:	|   48 8d 05 43 0b 00 00 	lea    0xb43(%rip),%rax        # 3049 <_IO_stdin_used+0x49>
+                    nel::panic("bad Result");
+    2506:	|   48 8d 3d 56 0b 00 00 	lea    0xb56(%rip),%rdi        # 3063 <_IO_stdin_used+0x63>
+    250d:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    2512:	|   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    2517:	|   48 8d 05 33 0b 00 00 	lea    0xb33(%rip),%rax        # 3051 <_IO_stdin_used+0x51>
+    251e:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    2523:	|   c7 44 24 18 72 00 00 	movl   $0x72,0x18(%rsp)
+    252a:	|   00 
+    252b:	|   e8 c2 eb ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+    2530:	\-> c3                   	ret
+    2531:	    90                   	nop
+
+0000000000002532 <nel::Slice<int>::iter() const>:
+            return len_;
+    2532:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+            return content_;
+    2536:	48 8b 16             	mov    (%rsi),%rdx
+        constexpr Iterator iter(void) const
+    2539:	48 89 f8             	mov    %rdi,%rax
+            : b_(arr)
+    253c:	48 89 17             	mov    %rdx,(%rdi)
+            , e_(arr + len)
+    253f:	48 8d 14 8a          	lea    (%rdx,%rcx,4),%rdx
+    2543:	48 89 57 08          	mov    %rdx,0x8(%rdi)
+        }
+    2547:	c3                   	ret
+
+0000000000002548 <nel::Slice<int>::slice(unsigned long, unsigned long) const>:
+        Slice slice(Index b, Index e) const
+    2548:	       48 89 f8             	mov    %rdi,%rax
+            if (b >= e) { return Slice::empty(); }
+    254b:	       48 39 ca             	cmp    %rcx,%rdx
+    254e:	   /-- 73 09                	jae    2559 <nel::Slice<int>::slice(unsigned long, unsigned long) const+0x11>
+            if (b >= len_) { return Slice::empty(); }
+    2550:	   |   48 8b 7e 08          	mov    0x8(%rsi),%rdi
+    2554:	   |   48 39 fa             	cmp    %rdi,%rdx
+    2557:	/--|-- 72 0a                	jb     2563 <nel::Slice<int>::slice(unsigned long, unsigned long) const+0x1b>
+            , len_(0)
+    2559:	|  \-> 31 d2                	xor    %edx,%edx
+    255b:	|      48 89 10             	mov    %rdx,(%rax)
+    255e:	|      48 89 50 08          	mov    %rdx,0x8(%rax)
+            return Slice();
+    2562:	|      c3                   	ret
+            return Slice(&content_[b], e - b);
+    2563:	\----> 48 39 cf             	cmp    %rcx,%rdi
+    2566:	       48 8b 36             	mov    (%rsi),%rsi
+    2569:	       48 0f 47 f9          	cmova  %rcx,%rdi
+    256d:	       48 8d 34 96          	lea    (%rsi,%rdx,4),%rsi
+    2571:	       48 29 d7             	sub    %rdx,%rdi
+            : content_(p)
+    2574:	       48 89 30             	mov    %rsi,(%rax)
+            return Slice(&content_[b], e - b);
+    2577:	       48 89 78 08          	mov    %rdi,0x8(%rax)
+        }
+    257b:	       c3                   	ret
+
+000000000000257c <nel::Optional<int&>::~Optional()>:
+            switch (tag_) { // optional::dtor
+    257c:	    83 3f 02             	cmpl   $0x2,(%rdi)
+    257f:	/-- 76 35                	jbe    25b6 <nel::Optional<int&>::~Optional()+0x3a>
+        constexpr ~Optional(void)
+    2581:	|   48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    2585:	|   48 8d 05 27 14 00 00 	lea    0x1427(%rip),%rax        # 39b3 <_IO_stdin_used+0x9b3>
+                    nel::panic("bad Optional");
+    258c:	|   48 8d 3d a9 0a 00 00 	lea    0xaa9(%rip),%rdi        # 303c <_IO_stdin_used+0x3c>
+    2593:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    2598:	|   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    259d:	|   48 8d 05 73 0a 00 00 	lea    0xa73(%rip),%rax        # 3017 <_IO_stdin_used+0x17>
+    25a4:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    25a9:	|   c7 44 24 18 87 00 00 	movl   $0x87,0x18(%rsp)
+    25b0:	|   00 
+    25b1:	|   e8 3c eb ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+    25b6:	\-> c3                   	ret
+    25b7:	    90                   	nop
+
+00000000000025b8 <nel::Optional<int&>::unwrap(nel::Context const&)>:
+        T unwrap(Context const &ctx = Context())
+    25b8:	          51                   	push   %rcx
+            auto tag = tag_;
+    25b9:	          8b 07                	mov    (%rdi),%eax
+            tag_ = Tag::INVAL;
+    25bb:	          45 31 c0             	xor    %r8d,%r8d
+    25be:	          44 89 07             	mov    %r8d,(%rdi)
+            switch (tag) { // optional::consume
+    25c1:	          83 f8 02             	cmp    $0x2,%eax
+    25c4:	/-------- 74 24                	je     25ea <nel::Optional<int&>::unwrap(nel::Context const&)+0x32>
+    25c6:	|  /----- 7f 16                	jg     25de <nel::Optional<int&>::unwrap(nel::Context const&)+0x26>
+                    nel::panic("invalid Optional", ctx);
+    25c8:	|  |      48 8d 3d 5c 0a 00 00 	lea    0xa5c(%rip),%rdi        # 302b <_IO_stdin_used+0x2b>
+            switch (tag) { // optional::consume
+    25cf:	|  |      85 c0                	test   %eax,%eax
+    25d1:	|  |  /-- 74 12                	je     25e5 <nel::Optional<int&>::unwrap(nel::Context const&)+0x2d>
+    25d3:	|  |  |   ff c8                	dec    %eax
+                              [&](void) -> T { nel::panic("not a Some", ctx); },
+    25d5:	|  |  |   48 8d 3d e1 13 00 00 	lea    0x13e1(%rip),%rdi        # 39bd <_IO_stdin_used+0x9bd>
+            switch (tag) { // optional::consume
+    25dc:	|  |  +-- 74 07                	je     25e5 <nel::Optional<int&>::unwrap(nel::Context const&)+0x2d>
+                    nel::panic("bad Optional", ctx);
+    25de:	|  \--|-> 48 8d 3d 57 0a 00 00 	lea    0xa57(%rip),%rdi        # 303c <_IO_stdin_used+0x3c>
+                    nel::panic("invalid Optional", ctx);
+    25e5:	|     \-> e8 08 eb ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+                              ctx);
+    25ea:	\-------> 48 8b 47 08          	mov    0x8(%rdi),%rax
+        }
+    25ee:	          5a                   	pop    %rdx
+    25ef:	          c3                   	ret
+
+00000000000025f0 <nel::Result<void, int>::~Result()>:
+            switch (tag_) { // result<void>-dtor
+    25f0:	    83 3f 02             	cmpl   $0x2,(%rdi)
+    25f3:	/-- 76 35                	jbe    262a <nel::Result<void, int>::~Result()+0x3a>
+        constexpr ~Result(void)
+    25f5:	|   48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    25f9:	|   48 8d 05 49 0a 00 00 	lea    0xa49(%rip),%rax        # 3049 <_IO_stdin_used+0x49>
+                    nel::panic("bad Result");
+    2600:	|   48 8d 3d 5c 0a 00 00 	lea    0xa5c(%rip),%rdi        # 3063 <_IO_stdin_used+0x63>
+    2607:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    260c:	|   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    2611:	|   48 8d 05 39 0a 00 00 	lea    0xa39(%rip),%rax        # 3051 <_IO_stdin_used+0x51>
+    2618:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    261d:	|   c7 44 24 18 dd 02 00 	movl   $0x2dd,0x18(%rsp)
+    2624:	|   00 
+    2625:	|   e8 c8 ea ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+    262a:	\-> c3                   	ret
+    262b:	    90                   	nop
+
+000000000000262c <nel::Result<void, int>::unwrap(nel::Context const&)>:
+        }
+
+        template<typename Fn1, typename Fn2>
+        constexpr void consumev(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+        {
+            auto tag = tag_;
+    262c:	          8b 07                	mov    (%rdi),%eax
+            tag_ = Tag::INVAL;
+    262e:	          31 d2                	xor    %edx,%edx
+    2630:	          89 17                	mov    %edx,(%rdi)
+            switch (tag) { // result<void>-consume
+    2632:	          83 f8 01             	cmp    $0x1,%eax
+    2635:	/-------- 74 56                	je     268d <nel::Result<void, int>::unwrap(nel::Context const&)+0x61>
+         * @return if Ok, value wrapped/contained.
+         * @return if not Ok, calls abort, there is no return.
+         *
+         * `this` is consumed by the operation.
+         */
+        constexpr void unwrap(Context const &ctx = Context())
+    2637:	|         48 83 ec 28          	sub    $0x28,%rsp
+            switch (tag) { // result<void>-consume
+    263b:	|         83 f8 02             	cmp    $0x2,%eax
+    263e:	|     /-- 74 10                	je     2650 <nel::Result<void, int>::unwrap(nel::Context const&)+0x24>
+    2640:	|     |   85 c0                	test   %eax,%eax
+    2642:	|  /--|-- 75 3d                	jne    2681 <nel::Result<void, int>::unwrap(nel::Context const&)+0x55>
+                    nel::panic("invalid Result", ctx);
+    2644:	|  |  |   48 8d 3d 92 13 00 00 	lea    0x1392(%rip),%rdi        # 39dd <_IO_stdin_used+0x9dd>
+    264b:	|  |  |   e8 a2 ea ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+            : fn_name_(fn_name)
+    2650:	|  |  \-> 48 8d 05 71 13 00 00 	lea    0x1371(%rip),%rax        # 39c8 <_IO_stdin_used+0x9c8>
+        {
+            return consumev([](void) {}, [](E &&) { nel::panic("not an ok"); }, ctx);
+    2657:	|  |      48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , line_num_(line_num)
+    265c:	|  |      c7 44 24 18 1f 04 00 	movl   $0x41f,0x18(%rsp)
+    2663:	|  |      00 
+            : fn_name_(fn_name)
+    2664:	|  |      48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    2669:	|  |      48 8d 3d 63 13 00 00 	lea    0x1363(%rip),%rdi        # 39d3 <_IO_stdin_used+0x9d3>
+            , file_name_(file_name)
+    2670:	|  |      48 8d 05 da 09 00 00 	lea    0x9da(%rip),%rax        # 3051 <_IO_stdin_used+0x51>
+    2677:	|  |      48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    267c:	|  |      e8 71 ea ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    2681:	|  \----> 48 8d 3d db 09 00 00 	lea    0x9db(%rip),%rdi        # 3063 <_IO_stdin_used+0x63>
+    2688:	|         e8 65 ea ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+    268d:	\-------> c3                   	ret
+
+000000000000268e <nel::SliceIterator<int>::next()>:
+            if (b_ == e_) { return None; }
+    268e:	    48 8b 16             	mov    (%rsi),%rdx
+        Optional<OutT> next(void)
+    2691:	    48 89 f8             	mov    %rdi,%rax
+            if (b_ == e_) { return None; }
+    2694:	    48 3b 56 08          	cmp    0x8(%rsi),%rdx
+    2698:	/-- 75 07                	jne    26a1 <nel::SliceIterator<int>::next()+0x13>
+            : tag_(Tag::NONE)
+    269a:	|   c7 07 01 00 00 00    	movl   $0x1,(%rdi)
+        }
+    26a0:	|   c3                   	ret
+            return Some(*b_++);
+    26a1:	\-> 48 8d 4a 04          	lea    0x4(%rdx),%rcx
+    26a5:	    48 89 0e             	mov    %rcx,(%rsi)
+            : tag_(Tag::SOME)
+    26a8:	    c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+    26ae:	    48 89 57 08          	mov    %rdx,0x8(%rdi)
+        }
+    26b2:	    c3                   	ret
+    26b3:	    90                   	nop
+
+00000000000026b4 <nel::ChainIterator<nel::SliceIterator<int> >::ChainIterator(nel::SliceIterator<int>&&, nel::SliceIterator<int>&&)>:
+            : b_(move(o.b_))
+    26b4:	48 8b 06             	mov    (%rsi),%rax
+            o.e_ = nullptr;
+    26b7:	31 c9                	xor    %ecx,%ecx
+            : b_(move(o.b_))
+    26b9:	48 89 07             	mov    %rax,(%rdi)
+            , e_(move(o.e_))
+    26bc:	48 8b 46 08          	mov    0x8(%rsi),%rax
+    26c0:	48 89 47 08          	mov    %rax,0x8(%rdi)
+            o.e_ = nullptr;
+    26c4:	31 c0                	xor    %eax,%eax
+    26c6:	48 89 06             	mov    %rax,(%rsi)
+    26c9:	48 89 46 08          	mov    %rax,0x8(%rsi)
+            : b_(move(o.b_))
+    26cd:	48 8b 02             	mov    (%rdx),%rax
+            o.e_ = nullptr;
+    26d0:	48 89 0a             	mov    %rcx,(%rdx)
+            : b_(move(o.b_))
+    26d3:	48 89 47 10          	mov    %rax,0x10(%rdi)
+            , e_(move(o.e_))
+    26d7:	48 8b 42 08          	mov    0x8(%rdx),%rax
+            o.e_ = nullptr;
+    26db:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+            , e_(move(o.e_))
+    26df:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        }
+    26e3:	c3                   	ret
+
+00000000000026e4 <nel::heapless::Queue<int, 4096ul>::iter()>:
+        }
+
+    public:
+        typedef ChainIterator<SliceIterator<Type>> QueueIteratorMut;
+
+        QueueIteratorMut iter(void)
+    26e4:	          41 54                	push   %r12
+    26e6:	          55                   	push   %rbp
+    26e7:	          53                   	push   %rbx
+    26e8:	          48 89 fb             	mov    %rdi,%rbx
+    26eb:	          48 83 ec 40          	sub    $0x40,%rsp
+        {
+            if (len() == 0) {
+    26ef:	          48 83 3e 00          	cmpq   $0x0,(%rsi)
+    26f3:	          4c 8d 64 24 30       	lea    0x30(%rsp),%r12
+    26f8:	          48 8d 54 24 10       	lea    0x10(%rsp),%rdx
+    26fd:	          48 8d 6c 24 20       	lea    0x20(%rsp),%rbp
+    2702:	      /-- 75 28                	jne    272c <nel::heapless::Queue<int, 4096ul>::iter()+0x48>
+                auto s1 = Slice<Type>::empty();
+                auto s2 = s1;
+    2704:	      |   31 c9                	xor    %ecx,%ecx
+                return QueueIteratorMut(s1.iter(), s2.iter());
+    2706:	      |   48 89 d6             	mov    %rdx,%rsi
+    2709:	      |   4c 89 e7             	mov    %r12,%rdi
+                auto s2 = s1;
+    270c:	      |   48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+    2711:	      |   48 89 4c 24 18       	mov    %rcx,0x18(%rsp)
+                return QueueIteratorMut(s1.iter(), s2.iter());
+    2716:	      |   e8 17 fe ff ff       	call   2532 <nel::Slice<int>::iter() const>
+            , e_(arr + len)
+    271b:	      |   31 f6                	xor    %esi,%esi
+    271d:	      |   48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+    2722:	      |   48 89 74 24 28       	mov    %rsi,0x28(%rsp)
+    2727:	/-----|-- e9 82 00 00 00       	jmp    27ae <nel::heapless::Queue<int, 4096ul>::iter()+0xca>
+            } else if (rp_ < wp_) {
+    272c:	|     \-> 4c 8b 56 10          	mov    0x10(%rsi),%r10
+    2730:	|         4c 8b 4e 08          	mov    0x8(%rsi),%r9
+        {
+            return &u_.elem_;
+    2734:	|         48 8d 7e 18          	lea    0x18(%rsi),%rdi
+            return &ptr()[d];
+    2738:	|         4e 8d 04 95 00 00 00 	lea    0x0(,%r10,4),%r8
+    273f:	|         00 
+    2740:	|         4a 8d 04 8d 00 00 00 	lea    0x0(,%r9,4),%rax
+    2747:	|         00 
+    2748:	|         4a 8d 0c 07          	lea    (%rdi,%r8,1),%rcx
+            } else if (rp_ < wp_) {
+    274c:	|         4d 39 ca             	cmp    %r9,%r10
+    274f:	|     /-- 73 22                	jae    2773 <nel::heapless::Queue<int, 4096ul>::iter()+0x8f>
+            , len_(e - b)
+    2751:	|     |   4c 29 c0             	sub    %r8,%rax
+            : content_(b)
+    2754:	|     |   48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+                auto s1 = Slice(ptr(rp_), ptr(wp_));
+                auto s2 = Slice<Type>::empty();
+                return QueueIteratorMut(s1.iter(), s2.iter());
+    2759:	|     |   48 89 d6             	mov    %rdx,%rsi
+            , len_(e - b)
+    275c:	|     |   48 c1 f8 02          	sar    $0x2,%rax
+    2760:	|     |   48 89 44 24 18       	mov    %rax,0x18(%rsp)
+            , e_(arr + len)
+    2765:	|     |   31 c0                	xor    %eax,%eax
+    2767:	|     |   48 89 44 24 30       	mov    %rax,0x30(%rsp)
+    276c:	|     |   48 89 44 24 38       	mov    %rax,0x38(%rsp)
+    2771:	|  /--|-- eb 33                	jmp    27a6 <nel::heapless::Queue<int, 4096ul>::iter()+0xc2>
+            return &ptr()[d];
+    2773:	|  |  \-> 48 81 c6 18 40 00 00 	add    $0x4018,%rsi
+            : content_(b)
+    277a:	|  |      48 89 7c 24 10       	mov    %rdi,0x10(%rsp)
+            , len_(e - b)
+    277f:	|  |      48 c1 f8 02          	sar    $0x2,%rax
+            } else {
+                auto s1 = Slice(ptr(rp_), ptr(N));
+                auto s2 = Slice(ptr(), ptr(wp_));
+                return QueueIteratorMut(s1.iter(), s2.iter());
+    2783:	|  |      4c 89 e7             	mov    %r12,%rdi
+    2786:	|  |      48 29 ce             	sub    %rcx,%rsi
+            : content_(b)
+    2789:	|  |      48 89 0c 24          	mov    %rcx,(%rsp)
+            , len_(e - b)
+    278d:	|  |      48 c1 fe 02          	sar    $0x2,%rsi
+    2791:	|  |      48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    2796:	|  |      48 89 74 24 08       	mov    %rsi,0x8(%rsp)
+    279b:	|  |      48 89 d6             	mov    %rdx,%rsi
+    279e:	|  |      e8 8f fd ff ff       	call   2532 <nel::Slice<int>::iter() const>
+    27a3:	|  |      48 89 e6             	mov    %rsp,%rsi
+    27a6:	|  \----> 48 89 ef             	mov    %rbp,%rdi
+    27a9:	|         e8 84 fd ff ff       	call   2532 <nel::Slice<int>::iter() const>
+    27ae:	\-------> 4c 89 e2             	mov    %r12,%rdx
+    27b1:	          48 89 ee             	mov    %rbp,%rsi
+    27b4:	          48 89 df             	mov    %rbx,%rdi
+    27b7:	          e8 f8 fe ff ff       	call   26b4 <nel::ChainIterator<nel::SliceIterator<int> >::ChainIterator(nel::SliceIterator<int>&&, nel::SliceIterator<int>&&)>
+            }
+        }
+    27bc:	          48 83 c4 40          	add    $0x40,%rsp
+    27c0:	          48 89 d8             	mov    %rbx,%rax
+    27c3:	          5b                   	pop    %rbx
+    27c4:	          5d                   	pop    %rbp
+    27c5:	          41 5c                	pop    %r12
+    27c7:	          c3                   	ret
+
+00000000000027c8 <nel::heapless::Queue<int, 4096ul>::~Queue()>:
+        constexpr ~Queue(void)
+    27c8:	                41 56                	push   %r14
+    27ca:	                48 89 fe             	mov    %rdi,%rsi
+    27cd:	                41 55                	push   %r13
+    27cf:	                41 54                	push   %r12
+            : fn_name_(fn_name)
+    27d1:	                4c 8d 25 14 12 00 00 	lea    0x1214(%rip),%r12        # 39ec <_IO_stdin_used+0x9ec>
+    27d8:	                55                   	push   %rbp
+    27d9:	                53                   	push   %rbx
+    27da:	                48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+            iter().rev().for_each([&](auto &v) -> void { v.~Type(); });
+    27de:	                48 8d 7c 24 60       	lea    0x60(%rsp),%rdi
+    27e3:	                e8 fc fe ff ff       	call   26e4 <nel::heapless::Queue<int, 4096ul>::iter()>
+            , e_(move(o.e_))
+    27e8:	                48 8b 44 24 68       	mov    0x68(%rsp),%rax
+            o.e_ = nullptr;
+    27ed:	                31 c9                	xor    %ecx,%ecx
+    27ef:	                31 f6                	xor    %esi,%esi
+            : b_(move(o.b_))
+    27f1:	                48 8b 5c 24 60       	mov    0x60(%rsp),%rbx
+    27f6:	                48 8b 6c 24 70       	mov    0x70(%rsp),%rbp
+            o.e_ = nullptr;
+    27fb:	                48 89 4c 24 60       	mov    %rcx,0x60(%rsp)
+            , e_(move(o.e_))
+    2800:	                48 89 44 24 48       	mov    %rax,0x48(%rsp)
+    2805:	                48 8b 44 24 78       	mov    0x78(%rsp),%rax
+            o.e_ = nullptr;
+    280a:	                48 89 4c 24 68       	mov    %rcx,0x68(%rsp)
+            , e_(move(o.e_))
+    280f:	                48 89 44 24 58       	mov    %rax,0x58(%rsp)
+            o.e_ = nullptr;
+    2814:	                48 89 74 24 70       	mov    %rsi,0x70(%rsp)
+    2819:	                48 89 74 24 78       	mov    %rsi,0x78(%rsp)
+            if (b_ == e_) { return None; }
+    281e:	/-------------> 48 8b 44 24 58       	mov    0x58(%rsp),%rax
+    2823:	|               48 39 c5             	cmp    %rax,%rbp
+    2826:	|           /-- 75 0a                	jne    2832 <nel::heapless::Queue<int, 4096ul>::~Queue()+0x6a>
+            : tag_(Tag::NONE)
+    2828:	|           |   c7 44 24 18 01 00 00 	movl   $0x1,0x18(%rsp)
+    282f:	|           |   00 
+        }
+    2830:	|        /--|-- eb 16                	jmp    2848 <nel::heapless::Queue<int, 4096ul>::~Queue()+0x80>
+            return Some(*--e_);
+    2832:	|        |  \-> 48 83 e8 04          	sub    $0x4,%rax
+            : tag_(Tag::SOME)
+    2836:	|        |      c7 44 24 18 02 00 00 	movl   $0x2,0x18(%rsp)
+    283d:	|        |      00 
+    283e:	|        |      48 89 44 24 58       	mov    %rax,0x58(%rsp)
+    2843:	|        |      48 89 44 24 20       	mov    %rax,0x20(%rsp)
+            auto tag = tag_;
+    2848:	|        \----> 8b 44 24 18          	mov    0x18(%rsp),%eax
+            , file_name_(file_name)
+    284c:	|               4c 8d 35 f5 08 00 00 	lea    0x8f5(%rip),%r14        # 3148 <_IO_stdin_used+0x148>
+            tag_ = Tag::INVAL;
+    2853:	|               31 d2                	xor    %edx,%edx
+            : fn_name_(fn_name)
+    2855:	|               4c 89 64 24 28       	mov    %r12,0x28(%rsp)
+            , file_name_(file_name)
+    285a:	|               4c 89 74 24 30       	mov    %r14,0x30(%rsp)
+            , line_num_(line_num)
+    285f:	|               c7 44 24 38 b4 02 00 	movl   $0x2b4,0x38(%rsp)
+    2866:	|               00 
+    2867:	|               89 54 24 18          	mov    %edx,0x18(%rsp)
+            switch (tag) { // optional::consume
+    286b:	|               83 f8 01             	cmp    $0x1,%eax
+    286e:	|        /----- 74 2d                	je     289d <nel::heapless::Queue<int, 4096ul>::~Queue()+0xd5>
+    2870:	|        |      83 f8 02             	cmp    $0x2,%eax
+    2873:	|        |  /-- 74 19                	je     288e <nel::heapless::Queue<int, 4096ul>::~Queue()+0xc6>
+    2875:	|        |  |   85 c0                	test   %eax,%eax
+                    nel::panic("bad Optional", ctx);
+    2877:	|        |  |   48 8d 3d be 07 00 00 	lea    0x7be(%rip),%rdi        # 303c <_IO_stdin_used+0x3c>
+    287e:	|        |  |   48 8d 74 24 28       	lea    0x28(%rsp),%rsi
+            switch (tag) { // optional::consume
+    2883:	|  /-----|--|-- 75 44                	jne    28c9 <nel::heapless::Queue<int, 4096ul>::~Queue()+0x101>
+                    nel::panic("invalid Optional", ctx);
+    2885:	|  |     |  |   48 8d 3d 9f 07 00 00 	lea    0x79f(%rip),%rdi        # 302b <_IO_stdin_used+0x2b>
+    288c:	|  +-----|--|-- eb 3b                	jmp    28c9 <nel::heapless::Queue<int, 4096ul>::~Queue()+0x101>
+            : tag_(Tag::SOME)
+    288e:	|  |     |  \-> c7 44 24 08 02 00 00 	movl   $0x2,0x8(%rsp)
+    2895:	|  |     |      00 
+    2896:	|  |     |      48 8b 44 24 20       	mov    0x20(%rsp),%rax
+    289b:	|  |  /--|----- eb 25                	jmp    28c2 <nel::heapless::Queue<int, 4096ul>::~Queue()+0xfa>
+            if (b_ == e_) { return None; }
+    289d:	|  |  |  \----> 48 8b 44 24 48       	mov    0x48(%rsp),%rax
+    28a2:	|  |  |         48 39 c3             	cmp    %rax,%rbx
+    28a5:	|  |  |     /-- 75 0a                	jne    28b1 <nel::heapless::Queue<int, 4096ul>::~Queue()+0xe9>
+            : tag_(Tag::NONE)
+    28a7:	|  |  |     |   c7 44 24 08 01 00 00 	movl   $0x1,0x8(%rsp)
+    28ae:	|  |  |     |   00 
+        }
+    28af:	|  |  |  /--|-- eb 1d                	jmp    28ce <nel::heapless::Queue<int, 4096ul>::~Queue()+0x106>
+            return Some(*--e_);
+    28b1:	|  |  |  |  \-> 48 83 e8 04          	sub    $0x4,%rax
+            : tag_(Tag::SOME)
+    28b5:	|  |  |  |      c7 44 24 08 02 00 00 	movl   $0x2,0x8(%rsp)
+    28bc:	|  |  |  |      00 
+    28bd:	|  |  |  |      48 89 44 24 48       	mov    %rax,0x48(%rsp)
+    28c2:	|  |  \--|----> 48 89 44 24 10       	mov    %rax,0x10(%rsp)
+};
+
+template<typename T>
+constexpr Optional<T> Some(T &&v)
+{
+    return Optional<T>::Some(forward<T>(v));
+    28c7:	|  |     +----- eb 05                	jmp    28ce <nel::heapless::Queue<int, 4096ul>::~Queue()+0x106>
+                    nel::panic("bad Optional", ctx);
+    28c9:	|  \-----|----> e8 24 e8 ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+                [&](void) -> Optional<OutT> { return it1_.next_back(); });
+    28ce:	|        \----> 48 8d 7c 24 18       	lea    0x18(%rsp),%rdi
+                if (r.is_none()) { break; }
+    28d3:	|               4c 8d 6c 24 08       	lea    0x8(%rsp),%r13
+                [&](void) -> Optional<OutT> { return it1_.next_back(); });
+    28d8:	|               e8 9f fc ff ff       	call   257c <nel::Optional<int&>::~Optional()>
+                if (r.is_none()) { break; }
+    28dd:	|               4c 89 ef             	mov    %r13,%rdi
+    28e0:	|               e8 b9 fb ff ff       	call   249e <nel::Optional<int&>::is_none() const>
+    28e5:	|               84 c0                	test   %al,%al
+    28e7:	|           /-- 75 33                	jne    291c <nel::heapless::Queue<int, 4096ul>::~Queue()+0x154>
+                fn(r.unwrap());
+    28e9:	|           |   4c 89 ef             	mov    %r13,%rdi
+    28ec:	|           |   48 8d 74 24 28       	lea    0x28(%rsp),%rsi
+            : fn_name_(fn_name)
+    28f1:	|           |   48 8d 05 fe 10 00 00 	lea    0x10fe(%rip),%rax        # 39f6 <_IO_stdin_used+0x9f6>
+            , file_name_(file_name)
+    28f8:	|           |   4c 89 74 24 30       	mov    %r14,0x30(%rsp)
+            : fn_name_(fn_name)
+    28fd:	|           |   48 89 44 24 28       	mov    %rax,0x28(%rsp)
+            , line_num_(line_num)
+    2902:	|           |   c7 44 24 38 ef 00 00 	movl   $0xef,0x38(%rsp)
+    2909:	|           |   00 
+    290a:	|           |   e8 a9 fc ff ff       	call   25b8 <nel::Optional<int&>::unwrap(nel::Context const&)>
+            while (true) {
+    290f:	|           |   4c 89 ef             	mov    %r13,%rdi
+    2912:	|           |   e8 65 fc ff ff       	call   257c <nel::Optional<int&>::~Optional()>
+    2917:	\-----------|-- e9 02 ff ff ff       	jmp    281e <nel::heapless::Queue<int, 4096ul>::~Queue()+0x56>
+    291c:	            \-> 4c 89 ef             	mov    %r13,%rdi
+    291f:	                e8 58 fc ff ff       	call   257c <nel::Optional<int&>::~Optional()>
+        }
+    2924:	                48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+    2928:	                5b                   	pop    %rbx
+    2929:	                5d                   	pop    %rbp
+    292a:	                41 5c                	pop    %r12
+    292c:	                41 5d                	pop    %r13
+    292e:	                41 5e                	pop    %r14
+    2930:	                c3                   	ret
+
+0000000000002931 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>:
+            if (new_cap > max_capacity) { return nullptr; }
+    2931:	             48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    2938:	             ff ff 1f 
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    293b:	             55                   	push   %rbp
+    293c:	             53                   	push   %rbx
+    293d:	             48 83 ec 38          	sub    $0x38,%rsp
+            if (new_cap > max_capacity) { return nullptr; }
+    2941:	             48 39 f0             	cmp    %rsi,%rax
+    2944:	/----------- 0f 82 9e 00 00 00    	jb     29e8 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0xb7>
+    294a:	|            48 89 f3             	mov    %rsi,%rbx
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    294d:	|            48 8d 34 b5 14 00 00 	lea    0x14(,%rsi,4),%rsi
+    2954:	|            00 
+                                    : std::realloc(p, new_size);
+    2955:	|            e8 36 e7 ff ff       	call   1090 <realloc@plt>
+            if (new_p == nullptr) {
+    295a:	|            48 85 c0             	test   %rax,%rax
+    295d:	|     /----- 75 12                	jne    2971 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x40>
+            : tag_(Tag::ERR)
+    295f:	|     |      c7 44 24 08 02 00 00 	movl   $0x2,0x8(%rsp)
+    2966:	|     |      00 
+    2967:	|     |      c7 44 24 10 01 00 00 	movl   $0x1,0x10(%rsp)
+    296e:	|     |      00 
+    296f:	|     |  /-- eb 0d                	jmp    297e <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x4d>
+            : tag_(Tag::OK)
+    2971:	|     \--|-> c7 44 24 08 01 00 00 	movl   $0x1,0x8(%rsp)
+    2978:	|        |   00 
+            : value_(forward<Args>(args)...)
+    2979:	|        |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            : fn_name_(fn_name)
+    297e:	|        \-> 48 8d 05 b9 10 00 00 	lea    0x10b9(%rip),%rax        # 3a3e <_IO_stdin_used+0xa3e>
+            , line_num_(line_num)
+    2985:	|            c7 44 24 28 89 00 00 	movl   $0x89,0x28(%rsp)
+    298c:	|            00 
+    298d:	|            48 8d 7c 24 08       	lea    0x8(%rsp),%rdi
+            : fn_name_(fn_name)
+    2992:	|            48 89 44 24 18       	mov    %rax,0x18(%rsp)
+            , file_name_(file_name)
+    2997:	|            48 8d 05 a8 10 00 00 	lea    0x10a8(%rip),%rax        # 3a46 <_IO_stdin_used+0xa46>
+    299e:	|            48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    29a3:	|            8b 44 24 08          	mov    0x8(%rsp),%eax
+            switch (tag_) { // result-match
+    29a7:	|            83 f8 01             	cmp    $0x1,%eax
+    29aa:	|     /----- 74 21                	je     29cd <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x9c>
+    29ac:	|     |      83 f8 02             	cmp    $0x2,%eax
+    29af:	|  /--|----- 74 32                	je     29e3 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0xb2>
+    29b1:	|  |  |      85 c0                	test   %eax,%eax
+                    nel::panic("invalid Result", ctx);
+    29b3:	|  |  |      48 8d 3d 23 10 00 00 	lea    0x1023(%rip),%rdi        # 39dd <_IO_stdin_used+0x9dd>
+    29ba:	|  |  |      48 8d 74 24 18       	lea    0x18(%rsp),%rsi
+            switch (tag_) { // result-match
+    29bf:	|  |  |  /-- 74 07                	je     29c8 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x97>
+                    nel::panic("bad Result", ctx);
+    29c1:	|  |  |  |   48 8d 3d 9b 06 00 00 	lea    0x69b(%rip),%rdi        # 3063 <_IO_stdin_used+0x63>
+    29c8:	|  |  |  \-> e8 25 e7 ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    29cd:	|  |  \----> 48 8b 6c 24 10       	mov    0x10(%rsp),%rbp
+            tag_ = Tag::INVAL;
+    29d2:	|  |         31 c0                	xor    %eax,%eax
+    29d4:	|  |         89 44 24 08          	mov    %eax,0x8(%rsp)
+            } else {
+    29d8:	|  |         e8 19 fb ff ff       	call   24f6 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+            new_n->alloc_ = new_cap;
+    29dd:	|  |         48 89 5d 00          	mov    %rbx,0x0(%rbp)
+            return new_n;
+    29e1:	|  |     /-- eb 07                	jmp    29ea <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0xb9>
+            } else {
+    29e3:	|  \-----|-> e8 0e fb ff ff       	call   24f6 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+            if (new_cap > max_capacity) { return nullptr; }
+    29e8:	\--------|-> 31 ed                	xor    %ebp,%ebp
+        }
+    29ea:	         \-> 48 83 c4 38          	add    $0x38,%rsp
+    29ee:	             48 89 e8             	mov    %rbp,%rax
+    29f1:	             5b                   	pop    %rbx
+    29f2:	             5d                   	pop    %rbp
+    29f3:	             c3                   	ret
+
+00000000000029f4 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    29f4:	53                   	push   %rbx
+    29f5:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    29f8:	40 0f be fe          	movsbl %sil,%edi
+    29fc:	48 8b 35 5d 36 00 00 	mov    0x365d(%rip),%rsi        # 6060 <stderr@GLIBC_2.2.5>
+    2a03:	e8 68 e6 ff ff       	call   1070 <fputc@plt>
+    return outs;
+}
+    2a08:	48 89 d8             	mov    %rbx,%rax
+    2a0b:	5b                   	pop    %rbx
+    2a0c:	c3                   	ret
+
+0000000000002a0d <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    2a0d:	53                   	push   %rbx
+    2a0e:	48 89 fb             	mov    %rdi,%rbx
+    2a11:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    2a14:	48 8b 35 45 36 00 00 	mov    0x3645(%rip),%rsi        # 6060 <stderr@GLIBC_2.2.5>
+    2a1b:	e8 40 e6 ff ff       	call   1060 <fputs@plt>
+    return outs;
+}
+    2a20:	48 89 d8             	mov    %rbx,%rax
+    2a23:	5b                   	pop    %rbx
+    2a24:	c3                   	ret
+
+0000000000002a25 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    2a25:	53                   	push   %rbx
+    2a26:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    2a29:	48 8b 3d 30 36 00 00 	mov    0x3630(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+    2a30:	40 0f b6 d6          	movzbl %sil,%edx
+    2a34:	31 c0                	xor    %eax,%eax
+    2a36:	48 8d 35 7b 10 00 00 	lea    0x107b(%rip),%rsi        # 3ab8 <sizes+0x58>
+    2a3d:	e8 3e e6 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    2a42:	48 89 d8             	mov    %rbx,%rax
+    2a45:	5b                   	pop    %rbx
+    2a46:	c3                   	ret
+
+0000000000002a47 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    2a47:	53                   	push   %rbx
+    2a48:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    2a4b:	48 8b 3d 0e 36 00 00 	mov    0x360e(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+    2a52:	0f b7 d6             	movzwl %si,%edx
+    2a55:	31 c0                	xor    %eax,%eax
+    2a57:	48 8d 35 5a 10 00 00 	lea    0x105a(%rip),%rsi        # 3ab8 <sizes+0x58>
+    2a5e:	e8 1d e6 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    2a63:	48 89 d8             	mov    %rbx,%rax
+    2a66:	5b                   	pop    %rbx
+    2a67:	c3                   	ret
+
+0000000000002a68 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    2a68:	53                   	push   %rbx
+    2a69:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    2a6c:	48 8b 3d ed 35 00 00 	mov    0x35ed(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+{
+    2a73:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    2a75:	31 c0                	xor    %eax,%eax
+    2a77:	48 8d 35 3a 10 00 00 	lea    0x103a(%rip),%rsi        # 3ab8 <sizes+0x58>
+    2a7e:	e8 fd e5 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    2a83:	48 89 d8             	mov    %rbx,%rax
+    2a86:	5b                   	pop    %rbx
+    2a87:	c3                   	ret
+
+0000000000002a88 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    2a88:	53                   	push   %rbx
+    2a89:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    2a8c:	48 8b 3d cd 35 00 00 	mov    0x35cd(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+{
+    2a93:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    2a95:	31 c0                	xor    %eax,%eax
+    2a97:	48 8d 35 1a 10 00 00 	lea    0x101a(%rip),%rsi        # 3ab8 <sizes+0x58>
+    2a9e:	e8 dd e5 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    2aa3:	48 89 d8             	mov    %rbx,%rax
+    2aa6:	5b                   	pop    %rbx
+    2aa7:	c3                   	ret
+
+0000000000002aa8 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    2aa8:	53                   	push   %rbx
+    2aa9:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    2aac:	48 8b 3d ad 35 00 00 	mov    0x35ad(%rip),%rdi        # 6060 <stderr@GLIBC_2.2.5>
+{
+    2ab3:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    2ab6:	31 c0                	xor    %eax,%eax
+    2ab8:	48 8d 35 fc 0f 00 00 	lea    0xffc(%rip),%rsi        # 3abb <sizes+0x5b>
+    2abf:	e8 bc e5 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    2ac4:	48 89 d8             	mov    %rbx,%rax
+    2ac7:	5b                   	pop    %rbx
+    2ac8:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000002acc <_fini>:
+    2acc:	48 83 ec 08          	sub    $0x8,%rsp
+    2ad0:	48 83 c4 08          	add    $0x8,%rsp
+    2ad4:	c3                   	ret
@@ -0,0 +1,2225 @@
+
+target/minsize/examples/bench_parse:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 6f 00 00 	mov    0x6fc5(%rip),%rax        # 7fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <abort@plt-0x10>:
+    1020:	ff 35 ca 6f 00 00    	push   0x6fca(%rip)        # 7ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 6f 00 00    	jmp    *0x6fcc(%rip)        # 7ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <abort@plt>:
+    1030:	ff 25 ca 6f 00 00    	jmp    *0x6fca(%rip)        # 8000 <abort@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <strtod@plt>:
+    1040:	ff 25 c2 6f 00 00    	jmp    *0x6fc2(%rip)        # 8008 <strtod@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <clock_gettime@plt>:
+    1050:	ff 25 ba 6f 00 00    	jmp    *0x6fba(%rip)        # 8010 <clock_gettime@GLIBC_2.17>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputs@plt>:
+    1060:	ff 25 b2 6f 00 00    	jmp    *0x6fb2(%rip)        # 8018 <fputs@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 6f 00 00    	jmp    *0x6faa(%rip)        # 8020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <strtoull@plt>:
+    1080:	ff 25 a2 6f 00 00    	jmp    *0x6fa2(%rip)        # 8028 <strtoull@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 6f 00 00    	jmp    *0x6f9a(%rip)        # 8030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010a0 <__cxa_finalize@plt>:
+    10a0:	ff 25 3a 6f 00 00    	jmp    *0x6f3a(%rip)        # 7fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10a6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010b0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10b0:	50                   	push   %rax
+    std::abort();
+    10b1:	e8 7a ff ff ff       	call   1030 <abort@plt>
+
+00000000000010b6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10b6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10b7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10ba:	4c 8d 0d f7 1f 00 00 	lea    0x1ff7(%rip),%r9        # 30b8 <_IO_stdin_used+0xb8>
+    10c1:	31 c0                	xor    %eax,%eax
+    10c3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10c7:	4c 8b 07             	mov    (%rdi),%r8
+    10ca:	48 8d 35 ed 1f 00 00 	lea    0x1fed(%rip),%rsi        # 30be <_IO_stdin_used+0xbe>
+    10d1:	48 8b 3d 88 6f 00 00 	mov    0x6f88(%rip),%rdi        # 8060 <stderr@GLIBC_2.2.5>
+    10d8:	e8 b3 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    10dd:	e8 4e ff ff ff       	call   1030 <abort@plt>
+
+00000000000010e2 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    10e2:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    10e6:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    10e9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    10ed:	31 c0                	xor    %eax,%eax
+    10ef:	57                   	push   %rdi
+    10f0:	48 8b 3d 69 6f 00 00 	mov    0x6f69(%rip),%rdi        # 8060 <stderr@GLIBC_2.2.5>
+    10f7:	4c 8d 0d ba 1f 00 00 	lea    0x1fba(%rip),%r9        # 30b8 <_IO_stdin_used+0xb8>
+    10fe:	4c 8b 06             	mov    (%rsi),%r8
+    1101:	48 8d 35 c7 1f 00 00 	lea    0x1fc7(%rip),%rsi        # 30cf <_IO_stdin_used+0xcf>
+    1108:	e8 83 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    110d:	e8 1e ff ff ff       	call   1030 <abort@plt>
+
+0000000000001112 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1112:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1116:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1119:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    111d:	31 c0                	xor    %eax,%eax
+    111f:	57                   	push   %rdi
+    1120:	48 8b 3d 39 6f 00 00 	mov    0x6f39(%rip),%rdi        # 8060 <stderr@GLIBC_2.2.5>
+    1127:	4c 8d 0d b6 1f 00 00 	lea    0x1fb6(%rip),%r9        # 30e4 <_IO_stdin_used+0xe4>
+    112e:	4c 8b 06             	mov    (%rsi),%r8
+    1131:	48 8d 35 97 1f 00 00 	lea    0x1f97(%rip),%rsi        # 30cf <_IO_stdin_used+0xcf>
+    1138:	e8 53 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    113d:	e8 ee fe ff ff       	call   1030 <abort@plt>
+
+0000000000001142 <main>:
+{
+    return nel::Slice<unsigned char const>(reinterpret_cast<unsigned char const *>(p), n);
+}
+
+int main()
+{
+    1142:	                      41 57                	push   %r15
+    nel::Index i = 0;
+    1144:	                      31 ff                	xor    %edi,%edi
+{
+    1146:	                      41 56                	push   %r14
+    1148:	                      41 55                	push   %r13
+    114a:	                      41 54                	push   %r12
+    114c:	                      55                   	push   %rbp
+    114d:	                      53                   	push   %rbx
+    114e:	                      48 8d 1d 2b 6f 00 00 	lea    0x6f2b(%rip),%rbx        # 8080 <buf>
+    1155:	                      48 83 ec 78          	sub    $0x78,%rsp
+    unsigned int seed = 0x12345678;
+    1159:	                      c7 44 24 40 78 56 34 	movl   $0x12345678,0x40(%rsp)
+    1160:	                      12 
+    nel::Index i = 0;
+    1161:	                      48 89 7c 24 58       	mov    %rdi,0x58(%rsp)
+    while (i + 64 < n_bytes) {
+    1166:	         /----------> 48 8b 6c 24 58       	mov    0x58(%rsp),%rbp
+    116b:	         |            48 8d 45 40          	lea    0x40(%rbp),%rax
+    116f:	         |            48 3d ff ff 0f 00    	cmp    $0xfffff,%rax
+    1175:	         |            48 8d 44 24 58       	lea    0x58(%rsp),%rax
+    117a:	         |            48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    117f:	         |  /-------- 77 4b                	ja     11cc <main+0x8a>
+        nel::Length const n = (next_rand(seed) % 4 == 0) ? 1 + next_rand(seed) % 19
+    1181:	         |  |         48 8d 74 24 40       	lea    0x40(%rsp),%rsi
+    1186:	         |  |         48 89 f7             	mov    %rsi,%rdi
+    1189:	         |  |         e8 ab 05 00 00       	call   1739 <next_rand(unsigned int&)>
+    118e:	         |  |         a8 03                	test   $0x3,%al
+    1190:	         |  |  /----- 75 0c                	jne    119e <main+0x5c>
+    1192:	         |  |  |      e8 a2 05 00 00       	call   1739 <next_rand(unsigned int&)>
+    1197:	         |  |  |      b9 13 00 00 00       	mov    $0x13,%ecx
+    119c:	         |  |  |  /-- eb 0a                	jmp    11a8 <main+0x66>
+                                                         : 1 + next_rand(seed) % 6;
+    119e:	         |  |  \--|-> e8 96 05 00 00       	call   1739 <next_rand(unsigned int&)>
+    11a3:	         |  |     |   b9 06 00 00 00       	mov    $0x6,%ecx
+    11a8:	         |  |     \-> 31 d2                	xor    %edx,%edx
+        put_digits(i, seed, n);
+    11aa:	         |  |         48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+                                                         : 1 + next_rand(seed) % 6;
+    11af:	         |  |         f7 f1                	div    %ecx
+    11b1:	         |  |         ff c2                	inc    %edx
+        put_digits(i, seed, n);
+    11b3:	         |  |         e8 b8 05 00 00       	call   1770 <put_digits(unsigned long&, unsigned int&, unsigned long)>
+        buf[i++] = '\n';
+    11b8:	         |  |         48 8b 44 24 58       	mov    0x58(%rsp),%rax
+    11bd:	         |  |         48 8d 50 01          	lea    0x1(%rax),%rdx
+    11c1:	         |  |         c6 04 03 0a          	movb   $0xa,(%rbx,%rax,1)
+    11c5:	         |  |         48 89 54 24 58       	mov    %rdx,0x58(%rsp)
+    11ca:	         \--|-------- eb 9a                	jmp    1166 <main+0x24>
+    {
+        nel::Length const n = fill_ints();
+        nel::log << n << " bytes of ints\n";
+    11cc:	            \-------> 48 89 ee             	mov    %rbp,%rsi
+    buf[i] = '\0';
+    11cf:	                      c6 04 2b 00          	movb   $0x0,(%rbx,%rbp,1)
+
+// Time a run of f(), in ns.
+template<typename F>
+long unsigned int time_ns(F &&f)
+{
+    long unsigned int const b = now_ns();
+    11d3:	                      41 bf 0a 00 00 00    	mov    $0xa,%r15d
+    Sum r = 0;
+    11d9:	                      45 31 e4             	xor    %r12d,%r12d
+        nel::log << n << " bytes of ints\n";
+    11dc:	                      48 8d 3d 9e 6e 10 00 	lea    0x106e9e(%rip),%rdi        # 108081 <nel::log>
+    11e3:	                      e8 83 07 00 00       	call   196b <nel::operator<<(nel::Log&, unsigned long)>
+    11e8:	                      48 8d 35 20 1e 00 00 	lea    0x1e20(%rip),%rsi        # 300f <_IO_stdin_used+0xf>
+    11ef:	                      48 89 c7             	mov    %rax,%rdi
+    11f2:	                      e8 d9 06 00 00       	call   18d0 <nel::operator<<(nel::Log&, char const*)>
+    11f7:	                      e8 f6 05 00 00       	call   17f2 <bench::now_ns()>
+    11fc:	                      49 89 c5             	mov    %rax,%r13
+            nel::Index i = 0;
+    11ff:	               /----> 45 31 f6             	xor    %r14d,%r14d
+                i += parse_one(buf + i, n - i, r) + 1;
+    1202:	               |  /-> 4a 8d 0c 33          	lea    (%rbx,%r14,1),%rcx
+        run("  strtoull   ", n, [](char const *p, nel::Length, Sum &r) -> nel::Length {
+            char *e;
+            r += std::strtoull(p, &e, 10);
+    1206:	               |  |   48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    120b:	               |  |   ba 0a 00 00 00       	mov    $0xa,%edx
+    1210:	               |  |   48 89 cf             	mov    %rcx,%rdi
+    1213:	               |  |   48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+    1218:	               |  |   e8 63 fe ff ff       	call   1080 <strtoull@plt>
+            return nel::Length(e - p);
+    121d:	               |  |   48 8b 4c 24 10       	mov    0x10(%rsp),%rcx
+            r += std::strtoull(p, &e, 10);
+    1222:	               |  |   49 01 c4             	add    %rax,%r12
+            return nel::Length(e - p);
+    1225:	               |  |   48 8b 44 24 58       	mov    0x58(%rsp),%rax
+    122a:	               |  |   48 29 c8             	sub    %rcx,%rax
+                i += parse_one(buf + i, n - i, r) + 1;
+    122d:	               |  |   4d 8d 74 06 01       	lea    0x1(%r14,%rax,1),%r14
+            while (i < n) {
+    1232:	               |  |   49 39 ee             	cmp    %rbp,%r14
+    1235:	               |  \-- 72 cb                	jb     1202 <main+0xc0>
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    1237:	               |      49 ff cf             	dec    %r15
+    123a:	               \----- 75 c3                	jne    11ff <main+0xbd>
+    f();
+    return now_ns() - b;
+    123c:	                      e8 b1 05 00 00       	call   17f2 <bench::now_ns()>
+    bench::report(name, t, n_reps * n);
+    1241:	                      48 6b cd 0a          	imul   $0xa,%rbp,%rcx
+    1245:	                      48 8d 3d d3 1d 00 00 	lea    0x1dd3(%rip),%rdi        # 301f <_IO_stdin_used+0x1f>
+    124c:	                      4c 29 e8             	sub    %r13,%rax
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    124f:	                      4c 8d 35 df 1d 00 00 	lea    0x1ddf(%rip),%r14        # 3035 <_IO_stdin_used+0x35>
+    1256:	                      48 89 c6             	mov    %rax,%rsi
+    1259:	                      48 89 ca             	mov    %rcx,%rdx
+    125c:	                      48 89 4c 24 18       	mov    %rcx,0x18(%rsp)
+    1261:	                      e8 af 05 00 00       	call   1815 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << r << '\n';
+    1266:	                      48 8d 35 c0 1d 00 00 	lea    0x1dc0(%rip),%rsi        # 302d <_IO_stdin_used+0x2d>
+    126d:	                      48 8d 3d 0d 6e 10 00 	lea    0x106e0d(%rip),%rdi        # 108081 <nel::log>
+    1274:	                      e8 57 06 00 00       	call   18d0 <nel::operator<<(nel::Log&, char const*)>
+    1279:	                      4c 89 e6             	mov    %r12,%rsi
+    Sum r = 0;
+    127c:	                      45 31 e4             	xor    %r12d,%r12d
+    nel::log << "  sum: " << r << '\n';
+    127f:	                      48 89 c7             	mov    %rax,%rdi
+    1282:	                      e8 e4 06 00 00       	call   196b <nel::operator<<(nel::Log&, unsigned long)>
+    1287:	                      be 0a 00 00 00       	mov    $0xa,%esi
+    128c:	                      48 89 c7             	mov    %rax,%rdi
+    128f:	                      e8 23 06 00 00       	call   18b7 <nel::operator<<(nel::Log&, char)>
+    long unsigned int const b = now_ns();
+    1294:	                      e8 59 05 00 00       	call   17f2 <bench::now_ns()>
+    1299:	                      ba 0a 00 00 00       	mov    $0xa,%edx
+    129e:	                      49 89 c5             	mov    %rax,%r13
+            nel::Index i = 0;
+    12a1:	               /----> 45 31 ff             	xor    %r15d,%r15d
+                i += parse_one(buf + i, n - i, r) + 1;
+    12a4:	               |  /-> 4a 8d 0c 3b          	lea    (%rbx,%r15,1),%rcx
+        });
+        run("  parse_u64  ", n, [](char const *p, nel::Length const n, Sum &r) {
+            auto const v = nel::parse_u64(field(p, n)).unwrap();
+    12a8:	               |  |   48 8d 44 24 40       	lea    0x40(%rsp),%rax
+    12ad:	               |  |   48 89 54 24 28       	mov    %rdx,0x28(%rsp)
+    12b2:	               |  |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    12b7:	               |  |   48 8d 44 24 30       	lea    0x30(%rsp),%rax
+    12bc:	               |  |   48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+                i += parse_one(buf + i, n - i, r) + 1;
+    12c1:	               |  |   48 89 4c 24 30       	mov    %rcx,0x30(%rsp)
+    12c6:	               |  |   48 89 e9             	mov    %rbp,%rcx
+            auto const v = nel::parse_u64(field(p, n)).unwrap();
+    12c9:	               |  |   48 89 c6             	mov    %rax,%rsi
+                i += parse_one(buf + i, n - i, r) + 1;
+    12cc:	               |  |   4c 29 f9             	sub    %r15,%rcx
+            auto const v = nel::parse_u64(field(p, n)).unwrap();
+    12cf:	               |  |   48 89 44 24 20       	mov    %rax,0x20(%rsp)
+                i += parse_one(buf + i, n - i, r) + 1;
+    12d4:	               |  |   48 89 4c 24 38       	mov    %rcx,0x38(%rsp)
+            auto const v = nel::parse_u64(field(p, n)).unwrap();
+    12d9:	               |  |   e8 42 0b 00 00       	call   1e20 <nel::parse_u64(nel::Slice<unsigned char const> const&)>
+        template<typename V, typename Fn1, typename Fn2>
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+        {
+            // a consuming matcher..
+            // that moves the value to the closures..
+            auto tag = tag_;
+    12de:	               |  |   8b 4c 24 40          	mov    0x40(%rsp),%ecx
+            tag_ = Tag::INVAL;
+    12e2:	               |  |   31 f6                	xor    %esi,%esi
+    12e4:	               |  |   4c 89 74 24 58       	mov    %r14,0x58(%rsp)
+            , file_name_(file_name)
+    12e9:	               |  |   48 8d 05 50 1d 00 00 	lea    0x1d50(%rip),%rax        # 3040 <_IO_stdin_used+0x40>
+    12f0:	               |  |   89 74 24 40          	mov    %esi,0x40(%rsp)
+            switch (tag) { // result-consume
+    12f4:	               |  |   48 8b 54 24 28       	mov    0x28(%rsp),%rdx
+    12f9:	               |  |   83 f9 01             	cmp    $0x1,%ecx
+    12fc:	               |  |   48 89 44 24 60       	mov    %rax,0x60(%rsp)
+            , line_num_(line_num)
+    1301:	               |  |   c7 44 24 68 75 00 00 	movl   $0x75,0x68(%rsp)
+    1308:	               |  |   00 
+    1309:	/--------------|--|-- 0f 85 9f 02 00 00    	jne    15ae <main+0x46c>
+                i += parse_one(buf + i, n - i, r) + 1;
+    130f:	|              |  |   48 8b 4c 24 50       	mov    0x50(%rsp),%rcx
+            r += v.first;
+    1314:	|              |  |   4c 03 64 24 48       	add    0x48(%rsp),%r12
+                i += parse_one(buf + i, n - i, r) + 1;
+    1319:	|              |  |   4d 8d 7c 0f 01       	lea    0x1(%r15,%rcx,1),%r15
+            while (i < n) {
+    131e:	|              |  |   49 39 ef             	cmp    %rbp,%r15
+    1321:	|              |  \-- 72 81                	jb     12a4 <main+0x162>
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    1323:	|              |      48 ff ca             	dec    %rdx
+    1326:	|              \----- 0f 85 75 ff ff ff    	jne    12a1 <main+0x15f>
+    return now_ns() - b;
+    132c:	|                     e8 c1 04 00 00       	call   17f2 <bench::now_ns()>
+    bench::report(name, t, n_reps * n);
+    1331:	|                     48 8b 54 24 18       	mov    0x18(%rsp),%rdx
+    1336:	|                     48 8d 3d 3f 1d 00 00 	lea    0x1d3f(%rip),%rdi        # 307c <_IO_stdin_used+0x7c>
+    133d:	|                     4c 29 e8             	sub    %r13,%rax
+    1340:	|                     48 89 c6             	mov    %rax,%rsi
+    1343:	|                     e8 cd 04 00 00       	call   1815 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << r << '\n';
+    1348:	|                     48 8d 35 de 1c 00 00 	lea    0x1cde(%rip),%rsi        # 302d <_IO_stdin_used+0x2d>
+    134f:	|                     48 8d 3d 2b 6d 10 00 	lea    0x106d2b(%rip),%rdi        # 108081 <nel::log>
+    1356:	|                     e8 75 05 00 00       	call   18d0 <nel::operator<<(nel::Log&, char const*)>
+    135b:	|                     4c 89 e6             	mov    %r12,%rsi
+        put_digits(i, seed, 1 + next_rand(seed) % 5);
+    135e:	|                     41 bc 05 00 00 00    	mov    $0x5,%r12d
+    nel::log << "  sum: " << r << '\n';
+    1364:	|                     48 89 c7             	mov    %rax,%rdi
+    1367:	|                     e8 ff 05 00 00       	call   196b <nel::operator<<(nel::Log&, unsigned long)>
+    136c:	|                     be 0a 00 00 00       	mov    $0xa,%esi
+    1371:	|                     48 89 c7             	mov    %rax,%rdi
+    1374:	|                     e8 3e 05 00 00       	call   18b7 <nel::operator<<(nel::Log&, char)>
+    nel::Index i = 0;
+    1379:	|                     31 d2                	xor    %edx,%edx
+    unsigned int seed = 0x12345678;
+    137b:	|                     c7 44 24 40 78 56 34 	movl   $0x12345678,0x40(%rsp)
+    1382:	|                     12 
+    nel::Index i = 0;
+    1383:	|                     48 89 54 24 58       	mov    %rdx,0x58(%rsp)
+    while (i + 64 < n_bytes) {
+    1388:	|           /-------> 48 8b 6c 24 58       	mov    0x58(%rsp),%rbp
+    138d:	|           |         48 8d 45 40          	lea    0x40(%rbp),%rax
+    1391:	|           |         48 3d ff ff 0f 00    	cmp    $0xfffff,%rax
+    1397:	|           |  /----- 0f 87 c8 00 00 00    	ja     1465 <main+0x323>
+        if (next_rand(seed) % 2 == 0) { buf[i++] = '-'; }
+    139d:	|           |  |      48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    13a2:	|           |  |      e8 92 03 00 00       	call   1739 <next_rand(unsigned int&)>
+    13a7:	|           |  |      a8 01                	test   $0x1,%al
+    13a9:	|           |  |  /-- 75 0d                	jne    13b8 <main+0x276>
+    13ab:	|           |  |  |   48 8d 45 01          	lea    0x1(%rbp),%rax
+    13af:	|           |  |  |   c6 04 2b 2d          	movb   $0x2d,(%rbx,%rbp,1)
+    13b3:	|           |  |  |   48 89 44 24 58       	mov    %rax,0x58(%rsp)
+        put_digits(i, seed, 1 + next_rand(seed) % 5);
+    13b8:	|           |  |  \-> 48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    13bd:	|           |  |      31 d2                	xor    %edx,%edx
+    13bf:	|           |  |      e8 75 03 00 00       	call   1739 <next_rand(unsigned int&)>
+    13c4:	|           |  |      48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    13c9:	|           |  |      48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    13ce:	|           |  |      41 f7 f4             	div    %r12d
+    13d1:	|           |  |      ff c2                	inc    %edx
+    13d3:	|           |  |      e8 98 03 00 00       	call   1770 <put_digits(unsigned long&, unsigned int&, unsigned long)>
+        buf[i++] = '.';
+    13d8:	|           |  |      48 8b 44 24 58       	mov    0x58(%rsp),%rax
+        put_digits(i, seed, 1 + next_rand(seed) % 12);
+    13dd:	|           |  |      48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    13e2:	|           |  |      b9 0c 00 00 00       	mov    $0xc,%ecx
+        buf[i++] = '.';
+    13e7:	|           |  |      48 8d 50 01          	lea    0x1(%rax),%rdx
+    13eb:	|           |  |      c6 04 03 2e          	movb   $0x2e,(%rbx,%rax,1)
+    13ef:	|           |  |      48 89 54 24 58       	mov    %rdx,0x58(%rsp)
+        put_digits(i, seed, 1 + next_rand(seed) % 12);
+    13f4:	|           |  |      31 d2                	xor    %edx,%edx
+    13f6:	|           |  |      e8 3e 03 00 00       	call   1739 <next_rand(unsigned int&)>
+    13fb:	|           |  |      48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    1400:	|           |  |      48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1405:	|           |  |      f7 f1                	div    %ecx
+    1407:	|           |  |      ff c2                	inc    %edx
+    1409:	|           |  |      e8 62 03 00 00       	call   1770 <put_digits(unsigned long&, unsigned int&, unsigned long)>
+        if (next_rand(seed) % 4 == 0) {
+    140e:	|           |  |      48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    1413:	|           |  |      e8 21 03 00 00       	call   1739 <next_rand(unsigned int&)>
+    1418:	|           |  |      a8 03                	test   $0x3,%al
+    141a:	|           |  |  /-- 75 32                	jne    144e <main+0x30c>
+            buf[i++] = 'e';
+    141c:	|           |  |  |   48 8b 44 24 58       	mov    0x58(%rsp),%rax
+            put_digits(i, seed, 1 + next_rand(seed) % 2);
+    1421:	|           |  |  |   48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+            buf[i++] = 'e';
+    1426:	|           |  |  |   48 8d 50 01          	lea    0x1(%rax),%rdx
+    142a:	|           |  |  |   c6 04 03 65          	movb   $0x65,(%rbx,%rax,1)
+    142e:	|           |  |  |   48 89 54 24 58       	mov    %rdx,0x58(%rsp)
+            put_digits(i, seed, 1 + next_rand(seed) % 2);
+    1433:	|           |  |  |   e8 01 03 00 00       	call   1739 <next_rand(unsigned int&)>
+    1438:	|           |  |  |   48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    143d:	|           |  |  |   48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    1442:	|           |  |  |   83 e0 01             	and    $0x1,%eax
+    1445:	|           |  |  |   48 8d 50 01          	lea    0x1(%rax),%rdx
+    1449:	|           |  |  |   e8 22 03 00 00       	call   1770 <put_digits(unsigned long&, unsigned int&, unsigned long)>
+        buf[i++] = '\n';
+    144e:	|           |  |  \-> 48 8b 44 24 58       	mov    0x58(%rsp),%rax
+    1453:	|           |  |      48 8d 50 01          	lea    0x1(%rax),%rdx
+    1457:	|           |  |      c6 04 03 0a          	movb   $0xa,(%rbx,%rax,1)
+    145b:	|           |  |      48 89 54 24 58       	mov    %rdx,0x58(%rsp)
+    1460:	|           \--|----- e9 23 ff ff ff       	jmp    1388 <main+0x246>
+            return v.second;
+        });
+    }
+    {
+        nel::Length const n = fill_floats();
+        nel::log << n << " bytes of floats\n";
+    1465:	|              \----> 48 89 ee             	mov    %rbp,%rsi
+    1468:	|                     48 8d 3d 12 6c 10 00 	lea    0x106c12(%rip),%rdi        # 108081 <nel::log>
+    buf[i] = '\0';
+    146f:	|                     c6 04 2b 00          	movb   $0x0,(%rbx,%rbp,1)
+    Sum r = 0;
+    1473:	|                     45 31 e4             	xor    %r12d,%r12d
+        nel::log << n << " bytes of floats\n";
+    1476:	|                     e8 f0 04 00 00       	call   196b <nel::operator<<(nel::Log&, unsigned long)>
+    147b:	|                     48 8d 35 08 1c 00 00 	lea    0x1c08(%rip),%rsi        # 308a <_IO_stdin_used+0x8a>
+    1482:	|                     48 89 c7             	mov    %rax,%rdi
+    1485:	|                     e8 46 04 00 00       	call   18d0 <nel::operator<<(nel::Log&, char const*)>
+    long unsigned int const b = now_ns();
+    148a:	|                     e8 63 03 00 00       	call   17f2 <bench::now_ns()>
+    148f:	|                     49 89 c5             	mov    %rax,%r13
+    1492:	|                     b8 0a 00 00 00       	mov    $0xa,%eax
+            nel::Index i = 0;
+    1497:	|              /----> 45 31 ff             	xor    %r15d,%r15d
+                i += parse_one(buf + i, n - i, r) + 1;
+    149a:	|              |  /-> 4a 8d 0c 3b          	lea    (%rbx,%r15,1),%rcx
+        run("  strtod     ", n, [](char const *p, nel::Length, Sum &r) -> nel::Length {
+            char *e;
+            r += bits(std::strtod(p, &e));
+    149e:	|              |  |   48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    14a3:	|              |  |   48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    14a8:	|              |  |   48 89 cf             	mov    %rcx,%rdi
+    14ab:	|              |  |   48 89 4c 24 18       	mov    %rcx,0x18(%rsp)
+    14b0:	|              |  |   e8 8b fb ff ff       	call   1040 <strtod@plt>
+            return nel::Length(e - p);
+    14b5:	|              |  |   48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+    14ba:	|              |  |   48 8b 4c 24 18       	mov    0x18(%rsp),%rcx
+            r += bits(std::strtod(p, &e));
+    14bf:	|              |  |   66 48 0f 7e c0       	movq   %xmm0,%rax
+            return nel::Length(e - p);
+    14c4:	|              |  |   48 29 ca             	sub    %rcx,%rdx
+            r += bits(std::strtod(p, &e));
+    14c7:	|              |  |   49 01 c4             	add    %rax,%r12
+            while (i < n) {
+    14ca:	|              |  |   48 8b 44 24 28       	mov    0x28(%rsp),%rax
+                i += parse_one(buf + i, n - i, r) + 1;
+    14cf:	|              |  |   4d 8d 7c 17 01       	lea    0x1(%r15,%rdx,1),%r15
+            while (i < n) {
+    14d4:	|              |  |   49 39 ef             	cmp    %rbp,%r15
+    14d7:	|              |  \-- 72 c1                	jb     149a <main+0x358>
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    14d9:	|              |      48 ff c8             	dec    %rax
+    14dc:	|              \----- 75 b9                	jne    1497 <main+0x355>
+    return now_ns() - b;
+    14de:	|                     e8 0f 03 00 00       	call   17f2 <bench::now_ns()>
+    bench::report(name, t, n_reps * n);
+    14e3:	|                     48 6b cd 0a          	imul   $0xa,%rbp,%rcx
+    14e7:	|                     48 8d 3d ae 1b 00 00 	lea    0x1bae(%rip),%rdi        # 309c <_IO_stdin_used+0x9c>
+    14ee:	|                     4c 29 e8             	sub    %r13,%rax
+    14f1:	|                     48 89 c6             	mov    %rax,%rsi
+    14f4:	|                     48 89 ca             	mov    %rcx,%rdx
+    14f7:	|                     48 89 4c 24 18       	mov    %rcx,0x18(%rsp)
+    14fc:	|                     e8 14 03 00 00       	call   1815 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << r << '\n';
+    1501:	|                     48 8d 35 25 1b 00 00 	lea    0x1b25(%rip),%rsi        # 302d <_IO_stdin_used+0x2d>
+    1508:	|                     48 8d 3d 72 6b 10 00 	lea    0x106b72(%rip),%rdi        # 108081 <nel::log>
+    150f:	|                     e8 bc 03 00 00       	call   18d0 <nel::operator<<(nel::Log&, char const*)>
+    1514:	|                     4c 89 e6             	mov    %r12,%rsi
+    Sum r = 0;
+    1517:	|                     45 31 e4             	xor    %r12d,%r12d
+    nel::log << "  sum: " << r << '\n';
+    151a:	|                     48 89 c7             	mov    %rax,%rdi
+    151d:	|                     e8 49 04 00 00       	call   196b <nel::operator<<(nel::Log&, unsigned long)>
+    1522:	|                     be 0a 00 00 00       	mov    $0xa,%esi
+    1527:	|                     48 89 c7             	mov    %rax,%rdi
+    152a:	|                     e8 88 03 00 00       	call   18b7 <nel::operator<<(nel::Log&, char)>
+    long unsigned int const b = now_ns();
+    152f:	|                     e8 be 02 00 00       	call   17f2 <bench::now_ns()>
+    1534:	|                     ba 0a 00 00 00       	mov    $0xa,%edx
+    1539:	|                     49 89 c5             	mov    %rax,%r13
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    153c:	|  /----------------- e9 a3 00 00 00       	jmp    15e4 <main+0x4a2>
+                i += parse_one(buf + i, n - i, r) + 1;
+    1541:	|  |              /-> 48 8b 4c 24 50       	mov    0x50(%rsp),%rcx
+        });
+        run("  parse_f64  ", n, [](char const *p, nel::Length const n, Sum &r) {
+            auto const v = nel::parse_f64(field(p, n)).unwrap();
+            r += bits(v.first);
+    1546:	|  |              |   4c 03 64 24 48       	add    0x48(%rsp),%r12
+                i += parse_one(buf + i, n - i, r) + 1;
+    154b:	|  |              |   4d 8d 7c 0f 01       	lea    0x1(%r15,%rcx,1),%r15
+            while (i < n) {
+    1550:	|  |              |   49 39 ef             	cmp    %rbp,%r15
+    1553:	|  |  /-----------|-- 0f 83 93 00 00 00    	jae    15ec <main+0x4aa>
+                i += parse_one(buf + i, n - i, r) + 1;
+    1559:	|  |  |  /--------|-> 4a 8d 0c 3b          	lea    (%rbx,%r15,1),%rcx
+            auto const v = nel::parse_f64(field(p, n)).unwrap();
+    155d:	|  |  |  |        |   48 8b 74 24 20       	mov    0x20(%rsp),%rsi
+    1562:	|  |  |  |        |   48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    1567:	|  |  |  |        |   48 89 54 24 28       	mov    %rdx,0x28(%rsp)
+                i += parse_one(buf + i, n - i, r) + 1;
+    156c:	|  |  |  |        |   48 89 4c 24 30       	mov    %rcx,0x30(%rsp)
+    1571:	|  |  |  |        |   48 89 e9             	mov    %rbp,%rcx
+    1574:	|  |  |  |        |   4c 29 f9             	sub    %r15,%rcx
+    1577:	|  |  |  |        |   48 89 4c 24 38       	mov    %rcx,0x38(%rsp)
+            auto const v = nel::parse_f64(field(p, n)).unwrap();
+    157c:	|  |  |  |        |   e8 b5 09 00 00       	call   1f36 <nel::parse_f64(nel::Slice<unsigned char const> const&)>
+            auto tag = tag_;
+    1581:	|  |  |  |        |   8b 4c 24 40          	mov    0x40(%rsp),%ecx
+            tag_ = Tag::INVAL;
+    1585:	|  |  |  |        |   31 c0                	xor    %eax,%eax
+            : fn_name_(fn_name)
+    1587:	|  |  |  |        |   4c 89 74 24 58       	mov    %r14,0x58(%rsp)
+            , file_name_(file_name)
+    158c:	|  |  |  |        |   4c 8d 05 ad 1a 00 00 	lea    0x1aad(%rip),%r8        # 3040 <_IO_stdin_used+0x40>
+    1593:	|  |  |  |        |   89 44 24 40          	mov    %eax,0x40(%rsp)
+            switch (tag) { // result-consume
+    1597:	|  |  |  |        |   48 8b 54 24 28       	mov    0x28(%rsp),%rdx
+    159c:	|  |  |  |        |   83 f9 01             	cmp    $0x1,%ecx
+    159f:	|  |  |  |        |   4c 89 44 24 60       	mov    %r8,0x60(%rsp)
+            , line_num_(line_num)
+    15a4:	|  |  |  |        |   c7 44 24 68 83 00 00 	movl   $0x83,0x68(%rsp)
+    15ab:	|  |  |  |        |   00 
+    15ac:	|  |  |  |        \-- 74 93                	je     1541 <main+0x3ff>
+    15ae:	\--|--|--|----------> 83 f9 02             	cmp    $0x2,%ecx
+    15b1:	   |  |  |        /-- 74 15                	je     15c8 <main+0x486>
+    15b3:	   |  |  |        |   85 c9                	test   %ecx,%ecx
+    15b5:	   |  |  |  /-----|-- 75 1f                	jne    15d6 <main+0x494>
+                    return on_err(forward<E>(*err_));
+                case Tag::INVAL:
+                    // invalids are not values that should occur
+                    // if they do it's a use-after-move-from op so must panic.
+                    // or a use-before-initialised so again must panic.
+                    nel::panic("invalid Result", ctx);
+    15b7:	   |  |  |  |     |   48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    15bc:	   |  |  |  |     |   48 8d 3d 9f 1a 00 00 	lea    0x1a9f(%rip),%rdi        # 3062 <_IO_stdin_used+0x62>
+    15c3:	   |  |  |  |  /--|-> e8 1a fb ff ff       	call   10e2 <nel::panic(char const*, nel::Context const&)>
+         * `this` is consumed by the operation.
+         */
+        constexpr T unwrap(Context const &ctx = Context())
+        {
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    15c8:	   |  |  |  |  |  \-> 48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    15cd:	   |  |  |  |  |      48 8d 3d 84 1a 00 00 	lea    0x1a84(%rip),%rdi        # 3058 <_IO_stdin_used+0x58>
+    15d4:	   |  |  |  |  +----- eb ed                	jmp    15c3 <main+0x481>
+                    nel::panic("bad Result", ctx);
+    15d6:	   |  |  |  \--|----> 48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    15db:	   |  |  |     |      48 8d 3d 8f 1a 00 00 	lea    0x1a8f(%rip),%rdi        # 3071 <_IO_stdin_used+0x71>
+    15e2:	   |  |  |     \----- eb df                	jmp    15c3 <main+0x481>
+            nel::Index i = 0;
+    15e4:	   >--|--|----------> 45 31 ff             	xor    %r15d,%r15d
+    15e7:	   |  |  \----------- e9 6d ff ff ff       	jmp    1559 <main+0x417>
+        for (nel::Index k = 0; k < n_reps; ++k) {
+    15ec:	   |  \-------------> 48 ff ca             	dec    %rdx
+    15ef:	   \----------------- 75 f3                	jne    15e4 <main+0x4a2>
+    return now_ns() - b;
+    15f1:	                      e8 fc 01 00 00       	call   17f2 <bench::now_ns()>
+    bench::report(name, t, n_reps * n);
+    15f6:	                      48 8b 54 24 18       	mov    0x18(%rsp),%rdx
+    15fb:	                      48 8d 3d a8 1a 00 00 	lea    0x1aa8(%rip),%rdi        # 30aa <_IO_stdin_used+0xaa>
+    1602:	                      4c 29 e8             	sub    %r13,%rax
+    1605:	                      48 89 c6             	mov    %rax,%rsi
+    1608:	                      e8 08 02 00 00       	call   1815 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << r << '\n';
+    160d:	                      48 8d 35 19 1a 00 00 	lea    0x1a19(%rip),%rsi        # 302d <_IO_stdin_used+0x2d>
+    1614:	                      48 8d 3d 66 6a 10 00 	lea    0x106a66(%rip),%rdi        # 108081 <nel::log>
+    161b:	                      e8 b0 02 00 00       	call   18d0 <nel::operator<<(nel::Log&, char const*)>
+    1620:	                      4c 89 e6             	mov    %r12,%rsi
+    1623:	                      48 89 c7             	mov    %rax,%rdi
+    1626:	                      e8 40 03 00 00       	call   196b <nel::operator<<(nel::Log&, unsigned long)>
+    162b:	                      be 0a 00 00 00       	mov    $0xa,%esi
+    1630:	                      48 89 c7             	mov    %rax,%rdi
+    1633:	                      e8 7f 02 00 00       	call   18b7 <nel::operator<<(nel::Log&, char)>
+            return v.second;
+        });
+    }
+}
+    1638:	                      48 83 c4 78          	add    $0x78,%rsp
+    163c:	                      31 c0                	xor    %eax,%eax
+    163e:	                      5b                   	pop    %rbx
+    163f:	                      5d                   	pop    %rbp
+    1640:	                      41 5c                	pop    %r12
+    1642:	                      41 5d                	pop    %r13
+    1644:	                      41 5e                	pop    %r14
+    1646:	                      41 5f                	pop    %r15
+    1648:	                      c3                   	ret
+    1649:	                      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001650 <_start>:
+    1650:	31 ed                	xor    %ebp,%ebp
+    1652:	49 89 d1             	mov    %rdx,%r9
+    1655:	5e                   	pop    %rsi
+    1656:	48 89 e2             	mov    %rsp,%rdx
+    1659:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    165d:	50                   	push   %rax
+    165e:	54                   	push   %rsp
+    165f:	45 31 c0             	xor    %r8d,%r8d
+    1662:	31 c9                	xor    %ecx,%ecx
+    1664:	48 8d 3d d7 fa ff ff 	lea    -0x529(%rip),%rdi        # 1142 <main>
+    166b:	ff 15 4f 69 00 00    	call   *0x694f(%rip)        # 7fc0 <__libc_start_main@GLIBC_2.34>
+    1671:	f4                   	hlt
+    1672:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1679:	00 00 00 
+    167c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001680 <deregister_tm_clones>:
+    1680:	    48 8d 3d c1 69 00 00 	lea    0x69c1(%rip),%rdi        # 8048 <__TMC_END__>
+    1687:	    48 8d 05 ba 69 00 00 	lea    0x69ba(%rip),%rax        # 8048 <__TMC_END__>
+    168e:	    48 39 f8             	cmp    %rdi,%rax
+    1691:	/-- 74 15                	je     16a8 <deregister_tm_clones+0x28>
+    1693:	|   48 8b 05 2e 69 00 00 	mov    0x692e(%rip),%rax        # 7fc8 <_ITM_deregisterTMCloneTable@Base>
+    169a:	|   48 85 c0             	test   %rax,%rax
+    169d:	+-- 74 09                	je     16a8 <deregister_tm_clones+0x28>
+    169f:	|   ff e0                	jmp    *%rax
+    16a1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    16a8:	\-> c3                   	ret
+    16a9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000016b0 <register_tm_clones>:
+    16b0:	    48 8d 3d 91 69 00 00 	lea    0x6991(%rip),%rdi        # 8048 <__TMC_END__>
+    16b7:	    48 8d 35 8a 69 00 00 	lea    0x698a(%rip),%rsi        # 8048 <__TMC_END__>
+    16be:	    48 29 fe             	sub    %rdi,%rsi
+    16c1:	    48 89 f0             	mov    %rsi,%rax
+    16c4:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    16c8:	    48 c1 f8 03          	sar    $0x3,%rax
+    16cc:	    48 01 c6             	add    %rax,%rsi
+    16cf:	    48 d1 fe             	sar    %rsi
+    16d2:	/-- 74 14                	je     16e8 <register_tm_clones+0x38>
+    16d4:	|   48 8b 05 fd 68 00 00 	mov    0x68fd(%rip),%rax        # 7fd8 <_ITM_registerTMCloneTable@Base>
+    16db:	|   48 85 c0             	test   %rax,%rax
+    16de:	+-- 74 08                	je     16e8 <register_tm_clones+0x38>
+    16e0:	|   ff e0                	jmp    *%rax
+    16e2:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    16e8:	\-> c3                   	ret
+    16e9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000016f0 <__do_global_dtors_aux>:
+    16f0:	       f3 0f 1e fa          	endbr64
+    16f4:	       80 3d 6d 69 00 00 00 	cmpb   $0x0,0x696d(%rip)        # 8068 <completed.0>
+    16fb:	/----- 75 2b                	jne    1728 <__do_global_dtors_aux+0x38>
+    16fd:	|      55                   	push   %rbp
+    16fe:	|      48 83 3d da 68 00 00 	cmpq   $0x0,0x68da(%rip)        # 7fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1705:	|      00 
+    1706:	|      48 89 e5             	mov    %rsp,%rbp
+    1709:	|  /-- 74 0c                	je     1717 <__do_global_dtors_aux+0x27>
+    170b:	|  |   48 8b 3d 2e 69 00 00 	mov    0x692e(%rip),%rdi        # 8040 <__dso_handle>
+    1712:	|  |   e8 89 f9 ff ff       	call   10a0 <__cxa_finalize@plt>
+    1717:	|  \-> e8 64 ff ff ff       	call   1680 <deregister_tm_clones>
+    171c:	|      c6 05 45 69 00 00 01 	movb   $0x1,0x6945(%rip)        # 8068 <completed.0>
+    1723:	|      5d                   	pop    %rbp
+    1724:	|      c3                   	ret
+    1725:	|      0f 1f 00             	nopl   (%rax)
+    1728:	\----> c3                   	ret
+    1729:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001730 <frame_dummy>:
+    1730:	f3 0f 1e fa          	endbr64
+    1734:	e9 77 ff ff ff       	jmp    16b0 <register_tm_clones>
+
+0000000000001739 <next_rand(unsigned int&)>:
+    s ^= s << 13;
+    1739:	66 0f 6e 0f          	movd   (%rdi),%xmm1
+    173d:	0f 28 d1             	movaps %xmm1,%xmm2
+    1740:	66 0f 72 f2 0d       	pslld  $0xd,%xmm2
+    1745:	0f 28 c2             	movaps %xmm2,%xmm0
+    1748:	0f 57 c1             	xorps  %xmm1,%xmm0
+    s ^= s >> 17;
+    174b:	0f 28 d8             	movaps %xmm0,%xmm3
+    174e:	66 0f 72 d3 11       	psrld  $0x11,%xmm3
+    1753:	0f 28 cb             	movaps %xmm3,%xmm1
+    1756:	0f 57 c8             	xorps  %xmm0,%xmm1
+    s ^= s << 5;
+    1759:	0f 28 e1             	movaps %xmm1,%xmm4
+    175c:	66 0f 72 f4 05       	pslld  $0x5,%xmm4
+    1761:	0f 28 c4             	movaps %xmm4,%xmm0
+    1764:	0f 57 c1             	xorps  %xmm1,%xmm0
+    1767:	66 0f 7e c0          	movd   %xmm0,%eax
+    176b:	66 0f 7e 07          	movd   %xmm0,(%rdi)
+}
+    176f:	c3                   	ret
+
+0000000000001770 <put_digits(unsigned long&, unsigned int&, unsigned long)>:
+{
+    1770:	       51                   	push   %rcx
+    1771:	       48 89 f9             	mov    %rdi,%rcx
+    1774:	       48 89 f7             	mov    %rsi,%rdi
+    1777:	       48 89 d6             	mov    %rdx,%rsi
+    buf[i++] = char('1' + next_rand(seed) % 9);
+    177a:	       41 ba 09 00 00 00    	mov    $0x9,%r10d
+    1780:	       4c 8d 0d f9 68 00 00 	lea    0x68f9(%rip),%r9        # 8080 <buf>
+    1787:	       e8 ad ff ff ff       	call   1739 <next_rand(unsigned int&)>
+    178c:	       4c 8b 01             	mov    (%rcx),%r8
+    178f:	       49 8d 50 01          	lea    0x1(%r8),%rdx
+    1793:	       48 89 11             	mov    %rdx,(%rcx)
+    1796:	       31 d2                	xor    %edx,%edx
+    1798:	       41 f7 f2             	div    %r10d
+        buf[i++] = char('0' + next_rand(seed) % 10);
+    179b:	       41 ba 0a 00 00 00    	mov    $0xa,%r10d
+    buf[i++] = char('1' + next_rand(seed) % 9);
+    17a1:	       83 c2 31             	add    $0x31,%edx
+    17a4:	       43 88 14 01          	mov    %dl,(%r9,%r8,1)
+    for (nel::Index k = 1; k < n; ++k) {
+    17a8:	       45 31 c0             	xor    %r8d,%r8d
+    17ab:	/----> 41 ff c0             	inc    %r8d
+    17ae:	|      41 39 f0             	cmp    %esi,%r8d
+    17b1:	|  /-- 74 1d                	je     17d0 <put_digits(unsigned long&, unsigned int&, unsigned long)+0x60>
+        buf[i++] = char('0' + next_rand(seed) % 10);
+    17b3:	|  |   e8 81 ff ff ff       	call   1739 <next_rand(unsigned int&)>
+    17b8:	|  |   4c 8b 19             	mov    (%rcx),%r11
+    17bb:	|  |   49 8d 53 01          	lea    0x1(%r11),%rdx
+    17bf:	|  |   48 89 11             	mov    %rdx,(%rcx)
+    17c2:	|  |   31 d2                	xor    %edx,%edx
+    17c4:	|  |   41 f7 f2             	div    %r10d
+    17c7:	|  |   83 c2 30             	add    $0x30,%edx
+    17ca:	|  |   43 88 14 19          	mov    %dl,(%r9,%r11,1)
+    for (nel::Index k = 1; k < n; ++k) {
+    17ce:	\--|-- eb db                	jmp    17ab <put_digits(unsigned long&, unsigned int&, unsigned long)+0x3b>
+}
+    17d0:	   \-> 58                   	pop    %rax
+    17d1:	       c3                   	ret
+
+00000000000017d2 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    17d2:	83 c8 ff             	or     $0xffffffff,%eax
+    17d5:	c3                   	ret
+
+00000000000017d6 <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    17d6:	83 c8 ff             	or     $0xffffffff,%eax
+    17d9:	c3                   	ret
+
+00000000000017da <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    17da:	83 c8 ff             	or     $0xffffffff,%eax
+    17dd:	c3                   	ret
+
+00000000000017de <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    17de:	83 c8 ff             	or     $0xffffffff,%eax
+    17e1:	c3                   	ret
+
+00000000000017e2 <_read_r>:
+int _read_r(struct _reent *, int) {
+    17e2:	83 c8 ff             	or     $0xffffffff,%eax
+    17e5:	c3                   	ret
+
+00000000000017e6 <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    17e6:	83 c8 ff             	or     $0xffffffff,%eax
+    17e9:	c3                   	ret
+
+00000000000017ea <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    17ea:	83 c8 ff             	or     $0xffffffff,%eax
+    17ed:	c3                   	ret
+
+00000000000017ee <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    17ee:	83 c8 ff             	or     $0xffffffff,%eax
+    17f1:	c3                   	ret
+
+00000000000017f2 <bench::now_ns()>:
+{
+    17f2:	48 83 ec 18          	sub    $0x18,%rsp
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    17f6:	bf 01 00 00 00       	mov    $0x1,%edi
+    17fb:	48 89 e6             	mov    %rsp,%rsi
+    17fe:	e8 4d f8 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1803:	48 69 04 24 00 ca 9a 	imul   $0x3b9aca00,(%rsp),%rax
+    180a:	3b 
+    180b:	48 03 44 24 08       	add    0x8(%rsp),%rax
+}
+    1810:	48 83 c4 18          	add    $0x18,%rsp
+    1814:	c3                   	ret
+
+0000000000001815 <bench::report(char const*, unsigned long, unsigned long)>:
+}
+
+// Log a result line: name, time and (if bytes given) bandwidth.
+inline void report(char const *const name, long unsigned int const ns,
+                   long unsigned int const bytes = 0)
+{
+    1815:	    41 54                	push   %r12
+    nel::log << name << ": " << ns / 1000UL << "us";
+    1817:	    4c 8d 25 63 68 10 00 	lea    0x106863(%rip),%r12        # 108081 <nel::log>
+{
+    181e:	    55                   	push   %rbp
+    181f:	    48 89 f5             	mov    %rsi,%rbp
+    nel::log << name << ": " << ns / 1000UL << "us";
+    1822:	    48 89 fe             	mov    %rdi,%rsi
+    1825:	    4c 89 e7             	mov    %r12,%rdi
+{
+    1828:	    53                   	push   %rbx
+    1829:	    48 89 d3             	mov    %rdx,%rbx
+    nel::log << name << ": " << ns / 1000UL << "us";
+    182c:	    e8 9f 00 00 00       	call   18d0 <nel::operator<<(nel::Log&, char const*)>
+    1831:	    48 8d 35 fa 17 00 00 	lea    0x17fa(%rip),%rsi        # 3032 <_IO_stdin_used+0x32>
+    1838:	    48 89 c7             	mov    %rax,%rdi
+    183b:	    e8 90 00 00 00       	call   18d0 <nel::operator<<(nel::Log&, char const*)>
+    1840:	    b9 e8 03 00 00       	mov    $0x3e8,%ecx
+    1845:	    31 d2                	xor    %edx,%edx
+    1847:	    48 89 c7             	mov    %rax,%rdi
+    184a:	    48 89 e8             	mov    %rbp,%rax
+    184d:	    48 f7 f1             	div    %rcx
+    1850:	    48 89 c6             	mov    %rax,%rsi
+    1853:	    e8 13 01 00 00       	call   196b <nel::operator<<(nel::Log&, unsigned long)>
+    1858:	    48 8d 35 a5 17 00 00 	lea    0x17a5(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+    185f:	    48 89 c7             	mov    %rax,%rdi
+    1862:	    e8 69 00 00 00       	call   18d0 <nel::operator<<(nel::Log&, char const*)>
+    if (bytes != 0 && ns != 0) {
+    1867:	    48 85 db             	test   %rbx,%rbx
+    186a:	/-- 74 3a                	je     18a6 <bench::report(char const*, unsigned long, unsigned long)+0x91>
+    186c:	|   48 85 ed             	test   %rbp,%rbp
+    186f:	+-- 74 35                	je     18a6 <bench::report(char const*, unsigned long, unsigned long)+0x91>
+        // bytes/ns == GB/s, scaled to MB/s
+        nel::log << ", " << (bytes * 1000UL) / ns << "MB/s";
+    1871:	|   48 8d 35 8f 17 00 00 	lea    0x178f(%rip),%rsi        # 3007 <_IO_stdin_used+0x7>
+    1878:	|   4c 89 e7             	mov    %r12,%rdi
+    187b:	|   e8 50 00 00 00       	call   18d0 <nel::operator<<(nel::Log&, char const*)>
+    1880:	|   31 d2                	xor    %edx,%edx
+    1882:	|   48 89 c7             	mov    %rax,%rdi
+    1885:	|   48 69 c3 e8 03 00 00 	imul   $0x3e8,%rbx,%rax
+    188c:	|   48 f7 f5             	div    %rbp
+    188f:	|   48 89 c6             	mov    %rax,%rsi
+    1892:	|   e8 d4 00 00 00       	call   196b <nel::operator<<(nel::Log&, unsigned long)>
+    1897:	|   48 8d 35 6c 17 00 00 	lea    0x176c(%rip),%rsi        # 300a <_IO_stdin_used+0xa>
+    189e:	|   48 89 c7             	mov    %rax,%rdi
+    18a1:	|   e8 2a 00 00 00       	call   18d0 <nel::operator<<(nel::Log&, char const*)>
+    }
+    nel::log << '\n';
+}
+    18a6:	\-> 5b                   	pop    %rbx
+    nel::log << '\n';
+    18a7:	    4c 89 e7             	mov    %r12,%rdi
+}
+    18aa:	    5d                   	pop    %rbp
+    nel::log << '\n';
+    18ab:	    be 0a 00 00 00       	mov    $0xa,%esi
+}
+    18b0:	    41 5c                	pop    %r12
+    nel::log << '\n';
+    18b2:	    e9 00 00 00 00       	jmp    18b7 <nel::operator<<(nel::Log&, char)>
+
+00000000000018b7 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    18b7:	53                   	push   %rbx
+    18b8:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    18bb:	40 0f be fe          	movsbl %sil,%edi
+    18bf:	48 8b 35 9a 67 00 00 	mov    0x679a(%rip),%rsi        # 8060 <stderr@GLIBC_2.2.5>
+    18c6:	e8 a5 f7 ff ff       	call   1070 <fputc@plt>
+    return outs;
+}
+    18cb:	48 89 d8             	mov    %rbx,%rax
+    18ce:	5b                   	pop    %rbx
+    18cf:	c3                   	ret
+
+00000000000018d0 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    18d0:	53                   	push   %rbx
+    18d1:	48 89 fb             	mov    %rdi,%rbx
+    18d4:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    18d7:	48 8b 35 82 67 00 00 	mov    0x6782(%rip),%rsi        # 8060 <stderr@GLIBC_2.2.5>
+    18de:	e8 7d f7 ff ff       	call   1060 <fputs@plt>
+    return outs;
+}
+    18e3:	48 89 d8             	mov    %rbx,%rax
+    18e6:	5b                   	pop    %rbx
+    18e7:	c3                   	ret
+
+00000000000018e8 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    18e8:	53                   	push   %rbx
+    18e9:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    18ec:	48 8b 3d 6d 67 00 00 	mov    0x676d(%rip),%rdi        # 8060 <stderr@GLIBC_2.2.5>
+    18f3:	40 0f b6 d6          	movzbl %sil,%edx
+    18f7:	31 c0                	xor    %eax,%eax
+    18f9:	48 8d 35 f0 17 00 00 	lea    0x17f0(%rip),%rsi        # 30f0 <_IO_stdin_used+0xf0>
+    1900:	e8 8b f7 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1905:	48 89 d8             	mov    %rbx,%rax
+    1908:	5b                   	pop    %rbx
+    1909:	c3                   	ret
+
+000000000000190a <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    190a:	53                   	push   %rbx
+    190b:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    190e:	48 8b 3d 4b 67 00 00 	mov    0x674b(%rip),%rdi        # 8060 <stderr@GLIBC_2.2.5>
+    1915:	0f b7 d6             	movzwl %si,%edx
+    1918:	31 c0                	xor    %eax,%eax
+    191a:	48 8d 35 cf 17 00 00 	lea    0x17cf(%rip),%rsi        # 30f0 <_IO_stdin_used+0xf0>
+    1921:	e8 6a f7 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1926:	48 89 d8             	mov    %rbx,%rax
+    1929:	5b                   	pop    %rbx
+    192a:	c3                   	ret
+
+000000000000192b <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    192b:	53                   	push   %rbx
+    192c:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    192f:	48 8b 3d 2a 67 00 00 	mov    0x672a(%rip),%rdi        # 8060 <stderr@GLIBC_2.2.5>
+{
+    1936:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    1938:	31 c0                	xor    %eax,%eax
+    193a:	48 8d 35 af 17 00 00 	lea    0x17af(%rip),%rsi        # 30f0 <_IO_stdin_used+0xf0>
+    1941:	e8 4a f7 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1946:	48 89 d8             	mov    %rbx,%rax
+    1949:	5b                   	pop    %rbx
+    194a:	c3                   	ret
+
+000000000000194b <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    194b:	53                   	push   %rbx
+    194c:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    194f:	48 8b 3d 0a 67 00 00 	mov    0x670a(%rip),%rdi        # 8060 <stderr@GLIBC_2.2.5>
+{
+    1956:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    1958:	31 c0                	xor    %eax,%eax
+    195a:	48 8d 35 8f 17 00 00 	lea    0x178f(%rip),%rsi        # 30f0 <_IO_stdin_used+0xf0>
+    1961:	e8 2a f7 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1966:	48 89 d8             	mov    %rbx,%rax
+    1969:	5b                   	pop    %rbx
+    196a:	c3                   	ret
+
+000000000000196b <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    196b:	53                   	push   %rbx
+    196c:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    196f:	48 8b 3d ea 66 00 00 	mov    0x66ea(%rip),%rdi        # 8060 <stderr@GLIBC_2.2.5>
+{
+    1976:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    1979:	31 c0                	xor    %eax,%eax
+    197b:	48 8d 35 71 17 00 00 	lea    0x1771(%rip),%rsi        # 30f3 <_IO_stdin_used+0xf3>
+    1982:	e8 09 f7 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1987:	48 89 d8             	mov    %rbx,%rax
+    198a:	5b                   	pop    %rbx
+    198b:	c3                   	ret
+
+000000000000198c <nel::(anonymous namespace)::parse8(unsigned long long)>:
+Word parse8(Word v)
+{
+    Word const mask = 0x000000FF000000FFULL;
+    Word const mul1 = 100ULL + (1000000ULL << 32);
+    Word const mul2 = 1ULL + (10000ULL << 32);
+    v -= 0x3030303030303030ULL;
+    198c:	48 b8 d0 cf cf cf cf 	movabs $0xcfcfcfcfcfcfcfd0,%rax
+    1993:	cf cf cf 
+    v = (v * 10) + (v >> 8);
+    return (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+    1996:	48 ba ff 00 00 00 ff 	movabs $0xff000000ff,%rdx
+    199d:	00 00 00 
+    19a0:	48 b9 01 00 00 00 10 	movabs $0x271000000001,%rcx
+    19a7:	27 00 00 
+    v -= 0x3030303030303030ULL;
+    19aa:	48 01 f8             	add    %rdi,%rax
+    v = (v * 10) + (v >> 8);
+    19ad:	48 6b f8 0a          	imul   $0xa,%rax,%rdi
+    19b1:	48 c1 e8 08          	shr    $0x8,%rax
+    19b5:	48 01 c7             	add    %rax,%rdi
+    return (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+    19b8:	48 89 f8             	mov    %rdi,%rax
+    19bb:	48 21 d7             	and    %rdx,%rdi
+    19be:	48 c1 e8 10          	shr    $0x10,%rax
+    19c2:	48 21 d0             	and    %rdx,%rax
+    19c5:	48 ba 64 00 00 00 40 	movabs $0xf424000000064,%rdx
+    19cc:	42 0f 00 
+    19cf:	48 0f af c1          	imul   %rcx,%rax
+    19d3:	48 0f af fa          	imul   %rdx,%rdi
+    19d7:	48 01 f8             	add    %rdi,%rax
+    19da:	48 c1 e8 20          	shr    $0x20,%rax
+}
+    19de:	c3                   	ret
+
+00000000000019df <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>:
+}
+
+// The value of the d digits p[0..d), d <= 19 so it fits.
+// avail is how many bytes may be read from p, at least d.
+Word digits_value(unsigned char const p[], Length const d, Length const avail)
+{
+    19df:	       53                   	push   %rbx
+    19e0:	       49 89 f9             	mov    %rdi,%r9
+    19e3:	       49 89 f0             	mov    %rsi,%r8
+    19e6:	       48 89 d3             	mov    %rdx,%rbx
+    Word v = 0;
+    Index i = 0;
+    19e9:	       31 ff                	xor    %edi,%edi
+    Word v = 0;
+    19eb:	       31 c0                	xor    %eax,%eax
+    for (; i + 8 <= d; i += 8) {
+    19ed:	/----> 4c 8d 5f 08          	lea    0x8(%rdi),%r11
+    19f1:	|      4d 39 d8             	cmp    %r11,%r8
+    19f4:	|  /-- 72 19                	jb     1a0f <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x30>
+        v = v * 100000000ULL + parse8(load8(p + i));
+    19f6:	|  |   48 69 f0 00 e1 f5 05 	imul   $0x5f5e100,%rax,%rsi
+    19fd:	|  |   4b 8b 7c 19 f8       	mov    -0x8(%r9,%r11,1),%rdi
+    1a02:	|  |   e8 85 ff ff ff       	call   198c <nel::(anonymous namespace)::parse8(unsigned long long)>
+    for (; i + 8 <= d; i += 8) {
+    1a07:	|  |   4c 89 df             	mov    %r11,%rdi
+        v = v * 100000000ULL + parse8(load8(p + i));
+    1a0a:	|  |   48 01 f0             	add    %rsi,%rax
+    for (; i + 8 <= d; i += 8) {
+    1a0d:	\--|-- eb de                	jmp    19ed <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0xe>
+    }
+    Length const r = d - i;
+    if (r == 0) { return v; }
+    1a0f:	   \-> 4d 89 c2             	mov    %r8,%r10
+    1a12:	       49 29 fa             	sub    %rdi,%r10
+    1a15:	/----- 74 67                	je     1a7e <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x9f>
+    if (i + 8 <= avail) {
+    1a17:	|      4c 39 db             	cmp    %r11,%rbx
+    1a1a:	|  /-- 72 46                	jb     1a62 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x83>
+        // the last r digits as the low digits of 8: shifted up, with '0's shifted in under them.
+        Word const w =
+            (load8(p + i) << (8 * (8 - r))) | (0x3030303030303030ULL >> (8 * r));
+        return v * pow10_u64[r] + parse8(w);
+    1a1c:	|  |   48 8d 15 9d 40 00 00 	lea    0x409d(%rip),%rdx        # 5ac0 <nel::(anonymous namespace)::pow10_u64>
+    1a23:	|  |   4a 0f af 04 d2       	imul   (%rdx,%r10,8),%rax
+    1a28:	|  |   48 89 c6             	mov    %rax,%rsi
+            (load8(p + i) << (8 * (8 - r))) | (0x3030303030303030ULL >> (8 * r));
+    1a2b:	|  |   48 89 f8             	mov    %rdi,%rax
+    1a2e:	|  |   49 8b 3c 39          	mov    (%r9,%rdi,1),%rdi
+    1a32:	|  |   4c 29 c0             	sub    %r8,%rax
+    1a35:	|  |   48 8d 0c c5 40 00 00 	lea    0x40(,%rax,8),%rcx
+    1a3c:	|  |   00 
+    1a3d:	|  |   48 b8 30 30 30 30 30 	movabs $0x3030303030303030,%rax
+    1a44:	|  |   30 30 30 
+    1a47:	|  |   48 d3 e7             	shl    %cl,%rdi
+    1a4a:	|  |   4a 8d 0c d5 00 00 00 	lea    0x0(,%r10,8),%rcx
+    1a51:	|  |   00 
+    1a52:	|  |   48 d3 e8             	shr    %cl,%rax
+    1a55:	|  |   48 09 c7             	or     %rax,%rdi
+        return v * pow10_u64[r] + parse8(w);
+    1a58:	|  |   e8 2f ff ff ff       	call   198c <nel::(anonymous namespace)::parse8(unsigned long long)>
+    1a5d:	|  |   48 01 f0             	add    %rsi,%rax
+    1a60:	+--|-- eb 1c                	jmp    1a7e <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x9f>
+    }
+    for (; i < d; ++i) {
+    1a62:	|  >-> 4c 39 c7             	cmp    %r8,%rdi
+    1a65:	+--|-- 73 17                	jae    1a7e <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x9f>
+        v = v * 10 + Word(p[i] - '0');
+    1a67:	|  |   41 0f b6 14 39       	movzbl (%r9,%rdi,1),%edx
+    1a6c:	|  |   48 6b c0 0a          	imul   $0xa,%rax,%rax
+    for (; i < d; ++i) {
+    1a70:	|  |   48 ff c7             	inc    %rdi
+        v = v * 10 + Word(p[i] - '0');
+    1a73:	|  |   83 ea 30             	sub    $0x30,%edx
+    1a76:	|  |   48 63 d2             	movslq %edx,%rdx
+    1a79:	|  |   48 01 d0             	add    %rdx,%rax
+    for (; i < d; ++i) {
+    1a7c:	|  \-- eb e4                	jmp    1a62 <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)+0x83>
+    }
+    return v;
+}
+    1a7e:	\----> 5b                   	pop    %rbx
+    1a7f:	       c3                   	ret
+
+0000000000001a80 <nel::(anonymous namespace)::Digits::operator[](unsigned long) const>:
+        unsigned char const *b;
+        Length bn;
+
+        unsigned char operator[](Index const i) const
+        {
+            return (i < an) ? a[i] : b[i - an];
+    1a80:	       48 8b 47 08          	mov    0x8(%rdi),%rax
+    1a84:	       48 39 c6             	cmp    %rax,%rsi
+    1a87:	   /-- 73 05                	jae    1a8e <nel::(anonymous namespace)::Digits::operator[](unsigned long) const+0xe>
+    1a89:	   |   48 8b 07             	mov    (%rdi),%rax
+    1a8c:	/--|-- eb 07                	jmp    1a95 <nel::(anonymous namespace)::Digits::operator[](unsigned long) const+0x15>
+    1a8e:	|  \-> 48 29 c6             	sub    %rax,%rsi
+    1a91:	|      48 8b 47 10          	mov    0x10(%rdi),%rax
+    1a95:	\----> 8a 04 30             	mov    (%rax,%rsi,1),%al
+        }
+    1a98:	       c3                   	ret
+
+0000000000001a99 <nel::(anonymous namespace)::starts_with_word(unsigned char const*, unsigned long, char const*)>:
+}
+
+// Case insensitive match of the lower case word at the start of p[0..n).
+bool starts_with_word(unsigned char const p[], Length const n, char const *const word)
+{
+    Index i = 0;
+    1a99:	          31 c0                	xor    %eax,%eax
+    for (; word[i] != '\0'; ++i) {
+    1a9b:	/-------> 44 8a 04 02          	mov    (%rdx,%rax,1),%r8b
+    1a9f:	|         45 84 c0             	test   %r8b,%r8b
+    1aa2:	|  /----- 74 15                	je     1ab9 <nel::(anonymous namespace)::starts_with_word(unsigned char const*, unsigned long, char const*)+0x20>
+        if (i >= n || (p[i] | 0x20) != (unsigned char)word[i]) { return false; }
+    1aa4:	|  |      48 39 f0             	cmp    %rsi,%rax
+    1aa7:	|  |  /-- 74 13                	je     1abc <nel::(anonymous namespace)::starts_with_word(unsigned char const*, unsigned long, char const*)+0x23>
+    1aa9:	|  |  |   8a 0c 07             	mov    (%rdi,%rax,1),%cl
+    1aac:	|  |  |   83 c9 20             	or     $0x20,%ecx
+    1aaf:	|  |  |   44 38 c1             	cmp    %r8b,%cl
+    1ab2:	|  |  +-- 75 08                	jne    1abc <nel::(anonymous namespace)::starts_with_word(unsigned char const*, unsigned long, char const*)+0x23>
+    for (; word[i] != '\0'; ++i) {
+    1ab4:	|  |  |   48 ff c0             	inc    %rax
+    1ab7:	\--|--|-- eb e2                	jmp    1a9b <nel::(anonymous namespace)::starts_with_word(unsigned char const*, unsigned long, char const*)+0x2>
+    }
+    return true;
+    1ab9:	   \--|-> b0 01                	mov    $0x1,%al
+    1abb:	      |   c3                   	ret
+        if (i >= n || (p[i] | 0x20) != (unsigned char)word[i]) { return false; }
+    1abc:	      \-> 31 c0                	xor    %eax,%eax
+}
+    1abe:	          c3                   	ret
+
+0000000000001abf <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)>:
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    1abf:	          49 ba 46 46 46 46 46 	movabs $0x4646464646464646,%r10
+    1ac6:	          46 46 46 
+    Index i = 0;
+    1ac9:	          31 c9                	xor    %ecx,%ecx
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    1acb:	          49 bb d0 cf cf cf cf 	movabs $0xcfcfcfcfcfcfcfd0,%r11
+    1ad2:	          cf cf cf 
+    1ad5:	          49 b9 80 80 80 80 80 	movabs $0x8080808080808080,%r9
+    1adc:	          80 80 80 
+    while (i + 8 <= n) {
+    1adf:	      /-> 48 89 ca             	mov    %rcx,%rdx
+    1ae2:	      |   48 8d 49 08          	lea    0x8(%rcx),%rcx
+    1ae6:	      |   48 39 ce             	cmp    %rcx,%rsi
+    1ae9:	/-----|-- 72 2f                	jb     1b1a <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)+0x5b>
+    __builtin_memcpy(&v, p, sizeof(v));
+    1aeb:	|     |   4c 8b 44 0f f8       	mov    -0x8(%rdi,%rcx,1),%r8
+    return ((v + 0x4646464646464646ULL) | (v - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+    1af0:	|     |   4b 8d 04 10          	lea    (%r8,%r10,1),%rax
+    1af4:	|     |   4d 01 d8             	add    %r11,%r8
+    1af7:	|     |   4c 09 c0             	or     %r8,%rax
+        if (m != 0) { return i + Length(__builtin_ctzll(m) / 8); }
+    1afa:	|     |   4c 21 c8             	and    %r9,%rax
+    1afd:	|     \-- 74 e0                	je     1adf <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)+0x20>
+    1aff:	|         48 0f bc c0          	bsf    %rax,%rax
+    1b03:	|         c1 f8 03             	sar    $0x3,%eax
+    1b06:	|         48 98                	cltq
+    1b08:	|         48 01 c2             	add    %rax,%rdx
+    1b0b:	|  /----- eb 12                	jmp    1b1f <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)+0x60>
+    return (unsigned char)(c - '0') < 10;
+    1b0d:	|  |  /-> 8a 04 17             	mov    (%rdi,%rdx,1),%al
+    1b10:	|  |  |   83 e8 30             	sub    $0x30,%eax
+    while (i < n && is_digit(p[i])) {
+    1b13:	|  |  |   3c 09                	cmp    $0x9,%al
+    1b15:	|  +--|-- 77 08                	ja     1b1f <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)+0x60>
+        i += 1;
+    1b17:	|  |  |   48 ff c2             	inc    %rdx
+    while (i < n && is_digit(p[i])) {
+    1b1a:	\--|--|-> 48 39 f2             	cmp    %rsi,%rdx
+    1b1d:	   |  \-- 72 ee                	jb     1b0d <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)+0x4e>
+}
+    1b1f:	   \----> 48 89 d0             	mov    %rdx,%rax
+    1b22:	          c3                   	ret
+
+0000000000001b23 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)>:
+{
+    1b23:	          41 55                	push   %r13
+    1b25:	          41 54                	push   %r12
+    1b27:	          55                   	push   %rbp
+    1b28:	          53                   	push   %rbx
+    1b29:	          48 89 fb             	mov    %rdi,%rbx
+    1b2c:	          51                   	push   %rcx
+    if (n == 0) { return R::Err(ParseError::Empty); }
+    1b2d:	          48 85 d2             	test   %rdx,%rdx
+    1b30:	      /-- 75 12                	jne    1b44 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x21>
+            : tag_(Tag::ERR)
+    1b32:	      |   c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+            : value_(forward<Type>(val))
+    1b38:	      |   c7 47 08 01 00 00 00 	movl   $0x1,0x8(%rdi)
+    1b3f:	/-----|-- e9 a5 00 00 00       	jmp    1be9 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0xc6>
+    return (unsigned char)(c - '0') < 10;
+    1b44:	|     \-> 8a 06                	mov    (%rsi),%al
+    1b46:	|         49 89 f5             	mov    %rsi,%r13
+    1b49:	|         83 e8 30             	sub    $0x30,%eax
+    if (!is_digit(p[0])) { return R::Err(ParseError::InvalidDigit); }
+    1b4c:	|         3c 09                	cmp    $0x9,%al
+    1b4e:	|     /-- 76 12                	jbe    1b62 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x3f>
+    1b50:	|     |   c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+    1b56:	|     |   c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    1b5d:	+-----|-- e9 87 00 00 00       	jmp    1be9 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0xc6>
+    Index z = 0;
+    1b62:	|     \-> 45 31 e4             	xor    %r12d,%r12d
+    while (z < n && p[z] == '0') {
+    1b65:	|  /----> 43 80 7c 25 00 30    	cmpb   $0x30,0x0(%r13,%r12,1)
+    1b6b:	|  |  /-- 75 08                	jne    1b75 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x52>
+        z += 1;
+    1b6d:	|  |  |   49 ff c4             	inc    %r12
+    while (z < n && p[z] == '0') {
+    1b70:	|  |  |   4c 39 e2             	cmp    %r12,%rdx
+    1b73:	|  \--|-- 75 f0                	jne    1b65 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x42>
+    Length const d = digit_run(p + z, n - z);
+    1b75:	|     \-> 4c 29 e2             	sub    %r12,%rdx
+    1b78:	|         4b 8d 7c 25 00       	lea    0x0(%r13,%r12,1),%rdi
+    1b7d:	|         48 89 d6             	mov    %rdx,%rsi
+    1b80:	|         48 89 14 24          	mov    %rdx,(%rsp)
+    1b84:	|         e8 36 ff ff ff       	call   1abf <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)>
+    if (d <= 19) { return R::Ok(Pair<Word, Length>{digits_value(p + z, d, n - z), used}); }
+    1b89:	|         48 8b 14 24          	mov    (%rsp),%rdx
+    1b8d:	|         48 83 f8 13          	cmp    $0x13,%rax
+    Length const d = digit_run(p + z, n - z);
+    1b91:	|         48 89 c6             	mov    %rax,%rsi
+    Length const used = z + d;
+    1b94:	|         4a 8d 2c 20          	lea    (%rax,%r12,1),%rbp
+    if (d <= 19) { return R::Ok(Pair<Word, Length>{digits_value(p + z, d, n - z), used}); }
+    1b98:	|     /-- 77 07                	ja     1ba1 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0x7e>
+    1b9a:	|     |   e8 40 fe ff ff       	call   19df <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    1b9f:	|  /--|-- eb 2b                	jmp    1bcc <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0xa9>
+    if (d > 20) { return R::Err(ParseError::Overflow); }
+    1ba1:	|  |  \-> 48 83 f8 14          	cmp    $0x14,%rax
+    1ba5:	|  |  /-- 75 35                	jne    1bdc <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0xb9>
+    Word v = digits_value(p + z, 19, n - z);
+    1ba7:	|  |  |   be 13 00 00 00       	mov    $0x13,%esi
+    1bac:	|  |  |   e8 2e fe ff ff       	call   19df <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    if (__builtin_mul_overflow(v, Word(10), &v) ||
+    1bb1:	|  |  |   ba 0a 00 00 00       	mov    $0xa,%edx
+    1bb6:	|  |  |   48 f7 e2             	mul    %rdx
+    1bb9:	|  |  +-- 70 21                	jo     1bdc <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0xb9>
+        __builtin_add_overflow(v, Word(p[z + 19] - '0'), &v)) {
+    1bbb:	|  |  |   43 0f b6 54 25 13    	movzbl 0x13(%r13,%r12,1),%edx
+    1bc1:	|  |  |   83 ea 30             	sub    $0x30,%edx
+    1bc4:	|  |  |   48 63 d2             	movslq %edx,%rdx
+    1bc7:	|  |  |   48 01 d0             	add    %rdx,%rax
+    1bca:	|  |  +-- 72 10                	jb     1bdc <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0xb9>
+            : tag_(Tag::OK)
+    1bcc:	|  \--|-> c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+    1bd2:	|     |   48 89 43 08          	mov    %rax,0x8(%rbx)
+    1bd6:	|     |   48 89 6b 10          	mov    %rbp,0x10(%rbx)
+    1bda:	+-----|-- eb 0d                	jmp    1be9 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)+0xc6>
+            : tag_(Tag::ERR)
+    1bdc:	|     \-> c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+    1be2:	|         c7 43 08 03 00 00 00 	movl   $0x3,0x8(%rbx)
+}
+    1be9:	\-------> 5a                   	pop    %rdx
+    1bea:	          48 89 d8             	mov    %rbx,%rax
+    1bed:	          5b                   	pop    %rbx
+    1bee:	          5d                   	pop    %rbp
+    1bef:	          41 5c                	pop    %r12
+    1bf1:	          41 5d                	pop    %r13
+    1bf3:	          c3                   	ret
+
+0000000000001bf4 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)>:
+{
+    1bf4:	          48 81 ec 48 03 00 00 	sub    $0x348,%rsp
+    Length const kept = (n < max_digits) ? n : max_digits;
+    1bfb:	          b9 00 03 00 00       	mov    $0x300,%ecx
+    Length const n = ds.an + ds.bn;
+    1c00:	          4c 8b 47 18          	mov    0x18(%rdi),%r8
+{
+    1c04:	          49 89 f1             	mov    %rsi,%r9
+    Length const n = ds.an + ds.bn;
+    1c07:	          4c 03 47 08          	add    0x8(%rdi),%r8
+    Length const kept = (n < max_digits) ? n : max_digits;
+    1c0b:	          49 39 c8             	cmp    %rcx,%r8
+    1c0e:	          49 0f 46 c8          	cmovbe %r8,%rcx
+    for (Index i = 0; i < kept; ++i) {
+    1c12:	          31 d2                	xor    %edx,%edx
+    1c14:	   /----> 48 39 ca             	cmp    %rcx,%rdx
+    1c17:	   |  /-- 74 11                	je     1c2a <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x36>
+        buf[o++] = char(ds[i]);
+    1c19:	   |  |   48 89 d6             	mov    %rdx,%rsi
+    1c1c:	   |  |   e8 5f fe ff ff       	call   1a80 <nel::(anonymous namespace)::Digits::operator[](unsigned long) const>
+    1c21:	   |  |   88 44 14 20          	mov    %al,0x20(%rsp,%rdx,1)
+    for (Index i = 0; i < kept; ++i) {
+    1c25:	   |  |   48 ff c2             	inc    %rdx
+    1c28:	   \--|-- eb ea                	jmp    1c14 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x20>
+    q += (long long int)(n - kept);
+    1c2a:	      \-> 4c 89 c2             	mov    %r8,%rdx
+    1c2d:	          48 29 ca             	sub    %rcx,%rdx
+    1c30:	          4c 01 ca             	add    %r9,%rdx
+    for (Index i = kept; i < n; ++i) {
+    1c33:	          49 89 c9             	mov    %rcx,%r9
+    1c36:	/-------> 4d 39 c1             	cmp    %r8,%r9
+    1c39:	|  /----- 73 1e                	jae    1c59 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x65>
+        if (ds[i] != '0') {
+    1c3b:	|  |      4c 89 ce             	mov    %r9,%rsi
+    1c3e:	|  |      e8 3d fe ff ff       	call   1a80 <nel::(anonymous namespace)::Digits::operator[](unsigned long) const>
+    1c43:	|  |      3c 30                	cmp    $0x30,%al
+    1c45:	|  |  /-- 74 0d                	je     1c54 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x60>
+            buf[o++] = '1';
+    1c47:	|  |  |   c6 44 0c 20 31       	movb   $0x31,0x20(%rsp,%rcx,1)
+            q -= 1;
+    1c4c:	|  |  |   48 ff ca             	dec    %rdx
+        buf[o++] = char(ds[i]);
+    1c4f:	|  |  |   48 ff c1             	inc    %rcx
+            break;
+    1c52:	|  +--|-- eb 05                	jmp    1c59 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x65>
+    for (Index i = kept; i < n; ++i) {
+    1c54:	|  |  \-> 49 ff c1             	inc    %r9
+    1c57:	\--|----- eb dd                	jmp    1c36 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x42>
+    buf[o++] = 'e';
+    1c59:	   \----> c6 44 0c 20 65       	movb   $0x65,0x20(%rsp,%rcx,1)
+    1c5e:	          48 8d 71 01          	lea    0x1(%rcx),%rsi
+    if (q < 0) {
+    1c62:	          48 85 d2             	test   %rdx,%rdx
+    1c65:	      /-- 79 0c                	jns    1c73 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x7f>
+        buf[o++] = '-';
+    1c67:	      |   c6 44 34 20 2d       	movb   $0x2d,0x20(%rsp,%rsi,1)
+        q = -q;
+    1c6c:	      |   48 f7 da             	neg    %rdx
+        buf[o++] = '-';
+    1c6f:	      |   48 8d 71 02          	lea    0x2(%rcx),%rsi
+    Index en = 0;
+    1c73:	      \-> 31 c9                	xor    %ecx,%ecx
+        e[en++] = char('0' + q % 10);
+    1c75:	          4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+    1c7a:	          bf 0a 00 00 00       	mov    $0xa,%edi
+    1c7f:	      /-> 48 89 d0             	mov    %rdx,%rax
+    1c82:	      |   48 ff c1             	inc    %rcx
+    1c85:	      |   48 99                	cqto
+    1c87:	      |   48 f7 ff             	idiv   %rdi
+    1c8a:	      |   83 c2 30             	add    $0x30,%edx
+    1c8d:	      |   41 88 14 08          	mov    %dl,(%r8,%rcx,1)
+        q /= 10;
+    1c91:	      |   48 89 c2             	mov    %rax,%rdx
+    } while (q != 0);
+    1c94:	      |   48 85 c0             	test   %rax,%rax
+    1c97:	      \-- 75 e6                	jne    1c7f <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0x8b>
+    1c99:	          48 8d 7c 24 20       	lea    0x20(%rsp),%rdi
+        e[en++] = char('0' + q % 10);
+    1c9e:	          48 89 c8             	mov    %rcx,%rax
+    1ca1:	          48 8d 14 37          	lea    (%rdi,%rsi,1),%rdx
+        buf[o++] = e[--en];
+    1ca5:	      /-> 48 ff c8             	dec    %rax
+    while (en > 0) {
+    1ca8:	      |   48 ff c2             	inc    %rdx
+        buf[o++] = e[--en];
+    1cab:	      |   44 8a 44 04 08       	mov    0x8(%rsp,%rax,1),%r8b
+    1cb0:	      |   44 88 42 ff          	mov    %r8b,-0x1(%rdx)
+    while (en > 0) {
+    1cb4:	      |   48 85 c0             	test   %rax,%rax
+    1cb7:	      \-- 75 ec                	jne    1ca5 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)+0xb1>
+    buf[o] = '\0';
+    1cb9:	          48 8d 86 40 03 00 00 	lea    0x340(%rsi),%rax
+    1cc0:	          48 8d 34 04          	lea    (%rsp,%rax,1),%rsi
+    1cc4:	          c6 84 31 e0 fc ff ff 	movb   $0x0,-0x320(%rcx,%rsi,1)
+    1ccb:	          00 
+    return std::strtod(buf, nullptr);
+    1ccc:	          31 f6                	xor    %esi,%esi
+    1cce:	          e8 6d f3 ff ff       	call   1040 <strtod@plt>
+}
+    1cd3:	          48 81 c4 48 03 00 00 	add    $0x348,%rsp
+    1cda:	          c3                   	ret
+
+0000000000001cdb <nel::(anonymous namespace)::compute_float(long long, unsigned long long)>:
+    if (w == 0 || q < pow5_min) { return Binary{0, 0}; }
+    1cdb:	                48 85 f6             	test   %rsi,%rsi
+    1cde:	/-------------- 0f 84 2f 01 00 00    	je     1e13 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x138>
+    1ce4:	|               48 81 ff aa fe ff ff 	cmp    $0xfffffffffffffeaa,%rdi
+    1ceb:	+-------------- 0f 8c 22 01 00 00    	jl     1e13 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x138>
+    if (q > pow5_max) { return Binary{0, infinite_power}; }
+    1cf1:	|               48 81 ff 34 01 00 00 	cmp    $0x134,%rdi
+    1cf8:	|  /----------- 0f 8f 1a 01 00 00    	jg     1e18 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x13d>
+    int const lz = __builtin_clzll(w);
+    1cfe:	|  |            4c 0f bd d6          	bsr    %rsi,%r10
+    Wide p = mul_wide(w, pow5_128[k]);
+    1d02:	|  |            4c 8d 1d 37 14 00 00 	lea    0x1437(%rip),%r11        # 3140 <nel::(anonymous namespace)::pow5_128>
+    int const lz = __builtin_clzll(w);
+    1d09:	|  |            49 83 f2 3f          	xor    $0x3f,%r10
+    w <<= lz;
+    1d0d:	|  |            44 89 d1             	mov    %r10d,%ecx
+    1d10:	|  |            48 d3 e6             	shl    %cl,%rsi
+    Index const k = Index(2 * (q - pow5_min));
+    1d13:	|  |            48 8d 8f 56 01 00 00 	lea    0x156(%rdi),%rcx
+    1d1a:	|  |            48 01 c9             	add    %rcx,%rcx
+    U128 const r = U128(a) * b;
+    1d1d:	|  |            48 89 f0             	mov    %rsi,%rax
+    1d20:	|  |            49 f7 24 cb          	mulq   (%r11,%rcx,8)
+    return Wide{Word(r), Word(r >> 64)};
+    1d24:	|  |            49 89 c1             	mov    %rax,%r9
+    if ((p.hi & precision_mask) == precision_mask) {
+    1d27:	|  |            48 89 d0             	mov    %rdx,%rax
+    return Wide{Word(r), Word(r >> 64)};
+    1d2a:	|  |            49 89 d0             	mov    %rdx,%r8
+    if ((p.hi & precision_mask) == precision_mask) {
+    1d2d:	|  |            25 ff 01 00 00       	and    $0x1ff,%eax
+    1d32:	|  |            48 3d ff 01 00 00    	cmp    $0x1ff,%rax
+    1d38:	|  |        /-- 75 1e                	jne    1d58 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x7d>
+    return Wide{Word(r), Word(r >> 64)};
+    1d3a:	|  |        |   48 89 f0             	mov    %rsi,%rax
+    1d3d:	|  |        |   49 f7 64 cb 08       	mulq   0x8(%r11,%rcx,8)
+    1d42:	|  |        |   31 c0                	xor    %eax,%eax
+    1d44:	|  |        |   48 89 d6             	mov    %rdx,%rsi
+    1d47:	|  |        |   4c 01 ce             	add    %r9,%rsi
+    1d4a:	|  |        |   0f 92 c0             	setb   %al
+        p.lo += p2.hi;
+    1d4d:	|  |        |   49 89 f1             	mov    %rsi,%r9
+        if (p2.hi > p.lo) { p.hi += 1; }
+    1d50:	|  |        |   48 83 f8 01          	cmp    $0x1,%rax
+    1d54:	|  |        |   49 83 d8 ff          	sbb    $0xffffffffffffffff,%r8
+    r.power2 = int((((152170 + 65536) * q) >> 16) + 63) + upperbit - lz + 1023;
+    1d58:	|  |        \-> 48 69 f7 6a 52 03 00 	imul   $0x3526a,%rdi,%rsi
+    int const upperbit = int(p.hi >> 63);
+    1d5f:	|  |            4c 89 c2             	mov    %r8,%rdx
+    r.mantissa = p.hi >> shift;
+    1d62:	|  |            4c 89 c0             	mov    %r8,%rax
+    int const upperbit = int(p.hi >> 63);
+    1d65:	|  |            48 c1 ea 3f          	shr    $0x3f,%rdx
+    int const shift = upperbit + 64 - mantissa_bits - 3;
+    1d69:	|  |            8d 4a 09             	lea    0x9(%rdx),%ecx
+    r.power2 = int((((152170 + 65536) * q) >> 16) + 63) + upperbit - lz + 1023;
+    1d6c:	|  |            48 c1 fe 10          	sar    $0x10,%rsi
+    r.mantissa = p.hi >> shift;
+    1d70:	|  |            48 d3 e8             	shr    %cl,%rax
+    r.power2 = int((((152170 + 65536) * q) >> 16) + 63) + upperbit - lz + 1023;
+    1d73:	|  |            44 29 d6             	sub    %r10d,%esi
+    1d76:	|  |            01 d6                	add    %edx,%esi
+    1d78:	|  |            8d 96 3e 04 00 00    	lea    0x43e(%rsi),%edx
+    if (r.power2 <= 0) {
+    1d7e:	|  |            85 d2                	test   %edx,%edx
+    1d80:	|  |        /-- 7f 29                	jg     1dab <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0xd0>
+        if (-r.power2 + 1 >= 64) { return Binary{0, 0}; }
+    1d82:	|  |        |   b9 01 00 00 00       	mov    $0x1,%ecx
+    1d87:	|  |        |   29 d1                	sub    %edx,%ecx
+    1d89:	|  |        |   83 f9 3f             	cmp    $0x3f,%ecx
+    1d8c:	|  |  /-----|-- 7f 79                	jg     1e07 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x12c>
+        r.power2 = (r.mantissa < (1ULL << mantissa_bits)) ? 0 : 1;
+    1d8e:	|  |  |     |   48 ba ff ff ff ff ff 	movabs $0xfffffffffffff,%rdx
+    1d95:	|  |  |     |   ff 0f 00 
+        r.mantissa >>= -r.power2 + 1;
+    1d98:	|  |  |     |   48 d3 e8             	shr    %cl,%rax
+        r.mantissa += (r.mantissa & 1);
+    1d9b:	|  |  |     |   48 ff c0             	inc    %rax
+    1d9e:	|  |  |     |   48 d1 e8             	shr    %rax
+        r.power2 = (r.mantissa < (1ULL << mantissa_bits)) ? 0 : 1;
+    1da1:	|  |  |     |   48 39 c2             	cmp    %rax,%rdx
+    1da4:	|  |  |     |   0f 92 c2             	setb   %dl
+    1da7:	|  |  |     |   0f b6 d2             	movzbl %dl,%edx
+        return r;
+    1daa:	|  |  |     |   c3                   	ret
+    if (p.lo <= 1 && q >= -4 && q <= 23 && (r.mantissa & 3) == 1 &&
+    1dab:	|  |  |     \-> 49 83 f9 01          	cmp    $0x1,%r9
+    1daf:	|  |  |     /-- 77 24                	ja     1dd5 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0xfa>
+    1db1:	|  |  |     |   48 83 c7 04          	add    $0x4,%rdi
+    1db5:	|  |  |     |   48 83 ff 1b          	cmp    $0x1b,%rdi
+    1db9:	|  |  |     +-- 77 1a                	ja     1dd5 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0xfa>
+    1dbb:	|  |  |     |   48 89 c7             	mov    %rax,%rdi
+    1dbe:	|  |  |     |   83 e7 03             	and    $0x3,%edi
+    1dc1:	|  |  |     |   48 ff cf             	dec    %rdi
+    1dc4:	|  |  |     +-- 75 0f                	jne    1dd5 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0xfa>
+        (r.mantissa << shift) == p.hi) {
+    1dc6:	|  |  |     |   48 89 c7             	mov    %rax,%rdi
+    1dc9:	|  |  |     |   48 d3 e7             	shl    %cl,%rdi
+    if (p.lo <= 1 && q >= -4 && q <= 23 && (r.mantissa & 3) == 1 &&
+    1dcc:	|  |  |     |   49 39 f8             	cmp    %rdi,%r8
+    1dcf:	|  |  |     +-- 75 04                	jne    1dd5 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0xfa>
+        r.mantissa &= ~1ULL;
+    1dd1:	|  |  |     |   48 83 e0 fe          	and    $0xfffffffffffffffe,%rax
+    if (r.mantissa >= (2ULL << mantissa_bits)) {
+    1dd5:	|  |  |     \-> 48 b9 ff ff ff ff ff 	movabs $0x1fffffffffffff,%rcx
+    1ddc:	|  |  |         ff 1f 00 
+    r.mantissa += (r.mantissa & 1);
+    1ddf:	|  |  |         48 ff c0             	inc    %rax
+    1de2:	|  |  |         48 d1 e8             	shr    %rax
+    if (r.mantissa >= (2ULL << mantissa_bits)) {
+    1de5:	|  |  |         48 39 c1             	cmp    %rax,%rcx
+    1de8:	|  |  |     /-- 73 0f                	jae    1df9 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x11e>
+        r.mantissa = 1ULL << mantissa_bits;
+    1dea:	|  |  |     |   b8 01 00 00 00       	mov    $0x1,%eax
+        r.power2 += 1;
+    1def:	|  |  |     |   8d 96 3f 04 00 00    	lea    0x43f(%rsi),%edx
+        r.mantissa = 1ULL << mantissa_bits;
+    1df5:	|  |  |     |   48 c1 e0 34          	shl    $0x34,%rax
+    if (r.power2 >= infinite_power) { return Binary{0, infinite_power}; }
+    1df9:	|  |  |     \-> 81 fa fe 07 00 00    	cmp    $0x7fe,%edx
+    1dff:	|  |  |  /----- 7f 0a                	jg     1e0b <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x130>
+    r.mantissa &= ~(1ULL << mantissa_bits);
+    1e01:	|  |  |  |      48 0f ba f0 34       	btr    $0x34,%rax
+    return r;
+    1e06:	|  |  |  |      c3                   	ret
+        if (-r.power2 + 1 >= 64) { return Binary{0, 0}; }
+    1e07:	|  |  \--|----> 31 d2                	xor    %edx,%edx
+    1e09:	|  |     |  /-- eb 05                	jmp    1e10 <nel::(anonymous namespace)::compute_float(long long, unsigned long long)+0x135>
+    if (r.power2 >= infinite_power) { return Binary{0, infinite_power}; }
+    1e0b:	|  |     \--|-> ba ff 07 00 00       	mov    $0x7ff,%edx
+    1e10:	|  |        \-> 31 c0                	xor    %eax,%eax
+    1e12:	|  |            c3                   	ret
+    1e13:	\--|----------> 31 c0                	xor    %eax,%eax
+    1e15:	   |            31 d2                	xor    %edx,%edx
+    1e17:	   |            c3                   	ret
+    1e18:	   \----------> 31 c0                	xor    %eax,%eax
+    1e1a:	                ba ff 07 00 00       	mov    $0x7ff,%edx
+}
+    1e1f:	                c3                   	ret
+
+0000000000001e20 <nel::parse_u64(nel::Slice<unsigned char const> const&)>:
+
+} // namespace
+
+Result<Pair<long long unsigned int, Length>, ParseError>
+parse_u64(Slice<unsigned char const> const &s)
+{
+    1e20:	53                   	push   %rbx
+    return parse_magnitude(s.ptr(), s.len());
+    1e21:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+{
+    1e25:	48 89 fb             	mov    %rdi,%rbx
+    return parse_magnitude(s.ptr(), s.len());
+    1e28:	48 8b 36             	mov    (%rsi),%rsi
+    1e2b:	e8 f3 fc ff ff       	call   1b23 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)>
+}
+    1e30:	48 89 d8             	mov    %rbx,%rax
+    1e33:	5b                   	pop    %rbx
+    1e34:	c3                   	ret
+
+0000000000001e35 <nel::parse_i64(nel::Slice<unsigned char const> const&)>:
+
+Result<Pair<long long int, Length>, ParseError> parse_i64(Slice<unsigned char const> const &s)
+{
+    1e35:	                41 54                	push   %r12
+    1e37:	                55                   	push   %rbp
+    1e38:	                53                   	push   %rbx
+    1e39:	                48 89 fb             	mov    %rdi,%rbx
+    1e3c:	                48 83 ec 30          	sub    $0x30,%rsp
+         *
+         * @returns number of elements in the slice.
+         */
+        constexpr Length len(void) const
+        {
+            return len_;
+    1e40:	                48 8b 56 08          	mov    0x8(%rsi),%rdx
+            return content_;
+    1e44:	                48 8b 06             	mov    (%rsi),%rax
+    typedef Result<Pair<long long int, Length>, ParseError> R;
+    unsigned char const *const p = s.ptr();
+    Length const n = s.len();
+    if (n == 0) { return R::Err(ParseError::Empty); }
+    1e47:	                48 85 d2             	test   %rdx,%rdx
+    1e4a:	            /-- 75 12                	jne    1e5e <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x29>
+    1e4c:	            |   c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+    1e52:	            |   c7 47 08 01 00 00 00 	movl   $0x1,0x8(%rdi)
+    1e59:	/-----------|-- e9 cc 00 00 00       	jmp    1f2a <nel::parse_i64(nel::Slice<unsigned char const> const&)+0xf5>
+    bool const neg = p[0] == '-';
+    1e5e:	|           \-> 44 8a 20             	mov    (%rax),%r12b
+    Index const i = (neg || p[0] == '+') ? 1 : 0;
+    1e61:	|               31 ed                	xor    %ebp,%ebp
+    auto m = parse_magnitude(p + i, n - i);
+    1e63:	|               48 89 e7             	mov    %rsp,%rdi
+    Index const i = (neg || p[0] == '+') ? 1 : 0;
+    1e66:	|               41 8d 4c 24 d5       	lea    -0x2b(%r12),%ecx
+    1e6b:	|               80 e1 fd             	and    $0xfd,%cl
+    1e6e:	|               40 0f 94 c5          	sete   %bpl
+    auto m = parse_magnitude(p + i, n - i);
+    1e72:	|               48 8d 34 28          	lea    (%rax,%rbp,1),%rsi
+    1e76:	|               48 29 ea             	sub    %rbp,%rdx
+    1e79:	|               e8 a5 fc ff ff       	call   1b23 <nel::(anonymous namespace)::parse_magnitude(unsigned char const*, unsigned long)>
+            : fn_name_(fn_name)
+    1e7e:	|               48 8d 05 72 12 00 00 	lea    0x1272(%rip),%rax        # 30f7 <_IO_stdin_used+0xf7>
+            , line_num_(line_num)
+    1e85:	|               c7 44 24 28 dc 03 00 	movl   $0x3dc,0x28(%rsp)
+    1e8c:	|               00 
+            : fn_name_(fn_name)
+    1e8d:	|               48 89 44 24 18       	mov    %rax,0x18(%rsp)
+            , file_name_(file_name)
+    1e92:	|               48 8d 05 68 12 00 00 	lea    0x1268(%rip),%rax        # 3101 <_IO_stdin_used+0x101>
+    1e99:	|               48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    1e9e:	|               8b 04 24             	mov    (%rsp),%eax
+            switch (tag_) { // result-match
+    1ea1:	|               83 f8 01             	cmp    $0x1,%eax
+    1ea4:	|        /----- 74 21                	je     1ec7 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x92>
+    1ea6:	|        |      83 f8 02             	cmp    $0x2,%eax
+    1ea9:	|  /-----|----- 74 2e                	je     1ed9 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0xa4>
+    1eab:	|  |     |      85 c0                	test   %eax,%eax
+                    nel::panic("invalid Result", ctx);
+    1ead:	|  |     |      48 8d 3d ae 11 00 00 	lea    0x11ae(%rip),%rdi        # 3062 <_IO_stdin_used+0x62>
+    1eb4:	|  |     |      48 8d 74 24 18       	lea    0x18(%rsp),%rsi
+            switch (tag_) { // result-match
+    1eb9:	|  |     |  /-- 74 07                	je     1ec2 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0x8d>
+                    nel::panic("bad Result", ctx);
+    1ebb:	|  |     |  |   48 8d 3d af 11 00 00 	lea    0x11af(%rip),%rdi        # 3071 <_IO_stdin_used+0x71>
+    1ec2:	|  |     |  \-> e8 1b f2 ff ff       	call   10e2 <nel::panic(char const*, nel::Context const&)>
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    1ec7:	|  |     \----> 48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    1ecc:	|  |            48 8b 54 24 10       	mov    0x10(%rsp),%rdx
+        ParseError const e = m.unwrap_err();
+        // a lone sign has no digits, it's not empty.
+        return R::Err((e == ParseError::Empty) ? ParseError::InvalidDigit : e);
+    }
+    auto const v = m.unwrap();
+    Word const limit = neg ? (1ULL << 63) : (1ULL << 63) - 1;
+    1ed1:	|  |            41 80 fc 2d          	cmp    $0x2d,%r12b
+    1ed5:	|  |     /----- 75 1b                	jne    1ef2 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0xbd>
+    1ed7:	|  |  /--|----- eb 20                	jmp    1ef9 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0xc4>
+         * this is consumed by the operation.
+         */
+        constexpr E unwrap_err(Context const &ctx = Context())
+        {
+            return consume<E>([&](T &&) -> E { nel::panic("not an err", ctx); },
+                              [](E &&err) -> E { return err; },
+    1ed9:	|  \--|--|----> 8b 44 24 08          	mov    0x8(%rsp),%eax
+        return R::Err((e == ParseError::Empty) ? ParseError::InvalidDigit : e);
+    1edd:	|     |  |      83 f8 01             	cmp    $0x1,%eax
+    1ee0:	|     |  |  /-- 75 05                	jne    1ee7 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0xb2>
+    1ee2:	|     |  |  |   b8 02 00 00 00       	mov    $0x2,%eax
+            : tag_(Tag::ERR)
+    1ee7:	|     |  |  \-> c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+    1eed:	|     |  |      89 43 08             	mov    %eax,0x8(%rbx)
+    1ef0:	+-----|--|----- eb 38                	jmp    1f2a <nel::parse_i64(nel::Slice<unsigned char const> const&)+0xf5>
+    if (v.first > limit) { return R::Err(ParseError::Overflow); }
+    1ef2:	|     |  \----> 48 85 c0             	test   %rax,%rax
+    1ef5:	|     |  /----- 78 10                	js     1f07 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0xd2>
+    1ef7:	|  /--|--|----- eb 20                	jmp    1f19 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0xe4>
+    1ef9:	|  |  \--|----> b9 01 00 00 00       	mov    $0x1,%ecx
+    1efe:	|  |     |      48 c1 e1 3f          	shl    $0x3f,%rcx
+    1f02:	|  |     |      48 39 c1             	cmp    %rax,%rcx
+    1f05:	|  |     |  /-- 73 0f                	jae    1f16 <nel::parse_i64(nel::Slice<unsigned char const> const&)+0xe1>
+    1f07:	|  |     \--|-> c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+    1f0d:	|  |        |   c7 43 08 03 00 00 00 	movl   $0x3,0x8(%rbx)
+    1f14:	+--|--------|-- eb 14                	jmp    1f2a <nel::parse_i64(nel::Slice<unsigned char const> const&)+0xf5>
+    long long int const r = neg ? (long long int)(0 - v.first) : (long long int)v.first;
+    1f16:	|  |        \-> 48 f7 d8             	neg    %rax
+    return R::Ok(Pair<long long int, Length>{r, i + v.second});
+    1f19:	|  \----------> 48 01 d5             	add    %rdx,%rbp
+            : tag_(Tag::OK)
+    1f1c:	|               c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+    1f22:	|               48 89 43 08          	mov    %rax,0x8(%rbx)
+    1f26:	|               48 89 6b 10          	mov    %rbp,0x10(%rbx)
+}
+    1f2a:	\-------------> 48 83 c4 30          	add    $0x30,%rsp
+    1f2e:	                48 89 d8             	mov    %rbx,%rax
+    1f31:	                5b                   	pop    %rbx
+    1f32:	                5d                   	pop    %rbp
+    1f33:	                41 5c                	pop    %r12
+    1f35:	                c3                   	ret
+
+0000000000001f36 <nel::parse_f64(nel::Slice<unsigned char const> const&)>:
+
+Result<Pair<double, Length>, ParseError> parse_f64(Slice<unsigned char const> const &s)
+{
+    1f36:	                         41 57                	push   %r15
+    1f38:	                         41 56                	push   %r14
+    1f3a:	                         41 55                	push   %r13
+    1f3c:	                         41 54                	push   %r12
+    1f3e:	                         55                   	push   %rbp
+    1f3f:	                         53                   	push   %rbx
+    1f40:	                         48 89 fb             	mov    %rdi,%rbx
+    1f43:	                         48 83 ec 58          	sub    $0x58,%rsp
+            return len_;
+    1f47:	                         48 8b 46 08          	mov    0x8(%rsi),%rax
+            return content_;
+    1f4b:	                         4c 8b 3e             	mov    (%rsi),%r15
+            return len_;
+    1f4e:	                         48 89 04 24          	mov    %rax,(%rsp)
+    typedef Result<Pair<double, Length>, ParseError> R;
+    unsigned char const *const p = s.ptr();
+    Length const n = s.len();
+    if (n == 0) { return R::Err(ParseError::Empty); }
+    1f52:	                         48 85 c0             	test   %rax,%rax
+    1f55:	                     /-- 75 12                	jne    1f69 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x33>
+            : tag_(Tag::ERR)
+    1f57:	                     |   c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+    1f5d:	                     |   c7 47 08 01 00 00 00 	movl   $0x1,0x8(%rdi)
+    1f64:	/--------------------|-- e9 6a 04 00 00       	jmp    23d3 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x49d>
+
+    Index i = 0;
+    bool const neg = p[0] == '-';
+    1f69:	|                    \-> 41 8a 07             	mov    (%r15),%al
+    1f6c:	|                        88 44 24 0f          	mov    %al,0xf(%rsp)
+    if (neg || p[0] == '+') { i = 1; }
+    1f70:	|                        83 e8 2b             	sub    $0x2b,%eax
+    1f73:	|                        a8 fd                	test   $0xfd,%al
+    1f75:	|                 /----- 75 0e                	jne    1f85 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x4f>
+
+    if (i < n && !is_digit(p[i]) && p[i] != '.') {
+    1f77:	|                 |      48 83 3c 24 01       	cmpq   $0x1,(%rsp)
+    1f7c:	|                 |      bd 01 00 00 00       	mov    $0x1,%ebp
+    1f81:	|              /--|----- 74 2f                	je     1fb2 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x7c>
+    1f83:	|              |  |  /-- eb 02                	jmp    1f87 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x51>
+    Index i = 0;
+    1f85:	|              |  \--|-> 31 ed                	xor    %ebp,%ebp
+    if (i < n && !is_digit(p[i]) && p[i] != '.') {
+    1f87:	|              |     \-> 49 8d 3c 2f          	lea    (%r15,%rbp,1),%rdi
+    1f8b:	|              |         8a 07                	mov    (%rdi),%al
+    return (unsigned char)(c - '0') < 10;
+    1f8d:	|              |         8d 50 d0             	lea    -0x30(%rax),%edx
+    if (i < n && !is_digit(p[i]) && p[i] != '.') {
+    1f90:	|              |         80 fa 09             	cmp    $0x9,%dl
+    1f93:	|              +-------- 76 1d                	jbe    1fb2 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x7c>
+    1f95:	|              |         3c 2e                	cmp    $0x2e,%al
+    1f97:	|              +-------- 74 19                	je     1fb2 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x7c>
+        if (starts_with_word(p + i, n - i, "infinity")) {
+    1f99:	|              |         48 8b 34 24          	mov    (%rsp),%rsi
+    1f9d:	|              |         48 8d 15 6e 11 00 00 	lea    0x116e(%rip),%rdx        # 3112 <_IO_stdin_used+0x112>
+    1fa4:	|              |         48 29 ee             	sub    %rbp,%rsi
+    1fa7:	|              |         e8 ed fa ff ff       	call   1a99 <nel::(anonymous namespace)::starts_with_word(unsigned char const*, unsigned long, char const*)>
+    1fac:	|              |         84 c0                	test   %al,%al
+    1fae:	|              |     /-- 75 3a                	jne    1fea <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xb4>
+    1fb0:	|           /--|-----|-- eb 60                	jmp    2012 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xdc>
+        }
+        return R::Err(ParseError::InvalidDigit);
+    }
+
+    Index const int_b = i;
+    Index const int_e = int_b + digit_run(p + int_b, n - int_b);
+    1fb2:	|           |  \-----|-> 48 8b 34 24          	mov    (%rsp),%rsi
+    1fb6:	|           |        |   49 8d 3c 2f          	lea    (%r15,%rbp,1),%rdi
+    1fba:	|           |        |   48 29 ee             	sub    %rbp,%rsi
+    1fbd:	|           |        |   e8 fd fa ff ff       	call   1abf <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)>
+    1fc2:	|           |        |   4c 8d 34 28          	lea    (%rax,%rbp,1),%r14
+    Index frac_b = int_e;
+    Index frac_e = int_e;
+    if (int_e < n && p[int_e] == '.') {
+    1fc6:	|           |        |   48 8b 04 24          	mov    (%rsp),%rax
+    1fca:	|           |        |   49 39 c6             	cmp    %rax,%r14
+    1fcd:	|        /--|--------|-- 0f 82 a7 00 00 00    	jb     207a <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x144>
+        frac_b = int_e + 1;
+        frac_e = frac_b + digit_run(p + frac_b, n - frac_b);
+    }
+    if (int_e == int_b && frac_e == frac_b) { return R::Err(ParseError::InvalidDigit); }
+    1fd3:	|        |  |        |   49 39 ee             	cmp    %rbp,%r14
+    1fd6:	|     /--|--|--------|-- 0f 84 e1 00 00 00    	je     20bd <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x187>
+    Index frac_e = int_e;
+    1fdc:	|     |  |  |        |   4d 89 f4             	mov    %r14,%r12
+    Index frac_b = int_e;
+    1fdf:	|     |  |  |        |   4c 89 f2             	mov    %r14,%rdx
+    Index frac_e = int_e;
+    1fe2:	|     |  |  |        |   4d 89 f5             	mov    %r14,%r13
+    1fe5:	|  /--|--|--|--------|-- e9 99 01 00 00       	jmp    2183 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x24d>
+            return R::Ok(Pair<double, Length>{neg ? -__builtin_inf() : __builtin_inf(), i + 8});
+    1fea:	|  |  |  |  |        \-> 80 7c 24 0f 2d       	cmpb   $0x2d,0xf(%rsp)
+    1fef:	|  |  |  |  |            f2 0f 10 05 71 3b 00 	movsd  0x3b71(%rip),%xmm0        # 5b68 <nel::(anonymous namespace)::pow10_u64+0xa8>
+    1ff6:	|  |  |  |  |            00 
+    1ff7:	|  |  |  |  |        /-- 75 08                	jne    2001 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0xcb>
+    1ff9:	|  |  |  |  |        |   f2 0f 10 05 5f 3b 00 	movsd  0x3b5f(%rip),%xmm0        # 5b60 <nel::(anonymous namespace)::pow10_u64+0xa0>
+    2000:	|  |  |  |  |        |   00 
+            : tag_(Tag::OK)
+    2001:	|  |  |  |  |        \-> c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+    2007:	|  |  |  |  |            48 8d 4d 08          	lea    0x8(%rbp),%rcx
+    200b:	|  |  |  |  |            f2 0f 11 43 08       	movsd  %xmm0,0x8(%rbx)
+    2010:	|  |  |  |  |     /----- eb 36                	jmp    2048 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x112>
+        if (starts_with_word(p + i, n - i, "inf")) {
+    2012:	|  |  |  |  \-----|----> 48 8d 15 02 11 00 00 	lea    0x1102(%rip),%rdx        # 311b <_IO_stdin_used+0x11b>
+    2019:	|  |  |  |        |      e8 7b fa ff ff       	call   1a99 <nel::(anonymous namespace)::starts_with_word(unsigned char const*, unsigned long, char const*)>
+    201e:	|  |  |  |        |      84 c0                	test   %al,%al
+    2020:	|  |  |  |        |  /-- 74 2f                	je     2051 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x11b>
+            return R::Ok(Pair<double, Length>{neg ? -__builtin_inf() : __builtin_inf(), i + 3});
+    2022:	|  |  |  |        |  |   80 7c 24 0f 2d       	cmpb   $0x2d,0xf(%rsp)
+    2027:	|  |  |  |        |  |   f2 0f 10 05 39 3b 00 	movsd  0x3b39(%rip),%xmm0        # 5b68 <nel::(anonymous namespace)::pow10_u64+0xa8>
+    202e:	|  |  |  |        |  |   00 
+    202f:	|  |  |  |     /--|--|-- 75 08                	jne    2039 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x103>
+    2031:	|  |  |  |     |  |  |   f2 0f 10 05 27 3b 00 	movsd  0x3b27(%rip),%xmm0        # 5b60 <nel::(anonymous namespace)::pow10_u64+0xa0>
+    2038:	|  |  |  |     |  |  |   00 
+    2039:	|  |  |  |     >--|--|-> c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+    203f:	|  |  |  |     |  |  |   48 8d 4d 03          	lea    0x3(%rbp),%rcx
+    2043:	|  |  |  |     |  |  |   f2 0f 11 43 08       	movsd  %xmm0,0x8(%rbx)
+    2048:	|  |  |  |     |  \--|-> 48 89 4b 10          	mov    %rcx,0x10(%rbx)
+    204c:	+--|--|--|-----|-----|-- e9 82 03 00 00       	jmp    23d3 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x49d>
+        if (starts_with_word(p + i, n - i, "nan")) {
+    2051:	|  |  |  |     |     \-> 48 8d 15 c7 10 00 00 	lea    0x10c7(%rip),%rdx        # 311f <_IO_stdin_used+0x11f>
+    2058:	|  |  |  |     |         e8 3c fa ff ff       	call   1a99 <nel::(anonymous namespace)::starts_with_word(unsigned char const*, unsigned long, char const*)>
+    205d:	|  |  |  |     |         84 c0                	test   %al,%al
+    205f:	|  |  +--|-----|-------- 74 5c                	je     20bd <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x187>
+            return R::Ok(Pair<double, Length>{neg ? -__builtin_nan("") : __builtin_nan(""), i + 3});
+    2061:	|  |  |  |     |         80 7c 24 0f 2d       	cmpb   $0x2d,0xf(%rsp)
+    2066:	|  |  |  |     |         f2 0f 10 05 0a 3b 00 	movsd  0x3b0a(%rip),%xmm0        # 5b78 <nel::(anonymous namespace)::pow10_u64+0xb8>
+    206d:	|  |  |  |     |         00 
+    206e:	|  |  |  |     +-------- 75 c9                	jne    2039 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x103>
+    2070:	|  |  |  |     |         f2 0f 10 05 f8 3a 00 	movsd  0x3af8(%rip),%xmm0        # 5b70 <nel::(anonymous namespace)::pow10_u64+0xb0>
+    2077:	|  |  |  |     |         00 
+        constexpr Result(Phantom<Tag::OK> const, T &&v)
+    2078:	|  |  |  |     \-------- eb bf                	jmp    2039 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x103>
+    if (int_e < n && p[int_e] == '.') {
+    207a:	|  |  |  \-------------> 43 80 3c 37 2e       	cmpb   $0x2e,(%r15,%r14,1)
+    207f:	|  |  |           /----- 75 24                	jne    20a5 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x16f>
+        frac_e = frac_b + digit_run(p + frac_b, n - frac_b);
+    2081:	|  |  |           |      48 8b 34 24          	mov    (%rsp),%rsi
+        frac_b = int_e + 1;
+    2085:	|  |  |           |      49 8d 56 01          	lea    0x1(%r14),%rdx
+        frac_e = frac_b + digit_run(p + frac_b, n - frac_b);
+    2089:	|  |  |           |      49 8d 3c 17          	lea    (%r15,%rdx,1),%rdi
+    208d:	|  |  |           |      48 89 54 24 10       	mov    %rdx,0x10(%rsp)
+    2092:	|  |  |           |      48 29 d6             	sub    %rdx,%rsi
+    2095:	|  |  |           |      e8 25 fa ff ff       	call   1abf <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)>
+    209a:	|  |  |           |      48 8b 54 24 10       	mov    0x10(%rsp),%rdx
+    209f:	|  |  |           |      4c 8d 24 10          	lea    (%rax,%rdx,1),%r12
+    20a3:	|  |  |           |  /-- eb 06                	jmp    20ab <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x175>
+    20a5:	|  |  |           \--|-> 4d 89 f4             	mov    %r14,%r12
+    20a8:	|  |  |              |   4c 89 f2             	mov    %r14,%rdx
+    if (int_e == int_b && frac_e == frac_b) { return R::Err(ParseError::InvalidDigit); }
+    20ab:	|  |  |              \-> 49 39 ee             	cmp    %rbp,%r14
+    20ae:	|  |  |                  41 0f 94 c1          	sete   %r9b
+    20b2:	|  |  |                  4c 39 e2             	cmp    %r12,%rdx
+    20b5:	|  |  |                  0f 94 c0             	sete   %al
+    20b8:	|  |  |                  41 20 c1             	and    %al,%r9b
+    20bb:	|  |  |              /-- 74 12                	je     20cf <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x199>
+            : tag_(Tag::ERR)
+    20bd:	|  |  \--------------|-> c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+    20c3:	|  |                 |   c7 43 08 02 00 00 00 	movl   $0x2,0x8(%rbx)
+    20ca:	+--|-----------------|-- e9 04 03 00 00       	jmp    23d3 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x49d>
+    i = frac_e;
+
+    // the exponent, clamped far beyond any double so it can't overflow.
+    long long int e = 0;
+    if (i < n && (p[i] | 0x20) == 'e') {
+    20cf:	|  |                 \-> 48 8b 04 24          	mov    (%rsp),%rax
+    20d3:	|  |                     49 39 c4             	cmp    %rax,%r12
+    20d6:	|  |        /----------- 0f 83 a4 00 00 00    	jae    2180 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x24a>
+    20dc:	|  |        |            43 8a 04 27          	mov    (%r15,%r12,1),%al
+    20e0:	|  |        |            83 c8 20             	or     $0x20,%eax
+    20e3:	|  |        |            3c 65                	cmp    $0x65,%al
+    20e5:	|  |        +----------- 0f 85 95 00 00 00    	jne    2180 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x24a>
+        Index j = i + 1;
+        bool const e_neg = j < n && p[j] == '-';
+    20eb:	|  |        |            48 8b 04 24          	mov    (%rsp),%rax
+        Index j = i + 1;
+    20ef:	|  |        |            4d 8d 44 24 01       	lea    0x1(%r12),%r8
+        bool const e_neg = j < n && p[j] == '-';
+    20f4:	|  |        |            49 39 c0             	cmp    %rax,%r8
+    20f7:	|  |        |        /-- 73 19                	jae    2112 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x1dc>
+    20f9:	|  |        |        |   43 8a 44 27 01       	mov    0x1(%r15,%r12,1),%al
+        if (j < n && (p[j] == '-' || p[j] == '+')) { j += 1; }
+    20fe:	|  |        |        |   8d 70 d5             	lea    -0x2b(%rax),%esi
+    2101:	|  |        |        |   40 80 e6 fd          	and    $0xfd,%sil
+    2105:	|  |        |        +-- 75 0b                	jne    2112 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x1dc>
+        bool const e_neg = j < n && p[j] == '-';
+    2107:	|  |        |        |   3c 2d                	cmp    $0x2d,%al
+        if (j < n && (p[j] == '-' || p[j] == '+')) { j += 1; }
+    2109:	|  |        |        |   4d 8d 44 24 02       	lea    0x2(%r12),%r8
+        bool const e_neg = j < n && p[j] == '-';
+    210e:	|  |        |        |   41 0f 94 c1          	sete   %r9b
+        Index const e_end = j + digit_run(p + j, n - j);
+    2112:	|  |        |        \-> 48 8b 34 24          	mov    (%rsp),%rsi
+    2116:	|  |        |            4b 8d 3c 07          	lea    (%r15,%r8,1),%rdi
+    211a:	|  |        |            48 89 54 24 20       	mov    %rdx,0x20(%rsp)
+    211f:	|  |        |            44 88 4c 24 18       	mov    %r9b,0x18(%rsp)
+    2124:	|  |        |            4c 29 c6             	sub    %r8,%rsi
+    2127:	|  |        |            4c 89 44 24 10       	mov    %r8,0x10(%rsp)
+    212c:	|  |        |            e8 8e f9 ff ff       	call   1abf <nel::(anonymous namespace)::digit_run(unsigned char const*, unsigned long)>
+    2131:	|  |        |            4c 8b 44 24 10       	mov    0x10(%rsp),%r8
+        if (e_end > j) {
+    2136:	|  |        |            44 8a 4c 24 18       	mov    0x18(%rsp),%r9b
+    213b:	|  |        |            48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+        Index const e_end = j + digit_run(p + j, n - j);
+    2140:	|  |        |            4e 8d 2c 00          	lea    (%rax,%r8,1),%r13
+        if (e_end > j) {
+    2144:	|  |        |            4d 39 e8             	cmp    %r13,%r8
+    2147:	|  |        +----------- 73 37                	jae    2180 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x24a>
+            for (; j < e_end; ++j) {
+                if (e < (1LL << 40)) { e = e * 10 + (p[j] - '0'); }
+    2149:	|  |        |            48 bf ff ff ff ff ff 	movabs $0xffffffffff,%rdi
+    2150:	|  |        |            00 00 00 
+    long long int e = 0;
+    2153:	|  |        |            31 c0                	xor    %eax,%eax
+                if (e < (1LL << 40)) { e = e * 10 + (p[j] - '0'); }
+    2155:	|  |        |  /-------> 43 0f b6 34 07       	movzbl (%r15,%r8,1),%esi
+    215a:	|  |        |  |         48 6b c0 0a          	imul   $0xa,%rax,%rax
+    215e:	|  |        |  |         83 ee 30             	sub    $0x30,%esi
+    2161:	|  |        |  |         48 63 f6             	movslq %esi,%rsi
+    2164:	|  |        |  |         48 01 f0             	add    %rsi,%rax
+            for (; j < e_end; ++j) {
+    2167:	|  |        |  |  /----> 49 ff c0             	inc    %r8
+    216a:	|  |        |  |  |      4d 39 c5             	cmp    %r8,%r13
+    216d:	|  |        |  |  |  /-- 74 07                	je     2176 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x240>
+                if (e < (1LL << 40)) { e = e * 10 + (p[j] - '0'); }
+    216f:	|  |        |  |  |  |   48 39 f8             	cmp    %rdi,%rax
+    2172:	|  |        |  |  \--|-- 7f f3                	jg     2167 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x231>
+    2174:	|  |        |  \-----|-- eb df                	jmp    2155 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x21f>
+            }
+            e = e_neg ? -e : e;
+    2176:	|  |        |        \-> 45 84 c9             	test   %r9b,%r9b
+    2179:	|  |        |  /-------- 74 16                	je     2191 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x25b>
+    217b:	|  |        |  |         48 f7 d8             	neg    %rax
+    217e:	|  |        |  +-------- eb 11                	jmp    2191 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x25b>
+    2180:	|  |        \--|-------> 4d 89 e5             	mov    %r12,%r13
+    long long int e = 0;
+    2183:	|  \-----------|-------> 31 c0                	xor    %eax,%eax
+    }
+    Length const used = i;
+
+    // the significant digits, from the first non-zero one, and the power of 10 they're scaled by.
+    Index a = int_b;
+    while (a < int_e && p[a] == '0') {
+    2185:	|              +-------- eb 0a                	jmp    2191 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x25b>
+    2187:	|              |     /-> 41 80 3c 2f 30       	cmpb   $0x30,(%r15,%rbp,1)
+    218c:	|              |  /--|-- 75 0a                	jne    2198 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x262>
+        a += 1;
+    218e:	|              |  |  |   48 ff c5             	inc    %rbp
+    while (a < int_e && p[a] == '0') {
+    2191:	|              \--|--|-> 4c 39 f5             	cmp    %r14,%rbp
+    2194:	|                 |  \-- 72 f1                	jb     2187 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x251>
+    2196:	|                 |  /-- eb 05                	jmp    219d <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x267>
+    2198:	|                 \--|-> 49 89 d0             	mov    %rdx,%r8
+    219b:	|                 /--|-- eb 16                	jmp    21b3 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x27d>
+    }
+    Index f = frac_b;
+    if (a == int_e) {
+    219d:	|                 |  \-> 49 89 d0             	mov    %rdx,%r8
+    21a0:	|                 +----- 75 11                	jne    21b3 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x27d>
+        while (f < frac_e && p[f] == '0') {
+    21a2:	|                 |  /-> 4d 39 e0             	cmp    %r12,%r8
+    21a5:	|                 +--|-- 73 0c                	jae    21b3 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x27d>
+    21a7:	|                 |  |   43 80 3c 07 30       	cmpb   $0x30,(%r15,%r8,1)
+    21ac:	|                 +--|-- 75 05                	jne    21b3 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x27d>
+            f += 1;
+    21ae:	|                 |  |   49 ff c0             	inc    %r8
+    21b1:	|                 |  \-- eb ef                	jmp    21a2 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x26c>
+        }
+    }
+    Digits const ds = {p + a, int_e - a, p + f, frac_e - f};
+    21b3:	|                 \----> 4c 89 f6             	mov    %r14,%rsi
+    21b6:	|                        4b 8d 0c 07          	lea    (%r15,%r8,1),%rcx
+    while (a < int_e && p[a] == '0') {
+    21ba:	|                        49 8d 3c 2f          	lea    (%r15,%rbp,1),%rdi
+    Digits const ds = {p + a, int_e - a, p + f, frac_e - f};
+    21be:	|                        4d 89 e1             	mov    %r12,%r9
+    21c1:	|                        48 29 ee             	sub    %rbp,%rsi
+    21c4:	|                        4d 29 c1             	sub    %r8,%r9
+    21c7:	|                        48 89 7c 24 30       	mov    %rdi,0x30(%rsp)
+    Length const n_sig = ds.an + ds.bn;
+    long long int q = e - (long long int)(frac_e - frac_b);
+    if (n_sig == 0) { return R::Ok(Pair<double, Length>{neg ? -0.0 : 0.0, used}); }
+    21cc:	|                        49 89 f7             	mov    %rsi,%r15
+    Digits const ds = {p + a, int_e - a, p + f, frac_e - f};
+    21cf:	|                        48 89 74 24 38       	mov    %rsi,0x38(%rsp)
+    21d4:	|                        48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+    21d9:	|                        48 89 4c 24 40       	mov    %rcx,0x40(%rsp)
+    21de:	|                        4c 89 4c 24 48       	mov    %r9,0x48(%rsp)
+    if (n_sig == 0) { return R::Ok(Pair<double, Length>{neg ? -0.0 : 0.0, used}); }
+    21e3:	|                        4d 01 cf             	add    %r9,%r15
+    21e6:	|                    /-- 75 1b                	jne    2203 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x2cd>
+    21e8:	|                    |   80 7c 24 0f 2d       	cmpb   $0x2d,0xf(%rsp)
+    21ed:	|                    |   0f 57 c0             	xorps  %xmm0,%xmm0
+    21f0:	|        /-----------|-- 0f 85 ce 01 00 00    	jne    23c4 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x48e>
+    21f6:	|        |           |   f2 0f 10 05 82 39 00 	movsd  0x3982(%rip),%xmm0        # 5b80 <nel::(anonymous namespace)::pow10_u64+0xc0>
+    21fd:	|        |           |   00 
+        constexpr Result(Phantom<Tag::OK> const, T &&v)
+    21fe:	|        +-----------|-- e9 c1 01 00 00       	jmp    23c4 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x48e>
+    long long int q = e - (long long int)(frac_e - frac_b);
+    2203:	|        |           \-> 4d 89 e3             	mov    %r12,%r11
+    2206:	|        |               4c 89 4c 24 28       	mov    %r9,0x28(%rsp)
+    220b:	|        |               49 29 d3             	sub    %rdx,%r11
+
+    // the first 19 digits, and whether any after them aren't 0.
+    Word w;
+    bool truncated = false;
+    if (n_sig <= 19) {
+        w = digits_value(ds.a, ds.an, n - a) * pow10_u64[ds.bn] + digits_value(ds.b, ds.bn, n - f);
+    220e:	|        |               48 8b 14 24          	mov    (%rsp),%rdx
+    long long int q = e - (long long int)(frac_e - frac_b);
+    2212:	|        |               4c 29 d8             	sub    %r11,%rax
+    2215:	|        |               48 89 44 24 18       	mov    %rax,0x18(%rsp)
+        w = digits_value(ds.a, ds.an, n - a) * pow10_u64[ds.bn] + digits_value(ds.b, ds.bn, n - f);
+    221a:	|        |               48 29 ea             	sub    %rbp,%rdx
+    if (n_sig <= 19) {
+    221d:	|        |               49 83 ff 13          	cmp    $0x13,%r15
+    2221:	|        |           /-- 77 42                	ja     2265 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x32f>
+    2223:	|        |           |   4c 89 44 24 20       	mov    %r8,0x20(%rsp)
+        w = digits_value(ds.a, ds.an, n - a) * pow10_u64[ds.bn] + digits_value(ds.b, ds.bn, n - f);
+    2228:	|        |           |   e8 b2 f7 ff ff       	call   19df <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    222d:	|        |           |   4c 8b 4c 24 28       	mov    0x28(%rsp),%r9
+    2232:	|        |           |   4c 8b 44 24 20       	mov    0x20(%rsp),%r8
+    2237:	|        |           |   49 89 c7             	mov    %rax,%r15
+    223a:	|        |           |   48 8b 14 24          	mov    (%rsp),%rdx
+    223e:	|        |           |   48 8d 05 7b 38 00 00 	lea    0x387b(%rip),%rax        # 5ac0 <nel::(anonymous namespace)::pow10_u64>
+    2245:	|        |           |   48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    224a:	|        |           |   4e 0f af 3c c8       	imul   (%rax,%r9,8),%r15
+    224f:	|        |           |   4c 89 ce             	mov    %r9,%rsi
+    2252:	|        |           |   4c 29 c2             	sub    %r8,%rdx
+    2255:	|        |           |   e8 85 f7 ff ff       	call   19df <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    long long int q = e - (long long int)(frac_e - frac_b);
+    225a:	|        |           |   4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+        w = digits_value(ds.a, ds.an, n - a) * pow10_u64[ds.bn] + digits_value(ds.b, ds.bn, n - f);
+    225f:	|        |           |   49 8d 2c 07          	lea    (%r15,%rax,1),%rbp
+    2263:	|        |     /-----|-- eb 7e                	jmp    22e3 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x3ad>
+    } else {
+        if (ds.an >= 19) {
+    2265:	|        |     |     \-> 48 83 fe 12          	cmp    $0x12,%rsi
+    2269:	|        |     |     /-- 76 0f                	jbe    227a <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x344>
+            w = digits_value(ds.a, 19, n - a);
+    226b:	|        |     |     |   be 13 00 00 00       	mov    $0x13,%esi
+    2270:	|        |     |     |   e8 6a f7 ff ff       	call   19df <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    2275:	|        |     |     |   48 89 c5             	mov    %rax,%rbp
+    2278:	|        |     |  /--|-- eb 41                	jmp    22bb <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x385>
+    227a:	|        |     |  |  \-> 4c 89 44 24 20       	mov    %r8,0x20(%rsp)
+        } else {
+            w = digits_value(ds.a, ds.an, n - a) * pow10_u64[19 - ds.an] +
+    227f:	|        |     |  |      e8 5b f7 ff ff       	call   19df <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+    2284:	|        |     |  |      48 89 e9             	mov    %rbp,%rcx
+                digits_value(ds.b, 19 - ds.an, n - f);
+    2287:	|        |     |  |      4c 8b 44 24 20       	mov    0x20(%rsp),%r8
+    228c:	|        |     |  |      48 8b 14 24          	mov    (%rsp),%rdx
+            w = digits_value(ds.a, ds.an, n - a) * pow10_u64[19 - ds.an] +
+    2290:	|        |     |  |      4c 29 f1             	sub    %r14,%rcx
+    2293:	|        |     |  |      49 89 c4             	mov    %rax,%r12
+    2296:	|        |     |  |      48 8d 05 23 38 00 00 	lea    0x3823(%rip),%rax        # 5ac0 <nel::(anonymous namespace)::pow10_u64>
+                digits_value(ds.b, 19 - ds.an, n - f);
+    229d:	|        |     |  |      48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+            w = digits_value(ds.a, ds.an, n - a) * pow10_u64[19 - ds.an] +
+    22a2:	|        |     |  |      4c 0f af a4 c8 98 00 	imul   0x98(%rax,%rcx,8),%r12
+    22a9:	|        |     |  |      00 00 
+    22ab:	|        |     |  |      48 8d 71 13          	lea    0x13(%rcx),%rsi
+                digits_value(ds.b, 19 - ds.an, n - f);
+    22af:	|        |     |  |      4c 29 c2             	sub    %r8,%rdx
+    22b2:	|        |     |  |      e8 28 f7 ff ff       	call   19df <nel::(anonymous namespace)::digits_value(unsigned char const*, unsigned long, unsigned long)>
+            w = digits_value(ds.a, ds.an, n - a) * pow10_u64[19 - ds.an] +
+    22b7:	|        |     |  |      49 8d 2c 04          	lea    (%r12,%rax,1),%rbp
+        }
+        q += (long long int)(n_sig - 19);
+    22bb:	|        |     |  \----> 48 8b 44 24 18       	mov    0x18(%rsp),%rax
+        for (Index k = 19; k < n_sig; ++k) {
+    22c0:	|        |     |         ba 13 00 00 00       	mov    $0x13,%edx
+            if (ds[k] != '0') {
+    22c5:	|        |     |         48 8d 7c 24 30       	lea    0x30(%rsp),%rdi
+        q += (long long int)(n_sig - 19);
+    22ca:	|        |     |         4d 8d 64 07 ed       	lea    -0x13(%r15,%rax,1),%r12
+            if (ds[k] != '0') {
+    22cf:	|        |     |     /-> 48 89 d6             	mov    %rdx,%rsi
+    22d2:	|        |     |     |   e8 a9 f7 ff ff       	call   1a80 <nel::(anonymous namespace)::Digits::operator[](unsigned long) const>
+    22d7:	|        |     |     |   3c 30                	cmp    $0x30,%al
+    22d9:	|        |     |  /--|-- 75 0d                	jne    22e8 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x3b2>
+        for (Index k = 19; k < n_sig; ++k) {
+    22db:	|        |     |  |  |   48 ff c2             	inc    %rdx
+    22de:	|        |     |  |  |   49 39 d7             	cmp    %rdx,%r15
+    22e1:	|        |     |  |  \-- 75 ec                	jne    22cf <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x399>
+    bool truncated = false;
+    22e3:	|        |     \--|----> 45 31 c9             	xor    %r9d,%r9d
+    22e6:	|        |        |  /-- eb 03                	jmp    22eb <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x3b5>
+                truncated = true;
+    22e8:	|        |        \--|-> 41 b1 01             	mov    $0x1,%r9b
+        }
+    }
+
+#if defined(__FLT_EVAL_METHOD__) && __FLT_EVAL_METHOD__ == 0
+    // both w and 10^|q| exact doubles, so one correctly rounded operation gives the answer.
+    if (!truncated && w <= (1ULL << 53) && q >= -22 && q <= 22) {
+    22eb:	|        |           \-> 45 84 c9             	test   %r9b,%r9b
+    22ee:	|        |     /-------- 75 52                	jne    2342 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x40c>
+    22f0:	|        |     |         b8 01 00 00 00       	mov    $0x1,%eax
+    22f5:	|        |     |         48 c1 e0 35          	shl    $0x35,%rax
+    22f9:	|        |     |         48 39 e8             	cmp    %rbp,%rax
+    22fc:	|        |     +-------- 72 44                	jb     2342 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x40c>
+    22fe:	|        |     |         49 8d 44 24 16       	lea    0x16(%r12),%rax
+    2303:	|        |     |         48 83 f8 2c          	cmp    $0x2c,%rax
+    2307:	|        |     |  /----- 77 26                	ja     232f <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x3f9>
+        double d = double(w);
+        d = (q < 0) ? d / pow10_f64[-q] : d * pow10_f64[q];
+    2309:	|        |     |  |      4d 85 e4             	test   %r12,%r12
+        double d = double(w);
+    230c:	|        |     |  |      f2 48 0f 2a c5       	cvtsi2sd %rbp,%xmm0
+        d = (q < 0) ? d / pow10_f64[-q] : d * pow10_f64[q];
+    2311:	|        |     |  |      48 8d 05 e8 36 00 00 	lea    0x36e8(%rip),%rax        # 5a00 <nel::(anonymous namespace)::pow10_f64>
+    2318:	|        |     |  |  /-- 79 0d                	jns    2327 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x3f1>
+    231a:	|        |     |  |  |   4c 89 e1             	mov    %r12,%rcx
+    231d:	|        |     |  |  |   48 f7 d9             	neg    %rcx
+    2320:	|        |     |  |  |   f2 0f 5e 04 c8       	divsd  (%rax,%rcx,8),%xmm0
+    2325:	|        |  /--|--|--|-- eb 66                	jmp    238d <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x457>
+    2327:	|        |  |  |  |  \-> f2 42 0f 59 04 e0    	mulsd  (%rax,%r12,8),%xmm0
+        return R::Ok(Pair<double, Length>{neg ? -d : d, used});
+    232d:	|        |  +--|--|----- eb 5e                	jmp    238d <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x457>
+    }
+#endif
+
+    Binary const b = compute_float(q, w);
+    232f:	|        |  |  |  \----> 48 89 ee             	mov    %rbp,%rsi
+    2332:	|        |  |  |         4c 89 e7             	mov    %r12,%rdi
+    2335:	|        |  |  |         e8 a1 f9 ff ff       	call   1cdb <nel::(anonymous namespace)::compute_float(long long, unsigned long long)>
+    233a:	|        |  |  |         49 89 c0             	mov    %rax,%r8
+    233d:	|        |  |  |         49 89 d7             	mov    %rdx,%r15
+    // the value is between w and w + 1 (* 10^q), if both round the same that's it.
+    if (truncated && !(b == compute_float(q, w + 1))) {
+    2340:	|        |  |  |  /----- eb 5b                	jmp    239d <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x467>
+    Binary const b = compute_float(q, w);
+    2342:	|        |  |  \--|----> 48 89 ee             	mov    %rbp,%rsi
+    2345:	|        |  |     |      4c 89 e7             	mov    %r12,%rdi
+    2348:	|        |  |     |      44 88 0c 24          	mov    %r9b,(%rsp)
+    234c:	|        |  |     |      e8 8a f9 ff ff       	call   1cdb <nel::(anonymous namespace)::compute_float(long long, unsigned long long)>
+    if (truncated && !(b == compute_float(q, w + 1))) {
+    2351:	|        |  |     |      44 8a 0c 24          	mov    (%rsp),%r9b
+    Binary const b = compute_float(q, w);
+    2355:	|        |  |     |      49 89 c0             	mov    %rax,%r8
+    2358:	|        |  |     |      49 89 d7             	mov    %rdx,%r15
+    if (truncated && !(b == compute_float(q, w + 1))) {
+    235b:	|        |  |     |      45 84 c9             	test   %r9b,%r9b
+    235e:	|        |  |     +----- 74 3d                	je     239d <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x467>
+    2360:	|        |  |     |      48 8d 75 01          	lea    0x1(%rbp),%rsi
+    2364:	|        |  |     |      4c 89 e7             	mov    %r12,%rdi
+    2367:	|        |  |     |      48 89 04 24          	mov    %rax,(%rsp)
+    236b:	|        |  |     |      e8 6b f9 ff ff       	call   1cdb <nel::(anonymous namespace)::compute_float(long long, unsigned long long)>
+            return mantissa == o.mantissa && power2 == o.power2;
+    2370:	|        |  |     |      4c 8b 04 24          	mov    (%rsp),%r8
+    2374:	|        |  |     |      49 39 c0             	cmp    %rax,%r8
+    2377:	|        |  |     |  /-- 75 05                	jne    237e <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x448>
+    2379:	|        |  |     |  |   41 39 d7             	cmp    %edx,%r15d
+    237c:	|        |  |     +--|-- 74 1f                	je     239d <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x467>
+        double const d = slow_path(ds, e - (long long int)(frac_e - frac_b));
+    237e:	|        |  |     |  \-> 48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    2383:	|        |  |     |      48 8d 7c 24 30       	lea    0x30(%rsp),%rdi
+    2388:	|        |  |     |      e8 67 f8 ff ff       	call   1bf4 <nel::(anonymous namespace)::slow_path(nel::(anonymous namespace)::Digits const&, long long)>
+        return R::Ok(Pair<double, Length>{neg ? -d : d, used});
+    238d:	|        |  \-----|----> 80 7c 24 0f 2d       	cmpb   $0x2d,0xf(%rsp)
+    2392:	|        +--------|----- 75 30                	jne    23c4 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x48e>
+    2394:	|        |        |      0f 57 05 e5 37 00 00 	xorps  0x37e5(%rip),%xmm0        # 5b80 <nel::(anonymous namespace)::pow10_u64+0xc0>
+    239b:	|        +--------|----- eb 27                	jmp    23c4 <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x48e>
+    Word const bits = b.mantissa | (Word(b.power2) << mantissa_bits) | (Word(neg) << 63);
+    239d:	|        |        \----> 4c 89 f8             	mov    %r15,%rax
+    bool const neg = p[0] == '-';
+    23a0:	|        |               31 d2                	xor    %edx,%edx
+            : tag_(Tag::OK)
+    23a2:	|        |               c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+    Word const bits = b.mantissa | (Word(b.power2) << mantissa_bits) | (Word(neg) << 63);
+    23a8:	|        |               48 c1 e0 34          	shl    $0x34,%rax
+    23ac:	|        |               4c 09 c0             	or     %r8,%rax
+    bool const neg = p[0] == '-';
+    23af:	|        |               80 7c 24 0f 2d       	cmpb   $0x2d,0xf(%rsp)
+    23b4:	|        |               0f 94 c2             	sete   %dl
+    Word const bits = b.mantissa | (Word(b.power2) << mantissa_bits) | (Word(neg) << 63);
+    23b7:	|        |               48 c1 e2 3f          	shl    $0x3f,%rdx
+    23bb:	|        |               48 09 d0             	or     %rdx,%rax
+    23be:	|        |               48 89 43 08          	mov    %rax,0x8(%rbx)
+    23c2:	|        |           /-- eb 0b                	jmp    23cf <nel::parse_f64(nel::Slice<unsigned char const> const&)+0x499>
+    23c4:	|        \-----------|-> c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+    23ca:	|                    |   f2 0f 11 43 08       	movsd  %xmm0,0x8(%rbx)
+    23cf:	|                    \-> 4c 89 6b 10          	mov    %r13,0x10(%rbx)
+    }
+    return R::Ok(Pair<double, Length>{to_double(b, neg), used});
+}
+    23d3:	\----------------------> 48 83 c4 58          	add    $0x58,%rsp
+    23d7:	                         48 89 d8             	mov    %rbx,%rax
+    23da:	                         5b                   	pop    %rbx
+    23db:	                         5d                   	pop    %rbp
+    23dc:	                         41 5c                	pop    %r12
+    23de:	                         41 5d                	pop    %r13
+    23e0:	                         41 5e                	pop    %r14
+    23e2:	                         41 5f                	pop    %r15
+    23e4:	                         c3                   	ret
+
+Disassembly of section .fini:
+
+00000000000023e8 <_fini>:
+    23e8:	48 83 ec 08          	sub    $0x8,%rsp
+    23ec:	48 83 c4 08          	add    $0x8,%rsp
+    23f0:	c3                   	ret
@@ -0,0 +1,1970 @@
+
+target/minsize/examples/bench_poison:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 cd 2f 00 00 	mov    0x2fcd(%rip),%rax        # 3fd8 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <memcmp@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <memcmp@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <memcmp@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <clock_gettime@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <clock_gettime@GLIBC_2.17>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <operator new(unsigned long)@plt>:
+    1060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 4018 <operator new(unsigned long)@GLIBCXX_3.4>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <operator delete(void*, unsigned long)@plt>:
+    1070:	ff 25 aa 2f 00 00    	jmp    *0x2faa(%rip)        # 4020 <operator delete(void*, unsigned long)@CXXABI_1.3.9>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fputs@plt>:
+    1080:	ff 25 a2 2f 00 00    	jmp    *0x2fa2(%rip)        # 4028 <fputs@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <free@plt>:
+    1090:	ff 25 9a 2f 00 00    	jmp    *0x2f9a(%rip)        # 4030 <free@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <fputc@plt>:
+    10a0:	ff 25 92 2f 00 00    	jmp    *0x2f92(%rip)        # 4038 <fputc@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <malloc@plt>:
+    10b0:	ff 25 8a 2f 00 00    	jmp    *0x2f8a(%rip)        # 4040 <malloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <fprintf@plt>:
+    10c0:	ff 25 82 2f 00 00    	jmp    *0x2f82(%rip)        # 4048 <fprintf@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <memmove@plt>:
+    10d0:	ff 25 7a 2f 00 00    	jmp    *0x2f7a(%rip)        # 4050 <memmove@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010e0 <realloc@plt>:
+    10e0:	ff 25 72 2f 00 00    	jmp    *0x2f72(%rip)        # 4058 <realloc@GLIBC_2.2.5>
+    10e6:	68 0b 00 00 00       	push   $0xb
+    10eb:	e9 30 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010f0 <__cxa_finalize@plt>:
+    10f0:	ff 25 ca 2e 00 00    	jmp    *0x2eca(%rip)        # 3fc0 <__cxa_finalize@GLIBC_2.2.5>
+    10f6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+0000000000001100 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    1100:	50                   	push   %rax
+    std::abort();
+    1101:	e8 3a ff ff ff       	call   1040 <abort@plt>
+
+0000000000001106 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    1106:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    1107:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    110a:	4c 8d 0d 23 10 00 00 	lea    0x1023(%rip),%r9        # 2134 <_IO_stdin_used+0x134>
+    1111:	31 c0                	xor    %eax,%eax
+    1113:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    1117:	4c 8b 07             	mov    (%rdi),%r8
+    111a:	48 8d 35 19 10 00 00 	lea    0x1019(%rip),%rsi        # 213a <_IO_stdin_used+0x13a>
+    1121:	48 8b 3d 58 2f 00 00 	mov    0x2f58(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+    1128:	e8 93 ff ff ff       	call   10c0 <fprintf@plt>
+    std::abort();
+    112d:	e8 0e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001132 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1132:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1136:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1139:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    113d:	31 c0                	xor    %eax,%eax
+    113f:	57                   	push   %rdi
+    1140:	48 8b 3d 39 2f 00 00 	mov    0x2f39(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+    1147:	4c 8d 0d e6 0f 00 00 	lea    0xfe6(%rip),%r9        # 2134 <_IO_stdin_used+0x134>
+    114e:	4c 8b 06             	mov    (%rsi),%r8
+    1151:	48 8d 35 f3 0f 00 00 	lea    0xff3(%rip),%rsi        # 214b <_IO_stdin_used+0x14b>
+    1158:	e8 63 ff ff ff       	call   10c0 <fprintf@plt>
+    std::abort();
+    115d:	e8 de fe ff ff       	call   1040 <abort@plt>
+
+0000000000001162 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1162:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1166:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1169:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    116d:	31 c0                	xor    %eax,%eax
+    116f:	57                   	push   %rdi
+    1170:	48 8b 3d 09 2f 00 00 	mov    0x2f09(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+    1177:	4c 8d 0d e2 0f 00 00 	lea    0xfe2(%rip),%r9        # 2160 <_IO_stdin_used+0x160>
+    117e:	4c 8b 06             	mov    (%rsi),%r8
+    1181:	48 8d 35 c3 0f 00 00 	lea    0xfc3(%rip),%rsi        # 214b <_IO_stdin_used+0x14b>
+    1188:	e8 33 ff ff ff       	call   10c0 <fprintf@plt>
+    std::abort();
+    118d:	e8 ae fe ff ff       	call   1040 <abort@plt>
+
+0000000000001192 <main>:
+    });
+    bench::report(name, t);
+}
+
+int main()
+{
+    1192:	53                   	push   %rbx
+    bench_moves();
+    1193:	e8 8e 01 00 00       	call   1326 <bench_moves()>
+
+// Time a run of f(), in ns.
+template<typename F>
+long unsigned int time_ns(F &&f)
+{
+    long unsigned int const b = now_ns();
+    1198:	e8 0f 06 00 00       	call   17ac <bench::now_ns()>
+    119d:	48 89 c3             	mov    %rax,%rbx
+    f();
+    11a0:	e8 53 03 00 00       	call   14f8 <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]>
+    return now_ns() - b;
+    11a5:	e8 02 06 00 00       	call   17ac <bench::now_ns()>
+    bench::report(name, t);
+    11aa:	31 d2                	xor    %edx,%edx
+    11ac:	48 8d 3d da 0e 00 00 	lea    0xeda(%rip),%rdi        # 208d <_IO_stdin_used+0x8d>
+    11b3:	48 29 d8             	sub    %rbx,%rax
+    11b6:	48 89 c6             	mov    %rax,%rsi
+    11b9:	e8 11 06 00 00       	call   17cf <bench::report(char const*, unsigned long, unsigned long)>
+    long unsigned int const b = now_ns();
+    11be:	e8 e9 05 00 00       	call   17ac <bench::now_ns()>
+    11c3:	48 89 c3             	mov    %rax,%rbx
+    f();
+    11c6:	e8 87 04 00 00       	call   1652 <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]>
+    return now_ns() - b;
+    11cb:	e8 dc 05 00 00       	call   17ac <bench::now_ns()>
+    11d0:	31 d2                	xor    %edx,%edx
+    11d2:	48 8d 3d cc 0e 00 00 	lea    0xecc(%rip),%rdi        # 20a5 <_IO_stdin_used+0xa5>
+    11d9:	48 29 d8             	sub    %rbx,%rax
+    11dc:	48 89 c6             	mov    %rax,%rsi
+    11df:	e8 eb 05 00 00       	call   17cf <bench::report(char const*, unsigned long, unsigned long)>
+    bench_growth<nel::heaped::Poisoned<true>>("vector growth, poisoned");
+    bench_growth<nel::heaped::Poisoned<false>>("vector growth, not poisoned");
+}
+    11e4:	31 c0                	xor    %eax,%eax
+    11e6:	5b                   	pop    %rbx
+    11e7:	c3                   	ret
+    11e8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    11ef:	00 
+
+00000000000011f0 <_start>:
+    11f0:	31 ed                	xor    %ebp,%ebp
+    11f2:	49 89 d1             	mov    %rdx,%r9
+    11f5:	5e                   	pop    %rsi
+    11f6:	48 89 e2             	mov    %rsp,%rdx
+    11f9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    11fd:	50                   	push   %rax
+    11fe:	54                   	push   %rsp
+    11ff:	45 31 c0             	xor    %r8d,%r8d
+    1202:	31 c9                	xor    %ecx,%ecx
+    1204:	48 8d 3d 87 ff ff ff 	lea    -0x79(%rip),%rdi        # 1192 <main>
+    120b:	ff 15 b7 2d 00 00    	call   *0x2db7(%rip)        # 3fc8 <__libc_start_main@GLIBC_2.34>
+    1211:	f4                   	hlt
+    1212:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1219:	00 00 00 
+    121c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001220 <deregister_tm_clones>:
+    1220:	    48 8d 3d 49 2e 00 00 	lea    0x2e49(%rip),%rdi        # 4070 <__TMC_END__>
+    1227:	    48 8d 05 42 2e 00 00 	lea    0x2e42(%rip),%rax        # 4070 <__TMC_END__>
+    122e:	    48 39 f8             	cmp    %rdi,%rax
+    1231:	/-- 74 15                	je     1248 <deregister_tm_clones+0x28>
+    1233:	|   48 8b 05 96 2d 00 00 	mov    0x2d96(%rip),%rax        # 3fd0 <_ITM_deregisterTMCloneTable@Base>
+    123a:	|   48 85 c0             	test   %rax,%rax
+    123d:	+-- 74 09                	je     1248 <deregister_tm_clones+0x28>
+    123f:	|   ff e0                	jmp    *%rax
+    1241:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1248:	\-> c3                   	ret
+    1249:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001250 <register_tm_clones>:
+    1250:	    48 8d 3d 19 2e 00 00 	lea    0x2e19(%rip),%rdi        # 4070 <__TMC_END__>
+    1257:	    48 8d 35 12 2e 00 00 	lea    0x2e12(%rip),%rsi        # 4070 <__TMC_END__>
+    125e:	    48 29 fe             	sub    %rdi,%rsi
+    1261:	    48 89 f0             	mov    %rsi,%rax
+    1264:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1268:	    48 c1 f8 03          	sar    $0x3,%rax
+    126c:	    48 01 c6             	add    %rax,%rsi
+    126f:	    48 d1 fe             	sar    %rsi
+    1272:	/-- 74 14                	je     1288 <register_tm_clones+0x38>
+    1274:	|   48 8b 05 65 2d 00 00 	mov    0x2d65(%rip),%rax        # 3fe0 <_ITM_registerTMCloneTable@Base>
+    127b:	|   48 85 c0             	test   %rax,%rax
+    127e:	+-- 74 08                	je     1288 <register_tm_clones+0x38>
+    1280:	|   ff e0                	jmp    *%rax
+    1282:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1288:	\-> c3                   	ret
+    1289:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001290 <__do_global_dtors_aux>:
+    1290:	       f3 0f 1e fa          	endbr64
+    1294:	       80 3d ed 2d 00 00 00 	cmpb   $0x0,0x2ded(%rip)        # 4088 <completed.0>
+    129b:	/----- 75 2b                	jne    12c8 <__do_global_dtors_aux+0x38>
+    129d:	|      55                   	push   %rbp
+    129e:	|      48 83 3d 1a 2d 00 00 	cmpq   $0x0,0x2d1a(%rip)        # 3fc0 <__cxa_finalize@GLIBC_2.2.5>
+    12a5:	|      00 
+    12a6:	|      48 89 e5             	mov    %rsp,%rbp
+    12a9:	|  /-- 74 0c                	je     12b7 <__do_global_dtors_aux+0x27>
+    12ab:	|  |   48 8b 3d b6 2d 00 00 	mov    0x2db6(%rip),%rdi        # 4068 <__dso_handle>
+    12b2:	|  |   e8 39 fe ff ff       	call   10f0 <__cxa_finalize@plt>
+    12b7:	|  \-> e8 64 ff ff ff       	call   1220 <deregister_tm_clones>
+    12bc:	|      c6 05 c5 2d 00 00 01 	movb   $0x1,0x2dc5(%rip)        # 4088 <completed.0>
+    12c3:	|      5d                   	pop    %rbp
+    12c4:	|      c3                   	ret
+    12c5:	|      0f 1f 00             	nopl   (%rax)
+    12c8:	\----> c3                   	ret
+    12c9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000012d0 <frame_dummy>:
+    12d0:	f3 0f 1e fa          	endbr64
+    12d4:	e9 77 ff ff ff       	jmp    1250 <register_tm_clones>
+    12d9:	90                   	nop
+
+00000000000012da <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const [clone .isra.0]>:
+    12da:	          83 ff 01             	cmp    $0x1,%edi
+    12dd:	/-------- 74 24                	je     1303 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const [clone .isra.0]+0x29>
+    12df:	|         b0 01                	mov    $0x1,%al
+    12e1:	|         83 ff 02             	cmp    $0x2,%edi
+    12e4:	|  /----- 74 1f                	je     1305 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const [clone .isra.0]+0x2b>
+    12e6:	|  |      50                   	push   %rax
+    12e7:	|  |      85 ff                	test   %edi,%edi
+    12e9:	|  |  /-- 75 0c                	jne    12f7 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const [clone .isra.0]+0x1d>
+    12eb:	|  |  |   48 8d 3d 12 0d 00 00 	lea    0xd12(%rip),%rdi        # 2004 <_IO_stdin_used+0x4>
+    12f2:	|  |  |   e8 3b fe ff ff       	call   1132 <nel::panic(char const*, nel::Context const&)>
+    12f7:	|  |  \-> 48 8d 3d 15 0d 00 00 	lea    0xd15(%rip),%rdi        # 2013 <_IO_stdin_used+0x13>
+    12fe:	|  |      e8 2f fe ff ff       	call   1132 <nel::panic(char const*, nel::Context const&)>
+    1303:	\--|----> 31 c0                	xor    %eax,%eax
+    1305:	   \----> c3                   	ret
+
+0000000000001306 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    1306:	83 c8 ff             	or     $0xffffffff,%eax
+    1309:	c3                   	ret
+
+000000000000130a <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    130a:	83 c8 ff             	or     $0xffffffff,%eax
+    130d:	c3                   	ret
+
+000000000000130e <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    130e:	83 c8 ff             	or     $0xffffffff,%eax
+    1311:	c3                   	ret
+
+0000000000001312 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    1312:	83 c8 ff             	or     $0xffffffff,%eax
+    1315:	c3                   	ret
+
+0000000000001316 <_read_r>:
+int _read_r(struct _reent *, int) {
+    1316:	83 c8 ff             	or     $0xffffffff,%eax
+    1319:	c3                   	ret
+
+000000000000131a <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    131a:	83 c8 ff             	or     $0xffffffff,%eax
+    131d:	c3                   	ret
+
+000000000000131e <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    131e:	83 c8 ff             	or     $0xffffffff,%eax
+    1321:	c3                   	ret
+
+0000000000001322 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1322:	83 c8 ff             	or     $0xffffffff,%eax
+    1325:	c3                   	ret
+
+0000000000001326 <bench_moves()>:
+{
+    1326:	    41 55                	push   %r13
+    long unsigned int const b = now_ns();
+    1328:	    41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    132e:	    41 54                	push   %r12
+    1330:	    55                   	push   %rbp
+    1331:	    53                   	push   %rbx
+            nel::elem::copy(buf2, buf1, buf_size);
+    1332:	    48 8d 1d 67 2d 01 00 	lea    0x12d67(%rip),%rbx        # 140a0 <buf1>
+{
+    1339:	    52                   	push   %rdx
+    133a:	    e8 6d 04 00 00       	call   17ac <bench::now_ns()>
+    133f:	    49 89 c4             	mov    %rax,%r12
+            nel::elem::copy(buf2, buf1, buf_size);
+    1342:	/-> 48 8d 2d 57 2d 00 00 	lea    0x2d57(%rip),%rbp        # 40a0 <buf2>
+    1349:	|   ba 00 00 01 00       	mov    $0x10000,%edx
+    134e:	|   48 89 de             	mov    %rbx,%rsi
+    1351:	|   48 89 ef             	mov    %rbp,%rdi
+    1354:	|   e8 2a 09 00 00       	call   1c83 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+            nel::elem::wipe(buf1, buf_size);
+    1359:	|   be 00 00 01 00       	mov    $0x10000,%esi
+    135e:	|   48 89 df             	mov    %rbx,%rdi
+    1361:	|   e8 36 09 00 00       	call   1c9c <nel::elem::wipe(unsigned char*, unsigned long)>
+            nel::elem::copy(buf1, buf2, buf_size);
+    1366:	|   48 89 ee             	mov    %rbp,%rsi
+    1369:	|   48 89 df             	mov    %rbx,%rdi
+    136c:	|   ba 00 00 01 00       	mov    $0x10000,%edx
+    1371:	|   e8 0d 09 00 00       	call   1c83 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+            nel::elem::wipe(buf2, buf_size);
+    1376:	|   be 00 00 01 00       	mov    $0x10000,%esi
+    137b:	|   48 89 ef             	mov    %rbp,%rdi
+    137e:	|   e8 19 09 00 00       	call   1c9c <nel::elem::wipe(unsigned char*, unsigned long)>
+        for (Index i = 0; i < n_moves; ++i) {
+    1383:	|   49 ff cd             	dec    %r13
+    1386:	\-- 75 ba                	jne    1342 <bench_moves()+0x1c>
+    return now_ns() - b;
+    1388:	    e8 1f 04 00 00       	call   17ac <bench::now_ns()>
+    bench::report("move, poisoned", t1, bytes);
+    138d:	    ba 00 00 00 20       	mov    $0x20000000,%edx
+    1392:	    48 8d 3d 85 0c 00 00 	lea    0xc85(%rip),%rdi        # 201e <_IO_stdin_used+0x1e>
+    long unsigned int const b = now_ns();
+    1399:	    41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    return now_ns() - b;
+    139f:	    4c 29 e0             	sub    %r12,%rax
+    13a2:	    48 89 c6             	mov    %rax,%rsi
+    13a5:	    e8 25 04 00 00       	call   17cf <bench::report(char const*, unsigned long, unsigned long)>
+    long unsigned int const b = now_ns();
+    13aa:	    e8 fd 03 00 00       	call   17ac <bench::now_ns()>
+    13af:	    49 89 c4             	mov    %rax,%r12
+            nel::elem::copy(buf2, buf1, buf_size);
+    13b2:	/-> ba 00 00 01 00       	mov    $0x10000,%edx
+    13b7:	|   48 89 de             	mov    %rbx,%rsi
+    13ba:	|   48 89 ef             	mov    %rbp,%rdi
+    13bd:	|   e8 c1 08 00 00       	call   1c83 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+            nel::elem::copy(buf1, buf2, buf_size);
+    13c2:	|   ba 00 00 01 00       	mov    $0x10000,%edx
+    13c7:	|   48 89 ee             	mov    %rbp,%rsi
+    13ca:	|   48 89 df             	mov    %rbx,%rdi
+    13cd:	|   e8 b1 08 00 00       	call   1c83 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        for (Index i = 0; i < n_moves; ++i) {
+    13d2:	|   49 ff cd             	dec    %r13
+    13d5:	\-- 75 db                	jne    13b2 <bench_moves()+0x8c>
+    return now_ns() - b;
+    13d7:	    e8 d0 03 00 00       	call   17ac <bench::now_ns()>
+    bench::report("move, not poisoned", t2, bytes);
+    13dc:	    ba 00 00 00 20       	mov    $0x20000000,%edx
+    13e1:	    48 8d 3d 45 0c 00 00 	lea    0xc45(%rip),%rdi        # 202d <_IO_stdin_used+0x2d>
+    long unsigned int const b = now_ns();
+    13e8:	    41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    return now_ns() - b;
+    13ee:	    4c 29 e0             	sub    %r12,%rax
+    13f1:	    48 89 c6             	mov    %rax,%rsi
+    13f4:	    e8 d6 03 00 00       	call   17cf <bench::report(char const*, unsigned long, unsigned long)>
+    U8Buf<buf_size> *a = new U8Buf<buf_size>((uint8_t)0x12);
+    13f9:	    bf 00 00 01 00       	mov    $0x10000,%edi
+    13fe:	    e8 5d fc ff ff       	call   1060 <operator new(unsigned long)@plt>
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+        {
+            nel::elem::set(data_, f, N);
+    1403:	    ba 00 00 01 00       	mov    $0x10000,%edx
+    1408:	    be 12 00 00 00       	mov    $0x12,%esi
+    140d:	    48 89 c7             	mov    %rax,%rdi
+    1410:	    48 89 c5             	mov    %rax,%rbp
+    1413:	    e8 71 08 00 00       	call   1c89 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    U8Buf<buf_size> *b = new U8Buf<buf_size>((uint8_t)0x34);
+    1418:	    bf 00 00 01 00       	mov    $0x10000,%edi
+    141d:	    e8 3e fc ff ff       	call   1060 <operator new(unsigned long)@plt>
+    1422:	    ba 00 00 01 00       	mov    $0x10000,%edx
+    1427:	    be 34 00 00 00       	mov    $0x34,%esi
+    142c:	    48 89 c7             	mov    %rax,%rdi
+    142f:	    48 89 c3             	mov    %rax,%rbx
+    1432:	    e8 52 08 00 00       	call   1c89 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    long unsigned int const b = now_ns();
+    1437:	    e8 70 03 00 00       	call   17ac <bench::now_ns()>
+    143c:	    49 89 c4             	mov    %rax,%r12
+            nel::elem::move(data_, o.data_, N);
+    143f:	/-> ba 00 00 01 00       	mov    $0x10000,%edx
+    1444:	|   48 89 ee             	mov    %rbp,%rsi
+    1447:	|   48 89 df             	mov    %rbx,%rdi
+    144a:	|   e8 42 08 00 00       	call   1c91 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    144f:	|   ba 00 00 01 00       	mov    $0x10000,%edx
+    1454:	|   48 89 de             	mov    %rbx,%rsi
+    1457:	|   48 89 ef             	mov    %rbp,%rdi
+    145a:	|   e8 32 08 00 00       	call   1c91 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+        for (Index i = 0; i < n_moves; ++i) {
+    145f:	|   49 ff cd             	dec    %r13
+    1462:	\-- 75 db                	jne    143f <bench_moves()+0x119>
+    return now_ns() - b;
+    1464:	    e8 43 03 00 00       	call   17ac <bench::now_ns()>
+    bench::report(nel::elem::poisoning ? "U8Buf move, build default (poisoned)"
+    1469:	    ba 00 00 00 20       	mov    $0x20000000,%edx
+    146e:	    48 8d 3d cb 0b 00 00 	lea    0xbcb(%rip),%rdi        # 2040 <_IO_stdin_used+0x40>
+    1475:	    4c 29 e0             	sub    %r12,%rax
+    1478:	    48 89 c6             	mov    %rax,%rsi
+    147b:	    e8 4f 03 00 00       	call   17cf <bench::report(char const*, unsigned long, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1480:	    ba 00 00 01 00       	mov    $0x10000,%edx
+    1485:	    48 89 ef             	mov    %rbp,%rdi
+    1488:	    be a5 00 00 00       	mov    $0xa5,%esi
+    148d:	    e8 f7 07 00 00       	call   1c89 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    delete a;
+    1492:	    48 89 ef             	mov    %rbp,%rdi
+    1495:	    be 00 00 01 00       	mov    $0x10000,%esi
+    149a:	    e8 d1 fb ff ff       	call   1070 <operator delete(void*, unsigned long)@plt>
+    149f:	    48 89 df             	mov    %rbx,%rdi
+    14a2:	    be a5 00 00 00       	mov    $0xa5,%esi
+    14a7:	    ba 00 00 01 00       	mov    $0x10000,%edx
+    14ac:	    e8 d8 07 00 00       	call   1c89 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    14b1:	    58                   	pop    %rax
+    delete b;
+    14b2:	    48 89 df             	mov    %rbx,%rdi
+    14b5:	    be 00 00 01 00       	mov    $0x10000,%esi
+}
+    14ba:	    5b                   	pop    %rbx
+    14bb:	    5d                   	pop    %rbp
+    14bc:	    41 5c                	pop    %r12
+    14be:	    41 5d                	pop    %r13
+    delete b;
+    14c0:	    e9 ab fb ff ff       	jmp    1070 <operator delete(void*, unsigned long)@plt>
+
+00000000000014c5 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*) [clone .part.0]>:
+#    endif
+        // Meh, cannot use new/delete.
+        // Make own using the allocator's malloc/free.
+        // But, can use realloc for better growing..
+        // Alignment is handled by the allocator, alignof(Node) includes values_align.
+        static void free(Node *old)
+    14c5:	       41 54                	push   %r12
+    14c7:	       4c 8d 67 10          	lea    0x10(%rdi),%r12
+    14cb:	       55                   	push   %rbp
+#    endif
+
+    public:
+        constexpr ~Node(void)
+        {
+            for (Index i = 0; i < len(); ++i) {
+    14cc:	       31 ed                	xor    %ebp,%ebp
+        static void free(Node *old)
+    14ce:	       53                   	push   %rbx
+    14cf:	       48 89 fb             	mov    %rdi,%rbx
+            for (Index i = 0; i < len(); ++i) {
+    14d2:	/----> 48 3b 6b 08          	cmp    0x8(%rbx),%rbp
+    14d6:	|  /-- 73 14                	jae    14ec <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*) [clone .part.0]+0x27>
+                values_[i].~Type();
+    14d8:	|  |   4c 89 e7             	mov    %r12,%rdi
+            for (Index i = 0; i < len(); ++i) {
+    14db:	|  |   48 ff c5             	inc    %rbp
+    14de:	|  |   49 81 c4 00 01 00 00 	add    $0x100,%r12
+                values_[i].~Type();
+    14e5:	|  |   e8 c4 03 00 00       	call   18ae <U8Buf<256ul>::~U8Buf()>
+            for (Index i = 0; i < len(); ++i) {
+    14ea:	\--|-- eb e6                	jmp    14d2 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*) [clone .part.0]+0xd>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    14ec:	   \-> 48 89 df             	mov    %rbx,%rdi
+        }
+    14ef:	       5b                   	pop    %rbx
+    14f0:	       5d                   	pop    %rbp
+    14f1:	       41 5c                	pop    %r12
+    14f3:	       e9 98 fb ff ff       	jmp    1090 <free@plt>
+
+00000000000014f8 <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]>:
+    auto t = bench::time_ns([]() {
+    14f8:	                   41 56                	push   %r14
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    14fa:	                   4c 8d 35 68 0b 00 00 	lea    0xb68(%rip),%r14        # 2069 <_IO_stdin_used+0x69>
+    1501:	                   41 55                	push   %r13
+    1503:	                   41 54                	push   %r12
+    1505:	                   41 bc 64 00 00 00    	mov    $0x64,%r12d
+    150b:	                   55                   	push   %rbp
+    150c:	                   53                   	push   %rbx
+    150d:	                   48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+        }
+
+        // default ctor is ok since it cannot throw.
+        // TODO: but is it 'correct'? i.e. must arrays be created initialised?
+        constexpr Vector(void)
+            : item_(nullptr)
+    1514:	/----------------> 31 db                	xor    %ebx,%ebx
+            for (Index i = 0; i < n; ++i) {
+    1516:	|                  31 ed                	xor    %ebp,%ebp
+         *
+         * @returns the current in use count.
+         */
+        constexpr Length len(void) const
+        {
+            return (item_ == nullptr) ? 0 : item_->len();
+    1518:	|  /-------------> 48 85 db             	test   %rbx,%rbx
+    151b:	|  |               44 0f b6 ed          	movzbl %bpl,%r13d
+    151f:	|  |           /-- 74 12                	je     1533 <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x3b>
+            return alloc_;
+        }
+
+        constexpr Length len(void) const
+        {
+            return len_;
+    1521:	|  |           |   48 8b 73 08          	mov    0x8(%rbx),%rsi
+            return alloc_;
+    1525:	|  |           |   48 8b 13             	mov    (%rbx),%rdx
+
+    private:
+        // Make room for n more values, only ever grows.
+        bool try_reserve_for(Count const n)
+        {
+            if (len() + n <= capacity()) { return true; }
+    1528:	|  |           |   48 8d 46 01          	lea    0x1(%rsi),%rax
+    152c:	|  |           |   48 39 c2             	cmp    %rax,%rdx
+    152f:	|  |  /--------|-- 73 60                	jae    1591 <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x99>
+    1531:	|  |  |     /--|-- eb 1c                	jmp    154f <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x57>
+            Node *new_n = realloc(nullptr, capacity);
+    1533:	|  |  |     |  \-> be 04 00 00 00       	mov    $0x4,%esi
+    1538:	|  |  |     |      31 ff                	xor    %edi,%edi
+    153a:	|  |  |     |      e8 ac 04 00 00       	call   19eb <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)>
+    153f:	|  |  |     |      48 89 c3             	mov    %rax,%rbx
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    1542:	|  |  |     |      48 85 c0             	test   %rax,%rax
+    1545:	|  |  |  /--|----- 74 53                	je     159a <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0xa2>
+    1547:	|  |  |  |  |      31 c0                	xor    %eax,%eax
+    1549:	|  |  |  |  |      48 89 43 08          	mov    %rax,0x8(%rbx)
+    154d:	|  |  +--|--|----- eb 42                	jmp    1591 <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x99>
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            if (cap <= cur) { return cap; }
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    154f:	|  |  |  |  \----> 48 83 fa 03          	cmp    $0x3,%rdx
+    1553:	|  |  |  |     /-- 77 15                	ja     156a <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x72>
+    1555:	|  |  |  |     |   ba 04 00 00 00       	mov    $0x4,%edx
+    155a:	|  |  |  |     |   48 39 d0             	cmp    %rdx,%rax
+    155d:	|  |  |  |     |   48 0f 42 c2          	cmovb  %rdx,%rax
+    1561:	|  |  |  |     |   48 39 f0             	cmp    %rsi,%rax
+    1564:	|  |  |  |     |   48 0f 43 f0          	cmovae %rax,%rsi
+    1568:	|  |  |  |  /--|-- eb 17                	jmp    1581 <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x89>
+    156a:	|  |  |  |  |  \-> 48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+    156e:	|  |  |  |  |      48 39 c1             	cmp    %rax,%rcx
+    1571:	|  |  |  |  |      48 0f 43 c1          	cmovae %rcx,%rax
+    1575:	|  |  |  |  |      48 39 f0             	cmp    %rsi,%rax
+    1578:	|  |  |  |  |      48 0f 43 f0          	cmovae %rax,%rsi
+            } else if (new_cap == item_->capacity()) {
+    157c:	|  |  |  |  |      48 39 d6             	cmp    %rdx,%rsi
+    157f:	|  |  +--|--|----- 74 10                	je     1591 <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x99>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    1581:	|  |  |  |  \----> 48 89 df             	mov    %rbx,%rdi
+    1584:	|  |  |  |         e8 62 04 00 00       	call   19eb <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)>
+                if (p == nullptr) { return false; }
+    1589:	|  |  |  |         48 85 c0             	test   %rax,%rax
+    158c:	|  |  |  +-------- 74 0c                	je     159a <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0xa2>
+                item_ = p;
+    158e:	|  |  |  |         48 89 c3             	mov    %rax,%rbx
+            return len_;
+    1591:	|  |  \--|-------> 48 8b 43 08          	mov    0x8(%rbx),%rax
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+        {
+            if (len() >= capacity()) {
+    1595:	|  |     |         48 3b 03             	cmp    (%rbx),%rax
+    1598:	|  |     |     /-- 72 17                	jb     15b1 <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0xb9>
+        {
+        }
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+            : value_(forward<Args>(args)...)
+    159a:	|  |     \-----|-> 48 8d 7c 24 20       	lea    0x20(%rsp),%rdi
+    159f:	|  |           |   44 89 ee             	mov    %r13d,%esi
+        {
+        }
+
+        template<typename... Args>
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+            : tag_(Tag::ERR)
+    15a2:	|  |           |   c7 44 24 1c 02 00 00 	movl   $0x2,0x1c(%rsp)
+    15a9:	|  |           |   00 
+    15aa:	|  |           |   e8 5f 03 00 00       	call   190e <U8Buf<256ul>::U8Buf(unsigned char)>
+        {
+        }
+    15af:	|  |        /--|-- eb 1d                	jmp    15ce <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0xd6>
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    15b1:	|  |        |  \-> 48 c1 e0 08          	shl    $0x8,%rax
+    15b5:	|  |        |      44 89 ee             	mov    %r13d,%esi
+    15b8:	|  |        |      48 8d 7c 03 10       	lea    0x10(%rbx,%rax,1),%rdi
+    15bd:	|  |        |      e8 4c 03 00 00       	call   190e <U8Buf<256ul>::U8Buf(unsigned char)>
+            len_ += 1;
+    15c2:	|  |        |      48 ff 43 08          	incq   0x8(%rbx)
+            : tag_(Tag::OK)
+    15c6:	|  |        |      c7 44 24 1c 01 00 00 	movl   $0x1,0x1c(%rsp)
+    15cd:	|  |        |      00 
+            , file_name_(file_name)
+    15ce:	|  |        \----> 48 8d 05 9f 0a 00 00 	lea    0xa9f(%rip),%rax        # 2074 <_IO_stdin_used+0x74>
+            : fn_name_(fn_name)
+    15d5:	|  |               4c 89 34 24          	mov    %r14,(%rsp)
+            , file_name_(file_name)
+    15d9:	|  |               48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    15de:	|  |               8b 44 24 1c          	mov    0x1c(%rsp),%eax
+            , line_num_(line_num)
+    15e2:	|  |               c7 44 24 10 47 00 00 	movl   $0x47,0x10(%rsp)
+    15e9:	|  |               00 
+        // match(Tag tag, std::function<V(void)> on_ok, std::function<V(void)> on_err) const
+        //
+        template<typename V, typename Fn1, typename Fn2>
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+        {
+            switch (tag_) { // result<void>-match
+    15ea:	|  |               85 c0                	test   %eax,%eax
+    15ec:	|  |           /-- 74 23                	je     1611 <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x119>
+    15ee:	|  |           |   ff c8                	dec    %eax
+    15f0:	|  |           |   83 f8 01             	cmp    $0x1,%eax
+    15f3:	|  |     /-----|-- 77 28                	ja     161d <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x125>
+                v.push((uint8_t)i).is_ok();
+    15f5:	|  |     |     |   48 8d 7c 24 1c       	lea    0x1c(%rsp),%rdi
+            for (Index i = 0; i < n; ++i) {
+    15fa:	|  |     |     |   48 ff c5             	inc    %rbp
+                v.push((uint8_t)i).is_ok();
+    15fd:	|  |     |     |   e8 bc 02 00 00       	call   18be <nel::Result<void, U8Buf<256ul> >::~Result()>
+            for (Index i = 0; i < n; ++i) {
+    1602:	|  |     |     |   48 81 fd e8 03 00 00 	cmp    $0x3e8,%rbp
+    1609:	|  \-----|-----|-- 0f 85 09 ff ff ff    	jne    1518 <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x20>
+    160f:	|        |  /--|-- eb 1b                	jmp    162c <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x134>
+                    return on_err(*err_);
+                case Tag::INVAL:
+                    // invalids are not values that should occur
+                    // if they do it's a use-after-move-from op so must panic.
+                    // or a use-before-initialised so again must panic.
+                    nel::panic("invalid Result", ctx);
+    1611:	|        |  |  \-> 48 89 e6             	mov    %rsp,%rsi
+    1614:	|        |  |      48 8d 3d e9 09 00 00 	lea    0x9e9(%rip),%rdi        # 2004 <_IO_stdin_used+0x4>
+    161b:	|        |  |  /-- eb 0a                	jmp    1627 <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x12f>
+                    break;
+                default:
+                    nel::panic("bad Result", ctx);
+    161d:	|        \--|--|-> 48 89 e6             	mov    %rsp,%rsi
+    1620:	|           |  |   48 8d 3d ec 09 00 00 	lea    0x9ec(%rip),%rdi        # 2013 <_IO_stdin_used+0x13>
+    1627:	|           |  \-> e8 06 fb ff ff       	call   1132 <nel::panic(char const*, nel::Context const&)>
+            if (old == nullptr) { return; }
+    162c:	|           \----> 48 85 db             	test   %rbx,%rbx
+    162f:	|              /-- 74 08                	je     1639 <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x141>
+    1631:	|              |   48 89 df             	mov    %rbx,%rdi
+    1634:	|              |   e8 8c fe ff ff       	call   14c5 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*) [clone .part.0]>
+        for (Index r = 0; r < 100; ++r) {
+    1639:	|              \-> 49 ff cc             	dec    %r12
+    163c:	\----------------- 0f 85 d2 fe ff ff    	jne    1514 <bench_growth<nel::heaped::Poisoned<true, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x1c>
+    auto t = bench::time_ns([]() {
+    1642:	                   48 81 c4 20 01 00 00 	add    $0x120,%rsp
+    1649:	                   5b                   	pop    %rbx
+    164a:	                   5d                   	pop    %rbp
+    164b:	                   41 5c                	pop    %r12
+    164d:	                   41 5d                	pop    %r13
+    164f:	                   41 5e                	pop    %r14
+    1651:	                   c3                   	ret
+
+0000000000001652 <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]>:
+    1652:	                   41 56                	push   %r14
+            : fn_name_(fn_name)
+    1654:	                   4c 8d 35 0e 0a 00 00 	lea    0xa0e(%rip),%r14        # 2069 <_IO_stdin_used+0x69>
+    165b:	                   41 55                	push   %r13
+    165d:	                   41 54                	push   %r12
+    165f:	                   41 bc 64 00 00 00    	mov    $0x64,%r12d
+    1665:	                   55                   	push   %rbp
+    1666:	                   53                   	push   %rbx
+    1667:	                   48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+            : item_(nullptr)
+    166e:	/----------------> 31 db                	xor    %ebx,%ebx
+            for (Index i = 0; i < n; ++i) {
+    1670:	|                  31 ed                	xor    %ebp,%ebp
+            return (item_ == nullptr) ? 0 : item_->len();
+    1672:	|  /-------------> 48 85 db             	test   %rbx,%rbx
+    1675:	|  |               44 0f b6 ed          	movzbl %bpl,%r13d
+    1679:	|  |           /-- 74 12                	je     168d <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x3b>
+            return len_;
+    167b:	|  |           |   48 8b 73 08          	mov    0x8(%rbx),%rsi
+            return alloc_;
+    167f:	|  |           |   48 8b 13             	mov    (%rbx),%rdx
+            if (len() + n <= capacity()) { return true; }
+    1682:	|  |           |   48 8d 46 01          	lea    0x1(%rsi),%rax
+    1686:	|  |           |   48 39 c2             	cmp    %rax,%rdx
+    1689:	|  |  /--------|-- 73 60                	jae    16eb <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x99>
+    168b:	|  |  |     /--|-- eb 1c                	jmp    16a9 <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x57>
+            Node *new_n = realloc(nullptr, capacity);
+    168d:	|  |  |     |  \-> be 04 00 00 00       	mov    $0x4,%esi
+    1692:	|  |  |     |      31 ff                	xor    %edi,%edi
+    1694:	|  |  |     |      e8 bf 04 00 00       	call   1b58 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)>
+    1699:	|  |  |     |      48 89 c3             	mov    %rax,%rbx
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    169c:	|  |  |     |      48 85 c0             	test   %rax,%rax
+    169f:	|  |  |  /--|----- 74 53                	je     16f4 <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0xa2>
+    16a1:	|  |  |  |  |      31 c0                	xor    %eax,%eax
+    16a3:	|  |  |  |  |      48 89 43 08          	mov    %rax,0x8(%rbx)
+    16a7:	|  |  +--|--|----- eb 42                	jmp    16eb <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x99>
+    16a9:	|  |  |  |  \----> 48 83 fa 03          	cmp    $0x3,%rdx
+    16ad:	|  |  |  |     /-- 77 15                	ja     16c4 <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x72>
+    16af:	|  |  |  |     |   ba 04 00 00 00       	mov    $0x4,%edx
+    16b4:	|  |  |  |     |   48 39 d0             	cmp    %rdx,%rax
+    16b7:	|  |  |  |     |   48 0f 42 c2          	cmovb  %rdx,%rax
+    16bb:	|  |  |  |     |   48 39 f0             	cmp    %rsi,%rax
+    16be:	|  |  |  |     |   48 0f 43 f0          	cmovae %rax,%rsi
+    16c2:	|  |  |  |  /--|-- eb 17                	jmp    16db <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x89>
+    16c4:	|  |  |  |  |  \-> 48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+    16c8:	|  |  |  |  |      48 39 c1             	cmp    %rax,%rcx
+    16cb:	|  |  |  |  |      48 0f 43 c1          	cmovae %rcx,%rax
+    16cf:	|  |  |  |  |      48 39 f0             	cmp    %rsi,%rax
+    16d2:	|  |  |  |  |      48 0f 43 f0          	cmovae %rax,%rsi
+            } else if (new_cap == item_->capacity()) {
+    16d6:	|  |  |  |  |      48 39 d6             	cmp    %rdx,%rsi
+    16d9:	|  |  +--|--|----- 74 10                	je     16eb <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x99>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    16db:	|  |  |  |  \----> 48 89 df             	mov    %rbx,%rdi
+    16de:	|  |  |  |         e8 75 04 00 00       	call   1b58 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)>
+                if (p == nullptr) { return false; }
+    16e3:	|  |  |  |         48 85 c0             	test   %rax,%rax
+    16e6:	|  |  |  +-------- 74 0c                	je     16f4 <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0xa2>
+                item_ = p;
+    16e8:	|  |  |  |         48 89 c3             	mov    %rax,%rbx
+            return len_;
+    16eb:	|  |  \--|-------> 48 8b 43 08          	mov    0x8(%rbx),%rax
+            if (len() >= capacity()) {
+    16ef:	|  |     |         48 3b 03             	cmp    (%rbx),%rax
+    16f2:	|  |     |     /-- 72 17                	jb     170b <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0xb9>
+            : value_(forward<Args>(args)...)
+    16f4:	|  |     \-----|-> 48 8d 7c 24 20       	lea    0x20(%rsp),%rdi
+    16f9:	|  |           |   44 89 ee             	mov    %r13d,%esi
+            : tag_(Tag::ERR)
+    16fc:	|  |           |   c7 44 24 1c 02 00 00 	movl   $0x2,0x1c(%rsp)
+    1703:	|  |           |   00 
+    1704:	|  |           |   e8 05 02 00 00       	call   190e <U8Buf<256ul>::U8Buf(unsigned char)>
+        }
+    1709:	|  |        /--|-- eb 1d                	jmp    1728 <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0xd6>
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    170b:	|  |        |  \-> 48 c1 e0 08          	shl    $0x8,%rax
+    170f:	|  |        |      44 89 ee             	mov    %r13d,%esi
+    1712:	|  |        |      48 8d 7c 03 10       	lea    0x10(%rbx,%rax,1),%rdi
+    1717:	|  |        |      e8 f2 01 00 00       	call   190e <U8Buf<256ul>::U8Buf(unsigned char)>
+            len_ += 1;
+    171c:	|  |        |      48 ff 43 08          	incq   0x8(%rbx)
+            : tag_(Tag::OK)
+    1720:	|  |        |      c7 44 24 1c 01 00 00 	movl   $0x1,0x1c(%rsp)
+    1727:	|  |        |      00 
+            , file_name_(file_name)
+    1728:	|  |        \----> 48 8d 05 45 09 00 00 	lea    0x945(%rip),%rax        # 2074 <_IO_stdin_used+0x74>
+            : fn_name_(fn_name)
+    172f:	|  |               4c 89 34 24          	mov    %r14,(%rsp)
+            , file_name_(file_name)
+    1733:	|  |               48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1738:	|  |               8b 44 24 1c          	mov    0x1c(%rsp),%eax
+            , line_num_(line_num)
+    173c:	|  |               c7 44 24 10 47 00 00 	movl   $0x47,0x10(%rsp)
+    1743:	|  |               00 
+            switch (tag_) { // result<void>-match
+    1744:	|  |               85 c0                	test   %eax,%eax
+    1746:	|  |           /-- 74 23                	je     176b <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x119>
+    1748:	|  |           |   ff c8                	dec    %eax
+    174a:	|  |           |   83 f8 01             	cmp    $0x1,%eax
+    174d:	|  |     /-----|-- 77 28                	ja     1777 <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x125>
+                v.push((uint8_t)i).is_ok();
+    174f:	|  |     |     |   48 8d 7c 24 1c       	lea    0x1c(%rsp),%rdi
+            for (Index i = 0; i < n; ++i) {
+    1754:	|  |     |     |   48 ff c5             	inc    %rbp
+                v.push((uint8_t)i).is_ok();
+    1757:	|  |     |     |   e8 62 01 00 00       	call   18be <nel::Result<void, U8Buf<256ul> >::~Result()>
+            for (Index i = 0; i < n; ++i) {
+    175c:	|  |     |     |   48 81 fd e8 03 00 00 	cmp    $0x3e8,%rbp
+    1763:	|  \-----|-----|-- 0f 85 09 ff ff ff    	jne    1672 <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x20>
+    1769:	|        |  /--|-- eb 1b                	jmp    1786 <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x134>
+                    nel::panic("invalid Result", ctx);
+    176b:	|        |  |  \-> 48 89 e6             	mov    %rsp,%rsi
+    176e:	|        |  |      48 8d 3d 8f 08 00 00 	lea    0x88f(%rip),%rdi        # 2004 <_IO_stdin_used+0x4>
+    1775:	|        |  |  /-- eb 0a                	jmp    1781 <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x12f>
+                    nel::panic("bad Result", ctx);
+    1777:	|        \--|--|-> 48 89 e6             	mov    %rsp,%rsi
+    177a:	|           |  |   48 8d 3d 92 08 00 00 	lea    0x892(%rip),%rdi        # 2013 <_IO_stdin_used+0x13>
+    1781:	|           |  \-> e8 ac f9 ff ff       	call   1132 <nel::panic(char const*, nel::Context const&)>
+            if (old == nullptr) { return; }
+    1786:	|           \----> 48 85 db             	test   %rbx,%rbx
+    1789:	|              /-- 74 08                	je     1793 <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x141>
+    178b:	|              |   48 89 df             	mov    %rbx,%rdi
+    178e:	|              |   e8 32 fd ff ff       	call   14c5 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::free(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*) [clone .part.0]>
+        for (Index r = 0; r < 100; ++r) {
+    1793:	|              \-> 49 ff cc             	dec    %r12
+    1796:	\----------------- 0f 85 d2 fe ff ff    	jne    166e <bench_growth<nel::heaped::Poisoned<false, nel::heaped::Malloc> >(char const*)::{lambda()#1}::operator()() const [clone .isra.0]+0x1c>
+    auto t = bench::time_ns([]() {
+    179c:	                   48 81 c4 20 01 00 00 	add    $0x120,%rsp
+    17a3:	                   5b                   	pop    %rbx
+    17a4:	                   5d                   	pop    %rbp
+    17a5:	                   41 5c                	pop    %r12
+    17a7:	                   41 5d                	pop    %r13
+    17a9:	                   41 5e                	pop    %r14
+    17ab:	                   c3                   	ret
+
+00000000000017ac <bench::now_ns()>:
+{
+    17ac:	48 83 ec 18          	sub    $0x18,%rsp
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    17b0:	bf 01 00 00 00       	mov    $0x1,%edi
+    17b5:	48 89 e6             	mov    %rsp,%rsi
+    17b8:	e8 93 f8 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    17bd:	48 69 04 24 00 ca 9a 	imul   $0x3b9aca00,(%rsp),%rax
+    17c4:	3b 
+    17c5:	48 03 44 24 08       	add    0x8(%rsp),%rax
+}
+    17ca:	48 83 c4 18          	add    $0x18,%rsp
+    17ce:	c3                   	ret
+
+00000000000017cf <bench::report(char const*, unsigned long, unsigned long)>:
+}
+
+// Log a result line: name, time and (if bytes given) bandwidth.
+inline void report(char const *const name, long unsigned int const ns,
+                   long unsigned int const bytes = 0)
+{
+    17cf:	    41 54                	push   %r12
+    nel::log << name << ": " << ns / 1000UL << "us";
+    17d1:	    4c 8d 25 c8 28 02 00 	lea    0x228c8(%rip),%r12        # 240a0 <nel::log>
+{
+    17d8:	    55                   	push   %rbp
+    17d9:	    48 89 f5             	mov    %rsi,%rbp
+    nel::log << name << ": " << ns / 1000UL << "us";
+    17dc:	    48 89 fe             	mov    %rdi,%rsi
+    17df:	    4c 89 e7             	mov    %r12,%rdi
+{
+    17e2:	    53                   	push   %rbx
+    17e3:	    48 89 d3             	mov    %rdx,%rbx
+    nel::log << name << ": " << ns / 1000UL << "us";
+    17e6:	    e8 36 07 00 00       	call   1f21 <nel::operator<<(nel::Log&, char const*)>
+    17eb:	    48 8d 35 cf 08 00 00 	lea    0x8cf(%rip),%rsi        # 20c1 <_IO_stdin_used+0xc1>
+    17f2:	    48 89 c7             	mov    %rax,%rdi
+    17f5:	    e8 27 07 00 00       	call   1f21 <nel::operator<<(nel::Log&, char const*)>
+    17fa:	    b9 e8 03 00 00       	mov    $0x3e8,%ecx
+    17ff:	    31 d2                	xor    %edx,%edx
+    1801:	    48 89 c7             	mov    %rax,%rdi
+    1804:	    48 89 e8             	mov    %rbp,%rax
+    1807:	    48 f7 f1             	div    %rcx
+    180a:	    48 89 c6             	mov    %rax,%rsi
+    180d:	    e8 aa 07 00 00       	call   1fbc <nel::operator<<(nel::Log&, unsigned long)>
+    1812:	    48 8d 35 ab 08 00 00 	lea    0x8ab(%rip),%rsi        # 20c4 <_IO_stdin_used+0xc4>
+    1819:	    48 89 c7             	mov    %rax,%rdi
+    181c:	    e8 00 07 00 00       	call   1f21 <nel::operator<<(nel::Log&, char const*)>
+    if (bytes != 0 && ns != 0) {
+    1821:	    48 85 db             	test   %rbx,%rbx
+    1824:	/-- 74 3a                	je     1860 <bench::report(char const*, unsigned long, unsigned long)+0x91>
+    1826:	|   48 85 ed             	test   %rbp,%rbp
+    1829:	+-- 74 35                	je     1860 <bench::report(char const*, unsigned long, unsigned long)+0x91>
+        // bytes/ns == GB/s, scaled to MB/s
+        nel::log << ", " << (bytes * 1000UL) / ns << "MB/s";
+    182b:	|   48 8d 35 95 08 00 00 	lea    0x895(%rip),%rsi        # 20c7 <_IO_stdin_used+0xc7>
+    1832:	|   4c 89 e7             	mov    %r12,%rdi
+    1835:	|   e8 e7 06 00 00       	call   1f21 <nel::operator<<(nel::Log&, char const*)>
+    183a:	|   31 d2                	xor    %edx,%edx
+    183c:	|   48 89 c7             	mov    %rax,%rdi
+    183f:	|   48 69 c3 e8 03 00 00 	imul   $0x3e8,%rbx,%rax
+    1846:	|   48 f7 f5             	div    %rbp
+    1849:	|   48 89 c6             	mov    %rax,%rsi
+    184c:	|   e8 6b 07 00 00       	call   1fbc <nel::operator<<(nel::Log&, unsigned long)>
+    1851:	|   48 8d 35 72 08 00 00 	lea    0x872(%rip),%rsi        # 20ca <_IO_stdin_used+0xca>
+    1858:	|   48 89 c7             	mov    %rax,%rdi
+    185b:	|   e8 c1 06 00 00       	call   1f21 <nel::operator<<(nel::Log&, char const*)>
+    }
+    nel::log << '\n';
+}
+    1860:	\-> 5b                   	pop    %rbx
+    nel::log << '\n';
+    1861:	    4c 89 e7             	mov    %r12,%rdi
+}
+    1864:	    5d                   	pop    %rbp
+    nel::log << '\n';
+    1865:	    be 0a 00 00 00       	mov    $0xa,%esi
+}
+    186a:	    41 5c                	pop    %r12
+    nel::log << '\n';
+    186c:	    e9 97 06 00 00       	jmp    1f08 <nel::operator<<(nel::Log&, char)>
+    1871:	    90                   	nop
+
+0000000000001872 <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+    1872:	    83 3f 02             	cmpl   $0x2,(%rdi)
+    1875:	/-- 76 35                	jbe    18ac <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x3a>
+    1877:	|   48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    187b:	|   48 8d 05 4d 08 00 00 	lea    0x84d(%rip),%rax        # 20cf <_IO_stdin_used+0xcf>
+                    nel::panic("bad Result");
+    1882:	|   48 8d 3d 8a 07 00 00 	lea    0x78a(%rip),%rdi        # 2013 <_IO_stdin_used+0x13>
+    1889:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    188e:	|   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    1893:	|   48 8d 05 3d 08 00 00 	lea    0x83d(%rip),%rax        # 20d7 <_IO_stdin_used+0xd7>
+    189a:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    189f:	|   c7 44 24 18 72 00 00 	movl   $0x72,0x18(%rsp)
+    18a6:	|   00 
+    18a7:	|   e8 86 f8 ff ff       	call   1132 <nel::panic(char const*, nel::Context const&)>
+    18ac:	\-> c3                   	ret
+    18ad:	    90                   	nop
+
+00000000000018ae <U8Buf<256ul>::~U8Buf()>:
+    18ae:	ba 00 01 00 00       	mov    $0x100,%edx
+    18b3:	be a5 00 00 00       	mov    $0xa5,%esi
+    18b8:	e9 cc 03 00 00       	jmp    1c89 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    18bd:	90                   	nop
+
+00000000000018be <nel::Result<void, U8Buf<256ul> >::~Result()>:
+    18be:	       8b 07                	mov    (%rdi),%eax
+    18c0:	       83 f8 01             	cmp    $0x1,%eax
+    18c3:	   /-- 7f 05                	jg     18ca <nel::Result<void, U8Buf<256ul> >::~Result()+0xc>
+    18c5:	   |   85 c0                	test   %eax,%eax
+    18c7:	/--|-- 78 0f                	js     18d8 <nel::Result<void, U8Buf<256ul> >::~Result()+0x1a>
+    18c9:	|  |   c3                   	ret
+    18ca:	|  \-> 83 f8 02             	cmp    $0x2,%eax
+    18cd:	+----- 75 09                	jne    18d8 <nel::Result<void, U8Buf<256ul> >::~Result()+0x1a>
+        constexpr ~Element(void) = default;
+    18cf:	|      48 83 c7 04          	add    $0x4,%rdi
+    18d3:	|      e9 d6 ff ff ff       	jmp    18ae <U8Buf<256ul>::~U8Buf()>
+        constexpr ~Result(void)
+    18d8:	\----> 48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    18dc:	       48 8d 05 ec 07 00 00 	lea    0x7ec(%rip),%rax        # 20cf <_IO_stdin_used+0xcf>
+                    nel::panic("bad Result");
+    18e3:	       48 8d 3d 29 07 00 00 	lea    0x729(%rip),%rdi        # 2013 <_IO_stdin_used+0x13>
+    18ea:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    18ef:	       48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    18f4:	       48 8d 05 dc 07 00 00 	lea    0x7dc(%rip),%rax        # 20d7 <_IO_stdin_used+0xd7>
+    18fb:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1900:	       c7 44 24 18 dd 02 00 	movl   $0x2dd,0x18(%rsp)
+    1907:	       00 
+    1908:	       e8 25 f8 ff ff       	call   1132 <nel::panic(char const*, nel::Context const&)>
+    190d:	       90                   	nop
+
+000000000000190e <U8Buf<256ul>::U8Buf(unsigned char)>:
+            nel::elem::set(data_, f, N);
+    190e:	40 0f b6 f6          	movzbl %sil,%esi
+    1912:	ba 00 01 00 00       	mov    $0x100,%edx
+    1917:	e9 6d 03 00 00       	jmp    1c89 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+
+000000000000191c <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>:
+    191c:	          8b 07                	mov    (%rdi),%eax
+    191e:	          31 c9                	xor    %ecx,%ecx
+    1920:	          89 0f                	mov    %ecx,(%rdi)
+    1922:	          83 f8 01             	cmp    $0x1,%eax
+    1925:	/-------- 74 2e                	je     1955 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)+0x39>
+    1927:	|         52                   	push   %rdx
+    1928:	|         83 f8 02             	cmp    $0x2,%eax
+    192b:	|     /-- 74 10                	je     193d <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)+0x21>
+    192d:	|     |   85 c0                	test   %eax,%eax
+    192f:	|  /--|-- 75 18                	jne    1949 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)+0x2d>
+    1931:	|  |  |   48 8d 3d cc 06 00 00 	lea    0x6cc(%rip),%rdi        # 2004 <_IO_stdin_used+0x4>
+    1938:	|  |  |   e8 f5 f7 ff ff       	call   1132 <nel::panic(char const*, nel::Context const&)>
+    193d:	|  |  \-> 48 8d 3d a5 07 00 00 	lea    0x7a5(%rip),%rdi        # 20e9 <_IO_stdin_used+0xe9>
+    1944:	|  |      e8 e9 f7 ff ff       	call   1132 <nel::panic(char const*, nel::Context const&)>
+    1949:	|  \----> 48 8d 3d c3 06 00 00 	lea    0x6c3(%rip),%rdi        # 2013 <_IO_stdin_used+0x13>
+    1950:	|         e8 dd f7 ff ff       	call   1132 <nel::panic(char const*, nel::Context const&)>
+    1955:	\-------> 48 8b 47 08          	mov    0x8(%rdi),%rax
+    1959:	          c3                   	ret
+
+000000000000195a <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)>:
+ * @warning UB if [s, s+n) is not initialised.
+ */
+void relocate(uint8_t *const d, uint8_t *const s, Length const n);
+
+template<typename T>
+void relocate(T d[], T s[], Length const n)
+    195a:	          41 55                	push   %r13
+    195c:	          41 54                	push   %r12
+    195e:	          55                   	push   %rbp
+    195f:	          53                   	push   %rbx
+    1960:	          51                   	push   %rcx
+{
+    if (d == s) { return; }
+    1961:	          48 39 f7             	cmp    %rsi,%rdi
+    1964:	/-------- 74 7d                	je     19e3 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x89>
+    1966:	|         48 89 fd             	mov    %rdi,%rbp
+    1969:	|         48 89 f3             	mov    %rsi,%rbx
+    196c:	|         49 89 d4             	mov    %rdx,%r12
+    if constexpr (is_trivially_relocatable<T>) {
+        relocate(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t *>(s), n * sizeof(T));
+    } else if (d < s) {
+    196f:	|     /-- 72 0f                	jb     1980 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x26>
+    1971:	|     |   48 89 d0             	mov    %rdx,%rax
+    1974:	|     |   48 c1 e0 08          	shl    $0x8,%rax
+    1978:	|     |   48 01 c5             	add    %rax,%rbp
+    197b:	|     |   48 01 c3             	add    %rax,%rbx
+    197e:	|  /--|-- eb 33                	jmp    19b3 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x59>
+        // forwards, so overlap is not overwritten before it is read.
+        for (Index i = 0; i < n; ++i) {
+    1980:	|  |  \-> 45 31 ed             	xor    %r13d,%r13d
+    1983:	|  |  /-> 4d 39 e5             	cmp    %r12,%r13
+    1986:	+--|--|-- 74 5b                	je     19e3 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x89>
+            nel::elem::move(data_, o.data_, N);
+    1988:	|  |  |   48 89 de             	mov    %rbx,%rsi
+    198b:	|  |  |   48 89 ef             	mov    %rbp,%rdi
+    198e:	|  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1993:	|  |  |   49 ff c5             	inc    %r13
+    1996:	|  |  |   e8 f6 02 00 00       	call   1c91 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            new (&d[i]) T(nel::move(s[i]));
+            s[i].~T();
+    199b:	|  |  |   48 89 df             	mov    %rbx,%rdi
+    199e:	|  |  |   48 81 c5 00 01 00 00 	add    $0x100,%rbp
+    19a5:	|  |  |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    19ac:	|  |  |   e8 fd fe ff ff       	call   18ae <U8Buf<256ul>::~U8Buf()>
+        for (Index i = 0; i < n; ++i) {
+    19b1:	|  |  \-- eb d0                	jmp    1983 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x29>
+        }
+    } else {
+        // backwards, so overlap is not overwritten before it is read.
+        for (Index i = n; i > 0; --i) {
+    19b3:	|  >----> 48 81 ed 00 01 00 00 	sub    $0x100,%rbp
+    19ba:	|  |      48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    19c1:	|  |      4d 85 e4             	test   %r12,%r12
+    19c4:	+--|----- 74 1d                	je     19e3 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x89>
+    19c6:	|  |      ba 00 01 00 00       	mov    $0x100,%edx
+    19cb:	|  |      48 89 de             	mov    %rbx,%rsi
+    19ce:	|  |      48 89 ef             	mov    %rbp,%rdi
+    19d1:	|  |      49 ff cc             	dec    %r12
+    19d4:	|  |      e8 b8 02 00 00       	call   1c91 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            new (&d[i - 1]) T(nel::move(s[i - 1]));
+            s[i - 1].~T();
+    19d9:	|  |      48 89 df             	mov    %rbx,%rdi
+    19dc:	|  |      e8 cd fe ff ff       	call   18ae <U8Buf<256ul>::~U8Buf()>
+        for (Index i = n; i > 0; --i) {
+    19e1:	|  \----- eb d0                	jmp    19b3 <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)+0x59>
+        }
+    }
+}
+    19e3:	\-------> 58                   	pop    %rax
+    19e4:	          5b                   	pop    %rbx
+    19e5:	          5d                   	pop    %rbp
+    19e6:	          41 5c                	pop    %r12
+    19e8:	          41 5d                	pop    %r13
+    19ea:	          c3                   	ret
+
+00000000000019eb <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)>:
+            if (new_cap > max_capacity) { return nullptr; }
+    19eb:	          48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    19f2:	          ff 7f 00 
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    19f5:	          41 57                	push   %r15
+    19f7:	          41 56                	push   %r14
+    19f9:	          41 55                	push   %r13
+    19fb:	          41 54                	push   %r12
+    19fd:	          55                   	push   %rbp
+    19fe:	          53                   	push   %rbx
+    19ff:	          48 83 ec 58          	sub    $0x58,%rsp
+            if (new_cap > max_capacity) { return nullptr; }
+    1a03:	          48 39 f0             	cmp    %rsi,%rax
+    1a06:	/-------- 0f 82 a2 00 00 00    	jb     1aae <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)+0xc3>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1a0c:	|         48 89 f5             	mov    %rsi,%rbp
+    1a0f:	|         49 89 fe             	mov    %rdi,%r14
+    1a12:	|         49 89 f4             	mov    %rsi,%r12
+            Length const old_sz = (old_n == nullptr) ? 0 : size_of(old_n->alloc_);
+    1a15:	|         31 db                	xor    %ebx,%ebx
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1a17:	|         48 c1 e5 08          	shl    $0x8,%rbp
+    1a1b:	|         48 8d 45 10          	lea    0x10(%rbp),%rax
+    1a1f:	|         48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            Length const old_sz = (old_n == nullptr) ? 0 : size_of(old_n->alloc_);
+    1a24:	|         48 85 ff             	test   %rdi,%rdi
+    1a27:	|     /-- 74 0b                	je     1a34 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)+0x49>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1a29:	|     |   48 8b 1f             	mov    (%rdi),%rbx
+    1a2c:	|     |   48 c1 e3 08          	shl    $0x8,%rbx
+    1a30:	|     |   48 83 c3 10          	add    $0x10,%rbx
+                                    : std::realloc(p, new_size);
+    1a34:	|     \-> 48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    1a39:	|         e8 72 f6 ff ff       	call   10b0 <malloc@plt>
+            if (new_p == nullptr) {
+    1a3e:	|         48 85 c0             	test   %rax,%rax
+    1a41:	|  /----- 75 12                	jne    1a55 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)+0x6a>
+            : tag_(Tag::ERR)
+    1a43:	|  |      c7 44 24 28 02 00 00 	movl   $0x2,0x28(%rsp)
+    1a4a:	|  |      00 
+            : value_(forward<Type>(val))
+    1a4b:	|  |      c7 44 24 30 01 00 00 	movl   $0x1,0x30(%rsp)
+    1a52:	|  |      00 
+    1a53:	|  |  /-- eb 0d                	jmp    1a62 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)+0x77>
+            : tag_(Tag::OK)
+    1a55:	|  \--|-> c7 44 24 28 01 00 00 	movl   $0x1,0x28(%rsp)
+    1a5c:	|     |   00 
+            : value_(forward<Args>(args)...)
+    1a5d:	|     |   48 89 44 24 30       	mov    %rax,0x30(%rsp)
+                if (r.is_err()) { return nullptr; }
+    1a62:	|     \-> 48 8d 44 24 38       	lea    0x38(%rsp),%rax
+    1a67:	|         8b 7c 24 28          	mov    0x28(%rsp),%edi
+            : fn_name_(fn_name)
+    1a6b:	|         4c 8d 3d 81 06 00 00 	lea    0x681(%rip),%r15        # 20f3 <_IO_stdin_used+0xf3>
+            , line_num_(line_num)
+    1a72:	|         c7 44 24 48 8e 00 00 	movl   $0x8e,0x48(%rsp)
+    1a79:	|         00 
+            , file_name_(file_name)
+    1a7a:	|         48 8d 2d 7a 06 00 00 	lea    0x67a(%rip),%rbp        # 20fb <_IO_stdin_used+0xfb>
+    1a81:	|         48 89 c6             	mov    %rax,%rsi
+            : fn_name_(fn_name)
+    1a84:	|         4c 89 7c 24 38       	mov    %r15,0x38(%rsp)
+            , file_name_(file_name)
+    1a89:	|         48 89 6c 24 40       	mov    %rbp,0x40(%rsp)
+    1a8e:	|         48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    1a93:	|         e8 42 f8 ff ff       	call   12da <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const [clone .isra.0]>
+    1a98:	|         84 c0                	test   %al,%al
+    1a9a:	|         48 8d 44 24 28       	lea    0x28(%rsp),%rax
+    1a9f:	|         48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    1aa4:	|     /-- 74 10                	je     1ab6 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)+0xcb>
+            }
+    1aa6:	|     |   48 89 c7             	mov    %rax,%rdi
+    1aa9:	|     |   e8 c4 fd ff ff       	call   1872 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+            if (new_cap > max_capacity) { return nullptr; }
+    1aae:	\-----|-> 45 31 ed             	xor    %r13d,%r13d
+    1ab1:	/-----|-- e9 90 00 00 00       	jmp    1b46 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)+0x15b>
+                new_n = reinterpret_cast<Node *>(r.unwrap());
+    1ab6:	|     \-> 48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1abb:	|         48 8b 7c 24 18       	mov    0x18(%rsp),%rdi
+            , line_num_(line_num)
+    1ac0:	|         c7 44 24 48 8f 00 00 	movl   $0x8f,0x48(%rsp)
+    1ac7:	|         00 
+    1ac8:	|         e8 4f fe ff ff       	call   191c <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+    1acd:	|         49 89 c5             	mov    %rax,%r13
+                if (old_n != nullptr) {
+    1ad0:	|         4d 85 f6             	test   %r14,%r14
+    1ad3:	|  /----- 74 49                	je     1b1e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)+0x133>
+                    nel::assert(old_n->len_ <= new_cap, "heaped::Node: shrinking below len");
+    1ad5:	|  |      49 8b 56 08          	mov    0x8(%r14),%rdx
+            : fn_name_(fn_name)
+    1ad9:	|  |      4c 89 7c 24 38       	mov    %r15,0x38(%rsp)
+            , file_name_(file_name)
+    1ade:	|  |      48 89 6c 24 40       	mov    %rbp,0x40(%rsp)
+            , line_num_(line_num)
+    1ae3:	|  |      c7 44 24 48 91 00 00 	movl   $0x91,0x48(%rsp)
+    1aea:	|  |      00 
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    1aeb:	|  |      49 39 d4             	cmp    %rdx,%r12
+    1aee:	|  |  /-- 73 11                	jae    1b01 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)+0x116>
+    1af0:	|  |  |   48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1af5:	|  |  |   48 8d 3d 16 06 00 00 	lea    0x616(%rip),%rdi        # 2112 <_IO_stdin_used+0x112>
+    1afc:	|  |  |   e8 61 f6 ff ff       	call   1162 <nel::assert_fail(char const*, nel::Context const&)>
+                    new_n->len_ = old_n->len_;
+    1b01:	|  |  \-> 48 89 50 08          	mov    %rdx,0x8(%rax)
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    1b05:	|  |      49 8b 56 08          	mov    0x8(%r14),%rdx
+    1b09:	|  |      48 8d 78 10          	lea    0x10(%rax),%rdi
+    1b0d:	|  |      49 8d 76 10          	lea    0x10(%r14),%rsi
+    1b11:	|  |      e8 44 fe ff ff       	call   195a <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)>
+                std::free(p);
+    1b16:	|  |      4c 89 f7             	mov    %r14,%rdi
+    1b19:	|  |      e8 72 f5 ff ff       	call   1090 <free@plt>
+            }
+    1b1e:	|  \----> 48 8b 7c 24 18       	mov    0x18(%rsp),%rdi
+    1b23:	|         e8 4a fd ff ff       	call   1872 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+                if (new_sz > old_sz) {
+    1b28:	|         48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    1b2d:	|         48 39 c3             	cmp    %rax,%rbx
+    1b30:	|     /-- 73 10                	jae    1b42 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<true, nel::heaped::Malloc> >*, unsigned long)+0x157>
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+    1b32:	|     |   48 89 c6             	mov    %rax,%rsi
+    1b35:	|     |   49 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%rdi
+    1b3a:	|     |   48 29 de             	sub    %rbx,%rsi
+    1b3d:	|     |   e8 5a 01 00 00       	call   1c9c <nel::elem::wipe(unsigned char*, unsigned long)>
+            new_n->alloc_ = new_cap;
+    1b42:	|     \-> 4d 89 65 00          	mov    %r12,0x0(%r13)
+        }
+    1b46:	\-------> 48 83 c4 58          	add    $0x58,%rsp
+    1b4a:	          4c 89 e8             	mov    %r13,%rax
+    1b4d:	          5b                   	pop    %rbx
+    1b4e:	          5d                   	pop    %rbp
+    1b4f:	          41 5c                	pop    %r12
+    1b51:	          41 5d                	pop    %r13
+    1b53:	          41 5e                	pop    %r14
+    1b55:	          41 5f                	pop    %r15
+    1b57:	          c3                   	ret
+
+0000000000001b58 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)>:
+            if (new_cap > max_capacity) { return nullptr; }
+    1b58:	          48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    1b5f:	          ff 7f 00 
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    1b62:	          41 57                	push   %r15
+    1b64:	          41 56                	push   %r14
+    1b66:	          41 55                	push   %r13
+    1b68:	          41 54                	push   %r12
+    1b6a:	          55                   	push   %rbp
+    1b6b:	          53                   	push   %rbx
+    1b6c:	          48 83 ec 48          	sub    $0x48,%rsp
+            if (new_cap > max_capacity) { return nullptr; }
+    1b70:	          48 39 f0             	cmp    %rsi,%rax
+    1b73:	/-------- 0f 82 81 00 00 00    	jb     1bfa <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)+0xa2>
+    1b79:	|         48 89 fb             	mov    %rdi,%rbx
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1b7c:	|         48 89 f7             	mov    %rsi,%rdi
+    1b7f:	|         48 89 f5             	mov    %rsi,%rbp
+    1b82:	|         48 c1 e7 08          	shl    $0x8,%rdi
+    1b86:	|         48 83 c7 10          	add    $0x10,%rdi
+                                    : std::realloc(p, new_size);
+    1b8a:	|         e8 21 f5 ff ff       	call   10b0 <malloc@plt>
+            if (new_p == nullptr) {
+    1b8f:	|         48 85 c0             	test   %rax,%rax
+    1b92:	|  /----- 75 12                	jne    1ba6 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)+0x4e>
+            : tag_(Tag::ERR)
+    1b94:	|  |      c7 44 24 18 02 00 00 	movl   $0x2,0x18(%rsp)
+    1b9b:	|  |      00 
+            : value_(forward<Type>(val))
+    1b9c:	|  |      c7 44 24 20 01 00 00 	movl   $0x1,0x20(%rsp)
+    1ba3:	|  |      00 
+    1ba4:	|  |  /-- eb 0d                	jmp    1bb3 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)+0x5b>
+            : tag_(Tag::OK)
+    1ba6:	|  \--|-> c7 44 24 18 01 00 00 	movl   $0x1,0x18(%rsp)
+    1bad:	|     |   00 
+            : value_(forward<Args>(args)...)
+    1bae:	|     |   48 89 44 24 20       	mov    %rax,0x20(%rsp)
+                if (r.is_err()) { return nullptr; }
+    1bb3:	|     \-> 8b 7c 24 18          	mov    0x18(%rsp),%edi
+    1bb7:	|         4c 8d 6c 24 28       	lea    0x28(%rsp),%r13
+            : fn_name_(fn_name)
+    1bbc:	|         4c 8d 3d 30 05 00 00 	lea    0x530(%rip),%r15        # 20f3 <_IO_stdin_used+0xf3>
+            , line_num_(line_num)
+    1bc3:	|         c7 44 24 38 8e 00 00 	movl   $0x8e,0x38(%rsp)
+    1bca:	|         00 
+            , file_name_(file_name)
+    1bcb:	|         4c 8d 35 29 05 00 00 	lea    0x529(%rip),%r14        # 20fb <_IO_stdin_used+0xfb>
+    1bd2:	|         4c 89 ee             	mov    %r13,%rsi
+            : fn_name_(fn_name)
+    1bd5:	|         4c 89 7c 24 28       	mov    %r15,0x28(%rsp)
+            , file_name_(file_name)
+    1bda:	|         4c 89 74 24 30       	mov    %r14,0x30(%rsp)
+    1bdf:	|         e8 f6 f6 ff ff       	call   12da <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const [clone .isra.0]>
+    1be4:	|         84 c0                	test   %al,%al
+    1be6:	|         48 8d 44 24 18       	lea    0x18(%rsp),%rax
+    1beb:	|         48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1bf0:	|     /-- 74 0d                	je     1bff <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)+0xa7>
+            }
+    1bf2:	|     |   48 89 c7             	mov    %rax,%rdi
+    1bf5:	|     |   e8 78 fc ff ff       	call   1872 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+            if (new_cap > max_capacity) { return nullptr; }
+    1bfa:	\-----|-> 45 31 e4             	xor    %r12d,%r12d
+    1bfd:	/-----|-- eb 72                	jmp    1c71 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)+0x119>
+                new_n = reinterpret_cast<Node *>(r.unwrap());
+    1bff:	|     \-> 48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    1c04:	|         4c 89 ee             	mov    %r13,%rsi
+            , line_num_(line_num)
+    1c07:	|         c7 44 24 38 8f 00 00 	movl   $0x8f,0x38(%rsp)
+    1c0e:	|         00 
+    1c0f:	|         e8 08 fd ff ff       	call   191c <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+    1c14:	|         49 89 c4             	mov    %rax,%r12
+                if (old_n != nullptr) {
+    1c17:	|         48 85 db             	test   %rbx,%rbx
+    1c1a:	|  /----- 74 47                	je     1c63 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)+0x10b>
+                    nel::assert(old_n->len_ <= new_cap, "heaped::Node: shrinking below len");
+    1c1c:	|  |      48 8b 53 08          	mov    0x8(%rbx),%rdx
+            : fn_name_(fn_name)
+    1c20:	|  |      4c 89 7c 24 28       	mov    %r15,0x28(%rsp)
+            , file_name_(file_name)
+    1c25:	|  |      4c 89 74 24 30       	mov    %r14,0x30(%rsp)
+            , line_num_(line_num)
+    1c2a:	|  |      c7 44 24 38 91 00 00 	movl   $0x91,0x38(%rsp)
+    1c31:	|  |      00 
+    if (!pred) { assert_fail(msg, ctx); }
+    1c32:	|  |      48 39 d5             	cmp    %rdx,%rbp
+    1c35:	|  |  /-- 73 0f                	jae    1c46 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Poisoned<false, nel::heaped::Malloc> >*, unsigned long)+0xee>
+    1c37:	|  |  |   4c 89 ee             	mov    %r13,%rsi
+    1c3a:	|  |  |   48 8d 3d d1 04 00 00 	lea    0x4d1(%rip),%rdi        # 2112 <_IO_stdin_used+0x112>
+    1c41:	|  |  |   e8 1c f5 ff ff       	call   1162 <nel::assert_fail(char const*, nel::Context const&)>
+                    new_n->len_ = old_n->len_;
+    1c46:	|  |  \-> 48 89 50 08          	mov    %rdx,0x8(%rax)
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    1c4a:	|  |      48 8b 53 08          	mov    0x8(%rbx),%rdx
+    1c4e:	|  |      48 8d 78 10          	lea    0x10(%rax),%rdi
+    1c52:	|  |      48 8d 73 10          	lea    0x10(%rbx),%rsi
+    1c56:	|  |      e8 ff fc ff ff       	call   195a <void nel::elem::relocate<U8Buf<256ul> >(U8Buf<256ul>*, U8Buf<256ul>*, unsigned long)>
+                std::free(p);
+    1c5b:	|  |      48 89 df             	mov    %rbx,%rdi
+    1c5e:	|  |      e8 2d f4 ff ff       	call   1090 <free@plt>
+            }
+    1c63:	|  \----> 48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    1c68:	|         e8 05 fc ff ff       	call   1872 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+            new_n->alloc_ = new_cap;
+    1c6d:	|         49 89 2c 24          	mov    %rbp,(%r12)
+        }
+    1c71:	\-------> 48 83 c4 48          	add    $0x48,%rsp
+    1c75:	          4c 89 e0             	mov    %r12,%rax
+    1c78:	          5b                   	pop    %rbx
+    1c79:	          5d                   	pop    %rbp
+    1c7a:	          41 5c                	pop    %r12
+    1c7c:	          41 5d                	pop    %r13
+    1c7e:	          41 5e                	pop    %r14
+    1c80:	          41 5f                	pop    %r15
+    1c82:	          c3                   	ret
+
+0000000000001c83 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1c83:	48 89 d1             	mov    %rdx,%rcx
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    1c86:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1c88:	c3                   	ret
+
+0000000000001c89 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    1c89:	48 89 d1             	mov    %rdx,%rcx
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    1c8c:	89 f0                	mov    %esi,%eax
+    1c8e:	f3 aa                	rep stos %al,%es:(%rdi)
+}
+    1c90:	c3                   	ret
+
+0000000000001c91 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    1c91:	48 89 d1             	mov    %rdx,%rcx
+    1c94:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    1c96:	c3                   	ret
+
+0000000000001c97 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    1c97:	e9 34 f4 ff ff       	jmp    10d0 <memmove@plt>
+
+0000000000001c9c <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    1c9c:	48 89 f1             	mov    %rsi,%rcx
+    std::memset(d, s, n);
+    1c9f:	b0 a5                	mov    $0xa5,%al
+    1ca1:	f3 aa                	rep stos %al,%es:(%rdi)
+    set(d, 0xa5, n);
+}
+    1ca3:	c3                   	ret
+
+0000000000001ca4 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1ca4:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    1ca5:	e8 86 f3 ff ff       	call   1030 <memcmp@plt>
+}
+    1caa:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) == 0;
+    1cab:	85 c0                	test   %eax,%eax
+    1cad:	0f 94 c0             	sete   %al
+}
+    1cb0:	c3                   	ret
+
+0000000000001cb1 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1cb1:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    1cb2:	e8 79 f3 ff ff       	call   1030 <memcmp@plt>
+}
+    1cb7:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) != 0;
+    1cb8:	85 c0                	test   %eax,%eax
+    1cba:	0f 95 c0             	setne  %al
+}
+    1cbd:	c3                   	ret
+
+0000000000001cbe <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+{
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1cbe:	          49 89 fa             	mov    %rdi,%r10
+    1cc1:	          48 89 f0             	mov    %rsi,%rax
+    if (n < streaming_min) {
+    1cc4:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1ccb:	      /-- 77 05                	ja     1cd2 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14>
+    std::memcpy(d, s, n);
+    1ccd:	      |   48 89 d1             	mov    %rdx,%rcx
+    1cd0:	/-----|-- eb 79                	jmp    1d4b <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x8d>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1cd2:	|     \-> 48 89 f9             	mov    %rdi,%rcx
+    1cd5:	|         48 f7 d9             	neg    %rcx
+    1cd8:	|         83 e1 0f             	and    $0xf,%ecx
+    1cdb:	|         49 89 c8             	mov    %rcx,%r8
+    std::memcpy(d, s, n);
+    1cde:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1ce0:	|         49 8d 70 40          	lea    0x40(%r8),%rsi
+    1ce4:	|         48 89 f9             	mov    %rdi,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1ce7:	|     /-> 0f 10 54 30 d0       	movups -0x30(%rax,%rsi,1),%xmm2
+    1cec:	|     |   0f 10 4c 30 e0       	movups -0x20(%rax,%rsi,1),%xmm1
+    1cf1:	|     |   49 89 f0             	mov    %rsi,%r8
+    for (; i + 64 <= n; i += 64) {
+    1cf4:	|     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1cf8:	|     |   0f 10 44 30 f0       	movups -0x10(%rax,%rsi,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1cfd:	|     |   0f 10 5c 30 c0       	movups -0x40(%rax,%rsi,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    1d02:	|     |   48 83 c6 40          	add    $0x40,%rsi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1d06:	|     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    1d0b:	|     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    1d10:	|     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    1d15:	|     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    1d1a:	|     |   48 39 f2             	cmp    %rsi,%rdx
+    1d1d:	|     \-- 73 c8                	jae    1ce7 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x29>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    1d1f:	|  /----> 49 8d 48 10          	lea    0x10(%r8),%rcx
+        stream16(d + i, load16(s + i));
+    1d23:	|  |      4f 8d 0c 02          	lea    (%r10,%r8,1),%r9
+    for (; i + 16 <= n; i += 16) {
+    1d27:	|  |      48 39 ca             	cmp    %rcx,%rdx
+    1d2a:	|  |  /-- 72 0f                	jb     1d3b <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x7d>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1d2c:	|  |  |   0f 10 64 08 f0       	movups -0x10(%rax,%rcx,1),%xmm4
+    1d31:	|  |  |   49 89 c8             	mov    %rcx,%r8
+    1d34:	|  |  |   66 41 0f e7 21       	movntdq %xmm4,(%r9)
+    for (; i + 16 <= n; i += 16) {
+    1d39:	|  \--|-- eb e4                	jmp    1d1f <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x61>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    1d3b:	|     \-> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    1d3e:	|         4c 29 c2             	sub    %r8,%rdx
+        stream16(d + i, load16(s + i));
+    1d41:	|         4a 8d 34 00          	lea    (%rax,%r8,1),%rsi
+    std::memcpy(d, s, n);
+    1d45:	|         4c 89 cf             	mov    %r9,%rdi
+    copy(d + i, s + i, n - i);
+    1d48:	|         48 89 d1             	mov    %rdx,%rcx
+    std::memcpy(d, s, n);
+    1d4b:	\-------> f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1d4d:	          c3                   	ret
+
+0000000000001d4e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    1d4e:	          49 89 f8             	mov    %rdi,%r8
+    if (n < streaming_min) {
+    1d51:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1d58:	/-------- 77 37                	ja     1d91 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x43>
+    Length done = (n < 16) ? n : 16;
+    1d5a:	|         b8 10 00 00 00       	mov    $0x10,%eax
+    1d5f:	|         48 39 c2             	cmp    %rax,%rdx
+    1d62:	|         48 0f 46 c2          	cmovbe %rdx,%rax
+    std::memcpy(d, s, n);
+    1d66:	|         89 c1                	mov    %eax,%ecx
+    1d68:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    1d6a:	|  /----> 48 39 d0             	cmp    %rdx,%rax
+    1d6d:	|  |  /-- 73 21                	jae    1d90 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42>
+        Length const m = (done < n - done) ? done : n - done;
+    1d6f:	|  |  |   49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    1d72:	|  |  |   4d 8d 14 00          	lea    (%r8,%rax,1),%r10
+    std::memcpy(d, s, n);
+    1d76:	|  |  |   4c 89 c6             	mov    %r8,%rsi
+        Length const m = (done < n - done) ? done : n - done;
+    1d79:	|  |  |   49 29 c1             	sub    %rax,%r9
+    std::memcpy(d, s, n);
+    1d7c:	|  |  |   4c 89 d7             	mov    %r10,%rdi
+        Length const m = (done < n - done) ? done : n - done;
+    1d7f:	|  |  |   49 39 c1             	cmp    %rax,%r9
+    1d82:	|  |  |   4c 0f 47 c8          	cmova  %rax,%r9
+    std::memcpy(d, s, n);
+    1d86:	|  |  |   44 89 c9             	mov    %r9d,%ecx
+        done += m;
+    1d89:	|  |  |   4c 01 c8             	add    %r9,%rax
+    std::memcpy(d, s, n);
+    1d8c:	|  |  |   f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+        done += m;
+    1d8e:	|  \--|-- eb da                	jmp    1d6a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c>
+    1d90:	|     \-> c3                   	ret
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1d91:	\-------> 48 89 f8             	mov    %rdi,%rax
+    for (Index i = 0; i < head; ++i) {
+    1d94:	          31 c9                	xor    %ecx,%ecx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1d96:	          48 f7 d8             	neg    %rax
+    1d99:	          83 e0 0f             	and    $0xf,%eax
+    for (Index i = 0; i < head; ++i) {
+    1d9c:	   /----> 48 39 c1             	cmp    %rax,%rcx
+    1d9f:	   |  /-- 74 0d                	je     1dae <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x60>
+        d[i] = p[i];
+    1da1:	   |  |   40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+    1da5:	   |  |   41 88 3c 08          	mov    %dil,(%r8,%rcx,1)
+    for (Index i = 0; i < head; ++i) {
+    1da9:	   |  |   48 ff c1             	inc    %rcx
+    1dac:	   \--|-- eb ee                	jmp    1d9c <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4e>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    1dae:	      \-> 31 c9                	xor    %ecx,%ecx
+        rotated[i] = p[(head + i) % 16];
+    1db0:	      /-> 48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+    1db4:	      |   83 e7 0f             	and    $0xf,%edi
+    1db7:	      |   40 8a 3c 3e          	mov    (%rsi,%rdi,1),%dil
+    1dbb:	      |   40 88 7c 0c e8       	mov    %dil,-0x18(%rsp,%rcx,1)
+    for (Index i = 0; i < 16; ++i) {
+    1dc0:	      |   48 ff c1             	inc    %rcx
+    1dc3:	      |   48 83 f9 10          	cmp    $0x10,%rcx
+    1dc7:	      \-- 75 e7                	jne    1db0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x62>
+    std::memcpy(&v, s, sizeof(v));
+    1dc9:	          0f 28 44 24 e8       	movaps -0x18(%rsp),%xmm0
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1dce:	          48 8d 78 40          	lea    0x40(%rax),%rdi
+    1dd2:	          4c 01 c0             	add    %r8,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1dd5:	      /-> 48 89 f9             	mov    %rdi,%rcx
+    for (; i + 64 <= n; i += 64) {
+    1dd8:	      |   48 8d 7f 40          	lea    0x40(%rdi),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1ddc:	      |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    1de0:	      |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    1de5:	      |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    1dea:	      |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    1def:	      |   48 83 c0 40          	add    $0x40,%rax
+    1df3:	      |   48 39 fa             	cmp    %rdi,%rdx
+    1df6:	      \-- 73 dd                	jae    1dd5 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x87>
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+        stream16(d + i, v);
+    1df8:	          49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    for (; i + 16 <= n; i += 16) {
+    1dfc:	   /----> 48 8d 41 10          	lea    0x10(%rcx),%rax
+    1e00:	   |      48 39 c2             	cmp    %rax,%rdx
+    1e03:	   |  /-- 72 0a                	jb     1e0f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc1>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1e05:	   |  |   48 89 c1             	mov    %rax,%rcx
+    1e08:	   |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    1e0d:	   \--|-- eb ed                	jmp    1dfc <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xae>
+    }
+    __builtin_ia32_sfence();
+    1e0f:	      \-> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    1e12:	   /----> 48 39 d1             	cmp    %rdx,%rcx
+    1e15:	   |  /-- 73 12                	jae    1e29 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xdb>
+        d[i] = p[i % 16];
+    1e17:	   |  |   48 89 c8             	mov    %rcx,%rax
+    1e1a:	   |  |   83 e0 0f             	and    $0xf,%eax
+    1e1d:	   |  |   8a 04 06             	mov    (%rsi,%rax,1),%al
+    1e20:	   |  |   41 88 04 08          	mov    %al,(%r8,%rcx,1)
+    for (; i < n; ++i) {
+    1e24:	   |  |   48 ff c1             	inc    %rcx
+    1e27:	   \--|-- eb e9                	jmp    1e12 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc4>
+    }
+}
+    1e29:	      \-> c3                   	ret
+
+0000000000001e2a <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    1e2a:	    48 85 ff             	test   %rdi,%rdi
+    1e2d:	/-- 74 09                	je     1e38 <nel::free_aligned(void*)+0xe>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    1e2f:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    1e33:	|   e9 58 f2 ff ff       	jmp    1090 <free@plt>
+}
+    1e38:	\-> c3                   	ret
+
+0000000000001e39 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    1e39:	       41 56                	push   %r14
+            : fn_name_(fn_name)
+    1e3b:	       48 8d 05 2a 03 00 00 	lea    0x32a(%rip),%rax        # 216c <_IO_stdin_used+0x16c>
+    1e42:	       41 55                	push   %r13
+    1e44:	       41 54                	push   %r12
+    1e46:	       55                   	push   %rbp
+    1e47:	       53                   	push   %rbx
+    1e48:	       48 83 ec 20          	sub    $0x20,%rsp
+    1e4c:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , file_name_(file_name)
+    1e51:	       48 8d 05 24 03 00 00 	lea    0x324(%rip),%rax        # 217c <_IO_stdin_used+0x17c>
+    1e58:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1e5d:	       c7 44 24 18 f3 00 00 	movl   $0xf3,0x18(%rsp)
+    1e64:	       00 
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    1e65:	       48 85 f6             	test   %rsi,%rsi
+    1e68:	/----- 74 28                	je     1e92 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1e6a:	|      4c 8d 66 ff          	lea    -0x1(%rsi),%r12
+    1e6e:	|      48 89 f3             	mov    %rsi,%rbx
+    1e71:	|      49 21 f4             	and    %rsi,%r12
+    1e74:	+----- 75 1c                	jne    1e92 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1e76:	|      49 89 fd             	mov    %rdi,%r13
+    1e79:	|      49 89 d6             	mov    %rdx,%r14
+    1e7c:	|      48 89 cd             	mov    %rcx,%rbp
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1e7f:	|      31 ff                	xor    %edi,%edi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    1e81:	|      4d 85 ed             	test   %r13,%r13
+    1e84:	|  /-- 74 1d                	je     1ea3 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+    1e86:	|  |   4d 8b 65 f8          	mov    -0x8(%r13),%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1e8a:	|  |   4c 89 ef             	mov    %r13,%rdi
+    1e8d:	|  |   4c 29 e7             	sub    %r12,%rdi
+    1e90:	|  +-- eb 11                	jmp    1ea3 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+    if (!pred) { assert_fail(msg, ctx); }
+    1e92:	\--|-> 48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    1e97:	   |   48 8d 3d f0 02 00 00 	lea    0x2f0(%rip),%rdi        # 218e <_IO_stdin_used+0x18e>
+    1e9e:	   |   e8 bf f2 ff ff       	call   1162 <nel::assert_fail(char const*, nel::Context const&)>
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1ea3:	   \-> 48 8d 34 2b          	lea    (%rbx,%rbp,1),%rsi
+    1ea7:	       e8 34 f2 ff ff       	call   10e0 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    1eac:	       48 85 c0             	test   %rax,%rax
+    1eaf:	/----- 74 3b                	je     1eec <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb3>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1eb1:	|      48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    1eb6:	|      48 f7 db             	neg    %rbx
+    1eb9:	|      48 21 d9             	and    %rbx,%rcx
+    1ebc:	|      48 89 cb             	mov    %rcx,%rbx
+    1ebf:	|      48 29 c3             	sub    %rax,%rbx
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    1ec2:	|      4d 85 ed             	test   %r13,%r13
+    1ec5:	|  /-- 74 1e                	je     1ee5 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+    1ec7:	|  |   49 39 dc             	cmp    %rbx,%r12
+    1eca:	|  +-- 74 19                	je     1ee5 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    1ecc:	|  |   4c 39 f5             	cmp    %r14,%rbp
+    1ecf:	|  |   4c 89 f2             	mov    %r14,%rdx
+    1ed2:	|  |   4a 8d 34 20          	lea    (%rax,%r12,1),%rsi
+    1ed6:	|  |   48 89 cf             	mov    %rcx,%rdi
+    1ed9:	|  |   48 0f 46 d5          	cmovbe %rbp,%rdx
+    1edd:	|  |   e8 ee f1 ff ff       	call   10d0 <memmove@plt>
+    1ee2:	|  |   48 89 c1             	mov    %rax,%rcx
+    }
+    offset_field(new_p) = new_offset;
+    1ee5:	|  \-> 48 89 59 f8          	mov    %rbx,-0x8(%rcx)
+    return new_p;
+    1ee9:	|      48 89 c8             	mov    %rcx,%rax
+}
+    1eec:	\----> 48 83 c4 20          	add    $0x20,%rsp
+    1ef0:	       5b                   	pop    %rbx
+    1ef1:	       5d                   	pop    %rbp
+    1ef2:	       41 5c                	pop    %r12
+    1ef4:	       41 5d                	pop    %r13
+    1ef6:	       41 5e                	pop    %r14
+    1ef8:	       c3                   	ret
+
+0000000000001ef9 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    1ef9:	48 89 f1             	mov    %rsi,%rcx
+    return realloc_aligned(nullptr, align, 0, size);
+    1efc:	31 d2                	xor    %edx,%edx
+    1efe:	48 89 fe             	mov    %rdi,%rsi
+    1f01:	31 ff                	xor    %edi,%edi
+    1f03:	e9 31 ff ff ff       	jmp    1e39 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+
+0000000000001f08 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1f08:	53                   	push   %rbx
+    1f09:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    1f0c:	40 0f be fe          	movsbl %sil,%edi
+    1f10:	48 8b 35 69 21 00 00 	mov    0x2169(%rip),%rsi        # 4080 <stderr@GLIBC_2.2.5>
+    1f17:	e8 84 f1 ff ff       	call   10a0 <fputc@plt>
+    return outs;
+}
+    1f1c:	48 89 d8             	mov    %rbx,%rax
+    1f1f:	5b                   	pop    %rbx
+    1f20:	c3                   	ret
+
+0000000000001f21 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1f21:	53                   	push   %rbx
+    1f22:	48 89 fb             	mov    %rdi,%rbx
+    1f25:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    1f28:	48 8b 35 51 21 00 00 	mov    0x2151(%rip),%rsi        # 4080 <stderr@GLIBC_2.2.5>
+    1f2f:	e8 4c f1 ff ff       	call   1080 <fputs@plt>
+    return outs;
+}
+    1f34:	48 89 d8             	mov    %rbx,%rax
+    1f37:	5b                   	pop    %rbx
+    1f38:	c3                   	ret
+
+0000000000001f39 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1f39:	53                   	push   %rbx
+    1f3a:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    1f3d:	48 8b 3d 3c 21 00 00 	mov    0x213c(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+    1f44:	40 0f b6 d6          	movzbl %sil,%edx
+    1f48:	31 c0                	xor    %eax,%eax
+    1f4a:	48 8d 35 58 02 00 00 	lea    0x258(%rip),%rsi        # 21a9 <_IO_stdin_used+0x1a9>
+    1f51:	e8 6a f1 ff ff       	call   10c0 <fprintf@plt>
+    return outs;
+}
+    1f56:	48 89 d8             	mov    %rbx,%rax
+    1f59:	5b                   	pop    %rbx
+    1f5a:	c3                   	ret
+
+0000000000001f5b <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    1f5b:	53                   	push   %rbx
+    1f5c:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    1f5f:	48 8b 3d 1a 21 00 00 	mov    0x211a(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+    1f66:	0f b7 d6             	movzwl %si,%edx
+    1f69:	31 c0                	xor    %eax,%eax
+    1f6b:	48 8d 35 37 02 00 00 	lea    0x237(%rip),%rsi        # 21a9 <_IO_stdin_used+0x1a9>
+    1f72:	e8 49 f1 ff ff       	call   10c0 <fprintf@plt>
+    return outs;
+}
+    1f77:	48 89 d8             	mov    %rbx,%rax
+    1f7a:	5b                   	pop    %rbx
+    1f7b:	c3                   	ret
+
+0000000000001f7c <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    1f7c:	53                   	push   %rbx
+    1f7d:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    1f80:	48 8b 3d f9 20 00 00 	mov    0x20f9(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+{
+    1f87:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    1f89:	31 c0                	xor    %eax,%eax
+    1f8b:	48 8d 35 17 02 00 00 	lea    0x217(%rip),%rsi        # 21a9 <_IO_stdin_used+0x1a9>
+    1f92:	e8 29 f1 ff ff       	call   10c0 <fprintf@plt>
+    return outs;
+}
+    1f97:	48 89 d8             	mov    %rbx,%rax
+    1f9a:	5b                   	pop    %rbx
+    1f9b:	c3                   	ret
+
+0000000000001f9c <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    1f9c:	53                   	push   %rbx
+    1f9d:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    1fa0:	48 8b 3d d9 20 00 00 	mov    0x20d9(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+{
+    1fa7:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    1fa9:	31 c0                	xor    %eax,%eax
+    1fab:	48 8d 35 f7 01 00 00 	lea    0x1f7(%rip),%rsi        # 21a9 <_IO_stdin_used+0x1a9>
+    1fb2:	e8 09 f1 ff ff       	call   10c0 <fprintf@plt>
+    return outs;
+}
+    1fb7:	48 89 d8             	mov    %rbx,%rax
+    1fba:	5b                   	pop    %rbx
+    1fbb:	c3                   	ret
+
+0000000000001fbc <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    1fbc:	53                   	push   %rbx
+    1fbd:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    1fc0:	48 8b 3d b9 20 00 00 	mov    0x20b9(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+{
+    1fc7:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    1fca:	31 c0                	xor    %eax,%eax
+    1fcc:	48 8d 35 d9 01 00 00 	lea    0x1d9(%rip),%rsi        # 21ac <_IO_stdin_used+0x1ac>
+    1fd3:	e8 e8 f0 ff ff       	call   10c0 <fprintf@plt>
+    return outs;
+}
+    1fd8:	48 89 d8             	mov    %rbx,%rax
+    1fdb:	5b                   	pop    %rbx
+    1fdc:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000001fe0 <_fini>:
+    1fe0:	48 83 ec 08          	sub    $0x8,%rsp
+    1fe4:	48 83 c4 08          	add    $0x8,%rsp
+    1fe8:	c3                   	ret
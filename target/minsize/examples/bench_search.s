@@ -0,0 +1,1379 @@
+
+target/minsize/examples/bench_search:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <clock_gettime@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <clock_gettime@GLIBC_2.17>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputs@plt>:
+    1060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 4018 <fputs@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 2f 00 00    	jmp    *0x2faa(%rip)        # 4020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fprintf@plt>:
+    1080:	ff 25 a2 2f 00 00    	jmp    *0x2fa2(%rip)        # 4028 <fprintf@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <realloc@plt>:
+    1090:	ff 25 9a 2f 00 00    	jmp    *0x2f9a(%rip)        # 4030 <realloc@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010a0 <__cxa_finalize@plt>:
+    10a0:	ff 25 3a 2f 00 00    	jmp    *0x2f3a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10a6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010b0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10b0:	50                   	push   %rax
+    std::abort();
+    10b1:	e8 8a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010b6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10b6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10b7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10ba:	4c 8d 0d 6f 10 00 00 	lea    0x106f(%rip),%r9        # 2130 <sizes+0x30>
+    10c1:	31 c0                	xor    %eax,%eax
+    10c3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10c7:	4c 8b 07             	mov    (%rdi),%r8
+    10ca:	48 8d 35 65 10 00 00 	lea    0x1065(%rip),%rsi        # 2136 <sizes+0x36>
+    10d1:	48 8b 3d 88 2f 00 00 	mov    0x2f88(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    10d8:	e8 a3 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    10dd:	e8 5e ff ff ff       	call   1040 <abort@plt>
+
+00000000000010e2 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    10e2:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    10e6:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    10e9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    10ed:	31 c0                	xor    %eax,%eax
+    10ef:	57                   	push   %rdi
+    10f0:	48 8b 3d 69 2f 00 00 	mov    0x2f69(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    10f7:	4c 8d 0d 32 10 00 00 	lea    0x1032(%rip),%r9        # 2130 <sizes+0x30>
+    10fe:	4c 8b 06             	mov    (%rsi),%r8
+    1101:	48 8d 35 3f 10 00 00 	lea    0x103f(%rip),%rsi        # 2147 <sizes+0x47>
+    1108:	e8 73 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    110d:	e8 2e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001112 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1112:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1116:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1119:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    111d:	31 c0                	xor    %eax,%eax
+    111f:	57                   	push   %rdi
+    1120:	48 8b 3d 39 2f 00 00 	mov    0x2f39(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1127:	4c 8d 0d 2e 10 00 00 	lea    0x102e(%rip),%r9        # 215c <sizes+0x5c>
+    112e:	4c 8b 06             	mov    (%rsi),%r8
+    1131:	48 8d 35 0f 10 00 00 	lea    0x100f(%rip),%rsi        # 2147 <sizes+0x47>
+    1138:	e8 43 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    113d:	e8 fe fe ff ff       	call   1040 <abort@plt>
+
+0000000000001142 <main>:
+    sink = sink + r;
+    bench::report_per_item(name, t, n_lookups);
+}
+
+int main()
+{
+    1142:	                      41 57                	push   %r15
+    nel::Length const max_n = sizes[sizeof(sizes) / sizeof(sizes[0]) - 1];
+    auto sorted = nel::heaped::Vector<int>::with_capacity(max_n);
+    1144:	                      be 00 00 00 01       	mov    $0x1000000,%esi
+{
+    1149:	                      41 56                	push   %r14
+    114b:	                      41 55                	push   %r13
+    auto layout = nel::heaped::Vector<int>::with_capacity(max_n);
+    114d:	                      45 31 ed             	xor    %r13d,%r13d
+{
+    1150:	                      41 54                	push   %r12
+    1152:	                      55                   	push   %rbp
+    1153:	                      53                   	push   %rbx
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1154:	                      48 8d 1d 1c 0f 00 00 	lea    0xf1c(%rip),%rbx        # 2077 <_IO_stdin_used+0x77>
+    115b:	                      48 83 ec 78          	sub    $0x78,%rsp
+    auto sorted = nel::heaped::Vector<int>::with_capacity(max_n);
+    115f:	                      4c 8d 64 24 38       	lea    0x38(%rsp),%r12
+    auto layout = nel::heaped::Vector<int>::with_capacity(max_n);
+    1164:	                      48 8d 6c 24 40       	lea    0x40(%rsp),%rbp
+    auto sorted = nel::heaped::Vector<int>::with_capacity(max_n);
+    1169:	                      4c 89 e7             	mov    %r12,%rdi
+    116c:	                      e8 04 08 00 00       	call   1975 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+    auto layout = nel::heaped::Vector<int>::with_capacity(max_n);
+    1171:	                      be 00 00 00 01       	mov    $0x1000000,%esi
+    1176:	                      48 89 ef             	mov    %rbp,%rdi
+    1179:	                      e8 f7 07 00 00       	call   1975 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+    for (nel::Index i = 0; i < max_n; ++i) {
+        sorted.push(int(2 * i)).unwrap();
+    117e:	                  /-> 48 8d 44 24 48       	lea    0x48(%rsp),%rax
+    1183:	                  |   4c 89 e6             	mov    %r12,%rsi
+    1186:	                  |   44 89 6c 24 34       	mov    %r13d,0x34(%rsp)
+            , file_name_(file_name)
+    118b:	                  |   4c 8d 35 ea 0e 00 00 	lea    0xeea(%rip),%r14        # 207c <_IO_stdin_used+0x7c>
+    1192:	                  |   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1197:	                  |   48 8d 44 24 34       	lea    0x34(%rsp),%rax
+    119c:	                  |   48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    for (nel::Index i = 0; i < max_n; ++i) {
+    11a1:	                  |   41 83 c5 02          	add    $0x2,%r13d
+        sorted.push(int(2 * i)).unwrap();
+    11a5:	                  |   48 89 c2             	mov    %rax,%rdx
+    11a8:	                  |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    11ad:	                  |   e8 ee 07 00 00       	call   19a0 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>
+    11b2:	                  |   48 8d 44 24 58       	lea    0x58(%rsp),%rax
+    11b7:	                  |   48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+            : fn_name_(fn_name)
+    11bc:	                  |   48 89 5c 24 58       	mov    %rbx,0x58(%rsp)
+    11c1:	                  |   48 89 c6             	mov    %rax,%rsi
+    11c4:	                  |   48 89 44 24 18       	mov    %rax,0x18(%rsp)
+            , file_name_(file_name)
+    11c9:	                  |   4c 89 74 24 60       	mov    %r14,0x60(%rsp)
+            , line_num_(line_num)
+    11ce:	                  |   c7 44 24 68 39 00 00 	movl   $0x39,0x68(%rsp)
+    11d5:	                  |   00 
+    11d6:	                  |   e8 27 06 00 00       	call   1802 <nel::Result<void, int>::unwrap(nel::Context const&)>
+    11db:	                  |   48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    11e0:	                  |   e8 e1 05 00 00       	call   17c6 <nel::Result<void, int>::~Result()>
+        layout.push(0).unwrap();
+    11e5:	                  |   48 8b 54 24 10       	mov    0x10(%rsp),%rdx
+    11ea:	                  |   31 c0                	xor    %eax,%eax
+    11ec:	                  |   48 89 ee             	mov    %rbp,%rsi
+    11ef:	                  |   48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    11f4:	                  |   89 44 24 34          	mov    %eax,0x34(%rsp)
+    11f8:	                  |   e8 a3 07 00 00       	call   19a0 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>
+    11fd:	                  |   48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    1202:	                  |   48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+            : fn_name_(fn_name)
+    1207:	                  |   48 89 5c 24 58       	mov    %rbx,0x58(%rsp)
+            , file_name_(file_name)
+    120c:	                  |   4c 89 74 24 60       	mov    %r14,0x60(%rsp)
+            , line_num_(line_num)
+    1211:	                  |   c7 44 24 68 3a 00 00 	movl   $0x3a,0x68(%rsp)
+    1218:	                  |   00 
+    1219:	                  |   e8 e4 05 00 00       	call   1802 <nel::Result<void, int>::unwrap(nel::Context const&)>
+    121e:	                  |   48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    1223:	                  |   e8 9e 05 00 00       	call   17c6 <nel::Result<void, int>::~Result()>
+    for (nel::Index i = 0; i < max_n; ++i) {
+    1228:	                  |   41 81 fd 00 00 00 02 	cmp    $0x2000000,%r13d
+    122f:	                  \-- 0f 85 49 ff ff ff    	jne    117e <main+0x3c>
+    }
+    nel::sort::Less less;
+
+    for (nel::Length const n: sizes) {
+    1235:	                      4c 8d 25 c4 0e 00 00 	lea    0xec4(%rip),%r12        # 2100 <sizes>
+    123c:	/-------------------> 48 8d 05 ed 0e 00 00 	lea    0xeed(%rip),%rax        # 2130 <sizes+0x30>
+        /**
+         * destroy the vector, deleting all elements owned by it.
+         */
+        ~Vector(void)
+        {
+            VectorNode::free(item_);
+    1243:	|                     4c 8b 74 24 40       	mov    0x40(%rsp),%r14
+    1248:	|                     4c 8b 6c 24 38       	mov    0x38(%rsp),%r13
+    124d:	|                     48 8d 2d 24 2e 00 00 	lea    0x2e24(%rip),%rbp        # 4078 <nel::log>
+    1254:	|                     49 39 c4             	cmp    %rax,%r12
+    1257:	|  /----------------- 0f 84 92 02 00 00    	je     14ef <main+0x3ad>
+    125d:	|  |                  49 8b 1c 24          	mov    (%r12),%rbx
+        auto s = sorted.slice(0, n);
+    1261:	|  |                  48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    1266:	|  |                  4c 89 ee             	mov    %r13,%rsi
+    1269:	|  |                  31 d2                	xor    %edx,%edx
+ * Copy the n sorted items of src into dst in Eytzinger layout.
+ */
+template<typename T>
+void eytzinger_from(T dst[], T const src[], Length const n)
+{
+    eytzinger_fill(dst, src, n, 1, 0);
+    126b:	|  |                  45 31 c0             	xor    %r8d,%r8d
+    126e:	|  |                  48 89 d9             	mov    %rbx,%rcx
+    1271:	|  |                  e8 fc 03 00 00       	call   1672 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice(unsigned long, unsigned long) [clone .isra.0]>
+        auto e = layout.slice(0, n);
+    1276:	|  |                  48 8b 7c 24 18       	mov    0x18(%rsp),%rdi
+    127b:	|  |                  4c 89 f6             	mov    %r14,%rsi
+    127e:	|  |                  48 89 d9             	mov    %rbx,%rcx
+    1281:	|  |                  31 d2                	xor    %edx,%edx
+    1283:	|  |                  e8 ea 03 00 00       	call   1672 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice(unsigned long, unsigned long) [clone .isra.0]>
+         *
+         * @returns number of elements in the slice.
+         */
+        constexpr Type *ptr(void) const
+        {
+            return content_;
+    1288:	|  |                  4c 8b 6c 24 48       	mov    0x48(%rsp),%r13
+    128d:	|  |                  4c 8b 74 24 58       	mov    0x58(%rsp),%r14
+    1292:	|  |                  48 89 da             	mov    %rbx,%rdx
+    1295:	|  |                  b9 01 00 00 00       	mov    $0x1,%ecx
+    129a:	|  |                  4c 89 ee             	mov    %r13,%rsi
+    129d:	|  |                  4c 89 f7             	mov    %r14,%rdi
+    12a0:	|  |                  e8 bf 05 00 00       	call   1864 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)>
+        nel::search::eytzinger_from(e.ptr(), s.ptr(), n);
+        nel::log << "table of " << n << " ints\n";
+    12a5:	|  |                  48 8d 35 e9 0d 00 00 	lea    0xde9(%rip),%rsi        # 2095 <_IO_stdin_used+0x95>
+    12ac:	|  |                  48 89 ef             	mov    %rbp,%rdi
+    12af:	|  |                  e8 da 07 00 00       	call   1a8e <nel::operator<<(nel::Log&, char const*)>
+    12b4:	|  |                  48 89 de             	mov    %rbx,%rsi
+    12b7:	|  |                  48 89 c7             	mov    %rax,%rdi
+    12ba:	|  |                  e8 6a 08 00 00       	call   1b29 <nel::operator<<(nel::Log&, unsigned long)>
+    12bf:	|  |                  48 8d 35 d9 0d 00 00 	lea    0xdd9(%rip),%rsi        # 209f <_IO_stdin_used+0x9f>
+    12c6:	|  |                  48 89 c7             	mov    %rax,%rdi
+    12c9:	|  |                  e8 c0 07 00 00       	call   1a8e <nel::operator<<(nel::Log&, char const*)>
+            int const key = int(next_rand(seed) % (2 * n));
+    12ce:	|  |                  48 8d 04 1b          	lea    (%rbx,%rbx,1),%rax
+    12d2:	|  |                  48 89 44 24 20       	mov    %rax,0x20(%rsp)
+
+        if (n <= max_linear) {
+    12d7:	|  |                  48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+    12de:	|  |     /----------- 77 78                	ja     1358 <main+0x216>
+    unsigned int seed = 0x9e3779b9;
+    12e0:	|  |     |            c7 44 24 34 b9 79 37 	movl   $0x9e3779b9,0x34(%rsp)
+    12e7:	|  |     |            9e 
+    long unsigned int r = 0;
+    12e8:	|  |     |            45 31 ff             	xor    %r15d,%r15d
+
+// Time a run of f(), in ns.
+template<typename F>
+long unsigned int time_ns(F &&f)
+{
+    long unsigned int const b = now_ns();
+    12eb:	|  |     |            e8 d9 03 00 00       	call   16c9 <bench::now_ns()>
+    12f0:	|  |     |            b9 00 09 3d 00       	mov    $0x3d0900,%ecx
+    12f5:	|  |     |            48 89 c5             	mov    %rax,%rbp
+            int const key = int(next_rand(seed) % (2 * n));
+    12f8:	|  |     |  /-------> 48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    12fd:	|  |     |  |         31 d2                	xor    %edx,%edx
+    12ff:	|  |     |  |         e8 36 03 00 00       	call   163a <next_rand(unsigned int&)>
+         * @returns If idx is out-of range, return None.
+         * @returns else return ref to item at index..
+         */
+        constexpr Optional<Type &> try_get(Index idx) const
+        {
+            return (idx >= len_) ? None : Optional<Type &>::Some(content_[idx]);
+    1304:	|  |     |  |         48 8b 74 24 50       	mov    0x50(%rsp),%rsi
+    1309:	|  |     |  |         89 c0                	mov    %eax,%eax
+    130b:	|  |     |  |         48 f7 74 24 20       	divq   0x20(%rsp)
+            run("  linear, try_get   ", n, [&s](int const key) -> nel::Index {
+                nel::Index i = 0;
+    1310:	|  |     |  |         31 c0                	xor    %eax,%eax
+    1312:	|  |     |  |  /----> 48 39 f0             	cmp    %rsi,%rax
+    1315:	|  |     |  |  |  /-- 74 0c                	je     1323 <main+0x1e1>
+                while (s.try_get(i).is_some() && s[i] < key) {
+    1317:	|  |     |  |  |  |   41 3b 54 85 00       	cmp    0x0(%r13,%rax,4),%edx
+    131c:	|  |     |  |  |  +-- 7e 05                	jle    1323 <main+0x1e1>
+                    i += 1;
+    131e:	|  |     |  |  |  |   48 ff c0             	inc    %rax
+    1321:	|  |     |  |  \--|-- eb ef                	jmp    1312 <main+0x1d0>
+            r += f(key);
+    1323:	|  |     |  |     \-> 49 01 c7             	add    %rax,%r15
+        for (nel::Index i = 0; i < n_lookups; ++i) {
+    1326:	|  |     |  |         48 ff c9             	dec    %rcx
+    1329:	|  |     |  \-------- 75 cd                	jne    12f8 <main+0x1b6>
+    f();
+    return now_ns() - b;
+    132b:	|  |     |            e8 99 03 00 00       	call   16c9 <bench::now_ns()>
+    sink = sink + r;
+    1330:	|  |     |            48 8b 15 39 2d 00 00 	mov    0x2d39(%rip),%rdx        # 4070 <sink>
+    bench::report_per_item(name, t, n_lookups);
+    1337:	|  |     |            48 8d 3d 68 0d 00 00 	lea    0xd68(%rip),%rdi        # 20a6 <_IO_stdin_used+0xa6>
+    133e:	|  |     |            48 29 e8             	sub    %rbp,%rax
+    sink = sink + r;
+    1341:	|  |     |            4c 01 fa             	add    %r15,%rdx
+    1344:	|  |     |            48 89 c6             	mov    %rax,%rsi
+    1347:	|  |     |            48 89 15 22 2d 00 00 	mov    %rdx,0x2d22(%rip)        # 4070 <sink>
+    bench::report_per_item(name, t, n_lookups);
+    134e:	|  |     |            ba 00 09 3d 00       	mov    $0x3d0900,%edx
+    1353:	|  |     |            e8 94 03 00 00       	call   16ec <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    unsigned int seed = 0x9e3779b9;
+    1358:	|  |     \----------> c7 44 24 34 b9 79 37 	movl   $0x9e3779b9,0x34(%rsp)
+    135f:	|  |                  9e 
+    long unsigned int const b = now_ns();
+    1360:	|  |                  bd 00 09 3d 00       	mov    $0x3d0900,%ebp
+    long unsigned int r = 0;
+    1365:	|  |                  45 31 ff             	xor    %r15d,%r15d
+    1368:	|  |                  e8 5c 03 00 00       	call   16c9 <bench::now_ns()>
+            int const key = int(next_rand(seed) % (2 * n));
+    136d:	|  |                  48 8d 4c 24 34       	lea    0x34(%rsp),%rcx
+    1372:	|  |                  48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    1377:	|  |  /-------------> 48 89 cf             	mov    %rcx,%rdi
+    if (n == 0) { return 0; }
+    137a:	|  |  |               31 d2                	xor    %edx,%edx
+    137c:	|  |  |               e8 b9 02 00 00       	call   163a <next_rand(unsigned int&)>
+            return len_;
+    1381:	|  |  |               48 8b 74 24 50       	mov    0x50(%rsp),%rsi
+    1386:	|  |  |               48 85 f6             	test   %rsi,%rsi
+    1389:	|  |  |  /----------- 74 6c                	je     13f7 <main+0x2b5>
+    138b:	|  |  |  |            89 c0                	mov    %eax,%eax
+    138d:	|  |  |  |            31 d2                	xor    %edx,%edx
+    138f:	|  |  |  |            48 f7 74 24 20       	divq   0x20(%rsp)
+    T const *b = p;
+    1394:	|  |  |  |            4c 89 e8             	mov    %r13,%rax
+    1397:	|  |  |  |            41 89 d1             	mov    %edx,%r9d
+    while (n > 1) {
+    139a:	|  |  |  |  /-------> 48 83 fe 01          	cmp    $0x1,%rsi
+    139e:	|  |  |  |  |  /----- 76 45                	jbe    13e5 <main+0x2a3>
+        Length const h = n / 2;
+    13a0:	|  |  |  |  |  |      49 89 f0             	mov    %rsi,%r8
+    13a3:	|  |  |  |  |  |      49 d1 e8             	shr    %r8
+        if (h * sizeof(T) > prefetch_bytes) {
+    13a6:	|  |  |  |  |  |      4a 8d 3c 85 00 00 00 	lea    0x0(,%r8,4),%rdi
+    13ad:	|  |  |  |  |  |      00 
+    13ae:	|  |  |  |  |  |      48 81 ff 00 01 00 00 	cmp    $0x100,%rdi
+    13b5:	|  |  |  |  |  |  /-- 76 1b                	jbe    13d2 <main+0x290>
+                reinterpret_cast<void const *>(uintptr_t(b) + (h / 2) * sizeof(T)));
+    13b7:	|  |  |  |  |  |  |   49 89 f2             	mov    %rsi,%r10
+    13ba:	|  |  |  |  |  |  |   49 83 e2 fc          	and    $0xfffffffffffffffc,%r10
+            __builtin_prefetch(
+    13be:	|  |  |  |  |  |  |   42 0f 18 0c 10       	prefetcht0 (%rax,%r10,1)
+                reinterpret_cast<void const *>(uintptr_t(b) + (h / 2) * sizeof(T)));
+    13c3:	|  |  |  |  |  |  |   49 89 f2             	mov    %rsi,%r10
+    13c6:	|  |  |  |  |  |  |   49 c1 ea 02          	shr    $0x2,%r10
+                reinterpret_cast<void const *>(uintptr_t(b) + (h + h / 2) * sizeof(T)));
+    13ca:	|  |  |  |  |  |  |   4d 01 c2             	add    %r8,%r10
+            __builtin_prefetch(
+    13cd:	|  |  |  |  |  |  |   42 0f 18 0c 90       	prefetcht0 (%rax,%r10,4)
+        b = pred(b[h]) ? b + h : b;
+    13d2:	|  |  |  |  |  |  \-> 48 01 c7             	add    %rax,%rdi
+    13d5:	|  |  |  |  |  |      44 3b 0f             	cmp    (%rdi),%r9d
+    13d8:	|  |  |  |  |  |  /-- 7f 03                	jg     13dd <main+0x29b>
+    13da:	|  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+        n -= h;
+    13dd:	|  |  |  |  |  |  \-> 4c 29 c6             	sub    %r8,%rsi
+        b = pred(b[h]) ? b + h : b;
+    13e0:	|  |  |  |  |  |      48 89 f8             	mov    %rdi,%rax
+    13e3:	|  |  |  |  \--|----- eb b5                	jmp    139a <main+0x258>
+    return Index(b - p) + (pred(*b) ? 1 : 0);
+    13e5:	|  |  |  |     \----> 3b 10                	cmp    (%rax),%edx
+    13e7:	|  |  |  |            0f 9f c2             	setg   %dl
+    13ea:	|  |  |  |            4c 29 e8             	sub    %r13,%rax
+    13ed:	|  |  |  |            0f b6 d2             	movzbl %dl,%edx
+    13f0:	|  |  |  |            48 c1 f8 02          	sar    $0x2,%rax
+    13f4:	|  |  |  |            48 01 c2             	add    %rax,%rdx
+            r += f(key);
+    13f7:	|  |  |  \----------> 49 01 d7             	add    %rdx,%r15
+        for (nel::Index i = 0; i < n_lookups; ++i) {
+    13fa:	|  |  |               48 ff cd             	dec    %rbp
+    13fd:	|  |  \-------------- 0f 85 74 ff ff ff    	jne    1377 <main+0x235>
+    return now_ns() - b;
+    1403:	|  |                  e8 c1 02 00 00       	call   16c9 <bench::now_ns()>
+    sink = sink + r;
+    1408:	|  |                  48 8b 15 61 2c 00 00 	mov    0x2c61(%rip),%rdx        # 4070 <sink>
+    140f:	|  |                  48 8b 4c 24 28       	mov    0x28(%rsp),%rcx
+    bench::report_per_item(name, t, n_lookups);
+    1414:	|  |                  48 8d 3d a0 0c 00 00 	lea    0xca0(%rip),%rdi        # 20bb <_IO_stdin_used+0xbb>
+    141b:	|  |                  48 29 c8             	sub    %rcx,%rax
+    sink = sink + r;
+    141e:	|  |                  4c 01 fa             	add    %r15,%rdx
+    1421:	|  |                  48 89 c6             	mov    %rax,%rsi
+    1424:	|  |                  48 89 15 45 2c 00 00 	mov    %rdx,0x2c45(%rip)        # 4070 <sink>
+    bench::report_per_item(name, t, n_lookups);
+    142b:	|  |                  ba 00 09 3d 00       	mov    $0x3d0900,%edx
+    1430:	|  |                  e8 b7 02 00 00       	call   16ec <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    unsigned int seed = 0x9e3779b9;
+    1435:	|  |                  c7 44 24 34 b9 79 37 	movl   $0x9e3779b9,0x34(%rsp)
+    143c:	|  |                  9e 
+    long unsigned int const b = now_ns();
+    143d:	|  |                  e8 87 02 00 00       	call   16c9 <bench::now_ns()>
+    1442:	|  |                  be 00 09 3d 00       	mov    $0x3d0900,%esi
+    1447:	|  |                  49 89 c5             	mov    %rax,%r13
+            int const key = int(next_rand(seed) % (2 * n));
+    144a:	|  |        /-------> 48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    144f:	|  |        |         31 d2                	xor    %edx,%edx
+    // Addresses computed as ints, a prefetch past the end is harmless.
+    constexpr Length ahead = 16;
+    Index i = 1;
+    while (i <= n) {
+        __builtin_prefetch(
+            reinterpret_cast<void const *>(uintptr_t(e) + (ahead * i - 1) * sizeof(T)));
+    1451:	|  |        |         49 8d 4e fc          	lea    -0x4(%r14),%rcx
+    1455:	|  |        |         e8 e0 01 00 00       	call   163a <next_rand(unsigned int&)>
+    145a:	|  |        |         89 c0                	mov    %eax,%eax
+    145c:	|  |        |         48 f7 74 24 20       	divq   0x20(%rsp)
+    Index i = 1;
+    1461:	|  |        |         b8 01 00 00 00       	mov    $0x1,%eax
+    while (i <= n) {
+    1466:	|  |        |  /----> 48 39 c3             	cmp    %rax,%rbx
+    1469:	|  |        |  |  /-- 72 1f                	jb     148a <main+0x348>
+            reinterpret_cast<void const *>(uintptr_t(e) + (ahead * i - 1) * sizeof(T)));
+    146b:	|  |        |  |  |   48 89 c7             	mov    %rax,%rdi
+    146e:	|  |        |  |  |   48 c1 e7 06          	shl    $0x6,%rdi
+        i = 2 * i + (less(e[i - 1], key) ? 1 : 0);
+    1472:	|  |        |  |  |   41 3b 54 86 fc       	cmp    -0x4(%r14,%rax,4),%edx
+        __builtin_prefetch(
+    1477:	|  |        |  |  |   0f 18 0c 39          	prefetcht0 (%rcx,%rdi,1)
+        i = 2 * i + (less(e[i - 1], key) ? 1 : 0);
+    147b:	|  |        |  |  |   48 8d 3c 00          	lea    (%rax,%rax,1),%rdi
+    147f:	|  |        |  |  |   0f 9f c0             	setg   %al
+    1482:	|  |        |  |  |   0f b6 c0             	movzbl %al,%eax
+    1485:	|  |        |  |  |   48 01 f8             	add    %rdi,%rax
+    1488:	|  |        |  \--|-- eb dc                	jmp    1466 <main+0x324>
+    }
+    // The trailing 1s of i are the steps right (less) after the last step left,
+    // which was at the answer.
+    i >>= __builtin_ffsll((long long)(~i));
+    148a:	|  |        |     \-> 48 89 c1             	mov    %rax,%rcx
+    148d:	|  |        |         48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+    1494:	|  |        |         48 f7 d1             	not    %rcx
+    1497:	|  |        |         48 0f bc c9          	bsf    %rcx,%rcx
+    149b:	|  |        |         48 0f 44 ca          	cmove  %rdx,%rcx
+    149f:	|  |        |         48 89 da             	mov    %rbx,%rdx
+    14a2:	|  |        |         48 ff c1             	inc    %rcx
+    14a5:	|  |        |         48 d3 e8             	shr    %cl,%rax
+    return (i == 0) ? n : i - 1;
+    14a8:	|  |        |         48 85 c0             	test   %rax,%rax
+    14ab:	|  |        |     /-- 74 04                	je     14b1 <main+0x36f>
+    14ad:	|  |        |     |   48 8d 50 ff          	lea    -0x1(%rax),%rdx
+            r += f(key);
+    14b1:	|  |        |     \-> 48 01 d5             	add    %rdx,%rbp
+        for (nel::Index i = 0; i < n_lookups; ++i) {
+    14b4:	|  |        |         48 ff ce             	dec    %rsi
+    14b7:	|  |        \-------- 75 91                	jne    144a <main+0x308>
+    return now_ns() - b;
+    14b9:	|  |                  e8 0b 02 00 00       	call   16c9 <bench::now_ns()>
+    sink = sink + r;
+    14be:	|  |                  48 8b 15 ab 2b 00 00 	mov    0x2bab(%rip),%rdx        # 4070 <sink>
+    bench::report_per_item(name, t, n_lookups);
+    14c5:	|  |                  48 8d 3d 04 0c 00 00 	lea    0xc04(%rip),%rdi        # 20d0 <_IO_stdin_used+0xd0>
+    for (nel::Length const n: sizes) {
+    14cc:	|  |                  49 83 c4 08          	add    $0x8,%r12
+    14d0:	|  |                  4c 29 e8             	sub    %r13,%rax
+    sink = sink + r;
+    14d3:	|  |                  48 01 ea             	add    %rbp,%rdx
+    14d6:	|  |                  48 89 c6             	mov    %rax,%rsi
+    14d9:	|  |                  48 89 15 90 2b 00 00 	mov    %rdx,0x2b90(%rip)        # 4070 <sink>
+    bench::report_per_item(name, t, n_lookups);
+    14e0:	|  |                  ba 00 09 3d 00       	mov    $0x3d0900,%edx
+    14e5:	|  |                  e8 02 02 00 00       	call   16ec <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    for (nel::Length const n: sizes) {
+    14ea:	\--|----------------- e9 4d fd ff ff       	jmp    123c <main+0xfa>
+        });
+        run("  eytzinger         ", n, [&e, &less, n](int const key) -> nel::Index {
+            return nel::search::eytzinger_lower_bound(e.ptr(), n, key, less);
+        });
+    }
+    nel::log << "sink: " << (long unsigned int)sink << '\n';
+    14ef:	   \----------------> 48 8d 35 ef 0b 00 00 	lea    0xbef(%rip),%rsi        # 20e5 <_IO_stdin_used+0xe5>
+    14f6:	                      48 89 ef             	mov    %rbp,%rdi
+    14f9:	                      e8 90 05 00 00       	call   1a8e <nel::operator<<(nel::Log&, char const*)>
+    14fe:	                      48 8b 35 6b 2b 00 00 	mov    0x2b6b(%rip),%rsi        # 4070 <sink>
+    1505:	                      48 89 c7             	mov    %rax,%rdi
+    1508:	                      e8 1c 06 00 00       	call   1b29 <nel::operator<<(nel::Log&, unsigned long)>
+    150d:	                      be 0a 00 00 00       	mov    $0xa,%esi
+    1512:	                      48 89 c7             	mov    %rax,%rdi
+    1515:	                      e8 5b 05 00 00       	call   1a75 <nel::operator<<(nel::Log&, char)>
+        // Make own using the allocator's malloc/free.
+        // But, can use realloc for better growing..
+        // Alignment is handled by the allocator, alignof(Node) includes values_align.
+        static void free(Node *old)
+        {
+            if (old == nullptr) { return; }
+    151a:	                      4d 85 f6             	test   %r14,%r14
+    151d:	                  /-- 74 08                	je     1527 <main+0x3e5>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    151f:	                  |   4c 89 f7             	mov    %r14,%rdi
+    1522:	                  |   e8 09 fb ff ff       	call   1030 <free@plt>
+    1527:	                  \-> 4d 85 ed             	test   %r13,%r13
+    152a:	                  /-- 74 08                	je     1534 <main+0x3f2>
+    152c:	                  |   4c 89 ef             	mov    %r13,%rdi
+    152f:	                  |   e8 fc fa ff ff       	call   1030 <free@plt>
+}
+    1534:	                  \-> 48 83 c4 78          	add    $0x78,%rsp
+    1538:	                      31 c0                	xor    %eax,%eax
+    153a:	                      5b                   	pop    %rbx
+    153b:	                      5d                   	pop    %rbp
+    153c:	                      41 5c                	pop    %r12
+    153e:	                      41 5d                	pop    %r13
+    1540:	                      41 5e                	pop    %r14
+    1542:	                      41 5f                	pop    %r15
+    1544:	                      c3                   	ret
+    1545:	                      66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    154c:	                      00 00 00 
+    154f:	                      90                   	nop
+
+0000000000001550 <_start>:
+    1550:	31 ed                	xor    %ebp,%ebp
+    1552:	49 89 d1             	mov    %rdx,%r9
+    1555:	5e                   	pop    %rsi
+    1556:	48 89 e2             	mov    %rsp,%rdx
+    1559:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    155d:	50                   	push   %rax
+    155e:	54                   	push   %rsp
+    155f:	45 31 c0             	xor    %r8d,%r8d
+    1562:	31 c9                	xor    %ecx,%ecx
+    1564:	48 8d 3d d7 fb ff ff 	lea    -0x429(%rip),%rdi        # 1142 <main>
+    156b:	ff 15 4f 2a 00 00    	call   *0x2a4f(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    1571:	f4                   	hlt
+    1572:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1579:	00 00 00 
+    157c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001580 <deregister_tm_clones>:
+    1580:	    48 8d 3d c1 2a 00 00 	lea    0x2ac1(%rip),%rdi        # 4048 <__TMC_END__>
+    1587:	    48 8d 05 ba 2a 00 00 	lea    0x2aba(%rip),%rax        # 4048 <__TMC_END__>
+    158e:	    48 39 f8             	cmp    %rdi,%rax
+    1591:	/-- 74 15                	je     15a8 <deregister_tm_clones+0x28>
+    1593:	|   48 8b 05 2e 2a 00 00 	mov    0x2a2e(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    159a:	|   48 85 c0             	test   %rax,%rax
+    159d:	+-- 74 09                	je     15a8 <deregister_tm_clones+0x28>
+    159f:	|   ff e0                	jmp    *%rax
+    15a1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    15a8:	\-> c3                   	ret
+    15a9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000015b0 <register_tm_clones>:
+    15b0:	    48 8d 3d 91 2a 00 00 	lea    0x2a91(%rip),%rdi        # 4048 <__TMC_END__>
+    15b7:	    48 8d 35 8a 2a 00 00 	lea    0x2a8a(%rip),%rsi        # 4048 <__TMC_END__>
+    15be:	    48 29 fe             	sub    %rdi,%rsi
+    15c1:	    48 89 f0             	mov    %rsi,%rax
+    15c4:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    15c8:	    48 c1 f8 03          	sar    $0x3,%rax
+    15cc:	    48 01 c6             	add    %rax,%rsi
+    15cf:	    48 d1 fe             	sar    %rsi
+    15d2:	/-- 74 14                	je     15e8 <register_tm_clones+0x38>
+    15d4:	|   48 8b 05 fd 29 00 00 	mov    0x29fd(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    15db:	|   48 85 c0             	test   %rax,%rax
+    15de:	+-- 74 08                	je     15e8 <register_tm_clones+0x38>
+    15e0:	|   ff e0                	jmp    *%rax
+    15e2:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    15e8:	\-> c3                   	ret
+    15e9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000015f0 <__do_global_dtors_aux>:
+    15f0:	       f3 0f 1e fa          	endbr64
+    15f4:	       80 3d 6d 2a 00 00 00 	cmpb   $0x0,0x2a6d(%rip)        # 4068 <completed.0>
+    15fb:	/----- 75 2b                	jne    1628 <__do_global_dtors_aux+0x38>
+    15fd:	|      55                   	push   %rbp
+    15fe:	|      48 83 3d da 29 00 00 	cmpq   $0x0,0x29da(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1605:	|      00 
+    1606:	|      48 89 e5             	mov    %rsp,%rbp
+    1609:	|  /-- 74 0c                	je     1617 <__do_global_dtors_aux+0x27>
+    160b:	|  |   48 8b 3d 2e 2a 00 00 	mov    0x2a2e(%rip),%rdi        # 4040 <__dso_handle>
+    1612:	|  |   e8 89 fa ff ff       	call   10a0 <__cxa_finalize@plt>
+    1617:	|  \-> e8 64 ff ff ff       	call   1580 <deregister_tm_clones>
+    161c:	|      c6 05 45 2a 00 00 01 	movb   $0x1,0x2a45(%rip)        # 4068 <completed.0>
+    1623:	|      5d                   	pop    %rbp
+    1624:	|      c3                   	ret
+    1625:	|      0f 1f 00             	nopl   (%rax)
+    1628:	\----> c3                   	ret
+    1629:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001630 <frame_dummy>:
+    1630:	f3 0f 1e fa          	endbr64
+    1634:	e9 77 ff ff ff       	jmp    15b0 <register_tm_clones>
+    1639:	90                   	nop
+
+000000000000163a <next_rand(unsigned int&)>:
+    s ^= s << 13;
+    163a:	66 0f 6e 0f          	movd   (%rdi),%xmm1
+    163e:	0f 28 d1             	movaps %xmm1,%xmm2
+    1641:	66 0f 72 f2 0d       	pslld  $0xd,%xmm2
+    1646:	0f 28 c2             	movaps %xmm2,%xmm0
+    1649:	0f 57 c1             	xorps  %xmm1,%xmm0
+    s ^= s >> 17;
+    164c:	0f 28 d8             	movaps %xmm0,%xmm3
+    164f:	66 0f 72 d3 11       	psrld  $0x11,%xmm3
+    1654:	0f 28 cb             	movaps %xmm3,%xmm1
+    1657:	0f 57 c8             	xorps  %xmm0,%xmm1
+    s ^= s << 5;
+    165a:	0f 28 e1             	movaps %xmm1,%xmm4
+    165d:	66 0f 72 f4 05       	pslld  $0x5,%xmm4
+    1662:	0f 28 c4             	movaps %xmm4,%xmm0
+    1665:	0f 57 c1             	xorps  %xmm1,%xmm0
+    1668:	66 0f 7e c0          	movd   %xmm0,%eax
+    166c:	66 0f 7e 07          	movd   %xmm0,(%rdi)
+}
+    1670:	c3                   	ret
+    1671:	90                   	nop
+
+0000000000001672 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice(unsigned long, unsigned long) [clone .isra.0]>:
+         * @returns if b&e >= vec len, return empty slice
+         * @returns if b >= vec len, return empty slice
+         * @returns if e > vec len, clamp to last elem.
+         * @returns else return slice over region b..e of vec.
+         */
+        constexpr Slice<Type> slice(Index b, Index e)
+    1672:	       48 89 f8             	mov    %rdi,%rax
+            return (item_ == nullptr) ? Slice<Type>::empty() : item_->slice();
+    1675:	       48 85 f6             	test   %rsi,%rsi
+    1678:	/----- 74 0e                	je     1688 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice(unsigned long, unsigned long) [clone .isra.0]+0x16>
+         * @returns if e > array len, clamp to last elem.
+         * @returns else return slice over region b..e of slice.
+         */
+        Slice slice(Index b, Index e) const
+        {
+            if (b >= e) { return Slice::empty(); }
+    167a:	|      48 39 ca             	cmp    %rcx,%rdx
+    167d:	+----- 73 09                	jae    1688 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice(unsigned long, unsigned long) [clone .isra.0]+0x16>
+            return alloc_;
+        }
+
+        constexpr Length len(void) const
+        {
+            return len_;
+    167f:	|      48 8b 7e 08          	mov    0x8(%rsi),%rdi
+            if (b >= len_) { return Slice::empty(); }
+    1683:	|      48 39 fa             	cmp    %rdi,%rdx
+    1686:	|  /-- 72 0a                	jb     1692 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::slice(unsigned long, unsigned long) [clone .isra.0]+0x20>
+            , len_(0)
+    1688:	\--|-> 31 d2                	xor    %edx,%edx
+    168a:	   |   48 89 10             	mov    %rdx,(%rax)
+    168d:	   |   48 89 50 08          	mov    %rdx,0x8(%rax)
+            return Slice();
+    1691:	   |   c3                   	ret
+            if (e > len_) { e = len_; }
+            return Slice(&content_[b], e - b);
+    1692:	   \-> 48 39 f9             	cmp    %rdi,%rcx
+    1695:	       48 8d 74 96 10       	lea    0x10(%rsi,%rdx,4),%rsi
+    169a:	       48 0f 47 cf          	cmova  %rdi,%rcx
+    169e:	       48 89 30             	mov    %rsi,(%rax)
+    16a1:	       48 29 d1             	sub    %rdx,%rcx
+    16a4:	       48 89 48 08          	mov    %rcx,0x8(%rax)
+        {
+            return slice().slice(b, e);
+        }
+    16a8:	       c3                   	ret
+
+00000000000016a9 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    16a9:	83 c8 ff             	or     $0xffffffff,%eax
+    16ac:	c3                   	ret
+
+00000000000016ad <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    16ad:	83 c8 ff             	or     $0xffffffff,%eax
+    16b0:	c3                   	ret
+
+00000000000016b1 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    16b1:	83 c8 ff             	or     $0xffffffff,%eax
+    16b4:	c3                   	ret
+
+00000000000016b5 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    16b5:	83 c8 ff             	or     $0xffffffff,%eax
+    16b8:	c3                   	ret
+
+00000000000016b9 <_read_r>:
+int _read_r(struct _reent *, int) {
+    16b9:	83 c8 ff             	or     $0xffffffff,%eax
+    16bc:	c3                   	ret
+
+00000000000016bd <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    16bd:	83 c8 ff             	or     $0xffffffff,%eax
+    16c0:	c3                   	ret
+
+00000000000016c1 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    16c1:	83 c8 ff             	or     $0xffffffff,%eax
+    16c4:	c3                   	ret
+
+00000000000016c5 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    16c5:	83 c8 ff             	or     $0xffffffff,%eax
+    16c8:	c3                   	ret
+
+00000000000016c9 <bench::now_ns()>:
+{
+    16c9:	48 83 ec 18          	sub    $0x18,%rsp
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    16cd:	bf 01 00 00 00       	mov    $0x1,%edi
+    16d2:	48 89 e6             	mov    %rsp,%rsi
+    16d5:	e8 76 f9 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    16da:	48 69 04 24 00 ca 9a 	imul   $0x3b9aca00,(%rsp),%rax
+    16e1:	3b 
+    16e2:	48 03 44 24 08       	add    0x8(%rsp),%rax
+}
+    16e7:	48 83 c4 18          	add    $0x18,%rsp
+    16eb:	c3                   	ret
+
+00000000000016ec <bench::report_per_item(char const*, unsigned long, unsigned long)>:
+}
+
+// Log a result line: name, and time per item in ns (to 2 decimal places).
+inline void report_per_item(char const *const name, long unsigned int const ns,
+                            long unsigned int const items)
+{
+    16ec:	    41 56                	push   %r14
+    16ee:	    53                   	push   %rbx
+    16ef:	    51                   	push   %rcx
+    16f0:	    48 89 d1             	mov    %rdx,%rcx
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    16f3:	    48 85 d2             	test   %rdx,%rdx
+    16f6:	/-- 74 0c                	je     1704 <bench::report_per_item(char const*, unsigned long, unsigned long)+0x18>
+    16f8:	|   48 6b c6 64          	imul   $0x64,%rsi,%rax
+    16fc:	|   31 d2                	xor    %edx,%edx
+    16fe:	|   48 f7 f1             	div    %rcx
+    1701:	|   48 89 c1             	mov    %rax,%rcx
+    long unsigned int const frac = cns % 100UL;
+    1704:	\-> 48 89 c8             	mov    %rcx,%rax
+    1707:	    bb 64 00 00 00       	mov    $0x64,%ebx
+    170c:	    31 d2                	xor    %edx,%edx
+    nel::log << name << ": " << cns / 100UL << '.' << (frac < 10 ? "0" : "") << frac
+             << "ns/item\n";
+    170e:	    48 89 fe             	mov    %rdi,%rsi
+    long unsigned int const frac = cns % 100UL;
+    1711:	    48 f7 f3             	div    %rbx
+             << "ns/item\n";
+    1714:	    48 8d 3d 5d 29 00 00 	lea    0x295d(%rip),%rdi        # 4078 <nel::log>
+    long unsigned int const frac = cns % 100UL;
+    171b:	    48 89 d3             	mov    %rdx,%rbx
+    171e:	    49 89 c6             	mov    %rax,%r14
+             << "ns/item\n";
+    1721:	    e8 68 03 00 00       	call   1a8e <nel::operator<<(nel::Log&, char const*)>
+    1726:	    48 8d 35 bc 09 00 00 	lea    0x9bc(%rip),%rsi        # 20e9 <_IO_stdin_used+0xe9>
+    172d:	    48 89 c7             	mov    %rax,%rdi
+    1730:	    e8 59 03 00 00       	call   1a8e <nel::operator<<(nel::Log&, char const*)>
+    1735:	    4c 89 f6             	mov    %r14,%rsi
+    1738:	    48 89 c7             	mov    %rax,%rdi
+    173b:	    e8 e9 03 00 00       	call   1b29 <nel::operator<<(nel::Log&, unsigned long)>
+    1740:	    be 2e 00 00 00       	mov    $0x2e,%esi
+    1745:	    48 89 c7             	mov    %rax,%rdi
+    1748:	    e8 28 03 00 00       	call   1a75 <nel::operator<<(nel::Log&, char)>
+    174d:	    48 83 fb 0a          	cmp    $0xa,%rbx
+    1751:	    48 8d 35 ac 08 00 00 	lea    0x8ac(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    1758:	    48 89 c7             	mov    %rax,%rdi
+    175b:	    48 8d 05 ac 08 00 00 	lea    0x8ac(%rip),%rax        # 200e <_IO_stdin_used+0xe>
+    1762:	    48 0f 43 f0          	cmovae %rax,%rsi
+    1766:	    e8 23 03 00 00       	call   1a8e <nel::operator<<(nel::Log&, char const*)>
+    176b:	    48 89 de             	mov    %rbx,%rsi
+    176e:	    48 89 c7             	mov    %rax,%rdi
+    1771:	    e8 b3 03 00 00       	call   1b29 <nel::operator<<(nel::Log&, unsigned long)>
+    1776:	    48 8d 35 89 08 00 00 	lea    0x889(%rip),%rsi        # 2006 <_IO_stdin_used+0x6>
+    177d:	    48 89 c7             	mov    %rax,%rdi
+}
+    1780:	    58                   	pop    %rax
+    1781:	    5b                   	pop    %rbx
+    1782:	    41 5e                	pop    %r14
+             << "ns/item\n";
+    1784:	    e9 05 03 00 00       	jmp    1a8e <nel::operator<<(nel::Log&, char const*)>
+    1789:	    90                   	nop
+
+000000000000178a <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+        };
+
+    public:
+        constexpr ~Result(void)
+        {
+            switch (tag_) { // result::dtor
+    178a:	    83 3f 02             	cmpl   $0x2,(%rdi)
+    178d:	/-- 76 35                	jbe    17c4 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x3a>
+        constexpr ~Result(void)
+    178f:	|   48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    1793:	|   48 8d 05 75 08 00 00 	lea    0x875(%rip),%rax        # 200f <_IO_stdin_used+0xf>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    179a:	|   48 8d 3d 88 08 00 00 	lea    0x888(%rip),%rdi        # 2029 <_IO_stdin_used+0x29>
+    17a1:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    17a6:	|   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    17ab:	|   48 8d 05 65 08 00 00 	lea    0x865(%rip),%rax        # 2017 <_IO_stdin_used+0x17>
+    17b2:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    17b7:	|   c7 44 24 18 72 00 00 	movl   $0x72,0x18(%rsp)
+    17be:	|   00 
+    17bf:	|   e8 1e f9 ff ff       	call   10e2 <nel::panic(char const*, nel::Context const&)>
+    17c4:	\-> c3                   	ret
+    17c5:	    90                   	nop
+
+00000000000017c6 <nel::Result<void, int>::~Result()>:
+        };
+
+    public:
+        constexpr ~Result(void)
+        {
+            switch (tag_) { // result<void>-dtor
+    17c6:	    83 3f 02             	cmpl   $0x2,(%rdi)
+    17c9:	/-- 76 35                	jbe    1800 <nel::Result<void, int>::~Result()+0x3a>
+        constexpr ~Result(void)
+    17cb:	|   48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    17cf:	|   48 8d 05 39 08 00 00 	lea    0x839(%rip),%rax        # 200f <_IO_stdin_used+0xf>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    17d6:	|   48 8d 3d 4c 08 00 00 	lea    0x84c(%rip),%rdi        # 2029 <_IO_stdin_used+0x29>
+    17dd:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    17e2:	|   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    17e7:	|   48 8d 05 29 08 00 00 	lea    0x829(%rip),%rax        # 2017 <_IO_stdin_used+0x17>
+    17ee:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    17f3:	|   c7 44 24 18 dd 02 00 	movl   $0x2dd,0x18(%rsp)
+    17fa:	|   00 
+    17fb:	|   e8 e2 f8 ff ff       	call   10e2 <nel::panic(char const*, nel::Context const&)>
+    1800:	\-> c3                   	ret
+    1801:	    90                   	nop
+
+0000000000001802 <nel::Result<void, int>::unwrap(nel::Context const&)>:
+        }
+
+        template<typename Fn1, typename Fn2>
+        constexpr void consumev(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+        {
+            auto tag = tag_;
+    1802:	          8b 07                	mov    (%rdi),%eax
+            tag_ = Tag::INVAL;
+    1804:	          31 d2                	xor    %edx,%edx
+    1806:	          89 17                	mov    %edx,(%rdi)
+            switch (tag) { // result<void>-consume
+    1808:	          83 f8 01             	cmp    $0x1,%eax
+    180b:	/-------- 74 56                	je     1863 <nel::Result<void, int>::unwrap(nel::Context const&)+0x61>
+         * @return if Ok, value wrapped/contained.
+         * @return if not Ok, calls abort, there is no return.
+         *
+         * `this` is consumed by the operation.
+         */
+        constexpr void unwrap(Context const &ctx = Context())
+    180d:	|         48 83 ec 28          	sub    $0x28,%rsp
+            switch (tag) { // result<void>-consume
+    1811:	|         83 f8 02             	cmp    $0x2,%eax
+    1814:	|     /-- 74 10                	je     1826 <nel::Result<void, int>::unwrap(nel::Context const&)+0x24>
+    1816:	|     |   85 c0                	test   %eax,%eax
+    1818:	|  /--|-- 75 3d                	jne    1857 <nel::Result<void, int>::unwrap(nel::Context const&)+0x55>
+                    nel::panic("invalid Result", ctx);
+    181a:	|  |  |   48 8d 3d 28 08 00 00 	lea    0x828(%rip),%rdi        # 2049 <_IO_stdin_used+0x49>
+    1821:	|  |  |   e8 bc f8 ff ff       	call   10e2 <nel::panic(char const*, nel::Context const&)>
+            : fn_name_(fn_name)
+    1826:	|  |  \-> 48 8d 05 07 08 00 00 	lea    0x807(%rip),%rax        # 2034 <_IO_stdin_used+0x34>
+        {
+            return consumev([](void) {}, [](E &&) { nel::panic("not an ok"); }, ctx);
+    182d:	|  |      48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , line_num_(line_num)
+    1832:	|  |      c7 44 24 18 1f 04 00 	movl   $0x41f,0x18(%rsp)
+    1839:	|  |      00 
+            : fn_name_(fn_name)
+    183a:	|  |      48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    183f:	|  |      48 8d 3d f9 07 00 00 	lea    0x7f9(%rip),%rdi        # 203f <_IO_stdin_used+0x3f>
+            , file_name_(file_name)
+    1846:	|  |      48 8d 05 ca 07 00 00 	lea    0x7ca(%rip),%rax        # 2017 <_IO_stdin_used+0x17>
+    184d:	|  |      48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    1852:	|  |      e8 8b f8 ff ff       	call   10e2 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    1857:	|  \----> 48 8d 3d cb 07 00 00 	lea    0x7cb(%rip),%rdi        # 2029 <_IO_stdin_used+0x29>
+    185e:	|         e8 7f f8 ff ff       	call   10e2 <nel::panic(char const*, nel::Context const&)>
+    1863:	\-------> c3                   	ret
+
+0000000000001864 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)>:
+Index eytzinger_fill(T dst[], T const src[], Length const n, Index const i, Index k)
+    1864:	      /-> 41 56                	push   %r14
+    1866:	      |   49 89 f6             	mov    %rsi,%r14
+    1869:	      |   41 55                	push   %r13
+    186b:	      |   49 89 fd             	mov    %rdi,%r13
+    186e:	      |   41 54                	push   %r12
+    1870:	      |   55                   	push   %rbp
+    1871:	      |   48 89 d5             	mov    %rdx,%rbp
+    1874:	      |   53                   	push   %rbx
+    1875:	      |   48 89 cb             	mov    %rcx,%rbx
+    if (i <= n) {
+    1878:	/-----|-> 48 39 dd             	cmp    %rbx,%rbp
+    187b:	|  /--|-- 72 29                	jb     18a6 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0x42>
+        k = eytzinger_fill(dst, src, n, 2 * i, k);
+    187d:	|  |  |   4c 8d 24 1b          	lea    (%rbx,%rbx,1),%r12
+    1881:	|  |  |   48 89 ea             	mov    %rbp,%rdx
+    1884:	|  |  |   4c 89 f6             	mov    %r14,%rsi
+    1887:	|  |  |   4c 89 ef             	mov    %r13,%rdi
+    188a:	|  |  |   4c 89 e1             	mov    %r12,%rcx
+    188d:	|  |  \-- e8 d2 ff ff ff       	call   1864 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)>
+        dst[i - 1] = src[k];
+    1892:	|  |      41 8b 14 86          	mov    (%r14,%rax,4),%edx
+        k += 1;
+    1896:	|  |      4c 8d 40 01          	lea    0x1(%rax),%r8
+        dst[i - 1] = src[k];
+    189a:	|  |      41 89 54 9d fc       	mov    %edx,-0x4(%r13,%rbx,4)
+        k = eytzinger_fill(dst, src, n, 2 * i + 1, k);
+    189f:	|  |      49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+    18a4:	\--|----- eb d2                	jmp    1878 <unsigned long nel::search::eytzinger_fill<int>(int*, int const*, unsigned long, unsigned long, unsigned long)+0x14>
+}
+    18a6:	   \----> 5b                   	pop    %rbx
+    18a7:	          4c 89 c0             	mov    %r8,%rax
+    18aa:	          5d                   	pop    %rbp
+    18ab:	          41 5c                	pop    %r12
+    18ad:	          41 5d                	pop    %r13
+    18af:	          41 5e                	pop    %r14
+    18b1:	          c3                   	ret
+
+00000000000018b2 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>:
+            if (new_cap > max_capacity) { return nullptr; }
+    18b2:	             48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    18b9:	             ff ff 1f 
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    18bc:	             55                   	push   %rbp
+    18bd:	             53                   	push   %rbx
+    18be:	             48 83 ec 38          	sub    $0x38,%rsp
+            if (new_cap > max_capacity) { return nullptr; }
+    18c2:	             48 39 f0             	cmp    %rsi,%rax
+    18c5:	/----------- 0f 82 9e 00 00 00    	jb     1969 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0xb7>
+    18cb:	|            48 89 f3             	mov    %rsi,%rbx
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    18ce:	|            48 8d 34 b5 14 00 00 	lea    0x14(,%rsi,4),%rsi
+    18d5:	|            00 
+                                    : std::realloc(p, new_size);
+    18d6:	|            e8 b5 f7 ff ff       	call   1090 <realloc@plt>
+            if (new_p == nullptr) {
+    18db:	|            48 85 c0             	test   %rax,%rax
+    18de:	|     /----- 75 12                	jne    18f2 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x40>
+            : tag_(Tag::ERR)
+    18e0:	|     |      c7 44 24 08 02 00 00 	movl   $0x2,0x8(%rsp)
+    18e7:	|     |      00 
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+            : value_(forward<Type>(val))
+    18e8:	|     |      c7 44 24 10 01 00 00 	movl   $0x1,0x10(%rsp)
+    18ef:	|     |      00 
+    18f0:	|     |  /-- eb 0d                	jmp    18ff <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x4d>
+            : tag_(Tag::OK)
+    18f2:	|     \--|-> c7 44 24 08 01 00 00 	movl   $0x1,0x8(%rsp)
+    18f9:	|        |   00 
+        {
+        }
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+            : value_(forward<Args>(args)...)
+    18fa:	|        |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            : fn_name_(fn_name)
+    18ff:	|        \-> 48 8d 05 52 07 00 00 	lea    0x752(%rip),%rax        # 2058 <_IO_stdin_used+0x58>
+            , line_num_(line_num)
+    1906:	|            c7 44 24 28 89 00 00 	movl   $0x89,0x28(%rsp)
+    190d:	|            00 
+    190e:	|            48 8d 7c 24 08       	lea    0x8(%rsp),%rdi
+            : fn_name_(fn_name)
+    1913:	|            48 89 44 24 18       	mov    %rax,0x18(%rsp)
+            , file_name_(file_name)
+    1918:	|            48 8d 05 41 07 00 00 	lea    0x741(%rip),%rax        # 2060 <_IO_stdin_used+0x60>
+    191f:	|            48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    1924:	|            8b 44 24 08          	mov    0x8(%rsp),%eax
+            switch (tag_) { // result-match
+    1928:	|            83 f8 01             	cmp    $0x1,%eax
+    192b:	|     /----- 74 21                	je     194e <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x9c>
+    192d:	|     |      83 f8 02             	cmp    $0x2,%eax
+    1930:	|  /--|----- 74 32                	je     1964 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0xb2>
+    1932:	|  |  |      85 c0                	test   %eax,%eax
+                    nel::panic("invalid Result", ctx);
+    1934:	|  |  |      48 8d 3d 0e 07 00 00 	lea    0x70e(%rip),%rdi        # 2049 <_IO_stdin_used+0x49>
+    193b:	|  |  |      48 8d 74 24 18       	lea    0x18(%rsp),%rsi
+            switch (tag_) { // result-match
+    1940:	|  |  |  /-- 74 07                	je     1949 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x97>
+                    nel::panic("bad Result", ctx);
+    1942:	|  |  |  |   48 8d 3d e0 06 00 00 	lea    0x6e0(%rip),%rdi        # 2029 <_IO_stdin_used+0x29>
+    1949:	|  |  |  \-> e8 94 f7 ff ff       	call   10e2 <nel::panic(char const*, nel::Context const&)>
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    194e:	|  |  \----> 48 8b 6c 24 10       	mov    0x10(%rsp),%rbp
+            tag_ = Tag::INVAL;
+    1953:	|  |         31 c0                	xor    %eax,%eax
+    1955:	|  |         89 44 24 08          	mov    %eax,0x8(%rsp)
+            } else {
+    1959:	|  |         e8 2c fe ff ff       	call   178a <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+            new_n->alloc_ = new_cap;
+    195e:	|  |         48 89 5d 00          	mov    %rbx,0x0(%rbp)
+            return new_n;
+    1962:	|  |     /-- eb 07                	jmp    196b <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0xb9>
+            } else {
+    1964:	|  \-----|-> e8 21 fe ff ff       	call   178a <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+            if (new_cap > max_capacity) { return nullptr; }
+    1969:	\--------|-> 31 ed                	xor    %ebp,%ebp
+        }
+    196b:	         \-> 48 83 c4 38          	add    $0x38,%rsp
+    196f:	             48 89 e8             	mov    %rbp,%rax
+    1972:	             5b                   	pop    %rbx
+    1973:	             5d                   	pop    %rbp
+    1974:	             c3                   	ret
+
+0000000000001975 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>:
+        static constexpr Vector with_capacity(Count cap)
+    1975:	       53                   	push   %rbx
+    1976:	       48 89 fb             	mov    %rdi,%rbx
+            if (cap == 0) { return Vector(); }
+    1979:	       48 85 f6             	test   %rsi,%rsi
+    197c:	   /-- 75 07                	jne    1985 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x10>
+            : item_(nullptr)
+    197e:	   |   31 c9                	xor    %ecx,%ecx
+    1980:	   |   48 89 0f             	mov    %rcx,(%rdi)
+        }
+    1983:	/--|-- eb 15                	jmp    199a <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x25>
+            Node *new_n = realloc(nullptr, capacity);
+    1985:	|  \-> 31 ff                	xor    %edi,%edi
+    1987:	|      e8 26 ff ff ff       	call   18b2 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    198c:	|      48 85 c0             	test   %rax,%rax
+    198f:	|  /-- 74 06                	je     1997 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x22>
+    1991:	|  |   31 d2                	xor    %edx,%edx
+    1993:	|  |   48 89 50 08          	mov    %rdx,0x8(%rax)
+            : item_(move(o.item_))
+    1997:	|  \-> 48 89 03             	mov    %rax,(%rbx)
+        }
+    199a:	\----> 48 89 d8             	mov    %rbx,%rax
+    199d:	       5b                   	pop    %rbx
+    199e:	       c3                   	ret
+    199f:	       90                   	nop
+
+00000000000019a0 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>:
+         *
+         * @param val The value to move into the vec.
+         * @returns if successful, Result<void, T>::Ok()
+         * @returns if unsuccessful, Result<void, T>::Err() holding val
+         */
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+    19a0:	                41 54                	push   %r12
+    19a2:	                49 89 d4             	mov    %rdx,%r12
+    19a5:	                55                   	push   %rbp
+    19a6:	                48 89 f5             	mov    %rsi,%rbp
+    19a9:	                53                   	push   %rbx
+    19aa:	                48 89 fb             	mov    %rdi,%rbx
+    19ad:	                48 8b 3e             	mov    (%rsi),%rdi
+            return (item_ == nullptr) ? 0 : item_->len();
+    19b0:	                48 85 ff             	test   %rdi,%rdi
+    19b3:	            /-- 74 12                	je     19c7 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x27>
+            return len_;
+    19b5:	            |   48 8b 77 08          	mov    0x8(%rdi),%rsi
+            return alloc_;
+    19b9:	            |   48 8b 17             	mov    (%rdi),%rdx
+            if (len() + n <= capacity()) { return true; }
+    19bc:	            |   48 8d 46 01          	lea    0x1(%rsi),%rax
+    19c0:	            |   48 39 c2             	cmp    %rax,%rdx
+    19c3:	/-----------|-- 73 76                	jae    1a3b <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x9b>
+    19c5:	|        /--|-- eb 19                	jmp    19e0 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x40>
+            Node *new_n = realloc(nullptr, capacity);
+    19c7:	|        |  \-> 31 ff                	xor    %edi,%edi
+    19c9:	|        |      be 04 00 00 00       	mov    $0x4,%esi
+    19ce:	|        |      e8 df fe ff ff       	call   18b2 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    19d3:	|        |      48 85 c0             	test   %rax,%rax
+    19d6:	|     /--|----- 74 3c                	je     1a14 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x74>
+    19d8:	|     |  |      31 d2                	xor    %edx,%edx
+    19da:	|     |  |      48 89 50 08          	mov    %rdx,0x8(%rax)
+    19de:	|  /--|--|----- eb 46                	jmp    1a26 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x86>
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            if (cap <= cur) { return cap; }
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    19e0:	|  |  |  \----> 48 83 fa 03          	cmp    $0x3,%rdx
+    19e4:	|  |  |     /-- 77 15                	ja     19fb <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x5b>
+    19e6:	|  |  |     |   ba 04 00 00 00       	mov    $0x4,%edx
+    19eb:	|  |  |     |   48 39 d0             	cmp    %rdx,%rax
+    19ee:	|  |  |     |   48 0f 42 c2          	cmovb  %rdx,%rax
+    19f2:	|  |  |     |   48 39 f0             	cmp    %rsi,%rax
+    19f5:	|  |  |     |   48 0f 43 f0          	cmovae %rax,%rsi
+    19f9:	|  |  |  /--|-- eb 21                	jmp    1a1c <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x7c>
+    19fb:	|  |  |  |  \-> 48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+    19ff:	|  |  |  |      48 39 c1             	cmp    %rax,%rcx
+    1a02:	|  |  |  |      48 0f 43 c1          	cmovae %rcx,%rax
+    1a06:	|  |  |  |      48 39 f0             	cmp    %rsi,%rax
+    1a09:	|  |  |  |      48 0f 43 f0          	cmovae %rax,%rsi
+            } else if (new_cap == item_->capacity()) {
+    1a0d:	|  |  |  |      48 39 f2             	cmp    %rsi,%rdx
+    1a10:	|  |  |  +----- 75 0a                	jne    1a1c <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x7c>
+    1a12:	+--|--|--|----- eb 27                	jmp    1a3b <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x9b>
+                item_ = VectorNode::malloc(new_cap);
+    1a14:	|  |  \--|----> 31 c0                	xor    %eax,%eax
+    1a16:	|  |     |      48 89 45 00          	mov    %rax,0x0(%rbp)
+    1a1a:	|  |     |  /-- eb 10                	jmp    1a2c <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x8c>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    1a1c:	|  |     \--|-> e8 91 fe ff ff       	call   18b2 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+                if (p == nullptr) { return false; }
+    1a21:	|  |        |   48 85 c0             	test   %rax,%rax
+    1a24:	|  |        +-- 74 06                	je     1a2c <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x8c>
+                item_ = p;
+    1a26:	|  \--------|-> 48 89 45 00          	mov    %rax,0x0(%rbp)
+    1a2a:	+-----------|-- eb 0f                	jmp    1a3b <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x9b>
+    1a2c:	|           \-> 41 8b 04 24          	mov    (%r12),%eax
+            : tag_(Tag::ERR)
+    1a30:	|               c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+    1a36:	|               89 43 04             	mov    %eax,0x4(%rbx)
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    1a39:	|     /-------- eb 32                	jmp    1a6d <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0xcd>
+        {
+            bool ok;
+            ok = try_reserve_for(1);
+            if (!ok) { return Result<void, Type>::Err(val); }
+            if (item_ == nullptr) { return Result<void, Type>::Err(val); }
+    1a3b:	\-----|-------> 48 8b 45 00          	mov    0x0(%rbp),%rax
+    1a3f:	      |         41 8b 0c 24          	mov    (%r12),%ecx
+    1a43:	      |         48 85 c0             	test   %rax,%rax
+    1a46:	      |     /-- 74 09                	je     1a51 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0xb1>
+            return len_;
+    1a48:	      |     |   48 8b 50 08          	mov    0x8(%rax),%rdx
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+        {
+            if (len() >= capacity()) {
+    1a4c:	      |     |   48 3b 10             	cmp    (%rax),%rdx
+    1a4f:	      |  /--|-- 72 0b                	jb     1a5c <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0xbc>
+            : tag_(Tag::ERR)
+    1a51:	      |  |  \-> c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+    1a57:	      |  |      89 4b 04             	mov    %ecx,0x4(%rbx)
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    1a5a:	      +--|----- eb 11                	jmp    1a6d <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0xcd>
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    1a5c:	      |  \----> 89 4c 90 10          	mov    %ecx,0x10(%rax,%rdx,4)
+            len_ += 1;
+    1a60:	      |         48 ff c2             	inc    %rdx
+    1a63:	      |         48 89 50 08          	mov    %rdx,0x8(%rax)
+            : tag_(Tag::OK)
+    1a67:	      |         c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+            return item_->push_back(val);
+        }
+    1a6d:	      \-------> 48 89 d8             	mov    %rbx,%rax
+    1a70:	                5b                   	pop    %rbx
+    1a71:	                5d                   	pop    %rbp
+    1a72:	                41 5c                	pop    %r12
+    1a74:	                c3                   	ret
+
+0000000000001a75 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1a75:	53                   	push   %rbx
+    1a76:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    1a79:	40 0f be fe          	movsbl %sil,%edi
+    1a7d:	48 8b 35 dc 25 00 00 	mov    0x25dc(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    1a84:	e8 e7 f5 ff ff       	call   1070 <fputc@plt>
+    return outs;
+}
+    1a89:	48 89 d8             	mov    %rbx,%rax
+    1a8c:	5b                   	pop    %rbx
+    1a8d:	c3                   	ret
+
+0000000000001a8e <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1a8e:	53                   	push   %rbx
+    1a8f:	48 89 fb             	mov    %rdi,%rbx
+    1a92:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    1a95:	48 8b 35 c4 25 00 00 	mov    0x25c4(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    1a9c:	e8 bf f5 ff ff       	call   1060 <fputs@plt>
+    return outs;
+}
+    1aa1:	48 89 d8             	mov    %rbx,%rax
+    1aa4:	5b                   	pop    %rbx
+    1aa5:	c3                   	ret
+
+0000000000001aa6 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1aa6:	53                   	push   %rbx
+    1aa7:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    1aaa:	48 8b 3d af 25 00 00 	mov    0x25af(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1ab1:	40 0f b6 d6          	movzbl %sil,%edx
+    1ab5:	31 c0                	xor    %eax,%eax
+    1ab7:	48 8d 35 aa 06 00 00 	lea    0x6aa(%rip),%rsi        # 2168 <sizes+0x68>
+    1abe:	e8 bd f5 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1ac3:	48 89 d8             	mov    %rbx,%rax
+    1ac6:	5b                   	pop    %rbx
+    1ac7:	c3                   	ret
+
+0000000000001ac8 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    1ac8:	53                   	push   %rbx
+    1ac9:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    1acc:	48 8b 3d 8d 25 00 00 	mov    0x258d(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1ad3:	0f b7 d6             	movzwl %si,%edx
+    1ad6:	31 c0                	xor    %eax,%eax
+    1ad8:	48 8d 35 89 06 00 00 	lea    0x689(%rip),%rsi        # 2168 <sizes+0x68>
+    1adf:	e8 9c f5 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1ae4:	48 89 d8             	mov    %rbx,%rax
+    1ae7:	5b                   	pop    %rbx
+    1ae8:	c3                   	ret
+
+0000000000001ae9 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    1ae9:	53                   	push   %rbx
+    1aea:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    1aed:	48 8b 3d 6c 25 00 00 	mov    0x256c(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1af4:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    1af6:	31 c0                	xor    %eax,%eax
+    1af8:	48 8d 35 69 06 00 00 	lea    0x669(%rip),%rsi        # 2168 <sizes+0x68>
+    1aff:	e8 7c f5 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1b04:	48 89 d8             	mov    %rbx,%rax
+    1b07:	5b                   	pop    %rbx
+    1b08:	c3                   	ret
+
+0000000000001b09 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    1b09:	53                   	push   %rbx
+    1b0a:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    1b0d:	48 8b 3d 4c 25 00 00 	mov    0x254c(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1b14:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    1b16:	31 c0                	xor    %eax,%eax
+    1b18:	48 8d 35 49 06 00 00 	lea    0x649(%rip),%rsi        # 2168 <sizes+0x68>
+    1b1f:	e8 5c f5 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1b24:	48 89 d8             	mov    %rbx,%rax
+    1b27:	5b                   	pop    %rbx
+    1b28:	c3                   	ret
+
+0000000000001b29 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    1b29:	53                   	push   %rbx
+    1b2a:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    1b2d:	48 8b 3d 2c 25 00 00 	mov    0x252c(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1b34:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    1b37:	31 c0                	xor    %eax,%eax
+    1b39:	48 8d 35 2b 06 00 00 	lea    0x62b(%rip),%rsi        # 216b <sizes+0x6b>
+    1b40:	e8 3b f5 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1b45:	48 89 d8             	mov    %rbx,%rax
+    1b48:	5b                   	pop    %rbx
+    1b49:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000001b4c <_fini>:
+    1b4c:	48 83 ec 08          	sub    $0x8,%rsp
+    1b50:	48 83 c4 08          	add    $0x8,%rsp
+    1b54:	c3                   	ret
@@ -0,0 +1,1732 @@
+
+target/minsize/examples/bench_small_vector:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <clock_gettime@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <clock_gettime@GLIBC_2.17>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputs@plt>:
+    1060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 4018 <fputs@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 2f 00 00    	jmp    *0x2faa(%rip)        # 4020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 2f 00 00    	jmp    *0x2fa2(%rip)        # 4028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 2f 00 00    	jmp    *0x2f9a(%rip)        # 4030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <realloc@plt>:
+    10a0:	ff 25 92 2f 00 00    	jmp    *0x2f92(%rip)        # 4038 <realloc@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <memmove@plt>:
+    10b0:	ff 25 8a 2f 00 00    	jmp    *0x2f8a(%rip)        # 4040 <memmove@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010c0 <__cxa_finalize@plt>:
+    10c0:	ff 25 1a 2f 00 00    	jmp    *0x2f1a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10c6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010d0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10d0:	50                   	push   %rax
+    std::abort();
+    10d1:	e8 6a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010d6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10d6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10d7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10da:	4c 8d 0d 21 10 00 00 	lea    0x1021(%rip),%r9        # 2102 <_IO_stdin_used+0x102>
+    10e1:	31 c0                	xor    %eax,%eax
+    10e3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10e7:	4c 8b 07             	mov    (%rdi),%r8
+    10ea:	48 8d 35 17 10 00 00 	lea    0x1017(%rip),%rsi        # 2108 <_IO_stdin_used+0x108>
+    10f1:	48 8b 3d 68 2f 00 00 	mov    0x2f68(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    10f8:	e8 93 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    10fd:	e8 3e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001102 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1102:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1106:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1109:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    110d:	31 c0                	xor    %eax,%eax
+    110f:	57                   	push   %rdi
+    1110:	48 8b 3d 49 2f 00 00 	mov    0x2f49(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1117:	4c 8d 0d e4 0f 00 00 	lea    0xfe4(%rip),%r9        # 2102 <_IO_stdin_used+0x102>
+    111e:	4c 8b 06             	mov    (%rsi),%r8
+    1121:	48 8d 35 f1 0f 00 00 	lea    0xff1(%rip),%rsi        # 2119 <_IO_stdin_used+0x119>
+    1128:	e8 63 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    112d:	e8 0e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001132 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1132:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1136:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1139:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    113d:	31 c0                	xor    %eax,%eax
+    113f:	57                   	push   %rdi
+    1140:	48 8b 3d 19 2f 00 00 	mov    0x2f19(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1147:	4c 8d 0d e0 0f 00 00 	lea    0xfe0(%rip),%r9        # 212e <_IO_stdin_used+0x12e>
+    114e:	4c 8b 06             	mov    (%rsi),%r8
+    1151:	48 8d 35 c1 0f 00 00 	lea    0xfc1(%rip),%rsi        # 2119 <_IO_stdin_used+0x119>
+    1158:	e8 33 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    115d:	e8 de fe ff ff       	call   1040 <abort@plt>
+
+0000000000001162 <main>:
+    bench::report(name, t);
+    nel::log << "  sum: " << sum << '\n';
+}
+
+int main()
+{
+    1162:	50                   	push   %rax
+    bench_lists<nel::heaped::Vector<int>>("1M lists of 6, heaped::Vector");
+    1163:	48 8d 3d 54 0f 00 00 	lea    0xf54(%rip),%rdi        # 20be <_IO_stdin_used+0xbe>
+    116a:	e8 91 04 00 00       	call   1600 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)>
+    bench_lists<nel::heaped::SmallVector<int, 8>>("1M lists of 6, heaped::SmallVector<8>");
+    116f:	48 8d 3d 66 0f 00 00 	lea    0xf66(%rip),%rdi        # 20dc <_IO_stdin_used+0xdc>
+    1176:	e8 40 07 00 00       	call   18bb <void bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)>
+}
+    117b:	31 c0                	xor    %eax,%eax
+    117d:	5a                   	pop    %rdx
+    117e:	c3                   	ret
+    117f:	90                   	nop
+
+0000000000001180 <_start>:
+    1180:	31 ed                	xor    %ebp,%ebp
+    1182:	49 89 d1             	mov    %rdx,%r9
+    1185:	5e                   	pop    %rsi
+    1186:	48 89 e2             	mov    %rsp,%rdx
+    1189:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    118d:	50                   	push   %rax
+    118e:	54                   	push   %rsp
+    118f:	45 31 c0             	xor    %r8d,%r8d
+    1192:	31 c9                	xor    %ecx,%ecx
+    1194:	48 8d 3d c7 ff ff ff 	lea    -0x39(%rip),%rdi        # 1162 <main>
+    119b:	ff 15 1f 2e 00 00    	call   *0x2e1f(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    11a1:	f4                   	hlt
+    11a2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    11a9:	00 00 00 
+    11ac:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000011b0 <deregister_tm_clones>:
+    11b0:	    48 8d 3d a1 2e 00 00 	lea    0x2ea1(%rip),%rdi        # 4058 <__TMC_END__>
+    11b7:	    48 8d 05 9a 2e 00 00 	lea    0x2e9a(%rip),%rax        # 4058 <__TMC_END__>
+    11be:	    48 39 f8             	cmp    %rdi,%rax
+    11c1:	/-- 74 15                	je     11d8 <deregister_tm_clones+0x28>
+    11c3:	|   48 8b 05 fe 2d 00 00 	mov    0x2dfe(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    11ca:	|   48 85 c0             	test   %rax,%rax
+    11cd:	+-- 74 09                	je     11d8 <deregister_tm_clones+0x28>
+    11cf:	|   ff e0                	jmp    *%rax
+    11d1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    11d8:	\-> c3                   	ret
+    11d9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011e0 <register_tm_clones>:
+    11e0:	    48 8d 3d 71 2e 00 00 	lea    0x2e71(%rip),%rdi        # 4058 <__TMC_END__>
+    11e7:	    48 8d 35 6a 2e 00 00 	lea    0x2e6a(%rip),%rsi        # 4058 <__TMC_END__>
+    11ee:	    48 29 fe             	sub    %rdi,%rsi
+    11f1:	    48 89 f0             	mov    %rsi,%rax
+    11f4:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    11f8:	    48 c1 f8 03          	sar    $0x3,%rax
+    11fc:	    48 01 c6             	add    %rax,%rsi
+    11ff:	    48 d1 fe             	sar    %rsi
+    1202:	/-- 74 14                	je     1218 <register_tm_clones+0x38>
+    1204:	|   48 8b 05 cd 2d 00 00 	mov    0x2dcd(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    120b:	|   48 85 c0             	test   %rax,%rax
+    120e:	+-- 74 08                	je     1218 <register_tm_clones+0x38>
+    1210:	|   ff e0                	jmp    *%rax
+    1212:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1218:	\-> c3                   	ret
+    1219:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001220 <__do_global_dtors_aux>:
+    1220:	       f3 0f 1e fa          	endbr64
+    1224:	       80 3d 3d 2e 00 00 00 	cmpb   $0x0,0x2e3d(%rip)        # 4068 <completed.0>
+    122b:	/----- 75 2b                	jne    1258 <__do_global_dtors_aux+0x38>
+    122d:	|      55                   	push   %rbp
+    122e:	|      48 83 3d aa 2d 00 00 	cmpq   $0x0,0x2daa(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1235:	|      00 
+    1236:	|      48 89 e5             	mov    %rsp,%rbp
+    1239:	|  /-- 74 0c                	je     1247 <__do_global_dtors_aux+0x27>
+    123b:	|  |   48 8b 3d 0e 2e 00 00 	mov    0x2e0e(%rip),%rdi        # 4050 <__dso_handle>
+    1242:	|  |   e8 79 fe ff ff       	call   10c0 <__cxa_finalize@plt>
+    1247:	|  \-> e8 64 ff ff ff       	call   11b0 <deregister_tm_clones>
+    124c:	|      c6 05 15 2e 00 00 01 	movb   $0x1,0x2e15(%rip)        # 4068 <completed.0>
+    1253:	|      5d                   	pop    %rbp
+    1254:	|      c3                   	ret
+    1255:	|      0f 1f 00             	nopl   (%rax)
+    1258:	\----> c3                   	ret
+    1259:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001260 <frame_dummy>:
+    1260:	f3 0f 1e fa          	endbr64
+    1264:	e9 77 ff ff ff       	jmp    11e0 <register_tm_clones>
+
+0000000000001269 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    1269:	83 c8 ff             	or     $0xffffffff,%eax
+    126c:	c3                   	ret
+
+000000000000126d <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    126d:	83 c8 ff             	or     $0xffffffff,%eax
+    1270:	c3                   	ret
+
+0000000000001271 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    1271:	83 c8 ff             	or     $0xffffffff,%eax
+    1274:	c3                   	ret
+
+0000000000001275 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    1275:	83 c8 ff             	or     $0xffffffff,%eax
+    1278:	c3                   	ret
+
+0000000000001279 <_read_r>:
+int _read_r(struct _reent *, int) {
+    1279:	83 c8 ff             	or     $0xffffffff,%eax
+    127c:	c3                   	ret
+
+000000000000127d <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    127d:	83 c8 ff             	or     $0xffffffff,%eax
+    1280:	c3                   	ret
+
+0000000000001281 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    1281:	83 c8 ff             	or     $0xffffffff,%eax
+    1284:	c3                   	ret
+
+0000000000001285 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1285:	83 c8 ff             	or     $0xffffffff,%eax
+    1288:	c3                   	ret
+
+0000000000001289 <bench::now_ns()>:
+{
+    1289:	48 83 ec 18          	sub    $0x18,%rsp
+    auto t = bench::time_ns([&sum]() {
+    128d:	bf 01 00 00 00       	mov    $0x1,%edi
+    1292:	48 89 e6             	mov    %rsp,%rsi
+    1295:	e8 b6 fd ff ff       	call   1050 <clock_gettime@plt>
+        for (nel::Index i = 0; i < n_lists; ++i) {
+    129a:	48 69 04 24 00 ca 9a 	imul   $0x3b9aca00,(%rsp),%rax
+    12a1:	3b 
+    12a2:	48 03 44 24 08       	add    0x8(%rsp),%rax
+            auto v = Vec::empty();
+    12a7:	48 83 c4 18          	add    $0x18,%rsp
+    12ab:	c3                   	ret
+
+00000000000012ac <bench::report(char const*, unsigned long, unsigned long)>:
+    bench_lists<nel::heaped::SmallVector<int, 8>>("1M lists of 6, heaped::SmallVector<8>");
+    12ac:	    41 54                	push   %r12
+}
+    12ae:	    4c 8d 25 b4 2d 00 00 	lea    0x2db4(%rip),%r12        # 4069 <nel::log>
+    bench_lists<nel::heaped::SmallVector<int, 8>>("1M lists of 6, heaped::SmallVector<8>");
+    12b5:	    55                   	push   %rbp
+    12b6:	    48 89 f5             	mov    %rsi,%rbp
+}
+    12b9:	    48 89 fe             	mov    %rdi,%rsi
+    12bc:	    4c 89 e7             	mov    %r12,%rdi
+    bench_lists<nel::heaped::SmallVector<int, 8>>("1M lists of 6, heaped::SmallVector<8>");
+    12bf:	    53                   	push   %rbx
+    12c0:	    48 89 d3             	mov    %rdx,%rbx
+}
+    12c3:	    e8 02 09 00 00       	call   1bca <nel::operator<<(nel::Log&, char const*)>
+    12c8:	    48 8d 35 c2 0d 00 00 	lea    0xdc2(%rip),%rsi        # 2091 <_IO_stdin_used+0x91>
+    12cf:	    48 89 c7             	mov    %rax,%rdi
+    12d2:	    e8 f3 08 00 00       	call   1bca <nel::operator<<(nel::Log&, char const*)>
+    12d7:	    b9 e8 03 00 00       	mov    $0x3e8,%ecx
+    12dc:	    31 d2                	xor    %edx,%edx
+    12de:	    48 89 c7             	mov    %rax,%rdi
+    12e1:	    48 89 e8             	mov    %rbp,%rax
+    12e4:	    48 f7 f1             	div    %rcx
+    12e7:	    48 89 c6             	mov    %rax,%rsi
+    12ea:	    e8 76 09 00 00       	call   1c65 <nel::operator<<(nel::Log&, unsigned long)>
+    12ef:	    48 8d 35 0e 0d 00 00 	lea    0xd0e(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    12f6:	    48 89 c7             	mov    %rax,%rdi
+    12f9:	    e8 cc 08 00 00       	call   1bca <nel::operator<<(nel::Log&, char const*)>
+    12fe:	    48 85 db             	test   %rbx,%rbx
+    1301:	/-- 74 3a                	je     133d <bench::report(char const*, unsigned long, unsigned long)+0x91>
+    1303:	|   48 85 ed             	test   %rbp,%rbp
+    1306:	+-- 74 35                	je     133d <bench::report(char const*, unsigned long, unsigned long)+0x91>
+    1308:	|   48 8d 35 f8 0c 00 00 	lea    0xcf8(%rip),%rsi        # 2007 <_IO_stdin_used+0x7>
+    130f:	|   4c 89 e7             	mov    %r12,%rdi
+    1312:	|   e8 b3 08 00 00       	call   1bca <nel::operator<<(nel::Log&, char const*)>
+    1317:	|   31 d2                	xor    %edx,%edx
+    1319:	|   48 89 c7             	mov    %rax,%rdi
+    131c:	|   48 69 c3 e8 03 00 00 	imul   $0x3e8,%rbx,%rax
+    1323:	|   48 f7 f5             	div    %rbp
+    1326:	|   48 89 c6             	mov    %rax,%rsi
+    1329:	|   e8 37 09 00 00       	call   1c65 <nel::operator<<(nel::Log&, unsigned long)>
+    132e:	|   48 8d 35 d5 0c 00 00 	lea    0xcd5(%rip),%rsi        # 200a <_IO_stdin_used+0xa>
+    1335:	|   48 89 c7             	mov    %rax,%rdi
+    1338:	|   e8 8d 08 00 00       	call   1bca <nel::operator<<(nel::Log&, char const*)>
+    133d:	\-> 5b                   	pop    %rbx
+    133e:	    4c 89 e7             	mov    %r12,%rdi
+    1341:	    5d                   	pop    %rbp
+    1342:	    be 0a 00 00 00       	mov    $0xa,%esi
+    1347:	    41 5c                	pop    %r12
+    1349:	    e9 63 08 00 00       	jmp    1bb1 <nel::operator<<(nel::Log&, char)>
+
+000000000000134e <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+        };
+
+    public:
+        constexpr ~Result(void)
+        {
+            switch (tag_) { // result::dtor
+    134e:	    83 3f 02             	cmpl   $0x2,(%rdi)
+    1351:	/-- 76 35                	jbe    1388 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x3a>
+        constexpr ~Result(void)
+    1353:	|   48 83 ec 28          	sub    $0x28,%rsp
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1357:	|   48 8d 05 b1 0c 00 00 	lea    0xcb1(%rip),%rax        # 200f <_IO_stdin_used+0xf>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    135e:	|   48 8d 3d c4 0c 00 00 	lea    0xcc4(%rip),%rdi        # 2029 <_IO_stdin_used+0x29>
+    1365:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    136a:	|   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    136f:	|   48 8d 05 a1 0c 00 00 	lea    0xca1(%rip),%rax        # 2017 <_IO_stdin_used+0x17>
+    1376:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    137b:	|   c7 44 24 18 72 00 00 	movl   $0x72,0x18(%rsp)
+    1382:	|   00 
+    1383:	|   e8 7a fd ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+    1388:	\-> c3                   	ret
+    1389:	    90                   	nop
+
+000000000000138a <nel::Result<void, int>::~Result()>:
+        };
+
+    public:
+        constexpr ~Result(void)
+        {
+            switch (tag_) { // result<void>-dtor
+    138a:	    83 3f 02             	cmpl   $0x2,(%rdi)
+    138d:	/-- 76 35                	jbe    13c4 <nel::Result<void, int>::~Result()+0x3a>
+        constexpr ~Result(void)
+    138f:	|   48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    1393:	|   48 8d 05 75 0c 00 00 	lea    0xc75(%rip),%rax        # 200f <_IO_stdin_used+0xf>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    139a:	|   48 8d 3d 88 0c 00 00 	lea    0xc88(%rip),%rdi        # 2029 <_IO_stdin_used+0x29>
+    13a1:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    13a6:	|   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    13ab:	|   48 8d 05 65 0c 00 00 	lea    0xc65(%rip),%rax        # 2017 <_IO_stdin_used+0x17>
+    13b2:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    13b7:	|   c7 44 24 18 dd 02 00 	movl   $0x2dd,0x18(%rsp)
+    13be:	|   00 
+    13bf:	|   e8 3e fd ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+    13c4:	\-> c3                   	ret
+
+00000000000013c5 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>:
+         * @returns on fail, nullptr, old_n is then untouched and still valid.
+         */
+        static Node *realloc(Node *const old_n, Count const new_cap)
+        {
+            // Too big to address, size_of() would overflow.
+            if (new_cap > max_capacity) { return nullptr; }
+    13c5:	             48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    13cc:	             ff ff 1f 
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    13cf:	             55                   	push   %rbp
+    13d0:	             53                   	push   %rbx
+    13d1:	             48 83 ec 38          	sub    $0x38,%rsp
+            if (new_cap > max_capacity) { return nullptr; }
+    13d5:	             48 39 f0             	cmp    %rsi,%rax
+    13d8:	/----------- 0f 82 9e 00 00 00    	jb     147c <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0xb7>
+    13de:	|            48 89 f3             	mov    %rsi,%rbx
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    13e1:	|            48 8d 34 b5 14 00 00 	lea    0x14(,%rsi,4),%rsi
+    13e8:	|            00 
+            if (align == 0 || (align & (align - 1)) != 0) {
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+            }
+            void *const new_p = is_over_aligned(align)
+                                    ? realloc_aligned(p, align, old_size, new_size)
+                                    : std::realloc(p, new_size);
+    13e9:	|            e8 b2 fc ff ff       	call   10a0 <realloc@plt>
+            if (new_p == nullptr) {
+    13ee:	|            48 85 c0             	test   %rax,%rax
+    13f1:	|     /----- 75 12                	jne    1405 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x40>
+            : tag_(Tag::ERR)
+    13f3:	|     |      c7 44 24 08 02 00 00 	movl   $0x2,0x8(%rsp)
+    13fa:	|     |      00 
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+            : value_(forward<Type>(val))
+    13fb:	|     |      c7 44 24 10 01 00 00 	movl   $0x1,0x10(%rsp)
+    1402:	|     |      00 
+    1403:	|     |  /-- eb 0d                	jmp    1412 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x4d>
+            : tag_(Tag::OK)
+    1405:	|     \--|-> c7 44 24 08 01 00 00 	movl   $0x1,0x8(%rsp)
+    140c:	|        |   00 
+        {
+        }
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+            : value_(forward<Args>(args)...)
+    140d:	|        |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            : fn_name_(fn_name)
+    1412:	|        \-> 48 8d 05 1b 0c 00 00 	lea    0xc1b(%rip),%rax        # 2034 <_IO_stdin_used+0x34>
+            , line_num_(line_num)
+    1419:	|            c7 44 24 28 89 00 00 	movl   $0x89,0x28(%rsp)
+    1420:	|            00 
+    1421:	|            48 8d 7c 24 08       	lea    0x8(%rsp),%rdi
+            : fn_name_(fn_name)
+    1426:	|            48 89 44 24 18       	mov    %rax,0x18(%rsp)
+            , file_name_(file_name)
+    142b:	|            48 8d 05 0a 0c 00 00 	lea    0xc0a(%rip),%rax        # 203c <_IO_stdin_used+0x3c>
+    1432:	|            48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    1437:	|            8b 44 24 08          	mov    0x8(%rsp),%eax
+            switch (tag_) { // result-match
+    143b:	|            83 f8 01             	cmp    $0x1,%eax
+    143e:	|     /----- 74 21                	je     1461 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x9c>
+    1440:	|     |      83 f8 02             	cmp    $0x2,%eax
+    1443:	|  /--|----- 74 32                	je     1477 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0xb2>
+    1445:	|  |  |      85 c0                	test   %eax,%eax
+                    nel::panic("invalid Result", ctx);
+    1447:	|  |  |      48 8d 3d 05 0c 00 00 	lea    0xc05(%rip),%rdi        # 2053 <_IO_stdin_used+0x53>
+    144e:	|  |  |      48 8d 74 24 18       	lea    0x18(%rsp),%rsi
+            switch (tag_) { // result-match
+    1453:	|  |  |  /-- 74 07                	je     145c <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x97>
+                    nel::panic("bad Result", ctx);
+    1455:	|  |  |  |   48 8d 3d cd 0b 00 00 	lea    0xbcd(%rip),%rdi        # 2029 <_IO_stdin_used+0x29>
+    145c:	|  |  |  \-> e8 a1 fc ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    1461:	|  |  \----> 48 8b 6c 24 10       	mov    0x10(%rsp),%rbp
+            tag_ = Tag::INVAL;
+    1466:	|  |         31 c0                	xor    %eax,%eax
+    1468:	|  |         89 44 24 08          	mov    %eax,0x8(%rsp)
+                // realloc may move the values byte-wise.
+                auto r = Allocator::try_realloc(old_n, alignof(Node), old_sz, new_sz);
+                // Remember, if realloc fails, then old is still valid..
+                if (r.is_err()) { return nullptr; }
+                new_n = reinterpret_cast<Node *>(r.unwrap());
+            } else {
+    146c:	|  |         e8 dd fe ff ff       	call   134e <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+                    // poison new memory,
+                    // assumes realloc adds to end
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+                }
+            }
+            new_n->alloc_ = new_cap;
+    1471:	|  |         48 89 5d 00          	mov    %rbx,0x0(%rbp)
+            return new_n;
+    1475:	|  |     /-- eb 07                	jmp    147e <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0xb9>
+            } else {
+    1477:	|  \-----|-> e8 d2 fe ff ff       	call   134e <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+            if (new_cap > max_capacity) { return nullptr; }
+    147c:	\--------|-> 31 ed                	xor    %ebp,%ebp
+        }
+    147e:	         \-> 48 83 c4 38          	add    $0x38,%rsp
+    1482:	             48 89 e8             	mov    %rbp,%rax
+    1485:	             5b                   	pop    %rbx
+    1486:	             5d                   	pop    %rbp
+    1487:	             c3                   	ret
+
+0000000000001488 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&sum]() {
+    1488:	                   41 57                	push   %r15
+            : fn_name_(fn_name)
+    148a:	                   4c 8d 3d d1 0b 00 00 	lea    0xbd1(%rip),%r15        # 2062 <_IO_stdin_used+0x62>
+    1491:	                   41 56                	push   %r14
+    1493:	                   41 55                	push   %r13
+    1495:	                   49 89 fd             	mov    %rdi,%r13
+    1498:	                   41 54                	push   %r12
+    149a:	                   55                   	push   %rbp
+        for (nel::Index i = 0; i < n_lists; ++i) {
+    149b:	                   31 ed                	xor    %ebp,%ebp
+    auto t = bench::time_ns([&sum]() {
+    149d:	                   53                   	push   %rbx
+    149e:	                   48 83 ec 28          	sub    $0x28,%rsp
+        }
+
+        // default ctor is ok since it cannot throw.
+        // TODO: but is it 'correct'? i.e. must arrays be created initialised?
+        constexpr Vector(void)
+            : item_(nullptr)
+    14a2:	/----------------> 31 db                	xor    %ebx,%ebx
+            for (nel::Index j = 0; j < n_values; ++j) {
+    14a4:	|                  45 31 e4             	xor    %r12d,%r12d
+                v.push(int(i + j)).is_ok();
+    14a7:	|  /-------------> 46 8d 74 25 00       	lea    0x0(%rbp,%r12,1),%r14d
+         *
+         * @returns the current in use count.
+         */
+        constexpr Length len(void) const
+        {
+            return (item_ == nullptr) ? 0 : item_->len();
+    14ac:	|  |               48 85 db             	test   %rbx,%rbx
+    14af:	|  |           /-- 74 12                	je     14c3 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x3b>
+            return alloc_;
+        }
+
+        constexpr Length len(void) const
+        {
+            return len_;
+    14b1:	|  |           |   48 8b 73 08          	mov    0x8(%rbx),%rsi
+            return alloc_;
+    14b5:	|  |           |   48 8b 13             	mov    (%rbx),%rdx
+
+    private:
+        // Make room for n more values, only ever grows.
+        bool try_reserve_for(Count const n)
+        {
+            if (len() + n <= capacity()) { return true; }
+    14b8:	|  |           |   48 8d 46 01          	lea    0x1(%rsi),%rax
+    14bc:	|  |           |   48 39 c2             	cmp    %rax,%rdx
+    14bf:	|  |  /--------|-- 73 60                	jae    1521 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x99>
+    14c1:	|  |  |     /--|-- eb 1c                	jmp    14df <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x57>
+            Node *new_n = realloc(nullptr, capacity);
+    14c3:	|  |  |     |  \-> be 04 00 00 00       	mov    $0x4,%esi
+    14c8:	|  |  |     |      31 ff                	xor    %edi,%edi
+    14ca:	|  |  |     |      e8 f6 fe ff ff       	call   13c5 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    14cf:	|  |  |     |      48 89 c3             	mov    %rax,%rbx
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    14d2:	|  |  |     |      48 85 c0             	test   %rax,%rax
+    14d5:	|  |  |  /--|----- 74 53                	je     152a <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0xa2>
+    14d7:	|  |  |  |  |      31 c0                	xor    %eax,%eax
+    14d9:	|  |  |  |  |      48 89 43 08          	mov    %rax,0x8(%rbx)
+    14dd:	|  |  +--|--|----- eb 42                	jmp    1521 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x99>
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            if (cap <= cur) { return cap; }
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    14df:	|  |  |  |  \----> 48 83 fa 03          	cmp    $0x3,%rdx
+    14e3:	|  |  |  |     /-- 77 15                	ja     14fa <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x72>
+    14e5:	|  |  |  |     |   ba 04 00 00 00       	mov    $0x4,%edx
+    14ea:	|  |  |  |     |   48 39 d0             	cmp    %rdx,%rax
+    14ed:	|  |  |  |     |   48 0f 42 c2          	cmovb  %rdx,%rax
+    14f1:	|  |  |  |     |   48 39 f0             	cmp    %rsi,%rax
+    14f4:	|  |  |  |     |   48 0f 43 f0          	cmovae %rax,%rsi
+    14f8:	|  |  |  |  /--|-- eb 17                	jmp    1511 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x89>
+    14fa:	|  |  |  |  |  \-> 48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+    14fe:	|  |  |  |  |      48 39 c1             	cmp    %rax,%rcx
+    1501:	|  |  |  |  |      48 0f 43 c1          	cmovae %rcx,%rax
+    1505:	|  |  |  |  |      48 39 f0             	cmp    %rsi,%rax
+    1508:	|  |  |  |  |      48 0f 43 f0          	cmovae %rax,%rsi
+            } else if (new_cap == item_->capacity()) {
+    150c:	|  |  |  |  |      48 39 d6             	cmp    %rdx,%rsi
+    150f:	|  |  +--|--|----- 74 10                	je     1521 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x99>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    1511:	|  |  |  |  \----> 48 89 df             	mov    %rbx,%rdi
+    1514:	|  |  |  |         e8 ac fe ff ff       	call   13c5 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+                if (p == nullptr) { return false; }
+    1519:	|  |  |  |         48 85 c0             	test   %rax,%rax
+    151c:	|  |  |  +-------- 74 0c                	je     152a <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0xa2>
+                item_ = p;
+    151e:	|  |  |  |         48 89 c3             	mov    %rax,%rbx
+            return len_;
+    1521:	|  |  \--|-------> 48 8b 43 08          	mov    0x8(%rbx),%rax
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+        {
+            if (len() >= capacity()) {
+    1525:	|  |     |         48 3b 03             	cmp    (%rbx),%rax
+    1528:	|  |     |     /-- 72 0e                	jb     1538 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0xb0>
+        {
+        }
+
+        template<typename... Args>
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+            : tag_(Tag::ERR)
+    152a:	|  |     \-----|-> c7 04 24 02 00 00 00 	movl   $0x2,(%rsp)
+    1531:	|  |           |   44 89 74 24 04       	mov    %r14d,0x4(%rsp)
+         * @returns a Result 'wrapping' the values given to construct an Err value inplace.
+         */
+        template<typename... Args>
+        constexpr static Result Err(Args &&...args)
+        {
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    1536:	|  |        /--|-- eb 13                	jmp    154b <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0xc3>
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    1538:	|  |        |  \-> 44 89 74 83 10       	mov    %r14d,0x10(%rbx,%rax,4)
+            len_ += 1;
+    153d:	|  |        |      48 ff c0             	inc    %rax
+    1540:	|  |        |      48 89 43 08          	mov    %rax,0x8(%rbx)
+            : tag_(Tag::OK)
+    1544:	|  |        |      c7 04 24 01 00 00 00 	movl   $0x1,(%rsp)
+            , file_name_(file_name)
+    154b:	|  |        \----> 48 8d 05 1b 0b 00 00 	lea    0xb1b(%rip),%rax        # 206d <_IO_stdin_used+0x6d>
+            : fn_name_(fn_name)
+    1552:	|  |               4c 89 7c 24 08       	mov    %r15,0x8(%rsp)
+            , file_name_(file_name)
+    1557:	|  |               48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    155c:	|  |               8b 04 24             	mov    (%rsp),%eax
+            , line_num_(line_num)
+    155f:	|  |               c7 44 24 18 17 00 00 	movl   $0x17,0x18(%rsp)
+    1566:	|  |               00 
+        // match(Tag tag, std::function<V(void)> on_ok, std::function<V(void)> on_err) const
+        //
+        template<typename V, typename Fn1, typename Fn2>
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+        {
+            switch (tag_) { // result<void>-match
+    1567:	|  |               85 c0                	test   %eax,%eax
+    1569:	|  |           /-- 74 1e                	je     1589 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x101>
+    156b:	|  |           |   ff c8                	dec    %eax
+    156d:	|  |           |   83 f8 01             	cmp    $0x1,%eax
+    1570:	|  |     /-----|-- 77 25                	ja     1597 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x10f>
+    1572:	|  |     |     |   48 89 e7             	mov    %rsp,%rdi
+            for (nel::Index j = 0; j < n_values; ++j) {
+    1575:	|  |     |     |   49 ff c4             	inc    %r12
+                v.push(int(i + j)).is_ok();
+    1578:	|  |     |     |   e8 0d fe ff ff       	call   138a <nel::Result<void, int>::~Result()>
+            for (nel::Index j = 0; j < n_values; ++j) {
+    157d:	|  |     |     |   49 83 fc 06          	cmp    $0x6,%r12
+    1581:	|  \-----|-----|-- 0f 85 20 ff ff ff    	jne    14a7 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x1f>
+    1587:	|        |  /--|-- eb 1f                	jmp    15a8 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x120>
+                    return on_err(*err_);
+                case Tag::INVAL:
+                    // invalids are not values that should occur
+                    // if they do it's a use-after-move-from op so must panic.
+                    // or a use-before-initialised so again must panic.
+                    nel::panic("invalid Result", ctx);
+    1589:	|        |  |  \-> 48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    158e:	|        |  |      48 8d 3d be 0a 00 00 	lea    0xabe(%rip),%rdi        # 2053 <_IO_stdin_used+0x53>
+    1595:	|        |  |  /-- eb 0c                	jmp    15a3 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x11b>
+                    break;
+                default:
+                    nel::panic("bad Result", ctx);
+    1597:	|        \--|--|-> 48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    159c:	|           |  |   48 8d 3d 86 0a 00 00 	lea    0xa86(%rip),%rdi        # 2029 <_IO_stdin_used+0x29>
+    15a3:	|           |  \-> e8 5a fb ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+            return (item_ == nullptr) ? Slice<Type>::empty() : item_->slice();
+    15a8:	|           \----> 48 85 db             	test   %rbx,%rbx
+    15ab:	|           /----- 74 0a                	je     15b7 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x12f>
+            return len_;
+    15ad:	|           |      48 8b 4b 08          	mov    0x8(%rbx),%rcx
+            return Slice(values_, len());
+    15b1:	|           |      48 8d 43 10          	lea    0x10(%rbx),%rax
+    15b5:	|           |  /-- eb 04                	jmp    15bb <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x133>
+        // Implicit start at 0.
+        Length len_;
+
+    private:
+        constexpr Slice(void)
+            : content_(nullptr)
+    15b7:	|           \--|-> 31 c0                	xor    %eax,%eax
+            , len_(0)
+    15b9:	|              |   31 c9                	xor    %ecx,%ecx
+    auto t = bench::time_ns([&sum]() {
+    15bb:	|              \-> 49 8b 55 00          	mov    0x0(%r13),%rdx
+        }
+
+    public:
+        constexpr SliceIterator(T arr[], Count len)
+            : b_(arr)
+            , e_(arr + len)
+    15bf:	|                  48 8d 0c 88          	lea    (%rax,%rcx,4),%rcx
+        template<typename F>
+        void for_each2(F &&fn)
+#        endif
+        {
+#        if 1
+            for (; !self().is_done(); self().inc()) {
+    15c3:	|           /----> 48 39 c1             	cmp    %rax,%rcx
+    15c6:	|           |  /-- 74 0c                	je     15d4 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x14c>
+            v.iter().for_each([&sum](int const &e) { sum += (long unsigned int)e; });
+    15c8:	|           |  |   48 63 30             	movslq (%rax),%rsi
+    15cb:	|           |  |   48 83 c0 04          	add    $0x4,%rax
+    15cf:	|           |  |   48 01 32             	add    %rsi,(%rdx)
+        }
+
+        void inc(void)
+        {
+            ++b_;
+        }
+    15d2:	|           \--|-- eb ef                	jmp    15c3 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x13b>
+            if (old == nullptr) { return; }
+    15d4:	|              \-> 48 85 db             	test   %rbx,%rbx
+    15d7:	|              /-- 74 08                	je     15e1 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x159>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    15d9:	|              |   48 89 df             	mov    %rbx,%rdi
+    15dc:	|              |   e8 4f fa ff ff       	call   1030 <free@plt>
+        for (nel::Index i = 0; i < n_lists; ++i) {
+    15e1:	|              \-> 48 ff c5             	inc    %rbp
+    15e4:	|                  48 81 fd 40 42 0f 00 	cmp    $0xf4240,%rbp
+    15eb:	\----------------- 0f 85 b1 fe ff ff    	jne    14a2 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x1a>
+    auto t = bench::time_ns([&sum]() {
+    15f1:	                   48 83 c4 28          	add    $0x28,%rsp
+    15f5:	                   5b                   	pop    %rbx
+    15f6:	                   5d                   	pop    %rbp
+    15f7:	                   41 5c                	pop    %r12
+    15f9:	                   41 5d                	pop    %r13
+    15fb:	                   41 5e                	pop    %r14
+    15fd:	                   41 5f                	pop    %r15
+    15ff:	                   c3                   	ret
+
+0000000000001600 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)>:
+void bench_lists(char const *const name)
+    1600:	55                   	push   %rbp
+    long unsigned int sum = 0;
+    1601:	31 c0                	xor    %eax,%eax
+void bench_lists(char const *const name)
+    1603:	53                   	push   %rbx
+    1604:	48 89 fb             	mov    %rdi,%rbx
+    1607:	48 83 ec 18          	sub    $0x18,%rsp
+    long unsigned int sum = 0;
+    160b:	48 89 04 24          	mov    %rax,(%rsp)
+    auto t = bench::time_ns([&sum]() {
+    160f:	48 89 e0             	mov    %rsp,%rax
+    1612:	48 89 44 24 08       	mov    %rax,0x8(%rsp)
+
+// Time a run of f(), in ns.
+template<typename F>
+long unsigned int time_ns(F &&f)
+{
+    long unsigned int const b = now_ns();
+    1617:	e8 6d fc ff ff       	call   1289 <bench::now_ns()>
+    f();
+    161c:	48 8d 7c 24 08       	lea    0x8(%rsp),%rdi
+    long unsigned int const b = now_ns();
+    1621:	48 89 c5             	mov    %rax,%rbp
+    f();
+    1624:	e8 5f fe ff ff       	call   1488 <bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    1629:	e8 5b fc ff ff       	call   1289 <bench::now_ns()>
+    bench::report(name, t);
+    162e:	31 d2                	xor    %edx,%edx
+    1630:	48 89 df             	mov    %rbx,%rdi
+    1633:	48 29 e8             	sub    %rbp,%rax
+    1636:	48 89 c6             	mov    %rax,%rsi
+    1639:	e8 6e fc ff ff       	call   12ac <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << sum << '\n';
+    163e:	48 8d 35 47 0a 00 00 	lea    0xa47(%rip),%rsi        # 208c <_IO_stdin_used+0x8c>
+    1645:	48 8d 3d 1d 2a 00 00 	lea    0x2a1d(%rip),%rdi        # 4069 <nel::log>
+    164c:	e8 79 05 00 00       	call   1bca <nel::operator<<(nel::Log&, char const*)>
+    1651:	48 8b 34 24          	mov    (%rsp),%rsi
+    1655:	48 89 c7             	mov    %rax,%rdi
+    1658:	e8 08 06 00 00       	call   1c65 <nel::operator<<(nel::Log&, unsigned long)>
+    165d:	be 0a 00 00 00       	mov    $0xa,%esi
+    1662:	48 89 c7             	mov    %rax,%rdi
+    1665:	e8 47 05 00 00       	call   1bb1 <nel::operator<<(nel::Log&, char)>
+}
+    166a:	48 83 c4 18          	add    $0x18,%rsp
+    166e:	5b                   	pop    %rbx
+    166f:	5d                   	pop    %rbp
+    1670:	c3                   	ret
+    1671:	90                   	nop
+
+0000000000001672 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const>:
+    auto t = bench::time_ns([&sum]() {
+    1672:	                      41 57                	push   %r15
+    1674:	                      41 56                	push   %r14
+            : fn_name_(fn_name)
+    1676:	                      4c 8d 35 e5 09 00 00 	lea    0x9e5(%rip),%r14        # 2062 <_IO_stdin_used+0x62>
+    167d:	                      41 55                	push   %r13
+    167f:	                      49 89 fd             	mov    %rdi,%r13
+    1682:	                      41 54                	push   %r12
+    1684:	                      55                   	push   %rbp
+    1685:	                      53                   	push   %rbx
+        for (nel::Index i = 0; i < n_lists; ++i) {
+    1686:	                      31 db                	xor    %ebx,%ebx
+    auto t = bench::time_ns([&sum]() {
+    1688:	                      48 83 ec 68          	sub    $0x68,%rsp
+        }
+
+        // default ctor is safe, will always succeed.
+        constexpr SmallVector(void)
+            : item_(nullptr)
+            , len_(0)
+    168c:	/-------------------> 31 c9                	xor    %ecx,%ecx
+            for (nel::Index j = 0; j < n_values; ++j) {
+    168e:	|                     31 ed                	xor    %ebp,%ebp
+    1690:	|                     48 89 4c 24 30       	mov    %rcx,0x30(%rsp)
+    1695:	|                     48 89 4c 24 38       	mov    %rcx,0x38(%rsp)
+         *
+         * @returns the current in use count.
+         */
+        constexpr Length len(void) const
+        {
+            return (item_ == nullptr) ? len_ : item_->len();
+    169a:	|  /----------------> 48 8b 7c 24 30       	mov    0x30(%rsp),%rdi
+                v.push(int(i + j)).is_ok();
+    169f:	|  |                  44 8d 24 2b          	lea    (%rbx,%rbp,1),%r12d
+    16a3:	|  |                  48 85 ff             	test   %rdi,%rdi
+    16a6:	|  |              /-- 75 15                	jne    16bd <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x4b>
+        }
+
+        // Make room for n more values, only ever grows.
+        bool try_reserve_for(Count const n)
+        {
+            if (len() + n <= capacity()) { return true; }
+    16a8:	|  |              |   48 8b 44 24 38       	mov    0x38(%rsp),%rax
+    16ad:	|  |              |   48 8d 70 01          	lea    0x1(%rax),%rsi
+    16b1:	|  |              |   48 83 fe 08          	cmp    $0x8,%rsi
+    16b5:	|  |  /-----------|-- 0f 86 f6 00 00 00    	jbe    17b1 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x13f>
+    16bb:	|  |  |        /--|-- eb 19                	jmp    16d6 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x64>
+            return len_;
+    16bd:	|  |  |        |  \-> 48 8b 47 08          	mov    0x8(%rdi),%rax
+            return alloc_;
+    16c1:	|  |  |        |      48 8b 17             	mov    (%rdi),%rdx
+    16c4:	|  |  |        |      48 8d 48 01          	lea    0x1(%rax),%rcx
+    16c8:	|  |  |        |      48 39 ca             	cmp    %rcx,%rdx
+    16cb:	|  |  +--------|----- 0f 83 e0 00 00 00    	jae    17b1 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x13f>
+    16d1:	|  |  |     /--|----- e9 97 00 00 00       	jmp    176d <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0xfb>
+            Node *new_n = realloc(nullptr, capacity);
+    16d6:	|  |  |     |  \----> b8 10 00 00 00       	mov    $0x10,%eax
+    16db:	|  |  |     |         48 39 c6             	cmp    %rax,%rsi
+    16de:	|  |  |     |         48 0f 42 f0          	cmovb  %rax,%rsi
+    16e2:	|  |  |     |         31 ff                	xor    %edi,%edi
+    16e4:	|  |  |     |         e8 dc fc ff ff       	call   13c5 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+    16e9:	|  |  |     |         49 89 c7             	mov    %rax,%r15
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    16ec:	|  |  |     |         48 85 c0             	test   %rax,%rax
+    16ef:	|  |  |  /--|-------- 0f 84 cf 00 00 00    	je     17c4 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x152>
+    16f5:	|  |  |  |  |         48 8d 0d 98 09 00 00 	lea    0x998(%rip),%rcx        # 2094 <_IO_stdin_used+0x94>
+    16fc:	|  |  |  |  |         31 d2                	xor    %edx,%edx
+    16fe:	|  |  |  |  |         48 89 50 08          	mov    %rdx,0x8(%rax)
+            n->push_back_relocated(inline_ptr(), len_);
+    1702:	|  |  |  |  |         48 8b 44 24 38       	mov    0x38(%rsp),%rax
+    1707:	|  |  |  |  |         48 89 4c 24 18       	mov    %rcx,0x18(%rsp)
+            , file_name_(file_name)
+    170c:	|  |  |  |  |         48 8d 0d 29 09 00 00 	lea    0x929(%rip),%rcx        # 203c <_IO_stdin_used+0x3c>
+    1713:	|  |  |  |  |         48 89 4c 24 20       	mov    %rcx,0x20(%rsp)
+            , line_num_(line_num)
+    1718:	|  |  |  |  |         c7 44 24 28 5c 01 00 	movl   $0x15c,0x28(%rsp)
+    171f:	|  |  |  |  |         00 
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    1720:	|  |  |  |  |         49 39 07             	cmp    %rax,(%r15)
+    1723:	|  |  |  |  |     /-- 73 11                	jae    1736 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0xc4>
+    1725:	|  |  |  |  |     |   48 8d 74 24 18       	lea    0x18(%rsp),%rsi
+    172a:	|  |  |  |  |     |   48 8d 3d 77 09 00 00 	lea    0x977(%rip),%rdi        # 20a8 <_IO_stdin_used+0xa8>
+    1731:	|  |  |  |  |     |   e8 fc f9 ff ff       	call   1132 <nel::assert_fail(char const*, nel::Context const&)>
+        // Relocate n values from s onto the end, s is left uninitialised.
+        // Caller must have made room.
+        void push_back_relocated(Type s[], Count const n)
+        {
+            nel::assert(len() + n <= capacity(), "heaped::Node: no room");
+            elem::relocate(&values_[len_], s, n);
+    1736:	|  |  |  |  |     \-> 49 8d 7f 10          	lea    0x10(%r15),%rdi
+void relocate(uint8_t *const d, uint8_t *const s, Length const n);
+
+template<typename T>
+void relocate(T d[], T s[], Length const n)
+{
+    if (d == s) { return; }
+    173a:	|  |  |  |  |         48 8d 74 24 40       	lea    0x40(%rsp),%rsi
+    173f:	|  |  |  |  |         48 39 f7             	cmp    %rsi,%rdi
+    1742:	|  |  |  |  |     /-- 74 17                	je     175b <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0xe9>
+    if constexpr (is_trivially_relocatable<T>) {
+        relocate(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t *>(s), n * sizeof(T));
+    1744:	|  |  |  |  |     |   48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    174b:	|  |  |  |  |     |   00 
+    174c:	|  |  |  |  |     |   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1751:	|  |  |  |  |     |   e8 ea 01 00 00       	call   1940 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>
+    1756:	|  |  |  |  |     |   48 8b 44 24 08       	mov    0x8(%rsp),%rax
+            len_ += n;
+    175b:	|  |  |  |  |     \-> 49 01 47 08          	add    %rax,0x8(%r15)
+            len_ = 0;
+    175f:	|  |  |  |  |         31 c0                	xor    %eax,%eax
+    1761:	|  |  |  |  |         48 89 44 24 38       	mov    %rax,0x38(%rsp)
+            item_ = n;
+    1766:	|  |  |  |  |         4c 89 7c 24 30       	mov    %r15,0x30(%rsp)
+    176b:	|  |  +--|--|-------- eb 44                	jmp    17b1 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x13f>
+    176d:	|  |  |  |  \-------> 48 83 fa 03          	cmp    $0x3,%rdx
+    1771:	|  |  |  |     /----- 77 18                	ja     178b <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x119>
+    1773:	|  |  |  |     |      ba 04 00 00 00       	mov    $0x4,%edx
+    1778:	|  |  |  |     |      48 39 d0             	cmp    %rdx,%rax
+    177b:	|  |  |  |     |      48 0f 42 c2          	cmovb  %rdx,%rax
+    177f:	|  |  |  |     |      48 39 c8             	cmp    %rcx,%rax
+    1782:	|  |  |  |     |      48 0f 43 c8          	cmovae %rax,%rcx
+    1786:	|  |  |  |     |      48 89 ce             	mov    %rcx,%rsi
+    1789:	|  |  |  |     |  /-- eb 17                	jmp    17a2 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x130>
+    178b:	|  |  |  |     \--|-> 48 8d 34 12          	lea    (%rdx,%rdx,1),%rsi
+    178f:	|  |  |  |        |   48 39 ce             	cmp    %rcx,%rsi
+    1792:	|  |  |  |        |   48 0f 42 f1          	cmovb  %rcx,%rsi
+    1796:	|  |  |  |        |   48 39 c6             	cmp    %rax,%rsi
+    1799:	|  |  |  |        |   48 0f 42 f0          	cmovb  %rax,%rsi
+                return spill(Growth::capacity_for(N, new_cap));
+            }
+
+            new_cap = Growth::capacity_for(capacity(), new_cap);
+            if (new_cap < len()) { new_cap = len(); }
+            if (new_cap == item_->capacity()) { return true; }
+    179d:	|  |  |  |        |   48 39 f2             	cmp    %rsi,%rdx
+    17a0:	|  |  +--|--------|-- 74 0f                	je     17b1 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x13f>
+
+            VectorNode *p = VectorNode::realloc(item_, new_cap);
+    17a2:	|  |  |  |        \-> e8 1e fc ff ff       	call   13c5 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+            if (p == nullptr) { return false; }
+    17a7:	|  |  |  |            48 85 c0             	test   %rax,%rax
+    17aa:	|  |  |  +----------- 74 18                	je     17c4 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x152>
+            item_ = p;
+    17ac:	|  |  |  |            48 89 44 24 30       	mov    %rax,0x30(%rsp)
+         * @returns if unsuccessful, Result<void, T>::Err() holding val
+         */
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+        {
+            if (!try_reserve_for(1)) { return Result<void, Type>::Err(move(val)); }
+            if (item_ != nullptr) { return item_->push_back(move(val)); }
+    17b1:	|  |  \--|----------> 48 8b 44 24 30       	mov    0x30(%rsp),%rax
+    17b6:	|  |     |            48 85 c0             	test   %rax,%rax
+    17b9:	|  |     |     /----- 74 26                	je     17e1 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x16f>
+            return len_;
+    17bb:	|  |     |     |      48 8b 50 08          	mov    0x8(%rax),%rdx
+            if (len() >= capacity()) {
+    17bf:	|  |     |     |      48 3b 10             	cmp    (%rax),%rdx
+    17c2:	|  |     |     |  /-- 72 0f                	jb     17d3 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x161>
+            : tag_(Tag::ERR)
+    17c4:	|  |     \-----|--|-> c7 44 24 10 02 00 00 	movl   $0x2,0x10(%rsp)
+    17cb:	|  |           |  |   00 
+            : value_(forward<Type>(val))
+    17cc:	|  |           |  |   44 89 64 24 14       	mov    %r12d,0x14(%rsp)
+            return Result(Phantom<Tag::ERR>(), forward<E>(v));
+    17d1:	|  |        /--|--|-- eb 28                	jmp    17fb <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x189>
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    17d3:	|  |        |  |  \-> 44 89 64 90 10       	mov    %r12d,0x10(%rax,%rdx,4)
+            len_ += 1;
+    17d8:	|  |        |  |      48 ff c2             	inc    %rdx
+    17db:	|  |        |  |      48 89 50 08          	mov    %rdx,0x8(%rax)
+        constexpr Result(Phantom<Tag::OK> const)
+    17df:	|  |        |  |  /-- eb 12                	jmp    17f3 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x181>
+            new (&inline_ptr()[len_]) Type(move(val));
+    17e1:	|  |        |  \--|-> 48 8b 44 24 38       	mov    0x38(%rsp),%rax
+    17e6:	|  |        |     |   44 89 64 84 40       	mov    %r12d,0x40(%rsp,%rax,4)
+            len_ += 1;
+    17eb:	|  |        |     |   48 ff c0             	inc    %rax
+    17ee:	|  |        |     |   48 89 44 24 38       	mov    %rax,0x38(%rsp)
+            : tag_(Tag::OK)
+    17f3:	|  |        |     \-> c7 44 24 10 01 00 00 	movl   $0x1,0x10(%rsp)
+    17fa:	|  |        |         00 
+            , file_name_(file_name)
+    17fb:	|  |        \-------> 48 8d 05 6b 08 00 00 	lea    0x86b(%rip),%rax        # 206d <_IO_stdin_used+0x6d>
+            : fn_name_(fn_name)
+    1802:	|  |                  4c 89 74 24 18       	mov    %r14,0x18(%rsp)
+            , file_name_(file_name)
+    1807:	|  |                  48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    180c:	|  |                  8b 44 24 10          	mov    0x10(%rsp),%eax
+            , line_num_(line_num)
+    1810:	|  |                  c7 44 24 28 17 00 00 	movl   $0x17,0x28(%rsp)
+    1817:	|  |                  00 
+            switch (tag_) { // result<void>-match
+    1818:	|  |                  85 c0                	test   %eax,%eax
+    181a:	|  |              /-- 74 20                	je     183c <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x1ca>
+    181c:	|  |              |   ff c8                	dec    %eax
+    181e:	|  |              |   83 f8 01             	cmp    $0x1,%eax
+    1821:	|  |        /-----|-- 77 27                	ja     184a <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x1d8>
+    1823:	|  |        |     |   48 8d 7c 24 10       	lea    0x10(%rsp),%rdi
+            for (nel::Index j = 0; j < n_values; ++j) {
+    1828:	|  |        |     |   48 ff c5             	inc    %rbp
+                v.push(int(i + j)).is_ok();
+    182b:	|  |        |     |   e8 5a fb ff ff       	call   138a <nel::Result<void, int>::~Result()>
+            for (nel::Index j = 0; j < n_values; ++j) {
+    1830:	|  |        |     |   48 83 fd 06          	cmp    $0x6,%rbp
+    1834:	|  \--------|-----|-- 0f 85 60 fe ff ff    	jne    169a <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x28>
+    183a:	|           |  /--|-- eb 1f                	jmp    185b <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x1e9>
+                    nel::panic("invalid Result", ctx);
+    183c:	|           |  |  \-> 48 8d 74 24 18       	lea    0x18(%rsp),%rsi
+    1841:	|           |  |      48 8d 3d 0b 08 00 00 	lea    0x80b(%rip),%rdi        # 2053 <_IO_stdin_used+0x53>
+    1848:	|           |  |  /-- eb 0c                	jmp    1856 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x1e4>
+                    nel::panic("bad Result", ctx);
+    184a:	|           \--|--|-> 48 8d 74 24 18       	lea    0x18(%rsp),%rsi
+    184f:	|              |  |   48 8d 3d d3 07 00 00 	lea    0x7d3(%rip),%rdi        # 2029 <_IO_stdin_used+0x29>
+    1856:	|              |  \-> e8 a7 f8 ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+            return (item_ == nullptr) ? Slice<Type>(inline_ptr(), len_) : item_->slice();
+    185b:	|              \----> 48 8b 7c 24 30       	mov    0x30(%rsp),%rdi
+    1860:	|                     48 85 ff             	test   %rdi,%rdi
+    1863:	|              /----- 75 0c                	jne    1871 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x1ff>
+    1865:	|              |      48 8b 4c 24 38       	mov    0x38(%rsp),%rcx
+            : content_(p)
+    186a:	|              |      48 8d 44 24 40       	lea    0x40(%rsp),%rax
+        }
+    186f:	|              |  /-- eb 08                	jmp    1879 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x207>
+            return len_;
+    1871:	|              \--|-> 48 8b 4f 08          	mov    0x8(%rdi),%rcx
+            return Slice(values_, len());
+    1875:	|                 |   48 8d 47 10          	lea    0x10(%rdi),%rax
+    auto t = bench::time_ns([&sum]() {
+    1879:	|                 \-> 49 8b 55 00          	mov    0x0(%r13),%rdx
+            , e_(arr + len)
+    187d:	|                     48 8d 0c 88          	lea    (%rax,%rcx,4),%rcx
+    1881:	|              /----> 48 39 c1             	cmp    %rax,%rcx
+    1884:	|              |  /-- 74 0c                	je     1892 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x220>
+            v.iter().for_each([&sum](int const &e) { sum += (long unsigned int)e; });
+    1886:	|              |  |   48 63 30             	movslq (%rax),%rsi
+    1889:	|              |  |   48 83 c0 04          	add    $0x4,%rax
+    188d:	|              |  |   48 01 32             	add    %rsi,(%rdx)
+        }
+    1890:	|              \--|-- eb ef                	jmp    1881 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x20f>
+            if (item_ != nullptr) {
+    1892:	|                 \-> 48 85 ff             	test   %rdi,%rdi
+    1895:	|                 /-- 74 05                	je     189c <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x22a>
+    1897:	|                 |   e8 94 f7 ff ff       	call   1030 <free@plt>
+        for (nel::Index i = 0; i < n_lists; ++i) {
+    189c:	|                 \-> 48 ff c3             	inc    %rbx
+    189f:	|                     48 81 fb 40 42 0f 00 	cmp    $0xf4240,%rbx
+    18a6:	\-------------------- 0f 85 e0 fd ff ff    	jne    168c <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const+0x1a>
+    auto t = bench::time_ns([&sum]() {
+    18ac:	                      48 83 c4 68          	add    $0x68,%rsp
+    18b0:	                      5b                   	pop    %rbx
+    18b1:	                      5d                   	pop    %rbp
+    18b2:	                      41 5c                	pop    %r12
+    18b4:	                      41 5d                	pop    %r13
+    18b6:	                      41 5e                	pop    %r14
+    18b8:	                      41 5f                	pop    %r15
+    18ba:	                      c3                   	ret
+
+00000000000018bb <void bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)>:
+void bench_lists(char const *const name)
+    18bb:	55                   	push   %rbp
+    long unsigned int sum = 0;
+    18bc:	31 c0                	xor    %eax,%eax
+void bench_lists(char const *const name)
+    18be:	53                   	push   %rbx
+    18bf:	48 89 fb             	mov    %rdi,%rbx
+    18c2:	48 83 ec 18          	sub    $0x18,%rsp
+    long unsigned int sum = 0;
+    18c6:	48 89 04 24          	mov    %rax,(%rsp)
+    auto t = bench::time_ns([&sum]() {
+    18ca:	48 89 e0             	mov    %rsp,%rax
+    18cd:	48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    long unsigned int const b = now_ns();
+    18d2:	e8 b2 f9 ff ff       	call   1289 <bench::now_ns()>
+    f();
+    18d7:	48 8d 7c 24 08       	lea    0x8(%rsp),%rdi
+    long unsigned int const b = now_ns();
+    18dc:	48 89 c5             	mov    %rax,%rbp
+    f();
+    18df:	e8 8e fd ff ff       	call   1672 <bench_lists<nel::heaped::SmallVector<int, 8ul, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)::{lambda()#1}::operator()() const>
+    return now_ns() - b;
+    18e4:	e8 a0 f9 ff ff       	call   1289 <bench::now_ns()>
+    bench::report(name, t);
+    18e9:	31 d2                	xor    %edx,%edx
+    18eb:	48 89 df             	mov    %rbx,%rdi
+    18ee:	48 29 e8             	sub    %rbp,%rax
+    18f1:	48 89 c6             	mov    %rax,%rsi
+    18f4:	e8 b3 f9 ff ff       	call   12ac <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << sum << '\n';
+    18f9:	48 8d 35 8c 07 00 00 	lea    0x78c(%rip),%rsi        # 208c <_IO_stdin_used+0x8c>
+    1900:	48 8d 3d 62 27 00 00 	lea    0x2762(%rip),%rdi        # 4069 <nel::log>
+    1907:	e8 be 02 00 00       	call   1bca <nel::operator<<(nel::Log&, char const*)>
+    190c:	48 8b 34 24          	mov    (%rsp),%rsi
+    1910:	48 89 c7             	mov    %rax,%rdi
+    1913:	e8 4d 03 00 00       	call   1c65 <nel::operator<<(nel::Log&, unsigned long)>
+    1918:	be 0a 00 00 00       	mov    $0xa,%esi
+    191d:	48 89 c7             	mov    %rax,%rdi
+    1920:	e8 8c 02 00 00       	call   1bb1 <nel::operator<<(nel::Log&, char)>
+}
+    1925:	48 83 c4 18          	add    $0x18,%rsp
+    1929:	5b                   	pop    %rbx
+    192a:	5d                   	pop    %rbp
+    192b:	c3                   	ret
+
+000000000000192c <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    192c:	48 89 d1             	mov    %rdx,%rcx
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    192f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1931:	c3                   	ret
+
+0000000000001932 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    1932:	48 89 d1             	mov    %rdx,%rcx
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    1935:	89 f0                	mov    %esi,%eax
+    1937:	f3 aa                	rep stos %al,%es:(%rdi)
+}
+    1939:	c3                   	ret
+
+000000000000193a <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    193a:	48 89 d1             	mov    %rdx,%rcx
+    193d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    193f:	c3                   	ret
+
+0000000000001940 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    1940:	e9 6b f7 ff ff       	jmp    10b0 <memmove@plt>
+
+0000000000001945 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    1945:	48 89 f1             	mov    %rsi,%rcx
+    std::memset(d, s, n);
+    1948:	b0 a5                	mov    $0xa5,%al
+    194a:	f3 aa                	rep stos %al,%es:(%rdi)
+    set(d, 0xa5, n);
+}
+    194c:	c3                   	ret
+
+000000000000194d <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    194d:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    194e:	e8 2d f7 ff ff       	call   1080 <memcmp@plt>
+}
+    1953:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) == 0;
+    1954:	85 c0                	test   %eax,%eax
+    1956:	0f 94 c0             	sete   %al
+}
+    1959:	c3                   	ret
+
+000000000000195a <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    195a:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    195b:	e8 20 f7 ff ff       	call   1080 <memcmp@plt>
+}
+    1960:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) != 0;
+    1961:	85 c0                	test   %eax,%eax
+    1963:	0f 95 c0             	setne  %al
+}
+    1966:	c3                   	ret
+
+0000000000001967 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+{
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1967:	          49 89 fa             	mov    %rdi,%r10
+    196a:	          48 89 f0             	mov    %rsi,%rax
+    if (n < streaming_min) {
+    196d:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1974:	      /-- 77 05                	ja     197b <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14>
+    std::memcpy(d, s, n);
+    1976:	      |   48 89 d1             	mov    %rdx,%rcx
+    1979:	/-----|-- eb 79                	jmp    19f4 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x8d>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    197b:	|     \-> 48 89 f9             	mov    %rdi,%rcx
+    197e:	|         48 f7 d9             	neg    %rcx
+    1981:	|         83 e1 0f             	and    $0xf,%ecx
+    1984:	|         49 89 c8             	mov    %rcx,%r8
+    std::memcpy(d, s, n);
+    1987:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1989:	|         49 8d 70 40          	lea    0x40(%r8),%rsi
+    198d:	|         48 89 f9             	mov    %rdi,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1990:	|     /-> 0f 10 54 30 d0       	movups -0x30(%rax,%rsi,1),%xmm2
+    1995:	|     |   0f 10 4c 30 e0       	movups -0x20(%rax,%rsi,1),%xmm1
+    199a:	|     |   49 89 f0             	mov    %rsi,%r8
+    for (; i + 64 <= n; i += 64) {
+    199d:	|     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    19a1:	|     |   0f 10 44 30 f0       	movups -0x10(%rax,%rsi,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    19a6:	|     |   0f 10 5c 30 c0       	movups -0x40(%rax,%rsi,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    19ab:	|     |   48 83 c6 40          	add    $0x40,%rsi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    19af:	|     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    19b4:	|     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    19b9:	|     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    19be:	|     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    19c3:	|     |   48 39 f2             	cmp    %rsi,%rdx
+    19c6:	|     \-- 73 c8                	jae    1990 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x29>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    19c8:	|  /----> 49 8d 48 10          	lea    0x10(%r8),%rcx
+        stream16(d + i, load16(s + i));
+    19cc:	|  |      4f 8d 0c 02          	lea    (%r10,%r8,1),%r9
+    for (; i + 16 <= n; i += 16) {
+    19d0:	|  |      48 39 ca             	cmp    %rcx,%rdx
+    19d3:	|  |  /-- 72 0f                	jb     19e4 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x7d>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    19d5:	|  |  |   0f 10 64 08 f0       	movups -0x10(%rax,%rcx,1),%xmm4
+    19da:	|  |  |   49 89 c8             	mov    %rcx,%r8
+    19dd:	|  |  |   66 41 0f e7 21       	movntdq %xmm4,(%r9)
+    for (; i + 16 <= n; i += 16) {
+    19e2:	|  \--|-- eb e4                	jmp    19c8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x61>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    19e4:	|     \-> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    19e7:	|         4c 29 c2             	sub    %r8,%rdx
+        stream16(d + i, load16(s + i));
+    19ea:	|         4a 8d 34 00          	lea    (%rax,%r8,1),%rsi
+    std::memcpy(d, s, n);
+    19ee:	|         4c 89 cf             	mov    %r9,%rdi
+    copy(d + i, s + i, n - i);
+    19f1:	|         48 89 d1             	mov    %rdx,%rcx
+    std::memcpy(d, s, n);
+    19f4:	\-------> f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    19f6:	          c3                   	ret
+
+00000000000019f7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    19f7:	          49 89 f8             	mov    %rdi,%r8
+    if (n < streaming_min) {
+    19fa:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1a01:	/-------- 77 37                	ja     1a3a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x43>
+    Length done = (n < 16) ? n : 16;
+    1a03:	|         b8 10 00 00 00       	mov    $0x10,%eax
+    1a08:	|         48 39 c2             	cmp    %rax,%rdx
+    1a0b:	|         48 0f 46 c2          	cmovbe %rdx,%rax
+    std::memcpy(d, s, n);
+    1a0f:	|         89 c1                	mov    %eax,%ecx
+    1a11:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    1a13:	|  /----> 48 39 d0             	cmp    %rdx,%rax
+    1a16:	|  |  /-- 73 21                	jae    1a39 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42>
+        Length const m = (done < n - done) ? done : n - done;
+    1a18:	|  |  |   49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    1a1b:	|  |  |   4d 8d 14 00          	lea    (%r8,%rax,1),%r10
+    std::memcpy(d, s, n);
+    1a1f:	|  |  |   4c 89 c6             	mov    %r8,%rsi
+        Length const m = (done < n - done) ? done : n - done;
+    1a22:	|  |  |   49 29 c1             	sub    %rax,%r9
+    std::memcpy(d, s, n);
+    1a25:	|  |  |   4c 89 d7             	mov    %r10,%rdi
+        Length const m = (done < n - done) ? done : n - done;
+    1a28:	|  |  |   49 39 c1             	cmp    %rax,%r9
+    1a2b:	|  |  |   4c 0f 47 c8          	cmova  %rax,%r9
+    std::memcpy(d, s, n);
+    1a2f:	|  |  |   44 89 c9             	mov    %r9d,%ecx
+        done += m;
+    1a32:	|  |  |   4c 01 c8             	add    %r9,%rax
+    std::memcpy(d, s, n);
+    1a35:	|  |  |   f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+        done += m;
+    1a37:	|  \--|-- eb da                	jmp    1a13 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c>
+    1a39:	|     \-> c3                   	ret
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1a3a:	\-------> 48 89 f8             	mov    %rdi,%rax
+    for (Index i = 0; i < head; ++i) {
+    1a3d:	          31 c9                	xor    %ecx,%ecx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1a3f:	          48 f7 d8             	neg    %rax
+    1a42:	          83 e0 0f             	and    $0xf,%eax
+    for (Index i = 0; i < head; ++i) {
+    1a45:	   /----> 48 39 c1             	cmp    %rax,%rcx
+    1a48:	   |  /-- 74 0d                	je     1a57 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x60>
+        d[i] = p[i];
+    1a4a:	   |  |   40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+    1a4e:	   |  |   41 88 3c 08          	mov    %dil,(%r8,%rcx,1)
+    for (Index i = 0; i < head; ++i) {
+    1a52:	   |  |   48 ff c1             	inc    %rcx
+    1a55:	   \--|-- eb ee                	jmp    1a45 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4e>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    1a57:	      \-> 31 c9                	xor    %ecx,%ecx
+        rotated[i] = p[(head + i) % 16];
+    1a59:	      /-> 48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+    1a5d:	      |   83 e7 0f             	and    $0xf,%edi
+    1a60:	      |   40 8a 3c 3e          	mov    (%rsi,%rdi,1),%dil
+    1a64:	      |   40 88 7c 0c e8       	mov    %dil,-0x18(%rsp,%rcx,1)
+    for (Index i = 0; i < 16; ++i) {
+    1a69:	      |   48 ff c1             	inc    %rcx
+    1a6c:	      |   48 83 f9 10          	cmp    $0x10,%rcx
+    1a70:	      \-- 75 e7                	jne    1a59 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x62>
+    std::memcpy(&v, s, sizeof(v));
+    1a72:	          0f 28 44 24 e8       	movaps -0x18(%rsp),%xmm0
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1a77:	          48 8d 78 40          	lea    0x40(%rax),%rdi
+    1a7b:	          4c 01 c0             	add    %r8,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1a7e:	      /-> 48 89 f9             	mov    %rdi,%rcx
+    for (; i + 64 <= n; i += 64) {
+    1a81:	      |   48 8d 7f 40          	lea    0x40(%rdi),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1a85:	      |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    1a89:	      |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    1a8e:	      |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    1a93:	      |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    1a98:	      |   48 83 c0 40          	add    $0x40,%rax
+    1a9c:	      |   48 39 fa             	cmp    %rdi,%rdx
+    1a9f:	      \-- 73 dd                	jae    1a7e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x87>
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+        stream16(d + i, v);
+    1aa1:	          49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    for (; i + 16 <= n; i += 16) {
+    1aa5:	   /----> 48 8d 41 10          	lea    0x10(%rcx),%rax
+    1aa9:	   |      48 39 c2             	cmp    %rax,%rdx
+    1aac:	   |  /-- 72 0a                	jb     1ab8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc1>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1aae:	   |  |   48 89 c1             	mov    %rax,%rcx
+    1ab1:	   |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    1ab6:	   \--|-- eb ed                	jmp    1aa5 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xae>
+    }
+    __builtin_ia32_sfence();
+    1ab8:	      \-> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    1abb:	   /----> 48 39 d1             	cmp    %rdx,%rcx
+    1abe:	   |  /-- 73 12                	jae    1ad2 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xdb>
+        d[i] = p[i % 16];
+    1ac0:	   |  |   48 89 c8             	mov    %rcx,%rax
+    1ac3:	   |  |   83 e0 0f             	and    $0xf,%eax
+    1ac6:	   |  |   8a 04 06             	mov    (%rsi,%rax,1),%al
+    1ac9:	   |  |   41 88 04 08          	mov    %al,(%r8,%rcx,1)
+    for (; i < n; ++i) {
+    1acd:	   |  |   48 ff c1             	inc    %rcx
+    1ad0:	   \--|-- eb e9                	jmp    1abb <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc4>
+    }
+}
+    1ad2:	      \-> c3                   	ret
+
+0000000000001ad3 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    1ad3:	    48 85 ff             	test   %rdi,%rdi
+    1ad6:	/-- 74 09                	je     1ae1 <nel::free_aligned(void*)+0xe>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    1ad8:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    1adc:	|   e9 4f f5 ff ff       	jmp    1030 <free@plt>
+}
+    1ae1:	\-> c3                   	ret
+
+0000000000001ae2 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    1ae2:	       41 56                	push   %r14
+            : fn_name_(fn_name)
+    1ae4:	       48 8d 05 4f 06 00 00 	lea    0x64f(%rip),%rax        # 213a <_IO_stdin_used+0x13a>
+    1aeb:	       41 55                	push   %r13
+    1aed:	       41 54                	push   %r12
+    1aef:	       55                   	push   %rbp
+    1af0:	       53                   	push   %rbx
+    1af1:	       48 83 ec 20          	sub    $0x20,%rsp
+    1af5:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , file_name_(file_name)
+    1afa:	       48 8d 05 49 06 00 00 	lea    0x649(%rip),%rax        # 214a <_IO_stdin_used+0x14a>
+    1b01:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1b06:	       c7 44 24 18 f3 00 00 	movl   $0xf3,0x18(%rsp)
+    1b0d:	       00 
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    1b0e:	       48 85 f6             	test   %rsi,%rsi
+    1b11:	/----- 74 28                	je     1b3b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1b13:	|      4c 8d 66 ff          	lea    -0x1(%rsi),%r12
+    1b17:	|      48 89 f3             	mov    %rsi,%rbx
+    1b1a:	|      49 21 f4             	and    %rsi,%r12
+    1b1d:	+----- 75 1c                	jne    1b3b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1b1f:	|      49 89 fd             	mov    %rdi,%r13
+    1b22:	|      49 89 d6             	mov    %rdx,%r14
+    1b25:	|      48 89 cd             	mov    %rcx,%rbp
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1b28:	|      31 ff                	xor    %edi,%edi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    1b2a:	|      4d 85 ed             	test   %r13,%r13
+    1b2d:	|  /-- 74 1d                	je     1b4c <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+    1b2f:	|  |   4d 8b 65 f8          	mov    -0x8(%r13),%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1b33:	|  |   4c 89 ef             	mov    %r13,%rdi
+    1b36:	|  |   4c 29 e7             	sub    %r12,%rdi
+    1b39:	|  +-- eb 11                	jmp    1b4c <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+    if (!pred) { assert_fail(msg, ctx); }
+    1b3b:	\--|-> 48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    1b40:	   |   48 8d 3d 15 06 00 00 	lea    0x615(%rip),%rdi        # 215c <_IO_stdin_used+0x15c>
+    1b47:	   |   e8 e6 f5 ff ff       	call   1132 <nel::assert_fail(char const*, nel::Context const&)>
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1b4c:	   \-> 48 8d 34 2b          	lea    (%rbx,%rbp,1),%rsi
+    1b50:	       e8 4b f5 ff ff       	call   10a0 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    1b55:	       48 85 c0             	test   %rax,%rax
+    1b58:	/----- 74 3b                	je     1b95 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb3>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1b5a:	|      48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    1b5f:	|      48 f7 db             	neg    %rbx
+    1b62:	|      48 21 d9             	and    %rbx,%rcx
+    1b65:	|      48 89 cb             	mov    %rcx,%rbx
+    1b68:	|      48 29 c3             	sub    %rax,%rbx
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    1b6b:	|      4d 85 ed             	test   %r13,%r13
+    1b6e:	|  /-- 74 1e                	je     1b8e <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+    1b70:	|  |   49 39 dc             	cmp    %rbx,%r12
+    1b73:	|  +-- 74 19                	je     1b8e <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    1b75:	|  |   4c 39 f5             	cmp    %r14,%rbp
+    1b78:	|  |   4c 89 f2             	mov    %r14,%rdx
+    1b7b:	|  |   4a 8d 34 20          	lea    (%rax,%r12,1),%rsi
+    1b7f:	|  |   48 89 cf             	mov    %rcx,%rdi
+    1b82:	|  |   48 0f 46 d5          	cmovbe %rbp,%rdx
+    1b86:	|  |   e8 25 f5 ff ff       	call   10b0 <memmove@plt>
+    1b8b:	|  |   48 89 c1             	mov    %rax,%rcx
+    }
+    offset_field(new_p) = new_offset;
+    1b8e:	|  \-> 48 89 59 f8          	mov    %rbx,-0x8(%rcx)
+    return new_p;
+    1b92:	|      48 89 c8             	mov    %rcx,%rax
+}
+    1b95:	\----> 48 83 c4 20          	add    $0x20,%rsp
+    1b99:	       5b                   	pop    %rbx
+    1b9a:	       5d                   	pop    %rbp
+    1b9b:	       41 5c                	pop    %r12
+    1b9d:	       41 5d                	pop    %r13
+    1b9f:	       41 5e                	pop    %r14
+    1ba1:	       c3                   	ret
+
+0000000000001ba2 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    1ba2:	48 89 f1             	mov    %rsi,%rcx
+    return realloc_aligned(nullptr, align, 0, size);
+    1ba5:	31 d2                	xor    %edx,%edx
+    1ba7:	48 89 fe             	mov    %rdi,%rsi
+    1baa:	31 ff                	xor    %edi,%edi
+    1bac:	e9 31 ff ff ff       	jmp    1ae2 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+
+0000000000001bb1 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1bb1:	53                   	push   %rbx
+    1bb2:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    1bb5:	40 0f be fe          	movsbl %sil,%edi
+    1bb9:	48 8b 35 a0 24 00 00 	mov    0x24a0(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    1bc0:	e8 ab f4 ff ff       	call   1070 <fputc@plt>
+    return outs;
+}
+    1bc5:	48 89 d8             	mov    %rbx,%rax
+    1bc8:	5b                   	pop    %rbx
+    1bc9:	c3                   	ret
+
+0000000000001bca <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1bca:	53                   	push   %rbx
+    1bcb:	48 89 fb             	mov    %rdi,%rbx
+    1bce:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    1bd1:	48 8b 35 88 24 00 00 	mov    0x2488(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    1bd8:	e8 83 f4 ff ff       	call   1060 <fputs@plt>
+    return outs;
+}
+    1bdd:	48 89 d8             	mov    %rbx,%rax
+    1be0:	5b                   	pop    %rbx
+    1be1:	c3                   	ret
+
+0000000000001be2 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1be2:	53                   	push   %rbx
+    1be3:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    1be6:	48 8b 3d 73 24 00 00 	mov    0x2473(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1bed:	40 0f b6 d6          	movzbl %sil,%edx
+    1bf1:	31 c0                	xor    %eax,%eax
+    1bf3:	48 8d 35 7d 05 00 00 	lea    0x57d(%rip),%rsi        # 2177 <_IO_stdin_used+0x177>
+    1bfa:	e8 91 f4 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1bff:	48 89 d8             	mov    %rbx,%rax
+    1c02:	5b                   	pop    %rbx
+    1c03:	c3                   	ret
+
+0000000000001c04 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    1c04:	53                   	push   %rbx
+    1c05:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    1c08:	48 8b 3d 51 24 00 00 	mov    0x2451(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1c0f:	0f b7 d6             	movzwl %si,%edx
+    1c12:	31 c0                	xor    %eax,%eax
+    1c14:	48 8d 35 5c 05 00 00 	lea    0x55c(%rip),%rsi        # 2177 <_IO_stdin_used+0x177>
+    1c1b:	e8 70 f4 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1c20:	48 89 d8             	mov    %rbx,%rax
+    1c23:	5b                   	pop    %rbx
+    1c24:	c3                   	ret
+
+0000000000001c25 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    1c25:	53                   	push   %rbx
+    1c26:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    1c29:	48 8b 3d 30 24 00 00 	mov    0x2430(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1c30:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    1c32:	31 c0                	xor    %eax,%eax
+    1c34:	48 8d 35 3c 05 00 00 	lea    0x53c(%rip),%rsi        # 2177 <_IO_stdin_used+0x177>
+    1c3b:	e8 50 f4 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1c40:	48 89 d8             	mov    %rbx,%rax
+    1c43:	5b                   	pop    %rbx
+    1c44:	c3                   	ret
+
+0000000000001c45 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    1c45:	53                   	push   %rbx
+    1c46:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    1c49:	48 8b 3d 10 24 00 00 	mov    0x2410(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1c50:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    1c52:	31 c0                	xor    %eax,%eax
+    1c54:	48 8d 35 1c 05 00 00 	lea    0x51c(%rip),%rsi        # 2177 <_IO_stdin_used+0x177>
+    1c5b:	e8 30 f4 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1c60:	48 89 d8             	mov    %rbx,%rax
+    1c63:	5b                   	pop    %rbx
+    1c64:	c3                   	ret
+
+0000000000001c65 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    1c65:	53                   	push   %rbx
+    1c66:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    1c69:	48 8b 3d f0 23 00 00 	mov    0x23f0(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1c70:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    1c73:	31 c0                	xor    %eax,%eax
+    1c75:	48 8d 35 fe 04 00 00 	lea    0x4fe(%rip),%rsi        # 217a <_IO_stdin_used+0x17a>
+    1c7c:	e8 0f f4 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1c81:	48 89 d8             	mov    %rbx,%rax
+    1c84:	5b                   	pop    %rbx
+    1c85:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000001c88 <_fini>:
+    1c88:	48 83 ec 08          	sub    $0x8,%rsp
+    1c8c:	48 83 c4 08          	add    $0x8,%rsp
+    1c90:	c3                   	ret
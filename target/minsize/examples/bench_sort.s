@@ -0,0 +1,2621 @@
+
+target/minsize/examples/bench_sort:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 ad 3f 00 00 	mov    0x3fad(%rip),%rax        # 4fb8 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 3f 00 00    	push   0x3fca(%rip)        # 4ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 3f 00 00    	jmp    *0x3fcc(%rip)        # 4ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 3f 00 00    	jmp    *0x3fca(%rip)        # 5000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 3f 00 00    	jmp    *0x3fc2(%rip)        # 5008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <qsort@plt>:
+    1050:	ff 25 ba 3f 00 00    	jmp    *0x3fba(%rip)        # 5010 <qsort@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <clock_gettime@plt>:
+    1060:	ff 25 b2 3f 00 00    	jmp    *0x3fb2(%rip)        # 5018 <clock_gettime@GLIBC_2.17>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputs@plt>:
+    1070:	ff 25 aa 3f 00 00    	jmp    *0x3faa(%rip)        # 5020 <fputs@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fputc@plt>:
+    1080:	ff 25 a2 3f 00 00    	jmp    *0x3fa2(%rip)        # 5028 <fputc@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 3f 00 00    	jmp    *0x3f9a(%rip)        # 5030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <realloc@plt>:
+    10a0:	ff 25 92 3f 00 00    	jmp    *0x3f92(%rip)        # 5038 <realloc@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010b0 <__cxa_finalize@plt>:
+    10b0:	ff 25 12 3f 00 00    	jmp    *0x3f12(%rip)        # 4fc8 <__cxa_finalize@GLIBC_2.2.5>
+    10b6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010c0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10c0:	50                   	push   %rax
+    std::abort();
+    10c1:	e8 7a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010c6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10c6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10c7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10ca:	4c 8d 0d 03 21 00 00 	lea    0x2103(%rip),%r9        # 31d4 <_IO_stdin_used+0x1d4>
+    10d1:	31 c0                	xor    %eax,%eax
+    10d3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10d7:	4c 8b 07             	mov    (%rdi),%r8
+    10da:	48 8d 35 f9 20 00 00 	lea    0x20f9(%rip),%rsi        # 31da <_IO_stdin_used+0x1da>
+    10e1:	48 8b 3d 78 3f 00 00 	mov    0x3f78(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+    10e8:	e8 a3 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    10ed:	e8 4e ff ff ff       	call   1040 <abort@plt>
+
+00000000000010f2 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    10f2:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    10f6:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    10f9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    10fd:	31 c0                	xor    %eax,%eax
+    10ff:	57                   	push   %rdi
+    1100:	48 8b 3d 59 3f 00 00 	mov    0x3f59(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+    1107:	4c 8d 0d c6 20 00 00 	lea    0x20c6(%rip),%r9        # 31d4 <_IO_stdin_used+0x1d4>
+    110e:	4c 8b 06             	mov    (%rsi),%r8
+    1111:	48 8d 35 d3 20 00 00 	lea    0x20d3(%rip),%rsi        # 31eb <_IO_stdin_used+0x1eb>
+    1118:	e8 73 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    111d:	e8 1e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001122 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1122:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1126:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1129:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    112d:	31 c0                	xor    %eax,%eax
+    112f:	57                   	push   %rdi
+    1130:	48 8b 3d 29 3f 00 00 	mov    0x3f29(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+    1137:	4c 8d 0d c2 20 00 00 	lea    0x20c2(%rip),%r9        # 3200 <_IO_stdin_used+0x200>
+    113e:	4c 8b 06             	mov    (%rsi),%r8
+    1141:	48 8d 35 a3 20 00 00 	lea    0x20a3(%rip),%rsi        # 31eb <_IO_stdin_used+0x1eb>
+    1148:	e8 43 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    114d:	e8 ee fe ff ff       	call   1040 <abort@plt>
+
+0000000000001152 <main>:
+    bench::report_per_item(name, t, s.len());
+    if (!sorted) { nel::log << "  not sorted!\n"; }
+}
+
+int main()
+{
+    1152:	             41 57                	push   %r15
+    auto v = nel::heaped::Vector<int>::with_capacity(n_values);
+    1154:	             be 40 42 0f 00       	mov    $0xf4240,%esi
+    auto b = nel::heaped::Vector<int>::with_capacity(n_values / 2);
+    1159:	             41 bf 40 42 0f 00    	mov    $0xf4240,%r15d
+{
+    115f:	             41 56                	push   %r14
+    1161:	             41 55                	push   %r13
+    1163:	             41 54                	push   %r12
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1165:	             4c 8d 25 09 1f 00 00 	lea    0x1f09(%rip),%r12        # 3075 <_IO_stdin_used+0x75>
+    116c:	             55                   	push   %rbp
+    116d:	             53                   	push   %rbx
+    116e:	             48 83 ec 78          	sub    $0x78,%rsp
+    auto v = nel::heaped::Vector<int>::with_capacity(n_values);
+    1172:	             4c 8d 74 24 28       	lea    0x28(%rsp),%r14
+    auto b = nel::heaped::Vector<int>::with_capacity(n_values / 2);
+    1177:	             4c 8d 6c 24 30       	lea    0x30(%rsp),%r13
+    auto v = nel::heaped::Vector<int>::with_capacity(n_values);
+    117c:	             4c 89 f7             	mov    %r14,%rdi
+    117f:	             e8 21 0e 00 00       	call   1fa5 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+    auto b = nel::heaped::Vector<int>::with_capacity(n_values / 2);
+    1184:	             be 20 a1 07 00       	mov    $0x7a120,%esi
+    1189:	             4c 89 ef             	mov    %r13,%rdi
+    118c:	             e8 14 0e 00 00       	call   1fa5 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+    for (nel::Index i = 0; i < n_values; ++i) {
+        v.push(0).unwrap();
+    1191:	         /-> 48 8d 44 24 38       	lea    0x38(%rsp),%rax
+    1196:	         |   31 f6                	xor    %esi,%esi
+    1198:	         |   48 8d 5c 24 48       	lea    0x48(%rsp),%rbx
+    119d:	         |   48 89 c2             	mov    %rax,%rdx
+    11a0:	         |   89 74 24 38          	mov    %esi,0x38(%rsp)
+    11a4:	         |   48 89 df             	mov    %rbx,%rdi
+    11a7:	         |   4c 89 f6             	mov    %r14,%rsi
+    11aa:	         |   48 89 04 24          	mov    %rax,(%rsp)
+            , file_name_(file_name)
+    11ae:	         |   48 8d 2d c5 1e 00 00 	lea    0x1ec5(%rip),%rbp        # 307a <_IO_stdin_used+0x7a>
+    11b5:	         |   e8 16 0e 00 00       	call   1fd0 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>
+    11ba:	         |   48 8d 44 24 58       	lea    0x58(%rsp),%rax
+    11bf:	         |   48 89 df             	mov    %rbx,%rdi
+            : fn_name_(fn_name)
+    11c2:	         |   4c 89 64 24 58       	mov    %r12,0x58(%rsp)
+    11c7:	         |   48 89 c6             	mov    %rax,%rsi
+            , file_name_(file_name)
+    11ca:	         |   48 89 6c 24 60       	mov    %rbp,0x60(%rsp)
+            , line_num_(line_num)
+    11cf:	         |   c7 44 24 68 56 00 00 	movl   $0x56,0x68(%rsp)
+    11d6:	         |   00 
+    11d7:	         |   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    11dc:	         |   e8 9f 0c 00 00       	call   1e80 <nel::Result<void, int>::unwrap(nel::Context const&)>
+    11e1:	         |   48 89 df             	mov    %rbx,%rdi
+    11e4:	         |   e8 5b 0c 00 00       	call   1e44 <nel::Result<void, int>::~Result()>
+    for (nel::Index i = 0; i < n_values; ++i) {
+    11e9:	         |   49 ff cf             	dec    %r15
+    11ec:	         \-- 75 a3                	jne    1191 <main+0x3f>
+    11ee:	             48 c7 44 24 18 20 a1 	movq   $0x7a120,0x18(%rsp)
+    11f5:	             07 00 
+    }
+    for (nel::Index i = 0; i < n_values / 2; ++i) {
+        b.push(0).unwrap();
+    11f7:	         /-> 48 8b 14 24          	mov    (%rsp),%rdx
+    11fb:	         |   31 c9                	xor    %ecx,%ecx
+    11fd:	         |   4c 89 ee             	mov    %r13,%rsi
+    1200:	         |   48 89 df             	mov    %rbx,%rdi
+    1203:	         |   89 4c 24 38          	mov    %ecx,0x38(%rsp)
+    1207:	         |   e8 c4 0d 00 00       	call   1fd0 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>
+    120c:	         |   48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    1211:	         |   48 89 df             	mov    %rbx,%rdi
+            : fn_name_(fn_name)
+    1214:	         |   4c 89 64 24 58       	mov    %r12,0x58(%rsp)
+            , file_name_(file_name)
+    1219:	         |   48 89 6c 24 60       	mov    %rbp,0x60(%rsp)
+            , line_num_(line_num)
+    121e:	         |   c7 44 24 68 59 00 00 	movl   $0x59,0x68(%rsp)
+    1225:	         |   00 
+    1226:	         |   e8 55 0c 00 00       	call   1e80 <nel::Result<void, int>::unwrap(nel::Context const&)>
+    122b:	         |   48 89 df             	mov    %rbx,%rdi
+    122e:	         |   e8 11 0c 00 00       	call   1e44 <nel::Result<void, int>::~Result()>
+    for (nel::Index i = 0; i < n_values / 2; ++i) {
+    1233:	         |   48 ff 4c 24 18       	decq   0x18(%rsp)
+    1238:	         \-- 75 bd                	jne    11f7 <main+0xa5>
+    }
+    nel::Slice<int> const s = v.slice();
+    123a:	             4c 8b 64 24 28       	mov    0x28(%rsp),%r12
+         *
+         * @returns a slice over the the vector.
+         */
+        constexpr Slice<Type> slice(void)
+        {
+            return (item_ == nullptr) ? Slice<Type>::empty() : item_->slice();
+    123f:	             4d 85 e4             	test   %r12,%r12
+    1242:	         /-- 75 0e                	jne    1252 <main+0x100>
+        Length len_;
+
+    private:
+        constexpr Slice(void)
+            : content_(nullptr)
+            , len_(0)
+    1244:	         |   31 d2                	xor    %edx,%edx
+    1246:	         |   48 89 54 24 38       	mov    %rdx,0x38(%rsp)
+    124b:	         |   48 89 54 24 40       	mov    %rdx,0x40(%rsp)
+         *
+         * @return fresh empty slice
+         */
+        static constexpr Slice empty(void)
+        {
+            return Slice();
+    1250:	      /--|-- eb 14                	jmp    1266 <main+0x114>
+            return alloc_;
+        }
+
+        constexpr Length len(void) const
+        {
+            return len_;
+    1252:	      |  \-> 49 8b 44 24 08       	mov    0x8(%r12),%rax
+        }
+
+    public:
+        constexpr Slice<Type> slice(void)
+        {
+            return Slice(values_, len());
+    1257:	      |      49 8d 54 24 10       	lea    0x10(%r12),%rdx
+    125c:	      |      48 89 54 24 38       	mov    %rdx,0x38(%rsp)
+            , len_(len)
+    1261:	      |      48 89 44 24 40       	mov    %rax,0x40(%rsp)
+    nel::Slice<int> const scratch = b.slice();
+    1266:	      \----> 4c 8b 6c 24 30       	mov    0x30(%rsp),%r13
+    126b:	             4d 85 ed             	test   %r13,%r13
+    126e:	         /-- 75 0e                	jne    127e <main+0x12c>
+            , len_(0)
+    1270:	         |   31 c0                	xor    %eax,%eax
+    1272:	         |   48 89 44 24 48       	mov    %rax,0x48(%rsp)
+    1277:	         |   48 89 44 24 50       	mov    %rax,0x50(%rsp)
+
+    for (int pat = 0; pat < 5; ++pat) {
+    127c:	      /--|-- eb 12                	jmp    1290 <main+0x13e>
+            return len_;
+    127e:	      |  \-> 49 8b 45 08          	mov    0x8(%r13),%rax
+            return Slice(values_, len());
+    1282:	      |      49 8d 55 10          	lea    0x10(%r13),%rdx
+    1286:	      |      48 89 54 24 48       	mov    %rdx,0x48(%rsp)
+            , len_(len)
+    128b:	      |      48 89 44 24 50       	mov    %rax,0x50(%rsp)
+    1290:	      \----> 45 31 f6             	xor    %r14d,%r14d
+        nel::log << pat_names[pat] << ", " << n_values << " ints\n";
+    1293:	/----------> 48 8d 05 06 3b 00 00 	lea    0x3b06(%rip),%rax        # 4da0 <pat_names>
+    129a:	|            48 8d 3d c8 3d 00 00 	lea    0x3dc8(%rip),%rdi        # 5069 <nel::log>
+    12a1:	|            44 89 74 24 14       	mov    %r14d,0x14(%rsp)
+    12a6:	|            4a 8b 34 f0          	mov    (%rax,%r14,8),%rsi
+    12aa:	|            e8 81 11 00 00       	call   2430 <nel::operator<<(nel::Log&, char const*)>
+    12af:	|            48 8d 35 db 1d 00 00 	lea    0x1ddb(%rip),%rsi        # 3091 <_IO_stdin_used+0x91>
+    12b6:	|            48 89 c7             	mov    %rax,%rdi
+    12b9:	|            e8 72 11 00 00       	call   2430 <nel::operator<<(nel::Log&, char const*)>
+    12be:	|            be 40 42 0f 00       	mov    $0xf4240,%esi
+    12c3:	|            48 89 c7             	mov    %rax,%rdi
+    12c6:	|            e8 00 12 00 00       	call   24cb <nel::operator<<(nel::Log&, unsigned long)>
+    12cb:	|            48 8d 35 c2 1d 00 00 	lea    0x1dc2(%rip),%rsi        # 3094 <_IO_stdin_used+0x94>
+    12d2:	|            48 89 c7             	mov    %rax,%rdi
+    12d5:	|            e8 56 11 00 00       	call   2430 <nel::operator<<(nel::Log&, char const*)>
+    fill(s, pat);
+    12da:	|            8b 74 24 14          	mov    0x14(%rsp),%esi
+    12de:	|            48 8b 3c 24          	mov    (%rsp),%rdi
+    12e2:	|            e8 89 04 00 00       	call   1770 <fill(nel::Slice<int> const&, int)>
+
+// Time a run of f(), in ns.
+template<typename F>
+long unsigned int time_ns(F &&f)
+{
+    long unsigned int const b = now_ns();
+    12e7:	|            e8 5c 0a 00 00       	call   1d48 <bench::now_ns()>
+         *
+         * @returns number of elements in the slice.
+         */
+        constexpr Length len(void) const
+        {
+            return len_;
+    12ec:	|            48 8b 5c 24 40       	mov    0x40(%rsp),%rbx
+            return content_;
+    12f1:	|            48 8b 6c 24 38       	mov    0x38(%rsp),%rbp
+        run("  qsort                  ", s, pat,
+            [](nel::Slice<int> const &s) { qsort(s.ptr(), s.len(), sizeof(int), cmp_int); });
+    12f6:	|            ba 04 00 00 00       	mov    $0x4,%edx
+    12fb:	|            48 8d 0d 49 05 00 00 	lea    0x549(%rip),%rcx        # 184b <cmp_int(void const*, void const*)>
+    1302:	|            49 89 c7             	mov    %rax,%r15
+    1305:	|            48 89 de             	mov    %rbx,%rsi
+    1308:	|            48 89 ef             	mov    %rbp,%rdi
+    130b:	|            e8 40 fd ff ff       	call   1050 <qsort@plt>
+    f();
+    return now_ns() - b;
+    1310:	|            e8 33 0a 00 00       	call   1d48 <bench::now_ns()>
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    1315:	|            ba 01 00 00 00       	mov    $0x1,%edx
+    131a:	|            4c 29 f8             	sub    %r15,%rax
+    bool sorted = true;
+    131d:	|            41 b7 01             	mov    $0x1,%r15b
+    1320:	|            48 89 c6             	mov    %rax,%rsi
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    1323:	|  /-------> 48 39 da             	cmp    %rbx,%rdx
+    1326:	|  |  /----- 73 16                	jae    133e <main+0x1ec>
+        sorted = sorted && !(s.ptr()[i] < s.ptr()[i - 1]);
+    1328:	|  |  |      45 84 ff             	test   %r15b,%r15b
+    132b:	|  |  |  /-- 74 0c                	je     1339 <main+0x1e7>
+    132d:	|  |  |  |   8b 44 95 fc          	mov    -0x4(%rbp,%rdx,4),%eax
+    1331:	|  |  |  |   39 44 95 00          	cmp    %eax,0x0(%rbp,%rdx,4)
+    1335:	|  |  |  |   41 0f 9d c7          	setge  %r15b
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    1339:	|  |  |  \-> 48 ff c2             	inc    %rdx
+    133c:	|  \--|----- eb e5                	jmp    1323 <main+0x1d1>
+    bench::report_per_item(name, t, s.len());
+    133e:	|     \----> 48 89 da             	mov    %rbx,%rdx
+    1341:	|            48 8d 3d 53 1d 00 00 	lea    0x1d53(%rip),%rdi        # 309b <_IO_stdin_used+0x9b>
+    1348:	|            e8 1e 0a 00 00       	call   1d6b <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    if (!sorted) { nel::log << "  not sorted!\n"; }
+    134d:	|            45 84 ff             	test   %r15b,%r15b
+    1350:	|        /-- 75 13                	jne    1365 <main+0x213>
+    1352:	|        |   48 8d 35 5c 1d 00 00 	lea    0x1d5c(%rip),%rsi        # 30b5 <_IO_stdin_used+0xb5>
+    1359:	|        |   48 8d 3d 09 3d 00 00 	lea    0x3d09(%rip),%rdi        # 5069 <nel::log>
+    1360:	|        |   e8 cb 10 00 00       	call   2430 <nel::operator<<(nel::Log&, char const*)>
+    fill(s, pat);
+    1365:	|        \-> 8b 74 24 14          	mov    0x14(%rsp),%esi
+    1369:	|            48 8b 3c 24          	mov    (%rsp),%rdi
+    136d:	|            e8 fe 03 00 00       	call   1770 <fill(nel::Slice<int> const&, int)>
+    long unsigned int const b = now_ns();
+    1372:	|            e8 d1 09 00 00       	call   1d48 <bench::now_ns()>
+    1377:	|            49 89 c7             	mov    %rax,%r15
+ * Equal items may be reordered.
+ */
+template<typename T, typename F>
+void unstable(T p[], Length const n, F &less)
+{
+    if (n < 2) { return; }
+    137a:	|            48 83 fb 01          	cmp    $0x1,%rbx
+    137e:	|     /----- 76 21                	jbe    13a1 <main+0x24f>
+    Count l = 0;
+    1380:	|     |      31 d2                	xor    %edx,%edx
+            return len_;
+    1382:	|     |      48 89 d8             	mov    %rbx,%rax
+        n /= 2;
+    1385:	|     |  /-> 48 d1 e8             	shr    %rax
+        l += 1;
+    1388:	|     |  |   48 ff c2             	inc    %rdx
+    while (n > 1) {
+    138b:	|     |  |   48 83 f8 01          	cmp    $0x1,%rax
+    138f:	|     |  \-- 75 f4                	jne    1385 <main+0x233>
+    pdq(p, n, less, log2(n), true);
+    1391:	|     |      b9 01 00 00 00       	mov    $0x1,%ecx
+    1396:	|     |      48 89 de             	mov    %rbx,%rsi
+    1399:	|     |      48 89 ef             	mov    %rbp,%rdi
+    139c:	|     |      e8 55 08 00 00       	call   1bf6 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]>
+    return now_ns() - b;
+    13a1:	|     \----> e8 a2 09 00 00       	call   1d48 <bench::now_ns()>
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    13a6:	|            ba 01 00 00 00       	mov    $0x1,%edx
+    13ab:	|            4c 29 f8             	sub    %r15,%rax
+    bool sorted = true;
+    13ae:	|            41 b7 01             	mov    $0x1,%r15b
+    13b1:	|            48 89 c6             	mov    %rax,%rsi
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    13b4:	|  /-------> 48 39 da             	cmp    %rbx,%rdx
+    13b7:	|  |  /----- 73 16                	jae    13cf <main+0x27d>
+        sorted = sorted && !(s.ptr()[i] < s.ptr()[i - 1]);
+    13b9:	|  |  |      45 84 ff             	test   %r15b,%r15b
+    13bc:	|  |  |  /-- 74 0c                	je     13ca <main+0x278>
+    13be:	|  |  |  |   8b 44 95 fc          	mov    -0x4(%rbp,%rdx,4),%eax
+    13c2:	|  |  |  |   39 44 95 00          	cmp    %eax,0x0(%rbp,%rdx,4)
+    13c6:	|  |  |  |   41 0f 9d c7          	setge  %r15b
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    13ca:	|  |  |  \-> 48 ff c2             	inc    %rdx
+    13cd:	|  \--|----- eb e5                	jmp    13b4 <main+0x262>
+    bench::report_per_item(name, t, s.len());
+    13cf:	|     \----> 48 89 da             	mov    %rbx,%rdx
+    13d2:	|            48 8d 3d eb 1c 00 00 	lea    0x1ceb(%rip),%rdi        # 30c4 <_IO_stdin_used+0xc4>
+    13d9:	|            e8 8d 09 00 00       	call   1d6b <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    if (!sorted) { nel::log << "  not sorted!\n"; }
+    13de:	|            45 84 ff             	test   %r15b,%r15b
+    13e1:	|        /-- 75 13                	jne    13f6 <main+0x2a4>
+    13e3:	|        |   48 8d 35 cb 1c 00 00 	lea    0x1ccb(%rip),%rsi        # 30b5 <_IO_stdin_used+0xb5>
+    13ea:	|        |   48 8d 3d 78 3c 00 00 	lea    0x3c78(%rip),%rdi        # 5069 <nel::log>
+    13f1:	|        |   e8 3a 10 00 00       	call   2430 <nel::operator<<(nel::Log&, char const*)>
+    fill(s, pat);
+    13f6:	|        \-> 8b 74 24 14          	mov    0x14(%rsp),%esi
+    13fa:	|            48 8b 3c 24          	mov    (%rsp),%rdi
+    13fe:	|            e8 6d 03 00 00       	call   1770 <fill(nel::Slice<int> const&, int)>
+    long unsigned int const b = now_ns();
+    1403:	|            e8 40 09 00 00       	call   1d48 <bench::now_ns()>
+         * Use sort_with() and some scratch space for O(n log n).
+         */
+        template<typename F = sort::Less>
+        void sort(F &&less = F())
+        {
+            sort::stable(ptr(), len(), static_cast<Type *>(nullptr), 0, less);
+    1408:	|            4c 8b 44 24 08       	mov    0x8(%rsp),%r8
+    140d:	|            31 d2                	xor    %edx,%edx
+    140f:	|            48 89 de             	mov    %rbx,%rsi
+    1412:	|            31 c9                	xor    %ecx,%ecx
+    1414:	|            48 89 ef             	mov    %rbp,%rdi
+    1417:	|            49 89 c7             	mov    %rax,%r15
+    141a:	|            e8 7e 0f 00 00       	call   239d <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&)>
+    return now_ns() - b;
+    141f:	|            e8 24 09 00 00       	call   1d48 <bench::now_ns()>
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    1424:	|            ba 01 00 00 00       	mov    $0x1,%edx
+    1429:	|            4c 29 f8             	sub    %r15,%rax
+    bool sorted = true;
+    142c:	|            41 b7 01             	mov    $0x1,%r15b
+    142f:	|            48 89 c6             	mov    %rax,%rsi
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    1432:	|  /-------> 48 39 da             	cmp    %rbx,%rdx
+    1435:	|  |  /----- 73 16                	jae    144d <main+0x2fb>
+        sorted = sorted && !(s.ptr()[i] < s.ptr()[i - 1]);
+    1437:	|  |  |      45 84 ff             	test   %r15b,%r15b
+    143a:	|  |  |  /-- 74 0c                	je     1448 <main+0x2f6>
+    143c:	|  |  |  |   8b 44 95 fc          	mov    -0x4(%rbp,%rdx,4),%eax
+    1440:	|  |  |  |   39 44 95 00          	cmp    %eax,0x0(%rbp,%rdx,4)
+    1444:	|  |  |  |   41 0f 9d c7          	setge  %r15b
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    1448:	|  |  |  \-> 48 ff c2             	inc    %rdx
+    144b:	|  \--|----- eb e5                	jmp    1432 <main+0x2e0>
+    bench::report_per_item(name, t, s.len());
+    144d:	|     \----> 48 89 da             	mov    %rbx,%rdx
+    1450:	|            48 8d 3d 87 1c 00 00 	lea    0x1c87(%rip),%rdi        # 30de <_IO_stdin_used+0xde>
+    1457:	|            e8 0f 09 00 00       	call   1d6b <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    if (!sorted) { nel::log << "  not sorted!\n"; }
+    145c:	|            45 84 ff             	test   %r15b,%r15b
+    145f:	|        /-- 75 13                	jne    1474 <main+0x322>
+    1461:	|        |   48 8d 35 4d 1c 00 00 	lea    0x1c4d(%rip),%rsi        # 30b5 <_IO_stdin_used+0xb5>
+    1468:	|        |   48 8d 3d fa 3b 00 00 	lea    0x3bfa(%rip),%rdi        # 5069 <nel::log>
+    146f:	|        |   e8 bc 0f 00 00       	call   2430 <nel::operator<<(nel::Log&, char const*)>
+    fill(s, pat);
+    1474:	|        \-> 8b 74 24 14          	mov    0x14(%rsp),%esi
+    1478:	|            48 8b 3c 24          	mov    (%rsp),%rdi
+    147c:	|            e8 ef 02 00 00       	call   1770 <fill(nel::Slice<int> const&, int)>
+    long unsigned int const b = now_ns();
+    1481:	|            e8 c2 08 00 00       	call   1d48 <bench::now_ns()>
+         * @param scratch items to use as temporary storage, left in a moved-from state.
+         */
+        template<typename F = sort::Less>
+        void sort_with(Slice const &scratch, F &&less = F())
+        {
+            sort::stable(ptr(), len(), scratch.ptr(), scratch.len(), less);
+    1486:	|            48 8b 54 24 48       	mov    0x48(%rsp),%rdx
+    148b:	|            48 89 de             	mov    %rbx,%rsi
+    148e:	|            48 89 ef             	mov    %rbp,%rdi
+    1491:	|            4c 8b 44 24 08       	mov    0x8(%rsp),%r8
+    1496:	|            48 8b 4c 24 50       	mov    0x50(%rsp),%rcx
+    149b:	|            49 89 c7             	mov    %rax,%r15
+    149e:	|            e8 fa 0e 00 00       	call   239d <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&)>
+    return now_ns() - b;
+    14a3:	|            e8 a0 08 00 00       	call   1d48 <bench::now_ns()>
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    14a8:	|            ba 01 00 00 00       	mov    $0x1,%edx
+    14ad:	|            4c 29 f8             	sub    %r15,%rax
+    bool sorted = true;
+    14b0:	|            41 b7 01             	mov    $0x1,%r15b
+    14b3:	|            48 89 c6             	mov    %rax,%rsi
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    14b6:	|  /-------> 48 39 da             	cmp    %rbx,%rdx
+    14b9:	|  |  /----- 73 16                	jae    14d1 <main+0x37f>
+        sorted = sorted && !(s.ptr()[i] < s.ptr()[i - 1]);
+    14bb:	|  |  |      45 84 ff             	test   %r15b,%r15b
+    14be:	|  |  |  /-- 74 0c                	je     14cc <main+0x37a>
+    14c0:	|  |  |  |   8b 44 95 fc          	mov    -0x4(%rbp,%rdx,4),%eax
+    14c4:	|  |  |  |   39 44 95 00          	cmp    %eax,0x0(%rbp,%rdx,4)
+    14c8:	|  |  |  |   41 0f 9d c7          	setge  %r15b
+    for (nel::Index i = 1; i < s.len(); ++i) {
+    14cc:	|  |  |  \-> 48 ff c2             	inc    %rdx
+    14cf:	|  \--|----- eb e5                	jmp    14b6 <main+0x364>
+    bench::report_per_item(name, t, s.len());
+    14d1:	|     \----> 48 89 da             	mov    %rbx,%rdx
+    14d4:	|            48 8d 3d 1d 1c 00 00 	lea    0x1c1d(%rip),%rdi        # 30f8 <_IO_stdin_used+0xf8>
+    14db:	|            e8 8b 08 00 00       	call   1d6b <bench::report_per_item(char const*, unsigned long, unsigned long)>
+    if (!sorted) { nel::log << "  not sorted!\n"; }
+    14e0:	|            45 84 ff             	test   %r15b,%r15b
+    14e3:	|        /-- 75 13                	jne    14f8 <main+0x3a6>
+    14e5:	|        |   48 8d 35 c9 1b 00 00 	lea    0x1bc9(%rip),%rsi        # 30b5 <_IO_stdin_used+0xb5>
+    14ec:	|        |   48 8d 3d 76 3b 00 00 	lea    0x3b76(%rip),%rdi        # 5069 <nel::log>
+    14f3:	|        |   e8 38 0f 00 00       	call   2430 <nel::operator<<(nel::Log&, char const*)>
+    for (int pat = 0; pat < 5; ++pat) {
+    14f8:	|        \-> 49 ff c6             	inc    %r14
+    14fb:	|            49 83 fe 05          	cmp    $0x5,%r14
+    14ff:	\----------- 0f 85 8e fd ff ff    	jne    1293 <main+0x141>
+            [&scratch](nel::Slice<int> s) { s.sort_with(scratch); });
+    }
+
+    // the 1000 smallest, and the median, of random ints.
+    {
+        fill(s, 0);
+    1505:	             48 8b 3c 24          	mov    (%rsp),%rdi
+    1509:	             31 f6                	xor    %esi,%esi
+    150b:	             e8 60 02 00 00       	call   1770 <fill(nel::Slice<int> const&, int)>
+    long unsigned int const b = now_ns();
+    1510:	             e8 33 08 00 00       	call   1d48 <bench::now_ns()>
+    1515:	             49 89 c6             	mov    %rax,%r14
+         * @param k number of items to sort, sorts all if k >= len().
+         */
+        template<typename F = sort::Less>
+        void partial_sort(Length k, F &&less = F())
+        {
+            if (k < len()) {
+    1518:	             48 81 fb e8 03 00 00 	cmp    $0x3e8,%rbx
+    151f:	      /----- 76 17                	jbe    1538 <main+0x3e6>
+                sort::select_nth(ptr(), len(), k, less);
+    1521:	      |      48 89 de             	mov    %rbx,%rsi
+    1524:	      |      ba e8 03 00 00       	mov    $0x3e8,%edx
+    1529:	      |      48 89 ef             	mov    %rbp,%rdi
+    152c:	      |      e8 9d 05 00 00       	call   1ace <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]>
+    1531:	      |      be e8 03 00 00       	mov    $0x3e8,%esi
+    1536:	      |  /-- eb 09                	jmp    1541 <main+0x3ef>
+    if (n < 2) { return; }
+    1538:	      \--|-> 48 83 fb 01          	cmp    $0x1,%rbx
+    153c:	      /--|-- 76 26                	jbe    1564 <main+0x412>
+            return len_;
+    153e:	      |  |   48 89 de             	mov    %rbx,%rsi
+                sort::select_nth(ptr(), len(), k, less);
+    1541:	      |  \-> 48 89 f0             	mov    %rsi,%rax
+        n /= 2;
+    1544:	      |  /-> 48 d1 e8             	shr    %rax
+        l += 1;
+    1547:	      |  |   48 ff 44 24 18       	incq   0x18(%rsp)
+    while (n > 1) {
+    154c:	      |  |   48 83 f8 01          	cmp    $0x1,%rax
+    1550:	      |  \-- 75 f2                	jne    1544 <main+0x3f2>
+    pdq(p, n, less, log2(n), true);
+    1552:	      |      48 8b 54 24 18       	mov    0x18(%rsp),%rdx
+    1557:	      |      b9 01 00 00 00       	mov    $0x1,%ecx
+    155c:	      |      48 89 ef             	mov    %rbp,%rdi
+    155f:	      |      e8 92 06 00 00       	call   1bf6 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]>
+    return now_ns() - b;
+    1564:	      \----> e8 df 07 00 00       	call   1d48 <bench::now_ns()>
+        auto t = bench::time_ns([&s]() { nel::Slice<int>(s).partial_sort(1000); });
+        bench::report_per_item("random, partial_sort 1000", t, s.len());
+    1569:	             48 89 da             	mov    %rbx,%rdx
+    156c:	             48 8d 3d 9f 1b 00 00 	lea    0x1b9f(%rip),%rdi        # 3112 <_IO_stdin_used+0x112>
+    }
+    {
+        fill(s, 0);
+        int m = 0;
+        auto t = bench::time_ns(
+            [&s, &m]() { m = nel::Slice<int>(s).select_nth_unstable(s.len() / 2); });
+    1573:	             49 89 df             	mov    %rbx,%r15
+    1576:	             4c 29 f0             	sub    %r14,%rax
+    1579:	             49 d1 ef             	shr    %r15
+    157c:	             48 89 c6             	mov    %rax,%rsi
+        bench::report_per_item("random, partial_sort 1000", t, s.len());
+    157f:	             e8 e7 07 00 00       	call   1d6b <bench::report_per_item(char const*, unsigned long, unsigned long)>
+        fill(s, 0);
+    1584:	             48 8b 3c 24          	mov    (%rsp),%rdi
+    1588:	             31 f6                	xor    %esi,%esi
+    158a:	             e8 e1 01 00 00       	call   1770 <fill(nel::Slice<int> const&, int)>
+    long unsigned int const b = now_ns();
+    158f:	             e8 b4 07 00 00       	call   1d48 <bench::now_ns()>
+    1594:	             c7 44 24 68 9f 02 00 	movl   $0x29f,0x68(%rsp)
+    159b:	             00 
+    159c:	             49 89 c6             	mov    %rax,%r14
+            : fn_name_(fn_name)
+    159f:	             48 8d 05 86 1b 00 00 	lea    0x1b86(%rip),%rax        # 312c <_IO_stdin_used+0x12c>
+    15a6:	             48 89 44 24 58       	mov    %rax,0x58(%rsp)
+            , file_name_(file_name)
+    15ab:	             48 8d 05 90 1b 00 00 	lea    0x1b90(%rip),%rax        # 3142 <_IO_stdin_used+0x142>
+    15b2:	             48 89 44 24 60       	mov    %rax,0x60(%rsp)
+    if (pred) { panic(msg, ctx); }
+}
+
+inline void panic_if_not(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { panic(msg, ctx); }
+    15b7:	             49 39 df             	cmp    %rbx,%r15
+    15ba:	         /-- 72 11                	jb     15cd <main+0x47b>
+    15bc:	         |   48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    15c1:	         |   48 8d 3d 8b 1b 00 00 	lea    0x1b8b(%rip),%rdi        # 3153 <_IO_stdin_used+0x153>
+    15c8:	         |   e8 25 fb ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+            sort::select_nth(ptr(), len(), idx, less);
+    15cd:	         \-> 48 89 ef             	mov    %rbp,%rdi
+    15d0:	             4c 89 fa             	mov    %r15,%rdx
+    15d3:	             48 89 de             	mov    %rbx,%rsi
+    15d6:	             e8 f3 04 00 00       	call   1ace <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]>
+            [&s, &m]() { m = nel::Slice<int>(s).select_nth_unstable(s.len() / 2); });
+    15db:	             42 8b 6c bd 00       	mov    0x0(%rbp,%r15,4),%ebp
+    return now_ns() - b;
+    15e0:	             e8 63 07 00 00       	call   1d48 <bench::now_ns()>
+        bench::report_per_item("random, select median    ", t, s.len());
+    15e5:	             48 89 da             	mov    %rbx,%rdx
+    15e8:	             48 8d 3d 98 1b 00 00 	lea    0x1b98(%rip),%rdi        # 3187 <_IO_stdin_used+0x187>
+    15ef:	             4c 29 f0             	sub    %r14,%rax
+    15f2:	             48 89 c6             	mov    %rax,%rsi
+    15f5:	             e8 71 07 00 00       	call   1d6b <bench::report_per_item(char const*, unsigned long, unsigned long)>
+        nel::log << "  median: " << m << '\n';
+    15fa:	             48 8d 35 a0 1b 00 00 	lea    0x1ba0(%rip),%rsi        # 31a1 <_IO_stdin_used+0x1a1>
+    1601:	             48 8d 3d 61 3a 00 00 	lea    0x3a61(%rip),%rdi        # 5069 <nel::log>
+    1608:	             e8 23 0e 00 00       	call   2430 <nel::operator<<(nel::Log&, char const*)>
+    160d:	             89 ee                	mov    %ebp,%esi
+    160f:	             48 89 c7             	mov    %rax,%rdi
+    1612:	             e8 94 0e 00 00       	call   24ab <nel::operator<<(nel::Log&, int)>
+    1617:	             be 0a 00 00 00       	mov    $0xa,%esi
+    161c:	             48 89 c7             	mov    %rax,%rdi
+    161f:	             e8 f3 0d 00 00       	call   2417 <nel::operator<<(nel::Log&, char)>
+            if (old == nullptr) { return; }
+    1624:	             4d 85 ed             	test   %r13,%r13
+    1627:	         /-- 74 08                	je     1631 <main+0x4df>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    1629:	         |   4c 89 ef             	mov    %r13,%rdi
+    162c:	         |   e8 ff f9 ff ff       	call   1030 <free@plt>
+    1631:	         \-> 4d 85 e4             	test   %r12,%r12
+    1634:	         /-- 74 08                	je     163e <main+0x4ec>
+    1636:	         |   4c 89 e7             	mov    %r12,%rdi
+    1639:	         |   e8 f2 f9 ff ff       	call   1030 <free@plt>
+    }
+}
+    163e:	         \-> 48 83 c4 78          	add    $0x78,%rsp
+    1642:	             31 c0                	xor    %eax,%eax
+    1644:	             5b                   	pop    %rbx
+    1645:	             5d                   	pop    %rbp
+    1646:	             41 5c                	pop    %r12
+    1648:	             41 5d                	pop    %r13
+    164a:	             41 5e                	pop    %r14
+    164c:	             41 5f                	pop    %r15
+    164e:	             c3                   	ret
+    164f:	             90                   	nop
+
+0000000000001650 <_start>:
+    1650:	31 ed                	xor    %ebp,%ebp
+    1652:	49 89 d1             	mov    %rdx,%r9
+    1655:	5e                   	pop    %rsi
+    1656:	48 89 e2             	mov    %rsp,%rdx
+    1659:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    165d:	50                   	push   %rax
+    165e:	54                   	push   %rsp
+    165f:	45 31 c0             	xor    %r8d,%r8d
+    1662:	31 c9                	xor    %ecx,%ecx
+    1664:	48 8d 3d e7 fa ff ff 	lea    -0x519(%rip),%rdi        # 1152 <main>
+    166b:	ff 15 37 39 00 00    	call   *0x3937(%rip)        # 4fa8 <__libc_start_main@GLIBC_2.34>
+    1671:	f4                   	hlt
+    1672:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1679:	00 00 00 
+    167c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001680 <deregister_tm_clones>:
+    1680:	    48 8d 3d c9 39 00 00 	lea    0x39c9(%rip),%rdi        # 5050 <__TMC_END__>
+    1687:	    48 8d 05 c2 39 00 00 	lea    0x39c2(%rip),%rax        # 5050 <__TMC_END__>
+    168e:	    48 39 f8             	cmp    %rdi,%rax
+    1691:	/-- 74 15                	je     16a8 <deregister_tm_clones+0x28>
+    1693:	|   48 8b 05 16 39 00 00 	mov    0x3916(%rip),%rax        # 4fb0 <_ITM_deregisterTMCloneTable@Base>
+    169a:	|   48 85 c0             	test   %rax,%rax
+    169d:	+-- 74 09                	je     16a8 <deregister_tm_clones+0x28>
+    169f:	|   ff e0                	jmp    *%rax
+    16a1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    16a8:	\-> c3                   	ret
+    16a9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000016b0 <register_tm_clones>:
+    16b0:	    48 8d 3d 99 39 00 00 	lea    0x3999(%rip),%rdi        # 5050 <__TMC_END__>
+    16b7:	    48 8d 35 92 39 00 00 	lea    0x3992(%rip),%rsi        # 5050 <__TMC_END__>
+    16be:	    48 29 fe             	sub    %rdi,%rsi
+    16c1:	    48 89 f0             	mov    %rsi,%rax
+    16c4:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    16c8:	    48 c1 f8 03          	sar    $0x3,%rax
+    16cc:	    48 01 c6             	add    %rax,%rsi
+    16cf:	    48 d1 fe             	sar    %rsi
+    16d2:	/-- 74 14                	je     16e8 <register_tm_clones+0x38>
+    16d4:	|   48 8b 05 e5 38 00 00 	mov    0x38e5(%rip),%rax        # 4fc0 <_ITM_registerTMCloneTable@Base>
+    16db:	|   48 85 c0             	test   %rax,%rax
+    16de:	+-- 74 08                	je     16e8 <register_tm_clones+0x38>
+    16e0:	|   ff e0                	jmp    *%rax
+    16e2:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    16e8:	\-> c3                   	ret
+    16e9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000016f0 <__do_global_dtors_aux>:
+    16f0:	       f3 0f 1e fa          	endbr64
+    16f4:	       80 3d 6d 39 00 00 00 	cmpb   $0x0,0x396d(%rip)        # 5068 <completed.0>
+    16fb:	/----- 75 2b                	jne    1728 <__do_global_dtors_aux+0x38>
+    16fd:	|      55                   	push   %rbp
+    16fe:	|      48 83 3d c2 38 00 00 	cmpq   $0x0,0x38c2(%rip)        # 4fc8 <__cxa_finalize@GLIBC_2.2.5>
+    1705:	|      00 
+    1706:	|      48 89 e5             	mov    %rsp,%rbp
+    1709:	|  /-- 74 0c                	je     1717 <__do_global_dtors_aux+0x27>
+    170b:	|  |   48 8b 3d 36 39 00 00 	mov    0x3936(%rip),%rdi        # 5048 <__dso_handle>
+    1712:	|  |   e8 99 f9 ff ff       	call   10b0 <__cxa_finalize@plt>
+    1717:	|  \-> e8 64 ff ff ff       	call   1680 <deregister_tm_clones>
+    171c:	|      c6 05 45 39 00 00 01 	movb   $0x1,0x3945(%rip)        # 5068 <completed.0>
+    1723:	|      5d                   	pop    %rbp
+    1724:	|      c3                   	ret
+    1725:	|      0f 1f 00             	nopl   (%rax)
+    1728:	\----> c3                   	ret
+    1729:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001730 <frame_dummy>:
+    1730:	f3 0f 1e fa          	endbr64
+    1734:	e9 77 ff ff ff       	jmp    16b0 <register_tm_clones>
+
+0000000000001739 <next_rand(unsigned int&)>:
+    s ^= s << 13;
+    1739:	66 0f 6e 0f          	movd   (%rdi),%xmm1
+    173d:	0f 28 d1             	movaps %xmm1,%xmm2
+    1740:	66 0f 72 f2 0d       	pslld  $0xd,%xmm2
+    1745:	0f 28 c2             	movaps %xmm2,%xmm0
+    1748:	0f 57 c1             	xorps  %xmm1,%xmm0
+    s ^= s >> 17;
+    174b:	0f 28 d8             	movaps %xmm0,%xmm3
+    174e:	66 0f 72 d3 11       	psrld  $0x11,%xmm3
+    1753:	0f 28 cb             	movaps %xmm3,%xmm1
+    1756:	0f 57 c8             	xorps  %xmm0,%xmm1
+    s ^= s << 5;
+    1759:	0f 28 e1             	movaps %xmm1,%xmm4
+    175c:	66 0f 72 f4 05       	pslld  $0x5,%xmm4
+    1761:	0f 28 c4             	movaps %xmm4,%xmm0
+    1764:	0f 57 c1             	xorps  %xmm1,%xmm0
+    1767:	66 0f 7e c0          	movd   %xmm0,%eax
+    176b:	66 0f 7e 07          	movd   %xmm0,(%rdi)
+}
+    176f:	c3                   	ret
+
+0000000000001770 <fill(nel::Slice<int> const&, int)>:
+{
+    1770:	                         48 83 ec 18          	sub    $0x18,%rsp
+    1774:	                         41 89 f1             	mov    %esi,%r9d
+            return content_;
+    1777:	                         4c 8b 07             	mov    (%rdi),%r8
+            return len_;
+    177a:	                         48 8b 77 08          	mov    0x8(%rdi),%rsi
+    unsigned int seed = 0x12345678;
+    177e:	                         c7 44 24 0c 78 56 34 	movl   $0x12345678,0xc(%rsp)
+    1785:	                         12 
+    for (nel::Index i = 0; i < n; ++i) {
+    1786:	                         31 c9                	xor    %ecx,%ecx
+    1788:	      /----------------> 48 39 f1             	cmp    %rsi,%rcx
+    178b:	/-----|----------------- 0f 84 b5 00 00 00    	je     1846 <fill(nel::Slice<int> const&, int)+0xd6>
+        switch (pat) {
+    1791:	|     |                  41 83 f9 02          	cmp    $0x2,%r9d
+    1795:	|     |  /-------------- 74 62                	je     17f9 <fill(nel::Slice<int> const&, int)+0x89>
+                p[i] = int(next_rand(seed) % 16);
+    1797:	|     |  |               4c 8d 5c 24 0c       	lea    0xc(%rsp),%r11
+        switch (pat) {
+    179c:	|  /--|--|-------------> 41 83 f9 02          	cmp    $0x2,%r9d
+    17a0:	|  |  |  |        /----- 7f 22                	jg     17c4 <fill(nel::Slice<int> const&, int)+0x54>
+    17a2:	|  |  |  |        |      45 85 c9             	test   %r9d,%r9d
+    17a5:	|  |  |  |  /-----|----- 75 44                	jne    17eb <fill(nel::Slice<int> const&, int)+0x7b>
+    17a7:	|  |  |  |  |  /--|----- eb 27                	jmp    17d0 <fill(nel::Slice<int> const&, int)+0x60>
+                p[i] = int(next_rand(seed) % 16);
+    17a9:	|  |  |  |  |  |  |  /-> 4c 89 df             	mov    %r11,%rdi
+    17ac:	|  |  |  |  |  |  |  |   e8 88 ff ff ff       	call   1739 <next_rand(unsigned int&)>
+    17b1:	|  |  |  |  |  |  |  |   83 e0 0f             	and    $0xf,%eax
+    17b4:	|  |  |  |  |  |  |  |   41 89 04 88          	mov    %eax,(%r8,%rcx,4)
+    for (nel::Index i = 0; i < n; ++i) {
+    17b8:	|  |  |  |  |  |  |  |   4c 89 d1             	mov    %r10,%rcx
+    17bb:	|  |  |  |  |  |  |  |   49 39 f2             	cmp    %rsi,%r10
+    17be:	+--|--|--|--|--|--|--|-- 0f 84 82 00 00 00    	je     1846 <fill(nel::Slice<int> const&, int)+0xd6>
+        switch (pat) {
+    17c4:	|  |  |  |  |  |  \--|-> 41 83 f9 03          	cmp    $0x3,%r9d
+    17c8:	|  |  |  |  |  |     |   4c 8d 51 01          	lea    0x1(%rcx),%r10
+    17cc:	|  |  |  |  |  |     \-- 74 db                	je     17a9 <fill(nel::Slice<int> const&, int)+0x39>
+    17ce:	|  |  |  |  |  |     /-- eb 36                	jmp    1806 <fill(nel::Slice<int> const&, int)+0x96>
+                p[i] = int(next_rand(seed) & 0x7fffffff);
+    17d0:	|  |  |  |  |  >-----|-> 4c 89 df             	mov    %r11,%rdi
+    17d3:	|  |  |  |  |  |     |   e8 61 ff ff ff       	call   1739 <next_rand(unsigned int&)>
+    17d8:	|  |  |  |  |  |     |   25 ff ff ff 7f       	and    $0x7fffffff,%eax
+    17dd:	|  |  |  |  |  |     |   41 89 04 88          	mov    %eax,(%r8,%rcx,4)
+    for (nel::Index i = 0; i < n; ++i) {
+    17e1:	|  |  |  |  |  |     |   48 ff c1             	inc    %rcx
+    17e4:	|  |  |  |  |  |     |   48 39 f1             	cmp    %rsi,%rcx
+    17e7:	|  |  |  |  |  \-----|-- 75 e7                	jne    17d0 <fill(nel::Slice<int> const&, int)+0x60>
+    17e9:	+--|--|--|--|--------|-- eb 5b                	jmp    1846 <fill(nel::Slice<int> const&, int)+0xd6>
+                p[i] = int(i);
+    17eb:	|  |  |  |  >--------|-> 41 89 0c 88          	mov    %ecx,(%r8,%rcx,4)
+    for (nel::Index i = 0; i < n; ++i) {
+    17ef:	|  |  |  |  |        |   48 ff c1             	inc    %rcx
+    17f2:	|  |  |  |  |        |   48 39 ce             	cmp    %rcx,%rsi
+    17f5:	|  |  |  |  \--------|-- 75 f4                	jne    17eb <fill(nel::Slice<int> const&, int)+0x7b>
+    17f7:	+--|--|--|-----------|-- eb 4d                	jmp    1846 <fill(nel::Slice<int> const&, int)+0xd6>
+                p[i] = int(n - i);
+    17f9:	|  |  |  \-----------|-> 89 f0                	mov    %esi,%eax
+    17fb:	|  |  |              |   29 c8                	sub    %ecx,%eax
+    17fd:	|  |  |              |   41 89 04 88          	mov    %eax,(%r8,%rcx,4)
+    for (nel::Index i = 0; i < n; ++i) {
+    1801:	|  |  |              |   48 ff c1             	inc    %rcx
+    1804:	|  |  \--------------|-- eb 82                	jmp    1788 <fill(nel::Slice<int> const&, int)+0x18>
+                if (i % 100 == 99) {
+    1806:	|  |                 \-> bf 64 00 00 00       	mov    $0x64,%edi
+    180b:	|  |                     48 89 c8             	mov    %rcx,%rax
+    180e:	|  |                     31 d2                	xor    %edx,%edx
+                p[i] = int(i);
+    1810:	|  |                     41 89 0c 88          	mov    %ecx,(%r8,%rcx,4)
+                if (i % 100 == 99) {
+    1814:	|  |                     48 f7 f7             	div    %rdi
+    1817:	|  |                     48 83 fa 63          	cmp    $0x63,%rdx
+    181b:	|  |                 /-- 75 1d                	jne    183a <fill(nel::Slice<int> const&, int)+0xca>
+                    nel::Index const j = next_rand(seed) % n;
+    181d:	|  |                 |   48 8d 7c 24 0c       	lea    0xc(%rsp),%rdi
+    1822:	|  |                 |   31 d2                	xor    %edx,%edx
+    1824:	|  |                 |   e8 10 ff ff ff       	call   1739 <next_rand(unsigned int&)>
+    1829:	|  |                 |   89 c0                	mov    %eax,%eax
+    182b:	|  |                 |   48 f7 f6             	div    %rsi
+                    p[i] = p[j];
+    182e:	|  |                 |   49 8d 04 90          	lea    (%r8,%rdx,4),%rax
+    1832:	|  |                 |   8b 10                	mov    (%rax),%edx
+    1834:	|  |                 |   41 89 14 88          	mov    %edx,(%r8,%rcx,4)
+                    p[j] = t;
+    1838:	|  |                 |   89 08                	mov    %ecx,(%rax)
+    for (nel::Index i = 0; i < n; ++i) {
+    183a:	|  |                 \-> 4c 89 d1             	mov    %r10,%rcx
+    183d:	|  |                     4c 39 d6             	cmp    %r10,%rsi
+    1840:	|  \-------------------- 0f 85 56 ff ff ff    	jne    179c <fill(nel::Slice<int> const&, int)+0x2c>
+}
+    1846:	\----------------------> 48 83 c4 18          	add    $0x18,%rsp
+    184a:	                         c3                   	ret
+
+000000000000184b <cmp_int(void const*, void const*)>:
+    return (x > y) - (x < y);
+    184b:	8b 06                	mov    (%rsi),%eax
+    184d:	39 07                	cmp    %eax,(%rdi)
+    184f:	0f 9f c0             	setg   %al
+    1852:	0f 9c c2             	setl   %dl
+    1855:	0f b6 d2             	movzbl %dl,%edx
+    1858:	0f b6 c0             	movzbl %al,%eax
+    185b:	29 d0                	sub    %edx,%eax
+}
+    185d:	c3                   	ret
+
+000000000000185e <void nel::sort::sift_down<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]>:
+        Index c = 2 * i + 1;
+    185e:	/-------> 48 8d 0c 36          	lea    (%rsi,%rsi,1),%rcx
+    1862:	|         48 8d 41 01          	lea    0x1(%rcx),%rax
+        if (c >= n) { break; }
+    1866:	|         48 39 d0             	cmp    %rdx,%rax
+    1869:	|  /----- 73 33                	jae    189e <void nel::sort::sift_down<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x40>
+        if (c + 1 < n && less(p[c], p[c + 1])) { c += 1; }
+    186b:	|  |      48 83 c1 02          	add    $0x2,%rcx
+            return a < b;
+    186f:	|  |      44 8b 04 87          	mov    (%rdi,%rax,4),%r8d
+        if (c + 1 < n && less(p[c], p[c + 1])) { c += 1; }
+    1873:	|  |      48 39 d1             	cmp    %rdx,%rcx
+    1876:	|  |  /-- 73 09                	jae    1881 <void nel::sort::sift_down<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x23>
+    1878:	|  |  |   44 39 44 f7 08       	cmp    %r8d,0x8(%rdi,%rsi,8)
+    187d:	|  |  |   48 0f 4f c1          	cmovg  %rcx,%rax
+        if (!less(p[i], p[c])) { break; }
+    1881:	|  |  \-> 48 8d 0c 87          	lea    (%rdi,%rax,4),%rcx
+    1885:	|  |      4c 8d 04 b7          	lea    (%rdi,%rsi,4),%r8
+            return a < b;
+    1889:	|  |      41 8b 30             	mov    (%r8),%esi
+    188c:	|  |      44 8b 09             	mov    (%rcx),%r9d
+        if (!less(p[i], p[c])) { break; }
+    188f:	|  |      44 39 ce             	cmp    %r9d,%esi
+    1892:	|  +----- 7d 0a                	jge    189e <void nel::sort::sift_down<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x40>
+ */
+template<typename T>
+constexpr void swap(T &a, T &b)
+{
+    T t = move(a);
+    a = move(b);
+    1894:	|  |      45 89 08             	mov    %r9d,(%r8)
+    b = move(t);
+    1897:	|  |      89 31                	mov    %esi,(%rcx)
+        i = c;
+    1899:	|  |      48 89 c6             	mov    %rax,%rsi
+    while (true) {
+    189c:	\--|----- eb c0                	jmp    185e <void nel::sort::sift_down<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]>
+}
+    189e:	   \----> c3                   	ret
+
+000000000000189f <void nel::sort::sort3<int, nel::sort::Less>(int&, int&, int&, nel::sort::Less&) [clone .isra.0]>:
+            return a < b;
+    189f:	    8b 0e                	mov    (%rsi),%ecx
+    18a1:	    8b 07                	mov    (%rdi),%eax
+    if (less(b, a)) { swap(a, b); }
+    18a3:	    39 c1                	cmp    %eax,%ecx
+    18a5:	/-- 7d 04                	jge    18ab <void nel::sort::sort3<int, nel::sort::Less>(int&, int&, int&, nel::sort::Less&) [clone .isra.0]+0xc>
+    a = move(b);
+    18a7:	|   89 0f                	mov    %ecx,(%rdi)
+    b = move(t);
+    18a9:	|   89 06                	mov    %eax,(%rsi)
+            return a < b;
+    18ab:	\-> 8b 0a                	mov    (%rdx),%ecx
+    18ad:	    8b 06                	mov    (%rsi),%eax
+    if (less(c, b)) {
+    18af:	    39 c1                	cmp    %eax,%ecx
+    18b1:	/-- 7d 10                	jge    18c3 <void nel::sort::sort3<int, nel::sort::Less>(int&, int&, int&, nel::sort::Less&) [clone .isra.0]+0x24>
+    a = move(b);
+    18b3:	|   89 0e                	mov    %ecx,(%rsi)
+    b = move(t);
+    18b5:	|   89 02                	mov    %eax,(%rdx)
+            return a < b;
+    18b7:	|   8b 16                	mov    (%rsi),%edx
+    18b9:	|   8b 07                	mov    (%rdi),%eax
+        if (less(b, a)) { swap(a, b); }
+    18bb:	|   39 c2                	cmp    %eax,%edx
+    18bd:	+-- 7d 04                	jge    18c3 <void nel::sort::sort3<int, nel::sort::Less>(int&, int&, int&, nel::sort::Less&) [clone .isra.0]+0x24>
+    a = move(b);
+    18bf:	|   89 17                	mov    %edx,(%rdi)
+    b = move(t);
+    18c1:	|   89 06                	mov    %eax,(%rsi)
+}
+    18c3:	\-> c3                   	ret
+
+00000000000018c4 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>:
+    for (Index i = 1; i < n; ++i) {
+    18c4:	                ba 01 00 00 00       	mov    $0x1,%edx
+    Count moved = 0;
+    18c9:	                31 c9                	xor    %ecx,%ecx
+    for (Index i = 1; i < n; ++i) {
+    18cb:	/-------------> 48 39 f2             	cmp    %rsi,%rdx
+    18ce:	|  /----------- 73 38                	jae    1908 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x44>
+            return a < b;
+    18d0:	|  |            44 8b 04 97          	mov    (%rdi,%rdx,4),%r8d
+        if (!less(p[i], p[i - 1])) { continue; }
+    18d4:	|  |            44 3b 44 97 fc       	cmp    -0x4(%rdi,%rdx,4),%r8d
+    18d9:	|  |  /-------- 7d 28                	jge    1903 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x3f>
+    18db:	|  |  |         48 89 d0             	mov    %rdx,%rax
+            p[j] = move(p[j - 1]);
+    18de:	|  |  |  /----> 44 8b 4c 87 fc       	mov    -0x4(%rdi,%rax,4),%r9d
+    18e3:	|  |  |  |      44 89 0c 87          	mov    %r9d,(%rdi,%rax,4)
+        } while (j > 0 && less(t, p[j - 1]));
+    18e7:	|  |  |  |      48 ff c8             	dec    %rax
+    18ea:	|  |  |  |  /-- 74 07                	je     18f3 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x2f>
+    18ec:	|  |  |  |  |   44 3b 44 87 fc       	cmp    -0x4(%rdi,%rax,4),%r8d
+    18f1:	|  |  |  \--|-- 7c eb                	jl     18de <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x1a>
+    18f3:	|  |  |     \-> 48 01 d1             	add    %rdx,%rcx
+        p[j] = move(t);
+    18f6:	|  |  |         44 89 04 87          	mov    %r8d,(%rdi,%rax,4)
+        moved += i - j;
+    18fa:	|  |  |         48 29 c1             	sub    %rax,%rcx
+        if (moved > 8) { return false; }
+    18fd:	|  |  |         48 83 f9 08          	cmp    $0x8,%rcx
+    1901:	|  |  |     /-- 77 08                	ja     190b <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x47>
+    for (Index i = 1; i < n; ++i) {
+    1903:	|  |  \-----|-> 48 ff c2             	inc    %rdx
+    1906:	\--|--------|-- eb c3                	jmp    18cb <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x7>
+    return true;
+    1908:	   \--------|-> b0 01                	mov    $0x1,%al
+    190a:	            |   c3                   	ret
+        if (moved > 8) { return false; }
+    190b:	            \-> 31 c0                	xor    %eax,%eax
+}
+    190d:	                c3                   	ret
+
+000000000000190e <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>:
+    for (Index i = n / 2; i > 0; --i) {
+    190e:	       49 89 f2             	mov    %rsi,%r10
+void heap(T p[], Length const n, F &less)
+    1911:	       48 89 f2             	mov    %rsi,%rdx
+    for (Index i = n / 2; i > 0; --i) {
+    1914:	       49 d1 ea             	shr    %r10
+    1917:	   /-> 4d 85 d2             	test   %r10,%r10
+    191a:	/--|-- 74 0d                	je     1929 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x1b>
+        sift_down(p, i - 1, n, less);
+    191c:	|  |   49 ff ca             	dec    %r10
+    191f:	|  |   4c 89 d6             	mov    %r10,%rsi
+    1922:	|  |   e8 37 ff ff ff       	call   185e <void nel::sort::sift_down<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]>
+    for (Index i = n / 2; i > 0; --i) {
+    1927:	|  \-- eb ee                	jmp    1917 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x9>
+    for (Index e = n; e > 1; --e) {
+    1929:	>----> 48 83 fa 01          	cmp    $0x1,%rdx
+    192d:	|  /-- 76 18                	jbe    1947 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x39>
+    a = move(b);
+    192f:	|  |   8b 4c 97 fc          	mov    -0x4(%rdi,%rdx,4),%ecx
+    T t = move(a);
+    1933:	|  |   8b 07                	mov    (%rdi),%eax
+        sift_down(p, 0, e - 1, less);
+    1935:	|  |   31 f6                	xor    %esi,%esi
+    a = move(b);
+    1937:	|  |   89 0f                	mov    %ecx,(%rdi)
+    b = move(t);
+    1939:	|  |   89 44 97 fc          	mov    %eax,-0x4(%rdi,%rdx,4)
+    193d:	|  |   48 ff ca             	dec    %rdx
+    1940:	|  |   e8 19 ff ff ff       	call   185e <void nel::sort::sift_down<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]>
+    for (Index e = n; e > 1; --e) {
+    1945:	\--|-- eb e2                	jmp    1929 <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x1b>
+}
+    1947:	   \-> c3                   	ret
+
+0000000000001948 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]>:
+Index partition_right(T p[], Length const n, F &less, bool &already)
+    1948:	          48 89 f9             	mov    %rdi,%rcx
+    T pivot = move(p[0]);
+    194b:	          8b 3f                	mov    (%rdi),%edi
+    Index first = 0;
+    194d:	          31 c0                	xor    %eax,%eax
+        first += 1;
+    194f:	      /-> 48 ff c0             	inc    %rax
+    } while (less(p[first], pivot));
+    1952:	      |   3b 3c 81             	cmp    (%rcx,%rax,4),%edi
+    1955:	      \-- 7f f8                	jg     194f <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x7>
+    if (first == 1) {
+    1957:	          48 83 f8 01          	cmp    $0x1,%rax
+    195b:	/-------- 75 10                	jne    196d <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x25>
+        while (first < last) {
+    195d:	|     /-> 48 83 fe 01          	cmp    $0x1,%rsi
+    1961:	|  /--|-- 76 12                	jbe    1975 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x2d>
+            last -= 1;
+    1963:	|  |  |   48 ff ce             	dec    %rsi
+            if (less(p[last], pivot)) { break; }
+    1966:	|  |  |   3b 3c b1             	cmp    (%rcx,%rsi,4),%edi
+    1969:	|  |  \-- 7e f2                	jle    195d <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x15>
+    196b:	|  +----- eb 08                	jmp    1975 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x2d>
+            last -= 1;
+    196d:	>--|----> 48 ff ce             	dec    %rsi
+        } while (!less(p[last], pivot));
+    1970:	|  |      3b 3c b1             	cmp    (%rcx,%rsi,4),%edi
+    1973:	\--|----- 7e f8                	jle    196d <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x25>
+    already = first >= last;
+    1975:	   \----> 48 39 f0             	cmp    %rsi,%rax
+    1978:	          0f 93 02             	setae  (%rdx)
+    while (first < last) {
+    197b:	/-------> 48 39 f0             	cmp    %rsi,%rax
+    197e:	|  /----- 73 26                	jae    19a6 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x5e>
+        swap(p[first], p[last]);
+    1980:	|  |      48 8d 14 b1          	lea    (%rcx,%rsi,4),%rdx
+    1984:	|  |      4c 8d 04 81          	lea    (%rcx,%rax,4),%r8
+    T t = move(a);
+    1988:	|  |      45 8b 08             	mov    (%r8),%r9d
+    a = move(b);
+    198b:	|  |      44 8b 12             	mov    (%rdx),%r10d
+    198e:	|  |      45 89 10             	mov    %r10d,(%r8)
+    b = move(t);
+    1991:	|  |      44 89 0a             	mov    %r9d,(%rdx)
+            first += 1;
+    1994:	|  |  /-> 48 ff c0             	inc    %rax
+        } while (less(p[first], pivot));
+    1997:	|  |  |   3b 3c 81             	cmp    (%rcx,%rax,4),%edi
+    199a:	|  |  \-- 7f f8                	jg     1994 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x4c>
+            last -= 1;
+    199c:	|  |  /-> 48 ff ce             	dec    %rsi
+        } while (!less(p[last], pivot));
+    199f:	|  |  |   3b 3c b1             	cmp    (%rcx,%rsi,4),%edi
+    19a2:	|  |  \-- 7e f8                	jle    199c <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x54>
+    19a4:	\--|----- eb d5                	jmp    197b <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]+0x33>
+    Index const pos = first - 1;
+    19a6:	   \----> 48 ff c8             	dec    %rax
+    p[0] = move(p[pos]);
+    19a9:	          48 8d 14 81          	lea    (%rcx,%rax,4),%rdx
+    19ad:	          8b 32                	mov    (%rdx),%esi
+    19af:	          89 31                	mov    %esi,(%rcx)
+    p[pos] = move(pivot);
+    19b1:	          89 3a                	mov    %edi,(%rdx)
+}
+    19b3:	          c3                   	ret
+
+00000000000019b4 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>:
+    T pivot = move(p[0]);
+    19b4:	          8b 0f                	mov    (%rdi),%ecx
+    Index last = n;
+    19b6:	          48 89 f2             	mov    %rsi,%rdx
+    19b9:	      /-> 48 89 d0             	mov    %rdx,%rax
+        last -= 1;
+    19bc:	      |   48 ff ca             	dec    %rdx
+    } while (less(pivot, p[last]));
+    19bf:	      |   3b 0c 97             	cmp    (%rdi,%rdx,4),%ecx
+    19c2:	      \-- 7c f5                	jl     19b9 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x5>
+    if (last + 1 == n) {
+    19c4:	          48 39 f0             	cmp    %rsi,%rax
+    Index first = 0;
+    19c7:	          b8 00 00 00 00       	mov    $0x0,%eax
+    if (last + 1 == n) {
+    19cc:	   /----- 75 0f                	jne    19dd <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x29>
+        while (first < last) {
+    19ce:	   |  /-> 48 39 c2             	cmp    %rax,%rdx
+    19d1:	/--|--|-- 74 24                	je     19f7 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x43>
+            first += 1;
+    19d3:	|  |  |   48 ff c0             	inc    %rax
+            if (less(pivot, p[first])) { break; }
+    19d6:	|  |  |   3b 0c 87             	cmp    (%rdi,%rax,4),%ecx
+    19d9:	|  |  \-- 7d f3                	jge    19ce <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x1a>
+    19db:	+--|----- eb 1a                	jmp    19f7 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x43>
+            first += 1;
+    19dd:	|  >----> 48 ff c0             	inc    %rax
+        } while (!less(pivot, p[first]));
+    19e0:	|  |      3b 0c 87             	cmp    (%rdi,%rax,4),%ecx
+    19e3:	|  \----- 7d f8                	jge    19dd <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x29>
+    19e5:	+-------- eb 10                	jmp    19f7 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x43>
+            last -= 1;
+    19e7:	|  /----> 48 ff ca             	dec    %rdx
+        } while (less(pivot, p[last]));
+    19ea:	|  |      3b 0c 97             	cmp    (%rdi,%rdx,4),%ecx
+    19ed:	|  +----- 7c f8                	jl     19e7 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x33>
+            first += 1;
+    19ef:	|  |  /-> 48 ff c0             	inc    %rax
+        } while (!less(pivot, p[first]));
+    19f2:	|  |  |   3b 0c 87             	cmp    (%rdi,%rax,4),%ecx
+    19f5:	|  |  \-- 7d f8                	jge    19ef <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x3b>
+        swap(p[first], p[last]);
+    19f7:	\--|----> 48 8d 34 97          	lea    (%rdi,%rdx,4),%rsi
+    a = move(b);
+    19fb:	   |      44 8b 06             	mov    (%rsi),%r8d
+    while (first < last) {
+    19fe:	   |      48 39 d0             	cmp    %rdx,%rax
+    1a01:	   |  /-- 73 0f                	jae    1a12 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x5e>
+        swap(p[first], p[last]);
+    1a03:	   |  |   4c 8d 0c 87          	lea    (%rdi,%rax,4),%r9
+    T t = move(a);
+    1a07:	   |  |   45 8b 11             	mov    (%r9),%r10d
+    a = move(b);
+    1a0a:	   |  |   45 89 01             	mov    %r8d,(%r9)
+    b = move(t);
+    1a0d:	   |  |   44 89 16             	mov    %r10d,(%rsi)
+}
+    1a10:	   \--|-- eb d5                	jmp    19e7 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x33>
+    p[0] = move(p[last]);
+    1a12:	      \-> 44 89 07             	mov    %r8d,(%rdi)
+}
+    1a15:	          48 89 d0             	mov    %rdx,%rax
+    p[last] = move(pivot);
+    1a18:	          89 0e                	mov    %ecx,(%rsi)
+}
+    1a1a:	          c3                   	ret
+
+0000000000001a1b <void nel::sort::choose_pivot<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>:
+    Index const h = n / 2;
+    1a1b:	    49 89 f2             	mov    %rsi,%r10
+        sort3(p[0], p[h], p[n - 1], less);
+    1a1e:	    4c 8d 1c b5 00 00 00 	lea    0x0(,%rsi,4),%r11
+    1a25:	    00 
+void choose_pivot(T p[], Length const n, F &less)
+    1a26:	    49 89 f8             	mov    %rdi,%r8
+    Index const h = n / 2;
+    1a29:	    49 d1 ea             	shr    %r10
+        sort3(p[0], p[h], p[n - 1], less);
+    1a2c:	    4a 8d 54 1f fc       	lea    -0x4(%rdi,%r11,1),%rdx
+    1a31:	    49 c1 e2 02          	shl    $0x2,%r10
+    1a35:	    4e 8d 0c 17          	lea    (%rdi,%r10,1),%r9
+    if (n > ninther_n) {
+    1a39:	    48 81 fe 80 00 00 00 	cmp    $0x80,%rsi
+    1a40:	/-- 76 4e                	jbe    1a90 <void nel::sort::choose_pivot<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x75>
+void choose_pivot(T p[], Length const n, F &less)
+    1a42:	|   53                   	push   %rbx
+        sort3(p[0], p[h], p[n - 1], less);
+    1a43:	|   4c 89 ce             	mov    %r9,%rsi
+        sort3(p[1], p[h - 1], p[n - 2], less);
+    1a46:	|   4a 8d 5c 17 fc       	lea    -0x4(%rdi,%r10,1),%rbx
+        sort3(p[0], p[h], p[n - 1], less);
+    1a4b:	|   e8 4f fe ff ff       	call   189f <void nel::sort::sort3<int, nel::sort::Less>(int&, int&, int&, nel::sort::Less&) [clone .isra.0]>
+        sort3(p[1], p[h - 1], p[n - 2], less);
+    1a50:	|   4a 8d 54 1f f8       	lea    -0x8(%rdi,%r11,1),%rdx
+    1a55:	|   48 89 de             	mov    %rbx,%rsi
+    1a58:	|   48 8d 7f 04          	lea    0x4(%rdi),%rdi
+    1a5c:	|   e8 3e fe ff ff       	call   189f <void nel::sort::sort3<int, nel::sort::Less>(int&, int&, int&, nel::sort::Less&) [clone .isra.0]>
+        sort3(p[2], p[h + 1], p[n - 3], less);
+    1a61:	|   4b 8d 74 10 04       	lea    0x4(%r8,%r10,1),%rsi
+    1a66:	|   4b 8d 54 18 f4       	lea    -0xc(%r8,%r11,1),%rdx
+    1a6b:	|   49 8d 78 08          	lea    0x8(%r8),%rdi
+    1a6f:	|   e8 2b fe ff ff       	call   189f <void nel::sort::sort3<int, nel::sort::Less>(int&, int&, int&, nel::sort::Less&) [clone .isra.0]>
+        sort3(p[h - 1], p[h], p[h + 1], less);
+    1a74:	|   48 89 f2             	mov    %rsi,%rdx
+    1a77:	|   48 89 df             	mov    %rbx,%rdi
+    1a7a:	|   4c 89 ce             	mov    %r9,%rsi
+    1a7d:	|   e8 1d fe ff ff       	call   189f <void nel::sort::sort3<int, nel::sort::Less>(int&, int&, int&, nel::sort::Less&) [clone .isra.0]>
+    T t = move(a);
+    1a82:	|   41 8b 00             	mov    (%r8),%eax
+    a = move(b);
+    1a85:	|   41 8b 11             	mov    (%r9),%edx
+    1a88:	|   41 89 10             	mov    %edx,(%r8)
+    b = move(t);
+    1a8b:	|   41 89 01             	mov    %eax,(%r9)
+}
+    1a8e:	|   5b                   	pop    %rbx
+    1a8f:	|   c3                   	ret
+        sort3(p[h], p[0], p[n - 1], less);
+    1a90:	\-> 48 89 fe             	mov    %rdi,%rsi
+    1a93:	    4c 89 cf             	mov    %r9,%rdi
+    1a96:	    e9 04 fe ff ff       	jmp    189f <void nel::sort::sort3<int, nel::sort::Less>(int&, int&, int&, nel::sort::Less&) [clone .isra.0]>
+
+0000000000001a9b <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>:
+    for (Index i = 1; i < n; ++i) {
+    1a9b:	                ba 01 00 00 00       	mov    $0x1,%edx
+    1aa0:	/-------------> 48 39 f2             	cmp    %rsi,%rdx
+    1aa3:	|  /----------- 73 28                	jae    1acd <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x32>
+            return a < b;
+    1aa5:	|  |            8b 0c 97             	mov    (%rdi,%rdx,4),%ecx
+        if (!less(p[i], p[i - 1])) { continue; }
+    1aa8:	|  |            3b 4c 97 fc          	cmp    -0x4(%rdi,%rdx,4),%ecx
+    1aac:	|  |  /-------- 7d 1a                	jge    1ac8 <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x2d>
+    1aae:	|  |  |         48 89 d0             	mov    %rdx,%rax
+            p[j] = move(p[j - 1]);
+    1ab1:	|  |  |  /----> 44 8b 44 87 fc       	mov    -0x4(%rdi,%rax,4),%r8d
+    1ab6:	|  |  |  |      44 89 04 87          	mov    %r8d,(%rdi,%rax,4)
+        } while (j > 0 && less(t, p[j - 1]));
+    1aba:	|  |  |  |      48 ff c8             	dec    %rax
+    1abd:	|  |  |  |  /-- 74 06                	je     1ac5 <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x2a>
+    1abf:	|  |  |  |  |   3b 4c 87 fc          	cmp    -0x4(%rdi,%rax,4),%ecx
+    1ac3:	|  |  |  \--|-- 7c ec                	jl     1ab1 <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x16>
+        p[j] = move(t);
+    1ac5:	|  |  |     \-> 89 0c 87             	mov    %ecx,(%rdi,%rax,4)
+    for (Index i = 1; i < n; ++i) {
+    1ac8:	|  |  \-------> 48 ff c2             	inc    %rdx
+    1acb:	\--|----------- eb d3                	jmp    1aa0 <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]+0x5>
+}
+    1acd:	   \----------> c3                   	ret
+
+0000000000001ace <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]>:
+ * items before it are not greater, and items after it not less.
+ *
+ * O(n) on average, O(n log n) worst case. k < n.
+ */
+template<typename T, typename F>
+void select_nth(T p[], Length n, Index k, F &less)
+    1ace:	                41 57                	push   %r15
+    while (n > 1) {
+    1ad0:	                48 89 f0             	mov    %rsi,%rax
+void select_nth(T p[], Length n, Index k, F &less)
+    1ad3:	                41 56                	push   %r14
+    1ad5:	                41 55                	push   %r13
+    Count l = 0;
+    1ad7:	                45 31 ed             	xor    %r13d,%r13d
+void select_nth(T p[], Length n, Index k, F &less)
+    1ada:	                41 54                	push   %r12
+    1adc:	                49 89 d4             	mov    %rdx,%r12
+    1adf:	                55                   	push   %rbp
+    1ae0:	                48 89 fd             	mov    %rdi,%rbp
+    1ae3:	                53                   	push   %rbx
+    1ae4:	                48 89 f3             	mov    %rsi,%rbx
+    1ae7:	                48 83 ec 10          	sub    $0x10,%rsp
+    while (n > 1) {
+    1aeb:	         /----> 48 83 f8 01          	cmp    $0x1,%rax
+    1aef:	         |  /-- 76 08                	jbe    1af9 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x2b>
+        n /= 2;
+    1af1:	         |  |   48 d1 e8             	shr    %rax
+        l += 1;
+    1af4:	         |  |   49 ff c5             	inc    %r13
+    1af7:	         \--|-- eb f2                	jmp    1aeb <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x1d>
+{
+    Count bad_allowed = log2(n);
+    bool leftmost = true;
+    1af9:	            \-> 41 b6 01             	mov    $0x1,%r14b
+            k -= m + 1;
+            continue;
+        }
+
+        bool already;
+        Index const m = partition_right(p, n, less, already);
+    1afc:	                4c 8d 7c 24 0f       	lea    0xf(%rsp),%r15
+        choose_pivot(p, n, less);
+    1b01:	/-------------> 48 89 de             	mov    %rbx,%rsi
+    1b04:	|               48 89 ef             	mov    %rbp,%rdi
+    while (n >= small_n) {
+    1b07:	|               48 83 fb 13          	cmp    $0x13,%rbx
+    1b0b:	|  /----------- 0f 86 a3 00 00 00    	jbe    1bb4 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0xe6>
+        choose_pivot(p, n, less);
+    1b11:	|  |            e8 05 ff ff ff       	call   1a1b <void nel::sort::choose_pivot<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>
+        if (!leftmost && !less(p[-1], p[0])) {
+    1b16:	|  |            45 84 f6             	test   %r14b,%r14b
+    1b19:	|  |        /-- 75 2f                	jne    1b4a <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x7c>
+    1b1b:	|  |        |   8b 45 00             	mov    0x0(%rbp),%eax
+    1b1e:	|  |        |   39 45 fc             	cmp    %eax,-0x4(%rbp)
+    1b21:	|  |        +-- 7c 27                	jl     1b4a <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x7c>
+            Index const m = partition_left(p, n, less);
+    1b23:	|  |        |   48 89 de             	mov    %rbx,%rsi
+    1b26:	|  |        |   48 89 ef             	mov    %rbp,%rdi
+    1b29:	|  |        |   e8 86 fe ff ff       	call   19b4 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>
+            if (k <= m) { return; }
+    1b2e:	|  |        |   4c 39 e0             	cmp    %r12,%rax
+    1b31:	|  |  /-----|-- 0f 83 90 00 00 00    	jae    1bc7 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0xf9>
+    1b37:	|  |  |     |   48 ff cb             	dec    %rbx
+    1b3a:	|  |  |     |   49 ff cc             	dec    %r12
+            p += m + 1;
+    1b3d:	|  |  |     |   48 8d 6c 85 04       	lea    0x4(%rbp,%rax,4),%rbp
+            n -= m + 1;
+    1b42:	|  |  |     |   48 29 c3             	sub    %rax,%rbx
+            k -= m + 1;
+    1b45:	|  |  |     |   49 29 c4             	sub    %rax,%r12
+    1b48:	+--|--|-----|-- eb b7                	jmp    1b01 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x33>
+        Index const m = partition_right(p, n, less, already);
+    1b4a:	|  |  |     \-> 4c 89 fa             	mov    %r15,%rdx
+    1b4d:	|  |  |         48 89 de             	mov    %rbx,%rsi
+    1b50:	|  |  |         48 89 ef             	mov    %rbp,%rdi
+    1b53:	|  |  |         e8 f0 fd ff ff       	call   1948 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]>
+        if (m < n / 8 || n - m - 1 < n / 8) {
+    1b58:	|  |  |         48 89 d9             	mov    %rbx,%rcx
+    1b5b:	|  |  |         48 c1 e9 03          	shr    $0x3,%rcx
+    1b5f:	|  |  |         48 39 c8             	cmp    %rcx,%rax
+    1b62:	|  |  |     /-- 72 0c                	jb     1b70 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0xa2>
+    1b64:	|  |  |     |   48 8d 53 ff          	lea    -0x1(%rbx),%rdx
+    1b68:	|  |  |     |   48 29 c2             	sub    %rax,%rdx
+    1b6b:	|  |  |     |   48 39 ca             	cmp    %rcx,%rdx
+    1b6e:	|  |  |  /--|-- 73 1e                	jae    1b8e <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0xc0>
+            bad_allowed -= 1;
+            if (bad_allowed == 0) {
+    1b70:	|  |  |  |  \-> 49 ff cd             	dec    %r13
+    1b73:	|  |  |  +----- 75 19                	jne    1b8e <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0xc0>
+            k -= m + 1;
+            leftmost = false;
+        }
+    }
+    insertion(p, n, less);
+}
+    1b75:	|  |  |  |      48 83 c4 10          	add    $0x10,%rsp
+                heap(p, n, less);
+    1b79:	|  |  |  |      48 89 de             	mov    %rbx,%rsi
+    1b7c:	|  |  |  |      48 89 ef             	mov    %rbp,%rdi
+}
+    1b7f:	|  |  |  |      5b                   	pop    %rbx
+    1b80:	|  |  |  |      5d                   	pop    %rbp
+    1b81:	|  |  |  |      41 5c                	pop    %r12
+    1b83:	|  |  |  |      41 5d                	pop    %r13
+    1b85:	|  |  |  |      41 5e                	pop    %r14
+    1b87:	|  |  |  |      41 5f                	pop    %r15
+                heap(p, n, less);
+    1b89:	|  |  |  |      e9 80 fd ff ff       	jmp    190e <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>
+        if (k == m) { return; }
+    1b8e:	|  |  |  \----> 49 39 c4             	cmp    %rax,%r12
+    1b91:	|  |  +-------- 74 34                	je     1bc7 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0xf9>
+        if (k < m) {
+    1b93:	|  |  |     /-- 72 17                	jb     1bac <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0xde>
+    1b95:	|  |  |     |   48 ff cb             	dec    %rbx
+    1b98:	|  |  |     |   49 ff cc             	dec    %r12
+            p += m + 1;
+    1b9b:	|  |  |     |   48 8d 6c 85 04       	lea    0x4(%rbp,%rax,4),%rbp
+            leftmost = false;
+    1ba0:	|  |  |     |   45 31 f6             	xor    %r14d,%r14d
+            n -= m + 1;
+    1ba3:	|  |  |     |   48 29 c3             	sub    %rax,%rbx
+            k -= m + 1;
+    1ba6:	|  |  |     |   49 29 c4             	sub    %rax,%r12
+            n -= m + 1;
+    1ba9:	|  |  |     |   48 89 d8             	mov    %rbx,%rax
+    1bac:	|  |  |     \-> 48 89 c3             	mov    %rax,%rbx
+    1baf:	\--|--|-------- e9 4d ff ff ff       	jmp    1b01 <void nel::sort::select_nth<int, nel::sort::Less>(int*, unsigned long, unsigned long, nel::sort::Less&) [clone .isra.0]+0x33>
+}
+    1bb4:	   \--|-------> 48 83 c4 10          	add    $0x10,%rsp
+    1bb8:	      |         5b                   	pop    %rbx
+    1bb9:	      |         5d                   	pop    %rbp
+    1bba:	      |         41 5c                	pop    %r12
+    1bbc:	      |         41 5d                	pop    %r13
+    1bbe:	      |         41 5e                	pop    %r14
+    1bc0:	      |         41 5f                	pop    %r15
+    insertion(p, n, less);
+    1bc2:	      |         e9 d4 fe ff ff       	jmp    1a9b <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>
+}
+    1bc7:	      \-------> 48 83 c4 10          	add    $0x10,%rsp
+    1bcb:	                5b                   	pop    %rbx
+    1bcc:	                5d                   	pop    %rbp
+    1bcd:	                41 5c                	pop    %r12
+    1bcf:	                41 5d                	pop    %r13
+    1bd1:	                41 5e                	pop    %r14
+    1bd3:	                41 5f                	pop    %r15
+    1bd5:	                c3                   	ret
+
+0000000000001bd6 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    1bd6:	83 c8 ff             	or     $0xffffffff,%eax
+    1bd9:	c3                   	ret
+
+0000000000001bda <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    1bda:	83 c8 ff             	or     $0xffffffff,%eax
+    1bdd:	c3                   	ret
+
+0000000000001bde <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    1bde:	83 c8 ff             	or     $0xffffffff,%eax
+    1be1:	c3                   	ret
+
+0000000000001be2 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    1be2:	83 c8 ff             	or     $0xffffffff,%eax
+    1be5:	c3                   	ret
+
+0000000000001be6 <_read_r>:
+int _read_r(struct _reent *, int) {
+    1be6:	83 c8 ff             	or     $0xffffffff,%eax
+    1be9:	c3                   	ret
+
+0000000000001bea <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    1bea:	83 c8 ff             	or     $0xffffffff,%eax
+    1bed:	c3                   	ret
+
+0000000000001bee <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    1bee:	83 c8 ff             	or     $0xffffffff,%eax
+    1bf1:	c3                   	ret
+
+0000000000001bf2 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1bf2:	83 c8 ff             	or     $0xffffffff,%eax
+    1bf5:	c3                   	ret
+
+0000000000001bf6 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]>:
+void pdq(T p[], Length n, F &less, Count bad_allowed, bool leftmost)
+    1bf6:	/-------------> 41 57                	push   %r15
+    1bf8:	|               41 56                	push   %r14
+    1bfa:	|               41 89 ce             	mov    %ecx,%r14d
+    1bfd:	|               41 55                	push   %r13
+    1bff:	|               49 89 d5             	mov    %rdx,%r13
+    1c02:	|               41 54                	push   %r12
+    1c04:	|               55                   	push   %rbp
+    1c05:	|               53                   	push   %rbx
+    1c06:	|               48 89 fb             	mov    %rdi,%rbx
+    1c09:	|               48 83 ec 28          	sub    $0x28,%rsp
+        Index const m = partition_right(p, n, less, already);
+    1c0d:	|               48 8d 44 24 1f       	lea    0x1f(%rsp),%rax
+    1c12:	|               48 89 04 24          	mov    %rax,(%rsp)
+        if (n < small_n) {
+    1c16:	|  /----------> 48 83 fe 13          	cmp    $0x13,%rsi
+    1c1a:	|  |        /-- 77 16                	ja     1c32 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x3c>
+}
+    1c1c:	|  |        |   48 83 c4 28          	add    $0x28,%rsp
+            insertion(p, n, less);
+    1c20:	|  |        |   48 89 df             	mov    %rbx,%rdi
+}
+    1c23:	|  |        |   5b                   	pop    %rbx
+    1c24:	|  |        |   5d                   	pop    %rbp
+    1c25:	|  |        |   41 5c                	pop    %r12
+    1c27:	|  |        |   41 5d                	pop    %r13
+    1c29:	|  |        |   41 5e                	pop    %r14
+    1c2b:	|  |        |   41 5f                	pop    %r15
+            insertion(p, n, less);
+    1c2d:	|  |        |   e9 69 fe ff ff       	jmp    1a9b <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>
+        choose_pivot(p, n, less);
+    1c32:	|  |        \-> 48 89 df             	mov    %rbx,%rdi
+    1c35:	|  |            48 89 74 24 08       	mov    %rsi,0x8(%rsp)
+    1c3a:	|  |            e8 dc fd ff ff       	call   1a1b <void nel::sort::choose_pivot<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>
+    1c3f:	|  |            48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    1c44:	|  |            4c 8d 66 ff          	lea    -0x1(%rsi),%r12
+        if (!leftmost && !less(p[-1], p[0])) {
+    1c48:	|  |            45 84 f6             	test   %r14b,%r14b
+    1c4b:	|  |        /-- 75 1c                	jne    1c69 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x73>
+    1c4d:	|  |        |   8b 03                	mov    (%rbx),%eax
+    1c4f:	|  |        |   39 43 fc             	cmp    %eax,-0x4(%rbx)
+    1c52:	|  |        +-- 7c 15                	jl     1c69 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x73>
+            Index const m = partition_left(p, n, less);
+    1c54:	|  |        |   48 89 df             	mov    %rbx,%rdi
+    1c57:	|  |        |   e8 58 fd ff ff       	call   19b4 <unsigned long nel::sort::partition_left<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>
+            n -= m + 1;
+    1c5c:	|  |        |   4c 89 e6             	mov    %r12,%rsi
+            p += m + 1;
+    1c5f:	|  |        |   48 8d 5c 83 04       	lea    0x4(%rbx,%rax,4),%rbx
+            n -= m + 1;
+    1c64:	|  |        |   48 29 c6             	sub    %rax,%rsi
+    1c67:	|  +--------|-- eb ad                	jmp    1c16 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x20>
+        Index const m = partition_right(p, n, less, already);
+    1c69:	|  |        \-> 48 8b 14 24          	mov    (%rsp),%rdx
+    1c6d:	|  |            48 89 df             	mov    %rbx,%rdi
+    1c70:	|  |            48 89 74 24 08       	mov    %rsi,0x8(%rsp)
+    1c75:	|  |            e8 ce fc ff ff       	call   1948 <unsigned long nel::sort::partition_right<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, bool&) [clone .isra.0]>
+        if (l < n / 8 || r < n / 8) {
+    1c7a:	|  |            48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+        Index const m = partition_right(p, n, less, already);
+    1c7f:	|  |            48 89 c5             	mov    %rax,%rbp
+        Length const r = n - m - 1;
+    1c82:	|  |            49 29 c4             	sub    %rax,%r12
+        if (l < n / 8 || r < n / 8) {
+    1c85:	|  |            48 89 f0             	mov    %rsi,%rax
+    1c88:	|  |            4c 89 e2             	mov    %r12,%rdx
+    1c8b:	|  |            48 c1 e8 03          	shr    $0x3,%rax
+    1c8f:	|  |            4c 39 e5             	cmp    %r12,%rbp
+    1c92:	|  |            48 0f 46 d5          	cmovbe %rbp,%rdx
+    1c96:	|  |            48 39 c2             	cmp    %rax,%rdx
+    1c99:	|  |     /----- 73 35                	jae    1cd0 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0xda>
+            if (bad_allowed == 0) {
+    1c9b:	|  |     |      49 ff cd             	dec    %r13
+    1c9e:	|  |     |  /-- 75 16                	jne    1cb6 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0xc0>
+}
+    1ca0:	|  |     |  |   48 83 c4 28          	add    $0x28,%rsp
+                heap(p, n, less);
+    1ca4:	|  |     |  |   48 89 df             	mov    %rbx,%rdi
+}
+    1ca7:	|  |     |  |   5b                   	pop    %rbx
+    1ca8:	|  |     |  |   5d                   	pop    %rbp
+    1ca9:	|  |     |  |   41 5c                	pop    %r12
+    1cab:	|  |     |  |   41 5d                	pop    %r13
+    1cad:	|  |     |  |   41 5e                	pop    %r14
+    1caf:	|  |     |  |   41 5f                	pop    %r15
+                heap(p, n, less);
+    1cb1:	|  |     |  |   e9 58 fc ff ff       	jmp    190e <void nel::sort::heap<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>
+            break_patterns(p, l);
+    1cb6:	|  |     |  \-> 48 89 ee             	mov    %rbp,%rsi
+    1cb9:	|  |     |      48 89 df             	mov    %rbx,%rdi
+    1cbc:	|  |     |      e8 e4 03 00 00       	call   20a5 <void nel::sort::break_patterns<int>(int*, unsigned long)>
+            break_patterns(p + m + 1, r);
+    1cc1:	|  |     |      48 8d 7c ab 04       	lea    0x4(%rbx,%rbp,4),%rdi
+    1cc6:	|  |     |      4c 89 e6             	mov    %r12,%rsi
+    1cc9:	|  |     |      e8 d7 03 00 00       	call   20a5 <void nel::sort::break_patterns<int>(int*, unsigned long)>
+    1cce:	|  |     |  /-- eb 27                	jmp    1cf7 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x101>
+                   && partial_insertion(p + m + 1, r, less)) {
+    1cd0:	|  |     \--|-> 80 7c 24 1f 00       	cmpb   $0x0,0x1f(%rsp)
+    1cd5:	|  |        +-- 74 20                	je     1cf7 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x101>
+        } else if (already && partial_insertion(p, l, less)
+    1cd7:	|  |        |   48 89 ee             	mov    %rbp,%rsi
+    1cda:	|  |        |   48 89 df             	mov    %rbx,%rdi
+    1cdd:	|  |        |   e8 e2 fb ff ff       	call   18c4 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>
+    1ce2:	|  |        |   84 c0                	test   %al,%al
+    1ce4:	|  |        +-- 74 11                	je     1cf7 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x101>
+                   && partial_insertion(p + m + 1, r, less)) {
+    1ce6:	|  |        |   48 8d 7c ab 04       	lea    0x4(%rbx,%rbp,4),%rdi
+    1ceb:	|  |        |   4c 89 e6             	mov    %r12,%rsi
+    1cee:	|  |        |   e8 d1 fb ff ff       	call   18c4 <bool nel::sort::partial_insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>
+    1cf3:	|  |        |   84 c0                	test   %al,%al
+    1cf5:	|  |  /-----|-- 75 42                	jne    1d39 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x143>
+            p += m + 1;
+    1cf7:	|  |  |     \-> 4c 8d 7c ab 04       	lea    0x4(%rbx,%rbp,4),%r15
+        if (l < r) {
+    1cfc:	|  |  |         4c 39 e5             	cmp    %r12,%rbp
+    1cff:	|  |  |  /----- 73 17                	jae    1d18 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x122>
+            pdq(p, l, less, bad_allowed, leftmost);
+    1d01:	|  |  |  |      41 0f b6 ce          	movzbl %r14b,%ecx
+    1d05:	|  |  |  |      4c 89 ea             	mov    %r13,%rdx
+    1d08:	|  |  |  |      48 89 ee             	mov    %rbp,%rsi
+    1d0b:	|  |  |  |      48 89 df             	mov    %rbx,%rdi
+    1d0e:	+--|--|--|----- e8 e3 fe ff ff       	call   1bf6 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]>
+            leftmost = false;
+    1d13:	|  |  |  |      45 31 f6             	xor    %r14d,%r14d
+    1d16:	|  |  |  |  /-- eb 16                	jmp    1d2e <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x138>
+            pdq(p + m + 1, r, less, bad_allowed, false);
+    1d18:	|  |  |  \--|-> 4c 89 e6             	mov    %r12,%rsi
+    1d1b:	|  |  |     |   4c 89 ff             	mov    %r15,%rdi
+    1d1e:	|  |  |     |   31 c9                	xor    %ecx,%ecx
+    1d20:	|  |  |     |   4c 89 ea             	mov    %r13,%rdx
+    1d23:	\--|--|-----|-- e8 ce fe ff ff       	call   1bf6 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]>
+    1d28:	   |  |     |   49 89 ec             	mov    %rbp,%r12
+    1d2b:	   |  |     |   49 89 df             	mov    %rbx,%r15
+    1d2e:	   |  |     \-> 4c 89 e6             	mov    %r12,%rsi
+    1d31:	   |  |         4c 89 fb             	mov    %r15,%rbx
+    1d34:	   \--|-------- e9 dd fe ff ff       	jmp    1c16 <void nel::sort::pdq<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&, unsigned long, bool) [clone .isra.0]+0x20>
+}
+    1d39:	      \-------> 48 83 c4 28          	add    $0x28,%rsp
+    1d3d:	                5b                   	pop    %rbx
+    1d3e:	                5d                   	pop    %rbp
+    1d3f:	                41 5c                	pop    %r12
+    1d41:	                41 5d                	pop    %r13
+    1d43:	                41 5e                	pop    %r14
+    1d45:	                41 5f                	pop    %r15
+    1d47:	                c3                   	ret
+
+0000000000001d48 <bench::now_ns()>:
+{
+    1d48:	48 83 ec 18          	sub    $0x18,%rsp
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1d4c:	bf 01 00 00 00       	mov    $0x1,%edi
+    1d51:	48 89 e6             	mov    %rsp,%rsi
+    1d54:	e8 07 f3 ff ff       	call   1060 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1d59:	48 69 04 24 00 ca 9a 	imul   $0x3b9aca00,(%rsp),%rax
+    1d60:	3b 
+    1d61:	48 03 44 24 08       	add    0x8(%rsp),%rax
+}
+    1d66:	48 83 c4 18          	add    $0x18,%rsp
+    1d6a:	c3                   	ret
+
+0000000000001d6b <bench::report_per_item(char const*, unsigned long, unsigned long)>:
+}
+
+// Log a result line: name, and time per item in ns (to 2 decimal places).
+inline void report_per_item(char const *const name, long unsigned int const ns,
+                            long unsigned int const items)
+{
+    1d6b:	    41 56                	push   %r14
+    1d6d:	    53                   	push   %rbx
+    1d6e:	    51                   	push   %rcx
+    1d6f:	    48 89 d1             	mov    %rdx,%rcx
+    long unsigned int const cns = (items == 0) ? 0 : (ns * 100UL) / items;
+    1d72:	    48 85 d2             	test   %rdx,%rdx
+    1d75:	/-- 74 0c                	je     1d83 <bench::report_per_item(char const*, unsigned long, unsigned long)+0x18>
+    1d77:	|   48 6b c6 64          	imul   $0x64,%rsi,%rax
+    1d7b:	|   31 d2                	xor    %edx,%edx
+    1d7d:	|   48 f7 f1             	div    %rcx
+    1d80:	|   48 89 c1             	mov    %rax,%rcx
+    long unsigned int const frac = cns % 100UL;
+    1d83:	\-> 48 89 c8             	mov    %rcx,%rax
+    1d86:	    bb 64 00 00 00       	mov    $0x64,%ebx
+    1d8b:	    31 d2                	xor    %edx,%edx
+    nel::log << name << ": " << cns / 100UL << '.' << (frac < 10 ? "0" : "") << frac
+             << "ns/item\n";
+    1d8d:	    48 89 fe             	mov    %rdi,%rsi
+    long unsigned int const frac = cns % 100UL;
+    1d90:	    48 f7 f3             	div    %rbx
+             << "ns/item\n";
+    1d93:	    48 8d 3d cf 32 00 00 	lea    0x32cf(%rip),%rdi        # 5069 <nel::log>
+    long unsigned int const frac = cns % 100UL;
+    1d9a:	    48 89 d3             	mov    %rdx,%rbx
+    1d9d:	    49 89 c6             	mov    %rax,%r14
+             << "ns/item\n";
+    1da0:	    e8 8b 06 00 00       	call   2430 <nel::operator<<(nel::Log&, char const*)>
+    1da5:	    48 8d 35 fd 13 00 00 	lea    0x13fd(%rip),%rsi        # 31a9 <_IO_stdin_used+0x1a9>
+    1dac:	    48 89 c7             	mov    %rax,%rdi
+    1daf:	    e8 7c 06 00 00       	call   2430 <nel::operator<<(nel::Log&, char const*)>
+    1db4:	    4c 89 f6             	mov    %r14,%rsi
+    1db7:	    48 89 c7             	mov    %rax,%rdi
+    1dba:	    e8 0c 07 00 00       	call   24cb <nel::operator<<(nel::Log&, unsigned long)>
+    1dbf:	    be 2e 00 00 00       	mov    $0x2e,%esi
+    1dc4:	    48 89 c7             	mov    %rax,%rdi
+    1dc7:	    e8 4b 06 00 00       	call   2417 <nel::operator<<(nel::Log&, char)>
+    1dcc:	    48 83 fb 0a          	cmp    $0xa,%rbx
+    1dd0:	    48 8d 35 53 13 00 00 	lea    0x1353(%rip),%rsi        # 312a <_IO_stdin_used+0x12a>
+    1dd7:	    48 89 c7             	mov    %rax,%rdi
+    1dda:	    48 8d 05 e2 12 00 00 	lea    0x12e2(%rip),%rax        # 30c3 <_IO_stdin_used+0xc3>
+    1de1:	    48 0f 43 f0          	cmovae %rax,%rsi
+    1de5:	    e8 46 06 00 00       	call   2430 <nel::operator<<(nel::Log&, char const*)>
+    1dea:	    48 89 de             	mov    %rbx,%rsi
+    1ded:	    48 89 c7             	mov    %rax,%rdi
+    1df0:	    e8 d6 06 00 00       	call   24cb <nel::operator<<(nel::Log&, unsigned long)>
+    1df5:	    48 8d 35 08 12 00 00 	lea    0x1208(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+    1dfc:	    48 89 c7             	mov    %rax,%rdi
+}
+    1dff:	    58                   	pop    %rax
+    1e00:	    5b                   	pop    %rbx
+    1e01:	    41 5e                	pop    %r14
+             << "ns/item\n";
+    1e03:	    e9 28 06 00 00       	jmp    2430 <nel::operator<<(nel::Log&, char const*)>
+
+0000000000001e08 <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+        };
+
+    public:
+        constexpr ~Result(void)
+        {
+            switch (tag_) { // result::dtor
+    1e08:	    83 3f 02             	cmpl   $0x2,(%rdi)
+    1e0b:	/-- 76 35                	jbe    1e42 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x3a>
+        constexpr ~Result(void)
+    1e0d:	|   48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    1e11:	|   48 8d 05 f5 11 00 00 	lea    0x11f5(%rip),%rax        # 300d <_IO_stdin_used+0xd>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    1e18:	|   48 8d 3d 08 12 00 00 	lea    0x1208(%rip),%rdi        # 3027 <_IO_stdin_used+0x27>
+    1e1f:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1e24:	|   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    1e29:	|   48 8d 05 e5 11 00 00 	lea    0x11e5(%rip),%rax        # 3015 <_IO_stdin_used+0x15>
+    1e30:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1e35:	|   c7 44 24 18 72 00 00 	movl   $0x72,0x18(%rsp)
+    1e3c:	|   00 
+    1e3d:	|   e8 b0 f2 ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+    1e42:	\-> c3                   	ret
+    1e43:	    90                   	nop
+
+0000000000001e44 <nel::Result<void, int>::~Result()>:
+        };
+
+    public:
+        constexpr ~Result(void)
+        {
+            switch (tag_) { // result<void>-dtor
+    1e44:	    83 3f 02             	cmpl   $0x2,(%rdi)
+    1e47:	/-- 76 35                	jbe    1e7e <nel::Result<void, int>::~Result()+0x3a>
+        constexpr ~Result(void)
+    1e49:	|   48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    1e4d:	|   48 8d 05 b9 11 00 00 	lea    0x11b9(%rip),%rax        # 300d <_IO_stdin_used+0xd>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    1e54:	|   48 8d 3d cc 11 00 00 	lea    0x11cc(%rip),%rdi        # 3027 <_IO_stdin_used+0x27>
+    1e5b:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1e60:	|   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    1e65:	|   48 8d 05 a9 11 00 00 	lea    0x11a9(%rip),%rax        # 3015 <_IO_stdin_used+0x15>
+    1e6c:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1e71:	|   c7 44 24 18 dd 02 00 	movl   $0x2dd,0x18(%rsp)
+    1e78:	|   00 
+    1e79:	|   e8 74 f2 ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+    1e7e:	\-> c3                   	ret
+    1e7f:	    90                   	nop
+
+0000000000001e80 <nel::Result<void, int>::unwrap(nel::Context const&)>:
+        }
+
+        template<typename Fn1, typename Fn2>
+        constexpr void consumev(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+        {
+            auto tag = tag_;
+    1e80:	          8b 07                	mov    (%rdi),%eax
+            tag_ = Tag::INVAL;
+    1e82:	          31 d2                	xor    %edx,%edx
+    1e84:	          89 17                	mov    %edx,(%rdi)
+            switch (tag) { // result<void>-consume
+    1e86:	          83 f8 01             	cmp    $0x1,%eax
+    1e89:	/-------- 74 56                	je     1ee1 <nel::Result<void, int>::unwrap(nel::Context const&)+0x61>
+         * @return if Ok, value wrapped/contained.
+         * @return if not Ok, calls abort, there is no return.
+         *
+         * `this` is consumed by the operation.
+         */
+        constexpr void unwrap(Context const &ctx = Context())
+    1e8b:	|         48 83 ec 28          	sub    $0x28,%rsp
+            switch (tag) { // result<void>-consume
+    1e8f:	|         83 f8 02             	cmp    $0x2,%eax
+    1e92:	|     /-- 74 10                	je     1ea4 <nel::Result<void, int>::unwrap(nel::Context const&)+0x24>
+    1e94:	|     |   85 c0                	test   %eax,%eax
+    1e96:	|  /--|-- 75 3d                	jne    1ed5 <nel::Result<void, int>::unwrap(nel::Context const&)+0x55>
+                    nel::panic("invalid Result", ctx);
+    1e98:	|  |  |   48 8d 3d a8 11 00 00 	lea    0x11a8(%rip),%rdi        # 3047 <_IO_stdin_used+0x47>
+    1e9f:	|  |  |   e8 4e f2 ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+            : fn_name_(fn_name)
+    1ea4:	|  |  \-> 48 8d 05 87 11 00 00 	lea    0x1187(%rip),%rax        # 3032 <_IO_stdin_used+0x32>
+        {
+            return consumev([](void) {}, [](E &&) { nel::panic("not an ok"); }, ctx);
+    1eab:	|  |      48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , line_num_(line_num)
+    1eb0:	|  |      c7 44 24 18 1f 04 00 	movl   $0x41f,0x18(%rsp)
+    1eb7:	|  |      00 
+            : fn_name_(fn_name)
+    1eb8:	|  |      48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1ebd:	|  |      48 8d 3d 79 11 00 00 	lea    0x1179(%rip),%rdi        # 303d <_IO_stdin_used+0x3d>
+            , file_name_(file_name)
+    1ec4:	|  |      48 8d 05 4a 11 00 00 	lea    0x114a(%rip),%rax        # 3015 <_IO_stdin_used+0x15>
+    1ecb:	|  |      48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    1ed0:	|  |      e8 1d f2 ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    1ed5:	|  \----> 48 8d 3d 4b 11 00 00 	lea    0x114b(%rip),%rdi        # 3027 <_IO_stdin_used+0x27>
+    1edc:	|         e8 11 f2 ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+    1ee1:	\-------> c3                   	ret
+
+0000000000001ee2 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>:
+            if (new_cap > max_capacity) { return nullptr; }
+    1ee2:	             48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    1ee9:	             ff ff 1f 
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    1eec:	             55                   	push   %rbp
+    1eed:	             53                   	push   %rbx
+    1eee:	             48 83 ec 38          	sub    $0x38,%rsp
+            if (new_cap > max_capacity) { return nullptr; }
+    1ef2:	             48 39 f0             	cmp    %rsi,%rax
+    1ef5:	/----------- 0f 82 9e 00 00 00    	jb     1f99 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0xb7>
+    1efb:	|            48 89 f3             	mov    %rsi,%rbx
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1efe:	|            48 8d 34 b5 14 00 00 	lea    0x14(,%rsi,4),%rsi
+    1f05:	|            00 
+                                    : std::realloc(p, new_size);
+    1f06:	|            e8 95 f1 ff ff       	call   10a0 <realloc@plt>
+            if (new_p == nullptr) {
+    1f0b:	|            48 85 c0             	test   %rax,%rax
+    1f0e:	|     /----- 75 12                	jne    1f22 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x40>
+            : tag_(Tag::ERR)
+    1f10:	|     |      c7 44 24 08 02 00 00 	movl   $0x2,0x8(%rsp)
+    1f17:	|     |      00 
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+            : value_(forward<Type>(val))
+    1f18:	|     |      c7 44 24 10 01 00 00 	movl   $0x1,0x10(%rsp)
+    1f1f:	|     |      00 
+    1f20:	|     |  /-- eb 0d                	jmp    1f2f <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x4d>
+            : tag_(Tag::OK)
+    1f22:	|     \--|-> c7 44 24 08 01 00 00 	movl   $0x1,0x8(%rsp)
+    1f29:	|        |   00 
+        {
+        }
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+            : value_(forward<Args>(args)...)
+    1f2a:	|        |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            : fn_name_(fn_name)
+    1f2f:	|        \-> 48 8d 05 20 11 00 00 	lea    0x1120(%rip),%rax        # 3056 <_IO_stdin_used+0x56>
+            , line_num_(line_num)
+    1f36:	|            c7 44 24 28 89 00 00 	movl   $0x89,0x28(%rsp)
+    1f3d:	|            00 
+    1f3e:	|            48 8d 7c 24 08       	lea    0x8(%rsp),%rdi
+            : fn_name_(fn_name)
+    1f43:	|            48 89 44 24 18       	mov    %rax,0x18(%rsp)
+            , file_name_(file_name)
+    1f48:	|            48 8d 05 0f 11 00 00 	lea    0x110f(%rip),%rax        # 305e <_IO_stdin_used+0x5e>
+    1f4f:	|            48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    1f54:	|            8b 44 24 08          	mov    0x8(%rsp),%eax
+            switch (tag_) { // result-match
+    1f58:	|            83 f8 01             	cmp    $0x1,%eax
+    1f5b:	|     /----- 74 21                	je     1f7e <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x9c>
+    1f5d:	|     |      83 f8 02             	cmp    $0x2,%eax
+    1f60:	|  /--|----- 74 32                	je     1f94 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0xb2>
+    1f62:	|  |  |      85 c0                	test   %eax,%eax
+                    nel::panic("invalid Result", ctx);
+    1f64:	|  |  |      48 8d 3d dc 10 00 00 	lea    0x10dc(%rip),%rdi        # 3047 <_IO_stdin_used+0x47>
+    1f6b:	|  |  |      48 8d 74 24 18       	lea    0x18(%rsp),%rsi
+            switch (tag_) { // result-match
+    1f70:	|  |  |  /-- 74 07                	je     1f79 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0x97>
+                    nel::panic("bad Result", ctx);
+    1f72:	|  |  |  |   48 8d 3d ae 10 00 00 	lea    0x10ae(%rip),%rdi        # 3027 <_IO_stdin_used+0x27>
+    1f79:	|  |  |  \-> e8 74 f1 ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    1f7e:	|  |  \----> 48 8b 6c 24 10       	mov    0x10(%rsp),%rbp
+            tag_ = Tag::INVAL;
+    1f83:	|  |         31 c0                	xor    %eax,%eax
+    1f85:	|  |         89 44 24 08          	mov    %eax,0x8(%rsp)
+            } else {
+    1f89:	|  |         e8 7a fe ff ff       	call   1e08 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+            new_n->alloc_ = new_cap;
+    1f8e:	|  |         48 89 5d 00          	mov    %rbx,0x0(%rbp)
+            return new_n;
+    1f92:	|  |     /-- eb 07                	jmp    1f9b <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)+0xb9>
+            } else {
+    1f94:	|  \-----|-> e8 6f fe ff ff       	call   1e08 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+            if (new_cap > max_capacity) { return nullptr; }
+    1f99:	\--------|-> 31 ed                	xor    %ebp,%ebp
+        }
+    1f9b:	         \-> 48 83 c4 38          	add    $0x38,%rsp
+    1f9f:	             48 89 e8             	mov    %rbp,%rax
+    1fa2:	             5b                   	pop    %rbx
+    1fa3:	             5d                   	pop    %rbp
+    1fa4:	             c3                   	ret
+
+0000000000001fa5 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>:
+        static constexpr Vector with_capacity(Count cap)
+    1fa5:	       53                   	push   %rbx
+    1fa6:	       48 89 fb             	mov    %rdi,%rbx
+            if (cap == 0) { return Vector(); }
+    1fa9:	       48 85 f6             	test   %rsi,%rsi
+    1fac:	   /-- 75 07                	jne    1fb5 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x10>
+            : item_(nullptr)
+    1fae:	   |   31 c9                	xor    %ecx,%ecx
+    1fb0:	   |   48 89 0f             	mov    %rcx,(%rdi)
+        }
+    1fb3:	/--|-- eb 15                	jmp    1fca <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x25>
+            Node *new_n = realloc(nullptr, capacity);
+    1fb5:	|  \-> 31 ff                	xor    %edi,%edi
+    1fb7:	|      e8 26 ff ff ff       	call   1ee2 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    1fbc:	|      48 85 c0             	test   %rax,%rax
+    1fbf:	|  /-- 74 06                	je     1fc7 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x22>
+    1fc1:	|  |   31 d2                	xor    %edx,%edx
+    1fc3:	|  |   48 89 50 08          	mov    %rdx,0x8(%rax)
+            : item_(move(o.item_))
+    1fc7:	|  \-> 48 89 03             	mov    %rax,(%rbx)
+        }
+    1fca:	\----> 48 89 d8             	mov    %rbx,%rax
+    1fcd:	       5b                   	pop    %rbx
+    1fce:	       c3                   	ret
+    1fcf:	       90                   	nop
+
+0000000000001fd0 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)>:
+         *
+         * @param val The value to move into the vec.
+         * @returns if successful, Result<void, T>::Ok()
+         * @returns if unsuccessful, Result<void, T>::Err() holding val
+         */
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+    1fd0:	                41 54                	push   %r12
+    1fd2:	                49 89 d4             	mov    %rdx,%r12
+    1fd5:	                55                   	push   %rbp
+    1fd6:	                48 89 f5             	mov    %rsi,%rbp
+    1fd9:	                53                   	push   %rbx
+    1fda:	                48 89 fb             	mov    %rdi,%rbx
+    1fdd:	                48 8b 3e             	mov    (%rsi),%rdi
+            return (item_ == nullptr) ? 0 : item_->len();
+    1fe0:	                48 85 ff             	test   %rdi,%rdi
+    1fe3:	            /-- 74 12                	je     1ff7 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x27>
+            return len_;
+    1fe5:	            |   48 8b 77 08          	mov    0x8(%rdi),%rsi
+            return alloc_;
+    1fe9:	            |   48 8b 17             	mov    (%rdi),%rdx
+            if (len() + n <= capacity()) { return true; }
+    1fec:	            |   48 8d 46 01          	lea    0x1(%rsi),%rax
+    1ff0:	            |   48 39 c2             	cmp    %rax,%rdx
+    1ff3:	/-----------|-- 73 76                	jae    206b <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x9b>
+    1ff5:	|        /--|-- eb 19                	jmp    2010 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x40>
+            Node *new_n = realloc(nullptr, capacity);
+    1ff7:	|        |  \-> 31 ff                	xor    %edi,%edi
+    1ff9:	|        |      be 04 00 00 00       	mov    $0x4,%esi
+    1ffe:	|        |      e8 df fe ff ff       	call   1ee2 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    2003:	|        |      48 85 c0             	test   %rax,%rax
+    2006:	|     /--|----- 74 3c                	je     2044 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x74>
+    2008:	|     |  |      31 d2                	xor    %edx,%edx
+    200a:	|     |  |      48 89 50 08          	mov    %rdx,0x8(%rax)
+    200e:	|  /--|--|----- eb 46                	jmp    2056 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x86>
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            if (cap <= cur) { return cap; }
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    2010:	|  |  |  \----> 48 83 fa 03          	cmp    $0x3,%rdx
+    2014:	|  |  |     /-- 77 15                	ja     202b <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x5b>
+    2016:	|  |  |     |   ba 04 00 00 00       	mov    $0x4,%edx
+    201b:	|  |  |     |   48 39 d0             	cmp    %rdx,%rax
+    201e:	|  |  |     |   48 0f 42 c2          	cmovb  %rdx,%rax
+    2022:	|  |  |     |   48 39 f0             	cmp    %rsi,%rax
+    2025:	|  |  |     |   48 0f 43 f0          	cmovae %rax,%rsi
+    2029:	|  |  |  /--|-- eb 21                	jmp    204c <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x7c>
+    202b:	|  |  |  |  \-> 48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+    202f:	|  |  |  |      48 39 c1             	cmp    %rax,%rcx
+    2032:	|  |  |  |      48 0f 43 c1          	cmovae %rcx,%rax
+    2036:	|  |  |  |      48 39 f0             	cmp    %rsi,%rax
+    2039:	|  |  |  |      48 0f 43 f0          	cmovae %rax,%rsi
+            } else if (new_cap == item_->capacity()) {
+    203d:	|  |  |  |      48 39 f2             	cmp    %rsi,%rdx
+    2040:	|  |  |  +----- 75 0a                	jne    204c <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x7c>
+    2042:	+--|--|--|----- eb 27                	jmp    206b <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x9b>
+                item_ = VectorNode::malloc(new_cap);
+    2044:	|  |  \--|----> 31 c0                	xor    %eax,%eax
+    2046:	|  |     |      48 89 45 00          	mov    %rax,0x0(%rbp)
+    204a:	|  |     |  /-- eb 10                	jmp    205c <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x8c>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    204c:	|  |     \--|-> e8 91 fe ff ff       	call   1ee2 <nel::heaped::Node<int, nel::heaped::Malloc>::realloc(nel::heaped::Node<int, nel::heaped::Malloc>*, unsigned long)>
+                if (p == nullptr) { return false; }
+    2051:	|  |        |   48 85 c0             	test   %rax,%rax
+    2054:	|  |        +-- 74 06                	je     205c <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x8c>
+                item_ = p;
+    2056:	|  \--------|-> 48 89 45 00          	mov    %rax,0x0(%rbp)
+    205a:	+-----------|-- eb 0f                	jmp    206b <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0x9b>
+    205c:	|           \-> 41 8b 04 24          	mov    (%r12),%eax
+            : tag_(Tag::ERR)
+    2060:	|               c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+    2066:	|               89 43 04             	mov    %eax,0x4(%rbx)
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    2069:	|     /-------- eb 32                	jmp    209d <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0xcd>
+        {
+            bool ok;
+            ok = try_reserve_for(1);
+            if (!ok) { return Result<void, Type>::Err(val); }
+            if (item_ == nullptr) { return Result<void, Type>::Err(val); }
+    206b:	\-----|-------> 48 8b 45 00          	mov    0x0(%rbp),%rax
+    206f:	      |         41 8b 0c 24          	mov    (%r12),%ecx
+    2073:	      |         48 85 c0             	test   %rax,%rax
+    2076:	      |     /-- 74 09                	je     2081 <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0xb1>
+            return len_;
+    2078:	      |     |   48 8b 50 08          	mov    0x8(%rax),%rdx
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+        {
+            if (len() >= capacity()) {
+    207c:	      |     |   48 3b 10             	cmp    (%rax),%rdx
+    207f:	      |  /--|-- 72 0b                	jb     208c <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0xbc>
+            : tag_(Tag::ERR)
+    2081:	      |  |  \-> c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+    2087:	      |  |      89 4b 04             	mov    %ecx,0x4(%rbx)
+            return Result(Phantom<Tag::ERR>(), forward<Args>(args)...);
+    208a:	      +--|----- eb 11                	jmp    209d <nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push(int&&)+0xcd>
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    208c:	      |  \----> 89 4c 90 10          	mov    %ecx,0x10(%rax,%rdx,4)
+            len_ += 1;
+    2090:	      |         48 ff c2             	inc    %rdx
+    2093:	      |         48 89 50 08          	mov    %rdx,0x8(%rax)
+            : tag_(Tag::OK)
+    2097:	      |         c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+            return item_->push_back(val);
+        }
+    209d:	      \-------> 48 89 d8             	mov    %rbx,%rax
+    20a0:	                5b                   	pop    %rbx
+    20a1:	                5d                   	pop    %rbp
+    20a2:	                41 5c                	pop    %r12
+    20a4:	                c3                   	ret
+
+00000000000020a5 <void nel::sort::break_patterns<int>(int*, unsigned long)>:
+    if (n >= small_n) {
+    20a5:	    48 83 fe 13          	cmp    $0x13,%rsi
+    20a9:	/-- 76 30                	jbe    20db <void nel::sort::break_patterns<int>(int*, unsigned long)+0x36>
+        swap(p[0], p[n / 4]);
+    20ab:	|   48 89 f0             	mov    %rsi,%rax
+    T t = move(a);
+    20ae:	|   8b 17                	mov    (%rdi),%edx
+    20b0:	|   48 83 e0 fc          	and    $0xfffffffffffffffc,%rax
+    20b4:	|   48 01 f8             	add    %rdi,%rax
+    a = move(b);
+    20b7:	|   8b 08                	mov    (%rax),%ecx
+    20b9:	|   89 0f                	mov    %ecx,(%rdi)
+    b = move(t);
+    20bb:	|   89 10                	mov    %edx,(%rax)
+        swap(p[n - 1], p[n - n / 4]);
+    20bd:	|   48 89 f2             	mov    %rsi,%rdx
+    20c0:	|   48 89 f0             	mov    %rsi,%rax
+    20c3:	|   48 c1 ea 02          	shr    $0x2,%rdx
+    20c7:	|   48 29 d0             	sub    %rdx,%rax
+    20ca:	|   48 8d 54 b7 fc       	lea    -0x4(%rdi,%rsi,4),%rdx
+    20cf:	|   48 8d 04 87          	lea    (%rdi,%rax,4),%rax
+    T t = move(a);
+    20d3:	|   8b 0a                	mov    (%rdx),%ecx
+    a = move(b);
+    20d5:	|   8b 30                	mov    (%rax),%esi
+    20d7:	|   89 32                	mov    %esi,(%rdx)
+    b = move(t);
+    20d9:	|   89 08                	mov    %ecx,(%rax)
+}
+    20db:	\-> c3                   	ret
+
+00000000000020dc <void nel::sort::reverse<int>(int*, unsigned long)>:
+
+// Reverse [p, p+n).
+template<typename T>
+void reverse(T p[], Length const n)
+{
+    Index i = 0;
+    20dc:	       31 c0                	xor    %eax,%eax
+    Index j = n;
+    while (i + 1 < j) {
+    20de:	/----> 48 ff c0             	inc    %rax
+    20e1:	|      48 39 f0             	cmp    %rsi,%rax
+    20e4:	|  /-- 73 13                	jae    20f9 <void nel::sort::reverse<int>(int*, unsigned long)+0x1d>
+        j -= 1;
+    20e6:	|  |   48 ff ce             	dec    %rsi
+    T t = move(a);
+    20e9:	|  |   8b 54 87 fc          	mov    -0x4(%rdi,%rax,4),%edx
+    a = move(b);
+    20ed:	|  |   8b 0c b7             	mov    (%rdi,%rsi,4),%ecx
+    20f0:	|  |   89 4c 87 fc          	mov    %ecx,-0x4(%rdi,%rax,4)
+    b = move(t);
+    20f4:	|  |   89 14 b7             	mov    %edx,(%rdi,%rsi,4)
+    20f7:	\--|-- eb e5                	jmp    20de <void nel::sort::reverse<int>(int*, unsigned long)+0x2>
+        swap(p[i], p[j]);
+        i += 1;
+    }
+}
+    20f9:	   \-> c3                   	ret
+
+00000000000020fa <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)>:
+ * If the shorter run fits in buf, it is moved there and merged back in one pass.
+ * Else the runs are split with binary searches and rotations, and merged in parts,
+ * any part whose shorter run fits in buf is merged through it.
+ */
+template<typename T, typename F>
+void merge(T p[], Length const m, Length const n, T buf[], Length const buf_n, F &less)
+    20fa:	/----------------------> 41 57                	push   %r15
+    20fc:	|                        48 89 f0             	mov    %rsi,%rax
+    20ff:	|                        49 89 d7             	mov    %rdx,%r15
+    2102:	|                        41 56                	push   %r14
+    2104:	|                        41 55                	push   %r13
+    2106:	|                        41 54                	push   %r12
+    2108:	|                        55                   	push   %rbp
+    2109:	|                        48 89 fd             	mov    %rdi,%rbp
+    210c:	|                        53                   	push   %rbx
+    210d:	|                        48 83 ec 28          	sub    $0x28,%rsp
+    2111:	|                        4c 89 0c 24          	mov    %r9,(%rsp)
+{
+    // already in order, the common case for nearly sorted items.
+    if (m == 0 || m == n || !less(p[m], p[m - 1])) { return; }
+    2115:	|     /----------------> 48 85 c0             	test   %rax,%rax
+    2118:	|  /--|----------------- 0f 84 70 02 00 00    	je     238e <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x294>
+    211e:	|  |  |                  4c 39 f8             	cmp    %r15,%rax
+    2121:	|  +--|----------------- 0f 84 67 02 00 00    	je     238e <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x294>
+    2127:	|  |  |                  48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+    212e:	|  |  |                  00 
+    212f:	|  |  |                  48 8d 54 35 00       	lea    0x0(%rbp,%rsi,1),%rdx
+    2134:	|  |  |                  8b 7c 35 fc          	mov    -0x4(%rbp,%rsi,1),%edi
+    2138:	|  |  |                  39 3a                	cmp    %edi,(%rdx)
+    213a:	|  +--|----------------- 0f 8d 4e 02 00 00    	jge    238e <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x294>
+
+    Length const a = m;
+    Length const b = n - m;
+    2140:	|  |  |                  4c 89 fb             	mov    %r15,%rbx
+    if (a <= b && a <= buf_n) {
+    2143:	|  |  |                  4c 89 c6             	mov    %r8,%rsi
+    Length const b = n - m;
+    2146:	|  |  |                  48 29 c3             	sub    %rax,%rbx
+    if (a <= b && a <= buf_n) {
+    2149:	|  |  |                  4c 39 c3             	cmp    %r8,%rbx
+    214c:	|  |  |                  48 0f 46 f3          	cmovbe %rbx,%rsi
+    2150:	|  |  |                  48 39 c6             	cmp    %rax,%rsi
+    2153:	|  |  |  /-------------- 72 62                	jb     21b7 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0xbd>
+        for (Index i = 0; i < a; ++i) {
+    2155:	|  |  |  |               31 d2                	xor    %edx,%edx
+            buf[i] = move(p[i]);
+    2157:	|  |  |  |           /-> 8b 74 95 00          	mov    0x0(%rbp,%rdx,4),%esi
+    215b:	|  |  |  |           |   89 34 91             	mov    %esi,(%rcx,%rdx,4)
+        for (Index i = 0; i < a; ++i) {
+    215e:	|  |  |  |           |   48 ff c2             	inc    %rdx
+    2161:	|  |  |  |           |   48 39 c2             	cmp    %rax,%rdx
+    2164:	|  |  |  |           \-- 72 f1                	jb     2157 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x5d>
+    2166:	|  |  |  |               48 89 c7             	mov    %rax,%rdi
+        }
+        Index i = 0;
+        Index j = m;
+        Index o = 0;
+    2169:	|  |  |  |               31 f6                	xor    %esi,%esi
+        Index i = 0;
+    216b:	|  |  |  |               31 d2                	xor    %edx,%edx
+        while (i < a && j < n) {
+    216d:	|  |  |  |     /-------> 48 39 c2             	cmp    %rax,%rdx
+    2170:	|  +--|--|-----|-------- 0f 83 18 02 00 00    	jae    238e <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x294>
+    2176:	|  |  |  |     |         4c 39 ff             	cmp    %r15,%rdi
+    2179:	|  |  |  |  /--|-------- 73 23                	jae    219e <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0xa4>
+            return a < b;
+    217b:	|  |  |  |  |  |         44 8b 44 bd 00       	mov    0x0(%rbp,%rdi,4),%r8d
+    2180:	|  |  |  |  |  |         44 8b 0c 91          	mov    (%rcx,%rdx,4),%r9d
+            p[o++] = less(p[j], buf[i]) ? move(p[j++]) : move(buf[i++]);
+    2184:	|  |  |  |  |  |         45 39 c8             	cmp    %r9d,%r8d
+    2187:	|  |  |  |  |  |     /-- 7d 05                	jge    218e <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x94>
+    2189:	|  |  |  |  |  |     |   48 ff c7             	inc    %rdi
+    218c:	|  |  |  |  |  |  /--|-- eb 06                	jmp    2194 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x9a>
+    218e:	|  |  |  |  |  |  |  \-> 48 ff c2             	inc    %rdx
+    2191:	|  |  |  |  |  |  |      45 89 c8             	mov    %r9d,%r8d
+    2194:	|  |  |  |  |  |  \----> 48 ff c6             	inc    %rsi
+    2197:	|  |  |  |  |  |         44 89 44 b5 fc       	mov    %r8d,-0x4(%rbp,%rsi,4)
+    219c:	|  |  |  |  |  \-------- eb cf                	jmp    216d <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x73>
+        }
+        while (i < a) {
+    219e:	|  |  |  |  >----------> 48 39 c2             	cmp    %rax,%rdx
+    21a1:	|  +--|--|--|----------- 0f 83 e7 01 00 00    	jae    238e <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x294>
+            p[o++] = move(buf[i++]);
+    21a7:	|  |  |  |  |            48 ff c2             	inc    %rdx
+    21aa:	|  |  |  |  |            48 ff c6             	inc    %rsi
+    21ad:	|  |  |  |  |            8b 7c 91 fc          	mov    -0x4(%rcx,%rdx,4),%edi
+    21b1:	|  |  |  |  |            89 7c b5 fc          	mov    %edi,-0x4(%rbp,%rsi,4)
+    21b5:	|  |  |  |  \----------- eb e7                	jmp    219e <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0xa4>
+        }
+    } else if (b < a && b <= buf_n) {
+    21b7:	|  |  |  \-------------> 48 39 c3             	cmp    %rax,%rbx
+    21ba:	|  |  |     /----------- 73 5e                	jae    221a <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x120>
+    21bc:	|  |  |     |            49 39 d8             	cmp    %rbx,%r8
+    21bf:	|  |  |     +----------- 72 59                	jb     221a <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x120>
+        for (Index j = 0; j < b; ++j) {
+    21c1:	|  |  |     |            31 f6                	xor    %esi,%esi
+            buf[j] = move(p[m + j]);
+    21c3:	|  |  |     |        /-> 8b 3c b2             	mov    (%rdx,%rsi,4),%edi
+    21c6:	|  |  |     |        |   89 3c b1             	mov    %edi,(%rcx,%rsi,4)
+        for (Index j = 0; j < b; ++j) {
+    21c9:	|  |  |     |        |   48 ff c6             	inc    %rsi
+    21cc:	|  |  |     |        |   48 39 f3             	cmp    %rsi,%rbx
+    21cf:	|  |  |     |        \-- 75 f2                	jne    21c3 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0xc9>
+        }
+        Index i = m;
+        Index j = b;
+        Index o = n;
+        while (i > 0 && j > 0) {
+            p[--o] = less(buf[j - 1], p[i - 1]) ? move(p[--i]) : move(buf[--j]);
+    21d1:	|  |  |     |  /-------> 8b 54 85 fc          	mov    -0x4(%rbp,%rax,4),%edx
+    21d5:	|  |  |     |  |         39 54 99 fc          	cmp    %edx,-0x4(%rcx,%rbx,4)
+    21d9:	|  |  |     |  |  /----- 7d 09                	jge    21e4 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0xea>
+    21db:	|  |  |     |  |  |      48 ff c8             	dec    %rax
+    21de:	|  |  |     |  |  |      8b 54 85 00          	mov    0x0(%rbp,%rax,4),%edx
+    21e2:	|  |  |     |  |  |  /-- eb 06                	jmp    21ea <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0xf0>
+    21e4:	|  |  |     |  |  \--|-> 48 ff cb             	dec    %rbx
+    21e7:	|  |  |     |  |     |   8b 14 99             	mov    (%rcx,%rbx,4),%edx
+    21ea:	|  |  |     |  |     \-> 49 ff cf             	dec    %r15
+    21ed:	|  |  |     |  |         42 89 54 bd 00       	mov    %edx,0x0(%rbp,%r15,4)
+        while (i > 0 && j > 0) {
+    21f2:	|  |  |     |  |         48 85 c0             	test   %rax,%rax
+    21f5:	|  |  |     |  |     /-- 74 0a                	je     2201 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x107>
+    21f7:	|  |  |     |  |     |   48 85 db             	test   %rbx,%rbx
+    21fa:	|  |  |     |  \-----|-- 75 d5                	jne    21d1 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0xd7>
+    21fc:	|  +--|-----|--------|-- e9 8d 01 00 00       	jmp    238e <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x294>
+        }
+        while (j > 0) {
+    2201:	|  |  |     |        >-> 48 85 db             	test   %rbx,%rbx
+    2204:	|  +--|-----|--------|-- 0f 84 84 01 00 00    	je     238e <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x294>
+            p[--o] = move(buf[--j]);
+    220a:	|  |  |     |        |   48 ff cb             	dec    %rbx
+    220d:	|  |  |     |        |   49 ff cf             	dec    %r15
+    2210:	|  |  |     |        |   8b 04 99             	mov    (%rcx,%rbx,4),%eax
+    2213:	|  |  |     |        |   42 89 44 bd 00       	mov    %eax,0x0(%rbp,%r15,4)
+    2218:	|  |  |     |        \-- eb e7                	jmp    2201 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x107>
+        }
+    } else {
+        // Split the longer run in half, and the other where that middle item would go.
+        Index c1;
+        Index c2;
+        if (a >= b) {
+    221a:	|  |  |     \----------> 48 39 d8             	cmp    %rbx,%rax
+    221d:	|  |  |  /-------------- 72 76                	jb     2295 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x19b>
+            c1 = a / 2;
+    221f:	|  |  |  |               49 89 c5             	mov    %rax,%r13
+    if (m == 0 || m == n || !less(p[m], p[m - 1])) { return; }
+    2222:	|  |  |  |               48 89 d6             	mov    %rdx,%rsi
+            c1 = a / 2;
+    2225:	|  |  |  |               49 d1 ed             	shr    %r13
+            c2 = m + search::lower_bound(p + m, b, p[c1], less);
+    2228:	|  |  |  |               4e 8d 64 ad 00       	lea    0x0(%rbp,%r13,4),%r12
+template<typename T, typename F>
+Index partition_point(T const p[], Length n, F &pred)
+{
+    if (n == 0) { return 0; }
+    T const *b = p;
+    while (n > 1) {
+    222d:	|  |  |  |     /-------> 48 83 fb 01          	cmp    $0x1,%rbx
+    2231:	|  |  |  |     |  /----- 76 48                	jbe    227b <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x181>
+        Length const h = n / 2;
+    2233:	|  |  |  |     |  |      49 89 d9             	mov    %rbx,%r9
+    2236:	|  |  |  |     |  |      49 d1 e9             	shr    %r9
+        // While far apart, fetch both possible next midpoints while this one is compared.
+        // Addresses computed as ints, a prefetch past the end is harmless.
+        if (h * sizeof(T) > prefetch_bytes) {
+    2239:	|  |  |  |     |  |      4a 8d 3c 8d 00 00 00 	lea    0x0(,%r9,4),%rdi
+    2240:	|  |  |  |     |  |      00 
+    2241:	|  |  |  |     |  |      48 81 ff 00 01 00 00 	cmp    $0x100,%rdi
+    2248:	|  |  |  |     |  |  /-- 76 1b                	jbe    2265 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x16b>
+            __builtin_prefetch(
+                reinterpret_cast<void const *>(uintptr_t(b) + (h / 2) * sizeof(T)));
+    224a:	|  |  |  |     |  |  |   49 89 db             	mov    %rbx,%r11
+    224d:	|  |  |  |     |  |  |   49 83 e3 fc          	and    $0xfffffffffffffffc,%r11
+            __builtin_prefetch(
+    2251:	|  |  |  |     |  |  |   42 0f 18 0c 1e       	prefetcht0 (%rsi,%r11,1)
+                reinterpret_cast<void const *>(uintptr_t(b) + (h / 2) * sizeof(T)));
+    2256:	|  |  |  |     |  |  |   49 89 db             	mov    %rbx,%r11
+    2259:	|  |  |  |     |  |  |   49 c1 eb 02          	shr    $0x2,%r11
+            __builtin_prefetch(
+                reinterpret_cast<void const *>(uintptr_t(b) + (h + h / 2) * sizeof(T)));
+    225d:	|  |  |  |     |  |  |   4d 01 cb             	add    %r9,%r11
+            __builtin_prefetch(
+    2260:	|  |  |  |     |  |  |   42 0f 18 0c 9e       	prefetcht0 (%rsi,%r11,4)
+        }
+        b = pred(b[h]) ? b + h : b;
+    2265:	|  |  |  |     |  |  \-> 48 01 f7             	add    %rsi,%rdi
+    2268:	|  |  |  |     |  |      45 8b 14 24          	mov    (%r12),%r10d
+    226c:	|  |  |  |     |  |      44 39 17             	cmp    %r10d,(%rdi)
+    226f:	|  |  |  |     |  |      48 0f 4d fe          	cmovge %rsi,%rdi
+        n -= h;
+    2273:	|  |  |  |     |  |      4c 29 cb             	sub    %r9,%rbx
+        b = pred(b[h]) ? b + h : b;
+    2276:	|  |  |  |     |  |      48 89 fe             	mov    %rdi,%rsi
+    2279:	|  |  |  |     \--|----- eb b2                	jmp    222d <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x133>
+    }
+    return Index(b - p) + (pred(*b) ? 1 : 0);
+    227b:	|  |  |  |        \----> 31 db                	xor    %ebx,%ebx
+    227d:	|  |  |  |               41 8b 3c 24          	mov    (%r12),%edi
+    2281:	|  |  |  |               39 3e                	cmp    %edi,(%rsi)
+    2283:	|  |  |  |               0f 9c c3             	setl   %bl
+    2286:	|  |  |  |               48 29 d6             	sub    %rdx,%rsi
+    2289:	|  |  |  |               48 c1 fe 02          	sar    $0x2,%rsi
+    228d:	|  |  |  |               48 01 f3             	add    %rsi,%rbx
+    2290:	|  |  |  |               48 01 c3             	add    %rax,%rbx
+    2293:	|  |  |  |  /----------- eb 75                	jmp    230a <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x210>
+        } else {
+            c2 = m + b / 2;
+    2295:	|  |  |  \--|----------> 48 d1 eb             	shr    %rbx
+            c1 = search::upper_bound(p, a, p[c2], less);
+    2298:	|  |  |     |            48 89 ee             	mov    %rbp,%rsi
+    229b:	|  |  |     |            48 89 c7             	mov    %rax,%rdi
+            c2 = m + b / 2;
+    229e:	|  |  |     |            48 01 c3             	add    %rax,%rbx
+            c1 = search::upper_bound(p, a, p[c2], less);
+    22a1:	|  |  |     |            4c 8d 64 9d 00       	lea    0x0(%rbp,%rbx,4),%r12
+    while (n > 1) {
+    22a6:	|  |  |     |  /-------> 48 83 ff 01          	cmp    $0x1,%rdi
+    22aa:	|  |  |     |  |         45 8b 1c 24          	mov    (%r12),%r11d
+    22ae:	|  |  |     |  |  /----- 76 45                	jbe    22f5 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x1fb>
+        Length const h = n / 2;
+    22b0:	|  |  |     |  |  |      49 89 fa             	mov    %rdi,%r10
+    22b3:	|  |  |     |  |  |      49 d1 ea             	shr    %r10
+        if (h * sizeof(T) > prefetch_bytes) {
+    22b6:	|  |  |     |  |  |      4e 8d 0c 95 00 00 00 	lea    0x0(,%r10,4),%r9
+    22bd:	|  |  |     |  |  |      00 
+    22be:	|  |  |     |  |  |      49 81 f9 00 01 00 00 	cmp    $0x100,%r9
+    22c5:	|  |  |     |  |  |  /-- 76 1b                	jbe    22e2 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x1e8>
+                reinterpret_cast<void const *>(uintptr_t(b) + (h / 2) * sizeof(T)));
+    22c7:	|  |  |     |  |  |  |   49 89 fe             	mov    %rdi,%r14
+    22ca:	|  |  |     |  |  |  |   49 83 e6 fc          	and    $0xfffffffffffffffc,%r14
+            __builtin_prefetch(
+    22ce:	|  |  |     |  |  |  |   42 0f 18 0c 36       	prefetcht0 (%rsi,%r14,1)
+                reinterpret_cast<void const *>(uintptr_t(b) + (h / 2) * sizeof(T)));
+    22d3:	|  |  |     |  |  |  |   49 89 fe             	mov    %rdi,%r14
+    22d6:	|  |  |     |  |  |  |   49 c1 ee 02          	shr    $0x2,%r14
+                reinterpret_cast<void const *>(uintptr_t(b) + (h + h / 2) * sizeof(T)));
+    22da:	|  |  |     |  |  |  |   4d 01 d6             	add    %r10,%r14
+            __builtin_prefetch(
+    22dd:	|  |  |     |  |  |  |   42 0f 18 0c b6       	prefetcht0 (%rsi,%r14,4)
+        b = pred(b[h]) ? b + h : b;
+    22e2:	|  |  |     |  |  |  \-> 49 01 f1             	add    %rsi,%r9
+    22e5:	|  |  |     |  |  |      45 3b 19             	cmp    (%r9),%r11d
+    22e8:	|  |  |     |  |  |  /-- 7d 03                	jge    22ed <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x1f3>
+    22ea:	|  |  |     |  |  |  |   49 89 f1             	mov    %rsi,%r9
+        n -= h;
+    22ed:	|  |  |     |  |  |  \-> 4c 29 d7             	sub    %r10,%rdi
+        b = pred(b[h]) ? b + h : b;
+    22f0:	|  |  |     |  |  |      4c 89 ce             	mov    %r9,%rsi
+    22f3:	|  |  |     |  \--|----- eb b1                	jmp    22a6 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x1ac>
+    return Index(b - p) + (pred(*b) ? 1 : 0);
+    22f5:	|  |  |     |     \----> 45 31 d2             	xor    %r10d,%r10d
+    22f8:	|  |  |     |            44 3b 1e             	cmp    (%rsi),%r11d
+    22fb:	|  |  |     |            41 0f 9d c2          	setge  %r10b
+    22ff:	|  |  |     |            48 29 ee             	sub    %rbp,%rsi
+    2302:	|  |  |     |            48 c1 fe 02          	sar    $0x2,%rsi
+    2306:	|  |  |     |            4d 8d 2c 32          	lea    (%r10,%rsi,1),%r13
+        }
+        rotate(p + c1, m - c1, c2 - m);
+    230a:	|  |  |     \----------> 49 89 dc             	mov    %rbx,%r12
+    230d:	|  |  |                  4e 8d 74 ad 00       	lea    0x0(%rbp,%r13,4),%r14
+    2312:	|  |  |                  4c 89 44 24 10       	mov    %r8,0x10(%rsp)
+    2317:	|  |  |                  49 29 c4             	sub    %rax,%r12
+    231a:	|  |  |                  4c 29 e8             	sub    %r13,%rax
+    reverse(p, l);
+    231d:	|  |  |                  4c 89 f7             	mov    %r14,%rdi
+    2320:	|  |  |                  48 89 4c 24 18       	mov    %rcx,0x18(%rsp)
+        rotate(p + c1, m - c1, c2 - m);
+    2325:	|  |  |                  48 89 c6             	mov    %rax,%rsi
+    2328:	|  |  |                  48 89 54 24 08       	mov    %rdx,0x8(%rsp)
+    reverse(p, l);
+    232d:	|  |  |                  e8 aa fd ff ff       	call   20dc <void nel::sort::reverse<int>(int*, unsigned long)>
+    reverse(p + l, r);
+    2332:	|  |  |                  48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    2337:	|  |  |                  4c 89 e6             	mov    %r12,%rsi
+        Index const nm = c1 + (c2 - m);
+    233a:	|  |  |                  4d 01 ec             	add    %r13,%r12
+        merge(p, c1, nm, buf, buf_n, less);
+        merge(p + nm, c2 - nm, n - nm, buf, buf_n, less);
+    233d:	|  |  |                  4d 29 e7             	sub    %r12,%r15
+    reverse(p + l, r);
+    2340:	|  |  |                  e8 97 fd ff ff       	call   20dc <void nel::sort::reverse<int>(int*, unsigned long)>
+    reverse(p, l + r);
+    2345:	|  |  |                  48 89 de             	mov    %rbx,%rsi
+    2348:	|  |  |                  4c 89 f7             	mov    %r14,%rdi
+    234b:	|  |  |                  4c 29 ee             	sub    %r13,%rsi
+    234e:	|  |  |                  e8 89 fd ff ff       	call   20dc <void nel::sort::reverse<int>(int*, unsigned long)>
+        merge(p, c1, nm, buf, buf_n, less);
+    2353:	|  |  |                  48 8b 4c 24 18       	mov    0x18(%rsp),%rcx
+    2358:	|  |  |                  48 89 ef             	mov    %rbp,%rdi
+    235b:	|  |  |                  4c 89 e2             	mov    %r12,%rdx
+    235e:	|  |  |                  4c 8b 44 24 10       	mov    0x10(%rsp),%r8
+    2363:	|  |  |                  4c 8b 0c 24          	mov    (%rsp),%r9
+    2367:	|  |  |                  4c 89 ee             	mov    %r13,%rsi
+        merge(p + nm, c2 - nm, n - nm, buf, buf_n, less);
+    236a:	|  |  |                  4a 8d 6c a5 00       	lea    0x0(%rbp,%r12,4),%rbp
+        merge(p, c1, nm, buf, buf_n, less);
+    236f:	|  |  |                  48 89 4c 24 08       	mov    %rcx,0x8(%rsp)
+    2374:	\--|--|----------------- e8 81 fd ff ff       	call   20fa <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)>
+        merge(p + nm, c2 - nm, n - nm, buf, buf_n, less);
+    2379:	   |  |                  48 89 d8             	mov    %rbx,%rax
+    237c:	   |  |                  48 8b 4c 24 08       	mov    0x8(%rsp),%rcx
+    2381:	   |  |                  4c 8b 44 24 10       	mov    0x10(%rsp),%r8
+    2386:	   |  |                  4c 29 e0             	sub    %r12,%rax
+    2389:	   |  \----------------- e9 87 fd ff ff       	jmp    2115 <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)+0x1b>
+    }
+}
+    238e:	   \-------------------> 48 83 c4 28          	add    $0x28,%rsp
+    2392:	                         5b                   	pop    %rbx
+    2393:	                         5d                   	pop    %rbp
+    2394:	                         41 5c                	pop    %r12
+    2396:	                         41 5d                	pop    %r13
+    2398:	                         41 5e                	pop    %r14
+    239a:	                         41 5f                	pop    %r15
+    239c:	                         c3                   	ret
+
+000000000000239d <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&)>:
+ *
+ * O(n log n) if buf_n >= n / 2, down to O(n log^2 n) in place (buf_n == 0).
+ * O(n) for already sorted items.
+ */
+template<typename T, typename F>
+void stable(T p[], Length const n, T buf[], Length const buf_n, F &less)
+    239d:	/----> 41 57                	push   %r15
+    239f:	|      41 56                	push   %r14
+    23a1:	|      41 55                	push   %r13
+    23a3:	|      41 54                	push   %r12
+    23a5:	|      55                   	push   %rbp
+    23a6:	|      48 89 fd             	mov    %rdi,%rbp
+    23a9:	|      53                   	push   %rbx
+    23aa:	|      48 89 f3             	mov    %rsi,%rbx
+    23ad:	|      41 51                	push   %r9
+{
+    if (n < small_n) {
+    23af:	|      48 83 fe 13          	cmp    $0x13,%rsi
+    23b3:	|  /-- 77 10                	ja     23c5 <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&)+0x28>
+    }
+    Length const h = n / 2;
+    stable(p, h, buf, buf_n, less);
+    stable(p + h, n - h, buf, buf_n, less);
+    merge(p, h, n, buf, buf_n, less);
+}
+    23b5:	|  |   5a                   	pop    %rdx
+    23b6:	|  |   5b                   	pop    %rbx
+    23b7:	|  |   5d                   	pop    %rbp
+    23b8:	|  |   41 5c                	pop    %r12
+    23ba:	|  |   41 5d                	pop    %r13
+    23bc:	|  |   41 5e                	pop    %r14
+    23be:	|  |   41 5f                	pop    %r15
+        insertion(p, n, less);
+    23c0:	|  |   e9 d6 f6 ff ff       	jmp    1a9b <void nel::sort::insertion<int, nel::sort::Less>(int*, unsigned long, nel::sort::Less&) [clone .isra.0]>
+    Length const h = n / 2;
+    23c5:	|  \-> 49 89 f7             	mov    %rsi,%r15
+    23c8:	|      49 89 d4             	mov    %rdx,%r12
+    23cb:	|      49 89 cd             	mov    %rcx,%r13
+    23ce:	|      4d 89 c6             	mov    %r8,%r14
+    23d1:	|      49 d1 ef             	shr    %r15
+    stable(p, h, buf, buf_n, less);
+    23d4:	|      4c 89 fe             	mov    %r15,%rsi
+    23d7:	+----- e8 c1 ff ff ff       	call   239d <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&)>
+    stable(p + h, n - h, buf, buf_n, less);
+    23dc:	|      48 89 de             	mov    %rbx,%rsi
+    23df:	|      4a 8d 7c bd 00       	lea    0x0(%rbp,%r15,4),%rdi
+    23e4:	|      4d 89 f0             	mov    %r14,%r8
+    23e7:	|      4c 29 fe             	sub    %r15,%rsi
+    23ea:	|      4c 89 e9             	mov    %r13,%rcx
+    23ed:	|      4c 89 e2             	mov    %r12,%rdx
+    23f0:	\----- e8 a8 ff ff ff       	call   239d <void nel::sort::stable<int, nel::sort::Less>(int*, unsigned long, int*, unsigned long, nel::sort::Less&)>
+}
+    23f5:	       58                   	pop    %rax
+    merge(p, h, n, buf, buf_n, less);
+    23f6:	       4d 89 f1             	mov    %r14,%r9
+    23f9:	       4d 89 e8             	mov    %r13,%r8
+    23fc:	       4c 89 e1             	mov    %r12,%rcx
+    23ff:	       48 89 da             	mov    %rbx,%rdx
+    2402:	       4c 89 fe             	mov    %r15,%rsi
+}
+    2405:	       5b                   	pop    %rbx
+    merge(p, h, n, buf, buf_n, less);
+    2406:	       48 89 ef             	mov    %rbp,%rdi
+}
+    2409:	       5d                   	pop    %rbp
+    240a:	       41 5c                	pop    %r12
+    240c:	       41 5d                	pop    %r13
+    240e:	       41 5e                	pop    %r14
+    2410:	       41 5f                	pop    %r15
+    merge(p, h, n, buf, buf_n, less);
+    2412:	       e9 e3 fc ff ff       	jmp    20fa <void nel::sort::merge<int, nel::sort::Less>(int*, unsigned long, unsigned long, int*, unsigned long, nel::sort::Less&)>
+
+0000000000002417 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    2417:	53                   	push   %rbx
+    2418:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    241b:	40 0f be fe          	movsbl %sil,%edi
+    241f:	48 8b 35 3a 2c 00 00 	mov    0x2c3a(%rip),%rsi        # 5060 <stderr@GLIBC_2.2.5>
+    2426:	e8 55 ec ff ff       	call   1080 <fputc@plt>
+    return outs;
+}
+    242b:	48 89 d8             	mov    %rbx,%rax
+    242e:	5b                   	pop    %rbx
+    242f:	c3                   	ret
+
+0000000000002430 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    2430:	53                   	push   %rbx
+    2431:	48 89 fb             	mov    %rdi,%rbx
+    2434:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    2437:	48 8b 35 22 2c 00 00 	mov    0x2c22(%rip),%rsi        # 5060 <stderr@GLIBC_2.2.5>
+    243e:	e8 2d ec ff ff       	call   1070 <fputs@plt>
+    return outs;
+}
+    2443:	48 89 d8             	mov    %rbx,%rax
+    2446:	5b                   	pop    %rbx
+    2447:	c3                   	ret
+
+0000000000002448 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    2448:	53                   	push   %rbx
+    2449:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    244c:	48 8b 3d 0d 2c 00 00 	mov    0x2c0d(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+    2453:	40 0f b6 d6          	movzbl %sil,%edx
+    2457:	31 c0                	xor    %eax,%eax
+    2459:	48 8d 35 ac 0d 00 00 	lea    0xdac(%rip),%rsi        # 320c <_IO_stdin_used+0x20c>
+    2460:	e8 2b ec ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2465:	48 89 d8             	mov    %rbx,%rax
+    2468:	5b                   	pop    %rbx
+    2469:	c3                   	ret
+
+000000000000246a <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    246a:	53                   	push   %rbx
+    246b:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    246e:	48 8b 3d eb 2b 00 00 	mov    0x2beb(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+    2475:	0f b7 d6             	movzwl %si,%edx
+    2478:	31 c0                	xor    %eax,%eax
+    247a:	48 8d 35 8b 0d 00 00 	lea    0xd8b(%rip),%rsi        # 320c <_IO_stdin_used+0x20c>
+    2481:	e8 0a ec ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2486:	48 89 d8             	mov    %rbx,%rax
+    2489:	5b                   	pop    %rbx
+    248a:	c3                   	ret
+
+000000000000248b <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    248b:	53                   	push   %rbx
+    248c:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    248f:	48 8b 3d ca 2b 00 00 	mov    0x2bca(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+{
+    2496:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    2498:	31 c0                	xor    %eax,%eax
+    249a:	48 8d 35 6b 0d 00 00 	lea    0xd6b(%rip),%rsi        # 320c <_IO_stdin_used+0x20c>
+    24a1:	e8 ea eb ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    24a6:	48 89 d8             	mov    %rbx,%rax
+    24a9:	5b                   	pop    %rbx
+    24aa:	c3                   	ret
+
+00000000000024ab <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    24ab:	53                   	push   %rbx
+    24ac:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    24af:	48 8b 3d aa 2b 00 00 	mov    0x2baa(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+{
+    24b6:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    24b8:	31 c0                	xor    %eax,%eax
+    24ba:	48 8d 35 4b 0d 00 00 	lea    0xd4b(%rip),%rsi        # 320c <_IO_stdin_used+0x20c>
+    24c1:	e8 ca eb ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    24c6:	48 89 d8             	mov    %rbx,%rax
+    24c9:	5b                   	pop    %rbx
+    24ca:	c3                   	ret
+
+00000000000024cb <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    24cb:	53                   	push   %rbx
+    24cc:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    24cf:	48 8b 3d 8a 2b 00 00 	mov    0x2b8a(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+{
+    24d6:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    24d9:	31 c0                	xor    %eax,%eax
+    24db:	48 8d 35 2d 0d 00 00 	lea    0xd2d(%rip),%rsi        # 320f <_IO_stdin_used+0x20f>
+    24e2:	e8 a9 eb ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    24e7:	48 89 d8             	mov    %rbx,%rax
+    24ea:	5b                   	pop    %rbx
+    24eb:	c3                   	ret
+
+Disassembly of section .fini:
+
+00000000000024ec <_fini>:
+    24ec:	48 83 ec 08          	sub    $0x8,%rsp
+    24f0:	48 83 c4 08          	add    $0x8,%rsp
+    24f4:	c3                   	ret
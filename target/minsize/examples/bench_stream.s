@@ -0,0 +1,2571 @@
+
+target/minsize/examples/bench_stream:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 3f 00 00 	mov    0x3fc5(%rip),%rax        # 4fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 3f 00 00    	push   0x3fca(%rip)        # 4ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 3f 00 00    	jmp    *0x3fcc(%rip)        # 4ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 3f 00 00    	jmp    *0x3fca(%rip)        # 5000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 3f 00 00    	jmp    *0x3fc2(%rip)        # 5008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <pthread_cond_broadcast@plt>:
+    1050:	ff 25 ba 3f 00 00    	jmp    *0x3fba(%rip)        # 5010 <pthread_cond_broadcast@GLIBC_2.3.2>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <clock_gettime@plt>:
+    1060:	ff 25 b2 3f 00 00    	jmp    *0x3fb2(%rip)        # 5018 <clock_gettime@GLIBC_2.17>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <pthread_cond_wait@plt>:
+    1070:	ff 25 aa 3f 00 00    	jmp    *0x3faa(%rip)        # 5020 <pthread_cond_wait@GLIBC_2.3.2>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <pthread_mutex_destroy@plt>:
+    1080:	ff 25 a2 3f 00 00    	jmp    *0x3fa2(%rip)        # 5028 <pthread_mutex_destroy@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fputs@plt>:
+    1090:	ff 25 9a 3f 00 00    	jmp    *0x3f9a(%rip)        # 5030 <fputs@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <fputc@plt>:
+    10a0:	ff 25 92 3f 00 00    	jmp    *0x3f92(%rip)        # 5038 <fputc@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <memcmp@plt>:
+    10b0:	ff 25 8a 3f 00 00    	jmp    *0x3f8a(%rip)        # 5040 <memcmp@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <pthread_cond_signal@plt>:
+    10c0:	ff 25 82 3f 00 00    	jmp    *0x3f82(%rip)        # 5048 <pthread_cond_signal@GLIBC_2.3.2>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <fprintf@plt>:
+    10d0:	ff 25 7a 3f 00 00    	jmp    *0x3f7a(%rip)        # 5050 <fprintf@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010e0 <pthread_cond_init@plt>:
+    10e0:	ff 25 72 3f 00 00    	jmp    *0x3f72(%rip)        # 5058 <pthread_cond_init@GLIBC_2.3.2>
+    10e6:	68 0b 00 00 00       	push   $0xb
+    10eb:	e9 30 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010f0 <pthread_mutex_unlock@plt>:
+    10f0:	ff 25 6a 3f 00 00    	jmp    *0x3f6a(%rip)        # 5060 <pthread_mutex_unlock@GLIBC_2.2.5>
+    10f6:	68 0c 00 00 00       	push   $0xc
+    10fb:	e9 20 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001100 <malloc@plt>:
+    1100:	ff 25 62 3f 00 00    	jmp    *0x3f62(%rip)        # 5068 <malloc@GLIBC_2.2.5>
+    1106:	68 0d 00 00 00       	push   $0xd
+    110b:	e9 10 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001110 <realloc@plt>:
+    1110:	ff 25 5a 3f 00 00    	jmp    *0x3f5a(%rip)        # 5070 <realloc@GLIBC_2.2.5>
+    1116:	68 0e 00 00 00       	push   $0xe
+    111b:	e9 00 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001120 <pthread_create@plt>:
+    1120:	ff 25 52 3f 00 00    	jmp    *0x3f52(%rip)        # 5078 <pthread_create@GLIBC_2.34>
+    1126:	68 0f 00 00 00       	push   $0xf
+    112b:	e9 f0 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001130 <memmove@plt>:
+    1130:	ff 25 4a 3f 00 00    	jmp    *0x3f4a(%rip)        # 5080 <memmove@GLIBC_2.2.5>
+    1136:	68 10 00 00 00       	push   $0x10
+    113b:	e9 e0 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001140 <pthread_cond_destroy@plt>:
+    1140:	ff 25 42 3f 00 00    	jmp    *0x3f42(%rip)        # 5088 <pthread_cond_destroy@GLIBC_2.3.2>
+    1146:	68 11 00 00 00       	push   $0x11
+    114b:	e9 d0 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001150 <sysconf@plt>:
+    1150:	ff 25 3a 3f 00 00    	jmp    *0x3f3a(%rip)        # 5090 <sysconf@GLIBC_2.2.5>
+    1156:	68 12 00 00 00       	push   $0x12
+    115b:	e9 c0 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001160 <pthread_join@plt>:
+    1160:	ff 25 32 3f 00 00    	jmp    *0x3f32(%rip)        # 5098 <pthread_join@GLIBC_2.34>
+    1166:	68 13 00 00 00       	push   $0x13
+    116b:	e9 b0 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001170 <pthread_mutex_init@plt>:
+    1170:	ff 25 2a 3f 00 00    	jmp    *0x3f2a(%rip)        # 50a0 <pthread_mutex_init@GLIBC_2.2.5>
+    1176:	68 14 00 00 00       	push   $0x14
+    117b:	e9 a0 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001180 <pthread_mutex_lock@plt>:
+    1180:	ff 25 22 3f 00 00    	jmp    *0x3f22(%rip)        # 50a8 <pthread_mutex_lock@GLIBC_2.2.5>
+    1186:	68 15 00 00 00       	push   $0x15
+    118b:	e9 90 fe ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+0000000000001190 <__cxa_finalize@plt>:
+    1190:	ff 25 4a 3e 00 00    	jmp    *0x3e4a(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1196:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000011a0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    11a0:	50                   	push   %rax
+    std::abort();
+    11a1:	e8 9a fe ff ff       	call   1040 <abort@plt>
+
+00000000000011a6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    11a6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    11a7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    11aa:	4c 8d 0d 6a 20 00 00 	lea    0x206a(%rip),%r9        # 321b <_IO_stdin_used+0x21b>
+    11b1:	31 c0                	xor    %eax,%eax
+    11b3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    11b7:	4c 8b 07             	mov    (%rdi),%r8
+    11ba:	48 8d 35 60 20 00 00 	lea    0x2060(%rip),%rsi        # 3221 <_IO_stdin_used+0x221>
+    11c1:	48 8b 3d f8 3e 00 00 	mov    0x3ef8(%rip),%rdi        # 50c0 <stderr@GLIBC_2.2.5>
+    11c8:	e8 03 ff ff ff       	call   10d0 <fprintf@plt>
+    std::abort();
+    11cd:	e8 6e fe ff ff       	call   1040 <abort@plt>
+
+00000000000011d2 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    11d2:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    11d6:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    11d9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    11dd:	31 c0                	xor    %eax,%eax
+    11df:	57                   	push   %rdi
+    11e0:	48 8b 3d d9 3e 00 00 	mov    0x3ed9(%rip),%rdi        # 50c0 <stderr@GLIBC_2.2.5>
+    11e7:	4c 8d 0d 2d 20 00 00 	lea    0x202d(%rip),%r9        # 321b <_IO_stdin_used+0x21b>
+    11ee:	4c 8b 06             	mov    (%rsi),%r8
+    11f1:	48 8d 35 3a 20 00 00 	lea    0x203a(%rip),%rsi        # 3232 <_IO_stdin_used+0x232>
+    11f8:	e8 d3 fe ff ff       	call   10d0 <fprintf@plt>
+    std::abort();
+    11fd:	e8 3e fe ff ff       	call   1040 <abort@plt>
+
+0000000000001202 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1202:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1206:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1209:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    120d:	31 c0                	xor    %eax,%eax
+    120f:	57                   	push   %rdi
+    1210:	48 8b 3d a9 3e 00 00 	mov    0x3ea9(%rip),%rdi        # 50c0 <stderr@GLIBC_2.2.5>
+    1217:	4c 8d 0d 29 20 00 00 	lea    0x2029(%rip),%r9        # 3247 <_IO_stdin_used+0x247>
+    121e:	4c 8b 06             	mov    (%rsi),%r8
+    1221:	48 8d 35 0a 20 00 00 	lea    0x200a(%rip),%rsi        # 3232 <_IO_stdin_used+0x232>
+    1228:	e8 a3 fe ff ff       	call   10d0 <fprintf@plt>
+    std::abort();
+    122d:	e8 0e fe ff ff       	call   1040 <abort@plt>
+
+0000000000001232 <main>:
+    bench::report("  neighbour 4MB   ", t_neighbour, passes * n_work);
+    nel::log << "  passes: " << passes << " sum: " << r << '\n';
+}
+
+int main()
+{
+    1232:	          41 56                	push   %r14
+    Buffers b = {alloc(n_state), alloc(n_state), alloc(n_work)};
+    1234:	          be 00 00 80 0c       	mov    $0xc800000,%esi
+{
+    1239:	          41 55                	push   %r13
+    123b:	          41 54                	push   %r12
+    123d:	          55                   	push   %rbp
+
+    nel::log << "one thread, snapshot then re-read the neighbour's working set\n";
+    123e:	          48 8d 2d 84 3e 00 00 	lea    0x3e84(%rip),%rbp        # 50c9 <nel::log>
+{
+    1245:	          53                   	push   %rbx
+    1246:	          48 83 ec 60          	sub    $0x60,%rsp
+    Buffers b = {alloc(n_state), alloc(n_state), alloc(n_work)};
+    124a:	          48 8d 5c 24 30       	lea    0x30(%rsp),%rbx
+    124f:	          4c 8d 6c 24 50       	lea    0x50(%rsp),%r13
+    1254:	          48 89 df             	mov    %rbx,%rdi
+    1257:	          e8 eb 02 00 00       	call   1547 <alloc(unsigned long)>
+    125c:	          48 8d 7c 24 40       	lea    0x40(%rsp),%rdi
+    1261:	          be 00 00 80 0c       	mov    $0xc800000,%esi
+    1266:	          e8 dc 02 00 00       	call   1547 <alloc(unsigned long)>
+    126b:	          4c 89 ef             	mov    %r13,%rdi
+    126e:	          be 00 00 40 00       	mov    $0x400000,%esi
+    1273:	          e8 cf 02 00 00       	call   1547 <alloc(unsigned long)>
+    nel::log << "one thread, snapshot then re-read the neighbour's working set\n";
+    1278:	          48 8d 35 d4 1e 00 00 	lea    0x1ed4(%rip),%rsi        # 3153 <_IO_stdin_used+0x153>
+    127f:	          48 89 ef             	mov    %rbp,%rdi
+    1282:	          e8 c2 0a 00 00       	call   1d49 <nel::operator<<(nel::Log&, char const*)>
+    Word r = touch(b.work);
+    1287:	          4c 89 ef             	mov    %r13,%rdi
+    128a:	          e8 9a 02 00 00       	call   1529 <touch(nel::Slice<unsigned long> const&)>
+    128f:	          49 89 c4             	mov    %rax,%r12
+
+// Time a run of f(), in ns.
+template<typename F>
+long unsigned int time_ns(F &&f)
+{
+    long unsigned int const b = now_ns();
+    1292:	          e8 4f 07 00 00       	call   19e6 <bench::now_ns()>
+            r += touch(b.work);
+    1297:	          4c 89 ef             	mov    %r13,%rdi
+    129a:	          49 89 c6             	mov    %rax,%r14
+    129d:	          e8 87 02 00 00       	call   1529 <touch(nel::Slice<unsigned long> const&)>
+    12a2:	          49 01 c4             	add    %rax,%r12
+    12a5:	          4d 8d 2c 84          	lea    (%r12,%rax,4),%r13
+    f();
+    return now_ns() - b;
+    12a9:	          e8 38 07 00 00       	call   19e6 <bench::now_ns()>
+    nel::log << "no snapshot\n";
+    12ae:	          48 8d 35 dd 1e 00 00 	lea    0x1edd(%rip),%rsi        # 3192 <_IO_stdin_used+0x192>
+    12b5:	          48 89 ef             	mov    %rbp,%rdi
+    12b8:	          4c 29 f0             	sub    %r14,%rax
+    12bb:	          49 89 c4             	mov    %rax,%r12
+    12be:	          e8 86 0a 00 00       	call   1d49 <nel::operator<<(nel::Log&, char const*)>
+    bench::report("  re-read 4MB     ", t, n_snaps * n_work);
+    12c3:	          ba 00 00 40 01       	mov    $0x1400000,%edx
+    12c8:	          4c 89 e6             	mov    %r12,%rsi
+    12cb:	          48 8d 3d fb 1d 00 00 	lea    0x1dfb(%rip),%rdi        # 30cd <_IO_stdin_used+0xcd>
+    12d2:	          e8 32 07 00 00       	call   1a09 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << r << '\n';
+    12d7:	          48 8d 35 02 1e 00 00 	lea    0x1e02(%rip),%rsi        # 30e0 <_IO_stdin_used+0xe0>
+    12de:	          48 89 ef             	mov    %rbp,%rdi
+    baseline_reread(b);
+    one_thread(b, false, "copy_from");
+    one_thread(b, true, "copy_from_streaming");
+    12e1:	          4c 8d 25 49 1d 00 00 	lea    0x1d49(%rip),%r12        # 3031 <_IO_stdin_used+0x31>
+    nel::log << "  sum: " << r << '\n';
+    12e8:	          e8 5c 0a 00 00       	call   1d49 <nel::operator<<(nel::Log&, char const*)>
+    12ed:	          4c 89 ee             	mov    %r13,%rsi
+    one_thread(b, false, "copy_from");
+    12f0:	          4c 8d 2d 91 1d 00 00 	lea    0x1d91(%rip),%r13        # 3088 <_IO_stdin_used+0x88>
+    nel::log << "  sum: " << r << '\n';
+    12f7:	          48 89 c7             	mov    %rax,%rdi
+    12fa:	          e8 e5 0a 00 00       	call   1de4 <nel::operator<<(nel::Log&, unsigned long)>
+    12ff:	          be 0a 00 00 00       	mov    $0xa,%esi
+    1304:	          48 89 c7             	mov    %rax,%rdi
+    1307:	          e8 24 0a 00 00       	call   1d30 <nel::operator<<(nel::Log&, char)>
+    one_thread(b, false, "copy_from");
+    130c:	          31 f6                	xor    %esi,%esi
+    130e:	          4c 89 ea             	mov    %r13,%rdx
+    1311:	          48 89 df             	mov    %rbx,%rdi
+    1314:	          e8 fb 03 00 00       	call   1714 <one_thread(Buffers&, bool, char const*)>
+    one_thread(b, true, "copy_from_streaming");
+    1319:	          4c 89 e2             	mov    %r12,%rdx
+    131c:	          be 01 00 00 00       	mov    $0x1,%esi
+    1321:	          48 89 df             	mov    %rbx,%rdi
+    1324:	          e8 eb 03 00 00       	call   1714 <one_thread(Buffers&, bool, char const*)>
+
+    if (nel::par::Pool::available_parallelism() < 2) {
+    1329:	          e8 d8 0c 00 00       	call   2006 <nel::par::Pool::available_parallelism()>
+    132e:	          48 83 f8 01          	cmp    $0x1,%rax
+    1332:	      /-- 77 14                	ja     1348 <main+0x116>
+        nel::log << "one cpu, no neighbour thread\n";
+    1334:	      |   48 8d 35 64 1e 00 00 	lea    0x1e64(%rip),%rsi        # 319f <_IO_stdin_used+0x19f>
+    133b:	      |   48 89 ef             	mov    %rbp,%rdi
+    133e:	      |   e8 06 0a 00 00       	call   1d49 <nel::operator<<(nel::Log&, char const*)>
+    1343:	/-----|-- e9 c7 00 00 00       	jmp    140f <main+0x1dd>
+    } else {
+        auto pool = nel::par::Pool::try_new(2).unwrap();
+    1348:	|     \-> 48 8d 7c 24 08       	lea    0x8(%rsp),%rdi
+    134d:	|         be 02 00 00 00       	mov    $0x2,%esi
+    1352:	|         e8 f7 0e 00 00       	call   224e <nel::par::Pool::try_new(unsigned long)>
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1357:	|         48 8d 05 5f 1e 00 00 	lea    0x1e5f(%rip),%rax        # 31bd <_IO_stdin_used+0x1bd>
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+        {
+            // a consuming matcher..
+            // that moves the value to the closures..
+            auto tag = tag_;
+            tag_ = Tag::INVAL;
+    135e:	|         31 d2                	xor    %edx,%edx
+            , file_name_(file_name)
+            , line_num_(line_num)
+    1360:	|         c7 44 24 28 8f 00 00 	movl   $0x8f,0x28(%rsp)
+    1367:	|         00 
+            : fn_name_(fn_name)
+    1368:	|         48 89 44 24 18       	mov    %rax,0x18(%rsp)
+            , file_name_(file_name)
+    136d:	|         48 8d 05 96 1c 00 00 	lea    0x1c96(%rip),%rax        # 300a <_IO_stdin_used+0xa>
+    1374:	|         48 89 44 24 20       	mov    %rax,0x20(%rsp)
+            auto tag = tag_;
+    1379:	|         8b 44 24 08          	mov    0x8(%rsp),%eax
+            tag_ = Tag::INVAL;
+    137d:	|         89 54 24 08          	mov    %edx,0x8(%rsp)
+            switch (tag) { // result-consume
+    1381:	|         83 f8 01             	cmp    $0x1,%eax
+    1384:	|     /-- 74 25                	je     13ab <main+0x179>
+    1386:	|     |   83 f8 02             	cmp    $0x2,%eax
+         * `this` is consumed by the operation.
+         */
+        constexpr T unwrap(Context const &ctx = Context())
+        {
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    1389:	|     |   48 8d 3d 76 1e 00 00 	lea    0x1e76(%rip),%rdi        # 3206 <_IO_stdin_used+0x206>
+    1390:	|     |   48 8d 74 24 18       	lea    0x18(%rsp),%rsi
+            switch (tag) { // result-consume
+    1395:	|  /--|-- 74 73                	je     140a <main+0x1d8>
+                    nel::panic("bad Result", ctx);
+    1397:	|  |  |   48 8d 3d 8c 1d 00 00 	lea    0x1d8c(%rip),%rdi        # 312a <_IO_stdin_used+0x12a>
+            switch (tag) { // result-consume
+    139e:	|  |  |   85 c0                	test   %eax,%eax
+    13a0:	|  +--|-- 75 68                	jne    140a <main+0x1d8>
+                    nel::panic("invalid Result", ctx);
+    13a2:	|  |  |   48 8d 3d 72 1d 00 00 	lea    0x1d72(%rip),%rdi        # 311b <_IO_stdin_used+0x11b>
+    13a9:	|  +--|-- eb 5f                	jmp    140a <main+0x1d8>
+
+        Pool(Pool const &) = delete;
+        Pool &operator=(Pool const &) = delete;
+
+        constexpr Pool(Pool &&o)
+            : shared_(o.shared_)
+    13ab:	|  |  \-> 48 8b 44 24 10       	mov    0x10(%rsp),%rax
+        nel::log << "two threads, the neighbour reading while snapshots run\n";
+    13b0:	|  |      48 89 ef             	mov    %rbp,%rdi
+    13b3:	|  |      48 8d 35 08 1e 00 00 	lea    0x1e08(%rip),%rsi        # 31c2 <_IO_stdin_used+0x1c2>
+        two_threads(pool, b, Snap::None, "no snapshot");
+    13ba:	|  |      48 89 e5             	mov    %rsp,%rbp
+    13bd:	|  |      48 89 04 24          	mov    %rax,(%rsp)
+        nel::log << "two threads, the neighbour reading while snapshots run\n";
+    13c1:	|  |      e8 83 09 00 00       	call   1d49 <nel::operator<<(nel::Log&, char const*)>
+        two_threads(pool, b, Snap::None, "no snapshot");
+    13c6:	|  |      31 d2                	xor    %edx,%edx
+    13c8:	|  |      48 89 de             	mov    %rbx,%rsi
+    13cb:	|  |      48 89 ef             	mov    %rbp,%rdi
+    13ce:	|  |      48 8d 0d 25 1e 00 00 	lea    0x1e25(%rip),%rcx        # 31fa <_IO_stdin_used+0x1fa>
+    13d5:	|  |      e8 4e 04 00 00       	call   1828 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)>
+        two_threads(pool, b, Snap::Copy, "copy_from");
+    13da:	|  |      4c 89 e9             	mov    %r13,%rcx
+    13dd:	|  |      48 89 de             	mov    %rbx,%rsi
+    13e0:	|  |      48 89 ef             	mov    %rbp,%rdi
+    13e3:	|  |      ba 01 00 00 00       	mov    $0x1,%edx
+    13e8:	|  |      e8 3b 04 00 00       	call   1828 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)>
+        two_threads(pool, b, Snap::Streaming, "copy_from_streaming");
+    13ed:	|  |      48 89 ef             	mov    %rbp,%rdi
+    13f0:	|  |      4c 89 e1             	mov    %r12,%rcx
+    13f3:	|  |      ba 02 00 00 00       	mov    $0x2,%edx
+    13f8:	|  |      48 89 de             	mov    %rbx,%rsi
+    13fb:	|  |      e8 28 04 00 00       	call   1828 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)>
+    }
+    1400:	|  |      48 89 ef             	mov    %rbp,%rdi
+    1403:	|  |      e8 c0 0b 00 00       	call   1fc8 <nel::par::Pool::~Pool()>
+    1408:	+--|----- eb 05                	jmp    140f <main+0x1dd>
+    140a:	|  \----> e8 c3 fd ff ff       	call   11d2 <nel::panic(char const*, nel::Context const&)>
+
+    nel::free_aligned(b.src.ptr());
+    140f:	\-------> 48 8b 7c 24 30       	mov    0x30(%rsp),%rdi
+    1414:	          e8 39 08 00 00       	call   1c52 <nel::free_aligned(void*)>
+    nel::free_aligned(b.dst.ptr());
+    1419:	          48 8b 7c 24 40       	mov    0x40(%rsp),%rdi
+    141e:	          e8 2f 08 00 00       	call   1c52 <nel::free_aligned(void*)>
+    nel::free_aligned(b.work.ptr());
+    1423:	          48 8b 7c 24 50       	mov    0x50(%rsp),%rdi
+    1428:	          e8 25 08 00 00       	call   1c52 <nel::free_aligned(void*)>
+}
+    142d:	          48 83 c4 60          	add    $0x60,%rsp
+    1431:	          31 c0                	xor    %eax,%eax
+    1433:	          5b                   	pop    %rbx
+    1434:	          5d                   	pop    %rbp
+    1435:	          41 5c                	pop    %r12
+    1437:	          41 5d                	pop    %r13
+    1439:	          41 5e                	pop    %r14
+    143b:	          c3                   	ret
+    143c:	          0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001440 <_start>:
+    1440:	31 ed                	xor    %ebp,%ebp
+    1442:	49 89 d1             	mov    %rdx,%r9
+    1445:	5e                   	pop    %rsi
+    1446:	48 89 e2             	mov    %rsp,%rdx
+    1449:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    144d:	50                   	push   %rax
+    144e:	54                   	push   %rsp
+    144f:	45 31 c0             	xor    %r8d,%r8d
+    1452:	31 c9                	xor    %ecx,%ecx
+    1454:	48 8d 3d d7 fd ff ff 	lea    -0x229(%rip),%rdi        # 1232 <main>
+    145b:	ff 15 5f 3b 00 00    	call   *0x3b5f(%rip)        # 4fc0 <__libc_start_main@GLIBC_2.34>
+    1461:	f4                   	hlt
+    1462:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1469:	00 00 00 
+    146c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001470 <deregister_tm_clones>:
+    1470:	    48 8d 3d 49 3c 00 00 	lea    0x3c49(%rip),%rdi        # 50c0 <stderr@GLIBC_2.2.5>
+    1477:	    48 8d 05 42 3c 00 00 	lea    0x3c42(%rip),%rax        # 50c0 <stderr@GLIBC_2.2.5>
+    147e:	    48 39 f8             	cmp    %rdi,%rax
+    1481:	/-- 74 15                	je     1498 <deregister_tm_clones+0x28>
+    1483:	|   48 8b 05 3e 3b 00 00 	mov    0x3b3e(%rip),%rax        # 4fc8 <_ITM_deregisterTMCloneTable@Base>
+    148a:	|   48 85 c0             	test   %rax,%rax
+    148d:	+-- 74 09                	je     1498 <deregister_tm_clones+0x28>
+    148f:	|   ff e0                	jmp    *%rax
+    1491:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1498:	\-> c3                   	ret
+    1499:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000014a0 <register_tm_clones>:
+    14a0:	    48 8d 3d 19 3c 00 00 	lea    0x3c19(%rip),%rdi        # 50c0 <stderr@GLIBC_2.2.5>
+    14a7:	    48 8d 35 12 3c 00 00 	lea    0x3c12(%rip),%rsi        # 50c0 <stderr@GLIBC_2.2.5>
+    14ae:	    48 29 fe             	sub    %rdi,%rsi
+    14b1:	    48 89 f0             	mov    %rsi,%rax
+    14b4:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    14b8:	    48 c1 f8 03          	sar    $0x3,%rax
+    14bc:	    48 01 c6             	add    %rax,%rsi
+    14bf:	    48 d1 fe             	sar    %rsi
+    14c2:	/-- 74 14                	je     14d8 <register_tm_clones+0x38>
+    14c4:	|   48 8b 05 0d 3b 00 00 	mov    0x3b0d(%rip),%rax        # 4fd8 <_ITM_registerTMCloneTable@Base>
+    14cb:	|   48 85 c0             	test   %rax,%rax
+    14ce:	+-- 74 08                	je     14d8 <register_tm_clones+0x38>
+    14d0:	|   ff e0                	jmp    *%rax
+    14d2:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    14d8:	\-> c3                   	ret
+    14d9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000014e0 <__do_global_dtors_aux>:
+    14e0:	       f3 0f 1e fa          	endbr64
+    14e4:	       80 3d dd 3b 00 00 00 	cmpb   $0x0,0x3bdd(%rip)        # 50c8 <completed.0>
+    14eb:	/----- 75 2b                	jne    1518 <__do_global_dtors_aux+0x38>
+    14ed:	|      55                   	push   %rbp
+    14ee:	|      48 83 3d ea 3a 00 00 	cmpq   $0x0,0x3aea(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    14f5:	|      00 
+    14f6:	|      48 89 e5             	mov    %rsp,%rbp
+    14f9:	|  /-- 74 0c                	je     1507 <__do_global_dtors_aux+0x27>
+    14fb:	|  |   48 8b 3d b6 3b 00 00 	mov    0x3bb6(%rip),%rdi        # 50b8 <__dso_handle>
+    1502:	|  |   e8 89 fc ff ff       	call   1190 <__cxa_finalize@plt>
+    1507:	|  \-> e8 64 ff ff ff       	call   1470 <deregister_tm_clones>
+    150c:	|      c6 05 b5 3b 00 00 01 	movb   $0x1,0x3bb5(%rip)        # 50c8 <completed.0>
+    1513:	|      5d                   	pop    %rbp
+    1514:	|      c3                   	ret
+    1515:	|      0f 1f 00             	nopl   (%rax)
+    1518:	\----> c3                   	ret
+    1519:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001520 <frame_dummy>:
+    1520:	f3 0f 1e fa          	endbr64
+    1524:	e9 77 ff ff ff       	jmp    14a0 <register_tm_clones>
+
+0000000000001529 <touch(nel::Slice<unsigned long> const&)>:
+         *
+         * @returns number of elements in the slice.
+         */
+        constexpr Length len(void) const
+        {
+            return len_;
+    1529:	       48 8b 4f 08          	mov    0x8(%rdi),%rcx
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    152d:	       31 c0                	xor    %eax,%eax
+    Word r = 0;
+    152f:	       31 d2                	xor    %edx,%edx
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    1531:	/----> 48 39 c8             	cmp    %rcx,%rax
+    1534:	|  /-- 73 0d                	jae    1543 <touch(nel::Slice<unsigned long> const&)+0x1a>
+        r += work.ptr()[i];
+    1536:	|  |   48 8b 37             	mov    (%rdi),%rsi
+    1539:	|  |   48 03 14 c6          	add    (%rsi,%rax,8),%rdx
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    153d:	|  |   48 83 c0 08          	add    $0x8,%rax
+    1541:	\--|-- eb ee                	jmp    1531 <touch(nel::Slice<unsigned long> const&)+0x8>
+}
+    1543:	   \-> 48 89 d0             	mov    %rdx,%rax
+    1546:	       c3                   	ret
+
+0000000000001547 <alloc(unsigned long)>:
+{
+    1547:	       55                   	push   %rbp
+    1548:	       48 89 f5             	mov    %rsi,%rbp
+    154b:	       53                   	push   %rbx
+    154c:	       48 89 fb             	mov    %rdi,%rbx
+    void *const p = nel::malloc_aligned(64, n_bytes);
+    154f:	       bf 40 00 00 00       	mov    $0x40,%edi
+{
+    1554:	       48 83 ec 28          	sub    $0x28,%rsp
+    void *const p = nel::malloc_aligned(64, n_bytes);
+    1558:	       e8 c4 07 00 00       	call   1d21 <nel::malloc_aligned(unsigned long, unsigned long)>
+            : fn_name_(fn_name)
+    155d:	       48 8d 0d a0 1a 00 00 	lea    0x1aa0(%rip),%rcx        # 3004 <_IO_stdin_used+0x4>
+            , line_num_(line_num)
+    1564:	       c7 44 24 18 1f 00 00 	movl   $0x1f,0x18(%rsp)
+    156b:	       00 
+            : fn_name_(fn_name)
+    156c:	       48 89 4c 24 08       	mov    %rcx,0x8(%rsp)
+            , file_name_(file_name)
+    1571:	       48 8d 0d 92 1a 00 00 	lea    0x1a92(%rip),%rcx        # 300a <_IO_stdin_used+0xa>
+    1578:	       48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+    if (pred) { panic(msg, ctx); }
+}
+
+inline void panic_if_not(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { panic(msg, ctx); }
+    157d:	       48 85 c0             	test   %rax,%rax
+    1580:	   /-- 75 11                	jne    1593 <alloc(unsigned long)+0x4c>
+    1582:	   |   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    1587:	   |   48 8d 3d 95 1a 00 00 	lea    0x1a95(%rip),%rdi        # 3023 <_IO_stdin_used+0x23>
+    158e:	   |   e8 3f fc ff ff       	call   11d2 <nel::panic(char const*, nel::Context const&)>
+    auto s = nel::Slice<Word>(static_cast<Word *>(p), n_bytes / sizeof(Word));
+    1593:	   \-> 48 c1 ed 03          	shr    $0x3,%rbp
+            : content_(p)
+    1597:	       48 89 03             	mov    %rax,(%rbx)
+    for (nel::Index i = 0; i < s.len(); ++i) {
+    159a:	       31 d2                	xor    %edx,%edx
+    auto s = nel::Slice<Word>(static_cast<Word *>(p), n_bytes / sizeof(Word));
+    159c:	       48 89 6b 08          	mov    %rbp,0x8(%rbx)
+    for (nel::Index i = 0; i < s.len(); ++i) {
+    15a0:	/----> 48 3b 53 08          	cmp    0x8(%rbx),%rdx
+    15a4:	|  /-- 73 09                	jae    15af <alloc(unsigned long)+0x68>
+        s.ptr()[i] = i;
+    15a6:	|  |   48 89 14 d0          	mov    %rdx,(%rax,%rdx,8)
+    for (nel::Index i = 0; i < s.len(); ++i) {
+    15aa:	|  |   48 ff c2             	inc    %rdx
+    15ad:	\--|-- eb f1                	jmp    15a0 <alloc(unsigned long)+0x59>
+}
+    15af:	   \-> 48 83 c4 28          	add    $0x28,%rsp
+    15b3:	       48 89 d8             	mov    %rbx,%rax
+    15b6:	       5b                   	pop    %rbx
+    15b7:	       5d                   	pop    %rbp
+    15b8:	       c3                   	ret
+
+00000000000015b9 <snapshot(Buffers&, bool)>:
+{
+    15b9:	             48 83 ec 28          	sub    $0x28,%rsp
+    if (streaming) {
+    15bd:	             40 84 f6             	test   %sil,%sil
+            return len_;
+    15c0:	             48 8b 57 18          	mov    0x18(%rdi),%rdx
+    15c4:	             48 8b 47 08          	mov    0x8(%rdi),%rax
+    15c8:	             48 8d 0d 76 1a 00 00 	lea    0x1a76(%rip),%rcx        # 3045 <_IO_stdin_used+0x45>
+    15cf:	   /-------- 74 45                	je     1616 <snapshot(Buffers&, bool)+0x5d>
+            : fn_name_(fn_name)
+    15d1:	   |         48 8d 35 59 1a 00 00 	lea    0x1a59(%rip),%rsi        # 3031 <_IO_stdin_used+0x31>
+            , file_name_(file_name)
+    15d8:	   |         48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+            : fn_name_(fn_name)
+    15dd:	   |         48 89 74 24 08       	mov    %rsi,0x8(%rsp)
+            , line_num_(line_num)
+    15e2:	   |         c7 44 24 18 5a 01 00 	movl   $0x15a,0x18(%rsp)
+    15e9:	   |         00 
+    if (!pred) { panic(msg, ctx); }
+    15ea:	   |         48 39 c2             	cmp    %rax,%rdx
+    15ed:	   |     /-- 74 0e                	je     15fd <snapshot(Buffers&, bool)+0x44>
+    15ef:	   |     |   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    15f4:	   |     |   48 8d 3d 5b 1a 00 00 	lea    0x1a5b(%rip),%rdi        # 3056 <_IO_stdin_used+0x56>
+    15fb:	   |  /--|-- eb 43                	jmp    1640 <snapshot(Buffers&, bool)+0x87>
+            return content_;
+    15fd:	   |  |  \-> 48 8b 37             	mov    (%rdi),%rsi
+    1600:	   |  |      48 8b 7f 10          	mov    0x10(%rdi),%rdi
+ * @see copy(), copy_streaming()
+ */
+template<typename T>
+void copy_streaming(T d[], T const s[], Length const n)
+{
+    if (d == s) { return; }
+    1604:	   |  |      48 39 fe             	cmp    %rdi,%rsi
+    1607:	/--|--|----- 74 55                	je     165e <snapshot(Buffers&, bool)+0xa5>
+    if constexpr (is_trivially_copyable<T>) {
+        copy_streaming(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t const *>(s),
+    1609:	|  |  |      48 c1 e2 03          	shl    $0x3,%rdx
+}
+    160d:	|  |  |      48 83 c4 28          	add    $0x28,%rsp
+    1611:	|  |  |      e9 d0 04 00 00       	jmp    1ae6 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>
+            : fn_name_(fn_name)
+    1616:	|  \--|----> 48 8d 35 6b 1a 00 00 	lea    0x1a6b(%rip),%rsi        # 3088 <_IO_stdin_used+0x88>
+            , file_name_(file_name)
+    161d:	|     |      48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+            : fn_name_(fn_name)
+    1622:	|     |      48 89 74 24 08       	mov    %rsi,0x8(%rsp)
+            , line_num_(line_num)
+    1627:	|     |      c7 44 24 18 44 01 00 	movl   $0x144,0x18(%rsp)
+    162e:	|     |      00 
+    if (!pred) { panic(msg, ctx); }
+    162f:	|     |      48 39 c2             	cmp    %rax,%rdx
+    1632:	|     |  /-- 74 11                	je     1645 <snapshot(Buffers&, bool)+0x8c>
+    1634:	|     |  |   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    1639:	|     |  |   48 8d 3d 52 1a 00 00 	lea    0x1a52(%rip),%rdi        # 3092 <_IO_stdin_used+0x92>
+    1640:	|     \--|-> e8 8d fb ff ff       	call   11d2 <nel::panic(char const*, nel::Context const&)>
+    1645:	|        \-> 48 8b 37             	mov    (%rdi),%rsi
+    1648:	|            48 8b 7f 10          	mov    0x10(%rdi),%rdi
+    if (d == s) { return; }
+    164c:	|            48 39 fe             	cmp    %rdi,%rsi
+    164f:	+----------- 74 0d                	je     165e <snapshot(Buffers&, bool)+0xa5>
+        copy(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t const *>(s), n * sizeof(T));
+    1651:	|            48 c1 e2 03          	shl    $0x3,%rdx
+    1655:	|            48 83 c4 28          	add    $0x28,%rsp
+    1659:	|            e9 4d 04 00 00       	jmp    1aab <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    165e:	\----------> 48 83 c4 28          	add    $0x28,%rsp
+    1662:	             c3                   	ret
+
+0000000000001663 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)>:
+            return run(n_chunks, &thunk<F>, &f);
+        }
+
+    private:
+        template<typename F>
+        static bool thunk(void *const ctx, Index const chunk)
+    1663:	             41 54                	push   %r12
+    1665:	             55                   	push   %rbp
+    1666:	             53                   	push   %rbx
+        __atomic_fetch_add(&started, 1, __ATOMIC_RELAXED);
+    1667:	             48 8b 07             	mov    (%rdi),%rax
+    166a:	             48 89 fb             	mov    %rdi,%rbx
+    166d:	             f0 ff 00             	lock incl (%rax)
+        while (__atomic_load_n(&started, __ATOMIC_RELAXED) < 2) {
+    1670:	         /-> 48 8b 03             	mov    (%rbx),%rax
+    1673:	         |   8b 00                	mov    (%rax),%eax
+    1675:	         |   ff c8                	dec    %eax
+    1677:	         \-- 7e f7                	jle    1670 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0xd>
+        if (chunk == 0) {
+    1679:	             48 85 f6             	test   %rsi,%rsi
+    167c:	/----------- 75 51                	jne    16cf <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x6c>
+            long unsigned int const b_ns = bench::now_ns();
+    167e:	|            e8 63 03 00 00       	call   19e6 <bench::now_ns()>
+    1683:	|            41 bc 05 00 00 00    	mov    $0x5,%r12d
+    1689:	|            48 89 c5             	mov    %rax,%rbp
+                if (mode != Snap::None) { snapshot(b, mode == Snap::Streaming); }
+    168c:	|     /----> 48 8b 43 08          	mov    0x8(%rbx),%rax
+    1690:	|     |      8b 00                	mov    (%rax),%eax
+    1692:	|     |      85 c0                	test   %eax,%eax
+    1694:	|     |  /-- 74 12                	je     16a8 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x45>
+    1696:	|     |  |   31 f6                	xor    %esi,%esi
+    1698:	|     |  |   48 8b 7b 10          	mov    0x10(%rbx),%rdi
+    169c:	|     |  |   83 f8 02             	cmp    $0x2,%eax
+    169f:	|     |  |   40 0f 94 c6          	sete   %sil
+    16a3:	|     |  |   e8 11 ff ff ff       	call   15b9 <snapshot(Buffers&, bool)>
+            for (nel::Index k = 0; k < n_snaps; ++k) {
+    16a8:	|     |  \-> 49 ff cc             	dec    %r12
+    16ab:	|     \----- 75 df                	jne    168c <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x29>
+            if (mode == Snap::None) {
+    16ad:	|            48 8b 43 08          	mov    0x8(%rbx),%rax
+    16b1:	|            83 38 00             	cmpl   $0x0,(%rax)
+    16b4:	|     /----- 75 10                	jne    16c6 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x63>
+                while (bench::now_ns() - b_ns < n_snaps * n_state / 20) {
+    16b6:	|     |  /-> e8 2b 03 00 00       	call   19e6 <bench::now_ns()>
+    16bb:	|     |  |   48 29 e8             	sub    %rbp,%rax
+    16be:	|     |  |   48 3d ff ff 1f 03    	cmp    $0x31fffff,%rax
+    16c4:	|     |  \-- 76 f0                	jbe    16b6 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x53>
+            __atomic_store_n(&done, true, __ATOMIC_RELEASE);
+    16c6:	|     \----> 48 8b 43 18          	mov    0x18(%rbx),%rax
+    16ca:	|            c6 00 01             	movb   $0x1,(%rax)
+    16cd:	|  /-------- eb 3e                	jmp    170d <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0xaa>
+            long unsigned int const b_ns = bench::now_ns();
+    16cf:	\--|-------> e8 12 03 00 00       	call   19e6 <bench::now_ns()>
+    16d4:	   |         48 89 c5             	mov    %rax,%rbp
+            while (!__atomic_load_n(&done, __ATOMIC_ACQUIRE)) {
+    16d7:	   |  /----> 48 8b 43 18          	mov    0x18(%rbx),%rax
+    16db:	   |  |      8a 00                	mov    (%rax),%al
+    16dd:	   |  |      84 c0                	test   %al,%al
+    16df:	   |  |  /-- 75 1d                	jne    16fe <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x9b>
+                r += touch(b.work);
+    16e1:	   |  |  |   48 8b 43 10          	mov    0x10(%rbx),%rax
+    16e5:	   |  |  |   48 8d 78 20          	lea    0x20(%rax),%rdi
+    16e9:	   |  |  |   e8 3b fe ff ff       	call   1529 <touch(nel::Slice<unsigned long> const&)>
+    16ee:	   |  |  |   48 8b 53 20          	mov    0x20(%rbx),%rdx
+    16f2:	   |  |  |   48 01 02             	add    %rax,(%rdx)
+                passes += 1;
+    16f5:	   |  |  |   48 8b 43 28          	mov    0x28(%rbx),%rax
+    16f9:	   |  |  |   48 ff 00             	incq   (%rax)
+    16fc:	   |  \--|-- eb d9                	jmp    16d7 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x74>
+            t_neighbour = bench::now_ns() - b_ns;
+    16fe:	   |     \-> e8 e3 02 00 00       	call   19e6 <bench::now_ns()>
+    1703:	   |         48 8b 53 30          	mov    0x30(%rbx),%rdx
+    1707:	   |         48 29 e8             	sub    %rbp,%rax
+    170a:	   |         48 89 02             	mov    %rax,(%rdx)
+                return f(chunk);
+            } else {
+                f(chunk);
+                return true;
+            }
+        }
+    170d:	   \-------> 5b                   	pop    %rbx
+    170e:	             b0 01                	mov    $0x1,%al
+    1710:	             5d                   	pop    %rbp
+    1711:	             41 5c                	pop    %r12
+    1713:	             c3                   	ret
+
+0000000000001714 <one_thread(Buffers&, bool, char const*)>:
+{
+    1714:	    41 57                	push   %r15
+        t_copy += bench::time_ns([&b, streaming]() { snapshot(b, streaming); });
+    1716:	    40 0f b6 c6          	movzbl %sil,%eax
+{
+    171a:	    41 bf 05 00 00 00    	mov    $0x5,%r15d
+    1720:	    41 56                	push   %r14
+    long unsigned int t_copy = 0;
+    1722:	    45 31 f6             	xor    %r14d,%r14d
+{
+    1725:	    41 55                	push   %r13
+    long unsigned int t_reread = 0;
+    1727:	    45 31 ed             	xor    %r13d,%r13d
+{
+    172a:	    41 54                	push   %r12
+    Word r = 0;
+    172c:	    45 31 e4             	xor    %r12d,%r12d
+{
+    172f:	    55                   	push   %rbp
+    1730:	    48 89 fd             	mov    %rdi,%rbp
+    1733:	    53                   	push   %rbx
+    1734:	    48 83 ec 38          	sub    $0x38,%rsp
+    1738:	    48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+        t_copy += bench::time_ns([&b, streaming]() { snapshot(b, streaming); });
+    173d:	    89 44 24 24          	mov    %eax,0x24(%rsp)
+        r += touch(b.work);
+    1741:	/-> 48 8d 45 20          	lea    0x20(%rbp),%rax
+    1745:	|   48 89 c7             	mov    %rax,%rdi
+    1748:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    174d:	|   e8 d7 fd ff ff       	call   1529 <touch(nel::Slice<unsigned long> const&)>
+    1752:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    long unsigned int const b = now_ns();
+    1757:	|   e8 8a 02 00 00       	call   19e6 <bench::now_ns()>
+        t_copy += bench::time_ns([&b, streaming]() { snapshot(b, streaming); });
+    175c:	|   8b 74 24 24          	mov    0x24(%rsp),%esi
+    1760:	|   48 89 ef             	mov    %rbp,%rdi
+    1763:	|   48 89 c3             	mov    %rax,%rbx
+    1766:	|   e8 4e fe ff ff       	call   15b9 <snapshot(Buffers&, bool)>
+    return now_ns() - b;
+    176b:	|   e8 76 02 00 00       	call   19e6 <bench::now_ns()>
+    1770:	|   48 29 d8             	sub    %rbx,%rax
+    1773:	|   49 01 c6             	add    %rax,%r14
+    long unsigned int const b = now_ns();
+    1776:	|   e8 6b 02 00 00       	call   19e6 <bench::now_ns()>
+        t_reread += bench::time_ns([&b, &r]() { r += touch(b.work); });
+    177b:	|   48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    1780:	|   48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    1785:	|   e8 9f fd ff ff       	call   1529 <touch(nel::Slice<unsigned long> const&)>
+    178a:	|   48 8b 5c 24 10       	mov    0x10(%rsp),%rbx
+    178f:	|   48 01 c3             	add    %rax,%rbx
+    return now_ns() - b;
+    1792:	|   e8 4f 02 00 00       	call   19e6 <bench::now_ns()>
+    1797:	|   48 8b 4c 24 28       	mov    0x28(%rsp),%rcx
+    179c:	|   49 01 dc             	add    %rbx,%r12
+    179f:	|   48 29 c8             	sub    %rcx,%rax
+    17a2:	|   49 01 c5             	add    %rax,%r13
+    for (nel::Index k = 0; k < n_snaps; ++k) {
+    17a5:	|   49 ff cf             	dec    %r15
+    17a8:	\-- 75 97                	jne    1741 <one_thread(Buffers&, bool, char const*)+0x2d>
+    nel::log << name << '\n';
+    17aa:	    48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    17af:	    48 8d 1d 13 39 00 00 	lea    0x3913(%rip),%rbx        # 50c9 <nel::log>
+    17b6:	    48 89 df             	mov    %rbx,%rdi
+    17b9:	    e8 8b 05 00 00       	call   1d49 <nel::operator<<(nel::Log&, char const*)>
+    17be:	    be 0a 00 00 00       	mov    $0xa,%esi
+    17c3:	    48 89 c7             	mov    %rax,%rdi
+    17c6:	    e8 65 05 00 00       	call   1d30 <nel::operator<<(nel::Log&, char)>
+    bench::report("  snapshot        ", t_copy, n_snaps * n_state);
+    17cb:	    4c 89 f6             	mov    %r14,%rsi
+    17ce:	    ba 00 00 80 3e       	mov    $0x3e800000,%edx
+    17d3:	    48 8d 3d e0 18 00 00 	lea    0x18e0(%rip),%rdi        # 30ba <_IO_stdin_used+0xba>
+    17da:	    e8 2a 02 00 00       	call   1a09 <bench::report(char const*, unsigned long, unsigned long)>
+    bench::report("  re-read 4MB     ", t_reread, n_snaps * n_work);
+    17df:	    ba 00 00 40 01       	mov    $0x1400000,%edx
+    17e4:	    4c 89 ee             	mov    %r13,%rsi
+    17e7:	    48 8d 3d df 18 00 00 	lea    0x18df(%rip),%rdi        # 30cd <_IO_stdin_used+0xcd>
+    17ee:	    e8 16 02 00 00       	call   1a09 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << r << '\n';
+    17f3:	    48 89 df             	mov    %rbx,%rdi
+    17f6:	    48 8d 35 e3 18 00 00 	lea    0x18e3(%rip),%rsi        # 30e0 <_IO_stdin_used+0xe0>
+    17fd:	    e8 47 05 00 00       	call   1d49 <nel::operator<<(nel::Log&, char const*)>
+    1802:	    4c 89 e6             	mov    %r12,%rsi
+    1805:	    48 89 c7             	mov    %rax,%rdi
+    1808:	    e8 d7 05 00 00       	call   1de4 <nel::operator<<(nel::Log&, unsigned long)>
+}
+    180d:	    48 83 c4 38          	add    $0x38,%rsp
+    nel::log << "  sum: " << r << '\n';
+    1811:	    be 0a 00 00 00       	mov    $0xa,%esi
+}
+    1816:	    5b                   	pop    %rbx
+    nel::log << "  sum: " << r << '\n';
+    1817:	    48 89 c7             	mov    %rax,%rdi
+}
+    181a:	    5d                   	pop    %rbp
+    181b:	    41 5c                	pop    %r12
+    181d:	    41 5d                	pop    %r13
+    181f:	    41 5e                	pop    %r14
+    1821:	    41 5f                	pop    %r15
+    nel::log << "  sum: " << r << '\n';
+    1823:	    e9 08 05 00 00       	jmp    1d30 <nel::operator<<(nel::Log&, char)>
+
+0000000000001828 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)>:
+{
+    1828:	          53                   	push   %rbx
+    1829:	          48 89 f8             	mov    %rdi,%rax
+    182c:	          48 89 cb             	mov    %rcx,%rbx
+    long unsigned int t_neighbour = 0;
+    182f:	          31 c9                	xor    %ecx,%ecx
+{
+    1831:	          48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+    1838:	          89 54 24 0c          	mov    %edx,0xc(%rsp)
+    int started = 0;
+    183c:	          31 d2                	xor    %edx,%edx
+            return run(n_chunks, &thunk<F>, &f);
+    183e:	          48 8d 7c 24 30       	lea    0x30(%rsp),%rdi
+    1843:	          4c 8d 44 24 68       	lea    0x68(%rsp),%r8
+    1848:	          89 54 24 14          	mov    %edx,0x14(%rsp)
+    };
+    184c:	          48 8d 54 24 14       	lea    0x14(%rsp),%rdx
+    1851:	          48 89 54 24 68       	mov    %rdx,0x68(%rsp)
+    1856:	          48 8d 54 24 0c       	lea    0xc(%rsp),%rdx
+    185b:	          48 89 54 24 70       	mov    %rdx,0x70(%rsp)
+    1860:	          48 8d 54 24 13       	lea    0x13(%rsp),%rdx
+    1865:	          48 89 94 24 80 00 00 	mov    %rdx,0x80(%rsp)
+    186c:	          00 
+    186d:	          48 8d 54 24 28       	lea    0x28(%rsp),%rdx
+    1872:	          48 89 94 24 88 00 00 	mov    %rdx,0x88(%rsp)
+    1879:	          00 
+    187a:	          48 8d 54 24 18       	lea    0x18(%rsp),%rdx
+    187f:	          48 89 94 24 90 00 00 	mov    %rdx,0x90(%rsp)
+    1886:	          00 
+    1887:	          48 8d 54 24 20       	lea    0x20(%rsp),%rdx
+    long unsigned int t_neighbour = 0;
+    188c:	          48 89 4c 24 18       	mov    %rcx,0x18(%rsp)
+    Word r = 0;
+    1891:	          48 89 4c 24 20       	mov    %rcx,0x20(%rsp)
+    1896:	          48 89 4c 24 28       	mov    %rcx,0x28(%rsp)
+    189b:	          48 8d 0d c1 fd ff ff 	lea    -0x23f(%rip),%rcx        # 1663 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)>
+    };
+    18a2:	          48 89 74 24 78       	mov    %rsi,0x78(%rsp)
+    18a7:	          48 89 c6             	mov    %rax,%rsi
+    18aa:	          48 89 94 24 98 00 00 	mov    %rdx,0x98(%rsp)
+    18b1:	          00 
+    18b2:	          ba 02 00 00 00       	mov    $0x2,%edx
+    bool done = false;
+    18b7:	          c6 44 24 13 00       	movb   $0x0,0x13(%rsp)
+    18bc:	          e8 3b 08 00 00       	call   20fc <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)>
+            : fn_name_(fn_name)
+    18c1:	          48 8d 05 20 18 00 00 	lea    0x1820(%rip),%rax        # 30e8 <_IO_stdin_used+0xe8>
+
+        template<typename Fn1, typename Fn2>
+        constexpr void consumev(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+        {
+            auto tag = tag_;
+            tag_ = Tag::INVAL;
+    18c8:	          31 f6                	xor    %esi,%esi
+            , line_num_(line_num)
+    18ca:	          c7 44 24 48 7d 00 00 	movl   $0x7d,0x48(%rsp)
+    18d1:	          00 
+            : fn_name_(fn_name)
+    18d2:	          48 89 44 24 38       	mov    %rax,0x38(%rsp)
+            , file_name_(file_name)
+    18d7:	          48 8d 05 2c 17 00 00 	lea    0x172c(%rip),%rax        # 300a <_IO_stdin_used+0xa>
+    18de:	          48 89 44 24 40       	mov    %rax,0x40(%rsp)
+            auto tag = tag_;
+    18e3:	          8b 44 24 30          	mov    0x30(%rsp),%eax
+            tag_ = Tag::INVAL;
+    18e7:	          89 74 24 30          	mov    %esi,0x30(%rsp)
+            switch (tag) { // result<void>-consume
+    18eb:	          83 f8 01             	cmp    $0x1,%eax
+    18ee:	/-------- 74 4f                	je     193f <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)+0x117>
+    18f0:	|         83 f8 02             	cmp    $0x2,%eax
+    18f3:	|     /-- 74 19                	je     190e <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)+0xe6>
+    18f5:	|     |   85 c0                	test   %eax,%eax
+                    // if they do it's a use-after-move-from op so must panic.
+                    // or a use-before-initialised so again must panic.
+                    nel::panic("invalid Result", ctx);
+                    break;
+                default:
+                    nel::panic("bad Result", ctx);
+    18f7:	|     |   48 8d 3d 2c 18 00 00 	lea    0x182c(%rip),%rdi        # 312a <_IO_stdin_used+0x12a>
+    18fe:	|     |   48 8d 74 24 38       	lea    0x38(%rsp),%rsi
+            switch (tag) { // result<void>-consume
+    1903:	|  /--|-- 75 35                	jne    193a <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)+0x112>
+                    nel::panic("invalid Result", ctx);
+    1905:	|  |  |   48 8d 3d 0f 18 00 00 	lea    0x180f(%rip),%rdi        # 311b <_IO_stdin_used+0x11b>
+    190c:	|  +--|-- eb 2c                	jmp    193a <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)+0x112>
+            : fn_name_(fn_name)
+    190e:	|  |  \-> 48 8d 05 df 17 00 00 	lea    0x17df(%rip),%rax        # 30f4 <_IO_stdin_used+0xf4>
+            , line_num_(line_num)
+    1915:	|  |      c7 44 24 60 1f 04 00 	movl   $0x41f,0x60(%rsp)
+    191c:	|  |      00 
+         *
+         * `this` is consumed by the operation.
+         */
+        constexpr void unwrap(Context const &ctx = Context())
+        {
+            return consumev([](void) {}, [](E &&) { nel::panic("not an ok"); }, ctx);
+    191d:	|  |      48 8d 74 24 50       	lea    0x50(%rsp),%rsi
+            : fn_name_(fn_name)
+    1922:	|  |      48 89 44 24 50       	mov    %rax,0x50(%rsp)
+            , file_name_(file_name)
+    1927:	|  |      48 8d 05 d1 17 00 00 	lea    0x17d1(%rip),%rax        # 30ff <_IO_stdin_used+0xff>
+    192e:	|  |      48 8d 3d dc 17 00 00 	lea    0x17dc(%rip),%rdi        # 3111 <_IO_stdin_used+0x111>
+    1935:	|  |      48 89 44 24 58       	mov    %rax,0x58(%rsp)
+                    nel::panic("invalid Result", ctx);
+    193a:	|  \----> e8 93 f8 ff ff       	call   11d2 <nel::panic(char const*, nel::Context const&)>
+    nel::log << name << '\n';
+    193f:	\-------> 48 89 de             	mov    %rbx,%rsi
+    1942:	          48 8d 1d 80 37 00 00 	lea    0x3780(%rip),%rbx        # 50c9 <nel::log>
+    1949:	          48 89 df             	mov    %rbx,%rdi
+    194c:	          e8 f8 03 00 00       	call   1d49 <nel::operator<<(nel::Log&, char const*)>
+    1951:	          be 0a 00 00 00       	mov    $0xa,%esi
+    1956:	          48 89 c7             	mov    %rax,%rdi
+    1959:	          e8 d2 03 00 00       	call   1d30 <nel::operator<<(nel::Log&, char)>
+    bench::report("  neighbour 4MB   ", t_neighbour, passes * n_work);
+    195e:	          48 8b 54 24 18       	mov    0x18(%rsp),%rdx
+    1963:	          48 8b 74 24 20       	mov    0x20(%rsp),%rsi
+    1968:	          48 8d 3d c6 17 00 00 	lea    0x17c6(%rip),%rdi        # 3135 <_IO_stdin_used+0x135>
+    196f:	          48 c1 e2 16          	shl    $0x16,%rdx
+    1973:	          e8 91 00 00 00       	call   1a09 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  passes: " << passes << " sum: " << r << '\n';
+    1978:	          48 89 df             	mov    %rbx,%rdi
+    197b:	          48 8d 35 c6 17 00 00 	lea    0x17c6(%rip),%rsi        # 3148 <_IO_stdin_used+0x148>
+    1982:	          e8 c2 03 00 00       	call   1d49 <nel::operator<<(nel::Log&, char const*)>
+    1987:	          48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    198c:	          48 89 c7             	mov    %rax,%rdi
+    198f:	          e8 50 04 00 00       	call   1de4 <nel::operator<<(nel::Log&, unsigned long)>
+    1994:	          48 8d 35 46 17 00 00 	lea    0x1746(%rip),%rsi        # 30e1 <_IO_stdin_used+0xe1>
+    199b:	          48 89 c7             	mov    %rax,%rdi
+    199e:	          e8 a6 03 00 00       	call   1d49 <nel::operator<<(nel::Log&, char const*)>
+    19a3:	          48 8b 74 24 28       	mov    0x28(%rsp),%rsi
+    19a8:	          48 89 c7             	mov    %rax,%rdi
+    19ab:	          e8 34 04 00 00       	call   1de4 <nel::operator<<(nel::Log&, unsigned long)>
+    19b0:	          be 0a 00 00 00       	mov    $0xa,%esi
+    19b5:	          48 89 c7             	mov    %rax,%rdi
+    19b8:	          e8 73 03 00 00       	call   1d30 <nel::operator<<(nel::Log&, char)>
+}
+    19bd:	          48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+    19c4:	          5b                   	pop    %rbx
+    19c5:	          c3                   	ret
+
+00000000000019c6 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    19c6:	83 c8 ff             	or     $0xffffffff,%eax
+    19c9:	c3                   	ret
+
+00000000000019ca <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    19ca:	83 c8 ff             	or     $0xffffffff,%eax
+    19cd:	c3                   	ret
+
+00000000000019ce <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    19ce:	83 c8 ff             	or     $0xffffffff,%eax
+    19d1:	c3                   	ret
+
+00000000000019d2 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    19d2:	83 c8 ff             	or     $0xffffffff,%eax
+    19d5:	c3                   	ret
+
+00000000000019d6 <_read_r>:
+int _read_r(struct _reent *, int) {
+    19d6:	83 c8 ff             	or     $0xffffffff,%eax
+    19d9:	c3                   	ret
+
+00000000000019da <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    19da:	83 c8 ff             	or     $0xffffffff,%eax
+    19dd:	c3                   	ret
+
+00000000000019de <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    19de:	83 c8 ff             	or     $0xffffffff,%eax
+    19e1:	c3                   	ret
+
+00000000000019e2 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    19e2:	83 c8 ff             	or     $0xffffffff,%eax
+    19e5:	c3                   	ret
+
+00000000000019e6 <bench::now_ns()>:
+{
+    19e6:	48 83 ec 18          	sub    $0x18,%rsp
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    19ea:	bf 01 00 00 00       	mov    $0x1,%edi
+    19ef:	48 89 e6             	mov    %rsp,%rsi
+    19f2:	e8 69 f6 ff ff       	call   1060 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    19f7:	48 69 04 24 00 ca 9a 	imul   $0x3b9aca00,(%rsp),%rax
+    19fe:	3b 
+    19ff:	48 03 44 24 08       	add    0x8(%rsp),%rax
+}
+    1a04:	48 83 c4 18          	add    $0x18,%rsp
+    1a08:	c3                   	ret
+
+0000000000001a09 <bench::report(char const*, unsigned long, unsigned long)>:
+}
+
+// Log a result line: name, time and (if bytes given) bandwidth.
+inline void report(char const *const name, long unsigned int const ns,
+                   long unsigned int const bytes = 0)
+{
+    1a09:	    41 54                	push   %r12
+    nel::log << name << ": " << ns / 1000UL << "us";
+    1a0b:	    4c 8d 25 b7 36 00 00 	lea    0x36b7(%rip),%r12        # 50c9 <nel::log>
+{
+    1a12:	    55                   	push   %rbp
+    1a13:	    48 89 f5             	mov    %rsi,%rbp
+    nel::log << name << ": " << ns / 1000UL << "us";
+    1a16:	    48 89 fe             	mov    %rdi,%rsi
+    1a19:	    4c 89 e7             	mov    %r12,%rdi
+{
+    1a1c:	    53                   	push   %rbx
+    1a1d:	    48 89 d3             	mov    %rdx,%rbx
+    nel::log << name << ": " << ns / 1000UL << "us";
+    1a20:	    e8 24 03 00 00       	call   1d49 <nel::operator<<(nel::Log&, char const*)>
+    1a25:	    48 8d 35 b9 16 00 00 	lea    0x16b9(%rip),%rsi        # 30e5 <_IO_stdin_used+0xe5>
+    1a2c:	    48 89 c7             	mov    %rax,%rdi
+    1a2f:	    e8 15 03 00 00       	call   1d49 <nel::operator<<(nel::Log&, char const*)>
+    1a34:	    b9 e8 03 00 00       	mov    $0x3e8,%ecx
+    1a39:	    31 d2                	xor    %edx,%edx
+    1a3b:	    48 89 c7             	mov    %rax,%rdi
+    1a3e:	    48 89 e8             	mov    %rbp,%rax
+    1a41:	    48 f7 f1             	div    %rcx
+    1a44:	    48 89 c6             	mov    %rax,%rsi
+    1a47:	    e8 98 03 00 00       	call   1de4 <nel::operator<<(nel::Log&, unsigned long)>
+    1a4c:	    48 8d 35 bd 17 00 00 	lea    0x17bd(%rip),%rsi        # 3210 <_IO_stdin_used+0x210>
+    1a53:	    48 89 c7             	mov    %rax,%rdi
+    1a56:	    e8 ee 02 00 00       	call   1d49 <nel::operator<<(nel::Log&, char const*)>
+    if (bytes != 0 && ns != 0) {
+    1a5b:	    48 85 db             	test   %rbx,%rbx
+    1a5e:	/-- 74 3a                	je     1a9a <bench::report(char const*, unsigned long, unsigned long)+0x91>
+    1a60:	|   48 85 ed             	test   %rbp,%rbp
+    1a63:	+-- 74 35                	je     1a9a <bench::report(char const*, unsigned long, unsigned long)+0x91>
+        // bytes/ns == GB/s, scaled to MB/s
+        nel::log << ", " << (bytes * 1000UL) / ns << "MB/s";
+    1a65:	|   48 8d 35 a7 17 00 00 	lea    0x17a7(%rip),%rsi        # 3213 <_IO_stdin_used+0x213>
+    1a6c:	|   4c 89 e7             	mov    %r12,%rdi
+    1a6f:	|   e8 d5 02 00 00       	call   1d49 <nel::operator<<(nel::Log&, char const*)>
+    1a74:	|   31 d2                	xor    %edx,%edx
+    1a76:	|   48 89 c7             	mov    %rax,%rdi
+    1a79:	|   48 69 c3 e8 03 00 00 	imul   $0x3e8,%rbx,%rax
+    1a80:	|   48 f7 f5             	div    %rbp
+    1a83:	|   48 89 c6             	mov    %rax,%rsi
+    1a86:	|   e8 59 03 00 00       	call   1de4 <nel::operator<<(nel::Log&, unsigned long)>
+    1a8b:	|   48 8d 35 84 17 00 00 	lea    0x1784(%rip),%rsi        # 3216 <_IO_stdin_used+0x216>
+    1a92:	|   48 89 c7             	mov    %rax,%rdi
+    1a95:	|   e8 af 02 00 00       	call   1d49 <nel::operator<<(nel::Log&, char const*)>
+    }
+    nel::log << '\n';
+}
+    1a9a:	\-> 5b                   	pop    %rbx
+    nel::log << '\n';
+    1a9b:	    4c 89 e7             	mov    %r12,%rdi
+}
+    1a9e:	    5d                   	pop    %rbp
+    nel::log << '\n';
+    1a9f:	    be 0a 00 00 00       	mov    $0xa,%esi
+}
+    1aa4:	    41 5c                	pop    %r12
+    nel::log << '\n';
+    1aa6:	    e9 85 02 00 00       	jmp    1d30 <nel::operator<<(nel::Log&, char)>
+
+0000000000001aab <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1aab:	48 89 d1             	mov    %rdx,%rcx
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    1aae:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1ab0:	c3                   	ret
+
+0000000000001ab1 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    1ab1:	48 89 d1             	mov    %rdx,%rcx
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    1ab4:	89 f0                	mov    %esi,%eax
+    1ab6:	f3 aa                	rep stos %al,%es:(%rdi)
+}
+    1ab8:	c3                   	ret
+
+0000000000001ab9 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    1ab9:	48 89 d1             	mov    %rdx,%rcx
+    1abc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    1abe:	c3                   	ret
+
+0000000000001abf <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    1abf:	e9 6c f6 ff ff       	jmp    1130 <memmove@plt>
+
+0000000000001ac4 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    1ac4:	48 89 f1             	mov    %rsi,%rcx
+    std::memset(d, s, n);
+    1ac7:	b0 a5                	mov    $0xa5,%al
+    1ac9:	f3 aa                	rep stos %al,%es:(%rdi)
+    set(d, 0xa5, n);
+}
+    1acb:	c3                   	ret
+
+0000000000001acc <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1acc:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    1acd:	e8 de f5 ff ff       	call   10b0 <memcmp@plt>
+}
+    1ad2:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) == 0;
+    1ad3:	85 c0                	test   %eax,%eax
+    1ad5:	0f 94 c0             	sete   %al
+}
+    1ad8:	c3                   	ret
+
+0000000000001ad9 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1ad9:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    1ada:	e8 d1 f5 ff ff       	call   10b0 <memcmp@plt>
+}
+    1adf:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) != 0;
+    1ae0:	85 c0                	test   %eax,%eax
+    1ae2:	0f 95 c0             	setne  %al
+}
+    1ae5:	c3                   	ret
+
+0000000000001ae6 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+{
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1ae6:	          49 89 fa             	mov    %rdi,%r10
+    1ae9:	          48 89 f0             	mov    %rsi,%rax
+    if (n < streaming_min) {
+    1aec:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1af3:	      /-- 77 05                	ja     1afa <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14>
+    std::memcpy(d, s, n);
+    1af5:	      |   48 89 d1             	mov    %rdx,%rcx
+    1af8:	/-----|-- eb 79                	jmp    1b73 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x8d>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1afa:	|     \-> 48 89 f9             	mov    %rdi,%rcx
+    1afd:	|         48 f7 d9             	neg    %rcx
+    1b00:	|         83 e1 0f             	and    $0xf,%ecx
+    1b03:	|         49 89 c8             	mov    %rcx,%r8
+    std::memcpy(d, s, n);
+    1b06:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1b08:	|         49 8d 70 40          	lea    0x40(%r8),%rsi
+    1b0c:	|         48 89 f9             	mov    %rdi,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1b0f:	|     /-> 0f 10 54 30 d0       	movups -0x30(%rax,%rsi,1),%xmm2
+    1b14:	|     |   0f 10 4c 30 e0       	movups -0x20(%rax,%rsi,1),%xmm1
+    1b19:	|     |   49 89 f0             	mov    %rsi,%r8
+    for (; i + 64 <= n; i += 64) {
+    1b1c:	|     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1b20:	|     |   0f 10 44 30 f0       	movups -0x10(%rax,%rsi,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1b25:	|     |   0f 10 5c 30 c0       	movups -0x40(%rax,%rsi,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    1b2a:	|     |   48 83 c6 40          	add    $0x40,%rsi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1b2e:	|     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    1b33:	|     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    1b38:	|     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    1b3d:	|     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    1b42:	|     |   48 39 f2             	cmp    %rsi,%rdx
+    1b45:	|     \-- 73 c8                	jae    1b0f <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x29>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    1b47:	|  /----> 49 8d 48 10          	lea    0x10(%r8),%rcx
+        stream16(d + i, load16(s + i));
+    1b4b:	|  |      4f 8d 0c 02          	lea    (%r10,%r8,1),%r9
+    for (; i + 16 <= n; i += 16) {
+    1b4f:	|  |      48 39 ca             	cmp    %rcx,%rdx
+    1b52:	|  |  /-- 72 0f                	jb     1b63 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x7d>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1b54:	|  |  |   0f 10 64 08 f0       	movups -0x10(%rax,%rcx,1),%xmm4
+    1b59:	|  |  |   49 89 c8             	mov    %rcx,%r8
+    1b5c:	|  |  |   66 41 0f e7 21       	movntdq %xmm4,(%r9)
+    for (; i + 16 <= n; i += 16) {
+    1b61:	|  \--|-- eb e4                	jmp    1b47 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x61>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    1b63:	|     \-> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    1b66:	|         4c 29 c2             	sub    %r8,%rdx
+        stream16(d + i, load16(s + i));
+    1b69:	|         4a 8d 34 00          	lea    (%rax,%r8,1),%rsi
+    std::memcpy(d, s, n);
+    1b6d:	|         4c 89 cf             	mov    %r9,%rdi
+    copy(d + i, s + i, n - i);
+    1b70:	|         48 89 d1             	mov    %rdx,%rcx
+    std::memcpy(d, s, n);
+    1b73:	\-------> f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1b75:	          c3                   	ret
+
+0000000000001b76 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    1b76:	          49 89 f8             	mov    %rdi,%r8
+    if (n < streaming_min) {
+    1b79:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1b80:	/-------- 77 37                	ja     1bb9 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x43>
+    Length done = (n < 16) ? n : 16;
+    1b82:	|         b8 10 00 00 00       	mov    $0x10,%eax
+    1b87:	|         48 39 c2             	cmp    %rax,%rdx
+    1b8a:	|         48 0f 46 c2          	cmovbe %rdx,%rax
+    std::memcpy(d, s, n);
+    1b8e:	|         89 c1                	mov    %eax,%ecx
+    1b90:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    1b92:	|  /----> 48 39 d0             	cmp    %rdx,%rax
+    1b95:	|  |  /-- 73 21                	jae    1bb8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42>
+        Length const m = (done < n - done) ? done : n - done;
+    1b97:	|  |  |   49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    1b9a:	|  |  |   4d 8d 14 00          	lea    (%r8,%rax,1),%r10
+    std::memcpy(d, s, n);
+    1b9e:	|  |  |   4c 89 c6             	mov    %r8,%rsi
+        Length const m = (done < n - done) ? done : n - done;
+    1ba1:	|  |  |   49 29 c1             	sub    %rax,%r9
+    std::memcpy(d, s, n);
+    1ba4:	|  |  |   4c 89 d7             	mov    %r10,%rdi
+        Length const m = (done < n - done) ? done : n - done;
+    1ba7:	|  |  |   49 39 c1             	cmp    %rax,%r9
+    1baa:	|  |  |   4c 0f 47 c8          	cmova  %rax,%r9
+    std::memcpy(d, s, n);
+    1bae:	|  |  |   44 89 c9             	mov    %r9d,%ecx
+        done += m;
+    1bb1:	|  |  |   4c 01 c8             	add    %r9,%rax
+    std::memcpy(d, s, n);
+    1bb4:	|  |  |   f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+        done += m;
+    1bb6:	|  \--|-- eb da                	jmp    1b92 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c>
+    1bb8:	|     \-> c3                   	ret
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1bb9:	\-------> 48 89 f8             	mov    %rdi,%rax
+    for (Index i = 0; i < head; ++i) {
+    1bbc:	          31 c9                	xor    %ecx,%ecx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1bbe:	          48 f7 d8             	neg    %rax
+    1bc1:	          83 e0 0f             	and    $0xf,%eax
+    for (Index i = 0; i < head; ++i) {
+    1bc4:	   /----> 48 39 c1             	cmp    %rax,%rcx
+    1bc7:	   |  /-- 74 0d                	je     1bd6 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x60>
+        d[i] = p[i];
+    1bc9:	   |  |   40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+    1bcd:	   |  |   41 88 3c 08          	mov    %dil,(%r8,%rcx,1)
+    for (Index i = 0; i < head; ++i) {
+    1bd1:	   |  |   48 ff c1             	inc    %rcx
+    1bd4:	   \--|-- eb ee                	jmp    1bc4 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4e>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    1bd6:	      \-> 31 c9                	xor    %ecx,%ecx
+        rotated[i] = p[(head + i) % 16];
+    1bd8:	      /-> 48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+    1bdc:	      |   83 e7 0f             	and    $0xf,%edi
+    1bdf:	      |   40 8a 3c 3e          	mov    (%rsi,%rdi,1),%dil
+    1be3:	      |   40 88 7c 0c e8       	mov    %dil,-0x18(%rsp,%rcx,1)
+    for (Index i = 0; i < 16; ++i) {
+    1be8:	      |   48 ff c1             	inc    %rcx
+    1beb:	      |   48 83 f9 10          	cmp    $0x10,%rcx
+    1bef:	      \-- 75 e7                	jne    1bd8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x62>
+    std::memcpy(&v, s, sizeof(v));
+    1bf1:	          0f 28 44 24 e8       	movaps -0x18(%rsp),%xmm0
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1bf6:	          48 8d 78 40          	lea    0x40(%rax),%rdi
+    1bfa:	          4c 01 c0             	add    %r8,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1bfd:	      /-> 48 89 f9             	mov    %rdi,%rcx
+    for (; i + 64 <= n; i += 64) {
+    1c00:	      |   48 8d 7f 40          	lea    0x40(%rdi),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1c04:	      |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    1c08:	      |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    1c0d:	      |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    1c12:	      |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    1c17:	      |   48 83 c0 40          	add    $0x40,%rax
+    1c1b:	      |   48 39 fa             	cmp    %rdi,%rdx
+    1c1e:	      \-- 73 dd                	jae    1bfd <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x87>
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+        stream16(d + i, v);
+    1c20:	          49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    for (; i + 16 <= n; i += 16) {
+    1c24:	   /----> 48 8d 41 10          	lea    0x10(%rcx),%rax
+    1c28:	   |      48 39 c2             	cmp    %rax,%rdx
+    1c2b:	   |  /-- 72 0a                	jb     1c37 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc1>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1c2d:	   |  |   48 89 c1             	mov    %rax,%rcx
+    1c30:	   |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    1c35:	   \--|-- eb ed                	jmp    1c24 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xae>
+    }
+    __builtin_ia32_sfence();
+    1c37:	      \-> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    1c3a:	   /----> 48 39 d1             	cmp    %rdx,%rcx
+    1c3d:	   |  /-- 73 12                	jae    1c51 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xdb>
+        d[i] = p[i % 16];
+    1c3f:	   |  |   48 89 c8             	mov    %rcx,%rax
+    1c42:	   |  |   83 e0 0f             	and    $0xf,%eax
+    1c45:	   |  |   8a 04 06             	mov    (%rsi,%rax,1),%al
+    1c48:	   |  |   41 88 04 08          	mov    %al,(%r8,%rcx,1)
+    for (; i < n; ++i) {
+    1c4c:	   |  |   48 ff c1             	inc    %rcx
+    1c4f:	   \--|-- eb e9                	jmp    1c3a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc4>
+    }
+}
+    1c51:	      \-> c3                   	ret
+
+0000000000001c52 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    1c52:	    48 85 ff             	test   %rdi,%rdi
+    1c55:	/-- 74 09                	je     1c60 <nel::free_aligned(void*)+0xe>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    1c57:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    1c5b:	|   e9 d0 f3 ff ff       	jmp    1030 <free@plt>
+}
+    1c60:	\-> c3                   	ret
+
+0000000000001c61 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    1c61:	       41 56                	push   %r14
+            : fn_name_(fn_name)
+    1c63:	       48 8d 05 e9 15 00 00 	lea    0x15e9(%rip),%rax        # 3253 <_IO_stdin_used+0x253>
+    1c6a:	       41 55                	push   %r13
+    1c6c:	       41 54                	push   %r12
+    1c6e:	       55                   	push   %rbp
+    1c6f:	       53                   	push   %rbx
+    1c70:	       48 83 ec 20          	sub    $0x20,%rsp
+    1c74:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , file_name_(file_name)
+    1c79:	       48 8d 05 e3 15 00 00 	lea    0x15e3(%rip),%rax        # 3263 <_IO_stdin_used+0x263>
+    1c80:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1c85:	       c7 44 24 18 f3 00 00 	movl   $0xf3,0x18(%rsp)
+    1c8c:	       00 
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    1c8d:	       48 85 f6             	test   %rsi,%rsi
+    1c90:	/----- 74 28                	je     1cba <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1c92:	|      4c 8d 66 ff          	lea    -0x1(%rsi),%r12
+    1c96:	|      48 89 f3             	mov    %rsi,%rbx
+    1c99:	|      49 21 f4             	and    %rsi,%r12
+    1c9c:	+----- 75 1c                	jne    1cba <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1c9e:	|      49 89 fd             	mov    %rdi,%r13
+    1ca1:	|      49 89 d6             	mov    %rdx,%r14
+    1ca4:	|      48 89 cd             	mov    %rcx,%rbp
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1ca7:	|      31 ff                	xor    %edi,%edi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    1ca9:	|      4d 85 ed             	test   %r13,%r13
+    1cac:	|  /-- 74 1d                	je     1ccb <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+    1cae:	|  |   4d 8b 65 f8          	mov    -0x8(%r13),%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1cb2:	|  |   4c 89 ef             	mov    %r13,%rdi
+    1cb5:	|  |   4c 29 e7             	sub    %r12,%rdi
+    1cb8:	|  +-- eb 11                	jmp    1ccb <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    1cba:	\--|-> 48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    1cbf:	   |   48 8d 3d af 15 00 00 	lea    0x15af(%rip),%rdi        # 3275 <_IO_stdin_used+0x275>
+    1cc6:	   |   e8 37 f5 ff ff       	call   1202 <nel::assert_fail(char const*, nel::Context const&)>
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1ccb:	   \-> 48 8d 34 2b          	lea    (%rbx,%rbp,1),%rsi
+    1ccf:	       e8 3c f4 ff ff       	call   1110 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    1cd4:	       48 85 c0             	test   %rax,%rax
+    1cd7:	/----- 74 3b                	je     1d14 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb3>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1cd9:	|      48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    1cde:	|      48 f7 db             	neg    %rbx
+    1ce1:	|      48 21 d9             	and    %rbx,%rcx
+    1ce4:	|      48 89 cb             	mov    %rcx,%rbx
+    1ce7:	|      48 29 c3             	sub    %rax,%rbx
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    1cea:	|      4d 85 ed             	test   %r13,%r13
+    1ced:	|  /-- 74 1e                	je     1d0d <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+    1cef:	|  |   49 39 dc             	cmp    %rbx,%r12
+    1cf2:	|  +-- 74 19                	je     1d0d <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    1cf4:	|  |   4c 39 f5             	cmp    %r14,%rbp
+    1cf7:	|  |   4c 89 f2             	mov    %r14,%rdx
+    1cfa:	|  |   4a 8d 34 20          	lea    (%rax,%r12,1),%rsi
+    1cfe:	|  |   48 89 cf             	mov    %rcx,%rdi
+    1d01:	|  |   48 0f 46 d5          	cmovbe %rbp,%rdx
+    1d05:	|  |   e8 26 f4 ff ff       	call   1130 <memmove@plt>
+    1d0a:	|  |   48 89 c1             	mov    %rax,%rcx
+    }
+    offset_field(new_p) = new_offset;
+    1d0d:	|  \-> 48 89 59 f8          	mov    %rbx,-0x8(%rcx)
+    return new_p;
+    1d11:	|      48 89 c8             	mov    %rcx,%rax
+}
+    1d14:	\----> 48 83 c4 20          	add    $0x20,%rsp
+    1d18:	       5b                   	pop    %rbx
+    1d19:	       5d                   	pop    %rbp
+    1d1a:	       41 5c                	pop    %r12
+    1d1c:	       41 5d                	pop    %r13
+    1d1e:	       41 5e                	pop    %r14
+    1d20:	       c3                   	ret
+
+0000000000001d21 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    1d21:	48 89 f1             	mov    %rsi,%rcx
+    return realloc_aligned(nullptr, align, 0, size);
+    1d24:	31 d2                	xor    %edx,%edx
+    1d26:	48 89 fe             	mov    %rdi,%rsi
+    1d29:	31 ff                	xor    %edi,%edi
+    1d2b:	e9 31 ff ff ff       	jmp    1c61 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+
+0000000000001d30 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1d30:	53                   	push   %rbx
+    1d31:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    1d34:	40 0f be fe          	movsbl %sil,%edi
+    1d38:	48 8b 35 81 33 00 00 	mov    0x3381(%rip),%rsi        # 50c0 <stderr@GLIBC_2.2.5>
+    1d3f:	e8 5c f3 ff ff       	call   10a0 <fputc@plt>
+    return outs;
+}
+    1d44:	48 89 d8             	mov    %rbx,%rax
+    1d47:	5b                   	pop    %rbx
+    1d48:	c3                   	ret
+
+0000000000001d49 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1d49:	53                   	push   %rbx
+    1d4a:	48 89 fb             	mov    %rdi,%rbx
+    1d4d:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    1d50:	48 8b 35 69 33 00 00 	mov    0x3369(%rip),%rsi        # 50c0 <stderr@GLIBC_2.2.5>
+    1d57:	e8 34 f3 ff ff       	call   1090 <fputs@plt>
+    return outs;
+}
+    1d5c:	48 89 d8             	mov    %rbx,%rax
+    1d5f:	5b                   	pop    %rbx
+    1d60:	c3                   	ret
+
+0000000000001d61 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1d61:	53                   	push   %rbx
+    1d62:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    1d65:	48 8b 3d 54 33 00 00 	mov    0x3354(%rip),%rdi        # 50c0 <stderr@GLIBC_2.2.5>
+    1d6c:	40 0f b6 d6          	movzbl %sil,%edx
+    1d70:	31 c0                	xor    %eax,%eax
+    1d72:	48 8d 35 17 15 00 00 	lea    0x1517(%rip),%rsi        # 3290 <_IO_stdin_used+0x290>
+    1d79:	e8 52 f3 ff ff       	call   10d0 <fprintf@plt>
+    return outs;
+}
+    1d7e:	48 89 d8             	mov    %rbx,%rax
+    1d81:	5b                   	pop    %rbx
+    1d82:	c3                   	ret
+
+0000000000001d83 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    1d83:	53                   	push   %rbx
+    1d84:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    1d87:	48 8b 3d 32 33 00 00 	mov    0x3332(%rip),%rdi        # 50c0 <stderr@GLIBC_2.2.5>
+    1d8e:	0f b7 d6             	movzwl %si,%edx
+    1d91:	31 c0                	xor    %eax,%eax
+    1d93:	48 8d 35 f6 14 00 00 	lea    0x14f6(%rip),%rsi        # 3290 <_IO_stdin_used+0x290>
+    1d9a:	e8 31 f3 ff ff       	call   10d0 <fprintf@plt>
+    return outs;
+}
+    1d9f:	48 89 d8             	mov    %rbx,%rax
+    1da2:	5b                   	pop    %rbx
+    1da3:	c3                   	ret
+
+0000000000001da4 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    1da4:	53                   	push   %rbx
+    1da5:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    1da8:	48 8b 3d 11 33 00 00 	mov    0x3311(%rip),%rdi        # 50c0 <stderr@GLIBC_2.2.5>
+{
+    1daf:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    1db1:	31 c0                	xor    %eax,%eax
+    1db3:	48 8d 35 d6 14 00 00 	lea    0x14d6(%rip),%rsi        # 3290 <_IO_stdin_used+0x290>
+    1dba:	e8 11 f3 ff ff       	call   10d0 <fprintf@plt>
+    return outs;
+}
+    1dbf:	48 89 d8             	mov    %rbx,%rax
+    1dc2:	5b                   	pop    %rbx
+    1dc3:	c3                   	ret
+
+0000000000001dc4 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    1dc4:	53                   	push   %rbx
+    1dc5:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    1dc8:	48 8b 3d f1 32 00 00 	mov    0x32f1(%rip),%rdi        # 50c0 <stderr@GLIBC_2.2.5>
+{
+    1dcf:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    1dd1:	31 c0                	xor    %eax,%eax
+    1dd3:	48 8d 35 b6 14 00 00 	lea    0x14b6(%rip),%rsi        # 3290 <_IO_stdin_used+0x290>
+    1dda:	e8 f1 f2 ff ff       	call   10d0 <fprintf@plt>
+    return outs;
+}
+    1ddf:	48 89 d8             	mov    %rbx,%rax
+    1de2:	5b                   	pop    %rbx
+    1de3:	c3                   	ret
+
+0000000000001de4 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    1de4:	53                   	push   %rbx
+    1de5:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    1de8:	48 8b 3d d1 32 00 00 	mov    0x32d1(%rip),%rdi        # 50c0 <stderr@GLIBC_2.2.5>
+{
+    1def:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    1df2:	31 c0                	xor    %eax,%eax
+    1df4:	48 8d 35 98 14 00 00 	lea    0x1498(%rip),%rsi        # 3293 <_IO_stdin_used+0x293>
+    1dfb:	e8 d0 f2 ff ff       	call   10d0 <fprintf@plt>
+    return outs;
+}
+    1e00:	48 89 d8             	mov    %rbx,%rax
+    1e03:	5b                   	pop    %rbx
+    1e04:	c3                   	ret
+    1e05:	90                   	nop
+
+0000000000001e06 <nel::par::(anonymous namespace)::destroy(nel::par::Pool::Shared*)>:
+    return nullptr;
+}
+
+// Stop and join the started workers, then free s.
+void destroy(Pool::Shared *const s)
+{
+    1e06:	       41 55                	push   %r13
+    1e08:	       41 54                	push   %r12
+    pthread_mutex_lock(&s->lock_);
+    1e0a:	       4c 8d 67 40          	lea    0x40(%rdi),%r12
+{
+    1e0e:	       55                   	push   %rbp
+    s->stop_ = true;
+    pthread_cond_broadcast(&s->wake_);
+    pthread_mutex_unlock(&s->lock_);
+
+    for (Index i = 0; i < s->n_workers_; ++i) {
+    1e0f:	       31 ed                	xor    %ebp,%ebp
+{
+    1e11:	       53                   	push   %rbx
+    1e12:	       48 89 fb             	mov    %rdi,%rbx
+    pthread_mutex_lock(&s->lock_);
+    1e15:	       4c 89 e7             	mov    %r12,%rdi
+{
+    1e18:	       52                   	push   %rdx
+    pthread_cond_broadcast(&s->wake_);
+    1e19:	       4c 8d 6b 68          	lea    0x68(%rbx),%r13
+    pthread_mutex_lock(&s->lock_);
+    1e1d:	       e8 5e f3 ff ff       	call   1180 <pthread_mutex_lock@plt>
+    s->stop_ = true;
+    1e22:	       c6 83 d8 00 00 00 01 	movb   $0x1,0xd8(%rbx)
+    pthread_cond_broadcast(&s->wake_);
+    1e29:	       4c 89 ef             	mov    %r13,%rdi
+    1e2c:	       e8 1f f2 ff ff       	call   1050 <pthread_cond_broadcast@plt>
+    pthread_mutex_unlock(&s->lock_);
+    1e31:	       4c 89 e7             	mov    %r12,%rdi
+    1e34:	       e8 b7 f2 ff ff       	call   10f0 <pthread_mutex_unlock@plt>
+    for (Index i = 0; i < s->n_workers_; ++i) {
+    1e39:	/----> 48 3b 6b 08          	cmp    0x8(%rbx),%rbp
+    1e3d:	|  /-- 73 14                	jae    1e53 <nel::par::(anonymous namespace)::destroy(nel::par::Pool::Shared*)+0x4d>
+        pthread_join(s->workers_[i], nullptr);
+    1e3f:	|  |   48 8b 43 10          	mov    0x10(%rbx),%rax
+    1e43:	|  |   31 f6                	xor    %esi,%esi
+    1e45:	|  |   48 8b 3c e8          	mov    (%rax,%rbp,8),%rdi
+    for (Index i = 0; i < s->n_workers_; ++i) {
+    1e49:	|  |   48 ff c5             	inc    %rbp
+        pthread_join(s->workers_[i], nullptr);
+    1e4c:	|  |   e8 0f f3 ff ff       	call   1160 <pthread_join@plt>
+    for (Index i = 0; i < s->n_workers_; ++i) {
+    1e51:	\--|-- eb e6                	jmp    1e39 <nel::par::(anonymous namespace)::destroy(nel::par::Pool::Shared*)+0x33>
+    }
+
+    pthread_cond_destroy(&s->idle_);
+    1e53:	   \-> 48 8d bb 98 00 00 00 	lea    0x98(%rbx),%rdi
+    1e5a:	       e8 e1 f2 ff ff       	call   1140 <pthread_cond_destroy@plt>
+    pthread_cond_destroy(&s->wake_);
+    1e5f:	       4c 89 ef             	mov    %r13,%rdi
+    1e62:	       e8 d9 f2 ff ff       	call   1140 <pthread_cond_destroy@plt>
+    pthread_mutex_destroy(&s->lock_);
+    1e67:	       4c 89 e7             	mov    %r12,%rdi
+    1e6a:	       e8 11 f2 ff ff       	call   1080 <pthread_mutex_destroy@plt>
+    pthread_mutex_destroy(&s->run_lock_);
+    1e6f:	       48 8d 7b 18          	lea    0x18(%rbx),%rdi
+    1e73:	       e8 08 f2 ff ff       	call   1080 <pthread_mutex_destroy@plt>
+    if (s->workers_ != nullptr) {
+    1e78:	       48 8b 7b 10          	mov    0x10(%rbx),%rdi
+    1e7c:	       48 85 ff             	test   %rdi,%rdi
+    1e7f:	   /-- 74 05                	je     1e86 <nel::par::(anonymous namespace)::destroy(nel::par::Pool::Shared*)+0x80>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    1e81:	   |   e8 aa f1 ff ff       	call   1030 <free@plt>
+        Alloc::free(s->workers_, alignof(pthread_t), (s->n_threads_ - 1) * sizeof(pthread_t));
+    }
+    Alloc::free(s, alignof(Pool::Shared), sizeof(Pool::Shared));
+}
+    1e86:	   \-> 58                   	pop    %rax
+    1e87:	       48 89 df             	mov    %rbx,%rdi
+    1e8a:	       5b                   	pop    %rbx
+    1e8b:	       5d                   	pop    %rbp
+    1e8c:	       41 5c                	pop    %r12
+    1e8e:	       41 5d                	pop    %r13
+    1e90:	       e9 9b f1 ff ff       	jmp    1030 <free@plt>
+
+0000000000001e95 <nel::par::(anonymous namespace)::run_chunks(bool (*)(void*, unsigned long), void*, unsigned long, unsigned long&, bool&)>:
+{
+    1e95:	       41 56                	push   %r14
+    1e97:	       49 89 d6             	mov    %rdx,%r14
+    1e9a:	       41 55                	push   %r13
+    1e9c:	       49 89 f5             	mov    %rsi,%r13
+    1e9f:	       41 54                	push   %r12
+    1ea1:	       49 89 fc             	mov    %rdi,%r12
+    1ea4:	       55                   	push   %rbp
+    1ea5:	       4c 89 c5             	mov    %r8,%rbp
+    1ea8:	       53                   	push   %rbx
+    1ea9:	       48 89 cb             	mov    %rcx,%rbx
+    while (!__atomic_load_n(&failed, __ATOMIC_RELAXED)) {
+    1eac:	/----> 8a 45 00             	mov    0x0(%rbp),%al
+    1eaf:	|      84 c0                	test   %al,%al
+    1eb1:	|  /-- 75 1f                	jne    1ed2 <nel::par::(anonymous namespace)::run_chunks(bool (*)(void*, unsigned long), void*, unsigned long, unsigned long&, bool&)+0x3d>
+        Index const c = __atomic_fetch_add(&next, 1, __ATOMIC_RELAXED);
+    1eb3:	|  |   be 01 00 00 00       	mov    $0x1,%esi
+    1eb8:	|  |   f0 48 0f c1 33       	lock xadd %rsi,(%rbx)
+        if (c >= n_chunks) { break; }
+    1ebd:	|  |   4c 39 f6             	cmp    %r14,%rsi
+    1ec0:	|  +-- 73 10                	jae    1ed2 <nel::par::(anonymous namespace)::run_chunks(bool (*)(void*, unsigned long), void*, unsigned long, unsigned long&, bool&)+0x3d>
+        if (!task(ctx, c)) { __atomic_store_n(&failed, true, __ATOMIC_RELAXED); }
+    1ec2:	|  |   4c 89 ef             	mov    %r13,%rdi
+    1ec5:	|  |   41 ff d4             	call   *%r12
+    1ec8:	|  |   84 c0                	test   %al,%al
+    1eca:	+--|-- 75 e0                	jne    1eac <nel::par::(anonymous namespace)::run_chunks(bool (*)(void*, unsigned long), void*, unsigned long, unsigned long&, bool&)+0x17>
+    1ecc:	|  |   c6 45 00 01          	movb   $0x1,0x0(%rbp)
+    1ed0:	\--|-- eb da                	jmp    1eac <nel::par::(anonymous namespace)::run_chunks(bool (*)(void*, unsigned long), void*, unsigned long, unsigned long&, bool&)+0x17>
+}
+    1ed2:	   \-> 5b                   	pop    %rbx
+    1ed3:	       5d                   	pop    %rbp
+    1ed4:	       41 5c                	pop    %r12
+    1ed6:	       41 5d                	pop    %r13
+    1ed8:	       41 5e                	pop    %r14
+    1eda:	       c3                   	ret
+
+0000000000001edb <nel::par::(anonymous namespace)::worker_main(void*)>:
+{
+    1edb:	             41 57                	push   %r15
+    1edd:	             41 56                	push   %r14
+    1edf:	             41 55                	push   %r13
+    1ee1:	             41 54                	push   %r12
+    1ee3:	             55                   	push   %rbp
+    pthread_mutex_lock(&s->lock_);
+    1ee4:	             48 8d 6f 40          	lea    0x40(%rdi),%rbp
+{
+    1ee8:	             53                   	push   %rbx
+    1ee9:	             48 89 fb             	mov    %rdi,%rbx
+    pthread_mutex_lock(&s->lock_);
+    1eec:	             48 89 ef             	mov    %rbp,%rdi
+        run_chunks(task, ctx, n_chunks, s->next_, s->failed_);
+    1eef:	             4c 8d ab 00 01 00 00 	lea    0x100(%rbx),%r13
+{
+    1ef6:	             48 83 ec 18          	sub    $0x18,%rsp
+    pthread_mutex_lock(&s->lock_);
+    1efa:	             e8 81 f2 ff ff       	call   1180 <pthread_mutex_lock@plt>
+    USize seen = 0;
+    1eff:	             31 c0                	xor    %eax,%eax
+        while (!s->stop_ && s->generation_ == seen) {
+    1f01:	      /----> 80 bb d8 00 00 00 00 	cmpb   $0x0,0xd8(%rbx)
+    1f08:	/-----|----- 75 78                	jne    1f82 <nel::par::(anonymous namespace)::worker_main(void*)+0xa7>
+    1f0a:	|     |      4c 8b a3 c8 00 00 00 	mov    0xc8(%rbx),%r12
+    1f11:	|     |      49 39 c4             	cmp    %rax,%r12
+    1f14:	|     |  /-- 75 11                	jne    1f27 <nel::par::(anonymous namespace)::worker_main(void*)+0x4c>
+            pthread_cond_wait(&s->wake_, &s->lock_);
+    1f16:	|     |  |   48 8d 7b 68          	lea    0x68(%rbx),%rdi
+    1f1a:	|     |  |   48 89 ee             	mov    %rbp,%rsi
+    1f1d:	|     |  |   e8 4e f1 ff ff       	call   1070 <pthread_cond_wait@plt>
+    1f22:	|  /--|--|-> 4c 89 e0             	mov    %r12,%rax
+    1f25:	|  |  \--|-- eb da                	jmp    1f01 <nel::par::(anonymous namespace)::worker_main(void*)+0x26>
+        Count const n_chunks = s->n_chunks_;
+    1f27:	|  |     \-> 48 8b 93 f0 00 00 00 	mov    0xf0(%rbx),%rdx
+        Pool::Task const task = s->task_;
+    1f2e:	|  |         4c 8b b3 e0 00 00 00 	mov    0xe0(%rbx),%r14
+        pthread_mutex_unlock(&s->lock_);
+    1f35:	|  |         48 89 ef             	mov    %rbp,%rdi
+        void *const ctx = s->ctx_;
+    1f38:	|  |         4c 8b bb e8 00 00 00 	mov    0xe8(%rbx),%r15
+        Count const n_chunks = s->n_chunks_;
+    1f3f:	|  |         48 89 54 24 08       	mov    %rdx,0x8(%rsp)
+        pthread_mutex_unlock(&s->lock_);
+    1f44:	|  |         e8 a7 f1 ff ff       	call   10f0 <pthread_mutex_unlock@plt>
+        run_chunks(task, ctx, n_chunks, s->next_, s->failed_);
+    1f49:	|  |         48 8b 54 24 08       	mov    0x8(%rsp),%rdx
+    1f4e:	|  |         4d 89 e8             	mov    %r13,%r8
+    1f51:	|  |         4c 89 fe             	mov    %r15,%rsi
+    1f54:	|  |         48 8d 8b f8 00 00 00 	lea    0xf8(%rbx),%rcx
+    1f5b:	|  |         4c 89 f7             	mov    %r14,%rdi
+    1f5e:	|  |         e8 32 ff ff ff       	call   1e95 <nel::par::(anonymous namespace)::run_chunks(bool (*)(void*, unsigned long), void*, unsigned long, unsigned long&, bool&)>
+        pthread_mutex_lock(&s->lock_);
+    1f63:	|  |         48 89 ef             	mov    %rbp,%rdi
+    1f66:	|  |         e8 15 f2 ff ff       	call   1180 <pthread_mutex_lock@plt>
+        s->busy_ -= 1;
+    1f6b:	|  |         48 ff 8b d0 00 00 00 	decq   0xd0(%rbx)
+        if (s->busy_ == 0) { pthread_cond_signal(&s->idle_); }
+    1f72:	|  +-------- 75 ae                	jne    1f22 <nel::par::(anonymous namespace)::worker_main(void*)+0x47>
+    1f74:	|  |         48 8d bb 98 00 00 00 	lea    0x98(%rbx),%rdi
+    1f7b:	|  |         e8 40 f1 ff ff       	call   10c0 <pthread_cond_signal@plt>
+    1f80:	|  \-------- eb a0                	jmp    1f22 <nel::par::(anonymous namespace)::worker_main(void*)+0x47>
+    pthread_mutex_unlock(&s->lock_);
+    1f82:	\----------> 48 89 ef             	mov    %rbp,%rdi
+    1f85:	             e8 66 f1 ff ff       	call   10f0 <pthread_mutex_unlock@plt>
+}
+    1f8a:	             48 83 c4 18          	add    $0x18,%rsp
+    1f8e:	             31 c0                	xor    %eax,%eax
+    1f90:	             5b                   	pop    %rbx
+    1f91:	             5d                   	pop    %rbp
+    1f92:	             41 5c                	pop    %r12
+    1f94:	             41 5d                	pop    %r13
+    1f96:	             41 5e                	pop    %r14
+    1f98:	             41 5f                	pop    %r15
+    1f9a:	             c3                   	ret
+    1f9b:	             90                   	nop
+
+0000000000001f9c <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const [clone .isra.0]>:
+            switch (tag_) { // result-match
+    1f9c:	          83 ff 01             	cmp    $0x1,%edi
+    1f9f:	/-------- 74 24                	je     1fc5 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const [clone .isra.0]+0x29>
+    1fa1:	|         b0 01                	mov    $0x1,%al
+    1fa3:	|         83 ff 02             	cmp    $0x2,%edi
+    1fa6:	|  /----- 74 1f                	je     1fc7 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const [clone .isra.0]+0x2b>
+        constexpr bool is_err(Context const &ctx = Context()) const
+    1fa8:	|  |      50                   	push   %rax
+            switch (tag_) { // result-match
+    1fa9:	|  |      85 ff                	test   %edi,%edi
+    1fab:	|  |  /-- 75 0c                	jne    1fb9 <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const [clone .isra.0]+0x1d>
+                    nel::panic("invalid Result", ctx);
+    1fad:	|  |  |   48 8d 3d 67 11 00 00 	lea    0x1167(%rip),%rdi        # 311b <_IO_stdin_used+0x11b>
+    1fb4:	|  |  |   e8 19 f2 ff ff       	call   11d2 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    1fb9:	|  |  \-> 48 8d 3d 6a 11 00 00 	lea    0x116a(%rip),%rdi        # 312a <_IO_stdin_used+0x12a>
+    1fc0:	|  |      e8 0d f2 ff ff       	call   11d2 <nel::panic(char const*, nel::Context const&)>
+                    return on_ok(*ok_);
+    1fc5:	\--|----> 31 c0                	xor    %eax,%eax
+        }
+    1fc7:	   \----> c3                   	ret
+
+0000000000001fc8 <nel::par::Pool::~Pool()>:
+
+} // namespace
+
+Pool::~Pool(void)
+{
+    if (shared_ != nullptr) { destroy(shared_); }
+    1fc8:	    48 8b 3f             	mov    (%rdi),%rdi
+    1fcb:	    48 85 ff             	test   %rdi,%rdi
+    1fce:	/-- 74 05                	je     1fd5 <nel::par::Pool::~Pool()+0xd>
+    1fd0:	|   e9 31 fe ff ff       	jmp    1e06 <nel::par::(anonymous namespace)::destroy(nel::par::Pool::Shared*)>
+}
+    1fd5:	\-> c3                   	ret
+
+0000000000001fd6 <nel::par::Pool::operator=(nel::par::Pool&&)>:
+
+Pool &Pool::operator=(Pool &&o)
+{
+    1fd6:	       55                   	push   %rbp
+    1fd7:	       53                   	push   %rbx
+    1fd8:	       48 89 fb             	mov    %rdi,%rbx
+    1fdb:	       41 50                	push   %r8
+    if (this != &o) {
+    1fdd:	       48 39 f7             	cmp    %rsi,%rdi
+    1fe0:	/----- 74 1d                	je     1fff <nel::par::Pool::operator=(nel::par::Pool&&)+0x29>
+        if (shared_ != nullptr) { destroy(shared_); }
+    1fe2:	|      48 8b 3f             	mov    (%rdi),%rdi
+    1fe5:	|      48 89 f5             	mov    %rsi,%rbp
+    1fe8:	|      48 85 ff             	test   %rdi,%rdi
+    1feb:	|  /-- 74 05                	je     1ff2 <nel::par::Pool::operator=(nel::par::Pool&&)+0x1c>
+    1fed:	|  |   e8 14 fe ff ff       	call   1e06 <nel::par::(anonymous namespace)::destroy(nel::par::Pool::Shared*)>
+        shared_ = o.shared_;
+    1ff2:	|  \-> 48 8b 45 00          	mov    0x0(%rbp),%rax
+        o.shared_ = nullptr;
+    1ff6:	|      31 c9                	xor    %ecx,%ecx
+        shared_ = o.shared_;
+    1ff8:	|      48 89 03             	mov    %rax,(%rbx)
+        o.shared_ = nullptr;
+    1ffb:	|      48 89 4d 00          	mov    %rcx,0x0(%rbp)
+    }
+    return *this;
+}
+    1fff:	\----> 48 89 d8             	mov    %rbx,%rax
+    2002:	       5a                   	pop    %rdx
+    2003:	       5b                   	pop    %rbx
+    2004:	       5d                   	pop    %rbp
+    2005:	       c3                   	ret
+
+0000000000002006 <nel::par::Pool::available_parallelism()>:
+
+Count Pool::available_parallelism(void)
+{
+    2006:	50                   	push   %rax
+#if defined(NEL_PAR_PTHREADS)
+    long const n = sysconf(_SC_NPROCESSORS_ONLN);
+    2007:	bf 54 00 00 00       	mov    $0x54,%edi
+    200c:	e8 3f f1 ff ff       	call   1150 <sysconf@plt>
+    return (n < 1) ? 1 : Count(n);
+    2011:	ba 01 00 00 00       	mov    $0x1,%edx
+    2016:	48 85 c0             	test   %rax,%rax
+    2019:	48 0f 4e c2          	cmovle %rdx,%rax
+#else
+    return 1;
+#endif
+}
+    201d:	5a                   	pop    %rdx
+    201e:	c3                   	ret
+    201f:	90                   	nop
+
+0000000000002020 <nel::par::Pool::n_threads() const>:
+#endif
+}
+
+Count Pool::n_threads(void) const
+{
+    return shared_->n_threads_;
+    2020:	48 8b 07             	mov    (%rdi),%rax
+    2023:	48 8b 00             	mov    (%rax),%rax
+}
+    2026:	c3                   	ret
+    2027:	90                   	nop
+
+0000000000002028 <nel::par::Pool::chunk_len(unsigned long, unsigned long) const>:
+
+Length Pool::chunk_len(Length const len, Length const item_size) const
+{
+    2028:	    49 89 f9             	mov    %rdi,%r9
+    // fewest items that make whole cache lines: cache_line / gcd(item_size, cache_line).
+    Length const pow2 = item_size & (~item_size + 1);
+    202b:	    48 89 d7             	mov    %rdx,%rdi
+{
+    202e:	    48 89 f1             	mov    %rsi,%rcx
+    Length const line_items = cache_line / ((pow2 < cache_line) ? pow2 : cache_line);
+    2031:	    b8 40 00 00 00       	mov    $0x40,%eax
+    Length const pow2 = item_size & (~item_size + 1);
+    2036:	    48 f7 df             	neg    %rdi
+{
+    2039:	    48 89 d6             	mov    %rdx,%rsi
+    Length const min_items = (item_size < min_chunk_bytes) ? min_chunk_bytes / item_size : 1;
+    203c:	    41 b8 01 00 00 00    	mov    $0x1,%r8d
+    Length const pow2 = item_size & (~item_size + 1);
+    2042:	    48 21 d7             	and    %rdx,%rdi
+    Length const line_items = cache_line / ((pow2 < cache_line) ? pow2 : cache_line);
+    2045:	    48 39 c7             	cmp    %rax,%rdi
+    2048:	    48 0f 47 f8          	cmova  %rax,%rdi
+    204c:	    31 d2                	xor    %edx,%edx
+    204e:	    48 f7 f7             	div    %rdi
+    2051:	    48 89 c7             	mov    %rax,%rdi
+    Length const min_items = (item_size < min_chunk_bytes) ? min_chunk_bytes / item_size : 1;
+    2054:	    48 81 fe ff 7f 00 00 	cmp    $0x7fff,%rsi
+    205b:	/-- 77 0d                	ja     206a <nel::par::Pool::chunk_len(unsigned long, unsigned long) const+0x42>
+    205d:	|   b8 00 80 00 00       	mov    $0x8000,%eax
+    2062:	|   31 d2                	xor    %edx,%edx
+    2064:	|   48 f7 f6             	div    %rsi
+    2067:	|   49 89 c0             	mov    %rax,%r8
+    return shared_->n_threads_;
+    206a:	\-> 49 8b 01             	mov    (%r9),%rax
+    Length const even = len / (n_threads() * chunks_per_thread);
+    206d:	    31 d2                	xor    %edx,%edx
+    206f:	    48 8b 30             	mov    (%rax),%rsi
+    2072:	    48 89 c8             	mov    %rcx,%rax
+    2075:	    48 c1 e6 02          	shl    $0x2,%rsi
+    2079:	    48 f7 f6             	div    %rsi
+    Length const c = (even > min_items) ? even : min_items;
+    return ((c + line_items - 1) / line_items) * line_items;
+    207c:	    4c 39 c0             	cmp    %r8,%rax
+    Length const even = len / (n_threads() * chunks_per_thread);
+    207f:	    48 89 c1             	mov    %rax,%rcx
+    return ((c + line_items - 1) / line_items) * line_items;
+    2082:	    49 0f 42 c8          	cmovb  %r8,%rcx
+    2086:	    31 d2                	xor    %edx,%edx
+    2088:	    48 8d 4c 0f ff       	lea    -0x1(%rdi,%rcx,1),%rcx
+    208d:	    48 89 c8             	mov    %rcx,%rax
+    2090:	    48 f7 f7             	div    %rdi
+    2093:	    48 89 c8             	mov    %rcx,%rax
+    2096:	    48 29 d0             	sub    %rdx,%rax
+}
+    2099:	    c3                   	ret
+
+000000000000209a <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const>:
+
+Chunks Pool::chunks(void const *const p, Length const len, Length const item_size) const
+{
+    209a:	          55                   	push   %rbp
+    209b:	          49 89 d2             	mov    %rdx,%r10
+    209e:	          49 89 fb             	mov    %rdi,%r11
+    Length const cl = chunk_len(len, item_size);
+    20a1:	          4c 89 c2             	mov    %r8,%rdx
+{
+    20a4:	          53                   	push   %rbx
+    20a5:	          48 89 f7             	mov    %rsi,%rdi
+    Length const cl = chunk_len(len, item_size);
+    20a8:	          48 89 ce             	mov    %rcx,%rsi
+{
+    20ab:	          48 89 cd             	mov    %rcx,%rbp
+    20ae:	          4c 89 c3             	mov    %r8,%rbx
+    Length const cl = chunk_len(len, item_size);
+    20b1:	          e8 72 ff ff ff       	call   2028 <nel::par::Pool::chunk_len(unsigned long, unsigned long) const>
+    // items up to the first cache line edge, if an item boundary lands on one.
+    USize const off = reinterpret_cast<USize>(p) % cache_line;
+    Length head = 0;
+    if (off != 0) {
+    20b6:	          4c 89 d2             	mov    %r10,%rdx
+    20b9:	          83 e2 3f             	and    $0x3f,%edx
+    20bc:	/-------- 74 2c                	je     20ea <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const+0x50>
+        for (Length h = 1; h < cache_line; ++h) {
+            if ((off + h * item_size) % cache_line == 0) {
+    20be:	|         48 8d 0c 13          	lea    (%rbx,%rdx,1),%rcx
+        for (Length h = 1; h < cache_line; ++h) {
+    20c2:	|         ba 01 00 00 00       	mov    $0x1,%edx
+            if ((off + h * item_size) % cache_line == 0) {
+    20c7:	|         f6 c1 3f             	test   $0x3f,%cl
+    20ca:	+-------- 74 1e                	je     20ea <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const+0x50>
+    20cc:	|         48 01 d9             	add    %rbx,%rcx
+        for (Length h = 1; h < cache_line; ++h) {
+    20cf:	|  /----> 48 ff c2             	inc    %rdx
+    20d2:	|  |      48 83 fa 40          	cmp    $0x40,%rdx
+    20d6:	|  |  /-- 74 10                	je     20e8 <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const+0x4e>
+            if ((off + h * item_size) % cache_line == 0) {
+    20d8:	|  |  |   48 89 ce             	mov    %rcx,%rsi
+    20db:	|  |  |   48 01 d9             	add    %rbx,%rcx
+    20de:	|  |  |   83 e6 3f             	and    $0x3f,%esi
+    20e1:	|  |  |   48 85 f6             	test   %rsi,%rsi
+    20e4:	|  \--|-- 75 e9                	jne    20cf <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const+0x35>
+    20e6:	+-----|-- eb 02                	jmp    20ea <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const+0x50>
+    Length head = 0;
+    20e8:	|     \-> 31 d2                	xor    %edx,%edx
+            : len_(len)
+    20ea:	\-------> 49 89 2b             	mov    %rbp,(%r11)
+                break;
+            }
+        }
+    }
+    return Chunks(len, cl, head);
+}
+    20ed:	          5b                   	pop    %rbx
+            , chunk_len_(chunk_len)
+    20ee:	          49 89 43 08          	mov    %rax,0x8(%r11)
+    20f2:	          5d                   	pop    %rbp
+    20f3:	          4c 89 d8             	mov    %r11,%rax
+            , head_(head)
+    20f6:	          49 89 53 10          	mov    %rdx,0x10(%r11)
+    20fa:	          c3                   	ret
+    20fb:	          90                   	nop
+
+00000000000020fc <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)>:
+
+Result<void, ParError> Pool::run(Count const n_chunks, Task const task, void *const ctx)
+{
+    20fc:	             41 57                	push   %r15
+    20fe:	             41 56                	push   %r14
+    2100:	             41 55                	push   %r13
+    2102:	             41 54                	push   %r12
+    2104:	             55                   	push   %rbp
+    2105:	             48 89 fd             	mov    %rdi,%rbp
+    2108:	             53                   	push   %rbx
+    2109:	             48 83 ec 28          	sub    $0x28,%rsp
+    Shared *const s = shared_;
+    210d:	             4c 8b 3e             	mov    (%rsi),%r15
+    if (n_chunks == 0) { return Result<void, ParError>::Ok(); }
+    2110:	             48 85 d2             	test   %rdx,%rdx
+    2113:	/----------- 0f 84 1b 01 00 00    	je     2234 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x138>
+
+#if defined(NEL_PAR_PTHREADS)
+    pthread_mutex_lock(&s->run_lock_);
+    2119:	|            4d 8d 77 18          	lea    0x18(%r15),%r14
+    211d:	|            48 89 d3             	mov    %rdx,%rbx
+    2120:	|            49 89 cc             	mov    %rcx,%r12
+    2123:	|            4c 89 44 24 08       	mov    %r8,0x8(%rsp)
+    2128:	|            4c 89 f7             	mov    %r14,%rdi
+    212b:	|            e8 50 f0 ff ff       	call   1180 <pthread_mutex_lock@plt>
+#endif
+
+    s->task_ = task;
+    s->ctx_ = ctx;
+    2130:	|            48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    s->n_chunks_ = n_chunks;
+    s->next_ = 0;
+    2135:	|            31 c0                	xor    %eax,%eax
+        pthread_cond_broadcast(&s->wake_);
+        pthread_mutex_unlock(&s->lock_);
+    }
+#endif
+
+    run_chunks(task, ctx, n_chunks, s->next_, s->failed_);
+    2137:	|            48 89 da             	mov    %rbx,%rdx
+    bool const wake = s->n_workers_ > 0 && n_chunks > 1;
+    213a:	|            49 83 7f 08 00       	cmpq   $0x0,0x8(%r15)
+    s->task_ = task;
+    213f:	|            4d 89 a7 e0 00 00 00 	mov    %r12,0xe0(%r15)
+    run_chunks(task, ctx, n_chunks, s->next_, s->failed_);
+    2146:	|            4d 8d 87 00 01 00 00 	lea    0x100(%r15),%r8
+    214d:	|            49 8d 8f f8 00 00 00 	lea    0xf8(%r15),%rcx
+    s->ctx_ = ctx;
+    2154:	|            49 89 b7 e8 00 00 00 	mov    %rsi,0xe8(%r15)
+    s->n_chunks_ = n_chunks;
+    215b:	|            49 89 9f f0 00 00 00 	mov    %rbx,0xf0(%r15)
+    s->next_ = 0;
+    2162:	|            49 89 87 f8 00 00 00 	mov    %rax,0xf8(%r15)
+    s->failed_ = false;
+    2169:	|            41 c6 87 00 01 00 00 	movb   $0x0,0x100(%r15)
+    2170:	|            00 
+    bool const wake = s->n_workers_ > 0 && n_chunks > 1;
+    2171:	|        /-- 74 0b                	je     217e <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x82>
+    2173:	|        |   48 83 fb 01          	cmp    $0x1,%rbx
+    2177:	|     /--|-- 75 12                	jne    218b <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x8f>
+    run_chunks(task, ctx, n_chunks, s->next_, s->failed_);
+    2179:	|     |  |   ba 01 00 00 00       	mov    $0x1,%edx
+    217e:	|     |  \-> 4c 89 e7             	mov    %r12,%rdi
+    2181:	|     |      e8 0f fd ff ff       	call   1e95 <nel::par::(anonymous namespace)::run_chunks(bool (*)(void*, unsigned long), void*, unsigned long, unsigned long&, bool&)>
+
+#if defined(NEL_PAR_PTHREADS)
+    if (wake) {
+    2186:	|  /--|----- e9 86 00 00 00       	jmp    2211 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x115>
+        pthread_mutex_lock(&s->lock_);
+    218b:	|  |  \----> 4d 8d 6f 40          	lea    0x40(%r15),%r13
+    218f:	|  |         48 89 74 24 18       	mov    %rsi,0x18(%rsp)
+    2194:	|  |         4c 89 ef             	mov    %r13,%rdi
+    2197:	|  |         48 89 4c 24 10       	mov    %rcx,0x10(%rsp)
+    219c:	|  |         4c 89 44 24 08       	mov    %r8,0x8(%rsp)
+    21a1:	|  |         e8 da ef ff ff       	call   1180 <pthread_mutex_lock@plt>
+        s->busy_ = s->n_workers_;
+    21a6:	|  |         49 8b 47 08          	mov    0x8(%r15),%rax
+        s->generation_ += 1;
+    21aa:	|  |         49 ff 87 c8 00 00 00 	incq   0xc8(%r15)
+        pthread_cond_broadcast(&s->wake_);
+    21b1:	|  |         49 8d 7f 68          	lea    0x68(%r15),%rdi
+        s->busy_ = s->n_workers_;
+    21b5:	|  |         49 89 87 d0 00 00 00 	mov    %rax,0xd0(%r15)
+        pthread_cond_broadcast(&s->wake_);
+    21bc:	|  |         e8 8f ee ff ff       	call   1050 <pthread_cond_broadcast@plt>
+        pthread_mutex_unlock(&s->lock_);
+    21c1:	|  |         4c 89 ef             	mov    %r13,%rdi
+    21c4:	|  |         e8 27 ef ff ff       	call   10f0 <pthread_mutex_unlock@plt>
+    run_chunks(task, ctx, n_chunks, s->next_, s->failed_);
+    21c9:	|  |         4c 8b 44 24 08       	mov    0x8(%rsp),%r8
+    21ce:	|  |         48 89 da             	mov    %rbx,%rdx
+    21d1:	|  |         4c 89 e7             	mov    %r12,%rdi
+    21d4:	|  |         48 8b 4c 24 10       	mov    0x10(%rsp),%rcx
+    21d9:	|  |         48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+        pthread_mutex_lock(&s->lock_);
+        while (s->busy_ != 0) {
+            pthread_cond_wait(&s->idle_, &s->lock_);
+    21de:	|  |         49 8d 9f 98 00 00 00 	lea    0x98(%r15),%rbx
+    run_chunks(task, ctx, n_chunks, s->next_, s->failed_);
+    21e5:	|  |         e8 ab fc ff ff       	call   1e95 <nel::par::(anonymous namespace)::run_chunks(bool (*)(void*, unsigned long), void*, unsigned long, unsigned long&, bool&)>
+        pthread_mutex_lock(&s->lock_);
+    21ea:	|  |         4c 89 ef             	mov    %r13,%rdi
+    21ed:	|  |         e8 8e ef ff ff       	call   1180 <pthread_mutex_lock@plt>
+        while (s->busy_ != 0) {
+    21f2:	|  |  /----> 49 83 bf d0 00 00 00 	cmpq   $0x0,0xd0(%r15)
+    21f9:	|  |  |      00 
+    21fa:	|  |  |  /-- 74 0d                	je     2209 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x10d>
+            pthread_cond_wait(&s->idle_, &s->lock_);
+    21fc:	|  |  |  |   4c 89 ee             	mov    %r13,%rsi
+    21ff:	|  |  |  |   48 89 df             	mov    %rbx,%rdi
+    2202:	|  |  |  |   e8 69 ee ff ff       	call   1070 <pthread_cond_wait@plt>
+    2207:	|  |  \--|-- eb e9                	jmp    21f2 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0xf6>
+        }
+        pthread_mutex_unlock(&s->lock_);
+    2209:	|  |     \-> 4c 89 ef             	mov    %r13,%rdi
+    220c:	|  |         e8 df ee ff ff       	call   10f0 <pthread_mutex_unlock@plt>
+    }
+#endif
+
+    bool const failed = s->failed_;
+    2211:	|  \-------> 41 8a 9f 00 01 00 00 	mov    0x100(%r15),%bl
+
+#if defined(NEL_PAR_PTHREADS)
+    pthread_mutex_unlock(&s->run_lock_);
+    2218:	|            4c 89 f7             	mov    %r14,%rdi
+    221b:	|            e8 d0 ee ff ff       	call   10f0 <pthread_mutex_unlock@plt>
+#endif
+
+    if (failed) { return Result<void, ParError>::Err(ParError::Cancelled); }
+    2220:	|            84 db                	test   %bl,%bl
+    2222:	+----------- 74 10                	je     2234 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x138>
+            : tag_(Tag::ERR)
+    2224:	|            48 b8 02 00 00 00 02 	movabs $0x200000002,%rax
+    222b:	|            00 00 00 
+    222e:	|            48 89 45 00          	mov    %rax,0x0(%rbp)
+    2232:	|        /-- eb 07                	jmp    223b <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x13f>
+            : tag_(Tag::OK)
+    2234:	\--------|-> c7 45 00 01 00 00 00 	movl   $0x1,0x0(%rbp)
+    return Result<void, ParError>::Ok();
+}
+    223b:	         \-> 48 83 c4 28          	add    $0x28,%rsp
+    223f:	             48 89 e8             	mov    %rbp,%rax
+    2242:	             5b                   	pop    %rbx
+    2243:	             5d                   	pop    %rbp
+    2244:	             41 5c                	pop    %r12
+    2246:	             41 5d                	pop    %r13
+    2248:	             41 5e                	pop    %r14
+    224a:	             41 5f                	pop    %r15
+    224c:	             c3                   	ret
+    224d:	             90                   	nop
+
+000000000000224e <nel::par::Pool::try_new(unsigned long)>:
+{
+    224e:	                41 57                	push   %r15
+    2250:	                41 56                	push   %r14
+    2252:	                41 55                	push   %r13
+    2254:	                41 54                	push   %r12
+    2256:	                55                   	push   %rbp
+    2257:	                48 89 f5             	mov    %rsi,%rbp
+    225a:	                53                   	push   %rbx
+    225b:	                48 89 fb             	mov    %rdi,%rbx
+    225e:	                48 83 ec 58          	sub    $0x58,%rsp
+    Count const n_threads = (n == 0) ? available_parallelism() : n;
+    2262:	                48 85 f6             	test   %rsi,%rsi
+    2265:	            /-- 75 08                	jne    226f <nel::par::Pool::try_new(unsigned long)+0x21>
+    2267:	            |   e8 9a fd ff ff       	call   2006 <nel::par::Pool::available_parallelism()>
+    226c:	            |   48 89 c5             	mov    %rax,%rbp
+                                    : std::realloc(p, new_size);
+    226f:	            \-> bf 08 01 00 00       	mov    $0x108,%edi
+    2274:	                e8 87 ee ff ff       	call   1100 <malloc@plt>
+            if (new_p == nullptr) {
+    2279:	                48 85 c0             	test   %rax,%rax
+    227c:	         /----- 75 12                	jne    2290 <nel::par::Pool::try_new(unsigned long)+0x42>
+            : tag_(Tag::ERR)
+    227e:	         |      c7 44 24 18 02 00 00 	movl   $0x2,0x18(%rsp)
+    2285:	         |      00 
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+            : value_(forward<Type>(val))
+    2286:	         |      c7 44 24 20 01 00 00 	movl   $0x1,0x20(%rsp)
+    228d:	         |      00 
+    228e:	         |  /-- eb 0d                	jmp    229d <nel::par::Pool::try_new(unsigned long)+0x4f>
+            : tag_(Tag::OK)
+    2290:	         \--|-> c7 44 24 18 01 00 00 	movl   $0x1,0x18(%rsp)
+    2297:	            |   00 
+        {
+        }
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+            : value_(forward<Args>(args)...)
+    2298:	            |   48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    if (rs.is_err()) { return Result<Pool, ParError>::Err(ParError::OutOfMemory); }
+    229d:	            \-> 48 8d 44 24 38       	lea    0x38(%rsp),%rax
+    22a2:	                8b 7c 24 18          	mov    0x18(%rsp),%edi
+            : fn_name_(fn_name)
+    22a6:	                4c 8d 3d ea 0f 00 00 	lea    0xfea(%rip),%r15        # 3297 <_IO_stdin_used+0x297>
+            , line_num_(line_num)
+    22ad:	                c7 44 24 48 a2 00 00 	movl   $0xa2,0x48(%rsp)
+    22b4:	                00 
+            , file_name_(file_name)
+    22b5:	                4c 8d 35 e3 0f 00 00 	lea    0xfe3(%rip),%r14        # 329f <_IO_stdin_used+0x29f>
+    22bc:	                48 89 c6             	mov    %rax,%rsi
+            : fn_name_(fn_name)
+    22bf:	                4c 89 7c 24 38       	mov    %r15,0x38(%rsp)
+            , file_name_(file_name)
+    22c4:	                4c 89 74 24 40       	mov    %r14,0x40(%rsp)
+    22c9:	                48 89 04 24          	mov    %rax,(%rsp)
+    22cd:	                e8 ca fc ff ff       	call   1f9c <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const [clone .isra.0]>
+    22d2:	                84 c0                	test   %al,%al
+    22d4:	                48 8d 44 24 18       	lea    0x18(%rsp),%rax
+    22d9:	                48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    22de:	            /-- 74 12                	je     22f2 <nel::par::Pool::try_new(unsigned long)+0xa4>
+            : tag_(Tag::ERR)
+    22e0:	            |   c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+            : value_(forward<Type>(val))
+    22e6:	            |   c7 43 08 03 00 00 00 	movl   $0x3,0x8(%rbx)
+    22ed:	/-----------|-- e9 91 01 00 00       	jmp    2483 <nel::par::Pool::try_new(unsigned long)+0x235>
+    Shared *const s = static_cast<Shared *>(rs.unwrap());
+    22f2:	|           \-> 48 8b 34 24          	mov    (%rsp),%rsi
+    22f6:	|               48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+            , line_num_(line_num)
+    22fb:	|               c7 44 24 48 a3 00 00 	movl   $0xa3,0x48(%rsp)
+    2302:	|               00 
+        auto rw = Alloc::try_malloc(alignof(pthread_t), (n_threads - 1) * sizeof(pthread_t));
+    2303:	|               4c 8d 6d ff          	lea    -0x1(%rbp),%r13
+    Shared *const s = static_cast<Shared *>(rs.unwrap());
+    2307:	|               e8 94 01 00 00       	call   24a0 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+    s->next_ = 0;
+    230c:	|               31 d2                	xor    %edx,%edx
+    s->busy_ = 0;
+    230e:	|               31 c9                	xor    %ecx,%ecx
+    pthread_mutex_init(&s->run_lock_, nullptr);
+    2310:	|               31 f6                	xor    %esi,%esi
+    s->next_ = 0;
+    2312:	|               48 89 90 e0 00 00 00 	mov    %rdx,0xe0(%rax)
+    Shared *const s = static_cast<Shared *>(rs.unwrap());
+    2319:	|               49 89 c4             	mov    %rax,%r12
+    pthread_mutex_init(&s->run_lock_, nullptr);
+    231c:	|               48 8d 78 18          	lea    0x18(%rax),%rdi
+    s->next_ = 0;
+    2320:	|               48 89 90 e8 00 00 00 	mov    %rdx,0xe8(%rax)
+    2327:	|               48 89 90 f0 00 00 00 	mov    %rdx,0xf0(%rax)
+    232e:	|               48 89 90 f8 00 00 00 	mov    %rdx,0xf8(%rax)
+    s->busy_ = 0;
+    2335:	|               48 89 48 08          	mov    %rcx,0x8(%rax)
+    2339:	|               48 89 48 10          	mov    %rcx,0x10(%rax)
+    233d:	|               48 89 88 c8 00 00 00 	mov    %rcx,0xc8(%rax)
+    2344:	|               48 89 88 d0 00 00 00 	mov    %rcx,0xd0(%rax)
+    s->n_threads_ = n_threads;
+    234b:	|               48 89 28             	mov    %rbp,(%rax)
+    s->failed_ = false;
+    234e:	|               c6 80 00 01 00 00 00 	movb   $0x0,0x100(%rax)
+    s->stop_ = false;
+    2355:	|               c6 80 d8 00 00 00 00 	movb   $0x0,0xd8(%rax)
+    pthread_mutex_init(&s->run_lock_, nullptr);
+    235c:	|               e8 0f ee ff ff       	call   1170 <pthread_mutex_init@plt>
+    pthread_mutex_init(&s->lock_, nullptr);
+    2361:	|               49 8d 7c 24 40       	lea    0x40(%r12),%rdi
+    2366:	|               31 f6                	xor    %esi,%esi
+    2368:	|               e8 03 ee ff ff       	call   1170 <pthread_mutex_init@plt>
+    pthread_cond_init(&s->wake_, nullptr);
+    236d:	|               49 8d 7c 24 68       	lea    0x68(%r12),%rdi
+    2372:	|               31 f6                	xor    %esi,%esi
+    2374:	|               e8 67 ed ff ff       	call   10e0 <pthread_cond_init@plt>
+    pthread_cond_init(&s->idle_, nullptr);
+    2379:	|               49 8d bc 24 98 00 00 	lea    0x98(%r12),%rdi
+    2380:	|               00 
+    2381:	|               31 f6                	xor    %esi,%esi
+    2383:	|               e8 58 ed ff ff       	call   10e0 <pthread_cond_init@plt>
+            : shared_(s)
+    2388:	|               4c 89 64 24 10       	mov    %r12,0x10(%rsp)
+    if (n_threads > 1) {
+    238d:	|               48 83 fd 01          	cmp    $0x1,%rbp
+    2391:	|     /-------- 0f 86 90 00 00 00    	jbe    2427 <nel::par::Pool::try_new(unsigned long)+0x1d9>
+        auto rw = Alloc::try_malloc(alignof(pthread_t), (n_threads - 1) * sizeof(pthread_t));
+    2397:	|     |         4a 8d 3c ed 00 00 00 	lea    0x0(,%r13,8),%rdi
+    239e:	|     |         00 
+                                    : std::realloc(p, new_size);
+    239f:	|     |         e8 5c ed ff ff       	call   1100 <malloc@plt>
+            if (new_p == nullptr) {
+    23a4:	|     |         48 85 c0             	test   %rax,%rax
+    23a7:	|     |  /----- 75 12                	jne    23bb <nel::par::Pool::try_new(unsigned long)+0x16d>
+    23a9:	|     |  |      c7 44 24 28 02 00 00 	movl   $0x2,0x28(%rsp)
+    23b0:	|     |  |      00 
+    23b1:	|     |  |      c7 44 24 30 01 00 00 	movl   $0x1,0x30(%rsp)
+    23b8:	|     |  |      00 
+    23b9:	|     |  |  /-- eb 0d                	jmp    23c8 <nel::par::Pool::try_new(unsigned long)+0x17a>
+            : tag_(Tag::OK)
+    23bb:	|     |  \--|-> c7 44 24 28 01 00 00 	movl   $0x1,0x28(%rsp)
+    23c2:	|     |     |   00 
+            : value_(forward<Args>(args)...)
+    23c3:	|     |     |   48 89 44 24 30       	mov    %rax,0x30(%rsp)
+        if (rw.is_err()) { return Result<Pool, ParError>::Err(ParError::OutOfMemory); }
+    23c8:	|     |     \-> 8b 7c 24 28          	mov    0x28(%rsp),%edi
+    23cc:	|     |         48 8b 34 24          	mov    (%rsp),%rsi
+            : fn_name_(fn_name)
+    23d0:	|     |         4c 89 7c 24 38       	mov    %r15,0x38(%rsp)
+            , file_name_(file_name)
+    23d5:	|     |         4c 89 74 24 40       	mov    %r14,0x40(%rsp)
+            , line_num_(line_num)
+    23da:	|     |         c7 44 24 48 bb 00 00 	movl   $0xbb,0x48(%rsp)
+    23e1:	|     |         00 
+    23e2:	|     |         e8 b5 fb ff ff       	call   1f9c <nel::Result<void*, nel::heaped::AllocError>::is_err(nel::Context const&) const [clone .isra.0]>
+    23e7:	|     |         48 8d 7c 24 28       	lea    0x28(%rsp),%rdi
+    23ec:	|     |         84 c0                	test   %al,%al
+    23ee:	|     |     /-- 74 14                	je     2404 <nel::par::Pool::try_new(unsigned long)+0x1b6>
+            : tag_(Tag::ERR)
+    23f0:	|     |     |   c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+            : value_(forward<Type>(val))
+    23f6:	|     |     |   c7 43 08 03 00 00 00 	movl   $0x3,0x8(%rbx)
+    }
+    23fd:	|     |     |   e8 dc 00 00 00       	call   24de <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+    2402:	|  /--|-----|-- eb 75                	jmp    2479 <nel::par::Pool::try_new(unsigned long)+0x22b>
+        s->workers_ = static_cast<pthread_t *>(rw.unwrap());
+    2404:	|  |  |     \-> 48 8b 34 24          	mov    (%rsp),%rsi
+    2408:	|  |  |         c7 44 24 48 bc 00 00 	movl   $0xbc,0x48(%rsp)
+    240f:	|  |  |         00 
+    2410:	|  |  |         48 89 3c 24          	mov    %rdi,(%rsp)
+    2414:	|  |  |         e8 87 00 00 00       	call   24a0 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+    }
+    2419:	|  |  |         48 8b 3c 24          	mov    (%rsp),%rdi
+        s->workers_ = static_cast<pthread_t *>(rw.unwrap());
+    241d:	|  |  |         49 89 44 24 10       	mov    %rax,0x10(%r12)
+    }
+    2422:	|  |  |         e8 b7 00 00 00       	call   24de <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+{
+    2427:	|  |  \-------> 31 ed                	xor    %ebp,%ebp
+        if (pthread_create(&s->workers_[i], nullptr, worker_main, s) != 0) {
+    2429:	|  |            4c 8d 35 ab fa ff ff 	lea    -0x555(%rip),%r14        # 1edb <nel::par::(anonymous namespace)::worker_main(void*)>
+    for (Index i = 0; i < n_threads - 1; ++i) {
+    2430:	|  |  /-------> 4c 39 ed             	cmp    %r13,%rbp
+    2433:	|  |  |  /----- 73 33                	jae    2468 <nel::par::Pool::try_new(unsigned long)+0x21a>
+        if (pthread_create(&s->workers_[i], nullptr, worker_main, s) != 0) {
+    2435:	|  |  |  |      49 8b 44 24 10       	mov    0x10(%r12),%rax
+    243a:	|  |  |  |      31 f6                	xor    %esi,%esi
+    243c:	|  |  |  |      4c 89 e1             	mov    %r12,%rcx
+    243f:	|  |  |  |      4c 89 f2             	mov    %r14,%rdx
+    2442:	|  |  |  |      48 8d 3c e8          	lea    (%rax,%rbp,8),%rdi
+    2446:	|  |  |  |      e8 d5 ec ff ff       	call   1120 <pthread_create@plt>
+    244b:	|  |  |  |      85 c0                	test   %eax,%eax
+    244d:	|  |  |  |  /-- 74 0f                	je     245e <nel::par::Pool::try_new(unsigned long)+0x210>
+    244f:	|  |  |  |  |   c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+    2455:	|  |  |  |  |   c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    245c:	|  +--|--|--|-- eb 1b                	jmp    2479 <nel::par::Pool::try_new(unsigned long)+0x22b>
+        s->n_workers_ += 1;
+    245e:	|  |  |  |  \-> 49 ff 44 24 08       	incq   0x8(%r12)
+    for (Index i = 0; i < n_threads - 1; ++i) {
+    2463:	|  |  |  |      48 ff c5             	inc    %rbp
+    2466:	|  |  \--|----- eb c8                	jmp    2430 <nel::par::Pool::try_new(unsigned long)+0x1e2>
+            o.shared_ = nullptr;
+    2468:	|  |     \----> 31 c0                	xor    %eax,%eax
+            : tag_(Tag::OK)
+    246a:	|  |            c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+            : shared_(o.shared_)
+    2470:	|  |            4c 89 63 08          	mov    %r12,0x8(%rbx)
+            o.shared_ = nullptr;
+    2474:	|  |            48 89 44 24 10       	mov    %rax,0x10(%rsp)
+}
+    2479:	|  \----------> 48 8d 7c 24 10       	lea    0x10(%rsp),%rdi
+    247e:	|               e8 45 fb ff ff       	call   1fc8 <nel::par::Pool::~Pool()>
+    2483:	\-------------> 48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    2488:	                e8 51 00 00 00       	call   24de <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+    248d:	                48 83 c4 58          	add    $0x58,%rsp
+    2491:	                48 89 d8             	mov    %rbx,%rax
+    2494:	                5b                   	pop    %rbx
+    2495:	                5d                   	pop    %rbp
+    2496:	                41 5c                	pop    %r12
+    2498:	                41 5d                	pop    %r13
+    249a:	                41 5e                	pop    %r14
+    249c:	                41 5f                	pop    %r15
+    249e:	                c3                   	ret
+    249f:	                90                   	nop
+
+00000000000024a0 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>:
+            auto tag = tag_;
+    24a0:	          8b 07                	mov    (%rdi),%eax
+            tag_ = Tag::INVAL;
+    24a2:	          31 c9                	xor    %ecx,%ecx
+    24a4:	          89 0f                	mov    %ecx,(%rdi)
+            switch (tag) { // result-consume
+    24a6:	          83 f8 01             	cmp    $0x1,%eax
+    24a9:	/-------- 74 2e                	je     24d9 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)+0x39>
+        constexpr T unwrap(Context const &ctx = Context())
+    24ab:	|         52                   	push   %rdx
+            switch (tag) { // result-consume
+    24ac:	|         83 f8 02             	cmp    $0x2,%eax
+    24af:	|     /-- 74 10                	je     24c1 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)+0x21>
+    24b1:	|     |   85 c0                	test   %eax,%eax
+    24b3:	|  /--|-- 75 18                	jne    24cd <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)+0x2d>
+                    nel::panic("invalid Result", ctx);
+    24b5:	|  |  |   48 8d 3d 5f 0c 00 00 	lea    0xc5f(%rip),%rdi        # 311b <_IO_stdin_used+0x11b>
+    24bc:	|  |  |   e8 11 ed ff ff       	call   11d2 <nel::panic(char const*, nel::Context const&)>
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    24c1:	|  |  \-> 48 8d 3d 3e 0d 00 00 	lea    0xd3e(%rip),%rdi        # 3206 <_IO_stdin_used+0x206>
+    24c8:	|  |      e8 05 ed ff ff       	call   11d2 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    24cd:	|  \----> 48 8d 3d 56 0c 00 00 	lea    0xc56(%rip),%rdi        # 312a <_IO_stdin_used+0x12a>
+    24d4:	|         e8 f9 ec ff ff       	call   11d2 <nel::panic(char const*, nel::Context const&)>
+                              ctx);
+    24d9:	\-------> 48 8b 47 08          	mov    0x8(%rdi),%rax
+        }
+    24dd:	          c3                   	ret
+
+00000000000024de <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+            switch (tag_) { // result::dtor
+    24de:	    83 3f 02             	cmpl   $0x2,(%rdi)
+    24e1:	/-- 76 35                	jbe    2518 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x3a>
+        constexpr ~Result(void)
+    24e3:	|   48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    24e7:	|   48 8d 05 c5 0d 00 00 	lea    0xdc5(%rip),%rax        # 32b3 <_IO_stdin_used+0x2b3>
+                    nel::panic("bad Result");
+    24ee:	|   48 8d 3d 35 0c 00 00 	lea    0xc35(%rip),%rdi        # 312a <_IO_stdin_used+0x12a>
+    24f5:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    24fa:	|   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    24ff:	|   48 8d 05 f9 0b 00 00 	lea    0xbf9(%rip),%rax        # 30ff <_IO_stdin_used+0xff>
+    2506:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    250b:	|   c7 44 24 18 72 00 00 	movl   $0x72,0x18(%rsp)
+    2512:	|   00 
+    2513:	|   e8 ba ec ff ff       	call   11d2 <nel::panic(char const*, nel::Context const&)>
+    2518:	\-> c3                   	ret
+
+Disassembly of section .fini:
+
+000000000000251c <_fini>:
+    251c:	48 83 ec 08          	sub    $0x8,%rsp
+    2520:	48 83 c4 08          	add    $0x8,%rsp
+    2524:	c3                   	ret
@@ -0,0 +1,562 @@
+
+target/minsize/examples/iterator:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <fputs@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <fputs@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <fputs@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <fputc@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <fputc@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fprintf@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <fprintf@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+0000000000001060 <__cxa_finalize@plt>:
+    1060:	ff 25 7a 2f 00 00    	jmp    *0x2f7a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1066:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+0000000000001070 <main>:
+    do6(a1.iter());
+#endif
+}
+
+int main()
+{
+    1070:	53                   	push   %rbx
+    nel::log << "ex1:b" << '\n';
+    1071:	48 8d 1d d1 2f 00 00 	lea    0x2fd1(%rip),%rbx        # 4049 <nel::log>
+    1078:	48 8d 35 85 0f 00 00 	lea    0xf85(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    107f:	48 89 df             	mov    %rbx,%rdi
+    1082:	e8 fa 02 00 00       	call   1381 <nel::operator<<(nel::Log&, char const*)>
+    1087:	be 0a 00 00 00       	mov    $0xa,%esi
+    108c:	48 89 c7             	mov    %rax,%rdi
+    108f:	e8 d4 02 00 00       	call   1368 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    1094:	e8 20 02 00 00       	call   12b9 <ex1()>
+    nel::log << "ex1:e" << '\n';
+    1099:	48 89 df             	mov    %rbx,%rdi
+    109c:	48 8d 35 67 0f 00 00 	lea    0xf67(%rip),%rsi        # 200a <_IO_stdin_used+0xa>
+    10a3:	e8 d9 02 00 00       	call   1381 <nel::operator<<(nel::Log&, char const*)>
+    10a8:	be 0a 00 00 00       	mov    $0xa,%esi
+    10ad:	48 89 c7             	mov    %rax,%rdi
+    10b0:	e8 b3 02 00 00       	call   1368 <nel::operator<<(nel::Log&, char)>
+}
+    10b5:	31 c0                	xor    %eax,%eax
+    10b7:	5b                   	pop    %rbx
+    10b8:	c3                   	ret
+    10b9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000010c0 <_start>:
+    10c0:	31 ed                	xor    %ebp,%ebp
+    10c2:	49 89 d1             	mov    %rdx,%r9
+    10c5:	5e                   	pop    %rsi
+    10c6:	48 89 e2             	mov    %rsp,%rdx
+    10c9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    10cd:	50                   	push   %rax
+    10ce:	54                   	push   %rsp
+    10cf:	45 31 c0             	xor    %r8d,%r8d
+    10d2:	31 c9                	xor    %ecx,%ecx
+    10d4:	48 8d 3d 95 ff ff ff 	lea    -0x6b(%rip),%rdi        # 1070 <main>
+    10db:	ff 15 df 2e 00 00    	call   *0x2edf(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    10e1:	f4                   	hlt
+    10e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    10e9:	00 00 00 
+    10ec:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000010f0 <deregister_tm_clones>:
+    10f0:	    48 8d 3d 31 2f 00 00 	lea    0x2f31(%rip),%rdi        # 4028 <__TMC_END__>
+    10f7:	    48 8d 05 2a 2f 00 00 	lea    0x2f2a(%rip),%rax        # 4028 <__TMC_END__>
+    10fe:	    48 39 f8             	cmp    %rdi,%rax
+    1101:	/-- 74 15                	je     1118 <deregister_tm_clones+0x28>
+    1103:	|   48 8b 05 be 2e 00 00 	mov    0x2ebe(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    110a:	|   48 85 c0             	test   %rax,%rax
+    110d:	+-- 74 09                	je     1118 <deregister_tm_clones+0x28>
+    110f:	|   ff e0                	jmp    *%rax
+    1111:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1118:	\-> c3                   	ret
+    1119:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001120 <register_tm_clones>:
+    1120:	    48 8d 3d 01 2f 00 00 	lea    0x2f01(%rip),%rdi        # 4028 <__TMC_END__>
+    1127:	    48 8d 35 fa 2e 00 00 	lea    0x2efa(%rip),%rsi        # 4028 <__TMC_END__>
+    112e:	    48 29 fe             	sub    %rdi,%rsi
+    1131:	    48 89 f0             	mov    %rsi,%rax
+    1134:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1138:	    48 c1 f8 03          	sar    $0x3,%rax
+    113c:	    48 01 c6             	add    %rax,%rsi
+    113f:	    48 d1 fe             	sar    %rsi
+    1142:	/-- 74 14                	je     1158 <register_tm_clones+0x38>
+    1144:	|   48 8b 05 8d 2e 00 00 	mov    0x2e8d(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    114b:	|   48 85 c0             	test   %rax,%rax
+    114e:	+-- 74 08                	je     1158 <register_tm_clones+0x38>
+    1150:	|   ff e0                	jmp    *%rax
+    1152:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1158:	\-> c3                   	ret
+    1159:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001160 <__do_global_dtors_aux>:
+    1160:	       f3 0f 1e fa          	endbr64
+    1164:	       80 3d dd 2e 00 00 00 	cmpb   $0x0,0x2edd(%rip)        # 4048 <completed.0>
+    116b:	/----- 75 2b                	jne    1198 <__do_global_dtors_aux+0x38>
+    116d:	|      55                   	push   %rbp
+    116e:	|      48 83 3d 6a 2e 00 00 	cmpq   $0x0,0x2e6a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1175:	|      00 
+    1176:	|      48 89 e5             	mov    %rsp,%rbp
+    1179:	|  /-- 74 0c                	je     1187 <__do_global_dtors_aux+0x27>
+    117b:	|  |   48 8b 3d 9e 2e 00 00 	mov    0x2e9e(%rip),%rdi        # 4020 <__dso_handle>
+    1182:	|  |   e8 d9 fe ff ff       	call   1060 <__cxa_finalize@plt>
+    1187:	|  \-> e8 64 ff ff ff       	call   10f0 <deregister_tm_clones>
+    118c:	|      c6 05 b5 2e 00 00 01 	movb   $0x1,0x2eb5(%rip)        # 4048 <completed.0>
+    1193:	|      5d                   	pop    %rbp
+    1194:	|      c3                   	ret
+    1195:	|      0f 1f 00             	nopl   (%rax)
+    1198:	\----> c3                   	ret
+    1199:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011a0 <frame_dummy>:
+    11a0:	f3 0f 1e fa          	endbr64
+    11a4:	e9 77 ff ff ff       	jmp    1120 <register_tm_clones>
+
+00000000000011a9 <_close_r>:
+
+    11a9:	83 c8 ff             	or     $0xffffffff,%eax
+    11ac:	c3                   	ret
+
+00000000000011ad <_fstat_r>:
+#include <nel/log.hh>
+    11ad:	83 c8 ff             	or     $0xffffffff,%eax
+    11b0:	c3                   	ret
+
+00000000000011b1 <_kill_r>:
+
+    11b1:	83 c8 ff             	or     $0xffffffff,%eax
+    11b4:	c3                   	ret
+
+00000000000011b5 <_lseek_r>:
+    it.for_each([&](int const &e) { nel::log << e << ','; });
+    11b5:	83 c8 ff             	or     $0xffffffff,%eax
+    11b8:	c3                   	ret
+
+00000000000011b9 <_read_r>:
+}
+    11b9:	83 c8 ff             	or     $0xffffffff,%eax
+    11bc:	c3                   	ret
+
+00000000000011bd <_write_r>:
+    it.for_each2([&](int const &e) { nel::log << e << ','; });
+    11bd:	83 c8 ff             	or     $0xffffffff,%eax
+    11c0:	c3                   	ret
+
+00000000000011c1 <_getpid_r>:
+
+    11c1:	83 c8 ff             	or     $0xffffffff,%eax
+    11c4:	c3                   	ret
+
+00000000000011c5 <_isatty_r>:
+void do3(nel::Slice<int>::Iterator &&it)
+    11c5:	83 c8 ff             	or     $0xffffffff,%eax
+    11c8:	c3                   	ret
+
+00000000000011c9 <do1(nel::SliceIterator<int>&&)>:
+{
+    11c9:	       55                   	push   %rbp
+    it.for_each([&](int const &e) { nel::log << e << ','; });
+    11ca:	       48 8d 2d 78 2e 00 00 	lea    0x2e78(%rip),%rbp        # 4049 <nel::log>
+{
+    11d1:	       53                   	push   %rbx
+    11d2:	       48 89 fb             	mov    %rdi,%rbx
+    11d5:	       52                   	push   %rdx
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return (b_ == e_);
+    11d6:	/----> 48 8b 03             	mov    (%rbx),%rax
+        template<typename F>
+        void for_each2(F &&fn)
+#        endif
+        {
+#        if 1
+            for (; !self().is_done(); self().inc()) {
+    11d9:	|      48 3b 43 08          	cmp    0x8(%rbx),%rax
+    11dd:	|  /-- 74 1d                	je     11fc <do1(nel::SliceIterator<int>&&)+0x33>
+    it.for_each([&](int const &e) { nel::log << e << ','; });
+    11df:	|  |   8b 30                	mov    (%rax),%esi
+    11e1:	|  |   48 89 ef             	mov    %rbp,%rdi
+    11e4:	|  |   e8 13 02 00 00       	call   13fc <nel::operator<<(nel::Log&, int)>
+    11e9:	|  |   be 2c 00 00 00       	mov    $0x2c,%esi
+    11ee:	|  |   48 89 c7             	mov    %rax,%rdi
+    11f1:	|  |   e8 72 01 00 00       	call   1368 <nel::operator<<(nel::Log&, char)>
+        }
+
+        void inc(void)
+        {
+            ++b_;
+    11f6:	|  |   48 83 03 04          	addq   $0x4,(%rbx)
+        }
+    11fa:	\--|-- eb da                	jmp    11d6 <do1(nel::SliceIterator<int>&&)+0xd>
+}
+    11fc:	   \-> 58                   	pop    %rax
+    11fd:	       5b                   	pop    %rbx
+    11fe:	       5d                   	pop    %rbp
+    11ff:	       c3                   	ret
+
+0000000000001200 <do3(nel::SliceIterator<int>&&)>:
+{
+    1200:	       55                   	push   %rbp
+            o.e_ = nullptr;
+    1201:	       31 d2                	xor    %edx,%edx
+        Length const limit_;
+
+    public:
+        constexpr FirstNIterator(It &&inner, Length limit)
+            : inner_(move(inner))
+            , current_(0)
+    1203:	       31 c9                	xor    %ecx,%ecx
+    it.for_each([&](int const &e) { nel::log << e << ','; });
+    1205:	       48 8d 2d 3d 2e 00 00 	lea    0x2e3d(%rip),%rbp        # 4049 <nel::log>
+{
+    120c:	       53                   	push   %rbx
+    120d:	       48 83 ec 38          	sub    $0x38,%rsp
+            : b_(move(o.b_))
+    1211:	       48 8b 07             	mov    (%rdi),%rax
+            , e_(move(o.e_))
+    1214:	       48 8b 5f 08          	mov    0x8(%rdi),%rbx
+            o.e_ = nullptr;
+    1218:	       48 89 17             	mov    %rdx,(%rdi)
+    121b:	       48 89 57 08          	mov    %rdx,0x8(%rdi)
+            : b_(move(o.b_))
+    121f:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1224:	       48 89 4c 24 20       	mov    %rcx,0x20(%rsp)
+            return (b_ == e_);
+    1229:	/----> 48 8b 44 24 08       	mov    0x8(%rsp),%rax
+            while (!self().is_done()) {
+    122e:	|      48 39 c3             	cmp    %rax,%rbx
+    1231:	|  /-- 74 34                	je     1267 <do3(nel::SliceIterator<int>&&)+0x67>
+    it.template map<int>([](int const &e) -> int { return e * 100; })
+    1233:	|  |   6b 30 64             	imul   $0x64,(%rax),%esi
+            ++b_;
+    1236:	|  |   48 8d 50 04          	lea    0x4(%rax),%rdx
+    it.for_each([&](int const &e) { nel::log << e << ','; });
+    123a:	|  |   48 89 ef             	mov    %rbp,%rdi
+    123d:	|  |   48 89 54 24 08       	mov    %rdx,0x8(%rsp)
+    1242:	|  |   e8 b5 01 00 00       	call   13fc <nel::operator<<(nel::Log&, int)>
+    1247:	|  |   be 2c 00 00 00       	mov    $0x2c,%esi
+    124c:	|  |   48 89 c7             	mov    %rax,%rdi
+    124f:	|  |   e8 14 01 00 00       	call   1368 <nel::operator<<(nel::Log&, char)>
+        {
+            if (current_ >= limit_) { return; }
+            bool unused = true;
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+                fn(e);
+                return ++current_ < limit_;
+    1254:	|  |   48 8b 44 24 20       	mov    0x20(%rsp),%rax
+    1259:	|  |   48 ff c0             	inc    %rax
+    125c:	|  |   48 89 44 24 20       	mov    %rax,0x20(%rsp)
+                if (!fn(acc, forward<OutT>(e))) { return false; }
+    1261:	|  |   48 83 f8 03          	cmp    $0x3,%rax
+    1265:	\--|-- 76 c2                	jbe    1229 <do3(nel::SliceIterator<int>&&)+0x29>
+}
+    1267:	   \-> 48 83 c4 38          	add    $0x38,%rsp
+    126b:	       5b                   	pop    %rbx
+    126c:	       5d                   	pop    %rbp
+    126d:	       c3                   	ret
+
+000000000000126e <do5(nel::SliceIterator<int>&&)>:
+            : b_(move(o.b_))
+    126e:	       48 8b 07             	mov    (%rdi),%rax
+            o.e_ = nullptr;
+    1271:	       31 d2                	xor    %edx,%edx
+            , e_(move(o.e_))
+    1273:	       48 8b 4f 08          	mov    0x8(%rdi),%rcx
+            o.e_ = nullptr;
+    1277:	       be 0a 00 00 00       	mov    $0xa,%esi
+    127c:	       48 89 17             	mov    %rdx,(%rdi)
+    127f:	       48 89 57 08          	mov    %rdx,0x8(%rdi)
+        bool try_fold(U &acc, F &&fn)
+    1283:	       48 8d b8 40 06 00 00 	lea    0x640(%rax),%rdi
+    128a:	       31 d2                	xor    %edx,%edx
+            while (!self().is_done()) {
+    128c:	   /-> 48 39 c1             	cmp    %rax,%rcx
+    128f:	/--|-- 74 12                	je     12a3 <do5(nel::SliceIterator<int>&&)+0x35>
+    int v = it.template map<int>([](int const &e) -> int { return e * 100; })
+    1291:	|  |   6b 10 64             	imul   $0x64,(%rax),%edx
+                if (!fn(acc, forward<OutT>(e))) { return false; }
+    1294:	|  |   48 83 c0 04          	add    $0x4,%rax
+                .fold(10, [&](int &acc, int &e) { acc += e; });
+    1298:	|  |   01 d6                	add    %edx,%esi
+    129a:	|  |   b2 01                	mov    $0x1,%dl
+    129c:	|  |   48 39 f8             	cmp    %rdi,%rax
+    129f:	|  \-- 75 eb                	jne    128c <do5(nel::SliceIterator<int>&&)+0x1e>
+    12a1:	|  /-- eb 0a                	jmp    12ad <do5(nel::SliceIterator<int>&&)+0x3f>
+            U acc = move(initial);
+    12a3:	\--|-> 84 d2                	test   %dl,%dl
+    12a5:	   |   b8 0a 00 00 00       	mov    $0xa,%eax
+    12aa:	   |   0f 44 f0             	cmove  %eax,%esi
+    nel::log << v;
+    12ad:	   \-> 48 8d 3d 95 2d 00 00 	lea    0x2d95(%rip),%rdi        # 4049 <nel::log>
+    12b4:	       e9 43 01 00 00       	jmp    13fc <nel::operator<<(nel::Log&, int)>
+
+00000000000012b9 <ex1()>:
+{
+    12b9:	       55                   	push   %rbp
+
+        // default ctor is safe, will always succeed.
+        // and is fast.
+        // if sizeof(T) or N is large will just eat ram.
+        constexpr Vector(void)
+            : len_(0)
+    12ba:	       31 c0                	xor    %eax,%eax
+    12bc:	       53                   	push   %rbx
+    12bd:	       48 81 ec c8 0f 00 00 	sub    $0xfc8,%rsp
+    a1.iter().for_each([&](int &e) {
+    12c4:	       48 8d 5c 24 08       	lea    0x8(%rsp),%rbx
+    12c9:	       48 8d 6c 24 18       	lea    0x18(%rsp),%rbp
+    12ce:	       48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    12d3:	       48 89 ee             	mov    %rbp,%rsi
+    12d6:	       48 89 df             	mov    %rbx,%rdi
+    12d9:	       e8 74 00 00 00       	call   1352 <nel::heapless::Vector<int, 1000ul>::iter()>
+        void for_each(F &&fn)
+    12de:	       48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    12e3:	       48 8b 54 24 10       	mov    0x10(%rsp),%rdx
+    float v = 23;
+    12e8:	       f3 0f 10 05 20 0d 00 	movss  0xd20(%rip),%xmm0        # 2010 <_IO_stdin_used+0x10>
+    12ef:	       00 
+        v += 34;
+    12f0:	       f3 0f 10 0d 1c 0d 00 	movss  0xd1c(%rip),%xmm1        # 2014 <_IO_stdin_used+0x14>
+    12f7:	       00 
+            for (; !self().is_done(); self().inc()) {
+    12f8:	/----> 48 39 d0             	cmp    %rdx,%rax
+    12fb:	|  /-- 74 11                	je     130e <ex1()+0x55>
+        e = v;
+    12fd:	|  |   f3 0f 2c c8          	cvttss2si %xmm0,%ecx
+    1301:	|  |   48 83 c0 04          	add    $0x4,%rax
+        v += 34;
+    1305:	|  |   f3 0f 58 c1          	addss  %xmm1,%xmm0
+        e = v;
+    1309:	|  |   89 48 fc             	mov    %ecx,-0x4(%rax)
+        }
+    130c:	\--|-- eb ea                	jmp    12f8 <ex1()+0x3f>
+    do1(a1.iter());
+    130e:	   \-> 48 89 ee             	mov    %rbp,%rsi
+    1311:	       48 89 df             	mov    %rbx,%rdi
+    1314:	       e8 39 00 00 00       	call   1352 <nel::heapless::Vector<int, 1000ul>::iter()>
+    1319:	       48 89 df             	mov    %rbx,%rdi
+    131c:	       e8 a8 fe ff ff       	call   11c9 <do1(nel::SliceIterator<int>&&)>
+    do3(a1.iter());
+    1321:	       48 89 ee             	mov    %rbp,%rsi
+    1324:	       48 89 df             	mov    %rbx,%rdi
+    1327:	       e8 26 00 00 00       	call   1352 <nel::heapless::Vector<int, 1000ul>::iter()>
+    132c:	       48 89 df             	mov    %rbx,%rdi
+    132f:	       e8 cc fe ff ff       	call   1200 <do3(nel::SliceIterator<int>&&)>
+    do5(a1.iter());
+    1334:	       48 89 ee             	mov    %rbp,%rsi
+    1337:	       48 89 df             	mov    %rbx,%rdi
+    133a:	       e8 13 00 00 00       	call   1352 <nel::heapless::Vector<int, 1000ul>::iter()>
+    133f:	       48 89 df             	mov    %rbx,%rdi
+    1342:	       e8 27 ff ff ff       	call   126e <do5(nel::SliceIterator<int>&&)>
+}
+    1347:	       48 81 c4 c8 0f 00 00 	add    $0xfc8,%rsp
+    134e:	       5b                   	pop    %rbx
+    134f:	       5d                   	pop    %rbp
+    1350:	       c3                   	ret
+    1351:	       90                   	nop
+
+0000000000001352 <nel::heapless::Vector<int, 1000ul>::iter()>:
+         *
+         * @returns the current in use count.
+         */
+        constexpr Length len(void) const
+        {
+            return len_;
+    1352:	48 8b 16             	mov    (%rsi),%rdx
+    public:
+        // only if you know there's a value there..
+        // TODO: must have no bare pointers.. safety feature.
+        constexpr Type *ptr()
+        {
+            return &u_.elem_;
+    1355:	48 83 c6 08          	add    $0x8,%rsi
+         *
+         * iterator is invalidated if array goes out of scope/destroyed.
+         *
+         * @returns The iterator.
+         */
+        constexpr auto iter(void)
+    1359:	48 89 f8             	mov    %rdi,%rax
+            : b_(arr)
+    135c:	48 89 37             	mov    %rsi,(%rdi)
+            , e_(arr + len)
+    135f:	48 8d 14 96          	lea    (%rsi,%rdx,4),%rdx
+    1363:	48 89 57 08          	mov    %rdx,0x8(%rdi)
+        {
+            return slice().iter();
+        }
+    1367:	c3                   	ret
+
+0000000000001368 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1368:	53                   	push   %rbx
+    1369:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    136c:	40 0f be fe          	movsbl %sil,%edi
+    1370:	48 8b 35 c9 2c 00 00 	mov    0x2cc9(%rip),%rsi        # 4040 <stderr@GLIBC_2.2.5>
+    1377:	e8 c4 fc ff ff       	call   1040 <fputc@plt>
+    return outs;
+}
+    137c:	48 89 d8             	mov    %rbx,%rax
+    137f:	5b                   	pop    %rbx
+    1380:	c3                   	ret
+
+0000000000001381 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1381:	53                   	push   %rbx
+    1382:	48 89 fb             	mov    %rdi,%rbx
+    1385:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    1388:	48 8b 35 b1 2c 00 00 	mov    0x2cb1(%rip),%rsi        # 4040 <stderr@GLIBC_2.2.5>
+    138f:	e8 9c fc ff ff       	call   1030 <fputs@plt>
+    return outs;
+}
+    1394:	48 89 d8             	mov    %rbx,%rax
+    1397:	5b                   	pop    %rbx
+    1398:	c3                   	ret
+
+0000000000001399 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1399:	53                   	push   %rbx
+    139a:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    139d:	48 8b 3d 9c 2c 00 00 	mov    0x2c9c(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+    13a4:	40 0f b6 d6          	movzbl %sil,%edx
+    13a8:	31 c0                	xor    %eax,%eax
+    13aa:	48 8d 35 67 0c 00 00 	lea    0xc67(%rip),%rsi        # 2018 <_IO_stdin_used+0x18>
+    13b1:	e8 9a fc ff ff       	call   1050 <fprintf@plt>
+    return outs;
+}
+    13b6:	48 89 d8             	mov    %rbx,%rax
+    13b9:	5b                   	pop    %rbx
+    13ba:	c3                   	ret
+
+00000000000013bb <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    13bb:	53                   	push   %rbx
+    13bc:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    13bf:	48 8b 3d 7a 2c 00 00 	mov    0x2c7a(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+    13c6:	0f b7 d6             	movzwl %si,%edx
+    13c9:	31 c0                	xor    %eax,%eax
+    13cb:	48 8d 35 46 0c 00 00 	lea    0xc46(%rip),%rsi        # 2018 <_IO_stdin_used+0x18>
+    13d2:	e8 79 fc ff ff       	call   1050 <fprintf@plt>
+    return outs;
+}
+    13d7:	48 89 d8             	mov    %rbx,%rax
+    13da:	5b                   	pop    %rbx
+    13db:	c3                   	ret
+
+00000000000013dc <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    13dc:	53                   	push   %rbx
+    13dd:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    13e0:	48 8b 3d 59 2c 00 00 	mov    0x2c59(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+{
+    13e7:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    13e9:	31 c0                	xor    %eax,%eax
+    13eb:	48 8d 35 26 0c 00 00 	lea    0xc26(%rip),%rsi        # 2018 <_IO_stdin_used+0x18>
+    13f2:	e8 59 fc ff ff       	call   1050 <fprintf@plt>
+    return outs;
+}
+    13f7:	48 89 d8             	mov    %rbx,%rax
+    13fa:	5b                   	pop    %rbx
+    13fb:	c3                   	ret
+
+00000000000013fc <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    13fc:	53                   	push   %rbx
+    13fd:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    1400:	48 8b 3d 39 2c 00 00 	mov    0x2c39(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+{
+    1407:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    1409:	31 c0                	xor    %eax,%eax
+    140b:	48 8d 35 06 0c 00 00 	lea    0xc06(%rip),%rsi        # 2018 <_IO_stdin_used+0x18>
+    1412:	e8 39 fc ff ff       	call   1050 <fprintf@plt>
+    return outs;
+}
+    1417:	48 89 d8             	mov    %rbx,%rax
+    141a:	5b                   	pop    %rbx
+    141b:	c3                   	ret
+
+000000000000141c <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    141c:	53                   	push   %rbx
+    141d:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    1420:	48 8b 3d 19 2c 00 00 	mov    0x2c19(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+{
+    1427:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    142a:	31 c0                	xor    %eax,%eax
+    142c:	48 8d 35 e8 0b 00 00 	lea    0xbe8(%rip),%rsi        # 201b <_IO_stdin_used+0x1b>
+    1433:	e8 18 fc ff ff       	call   1050 <fprintf@plt>
+    return outs;
+}
+    1438:	48 89 d8             	mov    %rbx,%rax
+    143b:	5b                   	pop    %rbx
+    143c:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000001440 <_fini>:
+    1440:	48 83 ec 08          	sub    $0x8,%rsp
+    1444:	48 83 c4 08          	add    $0x8,%rsp
+    1448:	c3                   	ret
@@ -0,0 +1,1193 @@
+
+target/minsize/examples/largestruct1_box:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputc@plt>:
+    1060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 4018 <fputc@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <memcmp@plt>:
+    1070:	ff 25 aa 2f 00 00    	jmp    *0x2faa(%rip)        # 4020 <memcmp@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fprintf@plt>:
+    1080:	ff 25 a2 2f 00 00    	jmp    *0x2fa2(%rip)        # 4028 <fprintf@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <malloc@plt>:
+    1090:	ff 25 9a 2f 00 00    	jmp    *0x2f9a(%rip)        # 4030 <malloc@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <realloc@plt>:
+    10a0:	ff 25 92 2f 00 00    	jmp    *0x2f92(%rip)        # 4038 <realloc@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <memmove@plt>:
+    10b0:	ff 25 8a 2f 00 00    	jmp    *0x2f8a(%rip)        # 4040 <memmove@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010c0 <__cxa_finalize@plt>:
+    10c0:	ff 25 1a 2f 00 00    	jmp    *0x2f1a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10c6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010d0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10d0:	50                   	push   %rax
+    std::abort();
+    10d1:	e8 6a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010d6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10d6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10d7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10da:	4c 8d 0d 8f 0f 00 00 	lea    0xf8f(%rip),%r9        # 2070 <_IO_stdin_used+0x70>
+    10e1:	31 c0                	xor    %eax,%eax
+    10e3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10e7:	4c 8b 07             	mov    (%rdi),%r8
+    10ea:	48 8d 35 85 0f 00 00 	lea    0xf85(%rip),%rsi        # 2076 <_IO_stdin_used+0x76>
+    10f1:	48 8b 3d 68 2f 00 00 	mov    0x2f68(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    10f8:	e8 83 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    10fd:	e8 3e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001102 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1102:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1106:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1109:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    110d:	31 c0                	xor    %eax,%eax
+    110f:	57                   	push   %rdi
+    1110:	48 8b 3d 49 2f 00 00 	mov    0x2f49(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1117:	4c 8d 0d 52 0f 00 00 	lea    0xf52(%rip),%r9        # 2070 <_IO_stdin_used+0x70>
+    111e:	4c 8b 06             	mov    (%rsi),%r8
+    1121:	48 8d 35 5f 0f 00 00 	lea    0xf5f(%rip),%rsi        # 2087 <_IO_stdin_used+0x87>
+    1128:	e8 53 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    112d:	e8 0e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001132 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1132:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1136:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1139:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    113d:	31 c0                	xor    %eax,%eax
+    113f:	57                   	push   %rdi
+    1140:	48 8b 3d 19 2f 00 00 	mov    0x2f19(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1147:	4c 8d 0d 4e 0f 00 00 	lea    0xf4e(%rip),%r9        # 209c <_IO_stdin_used+0x9c>
+    114e:	4c 8b 06             	mov    (%rsi),%r8
+    1151:	48 8d 35 2f 0f 00 00 	lea    0xf2f(%rip),%rsi        # 2087 <_IO_stdin_used+0x87>
+    1158:	e8 23 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    115d:	e8 de fe ff ff       	call   1040 <abort@plt>
+
+0000000000001162 <main>:
+    Box1 b = r.unwrap();
+
+    nel::log << b << '\n';
+}
+
+int main() {}
+    1162:	31 c0                	xor    %eax,%eax
+    1164:	c3                   	ret
+    1165:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    116c:	00 00 00 
+    116f:	90                   	nop
+
+0000000000001170 <_start>:
+    1170:	31 ed                	xor    %ebp,%ebp
+    1172:	49 89 d1             	mov    %rdx,%r9
+    1175:	5e                   	pop    %rsi
+    1176:	48 89 e2             	mov    %rsp,%rdx
+    1179:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    117d:	50                   	push   %rax
+    117e:	54                   	push   %rsp
+    117f:	45 31 c0             	xor    %r8d,%r8d
+    1182:	31 c9                	xor    %ecx,%ecx
+    1184:	48 8d 3d d7 ff ff ff 	lea    -0x29(%rip),%rdi        # 1162 <main>
+    118b:	ff 15 2f 2e 00 00    	call   *0x2e2f(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    1191:	f4                   	hlt
+    1192:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1199:	00 00 00 
+    119c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000011a0 <deregister_tm_clones>:
+    11a0:	    48 8d 3d b1 2e 00 00 	lea    0x2eb1(%rip),%rdi        # 4058 <__TMC_END__>
+    11a7:	    48 8d 05 aa 2e 00 00 	lea    0x2eaa(%rip),%rax        # 4058 <__TMC_END__>
+    11ae:	    48 39 f8             	cmp    %rdi,%rax
+    11b1:	/-- 74 15                	je     11c8 <deregister_tm_clones+0x28>
+    11b3:	|   48 8b 05 0e 2e 00 00 	mov    0x2e0e(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    11ba:	|   48 85 c0             	test   %rax,%rax
+    11bd:	+-- 74 09                	je     11c8 <deregister_tm_clones+0x28>
+    11bf:	|   ff e0                	jmp    *%rax
+    11c1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    11c8:	\-> c3                   	ret
+    11c9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011d0 <register_tm_clones>:
+    11d0:	    48 8d 3d 81 2e 00 00 	lea    0x2e81(%rip),%rdi        # 4058 <__TMC_END__>
+    11d7:	    48 8d 35 7a 2e 00 00 	lea    0x2e7a(%rip),%rsi        # 4058 <__TMC_END__>
+    11de:	    48 29 fe             	sub    %rdi,%rsi
+    11e1:	    48 89 f0             	mov    %rsi,%rax
+    11e4:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    11e8:	    48 c1 f8 03          	sar    $0x3,%rax
+    11ec:	    48 01 c6             	add    %rax,%rsi
+    11ef:	    48 d1 fe             	sar    %rsi
+    11f2:	/-- 74 14                	je     1208 <register_tm_clones+0x38>
+    11f4:	|   48 8b 05 dd 2d 00 00 	mov    0x2ddd(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    11fb:	|   48 85 c0             	test   %rax,%rax
+    11fe:	+-- 74 08                	je     1208 <register_tm_clones+0x38>
+    1200:	|   ff e0                	jmp    *%rax
+    1202:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1208:	\-> c3                   	ret
+    1209:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001210 <__do_global_dtors_aux>:
+    1210:	       f3 0f 1e fa          	endbr64
+    1214:	       80 3d 4d 2e 00 00 00 	cmpb   $0x0,0x2e4d(%rip)        # 4068 <completed.0>
+    121b:	/----- 75 2b                	jne    1248 <__do_global_dtors_aux+0x38>
+    121d:	|      55                   	push   %rbp
+    121e:	|      48 83 3d ba 2d 00 00 	cmpq   $0x0,0x2dba(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1225:	|      00 
+    1226:	|      48 89 e5             	mov    %rsp,%rbp
+    1229:	|  /-- 74 0c                	je     1237 <__do_global_dtors_aux+0x27>
+    122b:	|  |   48 8b 3d 1e 2e 00 00 	mov    0x2e1e(%rip),%rdi        # 4050 <__dso_handle>
+    1232:	|  |   e8 89 fe ff ff       	call   10c0 <__cxa_finalize@plt>
+    1237:	|  \-> e8 64 ff ff ff       	call   11a0 <deregister_tm_clones>
+    123c:	|      c6 05 25 2e 00 00 01 	movb   $0x1,0x2e25(%rip)        # 4068 <completed.0>
+    1243:	|      5d                   	pop    %rbp
+    1244:	|      c3                   	ret
+    1245:	|      0f 1f 00             	nopl   (%rax)
+    1248:	\----> c3                   	ret
+    1249:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001250 <frame_dummy>:
+    1250:	f3 0f 1e fa          	endbr64
+    1254:	e9 77 ff ff ff       	jmp    11d0 <register_tm_clones>
+
+0000000000001259 <_close_r>:
+#include <nel/defs.hh>
+    1259:	83 c8 ff             	or     $0xffffffff,%eax
+    125c:	c3                   	ret
+
+000000000000125d <_fstat_r>:
+typedef nel::heaped::Box<U8Buf<256>> Box1;
+    125d:	83 c8 ff             	or     $0xffffffff,%eax
+    1260:	c3                   	ret
+
+0000000000001261 <_kill_r>:
+{
+    1261:	83 c8 ff             	or     $0xffffffff,%eax
+    1264:	c3                   	ret
+
+0000000000001265 <_lseek_r>:
+    return outs;
+    1265:	83 c8 ff             	or     $0xffffffff,%eax
+    1268:	c3                   	ret
+
+0000000000001269 <_read_r>:
+}
+    1269:	83 c8 ff             	or     $0xffffffff,%eax
+    126c:	c3                   	ret
+
+000000000000126d <_write_r>:
+    auto r = Box1::try_from(nel::move(v));
+    126d:	83 c8 ff             	or     $0xffffffff,%eax
+    1270:	c3                   	ret
+
+0000000000001271 <_getpid_r>:
+    nel::log << b << '\n';
+    1271:	83 c8 ff             	or     $0xffffffff,%eax
+    1274:	c3                   	ret
+
+0000000000001275 <_isatty_r>:
+}
+    1275:	83 c8 ff             	or     $0xffffffff,%eax
+    1278:	c3                   	ret
+
+0000000000001279 <operator<<(nel::Log&, nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> const&)>:
+{
+    1279:	53                   	push   %rbx
+    outs << "Box1()";
+    127a:	48 8d 35 83 0d 00 00 	lea    0xd83(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+{
+    1281:	48 89 fb             	mov    %rdi,%rbx
+    outs << "Box1()";
+    1284:	e8 59 05 00 00       	call   17e2 <nel::operator<<(nel::Log&, char const*)>
+}
+    1289:	48 89 d8             	mov    %rbx,%rax
+    128c:	5b                   	pop    %rbx
+    128d:	c3                   	ret
+
+000000000000128e <box1()>:
+{
+    128e:	41 55                	push   %r13
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+        {
+            nel::elem::set(data_, f, N);
+    1290:	ba 00 01 00 00       	mov    $0x100,%edx
+    1295:	be 66 00 00 00       	mov    $0x66,%esi
+    outs << "Box1()";
+    129a:	4c 8d 2d c8 2d 00 00 	lea    0x2dc8(%rip),%r13        # 4069 <nel::log>
+{
+    12a1:	41 54                	push   %r12
+    12a3:	55                   	push   %rbp
+    12a4:	53                   	push   %rbx
+    12a5:	48 81 ec 38 02 00 00 	sub    $0x238,%rsp
+    12ac:	48 8d 5c 24 28       	lea    0x28(%rsp),%rbx
+    auto r = Box1::try_from(nel::move(v));
+    12b1:	48 8d ac 24 28 01 00 	lea    0x128(%rsp),%rbp
+    12b8:	00 
+    12b9:	48 89 df             	mov    %rbx,%rdi
+    Box1 b = r.unwrap();
+    12bc:	4c 8d 64 24 08       	lea    0x8(%rsp),%r12
+    12c1:	e8 84 02 00 00       	call   154a <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    auto r = Box1::try_from(nel::move(v));
+    12c6:	48 89 de             	mov    %rbx,%rsi
+    12c9:	48 89 ef             	mov    %rbp,%rdi
+    12cc:	e8 b7 01 00 00       	call   1488 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::try_from(U8Buf<256ul>&&)>
+    Box1 b = r.unwrap();
+    12d1:	48 8d 54 24 10       	lea    0x10(%rsp),%rdx
+    12d6:	48 89 ee             	mov    %rbp,%rsi
+    12d9:	4c 89 e7             	mov    %r12,%rdi
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    12dc:	48 8d 05 28 0d 00 00 	lea    0xd28(%rip),%rax        # 200b <_IO_stdin_used+0xb>
+            , file_name_(file_name)
+            , line_num_(line_num)
+    12e3:	c7 44 24 20 16 00 00 	movl   $0x16,0x20(%rsp)
+    12ea:	00 
+            : fn_name_(fn_name)
+    12eb:	48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , file_name_(file_name)
+    12f0:	48 8d 05 19 0d 00 00 	lea    0xd19(%rip),%rax        # 2010 <_IO_stdin_used+0x10>
+    12f7:	48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    12fc:	e8 ef 00 00 00       	call   13f0 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)>
+    outs << "Box1()";
+    1301:	4c 89 ef             	mov    %r13,%rdi
+    1304:	48 8d 35 f9 0c 00 00 	lea    0xcf9(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    130b:	e8 d2 04 00 00       	call   17e2 <nel::operator<<(nel::Log&, char const*)>
+    nel::log << b << '\n';
+    1310:	be 0a 00 00 00       	mov    $0xa,%esi
+    1315:	4c 89 ef             	mov    %r13,%rdi
+    1318:	e8 ac 04 00 00       	call   17c9 <nel::operator<<(nel::Log&, char)>
+}
+    131d:	4c 89 e7             	mov    %r12,%rdi
+    1320:	e8 ab 01 00 00       	call   14d0 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::~Box()>
+    1325:	48 89 ef             	mov    %rbp,%rdi
+    1328:	e8 bf 01 00 00       	call   14ec <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::~Result()>
+    132d:	48 89 df             	mov    %rbx,%rdi
+    1330:	e8 0d 01 00 00       	call   1442 <U8Buf<256ul>::~U8Buf()>
+    1335:	48 81 c4 38 02 00 00 	add    $0x238,%rsp
+    133c:	5b                   	pop    %rbx
+    133d:	5d                   	pop    %rbp
+    133e:	41 5c                	pop    %r12
+    1340:	41 5d                	pop    %r13
+    1342:	c3                   	ret
+
+0000000000001343 <box2()>:
+{
+    1343:	41 54                	push   %r12
+    1345:	ba 00 01 00 00       	mov    $0x100,%edx
+    134a:	be 67 00 00 00       	mov    $0x67,%esi
+    134f:	55                   	push   %rbp
+    1350:	53                   	push   %rbx
+    1351:	48 81 ec 10 02 00 00 	sub    $0x210,%rsp
+    1358:	48 8d 5c 24 08       	lea    0x8(%rsp),%rbx
+    auto r = Box1::try_from((uint8_t)0x67);
+    135d:	48 8d ac 24 08 01 00 	lea    0x108(%rsp),%rbp
+    1364:	00 
+    Box1 b = r.unwrap();
+    1365:	49 89 e4             	mov    %rsp,%r12
+    1368:	48 89 df             	mov    %rbx,%rdi
+    136b:	e8 da 01 00 00       	call   154a <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    auto r = Box1::try_from((uint8_t)0x67);
+    1370:	48 89 de             	mov    %rbx,%rsi
+    1373:	48 89 ef             	mov    %rbp,%rdi
+    1376:	e8 0d 01 00 00       	call   1488 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::try_from(U8Buf<256ul>&&)>
+    137b:	48 89 df             	mov    %rbx,%rdi
+    137e:	e8 bf 00 00 00       	call   1442 <U8Buf<256ul>::~U8Buf()>
+    Box1 b = r.unwrap();
+    1383:	48 89 da             	mov    %rbx,%rdx
+    1386:	48 89 ee             	mov    %rbp,%rsi
+    1389:	4c 89 e7             	mov    %r12,%rdi
+            : fn_name_(fn_name)
+    138c:	48 8d 05 9a 0c 00 00 	lea    0xc9a(%rip),%rax        # 202d <_IO_stdin_used+0x2d>
+    outs << "Box1()";
+    1393:	48 8d 1d cf 2c 00 00 	lea    0x2ccf(%rip),%rbx        # 4069 <nel::log>
+            , line_num_(line_num)
+    139a:	c7 44 24 18 1e 00 00 	movl   $0x1e,0x18(%rsp)
+    13a1:	00 
+            : fn_name_(fn_name)
+    13a2:	48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , file_name_(file_name)
+    13a7:	48 8d 05 62 0c 00 00 	lea    0xc62(%rip),%rax        # 2010 <_IO_stdin_used+0x10>
+    13ae:	48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    Box1 b = r.unwrap();
+    13b3:	e8 38 00 00 00       	call   13f0 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)>
+    outs << "Box1()";
+    13b8:	48 89 df             	mov    %rbx,%rdi
+    13bb:	48 8d 35 42 0c 00 00 	lea    0xc42(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    13c2:	e8 1b 04 00 00       	call   17e2 <nel::operator<<(nel::Log&, char const*)>
+    nel::log << b << '\n';
+    13c7:	be 0a 00 00 00       	mov    $0xa,%esi
+    13cc:	48 89 df             	mov    %rbx,%rdi
+    13cf:	e8 f5 03 00 00       	call   17c9 <nel::operator<<(nel::Log&, char)>
+}
+    13d4:	4c 89 e7             	mov    %r12,%rdi
+    13d7:	e8 f4 00 00 00       	call   14d0 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::~Box()>
+    13dc:	48 89 ef             	mov    %rbp,%rdi
+    13df:	e8 08 01 00 00       	call   14ec <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::~Result()>
+    13e4:	48 81 c4 10 02 00 00 	add    $0x210,%rsp
+    13eb:	5b                   	pop    %rbx
+    13ec:	5d                   	pop    %rbp
+    13ed:	41 5c                	pop    %r12
+    13ef:	c3                   	ret
+
+00000000000013f0 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)>:
+         * @return if Ok, value wrapped/contained.
+         * @return if not Ok, calls abort, there is no return.
+         *
+         * `this` is consumed by the operation.
+         */
+        constexpr T unwrap(Context const &ctx = Context())
+    13f0:	          48 89 f1             	mov    %rsi,%rcx
+    13f3:	          48 89 d6             	mov    %rdx,%rsi
+            tag_ = Tag::INVAL;
+    13f6:	          45 31 c0             	xor    %r8d,%r8d
+            auto tag = tag_;
+    13f9:	          8b 11                	mov    (%rcx),%edx
+            tag_ = Tag::INVAL;
+    13fb:	          44 89 01             	mov    %r8d,(%rcx)
+            switch (tag) { // result-consume
+    13fe:	          83 fa 01             	cmp    $0x1,%edx
+    1401:	/-------- 74 2e                	je     1431 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)+0x41>
+        constexpr T unwrap(Context const &ctx = Context())
+    1403:	|         51                   	push   %rcx
+            switch (tag) { // result-consume
+    1404:	|         83 fa 02             	cmp    $0x2,%edx
+    1407:	|     /-- 74 10                	je     1419 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)+0x29>
+    1409:	|     |   85 d2                	test   %edx,%edx
+    140b:	|  /--|-- 75 18                	jne    1425 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::unwrap(nel::Context const&)+0x35>
+                    nel::panic("invalid Result", ctx);
+    140d:	|  |  |   48 8d 3d 28 0c 00 00 	lea    0xc28(%rip),%rdi        # 203c <_IO_stdin_used+0x3c>
+    1414:	|  |  |   e8 e9 fc ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+        {
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    1419:	|  |  \-> 48 8d 3d 12 0c 00 00 	lea    0xc12(%rip),%rdi        # 2032 <_IO_stdin_used+0x32>
+    1420:	|  |      e8 dd fc ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    1425:	|  \----> 48 8d 3d 1f 0c 00 00 	lea    0xc1f(%rip),%rdi        # 204b <_IO_stdin_used+0x4b>
+    142c:	|         e8 d1 fc ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+        constexpr Box &operator=(Box const &o) = delete;
+
+        // Can move though.
+        constexpr Box(Box &&o)
+        {
+            value_ = o.value_;
+    1431:	\-------> 48 8b 51 08          	mov    0x8(%rcx),%rdx
+    1435:	          48 89 f8             	mov    %rdi,%rax
+    1438:	          48 89 17             	mov    %rdx,(%rdi)
+            o.value_ = nullptr;
+    143b:	          31 d2                	xor    %edx,%edx
+    143d:	          48 89 51 08          	mov    %rdx,0x8(%rcx)
+                              ctx);
+        }
+    1441:	          c3                   	ret
+
+0000000000001442 <U8Buf<256ul>::~U8Buf()>:
+            nel::elem::set(data_, 0xa5, N);
+    1442:	ba 00 01 00 00       	mov    $0x100,%edx
+    1447:	be a5 00 00 00       	mov    $0xa5,%esi
+    144c:	e9 f9 00 00 00       	jmp    154a <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+
+0000000000001451 <nel::Element<U8Buf<256ul> >* nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::create<U8Buf<256ul> >(U8Buf<256ul>&&)>:
+        static ElementT *create(Args &&...args)
+    1451:	    55                   	push   %rbp
+    1452:	    48 89 fd             	mov    %rdi,%rbp
+            if (align == 0 || (align & (align - 1)) != 0) {
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+            }
+            void *const new_p = is_over_aligned(align)
+                                    ? realloc_aligned(p, align, old_size, new_size)
+                                    : std::realloc(p, new_size);
+    1455:	    bf 00 01 00 00       	mov    $0x100,%edi
+    145a:	    48 83 ec 10          	sub    $0x10,%rsp
+    145e:	    e8 2d fc ff ff       	call   1090 <malloc@plt>
+            if (new_p == nullptr) {
+    1463:	    48 85 c0             	test   %rax,%rax
+    1466:	/-- 74 1a                	je     1482 <nel::Element<U8Buf<256ul> >* nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::create<U8Buf<256ul> >(U8Buf<256ul>&&)+0x31>
+            nel::elem::move(data_, o.data_, N);
+    1468:	|   48 89 c7             	mov    %rax,%rdi
+    146b:	|   ba 00 01 00 00       	mov    $0x100,%edx
+    1470:	|   48 89 ee             	mov    %rbp,%rsi
+    1473:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1478:	|   e8 d5 00 00 00       	call   1552 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    147d:	|   48 8b 44 24 08       	mov    0x8(%rsp),%rax
+        }
+    1482:	\-> 48 83 c4 10          	add    $0x10,%rsp
+    1486:	    5d                   	pop    %rbp
+    1487:	    c3                   	ret
+
+0000000000001488 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::try_from(U8Buf<256ul>&&)>:
+         *
+         * @param val The value to move into the box
+         * @returns on success, Result::Ok holding the box.
+         * @returns on fail, Result::Err holding val.
+         */
+        constexpr static Result<Box, Type> try_from(Type &&val)
+    1488:	       53                   	push   %rbx
+    1489:	       48 89 fb             	mov    %rdi,%rbx
+        {
+            // on fail, val not moved
+            ElementT *const p = create(move(val));
+    148c:	       48 89 f7             	mov    %rsi,%rdi
+        constexpr static Result<Box, Type> try_from(Type &&val)
+    148f:	       48 83 ec 10          	sub    $0x10,%rsp
+            ElementT *const p = create(move(val));
+    1493:	       48 89 74 24 08       	mov    %rsi,0x8(%rsp)
+    1498:	       e8 b4 ff ff ff       	call   1451 <nel::Element<U8Buf<256ul> >* nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::create<U8Buf<256ul> >(U8Buf<256ul>&&)>
+            if (p == nullptr) { return Result<Box, Type>::Err(move(val)); }
+    149d:	       48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    14a2:	       48 85 c0             	test   %rax,%rax
+    14a5:	/----- 75 16                	jne    14bd <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::try_from(U8Buf<256ul>&&)+0x35>
+            : tag_(Tag::ERR)
+    14a7:	|      c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+            : value_(forward<Type>(val))
+    14ad:	|      48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    14b1:	|      ba 00 01 00 00       	mov    $0x100,%edx
+    14b6:	|      e8 97 00 00 00       	call   1552 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+        }
+    14bb:	|  /-- eb 0a                	jmp    14c7 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::try_from(U8Buf<256ul>&&)+0x3f>
+            : tag_(Tag::OK)
+    14bd:	\--|-> c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+            value_ = o.value_;
+    14c3:	   |   48 89 43 08          	mov    %rax,0x8(%rbx)
+            return Result<Box, Type>::Ok(move(Box(p)));
+        }
+    14c7:	   \-> 48 83 c4 10          	add    $0x10,%rsp
+    14cb:	       48 89 d8             	mov    %rbx,%rax
+    14ce:	       5b                   	pop    %rbx
+    14cf:	       c3                   	ret
+
+00000000000014d0 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::~Box()>:
+        constexpr ~Box(void)
+    14d0:	    53                   	push   %rbx
+            destroy(value_);
+    14d1:	    48 8b 1f             	mov    (%rdi),%rbx
+            if (p == nullptr) { return; }
+    14d4:	    48 85 db             	test   %rbx,%rbx
+    14d7:	/-- 74 11                	je     14ea <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::~Box()+0x1a>
+        constexpr ~Element(void) = default;
+    14d9:	|   48 89 df             	mov    %rbx,%rdi
+    14dc:	|   e8 61 ff ff ff       	call   1442 <U8Buf<256ul>::~U8Buf()>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    14e1:	|   48 89 df             	mov    %rbx,%rdi
+        }
+    14e4:	|   5b                   	pop    %rbx
+    14e5:	|   e9 46 fb ff ff       	jmp    1030 <free@plt>
+    14ea:	\-> 5b                   	pop    %rbx
+    14eb:	    c3                   	ret
+
+00000000000014ec <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::~Result()>:
+            switch (tag_) { // result::dtor
+    14ec:	          8b 07                	mov    (%rdi),%eax
+    14ee:	          83 f8 01             	cmp    $0x1,%eax
+    14f1:	      /-- 74 0a                	je     14fd <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::~Result()+0x11>
+    14f3:	      |   83 f8 02             	cmp    $0x2,%eax
+    14f6:	   /--|-- 74 0e                	je     1506 <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::~Result()+0x1a>
+    14f8:	   |  |   85 c0                	test   %eax,%eax
+    14fa:	/--|--|-- 75 13                	jne    150f <nel::Result<nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>, U8Buf<256ul> >::~Result()+0x23>
+    14fc:	|  |  |   c3                   	ret
+    14fd:	|  |  \-> 48 83 c7 08          	add    $0x8,%rdi
+    1501:	|  |      e9 ca ff ff ff       	jmp    14d0 <nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc>::~Box()>
+    1506:	|  \----> 48 83 c7 08          	add    $0x8,%rdi
+    150a:	|         e9 33 ff ff ff       	jmp    1442 <U8Buf<256ul>::~U8Buf()>
+        constexpr ~Result(void)
+    150f:	\-------> 48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    1513:	          48 8d 05 3c 0b 00 00 	lea    0xb3c(%rip),%rax        # 2056 <_IO_stdin_used+0x56>
+                    nel::panic("bad Result");
+    151a:	          48 8d 3d 2a 0b 00 00 	lea    0xb2a(%rip),%rdi        # 204b <_IO_stdin_used+0x4b>
+    1521:	          48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1526:	          48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    152b:	          48 8d 05 2c 0b 00 00 	lea    0xb2c(%rip),%rax        # 205e <_IO_stdin_used+0x5e>
+    1532:	          48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1537:	          c7 44 24 18 72 00 00 	movl   $0x72,0x18(%rsp)
+    153e:	          00 
+    153f:	          e8 be fb ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+
+0000000000001544 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1544:	48 89 d1             	mov    %rdx,%rcx
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    1547:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1549:	c3                   	ret
+
+000000000000154a <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    154a:	48 89 d1             	mov    %rdx,%rcx
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    154d:	89 f0                	mov    %esi,%eax
+    154f:	f3 aa                	rep stos %al,%es:(%rdi)
+}
+    1551:	c3                   	ret
+
+0000000000001552 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    1552:	48 89 d1             	mov    %rdx,%rcx
+    1555:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    1557:	c3                   	ret
+
+0000000000001558 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    1558:	e9 53 fb ff ff       	jmp    10b0 <memmove@plt>
+
+000000000000155d <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    155d:	48 89 f1             	mov    %rsi,%rcx
+    std::memset(d, s, n);
+    1560:	b0 a5                	mov    $0xa5,%al
+    1562:	f3 aa                	rep stos %al,%es:(%rdi)
+    set(d, 0xa5, n);
+}
+    1564:	c3                   	ret
+
+0000000000001565 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1565:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    1566:	e8 05 fb ff ff       	call   1070 <memcmp@plt>
+}
+    156b:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) == 0;
+    156c:	85 c0                	test   %eax,%eax
+    156e:	0f 94 c0             	sete   %al
+}
+    1571:	c3                   	ret
+
+0000000000001572 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1572:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    1573:	e8 f8 fa ff ff       	call   1070 <memcmp@plt>
+}
+    1578:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) != 0;
+    1579:	85 c0                	test   %eax,%eax
+    157b:	0f 95 c0             	setne  %al
+}
+    157e:	c3                   	ret
+
+000000000000157f <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+{
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    157f:	          49 89 fa             	mov    %rdi,%r10
+    1582:	          48 89 f0             	mov    %rsi,%rax
+    if (n < streaming_min) {
+    1585:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    158c:	      /-- 77 05                	ja     1593 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14>
+    std::memcpy(d, s, n);
+    158e:	      |   48 89 d1             	mov    %rdx,%rcx
+    1591:	/-----|-- eb 79                	jmp    160c <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x8d>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1593:	|     \-> 48 89 f9             	mov    %rdi,%rcx
+    1596:	|         48 f7 d9             	neg    %rcx
+    1599:	|         83 e1 0f             	and    $0xf,%ecx
+    159c:	|         49 89 c8             	mov    %rcx,%r8
+    std::memcpy(d, s, n);
+    159f:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    15a1:	|         49 8d 70 40          	lea    0x40(%r8),%rsi
+    15a5:	|         48 89 f9             	mov    %rdi,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    15a8:	|     /-> 0f 10 54 30 d0       	movups -0x30(%rax,%rsi,1),%xmm2
+    15ad:	|     |   0f 10 4c 30 e0       	movups -0x20(%rax,%rsi,1),%xmm1
+    15b2:	|     |   49 89 f0             	mov    %rsi,%r8
+    for (; i + 64 <= n; i += 64) {
+    15b5:	|     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    15b9:	|     |   0f 10 44 30 f0       	movups -0x10(%rax,%rsi,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    15be:	|     |   0f 10 5c 30 c0       	movups -0x40(%rax,%rsi,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    15c3:	|     |   48 83 c6 40          	add    $0x40,%rsi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    15c7:	|     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    15cc:	|     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    15d1:	|     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    15d6:	|     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    15db:	|     |   48 39 f2             	cmp    %rsi,%rdx
+    15de:	|     \-- 73 c8                	jae    15a8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x29>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    15e0:	|  /----> 49 8d 48 10          	lea    0x10(%r8),%rcx
+        stream16(d + i, load16(s + i));
+    15e4:	|  |      4f 8d 0c 02          	lea    (%r10,%r8,1),%r9
+    for (; i + 16 <= n; i += 16) {
+    15e8:	|  |      48 39 ca             	cmp    %rcx,%rdx
+    15eb:	|  |  /-- 72 0f                	jb     15fc <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x7d>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    15ed:	|  |  |   0f 10 64 08 f0       	movups -0x10(%rax,%rcx,1),%xmm4
+    15f2:	|  |  |   49 89 c8             	mov    %rcx,%r8
+    15f5:	|  |  |   66 41 0f e7 21       	movntdq %xmm4,(%r9)
+    for (; i + 16 <= n; i += 16) {
+    15fa:	|  \--|-- eb e4                	jmp    15e0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x61>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    15fc:	|     \-> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    15ff:	|         4c 29 c2             	sub    %r8,%rdx
+        stream16(d + i, load16(s + i));
+    1602:	|         4a 8d 34 00          	lea    (%rax,%r8,1),%rsi
+    std::memcpy(d, s, n);
+    1606:	|         4c 89 cf             	mov    %r9,%rdi
+    copy(d + i, s + i, n - i);
+    1609:	|         48 89 d1             	mov    %rdx,%rcx
+    std::memcpy(d, s, n);
+    160c:	\-------> f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    160e:	          c3                   	ret
+
+000000000000160f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    160f:	          49 89 f8             	mov    %rdi,%r8
+    if (n < streaming_min) {
+    1612:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1619:	/-------- 77 37                	ja     1652 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x43>
+    Length done = (n < 16) ? n : 16;
+    161b:	|         b8 10 00 00 00       	mov    $0x10,%eax
+    1620:	|         48 39 c2             	cmp    %rax,%rdx
+    1623:	|         48 0f 46 c2          	cmovbe %rdx,%rax
+    std::memcpy(d, s, n);
+    1627:	|         89 c1                	mov    %eax,%ecx
+    1629:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    162b:	|  /----> 48 39 d0             	cmp    %rdx,%rax
+    162e:	|  |  /-- 73 21                	jae    1651 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42>
+        Length const m = (done < n - done) ? done : n - done;
+    1630:	|  |  |   49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    1633:	|  |  |   4d 8d 14 00          	lea    (%r8,%rax,1),%r10
+    std::memcpy(d, s, n);
+    1637:	|  |  |   4c 89 c6             	mov    %r8,%rsi
+        Length const m = (done < n - done) ? done : n - done;
+    163a:	|  |  |   49 29 c1             	sub    %rax,%r9
+    std::memcpy(d, s, n);
+    163d:	|  |  |   4c 89 d7             	mov    %r10,%rdi
+        Length const m = (done < n - done) ? done : n - done;
+    1640:	|  |  |   49 39 c1             	cmp    %rax,%r9
+    1643:	|  |  |   4c 0f 47 c8          	cmova  %rax,%r9
+    std::memcpy(d, s, n);
+    1647:	|  |  |   44 89 c9             	mov    %r9d,%ecx
+        done += m;
+    164a:	|  |  |   4c 01 c8             	add    %r9,%rax
+    std::memcpy(d, s, n);
+    164d:	|  |  |   f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+        done += m;
+    164f:	|  \--|-- eb da                	jmp    162b <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c>
+    1651:	|     \-> c3                   	ret
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1652:	\-------> 48 89 f8             	mov    %rdi,%rax
+    for (Index i = 0; i < head; ++i) {
+    1655:	          31 c9                	xor    %ecx,%ecx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1657:	          48 f7 d8             	neg    %rax
+    165a:	          83 e0 0f             	and    $0xf,%eax
+    for (Index i = 0; i < head; ++i) {
+    165d:	   /----> 48 39 c1             	cmp    %rax,%rcx
+    1660:	   |  /-- 74 0d                	je     166f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x60>
+        d[i] = p[i];
+    1662:	   |  |   40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+    1666:	   |  |   41 88 3c 08          	mov    %dil,(%r8,%rcx,1)
+    for (Index i = 0; i < head; ++i) {
+    166a:	   |  |   48 ff c1             	inc    %rcx
+    166d:	   \--|-- eb ee                	jmp    165d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4e>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    166f:	      \-> 31 c9                	xor    %ecx,%ecx
+        rotated[i] = p[(head + i) % 16];
+    1671:	      /-> 48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+    1675:	      |   83 e7 0f             	and    $0xf,%edi
+    1678:	      |   40 8a 3c 3e          	mov    (%rsi,%rdi,1),%dil
+    167c:	      |   40 88 7c 0c e8       	mov    %dil,-0x18(%rsp,%rcx,1)
+    for (Index i = 0; i < 16; ++i) {
+    1681:	      |   48 ff c1             	inc    %rcx
+    1684:	      |   48 83 f9 10          	cmp    $0x10,%rcx
+    1688:	      \-- 75 e7                	jne    1671 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x62>
+    std::memcpy(&v, s, sizeof(v));
+    168a:	          0f 28 44 24 e8       	movaps -0x18(%rsp),%xmm0
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    168f:	          48 8d 78 40          	lea    0x40(%rax),%rdi
+    1693:	          4c 01 c0             	add    %r8,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1696:	      /-> 48 89 f9             	mov    %rdi,%rcx
+    for (; i + 64 <= n; i += 64) {
+    1699:	      |   48 8d 7f 40          	lea    0x40(%rdi),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    169d:	      |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    16a1:	      |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    16a6:	      |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    16ab:	      |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    16b0:	      |   48 83 c0 40          	add    $0x40,%rax
+    16b4:	      |   48 39 fa             	cmp    %rdi,%rdx
+    16b7:	      \-- 73 dd                	jae    1696 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x87>
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+        stream16(d + i, v);
+    16b9:	          49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    for (; i + 16 <= n; i += 16) {
+    16bd:	   /----> 48 8d 41 10          	lea    0x10(%rcx),%rax
+    16c1:	   |      48 39 c2             	cmp    %rax,%rdx
+    16c4:	   |  /-- 72 0a                	jb     16d0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc1>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    16c6:	   |  |   48 89 c1             	mov    %rax,%rcx
+    16c9:	   |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    16ce:	   \--|-- eb ed                	jmp    16bd <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xae>
+    }
+    __builtin_ia32_sfence();
+    16d0:	      \-> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    16d3:	   /----> 48 39 d1             	cmp    %rdx,%rcx
+    16d6:	   |  /-- 73 12                	jae    16ea <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xdb>
+        d[i] = p[i % 16];
+    16d8:	   |  |   48 89 c8             	mov    %rcx,%rax
+    16db:	   |  |   83 e0 0f             	and    $0xf,%eax
+    16de:	   |  |   8a 04 06             	mov    (%rsi,%rax,1),%al
+    16e1:	   |  |   41 88 04 08          	mov    %al,(%r8,%rcx,1)
+    for (; i < n; ++i) {
+    16e5:	   |  |   48 ff c1             	inc    %rcx
+    16e8:	   \--|-- eb e9                	jmp    16d3 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc4>
+    }
+}
+    16ea:	      \-> c3                   	ret
+
+00000000000016eb <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    16eb:	    48 85 ff             	test   %rdi,%rdi
+    16ee:	/-- 74 09                	je     16f9 <nel::free_aligned(void*)+0xe>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    16f0:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    16f4:	|   e9 37 f9 ff ff       	jmp    1030 <free@plt>
+}
+    16f9:	\-> c3                   	ret
+
+00000000000016fa <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    16fa:	       41 56                	push   %r14
+            : fn_name_(fn_name)
+    16fc:	       48 8d 05 a5 09 00 00 	lea    0x9a5(%rip),%rax        # 20a8 <_IO_stdin_used+0xa8>
+    1703:	       41 55                	push   %r13
+    1705:	       41 54                	push   %r12
+    1707:	       55                   	push   %rbp
+    1708:	       53                   	push   %rbx
+    1709:	       48 83 ec 20          	sub    $0x20,%rsp
+    170d:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , file_name_(file_name)
+    1712:	       48 8d 05 9f 09 00 00 	lea    0x99f(%rip),%rax        # 20b8 <_IO_stdin_used+0xb8>
+    1719:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    171e:	       c7 44 24 18 f3 00 00 	movl   $0xf3,0x18(%rsp)
+    1725:	       00 
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    1726:	       48 85 f6             	test   %rsi,%rsi
+    1729:	/----- 74 28                	je     1753 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    172b:	|      4c 8d 66 ff          	lea    -0x1(%rsi),%r12
+    172f:	|      48 89 f3             	mov    %rsi,%rbx
+    1732:	|      49 21 f4             	and    %rsi,%r12
+    1735:	+----- 75 1c                	jne    1753 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1737:	|      49 89 fd             	mov    %rdi,%r13
+    173a:	|      49 89 d6             	mov    %rdx,%r14
+    173d:	|      48 89 cd             	mov    %rcx,%rbp
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1740:	|      31 ff                	xor    %edi,%edi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    1742:	|      4d 85 ed             	test   %r13,%r13
+    1745:	|  /-- 74 1d                	je     1764 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+    1747:	|  |   4d 8b 65 f8          	mov    -0x8(%r13),%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    174b:	|  |   4c 89 ef             	mov    %r13,%rdi
+    174e:	|  |   4c 29 e7             	sub    %r12,%rdi
+    1751:	|  +-- eb 11                	jmp    1764 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    1753:	\--|-> 48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    1758:	   |   48 8d 3d 6b 09 00 00 	lea    0x96b(%rip),%rdi        # 20ca <_IO_stdin_used+0xca>
+    175f:	   |   e8 ce f9 ff ff       	call   1132 <nel::assert_fail(char const*, nel::Context const&)>
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1764:	   \-> 48 8d 34 2b          	lea    (%rbx,%rbp,1),%rsi
+    1768:	       e8 33 f9 ff ff       	call   10a0 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    176d:	       48 85 c0             	test   %rax,%rax
+    1770:	/----- 74 3b                	je     17ad <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb3>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1772:	|      48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    1777:	|      48 f7 db             	neg    %rbx
+    177a:	|      48 21 d9             	and    %rbx,%rcx
+    177d:	|      48 89 cb             	mov    %rcx,%rbx
+    1780:	|      48 29 c3             	sub    %rax,%rbx
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    1783:	|      4d 85 ed             	test   %r13,%r13
+    1786:	|  /-- 74 1e                	je     17a6 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+    1788:	|  |   49 39 dc             	cmp    %rbx,%r12
+    178b:	|  +-- 74 19                	je     17a6 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    178d:	|  |   4c 39 f5             	cmp    %r14,%rbp
+    1790:	|  |   4c 89 f2             	mov    %r14,%rdx
+    1793:	|  |   4a 8d 34 20          	lea    (%rax,%r12,1),%rsi
+    1797:	|  |   48 89 cf             	mov    %rcx,%rdi
+    179a:	|  |   48 0f 46 d5          	cmovbe %rbp,%rdx
+    179e:	|  |   e8 0d f9 ff ff       	call   10b0 <memmove@plt>
+    17a3:	|  |   48 89 c1             	mov    %rax,%rcx
+    }
+    offset_field(new_p) = new_offset;
+    17a6:	|  \-> 48 89 59 f8          	mov    %rbx,-0x8(%rcx)
+    return new_p;
+    17aa:	|      48 89 c8             	mov    %rcx,%rax
+}
+    17ad:	\----> 48 83 c4 20          	add    $0x20,%rsp
+    17b1:	       5b                   	pop    %rbx
+    17b2:	       5d                   	pop    %rbp
+    17b3:	       41 5c                	pop    %r12
+    17b5:	       41 5d                	pop    %r13
+    17b7:	       41 5e                	pop    %r14
+    17b9:	       c3                   	ret
+
+00000000000017ba <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    17ba:	48 89 f1             	mov    %rsi,%rcx
+    return realloc_aligned(nullptr, align, 0, size);
+    17bd:	31 d2                	xor    %edx,%edx
+    17bf:	48 89 fe             	mov    %rdi,%rsi
+    17c2:	31 ff                	xor    %edi,%edi
+    17c4:	e9 31 ff ff ff       	jmp    16fa <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+
+00000000000017c9 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    17c9:	53                   	push   %rbx
+    17ca:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    17cd:	40 0f be fe          	movsbl %sil,%edi
+    17d1:	48 8b 35 88 28 00 00 	mov    0x2888(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    17d8:	e8 83 f8 ff ff       	call   1060 <fputc@plt>
+    return outs;
+}
+    17dd:	48 89 d8             	mov    %rbx,%rax
+    17e0:	5b                   	pop    %rbx
+    17e1:	c3                   	ret
+
+00000000000017e2 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    17e2:	53                   	push   %rbx
+    17e3:	48 89 fb             	mov    %rdi,%rbx
+    17e6:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    17e9:	48 8b 35 70 28 00 00 	mov    0x2870(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    17f0:	e8 5b f8 ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    17f5:	48 89 d8             	mov    %rbx,%rax
+    17f8:	5b                   	pop    %rbx
+    17f9:	c3                   	ret
+
+00000000000017fa <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    17fa:	53                   	push   %rbx
+    17fb:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    17fe:	48 8b 3d 5b 28 00 00 	mov    0x285b(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1805:	40 0f b6 d6          	movzbl %sil,%edx
+    1809:	31 c0                	xor    %eax,%eax
+    180b:	48 8d 35 d3 08 00 00 	lea    0x8d3(%rip),%rsi        # 20e5 <_IO_stdin_used+0xe5>
+    1812:	e8 69 f8 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1817:	48 89 d8             	mov    %rbx,%rax
+    181a:	5b                   	pop    %rbx
+    181b:	c3                   	ret
+
+000000000000181c <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    181c:	53                   	push   %rbx
+    181d:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    1820:	48 8b 3d 39 28 00 00 	mov    0x2839(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1827:	0f b7 d6             	movzwl %si,%edx
+    182a:	31 c0                	xor    %eax,%eax
+    182c:	48 8d 35 b2 08 00 00 	lea    0x8b2(%rip),%rsi        # 20e5 <_IO_stdin_used+0xe5>
+    1833:	e8 48 f8 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1838:	48 89 d8             	mov    %rbx,%rax
+    183b:	5b                   	pop    %rbx
+    183c:	c3                   	ret
+
+000000000000183d <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    183d:	53                   	push   %rbx
+    183e:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    1841:	48 8b 3d 18 28 00 00 	mov    0x2818(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1848:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    184a:	31 c0                	xor    %eax,%eax
+    184c:	48 8d 35 92 08 00 00 	lea    0x892(%rip),%rsi        # 20e5 <_IO_stdin_used+0xe5>
+    1853:	e8 28 f8 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1858:	48 89 d8             	mov    %rbx,%rax
+    185b:	5b                   	pop    %rbx
+    185c:	c3                   	ret
+
+000000000000185d <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    185d:	53                   	push   %rbx
+    185e:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    1861:	48 8b 3d f8 27 00 00 	mov    0x27f8(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1868:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    186a:	31 c0                	xor    %eax,%eax
+    186c:	48 8d 35 72 08 00 00 	lea    0x872(%rip),%rsi        # 20e5 <_IO_stdin_used+0xe5>
+    1873:	e8 08 f8 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1878:	48 89 d8             	mov    %rbx,%rax
+    187b:	5b                   	pop    %rbx
+    187c:	c3                   	ret
+
+000000000000187d <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    187d:	53                   	push   %rbx
+    187e:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    1881:	48 8b 3d d8 27 00 00 	mov    0x27d8(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1888:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    188b:	31 c0                	xor    %eax,%eax
+    188d:	48 8d 35 54 08 00 00 	lea    0x854(%rip),%rsi        # 20e8 <_IO_stdin_used+0xe8>
+    1894:	e8 e7 f7 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1899:	48 89 d8             	mov    %rbx,%rax
+    189c:	5b                   	pop    %rbx
+    189d:	c3                   	ret
+
+Disassembly of section .fini:
+
+00000000000018a0 <_fini>:
+    18a0:	48 83 ec 08          	sub    $0x8,%rsp
+    18a4:	48 83 c4 08          	add    $0x8,%rsp
+    18a8:	c3                   	ret
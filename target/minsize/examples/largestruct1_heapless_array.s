@@ -0,0 +1,1847 @@
+
+target/minsize/examples/largestruct1_heapless_array:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputc@plt>:
+    1060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 4018 <fputc@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <memcmp@plt>:
+    1070:	ff 25 aa 2f 00 00    	jmp    *0x2faa(%rip)        # 4020 <memcmp@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fprintf@plt>:
+    1080:	ff 25 a2 2f 00 00    	jmp    *0x2fa2(%rip)        # 4028 <fprintf@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <realloc@plt>:
+    1090:	ff 25 9a 2f 00 00    	jmp    *0x2f9a(%rip)        # 4030 <realloc@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memmove@plt>:
+    10a0:	ff 25 92 2f 00 00    	jmp    *0x2f92(%rip)        # 4038 <memmove@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010b0 <__cxa_finalize@plt>:
+    10b0:	ff 25 2a 2f 00 00    	jmp    *0x2f2a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10b6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010c0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10c0:	50                   	push   %rax
+    std::abort();
+    10c1:	e8 7a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010c6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10c6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10c7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10ca:	4c 8d 0d 23 10 00 00 	lea    0x1023(%rip),%r9        # 20f4 <_IO_stdin_used+0xf4>
+    10d1:	31 c0                	xor    %eax,%eax
+    10d3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10d7:	4c 8b 07             	mov    (%rdi),%r8
+    10da:	48 8d 35 19 10 00 00 	lea    0x1019(%rip),%rsi        # 20fa <_IO_stdin_used+0xfa>
+    10e1:	48 8b 3d 78 2f 00 00 	mov    0x2f78(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    10e8:	e8 93 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    10ed:	e8 4e ff ff ff       	call   1040 <abort@plt>
+
+00000000000010f2 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    10f2:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    10f6:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    10f9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    10fd:	31 c0                	xor    %eax,%eax
+    10ff:	57                   	push   %rdi
+    1100:	48 8b 3d 59 2f 00 00 	mov    0x2f59(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1107:	4c 8d 0d e6 0f 00 00 	lea    0xfe6(%rip),%r9        # 20f4 <_IO_stdin_used+0xf4>
+    110e:	4c 8b 06             	mov    (%rsi),%r8
+    1111:	48 8d 35 f3 0f 00 00 	lea    0xff3(%rip),%rsi        # 210b <_IO_stdin_used+0x10b>
+    1118:	e8 63 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    111d:	e8 1e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001122 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1122:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1126:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1129:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    112d:	31 c0                	xor    %eax,%eax
+    112f:	57                   	push   %rdi
+    1130:	48 8b 3d 29 2f 00 00 	mov    0x2f29(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1137:	4c 8d 0d e2 0f 00 00 	lea    0xfe2(%rip),%r9        # 2120 <_IO_stdin_used+0x120>
+    113e:	4c 8b 06             	mov    (%rsi),%r8
+    1141:	48 8d 35 c3 0f 00 00 	lea    0xfc3(%rip),%rsi        # 210b <_IO_stdin_used+0x10b>
+    1148:	e8 33 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    114d:	e8 ee fe ff ff       	call   1040 <abort@plt>
+
+0000000000001152 <main>:
+#    endif
+}
+#endif
+
+int main()
+{
+    1152:	53                   	push   %rbx
+    nel::log << "ex1:b" << '\n';
+    1153:	48 8d 1d 0f 2f 00 00 	lea    0x2f0f(%rip),%rbx        # 4069 <nel::log>
+    115a:	48 8d 35 27 0f 00 00 	lea    0xf27(%rip),%rsi        # 2088 <_IO_stdin_used+0x88>
+    1161:	48 89 df             	mov    %rbx,%rdi
+    1164:	e8 65 0d 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+    1169:	be 0a 00 00 00       	mov    $0xa,%esi
+    116e:	48 89 c7             	mov    %rax,%rdi
+    1171:	e8 3f 0d 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    1176:	e8 c6 06 00 00       	call   1841 <ex1()>
+    nel::log << "ex1:e" << '\n';
+    117b:	48 89 df             	mov    %rbx,%rdi
+    117e:	48 8d 35 09 0f 00 00 	lea    0xf09(%rip),%rsi        # 208e <_IO_stdin_used+0x8e>
+    1185:	e8 44 0d 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+    118a:	be 0a 00 00 00       	mov    $0xa,%esi
+    118f:	48 89 c7             	mov    %rax,%rdi
+    1192:	e8 1e 0d 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    // nel::log << "ex2:b" << '\n';
+    // ex2();
+    // nel::log << "ex2:e" << '\n';
+    nel::log << "ex3:b" << '\n';
+    1197:	48 89 df             	mov    %rbx,%rdi
+    119a:	48 8d 35 f3 0e 00 00 	lea    0xef3(%rip),%rsi        # 2094 <_IO_stdin_used+0x94>
+    11a1:	e8 28 0d 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+    11a6:	be 0a 00 00 00       	mov    $0xa,%esi
+    11ab:	48 89 c7             	mov    %rax,%rdi
+    11ae:	e8 02 0d 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    ex3();
+    11b3:	e8 76 07 00 00       	call   192e <ex3()>
+    nel::log << "ex3:e" << '\n';
+    11b8:	48 89 df             	mov    %rbx,%rdi
+    11bb:	48 8d 35 d8 0e 00 00 	lea    0xed8(%rip),%rsi        # 209a <_IO_stdin_used+0x9a>
+    11c2:	e8 07 0d 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+    11c7:	be 0a 00 00 00       	mov    $0xa,%esi
+    11cc:	48 89 c7             	mov    %rax,%rdi
+    11cf:	e8 e1 0c 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+#if defined(RUST_LIKE)
+    nel::log << "ex41:b" << '\n';
+    ex41();
+    nel::log << "ex41:e" << '\n';
+#endif
+    nel::log << "ex42:b" << '\n';
+    11d4:	48 89 df             	mov    %rbx,%rdi
+    11d7:	48 8d 35 c2 0e 00 00 	lea    0xec2(%rip),%rsi        # 20a0 <_IO_stdin_used+0xa0>
+    11de:	e8 eb 0c 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+    11e3:	be 0a 00 00 00       	mov    $0xa,%esi
+    11e8:	48 89 c7             	mov    %rax,%rdi
+    11eb:	e8 c5 0c 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    ex42();
+    11f0:	e8 ab 02 00 00       	call   14a0 <ex42()>
+    nel::log << "ex42:e" << '\n';
+    11f5:	48 89 df             	mov    %rbx,%rdi
+    11f8:	48 8d 35 a8 0e 00 00 	lea    0xea8(%rip),%rsi        # 20a7 <_IO_stdin_used+0xa7>
+    11ff:	e8 ca 0c 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+    1204:	be 0a 00 00 00       	mov    $0xa,%esi
+    1209:	48 89 c7             	mov    %rax,%rdi
+    120c:	e8 a4 0c 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+#if defined(C_LIKE)
+    nel::log << "ex51:b" << '\n';
+    1211:	48 89 df             	mov    %rbx,%rdi
+    1214:	48 8d 35 93 0e 00 00 	lea    0xe93(%rip),%rsi        # 20ae <_IO_stdin_used+0xae>
+    121b:	e8 ae 0c 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+    1220:	be 0a 00 00 00       	mov    $0xa,%esi
+    1225:	48 89 c7             	mov    %rax,%rdi
+    1228:	e8 88 0c 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    ex51();
+    122d:	e8 c5 02 00 00       	call   14f7 <ex51()>
+    nel::log << "ex51:e" << '\n';
+    1232:	48 89 df             	mov    %rbx,%rdi
+    1235:	48 8d 35 79 0e 00 00 	lea    0xe79(%rip),%rsi        # 20b5 <_IO_stdin_used+0xb5>
+    123c:	e8 8d 0c 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+    1241:	be 0a 00 00 00       	mov    $0xa,%esi
+    1246:	48 89 c7             	mov    %rax,%rdi
+    1249:	e8 67 0c 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex52:b" << '\n';
+    124e:	48 89 df             	mov    %rbx,%rdi
+    1251:	48 8d 35 64 0e 00 00 	lea    0xe64(%rip),%rsi        # 20bc <_IO_stdin_used+0xbc>
+    1258:	e8 71 0c 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+    125d:	be 0a 00 00 00       	mov    $0xa,%esi
+    1262:	48 89 c7             	mov    %rax,%rdi
+    1265:	e8 4b 0c 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    ex52();
+    126a:	e8 12 03 00 00       	call   1581 <ex52()>
+    nel::log << "ex52:e" << '\n';
+    126f:	48 89 df             	mov    %rbx,%rdi
+    1272:	48 8d 35 4a 0e 00 00 	lea    0xe4a(%rip),%rsi        # 20c3 <_IO_stdin_used+0xc3>
+    1279:	e8 50 0c 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+    127e:	be 0a 00 00 00       	mov    $0xa,%esi
+    1283:	48 89 c7             	mov    %rax,%rdi
+    1286:	e8 2a 0c 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+#if defined(RUST_LIKE)
+    nel::log << "ex61:b" << '\n';
+    ex61();
+    nel::log << "ex61:e" << '\n';
+#endif
+    nel::log << "ex62:b" << '\n';
+    128b:	48 89 df             	mov    %rbx,%rdi
+    128e:	48 8d 35 35 0e 00 00 	lea    0xe35(%rip),%rsi        # 20ca <_IO_stdin_used+0xca>
+    1295:	e8 34 0c 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+    129a:	be 0a 00 00 00       	mov    $0xa,%esi
+    129f:	48 89 c7             	mov    %rax,%rdi
+    12a2:	e8 0e 0c 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    ex62();
+    12a7:	e8 2c 03 00 00       	call   15d8 <ex62()>
+    nel::log << "ex62:e" << '\n';
+    12ac:	48 89 df             	mov    %rbx,%rdi
+    12af:	48 8d 35 1b 0e 00 00 	lea    0xe1b(%rip),%rsi        # 20d1 <_IO_stdin_used+0xd1>
+    12b6:	e8 13 0c 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+    12bb:	be 0a 00 00 00       	mov    $0xa,%esi
+    12c0:	48 89 c7             	mov    %rax,%rdi
+    12c3:	e8 ed 0b 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+
+#if defined(C_LIKE)
+    nel::log << "ex71:b" << '\n';
+    12c8:	48 89 df             	mov    %rbx,%rdi
+    12cb:	48 8d 35 06 0e 00 00 	lea    0xe06(%rip),%rsi        # 20d8 <_IO_stdin_used+0xd8>
+    12d2:	e8 f7 0b 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+    12d7:	be 0a 00 00 00       	mov    $0xa,%esi
+    12dc:	48 89 c7             	mov    %rax,%rdi
+    12df:	e8 d1 0b 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    ex71();
+    12e4:	e8 c0 03 00 00       	call   16a9 <ex71()>
+    nel::log << "ex71:e" << '\n';
+    12e9:	48 89 df             	mov    %rbx,%rdi
+    12ec:	48 8d 35 ec 0d 00 00 	lea    0xdec(%rip),%rsi        # 20df <_IO_stdin_used+0xdf>
+    12f3:	e8 d6 0b 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+    12f8:	be 0a 00 00 00       	mov    $0xa,%esi
+    12fd:	48 89 c7             	mov    %rax,%rdi
+    1300:	e8 b0 0b 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+
+    nel::log << "ex72:b" << '\n';
+    1305:	48 89 df             	mov    %rbx,%rdi
+    1308:	48 8d 35 d7 0d 00 00 	lea    0xdd7(%rip),%rsi        # 20e6 <_IO_stdin_used+0xe6>
+    130f:	e8 ba 0b 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+    1314:	be 0a 00 00 00       	mov    $0xa,%esi
+    1319:	48 89 c7             	mov    %rax,%rdi
+    131c:	e8 94 0b 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    ex72();
+    1321:	e8 4a 04 00 00       	call   1770 <ex72()>
+    nel::log << "ex72:e" << '\n';
+    1326:	48 89 df             	mov    %rbx,%rdi
+    1329:	48 8d 35 bd 0d 00 00 	lea    0xdbd(%rip),%rsi        # 20ed <_IO_stdin_used+0xed>
+    1330:	e8 99 0b 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+    1335:	be 0a 00 00 00       	mov    $0xa,%esi
+    133a:	48 89 c7             	mov    %rax,%rdi
+    133d:	e8 73 0b 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+#endif
+}
+    1342:	31 c0                	xor    %eax,%eax
+    1344:	5b                   	pop    %rbx
+    1345:	c3                   	ret
+    1346:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    134d:	00 00 00 
+
+0000000000001350 <_start>:
+    1350:	31 ed                	xor    %ebp,%ebp
+    1352:	49 89 d1             	mov    %rdx,%r9
+    1355:	5e                   	pop    %rsi
+    1356:	48 89 e2             	mov    %rsp,%rdx
+    1359:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    135d:	50                   	push   %rax
+    135e:	54                   	push   %rsp
+    135f:	45 31 c0             	xor    %r8d,%r8d
+    1362:	31 c9                	xor    %ecx,%ecx
+    1364:	48 8d 3d e7 fd ff ff 	lea    -0x219(%rip),%rdi        # 1152 <main>
+    136b:	ff 15 4f 2c 00 00    	call   *0x2c4f(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    1371:	f4                   	hlt
+    1372:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1379:	00 00 00 
+    137c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001380 <deregister_tm_clones>:
+    1380:	    48 8d 3d c9 2c 00 00 	lea    0x2cc9(%rip),%rdi        # 4050 <__TMC_END__>
+    1387:	    48 8d 05 c2 2c 00 00 	lea    0x2cc2(%rip),%rax        # 4050 <__TMC_END__>
+    138e:	    48 39 f8             	cmp    %rdi,%rax
+    1391:	/-- 74 15                	je     13a8 <deregister_tm_clones+0x28>
+    1393:	|   48 8b 05 2e 2c 00 00 	mov    0x2c2e(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    139a:	|   48 85 c0             	test   %rax,%rax
+    139d:	+-- 74 09                	je     13a8 <deregister_tm_clones+0x28>
+    139f:	|   ff e0                	jmp    *%rax
+    13a1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    13a8:	\-> c3                   	ret
+    13a9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000013b0 <register_tm_clones>:
+    13b0:	    48 8d 3d 99 2c 00 00 	lea    0x2c99(%rip),%rdi        # 4050 <__TMC_END__>
+    13b7:	    48 8d 35 92 2c 00 00 	lea    0x2c92(%rip),%rsi        # 4050 <__TMC_END__>
+    13be:	    48 29 fe             	sub    %rdi,%rsi
+    13c1:	    48 89 f0             	mov    %rsi,%rax
+    13c4:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    13c8:	    48 c1 f8 03          	sar    $0x3,%rax
+    13cc:	    48 01 c6             	add    %rax,%rsi
+    13cf:	    48 d1 fe             	sar    %rsi
+    13d2:	/-- 74 14                	je     13e8 <register_tm_clones+0x38>
+    13d4:	|   48 8b 05 fd 2b 00 00 	mov    0x2bfd(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    13db:	|   48 85 c0             	test   %rax,%rax
+    13de:	+-- 74 08                	je     13e8 <register_tm_clones+0x38>
+    13e0:	|   ff e0                	jmp    *%rax
+    13e2:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    13e8:	\-> c3                   	ret
+    13e9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000013f0 <__do_global_dtors_aux>:
+    13f0:	       f3 0f 1e fa          	endbr64
+    13f4:	       80 3d 6d 2c 00 00 00 	cmpb   $0x0,0x2c6d(%rip)        # 4068 <completed.0>
+    13fb:	/----- 75 2b                	jne    1428 <__do_global_dtors_aux+0x38>
+    13fd:	|      55                   	push   %rbp
+    13fe:	|      48 83 3d da 2b 00 00 	cmpq   $0x0,0x2bda(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1405:	|      00 
+    1406:	|      48 89 e5             	mov    %rsp,%rbp
+    1409:	|  /-- 74 0c                	je     1417 <__do_global_dtors_aux+0x27>
+    140b:	|  |   48 8b 3d 36 2c 00 00 	mov    0x2c36(%rip),%rdi        # 4048 <__dso_handle>
+    1412:	|  |   e8 99 fc ff ff       	call   10b0 <__cxa_finalize@plt>
+    1417:	|  \-> e8 64 ff ff ff       	call   1380 <deregister_tm_clones>
+    141c:	|      c6 05 45 2c 00 00 01 	movb   $0x1,0x2c45(%rip)        # 4068 <completed.0>
+    1423:	|      5d                   	pop    %rbp
+    1424:	|      c3                   	ret
+    1425:	|      0f 1f 00             	nopl   (%rax)
+    1428:	\----> c3                   	ret
+    1429:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001430 <frame_dummy>:
+    1430:	f3 0f 1e fa          	endbr64
+    1434:	e9 77 ff ff ff       	jmp    13b0 <register_tm_clones>
+    1439:	90                   	nop
+
+000000000000143a <U8Buf<256ul>::U8Buf(unsigned char)>:
+        {(uint8_t)0x3d},
+    143a:	40 0f b6 f6          	movzbl %sil,%esi
+    143e:	ba 00 01 00 00       	mov    $0x100,%edx
+    1443:	e9 ee 07 00 00       	jmp    1c36 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+
+0000000000001448 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    1448:	83 c8 ff             	or     $0xffffffff,%eax
+    144b:	c3                   	ret
+
+000000000000144c <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    144c:	83 c8 ff             	or     $0xffffffff,%eax
+    144f:	c3                   	ret
+
+0000000000001450 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    1450:	83 c8 ff             	or     $0xffffffff,%eax
+    1453:	c3                   	ret
+
+0000000000001454 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    1454:	83 c8 ff             	or     $0xffffffff,%eax
+    1457:	c3                   	ret
+
+0000000000001458 <_read_r>:
+int _read_r(struct _reent *, int) {
+    1458:	83 c8 ff             	or     $0xffffffff,%eax
+    145b:	c3                   	ret
+
+000000000000145c <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    145c:	83 c8 ff             	or     $0xffffffff,%eax
+    145f:	c3                   	ret
+
+0000000000001460 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    1460:	83 c8 ff             	or     $0xffffffff,%eax
+    1463:	c3                   	ret
+
+0000000000001464 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1464:	83 c8 ff             	or     $0xffffffff,%eax
+    1467:	c3                   	ret
+
+0000000000001468 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<ex42()::{lambda(U8Buf<256ul>&)#1}>(ex42()::{lambda(U8Buf<256ul>&)#1}&&) [clone .isra.0]>:
+         * @param fn func to apply to each item in iterator
+         */
+        // void for_each(std::function<void(OutT)> fn)
+#    if defined(C_LIKE) || defined(RUST_LIKE)
+        template<typename F>
+        void for_each(F &&fn)
+    1468:	       55                   	push   %rbp
+    arr1.iter().for_each([&](U8Buf<256> &v) -> void { nel::log << v << '\n'; });
+    1469:	       48 8d 2d f9 2b 00 00 	lea    0x2bf9(%rip),%rbp        # 4069 <nel::log>
+    1470:	       53                   	push   %rbx
+    1471:	       48 89 fb             	mov    %rdi,%rbx
+    1474:	       52                   	push   %rdx
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return (b_ == e_);
+    1475:	/----> 48 8b 33             	mov    (%rbx),%rsi
+        template<typename F>
+        void for_each2(F &&fn)
+#        endif
+        {
+#        if 1
+            for (; !self().is_done(); self().inc()) {
+    1478:	|      48 3b 73 08          	cmp    0x8(%rbx),%rsi
+    147c:	|  /-- 74 1e                	je     149c <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<ex42()::{lambda(U8Buf<256ul>&)#1}>(ex42()::{lambda(U8Buf<256ul>&)#1}&&) [clone .isra.0]+0x34>
+    147e:	|  |   48 89 ef             	mov    %rbp,%rdi
+    1481:	|  |   e8 e4 06 00 00       	call   1b6a <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    1486:	|  |   be 0a 00 00 00       	mov    $0xa,%esi
+    148b:	|  |   48 89 c7             	mov    %rax,%rdi
+    148e:	|  |   e8 22 0a 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+        }
+
+        void inc(void)
+        {
+            ++b_;
+    1493:	|  |   48 81 03 00 01 00 00 	addq   $0x100,(%rbx)
+        }
+    149a:	\--|-- eb d9                	jmp    1475 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<ex42()::{lambda(U8Buf<256ul>&)#1}>(ex42()::{lambda(U8Buf<256ul>&)#1}&&) [clone .isra.0]+0xd>
+            fn(self().deref());
+            self().inc();
+enter:
+            if (!self().is_done()) { goto loop; }
+#        endif
+        }
+    149c:	   \-> 58                   	pop    %rax
+    149d:	       5b                   	pop    %rbx
+    149e:	       5d                   	pop    %rbp
+    149f:	       c3                   	ret
+
+00000000000014a0 <ex42()>:
+{
+    14a0:	55                   	push   %rbp
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+        {
+            nel::elem::set(data_, f, N);
+        }
+    14a1:	40 b6 ff             	mov    $0xff,%sil
+    14a4:	53                   	push   %rbx
+    14a5:	48 81 ec 08 09 00 00 	sub    $0x908,%rsp
+    14ac:	48 89 e3             	mov    %rsp,%rbx
+         */
+        // not very good as failure to copy v will panic.
+        // and don't want panics from lib code.
+        constexpr static Array filled_with(Type const &v)
+        {
+            return Array(v);
+    14af:	48 8d ac 24 00 01 00 	lea    0x100(%rsp),%rbp
+    14b6:	00 
+    14b7:	48 89 df             	mov    %rbx,%rdi
+    14ba:	e8 7b ff ff ff       	call   143a <U8Buf<256ul>::U8Buf(unsigned char)>
+    14bf:	48 89 de             	mov    %rbx,%rsi
+    14c2:	48 89 ef             	mov    %rbp,%rdi
+    14c5:	e8 20 07 00 00       	call   1bea <nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)>
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    14ca:	48 89 df             	mov    %rbx,%rdi
+    14cd:	e8 ec 05 00 00       	call   1abe <U8Buf<256ul>::~U8Buf()>
+    arr1.iter().for_each([&](U8Buf<256> &v) -> void { nel::log << v << '\n'; });
+    14d2:	48 89 ee             	mov    %rbp,%rsi
+    14d5:	48 89 df             	mov    %rbx,%rdi
+    14d8:	e8 cf 05 00 00       	call   1aac <nel::heapless::Array<U8Buf<256ul>, 8ul>::iter()>
+    14dd:	48 89 df             	mov    %rbx,%rdi
+    14e0:	e8 83 ff ff ff       	call   1468 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<ex42()::{lambda(U8Buf<256ul>&)#1}>(ex42()::{lambda(U8Buf<256ul>&)#1}&&) [clone .isra.0]>
+}
+    14e5:	48 89 ef             	mov    %rbp,%rdi
+    14e8:	e8 e1 05 00 00       	call   1ace <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()>
+    14ed:	48 81 c4 08 09 00 00 	add    $0x908,%rsp
+    14f4:	5b                   	pop    %rbx
+    14f5:	5d                   	pop    %rbp
+    14f6:	c3                   	ret
+
+00000000000014f7 <ex51()>:
+{
+    14f7:	       41 54                	push   %r12
+    14f9:	       40 b6 ff             	mov    $0xff,%sil
+        nel::log << v << '\n';
+    14fc:	       4c 8d 25 66 2b 00 00 	lea    0x2b66(%rip),%r12        # 4069 <nel::log>
+{
+    1503:	       55                   	push   %rbp
+    1504:	       53                   	push   %rbx
+    1505:	       48 81 ec 00 09 00 00 	sub    $0x900,%rsp
+    150c:	       48 89 e3             	mov    %rsp,%rbx
+    150f:	       48 8d ac 24 00 01 00 	lea    0x100(%rsp),%rbp
+    1516:	       00 
+    1517:	       48 89 df             	mov    %rbx,%rdi
+    151a:	       e8 1b ff ff ff       	call   143a <U8Buf<256ul>::U8Buf(unsigned char)>
+    151f:	       48 89 de             	mov    %rbx,%rsi
+    1522:	       48 89 ef             	mov    %rbp,%rdi
+    1525:	       e8 c0 06 00 00       	call   1bea <nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)>
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    152a:	       48 89 df             	mov    %rbx,%rdi
+    152d:	       e8 8c 05 00 00       	call   1abe <U8Buf<256ul>::~U8Buf()>
+    auto it = arr1.iter();
+    1532:	       48 89 ee             	mov    %rbp,%rsi
+    1535:	       48 89 df             	mov    %rbx,%rdi
+    1538:	       e8 6f 05 00 00       	call   1aac <nel::heapless::Array<U8Buf<256ul>, 8ul>::iter()>
+            return (b_ == e_);
+    153d:	/----> 48 8b 1c 24          	mov    (%rsp),%rbx
+    for (; !it.is_done(); it.inc()) {
+    1541:	|      48 3b 5c 24 08       	cmp    0x8(%rsp),%rbx
+    1546:	|  /-- 74 25                	je     156d <ex51()+0x76>
+        nel::log << v << '\n';
+    1548:	|  |   48 89 de             	mov    %rbx,%rsi
+    154b:	|  |   4c 89 e7             	mov    %r12,%rdi
+            ++b_;
+    154e:	|  |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    1555:	|  |   e8 10 06 00 00       	call   1b6a <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    155a:	|  |   be 0a 00 00 00       	mov    $0xa,%esi
+    155f:	|  |   48 89 c7             	mov    %rax,%rdi
+    1562:	|  |   e8 4e 09 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    1567:	|  |   48 89 1c 24          	mov    %rbx,(%rsp)
+        }
+    156b:	\--|-- eb d0                	jmp    153d <ex51()+0x46>
+}
+    156d:	   \-> 48 89 ef             	mov    %rbp,%rdi
+    1570:	       e8 59 05 00 00       	call   1ace <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()>
+    1575:	       48 81 c4 00 09 00 00 	add    $0x900,%rsp
+    157c:	       5b                   	pop    %rbx
+    157d:	       5d                   	pop    %rbp
+    157e:	       41 5c                	pop    %r12
+    1580:	       c3                   	ret
+
+0000000000001581 <ex52()>:
+{
+    1581:	55                   	push   %rbp
+    1582:	40 b6 ff             	mov    $0xff,%sil
+    1585:	53                   	push   %rbx
+    1586:	48 81 ec 08 09 00 00 	sub    $0x908,%rsp
+    158d:	48 89 e3             	mov    %rsp,%rbx
+    1590:	48 8d ac 24 00 01 00 	lea    0x100(%rsp),%rbp
+    1597:	00 
+    1598:	48 89 df             	mov    %rbx,%rdi
+    159b:	e8 9a fe ff ff       	call   143a <U8Buf<256ul>::U8Buf(unsigned char)>
+    15a0:	48 89 de             	mov    %rbx,%rsi
+    15a3:	48 89 ef             	mov    %rbp,%rdi
+    15a6:	e8 3f 06 00 00       	call   1bea <nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)>
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    15ab:	48 89 df             	mov    %rbx,%rdi
+    15ae:	e8 0b 05 00 00       	call   1abe <U8Buf<256ul>::~U8Buf()>
+    arr1.iter().for_each([&](U8Buf<256> &v) -> void { nel::log << v << '\n'; });
+    15b3:	48 89 ee             	mov    %rbp,%rsi
+    15b6:	48 89 df             	mov    %rbx,%rdi
+    15b9:	e8 ee 04 00 00       	call   1aac <nel::heapless::Array<U8Buf<256ul>, 8ul>::iter()>
+    15be:	48 89 df             	mov    %rbx,%rdi
+    15c1:	e8 a2 fe ff ff       	call   1468 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> >, U8Buf<256ul>&, U8Buf<256ul>&>::for_each<ex42()::{lambda(U8Buf<256ul>&)#1}>(ex42()::{lambda(U8Buf<256ul>&)#1}&&) [clone .isra.0]>
+}
+    15c6:	48 89 ef             	mov    %rbp,%rdi
+    15c9:	e8 00 05 00 00       	call   1ace <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()>
+    15ce:	48 81 c4 08 09 00 00 	add    $0x908,%rsp
+    15d5:	5b                   	pop    %rbx
+    15d6:	5d                   	pop    %rbp
+    15d7:	c3                   	ret
+
+00000000000015d8 <ex62()>:
+{
+    15d8:	          41 56                	push   %r14
+    15da:	          40 b6 ff             	mov    $0xff,%sil
+        nel::log << '[' << i << ']' << ':' << e << '\n';
+    15dd:	          4c 8d 35 85 2a 00 00 	lea    0x2a85(%rip),%r14        # 4069 <nel::log>
+{
+    15e4:	          41 55                	push   %r13
+    15e6:	          41 54                	push   %r12
+    auto it = arr1.iter().first_n(2);
+    15e8:	          45 31 e4             	xor    %r12d,%r12d
+{
+    15eb:	          55                   	push   %rbp
+    15ec:	          53                   	push   %rbx
+    15ed:	          48 81 ec 00 09 00 00 	sub    $0x900,%rsp
+    15f4:	          48 89 e3             	mov    %rsp,%rbx
+    15f7:	          48 8d ac 24 00 01 00 	lea    0x100(%rsp),%rbp
+    15fe:	          00 
+    15ff:	          48 89 df             	mov    %rbx,%rdi
+    1602:	          e8 33 fe ff ff       	call   143a <U8Buf<256ul>::U8Buf(unsigned char)>
+    1607:	          48 89 de             	mov    %rbx,%rsi
+    160a:	          48 89 ef             	mov    %rbp,%rdi
+    160d:	          e8 d8 05 00 00       	call   1bea <nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)>
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    1612:	          48 89 df             	mov    %rbx,%rdi
+    1615:	          e8 a4 04 00 00       	call   1abe <U8Buf<256ul>::~U8Buf()>
+    auto it = arr1.iter().first_n(2);
+    161a:	          48 89 df             	mov    %rbx,%rdi
+    161d:	          48 89 ee             	mov    %rbp,%rsi
+    1620:	          e8 87 04 00 00       	call   1aac <nel::heapless::Array<U8Buf<256ul>, 8ul>::iter()>
+            , e_(move(o.e_))
+    1625:	          4c 8b 6c 24 08       	mov    0x8(%rsp),%r13
+         * @param fn callable as bool(U &acc, OutT e), returns true to continue, false to stop.
+         * @return: true if iteration completed successfully
+         * @return: false if iteration was interrupted, the item fn stopped on is consumed.
+         */
+        template<typename U, typename F>
+        bool try_fold(U &acc, F &&fn)
+    162a:	          48 8b 1c 24          	mov    (%rsp),%rbx
+                Optional<OutT> r = self().next();
+                if (r.is_none()) { return true; }
+                if (!fn(acc, r.unwrap())) { return false; }
+            }
+#    else
+            while (!self().is_done()) {
+    162e:	/-------> 49 39 dd             	cmp    %rbx,%r13
+    1631:	|  /----- 74 56                	je     1689 <ex62()+0xb1>
+        nel::log << '[' << i << ']' << ':' << e << '\n';
+    1633:	|  |      be 5b 00 00 00       	mov    $0x5b,%esi
+    1638:	|  |      4c 89 f7             	mov    %r14,%rdi
+    163b:	|  |      e8 75 08 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    1640:	|  |      4c 89 e6             	mov    %r12,%rsi
+    1643:	|  |      48 89 c7             	mov    %rax,%rdi
+    1646:	|  |      e8 1e 09 00 00       	call   1f69 <nel::operator<<(nel::Log&, unsigned long)>
+    164b:	|  |      be 5d 00 00 00       	mov    $0x5d,%esi
+    1650:	|  |      48 89 c7             	mov    %rax,%rdi
+    1653:	|  |      e8 5d 08 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    1658:	|  |      be 3a 00 00 00       	mov    $0x3a,%esi
+    165d:	|  |      48 89 c7             	mov    %rax,%rdi
+    1660:	|  |      e8 50 08 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    1665:	|  |      48 89 de             	mov    %rbx,%rsi
+                OutT e = self().deref();
+                self().inc();
+                if (!fn(acc, forward<OutT>(e))) { return false; }
+    1668:	|  |      48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    166f:	|  |      48 89 c7             	mov    %rax,%rdi
+    1672:	|  |      e8 f3 04 00 00       	call   1b6a <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    1677:	|  |      be 0a 00 00 00       	mov    $0xa,%esi
+    167c:	|  |      48 89 c7             	mov    %rax,%rdi
+    167f:	|  |      e8 31 08 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    1684:	|  |      4d 85 e4             	test   %r12,%r12
+    1687:	|  |  /-- 74 18                	je     16a1 <ex62()+0xc9>
+}
+    1689:	|  \--|-> 48 89 ef             	mov    %rbp,%rdi
+    168c:	|     |   e8 3d 04 00 00       	call   1ace <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()>
+    1691:	|     |   48 81 c4 00 09 00 00 	add    $0x900,%rsp
+    1698:	|     |   5b                   	pop    %rbx
+    1699:	|     |   5d                   	pop    %rbp
+    169a:	|     |   41 5c                	pop    %r12
+    169c:	|     |   41 5d                	pop    %r13
+    169e:	|     |   41 5e                	pop    %r14
+    16a0:	|     |   c3                   	ret
+    16a1:	|     \-> 41 bc 01 00 00 00    	mov    $0x1,%r12d
+    16a7:	\-------- eb 85                	jmp    162e <ex62()+0x56>
+
+00000000000016a9 <ex71()>:
+{
+    16a9:	       41 56                	push   %r14
+    16ab:	       40 b6 ff             	mov    $0xff,%sil
+    16ae:	       41 55                	push   %r13
+        nel::log << '[' << i << ']' << ':' << e << '\n';
+    16b0:	       4c 8d 2d b2 29 00 00 	lea    0x29b2(%rip),%r13        # 4069 <nel::log>
+{
+    16b7:	       41 54                	push   %r12
+    16b9:	       55                   	push   %rbp
+    16ba:	       53                   	push   %rbx
+    16bb:	       48 81 ec 00 09 00 00 	sub    $0x900,%rsp
+    16c2:	       48 89 e3             	mov    %rsp,%rbx
+    16c5:	       48 8d ac 24 00 01 00 	lea    0x100(%rsp),%rbp
+    16cc:	       00 
+    16cd:	       48 89 df             	mov    %rbx,%rdi
+    16d0:	       e8 65 fd ff ff       	call   143a <U8Buf<256ul>::U8Buf(unsigned char)>
+    16d5:	       48 89 de             	mov    %rbx,%rsi
+    16d8:	       48 89 ef             	mov    %rbp,%rdi
+    16db:	       e8 0a 05 00 00       	call   1bea <nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)>
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    16e0:	       48 89 df             	mov    %rbx,%rdi
+    16e3:	       e8 d6 03 00 00       	call   1abe <U8Buf<256ul>::~U8Buf()>
+    auto it = arr1.iter().first_n(2);
+    16e8:	       48 89 df             	mov    %rbx,%rdi
+    16eb:	       48 89 ee             	mov    %rbp,%rsi
+    Index i = 0;
+    16ee:	       31 db                	xor    %ebx,%ebx
+    auto it = arr1.iter().first_n(2);
+    16f0:	       e8 b7 03 00 00       	call   1aac <nel::heapless::Array<U8Buf<256ul>, 8ul>::iter()>
+            : b_(move(o.b_))
+    16f5:	       4c 8b 34 24          	mov    (%rsp),%r14
+    for (; !it.is_done(); it.inc()) {
+    16f9:	/----> 49 89 dc             	mov    %rbx,%r12
+    16fc:	|      49 c1 e4 08          	shl    $0x8,%r12
+    1700:	|      4d 01 f4             	add    %r14,%r12
+    1703:	|      48 83 fb 02          	cmp    $0x2,%rbx
+    1707:	|  /-- 74 4f                	je     1758 <ex71()+0xaf>
+        nel::log << '[' << i << ']' << ':' << e << '\n';
+    1709:	|  |   be 5b 00 00 00       	mov    $0x5b,%esi
+    170e:	|  |   4c 89 ef             	mov    %r13,%rdi
+    1711:	|  |   e8 9f 07 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    1716:	|  |   48 89 de             	mov    %rbx,%rsi
+        ++i;
+    1719:	|  |   48 ff c3             	inc    %rbx
+        nel::log << '[' << i << ']' << ':' << e << '\n';
+    171c:	|  |   48 89 c7             	mov    %rax,%rdi
+    171f:	|  |   e8 45 08 00 00       	call   1f69 <nel::operator<<(nel::Log&, unsigned long)>
+    1724:	|  |   be 5d 00 00 00       	mov    $0x5d,%esi
+    1729:	|  |   48 89 c7             	mov    %rax,%rdi
+    172c:	|  |   e8 84 07 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    1731:	|  |   be 3a 00 00 00       	mov    $0x3a,%esi
+    1736:	|  |   48 89 c7             	mov    %rax,%rdi
+    1739:	|  |   e8 77 07 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    173e:	|  |   4c 89 e6             	mov    %r12,%rsi
+    1741:	|  |   48 89 c7             	mov    %rax,%rdi
+    1744:	|  |   e8 21 04 00 00       	call   1b6a <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    1749:	|  |   be 0a 00 00 00       	mov    $0xa,%esi
+    174e:	|  |   48 89 c7             	mov    %rax,%rdi
+    1751:	|  |   e8 5f 07 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+
+        void inc(void)
+        {
+            inner_.inc();
+            ++current_;
+        }
+    1756:	\--|-- eb a1                	jmp    16f9 <ex71()+0x50>
+}
+    1758:	   \-> 48 89 ef             	mov    %rbp,%rdi
+    175b:	       e8 6e 03 00 00       	call   1ace <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()>
+    1760:	       48 81 c4 00 09 00 00 	add    $0x900,%rsp
+    1767:	       5b                   	pop    %rbx
+    1768:	       5d                   	pop    %rbp
+    1769:	       41 5c                	pop    %r12
+    176b:	       41 5d                	pop    %r13
+    176d:	       41 5e                	pop    %r14
+    176f:	       c3                   	ret
+
+0000000000001770 <ex72()>:
+{
+    1770:	          41 56                	push   %r14
+    1772:	          40 b6 ff             	mov    $0xff,%sil
+        nel::log << '[' << i << ']' << ':' << e << '\n';
+    1775:	          4c 8d 35 ed 28 00 00 	lea    0x28ed(%rip),%r14        # 4069 <nel::log>
+{
+    177c:	          41 55                	push   %r13
+    177e:	          41 54                	push   %r12
+    auto it = arr1.iter().first_n(2);
+    1780:	          45 31 e4             	xor    %r12d,%r12d
+{
+    1783:	          55                   	push   %rbp
+    1784:	          53                   	push   %rbx
+    1785:	          48 81 ec 00 09 00 00 	sub    $0x900,%rsp
+    178c:	          48 89 e3             	mov    %rsp,%rbx
+    178f:	          48 8d ac 24 00 01 00 	lea    0x100(%rsp),%rbp
+    1796:	          00 
+    1797:	          48 89 df             	mov    %rbx,%rdi
+    179a:	          e8 9b fc ff ff       	call   143a <U8Buf<256ul>::U8Buf(unsigned char)>
+    179f:	          48 89 de             	mov    %rbx,%rsi
+    17a2:	          48 89 ef             	mov    %rbp,%rdi
+    17a5:	          e8 40 04 00 00       	call   1bea <nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)>
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    17aa:	          48 89 df             	mov    %rbx,%rdi
+    17ad:	          e8 0c 03 00 00       	call   1abe <U8Buf<256ul>::~U8Buf()>
+    auto it = arr1.iter().first_n(2);
+    17b2:	          48 89 df             	mov    %rbx,%rdi
+    17b5:	          48 89 ee             	mov    %rbp,%rsi
+    17b8:	          e8 ef 02 00 00       	call   1aac <nel::heapless::Array<U8Buf<256ul>, 8ul>::iter()>
+            , e_(move(o.e_))
+    17bd:	          4c 8b 6c 24 08       	mov    0x8(%rsp),%r13
+        bool try_fold(U &acc, F &&fn)
+    17c2:	          48 8b 1c 24          	mov    (%rsp),%rbx
+            while (!self().is_done()) {
+    17c6:	/-------> 49 39 dd             	cmp    %rbx,%r13
+    17c9:	|  /----- 74 56                	je     1821 <ex72()+0xb1>
+        nel::log << '[' << i << ']' << ':' << e << '\n';
+    17cb:	|  |      be 5b 00 00 00       	mov    $0x5b,%esi
+    17d0:	|  |      4c 89 f7             	mov    %r14,%rdi
+    17d3:	|  |      e8 dd 06 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    17d8:	|  |      4c 89 e6             	mov    %r12,%rsi
+    17db:	|  |      48 89 c7             	mov    %rax,%rdi
+    17de:	|  |      e8 86 07 00 00       	call   1f69 <nel::operator<<(nel::Log&, unsigned long)>
+    17e3:	|  |      be 5d 00 00 00       	mov    $0x5d,%esi
+    17e8:	|  |      48 89 c7             	mov    %rax,%rdi
+    17eb:	|  |      e8 c5 06 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    17f0:	|  |      be 3a 00 00 00       	mov    $0x3a,%esi
+    17f5:	|  |      48 89 c7             	mov    %rax,%rdi
+    17f8:	|  |      e8 b8 06 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    17fd:	|  |      48 89 de             	mov    %rbx,%rsi
+                if (!fn(acc, forward<OutT>(e))) { return false; }
+    1800:	|  |      48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    1807:	|  |      48 89 c7             	mov    %rax,%rdi
+    180a:	|  |      e8 5b 03 00 00       	call   1b6a <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    180f:	|  |      be 0a 00 00 00       	mov    $0xa,%esi
+    1814:	|  |      48 89 c7             	mov    %rax,%rdi
+    1817:	|  |      e8 99 06 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    181c:	|  |      4d 85 e4             	test   %r12,%r12
+    181f:	|  |  /-- 74 18                	je     1839 <ex72()+0xc9>
+}
+    1821:	|  \--|-> 48 89 ef             	mov    %rbp,%rdi
+    1824:	|     |   e8 a5 02 00 00       	call   1ace <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()>
+    1829:	|     |   48 81 c4 00 09 00 00 	add    $0x900,%rsp
+    1830:	|     |   5b                   	pop    %rbx
+    1831:	|     |   5d                   	pop    %rbp
+    1832:	|     |   41 5c                	pop    %r12
+    1834:	|     |   41 5d                	pop    %r13
+    1836:	|     |   41 5e                	pop    %r14
+    1838:	|     |   c3                   	ret
+    1839:	|     \-> 41 bc 01 00 00 00    	mov    $0x1,%r12d
+    183f:	\-------- eb 85                	jmp    17c6 <ex72()+0x56>
+
+0000000000001841 <ex1()>:
+{
+    1841:	    41 54                	push   %r12
+    1843:	    40 b6 ff             	mov    $0xff,%sil
+    1846:	    55                   	push   %rbp
+    1847:	    53                   	push   %rbx
+    1848:	    48 81 ec 00 09 00 00 	sub    $0x900,%rsp
+    184f:	    48 89 e3             	mov    %rsp,%rbx
+    1852:	    4c 8d a4 24 00 01 00 	lea    0x100(%rsp),%r12
+    1859:	    00 
+            ++b_;
+    185a:	    48 8d ac 24 00 02 00 	lea    0x200(%rsp),%rbp
+    1861:	    00 
+    1862:	    48 89 df             	mov    %rbx,%rdi
+    1865:	    e8 d0 fb ff ff       	call   143a <U8Buf<256ul>::U8Buf(unsigned char)>
+    186a:	    48 89 de             	mov    %rbx,%rsi
+    186d:	    4c 89 e7             	mov    %r12,%rdi
+    1870:	    e8 75 03 00 00       	call   1bea <nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)>
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    1875:	    48 89 df             	mov    %rbx,%rdi
+        // TODO: replace <<(Log ) with dbgfmt, so separate out from
+        // any other form of conversion to charstring.
+        // TODO: insert into formatter and not final dest type.
+        friend Log &operator<<(Log &outs, Array const &v)
+        {
+            outs << "Array<" << v.len() << ">{";
+    1878:	    48 8d 1d ea 27 00 00 	lea    0x27ea(%rip),%rbx        # 4069 <nel::log>
+    187f:	    e8 3a 02 00 00       	call   1abe <U8Buf<256ul>::~U8Buf()>
+    1884:	    48 8d 35 ca 07 00 00 	lea    0x7ca(%rip),%rsi        # 2055 <_IO_stdin_used+0x55>
+    188b:	    48 89 df             	mov    %rbx,%rdi
+    188e:	    e8 3b 06 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+    1893:	    be 08 00 00 00       	mov    $0x8,%esi
+    1898:	    48 89 c7             	mov    %rax,%rdi
+    189b:	    e8 c9 06 00 00       	call   1f69 <nel::operator<<(nel::Log&, unsigned long)>
+    18a0:	    48 8d 35 ab 07 00 00 	lea    0x7ab(%rip),%rsi        # 2052 <_IO_stdin_used+0x52>
+    18a7:	    48 89 c7             	mov    %rax,%rdi
+    18aa:	    e8 1f 06 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+            outs << '[';
+    18af:	    be 5b 00 00 00       	mov    $0x5b,%esi
+    18b4:	    48 89 df             	mov    %rbx,%rdi
+    18b7:	    e8 f9 05 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+                outs << it2.deref();
+    18bc:	    4c 89 e6             	mov    %r12,%rsi
+    18bf:	    48 89 df             	mov    %rbx,%rdi
+    18c2:	    e8 a3 02 00 00       	call   1b6a <operator<<(nel::Log&, U8Buf<256ul> const&)>
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    18c7:	/-> be 2c 00 00 00       	mov    $0x2c,%esi
+    18cc:	|   48 89 df             	mov    %rbx,%rdi
+    18cf:	|   e8 e1 05 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    18d4:	|   48 89 ee             	mov    %rbp,%rsi
+    18d7:	|   48 81 c5 00 01 00 00 	add    $0x100,%rbp
+    18de:	|   48 89 c7             	mov    %rax,%rdi
+    18e1:	|   e8 84 02 00 00       	call   1b6a <operator<<(nel::Log&, U8Buf<256ul> const&)>
+            for (; !self().is_done(); self().inc()) {
+    18e6:	|   48 8d 84 24 00 09 00 	lea    0x900(%rsp),%rax
+    18ed:	|   00 
+    18ee:	|   48 39 c5             	cmp    %rax,%rbp
+    18f1:	\-- 75 d4                	jne    18c7 <ex1()+0x86>
+            outs << ']';
+    18f3:	    48 89 df             	mov    %rbx,%rdi
+    18f6:	    be 5d 00 00 00       	mov    $0x5d,%esi
+    18fb:	    e8 b5 05 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+            outs << v.iter();
+            outs << '}';
+    1900:	    48 89 df             	mov    %rbx,%rdi
+    1903:	    be 7d 00 00 00       	mov    $0x7d,%esi
+    1908:	    e8 a8 05 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    nel::log << arr1 << '\n';
+    190d:	    48 89 df             	mov    %rbx,%rdi
+    1910:	    be 0a 00 00 00       	mov    $0xa,%esi
+    1915:	    e8 9b 05 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+}
+    191a:	    4c 89 e7             	mov    %r12,%rdi
+    191d:	    e8 ac 01 00 00       	call   1ace <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()>
+    1922:	    48 81 c4 00 09 00 00 	add    $0x900,%rsp
+    1929:	    5b                   	pop    %rbx
+    192a:	    5d                   	pop    %rbp
+    192b:	    41 5c                	pop    %r12
+    192d:	    c3                   	ret
+
+000000000000192e <ex3()>:
+{
+    192e:	41 57                	push   %r15
+    1930:	40 b6 ff             	mov    $0xff,%sil
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1933:	4c 8d 3d 22 07 00 00 	lea    0x722(%rip),%r15        # 205c <_IO_stdin_used+0x5c>
+    193a:	41 56                	push   %r14
+            , file_name_(file_name)
+    193c:	4c 8d 35 1d 07 00 00 	lea    0x71d(%rip),%r14        # 2060 <_IO_stdin_used+0x60>
+    1943:	41 55                	push   %r13
+    1945:	41 54                	push   %r12
+    1947:	55                   	push   %rbp
+    1948:	53                   	push   %rbx
+    1949:	48 81 ec 38 09 00 00 	sub    $0x938,%rsp
+    1950:	48 8d 5c 24 30       	lea    0x30(%rsp),%rbx
+            return Array(v);
+    1955:	4c 8d a4 24 30 01 00 	lea    0x130(%rsp),%r12
+    195c:	00 
+    195d:	48 89 df             	mov    %rbx,%rdi
+    arr1.try_get(0).unwrap() = U8Buf<256>(0x11);
+    1960:	48 8d 6c 24 08       	lea    0x8(%rsp),%rbp
+    1965:	4c 8d 6c 24 18       	lea    0x18(%rsp),%r13
+    196a:	e8 cb fa ff ff       	call   143a <U8Buf<256ul>::U8Buf(unsigned char)>
+    196f:	48 89 de             	mov    %rbx,%rsi
+    1972:	4c 89 e7             	mov    %r12,%rdi
+    1975:	e8 70 02 00 00       	call   1bea <nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)>
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    197a:	48 89 df             	mov    %rbx,%rdi
+    197d:	e8 3c 01 00 00       	call   1abe <U8Buf<256ul>::~U8Buf()>
+    1982:	48 89 df             	mov    %rbx,%rdi
+    1985:	40 b6 11             	mov    $0x11,%sil
+    1988:	e8 ad fa ff ff       	call   143a <U8Buf<256ul>::U8Buf(unsigned char)>
+    arr1.try_get(0).unwrap() = U8Buf<256>(0x11);
+    198d:	4c 89 ee             	mov    %r13,%rsi
+    1990:	48 89 ef             	mov    %rbp,%rdi
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+            : value_(forward<Type>(val))
+    1993:	4c 89 64 24 10       	mov    %r12,0x10(%rsp)
+            : fn_name_(fn_name)
+    1998:	4c 89 7c 24 18       	mov    %r15,0x18(%rsp)
+            , file_name_(file_name)
+    199d:	4c 89 74 24 20       	mov    %r14,0x20(%rsp)
+            return *this;
+        }
+
+    private:
+        constexpr Optional(Phantom<Tag::SOME> const, T &&v)
+            : tag_(Tag::SOME)
+    19a2:	c7 44 24 08 02 00 00 	movl   $0x2,0x8(%rsp)
+    19a9:	00 
+            , line_num_(line_num)
+    19aa:	c7 44 24 28 3c 00 00 	movl   $0x3c,0x28(%rsp)
+    19b1:	00 
+    19b2:	e8 7b 01 00 00       	call   1b32 <nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)>
+            nel::elem::move(data_, o.data_, N);
+    19b7:	ba 00 01 00 00       	mov    $0x100,%edx
+    19bc:	48 89 de             	mov    %rbx,%rsi
+    19bf:	48 89 c7             	mov    %rax,%rdi
+    19c2:	e8 77 02 00 00       	call   1c3e <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    19c7:	48 89 ef             	mov    %rbp,%rdi
+    19ca:	e8 27 01 00 00       	call   1af6 <nel::Optional<U8Buf<256ul>&>::~Optional()>
+    19cf:	48 89 df             	mov    %rbx,%rdi
+    19d2:	e8 e7 00 00 00       	call   1abe <U8Buf<256ul>::~U8Buf()>
+        }
+    19d7:	48 89 df             	mov    %rbx,%rdi
+    19da:	40 b6 22             	mov    $0x22,%sil
+    19dd:	e8 58 fa ff ff       	call   143a <U8Buf<256ul>::U8Buf(unsigned char)>
+    arr1.try_get(5).unwrap() = U8Buf<256>(0x22);
+    19e2:	4c 89 ee             	mov    %r13,%rsi
+    19e5:	48 89 ef             	mov    %rbp,%rdi
+            : fn_name_(fn_name)
+    19e8:	4c 89 7c 24 18       	mov    %r15,0x18(%rsp)
+    19ed:	48 8d 84 24 30 06 00 	lea    0x630(%rsp),%rax
+    19f4:	00 
+            , file_name_(file_name)
+    19f5:	4c 89 74 24 20       	mov    %r14,0x20(%rsp)
+    19fa:	c7 44 24 08 02 00 00 	movl   $0x2,0x8(%rsp)
+    1a01:	00 
+    1a02:	48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1a07:	c7 44 24 28 3d 00 00 	movl   $0x3d,0x28(%rsp)
+    1a0e:	00 
+    1a0f:	e8 1e 01 00 00       	call   1b32 <nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)>
+            nel::elem::move(data_, o.data_, N);
+    1a14:	ba 00 01 00 00       	mov    $0x100,%edx
+    1a19:	48 89 de             	mov    %rbx,%rsi
+    1a1c:	48 89 c7             	mov    %rax,%rdi
+    1a1f:	e8 1a 02 00 00       	call   1c3e <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    1a24:	48 89 ef             	mov    %rbp,%rdi
+    1a27:	e8 ca 00 00 00       	call   1af6 <nel::Optional<U8Buf<256ul>&>::~Optional()>
+    1a2c:	48 89 df             	mov    %rbx,%rdi
+    1a2f:	e8 8a 00 00 00       	call   1abe <U8Buf<256ul>::~U8Buf()>
+        }
+    1a34:	48 89 df             	mov    %rbx,%rdi
+    1a37:	40 b6 33             	mov    $0x33,%sil
+    1a3a:	e8 fb f9 ff ff       	call   143a <U8Buf<256ul>::U8Buf(unsigned char)>
+    arr1.try_get(6).unwrap() = U8Buf<256>(0x33);
+    1a3f:	4c 89 ee             	mov    %r13,%rsi
+    1a42:	48 89 ef             	mov    %rbp,%rdi
+            : fn_name_(fn_name)
+    1a45:	4c 89 7c 24 18       	mov    %r15,0x18(%rsp)
+    1a4a:	48 8d 84 24 30 07 00 	lea    0x730(%rsp),%rax
+    1a51:	00 
+            , file_name_(file_name)
+    1a52:	4c 89 74 24 20       	mov    %r14,0x20(%rsp)
+    1a57:	c7 44 24 08 02 00 00 	movl   $0x2,0x8(%rsp)
+    1a5e:	00 
+    1a5f:	48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1a64:	c7 44 24 28 3e 00 00 	movl   $0x3e,0x28(%rsp)
+    1a6b:	00 
+    1a6c:	e8 c1 00 00 00       	call   1b32 <nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)>
+            nel::elem::move(data_, o.data_, N);
+    1a71:	48 89 de             	mov    %rbx,%rsi
+    1a74:	ba 00 01 00 00       	mov    $0x100,%edx
+    1a79:	48 89 c7             	mov    %rax,%rdi
+    1a7c:	e8 bd 01 00 00       	call   1c3e <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    1a81:	48 89 ef             	mov    %rbp,%rdi
+    1a84:	e8 6d 00 00 00       	call   1af6 <nel::Optional<U8Buf<256ul>&>::~Optional()>
+    1a89:	48 89 df             	mov    %rbx,%rdi
+    1a8c:	e8 2d 00 00 00       	call   1abe <U8Buf<256ul>::~U8Buf()>
+}
+    1a91:	4c 89 e7             	mov    %r12,%rdi
+    1a94:	e8 35 00 00 00       	call   1ace <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()>
+    1a99:	48 81 c4 38 09 00 00 	add    $0x938,%rsp
+    1aa0:	5b                   	pop    %rbx
+    1aa1:	5d                   	pop    %rbp
+    1aa2:	41 5c                	pop    %r12
+    1aa4:	41 5d                	pop    %r13
+    1aa6:	41 5e                	pop    %r14
+    1aa8:	41 5f                	pop    %r15
+    1aaa:	c3                   	ret
+    1aab:	90                   	nop
+
+0000000000001aac <nel::heapless::Array<U8Buf<256ul>, 8ul>::iter()>:
+            : b_(arr)
+    1aac:	48 89 37             	mov    %rsi,(%rdi)
+            , e_(arr + len)
+    1aaf:	48 81 c6 00 08 00 00 	add    $0x800,%rsi
+        constexpr auto iter(void)
+    1ab6:	48 89 f8             	mov    %rdi,%rax
+    1ab9:	48 89 77 08          	mov    %rsi,0x8(%rdi)
+        }
+    1abd:	c3                   	ret
+
+0000000000001abe <U8Buf<256ul>::~U8Buf()>:
+        U8Buf<256>(0x29),
+    1abe:	ba 00 01 00 00       	mov    $0x100,%edx
+    1ac3:	be a5 00 00 00       	mov    $0xa5,%esi
+    1ac8:	e9 69 01 00 00       	jmp    1c36 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1acd:	90                   	nop
+
+0000000000001ace <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()>:
+        ~Array() = default;
+    1ace:	       55                   	push   %rbp
+    1acf:	       48 89 fd             	mov    %rdi,%rbp
+    1ad2:	       53                   	push   %rbx
+    1ad3:	       48 8d 9f 00 08 00 00 	lea    0x800(%rdi),%rbx
+    1ada:	       52                   	push   %rdx
+    1adb:	/----> 48 39 eb             	cmp    %rbp,%rbx
+    1ade:	|  /-- 74 11                	je     1af1 <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()+0x23>
+    1ae0:	|  |   48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    1ae7:	|  |   48 89 df             	mov    %rbx,%rdi
+    1aea:	|  |   e8 cf ff ff ff       	call   1abe <U8Buf<256ul>::~U8Buf()>
+    1aef:	\--|-- eb ea                	jmp    1adb <nel::heapless::Array<U8Buf<256ul>, 8ul>::~Array()+0xd>
+    1af1:	   \-> 58                   	pop    %rax
+    1af2:	       5b                   	pop    %rbx
+    1af3:	       5d                   	pop    %rbp
+    1af4:	       c3                   	ret
+    1af5:	       90                   	nop
+
+0000000000001af6 <nel::Optional<U8Buf<256ul>&>::~Optional()>:
+            switch (tag_) { // optional::dtor
+    1af6:	    83 3f 02             	cmpl   $0x2,(%rdi)
+    1af9:	/-- 76 35                	jbe    1b30 <nel::Optional<U8Buf<256ul>&>::~Optional()+0x3a>
+        constexpr ~Optional(void)
+    1afb:	|   48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    1aff:	|   48 8d 05 fe 04 00 00 	lea    0x4fe(%rip),%rax        # 2004 <_IO_stdin_used+0x4>
+                    nel::panic("bad Optional");
+    1b06:	|   48 8d 3d 15 05 00 00 	lea    0x515(%rip),%rdi        # 2022 <_IO_stdin_used+0x22>
+    1b0d:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1b12:	|   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    1b17:	|   48 8d 05 f0 04 00 00 	lea    0x4f0(%rip),%rax        # 200e <_IO_stdin_used+0xe>
+    1b1e:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1b23:	|   c7 44 24 18 87 00 00 	movl   $0x87,0x18(%rsp)
+    1b2a:	|   00 
+    1b2b:	|   e8 c2 f5 ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+    1b30:	\-> c3                   	ret
+    1b31:	    90                   	nop
+
+0000000000001b32 <nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)>:
+         *
+         * @returns value contained by the Optional if it's a 'Some'.
+         *
+         * @warning If the optional does not contain a Some, then abort/panic.
+         */
+        T unwrap(Context const &ctx = Context())
+    1b32:	          51                   	push   %rcx
+            auto tag = tag_;
+    1b33:	          8b 07                	mov    (%rdi),%eax
+            tag_ = Tag::INVAL;
+    1b35:	          45 31 c0             	xor    %r8d,%r8d
+    1b38:	          44 89 07             	mov    %r8d,(%rdi)
+            switch (tag) { // optional::consume
+    1b3b:	          83 f8 02             	cmp    $0x2,%eax
+    1b3e:	/-------- 74 24                	je     1b64 <nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)+0x32>
+    1b40:	|  /----- 7f 16                	jg     1b58 <nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)+0x26>
+                    nel::panic("invalid Optional", ctx);
+    1b42:	|  |      48 8d 3d f1 04 00 00 	lea    0x4f1(%rip),%rdi        # 203a <_IO_stdin_used+0x3a>
+            switch (tag) { // optional::consume
+    1b49:	|  |      85 c0                	test   %eax,%eax
+    1b4b:	|  |  /-- 74 12                	je     1b5f <nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)+0x2d>
+    1b4d:	|  |  |   ff c8                	dec    %eax
+        {
+            return consume<T>([](T &&some) -> T { return some; },
+                              [&](void) -> T { nel::panic("not a Some", ctx); },
+    1b4f:	|  |  |   48 8d 3d d9 04 00 00 	lea    0x4d9(%rip),%rdi        # 202f <_IO_stdin_used+0x2f>
+            switch (tag) { // optional::consume
+    1b56:	|  |  +-- 74 07                	je     1b5f <nel::Optional<U8Buf<256ul>&>::unwrap(nel::Context const&)+0x2d>
+                    nel::panic("bad Optional", ctx);
+    1b58:	|  \--|-> 48 8d 3d c3 04 00 00 	lea    0x4c3(%rip),%rdi        # 2022 <_IO_stdin_used+0x22>
+                    nel::panic("invalid Optional", ctx);
+    1b5f:	|     \-> e8 8e f5 ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+                              ctx);
+    1b64:	\-------> 48 8b 47 08          	mov    0x8(%rdi),%rax
+        }
+    1b68:	          5a                   	pop    %rdx
+    1b69:	          c3                   	ret
+
+0000000000001b6a <operator<<(nel::Log&, U8Buf<256ul> const&)>:
+}
+    1b6a:	    41 54                	push   %r12
+    1b6c:	    49 89 f4             	mov    %rsi,%r12
+#if defined(RUST_LIKE)
+    1b6f:	    48 8d 35 d5 04 00 00 	lea    0x4d5(%rip),%rsi        # 204b <_IO_stdin_used+0x4b>
+}
+    1b76:	    55                   	push   %rbp
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    1b77:	    bd 01 00 00 00       	mov    $0x1,%ebp
+}
+    1b7c:	    53                   	push   %rbx
+    1b7d:	    48 89 fb             	mov    %rdi,%rbx
+#if defined(RUST_LIKE)
+    1b80:	    e8 49 03 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+    1b85:	    be 00 01 00 00       	mov    $0x100,%esi
+    1b8a:	    48 89 c7             	mov    %rax,%rdi
+    1b8d:	    e8 d7 03 00 00       	call   1f69 <nel::operator<<(nel::Log&, unsigned long)>
+    1b92:	    48 8d 35 b9 04 00 00 	lea    0x4b9(%rip),%rsi        # 2052 <_IO_stdin_used+0x52>
+    1b99:	    48 89 c7             	mov    %rax,%rdi
+    1b9c:	    e8 2d 03 00 00       	call   1ece <nel::operator<<(nel::Log&, char const*)>
+{
+    1ba1:	    41 0f b6 34 24       	movzbl (%r12),%esi
+    1ba6:	    48 89 df             	mov    %rbx,%rdi
+    1ba9:	    e8 38 03 00 00       	call   1ee6 <nel::operator<<(nel::Log&, unsigned char)>
+
+    1bae:	/-> be 20 00 00 00       	mov    $0x20,%esi
+    1bb3:	|   48 89 df             	mov    %rbx,%rdi
+    1bb6:	|   e8 fa 02 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+    1bbb:	|   41 0f b6 34 2c       	movzbl (%r12,%rbp,1),%esi
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    1bc0:	|   48 ff c5             	inc    %rbp
+
+    1bc3:	|   48 89 c7             	mov    %rax,%rdi
+    1bc6:	|   e8 1b 03 00 00       	call   1ee6 <nel::operator<<(nel::Log&, unsigned char)>
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    1bcb:	|   48 81 fd 00 01 00 00 	cmp    $0x100,%rbp
+    1bd2:	\-- 75 da                	jne    1bae <operator<<(nel::Log&, U8Buf<256ul> const&)+0x44>
+        auto e = it.next();
+    1bd4:	    48 89 df             	mov    %rbx,%rdi
+    1bd7:	    be 7d 00 00 00       	mov    $0x7d,%esi
+    1bdc:	    e8 d4 02 00 00       	call   1eb5 <nel::operator<<(nel::Log&, char)>
+        // causes bigger loops
+    1be1:	    48 89 d8             	mov    %rbx,%rax
+    1be4:	    5b                   	pop    %rbx
+    1be5:	    5d                   	pop    %rbp
+    1be6:	    41 5c                	pop    %r12
+    1be8:	    c3                   	ret
+    1be9:	    90                   	nop
+
+0000000000001bea <nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)>:
+        constexpr Array(Type const &v)
+    1bea:	       55                   	push   %rbp
+    1beb:	       48 89 f5             	mov    %rsi,%rbp
+            iter().for_each([&](auto &e) { new (&e) Type(v); });
+    1bee:	       48 89 fe             	mov    %rdi,%rsi
+        constexpr Array(Type const &v)
+    1bf1:	       53                   	push   %rbx
+    1bf2:	       48 83 ec 18          	sub    $0x18,%rsp
+            iter().for_each([&](auto &e) { new (&e) Type(v); });
+    1bf6:	       48 89 e0             	mov    %rsp,%rax
+    1bf9:	       48 89 c7             	mov    %rax,%rdi
+    1bfc:	       e8 ab fe ff ff       	call   1aac <nel::heapless::Array<U8Buf<256ul>, 8ul>::iter()>
+            return (b_ == e_);
+    1c01:	/----> 48 8b 1c 24          	mov    (%rsp),%rbx
+            for (; !self().is_done(); self().inc()) {
+    1c05:	|      48 3b 5c 24 08       	cmp    0x8(%rsp),%rbx
+    1c0a:	|  /-- 74 1d                	je     1c29 <nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)+0x3f>
+            nel::elem::copy(data_, o.data_, N);
+    1c0c:	|  |   48 89 df             	mov    %rbx,%rdi
+    1c0f:	|  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1c14:	|  |   48 89 ee             	mov    %rbp,%rsi
+            ++b_;
+    1c17:	|  |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    1c1e:	|  |   e8 0d 00 00 00       	call   1c30 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    1c23:	|  |   48 89 1c 24          	mov    %rbx,(%rsp)
+        }
+    1c27:	\--|-- eb d8                	jmp    1c01 <nel::heapless::Array<U8Buf<256ul>, 8ul>::Array(U8Buf<256ul> const&)+0x17>
+        }
+    1c29:	   \-> 48 83 c4 18          	add    $0x18,%rsp
+    1c2d:	       5b                   	pop    %rbx
+    1c2e:	       5d                   	pop    %rbp
+    1c2f:	       c3                   	ret
+
+0000000000001c30 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1c30:	48 89 d1             	mov    %rdx,%rcx
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    1c33:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1c35:	c3                   	ret
+
+0000000000001c36 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    1c36:	48 89 d1             	mov    %rdx,%rcx
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    1c39:	89 f0                	mov    %esi,%eax
+    1c3b:	f3 aa                	rep stos %al,%es:(%rdi)
+}
+    1c3d:	c3                   	ret
+
+0000000000001c3e <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    1c3e:	48 89 d1             	mov    %rdx,%rcx
+    1c41:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    1c43:	c3                   	ret
+
+0000000000001c44 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    1c44:	e9 57 f4 ff ff       	jmp    10a0 <memmove@plt>
+
+0000000000001c49 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    1c49:	48 89 f1             	mov    %rsi,%rcx
+    std::memset(d, s, n);
+    1c4c:	b0 a5                	mov    $0xa5,%al
+    1c4e:	f3 aa                	rep stos %al,%es:(%rdi)
+    set(d, 0xa5, n);
+}
+    1c50:	c3                   	ret
+
+0000000000001c51 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1c51:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    1c52:	e8 19 f4 ff ff       	call   1070 <memcmp@plt>
+}
+    1c57:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) == 0;
+    1c58:	85 c0                	test   %eax,%eax
+    1c5a:	0f 94 c0             	sete   %al
+}
+    1c5d:	c3                   	ret
+
+0000000000001c5e <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1c5e:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    1c5f:	e8 0c f4 ff ff       	call   1070 <memcmp@plt>
+}
+    1c64:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) != 0;
+    1c65:	85 c0                	test   %eax,%eax
+    1c67:	0f 95 c0             	setne  %al
+}
+    1c6a:	c3                   	ret
+
+0000000000001c6b <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+{
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1c6b:	          49 89 fa             	mov    %rdi,%r10
+    1c6e:	          48 89 f0             	mov    %rsi,%rax
+    if (n < streaming_min) {
+    1c71:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1c78:	      /-- 77 05                	ja     1c7f <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14>
+    std::memcpy(d, s, n);
+    1c7a:	      |   48 89 d1             	mov    %rdx,%rcx
+    1c7d:	/-----|-- eb 79                	jmp    1cf8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x8d>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1c7f:	|     \-> 48 89 f9             	mov    %rdi,%rcx
+    1c82:	|         48 f7 d9             	neg    %rcx
+    1c85:	|         83 e1 0f             	and    $0xf,%ecx
+    1c88:	|         49 89 c8             	mov    %rcx,%r8
+    std::memcpy(d, s, n);
+    1c8b:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1c8d:	|         49 8d 70 40          	lea    0x40(%r8),%rsi
+    1c91:	|         48 89 f9             	mov    %rdi,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1c94:	|     /-> 0f 10 54 30 d0       	movups -0x30(%rax,%rsi,1),%xmm2
+    1c99:	|     |   0f 10 4c 30 e0       	movups -0x20(%rax,%rsi,1),%xmm1
+    1c9e:	|     |   49 89 f0             	mov    %rsi,%r8
+    for (; i + 64 <= n; i += 64) {
+    1ca1:	|     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1ca5:	|     |   0f 10 44 30 f0       	movups -0x10(%rax,%rsi,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1caa:	|     |   0f 10 5c 30 c0       	movups -0x40(%rax,%rsi,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    1caf:	|     |   48 83 c6 40          	add    $0x40,%rsi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1cb3:	|     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    1cb8:	|     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    1cbd:	|     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    1cc2:	|     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    1cc7:	|     |   48 39 f2             	cmp    %rsi,%rdx
+    1cca:	|     \-- 73 c8                	jae    1c94 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x29>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    1ccc:	|  /----> 49 8d 48 10          	lea    0x10(%r8),%rcx
+        stream16(d + i, load16(s + i));
+    1cd0:	|  |      4f 8d 0c 02          	lea    (%r10,%r8,1),%r9
+    for (; i + 16 <= n; i += 16) {
+    1cd4:	|  |      48 39 ca             	cmp    %rcx,%rdx
+    1cd7:	|  |  /-- 72 0f                	jb     1ce8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x7d>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1cd9:	|  |  |   0f 10 64 08 f0       	movups -0x10(%rax,%rcx,1),%xmm4
+    1cde:	|  |  |   49 89 c8             	mov    %rcx,%r8
+    1ce1:	|  |  |   66 41 0f e7 21       	movntdq %xmm4,(%r9)
+    for (; i + 16 <= n; i += 16) {
+    1ce6:	|  \--|-- eb e4                	jmp    1ccc <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x61>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    1ce8:	|     \-> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    1ceb:	|         4c 29 c2             	sub    %r8,%rdx
+        stream16(d + i, load16(s + i));
+    1cee:	|         4a 8d 34 00          	lea    (%rax,%r8,1),%rsi
+    std::memcpy(d, s, n);
+    1cf2:	|         4c 89 cf             	mov    %r9,%rdi
+    copy(d + i, s + i, n - i);
+    1cf5:	|         48 89 d1             	mov    %rdx,%rcx
+    std::memcpy(d, s, n);
+    1cf8:	\-------> f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1cfa:	          c3                   	ret
+
+0000000000001cfb <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    1cfb:	          49 89 f8             	mov    %rdi,%r8
+    if (n < streaming_min) {
+    1cfe:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1d05:	/-------- 77 37                	ja     1d3e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x43>
+    Length done = (n < 16) ? n : 16;
+    1d07:	|         b8 10 00 00 00       	mov    $0x10,%eax
+    1d0c:	|         48 39 c2             	cmp    %rax,%rdx
+    1d0f:	|         48 0f 46 c2          	cmovbe %rdx,%rax
+    std::memcpy(d, s, n);
+    1d13:	|         89 c1                	mov    %eax,%ecx
+    1d15:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    1d17:	|  /----> 48 39 d0             	cmp    %rdx,%rax
+    1d1a:	|  |  /-- 73 21                	jae    1d3d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42>
+        Length const m = (done < n - done) ? done : n - done;
+    1d1c:	|  |  |   49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    1d1f:	|  |  |   4d 8d 14 00          	lea    (%r8,%rax,1),%r10
+    std::memcpy(d, s, n);
+    1d23:	|  |  |   4c 89 c6             	mov    %r8,%rsi
+        Length const m = (done < n - done) ? done : n - done;
+    1d26:	|  |  |   49 29 c1             	sub    %rax,%r9
+    std::memcpy(d, s, n);
+    1d29:	|  |  |   4c 89 d7             	mov    %r10,%rdi
+        Length const m = (done < n - done) ? done : n - done;
+    1d2c:	|  |  |   49 39 c1             	cmp    %rax,%r9
+    1d2f:	|  |  |   4c 0f 47 c8          	cmova  %rax,%r9
+    std::memcpy(d, s, n);
+    1d33:	|  |  |   44 89 c9             	mov    %r9d,%ecx
+        done += m;
+    1d36:	|  |  |   4c 01 c8             	add    %r9,%rax
+    std::memcpy(d, s, n);
+    1d39:	|  |  |   f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+        done += m;
+    1d3b:	|  \--|-- eb da                	jmp    1d17 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c>
+    1d3d:	|     \-> c3                   	ret
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1d3e:	\-------> 48 89 f8             	mov    %rdi,%rax
+    for (Index i = 0; i < head; ++i) {
+    1d41:	          31 c9                	xor    %ecx,%ecx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1d43:	          48 f7 d8             	neg    %rax
+    1d46:	          83 e0 0f             	and    $0xf,%eax
+    for (Index i = 0; i < head; ++i) {
+    1d49:	   /----> 48 39 c1             	cmp    %rax,%rcx
+    1d4c:	   |  /-- 74 0d                	je     1d5b <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x60>
+        d[i] = p[i];
+    1d4e:	   |  |   40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+    1d52:	   |  |   41 88 3c 08          	mov    %dil,(%r8,%rcx,1)
+    for (Index i = 0; i < head; ++i) {
+    1d56:	   |  |   48 ff c1             	inc    %rcx
+    1d59:	   \--|-- eb ee                	jmp    1d49 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4e>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    1d5b:	      \-> 31 c9                	xor    %ecx,%ecx
+        rotated[i] = p[(head + i) % 16];
+    1d5d:	      /-> 48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+    1d61:	      |   83 e7 0f             	and    $0xf,%edi
+    1d64:	      |   40 8a 3c 3e          	mov    (%rsi,%rdi,1),%dil
+    1d68:	      |   40 88 7c 0c e8       	mov    %dil,-0x18(%rsp,%rcx,1)
+    for (Index i = 0; i < 16; ++i) {
+    1d6d:	      |   48 ff c1             	inc    %rcx
+    1d70:	      |   48 83 f9 10          	cmp    $0x10,%rcx
+    1d74:	      \-- 75 e7                	jne    1d5d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x62>
+    std::memcpy(&v, s, sizeof(v));
+    1d76:	          0f 28 44 24 e8       	movaps -0x18(%rsp),%xmm0
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1d7b:	          48 8d 78 40          	lea    0x40(%rax),%rdi
+    1d7f:	          4c 01 c0             	add    %r8,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1d82:	      /-> 48 89 f9             	mov    %rdi,%rcx
+    for (; i + 64 <= n; i += 64) {
+    1d85:	      |   48 8d 7f 40          	lea    0x40(%rdi),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1d89:	      |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    1d8d:	      |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    1d92:	      |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    1d97:	      |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    1d9c:	      |   48 83 c0 40          	add    $0x40,%rax
+    1da0:	      |   48 39 fa             	cmp    %rdi,%rdx
+    1da3:	      \-- 73 dd                	jae    1d82 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x87>
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+        stream16(d + i, v);
+    1da5:	          49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    for (; i + 16 <= n; i += 16) {
+    1da9:	   /----> 48 8d 41 10          	lea    0x10(%rcx),%rax
+    1dad:	   |      48 39 c2             	cmp    %rax,%rdx
+    1db0:	   |  /-- 72 0a                	jb     1dbc <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc1>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1db2:	   |  |   48 89 c1             	mov    %rax,%rcx
+    1db5:	   |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    1dba:	   \--|-- eb ed                	jmp    1da9 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xae>
+    }
+    __builtin_ia32_sfence();
+    1dbc:	      \-> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    1dbf:	   /----> 48 39 d1             	cmp    %rdx,%rcx
+    1dc2:	   |  /-- 73 12                	jae    1dd6 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xdb>
+        d[i] = p[i % 16];
+    1dc4:	   |  |   48 89 c8             	mov    %rcx,%rax
+    1dc7:	   |  |   83 e0 0f             	and    $0xf,%eax
+    1dca:	   |  |   8a 04 06             	mov    (%rsi,%rax,1),%al
+    1dcd:	   |  |   41 88 04 08          	mov    %al,(%r8,%rcx,1)
+    for (; i < n; ++i) {
+    1dd1:	   |  |   48 ff c1             	inc    %rcx
+    1dd4:	   \--|-- eb e9                	jmp    1dbf <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc4>
+    }
+}
+    1dd6:	      \-> c3                   	ret
+
+0000000000001dd7 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    1dd7:	    48 85 ff             	test   %rdi,%rdi
+    1dda:	/-- 74 09                	je     1de5 <nel::free_aligned(void*)+0xe>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    1ddc:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    1de0:	|   e9 4b f2 ff ff       	jmp    1030 <free@plt>
+}
+    1de5:	\-> c3                   	ret
+
+0000000000001de6 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    1de6:	       41 56                	push   %r14
+            : fn_name_(fn_name)
+    1de8:	       48 8d 05 3d 03 00 00 	lea    0x33d(%rip),%rax        # 212c <_IO_stdin_used+0x12c>
+    1def:	       41 55                	push   %r13
+    1df1:	       41 54                	push   %r12
+    1df3:	       55                   	push   %rbp
+    1df4:	       53                   	push   %rbx
+    1df5:	       48 83 ec 20          	sub    $0x20,%rsp
+    1df9:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , file_name_(file_name)
+    1dfe:	       48 8d 05 37 03 00 00 	lea    0x337(%rip),%rax        # 213c <_IO_stdin_used+0x13c>
+    1e05:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1e0a:	       c7 44 24 18 f3 00 00 	movl   $0xf3,0x18(%rsp)
+    1e11:	       00 
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    1e12:	       48 85 f6             	test   %rsi,%rsi
+    1e15:	/----- 74 28                	je     1e3f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1e17:	|      4c 8d 66 ff          	lea    -0x1(%rsi),%r12
+    1e1b:	|      48 89 f3             	mov    %rsi,%rbx
+    1e1e:	|      49 21 f4             	and    %rsi,%r12
+    1e21:	+----- 75 1c                	jne    1e3f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1e23:	|      49 89 fd             	mov    %rdi,%r13
+    1e26:	|      49 89 d6             	mov    %rdx,%r14
+    1e29:	|      48 89 cd             	mov    %rcx,%rbp
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1e2c:	|      31 ff                	xor    %edi,%edi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    1e2e:	|      4d 85 ed             	test   %r13,%r13
+    1e31:	|  /-- 74 1d                	je     1e50 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+    1e33:	|  |   4d 8b 65 f8          	mov    -0x8(%r13),%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1e37:	|  |   4c 89 ef             	mov    %r13,%rdi
+    1e3a:	|  |   4c 29 e7             	sub    %r12,%rdi
+    1e3d:	|  +-- eb 11                	jmp    1e50 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    1e3f:	\--|-> 48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    1e44:	   |   48 8d 3d 03 03 00 00 	lea    0x303(%rip),%rdi        # 214e <_IO_stdin_used+0x14e>
+    1e4b:	   |   e8 d2 f2 ff ff       	call   1122 <nel::assert_fail(char const*, nel::Context const&)>
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1e50:	   \-> 48 8d 34 2b          	lea    (%rbx,%rbp,1),%rsi
+    1e54:	       e8 37 f2 ff ff       	call   1090 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    1e59:	       48 85 c0             	test   %rax,%rax
+    1e5c:	/----- 74 3b                	je     1e99 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb3>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1e5e:	|      48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    1e63:	|      48 f7 db             	neg    %rbx
+    1e66:	|      48 21 d9             	and    %rbx,%rcx
+    1e69:	|      48 89 cb             	mov    %rcx,%rbx
+    1e6c:	|      48 29 c3             	sub    %rax,%rbx
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    1e6f:	|      4d 85 ed             	test   %r13,%r13
+    1e72:	|  /-- 74 1e                	je     1e92 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+    1e74:	|  |   49 39 dc             	cmp    %rbx,%r12
+    1e77:	|  +-- 74 19                	je     1e92 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    1e79:	|  |   4c 39 f5             	cmp    %r14,%rbp
+    1e7c:	|  |   4c 89 f2             	mov    %r14,%rdx
+    1e7f:	|  |   4a 8d 34 20          	lea    (%rax,%r12,1),%rsi
+    1e83:	|  |   48 89 cf             	mov    %rcx,%rdi
+    1e86:	|  |   48 0f 46 d5          	cmovbe %rbp,%rdx
+    1e8a:	|  |   e8 11 f2 ff ff       	call   10a0 <memmove@plt>
+    1e8f:	|  |   48 89 c1             	mov    %rax,%rcx
+    }
+    offset_field(new_p) = new_offset;
+    1e92:	|  \-> 48 89 59 f8          	mov    %rbx,-0x8(%rcx)
+    return new_p;
+    1e96:	|      48 89 c8             	mov    %rcx,%rax
+}
+    1e99:	\----> 48 83 c4 20          	add    $0x20,%rsp
+    1e9d:	       5b                   	pop    %rbx
+    1e9e:	       5d                   	pop    %rbp
+    1e9f:	       41 5c                	pop    %r12
+    1ea1:	       41 5d                	pop    %r13
+    1ea3:	       41 5e                	pop    %r14
+    1ea5:	       c3                   	ret
+
+0000000000001ea6 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    1ea6:	48 89 f1             	mov    %rsi,%rcx
+    return realloc_aligned(nullptr, align, 0, size);
+    1ea9:	31 d2                	xor    %edx,%edx
+    1eab:	48 89 fe             	mov    %rdi,%rsi
+    1eae:	31 ff                	xor    %edi,%edi
+    1eb0:	e9 31 ff ff ff       	jmp    1de6 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+
+0000000000001eb5 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1eb5:	53                   	push   %rbx
+    1eb6:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    1eb9:	40 0f be fe          	movsbl %sil,%edi
+    1ebd:	48 8b 35 9c 21 00 00 	mov    0x219c(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    1ec4:	e8 97 f1 ff ff       	call   1060 <fputc@plt>
+    return outs;
+}
+    1ec9:	48 89 d8             	mov    %rbx,%rax
+    1ecc:	5b                   	pop    %rbx
+    1ecd:	c3                   	ret
+
+0000000000001ece <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1ece:	53                   	push   %rbx
+    1ecf:	48 89 fb             	mov    %rdi,%rbx
+    1ed2:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    1ed5:	48 8b 35 84 21 00 00 	mov    0x2184(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    1edc:	e8 6f f1 ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    1ee1:	48 89 d8             	mov    %rbx,%rax
+    1ee4:	5b                   	pop    %rbx
+    1ee5:	c3                   	ret
+
+0000000000001ee6 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1ee6:	53                   	push   %rbx
+    1ee7:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    1eea:	48 8b 3d 6f 21 00 00 	mov    0x216f(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1ef1:	40 0f b6 d6          	movzbl %sil,%edx
+    1ef5:	31 c0                	xor    %eax,%eax
+    1ef7:	48 8d 35 6b 02 00 00 	lea    0x26b(%rip),%rsi        # 2169 <_IO_stdin_used+0x169>
+    1efe:	e8 7d f1 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1f03:	48 89 d8             	mov    %rbx,%rax
+    1f06:	5b                   	pop    %rbx
+    1f07:	c3                   	ret
+
+0000000000001f08 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    1f08:	53                   	push   %rbx
+    1f09:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    1f0c:	48 8b 3d 4d 21 00 00 	mov    0x214d(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1f13:	0f b7 d6             	movzwl %si,%edx
+    1f16:	31 c0                	xor    %eax,%eax
+    1f18:	48 8d 35 4a 02 00 00 	lea    0x24a(%rip),%rsi        # 2169 <_IO_stdin_used+0x169>
+    1f1f:	e8 5c f1 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1f24:	48 89 d8             	mov    %rbx,%rax
+    1f27:	5b                   	pop    %rbx
+    1f28:	c3                   	ret
+
+0000000000001f29 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    1f29:	53                   	push   %rbx
+    1f2a:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    1f2d:	48 8b 3d 2c 21 00 00 	mov    0x212c(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1f34:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    1f36:	31 c0                	xor    %eax,%eax
+    1f38:	48 8d 35 2a 02 00 00 	lea    0x22a(%rip),%rsi        # 2169 <_IO_stdin_used+0x169>
+    1f3f:	e8 3c f1 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1f44:	48 89 d8             	mov    %rbx,%rax
+    1f47:	5b                   	pop    %rbx
+    1f48:	c3                   	ret
+
+0000000000001f49 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    1f49:	53                   	push   %rbx
+    1f4a:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    1f4d:	48 8b 3d 0c 21 00 00 	mov    0x210c(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1f54:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    1f56:	31 c0                	xor    %eax,%eax
+    1f58:	48 8d 35 0a 02 00 00 	lea    0x20a(%rip),%rsi        # 2169 <_IO_stdin_used+0x169>
+    1f5f:	e8 1c f1 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1f64:	48 89 d8             	mov    %rbx,%rax
+    1f67:	5b                   	pop    %rbx
+    1f68:	c3                   	ret
+
+0000000000001f69 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    1f69:	53                   	push   %rbx
+    1f6a:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    1f6d:	48 8b 3d ec 20 00 00 	mov    0x20ec(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1f74:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    1f77:	31 c0                	xor    %eax,%eax
+    1f79:	48 8d 35 ec 01 00 00 	lea    0x1ec(%rip),%rsi        # 216c <_IO_stdin_used+0x16c>
+    1f80:	e8 fb f0 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1f85:	48 89 d8             	mov    %rbx,%rax
+    1f88:	5b                   	pop    %rbx
+    1f89:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000001f8c <_fini>:
+    1f8c:	48 83 ec 08          	sub    $0x8,%rsp
+    1f90:	48 83 c4 08          	add    $0x8,%rsp
+    1f94:	c3                   	ret
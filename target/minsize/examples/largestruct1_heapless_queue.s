@@ -0,0 +1,1760 @@
+
+target/minsize/examples/largestruct1_heapless_queue:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputc@plt>:
+    1060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 4018 <fputc@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <memcmp@plt>:
+    1070:	ff 25 aa 2f 00 00    	jmp    *0x2faa(%rip)        # 4020 <memcmp@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fprintf@plt>:
+    1080:	ff 25 a2 2f 00 00    	jmp    *0x2fa2(%rip)        # 4028 <fprintf@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <realloc@plt>:
+    1090:	ff 25 9a 2f 00 00    	jmp    *0x2f9a(%rip)        # 4030 <realloc@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memmove@plt>:
+    10a0:	ff 25 92 2f 00 00    	jmp    *0x2f92(%rip)        # 4038 <memmove@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010b0 <__cxa_finalize@plt>:
+    10b0:	ff 25 2a 2f 00 00    	jmp    *0x2f2a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10b6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010c0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10c0:	50                   	push   %rax
+    std::abort();
+    10c1:	e8 7a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010c6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10c6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10c7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10ca:	4c 8d 0d 26 10 00 00 	lea    0x1026(%rip),%r9        # 20f7 <_IO_stdin_used+0xf7>
+    10d1:	31 c0                	xor    %eax,%eax
+    10d3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10d7:	4c 8b 07             	mov    (%rdi),%r8
+    10da:	48 8d 35 1c 10 00 00 	lea    0x101c(%rip),%rsi        # 20fd <_IO_stdin_used+0xfd>
+    10e1:	48 8b 3d 78 2f 00 00 	mov    0x2f78(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    10e8:	e8 93 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    10ed:	e8 4e ff ff ff       	call   1040 <abort@plt>
+
+00000000000010f2 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    10f2:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    10f6:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    10f9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    10fd:	31 c0                	xor    %eax,%eax
+    10ff:	57                   	push   %rdi
+    1100:	48 8b 3d 59 2f 00 00 	mov    0x2f59(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1107:	4c 8d 0d e9 0f 00 00 	lea    0xfe9(%rip),%r9        # 20f7 <_IO_stdin_used+0xf7>
+    110e:	4c 8b 06             	mov    (%rsi),%r8
+    1111:	48 8d 35 f6 0f 00 00 	lea    0xff6(%rip),%rsi        # 210e <_IO_stdin_used+0x10e>
+    1118:	e8 63 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    111d:	e8 1e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001122 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1122:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1126:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1129:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    112d:	31 c0                	xor    %eax,%eax
+    112f:	57                   	push   %rdi
+    1130:	48 8b 3d 29 2f 00 00 	mov    0x2f29(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1137:	4c 8d 0d e5 0f 00 00 	lea    0xfe5(%rip),%r9        # 2123 <_IO_stdin_used+0x123>
+    113e:	4c 8b 06             	mov    (%rsi),%r8
+    1141:	48 8d 35 c6 0f 00 00 	lea    0xfc6(%rip),%rsi        # 210e <_IO_stdin_used+0x10e>
+    1148:	e8 33 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    114d:	e8 ee fe ff ff       	call   1040 <abort@plt>
+
+0000000000001152 <main>:
+    auto e = queue1.pop();
+    nel::log << e << '\n';
+}
+
+int main()
+{
+    1152:	53                   	push   %rbx
+    nel::log << "ex1:b" << '\n';
+    1153:	48 8d 1d 0f 2f 00 00 	lea    0x2f0f(%rip),%rbx        # 4069 <nel::log>
+    115a:	48 8d 35 17 0f 00 00 	lea    0xf17(%rip),%rsi        # 2078 <_IO_stdin_used+0x78>
+    1161:	48 89 df             	mov    %rbx,%rdi
+    1164:	e8 92 0b 00 00       	call   1cfb <nel::operator<<(nel::Log&, char const*)>
+    1169:	be 0a 00 00 00       	mov    $0xa,%esi
+    116e:	48 89 c7             	mov    %rax,%rdi
+    1171:	e8 6c 0b 00 00       	call   1ce2 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    1176:	e8 29 02 00 00       	call   13a4 <ex1()>
+    nel::log << "ex1:e" << '\n';
+    117b:	48 89 df             	mov    %rbx,%rdi
+    117e:	48 8d 35 f9 0e 00 00 	lea    0xef9(%rip),%rsi        # 207e <_IO_stdin_used+0x7e>
+    1185:	e8 71 0b 00 00       	call   1cfb <nel::operator<<(nel::Log&, char const*)>
+    118a:	be 0a 00 00 00       	mov    $0xa,%esi
+    118f:	48 89 c7             	mov    %rax,%rdi
+    1192:	e8 4b 0b 00 00       	call   1ce2 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex2:b" << '\n';
+    1197:	48 89 df             	mov    %rbx,%rdi
+    119a:	48 8d 35 e3 0e 00 00 	lea    0xee3(%rip),%rsi        # 2084 <_IO_stdin_used+0x84>
+    11a1:	e8 55 0b 00 00       	call   1cfb <nel::operator<<(nel::Log&, char const*)>
+    11a6:	be 0a 00 00 00       	mov    $0xa,%esi
+    11ab:	48 89 c7             	mov    %rax,%rdi
+    11ae:	e8 2f 0b 00 00       	call   1ce2 <nel::operator<<(nel::Log&, char)>
+    ex2();
+    11b3:	e8 34 02 00 00       	call   13ec <ex2()>
+    nel::log << "ex2:e" << '\n';
+    11b8:	48 89 df             	mov    %rbx,%rdi
+    11bb:	48 8d 35 c8 0e 00 00 	lea    0xec8(%rip),%rsi        # 208a <_IO_stdin_used+0x8a>
+    11c2:	e8 34 0b 00 00       	call   1cfb <nel::operator<<(nel::Log&, char const*)>
+    11c7:	be 0a 00 00 00       	mov    $0xa,%esi
+    11cc:	48 89 c7             	mov    %rax,%rdi
+    11cf:	e8 0e 0b 00 00       	call   1ce2 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex3:b" << '\n';
+    11d4:	48 89 df             	mov    %rbx,%rdi
+    11d7:	48 8d 35 b2 0e 00 00 	lea    0xeb2(%rip),%rsi        # 2090 <_IO_stdin_used+0x90>
+    11de:	e8 18 0b 00 00       	call   1cfb <nel::operator<<(nel::Log&, char const*)>
+    11e3:	be 0a 00 00 00       	mov    $0xa,%esi
+    11e8:	48 89 c7             	mov    %rax,%rdi
+    11eb:	e8 f2 0a 00 00       	call   1ce2 <nel::operator<<(nel::Log&, char)>
+    ex3();
+    11f0:	e8 d9 02 00 00       	call   14ce <ex3()>
+    nel::log << "ex3:e" << '\n';
+    11f5:	48 89 df             	mov    %rbx,%rdi
+    11f8:	48 8d 35 97 0e 00 00 	lea    0xe97(%rip),%rsi        # 2096 <_IO_stdin_used+0x96>
+    11ff:	e8 f7 0a 00 00       	call   1cfb <nel::operator<<(nel::Log&, char const*)>
+    1204:	be 0a 00 00 00       	mov    $0xa,%esi
+    1209:	48 89 c7             	mov    %rax,%rdi
+    120c:	e8 d1 0a 00 00       	call   1ce2 <nel::operator<<(nel::Log&, char)>
+}
+    1211:	31 c0                	xor    %eax,%eax
+    1213:	5b                   	pop    %rbx
+    1214:	c3                   	ret
+    1215:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    121c:	00 00 00 
+    121f:	90                   	nop
+
+0000000000001220 <_start>:
+    1220:	31 ed                	xor    %ebp,%ebp
+    1222:	49 89 d1             	mov    %rdx,%r9
+    1225:	5e                   	pop    %rsi
+    1226:	48 89 e2             	mov    %rsp,%rdx
+    1229:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    122d:	50                   	push   %rax
+    122e:	54                   	push   %rsp
+    122f:	45 31 c0             	xor    %r8d,%r8d
+    1232:	31 c9                	xor    %ecx,%ecx
+    1234:	48 8d 3d 17 ff ff ff 	lea    -0xe9(%rip),%rdi        # 1152 <main>
+    123b:	ff 15 7f 2d 00 00    	call   *0x2d7f(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    1241:	f4                   	hlt
+    1242:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1249:	00 00 00 
+    124c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001250 <deregister_tm_clones>:
+    1250:	    48 8d 3d f9 2d 00 00 	lea    0x2df9(%rip),%rdi        # 4050 <__TMC_END__>
+    1257:	    48 8d 05 f2 2d 00 00 	lea    0x2df2(%rip),%rax        # 4050 <__TMC_END__>
+    125e:	    48 39 f8             	cmp    %rdi,%rax
+    1261:	/-- 74 15                	je     1278 <deregister_tm_clones+0x28>
+    1263:	|   48 8b 05 5e 2d 00 00 	mov    0x2d5e(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    126a:	|   48 85 c0             	test   %rax,%rax
+    126d:	+-- 74 09                	je     1278 <deregister_tm_clones+0x28>
+    126f:	|   ff e0                	jmp    *%rax
+    1271:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1278:	\-> c3                   	ret
+    1279:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001280 <register_tm_clones>:
+    1280:	    48 8d 3d c9 2d 00 00 	lea    0x2dc9(%rip),%rdi        # 4050 <__TMC_END__>
+    1287:	    48 8d 35 c2 2d 00 00 	lea    0x2dc2(%rip),%rsi        # 4050 <__TMC_END__>
+    128e:	    48 29 fe             	sub    %rdi,%rsi
+    1291:	    48 89 f0             	mov    %rsi,%rax
+    1294:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1298:	    48 c1 f8 03          	sar    $0x3,%rax
+    129c:	    48 01 c6             	add    %rax,%rsi
+    129f:	    48 d1 fe             	sar    %rsi
+    12a2:	/-- 74 14                	je     12b8 <register_tm_clones+0x38>
+    12a4:	|   48 8b 05 2d 2d 00 00 	mov    0x2d2d(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    12ab:	|   48 85 c0             	test   %rax,%rax
+    12ae:	+-- 74 08                	je     12b8 <register_tm_clones+0x38>
+    12b0:	|   ff e0                	jmp    *%rax
+    12b2:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    12b8:	\-> c3                   	ret
+    12b9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000012c0 <__do_global_dtors_aux>:
+    12c0:	       f3 0f 1e fa          	endbr64
+    12c4:	       80 3d 9d 2d 00 00 00 	cmpb   $0x0,0x2d9d(%rip)        # 4068 <completed.0>
+    12cb:	/----- 75 2b                	jne    12f8 <__do_global_dtors_aux+0x38>
+    12cd:	|      55                   	push   %rbp
+    12ce:	|      48 83 3d 0a 2d 00 00 	cmpq   $0x0,0x2d0a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    12d5:	|      00 
+    12d6:	|      48 89 e5             	mov    %rsp,%rbp
+    12d9:	|  /-- 74 0c                	je     12e7 <__do_global_dtors_aux+0x27>
+    12db:	|  |   48 8b 3d 66 2d 00 00 	mov    0x2d66(%rip),%rdi        # 4048 <__dso_handle>
+    12e2:	|  |   e8 c9 fd ff ff       	call   10b0 <__cxa_finalize@plt>
+    12e7:	|  \-> e8 64 ff ff ff       	call   1250 <deregister_tm_clones>
+    12ec:	|      c6 05 75 2d 00 00 01 	movb   $0x1,0x2d75(%rip)        # 4068 <completed.0>
+    12f3:	|      5d                   	pop    %rbp
+    12f4:	|      c3                   	ret
+    12f5:	|      0f 1f 00             	nopl   (%rax)
+    12f8:	\----> c3                   	ret
+    12f9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001300 <frame_dummy>:
+    1300:	f3 0f 1e fa          	endbr64
+    1304:	e9 77 ff ff ff       	jmp    1280 <register_tm_clones>
+
+0000000000001309 <operator<<(nel::Log&, U8Buf<256ul> const&) [clone .isra.0]>:
+    1309:	    41 54                	push   %r12
+    130b:	    49 89 f4             	mov    %rsi,%r12
+    130e:	    48 8d 35 ef 0c 00 00 	lea    0xcef(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    1315:	    55                   	push   %rbp
+    1316:	    bd 01 00 00 00       	mov    $0x1,%ebp
+    131b:	    53                   	push   %rbx
+    131c:	    48 89 fb             	mov    %rdi,%rbx
+    131f:	    e8 d7 09 00 00       	call   1cfb <nel::operator<<(nel::Log&, char const*)>
+    1324:	    be 00 01 00 00       	mov    $0x100,%esi
+    1329:	    48 89 c7             	mov    %rax,%rdi
+    132c:	    e8 65 0a 00 00       	call   1d96 <nel::operator<<(nel::Log&, unsigned long)>
+    1331:	    48 8d 35 d3 0c 00 00 	lea    0xcd3(%rip),%rsi        # 200b <_IO_stdin_used+0xb>
+    1338:	    48 89 c7             	mov    %rax,%rdi
+    133b:	    e8 bb 09 00 00       	call   1cfb <nel::operator<<(nel::Log&, char const*)>
+    1340:	    41 0f b6 34 24       	movzbl (%r12),%esi
+    1345:	    48 89 df             	mov    %rbx,%rdi
+    1348:	    e8 c6 09 00 00       	call   1d13 <nel::operator<<(nel::Log&, unsigned char)>
+    134d:	/-> be 20 00 00 00       	mov    $0x20,%esi
+    1352:	|   48 89 df             	mov    %rbx,%rdi
+    1355:	|   e8 88 09 00 00       	call   1ce2 <nel::operator<<(nel::Log&, char)>
+    135a:	|   41 0f b6 34 2c       	movzbl (%r12,%rbp,1),%esi
+    135f:	|   48 ff c5             	inc    %rbp
+    1362:	|   48 89 c7             	mov    %rax,%rdi
+    1365:	|   e8 a9 09 00 00       	call   1d13 <nel::operator<<(nel::Log&, unsigned char)>
+    136a:	|   48 81 fd 00 01 00 00 	cmp    $0x100,%rbp
+    1371:	\-- 75 da                	jne    134d <operator<<(nel::Log&, U8Buf<256ul> const&) [clone .isra.0]+0x44>
+    1373:	    48 89 df             	mov    %rbx,%rdi
+    1376:	    be 7d 00 00 00       	mov    $0x7d,%esi
+    137b:	    5b                   	pop    %rbx
+    137c:	    5d                   	pop    %rbp
+    137d:	    41 5c                	pop    %r12
+    137f:	    e9 5e 09 00 00       	jmp    1ce2 <nel::operator<<(nel::Log&, char)>
+
+0000000000001384 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    1384:	83 c8 ff             	or     $0xffffffff,%eax
+    1387:	c3                   	ret
+
+0000000000001388 <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    1388:	83 c8 ff             	or     $0xffffffff,%eax
+    138b:	c3                   	ret
+
+000000000000138c <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    138c:	83 c8 ff             	or     $0xffffffff,%eax
+    138f:	c3                   	ret
+
+0000000000001390 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    1390:	83 c8 ff             	or     $0xffffffff,%eax
+    1393:	c3                   	ret
+
+0000000000001394 <_read_r>:
+int _read_r(struct _reent *, int) {
+    1394:	83 c8 ff             	or     $0xffffffff,%eax
+    1397:	c3                   	ret
+
+0000000000001398 <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    1398:	83 c8 ff             	or     $0xffffffff,%eax
+    139b:	c3                   	ret
+
+000000000000139c <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    139c:	83 c8 ff             	or     $0xffffffff,%eax
+    139f:	c3                   	ret
+
+00000000000013a0 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    13a0:	83 c8 ff             	or     $0xffffffff,%eax
+    13a3:	c3                   	ret
+
+00000000000013a4 <ex1()>:
+{
+    13a4:	53                   	push   %rbx
+    auto queue1 = Queue1::empty();
+    13a5:	31 c0                	xor    %eax,%eax
+    13a7:	b9 46 01 00 00       	mov    $0x146,%ecx
+{
+    13ac:	48 81 ec 20 05 00 00 	sub    $0x520,%rsp
+    nel::log << queue1 << '\n';
+    13b3:	48 8d 5c 24 08       	lea    0x8(%rsp),%rbx
+    auto queue1 = Queue1::empty();
+    13b8:	48 8d 7c 24 08       	lea    0x8(%rsp),%rdi
+    13bd:	f3 ab                	rep stos %eax,%es:(%rdi)
+    nel::log << queue1 << '\n';
+    13bf:	48 89 de             	mov    %rbx,%rsi
+    13c2:	48 8d 3d a0 2c 00 00 	lea    0x2ca0(%rip),%rdi        # 4069 <nel::log>
+    13c9:	e8 82 05 00 00       	call   1950 <nel::heapless::operator<<(nel::Log&, nel::heapless::Queue<U8Buf<256ul>, 5ul> const&)>
+    13ce:	be 0a 00 00 00       	mov    $0xa,%esi
+    13d3:	48 89 c7             	mov    %rax,%rdi
+    13d6:	e8 07 09 00 00       	call   1ce2 <nel::operator<<(nel::Log&, char)>
+}
+    13db:	48 89 df             	mov    %rbx,%rdi
+    13de:	e8 5d 04 00 00       	call   1840 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()>
+    13e3:	48 81 c4 20 05 00 00 	add    $0x520,%rsp
+    13ea:	5b                   	pop    %rbx
+    13eb:	c3                   	ret
+
+00000000000013ec <ex2()>:
+{
+    13ec:	       41 54                	push   %r12
+    auto queue1 = Queue1::empty();
+    13ee:	       31 c0                	xor    %eax,%eax
+    13f0:	       b9 46 01 00 00       	mov    $0x146,%ecx
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+        {
+            nel::elem::set(data_, f, N);
+    13f5:	       ba 00 01 00 00       	mov    $0x100,%edx
+{
+    13fa:	       55                   	push   %rbp
+    13fb:	       be 66 00 00 00       	mov    $0x66,%esi
+    1400:	       53                   	push   %rbx
+    1401:	       48 81 ec 40 07 00 00 	sub    $0x740,%rsp
+    1408:	       48 8d 6c 24 24       	lea    0x24(%rsp),%rbp
+    auto queue1 = Queue1::empty();
+    140d:	       48 8d bc 24 28 02 00 	lea    0x228(%rsp),%rdi
+    1414:	       00 
+    1415:	       f3 ab                	rep stos %eax,%es:(%rdi)
+    queue1.push(nel::move(v)).is_ok();
+    1417:	       4c 8d a4 24 24 01 00 	lea    0x124(%rsp),%r12
+    141e:	       00 
+    141f:	       48 89 ef             	mov    %rbp,%rdi
+    1422:	       48 8d 9c 24 28 02 00 	lea    0x228(%rsp),%rbx
+    1429:	       00 
+    142a:	       e8 34 06 00 00       	call   1a63 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    142f:	       48 89 ea             	mov    %rbp,%rdx
+    1432:	       48 89 de             	mov    %rbx,%rsi
+    1435:	       4c 89 e7             	mov    %r12,%rdi
+    1438:	       e8 63 02 00 00       	call   16a0 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::push(U8Buf<256ul>&&)>
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    143d:	       48 8d 05 ca 0b 00 00 	lea    0xbca(%rip),%rax        # 200e <_IO_stdin_used+0xe>
+            , file_name_(file_name)
+            , line_num_(line_num)
+    1444:	       c7 44 24 18 18 00 00 	movl   $0x18,0x18(%rsp)
+    144b:	       00 
+            : fn_name_(fn_name)
+    144c:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , file_name_(file_name)
+    1451:	       48 8d 05 ba 0b 00 00 	lea    0xbba(%rip),%rax        # 2012 <_IO_stdin_used+0x12>
+    1458:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    145d:	       8b 84 24 24 01 00 00 	mov    0x124(%rsp),%eax
+        // match(Tag tag, std::function<V(void)> on_ok, std::function<V(void)> on_err) const
+        //
+        template<typename V, typename Fn1, typename Fn2>
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+        {
+            switch (tag_) { // result<void>-match
+    1464:	       85 c0                	test   %eax,%eax
+    1466:	   /-- 74 47                	je     14af <ex2()+0xc3>
+    1468:	   |   ff c8                	dec    %eax
+    146a:	   |   83 f8 01             	cmp    $0x1,%eax
+    146d:	/--|-- 77 4e                	ja     14bd <ex2()+0xd1>
+    146f:	|  |   4c 89 e7             	mov    %r12,%rdi
+    1472:	|  |   e8 91 02 00 00       	call   1708 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    nel::log << queue1 << '\n';
+    1477:	|  |   48 89 de             	mov    %rbx,%rsi
+    147a:	|  |   48 8d 3d e8 2b 00 00 	lea    0x2be8(%rip),%rdi        # 4069 <nel::log>
+    1481:	|  |   e8 ca 04 00 00       	call   1950 <nel::heapless::operator<<(nel::Log&, nel::heapless::Queue<U8Buf<256ul>, 5ul> const&)>
+    1486:	|  |   be 0a 00 00 00       	mov    $0xa,%esi
+    148b:	|  |   48 89 c7             	mov    %rax,%rdi
+    148e:	|  |   e8 4f 08 00 00       	call   1ce2 <nel::operator<<(nel::Log&, char)>
+}
+    1493:	|  |   48 89 ef             	mov    %rbp,%rdi
+    1496:	|  |   e8 f5 01 00 00       	call   1690 <U8Buf<256ul>::~U8Buf()>
+    149b:	|  |   48 89 df             	mov    %rbx,%rdi
+    149e:	|  |   e8 9d 03 00 00       	call   1840 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()>
+    14a3:	|  |   48 81 c4 40 07 00 00 	add    $0x740,%rsp
+    14aa:	|  |   5b                   	pop    %rbx
+    14ab:	|  |   5d                   	pop    %rbp
+    14ac:	|  |   41 5c                	pop    %r12
+    14ae:	|  |   c3                   	ret
+                    return on_err(*err_);
+                case Tag::INVAL:
+                    // invalids are not values that should occur
+                    // if they do it's a use-after-move-from op so must panic.
+                    // or a use-before-initialised so again must panic.
+                    nel::panic("invalid Result", ctx);
+    14af:	|  \-> 48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    14b4:	|      48 8d 3d 7f 0b 00 00 	lea    0xb7f(%rip),%rdi        # 203a <_IO_stdin_used+0x3a>
+    14bb:	|  /-- eb 0c                	jmp    14c9 <ex2()+0xdd>
+                    break;
+                default:
+                    nel::panic("bad Result", ctx);
+    14bd:	\--|-> 48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    14c2:	   |   48 8d 3d ed 0b 00 00 	lea    0xbed(%rip),%rdi        # 20b6 <_IO_stdin_used+0xb6>
+    14c9:	   \-> e8 24 fc ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+
+00000000000014ce <ex3()>:
+{
+    14ce:	                41 55                	push   %r13
+    auto queue1 = Queue1::empty();
+    14d0:	                31 c0                	xor    %eax,%eax
+    14d2:	                b9 46 01 00 00       	mov    $0x146,%ecx
+    14d7:	                ba 00 01 00 00       	mov    $0x100,%edx
+{
+    14dc:	                41 54                	push   %r12
+    14de:	                be 67 00 00 00       	mov    $0x67,%esi
+    14e3:	                55                   	push   %rbp
+    14e4:	                53                   	push   %rbx
+    14e5:	                48 81 ec 48 07 00 00 	sub    $0x748,%rsp
+    14ec:	                48 8d 5c 24 20       	lea    0x20(%rsp),%rbx
+    auto queue1 = Queue1::empty();
+    14f1:	                48 8d bc 24 28 02 00 	lea    0x228(%rsp),%rdi
+    14f8:	                00 
+    14f9:	                f3 ab                	rep stos %eax,%es:(%rdi)
+    queue1.push((uint8_t)0x67).is_ok();
+    14fb:	                4c 8d a4 24 24 01 00 	lea    0x124(%rsp),%r12
+    1502:	                00 
+    1503:	                48 89 df             	mov    %rbx,%rdi
+    1506:	                48 8d ac 24 28 02 00 	lea    0x228(%rsp),%rbp
+    150d:	                00 
+    150e:	                e8 50 05 00 00       	call   1a63 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1513:	                48 89 da             	mov    %rbx,%rdx
+    1516:	                48 89 ee             	mov    %rbp,%rsi
+    1519:	                4c 89 e7             	mov    %r12,%rdi
+    151c:	                e8 7f 01 00 00       	call   16a0 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::push(U8Buf<256ul>&&)>
+            : fn_name_(fn_name)
+    1521:	                48 8d 05 21 0b 00 00 	lea    0xb21(%rip),%rax        # 2049 <_IO_stdin_used+0x49>
+            , line_num_(line_num)
+    1528:	                c7 44 24 18 21 00 00 	movl   $0x21,0x18(%rsp)
+    152f:	                00 
+            : fn_name_(fn_name)
+    1530:	                48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , file_name_(file_name)
+    1535:	                48 8d 05 d6 0a 00 00 	lea    0xad6(%rip),%rax        # 2012 <_IO_stdin_used+0x12>
+    153c:	                48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    1541:	                8b 84 24 24 01 00 00 	mov    0x124(%rsp),%eax
+            switch (tag_) { // result<void>-match
+    1548:	                85 c0                	test   %eax,%eax
+    154a:	         /----- 74 50                	je     159c <ex3()+0xce>
+    154c:	         |      ff c8                	dec    %eax
+    154e:	         |      83 f8 01             	cmp    $0x1,%eax
+    1551:	      /--|----- 77 57                	ja     15aa <ex3()+0xdc>
+    1553:	      |  |      4c 89 e7             	mov    %r12,%rdi
+    nel::log << queue1 << '\n';
+    1556:	      |  |      4c 8d 2d 0c 2b 00 00 	lea    0x2b0c(%rip),%r13        # 4069 <nel::log>
+    queue1.push((uint8_t)0x67).is_ok();
+    155d:	      |  |      e8 a6 01 00 00       	call   1708 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    1562:	      |  |      48 89 df             	mov    %rbx,%rdi
+    1565:	      |  |      e8 26 01 00 00       	call   1690 <U8Buf<256ul>::~U8Buf()>
+    nel::log << queue1 << '\n';
+    156a:	      |  |      48 89 ee             	mov    %rbp,%rsi
+    156d:	      |  |      4c 89 ef             	mov    %r13,%rdi
+    1570:	      |  |      e8 db 03 00 00       	call   1950 <nel::heapless::operator<<(nel::Log&, nel::heapless::Queue<U8Buf<256ul>, 5ul> const&)>
+    1575:	      |  |      be 0a 00 00 00       	mov    $0xa,%esi
+    157a:	      |  |      48 89 c7             	mov    %rax,%rdi
+    157d:	      |  |      e8 60 07 00 00       	call   1ce2 <nel::operator<<(nel::Log&, char)>
+         *
+         * @returns true if queue is empty, false otherwise.
+         */
+        constexpr bool is_empty(void) const
+        {
+            return len_ == 0;
+    1582:	      |  |      48 8b 84 24 28 02 00 	mov    0x228(%rsp),%rax
+    1589:	      |  |      00 
+         * @returns if successful, Optional<T>::Some(val)
+         * @returns if unsuccessful, Optional<T>::None
+         */
+        Optional<Type> pop(void)
+        {
+            if (is_empty()) { return None; }
+    158a:	      |  |      48 85 c0             	test   %rax,%rax
+    158d:	      |  |  /-- 75 2c                	jne    15bb <ex3()+0xed>
+         * Create an optional set to none.
+         *
+         * @returns an Optional 'wrapping' a None
+         */
+        constexpr Optional(NoneT const &)
+            : tag_(Tag::NONE)
+    158f:	      |  |  |   c7 84 24 24 01 00 00 	movl   $0x1,0x124(%rsp)
+    1596:	      |  |  |   01 00 00 00 
+        {
+        }
+    159a:	   /--|--|--|-- eb 71                	jmp    160d <ex3()+0x13f>
+                    nel::panic("invalid Result", ctx);
+    159c:	   |  |  \--|-> 48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    15a1:	   |  |     |   48 8d 3d 92 0a 00 00 	lea    0xa92(%rip),%rdi        # 203a <_IO_stdin_used+0x3a>
+    15a8:	/--|--|-----|-- eb 0c                	jmp    15b6 <ex3()+0xe8>
+                    nel::panic("bad Result", ctx);
+    15aa:	|  |  \-----|-> 48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    15af:	|  |        |   48 8d 3d 00 0b 00 00 	lea    0xb00(%rip),%rdi        # 20b6 <_IO_stdin_used+0xb6>
+    15b6:	>--|--------|-> e8 37 fb ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+            len_ -= 1;
+    15bb:	|  |        \-> 48 ff c8             	dec    %rax
+            auto rp = rp_;
+            rp_ += 1;
+            if (rp_ == N) { rp_ = 0; }
+    15be:	|  |            31 c9                	xor    %ecx,%ecx
+            nel::elem::move(data_, o.data_, N);
+    15c0:	|  |            48 8d bc 24 28 01 00 	lea    0x128(%rsp),%rdi
+    15c7:	|  |            00 
+            : tag_(Tag::SOME)
+    15c8:	|  |            c7 84 24 24 01 00 00 	movl   $0x2,0x124(%rsp)
+    15cf:	|  |            02 00 00 00 
+            len_ -= 1;
+    15d3:	|  |            48 89 84 24 28 02 00 	mov    %rax,0x228(%rsp)
+    15da:	|  |            00 
+            auto rp = rp_;
+    15db:	|  |            48 8b 84 24 38 02 00 	mov    0x238(%rsp),%rax
+    15e2:	|  |            00 
+            rp_ += 1;
+    15e3:	|  |            48 8d 50 01          	lea    0x1(%rax),%rdx
+            if (rp_ == N) { rp_ = 0; }
+    15e7:	|  |            48 83 f8 04          	cmp    $0x4,%rax
+    15eb:	|  |            48 0f 44 d1          	cmove  %rcx,%rdx
+            return &ptr()[d];
+    15ef:	|  |            48 c1 e0 08          	shl    $0x8,%rax
+    15f3:	|  |            48 8d b4 04 40 02 00 	lea    0x240(%rsp,%rax,1),%rsi
+    15fa:	|  |            00 
+    15fb:	|  |            48 89 94 24 38 02 00 	mov    %rdx,0x238(%rsp)
+    1602:	|  |            00 
+    1603:	|  |            ba 00 01 00 00       	mov    $0x100,%edx
+    1608:	|  |            e8 5e 04 00 00       	call   1a6b <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    nel::log << e << '\n';
+    160d:	|  \----------> 4c 89 e6             	mov    %r12,%rsi
+    1610:	|               4c 89 ef             	mov    %r13,%rdi
+    1613:	|               e8 3f 01 00 00       	call   1757 <nel::operator<<(nel::Log&, nel::Optional<U8Buf<256ul> > const&)>
+    1618:	|               be 0a 00 00 00       	mov    $0xa,%esi
+    161d:	|               48 89 c7             	mov    %rax,%rdi
+    1620:	|               e8 bd 06 00 00       	call   1ce2 <nel::operator<<(nel::Log&, char)>
+            switch (tag_) { // optional::dtor
+    1625:	|               8b 84 24 24 01 00 00 	mov    0x124(%rsp),%eax
+    162c:	|               83 f8 01             	cmp    $0x1,%eax
+    162f:	|           /-- 7f 06                	jg     1637 <ex3()+0x169>
+    1631:	|           |   85 c0                	test   %eax,%eax
+    1633:	|        /--|-- 78 16                	js     164b <ex3()+0x17d>
+    1635:	|     /--|--|-- eb 43                	jmp    167a <ex3()+0x1ac>
+    1637:	|     |  |  \-> 83 f8 02             	cmp    $0x2,%eax
+    163a:	|     |  +----- 75 0f                	jne    164b <ex3()+0x17d>
+
+    private:
+        Type value_;
+
+    public:
+        constexpr ~Element(void) = default;
+    163c:	|     |  |      48 8d bc 24 28 01 00 	lea    0x128(%rsp),%rdi
+    1643:	|     |  |      00 
+    1644:	|     |  |      e8 47 00 00 00       	call   1690 <U8Buf<256ul>::~U8Buf()>
+    1649:	|     +--|----- eb 2f                	jmp    167a <ex3()+0x1ac>
+            : fn_name_(fn_name)
+    164b:	|     |  \----> 48 8d 05 fb 09 00 00 	lea    0x9fb(%rip),%rax        # 204d <_IO_stdin_used+0x4d>
+            , line_num_(line_num)
+    1652:	|     |         c7 44 24 30 87 00 00 	movl   $0x87,0x30(%rsp)
+    1659:	|     |         00 
+                    nel::panic("bad Optional");
+    165a:	|     |         48 89 de             	mov    %rbx,%rsi
+    165d:	|     |         48 8d 3d 07 0a 00 00 	lea    0xa07(%rip),%rdi        # 206b <_IO_stdin_used+0x6b>
+            : fn_name_(fn_name)
+    1664:	|     |         48 89 44 24 20       	mov    %rax,0x20(%rsp)
+            , file_name_(file_name)
+    1669:	|     |         48 8d 05 e7 09 00 00 	lea    0x9e7(%rip),%rax        # 2057 <_IO_stdin_used+0x57>
+    1670:	|     |         48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    1675:	\-----|-------- e9 3c ff ff ff       	jmp    15b6 <ex3()+0xe8>
+}
+    167a:	      \-------> 48 89 ef             	mov    %rbp,%rdi
+    167d:	                e8 be 01 00 00       	call   1840 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()>
+    1682:	                48 81 c4 48 07 00 00 	add    $0x748,%rsp
+    1689:	                5b                   	pop    %rbx
+    168a:	                5d                   	pop    %rbp
+    168b:	                41 5c                	pop    %r12
+    168d:	                41 5d                	pop    %r13
+    168f:	                c3                   	ret
+
+0000000000001690 <U8Buf<256ul>::~U8Buf()>:
+}
+    1690:	ba 00 01 00 00       	mov    $0x100,%edx
+    1695:	be a5 00 00 00       	mov    $0xa5,%esi
+    169a:	e9 c4 03 00 00       	jmp    1a63 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    169f:	90                   	nop
+
+00000000000016a0 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::push(U8Buf<256ul>&&)>:
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+    16a0:	       55                   	push   %rbp
+    16a1:	       48 89 fd             	mov    %rdi,%rbp
+    16a4:	       53                   	push   %rbx
+    16a5:	       48 89 f3             	mov    %rsi,%rbx
+    16a8:	       48 89 d6             	mov    %rdx,%rsi
+    16ab:	       51                   	push   %rcx
+            return &ptr()[d];
+    16ac:	       48 8b 53 08          	mov    0x8(%rbx),%rdx
+            return len_ == N;
+    16b0:	       48 8b 03             	mov    (%rbx),%rax
+            return &ptr()[d];
+    16b3:	       48 c1 e2 08          	shl    $0x8,%rdx
+    16b7:	       48 8d 7c 13 18       	lea    0x18(%rbx,%rdx,1),%rdi
+            if (is_full()) {
+    16bc:	       48 83 f8 05          	cmp    $0x5,%rax
+    16c0:	/----- 75 15                	jne    16d7 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::push(U8Buf<256ul>&&)+0x37>
+                rp_ += 1;
+    16c2:	|      48 8b 43 10          	mov    0x10(%rbx),%rax
+    16c6:	|      48 ff c0             	inc    %rax
+                if (rp_ >= capacity()) { rp_ = 0; }
+    16c9:	|      48 83 f8 04          	cmp    $0x4,%rax
+    16cd:	|  /-- 76 02                	jbe    16d1 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::push(U8Buf<256ul>&&)+0x31>
+    16cf:	|  |   31 c0                	xor    %eax,%eax
+    16d1:	|  \-> 48 89 43 10          	mov    %rax,0x10(%rbx)
+        constexpr U8Buf &operator=(U8Buf &&o)
+    16d5:	|  /-- eb 06                	jmp    16dd <nel::heapless::Queue<U8Buf<256ul>, 5ul>::push(U8Buf<256ul>&&)+0x3d>
+                len_ += 1;
+    16d7:	\--|-> 48 ff c0             	inc    %rax
+    16da:	   |   48 89 03             	mov    %rax,(%rbx)
+            nel::elem::move(data_, o.data_, N);
+    16dd:	   \-> ba 00 01 00 00       	mov    $0x100,%edx
+    16e2:	       e8 84 03 00 00       	call   1a6b <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            wp_ += 1;
+    16e7:	       48 8b 43 08          	mov    0x8(%rbx),%rax
+    16eb:	       48 ff c0             	inc    %rax
+            if (wp_ >= capacity()) { wp_ = 0; }
+    16ee:	       48 83 f8 04          	cmp    $0x4,%rax
+    16f2:	   /-- 76 02                	jbe    16f6 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::push(U8Buf<256ul>&&)+0x56>
+    16f4:	   |   31 c0                	xor    %eax,%eax
+    16f6:	   \-> 48 89 43 08          	mov    %rax,0x8(%rbx)
+        }
+    16fa:	       48 89 e8             	mov    %rbp,%rax
+            : tag_(Tag::OK)
+    16fd:	       c7 45 00 01 00 00 00 	movl   $0x1,0x0(%rbp)
+    1704:	       5a                   	pop    %rdx
+    1705:	       5b                   	pop    %rbx
+    1706:	       5d                   	pop    %rbp
+    1707:	       c3                   	ret
+
+0000000000001708 <nel::Result<void, U8Buf<256ul> >::~Result()>:
+            switch (tag_) { // result<void>-dtor
+    1708:	       8b 07                	mov    (%rdi),%eax
+    170a:	       83 f8 01             	cmp    $0x1,%eax
+    170d:	   /-- 7f 05                	jg     1714 <nel::Result<void, U8Buf<256ul> >::~Result()+0xc>
+    170f:	   |   85 c0                	test   %eax,%eax
+    1711:	/--|-- 78 0f                	js     1722 <nel::Result<void, U8Buf<256ul> >::~Result()+0x1a>
+    1713:	|  |   c3                   	ret
+    1714:	|  \-> 83 f8 02             	cmp    $0x2,%eax
+    1717:	+----- 75 09                	jne    1722 <nel::Result<void, U8Buf<256ul> >::~Result()+0x1a>
+    1719:	|      48 83 c7 04          	add    $0x4,%rdi
+    171d:	|      e9 6e ff ff ff       	jmp    1690 <U8Buf<256ul>::~U8Buf()>
+        constexpr ~Result(void)
+    1722:	\----> 48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    1726:	       48 8d 05 6f 09 00 00 	lea    0x96f(%rip),%rax        # 209c <_IO_stdin_used+0x9c>
+                    nel::panic("bad Result");
+    172d:	       48 8d 3d 82 09 00 00 	lea    0x982(%rip),%rdi        # 20b6 <_IO_stdin_used+0xb6>
+    1734:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1739:	       48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    173e:	       48 8d 05 5f 09 00 00 	lea    0x95f(%rip),%rax        # 20a4 <_IO_stdin_used+0xa4>
+    1745:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    174a:	       c7 44 24 18 dd 02 00 	movl   $0x2dd,0x18(%rsp)
+    1751:	       00 
+    1752:	       e8 9b f9 ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+
+0000000000001757 <nel::operator<<(nel::Log&, nel::Optional<U8Buf<256ul> > const&)>:
+                                     [&fn](void) -> Optional { return fn(); },
+                                     ctx);
+        }
+
+    public:
+        friend Log &operator<<(Log &outs, Optional const &val)
+    1757:	             55                   	push   %rbp
+    1758:	             48 89 f5             	mov    %rsi,%rbp
+    175b:	             53                   	push   %rbx
+    175c:	             48 89 fb             	mov    %rdi,%rbx
+    175f:	             51                   	push   %rcx
+        {
+            switch (val.tag_) {
+    1760:	             8b 06                	mov    (%rsi),%eax
+    1762:	             48 8d 35 58 09 00 00 	lea    0x958(%rip),%rsi        # 20c1 <_IO_stdin_used+0xc1>
+    1769:	             83 f8 01             	cmp    $0x1,%eax
+    176c:	         /-- 74 1a                	je     1788 <nel::operator<<(nel::Log&, nel::Optional<U8Buf<256ul> > const&)+0x31>
+    176e:	         |   83 f8 02             	cmp    $0x2,%eax
+    1771:	      /--|-- 74 26                	je     1799 <nel::operator<<(nel::Log&, nel::Optional<U8Buf<256ul> > const&)+0x42>
+    1773:	      |  |   85 c0                	test   %eax,%eax
+    1775:	/-----|--|-- 75 4e                	jne    17c5 <nel::operator<<(nel::Log&, nel::Optional<U8Buf<256ul> > const&)+0x6e>
+                    outs << "))";
+                    return outs;
+                    break;
+                case Tag::INVAL:
+                    outs << "Optional("
+                         << "Inval)";
+    1777:	|     |  |   e8 7f 05 00 00       	call   1cfb <nel::operator<<(nel::Log&, char const*)>
+    177c:	|     |  |   48 8d 35 57 09 00 00 	lea    0x957(%rip),%rsi        # 20da <_IO_stdin_used+0xda>
+    1783:	|     |  |   48 89 c7             	mov    %rax,%rdi
+    1786:	|  /--|--|-- eb 4c                	jmp    17d4 <nel::operator<<(nel::Log&, nel::Optional<U8Buf<256ul> > const&)+0x7d>
+                         << "None)";
+    1788:	|  |  |  \-> e8 6e 05 00 00       	call   1cfb <nel::operator<<(nel::Log&, char const*)>
+    178d:	|  |  |      48 8d 35 37 09 00 00 	lea    0x937(%rip),%rsi        # 20cb <_IO_stdin_used+0xcb>
+    1794:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1797:	|  +--|----- eb 3b                	jmp    17d4 <nel::operator<<(nel::Log&, nel::Optional<U8Buf<256ul> > const&)+0x7d>
+                         << "Some(";
+    1799:	|  |  \----> e8 5d 05 00 00       	call   1cfb <nel::operator<<(nel::Log&, char const*)>
+    179e:	|  |         48 8d 35 2c 09 00 00 	lea    0x92c(%rip),%rsi        # 20d1 <_IO_stdin_used+0xd1>
+    17a5:	|  |         48 89 c7             	mov    %rax,%rdi
+    17a8:	|  |         e8 4e 05 00 00       	call   1cfb <nel::operator<<(nel::Log&, char const*)>
+        }
+
+    public:
+        constexpr Type const &ref(void) const
+        {
+            return value_;
+    17ad:	|  |         48 8d 75 04          	lea    0x4(%rbp),%rsi
+                    outs << *val.some_;
+    17b1:	|  |         48 89 df             	mov    %rbx,%rdi
+    17b4:	|  |         e8 50 fb ff ff       	call   1309 <operator<<(nel::Log&, U8Buf<256ul> const&) [clone .isra.0]>
+                    outs << "))";
+    17b9:	|  |         48 8d 35 17 09 00 00 	lea    0x917(%rip),%rsi        # 20d7 <_IO_stdin_used+0xd7>
+    17c0:	|  |         48 89 df             	mov    %rbx,%rdi
+    17c3:	|  +-------- eb 0f                	jmp    17d4 <nel::operator<<(nel::Log&, nel::Optional<U8Buf<256ul> > const&)+0x7d>
+                    return outs;
+                    break;
+                default:
+                    outs << "Optional("
+                         << "Unknown)";
+    17c5:	\--|-------> e8 31 05 00 00       	call   1cfb <nel::operator<<(nel::Log&, char const*)>
+    17ca:	   |         48 8d 35 10 09 00 00 	lea    0x910(%rip),%rsi        # 20e1 <_IO_stdin_used+0xe1>
+    17d1:	   |         48 89 c7             	mov    %rax,%rdi
+    17d4:	   \-------> e8 22 05 00 00       	call   1cfb <nel::operator<<(nel::Log&, char const*)>
+            }
+            return outs;
+        }
+    17d9:	             48 89 d8             	mov    %rbx,%rax
+    17dc:	             5a                   	pop    %rdx
+    17dd:	             5b                   	pop    %rbx
+    17de:	             5d                   	pop    %rbp
+    17df:	             c3                   	ret
+
+00000000000017e0 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter()>:
+    public:
+        typedef ChainIterator<SliceIterator<Type>> QueueIteratorMut;
+
+        QueueIteratorMut iter(void)
+        {
+            if (len() == 0) {
+    17e0:	       48 83 3e 00          	cmpq   $0x0,(%rsi)
+        QueueIteratorMut iter(void)
+    17e4:	       48 89 f8             	mov    %rdi,%rax
+            if (len() == 0) {
+    17e7:	   /-- 75 0b                	jne    17f4 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter()+0x14>
+
+    public:
+        // move ok
+        SliceIterator(SliceIterator &&o)
+            : b_(move(o.b_))
+            , e_(move(o.e_))
+    17e9:	   |   31 c9                	xor    %ecx,%ecx
+    17eb:	   |   48 89 0f             	mov    %rcx,(%rdi)
+    17ee:	   |   48 89 4f 08          	mov    %rcx,0x8(%rdi)
+ * probably not as complete as though.
+ *
+ * having own implementation as nel is to not need std.
+ */
+template<typename T>
+constexpr T &&move(T &v)
+    17f2:	/--|-- eb 2c                	jmp    1820 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter()+0x40>
+                auto s1 = Slice<Type>::empty();
+                auto s2 = s1;
+                return QueueIteratorMut(s1.iter(), s2.iter());
+            } else if (rp_ < wp_) {
+    17f4:	|  \-> 4c 8b 4e 10          	mov    0x10(%rsi),%r9
+    17f8:	|      4c 8b 46 08          	mov    0x8(%rsi),%r8
+    public:
+        // only if you know there's a value there..
+        // TODO: must have no bare pointers.. safety feature.
+        constexpr Type *ptr()
+        {
+            return &u_.elem_;
+    17fc:	|      48 8d 7e 18          	lea    0x18(%rsi),%rdi
+            return &ptr()[d];
+    1800:	|      4c 89 c9             	mov    %r9,%rcx
+    1803:	|      4c 89 c2             	mov    %r8,%rdx
+    1806:	|      48 c1 e1 08          	shl    $0x8,%rcx
+    180a:	|      48 c1 e2 08          	shl    $0x8,%rdx
+    180e:	|      48 01 f9             	add    %rdi,%rcx
+        }
+
+    public:
+        constexpr SliceIterator(T arr[], Count len)
+            : b_(arr)
+            , e_(arr + len)
+    1811:	|      48 01 fa             	add    %rdi,%rdx
+            : b_(move(o.b_))
+    1814:	|      48 89 08             	mov    %rcx,(%rax)
+            } else if (rp_ < wp_) {
+    1817:	|      4d 39 c1             	cmp    %r8,%r9
+    181a:	|  /-- 73 0f                	jae    182b <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter()+0x4b>
+            , e_(move(o.e_))
+    181c:	|  |   48 89 50 08          	mov    %rdx,0x8(%rax)
+    1820:	\--|-> 31 d2                	xor    %edx,%edx
+    1822:	   |   48 89 50 10          	mov    %rdx,0x10(%rax)
+    1826:	   |   48 89 50 18          	mov    %rdx,0x18(%rax)
+    182a:	   |   c3                   	ret
+            return &ptr()[d];
+    182b:	   \-> 48 81 c6 18 05 00 00 	add    $0x518,%rsi
+            : b_(move(o.b_))
+    1832:	       48 89 78 10          	mov    %rdi,0x10(%rax)
+    1836:	       48 89 70 08          	mov    %rsi,0x8(%rax)
+            , e_(move(o.e_))
+    183a:	       48 89 50 18          	mov    %rdx,0x18(%rax)
+            } else {
+                auto s1 = Slice(ptr(rp_), ptr(N));
+                auto s2 = Slice(ptr(), ptr(wp_));
+                return QueueIteratorMut(s1.iter(), s2.iter());
+            }
+        }
+    183e:	       c3                   	ret
+    183f:	       90                   	nop
+
+0000000000001840 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()>:
+        constexpr ~Queue(void)
+    1840:	                41 55                	push   %r13
+    1842:	                48 89 fe             	mov    %rdi,%rsi
+    1845:	                41 54                	push   %r12
+    1847:	                55                   	push   %rbp
+    1848:	                53                   	push   %rbx
+    1849:	                48 83 ec 28          	sub    $0x28,%rsp
+            iter().rev().for_each([&](auto &v) -> void { v.~Type(); });
+    184d:	                48 89 e7             	mov    %rsp,%rdi
+    1850:	                e8 8b ff ff ff       	call   17e0 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter()>
+            o.e_ = nullptr;
+    1855:	                31 c0                	xor    %eax,%eax
+    1857:	                31 d2                	xor    %edx,%edx
+            : b_(move(o.b_))
+    1859:	                4c 8b 2c 24          	mov    (%rsp),%r13
+            , e_(move(o.e_))
+    185d:	                48 8b 6c 24 08       	mov    0x8(%rsp),%rbp
+            : b_(move(o.b_))
+    1862:	                4c 8b 64 24 10       	mov    0x10(%rsp),%r12
+            o.e_ = nullptr;
+    1867:	                48 89 04 24          	mov    %rax,(%rsp)
+            , e_(move(o.e_))
+    186b:	                48 8b 5c 24 18       	mov    0x18(%rsp),%rbx
+            o.e_ = nullptr;
+    1870:	                48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1875:	                48 89 54 24 10       	mov    %rdx,0x10(%rsp)
+    187a:	                48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return it1_.is_done() && it2_.is_done();
+    187f:	/-------------> 49 39 ed             	cmp    %rbp,%r13
+    1882:	|     /-------- 75 11                	jne    1895 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()+0x55>
+    1884:	|     |         49 39 dc             	cmp    %rbx,%r12
+    1887:	|  /--|-------- 74 22                	je     18ab <nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()+0x6b>
+            --e_;
+        }
+
+        OutT deref_back(void)
+        {
+            return *(e_ - 1);
+    1889:	|  |  |     /-> 48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    1890:	|  |  |     |   48 89 df             	mov    %rbx,%rdi
+    1893:	|  |  |  /--|-- eb 0f                	jmp    18a4 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()+0x64>
+            }
+        }
+
+        OutT deref_back(void)
+        {
+            return (!it2_.is_done()) ? it2_.deref_back() : it1_.deref_back();
+    1895:	|  |  \--|--|-> 49 39 dc             	cmp    %rbx,%r12
+    1898:	|  |     |  \-- 75 ef                	jne    1889 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()+0x49>
+    189a:	|  |     |      48 81 ed 00 01 00 00 	sub    $0x100,%rbp
+    18a1:	|  |     |      48 89 ef             	mov    %rbp,%rdi
+    18a4:	|  |     \----> e8 e7 fd ff ff       	call   1690 <U8Buf<256ul>::~U8Buf()>
+        }
+    18a9:	\--|----------- eb d4                	jmp    187f <nel::heapless::Queue<U8Buf<256ul>, 5ul>::~Queue()+0x3f>
+        }
+    18ab:	   \----------> 48 83 c4 28          	add    $0x28,%rsp
+    18af:	                5b                   	pop    %rbx
+    18b0:	                5d                   	pop    %rbp
+    18b1:	                41 5c                	pop    %r12
+    18b3:	                41 5d                	pop    %r13
+    18b5:	                c3                   	ret
+
+00000000000018b6 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter() const>:
+
+        typedef ChainIterator<SliceIterator<Type const>> QueueIterator;
+
+        QueueIterator iter(void) const
+        {
+            if (len() == 0) {
+    18b6:	       48 83 3e 00          	cmpq   $0x0,(%rsi)
+        QueueIterator iter(void) const
+    18ba:	       48 89 f8             	mov    %rdi,%rax
+            if (len() == 0) {
+    18bd:	   /-- 75 0b                	jne    18ca <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter() const+0x14>
+            , e_(move(o.e_))
+    18bf:	   |   31 c9                	xor    %ecx,%ecx
+    18c1:	   |   48 89 0f             	mov    %rcx,(%rdi)
+    18c4:	   |   48 89 4f 08          	mov    %rcx,0x8(%rdi)
+    18c8:	/--|-- eb 2c                	jmp    18f6 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter() const+0x40>
+                auto s1 = Slice<Type const>::empty();
+                auto s2 = s1;
+                return QueueIterator(s1.iter(), s2.iter());
+            } else if (rp_ < wp_) {
+    18ca:	|  \-> 4c 8b 4e 10          	mov    0x10(%rsi),%r9
+    18ce:	|      4c 8b 46 08          	mov    0x8(%rsi),%r8
+        }
+
+        constexpr Type const *ptr() const
+        {
+            return &u_.elem_;
+    18d2:	|      48 8d 7e 18          	lea    0x18(%rsi),%rdi
+            return &ptr()[d];
+    18d6:	|      4c 89 c9             	mov    %r9,%rcx
+    18d9:	|      4c 89 c2             	mov    %r8,%rdx
+    18dc:	|      48 c1 e1 08          	shl    $0x8,%rcx
+    18e0:	|      48 c1 e2 08          	shl    $0x8,%rdx
+    18e4:	|      48 01 f9             	add    %rdi,%rcx
+            , e_(arr + len)
+    18e7:	|      48 01 fa             	add    %rdi,%rdx
+            : b_(move(o.b_))
+    18ea:	|      48 89 08             	mov    %rcx,(%rax)
+            } else if (rp_ < wp_) {
+    18ed:	|      4d 39 c1             	cmp    %r8,%r9
+    18f0:	|  /-- 73 0f                	jae    1901 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter() const+0x4b>
+            , e_(move(o.e_))
+    18f2:	|  |   48 89 50 08          	mov    %rdx,0x8(%rax)
+    18f6:	\--|-> 31 d2                	xor    %edx,%edx
+    18f8:	   |   48 89 50 10          	mov    %rdx,0x10(%rax)
+    18fc:	   |   48 89 50 18          	mov    %rdx,0x18(%rax)
+    1900:	   |   c3                   	ret
+            return &ptr()[d];
+    1901:	   \-> 48 81 c6 18 05 00 00 	add    $0x518,%rsi
+            : b_(move(o.b_))
+    1908:	       48 89 78 10          	mov    %rdi,0x10(%rax)
+    190c:	       48 89 70 08          	mov    %rsi,0x8(%rax)
+            , e_(move(o.e_))
+    1910:	       48 89 50 18          	mov    %rdx,0x18(%rax)
+            } else {
+                auto s1 = Slice(ptr(rp_), ptr(N));
+                auto s2 = Slice(ptr(), ptr(wp_));
+                return QueueIterator(s1.iter(), s2.iter());
+            }
+        }
+    1914:	       c3                   	ret
+    1915:	       90                   	nop
+
+0000000000001916 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&>(nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&)>:
+        void for_each(F &&fn)
+    1916:	       41 54                	push   %r12
+    1918:	       55                   	push   %rbp
+    1919:	       48 89 f5             	mov    %rsi,%rbp
+    191c:	       53                   	push   %rbx
+    191d:	       48 89 fb             	mov    %rdi,%rbx
+            return (b_ == e_);
+    1920:	/----> 4c 8b 23             	mov    (%rbx),%r12
+            for (; !self().is_done(); self().inc()) {
+    1923:	|      4c 39 63 08          	cmp    %r12,0x8(%rbx)
+    1927:	|  /-- 74 22                	je     194b <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&>(nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&)+0x35>
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    1929:	|  |   48 8b 7d 00          	mov    0x0(%rbp),%rdi
+    192d:	|  |   be 2c 00 00 00       	mov    $0x2c,%esi
+    1932:	|  |   e8 ab 03 00 00       	call   1ce2 <nel::operator<<(nel::Log&, char)>
+    1937:	|  |   4c 89 e6             	mov    %r12,%rsi
+    193a:	|  |   48 89 c7             	mov    %rax,%rdi
+    193d:	|  |   e8 c7 f9 ff ff       	call   1309 <operator<<(nel::Log&, U8Buf<256ul> const&) [clone .isra.0]>
+            ++b_;
+    1942:	|  |   48 81 03 00 01 00 00 	addq   $0x100,(%rbx)
+        }
+    1949:	\--|-- eb d5                	jmp    1920 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&>(nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&)+0xa>
+        }
+    194b:	   \-> 5b                   	pop    %rbx
+    194c:	       5d                   	pop    %rbp
+    194d:	       41 5c                	pop    %r12
+    194f:	       c3                   	ret
+
+0000000000001950 <nel::heapless::operator<<(nel::Log&, nel::heapless::Queue<U8Buf<256ul>, 5ul> const&)>:
+         * @param outs the stream to dump the representation into.
+         */
+        // TODO: replace <<(Log ) with dbgfmt, so separate out from
+        // any other form of conversion to charstring.
+        // TODO: insert into formatter and not final dest type.
+        friend Log &operator<<(Log &outs, Queue const &v)
+    1950:	          55                   	push   %rbp
+    1951:	          48 89 f5             	mov    %rsi,%rbp
+        {
+            outs << "Queue<" << N << ">(" << v.len() << "){";
+    1954:	          48 8d 35 8f 07 00 00 	lea    0x78f(%rip),%rsi        # 20ea <_IO_stdin_used+0xea>
+        friend Log &operator<<(Log &outs, Queue const &v)
+    195b:	          53                   	push   %rbx
+    195c:	          48 89 fb             	mov    %rdi,%rbx
+    195f:	          48 83 ec 58          	sub    $0x58,%rsp
+            outs << "Queue<" << N << ">(" << v.len() << "){";
+    1963:	          e8 93 03 00 00       	call   1cfb <nel::operator<<(nel::Log&, char const*)>
+    1968:	          be 05 00 00 00       	mov    $0x5,%esi
+    196d:	          48 89 c7             	mov    %rax,%rdi
+    1970:	          e8 21 04 00 00       	call   1d96 <nel::operator<<(nel::Log&, unsigned long)>
+    1975:	          48 8d 35 75 07 00 00 	lea    0x775(%rip),%rsi        # 20f1 <_IO_stdin_used+0xf1>
+    197c:	          48 89 c7             	mov    %rax,%rdi
+    197f:	          e8 77 03 00 00       	call   1cfb <nel::operator<<(nel::Log&, char const*)>
+    1984:	          48 8b 75 00          	mov    0x0(%rbp),%rsi
+    1988:	          48 89 c7             	mov    %rax,%rdi
+    198b:	          e8 06 04 00 00       	call   1d96 <nel::operator<<(nel::Log&, unsigned long)>
+    1990:	          48 8d 35 5d 07 00 00 	lea    0x75d(%rip),%rsi        # 20f4 <_IO_stdin_used+0xf4>
+    1997:	          48 89 c7             	mov    %rax,%rdi
+    199a:	          e8 5c 03 00 00       	call   1cfb <nel::operator<<(nel::Log&, char const*)>
+            outs << v.iter();
+    199f:	          48 89 ee             	mov    %rbp,%rsi
+    19a2:	          48 8d 7c 24 10       	lea    0x10(%rsp),%rdi
+    19a7:	          e8 0a ff ff ff       	call   18b6 <nel::heapless::Queue<U8Buf<256ul>, 5ul>::iter() const>
+            outs << '[';
+    19ac:	          be 5b 00 00 00       	mov    $0x5b,%esi
+    19b1:	          48 89 df             	mov    %rbx,%rdi
+    19b4:	          e8 29 03 00 00       	call   1ce2 <nel::operator<<(nel::Log&, char)>
+            ItT it2 = it;
+    19b9:	          0f 10 44 24 10       	movups 0x10(%rsp),%xmm0
+    19be:	          0f 10 4c 24 20       	movups 0x20(%rsp),%xmm1
+    19c3:	          66 48 0f 7e c5       	movq   %xmm0,%rbp
+    19c8:	          0f 11 44 24 30       	movups %xmm0,0x30(%rsp)
+    19cd:	          0f 11 4c 24 40       	movups %xmm1,0x40(%rsp)
+            return it1_.is_done() && it2_.is_done();
+    19d2:	          48 3b 6c 24 38       	cmp    0x38(%rsp),%rbp
+    19d7:	   /----- 75 25                	jne    19fe <nel::heapless::operator<<(nel::Log&, nel::heapless::Queue<U8Buf<256ul>, 5ul> const&)+0xae>
+            return (b_ == e_);
+    19d9:	   |      48 8b 6c 24 40       	mov    0x40(%rsp),%rbp
+    19de:	   |      48 39 6c 24 48       	cmp    %rbp,0x48(%rsp)
+    19e3:	/--|----- 74 54                	je     1a39 <nel::heapless::operator<<(nel::Log&, nel::heapless::Queue<U8Buf<256ul>, 5ul> const&)+0xe9>
+                outs << it2.deref();
+    19e5:	|  |      48 89 ee             	mov    %rbp,%rsi
+    19e8:	|  |      48 89 df             	mov    %rbx,%rdi
+            ++b_;
+    19eb:	|  |      48 81 c5 00 01 00 00 	add    $0x100,%rbp
+    19f2:	|  |      e8 12 f9 ff ff       	call   1309 <operator<<(nel::Log&, U8Buf<256ul> const&) [clone .isra.0]>
+    19f7:	|  |      48 89 6c 24 40       	mov    %rbp,0x40(%rsp)
+        }
+    19fc:	|  |  /-- eb 17                	jmp    1a15 <nel::heapless::operator<<(nel::Log&, nel::heapless::Queue<U8Buf<256ul>, 5ul> const&)+0xc5>
+    19fe:	|  \--|-> 48 89 ee             	mov    %rbp,%rsi
+    1a01:	|     |   48 89 df             	mov    %rbx,%rdi
+            ++b_;
+    1a04:	|     |   48 81 c5 00 01 00 00 	add    $0x100,%rbp
+    1a0b:	|     |   e8 f9 f8 ff ff       	call   1309 <operator<<(nel::Log&, U8Buf<256ul> const&) [clone .isra.0]>
+    1a10:	|     |   48 89 6c 24 30       	mov    %rbp,0x30(%rsp)
+         */
+        // void for_each(std::function<void(OutT)> fn)
+        template<typename F>
+        void for_each(F &&fn)
+        {
+            it1_.for_each(fn);
+    1a15:	|     \-> 48 8d 6c 24 08       	lea    0x8(%rsp),%rbp
+    1a1a:	|         48 8d 7c 24 30       	lea    0x30(%rsp),%rdi
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    1a1f:	|         48 89 5c 24 08       	mov    %rbx,0x8(%rsp)
+            it1_.for_each(fn);
+    1a24:	|         48 89 ee             	mov    %rbp,%rsi
+    1a27:	|         e8 ea fe ff ff       	call   1916 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&>(nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&)>
+            it2_.for_each(fn);
+    1a2c:	|         48 8d 7c 24 40       	lea    0x40(%rsp),%rdi
+    1a31:	|         48 89 ee             	mov    %rbp,%rsi
+    1a34:	|         e8 dd fe ff ff       	call   1916 <void nel::Iterator<nel::SliceIterator<U8Buf<256ul> const>, U8Buf<256ul> const&, U8Buf<256ul> const&>::for_each<nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&>(nel::operator<<(nel::Log&, nel::ChainIterator<nel::SliceIterator<U8Buf<256ul> const> > const&)::{lambda(U8Buf<256ul> const&)#1}&)>
+            outs << ']';
+    1a39:	\-------> 48 89 df             	mov    %rbx,%rdi
+    1a3c:	          be 5d 00 00 00       	mov    $0x5d,%esi
+    1a41:	          e8 9c 02 00 00       	call   1ce2 <nel::operator<<(nel::Log&, char)>
+            outs << '}';
+    1a46:	          48 89 df             	mov    %rbx,%rdi
+    1a49:	          be 7d 00 00 00       	mov    $0x7d,%esi
+    1a4e:	          e8 8f 02 00 00       	call   1ce2 <nel::operator<<(nel::Log&, char)>
+            return outs;
+        }
+    1a53:	          48 83 c4 58          	add    $0x58,%rsp
+    1a57:	          48 89 d8             	mov    %rbx,%rax
+    1a5a:	          5b                   	pop    %rbx
+    1a5b:	          5d                   	pop    %rbp
+    1a5c:	          c3                   	ret
+
+0000000000001a5d <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1a5d:	48 89 d1             	mov    %rdx,%rcx
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    1a60:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1a62:	c3                   	ret
+
+0000000000001a63 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    1a63:	48 89 d1             	mov    %rdx,%rcx
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    1a66:	89 f0                	mov    %esi,%eax
+    1a68:	f3 aa                	rep stos %al,%es:(%rdi)
+}
+    1a6a:	c3                   	ret
+
+0000000000001a6b <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    1a6b:	48 89 d1             	mov    %rdx,%rcx
+    1a6e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    1a70:	c3                   	ret
+
+0000000000001a71 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    1a71:	e9 2a f6 ff ff       	jmp    10a0 <memmove@plt>
+
+0000000000001a76 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    1a76:	48 89 f1             	mov    %rsi,%rcx
+    std::memset(d, s, n);
+    1a79:	b0 a5                	mov    $0xa5,%al
+    1a7b:	f3 aa                	rep stos %al,%es:(%rdi)
+    set(d, 0xa5, n);
+}
+    1a7d:	c3                   	ret
+
+0000000000001a7e <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1a7e:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    1a7f:	e8 ec f5 ff ff       	call   1070 <memcmp@plt>
+}
+    1a84:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) == 0;
+    1a85:	85 c0                	test   %eax,%eax
+    1a87:	0f 94 c0             	sete   %al
+}
+    1a8a:	c3                   	ret
+
+0000000000001a8b <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1a8b:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    1a8c:	e8 df f5 ff ff       	call   1070 <memcmp@plt>
+}
+    1a91:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) != 0;
+    1a92:	85 c0                	test   %eax,%eax
+    1a94:	0f 95 c0             	setne  %al
+}
+    1a97:	c3                   	ret
+
+0000000000001a98 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+{
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1a98:	          49 89 fa             	mov    %rdi,%r10
+    1a9b:	          48 89 f0             	mov    %rsi,%rax
+    if (n < streaming_min) {
+    1a9e:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1aa5:	      /-- 77 05                	ja     1aac <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14>
+    std::memcpy(d, s, n);
+    1aa7:	      |   48 89 d1             	mov    %rdx,%rcx
+    1aaa:	/-----|-- eb 79                	jmp    1b25 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x8d>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1aac:	|     \-> 48 89 f9             	mov    %rdi,%rcx
+    1aaf:	|         48 f7 d9             	neg    %rcx
+    1ab2:	|         83 e1 0f             	and    $0xf,%ecx
+    1ab5:	|         49 89 c8             	mov    %rcx,%r8
+    std::memcpy(d, s, n);
+    1ab8:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1aba:	|         49 8d 70 40          	lea    0x40(%r8),%rsi
+    1abe:	|         48 89 f9             	mov    %rdi,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1ac1:	|     /-> 0f 10 54 30 d0       	movups -0x30(%rax,%rsi,1),%xmm2
+    1ac6:	|     |   0f 10 4c 30 e0       	movups -0x20(%rax,%rsi,1),%xmm1
+    1acb:	|     |   49 89 f0             	mov    %rsi,%r8
+    for (; i + 64 <= n; i += 64) {
+    1ace:	|     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1ad2:	|     |   0f 10 44 30 f0       	movups -0x10(%rax,%rsi,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1ad7:	|     |   0f 10 5c 30 c0       	movups -0x40(%rax,%rsi,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    1adc:	|     |   48 83 c6 40          	add    $0x40,%rsi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1ae0:	|     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    1ae5:	|     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    1aea:	|     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    1aef:	|     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    1af4:	|     |   48 39 f2             	cmp    %rsi,%rdx
+    1af7:	|     \-- 73 c8                	jae    1ac1 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x29>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    1af9:	|  /----> 49 8d 48 10          	lea    0x10(%r8),%rcx
+        stream16(d + i, load16(s + i));
+    1afd:	|  |      4f 8d 0c 02          	lea    (%r10,%r8,1),%r9
+    for (; i + 16 <= n; i += 16) {
+    1b01:	|  |      48 39 ca             	cmp    %rcx,%rdx
+    1b04:	|  |  /-- 72 0f                	jb     1b15 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x7d>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1b06:	|  |  |   0f 10 64 08 f0       	movups -0x10(%rax,%rcx,1),%xmm4
+    1b0b:	|  |  |   49 89 c8             	mov    %rcx,%r8
+    1b0e:	|  |  |   66 41 0f e7 21       	movntdq %xmm4,(%r9)
+    for (; i + 16 <= n; i += 16) {
+    1b13:	|  \--|-- eb e4                	jmp    1af9 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x61>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    1b15:	|     \-> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    1b18:	|         4c 29 c2             	sub    %r8,%rdx
+        stream16(d + i, load16(s + i));
+    1b1b:	|         4a 8d 34 00          	lea    (%rax,%r8,1),%rsi
+    std::memcpy(d, s, n);
+    1b1f:	|         4c 89 cf             	mov    %r9,%rdi
+    copy(d + i, s + i, n - i);
+    1b22:	|         48 89 d1             	mov    %rdx,%rcx
+    std::memcpy(d, s, n);
+    1b25:	\-------> f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1b27:	          c3                   	ret
+
+0000000000001b28 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    1b28:	          49 89 f8             	mov    %rdi,%r8
+    if (n < streaming_min) {
+    1b2b:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1b32:	/-------- 77 37                	ja     1b6b <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x43>
+    Length done = (n < 16) ? n : 16;
+    1b34:	|         b8 10 00 00 00       	mov    $0x10,%eax
+    1b39:	|         48 39 c2             	cmp    %rax,%rdx
+    1b3c:	|         48 0f 46 c2          	cmovbe %rdx,%rax
+    std::memcpy(d, s, n);
+    1b40:	|         89 c1                	mov    %eax,%ecx
+    1b42:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    1b44:	|  /----> 48 39 d0             	cmp    %rdx,%rax
+    1b47:	|  |  /-- 73 21                	jae    1b6a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42>
+        Length const m = (done < n - done) ? done : n - done;
+    1b49:	|  |  |   49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    1b4c:	|  |  |   4d 8d 14 00          	lea    (%r8,%rax,1),%r10
+    std::memcpy(d, s, n);
+    1b50:	|  |  |   4c 89 c6             	mov    %r8,%rsi
+        Length const m = (done < n - done) ? done : n - done;
+    1b53:	|  |  |   49 29 c1             	sub    %rax,%r9
+    std::memcpy(d, s, n);
+    1b56:	|  |  |   4c 89 d7             	mov    %r10,%rdi
+        Length const m = (done < n - done) ? done : n - done;
+    1b59:	|  |  |   49 39 c1             	cmp    %rax,%r9
+    1b5c:	|  |  |   4c 0f 47 c8          	cmova  %rax,%r9
+    std::memcpy(d, s, n);
+    1b60:	|  |  |   44 89 c9             	mov    %r9d,%ecx
+        done += m;
+    1b63:	|  |  |   4c 01 c8             	add    %r9,%rax
+    std::memcpy(d, s, n);
+    1b66:	|  |  |   f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+        done += m;
+    1b68:	|  \--|-- eb da                	jmp    1b44 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c>
+    1b6a:	|     \-> c3                   	ret
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1b6b:	\-------> 48 89 f8             	mov    %rdi,%rax
+    for (Index i = 0; i < head; ++i) {
+    1b6e:	          31 c9                	xor    %ecx,%ecx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1b70:	          48 f7 d8             	neg    %rax
+    1b73:	          83 e0 0f             	and    $0xf,%eax
+    for (Index i = 0; i < head; ++i) {
+    1b76:	   /----> 48 39 c1             	cmp    %rax,%rcx
+    1b79:	   |  /-- 74 0d                	je     1b88 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x60>
+        d[i] = p[i];
+    1b7b:	   |  |   40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+    1b7f:	   |  |   41 88 3c 08          	mov    %dil,(%r8,%rcx,1)
+    for (Index i = 0; i < head; ++i) {
+    1b83:	   |  |   48 ff c1             	inc    %rcx
+    1b86:	   \--|-- eb ee                	jmp    1b76 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4e>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    1b88:	      \-> 31 c9                	xor    %ecx,%ecx
+        rotated[i] = p[(head + i) % 16];
+    1b8a:	      /-> 48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+    1b8e:	      |   83 e7 0f             	and    $0xf,%edi
+    1b91:	      |   40 8a 3c 3e          	mov    (%rsi,%rdi,1),%dil
+    1b95:	      |   40 88 7c 0c e8       	mov    %dil,-0x18(%rsp,%rcx,1)
+    for (Index i = 0; i < 16; ++i) {
+    1b9a:	      |   48 ff c1             	inc    %rcx
+    1b9d:	      |   48 83 f9 10          	cmp    $0x10,%rcx
+    1ba1:	      \-- 75 e7                	jne    1b8a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x62>
+    std::memcpy(&v, s, sizeof(v));
+    1ba3:	          0f 28 44 24 e8       	movaps -0x18(%rsp),%xmm0
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1ba8:	          48 8d 78 40          	lea    0x40(%rax),%rdi
+    1bac:	          4c 01 c0             	add    %r8,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1baf:	      /-> 48 89 f9             	mov    %rdi,%rcx
+    for (; i + 64 <= n; i += 64) {
+    1bb2:	      |   48 8d 7f 40          	lea    0x40(%rdi),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1bb6:	      |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    1bba:	      |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    1bbf:	      |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    1bc4:	      |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    1bc9:	      |   48 83 c0 40          	add    $0x40,%rax
+    1bcd:	      |   48 39 fa             	cmp    %rdi,%rdx
+    1bd0:	      \-- 73 dd                	jae    1baf <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x87>
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+        stream16(d + i, v);
+    1bd2:	          49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    for (; i + 16 <= n; i += 16) {
+    1bd6:	   /----> 48 8d 41 10          	lea    0x10(%rcx),%rax
+    1bda:	   |      48 39 c2             	cmp    %rax,%rdx
+    1bdd:	   |  /-- 72 0a                	jb     1be9 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc1>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1bdf:	   |  |   48 89 c1             	mov    %rax,%rcx
+    1be2:	   |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    1be7:	   \--|-- eb ed                	jmp    1bd6 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xae>
+    }
+    __builtin_ia32_sfence();
+    1be9:	      \-> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    1bec:	   /----> 48 39 d1             	cmp    %rdx,%rcx
+    1bef:	   |  /-- 73 12                	jae    1c03 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xdb>
+        d[i] = p[i % 16];
+    1bf1:	   |  |   48 89 c8             	mov    %rcx,%rax
+    1bf4:	   |  |   83 e0 0f             	and    $0xf,%eax
+    1bf7:	   |  |   8a 04 06             	mov    (%rsi,%rax,1),%al
+    1bfa:	   |  |   41 88 04 08          	mov    %al,(%r8,%rcx,1)
+    for (; i < n; ++i) {
+    1bfe:	   |  |   48 ff c1             	inc    %rcx
+    1c01:	   \--|-- eb e9                	jmp    1bec <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc4>
+    }
+}
+    1c03:	      \-> c3                   	ret
+
+0000000000001c04 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    1c04:	    48 85 ff             	test   %rdi,%rdi
+    1c07:	/-- 74 09                	je     1c12 <nel::free_aligned(void*)+0xe>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    1c09:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    1c0d:	|   e9 1e f4 ff ff       	jmp    1030 <free@plt>
+}
+    1c12:	\-> c3                   	ret
+
+0000000000001c13 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    1c13:	       41 56                	push   %r14
+            : fn_name_(fn_name)
+    1c15:	       48 8d 05 13 05 00 00 	lea    0x513(%rip),%rax        # 212f <_IO_stdin_used+0x12f>
+    1c1c:	       41 55                	push   %r13
+    1c1e:	       41 54                	push   %r12
+    1c20:	       55                   	push   %rbp
+    1c21:	       53                   	push   %rbx
+    1c22:	       48 83 ec 20          	sub    $0x20,%rsp
+    1c26:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , file_name_(file_name)
+    1c2b:	       48 8d 05 0d 05 00 00 	lea    0x50d(%rip),%rax        # 213f <_IO_stdin_used+0x13f>
+    1c32:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1c37:	       c7 44 24 18 f3 00 00 	movl   $0xf3,0x18(%rsp)
+    1c3e:	       00 
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    1c3f:	       48 85 f6             	test   %rsi,%rsi
+    1c42:	/----- 74 28                	je     1c6c <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1c44:	|      4c 8d 66 ff          	lea    -0x1(%rsi),%r12
+    1c48:	|      48 89 f3             	mov    %rsi,%rbx
+    1c4b:	|      49 21 f4             	and    %rsi,%r12
+    1c4e:	+----- 75 1c                	jne    1c6c <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1c50:	|      49 89 fd             	mov    %rdi,%r13
+    1c53:	|      49 89 d6             	mov    %rdx,%r14
+    1c56:	|      48 89 cd             	mov    %rcx,%rbp
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1c59:	|      31 ff                	xor    %edi,%edi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    1c5b:	|      4d 85 ed             	test   %r13,%r13
+    1c5e:	|  /-- 74 1d                	je     1c7d <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+    1c60:	|  |   4d 8b 65 f8          	mov    -0x8(%r13),%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1c64:	|  |   4c 89 ef             	mov    %r13,%rdi
+    1c67:	|  |   4c 29 e7             	sub    %r12,%rdi
+    1c6a:	|  +-- eb 11                	jmp    1c7d <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    1c6c:	\--|-> 48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    1c71:	   |   48 8d 3d d9 04 00 00 	lea    0x4d9(%rip),%rdi        # 2151 <_IO_stdin_used+0x151>
+    1c78:	   |   e8 a5 f4 ff ff       	call   1122 <nel::assert_fail(char const*, nel::Context const&)>
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1c7d:	   \-> 48 8d 34 2b          	lea    (%rbx,%rbp,1),%rsi
+    1c81:	       e8 0a f4 ff ff       	call   1090 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    1c86:	       48 85 c0             	test   %rax,%rax
+    1c89:	/----- 74 3b                	je     1cc6 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb3>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1c8b:	|      48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    1c90:	|      48 f7 db             	neg    %rbx
+    1c93:	|      48 21 d9             	and    %rbx,%rcx
+    1c96:	|      48 89 cb             	mov    %rcx,%rbx
+    1c99:	|      48 29 c3             	sub    %rax,%rbx
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    1c9c:	|      4d 85 ed             	test   %r13,%r13
+    1c9f:	|  /-- 74 1e                	je     1cbf <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+    1ca1:	|  |   49 39 dc             	cmp    %rbx,%r12
+    1ca4:	|  +-- 74 19                	je     1cbf <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    1ca6:	|  |   4c 39 f5             	cmp    %r14,%rbp
+    1ca9:	|  |   4c 89 f2             	mov    %r14,%rdx
+    1cac:	|  |   4a 8d 34 20          	lea    (%rax,%r12,1),%rsi
+    1cb0:	|  |   48 89 cf             	mov    %rcx,%rdi
+    1cb3:	|  |   48 0f 46 d5          	cmovbe %rbp,%rdx
+    1cb7:	|  |   e8 e4 f3 ff ff       	call   10a0 <memmove@plt>
+    1cbc:	|  |   48 89 c1             	mov    %rax,%rcx
+    }
+    offset_field(new_p) = new_offset;
+    1cbf:	|  \-> 48 89 59 f8          	mov    %rbx,-0x8(%rcx)
+    return new_p;
+    1cc3:	|      48 89 c8             	mov    %rcx,%rax
+}
+    1cc6:	\----> 48 83 c4 20          	add    $0x20,%rsp
+    1cca:	       5b                   	pop    %rbx
+    1ccb:	       5d                   	pop    %rbp
+    1ccc:	       41 5c                	pop    %r12
+    1cce:	       41 5d                	pop    %r13
+    1cd0:	       41 5e                	pop    %r14
+    1cd2:	       c3                   	ret
+
+0000000000001cd3 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    1cd3:	48 89 f1             	mov    %rsi,%rcx
+    return realloc_aligned(nullptr, align, 0, size);
+    1cd6:	31 d2                	xor    %edx,%edx
+    1cd8:	48 89 fe             	mov    %rdi,%rsi
+    1cdb:	31 ff                	xor    %edi,%edi
+    1cdd:	e9 31 ff ff ff       	jmp    1c13 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+
+0000000000001ce2 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1ce2:	53                   	push   %rbx
+    1ce3:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    1ce6:	40 0f be fe          	movsbl %sil,%edi
+    1cea:	48 8b 35 6f 23 00 00 	mov    0x236f(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    1cf1:	e8 6a f3 ff ff       	call   1060 <fputc@plt>
+    return outs;
+}
+    1cf6:	48 89 d8             	mov    %rbx,%rax
+    1cf9:	5b                   	pop    %rbx
+    1cfa:	c3                   	ret
+
+0000000000001cfb <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1cfb:	53                   	push   %rbx
+    1cfc:	48 89 fb             	mov    %rdi,%rbx
+    1cff:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    1d02:	48 8b 35 57 23 00 00 	mov    0x2357(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    1d09:	e8 42 f3 ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    1d0e:	48 89 d8             	mov    %rbx,%rax
+    1d11:	5b                   	pop    %rbx
+    1d12:	c3                   	ret
+
+0000000000001d13 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1d13:	53                   	push   %rbx
+    1d14:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    1d17:	48 8b 3d 42 23 00 00 	mov    0x2342(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1d1e:	40 0f b6 d6          	movzbl %sil,%edx
+    1d22:	31 c0                	xor    %eax,%eax
+    1d24:	48 8d 35 41 04 00 00 	lea    0x441(%rip),%rsi        # 216c <_IO_stdin_used+0x16c>
+    1d2b:	e8 50 f3 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1d30:	48 89 d8             	mov    %rbx,%rax
+    1d33:	5b                   	pop    %rbx
+    1d34:	c3                   	ret
+
+0000000000001d35 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    1d35:	53                   	push   %rbx
+    1d36:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    1d39:	48 8b 3d 20 23 00 00 	mov    0x2320(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1d40:	0f b7 d6             	movzwl %si,%edx
+    1d43:	31 c0                	xor    %eax,%eax
+    1d45:	48 8d 35 20 04 00 00 	lea    0x420(%rip),%rsi        # 216c <_IO_stdin_used+0x16c>
+    1d4c:	e8 2f f3 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1d51:	48 89 d8             	mov    %rbx,%rax
+    1d54:	5b                   	pop    %rbx
+    1d55:	c3                   	ret
+
+0000000000001d56 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    1d56:	53                   	push   %rbx
+    1d57:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    1d5a:	48 8b 3d ff 22 00 00 	mov    0x22ff(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1d61:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    1d63:	31 c0                	xor    %eax,%eax
+    1d65:	48 8d 35 00 04 00 00 	lea    0x400(%rip),%rsi        # 216c <_IO_stdin_used+0x16c>
+    1d6c:	e8 0f f3 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1d71:	48 89 d8             	mov    %rbx,%rax
+    1d74:	5b                   	pop    %rbx
+    1d75:	c3                   	ret
+
+0000000000001d76 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    1d76:	53                   	push   %rbx
+    1d77:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    1d7a:	48 8b 3d df 22 00 00 	mov    0x22df(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1d81:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    1d83:	31 c0                	xor    %eax,%eax
+    1d85:	48 8d 35 e0 03 00 00 	lea    0x3e0(%rip),%rsi        # 216c <_IO_stdin_used+0x16c>
+    1d8c:	e8 ef f2 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1d91:	48 89 d8             	mov    %rbx,%rax
+    1d94:	5b                   	pop    %rbx
+    1d95:	c3                   	ret
+
+0000000000001d96 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    1d96:	53                   	push   %rbx
+    1d97:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    1d9a:	48 8b 3d bf 22 00 00 	mov    0x22bf(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1da1:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    1da4:	31 c0                	xor    %eax,%eax
+    1da6:	48 8d 35 c2 03 00 00 	lea    0x3c2(%rip),%rsi        # 216f <_IO_stdin_used+0x16f>
+    1dad:	e8 ce f2 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1db2:	48 89 d8             	mov    %rbx,%rax
+    1db5:	5b                   	pop    %rbx
+    1db6:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000001db8 <_fini>:
+    1db8:	48 83 ec 08          	sub    $0x8,%rsp
+    1dbc:	48 83 c4 08          	add    $0x8,%rsp
+    1dc0:	c3                   	ret
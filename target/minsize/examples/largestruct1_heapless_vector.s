@@ -0,0 +1,1735 @@
+
+target/minsize/examples/largestruct1_heapless_vector:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputc@plt>:
+    1060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 4018 <fputc@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <memcmp@plt>:
+    1070:	ff 25 aa 2f 00 00    	jmp    *0x2faa(%rip)        # 4020 <memcmp@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fprintf@plt>:
+    1080:	ff 25 a2 2f 00 00    	jmp    *0x2fa2(%rip)        # 4028 <fprintf@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <realloc@plt>:
+    1090:	ff 25 9a 2f 00 00    	jmp    *0x2f9a(%rip)        # 4030 <realloc@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memmove@plt>:
+    10a0:	ff 25 92 2f 00 00    	jmp    *0x2f92(%rip)        # 4038 <memmove@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010b0 <__cxa_finalize@plt>:
+    10b0:	ff 25 2a 2f 00 00    	jmp    *0x2f2a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10b6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010c0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10c0:	50                   	push   %rax
+    std::abort();
+    10c1:	e8 7a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010c6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10c6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10c7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10ca:	4c 8d 0d 25 10 00 00 	lea    0x1025(%rip),%r9        # 20f6 <_IO_stdin_used+0xf6>
+    10d1:	31 c0                	xor    %eax,%eax
+    10d3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10d7:	4c 8b 07             	mov    (%rdi),%r8
+    10da:	48 8d 35 1b 10 00 00 	lea    0x101b(%rip),%rsi        # 20fc <_IO_stdin_used+0xfc>
+    10e1:	48 8b 3d 78 2f 00 00 	mov    0x2f78(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    10e8:	e8 93 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    10ed:	e8 4e ff ff ff       	call   1040 <abort@plt>
+
+00000000000010f2 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    10f2:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    10f6:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    10f9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    10fd:	31 c0                	xor    %eax,%eax
+    10ff:	57                   	push   %rdi
+    1100:	48 8b 3d 59 2f 00 00 	mov    0x2f59(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1107:	4c 8d 0d e8 0f 00 00 	lea    0xfe8(%rip),%r9        # 20f6 <_IO_stdin_used+0xf6>
+    110e:	4c 8b 06             	mov    (%rsi),%r8
+    1111:	48 8d 35 f5 0f 00 00 	lea    0xff5(%rip),%rsi        # 210d <_IO_stdin_used+0x10d>
+    1118:	e8 63 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    111d:	e8 1e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001122 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1122:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1126:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1129:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    112d:	31 c0                	xor    %eax,%eax
+    112f:	57                   	push   %rdi
+    1130:	48 8b 3d 29 2f 00 00 	mov    0x2f29(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1137:	4c 8d 0d e4 0f 00 00 	lea    0xfe4(%rip),%r9        # 2122 <_IO_stdin_used+0x122>
+    113e:	4c 8b 06             	mov    (%rsi),%r8
+    1141:	48 8d 35 c5 0f 00 00 	lea    0xfc5(%rip),%rsi        # 210d <_IO_stdin_used+0x10d>
+    1148:	e8 33 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    114d:	e8 ee fe ff ff       	call   1040 <abort@plt>
+
+0000000000001152 <main>:
+        nel::log << v << '\n';
+    }
+}
+
+int main()
+{
+    1152:	53                   	push   %rbx
+    nel::log << "ex1:b" << '\n';
+    1153:	48 8d 1d 0f 2f 00 00 	lea    0x2f0f(%rip),%rbx        # 4069 <nel::log>
+    115a:	48 8d 35 23 0f 00 00 	lea    0xf23(%rip),%rsi        # 2084 <_IO_stdin_used+0x84>
+    1161:	48 89 df             	mov    %rbx,%rdi
+    1164:	e8 43 0c 00 00       	call   1dac <nel::operator<<(nel::Log&, char const*)>
+    1169:	be 0a 00 00 00       	mov    $0xa,%esi
+    116e:	48 89 c7             	mov    %rax,%rdi
+    1171:	e8 1d 0c 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    1176:	e8 7c 05 00 00       	call   16f7 <ex1()>
+    nel::log << "ex1:e" << '\n';
+    117b:	48 89 df             	mov    %rbx,%rdi
+    117e:	48 8d 35 05 0f 00 00 	lea    0xf05(%rip),%rsi        # 208a <_IO_stdin_used+0x8a>
+    1185:	e8 22 0c 00 00       	call   1dac <nel::operator<<(nel::Log&, char const*)>
+    118a:	be 0a 00 00 00       	mov    $0xa,%esi
+    118f:	48 89 c7             	mov    %rax,%rdi
+    1192:	e8 fc 0b 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex2:b" << '\n';
+    1197:	48 89 df             	mov    %rbx,%rdi
+    119a:	48 8d 35 ef 0e 00 00 	lea    0xeef(%rip),%rsi        # 2090 <_IO_stdin_used+0x90>
+    11a1:	e8 06 0c 00 00       	call   1dac <nel::operator<<(nel::Log&, char const*)>
+    11a6:	be 0a 00 00 00       	mov    $0xa,%esi
+    11ab:	48 89 c7             	mov    %rax,%rdi
+    11ae:	e8 e0 0b 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+    ex2();
+    11b3:	e8 87 05 00 00       	call   173f <ex2()>
+    nel::log << "ex2:e" << '\n';
+    11b8:	48 89 df             	mov    %rbx,%rdi
+    11bb:	48 8d 35 d4 0e 00 00 	lea    0xed4(%rip),%rsi        # 2096 <_IO_stdin_used+0x96>
+    11c2:	e8 e5 0b 00 00       	call   1dac <nel::operator<<(nel::Log&, char const*)>
+    11c7:	be 0a 00 00 00       	mov    $0xa,%esi
+    11cc:	48 89 c7             	mov    %rax,%rdi
+    11cf:	e8 bf 0b 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex3:b" << '\n';
+    11d4:	48 89 df             	mov    %rbx,%rdi
+    11d7:	48 8d 35 be 0e 00 00 	lea    0xebe(%rip),%rsi        # 209c <_IO_stdin_used+0x9c>
+    11de:	e8 c9 0b 00 00       	call   1dac <nel::operator<<(nel::Log&, char const*)>
+    11e3:	be 0a 00 00 00       	mov    $0xa,%esi
+    11e8:	48 89 c7             	mov    %rax,%rdi
+    11eb:	e8 a3 0b 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+    ex3();
+    11f0:	e8 0c 06 00 00       	call   1801 <ex3()>
+    nel::log << "ex3:e" << '\n';
+    11f5:	48 89 df             	mov    %rbx,%rdi
+    11f8:	48 8d 35 a3 0e 00 00 	lea    0xea3(%rip),%rsi        # 20a2 <_IO_stdin_used+0xa2>
+    11ff:	e8 a8 0b 00 00       	call   1dac <nel::operator<<(nel::Log&, char const*)>
+    1204:	be 0a 00 00 00       	mov    $0xa,%esi
+    1209:	48 89 c7             	mov    %rax,%rdi
+    120c:	e8 82 0b 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+#if defined(RUST_LIKE)
+    nel::log << "ex41:b" << '\n';
+    ex41();
+    nel::log << "ex41:e" << '\n';
+#endif
+    nel::log << "ex42:b" << '\n';
+    1211:	48 89 df             	mov    %rbx,%rdi
+    1214:	48 8d 35 8d 0e 00 00 	lea    0xe8d(%rip),%rsi        # 20a8 <_IO_stdin_used+0xa8>
+    121b:	e8 8c 0b 00 00       	call   1dac <nel::operator<<(nel::Log&, char const*)>
+    1220:	be 0a 00 00 00       	mov    $0xa,%esi
+    1225:	48 89 c7             	mov    %rax,%rdi
+    1228:	e8 66 0b 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+    ex42();
+    122d:	e8 8b 01 00 00       	call   13bd <ex42()>
+    nel::log << "ex42:e" << '\n';
+    1232:	48 89 df             	mov    %rbx,%rdi
+    1235:	48 8d 35 73 0e 00 00 	lea    0xe73(%rip),%rsi        # 20af <_IO_stdin_used+0xaf>
+    123c:	e8 6b 0b 00 00       	call   1dac <nel::operator<<(nel::Log&, char const*)>
+    1241:	be 0a 00 00 00       	mov    $0xa,%esi
+    1246:	48 89 c7             	mov    %rax,%rdi
+    1249:	e8 45 0b 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+#if defined(RUST_LIKE)
+    nel::log << "ex51:b" << '\n';
+    ex51();
+    nel::log << "ex51:e" << '\n';
+#endif
+    nel::log << "ex52:b" << '\n';
+    124e:	48 89 df             	mov    %rbx,%rdi
+    1251:	48 8d 35 5e 0e 00 00 	lea    0xe5e(%rip),%rsi        # 20b6 <_IO_stdin_used+0xb6>
+    1258:	e8 4f 0b 00 00       	call   1dac <nel::operator<<(nel::Log&, char const*)>
+    125d:	be 0a 00 00 00       	mov    $0xa,%esi
+    1262:	48 89 c7             	mov    %rax,%rdi
+    1265:	e8 29 0b 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+    ex52();
+    126a:	e8 8a 03 00 00       	call   15f9 <ex52()>
+    nel::log << "ex52:e" << '\n';
+    126f:	48 89 df             	mov    %rbx,%rdi
+    1272:	48 8d 35 44 0e 00 00 	lea    0xe44(%rip),%rsi        # 20bd <_IO_stdin_used+0xbd>
+    1279:	e8 2e 0b 00 00       	call   1dac <nel::operator<<(nel::Log&, char const*)>
+    127e:	be 0a 00 00 00       	mov    $0xa,%esi
+    1283:	48 89 c7             	mov    %rax,%rdi
+    1286:	e8 08 0b 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+}
+    128b:	31 c0                	xor    %eax,%eax
+    128d:	5b                   	pop    %rbx
+    128e:	c3                   	ret
+    128f:	90                   	nop
+
+0000000000001290 <_start>:
+    1290:	31 ed                	xor    %ebp,%ebp
+    1292:	49 89 d1             	mov    %rdx,%r9
+    1295:	5e                   	pop    %rsi
+    1296:	48 89 e2             	mov    %rsp,%rdx
+    1299:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    129d:	50                   	push   %rax
+    129e:	54                   	push   %rsp
+    129f:	45 31 c0             	xor    %r8d,%r8d
+    12a2:	31 c9                	xor    %ecx,%ecx
+    12a4:	48 8d 3d a7 fe ff ff 	lea    -0x159(%rip),%rdi        # 1152 <main>
+    12ab:	ff 15 0f 2d 00 00    	call   *0x2d0f(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    12b1:	f4                   	hlt
+    12b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12b9:	00 00 00 
+    12bc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000012c0 <deregister_tm_clones>:
+    12c0:	    48 8d 3d 89 2d 00 00 	lea    0x2d89(%rip),%rdi        # 4050 <__TMC_END__>
+    12c7:	    48 8d 05 82 2d 00 00 	lea    0x2d82(%rip),%rax        # 4050 <__TMC_END__>
+    12ce:	    48 39 f8             	cmp    %rdi,%rax
+    12d1:	/-- 74 15                	je     12e8 <deregister_tm_clones+0x28>
+    12d3:	|   48 8b 05 ee 2c 00 00 	mov    0x2cee(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    12da:	|   48 85 c0             	test   %rax,%rax
+    12dd:	+-- 74 09                	je     12e8 <deregister_tm_clones+0x28>
+    12df:	|   ff e0                	jmp    *%rax
+    12e1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    12e8:	\-> c3                   	ret
+    12e9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000012f0 <register_tm_clones>:
+    12f0:	    48 8d 3d 59 2d 00 00 	lea    0x2d59(%rip),%rdi        # 4050 <__TMC_END__>
+    12f7:	    48 8d 35 52 2d 00 00 	lea    0x2d52(%rip),%rsi        # 4050 <__TMC_END__>
+    12fe:	    48 29 fe             	sub    %rdi,%rsi
+    1301:	    48 89 f0             	mov    %rsi,%rax
+    1304:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1308:	    48 c1 f8 03          	sar    $0x3,%rax
+    130c:	    48 01 c6             	add    %rax,%rsi
+    130f:	    48 d1 fe             	sar    %rsi
+    1312:	/-- 74 14                	je     1328 <register_tm_clones+0x38>
+    1314:	|   48 8b 05 bd 2c 00 00 	mov    0x2cbd(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    131b:	|   48 85 c0             	test   %rax,%rax
+    131e:	+-- 74 08                	je     1328 <register_tm_clones+0x38>
+    1320:	|   ff e0                	jmp    *%rax
+    1322:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1328:	\-> c3                   	ret
+    1329:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001330 <__do_global_dtors_aux>:
+    1330:	       f3 0f 1e fa          	endbr64
+    1334:	       80 3d 2d 2d 00 00 00 	cmpb   $0x0,0x2d2d(%rip)        # 4068 <completed.0>
+    133b:	/----- 75 2b                	jne    1368 <__do_global_dtors_aux+0x38>
+    133d:	|      55                   	push   %rbp
+    133e:	|      48 83 3d 9a 2c 00 00 	cmpq   $0x0,0x2c9a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1345:	|      00 
+    1346:	|      48 89 e5             	mov    %rsp,%rbp
+    1349:	|  /-- 74 0c                	je     1357 <__do_global_dtors_aux+0x27>
+    134b:	|  |   48 8b 3d f6 2c 00 00 	mov    0x2cf6(%rip),%rdi        # 4048 <__dso_handle>
+    1352:	|  |   e8 59 fd ff ff       	call   10b0 <__cxa_finalize@plt>
+    1357:	|  \-> e8 64 ff ff ff       	call   12c0 <deregister_tm_clones>
+    135c:	|      c6 05 05 2d 00 00 01 	movb   $0x1,0x2d05(%rip)        # 4068 <completed.0>
+    1363:	|      5d                   	pop    %rbp
+    1364:	|      c3                   	ret
+    1365:	|      0f 1f 00             	nopl   (%rax)
+    1368:	\----> c3                   	ret
+    1369:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001370 <frame_dummy>:
+    1370:	f3 0f 1e fa          	endbr64
+    1374:	e9 77 ff ff ff       	jmp    12f0 <register_tm_clones>
+    1379:	90                   	nop
+
+000000000000137a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>:
+    137a:	          52                   	push   %rdx
+    137b:	          85 ff                	test   %edi,%edi
+    137d:	   /----- 74 10                	je     138f <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]+0x15>
+    137f:	   |      ff cf                	dec    %edi
+    1381:	   |      83 ff 01             	cmp    $0x1,%edi
+    1384:	/--|----- 76 15                	jbe    139b <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]+0x21>
+    1386:	|  |      48 8d 3d 86 0c 00 00 	lea    0xc86(%rip),%rdi        # 2013 <_IO_stdin_used+0x13>
+    138d:	|  |  /-- eb 07                	jmp    1396 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]+0x1c>
+    138f:	|  \--|-> 48 8d 3d 6e 0c 00 00 	lea    0xc6e(%rip),%rdi        # 2004 <_IO_stdin_used+0x4>
+    1396:	|     \-> e8 57 fd ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+    139b:	\-------> 58                   	pop    %rax
+    139c:	          c3                   	ret
+
+000000000000139d <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    139d:	83 c8 ff             	or     $0xffffffff,%eax
+    13a0:	c3                   	ret
+
+00000000000013a1 <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    13a1:	83 c8 ff             	or     $0xffffffff,%eax
+    13a4:	c3                   	ret
+
+00000000000013a5 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    13a5:	83 c8 ff             	or     $0xffffffff,%eax
+    13a8:	c3                   	ret
+
+00000000000013a9 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    13a9:	83 c8 ff             	or     $0xffffffff,%eax
+    13ac:	c3                   	ret
+
+00000000000013ad <_read_r>:
+int _read_r(struct _reent *, int) {
+    13ad:	83 c8 ff             	or     $0xffffffff,%eax
+    13b0:	c3                   	ret
+
+00000000000013b1 <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    13b1:	83 c8 ff             	or     $0xffffffff,%eax
+    13b4:	c3                   	ret
+
+00000000000013b5 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    13b5:	83 c8 ff             	or     $0xffffffff,%eax
+    13b8:	c3                   	ret
+
+00000000000013b9 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    13b9:	83 c8 ff             	or     $0xffffffff,%eax
+    13bc:	c3                   	ret
+
+00000000000013bd <ex42()>:
+{
+    13bd:	          41 57                	push   %r15
+    Vec1 vec1 = Vec1::empty();
+    13bf:	          31 c0                	xor    %eax,%eax
+    13c1:	          b9 82 02 00 00       	mov    $0x282,%ecx
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+        {
+            nel::elem::set(data_, f, N);
+    13c6:	          ba 00 01 00 00       	mov    $0x100,%edx
+{
+    13cb:	          41 56                	push   %r14
+    13cd:	          be 67 00 00 00       	mov    $0x67,%esi
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    13d2:	          4c 8d 3d 45 0c 00 00 	lea    0xc45(%rip),%r15        # 201e <_IO_stdin_used+0x1e>
+            , file_name_(file_name)
+    13d9:	          4c 8d 35 43 0c 00 00 	lea    0xc43(%rip),%r14        # 2023 <_IO_stdin_used+0x23>
+    13e0:	          41 55                	push   %r13
+    13e2:	          41 54                	push   %r12
+    13e4:	          55                   	push   %rbp
+    13e5:	          53                   	push   %rbx
+    13e6:	          48 81 ec 38 0c 00 00 	sub    $0xc38,%rsp
+    13ed:	          48 8d 5c 24 20       	lea    0x20(%rsp),%rbx
+    Vec1 vec1 = Vec1::empty();
+    13f2:	          48 8d bc 24 28 02 00 	lea    0x228(%rsp),%rdi
+    13f9:	          00 
+    13fa:	          f3 ab                	rep stos %eax,%es:(%rdi)
+    vec1.push((uint8_t)0x67).is_ok();
+    13fc:	          48 8d ac 24 20 01 00 	lea    0x120(%rsp),%rbp
+    1403:	          00 
+    1404:	          48 89 df             	mov    %rbx,%rdi
+    1407:	          4c 8d a4 24 28 02 00 	lea    0x228(%rsp),%r12
+    140e:	          00 
+    140f:	          e8 00 07 00 00       	call   1b14 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1414:	          48 89 da             	mov    %rbx,%rdx
+    1417:	          4c 89 e6             	mov    %r12,%rsi
+    141a:	          48 89 ef             	mov    %rbp,%rdi
+    141d:	          e8 02 05 00 00       	call   1924 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::push(U8Buf<256ul>&&)>
+    1422:	          4c 8d 6c 24 08       	lea    0x8(%rsp),%r13
+            : fn_name_(fn_name)
+    1427:	          4c 89 7c 24 08       	mov    %r15,0x8(%rsp)
+    142c:	          8b bc 24 20 01 00 00 	mov    0x120(%rsp),%edi
+    1433:	          4c 89 ee             	mov    %r13,%rsi
+            , file_name_(file_name)
+    1436:	          4c 89 74 24 10       	mov    %r14,0x10(%rsp)
+            , line_num_(line_num)
+    143b:	          c7 44 24 18 48 00 00 	movl   $0x48,0x18(%rsp)
+    1442:	          00 
+    1443:	          e8 32 ff ff ff       	call   137a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>
+    1448:	          48 89 ef             	mov    %rbp,%rdi
+    144b:	          e8 24 05 00 00       	call   1974 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    1450:	          48 89 df             	mov    %rbx,%rdi
+    1453:	          e8 86 04 00 00       	call   18de <U8Buf<256ul>::~U8Buf()>
+    1458:	          ba 00 01 00 00       	mov    $0x100,%edx
+    145d:	          be 68 00 00 00       	mov    $0x68,%esi
+    1462:	          48 89 df             	mov    %rbx,%rdi
+    1465:	          e8 aa 06 00 00       	call   1b14 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    vec1.push((uint8_t)0x68).is_ok();
+    146a:	          48 89 da             	mov    %rbx,%rdx
+    146d:	          4c 89 e6             	mov    %r12,%rsi
+    1470:	          48 89 ef             	mov    %rbp,%rdi
+    1473:	          e8 ac 04 00 00       	call   1924 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::push(U8Buf<256ul>&&)>
+    1478:	          8b bc 24 20 01 00 00 	mov    0x120(%rsp),%edi
+    147f:	          4c 89 ee             	mov    %r13,%rsi
+            : fn_name_(fn_name)
+    1482:	          4c 89 7c 24 08       	mov    %r15,0x8(%rsp)
+            , file_name_(file_name)
+    1487:	          4c 89 74 24 10       	mov    %r14,0x10(%rsp)
+            , line_num_(line_num)
+    148c:	          c7 44 24 18 49 00 00 	movl   $0x49,0x18(%rsp)
+    1493:	          00 
+    1494:	          e8 e1 fe ff ff       	call   137a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>
+    1499:	          48 89 ef             	mov    %rbp,%rdi
+    149c:	          e8 d3 04 00 00       	call   1974 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    14a1:	          48 89 df             	mov    %rbx,%rdi
+    14a4:	          e8 35 04 00 00       	call   18de <U8Buf<256ul>::~U8Buf()>
+    14a9:	          ba 00 01 00 00       	mov    $0x100,%edx
+    14ae:	          be 69 00 00 00       	mov    $0x69,%esi
+    14b3:	          48 89 df             	mov    %rbx,%rdi
+    14b6:	          e8 59 06 00 00       	call   1b14 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    vec1.push((uint8_t)0x69).is_ok();
+    14bb:	          48 89 da             	mov    %rbx,%rdx
+    14be:	          4c 89 e6             	mov    %r12,%rsi
+    14c1:	          48 89 ef             	mov    %rbp,%rdi
+    14c4:	          e8 5b 04 00 00       	call   1924 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::push(U8Buf<256ul>&&)>
+    14c9:	          8b bc 24 20 01 00 00 	mov    0x120(%rsp),%edi
+    14d0:	          4c 89 ee             	mov    %r13,%rsi
+            : fn_name_(fn_name)
+    14d3:	          4c 89 7c 24 08       	mov    %r15,0x8(%rsp)
+            , file_name_(file_name)
+    14d8:	          4c 89 74 24 10       	mov    %r14,0x10(%rsp)
+            , line_num_(line_num)
+    14dd:	          c7 44 24 18 4a 00 00 	movl   $0x4a,0x18(%rsp)
+    14e4:	          00 
+    14e5:	          e8 90 fe ff ff       	call   137a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>
+    14ea:	          48 89 ef             	mov    %rbp,%rdi
+    14ed:	          e8 82 04 00 00       	call   1974 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    14f2:	          48 89 df             	mov    %rbx,%rdi
+    14f5:	          e8 e4 03 00 00       	call   18de <U8Buf<256ul>::~U8Buf()>
+         *
+         * @returns the current in use count.
+         */
+        constexpr Length len(void) const
+        {
+            return len_;
+    14fa:	          48 8b 84 24 28 02 00 	mov    0x228(%rsp),%rax
+    1501:	          00 
+         * @returns on success: Optional::Some holding the value
+         * @returns on fail: Optional::None
+         */
+        Optional<Type> pop(void)
+        {
+            if (len() == 0) { return None; }
+    1502:	          48 85 c0             	test   %rax,%rax
+    1505:	/-------- 0f 84 87 00 00 00    	je     1592 <ex42()+0x1d5>
+            len_ -= 1;
+    150b:	|         48 ff c8             	dec    %rax
+            nel::elem::move(data_, o.data_, N);
+    150e:	|         ba 00 01 00 00       	mov    $0x100,%edx
+    1513:	|         4c 8d ac 24 24 01 00 	lea    0x124(%rsp),%r13
+    151a:	|         00 
+            return *this;
+        }
+
+    private:
+        constexpr Optional(Phantom<Tag::SOME> const, T &&v)
+            : tag_(Tag::SOME)
+    151b:	|         c7 84 24 20 01 00 00 	movl   $0x2,0x120(%rsp)
+    1522:	|         02 00 00 00 
+    1526:	|         48 89 84 24 28 02 00 	mov    %rax,0x228(%rsp)
+    152d:	|         00 
+            return &ptr()[d];
+    152e:	|         48 c1 e0 08          	shl    $0x8,%rax
+    1532:	|         4c 89 ef             	mov    %r13,%rdi
+    1535:	|         48 8d b4 04 30 02 00 	lea    0x230(%rsp,%rax,1),%rsi
+    153c:	|         00 
+    153d:	|         e8 da 05 00 00       	call   1b1c <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            switch (tag_) { // optional::dtor
+    1542:	|         8b 84 24 20 01 00 00 	mov    0x120(%rsp),%eax
+    1549:	|         83 f8 01             	cmp    $0x1,%eax
+    154c:	|     /-- 7f 06                	jg     1554 <ex42()+0x197>
+    154e:	|     |   85 c0                	test   %eax,%eax
+    1550:	|  /--|-- 78 11                	js     1563 <ex42()+0x1a6>
+    1552:	+--|--|-- eb 3e                	jmp    1592 <ex42()+0x1d5>
+    1554:	|  |  \-> 83 f8 02             	cmp    $0x2,%eax
+    1557:	|  +----- 75 0a                	jne    1563 <ex42()+0x1a6>
+
+    private:
+        Type value_;
+
+    public:
+        constexpr ~Element(void) = default;
+    1559:	|  |      4c 89 ef             	mov    %r13,%rdi
+    155c:	|  |      e8 7d 03 00 00       	call   18de <U8Buf<256ul>::~U8Buf()>
+    1561:	+--|----- eb 2f                	jmp    1592 <ex42()+0x1d5>
+            : fn_name_(fn_name)
+    1563:	|  \----> 48 8d 05 e2 0a 00 00 	lea    0xae2(%rip),%rax        # 204c <_IO_stdin_used+0x4c>
+                    nel::panic("bad Optional");
+    156a:	|         48 89 de             	mov    %rbx,%rsi
+    156d:	|         48 8d 3d f6 0a 00 00 	lea    0xaf6(%rip),%rdi        # 206a <_IO_stdin_used+0x6a>
+            , line_num_(line_num)
+    1574:	|         c7 44 24 30 87 00 00 	movl   $0x87,0x30(%rsp)
+    157b:	|         00 
+            : fn_name_(fn_name)
+    157c:	|         48 89 44 24 20       	mov    %rax,0x20(%rsp)
+            , file_name_(file_name)
+    1581:	|         48 8d 05 ce 0a 00 00 	lea    0xace(%rip),%rax        # 2056 <_IO_stdin_used+0x56>
+    1588:	|         48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    158d:	|         e8 60 fb ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+    auto it = vec1.iter();
+    1592:	\-------> 48 89 ef             	mov    %rbp,%rdi
+    1595:	          4c 89 e6             	mov    %r12,%rsi
+        nel::log << v << '\n';
+    1598:	          48 8d 2d ca 2a 00 00 	lea    0x2aca(%rip),%rbp        # 4069 <nel::log>
+    auto it = vec1.iter();
+    159f:	          e8 20 03 00 00       	call   18c4 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::iter()>
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return (b_ == e_);
+    15a4:	   /----> 48 8b 9c 24 20 01 00 	mov    0x120(%rsp),%rbx
+    15ab:	   |      00 
+    for (; !it.is_done(); it.inc()) {
+    15ac:	   |      48 39 9c 24 28 01 00 	cmp    %rbx,0x128(%rsp)
+    15b3:	   |      00 
+    15b4:	   |  /-- 74 29                	je     15df <ex42()+0x222>
+        nel::log << v << '\n';
+    15b6:	   |  |   48 89 de             	mov    %rbx,%rsi
+    15b9:	   |  |   48 89 ef             	mov    %rbp,%rdi
+        }
+
+        void inc(void)
+        {
+            ++b_;
+    15bc:	   |  |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    15c3:	   |  |   e8 fb 03 00 00       	call   19c3 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    15c8:	   |  |   be 0a 00 00 00       	mov    $0xa,%esi
+    15cd:	   |  |   48 89 c7             	mov    %rax,%rdi
+    15d0:	   |  |   e8 be 07 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+    15d5:	   |  |   48 89 9c 24 20 01 00 	mov    %rbx,0x120(%rsp)
+    15dc:	   |  |   00 
+        }
+    15dd:	   \--|-- eb c5                	jmp    15a4 <ex42()+0x1e7>
+}
+    15df:	      \-> 4c 89 e7             	mov    %r12,%rdi
+    15e2:	          e8 07 03 00 00       	call   18ee <nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()>
+    15e7:	          48 81 c4 38 0c 00 00 	add    $0xc38,%rsp
+    15ee:	          5b                   	pop    %rbx
+    15ef:	          5d                   	pop    %rbp
+    15f0:	          41 5c                	pop    %r12
+    15f2:	          41 5d                	pop    %r13
+    15f4:	          41 5e                	pop    %r14
+    15f6:	          41 5f                	pop    %r15
+    15f8:	          c3                   	ret
+
+00000000000015f9 <ex52()>:
+{
+    15f9:	       41 56                	push   %r14
+    Vec1 vec1 = Vec1::empty();
+    15fb:	       b9 82 02 00 00       	mov    $0x282,%ecx
+    1600:	       31 c0                	xor    %eax,%eax
+            : fn_name_(fn_name)
+    1602:	       4c 8d 35 6e 0a 00 00 	lea    0xa6e(%rip),%r14        # 2077 <_IO_stdin_used+0x77>
+{
+    1609:	       41 55                	push   %r13
+    160b:	       41 54                	push   %r12
+    160d:	       55                   	push   %rbp
+    160e:	       53                   	push   %rbx
+    Vec1 vec1 = Vec1::empty();
+    160f:	       bb 01 00 00 00       	mov    $0x1,%ebx
+{
+    1614:	       48 81 ec 30 0c 00 00 	sub    $0xc30,%rsp
+    Vec1 vec1 = Vec1::empty();
+    161b:	       48 8d bc 24 28 02 00 	lea    0x228(%rsp),%rdi
+    1622:	       00 
+    1623:	       48 8d ac 24 28 02 00 	lea    0x228(%rsp),%rbp
+    162a:	       00 
+    162b:	       f3 ab                	rep stos %eax,%es:(%rdi)
+            nel::elem::set(data_, f, N);
+    162d:	   /-> 4c 8d 6c 24 20       	lea    0x20(%rsp),%r13
+    1632:	   |   89 de                	mov    %ebx,%esi
+    1634:	   |   ba 00 01 00 00       	mov    $0x100,%edx
+    for (uint8_t f = 1; f < 10; ++f) {
+    1639:	   |   ff c3                	inc    %ebx
+    163b:	   |   4c 89 ef             	mov    %r13,%rdi
+        vec1.push(f).is_ok();
+    163e:	   |   4c 8d a4 24 20 01 00 	lea    0x120(%rsp),%r12
+    1645:	   |   00 
+    1646:	   |   e8 c9 04 00 00       	call   1b14 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    164b:	   |   4c 89 ea             	mov    %r13,%rdx
+    164e:	   |   48 89 ee             	mov    %rbp,%rsi
+    1651:	   |   4c 89 e7             	mov    %r12,%rdi
+    1654:	   |   e8 cb 02 00 00       	call   1924 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::push(U8Buf<256ul>&&)>
+    1659:	   |   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    165e:	   |   4c 89 74 24 08       	mov    %r14,0x8(%rsp)
+    1663:	   |   8b bc 24 20 01 00 00 	mov    0x120(%rsp),%edi
+            , file_name_(file_name)
+    166a:	   |   48 8d 05 b2 09 00 00 	lea    0x9b2(%rip),%rax        # 2023 <_IO_stdin_used+0x23>
+            , line_num_(line_num)
+    1671:	   |   c7 44 24 18 76 00 00 	movl   $0x76,0x18(%rsp)
+    1678:	   |   00 
+            , file_name_(file_name)
+    1679:	   |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    167e:	   |   e8 f7 fc ff ff       	call   137a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>
+    1683:	   |   4c 89 e7             	mov    %r12,%rdi
+    1686:	   |   e8 e9 02 00 00       	call   1974 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    168b:	   |   4c 89 ef             	mov    %r13,%rdi
+    168e:	   |   e8 4b 02 00 00       	call   18de <U8Buf<256ul>::~U8Buf()>
+    for (uint8_t f = 1; f < 10; ++f) {
+    1693:	   |   83 fb 0a             	cmp    $0xa,%ebx
+    1696:	   \-- 75 95                	jne    162d <ex52()+0x34>
+    auto it = vec1.iter().first_n(3);
+    1698:	       4c 89 e7             	mov    %r12,%rdi
+    169b:	       48 89 ee             	mov    %rbp,%rsi
+        nel::log << v << '\n';
+    169e:	       4c 8d 2d c4 29 00 00 	lea    0x29c4(%rip),%r13        # 4069 <nel::log>
+    auto it = vec1.iter().first_n(3);
+    16a5:	       e8 1a 02 00 00       	call   18c4 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::iter()>
+            : b_(move(o.b_))
+    16aa:	       48 8b 9c 24 20 01 00 	mov    0x120(%rsp),%rbx
+    16b1:	       00 
+    for (; !it.is_done(); it.inc()) {
+    16b2:	       4c 8d a3 00 03 00 00 	lea    0x300(%rbx),%r12
+    16b9:	/----> 4c 39 e3             	cmp    %r12,%rbx
+    16bc:	|  /-- 74 21                	je     16df <ex52()+0xe6>
+        nel::log << v << '\n';
+    16be:	|  |   48 89 de             	mov    %rbx,%rsi
+    16c1:	|  |   4c 89 ef             	mov    %r13,%rdi
+            ++b_;
+    16c4:	|  |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    16cb:	|  |   e8 f3 02 00 00       	call   19c3 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    16d0:	|  |   be 0a 00 00 00       	mov    $0xa,%esi
+    16d5:	|  |   48 89 c7             	mov    %rax,%rdi
+    16d8:	|  |   e8 b6 06 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+
+        void inc(void)
+        {
+            inner_.inc();
+            ++current_;
+        }
+    16dd:	\--|-- eb da                	jmp    16b9 <ex52()+0xc0>
+}
+    16df:	   \-> 48 89 ef             	mov    %rbp,%rdi
+    16e2:	       e8 07 02 00 00       	call   18ee <nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()>
+    16e7:	       48 81 c4 30 0c 00 00 	add    $0xc30,%rsp
+    16ee:	       5b                   	pop    %rbx
+    16ef:	       5d                   	pop    %rbp
+    16f0:	       41 5c                	pop    %r12
+    16f2:	       41 5d                	pop    %r13
+    16f4:	       41 5e                	pop    %r14
+    16f6:	       c3                   	ret
+
+00000000000016f7 <ex1()>:
+{
+    16f7:	53                   	push   %rbx
+    Vec1 vec1 = Vec1::empty();
+    16f8:	31 c0                	xor    %eax,%eax
+    16fa:	b9 82 02 00 00       	mov    $0x282,%ecx
+{
+    16ff:	48 81 ec 10 0a 00 00 	sub    $0xa10,%rsp
+    nel::log << vec1 << '\n';
+    1706:	48 8d 5c 24 08       	lea    0x8(%rsp),%rbx
+    Vec1 vec1 = Vec1::empty();
+    170b:	48 8d 7c 24 08       	lea    0x8(%rsp),%rdi
+    1710:	f3 ab                	rep stos %eax,%es:(%rdi)
+    nel::log << vec1 << '\n';
+    1712:	48 89 de             	mov    %rbx,%rsi
+    1715:	48 8d 3d 4d 29 00 00 	lea    0x294d(%rip),%rdi        # 4069 <nel::log>
+    171c:	e8 21 03 00 00       	call   1a42 <nel::heapless::operator<<(nel::Log&, nel::heapless::Vector<U8Buf<256ul>, 10ul> const&)>
+    1721:	be 0a 00 00 00       	mov    $0xa,%esi
+    1726:	48 89 c7             	mov    %rax,%rdi
+    1729:	e8 65 06 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+}
+    172e:	48 89 df             	mov    %rbx,%rdi
+    1731:	e8 b8 01 00 00       	call   18ee <nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()>
+    1736:	48 81 c4 10 0a 00 00 	add    $0xa10,%rsp
+    173d:	5b                   	pop    %rbx
+    173e:	c3                   	ret
+
+000000000000173f <ex2()>:
+{
+    173f:	41 54                	push   %r12
+    Vec1 vec1 = Vec1::empty();
+    1741:	31 c0                	xor    %eax,%eax
+    1743:	b9 82 02 00 00       	mov    $0x282,%ecx
+    1748:	ba 00 01 00 00       	mov    $0x100,%edx
+{
+    174d:	55                   	push   %rbp
+    174e:	be 66 00 00 00       	mov    $0x66,%esi
+    1753:	53                   	push   %rbx
+    1754:	48 81 ec 30 0c 00 00 	sub    $0xc30,%rsp
+    175b:	48 8d 6c 24 24       	lea    0x24(%rsp),%rbp
+    Vec1 vec1 = Vec1::empty();
+    1760:	48 8d bc 24 28 02 00 	lea    0x228(%rsp),%rdi
+    1767:	00 
+    1768:	f3 ab                	rep stos %eax,%es:(%rdi)
+    vec1.push(nel::move(v)).is_ok();
+    176a:	48 8d 9c 24 28 02 00 	lea    0x228(%rsp),%rbx
+    1771:	00 
+    1772:	48 89 ef             	mov    %rbp,%rdi
+    1775:	4c 8d a4 24 24 01 00 	lea    0x124(%rsp),%r12
+    177c:	00 
+    177d:	e8 92 03 00 00       	call   1b14 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1782:	48 89 ea             	mov    %rbp,%rdx
+    1785:	48 89 de             	mov    %rbx,%rsi
+    1788:	4c 89 e7             	mov    %r12,%rdi
+    178b:	e8 94 01 00 00       	call   1924 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::push(U8Buf<256ul>&&)>
+    1790:	8b bc 24 24 01 00 00 	mov    0x124(%rsp),%edi
+            : fn_name_(fn_name)
+    1797:	48 8d 05 de 08 00 00 	lea    0x8de(%rip),%rax        # 207c <_IO_stdin_used+0x7c>
+    179e:	48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    17a3:	48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , file_name_(file_name)
+    17a8:	48 8d 05 74 08 00 00 	lea    0x874(%rip),%rax        # 2023 <_IO_stdin_used+0x23>
+    17af:	48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    17b4:	c7 44 24 18 18 00 00 	movl   $0x18,0x18(%rsp)
+    17bb:	00 
+    17bc:	e8 b9 fb ff ff       	call   137a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>
+    17c1:	4c 89 e7             	mov    %r12,%rdi
+    17c4:	e8 ab 01 00 00       	call   1974 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    nel::log << vec1 << '\n';
+    17c9:	48 89 de             	mov    %rbx,%rsi
+    17cc:	48 8d 3d 96 28 00 00 	lea    0x2896(%rip),%rdi        # 4069 <nel::log>
+    17d3:	e8 6a 02 00 00       	call   1a42 <nel::heapless::operator<<(nel::Log&, nel::heapless::Vector<U8Buf<256ul>, 10ul> const&)>
+    17d8:	be 0a 00 00 00       	mov    $0xa,%esi
+    17dd:	48 89 c7             	mov    %rax,%rdi
+    17e0:	e8 ae 05 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+}
+    17e5:	48 89 ef             	mov    %rbp,%rdi
+    17e8:	e8 f1 00 00 00       	call   18de <U8Buf<256ul>::~U8Buf()>
+    17ed:	48 89 df             	mov    %rbx,%rdi
+    17f0:	e8 f9 00 00 00       	call   18ee <nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()>
+    17f5:	48 81 c4 30 0c 00 00 	add    $0xc30,%rsp
+    17fc:	5b                   	pop    %rbx
+    17fd:	5d                   	pop    %rbp
+    17fe:	41 5c                	pop    %r12
+    1800:	c3                   	ret
+
+0000000000001801 <ex3()>:
+{
+    1801:	41 54                	push   %r12
+    Vec1 vec1 = Vec1::empty();
+    1803:	31 c0                	xor    %eax,%eax
+    1805:	b9 82 02 00 00       	mov    $0x282,%ecx
+    180a:	ba 00 01 00 00       	mov    $0x100,%edx
+{
+    180f:	55                   	push   %rbp
+    1810:	be 67 00 00 00       	mov    $0x67,%esi
+    1815:	53                   	push   %rbx
+    1816:	48 81 ec 30 0c 00 00 	sub    $0xc30,%rsp
+    181d:	48 8d 6c 24 24       	lea    0x24(%rsp),%rbp
+    Vec1 vec1 = Vec1::empty();
+    1822:	48 8d bc 24 28 02 00 	lea    0x228(%rsp),%rdi
+    1829:	00 
+    182a:	f3 ab                	rep stos %eax,%es:(%rdi)
+    vec1.push((uint8_t)0x67).is_ok();
+    182c:	48 8d 9c 24 28 02 00 	lea    0x228(%rsp),%rbx
+    1833:	00 
+    1834:	48 89 ef             	mov    %rbp,%rdi
+    1837:	4c 8d a4 24 24 01 00 	lea    0x124(%rsp),%r12
+    183e:	00 
+    183f:	e8 d0 02 00 00       	call   1b14 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1844:	48 89 ea             	mov    %rbp,%rdx
+    1847:	48 89 de             	mov    %rbx,%rsi
+    184a:	4c 89 e7             	mov    %r12,%rdi
+    184d:	e8 d2 00 00 00       	call   1924 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::push(U8Buf<256ul>&&)>
+    1852:	8b bc 24 24 01 00 00 	mov    0x124(%rsp),%edi
+            : fn_name_(fn_name)
+    1859:	48 8d 05 20 08 00 00 	lea    0x820(%rip),%rax        # 2080 <_IO_stdin_used+0x80>
+    1860:	48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    1865:	48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , file_name_(file_name)
+    186a:	48 8d 05 b2 07 00 00 	lea    0x7b2(%rip),%rax        # 2023 <_IO_stdin_used+0x23>
+    1871:	48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1876:	c7 44 24 18 21 00 00 	movl   $0x21,0x18(%rsp)
+    187d:	00 
+    187e:	e8 f7 fa ff ff       	call   137a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>
+    1883:	4c 89 e7             	mov    %r12,%rdi
+    1886:	e8 e9 00 00 00       	call   1974 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    188b:	48 89 ef             	mov    %rbp,%rdi
+    188e:	e8 4b 00 00 00       	call   18de <U8Buf<256ul>::~U8Buf()>
+    nel::log << vec1 << '\n';
+    1893:	48 89 de             	mov    %rbx,%rsi
+    1896:	48 8d 3d cc 27 00 00 	lea    0x27cc(%rip),%rdi        # 4069 <nel::log>
+    189d:	e8 a0 01 00 00       	call   1a42 <nel::heapless::operator<<(nel::Log&, nel::heapless::Vector<U8Buf<256ul>, 10ul> const&)>
+    18a2:	be 0a 00 00 00       	mov    $0xa,%esi
+    18a7:	48 89 c7             	mov    %rax,%rdi
+    18aa:	e8 e4 04 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+}
+    18af:	48 89 df             	mov    %rbx,%rdi
+    18b2:	e8 37 00 00 00       	call   18ee <nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()>
+    18b7:	48 81 c4 30 0c 00 00 	add    $0xc30,%rsp
+    18be:	5b                   	pop    %rbx
+    18bf:	5d                   	pop    %rbp
+    18c0:	41 5c                	pop    %r12
+    18c2:	c3                   	ret
+    18c3:	90                   	nop
+
+00000000000018c4 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::iter()>:
+            return len_;
+    18c4:	48 8b 16             	mov    (%rsi),%rdx
+    public:
+        // only if you know there's a value there..
+        // TODO: must have no bare pointers.. safety feature.
+        constexpr Type *ptr()
+        {
+            return &u_.elem_;
+    18c7:	48 83 c6 08          	add    $0x8,%rsi
+         *
+         * iterator is invalidated if array goes out of scope/destroyed.
+         *
+         * @returns The iterator.
+         */
+        constexpr auto iter(void)
+    18cb:	48 89 f8             	mov    %rdi,%rax
+            : b_(arr)
+    18ce:	48 89 37             	mov    %rsi,(%rdi)
+            , e_(arr + len)
+    18d1:	48 c1 e2 08          	shl    $0x8,%rdx
+    18d5:	48 01 d6             	add    %rdx,%rsi
+    18d8:	48 89 77 08          	mov    %rsi,0x8(%rdi)
+        {
+            return slice().iter();
+        }
+    18dc:	c3                   	ret
+    18dd:	90                   	nop
+
+00000000000018de <U8Buf<256ul>::~U8Buf()>:
+            nel::elem::set(data_, 0xa5, N);
+    18de:	ba 00 01 00 00       	mov    $0x100,%edx
+    18e3:	be a5 00 00 00       	mov    $0xa5,%esi
+    18e8:	e9 27 02 00 00       	jmp    1b14 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    18ed:	90                   	nop
+
+00000000000018ee <nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()>:
+        constexpr ~Vector(void)
+    18ee:	       53                   	push   %rbx
+    18ef:	       48 89 fe             	mov    %rdi,%rsi
+    18f2:	       48 83 ec 10          	sub    $0x10,%rsp
+            iter().for_each([&](auto &v) -> void { v.~Type(); });
+    18f6:	       48 89 e7             	mov    %rsp,%rdi
+    18f9:	       e8 c6 ff ff ff       	call   18c4 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::iter()>
+            return (b_ == e_);
+    18fe:	/----> 48 8b 1c 24          	mov    (%rsp),%rbx
+            for (; !self().is_done(); self().inc()) {
+    1902:	|      48 3b 5c 24 08       	cmp    0x8(%rsp),%rbx
+    1907:	|  /-- 74 15                	je     191e <nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()+0x30>
+    1909:	|  |   48 89 df             	mov    %rbx,%rdi
+            ++b_;
+    190c:	|  |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    1913:	|  |   e8 c6 ff ff ff       	call   18de <U8Buf<256ul>::~U8Buf()>
+    1918:	|  |   48 89 1c 24          	mov    %rbx,(%rsp)
+        }
+    191c:	\--|-- eb e0                	jmp    18fe <nel::heapless::Vector<U8Buf<256ul>, 10ul>::~Vector()+0x10>
+        }
+    191e:	   \-> 48 83 c4 10          	add    $0x10,%rsp
+    1922:	       5b                   	pop    %rbx
+    1923:	       c3                   	ret
+
+0000000000001924 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::push(U8Buf<256ul>&&)>:
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+    1924:	       55                   	push   %rbp
+    1925:	       48 89 f5             	mov    %rsi,%rbp
+    1928:	       48 89 d6             	mov    %rdx,%rsi
+    192b:	       53                   	push   %rbx
+    192c:	       48 89 fb             	mov    %rdi,%rbx
+    192f:	       51                   	push   %rcx
+            return len_;
+    1930:	       48 8b 45 00          	mov    0x0(%rbp),%rax
+            if (len() >= capacity()) {
+    1934:	       48 83 f8 09          	cmp    $0x9,%rax
+    1938:	   /-- 76 16                	jbe    1950 <nel::heapless::Vector<U8Buf<256ul>, 10ul>::push(U8Buf<256ul>&&)+0x2c>
+            : tag_(Tag::OK)
+        {
+        }
+
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+            : tag_(Tag::ERR)
+    193a:	   |   c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+            nel::elem::move(data_, o.data_, N);
+    1940:	   |   ba 00 01 00 00       	mov    $0x100,%edx
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+            : value_(forward<Type>(val))
+    1945:	   |   48 8d 7f 04          	lea    0x4(%rdi),%rdi
+    1949:	   |   e8 ce 01 00 00       	call   1b1c <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+        }
+    194e:	/--|-- eb 1d                	jmp    196d <nel::heapless::Vector<U8Buf<256ul>, 10ul>::push(U8Buf<256ul>&&)+0x49>
+            return &ptr()[d];
+    1950:	|  \-> 48 c1 e0 08          	shl    $0x8,%rax
+            nel::elem::move(data_, o.data_, N);
+    1954:	|      ba 00 01 00 00       	mov    $0x100,%edx
+    1959:	|      48 8d 7c 05 08       	lea    0x8(%rbp,%rax,1),%rdi
+    195e:	|      e8 b9 01 00 00       	call   1b1c <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            len_ += 1;
+    1963:	|      48 ff 45 00          	incq   0x0(%rbp)
+            : tag_(Tag::OK)
+    1967:	|      c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+        }
+    196d:	\----> 48 89 d8             	mov    %rbx,%rax
+    1970:	       5a                   	pop    %rdx
+    1971:	       5b                   	pop    %rbx
+    1972:	       5d                   	pop    %rbp
+    1973:	       c3                   	ret
+
+0000000000001974 <nel::Result<void, U8Buf<256ul> >::~Result()>:
+    1974:	       8b 07                	mov    (%rdi),%eax
+    1976:	       83 f8 01             	cmp    $0x1,%eax
+    1979:	   /-- 7f 05                	jg     1980 <nel::Result<void, U8Buf<256ul> >::~Result()+0xc>
+    197b:	   |   85 c0                	test   %eax,%eax
+    197d:	/--|-- 78 0f                	js     198e <nel::Result<void, U8Buf<256ul> >::~Result()+0x1a>
+    197f:	|  |   c3                   	ret
+    1980:	|  \-> 83 f8 02             	cmp    $0x2,%eax
+    1983:	+----- 75 09                	jne    198e <nel::Result<void, U8Buf<256ul> >::~Result()+0x1a>
+        constexpr ~Element(void) = default;
+    1985:	|      48 83 c7 04          	add    $0x4,%rdi
+    1989:	|      e9 50 ff ff ff       	jmp    18de <U8Buf<256ul>::~U8Buf()>
+        constexpr ~Result(void)
+    198e:	\----> 48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    1992:	       48 8d 05 2b 07 00 00 	lea    0x72b(%rip),%rax        # 20c4 <_IO_stdin_used+0xc4>
+                    nel::panic("bad Result");
+    1999:	       48 8d 3d 73 06 00 00 	lea    0x673(%rip),%rdi        # 2013 <_IO_stdin_used+0x13>
+    19a0:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    19a5:	       48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    19aa:	       48 8d 05 1b 07 00 00 	lea    0x71b(%rip),%rax        # 20cc <_IO_stdin_used+0xcc>
+    19b1:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    19b6:	       c7 44 24 18 dd 02 00 	movl   $0x2dd,0x18(%rsp)
+    19bd:	       00 
+    19be:	       e8 2f f7 ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+
+00000000000019c3 <operator<<(nel::Log&, U8Buf<256ul> const&)>:
+        void fill(uint8_t f)
+        {
+            nel::elem::set(data_, f, N);
+        }
+
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+    19c3:	    41 54                	push   %r12
+    19c5:	    49 89 f4             	mov    %rsi,%r12
+        {
+            outs << "U8Buf<" << val.len() << ">{";
+    19c8:	    48 8d 35 0f 07 00 00 	lea    0x70f(%rip),%rsi        # 20de <_IO_stdin_used+0xde>
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+    19cf:	    55                   	push   %rbp
+            if (val.len() > 0) {
+                outs << val.data_[0];
+                for (Index i = 1; i < val.len(); ++i) {
+    19d0:	    bd 01 00 00 00       	mov    $0x1,%ebp
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+    19d5:	    53                   	push   %rbx
+    19d6:	    48 89 fb             	mov    %rdi,%rbx
+            outs << "U8Buf<" << val.len() << ">{";
+    19d9:	    e8 ce 03 00 00       	call   1dac <nel::operator<<(nel::Log&, char const*)>
+    19de:	    be 00 01 00 00       	mov    $0x100,%esi
+    19e3:	    48 89 c7             	mov    %rax,%rdi
+    19e6:	    e8 5c 04 00 00       	call   1e47 <nel::operator<<(nel::Log&, unsigned long)>
+    19eb:	    48 8d 35 f3 06 00 00 	lea    0x6f3(%rip),%rsi        # 20e5 <_IO_stdin_used+0xe5>
+    19f2:	    48 89 c7             	mov    %rax,%rdi
+    19f5:	    e8 b2 03 00 00       	call   1dac <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    19fa:	    41 0f b6 34 24       	movzbl (%r12),%esi
+    19ff:	    48 89 df             	mov    %rbx,%rdi
+    1a02:	    e8 bd 03 00 00       	call   1dc4 <nel::operator<<(nel::Log&, unsigned char)>
+                    outs << ' ' << val.data_[i];
+    1a07:	/-> be 20 00 00 00       	mov    $0x20,%esi
+    1a0c:	|   48 89 df             	mov    %rbx,%rdi
+    1a0f:	|   e8 7f 03 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+    1a14:	|   41 0f b6 34 2c       	movzbl (%r12,%rbp,1),%esi
+                for (Index i = 1; i < val.len(); ++i) {
+    1a19:	|   48 ff c5             	inc    %rbp
+                    outs << ' ' << val.data_[i];
+    1a1c:	|   48 89 c7             	mov    %rax,%rdi
+    1a1f:	|   e8 a0 03 00 00       	call   1dc4 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1a24:	|   48 81 fd 00 01 00 00 	cmp    $0x100,%rbp
+    1a2b:	\-- 75 da                	jne    1a07 <operator<<(nel::Log&, U8Buf<256ul> const&)+0x44>
+                }
+            }
+            outs << '}';
+    1a2d:	    48 89 df             	mov    %rbx,%rdi
+    1a30:	    be 7d 00 00 00       	mov    $0x7d,%esi
+    1a35:	    e8 59 03 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+            return outs;
+        }
+    1a3a:	    48 89 d8             	mov    %rbx,%rax
+    1a3d:	    5b                   	pop    %rbx
+    1a3e:	    5d                   	pop    %rbp
+    1a3f:	    41 5c                	pop    %r12
+    1a41:	    c3                   	ret
+
+0000000000001a42 <nel::heapless::operator<<(nel::Log&, nel::heapless::Vector<U8Buf<256ul>, 10ul> const&)>:
+         * @param outs the stream to dump the representation into.
+         */
+        // TODO: replace <<(Log ) with dbgfmt, so separate out from
+        // any other form of conversion to charstring.
+        // TODO: insert into formatter and not final dest type.
+        friend Log &operator<<(Log &outs, Vector const &v)
+    1a42:	       41 55                	push   %r13
+    1a44:	       41 54                	push   %r12
+    1a46:	       55                   	push   %rbp
+    1a47:	       48 89 fd             	mov    %rdi,%rbp
+    1a4a:	       53                   	push   %rbx
+    1a4b:	       48 89 f3             	mov    %rsi,%rbx
+        {
+            outs << "Vector<" << N << ">(" << v.len() << "){";
+    1a4e:	       48 8d 35 93 06 00 00 	lea    0x693(%rip),%rsi        # 20e8 <_IO_stdin_used+0xe8>
+        friend Log &operator<<(Log &outs, Vector const &v)
+    1a55:	       51                   	push   %rcx
+        }
+
+        constexpr Type const *ptr() const
+        {
+            return &u_.elem_;
+    1a56:	       4c 8d 6b 08          	lea    0x8(%rbx),%r13
+            outs << "Vector<" << N << ">(" << v.len() << "){";
+    1a5a:	       e8 4d 03 00 00       	call   1dac <nel::operator<<(nel::Log&, char const*)>
+    1a5f:	       be 0a 00 00 00       	mov    $0xa,%esi
+    1a64:	       48 89 c7             	mov    %rax,%rdi
+    1a67:	       e8 db 03 00 00       	call   1e47 <nel::operator<<(nel::Log&, unsigned long)>
+    1a6c:	       48 8d 35 7d 06 00 00 	lea    0x67d(%rip),%rsi        # 20f0 <_IO_stdin_used+0xf0>
+    1a73:	       48 89 c7             	mov    %rax,%rdi
+    1a76:	       e8 31 03 00 00       	call   1dac <nel::operator<<(nel::Log&, char const*)>
+    1a7b:	       48 8b 33             	mov    (%rbx),%rsi
+    1a7e:	       48 89 c7             	mov    %rax,%rdi
+    1a81:	       e8 c1 03 00 00       	call   1e47 <nel::operator<<(nel::Log&, unsigned long)>
+    1a86:	       48 8d 35 66 06 00 00 	lea    0x666(%rip),%rsi        # 20f3 <_IO_stdin_used+0xf3>
+    1a8d:	       48 89 c7             	mov    %rax,%rdi
+    1a90:	       e8 17 03 00 00       	call   1dac <nel::operator<<(nel::Log&, char const*)>
+            , e_(arr + len)
+    1a95:	       4c 8b 23             	mov    (%rbx),%r12
+            outs << '[';
+    1a98:	       be 5b 00 00 00       	mov    $0x5b,%esi
+    1a9d:	       48 89 ef             	mov    %rbp,%rdi
+    1aa0:	       49 c1 e4 08          	shl    $0x8,%r12
+    1aa4:	       4d 01 ec             	add    %r13,%r12
+    1aa7:	       e8 e7 02 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+            if (!it2.is_done()) {
+    1aac:	       4d 39 e5             	cmp    %r12,%r13
+    1aaf:	/----- 74 38                	je     1ae9 <nel::heapless::operator<<(nel::Log&, nel::heapless::Vector<U8Buf<256ul>, 10ul> const&)+0xa7>
+                outs << it2.deref();
+    1ab1:	|      4c 89 ee             	mov    %r13,%rsi
+    1ab4:	|      48 89 ef             	mov    %rbp,%rdi
+            ++b_;
+    1ab7:	|      48 81 c3 08 01 00 00 	add    $0x108,%rbx
+    1abe:	|      e8 00 ff ff ff       	call   19c3 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+            for (; !self().is_done(); self().inc()) {
+    1ac3:	|  /-> 4c 39 e3             	cmp    %r12,%rbx
+    1ac6:	+--|-- 74 21                	je     1ae9 <nel::heapless::operator<<(nel::Log&, nel::heapless::Vector<U8Buf<256ul>, 10ul> const&)+0xa7>
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    1ac8:	|  |   be 2c 00 00 00       	mov    $0x2c,%esi
+    1acd:	|  |   48 89 ef             	mov    %rbp,%rdi
+    1ad0:	|  |   e8 be 02 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+    1ad5:	|  |   48 89 de             	mov    %rbx,%rsi
+    1ad8:	|  |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    1adf:	|  |   48 89 c7             	mov    %rax,%rdi
+    1ae2:	|  |   e8 dc fe ff ff       	call   19c3 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+        }
+    1ae7:	|  \-- eb da                	jmp    1ac3 <nel::heapless::operator<<(nel::Log&, nel::heapless::Vector<U8Buf<256ul>, 10ul> const&)+0x81>
+            outs << ']';
+    1ae9:	\----> 48 89 ef             	mov    %rbp,%rdi
+    1aec:	       be 5d 00 00 00       	mov    $0x5d,%esi
+    1af1:	       e8 9d 02 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+            outs << v.iter();
+            outs << '}';
+    1af6:	       48 89 ef             	mov    %rbp,%rdi
+    1af9:	       be 7d 00 00 00       	mov    $0x7d,%esi
+    1afe:	       e8 90 02 00 00       	call   1d93 <nel::operator<<(nel::Log&, char)>
+            return outs;
+        }
+    1b03:	       5a                   	pop    %rdx
+    1b04:	       48 89 e8             	mov    %rbp,%rax
+    1b07:	       5b                   	pop    %rbx
+    1b08:	       5d                   	pop    %rbp
+    1b09:	       41 5c                	pop    %r12
+    1b0b:	       41 5d                	pop    %r13
+    1b0d:	       c3                   	ret
+
+0000000000001b0e <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1b0e:	48 89 d1             	mov    %rdx,%rcx
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    1b11:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1b13:	c3                   	ret
+
+0000000000001b14 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    1b14:	48 89 d1             	mov    %rdx,%rcx
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    1b17:	89 f0                	mov    %esi,%eax
+    1b19:	f3 aa                	rep stos %al,%es:(%rdi)
+}
+    1b1b:	c3                   	ret
+
+0000000000001b1c <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    1b1c:	48 89 d1             	mov    %rdx,%rcx
+    1b1f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    1b21:	c3                   	ret
+
+0000000000001b22 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    1b22:	e9 79 f5 ff ff       	jmp    10a0 <memmove@plt>
+
+0000000000001b27 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    1b27:	48 89 f1             	mov    %rsi,%rcx
+    std::memset(d, s, n);
+    1b2a:	b0 a5                	mov    $0xa5,%al
+    1b2c:	f3 aa                	rep stos %al,%es:(%rdi)
+    set(d, 0xa5, n);
+}
+    1b2e:	c3                   	ret
+
+0000000000001b2f <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1b2f:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    1b30:	e8 3b f5 ff ff       	call   1070 <memcmp@plt>
+}
+    1b35:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) == 0;
+    1b36:	85 c0                	test   %eax,%eax
+    1b38:	0f 94 c0             	sete   %al
+}
+    1b3b:	c3                   	ret
+
+0000000000001b3c <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1b3c:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    1b3d:	e8 2e f5 ff ff       	call   1070 <memcmp@plt>
+}
+    1b42:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) != 0;
+    1b43:	85 c0                	test   %eax,%eax
+    1b45:	0f 95 c0             	setne  %al
+}
+    1b48:	c3                   	ret
+
+0000000000001b49 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+{
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1b49:	          49 89 fa             	mov    %rdi,%r10
+    1b4c:	          48 89 f0             	mov    %rsi,%rax
+    if (n < streaming_min) {
+    1b4f:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1b56:	      /-- 77 05                	ja     1b5d <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14>
+    std::memcpy(d, s, n);
+    1b58:	      |   48 89 d1             	mov    %rdx,%rcx
+    1b5b:	/-----|-- eb 79                	jmp    1bd6 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x8d>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1b5d:	|     \-> 48 89 f9             	mov    %rdi,%rcx
+    1b60:	|         48 f7 d9             	neg    %rcx
+    1b63:	|         83 e1 0f             	and    $0xf,%ecx
+    1b66:	|         49 89 c8             	mov    %rcx,%r8
+    std::memcpy(d, s, n);
+    1b69:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1b6b:	|         49 8d 70 40          	lea    0x40(%r8),%rsi
+    1b6f:	|         48 89 f9             	mov    %rdi,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1b72:	|     /-> 0f 10 54 30 d0       	movups -0x30(%rax,%rsi,1),%xmm2
+    1b77:	|     |   0f 10 4c 30 e0       	movups -0x20(%rax,%rsi,1),%xmm1
+    1b7c:	|     |   49 89 f0             	mov    %rsi,%r8
+    for (; i + 64 <= n; i += 64) {
+    1b7f:	|     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1b83:	|     |   0f 10 44 30 f0       	movups -0x10(%rax,%rsi,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1b88:	|     |   0f 10 5c 30 c0       	movups -0x40(%rax,%rsi,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    1b8d:	|     |   48 83 c6 40          	add    $0x40,%rsi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1b91:	|     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    1b96:	|     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    1b9b:	|     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    1ba0:	|     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    1ba5:	|     |   48 39 f2             	cmp    %rsi,%rdx
+    1ba8:	|     \-- 73 c8                	jae    1b72 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x29>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    1baa:	|  /----> 49 8d 48 10          	lea    0x10(%r8),%rcx
+        stream16(d + i, load16(s + i));
+    1bae:	|  |      4f 8d 0c 02          	lea    (%r10,%r8,1),%r9
+    for (; i + 16 <= n; i += 16) {
+    1bb2:	|  |      48 39 ca             	cmp    %rcx,%rdx
+    1bb5:	|  |  /-- 72 0f                	jb     1bc6 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x7d>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1bb7:	|  |  |   0f 10 64 08 f0       	movups -0x10(%rax,%rcx,1),%xmm4
+    1bbc:	|  |  |   49 89 c8             	mov    %rcx,%r8
+    1bbf:	|  |  |   66 41 0f e7 21       	movntdq %xmm4,(%r9)
+    for (; i + 16 <= n; i += 16) {
+    1bc4:	|  \--|-- eb e4                	jmp    1baa <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x61>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    1bc6:	|     \-> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    1bc9:	|         4c 29 c2             	sub    %r8,%rdx
+        stream16(d + i, load16(s + i));
+    1bcc:	|         4a 8d 34 00          	lea    (%rax,%r8,1),%rsi
+    std::memcpy(d, s, n);
+    1bd0:	|         4c 89 cf             	mov    %r9,%rdi
+    copy(d + i, s + i, n - i);
+    1bd3:	|         48 89 d1             	mov    %rdx,%rcx
+    std::memcpy(d, s, n);
+    1bd6:	\-------> f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1bd8:	          c3                   	ret
+
+0000000000001bd9 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    1bd9:	          49 89 f8             	mov    %rdi,%r8
+    if (n < streaming_min) {
+    1bdc:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1be3:	/-------- 77 37                	ja     1c1c <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x43>
+    Length done = (n < 16) ? n : 16;
+    1be5:	|         b8 10 00 00 00       	mov    $0x10,%eax
+    1bea:	|         48 39 c2             	cmp    %rax,%rdx
+    1bed:	|         48 0f 46 c2          	cmovbe %rdx,%rax
+    std::memcpy(d, s, n);
+    1bf1:	|         89 c1                	mov    %eax,%ecx
+    1bf3:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    1bf5:	|  /----> 48 39 d0             	cmp    %rdx,%rax
+    1bf8:	|  |  /-- 73 21                	jae    1c1b <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42>
+        Length const m = (done < n - done) ? done : n - done;
+    1bfa:	|  |  |   49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    1bfd:	|  |  |   4d 8d 14 00          	lea    (%r8,%rax,1),%r10
+    std::memcpy(d, s, n);
+    1c01:	|  |  |   4c 89 c6             	mov    %r8,%rsi
+        Length const m = (done < n - done) ? done : n - done;
+    1c04:	|  |  |   49 29 c1             	sub    %rax,%r9
+    std::memcpy(d, s, n);
+    1c07:	|  |  |   4c 89 d7             	mov    %r10,%rdi
+        Length const m = (done < n - done) ? done : n - done;
+    1c0a:	|  |  |   49 39 c1             	cmp    %rax,%r9
+    1c0d:	|  |  |   4c 0f 47 c8          	cmova  %rax,%r9
+    std::memcpy(d, s, n);
+    1c11:	|  |  |   44 89 c9             	mov    %r9d,%ecx
+        done += m;
+    1c14:	|  |  |   4c 01 c8             	add    %r9,%rax
+    std::memcpy(d, s, n);
+    1c17:	|  |  |   f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+        done += m;
+    1c19:	|  \--|-- eb da                	jmp    1bf5 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c>
+    1c1b:	|     \-> c3                   	ret
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1c1c:	\-------> 48 89 f8             	mov    %rdi,%rax
+    for (Index i = 0; i < head; ++i) {
+    1c1f:	          31 c9                	xor    %ecx,%ecx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1c21:	          48 f7 d8             	neg    %rax
+    1c24:	          83 e0 0f             	and    $0xf,%eax
+    for (Index i = 0; i < head; ++i) {
+    1c27:	   /----> 48 39 c1             	cmp    %rax,%rcx
+    1c2a:	   |  /-- 74 0d                	je     1c39 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x60>
+        d[i] = p[i];
+    1c2c:	   |  |   40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+    1c30:	   |  |   41 88 3c 08          	mov    %dil,(%r8,%rcx,1)
+    for (Index i = 0; i < head; ++i) {
+    1c34:	   |  |   48 ff c1             	inc    %rcx
+    1c37:	   \--|-- eb ee                	jmp    1c27 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4e>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    1c39:	      \-> 31 c9                	xor    %ecx,%ecx
+        rotated[i] = p[(head + i) % 16];
+    1c3b:	      /-> 48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+    1c3f:	      |   83 e7 0f             	and    $0xf,%edi
+    1c42:	      |   40 8a 3c 3e          	mov    (%rsi,%rdi,1),%dil
+    1c46:	      |   40 88 7c 0c e8       	mov    %dil,-0x18(%rsp,%rcx,1)
+    for (Index i = 0; i < 16; ++i) {
+    1c4b:	      |   48 ff c1             	inc    %rcx
+    1c4e:	      |   48 83 f9 10          	cmp    $0x10,%rcx
+    1c52:	      \-- 75 e7                	jne    1c3b <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x62>
+    std::memcpy(&v, s, sizeof(v));
+    1c54:	          0f 28 44 24 e8       	movaps -0x18(%rsp),%xmm0
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1c59:	          48 8d 78 40          	lea    0x40(%rax),%rdi
+    1c5d:	          4c 01 c0             	add    %r8,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1c60:	      /-> 48 89 f9             	mov    %rdi,%rcx
+    for (; i + 64 <= n; i += 64) {
+    1c63:	      |   48 8d 7f 40          	lea    0x40(%rdi),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1c67:	      |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    1c6b:	      |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    1c70:	      |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    1c75:	      |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    1c7a:	      |   48 83 c0 40          	add    $0x40,%rax
+    1c7e:	      |   48 39 fa             	cmp    %rdi,%rdx
+    1c81:	      \-- 73 dd                	jae    1c60 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x87>
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+        stream16(d + i, v);
+    1c83:	          49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    for (; i + 16 <= n; i += 16) {
+    1c87:	   /----> 48 8d 41 10          	lea    0x10(%rcx),%rax
+    1c8b:	   |      48 39 c2             	cmp    %rax,%rdx
+    1c8e:	   |  /-- 72 0a                	jb     1c9a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc1>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1c90:	   |  |   48 89 c1             	mov    %rax,%rcx
+    1c93:	   |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    1c98:	   \--|-- eb ed                	jmp    1c87 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xae>
+    }
+    __builtin_ia32_sfence();
+    1c9a:	      \-> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    1c9d:	   /----> 48 39 d1             	cmp    %rdx,%rcx
+    1ca0:	   |  /-- 73 12                	jae    1cb4 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xdb>
+        d[i] = p[i % 16];
+    1ca2:	   |  |   48 89 c8             	mov    %rcx,%rax
+    1ca5:	   |  |   83 e0 0f             	and    $0xf,%eax
+    1ca8:	   |  |   8a 04 06             	mov    (%rsi,%rax,1),%al
+    1cab:	   |  |   41 88 04 08          	mov    %al,(%r8,%rcx,1)
+    for (; i < n; ++i) {
+    1caf:	   |  |   48 ff c1             	inc    %rcx
+    1cb2:	   \--|-- eb e9                	jmp    1c9d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc4>
+    }
+}
+    1cb4:	      \-> c3                   	ret
+
+0000000000001cb5 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    1cb5:	    48 85 ff             	test   %rdi,%rdi
+    1cb8:	/-- 74 09                	je     1cc3 <nel::free_aligned(void*)+0xe>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    1cba:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    1cbe:	|   e9 6d f3 ff ff       	jmp    1030 <free@plt>
+}
+    1cc3:	\-> c3                   	ret
+
+0000000000001cc4 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    1cc4:	       41 56                	push   %r14
+            : fn_name_(fn_name)
+    1cc6:	       48 8d 05 61 04 00 00 	lea    0x461(%rip),%rax        # 212e <_IO_stdin_used+0x12e>
+    1ccd:	       41 55                	push   %r13
+    1ccf:	       41 54                	push   %r12
+    1cd1:	       55                   	push   %rbp
+    1cd2:	       53                   	push   %rbx
+    1cd3:	       48 83 ec 20          	sub    $0x20,%rsp
+    1cd7:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , file_name_(file_name)
+    1cdc:	       48 8d 05 5b 04 00 00 	lea    0x45b(%rip),%rax        # 213e <_IO_stdin_used+0x13e>
+    1ce3:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1ce8:	       c7 44 24 18 f3 00 00 	movl   $0xf3,0x18(%rsp)
+    1cef:	       00 
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    1cf0:	       48 85 f6             	test   %rsi,%rsi
+    1cf3:	/----- 74 28                	je     1d1d <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1cf5:	|      4c 8d 66 ff          	lea    -0x1(%rsi),%r12
+    1cf9:	|      48 89 f3             	mov    %rsi,%rbx
+    1cfc:	|      49 21 f4             	and    %rsi,%r12
+    1cff:	+----- 75 1c                	jne    1d1d <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1d01:	|      49 89 fd             	mov    %rdi,%r13
+    1d04:	|      49 89 d6             	mov    %rdx,%r14
+    1d07:	|      48 89 cd             	mov    %rcx,%rbp
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1d0a:	|      31 ff                	xor    %edi,%edi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    1d0c:	|      4d 85 ed             	test   %r13,%r13
+    1d0f:	|  /-- 74 1d                	je     1d2e <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+    1d11:	|  |   4d 8b 65 f8          	mov    -0x8(%r13),%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1d15:	|  |   4c 89 ef             	mov    %r13,%rdi
+    1d18:	|  |   4c 29 e7             	sub    %r12,%rdi
+    1d1b:	|  +-- eb 11                	jmp    1d2e <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    1d1d:	\--|-> 48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    1d22:	   |   48 8d 3d 27 04 00 00 	lea    0x427(%rip),%rdi        # 2150 <_IO_stdin_used+0x150>
+    1d29:	   |   e8 f4 f3 ff ff       	call   1122 <nel::assert_fail(char const*, nel::Context const&)>
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1d2e:	   \-> 48 8d 34 2b          	lea    (%rbx,%rbp,1),%rsi
+    1d32:	       e8 59 f3 ff ff       	call   1090 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    1d37:	       48 85 c0             	test   %rax,%rax
+    1d3a:	/----- 74 3b                	je     1d77 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb3>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1d3c:	|      48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    1d41:	|      48 f7 db             	neg    %rbx
+    1d44:	|      48 21 d9             	and    %rbx,%rcx
+    1d47:	|      48 89 cb             	mov    %rcx,%rbx
+    1d4a:	|      48 29 c3             	sub    %rax,%rbx
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    1d4d:	|      4d 85 ed             	test   %r13,%r13
+    1d50:	|  /-- 74 1e                	je     1d70 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+    1d52:	|  |   49 39 dc             	cmp    %rbx,%r12
+    1d55:	|  +-- 74 19                	je     1d70 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    1d57:	|  |   4c 39 f5             	cmp    %r14,%rbp
+    1d5a:	|  |   4c 89 f2             	mov    %r14,%rdx
+    1d5d:	|  |   4a 8d 34 20          	lea    (%rax,%r12,1),%rsi
+    1d61:	|  |   48 89 cf             	mov    %rcx,%rdi
+    1d64:	|  |   48 0f 46 d5          	cmovbe %rbp,%rdx
+    1d68:	|  |   e8 33 f3 ff ff       	call   10a0 <memmove@plt>
+    1d6d:	|  |   48 89 c1             	mov    %rax,%rcx
+    }
+    offset_field(new_p) = new_offset;
+    1d70:	|  \-> 48 89 59 f8          	mov    %rbx,-0x8(%rcx)
+    return new_p;
+    1d74:	|      48 89 c8             	mov    %rcx,%rax
+}
+    1d77:	\----> 48 83 c4 20          	add    $0x20,%rsp
+    1d7b:	       5b                   	pop    %rbx
+    1d7c:	       5d                   	pop    %rbp
+    1d7d:	       41 5c                	pop    %r12
+    1d7f:	       41 5d                	pop    %r13
+    1d81:	       41 5e                	pop    %r14
+    1d83:	       c3                   	ret
+
+0000000000001d84 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    1d84:	48 89 f1             	mov    %rsi,%rcx
+    return realloc_aligned(nullptr, align, 0, size);
+    1d87:	31 d2                	xor    %edx,%edx
+    1d89:	48 89 fe             	mov    %rdi,%rsi
+    1d8c:	31 ff                	xor    %edi,%edi
+    1d8e:	e9 31 ff ff ff       	jmp    1cc4 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+
+0000000000001d93 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1d93:	53                   	push   %rbx
+    1d94:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    1d97:	40 0f be fe          	movsbl %sil,%edi
+    1d9b:	48 8b 35 be 22 00 00 	mov    0x22be(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    1da2:	e8 b9 f2 ff ff       	call   1060 <fputc@plt>
+    return outs;
+}
+    1da7:	48 89 d8             	mov    %rbx,%rax
+    1daa:	5b                   	pop    %rbx
+    1dab:	c3                   	ret
+
+0000000000001dac <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1dac:	53                   	push   %rbx
+    1dad:	48 89 fb             	mov    %rdi,%rbx
+    1db0:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    1db3:	48 8b 35 a6 22 00 00 	mov    0x22a6(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    1dba:	e8 91 f2 ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    1dbf:	48 89 d8             	mov    %rbx,%rax
+    1dc2:	5b                   	pop    %rbx
+    1dc3:	c3                   	ret
+
+0000000000001dc4 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1dc4:	53                   	push   %rbx
+    1dc5:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    1dc8:	48 8b 3d 91 22 00 00 	mov    0x2291(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1dcf:	40 0f b6 d6          	movzbl %sil,%edx
+    1dd3:	31 c0                	xor    %eax,%eax
+    1dd5:	48 8d 35 8f 03 00 00 	lea    0x38f(%rip),%rsi        # 216b <_IO_stdin_used+0x16b>
+    1ddc:	e8 9f f2 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1de1:	48 89 d8             	mov    %rbx,%rax
+    1de4:	5b                   	pop    %rbx
+    1de5:	c3                   	ret
+
+0000000000001de6 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    1de6:	53                   	push   %rbx
+    1de7:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    1dea:	48 8b 3d 6f 22 00 00 	mov    0x226f(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1df1:	0f b7 d6             	movzwl %si,%edx
+    1df4:	31 c0                	xor    %eax,%eax
+    1df6:	48 8d 35 6e 03 00 00 	lea    0x36e(%rip),%rsi        # 216b <_IO_stdin_used+0x16b>
+    1dfd:	e8 7e f2 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1e02:	48 89 d8             	mov    %rbx,%rax
+    1e05:	5b                   	pop    %rbx
+    1e06:	c3                   	ret
+
+0000000000001e07 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    1e07:	53                   	push   %rbx
+    1e08:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    1e0b:	48 8b 3d 4e 22 00 00 	mov    0x224e(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1e12:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    1e14:	31 c0                	xor    %eax,%eax
+    1e16:	48 8d 35 4e 03 00 00 	lea    0x34e(%rip),%rsi        # 216b <_IO_stdin_used+0x16b>
+    1e1d:	e8 5e f2 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1e22:	48 89 d8             	mov    %rbx,%rax
+    1e25:	5b                   	pop    %rbx
+    1e26:	c3                   	ret
+
+0000000000001e27 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    1e27:	53                   	push   %rbx
+    1e28:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    1e2b:	48 8b 3d 2e 22 00 00 	mov    0x222e(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1e32:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    1e34:	31 c0                	xor    %eax,%eax
+    1e36:	48 8d 35 2e 03 00 00 	lea    0x32e(%rip),%rsi        # 216b <_IO_stdin_used+0x16b>
+    1e3d:	e8 3e f2 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1e42:	48 89 d8             	mov    %rbx,%rax
+    1e45:	5b                   	pop    %rbx
+    1e46:	c3                   	ret
+
+0000000000001e47 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    1e47:	53                   	push   %rbx
+    1e48:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    1e4b:	48 8b 3d 0e 22 00 00 	mov    0x220e(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1e52:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    1e55:	31 c0                	xor    %eax,%eax
+    1e57:	48 8d 35 10 03 00 00 	lea    0x310(%rip),%rsi        # 216e <_IO_stdin_used+0x16e>
+    1e5e:	e8 1d f2 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1e63:	48 89 d8             	mov    %rbx,%rax
+    1e66:	5b                   	pop    %rbx
+    1e67:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000001e68 <_fini>:
+    1e68:	48 83 ec 08          	sub    $0x8,%rsp
+    1e6c:	48 83 c4 08          	add    $0x8,%rsp
+    1e70:	c3                   	ret
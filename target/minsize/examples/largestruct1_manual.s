@@ -0,0 +1,991 @@
+
+target/minsize/examples/largestruct1_manual:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputc@plt>:
+    1060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 4018 <fputc@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <memcmp@plt>:
+    1070:	ff 25 aa 2f 00 00    	jmp    *0x2faa(%rip)        # 4020 <memcmp@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fprintf@plt>:
+    1080:	ff 25 a2 2f 00 00    	jmp    *0x2fa2(%rip)        # 4028 <fprintf@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <realloc@plt>:
+    1090:	ff 25 9a 2f 00 00    	jmp    *0x2f9a(%rip)        # 4030 <realloc@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memmove@plt>:
+    10a0:	ff 25 92 2f 00 00    	jmp    *0x2f92(%rip)        # 4038 <memmove@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <__cxa_atexit@plt>:
+    10b0:	ff 25 8a 2f 00 00    	jmp    *0x2f8a(%rip)        # 4040 <__cxa_atexit@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010c0 <__cxa_finalize@plt>:
+    10c0:	ff 25 1a 2f 00 00    	jmp    *0x2f1a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10c6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010d0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10d0:	50                   	push   %rax
+    std::abort();
+    10d1:	e8 6a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010d6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10d6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10d7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10da:	4c 8d 0d 7d 0f 00 00 	lea    0xf7d(%rip),%r9        # 205e <_IO_stdin_used+0x5e>
+    10e1:	31 c0                	xor    %eax,%eax
+    10e3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10e7:	4c 8b 07             	mov    (%rdi),%r8
+    10ea:	48 8d 35 73 0f 00 00 	lea    0xf73(%rip),%rsi        # 2064 <_IO_stdin_used+0x64>
+    10f1:	48 8b 3d 68 2f 00 00 	mov    0x2f68(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    10f8:	e8 83 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    10fd:	e8 3e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001102 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1102:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1106:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1109:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    110d:	31 c0                	xor    %eax,%eax
+    110f:	57                   	push   %rdi
+    1110:	48 8b 3d 49 2f 00 00 	mov    0x2f49(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1117:	4c 8d 0d 40 0f 00 00 	lea    0xf40(%rip),%r9        # 205e <_IO_stdin_used+0x5e>
+    111e:	4c 8b 06             	mov    (%rsi),%r8
+    1121:	48 8d 35 4d 0f 00 00 	lea    0xf4d(%rip),%rsi        # 2075 <_IO_stdin_used+0x75>
+    1128:	e8 53 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    112d:	e8 0e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001132 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1132:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1136:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1139:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    113d:	31 c0                	xor    %eax,%eax
+    113f:	57                   	push   %rdi
+    1140:	48 8b 3d 19 2f 00 00 	mov    0x2f19(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1147:	4c 8d 0d 3c 0f 00 00 	lea    0xf3c(%rip),%r9        # 208a <_IO_stdin_used+0x8a>
+    114e:	4c 8b 06             	mov    (%rsi),%r8
+    1151:	48 8d 35 1d 0f 00 00 	lea    0xf1d(%rip),%rsi        # 2075 <_IO_stdin_used+0x75>
+    1158:	e8 23 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    115d:	e8 de fe ff ff       	call   1040 <abort@plt>
+
+0000000000001162 <main>:
+    // 3 store value to address.
+    fak_->foo();
+}
+
+int main()
+{
+    1162:	53                   	push   %rbx
+    nel::log << "ex1:b" << '\n';
+    1163:	48 8d 1d 00 2f 00 00 	lea    0x2f00(%rip),%rbx        # 406a <nel::log>
+    116a:	48 8d 35 9d 0e 00 00 	lea    0xe9d(%rip),%rsi        # 200e <_IO_stdin_used+0xe>
+    1171:	48 89 df             	mov    %rbx,%rdi
+    1174:	e8 bc 04 00 00       	call   1635 <nel::operator<<(nel::Log&, char const*)>
+    1179:	be 0a 00 00 00       	mov    $0xa,%esi
+    117e:	48 89 c7             	mov    %rax,%rdi
+    1181:	e8 96 04 00 00       	call   161c <nel::operator<<(nel::Log&, char)>
+    ex1();
+    1186:	e8 4e 01 00 00       	call   12d9 <ex1()>
+    nel::log << "ex1:e" << '\n';
+    118b:	48 89 df             	mov    %rbx,%rdi
+    118e:	48 8d 35 7f 0e 00 00 	lea    0xe7f(%rip),%rsi        # 2014 <_IO_stdin_used+0x14>
+    1195:	e8 9b 04 00 00       	call   1635 <nel::operator<<(nel::Log&, char const*)>
+    119a:	be 0a 00 00 00       	mov    $0xa,%esi
+    119f:	48 89 c7             	mov    %rax,%rdi
+    11a2:	e8 75 04 00 00       	call   161c <nel::operator<<(nel::Log&, char)>
+}
+    11a7:	31 c0                	xor    %eax,%eax
+    11a9:	5b                   	pop    %rbx
+    11aa:	c3                   	ret
+
+00000000000011ab <_GLOBAL__sub_I__close_r>:
+nel::Manual<Fake> fak_;
+    11ab:	48 8d 15 9e 2e 00 00 	lea    0x2e9e(%rip),%rdx        # 4050 <__dso_handle>
+    11b2:	48 8d 35 b0 2e 00 00 	lea    0x2eb0(%rip),%rsi        # 4069 <fak_>
+    11b9:	48 8d 3d d6 01 00 00 	lea    0x1d6(%rip),%rdi        # 1396 <nel::Manual<Fake>::~Manual()>
+    11c0:	e9 eb fe ff ff       	jmp    10b0 <__cxa_atexit@plt>
+    11c5:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    11cc:	00 00 00 
+    11cf:	90                   	nop
+
+00000000000011d0 <_start>:
+    11d0:	31 ed                	xor    %ebp,%ebp
+    11d2:	49 89 d1             	mov    %rdx,%r9
+    11d5:	5e                   	pop    %rsi
+    11d6:	48 89 e2             	mov    %rsp,%rdx
+    11d9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    11dd:	50                   	push   %rax
+    11de:	54                   	push   %rsp
+    11df:	45 31 c0             	xor    %r8d,%r8d
+    11e2:	31 c9                	xor    %ecx,%ecx
+    11e4:	48 8d 3d 77 ff ff ff 	lea    -0x89(%rip),%rdi        # 1162 <main>
+    11eb:	ff 15 cf 2d 00 00    	call   *0x2dcf(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    11f1:	f4                   	hlt
+    11f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    11f9:	00 00 00 
+    11fc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001200 <deregister_tm_clones>:
+    1200:	    48 8d 3d 51 2e 00 00 	lea    0x2e51(%rip),%rdi        # 4058 <__TMC_END__>
+    1207:	    48 8d 05 4a 2e 00 00 	lea    0x2e4a(%rip),%rax        # 4058 <__TMC_END__>
+    120e:	    48 39 f8             	cmp    %rdi,%rax
+    1211:	/-- 74 15                	je     1228 <deregister_tm_clones+0x28>
+    1213:	|   48 8b 05 ae 2d 00 00 	mov    0x2dae(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    121a:	|   48 85 c0             	test   %rax,%rax
+    121d:	+-- 74 09                	je     1228 <deregister_tm_clones+0x28>
+    121f:	|   ff e0                	jmp    *%rax
+    1221:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1228:	\-> c3                   	ret
+    1229:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001230 <register_tm_clones>:
+    1230:	    48 8d 3d 21 2e 00 00 	lea    0x2e21(%rip),%rdi        # 4058 <__TMC_END__>
+    1237:	    48 8d 35 1a 2e 00 00 	lea    0x2e1a(%rip),%rsi        # 4058 <__TMC_END__>
+    123e:	    48 29 fe             	sub    %rdi,%rsi
+    1241:	    48 89 f0             	mov    %rsi,%rax
+    1244:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1248:	    48 c1 f8 03          	sar    $0x3,%rax
+    124c:	    48 01 c6             	add    %rax,%rsi
+    124f:	    48 d1 fe             	sar    %rsi
+    1252:	/-- 74 14                	je     1268 <register_tm_clones+0x38>
+    1254:	|   48 8b 05 7d 2d 00 00 	mov    0x2d7d(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    125b:	|   48 85 c0             	test   %rax,%rax
+    125e:	+-- 74 08                	je     1268 <register_tm_clones+0x38>
+    1260:	|   ff e0                	jmp    *%rax
+    1262:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1268:	\-> c3                   	ret
+    1269:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001270 <__do_global_dtors_aux>:
+    1270:	       f3 0f 1e fa          	endbr64
+    1274:	       80 3d ed 2d 00 00 00 	cmpb   $0x0,0x2ded(%rip)        # 4068 <completed.0>
+    127b:	/----- 75 2b                	jne    12a8 <__do_global_dtors_aux+0x38>
+    127d:	|      55                   	push   %rbp
+    127e:	|      48 83 3d 5a 2d 00 00 	cmpq   $0x0,0x2d5a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1285:	|      00 
+    1286:	|      48 89 e5             	mov    %rsp,%rbp
+    1289:	|  /-- 74 0c                	je     1297 <__do_global_dtors_aux+0x27>
+    128b:	|  |   48 8b 3d be 2d 00 00 	mov    0x2dbe(%rip),%rdi        # 4050 <__dso_handle>
+    1292:	|  |   e8 29 fe ff ff       	call   10c0 <__cxa_finalize@plt>
+    1297:	|  \-> e8 64 ff ff ff       	call   1200 <deregister_tm_clones>
+    129c:	|      c6 05 c5 2d 00 00 01 	movb   $0x1,0x2dc5(%rip)        # 4068 <completed.0>
+    12a3:	|      5d                   	pop    %rbp
+    12a4:	|      c3                   	ret
+    12a5:	|      0f 1f 00             	nopl   (%rax)
+    12a8:	\----> c3                   	ret
+    12a9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000012b0 <frame_dummy>:
+    12b0:	f3 0f 1e fa          	endbr64
+    12b4:	e9 77 ff ff ff       	jmp    1230 <register_tm_clones>
+
+00000000000012b9 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    12b9:	83 c8 ff             	or     $0xffffffff,%eax
+    12bc:	c3                   	ret
+
+00000000000012bd <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    12bd:	83 c8 ff             	or     $0xffffffff,%eax
+    12c0:	c3                   	ret
+
+00000000000012c1 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    12c1:	83 c8 ff             	or     $0xffffffff,%eax
+    12c4:	c3                   	ret
+
+00000000000012c5 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    12c5:	83 c8 ff             	or     $0xffffffff,%eax
+    12c8:	c3                   	ret
+
+00000000000012c9 <_read_r>:
+int _read_r(struct _reent *, int) {
+    12c9:	83 c8 ff             	or     $0xffffffff,%eax
+    12cc:	c3                   	ret
+
+00000000000012cd <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    12cd:	83 c8 ff             	or     $0xffffffff,%eax
+    12d0:	c3                   	ret
+
+00000000000012d1 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    12d1:	83 c8 ff             	or     $0xffffffff,%eax
+    12d4:	c3                   	ret
+
+00000000000012d5 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    12d5:	83 c8 ff             	or     $0xffffffff,%eax
+    12d8:	c3                   	ret
+
+00000000000012d9 <ex1()>:
+{
+    12d9:	    41 54                	push   %r12
+            nel::elem::set(data_, f, N);
+        }
+
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+        {
+            outs << "U8Buf<" << val.len() << ">{";
+    12db:	    48 8d 35 22 0d 00 00 	lea    0xd22(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    12e2:	    55                   	push   %rbp
+            if (val.len() > 0) {
+                outs << val.data_[0];
+                for (Index i = 1; i < val.len(); ++i) {
+    12e3:	    bd 01 00 00 00       	mov    $0x1,%ebp
+    12e8:	    53                   	push   %rbx
+            outs << "U8Buf<" << val.len() << ">{";
+    12e9:	    48 8d 1d 7a 2d 00 00 	lea    0x2d7a(%rip),%rbx        # 406a <nel::log>
+    12f0:	    48 89 df             	mov    %rbx,%rdi
+    12f3:	    48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+    12fa:	    e8 36 03 00 00       	call   1635 <nel::operator<<(nel::Log&, char const*)>
+    12ff:	    be 00 01 00 00       	mov    $0x100,%esi
+                    outs << ' ' << val.data_[i];
+    1304:	    49 89 e4             	mov    %rsp,%r12
+            outs << "U8Buf<" << val.len() << ">{";
+    1307:	    48 89 c7             	mov    %rax,%rdi
+    130a:	    e8 c1 03 00 00       	call   16d0 <nel::operator<<(nel::Log&, unsigned long)>
+    130f:	    48 8d 35 f5 0c 00 00 	lea    0xcf5(%rip),%rsi        # 200b <_IO_stdin_used+0xb>
+    1316:	    48 89 c7             	mov    %rax,%rdi
+    1319:	    e8 17 03 00 00       	call   1635 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    131e:	    0f b6 34 24          	movzbl (%rsp),%esi
+    1322:	    48 89 df             	mov    %rbx,%rdi
+    1325:	    e8 23 03 00 00       	call   164d <nel::operator<<(nel::Log&, unsigned char)>
+                    outs << ' ' << val.data_[i];
+    132a:	/-> be 20 00 00 00       	mov    $0x20,%esi
+    132f:	|   48 89 df             	mov    %rbx,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1332:	|   48 ff c5             	inc    %rbp
+                    outs << ' ' << val.data_[i];
+    1335:	|   e8 e2 02 00 00       	call   161c <nel::operator<<(nel::Log&, char)>
+    133a:	|   42 0f b6 74 25 ff    	movzbl -0x1(%rbp,%r12,1),%esi
+    1340:	|   48 89 c7             	mov    %rax,%rdi
+    1343:	|   e8 05 03 00 00       	call   164d <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1348:	|   48 81 fd 00 01 00 00 	cmp    $0x100,%rbp
+    134f:	\-- 75 d9                	jne    132a <ex1()+0x51>
+                }
+            }
+            outs << '}';
+    1351:	    48 89 df             	mov    %rbx,%rdi
+    1354:	    be 7d 00 00 00       	mov    $0x7d,%esi
+    1359:	    e8 be 02 00 00       	call   161c <nel::operator<<(nel::Log&, char)>
+    nel::log << *m1 << '\n';
+    135e:	    48 89 df             	mov    %rbx,%rdi
+    1361:	    be 0a 00 00 00       	mov    $0xa,%esi
+    1366:	    e8 b1 02 00 00       	call   161c <nel::operator<<(nel::Log&, char)>
+            nel::elem::set(data_, 0xa5, N);
+    136b:	    4c 89 e7             	mov    %r12,%rdi
+    136e:	    ba 00 01 00 00       	mov    $0x100,%edx
+    1373:	    be a5 00 00 00       	mov    $0xa5,%esi
+    1378:	    e8 20 00 00 00       	call   139d <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    137d:	    48 81 c4 00 01 00 00 	add    $0x100,%rsp
+    1384:	    5b                   	pop    %rbx
+    1385:	    5d                   	pop    %rbp
+    1386:	    41 5c                	pop    %r12
+    1388:	    c3                   	ret
+
+0000000000001389 <isr_ctimer>:
+            RegBlock::BLOCK0.reg1_ = 23;
+    1389:	c7 04 25 00 00 00 40 	movl   $0x17,0x40000000
+    1390:	17 00 00 00 
+}
+    1394:	c3                   	ret
+    1395:	90                   	nop
+
+0000000000001396 <nel::Manual<Fake>::~Manual()>:
+    // 2 load reg with address (precomputed, no alignment adjusts etc)
+    1396:	c3                   	ret
+
+0000000000001397 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1397:	48 89 d1             	mov    %rdx,%rcx
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    139a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    139c:	c3                   	ret
+
+000000000000139d <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    139d:	48 89 d1             	mov    %rdx,%rcx
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    13a0:	89 f0                	mov    %esi,%eax
+    13a2:	f3 aa                	rep stos %al,%es:(%rdi)
+}
+    13a4:	c3                   	ret
+
+00000000000013a5 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    13a5:	48 89 d1             	mov    %rdx,%rcx
+    13a8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    13aa:	c3                   	ret
+
+00000000000013ab <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    13ab:	e9 f0 fc ff ff       	jmp    10a0 <memmove@plt>
+
+00000000000013b0 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    13b0:	48 89 f1             	mov    %rsi,%rcx
+    std::memset(d, s, n);
+    13b3:	b0 a5                	mov    $0xa5,%al
+    13b5:	f3 aa                	rep stos %al,%es:(%rdi)
+    set(d, 0xa5, n);
+}
+    13b7:	c3                   	ret
+
+00000000000013b8 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    13b8:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    13b9:	e8 b2 fc ff ff       	call   1070 <memcmp@plt>
+}
+    13be:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) == 0;
+    13bf:	85 c0                	test   %eax,%eax
+    13c1:	0f 94 c0             	sete   %al
+}
+    13c4:	c3                   	ret
+
+00000000000013c5 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    13c5:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    13c6:	e8 a5 fc ff ff       	call   1070 <memcmp@plt>
+}
+    13cb:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) != 0;
+    13cc:	85 c0                	test   %eax,%eax
+    13ce:	0f 95 c0             	setne  %al
+}
+    13d1:	c3                   	ret
+
+00000000000013d2 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+{
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    13d2:	          49 89 fa             	mov    %rdi,%r10
+    13d5:	          48 89 f0             	mov    %rsi,%rax
+    if (n < streaming_min) {
+    13d8:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    13df:	      /-- 77 05                	ja     13e6 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14>
+    std::memcpy(d, s, n);
+    13e1:	      |   48 89 d1             	mov    %rdx,%rcx
+    13e4:	/-----|-- eb 79                	jmp    145f <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x8d>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    13e6:	|     \-> 48 89 f9             	mov    %rdi,%rcx
+    13e9:	|         48 f7 d9             	neg    %rcx
+    13ec:	|         83 e1 0f             	and    $0xf,%ecx
+    13ef:	|         49 89 c8             	mov    %rcx,%r8
+    std::memcpy(d, s, n);
+    13f2:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    13f4:	|         49 8d 70 40          	lea    0x40(%r8),%rsi
+    13f8:	|         48 89 f9             	mov    %rdi,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    13fb:	|     /-> 0f 10 54 30 d0       	movups -0x30(%rax,%rsi,1),%xmm2
+    1400:	|     |   0f 10 4c 30 e0       	movups -0x20(%rax,%rsi,1),%xmm1
+    1405:	|     |   49 89 f0             	mov    %rsi,%r8
+    for (; i + 64 <= n; i += 64) {
+    1408:	|     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    140c:	|     |   0f 10 44 30 f0       	movups -0x10(%rax,%rsi,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1411:	|     |   0f 10 5c 30 c0       	movups -0x40(%rax,%rsi,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    1416:	|     |   48 83 c6 40          	add    $0x40,%rsi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    141a:	|     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    141f:	|     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    1424:	|     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    1429:	|     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    142e:	|     |   48 39 f2             	cmp    %rsi,%rdx
+    1431:	|     \-- 73 c8                	jae    13fb <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x29>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    1433:	|  /----> 49 8d 48 10          	lea    0x10(%r8),%rcx
+        stream16(d + i, load16(s + i));
+    1437:	|  |      4f 8d 0c 02          	lea    (%r10,%r8,1),%r9
+    for (; i + 16 <= n; i += 16) {
+    143b:	|  |      48 39 ca             	cmp    %rcx,%rdx
+    143e:	|  |  /-- 72 0f                	jb     144f <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x7d>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1440:	|  |  |   0f 10 64 08 f0       	movups -0x10(%rax,%rcx,1),%xmm4
+    1445:	|  |  |   49 89 c8             	mov    %rcx,%r8
+    1448:	|  |  |   66 41 0f e7 21       	movntdq %xmm4,(%r9)
+    for (; i + 16 <= n; i += 16) {
+    144d:	|  \--|-- eb e4                	jmp    1433 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x61>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    144f:	|     \-> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    1452:	|         4c 29 c2             	sub    %r8,%rdx
+        stream16(d + i, load16(s + i));
+    1455:	|         4a 8d 34 00          	lea    (%rax,%r8,1),%rsi
+    std::memcpy(d, s, n);
+    1459:	|         4c 89 cf             	mov    %r9,%rdi
+    copy(d + i, s + i, n - i);
+    145c:	|         48 89 d1             	mov    %rdx,%rcx
+    std::memcpy(d, s, n);
+    145f:	\-------> f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1461:	          c3                   	ret
+
+0000000000001462 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    1462:	          49 89 f8             	mov    %rdi,%r8
+    if (n < streaming_min) {
+    1465:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    146c:	/-------- 77 37                	ja     14a5 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x43>
+    Length done = (n < 16) ? n : 16;
+    146e:	|         b8 10 00 00 00       	mov    $0x10,%eax
+    1473:	|         48 39 c2             	cmp    %rax,%rdx
+    1476:	|         48 0f 46 c2          	cmovbe %rdx,%rax
+    std::memcpy(d, s, n);
+    147a:	|         89 c1                	mov    %eax,%ecx
+    147c:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    147e:	|  /----> 48 39 d0             	cmp    %rdx,%rax
+    1481:	|  |  /-- 73 21                	jae    14a4 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42>
+        Length const m = (done < n - done) ? done : n - done;
+    1483:	|  |  |   49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    1486:	|  |  |   4d 8d 14 00          	lea    (%r8,%rax,1),%r10
+    std::memcpy(d, s, n);
+    148a:	|  |  |   4c 89 c6             	mov    %r8,%rsi
+        Length const m = (done < n - done) ? done : n - done;
+    148d:	|  |  |   49 29 c1             	sub    %rax,%r9
+    std::memcpy(d, s, n);
+    1490:	|  |  |   4c 89 d7             	mov    %r10,%rdi
+        Length const m = (done < n - done) ? done : n - done;
+    1493:	|  |  |   49 39 c1             	cmp    %rax,%r9
+    1496:	|  |  |   4c 0f 47 c8          	cmova  %rax,%r9
+    std::memcpy(d, s, n);
+    149a:	|  |  |   44 89 c9             	mov    %r9d,%ecx
+        done += m;
+    149d:	|  |  |   4c 01 c8             	add    %r9,%rax
+    std::memcpy(d, s, n);
+    14a0:	|  |  |   f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+        done += m;
+    14a2:	|  \--|-- eb da                	jmp    147e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c>
+    14a4:	|     \-> c3                   	ret
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    14a5:	\-------> 48 89 f8             	mov    %rdi,%rax
+    for (Index i = 0; i < head; ++i) {
+    14a8:	          31 c9                	xor    %ecx,%ecx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    14aa:	          48 f7 d8             	neg    %rax
+    14ad:	          83 e0 0f             	and    $0xf,%eax
+    for (Index i = 0; i < head; ++i) {
+    14b0:	   /----> 48 39 c1             	cmp    %rax,%rcx
+    14b3:	   |  /-- 74 0d                	je     14c2 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x60>
+        d[i] = p[i];
+    14b5:	   |  |   40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+    14b9:	   |  |   41 88 3c 08          	mov    %dil,(%r8,%rcx,1)
+    for (Index i = 0; i < head; ++i) {
+    14bd:	   |  |   48 ff c1             	inc    %rcx
+    14c0:	   \--|-- eb ee                	jmp    14b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4e>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    14c2:	      \-> 31 c9                	xor    %ecx,%ecx
+        rotated[i] = p[(head + i) % 16];
+    14c4:	      /-> 48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+    14c8:	      |   83 e7 0f             	and    $0xf,%edi
+    14cb:	      |   40 8a 3c 3e          	mov    (%rsi,%rdi,1),%dil
+    14cf:	      |   40 88 7c 0c e8       	mov    %dil,-0x18(%rsp,%rcx,1)
+    for (Index i = 0; i < 16; ++i) {
+    14d4:	      |   48 ff c1             	inc    %rcx
+    14d7:	      |   48 83 f9 10          	cmp    $0x10,%rcx
+    14db:	      \-- 75 e7                	jne    14c4 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x62>
+    std::memcpy(&v, s, sizeof(v));
+    14dd:	          0f 28 44 24 e8       	movaps -0x18(%rsp),%xmm0
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    14e2:	          48 8d 78 40          	lea    0x40(%rax),%rdi
+    14e6:	          4c 01 c0             	add    %r8,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    14e9:	      /-> 48 89 f9             	mov    %rdi,%rcx
+    for (; i + 64 <= n; i += 64) {
+    14ec:	      |   48 8d 7f 40          	lea    0x40(%rdi),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    14f0:	      |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    14f4:	      |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    14f9:	      |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    14fe:	      |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    1503:	      |   48 83 c0 40          	add    $0x40,%rax
+    1507:	      |   48 39 fa             	cmp    %rdi,%rdx
+    150a:	      \-- 73 dd                	jae    14e9 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x87>
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+        stream16(d + i, v);
+    150c:	          49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    for (; i + 16 <= n; i += 16) {
+    1510:	   /----> 48 8d 41 10          	lea    0x10(%rcx),%rax
+    1514:	   |      48 39 c2             	cmp    %rax,%rdx
+    1517:	   |  /-- 72 0a                	jb     1523 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc1>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1519:	   |  |   48 89 c1             	mov    %rax,%rcx
+    151c:	   |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    1521:	   \--|-- eb ed                	jmp    1510 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xae>
+    }
+    __builtin_ia32_sfence();
+    1523:	      \-> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    1526:	   /----> 48 39 d1             	cmp    %rdx,%rcx
+    1529:	   |  /-- 73 12                	jae    153d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xdb>
+        d[i] = p[i % 16];
+    152b:	   |  |   48 89 c8             	mov    %rcx,%rax
+    152e:	   |  |   83 e0 0f             	and    $0xf,%eax
+    1531:	   |  |   8a 04 06             	mov    (%rsi,%rax,1),%al
+    1534:	   |  |   41 88 04 08          	mov    %al,(%r8,%rcx,1)
+    for (; i < n; ++i) {
+    1538:	   |  |   48 ff c1             	inc    %rcx
+    153b:	   \--|-- eb e9                	jmp    1526 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc4>
+    }
+}
+    153d:	      \-> c3                   	ret
+
+000000000000153e <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    153e:	    48 85 ff             	test   %rdi,%rdi
+    1541:	/-- 74 09                	je     154c <nel::free_aligned(void*)+0xe>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    1543:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    1547:	|   e9 e4 fa ff ff       	jmp    1030 <free@plt>
+}
+    154c:	\-> c3                   	ret
+
+000000000000154d <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    154d:	       41 56                	push   %r14
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    154f:	       48 8d 05 c4 0a 00 00 	lea    0xac4(%rip),%rax        # 201a <_IO_stdin_used+0x1a>
+    1556:	       41 55                	push   %r13
+    1558:	       41 54                	push   %r12
+    155a:	       55                   	push   %rbp
+    155b:	       53                   	push   %rbx
+    155c:	       48 83 ec 20          	sub    $0x20,%rsp
+    1560:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , file_name_(file_name)
+    1565:	       48 8d 05 be 0a 00 00 	lea    0xabe(%rip),%rax        # 202a <_IO_stdin_used+0x2a>
+    156c:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1571:	       c7 44 24 18 f3 00 00 	movl   $0xf3,0x18(%rsp)
+    1578:	       00 
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    1579:	       48 85 f6             	test   %rsi,%rsi
+    157c:	/----- 74 28                	je     15a6 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    157e:	|      4c 8d 66 ff          	lea    -0x1(%rsi),%r12
+    1582:	|      48 89 f3             	mov    %rsi,%rbx
+    1585:	|      49 21 f4             	and    %rsi,%r12
+    1588:	+----- 75 1c                	jne    15a6 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    158a:	|      49 89 fd             	mov    %rdi,%r13
+    158d:	|      49 89 d6             	mov    %rdx,%r14
+    1590:	|      48 89 cd             	mov    %rcx,%rbp
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1593:	|      31 ff                	xor    %edi,%edi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    1595:	|      4d 85 ed             	test   %r13,%r13
+    1598:	|  /-- 74 1d                	je     15b7 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+    159a:	|  |   4d 8b 65 f8          	mov    -0x8(%r13),%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    159e:	|  |   4c 89 ef             	mov    %r13,%rdi
+    15a1:	|  |   4c 29 e7             	sub    %r12,%rdi
+    15a4:	|  +-- eb 11                	jmp    15b7 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    15a6:	\--|-> 48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    15ab:	   |   48 8d 3d 8a 0a 00 00 	lea    0xa8a(%rip),%rdi        # 203c <_IO_stdin_used+0x3c>
+    15b2:	   |   e8 7b fb ff ff       	call   1132 <nel::assert_fail(char const*, nel::Context const&)>
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    15b7:	   \-> 48 8d 34 2b          	lea    (%rbx,%rbp,1),%rsi
+    15bb:	       e8 d0 fa ff ff       	call   1090 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    15c0:	       48 85 c0             	test   %rax,%rax
+    15c3:	/----- 74 3b                	je     1600 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb3>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    15c5:	|      48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    15ca:	|      48 f7 db             	neg    %rbx
+    15cd:	|      48 21 d9             	and    %rbx,%rcx
+    15d0:	|      48 89 cb             	mov    %rcx,%rbx
+    15d3:	|      48 29 c3             	sub    %rax,%rbx
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    15d6:	|      4d 85 ed             	test   %r13,%r13
+    15d9:	|  /-- 74 1e                	je     15f9 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+    15db:	|  |   49 39 dc             	cmp    %rbx,%r12
+    15de:	|  +-- 74 19                	je     15f9 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    15e0:	|  |   4c 39 f5             	cmp    %r14,%rbp
+    15e3:	|  |   4c 89 f2             	mov    %r14,%rdx
+    15e6:	|  |   4a 8d 34 20          	lea    (%rax,%r12,1),%rsi
+    15ea:	|  |   48 89 cf             	mov    %rcx,%rdi
+    15ed:	|  |   48 0f 46 d5          	cmovbe %rbp,%rdx
+    15f1:	|  |   e8 aa fa ff ff       	call   10a0 <memmove@plt>
+    15f6:	|  |   48 89 c1             	mov    %rax,%rcx
+    }
+    offset_field(new_p) = new_offset;
+    15f9:	|  \-> 48 89 59 f8          	mov    %rbx,-0x8(%rcx)
+    return new_p;
+    15fd:	|      48 89 c8             	mov    %rcx,%rax
+}
+    1600:	\----> 48 83 c4 20          	add    $0x20,%rsp
+    1604:	       5b                   	pop    %rbx
+    1605:	       5d                   	pop    %rbp
+    1606:	       41 5c                	pop    %r12
+    1608:	       41 5d                	pop    %r13
+    160a:	       41 5e                	pop    %r14
+    160c:	       c3                   	ret
+
+000000000000160d <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    160d:	48 89 f1             	mov    %rsi,%rcx
+    return realloc_aligned(nullptr, align, 0, size);
+    1610:	31 d2                	xor    %edx,%edx
+    1612:	48 89 fe             	mov    %rdi,%rsi
+    1615:	31 ff                	xor    %edi,%edi
+    1617:	e9 31 ff ff ff       	jmp    154d <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+
+000000000000161c <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    161c:	53                   	push   %rbx
+    161d:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    1620:	40 0f be fe          	movsbl %sil,%edi
+    1624:	48 8b 35 35 2a 00 00 	mov    0x2a35(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    162b:	e8 30 fa ff ff       	call   1060 <fputc@plt>
+    return outs;
+}
+    1630:	48 89 d8             	mov    %rbx,%rax
+    1633:	5b                   	pop    %rbx
+    1634:	c3                   	ret
+
+0000000000001635 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1635:	53                   	push   %rbx
+    1636:	48 89 fb             	mov    %rdi,%rbx
+    1639:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    163c:	48 8b 35 1d 2a 00 00 	mov    0x2a1d(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    1643:	e8 08 fa ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    1648:	48 89 d8             	mov    %rbx,%rax
+    164b:	5b                   	pop    %rbx
+    164c:	c3                   	ret
+
+000000000000164d <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    164d:	53                   	push   %rbx
+    164e:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    1651:	48 8b 3d 08 2a 00 00 	mov    0x2a08(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1658:	40 0f b6 d6          	movzbl %sil,%edx
+    165c:	31 c0                	xor    %eax,%eax
+    165e:	48 8d 35 f2 09 00 00 	lea    0x9f2(%rip),%rsi        # 2057 <_IO_stdin_used+0x57>
+    1665:	e8 16 fa ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    166a:	48 89 d8             	mov    %rbx,%rax
+    166d:	5b                   	pop    %rbx
+    166e:	c3                   	ret
+
+000000000000166f <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    166f:	53                   	push   %rbx
+    1670:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    1673:	48 8b 3d e6 29 00 00 	mov    0x29e6(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    167a:	0f b7 d6             	movzwl %si,%edx
+    167d:	31 c0                	xor    %eax,%eax
+    167f:	48 8d 35 d1 09 00 00 	lea    0x9d1(%rip),%rsi        # 2057 <_IO_stdin_used+0x57>
+    1686:	e8 f5 f9 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    168b:	48 89 d8             	mov    %rbx,%rax
+    168e:	5b                   	pop    %rbx
+    168f:	c3                   	ret
+
+0000000000001690 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    1690:	53                   	push   %rbx
+    1691:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    1694:	48 8b 3d c5 29 00 00 	mov    0x29c5(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    169b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    169d:	31 c0                	xor    %eax,%eax
+    169f:	48 8d 35 b1 09 00 00 	lea    0x9b1(%rip),%rsi        # 2057 <_IO_stdin_used+0x57>
+    16a6:	e8 d5 f9 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    16ab:	48 89 d8             	mov    %rbx,%rax
+    16ae:	5b                   	pop    %rbx
+    16af:	c3                   	ret
+
+00000000000016b0 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    16b0:	53                   	push   %rbx
+    16b1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    16b4:	48 8b 3d a5 29 00 00 	mov    0x29a5(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    16bb:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    16bd:	31 c0                	xor    %eax,%eax
+    16bf:	48 8d 35 91 09 00 00 	lea    0x991(%rip),%rsi        # 2057 <_IO_stdin_used+0x57>
+    16c6:	e8 b5 f9 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    16cb:	48 89 d8             	mov    %rbx,%rax
+    16ce:	5b                   	pop    %rbx
+    16cf:	c3                   	ret
+
+00000000000016d0 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    16d0:	53                   	push   %rbx
+    16d1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    16d4:	48 8b 3d 85 29 00 00 	mov    0x2985(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    16db:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    16de:	31 c0                	xor    %eax,%eax
+    16e0:	48 8d 35 73 09 00 00 	lea    0x973(%rip),%rsi        # 205a <_IO_stdin_used+0x5a>
+    16e7:	e8 94 f9 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    16ec:	48 89 d8             	mov    %rbx,%rax
+    16ef:	5b                   	pop    %rbx
+    16f0:	c3                   	ret
+
+Disassembly of section .fini:
+
+00000000000016f4 <_fini>:
+    16f4:	48 83 ec 08          	sub    $0x8,%rsp
+    16f8:	48 83 c4 08          	add    $0x8,%rsp
+    16fc:	c3                   	ret
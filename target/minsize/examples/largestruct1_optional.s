@@ -0,0 +1,583 @@
+
+target/minsize/examples/largestruct1_optional:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <abort@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <abort@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <abort@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <fputs@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <fputs@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputc@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <fputc@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fprintf@plt>:
+    1060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 4018 <fprintf@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+0000000000001070 <__cxa_finalize@plt>:
+    1070:	ff 25 6a 2f 00 00    	jmp    *0x2f6a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1076:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+0000000000001080 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    1080:	50                   	push   %rax
+    std::abort();
+    1081:	e8 aa ff ff ff       	call   1030 <abort@plt>
+
+0000000000001086 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    1086:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    1087:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    108a:	4c 8d 0d e5 0f 00 00 	lea    0xfe5(%rip),%r9        # 2076 <_IO_stdin_used+0x76>
+    1091:	31 c0                	xor    %eax,%eax
+    1093:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    1097:	4c 8b 07             	mov    (%rdi),%r8
+    109a:	48 8d 35 db 0f 00 00 	lea    0xfdb(%rip),%rsi        # 207c <_IO_stdin_used+0x7c>
+    10a1:	48 8b 3d 98 2f 00 00 	mov    0x2f98(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+    10a8:	e8 b3 ff ff ff       	call   1060 <fprintf@plt>
+    std::abort();
+    10ad:	e8 7e ff ff ff       	call   1030 <abort@plt>
+
+00000000000010b2 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    10b2:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    10b6:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    10b9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    10bd:	31 c0                	xor    %eax,%eax
+    10bf:	57                   	push   %rdi
+    10c0:	48 8b 3d 79 2f 00 00 	mov    0x2f79(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+    10c7:	4c 8d 0d a8 0f 00 00 	lea    0xfa8(%rip),%r9        # 2076 <_IO_stdin_used+0x76>
+    10ce:	4c 8b 06             	mov    (%rsi),%r8
+    10d1:	48 8d 35 b5 0f 00 00 	lea    0xfb5(%rip),%rsi        # 208d <_IO_stdin_used+0x8d>
+    10d8:	e8 83 ff ff ff       	call   1060 <fprintf@plt>
+    std::abort();
+    10dd:	e8 4e ff ff ff       	call   1030 <abort@plt>
+
+00000000000010e2 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    10e2:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    10e6:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    10e9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    10ed:	31 c0                	xor    %eax,%eax
+    10ef:	57                   	push   %rdi
+    10f0:	48 8b 3d 49 2f 00 00 	mov    0x2f49(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+    10f7:	4c 8d 0d a4 0f 00 00 	lea    0xfa4(%rip),%r9        # 20a2 <_IO_stdin_used+0xa2>
+    10fe:	4c 8b 06             	mov    (%rsi),%r8
+    1101:	48 8d 35 85 0f 00 00 	lea    0xf85(%rip),%rsi        # 208d <_IO_stdin_used+0x8d>
+    1108:	e8 53 ff ff ff       	call   1060 <fprintf@plt>
+    std::abort();
+    110d:	e8 1e ff ff ff       	call   1030 <abort@plt>
+
+0000000000001112 <main>:
+    nel::Optional<char const *> a = nel::Some(T("ex3"));
+    nel::log << a.map<bool>([](auto &&) -> bool { return true; }) << '\n';
+}
+
+int main()
+{
+    1112:	53                   	push   %rbx
+    nel::log << "ex1:b" << '\n';
+    1113:	48 8d 1d 2f 2f 00 00 	lea    0x2f2f(%rip),%rbx        # 4049 <nel::log>
+    111a:	48 8d 35 25 0f 00 00 	lea    0xf25(%rip),%rsi        # 2046 <_IO_stdin_used+0x46>
+    1121:	48 89 df             	mov    %rbx,%rdi
+    1124:	e8 17 03 00 00       	call   1440 <nel::operator<<(nel::Log&, char const*)>
+    1129:	be 0a 00 00 00       	mov    $0xa,%esi
+    112e:	48 89 c7             	mov    %rax,%rdi
+    1131:	e8 f1 02 00 00       	call   1427 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    nel::log << "ex1:e" << '\n';
+    1136:	48 89 df             	mov    %rbx,%rdi
+    1139:	48 8d 35 0c 0f 00 00 	lea    0xf0c(%rip),%rsi        # 204c <_IO_stdin_used+0x4c>
+    1140:	e8 fb 02 00 00       	call   1440 <nel::operator<<(nel::Log&, char const*)>
+    1145:	be 0a 00 00 00       	mov    $0xa,%esi
+    114a:	48 89 c7             	mov    %rax,%rdi
+    114d:	e8 d5 02 00 00       	call   1427 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex2:b" << '\n';
+    1152:	48 89 df             	mov    %rbx,%rdi
+    1155:	48 8d 35 f6 0e 00 00 	lea    0xef6(%rip),%rsi        # 2052 <_IO_stdin_used+0x52>
+    115c:	e8 df 02 00 00       	call   1440 <nel::operator<<(nel::Log&, char const*)>
+    1161:	be 0a 00 00 00       	mov    $0xa,%esi
+    1166:	48 89 c7             	mov    %rax,%rdi
+    1169:	e8 b9 02 00 00       	call   1427 <nel::operator<<(nel::Log&, char)>
+    ex2();
+    116e:	e8 ab 01 00 00       	call   131e <ex2()>
+    nel::log << "ex2:e" << '\n';
+    1173:	48 89 df             	mov    %rbx,%rdi
+    1176:	48 8d 35 db 0e 00 00 	lea    0xedb(%rip),%rsi        # 2058 <_IO_stdin_used+0x58>
+    117d:	e8 be 02 00 00       	call   1440 <nel::operator<<(nel::Log&, char const*)>
+    1182:	be 0a 00 00 00       	mov    $0xa,%esi
+    1187:	48 89 c7             	mov    %rax,%rdi
+    118a:	e8 98 02 00 00       	call   1427 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex3:b" << '\n';
+    118f:	48 89 df             	mov    %rbx,%rdi
+    1192:	48 8d 35 c5 0e 00 00 	lea    0xec5(%rip),%rsi        # 205e <_IO_stdin_used+0x5e>
+    1199:	e8 a2 02 00 00       	call   1440 <nel::operator<<(nel::Log&, char const*)>
+    119e:	be 0a 00 00 00       	mov    $0xa,%esi
+    11a3:	48 89 c7             	mov    %rax,%rdi
+    11a6:	e8 7c 02 00 00       	call   1427 <nel::operator<<(nel::Log&, char)>
+    ex3();
+    11ab:	e8 8e 01 00 00       	call   133e <ex3()>
+    nel::log << "ex3:e" << '\n';
+    11b0:	48 89 df             	mov    %rbx,%rdi
+    11b3:	48 8d 35 aa 0e 00 00 	lea    0xeaa(%rip),%rsi        # 2064 <_IO_stdin_used+0x64>
+    11ba:	e8 81 02 00 00       	call   1440 <nel::operator<<(nel::Log&, char const*)>
+    11bf:	be 0a 00 00 00       	mov    $0xa,%esi
+    11c4:	48 89 c7             	mov    %rax,%rdi
+    11c7:	e8 5b 02 00 00       	call   1427 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex4:b" << '\n';
+    11cc:	48 89 df             	mov    %rbx,%rdi
+    11cf:	48 8d 35 94 0e 00 00 	lea    0xe94(%rip),%rsi        # 206a <_IO_stdin_used+0x6a>
+    11d6:	e8 65 02 00 00       	call   1440 <nel::operator<<(nel::Log&, char const*)>
+    11db:	be 0a 00 00 00       	mov    $0xa,%esi
+    11e0:	48 89 c7             	mov    %rax,%rdi
+    11e3:	e8 3f 02 00 00       	call   1427 <nel::operator<<(nel::Log&, char)>
+    ex4();
+    11e8:	e8 8c 01 00 00       	call   1379 <ex4()>
+    nel::log << "ex4:e" << '\n';
+    11ed:	48 89 df             	mov    %rbx,%rdi
+    11f0:	48 8d 35 79 0e 00 00 	lea    0xe79(%rip),%rsi        # 2070 <_IO_stdin_used+0x70>
+    11f7:	e8 44 02 00 00       	call   1440 <nel::operator<<(nel::Log&, char const*)>
+    11fc:	be 0a 00 00 00       	mov    $0xa,%esi
+    1201:	48 89 c7             	mov    %rax,%rdi
+    1204:	e8 1e 02 00 00       	call   1427 <nel::operator<<(nel::Log&, char)>
+}
+    1209:	31 c0                	xor    %eax,%eax
+    120b:	5b                   	pop    %rbx
+    120c:	c3                   	ret
+    120d:	0f 1f 00             	nopl   (%rax)
+
+0000000000001210 <_start>:
+    1210:	31 ed                	xor    %ebp,%ebp
+    1212:	49 89 d1             	mov    %rdx,%r9
+    1215:	5e                   	pop    %rsi
+    1216:	48 89 e2             	mov    %rsp,%rdx
+    1219:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    121d:	50                   	push   %rax
+    121e:	54                   	push   %rsp
+    121f:	45 31 c0             	xor    %r8d,%r8d
+    1222:	31 c9                	xor    %ecx,%ecx
+    1224:	48 8d 3d e7 fe ff ff 	lea    -0x119(%rip),%rdi        # 1112 <main>
+    122b:	ff 15 8f 2d 00 00    	call   *0x2d8f(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    1231:	f4                   	hlt
+    1232:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1239:	00 00 00 
+    123c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001240 <deregister_tm_clones>:
+    1240:	    48 8d 3d e9 2d 00 00 	lea    0x2de9(%rip),%rdi        # 4030 <__TMC_END__>
+    1247:	    48 8d 05 e2 2d 00 00 	lea    0x2de2(%rip),%rax        # 4030 <__TMC_END__>
+    124e:	    48 39 f8             	cmp    %rdi,%rax
+    1251:	/-- 74 15                	je     1268 <deregister_tm_clones+0x28>
+    1253:	|   48 8b 05 6e 2d 00 00 	mov    0x2d6e(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    125a:	|   48 85 c0             	test   %rax,%rax
+    125d:	+-- 74 09                	je     1268 <deregister_tm_clones+0x28>
+    125f:	|   ff e0                	jmp    *%rax
+    1261:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1268:	\-> c3                   	ret
+    1269:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001270 <register_tm_clones>:
+    1270:	    48 8d 3d b9 2d 00 00 	lea    0x2db9(%rip),%rdi        # 4030 <__TMC_END__>
+    1277:	    48 8d 35 b2 2d 00 00 	lea    0x2db2(%rip),%rsi        # 4030 <__TMC_END__>
+    127e:	    48 29 fe             	sub    %rdi,%rsi
+    1281:	    48 89 f0             	mov    %rsi,%rax
+    1284:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1288:	    48 c1 f8 03          	sar    $0x3,%rax
+    128c:	    48 01 c6             	add    %rax,%rsi
+    128f:	    48 d1 fe             	sar    %rsi
+    1292:	/-- 74 14                	je     12a8 <register_tm_clones+0x38>
+    1294:	|   48 8b 05 3d 2d 00 00 	mov    0x2d3d(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    129b:	|   48 85 c0             	test   %rax,%rax
+    129e:	+-- 74 08                	je     12a8 <register_tm_clones+0x38>
+    12a0:	|   ff e0                	jmp    *%rax
+    12a2:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    12a8:	\-> c3                   	ret
+    12a9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000012b0 <__do_global_dtors_aux>:
+    12b0:	       f3 0f 1e fa          	endbr64
+    12b4:	       80 3d 8d 2d 00 00 00 	cmpb   $0x0,0x2d8d(%rip)        # 4048 <completed.0>
+    12bb:	/----- 75 2b                	jne    12e8 <__do_global_dtors_aux+0x38>
+    12bd:	|      55                   	push   %rbp
+    12be:	|      48 83 3d 1a 2d 00 00 	cmpq   $0x0,0x2d1a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    12c5:	|      00 
+    12c6:	|      48 89 e5             	mov    %rsp,%rbp
+    12c9:	|  /-- 74 0c                	je     12d7 <__do_global_dtors_aux+0x27>
+    12cb:	|  |   48 8b 3d 56 2d 00 00 	mov    0x2d56(%rip),%rdi        # 4028 <__dso_handle>
+    12d2:	|  |   e8 99 fd ff ff       	call   1070 <__cxa_finalize@plt>
+    12d7:	|  \-> e8 64 ff ff ff       	call   1240 <deregister_tm_clones>
+    12dc:	|      c6 05 65 2d 00 00 01 	movb   $0x1,0x2d65(%rip)        # 4048 <completed.0>
+    12e3:	|      5d                   	pop    %rbp
+    12e4:	|      c3                   	ret
+    12e5:	|      0f 1f 00             	nopl   (%rax)
+    12e8:	\----> c3                   	ret
+    12e9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000012f0 <frame_dummy>:
+    12f0:	f3 0f 1e fa          	endbr64
+    12f4:	e9 77 ff ff ff       	jmp    1270 <register_tm_clones>
+
+00000000000012f9 <_close_r>:
+#include <nel/defs.hh>
+    12f9:	83 c8 ff             	or     $0xffffffff,%eax
+    12fc:	c3                   	ret
+
+00000000000012fd <_fstat_r>:
+char const *T(char const *v)
+    12fd:	83 c8 ff             	or     $0xffffffff,%eax
+    1300:	c3                   	ret
+
+0000000000001301 <_kill_r>:
+}
+    1301:	83 c8 ff             	or     $0xffffffff,%eax
+    1304:	c3                   	ret
+
+0000000000001305 <_lseek_r>:
+{
+    1305:	83 c8 ff             	or     $0xffffffff,%eax
+    1308:	c3                   	ret
+
+0000000000001309 <_read_r>:
+    nel::Optional<char const *> a = nel::Some(T("ex1"));
+    1309:	83 c8 ff             	or     $0xffffffff,%eax
+    130c:	c3                   	ret
+
+000000000000130d <_write_r>:
+    nel::Optional<char const *> a = nel::Some(T("ex2"));
+    130d:	83 c8 ff             	or     $0xffffffff,%eax
+    1310:	c3                   	ret
+
+0000000000001311 <_getpid_r>:
+
+    1311:	83 c8 ff             	or     $0xffffffff,%eax
+    1314:	c3                   	ret
+
+0000000000001315 <_isatty_r>:
+void ex3()
+    1315:	83 c8 ff             	or     $0xffffffff,%eax
+    1318:	c3                   	ret
+
+0000000000001319 <T(char const*)>:
+{
+    1319:	48 89 f8             	mov    %rdi,%rax
+}
+    131c:	c3                   	ret
+
+000000000000131d <ex1()>:
+}
+    131d:	c3                   	ret
+
+000000000000131e <ex2()>:
+{
+    131e:	50                   	push   %rax
+    nel::log << a.is_some() << '\n';
+    131f:	be 01 00 00 00       	mov    $0x1,%esi
+    1324:	48 8d 3d 1e 2d 00 00 	lea    0x2d1e(%rip),%rdi        # 4049 <nel::log>
+    132b:	e8 8b 01 00 00       	call   14bb <nel::operator<<(nel::Log&, int)>
+    1330:	be 0a 00 00 00       	mov    $0xa,%esi
+}
+    1335:	5a                   	pop    %rdx
+    nel::log << a.is_some() << '\n';
+    1336:	48 89 c7             	mov    %rax,%rdi
+    1339:	e9 e9 00 00 00       	jmp    1427 <nel::operator<<(nel::Log&, char)>
+
+000000000000133e <ex3()>:
+{
+    133e:	48 83 ec 18          	sub    $0x18,%rsp
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+            : value_(forward<Type>(val))
+    1342:	48 8d 35 e6 0c 00 00 	lea    0xce6(%rip),%rsi        # 202f <_IO_stdin_used+0x2f>
+        constexpr V consume(Fn1 &&on_some, Fn2 &&on_none, Context const &ctx = Context())
+        {
+            // a consuming matcher..
+            // that moves the value to the closures..
+            auto tag = tag_;
+            tag_ = Tag::INVAL;
+    1349:	31 c0                	xor    %eax,%eax
+    nel::log << a.unwrap() << '\n';
+    134b:	48 8d 3d f7 2c 00 00 	lea    0x2cf7(%rip),%rdi        # 4049 <nel::log>
+    1352:	48 89 74 24 08       	mov    %rsi,0x8(%rsp)
+    1357:	89 04 24             	mov    %eax,(%rsp)
+    135a:	e8 e1 00 00 00       	call   1440 <nel::operator<<(nel::Log&, char const*)>
+    135f:	be 0a 00 00 00       	mov    $0xa,%esi
+    1364:	48 89 c7             	mov    %rax,%rdi
+    1367:	e8 bb 00 00 00       	call   1427 <nel::operator<<(nel::Log&, char)>
+}
+    136c:	48 89 e7             	mov    %rsp,%rdi
+    136f:	e8 78 00 00 00       	call   13ec <nel::Optional<char const*>::~Optional()>
+    1374:	48 83 c4 18          	add    $0x18,%rsp
+    1378:	c3                   	ret
+
+0000000000001379 <ex4()>:
+{
+    1379:	53                   	push   %rbx
+                         << "None)";
+                    return outs;
+                    break;
+                case Tag::SOME:
+                    outs << "Optional("
+                         << "Some(";
+    137a:	48 8d 1d c8 2c 00 00 	lea    0x2cc8(%rip),%rbx        # 4049 <nel::log>
+            tag_ = Tag::INVAL;
+    1381:	31 d2                	xor    %edx,%edx
+    1383:	48 8d 05 a5 0c 00 00 	lea    0xca5(%rip),%rax        # 202f <_IO_stdin_used+0x2f>
+                         << "Some(";
+    138a:	48 89 df             	mov    %rbx,%rdi
+    138d:	48 8d 35 9f 0c 00 00 	lea    0xc9f(%rip),%rsi        # 2033 <_IO_stdin_used+0x33>
+    1394:	48 83 ec 10          	sub    $0x10,%rsp
+            tag_ = Tag::INVAL;
+    1398:	89 14 24             	mov    %edx,(%rsp)
+    139b:	48 89 44 24 08       	mov    %rax,0x8(%rsp)
+                         << "Some(";
+    13a0:	e8 9b 00 00 00       	call   1440 <nel::operator<<(nel::Log&, char const*)>
+    13a5:	48 8d 35 91 0c 00 00 	lea    0xc91(%rip),%rsi        # 203d <_IO_stdin_used+0x3d>
+    13ac:	48 89 c7             	mov    %rax,%rdi
+    13af:	e8 8c 00 00 00       	call   1440 <nel::operator<<(nel::Log&, char const*)>
+                    outs << *val.some_;
+    13b4:	48 89 df             	mov    %rbx,%rdi
+    13b7:	be 01 00 00 00       	mov    $0x1,%esi
+    13bc:	e8 fa 00 00 00       	call   14bb <nel::operator<<(nel::Log&, int)>
+                    outs << "))";
+    13c1:	48 89 df             	mov    %rbx,%rdi
+    13c4:	48 8d 35 78 0c 00 00 	lea    0xc78(%rip),%rsi        # 2043 <_IO_stdin_used+0x43>
+    13cb:	e8 70 00 00 00       	call   1440 <nel::operator<<(nel::Log&, char const*)>
+    nel::log << a.map<bool>([](auto &&) -> bool { return true; }) << '\n';
+    13d0:	48 89 df             	mov    %rbx,%rdi
+    13d3:	be 0a 00 00 00       	mov    $0xa,%esi
+    13d8:	e8 4a 00 00 00       	call   1427 <nel::operator<<(nel::Log&, char)>
+}
+    13dd:	48 89 e7             	mov    %rsp,%rdi
+    13e0:	e8 07 00 00 00       	call   13ec <nel::Optional<char const*>::~Optional()>
+    13e5:	48 83 c4 10          	add    $0x10,%rsp
+    13e9:	5b                   	pop    %rbx
+    13ea:	c3                   	ret
+    13eb:	90                   	nop
+
+00000000000013ec <nel::Optional<char const*>::~Optional()>:
+            switch (tag_) { // optional::dtor
+    13ec:	    83 3f 02             	cmpl   $0x2,(%rdi)
+    13ef:	/-- 76 35                	jbe    1426 <nel::Optional<char const*>::~Optional()+0x3a>
+        constexpr ~Optional(void)
+    13f1:	|   48 83 ec 28          	sub    $0x28,%rsp
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    13f5:	|   48 8d 05 08 0c 00 00 	lea    0xc08(%rip),%rax        # 2004 <_IO_stdin_used+0x4>
+                    nel::panic("bad Optional");
+    13fc:	|   48 8d 3d 1f 0c 00 00 	lea    0xc1f(%rip),%rdi        # 2022 <_IO_stdin_used+0x22>
+    1403:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1408:	|   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    140d:	|   48 8d 05 fa 0b 00 00 	lea    0xbfa(%rip),%rax        # 200e <_IO_stdin_used+0xe>
+    1414:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1419:	|   c7 44 24 18 87 00 00 	movl   $0x87,0x18(%rsp)
+    1420:	|   00 
+    1421:	|   e8 8c fc ff ff       	call   10b2 <nel::panic(char const*, nel::Context const&)>
+    1426:	\-> c3                   	ret
+
+0000000000001427 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1427:	53                   	push   %rbx
+    1428:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    142b:	40 0f be fe          	movsbl %sil,%edi
+    142f:	48 8b 35 0a 2c 00 00 	mov    0x2c0a(%rip),%rsi        # 4040 <stderr@GLIBC_2.2.5>
+    1436:	e8 15 fc ff ff       	call   1050 <fputc@plt>
+    return outs;
+}
+    143b:	48 89 d8             	mov    %rbx,%rax
+    143e:	5b                   	pop    %rbx
+    143f:	c3                   	ret
+
+0000000000001440 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1440:	53                   	push   %rbx
+    1441:	48 89 fb             	mov    %rdi,%rbx
+    1444:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    1447:	48 8b 35 f2 2b 00 00 	mov    0x2bf2(%rip),%rsi        # 4040 <stderr@GLIBC_2.2.5>
+    144e:	e8 ed fb ff ff       	call   1040 <fputs@plt>
+    return outs;
+}
+    1453:	48 89 d8             	mov    %rbx,%rax
+    1456:	5b                   	pop    %rbx
+    1457:	c3                   	ret
+
+0000000000001458 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1458:	53                   	push   %rbx
+    1459:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    145c:	48 8b 3d dd 2b 00 00 	mov    0x2bdd(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+    1463:	40 0f b6 d6          	movzbl %sil,%edx
+    1467:	31 c0                	xor    %eax,%eax
+    1469:	48 8d 35 3e 0c 00 00 	lea    0xc3e(%rip),%rsi        # 20ae <_IO_stdin_used+0xae>
+    1470:	e8 eb fb ff ff       	call   1060 <fprintf@plt>
+    return outs;
+}
+    1475:	48 89 d8             	mov    %rbx,%rax
+    1478:	5b                   	pop    %rbx
+    1479:	c3                   	ret
+
+000000000000147a <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    147a:	53                   	push   %rbx
+    147b:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    147e:	48 8b 3d bb 2b 00 00 	mov    0x2bbb(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+    1485:	0f b7 d6             	movzwl %si,%edx
+    1488:	31 c0                	xor    %eax,%eax
+    148a:	48 8d 35 1d 0c 00 00 	lea    0xc1d(%rip),%rsi        # 20ae <_IO_stdin_used+0xae>
+    1491:	e8 ca fb ff ff       	call   1060 <fprintf@plt>
+    return outs;
+}
+    1496:	48 89 d8             	mov    %rbx,%rax
+    1499:	5b                   	pop    %rbx
+    149a:	c3                   	ret
+
+000000000000149b <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    149b:	53                   	push   %rbx
+    149c:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    149f:	48 8b 3d 9a 2b 00 00 	mov    0x2b9a(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+{
+    14a6:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    14a8:	31 c0                	xor    %eax,%eax
+    14aa:	48 8d 35 fd 0b 00 00 	lea    0xbfd(%rip),%rsi        # 20ae <_IO_stdin_used+0xae>
+    14b1:	e8 aa fb ff ff       	call   1060 <fprintf@plt>
+    return outs;
+}
+    14b6:	48 89 d8             	mov    %rbx,%rax
+    14b9:	5b                   	pop    %rbx
+    14ba:	c3                   	ret
+
+00000000000014bb <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    14bb:	53                   	push   %rbx
+    14bc:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    14bf:	48 8b 3d 7a 2b 00 00 	mov    0x2b7a(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+{
+    14c6:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    14c8:	31 c0                	xor    %eax,%eax
+    14ca:	48 8d 35 dd 0b 00 00 	lea    0xbdd(%rip),%rsi        # 20ae <_IO_stdin_used+0xae>
+    14d1:	e8 8a fb ff ff       	call   1060 <fprintf@plt>
+    return outs;
+}
+    14d6:	48 89 d8             	mov    %rbx,%rax
+    14d9:	5b                   	pop    %rbx
+    14da:	c3                   	ret
+
+00000000000014db <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    14db:	53                   	push   %rbx
+    14dc:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    14df:	48 8b 3d 5a 2b 00 00 	mov    0x2b5a(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+{
+    14e6:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    14e9:	31 c0                	xor    %eax,%eax
+    14eb:	48 8d 35 bf 0b 00 00 	lea    0xbbf(%rip),%rsi        # 20b1 <_IO_stdin_used+0xb1>
+    14f2:	e8 69 fb ff ff       	call   1060 <fprintf@plt>
+    return outs;
+}
+    14f7:	48 89 d8             	mov    %rbx,%rax
+    14fa:	5b                   	pop    %rbx
+    14fb:	c3                   	ret
+
+Disassembly of section .fini:
+
+00000000000014fc <_fini>:
+    14fc:	48 83 ec 08          	sub    $0x8,%rsp
+    1500:	48 83 c4 08          	add    $0x8,%rsp
+    1504:	c3                   	ret
@@ -0,0 +1,1267 @@
+
+target/minsize/examples/largestruct1_rc:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputc@plt>:
+    1060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 4018 <fputc@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <memcmp@plt>:
+    1070:	ff 25 aa 2f 00 00    	jmp    *0x2faa(%rip)        # 4020 <memcmp@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fprintf@plt>:
+    1080:	ff 25 a2 2f 00 00    	jmp    *0x2fa2(%rip)        # 4028 <fprintf@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <malloc@plt>:
+    1090:	ff 25 9a 2f 00 00    	jmp    *0x2f9a(%rip)        # 4030 <malloc@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <realloc@plt>:
+    10a0:	ff 25 92 2f 00 00    	jmp    *0x2f92(%rip)        # 4038 <realloc@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <memmove@plt>:
+    10b0:	ff 25 8a 2f 00 00    	jmp    *0x2f8a(%rip)        # 4040 <memmove@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010c0 <__cxa_finalize@plt>:
+    10c0:	ff 25 1a 2f 00 00    	jmp    *0x2f1a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10c6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010d0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10d0:	50                   	push   %rax
+    std::abort();
+    10d1:	e8 6a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010d6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10d6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10d7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10da:	4c 8d 0d c0 0f 00 00 	lea    0xfc0(%rip),%r9        # 20a1 <_IO_stdin_used+0xa1>
+    10e1:	31 c0                	xor    %eax,%eax
+    10e3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10e7:	4c 8b 07             	mov    (%rdi),%r8
+    10ea:	48 8d 35 b6 0f 00 00 	lea    0xfb6(%rip),%rsi        # 20a7 <_IO_stdin_used+0xa7>
+    10f1:	48 8b 3d 68 2f 00 00 	mov    0x2f68(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    10f8:	e8 83 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    10fd:	e8 3e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001102 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1102:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1106:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1109:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    110d:	31 c0                	xor    %eax,%eax
+    110f:	57                   	push   %rdi
+    1110:	48 8b 3d 49 2f 00 00 	mov    0x2f49(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1117:	4c 8d 0d 83 0f 00 00 	lea    0xf83(%rip),%r9        # 20a1 <_IO_stdin_used+0xa1>
+    111e:	4c 8b 06             	mov    (%rsi),%r8
+    1121:	48 8d 35 90 0f 00 00 	lea    0xf90(%rip),%rsi        # 20b8 <_IO_stdin_used+0xb8>
+    1128:	e8 53 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    112d:	e8 0e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001132 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1132:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1136:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1139:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    113d:	31 c0                	xor    %eax,%eax
+    113f:	57                   	push   %rdi
+    1140:	48 8b 3d 19 2f 00 00 	mov    0x2f19(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1147:	4c 8d 0d 7f 0f 00 00 	lea    0xf7f(%rip),%r9        # 20cd <_IO_stdin_used+0xcd>
+    114e:	4c 8b 06             	mov    (%rsi),%r8
+    1151:	48 8d 35 60 0f 00 00 	lea    0xf60(%rip),%rsi        # 20b8 <_IO_stdin_used+0xb8>
+    1158:	e8 23 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    115d:	e8 de fe ff ff       	call   1040 <abort@plt>
+
+0000000000001162 <main>:
+    RC1 rc1((uint8_t)0x67);
+
+    nel::log << rc1 << '\n';
+}
+
+int main() {}
+    1162:	31 c0                	xor    %eax,%eax
+    1164:	c3                   	ret
+    1165:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    116c:	00 00 00 
+    116f:	90                   	nop
+
+0000000000001170 <_start>:
+    1170:	31 ed                	xor    %ebp,%ebp
+    1172:	49 89 d1             	mov    %rdx,%r9
+    1175:	5e                   	pop    %rsi
+    1176:	48 89 e2             	mov    %rsp,%rdx
+    1179:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    117d:	50                   	push   %rax
+    117e:	54                   	push   %rsp
+    117f:	45 31 c0             	xor    %r8d,%r8d
+    1182:	31 c9                	xor    %ecx,%ecx
+    1184:	48 8d 3d d7 ff ff ff 	lea    -0x29(%rip),%rdi        # 1162 <main>
+    118b:	ff 15 2f 2e 00 00    	call   *0x2e2f(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    1191:	f4                   	hlt
+    1192:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1199:	00 00 00 
+    119c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000011a0 <deregister_tm_clones>:
+    11a0:	    48 8d 3d b1 2e 00 00 	lea    0x2eb1(%rip),%rdi        # 4058 <__TMC_END__>
+    11a7:	    48 8d 05 aa 2e 00 00 	lea    0x2eaa(%rip),%rax        # 4058 <__TMC_END__>
+    11ae:	    48 39 f8             	cmp    %rdi,%rax
+    11b1:	/-- 74 15                	je     11c8 <deregister_tm_clones+0x28>
+    11b3:	|   48 8b 05 0e 2e 00 00 	mov    0x2e0e(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    11ba:	|   48 85 c0             	test   %rax,%rax
+    11bd:	+-- 74 09                	je     11c8 <deregister_tm_clones+0x28>
+    11bf:	|   ff e0                	jmp    *%rax
+    11c1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    11c8:	\-> c3                   	ret
+    11c9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011d0 <register_tm_clones>:
+    11d0:	    48 8d 3d 81 2e 00 00 	lea    0x2e81(%rip),%rdi        # 4058 <__TMC_END__>
+    11d7:	    48 8d 35 7a 2e 00 00 	lea    0x2e7a(%rip),%rsi        # 4058 <__TMC_END__>
+    11de:	    48 29 fe             	sub    %rdi,%rsi
+    11e1:	    48 89 f0             	mov    %rsi,%rax
+    11e4:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    11e8:	    48 c1 f8 03          	sar    $0x3,%rax
+    11ec:	    48 01 c6             	add    %rax,%rsi
+    11ef:	    48 d1 fe             	sar    %rsi
+    11f2:	/-- 74 14                	je     1208 <register_tm_clones+0x38>
+    11f4:	|   48 8b 05 dd 2d 00 00 	mov    0x2ddd(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    11fb:	|   48 85 c0             	test   %rax,%rax
+    11fe:	+-- 74 08                	je     1208 <register_tm_clones+0x38>
+    1200:	|   ff e0                	jmp    *%rax
+    1202:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1208:	\-> c3                   	ret
+    1209:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001210 <__do_global_dtors_aux>:
+    1210:	       f3 0f 1e fa          	endbr64
+    1214:	       80 3d 4d 2e 00 00 00 	cmpb   $0x0,0x2e4d(%rip)        # 4068 <completed.0>
+    121b:	/----- 75 2b                	jne    1248 <__do_global_dtors_aux+0x38>
+    121d:	|      55                   	push   %rbp
+    121e:	|      48 83 3d ba 2d 00 00 	cmpq   $0x0,0x2dba(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1225:	|      00 
+    1226:	|      48 89 e5             	mov    %rsp,%rbp
+    1229:	|  /-- 74 0c                	je     1237 <__do_global_dtors_aux+0x27>
+    122b:	|  |   48 8b 3d 1e 2e 00 00 	mov    0x2e1e(%rip),%rdi        # 4050 <__dso_handle>
+    1232:	|  |   e8 89 fe ff ff       	call   10c0 <__cxa_finalize@plt>
+    1237:	|  \-> e8 64 ff ff ff       	call   11a0 <deregister_tm_clones>
+    123c:	|      c6 05 25 2e 00 00 01 	movb   $0x1,0x2e25(%rip)        # 4068 <completed.0>
+    1243:	|      5d                   	pop    %rbp
+    1244:	|      c3                   	ret
+    1245:	|      0f 1f 00             	nopl   (%rax)
+    1248:	\----> c3                   	ret
+    1249:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001250 <frame_dummy>:
+    1250:	f3 0f 1e fa          	endbr64
+    1254:	e9 77 ff ff ff       	jmp    11d0 <register_tm_clones>
+
+0000000000001259 <_close_r>:
+#include <nel/memory.hh> // move()
+    1259:	83 c8 ff             	or     $0xffffffff,%eax
+    125c:	c3                   	ret
+
+000000000000125d <_fstat_r>:
+
+    125d:	83 c8 ff             	or     $0xffffffff,%eax
+    1260:	c3                   	ret
+
+0000000000001261 <_kill_r>:
+nel::Log &operator<<(nel::Log &outs, RC1 const &v)
+    1261:	83 c8 ff             	or     $0xffffffff,%eax
+    1264:	c3                   	ret
+
+0000000000001265 <_lseek_r>:
+    outs << "RC1()";
+    1265:	83 c8 ff             	or     $0xffffffff,%eax
+    1268:	c3                   	ret
+
+0000000000001269 <_read_r>:
+    return outs;
+    1269:	83 c8 ff             	or     $0xffffffff,%eax
+    126c:	c3                   	ret
+
+000000000000126d <_write_r>:
+    U8Buf<256> v = U8Buf<256>((uint8_t)0x66);
+    126d:	83 c8 ff             	or     $0xffffffff,%eax
+    1270:	c3                   	ret
+
+0000000000001271 <_getpid_r>:
+    nel::log << rc1 << '\n';
+    1271:	83 c8 ff             	or     $0xffffffff,%eax
+    1274:	c3                   	ret
+
+0000000000001275 <_isatty_r>:
+}
+    1275:	83 c8 ff             	or     $0xffffffff,%eax
+    1278:	c3                   	ret
+
+0000000000001279 <operator<<(nel::Log&, nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc> const&)>:
+{
+    1279:	53                   	push   %rbx
+    outs << "RC1()";
+    127a:	48 8d 35 83 0d 00 00 	lea    0xd83(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+{
+    1281:	48 89 fb             	mov    %rdi,%rbx
+    outs << "RC1()";
+    1284:	e8 df 05 00 00       	call   1868 <nel::operator<<(nel::Log&, char const*)>
+}
+    1289:	48 89 d8             	mov    %rbx,%rax
+    128c:	5b                   	pop    %rbx
+    128d:	c3                   	ret
+
+000000000000128e <rc1()>:
+{
+    128e:	41 54                	push   %r12
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+        {
+            nel::elem::set(data_, f, N);
+    1290:	ba 00 01 00 00       	mov    $0x100,%edx
+    1295:	be 66 00 00 00       	mov    $0x66,%esi
+    outs << "RC1()";
+    129a:	4c 8d 25 c8 2d 00 00 	lea    0x2dc8(%rip),%r12        # 4069 <nel::log>
+{
+    12a1:	55                   	push   %rbp
+    12a2:	53                   	push   %rbx
+    12a3:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+    12aa:	48 89 e3             	mov    %rsp,%rbx
+    12ad:	48 89 df             	mov    %rbx,%rdi
+    12b0:	e8 1b 03 00 00       	call   15d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return *this;
+        }
+
+    public:
+        constexpr RC(Type &&v)
+            : node_(Node::create(move(v)))
+    12b5:	48 89 df             	mov    %rbx,%rdi
+    12b8:	e8 09 01 00 00       	call   13c6 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node* nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::create<U8Buf<256ul> >(U8Buf<256ul>&&)>
+    outs << "RC1()";
+    12bd:	4c 89 e7             	mov    %r12,%rdi
+    12c0:	48 8d 35 3d 0d 00 00 	lea    0xd3d(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    12c7:	48 89 c5             	mov    %rax,%rbp
+    12ca:	e8 99 05 00 00       	call   1868 <nel::operator<<(nel::Log&, char const*)>
+    nel::log << rc1 << '\n';
+    12cf:	be 0a 00 00 00       	mov    $0xa,%esi
+    12d4:	4c 89 e7             	mov    %r12,%rdi
+    12d7:	e8 73 05 00 00       	call   184f <nel::operator<<(nel::Log&, char)>
+            Node::release(node_);
+    12dc:	48 89 ef             	mov    %rbp,%rdi
+    12df:	e8 b9 02 00 00       	call   159d <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::release(nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node*)>
+            nel::elem::set(data_, 0xa5, N);
+    12e4:	48 89 df             	mov    %rbx,%rdi
+    12e7:	ba 00 01 00 00       	mov    $0x100,%edx
+    12ec:	be a5 00 00 00       	mov    $0xa5,%esi
+    12f1:	e8 da 02 00 00       	call   15d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    12f6:	48 81 c4 00 01 00 00 	add    $0x100,%rsp
+    12fd:	5b                   	pop    %rbx
+    12fe:	5d                   	pop    %rbp
+    12ff:	41 5c                	pop    %r12
+    1301:	c3                   	ret
+
+0000000000001302 <rc2()>:
+{
+    1302:	55                   	push   %rbp
+    outs << "RC1()";
+    1303:	48 8d 2d 5f 2d 00 00 	lea    0x2d5f(%rip),%rbp        # 4069 <nel::log>
+{
+    130a:	53                   	push   %rbx
+    130b:	48 83 ec 18          	sub    $0x18,%rsp
+            // Node created pre-grabbed.
+        }
+
+        template<typename... Args>
+        constexpr RC(Args &&...args)
+            : node_(Node::create(forward<Args>(args)...))
+    130f:	48 8d 7c 24 0f       	lea    0xf(%rsp),%rdi
+    RC1 rc1((uint8_t)0x67);
+    1314:	c6 44 24 0f 67       	movb   $0x67,0xf(%rsp)
+    1319:	e8 93 01 00 00       	call   14b1 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node* nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::create<unsigned char>(unsigned char&&)>
+    outs << "RC1()";
+    131e:	48 89 ef             	mov    %rbp,%rdi
+    1321:	48 8d 35 dc 0c 00 00 	lea    0xcdc(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    1328:	48 89 c3             	mov    %rax,%rbx
+    132b:	e8 38 05 00 00       	call   1868 <nel::operator<<(nel::Log&, char const*)>
+    nel::log << rc1 << '\n';
+    1330:	48 89 ef             	mov    %rbp,%rdi
+    1333:	be 0a 00 00 00       	mov    $0xa,%esi
+    1338:	e8 12 05 00 00       	call   184f <nel::operator<<(nel::Log&, char)>
+}
+    133d:	48 83 c4 18          	add    $0x18,%rsp
+            Node::release(node_);
+    1341:	48 89 df             	mov    %rbx,%rdi
+    1344:	5b                   	pop    %rbx
+    1345:	5d                   	pop    %rbp
+    1346:	e9 52 02 00 00       	jmp    159d <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::release(nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node*)>
+    134b:	90                   	nop
+
+000000000000134c <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+        };
+
+    public:
+        constexpr ~Result(void)
+        {
+            switch (tag_) { // result::dtor
+    134c:	    83 3f 02             	cmpl   $0x2,(%rdi)
+    134f:	/-- 76 35                	jbe    1386 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x3a>
+        constexpr ~Result(void)
+    1351:	|   48 83 ec 28          	sub    $0x28,%rsp
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1355:	|   48 8d 05 ae 0c 00 00 	lea    0xcae(%rip),%rax        # 200a <_IO_stdin_used+0xa>
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob. But, want to abort/panic
+                    // if a unhandled case is encountered at runtime, much how a default hander
+                    // would work if it was present.
+                    nel::panic("bad Result");
+    135c:	|   48 8d 3d c1 0c 00 00 	lea    0xcc1(%rip),%rdi        # 2024 <_IO_stdin_used+0x24>
+    1363:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1368:	|   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    136d:	|   48 8d 05 9e 0c 00 00 	lea    0xc9e(%rip),%rax        # 2012 <_IO_stdin_used+0x12>
+    1374:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1379:	|   c7 44 24 18 72 00 00 	movl   $0x72,0x18(%rsp)
+    1380:	|   00 
+    1381:	|   e8 7c fd ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+    1386:	\-> c3                   	ret
+    1387:	    90                   	nop
+
+0000000000001388 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>:
+        template<typename V, typename Fn1, typename Fn2>
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+        {
+            // a consuming matcher..
+            // that moves the value to the closures..
+            auto tag = tag_;
+    1388:	          8b 07                	mov    (%rdi),%eax
+            tag_ = Tag::INVAL;
+    138a:	          31 c9                	xor    %ecx,%ecx
+    138c:	          89 0f                	mov    %ecx,(%rdi)
+            switch (tag) { // result-consume
+    138e:	          83 f8 01             	cmp    $0x1,%eax
+    1391:	/-------- 74 2e                	je     13c1 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)+0x39>
+         * @return if Ok, value wrapped/contained.
+         * @return if not Ok, calls abort, there is no return.
+         *
+         * `this` is consumed by the operation.
+         */
+        constexpr T unwrap(Context const &ctx = Context())
+    1393:	|         52                   	push   %rdx
+            switch (tag) { // result-consume
+    1394:	|         83 f8 02             	cmp    $0x2,%eax
+    1397:	|     /-- 74 10                	je     13a9 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)+0x21>
+    1399:	|     |   85 c0                	test   %eax,%eax
+    139b:	|  /--|-- 75 18                	jne    13b5 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)+0x2d>
+                    nel::panic("invalid Result", ctx);
+    139d:	|  |  |   48 8d 3d 95 0c 00 00 	lea    0xc95(%rip),%rdi        # 2039 <_IO_stdin_used+0x39>
+    13a4:	|  |  |   e8 59 fd ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+        {
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    13a9:	|  |  \-> 48 8d 3d 7f 0c 00 00 	lea    0xc7f(%rip),%rdi        # 202f <_IO_stdin_used+0x2f>
+    13b0:	|  |      e8 4d fd ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    13b5:	|  \----> 48 8d 3d 68 0c 00 00 	lea    0xc68(%rip),%rdi        # 2024 <_IO_stdin_used+0x24>
+    13bc:	|         e8 41 fd ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+                              ctx);
+    13c1:	\-------> 48 8b 47 08          	mov    0x8(%rdi),%rax
+        }
+    13c5:	          c3                   	ret
+
+00000000000013c6 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node* nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::create<U8Buf<256ul> >(U8Buf<256ul>&&)>:
+                static Node *create(Args &&...args)
+    13c6:	       41 54                	push   %r12
+    13c8:	       55                   	push   %rbp
+    13c9:	       48 89 fd             	mov    %rdi,%rbp
+            if (align == 0 || (align & (align - 1)) != 0) {
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+            }
+            void *const new_p = is_over_aligned(align)
+                                    ? realloc_aligned(p, align, old_size, new_size)
+                                    : std::realloc(p, new_size);
+    13cc:	       bf 10 01 00 00       	mov    $0x110,%edi
+    13d1:	       48 83 ec 58          	sub    $0x58,%rsp
+    13d5:	       e8 b6 fc ff ff       	call   1090 <malloc@plt>
+            if (new_p == nullptr) {
+    13da:	       48 85 c0             	test   %rax,%rax
+    13dd:	/----- 75 12                	jne    13f1 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node* nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::create<U8Buf<256ul> >(U8Buf<256ul>&&)+0x2b>
+            : tag_(Tag::ERR)
+    13df:	|      c7 44 24 10 02 00 00 	movl   $0x2,0x10(%rsp)
+    13e6:	|      00 
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+            : value_(forward<Type>(val))
+    13e7:	|      c7 44 24 18 01 00 00 	movl   $0x1,0x18(%rsp)
+    13ee:	|      00 
+    13ef:	|  /-- eb 0d                	jmp    13fe <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node* nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::create<U8Buf<256ul> >(U8Buf<256ul>&&)+0x38>
+            : tag_(Tag::OK)
+    13f1:	\--|-> c7 44 24 10 01 00 00 	movl   $0x1,0x10(%rsp)
+    13f8:	   |   00 
+        {
+        }
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+            : value_(forward<Args>(args)...)
+    13f9:	   |   48 89 44 24 18       	mov    %rax,0x18(%rsp)
+            , file_name_(file_name)
+    13fe:	   \-> 48 8d 05 57 0c 00 00 	lea    0xc57(%rip),%rax        # 205c <_IO_stdin_used+0x5c>
+            : fn_name_(fn_name)
+    1405:	       48 8d 15 3c 0c 00 00 	lea    0xc3c(%rip),%rdx        # 2048 <_IO_stdin_used+0x48>
+            , line_num_(line_num)
+    140c:	       c7 44 24 48 4c 00 00 	movl   $0x4c,0x48(%rsp)
+    1413:	       00 
+            , file_name_(file_name)
+    1414:	       48 89 44 24 40       	mov    %rax,0x40(%rsp)
+    1419:	       48 8d 74 24 38       	lea    0x38(%rsp),%rsi
+    141e:	       48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    1423:	       8b 44 24 10          	mov    0x10(%rsp),%eax
+            : fn_name_(fn_name)
+    1427:	       48 89 54 24 38       	mov    %rdx,0x38(%rsp)
+            switch (tag_) { // result-match
+    142c:	       83 f8 01             	cmp    $0x1,%eax
+    142f:	       48 89 54 24 20       	mov    %rdx,0x20(%rsp)
+            , line_num_(line_num)
+    1434:	       c7 44 24 30 4c 00 00 	movl   $0x4c,0x30(%rsp)
+    143b:	       00 
+    143c:	/----- 74 28                	je     1466 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node* nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::create<U8Buf<256ul> >(U8Buf<256ul>&&)+0xa0>
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx = Context());
+
+inline void panic_if(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (pred) { panic(msg, ctx); }
+    143e:	|      48 8d 3d 2c 0c 00 00 	lea    0xc2c(%rip),%rdi        # 2071 <_IO_stdin_used+0x71>
+    1445:	|      83 f8 02             	cmp    $0x2,%eax
+    1448:	|  /-- 74 17                	je     1461 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node* nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::create<U8Buf<256ul> >(U8Buf<256ul>&&)+0x9b>
+    144a:	|  |   85 c0                	test   %eax,%eax
+                    nel::panic("invalid Result", ctx);
+    144c:	|  |   48 8d 3d e6 0b 00 00 	lea    0xbe6(%rip),%rdi        # 2039 <_IO_stdin_used+0x39>
+    1453:	|  |   48 8d 74 24 20       	lea    0x20(%rsp),%rsi
+            switch (tag_) { // result-match
+    1458:	|  +-- 74 07                	je     1461 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node* nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::create<U8Buf<256ul> >(U8Buf<256ul>&&)+0x9b>
+                    nel::panic("bad Result", ctx);
+    145a:	|  |   48 8d 3d c3 0b 00 00 	lea    0xbc3(%rip),%rdi        # 2024 <_IO_stdin_used+0x24>
+    1461:	|  \-> e8 9c fc ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+                    return new (r.unwrap()) Node(forward<Args>(args)...);
+    1466:	\----> 4c 8d 64 24 10       	lea    0x10(%rsp),%r12
+            , line_num_(line_num)
+    146b:	       c7 44 24 48 4d 00 00 	movl   $0x4d,0x48(%rsp)
+    1472:	       00 
+    1473:	       4c 89 e7             	mov    %r12,%rdi
+    1476:	       e8 0d ff ff ff       	call   1388 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+            nel::elem::move(data_, o.data_, N);
+    147b:	       48 89 ee             	mov    %rbp,%rsi
+    147e:	       ba 00 01 00 00       	mov    $0x100,%edx
+                    : n_refs_(1)
+    1483:	       48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+            : value_(forward<Type>(val))
+    148a:	       48 8d 78 09          	lea    0x9(%rax),%rdi
+                    , has_value_(true)
+    148e:	       c6 40 08 01          	movb   $0x1,0x8(%rax)
+    1492:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1497:	       e8 3c 01 00 00       	call   15d8 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+                }
+    149c:	       4c 89 e7             	mov    %r12,%rdi
+    149f:	       e8 a8 fe ff ff       	call   134c <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+                    return new (r.unwrap()) Node(forward<Args>(args)...);
+    14a4:	       48 8b 44 24 08       	mov    0x8(%rsp),%rax
+                }
+    14a9:	       48 83 c4 58          	add    $0x58,%rsp
+    14ad:	       5d                   	pop    %rbp
+    14ae:	       41 5c                	pop    %r12
+    14b0:	       c3                   	ret
+
+00000000000014b1 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node* nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::create<unsigned char>(unsigned char&&)>:
+                static Node *create(Args &&...args)
+    14b1:	       41 54                	push   %r12
+    14b3:	       55                   	push   %rbp
+    14b4:	       48 89 fd             	mov    %rdi,%rbp
+                                    : std::realloc(p, new_size);
+    14b7:	       bf 10 01 00 00       	mov    $0x110,%edi
+    14bc:	       48 83 ec 58          	sub    $0x58,%rsp
+    14c0:	       e8 cb fb ff ff       	call   1090 <malloc@plt>
+            if (new_p == nullptr) {
+    14c5:	       48 85 c0             	test   %rax,%rax
+    14c8:	/----- 75 12                	jne    14dc <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node* nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::create<unsigned char>(unsigned char&&)+0x2b>
+            : tag_(Tag::ERR)
+    14ca:	|      c7 44 24 10 02 00 00 	movl   $0x2,0x10(%rsp)
+    14d1:	|      00 
+    14d2:	|      c7 44 24 18 01 00 00 	movl   $0x1,0x18(%rsp)
+    14d9:	|      00 
+    14da:	|  /-- eb 0d                	jmp    14e9 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node* nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::create<unsigned char>(unsigned char&&)+0x38>
+            : tag_(Tag::OK)
+    14dc:	\--|-> c7 44 24 10 01 00 00 	movl   $0x1,0x10(%rsp)
+    14e3:	   |   00 
+            : value_(forward<Args>(args)...)
+    14e4:	   |   48 89 44 24 18       	mov    %rax,0x18(%rsp)
+            , file_name_(file_name)
+    14e9:	   \-> 48 8d 05 6c 0b 00 00 	lea    0xb6c(%rip),%rax        # 205c <_IO_stdin_used+0x5c>
+            : fn_name_(fn_name)
+    14f0:	       48 8d 15 94 0b 00 00 	lea    0xb94(%rip),%rdx        # 208b <_IO_stdin_used+0x8b>
+            , line_num_(line_num)
+    14f7:	       c7 44 24 48 4c 00 00 	movl   $0x4c,0x48(%rsp)
+    14fe:	       00 
+            , file_name_(file_name)
+    14ff:	       48 89 44 24 40       	mov    %rax,0x40(%rsp)
+    1504:	       48 8d 74 24 38       	lea    0x38(%rsp),%rsi
+    1509:	       48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    150e:	       8b 44 24 10          	mov    0x10(%rsp),%eax
+            : fn_name_(fn_name)
+    1512:	       48 89 54 24 38       	mov    %rdx,0x38(%rsp)
+            switch (tag_) { // result-match
+    1517:	       83 f8 01             	cmp    $0x1,%eax
+    151a:	       48 89 54 24 20       	mov    %rdx,0x20(%rsp)
+            , line_num_(line_num)
+    151f:	       c7 44 24 30 4c 00 00 	movl   $0x4c,0x30(%rsp)
+    1526:	       00 
+    1527:	/----- 74 28                	je     1551 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node* nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::create<unsigned char>(unsigned char&&)+0xa0>
+    if (pred) { panic(msg, ctx); }
+    1529:	|      48 8d 3d 41 0b 00 00 	lea    0xb41(%rip),%rdi        # 2071 <_IO_stdin_used+0x71>
+    1530:	|      83 f8 02             	cmp    $0x2,%eax
+    1533:	|  /-- 74 17                	je     154c <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node* nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::create<unsigned char>(unsigned char&&)+0x9b>
+    1535:	|  |   85 c0                	test   %eax,%eax
+                    nel::panic("invalid Result", ctx);
+    1537:	|  |   48 8d 3d fb 0a 00 00 	lea    0xafb(%rip),%rdi        # 2039 <_IO_stdin_used+0x39>
+    153e:	|  |   48 8d 74 24 20       	lea    0x20(%rsp),%rsi
+            switch (tag_) { // result-match
+    1543:	|  +-- 74 07                	je     154c <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node* nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::create<unsigned char>(unsigned char&&)+0x9b>
+                    nel::panic("bad Result", ctx);
+    1545:	|  |   48 8d 3d d8 0a 00 00 	lea    0xad8(%rip),%rdi        # 2024 <_IO_stdin_used+0x24>
+    154c:	|  \-> e8 b1 fb ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+                    return new (r.unwrap()) Node(forward<Args>(args)...);
+    1551:	\----> 4c 8d 64 24 10       	lea    0x10(%rsp),%r12
+            , line_num_(line_num)
+    1556:	       c7 44 24 48 4d 00 00 	movl   $0x4d,0x48(%rsp)
+    155d:	       00 
+    155e:	       4c 89 e7             	mov    %r12,%rdi
+    1561:	       e8 22 fe ff ff       	call   1388 <nel::Result<void*, nel::heaped::AllocError>::unwrap(nel::Context const&)>
+            nel::elem::set(data_, f, N);
+    1566:	       ba 00 01 00 00       	mov    $0x100,%edx
+                    : n_refs_(1)
+    156b:	       48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+                    , value_(forward<Args>(args)...)
+    1572:	       48 8d 78 09          	lea    0x9(%rax),%rdi
+                    , has_value_(true)
+    1576:	       c6 40 08 01          	movb   $0x1,0x8(%rax)
+    157a:	       0f b6 75 00          	movzbl 0x0(%rbp),%esi
+                    , value_(forward<Args>(args)...)
+    157e:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1583:	       e8 48 00 00 00       	call   15d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+                }
+    1588:	       4c 89 e7             	mov    %r12,%rdi
+    158b:	       e8 bc fd ff ff       	call   134c <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+                    return new (r.unwrap()) Node(forward<Args>(args)...);
+    1590:	       48 8b 44 24 08       	mov    0x8(%rsp),%rax
+                }
+    1595:	       48 83 c4 58          	add    $0x58,%rsp
+    1599:	       5d                   	pop    %rbp
+    159a:	       41 5c                	pop    %r12
+    159c:	       c3                   	ret
+
+000000000000159d <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::release(nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node*)>:
+                    if (v != nullptr) {
+    159d:	       48 85 ff             	test   %rdi,%rdi
+    15a0:	/----- 74 27                	je     15c9 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::release(nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node*)+0x2c>
+                constexpr static void release(Node *const v)
+    15a2:	|      53                   	push   %rbx
+    15a3:	|      48 89 fb             	mov    %rdi,%rbx
+                        v->n_refs_ -= 1;
+    15a6:	|      48 ff 0f             	decq   (%rdi)
+                        if (v->n_refs_ == 0) {
+    15a9:	|  /-- 75 1c                	jne    15c7 <nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node::release(nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc>::Node*)+0x2a>
+        constexpr ~Element(void) = default;
+    15ab:	|  |   48 8d 7f 09          	lea    0x9(%rdi),%rdi
+            nel::elem::set(data_, 0xa5, N);
+    15af:	|  |   ba 00 01 00 00       	mov    $0x100,%edx
+    15b4:	|  |   be a5 00 00 00       	mov    $0xa5,%esi
+    15b9:	|  |   e8 12 00 00 00       	call   15d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    15be:	|  |   48 89 df             	mov    %rbx,%rdi
+                }
+    15c1:	|  |   5b                   	pop    %rbx
+    15c2:	|  |   e9 69 fa ff ff       	jmp    1030 <free@plt>
+    15c7:	|  \-> 5b                   	pop    %rbx
+    15c8:	|      c3                   	ret
+    15c9:	\----> c3                   	ret
+
+00000000000015ca <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    15ca:	48 89 d1             	mov    %rdx,%rcx
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    15cd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    15cf:	c3                   	ret
+
+00000000000015d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    15d0:	48 89 d1             	mov    %rdx,%rcx
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    15d3:	89 f0                	mov    %esi,%eax
+    15d5:	f3 aa                	rep stos %al,%es:(%rdi)
+}
+    15d7:	c3                   	ret
+
+00000000000015d8 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    15d8:	48 89 d1             	mov    %rdx,%rcx
+    15db:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    15dd:	c3                   	ret
+
+00000000000015de <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    15de:	e9 cd fa ff ff       	jmp    10b0 <memmove@plt>
+
+00000000000015e3 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    15e3:	48 89 f1             	mov    %rsi,%rcx
+    std::memset(d, s, n);
+    15e6:	b0 a5                	mov    $0xa5,%al
+    15e8:	f3 aa                	rep stos %al,%es:(%rdi)
+    set(d, 0xa5, n);
+}
+    15ea:	c3                   	ret
+
+00000000000015eb <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    15eb:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    15ec:	e8 7f fa ff ff       	call   1070 <memcmp@plt>
+}
+    15f1:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) == 0;
+    15f2:	85 c0                	test   %eax,%eax
+    15f4:	0f 94 c0             	sete   %al
+}
+    15f7:	c3                   	ret
+
+00000000000015f8 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    15f8:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    15f9:	e8 72 fa ff ff       	call   1070 <memcmp@plt>
+}
+    15fe:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) != 0;
+    15ff:	85 c0                	test   %eax,%eax
+    1601:	0f 95 c0             	setne  %al
+}
+    1604:	c3                   	ret
+
+0000000000001605 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+{
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1605:	          49 89 fa             	mov    %rdi,%r10
+    1608:	          48 89 f0             	mov    %rsi,%rax
+    if (n < streaming_min) {
+    160b:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1612:	      /-- 77 05                	ja     1619 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14>
+    std::memcpy(d, s, n);
+    1614:	      |   48 89 d1             	mov    %rdx,%rcx
+    1617:	/-----|-- eb 79                	jmp    1692 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x8d>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1619:	|     \-> 48 89 f9             	mov    %rdi,%rcx
+    161c:	|         48 f7 d9             	neg    %rcx
+    161f:	|         83 e1 0f             	and    $0xf,%ecx
+    1622:	|         49 89 c8             	mov    %rcx,%r8
+    std::memcpy(d, s, n);
+    1625:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1627:	|         49 8d 70 40          	lea    0x40(%r8),%rsi
+    162b:	|         48 89 f9             	mov    %rdi,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    162e:	|     /-> 0f 10 54 30 d0       	movups -0x30(%rax,%rsi,1),%xmm2
+    1633:	|     |   0f 10 4c 30 e0       	movups -0x20(%rax,%rsi,1),%xmm1
+    1638:	|     |   49 89 f0             	mov    %rsi,%r8
+    for (; i + 64 <= n; i += 64) {
+    163b:	|     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    163f:	|     |   0f 10 44 30 f0       	movups -0x10(%rax,%rsi,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1644:	|     |   0f 10 5c 30 c0       	movups -0x40(%rax,%rsi,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    1649:	|     |   48 83 c6 40          	add    $0x40,%rsi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    164d:	|     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    1652:	|     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    1657:	|     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    165c:	|     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    1661:	|     |   48 39 f2             	cmp    %rsi,%rdx
+    1664:	|     \-- 73 c8                	jae    162e <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x29>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    1666:	|  /----> 49 8d 48 10          	lea    0x10(%r8),%rcx
+        stream16(d + i, load16(s + i));
+    166a:	|  |      4f 8d 0c 02          	lea    (%r10,%r8,1),%r9
+    for (; i + 16 <= n; i += 16) {
+    166e:	|  |      48 39 ca             	cmp    %rcx,%rdx
+    1671:	|  |  /-- 72 0f                	jb     1682 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x7d>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1673:	|  |  |   0f 10 64 08 f0       	movups -0x10(%rax,%rcx,1),%xmm4
+    1678:	|  |  |   49 89 c8             	mov    %rcx,%r8
+    167b:	|  |  |   66 41 0f e7 21       	movntdq %xmm4,(%r9)
+    for (; i + 16 <= n; i += 16) {
+    1680:	|  \--|-- eb e4                	jmp    1666 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x61>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    1682:	|     \-> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    1685:	|         4c 29 c2             	sub    %r8,%rdx
+        stream16(d + i, load16(s + i));
+    1688:	|         4a 8d 34 00          	lea    (%rax,%r8,1),%rsi
+    std::memcpy(d, s, n);
+    168c:	|         4c 89 cf             	mov    %r9,%rdi
+    copy(d + i, s + i, n - i);
+    168f:	|         48 89 d1             	mov    %rdx,%rcx
+    std::memcpy(d, s, n);
+    1692:	\-------> f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1694:	          c3                   	ret
+
+0000000000001695 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    1695:	          49 89 f8             	mov    %rdi,%r8
+    if (n < streaming_min) {
+    1698:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    169f:	/-------- 77 37                	ja     16d8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x43>
+    Length done = (n < 16) ? n : 16;
+    16a1:	|         b8 10 00 00 00       	mov    $0x10,%eax
+    16a6:	|         48 39 c2             	cmp    %rax,%rdx
+    16a9:	|         48 0f 46 c2          	cmovbe %rdx,%rax
+    std::memcpy(d, s, n);
+    16ad:	|         89 c1                	mov    %eax,%ecx
+    16af:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    16b1:	|  /----> 48 39 d0             	cmp    %rdx,%rax
+    16b4:	|  |  /-- 73 21                	jae    16d7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42>
+        Length const m = (done < n - done) ? done : n - done;
+    16b6:	|  |  |   49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    16b9:	|  |  |   4d 8d 14 00          	lea    (%r8,%rax,1),%r10
+    std::memcpy(d, s, n);
+    16bd:	|  |  |   4c 89 c6             	mov    %r8,%rsi
+        Length const m = (done < n - done) ? done : n - done;
+    16c0:	|  |  |   49 29 c1             	sub    %rax,%r9
+    std::memcpy(d, s, n);
+    16c3:	|  |  |   4c 89 d7             	mov    %r10,%rdi
+        Length const m = (done < n - done) ? done : n - done;
+    16c6:	|  |  |   49 39 c1             	cmp    %rax,%r9
+    16c9:	|  |  |   4c 0f 47 c8          	cmova  %rax,%r9
+    std::memcpy(d, s, n);
+    16cd:	|  |  |   44 89 c9             	mov    %r9d,%ecx
+        done += m;
+    16d0:	|  |  |   4c 01 c8             	add    %r9,%rax
+    std::memcpy(d, s, n);
+    16d3:	|  |  |   f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+        done += m;
+    16d5:	|  \--|-- eb da                	jmp    16b1 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c>
+    16d7:	|     \-> c3                   	ret
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    16d8:	\-------> 48 89 f8             	mov    %rdi,%rax
+    for (Index i = 0; i < head; ++i) {
+    16db:	          31 c9                	xor    %ecx,%ecx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    16dd:	          48 f7 d8             	neg    %rax
+    16e0:	          83 e0 0f             	and    $0xf,%eax
+    for (Index i = 0; i < head; ++i) {
+    16e3:	   /----> 48 39 c1             	cmp    %rax,%rcx
+    16e6:	   |  /-- 74 0d                	je     16f5 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x60>
+        d[i] = p[i];
+    16e8:	   |  |   40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+    16ec:	   |  |   41 88 3c 08          	mov    %dil,(%r8,%rcx,1)
+    for (Index i = 0; i < head; ++i) {
+    16f0:	   |  |   48 ff c1             	inc    %rcx
+    16f3:	   \--|-- eb ee                	jmp    16e3 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4e>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    16f5:	      \-> 31 c9                	xor    %ecx,%ecx
+        rotated[i] = p[(head + i) % 16];
+    16f7:	      /-> 48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+    16fb:	      |   83 e7 0f             	and    $0xf,%edi
+    16fe:	      |   40 8a 3c 3e          	mov    (%rsi,%rdi,1),%dil
+    1702:	      |   40 88 7c 0c e8       	mov    %dil,-0x18(%rsp,%rcx,1)
+    for (Index i = 0; i < 16; ++i) {
+    1707:	      |   48 ff c1             	inc    %rcx
+    170a:	      |   48 83 f9 10          	cmp    $0x10,%rcx
+    170e:	      \-- 75 e7                	jne    16f7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x62>
+    std::memcpy(&v, s, sizeof(v));
+    1710:	          0f 28 44 24 e8       	movaps -0x18(%rsp),%xmm0
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1715:	          48 8d 78 40          	lea    0x40(%rax),%rdi
+    1719:	          4c 01 c0             	add    %r8,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    171c:	      /-> 48 89 f9             	mov    %rdi,%rcx
+    for (; i + 64 <= n; i += 64) {
+    171f:	      |   48 8d 7f 40          	lea    0x40(%rdi),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1723:	      |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    1727:	      |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    172c:	      |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    1731:	      |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    1736:	      |   48 83 c0 40          	add    $0x40,%rax
+    173a:	      |   48 39 fa             	cmp    %rdi,%rdx
+    173d:	      \-- 73 dd                	jae    171c <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x87>
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+        stream16(d + i, v);
+    173f:	          49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    for (; i + 16 <= n; i += 16) {
+    1743:	   /----> 48 8d 41 10          	lea    0x10(%rcx),%rax
+    1747:	   |      48 39 c2             	cmp    %rax,%rdx
+    174a:	   |  /-- 72 0a                	jb     1756 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc1>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    174c:	   |  |   48 89 c1             	mov    %rax,%rcx
+    174f:	   |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    1754:	   \--|-- eb ed                	jmp    1743 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xae>
+    }
+    __builtin_ia32_sfence();
+    1756:	      \-> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    1759:	   /----> 48 39 d1             	cmp    %rdx,%rcx
+    175c:	   |  /-- 73 12                	jae    1770 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xdb>
+        d[i] = p[i % 16];
+    175e:	   |  |   48 89 c8             	mov    %rcx,%rax
+    1761:	   |  |   83 e0 0f             	and    $0xf,%eax
+    1764:	   |  |   8a 04 06             	mov    (%rsi,%rax,1),%al
+    1767:	   |  |   41 88 04 08          	mov    %al,(%r8,%rcx,1)
+    for (; i < n; ++i) {
+    176b:	   |  |   48 ff c1             	inc    %rcx
+    176e:	   \--|-- eb e9                	jmp    1759 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc4>
+    }
+}
+    1770:	      \-> c3                   	ret
+
+0000000000001771 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    1771:	    48 85 ff             	test   %rdi,%rdi
+    1774:	/-- 74 09                	je     177f <nel::free_aligned(void*)+0xe>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    1776:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    177a:	|   e9 b1 f8 ff ff       	jmp    1030 <free@plt>
+}
+    177f:	\-> c3                   	ret
+
+0000000000001780 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    1780:	       41 56                	push   %r14
+            : fn_name_(fn_name)
+    1782:	       48 8d 05 50 09 00 00 	lea    0x950(%rip),%rax        # 20d9 <_IO_stdin_used+0xd9>
+    1789:	       41 55                	push   %r13
+    178b:	       41 54                	push   %r12
+    178d:	       55                   	push   %rbp
+    178e:	       53                   	push   %rbx
+    178f:	       48 83 ec 20          	sub    $0x20,%rsp
+    1793:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , file_name_(file_name)
+    1798:	       48 8d 05 4a 09 00 00 	lea    0x94a(%rip),%rax        # 20e9 <_IO_stdin_used+0xe9>
+    179f:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    17a4:	       c7 44 24 18 f3 00 00 	movl   $0xf3,0x18(%rsp)
+    17ab:	       00 
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    17ac:	       48 85 f6             	test   %rsi,%rsi
+    17af:	/----- 74 28                	je     17d9 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    17b1:	|      4c 8d 66 ff          	lea    -0x1(%rsi),%r12
+    17b5:	|      48 89 f3             	mov    %rsi,%rbx
+    17b8:	|      49 21 f4             	and    %rsi,%r12
+    17bb:	+----- 75 1c                	jne    17d9 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    17bd:	|      49 89 fd             	mov    %rdi,%r13
+    17c0:	|      49 89 d6             	mov    %rdx,%r14
+    17c3:	|      48 89 cd             	mov    %rcx,%rbp
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    17c6:	|      31 ff                	xor    %edi,%edi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    17c8:	|      4d 85 ed             	test   %r13,%r13
+    17cb:	|  /-- 74 1d                	je     17ea <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+    17cd:	|  |   4d 8b 65 f8          	mov    -0x8(%r13),%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    17d1:	|  |   4c 89 ef             	mov    %r13,%rdi
+    17d4:	|  |   4c 29 e7             	sub    %r12,%rdi
+    17d7:	|  +-- eb 11                	jmp    17ea <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    17d9:	\--|-> 48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    17de:	   |   48 8d 3d 16 09 00 00 	lea    0x916(%rip),%rdi        # 20fb <_IO_stdin_used+0xfb>
+    17e5:	   |   e8 48 f9 ff ff       	call   1132 <nel::assert_fail(char const*, nel::Context const&)>
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    17ea:	   \-> 48 8d 34 2b          	lea    (%rbx,%rbp,1),%rsi
+    17ee:	       e8 ad f8 ff ff       	call   10a0 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    17f3:	       48 85 c0             	test   %rax,%rax
+    17f6:	/----- 74 3b                	je     1833 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb3>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    17f8:	|      48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    17fd:	|      48 f7 db             	neg    %rbx
+    1800:	|      48 21 d9             	and    %rbx,%rcx
+    1803:	|      48 89 cb             	mov    %rcx,%rbx
+    1806:	|      48 29 c3             	sub    %rax,%rbx
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    1809:	|      4d 85 ed             	test   %r13,%r13
+    180c:	|  /-- 74 1e                	je     182c <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+    180e:	|  |   49 39 dc             	cmp    %rbx,%r12
+    1811:	|  +-- 74 19                	je     182c <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    1813:	|  |   4c 39 f5             	cmp    %r14,%rbp
+    1816:	|  |   4c 89 f2             	mov    %r14,%rdx
+    1819:	|  |   4a 8d 34 20          	lea    (%rax,%r12,1),%rsi
+    181d:	|  |   48 89 cf             	mov    %rcx,%rdi
+    1820:	|  |   48 0f 46 d5          	cmovbe %rbp,%rdx
+    1824:	|  |   e8 87 f8 ff ff       	call   10b0 <memmove@plt>
+    1829:	|  |   48 89 c1             	mov    %rax,%rcx
+    }
+    offset_field(new_p) = new_offset;
+    182c:	|  \-> 48 89 59 f8          	mov    %rbx,-0x8(%rcx)
+    return new_p;
+    1830:	|      48 89 c8             	mov    %rcx,%rax
+}
+    1833:	\----> 48 83 c4 20          	add    $0x20,%rsp
+    1837:	       5b                   	pop    %rbx
+    1838:	       5d                   	pop    %rbp
+    1839:	       41 5c                	pop    %r12
+    183b:	       41 5d                	pop    %r13
+    183d:	       41 5e                	pop    %r14
+    183f:	       c3                   	ret
+
+0000000000001840 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    1840:	48 89 f1             	mov    %rsi,%rcx
+    return realloc_aligned(nullptr, align, 0, size);
+    1843:	31 d2                	xor    %edx,%edx
+    1845:	48 89 fe             	mov    %rdi,%rsi
+    1848:	31 ff                	xor    %edi,%edi
+    184a:	e9 31 ff ff ff       	jmp    1780 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+
+000000000000184f <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    184f:	53                   	push   %rbx
+    1850:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    1853:	40 0f be fe          	movsbl %sil,%edi
+    1857:	48 8b 35 02 28 00 00 	mov    0x2802(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    185e:	e8 fd f7 ff ff       	call   1060 <fputc@plt>
+    return outs;
+}
+    1863:	48 89 d8             	mov    %rbx,%rax
+    1866:	5b                   	pop    %rbx
+    1867:	c3                   	ret
+
+0000000000001868 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1868:	53                   	push   %rbx
+    1869:	48 89 fb             	mov    %rdi,%rbx
+    186c:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    186f:	48 8b 35 ea 27 00 00 	mov    0x27ea(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    1876:	e8 d5 f7 ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    187b:	48 89 d8             	mov    %rbx,%rax
+    187e:	5b                   	pop    %rbx
+    187f:	c3                   	ret
+
+0000000000001880 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1880:	53                   	push   %rbx
+    1881:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    1884:	48 8b 3d d5 27 00 00 	mov    0x27d5(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    188b:	40 0f b6 d6          	movzbl %sil,%edx
+    188f:	31 c0                	xor    %eax,%eax
+    1891:	48 8d 35 7e 08 00 00 	lea    0x87e(%rip),%rsi        # 2116 <_IO_stdin_used+0x116>
+    1898:	e8 e3 f7 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    189d:	48 89 d8             	mov    %rbx,%rax
+    18a0:	5b                   	pop    %rbx
+    18a1:	c3                   	ret
+
+00000000000018a2 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    18a2:	53                   	push   %rbx
+    18a3:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    18a6:	48 8b 3d b3 27 00 00 	mov    0x27b3(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    18ad:	0f b7 d6             	movzwl %si,%edx
+    18b0:	31 c0                	xor    %eax,%eax
+    18b2:	48 8d 35 5d 08 00 00 	lea    0x85d(%rip),%rsi        # 2116 <_IO_stdin_used+0x116>
+    18b9:	e8 c2 f7 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    18be:	48 89 d8             	mov    %rbx,%rax
+    18c1:	5b                   	pop    %rbx
+    18c2:	c3                   	ret
+
+00000000000018c3 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    18c3:	53                   	push   %rbx
+    18c4:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    18c7:	48 8b 3d 92 27 00 00 	mov    0x2792(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    18ce:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    18d0:	31 c0                	xor    %eax,%eax
+    18d2:	48 8d 35 3d 08 00 00 	lea    0x83d(%rip),%rsi        # 2116 <_IO_stdin_used+0x116>
+    18d9:	e8 a2 f7 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    18de:	48 89 d8             	mov    %rbx,%rax
+    18e1:	5b                   	pop    %rbx
+    18e2:	c3                   	ret
+
+00000000000018e3 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    18e3:	53                   	push   %rbx
+    18e4:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    18e7:	48 8b 3d 72 27 00 00 	mov    0x2772(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    18ee:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    18f0:	31 c0                	xor    %eax,%eax
+    18f2:	48 8d 35 1d 08 00 00 	lea    0x81d(%rip),%rsi        # 2116 <_IO_stdin_used+0x116>
+    18f9:	e8 82 f7 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    18fe:	48 89 d8             	mov    %rbx,%rax
+    1901:	5b                   	pop    %rbx
+    1902:	c3                   	ret
+
+0000000000001903 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    1903:	53                   	push   %rbx
+    1904:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    1907:	48 8b 3d 52 27 00 00 	mov    0x2752(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    190e:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    1911:	31 c0                	xor    %eax,%eax
+    1913:	48 8d 35 ff 07 00 00 	lea    0x7ff(%rip),%rsi        # 2119 <_IO_stdin_used+0x119>
+    191a:	e8 61 f7 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    191f:	48 89 d8             	mov    %rbx,%rax
+    1922:	5b                   	pop    %rbx
+    1923:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000001924 <_fini>:
+    1924:	48 83 ec 08          	sub    $0x8,%rsp
+    1928:	48 83 c4 08          	add    $0x8,%rsp
+    192c:	c3                   	ret
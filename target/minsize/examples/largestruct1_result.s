@@ -0,0 +1,1901 @@
+
+target/minsize/examples/largestruct1_result:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputc@plt>:
+    1060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 4018 <fputc@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <memcmp@plt>:
+    1070:	ff 25 aa 2f 00 00    	jmp    *0x2faa(%rip)        # 4020 <memcmp@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fprintf@plt>:
+    1080:	ff 25 a2 2f 00 00    	jmp    *0x2fa2(%rip)        # 4028 <fprintf@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <realloc@plt>:
+    1090:	ff 25 9a 2f 00 00    	jmp    *0x2f9a(%rip)        # 4030 <realloc@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memmove@plt>:
+    10a0:	ff 25 92 2f 00 00    	jmp    *0x2f92(%rip)        # 4038 <memmove@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010b0 <__cxa_finalize@plt>:
+    10b0:	ff 25 2a 2f 00 00    	jmp    *0x2f2a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10b6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010c0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10c0:	50                   	push   %rax
+    std::abort();
+    10c1:	e8 7a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010c6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10c6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10c7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10ca:	4c 8d 0d 25 10 00 00 	lea    0x1025(%rip),%r9        # 20f6 <_IO_stdin_used+0xf6>
+    10d1:	31 c0                	xor    %eax,%eax
+    10d3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10d7:	4c 8b 07             	mov    (%rdi),%r8
+    10da:	48 8d 35 1b 10 00 00 	lea    0x101b(%rip),%rsi        # 20fc <_IO_stdin_used+0xfc>
+    10e1:	48 8b 3d 78 2f 00 00 	mov    0x2f78(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    10e8:	e8 93 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    10ed:	e8 4e ff ff ff       	call   1040 <abort@plt>
+
+00000000000010f2 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    10f2:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    10f6:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    10f9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    10fd:	31 c0                	xor    %eax,%eax
+    10ff:	57                   	push   %rdi
+    1100:	48 8b 3d 59 2f 00 00 	mov    0x2f59(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1107:	4c 8d 0d e8 0f 00 00 	lea    0xfe8(%rip),%r9        # 20f6 <_IO_stdin_used+0xf6>
+    110e:	4c 8b 06             	mov    (%rsi),%r8
+    1111:	48 8d 35 f5 0f 00 00 	lea    0xff5(%rip),%rsi        # 210d <_IO_stdin_used+0x10d>
+    1118:	e8 63 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    111d:	e8 1e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001122 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1122:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1126:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1129:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    112d:	31 c0                	xor    %eax,%eax
+    112f:	57                   	push   %rdi
+    1130:	48 8b 3d 29 2f 00 00 	mov    0x2f29(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1137:	4c 8d 0d e4 0f 00 00 	lea    0xfe4(%rip),%r9        # 2122 <_IO_stdin_used+0x122>
+    113e:	4c 8b 06             	mov    (%rsi),%r8
+    1141:	48 8d 35 c5 0f 00 00 	lea    0xfc5(%rip),%rsi        # 210d <_IO_stdin_used+0x10d>
+    1148:	e8 33 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    114d:	e8 ee fe ff ff       	call   1040 <abort@plt>
+
+0000000000001152 <main>:
+        nel::log << v << '\n';
+    }
+}
+
+int main()
+{
+    1152:	50                   	push   %rax
+    handleok1();
+    1153:	e8 3a 08 00 00       	call   1992 <handleok1()>
+    handlefail1();
+    1158:	e8 e3 08 00 00       	call   1a40 <handlefail1()>
+    handleok2();
+    115d:	e8 94 03 00 00       	call   14f6 <handleok2()>
+    handlefail2();
+    1162:	e8 97 02 00 00       	call   13fe <handlefail2()>
+}
+    1167:	31 c0                	xor    %eax,%eax
+    1169:	5a                   	pop    %rdx
+    116a:	c3                   	ret
+    116b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000001170 <_start>:
+    1170:	31 ed                	xor    %ebp,%ebp
+    1172:	49 89 d1             	mov    %rdx,%r9
+    1175:	5e                   	pop    %rsi
+    1176:	48 89 e2             	mov    %rsp,%rdx
+    1179:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    117d:	50                   	push   %rax
+    117e:	54                   	push   %rsp
+    117f:	45 31 c0             	xor    %r8d,%r8d
+    1182:	31 c9                	xor    %ecx,%ecx
+    1184:	48 8d 3d c7 ff ff ff 	lea    -0x39(%rip),%rdi        # 1152 <main>
+    118b:	ff 15 2f 2e 00 00    	call   *0x2e2f(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    1191:	f4                   	hlt
+    1192:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1199:	00 00 00 
+    119c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000011a0 <deregister_tm_clones>:
+    11a0:	    48 8d 3d a9 2e 00 00 	lea    0x2ea9(%rip),%rdi        # 4050 <__TMC_END__>
+    11a7:	    48 8d 05 a2 2e 00 00 	lea    0x2ea2(%rip),%rax        # 4050 <__TMC_END__>
+    11ae:	    48 39 f8             	cmp    %rdi,%rax
+    11b1:	/-- 74 15                	je     11c8 <deregister_tm_clones+0x28>
+    11b3:	|   48 8b 05 0e 2e 00 00 	mov    0x2e0e(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    11ba:	|   48 85 c0             	test   %rax,%rax
+    11bd:	+-- 74 09                	je     11c8 <deregister_tm_clones+0x28>
+    11bf:	|   ff e0                	jmp    *%rax
+    11c1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    11c8:	\-> c3                   	ret
+    11c9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011d0 <register_tm_clones>:
+    11d0:	    48 8d 3d 79 2e 00 00 	lea    0x2e79(%rip),%rdi        # 4050 <__TMC_END__>
+    11d7:	    48 8d 35 72 2e 00 00 	lea    0x2e72(%rip),%rsi        # 4050 <__TMC_END__>
+    11de:	    48 29 fe             	sub    %rdi,%rsi
+    11e1:	    48 89 f0             	mov    %rsi,%rax
+    11e4:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    11e8:	    48 c1 f8 03          	sar    $0x3,%rax
+    11ec:	    48 01 c6             	add    %rax,%rsi
+    11ef:	    48 d1 fe             	sar    %rsi
+    11f2:	/-- 74 14                	je     1208 <register_tm_clones+0x38>
+    11f4:	|   48 8b 05 dd 2d 00 00 	mov    0x2ddd(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    11fb:	|   48 85 c0             	test   %rax,%rax
+    11fe:	+-- 74 08                	je     1208 <register_tm_clones+0x38>
+    1200:	|   ff e0                	jmp    *%rax
+    1202:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1208:	\-> c3                   	ret
+    1209:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001210 <__do_global_dtors_aux>:
+    1210:	       f3 0f 1e fa          	endbr64
+    1214:	       80 3d 4d 2e 00 00 00 	cmpb   $0x0,0x2e4d(%rip)        # 4068 <completed.0>
+    121b:	/----- 75 2b                	jne    1248 <__do_global_dtors_aux+0x38>
+    121d:	|      55                   	push   %rbp
+    121e:	|      48 83 3d ba 2d 00 00 	cmpq   $0x0,0x2dba(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1225:	|      00 
+    1226:	|      48 89 e5             	mov    %rsp,%rbp
+    1229:	|  /-- 74 0c                	je     1237 <__do_global_dtors_aux+0x27>
+    122b:	|  |   48 8b 3d 16 2e 00 00 	mov    0x2e16(%rip),%rdi        # 4048 <__dso_handle>
+    1232:	|  |   e8 79 fe ff ff       	call   10b0 <__cxa_finalize@plt>
+    1237:	|  \-> e8 64 ff ff ff       	call   11a0 <deregister_tm_clones>
+    123c:	|      c6 05 25 2e 00 00 01 	movb   $0x1,0x2e25(%rip)        # 4068 <completed.0>
+    1243:	|      5d                   	pop    %rbp
+    1244:	|      c3                   	ret
+    1245:	|      0f 1f 00             	nopl   (%rax)
+    1248:	\----> c3                   	ret
+    1249:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001250 <frame_dummy>:
+    1250:	f3 0f 1e fa          	endbr64
+    1254:	e9 77 ff ff ff       	jmp    11d0 <register_tm_clones>
+    1259:	90                   	nop
+
+000000000000125a <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)>:
+    if (res.is_ok()) {
+    125a:	          8b 06                	mov    (%rsi),%eax
+        U8Buf<256> v = res.unwrap();
+    125c:	          31 d2                	xor    %edx,%edx
+    125e:	          89 16                	mov    %edx,(%rsi)
+    if (res.is_ok()) {
+    1260:	          89 07                	mov    %eax,(%rdi)
+    }
+    1262:	          83 f8 01             	cmp    $0x1,%eax
+    1265:	      /-- 74 0a                	je     1271 <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)+0x17>
+    1267:	      |   83 f8 02             	cmp    $0x2,%eax
+    126a:	   /--|-- 74 17                	je     1283 <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)+0x29>
+    126c:	   |  |   85 c0                	test   %eax,%eax
+    126e:	/--|--|-- 75 24                	jne    1294 <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)+0x3a>
+    1270:	|  |  |   c3                   	ret
+            nel::elem::copy(data_, o.data_, N);
+        }
+
+        constexpr U8Buf(U8Buf &&o)
+        {
+            nel::elem::move(data_, o.data_, N);
+    1271:	|  |  \-> 48 83 c6 08          	add    $0x8,%rsi
+        constexpr Element(void) = default;
+
+        constexpr Element(Element const &) = delete;
+        constexpr Element &operator=(Element const &) const = delete;
+
+        constexpr Element(Element &&o) = default;
+    1275:	|  |      48 83 c7 08          	add    $0x8,%rdi
+    1279:	|  |      ba 00 01 00 00       	mov    $0x100,%edx
+    127e:	|  |      e9 c0 09 00 00       	jmp    1c43 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+                case Tag::OK:
+                    new (&ok_) Element<T>(forward<Element<T>>(o.ok_));
+                    break;
+
+                case Tag::ERR:
+                    new (&err_) Element<E>(forward<Element<E>>(o.err_));
+    1283:	|  \----> 0f 10 46 08          	movups 0x8(%rsi),%xmm0
+    1287:	|         48 8b 46 18          	mov    0x18(%rsi),%rax
+    128b:	|         0f 11 47 08          	movups %xmm0,0x8(%rdi)
+    128f:	|         48 89 47 18          	mov    %rax,0x18(%rdi)
+    1293:	|         c3                   	ret
+        constexpr Result(Result &&o)
+    1294:	\-------> 48 83 ec 28          	sub    $0x28,%rsp
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1298:	          48 8d 05 7b 0d 00 00 	lea    0xd7b(%rip),%rax        # 201a <_IO_stdin_used+0x1a>
+                    // yes, since it may have contained one or the others..
+                    // if memory hardware is assumed to be incorruptable then can ignore ? (buffer
+                    // overruns?) but might not want to for buffer overrun issues. if there is a
+                    // memory corruption, then should have been detected by memory hardware (Ecc
+                    // mem) if not using eec/ecc mem then that's the prob.
+                    nel::panic("bad Result");
+    129f:	          48 8d 3d 70 0d 00 00 	lea    0xd70(%rip),%rdi        # 2016 <_IO_stdin_used+0x16>
+    12a6:	          48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    12ab:	          48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    12b0:	          48 8d 05 4d 0d 00 00 	lea    0xd4d(%rip),%rax        # 2004 <_IO_stdin_used+0x4>
+    12b7:	          48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    12bc:	          c7 44 24 18 92 00 00 	movl   $0x92,0x18(%rsp)
+    12c3:	          00 
+    12c4:	          e8 29 fe ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+    12c9:	          90                   	nop
+
+00000000000012ca <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const [clone .isra.0]>:
+        // &&on_err) const  {
+        template<typename V, typename Fn1, typename Fn2>
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+        {
+            // this match is non-consuming, for internal use only.
+            switch (tag_) { // result-match
+    12ca:	          83 ff 01             	cmp    $0x1,%edi
+    12cd:	/-------- 74 24                	je     12f3 <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const [clone .isra.0]+0x29>
+    12cf:	|         b0 01                	mov    $0x1,%al
+    12d1:	|         83 ff 02             	cmp    $0x2,%edi
+    12d4:	|  /----- 74 1f                	je     12f5 <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const [clone .isra.0]+0x2b>
+         *
+         * @returns true if container contains a Err, false otherwise.
+         *
+         * `this` is not consumed by this op.
+         */
+        constexpr bool is_err(Context const &ctx = Context()) const
+    12d6:	|  |      50                   	push   %rax
+            switch (tag_) { // result-match
+    12d7:	|  |      85 ff                	test   %edi,%edi
+    12d9:	|  |  /-- 75 0c                	jne    12e7 <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const [clone .isra.0]+0x1d>
+                    nel::panic("invalid Result", ctx);
+    12db:	|  |  |   48 8d 3d 3f 0d 00 00 	lea    0xd3f(%rip),%rdi        # 2021 <_IO_stdin_used+0x21>
+    12e2:	|  |  |   e8 0b fe ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    12e7:	|  |  \-> 48 8d 3d 28 0d 00 00 	lea    0xd28(%rip),%rdi        # 2016 <_IO_stdin_used+0x16>
+    12ee:	|  |      e8 ff fd ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+                    return on_ok(*ok_);
+    12f3:	\--|----> 31 c0                	xor    %eax,%eax
+        {
+            return match<bool>([](T const &) -> bool { return false; },
+                               [](E const &) -> bool { return true; },
+                               ctx);
+        }
+    12f5:	   \----> c3                   	ret
+
+00000000000012f6 <nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const [clone .isra.0]>:
+            switch (tag_) { // result-match
+    12f6:	          83 ff 01             	cmp    $0x1,%edi
+    12f9:	/-------- 74 24                	je     131f <nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const [clone .isra.0]+0x29>
+    12fb:	|         31 c0                	xor    %eax,%eax
+    12fd:	|         83 ff 02             	cmp    $0x2,%edi
+    1300:	|  /----- 74 1f                	je     1321 <nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const [clone .isra.0]+0x2b>
+        constexpr bool is_ok(Context const &ctx = Context()) const
+    1302:	|  |      50                   	push   %rax
+            switch (tag_) { // result-match
+    1303:	|  |      85 ff                	test   %edi,%edi
+    1305:	|  |  /-- 75 0c                	jne    1313 <nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const [clone .isra.0]+0x1d>
+                    nel::panic("invalid Result", ctx);
+    1307:	|  |  |   48 8d 3d 13 0d 00 00 	lea    0xd13(%rip),%rdi        # 2021 <_IO_stdin_used+0x21>
+    130e:	|  |  |   e8 df fd ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("bad Result", ctx);
+    1313:	|  |  \-> 48 8d 3d fc 0c 00 00 	lea    0xcfc(%rip),%rdi        # 2016 <_IO_stdin_used+0x16>
+    131a:	|  |      e8 d3 fd ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+                    return on_ok(*ok_);
+    131f:	\--|----> b0 01                	mov    $0x1,%al
+        }
+    1321:	   \----> c3                   	ret
+
+0000000000001322 <operator<<(nel::Log&, ErrorCode const&)>:
+{
+    // don't supply default case so compile fails if case not present for value in ErrorCode
+    // but, must return in each case and must panic after switch.
+    // see:
+    // https://stackoverflow.com/questions/2201493/using-default-in-a-switch-statement-when-switching-over-an-enum
+    switch (val) {
+    1322:	    83 3e 01             	cmpl   $0x1,(%rsi)
+    1325:	/-- 75 0c                	jne    1333 <operator<<(nel::Log&, ErrorCode const&)+0x11>
+        case ErrorCode::Failed:
+            return outs << "Failed";
+    1327:	|   48 8d 35 02 0d 00 00 	lea    0xd02(%rip),%rsi        # 2030 <_IO_stdin_used+0x30>
+    132e:	|   e9 a0 0b 00 00       	jmp    1ed3 <nel::operator<<(nel::Log&, char const*)>
+{
+    1333:	\-> 48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    1337:	    48 8d 05 f9 0c 00 00 	lea    0xcf9(%rip),%rax        # 2037 <_IO_stdin_used+0x37>
+            break;
+        default:
+            break;
+    }
+    nel::panic("unknown ErrorCode");
+    133e:	    48 8d 3d 0f 0d 00 00 	lea    0xd0f(%rip),%rdi        # 2054 <_IO_stdin_used+0x54>
+    1345:	    48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    134a:	    48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    134f:	    48 8d 05 ec 0c 00 00 	lea    0xcec(%rip),%rax        # 2042 <_IO_stdin_used+0x42>
+    1356:	    48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    135b:	    c7 44 24 18 1a 00 00 	movl   $0x1a,0x18(%rsp)
+    1362:	    00 
+    1363:	    e8 8a fd ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+
+0000000000001368 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    1368:	83 c8 ff             	or     $0xffffffff,%eax
+    136b:	c3                   	ret
+
+000000000000136c <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    136c:	83 c8 ff             	or     $0xffffffff,%eax
+    136f:	c3                   	ret
+
+0000000000001370 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    1370:	83 c8 ff             	or     $0xffffffff,%eax
+    1373:	c3                   	ret
+
+0000000000001374 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    1374:	83 c8 ff             	or     $0xffffffff,%eax
+    1377:	c3                   	ret
+
+0000000000001378 <_read_r>:
+int _read_r(struct _reent *, int) {
+    1378:	83 c8 ff             	or     $0xffffffff,%eax
+    137b:	c3                   	ret
+
+000000000000137c <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    137c:	83 c8 ff             	or     $0xffffffff,%eax
+    137f:	c3                   	ret
+
+0000000000001380 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    1380:	83 c8 ff             	or     $0xffffffff,%eax
+    1383:	c3                   	ret
+
+0000000000001384 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1384:	83 c8 ff             	or     $0xffffffff,%eax
+    1387:	c3                   	ret
+
+0000000000001388 <ok1()>:
+            : tag_(Tag::OK)
+    1388:	c7 07 01 00 00 00    	movl   $0x1,(%rdi)
+{
+    138e:	48 89 f8             	mov    %rdi,%rax
+}
+    1391:	c3                   	ret
+
+0000000000001392 <fail2()>:
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+            : value_(forward<Type>(val))
+    1392:	48 8d 15 cd 0c 00 00 	lea    0xccd(%rip),%rdx        # 2066 <_IO_stdin_used+0x66>
+            : tag_(Tag::ERR)
+    1399:	c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+{
+    139f:	48 89 f8             	mov    %rdi,%rax
+    13a2:	c7 47 08 01 00 00 00 	movl   $0x1,0x8(%rdi)
+    13a9:	48 c7 47 10 22 00 00 	movq   $0x22,0x10(%rdi)
+    13b0:	00 
+    13b1:	48 89 57 18          	mov    %rdx,0x18(%rdi)
+}
+    13b5:	c3                   	ret
+
+00000000000013b6 <fail4()>:
+
+    public:
+        constexpr Error(ErrorCode const &code, char const *filename, Lineno const line)
+            : code(code)
+            , lineno(line)
+            , filename(filename)
+    13b6:	48 8d 15 a9 0c 00 00 	lea    0xca9(%rip),%rdx        # 2066 <_IO_stdin_used+0x66>
+            : tag_(Tag::ERR)
+    13bd:	c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+{
+    13c3:	48 89 f8             	mov    %rdi,%rax
+            : code(code)
+    13c6:	c7 47 08 01 00 00 00 	movl   $0x1,0x8(%rdi)
+            , lineno(line)
+    13cd:	48 c7 47 10 27 00 00 	movq   $0x27,0x10(%rdi)
+    13d4:	00 
+            , filename(filename)
+    13d5:	48 89 57 18          	mov    %rdx,0x18(%rdi)
+}
+    13d9:	c3                   	ret
+
+00000000000013da <passfail4()>:
+    13da:	48 8d 15 85 0c 00 00 	lea    0xc85(%rip),%rdx        # 2066 <_IO_stdin_used+0x66>
+    13e1:	c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+{
+    13e7:	48 89 f8             	mov    %rdi,%rax
+            : code(code)
+    13ea:	c7 47 08 01 00 00 00 	movl   $0x1,0x8(%rdi)
+            , lineno(line)
+    13f1:	48 c7 47 10 27 00 00 	movq   $0x27,0x10(%rdi)
+    13f8:	00 
+            , filename(filename)
+    13f9:	48 89 57 18          	mov    %rdx,0x18(%rdi)
+}
+    13fd:	c3                   	ret
+
+00000000000013fe <handlefail2()>:
+{
+    13fe:	48 81 ec 28 01 00 00 	sub    $0x128,%rsp
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+        {
+            // a consuming matcher..
+            // that moves the value to the closures..
+            auto tag = tag_;
+            tag_ = Tag::INVAL;
+    1405:	31 d2                	xor    %edx,%edx
+    1407:	48 8d 05 58 0c 00 00 	lea    0xc58(%rip),%rax        # 2066 <_IO_stdin_used+0x66>
+        nel::log << v << '\n';
+    140e:	48 89 e6             	mov    %rsp,%rsi
+            : code(code)
+    1411:	c7 44 24 20 01 00 00 	movl   $0x1,0x20(%rsp)
+    1418:	00 
+    1419:	48 8d 3d 49 2c 00 00 	lea    0x2c49(%rip),%rdi        # 4069 <nel::log>
+            , lineno(line)
+    1420:	48 c7 44 24 28 27 00 	movq   $0x27,0x28(%rsp)
+    1427:	00 00 
+         * this is consumed by the operation.
+         */
+        constexpr E unwrap_err(Context const &ctx = Context())
+        {
+            return consume<E>([&](T &&) -> E { nel::panic("not an err", ctx); },
+                              [](E &&err) -> E { return err; },
+    1429:	0f 10 44 24 20       	movups 0x20(%rsp),%xmm0
+            tag_ = Tag::INVAL;
+    142e:	89 54 24 18          	mov    %edx,0x18(%rsp)
+                              [](E &&err) -> E { return err; },
+    1432:	0f 11 04 24          	movups %xmm0,(%rsp)
+            , filename(filename)
+    1436:	48 89 44 24 30       	mov    %rax,0x30(%rsp)
+    143b:	48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    1440:	e8 39 06 00 00       	call   1a7e <operator<<(nel::Log&, Error const&)>
+    1445:	be 0a 00 00 00       	mov    $0xa,%esi
+    144a:	48 89 c7             	mov    %rax,%rdi
+    144d:	e8 68 0a 00 00       	call   1eba <nel::operator<<(nel::Log&, char)>
+}
+    1452:	48 8d 7c 24 18       	lea    0x18(%rsp),%rdi
+    1457:	e8 00 07 00 00       	call   1b5c <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    145c:	48 81 c4 28 01 00 00 	add    $0x128,%rsp
+    1463:	c3                   	ret
+
+0000000000001464 <ok2()>:
+{
+    1464:	55                   	push   %rbp
+    1465:	ba 00 01 00 00       	mov    $0x100,%edx
+    146a:	53                   	push   %rbx
+    146b:	48 89 fb             	mov    %rdi,%rbx
+    146e:	48 8d 7f 08          	lea    0x8(%rdi),%rdi
+    1472:	48 81 ec 08 01 00 00 	sub    $0x108,%rsp
+            : tag_(Tag::OK)
+    1479:	c7 47 f8 01 00 00 00 	movl   $0x1,-0x8(%rdi)
+    1480:	48 89 e5             	mov    %rsp,%rbp
+    1483:	48 89 ee             	mov    %rbp,%rsi
+    1486:	e8 b8 07 00 00       	call   1c43 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    return Result_t::Ok(U8Buf<256>());
+    148b:	48 89 ef             	mov    %rbp,%rdi
+    148e:	e8 b9 06 00 00       	call   1b4c <U8Buf<256ul>::~U8Buf()>
+}
+    1493:	48 81 c4 08 01 00 00 	add    $0x108,%rsp
+    149a:	48 89 d8             	mov    %rbx,%rax
+    149d:	5b                   	pop    %rbx
+    149e:	5d                   	pop    %rbp
+    149f:	c3                   	ret
+
+00000000000014a0 <ok3()>:
+{
+    14a0:	55                   	push   %rbp
+    return Result_t::Ok(U8Buf<256>((uint8_t)0x22));
+    14a1:	be 22 00 00 00       	mov    $0x22,%esi
+{
+    14a6:	53                   	push   %rbx
+    14a7:	48 89 fb             	mov    %rdi,%rbx
+    14aa:	48 81 ec 08 01 00 00 	sub    $0x108,%rsp
+    return Result_t::Ok(U8Buf<256>((uint8_t)0x22));
+    14b1:	48 89 e5             	mov    %rsp,%rbp
+    14b4:	48 89 ef             	mov    %rbp,%rdi
+    14b7:	e8 ec 06 00 00       	call   1ba8 <U8Buf<256ul>::U8Buf(unsigned char)>
+    14bc:	c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+    14c2:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    14c6:	48 89 ee             	mov    %rbp,%rsi
+    14c9:	ba 00 01 00 00       	mov    $0x100,%edx
+    14ce:	e8 70 07 00 00       	call   1c43 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    14d3:	48 89 ef             	mov    %rbp,%rdi
+    14d6:	e8 71 06 00 00       	call   1b4c <U8Buf<256ul>::~U8Buf()>
+}
+    14db:	48 81 c4 08 01 00 00 	add    $0x108,%rsp
+    14e2:	48 89 d8             	mov    %rbx,%rax
+    14e5:	5b                   	pop    %rbx
+    14e6:	5d                   	pop    %rbp
+    14e7:	c3                   	ret
+
+00000000000014e8 <passok3()>:
+{
+    14e8:	53                   	push   %rbx
+    14e9:	48 89 fb             	mov    %rdi,%rbx
+    return ok3();
+    14ec:	e8 af ff ff ff       	call   14a0 <ok3()>
+}
+    14f1:	48 89 d8             	mov    %rbx,%rax
+    14f4:	5b                   	pop    %rbx
+    14f5:	c3                   	ret
+
+00000000000014f6 <handleok2()>:
+{
+    14f6:	             55                   	push   %rbp
+    14f7:	             53                   	push   %rbx
+    14f8:	             48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+    Result_t res = ok3();
+    14ff:	             48 8d 6c 24 48       	lea    0x48(%rsp),%rbp
+    1504:	             48 89 ef             	mov    %rbp,%rdi
+    1507:	             e8 94 ff ff ff       	call   14a0 <ok3()>
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+    150c:	             8b 5c 24 48          	mov    0x48(%rsp),%ebx
+            : fn_name_(fn_name)
+    1510:	             48 8d 05 6f 0b 00 00 	lea    0xb6f(%rip),%rax        # 2086 <_IO_stdin_used+0x86>
+    if (res.is_err()) {
+    1517:	             48 8d 74 24 30       	lea    0x30(%rsp),%rsi
+    151c:	             48 89 44 24 30       	mov    %rax,0x30(%rsp)
+            , file_name_(file_name)
+    1521:	             48 8d 05 3e 0b 00 00 	lea    0xb3e(%rip),%rax        # 2066 <_IO_stdin_used+0x66>
+    1528:	             89 df                	mov    %ebx,%edi
+    152a:	             48 89 74 24 08       	mov    %rsi,0x8(%rsp)
+    152f:	             48 89 44 24 38       	mov    %rax,0x38(%rsp)
+            , line_num_(line_num)
+    1534:	             c7 44 24 40 70 00 00 	movl   $0x70,0x40(%rsp)
+    153b:	             00 
+    153c:	             e8 89 fd ff ff       	call   12ca <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const [clone .isra.0]>
+    1541:	             48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    1546:	             84 c0                	test   %al,%al
+    1548:	/----------- 74 6d                	je     15b7 <handleok2()+0xc1>
+            tag_ = Tag::INVAL;
+    154a:	|            31 c0                	xor    %eax,%eax
+    154c:	|            c7 44 24 40 71 00 00 	movl   $0x71,0x40(%rsp)
+    1553:	|            00 
+    1554:	|            89 44 24 48          	mov    %eax,0x48(%rsp)
+            switch (tag) { // result-consume
+    1558:	|            83 fb 02             	cmp    $0x2,%ebx
+    155b:	|        /-- 74 1a                	je     1577 <handleok2()+0x81>
+    155d:	|  /-----|-- 7f 4c                	jg     15ab <handleok2()+0xb5>
+                    nel::panic("invalid Result", ctx);
+    155f:	|  |     |   48 8d 3d bb 0a 00 00 	lea    0xabb(%rip),%rdi        # 2021 <_IO_stdin_used+0x21>
+            switch (tag) { // result-consume
+    1566:	|  |     |   85 db                	test   %ebx,%ebx
+    1568:	|  |  /--|-- 74 48                	je     15b2 <handleok2()+0xbc>
+    156a:	|  |  |  |   ff cb                	dec    %ebx
+            return consume<E>([&](T &&) -> E { nel::panic("not an err", ctx); },
+    156c:	|  |  |  |   48 8d 3d 1d 0b 00 00 	lea    0xb1d(%rip),%rdi        # 2090 <_IO_stdin_used+0x90>
+            switch (tag) { // result-consume
+    1573:	|  |  +--|-- 74 3d                	je     15b2 <handleok2()+0xbc>
+    1575:	|  +--|--|-- eb 34                	jmp    15ab <handleok2()+0xb5>
+                              [](E &&err) -> E { return err; },
+    1577:	|  |  |  \-> 0f 10 44 24 50       	movups 0x50(%rsp),%xmm0
+    157c:	|  |  |      48 8b 44 24 60       	mov    0x60(%rsp),%rax
+        nel::log << v << '\n';
+    1581:	|  |  |      48 8d 74 24 18       	lea    0x18(%rsp),%rsi
+    1586:	|  |  |      48 8d 3d dc 2a 00 00 	lea    0x2adc(%rip),%rdi        # 4069 <nel::log>
+    158d:	|  |  |      48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    1592:	|  |  |      0f 11 44 24 18       	movups %xmm0,0x18(%rsp)
+    1597:	|  |  |      e8 e2 04 00 00       	call   1a7e <operator<<(nel::Log&, Error const&)>
+    159c:	|  |  |      be 0a 00 00 00       	mov    $0xa,%esi
+    15a1:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    15a4:	|  |  |      e8 11 09 00 00       	call   1eba <nel::operator<<(nel::Log&, char)>
+    15a9:	+--|--|----- eb 0c                	jmp    15b7 <handleok2()+0xc1>
+                    nel::panic("bad Result", ctx);
+    15ab:	|  \--|----> 48 8d 3d 64 0a 00 00 	lea    0xa64(%rip),%rdi        # 2016 <_IO_stdin_used+0x16>
+                    nel::panic("invalid Result", ctx);
+    15b2:	|     \----> e8 3b fb ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+}
+    15b7:	\----------> 48 89 ef             	mov    %rbp,%rdi
+    15ba:	             e8 9d 05 00 00       	call   1b5c <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    15bf:	             48 81 c4 58 01 00 00 	add    $0x158,%rsp
+    15c6:	             5b                   	pop    %rbx
+    15c7:	             5d                   	pop    %rbp
+    15c8:	             c3                   	ret
+
+00000000000015c9 <passok33()>:
+{
+    15c9:	       41 57                	push   %r15
+            : fn_name_(fn_name)
+    15cb:	       4c 8d 3d c9 0a 00 00 	lea    0xac9(%rip),%r15        # 209b <_IO_stdin_used+0x9b>
+    15d2:	       41 56                	push   %r14
+            , file_name_(file_name)
+    15d4:	       4c 8d 35 8b 0a 00 00 	lea    0xa8b(%rip),%r14        # 2066 <_IO_stdin_used+0x66>
+    15db:	       41 55                	push   %r13
+    15dd:	       41 54                	push   %r12
+    15df:	       55                   	push   %rbp
+    15e0:	       53                   	push   %rbx
+    15e1:	       48 89 fb             	mov    %rdi,%rbx
+    15e4:	       48 81 ec 38 03 00 00 	sub    $0x338,%rsp
+    Result_t res = ok3();
+    15eb:	       4c 8d a4 24 20 01 00 	lea    0x120(%rsp),%r12
+    15f2:	       00 
+        }
+    15f3:	       48 8d ac 24 28 02 00 	lea    0x228(%rsp),%rbp
+    15fa:	       00 
+    15fb:	       4c 89 e7             	mov    %r12,%rdi
+    NEL_RESULT_TRY(res);
+    15fe:	       4c 8d 6c 24 20       	lea    0x20(%rsp),%r13
+    Result_t res = ok3();
+    1603:	       e8 98 fe ff ff       	call   14a0 <ok3()>
+    1608:	       4c 89 e6             	mov    %r12,%rsi
+    160b:	       48 89 ef             	mov    %rbp,%rdi
+    160e:	       e8 47 fc ff ff       	call   125a <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)>
+    NEL_RESULT_TRY(res);
+    1613:	       8b bc 24 28 02 00 00 	mov    0x228(%rsp),%edi
+    161a:	       4c 89 ee             	mov    %r13,%rsi
+            : fn_name_(fn_name)
+    161d:	       4c 89 7c 24 20       	mov    %r15,0x20(%rsp)
+            , file_name_(file_name)
+    1622:	       4c 89 74 24 28       	mov    %r14,0x28(%rsp)
+            , line_num_(line_num)
+    1627:	       c7 44 24 30 59 00 00 	movl   $0x59,0x30(%rsp)
+    162e:	       00 
+    162f:	       e8 96 fc ff ff       	call   12ca <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const [clone .isra.0]>
+    1634:	       84 c0                	test   %al,%al
+    1636:	   /-- 74 15                	je     164d <passok33()+0x84>
+    1638:	   |   48 89 df             	mov    %rbx,%rdi
+    163b:	   |   48 89 ee             	mov    %rbp,%rsi
+    163e:	   |   e8 17 fc ff ff       	call   125a <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)>
+    1643:	   |   48 89 ef             	mov    %rbp,%rdi
+    1646:	   |   e8 11 05 00 00       	call   1b5c <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    164b:	/--|-- eb 46                	jmp    1693 <passok33()+0xca>
+    164d:	|  \-> 48 89 ee             	mov    %rbp,%rsi
+    1650:	|      48 8d 54 24 08       	lea    0x8(%rsp),%rdx
+    1655:	|      4c 89 ef             	mov    %r13,%rdi
+            : fn_name_(fn_name)
+    1658:	|      4c 89 7c 24 08       	mov    %r15,0x8(%rsp)
+            , file_name_(file_name)
+    165d:	|      4c 89 74 24 10       	mov    %r14,0x10(%rsp)
+            , line_num_(line_num)
+    1662:	|      c7 44 24 18 59 00 00 	movl   $0x59,0x18(%rsp)
+    1669:	|      00 
+    166a:	|      e8 95 04 00 00       	call   1b04 <nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)>
+    166f:	|      48 89 ef             	mov    %rbp,%rdi
+    1672:	|      e8 e5 04 00 00       	call   1b5c <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    1677:	|      4c 89 ef             	mov    %r13,%rdi
+    167a:	|      e8 cd 04 00 00       	call   1b4c <U8Buf<256ul>::~U8Buf()>
+            : tag_(Tag::OK)
+    167f:	|      c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+            , ok_(forward<Args>(args)...)
+    1685:	|      48 8d 7b 08          	lea    0x8(%rbx),%rdi
+        {
+        }
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+            : value_(forward<Args>(args)...)
+    1689:	|      be 33 00 00 00       	mov    $0x33,%esi
+    168e:	|      e8 15 05 00 00       	call   1ba8 <U8Buf<256ul>::U8Buf(unsigned char)>
+}
+    1693:	\----> 4c 89 e7             	mov    %r12,%rdi
+    1696:	       e8 c1 04 00 00       	call   1b5c <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    169b:	       48 81 c4 38 03 00 00 	add    $0x338,%rsp
+    16a2:	       48 89 d8             	mov    %rbx,%rax
+    16a5:	       5b                   	pop    %rbx
+    16a6:	       5d                   	pop    %rbp
+    16a7:	       41 5c                	pop    %r12
+    16a9:	       41 5d                	pop    %r13
+    16ab:	       41 5e                	pop    %r14
+    16ad:	       41 5f                	pop    %r15
+    16af:	       c3                   	ret
+
+00000000000016b0 <passfail33()>:
+{
+    16b0:	       41 56                	push   %r14
+            o.tag_ = Tag::INVAL;
+    16b2:	       31 c0                	xor    %eax,%eax
+            : fn_name_(fn_name)
+    16b4:	       4c 8d 35 e9 09 00 00 	lea    0x9e9(%rip),%r14        # 20a4 <_IO_stdin_used+0xa4>
+    16bb:	       41 55                	push   %r13
+    16bd:	       41 54                	push   %r12
+    16bf:	       4c 8d 25 a0 09 00 00 	lea    0x9a0(%rip),%r12        # 2066 <_IO_stdin_used+0x66>
+    16c6:	       55                   	push   %rbp
+    16c7:	       53                   	push   %rbx
+    16c8:	       48 89 fb             	mov    %rdi,%rbx
+    NEL_RESULT_TRY(res);
+    16cb:	       bf 02 00 00 00       	mov    $0x2,%edi
+{
+    16d0:	       48 81 ec 30 03 00 00 	sub    $0x330,%rsp
+            : code(code)
+    16d7:	       c7 84 24 28 01 00 00 	movl   $0x1,0x128(%rsp)
+    16de:	       01 00 00 00 
+    NEL_RESULT_TRY(res);
+    16e2:	       4c 8d 6c 24 20       	lea    0x20(%rsp),%r13
+    16e7:	       48 8d ac 24 28 02 00 	lea    0x228(%rsp),%rbp
+    16ee:	       00 
+            , lineno(line)
+    16ef:	       48 c7 84 24 30 01 00 	movq   $0x27,0x130(%rsp)
+    16f6:	       00 27 00 00 00 
+    16fb:	       4c 89 ee             	mov    %r13,%rsi
+                    new (&err_) Element<E>(forward<Element<E>>(o.err_));
+    16fe:	       0f 10 84 24 28 01 00 	movups 0x128(%rsp),%xmm0
+    1705:	       00 
+            , filename(filename)
+    1706:	       4c 89 a4 24 38 01 00 	mov    %r12,0x138(%rsp)
+    170d:	       00 
+            tag_ = o.tag_;
+    170e:	       c7 84 24 28 02 00 00 	movl   $0x2,0x228(%rsp)
+    1715:	       02 00 00 00 
+            o.tag_ = Tag::INVAL;
+    1719:	       89 84 24 20 01 00 00 	mov    %eax,0x120(%rsp)
+                    new (&err_) Element<E>(forward<Element<E>>(o.err_));
+    1720:	       4c 89 a4 24 40 02 00 	mov    %r12,0x240(%rsp)
+    1727:	       00 
+    1728:	       4c 89 74 24 20       	mov    %r14,0x20(%rsp)
+            , file_name_(file_name)
+    172d:	       4c 89 64 24 28       	mov    %r12,0x28(%rsp)
+            , line_num_(line_num)
+    1732:	       c7 44 24 30 60 00 00 	movl   $0x60,0x30(%rsp)
+    1739:	       00 
+    173a:	       0f 11 84 24 30 02 00 	movups %xmm0,0x230(%rsp)
+    1741:	       00 
+    1742:	       e8 83 fb ff ff       	call   12ca <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const [clone .isra.0]>
+    1747:	       84 c0                	test   %al,%al
+    1749:	   /-- 74 15                	je     1760 <passfail33()+0xb0>
+        }
+    174b:	   |   48 89 df             	mov    %rbx,%rdi
+    174e:	   |   48 89 ee             	mov    %rbp,%rsi
+    1751:	   |   e8 04 fb ff ff       	call   125a <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)>
+    1756:	   |   48 89 ef             	mov    %rbp,%rdi
+    1759:	   |   e8 fe 03 00 00       	call   1b5c <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    175e:	/--|-- eb 46                	jmp    17a6 <passfail33()+0xf6>
+    1760:	|  \-> 48 89 ee             	mov    %rbp,%rsi
+    1763:	|      48 8d 54 24 08       	lea    0x8(%rsp),%rdx
+    1768:	|      4c 89 ef             	mov    %r13,%rdi
+            : fn_name_(fn_name)
+    176b:	|      4c 89 74 24 08       	mov    %r14,0x8(%rsp)
+            , file_name_(file_name)
+    1770:	|      4c 89 64 24 10       	mov    %r12,0x10(%rsp)
+            , line_num_(line_num)
+    1775:	|      c7 44 24 18 60 00 00 	movl   $0x60,0x18(%rsp)
+    177c:	|      00 
+    177d:	|      e8 82 03 00 00       	call   1b04 <nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)>
+    1782:	|      48 89 ef             	mov    %rbp,%rdi
+    1785:	|      e8 d2 03 00 00       	call   1b5c <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    178a:	|      4c 89 ef             	mov    %r13,%rdi
+    178d:	|      e8 ba 03 00 00       	call   1b4c <U8Buf<256ul>::~U8Buf()>
+            : tag_(Tag::OK)
+    1792:	|      c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+            , ok_(forward<Args>(args)...)
+    1798:	|      48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    179c:	|      be 43 00 00 00       	mov    $0x43,%esi
+    17a1:	|      e8 02 04 00 00       	call   1ba8 <U8Buf<256ul>::U8Buf(unsigned char)>
+}
+    17a6:	\----> 48 8d bc 24 20 01 00 	lea    0x120(%rsp),%rdi
+    17ad:	       00 
+    17ae:	       e8 a9 03 00 00       	call   1b5c <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    17b3:	       48 81 c4 30 03 00 00 	add    $0x330,%rsp
+    17ba:	       48 89 d8             	mov    %rbx,%rax
+    17bd:	       5b                   	pop    %rbx
+    17be:	       5d                   	pop    %rbp
+    17bf:	       41 5c                	pop    %r12
+    17c1:	       41 5d                	pop    %r13
+    17c3:	       41 5e                	pop    %r14
+    17c5:	       c3                   	ret
+
+00000000000017c6 <ok4()>:
+{
+    17c6:	53                   	push   %rbx
+    17c7:	be 33 00 00 00       	mov    $0x33,%esi
+    17cc:	48 89 fb             	mov    %rdi,%rbx
+    17cf:	48 8d 7f 08          	lea    0x8(%rdi),%rdi
+            : tag_(Tag::OK)
+    17d3:	c7 47 f8 01 00 00 00 	movl   $0x1,-0x8(%rdi)
+    17da:	e8 c9 03 00 00       	call   1ba8 <U8Buf<256ul>::U8Buf(unsigned char)>
+}
+    17df:	48 89 d8             	mov    %rbx,%rax
+    17e2:	5b                   	pop    %rbx
+    17e3:	c3                   	ret
+
+00000000000017e4 <passok31()>:
+{
+    17e4:	       55                   	push   %rbp
+    17e5:	       53                   	push   %rbx
+    17e6:	       48 89 fb             	mov    %rdi,%rbx
+    17e9:	       48 81 ec 28 01 00 00 	sub    $0x128,%rsp
+    Result_t res = ok3();
+    17f0:	       48 8d 6c 24 18       	lea    0x18(%rsp),%rbp
+    17f5:	       48 89 ef             	mov    %rbp,%rdi
+    17f8:	       e8 a3 fc ff ff       	call   14a0 <ok3()>
+            : fn_name_(fn_name)
+    17fd:	       48 8d 05 ab 08 00 00 	lea    0x8ab(%rip),%rax        # 20af <_IO_stdin_used+0xaf>
+    if (res.is_ok()) {
+    1804:	       48 89 e6             	mov    %rsp,%rsi
+    1807:	       8b 7c 24 18          	mov    0x18(%rsp),%edi
+    180b:	       48 89 04 24          	mov    %rax,(%rsp)
+            , file_name_(file_name)
+    180f:	       48 8d 05 50 08 00 00 	lea    0x850(%rip),%rax        # 2066 <_IO_stdin_used+0x66>
+    1816:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , line_num_(line_num)
+    181b:	       c7 44 24 10 37 00 00 	movl   $0x37,0x10(%rsp)
+    1822:	       00 
+    1823:	       e8 ce fa ff ff       	call   12f6 <nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const [clone .isra.0]>
+    1828:	       84 c0                	test   %al,%al
+    182a:	   /-- 74 0d                	je     1839 <passok31()+0x55>
+        }
+    182c:	   |   48 89 ee             	mov    %rbp,%rsi
+    182f:	   |   48 89 df             	mov    %rbx,%rdi
+    1832:	   |   e8 23 fa ff ff       	call   125a <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)>
+    1837:	/--|-- eb 14                	jmp    184d <passok31()+0x69>
+            : tag_(Tag::OK)
+    1839:	|  \-> c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+            , ok_(forward<Args>(args)...)
+    183f:	|      48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    1843:	|      be 31 00 00 00       	mov    $0x31,%esi
+    1848:	|      e8 5b 03 00 00       	call   1ba8 <U8Buf<256ul>::U8Buf(unsigned char)>
+}
+    184d:	\----> 48 89 ef             	mov    %rbp,%rdi
+    1850:	       e8 07 03 00 00       	call   1b5c <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    1855:	       48 81 c4 28 01 00 00 	add    $0x128,%rsp
+    185c:	       48 89 d8             	mov    %rbx,%rax
+    185f:	       5b                   	pop    %rbx
+    1860:	       5d                   	pop    %rbp
+    1861:	       c3                   	ret
+
+0000000000001862 <passok32()>:
+{
+    1862:	       55                   	push   %rbp
+    1863:	       53                   	push   %rbx
+    1864:	       48 89 fb             	mov    %rdi,%rbx
+    1867:	       48 81 ec 28 01 00 00 	sub    $0x128,%rsp
+    Result_t res = ok3();
+    186e:	       48 8d 6c 24 18       	lea    0x18(%rsp),%rbp
+    1873:	       48 89 ef             	mov    %rbp,%rdi
+    1876:	       e8 25 fc ff ff       	call   14a0 <ok3()>
+            : fn_name_(fn_name)
+    187b:	       48 8d 05 36 08 00 00 	lea    0x836(%rip),%rax        # 20b8 <_IO_stdin_used+0xb8>
+    if (res.is_err()) {
+    1882:	       48 89 e6             	mov    %rsp,%rsi
+    1885:	       8b 7c 24 18          	mov    0x18(%rsp),%edi
+    1889:	       48 89 04 24          	mov    %rax,(%rsp)
+            , file_name_(file_name)
+    188d:	       48 8d 05 d2 07 00 00 	lea    0x7d2(%rip),%rax        # 2066 <_IO_stdin_used+0x66>
+    1894:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , line_num_(line_num)
+    1899:	       c7 44 24 10 41 00 00 	movl   $0x41,0x10(%rsp)
+    18a0:	       00 
+    18a1:	       e8 24 fa ff ff       	call   12ca <nel::Result<U8Buf<256ul>, Error>::is_err(nel::Context const&) const [clone .isra.0]>
+    18a6:	       84 c0                	test   %al,%al
+    18a8:	   /-- 74 0d                	je     18b7 <passok32()+0x55>
+        }
+    18aa:	   |   48 89 ee             	mov    %rbp,%rsi
+    18ad:	   |   48 89 df             	mov    %rbx,%rdi
+    18b0:	   |   e8 a5 f9 ff ff       	call   125a <nel::Result<U8Buf<256ul>, Error>::Result(nel::Result<U8Buf<256ul>, Error>&&)>
+    18b5:	/--|-- eb 14                	jmp    18cb <passok32()+0x69>
+            : tag_(Tag::OK)
+    18b7:	|  \-> c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+            , ok_(forward<Args>(args)...)
+    18bd:	|      48 8d 7b 08          	lea    0x8(%rbx),%rdi
+    18c1:	|      be 32 00 00 00       	mov    $0x32,%esi
+    18c6:	|      e8 dd 02 00 00       	call   1ba8 <U8Buf<256ul>::U8Buf(unsigned char)>
+}
+    18cb:	\----> 48 89 ef             	mov    %rbp,%rdi
+    18ce:	       e8 89 02 00 00       	call   1b5c <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    18d3:	       48 81 c4 28 01 00 00 	add    $0x128,%rsp
+    18da:	       48 89 d8             	mov    %rbx,%rax
+    18dd:	       5b                   	pop    %rbx
+    18de:	       5d                   	pop    %rbp
+    18df:	       c3                   	ret
+
+00000000000018e0 <passfail31()>:
+{
+    18e0:	53                   	push   %rbx
+    18e1:	48 8d 05 7e 07 00 00 	lea    0x77e(%rip),%rax        # 2066 <_IO_stdin_used+0x66>
+    18e8:	48 89 fb             	mov    %rdi,%rbx
+    18eb:	be 41 00 00 00       	mov    $0x41,%esi
+    18f0:	48 8d 7f 08          	lea    0x8(%rdi),%rdi
+    18f4:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+            : tag_(Tag::OK)
+    18fb:	c7 47 f8 01 00 00 00 	movl   $0x1,-0x8(%rdi)
+    1902:	48 89 44 24 20       	mov    %rax,0x20(%rsp)
+            : tag_(Tag::ERR)
+    1907:	c7 44 24 08 02 00 00 	movl   $0x2,0x8(%rsp)
+    190e:	00 
+            : code(code)
+    190f:	c7 44 24 10 01 00 00 	movl   $0x1,0x10(%rsp)
+    1916:	00 
+            , lineno(line)
+    1917:	48 c7 44 24 18 27 00 	movq   $0x27,0x18(%rsp)
+    191e:	00 00 
+    1920:	e8 83 02 00 00       	call   1ba8 <U8Buf<256ul>::U8Buf(unsigned char)>
+}
+    1925:	48 8d 7c 24 08       	lea    0x8(%rsp),%rdi
+    192a:	e8 2d 02 00 00       	call   1b5c <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    192f:	48 81 c4 10 01 00 00 	add    $0x110,%rsp
+    1936:	48 89 d8             	mov    %rbx,%rax
+    1939:	5b                   	pop    %rbx
+    193a:	c3                   	ret
+
+000000000000193b <passfail32()>:
+{
+    193b:	53                   	push   %rbx
+            , filename(filename)
+    193c:	48 8d 05 23 07 00 00 	lea    0x723(%rip),%rax        # 2066 <_IO_stdin_used+0x66>
+    1943:	48 89 fb             	mov    %rdi,%rbx
+            o.tag_ = Tag::INVAL;
+    1946:	31 d2                	xor    %edx,%edx
+    1948:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+                    new (&err_) Element<E>(forward<Element<E>>(o.err_));
+    194f:	48 89 47 18          	mov    %rax,0x18(%rdi)
+            : code(code)
+    1953:	c7 44 24 10 01 00 00 	movl   $0x1,0x10(%rsp)
+    195a:	00 
+            , lineno(line)
+    195b:	48 c7 44 24 18 27 00 	movq   $0x27,0x18(%rsp)
+    1962:	00 00 
+    1964:	0f 10 44 24 10       	movups 0x10(%rsp),%xmm0
+            tag_ = o.tag_;
+    1969:	c7 07 02 00 00 00    	movl   $0x2,(%rdi)
+                    new (&err_) Element<E>(forward<Element<E>>(o.err_));
+    196f:	0f 11 47 08          	movups %xmm0,0x8(%rdi)
+}
+    1973:	48 8d 7c 24 08       	lea    0x8(%rsp),%rdi
+            , filename(filename)
+    1978:	48 89 44 24 20       	mov    %rax,0x20(%rsp)
+            o.tag_ = Tag::INVAL;
+    197d:	89 54 24 08          	mov    %edx,0x8(%rsp)
+    1981:	e8 d6 01 00 00       	call   1b5c <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    1986:	48 81 c4 10 01 00 00 	add    $0x110,%rsp
+    198d:	48 89 d8             	mov    %rbx,%rax
+    1990:	5b                   	pop    %rbx
+    1991:	c3                   	ret
+
+0000000000001992 <handleok1()>:
+{
+    1992:	    41 55                	push   %r13
+            : fn_name_(fn_name)
+    1994:	    4c 8d 2d 26 07 00 00 	lea    0x726(%rip),%r13        # 20c1 <_IO_stdin_used+0xc1>
+    199b:	    41 54                	push   %r12
+            , file_name_(file_name)
+    199d:	    4c 8d 25 c2 06 00 00 	lea    0x6c2(%rip),%r12        # 2066 <_IO_stdin_used+0x66>
+    19a4:	    55                   	push   %rbp
+    19a5:	    53                   	push   %rbx
+    19a6:	    48 81 ec 28 02 00 00 	sub    $0x228,%rsp
+    Result_t res = ok3();
+    19ad:	    48 8d ac 24 18 01 00 	lea    0x118(%rsp),%rbp
+    19b4:	    00 
+    if (res.is_ok()) {
+    19b5:	    48 8d 5c 24 18       	lea    0x18(%rsp),%rbx
+    Result_t res = ok3();
+    19ba:	    48 89 ef             	mov    %rbp,%rdi
+    19bd:	    e8 de fa ff ff       	call   14a0 <ok3()>
+    if (res.is_ok()) {
+    19c2:	    8b bc 24 18 01 00 00 	mov    0x118(%rsp),%edi
+    19c9:	    48 89 de             	mov    %rbx,%rsi
+            : fn_name_(fn_name)
+    19cc:	    4c 89 6c 24 18       	mov    %r13,0x18(%rsp)
+            , file_name_(file_name)
+    19d1:	    4c 89 64 24 20       	mov    %r12,0x20(%rsp)
+            , line_num_(line_num)
+    19d6:	    c7 44 24 28 67 00 00 	movl   $0x67,0x28(%rsp)
+    19dd:	    00 
+    19de:	    e8 13 f9 ff ff       	call   12f6 <nel::Result<U8Buf<256ul>, Error>::is_ok(nel::Context const&) const [clone .isra.0]>
+    19e3:	    84 c0                	test   %al,%al
+    19e5:	/-- 74 43                	je     1a2a <handleok1()+0x98>
+        U8Buf<256> v = res.unwrap();
+    19e7:	|   48 89 e2             	mov    %rsp,%rdx
+    19ea:	|   48 89 ee             	mov    %rbp,%rsi
+    19ed:	|   48 89 df             	mov    %rbx,%rdi
+            : fn_name_(fn_name)
+    19f0:	|   4c 89 2c 24          	mov    %r13,(%rsp)
+            , file_name_(file_name)
+    19f4:	|   4c 89 64 24 08       	mov    %r12,0x8(%rsp)
+            , line_num_(line_num)
+    19f9:	|   c7 44 24 10 68 00 00 	movl   $0x68,0x10(%rsp)
+    1a00:	|   00 
+    1a01:	|   e8 fe 00 00 00       	call   1b04 <nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)>
+        nel::log << v << '\n';
+    1a06:	|   48 89 de             	mov    %rbx,%rsi
+    1a09:	|   48 8d 3d 59 26 00 00 	lea    0x2659(%rip),%rdi        # 4069 <nel::log>
+    1a10:	|   e8 a1 01 00 00       	call   1bb6 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    1a15:	|   be 0a 00 00 00       	mov    $0xa,%esi
+    1a1a:	|   48 89 c7             	mov    %rax,%rdi
+    1a1d:	|   e8 98 04 00 00       	call   1eba <nel::operator<<(nel::Log&, char)>
+    }
+    1a22:	|   48 89 df             	mov    %rbx,%rdi
+    1a25:	|   e8 22 01 00 00       	call   1b4c <U8Buf<256ul>::~U8Buf()>
+}
+    1a2a:	\-> 48 89 ef             	mov    %rbp,%rdi
+    1a2d:	    e8 2a 01 00 00       	call   1b5c <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    1a32:	    48 81 c4 28 02 00 00 	add    $0x228,%rsp
+    1a39:	    5b                   	pop    %rbx
+    1a3a:	    5d                   	pop    %rbp
+    1a3b:	    41 5c                	pop    %r12
+    1a3d:	    41 5d                	pop    %r13
+    1a3f:	    c3                   	ret
+
+0000000000001a40 <handlefail1()>:
+{
+    1a40:	48 81 ec 18 01 00 00 	sub    $0x118,%rsp
+    1a47:	48 8d 05 18 06 00 00 	lea    0x618(%rip),%rax        # 2066 <_IO_stdin_used+0x66>
+}
+    1a4e:	48 8d 7c 24 08       	lea    0x8(%rsp),%rdi
+    1a53:	48 89 44 24 20       	mov    %rax,0x20(%rsp)
+            : tag_(Tag::ERR)
+    1a58:	c7 44 24 08 02 00 00 	movl   $0x2,0x8(%rsp)
+    1a5f:	00 
+            : code(code)
+    1a60:	c7 44 24 10 01 00 00 	movl   $0x1,0x10(%rsp)
+    1a67:	00 
+            , lineno(line)
+    1a68:	48 c7 44 24 18 27 00 	movq   $0x27,0x18(%rsp)
+    1a6f:	00 00 
+    1a71:	e8 e6 00 00 00       	call   1b5c <nel::Result<U8Buf<256ul>, Error>::~Result()>
+    1a76:	48 81 c4 18 01 00 00 	add    $0x118,%rsp
+    1a7d:	c3                   	ret
+
+0000000000001a7e <operator<<(nel::Log&, Error const&)>:
+        {
+        }
+
+    public:
+        // friend std::ostream &operator<<(std::ostream &outs, Error const &val) {
+        friend nel::Log &operator<<(nel::Log &outs, Error const &val)
+    1a7e:	55                   	push   %rbp
+    1a7f:	48 89 fd             	mov    %rdi,%rbp
+    1a82:	53                   	push   %rbx
+    1a83:	48 89 f3             	mov    %rsi,%rbx
+        {
+            outs << "Error(" << static_cast<int>(val.code) << "=" << val.code << ")";
+    1a86:	48 8d 35 3e 06 00 00 	lea    0x63e(%rip),%rsi        # 20cb <_IO_stdin_used+0xcb>
+        friend nel::Log &operator<<(nel::Log &outs, Error const &val)
+    1a8d:	50                   	push   %rax
+            outs << "Error(" << static_cast<int>(val.code) << "=" << val.code << ")";
+    1a8e:	e8 40 04 00 00       	call   1ed3 <nel::operator<<(nel::Log&, char const*)>
+    1a93:	8b 33                	mov    (%rbx),%esi
+    1a95:	48 89 c7             	mov    %rax,%rdi
+    1a98:	e8 b1 04 00 00       	call   1f4e <nel::operator<<(nel::Log&, int)>
+    1a9d:	48 8d 35 2e 06 00 00 	lea    0x62e(%rip),%rsi        # 20d2 <_IO_stdin_used+0xd2>
+    1aa4:	48 89 c7             	mov    %rax,%rdi
+    1aa7:	e8 27 04 00 00       	call   1ed3 <nel::operator<<(nel::Log&, char const*)>
+    1aac:	48 89 de             	mov    %rbx,%rsi
+    1aaf:	48 89 c7             	mov    %rax,%rdi
+    1ab2:	e8 6b f8 ff ff       	call   1322 <operator<<(nel::Log&, ErrorCode const&)>
+    1ab7:	48 8d 35 16 06 00 00 	lea    0x616(%rip),%rsi        # 20d4 <_IO_stdin_used+0xd4>
+    1abe:	48 89 c7             	mov    %rax,%rdi
+    1ac1:	e8 0d 04 00 00       	call   1ed3 <nel::operator<<(nel::Log&, char const*)>
+            outs << "@" << val.filename << ":" << val.lineno;
+    1ac6:	48 89 ef             	mov    %rbp,%rdi
+    1ac9:	48 8d 35 06 06 00 00 	lea    0x606(%rip),%rsi        # 20d6 <_IO_stdin_used+0xd6>
+    1ad0:	e8 fe 03 00 00       	call   1ed3 <nel::operator<<(nel::Log&, char const*)>
+    1ad5:	48 8b 73 10          	mov    0x10(%rbx),%rsi
+    1ad9:	48 89 c7             	mov    %rax,%rdi
+    1adc:	e8 f2 03 00 00       	call   1ed3 <nel::operator<<(nel::Log&, char const*)>
+    1ae1:	48 8d 35 f0 05 00 00 	lea    0x5f0(%rip),%rsi        # 20d8 <_IO_stdin_used+0xd8>
+    1ae8:	48 89 c7             	mov    %rax,%rdi
+    1aeb:	e8 e3 03 00 00       	call   1ed3 <nel::operator<<(nel::Log&, char const*)>
+    1af0:	48 8b 73 08          	mov    0x8(%rbx),%rsi
+    1af4:	48 89 c7             	mov    %rax,%rdi
+    1af7:	e8 72 04 00 00       	call   1f6e <nel::operator<<(nel::Log&, unsigned long)>
+            return outs;
+        }
+    1afc:	48 89 e8             	mov    %rbp,%rax
+    1aff:	5a                   	pop    %rdx
+    1b00:	5b                   	pop    %rbx
+    1b01:	5d                   	pop    %rbp
+    1b02:	c3                   	ret
+    1b03:	90                   	nop
+
+0000000000001b04 <nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)>:
+    1b04:	       53                   	push   %rbx
+    1b05:	       8b 06                	mov    (%rsi),%eax
+    1b07:	       31 c9                	xor    %ecx,%ecx
+    1b09:	       89 0e                	mov    %ecx,(%rsi)
+    1b0b:	       83 f8 01             	cmp    $0x1,%eax
+    1b0e:	/----- 74 26                	je     1b36 <nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)+0x32>
+    1b10:	|      48 89 d6             	mov    %rdx,%rsi
+    1b13:	|      48 8d 3d c0 05 00 00 	lea    0x5c0(%rip),%rdi        # 20da <_IO_stdin_used+0xda>
+    1b1a:	|      83 f8 02             	cmp    $0x2,%eax
+    1b1d:	|  /-- 74 12                	je     1b31 <nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)+0x2d>
+    1b1f:	|  |   48 8d 3d f0 04 00 00 	lea    0x4f0(%rip),%rdi        # 2016 <_IO_stdin_used+0x16>
+    1b26:	|  |   85 c0                	test   %eax,%eax
+    1b28:	|  +-- 75 07                	jne    1b31 <nel::Result<U8Buf<256ul>, Error>::unwrap(nel::Context const&)+0x2d>
+    1b2a:	|  |   48 8d 3d f0 04 00 00 	lea    0x4f0(%rip),%rdi        # 2021 <_IO_stdin_used+0x21>
+    1b31:	|  \-> e8 bc f5 ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+    1b36:	\----> 48 89 fb             	mov    %rdi,%rbx
+    1b39:	       48 83 c6 08          	add    $0x8,%rsi
+    1b3d:	       ba 00 01 00 00       	mov    $0x100,%edx
+    1b42:	       e8 fc 00 00 00       	call   1c43 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+        }
+    1b47:	       48 89 d8             	mov    %rbx,%rax
+    1b4a:	       5b                   	pop    %rbx
+    1b4b:	       c3                   	ret
+
+0000000000001b4c <U8Buf<256ul>::~U8Buf()>:
+            nel::elem::set(data_, 0xa5, N);
+    1b4c:	ba 00 01 00 00       	mov    $0x100,%edx
+    1b51:	be a5 00 00 00       	mov    $0xa5,%esi
+    1b56:	e9 e0 00 00 00       	jmp    1c3b <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1b5b:	90                   	nop
+
+0000000000001b5c <nel::Result<U8Buf<256ul>, Error>::~Result()>:
+    return Result_t::Ok((uint8_t)0x33);
+    1b5c:	       8b 07                	mov    (%rdi),%eax
+    1b5e:	       83 f8 01             	cmp    $0x1,%eax
+    1b61:	   /-- 74 06                	je     1b69 <nel::Result<U8Buf<256ul>, Error>::~Result()+0xd>
+    1b63:	   |   83 e0 fd             	and    $0xfffffffd,%eax
+    1b66:	/--|-- 75 0a                	jne    1b72 <nel::Result<U8Buf<256ul>, Error>::~Result()+0x16>
+    1b68:	|  |   c3                   	ret
+        constexpr ~Element(void) = default;
+    1b69:	|  \-> 48 83 c7 08          	add    $0x8,%rdi
+    1b6d:	|      e9 da ff ff ff       	jmp    1b4c <U8Buf<256ul>::~U8Buf()>
+        constexpr ~Result(void)
+    1b72:	\----> 48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    1b76:	       48 8d 05 67 05 00 00 	lea    0x567(%rip),%rax        # 20e4 <_IO_stdin_used+0xe4>
+                    nel::panic("bad Result");
+    1b7d:	       48 8d 3d 92 04 00 00 	lea    0x492(%rip),%rdi        # 2016 <_IO_stdin_used+0x16>
+    1b84:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1b89:	       48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    1b8e:	       48 8d 05 6f 04 00 00 	lea    0x46f(%rip),%rax        # 2004 <_IO_stdin_used+0x4>
+    1b95:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1b9a:	       c7 44 24 18 72 00 00 	movl   $0x72,0x18(%rsp)
+    1ba1:	       00 
+    1ba2:	       e8 4b f5 ff ff       	call   10f2 <nel::panic(char const*, nel::Context const&)>
+    1ba7:	       90                   	nop
+
+0000000000001ba8 <U8Buf<256ul>::U8Buf(unsigned char)>:
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+        {
+            nel::elem::set(data_, f, N);
+    1ba8:	40 0f b6 f6          	movzbl %sil,%esi
+    1bac:	ba 00 01 00 00       	mov    $0x100,%edx
+    1bb1:	e9 85 00 00 00       	jmp    1c3b <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+
+0000000000001bb6 <operator<<(nel::Log&, U8Buf<256ul> const&)>:
+        void fill(uint8_t f)
+        {
+            nel::elem::set(data_, f, N);
+        }
+
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+    1bb6:	    41 54                	push   %r12
+    1bb8:	    49 89 f4             	mov    %rsi,%r12
+        {
+            outs << "U8Buf<" << val.len() << ">{";
+    1bbb:	    48 8d 35 2a 05 00 00 	lea    0x52a(%rip),%rsi        # 20ec <_IO_stdin_used+0xec>
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+    1bc2:	    55                   	push   %rbp
+            if (val.len() > 0) {
+                outs << val.data_[0];
+                for (Index i = 1; i < val.len(); ++i) {
+    1bc3:	    bd 01 00 00 00       	mov    $0x1,%ebp
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+    1bc8:	    53                   	push   %rbx
+    1bc9:	    48 89 fb             	mov    %rdi,%rbx
+            outs << "U8Buf<" << val.len() << ">{";
+    1bcc:	    e8 02 03 00 00       	call   1ed3 <nel::operator<<(nel::Log&, char const*)>
+    1bd1:	    be 00 01 00 00       	mov    $0x100,%esi
+    1bd6:	    48 89 c7             	mov    %rax,%rdi
+    1bd9:	    e8 90 03 00 00       	call   1f6e <nel::operator<<(nel::Log&, unsigned long)>
+    1bde:	    48 8d 35 0e 05 00 00 	lea    0x50e(%rip),%rsi        # 20f3 <_IO_stdin_used+0xf3>
+    1be5:	    48 89 c7             	mov    %rax,%rdi
+    1be8:	    e8 e6 02 00 00       	call   1ed3 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    1bed:	    41 0f b6 34 24       	movzbl (%r12),%esi
+    1bf2:	    48 89 df             	mov    %rbx,%rdi
+    1bf5:	    e8 f1 02 00 00       	call   1eeb <nel::operator<<(nel::Log&, unsigned char)>
+                    outs << ' ' << val.data_[i];
+    1bfa:	/-> be 20 00 00 00       	mov    $0x20,%esi
+    1bff:	|   48 89 df             	mov    %rbx,%rdi
+    1c02:	|   e8 b3 02 00 00       	call   1eba <nel::operator<<(nel::Log&, char)>
+    1c07:	|   41 0f b6 34 2c       	movzbl (%r12,%rbp,1),%esi
+                for (Index i = 1; i < val.len(); ++i) {
+    1c0c:	|   48 ff c5             	inc    %rbp
+                    outs << ' ' << val.data_[i];
+    1c0f:	|   48 89 c7             	mov    %rax,%rdi
+    1c12:	|   e8 d4 02 00 00       	call   1eeb <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1c17:	|   48 81 fd 00 01 00 00 	cmp    $0x100,%rbp
+    1c1e:	\-- 75 da                	jne    1bfa <operator<<(nel::Log&, U8Buf<256ul> const&)+0x44>
+                }
+            }
+            outs << '}';
+    1c20:	    48 89 df             	mov    %rbx,%rdi
+    1c23:	    be 7d 00 00 00       	mov    $0x7d,%esi
+    1c28:	    e8 8d 02 00 00       	call   1eba <nel::operator<<(nel::Log&, char)>
+            return outs;
+        }
+    1c2d:	    48 89 d8             	mov    %rbx,%rax
+    1c30:	    5b                   	pop    %rbx
+    1c31:	    5d                   	pop    %rbp
+    1c32:	    41 5c                	pop    %r12
+    1c34:	    c3                   	ret
+
+0000000000001c35 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1c35:	48 89 d1             	mov    %rdx,%rcx
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    1c38:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1c3a:	c3                   	ret
+
+0000000000001c3b <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    1c3b:	48 89 d1             	mov    %rdx,%rcx
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    1c3e:	89 f0                	mov    %esi,%eax
+    1c40:	f3 aa                	rep stos %al,%es:(%rdi)
+}
+    1c42:	c3                   	ret
+
+0000000000001c43 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    1c43:	48 89 d1             	mov    %rdx,%rcx
+    1c46:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    1c48:	c3                   	ret
+
+0000000000001c49 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    1c49:	e9 52 f4 ff ff       	jmp    10a0 <memmove@plt>
+
+0000000000001c4e <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    1c4e:	48 89 f1             	mov    %rsi,%rcx
+    std::memset(d, s, n);
+    1c51:	b0 a5                	mov    $0xa5,%al
+    1c53:	f3 aa                	rep stos %al,%es:(%rdi)
+    set(d, 0xa5, n);
+}
+    1c55:	c3                   	ret
+
+0000000000001c56 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1c56:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    1c57:	e8 14 f4 ff ff       	call   1070 <memcmp@plt>
+}
+    1c5c:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) == 0;
+    1c5d:	85 c0                	test   %eax,%eax
+    1c5f:	0f 94 c0             	sete   %al
+}
+    1c62:	c3                   	ret
+
+0000000000001c63 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1c63:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    1c64:	e8 07 f4 ff ff       	call   1070 <memcmp@plt>
+}
+    1c69:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) != 0;
+    1c6a:	85 c0                	test   %eax,%eax
+    1c6c:	0f 95 c0             	setne  %al
+}
+    1c6f:	c3                   	ret
+
+0000000000001c70 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+{
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1c70:	          49 89 fa             	mov    %rdi,%r10
+    1c73:	          48 89 f0             	mov    %rsi,%rax
+    if (n < streaming_min) {
+    1c76:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1c7d:	      /-- 77 05                	ja     1c84 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14>
+    std::memcpy(d, s, n);
+    1c7f:	      |   48 89 d1             	mov    %rdx,%rcx
+    1c82:	/-----|-- eb 79                	jmp    1cfd <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x8d>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1c84:	|     \-> 48 89 f9             	mov    %rdi,%rcx
+    1c87:	|         48 f7 d9             	neg    %rcx
+    1c8a:	|         83 e1 0f             	and    $0xf,%ecx
+    1c8d:	|         49 89 c8             	mov    %rcx,%r8
+    std::memcpy(d, s, n);
+    1c90:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1c92:	|         49 8d 70 40          	lea    0x40(%r8),%rsi
+    1c96:	|         48 89 f9             	mov    %rdi,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1c99:	|     /-> 0f 10 54 30 d0       	movups -0x30(%rax,%rsi,1),%xmm2
+    1c9e:	|     |   0f 10 4c 30 e0       	movups -0x20(%rax,%rsi,1),%xmm1
+    1ca3:	|     |   49 89 f0             	mov    %rsi,%r8
+    for (; i + 64 <= n; i += 64) {
+    1ca6:	|     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1caa:	|     |   0f 10 44 30 f0       	movups -0x10(%rax,%rsi,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1caf:	|     |   0f 10 5c 30 c0       	movups -0x40(%rax,%rsi,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    1cb4:	|     |   48 83 c6 40          	add    $0x40,%rsi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1cb8:	|     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    1cbd:	|     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    1cc2:	|     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    1cc7:	|     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    1ccc:	|     |   48 39 f2             	cmp    %rsi,%rdx
+    1ccf:	|     \-- 73 c8                	jae    1c99 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x29>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    1cd1:	|  /----> 49 8d 48 10          	lea    0x10(%r8),%rcx
+        stream16(d + i, load16(s + i));
+    1cd5:	|  |      4f 8d 0c 02          	lea    (%r10,%r8,1),%r9
+    for (; i + 16 <= n; i += 16) {
+    1cd9:	|  |      48 39 ca             	cmp    %rcx,%rdx
+    1cdc:	|  |  /-- 72 0f                	jb     1ced <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x7d>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1cde:	|  |  |   0f 10 64 08 f0       	movups -0x10(%rax,%rcx,1),%xmm4
+    1ce3:	|  |  |   49 89 c8             	mov    %rcx,%r8
+    1ce6:	|  |  |   66 41 0f e7 21       	movntdq %xmm4,(%r9)
+    for (; i + 16 <= n; i += 16) {
+    1ceb:	|  \--|-- eb e4                	jmp    1cd1 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x61>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    1ced:	|     \-> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    1cf0:	|         4c 29 c2             	sub    %r8,%rdx
+        stream16(d + i, load16(s + i));
+    1cf3:	|         4a 8d 34 00          	lea    (%rax,%r8,1),%rsi
+    std::memcpy(d, s, n);
+    1cf7:	|         4c 89 cf             	mov    %r9,%rdi
+    copy(d + i, s + i, n - i);
+    1cfa:	|         48 89 d1             	mov    %rdx,%rcx
+    std::memcpy(d, s, n);
+    1cfd:	\-------> f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1cff:	          c3                   	ret
+
+0000000000001d00 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    1d00:	          49 89 f8             	mov    %rdi,%r8
+    if (n < streaming_min) {
+    1d03:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1d0a:	/-------- 77 37                	ja     1d43 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x43>
+    Length done = (n < 16) ? n : 16;
+    1d0c:	|         b8 10 00 00 00       	mov    $0x10,%eax
+    1d11:	|         48 39 c2             	cmp    %rax,%rdx
+    1d14:	|         48 0f 46 c2          	cmovbe %rdx,%rax
+    std::memcpy(d, s, n);
+    1d18:	|         89 c1                	mov    %eax,%ecx
+    1d1a:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    1d1c:	|  /----> 48 39 d0             	cmp    %rdx,%rax
+    1d1f:	|  |  /-- 73 21                	jae    1d42 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42>
+        Length const m = (done < n - done) ? done : n - done;
+    1d21:	|  |  |   49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    1d24:	|  |  |   4d 8d 14 00          	lea    (%r8,%rax,1),%r10
+    std::memcpy(d, s, n);
+    1d28:	|  |  |   4c 89 c6             	mov    %r8,%rsi
+        Length const m = (done < n - done) ? done : n - done;
+    1d2b:	|  |  |   49 29 c1             	sub    %rax,%r9
+    std::memcpy(d, s, n);
+    1d2e:	|  |  |   4c 89 d7             	mov    %r10,%rdi
+        Length const m = (done < n - done) ? done : n - done;
+    1d31:	|  |  |   49 39 c1             	cmp    %rax,%r9
+    1d34:	|  |  |   4c 0f 47 c8          	cmova  %rax,%r9
+    std::memcpy(d, s, n);
+    1d38:	|  |  |   44 89 c9             	mov    %r9d,%ecx
+        done += m;
+    1d3b:	|  |  |   4c 01 c8             	add    %r9,%rax
+    std::memcpy(d, s, n);
+    1d3e:	|  |  |   f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+        done += m;
+    1d40:	|  \--|-- eb da                	jmp    1d1c <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c>
+    1d42:	|     \-> c3                   	ret
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1d43:	\-------> 48 89 f8             	mov    %rdi,%rax
+    for (Index i = 0; i < head; ++i) {
+    1d46:	          31 c9                	xor    %ecx,%ecx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1d48:	          48 f7 d8             	neg    %rax
+    1d4b:	          83 e0 0f             	and    $0xf,%eax
+    for (Index i = 0; i < head; ++i) {
+    1d4e:	   /----> 48 39 c1             	cmp    %rax,%rcx
+    1d51:	   |  /-- 74 0d                	je     1d60 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x60>
+        d[i] = p[i];
+    1d53:	   |  |   40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+    1d57:	   |  |   41 88 3c 08          	mov    %dil,(%r8,%rcx,1)
+    for (Index i = 0; i < head; ++i) {
+    1d5b:	   |  |   48 ff c1             	inc    %rcx
+    1d5e:	   \--|-- eb ee                	jmp    1d4e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4e>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    1d60:	      \-> 31 c9                	xor    %ecx,%ecx
+        rotated[i] = p[(head + i) % 16];
+    1d62:	      /-> 48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+    1d66:	      |   83 e7 0f             	and    $0xf,%edi
+    1d69:	      |   40 8a 3c 3e          	mov    (%rsi,%rdi,1),%dil
+    1d6d:	      |   40 88 7c 0c e8       	mov    %dil,-0x18(%rsp,%rcx,1)
+    for (Index i = 0; i < 16; ++i) {
+    1d72:	      |   48 ff c1             	inc    %rcx
+    1d75:	      |   48 83 f9 10          	cmp    $0x10,%rcx
+    1d79:	      \-- 75 e7                	jne    1d62 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x62>
+    std::memcpy(&v, s, sizeof(v));
+    1d7b:	          0f 28 44 24 e8       	movaps -0x18(%rsp),%xmm0
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1d80:	          48 8d 78 40          	lea    0x40(%rax),%rdi
+    1d84:	          4c 01 c0             	add    %r8,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1d87:	      /-> 48 89 f9             	mov    %rdi,%rcx
+    for (; i + 64 <= n; i += 64) {
+    1d8a:	      |   48 8d 7f 40          	lea    0x40(%rdi),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1d8e:	      |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    1d92:	      |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    1d97:	      |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    1d9c:	      |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    1da1:	      |   48 83 c0 40          	add    $0x40,%rax
+    1da5:	      |   48 39 fa             	cmp    %rdi,%rdx
+    1da8:	      \-- 73 dd                	jae    1d87 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x87>
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+        stream16(d + i, v);
+    1daa:	          49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    for (; i + 16 <= n; i += 16) {
+    1dae:	   /----> 48 8d 41 10          	lea    0x10(%rcx),%rax
+    1db2:	   |      48 39 c2             	cmp    %rax,%rdx
+    1db5:	   |  /-- 72 0a                	jb     1dc1 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc1>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1db7:	   |  |   48 89 c1             	mov    %rax,%rcx
+    1dba:	   |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    1dbf:	   \--|-- eb ed                	jmp    1dae <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xae>
+    }
+    __builtin_ia32_sfence();
+    1dc1:	      \-> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    1dc4:	   /----> 48 39 d1             	cmp    %rdx,%rcx
+    1dc7:	   |  /-- 73 12                	jae    1ddb <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xdb>
+        d[i] = p[i % 16];
+    1dc9:	   |  |   48 89 c8             	mov    %rcx,%rax
+    1dcc:	   |  |   83 e0 0f             	and    $0xf,%eax
+    1dcf:	   |  |   8a 04 06             	mov    (%rsi,%rax,1),%al
+    1dd2:	   |  |   41 88 04 08          	mov    %al,(%r8,%rcx,1)
+    for (; i < n; ++i) {
+    1dd6:	   |  |   48 ff c1             	inc    %rcx
+    1dd9:	   \--|-- eb e9                	jmp    1dc4 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc4>
+    }
+}
+    1ddb:	      \-> c3                   	ret
+
+0000000000001ddc <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    1ddc:	    48 85 ff             	test   %rdi,%rdi
+    1ddf:	/-- 74 09                	je     1dea <nel::free_aligned(void*)+0xe>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    1de1:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    1de5:	|   e9 46 f2 ff ff       	jmp    1030 <free@plt>
+}
+    1dea:	\-> c3                   	ret
+
+0000000000001deb <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    1deb:	       41 56                	push   %r14
+            : fn_name_(fn_name)
+    1ded:	       48 8d 05 3a 03 00 00 	lea    0x33a(%rip),%rax        # 212e <_IO_stdin_used+0x12e>
+    1df4:	       41 55                	push   %r13
+    1df6:	       41 54                	push   %r12
+    1df8:	       55                   	push   %rbp
+    1df9:	       53                   	push   %rbx
+    1dfa:	       48 83 ec 20          	sub    $0x20,%rsp
+    1dfe:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , file_name_(file_name)
+    1e03:	       48 8d 05 34 03 00 00 	lea    0x334(%rip),%rax        # 213e <_IO_stdin_used+0x13e>
+    1e0a:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1e0f:	       c7 44 24 18 f3 00 00 	movl   $0xf3,0x18(%rsp)
+    1e16:	       00 
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    1e17:	       48 85 f6             	test   %rsi,%rsi
+    1e1a:	/----- 74 28                	je     1e44 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1e1c:	|      4c 8d 66 ff          	lea    -0x1(%rsi),%r12
+    1e20:	|      48 89 f3             	mov    %rsi,%rbx
+    1e23:	|      49 21 f4             	and    %rsi,%r12
+    1e26:	+----- 75 1c                	jne    1e44 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1e28:	|      49 89 fd             	mov    %rdi,%r13
+    1e2b:	|      49 89 d6             	mov    %rdx,%r14
+    1e2e:	|      48 89 cd             	mov    %rcx,%rbp
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1e31:	|      31 ff                	xor    %edi,%edi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    1e33:	|      4d 85 ed             	test   %r13,%r13
+    1e36:	|  /-- 74 1d                	je     1e55 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+    1e38:	|  |   4d 8b 65 f8          	mov    -0x8(%r13),%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1e3c:	|  |   4c 89 ef             	mov    %r13,%rdi
+    1e3f:	|  |   4c 29 e7             	sub    %r12,%rdi
+    1e42:	|  +-- eb 11                	jmp    1e55 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    1e44:	\--|-> 48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    1e49:	   |   48 8d 3d 00 03 00 00 	lea    0x300(%rip),%rdi        # 2150 <_IO_stdin_used+0x150>
+    1e50:	   |   e8 cd f2 ff ff       	call   1122 <nel::assert_fail(char const*, nel::Context const&)>
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1e55:	   \-> 48 8d 34 2b          	lea    (%rbx,%rbp,1),%rsi
+    1e59:	       e8 32 f2 ff ff       	call   1090 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    1e5e:	       48 85 c0             	test   %rax,%rax
+    1e61:	/----- 74 3b                	je     1e9e <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb3>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1e63:	|      48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    1e68:	|      48 f7 db             	neg    %rbx
+    1e6b:	|      48 21 d9             	and    %rbx,%rcx
+    1e6e:	|      48 89 cb             	mov    %rcx,%rbx
+    1e71:	|      48 29 c3             	sub    %rax,%rbx
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    1e74:	|      4d 85 ed             	test   %r13,%r13
+    1e77:	|  /-- 74 1e                	je     1e97 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+    1e79:	|  |   49 39 dc             	cmp    %rbx,%r12
+    1e7c:	|  +-- 74 19                	je     1e97 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    1e7e:	|  |   4c 39 f5             	cmp    %r14,%rbp
+    1e81:	|  |   4c 89 f2             	mov    %r14,%rdx
+    1e84:	|  |   4a 8d 34 20          	lea    (%rax,%r12,1),%rsi
+    1e88:	|  |   48 89 cf             	mov    %rcx,%rdi
+    1e8b:	|  |   48 0f 46 d5          	cmovbe %rbp,%rdx
+    1e8f:	|  |   e8 0c f2 ff ff       	call   10a0 <memmove@plt>
+    1e94:	|  |   48 89 c1             	mov    %rax,%rcx
+    }
+    offset_field(new_p) = new_offset;
+    1e97:	|  \-> 48 89 59 f8          	mov    %rbx,-0x8(%rcx)
+    return new_p;
+    1e9b:	|      48 89 c8             	mov    %rcx,%rax
+}
+    1e9e:	\----> 48 83 c4 20          	add    $0x20,%rsp
+    1ea2:	       5b                   	pop    %rbx
+    1ea3:	       5d                   	pop    %rbp
+    1ea4:	       41 5c                	pop    %r12
+    1ea6:	       41 5d                	pop    %r13
+    1ea8:	       41 5e                	pop    %r14
+    1eaa:	       c3                   	ret
+
+0000000000001eab <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    1eab:	48 89 f1             	mov    %rsi,%rcx
+    return realloc_aligned(nullptr, align, 0, size);
+    1eae:	31 d2                	xor    %edx,%edx
+    1eb0:	48 89 fe             	mov    %rdi,%rsi
+    1eb3:	31 ff                	xor    %edi,%edi
+    1eb5:	e9 31 ff ff ff       	jmp    1deb <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+
+0000000000001eba <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1eba:	53                   	push   %rbx
+    1ebb:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    1ebe:	40 0f be fe          	movsbl %sil,%edi
+    1ec2:	48 8b 35 97 21 00 00 	mov    0x2197(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    1ec9:	e8 92 f1 ff ff       	call   1060 <fputc@plt>
+    return outs;
+}
+    1ece:	48 89 d8             	mov    %rbx,%rax
+    1ed1:	5b                   	pop    %rbx
+    1ed2:	c3                   	ret
+
+0000000000001ed3 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1ed3:	53                   	push   %rbx
+    1ed4:	48 89 fb             	mov    %rdi,%rbx
+    1ed7:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    1eda:	48 8b 35 7f 21 00 00 	mov    0x217f(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    1ee1:	e8 6a f1 ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    1ee6:	48 89 d8             	mov    %rbx,%rax
+    1ee9:	5b                   	pop    %rbx
+    1eea:	c3                   	ret
+
+0000000000001eeb <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1eeb:	53                   	push   %rbx
+    1eec:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    1eef:	48 8b 3d 6a 21 00 00 	mov    0x216a(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1ef6:	40 0f b6 d6          	movzbl %sil,%edx
+    1efa:	31 c0                	xor    %eax,%eax
+    1efc:	48 8d 35 68 02 00 00 	lea    0x268(%rip),%rsi        # 216b <_IO_stdin_used+0x16b>
+    1f03:	e8 78 f1 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1f08:	48 89 d8             	mov    %rbx,%rax
+    1f0b:	5b                   	pop    %rbx
+    1f0c:	c3                   	ret
+
+0000000000001f0d <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    1f0d:	53                   	push   %rbx
+    1f0e:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    1f11:	48 8b 3d 48 21 00 00 	mov    0x2148(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1f18:	0f b7 d6             	movzwl %si,%edx
+    1f1b:	31 c0                	xor    %eax,%eax
+    1f1d:	48 8d 35 47 02 00 00 	lea    0x247(%rip),%rsi        # 216b <_IO_stdin_used+0x16b>
+    1f24:	e8 57 f1 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1f29:	48 89 d8             	mov    %rbx,%rax
+    1f2c:	5b                   	pop    %rbx
+    1f2d:	c3                   	ret
+
+0000000000001f2e <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    1f2e:	53                   	push   %rbx
+    1f2f:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    1f32:	48 8b 3d 27 21 00 00 	mov    0x2127(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1f39:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    1f3b:	31 c0                	xor    %eax,%eax
+    1f3d:	48 8d 35 27 02 00 00 	lea    0x227(%rip),%rsi        # 216b <_IO_stdin_used+0x16b>
+    1f44:	e8 37 f1 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1f49:	48 89 d8             	mov    %rbx,%rax
+    1f4c:	5b                   	pop    %rbx
+    1f4d:	c3                   	ret
+
+0000000000001f4e <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    1f4e:	53                   	push   %rbx
+    1f4f:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    1f52:	48 8b 3d 07 21 00 00 	mov    0x2107(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1f59:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    1f5b:	31 c0                	xor    %eax,%eax
+    1f5d:	48 8d 35 07 02 00 00 	lea    0x207(%rip),%rsi        # 216b <_IO_stdin_used+0x16b>
+    1f64:	e8 17 f1 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1f69:	48 89 d8             	mov    %rbx,%rax
+    1f6c:	5b                   	pop    %rbx
+    1f6d:	c3                   	ret
+
+0000000000001f6e <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    1f6e:	53                   	push   %rbx
+    1f6f:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    1f72:	48 8b 3d e7 20 00 00 	mov    0x20e7(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1f79:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    1f7c:	31 c0                	xor    %eax,%eax
+    1f7e:	48 8d 35 e9 01 00 00 	lea    0x1e9(%rip),%rsi        # 216e <_IO_stdin_used+0x16e>
+    1f85:	e8 f6 f0 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1f8a:	48 89 d8             	mov    %rbx,%rax
+    1f8d:	5b                   	pop    %rbx
+    1f8e:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000001f90 <_fini>:
+    1f90:	48 83 ec 08          	sub    $0x8,%rsp
+    1f94:	48 83 c4 08          	add    $0x8,%rsp
+    1f98:	c3                   	ret
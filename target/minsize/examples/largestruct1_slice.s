@@ -0,0 +1,1600 @@
+
+target/minsize/examples/largestruct1_slice:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputc@plt>:
+    1060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 4018 <fputc@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <memcmp@plt>:
+    1070:	ff 25 aa 2f 00 00    	jmp    *0x2faa(%rip)        # 4020 <memcmp@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fprintf@plt>:
+    1080:	ff 25 a2 2f 00 00    	jmp    *0x2fa2(%rip)        # 4028 <fprintf@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <malloc@plt>:
+    1090:	ff 25 9a 2f 00 00    	jmp    *0x2f9a(%rip)        # 4030 <malloc@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <realloc@plt>:
+    10a0:	ff 25 92 2f 00 00    	jmp    *0x2f92(%rip)        # 4038 <realloc@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <memmove@plt>:
+    10b0:	ff 25 8a 2f 00 00    	jmp    *0x2f8a(%rip)        # 4040 <memmove@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010c0 <__cxa_finalize@plt>:
+    10c0:	ff 25 1a 2f 00 00    	jmp    *0x2f1a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10c6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010d0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10d0:	50                   	push   %rax
+    std::abort();
+    10d1:	e8 6a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010d6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10d6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10d7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10da:	4c 8d 0d db 0f 00 00 	lea    0xfdb(%rip),%r9        # 20bc <_IO_stdin_used+0xbc>
+    10e1:	31 c0                	xor    %eax,%eax
+    10e3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10e7:	4c 8b 07             	mov    (%rdi),%r8
+    10ea:	48 8d 35 d1 0f 00 00 	lea    0xfd1(%rip),%rsi        # 20c2 <_IO_stdin_used+0xc2>
+    10f1:	48 8b 3d 68 2f 00 00 	mov    0x2f68(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    10f8:	e8 83 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    10fd:	e8 3e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001102 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1102:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1106:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1109:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    110d:	31 c0                	xor    %eax,%eax
+    110f:	57                   	push   %rdi
+    1110:	48 8b 3d 49 2f 00 00 	mov    0x2f49(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1117:	4c 8d 0d 9e 0f 00 00 	lea    0xf9e(%rip),%r9        # 20bc <_IO_stdin_used+0xbc>
+    111e:	4c 8b 06             	mov    (%rsi),%r8
+    1121:	48 8d 35 ab 0f 00 00 	lea    0xfab(%rip),%rsi        # 20d3 <_IO_stdin_used+0xd3>
+    1128:	e8 53 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    112d:	e8 0e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001132 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1132:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1136:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1139:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    113d:	31 c0                	xor    %eax,%eax
+    113f:	57                   	push   %rdi
+    1140:	48 8b 3d 19 2f 00 00 	mov    0x2f19(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1147:	4c 8d 0d 9a 0f 00 00 	lea    0xf9a(%rip),%r9        # 20e8 <_IO_stdin_used+0xe8>
+    114e:	4c 8b 06             	mov    (%rsi),%r8
+    1151:	48 8d 35 7b 0f 00 00 	lea    0xf7b(%rip),%rsi        # 20d3 <_IO_stdin_used+0xd3>
+    1158:	e8 23 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    115d:	e8 de fe ff ff       	call   1040 <abort@plt>
+
+0000000000001162 <main>:
+    auto s1 = vec1.slice();
+    nel::log << s1.len() << '\n' << s1;
+}
+
+int main()
+{
+    1162:	53                   	push   %rbx
+    nel::log << "ex1:b" << '\n';
+    1163:	48 8d 1d ff 2e 00 00 	lea    0x2eff(%rip),%rbx        # 4069 <nel::log>
+    116a:	48 8d 35 e4 0e 00 00 	lea    0xee4(%rip),%rsi        # 2055 <_IO_stdin_used+0x55>
+    1171:	48 89 df             	mov    %rbx,%rdi
+    1174:	e8 b1 09 00 00       	call   1b2a <nel::operator<<(nel::Log&, char const*)>
+    1179:	be 0a 00 00 00       	mov    $0xa,%esi
+    117e:	48 89 c7             	mov    %rax,%rdi
+    1181:	e8 8b 09 00 00       	call   1b11 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    1186:	e8 ce 01 00 00       	call   1359 <ex1()>
+    nel::log << "ex1:e" << '\n';
+    118b:	48 89 df             	mov    %rbx,%rdi
+    118e:	48 8d 35 c6 0e 00 00 	lea    0xec6(%rip),%rsi        # 205b <_IO_stdin_used+0x5b>
+    1195:	e8 90 09 00 00       	call   1b2a <nel::operator<<(nel::Log&, char const*)>
+    119a:	be 0a 00 00 00       	mov    $0xa,%esi
+    119f:	48 89 c7             	mov    %rax,%rdi
+    11a2:	e8 6a 09 00 00       	call   1b11 <nel::operator<<(nel::Log&, char)>
+}
+    11a7:	31 c0                	xor    %eax,%eax
+    11a9:	5b                   	pop    %rbx
+    11aa:	c3                   	ret
+    11ab:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000000011b0 <_start>:
+    11b0:	31 ed                	xor    %ebp,%ebp
+    11b2:	49 89 d1             	mov    %rdx,%r9
+    11b5:	5e                   	pop    %rsi
+    11b6:	48 89 e2             	mov    %rsp,%rdx
+    11b9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    11bd:	50                   	push   %rax
+    11be:	54                   	push   %rsp
+    11bf:	45 31 c0             	xor    %r8d,%r8d
+    11c2:	31 c9                	xor    %ecx,%ecx
+    11c4:	48 8d 3d 97 ff ff ff 	lea    -0x69(%rip),%rdi        # 1162 <main>
+    11cb:	ff 15 ef 2d 00 00    	call   *0x2def(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    11d1:	f4                   	hlt
+    11d2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    11d9:	00 00 00 
+    11dc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000011e0 <deregister_tm_clones>:
+    11e0:	    48 8d 3d 71 2e 00 00 	lea    0x2e71(%rip),%rdi        # 4058 <__TMC_END__>
+    11e7:	    48 8d 05 6a 2e 00 00 	lea    0x2e6a(%rip),%rax        # 4058 <__TMC_END__>
+    11ee:	    48 39 f8             	cmp    %rdi,%rax
+    11f1:	/-- 74 15                	je     1208 <deregister_tm_clones+0x28>
+    11f3:	|   48 8b 05 ce 2d 00 00 	mov    0x2dce(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    11fa:	|   48 85 c0             	test   %rax,%rax
+    11fd:	+-- 74 09                	je     1208 <deregister_tm_clones+0x28>
+    11ff:	|   ff e0                	jmp    *%rax
+    1201:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1208:	\-> c3                   	ret
+    1209:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001210 <register_tm_clones>:
+    1210:	    48 8d 3d 41 2e 00 00 	lea    0x2e41(%rip),%rdi        # 4058 <__TMC_END__>
+    1217:	    48 8d 35 3a 2e 00 00 	lea    0x2e3a(%rip),%rsi        # 4058 <__TMC_END__>
+    121e:	    48 29 fe             	sub    %rdi,%rsi
+    1221:	    48 89 f0             	mov    %rsi,%rax
+    1224:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1228:	    48 c1 f8 03          	sar    $0x3,%rax
+    122c:	    48 01 c6             	add    %rax,%rsi
+    122f:	    48 d1 fe             	sar    %rsi
+    1232:	/-- 74 14                	je     1248 <register_tm_clones+0x38>
+    1234:	|   48 8b 05 9d 2d 00 00 	mov    0x2d9d(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    123b:	|   48 85 c0             	test   %rax,%rax
+    123e:	+-- 74 08                	je     1248 <register_tm_clones+0x38>
+    1240:	|   ff e0                	jmp    *%rax
+    1242:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1248:	\-> c3                   	ret
+    1249:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001250 <__do_global_dtors_aux>:
+    1250:	       f3 0f 1e fa          	endbr64
+    1254:	       80 3d 0d 2e 00 00 00 	cmpb   $0x0,0x2e0d(%rip)        # 4068 <completed.0>
+    125b:	/----- 75 2b                	jne    1288 <__do_global_dtors_aux+0x38>
+    125d:	|      55                   	push   %rbp
+    125e:	|      48 83 3d 7a 2d 00 00 	cmpq   $0x0,0x2d7a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1265:	|      00 
+    1266:	|      48 89 e5             	mov    %rsp,%rbp
+    1269:	|  /-- 74 0c                	je     1277 <__do_global_dtors_aux+0x27>
+    126b:	|  |   48 8b 3d de 2d 00 00 	mov    0x2dde(%rip),%rdi        # 4050 <__dso_handle>
+    1272:	|  |   e8 49 fe ff ff       	call   10c0 <__cxa_finalize@plt>
+    1277:	|  \-> e8 64 ff ff ff       	call   11e0 <deregister_tm_clones>
+    127c:	|      c6 05 e5 2d 00 00 01 	movb   $0x1,0x2de5(%rip)        # 4068 <completed.0>
+    1283:	|      5d                   	pop    %rbp
+    1284:	|      c3                   	ret
+    1285:	|      0f 1f 00             	nopl   (%rax)
+    1288:	\----> c3                   	ret
+    1289:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001290 <frame_dummy>:
+    1290:	f3 0f 1e fa          	endbr64
+    1294:	e9 77 ff ff ff       	jmp    1210 <register_tm_clones>
+    1299:	90                   	nop
+
+000000000000129a <operator<<(nel::Log&, U8Buf<256ul> const&) [clone .isra.0]>:
+    129a:	    41 54                	push   %r12
+    129c:	    49 89 f4             	mov    %rsi,%r12
+    129f:	    48 8d 35 5e 0d 00 00 	lea    0xd5e(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    12a6:	    55                   	push   %rbp
+    12a7:	    bd 01 00 00 00       	mov    $0x1,%ebp
+    12ac:	    53                   	push   %rbx
+    12ad:	    48 89 fb             	mov    %rdi,%rbx
+    12b0:	    e8 75 08 00 00       	call   1b2a <nel::operator<<(nel::Log&, char const*)>
+    12b5:	    be 00 01 00 00       	mov    $0x100,%esi
+    12ba:	    48 89 c7             	mov    %rax,%rdi
+    12bd:	    e8 03 09 00 00       	call   1bc5 <nel::operator<<(nel::Log&, unsigned long)>
+    12c2:	    48 8d 35 42 0d 00 00 	lea    0xd42(%rip),%rsi        # 200b <_IO_stdin_used+0xb>
+    12c9:	    48 89 c7             	mov    %rax,%rdi
+    12cc:	    e8 59 08 00 00       	call   1b2a <nel::operator<<(nel::Log&, char const*)>
+    12d1:	    41 0f b6 34 24       	movzbl (%r12),%esi
+    12d6:	    48 89 df             	mov    %rbx,%rdi
+    12d9:	    e8 64 08 00 00       	call   1b42 <nel::operator<<(nel::Log&, unsigned char)>
+    12de:	/-> be 20 00 00 00       	mov    $0x20,%esi
+    12e3:	|   48 89 df             	mov    %rbx,%rdi
+    12e6:	|   e8 26 08 00 00       	call   1b11 <nel::operator<<(nel::Log&, char)>
+    12eb:	|   41 0f b6 34 2c       	movzbl (%r12,%rbp,1),%esi
+    12f0:	|   48 ff c5             	inc    %rbp
+    12f3:	|   48 89 c7             	mov    %rax,%rdi
+    12f6:	|   e8 47 08 00 00       	call   1b42 <nel::operator<<(nel::Log&, unsigned char)>
+    12fb:	|   48 81 fd 00 01 00 00 	cmp    $0x100,%rbp
+    1302:	\-- 75 da                	jne    12de <operator<<(nel::Log&, U8Buf<256ul> const&) [clone .isra.0]+0x44>
+    1304:	    48 89 df             	mov    %rbx,%rdi
+    1307:	    be 7d 00 00 00       	mov    $0x7d,%esi
+    130c:	    5b                   	pop    %rbx
+    130d:	    5d                   	pop    %rbp
+    130e:	    41 5c                	pop    %r12
+    1310:	    e9 fc 07 00 00       	jmp    1b11 <nel::operator<<(nel::Log&, char)>
+    1315:	    90                   	nop
+
+0000000000001316 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>:
+         *
+         * @returns true if container contains a Ok, false otherwise.
+         *
+         * `this` is not consumed by this op.
+         */
+        constexpr bool is_ok(Context const &ctx = Context()) const
+    1316:	          52                   	push   %rdx
+            switch (tag_) { // result<void>-match
+    1317:	          85 ff                	test   %edi,%edi
+    1319:	   /----- 74 10                	je     132b <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]+0x15>
+    131b:	   |      ff cf                	dec    %edi
+    131d:	   |      83 ff 01             	cmp    $0x1,%edi
+    1320:	/--|----- 76 15                	jbe    1337 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]+0x21>
+                    nel::panic("bad Result", ctx);
+    1322:	|  |      48 8d 3d f4 0c 00 00 	lea    0xcf4(%rip),%rdi        # 201d <_IO_stdin_used+0x1d>
+    1329:	|  |  /-- eb 07                	jmp    1332 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]+0x1c>
+                    nel::panic("invalid Result", ctx);
+    132b:	|  \--|-> 48 8d 3d dc 0c 00 00 	lea    0xcdc(%rip),%rdi        # 200e <_IO_stdin_used+0xe>
+                    nel::panic("bad Result", ctx);
+    1332:	|     \-> e8 cb fd ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+        {
+            return match<bool>([](void) -> bool { return true; },
+                               [](E const &) -> bool { return false; },
+                               ctx);
+        }
+    1337:	\-------> 58                   	pop    %rax
+    1338:	          c3                   	ret
+
+0000000000001339 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    1339:	83 c8 ff             	or     $0xffffffff,%eax
+    133c:	c3                   	ret
+
+000000000000133d <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    133d:	83 c8 ff             	or     $0xffffffff,%eax
+    1340:	c3                   	ret
+
+0000000000001341 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    1341:	83 c8 ff             	or     $0xffffffff,%eax
+    1344:	c3                   	ret
+
+0000000000001345 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    1345:	83 c8 ff             	or     $0xffffffff,%eax
+    1348:	c3                   	ret
+
+0000000000001349 <_read_r>:
+int _read_r(struct _reent *, int) {
+    1349:	83 c8 ff             	or     $0xffffffff,%eax
+    134c:	c3                   	ret
+
+000000000000134d <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    134d:	83 c8 ff             	or     $0xffffffff,%eax
+    1350:	c3                   	ret
+
+0000000000001351 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    1351:	83 c8 ff             	or     $0xffffffff,%eax
+    1354:	c3                   	ret
+
+0000000000001355 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1355:	83 c8 ff             	or     $0xffffffff,%eax
+    1358:	c3                   	ret
+
+0000000000001359 <ex1()>:
+{
+    1359:	          41 57                	push   %r15
+        //     // p % alignment == 0?
+        //     return ((Length)p & (align-1)) == 0;
+        // }
+        static Node *malloc(Count capacity)
+        {
+            Node *new_n = realloc(nullptr, capacity);
+    135b:	          31 ff                	xor    %edi,%edi
+    135d:	          be 05 00 00 00       	mov    $0x5,%esi
+    1362:	          41 56                	push   %r14
+    1364:	          41 55                	push   %r13
+    1366:	          41 54                	push   %r12
+    1368:	          55                   	push   %rbp
+    1369:	          53                   	push   %rbx
+    136a:	          48 81 ec 38 01 00 00 	sub    $0x138,%rsp
+    1371:	          e8 57 02 00 00       	call   15cd <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)>
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    1376:	          48 85 c0             	test   %rax,%rax
+    1379:	      /-- 74 06                	je     1381 <ex1()+0x28>
+    137b:	      |   31 d2                	xor    %edx,%edx
+    137d:	      |   48 89 50 08          	mov    %rdx,0x8(%rax)
+    vec1.push((uint8_t)0x67).is_ok();
+    1381:	      \-> 48 8d 5c 24 2c       	lea    0x2c(%rsp),%rbx
+    1386:	          4c 8d 7c 24 07       	lea    0x7(%rsp),%r15
+        constexpr Vector(Vector const &o) = delete;
+        constexpr Vector &operator=(Vector const &o) = delete;
+
+        // moving ok.
+        constexpr Vector(Vector &&o)
+            : item_(move(o.item_))
+    138b:	          48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1390:	          4c 8d 74 24 08       	lea    0x8(%rsp),%r14
+    1395:	          4c 89 fa             	mov    %r15,%rdx
+    1398:	          48 89 df             	mov    %rbx,%rdi
+    139b:	          c6 44 24 07 67       	movb   $0x67,0x7(%rsp)
+    13a0:	          4c 89 f6             	mov    %r14,%rsi
+    13a3:	          48 8d 6c 24 10       	lea    0x10(%rsp),%rbp
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+            , file_name_(file_name)
+    13a8:	          4c 8d 25 7d 0c 00 00 	lea    0xc7d(%rip),%r12        # 202c <_IO_stdin_used+0x2c>
+    13af:	          e8 ca 03 00 00       	call   177e <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    13b4:	          8b 7c 24 2c          	mov    0x2c(%rsp),%edi
+    13b8:	          48 89 ee             	mov    %rbp,%rsi
+            : fn_name_(fn_name)
+    13bb:	          4c 8d 2d 66 0c 00 00 	lea    0xc66(%rip),%r13        # 2028 <_IO_stdin_used+0x28>
+            , file_name_(file_name)
+    13c2:	          4c 89 64 24 18       	mov    %r12,0x18(%rsp)
+            : fn_name_(fn_name)
+    13c7:	          4c 89 6c 24 10       	mov    %r13,0x10(%rsp)
+            , line_num_(line_num)
+    13cc:	          c7 44 24 20 0f 00 00 	movl   $0xf,0x20(%rsp)
+    13d3:	          00 
+    13d4:	          e8 3d ff ff ff       	call   1316 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>
+    13d9:	          48 89 df             	mov    %rbx,%rdi
+    13dc:	          e8 9d 01 00 00       	call   157e <nel::Result<void, U8Buf<256ul> >::~Result()>
+    vec1.push((uint8_t)0x68).is_ok();
+    13e1:	          4c 89 fa             	mov    %r15,%rdx
+    13e4:	          4c 89 f6             	mov    %r14,%rsi
+    13e7:	          48 89 df             	mov    %rbx,%rdi
+    13ea:	          c6 44 24 07 68       	movb   $0x68,0x7(%rsp)
+    13ef:	          e8 8a 03 00 00       	call   177e <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    13f4:	          8b 7c 24 2c          	mov    0x2c(%rsp),%edi
+    13f8:	          48 89 ee             	mov    %rbp,%rsi
+            , file_name_(file_name)
+    13fb:	          4c 89 64 24 18       	mov    %r12,0x18(%rsp)
+            : fn_name_(fn_name)
+    1400:	          4c 89 6c 24 10       	mov    %r13,0x10(%rsp)
+            , line_num_(line_num)
+    1405:	          c7 44 24 20 10 00 00 	movl   $0x10,0x20(%rsp)
+    140c:	          00 
+    140d:	          e8 04 ff ff ff       	call   1316 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>
+    1412:	          48 89 df             	mov    %rbx,%rdi
+    1415:	          e8 64 01 00 00       	call   157e <nel::Result<void, U8Buf<256ul> >::~Result()>
+    vec1.push((uint8_t)0x69).is_ok();
+    141a:	          4c 89 fa             	mov    %r15,%rdx
+    141d:	          4c 89 f6             	mov    %r14,%rsi
+    1420:	          48 89 df             	mov    %rbx,%rdi
+    1423:	          c6 44 24 07 69       	movb   $0x69,0x7(%rsp)
+    1428:	          e8 51 03 00 00       	call   177e <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    142d:	          8b 7c 24 2c          	mov    0x2c(%rsp),%edi
+    1431:	          48 89 ee             	mov    %rbp,%rsi
+            , file_name_(file_name)
+    1434:	          4c 89 64 24 18       	mov    %r12,0x18(%rsp)
+            : fn_name_(fn_name)
+    1439:	          4c 89 6c 24 10       	mov    %r13,0x10(%rsp)
+            , line_num_(line_num)
+    143e:	          c7 44 24 20 11 00 00 	movl   $0x11,0x20(%rsp)
+    1445:	          00 
+    1446:	          e8 cb fe ff ff       	call   1316 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>
+    144b:	          48 89 df             	mov    %rbx,%rdi
+    144e:	          e8 2b 01 00 00       	call   157e <nel::Result<void, U8Buf<256ul> >::~Result()>
+    auto s1 = vec1.slice();
+    1453:	          4c 8b 64 24 08       	mov    0x8(%rsp),%r12
+         *
+         * @returns a slice over the the vector.
+         */
+        constexpr Slice<Type> slice(void)
+        {
+            return (item_ == nullptr) ? Slice<Type>::empty() : item_->slice();
+    1458:	          4d 85 e4             	test   %r12,%r12
+    145b:	   /----- 74 0c                	je     1469 <ex1()+0x110>
+            return alloc_;
+        }
+
+        constexpr Length len(void) const
+        {
+            return len_;
+    145d:	   |      49 8b 6c 24 08       	mov    0x8(%r12),%rbp
+        }
+
+    public:
+        constexpr Slice<Type> slice(void)
+        {
+            return Slice(values_, len());
+    1462:	   |      49 8d 5c 24 10       	lea    0x10(%r12),%rbx
+    1467:	   |  /-- eb 04                	jmp    146d <ex1()+0x114>
+        // Implicit start at 0.
+        Length len_;
+
+    private:
+        constexpr Slice(void)
+            : content_(nullptr)
+    1469:	   \--|-> 31 db                	xor    %ebx,%ebx
+            , len_(0)
+    146b:	      |   31 ed                	xor    %ebp,%ebp
+    nel::log << s1.len() << '\n' << s1;
+    146d:	      \-> 48 89 ee             	mov    %rbp,%rsi
+    1470:	          48 8d 3d f2 2b 00 00 	lea    0x2bf2(%rip),%rdi        # 4069 <nel::log>
+    1477:	          e8 49 07 00 00       	call   1bc5 <nel::operator<<(nel::Log&, unsigned long)>
+    147c:	          be 0a 00 00 00       	mov    $0xa,%esi
+    1481:	          48 89 c7             	mov    %rax,%rdi
+    1484:	          e8 88 06 00 00       	call   1b11 <nel::operator<<(nel::Log&, char)>
+        // instead of insert into log, can it format into ? which log implements?
+        // so it doesn't matter about the destination..
+        // and can format-insert into any char endpoint.
+        friend Log &operator<<(Log &outs, Slice const &v)
+        {
+            outs << "Slice(" << v.len() << "){";
+    1489:	          48 8d 35 bb 0b 00 00 	lea    0xbbb(%rip),%rsi        # 204b <_IO_stdin_used+0x4b>
+    1490:	          48 89 c7             	mov    %rax,%rdi
+    1493:	          49 89 c5             	mov    %rax,%r13
+    1496:	          e8 8f 06 00 00       	call   1b2a <nel::operator<<(nel::Log&, char const*)>
+    149b:	          48 89 ee             	mov    %rbp,%rsi
+        }
+
+    public:
+        constexpr SliceIterator(T arr[], Count len)
+            : b_(arr)
+            , e_(arr + len)
+    149e:	          48 c1 e5 08          	shl    $0x8,%rbp
+            outs << "Slice(" << v.len() << "){";
+    14a2:	          48 89 c7             	mov    %rax,%rdi
+            , e_(arr + len)
+    14a5:	          48 01 dd             	add    %rbx,%rbp
+            outs << "Slice(" << v.len() << "){";
+    14a8:	          e8 18 07 00 00       	call   1bc5 <nel::operator<<(nel::Log&, unsigned long)>
+    14ad:	          48 8d 35 9e 0b 00 00 	lea    0xb9e(%rip),%rsi        # 2052 <_IO_stdin_used+0x52>
+    14b4:	          48 89 c7             	mov    %rax,%rdi
+    14b7:	          e8 6e 06 00 00       	call   1b2a <nel::operator<<(nel::Log&, char const*)>
+            if (it) {
+    14bc:	          48 39 dd             	cmp    %rbx,%rbp
+    14bf:	      /-- 75 33                	jne    14f4 <ex1()+0x19b>
+            outs << '}';
+    14c1:	   /--|-> be 7d 00 00 00       	mov    $0x7d,%esi
+    14c6:	   |  |   4c 89 ef             	mov    %r13,%rdi
+    14c9:	   |  |   e8 43 06 00 00       	call   1b11 <nel::operator<<(nel::Log&, char)>
+            if (old == nullptr) { return; }
+    14ce:	   |  |   4d 85 e4             	test   %r12,%r12
+    14d1:	/--|--|-- 74 4d                	je     1520 <ex1()+0x1c7>
+            old->~Node();
+    14d3:	|  |  |   4c 89 e7             	mov    %r12,%rdi
+    14d6:	|  |  |   e8 85 03 00 00       	call   1860 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::~Node()>
+}
+    14db:	|  |  |   48 81 c4 38 01 00 00 	add    $0x138,%rsp
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    14e2:	|  |  |   4c 89 e7             	mov    %r12,%rdi
+    14e5:	|  |  |   5b                   	pop    %rbx
+    14e6:	|  |  |   5d                   	pop    %rbp
+    14e7:	|  |  |   41 5c                	pop    %r12
+    14e9:	|  |  |   41 5d                	pop    %r13
+    14eb:	|  |  |   41 5e                	pop    %r14
+    14ed:	|  |  |   41 5f                	pop    %r15
+    14ef:	|  |  |   e9 3c fb ff ff       	jmp    1030 <free@plt>
+                outs << *it;
+    14f4:	|  |  \-> 48 89 de             	mov    %rbx,%rsi
+    14f7:	|  |      4c 89 ef             	mov    %r13,%rdi
+                it.for_each([&outs](T const &e) { outs << ' ' << e; });
+    14fa:	|  |  /-> e8 9b fd ff ff       	call   129a <operator<<(nel::Log&, U8Buf<256ul> const&) [clone .isra.0]>
+        constexpr bool is_done(void) const
+        {
+            return (b_ == e_);
+        }
+
+        void inc(void)
+    14ff:	|  |  |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+        template<typename F>
+        void for_each2(F &&fn)
+#        endif
+        {
+#        if 1
+            for (; !self().is_done(); self().inc()) {
+    1506:	|  |  |   48 39 dd             	cmp    %rbx,%rbp
+    1509:	|  \--|-- 74 b6                	je     14c1 <ex1()+0x168>
+                it.for_each([&outs](T const &e) { outs << ' ' << e; });
+    150b:	|     |   be 20 00 00 00       	mov    $0x20,%esi
+    1510:	|     |   4c 89 ef             	mov    %r13,%rdi
+    1513:	|     |   e8 f9 05 00 00       	call   1b11 <nel::operator<<(nel::Log&, char)>
+    1518:	|     |   48 89 de             	mov    %rbx,%rsi
+    151b:	|     |   48 89 c7             	mov    %rax,%rdi
+    151e:	|     \-- eb da                	jmp    14fa <ex1()+0x1a1>
+    1520:	\-------> 48 81 c4 38 01 00 00 	add    $0x138,%rsp
+    1527:	          5b                   	pop    %rbx
+    1528:	          5d                   	pop    %rbp
+    1529:	          41 5c                	pop    %r12
+    152b:	          41 5d                	pop    %r13
+    152d:	          41 5e                	pop    %r14
+    152f:	          41 5f                	pop    %r15
+    1531:	          c3                   	ret
+
+0000000000001532 <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+            switch (tag_) { // result::dtor
+    1532:	    83 3f 02             	cmpl   $0x2,(%rdi)
+    1535:	/-- 76 35                	jbe    156c <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x3a>
+        constexpr ~Result(void)
+    1537:	|   48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    153b:	|   48 8d 05 1f 0b 00 00 	lea    0xb1f(%rip),%rax        # 2061 <_IO_stdin_used+0x61>
+                    nel::panic("bad Result");
+    1542:	|   48 8d 3d d4 0a 00 00 	lea    0xad4(%rip),%rdi        # 201d <_IO_stdin_used+0x1d>
+    1549:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    154e:	|   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    1553:	|   48 8d 05 0f 0b 00 00 	lea    0xb0f(%rip),%rax        # 2069 <_IO_stdin_used+0x69>
+    155a:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    155f:	|   c7 44 24 18 72 00 00 	movl   $0x72,0x18(%rsp)
+    1566:	|   00 
+    1567:	|   e8 96 fb ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+    156c:	\-> c3                   	ret
+    156d:	    90                   	nop
+
+000000000000156e <U8Buf<256ul>::~U8Buf()>:
+    nel::log << "ex1:e" << '\n';
+    156e:	ba 00 01 00 00       	mov    $0x100,%edx
+    1573:	be a5 00 00 00       	mov    $0xa5,%esi
+    1578:	e9 15 03 00 00       	jmp    1892 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    157d:	90                   	nop
+
+000000000000157e <nel::Result<void, U8Buf<256ul> >::~Result()>:
+            switch (tag_) { // result<void>-dtor
+    157e:	       8b 07                	mov    (%rdi),%eax
+    1580:	       83 f8 01             	cmp    $0x1,%eax
+    1583:	   /-- 7f 05                	jg     158a <nel::Result<void, U8Buf<256ul> >::~Result()+0xc>
+    1585:	   |   85 c0                	test   %eax,%eax
+    1587:	/--|-- 78 0f                	js     1598 <nel::Result<void, U8Buf<256ul> >::~Result()+0x1a>
+    1589:	|  |   c3                   	ret
+    158a:	|  \-> 83 f8 02             	cmp    $0x2,%eax
+    158d:	+----- 75 09                	jne    1598 <nel::Result<void, U8Buf<256ul> >::~Result()+0x1a>
+
+    private:
+        Type value_;
+
+    public:
+        constexpr ~Element(void) = default;
+    158f:	|      48 83 c7 04          	add    $0x4,%rdi
+    1593:	|      e9 d6 ff ff ff       	jmp    156e <U8Buf<256ul>::~U8Buf()>
+        constexpr ~Result(void)
+    1598:	\----> 48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    159c:	       48 8d 05 be 0a 00 00 	lea    0xabe(%rip),%rax        # 2061 <_IO_stdin_used+0x61>
+                    nel::panic("bad Result");
+    15a3:	       48 8d 3d 73 0a 00 00 	lea    0xa73(%rip),%rdi        # 201d <_IO_stdin_used+0x1d>
+    15aa:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    15af:	       48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    15b4:	       48 8d 05 ae 0a 00 00 	lea    0xaae(%rip),%rax        # 2069 <_IO_stdin_used+0x69>
+    15bb:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    15c0:	       c7 44 24 18 dd 02 00 	movl   $0x2dd,0x18(%rsp)
+    15c7:	       00 
+    15c8:	       e8 35 fb ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+
+00000000000015cd <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)>:
+            if (new_cap > max_capacity) { return nullptr; }
+    15cd:	                48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    15d4:	                ff 7f 00 
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    15d7:	                41 57                	push   %r15
+    15d9:	                41 56                	push   %r14
+    15db:	                41 55                	push   %r13
+    15dd:	                41 54                	push   %r12
+    15df:	                55                   	push   %rbp
+    15e0:	                53                   	push   %rbx
+    15e1:	                48 83 ec 48          	sub    $0x48,%rsp
+            if (new_cap > max_capacity) { return nullptr; }
+    15e5:	                48 39 f0             	cmp    %rsi,%rax
+    15e8:	   /----------- 0f 82 a3 00 00 00    	jb     1691 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0xc4>
+    15ee:	   |            48 89 fb             	mov    %rdi,%rbx
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    15f1:	   |            48 89 f7             	mov    %rsi,%rdi
+    15f4:	   |            49 89 f6             	mov    %rsi,%r14
+    15f7:	   |            48 c1 e7 08          	shl    $0x8,%rdi
+    15fb:	   |            48 83 c7 10          	add    $0x10,%rdi
+                                    : std::realloc(p, new_size);
+    15ff:	   |            e8 8c fa ff ff       	call   1090 <malloc@plt>
+            if (new_p == nullptr) {
+    1604:	   |            48 85 c0             	test   %rax,%rax
+    1607:	   |     /----- 75 12                	jne    161b <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x4e>
+            : tag_(Tag::ERR)
+    1609:	   |     |      c7 44 24 18 02 00 00 	movl   $0x2,0x18(%rsp)
+    1610:	   |     |      00 
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+            : value_(forward<Type>(val))
+    1611:	   |     |      c7 44 24 20 01 00 00 	movl   $0x1,0x20(%rsp)
+    1618:	   |     |      00 
+    1619:	   |     |  /-- eb 0d                	jmp    1628 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x5b>
+            : tag_(Tag::OK)
+    161b:	   |     \--|-> c7 44 24 18 01 00 00 	movl   $0x1,0x18(%rsp)
+    1622:	   |        |   00 
+        {
+        }
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+            : value_(forward<Args>(args)...)
+    1623:	   |        |   48 89 44 24 20       	mov    %rax,0x20(%rsp)
+            : fn_name_(fn_name)
+    1628:	   |        \-> 48 8d 05 4c 0a 00 00 	lea    0xa4c(%rip),%rax        # 207b <_IO_stdin_used+0x7b>
+            , line_num_(line_num)
+    162f:	   |            c7 44 24 38 8e 00 00 	movl   $0x8e,0x38(%rsp)
+    1636:	   |            00 
+            : fn_name_(fn_name)
+    1637:	   |            48 89 44 24 28       	mov    %rax,0x28(%rsp)
+            , file_name_(file_name)
+    163c:	   |            48 8d 05 40 0a 00 00 	lea    0xa40(%rip),%rax        # 2083 <_IO_stdin_used+0x83>
+    1643:	   |            48 89 44 24 30       	mov    %rax,0x30(%rsp)
+    1648:	   |            8b 44 24 18          	mov    0x18(%rsp),%eax
+            switch (tag_) { // result-match
+    164c:	   |            83 f8 01             	cmp    $0x1,%eax
+    164f:	   |     /----- 74 21                	je     1672 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0xa5>
+    1651:	   |     |      83 f8 02             	cmp    $0x2,%eax
+    1654:	   |  /--|----- 74 31                	je     1687 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0xba>
+    1656:	   |  |  |      85 c0                	test   %eax,%eax
+                    nel::panic("invalid Result", ctx);
+    1658:	   |  |  |      48 8d 3d af 09 00 00 	lea    0x9af(%rip),%rdi        # 200e <_IO_stdin_used+0xe>
+    165f:	   |  |  |      48 8d 74 24 28       	lea    0x28(%rsp),%rsi
+            switch (tag_) { // result-match
+    1664:	   |  |  |  /-- 74 07                	je     166d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0xa0>
+                    nel::panic("bad Result", ctx);
+    1666:	   |  |  |  |   48 8d 3d b0 09 00 00 	lea    0x9b0(%rip),%rdi        # 201d <_IO_stdin_used+0x1d>
+    166d:	   |  |  |  \-> e8 90 fa ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+            tag_ = Tag::INVAL;
+    1672:	   |  |  \----> 31 c0                	xor    %eax,%eax
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    1674:	   |  |         4c 8b 6c 24 20       	mov    0x20(%rsp),%r13
+            tag_ = Tag::INVAL;
+    1679:	   |  |         89 44 24 18          	mov    %eax,0x18(%rsp)
+                if (old_n != nullptr) {
+    167d:	   |  |         48 85 db             	test   %rbx,%rbx
+    1680:	   |  |     /-- 75 17                	jne    1699 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0xcc>
+    1682:	/--|--|-----|-- e9 d6 00 00 00       	jmp    175d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x190>
+            }
+    1687:	|  |  \-----|-> 48 8d 7c 24 18       	lea    0x18(%rsp),%rdi
+    168c:	|  |        |   e8 a1 fe ff ff       	call   1532 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+            if (new_cap > max_capacity) { return nullptr; }
+    1691:	|  \--------|-> 45 31 ed             	xor    %r13d,%r13d
+    1694:	|  /--------|-- e9 d2 00 00 00       	jmp    176b <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x19e>
+                    nel::assert(old_n->len_ <= new_cap, "heaped::Node: shrinking below len");
+    1699:	|  |        \-> 48 8b 43 08          	mov    0x8(%rbx),%rax
+            , line_num_(line_num)
+    169d:	|  |            c7 44 24 38 91 00 00 	movl   $0x91,0x38(%rsp)
+    16a4:	|  |            00 
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    16a5:	|  |            49 39 c6             	cmp    %rax,%r14
+    16a8:	|  |        /-- 73 11                	jae    16bb <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0xee>
+    16aa:	|  |        |   48 8d 74 24 28       	lea    0x28(%rsp),%rsi
+    16af:	|  |        |   48 8d 3d e4 09 00 00 	lea    0x9e4(%rip),%rdi        # 209a <_IO_stdin_used+0x9a>
+    16b6:	|  |        |   e8 77 fa ff ff       	call   1132 <nel::assert_fail(char const*, nel::Context const&)>
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    16bb:	|  |        \-> 48 8d 6b 10          	lea    0x10(%rbx),%rbp
+    16bf:	|  |            4d 8d 65 10          	lea    0x10(%r13),%r12
+                    new_n->len_ = old_n->len_;
+    16c3:	|  |            49 89 45 08          	mov    %rax,0x8(%r13)
+void relocate(uint8_t *const d, uint8_t *const s, Length const n);
+
+template<typename T>
+void relocate(T d[], T s[], Length const n)
+{
+    if (d == s) { return; }
+    16c7:	|  |            4c 39 e5             	cmp    %r12,%rbp
+    16ca:	|  |        /-- 75 0d                	jne    16d9 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x10c>
+                std::free(p);
+    16cc:	|  |     /--|-> 48 89 df             	mov    %rbx,%rdi
+    16cf:	|  |     |  |   e8 5c f9 ff ff       	call   1030 <free@plt>
+    16d4:	+--|-----|--|-- e9 84 00 00 00       	jmp    175d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x190>
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    16d9:	|  |     |  \-> 4c 8b 7b 08          	mov    0x8(%rbx),%r15
+    if constexpr (is_trivially_relocatable<T>) {
+        relocate(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t *>(s), n * sizeof(T));
+    } else if (d < s) {
+    16dd:	|  |     |      49 39 ec             	cmp    %rbp,%r12
+    16e0:	|  |     |  /-- 72 10                	jb     16f2 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x125>
+    16e2:	|  |     |  |   4c 89 fd             	mov    %r15,%rbp
+    16e5:	|  |     |  |   48 c1 e5 08          	shl    $0x8,%rbp
+    16e9:	|  |     |  |   48 81 ed f0 00 00 00 	sub    $0xf0,%rbp
+    16f0:	|  |  /--|--|-- eb 3c                	jmp    172e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x161>
+        // forwards, so overlap is not overwritten before it is read.
+        for (Index i = 0; i < n; ++i) {
+    16f2:	|  |  |  |  \-> 31 c0                	xor    %eax,%eax
+    16f4:	|  |  |  |  /-> 49 39 c7             	cmp    %rax,%r15
+    16f7:	|  |  |  +--|-- 74 d3                	je     16cc <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0xff>
+            nel::elem::copy(data_, o.data_, N);
+        }
+
+        constexpr U8Buf(U8Buf &&o)
+        {
+            nel::elem::move(data_, o.data_, N);
+    16f9:	|  |  |  |  |   48 89 ee             	mov    %rbp,%rsi
+    16fc:	|  |  |  |  |   4c 89 e7             	mov    %r12,%rdi
+    16ff:	|  |  |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1704:	|  |  |  |  |   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1709:	|  |  |  |  |   e8 8c 01 00 00       	call   189a <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            new (&d[i]) T(nel::move(s[i]));
+            s[i].~T();
+    170e:	|  |  |  |  |   48 89 ef             	mov    %rbp,%rdi
+    1711:	|  |  |  |  |   49 81 c4 00 01 00 00 	add    $0x100,%r12
+    1718:	|  |  |  |  |   48 81 c5 00 01 00 00 	add    $0x100,%rbp
+    171f:	|  |  |  |  |   e8 4a fe ff ff       	call   156e <U8Buf<256ul>::~U8Buf()>
+        for (Index i = 0; i < n; ++i) {
+    1724:	|  |  |  |  |   48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    1729:	|  |  |  |  |   48 ff c0             	inc    %rax
+    172c:	|  |  |  |  \-- eb c6                	jmp    16f4 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x127>
+        }
+    } else {
+        // backwards, so overlap is not overwritten before it is read.
+        for (Index i = n; i > 0; --i) {
+    172e:	|  |  >--|----> 4d 85 ff             	test   %r15,%r15
+    1731:	|  |  |  \----- 74 99                	je     16cc <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0xff>
+            new (&d[i - 1]) T(nel::move(s[i - 1]));
+    1733:	|  |  |         4c 8d 24 2b          	lea    (%rbx,%rbp,1),%r12
+    1737:	|  |  |         49 8d 7c 2d 00       	lea    0x0(%r13,%rbp,1),%rdi
+    173c:	|  |  |         ba 00 01 00 00       	mov    $0x100,%edx
+        for (Index i = n; i > 0; --i) {
+    1741:	|  |  |         49 ff cf             	dec    %r15
+    1744:	|  |  |         4c 89 e6             	mov    %r12,%rsi
+    1747:	|  |  |         48 81 ed 00 01 00 00 	sub    $0x100,%rbp
+    174e:	|  |  |         e8 47 01 00 00       	call   189a <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            s[i - 1].~T();
+    1753:	|  |  |         4c 89 e7             	mov    %r12,%rdi
+    1756:	|  |  |         e8 13 fe ff ff       	call   156e <U8Buf<256ul>::~U8Buf()>
+        for (Index i = n; i > 0; --i) {
+    175b:	|  |  \-------- eb d1                	jmp    172e <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x161>
+            }
+    175d:	\--|----------> 48 8d 7c 24 18       	lea    0x18(%rsp),%rdi
+    1762:	   |            e8 cb fd ff ff       	call   1532 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+            new_n->alloc_ = new_cap;
+    1767:	   |            4d 89 75 00          	mov    %r14,0x0(%r13)
+        }
+    176b:	   \----------> 48 83 c4 48          	add    $0x48,%rsp
+    176f:	                4c 89 e8             	mov    %r13,%rax
+    1772:	                5b                   	pop    %rbx
+    1773:	                5d                   	pop    %rbp
+    1774:	                41 5c                	pop    %r12
+    1776:	                41 5d                	pop    %r13
+    1778:	                41 5e                	pop    %r14
+    177a:	                41 5f                	pop    %r15
+    177c:	                c3                   	ret
+    177d:	                90                   	nop
+
+000000000000177e <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>:
+            return item_->push_back(l);
+        }
+#    endif
+
+        template<typename... Args>
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Args &&...args)
+    177e:	                41 54                	push   %r12
+    1780:	                49 89 d4             	mov    %rdx,%r12
+    1783:	                55                   	push   %rbp
+    1784:	                48 89 f5             	mov    %rsi,%rbp
+    1787:	                53                   	push   %rbx
+    1788:	                48 89 fb             	mov    %rdi,%rbx
+    178b:	                48 8b 3e             	mov    (%rsi),%rdi
+            return (item_ == nullptr) ? 0 : item_->len();
+    178e:	                48 85 ff             	test   %rdi,%rdi
+    1791:	            /-- 74 12                	je     17a5 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x27>
+            return len_;
+    1793:	            |   48 8b 77 08          	mov    0x8(%rdi),%rsi
+            return alloc_;
+    1797:	            |   48 8b 17             	mov    (%rdi),%rdx
+            if (len() + n <= capacity()) { return true; }
+    179a:	            |   48 8d 46 01          	lea    0x1(%rsi),%rax
+    179e:	            |   48 39 c2             	cmp    %rax,%rdx
+    17a1:	/-----------|-- 73 65                	jae    1808 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x8a>
+    17a3:	|        /--|-- eb 19                	jmp    17be <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x40>
+            Node *new_n = realloc(nullptr, capacity);
+    17a5:	|        |  \-> 31 ff                	xor    %edi,%edi
+    17a7:	|        |      be 04 00 00 00       	mov    $0x4,%esi
+    17ac:	|        |      e8 1c fe ff ff       	call   15cd <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)>
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    17b1:	|        |      48 85 c0             	test   %rax,%rax
+    17b4:	|     /--|----- 74 3c                	je     17f2 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x74>
+    17b6:	|     |  |      31 d2                	xor    %edx,%edx
+    17b8:	|     |  |      48 89 50 08          	mov    %rdx,0x8(%rax)
+    17bc:	|  /--|--|----- eb 46                	jmp    1804 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x86>
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            if (cap <= cur) { return cap; }
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    17be:	|  |  |  \----> 48 83 fa 03          	cmp    $0x3,%rdx
+    17c2:	|  |  |     /-- 77 15                	ja     17d9 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x5b>
+    17c4:	|  |  |     |   ba 04 00 00 00       	mov    $0x4,%edx
+    17c9:	|  |  |     |   48 39 d0             	cmp    %rdx,%rax
+    17cc:	|  |  |     |   48 0f 42 c2          	cmovb  %rdx,%rax
+    17d0:	|  |  |     |   48 39 f0             	cmp    %rsi,%rax
+    17d3:	|  |  |     |   48 0f 43 f0          	cmovae %rax,%rsi
+    17d7:	|  |  |  /--|-- eb 21                	jmp    17fa <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x7c>
+    17d9:	|  |  |  |  \-> 48 8d 0c 12          	lea    (%rdx,%rdx,1),%rcx
+    17dd:	|  |  |  |      48 39 c1             	cmp    %rax,%rcx
+    17e0:	|  |  |  |      48 0f 43 c1          	cmovae %rcx,%rax
+    17e4:	|  |  |  |      48 39 f0             	cmp    %rsi,%rax
+    17e7:	|  |  |  |      48 0f 43 f0          	cmovae %rax,%rsi
+            } else if (new_cap == item_->capacity()) {
+    17eb:	|  |  |  |      48 39 f2             	cmp    %rsi,%rdx
+    17ee:	|  |  |  +----- 75 0a                	jne    17fa <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x7c>
+    17f0:	+--|--|--|----- eb 16                	jmp    1808 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x8a>
+                item_ = VectorNode::malloc(new_cap);
+    17f2:	|  |  \--|----> 31 c0                	xor    %eax,%eax
+    17f4:	|  |     |      48 89 45 00          	mov    %rax,0x0(%rbp)
+    17f8:	|  |  /--|----- eb 21                	jmp    181b <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x9d>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    17fa:	|  |  |  \----> e8 ce fd ff ff       	call   15cd <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)>
+                if (p == nullptr) { return false; }
+    17ff:	|  |  |         48 85 c0             	test   %rax,%rax
+    1802:	|  |  +-------- 74 17                	je     181b <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x9d>
+                item_ = p;
+    1804:	|  \--|-------> 48 89 45 00          	mov    %rax,0x0(%rbp)
+        {
+            bool ok;
+            ok = try_reserve_for(1);
+            if (!ok) { return Result<void, Type>::Err(forward<Args>(args)...); }
+            if (item_ == nullptr) { return Result<void, Type>::Err(forward<Args>(args)...); }
+    1808:	\-----|-------> 48 8b 6d 00          	mov    0x0(%rbp),%rbp
+    180c:	      |         48 85 ed             	test   %rbp,%rbp
+    180f:	      +-------- 74 0a                	je     181b <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x9d>
+            return len_;
+    1811:	      |         48 8b 45 08          	mov    0x8(%rbp),%rax
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+        {
+            if (len() >= capacity()) {
+    1815:	      |         48 3b 45 00          	cmp    0x0(%rbp),%rax
+    1819:	      |     /-- 72 1b                	jb     1836 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0xb8>
+            : tag_(Tag::ERR)
+    181b:	      \-----|-> c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+    1821:	            |   41 0f b6 34 24       	movzbl (%r12),%esi
+            , err_(forward<Args>(args)...)
+    1826:	            |   48 8d 7b 04          	lea    0x4(%rbx),%rdi
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+        {
+            nel::elem::set(data_, f, N);
+    182a:	            |   ba 00 01 00 00       	mov    $0x100,%edx
+    182f:	            |   e8 5e 00 00 00       	call   1892 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    1834:	         /--|-- eb 22                	jmp    1858 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0xda>
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    1836:	         |  \-> 48 c1 e0 08          	shl    $0x8,%rax
+    183a:	         |      41 0f b6 34 24       	movzbl (%r12),%esi
+            nel::elem::set(data_, f, N);
+    183f:	         |      ba 00 01 00 00       	mov    $0x100,%edx
+    1844:	         |      48 8d 7c 05 10       	lea    0x10(%rbp,%rax,1),%rdi
+    1849:	         |      e8 44 00 00 00       	call   1892 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            len_ += 1;
+    184e:	         |      48 ff 45 08          	incq   0x8(%rbp)
+            : tag_(Tag::OK)
+    1852:	         |      c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+            return item_->push_back(forward<Args>(args)...);
+        }
+    1858:	         \----> 48 89 d8             	mov    %rbx,%rax
+    185b:	                5b                   	pop    %rbx
+    185c:	                5d                   	pop    %rbp
+    185d:	                41 5c                	pop    %r12
+    185f:	                c3                   	ret
+
+0000000000001860 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::~Node()>:
+        constexpr ~Node(void)
+    1860:	       41 54                	push   %r12
+    1862:	       4c 8d 67 10          	lea    0x10(%rdi),%r12
+    1866:	       55                   	push   %rbp
+            for (Index i = 0; i < len(); ++i) {
+    1867:	       31 ed                	xor    %ebp,%ebp
+        constexpr ~Node(void)
+    1869:	       53                   	push   %rbx
+    186a:	       48 89 fb             	mov    %rdi,%rbx
+            for (Index i = 0; i < len(); ++i) {
+    186d:	/----> 48 3b 6b 08          	cmp    0x8(%rbx),%rbp
+    1871:	|  /-- 73 14                	jae    1887 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::~Node()+0x27>
+                values_[i].~Type();
+    1873:	|  |   4c 89 e7             	mov    %r12,%rdi
+            for (Index i = 0; i < len(); ++i) {
+    1876:	|  |   48 ff c5             	inc    %rbp
+    1879:	|  |   49 81 c4 00 01 00 00 	add    $0x100,%r12
+                values_[i].~Type();
+    1880:	|  |   e8 e9 fc ff ff       	call   156e <U8Buf<256ul>::~U8Buf()>
+            for (Index i = 0; i < len(); ++i) {
+    1885:	\--|-- eb e6                	jmp    186d <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::~Node()+0xd>
+        }
+    1887:	   \-> 5b                   	pop    %rbx
+    1888:	       5d                   	pop    %rbp
+    1889:	       41 5c                	pop    %r12
+    188b:	       c3                   	ret
+
+000000000000188c <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    188c:	48 89 d1             	mov    %rdx,%rcx
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    188f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1891:	c3                   	ret
+
+0000000000001892 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    1892:	48 89 d1             	mov    %rdx,%rcx
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    1895:	89 f0                	mov    %esi,%eax
+    1897:	f3 aa                	rep stos %al,%es:(%rdi)
+}
+    1899:	c3                   	ret
+
+000000000000189a <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    189a:	48 89 d1             	mov    %rdx,%rcx
+    189d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    189f:	c3                   	ret
+
+00000000000018a0 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    18a0:	e9 0b f8 ff ff       	jmp    10b0 <memmove@plt>
+
+00000000000018a5 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    18a5:	48 89 f1             	mov    %rsi,%rcx
+    std::memset(d, s, n);
+    18a8:	b0 a5                	mov    $0xa5,%al
+    18aa:	f3 aa                	rep stos %al,%es:(%rdi)
+    set(d, 0xa5, n);
+}
+    18ac:	c3                   	ret
+
+00000000000018ad <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    18ad:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    18ae:	e8 bd f7 ff ff       	call   1070 <memcmp@plt>
+}
+    18b3:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) == 0;
+    18b4:	85 c0                	test   %eax,%eax
+    18b6:	0f 94 c0             	sete   %al
+}
+    18b9:	c3                   	ret
+
+00000000000018ba <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    18ba:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    18bb:	e8 b0 f7 ff ff       	call   1070 <memcmp@plt>
+}
+    18c0:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) != 0;
+    18c1:	85 c0                	test   %eax,%eax
+    18c3:	0f 95 c0             	setne  %al
+}
+    18c6:	c3                   	ret
+
+00000000000018c7 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+{
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    18c7:	          49 89 fa             	mov    %rdi,%r10
+    18ca:	          48 89 f0             	mov    %rsi,%rax
+    if (n < streaming_min) {
+    18cd:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    18d4:	      /-- 77 05                	ja     18db <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14>
+    std::memcpy(d, s, n);
+    18d6:	      |   48 89 d1             	mov    %rdx,%rcx
+    18d9:	/-----|-- eb 79                	jmp    1954 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x8d>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    18db:	|     \-> 48 89 f9             	mov    %rdi,%rcx
+    18de:	|         48 f7 d9             	neg    %rcx
+    18e1:	|         83 e1 0f             	and    $0xf,%ecx
+    18e4:	|         49 89 c8             	mov    %rcx,%r8
+    std::memcpy(d, s, n);
+    18e7:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    18e9:	|         49 8d 70 40          	lea    0x40(%r8),%rsi
+    18ed:	|         48 89 f9             	mov    %rdi,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    18f0:	|     /-> 0f 10 54 30 d0       	movups -0x30(%rax,%rsi,1),%xmm2
+    18f5:	|     |   0f 10 4c 30 e0       	movups -0x20(%rax,%rsi,1),%xmm1
+    18fa:	|     |   49 89 f0             	mov    %rsi,%r8
+    for (; i + 64 <= n; i += 64) {
+    18fd:	|     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1901:	|     |   0f 10 44 30 f0       	movups -0x10(%rax,%rsi,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1906:	|     |   0f 10 5c 30 c0       	movups -0x40(%rax,%rsi,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    190b:	|     |   48 83 c6 40          	add    $0x40,%rsi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    190f:	|     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    1914:	|     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    1919:	|     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    191e:	|     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    1923:	|     |   48 39 f2             	cmp    %rsi,%rdx
+    1926:	|     \-- 73 c8                	jae    18f0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x29>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    1928:	|  /----> 49 8d 48 10          	lea    0x10(%r8),%rcx
+        stream16(d + i, load16(s + i));
+    192c:	|  |      4f 8d 0c 02          	lea    (%r10,%r8,1),%r9
+    for (; i + 16 <= n; i += 16) {
+    1930:	|  |      48 39 ca             	cmp    %rcx,%rdx
+    1933:	|  |  /-- 72 0f                	jb     1944 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x7d>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1935:	|  |  |   0f 10 64 08 f0       	movups -0x10(%rax,%rcx,1),%xmm4
+    193a:	|  |  |   49 89 c8             	mov    %rcx,%r8
+    193d:	|  |  |   66 41 0f e7 21       	movntdq %xmm4,(%r9)
+    for (; i + 16 <= n; i += 16) {
+    1942:	|  \--|-- eb e4                	jmp    1928 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x61>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    1944:	|     \-> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    1947:	|         4c 29 c2             	sub    %r8,%rdx
+        stream16(d + i, load16(s + i));
+    194a:	|         4a 8d 34 00          	lea    (%rax,%r8,1),%rsi
+    std::memcpy(d, s, n);
+    194e:	|         4c 89 cf             	mov    %r9,%rdi
+    copy(d + i, s + i, n - i);
+    1951:	|         48 89 d1             	mov    %rdx,%rcx
+    std::memcpy(d, s, n);
+    1954:	\-------> f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1956:	          c3                   	ret
+
+0000000000001957 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    1957:	          49 89 f8             	mov    %rdi,%r8
+    if (n < streaming_min) {
+    195a:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1961:	/-------- 77 37                	ja     199a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x43>
+    Length done = (n < 16) ? n : 16;
+    1963:	|         b8 10 00 00 00       	mov    $0x10,%eax
+    1968:	|         48 39 c2             	cmp    %rax,%rdx
+    196b:	|         48 0f 46 c2          	cmovbe %rdx,%rax
+    std::memcpy(d, s, n);
+    196f:	|         89 c1                	mov    %eax,%ecx
+    1971:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    1973:	|  /----> 48 39 d0             	cmp    %rdx,%rax
+    1976:	|  |  /-- 73 21                	jae    1999 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42>
+        Length const m = (done < n - done) ? done : n - done;
+    1978:	|  |  |   49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    197b:	|  |  |   4d 8d 14 00          	lea    (%r8,%rax,1),%r10
+    std::memcpy(d, s, n);
+    197f:	|  |  |   4c 89 c6             	mov    %r8,%rsi
+        Length const m = (done < n - done) ? done : n - done;
+    1982:	|  |  |   49 29 c1             	sub    %rax,%r9
+    std::memcpy(d, s, n);
+    1985:	|  |  |   4c 89 d7             	mov    %r10,%rdi
+        Length const m = (done < n - done) ? done : n - done;
+    1988:	|  |  |   49 39 c1             	cmp    %rax,%r9
+    198b:	|  |  |   4c 0f 47 c8          	cmova  %rax,%r9
+    std::memcpy(d, s, n);
+    198f:	|  |  |   44 89 c9             	mov    %r9d,%ecx
+        done += m;
+    1992:	|  |  |   4c 01 c8             	add    %r9,%rax
+    std::memcpy(d, s, n);
+    1995:	|  |  |   f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+        done += m;
+    1997:	|  \--|-- eb da                	jmp    1973 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c>
+    1999:	|     \-> c3                   	ret
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    199a:	\-------> 48 89 f8             	mov    %rdi,%rax
+    for (Index i = 0; i < head; ++i) {
+    199d:	          31 c9                	xor    %ecx,%ecx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    199f:	          48 f7 d8             	neg    %rax
+    19a2:	          83 e0 0f             	and    $0xf,%eax
+    for (Index i = 0; i < head; ++i) {
+    19a5:	   /----> 48 39 c1             	cmp    %rax,%rcx
+    19a8:	   |  /-- 74 0d                	je     19b7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x60>
+        d[i] = p[i];
+    19aa:	   |  |   40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+    19ae:	   |  |   41 88 3c 08          	mov    %dil,(%r8,%rcx,1)
+    for (Index i = 0; i < head; ++i) {
+    19b2:	   |  |   48 ff c1             	inc    %rcx
+    19b5:	   \--|-- eb ee                	jmp    19a5 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4e>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    19b7:	      \-> 31 c9                	xor    %ecx,%ecx
+        rotated[i] = p[(head + i) % 16];
+    19b9:	      /-> 48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+    19bd:	      |   83 e7 0f             	and    $0xf,%edi
+    19c0:	      |   40 8a 3c 3e          	mov    (%rsi,%rdi,1),%dil
+    19c4:	      |   40 88 7c 0c e8       	mov    %dil,-0x18(%rsp,%rcx,1)
+    for (Index i = 0; i < 16; ++i) {
+    19c9:	      |   48 ff c1             	inc    %rcx
+    19cc:	      |   48 83 f9 10          	cmp    $0x10,%rcx
+    19d0:	      \-- 75 e7                	jne    19b9 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x62>
+    std::memcpy(&v, s, sizeof(v));
+    19d2:	          0f 28 44 24 e8       	movaps -0x18(%rsp),%xmm0
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    19d7:	          48 8d 78 40          	lea    0x40(%rax),%rdi
+    19db:	          4c 01 c0             	add    %r8,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    19de:	      /-> 48 89 f9             	mov    %rdi,%rcx
+    for (; i + 64 <= n; i += 64) {
+    19e1:	      |   48 8d 7f 40          	lea    0x40(%rdi),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    19e5:	      |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    19e9:	      |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    19ee:	      |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    19f3:	      |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    19f8:	      |   48 83 c0 40          	add    $0x40,%rax
+    19fc:	      |   48 39 fa             	cmp    %rdi,%rdx
+    19ff:	      \-- 73 dd                	jae    19de <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x87>
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+        stream16(d + i, v);
+    1a01:	          49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    for (; i + 16 <= n; i += 16) {
+    1a05:	   /----> 48 8d 41 10          	lea    0x10(%rcx),%rax
+    1a09:	   |      48 39 c2             	cmp    %rax,%rdx
+    1a0c:	   |  /-- 72 0a                	jb     1a18 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc1>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1a0e:	   |  |   48 89 c1             	mov    %rax,%rcx
+    1a11:	   |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    1a16:	   \--|-- eb ed                	jmp    1a05 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xae>
+    }
+    __builtin_ia32_sfence();
+    1a18:	      \-> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    1a1b:	   /----> 48 39 d1             	cmp    %rdx,%rcx
+    1a1e:	   |  /-- 73 12                	jae    1a32 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xdb>
+        d[i] = p[i % 16];
+    1a20:	   |  |   48 89 c8             	mov    %rcx,%rax
+    1a23:	   |  |   83 e0 0f             	and    $0xf,%eax
+    1a26:	   |  |   8a 04 06             	mov    (%rsi,%rax,1),%al
+    1a29:	   |  |   41 88 04 08          	mov    %al,(%r8,%rcx,1)
+    for (; i < n; ++i) {
+    1a2d:	   |  |   48 ff c1             	inc    %rcx
+    1a30:	   \--|-- eb e9                	jmp    1a1b <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc4>
+    }
+}
+    1a32:	      \-> c3                   	ret
+
+0000000000001a33 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    1a33:	    48 85 ff             	test   %rdi,%rdi
+    1a36:	/-- 74 09                	je     1a41 <nel::free_aligned(void*)+0xe>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    1a38:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    1a3c:	|   e9 ef f5 ff ff       	jmp    1030 <free@plt>
+}
+    1a41:	\-> c3                   	ret
+
+0000000000001a42 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    1a42:	       41 56                	push   %r14
+            : fn_name_(fn_name)
+    1a44:	       48 8d 05 a9 06 00 00 	lea    0x6a9(%rip),%rax        # 20f4 <_IO_stdin_used+0xf4>
+    1a4b:	       41 55                	push   %r13
+    1a4d:	       41 54                	push   %r12
+    1a4f:	       55                   	push   %rbp
+    1a50:	       53                   	push   %rbx
+    1a51:	       48 83 ec 20          	sub    $0x20,%rsp
+    1a55:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , file_name_(file_name)
+    1a5a:	       48 8d 05 a3 06 00 00 	lea    0x6a3(%rip),%rax        # 2104 <_IO_stdin_used+0x104>
+    1a61:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1a66:	       c7 44 24 18 f3 00 00 	movl   $0xf3,0x18(%rsp)
+    1a6d:	       00 
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    1a6e:	       48 85 f6             	test   %rsi,%rsi
+    1a71:	/----- 74 28                	je     1a9b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1a73:	|      4c 8d 66 ff          	lea    -0x1(%rsi),%r12
+    1a77:	|      48 89 f3             	mov    %rsi,%rbx
+    1a7a:	|      49 21 f4             	and    %rsi,%r12
+    1a7d:	+----- 75 1c                	jne    1a9b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1a7f:	|      49 89 fd             	mov    %rdi,%r13
+    1a82:	|      49 89 d6             	mov    %rdx,%r14
+    1a85:	|      48 89 cd             	mov    %rcx,%rbp
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1a88:	|      31 ff                	xor    %edi,%edi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    1a8a:	|      4d 85 ed             	test   %r13,%r13
+    1a8d:	|  /-- 74 1d                	je     1aac <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+    1a8f:	|  |   4d 8b 65 f8          	mov    -0x8(%r13),%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1a93:	|  |   4c 89 ef             	mov    %r13,%rdi
+    1a96:	|  |   4c 29 e7             	sub    %r12,%rdi
+    1a99:	|  +-- eb 11                	jmp    1aac <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+    if (!pred) { assert_fail(msg, ctx); }
+    1a9b:	\--|-> 48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    1aa0:	   |   48 8d 3d 6f 06 00 00 	lea    0x66f(%rip),%rdi        # 2116 <_IO_stdin_used+0x116>
+    1aa7:	   |   e8 86 f6 ff ff       	call   1132 <nel::assert_fail(char const*, nel::Context const&)>
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1aac:	   \-> 48 8d 34 2b          	lea    (%rbx,%rbp,1),%rsi
+    1ab0:	       e8 eb f5 ff ff       	call   10a0 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    1ab5:	       48 85 c0             	test   %rax,%rax
+    1ab8:	/----- 74 3b                	je     1af5 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb3>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1aba:	|      48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    1abf:	|      48 f7 db             	neg    %rbx
+    1ac2:	|      48 21 d9             	and    %rbx,%rcx
+    1ac5:	|      48 89 cb             	mov    %rcx,%rbx
+    1ac8:	|      48 29 c3             	sub    %rax,%rbx
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    1acb:	|      4d 85 ed             	test   %r13,%r13
+    1ace:	|  /-- 74 1e                	je     1aee <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+    1ad0:	|  |   49 39 dc             	cmp    %rbx,%r12
+    1ad3:	|  +-- 74 19                	je     1aee <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    1ad5:	|  |   4c 39 f5             	cmp    %r14,%rbp
+    1ad8:	|  |   4c 89 f2             	mov    %r14,%rdx
+    1adb:	|  |   4a 8d 34 20          	lea    (%rax,%r12,1),%rsi
+    1adf:	|  |   48 89 cf             	mov    %rcx,%rdi
+    1ae2:	|  |   48 0f 46 d5          	cmovbe %rbp,%rdx
+    1ae6:	|  |   e8 c5 f5 ff ff       	call   10b0 <memmove@plt>
+    1aeb:	|  |   48 89 c1             	mov    %rax,%rcx
+    }
+    offset_field(new_p) = new_offset;
+    1aee:	|  \-> 48 89 59 f8          	mov    %rbx,-0x8(%rcx)
+    return new_p;
+    1af2:	|      48 89 c8             	mov    %rcx,%rax
+}
+    1af5:	\----> 48 83 c4 20          	add    $0x20,%rsp
+    1af9:	       5b                   	pop    %rbx
+    1afa:	       5d                   	pop    %rbp
+    1afb:	       41 5c                	pop    %r12
+    1afd:	       41 5d                	pop    %r13
+    1aff:	       41 5e                	pop    %r14
+    1b01:	       c3                   	ret
+
+0000000000001b02 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    1b02:	48 89 f1             	mov    %rsi,%rcx
+    return realloc_aligned(nullptr, align, 0, size);
+    1b05:	31 d2                	xor    %edx,%edx
+    1b07:	48 89 fe             	mov    %rdi,%rsi
+    1b0a:	31 ff                	xor    %edi,%edi
+    1b0c:	e9 31 ff ff ff       	jmp    1a42 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+
+0000000000001b11 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1b11:	53                   	push   %rbx
+    1b12:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    1b15:	40 0f be fe          	movsbl %sil,%edi
+    1b19:	48 8b 35 40 25 00 00 	mov    0x2540(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    1b20:	e8 3b f5 ff ff       	call   1060 <fputc@plt>
+    return outs;
+}
+    1b25:	48 89 d8             	mov    %rbx,%rax
+    1b28:	5b                   	pop    %rbx
+    1b29:	c3                   	ret
+
+0000000000001b2a <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1b2a:	53                   	push   %rbx
+    1b2b:	48 89 fb             	mov    %rdi,%rbx
+    1b2e:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    1b31:	48 8b 35 28 25 00 00 	mov    0x2528(%rip),%rsi        # 4060 <stderr@GLIBC_2.2.5>
+    1b38:	e8 13 f5 ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    1b3d:	48 89 d8             	mov    %rbx,%rax
+    1b40:	5b                   	pop    %rbx
+    1b41:	c3                   	ret
+
+0000000000001b42 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1b42:	53                   	push   %rbx
+    1b43:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    1b46:	48 8b 3d 13 25 00 00 	mov    0x2513(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1b4d:	40 0f b6 d6          	movzbl %sil,%edx
+    1b51:	31 c0                	xor    %eax,%eax
+    1b53:	48 8d 35 d7 05 00 00 	lea    0x5d7(%rip),%rsi        # 2131 <_IO_stdin_used+0x131>
+    1b5a:	e8 21 f5 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1b5f:	48 89 d8             	mov    %rbx,%rax
+    1b62:	5b                   	pop    %rbx
+    1b63:	c3                   	ret
+
+0000000000001b64 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    1b64:	53                   	push   %rbx
+    1b65:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    1b68:	48 8b 3d f1 24 00 00 	mov    0x24f1(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+    1b6f:	0f b7 d6             	movzwl %si,%edx
+    1b72:	31 c0                	xor    %eax,%eax
+    1b74:	48 8d 35 b6 05 00 00 	lea    0x5b6(%rip),%rsi        # 2131 <_IO_stdin_used+0x131>
+    1b7b:	e8 00 f5 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1b80:	48 89 d8             	mov    %rbx,%rax
+    1b83:	5b                   	pop    %rbx
+    1b84:	c3                   	ret
+
+0000000000001b85 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    1b85:	53                   	push   %rbx
+    1b86:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    1b89:	48 8b 3d d0 24 00 00 	mov    0x24d0(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1b90:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    1b92:	31 c0                	xor    %eax,%eax
+    1b94:	48 8d 35 96 05 00 00 	lea    0x596(%rip),%rsi        # 2131 <_IO_stdin_used+0x131>
+    1b9b:	e8 e0 f4 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1ba0:	48 89 d8             	mov    %rbx,%rax
+    1ba3:	5b                   	pop    %rbx
+    1ba4:	c3                   	ret
+
+0000000000001ba5 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    1ba5:	53                   	push   %rbx
+    1ba6:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    1ba9:	48 8b 3d b0 24 00 00 	mov    0x24b0(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1bb0:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    1bb2:	31 c0                	xor    %eax,%eax
+    1bb4:	48 8d 35 76 05 00 00 	lea    0x576(%rip),%rsi        # 2131 <_IO_stdin_used+0x131>
+    1bbb:	e8 c0 f4 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1bc0:	48 89 d8             	mov    %rbx,%rax
+    1bc3:	5b                   	pop    %rbx
+    1bc4:	c3                   	ret
+
+0000000000001bc5 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    1bc5:	53                   	push   %rbx
+    1bc6:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    1bc9:	48 8b 3d 90 24 00 00 	mov    0x2490(%rip),%rdi        # 4060 <stderr@GLIBC_2.2.5>
+{
+    1bd0:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    1bd3:	31 c0                	xor    %eax,%eax
+    1bd5:	48 8d 35 58 05 00 00 	lea    0x558(%rip),%rsi        # 2134 <_IO_stdin_used+0x134>
+    1bdc:	e8 9f f4 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    1be1:	48 89 d8             	mov    %rbx,%rax
+    1be4:	5b                   	pop    %rbx
+    1be5:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000001be8 <_fini>:
+    1be8:	48 83 ec 08          	sub    $0x8,%rsp
+    1bec:	48 83 c4 08          	add    $0x8,%rsp
+    1bf0:	c3                   	ret
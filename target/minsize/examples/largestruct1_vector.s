@@ -0,0 +1,2116 @@
+
+target/minsize/examples/largestruct1_vector:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 3f 00 00 	mov    0x3fc5(%rip),%rax        # 4fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 3f 00 00    	push   0x3fca(%rip)        # 4ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 3f 00 00    	jmp    *0x3fcc(%rip)        # 4ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 3f 00 00    	jmp    *0x3fca(%rip)        # 5000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 3f 00 00    	jmp    *0x3fc2(%rip)        # 5008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 3f 00 00    	jmp    *0x3fba(%rip)        # 5010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputc@plt>:
+    1060:	ff 25 b2 3f 00 00    	jmp    *0x3fb2(%rip)        # 5018 <fputc@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <memcmp@plt>:
+    1070:	ff 25 aa 3f 00 00    	jmp    *0x3faa(%rip)        # 5020 <memcmp@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fprintf@plt>:
+    1080:	ff 25 a2 3f 00 00    	jmp    *0x3fa2(%rip)        # 5028 <fprintf@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <malloc@plt>:
+    1090:	ff 25 9a 3f 00 00    	jmp    *0x3f9a(%rip)        # 5030 <malloc@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <realloc@plt>:
+    10a0:	ff 25 92 3f 00 00    	jmp    *0x3f92(%rip)        # 5038 <realloc@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <memmove@plt>:
+    10b0:	ff 25 8a 3f 00 00    	jmp    *0x3f8a(%rip)        # 5040 <memmove@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010c0 <__cxa_finalize@plt>:
+    10c0:	ff 25 1a 3f 00 00    	jmp    *0x3f1a(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10c6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010d0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10d0:	50                   	push   %rax
+    std::abort();
+    10d1:	e8 6a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010d6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10d6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10d7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10da:	4c 8d 0d 1f 20 00 00 	lea    0x201f(%rip),%r9        # 3100 <_IO_stdin_used+0x100>
+    10e1:	31 c0                	xor    %eax,%eax
+    10e3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    10e7:	4c 8b 07             	mov    (%rdi),%r8
+    10ea:	48 8d 35 15 20 00 00 	lea    0x2015(%rip),%rsi        # 3106 <_IO_stdin_used+0x106>
+    10f1:	48 8b 3d 68 3f 00 00 	mov    0x3f68(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+    10f8:	e8 83 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    10fd:	e8 3e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001102 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1102:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1106:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1109:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    110d:	31 c0                	xor    %eax,%eax
+    110f:	57                   	push   %rdi
+    1110:	48 8b 3d 49 3f 00 00 	mov    0x3f49(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+    1117:	4c 8d 0d e2 1f 00 00 	lea    0x1fe2(%rip),%r9        # 3100 <_IO_stdin_used+0x100>
+    111e:	4c 8b 06             	mov    (%rsi),%r8
+    1121:	48 8d 35 ef 1f 00 00 	lea    0x1fef(%rip),%rsi        # 3117 <_IO_stdin_used+0x117>
+    1128:	e8 53 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    112d:	e8 0e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001132 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1132:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1136:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1139:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    113d:	31 c0                	xor    %eax,%eax
+    113f:	57                   	push   %rdi
+    1140:	48 8b 3d 19 3f 00 00 	mov    0x3f19(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+    1147:	4c 8d 0d de 1f 00 00 	lea    0x1fde(%rip),%r9        # 312c <_IO_stdin_used+0x12c>
+    114e:	4c 8b 06             	mov    (%rsi),%r8
+    1151:	48 8d 35 bf 1f 00 00 	lea    0x1fbf(%rip),%rsi        # 3117 <_IO_stdin_used+0x117>
+    1158:	e8 23 ff ff ff       	call   1080 <fprintf@plt>
+    std::abort();
+    115d:	e8 de fe ff ff       	call   1040 <abort@plt>
+
+0000000000001162 <main>:
+    it.for_each2([&](U8Buf<256> &e) -> void { nel::log << e << '\n'; });
+}
+#endif
+
+int main()
+{
+    1162:	53                   	push   %rbx
+    nel::log << "ex1:b" << '\n';
+    1163:	48 8d 1d ff 3e 00 00 	lea    0x3eff(%rip),%rbx        # 5069 <nel::log>
+    116a:	48 8d 35 df 1e 00 00 	lea    0x1edf(%rip),%rsi        # 3050 <_IO_stdin_used+0x50>
+    1171:	48 89 df             	mov    %rbx,%rdi
+    1174:	e8 bf 0e 00 00       	call   2038 <nel::operator<<(nel::Log&, char const*)>
+    1179:	be 0a 00 00 00       	mov    $0xa,%esi
+    117e:	48 89 c7             	mov    %rax,%rdi
+    1181:	e8 99 0e 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+    ex1();
+    1186:	e8 fa 04 00 00       	call   1685 <ex1()>
+    nel::log << "ex1:e" << '\n';
+    118b:	48 89 df             	mov    %rbx,%rdi
+    118e:	48 8d 35 c1 1e 00 00 	lea    0x1ec1(%rip),%rsi        # 3056 <_IO_stdin_used+0x56>
+    1195:	e8 9e 0e 00 00       	call   2038 <nel::operator<<(nel::Log&, char const*)>
+    119a:	be 0a 00 00 00       	mov    $0xa,%esi
+    119f:	48 89 c7             	mov    %rax,%rdi
+    11a2:	e8 78 0e 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex2:b" << '\n';
+    11a7:	48 89 df             	mov    %rbx,%rdi
+    11aa:	48 8d 35 ab 1e 00 00 	lea    0x1eab(%rip),%rsi        # 305c <_IO_stdin_used+0x5c>
+    11b1:	e8 82 0e 00 00       	call   2038 <nel::operator<<(nel::Log&, char const*)>
+    11b6:	be 0a 00 00 00       	mov    $0xa,%esi
+    11bb:	48 89 c7             	mov    %rax,%rdi
+    11be:	e8 5c 0e 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+    ex2();
+    11c3:	e8 fe 04 00 00       	call   16c6 <ex2()>
+    nel::log << "ex2:e" << '\n';
+    11c8:	48 89 df             	mov    %rbx,%rdi
+    11cb:	48 8d 35 90 1e 00 00 	lea    0x1e90(%rip),%rsi        # 3062 <_IO_stdin_used+0x62>
+    11d2:	e8 61 0e 00 00       	call   2038 <nel::operator<<(nel::Log&, char const*)>
+    11d7:	be 0a 00 00 00       	mov    $0xa,%esi
+    11dc:	48 89 c7             	mov    %rax,%rdi
+    11df:	e8 3b 0e 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex3:b" << '\n';
+    11e4:	48 89 df             	mov    %rbx,%rdi
+    11e7:	48 8d 35 7a 1e 00 00 	lea    0x1e7a(%rip),%rsi        # 3068 <_IO_stdin_used+0x68>
+    11ee:	e8 45 0e 00 00       	call   2038 <nel::operator<<(nel::Log&, char const*)>
+    11f3:	be 0a 00 00 00       	mov    $0xa,%esi
+    11f8:	48 89 c7             	mov    %rax,%rdi
+    11fb:	e8 1f 0e 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+    ex3();
+    1200:	e8 d7 05 00 00       	call   17dc <ex3()>
+    nel::log << "ex3:e" << '\n';
+    1205:	48 89 df             	mov    %rbx,%rdi
+    1208:	48 8d 35 5f 1e 00 00 	lea    0x1e5f(%rip),%rsi        # 306e <_IO_stdin_used+0x6e>
+    120f:	e8 24 0e 00 00       	call   2038 <nel::operator<<(nel::Log&, char const*)>
+    1214:	be 0a 00 00 00       	mov    $0xa,%esi
+    1219:	48 89 c7             	mov    %rax,%rdi
+    121c:	e8 fe 0d 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+#if defined(RUST_LIKE)
+    nel::log << "ex41:b" << '\n';
+    ex41();
+    nel::log << "ex41:e" << '\n';
+#endif
+    nel::log << "ex42:b" << '\n';
+    1221:	48 89 df             	mov    %rbx,%rdi
+    1224:	48 8d 35 49 1e 00 00 	lea    0x1e49(%rip),%rsi        # 3074 <_IO_stdin_used+0x74>
+    122b:	e8 08 0e 00 00       	call   2038 <nel::operator<<(nel::Log&, char const*)>
+    1230:	be 0a 00 00 00       	mov    $0xa,%esi
+    1235:	48 89 c7             	mov    %rax,%rdi
+    1238:	e8 e2 0d 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+    ex42();
+    123d:	e8 ad 01 00 00       	call   13ef <ex42()>
+    nel::log << "ex42:e" << '\n';
+    1242:	48 89 df             	mov    %rbx,%rdi
+    1245:	48 8d 35 2f 1e 00 00 	lea    0x1e2f(%rip),%rsi        # 307b <_IO_stdin_used+0x7b>
+    124c:	e8 e7 0d 00 00       	call   2038 <nel::operator<<(nel::Log&, char const*)>
+    1251:	be 0a 00 00 00       	mov    $0xa,%esi
+    1256:	48 89 c7             	mov    %rax,%rdi
+    1259:	e8 c1 0d 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex43:b" << '\n';
+    125e:	48 89 df             	mov    %rbx,%rdi
+    1261:	48 8d 35 1a 1e 00 00 	lea    0x1e1a(%rip),%rsi        # 3082 <_IO_stdin_used+0x82>
+    1268:	e8 cb 0d 00 00       	call   2038 <nel::operator<<(nel::Log&, char const*)>
+    126d:	be 0a 00 00 00       	mov    $0xa,%esi
+    1272:	48 89 c7             	mov    %rax,%rdi
+    1275:	e8 a5 0d 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+    ex43();
+    127a:	e8 bb 02 00 00       	call   153a <ex43()>
+    nel::log << "ex43:e" << '\n';
+    127f:	48 89 df             	mov    %rbx,%rdi
+    1282:	48 8d 35 00 1e 00 00 	lea    0x1e00(%rip),%rsi        # 3089 <_IO_stdin_used+0x89>
+    1289:	e8 aa 0d 00 00       	call   2038 <nel::operator<<(nel::Log&, char const*)>
+    128e:	be 0a 00 00 00       	mov    $0xa,%esi
+    1293:	48 89 c7             	mov    %rax,%rdi
+    1296:	e8 84 0d 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+#if defined(RUST_LIKE)
+    nel::log << "ex44:b" << '\n';
+    ex44();
+    nel::log << "ex44:e" << '\n';
+#endif
+}
+    129b:	31 c0                	xor    %eax,%eax
+    129d:	5b                   	pop    %rbx
+    129e:	c3                   	ret
+    129f:	90                   	nop
+
+00000000000012a0 <_start>:
+    12a0:	31 ed                	xor    %ebp,%ebp
+    12a2:	49 89 d1             	mov    %rdx,%r9
+    12a5:	5e                   	pop    %rsi
+    12a6:	48 89 e2             	mov    %rsp,%rdx
+    12a9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    12ad:	50                   	push   %rax
+    12ae:	54                   	push   %rsp
+    12af:	45 31 c0             	xor    %r8d,%r8d
+    12b2:	31 c9                	xor    %ecx,%ecx
+    12b4:	48 8d 3d a7 fe ff ff 	lea    -0x159(%rip),%rdi        # 1162 <main>
+    12bb:	ff 15 ff 3c 00 00    	call   *0x3cff(%rip)        # 4fc0 <__libc_start_main@GLIBC_2.34>
+    12c1:	f4                   	hlt
+    12c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12c9:	00 00 00 
+    12cc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000012d0 <deregister_tm_clones>:
+    12d0:	    48 8d 3d 81 3d 00 00 	lea    0x3d81(%rip),%rdi        # 5058 <__TMC_END__>
+    12d7:	    48 8d 05 7a 3d 00 00 	lea    0x3d7a(%rip),%rax        # 5058 <__TMC_END__>
+    12de:	    48 39 f8             	cmp    %rdi,%rax
+    12e1:	/-- 74 15                	je     12f8 <deregister_tm_clones+0x28>
+    12e3:	|   48 8b 05 de 3c 00 00 	mov    0x3cde(%rip),%rax        # 4fc8 <_ITM_deregisterTMCloneTable@Base>
+    12ea:	|   48 85 c0             	test   %rax,%rax
+    12ed:	+-- 74 09                	je     12f8 <deregister_tm_clones+0x28>
+    12ef:	|   ff e0                	jmp    *%rax
+    12f1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    12f8:	\-> c3                   	ret
+    12f9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001300 <register_tm_clones>:
+    1300:	    48 8d 3d 51 3d 00 00 	lea    0x3d51(%rip),%rdi        # 5058 <__TMC_END__>
+    1307:	    48 8d 35 4a 3d 00 00 	lea    0x3d4a(%rip),%rsi        # 5058 <__TMC_END__>
+    130e:	    48 29 fe             	sub    %rdi,%rsi
+    1311:	    48 89 f0             	mov    %rsi,%rax
+    1314:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1318:	    48 c1 f8 03          	sar    $0x3,%rax
+    131c:	    48 01 c6             	add    %rax,%rsi
+    131f:	    48 d1 fe             	sar    %rsi
+    1322:	/-- 74 14                	je     1338 <register_tm_clones+0x38>
+    1324:	|   48 8b 05 ad 3c 00 00 	mov    0x3cad(%rip),%rax        # 4fd8 <_ITM_registerTMCloneTable@Base>
+    132b:	|   48 85 c0             	test   %rax,%rax
+    132e:	+-- 74 08                	je     1338 <register_tm_clones+0x38>
+    1330:	|   ff e0                	jmp    *%rax
+    1332:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1338:	\-> c3                   	ret
+    1339:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001340 <__do_global_dtors_aux>:
+    1340:	       f3 0f 1e fa          	endbr64
+    1344:	       80 3d 1d 3d 00 00 00 	cmpb   $0x0,0x3d1d(%rip)        # 5068 <completed.0>
+    134b:	/----- 75 2b                	jne    1378 <__do_global_dtors_aux+0x38>
+    134d:	|      55                   	push   %rbp
+    134e:	|      48 83 3d 8a 3c 00 00 	cmpq   $0x0,0x3c8a(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1355:	|      00 
+    1356:	|      48 89 e5             	mov    %rsp,%rbp
+    1359:	|  /-- 74 0c                	je     1367 <__do_global_dtors_aux+0x27>
+    135b:	|  |   48 8b 3d ee 3c 00 00 	mov    0x3cee(%rip),%rdi        # 5050 <__dso_handle>
+    1362:	|  |   e8 59 fd ff ff       	call   10c0 <__cxa_finalize@plt>
+    1367:	|  \-> e8 64 ff ff ff       	call   12d0 <deregister_tm_clones>
+    136c:	|      c6 05 f5 3c 00 00 01 	movb   $0x1,0x3cf5(%rip)        # 5068 <completed.0>
+    1373:	|      5d                   	pop    %rbp
+    1374:	|      c3                   	ret
+    1375:	|      0f 1f 00             	nopl   (%rax)
+    1378:	\----> c3                   	ret
+    1379:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001380 <frame_dummy>:
+    1380:	f3 0f 1e fa          	endbr64
+    1384:	e9 77 ff ff ff       	jmp    1300 <register_tm_clones>
+    1389:	90                   	nop
+
+000000000000138a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>:
+    138a:	          52                   	push   %rdx
+    138b:	          85 ff                	test   %edi,%edi
+    138d:	   /----- 74 10                	je     139f <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]+0x15>
+    138f:	   |      ff cf                	dec    %edi
+    1391:	   |      83 ff 01             	cmp    $0x1,%edi
+    1394:	/--|----- 76 15                	jbe    13ab <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]+0x21>
+    1396:	|  |      48 8d 3d 76 1c 00 00 	lea    0x1c76(%rip),%rdi        # 3013 <_IO_stdin_used+0x13>
+    139d:	|  |  /-- eb 07                	jmp    13a6 <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]+0x1c>
+    139f:	|  \--|-> 48 8d 3d 5e 1c 00 00 	lea    0x1c5e(%rip),%rdi        # 3004 <_IO_stdin_used+0x4>
+    13a6:	|     \-> e8 57 fd ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+    13ab:	\-------> 58                   	pop    %rax
+    13ac:	          c3                   	ret
+    13ad:	          90                   	nop
+
+00000000000013ae <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::iter() [clone .isra.0]>:
+        constexpr auto iter(void) const
+        {
+            return slice().iter();
+        }
+
+        constexpr auto iter(void)
+    13ae:	    48 89 f8             	mov    %rdi,%rax
+        Length len_;
+
+    private:
+        constexpr Slice(void)
+            : content_(nullptr)
+            , len_(0)
+    13b1:	    31 d2                	xor    %edx,%edx
+            return (item_ == nullptr) ? Slice<Type>::empty() : item_->slice();
+    13b3:	    48 85 f6             	test   %rsi,%rsi
+    13b6:	/-- 74 08                	je     13c0 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::iter() [clone .isra.0]+0x12>
+            return alloc_;
+        }
+
+        constexpr Length len(void) const
+        {
+            return len_;
+    13b8:	|   48 8b 56 08          	mov    0x8(%rsi),%rdx
+        }
+
+    public:
+        constexpr Slice<Type> slice(void)
+        {
+            return Slice(values_, len());
+    13bc:	|   48 83 c6 10          	add    $0x10,%rsi
+        }
+
+    public:
+        constexpr SliceIterator(T arr[], Count len)
+            : b_(arr)
+            , e_(arr + len)
+    13c0:	\-> 48 c1 e2 08          	shl    $0x8,%rdx
+            : b_(arr)
+    13c4:	    48 89 30             	mov    %rsi,(%rax)
+            , e_(arr + len)
+    13c7:	    48 01 d6             	add    %rdx,%rsi
+    13ca:	    48 89 70 08          	mov    %rsi,0x8(%rax)
+        {
+            return slice().iter();
+        }
+    13ce:	    c3                   	ret
+
+00000000000013cf <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    13cf:	83 c8 ff             	or     $0xffffffff,%eax
+    13d2:	c3                   	ret
+
+00000000000013d3 <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    13d3:	83 c8 ff             	or     $0xffffffff,%eax
+    13d6:	c3                   	ret
+
+00000000000013d7 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    13d7:	83 c8 ff             	or     $0xffffffff,%eax
+    13da:	c3                   	ret
+
+00000000000013db <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    13db:	83 c8 ff             	or     $0xffffffff,%eax
+    13de:	c3                   	ret
+
+00000000000013df <_read_r>:
+int _read_r(struct _reent *, int) {
+    13df:	83 c8 ff             	or     $0xffffffff,%eax
+    13e2:	c3                   	ret
+
+00000000000013e3 <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    13e3:	83 c8 ff             	or     $0xffffffff,%eax
+    13e6:	c3                   	ret
+
+00000000000013e7 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    13e7:	83 c8 ff             	or     $0xffffffff,%eax
+    13ea:	c3                   	ret
+
+00000000000013eb <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    13eb:	83 c8 ff             	or     $0xffffffff,%eax
+    13ee:	c3                   	ret
+
+00000000000013ef <ex42()>:
+{
+    13ef:	       41 57                	push   %r15
+    Vec1 vec1 = Vec1::with_capacity(5);
+    13f1:	       be 05 00 00 00       	mov    $0x5,%esi
+{
+    13f6:	       41 56                	push   %r14
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    13f8:	       4c 8d 35 1f 1c 00 00 	lea    0x1c1f(%rip),%r14        # 301e <_IO_stdin_used+0x1e>
+    13ff:	       41 55                	push   %r13
+            , file_name_(file_name)
+    1401:	       4c 8d 2d 1b 1c 00 00 	lea    0x1c1b(%rip),%r13        # 3023 <_IO_stdin_used+0x23>
+    1408:	       41 54                	push   %r12
+    140a:	       55                   	push   %rbp
+    140b:	       53                   	push   %rbx
+    140c:	       48 81 ec 38 01 00 00 	sub    $0x138,%rsp
+    Vec1 vec1 = Vec1::with_capacity(5);
+    1413:	       48 8d 6c 24 08       	lea    0x8(%rsp),%rbp
+    vec1.push((uint8_t)0x67).is_ok();
+    1418:	       48 8d 5c 24 28       	lea    0x28(%rsp),%rbx
+    141d:	       4c 8d 7c 24 07       	lea    0x7(%rsp),%r15
+    Vec1 vec1 = Vec1::with_capacity(5);
+    1422:	       48 89 ef             	mov    %rbp,%rdi
+    vec1.push((uint8_t)0x67).is_ok();
+    1425:	       4c 8d 64 24 10       	lea    0x10(%rsp),%r12
+    Vec1 vec1 = Vec1::with_capacity(5);
+    142a:	       e8 41 09 00 00       	call   1d70 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+    vec1.push((uint8_t)0x67).is_ok();
+    142f:	       4c 89 fa             	mov    %r15,%rdx
+    1432:	       48 89 ee             	mov    %rbp,%rsi
+    1435:	       48 89 df             	mov    %rbx,%rdi
+    1438:	       c6 44 24 07 67       	movb   $0x67,0x7(%rsp)
+    143d:	       e8 70 08 00 00       	call   1cb2 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    1442:	       8b 7c 24 28          	mov    0x28(%rsp),%edi
+    1446:	       4c 89 e6             	mov    %r12,%rsi
+            : fn_name_(fn_name)
+    1449:	       4c 89 74 24 10       	mov    %r14,0x10(%rsp)
+            , file_name_(file_name)
+    144e:	       4c 89 6c 24 18       	mov    %r13,0x18(%rsp)
+            , line_num_(line_num)
+    1453:	       c7 44 24 20 46 00 00 	movl   $0x46,0x20(%rsp)
+    145a:	       00 
+    145b:	       e8 2a ff ff ff       	call   138a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>
+    1460:	       48 89 df             	mov    %rbx,%rdi
+    1463:	       e8 5a 04 00 00       	call   18c2 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    vec1.push((uint8_t)0x68).is_ok();
+    1468:	       4c 89 fa             	mov    %r15,%rdx
+    146b:	       48 89 ee             	mov    %rbp,%rsi
+    146e:	       48 89 df             	mov    %rbx,%rdi
+    1471:	       c6 44 24 07 68       	movb   $0x68,0x7(%rsp)
+    1476:	       e8 37 08 00 00       	call   1cb2 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    147b:	       8b 7c 24 28          	mov    0x28(%rsp),%edi
+    147f:	       4c 89 e6             	mov    %r12,%rsi
+            : fn_name_(fn_name)
+    1482:	       4c 89 74 24 10       	mov    %r14,0x10(%rsp)
+            , file_name_(file_name)
+    1487:	       4c 89 6c 24 18       	mov    %r13,0x18(%rsp)
+            , line_num_(line_num)
+    148c:	       c7 44 24 20 47 00 00 	movl   $0x47,0x20(%rsp)
+    1493:	       00 
+    1494:	       e8 f1 fe ff ff       	call   138a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>
+    1499:	       48 89 df             	mov    %rbx,%rdi
+    149c:	       e8 21 04 00 00       	call   18c2 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    vec1.push((uint8_t)0x69).is_ok();
+    14a1:	       4c 89 fa             	mov    %r15,%rdx
+    14a4:	       48 89 ee             	mov    %rbp,%rsi
+    14a7:	       48 89 df             	mov    %rbx,%rdi
+    14aa:	       c6 44 24 07 69       	movb   $0x69,0x7(%rsp)
+    14af:	       e8 fe 07 00 00       	call   1cb2 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    14b4:	       8b 7c 24 28          	mov    0x28(%rsp),%edi
+    14b8:	       4c 89 e6             	mov    %r12,%rsi
+            : fn_name_(fn_name)
+    14bb:	       4c 89 74 24 10       	mov    %r14,0x10(%rsp)
+            , file_name_(file_name)
+    14c0:	       4c 89 6c 24 18       	mov    %r13,0x18(%rsp)
+    it.for_each([&](U8Buf<256> &e) -> void { nel::log << e << '\n'; });
+    14c5:	       4c 8d 25 9d 3b 00 00 	lea    0x3b9d(%rip),%r12        # 5069 <nel::log>
+            , line_num_(line_num)
+    14cc:	       c7 44 24 20 48 00 00 	movl   $0x48,0x20(%rsp)
+    14d3:	       00 
+    vec1.push((uint8_t)0x69).is_ok();
+    14d4:	       e8 b1 fe ff ff       	call   138a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>
+    14d9:	       48 89 df             	mov    %rbx,%rdi
+    14dc:	       e8 e1 03 00 00       	call   18c2 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    auto it = vec1.iter();
+    14e1:	       48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    14e6:	       48 89 df             	mov    %rbx,%rdi
+    14e9:	       e8 c0 fe ff ff       	call   13ae <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::iter() [clone .isra.0]>
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return (b_ == e_);
+    14ee:	/----> 48 8b 5c 24 28       	mov    0x28(%rsp),%rbx
+        template<typename F>
+        void for_each2(F &&fn)
+#        endif
+        {
+#        if 1
+            for (; !self().is_done(); self().inc()) {
+    14f3:	|      48 3b 5c 24 30       	cmp    0x30(%rsp),%rbx
+    14f8:	|  /-- 74 26                	je     1520 <ex42()+0x131>
+    it.for_each([&](U8Buf<256> &e) -> void { nel::log << e << '\n'; });
+    14fa:	|  |   48 89 de             	mov    %rbx,%rsi
+    14fd:	|  |   4c 89 e7             	mov    %r12,%rdi
+        }
+
+        void inc(void)
+        {
+            ++b_;
+    1500:	|  |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    1507:	|  |   e8 05 04 00 00       	call   1911 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    150c:	|  |   be 0a 00 00 00       	mov    $0xa,%esi
+    1511:	|  |   48 89 c7             	mov    %rax,%rdi
+    1514:	|  |   e8 06 0b 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+    1519:	|  |   48 89 5c 24 28       	mov    %rbx,0x28(%rsp)
+        }
+    151e:	\--|-- eb ce                	jmp    14ee <ex42()+0xff>
+}
+    1520:	   \-> 48 89 ef             	mov    %rbp,%rdi
+    1523:	       e8 2c 08 00 00       	call   1d54 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    1528:	       48 81 c4 38 01 00 00 	add    $0x138,%rsp
+    152f:	       5b                   	pop    %rbx
+    1530:	       5d                   	pop    %rbp
+    1531:	       41 5c                	pop    %r12
+    1533:	       41 5d                	pop    %r13
+    1535:	       41 5e                	pop    %r14
+    1537:	       41 5f                	pop    %r15
+    1539:	       c3                   	ret
+
+000000000000153a <ex43()>:
+{
+    153a:	       41 57                	push   %r15
+    Vec1 vec1 = Vec1::with_capacity(5);
+    153c:	       be 05 00 00 00       	mov    $0x5,%esi
+{
+    1541:	       41 56                	push   %r14
+            : fn_name_(fn_name)
+    1543:	       4c 8d 35 f9 1a 00 00 	lea    0x1af9(%rip),%r14        # 3043 <_IO_stdin_used+0x43>
+    154a:	       41 55                	push   %r13
+            , file_name_(file_name)
+    154c:	       4c 8d 2d d0 1a 00 00 	lea    0x1ad0(%rip),%r13        # 3023 <_IO_stdin_used+0x23>
+    1553:	       41 54                	push   %r12
+    1555:	       55                   	push   %rbp
+    1556:	       53                   	push   %rbx
+    1557:	       48 81 ec 38 01 00 00 	sub    $0x138,%rsp
+    Vec1 vec1 = Vec1::with_capacity(5);
+    155e:	       48 8d 6c 24 08       	lea    0x8(%rsp),%rbp
+    vec1.push((uint8_t)0x67).is_ok();
+    1563:	       48 8d 5c 24 28       	lea    0x28(%rsp),%rbx
+    1568:	       4c 8d 7c 24 07       	lea    0x7(%rsp),%r15
+    Vec1 vec1 = Vec1::with_capacity(5);
+    156d:	       48 89 ef             	mov    %rbp,%rdi
+    vec1.push((uint8_t)0x67).is_ok();
+    1570:	       4c 8d 64 24 10       	lea    0x10(%rsp),%r12
+    Vec1 vec1 = Vec1::with_capacity(5);
+    1575:	       e8 f6 07 00 00       	call   1d70 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+    vec1.push((uint8_t)0x67).is_ok();
+    157a:	       4c 89 fa             	mov    %r15,%rdx
+    157d:	       48 89 ee             	mov    %rbp,%rsi
+    1580:	       48 89 df             	mov    %rbx,%rdi
+    1583:	       c6 44 24 07 67       	movb   $0x67,0x7(%rsp)
+    1588:	       e8 25 07 00 00       	call   1cb2 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    158d:	       8b 7c 24 28          	mov    0x28(%rsp),%edi
+    1591:	       4c 89 e6             	mov    %r12,%rsi
+            : fn_name_(fn_name)
+    1594:	       4c 89 74 24 10       	mov    %r14,0x10(%rsp)
+            , file_name_(file_name)
+    1599:	       4c 89 6c 24 18       	mov    %r13,0x18(%rsp)
+            , line_num_(line_num)
+    159e:	       c7 44 24 20 52 00 00 	movl   $0x52,0x20(%rsp)
+    15a5:	       00 
+    15a6:	       e8 df fd ff ff       	call   138a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>
+    15ab:	       48 89 df             	mov    %rbx,%rdi
+    15ae:	       e8 0f 03 00 00       	call   18c2 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    vec1.push((uint8_t)0x68).is_ok();
+    15b3:	       4c 89 fa             	mov    %r15,%rdx
+    15b6:	       48 89 ee             	mov    %rbp,%rsi
+    15b9:	       48 89 df             	mov    %rbx,%rdi
+    15bc:	       c6 44 24 07 68       	movb   $0x68,0x7(%rsp)
+    15c1:	       e8 ec 06 00 00       	call   1cb2 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    15c6:	       8b 7c 24 28          	mov    0x28(%rsp),%edi
+    15ca:	       4c 89 e6             	mov    %r12,%rsi
+            : fn_name_(fn_name)
+    15cd:	       4c 89 74 24 10       	mov    %r14,0x10(%rsp)
+            , file_name_(file_name)
+    15d2:	       4c 89 6c 24 18       	mov    %r13,0x18(%rsp)
+            , line_num_(line_num)
+    15d7:	       c7 44 24 20 53 00 00 	movl   $0x53,0x20(%rsp)
+    15de:	       00 
+    15df:	       e8 a6 fd ff ff       	call   138a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>
+    15e4:	       48 89 df             	mov    %rbx,%rdi
+    15e7:	       e8 d6 02 00 00       	call   18c2 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    vec1.push((uint8_t)0x69).is_ok();
+    15ec:	       4c 89 fa             	mov    %r15,%rdx
+    15ef:	       48 89 ee             	mov    %rbp,%rsi
+    15f2:	       48 89 df             	mov    %rbx,%rdi
+    15f5:	       c6 44 24 07 69       	movb   $0x69,0x7(%rsp)
+    15fa:	       e8 b3 06 00 00       	call   1cb2 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    15ff:	       8b 7c 24 28          	mov    0x28(%rsp),%edi
+    1603:	       4c 89 e6             	mov    %r12,%rsi
+            : fn_name_(fn_name)
+    1606:	       4c 89 74 24 10       	mov    %r14,0x10(%rsp)
+            , file_name_(file_name)
+    160b:	       4c 89 6c 24 18       	mov    %r13,0x18(%rsp)
+        nel::log << e << '\n';
+    1610:	       4c 8d 25 52 3a 00 00 	lea    0x3a52(%rip),%r12        # 5069 <nel::log>
+            , line_num_(line_num)
+    1617:	       c7 44 24 20 54 00 00 	movl   $0x54,0x20(%rsp)
+    161e:	       00 
+    vec1.push((uint8_t)0x69).is_ok();
+    161f:	       e8 66 fd ff ff       	call   138a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>
+    1624:	       48 89 df             	mov    %rbx,%rdi
+    1627:	       e8 96 02 00 00       	call   18c2 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    auto it = vec1.iter();
+    162c:	       48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    1631:	       48 89 df             	mov    %rbx,%rdi
+    1634:	       e8 75 fd ff ff       	call   13ae <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::iter() [clone .isra.0]>
+            return (b_ == e_);
+    1639:	/----> 48 8b 5c 24 28       	mov    0x28(%rsp),%rbx
+    for (; !it.is_done(); it.inc()) {
+    163e:	|      48 39 5c 24 30       	cmp    %rbx,0x30(%rsp)
+    1643:	|  /-- 74 26                	je     166b <ex43()+0x131>
+        nel::log << e << '\n';
+    1645:	|  |   48 89 de             	mov    %rbx,%rsi
+    1648:	|  |   4c 89 e7             	mov    %r12,%rdi
+            ++b_;
+    164b:	|  |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    1652:	|  |   e8 ba 02 00 00       	call   1911 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+    1657:	|  |   be 0a 00 00 00       	mov    $0xa,%esi
+    165c:	|  |   48 89 c7             	mov    %rax,%rdi
+    165f:	|  |   e8 bb 09 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+    1664:	|  |   48 89 5c 24 28       	mov    %rbx,0x28(%rsp)
+        }
+    1669:	\--|-- eb ce                	jmp    1639 <ex43()+0xff>
+}
+    166b:	   \-> 48 89 ef             	mov    %rbp,%rdi
+    166e:	       e8 e1 06 00 00       	call   1d54 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    1673:	       48 81 c4 38 01 00 00 	add    $0x138,%rsp
+    167a:	       5b                   	pop    %rbx
+    167b:	       5d                   	pop    %rbp
+    167c:	       41 5c                	pop    %r12
+    167e:	       41 5d                	pop    %r13
+    1680:	       41 5e                	pop    %r14
+    1682:	       41 5f                	pop    %r15
+    1684:	       c3                   	ret
+
+0000000000001685 <ex1()>:
+{
+    1685:	53                   	push   %rbx
+    Vec1 vec1 = Vec1::with_capacity(5);
+    1686:	be 05 00 00 00       	mov    $0x5,%esi
+{
+    168b:	48 83 ec 10          	sub    $0x10,%rsp
+    Vec1 vec1 = Vec1::with_capacity(5);
+    168f:	48 8d 5c 24 08       	lea    0x8(%rsp),%rbx
+    1694:	48 89 df             	mov    %rbx,%rdi
+    1697:	e8 d4 06 00 00       	call   1d70 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+    nel::log << vec1 << '\n';
+    169c:	48 89 de             	mov    %rbx,%rsi
+    169f:	48 8d 3d c3 39 00 00 	lea    0x39c3(%rip),%rdi        # 5069 <nel::log>
+    16a6:	e8 e5 02 00 00       	call   1990 <nel::heaped::operator<<(nel::Log&, nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > const&)>
+    16ab:	be 0a 00 00 00       	mov    $0xa,%esi
+    16b0:	48 89 c7             	mov    %rax,%rdi
+    16b3:	e8 67 09 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+}
+    16b8:	48 89 df             	mov    %rbx,%rdi
+    16bb:	e8 94 06 00 00       	call   1d54 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    16c0:	48 83 c4 10          	add    $0x10,%rsp
+    16c4:	5b                   	pop    %rbx
+    16c5:	c3                   	ret
+
+00000000000016c6 <ex2()>:
+{
+    16c6:	       41 54                	push   %r12
+    Vec1 vec1 = Vec1::with_capacity(5);
+    16c8:	       be 05 00 00 00       	mov    $0x5,%esi
+{
+    16cd:	       55                   	push   %rbp
+    16ce:	       53                   	push   %rbx
+    16cf:	       48 81 ec 30 02 00 00 	sub    $0x230,%rsp
+    Vec1 vec1 = Vec1::with_capacity(5);
+    16d6:	       4c 8d 64 24 08       	lea    0x8(%rsp),%r12
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+        {
+            nel::elem::set(data_, f, N);
+    16db:	       48 8d 5c 24 2c       	lea    0x2c(%rsp),%rbx
+    16e0:	       4c 89 e7             	mov    %r12,%rdi
+    16e3:	       e8 88 06 00 00       	call   1d70 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+    16e8:	       be 66 00 00 00       	mov    $0x66,%esi
+    16ed:	       48 89 df             	mov    %rbx,%rdi
+    16f0:	       ba 00 01 00 00       	mov    $0x100,%edx
+    16f5:	       e8 a6 06 00 00       	call   1da0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            ok = try_reserve_for(1);
+    16fa:	       be 01 00 00 00       	mov    $0x1,%esi
+    16ff:	       4c 89 e7             	mov    %r12,%rdi
+    1702:	       e8 0f 05 00 00       	call   1c16 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>
+            if (!ok) { return Result<void, Type>::Err(val); }
+    1707:	       84 c0                	test   %al,%al
+    1709:	   /-- 74 14                	je     171f <ex2()+0x59>
+            if (item_ == nullptr) { return Result<void, Type>::Err(val); }
+    170b:	   |   48 8b 6c 24 08       	mov    0x8(%rsp),%rbp
+    1710:	   |   48 85 ed             	test   %rbp,%rbp
+    1713:	   +-- 74 0a                	je     171f <ex2()+0x59>
+            return len_;
+    1715:	   |   48 8b 45 08          	mov    0x8(%rbp),%rax
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+        {
+            if (len() >= capacity()) {
+    1719:	   |   48 3b 45 00          	cmp    0x0(%rbp),%rax
+    171d:	/--|-- 72 22                	jb     1741 <ex2()+0x7b>
+            nel::elem::copy(data_, o.data_, N);
+    171f:	|  \-> 48 8d bc 24 30 01 00 	lea    0x130(%rsp),%rdi
+    1726:	|      00 
+    1727:	|      ba 00 01 00 00       	mov    $0x100,%edx
+    172c:	|      48 89 de             	mov    %rbx,%rsi
+        {
+        }
+
+        template<typename... Args>
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+            : tag_(Tag::ERR)
+    172f:	|      c7 84 24 2c 01 00 00 	movl   $0x2,0x12c(%rsp)
+    1736:	|      02 00 00 00 
+    173a:	|      e8 5b 06 00 00       	call   1d9a <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+        }
+    173f:	|  /-- eb 25                	jmp    1766 <ex2()+0xa0>
+                // but if one is already created then return it.
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    1741:	\--|-> 48 c1 e0 08          	shl    $0x8,%rax
+            nel::elem::copy(data_, o.data_, N);
+    1745:	   |   ba 00 01 00 00       	mov    $0x100,%edx
+    174a:	   |   48 89 de             	mov    %rbx,%rsi
+    174d:	   |   48 8d 7c 05 10       	lea    0x10(%rbp,%rax,1),%rdi
+    1752:	   |   e8 43 06 00 00       	call   1d9a <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+            len_ += 1;
+    1757:	   |   48 ff 45 08          	incq   0x8(%rbp)
+            : tag_(Tag::OK)
+    175b:	   |   c7 84 24 2c 01 00 00 	movl   $0x1,0x12c(%rsp)
+    1762:	   |   01 00 00 00 
+    vec1.push(nel::move(v)).is_ok();
+    1766:	   \-> 8b bc 24 2c 01 00 00 	mov    0x12c(%rsp),%edi
+            : fn_name_(fn_name)
+    176d:	       48 8d 05 d4 18 00 00 	lea    0x18d4(%rip),%rax        # 3048 <_IO_stdin_used+0x48>
+    1774:	       48 8d 74 24 10       	lea    0x10(%rsp),%rsi
+            , line_num_(line_num)
+    1779:	       c7 44 24 20 18 00 00 	movl   $0x18,0x20(%rsp)
+    1780:	       00 
+            : fn_name_(fn_name)
+    1781:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , file_name_(file_name)
+    1786:	       48 8d 05 96 18 00 00 	lea    0x1896(%rip),%rax        # 3023 <_IO_stdin_used+0x23>
+    178d:	       48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    1792:	       e8 f3 fb ff ff       	call   138a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>
+    1797:	       48 8d bc 24 2c 01 00 	lea    0x12c(%rsp),%rdi
+    179e:	       00 
+    179f:	       e8 1e 01 00 00       	call   18c2 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    nel::log << vec1 << '\n';
+    17a4:	       4c 89 e6             	mov    %r12,%rsi
+    17a7:	       48 8d 3d bb 38 00 00 	lea    0x38bb(%rip),%rdi        # 5069 <nel::log>
+    17ae:	       e8 dd 01 00 00       	call   1990 <nel::heaped::operator<<(nel::Log&, nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > const&)>
+    17b3:	       be 0a 00 00 00       	mov    $0xa,%esi
+    17b8:	       48 89 c7             	mov    %rax,%rdi
+    17bb:	       e8 5f 08 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+}
+    17c0:	       48 89 df             	mov    %rbx,%rdi
+    17c3:	       e8 ea 00 00 00       	call   18b2 <U8Buf<256ul>::~U8Buf()>
+    17c8:	       4c 89 e7             	mov    %r12,%rdi
+    17cb:	       e8 84 05 00 00       	call   1d54 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    17d0:	       48 81 c4 30 02 00 00 	add    $0x230,%rsp
+    17d7:	       5b                   	pop    %rbx
+    17d8:	       5d                   	pop    %rbp
+    17d9:	       41 5c                	pop    %r12
+    17db:	       c3                   	ret
+
+00000000000017dc <ex3()>:
+{
+    17dc:	55                   	push   %rbp
+    Vec1 vec1 = Vec1::with_capacity(5);
+    17dd:	be 05 00 00 00       	mov    $0x5,%esi
+{
+    17e2:	53                   	push   %rbx
+    17e3:	48 81 ec 38 01 00 00 	sub    $0x138,%rsp
+    Vec1 vec1 = Vec1::with_capacity(5);
+    17ea:	48 8d 5c 24 08       	lea    0x8(%rsp),%rbx
+    vec1.push((uint8_t)0x67).is_ok();
+    17ef:	48 8d 6c 24 2c       	lea    0x2c(%rsp),%rbp
+    Vec1 vec1 = Vec1::with_capacity(5);
+    17f4:	48 89 df             	mov    %rbx,%rdi
+    17f7:	e8 74 05 00 00       	call   1d70 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>
+    vec1.push((uint8_t)0x67).is_ok();
+    17fc:	48 8d 54 24 07       	lea    0x7(%rsp),%rdx
+    1801:	48 89 de             	mov    %rbx,%rsi
+    1804:	48 89 ef             	mov    %rbp,%rdi
+    1807:	c6 44 24 07 67       	movb   $0x67,0x7(%rsp)
+    180c:	e8 a1 04 00 00       	call   1cb2 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>
+    1811:	8b 7c 24 2c          	mov    0x2c(%rsp),%edi
+            : fn_name_(fn_name)
+    1815:	48 8d 05 30 18 00 00 	lea    0x1830(%rip),%rax        # 304c <_IO_stdin_used+0x4c>
+    181c:	48 8d 74 24 10       	lea    0x10(%rsp),%rsi
+    1821:	48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , file_name_(file_name)
+    1826:	48 8d 05 f6 17 00 00 	lea    0x17f6(%rip),%rax        # 3023 <_IO_stdin_used+0x23>
+    182d:	48 89 44 24 18       	mov    %rax,0x18(%rsp)
+            , line_num_(line_num)
+    1832:	c7 44 24 20 21 00 00 	movl   $0x21,0x20(%rsp)
+    1839:	00 
+    183a:	e8 4b fb ff ff       	call   138a <nel::Result<void, U8Buf<256ul> >::is_ok(nel::Context const&) const [clone .isra.0]>
+    183f:	48 89 ef             	mov    %rbp,%rdi
+    1842:	e8 7b 00 00 00       	call   18c2 <nel::Result<void, U8Buf<256ul> >::~Result()>
+    nel::log << vec1 << '\n';
+    1847:	48 89 de             	mov    %rbx,%rsi
+    184a:	48 8d 3d 18 38 00 00 	lea    0x3818(%rip),%rdi        # 5069 <nel::log>
+    1851:	e8 3a 01 00 00       	call   1990 <nel::heaped::operator<<(nel::Log&, nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > const&)>
+    1856:	be 0a 00 00 00       	mov    $0xa,%esi
+    185b:	48 89 c7             	mov    %rax,%rdi
+    185e:	e8 bc 07 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+}
+    1863:	48 89 df             	mov    %rbx,%rdi
+    1866:	e8 e9 04 00 00       	call   1d54 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>
+    186b:	48 81 c4 38 01 00 00 	add    $0x138,%rsp
+    1872:	5b                   	pop    %rbx
+    1873:	5d                   	pop    %rbp
+    1874:	c3                   	ret
+    1875:	90                   	nop
+
+0000000000001876 <nel::Result<void*, nel::heaped::AllocError>::~Result()>:
+    }
+    1876:	    83 3f 02             	cmpl   $0x2,(%rdi)
+    1879:	/-- 76 35                	jbe    18b0 <nel::Result<void*, nel::heaped::AllocError>::~Result()+0x3a>
+        auto &e = it.deref();
+    187b:	|   48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    187f:	|   48 8d 05 0a 18 00 00 	lea    0x180a(%rip),%rax        # 3090 <_IO_stdin_used+0x90>
+                    nel::panic("bad Result");
+    1886:	|   48 8d 3d 86 17 00 00 	lea    0x1786(%rip),%rdi        # 3013 <_IO_stdin_used+0x13>
+    188d:	|   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1892:	|   48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    1897:	|   48 8d 05 fa 17 00 00 	lea    0x17fa(%rip),%rax        # 3098 <_IO_stdin_used+0x98>
+    189e:	|   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    18a3:	|   c7 44 24 18 72 00 00 	movl   $0x72,0x18(%rsp)
+    18aa:	|   00 
+    18ab:	|   e8 52 f8 ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+    18b0:	\-> c3                   	ret
+    18b1:	    90                   	nop
+
+00000000000018b2 <U8Buf<256ul>::~U8Buf()>:
+            nel::elem::set(data_, 0xa5, N);
+    18b2:	ba 00 01 00 00       	mov    $0x100,%edx
+    18b7:	be a5 00 00 00       	mov    $0xa5,%esi
+    18bc:	e9 df 04 00 00       	jmp    1da0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    18c1:	90                   	nop
+
+00000000000018c2 <nel::Result<void, U8Buf<256ul> >::~Result()>:
+    18c2:	       8b 07                	mov    (%rdi),%eax
+    18c4:	       83 f8 01             	cmp    $0x1,%eax
+    18c7:	   /-- 7f 05                	jg     18ce <nel::Result<void, U8Buf<256ul> >::~Result()+0xc>
+    18c9:	   |   85 c0                	test   %eax,%eax
+    18cb:	/--|-- 78 0f                	js     18dc <nel::Result<void, U8Buf<256ul> >::~Result()+0x1a>
+    18cd:	|  |   c3                   	ret
+    18ce:	|  \-> 83 f8 02             	cmp    $0x2,%eax
+    18d1:	+----- 75 09                	jne    18dc <nel::Result<void, U8Buf<256ul> >::~Result()+0x1a>
+
+    private:
+        Type value_;
+
+    public:
+        constexpr ~Element(void) = default;
+    18d3:	|      48 83 c7 04          	add    $0x4,%rdi
+    18d7:	|      e9 d6 ff ff ff       	jmp    18b2 <U8Buf<256ul>::~U8Buf()>
+        constexpr ~Result(void)
+    18dc:	\----> 48 83 ec 28          	sub    $0x28,%rsp
+            : fn_name_(fn_name)
+    18e0:	       48 8d 05 a9 17 00 00 	lea    0x17a9(%rip),%rax        # 3090 <_IO_stdin_used+0x90>
+                    nel::panic("bad Result");
+    18e7:	       48 8d 3d 25 17 00 00 	lea    0x1725(%rip),%rdi        # 3013 <_IO_stdin_used+0x13>
+    18ee:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    18f3:	       48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+            , file_name_(file_name)
+    18f8:	       48 8d 05 99 17 00 00 	lea    0x1799(%rip),%rax        # 3098 <_IO_stdin_used+0x98>
+    18ff:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1904:	       c7 44 24 18 dd 02 00 	movl   $0x2dd,0x18(%rsp)
+    190b:	       00 
+    190c:	       e8 f1 f7 ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+
+0000000000001911 <operator<<(nel::Log&, U8Buf<256ul> const&)>:
+        void fill(uint8_t f)
+        {
+            nel::elem::set(data_, f, N);
+        }
+
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+    1911:	    41 54                	push   %r12
+    1913:	    49 89 f4             	mov    %rsi,%r12
+        {
+            outs << "U8Buf<" << val.len() << ">{";
+    1916:	    48 8d 35 8d 17 00 00 	lea    0x178d(%rip),%rsi        # 30aa <_IO_stdin_used+0xaa>
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+    191d:	    55                   	push   %rbp
+            if (val.len() > 0) {
+                outs << val.data_[0];
+                for (Index i = 1; i < val.len(); ++i) {
+    191e:	    bd 01 00 00 00       	mov    $0x1,%ebp
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+    1923:	    53                   	push   %rbx
+    1924:	    48 89 fb             	mov    %rdi,%rbx
+            outs << "U8Buf<" << val.len() << ">{";
+    1927:	    e8 0c 07 00 00       	call   2038 <nel::operator<<(nel::Log&, char const*)>
+    192c:	    be 00 01 00 00       	mov    $0x100,%esi
+    1931:	    48 89 c7             	mov    %rax,%rdi
+    1934:	    e8 9a 07 00 00       	call   20d3 <nel::operator<<(nel::Log&, unsigned long)>
+    1939:	    48 8d 35 71 17 00 00 	lea    0x1771(%rip),%rsi        # 30b1 <_IO_stdin_used+0xb1>
+    1940:	    48 89 c7             	mov    %rax,%rdi
+    1943:	    e8 f0 06 00 00       	call   2038 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    1948:	    41 0f b6 34 24       	movzbl (%r12),%esi
+    194d:	    48 89 df             	mov    %rbx,%rdi
+    1950:	    e8 fb 06 00 00       	call   2050 <nel::operator<<(nel::Log&, unsigned char)>
+                    outs << ' ' << val.data_[i];
+    1955:	/-> be 20 00 00 00       	mov    $0x20,%esi
+    195a:	|   48 89 df             	mov    %rbx,%rdi
+    195d:	|   e8 bd 06 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+    1962:	|   41 0f b6 34 2c       	movzbl (%r12,%rbp,1),%esi
+                for (Index i = 1; i < val.len(); ++i) {
+    1967:	|   48 ff c5             	inc    %rbp
+                    outs << ' ' << val.data_[i];
+    196a:	|   48 89 c7             	mov    %rax,%rdi
+    196d:	|   e8 de 06 00 00       	call   2050 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1972:	|   48 81 fd 00 01 00 00 	cmp    $0x100,%rbp
+    1979:	\-- 75 da                	jne    1955 <operator<<(nel::Log&, U8Buf<256ul> const&)+0x44>
+                }
+            }
+            outs << '}';
+    197b:	    48 89 df             	mov    %rbx,%rdi
+    197e:	    be 7d 00 00 00       	mov    $0x7d,%esi
+    1983:	    e8 97 06 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+            return outs;
+        }
+    1988:	    48 89 d8             	mov    %rbx,%rax
+    198b:	    5b                   	pop    %rbx
+    198c:	    5d                   	pop    %rbp
+    198d:	    41 5c                	pop    %r12
+    198f:	    c3                   	ret
+
+0000000000001990 <nel::heaped::operator<<(nel::Log&, nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > const&)>:
+         * @param outs the stream to dump the representation into.
+         */
+        // TODO: replace <<(Log ) with dbgfmt, so separate out from
+        // any other form of conversion to charstring.
+        // TODO: insert into formatter and not final dest type.
+        friend Log &operator<<(Log &outs, Vector const &v)
+    1990:	          41 55                	push   %r13
+    1992:	          41 54                	push   %r12
+    1994:	          55                   	push   %rbp
+    1995:	          48 89 f5             	mov    %rsi,%rbp
+        {
+            outs << "Vector(" << v.len() << "){";
+    1998:	          48 8d 35 15 17 00 00 	lea    0x1715(%rip),%rsi        # 30b4 <_IO_stdin_used+0xb4>
+        friend Log &operator<<(Log &outs, Vector const &v)
+    199f:	          53                   	push   %rbx
+    19a0:	          48 89 fb             	mov    %rdi,%rbx
+    19a3:	          51                   	push   %rcx
+            outs << "Vector(" << v.len() << "){";
+    19a4:	          e8 8f 06 00 00       	call   2038 <nel::operator<<(nel::Log&, char const*)>
+    19a9:	          31 f6                	xor    %esi,%esi
+    19ab:	          48 89 c7             	mov    %rax,%rdi
+    19ae:	          48 8b 45 00          	mov    0x0(%rbp),%rax
+            return (item_ == nullptr) ? 0 : item_->len();
+    19b2:	          48 85 c0             	test   %rax,%rax
+    19b5:	      /-- 74 04                	je     19bb <nel::heaped::operator<<(nel::Log&, nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > const&)+0x2b>
+            return len_;
+    19b7:	      |   48 8b 70 08          	mov    0x8(%rax),%rsi
+            outs << "Vector(" << v.len() << "){";
+    19bb:	      \-> e8 13 07 00 00       	call   20d3 <nel::operator<<(nel::Log&, unsigned long)>
+    19c0:	          48 8d 35 f5 16 00 00 	lea    0x16f5(%rip),%rsi        # 30bc <_IO_stdin_used+0xbc>
+    19c7:	          48 89 c7             	mov    %rax,%rdi
+    19ca:	          e8 69 06 00 00       	call   2038 <nel::operator<<(nel::Log&, char const*)>
+#    if 1
+            outs << '\n';
+    19cf:	          be 0a 00 00 00       	mov    $0xa,%esi
+    19d4:	          48 89 df             	mov    %rbx,%rdi
+    19d7:	          e8 43 06 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+            if (v.item_ != nullptr) { outs << *v.item_; }
+    19dc:	          48 8b 6d 00          	mov    0x0(%rbp),%rbp
+    19e0:	          48 85 ed             	test   %rbp,%rbp
+    19e3:	/-------- 74 68                	je     1a4d <nel::heaped::operator<<(nel::Log&, nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > const&)+0xbd>
+            , e_(arr + len)
+    19e5:	|         4c 8b 65 08          	mov    0x8(%rbp),%r12
+            return Slice(values_, len());
+    19e9:	|         4c 8d 6d 10          	lea    0x10(%rbp),%r13
+#    endif
+
+    public:
+        friend Log &operator<<(Log &outs, ItT const &it)
+        {
+            outs << '[';
+    19ed:	|         be 5b 00 00 00       	mov    $0x5b,%esi
+    19f2:	|         48 89 df             	mov    %rbx,%rdi
+    19f5:	|         49 c1 e4 08          	shl    $0x8,%r12
+    19f9:	|         4d 01 ec             	add    %r13,%r12
+    19fc:	|         e8 1e 06 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+                //++i;
+                // });
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+            }
+#    elif defined(C_LIKE)
+            if (!it2.is_done()) {
+    1a01:	|         4d 39 e5             	cmp    %r12,%r13
+    1a04:	|     /-- 75 0f                	jne    1a15 <nel::heaped::operator<<(nel::Log&, nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > const&)+0x85>
+#        elif defined(C_LIKE)
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+#        endif
+            }
+#    endif
+            outs << ']';
+    1a06:	|  /--|-> be 5d 00 00 00       	mov    $0x5d,%esi
+    1a0b:	|  |  |   48 89 df             	mov    %rbx,%rdi
+    1a0e:	|  |  |   e8 0c 06 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+
+    public:
+        friend Log &operator<<(Log &outs, Node const &v)
+        {
+            outs << v.iter();
+            return outs;
+    1a13:	+--|--|-- eb 38                	jmp    1a4d <nel::heaped::operator<<(nel::Log&, nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > const&)+0xbd>
+                outs << it2.deref();
+    1a15:	|  |  \-> 4c 89 ee             	mov    %r13,%rsi
+    1a18:	|  |      48 89 df             	mov    %rbx,%rdi
+            ++b_;
+    1a1b:	|  |      48 81 c5 10 01 00 00 	add    $0x110,%rbp
+    1a22:	|  |      e8 ea fe ff ff       	call   1911 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+            for (; !self().is_done(); self().inc()) {
+    1a27:	|  |  /-> 49 39 ec             	cmp    %rbp,%r12
+    1a2a:	|  \--|-- 74 da                	je     1a06 <nel::heaped::operator<<(nel::Log&, nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > const&)+0x76>
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    1a2c:	|     |   be 2c 00 00 00       	mov    $0x2c,%esi
+    1a31:	|     |   48 89 df             	mov    %rbx,%rdi
+    1a34:	|     |   e8 e6 05 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+    1a39:	|     |   48 89 ee             	mov    %rbp,%rsi
+    1a3c:	|     |   48 81 c5 00 01 00 00 	add    $0x100,%rbp
+    1a43:	|     |   48 89 c7             	mov    %rax,%rdi
+    1a46:	|     |   e8 c6 fe ff ff       	call   1911 <operator<<(nel::Log&, U8Buf<256ul> const&)>
+        }
+    1a4b:	|     \-- eb da                	jmp    1a27 <nel::heaped::operator<<(nel::Log&, nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > const&)+0x97>
+#    else
+            if (v.item_ != nullptr) { outs << *v.item_; }
+#    endif
+            outs << '}';
+    1a4d:	\-------> 48 89 df             	mov    %rbx,%rdi
+    1a50:	          be 7d 00 00 00       	mov    $0x7d,%esi
+    1a55:	          e8 c5 05 00 00       	call   201f <nel::operator<<(nel::Log&, char)>
+            return outs;
+        }
+    1a5a:	          5a                   	pop    %rdx
+    1a5b:	          48 89 d8             	mov    %rbx,%rax
+    1a5e:	          5b                   	pop    %rbx
+    1a5f:	          5d                   	pop    %rbp
+    1a60:	          41 5c                	pop    %r12
+    1a62:	          41 5d                	pop    %r13
+    1a64:	          c3                   	ret
+
+0000000000001a65 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)>:
+            if (new_cap > max_capacity) { return nullptr; }
+    1a65:	                48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    1a6c:	                ff 7f 00 
+        static Node *realloc(Node *const old_n, Count const new_cap)
+    1a6f:	                41 57                	push   %r15
+    1a71:	                41 56                	push   %r14
+    1a73:	                41 55                	push   %r13
+    1a75:	                41 54                	push   %r12
+    1a77:	                55                   	push   %rbp
+    1a78:	                53                   	push   %rbx
+    1a79:	                48 83 ec 48          	sub    $0x48,%rsp
+            if (new_cap > max_capacity) { return nullptr; }
+    1a7d:	                48 39 f0             	cmp    %rsi,%rax
+    1a80:	   /----------- 0f 82 a3 00 00 00    	jb     1b29 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0xc4>
+    1a86:	   |            48 89 fb             	mov    %rdi,%rbx
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1a89:	   |            48 89 f7             	mov    %rsi,%rdi
+    1a8c:	   |            49 89 f6             	mov    %rsi,%r14
+    1a8f:	   |            48 c1 e7 08          	shl    $0x8,%rdi
+    1a93:	   |            48 83 c7 10          	add    $0x10,%rdi
+            if (align == 0 || (align & (align - 1)) != 0) {
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+            }
+            void *const new_p = is_over_aligned(align)
+                                    ? realloc_aligned(p, align, old_size, new_size)
+                                    : std::realloc(p, new_size);
+    1a97:	   |            e8 f4 f5 ff ff       	call   1090 <malloc@plt>
+            if (new_p == nullptr) {
+    1a9c:	   |            48 85 c0             	test   %rax,%rax
+    1a9f:	   |     /----- 75 12                	jne    1ab3 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x4e>
+            : tag_(Tag::ERR)
+    1aa1:	   |     |      c7 44 24 18 02 00 00 	movl   $0x2,0x18(%rsp)
+    1aa8:	   |     |      00 
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+            : value_(forward<Type>(val))
+    1aa9:	   |     |      c7 44 24 20 01 00 00 	movl   $0x1,0x20(%rsp)
+    1ab0:	   |     |      00 
+    1ab1:	   |     |  /-- eb 0d                	jmp    1ac0 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x5b>
+            : tag_(Tag::OK)
+    1ab3:	   |     \--|-> c7 44 24 18 01 00 00 	movl   $0x1,0x18(%rsp)
+    1aba:	   |        |   00 
+        {
+        }
+
+        template<typename... Args>
+        constexpr Element(Args &&...args)
+            : value_(forward<Args>(args)...)
+    1abb:	   |        |   48 89 44 24 20       	mov    %rax,0x20(%rsp)
+            : fn_name_(fn_name)
+    1ac0:	   |        \-> 48 8d 05 f8 15 00 00 	lea    0x15f8(%rip),%rax        # 30bf <_IO_stdin_used+0xbf>
+            , line_num_(line_num)
+    1ac7:	   |            c7 44 24 38 8e 00 00 	movl   $0x8e,0x38(%rsp)
+    1ace:	   |            00 
+            : fn_name_(fn_name)
+    1acf:	   |            48 89 44 24 28       	mov    %rax,0x28(%rsp)
+            , file_name_(file_name)
+    1ad4:	   |            48 8d 05 ec 15 00 00 	lea    0x15ec(%rip),%rax        # 30c7 <_IO_stdin_used+0xc7>
+    1adb:	   |            48 89 44 24 30       	mov    %rax,0x30(%rsp)
+    1ae0:	   |            8b 44 24 18          	mov    0x18(%rsp),%eax
+            switch (tag_) { // result-match
+    1ae4:	   |            83 f8 01             	cmp    $0x1,%eax
+    1ae7:	   |     /----- 74 21                	je     1b0a <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0xa5>
+    1ae9:	   |     |      83 f8 02             	cmp    $0x2,%eax
+    1aec:	   |  /--|----- 74 31                	je     1b1f <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0xba>
+    1aee:	   |  |  |      85 c0                	test   %eax,%eax
+                    nel::panic("invalid Result", ctx);
+    1af0:	   |  |  |      48 8d 3d 0d 15 00 00 	lea    0x150d(%rip),%rdi        # 3004 <_IO_stdin_used+0x4>
+    1af7:	   |  |  |      48 8d 74 24 28       	lea    0x28(%rsp),%rsi
+            switch (tag_) { // result-match
+    1afc:	   |  |  |  /-- 74 07                	je     1b05 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0xa0>
+                    nel::panic("bad Result", ctx);
+    1afe:	   |  |  |  |   48 8d 3d 0e 15 00 00 	lea    0x150e(%rip),%rdi        # 3013 <_IO_stdin_used+0x13>
+    1b05:	   |  |  |  \-> e8 f8 f5 ff ff       	call   1102 <nel::panic(char const*, nel::Context const&)>
+            tag_ = Tag::INVAL;
+    1b0a:	   |  |  \----> 31 c0                	xor    %eax,%eax
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+    1b0c:	   |  |         4c 8b 6c 24 20       	mov    0x20(%rsp),%r13
+            tag_ = Tag::INVAL;
+    1b11:	   |  |         89 44 24 18          	mov    %eax,0x18(%rsp)
+                if (old_n != nullptr) {
+    1b15:	   |  |         48 85 db             	test   %rbx,%rbx
+    1b18:	   |  |     /-- 75 17                	jne    1b31 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0xcc>
+    1b1a:	/--|--|-----|-- e9 d6 00 00 00       	jmp    1bf5 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x190>
+            }
+    1b1f:	|  |  \-----|-> 48 8d 7c 24 18       	lea    0x18(%rsp),%rdi
+    1b24:	|  |        |   e8 4d fd ff ff       	call   1876 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+            if (new_cap > max_capacity) { return nullptr; }
+    1b29:	|  \--------|-> 45 31 ed             	xor    %r13d,%r13d
+    1b2c:	|  /--------|-- e9 d2 00 00 00       	jmp    1c03 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x19e>
+                    nel::assert(old_n->len_ <= new_cap, "heaped::Node: shrinking below len");
+    1b31:	|  |        \-> 48 8b 43 08          	mov    0x8(%rbx),%rax
+            , line_num_(line_num)
+    1b35:	|  |            c7 44 24 38 91 00 00 	movl   $0x91,0x38(%rsp)
+    1b3c:	|  |            00 
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    1b3d:	|  |            49 39 c6             	cmp    %rax,%r14
+    1b40:	|  |        /-- 73 11                	jae    1b53 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0xee>
+    1b42:	|  |        |   48 8d 74 24 28       	lea    0x28(%rsp),%rsi
+    1b47:	|  |        |   48 8d 3d 90 15 00 00 	lea    0x1590(%rip),%rdi        # 30de <_IO_stdin_used+0xde>
+    1b4e:	|  |        |   e8 df f5 ff ff       	call   1132 <nel::assert_fail(char const*, nel::Context const&)>
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    1b53:	|  |        \-> 48 8d 6b 10          	lea    0x10(%rbx),%rbp
+    1b57:	|  |            4d 8d 65 10          	lea    0x10(%r13),%r12
+                    new_n->len_ = old_n->len_;
+    1b5b:	|  |            49 89 45 08          	mov    %rax,0x8(%r13)
+void relocate(uint8_t *const d, uint8_t *const s, Length const n);
+
+template<typename T>
+void relocate(T d[], T s[], Length const n)
+{
+    if (d == s) { return; }
+    1b5f:	|  |            4c 39 e5             	cmp    %r12,%rbp
+    1b62:	|  |        /-- 75 0d                	jne    1b71 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x10c>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    1b64:	|  |     /--|-> 48 89 df             	mov    %rbx,%rdi
+    1b67:	|  |     |  |   e8 c4 f4 ff ff       	call   1030 <free@plt>
+    1b6c:	+--|-----|--|-- e9 84 00 00 00       	jmp    1bf5 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x190>
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    1b71:	|  |     |  \-> 4c 8b 7b 08          	mov    0x8(%rbx),%r15
+    if constexpr (is_trivially_relocatable<T>) {
+        relocate(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t *>(s), n * sizeof(T));
+    } else if (d < s) {
+    1b75:	|  |     |      49 39 ec             	cmp    %rbp,%r12
+    1b78:	|  |     |  /-- 72 10                	jb     1b8a <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x125>
+    1b7a:	|  |     |  |   4c 89 fd             	mov    %r15,%rbp
+    1b7d:	|  |     |  |   48 c1 e5 08          	shl    $0x8,%rbp
+    1b81:	|  |     |  |   48 81 ed f0 00 00 00 	sub    $0xf0,%rbp
+    1b88:	|  |  /--|--|-- eb 3c                	jmp    1bc6 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x161>
+        // forwards, so overlap is not overwritten before it is read.
+        for (Index i = 0; i < n; ++i) {
+    1b8a:	|  |  |  |  \-> 31 c0                	xor    %eax,%eax
+    1b8c:	|  |  |  |  /-> 49 39 c7             	cmp    %rax,%r15
+    1b8f:	|  |  |  +--|-- 74 d3                	je     1b64 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0xff>
+            nel::elem::move(data_, o.data_, N);
+    1b91:	|  |  |  |  |   48 89 ee             	mov    %rbp,%rsi
+    1b94:	|  |  |  |  |   4c 89 e7             	mov    %r12,%rdi
+    1b97:	|  |  |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1b9c:	|  |  |  |  |   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1ba1:	|  |  |  |  |   e8 02 02 00 00       	call   1da8 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            new (&d[i]) T(nel::move(s[i]));
+            s[i].~T();
+    1ba6:	|  |  |  |  |   48 89 ef             	mov    %rbp,%rdi
+    1ba9:	|  |  |  |  |   49 81 c4 00 01 00 00 	add    $0x100,%r12
+    1bb0:	|  |  |  |  |   48 81 c5 00 01 00 00 	add    $0x100,%rbp
+    1bb7:	|  |  |  |  |   e8 f6 fc ff ff       	call   18b2 <U8Buf<256ul>::~U8Buf()>
+        for (Index i = 0; i < n; ++i) {
+    1bbc:	|  |  |  |  |   48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    1bc1:	|  |  |  |  |   48 ff c0             	inc    %rax
+    1bc4:	|  |  |  |  \-- eb c6                	jmp    1b8c <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x127>
+        }
+    } else {
+        // backwards, so overlap is not overwritten before it is read.
+        for (Index i = n; i > 0; --i) {
+    1bc6:	|  |  >--|----> 4d 85 ff             	test   %r15,%r15
+    1bc9:	|  |  |  \----- 74 99                	je     1b64 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0xff>
+            new (&d[i - 1]) T(nel::move(s[i - 1]));
+    1bcb:	|  |  |         4c 8d 24 2b          	lea    (%rbx,%rbp,1),%r12
+    1bcf:	|  |  |         49 8d 7c 2d 00       	lea    0x0(%r13,%rbp,1),%rdi
+    1bd4:	|  |  |         ba 00 01 00 00       	mov    $0x100,%edx
+        for (Index i = n; i > 0; --i) {
+    1bd9:	|  |  |         49 ff cf             	dec    %r15
+    1bdc:	|  |  |         4c 89 e6             	mov    %r12,%rsi
+    1bdf:	|  |  |         48 81 ed 00 01 00 00 	sub    $0x100,%rbp
+    1be6:	|  |  |         e8 bd 01 00 00       	call   1da8 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            s[i - 1].~T();
+    1beb:	|  |  |         4c 89 e7             	mov    %r12,%rdi
+    1bee:	|  |  |         e8 bf fc ff ff       	call   18b2 <U8Buf<256ul>::~U8Buf()>
+        for (Index i = n; i > 0; --i) {
+    1bf3:	|  |  \-------- eb d1                	jmp    1bc6 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)+0x161>
+            }
+    1bf5:	\--|----------> 48 8d 7c 24 18       	lea    0x18(%rsp),%rdi
+    1bfa:	   |            e8 77 fc ff ff       	call   1876 <nel::Result<void*, nel::heaped::AllocError>::~Result()>
+            new_n->alloc_ = new_cap;
+    1bff:	   |            4d 89 75 00          	mov    %r14,0x0(%r13)
+        }
+    1c03:	   \----------> 48 83 c4 48          	add    $0x48,%rsp
+    1c07:	                4c 89 e8             	mov    %r13,%rax
+    1c0a:	                5b                   	pop    %rbx
+    1c0b:	                5d                   	pop    %rbp
+    1c0c:	                41 5c                	pop    %r12
+    1c0e:	                41 5d                	pop    %r13
+    1c10:	                41 5e                	pop    %r14
+    1c12:	                41 5f                	pop    %r15
+    1c14:	                c3                   	ret
+    1c15:	                90                   	nop
+
+0000000000001c16 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>:
+        bool try_reserve_for(Count const n)
+    1c16:	                   53                   	push   %rbx
+    1c17:	                   48 89 fb             	mov    %rdi,%rbx
+    1c1a:	                   48 8b 3f             	mov    (%rdi),%rdi
+            return (item_ == nullptr) ? 0 : item_->len();
+    1c1d:	                   48 85 ff             	test   %rdi,%rdi
+    1c20:	               /-- 75 07                	jne    1c29 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x13>
+            if (len() + n <= capacity()) { return true; }
+    1c22:	               |   48 85 f6             	test   %rsi,%rsi
+    1c25:	/--------------|-- 74 12                	je     1c39 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x23>
+    1c27:	|           /--|-- eb 14                	jmp    1c3d <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x27>
+            return len_;
+    1c29:	|           |  \-> 48 8b 57 08          	mov    0x8(%rdi),%rdx
+            return alloc_;
+    1c2d:	|           |      48 8b 0f             	mov    (%rdi),%rcx
+    1c30:	|           |      48 8d 04 16          	lea    (%rsi,%rdx,1),%rax
+    1c34:	|           |      48 39 c1             	cmp    %rax,%rcx
+    1c37:	|           |  /-- 72 24                	jb     1c5d <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x47>
+    1c39:	>-----------|--|-> b0 01                	mov    $0x1,%al
+    1c3b:	|  /--------|--|-- eb 72                	jmp    1caf <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x99>
+            Node *new_n = realloc(nullptr, capacity);
+    1c3d:	|  |        \--|-> b8 04 00 00 00       	mov    $0x4,%eax
+    1c42:	|  |           |   48 39 c6             	cmp    %rax,%rsi
+    1c45:	|  |           |   48 0f 42 f0          	cmovb  %rax,%rsi
+    1c49:	|  |           |   31 ff                	xor    %edi,%edi
+    1c4b:	|  |           |   e8 15 fe ff ff       	call   1a65 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)>
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    1c50:	|  |           |   48 85 c0             	test   %rax,%rax
+    1c53:	|  |     /-----|-- 74 42                	je     1c97 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x81>
+    1c55:	|  |     |     |   31 d2                	xor    %edx,%edx
+    1c57:	|  |     |     |   48 89 50 08          	mov    %rdx,0x8(%rax)
+    1c5b:	|  |  /--|-----|-- eb 4d                	jmp    1caa <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x94>
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            if (cap <= cur) { return cap; }
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    1c5d:	|  |  |  |     \-> 48 83 f9 03          	cmp    $0x3,%rcx
+    1c61:	|  |  |  |     /-- 77 18                	ja     1c7b <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x65>
+    1c63:	|  |  |  |     |   b9 04 00 00 00       	mov    $0x4,%ecx
+    1c68:	|  |  |  |     |   48 39 c8             	cmp    %rcx,%rax
+    1c6b:	|  |  |  |     |   48 0f 42 c1          	cmovb  %rcx,%rax
+    1c6f:	|  |  |  |     |   48 39 d0             	cmp    %rdx,%rax
+    1c72:	|  |  |  |     |   48 0f 43 d0          	cmovae %rax,%rdx
+    1c76:	|  |  |  |     |   48 89 d6             	mov    %rdx,%rsi
+    1c79:	|  |  |  |  /--|-- eb 25                	jmp    1ca0 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x8a>
+    1c7b:	|  |  |  |  |  \-> 48 8d 34 09          	lea    (%rcx,%rcx,1),%rsi
+    1c7f:	|  |  |  |  |      48 39 c6             	cmp    %rax,%rsi
+    1c82:	|  |  |  |  |      48 0f 43 c6          	cmovae %rsi,%rax
+    1c86:	|  |  |  |  |      48 39 d0             	cmp    %rdx,%rax
+    1c89:	|  |  |  |  |      48 0f 43 d0          	cmovae %rax,%rdx
+    1c8d:	|  |  |  |  |      48 89 d6             	mov    %rdx,%rsi
+            } else if (new_cap == item_->capacity()) {
+    1c90:	|  |  |  |  |      48 39 d1             	cmp    %rdx,%rcx
+    1c93:	|  |  |  |  +----- 75 0b                	jne    1ca0 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x8a>
+    1c95:	+--|--|--|--|----- eb a2                	jmp    1c39 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x23>
+                item_ = VectorNode::malloc(new_cap);
+    1c97:	|  |  |  \--|----> 31 c0                	xor    %eax,%eax
+    1c99:	|  |  |     |      48 89 03             	mov    %rax,(%rbx)
+                if (item_ == nullptr) { return false; }
+    1c9c:	|  |  |     |  /-> 31 c0                	xor    %eax,%eax
+    1c9e:	|  +--|-----|--|-- eb 0f                	jmp    1caf <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x99>
+                VectorNode *p = VectorNode::realloc(item_, new_cap);
+    1ca0:	|  |  |     \--|-> e8 c0 fd ff ff       	call   1a65 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)>
+                if (p == nullptr) { return false; }
+    1ca5:	|  |  |        |   48 85 c0             	test   %rax,%rax
+    1ca8:	|  |  |        \-- 74 f2                	je     1c9c <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x86>
+                item_ = p;
+    1caa:	|  |  \----------> 48 89 03             	mov    %rax,(%rbx)
+    1cad:	\--|-------------- eb 8a                	jmp    1c39 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)+0x23>
+        }
+    1caf:	   \-------------> 5b                   	pop    %rbx
+    1cb0:	                   c3                   	ret
+    1cb1:	                   90                   	nop
+
+0000000000001cb2 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)>:
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Args &&...args)
+    1cb2:	       41 54                	push   %r12
+    1cb4:	       49 89 d4             	mov    %rdx,%r12
+    1cb7:	       55                   	push   %rbp
+    1cb8:	       48 89 f5             	mov    %rsi,%rbp
+            ok = try_reserve_for(1);
+    1cbb:	       be 01 00 00 00       	mov    $0x1,%esi
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Args &&...args)
+    1cc0:	       53                   	push   %rbx
+    1cc1:	       48 89 fb             	mov    %rdi,%rbx
+            ok = try_reserve_for(1);
+    1cc4:	       48 89 ef             	mov    %rbp,%rdi
+    1cc7:	       e8 4a ff ff ff       	call   1c16 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::try_reserve_for(unsigned long)>
+            if (!ok) { return Result<void, Type>::Err(forward<Args>(args)...); }
+    1ccc:	       84 c0                	test   %al,%al
+    1cce:	   /-- 74 13                	je     1ce3 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x31>
+            if (item_ == nullptr) { return Result<void, Type>::Err(forward<Args>(args)...); }
+    1cd0:	   |   48 8b 6d 00          	mov    0x0(%rbp),%rbp
+    1cd4:	   |   48 85 ed             	test   %rbp,%rbp
+    1cd7:	   +-- 74 0a                	je     1ce3 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x31>
+            return len_;
+    1cd9:	   |   48 8b 45 08          	mov    0x8(%rbp),%rax
+            if (len() >= capacity()) {
+    1cdd:	   |   48 3b 45 00          	cmp    0x0(%rbp),%rax
+    1ce1:	/--|-- 72 1b                	jb     1cfe <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x4c>
+            : tag_(Tag::ERR)
+    1ce3:	|  \-> c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+            nel::elem::set(data_, f, N);
+    1ce9:	|      41 0f b6 34 24       	movzbl (%r12),%esi
+            , err_(forward<Args>(args)...)
+    1cee:	|      48 8d 7b 04          	lea    0x4(%rbx),%rdi
+    1cf2:	|      ba 00 01 00 00       	mov    $0x100,%edx
+    1cf7:	|      e8 a4 00 00 00       	call   1da0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        }
+    1cfc:	|  /-- eb 22                	jmp    1d20 <nel::Result<void, U8Buf<256ul> > nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::push<unsigned char>(unsigned char&&)+0x6e>
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    1cfe:	\--|-> 48 c1 e0 08          	shl    $0x8,%rax
+            nel::elem::set(data_, f, N);
+    1d02:	   |   41 0f b6 34 24       	movzbl (%r12),%esi
+    1d07:	   |   ba 00 01 00 00       	mov    $0x100,%edx
+    1d0c:	   |   48 8d 7c 05 10       	lea    0x10(%rbp,%rax,1),%rdi
+    1d11:	   |   e8 8a 00 00 00       	call   1da0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            len_ += 1;
+    1d16:	   |   48 ff 45 08          	incq   0x8(%rbp)
+            : tag_(Tag::OK)
+    1d1a:	   |   c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+        }
+    1d20:	   \-> 48 89 d8             	mov    %rbx,%rax
+    1d23:	       5b                   	pop    %rbx
+    1d24:	       5d                   	pop    %rbp
+    1d25:	       41 5c                	pop    %r12
+    1d27:	       c3                   	ret
+
+0000000000001d28 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::~Node()>:
+        constexpr ~Node(void)
+    1d28:	       41 54                	push   %r12
+    1d2a:	       4c 8d 67 10          	lea    0x10(%rdi),%r12
+    1d2e:	       55                   	push   %rbp
+            for (Index i = 0; i < len(); ++i) {
+    1d2f:	       31 ed                	xor    %ebp,%ebp
+        constexpr ~Node(void)
+    1d31:	       53                   	push   %rbx
+    1d32:	       48 89 fb             	mov    %rdi,%rbx
+            for (Index i = 0; i < len(); ++i) {
+    1d35:	/----> 48 3b 6b 08          	cmp    0x8(%rbx),%rbp
+    1d39:	|  /-- 73 14                	jae    1d4f <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::~Node()+0x27>
+                values_[i].~Type();
+    1d3b:	|  |   4c 89 e7             	mov    %r12,%rdi
+            for (Index i = 0; i < len(); ++i) {
+    1d3e:	|  |   48 ff c5             	inc    %rbp
+    1d41:	|  |   49 81 c4 00 01 00 00 	add    $0x100,%r12
+                values_[i].~Type();
+    1d48:	|  |   e8 65 fb ff ff       	call   18b2 <U8Buf<256ul>::~U8Buf()>
+            for (Index i = 0; i < len(); ++i) {
+    1d4d:	\--|-- eb e6                	jmp    1d35 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::~Node()+0xd>
+        }
+    1d4f:	   \-> 5b                   	pop    %rbx
+    1d50:	       5d                   	pop    %rbp
+    1d51:	       41 5c                	pop    %r12
+    1d53:	       c3                   	ret
+
+0000000000001d54 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()>:
+        ~Vector(void)
+    1d54:	    53                   	push   %rbx
+            VectorNode::free(item_);
+    1d55:	    48 8b 1f             	mov    (%rdi),%rbx
+            if (old == nullptr) { return; }
+    1d58:	    48 85 db             	test   %rbx,%rbx
+    1d5b:	/-- 74 11                	je     1d6e <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::~Vector()+0x1a>
+            old->~Node();
+    1d5d:	|   48 89 df             	mov    %rbx,%rdi
+    1d60:	|   e8 c3 ff ff ff       	call   1d28 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::~Node()>
+    1d65:	|   48 89 df             	mov    %rbx,%rdi
+        }
+    1d68:	|   5b                   	pop    %rbx
+    1d69:	|   e9 c2 f2 ff ff       	jmp    1030 <free@plt>
+    1d6e:	\-> 5b                   	pop    %rbx
+    1d6f:	    c3                   	ret
+
+0000000000001d70 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)>:
+        static constexpr Vector with_capacity(Count cap)
+    1d70:	       53                   	push   %rbx
+    1d71:	       48 89 fb             	mov    %rdi,%rbx
+            if (cap == 0) { return Vector(); }
+    1d74:	       48 85 f6             	test   %rsi,%rsi
+    1d77:	   /-- 75 07                	jne    1d80 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x10>
+            : item_(nullptr)
+    1d79:	   |   31 c9                	xor    %ecx,%ecx
+    1d7b:	   |   48 89 0f             	mov    %rcx,(%rdi)
+        }
+    1d7e:	/--|-- eb 15                	jmp    1d95 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x25>
+            Node *new_n = realloc(nullptr, capacity);
+    1d80:	|  \-> 31 ff                	xor    %edi,%edi
+    1d82:	|      e8 de fc ff ff       	call   1a65 <nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>::realloc(nel::heaped::Node<U8Buf<256ul>, nel::heaped::Malloc>*, unsigned long)>
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    1d87:	|      48 85 c0             	test   %rax,%rax
+    1d8a:	|  /-- 74 06                	je     1d92 <nel::heaped::Vector<U8Buf<256ul>, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> >::with_capacity(unsigned long)+0x22>
+    1d8c:	|  |   31 d2                	xor    %edx,%edx
+    1d8e:	|  |   48 89 50 08          	mov    %rdx,0x8(%rax)
+            : item_(move(o.item_))
+    1d92:	|  \-> 48 89 03             	mov    %rax,(%rbx)
+        }
+    1d95:	\----> 48 89 d8             	mov    %rbx,%rax
+    1d98:	       5b                   	pop    %rbx
+    1d99:	       c3                   	ret
+
+0000000000001d9a <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+namespace nel
+{
+namespace elem
+{
+void copy(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1d9a:	48 89 d1             	mov    %rdx,%rcx
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    1d9d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1d9f:	c3                   	ret
+
+0000000000001da0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+
+void set(uint8_t *const d, uint8_t const s, Length const n)
+{
+    1da0:	48 89 d1             	mov    %rdx,%rcx
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    1da3:	89 f0                	mov    %esi,%eax
+    1da5:	f3 aa                	rep stos %al,%es:(%rdi)
+}
+    1da7:	c3                   	ret
+
+0000000000001da8 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    1da8:	48 89 d1             	mov    %rdx,%rcx
+    1dab:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    1dad:	c3                   	ret
+
+0000000000001dae <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    1dae:	e9 fd f2 ff ff       	jmp    10b0 <memmove@plt>
+
+0000000000001db3 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    1db3:	48 89 f1             	mov    %rsi,%rcx
+    std::memset(d, s, n);
+    1db6:	b0 a5                	mov    $0xa5,%al
+    1db8:	f3 aa                	rep stos %al,%es:(%rdi)
+    set(d, 0xa5, n);
+}
+    1dba:	c3                   	ret
+
+0000000000001dbb <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1dbb:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    1dbc:	e8 af f2 ff ff       	call   1070 <memcmp@plt>
+}
+    1dc1:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) == 0;
+    1dc2:	85 c0                	test   %eax,%eax
+    1dc4:	0f 94 c0             	sete   %al
+}
+    1dc7:	c3                   	ret
+
+0000000000001dc8 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1dc8:	50                   	push   %rax
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    1dc9:	e8 a2 f2 ff ff       	call   1070 <memcmp@plt>
+}
+    1dce:	5a                   	pop    %rdx
+    return std::memcmp(a, b, n) != 0;
+    1dcf:	85 c0                	test   %eax,%eax
+    1dd1:	0f 95 c0             	setne  %al
+}
+    1dd4:	c3                   	ret
+
+0000000000001dd5 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+{
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    1dd5:	          49 89 fa             	mov    %rdi,%r10
+    1dd8:	          48 89 f0             	mov    %rsi,%rax
+    if (n < streaming_min) {
+    1ddb:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1de2:	      /-- 77 05                	ja     1de9 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x14>
+    std::memcpy(d, s, n);
+    1de4:	      |   48 89 d1             	mov    %rdx,%rcx
+    1de7:	/-----|-- eb 79                	jmp    1e62 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x8d>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1de9:	|     \-> 48 89 f9             	mov    %rdi,%rcx
+    1dec:	|         48 f7 d9             	neg    %rcx
+    1def:	|         83 e1 0f             	and    $0xf,%ecx
+    1df2:	|         49 89 c8             	mov    %rcx,%r8
+    std::memcpy(d, s, n);
+    1df5:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1df7:	|         49 8d 70 40          	lea    0x40(%r8),%rsi
+    1dfb:	|         48 89 f9             	mov    %rdi,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1dfe:	|     /-> 0f 10 54 30 d0       	movups -0x30(%rax,%rsi,1),%xmm2
+    1e03:	|     |   0f 10 4c 30 e0       	movups -0x20(%rax,%rsi,1),%xmm1
+    1e08:	|     |   49 89 f0             	mov    %rsi,%r8
+    for (; i + 64 <= n; i += 64) {
+    1e0b:	|     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1e0f:	|     |   0f 10 44 30 f0       	movups -0x10(%rax,%rsi,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1e14:	|     |   0f 10 5c 30 c0       	movups -0x40(%rax,%rsi,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    1e19:	|     |   48 83 c6 40          	add    $0x40,%rsi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1e1d:	|     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    1e22:	|     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    1e27:	|     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    1e2c:	|     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    1e31:	|     |   48 39 f2             	cmp    %rsi,%rdx
+    1e34:	|     \-- 73 c8                	jae    1dfe <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x29>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    1e36:	|  /----> 49 8d 48 10          	lea    0x10(%r8),%rcx
+        stream16(d + i, load16(s + i));
+    1e3a:	|  |      4f 8d 0c 02          	lea    (%r10,%r8,1),%r9
+    for (; i + 16 <= n; i += 16) {
+    1e3e:	|  |      48 39 ca             	cmp    %rcx,%rdx
+    1e41:	|  |  /-- 72 0f                	jb     1e52 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x7d>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1e43:	|  |  |   0f 10 64 08 f0       	movups -0x10(%rax,%rcx,1),%xmm4
+    1e48:	|  |  |   49 89 c8             	mov    %rcx,%r8
+    1e4b:	|  |  |   66 41 0f e7 21       	movntdq %xmm4,(%r9)
+    for (; i + 16 <= n; i += 16) {
+    1e50:	|  \--|-- eb e4                	jmp    1e36 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x61>
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    1e52:	|     \-> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    1e55:	|         4c 29 c2             	sub    %r8,%rdx
+        stream16(d + i, load16(s + i));
+    1e58:	|         4a 8d 34 00          	lea    (%rax,%r8,1),%rsi
+    std::memcpy(d, s, n);
+    1e5c:	|         4c 89 cf             	mov    %r9,%rdi
+    copy(d + i, s + i, n - i);
+    1e5f:	|         48 89 d1             	mov    %rdx,%rcx
+    std::memcpy(d, s, n);
+    1e62:	\-------> f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+}
+    1e64:	          c3                   	ret
+
+0000000000001e65 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    1e65:	          49 89 f8             	mov    %rdi,%r8
+    if (n < streaming_min) {
+    1e68:	          48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1e6f:	/-------- 77 37                	ja     1ea8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x43>
+    Length done = (n < 16) ? n : 16;
+    1e71:	|         b8 10 00 00 00       	mov    $0x10,%eax
+    1e76:	|         48 39 c2             	cmp    %rax,%rdx
+    1e79:	|         48 0f 46 c2          	cmovbe %rdx,%rax
+    std::memcpy(d, s, n);
+    1e7d:	|         89 c1                	mov    %eax,%ecx
+    1e7f:	|         f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    1e81:	|  /----> 48 39 d0             	cmp    %rdx,%rax
+    1e84:	|  |  /-- 73 21                	jae    1ea7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42>
+        Length const m = (done < n - done) ? done : n - done;
+    1e86:	|  |  |   49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    1e89:	|  |  |   4d 8d 14 00          	lea    (%r8,%rax,1),%r10
+    std::memcpy(d, s, n);
+    1e8d:	|  |  |   4c 89 c6             	mov    %r8,%rsi
+        Length const m = (done < n - done) ? done : n - done;
+    1e90:	|  |  |   49 29 c1             	sub    %rax,%r9
+    std::memcpy(d, s, n);
+    1e93:	|  |  |   4c 89 d7             	mov    %r10,%rdi
+        Length const m = (done < n - done) ? done : n - done;
+    1e96:	|  |  |   49 39 c1             	cmp    %rax,%r9
+    1e99:	|  |  |   4c 0f 47 c8          	cmova  %rax,%r9
+    std::memcpy(d, s, n);
+    1e9d:	|  |  |   44 89 c9             	mov    %r9d,%ecx
+        done += m;
+    1ea0:	|  |  |   4c 01 c8             	add    %r9,%rax
+    std::memcpy(d, s, n);
+    1ea3:	|  |  |   f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+        done += m;
+    1ea5:	|  \--|-- eb da                	jmp    1e81 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x1c>
+    1ea7:	|     \-> c3                   	ret
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1ea8:	\-------> 48 89 f8             	mov    %rdi,%rax
+    for (Index i = 0; i < head; ++i) {
+    1eab:	          31 c9                	xor    %ecx,%ecx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1ead:	          48 f7 d8             	neg    %rax
+    1eb0:	          83 e0 0f             	and    $0xf,%eax
+    for (Index i = 0; i < head; ++i) {
+    1eb3:	   /----> 48 39 c1             	cmp    %rax,%rcx
+    1eb6:	   |  /-- 74 0d                	je     1ec5 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x60>
+        d[i] = p[i];
+    1eb8:	   |  |   40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+    1ebc:	   |  |   41 88 3c 08          	mov    %dil,(%r8,%rcx,1)
+    for (Index i = 0; i < head; ++i) {
+    1ec0:	   |  |   48 ff c1             	inc    %rcx
+    1ec3:	   \--|-- eb ee                	jmp    1eb3 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4e>
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+    1ec5:	      \-> 31 c9                	xor    %ecx,%ecx
+        rotated[i] = p[(head + i) % 16];
+    1ec7:	      /-> 48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+    1ecb:	      |   83 e7 0f             	and    $0xf,%edi
+    1ece:	      |   40 8a 3c 3e          	mov    (%rsi,%rdi,1),%dil
+    1ed2:	      |   40 88 7c 0c e8       	mov    %dil,-0x18(%rsp,%rcx,1)
+    for (Index i = 0; i < 16; ++i) {
+    1ed7:	      |   48 ff c1             	inc    %rcx
+    1eda:	      |   48 83 f9 10          	cmp    $0x10,%rcx
+    1ede:	      \-- 75 e7                	jne    1ec7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x62>
+    std::memcpy(&v, s, sizeof(v));
+    1ee0:	          0f 28 44 24 e8       	movaps -0x18(%rsp),%xmm0
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1ee5:	          48 8d 78 40          	lea    0x40(%rax),%rdi
+    1ee9:	          4c 01 c0             	add    %r8,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1eec:	      /-> 48 89 f9             	mov    %rdi,%rcx
+    for (; i + 64 <= n; i += 64) {
+    1eef:	      |   48 8d 7f 40          	lea    0x40(%rdi),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1ef3:	      |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    1ef7:	      |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    1efc:	      |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    1f01:	      |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    1f06:	      |   48 83 c0 40          	add    $0x40,%rax
+    1f0a:	      |   48 39 fa             	cmp    %rdi,%rdx
+    1f0d:	      \-- 73 dd                	jae    1eec <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x87>
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+        stream16(d + i, v);
+    1f0f:	          49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    for (; i + 16 <= n; i += 16) {
+    1f13:	   /----> 48 8d 41 10          	lea    0x10(%rcx),%rax
+    1f17:	   |      48 39 c2             	cmp    %rax,%rdx
+    1f1a:	   |  /-- 72 0a                	jb     1f26 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc1>
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1f1c:	   |  |   48 89 c1             	mov    %rax,%rcx
+    1f1f:	   |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    1f24:	   \--|-- eb ed                	jmp    1f13 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xae>
+    }
+    __builtin_ia32_sfence();
+    1f26:	      \-> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    1f29:	   /----> 48 39 d1             	cmp    %rdx,%rcx
+    1f2c:	   |  /-- 73 12                	jae    1f40 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xdb>
+        d[i] = p[i % 16];
+    1f2e:	   |  |   48 89 c8             	mov    %rcx,%rax
+    1f31:	   |  |   83 e0 0f             	and    $0xf,%eax
+    1f34:	   |  |   8a 04 06             	mov    (%rsi,%rax,1),%al
+    1f37:	   |  |   41 88 04 08          	mov    %al,(%r8,%rcx,1)
+    for (; i < n; ++i) {
+    1f3b:	   |  |   48 ff c1             	inc    %rcx
+    1f3e:	   \--|-- eb e9                	jmp    1f29 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc4>
+    }
+}
+    1f40:	      \-> c3                   	ret
+
+0000000000001f41 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    1f41:	    48 85 ff             	test   %rdi,%rdi
+    1f44:	/-- 74 09                	je     1f4f <nel::free_aligned(void*)+0xe>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    1f46:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    1f4a:	|   e9 e1 f0 ff ff       	jmp    1030 <free@plt>
+}
+    1f4f:	\-> c3                   	ret
+
+0000000000001f50 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    1f50:	       41 56                	push   %r14
+            : fn_name_(fn_name)
+    1f52:	       48 8d 05 df 11 00 00 	lea    0x11df(%rip),%rax        # 3138 <_IO_stdin_used+0x138>
+    1f59:	       41 55                	push   %r13
+    1f5b:	       41 54                	push   %r12
+    1f5d:	       55                   	push   %rbp
+    1f5e:	       53                   	push   %rbx
+    1f5f:	       48 83 ec 20          	sub    $0x20,%rsp
+    1f63:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            , file_name_(file_name)
+    1f68:	       48 8d 05 d9 11 00 00 	lea    0x11d9(%rip),%rax        # 3148 <_IO_stdin_used+0x148>
+    1f6f:	       48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            , line_num_(line_num)
+    1f74:	       c7 44 24 18 f3 00 00 	movl   $0xf3,0x18(%rsp)
+    1f7b:	       00 
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    1f7c:	       48 85 f6             	test   %rsi,%rsi
+    1f7f:	/----- 74 28                	je     1fa9 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1f81:	|      4c 8d 66 ff          	lea    -0x1(%rsi),%r12
+    1f85:	|      48 89 f3             	mov    %rsi,%rbx
+    1f88:	|      49 21 f4             	and    %rsi,%r12
+    1f8b:	+----- 75 1c                	jne    1fa9 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x59>
+    1f8d:	|      49 89 fd             	mov    %rdi,%r13
+    1f90:	|      49 89 d6             	mov    %rdx,%r14
+    1f93:	|      48 89 cd             	mov    %rcx,%rbp
+
+    uint8_t *const old_p = reinterpret_cast<uint8_t *>(p);
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1f96:	|      31 ff                	xor    %edi,%edi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    1f98:	|      4d 85 ed             	test   %r13,%r13
+    1f9b:	|  /-- 74 1d                	je     1fba <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+    1f9d:	|  |   4d 8b 65 f8          	mov    -0x8(%r13),%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1fa1:	|  |   4c 89 ef             	mov    %r13,%rdi
+    1fa4:	|  |   4c 29 e7             	sub    %r12,%rdi
+    1fa7:	|  +-- eb 11                	jmp    1fba <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x6a>
+    if (!pred) { assert_fail(msg, ctx); }
+    1fa9:	\--|-> 48 8d 74 24 08       	lea    0x8(%rsp),%rsi
+    1fae:	   |   48 8d 3d a5 11 00 00 	lea    0x11a5(%rip),%rdi        # 315a <_IO_stdin_used+0x15a>
+    1fb5:	   |   e8 78 f1 ff ff       	call   1132 <nel::assert_fail(char const*, nel::Context const&)>
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1fba:	   \-> 48 8d 34 2b          	lea    (%rbx,%rbp,1),%rsi
+    1fbe:	       e8 dd f0 ff ff       	call   10a0 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    1fc3:	       48 85 c0             	test   %rax,%rax
+    1fc6:	/----- 74 3b                	je     2003 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xb3>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1fc8:	|      48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    1fcd:	|      48 f7 db             	neg    %rbx
+    1fd0:	|      48 21 d9             	and    %rbx,%rcx
+    1fd3:	|      48 89 cb             	mov    %rcx,%rbx
+    1fd6:	|      48 29 c3             	sub    %rax,%rbx
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    1fd9:	|      4d 85 ed             	test   %r13,%r13
+    1fdc:	|  /-- 74 1e                	je     1ffc <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+    1fde:	|  |   49 39 dc             	cmp    %rbx,%r12
+    1fe1:	|  +-- 74 19                	je     1ffc <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xac>
+        // realloc moved it to a base with a different alignment,
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    1fe3:	|  |   4c 39 f5             	cmp    %r14,%rbp
+    1fe6:	|  |   4c 89 f2             	mov    %r14,%rdx
+    1fe9:	|  |   4a 8d 34 20          	lea    (%rax,%r12,1),%rsi
+    1fed:	|  |   48 89 cf             	mov    %rcx,%rdi
+    1ff0:	|  |   48 0f 46 d5          	cmovbe %rbp,%rdx
+    1ff4:	|  |   e8 b7 f0 ff ff       	call   10b0 <memmove@plt>
+    1ff9:	|  |   48 89 c1             	mov    %rax,%rcx
+    }
+    offset_field(new_p) = new_offset;
+    1ffc:	|  \-> 48 89 59 f8          	mov    %rbx,-0x8(%rcx)
+    return new_p;
+    2000:	|      48 89 c8             	mov    %rcx,%rax
+}
+    2003:	\----> 48 83 c4 20          	add    $0x20,%rsp
+    2007:	       5b                   	pop    %rbx
+    2008:	       5d                   	pop    %rbp
+    2009:	       41 5c                	pop    %r12
+    200b:	       41 5d                	pop    %r13
+    200d:	       41 5e                	pop    %r14
+    200f:	       c3                   	ret
+
+0000000000002010 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    2010:	48 89 f1             	mov    %rsi,%rcx
+    return realloc_aligned(nullptr, align, 0, size);
+    2013:	31 d2                	xor    %edx,%edx
+    2015:	48 89 fe             	mov    %rdi,%rsi
+    2018:	31 ff                	xor    %edi,%edi
+    201a:	e9 31 ff ff ff       	jmp    1f50 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>
+
+000000000000201f <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    201f:	53                   	push   %rbx
+    2020:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    2023:	40 0f be fe          	movsbl %sil,%edi
+    2027:	48 8b 35 32 30 00 00 	mov    0x3032(%rip),%rsi        # 5060 <stderr@GLIBC_2.2.5>
+    202e:	e8 2d f0 ff ff       	call   1060 <fputc@plt>
+    return outs;
+}
+    2033:	48 89 d8             	mov    %rbx,%rax
+    2036:	5b                   	pop    %rbx
+    2037:	c3                   	ret
+
+0000000000002038 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    2038:	53                   	push   %rbx
+    2039:	48 89 fb             	mov    %rdi,%rbx
+    203c:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    203f:	48 8b 35 1a 30 00 00 	mov    0x301a(%rip),%rsi        # 5060 <stderr@GLIBC_2.2.5>
+    2046:	e8 05 f0 ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    204b:	48 89 d8             	mov    %rbx,%rax
+    204e:	5b                   	pop    %rbx
+    204f:	c3                   	ret
+
+0000000000002050 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    2050:	53                   	push   %rbx
+    2051:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    2054:	48 8b 3d 05 30 00 00 	mov    0x3005(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+    205b:	40 0f b6 d6          	movzbl %sil,%edx
+    205f:	31 c0                	xor    %eax,%eax
+    2061:	48 8d 35 0d 11 00 00 	lea    0x110d(%rip),%rsi        # 3175 <_IO_stdin_used+0x175>
+    2068:	e8 13 f0 ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    206d:	48 89 d8             	mov    %rbx,%rax
+    2070:	5b                   	pop    %rbx
+    2071:	c3                   	ret
+
+0000000000002072 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    2072:	53                   	push   %rbx
+    2073:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    2076:	48 8b 3d e3 2f 00 00 	mov    0x2fe3(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+    207d:	0f b7 d6             	movzwl %si,%edx
+    2080:	31 c0                	xor    %eax,%eax
+    2082:	48 8d 35 ec 10 00 00 	lea    0x10ec(%rip),%rsi        # 3175 <_IO_stdin_used+0x175>
+    2089:	e8 f2 ef ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    208e:	48 89 d8             	mov    %rbx,%rax
+    2091:	5b                   	pop    %rbx
+    2092:	c3                   	ret
+
+0000000000002093 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    2093:	53                   	push   %rbx
+    2094:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    2097:	48 8b 3d c2 2f 00 00 	mov    0x2fc2(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+{
+    209e:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    20a0:	31 c0                	xor    %eax,%eax
+    20a2:	48 8d 35 cc 10 00 00 	lea    0x10cc(%rip),%rsi        # 3175 <_IO_stdin_used+0x175>
+    20a9:	e8 d2 ef ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    20ae:	48 89 d8             	mov    %rbx,%rax
+    20b1:	5b                   	pop    %rbx
+    20b2:	c3                   	ret
+
+00000000000020b3 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    20b3:	53                   	push   %rbx
+    20b4:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    20b7:	48 8b 3d a2 2f 00 00 	mov    0x2fa2(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+{
+    20be:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    20c0:	31 c0                	xor    %eax,%eax
+    20c2:	48 8d 35 ac 10 00 00 	lea    0x10ac(%rip),%rsi        # 3175 <_IO_stdin_used+0x175>
+    20c9:	e8 b2 ef ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    20ce:	48 89 d8             	mov    %rbx,%rax
+    20d1:	5b                   	pop    %rbx
+    20d2:	c3                   	ret
+
+00000000000020d3 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    20d3:	53                   	push   %rbx
+    20d4:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    20d7:	48 8b 3d 82 2f 00 00 	mov    0x2f82(%rip),%rdi        # 5060 <stderr@GLIBC_2.2.5>
+{
+    20de:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    20e1:	31 c0                	xor    %eax,%eax
+    20e3:	48 8d 35 8e 10 00 00 	lea    0x108e(%rip),%rsi        # 3178 <_IO_stdin_used+0x178>
+    20ea:	e8 91 ef ff ff       	call   1080 <fprintf@plt>
+    return outs;
+}
+    20ef:	48 89 d8             	mov    %rbx,%rax
+    20f2:	5b                   	pop    %rbx
+    20f3:	c3                   	ret
+
+Disassembly of section .fini:
+
+00000000000020f4 <_fini>:
+    20f4:	48 83 ec 08          	sub    $0x8,%rsp
+    20f8:	48 83 c4 08          	add    $0x8,%rsp
+    20fc:	c3                   	ret
@@ -0,0 +1,2087 @@
+
+target/release/examples/bench_small_vector:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 3f 00 00 	mov    0x3fc5(%rip),%rax        # 4fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 3f 00 00    	push   0x3fca(%rip)        # 4ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 3f 00 00    	jmp    *0x3fcc(%rip)        # 4ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 3f 00 00    	jmp    *0x3fca(%rip)        # 5000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 3f 00 00    	jmp    *0x3fc2(%rip)        # 5008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <clock_gettime@plt>:
+    1050:	ff 25 ba 3f 00 00    	jmp    *0x3fba(%rip)        # 5010 <clock_gettime@GLIBC_2.17>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <fputs@plt>:
+    1060:	ff 25 b2 3f 00 00    	jmp    *0x3fb2(%rip)        # 5018 <fputs@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <memset@plt>:
+    1070:	ff 25 aa 3f 00 00    	jmp    *0x3faa(%rip)        # 5020 <memset@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <fputc@plt>:
+    1080:	ff 25 a2 3f 00 00    	jmp    *0x3fa2(%rip)        # 5028 <fputc@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <memcmp@plt>:
+    1090:	ff 25 9a 3f 00 00    	jmp    *0x3f9a(%rip)        # 5030 <memcmp@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <fprintf@plt>:
+    10a0:	ff 25 92 3f 00 00    	jmp    *0x3f92(%rip)        # 5038 <fprintf@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <memcpy@plt>:
+    10b0:	ff 25 8a 3f 00 00    	jmp    *0x3f8a(%rip)        # 5040 <memcpy@GLIBC_2.14>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <malloc@plt>:
+    10c0:	ff 25 82 3f 00 00    	jmp    *0x3f82(%rip)        # 5048 <malloc@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <realloc@plt>:
+    10d0:	ff 25 7a 3f 00 00    	jmp    *0x3f7a(%rip)        # 5050 <realloc@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010e0 <memmove@plt>:
+    10e0:	ff 25 72 3f 00 00    	jmp    *0x3f72(%rip)        # 5058 <memmove@GLIBC_2.2.5>
+    10e6:	68 0b 00 00 00       	push   $0xb
+    10eb:	e9 30 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010f0 <__cxa_finalize@plt>:
+    10f0:	ff 25 ea 3e 00 00    	jmp    *0x3eea(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10f6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+0000000000001100 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    1100:	50                   	push   %rax
+    std::abort();
+    1101:	e8 3a ff ff ff       	call   1040 <abort@plt>
+
+0000000000001106 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    1106:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    1107:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    110a:	4c 8d 0d 9f 1f 00 00 	lea    0x1f9f(%rip),%r9        # 30b0 <_IO_stdin_used+0xb0>
+    1111:	31 c0                	xor    %eax,%eax
+    1113:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    1117:	4c 8b 07             	mov    (%rdi),%r8
+    111a:	48 8d 35 95 1f 00 00 	lea    0x1f95(%rip),%rsi        # 30b6 <_IO_stdin_used+0xb6>
+    1121:	48 8b 3d 58 3f 00 00 	mov    0x3f58(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1128:	e8 73 ff ff ff       	call   10a0 <fprintf@plt>
+    std::abort();
+    112d:	e8 0e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001132 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1132:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1136:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1139:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    113d:	31 c0                	xor    %eax,%eax
+    113f:	57                   	push   %rdi
+    1140:	48 8b 3d 39 3f 00 00 	mov    0x3f39(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1147:	4c 8d 0d 62 1f 00 00 	lea    0x1f62(%rip),%r9        # 30b0 <_IO_stdin_used+0xb0>
+    114e:	4c 8b 06             	mov    (%rsi),%r8
+    1151:	48 8d 35 6f 1f 00 00 	lea    0x1f6f(%rip),%rsi        # 30c7 <_IO_stdin_used+0xc7>
+    1158:	e8 43 ff ff ff       	call   10a0 <fprintf@plt>
+    std::abort();
+    115d:	e8 de fe ff ff       	call   1040 <abort@plt>
+
+0000000000001162 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1162:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1166:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1169:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    116d:	31 c0                	xor    %eax,%eax
+    116f:	57                   	push   %rdi
+    1170:	48 8b 3d 09 3f 00 00 	mov    0x3f09(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1177:	4c 8d 0d 5e 1f 00 00 	lea    0x1f5e(%rip),%r9        # 30dc <_IO_stdin_used+0xdc>
+    117e:	4c 8b 06             	mov    (%rsi),%r8
+    1181:	48 8d 35 3f 1f 00 00 	lea    0x1f3f(%rip),%rsi        # 30c7 <_IO_stdin_used+0xc7>
+    1188:	e8 13 ff ff ff       	call   10a0 <fprintf@plt>
+    std::abort();
+    118d:	e8 ae fe ff ff       	call   1040 <abort@plt>
+    1192:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1199:	00 00 00 
+    119c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000011a0 <main>:
+    bench::report(name, t);
+    nel::log << "  sum: " << sum << '\n';
+}
+
+int main()
+{
+    11a0:	                                                          41 57                	push   %r15
+    11a2:	                                                          48 8d 05 7a 1e 00 00 	lea    0x1e7a(%rip),%rax        # 3023 <_IO_stdin_used+0x23>
+    11a9:	                                                          48 8d 15 5f 1e 00 00 	lea    0x1e5f(%rip),%rdx        # 300f <_IO_stdin_used+0xf>
+    11b0:	                                                          41 56                	push   %r14
+    11b2:	                                                          66 48 0f 6e f2       	movq   %rdx,%xmm6
+    11b7:	                                                          66 48 0f 6e f8       	movq   %rax,%xmm7
+    long unsigned int sum = 0;
+    11bc:	                                                          45 31 f6             	xor    %r14d,%r14d
+{
+    11bf:	                                                          41 55                	push   %r13
+    11c1:	                                                          66 0f 6c f7          	punpcklqdq %xmm7,%xmm6
+    bench_lists<nel::heaped::Vector<int>>("1M lists of 6, heaped::Vector");
+    11c5:	                                                          48 8d 3d 6e 1e 00 00 	lea    0x1e6e(%rip),%rdi        # 303a <_IO_stdin_used+0x3a>
+{
+    11cc:	                                                          41 54                	push   %r12
+        for (nel::Index i = 0; i < n_lists; ++i) {
+    11ce:	                                                          45 31 e4             	xor    %r12d,%r12d
+{
+    11d1:	                                                          55                   	push   %rbp
+    11d2:	                                                          53                   	push   %rbx
+    11d3:	                                                          48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+{
+
+inline long unsigned int now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    11da:	                                                          48 8d 6c 24 60       	lea    0x60(%rsp),%rbp
+    11df:	                                                          0f 29 74 24 10       	movaps %xmm6,0x10(%rsp)
+    bench_lists<nel::heaped::Vector<int>>("1M lists of 6, heaped::Vector");
+    11e4:	                                                          e8 b7 05 00 00       	call   17a0 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)>
+    11e9:	                                                          48 89 ee             	mov    %rbp,%rsi
+    11ec:	                                                          bf 01 00 00 00       	mov    $0x1,%edi
+    11f1:	                                                          e8 5a fe ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    11f6:	                                                          4c 8b 7c 24 60       	mov    0x60(%rsp),%r15
+    11fb:	                                                          4c 8b 6c 24 68       	mov    0x68(%rsp),%r13
+         * @returns on fail, nullptr, old_n is then untouched and still valid.
+         */
+        static Node *realloc(Node *const old_n, Count const new_cap)
+        {
+            // Too big to address, size_of() would overflow.
+            if (new_cap > max_capacity) { return nullptr; }
+    1200:	                                                          48 89 6c 24 38       	mov    %rbp,0x38(%rsp)
+    1205:	                                                          4c 89 7c 24 28       	mov    %r15,0x28(%rsp)
+    120a:	                                                          4c 89 6c 24 30       	mov    %r13,0x30(%rsp)
+    120f:	                                                          90                   	nop
+            }
+        }
+
+        // default ctor is safe, will always succeed.
+        constexpr SmallVector(void)
+            : item_(nullptr)
+    1210:	                        /-------------------------------> 48 c7 44 24 60 00 00 	movq   $0x0,0x60(%rsp)
+    1217:	                        |                                 00 00 
+    1219:	                        |                                 45 89 f7             	mov    %r14d,%r15d
+            , len_(0)
+    121c:	                        |                                 44 89 f5             	mov    %r14d,%ebp
+    121f:	                        |                                 31 db                	xor    %ebx,%ebx
+    1221:	                        |                                 48 c7 44 24 68 00 00 	movq   $0x0,0x68(%rsp)
+    1228:	                        |                                 00 00 
+        /**
+         * Returns the number of items currently in use.
+         *
+         * @returns the current in use count.
+         */
+        constexpr Length len(void) const
+    122a:	                        |              /----------------> 45 8d 47 06          	lea    0x6(%r15),%r8d
+        {
+            return (item_ == nullptr) ? len_ : item_->len();
+    122e:	                        |              |                  48 85 db             	test   %rbx,%rbx
+    1231:	                        |              |  /-------------- 0f 85 de 00 00 00    	jne    1315 <main+0x175>
+    1237:	   /--------------------|--------------|--|-------------> 48 8b 4c 24 68       	mov    0x68(%rsp),%rcx
+        }
+
+        // Make room for n more values, only ever grows.
+        bool try_reserve_for(Count const n)
+        {
+            if (len() + n <= capacity()) { return true; }
+    123c:	/--|--------------------|--------------|--|-------------> 48 8d 51 01          	lea    0x1(%rcx),%rdx
+    1240:	|  |                    |              |  |               48 83 fa 08          	cmp    $0x8,%rdx
+    1244:	|  |           /--------|--------------|--|-------------- 0f 86 26 03 00 00    	jbe    1570 <main+0x3d0>
+    124a:	|  |           |        |              |  |               48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    1251:	|  |           |        |              |  |               ff ff 1f 
+    1254:	|  |           |        |              |  |               48 39 d0             	cmp    %rdx,%rax
+    1257:	|  |  /--------|--------|--------------|--|-------------- 0f 82 b1 03 00 00    	jb     160e <main+0x46e>
+    125d:	|  |  |        |        |              |  |               b8 10 00 00 00       	mov    $0x10,%eax
+    1262:	|  |  |        |        |              |  |               48 89 4c 24 08       	mov    %rcx,0x8(%rsp)
+    1267:	|  |  |        |        |              |  |               48 39 c2             	cmp    %rax,%rdx
+    126a:	|  |  |        |        |              |  |               48 0f 43 c2          	cmovae %rdx,%rax
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    126e:	|  |  |        |        |              |  |               48 8d 3c 85 14 00 00 	lea    0x14(,%rax,4),%rdi
+    1275:	|  |  |        |        |              |  |               00 
+    1276:	|  |  |        |        |              |  |               49 89 c5             	mov    %rax,%r13
+            if (align == 0 || (align & (align - 1)) != 0) {
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+            }
+            void *const new_p = is_over_aligned(align)
+                                    ? realloc_aligned(p, align, old_size, new_size)
+                                    : std::realloc(p, new_size);
+    1279:	|  |  |        |        |              |  |               e8 42 fe ff ff       	call   10c0 <malloc@plt>
+            if (new_p == nullptr) {
+    127e:	|  |  |        |        |              |  |               48 8b 4c 24 08       	mov    0x8(%rsp),%rcx
+    1283:	|  |  |        |        |              |  |               48 85 c0             	test   %rax,%rax
+    1286:	|  |  |  /-----|--------|--------------|--|-------------- 0f 84 60 03 00 00    	je     15ec <main+0x44c>
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    128c:	|  |  |  |     |        |              |  |               66 0f 6f 6c 24 10    	movdqa 0x10(%rsp),%xmm5
+                    // poison new memory,
+                    // assumes realloc adds to end
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+                }
+            }
+            new_n->alloc_ = new_cap;
+    1292:	|  |  |  |     |        |              |  |               4c 89 28             	mov    %r13,(%rax)
+            if (new_n != nullptr) { new_n->len_ = 0; }
+    1295:	|  |  |  |     |        |              |  |               48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+    129c:	|  |  |  |     |        |              |  |               00 
+            , file_name_(file_name)
+            , line_num_(line_num)
+    129d:	|  |  |  |     |        |              |  |               c7 44 24 50 5c 01 00 	movl   $0x15c,0x50(%rsp)
+    12a4:	|  |  |  |     |        |              |  |               00 
+            : fn_name_(fn_name)
+    12a5:	|  |  |  |     |        |              |  |               0f 29 6c 24 40       	movaps %xmm5,0x40(%rsp)
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    12aa:	|  |  |  |     |        |              |  |               49 39 cd             	cmp    %rcx,%r13
+    12ad:	|  |  |  |  /--|--------|--------------|--|-------------- 0f 82 4a 03 00 00    	jb     15fd <main+0x45d>
+        // Relocate n values from s onto the end, s is left uninitialised.
+        // Caller must have made room.
+        void push_back_relocated(Type s[], Count const n)
+        {
+            nel::assert(len() + n <= capacity(), "heaped::Node: no room");
+            elem::relocate(&values_[len_], s, n);
+    12b3:	|  |  |  |  |  |        |              |  |               48 8d 78 10          	lea    0x10(%rax),%rdi
+template<typename T>
+void relocate(T d[], T s[], Length const n)
+{
+    if (d == s) { return; }
+    if constexpr (is_trivially_relocatable<T>) {
+        relocate(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t *>(s), n * sizeof(T));
+    12b7:	|  |  |  |  |  |        |              |  |               48 8d 74 24 70       	lea    0x70(%rsp),%rsi
+    12bc:	|  |  |  |  |  |        |              |  |               48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    12c1:	|  |  |  |  |  |        |              |  |               48 8d 14 8d 00 00 00 	lea    0x0(,%rcx,4),%rdx
+    12c8:	|  |  |  |  |  |        |              |  |               00 
+    12c9:	|  |  |  |  |  |        |              |  |               48 89 4c 24 20       	mov    %rcx,0x20(%rsp)
+    12ce:	|  |  |  |  |  |        |              |  |               e8 ed 07 00 00       	call   1ac0 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>
+            len_ += n;
+    12d3:	|  |  |  |  |  |        |              |  |               4c 8b 44 24 08       	mov    0x8(%rsp),%r8
+    12d8:	|  |  |  |  |  |        |              |  |               48 8b 44 24 20       	mov    0x20(%rsp),%rax
+            len_ = 0;
+    12dd:	|  |  |  |  |  |        |              |  |               48 c7 44 24 68 00 00 	movq   $0x0,0x68(%rsp)
+    12e4:	|  |  |  |  |  |        |              |  |               00 00 
+    12e6:	|  |  |  |  |  |        |              |  |               49 03 40 08          	add    0x8(%r8),%rax
+            return alloc_;
+    12ea:	|  |  |  |  |  |        |              |  |               4d 8b 28             	mov    (%r8),%r13
+            item_ = n;
+    12ed:	|  |  |  |  |  |        |              |  |               4c 89 44 24 60       	mov    %r8,0x60(%rsp)
+                                    : std::realloc(p, new_size);
+    12f2:	|  |  |  |  |  |        |              |  |               4c 89 c3             	mov    %r8,%rbx
+            len_ += n;
+    12f5:	|  |  |  |  |  |        |              |  |               49 89 40 08          	mov    %rax,0x8(%r8)
+    12f9:	|  |  |  |  |  |        |              |  |               45 8d 47 06          	lea    0x6(%r15),%r8d
+    12fd:	|  |  |  |  |  |        |              |  |               0f 1f 00             	nopl   (%rax)
+            if (len() >= capacity()) {
+    1300:	|  |  |  |  |  |  /-----|--------------|--|-------------> 4c 39 e8             	cmp    %r13,%rax
+    1303:	|  |  |  |  |  |  |     |              |  |     /-------- 0f 82 8a 00 00 00    	jb     1393 <main+0x1f3>
+            for (nel::Index j = 0; j < n_values; ++j) {
+    1309:	|  |  |  |  |  |  |     |              |  |     |  /----> 83 c5 01             	add    $0x1,%ebp
+    130c:	|  |  |  |  |  |  |     |              |  |     |  |      41 39 e8             	cmp    %ebp,%r8d
+    130f:	|  |  |  |  |  |  |     |              |  |  /--|--|----- 0f 84 ac 00 00 00    	je     13c1 <main+0x221>
+    1315:	|  |  |  |  |  |  |     |              |  >--|--|--|----> 48 8b 7b 08          	mov    0x8(%rbx),%rdi
+    1319:	|  |  |  |  |  |  |     |              |  |  |  |  |      48 8b 0b             	mov    (%rbx),%rcx
+            return len_;
+    131c:	|  |  |  |  |  |  |     |              |  |  |  |  |      48 89 f8             	mov    %rdi,%rax
+            if (len() + n <= capacity()) { return true; }
+    131f:	|  |  |  |  |  |  |     |              |  |  |  |  |      48 8d 77 01          	lea    0x1(%rdi),%rsi
+            return alloc_;
+    1323:	|  |  |  |  |  |  |  /--|--------------|--|--|--|--|----> 49 89 cd             	mov    %rcx,%r13
+    1326:	|  |  |  |  |  |  |  |  |              |  |  |  |  |      48 39 f1             	cmp    %rsi,%rcx
+    1329:	|  |  |  |  |  |  +--|--|--------------|--|--|--|--|----- 73 d5                	jae    1300 <main+0x160>
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            if (cap <= cur) { return cap; }
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    132b:	|  |  |  |  |  |  |  |  |              |  |  |  |  |      48 83 f9 03          	cmp    $0x3,%rcx
+    132f:	|  |  |  |  |  |  |  |  |     /--------|--|--|--|--|----- 0f 87 53 02 00 00    	ja     1588 <main+0x3e8>
+            if (new_cap > max_capacity) { return nullptr; }
+    1335:	|  |  |  |  |  |  |  |  |     |        |  |  |  |  |      48 ba f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rdx
+    133c:	|  |  |  |  |  |  |  |  |     |        |  |  |  |  |      ff ff 1f 
+    133f:	|  |  |  |  |  |  |  |  |     |        |  |  |  |  |      41 bd 04 00 00 00    	mov    $0x4,%r13d
+    1345:	|  |  |  |  |  |  |  |  |     |        |  |  |  |  |      4c 39 ef             	cmp    %r13,%rdi
+    1348:	|  |  |  |  |  |  |  |  |     |        |  |  |  |  |      4c 0f 43 ef          	cmovae %rdi,%r13
+    134c:	|  |  |  |  |  |  |  |  |     |        |  |  |  |  |      49 39 f5             	cmp    %rsi,%r13
+    134f:	|  |  |  |  |  |  |  |  |     |        |  |  |  |  |      4c 0f 42 ee          	cmovb  %rsi,%r13
+    1353:	|  |  |  |  |  |  |  |  |     |        |  |  |  |  |      4c 39 ea             	cmp    %r13,%rdx
+    1356:	|  |  |  |  |  |  |  |  |  /--|--------|--|--|--|--|----- 0f 82 5d 02 00 00    	jb     15b9 <main+0x419>
+    135c:	|  |  |  |  |  |  |  |  |  |  |  /-----|--|--|--|--|----> 48 89 df             	mov    %rbx,%rdi
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    135f:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |      4a 8d 34 ad 14 00 00 	lea    0x14(,%r13,4),%rsi
+    1366:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |      00 
+    1367:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |      44 89 44 24 08       	mov    %r8d,0x8(%rsp)
+    136c:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |      e8 5f fd ff ff       	call   10d0 <realloc@plt>
+            if (new_p == nullptr) {
+    1371:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |      44 8b 44 24 08       	mov    0x8(%rsp),%r8d
+    1376:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |      48 85 c0             	test   %rax,%rax
+                                    : std::realloc(p, new_size);
+    1379:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |      48 89 c3             	mov    %rax,%rbx
+            if (new_p == nullptr) {
+    137c:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  /-- 74 32                	je     13b0 <main+0x210>
+            new_n->alloc_ = new_cap;
+    137e:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |   4c 89 28             	mov    %r13,(%rax)
+            if (new_cap < len()) { new_cap = len(); }
+            if (new_cap == item_->capacity()) { return true; }
+
+            VectorNode *p = VectorNode::realloc(item_, new_cap);
+            if (p == nullptr) { return false; }
+            item_ = p;
+    1381:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |   48 89 44 24 60       	mov    %rax,0x60(%rsp)
+            return len_;
+    1386:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |   48 8b 40 08          	mov    0x8(%rax),%rax
+            if (len() >= capacity()) {
+    138a:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |   4c 39 e8             	cmp    %r13,%rax
+    138d:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  \--|-- 0f 83 76 ff ff ff    	jae    1309 <main+0x169>
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    1393:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  \-----|-> 89 6c 83 10          	mov    %ebp,0x10(%rbx,%rax,4)
+            len_ += 1;
+    1397:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |   48 83 c0 01          	add    $0x1,%rax
+    139b:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |   83 c5 01             	add    $0x1,%ebp
+    139e:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |   48 89 43 08          	mov    %rax,0x8(%rbx)
+    13a2:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |        |   44 39 c5             	cmp    %r8d,%ebp
+    13a5:	|  |  |  |  |  |  |  |  |  |  |  |     |  \--|--------|-- 0f 85 6a ff ff ff    	jne    1315 <main+0x175>
+    13ab:	|  |  |  |  |  |  |  |  |  |  |  |  /--|-----|--------|-- eb 1d                	jmp    13ca <main+0x22a>
+    13ad:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |        |   0f 1f 00             	nopl   (%rax)
+            return (item_ == nullptr) ? Slice<Type>(inline_ptr(), len_) : item_->slice();
+    13b0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |        \-> 48 8b 5c 24 60       	mov    0x60(%rsp),%rbx
+    13b5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|----------> 83 c5 01             	add    $0x1,%ebp
+    13b8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |            41 39 e8             	cmp    %ebp,%r8d
+    13bb:	|  |  |  |  |  |  |  |  |  |  |  |  |  \--|--|----------- 0f 85 69 fe ff ff    	jne    122a <main+0x8a>
+    13c1:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  \----------> 48 85 db             	test   %rbx,%rbx
+    13c4:	|  |  |  |  |  |  |  |  |  |  |  |  |  /--|-------------- 0f 84 06 02 00 00    	je     15d0 <main+0x430>
+        }
+
+    public:
+        constexpr SliceIterator(T arr[], Count len)
+            : b_(arr)
+            , e_(arr + len)
+    13ca:	|  |  |  |  |  |  |  |  |  |  |  |  >--|--|-------------> 48 8b 53 08          	mov    0x8(%rbx),%rdx
+            return Slice(values_, len());
+    13ce:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 43 10          	lea    0x10(%rbx),%rax
+    13d2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |               4c 8d 04 90          	lea    (%rax,%rdx,4),%r8
+        template<typename F>
+        void for_each2(F &&fn)
+#        endif
+        {
+#        if 1
+            for (; !self().is_done(); self().inc()) {
+    13d6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |               4c 39 c0             	cmp    %r8,%rax
+    13d9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |     /-------- 0f 84 aa 00 00 00    	je     1489 <main+0x2e9>
+    13df:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|-------> 49 8d 70 fc          	lea    -0x4(%r8),%rsi
+    13e3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 c2             	mov    %rax,%rdx
+    13e6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 29 c6             	sub    %rax,%rsi
+    13e9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 f7             	mov    %rsi,%rdi
+    13ec:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 c1 ef 02          	shr    $0x2,%rdi
+    13f0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 83 c7 01          	add    $0x1,%rdi
+    13f4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 83 fe 08          	cmp    $0x8,%rsi
+    13f8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /----- 76 64                	jbe    145e <main+0x2be>
+    13fa:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 89 fe             	mov    %rdi,%rsi
+            : content_(p)
+    13fd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      66 0f ef c9          	pxor   %xmm1,%xmm1
+            v.iter().for_each([&sum](int const &e) { sum += (long unsigned int)e; });
+    1401:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      66 0f ef e4          	pxor   %xmm4,%xmm4
+    1405:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 c1 ee 02          	shr    $0x2,%rsi
+    1409:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 c1 e6 04          	shl    $0x4,%rsi
+    140d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 01 c6             	add    %rax,%rsi
+    1410:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-> f3 0f 6f 02          	movdqu (%rdx),%xmm0
+    1414:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   66 0f 6f d4          	movdqa %xmm4,%xmm2
+    1418:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 83 c2 10          	add    $0x10,%rdx
+    141c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   66 0f 66 d0          	pcmpgtd %xmm0,%xmm2
+    1420:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   66 0f 6f d8          	movdqa %xmm0,%xmm3
+    1424:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   66 0f 62 da          	punpckldq %xmm2,%xmm3
+    1428:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   66 0f 6a c2          	punpckhdq %xmm2,%xmm0
+    142c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   66 0f d4 c3          	paddq  %xmm3,%xmm0
+    1430:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   66 0f d4 c8          	paddq  %xmm0,%xmm1
+    1434:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 39 d6             	cmp    %rdx,%rsi
+    1437:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \-- 75 d7                	jne    1410 <main+0x270>
+    1439:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      66 0f 6f c1          	movdqa %xmm1,%xmm0
+    143d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      66 0f 73 d8 08       	psrldq $0x8,%xmm0
+    1442:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      66 0f d4 c8          	paddq  %xmm0,%xmm1
+    1446:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      66 48 0f 7e ca       	movq   %xmm1,%rdx
+    144b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      49 01 d4             	add    %rdx,%r12
+    144e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 89 fa             	mov    %rdi,%rdx
+    1451:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+    1455:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      83 e7 03             	and    $0x3,%edi
+    1458:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 04 90          	lea    (%rax,%rdx,4),%rax
+    145c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-- 74 26                	je     1484 <main+0x2e4>
+    145e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \--|-> 48 63 10             	movslq (%rax),%rdx
+    1461:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   49 01 d4             	add    %rdx,%r12
+            return (b_ == e_);
+        }
+
+        void inc(void)
+        {
+            ++b_;
+    1464:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 8d 50 04          	lea    0x4(%rax),%rdx
+    1468:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   49 39 d0             	cmp    %rdx,%r8
+    146b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     +-- 74 17                	je     1484 <main+0x2e4>
+    146d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 63 50 04          	movslq 0x4(%rax),%rdx
+    1471:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   49 01 d4             	add    %rdx,%r12
+    1474:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 8d 50 08          	lea    0x8(%rax),%rdx
+    1478:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   49 39 d0             	cmp    %rdx,%r8
+    147b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     +-- 74 07                	je     1484 <main+0x2e4>
+    147d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 63 40 08          	movslq 0x8(%rax),%rax
+    1481:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   49 01 c4             	add    %rax,%r12
+            if (item_ != nullptr) {
+    1484:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     \-> 48 85 db             	test   %rbx,%rbx
+    1487:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /----- 74 08                	je     1491 <main+0x2f1>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    1489:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \--|----> 48 89 df             	mov    %rbx,%rdi
+    148c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |      e8 9f fb ff ff       	call   1030 <free@plt>
+        for (nel::Index i = 0; i < n_lists; ++i) {
+    1491:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     >----> 49 83 c6 01          	add    $0x1,%r14
+    1495:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |      49 81 fe 40 42 0f 00 	cmp    $0xf4240,%r14
+    149c:	|  |  |  |  |  |  |  |  \--|--|--|--|--|--|--|-----|----- 0f 85 6e fd ff ff    	jne    1210 <main+0x70>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    14a2:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 8b 74 24 38       	mov    0x38(%rsp),%rsi
+    14a7:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      bf 01 00 00 00       	mov    $0x1,%edi
+    14ac:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      4c 8b 6c 24 30       	mov    0x30(%rsp),%r13
+
+// Log a result line: name, time and (if bytes given) bandwidth.
+inline void report(char const *const name, long unsigned int const ns,
+                   long unsigned int const bytes = 0)
+{
+    nel::log << name << ": " << ns / 1000UL << "us";
+    14b1:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 8d 2d d1 3b 00 00 	lea    0x3bd1(%rip),%rbp        # 5089 <nel::log>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    14b8:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      4c 8b 7c 24 28       	mov    0x28(%rsp),%r15
+    14bd:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      e8 8e fb ff ff       	call   1050 <clock_gettime@plt>
+    nel::log << name << ": " << ns / 1000UL << "us";
+    14c2:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 89 ef             	mov    %rbp,%rdi
+    14c5:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 8d 35 a4 1b 00 00 	lea    0x1ba4(%rip),%rsi        # 3070 <_IO_stdin_used+0x70>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    14cc:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 69 5c 24 60 00 ca 	imul   $0x3b9aca00,0x60(%rsp),%rbx
+    14d3:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      9a 3b 
+    14d5:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      4d 69 ff 00 ca 9a 3b 	imul   $0x3b9aca00,%r15,%r15
+    14dc:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      4c 29 eb             	sub    %r13,%rbx
+    return now_ns() - b;
+    14df:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 03 5c 24 68       	add    0x68(%rsp),%rbx
+    nel::log << name << ": " << ns / 1000UL << "us";
+    14e4:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      e8 47 0e 00 00       	call   2330 <nel::operator<<(nel::Log&, char const*)>
+    14e9:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 8d 35 1c 1b 00 00 	lea    0x1b1c(%rip),%rsi        # 300c <_IO_stdin_used+0xc>
+    return now_ns() - b;
+    14f0:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      4c 29 fb             	sub    %r15,%rbx
+    nel::log << name << ": " << ns / 1000UL << "us";
+    14f3:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 89 c7             	mov    %rax,%rdi
+    14f6:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      e8 35 0e 00 00       	call   2330 <nel::operator<<(nel::Log&, char const*)>
+    14fb:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      b9 e8 03 00 00       	mov    $0x3e8,%ecx
+    1500:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      31 d2                	xor    %edx,%edx
+    1502:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 89 c7             	mov    %rax,%rdi
+    1505:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 89 d8             	mov    %rbx,%rax
+    1508:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 f7 f1             	div    %rcx
+    150b:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 89 c6             	mov    %rax,%rsi
+    150e:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      e8 dd 0e 00 00       	call   23f0 <nel::operator<<(nel::Log&, unsigned long)>
+    1513:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 8d 35 ea 1a 00 00 	lea    0x1aea(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+    151a:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 89 c7             	mov    %rax,%rdi
+    151d:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      e8 0e 0e 00 00       	call   2330 <nel::operator<<(nel::Log&, char const*)>
+    if (bytes != 0 && ns != 0) {
+        // bytes/ns == GB/s, scaled to MB/s
+        nel::log << ", " << (bytes * 1000UL) / ns << "MB/s";
+    }
+    nel::log << '\n';
+    1522:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 89 ef             	mov    %rbp,%rdi
+    1525:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      be 0a 00 00 00       	mov    $0xa,%esi
+    152a:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      e8 e1 0d 00 00       	call   2310 <nel::operator<<(nel::Log&, char)>
+    nel::log << "  sum: " << sum << '\n';
+    152f:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 89 ef             	mov    %rbp,%rdi
+    1532:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 8d 35 ce 1a 00 00 	lea    0x1ace(%rip),%rsi        # 3007 <_IO_stdin_used+0x7>
+    1539:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      e8 f2 0d 00 00       	call   2330 <nel::operator<<(nel::Log&, char const*)>
+    153e:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      4c 89 e6             	mov    %r12,%rsi
+    1541:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 89 c7             	mov    %rax,%rdi
+    1544:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      e8 a7 0e 00 00       	call   23f0 <nel::operator<<(nel::Log&, unsigned long)>
+    1549:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      be 0a 00 00 00       	mov    $0xa,%esi
+    154e:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 89 c7             	mov    %rax,%rdi
+    1551:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      e8 ba 0d 00 00       	call   2310 <nel::operator<<(nel::Log&, char)>
+    bench_lists<nel::heaped::SmallVector<int, 8>>("1M lists of 6, heaped::SmallVector<8>");
+}
+    1556:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      48 81 c4 98 00 00 00 	add    $0x98,%rsp
+    155d:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      31 c0                	xor    %eax,%eax
+    155f:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      5b                   	pop    %rbx
+    1560:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      5d                   	pop    %rbp
+    1561:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      41 5c                	pop    %r12
+    1563:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      41 5d                	pop    %r13
+    1565:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      41 5e                	pop    %r14
+    1567:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      41 5f                	pop    %r15
+    1569:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      c3                   	ret
+    156a:	|  |  |  |  |  |  |  |     |  |  |  |  |  |  |     |      66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+         */
+        Result<void, Type> NEL_WARN_UNUSED_RESULT push(Type &&val)
+        {
+            if (!try_reserve_for(1)) { return Result<void, Type>::Err(move(val)); }
+            if (item_ != nullptr) { return item_->push_back(move(val)); }
+            new (&inline_ptr()[len_]) Type(move(val));
+    1570:	|  |  |  |  |  \--|--|-----|--|--|--|--|--|--|-----|----> 89 6c 8c 70          	mov    %ebp,0x70(%rsp,%rcx,4)
+    1574:	|  |  |  |  |     |  |     |  |  |  |  |  |  |     |      45 8d 47 06          	lea    0x6(%r15),%r8d
+            len_ += 1;
+    1578:	|  |  |  |  |     |  |     |  |  |  |  |  |  |     |      48 89 54 24 68       	mov    %rdx,0x68(%rsp)
+        union {
+                Element<E> err_;
+        };
+
+    public:
+        constexpr ~Result(void)
+    157d:	|  |  |  |  |     |  |     |  |  |  |  |  \--|-----|----- e9 33 fe ff ff       	jmp    13b5 <main+0x215>
+    1582:	|  |  |  |  |     |  |     |  |  |  |  |     |     |      66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1588:	|  |  |  |  |     |  |     |  \--|--|--|-----|-----|----> 48 8d 14 09          	lea    (%rcx,%rcx,1),%rdx
+    158c:	|  |  |  |  |     |  |     |     |  |  |     |     |      48 39 f2             	cmp    %rsi,%rdx
+    158f:	|  |  |  |  |     |  |     |     |  |  |     |     |      48 0f 42 d6          	cmovb  %rsi,%rdx
+    1593:	|  |  |  |  |     |  |     |     |  |  |     |     |      48 39 fa             	cmp    %rdi,%rdx
+    1596:	|  |  |  |  |     |  |     |     |  |  |     |     |      48 0f 42 d7          	cmovb  %rdi,%rdx
+            if (new_cap == item_->capacity()) { return true; }
+    159a:	|  |  |  |  |     |  |     |     |  |  |     |     |      48 39 d1             	cmp    %rdx,%rcx
+    159d:	|  |  |  |  |     \--|-----|-----|--|--|-----|-----|----- 0f 84 5d fd ff ff    	je     1300 <main+0x160>
+    15a3:	|  |  |  |  |        |     |     |  |  |     |     |      49 89 d5             	mov    %rdx,%r13
+            if (new_cap > max_capacity) { return nullptr; }
+    15a6:	|  |  |  |  |        |     |     |  |  |     |     |      48 ba f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rdx
+    15ad:	|  |  |  |  |        |     |     |  |  |     |     |      ff ff 1f 
+    15b0:	|  |  |  |  |        |     |     |  |  |     |     |      4c 39 ea             	cmp    %r13,%rdx
+    15b3:	|  |  |  |  |        |     |     \--|--|-----|-----|----- 0f 83 a3 fd ff ff    	jae    135c <main+0x1bc>
+            for (nel::Index j = 0; j < n_values; ++j) {
+    15b9:	|  |  |  |  |        |     \--------|--|-----|-----|----> 83 c5 01             	add    $0x1,%ebp
+    15bc:	|  |  |  |  |        |              |  |     |     |      41 39 e8             	cmp    %ebp,%r8d
+    15bf:	|  |  |  |  |        \--------------|--|-----|-----|----- 0f 85 5e fd ff ff    	jne    1323 <main+0x183>
+            return (item_ == nullptr) ? Slice<Type>(inline_ptr(), len_) : item_->slice();
+    15c5:	|  |  |  |  |                       |  |     |     |      48 85 db             	test   %rbx,%rbx
+    15c8:	|  |  |  |  |                       \--|-----|-----|----- 0f 85 fc fd ff ff    	jne    13ca <main+0x22a>
+    15ce:	|  |  |  |  |                          |     |     |      66 90                	xchg   %ax,%ax
+    15d0:	|  |  |  |  |                          >-----|-----|----> 4c 8b 6c 24 68       	mov    0x68(%rsp),%r13
+            , e_(arr + len)
+    15d5:	|  |  |  |  |                          |     |     |  /-> 48 8d 44 24 70       	lea    0x70(%rsp),%rax
+    15da:	|  |  |  |  |                          |     |     |  |   4e 8d 04 a8          	lea    (%rax,%r13,4),%r8
+    15de:	|  |  |  |  |                          |     |     |  |   49 39 c0             	cmp    %rax,%r8
+    15e1:	|  |  |  |  |                          |     \-----|--|-- 0f 85 f8 fd ff ff    	jne    13df <main+0x23f>
+    15e7:	|  |  |  |  |                          |           \--|-- e9 a5 fe ff ff       	jmp    1491 <main+0x2f1>
+    15ec:	|  |  |  \--|--------------------------|--------------|-> 83 c5 01             	add    $0x1,%ebp
+    15ef:	|  |  |     |                          |              |   41 8d 47 06          	lea    0x6(%r15),%eax
+    15f3:	|  |  |     |                          |              |   39 e8                	cmp    %ebp,%eax
+    15f5:	|  \--|-----|--------------------------|--------------|-- 0f 85 3c fc ff ff    	jne    1237 <main+0x97>
+    15fb:	|     |     |                          \--------------|-- eb d3                	jmp    15d0 <main+0x430>
+    15fd:	|     |     \-----------------------------------------|-> 48 8d 74 24 40       	lea    0x40(%rsp),%rsi
+    1602:	|     |                                               |   48 8d 3d 4f 1a 00 00 	lea    0x1a4f(%rip),%rdi        # 3058 <_IO_stdin_used+0x58>
+    1609:	|     |                                               |   e8 54 fb ff ff       	call   1162 <nel::assert_fail(char const*, nel::Context const&)>
+    160e:	|     \-----------------------------------------------|-> 83 c5 01             	add    $0x1,%ebp
+    1611:	|                                                     |   41 8d 47 06          	lea    0x6(%r15),%eax
+    1615:	|                                                     |   39 e8                	cmp    %ebp,%eax
+    1617:	\-----------------------------------------------------|-- 0f 85 1f fc ff ff    	jne    123c <main+0x9c>
+    161d:	                                                      |   49 89 cd             	mov    %rcx,%r13
+    1620:	                                                      \-- eb b3                	jmp    15d5 <main+0x435>
+    1622:	                                                          66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1629:	                                                          00 00 00 
+    162c:	                                                          0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001630 <_start>:
+    1630:	31 ed                	xor    %ebp,%ebp
+    1632:	49 89 d1             	mov    %rdx,%r9
+    1635:	5e                   	pop    %rsi
+    1636:	48 89 e2             	mov    %rsp,%rdx
+    1639:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    163d:	50                   	push   %rax
+    163e:	54                   	push   %rsp
+    163f:	45 31 c0             	xor    %r8d,%r8d
+    1642:	31 c9                	xor    %ecx,%ecx
+    1644:	48 8d 3d 55 fb ff ff 	lea    -0x4ab(%rip),%rdi        # 11a0 <main>
+    164b:	ff 15 6f 39 00 00    	call   *0x396f(%rip)        # 4fc0 <__libc_start_main@GLIBC_2.34>
+    1651:	f4                   	hlt
+    1652:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1659:	00 00 00 
+    165c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001660 <deregister_tm_clones>:
+    1660:	    48 8d 3d 09 3a 00 00 	lea    0x3a09(%rip),%rdi        # 5070 <__TMC_END__>
+    1667:	    48 8d 05 02 3a 00 00 	lea    0x3a02(%rip),%rax        # 5070 <__TMC_END__>
+    166e:	    48 39 f8             	cmp    %rdi,%rax
+    1671:	/-- 74 15                	je     1688 <deregister_tm_clones+0x28>
+    1673:	|   48 8b 05 4e 39 00 00 	mov    0x394e(%rip),%rax        # 4fc8 <_ITM_deregisterTMCloneTable@Base>
+    167a:	|   48 85 c0             	test   %rax,%rax
+    167d:	+-- 74 09                	je     1688 <deregister_tm_clones+0x28>
+    167f:	|   ff e0                	jmp    *%rax
+    1681:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1688:	\-> c3                   	ret
+    1689:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001690 <register_tm_clones>:
+    1690:	    48 8d 3d d9 39 00 00 	lea    0x39d9(%rip),%rdi        # 5070 <__TMC_END__>
+    1697:	    48 8d 35 d2 39 00 00 	lea    0x39d2(%rip),%rsi        # 5070 <__TMC_END__>
+    169e:	    48 29 fe             	sub    %rdi,%rsi
+    16a1:	    48 89 f0             	mov    %rsi,%rax
+    16a4:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    16a8:	    48 c1 f8 03          	sar    $0x3,%rax
+    16ac:	    48 01 c6             	add    %rax,%rsi
+    16af:	    48 d1 fe             	sar    %rsi
+    16b2:	/-- 74 14                	je     16c8 <register_tm_clones+0x38>
+    16b4:	|   48 8b 05 1d 39 00 00 	mov    0x391d(%rip),%rax        # 4fd8 <_ITM_registerTMCloneTable@Base>
+    16bb:	|   48 85 c0             	test   %rax,%rax
+    16be:	+-- 74 08                	je     16c8 <register_tm_clones+0x38>
+    16c0:	|   ff e0                	jmp    *%rax
+    16c2:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    16c8:	\-> c3                   	ret
+    16c9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000016d0 <__do_global_dtors_aux>:
+    16d0:	       f3 0f 1e fa          	endbr64
+    16d4:	       80 3d ad 39 00 00 00 	cmpb   $0x0,0x39ad(%rip)        # 5088 <completed.0>
+    16db:	/----- 75 2b                	jne    1708 <__do_global_dtors_aux+0x38>
+    16dd:	|      55                   	push   %rbp
+    16de:	|      48 83 3d fa 38 00 00 	cmpq   $0x0,0x38fa(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    16e5:	|      00 
+    16e6:	|      48 89 e5             	mov    %rsp,%rbp
+    16e9:	|  /-- 74 0c                	je     16f7 <__do_global_dtors_aux+0x27>
+    16eb:	|  |   48 8b 3d 76 39 00 00 	mov    0x3976(%rip),%rdi        # 5068 <__dso_handle>
+    16f2:	|  |   e8 f9 f9 ff ff       	call   10f0 <__cxa_finalize@plt>
+    16f7:	|  \-> e8 64 ff ff ff       	call   1660 <deregister_tm_clones>
+    16fc:	|      c6 05 85 39 00 00 01 	movb   $0x1,0x3985(%rip)        # 5088 <completed.0>
+    1703:	|      5d                   	pop    %rbp
+    1704:	|      c3                   	ret
+    1705:	|      0f 1f 00             	nopl   (%rax)
+    1708:	\----> c3                   	ret
+    1709:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001710 <frame_dummy>:
+    1710:	f3 0f 1e fa          	endbr64
+    1714:	e9 77 ff ff ff       	jmp    1690 <register_tm_clones>
+    1719:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001720 <_close_r>:
+#include <nel/heaped/small_vector.hh>
+    1720:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1725:	c3                   	ret
+    1726:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    172d:	00 00 00 
+
+0000000000001730 <_fstat_r>:
+#include <nel/defs.hh>
+    1730:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1735:	c3                   	ret
+    1736:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    173d:	00 00 00 
+
+0000000000001740 <_kill_r>:
+static constexpr nel::Count n_lists = 1000 * 1000;
+    1740:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1745:	c3                   	ret
+    1746:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    174d:	00 00 00 
+
+0000000000001750 <_lseek_r>:
+template<typename Vec>
+    1750:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1755:	c3                   	ret
+    1756:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    175d:	00 00 00 
+
+0000000000001760 <_read_r>:
+void bench_lists(char const *const name)
+    1760:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1765:	c3                   	ret
+    1766:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    176d:	00 00 00 
+
+0000000000001770 <_write_r>:
+            auto v = Vec::empty();
+    1770:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1775:	c3                   	ret
+    1776:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    177d:	00 00 00 
+
+0000000000001780 <_getpid_r>:
+            }
+    1780:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1785:	c3                   	ret
+    1786:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    178d:	00 00 00 
+
+0000000000001790 <_isatty_r>:
+            v.iter().for_each([&sum](int const &e) { sum += (long unsigned int)e; });
+    1790:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1795:	c3                   	ret
+    1796:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    179d:	00 00 00 
+
+00000000000017a0 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)>:
+void bench_lists(char const *const name)
+    17a0:	                                  41 57                	push   %r15
+    17a2:	                                  41 56                	push   %r14
+    17a4:	                                  41 55                	push   %r13
+    17a6:	                                  41 54                	push   %r12
+    17a8:	                                  55                   	push   %rbp
+    long unsigned int sum = 0;
+    17a9:	                                  31 ed                	xor    %ebp,%ebp
+void bench_lists(char const *const name)
+    17ab:	                                  53                   	push   %rbx
+        for (nel::Index i = 0; i < n_lists; ++i) {
+    17ac:	                                  31 db                	xor    %ebx,%ebx
+void bench_lists(char const *const name)
+    17ae:	                                  48 83 ec 38          	sub    $0x38,%rsp
+    17b2:	                                  48 89 7c 24 10       	mov    %rdi,0x10(%rsp)
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    17b7:	                                  48 8d 74 24 20       	lea    0x20(%rsp),%rsi
+    17bc:	                                  bf 01 00 00 00       	mov    $0x1,%edi
+    17c1:	                                  48 89 74 24 18       	mov    %rsi,0x18(%rsp)
+    17c6:	                                  e8 85 f8 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    17cb:	                                  48 8b 44 24 20       	mov    0x20(%rsp),%rax
+    17d0:	                                  48 89 04 24          	mov    %rax,(%rsp)
+    17d4:	                                  48 8b 44 24 28       	mov    0x28(%rsp),%rax
+    17d9:	                                  48 89 44 24 08       	mov    %rax,0x8(%rsp)
+        for (nel::Index i = 0; i < n_lists; ++i) {
+    17de:	                                  66 90                	xchg   %ax,%ax
+        /**
+         * Returns the number of items currently in use.
+         *
+         * @returns the current in use count.
+         */
+        constexpr Length len(void) const
+    17e0:	                     /----------> 41 89 dd             	mov    %ebx,%r13d
+    17e3:	                     |            44 8d 73 06          	lea    0x6(%rbx),%r14d
+                                    : std::realloc(p, new_size);
+    17e7:	/--------------------|----------> bf 24 00 00 00       	mov    $0x24,%edi
+    17ec:	|                    |            e8 cf f8 ff ff       	call   10c0 <malloc@plt>
+    17f1:	|                    |            49 89 c7             	mov    %rax,%r15
+            if (new_p == nullptr) {
+    17f4:	|                    |            48 85 c0             	test   %rax,%rax
+    17f7:	|  /-----------------|----------- 0f 84 73 02 00 00    	je     1a70 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0x2d0>
+            new_n->alloc_ = new_cap;
+    17fd:	|  |                 |            66 0f 6f 2d 9b 18 00 	movdqa 0x189b(%rip),%xmm5        # 30a0 <_IO_stdin_used+0xa0>
+    1804:	|  |                 |            00 
+            return len_;
+    1805:	|  |                 |            31 f6                	xor    %esi,%esi
+            new_n->alloc_ = new_cap;
+    1807:	|  |                 |            0f 11 28             	movups %xmm5,(%rax)
+    180a:	|  |                 |            b8 01 00 00 00       	mov    $0x1,%eax
+            new (&values_[len()]) Type(forward<Args>(args)...);
+    180f:	|  |  /--------------|----------> 45 89 6c b7 10       	mov    %r13d,0x10(%r15,%rsi,4)
+            for (nel::Index j = 0; j < n_values; ++j) {
+    1814:	|  |  |              |            41 83 c5 01          	add    $0x1,%r13d
+            len_ += 1;
+    1818:	|  |  |              |            49 89 47 08          	mov    %rax,0x8(%r15)
+    181c:	|  |  |              |            45 39 ee             	cmp    %r13d,%r14d
+    181f:	|  |  |              |     /----- 74 28                	je     1849 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0xa9>
+            return len_;
+    1821:	|  |  |              |     |  /-> 49 8b 77 08          	mov    0x8(%r15),%rsi
+            return alloc_;
+    1825:	|  |  |              |     |  |   49 8b 0f             	mov    (%r15),%rcx
+
+    private:
+        // Make room for n more values, only ever grows.
+        bool try_reserve_for(Count const n)
+        {
+            if (len() + n <= capacity()) { return true; }
+    1828:	|  |  |              |     |  |   48 8d 46 01          	lea    0x1(%rsi),%rax
+    182c:	|  |  |              |     |  |   48 39 c1             	cmp    %rax,%rcx
+    182f:	|  |  |           /--|-----|--|-- 0f 82 b3 01 00 00    	jb     19e8 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0x248>
+            if (len() >= capacity()) {
+    1835:	|  |  |  /--------|--|-----|--|-> 48 39 ce             	cmp    %rcx,%rsi
+    1838:	|  |  |  |  /-----|--|-----|--|-- 0f 82 08 02 00 00    	jb     1a46 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0x2a6>
+    183e:	|  |  |  |  |     |  |     |  |   66 90                	xchg   %ax,%ax
+    1840:	|  |  |  |  |  /--|--|-----|--|-> 41 83 c5 01          	add    $0x1,%r13d
+    1844:	|  |  |  |  |  |  |  |     |  |   45 39 f5             	cmp    %r14d,%r13d
+    1847:	|  |  |  |  |  |  |  |     |  \-- 75 d8                	jne    1821 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0x81>
+    1849:	|  |  |  |  |  |  |  |     \----> 49 8b 47 08          	mov    0x8(%r15),%rax
+            return Slice(values_, len());
+    184d:	|  |  |  |  |  |  |  |            49 8d 57 10          	lea    0x10(%r15),%rdx
+    1851:	|  |  |  |  |  |  |  |            48 8d 34 82          	lea    (%rdx,%rax,4),%rsi
+    1855:	|  |  |  |  |  |  |  |            48 39 f2             	cmp    %rsi,%rdx
+    1858:	|  |  |  |  |  |  |  |  /-------- 0f 84 a7 00 00 00    	je     1905 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0x165>
+    185e:	|  |  |  |  |  |  |  |  |         48 89 f0             	mov    %rsi,%rax
+    1861:	|  |  |  |  |  |  |  |  |         4d 89 f8             	mov    %r15,%r8
+    1864:	|  |  |  |  |  |  |  |  |         4c 29 f8             	sub    %r15,%rax
+    1867:	|  |  |  |  |  |  |  |  |         48 83 e8 14          	sub    $0x14,%rax
+    186b:	|  |  |  |  |  |  |  |  |         48 89 c1             	mov    %rax,%rcx
+    186e:	|  |  |  |  |  |  |  |  |         48 c1 e9 02          	shr    $0x2,%rcx
+    1872:	|  |  |  |  |  |  |  |  |         48 83 c1 01          	add    $0x1,%rcx
+    1876:	|  |  |  |  |  |  |  |  |         48 83 f8 08          	cmp    $0x8,%rax
+    187a:	|  |  |  |  |  |  |  |  |  /----- 76 63                	jbe    18df <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0x13f>
+    187c:	|  |  |  |  |  |  |  |  |  |      48 89 c8             	mov    %rcx,%rax
+    187f:	|  |  |  |  |  |  |  |  |  |      66 0f ef c0          	pxor   %xmm0,%xmm0
+            v.iter().for_each([&sum](int const &e) { sum += (long unsigned int)e; });
+    1883:	|  |  |  |  |  |  |  |  |  |      66 0f ef db          	pxor   %xmm3,%xmm3
+    1887:	|  |  |  |  |  |  |  |  |  |      48 c1 e8 02          	shr    $0x2,%rax
+    188b:	|  |  |  |  |  |  |  |  |  |      48 c1 e0 04          	shl    $0x4,%rax
+    188f:	|  |  |  |  |  |  |  |  |  |      4c 01 f8             	add    %r15,%rax
+    1892:	|  |  |  |  |  |  |  |  |  |  /-> f3 41 0f 6f 48 10    	movdqu 0x10(%r8),%xmm1
+    1898:	|  |  |  |  |  |  |  |  |  |  |   66 0f 6f d3          	movdqa %xmm3,%xmm2
+    189c:	|  |  |  |  |  |  |  |  |  |  |   49 83 c0 10          	add    $0x10,%r8
+    18a0:	|  |  |  |  |  |  |  |  |  |  |   66 0f 66 d1          	pcmpgtd %xmm1,%xmm2
+    18a4:	|  |  |  |  |  |  |  |  |  |  |   66 0f 6f e1          	movdqa %xmm1,%xmm4
+    18a8:	|  |  |  |  |  |  |  |  |  |  |   66 0f 62 e2          	punpckldq %xmm2,%xmm4
+    18ac:	|  |  |  |  |  |  |  |  |  |  |   66 0f 6a ca          	punpckhdq %xmm2,%xmm1
+    18b0:	|  |  |  |  |  |  |  |  |  |  |   66 0f d4 cc          	paddq  %xmm4,%xmm1
+    18b4:	|  |  |  |  |  |  |  |  |  |  |   66 0f d4 c1          	paddq  %xmm1,%xmm0
+    18b8:	|  |  |  |  |  |  |  |  |  |  |   49 39 c0             	cmp    %rax,%r8
+    18bb:	|  |  |  |  |  |  |  |  |  |  \-- 75 d5                	jne    1892 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0xf2>
+    18bd:	|  |  |  |  |  |  |  |  |  |      66 0f 6f c8          	movdqa %xmm0,%xmm1
+    18c1:	|  |  |  |  |  |  |  |  |  |      66 0f 73 d9 08       	psrldq $0x8,%xmm1
+    18c6:	|  |  |  |  |  |  |  |  |  |      66 0f d4 c1          	paddq  %xmm1,%xmm0
+    18ca:	|  |  |  |  |  |  |  |  |  |      66 48 0f 7e c0       	movq   %xmm0,%rax
+    18cf:	|  |  |  |  |  |  |  |  |  |      48 01 c5             	add    %rax,%rbp
+    18d2:	|  |  |  |  |  |  |  |  |  |      f6 c1 03             	test   $0x3,%cl
+    18d5:	|  |  |  |  |  |  |  |  +--|----- 74 2e                	je     1905 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0x165>
+    18d7:	|  |  |  |  |  |  |  |  |  |      48 83 e1 fc          	and    $0xfffffffffffffffc,%rcx
+    18db:	|  |  |  |  |  |  |  |  |  |      48 8d 14 8a          	lea    (%rdx,%rcx,4),%rdx
+    18df:	|  |  |  |  |  |  |  |  |  \----> 48 63 02             	movslq (%rdx),%rax
+    18e2:	|  |  |  |  |  |  |  |  |         48 01 c5             	add    %rax,%rbp
+            ++b_;
+    18e5:	|  |  |  |  |  |  |  |  |         48 8d 42 04          	lea    0x4(%rdx),%rax
+    18e9:	|  |  |  |  |  |  |  |  |         48 39 c6             	cmp    %rax,%rsi
+    18ec:	|  |  |  |  |  |  |  |  +-------- 74 17                	je     1905 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0x165>
+    18ee:	|  |  |  |  |  |  |  |  |         48 63 42 04          	movslq 0x4(%rdx),%rax
+    18f2:	|  |  |  |  |  |  |  |  |         48 01 c5             	add    %rax,%rbp
+    18f5:	|  |  |  |  |  |  |  |  |         48 8d 42 08          	lea    0x8(%rdx),%rax
+    18f9:	|  |  |  |  |  |  |  |  |         48 39 c6             	cmp    %rax,%rsi
+    18fc:	|  |  |  |  |  |  |  |  +-------- 74 07                	je     1905 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0x165>
+    18fe:	|  |  |  |  |  |  |  |  |         48 63 42 08          	movslq 0x8(%rdx),%rax
+    1902:	|  |  |  |  |  |  |  |  |         48 01 c5             	add    %rax,%rbp
+                std::free(p);
+    1905:	|  |  |  |  |  |  |  |  \-------> 4c 89 ff             	mov    %r15,%rdi
+    1908:	|  |  |  |  |  |  |  |            e8 23 f7 ff ff       	call   1030 <free@plt>
+        for (nel::Index i = 0; i < n_lists; ++i) {
+    190d:	|  |  |  |  |  |  |  |  /-------> 48 83 c3 01          	add    $0x1,%rbx
+    1911:	|  |  |  |  |  |  |  |  |         48 81 fb 40 42 0f 00 	cmp    $0xf4240,%rbx
+    1918:	|  |  |  |  |  |  |  \--|-------- 0f 85 c2 fe ff ff    	jne    17e0 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0x40>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    191e:	|  |  |  |  |  |  |     |         48 8b 74 24 18       	mov    0x18(%rsp),%rsi
+    1923:	|  |  |  |  |  |  |     |         bf 01 00 00 00       	mov    $0x1,%edi
+    nel::log << name << ": " << ns / 1000UL << "us";
+    1928:	|  |  |  |  |  |  |     |         4c 8d 25 5a 37 00 00 	lea    0x375a(%rip),%r12        # 5089 <nel::log>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    192f:	|  |  |  |  |  |  |     |         e8 1c f7 ff ff       	call   1050 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1934:	|  |  |  |  |  |  |     |         48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    nel::log << name << ": " << ns / 1000UL << "us";
+    1939:	|  |  |  |  |  |  |     |         48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    193e:	|  |  |  |  |  |  |     |         4c 89 e7             	mov    %r12,%rdi
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1941:	|  |  |  |  |  |  |     |         48 69 5c 24 20 00 ca 	imul   $0x3b9aca00,0x20(%rsp),%rbx
+    1948:	|  |  |  |  |  |  |     |         9a 3b 
+    194a:	|  |  |  |  |  |  |     |         4c 69 2c 24 00 ca 9a 	imul   $0x3b9aca00,(%rsp),%r13
+    1951:	|  |  |  |  |  |  |     |         3b 
+    1952:	|  |  |  |  |  |  |     |         48 29 c3             	sub    %rax,%rbx
+    return now_ns() - b;
+    1955:	|  |  |  |  |  |  |     |         48 03 5c 24 28       	add    0x28(%rsp),%rbx
+    nel::log << name << ": " << ns / 1000UL << "us";
+    195a:	|  |  |  |  |  |  |     |         e8 d1 09 00 00       	call   2330 <nel::operator<<(nel::Log&, char const*)>
+    195f:	|  |  |  |  |  |  |     |         48 8d 35 a6 16 00 00 	lea    0x16a6(%rip),%rsi        # 300c <_IO_stdin_used+0xc>
+    return now_ns() - b;
+    1966:	|  |  |  |  |  |  |     |         4c 29 eb             	sub    %r13,%rbx
+    nel::log << name << ": " << ns / 1000UL << "us";
+    1969:	|  |  |  |  |  |  |     |         48 89 c7             	mov    %rax,%rdi
+    196c:	|  |  |  |  |  |  |     |         48 c1 eb 03          	shr    $0x3,%rbx
+    1970:	|  |  |  |  |  |  |     |         e8 bb 09 00 00       	call   2330 <nel::operator<<(nel::Log&, char const*)>
+    1975:	|  |  |  |  |  |  |     |         48 89 c7             	mov    %rax,%rdi
+    1978:	|  |  |  |  |  |  |     |         48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    197f:	|  |  |  |  |  |  |     |         9b c4 20 
+    1982:	|  |  |  |  |  |  |     |         48 f7 e3             	mul    %rbx
+    1985:	|  |  |  |  |  |  |     |         48 89 d6             	mov    %rdx,%rsi
+    1988:	|  |  |  |  |  |  |     |         48 c1 ee 04          	shr    $0x4,%rsi
+    198c:	|  |  |  |  |  |  |     |         e8 5f 0a 00 00       	call   23f0 <nel::operator<<(nel::Log&, unsigned long)>
+    1991:	|  |  |  |  |  |  |     |         48 8d 35 6c 16 00 00 	lea    0x166c(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+    1998:	|  |  |  |  |  |  |     |         48 89 c7             	mov    %rax,%rdi
+    199b:	|  |  |  |  |  |  |     |         e8 90 09 00 00       	call   2330 <nel::operator<<(nel::Log&, char const*)>
+    nel::log << '\n';
+    19a0:	|  |  |  |  |  |  |     |         4c 89 e7             	mov    %r12,%rdi
+    19a3:	|  |  |  |  |  |  |     |         be 0a 00 00 00       	mov    $0xa,%esi
+    19a8:	|  |  |  |  |  |  |     |         e8 63 09 00 00       	call   2310 <nel::operator<<(nel::Log&, char)>
+    nel::log << "  sum: " << sum << '\n';
+    19ad:	|  |  |  |  |  |  |     |         4c 89 e7             	mov    %r12,%rdi
+    19b0:	|  |  |  |  |  |  |     |         48 8d 35 50 16 00 00 	lea    0x1650(%rip),%rsi        # 3007 <_IO_stdin_used+0x7>
+    19b7:	|  |  |  |  |  |  |     |         e8 74 09 00 00       	call   2330 <nel::operator<<(nel::Log&, char const*)>
+    19bc:	|  |  |  |  |  |  |     |         48 89 ee             	mov    %rbp,%rsi
+    19bf:	|  |  |  |  |  |  |     |         48 89 c7             	mov    %rax,%rdi
+    19c2:	|  |  |  |  |  |  |     |         e8 29 0a 00 00       	call   23f0 <nel::operator<<(nel::Log&, unsigned long)>
+}
+    19c7:	|  |  |  |  |  |  |     |         48 83 c4 38          	add    $0x38,%rsp
+    nel::log << "  sum: " << sum << '\n';
+    19cb:	|  |  |  |  |  |  |     |         be 0a 00 00 00       	mov    $0xa,%esi
+}
+    19d0:	|  |  |  |  |  |  |     |         5b                   	pop    %rbx
+    nel::log << "  sum: " << sum << '\n';
+    19d1:	|  |  |  |  |  |  |     |         48 89 c7             	mov    %rax,%rdi
+}
+    19d4:	|  |  |  |  |  |  |     |         5d                   	pop    %rbp
+    19d5:	|  |  |  |  |  |  |     |         41 5c                	pop    %r12
+    19d7:	|  |  |  |  |  |  |     |         41 5d                	pop    %r13
+    19d9:	|  |  |  |  |  |  |     |         41 5e                	pop    %r14
+    19db:	|  |  |  |  |  |  |     |         41 5f                	pop    %r15
+    nel::log << "  sum: " << sum << '\n';
+    19dd:	|  |  |  |  |  |  |     |         e9 2e 09 00 00       	jmp    2310 <nel::operator<<(nel::Log&, char)>
+    19e2:	|  |  |  |  |  |  |     |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    19e8:	|  |  |  |  |  |  \-----|-------> 48 83 f9 03          	cmp    $0x3,%rcx
+    19ec:	|  |  |  |  |  |        |     /-- 77 62                	ja     1a50 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0x2b0>
+    19ee:	|  |  |  |  |  |        |     |   ba 04 00 00 00       	mov    $0x4,%edx
+    19f3:	|  |  |  |  |  |        |     |   48 39 d0             	cmp    %rdx,%rax
+    19f6:	|  |  |  |  |  |        |     |   48 0f 42 c2          	cmovb  %rdx,%rax
+    19fa:	|  |  |  |  |  |        |     |   48 39 f0             	cmp    %rsi,%rax
+    19fd:	|  |  |  |  |  |        |     |   48 0f 43 f0          	cmovae %rax,%rsi
+    1a01:	|  |  |  |  |  |        |     |   49 89 f4             	mov    %rsi,%r12
+            if (new_cap > max_capacity) { return nullptr; }
+    1a04:	|  |  |  |  |  |        |  /--|-> 48 b8 f9 ff ff ff ff 	movabs $0x1ffffffffffffff9,%rax
+    1a0b:	|  |  |  |  |  |        |  |  |   ff ff 1f 
+    1a0e:	|  |  |  |  |  |        |  |  |   4c 39 e0             	cmp    %r12,%rax
+    1a11:	|  |  |  |  |  +--------|--|--|-- 0f 82 29 fe ff ff    	jb     1840 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0xa0>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1a17:	|  |  |  |  |  |        |  |  |   4a 8d 34 a5 14 00 00 	lea    0x14(,%r12,4),%rsi
+    1a1e:	|  |  |  |  |  |        |  |  |   00 
+                                    : std::realloc(p, new_size);
+    1a1f:	|  |  |  |  |  |        |  |  |   4c 89 ff             	mov    %r15,%rdi
+    1a22:	|  |  |  |  |  |        |  |  |   e8 a9 f6 ff ff       	call   10d0 <realloc@plt>
+            if (new_p == nullptr) {
+    1a27:	|  |  |  |  |  |        |  |  |   48 85 c0             	test   %rax,%rax
+    1a2a:	|  |  |  |  |  +--------|--|--|-- 0f 84 10 fe ff ff    	je     1840 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0xa0>
+            return len_;
+    1a30:	|  |  |  |  |  |        |  |  |   48 8b 70 08          	mov    0x8(%rax),%rsi
+    1a34:	|  |  |  |  |  |        |  |  |   4c 89 e1             	mov    %r12,%rcx
+            new_n->alloc_ = new_cap;
+    1a37:	|  |  |  |  |  |        |  |  |   4c 89 20             	mov    %r12,(%rax)
+                item_ = p;
+    1a3a:	|  |  |  |  |  |        |  |  |   49 89 c7             	mov    %rax,%r15
+            if (len() >= capacity()) {
+    1a3d:	|  |  |  |  |  |        |  |  |   48 39 ce             	cmp    %rcx,%rsi
+    1a40:	|  |  |  |  |  \--------|--|--|-- 0f 83 fa fd ff ff    	jae    1840 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0xa0>
+            len_ += 1;
+    1a46:	|  |  |  |  \-----------|--|--|-> 48 8d 46 01          	lea    0x1(%rsi),%rax
+    1a4a:	|  |  \--|--------------|--|--|-- e9 c0 fd ff ff       	jmp    180f <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0x6f>
+    1a4f:	|  |     |              |  |  |   90                   	nop
+    1a50:	|  |     |              |  |  \-> 48 8d 14 09          	lea    (%rcx,%rcx,1),%rdx
+    1a54:	|  |     |              |  |      48 39 c2             	cmp    %rax,%rdx
+    1a57:	|  |     |              |  |      48 0f 42 d0          	cmovb  %rax,%rdx
+    1a5b:	|  |     |              |  |      48 39 f2             	cmp    %rsi,%rdx
+    1a5e:	|  |     |              |  |      48 0f 42 d6          	cmovb  %rsi,%rdx
+    1a62:	|  |     |              |  |      49 89 d4             	mov    %rdx,%r12
+            } else if (new_cap == item_->capacity()) {
+    1a65:	|  |     |              |  |      48 39 ca             	cmp    %rcx,%rdx
+    1a68:	|  |     |              |  \----- 75 9a                	jne    1a04 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0x264>
+    1a6a:	|  |     \--------------|-------- e9 c6 fd ff ff       	jmp    1835 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0x95>
+    1a6f:	|  |                    |         90                   	nop
+            for (nel::Index j = 0; j < n_values; ++j) {
+    1a70:	|  \--------------------|-------> 41 83 c5 01          	add    $0x1,%r13d
+    1a74:	|                       |         45 39 f5             	cmp    %r14d,%r13d
+    1a77:	\-----------------------|-------- 0f 85 6a fd ff ff    	jne    17e7 <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0x47>
+    1a7d:	                        \-------- e9 8b fe ff ff       	jmp    190d <void bench_lists<nel::heaped::Vector<int, nel::heaped::Malloc, nel::heaped::GeometricGrowth<2ul, 1ul> > >(char const*)+0x16d>
+    1a82:	                                  66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1a89:	                                  00 00 00 
+    1a8c:	                                  0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001a90 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    1a90:	e9 1b f6 ff ff       	jmp    10b0 <memcpy@plt>
+    1a95:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1a9c:	00 00 00 00 
+
+0000000000001aa0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    1aa0:	40 0f b6 f6          	movzbl %sil,%esi
+    1aa4:	e9 c7 f5 ff ff       	jmp    1070 <memset@plt>
+    1aa9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001ab0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+}
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    1ab0:	e9 fb f5 ff ff       	jmp    10b0 <memcpy@plt>
+    1ab5:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1abc:	00 00 00 00 
+
+0000000000001ac0 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    1ac0:	e9 1b f6 ff ff       	jmp    10e0 <memmove@plt>
+    1ac5:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1acc:	00 00 00 00 
+
+0000000000001ad0 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    1ad0:	48 89 f2             	mov    %rsi,%rdx
+    std::memset(d, s, n);
+    1ad3:	be a5 00 00 00       	mov    $0xa5,%esi
+    1ad8:	e9 93 f5 ff ff       	jmp    1070 <memset@plt>
+    1add:	0f 1f 00             	nopl   (%rax)
+
+0000000000001ae0 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+    set(d, 0xa5, n);
+}
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1ae0:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    1ae4:	e8 a7 f5 ff ff       	call   1090 <memcmp@plt>
+    1ae9:	85 c0                	test   %eax,%eax
+    1aeb:	0f 94 c0             	sete   %al
+}
+    1aee:	48 83 c4 08          	add    $0x8,%rsp
+    1af2:	c3                   	ret
+    1af3:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1afa:	00 00 00 00 
+    1afe:	66 90                	xchg   %ax,%ax
+
+0000000000001b00 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1b00:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    1b04:	e8 87 f5 ff ff       	call   1090 <memcmp@plt>
+    1b09:	85 c0                	test   %eax,%eax
+    1b0b:	0f 95 c0             	setne  %al
+}
+    1b0e:	48 83 c4 08          	add    $0x8,%rsp
+    1b12:	c3                   	ret
+    1b13:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1b1a:	00 00 00 00 
+    1b1e:	66 90                	xchg   %ax,%ax
+
+0000000000001b20 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    if (n < streaming_min) {
+    1b20:	                48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1b27:	/-------------- 0f 86 d7 00 00 00    	jbe    1c04 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xe4>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1b2d:	|               48 89 f9             	mov    %rdi,%rcx
+{
+    1b30:	|               53                   	push   %rbx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1b31:	|               48 f7 d9             	neg    %rcx
+    1b34:	|               83 e1 0f             	and    $0xf,%ecx
+    std::memcpy(d, s, n);
+    1b37:	|               83 f9 08             	cmp    $0x8,%ecx
+    1b3a:	|     /-------- 0f 82 d0 00 00 00    	jb     1c10 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xf0>
+    1b40:	|     |         48 8b 06             	mov    (%rsi),%rax
+    1b43:	|     |         4c 8d 57 08          	lea    0x8(%rdi),%r10
+    1b47:	|     |         48 89 f3             	mov    %rsi,%rbx
+    1b4a:	|     |         49 83 e2 f8          	and    $0xfffffffffffffff8,%r10
+    1b4e:	|     |         48 89 07             	mov    %rax,(%rdi)
+    1b51:	|     |         48 8b 44 0e f8       	mov    -0x8(%rsi,%rcx,1),%rax
+    1b56:	|     |         48 89 44 0f f8       	mov    %rax,-0x8(%rdi,%rcx,1)
+    1b5b:	|     |         48 89 f8             	mov    %rdi,%rax
+    1b5e:	|     |         4c 29 d0             	sub    %r10,%rax
+    1b61:	|     |         48 29 c3             	sub    %rax,%rbx
+    1b64:	|     |         01 c8                	add    %ecx,%eax
+    1b66:	|     |         83 e0 f8             	and    $0xfffffff8,%eax
+    1b69:	|     |         83 f8 08             	cmp    $0x8,%eax
+    1b6c:	|  /--|-------- 72 1a                	jb     1b88 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    1b6e:	|  |  |         83 e0 f8             	and    $0xfffffff8,%eax
+    1b71:	|  |  |         45 31 c0             	xor    %r8d,%r8d
+    1b74:	|  |  |     /-> 45 89 c1             	mov    %r8d,%r9d
+    1b77:	|  |  |     |   41 83 c0 08          	add    $0x8,%r8d
+    1b7b:	|  |  |     |   4e 8b 1c 0b          	mov    (%rbx,%r9,1),%r11
+    1b7f:	|  |  |     |   4f 89 1c 0a          	mov    %r11,(%r10,%r9,1)
+    1b83:	|  |  |     |   41 39 c0             	cmp    %eax,%r8d
+    1b86:	|  |  |     \-- 72 ec                	jb     1b74 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x54>
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1b88:	|  >--|-------> 48 8d 41 40          	lea    0x40(%rcx),%rax
+    1b8c:	|  |  |         48 01 f9             	add    %rdi,%rcx
+    1b8f:	|  |  |         90                   	nop
+    std::memcpy(&v, s, sizeof(v));
+    1b90:	|  |  |     /-> f3 0f 6f 54 06 d0    	movdqu -0x30(%rsi,%rax,1),%xmm2
+    1b96:	|  |  |     |   f3 0f 6f 4c 06 e0    	movdqu -0x20(%rsi,%rax,1),%xmm1
+    1b9c:	|  |  |     |   49 89 c0             	mov    %rax,%r8
+    for (; i + 64 <= n; i += 64) {
+    1b9f:	|  |  |     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1ba3:	|  |  |     |   f3 0f 6f 44 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1ba9:	|  |  |     |   f3 0f 6f 5c 06 c0    	movdqu -0x40(%rsi,%rax,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    1baf:	|  |  |     |   48 83 c0 40          	add    $0x40,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1bb3:	|  |  |     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    1bb8:	|  |  |     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    1bbd:	|  |  |     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    1bc2:	|  |  |     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    1bc7:	|  |  |     |   48 39 c2             	cmp    %rax,%rdx
+    1bca:	|  |  |     \-- 73 c4                	jae    1b90 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x70>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    1bcc:	|  |  |         49 8d 40 10          	lea    0x10(%r8),%rax
+    1bd0:	|  |  |         48 39 c2             	cmp    %rax,%rdx
+    1bd3:	|  |  |  /----- 72 22                	jb     1bf7 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd7>
+    1bd5:	|  |  |  |      48 8d 4f f0          	lea    -0x10(%rdi),%rcx
+    1bd9:	|  |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1be0:	|  |  |  |  /-> f3 0f 6f 64 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm4
+    1be6:	|  |  |  |  |   49 89 c0             	mov    %rax,%r8
+    1be9:	|  |  |  |  |   66 0f e7 24 01       	movntdq %xmm4,(%rcx,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    1bee:	|  |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    1bf2:	|  |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    1bf5:	|  |  |  |  \-- 73 e9                	jae    1be0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc0>
+        stream16(d + i, load16(s + i));
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    1bf7:	|  |  |  \----> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    1bfa:	|  |  |         4c 01 c7             	add    %r8,%rdi
+    1bfd:	|  |  |         4c 29 c2             	sub    %r8,%rdx
+    1c00:	|  |  |         4c 01 c6             	add    %r8,%rsi
+}
+    1c03:	|  |  |         5b                   	pop    %rbx
+    std::memcpy(d, s, n);
+    1c04:	\--|--|-------> e9 a7 f4 ff ff       	jmp    10b0 <memcpy@plt>
+    1c09:	   |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1c10:	   |  \-------> f6 c1 04             	test   $0x4,%cl
+    1c13:	   |        /-- 75 25                	jne    1c3a <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x11a>
+    1c15:	   |        |   85 c9                	test   %ecx,%ecx
+    1c17:	   +--------|-- 0f 84 6b ff ff ff    	je     1b88 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    1c1d:	   |        |   0f b6 06             	movzbl (%rsi),%eax
+    1c20:	   |        |   88 07                	mov    %al,(%rdi)
+    1c22:	   |        |   f6 c1 02             	test   $0x2,%cl
+    1c25:	   +--------|-- 0f 84 5d ff ff ff    	je     1b88 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    1c2b:	   |        |   0f b7 44 0e fe       	movzwl -0x2(%rsi,%rcx,1),%eax
+    1c30:	   |        |   66 89 44 0f fe       	mov    %ax,-0x2(%rdi,%rcx,1)
+    1c35:	   +--------|-- e9 4e ff ff ff       	jmp    1b88 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    1c3a:	   |        \-> 8b 06                	mov    (%rsi),%eax
+    1c3c:	   |            89 07                	mov    %eax,(%rdi)
+    1c3e:	   |            8b 44 0e fc          	mov    -0x4(%rsi,%rcx,1),%eax
+    1c42:	   |            89 44 0f fc          	mov    %eax,-0x4(%rdi,%rcx,1)
+    1c46:	   \----------- e9 3d ff ff ff       	jmp    1b88 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    1c4b:	                0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000001c50 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    1c50:	                                           49 89 f8             	mov    %rdi,%r8
+    1c53:	                                           48 89 f1             	mov    %rsi,%rcx
+    if (n < streaming_min) {
+    1c56:	                                           48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1c5d:	                              /----------- 0f 86 85 03 00 00    	jbe    1fe8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x398>
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1c63:	                              |            48 89 fe             	mov    %rdi,%rsi
+{
+    1c66:	                              |            41 57                	push   %r15
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1c68:	                              |            48 f7 de             	neg    %rsi
+{
+    1c6b:	                              |            41 56                	push   %r14
+    for (Index i = 0; i < head; ++i) {
+    1c6d:	                              |            48 89 f0             	mov    %rsi,%rax
+{
+    1c70:	                              |            41 55                	push   %r13
+    1c72:	                              |            41 54                	push   %r12
+    1c74:	                              |            55                   	push   %rbp
+    1c75:	                              |            53                   	push   %rbx
+    for (Index i = 0; i < head; ++i) {
+    1c76:	                              |            83 e0 0f             	and    $0xf,%eax
+    1c79:	/-----------------------------|----------- 0f 84 01 01 00 00    	je     1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    1c7f:	|                             |            48 8d 78 ff          	lea    -0x1(%rax),%rdi
+    1c83:	|                             |            48 83 ff 02          	cmp    $0x2,%rdi
+    1c87:	|  /--------------------------|----------- 0f 86 8a 04 00 00    	jbe    2117 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4c7>
+    1c8d:	|  |                          |            4c 8d 51 01          	lea    0x1(%rcx),%r10
+    1c91:	|  |                          |            4d 89 c1             	mov    %r8,%r9
+    1c94:	|  |                          |            4d 29 d1             	sub    %r10,%r9
+    1c97:	|  |                          |            49 83 f9 06          	cmp    $0x6,%r9
+    1c9b:	|  |                          |  /-------- 0f 87 c7 02 00 00    	ja     1f68 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x318>
+        d[i] = p[i];
+    1ca1:	|  |                          |  |         0f b6 39             	movzbl (%rcx),%edi
+    1ca4:	|  |                          |  |         41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1ca7:	|  |                          |  |         40 f6 c6 0e          	test   $0xe,%sil
+    1cab:	+--|--------------------------|--|-------- 0f 84 cf 00 00 00    	je     1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1cb1:	|  |                          |  |         0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    1cb5:	|  |                          |  |         41 88 78 01          	mov    %dil,0x1(%r8)
+    1cb9:	|  |  /-----------------------|--|-------> 0f b6 79 02          	movzbl 0x2(%rcx),%edi
+    1cbd:	|  |  |                       |  |         41 88 78 02          	mov    %dil,0x2(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1cc1:	|  |  |                       |  |         40 f6 c6 0c          	test   $0xc,%sil
+    1cc5:	+--|--|-----------------------|--|-------- 0f 84 b5 00 00 00    	je     1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1ccb:	|  |  |                       |  |         0f b6 79 03          	movzbl 0x3(%rcx),%edi
+    1ccf:	|  |  |                       |  |         41 88 78 03          	mov    %dil,0x3(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1cd3:	|  |  |                       |  |         48 83 f8 04          	cmp    $0x4,%rax
+    1cd7:	+--|--|-----------------------|--|-------- 0f 86 a3 00 00 00    	jbe    1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1cdd:	|  |  |                       |  |         0f b6 79 04          	movzbl 0x4(%rcx),%edi
+    1ce1:	|  |  |                       |  |         41 88 78 04          	mov    %dil,0x4(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1ce5:	|  |  |                       |  |         48 83 f8 05          	cmp    $0x5,%rax
+    1ce9:	+--|--|-----------------------|--|-------- 0f 84 91 00 00 00    	je     1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1cef:	|  |  |                       |  |         0f b6 79 05          	movzbl 0x5(%rcx),%edi
+    1cf3:	|  |  |                       |  |         41 88 78 05          	mov    %dil,0x5(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1cf7:	|  |  |                       |  |         48 83 f8 06          	cmp    $0x6,%rax
+    1cfb:	+--|--|-----------------------|--|-------- 0f 84 7f 00 00 00    	je     1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1d01:	|  |  |                       |  |         0f b6 79 06          	movzbl 0x6(%rcx),%edi
+    for (Index i = 0; i < head; ++i) {
+    1d05:	|  |  |                       |  |         83 e6 08             	and    $0x8,%esi
+        d[i] = p[i];
+    1d08:	|  |  |                       |  |         41 88 78 06          	mov    %dil,0x6(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1d0c:	+--|--|-----------------------|--|-------- 74 72                	je     1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1d0e:	|  |  |                       |  |         0f b6 71 07          	movzbl 0x7(%rcx),%esi
+    1d12:	|  |  |                       |  |         41 88 70 07          	mov    %sil,0x7(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1d16:	|  |  |                       |  |         48 83 f8 08          	cmp    $0x8,%rax
+    1d1a:	+--|--|-----------------------|--|-------- 76 64                	jbe    1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1d1c:	|  |  |                       |  |         0f b6 71 08          	movzbl 0x8(%rcx),%esi
+    1d20:	|  |  |                       |  |         41 88 70 08          	mov    %sil,0x8(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1d24:	|  |  |                       |  |         48 83 f8 09          	cmp    $0x9,%rax
+    1d28:	+--|--|-----------------------|--|-------- 74 56                	je     1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1d2a:	|  |  |                       |  |         0f b6 71 09          	movzbl 0x9(%rcx),%esi
+    1d2e:	|  |  |                       |  |         41 88 70 09          	mov    %sil,0x9(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1d32:	|  |  |                       |  |         48 83 f8 0a          	cmp    $0xa,%rax
+    1d36:	+--|--|-----------------------|--|-------- 74 48                	je     1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1d38:	|  |  |                       |  |         0f b6 71 0a          	movzbl 0xa(%rcx),%esi
+    1d3c:	|  |  |                       |  |         41 88 70 0a          	mov    %sil,0xa(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1d40:	|  |  |                       |  |         48 83 f8 0b          	cmp    $0xb,%rax
+    1d44:	+--|--|-----------------------|--|-------- 74 3a                	je     1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1d46:	|  |  |                       |  |         0f b6 71 0b          	movzbl 0xb(%rcx),%esi
+    1d4a:	|  |  |                       |  |         41 88 70 0b          	mov    %sil,0xb(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1d4e:	|  |  |                       |  |         48 83 f8 0c          	cmp    $0xc,%rax
+    1d52:	+--|--|-----------------------|--|-------- 74 2c                	je     1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1d54:	|  |  |                       |  |         0f b6 71 0c          	movzbl 0xc(%rcx),%esi
+    1d58:	|  |  |                       |  |         41 88 70 0c          	mov    %sil,0xc(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1d5c:	|  |  |                       |  |         48 83 f8 0d          	cmp    $0xd,%rax
+    1d60:	+--|--|-----------------------|--|-------- 74 1e                	je     1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1d62:	|  |  |                       |  |         0f b6 71 0d          	movzbl 0xd(%rcx),%esi
+    1d66:	|  |  |                       |  |         41 88 70 0d          	mov    %sil,0xd(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1d6a:	|  |  |                       |  |         49 8d 70 ff          	lea    -0x1(%r8),%rsi
+    1d6e:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    1d71:	+--|--|-----------------------|--|-------- 75 0d                	jne    1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1d73:	|  |  |                       |  |         0f b6 71 0e          	movzbl 0xe(%rcx),%esi
+    1d77:	|  |  |                       |  |         41 88 70 0e          	mov    %sil,0xe(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1d7b:	|  |  |                       |  |         0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+        rotated[i] = p[(head + i) % 16];
+    1d80:	>--|--|-----------------------|--|-------> 48 8d 70 07          	lea    0x7(%rax),%rsi
+    1d84:	|  |  |                       |  |         4c 8d 78 06          	lea    0x6(%rax),%r15
+    1d88:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    1d8b:	|  |  |                       |  |         4c 8d 70 05          	lea    0x5(%rax),%r14
+    1d8f:	|  |  |                       |  |         4c 8d 68 04          	lea    0x4(%rax),%r13
+    1d93:	|  |  |                       |  |         41 83 e7 0f          	and    $0xf,%r15d
+    std::memcpy(&v, s, sizeof(v));
+    1d97:	|  |  |                       |  |         0f b6 34 31          	movzbl (%rcx,%rsi,1),%esi
+        rotated[i] = p[(head + i) % 16];
+    1d9b:	|  |  |                       |  |         41 83 e6 0f          	and    $0xf,%r14d
+    1d9f:	|  |  |                       |  |         41 83 e5 0f          	and    $0xf,%r13d
+    1da3:	|  |  |                       |  |         4c 8d 60 03          	lea    0x3(%rax),%r12
+    std::memcpy(&v, s, sizeof(v));
+    1da7:	|  |  |                       |  |         46 0f b6 3c 39       	movzbl (%rcx,%r15,1),%r15d
+    1dac:	|  |  |                       |  |         46 0f b6 34 31       	movzbl (%rcx,%r14,1),%r14d
+        rotated[i] = p[(head + i) % 16];
+    1db1:	|  |  |                       |  |         48 8d 78 08          	lea    0x8(%rax),%rdi
+    1db5:	|  |  |                       |  |         41 83 e4 0f          	and    $0xf,%r12d
+    std::memcpy(&v, s, sizeof(v));
+    1db9:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1dbd:	|  |  |                       |  |         46 0f b6 2c 29       	movzbl (%rcx,%r13,1),%r13d
+        rotated[i] = p[(head + i) % 16];
+    1dc2:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    1dc5:	|  |  |                       |  |         48 8d 68 02          	lea    0x2(%rax),%rbp
+    std::memcpy(&v, s, sizeof(v));
+    1dc9:	|  |  |                       |  |         4c 09 fe             	or     %r15,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1dcc:	|  |  |                       |  |         48 89 7c 24 c8       	mov    %rdi,-0x38(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    1dd1:	|  |  |                       |  |         46 0f b6 24 21       	movzbl (%rcx,%r12,1),%r12d
+        rotated[i] = p[(head + i) % 16];
+    1dd6:	|  |  |                       |  |         83 e5 0f             	and    $0xf,%ebp
+    std::memcpy(&v, s, sizeof(v));
+    1dd9:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1ddd:	|  |  |                       |  |         48 8d 78 09          	lea    0x9(%rax),%rdi
+    std::memcpy(&v, s, sizeof(v));
+    1de1:	|  |  |                       |  |         0f b6 2c 29          	movzbl (%rcx,%rbp,1),%ebp
+        rotated[i] = p[(head + i) % 16];
+    1de5:	|  |  |                       |  |         48 8d 58 01          	lea    0x1(%rax),%rbx
+    std::memcpy(&v, s, sizeof(v));
+    1de9:	|  |  |                       |  |         4c 09 f6             	or     %r14,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1dec:	|  |  |                       |  |         49 89 fb             	mov    %rdi,%r11
+    1def:	|  |  |                       |  |         48 8d 78 0a          	lea    0xa(%rax),%rdi
+    1df3:	|  |  |                       |  |         83 e3 0f             	and    $0xf,%ebx
+    std::memcpy(&v, s, sizeof(v));
+    1df6:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1dfa:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    1dfe:	|  |  |                       |  |         49 89 fa             	mov    %rdi,%r10
+    std::memcpy(&v, s, sizeof(v));
+    1e01:	|  |  |                       |  |         4c 09 ee             	or     %r13,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1e04:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    1e08:	|  |  |                       |  |         48 8d 78 0b          	lea    0xb(%rax),%rdi
+    1e0c:	|  |  |                       |  |         4c 89 5c 24 e0       	mov    %r11,-0x20(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    1e11:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1e15:	|  |  |                       |  |         4c 8d 58 0f          	lea    0xf(%rax),%r11
+    1e19:	|  |  |                       |  |         4c 89 54 24 e8       	mov    %r10,-0x18(%rsp)
+    1e1e:	|  |  |                       |  |         49 89 f9             	mov    %rdi,%r9
+    std::memcpy(&v, s, sizeof(v));
+    1e21:	|  |  |                       |  |         4c 09 e6             	or     %r12,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1e24:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    1e28:	|  |  |                       |  |         4c 8d 50 0e          	lea    0xe(%rax),%r10
+    1e2c:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    1e30:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1e34:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    1e38:	|  |  |                       |  |         4c 89 4c 24 f0       	mov    %r9,-0x10(%rsp)
+    1e3d:	|  |  |                       |  |         4c 8d 48 0d          	lea    0xd(%rax),%r9
+    std::memcpy(&v, s, sizeof(v));
+    1e41:	|  |  |                       |  |         48 09 ee             	or     %rbp,%rsi
+    1e44:	|  |  |                       |  |         0f b6 2c 19          	movzbl (%rcx,%rbx,1),%ebp
+    1e48:	|  |  |                       |  |         46 0f b6 14 11       	movzbl (%rcx,%r10,1),%r10d
+        rotated[i] = p[(head + i) % 16];
+    1e4d:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    1e51:	|  |  |                       |  |         48 89 f3             	mov    %rsi,%rbx
+    1e54:	|  |  |                       |  |         42 0f b6 34 19       	movzbl (%rcx,%r11,1),%esi
+    1e59:	|  |  |                       |  |         46 0f b6 0c 09       	movzbl (%rcx,%r9,1),%r9d
+        rotated[i] = p[(head + i) % 16];
+    1e5e:	|  |  |                       |  |         48 8d 78 0c          	lea    0xc(%rax),%rdi
+    1e62:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    std::memcpy(&v, s, sizeof(v));
+    1e65:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    1e69:	|  |  |                       |  |         4c 8b 5c 24 e0       	mov    -0x20(%rsp),%r11
+    1e6e:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1e72:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    1e75:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    1e79:	|  |  |                       |  |         0f b6 2c 01          	movzbl (%rcx,%rax,1),%ebp
+    1e7d:	|  |  |                       |  |         4c 09 d6             	or     %r10,%rsi
+    1e80:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    1e84:	|  |  |                       |  |         4c 8b 54 24 e8       	mov    -0x18(%rsp),%r10
+    1e89:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1e8d:	|  |  |                       |  |         4c 09 ce             	or     %r9,%rsi
+    1e90:	|  |  |                       |  |         4c 8b 4c 24 f0       	mov    -0x10(%rsp),%r9
+    1e95:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1e99:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    1e9c:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    1e9f:	|  |  |                       |  |         42 0f b6 3c 09       	movzbl (%rcx,%r9,1),%edi
+    1ea4:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1ea8:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    1eab:	|  |  |                       |  |         42 0f b6 3c 11       	movzbl (%rcx,%r10,1),%edi
+    1eb0:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1eb4:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    1eb7:	|  |  |                       |  |         42 0f b6 3c 19       	movzbl (%rcx,%r11,1),%edi
+    1ebc:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1ec0:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    1ec3:	|  |  |                       |  |         48 8b 7c 24 c8       	mov    -0x38(%rsp),%rdi
+    1ec8:	|  |  |                       |  |         48 89 5c 24 c8       	mov    %rbx,-0x38(%rsp)
+    1ecd:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1ed1:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    1ed5:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1ed8:	|  |  |                       |  |         48 8d 78 40          	lea    0x40(%rax),%rdi
+    1edc:	|  |  |                       |  |         4c 01 c0             	add    %r8,%rax
+    std::memcpy(&v, s, sizeof(v));
+    1edf:	|  |  |                       |  |         48 89 74 24 d0       	mov    %rsi,-0x30(%rsp)
+    1ee4:	|  |  |                       |  |         66 0f 6f 44 24 c8    	movdqa -0x38(%rsp),%xmm0
+    for (; i + 64 <= n; i += 64) {
+    1eea:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1ef0:	|  |  |                       |  |     /-> 48 89 fe             	mov    %rdi,%rsi
+    for (; i + 64 <= n; i += 64) {
+    1ef3:	|  |  |                       |  |     |   48 83 c7 40          	add    $0x40,%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1ef7:	|  |  |                       |  |     |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    1efb:	|  |  |                       |  |     |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    1f00:	|  |  |                       |  |     |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    1f05:	|  |  |                       |  |     |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    1f0a:	|  |  |                       |  |     |   48 83 c0 40          	add    $0x40,%rax
+    1f0e:	|  |  |                       |  |     |   48 39 fa             	cmp    %rdi,%rdx
+    1f11:	|  |  |                       |  |     \-- 73 dd                	jae    1ef0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2a0>
+        stream16(d + i, v);
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+    1f13:	|  |  |                       |  |         48 8d 46 10          	lea    0x10(%rsi),%rax
+    1f17:	|  |  |                       |  |         48 39 c2             	cmp    %rax,%rdx
+    1f1a:	|  |  |                       |  |  /----- 72 15                	jb     1f31 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2e1>
+    1f1c:	|  |  |                       |  |  |      49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1f20:	|  |  |                       |  |  |  /-> 48 89 c6             	mov    %rax,%rsi
+    1f23:	|  |  |                       |  |  |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    1f28:	|  |  |                       |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    1f2c:	|  |  |                       |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    1f2f:	|  |  |                       |  |  |  \-- 73 ef                	jae    1f20 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2d0>
+        stream16(d + i, v);
+    }
+    __builtin_ia32_sfence();
+    1f31:	|  |  |                       |  |  \----> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    1f34:	|  |  |                       |  |         48 39 d6             	cmp    %rdx,%rsi
+    1f37:	|  |  |                       |  |  /----- 73 1e                	jae    1f57 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x307>
+    1f39:	|  |  |                       |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        d[i] = p[i % 16];
+    1f40:	|  |  |                       |  |  |  /-> 48 89 f0             	mov    %rsi,%rax
+    1f43:	|  |  |                       |  |  |  |   83 e0 0f             	and    $0xf,%eax
+    1f46:	|  |  |                       |  |  |  |   0f b6 04 01          	movzbl (%rcx,%rax,1),%eax
+    1f4a:	|  |  |                       |  |  |  |   41 88 04 30          	mov    %al,(%r8,%rsi,1)
+    for (; i < n; ++i) {
+    1f4e:	|  |  |                       |  |  |  |   48 83 c6 01          	add    $0x1,%rsi
+    1f52:	|  |  |                       |  |  |  |   48 39 f2             	cmp    %rsi,%rdx
+    1f55:	|  |  |                       |  |  |  \-- 75 e9                	jne    1f40 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2f0>
+    }
+}
+    1f57:	|  |  |                       |  |  \----> 5b                   	pop    %rbx
+    1f58:	|  |  |                       |  |         5d                   	pop    %rbp
+    1f59:	|  |  |                       |  |         41 5c                	pop    %r12
+    1f5b:	|  |  |                       |  |         41 5d                	pop    %r13
+    1f5d:	|  |  |                       |  |         41 5e                	pop    %r14
+    1f5f:	|  |  |                       |  |         41 5f                	pop    %r15
+    1f61:	|  |  |                       |  |         c3                   	ret
+    1f62:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1f68:	|  |  |                       |  \-------> 48 83 ff 06          	cmp    $0x6,%rdi
+    1f6c:	|  |  |  /--------------------|----------- 0f 86 e1 01 00 00    	jbe    2153 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x503>
+        d[i] = p[i];
+    1f72:	|  |  |  |                    |            48 8b 31             	mov    (%rcx),%rsi
+    1f75:	|  |  |  |                    |            49 89 30             	mov    %rsi,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1f78:	|  |  |  |                    |            48 83 f8 08          	cmp    $0x8,%rax
+    1f7c:	+--|--|--|--------------------|----------- 0f 84 fe fd ff ff    	je     1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    1f82:	|  |  |  |                    |            48 8d 70 f7          	lea    -0x9(%rax),%rsi
+    1f86:	|  |  |  |                    |            4c 8d 48 f8          	lea    -0x8(%rax),%r9
+    1f8a:	|  |  |  |                    |            48 83 fe 02          	cmp    $0x2,%rsi
+    1f8e:	|  |  |  |                    |            be 08 00 00 00       	mov    $0x8,%esi
+    1f93:	|  |  |  |                    |        /-- 76 15                	jbe    1faa <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x35a>
+        d[i] = p[i];
+    1f95:	|  |  |  |  /-----------------|--------|-> 8b 3c 31             	mov    (%rcx,%rsi,1),%edi
+    1f98:	|  |  |  |  |                 |        |   41 89 3c 30          	mov    %edi,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    1f9c:	|  |  |  |  |                 |        |   48 83 c6 04          	add    $0x4,%rsi
+    1fa0:	|  |  |  |  |                 |        |   49 83 f9 04          	cmp    $0x4,%r9
+    1fa4:	+--|--|--|--|-----------------|--------|-- 0f 84 d6 fd ff ff    	je     1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1faa:	|  |  |  |  |                 |        \-> 0f b6 3c 31          	movzbl (%rcx,%rsi,1),%edi
+    1fae:	|  |  |  |  |                 |            41 88 3c 30          	mov    %dil,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    1fb2:	|  |  |  |  |                 |            48 8d 7e 01          	lea    0x1(%rsi),%rdi
+    1fb6:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    1fb9:	+--|--|--|--|-----------------|----------- 0f 83 c1 fd ff ff    	jae    1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1fbf:	|  |  |  |  |                 |            0f b6 7c 31 01       	movzbl 0x1(%rcx,%rsi,1),%edi
+    1fc4:	|  |  |  |  |                 |            41 88 7c 30 01       	mov    %dil,0x1(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    1fc9:	|  |  |  |  |                 |            48 8d 7e 02          	lea    0x2(%rsi),%rdi
+    1fcd:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    1fd0:	+--|--|--|--|-----------------|----------- 0f 83 aa fd ff ff    	jae    1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1fd6:	|  |  |  |  |                 |            0f b6 7c 31 02       	movzbl 0x2(%rcx,%rsi,1),%edi
+    1fdb:	|  |  |  |  |                 |            41 88 7c 30 02       	mov    %dil,0x2(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    1fe0:	+--|--|--|--|-----------------|----------- e9 9b fd ff ff       	jmp    1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    1fe5:	|  |  |  |  |                 |            0f 1f 00             	nopl   (%rax)
+    Length done = (n < 16) ? n : 16;
+    1fe8:	|  |  |  |  |                 \----------> 41 ba 10 00 00 00    	mov    $0x10,%r10d
+    1fee:	|  |  |  |  |                              4c 39 d2             	cmp    %r10,%rdx
+    1ff1:	|  |  |  |  |                              4c 0f 46 d2          	cmovbe %rdx,%r10
+    std::memcpy(d, s, n);
+    1ff5:	|  |  |  |  |                              44 89 d0             	mov    %r10d,%eax
+    1ff8:	|  |  |  |  |                              41 83 fa 08          	cmp    $0x8,%r10d
+    1ffc:	|  |  |  |  |        /-------------------- 0f 82 cc 00 00 00    	jb     20ce <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47e>
+    2002:	|  |  |  |  |        |                     48 8b 06             	mov    (%rsi),%rax
+    2005:	|  |  |  |  |        |                     4c 8d 4f 08          	lea    0x8(%rdi),%r9
+    2009:	|  |  |  |  |        |                     49 83 e1 f8          	and    $0xfffffffffffffff8,%r9
+    200d:	|  |  |  |  |        |                     48 89 07             	mov    %rax,(%rdi)
+    2010:	|  |  |  |  |        |                     44 89 d0             	mov    %r10d,%eax
+    2013:	|  |  |  |  |        |                     48 8b 74 06 f8       	mov    -0x8(%rsi,%rax,1),%rsi
+    2018:	|  |  |  |  |        |                     48 89 74 07 f8       	mov    %rsi,-0x8(%rdi,%rax,1)
+    201d:	|  |  |  |  |        |                     48 89 f8             	mov    %rdi,%rax
+    2020:	|  |  |  |  |        |                     4c 29 c8             	sub    %r9,%rax
+    2023:	|  |  |  |  |        |                     48 29 c1             	sub    %rax,%rcx
+    2026:	|  |  |  |  |        |                     44 01 d0             	add    %r10d,%eax
+    2029:	|  |  |  |  |        |                     83 e0 f8             	and    $0xfffffff8,%eax
+    202c:	|  |  |  |  |        |                     83 f8 08             	cmp    $0x8,%eax
+    202f:	|  |  |  |  |  /-----|-------------------- 72 16                	jb     2047 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    2031:	|  |  |  |  |  |     |                     83 e0 f8             	and    $0xfffffff8,%eax
+    2034:	|  |  |  |  |  |     |                     31 f6                	xor    %esi,%esi
+    2036:	|  |  |  |  |  |     |                 /-> 89 f7                	mov    %esi,%edi
+    2038:	|  |  |  |  |  |     |                 |   83 c6 08             	add    $0x8,%esi
+    203b:	|  |  |  |  |  |     |                 |   4c 8b 1c 39          	mov    (%rcx,%rdi,1),%r11
+    203f:	|  |  |  |  |  |     |                 |   4d 89 1c 39          	mov    %r11,(%r9,%rdi,1)
+    2043:	|  |  |  |  |  |     |                 |   39 c6                	cmp    %eax,%esi
+    2045:	|  |  |  |  |  |     |                 \-- 72 ef                	jb     2036 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3e6>
+    while (done < n) {
+    2047:	|  |  |  |  |  >-----|-------------------> 49 39 d2             	cmp    %rdx,%r10
+    204a:	|  |  |  |  |  |     |           /-------- 72 33                	jb     207f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    204c:	|  |  |  |  |  |     |     /-----|-------- e9 af 00 00 00       	jmp    2100 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b0>
+    2051:	|  |  |  |  |  |     |     |     |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    std::memcpy(d, s, n);
+    2058:	|  |  |  |  |  |     |     |     |     /-> 41 f6 c1 04          	test   $0x4,%r9b
+    205c:	|  |  |  |  |  |     |     |  /--|-----|-- 0f 85 9f 00 00 00    	jne    2101 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b1>
+    2062:	|  |  |  |  |  |     |     |  |  |     |   45 85 c9             	test   %r9d,%r9d
+    2065:	|  |  |  |  |  |  /--|-----|--|--|-----|-- 74 10                	je     2077 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    2067:	|  |  |  |  |  |  |  |     |  |  |     |   41 0f b6 08          	movzbl (%r8),%ecx
+    206b:	|  |  |  |  |  |  |  |     |  |  |     |   88 08                	mov    %cl,(%rax)
+    206d:	|  |  |  |  |  |  |  |     |  |  |     |   41 f6 c1 02          	test   $0x2,%r9b
+    2071:	|  |  |  |  |  |  |  |  /--|--|--|-----|-- 0f 85 c9 00 00 00    	jne    2140 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4f0>
+        done += m;
+    2077:	|  |  |  |  |  |  >--|--|--|--|--|-----|-> 4d 01 ca             	add    %r9,%r10
+    while (done < n) {
+    207a:	|  |  |  |  |  |  |  |  |  |  |  |     |   49 39 d2             	cmp    %rdx,%r10
+    207d:	|  |  |  |  |  |  |  |  |  |  |  |  /--|-- 73 4e                	jae    20cd <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47d>
+        Length const m = (done < n - done) ? done : n - done;
+    207f:	|  |  |  |  |  |  |  |  |  |  |  >--|--|-> 49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    2082:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4b 8d 04 10          	lea    (%r8,%r10,1),%rax
+        Length const m = (done < n - done) ? done : n - done;
+    2086:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 29 d1             	sub    %r10,%r9
+    2089:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 39 d1             	cmp    %r10,%r9
+    208c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 0f 47 ca          	cmova  %r10,%r9
+    std::memcpy(d, s, n);
+    2090:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   41 83 f9 08          	cmp    $0x8,%r9d
+    2094:	|  |  |  |  |  |  |  |  |  |  |  |  |  \-- 72 c2                	jb     2058 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x408>
+    2096:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 08             	mov    (%r8),%rcx
+    2099:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 78 08          	lea    0x8(%rax),%rdi
+        done += m;
+    209d:	|  |  |  |  |  |  |  |  |  |  |  |  |      4d 01 ca             	add    %r9,%r10
+    std::memcpy(d, s, n);
+    20a0:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 83 e7 f8          	and    $0xfffffffffffffff8,%rdi
+    20a4:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 08             	mov    %rcx,(%rax)
+    20a7:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 89 c9             	mov    %r9d,%ecx
+    20aa:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 74 08 f8       	mov    -0x8(%r8,%rcx,1),%rsi
+    20af:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 74 08 f8       	mov    %rsi,-0x8(%rax,%rcx,1)
+    20b4:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 f8             	sub    %rdi,%rax
+    20b7:	|  |  |  |  |  |  |  |  |  |  |  |  |      4c 89 c6             	mov    %r8,%rsi
+    20ba:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 c6             	sub    %rax,%rsi
+    20bd:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 01 c8             	add    %r9d,%eax
+    20c0:	|  |  |  |  |  |  |  |  |  |  |  |  |      c1 e8 03             	shr    $0x3,%eax
+    20c3:	|  |  |  |  |  |  |  |  |  |  |  |  |      89 c1                	mov    %eax,%ecx
+    20c5:	|  |  |  |  |  |  |  |  |  |  |  |  |      f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    20c8:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 39 d2             	cmp    %rdx,%r10
+    20cb:	|  |  |  |  |  |  |  |  |  |  |  \--|----- 72 b2                	jb     207f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    20cd:	|  |  |  |  |  |  |  |  |  |  |     \----> c3                   	ret
+    std::memcpy(d, s, n);
+    20ce:	|  |  |  |  |  |  |  \--|--|--|----------> 41 f6 c2 04          	test   $0x4,%r10b
+    20d2:	|  |  |  |  |  |  |     |  |  |        /-- 0f 85 85 00 00 00    	jne    215d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x50d>
+    20d8:	|  |  |  |  |  |  |     |  |  |        |   85 c0                	test   %eax,%eax
+    20da:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 67 ff ff ff    	je     2047 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    20e0:	|  |  |  |  |  |  |     |  |  |        |   0f b6 36             	movzbl (%rsi),%esi
+    20e3:	|  |  |  |  |  |  |     |  |  |        |   40 88 37             	mov    %sil,(%rdi)
+    20e6:	|  |  |  |  |  |  |     |  |  |        |   a8 02                	test   $0x2,%al
+    20e8:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 59 ff ff ff    	je     2047 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    20ee:	|  |  |  |  |  |  |     |  |  |        |   0f b7 4c 01 fe       	movzwl -0x2(%rcx,%rax,1),%ecx
+    20f3:	|  |  |  |  |  |  |     |  |  |        |   66 89 4c 07 fe       	mov    %cx,-0x2(%rdi,%rax,1)
+    20f8:	|  |  |  |  |  +--|-----|--|--|--------|-- e9 4a ff ff ff       	jmp    2047 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    20fd:	|  |  |  |  |  |  |     |  |  |        |   0f 1f 00             	nopl   (%rax)
+    2100:	|  |  |  |  |  |  |     |  \--|--------|-> c3                   	ret
+    2101:	|  |  |  |  |  |  |     |     \--------|-> 41 8b 08             	mov    (%r8),%ecx
+    2104:	|  |  |  |  |  |  |     |              |   89 08                	mov    %ecx,(%rax)
+    2106:	|  |  |  |  |  |  |     |              |   44 89 c9             	mov    %r9d,%ecx
+    2109:	|  |  |  |  |  |  |     |              |   41 8b 74 08 fc       	mov    -0x4(%r8,%rcx,1),%esi
+    210e:	|  |  |  |  |  |  |     |              |   89 74 08 fc          	mov    %esi,-0x4(%rax,%rcx,1)
+    2112:	|  |  |  |  |  |  +-----|--------------|-- e9 60 ff ff ff       	jmp    2077 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+        d[i] = p[i];
+    2117:	|  \--|--|--|--|--|-----|--------------|-> 0f b6 39             	movzbl (%rcx),%edi
+    211a:	|     |  |  |  |  |     |              |   41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    211d:	|     |  |  |  |  |     |              |   40 f6 c6 0e          	test   $0xe,%sil
+    2121:	+-----|--|--|--|--|-----|--------------|-- 0f 84 59 fc ff ff    	je     1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2127:	|     |  |  |  |  |     |              |   0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    212b:	|     |  |  |  |  |     |              |   41 88 78 01          	mov    %dil,0x1(%r8)
+    for (Index i = 0; i < head; ++i) {
+    212f:	|     |  |  |  |  |     |              |   48 83 f8 03          	cmp    $0x3,%rax
+    2133:	\-----|--|--|--|--|-----|--------------|-- 0f 85 47 fc ff ff    	jne    1d80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    2139:	      \--|--|--|--|-----|--------------|-- e9 7b fb ff ff       	jmp    1cb9 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x69>
+    213e:	         |  |  |  |     |              |   66 90                	xchg   %ax,%ax
+    std::memcpy(d, s, n);
+    2140:	         |  |  |  |     \--------------|-> 44 89 c9             	mov    %r9d,%ecx
+    2143:	         |  |  |  |                    |   41 0f b7 74 08 fe    	movzwl -0x2(%r8,%rcx,1),%esi
+    2149:	         |  |  |  |                    |   66 89 74 08 fe       	mov    %si,-0x2(%rax,%rcx,1)
+    214e:	         |  |  |  \--------------------|-- e9 24 ff ff ff       	jmp    2077 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    for (Index i = 0; i < head; ++i) {
+    2153:	         \--|--|-----------------------|-> 49 89 c1             	mov    %rax,%r9
+    2156:	            |  |                       |   31 f6                	xor    %esi,%esi
+    2158:	            \--|-----------------------|-- e9 38 fe ff ff       	jmp    1f95 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x345>
+    std::memcpy(d, s, n);
+    215d:	               |                       \-> 8b 36                	mov    (%rsi),%esi
+    215f:	               |                           89 37                	mov    %esi,(%rdi)
+    2161:	               |                           8b 4c 01 fc          	mov    -0x4(%rcx,%rax,1),%ecx
+    2165:	               |                           89 4c 07 fc          	mov    %ecx,-0x4(%rdi,%rax,1)
+    2169:	               \-------------------------- e9 d9 fe ff ff       	jmp    2047 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    216e:	                                           66 90                	xchg   %ax,%ax
+
+0000000000002170 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    2170:	    48 85 ff             	test   %rdi,%rdi
+    2173:	/-- 74 0b                	je     2180 <nel::free_aligned(void*)+0x10>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    2175:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    2179:	|   e9 b2 ee ff ff       	jmp    1030 <free@plt>
+    217e:	|   66 90                	xchg   %ax,%ax
+}
+    2180:	\-> c3                   	ret
+    2181:	    66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2188:	    00 00 00 00 
+    218c:	    0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002190 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    2190:	                   41 56                	push   %r14
+            : fn_name_(fn_name)
+    2192:	                   48 8d 05 5f 0f 00 00 	lea    0xf5f(%rip),%rax        # 30f8 <_IO_stdin_used+0xf8>
+    2199:	                   41 55                	push   %r13
+    219b:	                   66 48 0f 6e c8       	movq   %rax,%xmm1
+    21a0:	                   41 54                	push   %r12
+    21a2:	                   55                   	push   %rbp
+    21a3:	                   48 89 cd             	mov    %rcx,%rbp
+    21a6:	                   48 8d 0d 3b 0f 00 00 	lea    0xf3b(%rip),%rcx        # 30e8 <_IO_stdin_used+0xe8>
+    21ad:	                   53                   	push   %rbx
+    21ae:	                   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    21b3:	                   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    21b7:	                   48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    21bb:	                   c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    21c2:	                   00 
+            : fn_name_(fn_name)
+    21c3:	                   0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    21c7:	                   48 85 f6             	test   %rsi,%rsi
+    21ca:	/----------------- 0f 84 a0 00 00 00    	je     2270 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    21d0:	|                  48 8d 46 ff          	lea    -0x1(%rsi),%rax
+    21d4:	|                  48 89 f3             	mov    %rsi,%rbx
+    21d7:	|                  48 85 f0             	test   %rsi,%rax
+    21da:	+----------------- 0f 85 90 00 00 00    	jne    2270 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    21e0:	|                  48 8d 34 2e          	lea    (%rsi,%rbp,1),%rsi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    21e4:	|                  48 85 ff             	test   %rdi,%rdi
+    21e7:	|     /----------- 74 67                	je     2250 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xc0>
+    21e9:	|     |            4c 8b 6f f8          	mov    -0x8(%rdi),%r13
+    uint8_t *const new_base =
+    21ed:	|     |            49 89 d4             	mov    %rdx,%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    21f0:	|     |            4c 29 ef             	sub    %r13,%rdi
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    21f3:	|     |            e8 d8 ee ff ff       	call   10d0 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    21f8:	|     |            48 85 c0             	test   %rax,%rax
+    21fb:	|  /--|----------- 0f 84 7e 00 00 00    	je     227f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    2201:	|  |  |            48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    2206:	|  |  |            48 f7 db             	neg    %rbx
+    2209:	|  |  |            48 21 cb             	and    %rcx,%rbx
+    220c:	|  |  |            49 89 de             	mov    %rbx,%r14
+    220f:	|  |  |            49 29 c6             	sub    %rax,%r14
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    2212:	|  |  |            4d 39 f5             	cmp    %r14,%r13
+    2215:	|  |  |        /-- 75 19                	jne    2230 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xa0>
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    }
+    offset_field(new_p) = new_offset;
+    2217:	|  |  |     /--|-> 4c 89 73 f8          	mov    %r14,-0x8(%rbx)
+    return new_p;
+}
+    221b:	|  |  |  /--|--|-> 48 83 c4 20          	add    $0x20,%rsp
+    221f:	|  |  |  |  |  |   48 89 d8             	mov    %rbx,%rax
+    2222:	|  |  |  |  |  |   5b                   	pop    %rbx
+    2223:	|  |  |  |  |  |   5d                   	pop    %rbp
+    2224:	|  |  |  |  |  |   41 5c                	pop    %r12
+    2226:	|  |  |  |  |  |   41 5d                	pop    %r13
+    2228:	|  |  |  |  |  |   41 5e                	pop    %r14
+    222a:	|  |  |  |  |  |   c3                   	ret
+    222b:	|  |  |  |  |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        std::memmove(new_p, new_base + old_offset, n);
+    2230:	|  |  |  |  |  \-> 4c 39 e5             	cmp    %r12,%rbp
+    2233:	|  |  |  |  |      4c 89 e2             	mov    %r12,%rdx
+    2236:	|  |  |  |  |      4a 8d 34 28          	lea    (%rax,%r13,1),%rsi
+    223a:	|  |  |  |  |      48 89 df             	mov    %rbx,%rdi
+    223d:	|  |  |  |  |      48 0f 46 d5          	cmovbe %rbp,%rdx
+    2241:	|  |  |  |  |      e8 9a ee ff ff       	call   10e0 <memmove@plt>
+    2246:	|  |  |  |  +----- eb cf                	jmp    2217 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+    2248:	|  |  |  |  |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    224f:	|  |  |  |  |      00 
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2250:	|  |  \--|--|----> 48 89 f7             	mov    %rsi,%rdi
+    2253:	|  |     |  |      e8 68 ee ff ff       	call   10c0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    2258:	|  |     |  |      48 85 c0             	test   %rax,%rax
+    225b:	|  +-----|--|----- 74 22                	je     227f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    225d:	|  |     |  |      48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    2262:	|  |     |  |      48 f7 db             	neg    %rbx
+    2265:	|  |     |  |      48 21 d3             	and    %rdx,%rbx
+    2268:	|  |     |  |      49 89 de             	mov    %rbx,%r14
+    226b:	|  |     |  |      49 29 c6             	sub    %rax,%r14
+    if (old_p != nullptr && new_offset != old_offset) {
+    226e:	|  |     |  \----- eb a7                	jmp    2217 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+    if (!pred) { assert_fail(msg, ctx); }
+    2270:	\--|-----|-------> 48 89 e6             	mov    %rsp,%rsi
+    2273:	   |     |         48 8d 3d 90 0e 00 00 	lea    0xe90(%rip),%rdi        # 310a <_IO_stdin_used+0x10a>
+    227a:	   |     |         e8 e3 ee ff ff       	call   1162 <nel::assert_fail(char const*, nel::Context const&)>
+    if (new_base == nullptr) { return nullptr; }
+    227f:	   \-----|-------> 31 db                	xor    %ebx,%ebx
+    2281:	         \-------- eb 98                	jmp    221b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x8b>
+    2283:	                   66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    228a:	                   00 00 00 00 
+    228e:	                   66 90                	xchg   %ax,%ax
+
+0000000000002290 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    2290:	       53                   	push   %rbx
+            : fn_name_(fn_name)
+    2291:	       48 8d 05 60 0e 00 00 	lea    0xe60(%rip),%rax        # 30f8 <_IO_stdin_used+0xf8>
+    2298:	       48 8d 0d 49 0e 00 00 	lea    0xe49(%rip),%rcx        # 30e8 <_IO_stdin_used+0xe8>
+    229f:	       66 48 0f 6e c1       	movq   %rcx,%xmm0
+    22a4:	       66 48 0f 6e c8       	movq   %rax,%xmm1
+    22a9:	       66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    22ad:	       48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    22b1:	       c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    22b8:	       00 
+            : fn_name_(fn_name)
+    22b9:	       0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    22bd:	       48 85 ff             	test   %rdi,%rdi
+    22c0:	/----- 74 35                	je     22f7 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+    22c2:	|      48 8d 47 ff          	lea    -0x1(%rdi),%rax
+    22c6:	|      48 89 fb             	mov    %rdi,%rbx
+    22c9:	|      48 85 f8             	test   %rdi,%rax
+    22cc:	+----- 75 29                	jne    22f7 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    22ce:	|      48 8d 3c 37          	lea    (%rdi,%rsi,1),%rdi
+    22d2:	|      e8 e9 ed ff ff       	call   10c0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    22d7:	|      48 85 c0             	test   %rax,%rax
+    22da:	|  /-- 74 15                	je     22f1 <nel::malloc_aligned(unsigned long, unsigned long)+0x61>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    22dc:	|  |   48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    22e1:	|  |   48 f7 db             	neg    %rbx
+    22e4:	|  |   48 21 da             	and    %rbx,%rdx
+    22e7:	|  |   48 29 c2             	sub    %rax,%rdx
+    uint8_t *const new_p = new_base + new_offset;
+    22ea:	|  |   48 01 d0             	add    %rdx,%rax
+    offset_field(new_p) = new_offset;
+    22ed:	|  |   48 89 50 f8          	mov    %rdx,-0x8(%rax)
+    return realloc_aligned(nullptr, align, 0, size);
+}
+    22f1:	|  \-> 48 83 c4 20          	add    $0x20,%rsp
+    22f5:	|      5b                   	pop    %rbx
+    22f6:	|      c3                   	ret
+    if (!pred) { assert_fail(msg, ctx); }
+    22f7:	\----> 48 89 e6             	mov    %rsp,%rsi
+    22fa:	       48 8d 3d 09 0e 00 00 	lea    0xe09(%rip),%rdi        # 310a <_IO_stdin_used+0x10a>
+    2301:	       e8 5c ee ff ff       	call   1162 <nel::assert_fail(char const*, nel::Context const&)>
+    2306:	       66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    230d:	       00 00 00 
+
+0000000000002310 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    2310:	53                   	push   %rbx
+    2311:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    2314:	40 0f be fe          	movsbl %sil,%edi
+    2318:	48 8b 35 61 2d 00 00 	mov    0x2d61(%rip),%rsi        # 5080 <stderr@GLIBC_2.2.5>
+    231f:	e8 5c ed ff ff       	call   1080 <fputc@plt>
+    return outs;
+}
+    2324:	48 89 d8             	mov    %rbx,%rax
+    2327:	5b                   	pop    %rbx
+    2328:	c3                   	ret
+    2329:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002330 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    2330:	53                   	push   %rbx
+    2331:	48 89 fb             	mov    %rdi,%rbx
+    2334:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    2337:	48 8b 35 42 2d 00 00 	mov    0x2d42(%rip),%rsi        # 5080 <stderr@GLIBC_2.2.5>
+    233e:	e8 1d ed ff ff       	call   1060 <fputs@plt>
+    return outs;
+}
+    2343:	48 89 d8             	mov    %rbx,%rax
+    2346:	5b                   	pop    %rbx
+    2347:	c3                   	ret
+    2348:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    234f:	00 
+
+0000000000002350 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    2350:	53                   	push   %rbx
+    2351:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    2354:	48 8b 3d 25 2d 00 00 	mov    0x2d25(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    235b:	40 0f b6 d6          	movzbl %sil,%edx
+    235f:	31 c0                	xor    %eax,%eax
+    2361:	48 8d 35 bd 0d 00 00 	lea    0xdbd(%rip),%rsi        # 3125 <_IO_stdin_used+0x125>
+    2368:	e8 33 ed ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+}
+    236d:	48 89 d8             	mov    %rbx,%rax
+    2370:	5b                   	pop    %rbx
+    2371:	c3                   	ret
+    2372:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2379:	00 00 00 00 
+    237d:	0f 1f 00             	nopl   (%rax)
+
+0000000000002380 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    2380:	53                   	push   %rbx
+    2381:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    2384:	48 8b 3d f5 2c 00 00 	mov    0x2cf5(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    238b:	0f b7 d6             	movzwl %si,%edx
+    238e:	31 c0                	xor    %eax,%eax
+    2390:	48 8d 35 8e 0d 00 00 	lea    0xd8e(%rip),%rsi        # 3125 <_IO_stdin_used+0x125>
+    2397:	e8 04 ed ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+}
+    239c:	48 89 d8             	mov    %rbx,%rax
+    239f:	5b                   	pop    %rbx
+    23a0:	c3                   	ret
+    23a1:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    23a8:	00 00 00 00 
+    23ac:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000023b0 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    23b0:	53                   	push   %rbx
+    23b1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    23b4:	48 8b 3d c5 2c 00 00 	mov    0x2cc5(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    23bb:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    23bd:	31 c0                	xor    %eax,%eax
+    23bf:	48 8d 35 5f 0d 00 00 	lea    0xd5f(%rip),%rsi        # 3125 <_IO_stdin_used+0x125>
+    23c6:	e8 d5 ec ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+}
+    23cb:	48 89 d8             	mov    %rbx,%rax
+    23ce:	5b                   	pop    %rbx
+    23cf:	c3                   	ret
+
+00000000000023d0 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    23d0:	53                   	push   %rbx
+    23d1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    23d4:	48 8b 3d a5 2c 00 00 	mov    0x2ca5(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    23db:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    23dd:	31 c0                	xor    %eax,%eax
+    23df:	48 8d 35 3f 0d 00 00 	lea    0xd3f(%rip),%rsi        # 3125 <_IO_stdin_used+0x125>
+    23e6:	e8 b5 ec ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+}
+    23eb:	48 89 d8             	mov    %rbx,%rax
+    23ee:	5b                   	pop    %rbx
+    23ef:	c3                   	ret
+
+00000000000023f0 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    23f0:	53                   	push   %rbx
+    23f1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    23f4:	48 8b 3d 85 2c 00 00 	mov    0x2c85(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    23fb:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    23fe:	31 c0                	xor    %eax,%eax
+    2400:	48 8d 35 21 0d 00 00 	lea    0xd21(%rip),%rsi        # 3128 <_IO_stdin_used+0x128>
+    2407:	e8 94 ec ff ff       	call   10a0 <fprintf@plt>
+    return outs;
+}
+    240c:	48 89 d8             	mov    %rbx,%rax
+    240f:	5b                   	pop    %rbx
+    2410:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000002414 <_fini>:
+    2414:	48 83 ec 08          	sub    $0x8,%rsp
+    2418:	48 83 c4 08          	add    $0x8,%rsp
+    241c:	c3                   	ret
@@ -0,0 +1,3354 @@
+
+target/release/examples/bench_stream:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 4f 00 00 	mov    0x4fc5(%rip),%rax        # 5fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 4f 00 00    	push   0x4fca(%rip)        # 5ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 4f 00 00    	jmp    *0x4fcc(%rip)        # 5ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 4f 00 00    	jmp    *0x4fca(%rip)        # 6000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 4f 00 00    	jmp    *0x4fc2(%rip)        # 6008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <pthread_cond_broadcast@plt>:
+    1050:	ff 25 ba 4f 00 00    	jmp    *0x4fba(%rip)        # 6010 <pthread_cond_broadcast@GLIBC_2.3.2>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <clock_gettime@plt>:
+    1060:	ff 25 b2 4f 00 00    	jmp    *0x4fb2(%rip)        # 6018 <clock_gettime@GLIBC_2.17>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <pthread_cond_wait@plt>:
+    1070:	ff 25 aa 4f 00 00    	jmp    *0x4faa(%rip)        # 6020 <pthread_cond_wait@GLIBC_2.3.2>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <pthread_mutex_destroy@plt>:
+    1080:	ff 25 a2 4f 00 00    	jmp    *0x4fa2(%rip)        # 6028 <pthread_mutex_destroy@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fputs@plt>:
+    1090:	ff 25 9a 4f 00 00    	jmp    *0x4f9a(%rip)        # 6030 <fputs@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memset@plt>:
+    10a0:	ff 25 92 4f 00 00    	jmp    *0x4f92(%rip)        # 6038 <memset@GLIBC_2.2.5>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <fputc@plt>:
+    10b0:	ff 25 8a 4f 00 00    	jmp    *0x4f8a(%rip)        # 6040 <fputc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <memcmp@plt>:
+    10c0:	ff 25 82 4f 00 00    	jmp    *0x4f82(%rip)        # 6048 <memcmp@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <pthread_cond_signal@plt>:
+    10d0:	ff 25 7a 4f 00 00    	jmp    *0x4f7a(%rip)        # 6050 <pthread_cond_signal@GLIBC_2.3.2>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010e0 <fprintf@plt>:
+    10e0:	ff 25 72 4f 00 00    	jmp    *0x4f72(%rip)        # 6058 <fprintf@GLIBC_2.2.5>
+    10e6:	68 0b 00 00 00       	push   $0xb
+    10eb:	e9 30 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010f0 <memcpy@plt>:
+    10f0:	ff 25 6a 4f 00 00    	jmp    *0x4f6a(%rip)        # 6060 <memcpy@GLIBC_2.14>
+    10f6:	68 0c 00 00 00       	push   $0xc
+    10fb:	e9 20 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001100 <pthread_cond_init@plt>:
+    1100:	ff 25 62 4f 00 00    	jmp    *0x4f62(%rip)        # 6068 <pthread_cond_init@GLIBC_2.3.2>
+    1106:	68 0d 00 00 00       	push   $0xd
+    110b:	e9 10 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001110 <pthread_mutex_unlock@plt>:
+    1110:	ff 25 5a 4f 00 00    	jmp    *0x4f5a(%rip)        # 6070 <pthread_mutex_unlock@GLIBC_2.2.5>
+    1116:	68 0e 00 00 00       	push   $0xe
+    111b:	e9 00 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001120 <malloc@plt>:
+    1120:	ff 25 52 4f 00 00    	jmp    *0x4f52(%rip)        # 6078 <malloc@GLIBC_2.2.5>
+    1126:	68 0f 00 00 00       	push   $0xf
+    112b:	e9 f0 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001130 <realloc@plt>:
+    1130:	ff 25 4a 4f 00 00    	jmp    *0x4f4a(%rip)        # 6080 <realloc@GLIBC_2.2.5>
+    1136:	68 10 00 00 00       	push   $0x10
+    113b:	e9 e0 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001140 <pthread_create@plt>:
+    1140:	ff 25 42 4f 00 00    	jmp    *0x4f42(%rip)        # 6088 <pthread_create@GLIBC_2.34>
+    1146:	68 11 00 00 00       	push   $0x11
+    114b:	e9 d0 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001150 <memmove@plt>:
+    1150:	ff 25 3a 4f 00 00    	jmp    *0x4f3a(%rip)        # 6090 <memmove@GLIBC_2.2.5>
+    1156:	68 12 00 00 00       	push   $0x12
+    115b:	e9 c0 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001160 <pthread_cond_destroy@plt>:
+    1160:	ff 25 32 4f 00 00    	jmp    *0x4f32(%rip)        # 6098 <pthread_cond_destroy@GLIBC_2.3.2>
+    1166:	68 13 00 00 00       	push   $0x13
+    116b:	e9 b0 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001170 <sysconf@plt>:
+    1170:	ff 25 2a 4f 00 00    	jmp    *0x4f2a(%rip)        # 60a0 <sysconf@GLIBC_2.2.5>
+    1176:	68 14 00 00 00       	push   $0x14
+    117b:	e9 a0 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001180 <pthread_join@plt>:
+    1180:	ff 25 22 4f 00 00    	jmp    *0x4f22(%rip)        # 60a8 <pthread_join@GLIBC_2.34>
+    1186:	68 15 00 00 00       	push   $0x15
+    118b:	e9 90 fe ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001190 <pthread_mutex_init@plt>:
+    1190:	ff 25 1a 4f 00 00    	jmp    *0x4f1a(%rip)        # 60b0 <pthread_mutex_init@GLIBC_2.2.5>
+    1196:	68 16 00 00 00       	push   $0x16
+    119b:	e9 80 fe ff ff       	jmp    1020 <_init+0x20>
+
+00000000000011a0 <pthread_mutex_lock@plt>:
+    11a0:	ff 25 12 4f 00 00    	jmp    *0x4f12(%rip)        # 60b8 <pthread_mutex_lock@GLIBC_2.2.5>
+    11a6:	68 17 00 00 00       	push   $0x17
+    11ab:	e9 70 fe ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000011b0 <__cxa_finalize@plt>:
+    11b0:	ff 25 2a 4e 00 00    	jmp    *0x4e2a(%rip)        # 5fe0 <__cxa_finalize@GLIBC_2.2.5>
+    11b6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000011c0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    11c0:	50                   	push   %rax
+    std::abort();
+    11c1:	e8 7a fe ff ff       	call   1040 <abort@plt>
+
+00000000000011c6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    11c6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    11c7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    11ca:	4c 8d 0d 52 30 00 00 	lea    0x3052(%rip),%r9        # 4223 <_IO_stdin_used+0x223>
+    11d1:	31 c0                	xor    %eax,%eax
+    11d3:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    11d7:	4c 8b 07             	mov    (%rdi),%r8
+    11da:	48 8d 35 48 30 00 00 	lea    0x3048(%rip),%rsi        # 4229 <_IO_stdin_used+0x229>
+    11e1:	48 8b 3d f8 4e 00 00 	mov    0x4ef8(%rip),%rdi        # 60e0 <stderr@GLIBC_2.2.5>
+    11e8:	e8 f3 fe ff ff       	call   10e0 <fprintf@plt>
+    std::abort();
+    11ed:	e8 4e fe ff ff       	call   1040 <abort@plt>
+
+00000000000011f2 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    11f2:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    11f6:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    11f9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    11fd:	31 c0                	xor    %eax,%eax
+    11ff:	57                   	push   %rdi
+    1200:	48 8b 3d d9 4e 00 00 	mov    0x4ed9(%rip),%rdi        # 60e0 <stderr@GLIBC_2.2.5>
+    1207:	4c 8d 0d 15 30 00 00 	lea    0x3015(%rip),%r9        # 4223 <_IO_stdin_used+0x223>
+    120e:	4c 8b 06             	mov    (%rsi),%r8
+    1211:	48 8d 35 22 30 00 00 	lea    0x3022(%rip),%rsi        # 423a <_IO_stdin_used+0x23a>
+    1218:	e8 c3 fe ff ff       	call   10e0 <fprintf@plt>
+    std::abort();
+    121d:	e8 1e fe ff ff       	call   1040 <abort@plt>
+
+0000000000001222 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1222:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1226:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1229:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    122d:	31 c0                	xor    %eax,%eax
+    122f:	57                   	push   %rdi
+    1230:	48 8b 3d a9 4e 00 00 	mov    0x4ea9(%rip),%rdi        # 60e0 <stderr@GLIBC_2.2.5>
+    1237:	4c 8d 0d 11 30 00 00 	lea    0x3011(%rip),%r9        # 424f <_IO_stdin_used+0x24f>
+    123e:	4c 8b 06             	mov    (%rsi),%r8
+    1241:	48 8d 35 f2 2f 00 00 	lea    0x2ff2(%rip),%rsi        # 423a <_IO_stdin_used+0x23a>
+    1248:	e8 93 fe ff ff       	call   10e0 <fprintf@plt>
+    std::abort();
+    124d:	e8 ee fd ff ff       	call   1040 <abort@plt>
+    1252:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1259:	00 00 00 
+    125c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001260 <main>:
+    bench::report("  neighbour 4MB   ", t_neighbour, passes * n_work);
+    nel::log << "  passes: " << passes << " sum: " << r << '\n';
+}
+
+int main()
+{
+    1260:	                   41 57                	push   %r15
+    Buffers b = {alloc(n_state), alloc(n_state), alloc(n_work)};
+    1262:	                   be 00 00 80 0c       	mov    $0xc800000,%esi
+{
+    1267:	                   41 56                	push   %r14
+    1269:	                   41 55                	push   %r13
+    126b:	                   41 54                	push   %r12
+    126d:	                   55                   	push   %rbp
+
+    nel::log << "one thread, snapshot then re-read the neighbour's working set\n";
+    126e:	                   48 8d 2d 74 4e 00 00 	lea    0x4e74(%rip),%rbp        # 60e9 <nel::log>
+{
+    1275:	                   53                   	push   %rbx
+    1276:	                   48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+    Buffers b = {alloc(n_state), alloc(n_state), alloc(n_work)};
+    127d:	                   48 8d 5c 24 50       	lea    0x50(%rsp),%rbx
+    1282:	                   48 89 df             	mov    %rbx,%rdi
+    1285:	                   e8 86 03 00 00       	call   1610 <alloc(unsigned long)>
+    128a:	                   48 8d 7c 24 60       	lea    0x60(%rsp),%rdi
+    128f:	                   be 00 00 80 0c       	mov    $0xc800000,%esi
+    1294:	                   e8 77 03 00 00       	call   1610 <alloc(unsigned long)>
+    1299:	                   48 8d 7c 24 70       	lea    0x70(%rsp),%rdi
+    129e:	                   be 00 00 40 00       	mov    $0x400000,%esi
+    12a3:	                   e8 68 03 00 00       	call   1610 <alloc(unsigned long)>
+    nel::log << "one thread, snapshot then re-read the neighbour's working set\n";
+    12a8:	                   48 8d 35 f1 2e 00 00 	lea    0x2ef1(%rip),%rsi        # 41a0 <_IO_stdin_used+0x1a0>
+    12af:	                   48 89 ef             	mov    %rbp,%rdi
+    12b2:	                   e8 a9 14 00 00       	call   2760 <nel::operator<<(nel::Log&, char const*)>
+         *
+         * @returns number of elements in the slice.
+         */
+        constexpr Length len(void) const
+        {
+            return len_;
+    12b7:	                   48 8b 54 24 78       	mov    0x78(%rsp),%rdx
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    12bc:	                   48 85 d2             	test   %rdx,%rdx
+    12bf:	/----------------- 0f 84 26 02 00 00    	je     14eb <main+0x28b>
+            return content_;
+    12c5:	|                  48 8b 4c 24 70       	mov    0x70(%rsp),%rcx
+    Word r = 0;
+    12ca:	|                  45 31 ed             	xor    %r13d,%r13d
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    12cd:	|                  31 c0                	xor    %eax,%eax
+    12cf:	|                  90                   	nop
+        r += work.ptr()[i];
+    12d0:	|              /-> 4c 03 2c c1          	add    (%rcx,%rax,8),%r13
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    12d4:	|              |   48 83 c0 08          	add    $0x8,%rax
+    12d8:	|              |   48 39 d0             	cmp    %rdx,%rax
+    12db:	|              \-- 72 f3                	jb     12d0 <main+0x70>
+{
+
+inline long unsigned int now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    12dd:	|  /-------------> 4c 8d 64 24 30       	lea    0x30(%rsp),%r12
+    12e2:	|  |               bf 01 00 00 00       	mov    $0x1,%edi
+    12e7:	|  |               4c 89 e6             	mov    %r12,%rsi
+    12ea:	|  |               e8 71 fd ff ff       	call   1060 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    12ef:	|  |               4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+            return len_;
+    12f4:	|  |               48 8b 4c 24 78       	mov    0x78(%rsp),%rcx
+            return content_;
+    12f9:	|  |               bf 05 00 00 00       	mov    $0x5,%edi
+    12fe:	|  |               4c 69 7c 24 30 00 ca 	imul   $0x3b9aca00,0x30(%rsp),%r15
+    1305:	|  |               9a 3b 
+    1307:	|  |               48 8b 74 24 70       	mov    0x70(%rsp),%rsi
+    130c:	|  |               0f 1f 40 00          	nopl   0x0(%rax)
+    Word r = 0;
+    1310:	|  |     /-------> 31 d2                	xor    %edx,%edx
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    1312:	|  |     |         31 c0                	xor    %eax,%eax
+    1314:	|  |     |         48 85 c9             	test   %rcx,%rcx
+    1317:	|  |     |  /----- 74 14                	je     132d <main+0xcd>
+    1319:	|  |     |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        r += work.ptr()[i];
+    1320:	|  |     |  |  /-> 48 03 14 c6          	add    (%rsi,%rax,8),%rdx
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    1324:	|  |     |  |  |   48 83 c0 08          	add    $0x8,%rax
+    1328:	|  |     |  |  |   48 39 c8             	cmp    %rcx,%rax
+    132b:	|  |     |  |  \-- 72 f3                	jb     1320 <main+0xc0>
+            r += touch(b.work);
+    132d:	|  |     |  \----> 49 01 d5             	add    %rdx,%r13
+        for (nel::Index k = 0; k < n_snaps; ++k) {
+    1330:	|  |     |         48 83 ef 01          	sub    $0x1,%rdi
+    1334:	|  |     \-------- 75 da                	jne    1310 <main+0xb0>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1336:	|  |               4c 89 e6             	mov    %r12,%rsi
+    1339:	|  |               bf 01 00 00 00       	mov    $0x1,%edi
+    133e:	|  |               4c 89 44 24 08       	mov    %r8,0x8(%rsp)
+    1343:	|  |               e8 18 fd ff ff       	call   1060 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1348:	|  |               4c 8b 44 24 08       	mov    0x8(%rsp),%r8
+    nel::log << "no snapshot\n";
+    134d:	|  |               48 8d 35 a5 2d 00 00 	lea    0x2da5(%rip),%rsi        # 40f9 <_IO_stdin_used+0xf9>
+    1354:	|  |               48 89 ef             	mov    %rbp,%rdi
+    1357:	|  |               4c 69 74 24 30 00 ca 	imul   $0x3b9aca00,0x30(%rsp),%r14
+    135e:	|  |               9a 3b 
+    1360:	|  |               4d 29 c6             	sub    %r8,%r14
+template<typename F>
+long unsigned int time_ns(F &&f)
+{
+    long unsigned int const b = now_ns();
+    f();
+    return now_ns() - b;
+    1363:	|  |               4c 03 74 24 38       	add    0x38(%rsp),%r14
+    1368:	|  |               e8 f3 13 00 00       	call   2760 <nel::operator<<(nel::Log&, char const*)>
+    136d:	|  |               4d 29 fe             	sub    %r15,%r14
+    bench::report("  re-read 4MB     ", t, n_snaps * n_work);
+    1370:	|  |               ba 00 00 40 01       	mov    $0x1400000,%edx
+    1375:	|  |               48 8d 3d f7 2c 00 00 	lea    0x2cf7(%rip),%rdi        # 4073 <_IO_stdin_used+0x73>
+    137c:	|  |               4c 89 f6             	mov    %r14,%rsi
+    baseline_reread(b);
+    one_thread(b, false, "copy_from");
+    137f:	|  |               4c 8d 35 d0 2c 00 00 	lea    0x2cd0(%rip),%r14        # 4056 <_IO_stdin_used+0x56>
+    bench::report("  re-read 4MB     ", t, n_snaps * n_work);
+    1386:	|  |               e8 75 0a 00 00       	call   1e00 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << r << '\n';
+    138b:	|  |               48 8d 35 f4 2c 00 00 	lea    0x2cf4(%rip),%rsi        # 4086 <_IO_stdin_used+0x86>
+    1392:	|  |               48 89 ef             	mov    %rbp,%rdi
+    1395:	|  |               e8 c6 13 00 00       	call   2760 <nel::operator<<(nel::Log&, char const*)>
+    139a:	|  |               4c 89 ee             	mov    %r13,%rsi
+    one_thread(b, true, "copy_from_streaming");
+    139d:	|  |               4c 8d 2d 9e 2c 00 00 	lea    0x2c9e(%rip),%r13        # 4042 <_IO_stdin_used+0x42>
+    nel::log << "  sum: " << r << '\n';
+    13a4:	|  |               48 89 c7             	mov    %rax,%rdi
+    13a7:	|  |               e8 74 14 00 00       	call   2820 <nel::operator<<(nel::Log&, unsigned long)>
+    13ac:	|  |               be 0a 00 00 00       	mov    $0xa,%esi
+    13b1:	|  |               48 89 c7             	mov    %rax,%rdi
+    13b4:	|  |               e8 87 13 00 00       	call   2740 <nel::operator<<(nel::Log&, char)>
+    one_thread(b, false, "copy_from");
+    13b9:	|  |               31 f6                	xor    %esi,%esi
+    13bb:	|  |               4c 89 f2             	mov    %r14,%rdx
+    13be:	|  |               48 89 df             	mov    %rbx,%rdi
+    13c1:	|  |               e8 4a 05 00 00       	call   1910 <one_thread(Buffers&, bool, char const*)>
+    one_thread(b, true, "copy_from_streaming");
+    13c6:	|  |               4c 89 ea             	mov    %r13,%rdx
+    13c9:	|  |               be 01 00 00 00       	mov    $0x1,%esi
+    13ce:	|  |               48 89 df             	mov    %rbx,%rdi
+    13d1:	|  |               e8 3a 05 00 00       	call   1910 <one_thread(Buffers&, bool, char const*)>
+
+    if (nel::par::Pool::available_parallelism() < 2) {
+    13d6:	|  |               e8 25 17 00 00       	call   2b00 <nel::par::Pool::available_parallelism()>
+    13db:	|  |               48 83 f8 01          	cmp    $0x1,%rax
+    13df:	|  |  /----------- 0f 86 f5 00 00 00    	jbe    14da <main+0x27a>
+        nel::log << "one cpu, no neighbour thread\n";
+    } else {
+        auto pool = nel::par::Pool::try_new(2).unwrap();
+    13e5:	|  |  |            48 8d 7c 24 20       	lea    0x20(%rsp),%rdi
+    13ea:	|  |  |            be 02 00 00 00       	mov    $0x2,%esi
+    13ef:	|  |  |            e8 2c 17 00 00       	call   2b20 <nel::par::Pool::try_new(unsigned long)>
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    13f4:	|  |  |            48 8d 05 0f 2c 00 00 	lea    0x2c0f(%rip),%rax        # 400a <_IO_stdin_used+0xa>
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+        {
+            // a consuming matcher..
+            // that moves the value to the closures..
+            auto tag = tag_;
+            tag_ = Tag::INVAL;
+    13fb:	|  |  |            31 d2                	xor    %edx,%edx
+    13fd:	|  |  |            48 8d 3d 20 2d 00 00 	lea    0x2d20(%rip),%rdi        # 4124 <_IO_stdin_used+0x124>
+    1404:	|  |  |            66 48 0f 6e c8       	movq   %rax,%xmm1
+    1409:	|  |  |            66 48 0f 6e c7       	movq   %rdi,%xmm0
+            auto tag = tag_;
+    140e:	|  |  |            8b 44 24 20          	mov    0x20(%rsp),%eax
+            , file_name_(file_name)
+            , line_num_(line_num)
+    1412:	|  |  |            c7 44 24 40 8f 00 00 	movl   $0x8f,0x40(%rsp)
+    1419:	|  |  |            00 
+            : fn_name_(fn_name)
+    141a:	|  |  |            66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+            tag_ = Tag::INVAL;
+    141e:	|  |  |            89 54 24 20          	mov    %edx,0x20(%rsp)
+    1422:	|  |  |            0f 29 44 24 30       	movaps %xmm0,0x30(%rsp)
+            switch (tag) { // result-consume
+    1427:	|  |  |            83 f8 01             	cmp    $0x1,%eax
+    142a:	|  |  |        /-- 0f 85 92 00 00 00    	jne    14c2 <main+0x262>
+
+        Pool(Pool const &) = delete;
+        Pool &operator=(Pool const &) = delete;
+
+        constexpr Pool(Pool &&o)
+            : shared_(o.shared_)
+    1430:	|  |  |        |   48 8b 44 24 28       	mov    0x28(%rsp),%rax
+        nel::log << "two threads, the neighbour reading while snapshots run\n";
+    1435:	|  |  |        |   48 89 ef             	mov    %rbp,%rdi
+    1438:	|  |  |        |   48 8d 35 a1 2d 00 00 	lea    0x2da1(%rip),%rsi        # 41e0 <_IO_stdin_used+0x1e0>
+        two_threads(pool, b, Snap::None, "no snapshot");
+    143f:	|  |  |        |   48 8d 6c 24 18       	lea    0x18(%rsp),%rbp
+    1444:	|  |  |        |   48 89 44 24 18       	mov    %rax,0x18(%rsp)
+        nel::log << "two threads, the neighbour reading while snapshots run\n";
+    1449:	|  |  |        |   e8 12 13 00 00       	call   2760 <nel::operator<<(nel::Log&, char const*)>
+        two_threads(pool, b, Snap::None, "no snapshot");
+    144e:	|  |  |        |   31 d2                	xor    %edx,%edx
+    1450:	|  |  |        |   48 89 de             	mov    %rbx,%rsi
+    1453:	|  |  |        |   48 89 ef             	mov    %rbp,%rdi
+    1456:	|  |  |        |   48 8d 0d cc 2c 00 00 	lea    0x2ccc(%rip),%rcx        # 4129 <_IO_stdin_used+0x129>
+    145d:	|  |  |        |   e8 2e 07 00 00       	call   1b90 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)>
+        two_threads(pool, b, Snap::Copy, "copy_from");
+    1462:	|  |  |        |   4c 89 f1             	mov    %r14,%rcx
+    1465:	|  |  |        |   ba 01 00 00 00       	mov    $0x1,%edx
+    146a:	|  |  |        |   48 89 de             	mov    %rbx,%rsi
+    146d:	|  |  |        |   48 89 ef             	mov    %rbp,%rdi
+    1470:	|  |  |        |   e8 1b 07 00 00       	call   1b90 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)>
+        two_threads(pool, b, Snap::Streaming, "copy_from_streaming");
+    1475:	|  |  |        |   48 89 ef             	mov    %rbp,%rdi
+    1478:	|  |  |        |   4c 89 e9             	mov    %r13,%rcx
+    147b:	|  |  |        |   ba 02 00 00 00       	mov    $0x2,%edx
+    1480:	|  |  |        |   48 89 de             	mov    %rbx,%rsi
+    1483:	|  |  |        |   e8 08 07 00 00       	call   1b90 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)>
+    }
+    1488:	|  |  |        |   48 89 ef             	mov    %rbp,%rdi
+    148b:	|  |  |        |   e8 d0 14 00 00       	call   2960 <nel::par::Pool::~Pool()>
+
+    nel::free_aligned(b.src.ptr());
+    1490:	|  |  |  /-----|-> 48 8b 7c 24 50       	mov    0x50(%rsp),%rdi
+    1495:	|  |  |  |     |   e8 06 11 00 00       	call   25a0 <nel::free_aligned(void*)>
+    nel::free_aligned(b.dst.ptr());
+    149a:	|  |  |  |     |   48 8b 7c 24 60       	mov    0x60(%rsp),%rdi
+    149f:	|  |  |  |     |   e8 fc 10 00 00       	call   25a0 <nel::free_aligned(void*)>
+    nel::free_aligned(b.work.ptr());
+    14a4:	|  |  |  |     |   48 8b 7c 24 70       	mov    0x70(%rsp),%rdi
+    14a9:	|  |  |  |     |   e8 f2 10 00 00       	call   25a0 <nel::free_aligned(void*)>
+}
+    14ae:	|  |  |  |     |   48 81 c4 88 00 00 00 	add    $0x88,%rsp
+    14b5:	|  |  |  |     |   31 c0                	xor    %eax,%eax
+    14b7:	|  |  |  |     |   5b                   	pop    %rbx
+    14b8:	|  |  |  |     |   5d                   	pop    %rbp
+    14b9:	|  |  |  |     |   41 5c                	pop    %r12
+    14bb:	|  |  |  |     |   41 5d                	pop    %r13
+    14bd:	|  |  |  |     |   41 5e                	pop    %r14
+    14bf:	|  |  |  |     |   41 5f                	pop    %r15
+    14c1:	|  |  |  |     |   c3                   	ret
+    14c2:	|  |  |  |     \-> 83 f8 02             	cmp    $0x2,%eax
+    14c5:	|  |  |  |     /-- 74 2c                	je     14f3 <main+0x293>
+    14c7:	|  |  |  |     |   85 c0                	test   %eax,%eax
+    14c9:	|  |  |  |  /--|-- 74 37                	je     1502 <main+0x2a2>
+                    // if they do it's a use-after-move-from op so must panic.
+                    // or a use-before-initialised so again must panic.
+                    nel::panic("invalid Result", ctx);
+                    break;
+                default:
+                    nel::panic("bad Result", ctx);
+    14cb:	|  |  |  |  |  |   4c 89 e6             	mov    %r12,%rsi
+    14ce:	|  |  |  |  |  |   48 8d 3d fb 2b 00 00 	lea    0x2bfb(%rip),%rdi        # 40d0 <_IO_stdin_used+0xd0>
+    14d5:	|  |  |  |  |  |   e8 18 fd ff ff       	call   11f2 <nel::panic(char const*, nel::Context const&)>
+        nel::log << "one cpu, no neighbour thread\n";
+    14da:	|  |  \--|--|--|-> 48 8d 35 25 2c 00 00 	lea    0x2c25(%rip),%rsi        # 4106 <_IO_stdin_used+0x106>
+    14e1:	|  |     |  |  |   48 89 ef             	mov    %rbp,%rdi
+    14e4:	|  |     |  |  |   e8 77 12 00 00       	call   2760 <nel::operator<<(nel::Log&, char const*)>
+    14e9:	|  |     \--|--|-- eb a5                	jmp    1490 <main+0x230>
+    Word r = 0;
+    14eb:	\--|--------|--|-> 45 31 ed             	xor    %r13d,%r13d
+    14ee:	   \--------|--|-- e9 ea fd ff ff       	jmp    12dd <main+0x7d>
+         * `this` is consumed by the operation.
+         */
+        constexpr T unwrap(Context const &ctx = Context())
+        {
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    14f3:	            |  \-> 4c 89 e6             	mov    %r12,%rsi
+    14f6:	            |      48 8d 3d 38 2c 00 00 	lea    0x2c38(%rip),%rdi        # 4135 <_IO_stdin_used+0x135>
+    14fd:	            |      e8 f0 fc ff ff       	call   11f2 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("invalid Result", ctx);
+    1502:	            \----> 4c 89 e6             	mov    %r12,%rsi
+    1505:	                   48 8d 3d b5 2b 00 00 	lea    0x2bb5(%rip),%rdi        # 40c1 <_IO_stdin_used+0xc1>
+    150c:	                   e8 e1 fc ff ff       	call   11f2 <nel::panic(char const*, nel::Context const&)>
+    1511:	                   66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1518:	                   00 00 00 
+    151b:	                   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000001520 <_start>:
+    1520:	31 ed                	xor    %ebp,%ebp
+    1522:	49 89 d1             	mov    %rdx,%r9
+    1525:	5e                   	pop    %rsi
+    1526:	48 89 e2             	mov    %rsp,%rdx
+    1529:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    152d:	50                   	push   %rax
+    152e:	54                   	push   %rsp
+    152f:	45 31 c0             	xor    %r8d,%r8d
+    1532:	31 c9                	xor    %ecx,%ecx
+    1534:	48 8d 3d 25 fd ff ff 	lea    -0x2db(%rip),%rdi        # 1260 <main>
+    153b:	ff 15 7f 4a 00 00    	call   *0x4a7f(%rip)        # 5fc0 <__libc_start_main@GLIBC_2.34>
+    1541:	f4                   	hlt
+    1542:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1549:	00 00 00 
+    154c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001550 <deregister_tm_clones>:
+    1550:	    48 8d 3d 79 4b 00 00 	lea    0x4b79(%rip),%rdi        # 60d0 <__TMC_END__>
+    1557:	    48 8d 05 72 4b 00 00 	lea    0x4b72(%rip),%rax        # 60d0 <__TMC_END__>
+    155e:	    48 39 f8             	cmp    %rdi,%rax
+    1561:	/-- 74 15                	je     1578 <deregister_tm_clones+0x28>
+    1563:	|   48 8b 05 5e 4a 00 00 	mov    0x4a5e(%rip),%rax        # 5fc8 <_ITM_deregisterTMCloneTable@Base>
+    156a:	|   48 85 c0             	test   %rax,%rax
+    156d:	+-- 74 09                	je     1578 <deregister_tm_clones+0x28>
+    156f:	|   ff e0                	jmp    *%rax
+    1571:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1578:	\-> c3                   	ret
+    1579:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001580 <register_tm_clones>:
+    1580:	    48 8d 3d 49 4b 00 00 	lea    0x4b49(%rip),%rdi        # 60d0 <__TMC_END__>
+    1587:	    48 8d 35 42 4b 00 00 	lea    0x4b42(%rip),%rsi        # 60d0 <__TMC_END__>
+    158e:	    48 29 fe             	sub    %rdi,%rsi
+    1591:	    48 89 f0             	mov    %rsi,%rax
+    1594:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1598:	    48 c1 f8 03          	sar    $0x3,%rax
+    159c:	    48 01 c6             	add    %rax,%rsi
+    159f:	    48 d1 fe             	sar    %rsi
+    15a2:	/-- 74 14                	je     15b8 <register_tm_clones+0x38>
+    15a4:	|   48 8b 05 2d 4a 00 00 	mov    0x4a2d(%rip),%rax        # 5fd8 <_ITM_registerTMCloneTable@Base>
+    15ab:	|   48 85 c0             	test   %rax,%rax
+    15ae:	+-- 74 08                	je     15b8 <register_tm_clones+0x38>
+    15b0:	|   ff e0                	jmp    *%rax
+    15b2:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    15b8:	\-> c3                   	ret
+    15b9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000015c0 <__do_global_dtors_aux>:
+    15c0:	       f3 0f 1e fa          	endbr64
+    15c4:	       80 3d 1d 4b 00 00 00 	cmpb   $0x0,0x4b1d(%rip)        # 60e8 <completed.0>
+    15cb:	/----- 75 2b                	jne    15f8 <__do_global_dtors_aux+0x38>
+    15cd:	|      55                   	push   %rbp
+    15ce:	|      48 83 3d 0a 4a 00 00 	cmpq   $0x0,0x4a0a(%rip)        # 5fe0 <__cxa_finalize@GLIBC_2.2.5>
+    15d5:	|      00 
+    15d6:	|      48 89 e5             	mov    %rsp,%rbp
+    15d9:	|  /-- 74 0c                	je     15e7 <__do_global_dtors_aux+0x27>
+    15db:	|  |   48 8b 3d e6 4a 00 00 	mov    0x4ae6(%rip),%rdi        # 60c8 <__dso_handle>
+    15e2:	|  |   e8 c9 fb ff ff       	call   11b0 <__cxa_finalize@plt>
+    15e7:	|  \-> e8 64 ff ff ff       	call   1550 <deregister_tm_clones>
+    15ec:	|      c6 05 f5 4a 00 00 01 	movb   $0x1,0x4af5(%rip)        # 60e8 <completed.0>
+    15f3:	|      5d                   	pop    %rbp
+    15f4:	|      c3                   	ret
+    15f5:	|      0f 1f 00             	nopl   (%rax)
+    15f8:	\----> c3                   	ret
+    15f9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001600 <frame_dummy>:
+    1600:	f3 0f 1e fa          	endbr64
+    1604:	e9 77 ff ff ff       	jmp    1580 <register_tm_clones>
+    1609:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001610 <alloc(unsigned long)>:
+{
+    1610:	       55                   	push   %rbp
+    1611:	       48 89 f5             	mov    %rsi,%rbp
+    1614:	       53                   	push   %rbx
+    1615:	       48 89 fb             	mov    %rdi,%rbx
+    void *const p = nel::malloc_aligned(64, n_bytes);
+    1618:	       bf 40 00 00 00       	mov    $0x40,%edi
+{
+    161d:	       48 83 ec 28          	sub    $0x28,%rsp
+    void *const p = nel::malloc_aligned(64, n_bytes);
+    1621:	       e8 9a 10 00 00       	call   26c0 <nel::malloc_aligned(unsigned long, unsigned long)>
+    1626:	       48 8d 15 dd 29 00 00 	lea    0x29dd(%rip),%rdx        # 400a <_IO_stdin_used+0xa>
+    162d:	       48 8d 0d d0 29 00 00 	lea    0x29d0(%rip),%rcx        # 4004 <_IO_stdin_used+0x4>
+            , line_num_(line_num)
+    1634:	       c7 44 24 10 1f 00 00 	movl   $0x1f,0x10(%rsp)
+    163b:	       00 
+            : fn_name_(fn_name)
+    163c:	       66 48 0f 6e c1       	movq   %rcx,%xmm0
+    1641:	       66 48 0f 6e ca       	movq   %rdx,%xmm1
+    1646:	       66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    164a:	       0f 29 04 24          	movaps %xmm0,(%rsp)
+    if (pred) { panic(msg, ctx); }
+}
+
+inline void panic_if_not(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { panic(msg, ctx); }
+    164e:	       48 85 c0             	test   %rax,%rax
+    1651:	/----- 74 25                	je     1678 <alloc(unsigned long)+0x68>
+    auto s = nel::Slice<Word>(static_cast<Word *>(p), n_bytes / sizeof(Word));
+    1653:	|      48 c1 ed 03          	shr    $0x3,%rbp
+            : content_(p)
+    1657:	|      48 89 03             	mov    %rax,(%rbx)
+    for (nel::Index i = 0; i < s.len(); ++i) {
+    165a:	|      31 d2                	xor    %edx,%edx
+    auto s = nel::Slice<Word>(static_cast<Word *>(p), n_bytes / sizeof(Word));
+    165c:	|      48 89 6b 08          	mov    %rbp,0x8(%rbx)
+        s.ptr()[i] = i;
+    1660:	|  /-> 48 89 14 d0          	mov    %rdx,(%rax,%rdx,8)
+    for (nel::Index i = 0; i < s.len(); ++i) {
+    1664:	|  |   48 83 c2 01          	add    $0x1,%rdx
+    1668:	|  |   48 3b 53 08          	cmp    0x8(%rbx),%rdx
+    166c:	|  \-- 72 f2                	jb     1660 <alloc(unsigned long)+0x50>
+}
+    166e:	|      48 83 c4 28          	add    $0x28,%rsp
+    1672:	|      48 89 d8             	mov    %rbx,%rax
+    1675:	|      5b                   	pop    %rbx
+    1676:	|      5d                   	pop    %rbp
+    1677:	|      c3                   	ret
+    1678:	\----> 48 89 e6             	mov    %rsp,%rsi
+    167b:	       48 8d 3d a1 29 00 00 	lea    0x29a1(%rip),%rdi        # 4023 <_IO_stdin_used+0x23>
+    1682:	       e8 6b fb ff ff       	call   11f2 <nel::panic(char const*, nel::Context const&)>
+    1687:	       66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    168e:	       00 00 
+
+0000000000001690 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)>:
+            return run(n_chunks, &thunk<F>, &f);
+        }
+
+    private:
+        template<typename F>
+        static bool thunk(void *const ctx, Index const chunk)
+    1690:	                                     41 56                	push   %r14
+    1692:	                                     41 55                	push   %r13
+    1694:	                                     41 54                	push   %r12
+    1696:	                                     49 89 f4             	mov    %rsi,%r12
+    1699:	                                     55                   	push   %rbp
+    169a:	                                     53                   	push   %rbx
+    169b:	                                     48 89 fb             	mov    %rdi,%rbx
+    169e:	                                     48 83 ec 40          	sub    $0x40,%rsp
+        __atomic_fetch_add(&started, 1, __ATOMIC_RELAXED);
+    16a2:	                                     48 8b 07             	mov    (%rdi),%rax
+    16a5:	                                     f0 83 00 01          	lock addl $0x1,(%rax)
+        while (__atomic_load_n(&started, __ATOMIC_RELAXED) < 2) {
+    16a9:	                                     48 8b 17             	mov    (%rdi),%rdx
+    16ac:	                                     0f 1f 40 00          	nopl   0x0(%rax)
+    16b0:	                                 /-> 8b 02                	mov    (%rdx),%eax
+    16b2:	                                 |   83 f8 01             	cmp    $0x1,%eax
+    16b5:	                                 \-- 7e f9                	jle    16b0 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x20>
+        if (chunk == 0) {
+    16b7:	                                     4d 85 e4             	test   %r12,%r12
+    16ba:	      /----------------------------- 0f 85 50 01 00 00    	jne    1810 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x180>
+    16c0:	      |                              48 8d 05 6a 29 00 00 	lea    0x296a(%rip),%rax        # 4031 <_IO_stdin_used+0x31>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    16c7:	      |                              48 8d 6c 24 20       	lea    0x20(%rsp),%rbp
+    16cc:	      |                              bf 01 00 00 00       	mov    $0x1,%edi
+    16d1:	      |                              66 48 0f 6e c0       	movq   %rax,%xmm0
+    16d6:	      |                              48 8d 05 65 29 00 00 	lea    0x2965(%rip),%rax        # 4042 <_IO_stdin_used+0x42>
+    16dd:	      |                              48 89 ee             	mov    %rbp,%rsi
+    16e0:	      |                              66 48 0f 6e c8       	movq   %rax,%xmm1
+    16e5:	      |                              48 8d 05 6a 29 00 00 	lea    0x296a(%rip),%rax        # 4056 <_IO_stdin_used+0x56>
+    16ec:	      |                              66 48 0f 6e d0       	movq   %rax,%xmm2
+    16f1:	      |                              66 0f 6c c8          	punpcklqdq %xmm0,%xmm1
+    16f5:	      |                              66 0f 6c d0          	punpcklqdq %xmm0,%xmm2
+    16f9:	      |                              0f 29 4c 24 10       	movaps %xmm1,0x10(%rsp)
+    16fe:	      |                              0f 29 14 24          	movaps %xmm2,(%rsp)
+    1702:	      |                              e8 59 f9 ff ff       	call   1060 <clock_gettime@plt>
+                if (mode != Snap::None) { snapshot(b, mode == Snap::Streaming); }
+    1707:	      |                              48 8b 43 08          	mov    0x8(%rbx),%rax
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    170b:	      |                              4c 8b 6c 24 20       	mov    0x20(%rsp),%r13
+    1710:	      |                              4c 8b 74 24 28       	mov    0x28(%rsp),%r14
+    1715:	      |                              8b 08                	mov    (%rax),%ecx
+    1717:	      |              /-------------> 85 c9                	test   %ecx,%ecx
+    1719:	      |              |        /----- 75 45                	jne    1760 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0xd0>
+    171b:	      |              |  /-----|----> 4d 69 e5 00 ca 9a 3b 	imul   $0x3b9aca00,%r13,%r12
+    1722:	      |              |  |     |      4d 01 f4             	add    %r14,%r12
+    1725:	      |              |  |     |      0f 1f 00             	nopl   (%rax)
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1728:	      |              |  |     |  /-> 48 89 ee             	mov    %rbp,%rsi
+    172b:	      |              |  |     |  |   bf 01 00 00 00       	mov    $0x1,%edi
+    1730:	      |              |  |     |  |   e8 2b f9 ff ff       	call   1060 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1735:	      |              |  |     |  |   48 69 44 24 20 00 ca 	imul   $0x3b9aca00,0x20(%rsp),%rax
+    173c:	      |              |  |     |  |   9a 3b 
+    173e:	      |              |  |     |  |   48 03 44 24 28       	add    0x28(%rsp),%rax
+                while (bench::now_ns() - b_ns < n_snaps * n_state / 20) {
+    1743:	      |              |  |     |  |   4c 29 e0             	sub    %r12,%rax
+    1746:	      |              |  |     |  |   48 3d ff ff 1f 03    	cmp    $0x31fffff,%rax
+    174c:	      |              |  |     |  \-- 76 da                	jbe    1728 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x98>
+            __atomic_store_n(&done, true, __ATOMIC_RELEASE);
+    174e:	      |              |  |  /--|----> 48 8b 43 18          	mov    0x18(%rbx),%rax
+    1752:	      |              |  |  |  |      c6 00 01             	movb   $0x1,(%rax)
+    1755:	      |  /-----------|--|--|--|----- e9 4d 01 00 00       	jmp    18a7 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x217>
+    175a:	      |  |           |  |  |  |      66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1760:	      |  |           |  |  |  \----> 48 8b 43 10          	mov    0x10(%rbx),%rax
+    if (streaming) {
+    1764:	/-----|--|-----------|--|--|-------> 48 8b 78 10          	mov    0x10(%rax),%rdi
+    1768:	|     |  |           |  |  |         48 8b 50 18          	mov    0x18(%rax),%rdx
+    176c:	|     |  |           |  |  |         48 8b 30             	mov    (%rax),%rsi
+    176f:	|     |  |           |  |  |         4c 8b 40 08          	mov    0x8(%rax),%r8
+    1773:	|     |  |           |  |  |         83 f9 02             	cmp    $0x2,%ecx
+    1776:	|     |  |           |  |  |     /-- 75 50                	jne    17c8 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x138>
+            : fn_name_(fn_name)
+    1778:	|     |  |           |  |  |     |   66 0f 6f 5c 24 10    	movdqa 0x10(%rsp),%xmm3
+            , line_num_(line_num)
+    177e:	|     |  |           |  |  |     |   c7 44 24 30 5a 01 00 	movl   $0x15a,0x30(%rsp)
+    1785:	|     |  |           |  |  |     |   00 
+            : fn_name_(fn_name)
+    1786:	|     |  |           |  |  |     |   0f 29 5c 24 20       	movaps %xmm3,0x20(%rsp)
+    if (!pred) { panic(msg, ctx); }
+    178b:	|     |  |           |  |  |     |   4c 39 c2             	cmp    %r8,%rdx
+    178e:	|  /--|--|-----------|--|--|-----|-- 0f 85 61 01 00 00    	jne    18f5 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x265>
+ * @see copy(), copy_streaming()
+ */
+template<typename T>
+void copy_streaming(T d[], T const s[], Length const n)
+{
+    if (d == s) { return; }
+    1794:	|  |  |  |           |  |  |     |   48 39 f7             	cmp    %rsi,%rdi
+    1797:	|  |  |  |  /--------|--|--|-----|-- 0f 84 36 01 00 00    	je     18d3 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x243>
+    if constexpr (is_trivially_copyable<T>) {
+        copy_streaming(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t const *>(s),
+    179d:	|  |  |  |  |        |  |  |     |   48 c1 e2 03          	shl    $0x3,%rdx
+            for (nel::Index k = 0; k < n_snaps; ++k) {
+    17a1:	|  |  |  |  |        |  |  |     |   49 83 c4 01          	add    $0x1,%r12
+    17a5:	|  |  |  |  |        |  |  |     |   e8 a6 07 00 00       	call   1f50 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>
+            if (mode == Snap::None) {
+    17aa:	|  |  |  |  |        |  |  |     |   48 8b 43 08          	mov    0x8(%rbx),%rax
+    17ae:	|  |  |  |  |        |  |  |     |   8b 08                	mov    (%rax),%ecx
+            for (nel::Index k = 0; k < n_snaps; ++k) {
+    17b0:	|  |  |  |  |        |  |  |     |   49 83 fc 05          	cmp    $0x5,%r12
+    17b4:	|  |  |  |  |        +--|--|-----|-- 0f 85 5d ff ff ff    	jne    1717 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x87>
+            if (mode == Snap::None) {
+    17ba:	|  |  |  |  |  /-----|--|--|-----|-> 85 c9                	test   %ecx,%ecx
+    17bc:	|  |  |  |  |  |     |  |  \-----|-- 75 90                	jne    174e <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0xbe>
+    17be:	|  |  |  |  |  |     |  \--------|-- e9 58 ff ff ff       	jmp    171b <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x8b>
+    17c3:	|  |  |  |  |  |     |           |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+            : fn_name_(fn_name)
+    17c8:	|  |  |  |  |  |     |           \-> 66 0f 6f 24 24       	movdqa (%rsp),%xmm4
+            , line_num_(line_num)
+    17cd:	|  |  |  |  |  |     |               c7 44 24 30 44 01 00 	movl   $0x144,0x30(%rsp)
+    17d4:	|  |  |  |  |  |     |               00 
+            : fn_name_(fn_name)
+    17d5:	|  |  |  |  |  |     |               0f 29 64 24 20       	movaps %xmm4,0x20(%rsp)
+    if (!pred) { panic(msg, ctx); }
+    17da:	|  |  |  |  |  |     |               4c 39 c2             	cmp    %r8,%rdx
+    17dd:	|  |  |  |  |  |  /--|-------------- 0f 85 03 01 00 00    	jne    18e6 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x256>
+    if (d == s) { return; }
+    17e3:	|  |  |  |  |  |  |  |               48 39 f7             	cmp    %rsi,%rdi
+    17e6:	|  |  |  |  +--|--|--|-------------- 0f 84 e7 00 00 00    	je     18d3 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x243>
+        copy(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t const *>(s), n * sizeof(T));
+    17ec:	|  |  |  |  |  |  |  |               48 c1 e2 03          	shl    $0x3,%rdx
+            for (nel::Index k = 0; k < n_snaps; ++k) {
+    17f0:	|  |  |  |  |  |  |  |               49 83 c4 01          	add    $0x1,%r12
+    17f4:	|  |  |  |  |  |  |  |               e8 c7 06 00 00       	call   1ec0 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+            if (mode == Snap::None) {
+    17f9:	|  |  |  |  |  |  |  |               48 8b 43 08          	mov    0x8(%rbx),%rax
+    17fd:	|  |  |  |  |  |  |  |               8b 08                	mov    (%rax),%ecx
+            for (nel::Index k = 0; k < n_snaps; ++k) {
+    17ff:	|  |  |  |  |  |  |  |               49 83 fc 05          	cmp    $0x5,%r12
+    1803:	|  |  |  |  |  |  |  \-------------- 0f 85 0e ff ff ff    	jne    1717 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x87>
+    1809:	|  |  |  |  |  +--|----------------- eb af                	jmp    17ba <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x12a>
+    180b:	|  |  |  |  |  |  |                  0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1810:	|  |  \--|--|--|--|----------------> 48 8d 6c 24 20       	lea    0x20(%rsp),%rbp
+    1815:	|  |     |  |  |  |                  bf 01 00 00 00       	mov    $0x1,%edi
+    181a:	|  |     |  |  |  |                  48 89 ee             	mov    %rbp,%rsi
+    181d:	|  |     |  |  |  |                  e8 3e f8 ff ff       	call   1060 <clock_gettime@plt>
+            while (!__atomic_load_n(&done, __ATOMIC_ACQUIRE)) {
+    1822:	|  |     |  |  |  |                  48 8b 43 18          	mov    0x18(%rbx),%rax
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1826:	|  |     |  |  |  |                  4c 8b 6c 24 28       	mov    0x28(%rsp),%r13
+    182b:	|  |     |  |  |  |                  4c 69 64 24 20 00 ca 	imul   $0x3b9aca00,0x20(%rsp),%r12
+    1832:	|  |     |  |  |  |                  9a 3b 
+    1834:	|  |     |  |  |  |                  0f b6 00             	movzbl (%rax),%eax
+    1837:	|  |     |  |  |  |                  84 c0                	test   %al,%al
+    1839:	|  |     |  |  |  |        /-------- 75 44                	jne    187f <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x1ef>
+    183b:	|  |     |  |  |  |        |         0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+                if (mode != Snap::None) { snapshot(b, mode == Snap::Streaming); }
+    1840:	|  |     |  |  |  |        |  /----> 48 8b 43 10          	mov    0x10(%rbx),%rax
+            return len_;
+    1844:	|  |     |  |  |  |        |  |      48 8b 48 28          	mov    0x28(%rax),%rcx
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    1848:	|  |     |  |  |  |        |  |      48 85 c9             	test   %rcx,%rcx
+    184b:	|  |     |  |  |  |     /--|--|----- 74 73                	je     18c0 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x230>
+            return content_;
+    184d:	|  |     |  |  |  |     |  |  |      48 8b 70 20          	mov    0x20(%rax),%rsi
+    Word r = 0;
+    1851:	|  |     |  |  |  |     |  |  |      31 d2                	xor    %edx,%edx
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    1853:	|  |     |  |  |  |     |  |  |      31 c0                	xor    %eax,%eax
+    1855:	|  |     |  |  |  |     |  |  |      0f 1f 00             	nopl   (%rax)
+        r += work.ptr()[i];
+    1858:	|  |     |  |  |  |     |  |  |  /-> 48 03 14 c6          	add    (%rsi,%rax,8),%rdx
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    185c:	|  |     |  |  |  |     |  |  |  |   48 83 c0 08          	add    $0x8,%rax
+    1860:	|  |     |  |  |  |     |  |  |  |   48 39 c8             	cmp    %rcx,%rax
+    1863:	|  |     |  |  |  |     |  |  |  \-- 72 f3                	jb     1858 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x1c8>
+                r += touch(b.work);
+    1865:	|  |     |  |  |  |     |  |  |      48 8b 43 20          	mov    0x20(%rbx),%rax
+    1869:	|  |     |  |  |  |     |  |  |      48 01 10             	add    %rdx,(%rax)
+                passes += 1;
+    186c:	|  |     |  |  |  |     |  |  |      48 8b 43 28          	mov    0x28(%rbx),%rax
+    1870:	|  |     |  |  |  |     |  |  |      48 83 00 01          	addq   $0x1,(%rax)
+            while (!__atomic_load_n(&done, __ATOMIC_ACQUIRE)) {
+    1874:	|  |     |  |  |  |     |  |  |  /-> 48 8b 43 18          	mov    0x18(%rbx),%rax
+    1878:	|  |     |  |  |  |     |  |  |  |   0f b6 00             	movzbl (%rax),%eax
+    187b:	|  |     |  |  |  |     |  |  |  |   84 c0                	test   %al,%al
+    187d:	|  |     |  |  |  |     |  |  \--|-- 74 c1                	je     1840 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x1b0>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    187f:	|  |     |  |  |  |     |  \-----|-> 48 89 ee             	mov    %rbp,%rsi
+    1882:	|  |     |  |  |  |     |        |   bf 01 00 00 00       	mov    $0x1,%edi
+    1887:	|  |     |  |  |  |     |        |   e8 d4 f7 ff ff       	call   1060 <clock_gettime@plt>
+            t_neighbour = bench::now_ns() - b_ns;
+    188c:	|  |     |  |  |  |     |        |   48 8b 53 30          	mov    0x30(%rbx),%rdx
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1890:	|  |     |  |  |  |     |        |   48 69 44 24 20 00 ca 	imul   $0x3b9aca00,0x20(%rsp),%rax
+    1897:	|  |     |  |  |  |     |        |   9a 3b 
+    1899:	|  |     |  |  |  |     |        |   4c 29 e8             	sub    %r13,%rax
+    189c:	|  |     |  |  |  |     |        |   48 03 44 24 28       	add    0x28(%rsp),%rax
+    18a1:	|  |     |  |  |  |     |        |   4c 29 e0             	sub    %r12,%rax
+    18a4:	|  |     |  |  |  |     |        |   48 89 02             	mov    %rax,(%rdx)
+                return f(chunk);
+            } else {
+                f(chunk);
+                return true;
+            }
+        }
+    18a7:	|  |     \--|--|--|-----|--------|-> 48 83 c4 40          	add    $0x40,%rsp
+    18ab:	|  |        |  |  |     |        |   b8 01 00 00 00       	mov    $0x1,%eax
+    18b0:	|  |        |  |  |     |        |   5b                   	pop    %rbx
+    18b1:	|  |        |  |  |     |        |   5d                   	pop    %rbp
+    18b2:	|  |        |  |  |     |        |   41 5c                	pop    %r12
+    18b4:	|  |        |  |  |     |        |   41 5d                	pop    %r13
+    18b6:	|  |        |  |  |     |        |   41 5e                	pop    %r14
+    18b8:	|  |        |  |  |     |        |   c3                   	ret
+    18b9:	|  |        |  |  |     |        |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+                r += touch(b.work);
+    18c0:	|  |        |  |  |     \--------|-> 48 8b 43 20          	mov    0x20(%rbx),%rax
+    Word r = 0;
+    18c4:	|  |        |  |  |              |   31 d2                	xor    %edx,%edx
+                r += touch(b.work);
+    18c6:	|  |        |  |  |              |   48 01 10             	add    %rdx,(%rax)
+                passes += 1;
+    18c9:	|  |        |  |  |              |   48 8b 43 28          	mov    0x28(%rbx),%rax
+    18cd:	|  |        |  |  |              |   48 83 00 01          	addq   $0x1,(%rax)
+    18d1:	|  |        |  |  |              \-- eb a1                	jmp    1874 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x1e4>
+            for (nel::Index k = 0; k < n_snaps; ++k) {
+    18d3:	|  |        \--|--|----------------> 49 83 c4 01          	add    $0x1,%r12
+    18d7:	|  |           |  |                  49 83 fc 05          	cmp    $0x5,%r12
+    18db:	\--|-----------|--|----------------- 0f 85 83 fe ff ff    	jne    1764 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0xd4>
+    18e1:	   |           \--|----------------- e9 d4 fe ff ff       	jmp    17ba <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)+0x12a>
+    18e6:	   |              \----------------> 48 89 ee             	mov    %rbp,%rsi
+    18e9:	   |                                 48 8d 3d 88 28 00 00 	lea    0x2888(%rip),%rdi        # 4178 <_IO_stdin_used+0x178>
+    18f0:	   |                                 e8 fd f8 ff ff       	call   11f2 <nel::panic(char const*, nel::Context const&)>
+    18f5:	   \-------------------------------> 48 89 ee             	mov    %rbp,%rsi
+    18f8:	                                     48 8d 3d 41 28 00 00 	lea    0x2841(%rip),%rdi        # 4140 <_IO_stdin_used+0x140>
+    18ff:	                                     e8 ee f8 ff ff       	call   11f2 <nel::panic(char const*, nel::Context const&)>
+    1904:	                                     66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    190b:	                                     00 00 00 00 
+    190f:	                                     90                   	nop
+
+0000000000001910 <one_thread(Buffers&, bool, char const*)>:
+{
+    1910:	                      41 57                	push   %r15
+    1912:	                      48 8d 05 18 27 00 00 	lea    0x2718(%rip),%rax        # 4031 <_IO_stdin_used+0x31>
+    1919:	                      41 56                	push   %r14
+    191b:	                      66 48 0f 6e c0       	movq   %rax,%xmm0
+    1920:	                      48 8d 05 1b 27 00 00 	lea    0x271b(%rip),%rax        # 4042 <_IO_stdin_used+0x42>
+    1927:	                      41 55                	push   %r13
+    1929:	                      66 48 0f 6e c8       	movq   %rax,%xmm1
+    192e:	                      48 8d 05 21 27 00 00 	lea    0x2721(%rip),%rax        # 4056 <_IO_stdin_used+0x56>
+    long unsigned int t_copy = 0;
+    1935:	                      45 31 ed             	xor    %r13d,%r13d
+{
+    1938:	                      41 54                	push   %r12
+    193a:	                      66 48 0f 6e d0       	movq   %rax,%xmm2
+    193f:	                      66 0f 6c c8          	punpcklqdq %xmm0,%xmm1
+    1943:	                      55                   	push   %rbp
+    1944:	                      66 0f 6c d0          	punpcklqdq %xmm0,%xmm2
+    1948:	                      48 89 fd             	mov    %rdi,%rbp
+    194b:	                      53                   	push   %rbx
+    194c:	                      48 83 ec 78          	sub    $0x78,%rsp
+    1950:	                      48 89 54 24 48       	mov    %rdx,0x48(%rsp)
+    1955:	                      48 8d 5c 24 50       	lea    0x50(%rsp),%rbx
+    195a:	                      40 88 74 24 47       	mov    %sil,0x47(%rsp)
+    Word r = 0;
+    195f:	                      48 c7 44 24 18 05 00 	movq   $0x5,0x18(%rsp)
+    1966:	                      00 00 
+    Word r = 0;
+    1968:	                      48 c7 44 24 08 00 00 	movq   $0x0,0x8(%rsp)
+    196f:	                      00 00 
+    long unsigned int t_reread = 0;
+    1971:	                      48 c7 44 24 10 00 00 	movq   $0x0,0x10(%rsp)
+    1978:	                      00 00 
+    197a:	                      0f 29 4c 24 20       	movaps %xmm1,0x20(%rsp)
+    197f:	                      0f 29 54 24 30       	movaps %xmm2,0x30(%rsp)
+    for (nel::Index k = 0; k < n_snaps; ++k) {
+    1984:	                      0f 1f 40 00          	nopl   0x0(%rax)
+            return len_;
+    1988:	         /----------> 48 8b 55 28          	mov    0x28(%rbp),%rdx
+    Word r = 0;
+    198c:	         |            45 31 e4             	xor    %r12d,%r12d
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    198f:	         |            48 85 d2             	test   %rdx,%rdx
+    1992:	         |     /----- 74 19                	je     19ad <one_thread(Buffers&, bool, char const*)+0x9d>
+            return content_;
+    1994:	         |     |      48 8b 75 20          	mov    0x20(%rbp),%rsi
+    Word r = 0;
+    1998:	         |     |      45 31 e4             	xor    %r12d,%r12d
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    199b:	         |     |      31 c0                	xor    %eax,%eax
+    199d:	         |     |      0f 1f 00             	nopl   (%rax)
+        r += work.ptr()[i];
+    19a0:	         |     |  /-> 4c 03 24 c6          	add    (%rsi,%rax,8),%r12
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    19a4:	         |     |  |   48 83 c0 08          	add    $0x8,%rax
+    19a8:	         |     |  |   48 39 d0             	cmp    %rdx,%rax
+    19ab:	         |     |  \-- 72 f3                	jb     19a0 <one_thread(Buffers&, bool, char const*)+0x90>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    19ad:	         |     \----> 48 89 de             	mov    %rbx,%rsi
+    19b0:	         |            bf 01 00 00 00       	mov    $0x1,%edi
+    19b5:	         |            e8 a6 f6 ff ff       	call   1060 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    19ba:	         |            4c 8b 7c 24 58       	mov    0x58(%rsp),%r15
+    19bf:	         |            48 8b 7d 10          	mov    0x10(%rbp),%rdi
+    19c3:	         |            4c 69 74 24 50 00 ca 	imul   $0x3b9aca00,0x50(%rsp),%r14
+    19ca:	         |            9a 3b 
+    if (streaming) {
+    19cc:	         |            80 7c 24 47 00       	cmpb   $0x0,0x47(%rsp)
+    19d1:	         |            48 8b 55 18          	mov    0x18(%rbp),%rdx
+    19d5:	         |            48 8b 75 00          	mov    0x0(%rbp),%rsi
+    19d9:	      /--|----------- 0f 84 51 01 00 00    	je     1b30 <one_thread(Buffers&, bool, char const*)+0x220>
+            : fn_name_(fn_name)
+    19df:	      |  |            66 0f 6f 5c 24 20    	movdqa 0x20(%rsp),%xmm3
+            , line_num_(line_num)
+    19e5:	      |  |            c7 44 24 60 5a 01 00 	movl   $0x15a,0x60(%rsp)
+    19ec:	      |  |            00 
+            : fn_name_(fn_name)
+    19ed:	      |  |            0f 29 5c 24 50       	movaps %xmm3,0x50(%rsp)
+    if (!pred) { panic(msg, ctx); }
+    19f2:	      |  |            48 3b 55 08          	cmp    0x8(%rbp),%rdx
+    19f6:	/-----|--|----------- 0f 85 6b 01 00 00    	jne    1b67 <one_thread(Buffers&, bool, char const*)+0x257>
+    if (d == s) { return; }
+    19fc:	|     |  |            48 39 f7             	cmp    %rsi,%rdi
+    19ff:	|  /--|--|----------- 74 09                	je     1a0a <one_thread(Buffers&, bool, char const*)+0xfa>
+        copy_streaming(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t const *>(s),
+    1a01:	|  |  |  |            48 c1 e2 03          	shl    $0x3,%rdx
+    1a05:	|  |  |  |            e8 46 05 00 00       	call   1f50 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1a0a:	|  >--|--|----------> 48 89 de             	mov    %rbx,%rsi
+    1a0d:	|  |  |  |            bf 01 00 00 00       	mov    $0x1,%edi
+    1a12:	|  |  |  |            e8 49 f6 ff ff       	call   1060 <clock_gettime@plt>
+    1a17:	|  |  |  |            48 89 de             	mov    %rbx,%rsi
+    1a1a:	|  |  |  |            bf 01 00 00 00       	mov    $0x1,%edi
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1a1f:	|  |  |  |            48 69 44 24 50 00 ca 	imul   $0x3b9aca00,0x50(%rsp),%rax
+    1a26:	|  |  |  |            9a 3b 
+    1a28:	|  |  |  |            4c 29 f8             	sub    %r15,%rax
+    return now_ns() - b;
+    1a2b:	|  |  |  |            48 03 44 24 58       	add    0x58(%rsp),%rax
+    1a30:	|  |  |  |            4c 29 f0             	sub    %r14,%rax
+        t_copy += bench::time_ns([&b, streaming]() { snapshot(b, streaming); });
+    1a33:	|  |  |  |            49 01 c5             	add    %rax,%r13
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1a36:	|  |  |  |            e8 25 f6 ff ff       	call   1060 <clock_gettime@plt>
+            return len_;
+    1a3b:	|  |  |  |            48 8b 75 28          	mov    0x28(%rbp),%rsi
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1a3f:	|  |  |  |            4c 8b 7c 24 58       	mov    0x58(%rsp),%r15
+    1a44:	|  |  |  |            4c 69 74 24 50 00 ca 	imul   $0x3b9aca00,0x50(%rsp),%r14
+    1a4b:	|  |  |  |            9a 3b 
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    1a4d:	|  |  |  |            48 85 f6             	test   %rsi,%rsi
+    1a50:	|  |  |  |  /-------- 0f 84 0a 01 00 00    	je     1b60 <one_thread(Buffers&, bool, char const*)+0x250>
+            return content_;
+    1a56:	|  |  |  |  |         48 8b 7d 20          	mov    0x20(%rbp),%rdi
+    Word r = 0;
+    1a5a:	|  |  |  |  |         31 d2                	xor    %edx,%edx
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    1a5c:	|  |  |  |  |         31 c0                	xor    %eax,%eax
+    1a5e:	|  |  |  |  |         66 90                	xchg   %ax,%ax
+        r += work.ptr()[i];
+    1a60:	|  |  |  |  |     /-> 48 03 14 c7          	add    (%rdi,%rax,8),%rdx
+    for (nel::Index i = 0; i < work.len(); i += 64 / sizeof(Word)) {
+    1a64:	|  |  |  |  |     |   48 83 c0 08          	add    $0x8,%rax
+    1a68:	|  |  |  |  |     |   48 39 f0             	cmp    %rsi,%rax
+    1a6b:	|  |  |  |  |     \-- 72 f3                	jb     1a60 <one_thread(Buffers&, bool, char const*)+0x150>
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    1a6d:	|  |  |  |  |  /----> 48 89 de             	mov    %rbx,%rsi
+    1a70:	|  |  |  |  |  |      bf 01 00 00 00       	mov    $0x1,%edi
+        t_reread += bench::time_ns([&b, &r]() { r += touch(b.work); });
+    1a75:	|  |  |  |  |  |      4c 01 e2             	add    %r12,%rdx
+    1a78:	|  |  |  |  |  |      48 01 54 24 08       	add    %rdx,0x8(%rsp)
+    1a7d:	|  |  |  |  |  |      e8 de f5 ff ff       	call   1060 <clock_gettime@plt>
+    return (long unsigned int)ts.tv_sec * 1000000000UL + (long unsigned int)ts.tv_nsec;
+    1a82:	|  |  |  |  |  |      48 69 44 24 50 00 ca 	imul   $0x3b9aca00,0x50(%rsp),%rax
+    1a89:	|  |  |  |  |  |      9a 3b 
+    1a8b:	|  |  |  |  |  |      4c 29 f8             	sub    %r15,%rax
+    return now_ns() - b;
+    1a8e:	|  |  |  |  |  |      48 03 44 24 58       	add    0x58(%rsp),%rax
+    1a93:	|  |  |  |  |  |      4c 29 f0             	sub    %r14,%rax
+    1a96:	|  |  |  |  |  |      48 01 44 24 10       	add    %rax,0x10(%rsp)
+    for (nel::Index k = 0; k < n_snaps; ++k) {
+    1a9b:	|  |  |  |  |  |      48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+    1aa1:	|  |  |  \--|--|----- 0f 85 e1 fe ff ff    	jne    1988 <one_thread(Buffers&, bool, char const*)+0x78>
+    nel::log << name << '\n';
+    1aa7:	|  |  |     |  |      48 8b 74 24 48       	mov    0x48(%rsp),%rsi
+    1aac:	|  |  |     |  |      48 8d 1d 36 46 00 00 	lea    0x4636(%rip),%rbx        # 60e9 <nel::log>
+    1ab3:	|  |  |     |  |      48 89 df             	mov    %rbx,%rdi
+    1ab6:	|  |  |     |  |      e8 a5 0c 00 00       	call   2760 <nel::operator<<(nel::Log&, char const*)>
+    1abb:	|  |  |     |  |      be 0a 00 00 00       	mov    $0xa,%esi
+    1ac0:	|  |  |     |  |      48 89 c7             	mov    %rax,%rdi
+    1ac3:	|  |  |     |  |      e8 78 0c 00 00       	call   2740 <nel::operator<<(nel::Log&, char)>
+    bench::report("  snapshot        ", t_copy, n_snaps * n_state);
+    1ac8:	|  |  |     |  |      4c 89 ee             	mov    %r13,%rsi
+    1acb:	|  |  |     |  |      ba 00 00 80 3e       	mov    $0x3e800000,%edx
+    1ad0:	|  |  |     |  |      48 8d 3d 89 25 00 00 	lea    0x2589(%rip),%rdi        # 4060 <_IO_stdin_used+0x60>
+    1ad7:	|  |  |     |  |      e8 24 03 00 00       	call   1e00 <bench::report(char const*, unsigned long, unsigned long)>
+    bench::report("  re-read 4MB     ", t_reread, n_snaps * n_work);
+    1adc:	|  |  |     |  |      48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1ae1:	|  |  |     |  |      ba 00 00 40 01       	mov    $0x1400000,%edx
+    1ae6:	|  |  |     |  |      48 8d 3d 86 25 00 00 	lea    0x2586(%rip),%rdi        # 4073 <_IO_stdin_used+0x73>
+    1aed:	|  |  |     |  |      e8 0e 03 00 00       	call   1e00 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  sum: " << r << '\n';
+    1af2:	|  |  |     |  |      48 89 df             	mov    %rbx,%rdi
+    1af5:	|  |  |     |  |      48 8d 35 8a 25 00 00 	lea    0x258a(%rip),%rsi        # 4086 <_IO_stdin_used+0x86>
+    1afc:	|  |  |     |  |      e8 5f 0c 00 00       	call   2760 <nel::operator<<(nel::Log&, char const*)>
+    1b01:	|  |  |     |  |      48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    1b06:	|  |  |     |  |      48 89 c7             	mov    %rax,%rdi
+    1b09:	|  |  |     |  |      e8 12 0d 00 00       	call   2820 <nel::operator<<(nel::Log&, unsigned long)>
+}
+    1b0e:	|  |  |     |  |      48 83 c4 78          	add    $0x78,%rsp
+    nel::log << "  sum: " << r << '\n';
+    1b12:	|  |  |     |  |      be 0a 00 00 00       	mov    $0xa,%esi
+}
+    1b17:	|  |  |     |  |      5b                   	pop    %rbx
+    nel::log << "  sum: " << r << '\n';
+    1b18:	|  |  |     |  |      48 89 c7             	mov    %rax,%rdi
+}
+    1b1b:	|  |  |     |  |      5d                   	pop    %rbp
+    1b1c:	|  |  |     |  |      41 5c                	pop    %r12
+    1b1e:	|  |  |     |  |      41 5d                	pop    %r13
+    1b20:	|  |  |     |  |      41 5e                	pop    %r14
+    1b22:	|  |  |     |  |      41 5f                	pop    %r15
+    nel::log << "  sum: " << r << '\n';
+    1b24:	|  |  |     |  |      e9 17 0c 00 00       	jmp    2740 <nel::operator<<(nel::Log&, char)>
+    1b29:	|  |  |     |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            : fn_name_(fn_name)
+    1b30:	|  |  \-----|--|----> 66 0f 6f 64 24 30    	movdqa 0x30(%rsp),%xmm4
+            , line_num_(line_num)
+    1b36:	|  |        |  |      c7 44 24 60 44 01 00 	movl   $0x144,0x60(%rsp)
+    1b3d:	|  |        |  |      00 
+            : fn_name_(fn_name)
+    1b3e:	|  |        |  |      0f 29 64 24 50       	movaps %xmm4,0x50(%rsp)
+    if (!pred) { panic(msg, ctx); }
+    1b43:	|  |        |  |      48 3b 55 08          	cmp    0x8(%rbp),%rdx
+    1b47:	|  |        |  |  /-- 75 2d                	jne    1b76 <one_thread(Buffers&, bool, char const*)+0x266>
+    if (d == s) { return; }
+    1b49:	|  |        |  |  |   48 39 f7             	cmp    %rsi,%rdi
+    1b4c:	|  +--------|--|--|-- 0f 84 b8 fe ff ff    	je     1a0a <one_thread(Buffers&, bool, char const*)+0xfa>
+        copy(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t const *>(s), n * sizeof(T));
+    1b52:	|  |        |  |  |   48 c1 e2 03          	shl    $0x3,%rdx
+    1b56:	|  |        |  |  |   e8 65 03 00 00       	call   1ec0 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    1b5b:	|  \--------|--|--|-- e9 aa fe ff ff       	jmp    1a0a <one_thread(Buffers&, bool, char const*)+0xfa>
+    Word r = 0;
+    1b60:	|           \--|--|-> 31 d2                	xor    %edx,%edx
+    1b62:	|              \--|-- e9 06 ff ff ff       	jmp    1a6d <one_thread(Buffers&, bool, char const*)+0x15d>
+    1b67:	\-----------------|-> 48 89 de             	mov    %rbx,%rsi
+    1b6a:	                  |   48 8d 3d cf 25 00 00 	lea    0x25cf(%rip),%rdi        # 4140 <_IO_stdin_used+0x140>
+    1b71:	                  |   e8 7c f6 ff ff       	call   11f2 <nel::panic(char const*, nel::Context const&)>
+    1b76:	                  \-> 48 89 de             	mov    %rbx,%rsi
+    1b79:	                      48 8d 3d f8 25 00 00 	lea    0x25f8(%rip),%rdi        # 4178 <_IO_stdin_used+0x178>
+    1b80:	                      e8 6d f6 ff ff       	call   11f2 <nel::panic(char const*, nel::Context const&)>
+    1b85:	                      66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1b8c:	                      00 00 00 00 
+
+0000000000001b90 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)>:
+{
+    1b90:	       53                   	push   %rbx
+    1b91:	       48 89 cb             	mov    %rcx,%rbx
+    1b94:	       48 89 f8             	mov    %rdi,%rax
+    1b97:	       48 81 ec c0 00 00 00 	sub    $0xc0,%rsp
+    1b9e:	       89 54 24 0c          	mov    %edx,0xc(%rsp)
+    };
+    1ba2:	       48 8d 54 24 0c       	lea    0xc(%rsp),%rdx
+    1ba7:	       48 8d 4c 24 1c       	lea    0x1c(%rsp),%rcx
+    1bac:	       66 48 0f 6e ca       	movq   %rdx,%xmm1
+    1bb1:	       48 8d 54 24 1b       	lea    0x1b(%rsp),%rdx
+    1bb6:	       66 48 0f 6e c1       	movq   %rcx,%xmm0
+    1bbb:	       48 89 b4 24 90 00 00 	mov    %rsi,0x90(%rsp)
+    1bc2:	       00 
+    1bc3:	       48 89 94 24 98 00 00 	mov    %rdx,0x98(%rsp)
+    1bca:	       00 
+    1bcb:	       48 8d 54 24 30       	lea    0x30(%rsp),%rdx
+    1bd0:	       66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+            return run(n_chunks, &thunk<F>, &f);
+    1bd4:	       48 89 c6             	mov    %rax,%rsi
+    1bd7:	       48 89 94 24 a0 00 00 	mov    %rdx,0xa0(%rsp)
+    1bde:	       00 
+    1bdf:	       48 8d 54 24 20       	lea    0x20(%rsp),%rdx
+    1be4:	       48 8d 0d a5 fa ff ff 	lea    -0x55b(%rip),%rcx        # 1690 <bool nel::par::Pool::thunk<two_threads(nel::par::Pool&, Buffers&, Snap, char const*)::{lambda(unsigned long)#1}&>(void*, unsigned long)>
+    1beb:	       48 89 94 24 a8 00 00 	mov    %rdx,0xa8(%rsp)
+    1bf2:	       00 
+    1bf3:	       48 8d 54 24 28       	lea    0x28(%rsp),%rdx
+    1bf8:	       48 8d 7c 24 38       	lea    0x38(%rsp),%rdi
+    1bfd:	       48 89 94 24 b0 00 00 	mov    %rdx,0xb0(%rsp)
+    1c04:	       00 
+    1c05:	       4c 8d 84 24 80 00 00 	lea    0x80(%rsp),%r8
+    1c0c:	       00 
+    1c0d:	       ba 02 00 00 00       	mov    $0x2,%edx
+    1c12:	       0f 29 84 24 80 00 00 	movaps %xmm0,0x80(%rsp)
+    1c19:	       00 
+    int started = 0;
+    1c1a:	       c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%rsp)
+    1c21:	       00 
+    bool done = false;
+    1c22:	       c6 44 24 1b 00       	movb   $0x0,0x1b(%rsp)
+    nel::Count passes = 0;
+    1c27:	       48 c7 44 24 20 00 00 	movq   $0x0,0x20(%rsp)
+    1c2e:	       00 00 
+    long unsigned int t_neighbour = 0;
+    1c30:	       48 c7 44 24 28 00 00 	movq   $0x0,0x28(%rsp)
+    1c37:	       00 00 
+    Word r = 0;
+    1c39:	       48 c7 44 24 30 00 00 	movq   $0x0,0x30(%rsp)
+    1c40:	       00 00 
+    1c42:	       e8 69 12 00 00       	call   2eb0 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)>
+            : fn_name_(fn_name)
+    1c47:	       48 8d 05 bc 23 00 00 	lea    0x23bc(%rip),%rax        # 400a <_IO_stdin_used+0xa>
+    1c4e:	       48 8d 0d 39 24 00 00 	lea    0x2439(%rip),%rcx        # 408e <_IO_stdin_used+0x8e>
+            , line_num_(line_num)
+    1c55:	       c7 44 24 50 7d 00 00 	movl   $0x7d,0x50(%rsp)
+    1c5c:	       00 
+            : fn_name_(fn_name)
+    1c5d:	       66 48 0f 6e d0       	movq   %rax,%xmm2
+    1c62:	       66 48 0f 6e c1       	movq   %rcx,%xmm0
+        }
+
+        template<typename Fn1, typename Fn2>
+        constexpr void consumev(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+        {
+            auto tag = tag_;
+    1c67:	       8b 44 24 38          	mov    0x38(%rsp),%eax
+            tag_ = Tag::INVAL;
+    1c6b:	       c7 44 24 38 00 00 00 	movl   $0x0,0x38(%rsp)
+    1c72:	       00 
+    1c73:	       66 0f 6c c2          	punpcklqdq %xmm2,%xmm0
+    1c77:	       0f 29 44 24 40       	movaps %xmm0,0x40(%rsp)
+            switch (tag) { // result<void>-consume
+    1c7c:	       83 f8 01             	cmp    $0x1,%eax
+    1c7f:	   /-- 0f 85 87 00 00 00    	jne    1d0c <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)+0x17c>
+    nel::log << name << '\n';
+    1c85:	   |   48 89 de             	mov    %rbx,%rsi
+    1c88:	   |   48 8d 1d 5a 44 00 00 	lea    0x445a(%rip),%rbx        # 60e9 <nel::log>
+    1c8f:	   |   48 89 df             	mov    %rbx,%rdi
+    1c92:	   |   e8 c9 0a 00 00       	call   2760 <nel::operator<<(nel::Log&, char const*)>
+    1c97:	   |   be 0a 00 00 00       	mov    $0xa,%esi
+    1c9c:	   |   48 89 c7             	mov    %rax,%rdi
+    1c9f:	   |   e8 9c 0a 00 00       	call   2740 <nel::operator<<(nel::Log&, char)>
+    bench::report("  neighbour 4MB   ", t_neighbour, passes * n_work);
+    1ca4:	   |   48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+    1ca9:	   |   48 8b 74 24 28       	mov    0x28(%rsp),%rsi
+    1cae:	   |   48 8d 3d 26 24 00 00 	lea    0x2426(%rip),%rdi        # 40db <_IO_stdin_used+0xdb>
+    1cb5:	   |   48 c1 e2 16          	shl    $0x16,%rdx
+    1cb9:	   |   e8 42 01 00 00       	call   1e00 <bench::report(char const*, unsigned long, unsigned long)>
+    nel::log << "  passes: " << passes << " sum: " << r << '\n';
+    1cbe:	   |   48 89 df             	mov    %rbx,%rdi
+    1cc1:	   |   48 8d 35 26 24 00 00 	lea    0x2426(%rip),%rsi        # 40ee <_IO_stdin_used+0xee>
+    1cc8:	   |   e8 93 0a 00 00       	call   2760 <nel::operator<<(nel::Log&, char const*)>
+    1ccd:	   |   48 8b 74 24 20       	mov    0x20(%rsp),%rsi
+    1cd2:	   |   48 89 c7             	mov    %rax,%rdi
+    1cd5:	   |   e8 46 0b 00 00       	call   2820 <nel::operator<<(nel::Log&, unsigned long)>
+    1cda:	   |   48 8d 35 a6 23 00 00 	lea    0x23a6(%rip),%rsi        # 4087 <_IO_stdin_used+0x87>
+    1ce1:	   |   48 89 c7             	mov    %rax,%rdi
+    1ce4:	   |   e8 77 0a 00 00       	call   2760 <nel::operator<<(nel::Log&, char const*)>
+    1ce9:	   |   48 8b 74 24 30       	mov    0x30(%rsp),%rsi
+    1cee:	   |   48 89 c7             	mov    %rax,%rdi
+    1cf1:	   |   e8 2a 0b 00 00       	call   2820 <nel::operator<<(nel::Log&, unsigned long)>
+    1cf6:	   |   be 0a 00 00 00       	mov    $0xa,%esi
+    1cfb:	   |   48 89 c7             	mov    %rax,%rdi
+    1cfe:	   |   e8 3d 0a 00 00       	call   2740 <nel::operator<<(nel::Log&, char)>
+}
+    1d03:	   |   48 81 c4 c0 00 00 00 	add    $0xc0,%rsp
+    1d0a:	   |   5b                   	pop    %rbx
+    1d0b:	   |   c3                   	ret
+    1d0c:	   \-> 83 f8 02             	cmp    $0x2,%eax
+    1d0f:	   /-- 74 15                	je     1d26 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)+0x196>
+    1d11:	   |   85 c0                	test   %eax,%eax
+    1d13:	/--|-- 74 4b                	je     1d60 <two_threads(nel::par::Pool&, Buffers&, Snap, char const*)+0x1d0>
+                    // if they do it's a use-after-move-from op so must panic.
+                    // or a use-before-initialised so again must panic.
+                    nel::panic("invalid Result", ctx);
+                    break;
+                default:
+                    nel::panic("bad Result", ctx);
+    1d15:	|  |   48 8d 74 24 40       	lea    0x40(%rsp),%rsi
+    1d1a:	|  |   48 8d 3d af 23 00 00 	lea    0x23af(%rip),%rdi        # 40d0 <_IO_stdin_used+0xd0>
+    1d21:	|  |   e8 cc f4 ff ff       	call   11f2 <nel::panic(char const*, nel::Context const&)>
+    1d26:	|  \-> 48 8d 05 78 23 00 00 	lea    0x2378(%rip),%rax        # 40a5 <_IO_stdin_used+0xa5>
+    1d2d:	|      48 8d 1d 66 23 00 00 	lea    0x2366(%rip),%rbx        # 409a <_IO_stdin_used+0x9a>
+            , line_num_(line_num)
+    1d34:	|      c7 44 24 70 1f 04 00 	movl   $0x41f,0x70(%rsp)
+    1d3b:	|      00 
+            : fn_name_(fn_name)
+    1d3c:	|      66 48 0f 6e c3       	movq   %rbx,%xmm0
+    1d41:	|      66 48 0f 6e d8       	movq   %rax,%xmm3
+         *
+         * `this` is consumed by the operation.
+         */
+        constexpr void unwrap(Context const &ctx = Context())
+        {
+            return consumev([](void) {}, [](E &&) { nel::panic("not an ok"); }, ctx);
+    1d46:	|      48 8d 74 24 60       	lea    0x60(%rsp),%rsi
+    1d4b:	|      66 0f 6c c3          	punpcklqdq %xmm3,%xmm0
+    1d4f:	|      48 8d 3d 61 23 00 00 	lea    0x2361(%rip),%rdi        # 40b7 <_IO_stdin_used+0xb7>
+    1d56:	|      0f 29 44 24 60       	movaps %xmm0,0x60(%rsp)
+    1d5b:	|      e8 92 f4 ff ff       	call   11f2 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("invalid Result", ctx);
+    1d60:	\----> 48 8d 74 24 40       	lea    0x40(%rsp),%rsi
+    1d65:	       48 8d 3d 55 23 00 00 	lea    0x2355(%rip),%rdi        # 40c1 <_IO_stdin_used+0xc1>
+    1d6c:	       e8 81 f4 ff ff       	call   11f2 <nel::panic(char const*, nel::Context const&)>
+    1d71:	       66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1d78:	       00 00 00 00 
+    1d7c:	       0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001d80 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    1d80:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1d85:	c3                   	ret
+    1d86:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1d8d:	00 00 00 
+
+0000000000001d90 <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    1d90:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1d95:	c3                   	ret
+    1d96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1d9d:	00 00 00 
+
+0000000000001da0 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    1da0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1da5:	c3                   	ret
+    1da6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1dad:	00 00 00 
+
+0000000000001db0 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    1db0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1db5:	c3                   	ret
+    1db6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1dbd:	00 00 00 
+
+0000000000001dc0 <_read_r>:
+int _read_r(struct _reent *, int) {
+    1dc0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1dc5:	c3                   	ret
+    1dc6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1dcd:	00 00 00 
+
+0000000000001dd0 <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    1dd0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1dd5:	c3                   	ret
+    1dd6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1ddd:	00 00 00 
+
+0000000000001de0 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    1de0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1de5:	c3                   	ret
+    1de6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1ded:	00 00 00 
+
+0000000000001df0 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1df0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1df5:	c3                   	ret
+    1df6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1dfd:	00 00 00 
+
+0000000000001e00 <bench::report(char const*, unsigned long, unsigned long)>:
+}
+
+// Log a result line: name, time and (if bytes given) bandwidth.
+inline void report(char const *const name, long unsigned int const ns,
+                   long unsigned int const bytes = 0)
+{
+    1e00:	       41 54                	push   %r12
+    nel::log << name << ": " << ns / 1000UL << "us";
+    1e02:	       4c 8d 25 e0 42 00 00 	lea    0x42e0(%rip),%r12        # 60e9 <nel::log>
+{
+    1e09:	       55                   	push   %rbp
+    1e0a:	       48 89 f5             	mov    %rsi,%rbp
+    nel::log << name << ": " << ns / 1000UL << "us";
+    1e0d:	       48 89 fe             	mov    %rdi,%rsi
+    1e10:	       4c 89 e7             	mov    %r12,%rdi
+{
+    1e13:	       53                   	push   %rbx
+    1e14:	       48 89 d3             	mov    %rdx,%rbx
+    nel::log << name << ": " << ns / 1000UL << "us";
+    1e17:	       e8 44 09 00 00       	call   2760 <nel::operator<<(nel::Log&, char const*)>
+    1e1c:	       48 8d 35 68 22 00 00 	lea    0x2268(%rip),%rsi        # 408b <_IO_stdin_used+0x8b>
+    1e23:	       48 89 c7             	mov    %rax,%rdi
+    1e26:	       e8 35 09 00 00       	call   2760 <nel::operator<<(nel::Log&, char const*)>
+    1e2b:	       48 89 ea             	mov    %rbp,%rdx
+    1e2e:	       48 89 c7             	mov    %rax,%rdi
+    1e31:	       48 c1 ea 03          	shr    $0x3,%rdx
+    1e35:	       48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+    1e3c:	       9b c4 20 
+    1e3f:	       48 f7 e2             	mul    %rdx
+    1e42:	       48 c1 ea 04          	shr    $0x4,%rdx
+    1e46:	       48 89 d6             	mov    %rdx,%rsi
+    1e49:	       e8 d2 09 00 00       	call   2820 <nel::operator<<(nel::Log&, unsigned long)>
+    1e4e:	       48 8d 35 c3 23 00 00 	lea    0x23c3(%rip),%rsi        # 4218 <_IO_stdin_used+0x218>
+    1e55:	       48 89 c7             	mov    %rax,%rdi
+    1e58:	       e8 03 09 00 00       	call   2760 <nel::operator<<(nel::Log&, char const*)>
+    if (bytes != 0 && ns != 0) {
+    1e5d:	       48 85 db             	test   %rbx,%rbx
+    1e60:	/----- 74 05                	je     1e67 <bench::report(char const*, unsigned long, unsigned long)+0x67>
+    1e62:	|      48 85 ed             	test   %rbp,%rbp
+    1e65:	|  /-- 75 19                	jne    1e80 <bench::report(char const*, unsigned long, unsigned long)+0x80>
+        // bytes/ns == GB/s, scaled to MB/s
+        nel::log << ", " << (bytes * 1000UL) / ns << "MB/s";
+    }
+    nel::log << '\n';
+}
+    1e67:	>--|-> 5b                   	pop    %rbx
+    nel::log << '\n';
+    1e68:	|  |   4c 89 e7             	mov    %r12,%rdi
+}
+    1e6b:	|  |   5d                   	pop    %rbp
+    nel::log << '\n';
+    1e6c:	|  |   be 0a 00 00 00       	mov    $0xa,%esi
+}
+    1e71:	|  |   41 5c                	pop    %r12
+    nel::log << '\n';
+    1e73:	|  |   e9 c8 08 00 00       	jmp    2740 <nel::operator<<(nel::Log&, char)>
+    1e78:	|  |   0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    1e7f:	|  |   00 
+        nel::log << ", " << (bytes * 1000UL) / ns << "MB/s";
+    1e80:	|  \-> 4c 89 e7             	mov    %r12,%rdi
+    1e83:	|      48 8d 35 91 23 00 00 	lea    0x2391(%rip),%rsi        # 421b <_IO_stdin_used+0x21b>
+    1e8a:	|      e8 d1 08 00 00       	call   2760 <nel::operator<<(nel::Log&, char const*)>
+    1e8f:	|      31 d2                	xor    %edx,%edx
+    1e91:	|      48 89 c7             	mov    %rax,%rdi
+    1e94:	|      48 69 c3 e8 03 00 00 	imul   $0x3e8,%rbx,%rax
+    1e9b:	|      48 f7 f5             	div    %rbp
+    1e9e:	|      48 89 c6             	mov    %rax,%rsi
+    1ea1:	|      e8 7a 09 00 00       	call   2820 <nel::operator<<(nel::Log&, unsigned long)>
+    1ea6:	|      48 8d 35 71 23 00 00 	lea    0x2371(%rip),%rsi        # 421e <_IO_stdin_used+0x21e>
+    1ead:	|      48 89 c7             	mov    %rax,%rdi
+    1eb0:	|      e8 ab 08 00 00       	call   2760 <nel::operator<<(nel::Log&, char const*)>
+    1eb5:	\----- eb b0                	jmp    1e67 <bench::report(char const*, unsigned long, unsigned long)+0x67>
+    1eb7:	       66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    1ebe:	       00 00 
+
+0000000000001ec0 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    1ec0:	e9 2b f2 ff ff       	jmp    10f0 <memcpy@plt>
+    1ec5:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1ecc:	00 00 00 00 
+
+0000000000001ed0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    1ed0:	40 0f b6 f6          	movzbl %sil,%esi
+    1ed4:	e9 c7 f1 ff ff       	jmp    10a0 <memset@plt>
+    1ed9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001ee0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+}
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    1ee0:	e9 0b f2 ff ff       	jmp    10f0 <memcpy@plt>
+    1ee5:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1eec:	00 00 00 00 
+
+0000000000001ef0 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    1ef0:	e9 5b f2 ff ff       	jmp    1150 <memmove@plt>
+    1ef5:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1efc:	00 00 00 00 
+
+0000000000001f00 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    1f00:	48 89 f2             	mov    %rsi,%rdx
+    std::memset(d, s, n);
+    1f03:	be a5 00 00 00       	mov    $0xa5,%esi
+    1f08:	e9 93 f1 ff ff       	jmp    10a0 <memset@plt>
+    1f0d:	0f 1f 00             	nopl   (%rax)
+
+0000000000001f10 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+    set(d, 0xa5, n);
+}
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1f10:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    1f14:	e8 a7 f1 ff ff       	call   10c0 <memcmp@plt>
+    1f19:	85 c0                	test   %eax,%eax
+    1f1b:	0f 94 c0             	sete   %al
+}
+    1f1e:	48 83 c4 08          	add    $0x8,%rsp
+    1f22:	c3                   	ret
+    1f23:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1f2a:	00 00 00 00 
+    1f2e:	66 90                	xchg   %ax,%ax
+
+0000000000001f30 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1f30:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    1f34:	e8 87 f1 ff ff       	call   10c0 <memcmp@plt>
+    1f39:	85 c0                	test   %eax,%eax
+    1f3b:	0f 95 c0             	setne  %al
+}
+    1f3e:	48 83 c4 08          	add    $0x8,%rsp
+    1f42:	c3                   	ret
+    1f43:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1f4a:	00 00 00 00 
+    1f4e:	66 90                	xchg   %ax,%ax
+
+0000000000001f50 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    if (n < streaming_min) {
+    1f50:	                48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1f57:	/-------------- 0f 86 d7 00 00 00    	jbe    2034 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xe4>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1f5d:	|               48 89 f9             	mov    %rdi,%rcx
+{
+    1f60:	|               53                   	push   %rbx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1f61:	|               48 f7 d9             	neg    %rcx
+    1f64:	|               83 e1 0f             	and    $0xf,%ecx
+    std::memcpy(d, s, n);
+    1f67:	|               83 f9 08             	cmp    $0x8,%ecx
+    1f6a:	|     /-------- 0f 82 d0 00 00 00    	jb     2040 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xf0>
+    1f70:	|     |         48 8b 06             	mov    (%rsi),%rax
+    1f73:	|     |         4c 8d 57 08          	lea    0x8(%rdi),%r10
+    1f77:	|     |         48 89 f3             	mov    %rsi,%rbx
+    1f7a:	|     |         49 83 e2 f8          	and    $0xfffffffffffffff8,%r10
+    1f7e:	|     |         48 89 07             	mov    %rax,(%rdi)
+    1f81:	|     |         48 8b 44 0e f8       	mov    -0x8(%rsi,%rcx,1),%rax
+    1f86:	|     |         48 89 44 0f f8       	mov    %rax,-0x8(%rdi,%rcx,1)
+    1f8b:	|     |         48 89 f8             	mov    %rdi,%rax
+    1f8e:	|     |         4c 29 d0             	sub    %r10,%rax
+    1f91:	|     |         48 29 c3             	sub    %rax,%rbx
+    1f94:	|     |         01 c8                	add    %ecx,%eax
+    1f96:	|     |         83 e0 f8             	and    $0xfffffff8,%eax
+    1f99:	|     |         83 f8 08             	cmp    $0x8,%eax
+    1f9c:	|  /--|-------- 72 1a                	jb     1fb8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    1f9e:	|  |  |         83 e0 f8             	and    $0xfffffff8,%eax
+    1fa1:	|  |  |         45 31 c0             	xor    %r8d,%r8d
+    1fa4:	|  |  |     /-> 45 89 c1             	mov    %r8d,%r9d
+    1fa7:	|  |  |     |   41 83 c0 08          	add    $0x8,%r8d
+    1fab:	|  |  |     |   4e 8b 1c 0b          	mov    (%rbx,%r9,1),%r11
+    1faf:	|  |  |     |   4f 89 1c 0a          	mov    %r11,(%r10,%r9,1)
+    1fb3:	|  |  |     |   41 39 c0             	cmp    %eax,%r8d
+    1fb6:	|  |  |     \-- 72 ec                	jb     1fa4 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x54>
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1fb8:	|  >--|-------> 48 8d 41 40          	lea    0x40(%rcx),%rax
+    1fbc:	|  |  |         48 01 f9             	add    %rdi,%rcx
+    1fbf:	|  |  |         90                   	nop
+    std::memcpy(&v, s, sizeof(v));
+    1fc0:	|  |  |     /-> f3 0f 6f 54 06 d0    	movdqu -0x30(%rsi,%rax,1),%xmm2
+    1fc6:	|  |  |     |   f3 0f 6f 4c 06 e0    	movdqu -0x20(%rsi,%rax,1),%xmm1
+    1fcc:	|  |  |     |   49 89 c0             	mov    %rax,%r8
+    for (; i + 64 <= n; i += 64) {
+    1fcf:	|  |  |     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1fd3:	|  |  |     |   f3 0f 6f 44 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1fd9:	|  |  |     |   f3 0f 6f 5c 06 c0    	movdqu -0x40(%rsi,%rax,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    1fdf:	|  |  |     |   48 83 c0 40          	add    $0x40,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1fe3:	|  |  |     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    1fe8:	|  |  |     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    1fed:	|  |  |     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    1ff2:	|  |  |     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    1ff7:	|  |  |     |   48 39 c2             	cmp    %rax,%rdx
+    1ffa:	|  |  |     \-- 73 c4                	jae    1fc0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x70>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    1ffc:	|  |  |         49 8d 40 10          	lea    0x10(%r8),%rax
+    2000:	|  |  |         48 39 c2             	cmp    %rax,%rdx
+    2003:	|  |  |  /----- 72 22                	jb     2027 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd7>
+    2005:	|  |  |  |      48 8d 4f f0          	lea    -0x10(%rdi),%rcx
+    2009:	|  |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2010:	|  |  |  |  /-> f3 0f 6f 64 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm4
+    2016:	|  |  |  |  |   49 89 c0             	mov    %rax,%r8
+    2019:	|  |  |  |  |   66 0f e7 24 01       	movntdq %xmm4,(%rcx,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    201e:	|  |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    2022:	|  |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    2025:	|  |  |  |  \-- 73 e9                	jae    2010 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc0>
+        stream16(d + i, load16(s + i));
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    2027:	|  |  |  \----> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    202a:	|  |  |         4c 01 c7             	add    %r8,%rdi
+    202d:	|  |  |         4c 29 c2             	sub    %r8,%rdx
+    2030:	|  |  |         4c 01 c6             	add    %r8,%rsi
+}
+    2033:	|  |  |         5b                   	pop    %rbx
+    std::memcpy(d, s, n);
+    2034:	\--|--|-------> e9 b7 f0 ff ff       	jmp    10f0 <memcpy@plt>
+    2039:	   |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    2040:	   |  \-------> f6 c1 04             	test   $0x4,%cl
+    2043:	   |        /-- 75 25                	jne    206a <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x11a>
+    2045:	   |        |   85 c9                	test   %ecx,%ecx
+    2047:	   +--------|-- 0f 84 6b ff ff ff    	je     1fb8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    204d:	   |        |   0f b6 06             	movzbl (%rsi),%eax
+    2050:	   |        |   88 07                	mov    %al,(%rdi)
+    2052:	   |        |   f6 c1 02             	test   $0x2,%cl
+    2055:	   +--------|-- 0f 84 5d ff ff ff    	je     1fb8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    205b:	   |        |   0f b7 44 0e fe       	movzwl -0x2(%rsi,%rcx,1),%eax
+    2060:	   |        |   66 89 44 0f fe       	mov    %ax,-0x2(%rdi,%rcx,1)
+    2065:	   +--------|-- e9 4e ff ff ff       	jmp    1fb8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    206a:	   |        \-> 8b 06                	mov    (%rsi),%eax
+    206c:	   |            89 07                	mov    %eax,(%rdi)
+    206e:	   |            8b 44 0e fc          	mov    -0x4(%rsi,%rcx,1),%eax
+    2072:	   |            89 44 0f fc          	mov    %eax,-0x4(%rdi,%rcx,1)
+    2076:	   \----------- e9 3d ff ff ff       	jmp    1fb8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    207b:	                0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000002080 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    2080:	                                           49 89 f8             	mov    %rdi,%r8
+    2083:	                                           48 89 f1             	mov    %rsi,%rcx
+    if (n < streaming_min) {
+    2086:	                                           48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    208d:	                              /----------- 0f 86 85 03 00 00    	jbe    2418 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x398>
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2093:	                              |            48 89 fe             	mov    %rdi,%rsi
+{
+    2096:	                              |            41 57                	push   %r15
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2098:	                              |            48 f7 de             	neg    %rsi
+{
+    209b:	                              |            41 56                	push   %r14
+    for (Index i = 0; i < head; ++i) {
+    209d:	                              |            48 89 f0             	mov    %rsi,%rax
+{
+    20a0:	                              |            41 55                	push   %r13
+    20a2:	                              |            41 54                	push   %r12
+    20a4:	                              |            55                   	push   %rbp
+    20a5:	                              |            53                   	push   %rbx
+    for (Index i = 0; i < head; ++i) {
+    20a6:	                              |            83 e0 0f             	and    $0xf,%eax
+    20a9:	/-----------------------------|----------- 0f 84 01 01 00 00    	je     21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    20af:	|                             |            48 8d 78 ff          	lea    -0x1(%rax),%rdi
+    20b3:	|                             |            48 83 ff 02          	cmp    $0x2,%rdi
+    20b7:	|  /--------------------------|----------- 0f 86 8a 04 00 00    	jbe    2547 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4c7>
+    20bd:	|  |                          |            4c 8d 51 01          	lea    0x1(%rcx),%r10
+    20c1:	|  |                          |            4d 89 c1             	mov    %r8,%r9
+    20c4:	|  |                          |            4d 29 d1             	sub    %r10,%r9
+    20c7:	|  |                          |            49 83 f9 06          	cmp    $0x6,%r9
+    20cb:	|  |                          |  /-------- 0f 87 c7 02 00 00    	ja     2398 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x318>
+        d[i] = p[i];
+    20d1:	|  |                          |  |         0f b6 39             	movzbl (%rcx),%edi
+    20d4:	|  |                          |  |         41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    20d7:	|  |                          |  |         40 f6 c6 0e          	test   $0xe,%sil
+    20db:	+--|--------------------------|--|-------- 0f 84 cf 00 00 00    	je     21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    20e1:	|  |                          |  |         0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    20e5:	|  |                          |  |         41 88 78 01          	mov    %dil,0x1(%r8)
+    20e9:	|  |  /-----------------------|--|-------> 0f b6 79 02          	movzbl 0x2(%rcx),%edi
+    20ed:	|  |  |                       |  |         41 88 78 02          	mov    %dil,0x2(%r8)
+    for (Index i = 0; i < head; ++i) {
+    20f1:	|  |  |                       |  |         40 f6 c6 0c          	test   $0xc,%sil
+    20f5:	+--|--|-----------------------|--|-------- 0f 84 b5 00 00 00    	je     21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    20fb:	|  |  |                       |  |         0f b6 79 03          	movzbl 0x3(%rcx),%edi
+    20ff:	|  |  |                       |  |         41 88 78 03          	mov    %dil,0x3(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2103:	|  |  |                       |  |         48 83 f8 04          	cmp    $0x4,%rax
+    2107:	+--|--|-----------------------|--|-------- 0f 86 a3 00 00 00    	jbe    21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    210d:	|  |  |                       |  |         0f b6 79 04          	movzbl 0x4(%rcx),%edi
+    2111:	|  |  |                       |  |         41 88 78 04          	mov    %dil,0x4(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2115:	|  |  |                       |  |         48 83 f8 05          	cmp    $0x5,%rax
+    2119:	+--|--|-----------------------|--|-------- 0f 84 91 00 00 00    	je     21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    211f:	|  |  |                       |  |         0f b6 79 05          	movzbl 0x5(%rcx),%edi
+    2123:	|  |  |                       |  |         41 88 78 05          	mov    %dil,0x5(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2127:	|  |  |                       |  |         48 83 f8 06          	cmp    $0x6,%rax
+    212b:	+--|--|-----------------------|--|-------- 0f 84 7f 00 00 00    	je     21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2131:	|  |  |                       |  |         0f b6 79 06          	movzbl 0x6(%rcx),%edi
+    for (Index i = 0; i < head; ++i) {
+    2135:	|  |  |                       |  |         83 e6 08             	and    $0x8,%esi
+        d[i] = p[i];
+    2138:	|  |  |                       |  |         41 88 78 06          	mov    %dil,0x6(%r8)
+    for (Index i = 0; i < head; ++i) {
+    213c:	+--|--|-----------------------|--|-------- 74 72                	je     21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    213e:	|  |  |                       |  |         0f b6 71 07          	movzbl 0x7(%rcx),%esi
+    2142:	|  |  |                       |  |         41 88 70 07          	mov    %sil,0x7(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2146:	|  |  |                       |  |         48 83 f8 08          	cmp    $0x8,%rax
+    214a:	+--|--|-----------------------|--|-------- 76 64                	jbe    21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    214c:	|  |  |                       |  |         0f b6 71 08          	movzbl 0x8(%rcx),%esi
+    2150:	|  |  |                       |  |         41 88 70 08          	mov    %sil,0x8(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2154:	|  |  |                       |  |         48 83 f8 09          	cmp    $0x9,%rax
+    2158:	+--|--|-----------------------|--|-------- 74 56                	je     21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    215a:	|  |  |                       |  |         0f b6 71 09          	movzbl 0x9(%rcx),%esi
+    215e:	|  |  |                       |  |         41 88 70 09          	mov    %sil,0x9(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2162:	|  |  |                       |  |         48 83 f8 0a          	cmp    $0xa,%rax
+    2166:	+--|--|-----------------------|--|-------- 74 48                	je     21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2168:	|  |  |                       |  |         0f b6 71 0a          	movzbl 0xa(%rcx),%esi
+    216c:	|  |  |                       |  |         41 88 70 0a          	mov    %sil,0xa(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2170:	|  |  |                       |  |         48 83 f8 0b          	cmp    $0xb,%rax
+    2174:	+--|--|-----------------------|--|-------- 74 3a                	je     21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2176:	|  |  |                       |  |         0f b6 71 0b          	movzbl 0xb(%rcx),%esi
+    217a:	|  |  |                       |  |         41 88 70 0b          	mov    %sil,0xb(%r8)
+    for (Index i = 0; i < head; ++i) {
+    217e:	|  |  |                       |  |         48 83 f8 0c          	cmp    $0xc,%rax
+    2182:	+--|--|-----------------------|--|-------- 74 2c                	je     21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2184:	|  |  |                       |  |         0f b6 71 0c          	movzbl 0xc(%rcx),%esi
+    2188:	|  |  |                       |  |         41 88 70 0c          	mov    %sil,0xc(%r8)
+    for (Index i = 0; i < head; ++i) {
+    218c:	|  |  |                       |  |         48 83 f8 0d          	cmp    $0xd,%rax
+    2190:	+--|--|-----------------------|--|-------- 74 1e                	je     21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2192:	|  |  |                       |  |         0f b6 71 0d          	movzbl 0xd(%rcx),%esi
+    2196:	|  |  |                       |  |         41 88 70 0d          	mov    %sil,0xd(%r8)
+    for (Index i = 0; i < head; ++i) {
+    219a:	|  |  |                       |  |         49 8d 70 ff          	lea    -0x1(%r8),%rsi
+    219e:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    21a1:	+--|--|-----------------------|--|-------- 75 0d                	jne    21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    21a3:	|  |  |                       |  |         0f b6 71 0e          	movzbl 0xe(%rcx),%esi
+    21a7:	|  |  |                       |  |         41 88 70 0e          	mov    %sil,0xe(%r8)
+    for (Index i = 0; i < head; ++i) {
+    21ab:	|  |  |                       |  |         0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+        rotated[i] = p[(head + i) % 16];
+    21b0:	>--|--|-----------------------|--|-------> 48 8d 70 07          	lea    0x7(%rax),%rsi
+    21b4:	|  |  |                       |  |         4c 8d 78 06          	lea    0x6(%rax),%r15
+    21b8:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    21bb:	|  |  |                       |  |         4c 8d 70 05          	lea    0x5(%rax),%r14
+    21bf:	|  |  |                       |  |         4c 8d 68 04          	lea    0x4(%rax),%r13
+    21c3:	|  |  |                       |  |         41 83 e7 0f          	and    $0xf,%r15d
+    std::memcpy(&v, s, sizeof(v));
+    21c7:	|  |  |                       |  |         0f b6 34 31          	movzbl (%rcx,%rsi,1),%esi
+        rotated[i] = p[(head + i) % 16];
+    21cb:	|  |  |                       |  |         41 83 e6 0f          	and    $0xf,%r14d
+    21cf:	|  |  |                       |  |         41 83 e5 0f          	and    $0xf,%r13d
+    21d3:	|  |  |                       |  |         4c 8d 60 03          	lea    0x3(%rax),%r12
+    std::memcpy(&v, s, sizeof(v));
+    21d7:	|  |  |                       |  |         46 0f b6 3c 39       	movzbl (%rcx,%r15,1),%r15d
+    21dc:	|  |  |                       |  |         46 0f b6 34 31       	movzbl (%rcx,%r14,1),%r14d
+        rotated[i] = p[(head + i) % 16];
+    21e1:	|  |  |                       |  |         48 8d 78 08          	lea    0x8(%rax),%rdi
+    21e5:	|  |  |                       |  |         41 83 e4 0f          	and    $0xf,%r12d
+    std::memcpy(&v, s, sizeof(v));
+    21e9:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    21ed:	|  |  |                       |  |         46 0f b6 2c 29       	movzbl (%rcx,%r13,1),%r13d
+        rotated[i] = p[(head + i) % 16];
+    21f2:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    21f5:	|  |  |                       |  |         48 8d 68 02          	lea    0x2(%rax),%rbp
+    std::memcpy(&v, s, sizeof(v));
+    21f9:	|  |  |                       |  |         4c 09 fe             	or     %r15,%rsi
+        rotated[i] = p[(head + i) % 16];
+    21fc:	|  |  |                       |  |         48 89 7c 24 c8       	mov    %rdi,-0x38(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    2201:	|  |  |                       |  |         46 0f b6 24 21       	movzbl (%rcx,%r12,1),%r12d
+        rotated[i] = p[(head + i) % 16];
+    2206:	|  |  |                       |  |         83 e5 0f             	and    $0xf,%ebp
+    std::memcpy(&v, s, sizeof(v));
+    2209:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    220d:	|  |  |                       |  |         48 8d 78 09          	lea    0x9(%rax),%rdi
+    std::memcpy(&v, s, sizeof(v));
+    2211:	|  |  |                       |  |         0f b6 2c 29          	movzbl (%rcx,%rbp,1),%ebp
+        rotated[i] = p[(head + i) % 16];
+    2215:	|  |  |                       |  |         48 8d 58 01          	lea    0x1(%rax),%rbx
+    std::memcpy(&v, s, sizeof(v));
+    2219:	|  |  |                       |  |         4c 09 f6             	or     %r14,%rsi
+        rotated[i] = p[(head + i) % 16];
+    221c:	|  |  |                       |  |         49 89 fb             	mov    %rdi,%r11
+    221f:	|  |  |                       |  |         48 8d 78 0a          	lea    0xa(%rax),%rdi
+    2223:	|  |  |                       |  |         83 e3 0f             	and    $0xf,%ebx
+    std::memcpy(&v, s, sizeof(v));
+    2226:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    222a:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    222e:	|  |  |                       |  |         49 89 fa             	mov    %rdi,%r10
+    std::memcpy(&v, s, sizeof(v));
+    2231:	|  |  |                       |  |         4c 09 ee             	or     %r13,%rsi
+        rotated[i] = p[(head + i) % 16];
+    2234:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    2238:	|  |  |                       |  |         48 8d 78 0b          	lea    0xb(%rax),%rdi
+    223c:	|  |  |                       |  |         4c 89 5c 24 e0       	mov    %r11,-0x20(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    2241:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    2245:	|  |  |                       |  |         4c 8d 58 0f          	lea    0xf(%rax),%r11
+    2249:	|  |  |                       |  |         4c 89 54 24 e8       	mov    %r10,-0x18(%rsp)
+    224e:	|  |  |                       |  |         49 89 f9             	mov    %rdi,%r9
+    std::memcpy(&v, s, sizeof(v));
+    2251:	|  |  |                       |  |         4c 09 e6             	or     %r12,%rsi
+        rotated[i] = p[(head + i) % 16];
+    2254:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    2258:	|  |  |                       |  |         4c 8d 50 0e          	lea    0xe(%rax),%r10
+    225c:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    2260:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    2264:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    2268:	|  |  |                       |  |         4c 89 4c 24 f0       	mov    %r9,-0x10(%rsp)
+    226d:	|  |  |                       |  |         4c 8d 48 0d          	lea    0xd(%rax),%r9
+    std::memcpy(&v, s, sizeof(v));
+    2271:	|  |  |                       |  |         48 09 ee             	or     %rbp,%rsi
+    2274:	|  |  |                       |  |         0f b6 2c 19          	movzbl (%rcx,%rbx,1),%ebp
+    2278:	|  |  |                       |  |         46 0f b6 14 11       	movzbl (%rcx,%r10,1),%r10d
+        rotated[i] = p[(head + i) % 16];
+    227d:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    2281:	|  |  |                       |  |         48 89 f3             	mov    %rsi,%rbx
+    2284:	|  |  |                       |  |         42 0f b6 34 19       	movzbl (%rcx,%r11,1),%esi
+    2289:	|  |  |                       |  |         46 0f b6 0c 09       	movzbl (%rcx,%r9,1),%r9d
+        rotated[i] = p[(head + i) % 16];
+    228e:	|  |  |                       |  |         48 8d 78 0c          	lea    0xc(%rax),%rdi
+    2292:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    std::memcpy(&v, s, sizeof(v));
+    2295:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    2299:	|  |  |                       |  |         4c 8b 5c 24 e0       	mov    -0x20(%rsp),%r11
+    229e:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    22a2:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    22a5:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    22a9:	|  |  |                       |  |         0f b6 2c 01          	movzbl (%rcx,%rax,1),%ebp
+    22ad:	|  |  |                       |  |         4c 09 d6             	or     %r10,%rsi
+    22b0:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    22b4:	|  |  |                       |  |         4c 8b 54 24 e8       	mov    -0x18(%rsp),%r10
+    22b9:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    22bd:	|  |  |                       |  |         4c 09 ce             	or     %r9,%rsi
+    22c0:	|  |  |                       |  |         4c 8b 4c 24 f0       	mov    -0x10(%rsp),%r9
+    22c5:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    22c9:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    22cc:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    22cf:	|  |  |                       |  |         42 0f b6 3c 09       	movzbl (%rcx,%r9,1),%edi
+    22d4:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    22d8:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    22db:	|  |  |                       |  |         42 0f b6 3c 11       	movzbl (%rcx,%r10,1),%edi
+    22e0:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    22e4:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    22e7:	|  |  |                       |  |         42 0f b6 3c 19       	movzbl (%rcx,%r11,1),%edi
+    22ec:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    22f0:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    22f3:	|  |  |                       |  |         48 8b 7c 24 c8       	mov    -0x38(%rsp),%rdi
+    22f8:	|  |  |                       |  |         48 89 5c 24 c8       	mov    %rbx,-0x38(%rsp)
+    22fd:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2301:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    2305:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    2308:	|  |  |                       |  |         48 8d 78 40          	lea    0x40(%rax),%rdi
+    230c:	|  |  |                       |  |         4c 01 c0             	add    %r8,%rax
+    std::memcpy(&v, s, sizeof(v));
+    230f:	|  |  |                       |  |         48 89 74 24 d0       	mov    %rsi,-0x30(%rsp)
+    2314:	|  |  |                       |  |         66 0f 6f 44 24 c8    	movdqa -0x38(%rsp),%xmm0
+    for (; i + 64 <= n; i += 64) {
+    231a:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2320:	|  |  |                       |  |     /-> 48 89 fe             	mov    %rdi,%rsi
+    for (; i + 64 <= n; i += 64) {
+    2323:	|  |  |                       |  |     |   48 83 c7 40          	add    $0x40,%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2327:	|  |  |                       |  |     |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    232b:	|  |  |                       |  |     |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    2330:	|  |  |                       |  |     |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    2335:	|  |  |                       |  |     |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    233a:	|  |  |                       |  |     |   48 83 c0 40          	add    $0x40,%rax
+    233e:	|  |  |                       |  |     |   48 39 fa             	cmp    %rdi,%rdx
+    2341:	|  |  |                       |  |     \-- 73 dd                	jae    2320 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2a0>
+        stream16(d + i, v);
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+    2343:	|  |  |                       |  |         48 8d 46 10          	lea    0x10(%rsi),%rax
+    2347:	|  |  |                       |  |         48 39 c2             	cmp    %rax,%rdx
+    234a:	|  |  |                       |  |  /----- 72 15                	jb     2361 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2e1>
+    234c:	|  |  |                       |  |  |      49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2350:	|  |  |                       |  |  |  /-> 48 89 c6             	mov    %rax,%rsi
+    2353:	|  |  |                       |  |  |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    2358:	|  |  |                       |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    235c:	|  |  |                       |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    235f:	|  |  |                       |  |  |  \-- 73 ef                	jae    2350 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2d0>
+        stream16(d + i, v);
+    }
+    __builtin_ia32_sfence();
+    2361:	|  |  |                       |  |  \----> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    2364:	|  |  |                       |  |         48 39 d6             	cmp    %rdx,%rsi
+    2367:	|  |  |                       |  |  /----- 73 1e                	jae    2387 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x307>
+    2369:	|  |  |                       |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        d[i] = p[i % 16];
+    2370:	|  |  |                       |  |  |  /-> 48 89 f0             	mov    %rsi,%rax
+    2373:	|  |  |                       |  |  |  |   83 e0 0f             	and    $0xf,%eax
+    2376:	|  |  |                       |  |  |  |   0f b6 04 01          	movzbl (%rcx,%rax,1),%eax
+    237a:	|  |  |                       |  |  |  |   41 88 04 30          	mov    %al,(%r8,%rsi,1)
+    for (; i < n; ++i) {
+    237e:	|  |  |                       |  |  |  |   48 83 c6 01          	add    $0x1,%rsi
+    2382:	|  |  |                       |  |  |  |   48 39 f2             	cmp    %rsi,%rdx
+    2385:	|  |  |                       |  |  |  \-- 75 e9                	jne    2370 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2f0>
+    }
+}
+    2387:	|  |  |                       |  |  \----> 5b                   	pop    %rbx
+    2388:	|  |  |                       |  |         5d                   	pop    %rbp
+    2389:	|  |  |                       |  |         41 5c                	pop    %r12
+    238b:	|  |  |                       |  |         41 5d                	pop    %r13
+    238d:	|  |  |                       |  |         41 5e                	pop    %r14
+    238f:	|  |  |                       |  |         41 5f                	pop    %r15
+    2391:	|  |  |                       |  |         c3                   	ret
+    2392:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    2398:	|  |  |                       |  \-------> 48 83 ff 06          	cmp    $0x6,%rdi
+    239c:	|  |  |  /--------------------|----------- 0f 86 e1 01 00 00    	jbe    2583 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x503>
+        d[i] = p[i];
+    23a2:	|  |  |  |                    |            48 8b 31             	mov    (%rcx),%rsi
+    23a5:	|  |  |  |                    |            49 89 30             	mov    %rsi,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    23a8:	|  |  |  |                    |            48 83 f8 08          	cmp    $0x8,%rax
+    23ac:	+--|--|--|--------------------|----------- 0f 84 fe fd ff ff    	je     21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    23b2:	|  |  |  |                    |            48 8d 70 f7          	lea    -0x9(%rax),%rsi
+    23b6:	|  |  |  |                    |            4c 8d 48 f8          	lea    -0x8(%rax),%r9
+    23ba:	|  |  |  |                    |            48 83 fe 02          	cmp    $0x2,%rsi
+    23be:	|  |  |  |                    |            be 08 00 00 00       	mov    $0x8,%esi
+    23c3:	|  |  |  |                    |        /-- 76 15                	jbe    23da <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x35a>
+        d[i] = p[i];
+    23c5:	|  |  |  |  /-----------------|--------|-> 8b 3c 31             	mov    (%rcx,%rsi,1),%edi
+    23c8:	|  |  |  |  |                 |        |   41 89 3c 30          	mov    %edi,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    23cc:	|  |  |  |  |                 |        |   48 83 c6 04          	add    $0x4,%rsi
+    23d0:	|  |  |  |  |                 |        |   49 83 f9 04          	cmp    $0x4,%r9
+    23d4:	+--|--|--|--|-----------------|--------|-- 0f 84 d6 fd ff ff    	je     21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    23da:	|  |  |  |  |                 |        \-> 0f b6 3c 31          	movzbl (%rcx,%rsi,1),%edi
+    23de:	|  |  |  |  |                 |            41 88 3c 30          	mov    %dil,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    23e2:	|  |  |  |  |                 |            48 8d 7e 01          	lea    0x1(%rsi),%rdi
+    23e6:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    23e9:	+--|--|--|--|-----------------|----------- 0f 83 c1 fd ff ff    	jae    21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    23ef:	|  |  |  |  |                 |            0f b6 7c 31 01       	movzbl 0x1(%rcx,%rsi,1),%edi
+    23f4:	|  |  |  |  |                 |            41 88 7c 30 01       	mov    %dil,0x1(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    23f9:	|  |  |  |  |                 |            48 8d 7e 02          	lea    0x2(%rsi),%rdi
+    23fd:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    2400:	+--|--|--|--|-----------------|----------- 0f 83 aa fd ff ff    	jae    21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2406:	|  |  |  |  |                 |            0f b6 7c 31 02       	movzbl 0x2(%rcx,%rsi,1),%edi
+    240b:	|  |  |  |  |                 |            41 88 7c 30 02       	mov    %dil,0x2(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    2410:	+--|--|--|--|-----------------|----------- e9 9b fd ff ff       	jmp    21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    2415:	|  |  |  |  |                 |            0f 1f 00             	nopl   (%rax)
+    Length done = (n < 16) ? n : 16;
+    2418:	|  |  |  |  |                 \----------> 41 ba 10 00 00 00    	mov    $0x10,%r10d
+    241e:	|  |  |  |  |                              4c 39 d2             	cmp    %r10,%rdx
+    2421:	|  |  |  |  |                              4c 0f 46 d2          	cmovbe %rdx,%r10
+    std::memcpy(d, s, n);
+    2425:	|  |  |  |  |                              44 89 d0             	mov    %r10d,%eax
+    2428:	|  |  |  |  |                              41 83 fa 08          	cmp    $0x8,%r10d
+    242c:	|  |  |  |  |        /-------------------- 0f 82 cc 00 00 00    	jb     24fe <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47e>
+    2432:	|  |  |  |  |        |                     48 8b 06             	mov    (%rsi),%rax
+    2435:	|  |  |  |  |        |                     4c 8d 4f 08          	lea    0x8(%rdi),%r9
+    2439:	|  |  |  |  |        |                     49 83 e1 f8          	and    $0xfffffffffffffff8,%r9
+    243d:	|  |  |  |  |        |                     48 89 07             	mov    %rax,(%rdi)
+    2440:	|  |  |  |  |        |                     44 89 d0             	mov    %r10d,%eax
+    2443:	|  |  |  |  |        |                     48 8b 74 06 f8       	mov    -0x8(%rsi,%rax,1),%rsi
+    2448:	|  |  |  |  |        |                     48 89 74 07 f8       	mov    %rsi,-0x8(%rdi,%rax,1)
+    244d:	|  |  |  |  |        |                     48 89 f8             	mov    %rdi,%rax
+    2450:	|  |  |  |  |        |                     4c 29 c8             	sub    %r9,%rax
+    2453:	|  |  |  |  |        |                     48 29 c1             	sub    %rax,%rcx
+    2456:	|  |  |  |  |        |                     44 01 d0             	add    %r10d,%eax
+    2459:	|  |  |  |  |        |                     83 e0 f8             	and    $0xfffffff8,%eax
+    245c:	|  |  |  |  |        |                     83 f8 08             	cmp    $0x8,%eax
+    245f:	|  |  |  |  |  /-----|-------------------- 72 16                	jb     2477 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    2461:	|  |  |  |  |  |     |                     83 e0 f8             	and    $0xfffffff8,%eax
+    2464:	|  |  |  |  |  |     |                     31 f6                	xor    %esi,%esi
+    2466:	|  |  |  |  |  |     |                 /-> 89 f7                	mov    %esi,%edi
+    2468:	|  |  |  |  |  |     |                 |   83 c6 08             	add    $0x8,%esi
+    246b:	|  |  |  |  |  |     |                 |   4c 8b 1c 39          	mov    (%rcx,%rdi,1),%r11
+    246f:	|  |  |  |  |  |     |                 |   4d 89 1c 39          	mov    %r11,(%r9,%rdi,1)
+    2473:	|  |  |  |  |  |     |                 |   39 c6                	cmp    %eax,%esi
+    2475:	|  |  |  |  |  |     |                 \-- 72 ef                	jb     2466 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3e6>
+    while (done < n) {
+    2477:	|  |  |  |  |  >-----|-------------------> 49 39 d2             	cmp    %rdx,%r10
+    247a:	|  |  |  |  |  |     |           /-------- 72 33                	jb     24af <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    247c:	|  |  |  |  |  |     |     /-----|-------- e9 af 00 00 00       	jmp    2530 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b0>
+    2481:	|  |  |  |  |  |     |     |     |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    std::memcpy(d, s, n);
+    2488:	|  |  |  |  |  |     |     |     |     /-> 41 f6 c1 04          	test   $0x4,%r9b
+    248c:	|  |  |  |  |  |     |     |  /--|-----|-- 0f 85 9f 00 00 00    	jne    2531 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b1>
+    2492:	|  |  |  |  |  |     |     |  |  |     |   45 85 c9             	test   %r9d,%r9d
+    2495:	|  |  |  |  |  |  /--|-----|--|--|-----|-- 74 10                	je     24a7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    2497:	|  |  |  |  |  |  |  |     |  |  |     |   41 0f b6 08          	movzbl (%r8),%ecx
+    249b:	|  |  |  |  |  |  |  |     |  |  |     |   88 08                	mov    %cl,(%rax)
+    249d:	|  |  |  |  |  |  |  |     |  |  |     |   41 f6 c1 02          	test   $0x2,%r9b
+    24a1:	|  |  |  |  |  |  |  |  /--|--|--|-----|-- 0f 85 c9 00 00 00    	jne    2570 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4f0>
+        done += m;
+    24a7:	|  |  |  |  |  |  >--|--|--|--|--|-----|-> 4d 01 ca             	add    %r9,%r10
+    while (done < n) {
+    24aa:	|  |  |  |  |  |  |  |  |  |  |  |     |   49 39 d2             	cmp    %rdx,%r10
+    24ad:	|  |  |  |  |  |  |  |  |  |  |  |  /--|-- 73 4e                	jae    24fd <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47d>
+        Length const m = (done < n - done) ? done : n - done;
+    24af:	|  |  |  |  |  |  |  |  |  |  |  >--|--|-> 49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    24b2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4b 8d 04 10          	lea    (%r8,%r10,1),%rax
+        Length const m = (done < n - done) ? done : n - done;
+    24b6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 29 d1             	sub    %r10,%r9
+    24b9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 39 d1             	cmp    %r10,%r9
+    24bc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 0f 47 ca          	cmova  %r10,%r9
+    std::memcpy(d, s, n);
+    24c0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   41 83 f9 08          	cmp    $0x8,%r9d
+    24c4:	|  |  |  |  |  |  |  |  |  |  |  |  |  \-- 72 c2                	jb     2488 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x408>
+    24c6:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 08             	mov    (%r8),%rcx
+    24c9:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 78 08          	lea    0x8(%rax),%rdi
+        done += m;
+    24cd:	|  |  |  |  |  |  |  |  |  |  |  |  |      4d 01 ca             	add    %r9,%r10
+    std::memcpy(d, s, n);
+    24d0:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 83 e7 f8          	and    $0xfffffffffffffff8,%rdi
+    24d4:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 08             	mov    %rcx,(%rax)
+    24d7:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 89 c9             	mov    %r9d,%ecx
+    24da:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 74 08 f8       	mov    -0x8(%r8,%rcx,1),%rsi
+    24df:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 74 08 f8       	mov    %rsi,-0x8(%rax,%rcx,1)
+    24e4:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 f8             	sub    %rdi,%rax
+    24e7:	|  |  |  |  |  |  |  |  |  |  |  |  |      4c 89 c6             	mov    %r8,%rsi
+    24ea:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 c6             	sub    %rax,%rsi
+    24ed:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 01 c8             	add    %r9d,%eax
+    24f0:	|  |  |  |  |  |  |  |  |  |  |  |  |      c1 e8 03             	shr    $0x3,%eax
+    24f3:	|  |  |  |  |  |  |  |  |  |  |  |  |      89 c1                	mov    %eax,%ecx
+    24f5:	|  |  |  |  |  |  |  |  |  |  |  |  |      f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    24f8:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 39 d2             	cmp    %rdx,%r10
+    24fb:	|  |  |  |  |  |  |  |  |  |  |  \--|----- 72 b2                	jb     24af <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    24fd:	|  |  |  |  |  |  |  |  |  |  |     \----> c3                   	ret
+    std::memcpy(d, s, n);
+    24fe:	|  |  |  |  |  |  |  \--|--|--|----------> 41 f6 c2 04          	test   $0x4,%r10b
+    2502:	|  |  |  |  |  |  |     |  |  |        /-- 0f 85 85 00 00 00    	jne    258d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x50d>
+    2508:	|  |  |  |  |  |  |     |  |  |        |   85 c0                	test   %eax,%eax
+    250a:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 67 ff ff ff    	je     2477 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    2510:	|  |  |  |  |  |  |     |  |  |        |   0f b6 36             	movzbl (%rsi),%esi
+    2513:	|  |  |  |  |  |  |     |  |  |        |   40 88 37             	mov    %sil,(%rdi)
+    2516:	|  |  |  |  |  |  |     |  |  |        |   a8 02                	test   $0x2,%al
+    2518:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 59 ff ff ff    	je     2477 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    251e:	|  |  |  |  |  |  |     |  |  |        |   0f b7 4c 01 fe       	movzwl -0x2(%rcx,%rax,1),%ecx
+    2523:	|  |  |  |  |  |  |     |  |  |        |   66 89 4c 07 fe       	mov    %cx,-0x2(%rdi,%rax,1)
+    2528:	|  |  |  |  |  +--|-----|--|--|--------|-- e9 4a ff ff ff       	jmp    2477 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    252d:	|  |  |  |  |  |  |     |  |  |        |   0f 1f 00             	nopl   (%rax)
+    2530:	|  |  |  |  |  |  |     |  \--|--------|-> c3                   	ret
+    2531:	|  |  |  |  |  |  |     |     \--------|-> 41 8b 08             	mov    (%r8),%ecx
+    2534:	|  |  |  |  |  |  |     |              |   89 08                	mov    %ecx,(%rax)
+    2536:	|  |  |  |  |  |  |     |              |   44 89 c9             	mov    %r9d,%ecx
+    2539:	|  |  |  |  |  |  |     |              |   41 8b 74 08 fc       	mov    -0x4(%r8,%rcx,1),%esi
+    253e:	|  |  |  |  |  |  |     |              |   89 74 08 fc          	mov    %esi,-0x4(%rax,%rcx,1)
+    2542:	|  |  |  |  |  |  +-----|--------------|-- e9 60 ff ff ff       	jmp    24a7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+        d[i] = p[i];
+    2547:	|  \--|--|--|--|--|-----|--------------|-> 0f b6 39             	movzbl (%rcx),%edi
+    254a:	|     |  |  |  |  |     |              |   41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    254d:	|     |  |  |  |  |     |              |   40 f6 c6 0e          	test   $0xe,%sil
+    2551:	+-----|--|--|--|--|-----|--------------|-- 0f 84 59 fc ff ff    	je     21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2557:	|     |  |  |  |  |     |              |   0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    255b:	|     |  |  |  |  |     |              |   41 88 78 01          	mov    %dil,0x1(%r8)
+    for (Index i = 0; i < head; ++i) {
+    255f:	|     |  |  |  |  |     |              |   48 83 f8 03          	cmp    $0x3,%rax
+    2563:	\-----|--|--|--|--|-----|--------------|-- 0f 85 47 fc ff ff    	jne    21b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    2569:	      \--|--|--|--|-----|--------------|-- e9 7b fb ff ff       	jmp    20e9 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x69>
+    256e:	         |  |  |  |     |              |   66 90                	xchg   %ax,%ax
+    std::memcpy(d, s, n);
+    2570:	         |  |  |  |     \--------------|-> 44 89 c9             	mov    %r9d,%ecx
+    2573:	         |  |  |  |                    |   41 0f b7 74 08 fe    	movzwl -0x2(%r8,%rcx,1),%esi
+    2579:	         |  |  |  |                    |   66 89 74 08 fe       	mov    %si,-0x2(%rax,%rcx,1)
+    257e:	         |  |  |  \--------------------|-- e9 24 ff ff ff       	jmp    24a7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    for (Index i = 0; i < head; ++i) {
+    2583:	         \--|--|-----------------------|-> 49 89 c1             	mov    %rax,%r9
+    2586:	            |  |                       |   31 f6                	xor    %esi,%esi
+    2588:	            \--|-----------------------|-- e9 38 fe ff ff       	jmp    23c5 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x345>
+    std::memcpy(d, s, n);
+    258d:	               |                       \-> 8b 36                	mov    (%rsi),%esi
+    258f:	               |                           89 37                	mov    %esi,(%rdi)
+    2591:	               |                           8b 4c 01 fc          	mov    -0x4(%rcx,%rax,1),%ecx
+    2595:	               |                           89 4c 07 fc          	mov    %ecx,-0x4(%rdi,%rax,1)
+    2599:	               \-------------------------- e9 d9 fe ff ff       	jmp    2477 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    259e:	                                           66 90                	xchg   %ax,%ax
+
+00000000000025a0 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    25a0:	    48 85 ff             	test   %rdi,%rdi
+    25a3:	/-- 74 0b                	je     25b0 <nel::free_aligned(void*)+0x10>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    25a5:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    25a9:	|   e9 82 ea ff ff       	jmp    1030 <free@plt>
+    25ae:	|   66 90                	xchg   %ax,%ax
+}
+    25b0:	\-> c3                   	ret
+    25b1:	    66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    25b8:	    00 00 00 00 
+    25bc:	    0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000025c0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    25c0:	                   41 56                	push   %r14
+    25c2:	                   48 8d 05 a2 1c 00 00 	lea    0x1ca2(%rip),%rax        # 426b <_IO_stdin_used+0x26b>
+    25c9:	                   41 55                	push   %r13
+    25cb:	                   66 48 0f 6e c8       	movq   %rax,%xmm1
+    25d0:	                   41 54                	push   %r12
+    25d2:	                   55                   	push   %rbp
+    25d3:	                   48 89 cd             	mov    %rcx,%rbp
+    25d6:	                   48 8d 0d 7e 1c 00 00 	lea    0x1c7e(%rip),%rcx        # 425b <_IO_stdin_used+0x25b>
+    25dd:	                   53                   	push   %rbx
+    25de:	                   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    25e3:	                   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    25e7:	                   48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    25eb:	                   c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    25f2:	                   00 
+            : fn_name_(fn_name)
+    25f3:	                   0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    25f7:	                   48 85 f6             	test   %rsi,%rsi
+    25fa:	/----------------- 0f 84 a0 00 00 00    	je     26a0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    2600:	|                  48 8d 46 ff          	lea    -0x1(%rsi),%rax
+    2604:	|                  48 89 f3             	mov    %rsi,%rbx
+    2607:	|                  48 85 f0             	test   %rsi,%rax
+    260a:	+----------------- 0f 85 90 00 00 00    	jne    26a0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2610:	|                  48 8d 34 2e          	lea    (%rsi,%rbp,1),%rsi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    2614:	|                  48 85 ff             	test   %rdi,%rdi
+    2617:	|     /----------- 74 67                	je     2680 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xc0>
+    2619:	|     |            4c 8b 6f f8          	mov    -0x8(%rdi),%r13
+    uint8_t *const new_base =
+    261d:	|     |            49 89 d4             	mov    %rdx,%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    2620:	|     |            4c 29 ef             	sub    %r13,%rdi
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2623:	|     |            e8 08 eb ff ff       	call   1130 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    2628:	|     |            48 85 c0             	test   %rax,%rax
+    262b:	|  /--|----------- 0f 84 7e 00 00 00    	je     26af <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    2631:	|  |  |            48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    2636:	|  |  |            48 f7 db             	neg    %rbx
+    2639:	|  |  |            48 21 cb             	and    %rcx,%rbx
+    263c:	|  |  |            49 89 de             	mov    %rbx,%r14
+    263f:	|  |  |            49 29 c6             	sub    %rax,%r14
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    2642:	|  |  |            4d 39 f5             	cmp    %r14,%r13
+    2645:	|  |  |        /-- 75 19                	jne    2660 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xa0>
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    }
+    offset_field(new_p) = new_offset;
+    2647:	|  |  |     /--|-> 4c 89 73 f8          	mov    %r14,-0x8(%rbx)
+    return new_p;
+}
+    264b:	|  |  |  /--|--|-> 48 83 c4 20          	add    $0x20,%rsp
+    264f:	|  |  |  |  |  |   48 89 d8             	mov    %rbx,%rax
+    2652:	|  |  |  |  |  |   5b                   	pop    %rbx
+    2653:	|  |  |  |  |  |   5d                   	pop    %rbp
+    2654:	|  |  |  |  |  |   41 5c                	pop    %r12
+    2656:	|  |  |  |  |  |   41 5d                	pop    %r13
+    2658:	|  |  |  |  |  |   41 5e                	pop    %r14
+    265a:	|  |  |  |  |  |   c3                   	ret
+    265b:	|  |  |  |  |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        std::memmove(new_p, new_base + old_offset, n);
+    2660:	|  |  |  |  |  \-> 4c 39 e5             	cmp    %r12,%rbp
+    2663:	|  |  |  |  |      4c 89 e2             	mov    %r12,%rdx
+    2666:	|  |  |  |  |      4a 8d 34 28          	lea    (%rax,%r13,1),%rsi
+    266a:	|  |  |  |  |      48 89 df             	mov    %rbx,%rdi
+    266d:	|  |  |  |  |      48 0f 46 d5          	cmovbe %rbp,%rdx
+    2671:	|  |  |  |  |      e8 da ea ff ff       	call   1150 <memmove@plt>
+    2676:	|  |  |  |  +----- eb cf                	jmp    2647 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+    2678:	|  |  |  |  |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    267f:	|  |  |  |  |      00 
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2680:	|  |  \--|--|----> 48 89 f7             	mov    %rsi,%rdi
+    2683:	|  |     |  |      e8 98 ea ff ff       	call   1120 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    2688:	|  |     |  |      48 85 c0             	test   %rax,%rax
+    268b:	|  +-----|--|----- 74 22                	je     26af <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    268d:	|  |     |  |      48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    2692:	|  |     |  |      48 f7 db             	neg    %rbx
+    2695:	|  |     |  |      48 21 d3             	and    %rdx,%rbx
+    2698:	|  |     |  |      49 89 de             	mov    %rbx,%r14
+    269b:	|  |     |  |      49 29 c6             	sub    %rax,%r14
+    if (old_p != nullptr && new_offset != old_offset) {
+    269e:	|  |     |  \----- eb a7                	jmp    2647 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    26a0:	\--|-----|-------> 48 89 e6             	mov    %rsp,%rsi
+    26a3:	   |     |         48 8d 3d d3 1b 00 00 	lea    0x1bd3(%rip),%rdi        # 427d <_IO_stdin_used+0x27d>
+    26aa:	   |     |         e8 73 eb ff ff       	call   1222 <nel::assert_fail(char const*, nel::Context const&)>
+    if (new_base == nullptr) { return nullptr; }
+    26af:	   \-----|-------> 31 db                	xor    %ebx,%ebx
+    26b1:	         \-------- eb 98                	jmp    264b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x8b>
+    26b3:	                   66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    26ba:	                   00 00 00 00 
+    26be:	                   66 90                	xchg   %ax,%ax
+
+00000000000026c0 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    26c0:	       53                   	push   %rbx
+            : fn_name_(fn_name)
+    26c1:	       48 8d 05 a3 1b 00 00 	lea    0x1ba3(%rip),%rax        # 426b <_IO_stdin_used+0x26b>
+    26c8:	       48 8d 0d 8c 1b 00 00 	lea    0x1b8c(%rip),%rcx        # 425b <_IO_stdin_used+0x25b>
+    26cf:	       66 48 0f 6e c1       	movq   %rcx,%xmm0
+    26d4:	       66 48 0f 6e c8       	movq   %rax,%xmm1
+    26d9:	       66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    26dd:	       48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    26e1:	       c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    26e8:	       00 
+            : fn_name_(fn_name)
+    26e9:	       0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    26ed:	       48 85 ff             	test   %rdi,%rdi
+    26f0:	/----- 74 35                	je     2727 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+    26f2:	|      48 8d 47 ff          	lea    -0x1(%rdi),%rax
+    26f6:	|      48 89 fb             	mov    %rdi,%rbx
+    26f9:	|      48 85 f8             	test   %rdi,%rax
+    26fc:	+----- 75 29                	jne    2727 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    26fe:	|      48 8d 3c 37          	lea    (%rdi,%rsi,1),%rdi
+    2702:	|      e8 19 ea ff ff       	call   1120 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    2707:	|      48 85 c0             	test   %rax,%rax
+    270a:	|  /-- 74 15                	je     2721 <nel::malloc_aligned(unsigned long, unsigned long)+0x61>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    270c:	|  |   48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    2711:	|  |   48 f7 db             	neg    %rbx
+    2714:	|  |   48 21 da             	and    %rbx,%rdx
+    2717:	|  |   48 29 c2             	sub    %rax,%rdx
+    uint8_t *const new_p = new_base + new_offset;
+    271a:	|  |   48 01 d0             	add    %rdx,%rax
+    offset_field(new_p) = new_offset;
+    271d:	|  |   48 89 50 f8          	mov    %rdx,-0x8(%rax)
+    return realloc_aligned(nullptr, align, 0, size);
+}
+    2721:	|  \-> 48 83 c4 20          	add    $0x20,%rsp
+    2725:	|      5b                   	pop    %rbx
+    2726:	|      c3                   	ret
+    if (!pred) { assert_fail(msg, ctx); }
+    2727:	\----> 48 89 e6             	mov    %rsp,%rsi
+    272a:	       48 8d 3d 4c 1b 00 00 	lea    0x1b4c(%rip),%rdi        # 427d <_IO_stdin_used+0x27d>
+    2731:	       e8 ec ea ff ff       	call   1222 <nel::assert_fail(char const*, nel::Context const&)>
+    2736:	       66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    273d:	       00 00 00 
+
+0000000000002740 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    2740:	53                   	push   %rbx
+    2741:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    2744:	40 0f be fe          	movsbl %sil,%edi
+    2748:	48 8b 35 91 39 00 00 	mov    0x3991(%rip),%rsi        # 60e0 <stderr@GLIBC_2.2.5>
+    274f:	e8 5c e9 ff ff       	call   10b0 <fputc@plt>
+    return outs;
+}
+    2754:	48 89 d8             	mov    %rbx,%rax
+    2757:	5b                   	pop    %rbx
+    2758:	c3                   	ret
+    2759:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002760 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    2760:	53                   	push   %rbx
+    2761:	48 89 fb             	mov    %rdi,%rbx
+    2764:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    2767:	48 8b 35 72 39 00 00 	mov    0x3972(%rip),%rsi        # 60e0 <stderr@GLIBC_2.2.5>
+    276e:	e8 1d e9 ff ff       	call   1090 <fputs@plt>
+    return outs;
+}
+    2773:	48 89 d8             	mov    %rbx,%rax
+    2776:	5b                   	pop    %rbx
+    2777:	c3                   	ret
+    2778:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    277f:	00 
+
+0000000000002780 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    2780:	53                   	push   %rbx
+    2781:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    2784:	48 8b 3d 55 39 00 00 	mov    0x3955(%rip),%rdi        # 60e0 <stderr@GLIBC_2.2.5>
+    278b:	40 0f b6 d6          	movzbl %sil,%edx
+    278f:	31 c0                	xor    %eax,%eax
+    2791:	48 8d 35 00 1b 00 00 	lea    0x1b00(%rip),%rsi        # 4298 <_IO_stdin_used+0x298>
+    2798:	e8 43 e9 ff ff       	call   10e0 <fprintf@plt>
+    return outs;
+}
+    279d:	48 89 d8             	mov    %rbx,%rax
+    27a0:	5b                   	pop    %rbx
+    27a1:	c3                   	ret
+    27a2:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    27a9:	00 00 00 00 
+    27ad:	0f 1f 00             	nopl   (%rax)
+
+00000000000027b0 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    27b0:	53                   	push   %rbx
+    27b1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    27b4:	48 8b 3d 25 39 00 00 	mov    0x3925(%rip),%rdi        # 60e0 <stderr@GLIBC_2.2.5>
+    27bb:	0f b7 d6             	movzwl %si,%edx
+    27be:	31 c0                	xor    %eax,%eax
+    27c0:	48 8d 35 d1 1a 00 00 	lea    0x1ad1(%rip),%rsi        # 4298 <_IO_stdin_used+0x298>
+    27c7:	e8 14 e9 ff ff       	call   10e0 <fprintf@plt>
+    return outs;
+}
+    27cc:	48 89 d8             	mov    %rbx,%rax
+    27cf:	5b                   	pop    %rbx
+    27d0:	c3                   	ret
+    27d1:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    27d8:	00 00 00 00 
+    27dc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000027e0 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    27e0:	53                   	push   %rbx
+    27e1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    27e4:	48 8b 3d f5 38 00 00 	mov    0x38f5(%rip),%rdi        # 60e0 <stderr@GLIBC_2.2.5>
+{
+    27eb:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    27ed:	31 c0                	xor    %eax,%eax
+    27ef:	48 8d 35 a2 1a 00 00 	lea    0x1aa2(%rip),%rsi        # 4298 <_IO_stdin_used+0x298>
+    27f6:	e8 e5 e8 ff ff       	call   10e0 <fprintf@plt>
+    return outs;
+}
+    27fb:	48 89 d8             	mov    %rbx,%rax
+    27fe:	5b                   	pop    %rbx
+    27ff:	c3                   	ret
+
+0000000000002800 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    2800:	53                   	push   %rbx
+    2801:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    2804:	48 8b 3d d5 38 00 00 	mov    0x38d5(%rip),%rdi        # 60e0 <stderr@GLIBC_2.2.5>
+{
+    280b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    280d:	31 c0                	xor    %eax,%eax
+    280f:	48 8d 35 82 1a 00 00 	lea    0x1a82(%rip),%rsi        # 4298 <_IO_stdin_used+0x298>
+    2816:	e8 c5 e8 ff ff       	call   10e0 <fprintf@plt>
+    return outs;
+}
+    281b:	48 89 d8             	mov    %rbx,%rax
+    281e:	5b                   	pop    %rbx
+    281f:	c3                   	ret
+
+0000000000002820 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    2820:	53                   	push   %rbx
+    2821:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    2824:	48 8b 3d b5 38 00 00 	mov    0x38b5(%rip),%rdi        # 60e0 <stderr@GLIBC_2.2.5>
+{
+    282b:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    282e:	31 c0                	xor    %eax,%eax
+    2830:	48 8d 35 64 1a 00 00 	lea    0x1a64(%rip),%rsi        # 429b <_IO_stdin_used+0x29b>
+    2837:	e8 a4 e8 ff ff       	call   10e0 <fprintf@plt>
+    return outs;
+}
+    283c:	48 89 d8             	mov    %rbx,%rax
+    283f:	5b                   	pop    %rbx
+    2840:	c3                   	ret
+    2841:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2848:	00 00 00 
+    284b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000002850 <nel::par::(anonymous namespace)::worker_main(void*)>:
+}
+
+#if defined(NEL_PAR_PTHREADS)
+
+void *worker_main(void *const arg)
+{
+    2850:	                         41 57                	push   %r15
+    Pool::Shared *const s = static_cast<Pool::Shared *>(arg);
+    USize seen = 0;
+
+    pthread_mutex_lock(&s->lock_);
+    2852:	                         48 8d 47 40          	lea    0x40(%rdi),%rax
+{
+    2856:	                         49 89 ff             	mov    %rdi,%r15
+    2859:	                         41 56                	push   %r14
+    pthread_mutex_lock(&s->lock_);
+    285b:	                         48 89 c7             	mov    %rax,%rdi
+{
+    285e:	                         41 55                	push   %r13
+    2860:	                         41 54                	push   %r12
+    2862:	                         55                   	push   %rbp
+    2863:	                         53                   	push   %rbx
+    2864:	                         48 83 ec 18          	sub    $0x18,%rsp
+    pthread_mutex_lock(&s->lock_);
+    2868:	                         48 89 04 24          	mov    %rax,(%rsp)
+    286c:	                         e8 2f e9 ff ff       	call   11a0 <pthread_mutex_lock@plt>
+    for (;;) {
+        while (!s->stop_ && s->generation_ == seen) {
+    2871:	                         41 80 bf d8 00 00 00 	cmpb   $0x0,0xd8(%r15)
+    2878:	                         00 
+    2879:	   /-------------------- 0f 85 98 00 00 00    	jne    2917 <nel::par::(anonymous namespace)::worker_main(void*)+0xc7>
+    USize seen = 0;
+    287f:	   |                     31 ed                	xor    %ebp,%ebp
+        Pool::Task const task = s->task_;
+        void *const ctx = s->ctx_;
+        Count const n_chunks = s->n_chunks_;
+        pthread_mutex_unlock(&s->lock_);
+
+        run_chunks(task, ctx, n_chunks, s->next_, s->failed_);
+    2881:	   |                     49 8d 9f f8 00 00 00 	lea    0xf8(%r15),%rbx
+    2888:	   |                     0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    288f:	   |                     00 
+        while (!s->stop_ && s->generation_ == seen) {
+    2890:	   |  /----------------> 49 8b 87 c8 00 00 00 	mov    0xc8(%r15),%rax
+    2897:	   |  |                  48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    289c:	   |  |                  48 39 e8             	cmp    %rbp,%rax
+    289f:	/--|--|----------------- 0f 84 a9 00 00 00    	je     294e <nel::par::(anonymous namespace)::worker_main(void*)+0xfe>
+        pthread_mutex_unlock(&s->lock_);
+    28a5:	|  |  |                  48 8b 3c 24          	mov    (%rsp),%rdi
+        Pool::Task const task = s->task_;
+    28a9:	|  |  |                  4d 8b b7 e0 00 00 00 	mov    0xe0(%r15),%r14
+        run_chunks(task, ctx, n_chunks, s->next_, s->failed_);
+    28b0:	|  |  |                  49 8d af 00 01 00 00 	lea    0x100(%r15),%rbp
+        void *const ctx = s->ctx_;
+    28b7:	|  |  |                  4d 8b af e8 00 00 00 	mov    0xe8(%r15),%r13
+        Count const n_chunks = s->n_chunks_;
+    28be:	|  |  |                  4d 8b a7 f0 00 00 00 	mov    0xf0(%r15),%r12
+        pthread_mutex_unlock(&s->lock_);
+    28c5:	|  |  |                  e8 46 e8 ff ff       	call   1110 <pthread_mutex_unlock@plt>
+    while (!__atomic_load_n(&failed, __ATOMIC_RELAXED)) {
+    28ca:	|  |  |  /-------------- eb 1d                	jmp    28e9 <nel::par::(anonymous namespace)::worker_main(void*)+0x99>
+    28cc:	|  |  |  |               0f 1f 40 00          	nopl   0x0(%rax)
+        Index const c = __atomic_fetch_add(&next, 1, __ATOMIC_RELAXED);
+    28d0:	|  |  |  |        /----> be 01 00 00 00       	mov    $0x1,%esi
+    28d5:	|  |  |  |        |      f0 48 0f c1 33       	lock xadd %rsi,(%rbx)
+        if (c >= n_chunks) { break; }
+    28da:	|  |  |  |        |      4c 39 e6             	cmp    %r12,%rsi
+    28dd:	|  |  |  |        |  /-- 73 12                	jae    28f1 <nel::par::(anonymous namespace)::worker_main(void*)+0xa1>
+        if (!task(ctx, c)) { __atomic_store_n(&failed, true, __ATOMIC_RELAXED); }
+    28df:	|  |  |  |        |  |   4c 89 ef             	mov    %r13,%rdi
+    28e2:	|  |  |  |        |  |   41 ff d6             	call   *%r14
+    28e5:	|  |  |  |        |  |   84 c0                	test   %al,%al
+    28e7:	|  |  |  |     /--|--|-- 74 4f                	je     2938 <nel::par::(anonymous namespace)::worker_main(void*)+0xe8>
+    while (!__atomic_load_n(&failed, __ATOMIC_RELAXED)) {
+    28e9:	|  |  |  >-----|--|--|-> 0f b6 45 00          	movzbl 0x0(%rbp),%eax
+    28ed:	|  |  |  |     |  |  |   84 c0                	test   %al,%al
+    28ef:	|  |  |  |     |  \--|-- 74 df                	je     28d0 <nel::par::(anonymous namespace)::worker_main(void*)+0x80>
+
+        pthread_mutex_lock(&s->lock_);
+    28f1:	|  |  |  |     |     \-> 48 8b 3c 24          	mov    (%rsp),%rdi
+    28f5:	|  |  |  |     |         e8 a6 e8 ff ff       	call   11a0 <pthread_mutex_lock@plt>
+        s->busy_ -= 1;
+    28fa:	|  |  |  |     |         49 83 af d0 00 00 00 	subq   $0x1,0xd0(%r15)
+    2901:	|  |  |  |     |         01 
+        if (s->busy_ == 0) { pthread_cond_signal(&s->idle_); }
+    2902:	|  |  |  |     |     /-- 74 3c                	je     2940 <nel::par::(anonymous namespace)::worker_main(void*)+0xf0>
+        seen = s->generation_;
+    2904:	|  |  |  |     |  /--|-> 48 8b 6c 24 08       	mov    0x8(%rsp),%rbp
+        while (!s->stop_ && s->generation_ == seen) {
+    2909:	|  |  |  |  /--|--|--|-> 41 80 bf d8 00 00 00 	cmpb   $0x0,0xd8(%r15)
+    2910:	|  |  |  |  |  |  |  |   00 
+    2911:	|  |  \--|--|--|--|--|-- 0f 84 79 ff ff ff    	je     2890 <nel::par::(anonymous namespace)::worker_main(void*)+0x40>
+    }
+    pthread_mutex_unlock(&s->lock_);
+    2917:	|  \-----|--|--|--|--|-> 48 8b 3c 24          	mov    (%rsp),%rdi
+    291b:	|        |  |  |  |  |   e8 f0 e7 ff ff       	call   1110 <pthread_mutex_unlock@plt>
+    return nullptr;
+}
+    2920:	|        |  |  |  |  |   48 83 c4 18          	add    $0x18,%rsp
+    2924:	|        |  |  |  |  |   31 c0                	xor    %eax,%eax
+    2926:	|        |  |  |  |  |   5b                   	pop    %rbx
+    2927:	|        |  |  |  |  |   5d                   	pop    %rbp
+    2928:	|        |  |  |  |  |   41 5c                	pop    %r12
+    292a:	|        |  |  |  |  |   41 5d                	pop    %r13
+    292c:	|        |  |  |  |  |   41 5e                	pop    %r14
+    292e:	|        |  |  |  |  |   41 5f                	pop    %r15
+    2930:	|        |  |  |  |  |   c3                   	ret
+    2931:	|        |  |  |  |  |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        if (!task(ctx, c)) { __atomic_store_n(&failed, true, __ATOMIC_RELAXED); }
+    2938:	|        |  |  \--|--|-> c6 45 00 01          	movb   $0x1,0x0(%rbp)
+    293c:	|        \--|-----|--|-- eb ab                	jmp    28e9 <nel::par::(anonymous namespace)::worker_main(void*)+0x99>
+    293e:	|           |     |  |   66 90                	xchg   %ax,%ax
+        if (s->busy_ == 0) { pthread_cond_signal(&s->idle_); }
+    2940:	|           |     |  \-> 49 8d bf 98 00 00 00 	lea    0x98(%r15),%rdi
+    2947:	|           |     |      e8 84 e7 ff ff       	call   10d0 <pthread_cond_signal@plt>
+    294c:	|           |     \----- eb b6                	jmp    2904 <nel::par::(anonymous namespace)::worker_main(void*)+0xb4>
+            pthread_cond_wait(&s->wake_, &s->lock_);
+    294e:	\-----------|----------> 48 8b 34 24          	mov    (%rsp),%rsi
+    2952:	            |            49 8d 7f 68          	lea    0x68(%r15),%rdi
+    2956:	            |            e8 15 e7 ff ff       	call   1070 <pthread_cond_wait@plt>
+    295b:	            \----------- eb ac                	jmp    2909 <nel::par::(anonymous namespace)::worker_main(void*)+0xb9>
+    295d:	                         90                   	nop
+    295e:	                         66 90                	xchg   %ax,%ax
+
+0000000000002960 <nel::par::Pool::~Pool()>:
+
+#endif // defined(NEL_PAR_PTHREADS)
+
+} // namespace
+
+Pool::~Pool(void)
+    2960:	          41 55                	push   %r13
+    2962:	          41 54                	push   %r12
+    2964:	          55                   	push   %rbp
+    2965:	          53                   	push   %rbx
+    2966:	          48 83 ec 08          	sub    $0x8,%rsp
+{
+    if (shared_ != nullptr) { destroy(shared_); }
+    296a:	          48 8b 2f             	mov    (%rdi),%rbp
+    296d:	          48 85 ed             	test   %rbp,%rbp
+    2970:	/-------- 0f 84 9a 00 00 00    	je     2a10 <nel::par::Pool::~Pool()+0xb0>
+    pthread_mutex_lock(&s->lock_);
+    2976:	|         4c 8d 65 40          	lea    0x40(%rbp),%r12
+    pthread_cond_broadcast(&s->wake_);
+    297a:	|         4c 8d 6d 68          	lea    0x68(%rbp),%r13
+    pthread_mutex_lock(&s->lock_);
+    297e:	|         4c 89 e7             	mov    %r12,%rdi
+    2981:	|         e8 1a e8 ff ff       	call   11a0 <pthread_mutex_lock@plt>
+    s->stop_ = true;
+    2986:	|         c6 85 d8 00 00 00 01 	movb   $0x1,0xd8(%rbp)
+    pthread_cond_broadcast(&s->wake_);
+    298d:	|         4c 89 ef             	mov    %r13,%rdi
+    2990:	|         e8 bb e6 ff ff       	call   1050 <pthread_cond_broadcast@plt>
+    pthread_mutex_unlock(&s->lock_);
+    2995:	|         4c 89 e7             	mov    %r12,%rdi
+    2998:	|         e8 73 e7 ff ff       	call   1110 <pthread_mutex_unlock@plt>
+    for (Index i = 0; i < s->n_workers_; ++i) {
+    299d:	|         48 83 7d 08 00       	cmpq   $0x0,0x8(%rbp)
+    29a2:	|  /----- 74 25                	je     29c9 <nel::par::Pool::~Pool()+0x69>
+    29a4:	|  |      31 db                	xor    %ebx,%ebx
+    29a6:	|  |      66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    29ad:	|  |      00 00 00 
+        pthread_join(s->workers_[i], nullptr);
+    29b0:	|  |  /-> 48 8b 45 10          	mov    0x10(%rbp),%rax
+    29b4:	|  |  |   31 f6                	xor    %esi,%esi
+    29b6:	|  |  |   48 8b 3c d8          	mov    (%rax,%rbx,8),%rdi
+    for (Index i = 0; i < s->n_workers_; ++i) {
+    29ba:	|  |  |   48 83 c3 01          	add    $0x1,%rbx
+        pthread_join(s->workers_[i], nullptr);
+    29be:	|  |  |   e8 bd e7 ff ff       	call   1180 <pthread_join@plt>
+    for (Index i = 0; i < s->n_workers_; ++i) {
+    29c3:	|  |  |   48 3b 5d 08          	cmp    0x8(%rbp),%rbx
+    29c7:	|  |  \-- 72 e7                	jb     29b0 <nel::par::Pool::~Pool()+0x50>
+    pthread_cond_destroy(&s->idle_);
+    29c9:	|  \----> 48 8d bd 98 00 00 00 	lea    0x98(%rbp),%rdi
+    29d0:	|         e8 8b e7 ff ff       	call   1160 <pthread_cond_destroy@plt>
+    pthread_cond_destroy(&s->wake_);
+    29d5:	|         4c 89 ef             	mov    %r13,%rdi
+    29d8:	|         e8 83 e7 ff ff       	call   1160 <pthread_cond_destroy@plt>
+    pthread_mutex_destroy(&s->lock_);
+    29dd:	|         4c 89 e7             	mov    %r12,%rdi
+    29e0:	|         e8 9b e6 ff ff       	call   1080 <pthread_mutex_destroy@plt>
+    pthread_mutex_destroy(&s->run_lock_);
+    29e5:	|         48 8d 7d 18          	lea    0x18(%rbp),%rdi
+    29e9:	|         e8 92 e6 ff ff       	call   1080 <pthread_mutex_destroy@plt>
+    if (s->workers_ != nullptr) {
+    29ee:	|         48 8b 7d 10          	mov    0x10(%rbp),%rdi
+    29f2:	|         48 85 ff             	test   %rdi,%rdi
+    29f5:	|     /-- 74 05                	je     29fc <nel::par::Pool::~Pool()+0x9c>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    29f7:	|     |   e8 34 e6 ff ff       	call   1030 <free@plt>
+}
+    29fc:	|     \-> 48 83 c4 08          	add    $0x8,%rsp
+    2a00:	|         48 89 ef             	mov    %rbp,%rdi
+    2a03:	|         5b                   	pop    %rbx
+    2a04:	|         5d                   	pop    %rbp
+    2a05:	|         41 5c                	pop    %r12
+    2a07:	|         41 5d                	pop    %r13
+    2a09:	|         e9 22 e6 ff ff       	jmp    1030 <free@plt>
+    2a0e:	|         66 90                	xchg   %ax,%ax
+    2a10:	\-------> 48 83 c4 08          	add    $0x8,%rsp
+    2a14:	          5b                   	pop    %rbx
+    2a15:	          5d                   	pop    %rbp
+    2a16:	          41 5c                	pop    %r12
+    2a18:	          41 5d                	pop    %r13
+    2a1a:	          c3                   	ret
+    2a1b:	          90                   	nop
+    2a1c:	          0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002a20 <nel::par::Pool::operator=(nel::par::Pool&&)>:
+
+Pool &Pool::operator=(Pool &&o)
+{
+    2a20:	             41 57                	push   %r15
+    2a22:	             41 56                	push   %r14
+    2a24:	             41 55                	push   %r13
+    2a26:	             41 54                	push   %r12
+    2a28:	             49 89 fc             	mov    %rdi,%r12
+    2a2b:	             55                   	push   %rbp
+    2a2c:	             53                   	push   %rbx
+    2a2d:	             48 83 ec 08          	sub    $0x8,%rsp
+    if (this != &o) {
+    2a31:	             48 39 f7             	cmp    %rsi,%rdi
+    2a34:	/----------- 0f 84 aa 00 00 00    	je     2ae4 <nel::par::Pool::operator=(nel::par::Pool&&)+0xc4>
+        if (shared_ != nullptr) { destroy(shared_); }
+    2a3a:	|            48 8b 2f             	mov    (%rdi),%rbp
+    2a3d:	|            49 89 f5             	mov    %rsi,%r13
+    2a40:	|            48 85 ed             	test   %rbp,%rbp
+    2a43:	|  /-------- 0f 84 8b 00 00 00    	je     2ad4 <nel::par::Pool::operator=(nel::par::Pool&&)+0xb4>
+    pthread_mutex_lock(&s->lock_);
+    2a49:	|  |         4c 8d 75 40          	lea    0x40(%rbp),%r14
+    pthread_cond_broadcast(&s->wake_);
+    2a4d:	|  |         4c 8d 7d 68          	lea    0x68(%rbp),%r15
+    pthread_mutex_lock(&s->lock_);
+    2a51:	|  |         4c 89 f7             	mov    %r14,%rdi
+    2a54:	|  |         e8 47 e7 ff ff       	call   11a0 <pthread_mutex_lock@plt>
+    s->stop_ = true;
+    2a59:	|  |         c6 85 d8 00 00 00 01 	movb   $0x1,0xd8(%rbp)
+    pthread_cond_broadcast(&s->wake_);
+    2a60:	|  |         4c 89 ff             	mov    %r15,%rdi
+    2a63:	|  |         e8 e8 e5 ff ff       	call   1050 <pthread_cond_broadcast@plt>
+    pthread_mutex_unlock(&s->lock_);
+    2a68:	|  |         4c 89 f7             	mov    %r14,%rdi
+    2a6b:	|  |         e8 a0 e6 ff ff       	call   1110 <pthread_mutex_unlock@plt>
+    for (Index i = 0; i < s->n_workers_; ++i) {
+    2a70:	|  |         48 83 7d 08 00       	cmpq   $0x0,0x8(%rbp)
+    2a75:	|  |  /----- 74 22                	je     2a99 <nel::par::Pool::operator=(nel::par::Pool&&)+0x79>
+    2a77:	|  |  |      31 db                	xor    %ebx,%ebx
+    2a79:	|  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        pthread_join(s->workers_[i], nullptr);
+    2a80:	|  |  |  /-> 48 8b 45 10          	mov    0x10(%rbp),%rax
+    2a84:	|  |  |  |   31 f6                	xor    %esi,%esi
+    2a86:	|  |  |  |   48 8b 3c d8          	mov    (%rax,%rbx,8),%rdi
+    for (Index i = 0; i < s->n_workers_; ++i) {
+    2a8a:	|  |  |  |   48 83 c3 01          	add    $0x1,%rbx
+        pthread_join(s->workers_[i], nullptr);
+    2a8e:	|  |  |  |   e8 ed e6 ff ff       	call   1180 <pthread_join@plt>
+    for (Index i = 0; i < s->n_workers_; ++i) {
+    2a93:	|  |  |  |   48 3b 5d 08          	cmp    0x8(%rbp),%rbx
+    2a97:	|  |  |  \-- 72 e7                	jb     2a80 <nel::par::Pool::operator=(nel::par::Pool&&)+0x60>
+    pthread_cond_destroy(&s->idle_);
+    2a99:	|  |  \----> 48 8d bd 98 00 00 00 	lea    0x98(%rbp),%rdi
+    2aa0:	|  |         e8 bb e6 ff ff       	call   1160 <pthread_cond_destroy@plt>
+    pthread_cond_destroy(&s->wake_);
+    2aa5:	|  |         4c 89 ff             	mov    %r15,%rdi
+    2aa8:	|  |         e8 b3 e6 ff ff       	call   1160 <pthread_cond_destroy@plt>
+    pthread_mutex_destroy(&s->lock_);
+    2aad:	|  |         4c 89 f7             	mov    %r14,%rdi
+    2ab0:	|  |         e8 cb e5 ff ff       	call   1080 <pthread_mutex_destroy@plt>
+    pthread_mutex_destroy(&s->run_lock_);
+    2ab5:	|  |         48 8d 7d 18          	lea    0x18(%rbp),%rdi
+    2ab9:	|  |         e8 c2 e5 ff ff       	call   1080 <pthread_mutex_destroy@plt>
+    if (s->workers_ != nullptr) {
+    2abe:	|  |         48 8b 7d 10          	mov    0x10(%rbp),%rdi
+    2ac2:	|  |         48 85 ff             	test   %rdi,%rdi
+    2ac5:	|  |     /-- 74 05                	je     2acc <nel::par::Pool::operator=(nel::par::Pool&&)+0xac>
+    2ac7:	|  |     |   e8 64 e5 ff ff       	call   1030 <free@plt>
+    2acc:	|  |     \-> 48 89 ef             	mov    %rbp,%rdi
+    2acf:	|  |         e8 5c e5 ff ff       	call   1030 <free@plt>
+        shared_ = o.shared_;
+    2ad4:	|  \-------> 49 8b 45 00          	mov    0x0(%r13),%rax
+    2ad8:	|            49 89 04 24          	mov    %rax,(%r12)
+        o.shared_ = nullptr;
+    2adc:	|            49 c7 45 00 00 00 00 	movq   $0x0,0x0(%r13)
+    2ae3:	|            00 
+    }
+    return *this;
+}
+    2ae4:	\----------> 48 83 c4 08          	add    $0x8,%rsp
+    2ae8:	             4c 89 e0             	mov    %r12,%rax
+    2aeb:	             5b                   	pop    %rbx
+    2aec:	             5d                   	pop    %rbp
+    2aed:	             41 5c                	pop    %r12
+    2aef:	             41 5d                	pop    %r13
+    2af1:	             41 5e                	pop    %r14
+    2af3:	             41 5f                	pop    %r15
+    2af5:	             c3                   	ret
+    2af6:	             66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2afd:	             00 00 00 
+
+0000000000002b00 <nel::par::Pool::available_parallelism()>:
+
+Count Pool::available_parallelism(void)
+{
+    2b00:	48 83 ec 08          	sub    $0x8,%rsp
+#if defined(NEL_PAR_PTHREADS)
+    long const n = sysconf(_SC_NPROCESSORS_ONLN);
+    2b04:	bf 54 00 00 00       	mov    $0x54,%edi
+    2b09:	e8 62 e6 ff ff       	call   1170 <sysconf@plt>
+    return (n < 1) ? 1 : Count(n);
+    2b0e:	ba 01 00 00 00       	mov    $0x1,%edx
+    2b13:	48 85 c0             	test   %rax,%rax
+    2b16:	48 0f 4e c2          	cmovle %rdx,%rax
+#else
+    return 1;
+#endif
+}
+    2b1a:	48 83 c4 08          	add    $0x8,%rsp
+    2b1e:	c3                   	ret
+    2b1f:	90                   	nop
+
+0000000000002b20 <nel::par::Pool::try_new(unsigned long)>:
+
+Result<Pool, ParError> Pool::try_new(Count const n)
+{
+    2b20:	                   41 57                	push   %r15
+    2b22:	                   41 56                	push   %r14
+    2b24:	                   41 55                	push   %r13
+    2b26:	                   41 54                	push   %r12
+    2b28:	                   55                   	push   %rbp
+    2b29:	                   48 89 fd             	mov    %rdi,%rbp
+    2b2c:	                   53                   	push   %rbx
+    2b2d:	                   48 89 f3             	mov    %rsi,%rbx
+    2b30:	                   48 83 ec 28          	sub    $0x28,%rsp
+#if defined(NEL_PAR_PTHREADS)
+    Count const n_threads = (n == 0) ? available_parallelism() : n;
+    2b34:	                   48 85 f6             	test   %rsi,%rsi
+    2b37:	      /----------- 0f 84 e3 00 00 00    	je     2c20 <nel::par::Pool::try_new(unsigned long)+0x100>
+                                    : std::realloc(p, new_size);
+    2b3d:	   /--|----------> bf 08 01 00 00       	mov    $0x108,%edi
+    2b42:	   |  |            e8 d9 e5 ff ff       	call   1120 <malloc@plt>
+    2b47:	   |  |            49 89 c7             	mov    %rax,%r15
+            if (new_p == nullptr) {
+    2b4a:	   |  |            48 85 c0             	test   %rax,%rax
+    2b4d:	   |  |     /----- 0f 84 ad 00 00 00    	je     2c00 <nel::par::Pool::try_new(unsigned long)+0xe0>
+    if (rs.is_err()) { return Result<Pool, ParError>::Err(ParError::OutOfMemory); }
+    Shared *const s = static_cast<Shared *>(rs.unwrap());
+    s->n_threads_ = n_threads;
+    s->task_ = nullptr;
+    s->ctx_ = nullptr;
+    s->n_chunks_ = 0;
+    2b53:	   |  |     |      66 0f ef c0          	pxor   %xmm0,%xmm0
+    s->n_threads_ = n_threads;
+    2b57:	   |  |     |      48 89 18             	mov    %rbx,(%rax)
+    s->n_workers_ = 0;
+    s->workers_ = nullptr;
+    s->generation_ = 0;
+    s->busy_ = 0;
+    s->stop_ = false;
+    pthread_mutex_init(&s->run_lock_, nullptr);
+    2b5a:	   |  |     |      48 8d 40 18          	lea    0x18(%rax),%rax
+    2b5e:	   |  |     |      31 f6                	xor    %esi,%esi
+    s->task_ = nullptr;
+    2b60:	   |  |     |      48 c7 80 c8 00 00 00 	movq   $0x0,0xc8(%rax)
+    2b67:	   |  |     |      00 00 00 00 
+    pthread_mutex_init(&s->lock_, nullptr);
+    2b6b:	   |  |     |      4d 8d 6f 40          	lea    0x40(%r15),%r13
+    s->ctx_ = nullptr;
+    2b6f:	   |  |     |      48 c7 80 d0 00 00 00 	movq   $0x0,0xd0(%rax)
+    2b76:	   |  |     |      00 00 00 00 
+    s->failed_ = false;
+    2b7a:	   |  |     |      c6 80 e8 00 00 00 00 	movb   $0x0,0xe8(%rax)
+    s->n_workers_ = 0;
+    2b81:	   |  |     |      48 c7 40 f0 00 00 00 	movq   $0x0,-0x10(%rax)
+    2b88:	   |  |     |      00 
+    s->workers_ = nullptr;
+    2b89:	   |  |     |      48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+    2b90:	   |  |     |      00 
+    s->stop_ = false;
+    2b91:	   |  |     |      c6 80 c0 00 00 00 00 	movb   $0x0,0xc0(%rax)
+    s->n_chunks_ = 0;
+    2b98:	   |  |     |      0f 11 80 d8 00 00 00 	movups %xmm0,0xd8(%rax)
+    s->generation_ = 0;
+    2b9f:	   |  |     |      0f 11 80 b0 00 00 00 	movups %xmm0,0xb0(%rax)
+    pthread_mutex_init(&s->run_lock_, nullptr);
+    2ba6:	   |  |     |      48 89 c7             	mov    %rax,%rdi
+    2ba9:	   |  |     |      48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    2bae:	   |  |     |      e8 dd e5 ff ff       	call   1190 <pthread_mutex_init@plt>
+    pthread_mutex_init(&s->lock_, nullptr);
+    2bb3:	   |  |     |      31 f6                	xor    %esi,%esi
+    2bb5:	   |  |     |      4c 89 ef             	mov    %r13,%rdi
+    2bb8:	   |  |     |      e8 d3 e5 ff ff       	call   1190 <pthread_mutex_init@plt>
+    pthread_cond_init(&s->wake_, nullptr);
+    2bbd:	   |  |     |      49 8d 47 68          	lea    0x68(%r15),%rax
+    2bc1:	   |  |     |      31 f6                	xor    %esi,%esi
+    2bc3:	   |  |     |      48 89 c7             	mov    %rax,%rdi
+    2bc6:	   |  |     |      48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    2bcb:	   |  |     |      e8 30 e5 ff ff       	call   1100 <pthread_cond_init@plt>
+    pthread_cond_init(&s->idle_, nullptr);
+    2bd0:	   |  |     |      49 8d 87 98 00 00 00 	lea    0x98(%r15),%rax
+    2bd7:	   |  |     |      31 f6                	xor    %esi,%esi
+    2bd9:	   |  |     |      48 89 c7             	mov    %rax,%rdi
+    2bdc:	   |  |     |      48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    2be1:	   |  |     |      e8 1a e5 ff ff       	call   1100 <pthread_cond_init@plt>
+
+    // Pool now owns s, so destroys it on any failure below.
+    Pool pool(s);
+
+    if (n_threads > 1) {
+    2be6:	   |  |     |      48 83 fb 01          	cmp    $0x1,%rbx
+    2bea:	   |  |     |  /-- 75 54                	jne    2c40 <nel::par::Pool::try_new(unsigned long)+0x120>
+            : tag_(Tag::OK)
+    2bec:	   |  |  /--|--|-> c7 45 00 01 00 00 00 	movl   $0x1,0x0(%rbp)
+            : shared_(o.shared_)
+    2bf3:	   |  |  |  |  |   4c 89 7d 08          	mov    %r15,0x8(%rbp)
+    if (shared_ != nullptr) { destroy(shared_); }
+    2bf7:	/--|--|--|--|--|-- eb 15                	jmp    2c0e <nel::par::Pool::try_new(unsigned long)+0xee>
+    2bf9:	|  |  |  |  |  |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            : tag_(Tag::ERR)
+    2c00:	|  |  |  |  \--|-> c7 45 00 02 00 00 00 	movl   $0x2,0x0(%rbp)
+
+        constexpr Element(Element &&o) = default;
+        constexpr Element &operator=(Element &&o) = default;
+
+        constexpr Element(Type &&val)
+            : value_(forward<Type>(val))
+    2c07:	|  |  |  |     |   c7 45 08 03 00 00 00 	movl   $0x3,0x8(%rbp)
+    }
+    return Result<Pool, ParError>::Ok(move(pool));
+#else
+    return Result<Pool, ParError>::Ok(Pool(s));
+#endif
+}
+    2c0e:	>--|--|--|-----|-> 48 83 c4 28          	add    $0x28,%rsp
+    2c12:	|  |  |  |     |   48 89 e8             	mov    %rbp,%rax
+    2c15:	|  |  |  |     |   5b                   	pop    %rbx
+    2c16:	|  |  |  |     |   5d                   	pop    %rbp
+    2c17:	|  |  |  |     |   41 5c                	pop    %r12
+    2c19:	|  |  |  |     |   41 5d                	pop    %r13
+    2c1b:	|  |  |  |     |   41 5e                	pop    %r14
+    2c1d:	|  |  |  |     |   41 5f                	pop    %r15
+    2c1f:	|  |  |  |     |   c3                   	ret
+    long const n = sysconf(_SC_NPROCESSORS_ONLN);
+    2c20:	|  |  \--|-----|-> bf 54 00 00 00       	mov    $0x54,%edi
+    2c25:	|  |     |     |   e8 46 e5 ff ff       	call   1170 <sysconf@plt>
+    return (n < 1) ? 1 : Count(n);
+    2c2a:	|  |     |     |   ba 01 00 00 00       	mov    $0x1,%edx
+    2c2f:	|  |     |     |   48 85 c0             	test   %rax,%rax
+    2c32:	|  |     |     |   48 0f 4f d0          	cmovg  %rax,%rdx
+    2c36:	|  |     |     |   48 89 d3             	mov    %rdx,%rbx
+    2c39:	|  \-----|-----|-- e9 ff fe ff ff       	jmp    2b3d <nel::par::Pool::try_new(unsigned long)+0x1d>
+    2c3e:	|        |     |   66 90                	xchg   %ax,%ax
+        auto rw = Alloc::try_malloc(alignof(pthread_t), (n_threads - 1) * sizeof(pthread_t));
+    2c40:	|        |     \-> 48 83 eb 01          	sub    $0x1,%rbx
+    2c44:	|        |         48 8d 3c dd 00 00 00 	lea    0x0(,%rbx,8),%rdi
+    2c4b:	|        |         00 
+                                    : std::realloc(p, new_size);
+    2c4c:	|        |         e8 cf e4 ff ff       	call   1120 <malloc@plt>
+            if (new_p == nullptr) {
+    2c51:	|        |         48 85 c0             	test   %rax,%rax
+    2c54:	|     /--|-------- 0f 84 de 00 00 00    	je     2d38 <nel::par::Pool::try_new(unsigned long)+0x218>
+        s->workers_ = static_cast<pthread_t *>(rw.unwrap());
+    2c5a:	|     |  |         49 89 47 10          	mov    %rax,0x10(%r15)
+    2c5e:	|     |  |         45 31 f6             	xor    %r14d,%r14d
+    2c61:	|     |  |         4c 8d 25 e8 fb ff ff 	lea    -0x418(%rip),%r12        # 2850 <nel::par::(anonymous namespace)::worker_main(void*)>
+    2c68:	|     |  |     /-- eb 1c                	jmp    2c86 <nel::par::Pool::try_new(unsigned long)+0x166>
+    2c6a:	|     |  |     |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    for (Index i = 0; i < n_threads - 1; ++i) {
+    2c70:	|     |  |  /--|-> 49 83 c6 01          	add    $0x1,%r14
+        s->n_workers_ += 1;
+    2c74:	|     |  |  |  |   49 83 47 08 01       	addq   $0x1,0x8(%r15)
+    for (Index i = 0; i < n_threads - 1; ++i) {
+    2c79:	|     |  |  |  |   4c 39 f3             	cmp    %r14,%rbx
+    2c7c:	|     |  \--|--|-- 0f 84 6a ff ff ff    	je     2bec <nel::par::Pool::try_new(unsigned long)+0xcc>
+        if (pthread_create(&s->workers_[i], nullptr, worker_main, s) != 0) {
+    2c82:	|     |     |  |   49 8b 47 10          	mov    0x10(%r15),%rax
+    2c86:	|     |     |  \-> 31 f6                	xor    %esi,%esi
+    2c88:	|     |     |      4a 8d 3c f0          	lea    (%rax,%r14,8),%rdi
+    2c8c:	|     |     |      4c 89 f9             	mov    %r15,%rcx
+    2c8f:	|     |     |      4c 89 e2             	mov    %r12,%rdx
+    2c92:	|     |     |      e8 a9 e4 ff ff       	call   1140 <pthread_create@plt>
+    2c97:	|     |     |      85 c0                	test   %eax,%eax
+    2c99:	|     |     \----- 74 d5                	je     2c70 <nel::par::Pool::try_new(unsigned long)+0x150>
+    2c9b:	|     |            c7 45 00 02 00 00 00 	movl   $0x2,0x0(%rbp)
+    2ca2:	|     |            c7 45 08 01 00 00 00 	movl   $0x1,0x8(%rbp)
+    pthread_mutex_lock(&s->lock_);
+    2ca9:	|     |  /-------> 4c 89 ef             	mov    %r13,%rdi
+    for (Index i = 0; i < s->n_workers_; ++i) {
+    2cac:	|     |  |         31 db                	xor    %ebx,%ebx
+    pthread_mutex_lock(&s->lock_);
+    2cae:	|     |  |         e8 ed e4 ff ff       	call   11a0 <pthread_mutex_lock@plt>
+    s->stop_ = true;
+    2cb3:	|     |  |         41 c6 87 d8 00 00 00 	movb   $0x1,0xd8(%r15)
+    2cba:	|     |  |         01 
+    pthread_cond_broadcast(&s->wake_);
+    2cbb:	|     |  |         48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    2cc0:	|     |  |         e8 8b e3 ff ff       	call   1050 <pthread_cond_broadcast@plt>
+    pthread_mutex_unlock(&s->lock_);
+    2cc5:	|     |  |         4c 89 ef             	mov    %r13,%rdi
+    2cc8:	|     |  |         e8 43 e4 ff ff       	call   1110 <pthread_mutex_unlock@plt>
+    for (Index i = 0; i < s->n_workers_; ++i) {
+    2ccd:	|     |  |         49 83 7f 08 00       	cmpq   $0x0,0x8(%r15)
+    2cd2:	|     |  |  /----- 74 1d                	je     2cf1 <nel::par::Pool::try_new(unsigned long)+0x1d1>
+    2cd4:	|     |  |  |      0f 1f 40 00          	nopl   0x0(%rax)
+        pthread_join(s->workers_[i], nullptr);
+    2cd8:	|     |  |  |  /-> 49 8b 47 10          	mov    0x10(%r15),%rax
+    2cdc:	|     |  |  |  |   31 f6                	xor    %esi,%esi
+    2cde:	|     |  |  |  |   48 8b 3c d8          	mov    (%rax,%rbx,8),%rdi
+    for (Index i = 0; i < s->n_workers_; ++i) {
+    2ce2:	|     |  |  |  |   48 83 c3 01          	add    $0x1,%rbx
+        pthread_join(s->workers_[i], nullptr);
+    2ce6:	|     |  |  |  |   e8 95 e4 ff ff       	call   1180 <pthread_join@plt>
+    for (Index i = 0; i < s->n_workers_; ++i) {
+    2ceb:	|     |  |  |  |   49 3b 5f 08          	cmp    0x8(%r15),%rbx
+    2cef:	|     |  |  |  \-- 72 e7                	jb     2cd8 <nel::par::Pool::try_new(unsigned long)+0x1b8>
+    pthread_cond_destroy(&s->idle_);
+    2cf1:	|     |  |  \----> 48 8b 7c 24 18       	mov    0x18(%rsp),%rdi
+    2cf6:	|     |  |         e8 65 e4 ff ff       	call   1160 <pthread_cond_destroy@plt>
+    pthread_cond_destroy(&s->wake_);
+    2cfb:	|     |  |         48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    2d00:	|     |  |         e8 5b e4 ff ff       	call   1160 <pthread_cond_destroy@plt>
+    pthread_mutex_destroy(&s->lock_);
+    2d05:	|     |  |         4c 89 ef             	mov    %r13,%rdi
+    2d08:	|     |  |         e8 73 e3 ff ff       	call   1080 <pthread_mutex_destroy@plt>
+    pthread_mutex_destroy(&s->run_lock_);
+    2d0d:	|     |  |         48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    2d12:	|     |  |         e8 69 e3 ff ff       	call   1080 <pthread_mutex_destroy@plt>
+    if (s->workers_ != nullptr) {
+    2d17:	|     |  |         49 8b 7f 10          	mov    0x10(%r15),%rdi
+    2d1b:	|     |  |         48 85 ff             	test   %rdi,%rdi
+    2d1e:	|     |  |     /-- 74 05                	je     2d25 <nel::par::Pool::try_new(unsigned long)+0x205>
+                std::free(p);
+    2d20:	|     |  |     |   e8 0b e3 ff ff       	call   1030 <free@plt>
+    2d25:	|     |  |     \-> 4c 89 ff             	mov    %r15,%rdi
+    2d28:	|     |  |         e8 03 e3 ff ff       	call   1030 <free@plt>
+}
+    2d2d:	\-----|--|-------- e9 dc fe ff ff       	jmp    2c0e <nel::par::Pool::try_new(unsigned long)+0xee>
+    2d32:	      |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    2d38:	      \--|-------> c7 45 00 02 00 00 00 	movl   $0x2,0x0(%rbp)
+    2d3f:	         |         c7 45 08 03 00 00 00 	movl   $0x3,0x8(%rbp)
+    if (shared_ != nullptr) { destroy(shared_); }
+    2d46:	         \-------- e9 5e ff ff ff       	jmp    2ca9 <nel::par::Pool::try_new(unsigned long)+0x189>
+    2d4b:	                   90                   	nop
+    2d4c:	                   0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002d50 <nel::par::Pool::n_threads() const>:
+
+Count Pool::n_threads(void) const
+{
+    return shared_->n_threads_;
+    2d50:	48 8b 07             	mov    (%rdi),%rax
+    2d53:	48 8b 00             	mov    (%rax),%rax
+}
+    2d56:	c3                   	ret
+    2d57:	90                   	nop
+    2d58:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    2d5f:	00 
+
+0000000000002d60 <nel::par::Pool::chunk_len(unsigned long, unsigned long) const>:
+
+Length Pool::chunk_len(Length const len, Length const item_size) const
+{
+    2d60:	    48 89 f1             	mov    %rsi,%rcx
+    // fewest items that make whole cache lines: cache_line / gcd(item_size, cache_line).
+    Length const pow2 = item_size & (~item_size + 1);
+    2d63:	    48 89 d6             	mov    %rdx,%rsi
+{
+    2d66:	    49 89 f9             	mov    %rdi,%r9
+    Length const line_items = cache_line / ((pow2 < cache_line) ? pow2 : cache_line);
+    2d69:	    b8 40 00 00 00       	mov    $0x40,%eax
+    Length const pow2 = item_size & (~item_size + 1);
+    2d6e:	    48 f7 de             	neg    %rsi
+{
+    2d71:	    48 89 d7             	mov    %rdx,%rdi
+    Length const min_items = (item_size < min_chunk_bytes) ? min_chunk_bytes / item_size : 1;
+    2d74:	    41 b8 01 00 00 00    	mov    $0x1,%r8d
+    Length const pow2 = item_size & (~item_size + 1);
+    2d7a:	    48 21 d6             	and    %rdx,%rsi
+    Length const line_items = cache_line / ((pow2 < cache_line) ? pow2 : cache_line);
+    2d7d:	    48 39 c6             	cmp    %rax,%rsi
+    2d80:	    48 0f 47 f0          	cmova  %rax,%rsi
+    2d84:	    31 d2                	xor    %edx,%edx
+    2d86:	    48 f7 f6             	div    %rsi
+    2d89:	    48 89 c6             	mov    %rax,%rsi
+    Length const min_items = (item_size < min_chunk_bytes) ? min_chunk_bytes / item_size : 1;
+    2d8c:	    48 81 ff ff 7f 00 00 	cmp    $0x7fff,%rdi
+    2d93:	/-- 77 0d                	ja     2da2 <nel::par::Pool::chunk_len(unsigned long, unsigned long) const+0x42>
+    2d95:	|   b8 00 80 00 00       	mov    $0x8000,%eax
+    2d9a:	|   31 d2                	xor    %edx,%edx
+    2d9c:	|   48 f7 f7             	div    %rdi
+    2d9f:	|   49 89 c0             	mov    %rax,%r8
+    return shared_->n_threads_;
+    2da2:	\-> 49 8b 01             	mov    (%r9),%rax
+    Length const even = len / (n_threads() * chunks_per_thread);
+    2da5:	    31 d2                	xor    %edx,%edx
+    2da7:	    48 8b 38             	mov    (%rax),%rdi
+    2daa:	    48 89 c8             	mov    %rcx,%rax
+    2dad:	    48 c1 e7 02          	shl    $0x2,%rdi
+    2db1:	    48 f7 f7             	div    %rdi
+    Length const c = (even > min_items) ? even : min_items;
+    return ((c + line_items - 1) / line_items) * line_items;
+    2db4:	    4c 39 c0             	cmp    %r8,%rax
+    Length const even = len / (n_threads() * chunks_per_thread);
+    2db7:	    48 89 c1             	mov    %rax,%rcx
+    return ((c + line_items - 1) / line_items) * line_items;
+    2dba:	    49 0f 42 c8          	cmovb  %r8,%rcx
+    2dbe:	    31 d2                	xor    %edx,%edx
+    2dc0:	    48 8d 4c 0e ff       	lea    -0x1(%rsi,%rcx,1),%rcx
+    2dc5:	    48 89 c8             	mov    %rcx,%rax
+    2dc8:	    48 f7 f6             	div    %rsi
+    2dcb:	    48 89 c8             	mov    %rcx,%rax
+    2dce:	    48 29 d0             	sub    %rdx,%rax
+}
+    2dd1:	    c3                   	ret
+    2dd2:	    66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2dd9:	    00 00 00 00 
+    2ddd:	    0f 1f 00             	nopl   (%rax)
+
+0000000000002de0 <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const>:
+
+Chunks Pool::chunks(void const *const p, Length const len, Length const item_size) const
+{
+    2de0:	             49 89 ca             	mov    %rcx,%r10
+    Length const pow2 = item_size & (~item_size + 1);
+    2de3:	             4c 89 c1             	mov    %r8,%rcx
+{
+    2de6:	             49 89 f1             	mov    %rsi,%r9
+    Length const line_items = cache_line / ((pow2 < cache_line) ? pow2 : cache_line);
+    2de9:	             b8 40 00 00 00       	mov    $0x40,%eax
+    Length const pow2 = item_size & (~item_size + 1);
+    2dee:	             48 f7 d9             	neg    %rcx
+{
+    2df1:	             48 89 d6             	mov    %rdx,%rsi
+    Length const min_items = (item_size < min_chunk_bytes) ? min_chunk_bytes / item_size : 1;
+    2df4:	             41 bb 01 00 00 00    	mov    $0x1,%r11d
+    Length const pow2 = item_size & (~item_size + 1);
+    2dfa:	             4c 21 c1             	and    %r8,%rcx
+    Length const line_items = cache_line / ((pow2 < cache_line) ? pow2 : cache_line);
+    2dfd:	             48 39 c1             	cmp    %rax,%rcx
+    2e00:	             48 0f 47 c8          	cmova  %rax,%rcx
+    2e04:	             31 d2                	xor    %edx,%edx
+    2e06:	             48 f7 f1             	div    %rcx
+    2e09:	             48 89 c1             	mov    %rax,%rcx
+    Length const min_items = (item_size < min_chunk_bytes) ? min_chunk_bytes / item_size : 1;
+    2e0c:	             49 81 f8 ff 7f 00 00 	cmp    $0x7fff,%r8
+    2e13:	         /-- 77 0d                	ja     2e22 <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const+0x42>
+    2e15:	         |   b8 00 80 00 00       	mov    $0x8000,%eax
+    2e1a:	         |   31 d2                	xor    %edx,%edx
+    2e1c:	         |   49 f7 f0             	div    %r8
+    2e1f:	         |   49 89 c3             	mov    %rax,%r11
+    return shared_->n_threads_;
+    2e22:	         \-> 49 8b 01             	mov    (%r9),%rax
+    Length const even = len / (n_threads() * chunks_per_thread);
+    2e25:	             31 d2                	xor    %edx,%edx
+    2e27:	             4c 8b 08             	mov    (%rax),%r9
+    2e2a:	             4c 89 d0             	mov    %r10,%rax
+    2e2d:	             49 c1 e1 02          	shl    $0x2,%r9
+    2e31:	             49 f7 f1             	div    %r9
+    return ((c + line_items - 1) / line_items) * line_items;
+    2e34:	             4c 39 d8             	cmp    %r11,%rax
+    2e37:	             49 0f 42 c3          	cmovb  %r11,%rax
+    2e3b:	             31 d2                	xor    %edx,%edx
+    2e3d:	             4c 8d 4c 01 ff       	lea    -0x1(%rcx,%rax,1),%r9
+    2e42:	             4c 89 c8             	mov    %r9,%rax
+    2e45:	             48 f7 f1             	div    %rcx
+    2e48:	             49 29 d1             	sub    %rdx,%r9
+    Length const cl = chunk_len(len, item_size);
+    // items up to the first cache line edge, if an item boundary lands on one.
+    USize const off = reinterpret_cast<USize>(p) % cache_line;
+    Length head = 0;
+    if (off != 0) {
+    2e4b:	             48 89 f2             	mov    %rsi,%rdx
+    2e4e:	             83 e2 3f             	and    $0x3f,%edx
+    2e51:	/----------- 74 2d                	je     2e80 <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const+0xa0>
+        for (Length h = 1; h < cache_line; ++h) {
+            if ((off + h * item_size) % cache_line == 0) {
+    2e53:	|            49 8d 0c 10          	lea    (%r8,%rdx,1),%rcx
+    2e57:	|            f6 c1 3f             	test   $0x3f,%cl
+    2e5a:	|  /-------- 74 45                	je     2ea1 <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const+0xc1>
+    2e5c:	|  |         4c 01 c1             	add    %r8,%rcx
+        for (Length h = 1; h < cache_line; ++h) {
+    2e5f:	|  |         ba 01 00 00 00       	mov    $0x1,%edx
+    2e64:	|  |         0f 1f 40 00          	nopl   0x0(%rax)
+    2e68:	|  |     /-> 48 83 c2 01          	add    $0x1,%rdx
+    2e6c:	|  |     |   48 83 fa 40          	cmp    $0x40,%rdx
+    2e70:	|  |  /--|-- 74 1e                	je     2e90 <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const+0xb0>
+            if ((off + h * item_size) % cache_line == 0) {
+    2e72:	|  |  |  |   48 89 ce             	mov    %rcx,%rsi
+    2e75:	|  |  |  |   4c 01 c1             	add    %r8,%rcx
+    2e78:	|  |  |  |   83 e6 3f             	and    $0x3f,%esi
+    2e7b:	|  |  |  |   48 85 f6             	test   %rsi,%rsi
+    2e7e:	|  |  |  \-- 75 e8                	jne    2e68 <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const+0x88>
+            : len_(len)
+    2e80:	>--|--|----> 4c 89 17             	mov    %r10,(%rdi)
+                break;
+            }
+        }
+    }
+    return Chunks(len, cl, head);
+}
+    2e83:	|  |  |      48 89 f8             	mov    %rdi,%rax
+            , chunk_len_(chunk_len)
+    2e86:	|  |  |      4c 89 4f 08          	mov    %r9,0x8(%rdi)
+            , head_(head)
+    2e8a:	|  |  |      48 89 57 10          	mov    %rdx,0x10(%rdi)
+    2e8e:	|  |  |      c3                   	ret
+    2e8f:	|  |  |      90                   	nop
+    Length head = 0;
+    2e90:	|  |  \----> 31 d2                	xor    %edx,%edx
+            : len_(len)
+    2e92:	|  |         4c 89 17             	mov    %r10,(%rdi)
+}
+    2e95:	|  |         48 89 f8             	mov    %rdi,%rax
+            , chunk_len_(chunk_len)
+    2e98:	|  |         4c 89 4f 08          	mov    %r9,0x8(%rdi)
+            , head_(head)
+    2e9c:	|  |         48 89 57 10          	mov    %rdx,0x10(%rdi)
+    2ea0:	|  |         c3                   	ret
+        for (Length h = 1; h < cache_line; ++h) {
+    2ea1:	|  \-------> ba 01 00 00 00       	mov    $0x1,%edx
+    2ea6:	\----------- eb d8                	jmp    2e80 <nel::par::Pool::chunks(void const*, unsigned long, unsigned long) const+0xa0>
+    2ea8:	             0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    2eaf:	             00 
+
+0000000000002eb0 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)>:
+
+Result<void, ParError> Pool::run(Count const n_chunks, Task const task, void *const ctx)
+{
+    2eb0:	                      41 57                	push   %r15
+    2eb2:	                      41 56                	push   %r14
+    2eb4:	                      41 55                	push   %r13
+    2eb6:	                      41 54                	push   %r12
+    2eb8:	                      55                   	push   %rbp
+    2eb9:	                      53                   	push   %rbx
+    2eba:	                      48 83 ec 28          	sub    $0x28,%rsp
+    Shared *const s = shared_;
+    2ebe:	                      4c 8b 36             	mov    (%rsi),%r14
+{
+    2ec1:	                      48 89 7c 24 08       	mov    %rdi,0x8(%rsp)
+    if (n_chunks == 0) { return Result<void, ParError>::Ok(); }
+    2ec6:	                      48 85 d2             	test   %rdx,%rdx
+    2ec9:	                  /-- 75 1d                	jne    2ee8 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x38>
+            : tag_(Tag::OK)
+    2ecb:	                  |   c7 07 01 00 00 00    	movl   $0x1,(%rdi)
+    pthread_mutex_unlock(&s->run_lock_);
+#endif
+
+    if (failed) { return Result<void, ParError>::Err(ParError::Cancelled); }
+    return Result<void, ParError>::Ok();
+}
+    2ed1:	                  |   48 83 c4 28          	add    $0x28,%rsp
+    2ed5:	                  |   48 89 f8             	mov    %rdi,%rax
+    2ed8:	                  |   5b                   	pop    %rbx
+    2ed9:	                  |   5d                   	pop    %rbp
+    2eda:	                  |   41 5c                	pop    %r12
+    2edc:	                  |   41 5d                	pop    %r13
+    2ede:	                  |   41 5e                	pop    %r14
+    2ee0:	                  |   41 5f                	pop    %r15
+    2ee2:	                  |   c3                   	ret
+    2ee3:	                  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    pthread_mutex_lock(&s->run_lock_);
+    2ee8:	                  \-> 49 8d 46 18          	lea    0x18(%r14),%rax
+    2eec:	                      48 89 d5             	mov    %rdx,%rbp
+    2eef:	                      49 89 cc             	mov    %rcx,%r12
+    2ef2:	                      4d 89 c5             	mov    %r8,%r13
+    2ef5:	                      48 89 c7             	mov    %rax,%rdi
+    2ef8:	                      48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    2efd:	                      e8 9e e2 ff ff       	call   11a0 <pthread_mutex_lock@plt>
+    bool const wake = s->n_workers_ > 0 && n_chunks > 1;
+    2f02:	                      49 83 7e 08 00       	cmpq   $0x0,0x8(%r14)
+    s->task_ = task;
+    2f07:	                      4d 89 a6 e0 00 00 00 	mov    %r12,0xe0(%r14)
+    bool const wake = s->n_workers_ > 0 && n_chunks > 1;
+    2f0e:	                      0f 95 c2             	setne  %dl
+    2f11:	                      48 83 fd 01          	cmp    $0x1,%rbp
+    s->ctx_ = ctx;
+    2f15:	                      4d 89 ae e8 00 00 00 	mov    %r13,0xe8(%r14)
+    bool const wake = s->n_workers_ > 0 && n_chunks > 1;
+    2f1c:	                      0f 95 c0             	setne  %al
+    s->n_chunks_ = n_chunks;
+    2f1f:	                      49 89 ae f0 00 00 00 	mov    %rbp,0xf0(%r14)
+    bool const wake = s->n_workers_ > 0 && n_chunks > 1;
+    2f26:	                      20 c2                	and    %al,%dl
+    s->failed_ = false;
+    2f28:	                      41 c6 86 00 01 00 00 	movb   $0x0,0x100(%r14)
+    2f2f:	                      00 
+    s->next_ = 0;
+    2f30:	                      49 c7 86 f8 00 00 00 	movq   $0x0,0xf8(%r14)
+    2f37:	                      00 00 00 00 
+    bool const wake = s->n_workers_ > 0 && n_chunks > 1;
+    2f3b:	                      88 54 24 1f          	mov    %dl,0x1f(%rsp)
+    2f3f:	   /----------------- 0f 85 f3 00 00 00    	jne    3038 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x188>
+    run_chunks(task, ctx, n_chunks, s->next_, s->failed_);
+    2f45:	/--|----------------> 4d 8d be 00 01 00 00 	lea    0x100(%r14),%r15
+    2f4c:	|  |                  49 8d 9e f8 00 00 00 	lea    0xf8(%r14),%rbx
+    while (!__atomic_load_n(&failed, __ATOMIC_RELAXED)) {
+    2f53:	|  |     /----------- eb 1c                	jmp    2f71 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0xc1>
+    2f55:	|  |     |            0f 1f 00             	nopl   (%rax)
+        Index const c = __atomic_fetch_add(&next, 1, __ATOMIC_RELAXED);
+    2f58:	|  |     |     /----> be 01 00 00 00       	mov    $0x1,%esi
+    2f5d:	|  |     |     |      f0 48 0f c1 33       	lock xadd %rsi,(%rbx)
+        if (c >= n_chunks) { break; }
+    2f62:	|  |     |     |      48 39 ee             	cmp    %rbp,%rsi
+    2f65:	|  |     |     |  /-- 73 12                	jae    2f79 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0xc9>
+        if (!task(ctx, c)) { __atomic_store_n(&failed, true, __ATOMIC_RELAXED); }
+    2f67:	|  |     |     |  |   4c 89 ef             	mov    %r13,%rdi
+    2f6a:	|  |     |     |  |   41 ff d4             	call   *%r12
+    2f6d:	|  |     |     |  |   84 c0                	test   %al,%al
+    2f6f:	|  |     |  /--|--|-- 74 6f                	je     2fe0 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x130>
+    while (!__atomic_load_n(&failed, __ATOMIC_RELAXED)) {
+    2f71:	|  |     >--|--|--|-> 41 0f b6 07          	movzbl (%r15),%eax
+    2f75:	|  |     |  |  |  |   84 c0                	test   %al,%al
+    2f77:	|  |     |  |  \--|-- 74 df                	je     2f58 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0xa8>
+    if (wake) {
+    2f79:	|  |     |  |     \-> 80 7c 24 1f 00       	cmpb   $0x0,0x1f(%rsp)
+    2f7e:	|  |     |  |  /----- 75 70                	jne    2ff0 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x140>
+    bool const failed = s->failed_;
+    2f80:	|  |  /--|--|--|----> 41 0f b6 9e 00 01 00 	movzbl 0x100(%r14),%ebx
+    2f87:	|  |  |  |  |  |      00 
+    pthread_mutex_unlock(&s->run_lock_);
+    2f88:	|  |  |  |  |  |      48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    2f8d:	|  |  |  |  |  |      e8 7e e1 ff ff       	call   1110 <pthread_mutex_unlock@plt>
+    if (failed) { return Result<void, ParError>::Err(ParError::Cancelled); }
+    2f92:	|  |  |  |  |  |      84 db                	test   %bl,%bl
+    2f94:	|  |  |  |  |  |  /-- 74 2a                	je     2fc0 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x110>
+            : tag_(Tag::ERR)
+    2f96:	|  |  |  |  |  |  |   48 8b 05 03 13 00 00 	mov    0x1303(%rip),%rax        # 42a0 <_IO_stdin_used+0x2a0>
+    2f9d:	|  |  |  |  |  |  |   48 8b 4c 24 08       	mov    0x8(%rsp),%rcx
+    2fa2:	|  |  |  |  |  |  |   48 89 01             	mov    %rax,(%rcx)
+}
+    2fa5:	|  |  |  |  |  |  |   48 83 c4 28          	add    $0x28,%rsp
+    2fa9:	|  |  |  |  |  |  |   48 89 c8             	mov    %rcx,%rax
+    2fac:	|  |  |  |  |  |  |   5b                   	pop    %rbx
+    2fad:	|  |  |  |  |  |  |   5d                   	pop    %rbp
+    2fae:	|  |  |  |  |  |  |   41 5c                	pop    %r12
+    2fb0:	|  |  |  |  |  |  |   41 5d                	pop    %r13
+    2fb2:	|  |  |  |  |  |  |   41 5e                	pop    %r14
+    2fb4:	|  |  |  |  |  |  |   41 5f                	pop    %r15
+    2fb6:	|  |  |  |  |  |  |   c3                   	ret
+    2fb7:	|  |  |  |  |  |  |   66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    2fbe:	|  |  |  |  |  |  |   00 00 
+            : tag_(Tag::OK)
+    2fc0:	|  |  |  |  |  |  \-> 48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    2fc5:	|  |  |  |  |  |      c7 00 01 00 00 00    	movl   $0x1,(%rax)
+    2fcb:	|  |  |  |  |  |      48 83 c4 28          	add    $0x28,%rsp
+    2fcf:	|  |  |  |  |  |      5b                   	pop    %rbx
+    2fd0:	|  |  |  |  |  |      5d                   	pop    %rbp
+    2fd1:	|  |  |  |  |  |      41 5c                	pop    %r12
+    2fd3:	|  |  |  |  |  |      41 5d                	pop    %r13
+    2fd5:	|  |  |  |  |  |      41 5e                	pop    %r14
+    2fd7:	|  |  |  |  |  |      41 5f                	pop    %r15
+    2fd9:	|  |  |  |  |  |      c3                   	ret
+    2fda:	|  |  |  |  |  |      66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+        if (!task(ctx, c)) { __atomic_store_n(&failed, true, __ATOMIC_RELAXED); }
+    2fe0:	|  |  |  |  \--|----> 41 c6 07 01          	movb   $0x1,(%r15)
+    2fe4:	|  |  |  \-----|----- eb 8b                	jmp    2f71 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0xc1>
+    2fe6:	|  |  |        |      66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2fed:	|  |  |        |      00 00 00 
+        pthread_mutex_lock(&s->lock_);
+    2ff0:	|  |  |        \----> 49 8d 5e 40          	lea    0x40(%r14),%rbx
+            pthread_cond_wait(&s->idle_, &s->lock_);
+    2ff4:	|  |  |               49 8d ae 98 00 00 00 	lea    0x98(%r14),%rbp
+        pthread_mutex_lock(&s->lock_);
+    2ffb:	|  |  |               48 89 df             	mov    %rbx,%rdi
+    2ffe:	|  |  |               e8 9d e1 ff ff       	call   11a0 <pthread_mutex_lock@plt>
+        while (s->busy_ != 0) {
+    3003:	|  |  |               49 83 be d0 00 00 00 	cmpq   $0x0,0xd0(%r14)
+    300a:	|  |  |               00 
+    300b:	|  |  |        /----- 74 18                	je     3025 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x175>
+    300d:	|  |  |        |      0f 1f 00             	nopl   (%rax)
+            pthread_cond_wait(&s->idle_, &s->lock_);
+    3010:	|  |  |        |  /-> 48 89 de             	mov    %rbx,%rsi
+    3013:	|  |  |        |  |   48 89 ef             	mov    %rbp,%rdi
+    3016:	|  |  |        |  |   e8 55 e0 ff ff       	call   1070 <pthread_cond_wait@plt>
+        while (s->busy_ != 0) {
+    301b:	|  |  |        |  |   49 83 be d0 00 00 00 	cmpq   $0x0,0xd0(%r14)
+    3022:	|  |  |        |  |   00 
+    3023:	|  |  |        |  \-- 75 eb                	jne    3010 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x160>
+        pthread_mutex_unlock(&s->lock_);
+    3025:	|  |  |        \----> 48 89 df             	mov    %rbx,%rdi
+    3028:	|  |  |               e8 e3 e0 ff ff       	call   1110 <pthread_mutex_unlock@plt>
+    302d:	|  |  \-------------- e9 4e ff ff ff       	jmp    2f80 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0xd0>
+    3032:	|  |                  66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+        pthread_mutex_lock(&s->lock_);
+    3038:	|  \----------------> 49 8d 5e 40          	lea    0x40(%r14),%rbx
+    303c:	|                     48 89 df             	mov    %rbx,%rdi
+    303f:	|                     e8 5c e1 ff ff       	call   11a0 <pthread_mutex_lock@plt>
+        s->generation_ += 1;
+    3044:	|                     49 8b 86 c8 00 00 00 	mov    0xc8(%r14),%rax
+        pthread_cond_broadcast(&s->wake_);
+    304b:	|                     49 8d 7e 68          	lea    0x68(%r14),%rdi
+        s->generation_ += 1;
+    304f:	|                     48 83 c0 01          	add    $0x1,%rax
+    3053:	|                     66 48 0f 6e c0       	movq   %rax,%xmm0
+    3058:	|                     41 0f 16 46 08       	movhps 0x8(%r14),%xmm0
+    305d:	|                     41 0f 11 86 c8 00 00 	movups %xmm0,0xc8(%r14)
+    3064:	|                     00 
+        pthread_cond_broadcast(&s->wake_);
+    3065:	|                     e8 e6 df ff ff       	call   1050 <pthread_cond_broadcast@plt>
+        pthread_mutex_unlock(&s->lock_);
+    306a:	|                     48 89 df             	mov    %rbx,%rdi
+    306d:	|                     e8 9e e0 ff ff       	call   1110 <pthread_mutex_unlock@plt>
+    3072:	\-------------------- e9 ce fe ff ff       	jmp    2f45 <nel::par::Pool::run(unsigned long, bool (*)(void*, unsigned long), void*)+0x95>
+
+Disassembly of section .fini:
+
+0000000000003078 <_fini>:
+    3078:	48 83 ec 08          	sub    $0x8,%rsp
+    307c:	48 83 c4 08          	add    $0x8,%rsp
+    3080:	c3                   	ret
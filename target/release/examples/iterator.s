@@ -0,0 +1,547 @@
+
+target/release/examples/iterator:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <fputs@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <fputs@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <fputs@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <fputc@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <fputc@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fprintf@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <fprintf@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+0000000000001060 <__cxa_finalize@plt>:
+    1060:	ff 25 7a 2f 00 00    	jmp    *0x2f7a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1066:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+0000000000001070 <main>:
+    do6(a1.iter());
+#endif
+}
+
+int main()
+{
+    1070:	53                   	push   %rbx
+    nel::log << "ex1:b" << '\n';
+    1071:	48 8d 1d d1 2f 00 00 	lea    0x2fd1(%rip),%rbx        # 4049 <nel::log>
+    1078:	48 8d 35 85 0f 00 00 	lea    0xf85(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    107f:	48 89 df             	mov    %rbx,%rdi
+    1082:	e8 59 03 00 00       	call   13e0 <nel::operator<<(nel::Log&, char const*)>
+    1087:	be 0a 00 00 00       	mov    $0xa,%esi
+    108c:	48 89 c7             	mov    %rax,%rdi
+    108f:	e8 2c 03 00 00       	call   13c0 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    1094:	e8 a7 02 00 00       	call   1340 <ex1()>
+    nel::log << "ex1:e" << '\n';
+    1099:	48 89 df             	mov    %rbx,%rdi
+    109c:	48 8d 35 67 0f 00 00 	lea    0xf67(%rip),%rsi        # 200a <_IO_stdin_used+0xa>
+    10a3:	e8 38 03 00 00       	call   13e0 <nel::operator<<(nel::Log&, char const*)>
+    10a8:	be 0a 00 00 00       	mov    $0xa,%esi
+    10ad:	48 89 c7             	mov    %rax,%rdi
+    10b0:	e8 0b 03 00 00       	call   13c0 <nel::operator<<(nel::Log&, char)>
+}
+    10b5:	31 c0                	xor    %eax,%eax
+    10b7:	5b                   	pop    %rbx
+    10b8:	c3                   	ret
+    10b9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000010c0 <_start>:
+    10c0:	31 ed                	xor    %ebp,%ebp
+    10c2:	49 89 d1             	mov    %rdx,%r9
+    10c5:	5e                   	pop    %rsi
+    10c6:	48 89 e2             	mov    %rsp,%rdx
+    10c9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    10cd:	50                   	push   %rax
+    10ce:	54                   	push   %rsp
+    10cf:	45 31 c0             	xor    %r8d,%r8d
+    10d2:	31 c9                	xor    %ecx,%ecx
+    10d4:	48 8d 3d 95 ff ff ff 	lea    -0x6b(%rip),%rdi        # 1070 <main>
+    10db:	ff 15 df 2e 00 00    	call   *0x2edf(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    10e1:	f4                   	hlt
+    10e2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    10e9:	00 00 00 
+    10ec:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000010f0 <deregister_tm_clones>:
+    10f0:	    48 8d 3d 31 2f 00 00 	lea    0x2f31(%rip),%rdi        # 4028 <__TMC_END__>
+    10f7:	    48 8d 05 2a 2f 00 00 	lea    0x2f2a(%rip),%rax        # 4028 <__TMC_END__>
+    10fe:	    48 39 f8             	cmp    %rdi,%rax
+    1101:	/-- 74 15                	je     1118 <deregister_tm_clones+0x28>
+    1103:	|   48 8b 05 be 2e 00 00 	mov    0x2ebe(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    110a:	|   48 85 c0             	test   %rax,%rax
+    110d:	+-- 74 09                	je     1118 <deregister_tm_clones+0x28>
+    110f:	|   ff e0                	jmp    *%rax
+    1111:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1118:	\-> c3                   	ret
+    1119:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001120 <register_tm_clones>:
+    1120:	    48 8d 3d 01 2f 00 00 	lea    0x2f01(%rip),%rdi        # 4028 <__TMC_END__>
+    1127:	    48 8d 35 fa 2e 00 00 	lea    0x2efa(%rip),%rsi        # 4028 <__TMC_END__>
+    112e:	    48 29 fe             	sub    %rdi,%rsi
+    1131:	    48 89 f0             	mov    %rsi,%rax
+    1134:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1138:	    48 c1 f8 03          	sar    $0x3,%rax
+    113c:	    48 01 c6             	add    %rax,%rsi
+    113f:	    48 d1 fe             	sar    %rsi
+    1142:	/-- 74 14                	je     1158 <register_tm_clones+0x38>
+    1144:	|   48 8b 05 8d 2e 00 00 	mov    0x2e8d(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    114b:	|   48 85 c0             	test   %rax,%rax
+    114e:	+-- 74 08                	je     1158 <register_tm_clones+0x38>
+    1150:	|   ff e0                	jmp    *%rax
+    1152:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1158:	\-> c3                   	ret
+    1159:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001160 <__do_global_dtors_aux>:
+    1160:	       f3 0f 1e fa          	endbr64
+    1164:	       80 3d dd 2e 00 00 00 	cmpb   $0x0,0x2edd(%rip)        # 4048 <completed.0>
+    116b:	/----- 75 2b                	jne    1198 <__do_global_dtors_aux+0x38>
+    116d:	|      55                   	push   %rbp
+    116e:	|      48 83 3d 6a 2e 00 00 	cmpq   $0x0,0x2e6a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1175:	|      00 
+    1176:	|      48 89 e5             	mov    %rsp,%rbp
+    1179:	|  /-- 74 0c                	je     1187 <__do_global_dtors_aux+0x27>
+    117b:	|  |   48 8b 3d 9e 2e 00 00 	mov    0x2e9e(%rip),%rdi        # 4020 <__dso_handle>
+    1182:	|  |   e8 d9 fe ff ff       	call   1060 <__cxa_finalize@plt>
+    1187:	|  \-> e8 64 ff ff ff       	call   10f0 <deregister_tm_clones>
+    118c:	|      c6 05 b5 2e 00 00 01 	movb   $0x1,0x2eb5(%rip)        # 4048 <completed.0>
+    1193:	|      5d                   	pop    %rbp
+    1194:	|      c3                   	ret
+    1195:	|      0f 1f 00             	nopl   (%rax)
+    1198:	\----> c3                   	ret
+    1199:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011a0 <frame_dummy>:
+    11a0:	f3 0f 1e fa          	endbr64
+    11a4:	e9 77 ff ff ff       	jmp    1120 <register_tm_clones>
+    11a9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011b0 <_close_r>:
+
+    11b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11b5:	c3                   	ret
+    11b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    11bd:	00 00 00 
+
+00000000000011c0 <_fstat_r>:
+#include <nel/log.hh>
+    11c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11c5:	c3                   	ret
+    11c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    11cd:	00 00 00 
+
+00000000000011d0 <_kill_r>:
+
+    11d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11d5:	c3                   	ret
+    11d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    11dd:	00 00 00 
+
+00000000000011e0 <_lseek_r>:
+    it.for_each([&](int const &e) { nel::log << e << ','; });
+    11e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11e5:	c3                   	ret
+    11e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    11ed:	00 00 00 
+
+00000000000011f0 <_read_r>:
+}
+    11f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11f5:	c3                   	ret
+    11f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    11fd:	00 00 00 
+
+0000000000001200 <_write_r>:
+    it.for_each2([&](int const &e) { nel::log << e << ','; });
+    1200:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1205:	c3                   	ret
+    1206:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    120d:	00 00 00 
+
+0000000000001210 <_getpid_r>:
+
+    1210:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1215:	c3                   	ret
+    1216:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    121d:	00 00 00 
+
+0000000000001220 <_isatty_r>:
+void do3(nel::Slice<int>::Iterator &&it)
+    1220:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1225:	c3                   	ret
+    1226:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    122d:	00 00 00 
+
+0000000000001230 <do1(nel::SliceIterator<int>&&)>:
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return (b_ == e_);
+    1230:	       48 8b 07             	mov    (%rdi),%rax
+        template<typename F>
+        void for_each2(F &&fn)
+#        endif
+        {
+#        if 1
+            for (; !self().is_done(); self().inc()) {
+    1233:	       48 3b 47 08          	cmp    0x8(%rdi),%rax
+    1237:	/----- 74 47                	je     1280 <do1(nel::SliceIterator<int>&&)+0x50>
+{
+    1239:	|      55                   	push   %rbp
+    123a:	|      48 8d 2d 08 2e 00 00 	lea    0x2e08(%rip),%rbp        # 4049 <nel::log>
+    1241:	|      53                   	push   %rbx
+    1242:	|      48 89 fb             	mov    %rdi,%rbx
+    1245:	|      48 83 ec 08          	sub    $0x8,%rsp
+    1249:	|      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    it.for_each([&](int const &e) { nel::log << e << ','; });
+    1250:	|  /-> 8b 30                	mov    (%rax),%esi
+    1252:	|  |   48 89 ef             	mov    %rbp,%rdi
+    1255:	|  |   e8 26 02 00 00       	call   1480 <nel::operator<<(nel::Log&, int)>
+    125a:	|  |   be 2c 00 00 00       	mov    $0x2c,%esi
+    125f:	|  |   48 89 c7             	mov    %rax,%rdi
+    1262:	|  |   e8 59 01 00 00       	call   13c0 <nel::operator<<(nel::Log&, char)>
+        }
+
+        void inc(void)
+        {
+            ++b_;
+    1267:	|  |   48 8b 03             	mov    (%rbx),%rax
+    126a:	|  |   48 83 c0 04          	add    $0x4,%rax
+    126e:	|  |   48 89 03             	mov    %rax,(%rbx)
+    1271:	|  |   48 3b 43 08          	cmp    0x8(%rbx),%rax
+    1275:	|  \-- 75 d9                	jne    1250 <do1(nel::SliceIterator<int>&&)+0x20>
+}
+    1277:	|      48 83 c4 08          	add    $0x8,%rsp
+    127b:	|      5b                   	pop    %rbx
+    127c:	|      5d                   	pop    %rbp
+    127d:	|      c3                   	ret
+    127e:	|      66 90                	xchg   %ax,%ax
+    1280:	\----> c3                   	ret
+    1281:	       66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1288:	       00 00 00 00 
+    128c:	       0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001290 <do3(nel::SliceIterator<int>&&)>:
+{
+    1290:	          41 54                	push   %r12
+            o.b_ = nullptr;
+    1292:	          66 0f ef c0          	pxor   %xmm0,%xmm0
+    it.for_each([&](int const &e) { nel::log << e << ','; });
+    1296:	          4c 8d 25 ac 2d 00 00 	lea    0x2dac(%rip),%r12        # 4049 <nel::log>
+{
+    129d:	          55                   	push   %rbp
+    129e:	          53                   	push   %rbx
+    129f:	          48 83 ec 30          	sub    $0x30,%rsp
+            : b_(move(o.b_))
+    12a3:	          48 8b 1f             	mov    (%rdi),%rbx
+            , e_(move(o.e_))
+    12a6:	          48 8b 6f 08          	mov    0x8(%rdi),%rbp
+            o.b_ = nullptr;
+    12aa:	          0f 11 07             	movups %xmm0,(%rdi)
+        Length const limit_;
+
+    public:
+        constexpr FirstNIterator(It &&inner, Length limit)
+            : inner_(move(inner))
+            , current_(0)
+    12ad:	          48 c7 44 24 18 00 00 	movq   $0x0,0x18(%rsp)
+    12b4:	          00 00 
+            while (!self().is_done()) {
+    12b6:	/-------- eb 38                	jmp    12f0 <do3(nel::SliceIterator<int>&&)+0x60>
+    12b8:	|         0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    12bf:	|         00 
+    it.template map<int>([](int const &e) -> int { return e * 100; })
+    12c0:	|  /----> 6b 33 64             	imul   $0x64,(%rbx),%esi
+    it.for_each([&](int const &e) { nel::log << e << ','; });
+    12c3:	|  |      4c 89 e7             	mov    %r12,%rdi
+                if (!fn(acc, forward<OutT>(e))) { return false; }
+    12c6:	|  |      48 83 c3 04          	add    $0x4,%rbx
+    12ca:	|  |      e8 b1 01 00 00       	call   1480 <nel::operator<<(nel::Log&, int)>
+    12cf:	|  |      be 2c 00 00 00       	mov    $0x2c,%esi
+    12d4:	|  |      48 89 c7             	mov    %rax,%rdi
+    12d7:	|  |      e8 e4 00 00 00       	call   13c0 <nel::operator<<(nel::Log&, char)>
+        {
+            if (current_ >= limit_) { return; }
+            bool unused = true;
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+                fn(e);
+                return ++current_ < limit_;
+    12dc:	|  |      48 8b 44 24 18       	mov    0x18(%rsp),%rax
+    12e1:	|  |      48 83 c0 01          	add    $0x1,%rax
+    12e5:	|  |      48 89 44 24 18       	mov    %rax,0x18(%rsp)
+                if (!fn(acc, forward<OutT>(e))) { return false; }
+    12ea:	|  |      48 83 f8 03          	cmp    $0x3,%rax
+    12ee:	|  |  /-- 77 05                	ja     12f5 <do3(nel::SliceIterator<int>&&)+0x65>
+            while (!self().is_done()) {
+    12f0:	\--|--|-> 48 39 dd             	cmp    %rbx,%rbp
+    12f3:	   \--|-- 75 cb                	jne    12c0 <do3(nel::SliceIterator<int>&&)+0x30>
+}
+    12f5:	      \-> 48 83 c4 30          	add    $0x30,%rsp
+    12f9:	          5b                   	pop    %rbx
+    12fa:	          5d                   	pop    %rbp
+    12fb:	          41 5c                	pop    %r12
+    12fd:	          c3                   	ret
+    12fe:	          66 90                	xchg   %ax,%ax
+
+0000000000001300 <do5(nel::SliceIterator<int>&&)>:
+            : b_(move(o.b_))
+    1300:	          48 8b 07             	mov    (%rdi),%rax
+            o.b_ = nullptr;
+    1303:	          66 0f ef c0          	pxor   %xmm0,%xmm0
+            , e_(move(o.e_))
+    1307:	          48 8b 4f 08          	mov    0x8(%rdi),%rcx
+            U acc = move(initial);
+    130b:	          be 0a 00 00 00       	mov    $0xa,%esi
+            o.b_ = nullptr;
+    1310:	          0f 11 07             	movups %xmm0,(%rdi)
+        void for_each(F &&fn)
+    1313:	          48 8d b8 40 06 00 00 	lea    0x640(%rax),%rdi
+    131a:	/-------- eb 12                	jmp    132e <do5(nel::SliceIterator<int>&&)+0x2e>
+    131c:	|         0f 1f 40 00          	nopl   0x0(%rax)
+    int v = it.template map<int>([](int const &e) -> int { return e * 100; })
+    1320:	|  /----> 6b 10 64             	imul   $0x64,(%rax),%edx
+                if (!fn(acc, forward<OutT>(e))) { return false; }
+    1323:	|  |      48 83 c0 04          	add    $0x4,%rax
+                .fold(10, [&](int &acc, int &e) { acc += e; });
+    1327:	|  |      01 d6                	add    %edx,%esi
+    1329:	|  |      48 39 f8             	cmp    %rdi,%rax
+    132c:	|  |  /-- 74 05                	je     1333 <do5(nel::SliceIterator<int>&&)+0x33>
+            while (!self().is_done()) {
+    132e:	\--|--|-> 48 39 c1             	cmp    %rax,%rcx
+    1331:	   \--|-- 75 ed                	jne    1320 <do5(nel::SliceIterator<int>&&)+0x20>
+    nel::log << v;
+    1333:	      \-> 48 8d 3d 0f 2d 00 00 	lea    0x2d0f(%rip),%rdi        # 4049 <nel::log>
+    133a:	          e9 41 01 00 00       	jmp    1480 <nel::operator<<(nel::Log&, int)>
+    133f:	          90                   	nop
+
+0000000000001340 <ex1()>:
+{
+    1340:	          53                   	push   %rbx
+    1341:	          48 81 ec c0 0f 00 00 	sub    $0xfc0,%rsp
+    1348:	          48 8d 5c 24 18       	lea    0x18(%rsp),%rbx
+    do3(a1.iter());
+    134d:	          48 89 e7             	mov    %rsp,%rdi
+
+        // default ctor is safe, will always succeed.
+        // and is fast.
+        // if sizeof(T) or N is large will just eat ram.
+        constexpr Vector(void)
+            : len_(0)
+    1350:	          48 c7 44 24 10 00 00 	movq   $0x0,0x10(%rsp)
+    1357:	          00 00 
+            : b_(arr)
+    1359:	          66 48 0f 6e c3       	movq   %rbx,%xmm0
+    135e:	          66 0f 6c c0          	punpcklqdq %xmm0,%xmm0
+    1362:	          0f 29 04 24          	movaps %xmm0,(%rsp)
+    1366:	          e8 25 ff ff ff       	call   1290 <do3(nel::SliceIterator<int>&&)>
+            , e_(arr + len)
+    136b:	          48 8b 44 24 10       	mov    0x10(%rsp),%rax
+            U acc = move(initial);
+    1370:	          be 0a 00 00 00       	mov    $0xa,%esi
+    1375:	          48 8d bc 24 58 06 00 	lea    0x658(%rsp),%rdi
+    137c:	          00 
+    137d:	          48 8d 0c 83          	lea    (%rbx,%rax,4),%rcx
+        void for_each(F &&fn)
+    1381:	          48 89 d8             	mov    %rbx,%rax
+    1384:	/-------- eb 18                	jmp    139e <ex1()+0x5e>
+    1386:	|         66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    138d:	|         00 00 00 
+    int v = it.template map<int>([](int const &e) -> int { return e * 100; })
+    1390:	|  /----> 6b 10 64             	imul   $0x64,(%rax),%edx
+                if (!fn(acc, forward<OutT>(e))) { return false; }
+    1393:	|  |      48 83 c0 04          	add    $0x4,%rax
+                .fold(10, [&](int &acc, int &e) { acc += e; });
+    1397:	|  |      01 d6                	add    %edx,%esi
+    1399:	|  |      48 39 f8             	cmp    %rdi,%rax
+    139c:	|  |  /-- 74 05                	je     13a3 <ex1()+0x63>
+            while (!self().is_done()) {
+    139e:	\--|--|-> 48 39 c1             	cmp    %rax,%rcx
+    13a1:	   \--|-- 75 ed                	jne    1390 <ex1()+0x50>
+    nel::log << v;
+    13a3:	      \-> 48 8d 3d 9f 2c 00 00 	lea    0x2c9f(%rip),%rdi        # 4049 <nel::log>
+    13aa:	          e8 d1 00 00 00       	call   1480 <nel::operator<<(nel::Log&, int)>
+}
+    13af:	          48 81 c4 c0 0f 00 00 	add    $0xfc0,%rsp
+    13b6:	          5b                   	pop    %rbx
+    13b7:	          c3                   	ret
+    13b8:	          0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    13bf:	          00 
+
+00000000000013c0 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    13c0:	53                   	push   %rbx
+    13c1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    13c4:	40 0f be fe          	movsbl %sil,%edi
+    13c8:	48 8b 35 71 2c 00 00 	mov    0x2c71(%rip),%rsi        # 4040 <stderr@GLIBC_2.2.5>
+    13cf:	e8 6c fc ff ff       	call   1040 <fputc@plt>
+    return outs;
+}
+    13d4:	48 89 d8             	mov    %rbx,%rax
+    13d7:	5b                   	pop    %rbx
+    13d8:	c3                   	ret
+    13d9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000013e0 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    13e0:	53                   	push   %rbx
+    13e1:	48 89 fb             	mov    %rdi,%rbx
+    13e4:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    13e7:	48 8b 35 52 2c 00 00 	mov    0x2c52(%rip),%rsi        # 4040 <stderr@GLIBC_2.2.5>
+    13ee:	e8 3d fc ff ff       	call   1030 <fputs@plt>
+    return outs;
+}
+    13f3:	48 89 d8             	mov    %rbx,%rax
+    13f6:	5b                   	pop    %rbx
+    13f7:	c3                   	ret
+    13f8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    13ff:	00 
+
+0000000000001400 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1400:	53                   	push   %rbx
+    1401:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    1404:	48 8b 3d 35 2c 00 00 	mov    0x2c35(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+    140b:	40 0f b6 d6          	movzbl %sil,%edx
+    140f:	31 c0                	xor    %eax,%eax
+    1411:	48 8d 35 f8 0b 00 00 	lea    0xbf8(%rip),%rsi        # 2010 <_IO_stdin_used+0x10>
+    1418:	e8 33 fc ff ff       	call   1050 <fprintf@plt>
+    return outs;
+}
+    141d:	48 89 d8             	mov    %rbx,%rax
+    1420:	5b                   	pop    %rbx
+    1421:	c3                   	ret
+    1422:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1429:	00 00 00 00 
+    142d:	0f 1f 00             	nopl   (%rax)
+
+0000000000001430 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    1430:	53                   	push   %rbx
+    1431:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    1434:	48 8b 3d 05 2c 00 00 	mov    0x2c05(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+    143b:	0f b7 d6             	movzwl %si,%edx
+    143e:	31 c0                	xor    %eax,%eax
+    1440:	48 8d 35 c9 0b 00 00 	lea    0xbc9(%rip),%rsi        # 2010 <_IO_stdin_used+0x10>
+    1447:	e8 04 fc ff ff       	call   1050 <fprintf@plt>
+    return outs;
+}
+    144c:	48 89 d8             	mov    %rbx,%rax
+    144f:	5b                   	pop    %rbx
+    1450:	c3                   	ret
+    1451:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1458:	00 00 00 00 
+    145c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001460 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    1460:	53                   	push   %rbx
+    1461:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    1464:	48 8b 3d d5 2b 00 00 	mov    0x2bd5(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+{
+    146b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    146d:	31 c0                	xor    %eax,%eax
+    146f:	48 8d 35 9a 0b 00 00 	lea    0xb9a(%rip),%rsi        # 2010 <_IO_stdin_used+0x10>
+    1476:	e8 d5 fb ff ff       	call   1050 <fprintf@plt>
+    return outs;
+}
+    147b:	48 89 d8             	mov    %rbx,%rax
+    147e:	5b                   	pop    %rbx
+    147f:	c3                   	ret
+
+0000000000001480 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    1480:	53                   	push   %rbx
+    1481:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    1484:	48 8b 3d b5 2b 00 00 	mov    0x2bb5(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+{
+    148b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    148d:	31 c0                	xor    %eax,%eax
+    148f:	48 8d 35 7a 0b 00 00 	lea    0xb7a(%rip),%rsi        # 2010 <_IO_stdin_used+0x10>
+    1496:	e8 b5 fb ff ff       	call   1050 <fprintf@plt>
+    return outs;
+}
+    149b:	48 89 d8             	mov    %rbx,%rax
+    149e:	5b                   	pop    %rbx
+    149f:	c3                   	ret
+
+00000000000014a0 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    14a0:	53                   	push   %rbx
+    14a1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    14a4:	48 8b 3d 95 2b 00 00 	mov    0x2b95(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+{
+    14ab:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    14ae:	31 c0                	xor    %eax,%eax
+    14b0:	48 8d 35 5c 0b 00 00 	lea    0xb5c(%rip),%rsi        # 2013 <_IO_stdin_used+0x13>
+    14b7:	e8 94 fb ff ff       	call   1050 <fprintf@plt>
+    return outs;
+}
+    14bc:	48 89 d8             	mov    %rbx,%rax
+    14bf:	5b                   	pop    %rbx
+    14c0:	c3                   	ret
+
+Disassembly of section .fini:
+
+00000000000014c4 <_fini>:
+    14c4:	48 83 ec 08          	sub    $0x8,%rsp
+    14c8:	48 83 c4 08          	add    $0x8,%rsp
+    14cc:	c3                   	ret
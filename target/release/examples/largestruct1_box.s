@@ -0,0 +1,1734 @@
+
+target/release/examples/largestruct1_box:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 3f 00 00 	mov    0x3fc5(%rip),%rax        # 4fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 3f 00 00    	push   0x3fca(%rip)        # 4ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 3f 00 00    	jmp    *0x3fcc(%rip)        # 4ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 3f 00 00    	jmp    *0x3fca(%rip)        # 5000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 3f 00 00    	jmp    *0x3fc2(%rip)        # 5008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 3f 00 00    	jmp    *0x3fba(%rip)        # 5010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memset@plt>:
+    1060:	ff 25 b2 3f 00 00    	jmp    *0x3fb2(%rip)        # 5018 <memset@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 3f 00 00    	jmp    *0x3faa(%rip)        # 5020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 3f 00 00    	jmp    *0x3fa2(%rip)        # 5028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 3f 00 00    	jmp    *0x3f9a(%rip)        # 5030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcpy@plt>:
+    10a0:	ff 25 92 3f 00 00    	jmp    *0x3f92(%rip)        # 5038 <memcpy@GLIBC_2.14>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <malloc@plt>:
+    10b0:	ff 25 8a 3f 00 00    	jmp    *0x3f8a(%rip)        # 5040 <malloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <realloc@plt>:
+    10c0:	ff 25 82 3f 00 00    	jmp    *0x3f82(%rip)        # 5048 <realloc@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <memmove@plt>:
+    10d0:	ff 25 7a 3f 00 00    	jmp    *0x3f7a(%rip)        # 5050 <memmove@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010e0 <__cxa_finalize@plt>:
+    10e0:	ff 25 fa 3e 00 00    	jmp    *0x3efa(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10e6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010f0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10f0:	50                   	push   %rax
+    std::abort();
+    10f1:	e8 4a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010f6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10f6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10f7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10fa:	4c 8d 0d 6f 1f 00 00 	lea    0x1f6f(%rip),%r9        # 3070 <_IO_stdin_used+0x70>
+    1101:	31 c0                	xor    %eax,%eax
+    1103:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    1107:	4c 8b 07             	mov    (%rdi),%r8
+    110a:	48 8d 35 65 1f 00 00 	lea    0x1f65(%rip),%rsi        # 3076 <_IO_stdin_used+0x76>
+    1111:	48 8b 3d 68 3f 00 00 	mov    0x3f68(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1118:	e8 73 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    111d:	e8 1e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001122 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1122:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1126:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1129:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    112d:	31 c0                	xor    %eax,%eax
+    112f:	57                   	push   %rdi
+    1130:	48 8b 3d 49 3f 00 00 	mov    0x3f49(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1137:	4c 8d 0d 32 1f 00 00 	lea    0x1f32(%rip),%r9        # 3070 <_IO_stdin_used+0x70>
+    113e:	4c 8b 06             	mov    (%rsi),%r8
+    1141:	48 8d 35 3f 1f 00 00 	lea    0x1f3f(%rip),%rsi        # 3087 <_IO_stdin_used+0x87>
+    1148:	e8 43 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    114d:	e8 ee fe ff ff       	call   1040 <abort@plt>
+
+0000000000001152 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1152:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1156:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1159:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    115d:	31 c0                	xor    %eax,%eax
+    115f:	57                   	push   %rdi
+    1160:	48 8b 3d 19 3f 00 00 	mov    0x3f19(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1167:	4c 8d 0d 2e 1f 00 00 	lea    0x1f2e(%rip),%r9        # 309c <_IO_stdin_used+0x9c>
+    116e:	4c 8b 06             	mov    (%rsi),%r8
+    1171:	48 8d 35 0f 1f 00 00 	lea    0x1f0f(%rip),%rsi        # 3087 <_IO_stdin_used+0x87>
+    1178:	e8 13 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    117d:	e8 be fe ff ff       	call   1040 <abort@plt>
+    1182:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1189:	00 00 00 
+    118c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001190 <main>:
+    Box1 b = r.unwrap();
+
+    nel::log << b << '\n';
+}
+
+int main() {}
+    1190:	31 c0                	xor    %eax,%eax
+    1192:	c3                   	ret
+    1193:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    119a:	00 00 00 
+    119d:	0f 1f 00             	nopl   (%rax)
+
+00000000000011a0 <_start>:
+    11a0:	31 ed                	xor    %ebp,%ebp
+    11a2:	49 89 d1             	mov    %rdx,%r9
+    11a5:	5e                   	pop    %rsi
+    11a6:	48 89 e2             	mov    %rsp,%rdx
+    11a9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    11ad:	50                   	push   %rax
+    11ae:	54                   	push   %rsp
+    11af:	45 31 c0             	xor    %r8d,%r8d
+    11b2:	31 c9                	xor    %ecx,%ecx
+    11b4:	48 8d 3d d5 ff ff ff 	lea    -0x2b(%rip),%rdi        # 1190 <main>
+    11bb:	ff 15 ff 3d 00 00    	call   *0x3dff(%rip)        # 4fc0 <__libc_start_main@GLIBC_2.34>
+    11c1:	f4                   	hlt
+    11c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    11c9:	00 00 00 
+    11cc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000011d0 <deregister_tm_clones>:
+    11d0:	    48 8d 3d 91 3e 00 00 	lea    0x3e91(%rip),%rdi        # 5068 <__TMC_END__>
+    11d7:	    48 8d 05 8a 3e 00 00 	lea    0x3e8a(%rip),%rax        # 5068 <__TMC_END__>
+    11de:	    48 39 f8             	cmp    %rdi,%rax
+    11e1:	/-- 74 15                	je     11f8 <deregister_tm_clones+0x28>
+    11e3:	|   48 8b 05 de 3d 00 00 	mov    0x3dde(%rip),%rax        # 4fc8 <_ITM_deregisterTMCloneTable@Base>
+    11ea:	|   48 85 c0             	test   %rax,%rax
+    11ed:	+-- 74 09                	je     11f8 <deregister_tm_clones+0x28>
+    11ef:	|   ff e0                	jmp    *%rax
+    11f1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    11f8:	\-> c3                   	ret
+    11f9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001200 <register_tm_clones>:
+    1200:	    48 8d 3d 61 3e 00 00 	lea    0x3e61(%rip),%rdi        # 5068 <__TMC_END__>
+    1207:	    48 8d 35 5a 3e 00 00 	lea    0x3e5a(%rip),%rsi        # 5068 <__TMC_END__>
+    120e:	    48 29 fe             	sub    %rdi,%rsi
+    1211:	    48 89 f0             	mov    %rsi,%rax
+    1214:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1218:	    48 c1 f8 03          	sar    $0x3,%rax
+    121c:	    48 01 c6             	add    %rax,%rsi
+    121f:	    48 d1 fe             	sar    %rsi
+    1222:	/-- 74 14                	je     1238 <register_tm_clones+0x38>
+    1224:	|   48 8b 05 ad 3d 00 00 	mov    0x3dad(%rip),%rax        # 4fd8 <_ITM_registerTMCloneTable@Base>
+    122b:	|   48 85 c0             	test   %rax,%rax
+    122e:	+-- 74 08                	je     1238 <register_tm_clones+0x38>
+    1230:	|   ff e0                	jmp    *%rax
+    1232:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1238:	\-> c3                   	ret
+    1239:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001240 <__do_global_dtors_aux>:
+    1240:	       f3 0f 1e fa          	endbr64
+    1244:	       80 3d 3d 3e 00 00 00 	cmpb   $0x0,0x3e3d(%rip)        # 5088 <completed.0>
+    124b:	/----- 75 2b                	jne    1278 <__do_global_dtors_aux+0x38>
+    124d:	|      55                   	push   %rbp
+    124e:	|      48 83 3d 8a 3d 00 00 	cmpq   $0x0,0x3d8a(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1255:	|      00 
+    1256:	|      48 89 e5             	mov    %rsp,%rbp
+    1259:	|  /-- 74 0c                	je     1267 <__do_global_dtors_aux+0x27>
+    125b:	|  |   48 8b 3d fe 3d 00 00 	mov    0x3dfe(%rip),%rdi        # 5060 <__dso_handle>
+    1262:	|  |   e8 79 fe ff ff       	call   10e0 <__cxa_finalize@plt>
+    1267:	|  \-> e8 64 ff ff ff       	call   11d0 <deregister_tm_clones>
+    126c:	|      c6 05 15 3e 00 00 01 	movb   $0x1,0x3e15(%rip)        # 5088 <completed.0>
+    1273:	|      5d                   	pop    %rbp
+    1274:	|      c3                   	ret
+    1275:	|      0f 1f 00             	nopl   (%rax)
+    1278:	\----> c3                   	ret
+    1279:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001280 <frame_dummy>:
+    1280:	f3 0f 1e fa          	endbr64
+    1284:	e9 77 ff ff ff       	jmp    1200 <register_tm_clones>
+    1289:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001290 <_close_r>:
+#include <nel/defs.hh>
+    1290:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1295:	c3                   	ret
+    1296:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    129d:	00 00 00 
+
+00000000000012a0 <_fstat_r>:
+typedef nel::heaped::Box<U8Buf<256>> Box1;
+    12a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12a5:	c3                   	ret
+    12a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12ad:	00 00 00 
+
+00000000000012b0 <_kill_r>:
+{
+    12b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12b5:	c3                   	ret
+    12b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12bd:	00 00 00 
+
+00000000000012c0 <_lseek_r>:
+    return outs;
+    12c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12c5:	c3                   	ret
+    12c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12cd:	00 00 00 
+
+00000000000012d0 <_read_r>:
+}
+    12d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12d5:	c3                   	ret
+    12d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12dd:	00 00 00 
+
+00000000000012e0 <_write_r>:
+    auto r = Box1::try_from(nel::move(v));
+    12e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12e5:	c3                   	ret
+    12e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12ed:	00 00 00 
+
+00000000000012f0 <_getpid_r>:
+    nel::log << b << '\n';
+    12f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12f5:	c3                   	ret
+    12f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12fd:	00 00 00 
+
+0000000000001300 <_isatty_r>:
+}
+    1300:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1305:	c3                   	ret
+    1306:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    130d:	00 00 00 
+
+0000000000001310 <operator<<(nel::Log&, nel::heaped::Box<U8Buf<256ul>, nel::heaped::Malloc> const&)>:
+{
+    1310:	53                   	push   %rbx
+    outs << "Box1()";
+    1311:	48 8d 35 ec 1c 00 00 	lea    0x1cec(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+{
+    1318:	48 89 fb             	mov    %rdi,%rbx
+    outs << "Box1()";
+    131b:	e8 00 0d 00 00       	call   2020 <nel::operator<<(nel::Log&, char const*)>
+}
+    1320:	48 89 d8             	mov    %rbx,%rax
+    1323:	5b                   	pop    %rbx
+    1324:	c3                   	ret
+    1325:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    132c:	00 00 00 00 
+
+0000000000001330 <box1()>:
+{
+    1330:	                      41 54                	push   %r12
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+        {
+            nel::elem::set(data_, f, N);
+    1332:	                      ba 00 01 00 00       	mov    $0x100,%edx
+    1337:	                      be 66 00 00 00       	mov    $0x66,%esi
+    133c:	                      55                   	push   %rbp
+    133d:	                      53                   	push   %rbx
+    133e:	                      48 81 ec 30 02 00 00 	sub    $0x230,%rsp
+    1345:	                      48 8d 6c 24 20       	lea    0x20(%rsp),%rbp
+    134a:	                      48 89 ef             	mov    %rbp,%rdi
+    134d:	                      e8 3e 04 00 00       	call   1790 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            if (align == 0 || (align & (align - 1)) != 0) {
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+            }
+            void *const new_p = is_over_aligned(align)
+                                    ? realloc_aligned(p, align, old_size, new_size)
+                                    : std::realloc(p, new_size);
+    1352:	                      bf 00 01 00 00       	mov    $0x100,%edi
+    1357:	                      e8 54 fd ff ff       	call   10b0 <malloc@plt>
+            if (new_p == nullptr) {
+    135c:	                      48 85 c0             	test   %rax,%rax
+    135f:	               /----- 0f 84 eb 00 00 00    	je     1450 <box1()+0x120>
+            nel::elem::move(data_, o.data_, N);
+    1365:	               |      48 89 c7             	mov    %rax,%rdi
+    1368:	               |      ba 00 01 00 00       	mov    $0x100,%edx
+    136d:	               |      48 89 ee             	mov    %rbp,%rsi
+    1370:	               |      48 89 c3             	mov    %rax,%rbx
+    1373:	               |      e8 28 04 00 00       	call   17a0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    outs << "Box1()";
+    1378:	               |      4c 8d 25 0a 3d 00 00 	lea    0x3d0a(%rip),%r12        # 5089 <nel::log>
+    137f:	               |      48 8d 35 7e 1c 00 00 	lea    0x1c7e(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+        constexpr V consume(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context())
+        {
+            // a consuming matcher..
+            // that moves the value to the closures..
+            auto tag = tag_;
+            tag_ = Tag::INVAL;
+    1386:	               |      c7 84 24 20 01 00 00 	movl   $0x0,0x120(%rsp)
+    138d:	               |      00 00 00 00 
+
+        // Can move though.
+        constexpr Box(Box &&o)
+        {
+            value_ = o.value_;
+            o.value_ = nullptr;
+    1391:	               |      48 c7 84 24 28 01 00 	movq   $0x0,0x128(%rsp)
+    1398:	               |      00 00 00 00 00 
+    139d:	               |      4c 89 e7             	mov    %r12,%rdi
+    13a0:	               |      e8 7b 0c 00 00       	call   2020 <nel::operator<<(nel::Log&, char const*)>
+    nel::log << b << '\n';
+    13a5:	               |      be 0a 00 00 00       	mov    $0xa,%esi
+    13aa:	               |      4c 89 e7             	mov    %r12,%rdi
+    13ad:	               |      e8 4e 0c 00 00       	call   2000 <nel::operator<<(nel::Log&, char)>
+            nel::elem::set(data_, 0xa5, N);
+    13b2:	   /-----------|----> ba 00 01 00 00       	mov    $0x100,%edx
+    13b7:	   |           |      be a5 00 00 00       	mov    $0xa5,%esi
+    13bc:	   |           |      48 89 df             	mov    %rbx,%rdi
+    13bf:	   |           |      e8 cc 03 00 00       	call   1790 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    13c4:	   |           |      48 89 df             	mov    %rbx,%rdi
+    13c7:	   |           |      e8 64 fc ff ff       	call   1030 <free@plt>
+            switch (tag_) { // result::dtor
+    13cc:	   |           |      8b 84 24 20 01 00 00 	mov    0x120(%rsp),%eax
+    13d3:	   |           |      83 f8 01             	cmp    $0x1,%eax
+    13d6:	   |     /-----|----- 0f 84 27 01 00 00    	je     1503 <box1()+0x1d3>
+    13dc:	   |     |  /--|----> 83 f8 02             	cmp    $0x2,%eax
+    13df:	   |     |  |  |  /-- 74 37                	je     1418 <box1()+0xe8>
+    13e1:	   |     |  |  |  |   85 c0                	test   %eax,%eax
+    13e3:	/--|-----|--|--|--|-- 74 4a                	je     142f <box1()+0xff>
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    13e5:	|  |     |  |  |  |   48 8d 05 6d 1c 00 00 	lea    0x1c6d(%rip),%rax        # 3059 <_IO_stdin_used+0x59>
+    13ec:	|  |     |  |  |  |   48 8d 0d 5e 1c 00 00 	lea    0x1c5e(%rip),%rcx        # 3051 <_IO_stdin_used+0x51>
+            , file_name_(file_name)
+            , line_num_(line_num)
+    13f3:	|  |     |  |  |  |   c7 44 24 10 72 00 00 	movl   $0x72,0x10(%rsp)
+    13fa:	|  |     |  |  |  |   00 
+            : fn_name_(fn_name)
+    13fb:	|  |     |  |  |  |   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    1400:	|  |     |  |  |  |   66 48 0f 6e d0       	movq   %rax,%xmm2
+    1405:	|  |     |  |  |  |   66 0f 6c c2          	punpcklqdq %xmm2,%xmm0
+    1409:	|  |     |  |  |  |   0f 29 04 24          	movaps %xmm0,(%rsp)
+    140d:	|  |  /--|--|--|--|-- e9 2a 01 00 00       	jmp    153c <box1()+0x20c>
+    1412:	|  |  |  |  |  |  |   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1418:	|  |  |  |  |  |  \-> 48 8d bc 24 28 01 00 	lea    0x128(%rsp),%rdi
+    141f:	|  |  |  |  |  |      00 
+    1420:	|  |  |  |  |  |      ba 00 01 00 00       	mov    $0x100,%edx
+    1425:	|  |  |  |  |  |      be a5 00 00 00       	mov    $0xa5,%esi
+    142a:	|  |  |  |  |  |      e8 61 03 00 00       	call   1790 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    142f:	>--|--|--|--|--|----> 48 89 ef             	mov    %rbp,%rdi
+    1432:	|  |  |  |  |  |      ba 00 01 00 00       	mov    $0x100,%edx
+    1437:	|  |  |  |  |  |      be a5 00 00 00       	mov    $0xa5,%esi
+    143c:	|  |  |  |  |  |      e8 4f 03 00 00       	call   1790 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    1441:	|  |  |  |  |  |      48 81 c4 30 02 00 00 	add    $0x230,%rsp
+    1448:	|  |  |  |  |  |      5b                   	pop    %rbx
+    1449:	|  |  |  |  |  |      5d                   	pop    %rbp
+    144a:	|  |  |  |  |  |      41 5c                	pop    %r12
+    144c:	|  |  |  |  |  |      c3                   	ret
+    144d:	|  |  |  |  |  |      0f 1f 00             	nopl   (%rax)
+            nel::elem::move(data_, o.data_, N);
+    1450:	|  |  |  |  |  \----> ba 00 01 00 00       	mov    $0x100,%edx
+    1455:	|  |  |  |  |         48 89 ee             	mov    %rbp,%rsi
+    1458:	|  |  |  |  |         48 8d bc 24 28 01 00 	lea    0x128(%rsp),%rdi
+    145f:	|  |  |  |  |         00 
+            : tag_(Tag::ERR)
+    1460:	|  |  |  |  |         c7 84 24 20 01 00 00 	movl   $0x2,0x120(%rsp)
+    1467:	|  |  |  |  |         02 00 00 00 
+    146b:	|  |  |  |  |         e8 30 03 00 00       	call   17a0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    1470:	|  |  |  |  |         48 8d 15 99 1b 00 00 	lea    0x1b99(%rip),%rdx        # 3010 <_IO_stdin_used+0x10>
+    1477:	|  |  |  |  |         48 8d 0d 8d 1b 00 00 	lea    0x1b8d(%rip),%rcx        # 300b <_IO_stdin_used+0xb>
+            auto tag = tag_;
+    147e:	|  |  |  |  |         8b 84 24 20 01 00 00 	mov    0x120(%rsp),%eax
+    1485:	|  |  |  |  |         66 48 0f 6e c1       	movq   %rcx,%xmm0
+    148a:	|  |  |  |  |         66 48 0f 6e ca       	movq   %rdx,%xmm1
+            , line_num_(line_num)
+    148f:	|  |  |  |  |         c7 44 24 10 16 00 00 	movl   $0x16,0x10(%rsp)
+    1496:	|  |  |  |  |         00 
+            tag_ = Tag::INVAL;
+    1497:	|  |  |  |  |         c7 84 24 20 01 00 00 	movl   $0x0,0x120(%rsp)
+    149e:	|  |  |  |  |         00 00 00 00 
+            : fn_name_(fn_name)
+    14a2:	|  |  |  |  |         66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    14a6:	|  |  |  |  |         0f 29 04 24          	movaps %xmm0,(%rsp)
+            switch (tag) { // result-consume
+    14aa:	|  |  |  |  |         83 f8 01             	cmp    $0x1,%eax
+    14ad:	|  |  |  |  |     /-- 0f 85 80 00 00 00    	jne    1533 <box1()+0x203>
+    outs << "Box1()";
+    14b3:	|  |  |  |  |     |   4c 8d 25 cf 3b 00 00 	lea    0x3bcf(%rip),%r12        # 5089 <nel::log>
+            value_ = o.value_;
+    14ba:	|  |  |  |  |     |   48 8b 9c 24 28 01 00 	mov    0x128(%rsp),%rbx
+    14c1:	|  |  |  |  |     |   00 
+    14c2:	|  |  |  |  |     |   48 8d 35 3b 1b 00 00 	lea    0x1b3b(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+            o.value_ = nullptr;
+    14c9:	|  |  |  |  |     |   48 c7 84 24 28 01 00 	movq   $0x0,0x128(%rsp)
+    14d0:	|  |  |  |  |     |   00 00 00 00 00 
+    14d5:	|  |  |  |  |     |   4c 89 e7             	mov    %r12,%rdi
+    14d8:	|  |  |  |  |     |   e8 43 0b 00 00       	call   2020 <nel::operator<<(nel::Log&, char const*)>
+    nel::log << b << '\n';
+    14dd:	|  |  |  |  |     |   be 0a 00 00 00       	mov    $0xa,%esi
+    14e2:	|  |  |  |  |     |   4c 89 e7             	mov    %r12,%rdi
+    14e5:	|  |  |  |  |     |   e8 16 0b 00 00       	call   2000 <nel::operator<<(nel::Log&, char)>
+            if (p == nullptr) { return; }
+    14ea:	|  |  |  |  |     |   48 85 db             	test   %rbx,%rbx
+    14ed:	|  \--|--|--|-----|-- 0f 85 bf fe ff ff    	jne    13b2 <box1()+0x82>
+            switch (tag_) { // result::dtor
+    14f3:	|     |  |  |     |   8b 84 24 20 01 00 00 	mov    0x120(%rsp),%eax
+    14fa:	|     |  |  |     |   83 f8 01             	cmp    $0x1,%eax
+    14fd:	|     |  |  \-----|-- 0f 85 d9 fe ff ff    	jne    13dc <box1()+0xac>
+            destroy(value_);
+    1503:	|     |  \--------|-> 48 8b 9c 24 28 01 00 	mov    0x128(%rsp),%rbx
+    150a:	|     |           |   00 
+            if (p == nullptr) { return; }
+    150b:	|     |           |   48 85 db             	test   %rbx,%rbx
+    150e:	+-----|-----------|-- 0f 84 1b ff ff ff    	je     142f <box1()+0xff>
+            nel::elem::set(data_, 0xa5, N);
+    1514:	|     |           |   48 89 df             	mov    %rbx,%rdi
+    1517:	|     |           |   ba 00 01 00 00       	mov    $0x100,%edx
+    151c:	|     |           |   be a5 00 00 00       	mov    $0xa5,%esi
+    1521:	|     |           |   e8 6a 02 00 00       	call   1790 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1526:	|     |           |   48 89 df             	mov    %rbx,%rdi
+    1529:	|     |           |   e8 02 fb ff ff       	call   1030 <free@plt>
+    152e:	\-----|-----------|-- e9 fc fe ff ff       	jmp    142f <box1()+0xff>
+            switch (tag) { // result-consume
+    1533:	      |           \-> 83 f8 02             	cmp    $0x2,%eax
+    1536:	      |        /----- 74 22                	je     155a <box1()+0x22a>
+    1538:	      |        |      85 c0                	test   %eax,%eax
+    153a:	      |        |  /-- 74 0f                	je     154b <box1()+0x21b>
+                    nel::panic("bad Result");
+    153c:	      \--------|--|-> 48 89 e6             	mov    %rsp,%rsi
+    153f:	               |  |   48 8d 3d 00 1b 00 00 	lea    0x1b00(%rip),%rdi        # 3046 <_IO_stdin_used+0x46>
+    1546:	               |  |   e8 d7 fb ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+                    return on_err(forward<E>(*err_));
+                case Tag::INVAL:
+                    // invalids are not values that should occur
+                    // if they do it's a use-after-move-from op so must panic.
+                    // or a use-before-initialised so again must panic.
+                    nel::panic("invalid Result", ctx);
+    154b:	               |  \-> 48 89 e6             	mov    %rsp,%rsi
+    154e:	               |      48 8d 3d e2 1a 00 00 	lea    0x1ae2(%rip),%rdi        # 3037 <_IO_stdin_used+0x37>
+    1555:	               |      e8 c8 fb ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+         * `this` is consumed by the operation.
+         */
+        constexpr T unwrap(Context const &ctx = Context())
+        {
+            return consume<T>([](T &&ok) -> T { return T(forward<T>(ok)); },
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    155a:	               \----> 48 89 e6             	mov    %rsp,%rsi
+    155d:	                      48 8d 3d c9 1a 00 00 	lea    0x1ac9(%rip),%rdi        # 302d <_IO_stdin_used+0x2d>
+    1564:	                      e8 b9 fb ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1569:	                      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001570 <box2()>:
+{
+    1570:	                      41 54                	push   %r12
+            nel::elem::set(data_, f, N);
+    1572:	                      ba 00 01 00 00       	mov    $0x100,%edx
+    1577:	                      be 67 00 00 00       	mov    $0x67,%esi
+    157c:	                      55                   	push   %rbp
+    157d:	                      53                   	push   %rbx
+    157e:	                      48 81 ec 10 02 00 00 	sub    $0x210,%rsp
+    1585:	                      48 89 e5             	mov    %rsp,%rbp
+    1588:	                      48 89 ef             	mov    %rbp,%rdi
+    158b:	                      e8 00 02 00 00       	call   1790 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+                                    : std::realloc(p, new_size);
+    1590:	                      bf 00 01 00 00       	mov    $0x100,%edi
+    1595:	                      e8 16 fb ff ff       	call   10b0 <malloc@plt>
+            if (new_p == nullptr) {
+    159a:	                      48 85 c0             	test   %rax,%rax
+    159d:	/-------------------- 0f 84 5d 01 00 00    	je     1700 <box2()+0x190>
+    15a3:	|                     48 89 c3             	mov    %rax,%rbx
+            nel::elem::move(data_, o.data_, N);
+    15a6:	|                     ba 00 01 00 00       	mov    $0x100,%edx
+    15ab:	|                     48 89 ee             	mov    %rbp,%rsi
+    15ae:	|                     48 89 c7             	mov    %rax,%rdi
+    15b1:	|                     e8 ea 01 00 00       	call   17a0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            value_ = o.value_;
+    15b6:	|                     48 89 9c 24 08 01 00 	mov    %rbx,0x108(%rsp)
+    15bd:	|                     00 
+            : tag_(Tag::OK)
+    15be:	|                     c7 84 24 00 01 00 00 	movl   $0x1,0x100(%rsp)
+    15c5:	|                     01 00 00 00 
+            nel::elem::set(data_, 0xa5, N);
+    15c9:	|  /----------------> ba 00 01 00 00       	mov    $0x100,%edx
+    15ce:	|  |                  be a5 00 00 00       	mov    $0xa5,%esi
+    15d3:	|  |                  48 89 ef             	mov    %rbp,%rdi
+    15d6:	|  |                  e8 b5 01 00 00       	call   1790 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    15db:	|  |                  48 8d 05 2e 1a 00 00 	lea    0x1a2e(%rip),%rax        # 3010 <_IO_stdin_used+0x10>
+    15e2:	|  |                  48 8d 0d 82 1a 00 00 	lea    0x1a82(%rip),%rcx        # 306b <_IO_stdin_used+0x6b>
+            , line_num_(line_num)
+    15e9:	|  |                  c7 44 24 10 1e 00 00 	movl   $0x1e,0x10(%rsp)
+    15f0:	|  |                  00 
+            : fn_name_(fn_name)
+    15f1:	|  |                  66 48 0f 6e c8       	movq   %rax,%xmm1
+    15f6:	|  |                  66 48 0f 6e c1       	movq   %rcx,%xmm0
+            auto tag = tag_;
+    15fb:	|  |                  8b 84 24 00 01 00 00 	mov    0x100(%rsp),%eax
+            tag_ = Tag::INVAL;
+    1602:	|  |                  c7 84 24 00 01 00 00 	movl   $0x0,0x100(%rsp)
+    1609:	|  |                  00 00 00 00 
+    160d:	|  |                  66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    1611:	|  |                  0f 29 04 24          	movaps %xmm0,(%rsp)
+            switch (tag) { // result-consume
+    1615:	|  |                  83 f8 01             	cmp    $0x1,%eax
+    1618:	|  |        /-------- 0f 85 c5 00 00 00    	jne    16e3 <box2()+0x173>
+    outs << "Box1()";
+    161e:	|  |        |         4c 8d 25 64 3a 00 00 	lea    0x3a64(%rip),%r12        # 5089 <nel::log>
+    1625:	|  |        |         48 8b 9c 24 08 01 00 	mov    0x108(%rsp),%rbx
+    162c:	|  |        |         00 
+    162d:	|  |        |         48 8d 35 d0 19 00 00 	lea    0x19d0(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+            o.value_ = nullptr;
+    1634:	|  |        |         48 c7 84 24 08 01 00 	movq   $0x0,0x108(%rsp)
+    163b:	|  |        |         00 00 00 00 00 
+    1640:	|  |        |         4c 89 e7             	mov    %r12,%rdi
+    1643:	|  |        |         e8 d8 09 00 00       	call   2020 <nel::operator<<(nel::Log&, char const*)>
+    nel::log << b << '\n';
+    1648:	|  |        |         be 0a 00 00 00       	mov    $0xa,%esi
+    164d:	|  |        |         4c 89 e7             	mov    %r12,%rdi
+    1650:	|  |        |         e8 ab 09 00 00       	call   2000 <nel::operator<<(nel::Log&, char)>
+            if (p == nullptr) { return; }
+    1655:	|  |        |         48 85 db             	test   %rbx,%rbx
+    1658:	|  |        |     /-- 74 1a                	je     1674 <box2()+0x104>
+    165a:	|  |        |     |   48 89 df             	mov    %rbx,%rdi
+    165d:	|  |        |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    1662:	|  |        |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    1667:	|  |        |     |   e8 24 01 00 00       	call   1790 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+                std::free(p);
+    166c:	|  |        |     |   48 89 df             	mov    %rbx,%rdi
+    166f:	|  |        |     |   e8 bc f9 ff ff       	call   1030 <free@plt>
+            switch (tag_) { // result::dtor
+    1674:	|  |        |     \-> 8b 84 24 00 01 00 00 	mov    0x100(%rsp),%eax
+    167b:	|  |        |         83 f8 01             	cmp    $0x1,%eax
+    167e:	|  |  /-----|-------- 0f 84 a4 00 00 00    	je     1728 <box2()+0x1b8>
+    1684:	|  |  |     |         83 f8 02             	cmp    $0x2,%eax
+    1687:	|  |  |     |     /-- 74 37                	je     16c0 <box2()+0x150>
+    1689:	|  |  |     |     |   85 c0                	test   %eax,%eax
+    168b:	|  |  |  /--|-----|-- 74 4a                	je     16d7 <box2()+0x167>
+    168d:	|  |  |  |  |     |   48 8d 05 c5 19 00 00 	lea    0x19c5(%rip),%rax        # 3059 <_IO_stdin_used+0x59>
+    1694:	|  |  |  |  |     |   48 8d 0d b6 19 00 00 	lea    0x19b6(%rip),%rcx        # 3051 <_IO_stdin_used+0x51>
+            , line_num_(line_num)
+    169b:	|  |  |  |  |     |   c7 44 24 10 72 00 00 	movl   $0x72,0x10(%rsp)
+    16a2:	|  |  |  |  |     |   00 
+            : fn_name_(fn_name)
+    16a3:	|  |  |  |  |     |   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    16a8:	|  |  |  |  |     |   66 48 0f 6e d0       	movq   %rax,%xmm2
+    16ad:	|  |  |  |  |     |   66 0f 6c c2          	punpcklqdq %xmm2,%xmm0
+    16b1:	|  |  |  |  |     |   0f 29 04 24          	movaps %xmm0,(%rsp)
+    16b5:	|  |  |  |  |  /--|-- eb 39                	jmp    16f0 <box2()+0x180>
+    16b7:	|  |  |  |  |  |  |   66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    16be:	|  |  |  |  |  |  |   00 00 
+    16c0:	|  |  |  |  |  |  \-> 48 8d bc 24 08 01 00 	lea    0x108(%rsp),%rdi
+    16c7:	|  |  |  |  |  |      00 
+    16c8:	|  |  |  |  |  |      ba 00 01 00 00       	mov    $0x100,%edx
+    16cd:	|  |  |  |  |  |      be a5 00 00 00       	mov    $0xa5,%esi
+    16d2:	|  |  |  |  |  |      e8 b9 00 00 00       	call   1790 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    16d7:	|  |  |  >--|--|----> 48 81 c4 10 02 00 00 	add    $0x210,%rsp
+    16de:	|  |  |  |  |  |      5b                   	pop    %rbx
+    16df:	|  |  |  |  |  |      5d                   	pop    %rbp
+    16e0:	|  |  |  |  |  |      41 5c                	pop    %r12
+    16e2:	|  |  |  |  |  |      c3                   	ret
+            switch (tag) { // result-consume
+    16e3:	|  |  |  |  \--|----> 83 f8 02             	cmp    $0x2,%eax
+    16e6:	|  |  |  |  /--|----- 0f 84 7e 00 00 00    	je     176a <box2()+0x1fa>
+    16ec:	|  |  |  |  |  |      85 c0                	test   %eax,%eax
+    16ee:	|  |  |  |  |  |  /-- 74 6b                	je     175b <box2()+0x1eb>
+                    nel::panic("bad Result");
+    16f0:	|  |  |  |  |  \--|-> 48 89 ee             	mov    %rbp,%rsi
+    16f3:	|  |  |  |  |     |   48 8d 3d 4c 19 00 00 	lea    0x194c(%rip),%rdi        # 3046 <_IO_stdin_used+0x46>
+    16fa:	|  |  |  |  |     |   e8 23 fa ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    16ff:	|  |  |  |  |     |   90                   	nop
+            nel::elem::move(data_, o.data_, N);
+    1700:	\--|--|--|--|-----|-> 48 8d bc 24 08 01 00 	lea    0x108(%rsp),%rdi
+    1707:	   |  |  |  |     |   00 
+    1708:	   |  |  |  |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    170d:	   |  |  |  |     |   48 89 ee             	mov    %rbp,%rsi
+            : tag_(Tag::ERR)
+    1710:	   |  |  |  |     |   c7 84 24 00 01 00 00 	movl   $0x2,0x100(%rsp)
+    1717:	   |  |  |  |     |   02 00 00 00 
+    171b:	   |  |  |  |     |   e8 80 00 00 00       	call   17a0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            return Result(Phantom<Tag::ERR>(), forward<E>(val));
+    1720:	   \--|--|--|-----|-- e9 a4 fe ff ff       	jmp    15c9 <box2()+0x59>
+    1725:	      |  |  |     |   0f 1f 00             	nopl   (%rax)
+            destroy(value_);
+    1728:	      \--|--|-----|-> 48 8b 9c 24 08 01 00 	mov    0x108(%rsp),%rbx
+    172f:	         |  |     |   00 
+            if (p == nullptr) { return; }
+    1730:	         |  |     |   48 85 db             	test   %rbx,%rbx
+    1733:	         \--|-----|-- 74 a2                	je     16d7 <box2()+0x167>
+            nel::elem::set(data_, 0xa5, N);
+    1735:	            |     |   48 89 df             	mov    %rbx,%rdi
+    1738:	            |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    173d:	            |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    1742:	            |     |   e8 49 00 00 00       	call   1790 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1747:	            |     |   48 89 df             	mov    %rbx,%rdi
+    174a:	            |     |   e8 e1 f8 ff ff       	call   1030 <free@plt>
+    174f:	            |     |   48 81 c4 10 02 00 00 	add    $0x210,%rsp
+    1756:	            |     |   5b                   	pop    %rbx
+    1757:	            |     |   5d                   	pop    %rbp
+    1758:	            |     |   41 5c                	pop    %r12
+    175a:	            |     |   c3                   	ret
+                    nel::panic("invalid Result", ctx);
+    175b:	            |     \-> 48 89 ee             	mov    %rbp,%rsi
+    175e:	            |         48 8d 3d d2 18 00 00 	lea    0x18d2(%rip),%rdi        # 3037 <_IO_stdin_used+0x37>
+    1765:	            |         e8 b8 f9 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+                              [&](E &&) -> T { nel::panic("not an OK", ctx); },
+    176a:	            \-------> 48 89 ee             	mov    %rbp,%rsi
+    176d:	                      48 8d 3d b9 18 00 00 	lea    0x18b9(%rip),%rdi        # 302d <_IO_stdin_used+0x2d>
+    1774:	                      e8 a9 f9 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1779:	                      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001780 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    1780:	e9 1b f9 ff ff       	jmp    10a0 <memcpy@plt>
+    1785:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    178c:	00 00 00 00 
+
+0000000000001790 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    1790:	40 0f b6 f6          	movzbl %sil,%esi
+    1794:	e9 c7 f8 ff ff       	jmp    1060 <memset@plt>
+    1799:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000017a0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+}
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    17a0:	e9 fb f8 ff ff       	jmp    10a0 <memcpy@plt>
+    17a5:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    17ac:	00 00 00 00 
+
+00000000000017b0 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    17b0:	e9 1b f9 ff ff       	jmp    10d0 <memmove@plt>
+    17b5:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    17bc:	00 00 00 00 
+
+00000000000017c0 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    17c0:	48 89 f2             	mov    %rsi,%rdx
+    std::memset(d, s, n);
+    17c3:	be a5 00 00 00       	mov    $0xa5,%esi
+    17c8:	e9 93 f8 ff ff       	jmp    1060 <memset@plt>
+    17cd:	0f 1f 00             	nopl   (%rax)
+
+00000000000017d0 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+    set(d, 0xa5, n);
+}
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    17d0:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    17d4:	e8 a7 f8 ff ff       	call   1080 <memcmp@plt>
+    17d9:	85 c0                	test   %eax,%eax
+    17db:	0f 94 c0             	sete   %al
+}
+    17de:	48 83 c4 08          	add    $0x8,%rsp
+    17e2:	c3                   	ret
+    17e3:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    17ea:	00 00 00 00 
+    17ee:	66 90                	xchg   %ax,%ax
+
+00000000000017f0 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    17f0:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    17f4:	e8 87 f8 ff ff       	call   1080 <memcmp@plt>
+    17f9:	85 c0                	test   %eax,%eax
+    17fb:	0f 95 c0             	setne  %al
+}
+    17fe:	48 83 c4 08          	add    $0x8,%rsp
+    1802:	c3                   	ret
+    1803:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    180a:	00 00 00 00 
+    180e:	66 90                	xchg   %ax,%ax
+
+0000000000001810 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    if (n < streaming_min) {
+    1810:	                48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1817:	/-------------- 0f 86 d7 00 00 00    	jbe    18f4 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xe4>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    181d:	|               48 89 f9             	mov    %rdi,%rcx
+{
+    1820:	|               53                   	push   %rbx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1821:	|               48 f7 d9             	neg    %rcx
+    1824:	|               83 e1 0f             	and    $0xf,%ecx
+    std::memcpy(d, s, n);
+    1827:	|               83 f9 08             	cmp    $0x8,%ecx
+    182a:	|     /-------- 0f 82 d0 00 00 00    	jb     1900 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xf0>
+    1830:	|     |         48 8b 06             	mov    (%rsi),%rax
+    1833:	|     |         4c 8d 57 08          	lea    0x8(%rdi),%r10
+    1837:	|     |         48 89 f3             	mov    %rsi,%rbx
+    183a:	|     |         49 83 e2 f8          	and    $0xfffffffffffffff8,%r10
+    183e:	|     |         48 89 07             	mov    %rax,(%rdi)
+    1841:	|     |         48 8b 44 0e f8       	mov    -0x8(%rsi,%rcx,1),%rax
+    1846:	|     |         48 89 44 0f f8       	mov    %rax,-0x8(%rdi,%rcx,1)
+    184b:	|     |         48 89 f8             	mov    %rdi,%rax
+    184e:	|     |         4c 29 d0             	sub    %r10,%rax
+    1851:	|     |         48 29 c3             	sub    %rax,%rbx
+    1854:	|     |         01 c8                	add    %ecx,%eax
+    1856:	|     |         83 e0 f8             	and    $0xfffffff8,%eax
+    1859:	|     |         83 f8 08             	cmp    $0x8,%eax
+    185c:	|  /--|-------- 72 1a                	jb     1878 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    185e:	|  |  |         83 e0 f8             	and    $0xfffffff8,%eax
+    1861:	|  |  |         45 31 c0             	xor    %r8d,%r8d
+    1864:	|  |  |     /-> 45 89 c1             	mov    %r8d,%r9d
+    1867:	|  |  |     |   41 83 c0 08          	add    $0x8,%r8d
+    186b:	|  |  |     |   4e 8b 1c 0b          	mov    (%rbx,%r9,1),%r11
+    186f:	|  |  |     |   4f 89 1c 0a          	mov    %r11,(%r10,%r9,1)
+    1873:	|  |  |     |   41 39 c0             	cmp    %eax,%r8d
+    1876:	|  |  |     \-- 72 ec                	jb     1864 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x54>
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1878:	|  >--|-------> 48 8d 41 40          	lea    0x40(%rcx),%rax
+    187c:	|  |  |         48 01 f9             	add    %rdi,%rcx
+    187f:	|  |  |         90                   	nop
+    std::memcpy(&v, s, sizeof(v));
+    1880:	|  |  |     /-> f3 0f 6f 54 06 d0    	movdqu -0x30(%rsi,%rax,1),%xmm2
+    1886:	|  |  |     |   f3 0f 6f 4c 06 e0    	movdqu -0x20(%rsi,%rax,1),%xmm1
+    188c:	|  |  |     |   49 89 c0             	mov    %rax,%r8
+    for (; i + 64 <= n; i += 64) {
+    188f:	|  |  |     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1893:	|  |  |     |   f3 0f 6f 44 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1899:	|  |  |     |   f3 0f 6f 5c 06 c0    	movdqu -0x40(%rsi,%rax,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    189f:	|  |  |     |   48 83 c0 40          	add    $0x40,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    18a3:	|  |  |     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    18a8:	|  |  |     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    18ad:	|  |  |     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    18b2:	|  |  |     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    18b7:	|  |  |     |   48 39 c2             	cmp    %rax,%rdx
+    18ba:	|  |  |     \-- 73 c4                	jae    1880 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x70>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    18bc:	|  |  |         49 8d 40 10          	lea    0x10(%r8),%rax
+    18c0:	|  |  |         48 39 c2             	cmp    %rax,%rdx
+    18c3:	|  |  |  /----- 72 22                	jb     18e7 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd7>
+    18c5:	|  |  |  |      48 8d 4f f0          	lea    -0x10(%rdi),%rcx
+    18c9:	|  |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    18d0:	|  |  |  |  /-> f3 0f 6f 64 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm4
+    18d6:	|  |  |  |  |   49 89 c0             	mov    %rax,%r8
+    18d9:	|  |  |  |  |   66 0f e7 24 01       	movntdq %xmm4,(%rcx,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    18de:	|  |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    18e2:	|  |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    18e5:	|  |  |  |  \-- 73 e9                	jae    18d0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc0>
+        stream16(d + i, load16(s + i));
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    18e7:	|  |  |  \----> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    18ea:	|  |  |         4c 01 c7             	add    %r8,%rdi
+    18ed:	|  |  |         4c 29 c2             	sub    %r8,%rdx
+    18f0:	|  |  |         4c 01 c6             	add    %r8,%rsi
+}
+    18f3:	|  |  |         5b                   	pop    %rbx
+    std::memcpy(d, s, n);
+    18f4:	\--|--|-------> e9 a7 f7 ff ff       	jmp    10a0 <memcpy@plt>
+    18f9:	   |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1900:	   |  \-------> f6 c1 04             	test   $0x4,%cl
+    1903:	   |        /-- 75 25                	jne    192a <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x11a>
+    1905:	   |        |   85 c9                	test   %ecx,%ecx
+    1907:	   +--------|-- 0f 84 6b ff ff ff    	je     1878 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    190d:	   |        |   0f b6 06             	movzbl (%rsi),%eax
+    1910:	   |        |   88 07                	mov    %al,(%rdi)
+    1912:	   |        |   f6 c1 02             	test   $0x2,%cl
+    1915:	   +--------|-- 0f 84 5d ff ff ff    	je     1878 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    191b:	   |        |   0f b7 44 0e fe       	movzwl -0x2(%rsi,%rcx,1),%eax
+    1920:	   |        |   66 89 44 0f fe       	mov    %ax,-0x2(%rdi,%rcx,1)
+    1925:	   +--------|-- e9 4e ff ff ff       	jmp    1878 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    192a:	   |        \-> 8b 06                	mov    (%rsi),%eax
+    192c:	   |            89 07                	mov    %eax,(%rdi)
+    192e:	   |            8b 44 0e fc          	mov    -0x4(%rsi,%rcx,1),%eax
+    1932:	   |            89 44 0f fc          	mov    %eax,-0x4(%rdi,%rcx,1)
+    1936:	   \----------- e9 3d ff ff ff       	jmp    1878 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    193b:	                0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000001940 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    1940:	                                           49 89 f8             	mov    %rdi,%r8
+    1943:	                                           48 89 f1             	mov    %rsi,%rcx
+    if (n < streaming_min) {
+    1946:	                                           48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    194d:	                              /----------- 0f 86 85 03 00 00    	jbe    1cd8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x398>
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1953:	                              |            48 89 fe             	mov    %rdi,%rsi
+{
+    1956:	                              |            41 57                	push   %r15
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1958:	                              |            48 f7 de             	neg    %rsi
+{
+    195b:	                              |            41 56                	push   %r14
+    for (Index i = 0; i < head; ++i) {
+    195d:	                              |            48 89 f0             	mov    %rsi,%rax
+{
+    1960:	                              |            41 55                	push   %r13
+    1962:	                              |            41 54                	push   %r12
+    1964:	                              |            55                   	push   %rbp
+    1965:	                              |            53                   	push   %rbx
+    for (Index i = 0; i < head; ++i) {
+    1966:	                              |            83 e0 0f             	and    $0xf,%eax
+    1969:	/-----------------------------|----------- 0f 84 01 01 00 00    	je     1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    196f:	|                             |            48 8d 78 ff          	lea    -0x1(%rax),%rdi
+    1973:	|                             |            48 83 ff 02          	cmp    $0x2,%rdi
+    1977:	|  /--------------------------|----------- 0f 86 8a 04 00 00    	jbe    1e07 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4c7>
+    197d:	|  |                          |            4c 8d 51 01          	lea    0x1(%rcx),%r10
+    1981:	|  |                          |            4d 89 c1             	mov    %r8,%r9
+    1984:	|  |                          |            4d 29 d1             	sub    %r10,%r9
+    1987:	|  |                          |            49 83 f9 06          	cmp    $0x6,%r9
+    198b:	|  |                          |  /-------- 0f 87 c7 02 00 00    	ja     1c58 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x318>
+        d[i] = p[i];
+    1991:	|  |                          |  |         0f b6 39             	movzbl (%rcx),%edi
+    1994:	|  |                          |  |         41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1997:	|  |                          |  |         40 f6 c6 0e          	test   $0xe,%sil
+    199b:	+--|--------------------------|--|-------- 0f 84 cf 00 00 00    	je     1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    19a1:	|  |                          |  |         0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    19a5:	|  |                          |  |         41 88 78 01          	mov    %dil,0x1(%r8)
+    19a9:	|  |  /-----------------------|--|-------> 0f b6 79 02          	movzbl 0x2(%rcx),%edi
+    19ad:	|  |  |                       |  |         41 88 78 02          	mov    %dil,0x2(%r8)
+    for (Index i = 0; i < head; ++i) {
+    19b1:	|  |  |                       |  |         40 f6 c6 0c          	test   $0xc,%sil
+    19b5:	+--|--|-----------------------|--|-------- 0f 84 b5 00 00 00    	je     1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    19bb:	|  |  |                       |  |         0f b6 79 03          	movzbl 0x3(%rcx),%edi
+    19bf:	|  |  |                       |  |         41 88 78 03          	mov    %dil,0x3(%r8)
+    for (Index i = 0; i < head; ++i) {
+    19c3:	|  |  |                       |  |         48 83 f8 04          	cmp    $0x4,%rax
+    19c7:	+--|--|-----------------------|--|-------- 0f 86 a3 00 00 00    	jbe    1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    19cd:	|  |  |                       |  |         0f b6 79 04          	movzbl 0x4(%rcx),%edi
+    19d1:	|  |  |                       |  |         41 88 78 04          	mov    %dil,0x4(%r8)
+    for (Index i = 0; i < head; ++i) {
+    19d5:	|  |  |                       |  |         48 83 f8 05          	cmp    $0x5,%rax
+    19d9:	+--|--|-----------------------|--|-------- 0f 84 91 00 00 00    	je     1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    19df:	|  |  |                       |  |         0f b6 79 05          	movzbl 0x5(%rcx),%edi
+    19e3:	|  |  |                       |  |         41 88 78 05          	mov    %dil,0x5(%r8)
+    for (Index i = 0; i < head; ++i) {
+    19e7:	|  |  |                       |  |         48 83 f8 06          	cmp    $0x6,%rax
+    19eb:	+--|--|-----------------------|--|-------- 0f 84 7f 00 00 00    	je     1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    19f1:	|  |  |                       |  |         0f b6 79 06          	movzbl 0x6(%rcx),%edi
+    for (Index i = 0; i < head; ++i) {
+    19f5:	|  |  |                       |  |         83 e6 08             	and    $0x8,%esi
+        d[i] = p[i];
+    19f8:	|  |  |                       |  |         41 88 78 06          	mov    %dil,0x6(%r8)
+    for (Index i = 0; i < head; ++i) {
+    19fc:	+--|--|-----------------------|--|-------- 74 72                	je     1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    19fe:	|  |  |                       |  |         0f b6 71 07          	movzbl 0x7(%rcx),%esi
+    1a02:	|  |  |                       |  |         41 88 70 07          	mov    %sil,0x7(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1a06:	|  |  |                       |  |         48 83 f8 08          	cmp    $0x8,%rax
+    1a0a:	+--|--|-----------------------|--|-------- 76 64                	jbe    1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1a0c:	|  |  |                       |  |         0f b6 71 08          	movzbl 0x8(%rcx),%esi
+    1a10:	|  |  |                       |  |         41 88 70 08          	mov    %sil,0x8(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1a14:	|  |  |                       |  |         48 83 f8 09          	cmp    $0x9,%rax
+    1a18:	+--|--|-----------------------|--|-------- 74 56                	je     1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1a1a:	|  |  |                       |  |         0f b6 71 09          	movzbl 0x9(%rcx),%esi
+    1a1e:	|  |  |                       |  |         41 88 70 09          	mov    %sil,0x9(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1a22:	|  |  |                       |  |         48 83 f8 0a          	cmp    $0xa,%rax
+    1a26:	+--|--|-----------------------|--|-------- 74 48                	je     1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1a28:	|  |  |                       |  |         0f b6 71 0a          	movzbl 0xa(%rcx),%esi
+    1a2c:	|  |  |                       |  |         41 88 70 0a          	mov    %sil,0xa(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1a30:	|  |  |                       |  |         48 83 f8 0b          	cmp    $0xb,%rax
+    1a34:	+--|--|-----------------------|--|-------- 74 3a                	je     1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1a36:	|  |  |                       |  |         0f b6 71 0b          	movzbl 0xb(%rcx),%esi
+    1a3a:	|  |  |                       |  |         41 88 70 0b          	mov    %sil,0xb(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1a3e:	|  |  |                       |  |         48 83 f8 0c          	cmp    $0xc,%rax
+    1a42:	+--|--|-----------------------|--|-------- 74 2c                	je     1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1a44:	|  |  |                       |  |         0f b6 71 0c          	movzbl 0xc(%rcx),%esi
+    1a48:	|  |  |                       |  |         41 88 70 0c          	mov    %sil,0xc(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1a4c:	|  |  |                       |  |         48 83 f8 0d          	cmp    $0xd,%rax
+    1a50:	+--|--|-----------------------|--|-------- 74 1e                	je     1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1a52:	|  |  |                       |  |         0f b6 71 0d          	movzbl 0xd(%rcx),%esi
+    1a56:	|  |  |                       |  |         41 88 70 0d          	mov    %sil,0xd(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1a5a:	|  |  |                       |  |         49 8d 70 ff          	lea    -0x1(%r8),%rsi
+    1a5e:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    1a61:	+--|--|-----------------------|--|-------- 75 0d                	jne    1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1a63:	|  |  |                       |  |         0f b6 71 0e          	movzbl 0xe(%rcx),%esi
+    1a67:	|  |  |                       |  |         41 88 70 0e          	mov    %sil,0xe(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1a6b:	|  |  |                       |  |         0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+        rotated[i] = p[(head + i) % 16];
+    1a70:	>--|--|-----------------------|--|-------> 48 8d 70 07          	lea    0x7(%rax),%rsi
+    1a74:	|  |  |                       |  |         4c 8d 78 06          	lea    0x6(%rax),%r15
+    1a78:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    1a7b:	|  |  |                       |  |         4c 8d 70 05          	lea    0x5(%rax),%r14
+    1a7f:	|  |  |                       |  |         4c 8d 68 04          	lea    0x4(%rax),%r13
+    1a83:	|  |  |                       |  |         41 83 e7 0f          	and    $0xf,%r15d
+    std::memcpy(&v, s, sizeof(v));
+    1a87:	|  |  |                       |  |         0f b6 34 31          	movzbl (%rcx,%rsi,1),%esi
+        rotated[i] = p[(head + i) % 16];
+    1a8b:	|  |  |                       |  |         41 83 e6 0f          	and    $0xf,%r14d
+    1a8f:	|  |  |                       |  |         41 83 e5 0f          	and    $0xf,%r13d
+    1a93:	|  |  |                       |  |         4c 8d 60 03          	lea    0x3(%rax),%r12
+    std::memcpy(&v, s, sizeof(v));
+    1a97:	|  |  |                       |  |         46 0f b6 3c 39       	movzbl (%rcx,%r15,1),%r15d
+    1a9c:	|  |  |                       |  |         46 0f b6 34 31       	movzbl (%rcx,%r14,1),%r14d
+        rotated[i] = p[(head + i) % 16];
+    1aa1:	|  |  |                       |  |         48 8d 78 08          	lea    0x8(%rax),%rdi
+    1aa5:	|  |  |                       |  |         41 83 e4 0f          	and    $0xf,%r12d
+    std::memcpy(&v, s, sizeof(v));
+    1aa9:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1aad:	|  |  |                       |  |         46 0f b6 2c 29       	movzbl (%rcx,%r13,1),%r13d
+        rotated[i] = p[(head + i) % 16];
+    1ab2:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    1ab5:	|  |  |                       |  |         48 8d 68 02          	lea    0x2(%rax),%rbp
+    std::memcpy(&v, s, sizeof(v));
+    1ab9:	|  |  |                       |  |         4c 09 fe             	or     %r15,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1abc:	|  |  |                       |  |         48 89 7c 24 c8       	mov    %rdi,-0x38(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    1ac1:	|  |  |                       |  |         46 0f b6 24 21       	movzbl (%rcx,%r12,1),%r12d
+        rotated[i] = p[(head + i) % 16];
+    1ac6:	|  |  |                       |  |         83 e5 0f             	and    $0xf,%ebp
+    std::memcpy(&v, s, sizeof(v));
+    1ac9:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1acd:	|  |  |                       |  |         48 8d 78 09          	lea    0x9(%rax),%rdi
+    std::memcpy(&v, s, sizeof(v));
+    1ad1:	|  |  |                       |  |         0f b6 2c 29          	movzbl (%rcx,%rbp,1),%ebp
+        rotated[i] = p[(head + i) % 16];
+    1ad5:	|  |  |                       |  |         48 8d 58 01          	lea    0x1(%rax),%rbx
+    std::memcpy(&v, s, sizeof(v));
+    1ad9:	|  |  |                       |  |         4c 09 f6             	or     %r14,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1adc:	|  |  |                       |  |         49 89 fb             	mov    %rdi,%r11
+    1adf:	|  |  |                       |  |         48 8d 78 0a          	lea    0xa(%rax),%rdi
+    1ae3:	|  |  |                       |  |         83 e3 0f             	and    $0xf,%ebx
+    std::memcpy(&v, s, sizeof(v));
+    1ae6:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1aea:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    1aee:	|  |  |                       |  |         49 89 fa             	mov    %rdi,%r10
+    std::memcpy(&v, s, sizeof(v));
+    1af1:	|  |  |                       |  |         4c 09 ee             	or     %r13,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1af4:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    1af8:	|  |  |                       |  |         48 8d 78 0b          	lea    0xb(%rax),%rdi
+    1afc:	|  |  |                       |  |         4c 89 5c 24 e0       	mov    %r11,-0x20(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    1b01:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1b05:	|  |  |                       |  |         4c 8d 58 0f          	lea    0xf(%rax),%r11
+    1b09:	|  |  |                       |  |         4c 89 54 24 e8       	mov    %r10,-0x18(%rsp)
+    1b0e:	|  |  |                       |  |         49 89 f9             	mov    %rdi,%r9
+    std::memcpy(&v, s, sizeof(v));
+    1b11:	|  |  |                       |  |         4c 09 e6             	or     %r12,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1b14:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    1b18:	|  |  |                       |  |         4c 8d 50 0e          	lea    0xe(%rax),%r10
+    1b1c:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    1b20:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1b24:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    1b28:	|  |  |                       |  |         4c 89 4c 24 f0       	mov    %r9,-0x10(%rsp)
+    1b2d:	|  |  |                       |  |         4c 8d 48 0d          	lea    0xd(%rax),%r9
+    std::memcpy(&v, s, sizeof(v));
+    1b31:	|  |  |                       |  |         48 09 ee             	or     %rbp,%rsi
+    1b34:	|  |  |                       |  |         0f b6 2c 19          	movzbl (%rcx,%rbx,1),%ebp
+    1b38:	|  |  |                       |  |         46 0f b6 14 11       	movzbl (%rcx,%r10,1),%r10d
+        rotated[i] = p[(head + i) % 16];
+    1b3d:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    1b41:	|  |  |                       |  |         48 89 f3             	mov    %rsi,%rbx
+    1b44:	|  |  |                       |  |         42 0f b6 34 19       	movzbl (%rcx,%r11,1),%esi
+    1b49:	|  |  |                       |  |         46 0f b6 0c 09       	movzbl (%rcx,%r9,1),%r9d
+        rotated[i] = p[(head + i) % 16];
+    1b4e:	|  |  |                       |  |         48 8d 78 0c          	lea    0xc(%rax),%rdi
+    1b52:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    std::memcpy(&v, s, sizeof(v));
+    1b55:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    1b59:	|  |  |                       |  |         4c 8b 5c 24 e0       	mov    -0x20(%rsp),%r11
+    1b5e:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1b62:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    1b65:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    1b69:	|  |  |                       |  |         0f b6 2c 01          	movzbl (%rcx,%rax,1),%ebp
+    1b6d:	|  |  |                       |  |         4c 09 d6             	or     %r10,%rsi
+    1b70:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    1b74:	|  |  |                       |  |         4c 8b 54 24 e8       	mov    -0x18(%rsp),%r10
+    1b79:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1b7d:	|  |  |                       |  |         4c 09 ce             	or     %r9,%rsi
+    1b80:	|  |  |                       |  |         4c 8b 4c 24 f0       	mov    -0x10(%rsp),%r9
+    1b85:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1b89:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    1b8c:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    1b8f:	|  |  |                       |  |         42 0f b6 3c 09       	movzbl (%rcx,%r9,1),%edi
+    1b94:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1b98:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    1b9b:	|  |  |                       |  |         42 0f b6 3c 11       	movzbl (%rcx,%r10,1),%edi
+    1ba0:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1ba4:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    1ba7:	|  |  |                       |  |         42 0f b6 3c 19       	movzbl (%rcx,%r11,1),%edi
+    1bac:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1bb0:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    1bb3:	|  |  |                       |  |         48 8b 7c 24 c8       	mov    -0x38(%rsp),%rdi
+    1bb8:	|  |  |                       |  |         48 89 5c 24 c8       	mov    %rbx,-0x38(%rsp)
+    1bbd:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1bc1:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    1bc5:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1bc8:	|  |  |                       |  |         48 8d 78 40          	lea    0x40(%rax),%rdi
+    1bcc:	|  |  |                       |  |         4c 01 c0             	add    %r8,%rax
+    std::memcpy(&v, s, sizeof(v));
+    1bcf:	|  |  |                       |  |         48 89 74 24 d0       	mov    %rsi,-0x30(%rsp)
+    1bd4:	|  |  |                       |  |         66 0f 6f 44 24 c8    	movdqa -0x38(%rsp),%xmm0
+    for (; i + 64 <= n; i += 64) {
+    1bda:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1be0:	|  |  |                       |  |     /-> 48 89 fe             	mov    %rdi,%rsi
+    for (; i + 64 <= n; i += 64) {
+    1be3:	|  |  |                       |  |     |   48 83 c7 40          	add    $0x40,%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1be7:	|  |  |                       |  |     |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    1beb:	|  |  |                       |  |     |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    1bf0:	|  |  |                       |  |     |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    1bf5:	|  |  |                       |  |     |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    1bfa:	|  |  |                       |  |     |   48 83 c0 40          	add    $0x40,%rax
+    1bfe:	|  |  |                       |  |     |   48 39 fa             	cmp    %rdi,%rdx
+    1c01:	|  |  |                       |  |     \-- 73 dd                	jae    1be0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2a0>
+        stream16(d + i, v);
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+    1c03:	|  |  |                       |  |         48 8d 46 10          	lea    0x10(%rsi),%rax
+    1c07:	|  |  |                       |  |         48 39 c2             	cmp    %rax,%rdx
+    1c0a:	|  |  |                       |  |  /----- 72 15                	jb     1c21 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2e1>
+    1c0c:	|  |  |                       |  |  |      49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1c10:	|  |  |                       |  |  |  /-> 48 89 c6             	mov    %rax,%rsi
+    1c13:	|  |  |                       |  |  |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    1c18:	|  |  |                       |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    1c1c:	|  |  |                       |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    1c1f:	|  |  |                       |  |  |  \-- 73 ef                	jae    1c10 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2d0>
+        stream16(d + i, v);
+    }
+    __builtin_ia32_sfence();
+    1c21:	|  |  |                       |  |  \----> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    1c24:	|  |  |                       |  |         48 39 d6             	cmp    %rdx,%rsi
+    1c27:	|  |  |                       |  |  /----- 73 1e                	jae    1c47 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x307>
+    1c29:	|  |  |                       |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        d[i] = p[i % 16];
+    1c30:	|  |  |                       |  |  |  /-> 48 89 f0             	mov    %rsi,%rax
+    1c33:	|  |  |                       |  |  |  |   83 e0 0f             	and    $0xf,%eax
+    1c36:	|  |  |                       |  |  |  |   0f b6 04 01          	movzbl (%rcx,%rax,1),%eax
+    1c3a:	|  |  |                       |  |  |  |   41 88 04 30          	mov    %al,(%r8,%rsi,1)
+    for (; i < n; ++i) {
+    1c3e:	|  |  |                       |  |  |  |   48 83 c6 01          	add    $0x1,%rsi
+    1c42:	|  |  |                       |  |  |  |   48 39 f2             	cmp    %rsi,%rdx
+    1c45:	|  |  |                       |  |  |  \-- 75 e9                	jne    1c30 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2f0>
+    }
+}
+    1c47:	|  |  |                       |  |  \----> 5b                   	pop    %rbx
+    1c48:	|  |  |                       |  |         5d                   	pop    %rbp
+    1c49:	|  |  |                       |  |         41 5c                	pop    %r12
+    1c4b:	|  |  |                       |  |         41 5d                	pop    %r13
+    1c4d:	|  |  |                       |  |         41 5e                	pop    %r14
+    1c4f:	|  |  |                       |  |         41 5f                	pop    %r15
+    1c51:	|  |  |                       |  |         c3                   	ret
+    1c52:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1c58:	|  |  |                       |  \-------> 48 83 ff 06          	cmp    $0x6,%rdi
+    1c5c:	|  |  |  /--------------------|----------- 0f 86 e1 01 00 00    	jbe    1e43 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x503>
+        d[i] = p[i];
+    1c62:	|  |  |  |                    |            48 8b 31             	mov    (%rcx),%rsi
+    1c65:	|  |  |  |                    |            49 89 30             	mov    %rsi,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1c68:	|  |  |  |                    |            48 83 f8 08          	cmp    $0x8,%rax
+    1c6c:	+--|--|--|--------------------|----------- 0f 84 fe fd ff ff    	je     1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    1c72:	|  |  |  |                    |            48 8d 70 f7          	lea    -0x9(%rax),%rsi
+    1c76:	|  |  |  |                    |            4c 8d 48 f8          	lea    -0x8(%rax),%r9
+    1c7a:	|  |  |  |                    |            48 83 fe 02          	cmp    $0x2,%rsi
+    1c7e:	|  |  |  |                    |            be 08 00 00 00       	mov    $0x8,%esi
+    1c83:	|  |  |  |                    |        /-- 76 15                	jbe    1c9a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x35a>
+        d[i] = p[i];
+    1c85:	|  |  |  |  /-----------------|--------|-> 8b 3c 31             	mov    (%rcx,%rsi,1),%edi
+    1c88:	|  |  |  |  |                 |        |   41 89 3c 30          	mov    %edi,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    1c8c:	|  |  |  |  |                 |        |   48 83 c6 04          	add    $0x4,%rsi
+    1c90:	|  |  |  |  |                 |        |   49 83 f9 04          	cmp    $0x4,%r9
+    1c94:	+--|--|--|--|-----------------|--------|-- 0f 84 d6 fd ff ff    	je     1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1c9a:	|  |  |  |  |                 |        \-> 0f b6 3c 31          	movzbl (%rcx,%rsi,1),%edi
+    1c9e:	|  |  |  |  |                 |            41 88 3c 30          	mov    %dil,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    1ca2:	|  |  |  |  |                 |            48 8d 7e 01          	lea    0x1(%rsi),%rdi
+    1ca6:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    1ca9:	+--|--|--|--|-----------------|----------- 0f 83 c1 fd ff ff    	jae    1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1caf:	|  |  |  |  |                 |            0f b6 7c 31 01       	movzbl 0x1(%rcx,%rsi,1),%edi
+    1cb4:	|  |  |  |  |                 |            41 88 7c 30 01       	mov    %dil,0x1(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    1cb9:	|  |  |  |  |                 |            48 8d 7e 02          	lea    0x2(%rsi),%rdi
+    1cbd:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    1cc0:	+--|--|--|--|-----------------|----------- 0f 83 aa fd ff ff    	jae    1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1cc6:	|  |  |  |  |                 |            0f b6 7c 31 02       	movzbl 0x2(%rcx,%rsi,1),%edi
+    1ccb:	|  |  |  |  |                 |            41 88 7c 30 02       	mov    %dil,0x2(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    1cd0:	+--|--|--|--|-----------------|----------- e9 9b fd ff ff       	jmp    1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    1cd5:	|  |  |  |  |                 |            0f 1f 00             	nopl   (%rax)
+    Length done = (n < 16) ? n : 16;
+    1cd8:	|  |  |  |  |                 \----------> 41 ba 10 00 00 00    	mov    $0x10,%r10d
+    1cde:	|  |  |  |  |                              4c 39 d2             	cmp    %r10,%rdx
+    1ce1:	|  |  |  |  |                              4c 0f 46 d2          	cmovbe %rdx,%r10
+    std::memcpy(d, s, n);
+    1ce5:	|  |  |  |  |                              44 89 d0             	mov    %r10d,%eax
+    1ce8:	|  |  |  |  |                              41 83 fa 08          	cmp    $0x8,%r10d
+    1cec:	|  |  |  |  |        /-------------------- 0f 82 cc 00 00 00    	jb     1dbe <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47e>
+    1cf2:	|  |  |  |  |        |                     48 8b 06             	mov    (%rsi),%rax
+    1cf5:	|  |  |  |  |        |                     4c 8d 4f 08          	lea    0x8(%rdi),%r9
+    1cf9:	|  |  |  |  |        |                     49 83 e1 f8          	and    $0xfffffffffffffff8,%r9
+    1cfd:	|  |  |  |  |        |                     48 89 07             	mov    %rax,(%rdi)
+    1d00:	|  |  |  |  |        |                     44 89 d0             	mov    %r10d,%eax
+    1d03:	|  |  |  |  |        |                     48 8b 74 06 f8       	mov    -0x8(%rsi,%rax,1),%rsi
+    1d08:	|  |  |  |  |        |                     48 89 74 07 f8       	mov    %rsi,-0x8(%rdi,%rax,1)
+    1d0d:	|  |  |  |  |        |                     48 89 f8             	mov    %rdi,%rax
+    1d10:	|  |  |  |  |        |                     4c 29 c8             	sub    %r9,%rax
+    1d13:	|  |  |  |  |        |                     48 29 c1             	sub    %rax,%rcx
+    1d16:	|  |  |  |  |        |                     44 01 d0             	add    %r10d,%eax
+    1d19:	|  |  |  |  |        |                     83 e0 f8             	and    $0xfffffff8,%eax
+    1d1c:	|  |  |  |  |        |                     83 f8 08             	cmp    $0x8,%eax
+    1d1f:	|  |  |  |  |  /-----|-------------------- 72 16                	jb     1d37 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    1d21:	|  |  |  |  |  |     |                     83 e0 f8             	and    $0xfffffff8,%eax
+    1d24:	|  |  |  |  |  |     |                     31 f6                	xor    %esi,%esi
+    1d26:	|  |  |  |  |  |     |                 /-> 89 f7                	mov    %esi,%edi
+    1d28:	|  |  |  |  |  |     |                 |   83 c6 08             	add    $0x8,%esi
+    1d2b:	|  |  |  |  |  |     |                 |   4c 8b 1c 39          	mov    (%rcx,%rdi,1),%r11
+    1d2f:	|  |  |  |  |  |     |                 |   4d 89 1c 39          	mov    %r11,(%r9,%rdi,1)
+    1d33:	|  |  |  |  |  |     |                 |   39 c6                	cmp    %eax,%esi
+    1d35:	|  |  |  |  |  |     |                 \-- 72 ef                	jb     1d26 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3e6>
+    while (done < n) {
+    1d37:	|  |  |  |  |  >-----|-------------------> 49 39 d2             	cmp    %rdx,%r10
+    1d3a:	|  |  |  |  |  |     |           /-------- 72 33                	jb     1d6f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    1d3c:	|  |  |  |  |  |     |     /-----|-------- e9 af 00 00 00       	jmp    1df0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b0>
+    1d41:	|  |  |  |  |  |     |     |     |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    std::memcpy(d, s, n);
+    1d48:	|  |  |  |  |  |     |     |     |     /-> 41 f6 c1 04          	test   $0x4,%r9b
+    1d4c:	|  |  |  |  |  |     |     |  /--|-----|-- 0f 85 9f 00 00 00    	jne    1df1 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b1>
+    1d52:	|  |  |  |  |  |     |     |  |  |     |   45 85 c9             	test   %r9d,%r9d
+    1d55:	|  |  |  |  |  |  /--|-----|--|--|-----|-- 74 10                	je     1d67 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    1d57:	|  |  |  |  |  |  |  |     |  |  |     |   41 0f b6 08          	movzbl (%r8),%ecx
+    1d5b:	|  |  |  |  |  |  |  |     |  |  |     |   88 08                	mov    %cl,(%rax)
+    1d5d:	|  |  |  |  |  |  |  |     |  |  |     |   41 f6 c1 02          	test   $0x2,%r9b
+    1d61:	|  |  |  |  |  |  |  |  /--|--|--|-----|-- 0f 85 c9 00 00 00    	jne    1e30 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4f0>
+        done += m;
+    1d67:	|  |  |  |  |  |  >--|--|--|--|--|-----|-> 4d 01 ca             	add    %r9,%r10
+    while (done < n) {
+    1d6a:	|  |  |  |  |  |  |  |  |  |  |  |     |   49 39 d2             	cmp    %rdx,%r10
+    1d6d:	|  |  |  |  |  |  |  |  |  |  |  |  /--|-- 73 4e                	jae    1dbd <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47d>
+        Length const m = (done < n - done) ? done : n - done;
+    1d6f:	|  |  |  |  |  |  |  |  |  |  |  >--|--|-> 49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    1d72:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4b 8d 04 10          	lea    (%r8,%r10,1),%rax
+        Length const m = (done < n - done) ? done : n - done;
+    1d76:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 29 d1             	sub    %r10,%r9
+    1d79:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 39 d1             	cmp    %r10,%r9
+    1d7c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 0f 47 ca          	cmova  %r10,%r9
+    std::memcpy(d, s, n);
+    1d80:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   41 83 f9 08          	cmp    $0x8,%r9d
+    1d84:	|  |  |  |  |  |  |  |  |  |  |  |  |  \-- 72 c2                	jb     1d48 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x408>
+    1d86:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 08             	mov    (%r8),%rcx
+    1d89:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 78 08          	lea    0x8(%rax),%rdi
+        done += m;
+    1d8d:	|  |  |  |  |  |  |  |  |  |  |  |  |      4d 01 ca             	add    %r9,%r10
+    std::memcpy(d, s, n);
+    1d90:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 83 e7 f8          	and    $0xfffffffffffffff8,%rdi
+    1d94:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 08             	mov    %rcx,(%rax)
+    1d97:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 89 c9             	mov    %r9d,%ecx
+    1d9a:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 74 08 f8       	mov    -0x8(%r8,%rcx,1),%rsi
+    1d9f:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 74 08 f8       	mov    %rsi,-0x8(%rax,%rcx,1)
+    1da4:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 f8             	sub    %rdi,%rax
+    1da7:	|  |  |  |  |  |  |  |  |  |  |  |  |      4c 89 c6             	mov    %r8,%rsi
+    1daa:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 c6             	sub    %rax,%rsi
+    1dad:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 01 c8             	add    %r9d,%eax
+    1db0:	|  |  |  |  |  |  |  |  |  |  |  |  |      c1 e8 03             	shr    $0x3,%eax
+    1db3:	|  |  |  |  |  |  |  |  |  |  |  |  |      89 c1                	mov    %eax,%ecx
+    1db5:	|  |  |  |  |  |  |  |  |  |  |  |  |      f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    1db8:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 39 d2             	cmp    %rdx,%r10
+    1dbb:	|  |  |  |  |  |  |  |  |  |  |  \--|----- 72 b2                	jb     1d6f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    1dbd:	|  |  |  |  |  |  |  |  |  |  |     \----> c3                   	ret
+    std::memcpy(d, s, n);
+    1dbe:	|  |  |  |  |  |  |  \--|--|--|----------> 41 f6 c2 04          	test   $0x4,%r10b
+    1dc2:	|  |  |  |  |  |  |     |  |  |        /-- 0f 85 85 00 00 00    	jne    1e4d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x50d>
+    1dc8:	|  |  |  |  |  |  |     |  |  |        |   85 c0                	test   %eax,%eax
+    1dca:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 67 ff ff ff    	je     1d37 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    1dd0:	|  |  |  |  |  |  |     |  |  |        |   0f b6 36             	movzbl (%rsi),%esi
+    1dd3:	|  |  |  |  |  |  |     |  |  |        |   40 88 37             	mov    %sil,(%rdi)
+    1dd6:	|  |  |  |  |  |  |     |  |  |        |   a8 02                	test   $0x2,%al
+    1dd8:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 59 ff ff ff    	je     1d37 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    1dde:	|  |  |  |  |  |  |     |  |  |        |   0f b7 4c 01 fe       	movzwl -0x2(%rcx,%rax,1),%ecx
+    1de3:	|  |  |  |  |  |  |     |  |  |        |   66 89 4c 07 fe       	mov    %cx,-0x2(%rdi,%rax,1)
+    1de8:	|  |  |  |  |  +--|-----|--|--|--------|-- e9 4a ff ff ff       	jmp    1d37 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    1ded:	|  |  |  |  |  |  |     |  |  |        |   0f 1f 00             	nopl   (%rax)
+    1df0:	|  |  |  |  |  |  |     |  \--|--------|-> c3                   	ret
+    1df1:	|  |  |  |  |  |  |     |     \--------|-> 41 8b 08             	mov    (%r8),%ecx
+    1df4:	|  |  |  |  |  |  |     |              |   89 08                	mov    %ecx,(%rax)
+    1df6:	|  |  |  |  |  |  |     |              |   44 89 c9             	mov    %r9d,%ecx
+    1df9:	|  |  |  |  |  |  |     |              |   41 8b 74 08 fc       	mov    -0x4(%r8,%rcx,1),%esi
+    1dfe:	|  |  |  |  |  |  |     |              |   89 74 08 fc          	mov    %esi,-0x4(%rax,%rcx,1)
+    1e02:	|  |  |  |  |  |  +-----|--------------|-- e9 60 ff ff ff       	jmp    1d67 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+        d[i] = p[i];
+    1e07:	|  \--|--|--|--|--|-----|--------------|-> 0f b6 39             	movzbl (%rcx),%edi
+    1e0a:	|     |  |  |  |  |     |              |   41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1e0d:	|     |  |  |  |  |     |              |   40 f6 c6 0e          	test   $0xe,%sil
+    1e11:	+-----|--|--|--|--|-----|--------------|-- 0f 84 59 fc ff ff    	je     1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1e17:	|     |  |  |  |  |     |              |   0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    1e1b:	|     |  |  |  |  |     |              |   41 88 78 01          	mov    %dil,0x1(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1e1f:	|     |  |  |  |  |     |              |   48 83 f8 03          	cmp    $0x3,%rax
+    1e23:	\-----|--|--|--|--|-----|--------------|-- 0f 85 47 fc ff ff    	jne    1a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    1e29:	      \--|--|--|--|-----|--------------|-- e9 7b fb ff ff       	jmp    19a9 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x69>
+    1e2e:	         |  |  |  |     |              |   66 90                	xchg   %ax,%ax
+    std::memcpy(d, s, n);
+    1e30:	         |  |  |  |     \--------------|-> 44 89 c9             	mov    %r9d,%ecx
+    1e33:	         |  |  |  |                    |   41 0f b7 74 08 fe    	movzwl -0x2(%r8,%rcx,1),%esi
+    1e39:	         |  |  |  |                    |   66 89 74 08 fe       	mov    %si,-0x2(%rax,%rcx,1)
+    1e3e:	         |  |  |  \--------------------|-- e9 24 ff ff ff       	jmp    1d67 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    for (Index i = 0; i < head; ++i) {
+    1e43:	         \--|--|-----------------------|-> 49 89 c1             	mov    %rax,%r9
+    1e46:	            |  |                       |   31 f6                	xor    %esi,%esi
+    1e48:	            \--|-----------------------|-- e9 38 fe ff ff       	jmp    1c85 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x345>
+    std::memcpy(d, s, n);
+    1e4d:	               |                       \-> 8b 36                	mov    (%rsi),%esi
+    1e4f:	               |                           89 37                	mov    %esi,(%rdi)
+    1e51:	               |                           8b 4c 01 fc          	mov    -0x4(%rcx,%rax,1),%ecx
+    1e55:	               |                           89 4c 07 fc          	mov    %ecx,-0x4(%rdi,%rax,1)
+    1e59:	               \-------------------------- e9 d9 fe ff ff       	jmp    1d37 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    1e5e:	                                           66 90                	xchg   %ax,%ax
+
+0000000000001e60 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    1e60:	    48 85 ff             	test   %rdi,%rdi
+    1e63:	/-- 74 0b                	je     1e70 <nel::free_aligned(void*)+0x10>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    1e65:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    1e69:	|   e9 c2 f1 ff ff       	jmp    1030 <free@plt>
+    1e6e:	|   66 90                	xchg   %ax,%ax
+}
+    1e70:	\-> c3                   	ret
+    1e71:	    66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1e78:	    00 00 00 00 
+    1e7c:	    0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001e80 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    1e80:	                   41 56                	push   %r14
+    1e82:	                   48 8d 05 2f 12 00 00 	lea    0x122f(%rip),%rax        # 30b8 <_IO_stdin_used+0xb8>
+    1e89:	                   41 55                	push   %r13
+    1e8b:	                   66 48 0f 6e c8       	movq   %rax,%xmm1
+    1e90:	                   41 54                	push   %r12
+    1e92:	                   55                   	push   %rbp
+    1e93:	                   48 89 cd             	mov    %rcx,%rbp
+    1e96:	                   48 8d 0d 0b 12 00 00 	lea    0x120b(%rip),%rcx        # 30a8 <_IO_stdin_used+0xa8>
+    1e9d:	                   53                   	push   %rbx
+    1e9e:	                   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    1ea3:	                   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    1ea7:	                   48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    1eab:	                   c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    1eb2:	                   00 
+            : fn_name_(fn_name)
+    1eb3:	                   0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    1eb7:	                   48 85 f6             	test   %rsi,%rsi
+    1eba:	/----------------- 0f 84 a0 00 00 00    	je     1f60 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    1ec0:	|                  48 8d 46 ff          	lea    -0x1(%rsi),%rax
+    1ec4:	|                  48 89 f3             	mov    %rsi,%rbx
+    1ec7:	|                  48 85 f0             	test   %rsi,%rax
+    1eca:	+----------------- 0f 85 90 00 00 00    	jne    1f60 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1ed0:	|                  48 8d 34 2e          	lea    (%rsi,%rbp,1),%rsi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    1ed4:	|                  48 85 ff             	test   %rdi,%rdi
+    1ed7:	|     /----------- 74 67                	je     1f40 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xc0>
+    1ed9:	|     |            4c 8b 6f f8          	mov    -0x8(%rdi),%r13
+    uint8_t *const new_base =
+    1edd:	|     |            49 89 d4             	mov    %rdx,%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1ee0:	|     |            4c 29 ef             	sub    %r13,%rdi
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1ee3:	|     |            e8 d8 f1 ff ff       	call   10c0 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    1ee8:	|     |            48 85 c0             	test   %rax,%rax
+    1eeb:	|  /--|----------- 0f 84 7e 00 00 00    	je     1f6f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1ef1:	|  |  |            48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    1ef6:	|  |  |            48 f7 db             	neg    %rbx
+    1ef9:	|  |  |            48 21 cb             	and    %rcx,%rbx
+    1efc:	|  |  |            49 89 de             	mov    %rbx,%r14
+    1eff:	|  |  |            49 29 c6             	sub    %rax,%r14
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    1f02:	|  |  |            4d 39 f5             	cmp    %r14,%r13
+    1f05:	|  |  |        /-- 75 19                	jne    1f20 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xa0>
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    }
+    offset_field(new_p) = new_offset;
+    1f07:	|  |  |     /--|-> 4c 89 73 f8          	mov    %r14,-0x8(%rbx)
+    return new_p;
+}
+    1f0b:	|  |  |  /--|--|-> 48 83 c4 20          	add    $0x20,%rsp
+    1f0f:	|  |  |  |  |  |   48 89 d8             	mov    %rbx,%rax
+    1f12:	|  |  |  |  |  |   5b                   	pop    %rbx
+    1f13:	|  |  |  |  |  |   5d                   	pop    %rbp
+    1f14:	|  |  |  |  |  |   41 5c                	pop    %r12
+    1f16:	|  |  |  |  |  |   41 5d                	pop    %r13
+    1f18:	|  |  |  |  |  |   41 5e                	pop    %r14
+    1f1a:	|  |  |  |  |  |   c3                   	ret
+    1f1b:	|  |  |  |  |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        std::memmove(new_p, new_base + old_offset, n);
+    1f20:	|  |  |  |  |  \-> 4c 39 e5             	cmp    %r12,%rbp
+    1f23:	|  |  |  |  |      4c 89 e2             	mov    %r12,%rdx
+    1f26:	|  |  |  |  |      4a 8d 34 28          	lea    (%rax,%r13,1),%rsi
+    1f2a:	|  |  |  |  |      48 89 df             	mov    %rbx,%rdi
+    1f2d:	|  |  |  |  |      48 0f 46 d5          	cmovbe %rbp,%rdx
+    1f31:	|  |  |  |  |      e8 9a f1 ff ff       	call   10d0 <memmove@plt>
+    1f36:	|  |  |  |  +----- eb cf                	jmp    1f07 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+    1f38:	|  |  |  |  |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    1f3f:	|  |  |  |  |      00 
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1f40:	|  |  \--|--|----> 48 89 f7             	mov    %rsi,%rdi
+    1f43:	|  |     |  |      e8 68 f1 ff ff       	call   10b0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    1f48:	|  |     |  |      48 85 c0             	test   %rax,%rax
+    1f4b:	|  +-----|--|----- 74 22                	je     1f6f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1f4d:	|  |     |  |      48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    1f52:	|  |     |  |      48 f7 db             	neg    %rbx
+    1f55:	|  |     |  |      48 21 d3             	and    %rdx,%rbx
+    1f58:	|  |     |  |      49 89 de             	mov    %rbx,%r14
+    1f5b:	|  |     |  |      49 29 c6             	sub    %rax,%r14
+    if (old_p != nullptr && new_offset != old_offset) {
+    1f5e:	|  |     |  \----- eb a7                	jmp    1f07 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    1f60:	\--|-----|-------> 48 89 e6             	mov    %rsp,%rsi
+    1f63:	   |     |         48 8d 3d 60 11 00 00 	lea    0x1160(%rip),%rdi        # 30ca <_IO_stdin_used+0xca>
+    1f6a:	   |     |         e8 e3 f1 ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    if (new_base == nullptr) { return nullptr; }
+    1f6f:	   \-----|-------> 31 db                	xor    %ebx,%ebx
+    1f71:	         \-------- eb 98                	jmp    1f0b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x8b>
+    1f73:	                   66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1f7a:	                   00 00 00 00 
+    1f7e:	                   66 90                	xchg   %ax,%ax
+
+0000000000001f80 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    1f80:	       53                   	push   %rbx
+            : fn_name_(fn_name)
+    1f81:	       48 8d 05 30 11 00 00 	lea    0x1130(%rip),%rax        # 30b8 <_IO_stdin_used+0xb8>
+    1f88:	       48 8d 0d 19 11 00 00 	lea    0x1119(%rip),%rcx        # 30a8 <_IO_stdin_used+0xa8>
+    1f8f:	       66 48 0f 6e c1       	movq   %rcx,%xmm0
+    1f94:	       66 48 0f 6e c8       	movq   %rax,%xmm1
+    1f99:	       66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    1f9d:	       48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    1fa1:	       c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    1fa8:	       00 
+            : fn_name_(fn_name)
+    1fa9:	       0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    1fad:	       48 85 ff             	test   %rdi,%rdi
+    1fb0:	/----- 74 35                	je     1fe7 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+    1fb2:	|      48 8d 47 ff          	lea    -0x1(%rdi),%rax
+    1fb6:	|      48 89 fb             	mov    %rdi,%rbx
+    1fb9:	|      48 85 f8             	test   %rdi,%rax
+    1fbc:	+----- 75 29                	jne    1fe7 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1fbe:	|      48 8d 3c 37          	lea    (%rdi,%rsi,1),%rdi
+    1fc2:	|      e8 e9 f0 ff ff       	call   10b0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    1fc7:	|      48 85 c0             	test   %rax,%rax
+    1fca:	|  /-- 74 15                	je     1fe1 <nel::malloc_aligned(unsigned long, unsigned long)+0x61>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1fcc:	|  |   48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    1fd1:	|  |   48 f7 db             	neg    %rbx
+    1fd4:	|  |   48 21 da             	and    %rbx,%rdx
+    1fd7:	|  |   48 29 c2             	sub    %rax,%rdx
+    uint8_t *const new_p = new_base + new_offset;
+    1fda:	|  |   48 01 d0             	add    %rdx,%rax
+    offset_field(new_p) = new_offset;
+    1fdd:	|  |   48 89 50 f8          	mov    %rdx,-0x8(%rax)
+    return realloc_aligned(nullptr, align, 0, size);
+}
+    1fe1:	|  \-> 48 83 c4 20          	add    $0x20,%rsp
+    1fe5:	|      5b                   	pop    %rbx
+    1fe6:	|      c3                   	ret
+    if (!pred) { assert_fail(msg, ctx); }
+    1fe7:	\----> 48 89 e6             	mov    %rsp,%rsi
+    1fea:	       48 8d 3d d9 10 00 00 	lea    0x10d9(%rip),%rdi        # 30ca <_IO_stdin_used+0xca>
+    1ff1:	       e8 5c f1 ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    1ff6:	       66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1ffd:	       00 00 00 
+
+0000000000002000 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    2000:	53                   	push   %rbx
+    2001:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    2004:	40 0f be fe          	movsbl %sil,%edi
+    2008:	48 8b 35 71 30 00 00 	mov    0x3071(%rip),%rsi        # 5080 <stderr@GLIBC_2.2.5>
+    200f:	e8 5c f0 ff ff       	call   1070 <fputc@plt>
+    return outs;
+}
+    2014:	48 89 d8             	mov    %rbx,%rax
+    2017:	5b                   	pop    %rbx
+    2018:	c3                   	ret
+    2019:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002020 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    2020:	53                   	push   %rbx
+    2021:	48 89 fb             	mov    %rdi,%rbx
+    2024:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    2027:	48 8b 35 52 30 00 00 	mov    0x3052(%rip),%rsi        # 5080 <stderr@GLIBC_2.2.5>
+    202e:	e8 1d f0 ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    2033:	48 89 d8             	mov    %rbx,%rax
+    2036:	5b                   	pop    %rbx
+    2037:	c3                   	ret
+    2038:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    203f:	00 
+
+0000000000002040 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    2040:	53                   	push   %rbx
+    2041:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    2044:	48 8b 3d 35 30 00 00 	mov    0x3035(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    204b:	40 0f b6 d6          	movzbl %sil,%edx
+    204f:	31 c0                	xor    %eax,%eax
+    2051:	48 8d 35 8d 10 00 00 	lea    0x108d(%rip),%rsi        # 30e5 <_IO_stdin_used+0xe5>
+    2058:	e8 33 f0 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    205d:	48 89 d8             	mov    %rbx,%rax
+    2060:	5b                   	pop    %rbx
+    2061:	c3                   	ret
+    2062:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2069:	00 00 00 00 
+    206d:	0f 1f 00             	nopl   (%rax)
+
+0000000000002070 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    2070:	53                   	push   %rbx
+    2071:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    2074:	48 8b 3d 05 30 00 00 	mov    0x3005(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    207b:	0f b7 d6             	movzwl %si,%edx
+    207e:	31 c0                	xor    %eax,%eax
+    2080:	48 8d 35 5e 10 00 00 	lea    0x105e(%rip),%rsi        # 30e5 <_IO_stdin_used+0xe5>
+    2087:	e8 04 f0 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    208c:	48 89 d8             	mov    %rbx,%rax
+    208f:	5b                   	pop    %rbx
+    2090:	c3                   	ret
+    2091:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2098:	00 00 00 00 
+    209c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000020a0 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    20a0:	53                   	push   %rbx
+    20a1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    20a4:	48 8b 3d d5 2f 00 00 	mov    0x2fd5(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    20ab:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    20ad:	31 c0                	xor    %eax,%eax
+    20af:	48 8d 35 2f 10 00 00 	lea    0x102f(%rip),%rsi        # 30e5 <_IO_stdin_used+0xe5>
+    20b6:	e8 d5 ef ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    20bb:	48 89 d8             	mov    %rbx,%rax
+    20be:	5b                   	pop    %rbx
+    20bf:	c3                   	ret
+
+00000000000020c0 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    20c0:	53                   	push   %rbx
+    20c1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    20c4:	48 8b 3d b5 2f 00 00 	mov    0x2fb5(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    20cb:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    20cd:	31 c0                	xor    %eax,%eax
+    20cf:	48 8d 35 0f 10 00 00 	lea    0x100f(%rip),%rsi        # 30e5 <_IO_stdin_used+0xe5>
+    20d6:	e8 b5 ef ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    20db:	48 89 d8             	mov    %rbx,%rax
+    20de:	5b                   	pop    %rbx
+    20df:	c3                   	ret
+
+00000000000020e0 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    20e0:	53                   	push   %rbx
+    20e1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    20e4:	48 8b 3d 95 2f 00 00 	mov    0x2f95(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    20eb:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    20ee:	31 c0                	xor    %eax,%eax
+    20f0:	48 8d 35 f1 0f 00 00 	lea    0xff1(%rip),%rsi        # 30e8 <_IO_stdin_used+0xe8>
+    20f7:	e8 94 ef ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    20fc:	48 89 d8             	mov    %rbx,%rax
+    20ff:	5b                   	pop    %rbx
+    2100:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000002104 <_fini>:
+    2104:	48 83 ec 08          	sub    $0x8,%rsp
+    2108:	48 83 c4 08          	add    $0x8,%rsp
+    210c:	c3                   	ret
@@ -0,0 +1,2535 @@
+
+target/release/examples/largestruct1_heapless_array:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 3f 00 00 	mov    0x3fc5(%rip),%rax        # 4fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 3f 00 00    	push   0x3fca(%rip)        # 4ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 3f 00 00    	jmp    *0x3fcc(%rip)        # 4ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 3f 00 00    	jmp    *0x3fca(%rip)        # 5000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 3f 00 00    	jmp    *0x3fc2(%rip)        # 5008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 3f 00 00    	jmp    *0x3fba(%rip)        # 5010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memset@plt>:
+    1060:	ff 25 b2 3f 00 00    	jmp    *0x3fb2(%rip)        # 5018 <memset@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 3f 00 00    	jmp    *0x3faa(%rip)        # 5020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 3f 00 00    	jmp    *0x3fa2(%rip)        # 5028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 3f 00 00    	jmp    *0x3f9a(%rip)        # 5030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcpy@plt>:
+    10a0:	ff 25 92 3f 00 00    	jmp    *0x3f92(%rip)        # 5038 <memcpy@GLIBC_2.14>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <malloc@plt>:
+    10b0:	ff 25 8a 3f 00 00    	jmp    *0x3f8a(%rip)        # 5040 <malloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <realloc@plt>:
+    10c0:	ff 25 82 3f 00 00    	jmp    *0x3f82(%rip)        # 5048 <realloc@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <memmove@plt>:
+    10d0:	ff 25 7a 3f 00 00    	jmp    *0x3f7a(%rip)        # 5050 <memmove@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010e0 <__cxa_finalize@plt>:
+    10e0:	ff 25 fa 3e 00 00    	jmp    *0x3efa(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10e6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010f0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10f0:	50                   	push   %rax
+    std::abort();
+    10f1:	e8 4a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010f6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10f6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10f7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10fa:	4c 8d 0d c4 1f 00 00 	lea    0x1fc4(%rip),%r9        # 30c5 <_IO_stdin_used+0xc5>
+    1101:	31 c0                	xor    %eax,%eax
+    1103:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    1107:	4c 8b 07             	mov    (%rdi),%r8
+    110a:	48 8d 35 ba 1f 00 00 	lea    0x1fba(%rip),%rsi        # 30cb <_IO_stdin_used+0xcb>
+    1111:	48 8b 3d 68 3f 00 00 	mov    0x3f68(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1118:	e8 73 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    111d:	e8 1e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001122 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1122:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1126:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1129:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    112d:	31 c0                	xor    %eax,%eax
+    112f:	57                   	push   %rdi
+    1130:	48 8b 3d 49 3f 00 00 	mov    0x3f49(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1137:	4c 8d 0d 87 1f 00 00 	lea    0x1f87(%rip),%r9        # 30c5 <_IO_stdin_used+0xc5>
+    113e:	4c 8b 06             	mov    (%rsi),%r8
+    1141:	48 8d 35 94 1f 00 00 	lea    0x1f94(%rip),%rsi        # 30dc <_IO_stdin_used+0xdc>
+    1148:	e8 43 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    114d:	e8 ee fe ff ff       	call   1040 <abort@plt>
+
+0000000000001152 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1152:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1156:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1159:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    115d:	31 c0                	xor    %eax,%eax
+    115f:	57                   	push   %rdi
+    1160:	48 8b 3d 19 3f 00 00 	mov    0x3f19(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1167:	4c 8d 0d 83 1f 00 00 	lea    0x1f83(%rip),%r9        # 30f1 <_IO_stdin_used+0xf1>
+    116e:	4c 8b 06             	mov    (%rsi),%r8
+    1171:	48 8d 35 64 1f 00 00 	lea    0x1f64(%rip),%rsi        # 30dc <_IO_stdin_used+0xdc>
+    1178:	e8 13 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    117d:	e8 be fe ff ff       	call   1040 <abort@plt>
+    1182:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1189:	00 00 00 
+    118c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001190 <main>:
+#    endif
+}
+#endif
+
+int main()
+{
+    1190:	53                   	push   %rbx
+    nel::log << "ex1:b" << '\n';
+    1191:	48 8d 1d f1 3e 00 00 	lea    0x3ef1(%rip),%rbx        # 5089 <nel::log>
+    1198:	48 8d 35 76 1e 00 00 	lea    0x1e76(%rip),%rsi        # 3015 <_IO_stdin_used+0x15>
+    119f:	48 89 df             	mov    %rbx,%rdi
+    11a2:	e8 79 18 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    11a7:	be 0a 00 00 00       	mov    $0xa,%esi
+    11ac:	48 89 c7             	mov    %rax,%rdi
+    11af:	e8 4c 18 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    11b4:	e8 47 03 00 00       	call   1500 <ex1()>
+    nel::log << "ex1:e" << '\n';
+    11b9:	48 89 df             	mov    %rbx,%rdi
+    11bc:	48 8d 35 58 1e 00 00 	lea    0x1e58(%rip),%rsi        # 301b <_IO_stdin_used+0x1b>
+    11c3:	e8 58 18 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    11c8:	be 0a 00 00 00       	mov    $0xa,%esi
+    11cd:	48 89 c7             	mov    %rax,%rdi
+    11d0:	e8 2b 18 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    // nel::log << "ex2:b" << '\n';
+    // ex2();
+    // nel::log << "ex2:e" << '\n';
+    nel::log << "ex3:b" << '\n';
+    11d5:	48 89 df             	mov    %rbx,%rdi
+    11d8:	48 8d 35 42 1e 00 00 	lea    0x1e42(%rip),%rsi        # 3021 <_IO_stdin_used+0x21>
+    11df:	e8 3c 18 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    11e4:	be 0a 00 00 00       	mov    $0xa,%esi
+    11e9:	48 89 c7             	mov    %rax,%rdi
+    11ec:	e8 0f 18 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    ex3();
+    11f1:	e8 5a 05 00 00       	call   1750 <ex3()>
+    nel::log << "ex3:e" << '\n';
+    11f6:	48 89 df             	mov    %rbx,%rdi
+    11f9:	48 8d 35 27 1e 00 00 	lea    0x1e27(%rip),%rsi        # 3027 <_IO_stdin_used+0x27>
+    1200:	e8 1b 18 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    1205:	be 0a 00 00 00       	mov    $0xa,%esi
+    120a:	48 89 c7             	mov    %rax,%rdi
+    120d:	e8 ee 17 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+#if defined(RUST_LIKE)
+    nel::log << "ex41:b" << '\n';
+    ex41();
+    nel::log << "ex41:e" << '\n';
+#endif
+    nel::log << "ex42:b" << '\n';
+    1212:	48 89 df             	mov    %rbx,%rdi
+    1215:	48 8d 35 11 1e 00 00 	lea    0x1e11(%rip),%rsi        # 302d <_IO_stdin_used+0x2d>
+    121c:	e8 ff 17 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    1221:	be 0a 00 00 00       	mov    $0xa,%esi
+    1226:	48 89 c7             	mov    %rax,%rdi
+    1229:	e8 d2 17 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    ex42();
+    122e:	e8 6d 06 00 00       	call   18a0 <ex42()>
+    nel::log << "ex42:e" << '\n';
+    1233:	48 89 df             	mov    %rbx,%rdi
+    1236:	48 8d 35 f7 1d 00 00 	lea    0x1df7(%rip),%rsi        # 3034 <_IO_stdin_used+0x34>
+    123d:	e8 de 17 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    1242:	be 0a 00 00 00       	mov    $0xa,%esi
+    1247:	48 89 c7             	mov    %rax,%rdi
+    124a:	e8 b1 17 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+#if defined(C_LIKE)
+    nel::log << "ex51:b" << '\n';
+    124f:	48 89 df             	mov    %rbx,%rdi
+    1252:	48 8d 35 e2 1d 00 00 	lea    0x1de2(%rip),%rsi        # 303b <_IO_stdin_used+0x3b>
+    1259:	e8 c2 17 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    125e:	be 0a 00 00 00       	mov    $0xa,%esi
+    1263:	48 89 c7             	mov    %rax,%rdi
+    1266:	e8 95 17 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    ex51();
+    126b:	e8 90 07 00 00       	call   1a00 <ex51()>
+    nel::log << "ex51:e" << '\n';
+    1270:	48 89 df             	mov    %rbx,%rdi
+    1273:	48 8d 35 c8 1d 00 00 	lea    0x1dc8(%rip),%rsi        # 3042 <_IO_stdin_used+0x42>
+    127a:	e8 a1 17 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    127f:	be 0a 00 00 00       	mov    $0xa,%esi
+    1284:	48 89 c7             	mov    %rax,%rdi
+    1287:	e8 74 17 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex52:b" << '\n';
+    128c:	48 89 df             	mov    %rbx,%rdi
+    128f:	48 8d 35 b3 1d 00 00 	lea    0x1db3(%rip),%rsi        # 3049 <_IO_stdin_used+0x49>
+    1296:	e8 85 17 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    129b:	be 0a 00 00 00       	mov    $0xa,%esi
+    12a0:	48 89 c7             	mov    %rax,%rdi
+    12a3:	e8 58 17 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    ex52();
+    12a8:	e8 b3 08 00 00       	call   1b60 <ex52()>
+    nel::log << "ex52:e" << '\n';
+    12ad:	48 89 df             	mov    %rbx,%rdi
+    12b0:	48 8d 35 99 1d 00 00 	lea    0x1d99(%rip),%rsi        # 3050 <_IO_stdin_used+0x50>
+    12b7:	e8 64 17 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    12bc:	be 0a 00 00 00       	mov    $0xa,%esi
+    12c1:	48 89 c7             	mov    %rax,%rdi
+    12c4:	e8 37 17 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+#if defined(RUST_LIKE)
+    nel::log << "ex61:b" << '\n';
+    ex61();
+    nel::log << "ex61:e" << '\n';
+#endif
+    nel::log << "ex62:b" << '\n';
+    12c9:	48 89 df             	mov    %rbx,%rdi
+    12cc:	48 8d 35 84 1d 00 00 	lea    0x1d84(%rip),%rsi        # 3057 <_IO_stdin_used+0x57>
+    12d3:	e8 48 17 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    12d8:	be 0a 00 00 00       	mov    $0xa,%esi
+    12dd:	48 89 c7             	mov    %rax,%rdi
+    12e0:	e8 1b 17 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    ex62();
+    12e5:	e8 d6 09 00 00       	call   1cc0 <ex62()>
+    nel::log << "ex62:e" << '\n';
+    12ea:	48 89 df             	mov    %rbx,%rdi
+    12ed:	48 8d 35 6a 1d 00 00 	lea    0x1d6a(%rip),%rsi        # 305e <_IO_stdin_used+0x5e>
+    12f4:	e8 27 17 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    12f9:	be 0a 00 00 00       	mov    $0xa,%esi
+    12fe:	48 89 c7             	mov    %rax,%rdi
+    1301:	e8 fa 16 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+
+#if defined(C_LIKE)
+    nel::log << "ex71:b" << '\n';
+    1306:	48 89 df             	mov    %rbx,%rdi
+    1309:	48 8d 35 55 1d 00 00 	lea    0x1d55(%rip),%rsi        # 3065 <_IO_stdin_used+0x65>
+    1310:	e8 0b 17 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    1315:	be 0a 00 00 00       	mov    $0xa,%esi
+    131a:	48 89 c7             	mov    %rax,%rdi
+    131d:	e8 de 16 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    ex71();
+    1322:	e8 29 0b 00 00       	call   1e50 <ex71()>
+    nel::log << "ex71:e" << '\n';
+    1327:	48 89 df             	mov    %rbx,%rdi
+    132a:	48 8d 35 3b 1d 00 00 	lea    0x1d3b(%rip),%rsi        # 306c <_IO_stdin_used+0x6c>
+    1331:	e8 ea 16 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    1336:	be 0a 00 00 00       	mov    $0xa,%esi
+    133b:	48 89 c7             	mov    %rax,%rdi
+    133e:	e8 bd 16 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+
+    nel::log << "ex72:b" << '\n';
+    1343:	48 89 df             	mov    %rbx,%rdi
+    1346:	48 8d 35 26 1d 00 00 	lea    0x1d26(%rip),%rsi        # 3073 <_IO_stdin_used+0x73>
+    134d:	e8 ce 16 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    1352:	be 0a 00 00 00       	mov    $0xa,%esi
+    1357:	48 89 c7             	mov    %rax,%rdi
+    135a:	e8 a1 16 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    ex72();
+    135f:	e8 8c 0c 00 00       	call   1ff0 <ex72()>
+    nel::log << "ex72:e" << '\n';
+    1364:	48 89 df             	mov    %rbx,%rdi
+    1367:	48 8d 35 0c 1d 00 00 	lea    0x1d0c(%rip),%rsi        # 307a <_IO_stdin_used+0x7a>
+    136e:	e8 ad 16 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    1373:	be 0a 00 00 00       	mov    $0xa,%esi
+    1378:	48 89 c7             	mov    %rax,%rdi
+    137b:	e8 80 16 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+#endif
+}
+    1380:	31 c0                	xor    %eax,%eax
+    1382:	5b                   	pop    %rbx
+    1383:	c3                   	ret
+    1384:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    138b:	00 00 00 
+    138e:	66 90                	xchg   %ax,%ax
+
+0000000000001390 <_start>:
+    1390:	31 ed                	xor    %ebp,%ebp
+    1392:	49 89 d1             	mov    %rdx,%r9
+    1395:	5e                   	pop    %rsi
+    1396:	48 89 e2             	mov    %rsp,%rdx
+    1399:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    139d:	50                   	push   %rax
+    139e:	54                   	push   %rsp
+    139f:	45 31 c0             	xor    %r8d,%r8d
+    13a2:	31 c9                	xor    %ecx,%ecx
+    13a4:	48 8d 3d e5 fd ff ff 	lea    -0x21b(%rip),%rdi        # 1190 <main>
+    13ab:	ff 15 0f 3c 00 00    	call   *0x3c0f(%rip)        # 4fc0 <__libc_start_main@GLIBC_2.34>
+    13b1:	f4                   	hlt
+    13b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    13b9:	00 00 00 
+    13bc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000013c0 <deregister_tm_clones>:
+    13c0:	    48 8d 3d a1 3c 00 00 	lea    0x3ca1(%rip),%rdi        # 5068 <__TMC_END__>
+    13c7:	    48 8d 05 9a 3c 00 00 	lea    0x3c9a(%rip),%rax        # 5068 <__TMC_END__>
+    13ce:	    48 39 f8             	cmp    %rdi,%rax
+    13d1:	/-- 74 15                	je     13e8 <deregister_tm_clones+0x28>
+    13d3:	|   48 8b 05 ee 3b 00 00 	mov    0x3bee(%rip),%rax        # 4fc8 <_ITM_deregisterTMCloneTable@Base>
+    13da:	|   48 85 c0             	test   %rax,%rax
+    13dd:	+-- 74 09                	je     13e8 <deregister_tm_clones+0x28>
+    13df:	|   ff e0                	jmp    *%rax
+    13e1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    13e8:	\-> c3                   	ret
+    13e9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000013f0 <register_tm_clones>:
+    13f0:	    48 8d 3d 71 3c 00 00 	lea    0x3c71(%rip),%rdi        # 5068 <__TMC_END__>
+    13f7:	    48 8d 35 6a 3c 00 00 	lea    0x3c6a(%rip),%rsi        # 5068 <__TMC_END__>
+    13fe:	    48 29 fe             	sub    %rdi,%rsi
+    1401:	    48 89 f0             	mov    %rsi,%rax
+    1404:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1408:	    48 c1 f8 03          	sar    $0x3,%rax
+    140c:	    48 01 c6             	add    %rax,%rsi
+    140f:	    48 d1 fe             	sar    %rsi
+    1412:	/-- 74 14                	je     1428 <register_tm_clones+0x38>
+    1414:	|   48 8b 05 bd 3b 00 00 	mov    0x3bbd(%rip),%rax        # 4fd8 <_ITM_registerTMCloneTable@Base>
+    141b:	|   48 85 c0             	test   %rax,%rax
+    141e:	+-- 74 08                	je     1428 <register_tm_clones+0x38>
+    1420:	|   ff e0                	jmp    *%rax
+    1422:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1428:	\-> c3                   	ret
+    1429:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001430 <__do_global_dtors_aux>:
+    1430:	       f3 0f 1e fa          	endbr64
+    1434:	       80 3d 4d 3c 00 00 00 	cmpb   $0x0,0x3c4d(%rip)        # 5088 <completed.0>
+    143b:	/----- 75 2b                	jne    1468 <__do_global_dtors_aux+0x38>
+    143d:	|      55                   	push   %rbp
+    143e:	|      48 83 3d 9a 3b 00 00 	cmpq   $0x0,0x3b9a(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1445:	|      00 
+    1446:	|      48 89 e5             	mov    %rsp,%rbp
+    1449:	|  /-- 74 0c                	je     1457 <__do_global_dtors_aux+0x27>
+    144b:	|  |   48 8b 3d 0e 3c 00 00 	mov    0x3c0e(%rip),%rdi        # 5060 <__dso_handle>
+    1452:	|  |   e8 89 fc ff ff       	call   10e0 <__cxa_finalize@plt>
+    1457:	|  \-> e8 64 ff ff ff       	call   13c0 <deregister_tm_clones>
+    145c:	|      c6 05 25 3c 00 00 01 	movb   $0x1,0x3c25(%rip)        # 5088 <completed.0>
+    1463:	|      5d                   	pop    %rbp
+    1464:	|      c3                   	ret
+    1465:	|      0f 1f 00             	nopl   (%rax)
+    1468:	\----> c3                   	ret
+    1469:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001470 <frame_dummy>:
+    1470:	f3 0f 1e fa          	endbr64
+    1474:	e9 77 ff ff ff       	jmp    13f0 <register_tm_clones>
+    1479:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001480 <_close_r>:
+#include <nel/log.hh>
+    1480:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1485:	c3                   	ret
+    1486:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    148d:	00 00 00 
+
+0000000000001490 <_fstat_r>:
+
+    1490:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1495:	c3                   	ret
+    1496:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    149d:	00 00 00 
+
+00000000000014a0 <_kill_r>:
+void ex1()
+    14a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    14a5:	c3                   	ret
+    14a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    14ad:	00 00 00 
+
+00000000000014b0 <_lseek_r>:
+    Array1 arr1 = Array1::filled_with(U8Buf<256>(0xff));
+    14b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    14b5:	c3                   	ret
+    14b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    14bd:	00 00 00 
+
+00000000000014c0 <_read_r>:
+
+    14c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    14c5:	c3                   	ret
+    14c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    14cd:	00 00 00 
+
+00000000000014d0 <_write_r>:
+void ex2()
+    14d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    14d5:	c3                   	ret
+    14d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    14dd:	00 00 00 
+
+00000000000014e0 <_getpid_r>:
+        U8Buf<256>(0x26),
+    14e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    14e5:	c3                   	ret
+    14e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    14ed:	00 00 00 
+
+00000000000014f0 <_isatty_r>:
+        U8Buf<256>(0x27),
+    14f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    14f5:	c3                   	ret
+    14f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    14fd:	00 00 00 
+
+0000000000001500 <ex1()>:
+{
+    1500:	       41 57                	push   %r15
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+        {
+            nel::elem::set(data_, f, N);
+    1502:	       ba 00 01 00 00       	mov    $0x100,%edx
+    1507:	       be ff 00 00 00       	mov    $0xff,%esi
+    150c:	       41 56                	push   %r14
+    150e:	       41 55                	push   %r13
+    1510:	       41 54                	push   %r12
+    1512:	       55                   	push   %rbp
+    1513:	       53                   	push   %rbx
+    1514:	       48 81 ec 18 09 00 00 	sub    $0x918,%rsp
+    151b:	       48 8d 6c 24 10       	lea    0x10(%rsp),%rbp
+    1520:	       4c 8d b4 24 10 01 00 	lea    0x110(%rsp),%r14
+    1527:	       00 
+    1528:	       48 89 ef             	mov    %rbp,%rdi
+    152b:	       4c 8d a4 24 10 09 00 	lea    0x910(%rsp),%r12
+    1532:	       00 
+    1533:	       4c 89 f3             	mov    %r14,%rbx
+    1536:	       e8 55 0c 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        template<typename F>
+        void for_each2(F &&fn)
+#        endif
+        {
+#        if 1
+            for (; !self().is_done(); self().inc()) {
+    153b:	       0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+            nel::elem::copy(data_, o.data_, N);
+    1540:	   /-> 48 89 df             	mov    %rbx,%rdi
+    1543:	   |   ba 00 01 00 00       	mov    $0x100,%edx
+    1548:	   |   48 89 ee             	mov    %rbp,%rsi
+    154b:	   |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    1552:	   |   e8 29 0c 00 00       	call   2180 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    1557:	   |   4c 39 e3             	cmp    %r12,%rbx
+    155a:	   \-- 75 e4                	jne    1540 <ex1()+0x40>
+            nel::elem::set(data_, 0xa5, N);
+    155c:	       ba 00 01 00 00       	mov    $0x100,%edx
+        // TODO: replace <<(Log ) with dbgfmt, so separate out from
+        // any other form of conversion to charstring.
+        // TODO: insert into formatter and not final dest type.
+        friend Log &operator<<(Log &outs, Array const &v)
+        {
+            outs << "Array<" << v.len() << ">{";
+    1561:	       4c 8d 2d 21 3b 00 00 	lea    0x3b21(%rip),%r13        # 5089 <nel::log>
+    1568:	       48 89 ef             	mov    %rbp,%rdi
+    156b:	       be a5 00 00 00       	mov    $0xa5,%esi
+    1570:	       e8 1b 0c 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1575:	       48 8d 35 88 1a 00 00 	lea    0x1a88(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+    157c:	       4c 89 ef             	mov    %r13,%rdi
+    157f:	       4c 8d 3d 85 1a 00 00 	lea    0x1a85(%rip),%r15        # 300b <_IO_stdin_used+0xb>
+    1586:	       e8 95 14 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    158b:	       be 08 00 00 00       	mov    $0x8,%esi
+    1590:	       48 8d 9c 24 11 01 00 	lea    0x111(%rsp),%rbx
+    1597:	       00 
+    1598:	       49 8d ae 00 01 00 00 	lea    0x100(%r14),%rbp
+    159f:	       48 89 c7             	mov    %rax,%rdi
+    15a2:	       e8 39 15 00 00       	call   2ae0 <nel::operator<<(nel::Log&, unsigned long)>
+    15a7:	       4c 89 fe             	mov    %r15,%rsi
+    15aa:	       48 89 c7             	mov    %rax,%rdi
+    15ad:	       e8 6e 14 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+#    endif
+
+    public:
+        friend Log &operator<<(Log &outs, ItT const &it)
+        {
+            outs << '[';
+    15b2:	       be 5b 00 00 00       	mov    $0x5b,%esi
+    15b7:	       4c 89 ef             	mov    %r13,%rdi
+    15ba:	       e8 41 14 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+            nel::elem::set(data_, f, N);
+        }
+
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+        {
+            outs << "U8Buf<" << val.len() << ">{";
+    15bf:	       48 8d 35 48 1a 00 00 	lea    0x1a48(%rip),%rsi        # 300e <_IO_stdin_used+0xe>
+    15c6:	       4c 89 ef             	mov    %r13,%rdi
+    15c9:	       e8 52 14 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    15ce:	       be 00 01 00 00       	mov    $0x100,%esi
+    15d3:	       48 89 c7             	mov    %rax,%rdi
+    15d6:	       e8 05 15 00 00       	call   2ae0 <nel::operator<<(nel::Log&, unsigned long)>
+    15db:	       4c 89 fe             	mov    %r15,%rsi
+    15de:	       48 89 c7             	mov    %rax,%rdi
+    15e1:	       e8 3a 14 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+            if (val.len() > 0) {
+                outs << val.data_[0];
+    15e6:	       0f b6 b4 24 10 01 00 	movzbl 0x110(%rsp),%esi
+    15ed:	       00 
+    15ee:	       4c 89 ef             	mov    %r13,%rdi
+    15f1:	       e8 4a 14 00 00       	call   2a40 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    15f6:	       66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    15fd:	       00 00 00 
+                    outs << ' ' << val.data_[i];
+    1600:	   /-> be 20 00 00 00       	mov    $0x20,%esi
+    1605:	   |   4c 89 ef             	mov    %r13,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1608:	   |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    160c:	   |   e8 ef 13 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    1611:	   |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1615:	   |   48 89 c7             	mov    %rax,%rdi
+    1618:	   |   e8 23 14 00 00       	call   2a40 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    161d:	   |   48 39 eb             	cmp    %rbp,%rbx
+    1620:	   \-- 75 de                	jne    1600 <ex1()+0x100>
+                }
+            }
+            outs << '}';
+    1622:	       be 7d 00 00 00       	mov    $0x7d,%esi
+    1627:	       4c 89 ef             	mov    %r13,%rdi
+    162a:	       4c 8d a4 24 10 03 00 	lea    0x310(%rsp),%r12
+    1631:	       00 
+    1632:	       e8 c9 13 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+            for (; !self().is_done(); self().inc()) {
+    1637:	       49 8d 86 00 09 00 00 	lea    0x900(%r14),%rax
+    163e:	       48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1643:	       0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+                //     ++i;
+                // });
+#        if defined(RUST_LIKE)
+                it2.for_each2([&outs](OutT const &e) { outs << ',' << e; });
+#        elif defined(C_LIKE)
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    1648:	/----> be 2c 00 00 00       	mov    $0x2c,%esi
+    164d:	|      4c 89 ef             	mov    %r13,%rdi
+    1650:	|      49 8d 9c 24 01 ff ff 	lea    -0xff(%r12),%rbx
+    1657:	|      ff 
+    1658:	|      e8 a3 13 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+            outs << "U8Buf<" << val.len() << ">{";
+    165d:	|      48 8d 35 aa 19 00 00 	lea    0x19aa(%rip),%rsi        # 300e <_IO_stdin_used+0xe>
+    1664:	|      48 89 c7             	mov    %rax,%rdi
+    1667:	|      48 89 c5             	mov    %rax,%rbp
+    166a:	|      e8 b1 13 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    166f:	|      be 00 01 00 00       	mov    $0x100,%esi
+    1674:	|      48 89 c7             	mov    %rax,%rdi
+    1677:	|      e8 64 14 00 00       	call   2ae0 <nel::operator<<(nel::Log&, unsigned long)>
+    167c:	|      4c 89 fe             	mov    %r15,%rsi
+    167f:	|      48 89 c7             	mov    %rax,%rdi
+    1682:	|      e8 99 13 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    1687:	|      48 89 ef             	mov    %rbp,%rdi
+    168a:	|      41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    1691:	|      ff ff 
+    1693:	|      e8 a8 13 00 00       	call   2a40 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1698:	|      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    169f:	|      00 
+                    outs << ' ' << val.data_[i];
+    16a0:	|  /-> be 20 00 00 00       	mov    $0x20,%esi
+    16a5:	|  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    16a8:	|  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    16ac:	|  |   e8 4f 13 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    16b1:	|  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    16b5:	|  |   48 89 c7             	mov    %rax,%rdi
+    16b8:	|  |   e8 83 13 00 00       	call   2a40 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    16bd:	|  |   4c 39 e3             	cmp    %r12,%rbx
+    16c0:	|  \-- 75 de                	jne    16a0 <ex1()+0x1a0>
+            outs << '}';
+    16c2:	|      be 7d 00 00 00       	mov    $0x7d,%esi
+    16c7:	|      48 89 ef             	mov    %rbp,%rdi
+            for (; !self().is_done(); self().inc()) {
+    16ca:	|      4c 8d a3 00 01 00 00 	lea    0x100(%rbx),%r12
+    16d1:	|      e8 2a 13 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    16d6:	|      48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    16db:	|      49 39 c4             	cmp    %rax,%r12
+    16de:	\----- 0f 85 64 ff ff ff    	jne    1648 <ex1()+0x148>
+#        endif
+            }
+#    endif
+            outs << ']';
+    16e4:	       be 5d 00 00 00       	mov    $0x5d,%esi
+    16e9:	       4c 89 ef             	mov    %r13,%rdi
+    16ec:	       48 8d 9c 24 10 08 00 	lea    0x810(%rsp),%rbx
+    16f3:	       00 
+    16f4:	       e8 07 13 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+            outs << v.iter();
+            outs << '}';
+    16f9:	       be 7d 00 00 00       	mov    $0x7d,%esi
+    16fe:	       4c 89 ef             	mov    %r13,%rdi
+    1701:	       e8 fa 12 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    nel::log << arr1 << '\n';
+    1706:	       be 0a 00 00 00       	mov    $0xa,%esi
+    170b:	       4c 89 ef             	mov    %r13,%rdi
+    170e:	       e8 ed 12 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+        ~Array() = default;
+    1713:	       0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+            nel::elem::set(data_, 0xa5, N);
+    1718:	   /-> 48 89 df             	mov    %rbx,%rdi
+    171b:	   |   ba 00 01 00 00       	mov    $0x100,%edx
+    1720:	   |   be a5 00 00 00       	mov    $0xa5,%esi
+    1725:	   |   e8 66 0a 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    172a:	   |   48 89 d8             	mov    %rbx,%rax
+    172d:	   |   48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    1734:	   |   4c 39 f0             	cmp    %r14,%rax
+    1737:	   \-- 75 df                	jne    1718 <ex1()+0x218>
+}
+    1739:	       48 81 c4 18 09 00 00 	add    $0x918,%rsp
+    1740:	       5b                   	pop    %rbx
+    1741:	       5d                   	pop    %rbp
+    1742:	       41 5c                	pop    %r12
+    1744:	       41 5d                	pop    %r13
+    1746:	       41 5e                	pop    %r14
+    1748:	       41 5f                	pop    %r15
+    174a:	       c3                   	ret
+    174b:	       0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000001750 <ex3()>:
+{
+    1750:	    41 55                	push   %r13
+            nel::elem::set(data_, f, N);
+    1752:	    ba 00 01 00 00       	mov    $0x100,%edx
+    1757:	    be ff 00 00 00       	mov    $0xff,%esi
+    175c:	    41 54                	push   %r12
+    175e:	    55                   	push   %rbp
+    175f:	    53                   	push   %rbx
+    1760:	    48 81 ec 08 09 00 00 	sub    $0x908,%rsp
+    1767:	    48 89 e5             	mov    %rsp,%rbp
+    176a:	    4c 8d a4 24 00 01 00 	lea    0x100(%rsp),%r12
+    1771:	    00 
+    1772:	    4c 8d ac 24 00 09 00 	lea    0x900(%rsp),%r13
+    1779:	    00 
+    177a:	    48 89 ef             	mov    %rbp,%rdi
+    177d:	    4c 89 e3             	mov    %r12,%rbx
+    1780:	    e8 0b 0a 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            for (; !self().is_done(); self().inc()) {
+    1785:	    0f 1f 00             	nopl   (%rax)
+            nel::elem::copy(data_, o.data_, N);
+    1788:	/-> 48 89 df             	mov    %rbx,%rdi
+    178b:	|   ba 00 01 00 00       	mov    $0x100,%edx
+    1790:	|   48 89 ee             	mov    %rbp,%rsi
+    1793:	|   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    179a:	|   e8 e1 09 00 00       	call   2180 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    179f:	|   49 39 dd             	cmp    %rbx,%r13
+    17a2:	\-- 75 e4                	jne    1788 <ex3()+0x38>
+            nel::elem::set(data_, 0xa5, N);
+    17a4:	    ba 00 01 00 00       	mov    $0x100,%edx
+    17a9:	    be a5 00 00 00       	mov    $0xa5,%esi
+    17ae:	    48 89 ef             	mov    %rbp,%rdi
+    17b1:	    e8 da 09 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            nel::elem::set(data_, f, N);
+    17b6:	    ba 00 01 00 00       	mov    $0x100,%edx
+    17bb:	    48 89 ef             	mov    %rbp,%rdi
+    17be:	    be 11 00 00 00       	mov    $0x11,%esi
+    17c3:	    e8 c8 09 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            nel::elem::move(data_, o.data_, N);
+    17c8:	    ba 00 01 00 00       	mov    $0x100,%edx
+    17cd:	    48 89 ee             	mov    %rbp,%rsi
+    17d0:	    4c 89 e7             	mov    %r12,%rdi
+    17d3:	    e8 c8 09 00 00       	call   21a0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    17d8:	    ba 00 01 00 00       	mov    $0x100,%edx
+    17dd:	    48 89 ef             	mov    %rbp,%rdi
+    17e0:	    be a5 00 00 00       	mov    $0xa5,%esi
+    17e5:	    e8 a6 09 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            nel::elem::set(data_, f, N);
+    17ea:	    ba 00 01 00 00       	mov    $0x100,%edx
+    17ef:	    48 89 ef             	mov    %rbp,%rdi
+    17f2:	    be 22 00 00 00       	mov    $0x22,%esi
+    17f7:	    e8 94 09 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            nel::elem::move(data_, o.data_, N);
+    17fc:	    48 8d bc 24 00 06 00 	lea    0x600(%rsp),%rdi
+    1803:	    00 
+    1804:	    48 89 ee             	mov    %rbp,%rsi
+    1807:	    ba 00 01 00 00       	mov    $0x100,%edx
+    180c:	    e8 8f 09 00 00       	call   21a0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1811:	    ba 00 01 00 00       	mov    $0x100,%edx
+    1816:	    48 89 ef             	mov    %rbp,%rdi
+    1819:	    be a5 00 00 00       	mov    $0xa5,%esi
+    181e:	    e8 6d 09 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            nel::elem::set(data_, f, N);
+    1823:	    ba 00 01 00 00       	mov    $0x100,%edx
+    1828:	    48 89 ef             	mov    %rbp,%rdi
+    182b:	    be 33 00 00 00       	mov    $0x33,%esi
+    1830:	    e8 5b 09 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            nel::elem::move(data_, o.data_, N);
+    1835:	    48 8d bc 24 00 07 00 	lea    0x700(%rsp),%rdi
+    183c:	    00 
+    183d:	    48 89 ee             	mov    %rbp,%rsi
+    1840:	    ba 00 01 00 00       	mov    $0x100,%edx
+    1845:	    e8 56 09 00 00       	call   21a0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    184a:	    ba 00 01 00 00       	mov    $0x100,%edx
+    184f:	    48 89 ef             	mov    %rbp,%rdi
+    1852:	    be a5 00 00 00       	mov    $0xa5,%esi
+    1857:	    e8 34 09 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    185c:	    48 8d 9c 24 00 09 00 	lea    0x900(%rsp),%rbx
+    1863:	    00 
+    1864:	    0f 1f 40 00          	nopl   0x0(%rax)
+    1868:	/-> 48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    186f:	|   ba 00 01 00 00       	mov    $0x100,%edx
+    1874:	|   be a5 00 00 00       	mov    $0xa5,%esi
+    1879:	|   48 89 df             	mov    %rbx,%rdi
+    187c:	|   e8 0f 09 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1881:	|   4c 39 e3             	cmp    %r12,%rbx
+    1884:	\-- 75 e2                	jne    1868 <ex3()+0x118>
+}
+    1886:	    48 81 c4 08 09 00 00 	add    $0x908,%rsp
+    188d:	    5b                   	pop    %rbx
+    188e:	    5d                   	pop    %rbp
+    188f:	    41 5c                	pop    %r12
+    1891:	    41 5d                	pop    %r13
+    1893:	    c3                   	ret
+    1894:	    66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    189b:	    00 00 00 00 
+    189f:	    90                   	nop
+
+00000000000018a0 <ex42()>:
+{
+    18a0:	       41 57                	push   %r15
+            nel::elem::set(data_, f, N);
+    18a2:	       ba 00 01 00 00       	mov    $0x100,%edx
+    18a7:	       be ff 00 00 00       	mov    $0xff,%esi
+    18ac:	       41 56                	push   %r14
+    18ae:	       41 55                	push   %r13
+    18b0:	       41 54                	push   %r12
+    18b2:	       55                   	push   %rbp
+    18b3:	       53                   	push   %rbx
+    18b4:	       48 81 ec 08 09 00 00 	sub    $0x908,%rsp
+    18bb:	       48 89 e5             	mov    %rsp,%rbp
+    18be:	       4c 8d ac 24 00 01 00 	lea    0x100(%rsp),%r13
+    18c5:	       00 
+    18c6:	       4c 8d a4 24 00 09 00 	lea    0x900(%rsp),%r12
+    18cd:	       00 
+    18ce:	       48 89 ef             	mov    %rbp,%rdi
+    18d1:	       4c 89 eb             	mov    %r13,%rbx
+    18d4:	       e8 b7 08 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    18d9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            nel::elem::copy(data_, o.data_, N);
+    18e0:	   /-> 48 89 df             	mov    %rbx,%rdi
+    18e3:	   |   ba 00 01 00 00       	mov    $0x100,%edx
+    18e8:	   |   48 89 ee             	mov    %rbp,%rsi
+    18eb:	   |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    18f2:	   |   e8 89 08 00 00       	call   2180 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    18f7:	   |   4c 39 e3             	cmp    %r12,%rbx
+    18fa:	   \-- 75 e4                	jne    18e0 <ex42()+0x40>
+            nel::elem::set(data_, 0xa5, N);
+    18fc:	       48 89 ef             	mov    %rbp,%rdi
+    18ff:	       ba 00 01 00 00       	mov    $0x100,%edx
+    1904:	       be a5 00 00 00       	mov    $0xa5,%esi
+    1909:	       e8 82 08 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    190e:	       4c 8d a4 24 00 02 00 	lea    0x200(%rsp),%r12
+    1915:	       00 
+    1916:	       4d 8d bd 00 09 00 00 	lea    0x900(%r13),%r15
+    191d:	       4c 8d 35 ea 16 00 00 	lea    0x16ea(%rip),%r14        # 300e <_IO_stdin_used+0xe>
+    1924:	       48 8d 2d 5e 37 00 00 	lea    0x375e(%rip),%rbp        # 5089 <nel::log>
+    192b:	       0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+            outs << "U8Buf<" << val.len() << ">{";
+    1930:	/----> 4c 89 f6             	mov    %r14,%rsi
+    1933:	|      48 89 ef             	mov    %rbp,%rdi
+    1936:	|      49 8d 9c 24 01 ff ff 	lea    -0xff(%r12),%rbx
+    193d:	|      ff 
+    193e:	|      e8 dd 10 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    1943:	|      be 00 01 00 00       	mov    $0x100,%esi
+    1948:	|      48 89 c7             	mov    %rax,%rdi
+    194b:	|      e8 90 11 00 00       	call   2ae0 <nel::operator<<(nel::Log&, unsigned long)>
+    1950:	|      48 8d 35 b4 16 00 00 	lea    0x16b4(%rip),%rsi        # 300b <_IO_stdin_used+0xb>
+    1957:	|      48 89 c7             	mov    %rax,%rdi
+    195a:	|      e8 c1 10 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    195f:	|      48 89 ef             	mov    %rbp,%rdi
+    1962:	|      41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    1969:	|      ff ff 
+    196b:	|      e8 d0 10 00 00       	call   2a40 <nel::operator<<(nel::Log&, unsigned char)>
+                    outs << ' ' << val.data_[i];
+    1970:	|  /-> be 20 00 00 00       	mov    $0x20,%esi
+    1975:	|  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1978:	|  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    197c:	|  |   e8 7f 10 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    1981:	|  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1985:	|  |   48 89 c7             	mov    %rax,%rdi
+    1988:	|  |   e8 b3 10 00 00       	call   2a40 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    198d:	|  |   4c 39 e3             	cmp    %r12,%rbx
+    1990:	|  \-- 75 de                	jne    1970 <ex42()+0xd0>
+            outs << '}';
+    1992:	|      be 7d 00 00 00       	mov    $0x7d,%esi
+    1997:	|      48 89 ef             	mov    %rbp,%rdi
+    199a:	|      4c 8d a3 00 01 00 00 	lea    0x100(%rbx),%r12
+    19a1:	|      e8 5a 10 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    arr1.iter().for_each([&](U8Buf<256> &v) -> void { nel::log << v << '\n'; });
+    19a6:	|      be 0a 00 00 00       	mov    $0xa,%esi
+    19ab:	|      48 89 ef             	mov    %rbp,%rdi
+    19ae:	|      e8 4d 10 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    19b3:	|      4d 39 fc             	cmp    %r15,%r12
+    19b6:	\----- 0f 85 74 ff ff ff    	jne    1930 <ex42()+0x90>
+    19bc:	       48 8d 9c 24 00 08 00 	lea    0x800(%rsp),%rbx
+    19c3:	       00 
+    19c4:	       0f 1f 40 00          	nopl   0x0(%rax)
+            nel::elem::set(data_, 0xa5, N);
+    19c8:	   /-> 48 89 df             	mov    %rbx,%rdi
+    19cb:	   |   ba 00 01 00 00       	mov    $0x100,%edx
+    19d0:	   |   be a5 00 00 00       	mov    $0xa5,%esi
+    19d5:	   |   e8 b6 07 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    19da:	   |   48 89 d8             	mov    %rbx,%rax
+    19dd:	   |   48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    19e4:	   |   4c 39 e8             	cmp    %r13,%rax
+    19e7:	   \-- 75 df                	jne    19c8 <ex42()+0x128>
+}
+    19e9:	       48 81 c4 08 09 00 00 	add    $0x908,%rsp
+    19f0:	       5b                   	pop    %rbx
+    19f1:	       5d                   	pop    %rbp
+    19f2:	       41 5c                	pop    %r12
+    19f4:	       41 5d                	pop    %r13
+    19f6:	       41 5e                	pop    %r14
+    19f8:	       41 5f                	pop    %r15
+    19fa:	       c3                   	ret
+    19fb:	       0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000001a00 <ex51()>:
+{
+    1a00:	       41 57                	push   %r15
+            nel::elem::set(data_, f, N);
+    1a02:	       ba 00 01 00 00       	mov    $0x100,%edx
+    1a07:	       be ff 00 00 00       	mov    $0xff,%esi
+    1a0c:	       41 56                	push   %r14
+    1a0e:	       41 55                	push   %r13
+    1a10:	       41 54                	push   %r12
+    1a12:	       55                   	push   %rbp
+    1a13:	       53                   	push   %rbx
+    1a14:	       48 81 ec 08 09 00 00 	sub    $0x908,%rsp
+    1a1b:	       48 89 e5             	mov    %rsp,%rbp
+    1a1e:	       4c 8d ac 24 00 01 00 	lea    0x100(%rsp),%r13
+    1a25:	       00 
+    1a26:	       4c 8d a4 24 00 09 00 	lea    0x900(%rsp),%r12
+    1a2d:	       00 
+    1a2e:	       48 89 ef             	mov    %rbp,%rdi
+    1a31:	       4c 89 eb             	mov    %r13,%rbx
+    1a34:	       e8 57 07 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1a39:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            nel::elem::copy(data_, o.data_, N);
+    1a40:	   /-> 48 89 df             	mov    %rbx,%rdi
+    1a43:	   |   ba 00 01 00 00       	mov    $0x100,%edx
+    1a48:	   |   48 89 ee             	mov    %rbp,%rsi
+    1a4b:	   |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    1a52:	   |   e8 29 07 00 00       	call   2180 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    1a57:	   |   4c 39 e3             	cmp    %r12,%rbx
+    1a5a:	   \-- 75 e4                	jne    1a40 <ex51()+0x40>
+            nel::elem::set(data_, 0xa5, N);
+    1a5c:	       48 89 ef             	mov    %rbp,%rdi
+    1a5f:	       ba 00 01 00 00       	mov    $0x100,%edx
+    1a64:	       be a5 00 00 00       	mov    $0xa5,%esi
+    1a69:	       e8 22 07 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    for (; !it.is_done(); it.inc()) {
+    1a6e:	       4c 8d a4 24 00 02 00 	lea    0x200(%rsp),%r12
+    1a75:	       00 
+    1a76:	       4d 8d bd 00 09 00 00 	lea    0x900(%r13),%r15
+    1a7d:	       4c 8d 35 8a 15 00 00 	lea    0x158a(%rip),%r14        # 300e <_IO_stdin_used+0xe>
+    1a84:	       48 8d 2d fe 35 00 00 	lea    0x35fe(%rip),%rbp        # 5089 <nel::log>
+    1a8b:	       0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+            outs << "U8Buf<" << val.len() << ">{";
+    1a90:	/----> 4c 89 f6             	mov    %r14,%rsi
+    1a93:	|      48 89 ef             	mov    %rbp,%rdi
+    1a96:	|      49 8d 9c 24 01 ff ff 	lea    -0xff(%r12),%rbx
+    1a9d:	|      ff 
+    1a9e:	|      e8 7d 0f 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    1aa3:	|      be 00 01 00 00       	mov    $0x100,%esi
+    1aa8:	|      48 89 c7             	mov    %rax,%rdi
+    1aab:	|      e8 30 10 00 00       	call   2ae0 <nel::operator<<(nel::Log&, unsigned long)>
+    1ab0:	|      48 8d 35 54 15 00 00 	lea    0x1554(%rip),%rsi        # 300b <_IO_stdin_used+0xb>
+    1ab7:	|      48 89 c7             	mov    %rax,%rdi
+    1aba:	|      e8 61 0f 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    1abf:	|      48 89 ef             	mov    %rbp,%rdi
+    1ac2:	|      41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    1ac9:	|      ff ff 
+    1acb:	|      e8 70 0f 00 00       	call   2a40 <nel::operator<<(nel::Log&, unsigned char)>
+                    outs << ' ' << val.data_[i];
+    1ad0:	|  /-> be 20 00 00 00       	mov    $0x20,%esi
+    1ad5:	|  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1ad8:	|  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    1adc:	|  |   e8 1f 0f 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    1ae1:	|  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1ae5:	|  |   48 89 c7             	mov    %rax,%rdi
+    1ae8:	|  |   e8 53 0f 00 00       	call   2a40 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1aed:	|  |   4c 39 e3             	cmp    %r12,%rbx
+    1af0:	|  \-- 75 de                	jne    1ad0 <ex51()+0xd0>
+            outs << '}';
+    1af2:	|      be 7d 00 00 00       	mov    $0x7d,%esi
+    1af7:	|      48 89 ef             	mov    %rbp,%rdi
+    1afa:	|      4c 8d a3 00 01 00 00 	lea    0x100(%rbx),%r12
+    1b01:	|      e8 fa 0e 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+        nel::log << v << '\n';
+    1b06:	|      be 0a 00 00 00       	mov    $0xa,%esi
+    1b0b:	|      48 89 ef             	mov    %rbp,%rdi
+    1b0e:	|      e8 ed 0e 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    for (; !it.is_done(); it.inc()) {
+    1b13:	|      4d 39 fc             	cmp    %r15,%r12
+    1b16:	\----- 0f 85 74 ff ff ff    	jne    1a90 <ex51()+0x90>
+    1b1c:	       48 8d 9c 24 00 08 00 	lea    0x800(%rsp),%rbx
+    1b23:	       00 
+            nel::elem::set(data_, 0xa5, N);
+    1b24:	   /-> 48 89 df             	mov    %rbx,%rdi
+    1b27:	   |   ba 00 01 00 00       	mov    $0x100,%edx
+    1b2c:	   |   be a5 00 00 00       	mov    $0xa5,%esi
+    1b31:	   |   e8 5a 06 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1b36:	   |   48 89 d8             	mov    %rbx,%rax
+    1b39:	   |   48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    1b40:	   |   4c 39 e8             	cmp    %r13,%rax
+    1b43:	   \-- 75 df                	jne    1b24 <ex51()+0x124>
+}
+    1b45:	       48 81 c4 08 09 00 00 	add    $0x908,%rsp
+    1b4c:	       5b                   	pop    %rbx
+    1b4d:	       5d                   	pop    %rbp
+    1b4e:	       41 5c                	pop    %r12
+    1b50:	       41 5d                	pop    %r13
+    1b52:	       41 5e                	pop    %r14
+    1b54:	       41 5f                	pop    %r15
+    1b56:	       c3                   	ret
+    1b57:	       66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    1b5e:	       00 00 
+
+0000000000001b60 <ex52()>:
+{
+    1b60:	       41 57                	push   %r15
+            nel::elem::set(data_, f, N);
+    1b62:	       ba 00 01 00 00       	mov    $0x100,%edx
+    1b67:	       be ff 00 00 00       	mov    $0xff,%esi
+    1b6c:	       41 56                	push   %r14
+    1b6e:	       41 55                	push   %r13
+    1b70:	       41 54                	push   %r12
+    1b72:	       55                   	push   %rbp
+    1b73:	       53                   	push   %rbx
+    1b74:	       48 81 ec 08 09 00 00 	sub    $0x908,%rsp
+    1b7b:	       48 89 e5             	mov    %rsp,%rbp
+    1b7e:	       4c 8d ac 24 00 01 00 	lea    0x100(%rsp),%r13
+    1b85:	       00 
+    1b86:	       4c 8d a4 24 00 09 00 	lea    0x900(%rsp),%r12
+    1b8d:	       00 
+    1b8e:	       48 89 ef             	mov    %rbp,%rdi
+    1b91:	       4c 89 eb             	mov    %r13,%rbx
+    1b94:	       e8 f7 05 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1b99:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            nel::elem::copy(data_, o.data_, N);
+    1ba0:	   /-> 48 89 df             	mov    %rbx,%rdi
+    1ba3:	   |   ba 00 01 00 00       	mov    $0x100,%edx
+    1ba8:	   |   48 89 ee             	mov    %rbp,%rsi
+    1bab:	   |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    1bb2:	   |   e8 c9 05 00 00       	call   2180 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    1bb7:	   |   4c 39 e3             	cmp    %r12,%rbx
+    1bba:	   \-- 75 e4                	jne    1ba0 <ex52()+0x40>
+            nel::elem::set(data_, 0xa5, N);
+    1bbc:	       48 89 ef             	mov    %rbp,%rdi
+    1bbf:	       ba 00 01 00 00       	mov    $0x100,%edx
+    1bc4:	       be a5 00 00 00       	mov    $0xa5,%esi
+    1bc9:	       e8 c2 05 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1bce:	       4c 8d a4 24 00 02 00 	lea    0x200(%rsp),%r12
+    1bd5:	       00 
+    1bd6:	       4d 8d bd 00 09 00 00 	lea    0x900(%r13),%r15
+    1bdd:	       4c 8d 35 2a 14 00 00 	lea    0x142a(%rip),%r14        # 300e <_IO_stdin_used+0xe>
+    1be4:	       48 8d 2d 9e 34 00 00 	lea    0x349e(%rip),%rbp        # 5089 <nel::log>
+    1beb:	       0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+            outs << "U8Buf<" << val.len() << ">{";
+    1bf0:	/----> 4c 89 f6             	mov    %r14,%rsi
+    1bf3:	|      48 89 ef             	mov    %rbp,%rdi
+    1bf6:	|      49 8d 9c 24 01 ff ff 	lea    -0xff(%r12),%rbx
+    1bfd:	|      ff 
+    1bfe:	|      e8 1d 0e 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    1c03:	|      be 00 01 00 00       	mov    $0x100,%esi
+    1c08:	|      48 89 c7             	mov    %rax,%rdi
+    1c0b:	|      e8 d0 0e 00 00       	call   2ae0 <nel::operator<<(nel::Log&, unsigned long)>
+    1c10:	|      48 8d 35 f4 13 00 00 	lea    0x13f4(%rip),%rsi        # 300b <_IO_stdin_used+0xb>
+    1c17:	|      48 89 c7             	mov    %rax,%rdi
+    1c1a:	|      e8 01 0e 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    1c1f:	|      48 89 ef             	mov    %rbp,%rdi
+    1c22:	|      41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    1c29:	|      ff ff 
+    1c2b:	|      e8 10 0e 00 00       	call   2a40 <nel::operator<<(nel::Log&, unsigned char)>
+                    outs << ' ' << val.data_[i];
+    1c30:	|  /-> be 20 00 00 00       	mov    $0x20,%esi
+    1c35:	|  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1c38:	|  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    1c3c:	|  |   e8 bf 0d 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    1c41:	|  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1c45:	|  |   48 89 c7             	mov    %rax,%rdi
+    1c48:	|  |   e8 f3 0d 00 00       	call   2a40 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1c4d:	|  |   4c 39 e3             	cmp    %r12,%rbx
+    1c50:	|  \-- 75 de                	jne    1c30 <ex52()+0xd0>
+            outs << '}';
+    1c52:	|      be 7d 00 00 00       	mov    $0x7d,%esi
+    1c57:	|      48 89 ef             	mov    %rbp,%rdi
+    1c5a:	|      4c 8d a3 00 01 00 00 	lea    0x100(%rbx),%r12
+    1c61:	|      e8 9a 0d 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    arr1.iter().for_each([&](U8Buf<256> &v) -> void { nel::log << v << '\n'; });
+    1c66:	|      be 0a 00 00 00       	mov    $0xa,%esi
+    1c6b:	|      48 89 ef             	mov    %rbp,%rdi
+    1c6e:	|      e8 8d 0d 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    1c73:	|      4d 39 fc             	cmp    %r15,%r12
+    1c76:	\----- 0f 85 74 ff ff ff    	jne    1bf0 <ex52()+0x90>
+    1c7c:	       48 8d 9c 24 00 08 00 	lea    0x800(%rsp),%rbx
+    1c83:	       00 
+    1c84:	       0f 1f 40 00          	nopl   0x0(%rax)
+            nel::elem::set(data_, 0xa5, N);
+    1c88:	   /-> 48 89 df             	mov    %rbx,%rdi
+    1c8b:	   |   ba 00 01 00 00       	mov    $0x100,%edx
+    1c90:	   |   be a5 00 00 00       	mov    $0xa5,%esi
+    1c95:	   |   e8 f6 04 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1c9a:	   |   48 89 d8             	mov    %rbx,%rax
+    1c9d:	   |   48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    1ca4:	   |   4c 39 e8             	cmp    %r13,%rax
+    1ca7:	   \-- 75 df                	jne    1c88 <ex52()+0x128>
+}
+    1ca9:	       48 81 c4 08 09 00 00 	add    $0x908,%rsp
+    1cb0:	       5b                   	pop    %rbx
+    1cb1:	       5d                   	pop    %rbp
+    1cb2:	       41 5c                	pop    %r12
+    1cb4:	       41 5d                	pop    %r13
+    1cb6:	       41 5e                	pop    %r14
+    1cb8:	       41 5f                	pop    %r15
+    1cba:	       c3                   	ret
+    1cbb:	       0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000001cc0 <ex62()>:
+{
+    1cc0:	       41 57                	push   %r15
+            nel::elem::set(data_, f, N);
+    1cc2:	       ba 00 01 00 00       	mov    $0x100,%edx
+    1cc7:	       be ff 00 00 00       	mov    $0xff,%esi
+    1ccc:	       41 56                	push   %r14
+    1cce:	       41 55                	push   %r13
+    1cd0:	       41 54                	push   %r12
+    1cd2:	       55                   	push   %rbp
+    1cd3:	       53                   	push   %rbx
+    1cd4:	       48 81 ec 08 09 00 00 	sub    $0x908,%rsp
+    1cdb:	       48 89 e5             	mov    %rsp,%rbp
+    1cde:	       4c 8d b4 24 00 01 00 	lea    0x100(%rsp),%r14
+    1ce5:	       00 
+    1ce6:	       4c 8d a4 24 00 09 00 	lea    0x900(%rsp),%r12
+    1ced:	       00 
+    1cee:	       48 89 ef             	mov    %rbp,%rdi
+    1cf1:	       4c 89 f3             	mov    %r14,%rbx
+    1cf4:	       e8 97 04 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            nel::elem::copy(data_, o.data_, N);
+    1cf9:	   /-> 48 89 df             	mov    %rbx,%rdi
+    1cfc:	   |   ba 00 01 00 00       	mov    $0x100,%edx
+    1d01:	   |   48 89 ee             	mov    %rbp,%rsi
+    1d04:	   |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    1d0b:	   |   e8 70 04 00 00       	call   2180 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    1d10:	   |   4c 39 e3             	cmp    %r12,%rbx
+    1d13:	   \-- 75 e4                	jne    1cf9 <ex62()+0x39>
+            nel::elem::set(data_, 0xa5, N);
+    1d15:	       ba 00 01 00 00       	mov    $0x100,%edx
+    1d1a:	       be a5 00 00 00       	mov    $0xa5,%esi
+    1d1f:	       48 89 ef             	mov    %rbp,%rdi
+        Length const limit_;
+
+    public:
+        constexpr FirstNIterator(It &&inner, Length limit)
+            : inner_(move(inner))
+            , current_(0)
+    1d22:	       45 31 ed             	xor    %r13d,%r13d
+    1d25:	       e8 66 04 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        SliceIterator &operator=(SliceIterator const &o) = default;
+
+    public:
+        // move ok
+        SliceIterator(SliceIterator &&o)
+            : b_(move(o.b_))
+    1d2a:	       4d 89 f4             	mov    %r14,%r12
+    1d2d:	       4c 8d 3d 55 33 00 00 	lea    0x3355(%rip),%r15        # 5089 <nel::log>
+    1d34:	       0f 1f 40 00          	nopl   0x0(%rax)
+        nel::log << '[' << i << ']' << ':' << e << '\n';
+    1d38:	/----> be 5b 00 00 00       	mov    $0x5b,%esi
+    1d3d:	|      4c 89 ff             	mov    %r15,%rdi
+            return (b_ == e_);
+        }
+
+        void inc(void)
+        {
+            ++b_;
+    1d40:	|      49 81 c4 00 01 00 00 	add    $0x100,%r12
+    1d47:	|      e8 b4 0c 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    1d4c:	|      4c 89 ee             	mov    %r13,%rsi
+    1d4f:	|      49 8d 9c 24 01 ff ff 	lea    -0xff(%r12),%rbx
+    1d56:	|      ff 
+    1d57:	|      48 89 c7             	mov    %rax,%rdi
+    1d5a:	|      e8 81 0d 00 00       	call   2ae0 <nel::operator<<(nel::Log&, unsigned long)>
+    1d5f:	|      be 5d 00 00 00       	mov    $0x5d,%esi
+    1d64:	|      48 89 c7             	mov    %rax,%rdi
+    1d67:	|      e8 94 0c 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    1d6c:	|      be 3a 00 00 00       	mov    $0x3a,%esi
+    1d71:	|      48 89 c7             	mov    %rax,%rdi
+    1d74:	|      e8 87 0c 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+            outs << "U8Buf<" << val.len() << ">{";
+    1d79:	|      48 8d 35 8e 12 00 00 	lea    0x128e(%rip),%rsi        # 300e <_IO_stdin_used+0xe>
+    1d80:	|      48 89 c7             	mov    %rax,%rdi
+    1d83:	|      48 89 c5             	mov    %rax,%rbp
+    1d86:	|      e8 95 0c 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    1d8b:	|      be 00 01 00 00       	mov    $0x100,%esi
+    1d90:	|      48 89 c7             	mov    %rax,%rdi
+    1d93:	|      e8 48 0d 00 00       	call   2ae0 <nel::operator<<(nel::Log&, unsigned long)>
+    1d98:	|      48 8d 35 6c 12 00 00 	lea    0x126c(%rip),%rsi        # 300b <_IO_stdin_used+0xb>
+    1d9f:	|      48 89 c7             	mov    %rax,%rdi
+    1da2:	|      e8 79 0c 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    1da7:	|      48 89 ef             	mov    %rbp,%rdi
+    1daa:	|      41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    1db1:	|      ff ff 
+    1db3:	|      e8 88 0c 00 00       	call   2a40 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1db8:	|      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    1dbf:	|      00 
+                    outs << ' ' << val.data_[i];
+    1dc0:	|  /-> be 20 00 00 00       	mov    $0x20,%esi
+    1dc5:	|  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1dc8:	|  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    1dcc:	|  |   e8 2f 0c 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    1dd1:	|  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1dd5:	|  |   48 89 c7             	mov    %rax,%rdi
+    1dd8:	|  |   e8 63 0c 00 00       	call   2a40 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1ddd:	|  |   49 39 dc             	cmp    %rbx,%r12
+    1de0:	|  \-- 75 de                	jne    1dc0 <ex62()+0x100>
+            outs << '}';
+    1de2:	|      be 7d 00 00 00       	mov    $0x7d,%esi
+    1de7:	|      48 89 ef             	mov    %rbp,%rdi
+    1dea:	|      e8 11 0c 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    1def:	|      be 0a 00 00 00       	mov    $0xa,%esi
+    1df4:	|      48 89 ef             	mov    %rbp,%rdi
+    1df7:	|      e8 04 0c 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+                if (!fn(acc, forward<OutT>(e))) { return false; }
+    1dfc:	|      4d 85 ed             	test   %r13,%r13
+    1dff:	|  /-- 75 0b                	jne    1e0c <ex62()+0x14c>
+        {
+            if (current_ >= limit_) { return; }
+            bool unused = true;
+            inner_.try_fold(unused, [this, &fn](bool &, typename It::OutT e) {
+                fn(e);
+                return ++current_ < limit_;
+    1e01:	|  |   41 bd 01 00 00 00    	mov    $0x1,%r13d
+    1e07:	\--|-- e9 2c ff ff ff       	jmp    1d38 <ex62()+0x78>
+    1e0c:	   \-> 48 8d 9c 24 00 08 00 	lea    0x800(%rsp),%rbx
+    1e13:	       00 
+            nel::elem::set(data_, 0xa5, N);
+    1e14:	   /-> 48 89 df             	mov    %rbx,%rdi
+    1e17:	   |   ba 00 01 00 00       	mov    $0x100,%edx
+    1e1c:	   |   be a5 00 00 00       	mov    $0xa5,%esi
+    1e21:	   |   e8 6a 03 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1e26:	   |   48 89 d8             	mov    %rbx,%rax
+    1e29:	   |   48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    1e30:	   |   49 39 c6             	cmp    %rax,%r14
+    1e33:	   \-- 75 df                	jne    1e14 <ex62()+0x154>
+}
+    1e35:	       48 81 c4 08 09 00 00 	add    $0x908,%rsp
+    1e3c:	       5b                   	pop    %rbx
+    1e3d:	       5d                   	pop    %rbp
+    1e3e:	       41 5c                	pop    %r12
+    1e40:	       41 5d                	pop    %r13
+    1e42:	       41 5e                	pop    %r14
+    1e44:	       41 5f                	pop    %r15
+    1e46:	       c3                   	ret
+    1e47:	       66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    1e4e:	       00 00 
+
+0000000000001e50 <ex71()>:
+{
+    1e50:	       41 57                	push   %r15
+            nel::elem::set(data_, f, N);
+    1e52:	       ba 00 01 00 00       	mov    $0x100,%edx
+    1e57:	       be ff 00 00 00       	mov    $0xff,%esi
+    1e5c:	       41 56                	push   %r14
+    1e5e:	       41 55                	push   %r13
+    1e60:	       41 54                	push   %r12
+    1e62:	       55                   	push   %rbp
+    1e63:	       53                   	push   %rbx
+    1e64:	       48 81 ec 08 09 00 00 	sub    $0x908,%rsp
+    1e6b:	       48 89 e5             	mov    %rsp,%rbp
+    1e6e:	       4c 8d ac 24 00 01 00 	lea    0x100(%rsp),%r13
+    1e75:	       00 
+    1e76:	       4c 8d a4 24 00 09 00 	lea    0x900(%rsp),%r12
+    1e7d:	       00 
+    1e7e:	       48 89 ef             	mov    %rbp,%rdi
+    1e81:	       4c 89 eb             	mov    %r13,%rbx
+    1e84:	       e8 07 03 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            for (; !self().is_done(); self().inc()) {
+    1e89:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            nel::elem::copy(data_, o.data_, N);
+    1e90:	   /-> 48 89 df             	mov    %rbx,%rdi
+    1e93:	   |   ba 00 01 00 00       	mov    $0x100,%edx
+    1e98:	   |   48 89 ee             	mov    %rbp,%rsi
+    1e9b:	   |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    1ea2:	   |   e8 d9 02 00 00       	call   2180 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    1ea7:	   |   4c 39 e3             	cmp    %r12,%rbx
+    1eaa:	   \-- 75 e4                	jne    1e90 <ex71()+0x40>
+            nel::elem::set(data_, 0xa5, N);
+    1eac:	       ba 00 01 00 00       	mov    $0x100,%edx
+    1eb1:	       be a5 00 00 00       	mov    $0xa5,%esi
+    1eb6:	       48 89 ef             	mov    %rbp,%rdi
+    Index i = 0;
+    1eb9:	       45 31 f6             	xor    %r14d,%r14d
+    1ebc:	       e8 cf 02 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    for (; !it.is_done(); it.inc()) {
+    1ec1:	       4c 8d a4 24 00 02 00 	lea    0x200(%rsp),%r12
+    1ec8:	       00 
+    1ec9:	       4c 8d 3d b9 31 00 00 	lea    0x31b9(%rip),%r15        # 5089 <nel::log>
+        nel::log << '[' << i << ']' << ':' << e << '\n';
+    1ed0:	/----> be 5b 00 00 00       	mov    $0x5b,%esi
+    1ed5:	|      4c 89 ff             	mov    %r15,%rdi
+    1ed8:	|      49 8d 9c 24 01 ff ff 	lea    -0xff(%r12),%rbx
+    1edf:	|      ff 
+    1ee0:	|      e8 1b 0b 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    1ee5:	|      4c 89 f6             	mov    %r14,%rsi
+    1ee8:	|      48 89 c7             	mov    %rax,%rdi
+    1eeb:	|      e8 f0 0b 00 00       	call   2ae0 <nel::operator<<(nel::Log&, unsigned long)>
+    1ef0:	|      be 5d 00 00 00       	mov    $0x5d,%esi
+    1ef5:	|      48 89 c7             	mov    %rax,%rdi
+    1ef8:	|      e8 03 0b 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    1efd:	|      be 3a 00 00 00       	mov    $0x3a,%esi
+    1f02:	|      48 89 c7             	mov    %rax,%rdi
+    1f05:	|      e8 f6 0a 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+            outs << "U8Buf<" << val.len() << ">{";
+    1f0a:	|      48 8d 35 fd 10 00 00 	lea    0x10fd(%rip),%rsi        # 300e <_IO_stdin_used+0xe>
+    1f11:	|      48 89 c7             	mov    %rax,%rdi
+    1f14:	|      48 89 c5             	mov    %rax,%rbp
+    1f17:	|      e8 04 0b 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    1f1c:	|      be 00 01 00 00       	mov    $0x100,%esi
+    1f21:	|      48 89 c7             	mov    %rax,%rdi
+    1f24:	|      e8 b7 0b 00 00       	call   2ae0 <nel::operator<<(nel::Log&, unsigned long)>
+    1f29:	|      48 8d 35 db 10 00 00 	lea    0x10db(%rip),%rsi        # 300b <_IO_stdin_used+0xb>
+    1f30:	|      48 89 c7             	mov    %rax,%rdi
+    1f33:	|      e8 e8 0a 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    1f38:	|      48 89 ef             	mov    %rbp,%rdi
+    1f3b:	|      41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    1f42:	|      ff ff 
+    1f44:	|      e8 f7 0a 00 00       	call   2a40 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1f49:	|      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+                    outs << ' ' << val.data_[i];
+    1f50:	|  /-> be 20 00 00 00       	mov    $0x20,%esi
+    1f55:	|  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1f58:	|  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    1f5c:	|  |   e8 9f 0a 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    1f61:	|  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1f65:	|  |   48 89 c7             	mov    %rax,%rdi
+    1f68:	|  |   e8 d3 0a 00 00       	call   2a40 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1f6d:	|  |   4c 39 e3             	cmp    %r12,%rbx
+    1f70:	|  \-- 75 de                	jne    1f50 <ex71()+0x100>
+            outs << '}';
+    1f72:	|      be 7d 00 00 00       	mov    $0x7d,%esi
+    1f77:	|      48 89 ef             	mov    %rbp,%rdi
+    for (; !it.is_done(); it.inc()) {
+    1f7a:	|      4c 8d a3 00 01 00 00 	lea    0x100(%rbx),%r12
+    1f81:	|      e8 7a 0a 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+        nel::log << '[' << i << ']' << ':' << e << '\n';
+    1f86:	|      be 0a 00 00 00       	mov    $0xa,%esi
+    1f8b:	|      48 89 ef             	mov    %rbp,%rdi
+    1f8e:	|      e8 6d 0a 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    for (; !it.is_done(); it.inc()) {
+    1f93:	|      4d 85 f6             	test   %r14,%r14
+    1f96:	|  /-- 75 0b                	jne    1fa3 <ex71()+0x153>
+        ++i;
+    1f98:	|  |   41 be 01 00 00 00    	mov    $0x1,%r14d
+    1f9e:	\--|-- e9 2d ff ff ff       	jmp    1ed0 <ex71()+0x80>
+    1fa3:	   \-> 48 8d 9c 24 00 08 00 	lea    0x800(%rsp),%rbx
+    1faa:	       00 
+    1fab:	       0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+            nel::elem::set(data_, 0xa5, N);
+    1fb0:	   /-> 48 89 df             	mov    %rbx,%rdi
+    1fb3:	   |   ba 00 01 00 00       	mov    $0x100,%edx
+    1fb8:	   |   be a5 00 00 00       	mov    $0xa5,%esi
+    1fbd:	   |   e8 ce 01 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1fc2:	   |   48 89 d8             	mov    %rbx,%rax
+    1fc5:	   |   48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    1fcc:	   |   4c 39 e8             	cmp    %r13,%rax
+    1fcf:	   \-- 75 df                	jne    1fb0 <ex71()+0x160>
+}
+    1fd1:	       48 81 c4 08 09 00 00 	add    $0x908,%rsp
+    1fd8:	       5b                   	pop    %rbx
+    1fd9:	       5d                   	pop    %rbp
+    1fda:	       41 5c                	pop    %r12
+    1fdc:	       41 5d                	pop    %r13
+    1fde:	       41 5e                	pop    %r14
+    1fe0:	       41 5f                	pop    %r15
+    1fe2:	       c3                   	ret
+    1fe3:	       66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1fea:	       00 00 00 00 
+    1fee:	       66 90                	xchg   %ax,%ax
+
+0000000000001ff0 <ex72()>:
+{
+    1ff0:	       41 57                	push   %r15
+            nel::elem::set(data_, f, N);
+    1ff2:	       ba 00 01 00 00       	mov    $0x100,%edx
+    1ff7:	       be ff 00 00 00       	mov    $0xff,%esi
+    1ffc:	       41 56                	push   %r14
+    1ffe:	       41 55                	push   %r13
+    2000:	       41 54                	push   %r12
+    2002:	       55                   	push   %rbp
+    2003:	       53                   	push   %rbx
+    2004:	       48 81 ec 08 09 00 00 	sub    $0x908,%rsp
+    200b:	       48 89 e5             	mov    %rsp,%rbp
+    200e:	       4c 8d b4 24 00 01 00 	lea    0x100(%rsp),%r14
+    2015:	       00 
+    2016:	       4c 8d a4 24 00 09 00 	lea    0x900(%rsp),%r12
+    201d:	       00 
+    201e:	       48 89 ef             	mov    %rbp,%rdi
+    2021:	       4c 89 f3             	mov    %r14,%rbx
+    2024:	       e8 67 01 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            nel::elem::copy(data_, o.data_, N);
+    2029:	   /-> 48 89 df             	mov    %rbx,%rdi
+    202c:	   |   ba 00 01 00 00       	mov    $0x100,%edx
+    2031:	   |   48 89 ee             	mov    %rbp,%rsi
+    2034:	   |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    203b:	   |   e8 40 01 00 00       	call   2180 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+    2040:	   |   4c 39 e3             	cmp    %r12,%rbx
+    2043:	   \-- 75 e4                	jne    2029 <ex72()+0x39>
+            nel::elem::set(data_, 0xa5, N);
+    2045:	       ba 00 01 00 00       	mov    $0x100,%edx
+    204a:	       be a5 00 00 00       	mov    $0xa5,%esi
+    204f:	       48 89 ef             	mov    %rbp,%rdi
+            , current_(0)
+    2052:	       45 31 ed             	xor    %r13d,%r13d
+    2055:	       e8 36 01 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            : b_(move(o.b_))
+    205a:	       4d 89 f4             	mov    %r14,%r12
+    205d:	       4c 8d 3d 25 30 00 00 	lea    0x3025(%rip),%r15        # 5089 <nel::log>
+    2064:	       0f 1f 40 00          	nopl   0x0(%rax)
+        nel::log << '[' << i << ']' << ':' << e << '\n';
+    2068:	/----> be 5b 00 00 00       	mov    $0x5b,%esi
+    206d:	|      4c 89 ff             	mov    %r15,%rdi
+            ++b_;
+    2070:	|      49 81 c4 00 01 00 00 	add    $0x100,%r12
+    2077:	|      e8 84 09 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    207c:	|      4c 89 ee             	mov    %r13,%rsi
+    207f:	|      49 8d 9c 24 01 ff ff 	lea    -0xff(%r12),%rbx
+    2086:	|      ff 
+    2087:	|      48 89 c7             	mov    %rax,%rdi
+    208a:	|      e8 51 0a 00 00       	call   2ae0 <nel::operator<<(nel::Log&, unsigned long)>
+    208f:	|      be 5d 00 00 00       	mov    $0x5d,%esi
+    2094:	|      48 89 c7             	mov    %rax,%rdi
+    2097:	|      e8 64 09 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    209c:	|      be 3a 00 00 00       	mov    $0x3a,%esi
+    20a1:	|      48 89 c7             	mov    %rax,%rdi
+    20a4:	|      e8 57 09 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+            outs << "U8Buf<" << val.len() << ">{";
+    20a9:	|      48 8d 35 5e 0f 00 00 	lea    0xf5e(%rip),%rsi        # 300e <_IO_stdin_used+0xe>
+    20b0:	|      48 89 c7             	mov    %rax,%rdi
+    20b3:	|      48 89 c5             	mov    %rax,%rbp
+    20b6:	|      e8 65 09 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+    20bb:	|      be 00 01 00 00       	mov    $0x100,%esi
+    20c0:	|      48 89 c7             	mov    %rax,%rdi
+    20c3:	|      e8 18 0a 00 00       	call   2ae0 <nel::operator<<(nel::Log&, unsigned long)>
+    20c8:	|      48 8d 35 3c 0f 00 00 	lea    0xf3c(%rip),%rsi        # 300b <_IO_stdin_used+0xb>
+    20cf:	|      48 89 c7             	mov    %rax,%rdi
+    20d2:	|      e8 49 09 00 00       	call   2a20 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    20d7:	|      48 89 ef             	mov    %rbp,%rdi
+    20da:	|      41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    20e1:	|      ff ff 
+    20e3:	|      e8 58 09 00 00       	call   2a40 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    20e8:	|      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    20ef:	|      00 
+                    outs << ' ' << val.data_[i];
+    20f0:	|  /-> be 20 00 00 00       	mov    $0x20,%esi
+    20f5:	|  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    20f8:	|  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    20fc:	|  |   e8 ff 08 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    2101:	|  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    2105:	|  |   48 89 c7             	mov    %rax,%rdi
+    2108:	|  |   e8 33 09 00 00       	call   2a40 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    210d:	|  |   49 39 dc             	cmp    %rbx,%r12
+    2110:	|  \-- 75 de                	jne    20f0 <ex72()+0x100>
+            outs << '}';
+    2112:	|      be 7d 00 00 00       	mov    $0x7d,%esi
+    2117:	|      48 89 ef             	mov    %rbp,%rdi
+    211a:	|      e8 e1 08 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+    211f:	|      be 0a 00 00 00       	mov    $0xa,%esi
+    2124:	|      48 89 ef             	mov    %rbp,%rdi
+    2127:	|      e8 d4 08 00 00       	call   2a00 <nel::operator<<(nel::Log&, char)>
+                if (!fn(acc, forward<OutT>(e))) { return false; }
+    212c:	|      4d 85 ed             	test   %r13,%r13
+    212f:	|  /-- 75 0b                	jne    213c <ex72()+0x14c>
+                return ++current_ < limit_;
+    2131:	|  |   41 bd 01 00 00 00    	mov    $0x1,%r13d
+    2137:	\--|-- e9 2c ff ff ff       	jmp    2068 <ex72()+0x78>
+    213c:	   \-> 48 8d 9c 24 00 08 00 	lea    0x800(%rsp),%rbx
+    2143:	       00 
+            nel::elem::set(data_, 0xa5, N);
+    2144:	   /-> 48 89 df             	mov    %rbx,%rdi
+    2147:	   |   ba 00 01 00 00       	mov    $0x100,%edx
+    214c:	   |   be a5 00 00 00       	mov    $0xa5,%esi
+    2151:	   |   e8 3a 00 00 00       	call   2190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    2156:	   |   48 89 d8             	mov    %rbx,%rax
+    2159:	   |   48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    2160:	   |   49 39 c6             	cmp    %rax,%r14
+    2163:	   \-- 75 df                	jne    2144 <ex72()+0x154>
+}
+    2165:	       48 81 c4 08 09 00 00 	add    $0x908,%rsp
+    216c:	       5b                   	pop    %rbx
+    216d:	       5d                   	pop    %rbp
+    216e:	       41 5c                	pop    %r12
+    2170:	       41 5d                	pop    %r13
+    2172:	       41 5e                	pop    %r14
+    2174:	       41 5f                	pop    %r15
+    2176:	       c3                   	ret
+    2177:	       66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    217e:	       00 00 
+
+0000000000002180 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    2180:	e9 1b ef ff ff       	jmp    10a0 <memcpy@plt>
+    2185:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    218c:	00 00 00 00 
+
+0000000000002190 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    2190:	40 0f b6 f6          	movzbl %sil,%esi
+    2194:	e9 c7 ee ff ff       	jmp    1060 <memset@plt>
+    2199:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000021a0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+}
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    21a0:	e9 fb ee ff ff       	jmp    10a0 <memcpy@plt>
+    21a5:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    21ac:	00 00 00 00 
+
+00000000000021b0 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    21b0:	e9 1b ef ff ff       	jmp    10d0 <memmove@plt>
+    21b5:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    21bc:	00 00 00 00 
+
+00000000000021c0 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    21c0:	48 89 f2             	mov    %rsi,%rdx
+    std::memset(d, s, n);
+    21c3:	be a5 00 00 00       	mov    $0xa5,%esi
+    21c8:	e9 93 ee ff ff       	jmp    1060 <memset@plt>
+    21cd:	0f 1f 00             	nopl   (%rax)
+
+00000000000021d0 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+    set(d, 0xa5, n);
+}
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    21d0:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    21d4:	e8 a7 ee ff ff       	call   1080 <memcmp@plt>
+    21d9:	85 c0                	test   %eax,%eax
+    21db:	0f 94 c0             	sete   %al
+}
+    21de:	48 83 c4 08          	add    $0x8,%rsp
+    21e2:	c3                   	ret
+    21e3:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    21ea:	00 00 00 00 
+    21ee:	66 90                	xchg   %ax,%ax
+
+00000000000021f0 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    21f0:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    21f4:	e8 87 ee ff ff       	call   1080 <memcmp@plt>
+    21f9:	85 c0                	test   %eax,%eax
+    21fb:	0f 95 c0             	setne  %al
+}
+    21fe:	48 83 c4 08          	add    $0x8,%rsp
+    2202:	c3                   	ret
+    2203:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    220a:	00 00 00 00 
+    220e:	66 90                	xchg   %ax,%ax
+
+0000000000002210 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    if (n < streaming_min) {
+    2210:	                48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    2217:	/-------------- 0f 86 d7 00 00 00    	jbe    22f4 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xe4>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    221d:	|               48 89 f9             	mov    %rdi,%rcx
+{
+    2220:	|               53                   	push   %rbx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2221:	|               48 f7 d9             	neg    %rcx
+    2224:	|               83 e1 0f             	and    $0xf,%ecx
+    std::memcpy(d, s, n);
+    2227:	|               83 f9 08             	cmp    $0x8,%ecx
+    222a:	|     /-------- 0f 82 d0 00 00 00    	jb     2300 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xf0>
+    2230:	|     |         48 8b 06             	mov    (%rsi),%rax
+    2233:	|     |         4c 8d 57 08          	lea    0x8(%rdi),%r10
+    2237:	|     |         48 89 f3             	mov    %rsi,%rbx
+    223a:	|     |         49 83 e2 f8          	and    $0xfffffffffffffff8,%r10
+    223e:	|     |         48 89 07             	mov    %rax,(%rdi)
+    2241:	|     |         48 8b 44 0e f8       	mov    -0x8(%rsi,%rcx,1),%rax
+    2246:	|     |         48 89 44 0f f8       	mov    %rax,-0x8(%rdi,%rcx,1)
+    224b:	|     |         48 89 f8             	mov    %rdi,%rax
+    224e:	|     |         4c 29 d0             	sub    %r10,%rax
+    2251:	|     |         48 29 c3             	sub    %rax,%rbx
+    2254:	|     |         01 c8                	add    %ecx,%eax
+    2256:	|     |         83 e0 f8             	and    $0xfffffff8,%eax
+    2259:	|     |         83 f8 08             	cmp    $0x8,%eax
+    225c:	|  /--|-------- 72 1a                	jb     2278 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    225e:	|  |  |         83 e0 f8             	and    $0xfffffff8,%eax
+    2261:	|  |  |         45 31 c0             	xor    %r8d,%r8d
+    2264:	|  |  |     /-> 45 89 c1             	mov    %r8d,%r9d
+    2267:	|  |  |     |   41 83 c0 08          	add    $0x8,%r8d
+    226b:	|  |  |     |   4e 8b 1c 0b          	mov    (%rbx,%r9,1),%r11
+    226f:	|  |  |     |   4f 89 1c 0a          	mov    %r11,(%r10,%r9,1)
+    2273:	|  |  |     |   41 39 c0             	cmp    %eax,%r8d
+    2276:	|  |  |     \-- 72 ec                	jb     2264 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x54>
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    2278:	|  >--|-------> 48 8d 41 40          	lea    0x40(%rcx),%rax
+    227c:	|  |  |         48 01 f9             	add    %rdi,%rcx
+    227f:	|  |  |         90                   	nop
+    std::memcpy(&v, s, sizeof(v));
+    2280:	|  |  |     /-> f3 0f 6f 54 06 d0    	movdqu -0x30(%rsi,%rax,1),%xmm2
+    2286:	|  |  |     |   f3 0f 6f 4c 06 e0    	movdqu -0x20(%rsi,%rax,1),%xmm1
+    228c:	|  |  |     |   49 89 c0             	mov    %rax,%r8
+    for (; i + 64 <= n; i += 64) {
+    228f:	|  |  |     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    2293:	|  |  |     |   f3 0f 6f 44 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2299:	|  |  |     |   f3 0f 6f 5c 06 c0    	movdqu -0x40(%rsi,%rax,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    229f:	|  |  |     |   48 83 c0 40          	add    $0x40,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    22a3:	|  |  |     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    22a8:	|  |  |     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    22ad:	|  |  |     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    22b2:	|  |  |     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    22b7:	|  |  |     |   48 39 c2             	cmp    %rax,%rdx
+    22ba:	|  |  |     \-- 73 c4                	jae    2280 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x70>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    22bc:	|  |  |         49 8d 40 10          	lea    0x10(%r8),%rax
+    22c0:	|  |  |         48 39 c2             	cmp    %rax,%rdx
+    22c3:	|  |  |  /----- 72 22                	jb     22e7 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd7>
+    22c5:	|  |  |  |      48 8d 4f f0          	lea    -0x10(%rdi),%rcx
+    22c9:	|  |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    22d0:	|  |  |  |  /-> f3 0f 6f 64 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm4
+    22d6:	|  |  |  |  |   49 89 c0             	mov    %rax,%r8
+    22d9:	|  |  |  |  |   66 0f e7 24 01       	movntdq %xmm4,(%rcx,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    22de:	|  |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    22e2:	|  |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    22e5:	|  |  |  |  \-- 73 e9                	jae    22d0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc0>
+        stream16(d + i, load16(s + i));
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    22e7:	|  |  |  \----> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    22ea:	|  |  |         4c 01 c7             	add    %r8,%rdi
+    22ed:	|  |  |         4c 29 c2             	sub    %r8,%rdx
+    22f0:	|  |  |         4c 01 c6             	add    %r8,%rsi
+}
+    22f3:	|  |  |         5b                   	pop    %rbx
+    std::memcpy(d, s, n);
+    22f4:	\--|--|-------> e9 a7 ed ff ff       	jmp    10a0 <memcpy@plt>
+    22f9:	   |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    2300:	   |  \-------> f6 c1 04             	test   $0x4,%cl
+    2303:	   |        /-- 75 25                	jne    232a <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x11a>
+    2305:	   |        |   85 c9                	test   %ecx,%ecx
+    2307:	   +--------|-- 0f 84 6b ff ff ff    	je     2278 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    230d:	   |        |   0f b6 06             	movzbl (%rsi),%eax
+    2310:	   |        |   88 07                	mov    %al,(%rdi)
+    2312:	   |        |   f6 c1 02             	test   $0x2,%cl
+    2315:	   +--------|-- 0f 84 5d ff ff ff    	je     2278 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    231b:	   |        |   0f b7 44 0e fe       	movzwl -0x2(%rsi,%rcx,1),%eax
+    2320:	   |        |   66 89 44 0f fe       	mov    %ax,-0x2(%rdi,%rcx,1)
+    2325:	   +--------|-- e9 4e ff ff ff       	jmp    2278 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    232a:	   |        \-> 8b 06                	mov    (%rsi),%eax
+    232c:	   |            89 07                	mov    %eax,(%rdi)
+    232e:	   |            8b 44 0e fc          	mov    -0x4(%rsi,%rcx,1),%eax
+    2332:	   |            89 44 0f fc          	mov    %eax,-0x4(%rdi,%rcx,1)
+    2336:	   \----------- e9 3d ff ff ff       	jmp    2278 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    233b:	                0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000002340 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    2340:	                                           49 89 f8             	mov    %rdi,%r8
+    2343:	                                           48 89 f1             	mov    %rsi,%rcx
+    if (n < streaming_min) {
+    2346:	                                           48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    234d:	                              /----------- 0f 86 85 03 00 00    	jbe    26d8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x398>
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2353:	                              |            48 89 fe             	mov    %rdi,%rsi
+{
+    2356:	                              |            41 57                	push   %r15
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2358:	                              |            48 f7 de             	neg    %rsi
+{
+    235b:	                              |            41 56                	push   %r14
+    for (Index i = 0; i < head; ++i) {
+    235d:	                              |            48 89 f0             	mov    %rsi,%rax
+{
+    2360:	                              |            41 55                	push   %r13
+    2362:	                              |            41 54                	push   %r12
+    2364:	                              |            55                   	push   %rbp
+    2365:	                              |            53                   	push   %rbx
+    for (Index i = 0; i < head; ++i) {
+    2366:	                              |            83 e0 0f             	and    $0xf,%eax
+    2369:	/-----------------------------|----------- 0f 84 01 01 00 00    	je     2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    236f:	|                             |            48 8d 78 ff          	lea    -0x1(%rax),%rdi
+    2373:	|                             |            48 83 ff 02          	cmp    $0x2,%rdi
+    2377:	|  /--------------------------|----------- 0f 86 8a 04 00 00    	jbe    2807 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4c7>
+    237d:	|  |                          |            4c 8d 51 01          	lea    0x1(%rcx),%r10
+    2381:	|  |                          |            4d 89 c1             	mov    %r8,%r9
+    2384:	|  |                          |            4d 29 d1             	sub    %r10,%r9
+    2387:	|  |                          |            49 83 f9 06          	cmp    $0x6,%r9
+    238b:	|  |                          |  /-------- 0f 87 c7 02 00 00    	ja     2658 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x318>
+        d[i] = p[i];
+    2391:	|  |                          |  |         0f b6 39             	movzbl (%rcx),%edi
+    2394:	|  |                          |  |         41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2397:	|  |                          |  |         40 f6 c6 0e          	test   $0xe,%sil
+    239b:	+--|--------------------------|--|-------- 0f 84 cf 00 00 00    	je     2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    23a1:	|  |                          |  |         0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    23a5:	|  |                          |  |         41 88 78 01          	mov    %dil,0x1(%r8)
+    23a9:	|  |  /-----------------------|--|-------> 0f b6 79 02          	movzbl 0x2(%rcx),%edi
+    23ad:	|  |  |                       |  |         41 88 78 02          	mov    %dil,0x2(%r8)
+    for (Index i = 0; i < head; ++i) {
+    23b1:	|  |  |                       |  |         40 f6 c6 0c          	test   $0xc,%sil
+    23b5:	+--|--|-----------------------|--|-------- 0f 84 b5 00 00 00    	je     2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    23bb:	|  |  |                       |  |         0f b6 79 03          	movzbl 0x3(%rcx),%edi
+    23bf:	|  |  |                       |  |         41 88 78 03          	mov    %dil,0x3(%r8)
+    for (Index i = 0; i < head; ++i) {
+    23c3:	|  |  |                       |  |         48 83 f8 04          	cmp    $0x4,%rax
+    23c7:	+--|--|-----------------------|--|-------- 0f 86 a3 00 00 00    	jbe    2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    23cd:	|  |  |                       |  |         0f b6 79 04          	movzbl 0x4(%rcx),%edi
+    23d1:	|  |  |                       |  |         41 88 78 04          	mov    %dil,0x4(%r8)
+    for (Index i = 0; i < head; ++i) {
+    23d5:	|  |  |                       |  |         48 83 f8 05          	cmp    $0x5,%rax
+    23d9:	+--|--|-----------------------|--|-------- 0f 84 91 00 00 00    	je     2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    23df:	|  |  |                       |  |         0f b6 79 05          	movzbl 0x5(%rcx),%edi
+    23e3:	|  |  |                       |  |         41 88 78 05          	mov    %dil,0x5(%r8)
+    for (Index i = 0; i < head; ++i) {
+    23e7:	|  |  |                       |  |         48 83 f8 06          	cmp    $0x6,%rax
+    23eb:	+--|--|-----------------------|--|-------- 0f 84 7f 00 00 00    	je     2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    23f1:	|  |  |                       |  |         0f b6 79 06          	movzbl 0x6(%rcx),%edi
+    for (Index i = 0; i < head; ++i) {
+    23f5:	|  |  |                       |  |         83 e6 08             	and    $0x8,%esi
+        d[i] = p[i];
+    23f8:	|  |  |                       |  |         41 88 78 06          	mov    %dil,0x6(%r8)
+    for (Index i = 0; i < head; ++i) {
+    23fc:	+--|--|-----------------------|--|-------- 74 72                	je     2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    23fe:	|  |  |                       |  |         0f b6 71 07          	movzbl 0x7(%rcx),%esi
+    2402:	|  |  |                       |  |         41 88 70 07          	mov    %sil,0x7(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2406:	|  |  |                       |  |         48 83 f8 08          	cmp    $0x8,%rax
+    240a:	+--|--|-----------------------|--|-------- 76 64                	jbe    2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    240c:	|  |  |                       |  |         0f b6 71 08          	movzbl 0x8(%rcx),%esi
+    2410:	|  |  |                       |  |         41 88 70 08          	mov    %sil,0x8(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2414:	|  |  |                       |  |         48 83 f8 09          	cmp    $0x9,%rax
+    2418:	+--|--|-----------------------|--|-------- 74 56                	je     2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    241a:	|  |  |                       |  |         0f b6 71 09          	movzbl 0x9(%rcx),%esi
+    241e:	|  |  |                       |  |         41 88 70 09          	mov    %sil,0x9(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2422:	|  |  |                       |  |         48 83 f8 0a          	cmp    $0xa,%rax
+    2426:	+--|--|-----------------------|--|-------- 74 48                	je     2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2428:	|  |  |                       |  |         0f b6 71 0a          	movzbl 0xa(%rcx),%esi
+    242c:	|  |  |                       |  |         41 88 70 0a          	mov    %sil,0xa(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2430:	|  |  |                       |  |         48 83 f8 0b          	cmp    $0xb,%rax
+    2434:	+--|--|-----------------------|--|-------- 74 3a                	je     2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2436:	|  |  |                       |  |         0f b6 71 0b          	movzbl 0xb(%rcx),%esi
+    243a:	|  |  |                       |  |         41 88 70 0b          	mov    %sil,0xb(%r8)
+    for (Index i = 0; i < head; ++i) {
+    243e:	|  |  |                       |  |         48 83 f8 0c          	cmp    $0xc,%rax
+    2442:	+--|--|-----------------------|--|-------- 74 2c                	je     2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2444:	|  |  |                       |  |         0f b6 71 0c          	movzbl 0xc(%rcx),%esi
+    2448:	|  |  |                       |  |         41 88 70 0c          	mov    %sil,0xc(%r8)
+    for (Index i = 0; i < head; ++i) {
+    244c:	|  |  |                       |  |         48 83 f8 0d          	cmp    $0xd,%rax
+    2450:	+--|--|-----------------------|--|-------- 74 1e                	je     2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2452:	|  |  |                       |  |         0f b6 71 0d          	movzbl 0xd(%rcx),%esi
+    2456:	|  |  |                       |  |         41 88 70 0d          	mov    %sil,0xd(%r8)
+    for (Index i = 0; i < head; ++i) {
+    245a:	|  |  |                       |  |         49 8d 70 ff          	lea    -0x1(%r8),%rsi
+    245e:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    2461:	+--|--|-----------------------|--|-------- 75 0d                	jne    2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2463:	|  |  |                       |  |         0f b6 71 0e          	movzbl 0xe(%rcx),%esi
+    2467:	|  |  |                       |  |         41 88 70 0e          	mov    %sil,0xe(%r8)
+    for (Index i = 0; i < head; ++i) {
+    246b:	|  |  |                       |  |         0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+        rotated[i] = p[(head + i) % 16];
+    2470:	>--|--|-----------------------|--|-------> 48 8d 70 07          	lea    0x7(%rax),%rsi
+    2474:	|  |  |                       |  |         4c 8d 78 06          	lea    0x6(%rax),%r15
+    2478:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    247b:	|  |  |                       |  |         4c 8d 70 05          	lea    0x5(%rax),%r14
+    247f:	|  |  |                       |  |         4c 8d 68 04          	lea    0x4(%rax),%r13
+    2483:	|  |  |                       |  |         41 83 e7 0f          	and    $0xf,%r15d
+    std::memcpy(&v, s, sizeof(v));
+    2487:	|  |  |                       |  |         0f b6 34 31          	movzbl (%rcx,%rsi,1),%esi
+        rotated[i] = p[(head + i) % 16];
+    248b:	|  |  |                       |  |         41 83 e6 0f          	and    $0xf,%r14d
+    248f:	|  |  |                       |  |         41 83 e5 0f          	and    $0xf,%r13d
+    2493:	|  |  |                       |  |         4c 8d 60 03          	lea    0x3(%rax),%r12
+    std::memcpy(&v, s, sizeof(v));
+    2497:	|  |  |                       |  |         46 0f b6 3c 39       	movzbl (%rcx,%r15,1),%r15d
+    249c:	|  |  |                       |  |         46 0f b6 34 31       	movzbl (%rcx,%r14,1),%r14d
+        rotated[i] = p[(head + i) % 16];
+    24a1:	|  |  |                       |  |         48 8d 78 08          	lea    0x8(%rax),%rdi
+    24a5:	|  |  |                       |  |         41 83 e4 0f          	and    $0xf,%r12d
+    std::memcpy(&v, s, sizeof(v));
+    24a9:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    24ad:	|  |  |                       |  |         46 0f b6 2c 29       	movzbl (%rcx,%r13,1),%r13d
+        rotated[i] = p[(head + i) % 16];
+    24b2:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    24b5:	|  |  |                       |  |         48 8d 68 02          	lea    0x2(%rax),%rbp
+    std::memcpy(&v, s, sizeof(v));
+    24b9:	|  |  |                       |  |         4c 09 fe             	or     %r15,%rsi
+        rotated[i] = p[(head + i) % 16];
+    24bc:	|  |  |                       |  |         48 89 7c 24 c8       	mov    %rdi,-0x38(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    24c1:	|  |  |                       |  |         46 0f b6 24 21       	movzbl (%rcx,%r12,1),%r12d
+        rotated[i] = p[(head + i) % 16];
+    24c6:	|  |  |                       |  |         83 e5 0f             	and    $0xf,%ebp
+    std::memcpy(&v, s, sizeof(v));
+    24c9:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    24cd:	|  |  |                       |  |         48 8d 78 09          	lea    0x9(%rax),%rdi
+    std::memcpy(&v, s, sizeof(v));
+    24d1:	|  |  |                       |  |         0f b6 2c 29          	movzbl (%rcx,%rbp,1),%ebp
+        rotated[i] = p[(head + i) % 16];
+    24d5:	|  |  |                       |  |         48 8d 58 01          	lea    0x1(%rax),%rbx
+    std::memcpy(&v, s, sizeof(v));
+    24d9:	|  |  |                       |  |         4c 09 f6             	or     %r14,%rsi
+        rotated[i] = p[(head + i) % 16];
+    24dc:	|  |  |                       |  |         49 89 fb             	mov    %rdi,%r11
+    24df:	|  |  |                       |  |         48 8d 78 0a          	lea    0xa(%rax),%rdi
+    24e3:	|  |  |                       |  |         83 e3 0f             	and    $0xf,%ebx
+    std::memcpy(&v, s, sizeof(v));
+    24e6:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    24ea:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    24ee:	|  |  |                       |  |         49 89 fa             	mov    %rdi,%r10
+    std::memcpy(&v, s, sizeof(v));
+    24f1:	|  |  |                       |  |         4c 09 ee             	or     %r13,%rsi
+        rotated[i] = p[(head + i) % 16];
+    24f4:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    24f8:	|  |  |                       |  |         48 8d 78 0b          	lea    0xb(%rax),%rdi
+    24fc:	|  |  |                       |  |         4c 89 5c 24 e0       	mov    %r11,-0x20(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    2501:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    2505:	|  |  |                       |  |         4c 8d 58 0f          	lea    0xf(%rax),%r11
+    2509:	|  |  |                       |  |         4c 89 54 24 e8       	mov    %r10,-0x18(%rsp)
+    250e:	|  |  |                       |  |         49 89 f9             	mov    %rdi,%r9
+    std::memcpy(&v, s, sizeof(v));
+    2511:	|  |  |                       |  |         4c 09 e6             	or     %r12,%rsi
+        rotated[i] = p[(head + i) % 16];
+    2514:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    2518:	|  |  |                       |  |         4c 8d 50 0e          	lea    0xe(%rax),%r10
+    251c:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    2520:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    2524:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    2528:	|  |  |                       |  |         4c 89 4c 24 f0       	mov    %r9,-0x10(%rsp)
+    252d:	|  |  |                       |  |         4c 8d 48 0d          	lea    0xd(%rax),%r9
+    std::memcpy(&v, s, sizeof(v));
+    2531:	|  |  |                       |  |         48 09 ee             	or     %rbp,%rsi
+    2534:	|  |  |                       |  |         0f b6 2c 19          	movzbl (%rcx,%rbx,1),%ebp
+    2538:	|  |  |                       |  |         46 0f b6 14 11       	movzbl (%rcx,%r10,1),%r10d
+        rotated[i] = p[(head + i) % 16];
+    253d:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    2541:	|  |  |                       |  |         48 89 f3             	mov    %rsi,%rbx
+    2544:	|  |  |                       |  |         42 0f b6 34 19       	movzbl (%rcx,%r11,1),%esi
+    2549:	|  |  |                       |  |         46 0f b6 0c 09       	movzbl (%rcx,%r9,1),%r9d
+        rotated[i] = p[(head + i) % 16];
+    254e:	|  |  |                       |  |         48 8d 78 0c          	lea    0xc(%rax),%rdi
+    2552:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    std::memcpy(&v, s, sizeof(v));
+    2555:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    2559:	|  |  |                       |  |         4c 8b 5c 24 e0       	mov    -0x20(%rsp),%r11
+    255e:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2562:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    2565:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    2569:	|  |  |                       |  |         0f b6 2c 01          	movzbl (%rcx,%rax,1),%ebp
+    256d:	|  |  |                       |  |         4c 09 d6             	or     %r10,%rsi
+    2570:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    2574:	|  |  |                       |  |         4c 8b 54 24 e8       	mov    -0x18(%rsp),%r10
+    2579:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    257d:	|  |  |                       |  |         4c 09 ce             	or     %r9,%rsi
+    2580:	|  |  |                       |  |         4c 8b 4c 24 f0       	mov    -0x10(%rsp),%r9
+    2585:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2589:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    258c:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    258f:	|  |  |                       |  |         42 0f b6 3c 09       	movzbl (%rcx,%r9,1),%edi
+    2594:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2598:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    259b:	|  |  |                       |  |         42 0f b6 3c 11       	movzbl (%rcx,%r10,1),%edi
+    25a0:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    25a4:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    25a7:	|  |  |                       |  |         42 0f b6 3c 19       	movzbl (%rcx,%r11,1),%edi
+    25ac:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    25b0:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    25b3:	|  |  |                       |  |         48 8b 7c 24 c8       	mov    -0x38(%rsp),%rdi
+    25b8:	|  |  |                       |  |         48 89 5c 24 c8       	mov    %rbx,-0x38(%rsp)
+    25bd:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    25c1:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    25c5:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    25c8:	|  |  |                       |  |         48 8d 78 40          	lea    0x40(%rax),%rdi
+    25cc:	|  |  |                       |  |         4c 01 c0             	add    %r8,%rax
+    std::memcpy(&v, s, sizeof(v));
+    25cf:	|  |  |                       |  |         48 89 74 24 d0       	mov    %rsi,-0x30(%rsp)
+    25d4:	|  |  |                       |  |         66 0f 6f 44 24 c8    	movdqa -0x38(%rsp),%xmm0
+    for (; i + 64 <= n; i += 64) {
+    25da:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    25e0:	|  |  |                       |  |     /-> 48 89 fe             	mov    %rdi,%rsi
+    for (; i + 64 <= n; i += 64) {
+    25e3:	|  |  |                       |  |     |   48 83 c7 40          	add    $0x40,%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    25e7:	|  |  |                       |  |     |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    25eb:	|  |  |                       |  |     |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    25f0:	|  |  |                       |  |     |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    25f5:	|  |  |                       |  |     |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    25fa:	|  |  |                       |  |     |   48 83 c0 40          	add    $0x40,%rax
+    25fe:	|  |  |                       |  |     |   48 39 fa             	cmp    %rdi,%rdx
+    2601:	|  |  |                       |  |     \-- 73 dd                	jae    25e0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2a0>
+        stream16(d + i, v);
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+    2603:	|  |  |                       |  |         48 8d 46 10          	lea    0x10(%rsi),%rax
+    2607:	|  |  |                       |  |         48 39 c2             	cmp    %rax,%rdx
+    260a:	|  |  |                       |  |  /----- 72 15                	jb     2621 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2e1>
+    260c:	|  |  |                       |  |  |      49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2610:	|  |  |                       |  |  |  /-> 48 89 c6             	mov    %rax,%rsi
+    2613:	|  |  |                       |  |  |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    2618:	|  |  |                       |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    261c:	|  |  |                       |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    261f:	|  |  |                       |  |  |  \-- 73 ef                	jae    2610 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2d0>
+        stream16(d + i, v);
+    }
+    __builtin_ia32_sfence();
+    2621:	|  |  |                       |  |  \----> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    2624:	|  |  |                       |  |         48 39 d6             	cmp    %rdx,%rsi
+    2627:	|  |  |                       |  |  /----- 73 1e                	jae    2647 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x307>
+    2629:	|  |  |                       |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        d[i] = p[i % 16];
+    2630:	|  |  |                       |  |  |  /-> 48 89 f0             	mov    %rsi,%rax
+    2633:	|  |  |                       |  |  |  |   83 e0 0f             	and    $0xf,%eax
+    2636:	|  |  |                       |  |  |  |   0f b6 04 01          	movzbl (%rcx,%rax,1),%eax
+    263a:	|  |  |                       |  |  |  |   41 88 04 30          	mov    %al,(%r8,%rsi,1)
+    for (; i < n; ++i) {
+    263e:	|  |  |                       |  |  |  |   48 83 c6 01          	add    $0x1,%rsi
+    2642:	|  |  |                       |  |  |  |   48 39 f2             	cmp    %rsi,%rdx
+    2645:	|  |  |                       |  |  |  \-- 75 e9                	jne    2630 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2f0>
+    }
+}
+    2647:	|  |  |                       |  |  \----> 5b                   	pop    %rbx
+    2648:	|  |  |                       |  |         5d                   	pop    %rbp
+    2649:	|  |  |                       |  |         41 5c                	pop    %r12
+    264b:	|  |  |                       |  |         41 5d                	pop    %r13
+    264d:	|  |  |                       |  |         41 5e                	pop    %r14
+    264f:	|  |  |                       |  |         41 5f                	pop    %r15
+    2651:	|  |  |                       |  |         c3                   	ret
+    2652:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    2658:	|  |  |                       |  \-------> 48 83 ff 06          	cmp    $0x6,%rdi
+    265c:	|  |  |  /--------------------|----------- 0f 86 e1 01 00 00    	jbe    2843 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x503>
+        d[i] = p[i];
+    2662:	|  |  |  |                    |            48 8b 31             	mov    (%rcx),%rsi
+    2665:	|  |  |  |                    |            49 89 30             	mov    %rsi,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2668:	|  |  |  |                    |            48 83 f8 08          	cmp    $0x8,%rax
+    266c:	+--|--|--|--------------------|----------- 0f 84 fe fd ff ff    	je     2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    2672:	|  |  |  |                    |            48 8d 70 f7          	lea    -0x9(%rax),%rsi
+    2676:	|  |  |  |                    |            4c 8d 48 f8          	lea    -0x8(%rax),%r9
+    267a:	|  |  |  |                    |            48 83 fe 02          	cmp    $0x2,%rsi
+    267e:	|  |  |  |                    |            be 08 00 00 00       	mov    $0x8,%esi
+    2683:	|  |  |  |                    |        /-- 76 15                	jbe    269a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x35a>
+        d[i] = p[i];
+    2685:	|  |  |  |  /-----------------|--------|-> 8b 3c 31             	mov    (%rcx,%rsi,1),%edi
+    2688:	|  |  |  |  |                 |        |   41 89 3c 30          	mov    %edi,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    268c:	|  |  |  |  |                 |        |   48 83 c6 04          	add    $0x4,%rsi
+    2690:	|  |  |  |  |                 |        |   49 83 f9 04          	cmp    $0x4,%r9
+    2694:	+--|--|--|--|-----------------|--------|-- 0f 84 d6 fd ff ff    	je     2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    269a:	|  |  |  |  |                 |        \-> 0f b6 3c 31          	movzbl (%rcx,%rsi,1),%edi
+    269e:	|  |  |  |  |                 |            41 88 3c 30          	mov    %dil,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    26a2:	|  |  |  |  |                 |            48 8d 7e 01          	lea    0x1(%rsi),%rdi
+    26a6:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    26a9:	+--|--|--|--|-----------------|----------- 0f 83 c1 fd ff ff    	jae    2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    26af:	|  |  |  |  |                 |            0f b6 7c 31 01       	movzbl 0x1(%rcx,%rsi,1),%edi
+    26b4:	|  |  |  |  |                 |            41 88 7c 30 01       	mov    %dil,0x1(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    26b9:	|  |  |  |  |                 |            48 8d 7e 02          	lea    0x2(%rsi),%rdi
+    26bd:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    26c0:	+--|--|--|--|-----------------|----------- 0f 83 aa fd ff ff    	jae    2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    26c6:	|  |  |  |  |                 |            0f b6 7c 31 02       	movzbl 0x2(%rcx,%rsi,1),%edi
+    26cb:	|  |  |  |  |                 |            41 88 7c 30 02       	mov    %dil,0x2(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    26d0:	+--|--|--|--|-----------------|----------- e9 9b fd ff ff       	jmp    2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    26d5:	|  |  |  |  |                 |            0f 1f 00             	nopl   (%rax)
+    Length done = (n < 16) ? n : 16;
+    26d8:	|  |  |  |  |                 \----------> 41 ba 10 00 00 00    	mov    $0x10,%r10d
+    26de:	|  |  |  |  |                              4c 39 d2             	cmp    %r10,%rdx
+    26e1:	|  |  |  |  |                              4c 0f 46 d2          	cmovbe %rdx,%r10
+    std::memcpy(d, s, n);
+    26e5:	|  |  |  |  |                              44 89 d0             	mov    %r10d,%eax
+    26e8:	|  |  |  |  |                              41 83 fa 08          	cmp    $0x8,%r10d
+    26ec:	|  |  |  |  |        /-------------------- 0f 82 cc 00 00 00    	jb     27be <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47e>
+    26f2:	|  |  |  |  |        |                     48 8b 06             	mov    (%rsi),%rax
+    26f5:	|  |  |  |  |        |                     4c 8d 4f 08          	lea    0x8(%rdi),%r9
+    26f9:	|  |  |  |  |        |                     49 83 e1 f8          	and    $0xfffffffffffffff8,%r9
+    26fd:	|  |  |  |  |        |                     48 89 07             	mov    %rax,(%rdi)
+    2700:	|  |  |  |  |        |                     44 89 d0             	mov    %r10d,%eax
+    2703:	|  |  |  |  |        |                     48 8b 74 06 f8       	mov    -0x8(%rsi,%rax,1),%rsi
+    2708:	|  |  |  |  |        |                     48 89 74 07 f8       	mov    %rsi,-0x8(%rdi,%rax,1)
+    270d:	|  |  |  |  |        |                     48 89 f8             	mov    %rdi,%rax
+    2710:	|  |  |  |  |        |                     4c 29 c8             	sub    %r9,%rax
+    2713:	|  |  |  |  |        |                     48 29 c1             	sub    %rax,%rcx
+    2716:	|  |  |  |  |        |                     44 01 d0             	add    %r10d,%eax
+    2719:	|  |  |  |  |        |                     83 e0 f8             	and    $0xfffffff8,%eax
+    271c:	|  |  |  |  |        |                     83 f8 08             	cmp    $0x8,%eax
+    271f:	|  |  |  |  |  /-----|-------------------- 72 16                	jb     2737 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    2721:	|  |  |  |  |  |     |                     83 e0 f8             	and    $0xfffffff8,%eax
+    2724:	|  |  |  |  |  |     |                     31 f6                	xor    %esi,%esi
+    2726:	|  |  |  |  |  |     |                 /-> 89 f7                	mov    %esi,%edi
+    2728:	|  |  |  |  |  |     |                 |   83 c6 08             	add    $0x8,%esi
+    272b:	|  |  |  |  |  |     |                 |   4c 8b 1c 39          	mov    (%rcx,%rdi,1),%r11
+    272f:	|  |  |  |  |  |     |                 |   4d 89 1c 39          	mov    %r11,(%r9,%rdi,1)
+    2733:	|  |  |  |  |  |     |                 |   39 c6                	cmp    %eax,%esi
+    2735:	|  |  |  |  |  |     |                 \-- 72 ef                	jb     2726 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3e6>
+    while (done < n) {
+    2737:	|  |  |  |  |  >-----|-------------------> 49 39 d2             	cmp    %rdx,%r10
+    273a:	|  |  |  |  |  |     |           /-------- 72 33                	jb     276f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    273c:	|  |  |  |  |  |     |     /-----|-------- e9 af 00 00 00       	jmp    27f0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b0>
+    2741:	|  |  |  |  |  |     |     |     |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    std::memcpy(d, s, n);
+    2748:	|  |  |  |  |  |     |     |     |     /-> 41 f6 c1 04          	test   $0x4,%r9b
+    274c:	|  |  |  |  |  |     |     |  /--|-----|-- 0f 85 9f 00 00 00    	jne    27f1 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b1>
+    2752:	|  |  |  |  |  |     |     |  |  |     |   45 85 c9             	test   %r9d,%r9d
+    2755:	|  |  |  |  |  |  /--|-----|--|--|-----|-- 74 10                	je     2767 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    2757:	|  |  |  |  |  |  |  |     |  |  |     |   41 0f b6 08          	movzbl (%r8),%ecx
+    275b:	|  |  |  |  |  |  |  |     |  |  |     |   88 08                	mov    %cl,(%rax)
+    275d:	|  |  |  |  |  |  |  |     |  |  |     |   41 f6 c1 02          	test   $0x2,%r9b
+    2761:	|  |  |  |  |  |  |  |  /--|--|--|-----|-- 0f 85 c9 00 00 00    	jne    2830 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4f0>
+        done += m;
+    2767:	|  |  |  |  |  |  >--|--|--|--|--|-----|-> 4d 01 ca             	add    %r9,%r10
+    while (done < n) {
+    276a:	|  |  |  |  |  |  |  |  |  |  |  |     |   49 39 d2             	cmp    %rdx,%r10
+    276d:	|  |  |  |  |  |  |  |  |  |  |  |  /--|-- 73 4e                	jae    27bd <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47d>
+        Length const m = (done < n - done) ? done : n - done;
+    276f:	|  |  |  |  |  |  |  |  |  |  |  >--|--|-> 49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    2772:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4b 8d 04 10          	lea    (%r8,%r10,1),%rax
+        Length const m = (done < n - done) ? done : n - done;
+    2776:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 29 d1             	sub    %r10,%r9
+    2779:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 39 d1             	cmp    %r10,%r9
+    277c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 0f 47 ca          	cmova  %r10,%r9
+    std::memcpy(d, s, n);
+    2780:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   41 83 f9 08          	cmp    $0x8,%r9d
+    2784:	|  |  |  |  |  |  |  |  |  |  |  |  |  \-- 72 c2                	jb     2748 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x408>
+    2786:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 08             	mov    (%r8),%rcx
+    2789:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 78 08          	lea    0x8(%rax),%rdi
+        done += m;
+    278d:	|  |  |  |  |  |  |  |  |  |  |  |  |      4d 01 ca             	add    %r9,%r10
+    std::memcpy(d, s, n);
+    2790:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 83 e7 f8          	and    $0xfffffffffffffff8,%rdi
+    2794:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 08             	mov    %rcx,(%rax)
+    2797:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 89 c9             	mov    %r9d,%ecx
+    279a:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 74 08 f8       	mov    -0x8(%r8,%rcx,1),%rsi
+    279f:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 74 08 f8       	mov    %rsi,-0x8(%rax,%rcx,1)
+    27a4:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 f8             	sub    %rdi,%rax
+    27a7:	|  |  |  |  |  |  |  |  |  |  |  |  |      4c 89 c6             	mov    %r8,%rsi
+    27aa:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 c6             	sub    %rax,%rsi
+    27ad:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 01 c8             	add    %r9d,%eax
+    27b0:	|  |  |  |  |  |  |  |  |  |  |  |  |      c1 e8 03             	shr    $0x3,%eax
+    27b3:	|  |  |  |  |  |  |  |  |  |  |  |  |      89 c1                	mov    %eax,%ecx
+    27b5:	|  |  |  |  |  |  |  |  |  |  |  |  |      f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    27b8:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 39 d2             	cmp    %rdx,%r10
+    27bb:	|  |  |  |  |  |  |  |  |  |  |  \--|----- 72 b2                	jb     276f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    27bd:	|  |  |  |  |  |  |  |  |  |  |     \----> c3                   	ret
+    std::memcpy(d, s, n);
+    27be:	|  |  |  |  |  |  |  \--|--|--|----------> 41 f6 c2 04          	test   $0x4,%r10b
+    27c2:	|  |  |  |  |  |  |     |  |  |        /-- 0f 85 85 00 00 00    	jne    284d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x50d>
+    27c8:	|  |  |  |  |  |  |     |  |  |        |   85 c0                	test   %eax,%eax
+    27ca:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 67 ff ff ff    	je     2737 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    27d0:	|  |  |  |  |  |  |     |  |  |        |   0f b6 36             	movzbl (%rsi),%esi
+    27d3:	|  |  |  |  |  |  |     |  |  |        |   40 88 37             	mov    %sil,(%rdi)
+    27d6:	|  |  |  |  |  |  |     |  |  |        |   a8 02                	test   $0x2,%al
+    27d8:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 59 ff ff ff    	je     2737 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    27de:	|  |  |  |  |  |  |     |  |  |        |   0f b7 4c 01 fe       	movzwl -0x2(%rcx,%rax,1),%ecx
+    27e3:	|  |  |  |  |  |  |     |  |  |        |   66 89 4c 07 fe       	mov    %cx,-0x2(%rdi,%rax,1)
+    27e8:	|  |  |  |  |  +--|-----|--|--|--------|-- e9 4a ff ff ff       	jmp    2737 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    27ed:	|  |  |  |  |  |  |     |  |  |        |   0f 1f 00             	nopl   (%rax)
+    27f0:	|  |  |  |  |  |  |     |  \--|--------|-> c3                   	ret
+    27f1:	|  |  |  |  |  |  |     |     \--------|-> 41 8b 08             	mov    (%r8),%ecx
+    27f4:	|  |  |  |  |  |  |     |              |   89 08                	mov    %ecx,(%rax)
+    27f6:	|  |  |  |  |  |  |     |              |   44 89 c9             	mov    %r9d,%ecx
+    27f9:	|  |  |  |  |  |  |     |              |   41 8b 74 08 fc       	mov    -0x4(%r8,%rcx,1),%esi
+    27fe:	|  |  |  |  |  |  |     |              |   89 74 08 fc          	mov    %esi,-0x4(%rax,%rcx,1)
+    2802:	|  |  |  |  |  |  +-----|--------------|-- e9 60 ff ff ff       	jmp    2767 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+        d[i] = p[i];
+    2807:	|  \--|--|--|--|--|-----|--------------|-> 0f b6 39             	movzbl (%rcx),%edi
+    280a:	|     |  |  |  |  |     |              |   41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    280d:	|     |  |  |  |  |     |              |   40 f6 c6 0e          	test   $0xe,%sil
+    2811:	+-----|--|--|--|--|-----|--------------|-- 0f 84 59 fc ff ff    	je     2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2817:	|     |  |  |  |  |     |              |   0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    281b:	|     |  |  |  |  |     |              |   41 88 78 01          	mov    %dil,0x1(%r8)
+    for (Index i = 0; i < head; ++i) {
+    281f:	|     |  |  |  |  |     |              |   48 83 f8 03          	cmp    $0x3,%rax
+    2823:	\-----|--|--|--|--|-----|--------------|-- 0f 85 47 fc ff ff    	jne    2470 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    2829:	      \--|--|--|--|-----|--------------|-- e9 7b fb ff ff       	jmp    23a9 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x69>
+    282e:	         |  |  |  |     |              |   66 90                	xchg   %ax,%ax
+    std::memcpy(d, s, n);
+    2830:	         |  |  |  |     \--------------|-> 44 89 c9             	mov    %r9d,%ecx
+    2833:	         |  |  |  |                    |   41 0f b7 74 08 fe    	movzwl -0x2(%r8,%rcx,1),%esi
+    2839:	         |  |  |  |                    |   66 89 74 08 fe       	mov    %si,-0x2(%rax,%rcx,1)
+    283e:	         |  |  |  \--------------------|-- e9 24 ff ff ff       	jmp    2767 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    for (Index i = 0; i < head; ++i) {
+    2843:	         \--|--|-----------------------|-> 49 89 c1             	mov    %rax,%r9
+    2846:	            |  |                       |   31 f6                	xor    %esi,%esi
+    2848:	            \--|-----------------------|-- e9 38 fe ff ff       	jmp    2685 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x345>
+    std::memcpy(d, s, n);
+    284d:	               |                       \-> 8b 36                	mov    (%rsi),%esi
+    284f:	               |                           89 37                	mov    %esi,(%rdi)
+    2851:	               |                           8b 4c 01 fc          	mov    -0x4(%rcx,%rax,1),%ecx
+    2855:	               |                           89 4c 07 fc          	mov    %ecx,-0x4(%rdi,%rax,1)
+    2859:	               \-------------------------- e9 d9 fe ff ff       	jmp    2737 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    285e:	                                           66 90                	xchg   %ax,%ax
+
+0000000000002860 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    2860:	    48 85 ff             	test   %rdi,%rdi
+    2863:	/-- 74 0b                	je     2870 <nel::free_aligned(void*)+0x10>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    2865:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    2869:	|   e9 c2 e7 ff ff       	jmp    1030 <free@plt>
+    286e:	|   66 90                	xchg   %ax,%ax
+}
+    2870:	\-> c3                   	ret
+    2871:	    66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2878:	    00 00 00 00 
+    287c:	    0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002880 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    2880:	                   41 56                	push   %r14
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    2882:	                   48 8d 05 08 08 00 00 	lea    0x808(%rip),%rax        # 3091 <_IO_stdin_used+0x91>
+    2889:	                   41 55                	push   %r13
+    288b:	                   66 48 0f 6e c8       	movq   %rax,%xmm1
+    2890:	                   41 54                	push   %r12
+    2892:	                   55                   	push   %rbp
+    2893:	                   48 89 cd             	mov    %rcx,%rbp
+    2896:	                   48 8d 0d e4 07 00 00 	lea    0x7e4(%rip),%rcx        # 3081 <_IO_stdin_used+0x81>
+    289d:	                   53                   	push   %rbx
+    289e:	                   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    28a3:	                   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    28a7:	                   48 83 ec 20          	sub    $0x20,%rsp
+            , file_name_(file_name)
+            , line_num_(line_num)
+    28ab:	                   c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    28b2:	                   00 
+            : fn_name_(fn_name)
+    28b3:	                   0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    28b7:	                   48 85 f6             	test   %rsi,%rsi
+    28ba:	/----------------- 0f 84 a0 00 00 00    	je     2960 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    28c0:	|                  48 8d 46 ff          	lea    -0x1(%rsi),%rax
+    28c4:	|                  48 89 f3             	mov    %rsi,%rbx
+    28c7:	|                  48 85 f0             	test   %rsi,%rax
+    28ca:	+----------------- 0f 85 90 00 00 00    	jne    2960 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    28d0:	|                  48 8d 34 2e          	lea    (%rsi,%rbp,1),%rsi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    28d4:	|                  48 85 ff             	test   %rdi,%rdi
+    28d7:	|     /----------- 74 67                	je     2940 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xc0>
+    28d9:	|     |            4c 8b 6f f8          	mov    -0x8(%rdi),%r13
+    uint8_t *const new_base =
+    28dd:	|     |            49 89 d4             	mov    %rdx,%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    28e0:	|     |            4c 29 ef             	sub    %r13,%rdi
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    28e3:	|     |            e8 d8 e7 ff ff       	call   10c0 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    28e8:	|     |            48 85 c0             	test   %rax,%rax
+    28eb:	|  /--|----------- 0f 84 7e 00 00 00    	je     296f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    28f1:	|  |  |            48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    28f6:	|  |  |            48 f7 db             	neg    %rbx
+    28f9:	|  |  |            48 21 cb             	and    %rcx,%rbx
+    28fc:	|  |  |            49 89 de             	mov    %rbx,%r14
+    28ff:	|  |  |            49 29 c6             	sub    %rax,%r14
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    2902:	|  |  |            4d 39 f5             	cmp    %r14,%r13
+    2905:	|  |  |        /-- 75 19                	jne    2920 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xa0>
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    }
+    offset_field(new_p) = new_offset;
+    2907:	|  |  |     /--|-> 4c 89 73 f8          	mov    %r14,-0x8(%rbx)
+    return new_p;
+}
+    290b:	|  |  |  /--|--|-> 48 83 c4 20          	add    $0x20,%rsp
+    290f:	|  |  |  |  |  |   48 89 d8             	mov    %rbx,%rax
+    2912:	|  |  |  |  |  |   5b                   	pop    %rbx
+    2913:	|  |  |  |  |  |   5d                   	pop    %rbp
+    2914:	|  |  |  |  |  |   41 5c                	pop    %r12
+    2916:	|  |  |  |  |  |   41 5d                	pop    %r13
+    2918:	|  |  |  |  |  |   41 5e                	pop    %r14
+    291a:	|  |  |  |  |  |   c3                   	ret
+    291b:	|  |  |  |  |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        std::memmove(new_p, new_base + old_offset, n);
+    2920:	|  |  |  |  |  \-> 4c 39 e5             	cmp    %r12,%rbp
+    2923:	|  |  |  |  |      4c 89 e2             	mov    %r12,%rdx
+    2926:	|  |  |  |  |      4a 8d 34 28          	lea    (%rax,%r13,1),%rsi
+    292a:	|  |  |  |  |      48 89 df             	mov    %rbx,%rdi
+    292d:	|  |  |  |  |      48 0f 46 d5          	cmovbe %rbp,%rdx
+    2931:	|  |  |  |  |      e8 9a e7 ff ff       	call   10d0 <memmove@plt>
+    2936:	|  |  |  |  +----- eb cf                	jmp    2907 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+    2938:	|  |  |  |  |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    293f:	|  |  |  |  |      00 
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2940:	|  |  \--|--|----> 48 89 f7             	mov    %rsi,%rdi
+    2943:	|  |     |  |      e8 68 e7 ff ff       	call   10b0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    2948:	|  |     |  |      48 85 c0             	test   %rax,%rax
+    294b:	|  +-----|--|----- 74 22                	je     296f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    294d:	|  |     |  |      48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    2952:	|  |     |  |      48 f7 db             	neg    %rbx
+    2955:	|  |     |  |      48 21 d3             	and    %rdx,%rbx
+    2958:	|  |     |  |      49 89 de             	mov    %rbx,%r14
+    295b:	|  |     |  |      49 29 c6             	sub    %rax,%r14
+    if (old_p != nullptr && new_offset != old_offset) {
+    295e:	|  |     |  \----- eb a7                	jmp    2907 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    2960:	\--|-----|-------> 48 89 e6             	mov    %rsp,%rsi
+    2963:	   |     |         48 8d 3d 39 07 00 00 	lea    0x739(%rip),%rdi        # 30a3 <_IO_stdin_used+0xa3>
+    296a:	   |     |         e8 e3 e7 ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    if (new_base == nullptr) { return nullptr; }
+    296f:	   \-----|-------> 31 db                	xor    %ebx,%ebx
+    2971:	         \-------- eb 98                	jmp    290b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x8b>
+    2973:	                   66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    297a:	                   00 00 00 00 
+    297e:	                   66 90                	xchg   %ax,%ax
+
+0000000000002980 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    2980:	       53                   	push   %rbx
+            : fn_name_(fn_name)
+    2981:	       48 8d 05 09 07 00 00 	lea    0x709(%rip),%rax        # 3091 <_IO_stdin_used+0x91>
+    2988:	       48 8d 0d f2 06 00 00 	lea    0x6f2(%rip),%rcx        # 3081 <_IO_stdin_used+0x81>
+    298f:	       66 48 0f 6e c1       	movq   %rcx,%xmm0
+    2994:	       66 48 0f 6e c8       	movq   %rax,%xmm1
+    2999:	       66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    299d:	       48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    29a1:	       c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    29a8:	       00 
+            : fn_name_(fn_name)
+    29a9:	       0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    29ad:	       48 85 ff             	test   %rdi,%rdi
+    29b0:	/----- 74 35                	je     29e7 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+    29b2:	|      48 8d 47 ff          	lea    -0x1(%rdi),%rax
+    29b6:	|      48 89 fb             	mov    %rdi,%rbx
+    29b9:	|      48 85 f8             	test   %rdi,%rax
+    29bc:	+----- 75 29                	jne    29e7 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    29be:	|      48 8d 3c 37          	lea    (%rdi,%rsi,1),%rdi
+    29c2:	|      e8 e9 e6 ff ff       	call   10b0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    29c7:	|      48 85 c0             	test   %rax,%rax
+    29ca:	|  /-- 74 15                	je     29e1 <nel::malloc_aligned(unsigned long, unsigned long)+0x61>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    29cc:	|  |   48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    29d1:	|  |   48 f7 db             	neg    %rbx
+    29d4:	|  |   48 21 da             	and    %rbx,%rdx
+    29d7:	|  |   48 29 c2             	sub    %rax,%rdx
+    uint8_t *const new_p = new_base + new_offset;
+    29da:	|  |   48 01 d0             	add    %rdx,%rax
+    offset_field(new_p) = new_offset;
+    29dd:	|  |   48 89 50 f8          	mov    %rdx,-0x8(%rax)
+    return realloc_aligned(nullptr, align, 0, size);
+}
+    29e1:	|  \-> 48 83 c4 20          	add    $0x20,%rsp
+    29e5:	|      5b                   	pop    %rbx
+    29e6:	|      c3                   	ret
+    if (!pred) { assert_fail(msg, ctx); }
+    29e7:	\----> 48 89 e6             	mov    %rsp,%rsi
+    29ea:	       48 8d 3d b2 06 00 00 	lea    0x6b2(%rip),%rdi        # 30a3 <_IO_stdin_used+0xa3>
+    29f1:	       e8 5c e7 ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    29f6:	       66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    29fd:	       00 00 00 
+
+0000000000002a00 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    2a00:	53                   	push   %rbx
+    2a01:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    2a04:	40 0f be fe          	movsbl %sil,%edi
+    2a08:	48 8b 35 71 26 00 00 	mov    0x2671(%rip),%rsi        # 5080 <stderr@GLIBC_2.2.5>
+    2a0f:	e8 5c e6 ff ff       	call   1070 <fputc@plt>
+    return outs;
+}
+    2a14:	48 89 d8             	mov    %rbx,%rax
+    2a17:	5b                   	pop    %rbx
+    2a18:	c3                   	ret
+    2a19:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002a20 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    2a20:	53                   	push   %rbx
+    2a21:	48 89 fb             	mov    %rdi,%rbx
+    2a24:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    2a27:	48 8b 35 52 26 00 00 	mov    0x2652(%rip),%rsi        # 5080 <stderr@GLIBC_2.2.5>
+    2a2e:	e8 1d e6 ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    2a33:	48 89 d8             	mov    %rbx,%rax
+    2a36:	5b                   	pop    %rbx
+    2a37:	c3                   	ret
+    2a38:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    2a3f:	00 
+
+0000000000002a40 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    2a40:	53                   	push   %rbx
+    2a41:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    2a44:	48 8b 3d 35 26 00 00 	mov    0x2635(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    2a4b:	40 0f b6 d6          	movzbl %sil,%edx
+    2a4f:	31 c0                	xor    %eax,%eax
+    2a51:	48 8d 35 66 06 00 00 	lea    0x666(%rip),%rsi        # 30be <_IO_stdin_used+0xbe>
+    2a58:	e8 33 e6 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2a5d:	48 89 d8             	mov    %rbx,%rax
+    2a60:	5b                   	pop    %rbx
+    2a61:	c3                   	ret
+    2a62:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2a69:	00 00 00 00 
+    2a6d:	0f 1f 00             	nopl   (%rax)
+
+0000000000002a70 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    2a70:	53                   	push   %rbx
+    2a71:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    2a74:	48 8b 3d 05 26 00 00 	mov    0x2605(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    2a7b:	0f b7 d6             	movzwl %si,%edx
+    2a7e:	31 c0                	xor    %eax,%eax
+    2a80:	48 8d 35 37 06 00 00 	lea    0x637(%rip),%rsi        # 30be <_IO_stdin_used+0xbe>
+    2a87:	e8 04 e6 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2a8c:	48 89 d8             	mov    %rbx,%rax
+    2a8f:	5b                   	pop    %rbx
+    2a90:	c3                   	ret
+    2a91:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2a98:	00 00 00 00 
+    2a9c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002aa0 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    2aa0:	53                   	push   %rbx
+    2aa1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    2aa4:	48 8b 3d d5 25 00 00 	mov    0x25d5(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    2aab:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    2aad:	31 c0                	xor    %eax,%eax
+    2aaf:	48 8d 35 08 06 00 00 	lea    0x608(%rip),%rsi        # 30be <_IO_stdin_used+0xbe>
+    2ab6:	e8 d5 e5 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2abb:	48 89 d8             	mov    %rbx,%rax
+    2abe:	5b                   	pop    %rbx
+    2abf:	c3                   	ret
+
+0000000000002ac0 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    2ac0:	53                   	push   %rbx
+    2ac1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    2ac4:	48 8b 3d b5 25 00 00 	mov    0x25b5(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    2acb:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    2acd:	31 c0                	xor    %eax,%eax
+    2acf:	48 8d 35 e8 05 00 00 	lea    0x5e8(%rip),%rsi        # 30be <_IO_stdin_used+0xbe>
+    2ad6:	e8 b5 e5 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2adb:	48 89 d8             	mov    %rbx,%rax
+    2ade:	5b                   	pop    %rbx
+    2adf:	c3                   	ret
+
+0000000000002ae0 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    2ae0:	53                   	push   %rbx
+    2ae1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    2ae4:	48 8b 3d 95 25 00 00 	mov    0x2595(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    2aeb:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    2aee:	31 c0                	xor    %eax,%eax
+    2af0:	48 8d 35 ca 05 00 00 	lea    0x5ca(%rip),%rsi        # 30c1 <_IO_stdin_used+0xc1>
+    2af7:	e8 94 e5 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2afc:	48 89 d8             	mov    %rbx,%rax
+    2aff:	5b                   	pop    %rbx
+    2b00:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000002b04 <_fini>:
+    2b04:	48 83 ec 08          	sub    $0x8,%rsp
+    2b08:	48 83 c4 08          	add    $0x8,%rsp
+    2b0c:	c3                   	ret
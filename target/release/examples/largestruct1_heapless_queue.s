@@ -0,0 +1,2772 @@
+
+target/release/examples/largestruct1_heapless_queue:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 3f 00 00 	mov    0x3fc5(%rip),%rax        # 4fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 3f 00 00    	push   0x3fca(%rip)        # 4ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 3f 00 00    	jmp    *0x3fcc(%rip)        # 4ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 3f 00 00    	jmp    *0x3fca(%rip)        # 5000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 3f 00 00    	jmp    *0x3fc2(%rip)        # 5008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 3f 00 00    	jmp    *0x3fba(%rip)        # 5010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memset@plt>:
+    1060:	ff 25 b2 3f 00 00    	jmp    *0x3fb2(%rip)        # 5018 <memset@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 3f 00 00    	jmp    *0x3faa(%rip)        # 5020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 3f 00 00    	jmp    *0x3fa2(%rip)        # 5028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 3f 00 00    	jmp    *0x3f9a(%rip)        # 5030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcpy@plt>:
+    10a0:	ff 25 92 3f 00 00    	jmp    *0x3f92(%rip)        # 5038 <memcpy@GLIBC_2.14>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <malloc@plt>:
+    10b0:	ff 25 8a 3f 00 00    	jmp    *0x3f8a(%rip)        # 5040 <malloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <realloc@plt>:
+    10c0:	ff 25 82 3f 00 00    	jmp    *0x3f82(%rip)        # 5048 <realloc@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <memmove@plt>:
+    10d0:	ff 25 7a 3f 00 00    	jmp    *0x3f7a(%rip)        # 5050 <memmove@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010e0 <__cxa_finalize@plt>:
+    10e0:	ff 25 fa 3e 00 00    	jmp    *0x3efa(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10e6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010f0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10f0:	50                   	push   %rax
+    std::abort();
+    10f1:	e8 4a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010f6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10f6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10f7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10fa:	4c 8d 0d 92 1f 00 00 	lea    0x1f92(%rip),%r9        # 3093 <_IO_stdin_used+0x93>
+    1101:	31 c0                	xor    %eax,%eax
+    1103:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    1107:	4c 8b 07             	mov    (%rdi),%r8
+    110a:	48 8d 35 88 1f 00 00 	lea    0x1f88(%rip),%rsi        # 3099 <_IO_stdin_used+0x99>
+    1111:	48 8b 3d 68 3f 00 00 	mov    0x3f68(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1118:	e8 73 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    111d:	e8 1e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001122 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1122:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1126:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1129:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    112d:	31 c0                	xor    %eax,%eax
+    112f:	57                   	push   %rdi
+    1130:	48 8b 3d 49 3f 00 00 	mov    0x3f49(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1137:	4c 8d 0d 55 1f 00 00 	lea    0x1f55(%rip),%r9        # 3093 <_IO_stdin_used+0x93>
+    113e:	4c 8b 06             	mov    (%rsi),%r8
+    1141:	48 8d 35 62 1f 00 00 	lea    0x1f62(%rip),%rsi        # 30aa <_IO_stdin_used+0xaa>
+    1148:	e8 43 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    114d:	e8 ee fe ff ff       	call   1040 <abort@plt>
+
+0000000000001152 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1152:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1156:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1159:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    115d:	31 c0                	xor    %eax,%eax
+    115f:	57                   	push   %rdi
+    1160:	48 8b 3d 19 3f 00 00 	mov    0x3f19(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1167:	4c 8d 0d 51 1f 00 00 	lea    0x1f51(%rip),%r9        # 30bf <_IO_stdin_used+0xbf>
+    116e:	4c 8b 06             	mov    (%rsi),%r8
+    1171:	48 8d 35 32 1f 00 00 	lea    0x1f32(%rip),%rsi        # 30aa <_IO_stdin_used+0xaa>
+    1178:	e8 13 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    117d:	e8 be fe ff ff       	call   1040 <abort@plt>
+    1182:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1189:	00 00 00 
+    118c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001190 <main>:
+    auto e = queue1.pop();
+    nel::log << e << '\n';
+}
+
+int main()
+{
+    1190:	53                   	push   %rbx
+    nel::log << "ex1:b" << '\n';
+    1191:	48 8d 1d f1 3e 00 00 	lea    0x3ef1(%rip),%rbx        # 5089 <nel::log>
+    1198:	48 8d 35 d0 1e 00 00 	lea    0x1ed0(%rip),%rsi        # 306f <_IO_stdin_used+0x6f>
+    119f:	48 89 df             	mov    %rbx,%rdi
+    11a2:	e8 09 1b 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    11a7:	be 0a 00 00 00       	mov    $0xa,%esi
+    11ac:	48 89 c7             	mov    %rax,%rdi
+    11af:	e8 dc 1a 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    11b4:	e8 17 02 00 00       	call   13d0 <ex1()>
+    nel::log << "ex1:e" << '\n';
+    11b9:	48 89 df             	mov    %rbx,%rdi
+    11bc:	48 8d 35 b2 1e 00 00 	lea    0x1eb2(%rip),%rsi        # 3075 <_IO_stdin_used+0x75>
+    11c3:	e8 e8 1a 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    11c8:	be 0a 00 00 00       	mov    $0xa,%esi
+    11cd:	48 89 c7             	mov    %rax,%rdi
+    11d0:	e8 bb 1a 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex2:b" << '\n';
+    11d5:	48 89 df             	mov    %rbx,%rdi
+    11d8:	48 8d 35 9c 1e 00 00 	lea    0x1e9c(%rip),%rsi        # 307b <_IO_stdin_used+0x7b>
+    11df:	e8 cc 1a 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    11e4:	be 0a 00 00 00       	mov    $0xa,%esi
+    11e9:	48 89 c7             	mov    %rax,%rdi
+    11ec:	e8 9f 1a 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    ex2();
+    11f1:	e8 fa 05 00 00       	call   17f0 <ex2()>
+    nel::log << "ex2:e" << '\n';
+    11f6:	48 89 df             	mov    %rbx,%rdi
+    11f9:	48 8d 35 81 1e 00 00 	lea    0x1e81(%rip),%rsi        # 3081 <_IO_stdin_used+0x81>
+    1200:	e8 ab 1a 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    1205:	be 0a 00 00 00       	mov    $0xa,%esi
+    120a:	48 89 c7             	mov    %rax,%rdi
+    120d:	e8 7e 1a 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex3:b" << '\n';
+    1212:	48 89 df             	mov    %rbx,%rdi
+    1215:	48 8d 35 6b 1e 00 00 	lea    0x1e6b(%rip),%rsi        # 3087 <_IO_stdin_used+0x87>
+    121c:	e8 8f 1a 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    1221:	be 0a 00 00 00       	mov    $0xa,%esi
+    1226:	48 89 c7             	mov    %rax,%rdi
+    1229:	e8 62 1a 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    ex3();
+    122e:	e8 dd 0a 00 00       	call   1d10 <ex3()>
+    nel::log << "ex3:e" << '\n';
+    1233:	48 89 df             	mov    %rbx,%rdi
+    1236:	48 8d 35 50 1e 00 00 	lea    0x1e50(%rip),%rsi        # 308d <_IO_stdin_used+0x8d>
+    123d:	e8 6e 1a 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    1242:	be 0a 00 00 00       	mov    $0xa,%esi
+    1247:	48 89 c7             	mov    %rax,%rdi
+    124a:	e8 41 1a 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+}
+    124f:	31 c0                	xor    %eax,%eax
+    1251:	5b                   	pop    %rbx
+    1252:	c3                   	ret
+    1253:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    125a:	00 00 00 
+    125d:	0f 1f 00             	nopl   (%rax)
+
+0000000000001260 <_start>:
+    1260:	31 ed                	xor    %ebp,%ebp
+    1262:	49 89 d1             	mov    %rdx,%r9
+    1265:	5e                   	pop    %rsi
+    1266:	48 89 e2             	mov    %rsp,%rdx
+    1269:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    126d:	50                   	push   %rax
+    126e:	54                   	push   %rsp
+    126f:	45 31 c0             	xor    %r8d,%r8d
+    1272:	31 c9                	xor    %ecx,%ecx
+    1274:	48 8d 3d 15 ff ff ff 	lea    -0xeb(%rip),%rdi        # 1190 <main>
+    127b:	ff 15 3f 3d 00 00    	call   *0x3d3f(%rip)        # 4fc0 <__libc_start_main@GLIBC_2.34>
+    1281:	f4                   	hlt
+    1282:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1289:	00 00 00 
+    128c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001290 <deregister_tm_clones>:
+    1290:	    48 8d 3d d1 3d 00 00 	lea    0x3dd1(%rip),%rdi        # 5068 <__TMC_END__>
+    1297:	    48 8d 05 ca 3d 00 00 	lea    0x3dca(%rip),%rax        # 5068 <__TMC_END__>
+    129e:	    48 39 f8             	cmp    %rdi,%rax
+    12a1:	/-- 74 15                	je     12b8 <deregister_tm_clones+0x28>
+    12a3:	|   48 8b 05 1e 3d 00 00 	mov    0x3d1e(%rip),%rax        # 4fc8 <_ITM_deregisterTMCloneTable@Base>
+    12aa:	|   48 85 c0             	test   %rax,%rax
+    12ad:	+-- 74 09                	je     12b8 <deregister_tm_clones+0x28>
+    12af:	|   ff e0                	jmp    *%rax
+    12b1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    12b8:	\-> c3                   	ret
+    12b9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000012c0 <register_tm_clones>:
+    12c0:	    48 8d 3d a1 3d 00 00 	lea    0x3da1(%rip),%rdi        # 5068 <__TMC_END__>
+    12c7:	    48 8d 35 9a 3d 00 00 	lea    0x3d9a(%rip),%rsi        # 5068 <__TMC_END__>
+    12ce:	    48 29 fe             	sub    %rdi,%rsi
+    12d1:	    48 89 f0             	mov    %rsi,%rax
+    12d4:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    12d8:	    48 c1 f8 03          	sar    $0x3,%rax
+    12dc:	    48 01 c6             	add    %rax,%rsi
+    12df:	    48 d1 fe             	sar    %rsi
+    12e2:	/-- 74 14                	je     12f8 <register_tm_clones+0x38>
+    12e4:	|   48 8b 05 ed 3c 00 00 	mov    0x3ced(%rip),%rax        # 4fd8 <_ITM_registerTMCloneTable@Base>
+    12eb:	|   48 85 c0             	test   %rax,%rax
+    12ee:	+-- 74 08                	je     12f8 <register_tm_clones+0x38>
+    12f0:	|   ff e0                	jmp    *%rax
+    12f2:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    12f8:	\-> c3                   	ret
+    12f9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001300 <__do_global_dtors_aux>:
+    1300:	       f3 0f 1e fa          	endbr64
+    1304:	       80 3d 7d 3d 00 00 00 	cmpb   $0x0,0x3d7d(%rip)        # 5088 <completed.0>
+    130b:	/----- 75 2b                	jne    1338 <__do_global_dtors_aux+0x38>
+    130d:	|      55                   	push   %rbp
+    130e:	|      48 83 3d ca 3c 00 00 	cmpq   $0x0,0x3cca(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1315:	|      00 
+    1316:	|      48 89 e5             	mov    %rsp,%rbp
+    1319:	|  /-- 74 0c                	je     1327 <__do_global_dtors_aux+0x27>
+    131b:	|  |   48 8b 3d 3e 3d 00 00 	mov    0x3d3e(%rip),%rdi        # 5060 <__dso_handle>
+    1322:	|  |   e8 b9 fd ff ff       	call   10e0 <__cxa_finalize@plt>
+    1327:	|  \-> e8 64 ff ff ff       	call   1290 <deregister_tm_clones>
+    132c:	|      c6 05 55 3d 00 00 01 	movb   $0x1,0x3d55(%rip)        # 5088 <completed.0>
+    1333:	|      5d                   	pop    %rbp
+    1334:	|      c3                   	ret
+    1335:	|      0f 1f 00             	nopl   (%rax)
+    1338:	\----> c3                   	ret
+    1339:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001340 <frame_dummy>:
+    1340:	f3 0f 1e fa          	endbr64
+    1344:	e9 77 ff ff ff       	jmp    12c0 <register_tm_clones>
+    1349:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001350 <_close_r>:
+#include <nel/memory.hh>
+    1350:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1355:	c3                   	ret
+    1356:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    135d:	00 00 00 
+
+0000000000001360 <_fstat_r>:
+
+    1360:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1365:	c3                   	ret
+    1366:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    136d:	00 00 00 
+
+0000000000001370 <_kill_r>:
+void ex1()
+    1370:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1375:	c3                   	ret
+    1376:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    137d:	00 00 00 
+
+0000000000001380 <_lseek_r>:
+
+    1380:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1385:	c3                   	ret
+    1386:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    138d:	00 00 00 
+
+0000000000001390 <_read_r>:
+    nel::log << queue1 << '\n';
+    1390:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1395:	c3                   	ret
+    1396:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    139d:	00 00 00 
+
+00000000000013a0 <_write_r>:
+    auto queue1 = Queue1::empty();
+    13a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13a5:	c3                   	ret
+    13a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    13ad:	00 00 00 
+
+00000000000013b0 <_getpid_r>:
+    queue1.push(nel::move(v)).is_ok();
+    13b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13b5:	c3                   	ret
+    13b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    13bd:	00 00 00 
+
+00000000000013c0 <_isatty_r>:
+
+    13c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13c5:	c3                   	ret
+    13c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    13cd:	00 00 00 
+
+00000000000013d0 <ex1()>:
+{
+    13d0:	                                  41 57                	push   %r15
+    auto queue1 = Queue1::empty();
+    13d2:	                                  31 c0                	xor    %eax,%eax
+    13d4:	                                  b9 a3 00 00 00       	mov    $0xa3,%ecx
+        // TODO: replace <<(Log ) with dbgfmt, so separate out from
+        // any other form of conversion to charstring.
+        // TODO: insert into formatter and not final dest type.
+        friend Log &operator<<(Log &outs, Queue const &v)
+        {
+            outs << "Queue<" << N << ">(" << v.len() << "){";
+    13d9:	                                  48 8d 35 24 1c 00 00 	lea    0x1c24(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+{
+    13e0:	                                  41 56                	push   %r14
+    13e2:	                                  41 55                	push   %r13
+    13e4:	                                  4c 8d 2d 9e 3c 00 00 	lea    0x3c9e(%rip),%r13        # 5089 <nel::log>
+    13eb:	                                  41 54                	push   %r12
+    13ed:	                                  55                   	push   %rbp
+    13ee:	                                  53                   	push   %rbx
+    13ef:	                                  48 81 ec 38 05 00 00 	sub    $0x538,%rsp
+    auto queue1 = Queue1::empty();
+    13f6:	                                  48 8d 7c 24 10       	lea    0x10(%rsp),%rdi
+    13fb:	                                  f3 48 ab             	rep stos %rax,%es:(%rdi)
+    13fe:	                                  4c 89 ef             	mov    %r13,%rdi
+    1401:	                                  e8 aa 18 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    1406:	                                  be 05 00 00 00       	mov    $0x5,%esi
+    140b:	                                  48 89 c7             	mov    %rax,%rdi
+    140e:	                                  e8 5d 19 00 00       	call   2d70 <nel::operator<<(nel::Log&, unsigned long)>
+    1413:	                                  48 8d 35 f1 1b 00 00 	lea    0x1bf1(%rip),%rsi        # 300b <_IO_stdin_used+0xb>
+    141a:	                                  48 89 c7             	mov    %rax,%rdi
+    141d:	                                  e8 8e 18 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    1422:	                                  48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1427:	                                  48 89 c7             	mov    %rax,%rdi
+    142a:	                                  e8 41 19 00 00       	call   2d70 <nel::operator<<(nel::Log&, unsigned long)>
+    142f:	                                  48 8d 35 d8 1b 00 00 	lea    0x1bd8(%rip),%rsi        # 300e <_IO_stdin_used+0xe>
+    1436:	                                  48 89 c7             	mov    %rax,%rdi
+    1439:	                                  e8 72 18 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+            if (len() == 0) {
+    143e:	                                  48 83 7c 24 10 00    	cmpq   $0x0,0x10(%rsp)
+    1444:	                     /----------- 0f 85 d8 00 00 00    	jne    1522 <ex1()+0x152>
+#    endif
+
+    public:
+        friend Log &operator<<(Log &outs, ItT const &it)
+        {
+            outs << '[';
+    144a:	                     |            be 5b 00 00 00       	mov    $0x5b,%esi
+    144f:	                     |            4c 89 ef             	mov    %r13,%rdi
+    1452:	                     |            e8 39 18 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+#        elif defined(C_LIKE)
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+#        endif
+            }
+#    endif
+            outs << ']';
+    1457:	/--------------------|----------> be 5d 00 00 00       	mov    $0x5d,%esi
+    145c:	|                    |            4c 89 ef             	mov    %r13,%rdi
+    145f:	|                    |            e8 2c 18 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            outs << v.iter();
+            outs << '}';
+    1464:	|                    |            be 7d 00 00 00       	mov    $0x7d,%esi
+    1469:	|                    |            4c 89 ef             	mov    %r13,%rdi
+    146c:	|                    |            e8 1f 18 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    nel::log << queue1 << '\n';
+    1471:	|                    |            be 0a 00 00 00       	mov    $0xa,%esi
+    1476:	|                    |            4c 89 ef             	mov    %r13,%rdi
+    1479:	|                    |            e8 12 18 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            if (len() == 0) {
+    147e:	|                    |            48 83 7c 24 10 00    	cmpq   $0x0,0x10(%rsp)
+    1484:	|                    |  /-------- 0f 84 86 00 00 00    	je     1510 <ex1()+0x140>
+            } else if (rp_ < wp_) {
+    148a:	|                    |  |         48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+    148f:	|                    |  |         48 8b 44 24 18       	mov    0x18(%rsp),%rax
+            return &ptr()[d];
+    1494:	|                    |  |         4c 8d 74 24 28       	lea    0x28(%rsp),%r14
+    1499:	|                    |  |         49 89 d5             	mov    %rdx,%r13
+    149c:	|                    |  |         48 89 c5             	mov    %rax,%rbp
+    149f:	|                    |  |         49 c1 e5 08          	shl    $0x8,%r13
+    14a3:	|                    |  |         48 c1 e5 08          	shl    $0x8,%rbp
+    14a7:	|                    |  |         4d 01 f5             	add    %r14,%r13
+    14aa:	|                    |  |         4c 01 f5             	add    %r14,%rbp
+            } else if (rp_ < wp_) {
+    14ad:	|                    |  |         48 39 c2             	cmp    %rax,%rdx
+    14b0:	|     /--------------|--|-------- 0f 82 d9 02 00 00    	jb     178f <ex1()+0x3bf>
+
+    public:
+        // move ok
+        SliceIterator(SliceIterator &&o)
+            : b_(move(o.b_))
+            , e_(move(o.e_))
+    14b6:	|     |              |  |         48 89 eb             	mov    %rbp,%rbx
+    14b9:	|     |              |  |         48 8d ac 24 28 05 00 	lea    0x528(%rsp),%rbp
+    14c0:	|     |              |  |         00 
+
+    public:
+#    if defined(C_LIKE)
+        constexpr bool is_done(void) const
+        {
+            return it1_.is_done() && it2_.is_done();
+    14c1:	|  /--|--------------|--|-------> 49 39 ed             	cmp    %rbp,%r13
+    14c4:	|  |  |              |  |  /----- 74 27                	je     14ed <ex1()+0x11d>
+            }
+        }
+
+        OutT deref_back(void)
+        {
+            return (!it2_.is_done()) ? it2_.deref_back() : it1_.deref_back();
+    14c6:	|  |  |              |  |  |  /-> 4c 39 f3             	cmp    %r14,%rbx
+    14c9:	|  |  |  /-----------|--|--|--|-- 0f 84 d1 02 00 00    	je     17a0 <ex1()+0x3d0>
+            --e_;
+        }
+
+        OutT deref_back(void)
+        {
+            return *(e_ - 1);
+    14cf:	|  |  |  |           |  |  |  |   48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+        // U8Buf(void) = default;
+        constexpr U8Buf(void) {}
+
+        constexpr ~U8Buf(void)
+        {
+            nel::elem::set(data_, 0xa5, N);
+    14d6:	|  |  |  |           |  |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    14db:	|  |  |  |           |  |  |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    14e0:	|  |  |  |           |  |  |  |   48 89 df             	mov    %rbx,%rdi
+    14e3:	|  |  |  |           |  |  |  |   e8 38 0f 00 00       	call   2420 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return it1_.is_done() && it2_.is_done();
+    14e8:	|  |  |  |           |  |  |  |   49 39 ed             	cmp    %rbp,%r13
+    14eb:	|  |  |  |           |  |  |  \-- 75 d9                	jne    14c6 <ex1()+0xf6>
+    14ed:	|  |  |  |           |  |  \----> 4c 39 f3             	cmp    %r14,%rbx
+    14f0:	|  |  |  |           |  +-------- 74 1e                	je     1510 <ex1()+0x140>
+    14f2:	|  |  |  |           |  |     /-> 48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    14f9:	|  |  |  |           |  |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    14fe:	|  |  |  |           |  |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    1503:	|  |  |  |           |  |     |   48 89 df             	mov    %rbx,%rdi
+    1506:	|  |  |  |           |  |     |   e8 15 0f 00 00       	call   2420 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    150b:	|  |  |  |           |  |     |   4c 39 f3             	cmp    %r14,%rbx
+    150e:	|  |  |  |           |  |     \-- 75 e2                	jne    14f2 <ex1()+0x122>
+}
+    1510:	|  |  |  |           |  \-------> 48 81 c4 38 05 00 00 	add    $0x538,%rsp
+    1517:	|  |  |  |           |            5b                   	pop    %rbx
+    1518:	|  |  |  |           |            5d                   	pop    %rbp
+    1519:	|  |  |  |           |            41 5c                	pop    %r12
+    151b:	|  |  |  |           |            41 5d                	pop    %r13
+    151d:	|  |  |  |           |            41 5e                	pop    %r14
+    151f:	|  |  |  |           |            41 5f                	pop    %r15
+    1521:	|  |  |  |           |            c3                   	ret
+            } else if (rp_ < wp_) {
+    1522:	|  |  |  |           \----------> 48 8b 44 24 18       	mov    0x18(%rsp),%rax
+    1527:	|  |  |  |                        48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+            return &ptr()[d];
+    152c:	|  |  |  |                        4c 8d 74 24 28       	lea    0x28(%rsp),%r14
+            outs << '[';
+    1531:	|  |  |  |                        4c 89 ef             	mov    %r13,%rdi
+    1534:	|  |  |  |                        be 5b 00 00 00       	mov    $0x5b,%esi
+    1539:	|  |  |  |                        49 89 c4             	mov    %rax,%r12
+    153c:	|  |  |  |                        48 89 d3             	mov    %rdx,%rbx
+    153f:	|  |  |  |                        49 c1 e4 08          	shl    $0x8,%r12
+    1543:	|  |  |  |                        48 c1 e3 08          	shl    $0x8,%rbx
+    1547:	|  |  |  |                        4f 8d 3c 26          	lea    (%r14,%r12,1),%r15
+    154b:	|  |  |  |                        49 8d 2c 1e          	lea    (%r14,%rbx,1),%rbp
+    154f:	|  |  |  |                        4c 89 3c 24          	mov    %r15,(%rsp)
+            } else if (rp_ < wp_) {
+    1553:	|  |  |  |                        48 39 c2             	cmp    %rax,%rdx
+    1556:	|  |  |  |        /-------------- 0f 82 0c 02 00 00    	jb     1768 <ex1()+0x398>
+    155c:	|  |  |  |        |               e8 2f 17 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            return it1_.is_done() && it2_.is_done();
+    1561:	|  |  |  |        |               4c 8d bc 24 28 05 00 	lea    0x528(%rsp),%r15
+    1568:	|  |  |  |        |               00 
+    1569:	|  |  |  |        |               4c 39 fd             	cmp    %r15,%rbp
+    156c:	|  |  |  |     /--|-------------- 0f 84 5a 02 00 00    	je     17cc <ex1()+0x3fc>
+            : b_(move(o.b_))
+    1572:	|  |  |  |     |  |               4c 89 74 24 08       	mov    %r14,0x8(%rsp)
+    1577:	|  |  |  |     |  |               49 89 ec             	mov    %rbp,%r12
+            nel::elem::set(data_, f, N);
+        }
+
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+        {
+            outs << "U8Buf<" << val.len() << ">{";
+    157a:	|  |  |  |  /--|--|-------------> 48 8d 35 90 1a 00 00 	lea    0x1a90(%rip),%rsi        # 3011 <_IO_stdin_used+0x11>
+    1581:	|  |  |  |  |  |  |               4c 89 ef             	mov    %r13,%rdi
+    1584:	|  |  |  |  |  |  |               48 8d 5d 01          	lea    0x1(%rbp),%rbx
+    1588:	|  |  |  |  |  |  |               48 81 c5 00 01 00 00 	add    $0x100,%rbp
+    158f:	|  |  |  |  |  |  |               e8 1c 17 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    1594:	|  |  |  |  |  |  |               be 00 01 00 00       	mov    $0x100,%esi
+    1599:	|  |  |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    159c:	|  |  |  |  |  |  |               e8 cf 17 00 00       	call   2d70 <nel::operator<<(nel::Log&, unsigned long)>
+    15a1:	|  |  |  |  |  |  |               48 8d 35 70 1a 00 00 	lea    0x1a70(%rip),%rsi        # 3018 <_IO_stdin_used+0x18>
+    15a8:	|  |  |  |  |  |  |               48 89 c7             	mov    %rax,%rdi
+    15ab:	|  |  |  |  |  |  |               e8 00 17 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+            if (val.len() > 0) {
+                outs << val.data_[0];
+    15b0:	|  |  |  |  |  |  |               0f b6 b5 00 ff ff ff 	movzbl -0x100(%rbp),%esi
+    15b7:	|  |  |  |  |  |  |               4c 89 ef             	mov    %r13,%rdi
+    15ba:	|  |  |  |  |  |  |               e8 11 17 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    15bf:	|  |  |  |  |  |  |               90                   	nop
+                    outs << ' ' << val.data_[i];
+    15c0:	|  |  |  |  |  |  |           /-> be 20 00 00 00       	mov    $0x20,%esi
+    15c5:	|  |  |  |  |  |  |           |   4c 89 ef             	mov    %r13,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    15c8:	|  |  |  |  |  |  |           |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    15cc:	|  |  |  |  |  |  |           |   e8 bf 16 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    15d1:	|  |  |  |  |  |  |           |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    15d5:	|  |  |  |  |  |  |           |   48 89 c7             	mov    %rax,%rdi
+    15d8:	|  |  |  |  |  |  |           |   e8 f3 16 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    15dd:	|  |  |  |  |  |  |           |   48 39 dd             	cmp    %rbx,%rbp
+    15e0:	|  |  |  |  |  |  |           \-- 75 de                	jne    15c0 <ex1()+0x1f0>
+                }
+            }
+            outs << '}';
+    15e2:	|  |  |  |  |  |  |               be 7d 00 00 00       	mov    $0x7d,%esi
+    15e7:	|  |  |  |  |  |  |               4c 89 ef             	mov    %r13,%rdi
+    15ea:	|  |  |  |  |  |  |               e8 a1 16 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            if (!it1_.is_done()) {
+    15ef:	|  |  |  |  |  |  |               4d 39 e7             	cmp    %r12,%r15
+    15f2:	|  |  |  |  |  |  |  /----------- 0f 84 c6 01 00 00    	je     17be <ex1()+0x3ee>
+            ++b_;
+    15f8:	|  |  |  |  |  |  |  |            49 8d 84 24 00 01 00 	lea    0x100(%r12),%rax
+    15ff:	|  |  |  |  |  |  |  |            00 
+            for (; !self().is_done(); self().inc()) {
+    1600:	|  |  |  |  |  |  |  |            49 39 c7             	cmp    %rax,%r15
+    1603:	|  |  |  |  |  |  |  |  /-------- 0f 84 a6 00 00 00    	je     16af <ex1()+0x2df>
+    1609:	|  |  |  |  |  |  |  |  |         49 81 c4 00 02 00 00 	add    $0x200,%r12
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    1610:	|  |  |  |  |  |  |  |  |  /----> be 2c 00 00 00       	mov    $0x2c,%esi
+    1615:	|  |  |  |  |  |  |  |  |  |      4c 89 ef             	mov    %r13,%rdi
+    1618:	|  |  |  |  |  |  |  |  |  |      4d 89 e6             	mov    %r12,%r14
+    161b:	|  |  |  |  |  |  |  |  |  |      e8 70 16 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            outs << "U8Buf<" << val.len() << ">{";
+    1620:	|  |  |  |  |  |  |  |  |  |      48 8d 35 ea 19 00 00 	lea    0x19ea(%rip),%rsi        # 3011 <_IO_stdin_used+0x11>
+    1627:	|  |  |  |  |  |  |  |  |  |      49 8d 9c 24 01 ff ff 	lea    -0xff(%r12),%rbx
+    162e:	|  |  |  |  |  |  |  |  |  |      ff 
+    162f:	|  |  |  |  |  |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1632:	|  |  |  |  |  |  |  |  |  |      48 89 c5             	mov    %rax,%rbp
+    1635:	|  |  |  |  |  |  |  |  |  |      e8 76 16 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    163a:	|  |  |  |  |  |  |  |  |  |      be 00 01 00 00       	mov    $0x100,%esi
+    163f:	|  |  |  |  |  |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1642:	|  |  |  |  |  |  |  |  |  |      e8 29 17 00 00       	call   2d70 <nel::operator<<(nel::Log&, unsigned long)>
+    1647:	|  |  |  |  |  |  |  |  |  |      48 8d 35 ca 19 00 00 	lea    0x19ca(%rip),%rsi        # 3018 <_IO_stdin_used+0x18>
+    164e:	|  |  |  |  |  |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1651:	|  |  |  |  |  |  |  |  |  |      e8 5a 16 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    1656:	|  |  |  |  |  |  |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    1659:	|  |  |  |  |  |  |  |  |  |      41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    1660:	|  |  |  |  |  |  |  |  |  |      ff ff 
+    1662:	|  |  |  |  |  |  |  |  |  |      e8 69 16 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1667:	|  |  |  |  |  |  |  |  |  |      66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    166e:	|  |  |  |  |  |  |  |  |  |      00 00 
+                    outs << ' ' << val.data_[i];
+    1670:	|  |  |  |  |  |  |  |  |  |  /-> be 20 00 00 00       	mov    $0x20,%esi
+    1675:	|  |  |  |  |  |  |  |  |  |  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1678:	|  |  |  |  |  |  |  |  |  |  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    167c:	|  |  |  |  |  |  |  |  |  |  |   e8 0f 16 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    1681:	|  |  |  |  |  |  |  |  |  |  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1685:	|  |  |  |  |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1688:	|  |  |  |  |  |  |  |  |  |  |   e8 43 16 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    168d:	|  |  |  |  |  |  |  |  |  |  |   4c 39 e3             	cmp    %r12,%rbx
+    1690:	|  |  |  |  |  |  |  |  |  |  \-- 75 de                	jne    1670 <ex1()+0x2a0>
+            outs << '}';
+    1692:	|  |  |  |  |  |  |  |  |  |      be 7d 00 00 00       	mov    $0x7d,%esi
+    1697:	|  |  |  |  |  |  |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+            for (; !self().is_done(); self().inc()) {
+    169a:	|  |  |  |  |  |  |  |  |  |      49 81 c4 00 01 00 00 	add    $0x100,%r12
+    16a1:	|  |  |  |  |  |  |  |  |  |      e8 ea 15 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    16a6:	|  |  |  |  |  |  |  |  |  |      4d 39 fe             	cmp    %r15,%r14
+    16a9:	|  |  |  |  |  |  |  |  |  \----- 0f 85 61 ff ff ff    	jne    1610 <ex1()+0x240>
+    16af:	|  |  |  |  |  |  |  |  >-------> 48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    16b4:	|  |  |  |  |  |  |  |  |         4c 8d a0 00 01 00 00 	lea    0x100(%rax),%r12
+    16bb:	|  |  |  |  |  |  |  |  |         48 39 04 24          	cmp    %rax,(%rsp)
+    16bf:	+--|--|--|--|--|--|--|--|-------- 0f 84 92 fd ff ff    	je     1457 <ex1()+0x87>
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    16c5:	|  |  |  |  |  |  |  |  |  /----> be 2c 00 00 00       	mov    $0x2c,%esi
+    16ca:	|  |  |  |  |  |  |  |  |  |      4c 89 ef             	mov    %r13,%rdi
+    16cd:	|  |  |  |  |  |  |  |  |  |      4d 89 e6             	mov    %r12,%r14
+    16d0:	|  |  |  |  |  |  |  |  |  |      e8 bb 15 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            outs << "U8Buf<" << val.len() << ">{";
+    16d5:	|  |  |  |  |  |  |  |  |  |      48 8d 35 35 19 00 00 	lea    0x1935(%rip),%rsi        # 3011 <_IO_stdin_used+0x11>
+    16dc:	|  |  |  |  |  |  |  |  |  |      49 8d 9c 24 01 ff ff 	lea    -0xff(%r12),%rbx
+    16e3:	|  |  |  |  |  |  |  |  |  |      ff 
+    16e4:	|  |  |  |  |  |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    16e7:	|  |  |  |  |  |  |  |  |  |      48 89 c5             	mov    %rax,%rbp
+    16ea:	|  |  |  |  |  |  |  |  |  |      e8 c1 15 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    16ef:	|  |  |  |  |  |  |  |  |  |      be 00 01 00 00       	mov    $0x100,%esi
+    16f4:	|  |  |  |  |  |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    16f7:	|  |  |  |  |  |  |  |  |  |      e8 74 16 00 00       	call   2d70 <nel::operator<<(nel::Log&, unsigned long)>
+    16fc:	|  |  |  |  |  |  |  |  |  |      48 8d 35 15 19 00 00 	lea    0x1915(%rip),%rsi        # 3018 <_IO_stdin_used+0x18>
+    1703:	|  |  |  |  |  |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1706:	|  |  |  |  |  |  |  |  |  |      e8 a5 15 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    170b:	|  |  |  |  |  |  |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    170e:	|  |  |  |  |  |  |  |  |  |      41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    1715:	|  |  |  |  |  |  |  |  |  |      ff ff 
+    1717:	|  |  |  |  |  |  |  |  |  |      e8 b4 15 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    171c:	|  |  |  |  |  |  |  |  |  |      0f 1f 40 00          	nopl   0x0(%rax)
+                    outs << ' ' << val.data_[i];
+    1720:	|  |  |  |  |  |  |  |  |  |  /-> be 20 00 00 00       	mov    $0x20,%esi
+    1725:	|  |  |  |  |  |  |  |  |  |  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1728:	|  |  |  |  |  |  |  |  |  |  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    172c:	|  |  |  |  |  |  |  |  |  |  |   e8 5f 15 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    1731:	|  |  |  |  |  |  |  |  |  |  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1735:	|  |  |  |  |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1738:	|  |  |  |  |  |  |  |  |  |  |   e8 93 15 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    173d:	|  |  |  |  |  |  |  |  |  |  |   4c 39 e3             	cmp    %r12,%rbx
+    1740:	|  |  |  |  |  |  |  |  |  |  \-- 75 de                	jne    1720 <ex1()+0x350>
+            outs << '}';
+    1742:	|  |  |  |  |  |  |  |  |  |      be 7d 00 00 00       	mov    $0x7d,%esi
+    1747:	|  |  |  |  |  |  |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+            for (; !self().is_done(); self().inc()) {
+    174a:	|  |  |  |  |  |  |  |  |  |      49 81 c4 00 01 00 00 	add    $0x100,%r12
+    1751:	|  |  |  |  |  |  |  |  |  |      e8 3a 15 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    1756:	|  |  |  |  |  |  |  |  |  |      48 8b 04 24          	mov    (%rsp),%rax
+    175a:	|  |  |  |  |  |  |  |  |  |      49 39 c6             	cmp    %rax,%r14
+    175d:	|  |  |  |  |  |  |  |  |  \----- 0f 85 62 ff ff ff    	jne    16c5 <ex1()+0x2f5>
+    1763:	+--|--|--|--|--|--|--|--|-------- e9 ef fc ff ff       	jmp    1457 <ex1()+0x87>
+            outs << '[';
+    1768:	|  |  |  |  |  |  \--|--|-------> e8 23 15 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            return it1_.is_done() && it2_.is_done();
+    176d:	|  |  |  |  |  |     |  |         49 39 dc             	cmp    %rbx,%r12
+    1770:	+--|--|--|--|--|-----|--|-------- 0f 84 e1 fc ff ff    	je     1457 <ex1()+0x87>
+            : b_(move(o.b_))
+    1776:	|  |  |  |  |  |     |  |         48 c7 44 24 08 00 00 	movq   $0x0,0x8(%rsp)
+    177d:	|  |  |  |  |  |     |  |         00 00 
+    177f:	|  |  |  |  |  |     |  |         49 89 ec             	mov    %rbp,%r12
+            , e_(move(o.e_))
+    1782:	|  |  |  |  |  |     |  |         48 c7 04 24 00 00 00 	movq   $0x0,(%rsp)
+    1789:	|  |  |  |  |  |     |  |         00 
+    178a:	|  |  |  |  +--|-----|--|-------- e9 eb fd ff ff       	jmp    157a <ex1()+0x1aa>
+    178f:	|  |  \--|--|--|-----|--|-------> 31 db                	xor    %ebx,%ebx
+            : b_(move(o.b_))
+    1791:	|  |     |  |  |     |  |         45 31 f6             	xor    %r14d,%r14d
+        void for_each(F &&fn)
+    1794:	|  +-----|--|--|-----|--|-------- e9 28 fd ff ff       	jmp    14c1 <ex1()+0xf1>
+    1799:	|  |     |  |  |     |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            return *(e_ - 1);
+    17a0:	|  |     \--|--|-----|--|-------> 48 81 ed 00 01 00 00 	sub    $0x100,%rbp
+            nel::elem::set(data_, 0xa5, N);
+    17a7:	|  |        |  |     |  |         ba 00 01 00 00       	mov    $0x100,%edx
+    17ac:	|  |        |  |     |  |         be a5 00 00 00       	mov    $0xa5,%esi
+    17b1:	|  |        |  |     |  |         48 89 ef             	mov    %rbp,%rdi
+    17b4:	|  |        |  |     |  |         e8 67 0c 00 00       	call   2420 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            for (; !self().is_done(); self().inc()) {
+    17b9:	|  \--------|--|-----|--|-------- e9 03 fd ff ff       	jmp    14c1 <ex1()+0xf1>
+            ++b_;
+    17be:	|           |  |     \--|-------> 48 81 44 24 08 00 01 	addq   $0x100,0x8(%rsp)
+    17c5:	|           |  |        |         00 00 
+    17c7:	|           |  |        \-------- e9 e3 fe ff ff       	jmp    16af <ex1()+0x2df>
+            return it1_.is_done() && it2_.is_done();
+    17cc:	|           |  \----------------> 4c 39 34 24          	cmp    %r14,(%rsp)
+    17d0:	\-----------|-------------------- 0f 84 81 fc ff ff    	je     1457 <ex1()+0x87>
+            , e_(move(o.e_))
+    17d6:	            |                     49 89 ef             	mov    %rbp,%r15
+            : b_(move(o.b_))
+    17d9:	            |                     49 89 ec             	mov    %rbp,%r12
+    17dc:	            |                     4c 89 74 24 08       	mov    %r14,0x8(%rsp)
+    17e1:	            |                     4c 89 f5             	mov    %r14,%rbp
+    17e4:	            \-------------------- e9 91 fd ff ff       	jmp    157a <ex1()+0x1aa>
+    17e9:	                                  0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000017f0 <ex2()>:
+{
+    17f0:	                               41 57                	push   %r15
+    auto queue1 = Queue1::empty();
+    17f2:	                               b9 a3 00 00 00       	mov    $0xa3,%ecx
+            nel::elem::set(data_, f, N);
+    17f7:	                               ba 00 01 00 00       	mov    $0x100,%edx
+    17fc:	                               be 66 00 00 00       	mov    $0x66,%esi
+{
+    1801:	                               41 56                	push   %r14
+    1803:	                               41 55                	push   %r13
+    1805:	                               41 54                	push   %r12
+    1807:	                               55                   	push   %rbp
+    1808:	                               53                   	push   %rbx
+    auto queue1 = Queue1::empty();
+    1809:	                               31 db                	xor    %ebx,%ebx
+    180b:	                               48 89 d8             	mov    %rbx,%rax
+{
+    180e:	                               48 81 ec 58 06 00 00 	sub    $0x658,%rsp
+    1815:	                               4c 8d 7c 24 30       	lea    0x30(%rsp),%r15
+    auto queue1 = Queue1::empty();
+    181a:	                               48 8d bc 24 30 01 00 	lea    0x130(%rsp),%rdi
+    1821:	                               00 
+    1822:	                               f3 48 ab             	rep stos %rax,%es:(%rdi)
+    1825:	                               4c 89 ff             	mov    %r15,%rdi
+    1828:	                               4c 89 7c 24 28       	mov    %r15,0x28(%rsp)
+    182d:	                               e8 ee 0b 00 00       	call   2420 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return len_ == N;
+    1832:	                               48 8b 94 24 30 01 00 	mov    0x130(%rsp),%rdx
+    1839:	                               00 
+            if (is_full()) {
+    183a:	                               48 83 fa 05          	cmp    $0x5,%rdx
+    183e:	         /-------------------- 0f 85 cf 01 00 00    	jne    1a13 <ex2()+0x223>
+                rp_ += 1;
+    1844:	         |                     48 8b 84 24 40 01 00 	mov    0x140(%rsp),%rax
+    184b:	         |                     00 
+            return &ptr()[d];
+    184c:	         |                     48 8b bc 24 38 01 00 	mov    0x138(%rsp),%rdi
+    1853:	         |                     00 
+            nel::elem::move(data_, o.data_, N);
+    1854:	         |                     4c 89 fe             	mov    %r15,%rsi
+                rp_ += 1;
+    1857:	         |                     48 8d 50 01          	lea    0x1(%rax),%rdx
+            return &ptr()[d];
+    185b:	         |                     48 8d 84 24 48 01 00 	lea    0x148(%rsp),%rax
+    1862:	         |                     00 
+                if (rp_ >= capacity()) { rp_ = 0; }
+    1863:	         |                     48 83 fa 05          	cmp    $0x5,%rdx
+            return &ptr()[d];
+    1867:	         |                     48 89 44 24 18       	mov    %rax,0x18(%rsp)
+                if (rp_ >= capacity()) { rp_ = 0; }
+    186c:	         |                     48 0f 43 d3          	cmovae %rbx,%rdx
+            return &ptr()[d];
+    1870:	         |                     48 c1 e7 08          	shl    $0x8,%rdi
+    1874:	         |                     48 01 c7             	add    %rax,%rdi
+    1877:	         |                     48 89 94 24 40 01 00 	mov    %rdx,0x140(%rsp)
+    187e:	         |                     00 
+    187f:	         |                     ba 00 01 00 00       	mov    $0x100,%edx
+    1884:	         |                     e8 a7 0b 00 00       	call   2430 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            if (wp_ >= capacity()) { wp_ = 0; }
+    1889:	         |  /----------------> 31 d2                	xor    %edx,%edx
+            wp_ += 1;
+    188b:	         |  |                  48 8b 84 24 38 01 00 	mov    0x138(%rsp),%rax
+    1892:	         |  |                  00 
+            outs << "Queue<" << N << ">(" << v.len() << "){";
+    1893:	         |  |                  4c 8d 25 ef 37 00 00 	lea    0x37ef(%rip),%r12        # 5089 <nel::log>
+    189a:	         |  |                  48 8d 35 63 17 00 00 	lea    0x1763(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+    18a1:	         |  |                  4c 89 e7             	mov    %r12,%rdi
+            wp_ += 1;
+    18a4:	         |  |                  48 83 c0 01          	add    $0x1,%rax
+            if (wp_ >= capacity()) { wp_ = 0; }
+    18a8:	         |  |                  48 83 f8 05          	cmp    $0x5,%rax
+    18ac:	         |  |                  48 0f 43 c2          	cmovae %rdx,%rax
+    18b0:	         |  |                  48 89 84 24 38 01 00 	mov    %rax,0x138(%rsp)
+    18b7:	         |  |                  00 
+            outs << "Queue<" << N << ">(" << v.len() << "){";
+    18b8:	         |  |                  e8 f3 13 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    18bd:	         |  |                  be 05 00 00 00       	mov    $0x5,%esi
+    18c2:	         |  |                  48 89 c7             	mov    %rax,%rdi
+    18c5:	         |  |                  e8 a6 14 00 00       	call   2d70 <nel::operator<<(nel::Log&, unsigned long)>
+    18ca:	         |  |                  48 8d 35 3a 17 00 00 	lea    0x173a(%rip),%rsi        # 300b <_IO_stdin_used+0xb>
+    18d1:	         |  |                  48 89 c7             	mov    %rax,%rdi
+    18d4:	         |  |                  e8 d7 13 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    18d9:	         |  |                  48 8b b4 24 30 01 00 	mov    0x130(%rsp),%rsi
+    18e0:	         |  |                  00 
+    18e1:	         |  |                  48 89 c7             	mov    %rax,%rdi
+    18e4:	         |  |                  e8 87 14 00 00       	call   2d70 <nel::operator<<(nel::Log&, unsigned long)>
+    18e9:	         |  |                  48 8d 35 1e 17 00 00 	lea    0x171e(%rip),%rsi        # 300e <_IO_stdin_used+0xe>
+    18f0:	         |  |                  48 89 c7             	mov    %rax,%rdi
+    18f3:	         |  |                  e8 b8 13 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+            if (len() == 0) {
+    18f8:	         |  |                  48 83 bc 24 30 01 00 	cmpq   $0x0,0x130(%rsp)
+    18ff:	         |  |                  00 00 
+    1901:	         |  |  /-------------- 0f 85 48 01 00 00    	jne    1a4f <ex2()+0x25f>
+            outs << '[';
+    1907:	         |  |  |               be 5b 00 00 00       	mov    $0x5b,%esi
+    190c:	         |  |  |               4c 89 e7             	mov    %r12,%rdi
+    190f:	         |  |  |               e8 7c 13 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            outs << ']';
+    1914:	/--------|--|--|-------------> be 5d 00 00 00       	mov    $0x5d,%esi
+    1919:	|        |  |  |               4c 89 e7             	mov    %r12,%rdi
+    191c:	|        |  |  |               e8 6f 13 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            outs << '}';
+    1921:	|        |  |  |               be 7d 00 00 00       	mov    $0x7d,%esi
+    1926:	|        |  |  |               4c 89 e7             	mov    %r12,%rdi
+    1929:	|        |  |  |               e8 62 13 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    nel::log << queue1 << '\n';
+    192e:	|        |  |  |               be 0a 00 00 00       	mov    $0xa,%esi
+    1933:	|        |  |  |               4c 89 e7             	mov    %r12,%rdi
+    1936:	|        |  |  |               e8 55 13 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            nel::elem::set(data_, 0xa5, N);
+    193b:	|        |  |  |               48 8b 7c 24 28       	mov    0x28(%rsp),%rdi
+    1940:	|        |  |  |               ba 00 01 00 00       	mov    $0x100,%edx
+    1945:	|        |  |  |               be a5 00 00 00       	mov    $0xa5,%esi
+    194a:	|        |  |  |               e8 d1 0a 00 00       	call   2420 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            if (len() == 0) {
+    194f:	|        |  |  |               48 83 bc 24 30 01 00 	cmpq   $0x0,0x130(%rsp)
+    1956:	|        |  |  |               00 00 
+    1958:	|        |  |  |  /----------- 0f 84 88 00 00 00    	je     19e6 <ex2()+0x1f6>
+            } else if (rp_ < wp_) {
+    195e:	|        |  |  |  |            48 8b 94 24 40 01 00 	mov    0x140(%rsp),%rdx
+    1965:	|        |  |  |  |            00 
+    1966:	|        |  |  |  |            48 8b 84 24 38 01 00 	mov    0x138(%rsp),%rax
+    196d:	|        |  |  |  |            00 
+            return &ptr()[d];
+    196e:	|        |  |  |  |            4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+    1973:	|        |  |  |  |            49 89 d5             	mov    %rdx,%r13
+    1976:	|        |  |  |  |            48 89 c5             	mov    %rax,%rbp
+    1979:	|        |  |  |  |            49 c1 e5 08          	shl    $0x8,%r13
+    197d:	|        |  |  |  |            48 c1 e5 08          	shl    $0x8,%rbp
+    1981:	|        |  |  |  |            4d 01 e5             	add    %r12,%r13
+    1984:	|        |  |  |  |            4c 01 e5             	add    %r12,%rbp
+            } else if (rp_ < wp_) {
+    1987:	|        |  |  |  |            48 39 c2             	cmp    %rax,%rdx
+    198a:	|  /-----|--|--|--|----------- 0f 82 4d 03 00 00    	jb     1cdd <ex2()+0x4ed>
+            , e_(move(o.e_))
+    1990:	|  |     |  |  |  |            48 89 eb             	mov    %rbp,%rbx
+    1993:	|  |     |  |  |  |            48 8d ac 24 48 06 00 	lea    0x648(%rsp),%rbp
+    199a:	|  |     |  |  |  |            00 
+            return it1_.is_done() && it2_.is_done();
+    199b:	|  |  /--|--|--|--|----------> 4c 39 ed             	cmp    %r13,%rbp
+    199e:	|  |  |  |  |  |  |     /----- 74 23                	je     19c3 <ex2()+0x1d3>
+            return (!it2_.is_done()) ? it2_.deref_back() : it1_.deref_back();
+    19a0:	|  |  |  |  |  |  |     |  /-> 4c 39 e3             	cmp    %r12,%rbx
+    19a3:	|  |  |  |  |  |  |  /--|--|-- 74 53                	je     19f8 <ex2()+0x208>
+            return *(e_ - 1);
+    19a5:	|  |  |  |  |  |  |  |  |  |   48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    19ac:	|  |  |  |  |  |  |  |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    19b1:	|  |  |  |  |  |  |  |  |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    19b6:	|  |  |  |  |  |  |  |  |  |   48 89 df             	mov    %rbx,%rdi
+    19b9:	|  |  |  |  |  |  |  |  |  |   e8 62 0a 00 00       	call   2420 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return it1_.is_done() && it2_.is_done();
+    19be:	|  |  |  |  |  |  |  |  |  |   4c 39 ed             	cmp    %r13,%rbp
+    19c1:	|  |  |  |  |  |  |  |  |  \-- 75 dd                	jne    19a0 <ex2()+0x1b0>
+    19c3:	|  |  |  |  |  |  |  |  \----> 4c 39 e3             	cmp    %r12,%rbx
+    19c6:	|  |  |  |  |  |  +--|-------- 74 1e                	je     19e6 <ex2()+0x1f6>
+    19c8:	|  |  |  |  |  |  |  |     /-> 48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    19cf:	|  |  |  |  |  |  |  |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    19d4:	|  |  |  |  |  |  |  |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    19d9:	|  |  |  |  |  |  |  |     |   48 89 df             	mov    %rbx,%rdi
+    19dc:	|  |  |  |  |  |  |  |     |   e8 3f 0a 00 00       	call   2420 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    19e1:	|  |  |  |  |  |  |  |     |   49 39 dc             	cmp    %rbx,%r12
+    19e4:	|  |  |  |  |  |  |  |     \-- 75 e2                	jne    19c8 <ex2()+0x1d8>
+}
+    19e6:	|  |  |  |  |  |  \--|-------> 48 81 c4 58 06 00 00 	add    $0x658,%rsp
+    19ed:	|  |  |  |  |  |     |         5b                   	pop    %rbx
+    19ee:	|  |  |  |  |  |     |         5d                   	pop    %rbp
+    19ef:	|  |  |  |  |  |     |         41 5c                	pop    %r12
+    19f1:	|  |  |  |  |  |     |         41 5d                	pop    %r13
+    19f3:	|  |  |  |  |  |     |         41 5e                	pop    %r14
+    19f5:	|  |  |  |  |  |     |         41 5f                	pop    %r15
+    19f7:	|  |  |  |  |  |     |         c3                   	ret
+    19f8:	|  |  |  |  |  |     \-------> 48 81 ed 00 01 00 00 	sub    $0x100,%rbp
+    19ff:	|  |  |  |  |  |               ba 00 01 00 00       	mov    $0x100,%edx
+    1a04:	|  |  |  |  |  |               be a5 00 00 00       	mov    $0xa5,%esi
+    1a09:	|  |  |  |  |  |               48 89 ef             	mov    %rbp,%rdi
+    1a0c:	|  |  |  |  |  |               e8 0f 0a 00 00       	call   2420 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            for (; !self().is_done(); self().inc()) {
+    1a11:	|  |  +--|--|--|-------------- eb 88                	jmp    199b <ex2()+0x1ab>
+            return &ptr()[d];
+    1a13:	|  |  |  \--|--|-------------> 48 8b bc 24 38 01 00 	mov    0x138(%rsp),%rdi
+    1a1a:	|  |  |     |  |               00 
+                len_ += 1;
+    1a1b:	|  |  |     |  |               48 83 c2 01          	add    $0x1,%rdx
+            nel::elem::move(data_, o.data_, N);
+    1a1f:	|  |  |     |  |               48 8b 74 24 28       	mov    0x28(%rsp),%rsi
+            return &ptr()[d];
+    1a24:	|  |  |     |  |               48 8d 84 24 48 01 00 	lea    0x148(%rsp),%rax
+    1a2b:	|  |  |     |  |               00 
+                len_ += 1;
+    1a2c:	|  |  |     |  |               48 89 94 24 30 01 00 	mov    %rdx,0x130(%rsp)
+    1a33:	|  |  |     |  |               00 
+    1a34:	|  |  |     |  |               ba 00 01 00 00       	mov    $0x100,%edx
+            return &ptr()[d];
+    1a39:	|  |  |     |  |               48 c1 e7 08          	shl    $0x8,%rdi
+    1a3d:	|  |  |     |  |               48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    1a42:	|  |  |     |  |               48 01 c7             	add    %rax,%rdi
+    1a45:	|  |  |     |  |               e8 e6 09 00 00       	call   2430 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+        }
+    1a4a:	|  |  |     \--|-------------- e9 3a fe ff ff       	jmp    1889 <ex2()+0x99>
+            } else if (rp_ < wp_) {
+    1a4f:	|  |  |        \-------------> 48 8b 94 24 40 01 00 	mov    0x140(%rsp),%rdx
+    1a56:	|  |  |                        00 
+    1a57:	|  |  |                        48 8b 84 24 38 01 00 	mov    0x138(%rsp),%rax
+    1a5e:	|  |  |                        00 
+            outs << '[';
+    1a5f:	|  |  |                        be 5b 00 00 00       	mov    $0x5b,%esi
+    1a64:	|  |  |                        4c 89 e7             	mov    %r12,%rdi
+            return &ptr()[d];
+    1a67:	|  |  |                        48 8b 4c 24 18       	mov    0x18(%rsp),%rcx
+    1a6c:	|  |  |                        48 89 d3             	mov    %rdx,%rbx
+    1a6f:	|  |  |                        49 89 c5             	mov    %rax,%r13
+    1a72:	|  |  |                        48 c1 e3 08          	shl    $0x8,%rbx
+    1a76:	|  |  |                        49 c1 e5 08          	shl    $0x8,%r13
+    1a7a:	|  |  |                        48 8d 2c 19          	lea    (%rcx,%rbx,1),%rbp
+    1a7e:	|  |  |                        4c 01 e9             	add    %r13,%rcx
+    1a81:	|  |  |                        48 89 4c 24 08       	mov    %rcx,0x8(%rsp)
+            } else if (rp_ < wp_) {
+    1a86:	|  |  |                        48 39 c2             	cmp    %rax,%rdx
+    1a89:	|  |  |        /-------------- 0f 83 17 02 00 00    	jae    1ca6 <ex2()+0x4b6>
+    1a8f:	|  |  |        |               e8 fc 11 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            return it1_.is_done() && it2_.is_done();
+    1a94:	|  |  |        |               49 39 dd             	cmp    %rbx,%r13
+    1a97:	+--|--|--------|-------------- 0f 84 77 fe ff ff    	je     1914 <ex2()+0x124>
+            , e_(move(o.e_))
+    1a9d:	|  |  |        |               48 8b 44 24 08       	mov    0x8(%rsp),%rax
+            : b_(move(o.b_))
+    1aa2:	|  |  |        |               49 89 ee             	mov    %rbp,%r14
+    1aa5:	|  |  |        |               48 c7 44 24 20 00 00 	movq   $0x0,0x20(%rsp)
+    1aac:	|  |  |        |               00 00 
+            , e_(move(o.e_))
+    1aae:	|  |  |        |               48 c7 44 24 08 00 00 	movq   $0x0,0x8(%rsp)
+    1ab5:	|  |  |        |               00 00 
+    1ab7:	|  |  |        |               48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            outs << "U8Buf<" << val.len() << ">{";
+    1abc:	|  |  |     /--|-------------> 48 8d 35 4e 15 00 00 	lea    0x154e(%rip),%rsi        # 3011 <_IO_stdin_used+0x11>
+    1ac3:	|  |  |     |  |               4c 89 e7             	mov    %r12,%rdi
+    1ac6:	|  |  |     |  |               4c 8d 2d 4b 15 00 00 	lea    0x154b(%rip),%r13        # 3018 <_IO_stdin_used+0x18>
+    1acd:	|  |  |     |  |               e8 de 11 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    1ad2:	|  |  |     |  |               be 00 01 00 00       	mov    $0x100,%esi
+    1ad7:	|  |  |     |  |               48 8d 5d 01          	lea    0x1(%rbp),%rbx
+    1adb:	|  |  |     |  |               48 81 c5 00 01 00 00 	add    $0x100,%rbp
+    1ae2:	|  |  |     |  |               48 89 c7             	mov    %rax,%rdi
+    1ae5:	|  |  |     |  |               e8 86 12 00 00       	call   2d70 <nel::operator<<(nel::Log&, unsigned long)>
+    1aea:	|  |  |     |  |               4c 89 ee             	mov    %r13,%rsi
+    1aed:	|  |  |     |  |               48 89 c7             	mov    %rax,%rdi
+    1af0:	|  |  |     |  |               e8 bb 11 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    1af5:	|  |  |     |  |               0f b6 b5 00 ff ff ff 	movzbl -0x100(%rbp),%esi
+    1afc:	|  |  |     |  |               4c 89 e7             	mov    %r12,%rdi
+    1aff:	|  |  |     |  |               e8 cc 11 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1b04:	|  |  |     |  |               0f 1f 40 00          	nopl   0x0(%rax)
+                    outs << ' ' << val.data_[i];
+    1b08:	|  |  |     |  |           /-> be 20 00 00 00       	mov    $0x20,%esi
+    1b0d:	|  |  |     |  |           |   4c 89 e7             	mov    %r12,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1b10:	|  |  |     |  |           |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    1b14:	|  |  |     |  |           |   e8 77 11 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    1b19:	|  |  |     |  |           |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1b1d:	|  |  |     |  |           |   48 89 c7             	mov    %rax,%rdi
+    1b20:	|  |  |     |  |           |   e8 ab 11 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1b25:	|  |  |     |  |           |   48 39 dd             	cmp    %rbx,%rbp
+    1b28:	|  |  |     |  |           \-- 75 de                	jne    1b08 <ex2()+0x318>
+            outs << '}';
+    1b2a:	|  |  |     |  |               be 7d 00 00 00       	mov    $0x7d,%esi
+    1b2f:	|  |  |     |  |               4c 89 e7             	mov    %r12,%rdi
+    1b32:	|  |  |     |  |               e8 59 11 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            if (!it1_.is_done()) {
+    1b37:	|  |  |     |  |               48 8b 4c 24 10       	mov    0x10(%rsp),%rcx
+    1b3c:	|  |  |     |  |               4c 39 f1             	cmp    %r14,%rcx
+    1b3f:	|  |  |     |  |  /----------- 0f 84 8a 01 00 00    	je     1ccf <ex2()+0x4df>
+            ++b_;
+    1b45:	|  |  |     |  |  |            49 8d 86 00 01 00 00 	lea    0x100(%r14),%rax
+            for (; !self().is_done(); self().inc()) {
+    1b4c:	|  |  |     |  |  |            48 39 c1             	cmp    %rax,%rcx
+    1b4f:	|  |  |     |  |  |  /-------- 0f 84 9c 00 00 00    	je     1bf1 <ex2()+0x401>
+    1b55:	|  |  |     |  |  |  |         49 81 c6 00 02 00 00 	add    $0x200,%r14
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    1b5c:	|  |  |     |  |  |  |  /----> be 2c 00 00 00       	mov    $0x2c,%esi
+    1b61:	|  |  |     |  |  |  |  |      4c 89 e7             	mov    %r12,%rdi
+    1b64:	|  |  |     |  |  |  |  |      4d 89 f7             	mov    %r14,%r15
+    1b67:	|  |  |     |  |  |  |  |      e8 24 11 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            outs << "U8Buf<" << val.len() << ">{";
+    1b6c:	|  |  |     |  |  |  |  |      48 8d 35 9e 14 00 00 	lea    0x149e(%rip),%rsi        # 3011 <_IO_stdin_used+0x11>
+    1b73:	|  |  |     |  |  |  |  |      49 8d 9e 01 ff ff ff 	lea    -0xff(%r14),%rbx
+    1b7a:	|  |  |     |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1b7d:	|  |  |     |  |  |  |  |      48 89 c5             	mov    %rax,%rbp
+    1b80:	|  |  |     |  |  |  |  |      e8 2b 11 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    1b85:	|  |  |     |  |  |  |  |      be 00 01 00 00       	mov    $0x100,%esi
+    1b8a:	|  |  |     |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1b8d:	|  |  |     |  |  |  |  |      e8 de 11 00 00       	call   2d70 <nel::operator<<(nel::Log&, unsigned long)>
+    1b92:	|  |  |     |  |  |  |  |      4c 89 ee             	mov    %r13,%rsi
+    1b95:	|  |  |     |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1b98:	|  |  |     |  |  |  |  |      e8 13 11 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    1b9d:	|  |  |     |  |  |  |  |      41 0f b6 b6 00 ff ff 	movzbl -0x100(%r14),%esi
+    1ba4:	|  |  |     |  |  |  |  |      ff 
+    1ba5:	|  |  |     |  |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    1ba8:	|  |  |     |  |  |  |  |      e8 23 11 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1bad:	|  |  |     |  |  |  |  |      0f 1f 00             	nopl   (%rax)
+                    outs << ' ' << val.data_[i];
+    1bb0:	|  |  |     |  |  |  |  |  /-> be 20 00 00 00       	mov    $0x20,%esi
+    1bb5:	|  |  |     |  |  |  |  |  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1bb8:	|  |  |     |  |  |  |  |  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    1bbc:	|  |  |     |  |  |  |  |  |   e8 cf 10 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    1bc1:	|  |  |     |  |  |  |  |  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1bc5:	|  |  |     |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1bc8:	|  |  |     |  |  |  |  |  |   e8 03 11 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1bcd:	|  |  |     |  |  |  |  |  |   49 39 de             	cmp    %rbx,%r14
+    1bd0:	|  |  |     |  |  |  |  |  \-- 75 de                	jne    1bb0 <ex2()+0x3c0>
+            outs << '}';
+    1bd2:	|  |  |     |  |  |  |  |      be 7d 00 00 00       	mov    $0x7d,%esi
+    1bd7:	|  |  |     |  |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+            for (; !self().is_done(); self().inc()) {
+    1bda:	|  |  |     |  |  |  |  |      49 81 c6 00 01 00 00 	add    $0x100,%r14
+    1be1:	|  |  |     |  |  |  |  |      e8 aa 10 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    1be6:	|  |  |     |  |  |  |  |      4c 39 7c 24 10       	cmp    %r15,0x10(%rsp)
+    1beb:	|  |  |     |  |  |  |  \----- 0f 85 6b ff ff ff    	jne    1b5c <ex2()+0x36c>
+    1bf1:	|  |  |     |  |  |  >-------> 48 8b 44 24 20       	mov    0x20(%rsp),%rax
+    1bf6:	|  |  |     |  |  |  |         48 8b 4c 24 08       	mov    0x8(%rsp),%rcx
+    1bfb:	|  |  |     |  |  |  |         48 39 c8             	cmp    %rcx,%rax
+    1bfe:	+--|--|-----|--|--|--|-------- 0f 84 10 fd ff ff    	je     1914 <ex2()+0x124>
+    1c04:	|  |  |     |  |  |  |         48 05 00 01 00 00    	add    $0x100,%rax
+    1c0a:	|  |  |     |  |  |  |         49 89 c6             	mov    %rax,%r14
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    1c0d:	|  |  |     |  |  |  |  /----> be 2c 00 00 00       	mov    $0x2c,%esi
+    1c12:	|  |  |     |  |  |  |  |      4c 89 e7             	mov    %r12,%rdi
+    1c15:	|  |  |     |  |  |  |  |      4d 89 f7             	mov    %r14,%r15
+    1c18:	|  |  |     |  |  |  |  |      e8 73 10 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            outs << "U8Buf<" << val.len() << ">{";
+    1c1d:	|  |  |     |  |  |  |  |      48 8d 35 ed 13 00 00 	lea    0x13ed(%rip),%rsi        # 3011 <_IO_stdin_used+0x11>
+    1c24:	|  |  |     |  |  |  |  |      49 8d 9e 01 ff ff ff 	lea    -0xff(%r14),%rbx
+    1c2b:	|  |  |     |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1c2e:	|  |  |     |  |  |  |  |      48 89 c5             	mov    %rax,%rbp
+    1c31:	|  |  |     |  |  |  |  |      e8 7a 10 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    1c36:	|  |  |     |  |  |  |  |      be 00 01 00 00       	mov    $0x100,%esi
+    1c3b:	|  |  |     |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1c3e:	|  |  |     |  |  |  |  |      e8 2d 11 00 00       	call   2d70 <nel::operator<<(nel::Log&, unsigned long)>
+    1c43:	|  |  |     |  |  |  |  |      4c 89 ee             	mov    %r13,%rsi
+    1c46:	|  |  |     |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1c49:	|  |  |     |  |  |  |  |      e8 62 10 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    1c4e:	|  |  |     |  |  |  |  |      41 0f b6 b6 00 ff ff 	movzbl -0x100(%r14),%esi
+    1c55:	|  |  |     |  |  |  |  |      ff 
+    1c56:	|  |  |     |  |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    1c59:	|  |  |     |  |  |  |  |      e8 72 10 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1c5e:	|  |  |     |  |  |  |  |      66 90                	xchg   %ax,%ax
+                    outs << ' ' << val.data_[i];
+    1c60:	|  |  |     |  |  |  |  |  /-> be 20 00 00 00       	mov    $0x20,%esi
+    1c65:	|  |  |     |  |  |  |  |  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1c68:	|  |  |     |  |  |  |  |  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    1c6c:	|  |  |     |  |  |  |  |  |   e8 1f 10 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    1c71:	|  |  |     |  |  |  |  |  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1c75:	|  |  |     |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1c78:	|  |  |     |  |  |  |  |  |   e8 53 10 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1c7d:	|  |  |     |  |  |  |  |  |   49 39 de             	cmp    %rbx,%r14
+    1c80:	|  |  |     |  |  |  |  |  \-- 75 de                	jne    1c60 <ex2()+0x470>
+            outs << '}';
+    1c82:	|  |  |     |  |  |  |  |      be 7d 00 00 00       	mov    $0x7d,%esi
+    1c87:	|  |  |     |  |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+            for (; !self().is_done(); self().inc()) {
+    1c8a:	|  |  |     |  |  |  |  |      49 81 c6 00 01 00 00 	add    $0x100,%r14
+    1c91:	|  |  |     |  |  |  |  |      e8 fa 0f 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    1c96:	|  |  |     |  |  |  |  |      4c 39 7c 24 08       	cmp    %r15,0x8(%rsp)
+    1c9b:	|  |  |     |  |  |  |  \----- 0f 85 6c ff ff ff    	jne    1c0d <ex2()+0x41d>
+    1ca1:	+--|--|-----|--|--|--|-------- e9 6e fc ff ff       	jmp    1914 <ex2()+0x124>
+            outs << '[';
+    1ca6:	|  |  |     |  \--|--|-------> e8 e5 0f 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            return it1_.is_done() && it2_.is_done();
+    1cab:	|  |  |     |     |  |         48 8d 84 24 48 06 00 	lea    0x648(%rsp),%rax
+    1cb2:	|  |  |     |     |  |         00 
+    1cb3:	|  |  |     |     |  |         48 39 c5             	cmp    %rax,%rbp
+    1cb6:	|  |  |     |     |  |     /-- 74 2f                	je     1ce7 <ex2()+0x4f7>
+            : b_(move(o.b_))
+    1cb8:	|  |  |     |     |  |     |   48 8b 4c 24 18       	mov    0x18(%rsp),%rcx
+            , e_(move(o.e_))
+    1cbd:	|  |  |     |     |  |     |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            : b_(move(o.b_))
+    1cc2:	|  |  |     |     |  |     |   49 89 ee             	mov    %rbp,%r14
+    1cc5:	|  |  |     |     |  |     |   48 89 4c 24 20       	mov    %rcx,0x20(%rsp)
+    1cca:	|  |  |     +-----|--|-----|-- e9 ed fd ff ff       	jmp    1abc <ex2()+0x2cc>
+            ++b_;
+    1ccf:	|  |  |     |     \--|-----|-> 48 81 44 24 20 00 01 	addq   $0x100,0x20(%rsp)
+    1cd6:	|  |  |     |        |     |   00 00 
+    1cd8:	|  |  |     |        \-----|-- e9 14 ff ff ff       	jmp    1bf1 <ex2()+0x401>
+            , e_(move(o.e_))
+    1cdd:	|  \--|-----|--------------|-> 31 db                	xor    %ebx,%ebx
+            : b_(move(o.b_))
+    1cdf:	|     |     |              |   45 31 e4             	xor    %r12d,%r12d
+        void for_each(F &&fn)
+    1ce2:	|     \-----|--------------|-- e9 b4 fc ff ff       	jmp    199b <ex2()+0x1ab>
+            return it1_.is_done() && it2_.is_done();
+    1ce7:	|           |              \-> 48 8b 44 24 18       	mov    0x18(%rsp),%rax
+    1cec:	|           |                  48 39 44 24 08       	cmp    %rax,0x8(%rsp)
+    1cf1:	\-----------|----------------- 0f 84 1d fc ff ff    	je     1914 <ex2()+0x124>
+            , e_(move(o.e_))
+    1cf7:	            |                  48 89 6c 24 10       	mov    %rbp,0x10(%rsp)
+            : b_(move(o.b_))
+    1cfc:	            |                  49 89 ee             	mov    %rbp,%r14
+    1cff:	            |                  48 89 c5             	mov    %rax,%rbp
+    1d02:	            |                  48 89 44 24 20       	mov    %rax,0x20(%rsp)
+    1d07:	            \----------------- e9 b0 fd ff ff       	jmp    1abc <ex2()+0x2cc>
+    1d0c:	                               0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001d10 <ex3()>:
+{
+    1d10:	                                              41 57                	push   %r15
+    auto queue1 = Queue1::empty();
+    1d12:	                                              b9 a3 00 00 00       	mov    $0xa3,%ecx
+            nel::elem::set(data_, f, N);
+    1d17:	                                              ba 00 01 00 00       	mov    $0x100,%edx
+    1d1c:	                                              be 67 00 00 00       	mov    $0x67,%esi
+{
+    1d21:	                                              41 56                	push   %r14
+    1d23:	                                              41 55                	push   %r13
+    1d25:	                                              41 54                	push   %r12
+    1d27:	                                              55                   	push   %rbp
+    auto queue1 = Queue1::empty();
+    1d28:	                                              31 ed                	xor    %ebp,%ebp
+{
+    1d2a:	                                              53                   	push   %rbx
+    auto queue1 = Queue1::empty();
+    1d2b:	                                              48 89 e8             	mov    %rbp,%rax
+{
+    1d2e:	                                              48 81 ec 78 06 00 00 	sub    $0x678,%rsp
+    auto queue1 = Queue1::empty();
+    1d35:	                                              48 8d bc 24 50 01 00 	lea    0x150(%rsp),%rdi
+    1d3c:	                                              00 
+    1d3d:	                                              48 8d 5c 24 40       	lea    0x40(%rsp),%rbx
+    1d42:	                                              f3 48 ab             	rep stos %rax,%es:(%rdi)
+    1d45:	                                              48 89 df             	mov    %rbx,%rdi
+    1d48:	                                              e8 d3 06 00 00       	call   2420 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return len_ == N;
+    1d4d:	                                              48 8b 94 24 50 01 00 	mov    0x150(%rsp),%rdx
+    1d54:	                                              00 
+            if (is_full()) {
+    1d55:	                                              48 83 fa 05          	cmp    $0x5,%rdx
+    1d59:	               /----------------------------- 0f 85 2a 03 00 00    	jne    2089 <ex3()+0x379>
+                rp_ += 1;
+    1d5f:	               |                              48 8b 84 24 60 01 00 	mov    0x160(%rsp),%rax
+    1d66:	               |                              00 
+    1d67:	               |                              48 8d 50 01          	lea    0x1(%rax),%rdx
+                if (rp_ >= capacity()) { rp_ = 0; }
+    1d6b:	               |                              48 83 fa 05          	cmp    $0x5,%rdx
+    1d6f:	               |                              48 0f 43 d5          	cmovae %rbp,%rdx
+    1d73:	               |                              48 89 94 24 60 01 00 	mov    %rdx,0x160(%rsp)
+    1d7a:	               |                              00 
+            return &ptr()[d];
+    1d7b:	               |  /-------------------------> 48 8b bc 24 58 01 00 	mov    0x158(%rsp),%rdi
+    1d82:	               |  |                           00 
+    1d83:	               |  |                           48 8d 84 24 68 01 00 	lea    0x168(%rsp),%rax
+    1d8a:	               |  |                           00 
+            nel::elem::move(data_, o.data_, N);
+    1d8b:	               |  |                           ba 00 01 00 00       	mov    $0x100,%edx
+    1d90:	               |  |                           48 89 de             	mov    %rbx,%rsi
+    1d93:	               |  |                           48 89 44 24 10       	mov    %rax,0x10(%rsp)
+            outs << "Queue<" << N << ">(" << v.len() << "){";
+    1d98:	               |  |                           48 8d 2d ea 32 00 00 	lea    0x32ea(%rip),%rbp        # 5089 <nel::log>
+            return &ptr()[d];
+    1d9f:	               |  |                           48 c1 e7 08          	shl    $0x8,%rdi
+    1da3:	               |  |                           48 01 c7             	add    %rax,%rdi
+    1da6:	               |  |                           e8 85 06 00 00       	call   2430 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            if (wp_ >= capacity()) { wp_ = 0; }
+    1dab:	               |  |                           31 d2                	xor    %edx,%edx
+            nel::elem::set(data_, 0xa5, N);
+    1dad:	               |  |                           be a5 00 00 00       	mov    $0xa5,%esi
+    1db2:	               |  |                           48 89 df             	mov    %rbx,%rdi
+            wp_ += 1;
+    1db5:	               |  |                           48 8b 84 24 58 01 00 	mov    0x158(%rsp),%rax
+    1dbc:	               |  |                           00 
+    1dbd:	               |  |                           48 83 c0 01          	add    $0x1,%rax
+            if (wp_ >= capacity()) { wp_ = 0; }
+    1dc1:	               |  |                           48 83 f8 05          	cmp    $0x5,%rax
+    1dc5:	               |  |                           48 0f 43 c2          	cmovae %rdx,%rax
+    1dc9:	               |  |                           ba 00 01 00 00       	mov    $0x100,%edx
+    1dce:	               |  |                           48 89 84 24 58 01 00 	mov    %rax,0x158(%rsp)
+    1dd5:	               |  |                           00 
+    1dd6:	               |  |                           e8 45 06 00 00       	call   2420 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            outs << "Queue<" << N << ">(" << v.len() << "){";
+    1ddb:	               |  |                           48 8d 35 22 12 00 00 	lea    0x1222(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+    1de2:	               |  |                           48 89 ef             	mov    %rbp,%rdi
+    1de5:	               |  |                           e8 c6 0e 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    1dea:	               |  |                           be 05 00 00 00       	mov    $0x5,%esi
+    1def:	               |  |                           48 89 c7             	mov    %rax,%rdi
+    1df2:	               |  |                           e8 79 0f 00 00       	call   2d70 <nel::operator<<(nel::Log&, unsigned long)>
+    1df7:	               |  |                           48 8d 35 0d 12 00 00 	lea    0x120d(%rip),%rsi        # 300b <_IO_stdin_used+0xb>
+    1dfe:	               |  |                           48 89 c7             	mov    %rax,%rdi
+    1e01:	               |  |                           e8 aa 0e 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    1e06:	               |  |                           48 8b b4 24 50 01 00 	mov    0x150(%rsp),%rsi
+    1e0d:	               |  |                           00 
+    1e0e:	               |  |                           48 89 c7             	mov    %rax,%rdi
+    1e11:	               |  |                           e8 5a 0f 00 00       	call   2d70 <nel::operator<<(nel::Log&, unsigned long)>
+    1e16:	               |  |                           48 8d 35 f1 11 00 00 	lea    0x11f1(%rip),%rsi        # 300e <_IO_stdin_used+0xe>
+    1e1d:	               |  |                           48 89 c7             	mov    %rax,%rdi
+    1e20:	               |  |                           e8 8b 0e 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+            if (len() == 0) {
+    1e25:	               |  |                           48 83 bc 24 50 01 00 	cmpq   $0x0,0x150(%rsp)
+    1e2c:	               |  |                           00 00 
+    1e2e:	               |  |  /----------------------- 0f 85 66 02 00 00    	jne    209a <ex3()+0x38a>
+            outs << '[';
+    1e34:	               |  |  |                        be 5b 00 00 00       	mov    $0x5b,%esi
+    1e39:	               |  |  |                        48 89 ef             	mov    %rbp,%rdi
+    1e3c:	               |  |  |                        e8 4f 0e 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            outs << ']';
+    1e41:	/--------------|--|--|----------------------> be 5d 00 00 00       	mov    $0x5d,%esi
+    1e46:	|              |  |  |                        48 89 ef             	mov    %rbp,%rdi
+    1e49:	|              |  |  |                        e8 42 0e 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            outs << '}';
+    1e4e:	|              |  |  |                        be 7d 00 00 00       	mov    $0x7d,%esi
+    1e53:	|              |  |  |                        48 89 ef             	mov    %rbp,%rdi
+    1e56:	|              |  |  |                        e8 35 0e 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    nel::log << queue1 << '\n';
+    1e5b:	|              |  |  |                        be 0a 00 00 00       	mov    $0xa,%esi
+    1e60:	|              |  |  |                        48 89 ef             	mov    %rbp,%rdi
+    1e63:	|              |  |  |                        e8 28 0e 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            return len_ == 0;
+    1e68:	|              |  |  |                        48 8b 84 24 50 01 00 	mov    0x150(%rsp),%rax
+    1e6f:	|              |  |  |                        00 
+            if (is_empty()) { return None; }
+    1e70:	|              |  |  |                        48 85 c0             	test   %rax,%rax
+    1e73:	|              |  |  |           /----------- 0f 84 df 00 00 00    	je     1f58 <ex3()+0x248>
+            len_ -= 1;
+    1e79:	|              |  |  |           |            48 83 e8 01          	sub    $0x1,%rax
+            if (rp_ == N) { rp_ = 0; }
+    1e7d:	|              |  |  |           |            31 c9                	xor    %ecx,%ecx
+            nel::elem::move(data_, o.data_, N);
+    1e7f:	|              |  |  |           |            48 8d 7c 24 44       	lea    0x44(%rsp),%rdi
+            return *this;
+        }
+
+    private:
+        constexpr Optional(Phantom<Tag::SOME> const, T &&v)
+            : tag_(Tag::SOME)
+    1e84:	|              |  |  |           |            c7 44 24 40 02 00 00 	movl   $0x2,0x40(%rsp)
+    1e8b:	|              |  |  |           |            00 
+            len_ -= 1;
+    1e8c:	|              |  |  |           |            48 89 84 24 50 01 00 	mov    %rax,0x150(%rsp)
+    1e93:	|              |  |  |           |            00 
+            auto rp = rp_;
+    1e94:	|              |  |  |           |            48 8b 84 24 60 01 00 	mov    0x160(%rsp),%rax
+    1e9b:	|              |  |  |           |            00 
+            if (rp_ == N) { rp_ = 0; }
+    1e9c:	|              |  |  |           |            48 83 f8 04          	cmp    $0x4,%rax
+            rp_ += 1;
+    1ea0:	|              |  |  |           |            48 8d 50 01          	lea    0x1(%rax),%rdx
+            if (rp_ == N) { rp_ = 0; }
+    1ea4:	|              |  |  |           |            48 0f 44 d1          	cmove  %rcx,%rdx
+            return &ptr()[d];
+    1ea8:	|              |  |  |           |            48 8b 4c 24 10       	mov    0x10(%rsp),%rcx
+    1ead:	|              |  |  |           |            48 c1 e0 08          	shl    $0x8,%rax
+    1eb1:	|              |  |  |           |            48 89 94 24 60 01 00 	mov    %rdx,0x160(%rsp)
+    1eb8:	|              |  |  |           |            00 
+    1eb9:	|              |  |  |           |            48 8d 34 01          	lea    (%rcx,%rax,1),%rsi
+    1ebd:	|              |  |  |           |            ba 00 01 00 00       	mov    $0x100,%edx
+    1ec2:	|              |  |  |           |            e8 69 05 00 00       	call   2430 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+        }
+
+    public:
+        friend Log &operator<<(Log &outs, Optional const &val)
+        {
+            switch (val.tag_) {
+    1ec7:	|              |  |  |           |            8b 44 24 40          	mov    0x40(%rsp),%eax
+    1ecb:	|              |  |  |           |            83 f8 02             	cmp    $0x2,%eax
+    1ece:	|     /--------|--|--|-----------|----------- 0f 84 61 04 00 00    	je     2335 <ex3()+0x625>
+    1ed4:	|     |        |  |  |  /--------|----------- 0f 8f 8c 01 00 00    	jg     2066 <ex3()+0x356>
+    1eda:	|     |        |  |  |  |        |            85 c0                	test   %eax,%eax
+    1edc:	|     |        |  |  |  |  /-----|----------- 0f 85 7b 01 00 00    	jne    205d <ex3()+0x34d>
+                    outs << "))";
+                    return outs;
+                    break;
+                case Tag::INVAL:
+                    outs << "Optional("
+                         << "Inval)";
+    1ee2:	|     |        |  |  |  |  |     |            48 8d 35 32 11 00 00 	lea    0x1132(%rip),%rsi        # 301b <_IO_stdin_used+0x1b>
+    1ee9:	|     |        |  |  |  |  |     |            48 89 ef             	mov    %rbp,%rdi
+    1eec:	|     |        |  |  |  |  |     |            e8 bf 0d 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    1ef1:	|     |        |  |  |  |  |     |            48 8d 35 3c 11 00 00 	lea    0x113c(%rip),%rsi        # 3034 <_IO_stdin_used+0x34>
+    1ef8:	|     |        |  |  |  |  |     |            48 89 c7             	mov    %rax,%rdi
+    1efb:	|     |        |  |  |  |  |     |            e8 b0 0d 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    nel::log << e << '\n';
+    1f00:	|  /--|--------|--|--|--|--|-----|----------> be 0a 00 00 00       	mov    $0xa,%esi
+    1f05:	|  |  |        |  |  |  |  |     |            48 89 ef             	mov    %rbp,%rdi
+    1f08:	|  |  |        |  |  |  |  |     |            e8 83 0d 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            switch (tag_) { // optional::dtor
+    1f0d:	|  |  |        |  |  |  |  |     |            8b 44 24 40          	mov    0x40(%rsp),%eax
+    1f11:	|  |  |        |  |  |  |  |     |            83 f8 01             	cmp    $0x1,%eax
+    1f14:	|  |  |        |  |  |  |  |     |     /----- 7f 6a                	jg     1f80 <ex3()+0x270>
+    1f16:	|  |  |        |  |  |  |  |     |     |      85 c0                	test   %eax,%eax
+    1f18:	|  |  |        |  |  |  |  |     |  /--|----- 79 7f                	jns    1f99 <ex3()+0x289>
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1f1a:	|  |  |        |  |  |  |  |     |  |  |  /-> 48 8d 05 2d 11 00 00 	lea    0x112d(%rip),%rax        # 304e <_IO_stdin_used+0x4e>
+    1f21:	|  |  |        |  |  |  |  |     |  |  |  |   48 8d 0d 1c 11 00 00 	lea    0x111c(%rip),%rcx        # 3044 <_IO_stdin_used+0x44>
+            , file_name_(file_name)
+            , line_num_(line_num)
+    1f28:	|  |  |        |  |  |  |  |     |  |  |  |   c7 44 24 30 87 00 00 	movl   $0x87,0x30(%rsp)
+    1f2f:	|  |  |        |  |  |  |  |     |  |  |  |   00 
+            : fn_name_(fn_name)
+    1f30:	|  |  |        |  |  |  |  |     |  |  |  |   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    1f35:	|  |  |        |  |  |  |  |     |  |  |  |   66 48 0f 6e c8       	movq   %rax,%xmm1
+                    nel::panic("bad Optional");
+    1f3a:	|  |  |        |  |  |  |  |     |  |  |  |   48 8d 74 24 20       	lea    0x20(%rsp),%rsi
+    1f3f:	|  |  |        |  |  |  |  |     |  |  |  |   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    1f43:	|  |  |        |  |  |  |  |     |  |  |  |   48 8d 3d 18 11 00 00 	lea    0x1118(%rip),%rdi        # 3062 <_IO_stdin_used+0x62>
+    1f4a:	|  |  |        |  |  |  |  |     |  |  |  |   0f 29 44 24 20       	movaps %xmm0,0x20(%rsp)
+    1f4f:	|  |  |        |  |  |  |  |     |  |  |  |   e8 ce f1 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1f54:	|  |  |        |  |  |  |  |     |  |  |  |   0f 1f 40 00          	nopl   0x0(%rax)
+            : tag_(Tag::NONE)
+    1f58:	|  |  |        |  |  |  |  |     \--|--|--|-> c7 44 24 40 01 00 00 	movl   $0x1,0x40(%rsp)
+    1f5f:	|  |  |        |  |  |  |  |        |  |  |   00 
+                         << "None)";
+    1f60:	|  |  |        |  |  |  |  |  /-----|--|--|-> 48 89 ef             	mov    %rbp,%rdi
+    1f63:	|  |  |        |  |  |  |  |  |     |  |  |   48 8d 35 b1 10 00 00 	lea    0x10b1(%rip),%rsi        # 301b <_IO_stdin_used+0x1b>
+    1f6a:	|  |  |        |  |  |  |  |  |     |  |  |   e8 41 0d 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    1f6f:	|  |  |        |  |  |  |  |  |     |  |  |   48 8d 35 af 10 00 00 	lea    0x10af(%rip),%rsi        # 3025 <_IO_stdin_used+0x25>
+    1f76:	|  |  |        |  |  |  |  |  |     |  |  |   48 89 c7             	mov    %rax,%rdi
+    1f79:	|  |  |        |  |  |  |  |  |     |  |  |   e8 32 0d 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+                    return outs;
+    1f7e:	|  +--|--------|--|--|--|--|--|-----|--|--|-- eb 80                	jmp    1f00 <ex3()+0x1f0>
+            switch (tag_) { // optional::dtor
+    1f80:	|  |  |        |  |  |  |  |  |     |  \--|-> 83 f8 02             	cmp    $0x2,%eax
+    1f83:	|  |  |        |  |  |  |  |  |     |     \-- 75 95                	jne    1f1a <ex3()+0x20a>
+            nel::elem::set(data_, 0xa5, N);
+    1f85:	|  |  |        |  |  |  |  |  |     |         48 8d 7c 24 44       	lea    0x44(%rsp),%rdi
+    1f8a:	|  |  |        |  |  |  |  |  |     |         ba 00 01 00 00       	mov    $0x100,%edx
+    1f8f:	|  |  |        |  |  |  |  |  |     |         be a5 00 00 00       	mov    $0xa5,%esi
+    1f94:	|  |  |        |  |  |  |  |  |     |         e8 87 04 00 00       	call   2420 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            if (len() == 0) {
+    1f99:	|  |  |        |  |  |  |  |  |     \-------> 48 83 bc 24 50 01 00 	cmpq   $0x0,0x150(%rsp)
+    1fa0:	|  |  |        |  |  |  |  |  |               00 00 
+    1fa2:	|  |  |        |  |  |  |  |  |  /----------- 0f 84 88 00 00 00    	je     2030 <ex3()+0x320>
+            } else if (rp_ < wp_) {
+    1fa8:	|  |  |        |  |  |  |  |  |  |            48 8b 94 24 60 01 00 	mov    0x160(%rsp),%rdx
+    1faf:	|  |  |        |  |  |  |  |  |  |            00 
+    1fb0:	|  |  |        |  |  |  |  |  |  |            48 8b 84 24 58 01 00 	mov    0x158(%rsp),%rax
+    1fb7:	|  |  |        |  |  |  |  |  |  |            00 
+            return &ptr()[d];
+    1fb8:	|  |  |        |  |  |  |  |  |  |            4c 8b 64 24 10       	mov    0x10(%rsp),%r12
+    1fbd:	|  |  |        |  |  |  |  |  |  |            49 89 d5             	mov    %rdx,%r13
+    1fc0:	|  |  |        |  |  |  |  |  |  |            48 89 c5             	mov    %rax,%rbp
+    1fc3:	|  |  |        |  |  |  |  |  |  |            49 c1 e5 08          	shl    $0x8,%r13
+    1fc7:	|  |  |        |  |  |  |  |  |  |            48 c1 e5 08          	shl    $0x8,%rbp
+    1fcb:	|  |  |        |  |  |  |  |  |  |            4d 01 e5             	add    %r12,%r13
+    1fce:	|  |  |        |  |  |  |  |  |  |            4c 01 e5             	add    %r12,%rbp
+            } else if (rp_ < wp_) {
+    1fd1:	|  |  |        |  |  |  |  |  |  |            48 39 c2             	cmp    %rax,%rdx
+    1fd4:	|  |  |  /-----|--|--|--|--|--|--|----------- 0f 82 51 03 00 00    	jb     232b <ex3()+0x61b>
+            , e_(move(o.e_))
+    1fda:	|  |  |  |     |  |  |  |  |  |  |            48 89 eb             	mov    %rbp,%rbx
+    1fdd:	|  |  |  |     |  |  |  |  |  |  |            48 8d ac 24 68 06 00 	lea    0x668(%rsp),%rbp
+    1fe4:	|  |  |  |     |  |  |  |  |  |  |            00 
+            return it1_.is_done() && it2_.is_done();
+    1fe5:	|  |  |  |  /--|--|--|--|--|--|--|----------> 49 39 ed             	cmp    %rbp,%r13
+    1fe8:	|  |  |  |  |  |  |  |  |  |  |  |     /----- 74 23                	je     200d <ex3()+0x2fd>
+            return (!it2_.is_done()) ? it2_.deref_back() : it1_.deref_back();
+    1fea:	|  |  |  |  |  |  |  |  |  |  |  |     |  /-> 4c 39 e3             	cmp    %r12,%rbx
+    1fed:	|  |  |  |  |  |  |  |  |  |  |  |  /--|--|-- 74 53                	je     2042 <ex3()+0x332>
+            return *(e_ - 1);
+    1fef:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    1ff6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1ffb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    2000:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |   48 89 df             	mov    %rbx,%rdi
+    2003:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |   e8 18 04 00 00       	call   2420 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return it1_.is_done() && it2_.is_done();
+    2008:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |   49 39 ed             	cmp    %rbp,%r13
+    200b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  \-- 75 dd                	jne    1fea <ex3()+0x2da>
+    200d:	|  |  |  |  |  |  |  |  |  |  |  |  |  \----> 4c 39 e3             	cmp    %r12,%rbx
+    2010:	|  |  |  |  |  |  |  |  |  |  |  +--|-------- 74 1e                	je     2030 <ex3()+0x320>
+    2012:	|  |  |  |  |  |  |  |  |  |  |  |  |     /-> 48 81 eb 00 01 00 00 	sub    $0x100,%rbx
+    2019:	|  |  |  |  |  |  |  |  |  |  |  |  |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    201e:	|  |  |  |  |  |  |  |  |  |  |  |  |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    2023:	|  |  |  |  |  |  |  |  |  |  |  |  |     |   48 89 df             	mov    %rbx,%rdi
+    2026:	|  |  |  |  |  |  |  |  |  |  |  |  |     |   e8 f5 03 00 00       	call   2420 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    202b:	|  |  |  |  |  |  |  |  |  |  |  |  |     |   49 39 dc             	cmp    %rbx,%r12
+    202e:	|  |  |  |  |  |  |  |  |  |  |  |  |     \-- 75 e2                	jne    2012 <ex3()+0x302>
+}
+    2030:	|  |  |  |  |  |  |  |  |  |  |  \--|-------> 48 81 c4 78 06 00 00 	add    $0x678,%rsp
+    2037:	|  |  |  |  |  |  |  |  |  |  |     |         5b                   	pop    %rbx
+    2038:	|  |  |  |  |  |  |  |  |  |  |     |         5d                   	pop    %rbp
+    2039:	|  |  |  |  |  |  |  |  |  |  |     |         41 5c                	pop    %r12
+    203b:	|  |  |  |  |  |  |  |  |  |  |     |         41 5d                	pop    %r13
+    203d:	|  |  |  |  |  |  |  |  |  |  |     |         41 5e                	pop    %r14
+    203f:	|  |  |  |  |  |  |  |  |  |  |     |         41 5f                	pop    %r15
+    2041:	|  |  |  |  |  |  |  |  |  |  |     |         c3                   	ret
+    2042:	|  |  |  |  |  |  |  |  |  |  |     \-------> 48 81 ed 00 01 00 00 	sub    $0x100,%rbp
+    2049:	|  |  |  |  |  |  |  |  |  |  |               ba 00 01 00 00       	mov    $0x100,%edx
+    204e:	|  |  |  |  |  |  |  |  |  |  |               be a5 00 00 00       	mov    $0xa5,%esi
+    2053:	|  |  |  |  |  |  |  |  |  |  |               48 89 ef             	mov    %rbp,%rdi
+    2056:	|  |  |  |  |  |  |  |  |  |  |               e8 c5 03 00 00       	call   2420 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            for (; !self().is_done(); self().inc()) {
+    205b:	|  |  |  |  +--|--|--|--|--|--|-------------- eb 88                	jmp    1fe5 <ex3()+0x2d5>
+            switch (val.tag_) {
+    205d:	|  |  |  |  |  |  |  |  |  \--|-------------> 83 f8 01             	cmp    $0x1,%eax
+    2060:	|  |  |  |  |  |  |  |  |     \-------------- 0f 84 fa fe ff ff    	je     1f60 <ex3()+0x250>
+                    return outs;
+                    break;
+                default:
+                    outs << "Optional("
+                         << "Unknown)";
+    2066:	|  |  |  |  |  |  |  |  \-------------------> 48 89 ef             	mov    %rbp,%rdi
+    2069:	|  |  |  |  |  |  |  |                        48 8d 35 ab 0f 00 00 	lea    0xfab(%rip),%rsi        # 301b <_IO_stdin_used+0x1b>
+    2070:	|  |  |  |  |  |  |  |                        e8 3b 0c 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    2075:	|  |  |  |  |  |  |  |                        48 8d 35 bf 0f 00 00 	lea    0xfbf(%rip),%rsi        # 303b <_IO_stdin_used+0x3b>
+    207c:	|  |  |  |  |  |  |  |                        48 89 c7             	mov    %rax,%rdi
+    207f:	|  |  |  |  |  |  |  |                        e8 2c 0c 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+            }
+            return outs;
+    2084:	|  +--|--|--|--|--|--|----------------------- e9 77 fe ff ff       	jmp    1f00 <ex3()+0x1f0>
+                len_ += 1;
+    2089:	|  |  |  |  |  \--|--|----------------------> 48 83 c2 01          	add    $0x1,%rdx
+    208d:	|  |  |  |  |     |  |                        48 89 94 24 50 01 00 	mov    %rdx,0x150(%rsp)
+    2094:	|  |  |  |  |     |  |                        00 
+    2095:	|  |  |  |  |     \--|----------------------- e9 e1 fc ff ff       	jmp    1d7b <ex3()+0x6b>
+            } else if (rp_ < wp_) {
+    209a:	|  |  |  |  |        \----------------------> 48 8b 94 24 60 01 00 	mov    0x160(%rsp),%rdx
+    20a1:	|  |  |  |  |                                 00 
+    20a2:	|  |  |  |  |                                 48 8b 84 24 58 01 00 	mov    0x158(%rsp),%rax
+    20a9:	|  |  |  |  |                                 00 
+            outs << '[';
+    20aa:	|  |  |  |  |                                 be 5b 00 00 00       	mov    $0x5b,%esi
+    20af:	|  |  |  |  |                                 48 89 ef             	mov    %rbp,%rdi
+            return &ptr()[d];
+    20b2:	|  |  |  |  |                                 48 8b 4c 24 10       	mov    0x10(%rsp),%rcx
+    20b7:	|  |  |  |  |                                 49 89 d5             	mov    %rdx,%r13
+    20ba:	|  |  |  |  |                                 48 89 c3             	mov    %rax,%rbx
+    20bd:	|  |  |  |  |                                 49 c1 e5 08          	shl    $0x8,%r13
+    20c1:	|  |  |  |  |                                 48 c1 e3 08          	shl    $0x8,%rbx
+    20c5:	|  |  |  |  |                                 4e 8d 24 29          	lea    (%rcx,%r13,1),%r12
+    20c9:	|  |  |  |  |                                 48 01 d9             	add    %rbx,%rcx
+    20cc:	|  |  |  |  |                                 48 89 0c 24          	mov    %rcx,(%rsp)
+            } else if (rp_ < wp_) {
+    20d0:	|  |  |  |  |                                 48 39 c2             	cmp    %rax,%rdx
+    20d3:	|  |  |  |  |                 /-------------- 0f 83 17 02 00 00    	jae    22f0 <ex3()+0x5e0>
+    20d9:	|  |  |  |  |                 |               e8 b2 0b 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            return it1_.is_done() && it2_.is_done();
+    20de:	|  |  |  |  |                 |               49 39 dd             	cmp    %rbx,%r13
+    20e1:	+--|--|--|--|-----------------|-------------- 0f 84 5a fd ff ff    	je     1e41 <ex3()+0x131>
+            : b_(move(o.b_))
+    20e7:	|  |  |  |  |                 |               48 c7 44 24 18 00 00 	movq   $0x0,0x18(%rsp)
+    20ee:	|  |  |  |  |                 |               00 00 
+            , e_(move(o.e_))
+    20f0:	|  |  |  |  |                 |               48 8b 04 24          	mov    (%rsp),%rax
+            : b_(move(o.b_))
+    20f4:	|  |  |  |  |                 |               4d 89 e6             	mov    %r12,%r14
+            , e_(move(o.e_))
+    20f7:	|  |  |  |  |                 |               48 c7 04 24 00 00 00 	movq   $0x0,(%rsp)
+    20fe:	|  |  |  |  |                 |               00 
+    20ff:	|  |  |  |  |                 |               48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            outs << "U8Buf<" << val.len() << ">{";
+    2104:	|  |  |  |  |              /--|-------------> 48 8d 35 06 0f 00 00 	lea    0xf06(%rip),%rsi        # 3011 <_IO_stdin_used+0x11>
+    210b:	|  |  |  |  |              |  |               48 89 ef             	mov    %rbp,%rdi
+    210e:	|  |  |  |  |              |  |               49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+    2113:	|  |  |  |  |              |  |               49 81 c4 00 01 00 00 	add    $0x100,%r12
+    211a:	|  |  |  |  |              |  |               e8 91 0b 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    211f:	|  |  |  |  |              |  |               be 00 01 00 00       	mov    $0x100,%esi
+    2124:	|  |  |  |  |              |  |               4c 8d 2d ed 0e 00 00 	lea    0xeed(%rip),%r13        # 3018 <_IO_stdin_used+0x18>
+    212b:	|  |  |  |  |              |  |               48 89 c7             	mov    %rax,%rdi
+    212e:	|  |  |  |  |              |  |               e8 3d 0c 00 00       	call   2d70 <nel::operator<<(nel::Log&, unsigned long)>
+    2133:	|  |  |  |  |              |  |               4c 89 ee             	mov    %r13,%rsi
+    2136:	|  |  |  |  |              |  |               48 89 c7             	mov    %rax,%rdi
+    2139:	|  |  |  |  |              |  |               e8 72 0b 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    213e:	|  |  |  |  |              |  |               48 89 ef             	mov    %rbp,%rdi
+    2141:	|  |  |  |  |              |  |               41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    2148:	|  |  |  |  |              |  |               ff ff 
+    214a:	|  |  |  |  |              |  |               e8 81 0b 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    214f:	|  |  |  |  |              |  |               90                   	nop
+                    outs << ' ' << val.data_[i];
+    2150:	|  |  |  |  |              |  |           /-> be 20 00 00 00       	mov    $0x20,%esi
+    2155:	|  |  |  |  |              |  |           |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    2158:	|  |  |  |  |              |  |           |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    215c:	|  |  |  |  |              |  |           |   e8 2f 0b 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    2161:	|  |  |  |  |              |  |           |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    2165:	|  |  |  |  |              |  |           |   48 89 c7             	mov    %rax,%rdi
+    2168:	|  |  |  |  |              |  |           |   e8 63 0b 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    216d:	|  |  |  |  |              |  |           |   4c 39 e3             	cmp    %r12,%rbx
+    2170:	|  |  |  |  |              |  |           \-- 75 de                	jne    2150 <ex3()+0x440>
+            outs << '}';
+    2172:	|  |  |  |  |              |  |               be 7d 00 00 00       	mov    $0x7d,%esi
+    2177:	|  |  |  |  |              |  |               48 89 ef             	mov    %rbp,%rdi
+    217a:	|  |  |  |  |              |  |               e8 11 0b 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            if (!it1_.is_done()) {
+    217f:	|  |  |  |  |              |  |               48 8b 4c 24 08       	mov    0x8(%rsp),%rcx
+    2184:	|  |  |  |  |              |  |               4c 39 f1             	cmp    %r14,%rcx
+    2187:	|  |  |  |  |              |  |  /----------- 0f 84 90 01 00 00    	je     231d <ex3()+0x60d>
+            ++b_;
+    218d:	|  |  |  |  |              |  |  |            49 8d 86 00 01 00 00 	lea    0x100(%r14),%rax
+            for (; !self().is_done(); self().inc()) {
+    2194:	|  |  |  |  |              |  |  |            48 39 c1             	cmp    %rax,%rcx
+    2197:	|  |  |  |  |              |  |  |  /-------- 0f 84 9c 00 00 00    	je     2239 <ex3()+0x529>
+    219d:	|  |  |  |  |              |  |  |  |         49 81 c6 00 02 00 00 	add    $0x200,%r14
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    21a4:	|  |  |  |  |              |  |  |  |  /----> be 2c 00 00 00       	mov    $0x2c,%esi
+    21a9:	|  |  |  |  |              |  |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    21ac:	|  |  |  |  |              |  |  |  |  |      4d 89 f7             	mov    %r14,%r15
+    21af:	|  |  |  |  |              |  |  |  |  |      e8 dc 0a 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            outs << "U8Buf<" << val.len() << ">{";
+    21b4:	|  |  |  |  |              |  |  |  |  |      48 8d 35 56 0e 00 00 	lea    0xe56(%rip),%rsi        # 3011 <_IO_stdin_used+0x11>
+    21bb:	|  |  |  |  |              |  |  |  |  |      49 8d 9e 01 ff ff ff 	lea    -0xff(%r14),%rbx
+    21c2:	|  |  |  |  |              |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    21c5:	|  |  |  |  |              |  |  |  |  |      49 89 c4             	mov    %rax,%r12
+    21c8:	|  |  |  |  |              |  |  |  |  |      e8 e3 0a 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    21cd:	|  |  |  |  |              |  |  |  |  |      be 00 01 00 00       	mov    $0x100,%esi
+    21d2:	|  |  |  |  |              |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    21d5:	|  |  |  |  |              |  |  |  |  |      e8 96 0b 00 00       	call   2d70 <nel::operator<<(nel::Log&, unsigned long)>
+    21da:	|  |  |  |  |              |  |  |  |  |      4c 89 ee             	mov    %r13,%rsi
+    21dd:	|  |  |  |  |              |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    21e0:	|  |  |  |  |              |  |  |  |  |      e8 cb 0a 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    21e5:	|  |  |  |  |              |  |  |  |  |      41 0f b6 b6 00 ff ff 	movzbl -0x100(%r14),%esi
+    21ec:	|  |  |  |  |              |  |  |  |  |      ff 
+    21ed:	|  |  |  |  |              |  |  |  |  |      4c 89 e7             	mov    %r12,%rdi
+    21f0:	|  |  |  |  |              |  |  |  |  |      e8 db 0a 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    21f5:	|  |  |  |  |              |  |  |  |  |      0f 1f 00             	nopl   (%rax)
+                    outs << ' ' << val.data_[i];
+    21f8:	|  |  |  |  |              |  |  |  |  |  /-> be 20 00 00 00       	mov    $0x20,%esi
+    21fd:	|  |  |  |  |              |  |  |  |  |  |   4c 89 e7             	mov    %r12,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    2200:	|  |  |  |  |              |  |  |  |  |  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    2204:	|  |  |  |  |              |  |  |  |  |  |   e8 87 0a 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    2209:	|  |  |  |  |              |  |  |  |  |  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    220d:	|  |  |  |  |              |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    2210:	|  |  |  |  |              |  |  |  |  |  |   e8 bb 0a 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    2215:	|  |  |  |  |              |  |  |  |  |  |   49 39 de             	cmp    %rbx,%r14
+    2218:	|  |  |  |  |              |  |  |  |  |  \-- 75 de                	jne    21f8 <ex3()+0x4e8>
+            outs << '}';
+    221a:	|  |  |  |  |              |  |  |  |  |      be 7d 00 00 00       	mov    $0x7d,%esi
+    221f:	|  |  |  |  |              |  |  |  |  |      4c 89 e7             	mov    %r12,%rdi
+            for (; !self().is_done(); self().inc()) {
+    2222:	|  |  |  |  |              |  |  |  |  |      49 81 c6 00 01 00 00 	add    $0x100,%r14
+    2229:	|  |  |  |  |              |  |  |  |  |      e8 62 0a 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    222e:	|  |  |  |  |              |  |  |  |  |      4c 39 7c 24 08       	cmp    %r15,0x8(%rsp)
+    2233:	|  |  |  |  |              |  |  |  |  \----- 0f 85 6b ff ff ff    	jne    21a4 <ex3()+0x494>
+    2239:	|  |  |  |  |              |  |  |  >-------> 48 8b 44 24 18       	mov    0x18(%rsp),%rax
+    223e:	|  |  |  |  |              |  |  |  |         48 8b 0c 24          	mov    (%rsp),%rcx
+    2242:	|  |  |  |  |              |  |  |  |         48 39 c8             	cmp    %rcx,%rax
+    2245:	+--|--|--|--|--------------|--|--|--|-------- 0f 84 f6 fb ff ff    	je     1e41 <ex3()+0x131>
+    224b:	|  |  |  |  |              |  |  |  |         48 05 00 01 00 00    	add    $0x100,%rax
+    2251:	|  |  |  |  |              |  |  |  |         49 89 c6             	mov    %rax,%r14
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    2254:	|  |  |  |  |              |  |  |  |  /----> be 2c 00 00 00       	mov    $0x2c,%esi
+    2259:	|  |  |  |  |              |  |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    225c:	|  |  |  |  |              |  |  |  |  |      4d 89 f7             	mov    %r14,%r15
+    225f:	|  |  |  |  |              |  |  |  |  |      e8 2c 0a 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            outs << "U8Buf<" << val.len() << ">{";
+    2264:	|  |  |  |  |              |  |  |  |  |      48 8d 35 a6 0d 00 00 	lea    0xda6(%rip),%rsi        # 3011 <_IO_stdin_used+0x11>
+    226b:	|  |  |  |  |              |  |  |  |  |      49 8d 9e 01 ff ff ff 	lea    -0xff(%r14),%rbx
+    2272:	|  |  |  |  |              |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    2275:	|  |  |  |  |              |  |  |  |  |      49 89 c4             	mov    %rax,%r12
+    2278:	|  |  |  |  |              |  |  |  |  |      e8 33 0a 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    227d:	|  |  |  |  |              |  |  |  |  |      be 00 01 00 00       	mov    $0x100,%esi
+    2282:	|  |  |  |  |              |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    2285:	|  |  |  |  |              |  |  |  |  |      e8 e6 0a 00 00       	call   2d70 <nel::operator<<(nel::Log&, unsigned long)>
+    228a:	|  |  |  |  |              |  |  |  |  |      4c 89 ee             	mov    %r13,%rsi
+    228d:	|  |  |  |  |              |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    2290:	|  |  |  |  |              |  |  |  |  |      e8 1b 0a 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    2295:	|  |  |  |  |              |  |  |  |  |      41 0f b6 b6 00 ff ff 	movzbl -0x100(%r14),%esi
+    229c:	|  |  |  |  |              |  |  |  |  |      ff 
+    229d:	|  |  |  |  |              |  |  |  |  |      4c 89 e7             	mov    %r12,%rdi
+    22a0:	|  |  |  |  |              |  |  |  |  |      e8 2b 0a 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    22a5:	|  |  |  |  |              |  |  |  |  |      0f 1f 00             	nopl   (%rax)
+                    outs << ' ' << val.data_[i];
+    22a8:	|  |  |  |  |              |  |  |  |  |  /-> be 20 00 00 00       	mov    $0x20,%esi
+    22ad:	|  |  |  |  |              |  |  |  |  |  |   4c 89 e7             	mov    %r12,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    22b0:	|  |  |  |  |              |  |  |  |  |  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    22b4:	|  |  |  |  |              |  |  |  |  |  |   e8 d7 09 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    22b9:	|  |  |  |  |              |  |  |  |  |  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    22bd:	|  |  |  |  |              |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    22c0:	|  |  |  |  |              |  |  |  |  |  |   e8 0b 0a 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    22c5:	|  |  |  |  |              |  |  |  |  |  |   49 39 de             	cmp    %rbx,%r14
+    22c8:	|  |  |  |  |              |  |  |  |  |  \-- 75 de                	jne    22a8 <ex3()+0x598>
+            outs << '}';
+    22ca:	|  |  |  |  |              |  |  |  |  |      be 7d 00 00 00       	mov    $0x7d,%esi
+    22cf:	|  |  |  |  |              |  |  |  |  |      4c 89 e7             	mov    %r12,%rdi
+            for (; !self().is_done(); self().inc()) {
+    22d2:	|  |  |  |  |              |  |  |  |  |      49 81 c6 00 01 00 00 	add    $0x100,%r14
+    22d9:	|  |  |  |  |              |  |  |  |  |      e8 b2 09 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    22de:	|  |  |  |  |              |  |  |  |  |      48 8b 04 24          	mov    (%rsp),%rax
+    22e2:	|  |  |  |  |              |  |  |  |  |      49 39 c7             	cmp    %rax,%r15
+    22e5:	|  |  |  |  |              |  |  |  |  \----- 0f 85 69 ff ff ff    	jne    2254 <ex3()+0x544>
+    22eb:	+--|--|--|--|--------------|--|--|--|-------- e9 51 fb ff ff       	jmp    1e41 <ex3()+0x131>
+            outs << '[';
+    22f0:	|  |  |  |  |              |  \--|--|-------> e8 9b 09 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+            return it1_.is_done() && it2_.is_done();
+    22f5:	|  |  |  |  |              |     |  |         48 8d 84 24 68 06 00 	lea    0x668(%rsp),%rax
+    22fc:	|  |  |  |  |              |     |  |         00 
+    22fd:	|  |  |  |  |              |     |  |         49 39 c4             	cmp    %rax,%r12
+    2300:	|  |  |  |  |              |     |  |  /----- 0f 84 dd 00 00 00    	je     23e3 <ex3()+0x6d3>
+            : b_(move(o.b_))
+    2306:	|  |  |  |  |              |     |  |  |      48 8b 4c 24 10       	mov    0x10(%rsp),%rcx
+            , e_(move(o.e_))
+    230b:	|  |  |  |  |              |     |  |  |      48 89 44 24 08       	mov    %rax,0x8(%rsp)
+            : b_(move(o.b_))
+    2310:	|  |  |  |  |              |     |  |  |      4d 89 e6             	mov    %r12,%r14
+    2313:	|  |  |  |  |              |     |  |  |      48 89 4c 24 18       	mov    %rcx,0x18(%rsp)
+    2318:	|  |  |  |  |              +-----|--|--|----- e9 e7 fd ff ff       	jmp    2104 <ex3()+0x3f4>
+            ++b_;
+    231d:	|  |  |  |  |              |     \--|--|----> 48 81 44 24 18 00 01 	addq   $0x100,0x18(%rsp)
+    2324:	|  |  |  |  |              |        |  |      00 00 
+    2326:	|  |  |  |  |              |        \--|----- e9 0e ff ff ff       	jmp    2239 <ex3()+0x529>
+            , e_(move(o.e_))
+    232b:	|  |  |  \--|--------------|-----------|----> 31 db                	xor    %ebx,%ebx
+            : b_(move(o.b_))
+    232d:	|  |  |     |              |           |      45 31 e4             	xor    %r12d,%r12d
+        void for_each(F &&fn)
+    2330:	|  |  |     \--------------|-----------|----- e9 b0 fc ff ff       	jmp    1fe5 <ex3()+0x2d5>
+                         << "Some(";
+    2335:	|  |  \--------------------|-----------|----> 48 8d 35 df 0c 00 00 	lea    0xcdf(%rip),%rsi        # 301b <_IO_stdin_used+0x1b>
+    233c:	|  |                       |           |      48 89 ef             	mov    %rbp,%rdi
+    233f:	|  |                       |           |      48 8d 5c 24 45       	lea    0x45(%rsp),%rbx
+    2344:	|  |                       |           |      e8 67 09 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    2349:	|  |                       |           |      48 8d 35 db 0c 00 00 	lea    0xcdb(%rip),%rsi        # 302b <_IO_stdin_used+0x2b>
+    2350:	|  |                       |           |      4c 8d a4 24 44 01 00 	lea    0x144(%rsp),%r12
+    2357:	|  |                       |           |      00 
+    2358:	|  |                       |           |      48 89 c7             	mov    %rax,%rdi
+    235b:	|  |                       |           |      e8 50 09 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+            outs << "U8Buf<" << val.len() << ">{";
+    2360:	|  |                       |           |      48 8d 35 aa 0c 00 00 	lea    0xcaa(%rip),%rsi        # 3011 <_IO_stdin_used+0x11>
+    2367:	|  |                       |           |      48 89 ef             	mov    %rbp,%rdi
+    236a:	|  |                       |           |      e8 41 09 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+    236f:	|  |                       |           |      be 00 01 00 00       	mov    $0x100,%esi
+    2374:	|  |                       |           |      48 89 c7             	mov    %rax,%rdi
+    2377:	|  |                       |           |      e8 f4 09 00 00       	call   2d70 <nel::operator<<(nel::Log&, unsigned long)>
+    237c:	|  |                       |           |      48 8d 35 95 0c 00 00 	lea    0xc95(%rip),%rsi        # 3018 <_IO_stdin_used+0x18>
+    2383:	|  |                       |           |      48 89 c7             	mov    %rax,%rdi
+    2386:	|  |                       |           |      e8 25 09 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    238b:	|  |                       |           |      0f b6 74 24 44       	movzbl 0x44(%rsp),%esi
+    2390:	|  |                       |           |      48 89 ef             	mov    %rbp,%rdi
+    2393:	|  |                       |           |      e8 38 09 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    2398:	|  |                       |           |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    239f:	|  |                       |           |      00 
+                    outs << ' ' << val.data_[i];
+    23a0:	|  |                       |           |  /-> be 20 00 00 00       	mov    $0x20,%esi
+    23a5:	|  |                       |           |  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    23a8:	|  |                       |           |  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    23ac:	|  |                       |           |  |   e8 df 08 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+    23b1:	|  |                       |           |  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    23b5:	|  |                       |           |  |   48 89 c7             	mov    %rax,%rdi
+    23b8:	|  |                       |           |  |   e8 13 09 00 00       	call   2cd0 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    23bd:	|  |                       |           |  |   49 39 dc             	cmp    %rbx,%r12
+    23c0:	|  |                       |           |  \-- 75 de                	jne    23a0 <ex3()+0x690>
+            outs << '}';
+    23c2:	|  |                       |           |      48 89 ef             	mov    %rbp,%rdi
+    23c5:	|  |                       |           |      be 7d 00 00 00       	mov    $0x7d,%esi
+    23ca:	|  |                       |           |      e8 c1 08 00 00       	call   2c90 <nel::operator<<(nel::Log&, char)>
+                    outs << "))";
+    23cf:	|  |                       |           |      48 8d 35 5b 0c 00 00 	lea    0xc5b(%rip),%rsi        # 3031 <_IO_stdin_used+0x31>
+    23d6:	|  |                       |           |      48 89 ef             	mov    %rbp,%rdi
+    23d9:	|  |                       |           |      e8 d2 08 00 00       	call   2cb0 <nel::operator<<(nel::Log&, char const*)>
+                    return outs;
+    23de:	|  \-----------------------|-----------|----- e9 1d fb ff ff       	jmp    1f00 <ex3()+0x1f0>
+            return it1_.is_done() && it2_.is_done();
+    23e3:	|                          |           \----> 48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    23e8:	|                          |                  48 39 04 24          	cmp    %rax,(%rsp)
+    23ec:	\--------------------------|----------------- 0f 84 4f fa ff ff    	je     1e41 <ex3()+0x131>
+            , e_(move(o.e_))
+    23f2:	                           |                  4c 89 64 24 08       	mov    %r12,0x8(%rsp)
+    23f7:	                           |                  4d 89 e6             	mov    %r12,%r14
+            : b_(move(o.b_))
+    23fa:	                           |                  49 89 c4             	mov    %rax,%r12
+    23fd:	                           |                  48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    2402:	                           \----------------- e9 fd fc ff ff       	jmp    2104 <ex3()+0x3f4>
+    2407:	                                              66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    240e:	                                              00 00 
+
+0000000000002410 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    2410:	e9 8b ec ff ff       	jmp    10a0 <memcpy@plt>
+    2415:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    241c:	00 00 00 00 
+
+0000000000002420 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    2420:	40 0f b6 f6          	movzbl %sil,%esi
+    2424:	e9 37 ec ff ff       	jmp    1060 <memset@plt>
+    2429:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002430 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+}
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    2430:	e9 6b ec ff ff       	jmp    10a0 <memcpy@plt>
+    2435:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    243c:	00 00 00 00 
+
+0000000000002440 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    2440:	e9 8b ec ff ff       	jmp    10d0 <memmove@plt>
+    2445:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    244c:	00 00 00 00 
+
+0000000000002450 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    2450:	48 89 f2             	mov    %rsi,%rdx
+    std::memset(d, s, n);
+    2453:	be a5 00 00 00       	mov    $0xa5,%esi
+    2458:	e9 03 ec ff ff       	jmp    1060 <memset@plt>
+    245d:	0f 1f 00             	nopl   (%rax)
+
+0000000000002460 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+    set(d, 0xa5, n);
+}
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    2460:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    2464:	e8 17 ec ff ff       	call   1080 <memcmp@plt>
+    2469:	85 c0                	test   %eax,%eax
+    246b:	0f 94 c0             	sete   %al
+}
+    246e:	48 83 c4 08          	add    $0x8,%rsp
+    2472:	c3                   	ret
+    2473:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    247a:	00 00 00 00 
+    247e:	66 90                	xchg   %ax,%ax
+
+0000000000002480 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    2480:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    2484:	e8 f7 eb ff ff       	call   1080 <memcmp@plt>
+    2489:	85 c0                	test   %eax,%eax
+    248b:	0f 95 c0             	setne  %al
+}
+    248e:	48 83 c4 08          	add    $0x8,%rsp
+    2492:	c3                   	ret
+    2493:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    249a:	00 00 00 00 
+    249e:	66 90                	xchg   %ax,%ax
+
+00000000000024a0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    if (n < streaming_min) {
+    24a0:	                48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    24a7:	/-------------- 0f 86 d7 00 00 00    	jbe    2584 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xe4>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    24ad:	|               48 89 f9             	mov    %rdi,%rcx
+{
+    24b0:	|               53                   	push   %rbx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    24b1:	|               48 f7 d9             	neg    %rcx
+    24b4:	|               83 e1 0f             	and    $0xf,%ecx
+    std::memcpy(d, s, n);
+    24b7:	|               83 f9 08             	cmp    $0x8,%ecx
+    24ba:	|     /-------- 0f 82 d0 00 00 00    	jb     2590 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xf0>
+    24c0:	|     |         48 8b 06             	mov    (%rsi),%rax
+    24c3:	|     |         4c 8d 57 08          	lea    0x8(%rdi),%r10
+    24c7:	|     |         48 89 f3             	mov    %rsi,%rbx
+    24ca:	|     |         49 83 e2 f8          	and    $0xfffffffffffffff8,%r10
+    24ce:	|     |         48 89 07             	mov    %rax,(%rdi)
+    24d1:	|     |         48 8b 44 0e f8       	mov    -0x8(%rsi,%rcx,1),%rax
+    24d6:	|     |         48 89 44 0f f8       	mov    %rax,-0x8(%rdi,%rcx,1)
+    24db:	|     |         48 89 f8             	mov    %rdi,%rax
+    24de:	|     |         4c 29 d0             	sub    %r10,%rax
+    24e1:	|     |         48 29 c3             	sub    %rax,%rbx
+    24e4:	|     |         01 c8                	add    %ecx,%eax
+    24e6:	|     |         83 e0 f8             	and    $0xfffffff8,%eax
+    24e9:	|     |         83 f8 08             	cmp    $0x8,%eax
+    24ec:	|  /--|-------- 72 1a                	jb     2508 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    24ee:	|  |  |         83 e0 f8             	and    $0xfffffff8,%eax
+    24f1:	|  |  |         45 31 c0             	xor    %r8d,%r8d
+    24f4:	|  |  |     /-> 45 89 c1             	mov    %r8d,%r9d
+    24f7:	|  |  |     |   41 83 c0 08          	add    $0x8,%r8d
+    24fb:	|  |  |     |   4e 8b 1c 0b          	mov    (%rbx,%r9,1),%r11
+    24ff:	|  |  |     |   4f 89 1c 0a          	mov    %r11,(%r10,%r9,1)
+    2503:	|  |  |     |   41 39 c0             	cmp    %eax,%r8d
+    2506:	|  |  |     \-- 72 ec                	jb     24f4 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x54>
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    2508:	|  >--|-------> 48 8d 41 40          	lea    0x40(%rcx),%rax
+    250c:	|  |  |         48 01 f9             	add    %rdi,%rcx
+    250f:	|  |  |         90                   	nop
+    std::memcpy(&v, s, sizeof(v));
+    2510:	|  |  |     /-> f3 0f 6f 54 06 d0    	movdqu -0x30(%rsi,%rax,1),%xmm2
+    2516:	|  |  |     |   f3 0f 6f 4c 06 e0    	movdqu -0x20(%rsi,%rax,1),%xmm1
+    251c:	|  |  |     |   49 89 c0             	mov    %rax,%r8
+    for (; i + 64 <= n; i += 64) {
+    251f:	|  |  |     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    2523:	|  |  |     |   f3 0f 6f 44 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2529:	|  |  |     |   f3 0f 6f 5c 06 c0    	movdqu -0x40(%rsi,%rax,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    252f:	|  |  |     |   48 83 c0 40          	add    $0x40,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2533:	|  |  |     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    2538:	|  |  |     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    253d:	|  |  |     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    2542:	|  |  |     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    2547:	|  |  |     |   48 39 c2             	cmp    %rax,%rdx
+    254a:	|  |  |     \-- 73 c4                	jae    2510 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x70>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    254c:	|  |  |         49 8d 40 10          	lea    0x10(%r8),%rax
+    2550:	|  |  |         48 39 c2             	cmp    %rax,%rdx
+    2553:	|  |  |  /----- 72 22                	jb     2577 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd7>
+    2555:	|  |  |  |      48 8d 4f f0          	lea    -0x10(%rdi),%rcx
+    2559:	|  |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2560:	|  |  |  |  /-> f3 0f 6f 64 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm4
+    2566:	|  |  |  |  |   49 89 c0             	mov    %rax,%r8
+    2569:	|  |  |  |  |   66 0f e7 24 01       	movntdq %xmm4,(%rcx,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    256e:	|  |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    2572:	|  |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    2575:	|  |  |  |  \-- 73 e9                	jae    2560 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc0>
+        stream16(d + i, load16(s + i));
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    2577:	|  |  |  \----> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    257a:	|  |  |         4c 01 c7             	add    %r8,%rdi
+    257d:	|  |  |         4c 29 c2             	sub    %r8,%rdx
+    2580:	|  |  |         4c 01 c6             	add    %r8,%rsi
+}
+    2583:	|  |  |         5b                   	pop    %rbx
+    std::memcpy(d, s, n);
+    2584:	\--|--|-------> e9 17 eb ff ff       	jmp    10a0 <memcpy@plt>
+    2589:	   |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    2590:	   |  \-------> f6 c1 04             	test   $0x4,%cl
+    2593:	   |        /-- 75 25                	jne    25ba <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x11a>
+    2595:	   |        |   85 c9                	test   %ecx,%ecx
+    2597:	   +--------|-- 0f 84 6b ff ff ff    	je     2508 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    259d:	   |        |   0f b6 06             	movzbl (%rsi),%eax
+    25a0:	   |        |   88 07                	mov    %al,(%rdi)
+    25a2:	   |        |   f6 c1 02             	test   $0x2,%cl
+    25a5:	   +--------|-- 0f 84 5d ff ff ff    	je     2508 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    25ab:	   |        |   0f b7 44 0e fe       	movzwl -0x2(%rsi,%rcx,1),%eax
+    25b0:	   |        |   66 89 44 0f fe       	mov    %ax,-0x2(%rdi,%rcx,1)
+    25b5:	   +--------|-- e9 4e ff ff ff       	jmp    2508 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    25ba:	   |        \-> 8b 06                	mov    (%rsi),%eax
+    25bc:	   |            89 07                	mov    %eax,(%rdi)
+    25be:	   |            8b 44 0e fc          	mov    -0x4(%rsi,%rcx,1),%eax
+    25c2:	   |            89 44 0f fc          	mov    %eax,-0x4(%rdi,%rcx,1)
+    25c6:	   \----------- e9 3d ff ff ff       	jmp    2508 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    25cb:	                0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000000025d0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    25d0:	                                           49 89 f8             	mov    %rdi,%r8
+    25d3:	                                           48 89 f1             	mov    %rsi,%rcx
+    if (n < streaming_min) {
+    25d6:	                                           48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    25dd:	                              /----------- 0f 86 85 03 00 00    	jbe    2968 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x398>
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    25e3:	                              |            48 89 fe             	mov    %rdi,%rsi
+{
+    25e6:	                              |            41 57                	push   %r15
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    25e8:	                              |            48 f7 de             	neg    %rsi
+{
+    25eb:	                              |            41 56                	push   %r14
+    for (Index i = 0; i < head; ++i) {
+    25ed:	                              |            48 89 f0             	mov    %rsi,%rax
+{
+    25f0:	                              |            41 55                	push   %r13
+    25f2:	                              |            41 54                	push   %r12
+    25f4:	                              |            55                   	push   %rbp
+    25f5:	                              |            53                   	push   %rbx
+    for (Index i = 0; i < head; ++i) {
+    25f6:	                              |            83 e0 0f             	and    $0xf,%eax
+    25f9:	/-----------------------------|----------- 0f 84 01 01 00 00    	je     2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    25ff:	|                             |            48 8d 78 ff          	lea    -0x1(%rax),%rdi
+    2603:	|                             |            48 83 ff 02          	cmp    $0x2,%rdi
+    2607:	|  /--------------------------|----------- 0f 86 8a 04 00 00    	jbe    2a97 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4c7>
+    260d:	|  |                          |            4c 8d 51 01          	lea    0x1(%rcx),%r10
+    2611:	|  |                          |            4d 89 c1             	mov    %r8,%r9
+    2614:	|  |                          |            4d 29 d1             	sub    %r10,%r9
+    2617:	|  |                          |            49 83 f9 06          	cmp    $0x6,%r9
+    261b:	|  |                          |  /-------- 0f 87 c7 02 00 00    	ja     28e8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x318>
+        d[i] = p[i];
+    2621:	|  |                          |  |         0f b6 39             	movzbl (%rcx),%edi
+    2624:	|  |                          |  |         41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2627:	|  |                          |  |         40 f6 c6 0e          	test   $0xe,%sil
+    262b:	+--|--------------------------|--|-------- 0f 84 cf 00 00 00    	je     2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2631:	|  |                          |  |         0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    2635:	|  |                          |  |         41 88 78 01          	mov    %dil,0x1(%r8)
+    2639:	|  |  /-----------------------|--|-------> 0f b6 79 02          	movzbl 0x2(%rcx),%edi
+    263d:	|  |  |                       |  |         41 88 78 02          	mov    %dil,0x2(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2641:	|  |  |                       |  |         40 f6 c6 0c          	test   $0xc,%sil
+    2645:	+--|--|-----------------------|--|-------- 0f 84 b5 00 00 00    	je     2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    264b:	|  |  |                       |  |         0f b6 79 03          	movzbl 0x3(%rcx),%edi
+    264f:	|  |  |                       |  |         41 88 78 03          	mov    %dil,0x3(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2653:	|  |  |                       |  |         48 83 f8 04          	cmp    $0x4,%rax
+    2657:	+--|--|-----------------------|--|-------- 0f 86 a3 00 00 00    	jbe    2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    265d:	|  |  |                       |  |         0f b6 79 04          	movzbl 0x4(%rcx),%edi
+    2661:	|  |  |                       |  |         41 88 78 04          	mov    %dil,0x4(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2665:	|  |  |                       |  |         48 83 f8 05          	cmp    $0x5,%rax
+    2669:	+--|--|-----------------------|--|-------- 0f 84 91 00 00 00    	je     2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    266f:	|  |  |                       |  |         0f b6 79 05          	movzbl 0x5(%rcx),%edi
+    2673:	|  |  |                       |  |         41 88 78 05          	mov    %dil,0x5(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2677:	|  |  |                       |  |         48 83 f8 06          	cmp    $0x6,%rax
+    267b:	+--|--|-----------------------|--|-------- 0f 84 7f 00 00 00    	je     2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2681:	|  |  |                       |  |         0f b6 79 06          	movzbl 0x6(%rcx),%edi
+    for (Index i = 0; i < head; ++i) {
+    2685:	|  |  |                       |  |         83 e6 08             	and    $0x8,%esi
+        d[i] = p[i];
+    2688:	|  |  |                       |  |         41 88 78 06          	mov    %dil,0x6(%r8)
+    for (Index i = 0; i < head; ++i) {
+    268c:	+--|--|-----------------------|--|-------- 74 72                	je     2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    268e:	|  |  |                       |  |         0f b6 71 07          	movzbl 0x7(%rcx),%esi
+    2692:	|  |  |                       |  |         41 88 70 07          	mov    %sil,0x7(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2696:	|  |  |                       |  |         48 83 f8 08          	cmp    $0x8,%rax
+    269a:	+--|--|-----------------------|--|-------- 76 64                	jbe    2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    269c:	|  |  |                       |  |         0f b6 71 08          	movzbl 0x8(%rcx),%esi
+    26a0:	|  |  |                       |  |         41 88 70 08          	mov    %sil,0x8(%r8)
+    for (Index i = 0; i < head; ++i) {
+    26a4:	|  |  |                       |  |         48 83 f8 09          	cmp    $0x9,%rax
+    26a8:	+--|--|-----------------------|--|-------- 74 56                	je     2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    26aa:	|  |  |                       |  |         0f b6 71 09          	movzbl 0x9(%rcx),%esi
+    26ae:	|  |  |                       |  |         41 88 70 09          	mov    %sil,0x9(%r8)
+    for (Index i = 0; i < head; ++i) {
+    26b2:	|  |  |                       |  |         48 83 f8 0a          	cmp    $0xa,%rax
+    26b6:	+--|--|-----------------------|--|-------- 74 48                	je     2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    26b8:	|  |  |                       |  |         0f b6 71 0a          	movzbl 0xa(%rcx),%esi
+    26bc:	|  |  |                       |  |         41 88 70 0a          	mov    %sil,0xa(%r8)
+    for (Index i = 0; i < head; ++i) {
+    26c0:	|  |  |                       |  |         48 83 f8 0b          	cmp    $0xb,%rax
+    26c4:	+--|--|-----------------------|--|-------- 74 3a                	je     2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    26c6:	|  |  |                       |  |         0f b6 71 0b          	movzbl 0xb(%rcx),%esi
+    26ca:	|  |  |                       |  |         41 88 70 0b          	mov    %sil,0xb(%r8)
+    for (Index i = 0; i < head; ++i) {
+    26ce:	|  |  |                       |  |         48 83 f8 0c          	cmp    $0xc,%rax
+    26d2:	+--|--|-----------------------|--|-------- 74 2c                	je     2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    26d4:	|  |  |                       |  |         0f b6 71 0c          	movzbl 0xc(%rcx),%esi
+    26d8:	|  |  |                       |  |         41 88 70 0c          	mov    %sil,0xc(%r8)
+    for (Index i = 0; i < head; ++i) {
+    26dc:	|  |  |                       |  |         48 83 f8 0d          	cmp    $0xd,%rax
+    26e0:	+--|--|-----------------------|--|-------- 74 1e                	je     2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    26e2:	|  |  |                       |  |         0f b6 71 0d          	movzbl 0xd(%rcx),%esi
+    26e6:	|  |  |                       |  |         41 88 70 0d          	mov    %sil,0xd(%r8)
+    for (Index i = 0; i < head; ++i) {
+    26ea:	|  |  |                       |  |         49 8d 70 ff          	lea    -0x1(%r8),%rsi
+    26ee:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    26f1:	+--|--|-----------------------|--|-------- 75 0d                	jne    2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    26f3:	|  |  |                       |  |         0f b6 71 0e          	movzbl 0xe(%rcx),%esi
+    26f7:	|  |  |                       |  |         41 88 70 0e          	mov    %sil,0xe(%r8)
+    for (Index i = 0; i < head; ++i) {
+    26fb:	|  |  |                       |  |         0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+        rotated[i] = p[(head + i) % 16];
+    2700:	>--|--|-----------------------|--|-------> 48 8d 70 07          	lea    0x7(%rax),%rsi
+    2704:	|  |  |                       |  |         4c 8d 78 06          	lea    0x6(%rax),%r15
+    2708:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    270b:	|  |  |                       |  |         4c 8d 70 05          	lea    0x5(%rax),%r14
+    270f:	|  |  |                       |  |         4c 8d 68 04          	lea    0x4(%rax),%r13
+    2713:	|  |  |                       |  |         41 83 e7 0f          	and    $0xf,%r15d
+    std::memcpy(&v, s, sizeof(v));
+    2717:	|  |  |                       |  |         0f b6 34 31          	movzbl (%rcx,%rsi,1),%esi
+        rotated[i] = p[(head + i) % 16];
+    271b:	|  |  |                       |  |         41 83 e6 0f          	and    $0xf,%r14d
+    271f:	|  |  |                       |  |         41 83 e5 0f          	and    $0xf,%r13d
+    2723:	|  |  |                       |  |         4c 8d 60 03          	lea    0x3(%rax),%r12
+    std::memcpy(&v, s, sizeof(v));
+    2727:	|  |  |                       |  |         46 0f b6 3c 39       	movzbl (%rcx,%r15,1),%r15d
+    272c:	|  |  |                       |  |         46 0f b6 34 31       	movzbl (%rcx,%r14,1),%r14d
+        rotated[i] = p[(head + i) % 16];
+    2731:	|  |  |                       |  |         48 8d 78 08          	lea    0x8(%rax),%rdi
+    2735:	|  |  |                       |  |         41 83 e4 0f          	and    $0xf,%r12d
+    std::memcpy(&v, s, sizeof(v));
+    2739:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    273d:	|  |  |                       |  |         46 0f b6 2c 29       	movzbl (%rcx,%r13,1),%r13d
+        rotated[i] = p[(head + i) % 16];
+    2742:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    2745:	|  |  |                       |  |         48 8d 68 02          	lea    0x2(%rax),%rbp
+    std::memcpy(&v, s, sizeof(v));
+    2749:	|  |  |                       |  |         4c 09 fe             	or     %r15,%rsi
+        rotated[i] = p[(head + i) % 16];
+    274c:	|  |  |                       |  |         48 89 7c 24 c8       	mov    %rdi,-0x38(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    2751:	|  |  |                       |  |         46 0f b6 24 21       	movzbl (%rcx,%r12,1),%r12d
+        rotated[i] = p[(head + i) % 16];
+    2756:	|  |  |                       |  |         83 e5 0f             	and    $0xf,%ebp
+    std::memcpy(&v, s, sizeof(v));
+    2759:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    275d:	|  |  |                       |  |         48 8d 78 09          	lea    0x9(%rax),%rdi
+    std::memcpy(&v, s, sizeof(v));
+    2761:	|  |  |                       |  |         0f b6 2c 29          	movzbl (%rcx,%rbp,1),%ebp
+        rotated[i] = p[(head + i) % 16];
+    2765:	|  |  |                       |  |         48 8d 58 01          	lea    0x1(%rax),%rbx
+    std::memcpy(&v, s, sizeof(v));
+    2769:	|  |  |                       |  |         4c 09 f6             	or     %r14,%rsi
+        rotated[i] = p[(head + i) % 16];
+    276c:	|  |  |                       |  |         49 89 fb             	mov    %rdi,%r11
+    276f:	|  |  |                       |  |         48 8d 78 0a          	lea    0xa(%rax),%rdi
+    2773:	|  |  |                       |  |         83 e3 0f             	and    $0xf,%ebx
+    std::memcpy(&v, s, sizeof(v));
+    2776:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    277a:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    277e:	|  |  |                       |  |         49 89 fa             	mov    %rdi,%r10
+    std::memcpy(&v, s, sizeof(v));
+    2781:	|  |  |                       |  |         4c 09 ee             	or     %r13,%rsi
+        rotated[i] = p[(head + i) % 16];
+    2784:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    2788:	|  |  |                       |  |         48 8d 78 0b          	lea    0xb(%rax),%rdi
+    278c:	|  |  |                       |  |         4c 89 5c 24 e0       	mov    %r11,-0x20(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    2791:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    2795:	|  |  |                       |  |         4c 8d 58 0f          	lea    0xf(%rax),%r11
+    2799:	|  |  |                       |  |         4c 89 54 24 e8       	mov    %r10,-0x18(%rsp)
+    279e:	|  |  |                       |  |         49 89 f9             	mov    %rdi,%r9
+    std::memcpy(&v, s, sizeof(v));
+    27a1:	|  |  |                       |  |         4c 09 e6             	or     %r12,%rsi
+        rotated[i] = p[(head + i) % 16];
+    27a4:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    27a8:	|  |  |                       |  |         4c 8d 50 0e          	lea    0xe(%rax),%r10
+    27ac:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    27b0:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    27b4:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    27b8:	|  |  |                       |  |         4c 89 4c 24 f0       	mov    %r9,-0x10(%rsp)
+    27bd:	|  |  |                       |  |         4c 8d 48 0d          	lea    0xd(%rax),%r9
+    std::memcpy(&v, s, sizeof(v));
+    27c1:	|  |  |                       |  |         48 09 ee             	or     %rbp,%rsi
+    27c4:	|  |  |                       |  |         0f b6 2c 19          	movzbl (%rcx,%rbx,1),%ebp
+    27c8:	|  |  |                       |  |         46 0f b6 14 11       	movzbl (%rcx,%r10,1),%r10d
+        rotated[i] = p[(head + i) % 16];
+    27cd:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    27d1:	|  |  |                       |  |         48 89 f3             	mov    %rsi,%rbx
+    27d4:	|  |  |                       |  |         42 0f b6 34 19       	movzbl (%rcx,%r11,1),%esi
+    27d9:	|  |  |                       |  |         46 0f b6 0c 09       	movzbl (%rcx,%r9,1),%r9d
+        rotated[i] = p[(head + i) % 16];
+    27de:	|  |  |                       |  |         48 8d 78 0c          	lea    0xc(%rax),%rdi
+    27e2:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    std::memcpy(&v, s, sizeof(v));
+    27e5:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    27e9:	|  |  |                       |  |         4c 8b 5c 24 e0       	mov    -0x20(%rsp),%r11
+    27ee:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    27f2:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    27f5:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    27f9:	|  |  |                       |  |         0f b6 2c 01          	movzbl (%rcx,%rax,1),%ebp
+    27fd:	|  |  |                       |  |         4c 09 d6             	or     %r10,%rsi
+    2800:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    2804:	|  |  |                       |  |         4c 8b 54 24 e8       	mov    -0x18(%rsp),%r10
+    2809:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    280d:	|  |  |                       |  |         4c 09 ce             	or     %r9,%rsi
+    2810:	|  |  |                       |  |         4c 8b 4c 24 f0       	mov    -0x10(%rsp),%r9
+    2815:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2819:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    281c:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    281f:	|  |  |                       |  |         42 0f b6 3c 09       	movzbl (%rcx,%r9,1),%edi
+    2824:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2828:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    282b:	|  |  |                       |  |         42 0f b6 3c 11       	movzbl (%rcx,%r10,1),%edi
+    2830:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2834:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    2837:	|  |  |                       |  |         42 0f b6 3c 19       	movzbl (%rcx,%r11,1),%edi
+    283c:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2840:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    2843:	|  |  |                       |  |         48 8b 7c 24 c8       	mov    -0x38(%rsp),%rdi
+    2848:	|  |  |                       |  |         48 89 5c 24 c8       	mov    %rbx,-0x38(%rsp)
+    284d:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2851:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    2855:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    2858:	|  |  |                       |  |         48 8d 78 40          	lea    0x40(%rax),%rdi
+    285c:	|  |  |                       |  |         4c 01 c0             	add    %r8,%rax
+    std::memcpy(&v, s, sizeof(v));
+    285f:	|  |  |                       |  |         48 89 74 24 d0       	mov    %rsi,-0x30(%rsp)
+    2864:	|  |  |                       |  |         66 0f 6f 44 24 c8    	movdqa -0x38(%rsp),%xmm0
+    for (; i + 64 <= n; i += 64) {
+    286a:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2870:	|  |  |                       |  |     /-> 48 89 fe             	mov    %rdi,%rsi
+    for (; i + 64 <= n; i += 64) {
+    2873:	|  |  |                       |  |     |   48 83 c7 40          	add    $0x40,%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2877:	|  |  |                       |  |     |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    287b:	|  |  |                       |  |     |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    2880:	|  |  |                       |  |     |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    2885:	|  |  |                       |  |     |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    288a:	|  |  |                       |  |     |   48 83 c0 40          	add    $0x40,%rax
+    288e:	|  |  |                       |  |     |   48 39 fa             	cmp    %rdi,%rdx
+    2891:	|  |  |                       |  |     \-- 73 dd                	jae    2870 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2a0>
+        stream16(d + i, v);
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+    2893:	|  |  |                       |  |         48 8d 46 10          	lea    0x10(%rsi),%rax
+    2897:	|  |  |                       |  |         48 39 c2             	cmp    %rax,%rdx
+    289a:	|  |  |                       |  |  /----- 72 15                	jb     28b1 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2e1>
+    289c:	|  |  |                       |  |  |      49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    28a0:	|  |  |                       |  |  |  /-> 48 89 c6             	mov    %rax,%rsi
+    28a3:	|  |  |                       |  |  |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    28a8:	|  |  |                       |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    28ac:	|  |  |                       |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    28af:	|  |  |                       |  |  |  \-- 73 ef                	jae    28a0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2d0>
+        stream16(d + i, v);
+    }
+    __builtin_ia32_sfence();
+    28b1:	|  |  |                       |  |  \----> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    28b4:	|  |  |                       |  |         48 39 d6             	cmp    %rdx,%rsi
+    28b7:	|  |  |                       |  |  /----- 73 1e                	jae    28d7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x307>
+    28b9:	|  |  |                       |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        d[i] = p[i % 16];
+    28c0:	|  |  |                       |  |  |  /-> 48 89 f0             	mov    %rsi,%rax
+    28c3:	|  |  |                       |  |  |  |   83 e0 0f             	and    $0xf,%eax
+    28c6:	|  |  |                       |  |  |  |   0f b6 04 01          	movzbl (%rcx,%rax,1),%eax
+    28ca:	|  |  |                       |  |  |  |   41 88 04 30          	mov    %al,(%r8,%rsi,1)
+    for (; i < n; ++i) {
+    28ce:	|  |  |                       |  |  |  |   48 83 c6 01          	add    $0x1,%rsi
+    28d2:	|  |  |                       |  |  |  |   48 39 f2             	cmp    %rsi,%rdx
+    28d5:	|  |  |                       |  |  |  \-- 75 e9                	jne    28c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2f0>
+    }
+}
+    28d7:	|  |  |                       |  |  \----> 5b                   	pop    %rbx
+    28d8:	|  |  |                       |  |         5d                   	pop    %rbp
+    28d9:	|  |  |                       |  |         41 5c                	pop    %r12
+    28db:	|  |  |                       |  |         41 5d                	pop    %r13
+    28dd:	|  |  |                       |  |         41 5e                	pop    %r14
+    28df:	|  |  |                       |  |         41 5f                	pop    %r15
+    28e1:	|  |  |                       |  |         c3                   	ret
+    28e2:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    28e8:	|  |  |                       |  \-------> 48 83 ff 06          	cmp    $0x6,%rdi
+    28ec:	|  |  |  /--------------------|----------- 0f 86 e1 01 00 00    	jbe    2ad3 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x503>
+        d[i] = p[i];
+    28f2:	|  |  |  |                    |            48 8b 31             	mov    (%rcx),%rsi
+    28f5:	|  |  |  |                    |            49 89 30             	mov    %rsi,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    28f8:	|  |  |  |                    |            48 83 f8 08          	cmp    $0x8,%rax
+    28fc:	+--|--|--|--------------------|----------- 0f 84 fe fd ff ff    	je     2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    2902:	|  |  |  |                    |            48 8d 70 f7          	lea    -0x9(%rax),%rsi
+    2906:	|  |  |  |                    |            4c 8d 48 f8          	lea    -0x8(%rax),%r9
+    290a:	|  |  |  |                    |            48 83 fe 02          	cmp    $0x2,%rsi
+    290e:	|  |  |  |                    |            be 08 00 00 00       	mov    $0x8,%esi
+    2913:	|  |  |  |                    |        /-- 76 15                	jbe    292a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x35a>
+        d[i] = p[i];
+    2915:	|  |  |  |  /-----------------|--------|-> 8b 3c 31             	mov    (%rcx,%rsi,1),%edi
+    2918:	|  |  |  |  |                 |        |   41 89 3c 30          	mov    %edi,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    291c:	|  |  |  |  |                 |        |   48 83 c6 04          	add    $0x4,%rsi
+    2920:	|  |  |  |  |                 |        |   49 83 f9 04          	cmp    $0x4,%r9
+    2924:	+--|--|--|--|-----------------|--------|-- 0f 84 d6 fd ff ff    	je     2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    292a:	|  |  |  |  |                 |        \-> 0f b6 3c 31          	movzbl (%rcx,%rsi,1),%edi
+    292e:	|  |  |  |  |                 |            41 88 3c 30          	mov    %dil,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    2932:	|  |  |  |  |                 |            48 8d 7e 01          	lea    0x1(%rsi),%rdi
+    2936:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    2939:	+--|--|--|--|-----------------|----------- 0f 83 c1 fd ff ff    	jae    2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    293f:	|  |  |  |  |                 |            0f b6 7c 31 01       	movzbl 0x1(%rcx,%rsi,1),%edi
+    2944:	|  |  |  |  |                 |            41 88 7c 30 01       	mov    %dil,0x1(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    2949:	|  |  |  |  |                 |            48 8d 7e 02          	lea    0x2(%rsi),%rdi
+    294d:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    2950:	+--|--|--|--|-----------------|----------- 0f 83 aa fd ff ff    	jae    2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2956:	|  |  |  |  |                 |            0f b6 7c 31 02       	movzbl 0x2(%rcx,%rsi,1),%edi
+    295b:	|  |  |  |  |                 |            41 88 7c 30 02       	mov    %dil,0x2(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    2960:	+--|--|--|--|-----------------|----------- e9 9b fd ff ff       	jmp    2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    2965:	|  |  |  |  |                 |            0f 1f 00             	nopl   (%rax)
+    Length done = (n < 16) ? n : 16;
+    2968:	|  |  |  |  |                 \----------> 41 ba 10 00 00 00    	mov    $0x10,%r10d
+    296e:	|  |  |  |  |                              4c 39 d2             	cmp    %r10,%rdx
+    2971:	|  |  |  |  |                              4c 0f 46 d2          	cmovbe %rdx,%r10
+    std::memcpy(d, s, n);
+    2975:	|  |  |  |  |                              44 89 d0             	mov    %r10d,%eax
+    2978:	|  |  |  |  |                              41 83 fa 08          	cmp    $0x8,%r10d
+    297c:	|  |  |  |  |        /-------------------- 0f 82 cc 00 00 00    	jb     2a4e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47e>
+    2982:	|  |  |  |  |        |                     48 8b 06             	mov    (%rsi),%rax
+    2985:	|  |  |  |  |        |                     4c 8d 4f 08          	lea    0x8(%rdi),%r9
+    2989:	|  |  |  |  |        |                     49 83 e1 f8          	and    $0xfffffffffffffff8,%r9
+    298d:	|  |  |  |  |        |                     48 89 07             	mov    %rax,(%rdi)
+    2990:	|  |  |  |  |        |                     44 89 d0             	mov    %r10d,%eax
+    2993:	|  |  |  |  |        |                     48 8b 74 06 f8       	mov    -0x8(%rsi,%rax,1),%rsi
+    2998:	|  |  |  |  |        |                     48 89 74 07 f8       	mov    %rsi,-0x8(%rdi,%rax,1)
+    299d:	|  |  |  |  |        |                     48 89 f8             	mov    %rdi,%rax
+    29a0:	|  |  |  |  |        |                     4c 29 c8             	sub    %r9,%rax
+    29a3:	|  |  |  |  |        |                     48 29 c1             	sub    %rax,%rcx
+    29a6:	|  |  |  |  |        |                     44 01 d0             	add    %r10d,%eax
+    29a9:	|  |  |  |  |        |                     83 e0 f8             	and    $0xfffffff8,%eax
+    29ac:	|  |  |  |  |        |                     83 f8 08             	cmp    $0x8,%eax
+    29af:	|  |  |  |  |  /-----|-------------------- 72 16                	jb     29c7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    29b1:	|  |  |  |  |  |     |                     83 e0 f8             	and    $0xfffffff8,%eax
+    29b4:	|  |  |  |  |  |     |                     31 f6                	xor    %esi,%esi
+    29b6:	|  |  |  |  |  |     |                 /-> 89 f7                	mov    %esi,%edi
+    29b8:	|  |  |  |  |  |     |                 |   83 c6 08             	add    $0x8,%esi
+    29bb:	|  |  |  |  |  |     |                 |   4c 8b 1c 39          	mov    (%rcx,%rdi,1),%r11
+    29bf:	|  |  |  |  |  |     |                 |   4d 89 1c 39          	mov    %r11,(%r9,%rdi,1)
+    29c3:	|  |  |  |  |  |     |                 |   39 c6                	cmp    %eax,%esi
+    29c5:	|  |  |  |  |  |     |                 \-- 72 ef                	jb     29b6 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3e6>
+    while (done < n) {
+    29c7:	|  |  |  |  |  >-----|-------------------> 49 39 d2             	cmp    %rdx,%r10
+    29ca:	|  |  |  |  |  |     |           /-------- 72 33                	jb     29ff <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    29cc:	|  |  |  |  |  |     |     /-----|-------- e9 af 00 00 00       	jmp    2a80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b0>
+    29d1:	|  |  |  |  |  |     |     |     |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    std::memcpy(d, s, n);
+    29d8:	|  |  |  |  |  |     |     |     |     /-> 41 f6 c1 04          	test   $0x4,%r9b
+    29dc:	|  |  |  |  |  |     |     |  /--|-----|-- 0f 85 9f 00 00 00    	jne    2a81 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b1>
+    29e2:	|  |  |  |  |  |     |     |  |  |     |   45 85 c9             	test   %r9d,%r9d
+    29e5:	|  |  |  |  |  |  /--|-----|--|--|-----|-- 74 10                	je     29f7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    29e7:	|  |  |  |  |  |  |  |     |  |  |     |   41 0f b6 08          	movzbl (%r8),%ecx
+    29eb:	|  |  |  |  |  |  |  |     |  |  |     |   88 08                	mov    %cl,(%rax)
+    29ed:	|  |  |  |  |  |  |  |     |  |  |     |   41 f6 c1 02          	test   $0x2,%r9b
+    29f1:	|  |  |  |  |  |  |  |  /--|--|--|-----|-- 0f 85 c9 00 00 00    	jne    2ac0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4f0>
+        done += m;
+    29f7:	|  |  |  |  |  |  >--|--|--|--|--|-----|-> 4d 01 ca             	add    %r9,%r10
+    while (done < n) {
+    29fa:	|  |  |  |  |  |  |  |  |  |  |  |     |   49 39 d2             	cmp    %rdx,%r10
+    29fd:	|  |  |  |  |  |  |  |  |  |  |  |  /--|-- 73 4e                	jae    2a4d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47d>
+        Length const m = (done < n - done) ? done : n - done;
+    29ff:	|  |  |  |  |  |  |  |  |  |  |  >--|--|-> 49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    2a02:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4b 8d 04 10          	lea    (%r8,%r10,1),%rax
+        Length const m = (done < n - done) ? done : n - done;
+    2a06:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 29 d1             	sub    %r10,%r9
+    2a09:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 39 d1             	cmp    %r10,%r9
+    2a0c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 0f 47 ca          	cmova  %r10,%r9
+    std::memcpy(d, s, n);
+    2a10:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   41 83 f9 08          	cmp    $0x8,%r9d
+    2a14:	|  |  |  |  |  |  |  |  |  |  |  |  |  \-- 72 c2                	jb     29d8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x408>
+    2a16:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 08             	mov    (%r8),%rcx
+    2a19:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 78 08          	lea    0x8(%rax),%rdi
+        done += m;
+    2a1d:	|  |  |  |  |  |  |  |  |  |  |  |  |      4d 01 ca             	add    %r9,%r10
+    std::memcpy(d, s, n);
+    2a20:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 83 e7 f8          	and    $0xfffffffffffffff8,%rdi
+    2a24:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 08             	mov    %rcx,(%rax)
+    2a27:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 89 c9             	mov    %r9d,%ecx
+    2a2a:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 74 08 f8       	mov    -0x8(%r8,%rcx,1),%rsi
+    2a2f:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 74 08 f8       	mov    %rsi,-0x8(%rax,%rcx,1)
+    2a34:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 f8             	sub    %rdi,%rax
+    2a37:	|  |  |  |  |  |  |  |  |  |  |  |  |      4c 89 c6             	mov    %r8,%rsi
+    2a3a:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 c6             	sub    %rax,%rsi
+    2a3d:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 01 c8             	add    %r9d,%eax
+    2a40:	|  |  |  |  |  |  |  |  |  |  |  |  |      c1 e8 03             	shr    $0x3,%eax
+    2a43:	|  |  |  |  |  |  |  |  |  |  |  |  |      89 c1                	mov    %eax,%ecx
+    2a45:	|  |  |  |  |  |  |  |  |  |  |  |  |      f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    2a48:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 39 d2             	cmp    %rdx,%r10
+    2a4b:	|  |  |  |  |  |  |  |  |  |  |  \--|----- 72 b2                	jb     29ff <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    2a4d:	|  |  |  |  |  |  |  |  |  |  |     \----> c3                   	ret
+    std::memcpy(d, s, n);
+    2a4e:	|  |  |  |  |  |  |  \--|--|--|----------> 41 f6 c2 04          	test   $0x4,%r10b
+    2a52:	|  |  |  |  |  |  |     |  |  |        /-- 0f 85 85 00 00 00    	jne    2add <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x50d>
+    2a58:	|  |  |  |  |  |  |     |  |  |        |   85 c0                	test   %eax,%eax
+    2a5a:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 67 ff ff ff    	je     29c7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    2a60:	|  |  |  |  |  |  |     |  |  |        |   0f b6 36             	movzbl (%rsi),%esi
+    2a63:	|  |  |  |  |  |  |     |  |  |        |   40 88 37             	mov    %sil,(%rdi)
+    2a66:	|  |  |  |  |  |  |     |  |  |        |   a8 02                	test   $0x2,%al
+    2a68:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 59 ff ff ff    	je     29c7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    2a6e:	|  |  |  |  |  |  |     |  |  |        |   0f b7 4c 01 fe       	movzwl -0x2(%rcx,%rax,1),%ecx
+    2a73:	|  |  |  |  |  |  |     |  |  |        |   66 89 4c 07 fe       	mov    %cx,-0x2(%rdi,%rax,1)
+    2a78:	|  |  |  |  |  +--|-----|--|--|--------|-- e9 4a ff ff ff       	jmp    29c7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    2a7d:	|  |  |  |  |  |  |     |  |  |        |   0f 1f 00             	nopl   (%rax)
+    2a80:	|  |  |  |  |  |  |     |  \--|--------|-> c3                   	ret
+    2a81:	|  |  |  |  |  |  |     |     \--------|-> 41 8b 08             	mov    (%r8),%ecx
+    2a84:	|  |  |  |  |  |  |     |              |   89 08                	mov    %ecx,(%rax)
+    2a86:	|  |  |  |  |  |  |     |              |   44 89 c9             	mov    %r9d,%ecx
+    2a89:	|  |  |  |  |  |  |     |              |   41 8b 74 08 fc       	mov    -0x4(%r8,%rcx,1),%esi
+    2a8e:	|  |  |  |  |  |  |     |              |   89 74 08 fc          	mov    %esi,-0x4(%rax,%rcx,1)
+    2a92:	|  |  |  |  |  |  +-----|--------------|-- e9 60 ff ff ff       	jmp    29f7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+        d[i] = p[i];
+    2a97:	|  \--|--|--|--|--|-----|--------------|-> 0f b6 39             	movzbl (%rcx),%edi
+    2a9a:	|     |  |  |  |  |     |              |   41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2a9d:	|     |  |  |  |  |     |              |   40 f6 c6 0e          	test   $0xe,%sil
+    2aa1:	+-----|--|--|--|--|-----|--------------|-- 0f 84 59 fc ff ff    	je     2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2aa7:	|     |  |  |  |  |     |              |   0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    2aab:	|     |  |  |  |  |     |              |   41 88 78 01          	mov    %dil,0x1(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2aaf:	|     |  |  |  |  |     |              |   48 83 f8 03          	cmp    $0x3,%rax
+    2ab3:	\-----|--|--|--|--|-----|--------------|-- 0f 85 47 fc ff ff    	jne    2700 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    2ab9:	      \--|--|--|--|-----|--------------|-- e9 7b fb ff ff       	jmp    2639 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x69>
+    2abe:	         |  |  |  |     |              |   66 90                	xchg   %ax,%ax
+    std::memcpy(d, s, n);
+    2ac0:	         |  |  |  |     \--------------|-> 44 89 c9             	mov    %r9d,%ecx
+    2ac3:	         |  |  |  |                    |   41 0f b7 74 08 fe    	movzwl -0x2(%r8,%rcx,1),%esi
+    2ac9:	         |  |  |  |                    |   66 89 74 08 fe       	mov    %si,-0x2(%rax,%rcx,1)
+    2ace:	         |  |  |  \--------------------|-- e9 24 ff ff ff       	jmp    29f7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    for (Index i = 0; i < head; ++i) {
+    2ad3:	         \--|--|-----------------------|-> 49 89 c1             	mov    %rax,%r9
+    2ad6:	            |  |                       |   31 f6                	xor    %esi,%esi
+    2ad8:	            \--|-----------------------|-- e9 38 fe ff ff       	jmp    2915 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x345>
+    std::memcpy(d, s, n);
+    2add:	               |                       \-> 8b 36                	mov    (%rsi),%esi
+    2adf:	               |                           89 37                	mov    %esi,(%rdi)
+    2ae1:	               |                           8b 4c 01 fc          	mov    -0x4(%rcx,%rax,1),%ecx
+    2ae5:	               |                           89 4c 07 fc          	mov    %ecx,-0x4(%rdi,%rax,1)
+    2ae9:	               \-------------------------- e9 d9 fe ff ff       	jmp    29c7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    2aee:	                                           66 90                	xchg   %ax,%ax
+
+0000000000002af0 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    2af0:	    48 85 ff             	test   %rdi,%rdi
+    2af3:	/-- 74 0b                	je     2b00 <nel::free_aligned(void*)+0x10>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    2af5:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    2af9:	|   e9 32 e5 ff ff       	jmp    1030 <free@plt>
+    2afe:	|   66 90                	xchg   %ax,%ax
+}
+    2b00:	\-> c3                   	ret
+    2b01:	    66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2b08:	    00 00 00 00 
+    2b0c:	    0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002b10 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    2b10:	                   41 56                	push   %r14
+    2b12:	                   48 8d 05 c2 05 00 00 	lea    0x5c2(%rip),%rax        # 30db <_IO_stdin_used+0xdb>
+    2b19:	                   41 55                	push   %r13
+    2b1b:	                   66 48 0f 6e c8       	movq   %rax,%xmm1
+    2b20:	                   41 54                	push   %r12
+    2b22:	                   55                   	push   %rbp
+    2b23:	                   48 89 cd             	mov    %rcx,%rbp
+    2b26:	                   48 8d 0d 9e 05 00 00 	lea    0x59e(%rip),%rcx        # 30cb <_IO_stdin_used+0xcb>
+    2b2d:	                   53                   	push   %rbx
+    2b2e:	                   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    2b33:	                   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2b37:	                   48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    2b3b:	                   c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    2b42:	                   00 
+            : fn_name_(fn_name)
+    2b43:	                   0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    2b47:	                   48 85 f6             	test   %rsi,%rsi
+    2b4a:	/----------------- 0f 84 a0 00 00 00    	je     2bf0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    2b50:	|                  48 8d 46 ff          	lea    -0x1(%rsi),%rax
+    2b54:	|                  48 89 f3             	mov    %rsi,%rbx
+    2b57:	|                  48 85 f0             	test   %rsi,%rax
+    2b5a:	+----------------- 0f 85 90 00 00 00    	jne    2bf0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2b60:	|                  48 8d 34 2e          	lea    (%rsi,%rbp,1),%rsi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    2b64:	|                  48 85 ff             	test   %rdi,%rdi
+    2b67:	|     /----------- 74 67                	je     2bd0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xc0>
+    2b69:	|     |            4c 8b 6f f8          	mov    -0x8(%rdi),%r13
+    uint8_t *const new_base =
+    2b6d:	|     |            49 89 d4             	mov    %rdx,%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    2b70:	|     |            4c 29 ef             	sub    %r13,%rdi
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2b73:	|     |            e8 48 e5 ff ff       	call   10c0 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    2b78:	|     |            48 85 c0             	test   %rax,%rax
+    2b7b:	|  /--|----------- 0f 84 7e 00 00 00    	je     2bff <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    2b81:	|  |  |            48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    2b86:	|  |  |            48 f7 db             	neg    %rbx
+    2b89:	|  |  |            48 21 cb             	and    %rcx,%rbx
+    2b8c:	|  |  |            49 89 de             	mov    %rbx,%r14
+    2b8f:	|  |  |            49 29 c6             	sub    %rax,%r14
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    2b92:	|  |  |            4d 39 f5             	cmp    %r14,%r13
+    2b95:	|  |  |        /-- 75 19                	jne    2bb0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xa0>
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    }
+    offset_field(new_p) = new_offset;
+    2b97:	|  |  |     /--|-> 4c 89 73 f8          	mov    %r14,-0x8(%rbx)
+    return new_p;
+}
+    2b9b:	|  |  |  /--|--|-> 48 83 c4 20          	add    $0x20,%rsp
+    2b9f:	|  |  |  |  |  |   48 89 d8             	mov    %rbx,%rax
+    2ba2:	|  |  |  |  |  |   5b                   	pop    %rbx
+    2ba3:	|  |  |  |  |  |   5d                   	pop    %rbp
+    2ba4:	|  |  |  |  |  |   41 5c                	pop    %r12
+    2ba6:	|  |  |  |  |  |   41 5d                	pop    %r13
+    2ba8:	|  |  |  |  |  |   41 5e                	pop    %r14
+    2baa:	|  |  |  |  |  |   c3                   	ret
+    2bab:	|  |  |  |  |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        std::memmove(new_p, new_base + old_offset, n);
+    2bb0:	|  |  |  |  |  \-> 4c 39 e5             	cmp    %r12,%rbp
+    2bb3:	|  |  |  |  |      4c 89 e2             	mov    %r12,%rdx
+    2bb6:	|  |  |  |  |      4a 8d 34 28          	lea    (%rax,%r13,1),%rsi
+    2bba:	|  |  |  |  |      48 89 df             	mov    %rbx,%rdi
+    2bbd:	|  |  |  |  |      48 0f 46 d5          	cmovbe %rbp,%rdx
+    2bc1:	|  |  |  |  |      e8 0a e5 ff ff       	call   10d0 <memmove@plt>
+    2bc6:	|  |  |  |  +----- eb cf                	jmp    2b97 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+    2bc8:	|  |  |  |  |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    2bcf:	|  |  |  |  |      00 
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2bd0:	|  |  \--|--|----> 48 89 f7             	mov    %rsi,%rdi
+    2bd3:	|  |     |  |      e8 d8 e4 ff ff       	call   10b0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    2bd8:	|  |     |  |      48 85 c0             	test   %rax,%rax
+    2bdb:	|  +-----|--|----- 74 22                	je     2bff <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    2bdd:	|  |     |  |      48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    2be2:	|  |     |  |      48 f7 db             	neg    %rbx
+    2be5:	|  |     |  |      48 21 d3             	and    %rdx,%rbx
+    2be8:	|  |     |  |      49 89 de             	mov    %rbx,%r14
+    2beb:	|  |     |  |      49 29 c6             	sub    %rax,%r14
+    if (old_p != nullptr && new_offset != old_offset) {
+    2bee:	|  |     |  \----- eb a7                	jmp    2b97 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    2bf0:	\--|-----|-------> 48 89 e6             	mov    %rsp,%rsi
+    2bf3:	   |     |         48 8d 3d f3 04 00 00 	lea    0x4f3(%rip),%rdi        # 30ed <_IO_stdin_used+0xed>
+    2bfa:	   |     |         e8 53 e5 ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    if (new_base == nullptr) { return nullptr; }
+    2bff:	   \-----|-------> 31 db                	xor    %ebx,%ebx
+    2c01:	         \-------- eb 98                	jmp    2b9b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x8b>
+    2c03:	                   66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2c0a:	                   00 00 00 00 
+    2c0e:	                   66 90                	xchg   %ax,%ax
+
+0000000000002c10 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    2c10:	       53                   	push   %rbx
+            : fn_name_(fn_name)
+    2c11:	       48 8d 05 c3 04 00 00 	lea    0x4c3(%rip),%rax        # 30db <_IO_stdin_used+0xdb>
+    2c18:	       48 8d 0d ac 04 00 00 	lea    0x4ac(%rip),%rcx        # 30cb <_IO_stdin_used+0xcb>
+    2c1f:	       66 48 0f 6e c1       	movq   %rcx,%xmm0
+    2c24:	       66 48 0f 6e c8       	movq   %rax,%xmm1
+    2c29:	       66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2c2d:	       48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    2c31:	       c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    2c38:	       00 
+            : fn_name_(fn_name)
+    2c39:	       0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    2c3d:	       48 85 ff             	test   %rdi,%rdi
+    2c40:	/----- 74 35                	je     2c77 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+    2c42:	|      48 8d 47 ff          	lea    -0x1(%rdi),%rax
+    2c46:	|      48 89 fb             	mov    %rdi,%rbx
+    2c49:	|      48 85 f8             	test   %rdi,%rax
+    2c4c:	+----- 75 29                	jne    2c77 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2c4e:	|      48 8d 3c 37          	lea    (%rdi,%rsi,1),%rdi
+    2c52:	|      e8 59 e4 ff ff       	call   10b0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    2c57:	|      48 85 c0             	test   %rax,%rax
+    2c5a:	|  /-- 74 15                	je     2c71 <nel::malloc_aligned(unsigned long, unsigned long)+0x61>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    2c5c:	|  |   48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    2c61:	|  |   48 f7 db             	neg    %rbx
+    2c64:	|  |   48 21 da             	and    %rbx,%rdx
+    2c67:	|  |   48 29 c2             	sub    %rax,%rdx
+    uint8_t *const new_p = new_base + new_offset;
+    2c6a:	|  |   48 01 d0             	add    %rdx,%rax
+    offset_field(new_p) = new_offset;
+    2c6d:	|  |   48 89 50 f8          	mov    %rdx,-0x8(%rax)
+    return realloc_aligned(nullptr, align, 0, size);
+}
+    2c71:	|  \-> 48 83 c4 20          	add    $0x20,%rsp
+    2c75:	|      5b                   	pop    %rbx
+    2c76:	|      c3                   	ret
+    if (!pred) { assert_fail(msg, ctx); }
+    2c77:	\----> 48 89 e6             	mov    %rsp,%rsi
+    2c7a:	       48 8d 3d 6c 04 00 00 	lea    0x46c(%rip),%rdi        # 30ed <_IO_stdin_used+0xed>
+    2c81:	       e8 cc e4 ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    2c86:	       66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2c8d:	       00 00 00 
+
+0000000000002c90 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    2c90:	53                   	push   %rbx
+    2c91:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    2c94:	40 0f be fe          	movsbl %sil,%edi
+    2c98:	48 8b 35 e1 23 00 00 	mov    0x23e1(%rip),%rsi        # 5080 <stderr@GLIBC_2.2.5>
+    2c9f:	e8 cc e3 ff ff       	call   1070 <fputc@plt>
+    return outs;
+}
+    2ca4:	48 89 d8             	mov    %rbx,%rax
+    2ca7:	5b                   	pop    %rbx
+    2ca8:	c3                   	ret
+    2ca9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002cb0 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    2cb0:	53                   	push   %rbx
+    2cb1:	48 89 fb             	mov    %rdi,%rbx
+    2cb4:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    2cb7:	48 8b 35 c2 23 00 00 	mov    0x23c2(%rip),%rsi        # 5080 <stderr@GLIBC_2.2.5>
+    2cbe:	e8 8d e3 ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    2cc3:	48 89 d8             	mov    %rbx,%rax
+    2cc6:	5b                   	pop    %rbx
+    2cc7:	c3                   	ret
+    2cc8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    2ccf:	00 
+
+0000000000002cd0 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    2cd0:	53                   	push   %rbx
+    2cd1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    2cd4:	48 8b 3d a5 23 00 00 	mov    0x23a5(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    2cdb:	40 0f b6 d6          	movzbl %sil,%edx
+    2cdf:	31 c0                	xor    %eax,%eax
+    2ce1:	48 8d 35 20 04 00 00 	lea    0x420(%rip),%rsi        # 3108 <_IO_stdin_used+0x108>
+    2ce8:	e8 a3 e3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2ced:	48 89 d8             	mov    %rbx,%rax
+    2cf0:	5b                   	pop    %rbx
+    2cf1:	c3                   	ret
+    2cf2:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2cf9:	00 00 00 00 
+    2cfd:	0f 1f 00             	nopl   (%rax)
+
+0000000000002d00 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    2d00:	53                   	push   %rbx
+    2d01:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    2d04:	48 8b 3d 75 23 00 00 	mov    0x2375(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    2d0b:	0f b7 d6             	movzwl %si,%edx
+    2d0e:	31 c0                	xor    %eax,%eax
+    2d10:	48 8d 35 f1 03 00 00 	lea    0x3f1(%rip),%rsi        # 3108 <_IO_stdin_used+0x108>
+    2d17:	e8 74 e3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2d1c:	48 89 d8             	mov    %rbx,%rax
+    2d1f:	5b                   	pop    %rbx
+    2d20:	c3                   	ret
+    2d21:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2d28:	00 00 00 00 
+    2d2c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002d30 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    2d30:	53                   	push   %rbx
+    2d31:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    2d34:	48 8b 3d 45 23 00 00 	mov    0x2345(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    2d3b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    2d3d:	31 c0                	xor    %eax,%eax
+    2d3f:	48 8d 35 c2 03 00 00 	lea    0x3c2(%rip),%rsi        # 3108 <_IO_stdin_used+0x108>
+    2d46:	e8 45 e3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2d4b:	48 89 d8             	mov    %rbx,%rax
+    2d4e:	5b                   	pop    %rbx
+    2d4f:	c3                   	ret
+
+0000000000002d50 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    2d50:	53                   	push   %rbx
+    2d51:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    2d54:	48 8b 3d 25 23 00 00 	mov    0x2325(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    2d5b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    2d5d:	31 c0                	xor    %eax,%eax
+    2d5f:	48 8d 35 a2 03 00 00 	lea    0x3a2(%rip),%rsi        # 3108 <_IO_stdin_used+0x108>
+    2d66:	e8 25 e3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2d6b:	48 89 d8             	mov    %rbx,%rax
+    2d6e:	5b                   	pop    %rbx
+    2d6f:	c3                   	ret
+
+0000000000002d70 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    2d70:	53                   	push   %rbx
+    2d71:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    2d74:	48 8b 3d 05 23 00 00 	mov    0x2305(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    2d7b:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    2d7e:	31 c0                	xor    %eax,%eax
+    2d80:	48 8d 35 84 03 00 00 	lea    0x384(%rip),%rsi        # 310b <_IO_stdin_used+0x10b>
+    2d87:	e8 04 e3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2d8c:	48 89 d8             	mov    %rbx,%rax
+    2d8f:	5b                   	pop    %rbx
+    2d90:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000002d94 <_fini>:
+    2d94:	48 83 ec 08          	sub    $0x8,%rsp
+    2d98:	48 83 c4 08          	add    $0x8,%rsp
+    2d9c:	c3                   	ret
@@ -0,0 +1,2725 @@
+
+target/release/examples/largestruct1_heapless_vector:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 3f 00 00 	mov    0x3fc5(%rip),%rax        # 4fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 3f 00 00    	push   0x3fca(%rip)        # 4ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 3f 00 00    	jmp    *0x3fcc(%rip)        # 4ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 3f 00 00    	jmp    *0x3fca(%rip)        # 5000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 3f 00 00    	jmp    *0x3fc2(%rip)        # 5008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 3f 00 00    	jmp    *0x3fba(%rip)        # 5010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memset@plt>:
+    1060:	ff 25 b2 3f 00 00    	jmp    *0x3fb2(%rip)        # 5018 <memset@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 3f 00 00    	jmp    *0x3faa(%rip)        # 5020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 3f 00 00    	jmp    *0x3fa2(%rip)        # 5028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 3f 00 00    	jmp    *0x3f9a(%rip)        # 5030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcpy@plt>:
+    10a0:	ff 25 92 3f 00 00    	jmp    *0x3f92(%rip)        # 5038 <memcpy@GLIBC_2.14>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <malloc@plt>:
+    10b0:	ff 25 8a 3f 00 00    	jmp    *0x3f8a(%rip)        # 5040 <malloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <realloc@plt>:
+    10c0:	ff 25 82 3f 00 00    	jmp    *0x3f82(%rip)        # 5048 <realloc@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <memmove@plt>:
+    10d0:	ff 25 7a 3f 00 00    	jmp    *0x3f7a(%rip)        # 5050 <memmove@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010e0 <__cxa_finalize@plt>:
+    10e0:	ff 25 fa 3e 00 00    	jmp    *0x3efa(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10e6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010f0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10f0:	50                   	push   %rax
+    std::abort();
+    10f1:	e8 4a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010f6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10f6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10f7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10fa:	4c 8d 0d e0 1f 00 00 	lea    0x1fe0(%rip),%r9        # 30e1 <_IO_stdin_used+0xe1>
+    1101:	31 c0                	xor    %eax,%eax
+    1103:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    1107:	4c 8b 07             	mov    (%rdi),%r8
+    110a:	48 8d 35 d6 1f 00 00 	lea    0x1fd6(%rip),%rsi        # 30e7 <_IO_stdin_used+0xe7>
+    1111:	48 8b 3d 68 3f 00 00 	mov    0x3f68(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1118:	e8 73 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    111d:	e8 1e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001122 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1122:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1126:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1129:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    112d:	31 c0                	xor    %eax,%eax
+    112f:	57                   	push   %rdi
+    1130:	48 8b 3d 49 3f 00 00 	mov    0x3f49(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1137:	4c 8d 0d a3 1f 00 00 	lea    0x1fa3(%rip),%r9        # 30e1 <_IO_stdin_used+0xe1>
+    113e:	4c 8b 06             	mov    (%rsi),%r8
+    1141:	48 8d 35 b0 1f 00 00 	lea    0x1fb0(%rip),%rsi        # 30f8 <_IO_stdin_used+0xf8>
+    1148:	e8 43 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    114d:	e8 ee fe ff ff       	call   1040 <abort@plt>
+
+0000000000001152 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1152:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1156:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1159:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    115d:	31 c0                	xor    %eax,%eax
+    115f:	57                   	push   %rdi
+    1160:	48 8b 3d 19 3f 00 00 	mov    0x3f19(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1167:	4c 8d 0d 9f 1f 00 00 	lea    0x1f9f(%rip),%r9        # 310d <_IO_stdin_used+0x10d>
+    116e:	4c 8b 06             	mov    (%rsi),%r8
+    1171:	48 8d 35 80 1f 00 00 	lea    0x1f80(%rip),%rsi        # 30f8 <_IO_stdin_used+0xf8>
+    1178:	e8 13 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    117d:	e8 be fe ff ff       	call   1040 <abort@plt>
+    1182:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1189:	00 00 00 
+    118c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001190 <main>:
+        nel::log << v << '\n';
+    }
+}
+
+int main()
+{
+    1190:	53                   	push   %rbx
+    nel::log << "ex1:b" << '\n';
+    1191:	48 8d 1d f1 3e 00 00 	lea    0x3ef1(%rip),%rbx        # 5089 <nel::log>
+    1198:	48 8d 35 d4 1e 00 00 	lea    0x1ed4(%rip),%rsi        # 3073 <_IO_stdin_used+0x73>
+    119f:	48 89 df             	mov    %rbx,%rdi
+    11a2:	e8 c9 1a 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    11a7:	be 0a 00 00 00       	mov    $0xa,%esi
+    11ac:	48 89 c7             	mov    %rax,%rdi
+    11af:	e8 9c 1a 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    11b4:	e8 87 02 00 00       	call   1440 <ex1()>
+    nel::log << "ex1:e" << '\n';
+    11b9:	48 89 df             	mov    %rbx,%rdi
+    11bc:	48 8d 35 b6 1e 00 00 	lea    0x1eb6(%rip),%rsi        # 3079 <_IO_stdin_used+0x79>
+    11c3:	e8 a8 1a 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    11c8:	be 0a 00 00 00       	mov    $0xa,%esi
+    11cd:	48 89 c7             	mov    %rax,%rdi
+    11d0:	e8 7b 1a 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex2:b" << '\n';
+    11d5:	48 89 df             	mov    %rbx,%rdi
+    11d8:	48 8d 35 a0 1e 00 00 	lea    0x1ea0(%rip),%rsi        # 307f <_IO_stdin_used+0x7f>
+    11df:	e8 8c 1a 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    11e4:	be 0a 00 00 00       	mov    $0xa,%esi
+    11e9:	48 89 c7             	mov    %rax,%rdi
+    11ec:	e8 5f 1a 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    ex2();
+    11f1:	e8 7a 04 00 00       	call   1670 <ex2()>
+    nel::log << "ex2:e" << '\n';
+    11f6:	48 89 df             	mov    %rbx,%rdi
+    11f9:	48 8d 35 85 1e 00 00 	lea    0x1e85(%rip),%rsi        # 3085 <_IO_stdin_used+0x85>
+    1200:	e8 6b 1a 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    1205:	be 0a 00 00 00       	mov    $0xa,%esi
+    120a:	48 89 c7             	mov    %rax,%rdi
+    120d:	e8 3e 1a 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex3:b" << '\n';
+    1212:	48 89 df             	mov    %rbx,%rdi
+    1215:	48 8d 35 6f 1e 00 00 	lea    0x1e6f(%rip),%rsi        # 308b <_IO_stdin_used+0x8b>
+    121c:	e8 4f 1a 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    1221:	be 0a 00 00 00       	mov    $0xa,%esi
+    1226:	48 89 c7             	mov    %rax,%rdi
+    1229:	e8 22 1a 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    ex3();
+    122e:	e8 8d 07 00 00       	call   19c0 <ex3()>
+    nel::log << "ex3:e" << '\n';
+    1233:	48 89 df             	mov    %rbx,%rdi
+    1236:	48 8d 35 54 1e 00 00 	lea    0x1e54(%rip),%rsi        # 3091 <_IO_stdin_used+0x91>
+    123d:	e8 2e 1a 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    1242:	be 0a 00 00 00       	mov    $0xa,%esi
+    1247:	48 89 c7             	mov    %rax,%rdi
+    124a:	e8 01 1a 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+#if defined(RUST_LIKE)
+    nel::log << "ex41:b" << '\n';
+    ex41();
+    nel::log << "ex41:e" << '\n';
+#endif
+    nel::log << "ex42:b" << '\n';
+    124f:	48 89 df             	mov    %rbx,%rdi
+    1252:	48 8d 35 3e 1e 00 00 	lea    0x1e3e(%rip),%rsi        # 3097 <_IO_stdin_used+0x97>
+    1259:	e8 12 1a 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    125e:	be 0a 00 00 00       	mov    $0xa,%esi
+    1263:	48 89 c7             	mov    %rax,%rdi
+    1266:	e8 e5 19 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    ex42();
+    126b:	e8 a0 0a 00 00       	call   1d10 <ex42()>
+    nel::log << "ex42:e" << '\n';
+    1270:	48 89 df             	mov    %rbx,%rdi
+    1273:	48 8d 35 24 1e 00 00 	lea    0x1e24(%rip),%rsi        # 309e <_IO_stdin_used+0x9e>
+    127a:	e8 f1 19 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    127f:	be 0a 00 00 00       	mov    $0xa,%esi
+    1284:	48 89 c7             	mov    %rax,%rdi
+    1287:	e8 c4 19 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+#if defined(RUST_LIKE)
+    nel::log << "ex51:b" << '\n';
+    ex51();
+    nel::log << "ex51:e" << '\n';
+#endif
+    nel::log << "ex52:b" << '\n';
+    128c:	48 89 df             	mov    %rbx,%rdi
+    128f:	48 8d 35 0f 1e 00 00 	lea    0x1e0f(%rip),%rsi        # 30a5 <_IO_stdin_used+0xa5>
+    1296:	e8 d5 19 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    129b:	be 0a 00 00 00       	mov    $0xa,%esi
+    12a0:	48 89 c7             	mov    %rax,%rdi
+    12a3:	e8 a8 19 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    ex52();
+    12a8:	e8 e3 0e 00 00       	call   2190 <ex52()>
+    nel::log << "ex52:e" << '\n';
+    12ad:	48 89 df             	mov    %rbx,%rdi
+    12b0:	48 8d 35 f5 1d 00 00 	lea    0x1df5(%rip),%rsi        # 30ac <_IO_stdin_used+0xac>
+    12b7:	e8 b4 19 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    12bc:	be 0a 00 00 00       	mov    $0xa,%esi
+    12c1:	48 89 c7             	mov    %rax,%rdi
+    12c4:	e8 87 19 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+}
+    12c9:	31 c0                	xor    %eax,%eax
+    12cb:	5b                   	pop    %rbx
+    12cc:	c3                   	ret
+    12cd:	0f 1f 00             	nopl   (%rax)
+
+00000000000012d0 <_start>:
+    12d0:	31 ed                	xor    %ebp,%ebp
+    12d2:	49 89 d1             	mov    %rdx,%r9
+    12d5:	5e                   	pop    %rsi
+    12d6:	48 89 e2             	mov    %rsp,%rdx
+    12d9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    12dd:	50                   	push   %rax
+    12de:	54                   	push   %rsp
+    12df:	45 31 c0             	xor    %r8d,%r8d
+    12e2:	31 c9                	xor    %ecx,%ecx
+    12e4:	48 8d 3d a5 fe ff ff 	lea    -0x15b(%rip),%rdi        # 1190 <main>
+    12eb:	ff 15 cf 3c 00 00    	call   *0x3ccf(%rip)        # 4fc0 <__libc_start_main@GLIBC_2.34>
+    12f1:	f4                   	hlt
+    12f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12f9:	00 00 00 
+    12fc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001300 <deregister_tm_clones>:
+    1300:	    48 8d 3d 61 3d 00 00 	lea    0x3d61(%rip),%rdi        # 5068 <__TMC_END__>
+    1307:	    48 8d 05 5a 3d 00 00 	lea    0x3d5a(%rip),%rax        # 5068 <__TMC_END__>
+    130e:	    48 39 f8             	cmp    %rdi,%rax
+    1311:	/-- 74 15                	je     1328 <deregister_tm_clones+0x28>
+    1313:	|   48 8b 05 ae 3c 00 00 	mov    0x3cae(%rip),%rax        # 4fc8 <_ITM_deregisterTMCloneTable@Base>
+    131a:	|   48 85 c0             	test   %rax,%rax
+    131d:	+-- 74 09                	je     1328 <deregister_tm_clones+0x28>
+    131f:	|   ff e0                	jmp    *%rax
+    1321:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1328:	\-> c3                   	ret
+    1329:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001330 <register_tm_clones>:
+    1330:	    48 8d 3d 31 3d 00 00 	lea    0x3d31(%rip),%rdi        # 5068 <__TMC_END__>
+    1337:	    48 8d 35 2a 3d 00 00 	lea    0x3d2a(%rip),%rsi        # 5068 <__TMC_END__>
+    133e:	    48 29 fe             	sub    %rdi,%rsi
+    1341:	    48 89 f0             	mov    %rsi,%rax
+    1344:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1348:	    48 c1 f8 03          	sar    $0x3,%rax
+    134c:	    48 01 c6             	add    %rax,%rsi
+    134f:	    48 d1 fe             	sar    %rsi
+    1352:	/-- 74 14                	je     1368 <register_tm_clones+0x38>
+    1354:	|   48 8b 05 7d 3c 00 00 	mov    0x3c7d(%rip),%rax        # 4fd8 <_ITM_registerTMCloneTable@Base>
+    135b:	|   48 85 c0             	test   %rax,%rax
+    135e:	+-- 74 08                	je     1368 <register_tm_clones+0x38>
+    1360:	|   ff e0                	jmp    *%rax
+    1362:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1368:	\-> c3                   	ret
+    1369:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001370 <__do_global_dtors_aux>:
+    1370:	       f3 0f 1e fa          	endbr64
+    1374:	       80 3d 0d 3d 00 00 00 	cmpb   $0x0,0x3d0d(%rip)        # 5088 <completed.0>
+    137b:	/----- 75 2b                	jne    13a8 <__do_global_dtors_aux+0x38>
+    137d:	|      55                   	push   %rbp
+    137e:	|      48 83 3d 5a 3c 00 00 	cmpq   $0x0,0x3c5a(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1385:	|      00 
+    1386:	|      48 89 e5             	mov    %rsp,%rbp
+    1389:	|  /-- 74 0c                	je     1397 <__do_global_dtors_aux+0x27>
+    138b:	|  |   48 8b 3d ce 3c 00 00 	mov    0x3cce(%rip),%rdi        # 5060 <__dso_handle>
+    1392:	|  |   e8 49 fd ff ff       	call   10e0 <__cxa_finalize@plt>
+    1397:	|  \-> e8 64 ff ff ff       	call   1300 <deregister_tm_clones>
+    139c:	|      c6 05 e5 3c 00 00 01 	movb   $0x1,0x3ce5(%rip)        # 5088 <completed.0>
+    13a3:	|      5d                   	pop    %rbp
+    13a4:	|      c3                   	ret
+    13a5:	|      0f 1f 00             	nopl   (%rax)
+    13a8:	\----> c3                   	ret
+    13a9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000013b0 <frame_dummy>:
+    13b0:	f3 0f 1e fa          	endbr64
+    13b4:	e9 77 ff ff ff       	jmp    1330 <register_tm_clones>
+    13b9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000013c0 <_close_r>:
+#include <nel/log.hh>
+    13c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13c5:	c3                   	ret
+    13c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    13cd:	00 00 00 
+
+00000000000013d0 <_fstat_r>:
+
+    13d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13d5:	c3                   	ret
+    13d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    13dd:	00 00 00 
+
+00000000000013e0 <_kill_r>:
+void ex1()
+    13e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13e5:	c3                   	ret
+    13e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    13ed:	00 00 00 
+
+00000000000013f0 <_lseek_r>:
+
+    13f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13f5:	c3                   	ret
+    13f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    13fd:	00 00 00 
+
+0000000000001400 <_read_r>:
+    nel::log << vec1 << '\n';
+    1400:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1405:	c3                   	ret
+    1406:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    140d:	00 00 00 
+
+0000000000001410 <_write_r>:
+    Vec1 vec1 = Vec1::empty();
+    1410:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1415:	c3                   	ret
+    1416:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    141d:	00 00 00 
+
+0000000000001420 <_getpid_r>:
+    vec1.push(nel::move(v)).is_ok();
+    1420:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1425:	c3                   	ret
+    1426:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    142d:	00 00 00 
+
+0000000000001430 <_isatty_r>:
+
+    1430:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1435:	c3                   	ret
+    1436:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    143d:	00 00 00 
+
+0000000000001440 <ex1()>:
+{
+    1440:	          41 57                	push   %r15
+    Vec1 vec1 = Vec1::empty();
+    1442:	          31 c0                	xor    %eax,%eax
+    1444:	          b9 41 01 00 00       	mov    $0x141,%ecx
+        // TODO: replace <<(Log ) with dbgfmt, so separate out from
+        // any other form of conversion to charstring.
+        // TODO: insert into formatter and not final dest type.
+        friend Log &operator<<(Log &outs, Vector const &v)
+        {
+            outs << "Vector<" << N << ">(" << v.len() << "){";
+    1449:	          48 8d 35 b4 1b 00 00 	lea    0x1bb4(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+{
+    1450:	          41 56                	push   %r14
+    1452:	          41 55                	push   %r13
+    1454:	          4c 8d 2d 2e 3c 00 00 	lea    0x3c2e(%rip),%r13        # 5089 <nel::log>
+    145b:	          41 54                	push   %r12
+    145d:	          55                   	push   %rbp
+    145e:	          53                   	push   %rbx
+    145f:	          48 81 ec 28 0a 00 00 	sub    $0xa28,%rsp
+    Vec1 vec1 = Vec1::empty();
+    1466:	          48 8d 7c 24 10       	lea    0x10(%rsp),%rdi
+        }
+
+    public:
+        constexpr SliceIterator(T arr[], Count len)
+            : b_(arr)
+            , e_(arr + len)
+    146b:	          48 8d 5c 24 18       	lea    0x18(%rsp),%rbx
+    1470:	          f3 48 ab             	rep stos %rax,%es:(%rdi)
+    1473:	          4c 89 ef             	mov    %r13,%rdi
+    1476:	          e8 f5 17 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    147b:	          be 0a 00 00 00       	mov    $0xa,%esi
+    1480:	          48 89 c7             	mov    %rax,%rdi
+    1483:	          e8 a8 18 00 00       	call   2d30 <nel::operator<<(nel::Log&, unsigned long)>
+    1488:	          48 8d 35 7d 1b 00 00 	lea    0x1b7d(%rip),%rsi        # 300c <_IO_stdin_used+0xc>
+    148f:	          48 89 c7             	mov    %rax,%rdi
+    1492:	          e8 d9 17 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    1497:	          48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    149c:	          48 89 c7             	mov    %rax,%rdi
+    149f:	          e8 8c 18 00 00       	call   2d30 <nel::operator<<(nel::Log&, unsigned long)>
+    14a4:	          48 8d 35 64 1b 00 00 	lea    0x1b64(%rip),%rsi        # 300f <_IO_stdin_used+0xf>
+    14ab:	          48 89 c7             	mov    %rax,%rdi
+    14ae:	          e8 bd 17 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    14b3:	          4c 8b 74 24 10       	mov    0x10(%rsp),%r14
+#    endif
+
+    public:
+        friend Log &operator<<(Log &outs, ItT const &it)
+        {
+            outs << '[';
+    14b8:	          be 5b 00 00 00       	mov    $0x5b,%esi
+    14bd:	          4c 89 ef             	mov    %r13,%rdi
+    14c0:	          48 89 5c 24 08       	mov    %rbx,0x8(%rsp)
+    14c5:	          49 c1 e6 08          	shl    $0x8,%r14
+    14c9:	          49 01 de             	add    %rbx,%r14
+    14cc:	          e8 7f 17 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+                //++i;
+                // });
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+            }
+#    elif defined(C_LIKE)
+            if (!it2.is_done()) {
+    14d1:	          49 39 de             	cmp    %rbx,%r14
+    14d4:	/-------- 0f 84 25 01 00 00    	je     15ff <ex1()+0x1bf>
+            nel::elem::set(data_, f, N);
+        }
+
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+        {
+            outs << "U8Buf<" << val.len() << ">{";
+    14da:	|         48 8d 35 31 1b 00 00 	lea    0x1b31(%rip),%rsi        # 3012 <_IO_stdin_used+0x12>
+    14e1:	|         4c 89 ef             	mov    %r13,%rdi
+    14e4:	|         48 8d 5c 24 19       	lea    0x19(%rsp),%rbx
+    14e9:	|         e8 82 17 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    14ee:	|         be 00 01 00 00       	mov    $0x100,%esi
+    14f3:	|         48 8d ac 24 18 01 00 	lea    0x118(%rsp),%rbp
+    14fa:	|         00 
+    14fb:	|         48 89 c7             	mov    %rax,%rdi
+    14fe:	|         e8 2d 18 00 00       	call   2d30 <nel::operator<<(nel::Log&, unsigned long)>
+    1503:	|         48 8d 35 0f 1b 00 00 	lea    0x1b0f(%rip),%rsi        # 3019 <_IO_stdin_used+0x19>
+    150a:	|         48 89 c7             	mov    %rax,%rdi
+    150d:	|         e8 5e 17 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+            if (val.len() > 0) {
+                outs << val.data_[0];
+    1512:	|         0f b6 74 24 18       	movzbl 0x18(%rsp),%esi
+    1517:	|         4c 89 ef             	mov    %r13,%rdi
+    151a:	|         e8 71 17 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    151f:	|         90                   	nop
+                    outs << ' ' << val.data_[i];
+    1520:	|     /-> be 20 00 00 00       	mov    $0x20,%esi
+    1525:	|     |   4c 89 ef             	mov    %r13,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1528:	|     |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    152c:	|     |   e8 1f 17 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    1531:	|     |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1535:	|     |   48 89 c7             	mov    %rax,%rdi
+    1538:	|     |   e8 53 17 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    153d:	|     |   48 39 eb             	cmp    %rbp,%rbx
+    1540:	|     \-- 75 de                	jne    1520 <ex1()+0xe0>
+                }
+            }
+            outs << '}';
+    1542:	|         be 7d 00 00 00       	mov    $0x7d,%esi
+    1547:	|         4c 89 ef             	mov    %r13,%rdi
+    154a:	|         e8 01 17 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+            for (; !self().is_done(); self().inc()) {
+    154f:	|         49 39 de             	cmp    %rbx,%r14
+    1552:	+-------- 0f 84 a7 00 00 00    	je     15ff <ex1()+0x1bf>
+    1558:	|         4c 8d a4 24 18 02 00 	lea    0x218(%rsp),%r12
+    155f:	|         00 
+                //     ++i;
+                // });
+#        if defined(RUST_LIKE)
+                it2.for_each2([&outs](OutT const &e) { outs << ',' << e; });
+#        elif defined(C_LIKE)
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    1560:	|  /----> be 2c 00 00 00       	mov    $0x2c,%esi
+    1565:	|  |      4c 89 ef             	mov    %r13,%rdi
+    1568:	|  |      4d 89 e7             	mov    %r12,%r15
+    156b:	|  |      e8 e0 16 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+            outs << "U8Buf<" << val.len() << ">{";
+    1570:	|  |      48 8d 35 9b 1a 00 00 	lea    0x1a9b(%rip),%rsi        # 3012 <_IO_stdin_used+0x12>
+    1577:	|  |      49 8d 9c 24 01 ff ff 	lea    -0xff(%r12),%rbx
+    157e:	|  |      ff 
+    157f:	|  |      48 89 c7             	mov    %rax,%rdi
+    1582:	|  |      48 89 c5             	mov    %rax,%rbp
+    1585:	|  |      e8 e6 16 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    158a:	|  |      be 00 01 00 00       	mov    $0x100,%esi
+    158f:	|  |      48 89 c7             	mov    %rax,%rdi
+    1592:	|  |      e8 99 17 00 00       	call   2d30 <nel::operator<<(nel::Log&, unsigned long)>
+    1597:	|  |      48 8d 35 7b 1a 00 00 	lea    0x1a7b(%rip),%rsi        # 3019 <_IO_stdin_used+0x19>
+    159e:	|  |      48 89 c7             	mov    %rax,%rdi
+    15a1:	|  |      e8 ca 16 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    15a6:	|  |      48 89 ef             	mov    %rbp,%rdi
+    15a9:	|  |      41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    15b0:	|  |      ff ff 
+    15b2:	|  |      e8 d9 16 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    15b7:	|  |      66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    15be:	|  |      00 00 
+                    outs << ' ' << val.data_[i];
+    15c0:	|  |  /-> be 20 00 00 00       	mov    $0x20,%esi
+    15c5:	|  |  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    15c8:	|  |  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    15cc:	|  |  |   e8 7f 16 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    15d1:	|  |  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    15d5:	|  |  |   48 89 c7             	mov    %rax,%rdi
+    15d8:	|  |  |   e8 b3 16 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    15dd:	|  |  |   49 39 dc             	cmp    %rbx,%r12
+    15e0:	|  |  \-- 75 de                	jne    15c0 <ex1()+0x180>
+            outs << '}';
+    15e2:	|  |      be 7d 00 00 00       	mov    $0x7d,%esi
+    15e7:	|  |      48 89 ef             	mov    %rbp,%rdi
+            for (; !self().is_done(); self().inc()) {
+    15ea:	|  |      49 81 c4 00 01 00 00 	add    $0x100,%r12
+    15f1:	|  |      e8 5a 16 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    15f6:	|  |      4d 39 fe             	cmp    %r15,%r14
+    15f9:	|  \----- 0f 85 61 ff ff ff    	jne    1560 <ex1()+0x120>
+#        endif
+            }
+#    endif
+            outs << ']';
+    15ff:	\-------> be 5d 00 00 00       	mov    $0x5d,%esi
+    1604:	          4c 89 ef             	mov    %r13,%rdi
+    1607:	          e8 44 16 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+            outs << v.iter();
+            outs << '}';
+    160c:	          be 7d 00 00 00       	mov    $0x7d,%esi
+    1611:	          4c 89 ef             	mov    %r13,%rdi
+    1614:	          e8 37 16 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    nel::log << vec1 << '\n';
+    1619:	          be 0a 00 00 00       	mov    $0xa,%esi
+    161e:	          4c 89 ef             	mov    %r13,%rdi
+    1621:	          e8 2a 16 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    1626:	          48 8b 6c 24 10       	mov    0x10(%rsp),%rbp
+    162b:	          48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    1630:	          48 c1 e5 08          	shl    $0x8,%rbp
+    1634:	          48 01 c5             	add    %rax,%rbp
+            for (; !self().is_done(); self().inc()) {
+    1637:	          48 39 c5             	cmp    %rax,%rbp
+    163a:	   /----- 74 22                	je     165e <ex1()+0x21e>
+    163c:	   |      48 89 c3             	mov    %rax,%rbx
+    163f:	   |      90                   	nop
+            nel::elem::set(data_, 0xa5, N);
+    1640:	   |  /-> 48 89 df             	mov    %rbx,%rdi
+    1643:	   |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1648:	   |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    164d:	   |  |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    1654:	   |  |   e8 87 0d 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1659:	   |  |   48 39 dd             	cmp    %rbx,%rbp
+    165c:	   |  \-- 75 e2                	jne    1640 <ex1()+0x200>
+}
+    165e:	   \----> 48 81 c4 28 0a 00 00 	add    $0xa28,%rsp
+    1665:	          5b                   	pop    %rbx
+    1666:	          5d                   	pop    %rbp
+    1667:	          41 5c                	pop    %r12
+    1669:	          41 5d                	pop    %r13
+    166b:	          41 5e                	pop    %r14
+    166d:	          41 5f                	pop    %r15
+    166f:	          c3                   	ret
+
+0000000000001670 <ex2()>:
+{
+    1670:	                   41 57                	push   %r15
+    Vec1 vec1 = Vec1::empty();
+    1672:	                   31 c0                	xor    %eax,%eax
+    1674:	                   b9 41 01 00 00       	mov    $0x141,%ecx
+            nel::elem::set(data_, f, N);
+    1679:	                   ba 00 01 00 00       	mov    $0x100,%edx
+{
+    167e:	                   41 56                	push   %r14
+    1680:	                   be 66 00 00 00       	mov    $0x66,%esi
+    1685:	                   41 55                	push   %r13
+    1687:	                   41 54                	push   %r12
+    1689:	                   55                   	push   %rbp
+    168a:	                   53                   	push   %rbx
+    168b:	                   48 81 ec 58 0c 00 00 	sub    $0xc58,%rsp
+    1692:	                   4c 8d 74 24 30       	lea    0x30(%rsp),%r14
+    Vec1 vec1 = Vec1::empty();
+    1697:	                   48 8d bc 24 40 02 00 	lea    0x240(%rsp),%rdi
+    169e:	                   00 
+    169f:	                   f3 48 ab             	rep stos %rax,%es:(%rdi)
+    16a2:	                   4c 89 f7             	mov    %r14,%rdi
+    16a5:	                   4c 89 74 24 08       	mov    %r14,0x8(%rsp)
+    16aa:	                   e8 31 0d 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return len_;
+    16af:	                   48 8b 84 24 40 02 00 	mov    0x240(%rsp),%rax
+    16b6:	                   00 
+            if (len() >= capacity()) {
+    16b7:	                   48 83 f8 09          	cmp    $0x9,%rax
+    16bb:	/----------------- 0f 86 bf 02 00 00    	jbe    1980 <ex2()+0x310>
+            nel::elem::move(data_, o.data_, N);
+    16c1:	|                  48 8d 9c 24 34 01 00 	lea    0x134(%rsp),%rbx
+    16c8:	|                  00 
+    16c9:	|                  ba 00 01 00 00       	mov    $0x100,%edx
+    16ce:	|                  4c 89 f6             	mov    %r14,%rsi
+            : tag_(Tag::OK)
+        {
+        }
+
+        constexpr Result(Phantom<Tag::ERR> const, E &&v)
+            : tag_(Tag::ERR)
+    16d1:	|                  c7 84 24 30 01 00 00 	movl   $0x2,0x130(%rsp)
+    16d8:	|                  02 00 00 00 
+    16dc:	|                  48 89 df             	mov    %rbx,%rdi
+    16df:	|                  e8 0c 0d 00 00       	call   23f0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    16e4:	|                  48 8d 15 cd 19 00 00 	lea    0x19cd(%rip),%rdx        # 30b8 <_IO_stdin_used+0xb8>
+    16eb:	|                  48 8d 0d 2a 19 00 00 	lea    0x192a(%rip),%rcx        # 301c <_IO_stdin_used+0x1c>
+    16f2:	|                  8b 84 24 30 01 00 00 	mov    0x130(%rsp),%eax
+    16f9:	|                  66 48 0f 6e c1       	movq   %rcx,%xmm0
+    16fe:	|                  66 48 0f 6e ca       	movq   %rdx,%xmm1
+            , file_name_(file_name)
+            , line_num_(line_num)
+    1703:	|                  c7 44 24 20 18 00 00 	movl   $0x18,0x20(%rsp)
+    170a:	|                  00 
+            : fn_name_(fn_name)
+    170b:	|                  66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    170f:	|                  0f 29 44 24 10       	movaps %xmm0,0x10(%rsp)
+        // match(Tag tag, std::function<V(void)> on_ok, std::function<V(void)> on_err) const
+        //
+        template<typename V, typename Fn1, typename Fn2>
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+        {
+            switch (tag_) { // result<void>-match
+    1714:	|                  83 f8 01             	cmp    $0x1,%eax
+    1717:	|              /-- 74 1b                	je     1734 <ex2()+0xc4>
+    1719:	|              |   83 f8 02             	cmp    $0x2,%eax
+    171c:	|     /--------|-- 0f 85 46 02 00 00    	jne    1968 <ex2()+0x2f8>
+            nel::elem::set(data_, 0xa5, N);
+    1722:	|     |        |   ba 00 01 00 00       	mov    $0x100,%edx
+    1727:	|     |        |   be a5 00 00 00       	mov    $0xa5,%esi
+    172c:	|     |        |   48 89 df             	mov    %rbx,%rdi
+    172f:	|     |        |   e8 ac 0c 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1734:	|     |        \-> 48 8d 84 24 48 02 00 	lea    0x248(%rsp),%rax
+    173b:	|     |            00 
+    173c:	|     |            48 89 04 24          	mov    %rax,(%rsp)
+            outs << "Vector<" << N << ">(" << v.len() << "){";
+    1740:	|  /--|----------> 4c 8d 2d 42 39 00 00 	lea    0x3942(%rip),%r13        # 5089 <nel::log>
+    1747:	|  |  |            48 8d 35 b6 18 00 00 	lea    0x18b6(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+    174e:	|  |  |            4c 89 ef             	mov    %r13,%rdi
+    1751:	|  |  |            e8 1a 15 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    1756:	|  |  |            be 0a 00 00 00       	mov    $0xa,%esi
+    175b:	|  |  |            48 89 c7             	mov    %rax,%rdi
+    175e:	|  |  |            e8 cd 15 00 00       	call   2d30 <nel::operator<<(nel::Log&, unsigned long)>
+    1763:	|  |  |            48 8d 35 a2 18 00 00 	lea    0x18a2(%rip),%rsi        # 300c <_IO_stdin_used+0xc>
+    176a:	|  |  |            48 89 c7             	mov    %rax,%rdi
+    176d:	|  |  |            e8 fe 14 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    1772:	|  |  |            48 8b b4 24 40 02 00 	mov    0x240(%rsp),%rsi
+    1779:	|  |  |            00 
+    177a:	|  |  |            48 89 c7             	mov    %rax,%rdi
+    177d:	|  |  |            e8 ae 15 00 00       	call   2d30 <nel::operator<<(nel::Log&, unsigned long)>
+    1782:	|  |  |            48 8d 35 86 18 00 00 	lea    0x1886(%rip),%rsi        # 300f <_IO_stdin_used+0xf>
+    1789:	|  |  |            48 89 c7             	mov    %rax,%rdi
+    178c:	|  |  |            e8 df 14 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    1791:	|  |  |            4c 8b b4 24 40 02 00 	mov    0x240(%rsp),%r14
+    1798:	|  |  |            00 
+    1799:	|  |  |            48 8b 1c 24          	mov    (%rsp),%rbx
+            outs << '[';
+    179d:	|  |  |            4c 89 ef             	mov    %r13,%rdi
+    17a0:	|  |  |            be 5b 00 00 00       	mov    $0x5b,%esi
+    17a5:	|  |  |            49 c1 e6 08          	shl    $0x8,%r14
+    17a9:	|  |  |            49 01 de             	add    %rbx,%r14
+    17ac:	|  |  |            e8 9f 14 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+            if (!it2.is_done()) {
+    17b1:	|  |  |            49 39 de             	cmp    %rbx,%r14
+    17b4:	|  |  |  /-------- 0f 84 25 01 00 00    	je     18df <ex2()+0x26f>
+            outs << "U8Buf<" << val.len() << ">{";
+    17ba:	|  |  |  |         48 8d 35 51 18 00 00 	lea    0x1851(%rip),%rsi        # 3012 <_IO_stdin_used+0x12>
+    17c1:	|  |  |  |         4c 89 ef             	mov    %r13,%rdi
+    17c4:	|  |  |  |         48 8d 9c 24 49 02 00 	lea    0x249(%rsp),%rbx
+    17cb:	|  |  |  |         00 
+    17cc:	|  |  |  |         e8 9f 14 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    17d1:	|  |  |  |         be 00 01 00 00       	mov    $0x100,%esi
+    17d6:	|  |  |  |         48 8d ac 24 48 03 00 	lea    0x348(%rsp),%rbp
+    17dd:	|  |  |  |         00 
+    17de:	|  |  |  |         48 89 c7             	mov    %rax,%rdi
+    17e1:	|  |  |  |         e8 4a 15 00 00       	call   2d30 <nel::operator<<(nel::Log&, unsigned long)>
+    17e6:	|  |  |  |         48 8d 35 2c 18 00 00 	lea    0x182c(%rip),%rsi        # 3019 <_IO_stdin_used+0x19>
+    17ed:	|  |  |  |         48 89 c7             	mov    %rax,%rdi
+    17f0:	|  |  |  |         e8 7b 14 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    17f5:	|  |  |  |         0f b6 b4 24 48 02 00 	movzbl 0x248(%rsp),%esi
+    17fc:	|  |  |  |         00 
+    17fd:	|  |  |  |         4c 89 ef             	mov    %r13,%rdi
+    1800:	|  |  |  |         e8 8b 14 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1805:	|  |  |  |         0f 1f 00             	nopl   (%rax)
+                    outs << ' ' << val.data_[i];
+    1808:	|  |  |  |     /-> be 20 00 00 00       	mov    $0x20,%esi
+    180d:	|  |  |  |     |   4c 89 ef             	mov    %r13,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1810:	|  |  |  |     |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    1814:	|  |  |  |     |   e8 37 14 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    1819:	|  |  |  |     |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    181d:	|  |  |  |     |   48 89 c7             	mov    %rax,%rdi
+    1820:	|  |  |  |     |   e8 6b 14 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1825:	|  |  |  |     |   48 39 eb             	cmp    %rbp,%rbx
+    1828:	|  |  |  |     \-- 75 de                	jne    1808 <ex2()+0x198>
+            outs << '}';
+    182a:	|  |  |  |         be 7d 00 00 00       	mov    $0x7d,%esi
+    182f:	|  |  |  |         4c 89 ef             	mov    %r13,%rdi
+    1832:	|  |  |  |         4c 8d a4 24 48 04 00 	lea    0x448(%rsp),%r12
+    1839:	|  |  |  |         00 
+    183a:	|  |  |  |         e8 11 14 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+            for (; !self().is_done(); self().inc()) {
+    183f:	|  |  |  |         49 39 de             	cmp    %rbx,%r14
+    1842:	|  |  |  +-------- 0f 84 97 00 00 00    	je     18df <ex2()+0x26f>
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    1848:	|  |  |  |  /----> be 2c 00 00 00       	mov    $0x2c,%esi
+    184d:	|  |  |  |  |      4c 89 ef             	mov    %r13,%rdi
+    1850:	|  |  |  |  |      4d 89 e7             	mov    %r12,%r15
+    1853:	|  |  |  |  |      e8 f8 13 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+            outs << "U8Buf<" << val.len() << ">{";
+    1858:	|  |  |  |  |      48 8d 35 b3 17 00 00 	lea    0x17b3(%rip),%rsi        # 3012 <_IO_stdin_used+0x12>
+    185f:	|  |  |  |  |      49 8d 9c 24 01 ff ff 	lea    -0xff(%r12),%rbx
+    1866:	|  |  |  |  |      ff 
+    1867:	|  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    186a:	|  |  |  |  |      48 89 c5             	mov    %rax,%rbp
+    186d:	|  |  |  |  |      e8 fe 13 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    1872:	|  |  |  |  |      be 00 01 00 00       	mov    $0x100,%esi
+    1877:	|  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    187a:	|  |  |  |  |      e8 b1 14 00 00       	call   2d30 <nel::operator<<(nel::Log&, unsigned long)>
+    187f:	|  |  |  |  |      48 8d 35 93 17 00 00 	lea    0x1793(%rip),%rsi        # 3019 <_IO_stdin_used+0x19>
+    1886:	|  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1889:	|  |  |  |  |      e8 e2 13 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    188e:	|  |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    1891:	|  |  |  |  |      41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    1898:	|  |  |  |  |      ff ff 
+    189a:	|  |  |  |  |      e8 f1 13 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    189f:	|  |  |  |  |      90                   	nop
+                    outs << ' ' << val.data_[i];
+    18a0:	|  |  |  |  |  /-> be 20 00 00 00       	mov    $0x20,%esi
+    18a5:	|  |  |  |  |  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    18a8:	|  |  |  |  |  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    18ac:	|  |  |  |  |  |   e8 9f 13 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    18b1:	|  |  |  |  |  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    18b5:	|  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    18b8:	|  |  |  |  |  |   e8 d3 13 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    18bd:	|  |  |  |  |  |   49 39 dc             	cmp    %rbx,%r12
+    18c0:	|  |  |  |  |  \-- 75 de                	jne    18a0 <ex2()+0x230>
+            outs << '}';
+    18c2:	|  |  |  |  |      be 7d 00 00 00       	mov    $0x7d,%esi
+    18c7:	|  |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+            for (; !self().is_done(); self().inc()) {
+    18ca:	|  |  |  |  |      49 81 c4 00 01 00 00 	add    $0x100,%r12
+    18d1:	|  |  |  |  |      e8 7a 13 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    18d6:	|  |  |  |  |      4d 39 f7             	cmp    %r14,%r15
+    18d9:	|  |  |  |  \----- 0f 85 69 ff ff ff    	jne    1848 <ex2()+0x1d8>
+            outs << ']';
+    18df:	|  |  |  \-------> be 5d 00 00 00       	mov    $0x5d,%esi
+    18e4:	|  |  |            4c 89 ef             	mov    %r13,%rdi
+    18e7:	|  |  |            e8 64 13 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+            outs << '}';
+    18ec:	|  |  |            be 7d 00 00 00       	mov    $0x7d,%esi
+    18f1:	|  |  |            4c 89 ef             	mov    %r13,%rdi
+    18f4:	|  |  |            e8 57 13 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    nel::log << vec1 << '\n';
+    18f9:	|  |  |            be 0a 00 00 00       	mov    $0xa,%esi
+    18fe:	|  |  |            4c 89 ef             	mov    %r13,%rdi
+    1901:	|  |  |            e8 4a 13 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+            nel::elem::set(data_, 0xa5, N);
+    1906:	|  |  |            48 8b 7c 24 08       	mov    0x8(%rsp),%rdi
+    190b:	|  |  |            ba 00 01 00 00       	mov    $0x100,%edx
+    1910:	|  |  |            be a5 00 00 00       	mov    $0xa5,%esi
+    1915:	|  |  |            e8 c6 0a 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    191a:	|  |  |            48 8b ac 24 40 02 00 	mov    0x240(%rsp),%rbp
+    1921:	|  |  |            00 
+    1922:	|  |  |            48 8b 1c 24          	mov    (%rsp),%rbx
+    1926:	|  |  |            48 c1 e5 08          	shl    $0x8,%rbp
+    192a:	|  |  |            48 01 dd             	add    %rbx,%rbp
+            for (; !self().is_done(); self().inc()) {
+    192d:	|  |  |            48 39 dd             	cmp    %rbx,%rbp
+    1930:	|  |  |     /----- 74 24                	je     1956 <ex2()+0x2e6>
+    1932:	|  |  |     |      66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1938:	|  |  |     |  /-> 48 89 df             	mov    %rbx,%rdi
+    193b:	|  |  |     |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1940:	|  |  |     |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    1945:	|  |  |     |  |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    194c:	|  |  |     |  |   e8 8f 0a 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1951:	|  |  |     |  |   48 39 dd             	cmp    %rbx,%rbp
+    1954:	|  |  |     |  \-- 75 e2                	jne    1938 <ex2()+0x2c8>
+}
+    1956:	|  |  |     \----> 48 81 c4 58 0c 00 00 	add    $0xc58,%rsp
+    195d:	|  |  |            5b                   	pop    %rbx
+    195e:	|  |  |            5d                   	pop    %rbp
+    195f:	|  |  |            41 5c                	pop    %r12
+    1961:	|  |  |            41 5d                	pop    %r13
+    1963:	|  |  |            41 5e                	pop    %r14
+    1965:	|  |  |            41 5f                	pop    %r15
+    1967:	|  |  |            c3                   	ret
+                    // if they do it's a use-after-move-from op so must panic.
+                    // or a use-before-initialised so again must panic.
+                    nel::panic("invalid Result", ctx);
+                    break;
+                default:
+                    nel::panic("bad Result", ctx);
+    1968:	|  |  \----------> 48 8d 74 24 10       	lea    0x10(%rsp),%rsi
+            switch (tag_) { // result<void>-match
+    196d:	|  |               85 c0                	test   %eax,%eax
+    196f:	|  |           /-- 74 40                	je     19b1 <ex2()+0x341>
+                    nel::panic("bad Result", ctx);
+    1971:	|  |           |   48 8d 3d b7 16 00 00 	lea    0x16b7(%rip),%rdi        # 302f <_IO_stdin_used+0x2f>
+    1978:	|  |           |   e8 a5 f7 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    197d:	|  |           |   0f 1f 00             	nopl   (%rax)
+            return &ptr()[d];
+    1980:	\--|-----------|-> 48 c1 e0 08          	shl    $0x8,%rax
+            nel::elem::move(data_, o.data_, N);
+    1984:	   |           |   48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    1989:	   |           |   ba 00 01 00 00       	mov    $0x100,%edx
+    198e:	   |           |   48 8d 8c 24 48 02 00 	lea    0x248(%rsp),%rcx
+    1995:	   |           |   00 
+    1996:	   |           |   48 8d 3c 01          	lea    (%rcx,%rax,1),%rdi
+    199a:	   |           |   48 89 0c 24          	mov    %rcx,(%rsp)
+    199e:	   |           |   e8 4d 0a 00 00       	call   23f0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            len_ += 1;
+    19a3:	   |           |   48 83 84 24 40 02 00 	addq   $0x1,0x240(%rsp)
+    19aa:	   |           |   00 01 
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    19ac:	   \-----------|-- e9 8f fd ff ff       	jmp    1740 <ex2()+0xd0>
+                    nel::panic("invalid Result", ctx);
+    19b1:	               \-> 48 8d 3d 68 16 00 00 	lea    0x1668(%rip),%rdi        # 3020 <_IO_stdin_used+0x20>
+    19b8:	                   e8 65 f7 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    19bd:	                   0f 1f 00             	nopl   (%rax)
+
+00000000000019c0 <ex3()>:
+{
+    19c0:	                   41 57                	push   %r15
+    Vec1 vec1 = Vec1::empty();
+    19c2:	                   31 c0                	xor    %eax,%eax
+    19c4:	                   b9 41 01 00 00       	mov    $0x141,%ecx
+            nel::elem::set(data_, f, N);
+    19c9:	                   ba 00 01 00 00       	mov    $0x100,%edx
+{
+    19ce:	                   41 56                	push   %r14
+    19d0:	                   be 67 00 00 00       	mov    $0x67,%esi
+    19d5:	                   41 55                	push   %r13
+    19d7:	                   41 54                	push   %r12
+    19d9:	                   55                   	push   %rbp
+    19da:	                   53                   	push   %rbx
+    19db:	                   48 81 ec 58 0c 00 00 	sub    $0xc58,%rsp
+    Vec1 vec1 = Vec1::empty();
+    19e2:	                   48 8d bc 24 40 02 00 	lea    0x240(%rsp),%rdi
+    19e9:	                   00 
+    19ea:	                   48 8d 5c 24 30       	lea    0x30(%rsp),%rbx
+    19ef:	                   f3 48 ab             	rep stos %rax,%es:(%rdi)
+    19f2:	                   48 89 df             	mov    %rbx,%rdi
+    19f5:	                   e8 e6 09 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return len_;
+    19fa:	                   48 8b 84 24 40 02 00 	mov    0x240(%rsp),%rax
+    1a01:	                   00 
+            if (len() >= capacity()) {
+    1a02:	                   48 83 f8 09          	cmp    $0x9,%rax
+    1a06:	/----------------- 0f 86 bc 02 00 00    	jbe    1cc8 <ex3()+0x308>
+            nel::elem::move(data_, o.data_, N);
+    1a0c:	|                  48 8d ac 24 34 01 00 	lea    0x134(%rsp),%rbp
+    1a13:	|                  00 
+    1a14:	|                  ba 00 01 00 00       	mov    $0x100,%edx
+    1a19:	|                  48 89 de             	mov    %rbx,%rsi
+            : tag_(Tag::ERR)
+    1a1c:	|                  c7 84 24 30 01 00 00 	movl   $0x2,0x130(%rsp)
+    1a23:	|                  02 00 00 00 
+    1a27:	|                  48 89 ef             	mov    %rbp,%rdi
+    1a2a:	|                  e8 c1 09 00 00       	call   23f0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    1a2f:	|                  48 8d 15 82 16 00 00 	lea    0x1682(%rip),%rdx        # 30b8 <_IO_stdin_used+0xb8>
+    1a36:	|                  48 8d 0d fd 15 00 00 	lea    0x15fd(%rip),%rcx        # 303a <_IO_stdin_used+0x3a>
+    1a3d:	|                  8b 84 24 30 01 00 00 	mov    0x130(%rsp),%eax
+    1a44:	|                  66 48 0f 6e c1       	movq   %rcx,%xmm0
+    1a49:	|                  66 48 0f 6e ca       	movq   %rdx,%xmm1
+            , line_num_(line_num)
+    1a4e:	|                  c7 44 24 20 21 00 00 	movl   $0x21,0x20(%rsp)
+    1a55:	|                  00 
+            : fn_name_(fn_name)
+    1a56:	|                  66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    1a5a:	|                  0f 29 44 24 10       	movaps %xmm0,0x10(%rsp)
+            switch (tag_) { // result<void>-match
+    1a5f:	|                  83 f8 01             	cmp    $0x1,%eax
+    1a62:	|              /-- 74 1b                	je     1a7f <ex3()+0xbf>
+    1a64:	|              |   83 f8 02             	cmp    $0x2,%eax
+    1a67:	|     /--------|-- 0f 85 43 02 00 00    	jne    1cb0 <ex3()+0x2f0>
+            nel::elem::set(data_, 0xa5, N);
+    1a6d:	|     |        |   ba 00 01 00 00       	mov    $0x100,%edx
+    1a72:	|     |        |   be a5 00 00 00       	mov    $0xa5,%esi
+    1a77:	|     |        |   48 89 ef             	mov    %rbp,%rdi
+    1a7a:	|     |        |   e8 61 09 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1a7f:	|     |        \-> 48 8d 84 24 48 02 00 	lea    0x248(%rsp),%rax
+    1a86:	|     |            00 
+    1a87:	|     |            48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1a8c:	|  /--|----------> ba 00 01 00 00       	mov    $0x100,%edx
+    1a91:	|  |  |            48 89 df             	mov    %rbx,%rdi
+    1a94:	|  |  |            be a5 00 00 00       	mov    $0xa5,%esi
+    1a99:	|  |  |            e8 42 09 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            outs << "Vector<" << N << ">(" << v.len() << "){";
+    1a9e:	|  |  |            4c 8d 2d e4 35 00 00 	lea    0x35e4(%rip),%r13        # 5089 <nel::log>
+    1aa5:	|  |  |            48 8d 35 58 15 00 00 	lea    0x1558(%rip),%rsi        # 3004 <_IO_stdin_used+0x4>
+    1aac:	|  |  |            4c 89 ef             	mov    %r13,%rdi
+    1aaf:	|  |  |            e8 bc 11 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    1ab4:	|  |  |            be 0a 00 00 00       	mov    $0xa,%esi
+    1ab9:	|  |  |            48 89 c7             	mov    %rax,%rdi
+    1abc:	|  |  |            e8 6f 12 00 00       	call   2d30 <nel::operator<<(nel::Log&, unsigned long)>
+    1ac1:	|  |  |            48 8d 35 44 15 00 00 	lea    0x1544(%rip),%rsi        # 300c <_IO_stdin_used+0xc>
+    1ac8:	|  |  |            48 89 c7             	mov    %rax,%rdi
+    1acb:	|  |  |            e8 a0 11 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    1ad0:	|  |  |            48 8b b4 24 40 02 00 	mov    0x240(%rsp),%rsi
+    1ad7:	|  |  |            00 
+    1ad8:	|  |  |            48 89 c7             	mov    %rax,%rdi
+    1adb:	|  |  |            e8 50 12 00 00       	call   2d30 <nel::operator<<(nel::Log&, unsigned long)>
+    1ae0:	|  |  |            48 8d 35 28 15 00 00 	lea    0x1528(%rip),%rsi        # 300f <_IO_stdin_used+0xf>
+    1ae7:	|  |  |            48 89 c7             	mov    %rax,%rdi
+    1aea:	|  |  |            e8 81 11 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    1aef:	|  |  |            4c 8b b4 24 40 02 00 	mov    0x240(%rsp),%r14
+    1af6:	|  |  |            00 
+    1af7:	|  |  |            48 8b 5c 24 08       	mov    0x8(%rsp),%rbx
+            outs << '[';
+    1afc:	|  |  |            4c 89 ef             	mov    %r13,%rdi
+    1aff:	|  |  |            be 5b 00 00 00       	mov    $0x5b,%esi
+    1b04:	|  |  |            49 c1 e6 08          	shl    $0x8,%r14
+    1b08:	|  |  |            49 01 de             	add    %rbx,%r14
+    1b0b:	|  |  |            e8 40 11 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+            if (!it2.is_done()) {
+    1b10:	|  |  |            49 39 de             	cmp    %rbx,%r14
+    1b13:	|  |  |  /-------- 0f 84 26 01 00 00    	je     1c3f <ex3()+0x27f>
+            outs << "U8Buf<" << val.len() << ">{";
+    1b19:	|  |  |  |         48 8d 35 f2 14 00 00 	lea    0x14f2(%rip),%rsi        # 3012 <_IO_stdin_used+0x12>
+    1b20:	|  |  |  |         4c 89 ef             	mov    %r13,%rdi
+    1b23:	|  |  |  |         48 8d 9c 24 49 02 00 	lea    0x249(%rsp),%rbx
+    1b2a:	|  |  |  |         00 
+    1b2b:	|  |  |  |         e8 40 11 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    1b30:	|  |  |  |         be 00 01 00 00       	mov    $0x100,%esi
+    1b35:	|  |  |  |         48 8d ac 24 48 03 00 	lea    0x348(%rsp),%rbp
+    1b3c:	|  |  |  |         00 
+    1b3d:	|  |  |  |         48 89 c7             	mov    %rax,%rdi
+    1b40:	|  |  |  |         e8 eb 11 00 00       	call   2d30 <nel::operator<<(nel::Log&, unsigned long)>
+    1b45:	|  |  |  |         48 8d 35 cd 14 00 00 	lea    0x14cd(%rip),%rsi        # 3019 <_IO_stdin_used+0x19>
+    1b4c:	|  |  |  |         48 89 c7             	mov    %rax,%rdi
+    1b4f:	|  |  |  |         e8 1c 11 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    1b54:	|  |  |  |         0f b6 b4 24 48 02 00 	movzbl 0x248(%rsp),%esi
+    1b5b:	|  |  |  |         00 
+    1b5c:	|  |  |  |         4c 89 ef             	mov    %r13,%rdi
+    1b5f:	|  |  |  |         e8 2c 11 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1b64:	|  |  |  |         0f 1f 40 00          	nopl   0x0(%rax)
+                    outs << ' ' << val.data_[i];
+    1b68:	|  |  |  |     /-> be 20 00 00 00       	mov    $0x20,%esi
+    1b6d:	|  |  |  |     |   4c 89 ef             	mov    %r13,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1b70:	|  |  |  |     |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    1b74:	|  |  |  |     |   e8 d7 10 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    1b79:	|  |  |  |     |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1b7d:	|  |  |  |     |   48 89 c7             	mov    %rax,%rdi
+    1b80:	|  |  |  |     |   e8 0b 11 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1b85:	|  |  |  |     |   48 39 eb             	cmp    %rbp,%rbx
+    1b88:	|  |  |  |     \-- 75 de                	jne    1b68 <ex3()+0x1a8>
+            outs << '}';
+    1b8a:	|  |  |  |         be 7d 00 00 00       	mov    $0x7d,%esi
+    1b8f:	|  |  |  |         4c 89 ef             	mov    %r13,%rdi
+    1b92:	|  |  |  |         4c 8d a4 24 48 04 00 	lea    0x448(%rsp),%r12
+    1b99:	|  |  |  |         00 
+    1b9a:	|  |  |  |         e8 b1 10 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+            for (; !self().is_done(); self().inc()) {
+    1b9f:	|  |  |  |         49 39 de             	cmp    %rbx,%r14
+    1ba2:	|  |  |  +-------- 0f 84 97 00 00 00    	je     1c3f <ex3()+0x27f>
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    1ba8:	|  |  |  |  /----> be 2c 00 00 00       	mov    $0x2c,%esi
+    1bad:	|  |  |  |  |      4c 89 ef             	mov    %r13,%rdi
+    1bb0:	|  |  |  |  |      4d 89 e7             	mov    %r12,%r15
+    1bb3:	|  |  |  |  |      e8 98 10 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+            outs << "U8Buf<" << val.len() << ">{";
+    1bb8:	|  |  |  |  |      48 8d 35 53 14 00 00 	lea    0x1453(%rip),%rsi        # 3012 <_IO_stdin_used+0x12>
+    1bbf:	|  |  |  |  |      49 8d 9c 24 01 ff ff 	lea    -0xff(%r12),%rbx
+    1bc6:	|  |  |  |  |      ff 
+    1bc7:	|  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1bca:	|  |  |  |  |      48 89 c5             	mov    %rax,%rbp
+    1bcd:	|  |  |  |  |      e8 9e 10 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    1bd2:	|  |  |  |  |      be 00 01 00 00       	mov    $0x100,%esi
+    1bd7:	|  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1bda:	|  |  |  |  |      e8 51 11 00 00       	call   2d30 <nel::operator<<(nel::Log&, unsigned long)>
+    1bdf:	|  |  |  |  |      48 8d 35 33 14 00 00 	lea    0x1433(%rip),%rsi        # 3019 <_IO_stdin_used+0x19>
+    1be6:	|  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1be9:	|  |  |  |  |      e8 82 10 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    1bee:	|  |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    1bf1:	|  |  |  |  |      41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    1bf8:	|  |  |  |  |      ff ff 
+    1bfa:	|  |  |  |  |      e8 91 10 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1bff:	|  |  |  |  |      90                   	nop
+                    outs << ' ' << val.data_[i];
+    1c00:	|  |  |  |  |  /-> be 20 00 00 00       	mov    $0x20,%esi
+    1c05:	|  |  |  |  |  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1c08:	|  |  |  |  |  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    1c0c:	|  |  |  |  |  |   e8 3f 10 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    1c11:	|  |  |  |  |  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1c15:	|  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1c18:	|  |  |  |  |  |   e8 73 10 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1c1d:	|  |  |  |  |  |   49 39 dc             	cmp    %rbx,%r12
+    1c20:	|  |  |  |  |  \-- 75 de                	jne    1c00 <ex3()+0x240>
+            outs << '}';
+    1c22:	|  |  |  |  |      be 7d 00 00 00       	mov    $0x7d,%esi
+    1c27:	|  |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+            for (; !self().is_done(); self().inc()) {
+    1c2a:	|  |  |  |  |      49 81 c4 00 01 00 00 	add    $0x100,%r12
+    1c31:	|  |  |  |  |      e8 1a 10 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    1c36:	|  |  |  |  |      4d 39 f7             	cmp    %r14,%r15
+    1c39:	|  |  |  |  \----- 0f 85 69 ff ff ff    	jne    1ba8 <ex3()+0x1e8>
+            outs << ']';
+    1c3f:	|  |  |  \-------> be 5d 00 00 00       	mov    $0x5d,%esi
+    1c44:	|  |  |            4c 89 ef             	mov    %r13,%rdi
+    1c47:	|  |  |            e8 04 10 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+            outs << '}';
+    1c4c:	|  |  |            be 7d 00 00 00       	mov    $0x7d,%esi
+    1c51:	|  |  |            4c 89 ef             	mov    %r13,%rdi
+    1c54:	|  |  |            e8 f7 0f 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    nel::log << vec1 << '\n';
+    1c59:	|  |  |            be 0a 00 00 00       	mov    $0xa,%esi
+    1c5e:	|  |  |            4c 89 ef             	mov    %r13,%rdi
+    1c61:	|  |  |            e8 ea 0f 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    1c66:	|  |  |            48 8b ac 24 40 02 00 	mov    0x240(%rsp),%rbp
+    1c6d:	|  |  |            00 
+    1c6e:	|  |  |            48 8b 5c 24 08       	mov    0x8(%rsp),%rbx
+    1c73:	|  |  |            48 c1 e5 08          	shl    $0x8,%rbp
+    1c77:	|  |  |            48 01 dd             	add    %rbx,%rbp
+            for (; !self().is_done(); self().inc()) {
+    1c7a:	|  |  |            48 39 dd             	cmp    %rbx,%rbp
+    1c7d:	|  |  |     /----- 74 1f                	je     1c9e <ex3()+0x2de>
+    1c7f:	|  |  |     |      90                   	nop
+            nel::elem::set(data_, 0xa5, N);
+    1c80:	|  |  |     |  /-> 48 89 df             	mov    %rbx,%rdi
+    1c83:	|  |  |     |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1c88:	|  |  |     |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    1c8d:	|  |  |     |  |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    1c94:	|  |  |     |  |   e8 47 07 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1c99:	|  |  |     |  |   48 39 dd             	cmp    %rbx,%rbp
+    1c9c:	|  |  |     |  \-- 75 e2                	jne    1c80 <ex3()+0x2c0>
+}
+    1c9e:	|  |  |     \----> 48 81 c4 58 0c 00 00 	add    $0xc58,%rsp
+    1ca5:	|  |  |            5b                   	pop    %rbx
+    1ca6:	|  |  |            5d                   	pop    %rbp
+    1ca7:	|  |  |            41 5c                	pop    %r12
+    1ca9:	|  |  |            41 5d                	pop    %r13
+    1cab:	|  |  |            41 5e                	pop    %r14
+    1cad:	|  |  |            41 5f                	pop    %r15
+    1caf:	|  |  |            c3                   	ret
+                    nel::panic("bad Result", ctx);
+    1cb0:	|  |  \----------> 48 8d 74 24 10       	lea    0x10(%rsp),%rsi
+            switch (tag_) { // result<void>-match
+    1cb5:	|  |               85 c0                	test   %eax,%eax
+    1cb7:	|  |           /-- 74 3f                	je     1cf8 <ex3()+0x338>
+                    nel::panic("bad Result", ctx);
+    1cb9:	|  |           |   48 8d 3d 6f 13 00 00 	lea    0x136f(%rip),%rdi        # 302f <_IO_stdin_used+0x2f>
+    1cc0:	|  |           |   e8 5d f4 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1cc5:	|  |           |   0f 1f 00             	nopl   (%rax)
+            return &ptr()[d];
+    1cc8:	\--|-----------|-> 48 8d 8c 24 48 02 00 	lea    0x248(%rsp),%rcx
+    1ccf:	   |           |   00 
+    1cd0:	   |           |   48 c1 e0 08          	shl    $0x8,%rax
+            nel::elem::move(data_, o.data_, N);
+    1cd4:	   |           |   ba 00 01 00 00       	mov    $0x100,%edx
+    1cd9:	   |           |   48 89 de             	mov    %rbx,%rsi
+    1cdc:	   |           |   48 8d 3c 01          	lea    (%rcx,%rax,1),%rdi
+    1ce0:	   |           |   48 89 4c 24 08       	mov    %rcx,0x8(%rsp)
+    1ce5:	   |           |   e8 06 07 00 00       	call   23f0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            len_ += 1;
+    1cea:	   |           |   48 83 84 24 40 02 00 	addq   $0x1,0x240(%rsp)
+    1cf1:	   |           |   00 01 
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    1cf3:	   \-----------|-- e9 94 fd ff ff       	jmp    1a8c <ex3()+0xcc>
+                    nel::panic("invalid Result", ctx);
+    1cf8:	               \-> 48 8d 3d 21 13 00 00 	lea    0x1321(%rip),%rdi        # 3020 <_IO_stdin_used+0x20>
+    1cff:	                   e8 1e f4 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1d04:	                   66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1d0b:	                   00 00 00 00 
+    1d0f:	                   90                   	nop
+
+0000000000001d10 <ex42()>:
+{
+    1d10:	                               41 57                	push   %r15
+    Vec1 vec1 = Vec1::empty();
+    1d12:	                               b9 41 01 00 00       	mov    $0x141,%ecx
+            nel::elem::set(data_, f, N);
+    1d17:	                               be 67 00 00 00       	mov    $0x67,%esi
+    1d1c:	                               48 8d 05 95 13 00 00 	lea    0x1395(%rip),%rax        # 30b8 <_IO_stdin_used+0xb8>
+{
+    1d23:	                               41 56                	push   %r14
+    1d25:	                               48 8d 15 12 13 00 00 	lea    0x1312(%rip),%rdx        # 303e <_IO_stdin_used+0x3e>
+    1d2c:	                               66 48 0f 6e d0       	movq   %rax,%xmm2
+    Vec1 vec1 = Vec1::empty();
+    1d31:	                               31 c0                	xor    %eax,%eax
+{
+    1d33:	                               41 55                	push   %r13
+    1d35:	                               66 48 0f 6e ca       	movq   %rdx,%xmm1
+    1d3a:	                               ba 00 01 00 00       	mov    $0x100,%edx
+    1d3f:	                               41 54                	push   %r12
+    1d41:	                               66 0f 6c ca          	punpcklqdq %xmm2,%xmm1
+    1d45:	                               55                   	push   %rbp
+    1d46:	                               53                   	push   %rbx
+    1d47:	                               48 81 ec 58 0c 00 00 	sub    $0xc58,%rsp
+    Vec1 vec1 = Vec1::empty();
+    1d4e:	                               48 8d bc 24 40 02 00 	lea    0x240(%rsp),%rdi
+    1d55:	                               00 
+    1d56:	                               48 8d 5c 24 30       	lea    0x30(%rsp),%rbx
+    1d5b:	                               0f 29 0c 24          	movaps %xmm1,(%rsp)
+    1d5f:	                               f3 48 ab             	rep stos %rax,%es:(%rdi)
+    1d62:	                               48 89 df             	mov    %rbx,%rdi
+    1d65:	                               e8 76 06 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return len_;
+    1d6a:	                               48 8b 84 24 40 02 00 	mov    0x240(%rsp),%rax
+    1d71:	                               00 
+            if (len() >= capacity()) {
+    1d72:	                               48 83 f8 09          	cmp    $0x9,%rax
+    1d76:	         /-------------------- 0f 86 94 01 00 00    	jbe    1f10 <ex42()+0x200>
+            nel::elem::move(data_, o.data_, N);
+    1d7c:	         |                     48 8d ac 24 34 01 00 	lea    0x134(%rsp),%rbp
+    1d83:	         |                     00 
+    1d84:	         |                     ba 00 01 00 00       	mov    $0x100,%edx
+    1d89:	         |                     48 89 de             	mov    %rbx,%rsi
+            : tag_(Tag::ERR)
+    1d8c:	         |                     c7 84 24 30 01 00 00 	movl   $0x2,0x130(%rsp)
+    1d93:	         |                     02 00 00 00 
+    1d97:	         |                     48 89 ef             	mov    %rbp,%rdi
+    1d9a:	         |                     e8 51 06 00 00       	call   23f0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    1d9f:	         |                     66 0f 6f 0c 24       	movdqa (%rsp),%xmm1
+    1da4:	         |                     8b 84 24 30 01 00 00 	mov    0x130(%rsp),%eax
+            , line_num_(line_num)
+    1dab:	         |                     c7 44 24 20 48 00 00 	movl   $0x48,0x20(%rsp)
+    1db2:	         |                     00 
+            : fn_name_(fn_name)
+    1db3:	         |                     0f 29 4c 24 10       	movaps %xmm1,0x10(%rsp)
+            switch (tag_) { // result<void>-match
+    1db8:	         |                     83 f8 01             	cmp    $0x1,%eax
+    1dbb:	         |  /----------------- 74 1b                	je     1dd8 <ex42()+0xc8>
+    1dbd:	         |  |                  83 f8 02             	cmp    $0x2,%eax
+    1dc0:	      /--|--|----------------- 0f 85 2d 01 00 00    	jne    1ef3 <ex42()+0x1e3>
+            nel::elem::set(data_, 0xa5, N);
+    1dc6:	      |  |  |                  ba 00 01 00 00       	mov    $0x100,%edx
+    1dcb:	      |  |  |                  be a5 00 00 00       	mov    $0xa5,%esi
+    1dd0:	      |  |  |                  48 89 ef             	mov    %rbp,%rdi
+    1dd3:	      |  |  |                  e8 08 06 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1dd8:	      |  |  >----------------> ba 00 01 00 00       	mov    $0x100,%edx
+    1ddd:	      |  |  |                  be a5 00 00 00       	mov    $0xa5,%esi
+    1de2:	      |  |  |                  48 89 df             	mov    %rbx,%rdi
+    1de5:	      |  |  |                  e8 f6 05 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            nel::elem::set(data_, f, N);
+    1dea:	      |  |  |                  ba 00 01 00 00       	mov    $0x100,%edx
+    1def:	      |  |  |                  be 68 00 00 00       	mov    $0x68,%esi
+    1df4:	      |  |  |                  48 89 df             	mov    %rbx,%rdi
+    1df7:	      |  |  |                  e8 e4 05 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return len_;
+    1dfc:	      |  |  |                  48 8b 84 24 40 02 00 	mov    0x240(%rsp),%rax
+    1e03:	      |  |  |                  00 
+            if (len() >= capacity()) {
+    1e04:	      |  |  |                  48 83 f8 09          	cmp    $0x9,%rax
+    1e08:	      |  |  |        /-------- 0f 87 29 01 00 00    	ja     1f37 <ex42()+0x227>
+            return &ptr()[d];
+    1e0e:	      |  |  |        |         48 c1 e0 08          	shl    $0x8,%rax
+            nel::elem::move(data_, o.data_, N);
+    1e12:	      |  |  |        |         ba 00 01 00 00       	mov    $0x100,%edx
+    1e17:	      |  |  |        |         48 89 de             	mov    %rbx,%rsi
+    1e1a:	      |  |  |        |         48 8d bc 04 48 02 00 	lea    0x248(%rsp,%rax,1),%rdi
+    1e21:	      |  |  |        |         00 
+    1e22:	      |  |  |        |         e8 c9 05 00 00       	call   23f0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            len_ += 1;
+    1e27:	      |  |  |        |         48 83 84 24 40 02 00 	addq   $0x1,0x240(%rsp)
+    1e2e:	      |  |  |        |         00 01 
+            nel::elem::set(data_, 0xa5, N);
+    1e30:	      |  |  |  /-----|-------> ba 00 01 00 00       	mov    $0x100,%edx
+    1e35:	      |  |  |  |     |         be a5 00 00 00       	mov    $0xa5,%esi
+    1e3a:	      |  |  |  |     |         48 89 df             	mov    %rbx,%rdi
+    1e3d:	      |  |  |  |     |         e8 9e 05 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            nel::elem::set(data_, f, N);
+    1e42:	      |  |  |  |     |         ba 00 01 00 00       	mov    $0x100,%edx
+    1e47:	      |  |  |  |     |         be 69 00 00 00       	mov    $0x69,%esi
+    1e4c:	      |  |  |  |     |         48 89 df             	mov    %rbx,%rdi
+    1e4f:	      |  |  |  |     |         e8 8c 05 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return len_;
+    1e54:	      |  |  |  |     |         48 8b 84 24 40 02 00 	mov    0x240(%rsp),%rax
+    1e5b:	      |  |  |  |     |         00 
+            if (len() >= capacity()) {
+    1e5c:	      |  |  |  |     |         48 83 f8 09          	cmp    $0x9,%rax
+    1e60:	      |  |  |  |  /--|-------- 0f 86 36 01 00 00    	jbe    1f9c <ex42()+0x28c>
+            nel::elem::move(data_, o.data_, N);
+    1e66:	      |  |  |  |  |  |         48 8d ac 24 34 01 00 	lea    0x134(%rsp),%rbp
+    1e6d:	      |  |  |  |  |  |         00 
+    1e6e:	      |  |  |  |  |  |         ba 00 01 00 00       	mov    $0x100,%edx
+    1e73:	      |  |  |  |  |  |         48 89 de             	mov    %rbx,%rsi
+            : tag_(Tag::ERR)
+    1e76:	      |  |  |  |  |  |         c7 84 24 30 01 00 00 	movl   $0x2,0x130(%rsp)
+    1e7d:	      |  |  |  |  |  |         02 00 00 00 
+    1e81:	      |  |  |  |  |  |         48 89 ef             	mov    %rbp,%rdi
+    1e84:	      |  |  |  |  |  |         e8 67 05 00 00       	call   23f0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    1e89:	      |  |  |  |  |  |         66 0f 6f 24 24       	movdqa (%rsp),%xmm4
+    1e8e:	      |  |  |  |  |  |         8b 84 24 30 01 00 00 	mov    0x130(%rsp),%eax
+            , line_num_(line_num)
+    1e95:	      |  |  |  |  |  |         c7 44 24 20 4a 00 00 	movl   $0x4a,0x20(%rsp)
+    1e9c:	      |  |  |  |  |  |         00 
+            : fn_name_(fn_name)
+    1e9d:	      |  |  |  |  |  |         0f 29 64 24 10       	movaps %xmm4,0x10(%rsp)
+            switch (tag_) { // result<void>-match
+    1ea2:	      |  |  |  |  |  |         83 f8 01             	cmp    $0x1,%eax
+    1ea5:	      |  |  |  |  |  |  /----- 74 17                	je     1ebe <ex42()+0x1ae>
+    1ea7:	      |  |  |  |  |  |  |      83 f8 02             	cmp    $0x2,%eax
+    1eaa:	      +--|--|--|--|--|--|----- 75 47                	jne    1ef3 <ex42()+0x1e3>
+            nel::elem::set(data_, 0xa5, N);
+    1eac:	      |  |  |  |  |  |  |      ba 00 01 00 00       	mov    $0x100,%edx
+    1eb1:	      |  |  |  |  |  |  |      be a5 00 00 00       	mov    $0xa5,%esi
+    1eb6:	      |  |  |  |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    1eb9:	      |  |  |  |  |  |  |      e8 22 05 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1ebe:	      |  |  |  |  |  |  >----> ba 00 01 00 00       	mov    $0x100,%edx
+    1ec3:	      |  |  |  |  |  |  |      be a5 00 00 00       	mov    $0xa5,%esi
+    1ec8:	      |  |  |  |  |  |  |      48 89 df             	mov    %rbx,%rdi
+    1ecb:	      |  |  |  |  |  |  |      e8 10 05 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return len_;
+    1ed0:	      |  |  |  |  |  |  |      48 8b 84 24 40 02 00 	mov    0x240(%rsp),%rax
+    1ed7:	      |  |  |  |  |  |  |      00 
+            if (len() == 0) { return None; }
+    1ed8:	      |  |  |  |  |  |  |      48 85 c0             	test   %rax,%rax
+    1edb:	      |  |  |  |  |  |  |  /-- 0f 85 e2 00 00 00    	jne    1fc3 <ex42()+0x2b3>
+}
+    1ee1:	   /--|--|--|--|--|--|--|--|-> 48 81 c4 58 0c 00 00 	add    $0xc58,%rsp
+    1ee8:	   |  |  |  |  |  |  |  |  |   5b                   	pop    %rbx
+    1ee9:	   |  |  |  |  |  |  |  |  |   5d                   	pop    %rbp
+    1eea:	   |  |  |  |  |  |  |  |  |   41 5c                	pop    %r12
+    1eec:	   |  |  |  |  |  |  |  |  |   41 5d                	pop    %r13
+    1eee:	   |  |  |  |  |  |  |  |  |   41 5e                	pop    %r14
+    1ef0:	   |  |  |  |  |  |  |  |  |   41 5f                	pop    %r15
+    1ef2:	   |  |  |  |  |  |  |  |  |   c3                   	ret
+                    nel::panic("bad Result", ctx);
+    1ef3:	   |  >--|--|--|--|--|--|--|-> 48 8d 74 24 10       	lea    0x10(%rsp),%rsi
+            switch (tag_) { // result<void>-match
+    1ef8:	   |  |  |  |  |  |  |  |  |   85 c0                	test   %eax,%eax
+    1efa:	/--|--|--|--|--|--|--|--|--|-- 0f 84 80 02 00 00    	je     2180 <ex42()+0x470>
+                    nel::panic("bad Result", ctx);
+    1f00:	|  |  |  |  |  |  |  |  |  |   48 8d 3d 28 11 00 00 	lea    0x1128(%rip),%rdi        # 302f <_IO_stdin_used+0x2f>
+    1f07:	|  |  |  |  |  |  |  |  |  |   e8 16 f2 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1f0c:	|  |  |  |  |  |  |  |  |  |   0f 1f 40 00          	nopl   0x0(%rax)
+            return &ptr()[d];
+    1f10:	|  |  |  \--|--|--|--|--|--|-> 48 c1 e0 08          	shl    $0x8,%rax
+            nel::elem::move(data_, o.data_, N);
+    1f14:	|  |  |     |  |  |  |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1f19:	|  |  |     |  |  |  |  |  |   48 89 de             	mov    %rbx,%rsi
+    1f1c:	|  |  |     |  |  |  |  |  |   48 8d bc 04 48 02 00 	lea    0x248(%rsp,%rax,1),%rdi
+    1f23:	|  |  |     |  |  |  |  |  |   00 
+    1f24:	|  |  |     |  |  |  |  |  |   e8 c7 04 00 00       	call   23f0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            len_ += 1;
+    1f29:	|  |  |     |  |  |  |  |  |   48 83 84 24 40 02 00 	addq   $0x1,0x240(%rsp)
+    1f30:	|  |  |     |  |  |  |  |  |   00 01 
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    1f32:	|  |  |     \--|--|--|--|--|-- e9 a1 fe ff ff       	jmp    1dd8 <ex42()+0xc8>
+    1f37:	|  |  |        |  |  \--|--|-> 48 8d ac 24 34 01 00 	lea    0x134(%rsp),%rbp
+    1f3e:	|  |  |        |  |     |  |   00 
+    1f3f:	|  |  |        |  |     |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1f44:	|  |  |        |  |     |  |   48 89 de             	mov    %rbx,%rsi
+            : tag_(Tag::ERR)
+    1f47:	|  |  |        |  |     |  |   c7 84 24 30 01 00 00 	movl   $0x2,0x130(%rsp)
+    1f4e:	|  |  |        |  |     |  |   02 00 00 00 
+    1f52:	|  |  |        |  |     |  |   48 89 ef             	mov    %rbp,%rdi
+    1f55:	|  |  |        |  |     |  |   e8 96 04 00 00       	call   23f0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    1f5a:	|  |  |        |  |     |  |   66 0f 6f 1c 24       	movdqa (%rsp),%xmm3
+    1f5f:	|  |  |        |  |     |  |   8b 84 24 30 01 00 00 	mov    0x130(%rsp),%eax
+            , line_num_(line_num)
+    1f66:	|  |  |        |  |     |  |   c7 44 24 20 49 00 00 	movl   $0x49,0x20(%rsp)
+    1f6d:	|  |  |        |  |     |  |   00 
+            : fn_name_(fn_name)
+    1f6e:	|  |  |        |  |     |  |   0f 29 5c 24 10       	movaps %xmm3,0x10(%rsp)
+            switch (tag_) { // result<void>-match
+    1f73:	|  |  |        |  |     |  |   83 f8 01             	cmp    $0x1,%eax
+    1f76:	|  |  |        +--|-----|--|-- 0f 84 b4 fe ff ff    	je     1e30 <ex42()+0x120>
+    1f7c:	|  |  |        |  |     |  |   83 f8 02             	cmp    $0x2,%eax
+    1f7f:	|  |  \--------|--|-----|--|-- 0f 85 6e ff ff ff    	jne    1ef3 <ex42()+0x1e3>
+            nel::elem::set(data_, 0xa5, N);
+    1f85:	|  |           |  |     |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1f8a:	|  |           |  |     |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    1f8f:	|  |           |  |     |  |   48 89 ef             	mov    %rbp,%rdi
+    1f92:	|  |           |  |     |  |   e8 49 04 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+
+    private:
+        Type value_;
+
+    public:
+        constexpr ~Element(void) = default;
+    1f97:	|  |           \--|-----|--|-- e9 94 fe ff ff       	jmp    1e30 <ex42()+0x120>
+            return &ptr()[d];
+    1f9c:	|  |              \-----|--|-> 48 c1 e0 08          	shl    $0x8,%rax
+            nel::elem::move(data_, o.data_, N);
+    1fa0:	|  |                    |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1fa5:	|  |                    |  |   48 89 de             	mov    %rbx,%rsi
+    1fa8:	|  |                    |  |   48 8d bc 04 48 02 00 	lea    0x248(%rsp,%rax,1),%rdi
+    1faf:	|  |                    |  |   00 
+    1fb0:	|  |                    |  |   e8 3b 04 00 00       	call   23f0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            len_ += 1;
+    1fb5:	|  |                    |  |   48 83 84 24 40 02 00 	addq   $0x1,0x240(%rsp)
+    1fbc:	|  |                    |  |   00 01 
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    1fbe:	|  |                    \--|-- e9 fb fe ff ff       	jmp    1ebe <ex42()+0x1ae>
+            len_ -= 1;
+    1fc3:	|  |                       \-> 48 83 e8 01          	sub    $0x1,%rax
+            return &ptr()[d];
+    1fc7:	|  |                           48 8d 8c 24 48 02 00 	lea    0x248(%rsp),%rcx
+    1fce:	|  |                           00 
+    1fcf:	|  |                           ba 00 01 00 00       	mov    $0x100,%edx
+            return *this;
+        }
+
+    private:
+        constexpr Optional(Phantom<Tag::SOME> const, T &&v)
+            : tag_(Tag::SOME)
+    1fd4:	|  |                           c7 84 24 30 01 00 00 	movl   $0x2,0x130(%rsp)
+    1fdb:	|  |                           02 00 00 00 
+            len_ -= 1;
+    1fdf:	|  |                           48 89 84 24 40 02 00 	mov    %rax,0x240(%rsp)
+    1fe6:	|  |                           00 
+    1fe7:	|  |                           48 8d ac 24 34 01 00 	lea    0x134(%rsp),%rbp
+    1fee:	|  |                           00 
+            return &ptr()[d];
+    1fef:	|  |                           48 c1 e0 08          	shl    $0x8,%rax
+    1ff3:	|  |                           48 8d 34 01          	lea    (%rcx,%rax,1),%rsi
+    1ff7:	|  |                           48 89 ef             	mov    %rbp,%rdi
+    1ffa:	|  |                           48 89 0c 24          	mov    %rcx,(%rsp)
+    1ffe:	|  |                           e8 ed 03 00 00       	call   23f0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            switch (tag_) { // optional::dtor
+    2003:	|  |                           8b 84 24 30 01 00 00 	mov    0x130(%rsp),%eax
+    200a:	|  |                           83 f8 01             	cmp    $0x1,%eax
+    200d:	|  |              /----------- 0f 8e 23 01 00 00    	jle    2136 <ex42()+0x426>
+    2013:	|  |              |            83 f8 02             	cmp    $0x2,%eax
+    2016:	|  |              |  /-------- 0f 85 1e 01 00 00    	jne    213a <ex42()+0x42a>
+            nel::elem::set(data_, 0xa5, N);
+    201c:	|  |              |  |         ba 00 01 00 00       	mov    $0x100,%edx
+    2021:	|  |              |  |         be a5 00 00 00       	mov    $0xa5,%esi
+    2026:	|  |              |  |         48 89 ef             	mov    %rbp,%rdi
+    2029:	|  |              |  |         e8 b2 03 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return len_;
+    202e:	|  |              |  |         48 8b 84 24 40 02 00 	mov    0x240(%rsp),%rax
+    2035:	|  |              |  |         00 
+    2036:	|  |           /--|--|-------> 48 8b 0c 24          	mov    (%rsp),%rcx
+    203a:	|  |           |  |  |         48 c1 e0 08          	shl    $0x8,%rax
+    203e:	|  |           |  |  |         4c 8d 34 01          	lea    (%rcx,%rax,1),%r14
+    for (; !it.is_done(); it.inc()) {
+    2042:	|  |           |  |  |         49 39 ce             	cmp    %rcx,%r14
+    2045:	|  +-----------|--|--|-------- 0f 84 96 fe ff ff    	je     1ee1 <ex42()+0x1d1>
+    204b:	|  |           |  |  |         4c 8d a4 24 48 03 00 	lea    0x348(%rsp),%r12
+    2052:	|  |           |  |  |         00 
+    2053:	|  |           |  |  |         4c 8d 3d b8 0f 00 00 	lea    0xfb8(%rip),%r15        # 3012 <_IO_stdin_used+0x12>
+    205a:	|  |           |  |  |         48 8d 2d 28 30 00 00 	lea    0x3028(%rip),%rbp        # 5089 <nel::log>
+            outs << "U8Buf<" << val.len() << ">{";
+    2061:	|  |           |  |  |  /----> 4c 89 fe             	mov    %r15,%rsi
+    2064:	|  |           |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    2067:	|  |           |  |  |  |      4d 89 e5             	mov    %r12,%r13
+    206a:	|  |           |  |  |  |      e8 01 0c 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    206f:	|  |           |  |  |  |      be 00 01 00 00       	mov    $0x100,%esi
+    2074:	|  |           |  |  |  |      49 8d 9c 24 01 ff ff 	lea    -0xff(%r12),%rbx
+    207b:	|  |           |  |  |  |      ff 
+    207c:	|  |           |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    207f:	|  |           |  |  |  |      e8 ac 0c 00 00       	call   2d30 <nel::operator<<(nel::Log&, unsigned long)>
+    2084:	|  |           |  |  |  |      48 8d 35 8e 0f 00 00 	lea    0xf8e(%rip),%rsi        # 3019 <_IO_stdin_used+0x19>
+    208b:	|  |           |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    208e:	|  |           |  |  |  |      e8 dd 0b 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    2093:	|  |           |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    2096:	|  |           |  |  |  |      41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    209d:	|  |           |  |  |  |      ff ff 
+    209f:	|  |           |  |  |  |      e8 ec 0b 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    20a4:	|  |           |  |  |  |      0f 1f 40 00          	nopl   0x0(%rax)
+                    outs << ' ' << val.data_[i];
+    20a8:	|  |           |  |  |  |  /-> be 20 00 00 00       	mov    $0x20,%esi
+    20ad:	|  |           |  |  |  |  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    20b0:	|  |           |  |  |  |  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    20b4:	|  |           |  |  |  |  |   e8 97 0b 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    20b9:	|  |           |  |  |  |  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    20bd:	|  |           |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    20c0:	|  |           |  |  |  |  |   e8 cb 0b 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    20c5:	|  |           |  |  |  |  |   4c 39 e3             	cmp    %r12,%rbx
+    20c8:	|  |           |  |  |  |  \-- 75 de                	jne    20a8 <ex42()+0x398>
+            outs << '}';
+    20ca:	|  |           |  |  |  |      be 7d 00 00 00       	mov    $0x7d,%esi
+    20cf:	|  |           |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    20d2:	|  |           |  |  |  |      4c 8d a3 00 01 00 00 	lea    0x100(%rbx),%r12
+    20d9:	|  |           |  |  |  |      e8 72 0b 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+        nel::log << v << '\n';
+    20de:	|  |           |  |  |  |      be 0a 00 00 00       	mov    $0xa,%esi
+    20e3:	|  |           |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    20e6:	|  |           |  |  |  |      e8 65 0b 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    for (; !it.is_done(); it.inc()) {
+    20eb:	|  |           |  |  |  |      4d 39 ee             	cmp    %r13,%r14
+    20ee:	|  |           |  |  |  \----- 0f 85 6d ff ff ff    	jne    2061 <ex42()+0x351>
+    20f4:	|  |           |  |  |         48 8b ac 24 40 02 00 	mov    0x240(%rsp),%rbp
+    20fb:	|  |           |  |  |         00 
+    20fc:	|  |           |  |  |         48 8b 04 24          	mov    (%rsp),%rax
+    2100:	|  |           |  |  |         48 c1 e5 08          	shl    $0x8,%rbp
+    2104:	|  |           |  |  |         48 01 c5             	add    %rax,%rbp
+    2107:	|  |           |  |  |         48 39 c5             	cmp    %rax,%rbp
+    210a:	|  +-----------|--|--|-------- 0f 84 d1 fd ff ff    	je     1ee1 <ex42()+0x1d1>
+    2110:	|  |           |  |  |         48 89 c3             	mov    %rax,%rbx
+            nel::elem::set(data_, 0xa5, N);
+    2113:	|  |           |  |  |     /-> 48 89 df             	mov    %rbx,%rdi
+    2116:	|  |           |  |  |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    211b:	|  |           |  |  |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    2120:	|  |           |  |  |     |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    2127:	|  |           |  |  |     |   e8 b4 02 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    212c:	|  |           |  |  |     |   48 39 dd             	cmp    %rbx,%rbp
+    212f:	|  |           |  |  |     \-- 75 e2                	jne    2113 <ex42()+0x403>
+    2131:	|  \-----------|--|--|-------- e9 ab fd ff ff       	jmp    1ee1 <ex42()+0x1d1>
+    2136:	|              |  \--|-------> 85 c0                	test   %eax,%eax
+    2138:	|              |     |     /-- 79 38                	jns    2172 <ex42()+0x462>
+    213a:	|              |     \-----|-> 48 8d 05 0c 0f 00 00 	lea    0xf0c(%rip),%rax        # 304d <_IO_stdin_used+0x4d>
+    2141:	|              |           |   48 8d 0d fb 0e 00 00 	lea    0xefb(%rip),%rcx        # 3043 <_IO_stdin_used+0x43>
+                    nel::panic("bad Optional");
+    2148:	|              |           |   48 89 de             	mov    %rbx,%rsi
+            , line_num_(line_num)
+    214b:	|              |           |   c7 44 24 40 87 00 00 	movl   $0x87,0x40(%rsp)
+    2152:	|              |           |   00 
+            : fn_name_(fn_name)
+    2153:	|              |           |   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    2158:	|              |           |   66 48 0f 6e e8       	movq   %rax,%xmm5
+    215d:	|              |           |   48 8d 3d fd 0e 00 00 	lea    0xefd(%rip),%rdi        # 3061 <_IO_stdin_used+0x61>
+    2164:	|              |           |   66 0f 6c c5          	punpcklqdq %xmm5,%xmm0
+    2168:	|              |           |   0f 29 44 24 30       	movaps %xmm0,0x30(%rsp)
+    216d:	|              |           |   e8 b0 ef ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    2172:	|              |           \-> 48 8b 84 24 40 02 00 	mov    0x240(%rsp),%rax
+    2179:	|              |               00 
+    217a:	|              \-------------- e9 b7 fe ff ff       	jmp    2036 <ex42()+0x326>
+    217f:	|                              90                   	nop
+                    nel::panic("invalid Result", ctx);
+    2180:	\----------------------------> 48 8d 3d 99 0e 00 00 	lea    0xe99(%rip),%rdi        # 3020 <_IO_stdin_used+0x20>
+    2187:	                               e8 96 ef ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    218c:	                               0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002190 <ex52()>:
+{
+    2190:	                41 57                	push   %r15
+    2192:	                48 8d 05 1f 0f 00 00 	lea    0xf1f(%rip),%rax        # 30b8 <_IO_stdin_used+0xb8>
+    Vec1 vec1 = Vec1::empty();
+    2199:	                b9 41 01 00 00       	mov    $0x141,%ecx
+    219e:	                48 8d 15 c9 0e 00 00 	lea    0xec9(%rip),%rdx        # 306e <_IO_stdin_used+0x6e>
+{
+    21a5:	                41 56                	push   %r14
+    21a7:	                66 48 0f 6e d0       	movq   %rax,%xmm2
+    21ac:	                66 48 0f 6e ca       	movq   %rdx,%xmm1
+    Vec1 vec1 = Vec1::empty();
+    21b1:	                31 c0                	xor    %eax,%eax
+{
+    21b3:	                41 55                	push   %r13
+    21b5:	                66 0f 6c ca          	punpcklqdq %xmm2,%xmm1
+    21b9:	                41 54                	push   %r12
+    21bb:	                55                   	push   %rbp
+    21bc:	                53                   	push   %rbx
+    Vec1 vec1 = Vec1::empty();
+    21bd:	                bb 01 00 00 00       	mov    $0x1,%ebx
+{
+    21c2:	                48 81 ec 58 0c 00 00 	sub    $0xc58,%rsp
+    Vec1 vec1 = Vec1::empty();
+    21c9:	                48 8d bc 24 40 02 00 	lea    0x240(%rsp),%rdi
+    21d0:	                00 
+    21d1:	                0f 29 0c 24          	movaps %xmm1,(%rsp)
+    21d5:	                48 8d 6c 24 30       	lea    0x30(%rsp),%rbp
+    21da:	                f3 48 ab             	rep stos %rax,%es:(%rdi)
+            return &ptr()[d];
+    21dd:	                4c 8d a4 24 48 02 00 	lea    0x248(%rsp),%r12
+    21e4:	                00 
+    21e5:	   /----------- eb 7b                	jmp    2262 <ex52()+0xd2>
+    21e7:	   |            66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    21ee:	   |            00 00 
+            nel::elem::move(data_, o.data_, N);
+    21f0:	/--|----------> 4c 8d ac 24 34 01 00 	lea    0x134(%rsp),%r13
+    21f7:	|  |            00 
+    21f8:	|  |            ba 00 01 00 00       	mov    $0x100,%edx
+    21fd:	|  |            48 89 ee             	mov    %rbp,%rsi
+            : tag_(Tag::ERR)
+    2200:	|  |            c7 84 24 30 01 00 00 	movl   $0x2,0x130(%rsp)
+    2207:	|  |            02 00 00 00 
+    220b:	|  |            4c 89 ef             	mov    %r13,%rdi
+    220e:	|  |            e8 dd 01 00 00       	call   23f0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    2213:	|  |            66 0f 6f 04 24       	movdqa (%rsp),%xmm0
+    2218:	|  |            8b 84 24 30 01 00 00 	mov    0x130(%rsp),%eax
+            , line_num_(line_num)
+    221f:	|  |            c7 44 24 20 76 00 00 	movl   $0x76,0x20(%rsp)
+    2226:	|  |            00 
+            : fn_name_(fn_name)
+    2227:	|  |            0f 29 44 24 10       	movaps %xmm0,0x10(%rsp)
+            switch (tag_) { // result<void>-match
+    222c:	|  |            83 f8 01             	cmp    $0x1,%eax
+    222f:	|  |  /-------- 74 17                	je     2248 <ex52()+0xb8>
+    2231:	|  |  |         83 f8 02             	cmp    $0x2,%eax
+    2234:	|  |  |  /----- 75 6d                	jne    22a3 <ex52()+0x113>
+            nel::elem::set(data_, 0xa5, N);
+    2236:	|  |  |  |      ba 00 01 00 00       	mov    $0x100,%edx
+    223b:	|  |  |  |      be a5 00 00 00       	mov    $0xa5,%esi
+    2240:	|  |  |  |      4c 89 ef             	mov    %r13,%rdi
+    2243:	|  |  |  |      e8 98 01 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    2248:	|  |  >--|----> ba 00 01 00 00       	mov    $0x100,%edx
+    224d:	|  |  |  |      be a5 00 00 00       	mov    $0xa5,%esi
+    2252:	|  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    for (uint8_t f = 1; f < 10; ++f) {
+    2255:	|  |  |  |      83 c3 01             	add    $0x1,%ebx
+    2258:	|  |  |  |      e8 83 01 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    225d:	|  |  |  |      83 fb 0a             	cmp    $0xa,%ebx
+    2260:	|  |  |  |  /-- 74 5e                	je     22c0 <ex52()+0x130>
+            nel::elem::set(data_, f, N);
+    2262:	|  \--|--|--|-> ba 00 01 00 00       	mov    $0x100,%edx
+    2267:	|     |  |  |   89 de                	mov    %ebx,%esi
+    2269:	|     |  |  |   48 89 ef             	mov    %rbp,%rdi
+    226c:	|     |  |  |   e8 6f 01 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return len_;
+    2271:	|     |  |  |   48 8b 84 24 40 02 00 	mov    0x240(%rsp),%rax
+    2278:	|     |  |  |   00 
+            if (len() >= capacity()) {
+    2279:	|     |  |  |   48 83 f8 09          	cmp    $0x9,%rax
+    227d:	\-----|--|--|-- 0f 87 6d ff ff ff    	ja     21f0 <ex52()+0x60>
+            return &ptr()[d];
+    2283:	      |  |  |   48 c1 e0 08          	shl    $0x8,%rax
+            nel::elem::move(data_, o.data_, N);
+    2287:	      |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    228c:	      |  |  |   48 89 ee             	mov    %rbp,%rsi
+    228f:	      |  |  |   49 8d 3c 04          	lea    (%r12,%rax,1),%rdi
+    2293:	      |  |  |   e8 58 01 00 00       	call   23f0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            len_ += 1;
+    2298:	      |  |  |   48 83 84 24 40 02 00 	addq   $0x1,0x240(%rsp)
+    229f:	      |  |  |   00 01 
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+    22a1:	      \--|--|-- eb a5                	jmp    2248 <ex52()+0xb8>
+                    nel::panic("bad Result", ctx);
+    22a3:	         \--|-> 48 8d 74 24 10       	lea    0x10(%rsp),%rsi
+            switch (tag_) { // result<void>-match
+    22a8:	            |   85 c0                	test   %eax,%eax
+    22aa:	      /-----|-- 0f 84 10 01 00 00    	je     23c0 <ex52()+0x230>
+                    nel::panic("bad Result", ctx);
+    22b0:	      |     |   48 8d 3d 78 0d 00 00 	lea    0xd78(%rip),%rdi        # 302f <_IO_stdin_used+0x2f>
+    22b7:	      |     |   e8 66 ee ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    22bc:	      |     |   0f 1f 40 00          	nopl   0x0(%rax)
+    22c0:	      |     \-> 4c 8d a4 24 48 03 00 	lea    0x348(%rsp),%r12
+    22c7:	      |         00 
+    22c8:	      |         4c 8d bc 24 48 06 00 	lea    0x648(%rsp),%r15
+    22cf:	      |         00 
+    22d0:	      |         4c 8d 35 3b 0d 00 00 	lea    0xd3b(%rip),%r14        # 3012 <_IO_stdin_used+0x12>
+    22d7:	      |         48 8d 2d ab 2d 00 00 	lea    0x2dab(%rip),%rbp        # 5089 <nel::log>
+    22de:	      |         4c 8d 2d 34 0d 00 00 	lea    0xd34(%rip),%r13        # 3019 <_IO_stdin_used+0x19>
+            outs << "U8Buf<" << val.len() << ">{";
+    22e5:	      |  /----> 4c 89 f6             	mov    %r14,%rsi
+    22e8:	      |  |      48 89 ef             	mov    %rbp,%rdi
+    22eb:	      |  |      49 8d 9c 24 01 ff ff 	lea    -0xff(%r12),%rbx
+    22f2:	      |  |      ff 
+    22f3:	      |  |      e8 78 09 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+    22f8:	      |  |      be 00 01 00 00       	mov    $0x100,%esi
+    22fd:	      |  |      48 89 c7             	mov    %rax,%rdi
+    2300:	      |  |      e8 2b 0a 00 00       	call   2d30 <nel::operator<<(nel::Log&, unsigned long)>
+    2305:	      |  |      4c 89 ee             	mov    %r13,%rsi
+    2308:	      |  |      48 89 c7             	mov    %rax,%rdi
+    230b:	      |  |      e8 60 09 00 00       	call   2c70 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    2310:	      |  |      48 89 ef             	mov    %rbp,%rdi
+    2313:	      |  |      41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    231a:	      |  |      ff ff 
+    231c:	      |  |      e8 6f 09 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    2321:	      |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+                    outs << ' ' << val.data_[i];
+    2328:	      |  |  /-> be 20 00 00 00       	mov    $0x20,%esi
+    232d:	      |  |  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    2330:	      |  |  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    2334:	      |  |  |   e8 17 09 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    2339:	      |  |  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    233d:	      |  |  |   48 89 c7             	mov    %rax,%rdi
+    2340:	      |  |  |   e8 4b 09 00 00       	call   2c90 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    2345:	      |  |  |   4c 39 e3             	cmp    %r12,%rbx
+    2348:	      |  |  \-- 75 de                	jne    2328 <ex52()+0x198>
+            outs << '}';
+    234a:	      |  |      be 7d 00 00 00       	mov    $0x7d,%esi
+    234f:	      |  |      48 89 ef             	mov    %rbp,%rdi
+    for (; !it.is_done(); it.inc()) {
+    2352:	      |  |      4c 8d a3 00 01 00 00 	lea    0x100(%rbx),%r12
+    2359:	      |  |      e8 f2 08 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+        nel::log << v << '\n';
+    235e:	      |  |      be 0a 00 00 00       	mov    $0xa,%esi
+    2363:	      |  |      48 89 ef             	mov    %rbp,%rdi
+    2366:	      |  |      e8 e5 08 00 00       	call   2c50 <nel::operator<<(nel::Log&, char)>
+    for (; !it.is_done(); it.inc()) {
+    236b:	      |  |      4d 39 fc             	cmp    %r15,%r12
+    236e:	      |  \----- 0f 85 71 ff ff ff    	jne    22e5 <ex52()+0x155>
+    2374:	      |         48 8b ac 24 40 02 00 	mov    0x240(%rsp),%rbp
+    237b:	      |         00 
+    237c:	      |         48 8d 9c 24 48 02 00 	lea    0x248(%rsp),%rbx
+    2383:	      |         00 
+    2384:	      |         48 c1 e5 08          	shl    $0x8,%rbp
+    2388:	      |         48 01 dd             	add    %rbx,%rbp
+    238b:	      |         48 39 dd             	cmp    %rbx,%rbp
+    238e:	      |  /----- 74 1e                	je     23ae <ex52()+0x21e>
+            nel::elem::set(data_, 0xa5, N);
+    2390:	      |  |  /-> 48 89 df             	mov    %rbx,%rdi
+    2393:	      |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    2398:	      |  |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    239d:	      |  |  |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    23a4:	      |  |  |   e8 37 00 00 00       	call   23e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    23a9:	      |  |  |   48 39 dd             	cmp    %rbx,%rbp
+    23ac:	      |  |  \-- 75 e2                	jne    2390 <ex52()+0x200>
+}
+    23ae:	      |  \----> 48 81 c4 58 0c 00 00 	add    $0xc58,%rsp
+    23b5:	      |         5b                   	pop    %rbx
+    23b6:	      |         5d                   	pop    %rbp
+    23b7:	      |         41 5c                	pop    %r12
+    23b9:	      |         41 5d                	pop    %r13
+    23bb:	      |         41 5e                	pop    %r14
+    23bd:	      |         41 5f                	pop    %r15
+    23bf:	      |         c3                   	ret
+                    nel::panic("invalid Result", ctx);
+    23c0:	      \-------> 48 8d 3d 59 0c 00 00 	lea    0xc59(%rip),%rdi        # 3020 <_IO_stdin_used+0x20>
+    23c7:	                e8 56 ed ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    23cc:	                0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000023d0 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    23d0:	e9 cb ec ff ff       	jmp    10a0 <memcpy@plt>
+    23d5:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    23dc:	00 00 00 00 
+
+00000000000023e0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    23e0:	40 0f b6 f6          	movzbl %sil,%esi
+    23e4:	e9 77 ec ff ff       	jmp    1060 <memset@plt>
+    23e9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000023f0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+}
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    23f0:	e9 ab ec ff ff       	jmp    10a0 <memcpy@plt>
+    23f5:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    23fc:	00 00 00 00 
+
+0000000000002400 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    2400:	e9 cb ec ff ff       	jmp    10d0 <memmove@plt>
+    2405:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    240c:	00 00 00 00 
+
+0000000000002410 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    2410:	48 89 f2             	mov    %rsi,%rdx
+    std::memset(d, s, n);
+    2413:	be a5 00 00 00       	mov    $0xa5,%esi
+    2418:	e9 43 ec ff ff       	jmp    1060 <memset@plt>
+    241d:	0f 1f 00             	nopl   (%rax)
+
+0000000000002420 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+    set(d, 0xa5, n);
+}
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    2420:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    2424:	e8 57 ec ff ff       	call   1080 <memcmp@plt>
+    2429:	85 c0                	test   %eax,%eax
+    242b:	0f 94 c0             	sete   %al
+}
+    242e:	48 83 c4 08          	add    $0x8,%rsp
+    2432:	c3                   	ret
+    2433:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    243a:	00 00 00 00 
+    243e:	66 90                	xchg   %ax,%ax
+
+0000000000002440 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    2440:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    2444:	e8 37 ec ff ff       	call   1080 <memcmp@plt>
+    2449:	85 c0                	test   %eax,%eax
+    244b:	0f 95 c0             	setne  %al
+}
+    244e:	48 83 c4 08          	add    $0x8,%rsp
+    2452:	c3                   	ret
+    2453:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    245a:	00 00 00 00 
+    245e:	66 90                	xchg   %ax,%ax
+
+0000000000002460 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    if (n < streaming_min) {
+    2460:	                48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    2467:	/-------------- 0f 86 d7 00 00 00    	jbe    2544 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xe4>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    246d:	|               48 89 f9             	mov    %rdi,%rcx
+{
+    2470:	|               53                   	push   %rbx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2471:	|               48 f7 d9             	neg    %rcx
+    2474:	|               83 e1 0f             	and    $0xf,%ecx
+    std::memcpy(d, s, n);
+    2477:	|               83 f9 08             	cmp    $0x8,%ecx
+    247a:	|     /-------- 0f 82 d0 00 00 00    	jb     2550 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xf0>
+    2480:	|     |         48 8b 06             	mov    (%rsi),%rax
+    2483:	|     |         4c 8d 57 08          	lea    0x8(%rdi),%r10
+    2487:	|     |         48 89 f3             	mov    %rsi,%rbx
+    248a:	|     |         49 83 e2 f8          	and    $0xfffffffffffffff8,%r10
+    248e:	|     |         48 89 07             	mov    %rax,(%rdi)
+    2491:	|     |         48 8b 44 0e f8       	mov    -0x8(%rsi,%rcx,1),%rax
+    2496:	|     |         48 89 44 0f f8       	mov    %rax,-0x8(%rdi,%rcx,1)
+    249b:	|     |         48 89 f8             	mov    %rdi,%rax
+    249e:	|     |         4c 29 d0             	sub    %r10,%rax
+    24a1:	|     |         48 29 c3             	sub    %rax,%rbx
+    24a4:	|     |         01 c8                	add    %ecx,%eax
+    24a6:	|     |         83 e0 f8             	and    $0xfffffff8,%eax
+    24a9:	|     |         83 f8 08             	cmp    $0x8,%eax
+    24ac:	|  /--|-------- 72 1a                	jb     24c8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    24ae:	|  |  |         83 e0 f8             	and    $0xfffffff8,%eax
+    24b1:	|  |  |         45 31 c0             	xor    %r8d,%r8d
+    24b4:	|  |  |     /-> 45 89 c1             	mov    %r8d,%r9d
+    24b7:	|  |  |     |   41 83 c0 08          	add    $0x8,%r8d
+    24bb:	|  |  |     |   4e 8b 1c 0b          	mov    (%rbx,%r9,1),%r11
+    24bf:	|  |  |     |   4f 89 1c 0a          	mov    %r11,(%r10,%r9,1)
+    24c3:	|  |  |     |   41 39 c0             	cmp    %eax,%r8d
+    24c6:	|  |  |     \-- 72 ec                	jb     24b4 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x54>
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    24c8:	|  >--|-------> 48 8d 41 40          	lea    0x40(%rcx),%rax
+    24cc:	|  |  |         48 01 f9             	add    %rdi,%rcx
+    24cf:	|  |  |         90                   	nop
+    std::memcpy(&v, s, sizeof(v));
+    24d0:	|  |  |     /-> f3 0f 6f 54 06 d0    	movdqu -0x30(%rsi,%rax,1),%xmm2
+    24d6:	|  |  |     |   f3 0f 6f 4c 06 e0    	movdqu -0x20(%rsi,%rax,1),%xmm1
+    24dc:	|  |  |     |   49 89 c0             	mov    %rax,%r8
+    for (; i + 64 <= n; i += 64) {
+    24df:	|  |  |     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    24e3:	|  |  |     |   f3 0f 6f 44 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    24e9:	|  |  |     |   f3 0f 6f 5c 06 c0    	movdqu -0x40(%rsi,%rax,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    24ef:	|  |  |     |   48 83 c0 40          	add    $0x40,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    24f3:	|  |  |     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    24f8:	|  |  |     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    24fd:	|  |  |     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    2502:	|  |  |     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    2507:	|  |  |     |   48 39 c2             	cmp    %rax,%rdx
+    250a:	|  |  |     \-- 73 c4                	jae    24d0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x70>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    250c:	|  |  |         49 8d 40 10          	lea    0x10(%r8),%rax
+    2510:	|  |  |         48 39 c2             	cmp    %rax,%rdx
+    2513:	|  |  |  /----- 72 22                	jb     2537 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd7>
+    2515:	|  |  |  |      48 8d 4f f0          	lea    -0x10(%rdi),%rcx
+    2519:	|  |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2520:	|  |  |  |  /-> f3 0f 6f 64 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm4
+    2526:	|  |  |  |  |   49 89 c0             	mov    %rax,%r8
+    2529:	|  |  |  |  |   66 0f e7 24 01       	movntdq %xmm4,(%rcx,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    252e:	|  |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    2532:	|  |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    2535:	|  |  |  |  \-- 73 e9                	jae    2520 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc0>
+        stream16(d + i, load16(s + i));
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    2537:	|  |  |  \----> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    253a:	|  |  |         4c 01 c7             	add    %r8,%rdi
+    253d:	|  |  |         4c 29 c2             	sub    %r8,%rdx
+    2540:	|  |  |         4c 01 c6             	add    %r8,%rsi
+}
+    2543:	|  |  |         5b                   	pop    %rbx
+    std::memcpy(d, s, n);
+    2544:	\--|--|-------> e9 57 eb ff ff       	jmp    10a0 <memcpy@plt>
+    2549:	   |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    2550:	   |  \-------> f6 c1 04             	test   $0x4,%cl
+    2553:	   |        /-- 75 25                	jne    257a <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x11a>
+    2555:	   |        |   85 c9                	test   %ecx,%ecx
+    2557:	   +--------|-- 0f 84 6b ff ff ff    	je     24c8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    255d:	   |        |   0f b6 06             	movzbl (%rsi),%eax
+    2560:	   |        |   88 07                	mov    %al,(%rdi)
+    2562:	   |        |   f6 c1 02             	test   $0x2,%cl
+    2565:	   +--------|-- 0f 84 5d ff ff ff    	je     24c8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    256b:	   |        |   0f b7 44 0e fe       	movzwl -0x2(%rsi,%rcx,1),%eax
+    2570:	   |        |   66 89 44 0f fe       	mov    %ax,-0x2(%rdi,%rcx,1)
+    2575:	   +--------|-- e9 4e ff ff ff       	jmp    24c8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    257a:	   |        \-> 8b 06                	mov    (%rsi),%eax
+    257c:	   |            89 07                	mov    %eax,(%rdi)
+    257e:	   |            8b 44 0e fc          	mov    -0x4(%rsi,%rcx,1),%eax
+    2582:	   |            89 44 0f fc          	mov    %eax,-0x4(%rdi,%rcx,1)
+    2586:	   \----------- e9 3d ff ff ff       	jmp    24c8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    258b:	                0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000002590 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    2590:	                                           49 89 f8             	mov    %rdi,%r8
+    2593:	                                           48 89 f1             	mov    %rsi,%rcx
+    if (n < streaming_min) {
+    2596:	                                           48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    259d:	                              /----------- 0f 86 85 03 00 00    	jbe    2928 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x398>
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    25a3:	                              |            48 89 fe             	mov    %rdi,%rsi
+{
+    25a6:	                              |            41 57                	push   %r15
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    25a8:	                              |            48 f7 de             	neg    %rsi
+{
+    25ab:	                              |            41 56                	push   %r14
+    for (Index i = 0; i < head; ++i) {
+    25ad:	                              |            48 89 f0             	mov    %rsi,%rax
+{
+    25b0:	                              |            41 55                	push   %r13
+    25b2:	                              |            41 54                	push   %r12
+    25b4:	                              |            55                   	push   %rbp
+    25b5:	                              |            53                   	push   %rbx
+    for (Index i = 0; i < head; ++i) {
+    25b6:	                              |            83 e0 0f             	and    $0xf,%eax
+    25b9:	/-----------------------------|----------- 0f 84 01 01 00 00    	je     26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    25bf:	|                             |            48 8d 78 ff          	lea    -0x1(%rax),%rdi
+    25c3:	|                             |            48 83 ff 02          	cmp    $0x2,%rdi
+    25c7:	|  /--------------------------|----------- 0f 86 8a 04 00 00    	jbe    2a57 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4c7>
+    25cd:	|  |                          |            4c 8d 51 01          	lea    0x1(%rcx),%r10
+    25d1:	|  |                          |            4d 89 c1             	mov    %r8,%r9
+    25d4:	|  |                          |            4d 29 d1             	sub    %r10,%r9
+    25d7:	|  |                          |            49 83 f9 06          	cmp    $0x6,%r9
+    25db:	|  |                          |  /-------- 0f 87 c7 02 00 00    	ja     28a8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x318>
+        d[i] = p[i];
+    25e1:	|  |                          |  |         0f b6 39             	movzbl (%rcx),%edi
+    25e4:	|  |                          |  |         41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    25e7:	|  |                          |  |         40 f6 c6 0e          	test   $0xe,%sil
+    25eb:	+--|--------------------------|--|-------- 0f 84 cf 00 00 00    	je     26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    25f1:	|  |                          |  |         0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    25f5:	|  |                          |  |         41 88 78 01          	mov    %dil,0x1(%r8)
+    25f9:	|  |  /-----------------------|--|-------> 0f b6 79 02          	movzbl 0x2(%rcx),%edi
+    25fd:	|  |  |                       |  |         41 88 78 02          	mov    %dil,0x2(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2601:	|  |  |                       |  |         40 f6 c6 0c          	test   $0xc,%sil
+    2605:	+--|--|-----------------------|--|-------- 0f 84 b5 00 00 00    	je     26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    260b:	|  |  |                       |  |         0f b6 79 03          	movzbl 0x3(%rcx),%edi
+    260f:	|  |  |                       |  |         41 88 78 03          	mov    %dil,0x3(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2613:	|  |  |                       |  |         48 83 f8 04          	cmp    $0x4,%rax
+    2617:	+--|--|-----------------------|--|-------- 0f 86 a3 00 00 00    	jbe    26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    261d:	|  |  |                       |  |         0f b6 79 04          	movzbl 0x4(%rcx),%edi
+    2621:	|  |  |                       |  |         41 88 78 04          	mov    %dil,0x4(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2625:	|  |  |                       |  |         48 83 f8 05          	cmp    $0x5,%rax
+    2629:	+--|--|-----------------------|--|-------- 0f 84 91 00 00 00    	je     26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    262f:	|  |  |                       |  |         0f b6 79 05          	movzbl 0x5(%rcx),%edi
+    2633:	|  |  |                       |  |         41 88 78 05          	mov    %dil,0x5(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2637:	|  |  |                       |  |         48 83 f8 06          	cmp    $0x6,%rax
+    263b:	+--|--|-----------------------|--|-------- 0f 84 7f 00 00 00    	je     26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2641:	|  |  |                       |  |         0f b6 79 06          	movzbl 0x6(%rcx),%edi
+    for (Index i = 0; i < head; ++i) {
+    2645:	|  |  |                       |  |         83 e6 08             	and    $0x8,%esi
+        d[i] = p[i];
+    2648:	|  |  |                       |  |         41 88 78 06          	mov    %dil,0x6(%r8)
+    for (Index i = 0; i < head; ++i) {
+    264c:	+--|--|-----------------------|--|-------- 74 72                	je     26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    264e:	|  |  |                       |  |         0f b6 71 07          	movzbl 0x7(%rcx),%esi
+    2652:	|  |  |                       |  |         41 88 70 07          	mov    %sil,0x7(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2656:	|  |  |                       |  |         48 83 f8 08          	cmp    $0x8,%rax
+    265a:	+--|--|-----------------------|--|-------- 76 64                	jbe    26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    265c:	|  |  |                       |  |         0f b6 71 08          	movzbl 0x8(%rcx),%esi
+    2660:	|  |  |                       |  |         41 88 70 08          	mov    %sil,0x8(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2664:	|  |  |                       |  |         48 83 f8 09          	cmp    $0x9,%rax
+    2668:	+--|--|-----------------------|--|-------- 74 56                	je     26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    266a:	|  |  |                       |  |         0f b6 71 09          	movzbl 0x9(%rcx),%esi
+    266e:	|  |  |                       |  |         41 88 70 09          	mov    %sil,0x9(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2672:	|  |  |                       |  |         48 83 f8 0a          	cmp    $0xa,%rax
+    2676:	+--|--|-----------------------|--|-------- 74 48                	je     26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2678:	|  |  |                       |  |         0f b6 71 0a          	movzbl 0xa(%rcx),%esi
+    267c:	|  |  |                       |  |         41 88 70 0a          	mov    %sil,0xa(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2680:	|  |  |                       |  |         48 83 f8 0b          	cmp    $0xb,%rax
+    2684:	+--|--|-----------------------|--|-------- 74 3a                	je     26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2686:	|  |  |                       |  |         0f b6 71 0b          	movzbl 0xb(%rcx),%esi
+    268a:	|  |  |                       |  |         41 88 70 0b          	mov    %sil,0xb(%r8)
+    for (Index i = 0; i < head; ++i) {
+    268e:	|  |  |                       |  |         48 83 f8 0c          	cmp    $0xc,%rax
+    2692:	+--|--|-----------------------|--|-------- 74 2c                	je     26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2694:	|  |  |                       |  |         0f b6 71 0c          	movzbl 0xc(%rcx),%esi
+    2698:	|  |  |                       |  |         41 88 70 0c          	mov    %sil,0xc(%r8)
+    for (Index i = 0; i < head; ++i) {
+    269c:	|  |  |                       |  |         48 83 f8 0d          	cmp    $0xd,%rax
+    26a0:	+--|--|-----------------------|--|-------- 74 1e                	je     26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    26a2:	|  |  |                       |  |         0f b6 71 0d          	movzbl 0xd(%rcx),%esi
+    26a6:	|  |  |                       |  |         41 88 70 0d          	mov    %sil,0xd(%r8)
+    for (Index i = 0; i < head; ++i) {
+    26aa:	|  |  |                       |  |         49 8d 70 ff          	lea    -0x1(%r8),%rsi
+    26ae:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    26b1:	+--|--|-----------------------|--|-------- 75 0d                	jne    26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    26b3:	|  |  |                       |  |         0f b6 71 0e          	movzbl 0xe(%rcx),%esi
+    26b7:	|  |  |                       |  |         41 88 70 0e          	mov    %sil,0xe(%r8)
+    for (Index i = 0; i < head; ++i) {
+    26bb:	|  |  |                       |  |         0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+        rotated[i] = p[(head + i) % 16];
+    26c0:	>--|--|-----------------------|--|-------> 48 8d 70 07          	lea    0x7(%rax),%rsi
+    26c4:	|  |  |                       |  |         4c 8d 78 06          	lea    0x6(%rax),%r15
+    26c8:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    26cb:	|  |  |                       |  |         4c 8d 70 05          	lea    0x5(%rax),%r14
+    26cf:	|  |  |                       |  |         4c 8d 68 04          	lea    0x4(%rax),%r13
+    26d3:	|  |  |                       |  |         41 83 e7 0f          	and    $0xf,%r15d
+    std::memcpy(&v, s, sizeof(v));
+    26d7:	|  |  |                       |  |         0f b6 34 31          	movzbl (%rcx,%rsi,1),%esi
+        rotated[i] = p[(head + i) % 16];
+    26db:	|  |  |                       |  |         41 83 e6 0f          	and    $0xf,%r14d
+    26df:	|  |  |                       |  |         41 83 e5 0f          	and    $0xf,%r13d
+    26e3:	|  |  |                       |  |         4c 8d 60 03          	lea    0x3(%rax),%r12
+    std::memcpy(&v, s, sizeof(v));
+    26e7:	|  |  |                       |  |         46 0f b6 3c 39       	movzbl (%rcx,%r15,1),%r15d
+    26ec:	|  |  |                       |  |         46 0f b6 34 31       	movzbl (%rcx,%r14,1),%r14d
+        rotated[i] = p[(head + i) % 16];
+    26f1:	|  |  |                       |  |         48 8d 78 08          	lea    0x8(%rax),%rdi
+    26f5:	|  |  |                       |  |         41 83 e4 0f          	and    $0xf,%r12d
+    std::memcpy(&v, s, sizeof(v));
+    26f9:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    26fd:	|  |  |                       |  |         46 0f b6 2c 29       	movzbl (%rcx,%r13,1),%r13d
+        rotated[i] = p[(head + i) % 16];
+    2702:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    2705:	|  |  |                       |  |         48 8d 68 02          	lea    0x2(%rax),%rbp
+    std::memcpy(&v, s, sizeof(v));
+    2709:	|  |  |                       |  |         4c 09 fe             	or     %r15,%rsi
+        rotated[i] = p[(head + i) % 16];
+    270c:	|  |  |                       |  |         48 89 7c 24 c8       	mov    %rdi,-0x38(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    2711:	|  |  |                       |  |         46 0f b6 24 21       	movzbl (%rcx,%r12,1),%r12d
+        rotated[i] = p[(head + i) % 16];
+    2716:	|  |  |                       |  |         83 e5 0f             	and    $0xf,%ebp
+    std::memcpy(&v, s, sizeof(v));
+    2719:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    271d:	|  |  |                       |  |         48 8d 78 09          	lea    0x9(%rax),%rdi
+    std::memcpy(&v, s, sizeof(v));
+    2721:	|  |  |                       |  |         0f b6 2c 29          	movzbl (%rcx,%rbp,1),%ebp
+        rotated[i] = p[(head + i) % 16];
+    2725:	|  |  |                       |  |         48 8d 58 01          	lea    0x1(%rax),%rbx
+    std::memcpy(&v, s, sizeof(v));
+    2729:	|  |  |                       |  |         4c 09 f6             	or     %r14,%rsi
+        rotated[i] = p[(head + i) % 16];
+    272c:	|  |  |                       |  |         49 89 fb             	mov    %rdi,%r11
+    272f:	|  |  |                       |  |         48 8d 78 0a          	lea    0xa(%rax),%rdi
+    2733:	|  |  |                       |  |         83 e3 0f             	and    $0xf,%ebx
+    std::memcpy(&v, s, sizeof(v));
+    2736:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    273a:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    273e:	|  |  |                       |  |         49 89 fa             	mov    %rdi,%r10
+    std::memcpy(&v, s, sizeof(v));
+    2741:	|  |  |                       |  |         4c 09 ee             	or     %r13,%rsi
+        rotated[i] = p[(head + i) % 16];
+    2744:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    2748:	|  |  |                       |  |         48 8d 78 0b          	lea    0xb(%rax),%rdi
+    274c:	|  |  |                       |  |         4c 89 5c 24 e0       	mov    %r11,-0x20(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    2751:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    2755:	|  |  |                       |  |         4c 8d 58 0f          	lea    0xf(%rax),%r11
+    2759:	|  |  |                       |  |         4c 89 54 24 e8       	mov    %r10,-0x18(%rsp)
+    275e:	|  |  |                       |  |         49 89 f9             	mov    %rdi,%r9
+    std::memcpy(&v, s, sizeof(v));
+    2761:	|  |  |                       |  |         4c 09 e6             	or     %r12,%rsi
+        rotated[i] = p[(head + i) % 16];
+    2764:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    2768:	|  |  |                       |  |         4c 8d 50 0e          	lea    0xe(%rax),%r10
+    276c:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    2770:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    2774:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    2778:	|  |  |                       |  |         4c 89 4c 24 f0       	mov    %r9,-0x10(%rsp)
+    277d:	|  |  |                       |  |         4c 8d 48 0d          	lea    0xd(%rax),%r9
+    std::memcpy(&v, s, sizeof(v));
+    2781:	|  |  |                       |  |         48 09 ee             	or     %rbp,%rsi
+    2784:	|  |  |                       |  |         0f b6 2c 19          	movzbl (%rcx,%rbx,1),%ebp
+    2788:	|  |  |                       |  |         46 0f b6 14 11       	movzbl (%rcx,%r10,1),%r10d
+        rotated[i] = p[(head + i) % 16];
+    278d:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    2791:	|  |  |                       |  |         48 89 f3             	mov    %rsi,%rbx
+    2794:	|  |  |                       |  |         42 0f b6 34 19       	movzbl (%rcx,%r11,1),%esi
+    2799:	|  |  |                       |  |         46 0f b6 0c 09       	movzbl (%rcx,%r9,1),%r9d
+        rotated[i] = p[(head + i) % 16];
+    279e:	|  |  |                       |  |         48 8d 78 0c          	lea    0xc(%rax),%rdi
+    27a2:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    std::memcpy(&v, s, sizeof(v));
+    27a5:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    27a9:	|  |  |                       |  |         4c 8b 5c 24 e0       	mov    -0x20(%rsp),%r11
+    27ae:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    27b2:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    27b5:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    27b9:	|  |  |                       |  |         0f b6 2c 01          	movzbl (%rcx,%rax,1),%ebp
+    27bd:	|  |  |                       |  |         4c 09 d6             	or     %r10,%rsi
+    27c0:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    27c4:	|  |  |                       |  |         4c 8b 54 24 e8       	mov    -0x18(%rsp),%r10
+    27c9:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    27cd:	|  |  |                       |  |         4c 09 ce             	or     %r9,%rsi
+    27d0:	|  |  |                       |  |         4c 8b 4c 24 f0       	mov    -0x10(%rsp),%r9
+    27d5:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    27d9:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    27dc:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    27df:	|  |  |                       |  |         42 0f b6 3c 09       	movzbl (%rcx,%r9,1),%edi
+    27e4:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    27e8:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    27eb:	|  |  |                       |  |         42 0f b6 3c 11       	movzbl (%rcx,%r10,1),%edi
+    27f0:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    27f4:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    27f7:	|  |  |                       |  |         42 0f b6 3c 19       	movzbl (%rcx,%r11,1),%edi
+    27fc:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2800:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    2803:	|  |  |                       |  |         48 8b 7c 24 c8       	mov    -0x38(%rsp),%rdi
+    2808:	|  |  |                       |  |         48 89 5c 24 c8       	mov    %rbx,-0x38(%rsp)
+    280d:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2811:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    2815:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    2818:	|  |  |                       |  |         48 8d 78 40          	lea    0x40(%rax),%rdi
+    281c:	|  |  |                       |  |         4c 01 c0             	add    %r8,%rax
+    std::memcpy(&v, s, sizeof(v));
+    281f:	|  |  |                       |  |         48 89 74 24 d0       	mov    %rsi,-0x30(%rsp)
+    2824:	|  |  |                       |  |         66 0f 6f 44 24 c8    	movdqa -0x38(%rsp),%xmm0
+    for (; i + 64 <= n; i += 64) {
+    282a:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2830:	|  |  |                       |  |     /-> 48 89 fe             	mov    %rdi,%rsi
+    for (; i + 64 <= n; i += 64) {
+    2833:	|  |  |                       |  |     |   48 83 c7 40          	add    $0x40,%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2837:	|  |  |                       |  |     |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    283b:	|  |  |                       |  |     |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    2840:	|  |  |                       |  |     |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    2845:	|  |  |                       |  |     |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    284a:	|  |  |                       |  |     |   48 83 c0 40          	add    $0x40,%rax
+    284e:	|  |  |                       |  |     |   48 39 fa             	cmp    %rdi,%rdx
+    2851:	|  |  |                       |  |     \-- 73 dd                	jae    2830 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2a0>
+        stream16(d + i, v);
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+    2853:	|  |  |                       |  |         48 8d 46 10          	lea    0x10(%rsi),%rax
+    2857:	|  |  |                       |  |         48 39 c2             	cmp    %rax,%rdx
+    285a:	|  |  |                       |  |  /----- 72 15                	jb     2871 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2e1>
+    285c:	|  |  |                       |  |  |      49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    2860:	|  |  |                       |  |  |  /-> 48 89 c6             	mov    %rax,%rsi
+    2863:	|  |  |                       |  |  |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    2868:	|  |  |                       |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    286c:	|  |  |                       |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    286f:	|  |  |                       |  |  |  \-- 73 ef                	jae    2860 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2d0>
+        stream16(d + i, v);
+    }
+    __builtin_ia32_sfence();
+    2871:	|  |  |                       |  |  \----> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    2874:	|  |  |                       |  |         48 39 d6             	cmp    %rdx,%rsi
+    2877:	|  |  |                       |  |  /----- 73 1e                	jae    2897 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x307>
+    2879:	|  |  |                       |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        d[i] = p[i % 16];
+    2880:	|  |  |                       |  |  |  /-> 48 89 f0             	mov    %rsi,%rax
+    2883:	|  |  |                       |  |  |  |   83 e0 0f             	and    $0xf,%eax
+    2886:	|  |  |                       |  |  |  |   0f b6 04 01          	movzbl (%rcx,%rax,1),%eax
+    288a:	|  |  |                       |  |  |  |   41 88 04 30          	mov    %al,(%r8,%rsi,1)
+    for (; i < n; ++i) {
+    288e:	|  |  |                       |  |  |  |   48 83 c6 01          	add    $0x1,%rsi
+    2892:	|  |  |                       |  |  |  |   48 39 f2             	cmp    %rsi,%rdx
+    2895:	|  |  |                       |  |  |  \-- 75 e9                	jne    2880 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2f0>
+    }
+}
+    2897:	|  |  |                       |  |  \----> 5b                   	pop    %rbx
+    2898:	|  |  |                       |  |         5d                   	pop    %rbp
+    2899:	|  |  |                       |  |         41 5c                	pop    %r12
+    289b:	|  |  |                       |  |         41 5d                	pop    %r13
+    289d:	|  |  |                       |  |         41 5e                	pop    %r14
+    289f:	|  |  |                       |  |         41 5f                	pop    %r15
+    28a1:	|  |  |                       |  |         c3                   	ret
+    28a2:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    28a8:	|  |  |                       |  \-------> 48 83 ff 06          	cmp    $0x6,%rdi
+    28ac:	|  |  |  /--------------------|----------- 0f 86 e1 01 00 00    	jbe    2a93 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x503>
+        d[i] = p[i];
+    28b2:	|  |  |  |                    |            48 8b 31             	mov    (%rcx),%rsi
+    28b5:	|  |  |  |                    |            49 89 30             	mov    %rsi,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    28b8:	|  |  |  |                    |            48 83 f8 08          	cmp    $0x8,%rax
+    28bc:	+--|--|--|--------------------|----------- 0f 84 fe fd ff ff    	je     26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    28c2:	|  |  |  |                    |            48 8d 70 f7          	lea    -0x9(%rax),%rsi
+    28c6:	|  |  |  |                    |            4c 8d 48 f8          	lea    -0x8(%rax),%r9
+    28ca:	|  |  |  |                    |            48 83 fe 02          	cmp    $0x2,%rsi
+    28ce:	|  |  |  |                    |            be 08 00 00 00       	mov    $0x8,%esi
+    28d3:	|  |  |  |                    |        /-- 76 15                	jbe    28ea <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x35a>
+        d[i] = p[i];
+    28d5:	|  |  |  |  /-----------------|--------|-> 8b 3c 31             	mov    (%rcx,%rsi,1),%edi
+    28d8:	|  |  |  |  |                 |        |   41 89 3c 30          	mov    %edi,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    28dc:	|  |  |  |  |                 |        |   48 83 c6 04          	add    $0x4,%rsi
+    28e0:	|  |  |  |  |                 |        |   49 83 f9 04          	cmp    $0x4,%r9
+    28e4:	+--|--|--|--|-----------------|--------|-- 0f 84 d6 fd ff ff    	je     26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    28ea:	|  |  |  |  |                 |        \-> 0f b6 3c 31          	movzbl (%rcx,%rsi,1),%edi
+    28ee:	|  |  |  |  |                 |            41 88 3c 30          	mov    %dil,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    28f2:	|  |  |  |  |                 |            48 8d 7e 01          	lea    0x1(%rsi),%rdi
+    28f6:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    28f9:	+--|--|--|--|-----------------|----------- 0f 83 c1 fd ff ff    	jae    26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    28ff:	|  |  |  |  |                 |            0f b6 7c 31 01       	movzbl 0x1(%rcx,%rsi,1),%edi
+    2904:	|  |  |  |  |                 |            41 88 7c 30 01       	mov    %dil,0x1(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    2909:	|  |  |  |  |                 |            48 8d 7e 02          	lea    0x2(%rsi),%rdi
+    290d:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    2910:	+--|--|--|--|-----------------|----------- 0f 83 aa fd ff ff    	jae    26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2916:	|  |  |  |  |                 |            0f b6 7c 31 02       	movzbl 0x2(%rcx,%rsi,1),%edi
+    291b:	|  |  |  |  |                 |            41 88 7c 30 02       	mov    %dil,0x2(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    2920:	+--|--|--|--|-----------------|----------- e9 9b fd ff ff       	jmp    26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    2925:	|  |  |  |  |                 |            0f 1f 00             	nopl   (%rax)
+    Length done = (n < 16) ? n : 16;
+    2928:	|  |  |  |  |                 \----------> 41 ba 10 00 00 00    	mov    $0x10,%r10d
+    292e:	|  |  |  |  |                              4c 39 d2             	cmp    %r10,%rdx
+    2931:	|  |  |  |  |                              4c 0f 46 d2          	cmovbe %rdx,%r10
+    std::memcpy(d, s, n);
+    2935:	|  |  |  |  |                              44 89 d0             	mov    %r10d,%eax
+    2938:	|  |  |  |  |                              41 83 fa 08          	cmp    $0x8,%r10d
+    293c:	|  |  |  |  |        /-------------------- 0f 82 cc 00 00 00    	jb     2a0e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47e>
+    2942:	|  |  |  |  |        |                     48 8b 06             	mov    (%rsi),%rax
+    2945:	|  |  |  |  |        |                     4c 8d 4f 08          	lea    0x8(%rdi),%r9
+    2949:	|  |  |  |  |        |                     49 83 e1 f8          	and    $0xfffffffffffffff8,%r9
+    294d:	|  |  |  |  |        |                     48 89 07             	mov    %rax,(%rdi)
+    2950:	|  |  |  |  |        |                     44 89 d0             	mov    %r10d,%eax
+    2953:	|  |  |  |  |        |                     48 8b 74 06 f8       	mov    -0x8(%rsi,%rax,1),%rsi
+    2958:	|  |  |  |  |        |                     48 89 74 07 f8       	mov    %rsi,-0x8(%rdi,%rax,1)
+    295d:	|  |  |  |  |        |                     48 89 f8             	mov    %rdi,%rax
+    2960:	|  |  |  |  |        |                     4c 29 c8             	sub    %r9,%rax
+    2963:	|  |  |  |  |        |                     48 29 c1             	sub    %rax,%rcx
+    2966:	|  |  |  |  |        |                     44 01 d0             	add    %r10d,%eax
+    2969:	|  |  |  |  |        |                     83 e0 f8             	and    $0xfffffff8,%eax
+    296c:	|  |  |  |  |        |                     83 f8 08             	cmp    $0x8,%eax
+    296f:	|  |  |  |  |  /-----|-------------------- 72 16                	jb     2987 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    2971:	|  |  |  |  |  |     |                     83 e0 f8             	and    $0xfffffff8,%eax
+    2974:	|  |  |  |  |  |     |                     31 f6                	xor    %esi,%esi
+    2976:	|  |  |  |  |  |     |                 /-> 89 f7                	mov    %esi,%edi
+    2978:	|  |  |  |  |  |     |                 |   83 c6 08             	add    $0x8,%esi
+    297b:	|  |  |  |  |  |     |                 |   4c 8b 1c 39          	mov    (%rcx,%rdi,1),%r11
+    297f:	|  |  |  |  |  |     |                 |   4d 89 1c 39          	mov    %r11,(%r9,%rdi,1)
+    2983:	|  |  |  |  |  |     |                 |   39 c6                	cmp    %eax,%esi
+    2985:	|  |  |  |  |  |     |                 \-- 72 ef                	jb     2976 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3e6>
+    while (done < n) {
+    2987:	|  |  |  |  |  >-----|-------------------> 49 39 d2             	cmp    %rdx,%r10
+    298a:	|  |  |  |  |  |     |           /-------- 72 33                	jb     29bf <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    298c:	|  |  |  |  |  |     |     /-----|-------- e9 af 00 00 00       	jmp    2a40 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b0>
+    2991:	|  |  |  |  |  |     |     |     |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    std::memcpy(d, s, n);
+    2998:	|  |  |  |  |  |     |     |     |     /-> 41 f6 c1 04          	test   $0x4,%r9b
+    299c:	|  |  |  |  |  |     |     |  /--|-----|-- 0f 85 9f 00 00 00    	jne    2a41 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b1>
+    29a2:	|  |  |  |  |  |     |     |  |  |     |   45 85 c9             	test   %r9d,%r9d
+    29a5:	|  |  |  |  |  |  /--|-----|--|--|-----|-- 74 10                	je     29b7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    29a7:	|  |  |  |  |  |  |  |     |  |  |     |   41 0f b6 08          	movzbl (%r8),%ecx
+    29ab:	|  |  |  |  |  |  |  |     |  |  |     |   88 08                	mov    %cl,(%rax)
+    29ad:	|  |  |  |  |  |  |  |     |  |  |     |   41 f6 c1 02          	test   $0x2,%r9b
+    29b1:	|  |  |  |  |  |  |  |  /--|--|--|-----|-- 0f 85 c9 00 00 00    	jne    2a80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4f0>
+        done += m;
+    29b7:	|  |  |  |  |  |  >--|--|--|--|--|-----|-> 4d 01 ca             	add    %r9,%r10
+    while (done < n) {
+    29ba:	|  |  |  |  |  |  |  |  |  |  |  |     |   49 39 d2             	cmp    %rdx,%r10
+    29bd:	|  |  |  |  |  |  |  |  |  |  |  |  /--|-- 73 4e                	jae    2a0d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47d>
+        Length const m = (done < n - done) ? done : n - done;
+    29bf:	|  |  |  |  |  |  |  |  |  |  |  >--|--|-> 49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    29c2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4b 8d 04 10          	lea    (%r8,%r10,1),%rax
+        Length const m = (done < n - done) ? done : n - done;
+    29c6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 29 d1             	sub    %r10,%r9
+    29c9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 39 d1             	cmp    %r10,%r9
+    29cc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 0f 47 ca          	cmova  %r10,%r9
+    std::memcpy(d, s, n);
+    29d0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   41 83 f9 08          	cmp    $0x8,%r9d
+    29d4:	|  |  |  |  |  |  |  |  |  |  |  |  |  \-- 72 c2                	jb     2998 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x408>
+    29d6:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 08             	mov    (%r8),%rcx
+    29d9:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 78 08          	lea    0x8(%rax),%rdi
+        done += m;
+    29dd:	|  |  |  |  |  |  |  |  |  |  |  |  |      4d 01 ca             	add    %r9,%r10
+    std::memcpy(d, s, n);
+    29e0:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 83 e7 f8          	and    $0xfffffffffffffff8,%rdi
+    29e4:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 08             	mov    %rcx,(%rax)
+    29e7:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 89 c9             	mov    %r9d,%ecx
+    29ea:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 74 08 f8       	mov    -0x8(%r8,%rcx,1),%rsi
+    29ef:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 74 08 f8       	mov    %rsi,-0x8(%rax,%rcx,1)
+    29f4:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 f8             	sub    %rdi,%rax
+    29f7:	|  |  |  |  |  |  |  |  |  |  |  |  |      4c 89 c6             	mov    %r8,%rsi
+    29fa:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 c6             	sub    %rax,%rsi
+    29fd:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 01 c8             	add    %r9d,%eax
+    2a00:	|  |  |  |  |  |  |  |  |  |  |  |  |      c1 e8 03             	shr    $0x3,%eax
+    2a03:	|  |  |  |  |  |  |  |  |  |  |  |  |      89 c1                	mov    %eax,%ecx
+    2a05:	|  |  |  |  |  |  |  |  |  |  |  |  |      f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    2a08:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 39 d2             	cmp    %rdx,%r10
+    2a0b:	|  |  |  |  |  |  |  |  |  |  |  \--|----- 72 b2                	jb     29bf <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    2a0d:	|  |  |  |  |  |  |  |  |  |  |     \----> c3                   	ret
+    std::memcpy(d, s, n);
+    2a0e:	|  |  |  |  |  |  |  \--|--|--|----------> 41 f6 c2 04          	test   $0x4,%r10b
+    2a12:	|  |  |  |  |  |  |     |  |  |        /-- 0f 85 85 00 00 00    	jne    2a9d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x50d>
+    2a18:	|  |  |  |  |  |  |     |  |  |        |   85 c0                	test   %eax,%eax
+    2a1a:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 67 ff ff ff    	je     2987 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    2a20:	|  |  |  |  |  |  |     |  |  |        |   0f b6 36             	movzbl (%rsi),%esi
+    2a23:	|  |  |  |  |  |  |     |  |  |        |   40 88 37             	mov    %sil,(%rdi)
+    2a26:	|  |  |  |  |  |  |     |  |  |        |   a8 02                	test   $0x2,%al
+    2a28:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 59 ff ff ff    	je     2987 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    2a2e:	|  |  |  |  |  |  |     |  |  |        |   0f b7 4c 01 fe       	movzwl -0x2(%rcx,%rax,1),%ecx
+    2a33:	|  |  |  |  |  |  |     |  |  |        |   66 89 4c 07 fe       	mov    %cx,-0x2(%rdi,%rax,1)
+    2a38:	|  |  |  |  |  +--|-----|--|--|--------|-- e9 4a ff ff ff       	jmp    2987 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    2a3d:	|  |  |  |  |  |  |     |  |  |        |   0f 1f 00             	nopl   (%rax)
+    2a40:	|  |  |  |  |  |  |     |  \--|--------|-> c3                   	ret
+    2a41:	|  |  |  |  |  |  |     |     \--------|-> 41 8b 08             	mov    (%r8),%ecx
+    2a44:	|  |  |  |  |  |  |     |              |   89 08                	mov    %ecx,(%rax)
+    2a46:	|  |  |  |  |  |  |     |              |   44 89 c9             	mov    %r9d,%ecx
+    2a49:	|  |  |  |  |  |  |     |              |   41 8b 74 08 fc       	mov    -0x4(%r8,%rcx,1),%esi
+    2a4e:	|  |  |  |  |  |  |     |              |   89 74 08 fc          	mov    %esi,-0x4(%rax,%rcx,1)
+    2a52:	|  |  |  |  |  |  +-----|--------------|-- e9 60 ff ff ff       	jmp    29b7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+        d[i] = p[i];
+    2a57:	|  \--|--|--|--|--|-----|--------------|-> 0f b6 39             	movzbl (%rcx),%edi
+    2a5a:	|     |  |  |  |  |     |              |   41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2a5d:	|     |  |  |  |  |     |              |   40 f6 c6 0e          	test   $0xe,%sil
+    2a61:	+-----|--|--|--|--|-----|--------------|-- 0f 84 59 fc ff ff    	je     26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2a67:	|     |  |  |  |  |     |              |   0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    2a6b:	|     |  |  |  |  |     |              |   41 88 78 01          	mov    %dil,0x1(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2a6f:	|     |  |  |  |  |     |              |   48 83 f8 03          	cmp    $0x3,%rax
+    2a73:	\-----|--|--|--|--|-----|--------------|-- 0f 85 47 fc ff ff    	jne    26c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    2a79:	      \--|--|--|--|-----|--------------|-- e9 7b fb ff ff       	jmp    25f9 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x69>
+    2a7e:	         |  |  |  |     |              |   66 90                	xchg   %ax,%ax
+    std::memcpy(d, s, n);
+    2a80:	         |  |  |  |     \--------------|-> 44 89 c9             	mov    %r9d,%ecx
+    2a83:	         |  |  |  |                    |   41 0f b7 74 08 fe    	movzwl -0x2(%r8,%rcx,1),%esi
+    2a89:	         |  |  |  |                    |   66 89 74 08 fe       	mov    %si,-0x2(%rax,%rcx,1)
+    2a8e:	         |  |  |  \--------------------|-- e9 24 ff ff ff       	jmp    29b7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    for (Index i = 0; i < head; ++i) {
+    2a93:	         \--|--|-----------------------|-> 49 89 c1             	mov    %rax,%r9
+    2a96:	            |  |                       |   31 f6                	xor    %esi,%esi
+    2a98:	            \--|-----------------------|-- e9 38 fe ff ff       	jmp    28d5 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x345>
+    std::memcpy(d, s, n);
+    2a9d:	               |                       \-> 8b 36                	mov    (%rsi),%esi
+    2a9f:	               |                           89 37                	mov    %esi,(%rdi)
+    2aa1:	               |                           8b 4c 01 fc          	mov    -0x4(%rcx,%rax,1),%ecx
+    2aa5:	               |                           89 4c 07 fc          	mov    %ecx,-0x4(%rdi,%rax,1)
+    2aa9:	               \-------------------------- e9 d9 fe ff ff       	jmp    2987 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    2aae:	                                           66 90                	xchg   %ax,%ax
+
+0000000000002ab0 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    2ab0:	    48 85 ff             	test   %rdi,%rdi
+    2ab3:	/-- 74 0b                	je     2ac0 <nel::free_aligned(void*)+0x10>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    2ab5:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    2ab9:	|   e9 72 e5 ff ff       	jmp    1030 <free@plt>
+    2abe:	|   66 90                	xchg   %ax,%ax
+}
+    2ac0:	\-> c3                   	ret
+    2ac1:	    66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2ac8:	    00 00 00 00 
+    2acc:	    0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002ad0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    2ad0:	                   41 56                	push   %r14
+    2ad2:	                   48 8d 05 50 06 00 00 	lea    0x650(%rip),%rax        # 3129 <_IO_stdin_used+0x129>
+    2ad9:	                   41 55                	push   %r13
+    2adb:	                   66 48 0f 6e c8       	movq   %rax,%xmm1
+    2ae0:	                   41 54                	push   %r12
+    2ae2:	                   55                   	push   %rbp
+    2ae3:	                   48 89 cd             	mov    %rcx,%rbp
+    2ae6:	                   48 8d 0d 2c 06 00 00 	lea    0x62c(%rip),%rcx        # 3119 <_IO_stdin_used+0x119>
+    2aed:	                   53                   	push   %rbx
+    2aee:	                   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    2af3:	                   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2af7:	                   48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    2afb:	                   c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    2b02:	                   00 
+            : fn_name_(fn_name)
+    2b03:	                   0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    2b07:	                   48 85 f6             	test   %rsi,%rsi
+    2b0a:	/----------------- 0f 84 a0 00 00 00    	je     2bb0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    2b10:	|                  48 8d 46 ff          	lea    -0x1(%rsi),%rax
+    2b14:	|                  48 89 f3             	mov    %rsi,%rbx
+    2b17:	|                  48 85 f0             	test   %rsi,%rax
+    2b1a:	+----------------- 0f 85 90 00 00 00    	jne    2bb0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2b20:	|                  48 8d 34 2e          	lea    (%rsi,%rbp,1),%rsi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    2b24:	|                  48 85 ff             	test   %rdi,%rdi
+    2b27:	|     /----------- 74 67                	je     2b90 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xc0>
+    2b29:	|     |            4c 8b 6f f8          	mov    -0x8(%rdi),%r13
+    uint8_t *const new_base =
+    2b2d:	|     |            49 89 d4             	mov    %rdx,%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    2b30:	|     |            4c 29 ef             	sub    %r13,%rdi
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2b33:	|     |            e8 88 e5 ff ff       	call   10c0 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    2b38:	|     |            48 85 c0             	test   %rax,%rax
+    2b3b:	|  /--|----------- 0f 84 7e 00 00 00    	je     2bbf <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    2b41:	|  |  |            48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    2b46:	|  |  |            48 f7 db             	neg    %rbx
+    2b49:	|  |  |            48 21 cb             	and    %rcx,%rbx
+    2b4c:	|  |  |            49 89 de             	mov    %rbx,%r14
+    2b4f:	|  |  |            49 29 c6             	sub    %rax,%r14
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    2b52:	|  |  |            4d 39 f5             	cmp    %r14,%r13
+    2b55:	|  |  |        /-- 75 19                	jne    2b70 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xa0>
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    }
+    offset_field(new_p) = new_offset;
+    2b57:	|  |  |     /--|-> 4c 89 73 f8          	mov    %r14,-0x8(%rbx)
+    return new_p;
+}
+    2b5b:	|  |  |  /--|--|-> 48 83 c4 20          	add    $0x20,%rsp
+    2b5f:	|  |  |  |  |  |   48 89 d8             	mov    %rbx,%rax
+    2b62:	|  |  |  |  |  |   5b                   	pop    %rbx
+    2b63:	|  |  |  |  |  |   5d                   	pop    %rbp
+    2b64:	|  |  |  |  |  |   41 5c                	pop    %r12
+    2b66:	|  |  |  |  |  |   41 5d                	pop    %r13
+    2b68:	|  |  |  |  |  |   41 5e                	pop    %r14
+    2b6a:	|  |  |  |  |  |   c3                   	ret
+    2b6b:	|  |  |  |  |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        std::memmove(new_p, new_base + old_offset, n);
+    2b70:	|  |  |  |  |  \-> 4c 39 e5             	cmp    %r12,%rbp
+    2b73:	|  |  |  |  |      4c 89 e2             	mov    %r12,%rdx
+    2b76:	|  |  |  |  |      4a 8d 34 28          	lea    (%rax,%r13,1),%rsi
+    2b7a:	|  |  |  |  |      48 89 df             	mov    %rbx,%rdi
+    2b7d:	|  |  |  |  |      48 0f 46 d5          	cmovbe %rbp,%rdx
+    2b81:	|  |  |  |  |      e8 4a e5 ff ff       	call   10d0 <memmove@plt>
+    2b86:	|  |  |  |  +----- eb cf                	jmp    2b57 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+    2b88:	|  |  |  |  |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    2b8f:	|  |  |  |  |      00 
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2b90:	|  |  \--|--|----> 48 89 f7             	mov    %rsi,%rdi
+    2b93:	|  |     |  |      e8 18 e5 ff ff       	call   10b0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    2b98:	|  |     |  |      48 85 c0             	test   %rax,%rax
+    2b9b:	|  +-----|--|----- 74 22                	je     2bbf <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    2b9d:	|  |     |  |      48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    2ba2:	|  |     |  |      48 f7 db             	neg    %rbx
+    2ba5:	|  |     |  |      48 21 d3             	and    %rdx,%rbx
+    2ba8:	|  |     |  |      49 89 de             	mov    %rbx,%r14
+    2bab:	|  |     |  |      49 29 c6             	sub    %rax,%r14
+    if (old_p != nullptr && new_offset != old_offset) {
+    2bae:	|  |     |  \----- eb a7                	jmp    2b57 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    2bb0:	\--|-----|-------> 48 89 e6             	mov    %rsp,%rsi
+    2bb3:	   |     |         48 8d 3d 81 05 00 00 	lea    0x581(%rip),%rdi        # 313b <_IO_stdin_used+0x13b>
+    2bba:	   |     |         e8 93 e5 ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    if (new_base == nullptr) { return nullptr; }
+    2bbf:	   \-----|-------> 31 db                	xor    %ebx,%ebx
+    2bc1:	         \-------- eb 98                	jmp    2b5b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x8b>
+    2bc3:	                   66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2bca:	                   00 00 00 00 
+    2bce:	                   66 90                	xchg   %ax,%ax
+
+0000000000002bd0 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    2bd0:	       53                   	push   %rbx
+            : fn_name_(fn_name)
+    2bd1:	       48 8d 05 51 05 00 00 	lea    0x551(%rip),%rax        # 3129 <_IO_stdin_used+0x129>
+    2bd8:	       48 8d 0d 3a 05 00 00 	lea    0x53a(%rip),%rcx        # 3119 <_IO_stdin_used+0x119>
+    2bdf:	       66 48 0f 6e c1       	movq   %rcx,%xmm0
+    2be4:	       66 48 0f 6e c8       	movq   %rax,%xmm1
+    2be9:	       66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2bed:	       48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    2bf1:	       c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    2bf8:	       00 
+            : fn_name_(fn_name)
+    2bf9:	       0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    2bfd:	       48 85 ff             	test   %rdi,%rdi
+    2c00:	/----- 74 35                	je     2c37 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+    2c02:	|      48 8d 47 ff          	lea    -0x1(%rdi),%rax
+    2c06:	|      48 89 fb             	mov    %rdi,%rbx
+    2c09:	|      48 85 f8             	test   %rdi,%rax
+    2c0c:	+----- 75 29                	jne    2c37 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2c0e:	|      48 8d 3c 37          	lea    (%rdi,%rsi,1),%rdi
+    2c12:	|      e8 99 e4 ff ff       	call   10b0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    2c17:	|      48 85 c0             	test   %rax,%rax
+    2c1a:	|  /-- 74 15                	je     2c31 <nel::malloc_aligned(unsigned long, unsigned long)+0x61>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    2c1c:	|  |   48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    2c21:	|  |   48 f7 db             	neg    %rbx
+    2c24:	|  |   48 21 da             	and    %rbx,%rdx
+    2c27:	|  |   48 29 c2             	sub    %rax,%rdx
+    uint8_t *const new_p = new_base + new_offset;
+    2c2a:	|  |   48 01 d0             	add    %rdx,%rax
+    offset_field(new_p) = new_offset;
+    2c2d:	|  |   48 89 50 f8          	mov    %rdx,-0x8(%rax)
+    return realloc_aligned(nullptr, align, 0, size);
+}
+    2c31:	|  \-> 48 83 c4 20          	add    $0x20,%rsp
+    2c35:	|      5b                   	pop    %rbx
+    2c36:	|      c3                   	ret
+    if (!pred) { assert_fail(msg, ctx); }
+    2c37:	\----> 48 89 e6             	mov    %rsp,%rsi
+    2c3a:	       48 8d 3d fa 04 00 00 	lea    0x4fa(%rip),%rdi        # 313b <_IO_stdin_used+0x13b>
+    2c41:	       e8 0c e5 ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    2c46:	       66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    2c4d:	       00 00 00 
+
+0000000000002c50 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    2c50:	53                   	push   %rbx
+    2c51:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    2c54:	40 0f be fe          	movsbl %sil,%edi
+    2c58:	48 8b 35 21 24 00 00 	mov    0x2421(%rip),%rsi        # 5080 <stderr@GLIBC_2.2.5>
+    2c5f:	e8 0c e4 ff ff       	call   1070 <fputc@plt>
+    return outs;
+}
+    2c64:	48 89 d8             	mov    %rbx,%rax
+    2c67:	5b                   	pop    %rbx
+    2c68:	c3                   	ret
+    2c69:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000002c70 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    2c70:	53                   	push   %rbx
+    2c71:	48 89 fb             	mov    %rdi,%rbx
+    2c74:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    2c77:	48 8b 35 02 24 00 00 	mov    0x2402(%rip),%rsi        # 5080 <stderr@GLIBC_2.2.5>
+    2c7e:	e8 cd e3 ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    2c83:	48 89 d8             	mov    %rbx,%rax
+    2c86:	5b                   	pop    %rbx
+    2c87:	c3                   	ret
+    2c88:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    2c8f:	00 
+
+0000000000002c90 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    2c90:	53                   	push   %rbx
+    2c91:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    2c94:	48 8b 3d e5 23 00 00 	mov    0x23e5(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    2c9b:	40 0f b6 d6          	movzbl %sil,%edx
+    2c9f:	31 c0                	xor    %eax,%eax
+    2ca1:	48 8d 35 ae 04 00 00 	lea    0x4ae(%rip),%rsi        # 3156 <_IO_stdin_used+0x156>
+    2ca8:	e8 e3 e3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2cad:	48 89 d8             	mov    %rbx,%rax
+    2cb0:	5b                   	pop    %rbx
+    2cb1:	c3                   	ret
+    2cb2:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2cb9:	00 00 00 00 
+    2cbd:	0f 1f 00             	nopl   (%rax)
+
+0000000000002cc0 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    2cc0:	53                   	push   %rbx
+    2cc1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    2cc4:	48 8b 3d b5 23 00 00 	mov    0x23b5(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    2ccb:	0f b7 d6             	movzwl %si,%edx
+    2cce:	31 c0                	xor    %eax,%eax
+    2cd0:	48 8d 35 7f 04 00 00 	lea    0x47f(%rip),%rsi        # 3156 <_IO_stdin_used+0x156>
+    2cd7:	e8 b4 e3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2cdc:	48 89 d8             	mov    %rbx,%rax
+    2cdf:	5b                   	pop    %rbx
+    2ce0:	c3                   	ret
+    2ce1:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2ce8:	00 00 00 00 
+    2cec:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002cf0 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    2cf0:	53                   	push   %rbx
+    2cf1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    2cf4:	48 8b 3d 85 23 00 00 	mov    0x2385(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    2cfb:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    2cfd:	31 c0                	xor    %eax,%eax
+    2cff:	48 8d 35 50 04 00 00 	lea    0x450(%rip),%rsi        # 3156 <_IO_stdin_used+0x156>
+    2d06:	e8 85 e3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2d0b:	48 89 d8             	mov    %rbx,%rax
+    2d0e:	5b                   	pop    %rbx
+    2d0f:	c3                   	ret
+
+0000000000002d10 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    2d10:	53                   	push   %rbx
+    2d11:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    2d14:	48 8b 3d 65 23 00 00 	mov    0x2365(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    2d1b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    2d1d:	31 c0                	xor    %eax,%eax
+    2d1f:	48 8d 35 30 04 00 00 	lea    0x430(%rip),%rsi        # 3156 <_IO_stdin_used+0x156>
+    2d26:	e8 65 e3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2d2b:	48 89 d8             	mov    %rbx,%rax
+    2d2e:	5b                   	pop    %rbx
+    2d2f:	c3                   	ret
+
+0000000000002d30 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    2d30:	53                   	push   %rbx
+    2d31:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    2d34:	48 8b 3d 45 23 00 00 	mov    0x2345(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    2d3b:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    2d3e:	31 c0                	xor    %eax,%eax
+    2d40:	48 8d 35 12 04 00 00 	lea    0x412(%rip),%rsi        # 3159 <_IO_stdin_used+0x159>
+    2d47:	e8 44 e3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    2d4c:	48 89 d8             	mov    %rbx,%rax
+    2d4f:	5b                   	pop    %rbx
+    2d50:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000002d54 <_fini>:
+    2d54:	48 83 ec 08          	sub    $0x8,%rsp
+    2d58:	48 83 c4 08          	add    $0x8,%rsp
+    2d5c:	c3                   	ret
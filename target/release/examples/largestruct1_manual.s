@@ -0,0 +1,1491 @@
+
+target/release/examples/largestruct1_manual:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memset@plt>:
+    1060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 4018 <memset@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 2f 00 00    	jmp    *0x2faa(%rip)        # 4020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 2f 00 00    	jmp    *0x2fa2(%rip)        # 4028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 2f 00 00    	jmp    *0x2f9a(%rip)        # 4030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcpy@plt>:
+    10a0:	ff 25 92 2f 00 00    	jmp    *0x2f92(%rip)        # 4038 <memcpy@GLIBC_2.14>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <malloc@plt>:
+    10b0:	ff 25 8a 2f 00 00    	jmp    *0x2f8a(%rip)        # 4040 <malloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <realloc@plt>:
+    10c0:	ff 25 82 2f 00 00    	jmp    *0x2f82(%rip)        # 4048 <realloc@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <memmove@plt>:
+    10d0:	ff 25 7a 2f 00 00    	jmp    *0x2f7a(%rip)        # 4050 <memmove@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010e0 <__cxa_atexit@plt>:
+    10e0:	ff 25 72 2f 00 00    	jmp    *0x2f72(%rip)        # 4058 <__cxa_atexit@GLIBC_2.2.5>
+    10e6:	68 0b 00 00 00       	push   $0xb
+    10eb:	e9 30 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010f0 <__cxa_finalize@plt>:
+    10f0:	ff 25 ea 2e 00 00    	jmp    *0x2eea(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10f6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+0000000000001100 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    1100:	50                   	push   %rax
+    std::abort();
+    1101:	e8 3a ff ff ff       	call   1040 <abort@plt>
+
+0000000000001106 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    1106:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    1107:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    110a:	4c 8d 0d 4d 0f 00 00 	lea    0xf4d(%rip),%r9        # 205e <_IO_stdin_used+0x5e>
+    1111:	31 c0                	xor    %eax,%eax
+    1113:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    1117:	4c 8b 07             	mov    (%rdi),%r8
+    111a:	48 8d 35 43 0f 00 00 	lea    0xf43(%rip),%rsi        # 2064 <_IO_stdin_used+0x64>
+    1121:	48 8b 3d 58 2f 00 00 	mov    0x2f58(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+    1128:	e8 63 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    112d:	e8 0e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001132 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1132:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1136:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1139:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    113d:	31 c0                	xor    %eax,%eax
+    113f:	57                   	push   %rdi
+    1140:	48 8b 3d 39 2f 00 00 	mov    0x2f39(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+    1147:	4c 8d 0d 10 0f 00 00 	lea    0xf10(%rip),%r9        # 205e <_IO_stdin_used+0x5e>
+    114e:	4c 8b 06             	mov    (%rsi),%r8
+    1151:	48 8d 35 1d 0f 00 00 	lea    0xf1d(%rip),%rsi        # 2075 <_IO_stdin_used+0x75>
+    1158:	e8 33 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    115d:	e8 de fe ff ff       	call   1040 <abort@plt>
+
+0000000000001162 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1162:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1166:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1169:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    116d:	31 c0                	xor    %eax,%eax
+    116f:	57                   	push   %rdi
+    1170:	48 8b 3d 09 2f 00 00 	mov    0x2f09(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+    1177:	4c 8d 0d 0c 0f 00 00 	lea    0xf0c(%rip),%r9        # 208a <_IO_stdin_used+0x8a>
+    117e:	4c 8b 06             	mov    (%rsi),%r8
+    1181:	48 8d 35 ed 0e 00 00 	lea    0xeed(%rip),%rsi        # 2075 <_IO_stdin_used+0x75>
+    1188:	e8 03 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    118d:	e8 ae fe ff ff       	call   1040 <abort@plt>
+    1192:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1199:	00 00 00 
+    119c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000011a0 <main>:
+    // 3 store value to address.
+    fak_->foo();
+}
+
+int main()
+{
+    11a0:	53                   	push   %rbx
+    nel::log << "ex1:b" << '\n';
+    11a1:	48 8d 1d e2 2e 00 00 	lea    0x2ee2(%rip),%rbx        # 408a <nel::log>
+    11a8:	48 8d 35 5f 0e 00 00 	lea    0xe5f(%rip),%rsi        # 200e <_IO_stdin_used+0xe>
+    11af:	48 89 df             	mov    %rbx,%rdi
+    11b2:	e8 49 0b 00 00       	call   1d00 <nel::operator<<(nel::Log&, char const*)>
+    11b7:	be 0a 00 00 00       	mov    $0xa,%esi
+    11bc:	48 89 c7             	mov    %rax,%rdi
+    11bf:	e8 1c 0b 00 00       	call   1ce0 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    11c4:	e8 b7 01 00 00       	call   1380 <ex1()>
+    nel::log << "ex1:e" << '\n';
+    11c9:	48 89 df             	mov    %rbx,%rdi
+    11cc:	48 8d 35 41 0e 00 00 	lea    0xe41(%rip),%rsi        # 2014 <_IO_stdin_used+0x14>
+    11d3:	e8 28 0b 00 00       	call   1d00 <nel::operator<<(nel::Log&, char const*)>
+    11d8:	be 0a 00 00 00       	mov    $0xa,%esi
+    11dd:	48 89 c7             	mov    %rax,%rdi
+    11e0:	e8 fb 0a 00 00       	call   1ce0 <nel::operator<<(nel::Log&, char)>
+}
+    11e5:	31 c0                	xor    %eax,%eax
+    11e7:	5b                   	pop    %rbx
+    11e8:	c3                   	ret
+    11e9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011f0 <_GLOBAL__sub_I__close_r>:
+nel::Manual<Fake> fak_;
+    11f0:	48 8d 15 71 2e 00 00 	lea    0x2e71(%rip),%rdx        # 4068 <__dso_handle>
+    11f7:	48 8d 35 8b 2e 00 00 	lea    0x2e8b(%rip),%rsi        # 4089 <fak_>
+    11fe:	48 8d 3d 4b 02 00 00 	lea    0x24b(%rip),%rdi        # 1450 <nel::Manual<Fake>::~Manual()>
+    1205:	e9 d6 fe ff ff       	jmp    10e0 <__cxa_atexit@plt>
+    120a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000001210 <_start>:
+    1210:	31 ed                	xor    %ebp,%ebp
+    1212:	49 89 d1             	mov    %rdx,%r9
+    1215:	5e                   	pop    %rsi
+    1216:	48 89 e2             	mov    %rsp,%rdx
+    1219:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    121d:	50                   	push   %rax
+    121e:	54                   	push   %rsp
+    121f:	45 31 c0             	xor    %r8d,%r8d
+    1222:	31 c9                	xor    %ecx,%ecx
+    1224:	48 8d 3d 75 ff ff ff 	lea    -0x8b(%rip),%rdi        # 11a0 <main>
+    122b:	ff 15 8f 2d 00 00    	call   *0x2d8f(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    1231:	f4                   	hlt
+    1232:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1239:	00 00 00 
+    123c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001240 <deregister_tm_clones>:
+    1240:	    48 8d 3d 29 2e 00 00 	lea    0x2e29(%rip),%rdi        # 4070 <__TMC_END__>
+    1247:	    48 8d 05 22 2e 00 00 	lea    0x2e22(%rip),%rax        # 4070 <__TMC_END__>
+    124e:	    48 39 f8             	cmp    %rdi,%rax
+    1251:	/-- 74 15                	je     1268 <deregister_tm_clones+0x28>
+    1253:	|   48 8b 05 6e 2d 00 00 	mov    0x2d6e(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    125a:	|   48 85 c0             	test   %rax,%rax
+    125d:	+-- 74 09                	je     1268 <deregister_tm_clones+0x28>
+    125f:	|   ff e0                	jmp    *%rax
+    1261:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1268:	\-> c3                   	ret
+    1269:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001270 <register_tm_clones>:
+    1270:	    48 8d 3d f9 2d 00 00 	lea    0x2df9(%rip),%rdi        # 4070 <__TMC_END__>
+    1277:	    48 8d 35 f2 2d 00 00 	lea    0x2df2(%rip),%rsi        # 4070 <__TMC_END__>
+    127e:	    48 29 fe             	sub    %rdi,%rsi
+    1281:	    48 89 f0             	mov    %rsi,%rax
+    1284:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1288:	    48 c1 f8 03          	sar    $0x3,%rax
+    128c:	    48 01 c6             	add    %rax,%rsi
+    128f:	    48 d1 fe             	sar    %rsi
+    1292:	/-- 74 14                	je     12a8 <register_tm_clones+0x38>
+    1294:	|   48 8b 05 3d 2d 00 00 	mov    0x2d3d(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    129b:	|   48 85 c0             	test   %rax,%rax
+    129e:	+-- 74 08                	je     12a8 <register_tm_clones+0x38>
+    12a0:	|   ff e0                	jmp    *%rax
+    12a2:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    12a8:	\-> c3                   	ret
+    12a9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000012b0 <__do_global_dtors_aux>:
+    12b0:	       f3 0f 1e fa          	endbr64
+    12b4:	       80 3d cd 2d 00 00 00 	cmpb   $0x0,0x2dcd(%rip)        # 4088 <completed.0>
+    12bb:	/----- 75 2b                	jne    12e8 <__do_global_dtors_aux+0x38>
+    12bd:	|      55                   	push   %rbp
+    12be:	|      48 83 3d 1a 2d 00 00 	cmpq   $0x0,0x2d1a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    12c5:	|      00 
+    12c6:	|      48 89 e5             	mov    %rsp,%rbp
+    12c9:	|  /-- 74 0c                	je     12d7 <__do_global_dtors_aux+0x27>
+    12cb:	|  |   48 8b 3d 96 2d 00 00 	mov    0x2d96(%rip),%rdi        # 4068 <__dso_handle>
+    12d2:	|  |   e8 19 fe ff ff       	call   10f0 <__cxa_finalize@plt>
+    12d7:	|  \-> e8 64 ff ff ff       	call   1240 <deregister_tm_clones>
+    12dc:	|      c6 05 a5 2d 00 00 01 	movb   $0x1,0x2da5(%rip)        # 4088 <completed.0>
+    12e3:	|      5d                   	pop    %rbp
+    12e4:	|      c3                   	ret
+    12e5:	|      0f 1f 00             	nopl   (%rax)
+    12e8:	\----> c3                   	ret
+    12e9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000012f0 <frame_dummy>:
+    12f0:	f3 0f 1e fa          	endbr64
+    12f4:	e9 77 ff ff ff       	jmp    1270 <register_tm_clones>
+    12f9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001300 <_close_r>:
+// -*- mode: c++; indent-tabs-mode: nil; tab-width: 4 -*-
+//#only provide for arm target..
+extern "C" {
+int _close_r(struct _reent *, int){
+    return -1;
+}
+    1300:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1305:	c3                   	ret
+    1306:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    130d:	00 00 00 
+
+0000000000001310 <_fstat_r>:
+int _fstat_r(struct _reent *, int, struct stat *){
+    return -1;
+}
+    1310:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1315:	c3                   	ret
+    1316:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    131d:	00 00 00 
+
+0000000000001320 <_kill_r>:
+int _kill_r(struct _reent *, int, int) {
+    return -1;
+}
+    1320:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1325:	c3                   	ret
+    1326:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    132d:	00 00 00 
+
+0000000000001330 <_lseek_r>:
+int _lseek_r(struct _reent *, int, int, int) {
+    return -1;
+}
+    1330:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1335:	c3                   	ret
+    1336:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    133d:	00 00 00 
+
+0000000000001340 <_read_r>:
+int _read_r(struct _reent *, int) {
+    1340:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1345:	c3                   	ret
+    1346:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    134d:	00 00 00 
+
+0000000000001350 <_write_r>:
+    return -1;
+}
+int _write_r(struct _reent *, int, char *, int) {
+    return -1;
+}
+    1350:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1355:	c3                   	ret
+    1356:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    135d:	00 00 00 
+
+0000000000001360 <_getpid_r>:
+int _getpid_r(struct _reent *) {
+    return -1;
+}
+    1360:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1365:	c3                   	ret
+    1366:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    136d:	00 00 00 
+
+0000000000001370 <_isatty_r>:
+int _isatty_r(struct _reent *, int) {
+    1370:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1375:	c3                   	ret
+    1376:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    137d:	00 00 00 
+
+0000000000001380 <ex1()>:
+{
+    1380:	    41 54                	push   %r12
+            nel::elem::set(data_, f, N);
+        }
+
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+        {
+            outs << "U8Buf<" << val.len() << ">{";
+    1382:	    48 8d 35 7b 0c 00 00 	lea    0xc7b(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    1389:	    55                   	push   %rbp
+    138a:	    48 8d 2d f9 2c 00 00 	lea    0x2cf9(%rip),%rbp        # 408a <nel::log>
+    1391:	    53                   	push   %rbx
+    1392:	    48 89 ef             	mov    %rbp,%rdi
+    1395:	    48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+    139c:	    e8 5f 09 00 00       	call   1d00 <nel::operator<<(nel::Log&, char const*)>
+    13a1:	    be 00 01 00 00       	mov    $0x100,%esi
+    13a6:	    48 8d 5c 24 01       	lea    0x1(%rsp),%rbx
+    13ab:	    4c 8d a4 24 00 01 00 	lea    0x100(%rsp),%r12
+    13b2:	    00 
+    13b3:	    48 89 c7             	mov    %rax,%rdi
+    13b6:	    e8 05 0a 00 00       	call   1dc0 <nel::operator<<(nel::Log&, unsigned long)>
+    13bb:	    48 8d 35 49 0c 00 00 	lea    0xc49(%rip),%rsi        # 200b <_IO_stdin_used+0xb>
+    13c2:	    48 89 c7             	mov    %rax,%rdi
+    13c5:	    e8 36 09 00 00       	call   1d00 <nel::operator<<(nel::Log&, char const*)>
+            if (val.len() > 0) {
+                outs << val.data_[0];
+    13ca:	    0f b6 34 24          	movzbl (%rsp),%esi
+    13ce:	    48 89 ef             	mov    %rbp,%rdi
+    13d1:	    e8 4a 09 00 00       	call   1d20 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    13d6:	    66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    13dd:	    00 00 00 
+                    outs << ' ' << val.data_[i];
+    13e0:	/-> be 20 00 00 00       	mov    $0x20,%esi
+    13e5:	|   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    13e8:	|   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    13ec:	|   e8 ef 08 00 00       	call   1ce0 <nel::operator<<(nel::Log&, char)>
+    13f1:	|   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    13f5:	|   48 89 c7             	mov    %rax,%rdi
+    13f8:	|   e8 23 09 00 00       	call   1d20 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    13fd:	|   4c 39 e3             	cmp    %r12,%rbx
+    1400:	\-- 75 de                	jne    13e0 <ex1()+0x60>
+                }
+            }
+            outs << '}';
+    1402:	    48 89 ef             	mov    %rbp,%rdi
+    1405:	    be 7d 00 00 00       	mov    $0x7d,%esi
+    140a:	    e8 d1 08 00 00       	call   1ce0 <nel::operator<<(nel::Log&, char)>
+    nel::log << *m1 << '\n';
+    140f:	    48 89 ef             	mov    %rbp,%rdi
+    1412:	    be 0a 00 00 00       	mov    $0xa,%esi
+    1417:	    e8 c4 08 00 00       	call   1ce0 <nel::operator<<(nel::Log&, char)>
+            nel::elem::set(data_, 0xa5, N);
+    141c:	    48 89 e7             	mov    %rsp,%rdi
+    141f:	    ba 00 01 00 00       	mov    $0x100,%edx
+    1424:	    be a5 00 00 00       	mov    $0xa5,%esi
+    1429:	    e8 42 00 00 00       	call   1470 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    142e:	    48 81 c4 00 01 00 00 	add    $0x100,%rsp
+    1435:	    5b                   	pop    %rbx
+    1436:	    5d                   	pop    %rbp
+    1437:	    41 5c                	pop    %r12
+    1439:	    c3                   	ret
+    143a:	    66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000001440 <isr_ctimer>:
+            RegBlock::BLOCK0.reg1_ = 23;
+    1440:	c7 04 25 00 00 00 40 	movl   $0x17,0x40000000
+    1447:	17 00 00 00 
+}
+    144b:	c3                   	ret
+    144c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001450 <nel::Manual<Fake>::~Manual()>:
+    // 2 load reg with address (precomputed, no alignment adjusts etc)
+    1450:	c3                   	ret
+    1451:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1458:	00 00 00 
+    145b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000001460 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    1460:	e9 3b fc ff ff       	jmp    10a0 <memcpy@plt>
+    1465:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    146c:	00 00 00 00 
+
+0000000000001470 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    1470:	40 0f b6 f6          	movzbl %sil,%esi
+    1474:	e9 e7 fb ff ff       	jmp    1060 <memset@plt>
+    1479:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001480 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+}
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    1480:	e9 1b fc ff ff       	jmp    10a0 <memcpy@plt>
+    1485:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    148c:	00 00 00 00 
+
+0000000000001490 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    1490:	e9 3b fc ff ff       	jmp    10d0 <memmove@plt>
+    1495:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    149c:	00 00 00 00 
+
+00000000000014a0 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    14a0:	48 89 f2             	mov    %rsi,%rdx
+    std::memset(d, s, n);
+    14a3:	be a5 00 00 00       	mov    $0xa5,%esi
+    14a8:	e9 b3 fb ff ff       	jmp    1060 <memset@plt>
+    14ad:	0f 1f 00             	nopl   (%rax)
+
+00000000000014b0 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+    set(d, 0xa5, n);
+}
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    14b0:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    14b4:	e8 c7 fb ff ff       	call   1080 <memcmp@plt>
+    14b9:	85 c0                	test   %eax,%eax
+    14bb:	0f 94 c0             	sete   %al
+}
+    14be:	48 83 c4 08          	add    $0x8,%rsp
+    14c2:	c3                   	ret
+    14c3:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    14ca:	00 00 00 00 
+    14ce:	66 90                	xchg   %ax,%ax
+
+00000000000014d0 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    14d0:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    14d4:	e8 a7 fb ff ff       	call   1080 <memcmp@plt>
+    14d9:	85 c0                	test   %eax,%eax
+    14db:	0f 95 c0             	setne  %al
+}
+    14de:	48 83 c4 08          	add    $0x8,%rsp
+    14e2:	c3                   	ret
+    14e3:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    14ea:	00 00 00 00 
+    14ee:	66 90                	xchg   %ax,%ax
+
+00000000000014f0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    if (n < streaming_min) {
+    14f0:	                48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    14f7:	/-------------- 0f 86 d7 00 00 00    	jbe    15d4 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xe4>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    14fd:	|               48 89 f9             	mov    %rdi,%rcx
+{
+    1500:	|               53                   	push   %rbx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1501:	|               48 f7 d9             	neg    %rcx
+    1504:	|               83 e1 0f             	and    $0xf,%ecx
+    std::memcpy(d, s, n);
+    1507:	|               83 f9 08             	cmp    $0x8,%ecx
+    150a:	|     /-------- 0f 82 d0 00 00 00    	jb     15e0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xf0>
+    1510:	|     |         48 8b 06             	mov    (%rsi),%rax
+    1513:	|     |         4c 8d 57 08          	lea    0x8(%rdi),%r10
+    1517:	|     |         48 89 f3             	mov    %rsi,%rbx
+    151a:	|     |         49 83 e2 f8          	and    $0xfffffffffffffff8,%r10
+    151e:	|     |         48 89 07             	mov    %rax,(%rdi)
+    1521:	|     |         48 8b 44 0e f8       	mov    -0x8(%rsi,%rcx,1),%rax
+    1526:	|     |         48 89 44 0f f8       	mov    %rax,-0x8(%rdi,%rcx,1)
+    152b:	|     |         48 89 f8             	mov    %rdi,%rax
+    152e:	|     |         4c 29 d0             	sub    %r10,%rax
+    1531:	|     |         48 29 c3             	sub    %rax,%rbx
+    1534:	|     |         01 c8                	add    %ecx,%eax
+    1536:	|     |         83 e0 f8             	and    $0xfffffff8,%eax
+    1539:	|     |         83 f8 08             	cmp    $0x8,%eax
+    153c:	|  /--|-------- 72 1a                	jb     1558 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    153e:	|  |  |         83 e0 f8             	and    $0xfffffff8,%eax
+    1541:	|  |  |         45 31 c0             	xor    %r8d,%r8d
+    1544:	|  |  |     /-> 45 89 c1             	mov    %r8d,%r9d
+    1547:	|  |  |     |   41 83 c0 08          	add    $0x8,%r8d
+    154b:	|  |  |     |   4e 8b 1c 0b          	mov    (%rbx,%r9,1),%r11
+    154f:	|  |  |     |   4f 89 1c 0a          	mov    %r11,(%r10,%r9,1)
+    1553:	|  |  |     |   41 39 c0             	cmp    %eax,%r8d
+    1556:	|  |  |     \-- 72 ec                	jb     1544 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x54>
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1558:	|  >--|-------> 48 8d 41 40          	lea    0x40(%rcx),%rax
+    155c:	|  |  |         48 01 f9             	add    %rdi,%rcx
+    155f:	|  |  |         90                   	nop
+    std::memcpy(&v, s, sizeof(v));
+    1560:	|  |  |     /-> f3 0f 6f 54 06 d0    	movdqu -0x30(%rsi,%rax,1),%xmm2
+    1566:	|  |  |     |   f3 0f 6f 4c 06 e0    	movdqu -0x20(%rsi,%rax,1),%xmm1
+    156c:	|  |  |     |   49 89 c0             	mov    %rax,%r8
+    for (; i + 64 <= n; i += 64) {
+    156f:	|  |  |     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1573:	|  |  |     |   f3 0f 6f 44 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1579:	|  |  |     |   f3 0f 6f 5c 06 c0    	movdqu -0x40(%rsi,%rax,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    157f:	|  |  |     |   48 83 c0 40          	add    $0x40,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1583:	|  |  |     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    1588:	|  |  |     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    158d:	|  |  |     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    1592:	|  |  |     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    1597:	|  |  |     |   48 39 c2             	cmp    %rax,%rdx
+    159a:	|  |  |     \-- 73 c4                	jae    1560 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x70>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    159c:	|  |  |         49 8d 40 10          	lea    0x10(%r8),%rax
+    15a0:	|  |  |         48 39 c2             	cmp    %rax,%rdx
+    15a3:	|  |  |  /----- 72 22                	jb     15c7 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd7>
+    15a5:	|  |  |  |      48 8d 4f f0          	lea    -0x10(%rdi),%rcx
+    15a9:	|  |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    15b0:	|  |  |  |  /-> f3 0f 6f 64 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm4
+    15b6:	|  |  |  |  |   49 89 c0             	mov    %rax,%r8
+    15b9:	|  |  |  |  |   66 0f e7 24 01       	movntdq %xmm4,(%rcx,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    15be:	|  |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    15c2:	|  |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    15c5:	|  |  |  |  \-- 73 e9                	jae    15b0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc0>
+        stream16(d + i, load16(s + i));
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    15c7:	|  |  |  \----> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    15ca:	|  |  |         4c 01 c7             	add    %r8,%rdi
+    15cd:	|  |  |         4c 29 c2             	sub    %r8,%rdx
+    15d0:	|  |  |         4c 01 c6             	add    %r8,%rsi
+}
+    15d3:	|  |  |         5b                   	pop    %rbx
+    std::memcpy(d, s, n);
+    15d4:	\--|--|-------> e9 c7 fa ff ff       	jmp    10a0 <memcpy@plt>
+    15d9:	   |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    15e0:	   |  \-------> f6 c1 04             	test   $0x4,%cl
+    15e3:	   |        /-- 75 25                	jne    160a <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x11a>
+    15e5:	   |        |   85 c9                	test   %ecx,%ecx
+    15e7:	   +--------|-- 0f 84 6b ff ff ff    	je     1558 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    15ed:	   |        |   0f b6 06             	movzbl (%rsi),%eax
+    15f0:	   |        |   88 07                	mov    %al,(%rdi)
+    15f2:	   |        |   f6 c1 02             	test   $0x2,%cl
+    15f5:	   +--------|-- 0f 84 5d ff ff ff    	je     1558 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    15fb:	   |        |   0f b7 44 0e fe       	movzwl -0x2(%rsi,%rcx,1),%eax
+    1600:	   |        |   66 89 44 0f fe       	mov    %ax,-0x2(%rdi,%rcx,1)
+    1605:	   +--------|-- e9 4e ff ff ff       	jmp    1558 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    160a:	   |        \-> 8b 06                	mov    (%rsi),%eax
+    160c:	   |            89 07                	mov    %eax,(%rdi)
+    160e:	   |            8b 44 0e fc          	mov    -0x4(%rsi,%rcx,1),%eax
+    1612:	   |            89 44 0f fc          	mov    %eax,-0x4(%rdi,%rcx,1)
+    1616:	   \----------- e9 3d ff ff ff       	jmp    1558 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    161b:	                0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000001620 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    1620:	                                           49 89 f8             	mov    %rdi,%r8
+    1623:	                                           48 89 f1             	mov    %rsi,%rcx
+    if (n < streaming_min) {
+    1626:	                                           48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    162d:	                              /----------- 0f 86 85 03 00 00    	jbe    19b8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x398>
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1633:	                              |            48 89 fe             	mov    %rdi,%rsi
+{
+    1636:	                              |            41 57                	push   %r15
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1638:	                              |            48 f7 de             	neg    %rsi
+{
+    163b:	                              |            41 56                	push   %r14
+    for (Index i = 0; i < head; ++i) {
+    163d:	                              |            48 89 f0             	mov    %rsi,%rax
+{
+    1640:	                              |            41 55                	push   %r13
+    1642:	                              |            41 54                	push   %r12
+    1644:	                              |            55                   	push   %rbp
+    1645:	                              |            53                   	push   %rbx
+    for (Index i = 0; i < head; ++i) {
+    1646:	                              |            83 e0 0f             	and    $0xf,%eax
+    1649:	/-----------------------------|----------- 0f 84 01 01 00 00    	je     1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    164f:	|                             |            48 8d 78 ff          	lea    -0x1(%rax),%rdi
+    1653:	|                             |            48 83 ff 02          	cmp    $0x2,%rdi
+    1657:	|  /--------------------------|----------- 0f 86 8a 04 00 00    	jbe    1ae7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4c7>
+    165d:	|  |                          |            4c 8d 51 01          	lea    0x1(%rcx),%r10
+    1661:	|  |                          |            4d 89 c1             	mov    %r8,%r9
+    1664:	|  |                          |            4d 29 d1             	sub    %r10,%r9
+    1667:	|  |                          |            49 83 f9 06          	cmp    $0x6,%r9
+    166b:	|  |                          |  /-------- 0f 87 c7 02 00 00    	ja     1938 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x318>
+        d[i] = p[i];
+    1671:	|  |                          |  |         0f b6 39             	movzbl (%rcx),%edi
+    1674:	|  |                          |  |         41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1677:	|  |                          |  |         40 f6 c6 0e          	test   $0xe,%sil
+    167b:	+--|--------------------------|--|-------- 0f 84 cf 00 00 00    	je     1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1681:	|  |                          |  |         0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    1685:	|  |                          |  |         41 88 78 01          	mov    %dil,0x1(%r8)
+    1689:	|  |  /-----------------------|--|-------> 0f b6 79 02          	movzbl 0x2(%rcx),%edi
+    168d:	|  |  |                       |  |         41 88 78 02          	mov    %dil,0x2(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1691:	|  |  |                       |  |         40 f6 c6 0c          	test   $0xc,%sil
+    1695:	+--|--|-----------------------|--|-------- 0f 84 b5 00 00 00    	je     1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    169b:	|  |  |                       |  |         0f b6 79 03          	movzbl 0x3(%rcx),%edi
+    169f:	|  |  |                       |  |         41 88 78 03          	mov    %dil,0x3(%r8)
+    for (Index i = 0; i < head; ++i) {
+    16a3:	|  |  |                       |  |         48 83 f8 04          	cmp    $0x4,%rax
+    16a7:	+--|--|-----------------------|--|-------- 0f 86 a3 00 00 00    	jbe    1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    16ad:	|  |  |                       |  |         0f b6 79 04          	movzbl 0x4(%rcx),%edi
+    16b1:	|  |  |                       |  |         41 88 78 04          	mov    %dil,0x4(%r8)
+    for (Index i = 0; i < head; ++i) {
+    16b5:	|  |  |                       |  |         48 83 f8 05          	cmp    $0x5,%rax
+    16b9:	+--|--|-----------------------|--|-------- 0f 84 91 00 00 00    	je     1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    16bf:	|  |  |                       |  |         0f b6 79 05          	movzbl 0x5(%rcx),%edi
+    16c3:	|  |  |                       |  |         41 88 78 05          	mov    %dil,0x5(%r8)
+    for (Index i = 0; i < head; ++i) {
+    16c7:	|  |  |                       |  |         48 83 f8 06          	cmp    $0x6,%rax
+    16cb:	+--|--|-----------------------|--|-------- 0f 84 7f 00 00 00    	je     1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    16d1:	|  |  |                       |  |         0f b6 79 06          	movzbl 0x6(%rcx),%edi
+    for (Index i = 0; i < head; ++i) {
+    16d5:	|  |  |                       |  |         83 e6 08             	and    $0x8,%esi
+        d[i] = p[i];
+    16d8:	|  |  |                       |  |         41 88 78 06          	mov    %dil,0x6(%r8)
+    for (Index i = 0; i < head; ++i) {
+    16dc:	+--|--|-----------------------|--|-------- 74 72                	je     1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    16de:	|  |  |                       |  |         0f b6 71 07          	movzbl 0x7(%rcx),%esi
+    16e2:	|  |  |                       |  |         41 88 70 07          	mov    %sil,0x7(%r8)
+    for (Index i = 0; i < head; ++i) {
+    16e6:	|  |  |                       |  |         48 83 f8 08          	cmp    $0x8,%rax
+    16ea:	+--|--|-----------------------|--|-------- 76 64                	jbe    1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    16ec:	|  |  |                       |  |         0f b6 71 08          	movzbl 0x8(%rcx),%esi
+    16f0:	|  |  |                       |  |         41 88 70 08          	mov    %sil,0x8(%r8)
+    for (Index i = 0; i < head; ++i) {
+    16f4:	|  |  |                       |  |         48 83 f8 09          	cmp    $0x9,%rax
+    16f8:	+--|--|-----------------------|--|-------- 74 56                	je     1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    16fa:	|  |  |                       |  |         0f b6 71 09          	movzbl 0x9(%rcx),%esi
+    16fe:	|  |  |                       |  |         41 88 70 09          	mov    %sil,0x9(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1702:	|  |  |                       |  |         48 83 f8 0a          	cmp    $0xa,%rax
+    1706:	+--|--|-----------------------|--|-------- 74 48                	je     1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1708:	|  |  |                       |  |         0f b6 71 0a          	movzbl 0xa(%rcx),%esi
+    170c:	|  |  |                       |  |         41 88 70 0a          	mov    %sil,0xa(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1710:	|  |  |                       |  |         48 83 f8 0b          	cmp    $0xb,%rax
+    1714:	+--|--|-----------------------|--|-------- 74 3a                	je     1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1716:	|  |  |                       |  |         0f b6 71 0b          	movzbl 0xb(%rcx),%esi
+    171a:	|  |  |                       |  |         41 88 70 0b          	mov    %sil,0xb(%r8)
+    for (Index i = 0; i < head; ++i) {
+    171e:	|  |  |                       |  |         48 83 f8 0c          	cmp    $0xc,%rax
+    1722:	+--|--|-----------------------|--|-------- 74 2c                	je     1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1724:	|  |  |                       |  |         0f b6 71 0c          	movzbl 0xc(%rcx),%esi
+    1728:	|  |  |                       |  |         41 88 70 0c          	mov    %sil,0xc(%r8)
+    for (Index i = 0; i < head; ++i) {
+    172c:	|  |  |                       |  |         48 83 f8 0d          	cmp    $0xd,%rax
+    1730:	+--|--|-----------------------|--|-------- 74 1e                	je     1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1732:	|  |  |                       |  |         0f b6 71 0d          	movzbl 0xd(%rcx),%esi
+    1736:	|  |  |                       |  |         41 88 70 0d          	mov    %sil,0xd(%r8)
+    for (Index i = 0; i < head; ++i) {
+    173a:	|  |  |                       |  |         49 8d 70 ff          	lea    -0x1(%r8),%rsi
+    173e:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    1741:	+--|--|-----------------------|--|-------- 75 0d                	jne    1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1743:	|  |  |                       |  |         0f b6 71 0e          	movzbl 0xe(%rcx),%esi
+    1747:	|  |  |                       |  |         41 88 70 0e          	mov    %sil,0xe(%r8)
+    for (Index i = 0; i < head; ++i) {
+    174b:	|  |  |                       |  |         0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+        rotated[i] = p[(head + i) % 16];
+    1750:	>--|--|-----------------------|--|-------> 48 8d 70 07          	lea    0x7(%rax),%rsi
+    1754:	|  |  |                       |  |         4c 8d 78 06          	lea    0x6(%rax),%r15
+    1758:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    175b:	|  |  |                       |  |         4c 8d 70 05          	lea    0x5(%rax),%r14
+    175f:	|  |  |                       |  |         4c 8d 68 04          	lea    0x4(%rax),%r13
+    1763:	|  |  |                       |  |         41 83 e7 0f          	and    $0xf,%r15d
+    std::memcpy(&v, s, sizeof(v));
+    1767:	|  |  |                       |  |         0f b6 34 31          	movzbl (%rcx,%rsi,1),%esi
+        rotated[i] = p[(head + i) % 16];
+    176b:	|  |  |                       |  |         41 83 e6 0f          	and    $0xf,%r14d
+    176f:	|  |  |                       |  |         41 83 e5 0f          	and    $0xf,%r13d
+    1773:	|  |  |                       |  |         4c 8d 60 03          	lea    0x3(%rax),%r12
+    std::memcpy(&v, s, sizeof(v));
+    1777:	|  |  |                       |  |         46 0f b6 3c 39       	movzbl (%rcx,%r15,1),%r15d
+    177c:	|  |  |                       |  |         46 0f b6 34 31       	movzbl (%rcx,%r14,1),%r14d
+        rotated[i] = p[(head + i) % 16];
+    1781:	|  |  |                       |  |         48 8d 78 08          	lea    0x8(%rax),%rdi
+    1785:	|  |  |                       |  |         41 83 e4 0f          	and    $0xf,%r12d
+    std::memcpy(&v, s, sizeof(v));
+    1789:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    178d:	|  |  |                       |  |         46 0f b6 2c 29       	movzbl (%rcx,%r13,1),%r13d
+        rotated[i] = p[(head + i) % 16];
+    1792:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    1795:	|  |  |                       |  |         48 8d 68 02          	lea    0x2(%rax),%rbp
+    std::memcpy(&v, s, sizeof(v));
+    1799:	|  |  |                       |  |         4c 09 fe             	or     %r15,%rsi
+        rotated[i] = p[(head + i) % 16];
+    179c:	|  |  |                       |  |         48 89 7c 24 c8       	mov    %rdi,-0x38(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    17a1:	|  |  |                       |  |         46 0f b6 24 21       	movzbl (%rcx,%r12,1),%r12d
+        rotated[i] = p[(head + i) % 16];
+    17a6:	|  |  |                       |  |         83 e5 0f             	and    $0xf,%ebp
+    std::memcpy(&v, s, sizeof(v));
+    17a9:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    17ad:	|  |  |                       |  |         48 8d 78 09          	lea    0x9(%rax),%rdi
+    std::memcpy(&v, s, sizeof(v));
+    17b1:	|  |  |                       |  |         0f b6 2c 29          	movzbl (%rcx,%rbp,1),%ebp
+        rotated[i] = p[(head + i) % 16];
+    17b5:	|  |  |                       |  |         48 8d 58 01          	lea    0x1(%rax),%rbx
+    std::memcpy(&v, s, sizeof(v));
+    17b9:	|  |  |                       |  |         4c 09 f6             	or     %r14,%rsi
+        rotated[i] = p[(head + i) % 16];
+    17bc:	|  |  |                       |  |         49 89 fb             	mov    %rdi,%r11
+    17bf:	|  |  |                       |  |         48 8d 78 0a          	lea    0xa(%rax),%rdi
+    17c3:	|  |  |                       |  |         83 e3 0f             	and    $0xf,%ebx
+    std::memcpy(&v, s, sizeof(v));
+    17c6:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    17ca:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    17ce:	|  |  |                       |  |         49 89 fa             	mov    %rdi,%r10
+    std::memcpy(&v, s, sizeof(v));
+    17d1:	|  |  |                       |  |         4c 09 ee             	or     %r13,%rsi
+        rotated[i] = p[(head + i) % 16];
+    17d4:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    17d8:	|  |  |                       |  |         48 8d 78 0b          	lea    0xb(%rax),%rdi
+    17dc:	|  |  |                       |  |         4c 89 5c 24 e0       	mov    %r11,-0x20(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    17e1:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    17e5:	|  |  |                       |  |         4c 8d 58 0f          	lea    0xf(%rax),%r11
+    17e9:	|  |  |                       |  |         4c 89 54 24 e8       	mov    %r10,-0x18(%rsp)
+    17ee:	|  |  |                       |  |         49 89 f9             	mov    %rdi,%r9
+    std::memcpy(&v, s, sizeof(v));
+    17f1:	|  |  |                       |  |         4c 09 e6             	or     %r12,%rsi
+        rotated[i] = p[(head + i) % 16];
+    17f4:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    17f8:	|  |  |                       |  |         4c 8d 50 0e          	lea    0xe(%rax),%r10
+    17fc:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    1800:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1804:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    1808:	|  |  |                       |  |         4c 89 4c 24 f0       	mov    %r9,-0x10(%rsp)
+    180d:	|  |  |                       |  |         4c 8d 48 0d          	lea    0xd(%rax),%r9
+    std::memcpy(&v, s, sizeof(v));
+    1811:	|  |  |                       |  |         48 09 ee             	or     %rbp,%rsi
+    1814:	|  |  |                       |  |         0f b6 2c 19          	movzbl (%rcx,%rbx,1),%ebp
+    1818:	|  |  |                       |  |         46 0f b6 14 11       	movzbl (%rcx,%r10,1),%r10d
+        rotated[i] = p[(head + i) % 16];
+    181d:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    1821:	|  |  |                       |  |         48 89 f3             	mov    %rsi,%rbx
+    1824:	|  |  |                       |  |         42 0f b6 34 19       	movzbl (%rcx,%r11,1),%esi
+    1829:	|  |  |                       |  |         46 0f b6 0c 09       	movzbl (%rcx,%r9,1),%r9d
+        rotated[i] = p[(head + i) % 16];
+    182e:	|  |  |                       |  |         48 8d 78 0c          	lea    0xc(%rax),%rdi
+    1832:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    std::memcpy(&v, s, sizeof(v));
+    1835:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    1839:	|  |  |                       |  |         4c 8b 5c 24 e0       	mov    -0x20(%rsp),%r11
+    183e:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1842:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    1845:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    1849:	|  |  |                       |  |         0f b6 2c 01          	movzbl (%rcx,%rax,1),%ebp
+    184d:	|  |  |                       |  |         4c 09 d6             	or     %r10,%rsi
+    1850:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    1854:	|  |  |                       |  |         4c 8b 54 24 e8       	mov    -0x18(%rsp),%r10
+    1859:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    185d:	|  |  |                       |  |         4c 09 ce             	or     %r9,%rsi
+    1860:	|  |  |                       |  |         4c 8b 4c 24 f0       	mov    -0x10(%rsp),%r9
+    1865:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1869:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    186c:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    186f:	|  |  |                       |  |         42 0f b6 3c 09       	movzbl (%rcx,%r9,1),%edi
+    1874:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1878:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    187b:	|  |  |                       |  |         42 0f b6 3c 11       	movzbl (%rcx,%r10,1),%edi
+    1880:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1884:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    1887:	|  |  |                       |  |         42 0f b6 3c 19       	movzbl (%rcx,%r11,1),%edi
+    188c:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1890:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    1893:	|  |  |                       |  |         48 8b 7c 24 c8       	mov    -0x38(%rsp),%rdi
+    1898:	|  |  |                       |  |         48 89 5c 24 c8       	mov    %rbx,-0x38(%rsp)
+    189d:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    18a1:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    18a5:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    18a8:	|  |  |                       |  |         48 8d 78 40          	lea    0x40(%rax),%rdi
+    18ac:	|  |  |                       |  |         4c 01 c0             	add    %r8,%rax
+    std::memcpy(&v, s, sizeof(v));
+    18af:	|  |  |                       |  |         48 89 74 24 d0       	mov    %rsi,-0x30(%rsp)
+    18b4:	|  |  |                       |  |         66 0f 6f 44 24 c8    	movdqa -0x38(%rsp),%xmm0
+    for (; i + 64 <= n; i += 64) {
+    18ba:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    18c0:	|  |  |                       |  |     /-> 48 89 fe             	mov    %rdi,%rsi
+    for (; i + 64 <= n; i += 64) {
+    18c3:	|  |  |                       |  |     |   48 83 c7 40          	add    $0x40,%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    18c7:	|  |  |                       |  |     |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    18cb:	|  |  |                       |  |     |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    18d0:	|  |  |                       |  |     |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    18d5:	|  |  |                       |  |     |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    18da:	|  |  |                       |  |     |   48 83 c0 40          	add    $0x40,%rax
+    18de:	|  |  |                       |  |     |   48 39 fa             	cmp    %rdi,%rdx
+    18e1:	|  |  |                       |  |     \-- 73 dd                	jae    18c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2a0>
+        stream16(d + i, v);
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+    18e3:	|  |  |                       |  |         48 8d 46 10          	lea    0x10(%rsi),%rax
+    18e7:	|  |  |                       |  |         48 39 c2             	cmp    %rax,%rdx
+    18ea:	|  |  |                       |  |  /----- 72 15                	jb     1901 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2e1>
+    18ec:	|  |  |                       |  |  |      49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    18f0:	|  |  |                       |  |  |  /-> 48 89 c6             	mov    %rax,%rsi
+    18f3:	|  |  |                       |  |  |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    18f8:	|  |  |                       |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    18fc:	|  |  |                       |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    18ff:	|  |  |                       |  |  |  \-- 73 ef                	jae    18f0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2d0>
+        stream16(d + i, v);
+    }
+    __builtin_ia32_sfence();
+    1901:	|  |  |                       |  |  \----> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    1904:	|  |  |                       |  |         48 39 d6             	cmp    %rdx,%rsi
+    1907:	|  |  |                       |  |  /----- 73 1e                	jae    1927 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x307>
+    1909:	|  |  |                       |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        d[i] = p[i % 16];
+    1910:	|  |  |                       |  |  |  /-> 48 89 f0             	mov    %rsi,%rax
+    1913:	|  |  |                       |  |  |  |   83 e0 0f             	and    $0xf,%eax
+    1916:	|  |  |                       |  |  |  |   0f b6 04 01          	movzbl (%rcx,%rax,1),%eax
+    191a:	|  |  |                       |  |  |  |   41 88 04 30          	mov    %al,(%r8,%rsi,1)
+    for (; i < n; ++i) {
+    191e:	|  |  |                       |  |  |  |   48 83 c6 01          	add    $0x1,%rsi
+    1922:	|  |  |                       |  |  |  |   48 39 f2             	cmp    %rsi,%rdx
+    1925:	|  |  |                       |  |  |  \-- 75 e9                	jne    1910 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2f0>
+    }
+}
+    1927:	|  |  |                       |  |  \----> 5b                   	pop    %rbx
+    1928:	|  |  |                       |  |         5d                   	pop    %rbp
+    1929:	|  |  |                       |  |         41 5c                	pop    %r12
+    192b:	|  |  |                       |  |         41 5d                	pop    %r13
+    192d:	|  |  |                       |  |         41 5e                	pop    %r14
+    192f:	|  |  |                       |  |         41 5f                	pop    %r15
+    1931:	|  |  |                       |  |         c3                   	ret
+    1932:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1938:	|  |  |                       |  \-------> 48 83 ff 06          	cmp    $0x6,%rdi
+    193c:	|  |  |  /--------------------|----------- 0f 86 e1 01 00 00    	jbe    1b23 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x503>
+        d[i] = p[i];
+    1942:	|  |  |  |                    |            48 8b 31             	mov    (%rcx),%rsi
+    1945:	|  |  |  |                    |            49 89 30             	mov    %rsi,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1948:	|  |  |  |                    |            48 83 f8 08          	cmp    $0x8,%rax
+    194c:	+--|--|--|--------------------|----------- 0f 84 fe fd ff ff    	je     1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    1952:	|  |  |  |                    |            48 8d 70 f7          	lea    -0x9(%rax),%rsi
+    1956:	|  |  |  |                    |            4c 8d 48 f8          	lea    -0x8(%rax),%r9
+    195a:	|  |  |  |                    |            48 83 fe 02          	cmp    $0x2,%rsi
+    195e:	|  |  |  |                    |            be 08 00 00 00       	mov    $0x8,%esi
+    1963:	|  |  |  |                    |        /-- 76 15                	jbe    197a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x35a>
+        d[i] = p[i];
+    1965:	|  |  |  |  /-----------------|--------|-> 8b 3c 31             	mov    (%rcx,%rsi,1),%edi
+    1968:	|  |  |  |  |                 |        |   41 89 3c 30          	mov    %edi,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    196c:	|  |  |  |  |                 |        |   48 83 c6 04          	add    $0x4,%rsi
+    1970:	|  |  |  |  |                 |        |   49 83 f9 04          	cmp    $0x4,%r9
+    1974:	+--|--|--|--|-----------------|--------|-- 0f 84 d6 fd ff ff    	je     1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    197a:	|  |  |  |  |                 |        \-> 0f b6 3c 31          	movzbl (%rcx,%rsi,1),%edi
+    197e:	|  |  |  |  |                 |            41 88 3c 30          	mov    %dil,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    1982:	|  |  |  |  |                 |            48 8d 7e 01          	lea    0x1(%rsi),%rdi
+    1986:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    1989:	+--|--|--|--|-----------------|----------- 0f 83 c1 fd ff ff    	jae    1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    198f:	|  |  |  |  |                 |            0f b6 7c 31 01       	movzbl 0x1(%rcx,%rsi,1),%edi
+    1994:	|  |  |  |  |                 |            41 88 7c 30 01       	mov    %dil,0x1(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    1999:	|  |  |  |  |                 |            48 8d 7e 02          	lea    0x2(%rsi),%rdi
+    199d:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    19a0:	+--|--|--|--|-----------------|----------- 0f 83 aa fd ff ff    	jae    1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    19a6:	|  |  |  |  |                 |            0f b6 7c 31 02       	movzbl 0x2(%rcx,%rsi,1),%edi
+    19ab:	|  |  |  |  |                 |            41 88 7c 30 02       	mov    %dil,0x2(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    19b0:	+--|--|--|--|-----------------|----------- e9 9b fd ff ff       	jmp    1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    19b5:	|  |  |  |  |                 |            0f 1f 00             	nopl   (%rax)
+    Length done = (n < 16) ? n : 16;
+    19b8:	|  |  |  |  |                 \----------> 41 ba 10 00 00 00    	mov    $0x10,%r10d
+    19be:	|  |  |  |  |                              4c 39 d2             	cmp    %r10,%rdx
+    19c1:	|  |  |  |  |                              4c 0f 46 d2          	cmovbe %rdx,%r10
+    std::memcpy(d, s, n);
+    19c5:	|  |  |  |  |                              44 89 d0             	mov    %r10d,%eax
+    19c8:	|  |  |  |  |                              41 83 fa 08          	cmp    $0x8,%r10d
+    19cc:	|  |  |  |  |        /-------------------- 0f 82 cc 00 00 00    	jb     1a9e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47e>
+    19d2:	|  |  |  |  |        |                     48 8b 06             	mov    (%rsi),%rax
+    19d5:	|  |  |  |  |        |                     4c 8d 4f 08          	lea    0x8(%rdi),%r9
+    19d9:	|  |  |  |  |        |                     49 83 e1 f8          	and    $0xfffffffffffffff8,%r9
+    19dd:	|  |  |  |  |        |                     48 89 07             	mov    %rax,(%rdi)
+    19e0:	|  |  |  |  |        |                     44 89 d0             	mov    %r10d,%eax
+    19e3:	|  |  |  |  |        |                     48 8b 74 06 f8       	mov    -0x8(%rsi,%rax,1),%rsi
+    19e8:	|  |  |  |  |        |                     48 89 74 07 f8       	mov    %rsi,-0x8(%rdi,%rax,1)
+    19ed:	|  |  |  |  |        |                     48 89 f8             	mov    %rdi,%rax
+    19f0:	|  |  |  |  |        |                     4c 29 c8             	sub    %r9,%rax
+    19f3:	|  |  |  |  |        |                     48 29 c1             	sub    %rax,%rcx
+    19f6:	|  |  |  |  |        |                     44 01 d0             	add    %r10d,%eax
+    19f9:	|  |  |  |  |        |                     83 e0 f8             	and    $0xfffffff8,%eax
+    19fc:	|  |  |  |  |        |                     83 f8 08             	cmp    $0x8,%eax
+    19ff:	|  |  |  |  |  /-----|-------------------- 72 16                	jb     1a17 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    1a01:	|  |  |  |  |  |     |                     83 e0 f8             	and    $0xfffffff8,%eax
+    1a04:	|  |  |  |  |  |     |                     31 f6                	xor    %esi,%esi
+    1a06:	|  |  |  |  |  |     |                 /-> 89 f7                	mov    %esi,%edi
+    1a08:	|  |  |  |  |  |     |                 |   83 c6 08             	add    $0x8,%esi
+    1a0b:	|  |  |  |  |  |     |                 |   4c 8b 1c 39          	mov    (%rcx,%rdi,1),%r11
+    1a0f:	|  |  |  |  |  |     |                 |   4d 89 1c 39          	mov    %r11,(%r9,%rdi,1)
+    1a13:	|  |  |  |  |  |     |                 |   39 c6                	cmp    %eax,%esi
+    1a15:	|  |  |  |  |  |     |                 \-- 72 ef                	jb     1a06 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3e6>
+    while (done < n) {
+    1a17:	|  |  |  |  |  >-----|-------------------> 49 39 d2             	cmp    %rdx,%r10
+    1a1a:	|  |  |  |  |  |     |           /-------- 72 33                	jb     1a4f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    1a1c:	|  |  |  |  |  |     |     /-----|-------- e9 af 00 00 00       	jmp    1ad0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b0>
+    1a21:	|  |  |  |  |  |     |     |     |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    std::memcpy(d, s, n);
+    1a28:	|  |  |  |  |  |     |     |     |     /-> 41 f6 c1 04          	test   $0x4,%r9b
+    1a2c:	|  |  |  |  |  |     |     |  /--|-----|-- 0f 85 9f 00 00 00    	jne    1ad1 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b1>
+    1a32:	|  |  |  |  |  |     |     |  |  |     |   45 85 c9             	test   %r9d,%r9d
+    1a35:	|  |  |  |  |  |  /--|-----|--|--|-----|-- 74 10                	je     1a47 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    1a37:	|  |  |  |  |  |  |  |     |  |  |     |   41 0f b6 08          	movzbl (%r8),%ecx
+    1a3b:	|  |  |  |  |  |  |  |     |  |  |     |   88 08                	mov    %cl,(%rax)
+    1a3d:	|  |  |  |  |  |  |  |     |  |  |     |   41 f6 c1 02          	test   $0x2,%r9b
+    1a41:	|  |  |  |  |  |  |  |  /--|--|--|-----|-- 0f 85 c9 00 00 00    	jne    1b10 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4f0>
+        done += m;
+    1a47:	|  |  |  |  |  |  >--|--|--|--|--|-----|-> 4d 01 ca             	add    %r9,%r10
+    while (done < n) {
+    1a4a:	|  |  |  |  |  |  |  |  |  |  |  |     |   49 39 d2             	cmp    %rdx,%r10
+    1a4d:	|  |  |  |  |  |  |  |  |  |  |  |  /--|-- 73 4e                	jae    1a9d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47d>
+        Length const m = (done < n - done) ? done : n - done;
+    1a4f:	|  |  |  |  |  |  |  |  |  |  |  >--|--|-> 49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    1a52:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4b 8d 04 10          	lea    (%r8,%r10,1),%rax
+        Length const m = (done < n - done) ? done : n - done;
+    1a56:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 29 d1             	sub    %r10,%r9
+    1a59:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 39 d1             	cmp    %r10,%r9
+    1a5c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 0f 47 ca          	cmova  %r10,%r9
+    std::memcpy(d, s, n);
+    1a60:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   41 83 f9 08          	cmp    $0x8,%r9d
+    1a64:	|  |  |  |  |  |  |  |  |  |  |  |  |  \-- 72 c2                	jb     1a28 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x408>
+    1a66:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 08             	mov    (%r8),%rcx
+    1a69:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 78 08          	lea    0x8(%rax),%rdi
+        done += m;
+    1a6d:	|  |  |  |  |  |  |  |  |  |  |  |  |      4d 01 ca             	add    %r9,%r10
+    std::memcpy(d, s, n);
+    1a70:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 83 e7 f8          	and    $0xfffffffffffffff8,%rdi
+    1a74:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 08             	mov    %rcx,(%rax)
+    1a77:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 89 c9             	mov    %r9d,%ecx
+    1a7a:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 74 08 f8       	mov    -0x8(%r8,%rcx,1),%rsi
+    1a7f:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 74 08 f8       	mov    %rsi,-0x8(%rax,%rcx,1)
+    1a84:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 f8             	sub    %rdi,%rax
+    1a87:	|  |  |  |  |  |  |  |  |  |  |  |  |      4c 89 c6             	mov    %r8,%rsi
+    1a8a:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 c6             	sub    %rax,%rsi
+    1a8d:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 01 c8             	add    %r9d,%eax
+    1a90:	|  |  |  |  |  |  |  |  |  |  |  |  |      c1 e8 03             	shr    $0x3,%eax
+    1a93:	|  |  |  |  |  |  |  |  |  |  |  |  |      89 c1                	mov    %eax,%ecx
+    1a95:	|  |  |  |  |  |  |  |  |  |  |  |  |      f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    1a98:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 39 d2             	cmp    %rdx,%r10
+    1a9b:	|  |  |  |  |  |  |  |  |  |  |  \--|----- 72 b2                	jb     1a4f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    1a9d:	|  |  |  |  |  |  |  |  |  |  |     \----> c3                   	ret
+    std::memcpy(d, s, n);
+    1a9e:	|  |  |  |  |  |  |  \--|--|--|----------> 41 f6 c2 04          	test   $0x4,%r10b
+    1aa2:	|  |  |  |  |  |  |     |  |  |        /-- 0f 85 85 00 00 00    	jne    1b2d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x50d>
+    1aa8:	|  |  |  |  |  |  |     |  |  |        |   85 c0                	test   %eax,%eax
+    1aaa:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 67 ff ff ff    	je     1a17 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    1ab0:	|  |  |  |  |  |  |     |  |  |        |   0f b6 36             	movzbl (%rsi),%esi
+    1ab3:	|  |  |  |  |  |  |     |  |  |        |   40 88 37             	mov    %sil,(%rdi)
+    1ab6:	|  |  |  |  |  |  |     |  |  |        |   a8 02                	test   $0x2,%al
+    1ab8:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 59 ff ff ff    	je     1a17 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    1abe:	|  |  |  |  |  |  |     |  |  |        |   0f b7 4c 01 fe       	movzwl -0x2(%rcx,%rax,1),%ecx
+    1ac3:	|  |  |  |  |  |  |     |  |  |        |   66 89 4c 07 fe       	mov    %cx,-0x2(%rdi,%rax,1)
+    1ac8:	|  |  |  |  |  +--|-----|--|--|--------|-- e9 4a ff ff ff       	jmp    1a17 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    1acd:	|  |  |  |  |  |  |     |  |  |        |   0f 1f 00             	nopl   (%rax)
+    1ad0:	|  |  |  |  |  |  |     |  \--|--------|-> c3                   	ret
+    1ad1:	|  |  |  |  |  |  |     |     \--------|-> 41 8b 08             	mov    (%r8),%ecx
+    1ad4:	|  |  |  |  |  |  |     |              |   89 08                	mov    %ecx,(%rax)
+    1ad6:	|  |  |  |  |  |  |     |              |   44 89 c9             	mov    %r9d,%ecx
+    1ad9:	|  |  |  |  |  |  |     |              |   41 8b 74 08 fc       	mov    -0x4(%r8,%rcx,1),%esi
+    1ade:	|  |  |  |  |  |  |     |              |   89 74 08 fc          	mov    %esi,-0x4(%rax,%rcx,1)
+    1ae2:	|  |  |  |  |  |  +-----|--------------|-- e9 60 ff ff ff       	jmp    1a47 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+        d[i] = p[i];
+    1ae7:	|  \--|--|--|--|--|-----|--------------|-> 0f b6 39             	movzbl (%rcx),%edi
+    1aea:	|     |  |  |  |  |     |              |   41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1aed:	|     |  |  |  |  |     |              |   40 f6 c6 0e          	test   $0xe,%sil
+    1af1:	+-----|--|--|--|--|-----|--------------|-- 0f 84 59 fc ff ff    	je     1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1af7:	|     |  |  |  |  |     |              |   0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    1afb:	|     |  |  |  |  |     |              |   41 88 78 01          	mov    %dil,0x1(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1aff:	|     |  |  |  |  |     |              |   48 83 f8 03          	cmp    $0x3,%rax
+    1b03:	\-----|--|--|--|--|-----|--------------|-- 0f 85 47 fc ff ff    	jne    1750 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    1b09:	      \--|--|--|--|-----|--------------|-- e9 7b fb ff ff       	jmp    1689 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x69>
+    1b0e:	         |  |  |  |     |              |   66 90                	xchg   %ax,%ax
+    std::memcpy(d, s, n);
+    1b10:	         |  |  |  |     \--------------|-> 44 89 c9             	mov    %r9d,%ecx
+    1b13:	         |  |  |  |                    |   41 0f b7 74 08 fe    	movzwl -0x2(%r8,%rcx,1),%esi
+    1b19:	         |  |  |  |                    |   66 89 74 08 fe       	mov    %si,-0x2(%rax,%rcx,1)
+    1b1e:	         |  |  |  \--------------------|-- e9 24 ff ff ff       	jmp    1a47 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    for (Index i = 0; i < head; ++i) {
+    1b23:	         \--|--|-----------------------|-> 49 89 c1             	mov    %rax,%r9
+    1b26:	            |  |                       |   31 f6                	xor    %esi,%esi
+    1b28:	            \--|-----------------------|-- e9 38 fe ff ff       	jmp    1965 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x345>
+    std::memcpy(d, s, n);
+    1b2d:	               |                       \-> 8b 36                	mov    (%rsi),%esi
+    1b2f:	               |                           89 37                	mov    %esi,(%rdi)
+    1b31:	               |                           8b 4c 01 fc          	mov    -0x4(%rcx,%rax,1),%ecx
+    1b35:	               |                           89 4c 07 fc          	mov    %ecx,-0x4(%rdi,%rax,1)
+    1b39:	               \-------------------------- e9 d9 fe ff ff       	jmp    1a17 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    1b3e:	                                           66 90                	xchg   %ax,%ax
+
+0000000000001b40 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    1b40:	    48 85 ff             	test   %rdi,%rdi
+    1b43:	/-- 74 0b                	je     1b50 <nel::free_aligned(void*)+0x10>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    1b45:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    1b49:	|   e9 e2 f4 ff ff       	jmp    1030 <free@plt>
+    1b4e:	|   66 90                	xchg   %ax,%ax
+}
+    1b50:	\-> c3                   	ret
+    1b51:	    66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1b58:	    00 00 00 00 
+    1b5c:	    0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001b60 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    1b60:	                   41 56                	push   %r14
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1b62:	                   48 8d 05 c1 04 00 00 	lea    0x4c1(%rip),%rax        # 202a <_IO_stdin_used+0x2a>
+    1b69:	                   41 55                	push   %r13
+    1b6b:	                   66 48 0f 6e c8       	movq   %rax,%xmm1
+    1b70:	                   41 54                	push   %r12
+    1b72:	                   55                   	push   %rbp
+    1b73:	                   48 89 cd             	mov    %rcx,%rbp
+    1b76:	                   48 8d 0d 9d 04 00 00 	lea    0x49d(%rip),%rcx        # 201a <_IO_stdin_used+0x1a>
+    1b7d:	                   53                   	push   %rbx
+    1b7e:	                   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    1b83:	                   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    1b87:	                   48 83 ec 20          	sub    $0x20,%rsp
+            , file_name_(file_name)
+            , line_num_(line_num)
+    1b8b:	                   c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    1b92:	                   00 
+            : fn_name_(fn_name)
+    1b93:	                   0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    1b97:	                   48 85 f6             	test   %rsi,%rsi
+    1b9a:	/----------------- 0f 84 a0 00 00 00    	je     1c40 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    1ba0:	|                  48 8d 46 ff          	lea    -0x1(%rsi),%rax
+    1ba4:	|                  48 89 f3             	mov    %rsi,%rbx
+    1ba7:	|                  48 85 f0             	test   %rsi,%rax
+    1baa:	+----------------- 0f 85 90 00 00 00    	jne    1c40 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1bb0:	|                  48 8d 34 2e          	lea    (%rsi,%rbp,1),%rsi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    1bb4:	|                  48 85 ff             	test   %rdi,%rdi
+    1bb7:	|     /----------- 74 67                	je     1c20 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xc0>
+    1bb9:	|     |            4c 8b 6f f8          	mov    -0x8(%rdi),%r13
+    uint8_t *const new_base =
+    1bbd:	|     |            49 89 d4             	mov    %rdx,%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1bc0:	|     |            4c 29 ef             	sub    %r13,%rdi
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1bc3:	|     |            e8 f8 f4 ff ff       	call   10c0 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    1bc8:	|     |            48 85 c0             	test   %rax,%rax
+    1bcb:	|  /--|----------- 0f 84 7e 00 00 00    	je     1c4f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1bd1:	|  |  |            48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    1bd6:	|  |  |            48 f7 db             	neg    %rbx
+    1bd9:	|  |  |            48 21 cb             	and    %rcx,%rbx
+    1bdc:	|  |  |            49 89 de             	mov    %rbx,%r14
+    1bdf:	|  |  |            49 29 c6             	sub    %rax,%r14
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    1be2:	|  |  |            4d 39 f5             	cmp    %r14,%r13
+    1be5:	|  |  |        /-- 75 19                	jne    1c00 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xa0>
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    }
+    offset_field(new_p) = new_offset;
+    1be7:	|  |  |     /--|-> 4c 89 73 f8          	mov    %r14,-0x8(%rbx)
+    return new_p;
+}
+    1beb:	|  |  |  /--|--|-> 48 83 c4 20          	add    $0x20,%rsp
+    1bef:	|  |  |  |  |  |   48 89 d8             	mov    %rbx,%rax
+    1bf2:	|  |  |  |  |  |   5b                   	pop    %rbx
+    1bf3:	|  |  |  |  |  |   5d                   	pop    %rbp
+    1bf4:	|  |  |  |  |  |   41 5c                	pop    %r12
+    1bf6:	|  |  |  |  |  |   41 5d                	pop    %r13
+    1bf8:	|  |  |  |  |  |   41 5e                	pop    %r14
+    1bfa:	|  |  |  |  |  |   c3                   	ret
+    1bfb:	|  |  |  |  |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        std::memmove(new_p, new_base + old_offset, n);
+    1c00:	|  |  |  |  |  \-> 4c 39 e5             	cmp    %r12,%rbp
+    1c03:	|  |  |  |  |      4c 89 e2             	mov    %r12,%rdx
+    1c06:	|  |  |  |  |      4a 8d 34 28          	lea    (%rax,%r13,1),%rsi
+    1c0a:	|  |  |  |  |      48 89 df             	mov    %rbx,%rdi
+    1c0d:	|  |  |  |  |      48 0f 46 d5          	cmovbe %rbp,%rdx
+    1c11:	|  |  |  |  |      e8 ba f4 ff ff       	call   10d0 <memmove@plt>
+    1c16:	|  |  |  |  +----- eb cf                	jmp    1be7 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+    1c18:	|  |  |  |  |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    1c1f:	|  |  |  |  |      00 
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1c20:	|  |  \--|--|----> 48 89 f7             	mov    %rsi,%rdi
+    1c23:	|  |     |  |      e8 88 f4 ff ff       	call   10b0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    1c28:	|  |     |  |      48 85 c0             	test   %rax,%rax
+    1c2b:	|  +-----|--|----- 74 22                	je     1c4f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1c2d:	|  |     |  |      48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    1c32:	|  |     |  |      48 f7 db             	neg    %rbx
+    1c35:	|  |     |  |      48 21 d3             	and    %rdx,%rbx
+    1c38:	|  |     |  |      49 89 de             	mov    %rbx,%r14
+    1c3b:	|  |     |  |      49 29 c6             	sub    %rax,%r14
+    if (old_p != nullptr && new_offset != old_offset) {
+    1c3e:	|  |     |  \----- eb a7                	jmp    1be7 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    1c40:	\--|-----|-------> 48 89 e6             	mov    %rsp,%rsi
+    1c43:	   |     |         48 8d 3d f2 03 00 00 	lea    0x3f2(%rip),%rdi        # 203c <_IO_stdin_used+0x3c>
+    1c4a:	   |     |         e8 13 f5 ff ff       	call   1162 <nel::assert_fail(char const*, nel::Context const&)>
+    if (new_base == nullptr) { return nullptr; }
+    1c4f:	   \-----|-------> 31 db                	xor    %ebx,%ebx
+    1c51:	         \-------- eb 98                	jmp    1beb <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x8b>
+    1c53:	                   66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1c5a:	                   00 00 00 00 
+    1c5e:	                   66 90                	xchg   %ax,%ax
+
+0000000000001c60 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    1c60:	       53                   	push   %rbx
+            : fn_name_(fn_name)
+    1c61:	       48 8d 05 c2 03 00 00 	lea    0x3c2(%rip),%rax        # 202a <_IO_stdin_used+0x2a>
+    1c68:	       48 8d 0d ab 03 00 00 	lea    0x3ab(%rip),%rcx        # 201a <_IO_stdin_used+0x1a>
+    1c6f:	       66 48 0f 6e c1       	movq   %rcx,%xmm0
+    1c74:	       66 48 0f 6e c8       	movq   %rax,%xmm1
+    1c79:	       66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    1c7d:	       48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    1c81:	       c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    1c88:	       00 
+            : fn_name_(fn_name)
+    1c89:	       0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    1c8d:	       48 85 ff             	test   %rdi,%rdi
+    1c90:	/----- 74 35                	je     1cc7 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+    1c92:	|      48 8d 47 ff          	lea    -0x1(%rdi),%rax
+    1c96:	|      48 89 fb             	mov    %rdi,%rbx
+    1c99:	|      48 85 f8             	test   %rdi,%rax
+    1c9c:	+----- 75 29                	jne    1cc7 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1c9e:	|      48 8d 3c 37          	lea    (%rdi,%rsi,1),%rdi
+    1ca2:	|      e8 09 f4 ff ff       	call   10b0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    1ca7:	|      48 85 c0             	test   %rax,%rax
+    1caa:	|  /-- 74 15                	je     1cc1 <nel::malloc_aligned(unsigned long, unsigned long)+0x61>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1cac:	|  |   48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    1cb1:	|  |   48 f7 db             	neg    %rbx
+    1cb4:	|  |   48 21 da             	and    %rbx,%rdx
+    1cb7:	|  |   48 29 c2             	sub    %rax,%rdx
+    uint8_t *const new_p = new_base + new_offset;
+    1cba:	|  |   48 01 d0             	add    %rdx,%rax
+    offset_field(new_p) = new_offset;
+    1cbd:	|  |   48 89 50 f8          	mov    %rdx,-0x8(%rax)
+    return realloc_aligned(nullptr, align, 0, size);
+}
+    1cc1:	|  \-> 48 83 c4 20          	add    $0x20,%rsp
+    1cc5:	|      5b                   	pop    %rbx
+    1cc6:	|      c3                   	ret
+    if (!pred) { assert_fail(msg, ctx); }
+    1cc7:	\----> 48 89 e6             	mov    %rsp,%rsi
+    1cca:	       48 8d 3d 6b 03 00 00 	lea    0x36b(%rip),%rdi        # 203c <_IO_stdin_used+0x3c>
+    1cd1:	       e8 8c f4 ff ff       	call   1162 <nel::assert_fail(char const*, nel::Context const&)>
+    1cd6:	       66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1cdd:	       00 00 00 
+
+0000000000001ce0 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1ce0:	53                   	push   %rbx
+    1ce1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    1ce4:	40 0f be fe          	movsbl %sil,%edi
+    1ce8:	48 8b 35 91 23 00 00 	mov    0x2391(%rip),%rsi        # 4080 <stderr@GLIBC_2.2.5>
+    1cef:	e8 7c f3 ff ff       	call   1070 <fputc@plt>
+    return outs;
+}
+    1cf4:	48 89 d8             	mov    %rbx,%rax
+    1cf7:	5b                   	pop    %rbx
+    1cf8:	c3                   	ret
+    1cf9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001d00 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1d00:	53                   	push   %rbx
+    1d01:	48 89 fb             	mov    %rdi,%rbx
+    1d04:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    1d07:	48 8b 35 72 23 00 00 	mov    0x2372(%rip),%rsi        # 4080 <stderr@GLIBC_2.2.5>
+    1d0e:	e8 3d f3 ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    1d13:	48 89 d8             	mov    %rbx,%rax
+    1d16:	5b                   	pop    %rbx
+    1d17:	c3                   	ret
+    1d18:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    1d1f:	00 
+
+0000000000001d20 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1d20:	53                   	push   %rbx
+    1d21:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    1d24:	48 8b 3d 55 23 00 00 	mov    0x2355(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+    1d2b:	40 0f b6 d6          	movzbl %sil,%edx
+    1d2f:	31 c0                	xor    %eax,%eax
+    1d31:	48 8d 35 1f 03 00 00 	lea    0x31f(%rip),%rsi        # 2057 <_IO_stdin_used+0x57>
+    1d38:	e8 53 f3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1d3d:	48 89 d8             	mov    %rbx,%rax
+    1d40:	5b                   	pop    %rbx
+    1d41:	c3                   	ret
+    1d42:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1d49:	00 00 00 00 
+    1d4d:	0f 1f 00             	nopl   (%rax)
+
+0000000000001d50 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    1d50:	53                   	push   %rbx
+    1d51:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    1d54:	48 8b 3d 25 23 00 00 	mov    0x2325(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+    1d5b:	0f b7 d6             	movzwl %si,%edx
+    1d5e:	31 c0                	xor    %eax,%eax
+    1d60:	48 8d 35 f0 02 00 00 	lea    0x2f0(%rip),%rsi        # 2057 <_IO_stdin_used+0x57>
+    1d67:	e8 24 f3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1d6c:	48 89 d8             	mov    %rbx,%rax
+    1d6f:	5b                   	pop    %rbx
+    1d70:	c3                   	ret
+    1d71:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1d78:	00 00 00 00 
+    1d7c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001d80 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    1d80:	53                   	push   %rbx
+    1d81:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    1d84:	48 8b 3d f5 22 00 00 	mov    0x22f5(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+{
+    1d8b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    1d8d:	31 c0                	xor    %eax,%eax
+    1d8f:	48 8d 35 c1 02 00 00 	lea    0x2c1(%rip),%rsi        # 2057 <_IO_stdin_used+0x57>
+    1d96:	e8 f5 f2 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1d9b:	48 89 d8             	mov    %rbx,%rax
+    1d9e:	5b                   	pop    %rbx
+    1d9f:	c3                   	ret
+
+0000000000001da0 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    1da0:	53                   	push   %rbx
+    1da1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    1da4:	48 8b 3d d5 22 00 00 	mov    0x22d5(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+{
+    1dab:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    1dad:	31 c0                	xor    %eax,%eax
+    1daf:	48 8d 35 a1 02 00 00 	lea    0x2a1(%rip),%rsi        # 2057 <_IO_stdin_used+0x57>
+    1db6:	e8 d5 f2 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1dbb:	48 89 d8             	mov    %rbx,%rax
+    1dbe:	5b                   	pop    %rbx
+    1dbf:	c3                   	ret
+
+0000000000001dc0 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    1dc0:	53                   	push   %rbx
+    1dc1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    1dc4:	48 8b 3d b5 22 00 00 	mov    0x22b5(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+{
+    1dcb:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    1dce:	31 c0                	xor    %eax,%eax
+    1dd0:	48 8d 35 83 02 00 00 	lea    0x283(%rip),%rsi        # 205a <_IO_stdin_used+0x5a>
+    1dd7:	e8 b4 f2 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1ddc:	48 89 d8             	mov    %rbx,%rax
+    1ddf:	5b                   	pop    %rbx
+    1de0:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000001de4 <_fini>:
+    1de4:	48 83 ec 08          	sub    $0x8,%rsp
+    1de8:	48 83 c4 08          	add    $0x8,%rsp
+    1dec:	c3                   	ret
@@ -0,0 +1,477 @@
+
+target/release/examples/largestruct1_optional:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <fputs@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <fputs@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <fputs@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <fputc@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <fputc@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fprintf@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <fprintf@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+0000000000001060 <__cxa_finalize@plt>:
+    1060:	ff 25 7a 2f 00 00    	jmp    *0x2f7a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1066:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+0000000000001070 <main>:
+    nel::Optional<char const *> a = nel::Some(T("ex3"));
+    nel::log << a.map<bool>([](auto &&) -> bool { return true; }) << '\n';
+}
+
+int main()
+{
+    1070:	53                   	push   %rbx
+    nel::log << "ex1:b" << '\n';
+    1071:	48 8d 1d d1 2f 00 00 	lea    0x2fd1(%rip),%rbx        # 4049 <nel::log>
+    1078:	48 8d 35 9c 0f 00 00 	lea    0xf9c(%rip),%rsi        # 201b <_IO_stdin_used+0x1b>
+    107f:	48 89 df             	mov    %rbx,%rdi
+    1082:	e8 49 03 00 00       	call   13d0 <nel::operator<<(nel::Log&, char const*)>
+    1087:	be 0a 00 00 00       	mov    $0xa,%esi
+    108c:	48 89 c7             	mov    %rax,%rdi
+    108f:	e8 1c 03 00 00       	call   13b0 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    nel::log << "ex1:e" << '\n';
+    1094:	48 89 df             	mov    %rbx,%rdi
+    1097:	48 8d 35 83 0f 00 00 	lea    0xf83(%rip),%rsi        # 2021 <_IO_stdin_used+0x21>
+    109e:	e8 2d 03 00 00       	call   13d0 <nel::operator<<(nel::Log&, char const*)>
+    10a3:	be 0a 00 00 00       	mov    $0xa,%esi
+    10a8:	48 89 c7             	mov    %rax,%rdi
+    10ab:	e8 00 03 00 00       	call   13b0 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex2:b" << '\n';
+    10b0:	48 89 df             	mov    %rbx,%rdi
+    10b3:	48 8d 35 6d 0f 00 00 	lea    0xf6d(%rip),%rsi        # 2027 <_IO_stdin_used+0x27>
+    10ba:	e8 11 03 00 00       	call   13d0 <nel::operator<<(nel::Log&, char const*)>
+    10bf:	be 0a 00 00 00       	mov    $0xa,%esi
+    10c4:	48 89 c7             	mov    %rax,%rdi
+    10c7:	e8 e4 02 00 00       	call   13b0 <nel::operator<<(nel::Log&, char)>
+    ex2();
+    10cc:	e8 2f 02 00 00       	call   1300 <ex2()>
+    nel::log << "ex2:e" << '\n';
+    10d1:	48 89 df             	mov    %rbx,%rdi
+    10d4:	48 8d 35 52 0f 00 00 	lea    0xf52(%rip),%rsi        # 202d <_IO_stdin_used+0x2d>
+    10db:	e8 f0 02 00 00       	call   13d0 <nel::operator<<(nel::Log&, char const*)>
+    10e0:	be 0a 00 00 00       	mov    $0xa,%esi
+    10e5:	48 89 c7             	mov    %rax,%rdi
+    10e8:	e8 c3 02 00 00       	call   13b0 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex3:b" << '\n';
+    10ed:	48 89 df             	mov    %rbx,%rdi
+    10f0:	48 8d 35 3c 0f 00 00 	lea    0xf3c(%rip),%rsi        # 2033 <_IO_stdin_used+0x33>
+    10f7:	e8 d4 02 00 00       	call   13d0 <nel::operator<<(nel::Log&, char const*)>
+    10fc:	be 0a 00 00 00       	mov    $0xa,%esi
+    1101:	48 89 c7             	mov    %rax,%rdi
+    1104:	e8 a7 02 00 00       	call   13b0 <nel::operator<<(nel::Log&, char)>
+    ex3();
+    1109:	e8 22 02 00 00       	call   1330 <ex3()>
+    nel::log << "ex3:e" << '\n';
+    110e:	48 89 df             	mov    %rbx,%rdi
+    1111:	48 8d 35 21 0f 00 00 	lea    0xf21(%rip),%rsi        # 2039 <_IO_stdin_used+0x39>
+    1118:	e8 b3 02 00 00       	call   13d0 <nel::operator<<(nel::Log&, char const*)>
+    111d:	be 0a 00 00 00       	mov    $0xa,%esi
+    1122:	48 89 c7             	mov    %rax,%rdi
+    1125:	e8 86 02 00 00       	call   13b0 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex4:b" << '\n';
+    112a:	48 89 df             	mov    %rbx,%rdi
+    112d:	48 8d 35 0b 0f 00 00 	lea    0xf0b(%rip),%rsi        # 203f <_IO_stdin_used+0x3f>
+    1134:	e8 97 02 00 00       	call   13d0 <nel::operator<<(nel::Log&, char const*)>
+    1139:	be 0a 00 00 00       	mov    $0xa,%esi
+    113e:	48 89 c7             	mov    %rax,%rdi
+    1141:	e8 6a 02 00 00       	call   13b0 <nel::operator<<(nel::Log&, char)>
+    ex4();
+    1146:	e8 15 02 00 00       	call   1360 <ex4()>
+    nel::log << "ex4:e" << '\n';
+    114b:	48 89 df             	mov    %rbx,%rdi
+    114e:	48 8d 35 f0 0e 00 00 	lea    0xef0(%rip),%rsi        # 2045 <_IO_stdin_used+0x45>
+    1155:	e8 76 02 00 00       	call   13d0 <nel::operator<<(nel::Log&, char const*)>
+    115a:	be 0a 00 00 00       	mov    $0xa,%esi
+    115f:	48 89 c7             	mov    %rax,%rdi
+    1162:	e8 49 02 00 00       	call   13b0 <nel::operator<<(nel::Log&, char)>
+}
+    1167:	31 c0                	xor    %eax,%eax
+    1169:	5b                   	pop    %rbx
+    116a:	c3                   	ret
+    116b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000001170 <_start>:
+    1170:	31 ed                	xor    %ebp,%ebp
+    1172:	49 89 d1             	mov    %rdx,%r9
+    1175:	5e                   	pop    %rsi
+    1176:	48 89 e2             	mov    %rsp,%rdx
+    1179:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    117d:	50                   	push   %rax
+    117e:	54                   	push   %rsp
+    117f:	45 31 c0             	xor    %r8d,%r8d
+    1182:	31 c9                	xor    %ecx,%ecx
+    1184:	48 8d 3d e5 fe ff ff 	lea    -0x11b(%rip),%rdi        # 1070 <main>
+    118b:	ff 15 2f 2e 00 00    	call   *0x2e2f(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    1191:	f4                   	hlt
+    1192:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1199:	00 00 00 
+    119c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000011a0 <deregister_tm_clones>:
+    11a0:	    48 8d 3d 81 2e 00 00 	lea    0x2e81(%rip),%rdi        # 4028 <__TMC_END__>
+    11a7:	    48 8d 05 7a 2e 00 00 	lea    0x2e7a(%rip),%rax        # 4028 <__TMC_END__>
+    11ae:	    48 39 f8             	cmp    %rdi,%rax
+    11b1:	/-- 74 15                	je     11c8 <deregister_tm_clones+0x28>
+    11b3:	|   48 8b 05 0e 2e 00 00 	mov    0x2e0e(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    11ba:	|   48 85 c0             	test   %rax,%rax
+    11bd:	+-- 74 09                	je     11c8 <deregister_tm_clones+0x28>
+    11bf:	|   ff e0                	jmp    *%rax
+    11c1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    11c8:	\-> c3                   	ret
+    11c9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011d0 <register_tm_clones>:
+    11d0:	    48 8d 3d 51 2e 00 00 	lea    0x2e51(%rip),%rdi        # 4028 <__TMC_END__>
+    11d7:	    48 8d 35 4a 2e 00 00 	lea    0x2e4a(%rip),%rsi        # 4028 <__TMC_END__>
+    11de:	    48 29 fe             	sub    %rdi,%rsi
+    11e1:	    48 89 f0             	mov    %rsi,%rax
+    11e4:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    11e8:	    48 c1 f8 03          	sar    $0x3,%rax
+    11ec:	    48 01 c6             	add    %rax,%rsi
+    11ef:	    48 d1 fe             	sar    %rsi
+    11f2:	/-- 74 14                	je     1208 <register_tm_clones+0x38>
+    11f4:	|   48 8b 05 dd 2d 00 00 	mov    0x2ddd(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    11fb:	|   48 85 c0             	test   %rax,%rax
+    11fe:	+-- 74 08                	je     1208 <register_tm_clones+0x38>
+    1200:	|   ff e0                	jmp    *%rax
+    1202:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1208:	\-> c3                   	ret
+    1209:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001210 <__do_global_dtors_aux>:
+    1210:	       f3 0f 1e fa          	endbr64
+    1214:	       80 3d 2d 2e 00 00 00 	cmpb   $0x0,0x2e2d(%rip)        # 4048 <completed.0>
+    121b:	/----- 75 2b                	jne    1248 <__do_global_dtors_aux+0x38>
+    121d:	|      55                   	push   %rbp
+    121e:	|      48 83 3d ba 2d 00 00 	cmpq   $0x0,0x2dba(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1225:	|      00 
+    1226:	|      48 89 e5             	mov    %rsp,%rbp
+    1229:	|  /-- 74 0c                	je     1237 <__do_global_dtors_aux+0x27>
+    122b:	|  |   48 8b 3d ee 2d 00 00 	mov    0x2dee(%rip),%rdi        # 4020 <__dso_handle>
+    1232:	|  |   e8 29 fe ff ff       	call   1060 <__cxa_finalize@plt>
+    1237:	|  \-> e8 64 ff ff ff       	call   11a0 <deregister_tm_clones>
+    123c:	|      c6 05 05 2e 00 00 01 	movb   $0x1,0x2e05(%rip)        # 4048 <completed.0>
+    1243:	|      5d                   	pop    %rbp
+    1244:	|      c3                   	ret
+    1245:	|      0f 1f 00             	nopl   (%rax)
+    1248:	\----> c3                   	ret
+    1249:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001250 <frame_dummy>:
+    1250:	f3 0f 1e fa          	endbr64
+    1254:	e9 77 ff ff ff       	jmp    11d0 <register_tm_clones>
+    1259:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001260 <_close_r>:
+#include <nel/defs.hh>
+    1260:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1265:	c3                   	ret
+    1266:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    126d:	00 00 00 
+
+0000000000001270 <_fstat_r>:
+char const *T(char const *v)
+    1270:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1275:	c3                   	ret
+    1276:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    127d:	00 00 00 
+
+0000000000001280 <_kill_r>:
+}
+    1280:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1285:	c3                   	ret
+    1286:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    128d:	00 00 00 
+
+0000000000001290 <_lseek_r>:
+{
+    1290:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1295:	c3                   	ret
+    1296:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    129d:	00 00 00 
+
+00000000000012a0 <_read_r>:
+    nel::Optional<char const *> a = nel::Some(T("ex1"));
+    12a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12a5:	c3                   	ret
+    12a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12ad:	00 00 00 
+
+00000000000012b0 <_write_r>:
+    nel::Optional<char const *> a = nel::Some(T("ex2"));
+    12b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12b5:	c3                   	ret
+    12b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12bd:	00 00 00 
+
+00000000000012c0 <_getpid_r>:
+
+    12c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12c5:	c3                   	ret
+    12c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12cd:	00 00 00 
+
+00000000000012d0 <_isatty_r>:
+void ex3()
+    12d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12d5:	c3                   	ret
+    12d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12dd:	00 00 00 
+
+00000000000012e0 <T(char const*)>:
+{
+    12e0:	48 89 f8             	mov    %rdi,%rax
+}
+    12e3:	c3                   	ret
+    12e4:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    12eb:	00 00 00 00 
+    12ef:	90                   	nop
+
+00000000000012f0 <ex1()>:
+}
+    12f0:	c3                   	ret
+    12f1:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    12f8:	00 00 00 00 
+    12fc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001300 <ex2()>:
+{
+    1300:	48 83 ec 08          	sub    $0x8,%rsp
+    nel::log << a.is_some() << '\n';
+    1304:	be 01 00 00 00       	mov    $0x1,%esi
+    1309:	48 8d 3d 39 2d 00 00 	lea    0x2d39(%rip),%rdi        # 4049 <nel::log>
+    1310:	e8 5b 01 00 00       	call   1470 <nel::operator<<(nel::Log&, int)>
+    1315:	be 0a 00 00 00       	mov    $0xa,%esi
+}
+    131a:	48 83 c4 08          	add    $0x8,%rsp
+    nel::log << a.is_some() << '\n';
+    131e:	48 89 c7             	mov    %rax,%rdi
+    1321:	e9 8a 00 00 00       	jmp    13b0 <nel::operator<<(nel::Log&, char)>
+    1326:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    132d:	00 00 00 
+
+0000000000001330 <ex3()>:
+{
+    1330:	48 83 ec 08          	sub    $0x8,%rsp
+    nel::log << a.unwrap() << '\n';
+    1334:	48 8d 35 c9 0c 00 00 	lea    0xcc9(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    133b:	48 8d 3d 07 2d 00 00 	lea    0x2d07(%rip),%rdi        # 4049 <nel::log>
+    1342:	e8 89 00 00 00       	call   13d0 <nel::operator<<(nel::Log&, char const*)>
+    1347:	be 0a 00 00 00       	mov    $0xa,%esi
+}
+    134c:	48 83 c4 08          	add    $0x8,%rsp
+    nel::log << a.unwrap() << '\n';
+    1350:	48 89 c7             	mov    %rax,%rdi
+    1353:	e9 58 00 00 00       	jmp    13b0 <nel::operator<<(nel::Log&, char)>
+    1358:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    135f:	00 
+
+0000000000001360 <ex4()>:
+{
+    1360:	53                   	push   %rbx
+                         << "None)";
+                    return outs;
+                    break;
+                case Tag::SOME:
+                    outs << "Optional("
+                         << "Some(";
+    1361:	48 8d 1d e1 2c 00 00 	lea    0x2ce1(%rip),%rbx        # 4049 <nel::log>
+    1368:	48 8d 35 99 0c 00 00 	lea    0xc99(%rip),%rsi        # 2008 <_IO_stdin_used+0x8>
+    136f:	48 89 df             	mov    %rbx,%rdi
+    1372:	e8 59 00 00 00       	call   13d0 <nel::operator<<(nel::Log&, char const*)>
+    1377:	48 8d 35 94 0c 00 00 	lea    0xc94(%rip),%rsi        # 2012 <_IO_stdin_used+0x12>
+    137e:	48 89 c7             	mov    %rax,%rdi
+    1381:	e8 4a 00 00 00       	call   13d0 <nel::operator<<(nel::Log&, char const*)>
+                    outs << *val.some_;
+    1386:	48 89 df             	mov    %rbx,%rdi
+    1389:	be 01 00 00 00       	mov    $0x1,%esi
+    138e:	e8 dd 00 00 00       	call   1470 <nel::operator<<(nel::Log&, int)>
+                    outs << "))";
+    1393:	48 89 df             	mov    %rbx,%rdi
+    1396:	48 8d 35 7b 0c 00 00 	lea    0xc7b(%rip),%rsi        # 2018 <_IO_stdin_used+0x18>
+    139d:	e8 2e 00 00 00       	call   13d0 <nel::operator<<(nel::Log&, char const*)>
+    nel::log << a.map<bool>([](auto &&) -> bool { return true; }) << '\n';
+    13a2:	48 89 df             	mov    %rbx,%rdi
+    13a5:	be 0a 00 00 00       	mov    $0xa,%esi
+}
+    13aa:	5b                   	pop    %rbx
+    nel::log << a.map<bool>([](auto &&) -> bool { return true; }) << '\n';
+    13ab:	e9 00 00 00 00       	jmp    13b0 <nel::operator<<(nel::Log&, char)>
+
+00000000000013b0 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    13b0:	53                   	push   %rbx
+    13b1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    13b4:	40 0f be fe          	movsbl %sil,%edi
+    13b8:	48 8b 35 81 2c 00 00 	mov    0x2c81(%rip),%rsi        # 4040 <stderr@GLIBC_2.2.5>
+    13bf:	e8 7c fc ff ff       	call   1040 <fputc@plt>
+    return outs;
+}
+    13c4:	48 89 d8             	mov    %rbx,%rax
+    13c7:	5b                   	pop    %rbx
+    13c8:	c3                   	ret
+    13c9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000013d0 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    13d0:	53                   	push   %rbx
+    13d1:	48 89 fb             	mov    %rdi,%rbx
+    13d4:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    13d7:	48 8b 35 62 2c 00 00 	mov    0x2c62(%rip),%rsi        # 4040 <stderr@GLIBC_2.2.5>
+    13de:	e8 4d fc ff ff       	call   1030 <fputs@plt>
+    return outs;
+}
+    13e3:	48 89 d8             	mov    %rbx,%rax
+    13e6:	5b                   	pop    %rbx
+    13e7:	c3                   	ret
+    13e8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    13ef:	00 
+
+00000000000013f0 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    13f0:	53                   	push   %rbx
+    13f1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    13f4:	48 8b 3d 45 2c 00 00 	mov    0x2c45(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+    13fb:	40 0f b6 d6          	movzbl %sil,%edx
+    13ff:	31 c0                	xor    %eax,%eax
+    1401:	48 8d 35 43 0c 00 00 	lea    0xc43(%rip),%rsi        # 204b <_IO_stdin_used+0x4b>
+    1408:	e8 43 fc ff ff       	call   1050 <fprintf@plt>
+    return outs;
+}
+    140d:	48 89 d8             	mov    %rbx,%rax
+    1410:	5b                   	pop    %rbx
+    1411:	c3                   	ret
+    1412:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1419:	00 00 00 00 
+    141d:	0f 1f 00             	nopl   (%rax)
+
+0000000000001420 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    1420:	53                   	push   %rbx
+    1421:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    1424:	48 8b 3d 15 2c 00 00 	mov    0x2c15(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+    142b:	0f b7 d6             	movzwl %si,%edx
+    142e:	31 c0                	xor    %eax,%eax
+    1430:	48 8d 35 14 0c 00 00 	lea    0xc14(%rip),%rsi        # 204b <_IO_stdin_used+0x4b>
+    1437:	e8 14 fc ff ff       	call   1050 <fprintf@plt>
+    return outs;
+}
+    143c:	48 89 d8             	mov    %rbx,%rax
+    143f:	5b                   	pop    %rbx
+    1440:	c3                   	ret
+    1441:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1448:	00 00 00 00 
+    144c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001450 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    1450:	53                   	push   %rbx
+    1451:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    1454:	48 8b 3d e5 2b 00 00 	mov    0x2be5(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+{
+    145b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    145d:	31 c0                	xor    %eax,%eax
+    145f:	48 8d 35 e5 0b 00 00 	lea    0xbe5(%rip),%rsi        # 204b <_IO_stdin_used+0x4b>
+    1466:	e8 e5 fb ff ff       	call   1050 <fprintf@plt>
+    return outs;
+}
+    146b:	48 89 d8             	mov    %rbx,%rax
+    146e:	5b                   	pop    %rbx
+    146f:	c3                   	ret
+
+0000000000001470 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    1470:	53                   	push   %rbx
+    1471:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    1474:	48 8b 3d c5 2b 00 00 	mov    0x2bc5(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+{
+    147b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    147d:	31 c0                	xor    %eax,%eax
+    147f:	48 8d 35 c5 0b 00 00 	lea    0xbc5(%rip),%rsi        # 204b <_IO_stdin_used+0x4b>
+    1486:	e8 c5 fb ff ff       	call   1050 <fprintf@plt>
+    return outs;
+}
+    148b:	48 89 d8             	mov    %rbx,%rax
+    148e:	5b                   	pop    %rbx
+    148f:	c3                   	ret
+
+0000000000001490 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    1490:	53                   	push   %rbx
+    1491:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    1494:	48 8b 3d a5 2b 00 00 	mov    0x2ba5(%rip),%rdi        # 4040 <stderr@GLIBC_2.2.5>
+{
+    149b:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    149e:	31 c0                	xor    %eax,%eax
+    14a0:	48 8d 35 a7 0b 00 00 	lea    0xba7(%rip),%rsi        # 204e <_IO_stdin_used+0x4e>
+    14a7:	e8 a4 fb ff ff       	call   1050 <fprintf@plt>
+    return outs;
+}
+    14ac:	48 89 d8             	mov    %rbx,%rax
+    14af:	5b                   	pop    %rbx
+    14b0:	c3                   	ret
+
+Disassembly of section .fini:
+
+00000000000014b4 <_fini>:
+    14b4:	48 83 ec 08          	sub    $0x8,%rsp
+    14b8:	48 83 c4 08          	add    $0x8,%rsp
+    14bc:	c3                   	ret
@@ -0,0 +1,1569 @@
+
+target/release/examples/largestruct1_rc:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 2f 00 00 	mov    0x2fc5(%rip),%rax        # 3fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 2f 00 00    	push   0x2fca(%rip)        # 3ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 2f 00 00    	jmp    *0x2fcc(%rip)        # 3ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 2f 00 00    	jmp    *0x2fca(%rip)        # 4000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 2f 00 00    	jmp    *0x2fc2(%rip)        # 4008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 2f 00 00    	jmp    *0x2fba(%rip)        # 4010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memset@plt>:
+    1060:	ff 25 b2 2f 00 00    	jmp    *0x2fb2(%rip)        # 4018 <memset@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 2f 00 00    	jmp    *0x2faa(%rip)        # 4020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 2f 00 00    	jmp    *0x2fa2(%rip)        # 4028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 2f 00 00    	jmp    *0x2f9a(%rip)        # 4030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcpy@plt>:
+    10a0:	ff 25 92 2f 00 00    	jmp    *0x2f92(%rip)        # 4038 <memcpy@GLIBC_2.14>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <malloc@plt>:
+    10b0:	ff 25 8a 2f 00 00    	jmp    *0x2f8a(%rip)        # 4040 <malloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <realloc@plt>:
+    10c0:	ff 25 82 2f 00 00    	jmp    *0x2f82(%rip)        # 4048 <realloc@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <memmove@plt>:
+    10d0:	ff 25 7a 2f 00 00    	jmp    *0x2f7a(%rip)        # 4050 <memmove@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010e0 <__cxa_finalize@plt>:
+    10e0:	ff 25 fa 2e 00 00    	jmp    *0x2efa(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10e6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010f0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10f0:	50                   	push   %rax
+    std::abort();
+    10f1:	e8 4a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010f6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10f6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10f7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10fa:	4c 8d 0d 62 0f 00 00 	lea    0xf62(%rip),%r9        # 2063 <_IO_stdin_used+0x63>
+    1101:	31 c0                	xor    %eax,%eax
+    1103:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    1107:	4c 8b 07             	mov    (%rdi),%r8
+    110a:	48 8d 35 58 0f 00 00 	lea    0xf58(%rip),%rsi        # 2069 <_IO_stdin_used+0x69>
+    1111:	48 8b 3d 68 2f 00 00 	mov    0x2f68(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+    1118:	e8 73 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    111d:	e8 1e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001122 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1122:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1126:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1129:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    112d:	31 c0                	xor    %eax,%eax
+    112f:	57                   	push   %rdi
+    1130:	48 8b 3d 49 2f 00 00 	mov    0x2f49(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+    1137:	4c 8d 0d 25 0f 00 00 	lea    0xf25(%rip),%r9        # 2063 <_IO_stdin_used+0x63>
+    113e:	4c 8b 06             	mov    (%rsi),%r8
+    1141:	48 8d 35 32 0f 00 00 	lea    0xf32(%rip),%rsi        # 207a <_IO_stdin_used+0x7a>
+    1148:	e8 43 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    114d:	e8 ee fe ff ff       	call   1040 <abort@plt>
+
+0000000000001152 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1152:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1156:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1159:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    115d:	31 c0                	xor    %eax,%eax
+    115f:	57                   	push   %rdi
+    1160:	48 8b 3d 19 2f 00 00 	mov    0x2f19(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+    1167:	4c 8d 0d 21 0f 00 00 	lea    0xf21(%rip),%r9        # 208f <_IO_stdin_used+0x8f>
+    116e:	4c 8b 06             	mov    (%rsi),%r8
+    1171:	48 8d 35 02 0f 00 00 	lea    0xf02(%rip),%rsi        # 207a <_IO_stdin_used+0x7a>
+    1178:	e8 13 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    117d:	e8 be fe ff ff       	call   1040 <abort@plt>
+    1182:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1189:	00 00 00 
+    118c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001190 <main>:
+    RC1 rc1((uint8_t)0x67);
+
+    nel::log << rc1 << '\n';
+}
+
+int main() {}
+    1190:	31 c0                	xor    %eax,%eax
+    1192:	c3                   	ret
+    1193:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    119a:	00 00 00 
+    119d:	0f 1f 00             	nopl   (%rax)
+
+00000000000011a0 <_start>:
+    11a0:	31 ed                	xor    %ebp,%ebp
+    11a2:	49 89 d1             	mov    %rdx,%r9
+    11a5:	5e                   	pop    %rsi
+    11a6:	48 89 e2             	mov    %rsp,%rdx
+    11a9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    11ad:	50                   	push   %rax
+    11ae:	54                   	push   %rsp
+    11af:	45 31 c0             	xor    %r8d,%r8d
+    11b2:	31 c9                	xor    %ecx,%ecx
+    11b4:	48 8d 3d d5 ff ff ff 	lea    -0x2b(%rip),%rdi        # 1190 <main>
+    11bb:	ff 15 ff 2d 00 00    	call   *0x2dff(%rip)        # 3fc0 <__libc_start_main@GLIBC_2.34>
+    11c1:	f4                   	hlt
+    11c2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    11c9:	00 00 00 
+    11cc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000000011d0 <deregister_tm_clones>:
+    11d0:	    48 8d 3d 91 2e 00 00 	lea    0x2e91(%rip),%rdi        # 4068 <__TMC_END__>
+    11d7:	    48 8d 05 8a 2e 00 00 	lea    0x2e8a(%rip),%rax        # 4068 <__TMC_END__>
+    11de:	    48 39 f8             	cmp    %rdi,%rax
+    11e1:	/-- 74 15                	je     11f8 <deregister_tm_clones+0x28>
+    11e3:	|   48 8b 05 de 2d 00 00 	mov    0x2dde(%rip),%rax        # 3fc8 <_ITM_deregisterTMCloneTable@Base>
+    11ea:	|   48 85 c0             	test   %rax,%rax
+    11ed:	+-- 74 09                	je     11f8 <deregister_tm_clones+0x28>
+    11ef:	|   ff e0                	jmp    *%rax
+    11f1:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    11f8:	\-> c3                   	ret
+    11f9:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001200 <register_tm_clones>:
+    1200:	    48 8d 3d 61 2e 00 00 	lea    0x2e61(%rip),%rdi        # 4068 <__TMC_END__>
+    1207:	    48 8d 35 5a 2e 00 00 	lea    0x2e5a(%rip),%rsi        # 4068 <__TMC_END__>
+    120e:	    48 29 fe             	sub    %rdi,%rsi
+    1211:	    48 89 f0             	mov    %rsi,%rax
+    1214:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1218:	    48 c1 f8 03          	sar    $0x3,%rax
+    121c:	    48 01 c6             	add    %rax,%rsi
+    121f:	    48 d1 fe             	sar    %rsi
+    1222:	/-- 74 14                	je     1238 <register_tm_clones+0x38>
+    1224:	|   48 8b 05 ad 2d 00 00 	mov    0x2dad(%rip),%rax        # 3fd8 <_ITM_registerTMCloneTable@Base>
+    122b:	|   48 85 c0             	test   %rax,%rax
+    122e:	+-- 74 08                	je     1238 <register_tm_clones+0x38>
+    1230:	|   ff e0                	jmp    *%rax
+    1232:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1238:	\-> c3                   	ret
+    1239:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001240 <__do_global_dtors_aux>:
+    1240:	       f3 0f 1e fa          	endbr64
+    1244:	       80 3d 3d 2e 00 00 00 	cmpb   $0x0,0x2e3d(%rip)        # 4088 <completed.0>
+    124b:	/----- 75 2b                	jne    1278 <__do_global_dtors_aux+0x38>
+    124d:	|      55                   	push   %rbp
+    124e:	|      48 83 3d 8a 2d 00 00 	cmpq   $0x0,0x2d8a(%rip)        # 3fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1255:	|      00 
+    1256:	|      48 89 e5             	mov    %rsp,%rbp
+    1259:	|  /-- 74 0c                	je     1267 <__do_global_dtors_aux+0x27>
+    125b:	|  |   48 8b 3d fe 2d 00 00 	mov    0x2dfe(%rip),%rdi        # 4060 <__dso_handle>
+    1262:	|  |   e8 79 fe ff ff       	call   10e0 <__cxa_finalize@plt>
+    1267:	|  \-> e8 64 ff ff ff       	call   11d0 <deregister_tm_clones>
+    126c:	|      c6 05 15 2e 00 00 01 	movb   $0x1,0x2e15(%rip)        # 4088 <completed.0>
+    1273:	|      5d                   	pop    %rbp
+    1274:	|      c3                   	ret
+    1275:	|      0f 1f 00             	nopl   (%rax)
+    1278:	\----> c3                   	ret
+    1279:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001280 <frame_dummy>:
+    1280:	f3 0f 1e fa          	endbr64
+    1284:	e9 77 ff ff ff       	jmp    1200 <register_tm_clones>
+    1289:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001290 <_close_r>:
+#include <nel/memory.hh> // move()
+    1290:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1295:	c3                   	ret
+    1296:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    129d:	00 00 00 
+
+00000000000012a0 <_fstat_r>:
+
+    12a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12a5:	c3                   	ret
+    12a6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12ad:	00 00 00 
+
+00000000000012b0 <_kill_r>:
+nel::Log &operator<<(nel::Log &outs, RC1 const &v)
+    12b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12b5:	c3                   	ret
+    12b6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12bd:	00 00 00 
+
+00000000000012c0 <_lseek_r>:
+    outs << "RC1()";
+    12c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12c5:	c3                   	ret
+    12c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12cd:	00 00 00 
+
+00000000000012d0 <_read_r>:
+    return outs;
+    12d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12d5:	c3                   	ret
+    12d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12dd:	00 00 00 
+
+00000000000012e0 <_write_r>:
+    U8Buf<256> v = U8Buf<256>((uint8_t)0x66);
+    12e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12e5:	c3                   	ret
+    12e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12ed:	00 00 00 
+
+00000000000012f0 <_getpid_r>:
+    nel::log << rc1 << '\n';
+    12f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12f5:	c3                   	ret
+    12f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12fd:	00 00 00 
+
+0000000000001300 <_isatty_r>:
+}
+    1300:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1305:	c3                   	ret
+    1306:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    130d:	00 00 00 
+
+0000000000001310 <operator<<(nel::Log&, nel::heaped::RC<U8Buf<256ul>, nel::heaped::Malloc> const&)>:
+{
+    1310:	53                   	push   %rbx
+    outs << "RC1()";
+    1311:	48 8d 35 ec 0c 00 00 	lea    0xcec(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+{
+    1318:	48 89 fb             	mov    %rdi,%rbx
+    outs << "RC1()";
+    131b:	e8 90 0a 00 00       	call   1db0 <nel::operator<<(nel::Log&, char const*)>
+}
+    1320:	48 89 d8             	mov    %rbx,%rax
+    1323:	5b                   	pop    %rbx
+    1324:	c3                   	ret
+    1325:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    132c:	00 00 00 00 
+
+0000000000001330 <rc1()>:
+{
+    1330:	          41 55                	push   %r13
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+        {
+            nel::elem::set(data_, f, N);
+    1332:	          ba 00 01 00 00       	mov    $0x100,%edx
+    1337:	          be 66 00 00 00       	mov    $0x66,%esi
+    133c:	          41 54                	push   %r12
+    133e:	          55                   	push   %rbp
+    133f:	          53                   	push   %rbx
+    1340:	          48 81 ec 28 01 00 00 	sub    $0x128,%rsp
+    1347:	          48 8d 6c 24 20       	lea    0x20(%rsp),%rbp
+    134c:	          48 89 ef             	mov    %rbp,%rdi
+    134f:	          e8 cc 01 00 00       	call   1520 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            if (align == 0 || (align & (align - 1)) != 0) {
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+            }
+            void *const new_p = is_over_aligned(align)
+                                    ? realloc_aligned(p, align, old_size, new_size)
+                                    : std::realloc(p, new_size);
+    1354:	          bf 10 01 00 00       	mov    $0x110,%edi
+    1359:	          e8 52 fd ff ff       	call   10b0 <malloc@plt>
+            if (new_p == nullptr) {
+    135e:	          48 85 c0             	test   %rax,%rax
+    1361:	   /----- 74 6d                	je     13d0 <rc1()+0xa0>
+                // constexpr Node(void) = delete;
+
+                template<typename... Args>
+                constexpr Node(Args &&...args)
+                    : n_refs_(1)
+                    , has_value_(true)
+    1363:	   |      c6 40 08 01          	movb   $0x1,0x8(%rax)
+            nel::elem::move(data_, o.data_, N);
+    1367:	   |      4c 8d 68 09          	lea    0x9(%rax),%r13
+    136b:	   |      ba 00 01 00 00       	mov    $0x100,%edx
+    1370:	   |      48 89 ee             	mov    %rbp,%rsi
+                    : n_refs_(1)
+    1373:	   |      48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+    137a:	   |      4c 89 ef             	mov    %r13,%rdi
+    outs << "RC1()";
+    137d:	   |      4c 8d 25 05 2d 00 00 	lea    0x2d05(%rip),%r12        # 4089 <nel::log>
+    1384:	   |      48 89 c3             	mov    %rax,%rbx
+    1387:	   |      e8 a4 01 00 00       	call   1530 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+    138c:	   |      48 8d 35 71 0c 00 00 	lea    0xc71(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    1393:	   |      4c 89 e7             	mov    %r12,%rdi
+    1396:	   |      e8 15 0a 00 00       	call   1db0 <nel::operator<<(nel::Log&, char const*)>
+    nel::log << rc1 << '\n';
+    139b:	   |      be 0a 00 00 00       	mov    $0xa,%esi
+    13a0:	   |      4c 89 e7             	mov    %r12,%rdi
+    13a3:	   |      e8 e8 09 00 00       	call   1d90 <nel::operator<<(nel::Log&, char)>
+                }
+
+                constexpr static void release(Node *const v)
+                {
+                    if (v != nullptr) {
+                        v->n_refs_ -= 1;
+    13a8:	   |      48 83 2b 01          	subq   $0x1,(%rbx)
+                        if (v->n_refs_ == 0) {
+    13ac:	   |  /-- 74 62                	je     1410 <rc1()+0xe0>
+            nel::elem::set(data_, 0xa5, N);
+    13ae:	/--|--|-> 48 89 ef             	mov    %rbp,%rdi
+    13b1:	|  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    13b6:	|  |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    13bb:	|  |  |   e8 60 01 00 00       	call   1520 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    13c0:	|  |  |   48 81 c4 28 01 00 00 	add    $0x128,%rsp
+    13c7:	|  |  |   5b                   	pop    %rbx
+    13c8:	|  |  |   5d                   	pop    %rbp
+    13c9:	|  |  |   41 5c                	pop    %r12
+    13cb:	|  |  |   41 5d                	pop    %r13
+    13cd:	|  |  |   c3                   	ret
+    13ce:	|  |  |   66 90                	xchg   %ax,%ax
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    13d0:	|  \--|-> 48 8d 05 47 0c 00 00 	lea    0xc47(%rip),%rax        # 201e <_IO_stdin_used+0x1e>
+    13d7:	|     |   48 8d 0d 2c 0c 00 00 	lea    0xc2c(%rip),%rcx        # 200a <_IO_stdin_used+0xa>
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx = Context());
+
+inline void panic_if(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (pred) { panic(msg, ctx); }
+    13de:	|     |   48 89 e6             	mov    %rsp,%rsi
+            , line_num_(line_num)
+    13e1:	|     |   c7 44 24 10 4c 00 00 	movl   $0x4c,0x10(%rsp)
+    13e8:	|     |   00 
+            : fn_name_(fn_name)
+    13e9:	|     |   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    13ee:	|     |   66 48 0f 6e c8       	movq   %rax,%xmm1
+    if (pred) { panic(msg, ctx); }
+    13f3:	|     |   48 8d 3d 39 0c 00 00 	lea    0xc39(%rip),%rdi        # 2033 <_IO_stdin_used+0x33>
+            : fn_name_(fn_name)
+    13fa:	|     |   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    13fe:	|     |   0f 29 04 24          	movaps %xmm0,(%rsp)
+    if (pred) { panic(msg, ctx); }
+    1402:	|     |   e8 1b fd ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1407:	|     |   66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    140e:	|     |   00 00 
+    1410:	|     \-> 4c 89 ef             	mov    %r13,%rdi
+    1413:	|         ba 00 01 00 00       	mov    $0x100,%edx
+    1418:	|         be a5 00 00 00       	mov    $0xa5,%esi
+    141d:	|         e8 fe 00 00 00       	call   1520 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    1422:	|         48 89 df             	mov    %rbx,%rdi
+    1425:	|         e8 06 fc ff ff       	call   1030 <free@plt>
+    142a:	\-------- eb 82                	jmp    13ae <rc1()+0x7e>
+    142c:	          0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001430 <rc2()>:
+{
+    1430:	       41 54                	push   %r12
+                                    : std::realloc(p, new_size);
+    1432:	       bf 10 01 00 00       	mov    $0x110,%edi
+    1437:	       55                   	push   %rbp
+    1438:	       53                   	push   %rbx
+    1439:	       48 83 ec 20          	sub    $0x20,%rsp
+    143d:	       e8 6e fc ff ff       	call   10b0 <malloc@plt>
+            if (new_p == nullptr) {
+    1442:	       48 85 c0             	test   %rax,%rax
+    1445:	/----- 74 59                	je     14a0 <rc2()+0x70>
+                    , has_value_(true)
+    1447:	|      c6 40 08 01          	movb   $0x1,0x8(%rax)
+            nel::elem::set(data_, f, N);
+    144b:	|      4c 8d 60 09          	lea    0x9(%rax),%r12
+    144f:	|      ba 00 01 00 00       	mov    $0x100,%edx
+    1454:	|      48 89 c3             	mov    %rax,%rbx
+                    : n_refs_(1)
+    1457:	|      48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+    145e:	|      be 67 00 00 00       	mov    $0x67,%esi
+    1463:	|      4c 89 e7             	mov    %r12,%rdi
+    outs << "RC1()";
+    1466:	|      48 8d 2d 1c 2c 00 00 	lea    0x2c1c(%rip),%rbp        # 4089 <nel::log>
+    146d:	|      e8 ae 00 00 00       	call   1520 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1472:	|      48 8d 35 8b 0b 00 00 	lea    0xb8b(%rip),%rsi        # 2004 <_IO_stdin_used+0x4>
+    1479:	|      48 89 ef             	mov    %rbp,%rdi
+    147c:	|      e8 2f 09 00 00       	call   1db0 <nel::operator<<(nel::Log&, char const*)>
+    nel::log << rc1 << '\n';
+    1481:	|      be 0a 00 00 00       	mov    $0xa,%esi
+    1486:	|      48 89 ef             	mov    %rbp,%rdi
+    1489:	|      e8 02 09 00 00       	call   1d90 <nel::operator<<(nel::Log&, char)>
+                        v->n_refs_ -= 1;
+    148e:	|      48 83 2b 01          	subq   $0x1,(%rbx)
+                        if (v->n_refs_ == 0) {
+    1492:	|  /-- 74 4c                	je     14e0 <rc2()+0xb0>
+}
+    1494:	|  |   48 83 c4 20          	add    $0x20,%rsp
+    1498:	|  |   5b                   	pop    %rbx
+    1499:	|  |   5d                   	pop    %rbp
+    149a:	|  |   41 5c                	pop    %r12
+    149c:	|  |   c3                   	ret
+    149d:	|  |   0f 1f 00             	nopl   (%rax)
+            : fn_name_(fn_name)
+    14a0:	\--|-> 48 8d 05 77 0b 00 00 	lea    0xb77(%rip),%rax        # 201e <_IO_stdin_used+0x1e>
+    14a7:	   |   48 8d 0d 9f 0b 00 00 	lea    0xb9f(%rip),%rcx        # 204d <_IO_stdin_used+0x4d>
+    if (pred) { panic(msg, ctx); }
+    14ae:	   |   48 89 e6             	mov    %rsp,%rsi
+            , line_num_(line_num)
+    14b1:	   |   c7 44 24 10 4c 00 00 	movl   $0x4c,0x10(%rsp)
+    14b8:	   |   00 
+            : fn_name_(fn_name)
+    14b9:	   |   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    14be:	   |   66 48 0f 6e c8       	movq   %rax,%xmm1
+    if (pred) { panic(msg, ctx); }
+    14c3:	   |   48 8d 3d 69 0b 00 00 	lea    0xb69(%rip),%rdi        # 2033 <_IO_stdin_used+0x33>
+            : fn_name_(fn_name)
+    14ca:	   |   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    14ce:	   |   0f 29 04 24          	movaps %xmm0,(%rsp)
+    if (pred) { panic(msg, ctx); }
+    14d2:	   |   e8 4b fc ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    14d7:	   |   66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    14de:	   |   00 00 
+            nel::elem::set(data_, 0xa5, N);
+    14e0:	   \-> 4c 89 e7             	mov    %r12,%rdi
+    14e3:	       ba 00 01 00 00       	mov    $0x100,%edx
+    14e8:	       be a5 00 00 00       	mov    $0xa5,%esi
+    14ed:	       e8 2e 00 00 00       	call   1520 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    14f2:	       48 83 c4 20          	add    $0x20,%rsp
+                std::free(p);
+    14f6:	       48 89 df             	mov    %rbx,%rdi
+    14f9:	       5b                   	pop    %rbx
+    14fa:	       5d                   	pop    %rbp
+    14fb:	       41 5c                	pop    %r12
+    14fd:	       e9 2e fb ff ff       	jmp    1030 <free@plt>
+    1502:	       66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1509:	       00 00 00 
+    150c:	       0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001510 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    1510:	e9 8b fb ff ff       	jmp    10a0 <memcpy@plt>
+    1515:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    151c:	00 00 00 00 
+
+0000000000001520 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    1520:	40 0f b6 f6          	movzbl %sil,%esi
+    1524:	e9 37 fb ff ff       	jmp    1060 <memset@plt>
+    1529:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001530 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+}
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    1530:	e9 6b fb ff ff       	jmp    10a0 <memcpy@plt>
+    1535:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    153c:	00 00 00 00 
+
+0000000000001540 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    1540:	e9 8b fb ff ff       	jmp    10d0 <memmove@plt>
+    1545:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    154c:	00 00 00 00 
+
+0000000000001550 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    1550:	48 89 f2             	mov    %rsi,%rdx
+    std::memset(d, s, n);
+    1553:	be a5 00 00 00       	mov    $0xa5,%esi
+    1558:	e9 03 fb ff ff       	jmp    1060 <memset@plt>
+    155d:	0f 1f 00             	nopl   (%rax)
+
+0000000000001560 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+    set(d, 0xa5, n);
+}
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1560:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    1564:	e8 17 fb ff ff       	call   1080 <memcmp@plt>
+    1569:	85 c0                	test   %eax,%eax
+    156b:	0f 94 c0             	sete   %al
+}
+    156e:	48 83 c4 08          	add    $0x8,%rsp
+    1572:	c3                   	ret
+    1573:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    157a:	00 00 00 00 
+    157e:	66 90                	xchg   %ax,%ax
+
+0000000000001580 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1580:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    1584:	e8 f7 fa ff ff       	call   1080 <memcmp@plt>
+    1589:	85 c0                	test   %eax,%eax
+    158b:	0f 95 c0             	setne  %al
+}
+    158e:	48 83 c4 08          	add    $0x8,%rsp
+    1592:	c3                   	ret
+    1593:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    159a:	00 00 00 00 
+    159e:	66 90                	xchg   %ax,%ax
+
+00000000000015a0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    if (n < streaming_min) {
+    15a0:	                48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    15a7:	/-------------- 0f 86 d7 00 00 00    	jbe    1684 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xe4>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    15ad:	|               48 89 f9             	mov    %rdi,%rcx
+{
+    15b0:	|               53                   	push   %rbx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    15b1:	|               48 f7 d9             	neg    %rcx
+    15b4:	|               83 e1 0f             	and    $0xf,%ecx
+    std::memcpy(d, s, n);
+    15b7:	|               83 f9 08             	cmp    $0x8,%ecx
+    15ba:	|     /-------- 0f 82 d0 00 00 00    	jb     1690 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xf0>
+    15c0:	|     |         48 8b 06             	mov    (%rsi),%rax
+    15c3:	|     |         4c 8d 57 08          	lea    0x8(%rdi),%r10
+    15c7:	|     |         48 89 f3             	mov    %rsi,%rbx
+    15ca:	|     |         49 83 e2 f8          	and    $0xfffffffffffffff8,%r10
+    15ce:	|     |         48 89 07             	mov    %rax,(%rdi)
+    15d1:	|     |         48 8b 44 0e f8       	mov    -0x8(%rsi,%rcx,1),%rax
+    15d6:	|     |         48 89 44 0f f8       	mov    %rax,-0x8(%rdi,%rcx,1)
+    15db:	|     |         48 89 f8             	mov    %rdi,%rax
+    15de:	|     |         4c 29 d0             	sub    %r10,%rax
+    15e1:	|     |         48 29 c3             	sub    %rax,%rbx
+    15e4:	|     |         01 c8                	add    %ecx,%eax
+    15e6:	|     |         83 e0 f8             	and    $0xfffffff8,%eax
+    15e9:	|     |         83 f8 08             	cmp    $0x8,%eax
+    15ec:	|  /--|-------- 72 1a                	jb     1608 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    15ee:	|  |  |         83 e0 f8             	and    $0xfffffff8,%eax
+    15f1:	|  |  |         45 31 c0             	xor    %r8d,%r8d
+    15f4:	|  |  |     /-> 45 89 c1             	mov    %r8d,%r9d
+    15f7:	|  |  |     |   41 83 c0 08          	add    $0x8,%r8d
+    15fb:	|  |  |     |   4e 8b 1c 0b          	mov    (%rbx,%r9,1),%r11
+    15ff:	|  |  |     |   4f 89 1c 0a          	mov    %r11,(%r10,%r9,1)
+    1603:	|  |  |     |   41 39 c0             	cmp    %eax,%r8d
+    1606:	|  |  |     \-- 72 ec                	jb     15f4 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x54>
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1608:	|  >--|-------> 48 8d 41 40          	lea    0x40(%rcx),%rax
+    160c:	|  |  |         48 01 f9             	add    %rdi,%rcx
+    160f:	|  |  |         90                   	nop
+    std::memcpy(&v, s, sizeof(v));
+    1610:	|  |  |     /-> f3 0f 6f 54 06 d0    	movdqu -0x30(%rsi,%rax,1),%xmm2
+    1616:	|  |  |     |   f3 0f 6f 4c 06 e0    	movdqu -0x20(%rsi,%rax,1),%xmm1
+    161c:	|  |  |     |   49 89 c0             	mov    %rax,%r8
+    for (; i + 64 <= n; i += 64) {
+    161f:	|  |  |     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1623:	|  |  |     |   f3 0f 6f 44 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1629:	|  |  |     |   f3 0f 6f 5c 06 c0    	movdqu -0x40(%rsi,%rax,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    162f:	|  |  |     |   48 83 c0 40          	add    $0x40,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1633:	|  |  |     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    1638:	|  |  |     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    163d:	|  |  |     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    1642:	|  |  |     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    1647:	|  |  |     |   48 39 c2             	cmp    %rax,%rdx
+    164a:	|  |  |     \-- 73 c4                	jae    1610 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x70>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    164c:	|  |  |         49 8d 40 10          	lea    0x10(%r8),%rax
+    1650:	|  |  |         48 39 c2             	cmp    %rax,%rdx
+    1653:	|  |  |  /----- 72 22                	jb     1677 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd7>
+    1655:	|  |  |  |      48 8d 4f f0          	lea    -0x10(%rdi),%rcx
+    1659:	|  |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1660:	|  |  |  |  /-> f3 0f 6f 64 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm4
+    1666:	|  |  |  |  |   49 89 c0             	mov    %rax,%r8
+    1669:	|  |  |  |  |   66 0f e7 24 01       	movntdq %xmm4,(%rcx,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    166e:	|  |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    1672:	|  |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    1675:	|  |  |  |  \-- 73 e9                	jae    1660 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc0>
+        stream16(d + i, load16(s + i));
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    1677:	|  |  |  \----> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    167a:	|  |  |         4c 01 c7             	add    %r8,%rdi
+    167d:	|  |  |         4c 29 c2             	sub    %r8,%rdx
+    1680:	|  |  |         4c 01 c6             	add    %r8,%rsi
+}
+    1683:	|  |  |         5b                   	pop    %rbx
+    std::memcpy(d, s, n);
+    1684:	\--|--|-------> e9 17 fa ff ff       	jmp    10a0 <memcpy@plt>
+    1689:	   |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1690:	   |  \-------> f6 c1 04             	test   $0x4,%cl
+    1693:	   |        /-- 75 25                	jne    16ba <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x11a>
+    1695:	   |        |   85 c9                	test   %ecx,%ecx
+    1697:	   +--------|-- 0f 84 6b ff ff ff    	je     1608 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    169d:	   |        |   0f b6 06             	movzbl (%rsi),%eax
+    16a0:	   |        |   88 07                	mov    %al,(%rdi)
+    16a2:	   |        |   f6 c1 02             	test   $0x2,%cl
+    16a5:	   +--------|-- 0f 84 5d ff ff ff    	je     1608 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    16ab:	   |        |   0f b7 44 0e fe       	movzwl -0x2(%rsi,%rcx,1),%eax
+    16b0:	   |        |   66 89 44 0f fe       	mov    %ax,-0x2(%rdi,%rcx,1)
+    16b5:	   +--------|-- e9 4e ff ff ff       	jmp    1608 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    16ba:	   |        \-> 8b 06                	mov    (%rsi),%eax
+    16bc:	   |            89 07                	mov    %eax,(%rdi)
+    16be:	   |            8b 44 0e fc          	mov    -0x4(%rsi,%rcx,1),%eax
+    16c2:	   |            89 44 0f fc          	mov    %eax,-0x4(%rdi,%rcx,1)
+    16c6:	   \----------- e9 3d ff ff ff       	jmp    1608 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    16cb:	                0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+00000000000016d0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    16d0:	                                           49 89 f8             	mov    %rdi,%r8
+    16d3:	                                           48 89 f1             	mov    %rsi,%rcx
+    if (n < streaming_min) {
+    16d6:	                                           48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    16dd:	                              /----------- 0f 86 85 03 00 00    	jbe    1a68 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x398>
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    16e3:	                              |            48 89 fe             	mov    %rdi,%rsi
+{
+    16e6:	                              |            41 57                	push   %r15
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    16e8:	                              |            48 f7 de             	neg    %rsi
+{
+    16eb:	                              |            41 56                	push   %r14
+    for (Index i = 0; i < head; ++i) {
+    16ed:	                              |            48 89 f0             	mov    %rsi,%rax
+{
+    16f0:	                              |            41 55                	push   %r13
+    16f2:	                              |            41 54                	push   %r12
+    16f4:	                              |            55                   	push   %rbp
+    16f5:	                              |            53                   	push   %rbx
+    for (Index i = 0; i < head; ++i) {
+    16f6:	                              |            83 e0 0f             	and    $0xf,%eax
+    16f9:	/-----------------------------|----------- 0f 84 01 01 00 00    	je     1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    16ff:	|                             |            48 8d 78 ff          	lea    -0x1(%rax),%rdi
+    1703:	|                             |            48 83 ff 02          	cmp    $0x2,%rdi
+    1707:	|  /--------------------------|----------- 0f 86 8a 04 00 00    	jbe    1b97 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4c7>
+    170d:	|  |                          |            4c 8d 51 01          	lea    0x1(%rcx),%r10
+    1711:	|  |                          |            4d 89 c1             	mov    %r8,%r9
+    1714:	|  |                          |            4d 29 d1             	sub    %r10,%r9
+    1717:	|  |                          |            49 83 f9 06          	cmp    $0x6,%r9
+    171b:	|  |                          |  /-------- 0f 87 c7 02 00 00    	ja     19e8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x318>
+        d[i] = p[i];
+    1721:	|  |                          |  |         0f b6 39             	movzbl (%rcx),%edi
+    1724:	|  |                          |  |         41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1727:	|  |                          |  |         40 f6 c6 0e          	test   $0xe,%sil
+    172b:	+--|--------------------------|--|-------- 0f 84 cf 00 00 00    	je     1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1731:	|  |                          |  |         0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    1735:	|  |                          |  |         41 88 78 01          	mov    %dil,0x1(%r8)
+    1739:	|  |  /-----------------------|--|-------> 0f b6 79 02          	movzbl 0x2(%rcx),%edi
+    173d:	|  |  |                       |  |         41 88 78 02          	mov    %dil,0x2(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1741:	|  |  |                       |  |         40 f6 c6 0c          	test   $0xc,%sil
+    1745:	+--|--|-----------------------|--|-------- 0f 84 b5 00 00 00    	je     1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    174b:	|  |  |                       |  |         0f b6 79 03          	movzbl 0x3(%rcx),%edi
+    174f:	|  |  |                       |  |         41 88 78 03          	mov    %dil,0x3(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1753:	|  |  |                       |  |         48 83 f8 04          	cmp    $0x4,%rax
+    1757:	+--|--|-----------------------|--|-------- 0f 86 a3 00 00 00    	jbe    1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    175d:	|  |  |                       |  |         0f b6 79 04          	movzbl 0x4(%rcx),%edi
+    1761:	|  |  |                       |  |         41 88 78 04          	mov    %dil,0x4(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1765:	|  |  |                       |  |         48 83 f8 05          	cmp    $0x5,%rax
+    1769:	+--|--|-----------------------|--|-------- 0f 84 91 00 00 00    	je     1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    176f:	|  |  |                       |  |         0f b6 79 05          	movzbl 0x5(%rcx),%edi
+    1773:	|  |  |                       |  |         41 88 78 05          	mov    %dil,0x5(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1777:	|  |  |                       |  |         48 83 f8 06          	cmp    $0x6,%rax
+    177b:	+--|--|-----------------------|--|-------- 0f 84 7f 00 00 00    	je     1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1781:	|  |  |                       |  |         0f b6 79 06          	movzbl 0x6(%rcx),%edi
+    for (Index i = 0; i < head; ++i) {
+    1785:	|  |  |                       |  |         83 e6 08             	and    $0x8,%esi
+        d[i] = p[i];
+    1788:	|  |  |                       |  |         41 88 78 06          	mov    %dil,0x6(%r8)
+    for (Index i = 0; i < head; ++i) {
+    178c:	+--|--|-----------------------|--|-------- 74 72                	je     1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    178e:	|  |  |                       |  |         0f b6 71 07          	movzbl 0x7(%rcx),%esi
+    1792:	|  |  |                       |  |         41 88 70 07          	mov    %sil,0x7(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1796:	|  |  |                       |  |         48 83 f8 08          	cmp    $0x8,%rax
+    179a:	+--|--|-----------------------|--|-------- 76 64                	jbe    1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    179c:	|  |  |                       |  |         0f b6 71 08          	movzbl 0x8(%rcx),%esi
+    17a0:	|  |  |                       |  |         41 88 70 08          	mov    %sil,0x8(%r8)
+    for (Index i = 0; i < head; ++i) {
+    17a4:	|  |  |                       |  |         48 83 f8 09          	cmp    $0x9,%rax
+    17a8:	+--|--|-----------------------|--|-------- 74 56                	je     1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    17aa:	|  |  |                       |  |         0f b6 71 09          	movzbl 0x9(%rcx),%esi
+    17ae:	|  |  |                       |  |         41 88 70 09          	mov    %sil,0x9(%r8)
+    for (Index i = 0; i < head; ++i) {
+    17b2:	|  |  |                       |  |         48 83 f8 0a          	cmp    $0xa,%rax
+    17b6:	+--|--|-----------------------|--|-------- 74 48                	je     1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    17b8:	|  |  |                       |  |         0f b6 71 0a          	movzbl 0xa(%rcx),%esi
+    17bc:	|  |  |                       |  |         41 88 70 0a          	mov    %sil,0xa(%r8)
+    for (Index i = 0; i < head; ++i) {
+    17c0:	|  |  |                       |  |         48 83 f8 0b          	cmp    $0xb,%rax
+    17c4:	+--|--|-----------------------|--|-------- 74 3a                	je     1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    17c6:	|  |  |                       |  |         0f b6 71 0b          	movzbl 0xb(%rcx),%esi
+    17ca:	|  |  |                       |  |         41 88 70 0b          	mov    %sil,0xb(%r8)
+    for (Index i = 0; i < head; ++i) {
+    17ce:	|  |  |                       |  |         48 83 f8 0c          	cmp    $0xc,%rax
+    17d2:	+--|--|-----------------------|--|-------- 74 2c                	je     1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    17d4:	|  |  |                       |  |         0f b6 71 0c          	movzbl 0xc(%rcx),%esi
+    17d8:	|  |  |                       |  |         41 88 70 0c          	mov    %sil,0xc(%r8)
+    for (Index i = 0; i < head; ++i) {
+    17dc:	|  |  |                       |  |         48 83 f8 0d          	cmp    $0xd,%rax
+    17e0:	+--|--|-----------------------|--|-------- 74 1e                	je     1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    17e2:	|  |  |                       |  |         0f b6 71 0d          	movzbl 0xd(%rcx),%esi
+    17e6:	|  |  |                       |  |         41 88 70 0d          	mov    %sil,0xd(%r8)
+    for (Index i = 0; i < head; ++i) {
+    17ea:	|  |  |                       |  |         49 8d 70 ff          	lea    -0x1(%r8),%rsi
+    17ee:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    17f1:	+--|--|-----------------------|--|-------- 75 0d                	jne    1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    17f3:	|  |  |                       |  |         0f b6 71 0e          	movzbl 0xe(%rcx),%esi
+    17f7:	|  |  |                       |  |         41 88 70 0e          	mov    %sil,0xe(%r8)
+    for (Index i = 0; i < head; ++i) {
+    17fb:	|  |  |                       |  |         0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+        rotated[i] = p[(head + i) % 16];
+    1800:	>--|--|-----------------------|--|-------> 48 8d 70 07          	lea    0x7(%rax),%rsi
+    1804:	|  |  |                       |  |         4c 8d 78 06          	lea    0x6(%rax),%r15
+    1808:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    180b:	|  |  |                       |  |         4c 8d 70 05          	lea    0x5(%rax),%r14
+    180f:	|  |  |                       |  |         4c 8d 68 04          	lea    0x4(%rax),%r13
+    1813:	|  |  |                       |  |         41 83 e7 0f          	and    $0xf,%r15d
+    std::memcpy(&v, s, sizeof(v));
+    1817:	|  |  |                       |  |         0f b6 34 31          	movzbl (%rcx,%rsi,1),%esi
+        rotated[i] = p[(head + i) % 16];
+    181b:	|  |  |                       |  |         41 83 e6 0f          	and    $0xf,%r14d
+    181f:	|  |  |                       |  |         41 83 e5 0f          	and    $0xf,%r13d
+    1823:	|  |  |                       |  |         4c 8d 60 03          	lea    0x3(%rax),%r12
+    std::memcpy(&v, s, sizeof(v));
+    1827:	|  |  |                       |  |         46 0f b6 3c 39       	movzbl (%rcx,%r15,1),%r15d
+    182c:	|  |  |                       |  |         46 0f b6 34 31       	movzbl (%rcx,%r14,1),%r14d
+        rotated[i] = p[(head + i) % 16];
+    1831:	|  |  |                       |  |         48 8d 78 08          	lea    0x8(%rax),%rdi
+    1835:	|  |  |                       |  |         41 83 e4 0f          	and    $0xf,%r12d
+    std::memcpy(&v, s, sizeof(v));
+    1839:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    183d:	|  |  |                       |  |         46 0f b6 2c 29       	movzbl (%rcx,%r13,1),%r13d
+        rotated[i] = p[(head + i) % 16];
+    1842:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    1845:	|  |  |                       |  |         48 8d 68 02          	lea    0x2(%rax),%rbp
+    std::memcpy(&v, s, sizeof(v));
+    1849:	|  |  |                       |  |         4c 09 fe             	or     %r15,%rsi
+        rotated[i] = p[(head + i) % 16];
+    184c:	|  |  |                       |  |         48 89 7c 24 c8       	mov    %rdi,-0x38(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    1851:	|  |  |                       |  |         46 0f b6 24 21       	movzbl (%rcx,%r12,1),%r12d
+        rotated[i] = p[(head + i) % 16];
+    1856:	|  |  |                       |  |         83 e5 0f             	and    $0xf,%ebp
+    std::memcpy(&v, s, sizeof(v));
+    1859:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    185d:	|  |  |                       |  |         48 8d 78 09          	lea    0x9(%rax),%rdi
+    std::memcpy(&v, s, sizeof(v));
+    1861:	|  |  |                       |  |         0f b6 2c 29          	movzbl (%rcx,%rbp,1),%ebp
+        rotated[i] = p[(head + i) % 16];
+    1865:	|  |  |                       |  |         48 8d 58 01          	lea    0x1(%rax),%rbx
+    std::memcpy(&v, s, sizeof(v));
+    1869:	|  |  |                       |  |         4c 09 f6             	or     %r14,%rsi
+        rotated[i] = p[(head + i) % 16];
+    186c:	|  |  |                       |  |         49 89 fb             	mov    %rdi,%r11
+    186f:	|  |  |                       |  |         48 8d 78 0a          	lea    0xa(%rax),%rdi
+    1873:	|  |  |                       |  |         83 e3 0f             	and    $0xf,%ebx
+    std::memcpy(&v, s, sizeof(v));
+    1876:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    187a:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    187e:	|  |  |                       |  |         49 89 fa             	mov    %rdi,%r10
+    std::memcpy(&v, s, sizeof(v));
+    1881:	|  |  |                       |  |         4c 09 ee             	or     %r13,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1884:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    1888:	|  |  |                       |  |         48 8d 78 0b          	lea    0xb(%rax),%rdi
+    188c:	|  |  |                       |  |         4c 89 5c 24 e0       	mov    %r11,-0x20(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    1891:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    1895:	|  |  |                       |  |         4c 8d 58 0f          	lea    0xf(%rax),%r11
+    1899:	|  |  |                       |  |         4c 89 54 24 e8       	mov    %r10,-0x18(%rsp)
+    189e:	|  |  |                       |  |         49 89 f9             	mov    %rdi,%r9
+    std::memcpy(&v, s, sizeof(v));
+    18a1:	|  |  |                       |  |         4c 09 e6             	or     %r12,%rsi
+        rotated[i] = p[(head + i) % 16];
+    18a4:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    18a8:	|  |  |                       |  |         4c 8d 50 0e          	lea    0xe(%rax),%r10
+    18ac:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    18b0:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    18b4:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    18b8:	|  |  |                       |  |         4c 89 4c 24 f0       	mov    %r9,-0x10(%rsp)
+    18bd:	|  |  |                       |  |         4c 8d 48 0d          	lea    0xd(%rax),%r9
+    std::memcpy(&v, s, sizeof(v));
+    18c1:	|  |  |                       |  |         48 09 ee             	or     %rbp,%rsi
+    18c4:	|  |  |                       |  |         0f b6 2c 19          	movzbl (%rcx,%rbx,1),%ebp
+    18c8:	|  |  |                       |  |         46 0f b6 14 11       	movzbl (%rcx,%r10,1),%r10d
+        rotated[i] = p[(head + i) % 16];
+    18cd:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    18d1:	|  |  |                       |  |         48 89 f3             	mov    %rsi,%rbx
+    18d4:	|  |  |                       |  |         42 0f b6 34 19       	movzbl (%rcx,%r11,1),%esi
+    18d9:	|  |  |                       |  |         46 0f b6 0c 09       	movzbl (%rcx,%r9,1),%r9d
+        rotated[i] = p[(head + i) % 16];
+    18de:	|  |  |                       |  |         48 8d 78 0c          	lea    0xc(%rax),%rdi
+    18e2:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    std::memcpy(&v, s, sizeof(v));
+    18e5:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    18e9:	|  |  |                       |  |         4c 8b 5c 24 e0       	mov    -0x20(%rsp),%r11
+    18ee:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    18f2:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    18f5:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    18f9:	|  |  |                       |  |         0f b6 2c 01          	movzbl (%rcx,%rax,1),%ebp
+    18fd:	|  |  |                       |  |         4c 09 d6             	or     %r10,%rsi
+    1900:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    1904:	|  |  |                       |  |         4c 8b 54 24 e8       	mov    -0x18(%rsp),%r10
+    1909:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    190d:	|  |  |                       |  |         4c 09 ce             	or     %r9,%rsi
+    1910:	|  |  |                       |  |         4c 8b 4c 24 f0       	mov    -0x10(%rsp),%r9
+    1915:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1919:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    191c:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    191f:	|  |  |                       |  |         42 0f b6 3c 09       	movzbl (%rcx,%r9,1),%edi
+    1924:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1928:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    192b:	|  |  |                       |  |         42 0f b6 3c 11       	movzbl (%rcx,%r10,1),%edi
+    1930:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1934:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    1937:	|  |  |                       |  |         42 0f b6 3c 19       	movzbl (%rcx,%r11,1),%edi
+    193c:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1940:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    1943:	|  |  |                       |  |         48 8b 7c 24 c8       	mov    -0x38(%rsp),%rdi
+    1948:	|  |  |                       |  |         48 89 5c 24 c8       	mov    %rbx,-0x38(%rsp)
+    194d:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    1951:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    1955:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1958:	|  |  |                       |  |         48 8d 78 40          	lea    0x40(%rax),%rdi
+    195c:	|  |  |                       |  |         4c 01 c0             	add    %r8,%rax
+    std::memcpy(&v, s, sizeof(v));
+    195f:	|  |  |                       |  |         48 89 74 24 d0       	mov    %rsi,-0x30(%rsp)
+    1964:	|  |  |                       |  |         66 0f 6f 44 24 c8    	movdqa -0x38(%rsp),%xmm0
+    for (; i + 64 <= n; i += 64) {
+    196a:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1970:	|  |  |                       |  |     /-> 48 89 fe             	mov    %rdi,%rsi
+    for (; i + 64 <= n; i += 64) {
+    1973:	|  |  |                       |  |     |   48 83 c7 40          	add    $0x40,%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1977:	|  |  |                       |  |     |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    197b:	|  |  |                       |  |     |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    1980:	|  |  |                       |  |     |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    1985:	|  |  |                       |  |     |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    198a:	|  |  |                       |  |     |   48 83 c0 40          	add    $0x40,%rax
+    198e:	|  |  |                       |  |     |   48 39 fa             	cmp    %rdi,%rdx
+    1991:	|  |  |                       |  |     \-- 73 dd                	jae    1970 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2a0>
+        stream16(d + i, v);
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+    1993:	|  |  |                       |  |         48 8d 46 10          	lea    0x10(%rsi),%rax
+    1997:	|  |  |                       |  |         48 39 c2             	cmp    %rax,%rdx
+    199a:	|  |  |                       |  |  /----- 72 15                	jb     19b1 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2e1>
+    199c:	|  |  |                       |  |  |      49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    19a0:	|  |  |                       |  |  |  /-> 48 89 c6             	mov    %rax,%rsi
+    19a3:	|  |  |                       |  |  |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    19a8:	|  |  |                       |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    19ac:	|  |  |                       |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    19af:	|  |  |                       |  |  |  \-- 73 ef                	jae    19a0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2d0>
+        stream16(d + i, v);
+    }
+    __builtin_ia32_sfence();
+    19b1:	|  |  |                       |  |  \----> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    19b4:	|  |  |                       |  |         48 39 d6             	cmp    %rdx,%rsi
+    19b7:	|  |  |                       |  |  /----- 73 1e                	jae    19d7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x307>
+    19b9:	|  |  |                       |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        d[i] = p[i % 16];
+    19c0:	|  |  |                       |  |  |  /-> 48 89 f0             	mov    %rsi,%rax
+    19c3:	|  |  |                       |  |  |  |   83 e0 0f             	and    $0xf,%eax
+    19c6:	|  |  |                       |  |  |  |   0f b6 04 01          	movzbl (%rcx,%rax,1),%eax
+    19ca:	|  |  |                       |  |  |  |   41 88 04 30          	mov    %al,(%r8,%rsi,1)
+    for (; i < n; ++i) {
+    19ce:	|  |  |                       |  |  |  |   48 83 c6 01          	add    $0x1,%rsi
+    19d2:	|  |  |                       |  |  |  |   48 39 f2             	cmp    %rsi,%rdx
+    19d5:	|  |  |                       |  |  |  \-- 75 e9                	jne    19c0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2f0>
+    }
+}
+    19d7:	|  |  |                       |  |  \----> 5b                   	pop    %rbx
+    19d8:	|  |  |                       |  |         5d                   	pop    %rbp
+    19d9:	|  |  |                       |  |         41 5c                	pop    %r12
+    19db:	|  |  |                       |  |         41 5d                	pop    %r13
+    19dd:	|  |  |                       |  |         41 5e                	pop    %r14
+    19df:	|  |  |                       |  |         41 5f                	pop    %r15
+    19e1:	|  |  |                       |  |         c3                   	ret
+    19e2:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    19e8:	|  |  |                       |  \-------> 48 83 ff 06          	cmp    $0x6,%rdi
+    19ec:	|  |  |  /--------------------|----------- 0f 86 e1 01 00 00    	jbe    1bd3 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x503>
+        d[i] = p[i];
+    19f2:	|  |  |  |                    |            48 8b 31             	mov    (%rcx),%rsi
+    19f5:	|  |  |  |                    |            49 89 30             	mov    %rsi,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    19f8:	|  |  |  |                    |            48 83 f8 08          	cmp    $0x8,%rax
+    19fc:	+--|--|--|--------------------|----------- 0f 84 fe fd ff ff    	je     1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    1a02:	|  |  |  |                    |            48 8d 70 f7          	lea    -0x9(%rax),%rsi
+    1a06:	|  |  |  |                    |            4c 8d 48 f8          	lea    -0x8(%rax),%r9
+    1a0a:	|  |  |  |                    |            48 83 fe 02          	cmp    $0x2,%rsi
+    1a0e:	|  |  |  |                    |            be 08 00 00 00       	mov    $0x8,%esi
+    1a13:	|  |  |  |                    |        /-- 76 15                	jbe    1a2a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x35a>
+        d[i] = p[i];
+    1a15:	|  |  |  |  /-----------------|--------|-> 8b 3c 31             	mov    (%rcx,%rsi,1),%edi
+    1a18:	|  |  |  |  |                 |        |   41 89 3c 30          	mov    %edi,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    1a1c:	|  |  |  |  |                 |        |   48 83 c6 04          	add    $0x4,%rsi
+    1a20:	|  |  |  |  |                 |        |   49 83 f9 04          	cmp    $0x4,%r9
+    1a24:	+--|--|--|--|-----------------|--------|-- 0f 84 d6 fd ff ff    	je     1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1a2a:	|  |  |  |  |                 |        \-> 0f b6 3c 31          	movzbl (%rcx,%rsi,1),%edi
+    1a2e:	|  |  |  |  |                 |            41 88 3c 30          	mov    %dil,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    1a32:	|  |  |  |  |                 |            48 8d 7e 01          	lea    0x1(%rsi),%rdi
+    1a36:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    1a39:	+--|--|--|--|-----------------|----------- 0f 83 c1 fd ff ff    	jae    1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1a3f:	|  |  |  |  |                 |            0f b6 7c 31 01       	movzbl 0x1(%rcx,%rsi,1),%edi
+    1a44:	|  |  |  |  |                 |            41 88 7c 30 01       	mov    %dil,0x1(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    1a49:	|  |  |  |  |                 |            48 8d 7e 02          	lea    0x2(%rsi),%rdi
+    1a4d:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    1a50:	+--|--|--|--|-----------------|----------- 0f 83 aa fd ff ff    	jae    1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1a56:	|  |  |  |  |                 |            0f b6 7c 31 02       	movzbl 0x2(%rcx,%rsi,1),%edi
+    1a5b:	|  |  |  |  |                 |            41 88 7c 30 02       	mov    %dil,0x2(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    1a60:	+--|--|--|--|-----------------|----------- e9 9b fd ff ff       	jmp    1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    1a65:	|  |  |  |  |                 |            0f 1f 00             	nopl   (%rax)
+    Length done = (n < 16) ? n : 16;
+    1a68:	|  |  |  |  |                 \----------> 41 ba 10 00 00 00    	mov    $0x10,%r10d
+    1a6e:	|  |  |  |  |                              4c 39 d2             	cmp    %r10,%rdx
+    1a71:	|  |  |  |  |                              4c 0f 46 d2          	cmovbe %rdx,%r10
+    std::memcpy(d, s, n);
+    1a75:	|  |  |  |  |                              44 89 d0             	mov    %r10d,%eax
+    1a78:	|  |  |  |  |                              41 83 fa 08          	cmp    $0x8,%r10d
+    1a7c:	|  |  |  |  |        /-------------------- 0f 82 cc 00 00 00    	jb     1b4e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47e>
+    1a82:	|  |  |  |  |        |                     48 8b 06             	mov    (%rsi),%rax
+    1a85:	|  |  |  |  |        |                     4c 8d 4f 08          	lea    0x8(%rdi),%r9
+    1a89:	|  |  |  |  |        |                     49 83 e1 f8          	and    $0xfffffffffffffff8,%r9
+    1a8d:	|  |  |  |  |        |                     48 89 07             	mov    %rax,(%rdi)
+    1a90:	|  |  |  |  |        |                     44 89 d0             	mov    %r10d,%eax
+    1a93:	|  |  |  |  |        |                     48 8b 74 06 f8       	mov    -0x8(%rsi,%rax,1),%rsi
+    1a98:	|  |  |  |  |        |                     48 89 74 07 f8       	mov    %rsi,-0x8(%rdi,%rax,1)
+    1a9d:	|  |  |  |  |        |                     48 89 f8             	mov    %rdi,%rax
+    1aa0:	|  |  |  |  |        |                     4c 29 c8             	sub    %r9,%rax
+    1aa3:	|  |  |  |  |        |                     48 29 c1             	sub    %rax,%rcx
+    1aa6:	|  |  |  |  |        |                     44 01 d0             	add    %r10d,%eax
+    1aa9:	|  |  |  |  |        |                     83 e0 f8             	and    $0xfffffff8,%eax
+    1aac:	|  |  |  |  |        |                     83 f8 08             	cmp    $0x8,%eax
+    1aaf:	|  |  |  |  |  /-----|-------------------- 72 16                	jb     1ac7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    1ab1:	|  |  |  |  |  |     |                     83 e0 f8             	and    $0xfffffff8,%eax
+    1ab4:	|  |  |  |  |  |     |                     31 f6                	xor    %esi,%esi
+    1ab6:	|  |  |  |  |  |     |                 /-> 89 f7                	mov    %esi,%edi
+    1ab8:	|  |  |  |  |  |     |                 |   83 c6 08             	add    $0x8,%esi
+    1abb:	|  |  |  |  |  |     |                 |   4c 8b 1c 39          	mov    (%rcx,%rdi,1),%r11
+    1abf:	|  |  |  |  |  |     |                 |   4d 89 1c 39          	mov    %r11,(%r9,%rdi,1)
+    1ac3:	|  |  |  |  |  |     |                 |   39 c6                	cmp    %eax,%esi
+    1ac5:	|  |  |  |  |  |     |                 \-- 72 ef                	jb     1ab6 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3e6>
+    while (done < n) {
+    1ac7:	|  |  |  |  |  >-----|-------------------> 49 39 d2             	cmp    %rdx,%r10
+    1aca:	|  |  |  |  |  |     |           /-------- 72 33                	jb     1aff <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    1acc:	|  |  |  |  |  |     |     /-----|-------- e9 af 00 00 00       	jmp    1b80 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b0>
+    1ad1:	|  |  |  |  |  |     |     |     |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    std::memcpy(d, s, n);
+    1ad8:	|  |  |  |  |  |     |     |     |     /-> 41 f6 c1 04          	test   $0x4,%r9b
+    1adc:	|  |  |  |  |  |     |     |  /--|-----|-- 0f 85 9f 00 00 00    	jne    1b81 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b1>
+    1ae2:	|  |  |  |  |  |     |     |  |  |     |   45 85 c9             	test   %r9d,%r9d
+    1ae5:	|  |  |  |  |  |  /--|-----|--|--|-----|-- 74 10                	je     1af7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    1ae7:	|  |  |  |  |  |  |  |     |  |  |     |   41 0f b6 08          	movzbl (%r8),%ecx
+    1aeb:	|  |  |  |  |  |  |  |     |  |  |     |   88 08                	mov    %cl,(%rax)
+    1aed:	|  |  |  |  |  |  |  |     |  |  |     |   41 f6 c1 02          	test   $0x2,%r9b
+    1af1:	|  |  |  |  |  |  |  |  /--|--|--|-----|-- 0f 85 c9 00 00 00    	jne    1bc0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4f0>
+        done += m;
+    1af7:	|  |  |  |  |  |  >--|--|--|--|--|-----|-> 4d 01 ca             	add    %r9,%r10
+    while (done < n) {
+    1afa:	|  |  |  |  |  |  |  |  |  |  |  |     |   49 39 d2             	cmp    %rdx,%r10
+    1afd:	|  |  |  |  |  |  |  |  |  |  |  |  /--|-- 73 4e                	jae    1b4d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47d>
+        Length const m = (done < n - done) ? done : n - done;
+    1aff:	|  |  |  |  |  |  |  |  |  |  |  >--|--|-> 49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    1b02:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4b 8d 04 10          	lea    (%r8,%r10,1),%rax
+        Length const m = (done < n - done) ? done : n - done;
+    1b06:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 29 d1             	sub    %r10,%r9
+    1b09:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 39 d1             	cmp    %r10,%r9
+    1b0c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 0f 47 ca          	cmova  %r10,%r9
+    std::memcpy(d, s, n);
+    1b10:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   41 83 f9 08          	cmp    $0x8,%r9d
+    1b14:	|  |  |  |  |  |  |  |  |  |  |  |  |  \-- 72 c2                	jb     1ad8 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x408>
+    1b16:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 08             	mov    (%r8),%rcx
+    1b19:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 78 08          	lea    0x8(%rax),%rdi
+        done += m;
+    1b1d:	|  |  |  |  |  |  |  |  |  |  |  |  |      4d 01 ca             	add    %r9,%r10
+    std::memcpy(d, s, n);
+    1b20:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 83 e7 f8          	and    $0xfffffffffffffff8,%rdi
+    1b24:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 08             	mov    %rcx,(%rax)
+    1b27:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 89 c9             	mov    %r9d,%ecx
+    1b2a:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 74 08 f8       	mov    -0x8(%r8,%rcx,1),%rsi
+    1b2f:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 74 08 f8       	mov    %rsi,-0x8(%rax,%rcx,1)
+    1b34:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 f8             	sub    %rdi,%rax
+    1b37:	|  |  |  |  |  |  |  |  |  |  |  |  |      4c 89 c6             	mov    %r8,%rsi
+    1b3a:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 c6             	sub    %rax,%rsi
+    1b3d:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 01 c8             	add    %r9d,%eax
+    1b40:	|  |  |  |  |  |  |  |  |  |  |  |  |      c1 e8 03             	shr    $0x3,%eax
+    1b43:	|  |  |  |  |  |  |  |  |  |  |  |  |      89 c1                	mov    %eax,%ecx
+    1b45:	|  |  |  |  |  |  |  |  |  |  |  |  |      f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    1b48:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 39 d2             	cmp    %rdx,%r10
+    1b4b:	|  |  |  |  |  |  |  |  |  |  |  \--|----- 72 b2                	jb     1aff <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    1b4d:	|  |  |  |  |  |  |  |  |  |  |     \----> c3                   	ret
+    std::memcpy(d, s, n);
+    1b4e:	|  |  |  |  |  |  |  \--|--|--|----------> 41 f6 c2 04          	test   $0x4,%r10b
+    1b52:	|  |  |  |  |  |  |     |  |  |        /-- 0f 85 85 00 00 00    	jne    1bdd <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x50d>
+    1b58:	|  |  |  |  |  |  |     |  |  |        |   85 c0                	test   %eax,%eax
+    1b5a:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 67 ff ff ff    	je     1ac7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    1b60:	|  |  |  |  |  |  |     |  |  |        |   0f b6 36             	movzbl (%rsi),%esi
+    1b63:	|  |  |  |  |  |  |     |  |  |        |   40 88 37             	mov    %sil,(%rdi)
+    1b66:	|  |  |  |  |  |  |     |  |  |        |   a8 02                	test   $0x2,%al
+    1b68:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 59 ff ff ff    	je     1ac7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    1b6e:	|  |  |  |  |  |  |     |  |  |        |   0f b7 4c 01 fe       	movzwl -0x2(%rcx,%rax,1),%ecx
+    1b73:	|  |  |  |  |  |  |     |  |  |        |   66 89 4c 07 fe       	mov    %cx,-0x2(%rdi,%rax,1)
+    1b78:	|  |  |  |  |  +--|-----|--|--|--------|-- e9 4a ff ff ff       	jmp    1ac7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    1b7d:	|  |  |  |  |  |  |     |  |  |        |   0f 1f 00             	nopl   (%rax)
+    1b80:	|  |  |  |  |  |  |     |  \--|--------|-> c3                   	ret
+    1b81:	|  |  |  |  |  |  |     |     \--------|-> 41 8b 08             	mov    (%r8),%ecx
+    1b84:	|  |  |  |  |  |  |     |              |   89 08                	mov    %ecx,(%rax)
+    1b86:	|  |  |  |  |  |  |     |              |   44 89 c9             	mov    %r9d,%ecx
+    1b89:	|  |  |  |  |  |  |     |              |   41 8b 74 08 fc       	mov    -0x4(%r8,%rcx,1),%esi
+    1b8e:	|  |  |  |  |  |  |     |              |   89 74 08 fc          	mov    %esi,-0x4(%rax,%rcx,1)
+    1b92:	|  |  |  |  |  |  +-----|--------------|-- e9 60 ff ff ff       	jmp    1af7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+        d[i] = p[i];
+    1b97:	|  \--|--|--|--|--|-----|--------------|-> 0f b6 39             	movzbl (%rcx),%edi
+    1b9a:	|     |  |  |  |  |     |              |   41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1b9d:	|     |  |  |  |  |     |              |   40 f6 c6 0e          	test   $0xe,%sil
+    1ba1:	+-----|--|--|--|--|-----|--------------|-- 0f 84 59 fc ff ff    	je     1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    1ba7:	|     |  |  |  |  |     |              |   0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    1bab:	|     |  |  |  |  |     |              |   41 88 78 01          	mov    %dil,0x1(%r8)
+    for (Index i = 0; i < head; ++i) {
+    1baf:	|     |  |  |  |  |     |              |   48 83 f8 03          	cmp    $0x3,%rax
+    1bb3:	\-----|--|--|--|--|-----|--------------|-- 0f 85 47 fc ff ff    	jne    1800 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    1bb9:	      \--|--|--|--|-----|--------------|-- e9 7b fb ff ff       	jmp    1739 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x69>
+    1bbe:	         |  |  |  |     |              |   66 90                	xchg   %ax,%ax
+    std::memcpy(d, s, n);
+    1bc0:	         |  |  |  |     \--------------|-> 44 89 c9             	mov    %r9d,%ecx
+    1bc3:	         |  |  |  |                    |   41 0f b7 74 08 fe    	movzwl -0x2(%r8,%rcx,1),%esi
+    1bc9:	         |  |  |  |                    |   66 89 74 08 fe       	mov    %si,-0x2(%rax,%rcx,1)
+    1bce:	         |  |  |  \--------------------|-- e9 24 ff ff ff       	jmp    1af7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    for (Index i = 0; i < head; ++i) {
+    1bd3:	         \--|--|-----------------------|-> 49 89 c1             	mov    %rax,%r9
+    1bd6:	            |  |                       |   31 f6                	xor    %esi,%esi
+    1bd8:	            \--|-----------------------|-- e9 38 fe ff ff       	jmp    1a15 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x345>
+    std::memcpy(d, s, n);
+    1bdd:	               |                       \-> 8b 36                	mov    (%rsi),%esi
+    1bdf:	               |                           89 37                	mov    %esi,(%rdi)
+    1be1:	               |                           8b 4c 01 fc          	mov    -0x4(%rcx,%rax,1),%ecx
+    1be5:	               |                           89 4c 07 fc          	mov    %ecx,-0x4(%rdi,%rax,1)
+    1be9:	               \-------------------------- e9 d9 fe ff ff       	jmp    1ac7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    1bee:	                                           66 90                	xchg   %ax,%ax
+
+0000000000001bf0 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    1bf0:	    48 85 ff             	test   %rdi,%rdi
+    1bf3:	/-- 74 0b                	je     1c00 <nel::free_aligned(void*)+0x10>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    1bf5:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    1bf9:	|   e9 32 f4 ff ff       	jmp    1030 <free@plt>
+    1bfe:	|   66 90                	xchg   %ax,%ax
+}
+    1c00:	\-> c3                   	ret
+    1c01:	    66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1c08:	    00 00 00 00 
+    1c0c:	    0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001c10 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    1c10:	                   41 56                	push   %r14
+            : fn_name_(fn_name)
+    1c12:	                   48 8d 05 92 04 00 00 	lea    0x492(%rip),%rax        # 20ab <_IO_stdin_used+0xab>
+    1c19:	                   41 55                	push   %r13
+    1c1b:	                   66 48 0f 6e c8       	movq   %rax,%xmm1
+    1c20:	                   41 54                	push   %r12
+    1c22:	                   55                   	push   %rbp
+    1c23:	                   48 89 cd             	mov    %rcx,%rbp
+    1c26:	                   48 8d 0d 6e 04 00 00 	lea    0x46e(%rip),%rcx        # 209b <_IO_stdin_used+0x9b>
+    1c2d:	                   53                   	push   %rbx
+    1c2e:	                   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    1c33:	                   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    1c37:	                   48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    1c3b:	                   c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    1c42:	                   00 
+            : fn_name_(fn_name)
+    1c43:	                   0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    1c47:	                   48 85 f6             	test   %rsi,%rsi
+    1c4a:	/----------------- 0f 84 a0 00 00 00    	je     1cf0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    1c50:	|                  48 8d 46 ff          	lea    -0x1(%rsi),%rax
+    1c54:	|                  48 89 f3             	mov    %rsi,%rbx
+    1c57:	|                  48 85 f0             	test   %rsi,%rax
+    1c5a:	+----------------- 0f 85 90 00 00 00    	jne    1cf0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1c60:	|                  48 8d 34 2e          	lea    (%rsi,%rbp,1),%rsi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    1c64:	|                  48 85 ff             	test   %rdi,%rdi
+    1c67:	|     /----------- 74 67                	je     1cd0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xc0>
+    1c69:	|     |            4c 8b 6f f8          	mov    -0x8(%rdi),%r13
+    uint8_t *const new_base =
+    1c6d:	|     |            49 89 d4             	mov    %rdx,%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    1c70:	|     |            4c 29 ef             	sub    %r13,%rdi
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1c73:	|     |            e8 48 f4 ff ff       	call   10c0 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    1c78:	|     |            48 85 c0             	test   %rax,%rax
+    1c7b:	|  /--|----------- 0f 84 7e 00 00 00    	je     1cff <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1c81:	|  |  |            48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    1c86:	|  |  |            48 f7 db             	neg    %rbx
+    1c89:	|  |  |            48 21 cb             	and    %rcx,%rbx
+    1c8c:	|  |  |            49 89 de             	mov    %rbx,%r14
+    1c8f:	|  |  |            49 29 c6             	sub    %rax,%r14
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    1c92:	|  |  |            4d 39 f5             	cmp    %r14,%r13
+    1c95:	|  |  |        /-- 75 19                	jne    1cb0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xa0>
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    }
+    offset_field(new_p) = new_offset;
+    1c97:	|  |  |     /--|-> 4c 89 73 f8          	mov    %r14,-0x8(%rbx)
+    return new_p;
+}
+    1c9b:	|  |  |  /--|--|-> 48 83 c4 20          	add    $0x20,%rsp
+    1c9f:	|  |  |  |  |  |   48 89 d8             	mov    %rbx,%rax
+    1ca2:	|  |  |  |  |  |   5b                   	pop    %rbx
+    1ca3:	|  |  |  |  |  |   5d                   	pop    %rbp
+    1ca4:	|  |  |  |  |  |   41 5c                	pop    %r12
+    1ca6:	|  |  |  |  |  |   41 5d                	pop    %r13
+    1ca8:	|  |  |  |  |  |   41 5e                	pop    %r14
+    1caa:	|  |  |  |  |  |   c3                   	ret
+    1cab:	|  |  |  |  |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        std::memmove(new_p, new_base + old_offset, n);
+    1cb0:	|  |  |  |  |  \-> 4c 39 e5             	cmp    %r12,%rbp
+    1cb3:	|  |  |  |  |      4c 89 e2             	mov    %r12,%rdx
+    1cb6:	|  |  |  |  |      4a 8d 34 28          	lea    (%rax,%r13,1),%rsi
+    1cba:	|  |  |  |  |      48 89 df             	mov    %rbx,%rdi
+    1cbd:	|  |  |  |  |      48 0f 46 d5          	cmovbe %rbp,%rdx
+    1cc1:	|  |  |  |  |      e8 0a f4 ff ff       	call   10d0 <memmove@plt>
+    1cc6:	|  |  |  |  +----- eb cf                	jmp    1c97 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+    1cc8:	|  |  |  |  |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    1ccf:	|  |  |  |  |      00 
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1cd0:	|  |  \--|--|----> 48 89 f7             	mov    %rsi,%rdi
+    1cd3:	|  |     |  |      e8 d8 f3 ff ff       	call   10b0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    1cd8:	|  |     |  |      48 85 c0             	test   %rax,%rax
+    1cdb:	|  +-----|--|----- 74 22                	je     1cff <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1cdd:	|  |     |  |      48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    1ce2:	|  |     |  |      48 f7 db             	neg    %rbx
+    1ce5:	|  |     |  |      48 21 d3             	and    %rdx,%rbx
+    1ce8:	|  |     |  |      49 89 de             	mov    %rbx,%r14
+    1ceb:	|  |     |  |      49 29 c6             	sub    %rax,%r14
+    if (old_p != nullptr && new_offset != old_offset) {
+    1cee:	|  |     |  \----- eb a7                	jmp    1c97 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    1cf0:	\--|-----|-------> 48 89 e6             	mov    %rsp,%rsi
+    1cf3:	   |     |         48 8d 3d c3 03 00 00 	lea    0x3c3(%rip),%rdi        # 20bd <_IO_stdin_used+0xbd>
+    1cfa:	   |     |         e8 53 f4 ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    if (new_base == nullptr) { return nullptr; }
+    1cff:	   \-----|-------> 31 db                	xor    %ebx,%ebx
+    1d01:	         \-------- eb 98                	jmp    1c9b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x8b>
+    1d03:	                   66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1d0a:	                   00 00 00 00 
+    1d0e:	                   66 90                	xchg   %ax,%ax
+
+0000000000001d10 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    1d10:	       53                   	push   %rbx
+            : fn_name_(fn_name)
+    1d11:	       48 8d 05 93 03 00 00 	lea    0x393(%rip),%rax        # 20ab <_IO_stdin_used+0xab>
+    1d18:	       48 8d 0d 7c 03 00 00 	lea    0x37c(%rip),%rcx        # 209b <_IO_stdin_used+0x9b>
+    1d1f:	       66 48 0f 6e c1       	movq   %rcx,%xmm0
+    1d24:	       66 48 0f 6e c8       	movq   %rax,%xmm1
+    1d29:	       66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    1d2d:	       48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    1d31:	       c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    1d38:	       00 
+            : fn_name_(fn_name)
+    1d39:	       0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    1d3d:	       48 85 ff             	test   %rdi,%rdi
+    1d40:	/----- 74 35                	je     1d77 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+    1d42:	|      48 8d 47 ff          	lea    -0x1(%rdi),%rax
+    1d46:	|      48 89 fb             	mov    %rdi,%rbx
+    1d49:	|      48 85 f8             	test   %rdi,%rax
+    1d4c:	+----- 75 29                	jne    1d77 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    1d4e:	|      48 8d 3c 37          	lea    (%rdi,%rsi,1),%rdi
+    1d52:	|      e8 59 f3 ff ff       	call   10b0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    1d57:	|      48 85 c0             	test   %rax,%rax
+    1d5a:	|  /-- 74 15                	je     1d71 <nel::malloc_aligned(unsigned long, unsigned long)+0x61>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    1d5c:	|  |   48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    1d61:	|  |   48 f7 db             	neg    %rbx
+    1d64:	|  |   48 21 da             	and    %rbx,%rdx
+    1d67:	|  |   48 29 c2             	sub    %rax,%rdx
+    uint8_t *const new_p = new_base + new_offset;
+    1d6a:	|  |   48 01 d0             	add    %rdx,%rax
+    offset_field(new_p) = new_offset;
+    1d6d:	|  |   48 89 50 f8          	mov    %rdx,-0x8(%rax)
+    return realloc_aligned(nullptr, align, 0, size);
+}
+    1d71:	|  \-> 48 83 c4 20          	add    $0x20,%rsp
+    1d75:	|      5b                   	pop    %rbx
+    1d76:	|      c3                   	ret
+    if (!pred) { assert_fail(msg, ctx); }
+    1d77:	\----> 48 89 e6             	mov    %rsp,%rsi
+    1d7a:	       48 8d 3d 3c 03 00 00 	lea    0x33c(%rip),%rdi        # 20bd <_IO_stdin_used+0xbd>
+    1d81:	       e8 cc f3 ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    1d86:	       66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1d8d:	       00 00 00 
+
+0000000000001d90 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    1d90:	53                   	push   %rbx
+    1d91:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    1d94:	40 0f be fe          	movsbl %sil,%edi
+    1d98:	48 8b 35 e1 22 00 00 	mov    0x22e1(%rip),%rsi        # 4080 <stderr@GLIBC_2.2.5>
+    1d9f:	e8 cc f2 ff ff       	call   1070 <fputc@plt>
+    return outs;
+}
+    1da4:	48 89 d8             	mov    %rbx,%rax
+    1da7:	5b                   	pop    %rbx
+    1da8:	c3                   	ret
+    1da9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001db0 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    1db0:	53                   	push   %rbx
+    1db1:	48 89 fb             	mov    %rdi,%rbx
+    1db4:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    1db7:	48 8b 35 c2 22 00 00 	mov    0x22c2(%rip),%rsi        # 4080 <stderr@GLIBC_2.2.5>
+    1dbe:	e8 8d f2 ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    1dc3:	48 89 d8             	mov    %rbx,%rax
+    1dc6:	5b                   	pop    %rbx
+    1dc7:	c3                   	ret
+    1dc8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    1dcf:	00 
+
+0000000000001dd0 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    1dd0:	53                   	push   %rbx
+    1dd1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    1dd4:	48 8b 3d a5 22 00 00 	mov    0x22a5(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+    1ddb:	40 0f b6 d6          	movzbl %sil,%edx
+    1ddf:	31 c0                	xor    %eax,%eax
+    1de1:	48 8d 35 f0 02 00 00 	lea    0x2f0(%rip),%rsi        # 20d8 <_IO_stdin_used+0xd8>
+    1de8:	e8 a3 f2 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1ded:	48 89 d8             	mov    %rbx,%rax
+    1df0:	5b                   	pop    %rbx
+    1df1:	c3                   	ret
+    1df2:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1df9:	00 00 00 00 
+    1dfd:	0f 1f 00             	nopl   (%rax)
+
+0000000000001e00 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    1e00:	53                   	push   %rbx
+    1e01:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    1e04:	48 8b 3d 75 22 00 00 	mov    0x2275(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+    1e0b:	0f b7 d6             	movzwl %si,%edx
+    1e0e:	31 c0                	xor    %eax,%eax
+    1e10:	48 8d 35 c1 02 00 00 	lea    0x2c1(%rip),%rsi        # 20d8 <_IO_stdin_used+0xd8>
+    1e17:	e8 74 f2 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1e1c:	48 89 d8             	mov    %rbx,%rax
+    1e1f:	5b                   	pop    %rbx
+    1e20:	c3                   	ret
+    1e21:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1e28:	00 00 00 00 
+    1e2c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001e30 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    1e30:	53                   	push   %rbx
+    1e31:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    1e34:	48 8b 3d 45 22 00 00 	mov    0x2245(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+{
+    1e3b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    1e3d:	31 c0                	xor    %eax,%eax
+    1e3f:	48 8d 35 92 02 00 00 	lea    0x292(%rip),%rsi        # 20d8 <_IO_stdin_used+0xd8>
+    1e46:	e8 45 f2 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1e4b:	48 89 d8             	mov    %rbx,%rax
+    1e4e:	5b                   	pop    %rbx
+    1e4f:	c3                   	ret
+
+0000000000001e50 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    1e50:	53                   	push   %rbx
+    1e51:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    1e54:	48 8b 3d 25 22 00 00 	mov    0x2225(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+{
+    1e5b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    1e5d:	31 c0                	xor    %eax,%eax
+    1e5f:	48 8d 35 72 02 00 00 	lea    0x272(%rip),%rsi        # 20d8 <_IO_stdin_used+0xd8>
+    1e66:	e8 25 f2 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1e6b:	48 89 d8             	mov    %rbx,%rax
+    1e6e:	5b                   	pop    %rbx
+    1e6f:	c3                   	ret
+
+0000000000001e70 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    1e70:	53                   	push   %rbx
+    1e71:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    1e74:	48 8b 3d 05 22 00 00 	mov    0x2205(%rip),%rdi        # 4080 <stderr@GLIBC_2.2.5>
+{
+    1e7b:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    1e7e:	31 c0                	xor    %eax,%eax
+    1e80:	48 8d 35 54 02 00 00 	lea    0x254(%rip),%rsi        # 20db <_IO_stdin_used+0xdb>
+    1e87:	e8 04 f2 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    1e8c:	48 89 d8             	mov    %rbx,%rax
+    1e8f:	5b                   	pop    %rbx
+    1e90:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000001e94 <_fini>:
+    1e94:	48 83 ec 08          	sub    $0x8,%rsp
+    1e98:	48 83 c4 08          	add    $0x8,%rsp
+    1e9c:	c3                   	ret
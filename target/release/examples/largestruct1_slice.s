@@ -0,0 +1,2309 @@
+
+target/release/examples/largestruct1_slice:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 3f 00 00 	mov    0x3fc5(%rip),%rax        # 4fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 3f 00 00    	push   0x3fca(%rip)        # 4ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 3f 00 00    	jmp    *0x3fcc(%rip)        # 4ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 3f 00 00    	jmp    *0x3fca(%rip)        # 5000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 3f 00 00    	jmp    *0x3fc2(%rip)        # 5008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 3f 00 00    	jmp    *0x3fba(%rip)        # 5010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memset@plt>:
+    1060:	ff 25 b2 3f 00 00    	jmp    *0x3fb2(%rip)        # 5018 <memset@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 3f 00 00    	jmp    *0x3faa(%rip)        # 5020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 3f 00 00    	jmp    *0x3fa2(%rip)        # 5028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 3f 00 00    	jmp    *0x3f9a(%rip)        # 5030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcpy@plt>:
+    10a0:	ff 25 92 3f 00 00    	jmp    *0x3f92(%rip)        # 5038 <memcpy@GLIBC_2.14>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <malloc@plt>:
+    10b0:	ff 25 8a 3f 00 00    	jmp    *0x3f8a(%rip)        # 5040 <malloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <realloc@plt>:
+    10c0:	ff 25 82 3f 00 00    	jmp    *0x3f82(%rip)        # 5048 <realloc@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <memmove@plt>:
+    10d0:	ff 25 7a 3f 00 00    	jmp    *0x3f7a(%rip)        # 5050 <memmove@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010e0 <__cxa_finalize@plt>:
+    10e0:	ff 25 fa 3e 00 00    	jmp    *0x3efa(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10e6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010f0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10f0:	50                   	push   %rax
+    std::abort();
+    10f1:	e8 4a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010f6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10f6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10f7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10fa:	4c 8d 0d cf 1f 00 00 	lea    0x1fcf(%rip),%r9        # 30d0 <_IO_stdin_used+0xd0>
+    1101:	31 c0                	xor    %eax,%eax
+    1103:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    1107:	4c 8b 07             	mov    (%rdi),%r8
+    110a:	48 8d 35 c5 1f 00 00 	lea    0x1fc5(%rip),%rsi        # 30d6 <_IO_stdin_used+0xd6>
+    1111:	48 8b 3d 68 3f 00 00 	mov    0x3f68(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1118:	e8 73 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    111d:	e8 1e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001122 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1122:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1126:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1129:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    112d:	31 c0                	xor    %eax,%eax
+    112f:	57                   	push   %rdi
+    1130:	48 8b 3d 49 3f 00 00 	mov    0x3f49(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1137:	4c 8d 0d 92 1f 00 00 	lea    0x1f92(%rip),%r9        # 30d0 <_IO_stdin_used+0xd0>
+    113e:	4c 8b 06             	mov    (%rsi),%r8
+    1141:	48 8d 35 9f 1f 00 00 	lea    0x1f9f(%rip),%rsi        # 30e7 <_IO_stdin_used+0xe7>
+    1148:	e8 43 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    114d:	e8 ee fe ff ff       	call   1040 <abort@plt>
+
+0000000000001152 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1152:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1156:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1159:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    115d:	31 c0                	xor    %eax,%eax
+    115f:	57                   	push   %rdi
+    1160:	48 8b 3d 19 3f 00 00 	mov    0x3f19(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    1167:	4c 8d 0d 8e 1f 00 00 	lea    0x1f8e(%rip),%r9        # 30fc <_IO_stdin_used+0xfc>
+    116e:	4c 8b 06             	mov    (%rsi),%r8
+    1171:	48 8d 35 6f 1f 00 00 	lea    0x1f6f(%rip),%rsi        # 30e7 <_IO_stdin_used+0xe7>
+    1178:	e8 13 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    117d:	e8 be fe ff ff       	call   1040 <abort@plt>
+    1182:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1189:	00 00 00 
+    118c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001190 <main>:
+    auto s1 = vec1.slice();
+    nel::log << s1.len() << '\n' << s1;
+}
+
+int main()
+{
+    1190:	53                   	push   %rbx
+    nel::log << "ex1:b" << '\n';
+    1191:	48 8d 1d f1 3e 00 00 	lea    0x3ef1(%rip),%rbx        # 5089 <nel::log>
+    1198:	48 8d 35 b6 1e 00 00 	lea    0x1eb6(%rip),%rsi        # 3055 <_IO_stdin_used+0x55>
+    119f:	48 89 df             	mov    %rbx,%rdi
+    11a2:	e8 39 15 00 00       	call   26e0 <nel::operator<<(nel::Log&, char const*)>
+    11a7:	be 0a 00 00 00       	mov    $0xa,%esi
+    11ac:	48 89 c7             	mov    %rax,%rdi
+    11af:	e8 0c 15 00 00       	call   26c0 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    11b4:	e8 97 01 00 00       	call   1350 <ex1()>
+    nel::log << "ex1:e" << '\n';
+    11b9:	48 89 df             	mov    %rbx,%rdi
+    11bc:	48 8d 35 98 1e 00 00 	lea    0x1e98(%rip),%rsi        # 305b <_IO_stdin_used+0x5b>
+    11c3:	e8 18 15 00 00       	call   26e0 <nel::operator<<(nel::Log&, char const*)>
+    11c8:	be 0a 00 00 00       	mov    $0xa,%esi
+    11cd:	48 89 c7             	mov    %rax,%rdi
+    11d0:	e8 eb 14 00 00       	call   26c0 <nel::operator<<(nel::Log&, char)>
+}
+    11d5:	31 c0                	xor    %eax,%eax
+    11d7:	5b                   	pop    %rbx
+    11d8:	c3                   	ret
+    11d9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000011e0 <_start>:
+    11e0:	31 ed                	xor    %ebp,%ebp
+    11e2:	49 89 d1             	mov    %rdx,%r9
+    11e5:	5e                   	pop    %rsi
+    11e6:	48 89 e2             	mov    %rsp,%rdx
+    11e9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    11ed:	50                   	push   %rax
+    11ee:	54                   	push   %rsp
+    11ef:	45 31 c0             	xor    %r8d,%r8d
+    11f2:	31 c9                	xor    %ecx,%ecx
+    11f4:	48 8d 3d 95 ff ff ff 	lea    -0x6b(%rip),%rdi        # 1190 <main>
+    11fb:	ff 15 bf 3d 00 00    	call   *0x3dbf(%rip)        # 4fc0 <__libc_start_main@GLIBC_2.34>
+    1201:	f4                   	hlt
+    1202:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1209:	00 00 00 
+    120c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001210 <deregister_tm_clones>:
+    1210:	    48 8d 3d 51 3e 00 00 	lea    0x3e51(%rip),%rdi        # 5068 <__TMC_END__>
+    1217:	    48 8d 05 4a 3e 00 00 	lea    0x3e4a(%rip),%rax        # 5068 <__TMC_END__>
+    121e:	    48 39 f8             	cmp    %rdi,%rax
+    1221:	/-- 74 15                	je     1238 <deregister_tm_clones+0x28>
+    1223:	|   48 8b 05 9e 3d 00 00 	mov    0x3d9e(%rip),%rax        # 4fc8 <_ITM_deregisterTMCloneTable@Base>
+    122a:	|   48 85 c0             	test   %rax,%rax
+    122d:	+-- 74 09                	je     1238 <deregister_tm_clones+0x28>
+    122f:	|   ff e0                	jmp    *%rax
+    1231:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1238:	\-> c3                   	ret
+    1239:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001240 <register_tm_clones>:
+    1240:	    48 8d 3d 21 3e 00 00 	lea    0x3e21(%rip),%rdi        # 5068 <__TMC_END__>
+    1247:	    48 8d 35 1a 3e 00 00 	lea    0x3e1a(%rip),%rsi        # 5068 <__TMC_END__>
+    124e:	    48 29 fe             	sub    %rdi,%rsi
+    1251:	    48 89 f0             	mov    %rsi,%rax
+    1254:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1258:	    48 c1 f8 03          	sar    $0x3,%rax
+    125c:	    48 01 c6             	add    %rax,%rsi
+    125f:	    48 d1 fe             	sar    %rsi
+    1262:	/-- 74 14                	je     1278 <register_tm_clones+0x38>
+    1264:	|   48 8b 05 6d 3d 00 00 	mov    0x3d6d(%rip),%rax        # 4fd8 <_ITM_registerTMCloneTable@Base>
+    126b:	|   48 85 c0             	test   %rax,%rax
+    126e:	+-- 74 08                	je     1278 <register_tm_clones+0x38>
+    1270:	|   ff e0                	jmp    *%rax
+    1272:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1278:	\-> c3                   	ret
+    1279:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001280 <__do_global_dtors_aux>:
+    1280:	       f3 0f 1e fa          	endbr64
+    1284:	       80 3d fd 3d 00 00 00 	cmpb   $0x0,0x3dfd(%rip)        # 5088 <completed.0>
+    128b:	/----- 75 2b                	jne    12b8 <__do_global_dtors_aux+0x38>
+    128d:	|      55                   	push   %rbp
+    128e:	|      48 83 3d 4a 3d 00 00 	cmpq   $0x0,0x3d4a(%rip)        # 4fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1295:	|      00 
+    1296:	|      48 89 e5             	mov    %rsp,%rbp
+    1299:	|  /-- 74 0c                	je     12a7 <__do_global_dtors_aux+0x27>
+    129b:	|  |   48 8b 3d be 3d 00 00 	mov    0x3dbe(%rip),%rdi        # 5060 <__dso_handle>
+    12a2:	|  |   e8 39 fe ff ff       	call   10e0 <__cxa_finalize@plt>
+    12a7:	|  \-> e8 64 ff ff ff       	call   1210 <deregister_tm_clones>
+    12ac:	|      c6 05 d5 3d 00 00 01 	movb   $0x1,0x3dd5(%rip)        # 5088 <completed.0>
+    12b3:	|      5d                   	pop    %rbp
+    12b4:	|      c3                   	ret
+    12b5:	|      0f 1f 00             	nopl   (%rax)
+    12b8:	\----> c3                   	ret
+    12b9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000012c0 <frame_dummy>:
+    12c0:	f3 0f 1e fa          	endbr64
+    12c4:	e9 77 ff ff ff       	jmp    1240 <register_tm_clones>
+    12c9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000012d0 <_close_r>:
+#include <nel/defs.hh>
+    12d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12d5:	c3                   	ret
+    12d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12dd:	00 00 00 
+
+00000000000012e0 <_fstat_r>:
+typedef nel::heaped::Vector<U8Buf<256>> Vec1;
+    12e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12e5:	c3                   	ret
+    12e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12ed:	00 00 00 
+
+00000000000012f0 <_kill_r>:
+{
+    12f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12f5:	c3                   	ret
+    12f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12fd:	00 00 00 
+
+0000000000001300 <_lseek_r>:
+    vec1.push((uint8_t)0x67).is_ok();
+    1300:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1305:	c3                   	ret
+    1306:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    130d:	00 00 00 
+
+0000000000001310 <_read_r>:
+    vec1.push((uint8_t)0x68).is_ok();
+    1310:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1315:	c3                   	ret
+    1316:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    131d:	00 00 00 
+
+0000000000001320 <_write_r>:
+}
+    1320:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1325:	c3                   	ret
+    1326:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    132d:	00 00 00 
+
+0000000000001330 <_getpid_r>:
+{
+    1330:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1335:	c3                   	ret
+    1336:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    133d:	00 00 00 
+
+0000000000001340 <_isatty_r>:
+    nel::log << "ex1:b" << '\n';
+    1340:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1345:	c3                   	ret
+    1346:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    134d:	00 00 00 
+
+0000000000001350 <ex1()>:
+{
+    1350:	                                                                                           41 57                	push   %r15
+    1352:	                                                                                           48 8d 05 0f 1d 00 00 	lea    0x1d0f(%rip),%rax        # 3068 <_IO_stdin_used+0x68>
+            if (align == 0 || (align & (align - 1)) != 0) {
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+            }
+            void *const new_p = is_over_aligned(align)
+                                    ? realloc_aligned(p, align, old_size, new_size)
+                                    : std::realloc(p, new_size);
+    1359:	                                                                                           bf 10 05 00 00       	mov    $0x510,%edi
+    135e:	                                                                                           48 8d 15 9f 1c 00 00 	lea    0x1c9f(%rip),%rdx        # 3004 <_IO_stdin_used+0x4>
+    1365:	                                                                                           41 56                	push   %r14
+    1367:	                                                                                           66 48 0f 6e ca       	movq   %rdx,%xmm1
+    136c:	                                                                                           66 48 0f 6e d8       	movq   %rax,%xmm3
+    1371:	                                                                                           48 8d 15 90 1c 00 00 	lea    0x1c90(%rip),%rdx        # 3008 <_IO_stdin_used+0x8>
+    1378:	                                                                                           41 55                	push   %r13
+    137a:	                                                                                           48 8d 05 8f 1c 00 00 	lea    0x1c8f(%rip),%rax        # 3010 <_IO_stdin_used+0x10>
+    1381:	                                                                                           66 48 0f 6e d2       	movq   %rdx,%xmm2
+    1386:	                                                                                           66 0f 6c cb          	punpcklqdq %xmm3,%xmm1
+    138a:	                                                                                           41 54                	push   %r12
+    138c:	                                                                                           66 48 0f 6e e0       	movq   %rax,%xmm4
+    1391:	                                                                                           55                   	push   %rbp
+    1392:	                                                                                           66 0f 6c d4          	punpcklqdq %xmm4,%xmm2
+    1396:	                                                                                           53                   	push   %rbx
+    1397:	                                                                                           48 81 ec 68 01 00 00 	sub    $0x168,%rsp
+    139e:	                                                                                           0f 29 0c 24          	movaps %xmm1,(%rsp)
+    13a2:	                                                                                           0f 29 54 24 20       	movaps %xmm2,0x20(%rsp)
+    13a7:	                                                                                           e8 04 fd ff ff       	call   10b0 <malloc@plt>
+            if (new_p == nullptr) {
+    13ac:	                                                                                           48 85 c0             	test   %rax,%rax
+    13af:	            /----------------------------------------------------------------------------- 0f 84 27 08 00 00    	je     1bdc <ex1()+0x88c>
+                    // poison new memory,
+                    // assumes realloc adds to end
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+                }
+            }
+            new_n->alloc_ = new_cap;
+    13b5:	            |                                                                              66 0f 6f 05 f3 1c 00 	movdqa 0x1cf3(%rip),%xmm0        # 30b0 <_IO_stdin_used+0xb0>
+    13bc:	            |                                                                              00 
+    13bd:	            |                                                                              49 89 c6             	mov    %rax,%r14
+    13c0:	            |                                                                              0f 11 00             	movups %xmm0,(%rax)
+        }
+
+        // constexpr explicit U8Buf(uint8_t const f) {
+        constexpr U8Buf(uint8_t const f)
+        {
+            nel::elem::set(data_, f, N);
+    13c3:	         /--|----------------------------------------------------------------------------> 49 8d 46 10          	lea    0x10(%r14),%rax
+    13c7:	         |  |                                                                              ba 00 01 00 00       	mov    $0x100,%edx
+    13cc:	         |  |                                                                              be 67 00 00 00       	mov    $0x67,%esi
+    13d1:	         |  |                                                                              48 89 c7             	mov    %rax,%rdi
+    13d4:	         |  |                                                                              48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    13d9:	         |  |                                                                              e8 72 0a 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+            len_ += 1;
+    13de:	         |  |                                                                              49 83 46 08 01       	addq   $0x1,0x8(%r14)
+            return len_;
+    13e3:	         |  |                                                                              49 8b 5e 08          	mov    0x8(%r14),%rbx
+            return alloc_;
+    13e7:	         |  |                                                                              4d 8b 26             	mov    (%r14),%r12
+
+    private:
+        // Make room for n more values, only ever grows.
+        bool try_reserve_for(Count const n)
+        {
+            if (len() + n <= capacity()) { return true; }
+    13ea:	         |  |                                                                              48 8d 43 01          	lea    0x1(%rbx),%rax
+    13ee:	         |  |                                                                              49 39 c4             	cmp    %rax,%r12
+    13f1:	         |  |                                                                          /-- 0f 82 ae 00 00 00    	jb     14a5 <ex1()+0x155>
+            if (len() >= capacity()) {
+    13f7:	         |  |                                                              /-----------|-> 4c 39 e3             	cmp    %r12,%rbx
+    13fa:	         |  |                                                              |  /--------|-- 0f 82 96 01 00 00    	jb     1596 <ex1()+0x246>
+    1400:	         |  |                                                              |  |  /-----|-> 48 8d 5c 24 54       	lea    0x54(%rsp),%rbx
+    1405:	         |  |                                                              |  |  |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    140a:	         |  |                                                              |  |  |     |   be 68 00 00 00       	mov    $0x68,%esi
+        {
+        }
+
+        template<typename... Args>
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+            : tag_(Tag::ERR)
+    140f:	         |  |                                                              |  |  |     |   c7 44 24 50 02 00 00 	movl   $0x2,0x50(%rsp)
+    1416:	         |  |                                                              |  |  |     |   00 
+    1417:	         |  |                                                              |  |  |     |   48 89 df             	mov    %rbx,%rdi
+    141a:	         |  |                                                              |  |  |     |   e8 31 0a 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    141f:	         |  |                                                              |  |  |     |   66 0f 6f 34 24       	movdqa (%rsp),%xmm6
+    1424:	         |  |                                                              |  |  |     |   8b 44 24 50          	mov    0x50(%rsp),%eax
+    1428:	         |  |                                                              |  |  |     |   0f 29 74 24 30       	movaps %xmm6,0x30(%rsp)
+        // match(Tag tag, std::function<V(void)> on_ok, std::function<V(void)> on_err) const
+        //
+        template<typename V, typename Fn1, typename Fn2>
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+        {
+            switch (tag_) { // result<void>-match
+    142d:	         |  |                                                              |  |  |     |   83 f8 01             	cmp    $0x1,%eax
+    1430:	         |  |                                                           /--|--|--|-----|-- 0f 84 f7 02 00 00    	je     172d <ex1()+0x3dd>
+            , file_name_(file_name)
+            , line_num_(line_num)
+    1436:	         |  |  /--------------------------------------------------------|--|--|--|-----|-> c7 44 24 40 10 00 00 	movl   $0x10,0x40(%rsp)
+    143d:	         |  |  |                                                        |  |  |  |     |   00 
+    143e:	         |  |  |                                                        |  |  |  |     |   83 f8 02             	cmp    $0x2,%eax
+    1441:	         |  |  |                          /-----------------------------|--|--|--|-----|-- 0f 85 29 05 00 00    	jne    1970 <ex1()+0x620>
+            nel::elem::set(data_, 0xa5, N);
+    1447:	         |  |  |                          |                             |  |  |  |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    144c:	         |  |  |                          |                             |  |  |  |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    1451:	         |  |  |                          |                             |  |  |  |     |   48 89 df             	mov    %rbx,%rdi
+    1454:	         |  |  |                          |                             |  |  |  |     |   e8 f7 09 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return (item_ == nullptr) ? 0 : item_->len();
+    1459:	         |  |  |     /--------------------|-----------------------------|--|--|--|-----|-> 4d 85 f6             	test   %r14,%r14
+    145c:	         |  |  |     |                    |                             +--|--|--|-----|-- 0f 85 cb 02 00 00    	jne    172d <ex1()+0x3dd>
+                                    : std::realloc(p, new_size);
+    1462:	         |  |  |     |                    |                             |  |  |  |     |   bf 10 04 00 00       	mov    $0x410,%edi
+    1467:	         |  |  |     |                    |                             |  |  |  |     |   e8 44 fc ff ff       	call   10b0 <malloc@plt>
+    146c:	         |  |  |     |                    |                             |  |  |  |     |   49 89 c6             	mov    %rax,%r14
+            if (new_p == nullptr) {
+    146f:	         |  |  |     |                    |                             |  |  |  |     |   48 85 c0             	test   %rax,%rax
+    1472:	         |  |  |     |                    |           /-----------------|--|--|--|-----|-- 0f 84 1d 05 00 00    	je     1995 <ex1()+0x645>
+            new_n->alloc_ = new_cap;
+    1478:	         |  |  |     |                    |           |                 |  |  |  |     |   66 0f 6f 05 40 1c 00 	movdqa 0x1c40(%rip),%xmm0        # 30c0 <_IO_stdin_used+0xc0>
+    147f:	         |  |  |     |                    |           |                 |  |  |  |     |   00 
+    1480:	         |  |  |     |                    |           |                 |  |  |  |     |   0f 11 00             	movups %xmm0,(%rax)
+    1483:	         |  |  |     |                    |           |                 |  |  |  |     |   b8 10 00 00 00       	mov    $0x10,%eax
+            nel::elem::set(data_, f, N);
+    1488:	         |  |  |     |                    |           |     /-----------|--|--|--|-----|-> 49 8d 3c 06          	lea    (%r14,%rax,1),%rdi
+    148c:	         |  |  |     |                    |           |     |           |  |  |  |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    1491:	         |  |  |     |                    |           |     |           |  |  |  |     |   be 69 00 00 00       	mov    $0x69,%esi
+    1496:	         |  |  |     |                    |           |     |           |  |  |  |     |   e8 b5 09 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            len_ += 1;
+    149b:	         |  |  |     |                    |           |     |           |  |  |  |     |   49 83 46 08 01       	addq   $0x1,0x8(%r14)
+        constexpr Slice<Type> slice(void)
+    14a0:	         |  |  |     |                    |     /-----|-----|-----------|--|--|--|-----|-- e9 45 05 00 00       	jmp    19ea <ex1()+0x69a>
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            if (cap <= cur) { return cap; }
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    14a5:	         |  |  |     |                    |     |     |     |           |  |  |  |     \-> 49 83 fc 03          	cmp    $0x3,%r12
+    14a9:	         |  |  |     |                    |     |     |     |           |  |  |  |  /----- 0f 87 f7 00 00 00    	ja     15a6 <ex1()+0x256>
+    14af:	         |  |  |     |                    |     |     |     |           |  |  |  |  |      ba 04 00 00 00       	mov    $0x4,%edx
+    14b4:	         |  |  |     |                    |     |     |     |           |  |  |  |  |      48 39 d0             	cmp    %rdx,%rax
+    14b7:	         |  |  |     |                    |     |     |     |           |  |  |  |  |      48 0f 42 c2          	cmovb  %rdx,%rax
+    14bb:	         |  |  |     |                    |     |     |     |           |  |  |  |  |      48 39 d8             	cmp    %rbx,%rax
+    14be:	         |  |  |     |                    |     |     |     |           |  |  |  |  |      48 0f 42 c3          	cmovb  %rbx,%rax
+    14c2:	         |  |  |     |                    |     |     |     |           |  |  |  |  |      49 89 c4             	mov    %rax,%r12
+            if (new_cap > max_capacity) { return nullptr; }
+    14c5:	         |  |  |  /--|--------------------|-----|-----|-----|-----------|--|--|--|--|----> 48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    14cc:	         |  |  |  |  |                    |     |     |     |           |  |  |  |  |      ff 7f 00 
+    14cf:	         |  |  |  |  |                    |     |     |     |           |  |  |  |  |      4c 39 e0             	cmp    %r12,%rax
+    14d2:	         |  |  |  |  |  /-----------------|-----|-----|-----|-----------|--|--|--|--|----- 0f 82 2a 07 00 00    	jb     1c02 <ex1()+0x8b2>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    14d8:	         |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      4c 89 e7             	mov    %r12,%rdi
+    14db:	         |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      48 c1 e7 08          	shl    $0x8,%rdi
+    14df:	         |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      48 83 c7 10          	add    $0x10,%rdi
+                                    : std::realloc(p, new_size);
+    14e3:	         |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      e8 c8 fb ff ff       	call   10b0 <malloc@plt>
+    14e8:	         |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      48 89 c5             	mov    %rax,%rbp
+            if (new_p == nullptr) {
+    14eb:	         |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      48 85 c0             	test   %rax,%rax
+    14ee:	         |  |  |  |  |  +-----------------|-----|-----|-----|-----------|--|--|--|--|----- 0f 84 0e 07 00 00    	je     1c02 <ex1()+0x8b2>
+            : fn_name_(fn_name)
+    14f4:	         |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      66 0f 6f 74 24 20    	movdqa 0x20(%rsp),%xmm6
+            , line_num_(line_num)
+    14fa:	         |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      c7 44 24 60 91 00 00 	movl   $0x91,0x60(%rsp)
+    1501:	         |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      00 
+            : fn_name_(fn_name)
+    1502:	         |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      0f 29 74 24 50       	movaps %xmm6,0x50(%rsp)
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    1507:	         |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      49 39 dc             	cmp    %rbx,%r12
+    150a:	/--------|--|--|--|--|--|-----------------|-----|-----|-----|-----------|--|--|--|--|----- 0f 82 08 09 00 00    	jb     1e18 <ex1()+0xac8>
+                    new_n->len_ = old_n->len_;
+    1510:	|        |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      48 89 58 08          	mov    %rbx,0x8(%rax)
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    1514:	|        |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      4c 8d 68 10          	lea    0x10(%rax),%r13
+void relocate(uint8_t *const d, uint8_t *const s, Length const n);
+
+template<typename T>
+void relocate(T d[], T s[], Length const n)
+{
+    if (d == s) { return; }
+    1518:	|        |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      4c 39 6c 24 18       	cmp    %r13,0x18(%rsp)
+    151d:	|  /-----|--|--|--|--|--|-----------------|-----|-----|-----|-----------|--|--|--|--|----- 74 5b                	je     157a <ex1()+0x22a>
+    if constexpr (is_trivially_relocatable<T>) {
+        relocate(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t *>(s), n * sizeof(T));
+    } else if (d < s) {
+    151f:	|  |     |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      48 8b 44 24 18       	mov    0x18(%rsp),%rax
+    1524:	|  |     |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      49 39 c5             	cmp    %rax,%r13
+    1527:	|  |  /--|--|--|--|--|--|-----------------|-----|-----|-----|-----------|--|--|--|--|----- 0f 83 38 08 00 00    	jae    1d65 <ex1()+0xa15>
+        // forwards, so overlap is not overwritten before it is read.
+        for (Index i = 0; i < n; ++i) {
+    152d:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      48 85 db             	test   %rbx,%rbx
+    1530:	|  +--|--|--|--|--|--|--|-----------------|-----|-----|-----|-----------|--|--|--|--|----- 74 48                	je     157a <ex1()+0x22a>
+    1532:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      49 89 c7             	mov    %rax,%r15
+    1535:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      31 c0                	xor    %eax,%eax
+            nel::elem::move(data_, o.data_, N);
+    1537:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |  /-> 4c 89 fe             	mov    %r15,%rsi
+    153a:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |  |   4c 89 ef             	mov    %r13,%rdi
+    153d:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1542:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |  |   48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    1547:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |  |   e8 14 09 00 00       	call   1e60 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    154c:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |  |   4c 89 ff             	mov    %r15,%rdi
+    154f:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1554:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    1559:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |  |   e8 f2 08 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    155e:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |  |   48 8b 44 24 18       	mov    0x18(%rsp),%rax
+    1563:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |  |   49 81 c7 00 01 00 00 	add    $0x100,%r15
+    156a:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |  |   49 81 c5 00 01 00 00 	add    $0x100,%r13
+    1571:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |  |   48 83 c0 01          	add    $0x1,%rax
+    1575:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |  |   48 39 d8             	cmp    %rbx,%rax
+    1578:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |  \-- 75 bd                	jne    1537 <ex1()+0x1e7>
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    157a:	|  >--|--|--|--|--|--|--|-----------------|-----|-----|-----|-----------|--|--|--|--|----> 4c 89 f7             	mov    %r14,%rdi
+                item_ = p;
+    157d:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      49 89 ee             	mov    %rbp,%r14
+    1580:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      e8 ab fa ff ff       	call   1030 <free@plt>
+            return len_;
+    1585:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      48 8b 5d 08          	mov    0x8(%rbp),%rbx
+            new_n->alloc_ = new_cap;
+    1589:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      4c 89 65 00          	mov    %r12,0x0(%rbp)
+            if (len() >= capacity()) {
+    158d:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  |  |      4c 39 e3             	cmp    %r12,%rbx
+    1590:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  |  \--|----- 0f 83 6a fe ff ff    	jae    1400 <ex1()+0xb0>
+    1596:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |  \-----|----> 48 89 d8             	mov    %rbx,%rax
+    1599:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |        |      48 c1 e0 08          	shl    $0x8,%rax
+    159d:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |        |      48 83 c0 10          	add    $0x10,%rax
+    15a1:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |     /--|----- e9 6f 01 00 00       	jmp    1715 <ex1()+0x3c5>
+    15a6:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |     |  \----> 4b 8d 2c 24          	lea    (%r12,%r12,1),%rbp
+    15aa:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |     |         48 39 c5             	cmp    %rax,%rbp
+    15ad:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |     |         48 0f 42 e8          	cmovb  %rax,%rbp
+    15b1:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |     |         48 39 dd             	cmp    %rbx,%rbp
+    15b4:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |     |         48 0f 42 eb          	cmovb  %rbx,%rbp
+            } else if (new_cap == item_->capacity()) {
+    15b8:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |     |         4c 39 e5             	cmp    %r12,%rbp
+    15bb:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  +-----|-------- 0f 84 36 fe ff ff    	je     13f7 <ex1()+0xa7>
+            } else if (new_cap > item_->capacity()) {
+    15c1:	|  |  |  |  |  |  |  |  |                 |     |     |     |           |  |     |         49 39 ec             	cmp    %rbp,%r12
+    15c4:	|  |  |  |  |  |  |  |  |  /--------------|-----|-----|-----|-----------|--|-----|-------- 0f 82 df 06 00 00    	jb     1ca9 <ex1()+0x959>
+            if (new_cap > max_capacity) { return nullptr; }
+    15ca:	|  |  |  |  |  |  |  |  |  |              |     |     |     |           |  |     |         48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    15d1:	|  |  |  |  |  |  |  |  |  |              |     |     |     |           |  |     |         ff 7f 00 
+    15d4:	|  |  |  |  |  |  |  |  |  |              |     |     |     |           |  |     |         48 39 e8             	cmp    %rbp,%rax
+    15d7:	|  |  |  |  |  |  |  |  +--|--------------|-----|-----|-----|-----------|--|-----|-------- 0f 82 25 06 00 00    	jb     1c02 <ex1()+0x8b2>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    15dd:	|  |  |  |  |  |  |  |  |  |              |     |     |     |           |  |     |         48 89 ef             	mov    %rbp,%rdi
+    15e0:	|  |  |  |  |  |  |  |  |  |              |     |     |     |           |  |     |         48 c1 e7 08          	shl    $0x8,%rdi
+    15e4:	|  |  |  |  |  |  |  |  |  |              |     |     |     |           |  |     |         48 83 c7 10          	add    $0x10,%rdi
+                                    : std::realloc(p, new_size);
+    15e8:	|  |  |  |  |  |  |  |  |  |              |     |     |     |           |  |     |         e8 c3 fa ff ff       	call   10b0 <malloc@plt>
+    15ed:	|  |  |  |  |  |  |  |  |  |              |     |     |     |           |  |     |         49 89 c5             	mov    %rax,%r13
+            if (new_p == nullptr) {
+    15f0:	|  |  |  |  |  |  |  |  |  |              |     |     |     |           |  |     |         48 85 c0             	test   %rax,%rax
+    15f3:	|  |  |  |  |  |  |  |  +--|--------------|-----|-----|-----|-----------|--|-----|-------- 0f 84 09 06 00 00    	je     1c02 <ex1()+0x8b2>
+            : fn_name_(fn_name)
+    15f9:	|  |  |  |  |  |  |  |  |  |              |     |     |     |           |  |     |         66 0f 6f 7c 24 20    	movdqa 0x20(%rsp),%xmm7
+            , line_num_(line_num)
+    15ff:	|  |  |  |  |  |  |  |  |  |              |     |     |     |           |  |     |         c7 44 24 60 91 00 00 	movl   $0x91,0x60(%rsp)
+    1606:	|  |  |  |  |  |  |  |  |  |              |     |     |     |           |  |     |         00 
+            : fn_name_(fn_name)
+    1607:	|  |  |  |  |  |  |  |  |  |              |     |     |     |           |  |     |         0f 29 7c 24 50       	movaps %xmm7,0x50(%rsp)
+    if (!pred) { assert_fail(msg, ctx); }
+    160c:	|  |  |  |  |  |  |  |  |  |              |     |     |     |           |  |     |         48 39 dd             	cmp    %rbx,%rbp
+    160f:	+--|--|--|--|--|--|--|--|--|--------------|-----|-----|-----|-----------|--|-----|-------- 0f 82 03 08 00 00    	jb     1e18 <ex1()+0xac8>
+                    new_n->len_ = old_n->len_;
+    1615:	|  |  |  |  |  |  |  |  |  |              |     |     |     |           |  |     |         48 89 58 08          	mov    %rbx,0x8(%rax)
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    1619:	|  |  |  |  |  |  |  |  |  |              |     |     |     |           |  |     |         4c 8d 60 10          	lea    0x10(%rax),%r12
+    if (d == s) { return; }
+    161d:	|  |  |  |  |  |  |  |  |  |              |     |     |     |           |  |     |         4c 39 64 24 18       	cmp    %r12,0x18(%rsp)
+    1622:	|  |  |  |  |  |  |  |  |  |  /-----------|-----|-----|-----|-----------|--|-----|-------- 74 5b                	je     167f <ex1()+0x32f>
+    } else if (d < s) {
+    1624:	|  |  |  |  |  |  |  |  |  |  |           |     |     |     |           |  |     |         48 8b 44 24 18       	mov    0x18(%rsp),%rax
+    1629:	|  |  |  |  |  |  |  |  |  |  |           |     |     |     |           |  |     |         49 39 c4             	cmp    %rax,%r12
+    162c:	|  |  |  |  |  |  |  |  |  |  |  /--------|-----|-----|-----|-----------|--|-----|-------- 0f 83 7f 06 00 00    	jae    1cb1 <ex1()+0x961>
+        for (Index i = 0; i < n; ++i) {
+    1632:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |         48 85 db             	test   %rbx,%rbx
+    1635:	|  |  |  |  |  |  |  |  |  |  +--|--------|-----|-----|-----|-----------|--|-----|-------- 74 48                	je     167f <ex1()+0x32f>
+    1637:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |         49 89 c7             	mov    %rax,%r15
+    163a:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |         31 c0                	xor    %eax,%eax
+            nel::elem::move(data_, o.data_, N);
+    163c:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |     /-> 4c 89 fe             	mov    %r15,%rsi
+    163f:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |     |   4c 89 e7             	mov    %r12,%rdi
+    1642:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    1647:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |     |   48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    164c:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |     |   e8 0f 08 00 00       	call   1e60 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1651:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |     |   4c 89 ff             	mov    %r15,%rdi
+    1654:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    1659:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    165e:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |     |   e8 ed 07 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1663:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |     |   48 8b 44 24 18       	mov    0x18(%rsp),%rax
+    1668:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |     |   49 81 c7 00 01 00 00 	add    $0x100,%r15
+    166f:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |     |   49 81 c4 00 01 00 00 	add    $0x100,%r12
+    1676:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |     |   48 83 c0 01          	add    $0x1,%rax
+    167a:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |     |   48 39 d8             	cmp    %rbx,%rax
+    167d:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |     \-- 75 bd                	jne    163c <ex1()+0x2ec>
+                std::free(p);
+    167f:	|  |  |  |  |  |  |  |  |  |  >--|--------|-----|-----|-----|-----------|--|-----|-------> 4c 89 f7             	mov    %r14,%rdi
+            return len_;
+    1682:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |         49 89 ec             	mov    %rbp,%r12
+                item_ = p;
+    1685:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |         4d 89 ee             	mov    %r13,%r14
+    1688:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |         e8 a3 f9 ff ff       	call   1030 <free@plt>
+            new_n->alloc_ = new_cap;
+    168d:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |         49 89 6d 00          	mov    %rbp,0x0(%r13)
+            return len_;
+    1691:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  |     |         49 8b 5d 08          	mov    0x8(%r13),%rbx
+    1695:	|  |  |  |  |  |  |  |  |  |  |  |        |     |     |     |           |  \-----|-------- e9 5d fd ff ff       	jmp    13f7 <ex1()+0xa7>
+            nel::elem::set(data_, f, N);
+    169a:	|  |  |  |  |  |  |  |  |  |  |  |        |  /--|-----|-----|-----------|--------|-------> 48 8d 5c 24 54       	lea    0x54(%rsp),%rbx
+    169f:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |         ba 00 01 00 00       	mov    $0x100,%edx
+    16a4:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |         be 67 00 00 00       	mov    $0x67,%esi
+            : tag_(Tag::ERR)
+    16a9:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |         c7 44 24 50 02 00 00 	movl   $0x2,0x50(%rsp)
+    16b0:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |         00 
+    16b1:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |         48 89 df             	mov    %rbx,%rdi
+    16b4:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |         e8 97 07 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            : fn_name_(fn_name)
+    16b9:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |         66 0f 6f 2c 24       	movdqa (%rsp),%xmm5
+    16be:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |         8b 44 24 50          	mov    0x50(%rsp),%eax
+            , line_num_(line_num)
+    16c2:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |         c7 44 24 40 0f 00 00 	movl   $0xf,0x40(%rsp)
+    16c9:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |         00 
+            : fn_name_(fn_name)
+    16ca:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |         0f 29 6c 24 30       	movaps %xmm5,0x30(%rsp)
+            switch (tag_) { // result<void>-match
+    16cf:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |         83 f8 01             	cmp    $0x1,%eax
+    16d2:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |     /-- 74 1b                	je     16ef <ex1()+0x39f>
+    16d4:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |     |   83 f8 02             	cmp    $0x2,%eax
+    16d7:	|  |  |  |  |  |  |  |  |  |  |  |        +--|--|-----|-----|-----------|--------|-----|-- 0f 85 93 02 00 00    	jne    1970 <ex1()+0x620>
+            nel::elem::set(data_, 0xa5, N);
+    16dd:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    16e2:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    16e7:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |     |   48 89 df             	mov    %rbx,%rdi
+    16ea:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |     |   e8 61 07 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+                                    : std::realloc(p, new_size);
+    16ef:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |     \-> bf 10 04 00 00       	mov    $0x410,%edi
+    16f4:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |         e8 b7 f9 ff ff       	call   10b0 <malloc@plt>
+    16f9:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |         49 89 c6             	mov    %rax,%r14
+            if (new_p == nullptr) {
+    16fc:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |     |           |        |         48 85 c0             	test   %rax,%rax
+    16ff:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  /--|-----------|--------|-------- 0f 84 02 05 00 00    	je     1c07 <ex1()+0x8b7>
+            new_n->alloc_ = new_cap;
+    1705:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |           |        |         66 0f 6f 05 b3 19 00 	movdqa 0x19b3(%rip),%xmm0        # 30c0 <_IO_stdin_used+0xc0>
+    170c:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |           |        |         00 
+    170d:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |           |        |         0f 11 00             	movups %xmm0,(%rax)
+    1710:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |           |        |         b8 10 00 00 00       	mov    $0x10,%eax
+            nel::elem::set(data_, f, N);
+    1715:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |           |        \-------> 49 8d 3c 06          	lea    (%r14,%rax,1),%rdi
+    1719:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |           |                  ba 00 01 00 00       	mov    $0x100,%edx
+    171e:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |           |                  be 68 00 00 00       	mov    $0x68,%esi
+    1723:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |           |                  e8 28 07 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            len_ += 1;
+    1728:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |           |                  49 83 46 08 01       	addq   $0x1,0x8(%r14)
+            return len_;
+    172d:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |           \----------------> 49 8b 5e 08          	mov    0x8(%r14),%rbx
+            return alloc_;
+    1731:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |                              4d 8b 26             	mov    (%r14),%r12
+            if (len() + n <= capacity()) { return true; }
+    1734:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |                              48 8d 43 01          	lea    0x1(%rbx),%rax
+    1738:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |                              49 39 c4             	cmp    %rax,%r12
+    173b:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |              /-------------- 0f 83 e2 00 00 00    	jae    1823 <ex1()+0x4d3>
+    1741:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |              |               49 83 fc 03          	cmp    $0x3,%r12
+    1745:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |              |        /----- 0f 87 1c 01 00 00    	ja     1867 <ex1()+0x517>
+    174b:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |              |        |      ba 04 00 00 00       	mov    $0x4,%edx
+    1750:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |              |        |      48 39 d0             	cmp    %rdx,%rax
+    1753:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |              |        |      48 0f 42 c2          	cmovb  %rdx,%rax
+    1757:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |              |        |      48 39 d8             	cmp    %rbx,%rax
+    175a:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |              |        |      48 0f 42 c3          	cmovb  %rbx,%rax
+    175e:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |     |  |  |              |        |      49 89 c4             	mov    %rax,%r12
+            if (new_cap > max_capacity) { return nullptr; }
+    1761:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  /--|--|--|--------------|--------|----> 48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    1768:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |              |        |      ff 7f 00 
+    176b:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |              |        |      4c 39 e0             	cmp    %r12,%rax
+    176e:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |        /-----|--------|----- 0f 82 1c 02 00 00    	jb     1990 <ex1()+0x640>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1774:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |        |     |        |      4c 89 e7             	mov    %r12,%rdi
+    1777:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |        |     |        |      48 c1 e7 08          	shl    $0x8,%rdi
+    177b:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |        |     |        |      48 83 c7 10          	add    $0x10,%rdi
+                                    : std::realloc(p, new_size);
+    177f:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |        |     |        |      e8 2c f9 ff ff       	call   10b0 <malloc@plt>
+    1784:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |        |     |        |      48 89 c5             	mov    %rax,%rbp
+            if (new_p == nullptr) {
+    1787:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |        |     |        |      48 85 c0             	test   %rax,%rax
+    178a:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |        +-----|--------|----- 0f 84 00 02 00 00    	je     1990 <ex1()+0x640>
+    1790:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |        |     |        |      66 0f 6f 7c 24 20    	movdqa 0x20(%rsp),%xmm7
+            , line_num_(line_num)
+    1796:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |        |     |        |      c7 44 24 60 91 00 00 	movl   $0x91,0x60(%rsp)
+    179d:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |        |     |        |      00 
+            : fn_name_(fn_name)
+    179e:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |        |     |        |      0f 29 7c 24 50       	movaps %xmm7,0x50(%rsp)
+    if (!pred) { assert_fail(msg, ctx); }
+    17a3:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |        |     |        |      49 39 dc             	cmp    %rbx,%r12
+    17a6:	+--|--|--|--|--|--|--|--|--|--|--|--------|--|--|--|--|--|--|--------|-----|--------|----- 0f 82 6c 06 00 00    	jb     1e18 <ex1()+0xac8>
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    17ac:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |        |     |        |      4d 8d 6e 10          	lea    0x10(%r14),%r13
+    17b0:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |        |     |        |      4c 8d 78 10          	lea    0x10(%rax),%r15
+                    new_n->len_ = old_n->len_;
+    17b4:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |        |     |        |      48 89 58 08          	mov    %rbx,0x8(%rax)
+    if (d == s) { return; }
+    17b8:	|  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  |  |        |     |        |      4d 39 fd             	cmp    %r15,%r13
+    17bb:	|  |  |  |  |  |  |  |  |  |  |  |  /-----|--|--|--|--|--|--|--------|-----|--------|----- 74 53                	je     1810 <ex1()+0x4c0>
+    } else if (d < s) {
+    17bd:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |        |     |        |      4d 39 ef             	cmp    %r13,%r15
+    17c0:	|  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|--|--|--|--|--|--------|-----|--------|----- 0f 83 f9 05 00 00    	jae    1dbf <ex1()+0xa6f>
+        for (Index i = 0; i < n; ++i) {
+    17c6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |      48 85 db             	test   %rbx,%rbx
+    17c9:	|  |  |  |  |  |  |  |  |  |  |  |  +--|--|--|--|--|--|--|--|--------|-----|--------|----- 74 45                	je     1810 <ex1()+0x4c0>
+    17cb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |      31 c0                	xor    %eax,%eax
+            nel::elem::move(data_, o.data_, N);
+    17cd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |  /-> 4c 89 ee             	mov    %r13,%rsi
+    17d0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |  |   4c 89 ff             	mov    %r15,%rdi
+    17d3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    17d8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |  |   48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    17dd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |  |   e8 7e 06 00 00       	call   1e60 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    17e2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |  |   4c 89 ef             	mov    %r13,%rdi
+    17e5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    17ea:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    17ef:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |  |   e8 5c 06 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    17f4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |  |   48 8b 44 24 18       	mov    0x18(%rsp),%rax
+    17f9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |  |   49 81 c7 00 01 00 00 	add    $0x100,%r15
+    1800:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |  |   49 81 c5 00 01 00 00 	add    $0x100,%r13
+    1807:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |  |   48 83 c0 01          	add    $0x1,%rax
+    180b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |  |   48 39 d8             	cmp    %rbx,%rax
+    180e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |  \-- 75 bd                	jne    17cd <ex1()+0x47d>
+                std::free(p);
+    1810:	|  |  |  |  |  |  |  |  |  |  |  |  >--|--|--|--|--|--|--|--|--------|-----|--------|----> 4c 89 f7             	mov    %r14,%rdi
+                item_ = p;
+    1813:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |      49 89 ee             	mov    %rbp,%r14
+    1816:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |      e8 15 f8 ff ff       	call   1030 <free@plt>
+            new_n->alloc_ = new_cap;
+    181b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |      4c 89 65 00          	mov    %r12,0x0(%rbp)
+            return len_;
+    181f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |        |      48 8b 5d 08          	mov    0x8(%rbp),%rbx
+            if (len() >= capacity()) {
+    1823:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     >--------|----> 4c 39 e3             	cmp    %r12,%rbx
+    1826:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  /-----|----- 0f 82 31 01 00 00    	jb     195d <ex1()+0x60d>
+            nel::elem::set(data_, f, N);
+    182c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  /--|----> 48 8d 5c 24 54       	lea    0x54(%rsp),%rbx
+    1831:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |  |      ba 00 01 00 00       	mov    $0x100,%edx
+    1836:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |  |      be 69 00 00 00       	mov    $0x69,%esi
+            : tag_(Tag::ERR)
+    183b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |  |      c7 44 24 50 02 00 00 	movl   $0x2,0x50(%rsp)
+    1842:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |  |      00 
+    1843:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |  |      48 89 df             	mov    %rbx,%rdi
+    1846:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |  |      e8 05 06 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            : fn_name_(fn_name)
+    184b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |  |      66 0f 6f 2c 24       	movdqa (%rsp),%xmm5
+    1850:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |  |      8b 44 24 50          	mov    0x50(%rsp),%eax
+    1854:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |  |      0f 29 6c 24 30       	movaps %xmm5,0x30(%rsp)
+            switch (tag_) { // result<void>-match
+    1859:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |     |  |  |  |      83 f8 01             	cmp    $0x1,%eax
+    185c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  /--|--|--|--|----- 0f 85 60 01 00 00    	jne    19c2 <ex1()+0x672>
+    1862:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  +--|--|--|--|--------|--|--|--|--|--|----- e9 83 01 00 00       	jmp    19ea <ex1()+0x69a>
+    1867:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |  \----> 4b 8d 2c 24          	lea    (%r12,%r12,1),%rbp
+    186b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         48 39 c5             	cmp    %rax,%rbp
+    186e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         48 0f 42 e8          	cmovb  %rax,%rbp
+    1872:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         48 39 dd             	cmp    %rbx,%rbp
+    1875:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         48 0f 42 eb          	cmovb  %rbx,%rbp
+            } else if (new_cap == item_->capacity()) {
+    1879:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         4c 39 e5             	cmp    %r12,%rbp
+    187c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  \--|--|-------- 74 a5                	je     1823 <ex1()+0x4d3>
+            } else if (new_cap > item_->capacity()) {
+    187e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |     |  |         49 39 ec             	cmp    %rbp,%r12
+    1881:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  /--|--|-------- 0f 82 1a 04 00 00    	jb     1ca1 <ex1()+0x951>
+            if (new_cap > max_capacity) { return nullptr; }
+    1887:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    188e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         ff 7f 00 
+    1891:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         48 39 e8             	cmp    %rbp,%rax
+    1894:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        +--|--|--|--|-------- 0f 82 f6 00 00 00    	jb     1990 <ex1()+0x640>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    189a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         48 89 ef             	mov    %rbp,%rdi
+    189d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         48 c1 e7 08          	shl    $0x8,%rdi
+    18a1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         48 83 c7 10          	add    $0x10,%rdi
+                                    : std::realloc(p, new_size);
+    18a5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         e8 06 f8 ff ff       	call   10b0 <malloc@plt>
+    18aa:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         49 89 c5             	mov    %rax,%r13
+            if (new_p == nullptr) {
+    18ad:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         48 85 c0             	test   %rax,%rax
+    18b0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        +--|--|--|--|-------- 0f 84 da 00 00 00    	je     1990 <ex1()+0x640>
+    18b6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         66 0f 6f 5c 24 20    	movdqa 0x20(%rsp),%xmm3
+            , line_num_(line_num)
+    18bc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         c7 44 24 60 91 00 00 	movl   $0x91,0x60(%rsp)
+    18c3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         00 
+            : fn_name_(fn_name)
+    18c4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         0f 29 5c 24 50       	movaps %xmm3,0x50(%rsp)
+    if (!pred) { assert_fail(msg, ctx); }
+    18c9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         48 39 dd             	cmp    %rbx,%rbp
+    18cc:	+--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--------|--|--|--|--|-------- 0f 82 46 05 00 00    	jb     1e18 <ex1()+0xac8>
+                    new_n->len_ = old_n->len_;
+    18d2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         48 89 58 08          	mov    %rbx,0x8(%rax)
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    18d6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         4d 8d 65 10          	lea    0x10(%r13),%r12
+    18da:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         49 8d 46 10          	lea    0x10(%r14),%rax
+    18de:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    if (d == s) { return; }
+    18e3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |        |  |  |  |  |         4c 39 e0             	cmp    %r12,%rax
+    18e6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /-----|--|--|--|--|-------- 74 56                	je     193e <ex1()+0x5ee>
+    } else if (d < s) {
+    18e8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |         49 39 c4             	cmp    %rax,%r12
+    18eb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|--|--|--|-------- 0f 83 1a 04 00 00    	jae    1d0b <ex1()+0x9bb>
+        for (Index i = 0; i < n; ++i) {
+    18f1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 85 db             	test   %rbx,%rbx
+    18f4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  +--|--|--|--|--|--|-------- 74 48                	je     193e <ex1()+0x5ee>
+    18f6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         49 89 c7             	mov    %rax,%r15
+    18f9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         31 c0                	xor    %eax,%eax
+            nel::elem::move(data_, o.data_, N);
+    18fb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     /-> 4c 89 fe             	mov    %r15,%rsi
+    18fe:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   4c 89 e7             	mov    %r12,%rdi
+    1901:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    1906:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    190b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   e8 50 05 00 00       	call   1e60 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1910:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   4c 89 ff             	mov    %r15,%rdi
+    1913:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    1918:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    191d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   e8 2e 05 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1922:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 8b 44 24 18       	mov    0x18(%rsp),%rax
+    1927:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   49 81 c4 00 01 00 00 	add    $0x100,%r12
+    192e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   49 81 c7 00 01 00 00 	add    $0x100,%r15
+    1935:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 83 c0 01          	add    $0x1,%rax
+    1939:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |   48 39 d8             	cmp    %rbx,%rax
+    193c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     \-- 75 bd                	jne    18fb <ex1()+0x5ab>
+                std::free(p);
+    193e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  >--|--|--|--|--|--|-------> 4c 89 f7             	mov    %r14,%rdi
+            return len_;
+    1941:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         49 89 ec             	mov    %rbp,%r12
+                item_ = p;
+    1944:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         4d 89 ee             	mov    %r13,%r14
+    1947:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 e4 f6 ff ff       	call   1030 <free@plt>
+    194c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         49 8b 5d 08          	mov    0x8(%r13),%rbx
+            new_n->alloc_ = new_cap;
+    1950:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         49 89 6d 00          	mov    %rbp,0x0(%r13)
+            if (len() >= capacity()) {
+    1954:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         4c 39 e3             	cmp    %r12,%rbx
+    1957:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \-------- 0f 83 cf fe ff ff    	jae    182c <ex1()+0x4dc>
+    195d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \----------> 48 89 d8             	mov    %rbx,%rax
+    1960:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 c1 e0 08          	shl    $0x8,%rax
+    1964:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 83 c0 10          	add    $0x10,%rax
+    1968:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \--|--|--|--|--|-------------- e9 1b fb ff ff       	jmp    1488 <ex1()+0x138>
+    196d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |               0f 1f 00             	nopl   (%rax)
+                    // if they do it's a use-after-move-from op so must panic.
+                    // or a use-before-initialised so again must panic.
+                    nel::panic("invalid Result", ctx);
+                    break;
+                default:
+                    nel::panic("bad Result", ctx);
+    1970:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  >--|--|--|--|--|-----|--|--|--|--|-------------> 48 8d 74 24 30       	lea    0x30(%rsp),%rsi
+            switch (tag_) { // result<void>-match
+    1975:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |               85 c0                	test   %eax,%eax
+    1977:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|--|--|--|-------------- 0f 84 b3 04 00 00    	je     1e30 <ex1()+0xae0>
+                    nel::panic("bad Result", ctx);
+    197d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               48 8d 3d b2 16 00 00 	lea    0x16b2(%rip),%rdi        # 3036 <_IO_stdin_used+0x36>
+    1984:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               e8 99 f7 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1989:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |               0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1990:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \--|--|-------------> 48 8d 5c 24 54       	lea    0x54(%rsp),%rbx
+            nel::elem::set(data_, f, N);
+    1995:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  \--|--|--|--|-----|--|-------------> ba 00 01 00 00       	mov    $0x100,%edx
+    199a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |               be 69 00 00 00       	mov    $0x69,%esi
+    199f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |               48 89 df             	mov    %rbx,%rdi
+            : tag_(Tag::ERR)
+    19a2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |               c7 44 24 50 02 00 00 	movl   $0x2,0x50(%rsp)
+    19a9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |               00 
+    19aa:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |               e8 a1 04 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            : fn_name_(fn_name)
+    19af:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |               66 0f 6f 24 24       	movdqa (%rsp),%xmm4
+    19b4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |               8b 44 24 50          	mov    0x50(%rsp),%eax
+    19b8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |               0f 29 64 24 30       	movaps %xmm4,0x30(%rsp)
+            switch (tag_) { // result<void>-match
+    19bd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |               83 f8 01             	cmp    $0x1,%eax
+    19c0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     |  |           /-- 74 1f                	je     19e1 <ex1()+0x691>
+            , line_num_(line_num)
+    19c2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |     \--|-----------|-> c7 44 24 40 11 00 00 	movl   $0x11,0x40(%rsp)
+    19c9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |        |           |   00 
+    19ca:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |        |           |   83 f8 02             	cmp    $0x2,%eax
+    19cd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  \--|--|--|-----|--|--|--|--------|-----------|-- 75 a1                	jne    1970 <ex1()+0x620>
+            nel::elem::set(data_, 0xa5, N);
+    19cf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |  |  |  |        |           |   ba 00 01 00 00       	mov    $0x100,%edx
+    19d4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |  |  |  |        |           |   be a5 00 00 00       	mov    $0xa5,%esi
+    19d9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |  |  |  |        |           |   48 89 df             	mov    %rbx,%rdi
+    19dc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |  |  |  |        |           |   e8 6f 04 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return (item_ == nullptr) ? Slice<Type>::empty() : item_->slice();
+    19e1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |  |  |  |        |           \-> 4d 85 f6             	test   %r14,%r14
+    19e4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |  |     |  |  |  |        |  /----------- 0f 84 53 02 00 00    	je     1c3d <ex1()+0x8ed>
+            return len_;
+    19ea:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |  \--|-----|--|--|--|--------|--|----------> 49 8b 5e 08          	mov    0x8(%r14),%rbx
+            return Slice(values_, len());
+    19ee:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            4d 8d 7e 10          	lea    0x10(%r14),%r15
+    nel::log << s1.len() << '\n' << s1;
+    19f2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            48 8d 3d 90 36 00 00 	lea    0x3690(%rip),%rdi        # 5089 <nel::log>
+    19f9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            4c 89 7c 24 18       	mov    %r15,0x18(%rsp)
+    19fe:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            48 89 de             	mov    %rbx,%rsi
+    1a01:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            e8 9a 0d 00 00       	call   27a0 <nel::operator<<(nel::Log&, unsigned long)>
+    1a06:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            be 0a 00 00 00       	mov    $0xa,%esi
+    1a0b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            48 89 c7             	mov    %rax,%rdi
+    1a0e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            e8 ad 0c 00 00       	call   26c0 <nel::operator<<(nel::Log&, char)>
+        // instead of insert into log, can it format into ? which log implements?
+        // so it doesn't matter about the destination..
+        // and can format-insert into any char endpoint.
+        friend Log &operator<<(Log &outs, Slice const &v)
+        {
+            outs << "Slice(" << v.len() << "){";
+    1a13:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            48 8d 35 27 16 00 00 	lea    0x1627(%rip),%rsi        # 3041 <_IO_stdin_used+0x41>
+    1a1a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            48 89 c7             	mov    %rax,%rdi
+    1a1d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            49 89 c5             	mov    %rax,%r13
+    1a20:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            e8 bb 0c 00 00       	call   26e0 <nel::operator<<(nel::Log&, char const*)>
+    1a25:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            48 89 de             	mov    %rbx,%rsi
+        }
+
+    public:
+        constexpr SliceIterator(T arr[], Count len)
+            : b_(arr)
+            , e_(arr + len)
+    1a28:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            48 c1 e3 08          	shl    $0x8,%rbx
+            outs << "Slice(" << v.len() << "){";
+    1a2c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            48 89 c7             	mov    %rax,%rdi
+    1a2f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            e8 6c 0d 00 00       	call   27a0 <nel::operator<<(nel::Log&, unsigned long)>
+    1a34:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            48 8d 35 0d 16 00 00 	lea    0x160d(%rip),%rsi        # 3048 <_IO_stdin_used+0x48>
+    1a3b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            48 89 c7             	mov    %rax,%rdi
+    1a3e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            e8 9d 0c 00 00       	call   26e0 <nel::operator<<(nel::Log&, char const*)>
+            , e_(arr + len)
+    1a43:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            49 8d 04 1f          	lea    (%r15,%rbx,1),%rax
+    1a47:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            48 89 04 24          	mov    %rax,(%rsp)
+            if (it) {
+    1a4b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            49 39 c7             	cmp    %rax,%r15
+    1a4e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  /-------- 0f 84 2c 01 00 00    	je     1b80 <ex1()+0x830>
+            nel::elem::set(data_, f, N);
+        }
+
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+        {
+            outs << "U8Buf<" << val.len() << ">{";
+    1a54:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         48 8d 35 f0 15 00 00 	lea    0x15f0(%rip),%rsi        # 304b <_IO_stdin_used+0x4b>
+    1a5b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         4c 89 ef             	mov    %r13,%rdi
+    1a5e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         49 8d 5e 11          	lea    0x11(%r14),%rbx
+    1a62:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         e8 79 0c 00 00       	call   26e0 <nel::operator<<(nel::Log&, char const*)>
+    1a67:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         be 00 01 00 00       	mov    $0x100,%esi
+    1a6c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         49 8d ae 10 01 00 00 	lea    0x110(%r14),%rbp
+    1a73:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         48 89 c7             	mov    %rax,%rdi
+    1a76:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         e8 25 0d 00 00       	call   27a0 <nel::operator<<(nel::Log&, unsigned long)>
+    1a7b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         48 8d 35 d0 15 00 00 	lea    0x15d0(%rip),%rsi        # 3052 <_IO_stdin_used+0x52>
+    1a82:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         48 89 c7             	mov    %rax,%rdi
+    1a85:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         e8 56 0c 00 00       	call   26e0 <nel::operator<<(nel::Log&, char const*)>
+            if (val.len() > 0) {
+                outs << val.data_[0];
+    1a8a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         41 0f b6 76 10       	movzbl 0x10(%r14),%esi
+    1a8f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         4c 89 ef             	mov    %r13,%rdi
+    1a92:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         e8 69 0c 00 00       	call   2700 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1a97:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    1a9e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         00 00 
+                    outs << ' ' << val.data_[i];
+    1aa0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |     /-> be 20 00 00 00       	mov    $0x20,%esi
+    1aa5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |     |   4c 89 ef             	mov    %r13,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1aa8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |     |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    1aac:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |     |   e8 0f 0c 00 00       	call   26c0 <nel::operator<<(nel::Log&, char)>
+    1ab1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |     |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1ab5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |     |   48 89 c7             	mov    %rax,%rdi
+    1ab8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |     |   e8 43 0c 00 00       	call   2700 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1abd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |     |   48 39 eb             	cmp    %rbp,%rbx
+    1ac0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |     \-- 75 de                	jne    1aa0 <ex1()+0x750>
+                }
+            }
+            outs << '}';
+    1ac2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         be 7d 00 00 00       	mov    $0x7d,%esi
+    1ac7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         4c 89 ef             	mov    %r13,%rdi
+    1aca:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         4d 8d a6 10 02 00 00 	lea    0x210(%r14),%r12
+    1ad1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         e8 ea 0b 00 00       	call   26c0 <nel::operator<<(nel::Log&, char)>
+        template<typename F>
+        void for_each2(F &&fn)
+#        endif
+        {
+#        if 1
+            for (; !self().is_done(); self().inc()) {
+    1ad6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |         48 39 1c 24          	cmp    %rbx,(%rsp)
+    1ada:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  +-------- 0f 84 a0 00 00 00    	je     1b80 <ex1()+0x830>
+                it.for_each([&outs](T const &e) { outs << ' ' << e; });
+    1ae0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  /----> be 20 00 00 00       	mov    $0x20,%esi
+    1ae5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      4c 89 ef             	mov    %r13,%rdi
+    1ae8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      4d 89 e7             	mov    %r12,%r15
+    1aeb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      e8 d0 0b 00 00       	call   26c0 <nel::operator<<(nel::Log&, char)>
+            outs << "U8Buf<" << val.len() << ">{";
+    1af0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      48 8d 35 54 15 00 00 	lea    0x1554(%rip),%rsi        # 304b <_IO_stdin_used+0x4b>
+    1af7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      49 8d 9c 24 01 ff ff 	lea    -0xff(%r12),%rbx
+    1afe:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      ff 
+    1aff:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1b02:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      48 89 c5             	mov    %rax,%rbp
+    1b05:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      e8 d6 0b 00 00       	call   26e0 <nel::operator<<(nel::Log&, char const*)>
+    1b0a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      be 00 01 00 00       	mov    $0x100,%esi
+    1b0f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1b12:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      e8 89 0c 00 00       	call   27a0 <nel::operator<<(nel::Log&, unsigned long)>
+    1b17:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      48 8d 35 34 15 00 00 	lea    0x1534(%rip),%rsi        # 3052 <_IO_stdin_used+0x52>
+    1b1e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1b21:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      e8 ba 0b 00 00       	call   26e0 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    1b26:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    1b29:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    1b30:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      ff ff 
+    1b32:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      e8 c9 0b 00 00       	call   2700 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1b37:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    1b3e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      00 00 
+                    outs << ' ' << val.data_[i];
+    1b40:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |  /-> be 20 00 00 00       	mov    $0x20,%esi
+    1b45:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1b48:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    1b4c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |  |   e8 6f 0b 00 00       	call   26c0 <nel::operator<<(nel::Log&, char)>
+    1b51:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1b55:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1b58:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |  |   e8 a3 0b 00 00       	call   2700 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1b5d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |  |   49 39 dc             	cmp    %rbx,%r12
+    1b60:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |  \-- 75 de                	jne    1b40 <ex1()+0x7f0>
+            outs << '}';
+    1b62:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      be 7d 00 00 00       	mov    $0x7d,%esi
+    1b67:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    1b6a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      49 81 c4 00 01 00 00 	add    $0x100,%r12
+    1b71:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      e8 4a 0b 00 00       	call   26c0 <nel::operator<<(nel::Log&, char)>
+    1b76:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  |      4c 39 3c 24          	cmp    %r15,(%rsp)
+    1b7a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  |  \----- 0f 85 60 ff ff ff    	jne    1ae0 <ex1()+0x790>
+            outs << '}';
+    1b80:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |  \-------> be 7d 00 00 00       	mov    $0x7d,%esi
+    1b85:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            4c 89 ef             	mov    %r13,%rdi
+            for (Index i = 0; i < len(); ++i) {
+    1b88:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            31 db                	xor    %ebx,%ebx
+    1b8a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            e8 31 0b 00 00       	call   26c0 <nel::operator<<(nel::Log&, char)>
+    1b8f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            49 83 7e 08 00       	cmpq   $0x0,0x8(%r14)
+    1b94:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            48 8b 6c 24 18       	mov    0x18(%rsp),%rbp
+    1b99:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |     /----- 74 28                	je     1bc3 <ex1()+0x873>
+    1b9b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |     |      0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+            nel::elem::set(data_, 0xa5, N);
+    1ba0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |     |  /-> 48 89 ef             	mov    %rbp,%rdi
+    1ba3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |     |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1ba8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |     |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    1bad:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |     |  |   48 83 c3 01          	add    $0x1,%rbx
+    1bb1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |     |  |   e8 9a 02 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1bb6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |     |  |   48 81 c5 00 01 00 00 	add    $0x100,%rbp
+    1bbd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |     |  |   49 3b 5e 08          	cmp    0x8(%r14),%rbx
+    1bc1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |     |  \-- 72 dd                	jb     1ba0 <ex1()+0x850>
+}
+    1bc3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |     \----> 48 81 c4 68 01 00 00 	add    $0x168,%rsp
+    1bca:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            4c 89 f7             	mov    %r14,%rdi
+    1bcd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            5b                   	pop    %rbx
+    1bce:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            5d                   	pop    %rbp
+    1bcf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            41 5c                	pop    %r12
+    1bd1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            41 5d                	pop    %r13
+    1bd3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            41 5e                	pop    %r14
+    1bd5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            41 5f                	pop    %r15
+    1bd7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            e9 54 f4 ff ff       	jmp    1030 <free@plt>
+                                    : std::realloc(p, new_size);
+    1bdc:	|  |  |  |  \--|--|--|--|--|--|--|--|--|-----|-----|-----|--|--|--|--------|--|----------> bf 10 04 00 00       	mov    $0x410,%edi
+    1be1:	|  |  |  |     |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            e8 ca f4 ff ff       	call   10b0 <malloc@plt>
+    1be6:	|  |  |  |     |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            49 89 c6             	mov    %rax,%r14
+            if (new_p == nullptr) {
+    1be9:	|  |  |  |     |  |  |  |  |  |  |  |  |     |     |     |  |  |  |        |  |            48 85 c0             	test   %rax,%rax
+    1bec:	|  |  |  |     |  |  |  |  |  |  |  |  |     \-----|-----|--|--|--|--------|--|----------- 0f 84 a8 fa ff ff    	je     169a <ex1()+0x34a>
+            new_n->alloc_ = new_cap;
+    1bf2:	|  |  |  |     |  |  |  |  |  |  |  |  |           |     |  |  |  |        |  |            66 0f 6f 05 c6 14 00 	movdqa 0x14c6(%rip),%xmm0        # 30c0 <_IO_stdin_used+0xc0>
+    1bf9:	|  |  |  |     |  |  |  |  |  |  |  |  |           |     |  |  |  |        |  |            00 
+    1bfa:	|  |  |  |     |  |  |  |  |  |  |  |  |           |     |  |  |  |        |  |            0f 11 00             	movups %xmm0,(%rax)
+    1bfd:	|  |  |  \-----|--|--|--|--|--|--|--|--|-----------|-----|--|--|--|--------|--|----------- e9 c1 f7 ff ff       	jmp    13c3 <ex1()+0x73>
+    1c02:	|  |  |        |  |  |  \--|--|--|--|--|-----------|-----|--|--|--|--------|--|----------> 48 8d 5c 24 54       	lea    0x54(%rsp),%rbx
+            nel::elem::set(data_, f, N);
+    1c07:	|  |  |        |  |  |     |  |  |  |  |           |     \--|--|--|--------|--|----------> ba 00 01 00 00       	mov    $0x100,%edx
+    1c0c:	|  |  |        |  |  |     |  |  |  |  |           |        |  |  |        |  |            be 68 00 00 00       	mov    $0x68,%esi
+    1c11:	|  |  |        |  |  |     |  |  |  |  |           |        |  |  |        |  |            48 89 df             	mov    %rbx,%rdi
+            : tag_(Tag::ERR)
+    1c14:	|  |  |        |  |  |     |  |  |  |  |           |        |  |  |        |  |            c7 44 24 50 02 00 00 	movl   $0x2,0x50(%rsp)
+    1c1b:	|  |  |        |  |  |     |  |  |  |  |           |        |  |  |        |  |            00 
+    1c1c:	|  |  |        |  |  |     |  |  |  |  |           |        |  |  |        |  |            e8 2f 02 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            : fn_name_(fn_name)
+    1c21:	|  |  |        |  |  |     |  |  |  |  |           |        |  |  |        |  |            66 0f 6f 2c 24       	movdqa (%rsp),%xmm5
+    1c26:	|  |  |        |  |  |     |  |  |  |  |           |        |  |  |        |  |            8b 44 24 50          	mov    0x50(%rsp),%eax
+    1c2a:	|  |  |        |  |  |     |  |  |  |  |           |        |  |  |        |  |            0f 29 6c 24 30       	movaps %xmm5,0x30(%rsp)
+            switch (tag_) { // result<void>-match
+    1c2f:	|  |  |        |  |  |     |  |  |  |  |           |        |  |  |        |  |            83 f8 01             	cmp    $0x1,%eax
+    1c32:	|  |  |        \--|--|-----|--|--|--|--|-----------|--------|--|--|--------|--|----------- 0f 85 fe f7 ff ff    	jne    1436 <ex1()+0xe6>
+    1c38:	|  |  |           |  \-----|--|--|--|--|-----------|--------|--|--|--------|--|----------- e9 1c f8 ff ff       	jmp    1459 <ex1()+0x109>
+    nel::log << s1.len() << '\n' << s1;
+    1c3d:	|  |  |           |        |  |  |  |  |           |        |  |  |        |  \----------> 31 f6                	xor    %esi,%esi
+    1c3f:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               48 8d 3d 43 34 00 00 	lea    0x3443(%rip),%rdi        # 5089 <nel::log>
+    1c46:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               e8 55 0b 00 00       	call   27a0 <nel::operator<<(nel::Log&, unsigned long)>
+    1c4b:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               be 0a 00 00 00       	mov    $0xa,%esi
+    1c50:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               48 89 c7             	mov    %rax,%rdi
+    1c53:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               e8 68 0a 00 00       	call   26c0 <nel::operator<<(nel::Log&, char)>
+            outs << "Slice(" << v.len() << "){";
+    1c58:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               48 8d 35 e2 13 00 00 	lea    0x13e2(%rip),%rsi        # 3041 <_IO_stdin_used+0x41>
+    1c5f:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               48 89 c7             	mov    %rax,%rdi
+    1c62:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               48 89 c3             	mov    %rax,%rbx
+    1c65:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               e8 76 0a 00 00       	call   26e0 <nel::operator<<(nel::Log&, char const*)>
+    1c6a:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               31 f6                	xor    %esi,%esi
+    1c6c:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               48 89 c7             	mov    %rax,%rdi
+    1c6f:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               e8 2c 0b 00 00       	call   27a0 <nel::operator<<(nel::Log&, unsigned long)>
+    1c74:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               48 8d 35 cd 13 00 00 	lea    0x13cd(%rip),%rsi        # 3048 <_IO_stdin_used+0x48>
+    1c7b:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               48 89 c7             	mov    %rax,%rdi
+    1c7e:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               e8 5d 0a 00 00       	call   26e0 <nel::operator<<(nel::Log&, char const*)>
+}
+    1c83:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               48 81 c4 68 01 00 00 	add    $0x168,%rsp
+            outs << '}';
+    1c8a:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               48 89 df             	mov    %rbx,%rdi
+    1c8d:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               be 7d 00 00 00       	mov    $0x7d,%esi
+    1c92:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               5b                   	pop    %rbx
+    1c93:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               5d                   	pop    %rbp
+    1c94:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               41 5c                	pop    %r12
+    1c96:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               41 5d                	pop    %r13
+    1c98:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               41 5e                	pop    %r14
+    1c9a:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               41 5f                	pop    %r15
+    1c9c:	|  |  |           |        |  |  |  |  |           |        |  |  |        |               e9 1f 0a 00 00       	jmp    26c0 <nel::operator<<(nel::Log&, char)>
+    1ca1:	|  |  |           |        |  |  |  |  |           |        |  |  |        \-------------> 49 89 ec             	mov    %rbp,%r12
+    1ca4:	|  |  |           |        |  |  |  |  |           \--------|--|--|----------------------- e9 b8 fa ff ff       	jmp    1761 <ex1()+0x411>
+    1ca9:	|  |  |           |        \--|--|--|--|--------------------|--|--|----------------------> 49 89 ec             	mov    %rbp,%r12
+    1cac:	|  |  |           \-----------|--|--|--|--------------------|--|--|----------------------- e9 14 f8 ff ff       	jmp    14c5 <ex1()+0x175>
+            new (&d[i]) T(nel::move(s[i]));
+            s[i].~T();
+        }
+    } else {
+        // backwards, so overlap is not overwritten before it is read.
+        for (Index i = n; i > 0; --i) {
+    1cb1:	|  |  |                       |  \--|--|--------------------|--|--|----------------------> 48 85 db             	test   %rbx,%rbx
+    1cb4:	|  |  |                       +-----|--|--------------------|--|--|----------------------- 0f 84 c5 f9 ff ff    	je     167f <ex1()+0x32f>
+    1cba:	|  |  |                       |     |  |                    |  |  |                        49 89 dc             	mov    %rbx,%r12
+    1cbd:	|  |  |                       |     |  |                    |  |  |                        49 c1 e4 08          	shl    $0x8,%r12
+    1cc1:	|  |  |                       |     |  |                    |  |  |                        49 81 ec f0 00 00 00 	sub    $0xf0,%r12
+    1cc8:	|  |  |                       |     |  |                    |  |  |                        4f 8d 7c 25 00       	lea    0x0(%r13,%r12,1),%r15
+    1ccd:	|  |  |                       |     |  |                    |  |  |                        4d 01 f4             	add    %r14,%r12
+            nel::elem::move(data_, o.data_, N);
+    1cd0:	|  |  |                       |     |  |                    |  |  |                    /-> 4c 89 e6             	mov    %r12,%rsi
+    1cd3:	|  |  |                       |     |  |                    |  |  |                    |   4c 89 ff             	mov    %r15,%rdi
+    1cd6:	|  |  |                       |     |  |                    |  |  |                    |   ba 00 01 00 00       	mov    $0x100,%edx
+    1cdb:	|  |  |                       |     |  |                    |  |  |                    |   49 81 ef 00 01 00 00 	sub    $0x100,%r15
+    1ce2:	|  |  |                       |     |  |                    |  |  |                    |   e8 79 01 00 00       	call   1e60 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1ce7:	|  |  |                       |     |  |                    |  |  |                    |   4c 89 e7             	mov    %r12,%rdi
+    1cea:	|  |  |                       |     |  |                    |  |  |                    |   ba 00 01 00 00       	mov    $0x100,%edx
+    1cef:	|  |  |                       |     |  |                    |  |  |                    |   be a5 00 00 00       	mov    $0xa5,%esi
+    1cf4:	|  |  |                       |     |  |                    |  |  |                    |   e8 57 01 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1cf9:	|  |  |                       |     |  |                    |  |  |                    |   49 81 ec 00 01 00 00 	sub    $0x100,%r12
+    1d00:	|  |  |                       |     |  |                    |  |  |                    |   48 83 eb 01          	sub    $0x1,%rbx
+    1d04:	|  |  |                       |     |  |                    |  |  |                    \-- 75 ca                	jne    1cd0 <ex1()+0x980>
+    1d06:	|  |  |                       \-----|--|--------------------|--|--|----------------------- e9 74 f9 ff ff       	jmp    167f <ex1()+0x32f>
+    1d0b:	|  |  |                             |  |                    |  |  \----------------------> 48 85 db             	test   %rbx,%rbx
+    1d0e:	|  |  |                             |  |                    |  +-------------------------- 0f 84 2a fc ff ff    	je     193e <ex1()+0x5ee>
+    1d14:	|  |  |                             |  |                    |  |                           49 89 dc             	mov    %rbx,%r12
+    1d17:	|  |  |                             |  |                    |  |                           49 c1 e4 08          	shl    $0x8,%r12
+    1d1b:	|  |  |                             |  |                    |  |                           49 81 ec f0 00 00 00 	sub    $0xf0,%r12
+    1d22:	|  |  |                             |  |                    |  |                           4f 8d 7c 25 00       	lea    0x0(%r13,%r12,1),%r15
+    1d27:	|  |  |                             |  |                    |  |                           4d 01 f4             	add    %r14,%r12
+            nel::elem::move(data_, o.data_, N);
+    1d2a:	|  |  |                             |  |                    |  |                       /-> 4c 89 e6             	mov    %r12,%rsi
+    1d2d:	|  |  |                             |  |                    |  |                       |   4c 89 ff             	mov    %r15,%rdi
+    1d30:	|  |  |                             |  |                    |  |                       |   ba 00 01 00 00       	mov    $0x100,%edx
+    1d35:	|  |  |                             |  |                    |  |                       |   49 81 ef 00 01 00 00 	sub    $0x100,%r15
+    1d3c:	|  |  |                             |  |                    |  |                       |   e8 1f 01 00 00       	call   1e60 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1d41:	|  |  |                             |  |                    |  |                       |   4c 89 e7             	mov    %r12,%rdi
+    1d44:	|  |  |                             |  |                    |  |                       |   ba 00 01 00 00       	mov    $0x100,%edx
+    1d49:	|  |  |                             |  |                    |  |                       |   be a5 00 00 00       	mov    $0xa5,%esi
+    1d4e:	|  |  |                             |  |                    |  |                       |   e8 fd 00 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1d53:	|  |  |                             |  |                    |  |                       |   49 81 ec 00 01 00 00 	sub    $0x100,%r12
+    1d5a:	|  |  |                             |  |                    |  |                       |   48 83 eb 01          	sub    $0x1,%rbx
+    1d5e:	|  |  |                             |  |                    |  |                       \-- 75 ca                	jne    1d2a <ex1()+0x9da>
+    1d60:	|  |  |                             |  |                    |  \-------------------------- e9 d9 fb ff ff       	jmp    193e <ex1()+0x5ee>
+    1d65:	|  |  \-----------------------------|--|--------------------|----------------------------> 48 85 db             	test   %rbx,%rbx
+    1d68:	|  +--------------------------------|--|--------------------|----------------------------- 0f 84 0c f8 ff ff    	je     157a <ex1()+0x22a>
+    1d6e:	|  |                                |  |                    |                              49 89 dd             	mov    %rbx,%r13
+    1d71:	|  |                                |  |                    |                              49 c1 e5 08          	shl    $0x8,%r13
+    1d75:	|  |                                |  |                    |                              49 81 ed f0 00 00 00 	sub    $0xf0,%r13
+    1d7c:	|  |                                |  |                    |                              4e 8d 7c 2d 00       	lea    0x0(%rbp,%r13,1),%r15
+    1d81:	|  |                                |  |                    |                              4d 01 f5             	add    %r14,%r13
+            nel::elem::move(data_, o.data_, N);
+    1d84:	|  |                                |  |                    |                          /-> 4c 89 ee             	mov    %r13,%rsi
+    1d87:	|  |                                |  |                    |                          |   4c 89 ff             	mov    %r15,%rdi
+    1d8a:	|  |                                |  |                    |                          |   ba 00 01 00 00       	mov    $0x100,%edx
+    1d8f:	|  |                                |  |                    |                          |   49 81 ef 00 01 00 00 	sub    $0x100,%r15
+    1d96:	|  |                                |  |                    |                          |   e8 c5 00 00 00       	call   1e60 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1d9b:	|  |                                |  |                    |                          |   4c 89 ef             	mov    %r13,%rdi
+    1d9e:	|  |                                |  |                    |                          |   ba 00 01 00 00       	mov    $0x100,%edx
+    1da3:	|  |                                |  |                    |                          |   be a5 00 00 00       	mov    $0xa5,%esi
+    1da8:	|  |                                |  |                    |                          |   e8 a3 00 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1dad:	|  |                                |  |                    |                          |   49 81 ed 00 01 00 00 	sub    $0x100,%r13
+    1db4:	|  |                                |  |                    |                          |   48 83 eb 01          	sub    $0x1,%rbx
+    1db8:	|  |                                |  |                    |                          \-- 75 ca                	jne    1d84 <ex1()+0xa34>
+    1dba:	|  \--------------------------------|--|--------------------|----------------------------- e9 bb f7 ff ff       	jmp    157a <ex1()+0x22a>
+    1dbf:	|                                   |  \--------------------|----------------------------> 48 85 db             	test   %rbx,%rbx
+    1dc2:	|                                   +-----------------------|----------------------------- 0f 84 48 fa ff ff    	je     1810 <ex1()+0x4c0>
+    1dc8:	|                                   |                       |                              49 89 dd             	mov    %rbx,%r13
+    1dcb:	|                                   |                       |                              49 c1 e5 08          	shl    $0x8,%r13
+    1dcf:	|                                   |                       |                              49 81 ed f0 00 00 00 	sub    $0xf0,%r13
+    1dd6:	|                                   |                       |                              4e 8d 3c 28          	lea    (%rax,%r13,1),%r15
+    1dda:	|                                   |                       |                              4d 01 f5             	add    %r14,%r13
+            nel::elem::move(data_, o.data_, N);
+    1ddd:	|                                   |                       |                          /-> 4c 89 ee             	mov    %r13,%rsi
+    1de0:	|                                   |                       |                          |   4c 89 ff             	mov    %r15,%rdi
+    1de3:	|                                   |                       |                          |   ba 00 01 00 00       	mov    $0x100,%edx
+    1de8:	|                                   |                       |                          |   49 81 ef 00 01 00 00 	sub    $0x100,%r15
+    1def:	|                                   |                       |                          |   e8 6c 00 00 00       	call   1e60 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1df4:	|                                   |                       |                          |   4c 89 ef             	mov    %r13,%rdi
+    1df7:	|                                   |                       |                          |   ba 00 01 00 00       	mov    $0x100,%edx
+    1dfc:	|                                   |                       |                          |   be a5 00 00 00       	mov    $0xa5,%esi
+    1e01:	|                                   |                       |                          |   e8 4a 00 00 00       	call   1e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1e06:	|                                   |                       |                          |   49 81 ed 00 01 00 00 	sub    $0x100,%r13
+    1e0d:	|                                   |                       |                          |   48 83 eb 01          	sub    $0x1,%rbx
+    1e11:	|                                   |                       |                          \-- 75 ca                	jne    1ddd <ex1()+0xa8d>
+    1e13:	|                                   \-----------------------|----------------------------- e9 f8 f9 ff ff       	jmp    1810 <ex1()+0x4c0>
+    if (!pred) { assert_fail(msg, ctx); }
+    1e18:	\-----------------------------------------------------------|----------------------------> 48 8d 74 24 50       	lea    0x50(%rsp),%rsi
+    1e1d:	                                                            |                              48 8d 3d 64 12 00 00 	lea    0x1264(%rip),%rdi        # 3088 <_IO_stdin_used+0x88>
+    1e24:	                                                            |                              e8 29 f3 ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    1e29:	                                                            |                              0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+                    nel::panic("invalid Result", ctx);
+    1e30:	                                                            \----------------------------> 48 8d 3d f0 11 00 00 	lea    0x11f0(%rip),%rdi        # 3027 <_IO_stdin_used+0x27>
+    1e37:	                                                                                           e8 e6 f2 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1e3c:	                                                                                           0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001e40 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    1e40:	e9 5b f2 ff ff       	jmp    10a0 <memcpy@plt>
+    1e45:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1e4c:	00 00 00 00 
+
+0000000000001e50 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    1e50:	40 0f b6 f6          	movzbl %sil,%esi
+    1e54:	e9 07 f2 ff ff       	jmp    1060 <memset@plt>
+    1e59:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001e60 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+}
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    1e60:	e9 3b f2 ff ff       	jmp    10a0 <memcpy@plt>
+    1e65:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1e6c:	00 00 00 00 
+
+0000000000001e70 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    1e70:	e9 5b f2 ff ff       	jmp    10d0 <memmove@plt>
+    1e75:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1e7c:	00 00 00 00 
+
+0000000000001e80 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    1e80:	48 89 f2             	mov    %rsi,%rdx
+    std::memset(d, s, n);
+    1e83:	be a5 00 00 00       	mov    $0xa5,%esi
+    1e88:	e9 d3 f1 ff ff       	jmp    1060 <memset@plt>
+    1e8d:	0f 1f 00             	nopl   (%rax)
+
+0000000000001e90 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+    set(d, 0xa5, n);
+}
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1e90:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    1e94:	e8 e7 f1 ff ff       	call   1080 <memcmp@plt>
+    1e99:	85 c0                	test   %eax,%eax
+    1e9b:	0f 94 c0             	sete   %al
+}
+    1e9e:	48 83 c4 08          	add    $0x8,%rsp
+    1ea2:	c3                   	ret
+    1ea3:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1eaa:	00 00 00 00 
+    1eae:	66 90                	xchg   %ax,%ax
+
+0000000000001eb0 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    1eb0:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    1eb4:	e8 c7 f1 ff ff       	call   1080 <memcmp@plt>
+    1eb9:	85 c0                	test   %eax,%eax
+    1ebb:	0f 95 c0             	setne  %al
+}
+    1ebe:	48 83 c4 08          	add    $0x8,%rsp
+    1ec2:	c3                   	ret
+    1ec3:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    1eca:	00 00 00 00 
+    1ece:	66 90                	xchg   %ax,%ax
+
+0000000000001ed0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    if (n < streaming_min) {
+    1ed0:	                48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    1ed7:	/-------------- 0f 86 d7 00 00 00    	jbe    1fb4 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xe4>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1edd:	|               48 89 f9             	mov    %rdi,%rcx
+{
+    1ee0:	|               53                   	push   %rbx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    1ee1:	|               48 f7 d9             	neg    %rcx
+    1ee4:	|               83 e1 0f             	and    $0xf,%ecx
+    std::memcpy(d, s, n);
+    1ee7:	|               83 f9 08             	cmp    $0x8,%ecx
+    1eea:	|     /-------- 0f 82 d0 00 00 00    	jb     1fc0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xf0>
+    1ef0:	|     |         48 8b 06             	mov    (%rsi),%rax
+    1ef3:	|     |         4c 8d 57 08          	lea    0x8(%rdi),%r10
+    1ef7:	|     |         48 89 f3             	mov    %rsi,%rbx
+    1efa:	|     |         49 83 e2 f8          	and    $0xfffffffffffffff8,%r10
+    1efe:	|     |         48 89 07             	mov    %rax,(%rdi)
+    1f01:	|     |         48 8b 44 0e f8       	mov    -0x8(%rsi,%rcx,1),%rax
+    1f06:	|     |         48 89 44 0f f8       	mov    %rax,-0x8(%rdi,%rcx,1)
+    1f0b:	|     |         48 89 f8             	mov    %rdi,%rax
+    1f0e:	|     |         4c 29 d0             	sub    %r10,%rax
+    1f11:	|     |         48 29 c3             	sub    %rax,%rbx
+    1f14:	|     |         01 c8                	add    %ecx,%eax
+    1f16:	|     |         83 e0 f8             	and    $0xfffffff8,%eax
+    1f19:	|     |         83 f8 08             	cmp    $0x8,%eax
+    1f1c:	|  /--|-------- 72 1a                	jb     1f38 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    1f1e:	|  |  |         83 e0 f8             	and    $0xfffffff8,%eax
+    1f21:	|  |  |         45 31 c0             	xor    %r8d,%r8d
+    1f24:	|  |  |     /-> 45 89 c1             	mov    %r8d,%r9d
+    1f27:	|  |  |     |   41 83 c0 08          	add    $0x8,%r8d
+    1f2b:	|  |  |     |   4e 8b 1c 0b          	mov    (%rbx,%r9,1),%r11
+    1f2f:	|  |  |     |   4f 89 1c 0a          	mov    %r11,(%r10,%r9,1)
+    1f33:	|  |  |     |   41 39 c0             	cmp    %eax,%r8d
+    1f36:	|  |  |     \-- 72 ec                	jb     1f24 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x54>
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    1f38:	|  >--|-------> 48 8d 41 40          	lea    0x40(%rcx),%rax
+    1f3c:	|  |  |         48 01 f9             	add    %rdi,%rcx
+    1f3f:	|  |  |         90                   	nop
+    std::memcpy(&v, s, sizeof(v));
+    1f40:	|  |  |     /-> f3 0f 6f 54 06 d0    	movdqu -0x30(%rsi,%rax,1),%xmm2
+    1f46:	|  |  |     |   f3 0f 6f 4c 06 e0    	movdqu -0x20(%rsi,%rax,1),%xmm1
+    1f4c:	|  |  |     |   49 89 c0             	mov    %rax,%r8
+    for (; i + 64 <= n; i += 64) {
+    1f4f:	|  |  |     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    1f53:	|  |  |     |   f3 0f 6f 44 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1f59:	|  |  |     |   f3 0f 6f 5c 06 c0    	movdqu -0x40(%rsi,%rax,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    1f5f:	|  |  |     |   48 83 c0 40          	add    $0x40,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1f63:	|  |  |     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    1f68:	|  |  |     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    1f6d:	|  |  |     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    1f72:	|  |  |     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    1f77:	|  |  |     |   48 39 c2             	cmp    %rax,%rdx
+    1f7a:	|  |  |     \-- 73 c4                	jae    1f40 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x70>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    1f7c:	|  |  |         49 8d 40 10          	lea    0x10(%r8),%rax
+    1f80:	|  |  |         48 39 c2             	cmp    %rax,%rdx
+    1f83:	|  |  |  /----- 72 22                	jb     1fa7 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd7>
+    1f85:	|  |  |  |      48 8d 4f f0          	lea    -0x10(%rdi),%rcx
+    1f89:	|  |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    1f90:	|  |  |  |  /-> f3 0f 6f 64 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm4
+    1f96:	|  |  |  |  |   49 89 c0             	mov    %rax,%r8
+    1f99:	|  |  |  |  |   66 0f e7 24 01       	movntdq %xmm4,(%rcx,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    1f9e:	|  |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    1fa2:	|  |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    1fa5:	|  |  |  |  \-- 73 e9                	jae    1f90 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc0>
+        stream16(d + i, load16(s + i));
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    1fa7:	|  |  |  \----> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    1faa:	|  |  |         4c 01 c7             	add    %r8,%rdi
+    1fad:	|  |  |         4c 29 c2             	sub    %r8,%rdx
+    1fb0:	|  |  |         4c 01 c6             	add    %r8,%rsi
+}
+    1fb3:	|  |  |         5b                   	pop    %rbx
+    std::memcpy(d, s, n);
+    1fb4:	\--|--|-------> e9 e7 f0 ff ff       	jmp    10a0 <memcpy@plt>
+    1fb9:	   |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1fc0:	   |  \-------> f6 c1 04             	test   $0x4,%cl
+    1fc3:	   |        /-- 75 25                	jne    1fea <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x11a>
+    1fc5:	   |        |   85 c9                	test   %ecx,%ecx
+    1fc7:	   +--------|-- 0f 84 6b ff ff ff    	je     1f38 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    1fcd:	   |        |   0f b6 06             	movzbl (%rsi),%eax
+    1fd0:	   |        |   88 07                	mov    %al,(%rdi)
+    1fd2:	   |        |   f6 c1 02             	test   $0x2,%cl
+    1fd5:	   +--------|-- 0f 84 5d ff ff ff    	je     1f38 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    1fdb:	   |        |   0f b7 44 0e fe       	movzwl -0x2(%rsi,%rcx,1),%eax
+    1fe0:	   |        |   66 89 44 0f fe       	mov    %ax,-0x2(%rdi,%rcx,1)
+    1fe5:	   +--------|-- e9 4e ff ff ff       	jmp    1f38 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    1fea:	   |        \-> 8b 06                	mov    (%rsi),%eax
+    1fec:	   |            89 07                	mov    %eax,(%rdi)
+    1fee:	   |            8b 44 0e fc          	mov    -0x4(%rsi,%rcx,1),%eax
+    1ff2:	   |            89 44 0f fc          	mov    %eax,-0x4(%rdi,%rcx,1)
+    1ff6:	   \----------- e9 3d ff ff ff       	jmp    1f38 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    1ffb:	                0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000002000 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    2000:	                                           49 89 f8             	mov    %rdi,%r8
+    2003:	                                           48 89 f1             	mov    %rsi,%rcx
+    if (n < streaming_min) {
+    2006:	                                           48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    200d:	                              /----------- 0f 86 85 03 00 00    	jbe    2398 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x398>
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2013:	                              |            48 89 fe             	mov    %rdi,%rsi
+{
+    2016:	                              |            41 57                	push   %r15
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    2018:	                              |            48 f7 de             	neg    %rsi
+{
+    201b:	                              |            41 56                	push   %r14
+    for (Index i = 0; i < head; ++i) {
+    201d:	                              |            48 89 f0             	mov    %rsi,%rax
+{
+    2020:	                              |            41 55                	push   %r13
+    2022:	                              |            41 54                	push   %r12
+    2024:	                              |            55                   	push   %rbp
+    2025:	                              |            53                   	push   %rbx
+    for (Index i = 0; i < head; ++i) {
+    2026:	                              |            83 e0 0f             	and    $0xf,%eax
+    2029:	/-----------------------------|----------- 0f 84 01 01 00 00    	je     2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    202f:	|                             |            48 8d 78 ff          	lea    -0x1(%rax),%rdi
+    2033:	|                             |            48 83 ff 02          	cmp    $0x2,%rdi
+    2037:	|  /--------------------------|----------- 0f 86 8a 04 00 00    	jbe    24c7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4c7>
+    203d:	|  |                          |            4c 8d 51 01          	lea    0x1(%rcx),%r10
+    2041:	|  |                          |            4d 89 c1             	mov    %r8,%r9
+    2044:	|  |                          |            4d 29 d1             	sub    %r10,%r9
+    2047:	|  |                          |            49 83 f9 06          	cmp    $0x6,%r9
+    204b:	|  |                          |  /-------- 0f 87 c7 02 00 00    	ja     2318 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x318>
+        d[i] = p[i];
+    2051:	|  |                          |  |         0f b6 39             	movzbl (%rcx),%edi
+    2054:	|  |                          |  |         41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2057:	|  |                          |  |         40 f6 c6 0e          	test   $0xe,%sil
+    205b:	+--|--------------------------|--|-------- 0f 84 cf 00 00 00    	je     2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2061:	|  |                          |  |         0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    2065:	|  |                          |  |         41 88 78 01          	mov    %dil,0x1(%r8)
+    2069:	|  |  /-----------------------|--|-------> 0f b6 79 02          	movzbl 0x2(%rcx),%edi
+    206d:	|  |  |                       |  |         41 88 78 02          	mov    %dil,0x2(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2071:	|  |  |                       |  |         40 f6 c6 0c          	test   $0xc,%sil
+    2075:	+--|--|-----------------------|--|-------- 0f 84 b5 00 00 00    	je     2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    207b:	|  |  |                       |  |         0f b6 79 03          	movzbl 0x3(%rcx),%edi
+    207f:	|  |  |                       |  |         41 88 78 03          	mov    %dil,0x3(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2083:	|  |  |                       |  |         48 83 f8 04          	cmp    $0x4,%rax
+    2087:	+--|--|-----------------------|--|-------- 0f 86 a3 00 00 00    	jbe    2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    208d:	|  |  |                       |  |         0f b6 79 04          	movzbl 0x4(%rcx),%edi
+    2091:	|  |  |                       |  |         41 88 78 04          	mov    %dil,0x4(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2095:	|  |  |                       |  |         48 83 f8 05          	cmp    $0x5,%rax
+    2099:	+--|--|-----------------------|--|-------- 0f 84 91 00 00 00    	je     2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    209f:	|  |  |                       |  |         0f b6 79 05          	movzbl 0x5(%rcx),%edi
+    20a3:	|  |  |                       |  |         41 88 78 05          	mov    %dil,0x5(%r8)
+    for (Index i = 0; i < head; ++i) {
+    20a7:	|  |  |                       |  |         48 83 f8 06          	cmp    $0x6,%rax
+    20ab:	+--|--|-----------------------|--|-------- 0f 84 7f 00 00 00    	je     2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    20b1:	|  |  |                       |  |         0f b6 79 06          	movzbl 0x6(%rcx),%edi
+    for (Index i = 0; i < head; ++i) {
+    20b5:	|  |  |                       |  |         83 e6 08             	and    $0x8,%esi
+        d[i] = p[i];
+    20b8:	|  |  |                       |  |         41 88 78 06          	mov    %dil,0x6(%r8)
+    for (Index i = 0; i < head; ++i) {
+    20bc:	+--|--|-----------------------|--|-------- 74 72                	je     2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    20be:	|  |  |                       |  |         0f b6 71 07          	movzbl 0x7(%rcx),%esi
+    20c2:	|  |  |                       |  |         41 88 70 07          	mov    %sil,0x7(%r8)
+    for (Index i = 0; i < head; ++i) {
+    20c6:	|  |  |                       |  |         48 83 f8 08          	cmp    $0x8,%rax
+    20ca:	+--|--|-----------------------|--|-------- 76 64                	jbe    2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    20cc:	|  |  |                       |  |         0f b6 71 08          	movzbl 0x8(%rcx),%esi
+    20d0:	|  |  |                       |  |         41 88 70 08          	mov    %sil,0x8(%r8)
+    for (Index i = 0; i < head; ++i) {
+    20d4:	|  |  |                       |  |         48 83 f8 09          	cmp    $0x9,%rax
+    20d8:	+--|--|-----------------------|--|-------- 74 56                	je     2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    20da:	|  |  |                       |  |         0f b6 71 09          	movzbl 0x9(%rcx),%esi
+    20de:	|  |  |                       |  |         41 88 70 09          	mov    %sil,0x9(%r8)
+    for (Index i = 0; i < head; ++i) {
+    20e2:	|  |  |                       |  |         48 83 f8 0a          	cmp    $0xa,%rax
+    20e6:	+--|--|-----------------------|--|-------- 74 48                	je     2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    20e8:	|  |  |                       |  |         0f b6 71 0a          	movzbl 0xa(%rcx),%esi
+    20ec:	|  |  |                       |  |         41 88 70 0a          	mov    %sil,0xa(%r8)
+    for (Index i = 0; i < head; ++i) {
+    20f0:	|  |  |                       |  |         48 83 f8 0b          	cmp    $0xb,%rax
+    20f4:	+--|--|-----------------------|--|-------- 74 3a                	je     2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    20f6:	|  |  |                       |  |         0f b6 71 0b          	movzbl 0xb(%rcx),%esi
+    20fa:	|  |  |                       |  |         41 88 70 0b          	mov    %sil,0xb(%r8)
+    for (Index i = 0; i < head; ++i) {
+    20fe:	|  |  |                       |  |         48 83 f8 0c          	cmp    $0xc,%rax
+    2102:	+--|--|-----------------------|--|-------- 74 2c                	je     2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2104:	|  |  |                       |  |         0f b6 71 0c          	movzbl 0xc(%rcx),%esi
+    2108:	|  |  |                       |  |         41 88 70 0c          	mov    %sil,0xc(%r8)
+    for (Index i = 0; i < head; ++i) {
+    210c:	|  |  |                       |  |         48 83 f8 0d          	cmp    $0xd,%rax
+    2110:	+--|--|-----------------------|--|-------- 74 1e                	je     2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2112:	|  |  |                       |  |         0f b6 71 0d          	movzbl 0xd(%rcx),%esi
+    2116:	|  |  |                       |  |         41 88 70 0d          	mov    %sil,0xd(%r8)
+    for (Index i = 0; i < head; ++i) {
+    211a:	|  |  |                       |  |         49 8d 70 ff          	lea    -0x1(%r8),%rsi
+    211e:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    2121:	+--|--|-----------------------|--|-------- 75 0d                	jne    2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2123:	|  |  |                       |  |         0f b6 71 0e          	movzbl 0xe(%rcx),%esi
+    2127:	|  |  |                       |  |         41 88 70 0e          	mov    %sil,0xe(%r8)
+    for (Index i = 0; i < head; ++i) {
+    212b:	|  |  |                       |  |         0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+        rotated[i] = p[(head + i) % 16];
+    2130:	>--|--|-----------------------|--|-------> 48 8d 70 07          	lea    0x7(%rax),%rsi
+    2134:	|  |  |                       |  |         4c 8d 78 06          	lea    0x6(%rax),%r15
+    2138:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    213b:	|  |  |                       |  |         4c 8d 70 05          	lea    0x5(%rax),%r14
+    213f:	|  |  |                       |  |         4c 8d 68 04          	lea    0x4(%rax),%r13
+    2143:	|  |  |                       |  |         41 83 e7 0f          	and    $0xf,%r15d
+    std::memcpy(&v, s, sizeof(v));
+    2147:	|  |  |                       |  |         0f b6 34 31          	movzbl (%rcx,%rsi,1),%esi
+        rotated[i] = p[(head + i) % 16];
+    214b:	|  |  |                       |  |         41 83 e6 0f          	and    $0xf,%r14d
+    214f:	|  |  |                       |  |         41 83 e5 0f          	and    $0xf,%r13d
+    2153:	|  |  |                       |  |         4c 8d 60 03          	lea    0x3(%rax),%r12
+    std::memcpy(&v, s, sizeof(v));
+    2157:	|  |  |                       |  |         46 0f b6 3c 39       	movzbl (%rcx,%r15,1),%r15d
+    215c:	|  |  |                       |  |         46 0f b6 34 31       	movzbl (%rcx,%r14,1),%r14d
+        rotated[i] = p[(head + i) % 16];
+    2161:	|  |  |                       |  |         48 8d 78 08          	lea    0x8(%rax),%rdi
+    2165:	|  |  |                       |  |         41 83 e4 0f          	and    $0xf,%r12d
+    std::memcpy(&v, s, sizeof(v));
+    2169:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    216d:	|  |  |                       |  |         46 0f b6 2c 29       	movzbl (%rcx,%r13,1),%r13d
+        rotated[i] = p[(head + i) % 16];
+    2172:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    2175:	|  |  |                       |  |         48 8d 68 02          	lea    0x2(%rax),%rbp
+    std::memcpy(&v, s, sizeof(v));
+    2179:	|  |  |                       |  |         4c 09 fe             	or     %r15,%rsi
+        rotated[i] = p[(head + i) % 16];
+    217c:	|  |  |                       |  |         48 89 7c 24 c8       	mov    %rdi,-0x38(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    2181:	|  |  |                       |  |         46 0f b6 24 21       	movzbl (%rcx,%r12,1),%r12d
+        rotated[i] = p[(head + i) % 16];
+    2186:	|  |  |                       |  |         83 e5 0f             	and    $0xf,%ebp
+    std::memcpy(&v, s, sizeof(v));
+    2189:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    218d:	|  |  |                       |  |         48 8d 78 09          	lea    0x9(%rax),%rdi
+    std::memcpy(&v, s, sizeof(v));
+    2191:	|  |  |                       |  |         0f b6 2c 29          	movzbl (%rcx,%rbp,1),%ebp
+        rotated[i] = p[(head + i) % 16];
+    2195:	|  |  |                       |  |         48 8d 58 01          	lea    0x1(%rax),%rbx
+    std::memcpy(&v, s, sizeof(v));
+    2199:	|  |  |                       |  |         4c 09 f6             	or     %r14,%rsi
+        rotated[i] = p[(head + i) % 16];
+    219c:	|  |  |                       |  |         49 89 fb             	mov    %rdi,%r11
+    219f:	|  |  |                       |  |         48 8d 78 0a          	lea    0xa(%rax),%rdi
+    21a3:	|  |  |                       |  |         83 e3 0f             	and    $0xf,%ebx
+    std::memcpy(&v, s, sizeof(v));
+    21a6:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    21aa:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    21ae:	|  |  |                       |  |         49 89 fa             	mov    %rdi,%r10
+    std::memcpy(&v, s, sizeof(v));
+    21b1:	|  |  |                       |  |         4c 09 ee             	or     %r13,%rsi
+        rotated[i] = p[(head + i) % 16];
+    21b4:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    21b8:	|  |  |                       |  |         48 8d 78 0b          	lea    0xb(%rax),%rdi
+    21bc:	|  |  |                       |  |         4c 89 5c 24 e0       	mov    %r11,-0x20(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    21c1:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    21c5:	|  |  |                       |  |         4c 8d 58 0f          	lea    0xf(%rax),%r11
+    21c9:	|  |  |                       |  |         4c 89 54 24 e8       	mov    %r10,-0x18(%rsp)
+    21ce:	|  |  |                       |  |         49 89 f9             	mov    %rdi,%r9
+    std::memcpy(&v, s, sizeof(v));
+    21d1:	|  |  |                       |  |         4c 09 e6             	or     %r12,%rsi
+        rotated[i] = p[(head + i) % 16];
+    21d4:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    21d8:	|  |  |                       |  |         4c 8d 50 0e          	lea    0xe(%rax),%r10
+    21dc:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    21e0:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    21e4:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    21e8:	|  |  |                       |  |         4c 89 4c 24 f0       	mov    %r9,-0x10(%rsp)
+    21ed:	|  |  |                       |  |         4c 8d 48 0d          	lea    0xd(%rax),%r9
+    std::memcpy(&v, s, sizeof(v));
+    21f1:	|  |  |                       |  |         48 09 ee             	or     %rbp,%rsi
+    21f4:	|  |  |                       |  |         0f b6 2c 19          	movzbl (%rcx,%rbx,1),%ebp
+    21f8:	|  |  |                       |  |         46 0f b6 14 11       	movzbl (%rcx,%r10,1),%r10d
+        rotated[i] = p[(head + i) % 16];
+    21fd:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    2201:	|  |  |                       |  |         48 89 f3             	mov    %rsi,%rbx
+    2204:	|  |  |                       |  |         42 0f b6 34 19       	movzbl (%rcx,%r11,1),%esi
+    2209:	|  |  |                       |  |         46 0f b6 0c 09       	movzbl (%rcx,%r9,1),%r9d
+        rotated[i] = p[(head + i) % 16];
+    220e:	|  |  |                       |  |         48 8d 78 0c          	lea    0xc(%rax),%rdi
+    2212:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    std::memcpy(&v, s, sizeof(v));
+    2215:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    2219:	|  |  |                       |  |         4c 8b 5c 24 e0       	mov    -0x20(%rsp),%r11
+    221e:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2222:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    2225:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    2229:	|  |  |                       |  |         0f b6 2c 01          	movzbl (%rcx,%rax,1),%ebp
+    222d:	|  |  |                       |  |         4c 09 d6             	or     %r10,%rsi
+    2230:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    2234:	|  |  |                       |  |         4c 8b 54 24 e8       	mov    -0x18(%rsp),%r10
+    2239:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    223d:	|  |  |                       |  |         4c 09 ce             	or     %r9,%rsi
+    2240:	|  |  |                       |  |         4c 8b 4c 24 f0       	mov    -0x10(%rsp),%r9
+    2245:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2249:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    224c:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    224f:	|  |  |                       |  |         42 0f b6 3c 09       	movzbl (%rcx,%r9,1),%edi
+    2254:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2258:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    225b:	|  |  |                       |  |         42 0f b6 3c 11       	movzbl (%rcx,%r10,1),%edi
+    2260:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2264:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    2267:	|  |  |                       |  |         42 0f b6 3c 19       	movzbl (%rcx,%r11,1),%edi
+    226c:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2270:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    2273:	|  |  |                       |  |         48 8b 7c 24 c8       	mov    -0x38(%rsp),%rdi
+    2278:	|  |  |                       |  |         48 89 5c 24 c8       	mov    %rbx,-0x38(%rsp)
+    227d:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    2281:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    2285:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    2288:	|  |  |                       |  |         48 8d 78 40          	lea    0x40(%rax),%rdi
+    228c:	|  |  |                       |  |         4c 01 c0             	add    %r8,%rax
+    std::memcpy(&v, s, sizeof(v));
+    228f:	|  |  |                       |  |         48 89 74 24 d0       	mov    %rsi,-0x30(%rsp)
+    2294:	|  |  |                       |  |         66 0f 6f 44 24 c8    	movdqa -0x38(%rsp),%xmm0
+    for (; i + 64 <= n; i += 64) {
+    229a:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    22a0:	|  |  |                       |  |     /-> 48 89 fe             	mov    %rdi,%rsi
+    for (; i + 64 <= n; i += 64) {
+    22a3:	|  |  |                       |  |     |   48 83 c7 40          	add    $0x40,%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    22a7:	|  |  |                       |  |     |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    22ab:	|  |  |                       |  |     |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    22b0:	|  |  |                       |  |     |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    22b5:	|  |  |                       |  |     |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    22ba:	|  |  |                       |  |     |   48 83 c0 40          	add    $0x40,%rax
+    22be:	|  |  |                       |  |     |   48 39 fa             	cmp    %rdi,%rdx
+    22c1:	|  |  |                       |  |     \-- 73 dd                	jae    22a0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2a0>
+        stream16(d + i, v);
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+    22c3:	|  |  |                       |  |         48 8d 46 10          	lea    0x10(%rsi),%rax
+    22c7:	|  |  |                       |  |         48 39 c2             	cmp    %rax,%rdx
+    22ca:	|  |  |                       |  |  /----- 72 15                	jb     22e1 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2e1>
+    22cc:	|  |  |                       |  |  |      49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    22d0:	|  |  |                       |  |  |  /-> 48 89 c6             	mov    %rax,%rsi
+    22d3:	|  |  |                       |  |  |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    22d8:	|  |  |                       |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    22dc:	|  |  |                       |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    22df:	|  |  |                       |  |  |  \-- 73 ef                	jae    22d0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2d0>
+        stream16(d + i, v);
+    }
+    __builtin_ia32_sfence();
+    22e1:	|  |  |                       |  |  \----> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    22e4:	|  |  |                       |  |         48 39 d6             	cmp    %rdx,%rsi
+    22e7:	|  |  |                       |  |  /----- 73 1e                	jae    2307 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x307>
+    22e9:	|  |  |                       |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        d[i] = p[i % 16];
+    22f0:	|  |  |                       |  |  |  /-> 48 89 f0             	mov    %rsi,%rax
+    22f3:	|  |  |                       |  |  |  |   83 e0 0f             	and    $0xf,%eax
+    22f6:	|  |  |                       |  |  |  |   0f b6 04 01          	movzbl (%rcx,%rax,1),%eax
+    22fa:	|  |  |                       |  |  |  |   41 88 04 30          	mov    %al,(%r8,%rsi,1)
+    for (; i < n; ++i) {
+    22fe:	|  |  |                       |  |  |  |   48 83 c6 01          	add    $0x1,%rsi
+    2302:	|  |  |                       |  |  |  |   48 39 f2             	cmp    %rsi,%rdx
+    2305:	|  |  |                       |  |  |  \-- 75 e9                	jne    22f0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2f0>
+    }
+}
+    2307:	|  |  |                       |  |  \----> 5b                   	pop    %rbx
+    2308:	|  |  |                       |  |         5d                   	pop    %rbp
+    2309:	|  |  |                       |  |         41 5c                	pop    %r12
+    230b:	|  |  |                       |  |         41 5d                	pop    %r13
+    230d:	|  |  |                       |  |         41 5e                	pop    %r14
+    230f:	|  |  |                       |  |         41 5f                	pop    %r15
+    2311:	|  |  |                       |  |         c3                   	ret
+    2312:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    2318:	|  |  |                       |  \-------> 48 83 ff 06          	cmp    $0x6,%rdi
+    231c:	|  |  |  /--------------------|----------- 0f 86 e1 01 00 00    	jbe    2503 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x503>
+        d[i] = p[i];
+    2322:	|  |  |  |                    |            48 8b 31             	mov    (%rcx),%rsi
+    2325:	|  |  |  |                    |            49 89 30             	mov    %rsi,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    2328:	|  |  |  |                    |            48 83 f8 08          	cmp    $0x8,%rax
+    232c:	+--|--|--|--------------------|----------- 0f 84 fe fd ff ff    	je     2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    2332:	|  |  |  |                    |            48 8d 70 f7          	lea    -0x9(%rax),%rsi
+    2336:	|  |  |  |                    |            4c 8d 48 f8          	lea    -0x8(%rax),%r9
+    233a:	|  |  |  |                    |            48 83 fe 02          	cmp    $0x2,%rsi
+    233e:	|  |  |  |                    |            be 08 00 00 00       	mov    $0x8,%esi
+    2343:	|  |  |  |                    |        /-- 76 15                	jbe    235a <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x35a>
+        d[i] = p[i];
+    2345:	|  |  |  |  /-----------------|--------|-> 8b 3c 31             	mov    (%rcx,%rsi,1),%edi
+    2348:	|  |  |  |  |                 |        |   41 89 3c 30          	mov    %edi,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    234c:	|  |  |  |  |                 |        |   48 83 c6 04          	add    $0x4,%rsi
+    2350:	|  |  |  |  |                 |        |   49 83 f9 04          	cmp    $0x4,%r9
+    2354:	+--|--|--|--|-----------------|--------|-- 0f 84 d6 fd ff ff    	je     2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    235a:	|  |  |  |  |                 |        \-> 0f b6 3c 31          	movzbl (%rcx,%rsi,1),%edi
+    235e:	|  |  |  |  |                 |            41 88 3c 30          	mov    %dil,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    2362:	|  |  |  |  |                 |            48 8d 7e 01          	lea    0x1(%rsi),%rdi
+    2366:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    2369:	+--|--|--|--|-----------------|----------- 0f 83 c1 fd ff ff    	jae    2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    236f:	|  |  |  |  |                 |            0f b6 7c 31 01       	movzbl 0x1(%rcx,%rsi,1),%edi
+    2374:	|  |  |  |  |                 |            41 88 7c 30 01       	mov    %dil,0x1(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    2379:	|  |  |  |  |                 |            48 8d 7e 02          	lea    0x2(%rsi),%rdi
+    237d:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    2380:	+--|--|--|--|-----------------|----------- 0f 83 aa fd ff ff    	jae    2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    2386:	|  |  |  |  |                 |            0f b6 7c 31 02       	movzbl 0x2(%rcx,%rsi,1),%edi
+    238b:	|  |  |  |  |                 |            41 88 7c 30 02       	mov    %dil,0x2(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    2390:	+--|--|--|--|-----------------|----------- e9 9b fd ff ff       	jmp    2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    2395:	|  |  |  |  |                 |            0f 1f 00             	nopl   (%rax)
+    Length done = (n < 16) ? n : 16;
+    2398:	|  |  |  |  |                 \----------> 41 ba 10 00 00 00    	mov    $0x10,%r10d
+    239e:	|  |  |  |  |                              4c 39 d2             	cmp    %r10,%rdx
+    23a1:	|  |  |  |  |                              4c 0f 46 d2          	cmovbe %rdx,%r10
+    std::memcpy(d, s, n);
+    23a5:	|  |  |  |  |                              44 89 d0             	mov    %r10d,%eax
+    23a8:	|  |  |  |  |                              41 83 fa 08          	cmp    $0x8,%r10d
+    23ac:	|  |  |  |  |        /-------------------- 0f 82 cc 00 00 00    	jb     247e <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47e>
+    23b2:	|  |  |  |  |        |                     48 8b 06             	mov    (%rsi),%rax
+    23b5:	|  |  |  |  |        |                     4c 8d 4f 08          	lea    0x8(%rdi),%r9
+    23b9:	|  |  |  |  |        |                     49 83 e1 f8          	and    $0xfffffffffffffff8,%r9
+    23bd:	|  |  |  |  |        |                     48 89 07             	mov    %rax,(%rdi)
+    23c0:	|  |  |  |  |        |                     44 89 d0             	mov    %r10d,%eax
+    23c3:	|  |  |  |  |        |                     48 8b 74 06 f8       	mov    -0x8(%rsi,%rax,1),%rsi
+    23c8:	|  |  |  |  |        |                     48 89 74 07 f8       	mov    %rsi,-0x8(%rdi,%rax,1)
+    23cd:	|  |  |  |  |        |                     48 89 f8             	mov    %rdi,%rax
+    23d0:	|  |  |  |  |        |                     4c 29 c8             	sub    %r9,%rax
+    23d3:	|  |  |  |  |        |                     48 29 c1             	sub    %rax,%rcx
+    23d6:	|  |  |  |  |        |                     44 01 d0             	add    %r10d,%eax
+    23d9:	|  |  |  |  |        |                     83 e0 f8             	and    $0xfffffff8,%eax
+    23dc:	|  |  |  |  |        |                     83 f8 08             	cmp    $0x8,%eax
+    23df:	|  |  |  |  |  /-----|-------------------- 72 16                	jb     23f7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    23e1:	|  |  |  |  |  |     |                     83 e0 f8             	and    $0xfffffff8,%eax
+    23e4:	|  |  |  |  |  |     |                     31 f6                	xor    %esi,%esi
+    23e6:	|  |  |  |  |  |     |                 /-> 89 f7                	mov    %esi,%edi
+    23e8:	|  |  |  |  |  |     |                 |   83 c6 08             	add    $0x8,%esi
+    23eb:	|  |  |  |  |  |     |                 |   4c 8b 1c 39          	mov    (%rcx,%rdi,1),%r11
+    23ef:	|  |  |  |  |  |     |                 |   4d 89 1c 39          	mov    %r11,(%r9,%rdi,1)
+    23f3:	|  |  |  |  |  |     |                 |   39 c6                	cmp    %eax,%esi
+    23f5:	|  |  |  |  |  |     |                 \-- 72 ef                	jb     23e6 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3e6>
+    while (done < n) {
+    23f7:	|  |  |  |  |  >-----|-------------------> 49 39 d2             	cmp    %rdx,%r10
+    23fa:	|  |  |  |  |  |     |           /-------- 72 33                	jb     242f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    23fc:	|  |  |  |  |  |     |     /-----|-------- e9 af 00 00 00       	jmp    24b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b0>
+    2401:	|  |  |  |  |  |     |     |     |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    std::memcpy(d, s, n);
+    2408:	|  |  |  |  |  |     |     |     |     /-> 41 f6 c1 04          	test   $0x4,%r9b
+    240c:	|  |  |  |  |  |     |     |  /--|-----|-- 0f 85 9f 00 00 00    	jne    24b1 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b1>
+    2412:	|  |  |  |  |  |     |     |  |  |     |   45 85 c9             	test   %r9d,%r9d
+    2415:	|  |  |  |  |  |  /--|-----|--|--|-----|-- 74 10                	je     2427 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    2417:	|  |  |  |  |  |  |  |     |  |  |     |   41 0f b6 08          	movzbl (%r8),%ecx
+    241b:	|  |  |  |  |  |  |  |     |  |  |     |   88 08                	mov    %cl,(%rax)
+    241d:	|  |  |  |  |  |  |  |     |  |  |     |   41 f6 c1 02          	test   $0x2,%r9b
+    2421:	|  |  |  |  |  |  |  |  /--|--|--|-----|-- 0f 85 c9 00 00 00    	jne    24f0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4f0>
+        done += m;
+    2427:	|  |  |  |  |  |  >--|--|--|--|--|-----|-> 4d 01 ca             	add    %r9,%r10
+    while (done < n) {
+    242a:	|  |  |  |  |  |  |  |  |  |  |  |     |   49 39 d2             	cmp    %rdx,%r10
+    242d:	|  |  |  |  |  |  |  |  |  |  |  |  /--|-- 73 4e                	jae    247d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47d>
+        Length const m = (done < n - done) ? done : n - done;
+    242f:	|  |  |  |  |  |  |  |  |  |  |  >--|--|-> 49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    2432:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4b 8d 04 10          	lea    (%r8,%r10,1),%rax
+        Length const m = (done < n - done) ? done : n - done;
+    2436:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 29 d1             	sub    %r10,%r9
+    2439:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 39 d1             	cmp    %r10,%r9
+    243c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 0f 47 ca          	cmova  %r10,%r9
+    std::memcpy(d, s, n);
+    2440:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   41 83 f9 08          	cmp    $0x8,%r9d
+    2444:	|  |  |  |  |  |  |  |  |  |  |  |  |  \-- 72 c2                	jb     2408 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x408>
+    2446:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 08             	mov    (%r8),%rcx
+    2449:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 78 08          	lea    0x8(%rax),%rdi
+        done += m;
+    244d:	|  |  |  |  |  |  |  |  |  |  |  |  |      4d 01 ca             	add    %r9,%r10
+    std::memcpy(d, s, n);
+    2450:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 83 e7 f8          	and    $0xfffffffffffffff8,%rdi
+    2454:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 08             	mov    %rcx,(%rax)
+    2457:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 89 c9             	mov    %r9d,%ecx
+    245a:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 74 08 f8       	mov    -0x8(%r8,%rcx,1),%rsi
+    245f:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 74 08 f8       	mov    %rsi,-0x8(%rax,%rcx,1)
+    2464:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 f8             	sub    %rdi,%rax
+    2467:	|  |  |  |  |  |  |  |  |  |  |  |  |      4c 89 c6             	mov    %r8,%rsi
+    246a:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 c6             	sub    %rax,%rsi
+    246d:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 01 c8             	add    %r9d,%eax
+    2470:	|  |  |  |  |  |  |  |  |  |  |  |  |      c1 e8 03             	shr    $0x3,%eax
+    2473:	|  |  |  |  |  |  |  |  |  |  |  |  |      89 c1                	mov    %eax,%ecx
+    2475:	|  |  |  |  |  |  |  |  |  |  |  |  |      f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    2478:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 39 d2             	cmp    %rdx,%r10
+    247b:	|  |  |  |  |  |  |  |  |  |  |  \--|----- 72 b2                	jb     242f <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    247d:	|  |  |  |  |  |  |  |  |  |  |     \----> c3                   	ret
+    std::memcpy(d, s, n);
+    247e:	|  |  |  |  |  |  |  \--|--|--|----------> 41 f6 c2 04          	test   $0x4,%r10b
+    2482:	|  |  |  |  |  |  |     |  |  |        /-- 0f 85 85 00 00 00    	jne    250d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x50d>
+    2488:	|  |  |  |  |  |  |     |  |  |        |   85 c0                	test   %eax,%eax
+    248a:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 67 ff ff ff    	je     23f7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    2490:	|  |  |  |  |  |  |     |  |  |        |   0f b6 36             	movzbl (%rsi),%esi
+    2493:	|  |  |  |  |  |  |     |  |  |        |   40 88 37             	mov    %sil,(%rdi)
+    2496:	|  |  |  |  |  |  |     |  |  |        |   a8 02                	test   $0x2,%al
+    2498:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 59 ff ff ff    	je     23f7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    249e:	|  |  |  |  |  |  |     |  |  |        |   0f b7 4c 01 fe       	movzwl -0x2(%rcx,%rax,1),%ecx
+    24a3:	|  |  |  |  |  |  |     |  |  |        |   66 89 4c 07 fe       	mov    %cx,-0x2(%rdi,%rax,1)
+    24a8:	|  |  |  |  |  +--|-----|--|--|--------|-- e9 4a ff ff ff       	jmp    23f7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    24ad:	|  |  |  |  |  |  |     |  |  |        |   0f 1f 00             	nopl   (%rax)
+    24b0:	|  |  |  |  |  |  |     |  \--|--------|-> c3                   	ret
+    24b1:	|  |  |  |  |  |  |     |     \--------|-> 41 8b 08             	mov    (%r8),%ecx
+    24b4:	|  |  |  |  |  |  |     |              |   89 08                	mov    %ecx,(%rax)
+    24b6:	|  |  |  |  |  |  |     |              |   44 89 c9             	mov    %r9d,%ecx
+    24b9:	|  |  |  |  |  |  |     |              |   41 8b 74 08 fc       	mov    -0x4(%r8,%rcx,1),%esi
+    24be:	|  |  |  |  |  |  |     |              |   89 74 08 fc          	mov    %esi,-0x4(%rax,%rcx,1)
+    24c2:	|  |  |  |  |  |  +-----|--------------|-- e9 60 ff ff ff       	jmp    2427 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+        d[i] = p[i];
+    24c7:	|  \--|--|--|--|--|-----|--------------|-> 0f b6 39             	movzbl (%rcx),%edi
+    24ca:	|     |  |  |  |  |     |              |   41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    24cd:	|     |  |  |  |  |     |              |   40 f6 c6 0e          	test   $0xe,%sil
+    24d1:	+-----|--|--|--|--|-----|--------------|-- 0f 84 59 fc ff ff    	je     2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    24d7:	|     |  |  |  |  |     |              |   0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    24db:	|     |  |  |  |  |     |              |   41 88 78 01          	mov    %dil,0x1(%r8)
+    for (Index i = 0; i < head; ++i) {
+    24df:	|     |  |  |  |  |     |              |   48 83 f8 03          	cmp    $0x3,%rax
+    24e3:	\-----|--|--|--|--|-----|--------------|-- 0f 85 47 fc ff ff    	jne    2130 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    24e9:	      \--|--|--|--|-----|--------------|-- e9 7b fb ff ff       	jmp    2069 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x69>
+    24ee:	         |  |  |  |     |              |   66 90                	xchg   %ax,%ax
+    std::memcpy(d, s, n);
+    24f0:	         |  |  |  |     \--------------|-> 44 89 c9             	mov    %r9d,%ecx
+    24f3:	         |  |  |  |                    |   41 0f b7 74 08 fe    	movzwl -0x2(%r8,%rcx,1),%esi
+    24f9:	         |  |  |  |                    |   66 89 74 08 fe       	mov    %si,-0x2(%rax,%rcx,1)
+    24fe:	         |  |  |  \--------------------|-- e9 24 ff ff ff       	jmp    2427 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    for (Index i = 0; i < head; ++i) {
+    2503:	         \--|--|-----------------------|-> 49 89 c1             	mov    %rax,%r9
+    2506:	            |  |                       |   31 f6                	xor    %esi,%esi
+    2508:	            \--|-----------------------|-- e9 38 fe ff ff       	jmp    2345 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x345>
+    std::memcpy(d, s, n);
+    250d:	               |                       \-> 8b 36                	mov    (%rsi),%esi
+    250f:	               |                           89 37                	mov    %esi,(%rdi)
+    2511:	               |                           8b 4c 01 fc          	mov    -0x4(%rcx,%rax,1),%ecx
+    2515:	               |                           89 4c 07 fc          	mov    %ecx,-0x4(%rdi,%rax,1)
+    2519:	               \-------------------------- e9 d9 fe ff ff       	jmp    23f7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    251e:	                                           66 90                	xchg   %ax,%ax
+
+0000000000002520 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    2520:	    48 85 ff             	test   %rdi,%rdi
+    2523:	/-- 74 0b                	je     2530 <nel::free_aligned(void*)+0x10>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    2525:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    2529:	|   e9 02 eb ff ff       	jmp    1030 <free@plt>
+    252e:	|   66 90                	xchg   %ax,%ax
+}
+    2530:	\-> c3                   	ret
+    2531:	    66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2538:	    00 00 00 00 
+    253c:	    0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002540 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    2540:	                   41 56                	push   %r14
+            : fn_name_(fn_name)
+    2542:	                   48 8d 05 cf 0b 00 00 	lea    0xbcf(%rip),%rax        # 3118 <_IO_stdin_used+0x118>
+    2549:	                   41 55                	push   %r13
+    254b:	                   66 48 0f 6e c8       	movq   %rax,%xmm1
+    2550:	                   41 54                	push   %r12
+    2552:	                   55                   	push   %rbp
+    2553:	                   48 89 cd             	mov    %rcx,%rbp
+    2556:	                   48 8d 0d ab 0b 00 00 	lea    0xbab(%rip),%rcx        # 3108 <_IO_stdin_used+0x108>
+    255d:	                   53                   	push   %rbx
+    255e:	                   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    2563:	                   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2567:	                   48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    256b:	                   c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    2572:	                   00 
+            : fn_name_(fn_name)
+    2573:	                   0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    2577:	                   48 85 f6             	test   %rsi,%rsi
+    257a:	/----------------- 0f 84 a0 00 00 00    	je     2620 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    2580:	|                  48 8d 46 ff          	lea    -0x1(%rsi),%rax
+    2584:	|                  48 89 f3             	mov    %rsi,%rbx
+    2587:	|                  48 85 f0             	test   %rsi,%rax
+    258a:	+----------------- 0f 85 90 00 00 00    	jne    2620 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2590:	|                  48 8d 34 2e          	lea    (%rsi,%rbp,1),%rsi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    2594:	|                  48 85 ff             	test   %rdi,%rdi
+    2597:	|     /----------- 74 67                	je     2600 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xc0>
+    2599:	|     |            4c 8b 6f f8          	mov    -0x8(%rdi),%r13
+    uint8_t *const new_base =
+    259d:	|     |            49 89 d4             	mov    %rdx,%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    25a0:	|     |            4c 29 ef             	sub    %r13,%rdi
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    25a3:	|     |            e8 18 eb ff ff       	call   10c0 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    25a8:	|     |            48 85 c0             	test   %rax,%rax
+    25ab:	|  /--|----------- 0f 84 7e 00 00 00    	je     262f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    25b1:	|  |  |            48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    25b6:	|  |  |            48 f7 db             	neg    %rbx
+    25b9:	|  |  |            48 21 cb             	and    %rcx,%rbx
+    25bc:	|  |  |            49 89 de             	mov    %rbx,%r14
+    25bf:	|  |  |            49 29 c6             	sub    %rax,%r14
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    25c2:	|  |  |            4d 39 f5             	cmp    %r14,%r13
+    25c5:	|  |  |        /-- 75 19                	jne    25e0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xa0>
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    }
+    offset_field(new_p) = new_offset;
+    25c7:	|  |  |     /--|-> 4c 89 73 f8          	mov    %r14,-0x8(%rbx)
+    return new_p;
+}
+    25cb:	|  |  |  /--|--|-> 48 83 c4 20          	add    $0x20,%rsp
+    25cf:	|  |  |  |  |  |   48 89 d8             	mov    %rbx,%rax
+    25d2:	|  |  |  |  |  |   5b                   	pop    %rbx
+    25d3:	|  |  |  |  |  |   5d                   	pop    %rbp
+    25d4:	|  |  |  |  |  |   41 5c                	pop    %r12
+    25d6:	|  |  |  |  |  |   41 5d                	pop    %r13
+    25d8:	|  |  |  |  |  |   41 5e                	pop    %r14
+    25da:	|  |  |  |  |  |   c3                   	ret
+    25db:	|  |  |  |  |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        std::memmove(new_p, new_base + old_offset, n);
+    25e0:	|  |  |  |  |  \-> 4c 39 e5             	cmp    %r12,%rbp
+    25e3:	|  |  |  |  |      4c 89 e2             	mov    %r12,%rdx
+    25e6:	|  |  |  |  |      4a 8d 34 28          	lea    (%rax,%r13,1),%rsi
+    25ea:	|  |  |  |  |      48 89 df             	mov    %rbx,%rdi
+    25ed:	|  |  |  |  |      48 0f 46 d5          	cmovbe %rbp,%rdx
+    25f1:	|  |  |  |  |      e8 da ea ff ff       	call   10d0 <memmove@plt>
+    25f6:	|  |  |  |  +----- eb cf                	jmp    25c7 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+    25f8:	|  |  |  |  |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    25ff:	|  |  |  |  |      00 
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    2600:	|  |  \--|--|----> 48 89 f7             	mov    %rsi,%rdi
+    2603:	|  |     |  |      e8 a8 ea ff ff       	call   10b0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    2608:	|  |     |  |      48 85 c0             	test   %rax,%rax
+    260b:	|  +-----|--|----- 74 22                	je     262f <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    260d:	|  |     |  |      48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    2612:	|  |     |  |      48 f7 db             	neg    %rbx
+    2615:	|  |     |  |      48 21 d3             	and    %rdx,%rbx
+    2618:	|  |     |  |      49 89 de             	mov    %rbx,%r14
+    261b:	|  |     |  |      49 29 c6             	sub    %rax,%r14
+    if (old_p != nullptr && new_offset != old_offset) {
+    261e:	|  |     |  \----- eb a7                	jmp    25c7 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+    if (!pred) { assert_fail(msg, ctx); }
+    2620:	\--|-----|-------> 48 89 e6             	mov    %rsp,%rsi
+    2623:	   |     |         48 8d 3d 00 0b 00 00 	lea    0xb00(%rip),%rdi        # 312a <_IO_stdin_used+0x12a>
+    262a:	   |     |         e8 23 eb ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    if (new_base == nullptr) { return nullptr; }
+    262f:	   \-----|-------> 31 db                	xor    %ebx,%ebx
+    2631:	         \-------- eb 98                	jmp    25cb <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x8b>
+    2633:	                   66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    263a:	                   00 00 00 00 
+    263e:	                   66 90                	xchg   %ax,%ax
+
+0000000000002640 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    2640:	       53                   	push   %rbx
+            : fn_name_(fn_name)
+    2641:	       48 8d 05 d0 0a 00 00 	lea    0xad0(%rip),%rax        # 3118 <_IO_stdin_used+0x118>
+    2648:	       48 8d 0d b9 0a 00 00 	lea    0xab9(%rip),%rcx        # 3108 <_IO_stdin_used+0x108>
+    264f:	       66 48 0f 6e c1       	movq   %rcx,%xmm0
+    2654:	       66 48 0f 6e c8       	movq   %rax,%xmm1
+    2659:	       66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    265d:	       48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    2661:	       c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    2668:	       00 
+            : fn_name_(fn_name)
+    2669:	       0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    266d:	       48 85 ff             	test   %rdi,%rdi
+    2670:	/----- 74 35                	je     26a7 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+    2672:	|      48 8d 47 ff          	lea    -0x1(%rdi),%rax
+    2676:	|      48 89 fb             	mov    %rdi,%rbx
+    2679:	|      48 85 f8             	test   %rdi,%rax
+    267c:	+----- 75 29                	jne    26a7 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    267e:	|      48 8d 3c 37          	lea    (%rdi,%rsi,1),%rdi
+    2682:	|      e8 29 ea ff ff       	call   10b0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    2687:	|      48 85 c0             	test   %rax,%rax
+    268a:	|  /-- 74 15                	je     26a1 <nel::malloc_aligned(unsigned long, unsigned long)+0x61>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    268c:	|  |   48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    2691:	|  |   48 f7 db             	neg    %rbx
+    2694:	|  |   48 21 da             	and    %rbx,%rdx
+    2697:	|  |   48 29 c2             	sub    %rax,%rdx
+    uint8_t *const new_p = new_base + new_offset;
+    269a:	|  |   48 01 d0             	add    %rdx,%rax
+    offset_field(new_p) = new_offset;
+    269d:	|  |   48 89 50 f8          	mov    %rdx,-0x8(%rax)
+    return realloc_aligned(nullptr, align, 0, size);
+}
+    26a1:	|  \-> 48 83 c4 20          	add    $0x20,%rsp
+    26a5:	|      5b                   	pop    %rbx
+    26a6:	|      c3                   	ret
+    if (!pred) { assert_fail(msg, ctx); }
+    26a7:	\----> 48 89 e6             	mov    %rsp,%rsi
+    26aa:	       48 8d 3d 79 0a 00 00 	lea    0xa79(%rip),%rdi        # 312a <_IO_stdin_used+0x12a>
+    26b1:	       e8 9c ea ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    26b6:	       66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    26bd:	       00 00 00 
+
+00000000000026c0 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    26c0:	53                   	push   %rbx
+    26c1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    26c4:	40 0f be fe          	movsbl %sil,%edi
+    26c8:	48 8b 35 b1 29 00 00 	mov    0x29b1(%rip),%rsi        # 5080 <stderr@GLIBC_2.2.5>
+    26cf:	e8 9c e9 ff ff       	call   1070 <fputc@plt>
+    return outs;
+}
+    26d4:	48 89 d8             	mov    %rbx,%rax
+    26d7:	5b                   	pop    %rbx
+    26d8:	c3                   	ret
+    26d9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000026e0 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    26e0:	53                   	push   %rbx
+    26e1:	48 89 fb             	mov    %rdi,%rbx
+    26e4:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    26e7:	48 8b 35 92 29 00 00 	mov    0x2992(%rip),%rsi        # 5080 <stderr@GLIBC_2.2.5>
+    26ee:	e8 5d e9 ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    26f3:	48 89 d8             	mov    %rbx,%rax
+    26f6:	5b                   	pop    %rbx
+    26f7:	c3                   	ret
+    26f8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    26ff:	00 
+
+0000000000002700 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    2700:	53                   	push   %rbx
+    2701:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    2704:	48 8b 3d 75 29 00 00 	mov    0x2975(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    270b:	40 0f b6 d6          	movzbl %sil,%edx
+    270f:	31 c0                	xor    %eax,%eax
+    2711:	48 8d 35 2d 0a 00 00 	lea    0xa2d(%rip),%rsi        # 3145 <_IO_stdin_used+0x145>
+    2718:	e8 73 e9 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    271d:	48 89 d8             	mov    %rbx,%rax
+    2720:	5b                   	pop    %rbx
+    2721:	c3                   	ret
+    2722:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2729:	00 00 00 00 
+    272d:	0f 1f 00             	nopl   (%rax)
+
+0000000000002730 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    2730:	53                   	push   %rbx
+    2731:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    2734:	48 8b 3d 45 29 00 00 	mov    0x2945(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+    273b:	0f b7 d6             	movzwl %si,%edx
+    273e:	31 c0                	xor    %eax,%eax
+    2740:	48 8d 35 fe 09 00 00 	lea    0x9fe(%rip),%rsi        # 3145 <_IO_stdin_used+0x145>
+    2747:	e8 44 e9 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    274c:	48 89 d8             	mov    %rbx,%rax
+    274f:	5b                   	pop    %rbx
+    2750:	c3                   	ret
+    2751:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2758:	00 00 00 00 
+    275c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000002760 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    2760:	53                   	push   %rbx
+    2761:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    2764:	48 8b 3d 15 29 00 00 	mov    0x2915(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    276b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    276d:	31 c0                	xor    %eax,%eax
+    276f:	48 8d 35 cf 09 00 00 	lea    0x9cf(%rip),%rsi        # 3145 <_IO_stdin_used+0x145>
+    2776:	e8 15 e9 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    277b:	48 89 d8             	mov    %rbx,%rax
+    277e:	5b                   	pop    %rbx
+    277f:	c3                   	ret
+
+0000000000002780 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    2780:	53                   	push   %rbx
+    2781:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    2784:	48 8b 3d f5 28 00 00 	mov    0x28f5(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    278b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    278d:	31 c0                	xor    %eax,%eax
+    278f:	48 8d 35 af 09 00 00 	lea    0x9af(%rip),%rsi        # 3145 <_IO_stdin_used+0x145>
+    2796:	e8 f5 e8 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    279b:	48 89 d8             	mov    %rbx,%rax
+    279e:	5b                   	pop    %rbx
+    279f:	c3                   	ret
+
+00000000000027a0 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    27a0:	53                   	push   %rbx
+    27a1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    27a4:	48 8b 3d d5 28 00 00 	mov    0x28d5(%rip),%rdi        # 5080 <stderr@GLIBC_2.2.5>
+{
+    27ab:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    27ae:	31 c0                	xor    %eax,%eax
+    27b0:	48 8d 35 91 09 00 00 	lea    0x991(%rip),%rsi        # 3148 <_IO_stdin_used+0x148>
+    27b7:	e8 d4 e8 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    27bc:	48 89 d8             	mov    %rbx,%rax
+    27bf:	5b                   	pop    %rbx
+    27c0:	c3                   	ret
+
+Disassembly of section .fini:
+
+00000000000027c4 <_fini>:
+    27c4:	48 83 ec 08          	sub    $0x8,%rsp
+    27c8:	48 83 c4 08          	add    $0x8,%rsp
+    27cc:	c3                   	ret
@@ -0,0 +1,3974 @@
+
+target/release/examples/largestruct1_vector:     file format elf64-x86-64
+
+
+Disassembly of section .init:
+
+0000000000001000 <_init>:
+    1000:	    48 83 ec 08          	sub    $0x8,%rsp
+    1004:	    48 8b 05 c5 4f 00 00 	mov    0x4fc5(%rip),%rax        # 5fd0 <__gmon_start__@Base>
+    100b:	    48 85 c0             	test   %rax,%rax
+    100e:	/-- 74 02                	je     1012 <_init+0x12>
+    1010:	|   ff d0                	call   *%rax
+    1012:	\-> 48 83 c4 08          	add    $0x8,%rsp
+    1016:	    c3                   	ret
+
+Disassembly of section .plt:
+
+0000000000001020 <free@plt-0x10>:
+    1020:	ff 35 ca 4f 00 00    	push   0x4fca(%rip)        # 5ff0 <_GLOBAL_OFFSET_TABLE_+0x8>
+    1026:	ff 25 cc 4f 00 00    	jmp    *0x4fcc(%rip)        # 5ff8 <_GLOBAL_OFFSET_TABLE_+0x10>
+    102c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001030 <free@plt>:
+    1030:	ff 25 ca 4f 00 00    	jmp    *0x4fca(%rip)        # 6000 <free@GLIBC_2.2.5>
+    1036:	68 00 00 00 00       	push   $0x0
+    103b:	e9 e0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001040 <abort@plt>:
+    1040:	ff 25 c2 4f 00 00    	jmp    *0x4fc2(%rip)        # 6008 <abort@GLIBC_2.2.5>
+    1046:	68 01 00 00 00       	push   $0x1
+    104b:	e9 d0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001050 <fputs@plt>:
+    1050:	ff 25 ba 4f 00 00    	jmp    *0x4fba(%rip)        # 6010 <fputs@GLIBC_2.2.5>
+    1056:	68 02 00 00 00       	push   $0x2
+    105b:	e9 c0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001060 <memset@plt>:
+    1060:	ff 25 b2 4f 00 00    	jmp    *0x4fb2(%rip)        # 6018 <memset@GLIBC_2.2.5>
+    1066:	68 03 00 00 00       	push   $0x3
+    106b:	e9 b0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001070 <fputc@plt>:
+    1070:	ff 25 aa 4f 00 00    	jmp    *0x4faa(%rip)        # 6020 <fputc@GLIBC_2.2.5>
+    1076:	68 04 00 00 00       	push   $0x4
+    107b:	e9 a0 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001080 <memcmp@plt>:
+    1080:	ff 25 a2 4f 00 00    	jmp    *0x4fa2(%rip)        # 6028 <memcmp@GLIBC_2.2.5>
+    1086:	68 05 00 00 00       	push   $0x5
+    108b:	e9 90 ff ff ff       	jmp    1020 <_init+0x20>
+
+0000000000001090 <fprintf@plt>:
+    1090:	ff 25 9a 4f 00 00    	jmp    *0x4f9a(%rip)        # 6030 <fprintf@GLIBC_2.2.5>
+    1096:	68 06 00 00 00       	push   $0x6
+    109b:	e9 80 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010a0 <memcpy@plt>:
+    10a0:	ff 25 92 4f 00 00    	jmp    *0x4f92(%rip)        # 6038 <memcpy@GLIBC_2.14>
+    10a6:	68 07 00 00 00       	push   $0x7
+    10ab:	e9 70 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010b0 <malloc@plt>:
+    10b0:	ff 25 8a 4f 00 00    	jmp    *0x4f8a(%rip)        # 6040 <malloc@GLIBC_2.2.5>
+    10b6:	68 08 00 00 00       	push   $0x8
+    10bb:	e9 60 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010c0 <realloc@plt>:
+    10c0:	ff 25 82 4f 00 00    	jmp    *0x4f82(%rip)        # 6048 <realloc@GLIBC_2.2.5>
+    10c6:	68 09 00 00 00       	push   $0x9
+    10cb:	e9 50 ff ff ff       	jmp    1020 <_init+0x20>
+
+00000000000010d0 <memmove@plt>:
+    10d0:	ff 25 7a 4f 00 00    	jmp    *0x4f7a(%rip)        # 6050 <memmove@GLIBC_2.2.5>
+    10d6:	68 0a 00 00 00       	push   $0xa
+    10db:	e9 40 ff ff ff       	jmp    1020 <_init+0x20>
+
+Disassembly of section .plt.got:
+
+00000000000010e0 <__cxa_finalize@plt>:
+    10e0:	ff 25 fa 4e 00 00    	jmp    *0x4efa(%rip)        # 5fe0 <__cxa_finalize@GLIBC_2.2.5>
+    10e6:	66 90                	xchg   %ax,%ax
+
+Disassembly of section .text:
+
+00000000000010f0 <nel::abort()>:
+
+#if !defined(TEST)
+[[noreturn]] void abort(void);
+
+[[noreturn]] void abort(void)
+{
+    10f0:	50                   	push   %rax
+    std::abort();
+    10f1:	e8 4a ff ff ff       	call   1040 <abort@plt>
+
+00000000000010f6 <nel::panic0(nel::Context const&)>:
+}
+#endif
+
+[[noreturn]] void panic0(Context const &ctx)
+{
+    10f6:	50                   	push   %rax
+#if defined(TEST)
+    _panic(ctx);
+#else
+    fprintf(stderr, "\n%s:%d:[%s]: %s\n", ctx.file_name_, ctx.line_num_, ctx.fn_name_, "PANIC");
+    10f7:	8b 4f 10             	mov    0x10(%rdi),%ecx
+    10fa:	4c 8d 0d 0f 30 00 00 	lea    0x300f(%rip),%r9        # 4110 <_IO_stdin_used+0x110>
+    1101:	31 c0                	xor    %eax,%eax
+    1103:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+    1107:	4c 8b 07             	mov    (%rdi),%r8
+    110a:	48 8d 35 05 30 00 00 	lea    0x3005(%rip),%rsi        # 4116 <_IO_stdin_used+0x116>
+    1111:	48 8b 3d 68 4f 00 00 	mov    0x4f68(%rip),%rdi        # 6080 <stderr@GLIBC_2.2.5>
+    1118:	e8 73 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    111d:	e8 1e ff ff ff       	call   1040 <abort@plt>
+
+0000000000001122 <nel::panic(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void panic(char const *const msg, Context const &ctx)
+{
+    1122:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "", msg);
+#else
+    fprintf(stderr,
+    1126:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1129:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    112d:	31 c0                	xor    %eax,%eax
+    112f:	57                   	push   %rdi
+    1130:	48 8b 3d 49 4f 00 00 	mov    0x4f49(%rip),%rdi        # 6080 <stderr@GLIBC_2.2.5>
+    1137:	4c 8d 0d d2 2f 00 00 	lea    0x2fd2(%rip),%r9        # 4110 <_IO_stdin_used+0x110>
+    113e:	4c 8b 06             	mov    (%rsi),%r8
+    1141:	48 8d 35 df 2f 00 00 	lea    0x2fdf(%rip),%rsi        # 4127 <_IO_stdin_used+0x127>
+    1148:	e8 43 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    114d:	e8 ee fe ff ff       	call   1040 <abort@plt>
+
+0000000000001152 <nel::assert_fail(char const*, nel::Context const&)>:
+    abort();
+#endif
+}
+
+[[noreturn]] void assert_fail(char const *const msg, Context const &ctx)
+{
+    1152:	48 83 ec 10          	sub    $0x10,%rsp
+#if defined(TEST)
+    _panic(ctx, "ASSERT FAIL", msg);
+#else
+    fprintf(stderr,
+    1156:	8b 4e 10             	mov    0x10(%rsi),%ecx
+    1159:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+    115d:	31 c0                	xor    %eax,%eax
+    115f:	57                   	push   %rdi
+    1160:	48 8b 3d 19 4f 00 00 	mov    0x4f19(%rip),%rdi        # 6080 <stderr@GLIBC_2.2.5>
+    1167:	4c 8d 0d ce 2f 00 00 	lea    0x2fce(%rip),%r9        # 413c <_IO_stdin_used+0x13c>
+    116e:	4c 8b 06             	mov    (%rsi),%r8
+    1171:	48 8d 35 af 2f 00 00 	lea    0x2faf(%rip),%rsi        # 4127 <_IO_stdin_used+0x127>
+    1178:	e8 13 ff ff ff       	call   1090 <fprintf@plt>
+    std::abort();
+    117d:	e8 be fe ff ff       	call   1040 <abort@plt>
+    1182:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1189:	00 00 00 
+    118c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001190 <main>:
+    it.for_each2([&](U8Buf<256> &e) -> void { nel::log << e << '\n'; });
+}
+#endif
+
+int main()
+{
+    1190:	53                   	push   %rbx
+    nel::log << "ex1:b" << '\n';
+    1191:	48 8d 1d f1 4e 00 00 	lea    0x4ef1(%rip),%rbx        # 6089 <nel::log>
+    1198:	48 8d 35 c5 2e 00 00 	lea    0x2ec5(%rip),%rsi        # 4064 <_IO_stdin_used+0x64>
+    119f:	48 89 df             	mov    %rbx,%rdi
+    11a2:	e8 b9 2a 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    11a7:	be 0a 00 00 00       	mov    $0xa,%esi
+    11ac:	48 89 c7             	mov    %rax,%rdi
+    11af:	e8 8c 2a 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    ex1();
+    11b4:	e8 87 02 00 00       	call   1440 <ex1()>
+    nel::log << "ex1:e" << '\n';
+    11b9:	48 89 df             	mov    %rbx,%rdi
+    11bc:	48 8d 35 a7 2e 00 00 	lea    0x2ea7(%rip),%rsi        # 406a <_IO_stdin_used+0x6a>
+    11c3:	e8 98 2a 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    11c8:	be 0a 00 00 00       	mov    $0xa,%esi
+    11cd:	48 89 c7             	mov    %rax,%rdi
+    11d0:	e8 6b 2a 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex2:b" << '\n';
+    11d5:	48 89 df             	mov    %rbx,%rdi
+    11d8:	48 8d 35 91 2e 00 00 	lea    0x2e91(%rip),%rsi        # 4070 <_IO_stdin_used+0x70>
+    11df:	e8 7c 2a 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    11e4:	be 0a 00 00 00       	mov    $0xa,%esi
+    11e9:	48 89 c7             	mov    %rax,%rdi
+    11ec:	e8 4f 2a 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    ex2();
+    11f1:	e8 ea 04 00 00       	call   16e0 <ex2()>
+    nel::log << "ex2:e" << '\n';
+    11f6:	48 89 df             	mov    %rbx,%rdi
+    11f9:	48 8d 35 76 2e 00 00 	lea    0x2e76(%rip),%rsi        # 4076 <_IO_stdin_used+0x76>
+    1200:	e8 5b 2a 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    1205:	be 0a 00 00 00       	mov    $0xa,%esi
+    120a:	48 89 c7             	mov    %rax,%rdi
+    120d:	e8 2e 2a 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex3:b" << '\n';
+    1212:	48 89 df             	mov    %rbx,%rdi
+    1215:	48 8d 35 60 2e 00 00 	lea    0x2e60(%rip),%rsi        # 407c <_IO_stdin_used+0x7c>
+    121c:	e8 3f 2a 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    1221:	be 0a 00 00 00       	mov    $0xa,%esi
+    1226:	48 89 c7             	mov    %rax,%rdi
+    1229:	e8 12 2a 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    ex3();
+    122e:	e8 1d 0b 00 00       	call   1d50 <ex3()>
+    nel::log << "ex3:e" << '\n';
+    1233:	48 89 df             	mov    %rbx,%rdi
+    1236:	48 8d 35 45 2e 00 00 	lea    0x2e45(%rip),%rsi        # 4082 <_IO_stdin_used+0x82>
+    123d:	e8 1e 2a 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    1242:	be 0a 00 00 00       	mov    $0xa,%esi
+    1247:	48 89 c7             	mov    %rax,%rdi
+    124a:	e8 f1 29 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+#if defined(RUST_LIKE)
+    nel::log << "ex41:b" << '\n';
+    ex41();
+    nel::log << "ex41:e" << '\n';
+#endif
+    nel::log << "ex42:b" << '\n';
+    124f:	48 89 df             	mov    %rbx,%rdi
+    1252:	48 8d 35 2f 2e 00 00 	lea    0x2e2f(%rip),%rsi        # 4088 <_IO_stdin_used+0x88>
+    1259:	e8 02 2a 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    125e:	be 0a 00 00 00       	mov    $0xa,%esi
+    1263:	48 89 c7             	mov    %rax,%rdi
+    1266:	e8 d5 29 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    ex42();
+    126b:	e8 50 0e 00 00       	call   20c0 <ex42()>
+    nel::log << "ex42:e" << '\n';
+    1270:	48 89 df             	mov    %rbx,%rdi
+    1273:	48 8d 35 15 2e 00 00 	lea    0x2e15(%rip),%rsi        # 408f <_IO_stdin_used+0x8f>
+    127a:	e8 e1 29 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    127f:	be 0a 00 00 00       	mov    $0xa,%esi
+    1284:	48 89 c7             	mov    %rax,%rdi
+    1287:	e8 b4 29 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    nel::log << "ex43:b" << '\n';
+    128c:	48 89 df             	mov    %rbx,%rdi
+    128f:	48 8d 35 00 2e 00 00 	lea    0x2e00(%rip),%rsi        # 4096 <_IO_stdin_used+0x96>
+    1296:	e8 c5 29 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    129b:	be 0a 00 00 00       	mov    $0xa,%esi
+    12a0:	48 89 c7             	mov    %rax,%rdi
+    12a3:	e8 98 29 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    ex43();
+    12a8:	e8 93 17 00 00       	call   2a40 <ex43()>
+    nel::log << "ex43:e" << '\n';
+    12ad:	48 89 df             	mov    %rbx,%rdi
+    12b0:	48 8d 35 e6 2d 00 00 	lea    0x2de6(%rip),%rsi        # 409d <_IO_stdin_used+0x9d>
+    12b7:	e8 a4 29 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    12bc:	be 0a 00 00 00       	mov    $0xa,%esi
+    12c1:	48 89 c7             	mov    %rax,%rdi
+    12c4:	e8 77 29 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+#if defined(RUST_LIKE)
+    nel::log << "ex44:b" << '\n';
+    ex44();
+    nel::log << "ex44:e" << '\n';
+#endif
+}
+    12c9:	31 c0                	xor    %eax,%eax
+    12cb:	5b                   	pop    %rbx
+    12cc:	c3                   	ret
+    12cd:	0f 1f 00             	nopl   (%rax)
+
+00000000000012d0 <_start>:
+    12d0:	31 ed                	xor    %ebp,%ebp
+    12d2:	49 89 d1             	mov    %rdx,%r9
+    12d5:	5e                   	pop    %rsi
+    12d6:	48 89 e2             	mov    %rsp,%rdx
+    12d9:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+    12dd:	50                   	push   %rax
+    12de:	54                   	push   %rsp
+    12df:	45 31 c0             	xor    %r8d,%r8d
+    12e2:	31 c9                	xor    %ecx,%ecx
+    12e4:	48 8d 3d a5 fe ff ff 	lea    -0x15b(%rip),%rdi        # 1190 <main>
+    12eb:	ff 15 cf 4c 00 00    	call   *0x4ccf(%rip)        # 5fc0 <__libc_start_main@GLIBC_2.34>
+    12f1:	f4                   	hlt
+    12f2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    12f9:	00 00 00 
+    12fc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000001300 <deregister_tm_clones>:
+    1300:	    48 8d 3d 61 4d 00 00 	lea    0x4d61(%rip),%rdi        # 6068 <__TMC_END__>
+    1307:	    48 8d 05 5a 4d 00 00 	lea    0x4d5a(%rip),%rax        # 6068 <__TMC_END__>
+    130e:	    48 39 f8             	cmp    %rdi,%rax
+    1311:	/-- 74 15                	je     1328 <deregister_tm_clones+0x28>
+    1313:	|   48 8b 05 ae 4c 00 00 	mov    0x4cae(%rip),%rax        # 5fc8 <_ITM_deregisterTMCloneTable@Base>
+    131a:	|   48 85 c0             	test   %rax,%rax
+    131d:	+-- 74 09                	je     1328 <deregister_tm_clones+0x28>
+    131f:	|   ff e0                	jmp    *%rax
+    1321:	|   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    1328:	\-> c3                   	ret
+    1329:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001330 <register_tm_clones>:
+    1330:	    48 8d 3d 31 4d 00 00 	lea    0x4d31(%rip),%rdi        # 6068 <__TMC_END__>
+    1337:	    48 8d 35 2a 4d 00 00 	lea    0x4d2a(%rip),%rsi        # 6068 <__TMC_END__>
+    133e:	    48 29 fe             	sub    %rdi,%rsi
+    1341:	    48 89 f0             	mov    %rsi,%rax
+    1344:	    48 c1 ee 3f          	shr    $0x3f,%rsi
+    1348:	    48 c1 f8 03          	sar    $0x3,%rax
+    134c:	    48 01 c6             	add    %rax,%rsi
+    134f:	    48 d1 fe             	sar    %rsi
+    1352:	/-- 74 14                	je     1368 <register_tm_clones+0x38>
+    1354:	|   48 8b 05 7d 4c 00 00 	mov    0x4c7d(%rip),%rax        # 5fd8 <_ITM_registerTMCloneTable@Base>
+    135b:	|   48 85 c0             	test   %rax,%rax
+    135e:	+-- 74 08                	je     1368 <register_tm_clones+0x38>
+    1360:	|   ff e0                	jmp    *%rax
+    1362:	|   66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    1368:	\-> c3                   	ret
+    1369:	    0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001370 <__do_global_dtors_aux>:
+    1370:	       f3 0f 1e fa          	endbr64
+    1374:	       80 3d 0d 4d 00 00 00 	cmpb   $0x0,0x4d0d(%rip)        # 6088 <completed.0>
+    137b:	/----- 75 2b                	jne    13a8 <__do_global_dtors_aux+0x38>
+    137d:	|      55                   	push   %rbp
+    137e:	|      48 83 3d 5a 4c 00 00 	cmpq   $0x0,0x4c5a(%rip)        # 5fe0 <__cxa_finalize@GLIBC_2.2.5>
+    1385:	|      00 
+    1386:	|      48 89 e5             	mov    %rsp,%rbp
+    1389:	|  /-- 74 0c                	je     1397 <__do_global_dtors_aux+0x27>
+    138b:	|  |   48 8b 3d ce 4c 00 00 	mov    0x4cce(%rip),%rdi        # 6060 <__dso_handle>
+    1392:	|  |   e8 49 fd ff ff       	call   10e0 <__cxa_finalize@plt>
+    1397:	|  \-> e8 64 ff ff ff       	call   1300 <deregister_tm_clones>
+    139c:	|      c6 05 e5 4c 00 00 01 	movb   $0x1,0x4ce5(%rip)        # 6088 <completed.0>
+    13a3:	|      5d                   	pop    %rbp
+    13a4:	|      c3                   	ret
+    13a5:	|      0f 1f 00             	nopl   (%rax)
+    13a8:	\----> c3                   	ret
+    13a9:	       0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000013b0 <frame_dummy>:
+    13b0:	f3 0f 1e fa          	endbr64
+    13b4:	e9 77 ff ff ff       	jmp    1330 <register_tm_clones>
+    13b9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000013c0 <_close_r>:
+#include <nel/memory.hh> // move()
+    13c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13c5:	c3                   	ret
+    13c6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    13cd:	00 00 00 
+
+00000000000013d0 <_fstat_r>:
+
+    13d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13d5:	c3                   	ret
+    13d6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    13dd:	00 00 00 
+
+00000000000013e0 <_kill_r>:
+void ex1()
+    13e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13e5:	c3                   	ret
+    13e6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    13ed:	00 00 00 
+
+00000000000013f0 <_lseek_r>:
+
+    13f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13f5:	c3                   	ret
+    13f6:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    13fd:	00 00 00 
+
+0000000000001400 <_read_r>:
+    nel::log << vec1 << '\n';
+    1400:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1405:	c3                   	ret
+    1406:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    140d:	00 00 00 
+
+0000000000001410 <_write_r>:
+    Vec1 vec1 = Vec1::with_capacity(5);
+    1410:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1415:	c3                   	ret
+    1416:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    141d:	00 00 00 
+
+0000000000001420 <_getpid_r>:
+    vec1.push(nel::move(v)).is_ok();
+    1420:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1425:	c3                   	ret
+    1426:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    142d:	00 00 00 
+
+0000000000001430 <_isatty_r>:
+
+    1430:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1435:	c3                   	ret
+    1436:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    143d:	00 00 00 
+
+0000000000001440 <ex1()>:
+{
+    1440:	             41 57                	push   %r15
+            if (align == 0 || (align & (align - 1)) != 0) {
+                return Result<void *, AllocError>::Err(AllocError::BadAlign);
+            }
+            void *const new_p = is_over_aligned(align)
+                                    ? realloc_aligned(p, align, old_size, new_size)
+                                    : std::realloc(p, new_size);
+    1442:	             bf 10 05 00 00       	mov    $0x510,%edi
+    1447:	             41 56                	push   %r14
+    1449:	             41 55                	push   %r13
+    144b:	             41 54                	push   %r12
+    144d:	             55                   	push   %rbp
+    144e:	             53                   	push   %rbx
+    144f:	             48 83 ec 18          	sub    $0x18,%rsp
+    1453:	             e8 58 fc ff ff       	call   10b0 <malloc@plt>
+            if (new_p == nullptr) {
+    1458:	             48 85 c0             	test   %rax,%rax
+    145b:	/----------- 0f 84 18 02 00 00    	je     1679 <ex1()+0x239>
+                    // poison new memory,
+                    // assumes realloc adds to end
+                    elem::wipe(reinterpret_cast<uint8_t *>(new_n) + old_sz, new_sz - old_sz);
+                }
+            }
+            new_n->alloc_ = new_cap;
+    1461:	|            66 0f 6f 05 87 2c 00 	movdqa 0x2c87(%rip),%xmm0        # 40f0 <_IO_stdin_used+0xf0>
+    1468:	|            00 
+        // TODO: replace <<(Log ) with dbgfmt, so separate out from
+        // any other form of conversion to charstring.
+        // TODO: insert into formatter and not final dest type.
+        friend Log &operator<<(Log &outs, Vector const &v)
+        {
+            outs << "Vector(" << v.len() << "){";
+    1469:	|            4c 8d 2d 19 4c 00 00 	lea    0x4c19(%rip),%r13        # 6089 <nel::log>
+    1470:	|            49 89 c6             	mov    %rax,%r14
+    1473:	|            48 8d 35 8a 2b 00 00 	lea    0x2b8a(%rip),%rsi        # 4004 <_IO_stdin_used+0x4>
+    147a:	|            4c 89 ef             	mov    %r13,%rdi
+            return Slice(values_, len());
+        }
+
+        constexpr Slice<Type const> slice(void) const
+        {
+            return Slice(values_, len());
+    147d:	|            49 8d 5e 10          	lea    0x10(%r14),%rbx
+            new_n->alloc_ = new_cap;
+    1481:	|            0f 11 00             	movups %xmm0,(%rax)
+    1484:	|            e8 d7 27 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    1489:	|            49 8b 76 08          	mov    0x8(%r14),%rsi
+    148d:	|            48 89 c7             	mov    %rax,%rdi
+    1490:	|            e8 8b 28 00 00       	call   3d20 <nel::operator<<(nel::Log&, unsigned long)>
+    1495:	|            48 8d 35 70 2b 00 00 	lea    0x2b70(%rip),%rsi        # 400c <_IO_stdin_used+0xc>
+    149c:	|            48 89 c7             	mov    %rax,%rdi
+    149f:	|            e8 bc 27 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+#    if 1
+            outs << '\n';
+    14a4:	|            be 0a 00 00 00       	mov    $0xa,%esi
+    14a9:	|            4c 89 ef             	mov    %r13,%rdi
+    14ac:	|            e8 8f 27 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+        }
+
+    public:
+        constexpr SliceIterator(T arr[], Count len)
+            : b_(arr)
+            , e_(arr + len)
+    14b1:	|            49 8b 46 08          	mov    0x8(%r14),%rax
+#    endif
+
+    public:
+        friend Log &operator<<(Log &outs, ItT const &it)
+        {
+            outs << '[';
+    14b5:	|            be 5b 00 00 00       	mov    $0x5b,%esi
+    14ba:	|            4c 89 ef             	mov    %r13,%rdi
+            return Slice(values_, len());
+    14bd:	|            48 89 5c 24 08       	mov    %rbx,0x8(%rsp)
+    14c2:	|            48 c1 e0 08          	shl    $0x8,%rax
+    14c6:	|            4c 8d 3c 03          	lea    (%rbx,%rax,1),%r15
+    14ca:	|            4c 89 3c 24          	mov    %r15,(%rsp)
+    14ce:	|            e8 6d 27 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+                //++i;
+                // });
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+            }
+#    elif defined(C_LIKE)
+            if (!it2.is_done()) {
+    14d3:	|            4c 39 fb             	cmp    %r15,%rbx
+    14d6:	|  /-------- 0f 84 27 01 00 00    	je     1603 <ex1()+0x1c3>
+            nel::elem::set(data_, f, N);
+        }
+
+        friend nel::Log &operator<<(nel::Log &outs, U8Buf const &val)
+        {
+            outs << "U8Buf<" << val.len() << ">{";
+    14dc:	|  |         48 8d 35 2c 2b 00 00 	lea    0x2b2c(%rip),%rsi        # 400f <_IO_stdin_used+0xf>
+    14e3:	|  |         4c 89 ef             	mov    %r13,%rdi
+    14e6:	|  |         49 8d 5e 11          	lea    0x11(%r14),%rbx
+    14ea:	|  |         e8 71 27 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    14ef:	|  |         be 00 01 00 00       	mov    $0x100,%esi
+    14f4:	|  |         49 8d ae 10 01 00 00 	lea    0x110(%r14),%rbp
+    14fb:	|  |         48 89 c7             	mov    %rax,%rdi
+    14fe:	|  |         e8 1d 28 00 00       	call   3d20 <nel::operator<<(nel::Log&, unsigned long)>
+    1503:	|  |         48 8d 35 0c 2b 00 00 	lea    0x2b0c(%rip),%rsi        # 4016 <_IO_stdin_used+0x16>
+    150a:	|  |         48 89 c7             	mov    %rax,%rdi
+    150d:	|  |         e8 4e 27 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+            if (val.len() > 0) {
+                outs << val.data_[0];
+    1512:	|  |         41 0f b6 76 10       	movzbl 0x10(%r14),%esi
+    1517:	|  |         4c 89 ef             	mov    %r13,%rdi
+    151a:	|  |         e8 61 27 00 00       	call   3c80 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    151f:	|  |         90                   	nop
+                    outs << ' ' << val.data_[i];
+    1520:	|  |     /-> be 20 00 00 00       	mov    $0x20,%esi
+    1525:	|  |     |   4c 89 ef             	mov    %r13,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1528:	|  |     |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    152c:	|  |     |   e8 0f 27 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    1531:	|  |     |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1535:	|  |     |   48 89 c7             	mov    %rax,%rdi
+    1538:	|  |     |   e8 43 27 00 00       	call   3c80 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    153d:	|  |     |   48 39 dd             	cmp    %rbx,%rbp
+    1540:	|  |     \-- 75 de                	jne    1520 <ex1()+0xe0>
+                }
+            }
+            outs << '}';
+    1542:	|  |         be 7d 00 00 00       	mov    $0x7d,%esi
+    1547:	|  |         4c 89 ef             	mov    %r13,%rdi
+    154a:	|  |         e8 f1 26 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+            for (; !self().is_done(); self().inc()) {
+    154f:	|  |         48 39 2c 24          	cmp    %rbp,(%rsp)
+    1553:	|  +-------- 0f 84 aa 00 00 00    	je     1603 <ex1()+0x1c3>
+    1559:	|  |         4d 8d a6 10 02 00 00 	lea    0x210(%r14),%r12
+                //     ++i;
+                // });
+#        if defined(RUST_LIKE)
+                it2.for_each2([&outs](OutT const &e) { outs << ',' << e; });
+#        elif defined(C_LIKE)
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    1560:	|  |  /----> be 2c 00 00 00       	mov    $0x2c,%esi
+    1565:	|  |  |      4c 89 ef             	mov    %r13,%rdi
+    1568:	|  |  |      4d 89 e7             	mov    %r12,%r15
+    156b:	|  |  |      e8 d0 26 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+            outs << "U8Buf<" << val.len() << ">{";
+    1570:	|  |  |      48 8d 35 98 2a 00 00 	lea    0x2a98(%rip),%rsi        # 400f <_IO_stdin_used+0xf>
+    1577:	|  |  |      49 8d 9c 24 01 ff ff 	lea    -0xff(%r12),%rbx
+    157e:	|  |  |      ff 
+    157f:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1582:	|  |  |      48 89 c5             	mov    %rax,%rbp
+    1585:	|  |  |      e8 d6 26 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    158a:	|  |  |      be 00 01 00 00       	mov    $0x100,%esi
+    158f:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    1592:	|  |  |      e8 89 27 00 00       	call   3d20 <nel::operator<<(nel::Log&, unsigned long)>
+    1597:	|  |  |      48 8d 35 78 2a 00 00 	lea    0x2a78(%rip),%rsi        # 4016 <_IO_stdin_used+0x16>
+    159e:	|  |  |      48 89 c7             	mov    %rax,%rdi
+    15a1:	|  |  |      e8 ba 26 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    15a6:	|  |  |      48 89 ef             	mov    %rbp,%rdi
+    15a9:	|  |  |      41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    15b0:	|  |  |      ff ff 
+    15b2:	|  |  |      e8 c9 26 00 00       	call   3c80 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    15b7:	|  |  |      66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    15be:	|  |  |      00 00 
+                    outs << ' ' << val.data_[i];
+    15c0:	|  |  |  /-> be 20 00 00 00       	mov    $0x20,%esi
+    15c5:	|  |  |  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    15c8:	|  |  |  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    15cc:	|  |  |  |   e8 6f 26 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    15d1:	|  |  |  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    15d5:	|  |  |  |   48 89 c7             	mov    %rax,%rdi
+    15d8:	|  |  |  |   e8 a3 26 00 00       	call   3c80 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    15dd:	|  |  |  |   49 39 dc             	cmp    %rbx,%r12
+    15e0:	|  |  |  \-- 75 de                	jne    15c0 <ex1()+0x180>
+            outs << '}';
+    15e2:	|  |  |      be 7d 00 00 00       	mov    $0x7d,%esi
+    15e7:	|  |  |      48 89 ef             	mov    %rbp,%rdi
+            for (; !self().is_done(); self().inc()) {
+    15ea:	|  |  |      49 81 c4 00 01 00 00 	add    $0x100,%r12
+    15f1:	|  |  |      e8 4a 26 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    15f6:	|  |  |      48 8b 04 24          	mov    (%rsp),%rax
+    15fa:	|  |  |      49 39 c7             	cmp    %rax,%r15
+    15fd:	|  |  \----- 0f 85 5d ff ff ff    	jne    1560 <ex1()+0x120>
+#        endif
+            }
+#    endif
+            outs << ']';
+    1603:	|  \-------> be 5d 00 00 00       	mov    $0x5d,%esi
+    1608:	|            4c 89 ef             	mov    %r13,%rdi
+    160b:	|            e8 30 26 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+            if (v.item_ != nullptr) { outs << *v.item_; }
+#    else
+            if (v.item_ != nullptr) { outs << *v.item_; }
+#    endif
+            outs << '}';
+    1610:	|            be 7d 00 00 00       	mov    $0x7d,%esi
+    1615:	|            4c 89 ef             	mov    %r13,%rdi
+    1618:	|            e8 23 26 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    nel::log << vec1 << '\n';
+    161d:	|            be 0a 00 00 00       	mov    $0xa,%esi
+    1622:	|            4c 89 ef             	mov    %r13,%rdi
+    1625:	|            e8 16 26 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+            for (Index i = 0; i < len(); ++i) {
+    162a:	|            49 83 7e 08 00       	cmpq   $0x0,0x8(%r14)
+    162f:	|     /----- 74 32                	je     1663 <ex1()+0x223>
+    1631:	|     |      48 8b 5c 24 08       	mov    0x8(%rsp),%rbx
+    1636:	|     |      31 ed                	xor    %ebp,%ebp
+    1638:	|     |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    163f:	|     |      00 
+            nel::elem::set(data_, 0xa5, N);
+    1640:	|     |  /-> 48 89 df             	mov    %rbx,%rdi
+    1643:	|     |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1648:	|     |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    164d:	|     |  |   48 83 c5 01          	add    $0x1,%rbp
+    1651:	|     |  |   e8 7a 1d 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1656:	|     |  |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    165d:	|     |  |   49 3b 6e 08          	cmp    0x8(%r14),%rbp
+    1661:	|     |  \-- 72 dd                	jb     1640 <ex1()+0x200>
+}
+    1663:	|     \----> 48 83 c4 18          	add    $0x18,%rsp
+        {
+            NEL_UNUSED(size);
+            if (is_over_aligned(align)) {
+                free_aligned(p);
+            } else {
+                std::free(p);
+    1667:	|            4c 89 f7             	mov    %r14,%rdi
+    166a:	|            5b                   	pop    %rbx
+    166b:	|            5d                   	pop    %rbp
+    166c:	|            41 5c                	pop    %r12
+    166e:	|            41 5d                	pop    %r13
+    1670:	|            41 5e                	pop    %r14
+    1672:	|            41 5f                	pop    %r15
+    1674:	|            e9 b7 f9 ff ff       	jmp    1030 <free@plt>
+            outs << "Vector(" << v.len() << "){";
+    1679:	\----------> 48 8d 1d 09 4a 00 00 	lea    0x4a09(%rip),%rbx        # 6089 <nel::log>
+    1680:	             48 8d 35 7d 29 00 00 	lea    0x297d(%rip),%rsi        # 4004 <_IO_stdin_used+0x4>
+    1687:	             48 89 df             	mov    %rbx,%rdi
+    168a:	             e8 d1 25 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    168f:	             31 f6                	xor    %esi,%esi
+    1691:	             48 89 c7             	mov    %rax,%rdi
+    1694:	             e8 87 26 00 00       	call   3d20 <nel::operator<<(nel::Log&, unsigned long)>
+    1699:	             48 8d 35 6c 29 00 00 	lea    0x296c(%rip),%rsi        # 400c <_IO_stdin_used+0xc>
+    16a0:	             48 89 c7             	mov    %rax,%rdi
+    16a3:	             e8 b8 25 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+            outs << '\n';
+    16a8:	             48 89 df             	mov    %rbx,%rdi
+    16ab:	             be 0a 00 00 00       	mov    $0xa,%esi
+    16b0:	             e8 8b 25 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+            outs << '}';
+    16b5:	             48 89 df             	mov    %rbx,%rdi
+    16b8:	             be 7d 00 00 00       	mov    $0x7d,%esi
+    16bd:	             e8 7e 25 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    16c2:	             48 83 c4 18          	add    $0x18,%rsp
+    nel::log << vec1 << '\n';
+    16c6:	             48 89 df             	mov    %rbx,%rdi
+    16c9:	             be 0a 00 00 00       	mov    $0xa,%esi
+}
+    16ce:	             5b                   	pop    %rbx
+    16cf:	             5d                   	pop    %rbp
+    16d0:	             41 5c                	pop    %r12
+    16d2:	             41 5d                	pop    %r13
+    16d4:	             41 5e                	pop    %r14
+    16d6:	             41 5f                	pop    %r15
+    nel::log << vec1 << '\n';
+    16d8:	             e9 63 25 00 00       	jmp    3c40 <nel::operator<<(nel::Log&, char)>
+    16dd:	             0f 1f 00             	nopl   (%rax)
+
+00000000000016e0 <ex2()>:
+{
+    16e0:	                                     41 57                	push   %r15
+                                    : std::realloc(p, new_size);
+    16e2:	                                     bf 10 05 00 00       	mov    $0x510,%edi
+    16e7:	                                     41 56                	push   %r14
+    16e9:	                                     41 55                	push   %r13
+    16eb:	                                     41 54                	push   %r12
+    16ed:	                                     55                   	push   %rbp
+    16ee:	                                     53                   	push   %rbx
+    16ef:	                                     48 81 ec 58 02 00 00 	sub    $0x258,%rsp
+    16f6:	                                     e8 b5 f9 ff ff       	call   10b0 <malloc@plt>
+            if (new_p == nullptr) {
+    16fb:	                                     48 85 c0             	test   %rax,%rax
+    16fe:	   /-------------------------------- 0f 84 9c 04 00 00    	je     1ba0 <ex2()+0x4c0>
+            new_n->alloc_ = new_cap;
+    1704:	   |                                 66 0f 6f 05 e4 29 00 	movdqa 0x29e4(%rip),%xmm0        # 40f0 <_IO_stdin_used+0xf0>
+    170b:	   |                                 00 
+    170c:	   |                                 49 89 c6             	mov    %rax,%r14
+            nel::elem::set(data_, f, N);
+    170f:	   |                                 ba 00 01 00 00       	mov    $0x100,%edx
+    1714:	   |                                 be 66 00 00 00       	mov    $0x66,%esi
+    1719:	   |                                 0f 11 00             	movups %xmm0,(%rax)
+    171c:	   |                                 48 8d 44 24 40       	lea    0x40(%rsp),%rax
+    1721:	   |                                 48 89 c7             	mov    %rax,%rdi
+    1724:	   |                                 48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    1729:	   |                                 e8 a2 1c 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return len_;
+    172e:	   |                                 49 8b 5e 08          	mov    0x8(%r14),%rbx
+            return alloc_;
+    1732:	   |                                 49 8b 16             	mov    (%r14),%rdx
+            if (len() + n <= capacity()) { return true; }
+    1735:	   |                                 48 8d 43 01          	lea    0x1(%rbx),%rax
+    1739:	   |                                 48 39 c2             	cmp    %rax,%rdx
+    173c:	   |                    /----------- 0f 82 aa 02 00 00    	jb     19ec <ex2()+0x30c>
+
+        // rename to try-push_back?
+        template<typename... Args>
+        Result<void, T> push_back(Args &&...args)
+        {
+            if (len() >= capacity()) {
+    1742:	   |              /-----|----------> 48 39 d3             	cmp    %rdx,%rbx
+    1745:	/--|--------------|-----|----------- 0f 82 30 05 00 00    	jb     1c7b <ex2()+0x59b>
+            nel::elem::copy(data_, o.data_, N);
+    174b:	|  |  /-----------|-----|----------> 48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1750:	|  |  |           |     |            ba 00 01 00 00       	mov    $0x100,%edx
+    1755:	|  |  |           |     |            48 8d 9c 24 44 01 00 	lea    0x144(%rsp),%rbx
+    175c:	|  |  |           |     |            00 
+        {
+        }
+
+        template<typename... Args>
+        constexpr Result(Phantom<Tag::ERR> const, Args &&...args)
+            : tag_(Tag::ERR)
+    175d:	|  |  |           |     |            c7 84 24 40 01 00 00 	movl   $0x2,0x140(%rsp)
+    1764:	|  |  |           |     |            02 00 00 00 
+    1768:	|  |  |           |     |            48 89 df             	mov    %rbx,%rdi
+    176b:	|  |  |           |     |            e8 50 1c 00 00       	call   33c0 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+
+    public:
+        constexpr Context(char const *fn_name = __builtin_FUNCTION(),
+                          char const *file_name = __builtin_FILE(),
+                          int line_num = __builtin_LINE())
+            : fn_name_(fn_name)
+    1770:	|  |  |           |     |            48 8d 15 31 29 00 00 	lea    0x2931(%rip),%rdx        # 40a8 <_IO_stdin_used+0xa8>
+    1777:	|  |  |           |     |            48 8d 0d 9b 28 00 00 	lea    0x289b(%rip),%rcx        # 4019 <_IO_stdin_used+0x19>
+    177e:	|  |  |           |     |            8b 84 24 40 01 00 00 	mov    0x140(%rsp),%eax
+    1785:	|  |  |           |     |            66 48 0f 6e c1       	movq   %rcx,%xmm0
+    178a:	|  |  |           |     |            66 48 0f 6e ca       	movq   %rdx,%xmm1
+            , file_name_(file_name)
+            , line_num_(line_num)
+    178f:	|  |  |           |     |            c7 44 24 30 18 00 00 	movl   $0x18,0x30(%rsp)
+    1796:	|  |  |           |     |            00 
+            : fn_name_(fn_name)
+    1797:	|  |  |           |     |            66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    179b:	|  |  |           |     |            0f 29 44 24 20       	movaps %xmm0,0x20(%rsp)
+        // match(Tag tag, std::function<V(void)> on_ok, std::function<V(void)> on_err) const
+        //
+        template<typename V, typename Fn1, typename Fn2>
+        constexpr V match(Fn1 &&on_ok, Fn2 &&on_err, Context const &ctx = Context()) const
+        {
+            switch (tag_) { // result<void>-match
+    17a0:	|  |  |           |     |            83 f8 01             	cmp    $0x1,%eax
+    17a3:	|  |  |           |     |        /-- 74 1b                	je     17c0 <ex2()+0xe0>
+    17a5:	|  |  |           |     |        |   83 f8 02             	cmp    $0x2,%eax
+    17a8:	|  |  |        /--|-----|--------|-- 0f 85 d2 03 00 00    	jne    1b80 <ex2()+0x4a0>
+            nel::elem::set(data_, 0xa5, N);
+    17ae:	|  |  |        |  |     |        |   ba 00 01 00 00       	mov    $0x100,%edx
+    17b3:	|  |  |        |  |     |        |   be a5 00 00 00       	mov    $0xa5,%esi
+    17b8:	|  |  |        |  |     |        |   48 89 df             	mov    %rbx,%rdi
+    17bb:	|  |  |        |  |     |        |   e8 10 1c 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            outs << "Vector(" << v.len() << "){";
+    17c0:	|  |  |        |  |     |        \-> 4c 8d 2d c2 48 00 00 	lea    0x48c2(%rip),%r13        # 6089 <nel::log>
+    17c7:	|  |  |        |  |     |            48 8d 35 36 28 00 00 	lea    0x2836(%rip),%rsi        # 4004 <_IO_stdin_used+0x4>
+    17ce:	|  |  |        |  |     |            4c 89 ef             	mov    %r13,%rdi
+    17d1:	|  |  |        |  |     |            e8 8a 24 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    17d6:	|  |  |        |  |     |            48 89 c7             	mov    %rax,%rdi
+            return (item_ == nullptr) ? 0 : item_->len();
+    17d9:	|  |  |        |  |     |            4d 85 f6             	test   %r14,%r14
+    17dc:	|  |  |  /-----|--|-----|----------- 0f 84 36 04 00 00    	je     1c18 <ex2()+0x538>
+            outs << "Vector(" << v.len() << "){";
+    17e2:	|  |  |  |  /--|--|-----|----------> 49 8b 76 08          	mov    0x8(%r14),%rsi
+            return Slice(values_, len());
+    17e6:	|  |  |  |  |  |  |     |            49 8d 5e 10          	lea    0x10(%r14),%rbx
+    17ea:	|  |  |  |  |  |  |     |            e8 31 25 00 00       	call   3d20 <nel::operator<<(nel::Log&, unsigned long)>
+    17ef:	|  |  |  |  |  |  |     |            48 8d 35 16 28 00 00 	lea    0x2816(%rip),%rsi        # 400c <_IO_stdin_used+0xc>
+    17f6:	|  |  |  |  |  |  |     |            48 89 c7             	mov    %rax,%rdi
+    17f9:	|  |  |  |  |  |  |     |            e8 62 24 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+            outs << '\n';
+    17fe:	|  |  |  |  |  |  |     |            be 0a 00 00 00       	mov    $0xa,%esi
+    1803:	|  |  |  |  |  |  |     |            4c 89 ef             	mov    %r13,%rdi
+    1806:	|  |  |  |  |  |  |     |            e8 35 24 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    180b:	|  |  |  |  |  |  |     |            49 8b 46 08          	mov    0x8(%r14),%rax
+            outs << '[';
+    180f:	|  |  |  |  |  |  |     |            be 5b 00 00 00       	mov    $0x5b,%esi
+    1814:	|  |  |  |  |  |  |     |            4c 89 ef             	mov    %r13,%rdi
+    1817:	|  |  |  |  |  |  |     |            48 89 5c 24 18       	mov    %rbx,0x18(%rsp)
+    181c:	|  |  |  |  |  |  |     |            48 c1 e0 08          	shl    $0x8,%rax
+    1820:	|  |  |  |  |  |  |     |            4c 8d 3c 03          	lea    (%rbx,%rax,1),%r15
+    1824:	|  |  |  |  |  |  |     |            4c 89 7c 24 08       	mov    %r15,0x8(%rsp)
+    1829:	|  |  |  |  |  |  |     |            e8 12 24 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+            if (!it2.is_done()) {
+    182e:	|  |  |  |  |  |  |     |            4c 39 fb             	cmp    %r15,%rbx
+    1831:	|  |  |  |  |  |  |     |  /-------- 0f 84 2a 01 00 00    	je     1961 <ex2()+0x281>
+            outs << "U8Buf<" << val.len() << ">{";
+    1837:	|  |  |  |  |  |  |     |  |         48 8d 35 d1 27 00 00 	lea    0x27d1(%rip),%rsi        # 400f <_IO_stdin_used+0xf>
+    183e:	|  |  |  |  |  |  |     |  |         4c 89 ef             	mov    %r13,%rdi
+    1841:	|  |  |  |  |  |  |     |  |         49 8d 6e 11          	lea    0x11(%r14),%rbp
+    1845:	|  |  |  |  |  |  |     |  |         e8 16 24 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    184a:	|  |  |  |  |  |  |     |  |         be 00 01 00 00       	mov    $0x100,%esi
+    184f:	|  |  |  |  |  |  |     |  |         49 8d 9e 10 01 00 00 	lea    0x110(%r14),%rbx
+    1856:	|  |  |  |  |  |  |     |  |         48 89 c7             	mov    %rax,%rdi
+    1859:	|  |  |  |  |  |  |     |  |         e8 c2 24 00 00       	call   3d20 <nel::operator<<(nel::Log&, unsigned long)>
+    185e:	|  |  |  |  |  |  |     |  |         48 8d 35 b1 27 00 00 	lea    0x27b1(%rip),%rsi        # 4016 <_IO_stdin_used+0x16>
+    1865:	|  |  |  |  |  |  |     |  |         48 89 c7             	mov    %rax,%rdi
+    1868:	|  |  |  |  |  |  |     |  |         e8 f3 23 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    186d:	|  |  |  |  |  |  |     |  |         41 0f b6 76 10       	movzbl 0x10(%r14),%esi
+    1872:	|  |  |  |  |  |  |     |  |         4c 89 ef             	mov    %r13,%rdi
+    1875:	|  |  |  |  |  |  |     |  |         e8 06 24 00 00       	call   3c80 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    187a:	|  |  |  |  |  |  |     |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+                    outs << ' ' << val.data_[i];
+    1880:	|  |  |  |  |  |  |     |  |     /-> be 20 00 00 00       	mov    $0x20,%esi
+    1885:	|  |  |  |  |  |  |     |  |     |   4c 89 ef             	mov    %r13,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1888:	|  |  |  |  |  |  |     |  |     |   48 83 c5 01          	add    $0x1,%rbp
+                    outs << ' ' << val.data_[i];
+    188c:	|  |  |  |  |  |  |     |  |     |   e8 af 23 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    1891:	|  |  |  |  |  |  |     |  |     |   0f b6 75 ff          	movzbl -0x1(%rbp),%esi
+    1895:	|  |  |  |  |  |  |     |  |     |   48 89 c7             	mov    %rax,%rdi
+    1898:	|  |  |  |  |  |  |     |  |     |   e8 e3 23 00 00       	call   3c80 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    189d:	|  |  |  |  |  |  |     |  |     |   48 39 eb             	cmp    %rbp,%rbx
+    18a0:	|  |  |  |  |  |  |     |  |     \-- 75 de                	jne    1880 <ex2()+0x1a0>
+            outs << '}';
+    18a2:	|  |  |  |  |  |  |     |  |         be 7d 00 00 00       	mov    $0x7d,%esi
+    18a7:	|  |  |  |  |  |  |     |  |         4c 89 ef             	mov    %r13,%rdi
+    18aa:	|  |  |  |  |  |  |     |  |         4d 8d a6 10 02 00 00 	lea    0x210(%r14),%r12
+    18b1:	|  |  |  |  |  |  |     |  |         e8 8a 23 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+            for (; !self().is_done(); self().inc()) {
+    18b6:	|  |  |  |  |  |  |     |  |         48 39 5c 24 08       	cmp    %rbx,0x8(%rsp)
+    18bb:	|  |  |  |  |  |  |     |  +-------- 0f 84 a0 00 00 00    	je     1961 <ex2()+0x281>
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    18c1:	|  |  |  |  |  |  |     |  |  /----> be 2c 00 00 00       	mov    $0x2c,%esi
+    18c6:	|  |  |  |  |  |  |     |  |  |      4c 89 ef             	mov    %r13,%rdi
+    18c9:	|  |  |  |  |  |  |     |  |  |      4d 89 e7             	mov    %r12,%r15
+    18cc:	|  |  |  |  |  |  |     |  |  |      e8 6f 23 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+            outs << "U8Buf<" << val.len() << ">{";
+    18d1:	|  |  |  |  |  |  |     |  |  |      48 8d 35 37 27 00 00 	lea    0x2737(%rip),%rsi        # 400f <_IO_stdin_used+0xf>
+    18d8:	|  |  |  |  |  |  |     |  |  |      49 8d 9c 24 01 ff ff 	lea    -0xff(%r12),%rbx
+    18df:	|  |  |  |  |  |  |     |  |  |      ff 
+    18e0:	|  |  |  |  |  |  |     |  |  |      48 89 c7             	mov    %rax,%rdi
+    18e3:	|  |  |  |  |  |  |     |  |  |      48 89 c5             	mov    %rax,%rbp
+    18e6:	|  |  |  |  |  |  |     |  |  |      e8 75 23 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    18eb:	|  |  |  |  |  |  |     |  |  |      be 00 01 00 00       	mov    $0x100,%esi
+    18f0:	|  |  |  |  |  |  |     |  |  |      48 89 c7             	mov    %rax,%rdi
+    18f3:	|  |  |  |  |  |  |     |  |  |      e8 28 24 00 00       	call   3d20 <nel::operator<<(nel::Log&, unsigned long)>
+    18f8:	|  |  |  |  |  |  |     |  |  |      48 8d 35 17 27 00 00 	lea    0x2717(%rip),%rsi        # 4016 <_IO_stdin_used+0x16>
+    18ff:	|  |  |  |  |  |  |     |  |  |      48 89 c7             	mov    %rax,%rdi
+    1902:	|  |  |  |  |  |  |     |  |  |      e8 59 23 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    1907:	|  |  |  |  |  |  |     |  |  |      48 89 ef             	mov    %rbp,%rdi
+    190a:	|  |  |  |  |  |  |     |  |  |      41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    1911:	|  |  |  |  |  |  |     |  |  |      ff ff 
+    1913:	|  |  |  |  |  |  |     |  |  |      e8 68 23 00 00       	call   3c80 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1918:	|  |  |  |  |  |  |     |  |  |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    191f:	|  |  |  |  |  |  |     |  |  |      00 
+                    outs << ' ' << val.data_[i];
+    1920:	|  |  |  |  |  |  |     |  |  |  /-> be 20 00 00 00       	mov    $0x20,%esi
+    1925:	|  |  |  |  |  |  |     |  |  |  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1928:	|  |  |  |  |  |  |     |  |  |  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    192c:	|  |  |  |  |  |  |     |  |  |  |   e8 0f 23 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    1931:	|  |  |  |  |  |  |     |  |  |  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1935:	|  |  |  |  |  |  |     |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1938:	|  |  |  |  |  |  |     |  |  |  |   e8 43 23 00 00       	call   3c80 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    193d:	|  |  |  |  |  |  |     |  |  |  |   49 39 dc             	cmp    %rbx,%r12
+    1940:	|  |  |  |  |  |  |     |  |  |  \-- 75 de                	jne    1920 <ex2()+0x240>
+            outs << '}';
+    1942:	|  |  |  |  |  |  |     |  |  |      be 7d 00 00 00       	mov    $0x7d,%esi
+    1947:	|  |  |  |  |  |  |     |  |  |      48 89 ef             	mov    %rbp,%rdi
+            for (; !self().is_done(); self().inc()) {
+    194a:	|  |  |  |  |  |  |     |  |  |      49 81 c4 00 01 00 00 	add    $0x100,%r12
+    1951:	|  |  |  |  |  |  |     |  |  |      e8 ea 22 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    1956:	|  |  |  |  |  |  |     |  |  |      4c 39 7c 24 08       	cmp    %r15,0x8(%rsp)
+    195b:	|  |  |  |  |  |  |     |  |  \----- 0f 85 60 ff ff ff    	jne    18c1 <ex2()+0x1e1>
+            outs << ']';
+    1961:	|  |  |  |  |  |  |     |  \-------> be 5d 00 00 00       	mov    $0x5d,%esi
+    1966:	|  |  |  |  |  |  |     |            4c 89 ef             	mov    %r13,%rdi
+            for (Index i = 0; i < len(); ++i) {
+    1969:	|  |  |  |  |  |  |     |            31 ed                	xor    %ebp,%ebp
+    196b:	|  |  |  |  |  |  |     |            e8 d0 22 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+            outs << '}';
+    1970:	|  |  |  |  |  |  |     |            be 7d 00 00 00       	mov    $0x7d,%esi
+    1975:	|  |  |  |  |  |  |     |            4c 89 ef             	mov    %r13,%rdi
+    1978:	|  |  |  |  |  |  |     |            e8 c3 22 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    nel::log << vec1 << '\n';
+    197d:	|  |  |  |  |  |  |     |            be 0a 00 00 00       	mov    $0xa,%esi
+    1982:	|  |  |  |  |  |  |     |            4c 89 ef             	mov    %r13,%rdi
+    1985:	|  |  |  |  |  |  |     |            e8 b6 22 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+            nel::elem::set(data_, 0xa5, N);
+    198a:	|  |  |  |  |  |  |     |            48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    198f:	|  |  |  |  |  |  |     |            ba 00 01 00 00       	mov    $0x100,%edx
+    1994:	|  |  |  |  |  |  |     |            be a5 00 00 00       	mov    $0xa5,%esi
+    1999:	|  |  |  |  |  |  |     |            e8 32 1a 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    199e:	|  |  |  |  |  |  |     |            49 83 7e 08 00       	cmpq   $0x0,0x8(%r14)
+    19a3:	|  |  |  |  |  |  |     |            48 8b 5c 24 18       	mov    0x18(%rsp),%rbx
+    19a8:	|  |  |  |  |  |  |     |     /----- 74 29                	je     19d3 <ex2()+0x2f3>
+    19aa:	|  |  |  |  |  |  |     |     |      66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    19b0:	|  |  |  |  |  |  |     |     |  /-> 48 89 df             	mov    %rbx,%rdi
+    19b3:	|  |  |  |  |  |  |     |     |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    19b8:	|  |  |  |  |  |  |     |     |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    19bd:	|  |  |  |  |  |  |     |     |  |   48 83 c5 01          	add    $0x1,%rbp
+    19c1:	|  |  |  |  |  |  |     |     |  |   e8 0a 1a 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    19c6:	|  |  |  |  |  |  |     |     |  |   48 81 c3 00 01 00 00 	add    $0x100,%rbx
+    19cd:	|  |  |  |  |  |  |     |     |  |   49 3b 6e 08          	cmp    0x8(%r14),%rbp
+    19d1:	|  |  |  |  |  |  |     |     |  \-- 72 dd                	jb     19b0 <ex2()+0x2d0>
+}
+    19d3:	|  |  |  |  |  |  |     |     \----> 48 81 c4 58 02 00 00 	add    $0x258,%rsp
+                std::free(p);
+    19da:	|  |  |  |  |  |  |     |            4c 89 f7             	mov    %r14,%rdi
+    19dd:	|  |  |  |  |  |  |     |            5b                   	pop    %rbx
+    19de:	|  |  |  |  |  |  |     |            5d                   	pop    %rbp
+    19df:	|  |  |  |  |  |  |     |            41 5c                	pop    %r12
+    19e1:	|  |  |  |  |  |  |     |            41 5d                	pop    %r13
+    19e3:	|  |  |  |  |  |  |     |            41 5e                	pop    %r14
+    19e5:	|  |  |  |  |  |  |     |            41 5f                	pop    %r15
+    19e7:	|  |  |  |  |  |  |     |            e9 44 f6 ff ff       	jmp    1030 <free@plt>
+        static constexpr Count min_capacity = 4;
+
+        static constexpr Count capacity_for(Count const cur, Count const cap)
+        {
+            if (cap <= cur) { return cap; }
+            Count const g = (cur < min_capacity) ? min_capacity : cur + cur * (NUM - DEN) / DEN;
+    19ec:	|  |  |  |  |  |  |     \----------> 48 83 fa 03          	cmp    $0x3,%rdx
+    19f0:	|  |  |  |  |  |  |        /-------- 0f 87 c5 00 00 00    	ja     1abb <ex2()+0x3db>
+    19f6:	|  |  |  |  |  |  |        |         ba 04 00 00 00       	mov    $0x4,%edx
+    19fb:	|  |  |  |  |  |  |        |         48 39 d0             	cmp    %rdx,%rax
+    19fe:	|  |  |  |  |  |  |        |         48 0f 42 c2          	cmovb  %rdx,%rax
+    1a02:	|  |  |  |  |  |  |        |         48 39 d8             	cmp    %rbx,%rax
+    1a05:	|  |  |  |  |  |  |        |         48 0f 42 c3          	cmovb  %rbx,%rax
+    1a09:	|  |  |  |  |  |  |        |         48 89 c5             	mov    %rax,%rbp
+            if (new_cap > max_capacity) { return nullptr; }
+    1a0c:	|  |  |  |  |  |  |        |  /----> 48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    1a13:	|  |  |  |  |  |  |        |  |      ff 7f 00 
+    1a16:	|  |  |  |  |  |  |        |  |      48 39 e8             	cmp    %rbp,%rax
+    1a19:	|  |  +--|--|--|--|--------|--|----- 0f 82 2c fd ff ff    	jb     174b <ex2()+0x6b>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1a1f:	|  |  |  |  |  |  |        |  |      48 89 ef             	mov    %rbp,%rdi
+    1a22:	|  |  |  |  |  |  |        |  |      48 c1 e7 08          	shl    $0x8,%rdi
+    1a26:	|  |  |  |  |  |  |        |  |      48 83 c7 10          	add    $0x10,%rdi
+                                    : std::realloc(p, new_size);
+    1a2a:	|  |  |  |  |  |  |        |  |      e8 81 f6 ff ff       	call   10b0 <malloc@plt>
+    1a2f:	|  |  |  |  |  |  |        |  |      49 89 c4             	mov    %rax,%r12
+            if (new_p == nullptr) {
+    1a32:	|  |  |  |  |  |  |        |  |      48 85 c0             	test   %rax,%rax
+    1a35:	|  |  +--|--|--|--|--------|--|----- 0f 84 10 fd ff ff    	je     174b <ex2()+0x6b>
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    1a3b:	|  |  |  |  |  |  |        |  |      4d 8d 6e 10          	lea    0x10(%r14),%r13
+    1a3f:	|  |  |  |  |  |  |        |  |      4c 8d 78 10          	lea    0x10(%rax),%r15
+                    new_n->len_ = old_n->len_;
+    1a43:	|  |  |  |  |  |  |        |  |      48 89 58 08          	mov    %rbx,0x8(%rax)
+void relocate(uint8_t *const d, uint8_t *const s, Length const n);
+
+template<typename T>
+void relocate(T d[], T s[], Length const n)
+{
+    if (d == s) { return; }
+    1a47:	|  |  |  |  |  |  |        |  |      4d 39 fd             	cmp    %r15,%r13
+    1a4a:	|  |  |  |  |  |  |  /-----|--|----- 74 53                	je     1a9f <ex2()+0x3bf>
+    if constexpr (is_trivially_relocatable<T>) {
+        relocate(reinterpret_cast<uint8_t *>(d), reinterpret_cast<uint8_t *>(s), n * sizeof(T));
+    } else if (d < s) {
+    1a4c:	|  |  |  |  |  |  |  |     |  |      4d 39 ef             	cmp    %r13,%r15
+    1a4f:	|  |  |  |  |  |  |  |  /--|--|----- 0f 83 36 02 00 00    	jae    1c8b <ex2()+0x5ab>
+        // forwards, so overlap is not overwritten before it is read.
+        for (Index i = 0; i < n; ++i) {
+    1a55:	|  |  |  |  |  |  |  |  |  |  |      48 85 db             	test   %rbx,%rbx
+    1a58:	|  |  |  |  |  |  |  +--|--|--|----- 74 45                	je     1a9f <ex2()+0x3bf>
+    1a5a:	|  |  |  |  |  |  |  |  |  |  |      31 c0                	xor    %eax,%eax
+            nel::elem::move(data_, o.data_, N);
+    1a5c:	|  |  |  |  |  |  |  |  |  |  |  /-> 4c 89 ee             	mov    %r13,%rsi
+    1a5f:	|  |  |  |  |  |  |  |  |  |  |  |   4c 89 ff             	mov    %r15,%rdi
+    1a62:	|  |  |  |  |  |  |  |  |  |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1a67:	|  |  |  |  |  |  |  |  |  |  |  |   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1a6c:	|  |  |  |  |  |  |  |  |  |  |  |   e8 6f 19 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1a71:	|  |  |  |  |  |  |  |  |  |  |  |   4c 89 ef             	mov    %r13,%rdi
+    1a74:	|  |  |  |  |  |  |  |  |  |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1a79:	|  |  |  |  |  |  |  |  |  |  |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    1a7e:	|  |  |  |  |  |  |  |  |  |  |  |   e8 4d 19 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1a83:	|  |  |  |  |  |  |  |  |  |  |  |   48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    1a88:	|  |  |  |  |  |  |  |  |  |  |  |   49 81 c5 00 01 00 00 	add    $0x100,%r13
+    1a8f:	|  |  |  |  |  |  |  |  |  |  |  |   49 81 c7 00 01 00 00 	add    $0x100,%r15
+    1a96:	|  |  |  |  |  |  |  |  |  |  |  |   48 83 c0 01          	add    $0x1,%rax
+    1a9a:	|  |  |  |  |  |  |  |  |  |  |  |   48 39 c3             	cmp    %rax,%rbx
+    1a9d:	|  |  |  |  |  |  |  |  |  |  |  \-- 75 bd                	jne    1a5c <ex2()+0x37c>
+                std::free(p);
+    1a9f:	|  |  |  |  |  |  |  >--|--|--|----> 4c 89 f7             	mov    %r14,%rdi
+                item_ = p;
+    1aa2:	|  |  |  |  |  |  |  |  |  |  |      4d 89 e6             	mov    %r12,%r14
+    1aa5:	|  |  |  |  |  |  |  |  |  |  |      e8 86 f5 ff ff       	call   1030 <free@plt>
+            new_n->alloc_ = new_cap;
+    1aaa:	|  |  |  |  |  |  |  |  |  |  |      49 89 2c 24          	mov    %rbp,(%r12)
+            return len_;
+    1aae:	|  |  |  |  |  |  |  |  |  |  |      49 8b 5c 24 08       	mov    0x8(%r12),%rbx
+    1ab3:	|  |  |  |  |  |  |  |  |  |  |  /-> 48 89 ea             	mov    %rbp,%rdx
+    1ab6:	|  |  |  |  |  |  \--|--|--|--|--|-- e9 87 fc ff ff       	jmp    1742 <ex2()+0x62>
+    1abb:	|  |  |  |  |  |     |  |  \--|--|-> 48 8d 2c 12          	lea    (%rdx,%rdx,1),%rbp
+    1abf:	|  |  |  |  |  |     |  |     |  |   48 39 c5             	cmp    %rax,%rbp
+    1ac2:	|  |  |  |  |  |     |  |     |  |   48 0f 42 e8          	cmovb  %rax,%rbp
+    1ac6:	|  |  |  |  |  |     |  |     |  |   48 39 dd             	cmp    %rbx,%rbp
+    1ac9:	|  |  |  |  |  |     |  |     |  |   48 0f 42 eb          	cmovb  %rbx,%rbp
+            } else if (new_cap == item_->capacity()) {
+    1acd:	|  |  |  |  |  |     |  |     |  |   48 39 ea             	cmp    %rbp,%rdx
+    1ad0:	|  |  |  |  |  |     |  |     |  \-- 74 e1                	je     1ab3 <ex2()+0x3d3>
+            } else if (new_cap > item_->capacity()) {
+    1ad2:	|  |  |  |  |  |     |  |     \----- 0f 82 34 ff ff ff    	jb     1a0c <ex2()+0x32c>
+            if (new_cap > max_capacity) { return nullptr; }
+    1ad8:	|  |  |  |  |  |     |  |            48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    1adf:	|  |  |  |  |  |     |  |            ff 7f 00 
+    1ae2:	|  |  |  |  |  |     |  |            48 39 e8             	cmp    %rbp,%rax
+    1ae5:	|  |  +--|--|--|-----|--|----------- 0f 82 60 fc ff ff    	jb     174b <ex2()+0x6b>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    1aeb:	|  |  |  |  |  |     |  |            48 89 ef             	mov    %rbp,%rdi
+    1aee:	|  |  |  |  |  |     |  |            48 c1 e7 08          	shl    $0x8,%rdi
+    1af2:	|  |  |  |  |  |     |  |            48 83 c7 10          	add    $0x10,%rdi
+                                    : std::realloc(p, new_size);
+    1af6:	|  |  |  |  |  |     |  |            e8 b5 f5 ff ff       	call   10b0 <malloc@plt>
+    1afb:	|  |  |  |  |  |     |  |            49 89 c4             	mov    %rax,%r12
+            if (new_p == nullptr) {
+    1afe:	|  |  |  |  |  |     |  |            48 85 c0             	test   %rax,%rax
+    1b01:	|  |  +--|--|--|-----|--|----------- 0f 84 44 fc ff ff    	je     174b <ex2()+0x6b>
+                    new_n->len_ = old_n->len_;
+    1b07:	|  |  |  |  |  |     |  |            48 89 58 08          	mov    %rbx,0x8(%rax)
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    1b0b:	|  |  |  |  |  |     |  |            4d 8d 6c 24 10       	lea    0x10(%r12),%r13
+    1b10:	|  |  |  |  |  |     |  |            49 8d 46 10          	lea    0x10(%r14),%rax
+    1b14:	|  |  |  |  |  |     |  |            48 89 44 24 18       	mov    %rax,0x18(%rsp)
+    if (d == s) { return; }
+    1b19:	|  |  |  |  |  |     |  |            4c 39 e8             	cmp    %r13,%rax
+    1b1c:	|  |  |  |  |  |     +--|----------- 74 81                	je     1a9f <ex2()+0x3bf>
+    } else if (d < s) {
+    1b1e:	|  |  |  |  |  |     |  |            49 39 c5             	cmp    %rax,%r13
+    1b21:	|  |  |  |  |  |     |  |  /-------- 0f 83 bd 01 00 00    	jae    1ce4 <ex2()+0x604>
+        for (Index i = 0; i < n; ++i) {
+    1b27:	|  |  |  |  |  |     |  |  |         48 85 db             	test   %rbx,%rbx
+    1b2a:	|  |  |  |  |  |     +--|--|-------- 0f 84 6f ff ff ff    	je     1a9f <ex2()+0x3bf>
+    1b30:	|  |  |  |  |  |     |  |  |         49 89 c7             	mov    %rax,%r15
+    1b33:	|  |  |  |  |  |     |  |  |         31 c0                	xor    %eax,%eax
+            nel::elem::move(data_, o.data_, N);
+    1b35:	|  |  |  |  |  |     |  |  |     /-> 4c 89 fe             	mov    %r15,%rsi
+    1b38:	|  |  |  |  |  |     |  |  |     |   4c 89 ef             	mov    %r13,%rdi
+    1b3b:	|  |  |  |  |  |     |  |  |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    1b40:	|  |  |  |  |  |     |  |  |     |   48 89 44 24 08       	mov    %rax,0x8(%rsp)
+    1b45:	|  |  |  |  |  |     |  |  |     |   e8 96 18 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1b4a:	|  |  |  |  |  |     |  |  |     |   4c 89 ff             	mov    %r15,%rdi
+    1b4d:	|  |  |  |  |  |     |  |  |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    1b52:	|  |  |  |  |  |     |  |  |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    1b57:	|  |  |  |  |  |     |  |  |     |   e8 74 18 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1b5c:	|  |  |  |  |  |     |  |  |     |   48 8b 44 24 08       	mov    0x8(%rsp),%rax
+    1b61:	|  |  |  |  |  |     |  |  |     |   49 81 c7 00 01 00 00 	add    $0x100,%r15
+    1b68:	|  |  |  |  |  |     |  |  |     |   49 81 c5 00 01 00 00 	add    $0x100,%r13
+    1b6f:	|  |  |  |  |  |     |  |  |     |   48 83 c0 01          	add    $0x1,%rax
+    1b73:	|  |  |  |  |  |     |  |  |     |   48 39 c3             	cmp    %rax,%rbx
+    1b76:	|  |  |  |  |  |     |  |  |     \-- 75 bd                	jne    1b35 <ex2()+0x455>
+    1b78:	|  |  |  |  |  |     +--|--|-------- e9 22 ff ff ff       	jmp    1a9f <ex2()+0x3bf>
+    1b7d:	|  |  |  |  |  |     |  |  |         0f 1f 00             	nopl   (%rax)
+                    // if they do it's a use-after-move-from op so must panic.
+                    // or a use-before-initialised so again must panic.
+                    nel::panic("invalid Result", ctx);
+                    break;
+                default:
+                    nel::panic("bad Result", ctx);
+    1b80:	|  |  |  |  |  \-----|--|--|-------> 48 8d 74 24 20       	lea    0x20(%rsp),%rsi
+            switch (tag_) { // result<void>-match
+    1b85:	|  |  |  |  |        |  |  |         85 c0                	test   %eax,%eax
+    1b87:	|  |  |  |  |        |  |  |  /----- 0f 84 b0 01 00 00    	je     1d3d <ex2()+0x65d>
+                    nel::panic("bad Result", ctx);
+    1b8d:	|  |  |  |  |        |  |  |  |      48 8d 3d 98 24 00 00 	lea    0x2498(%rip),%rdi        # 402c <_IO_stdin_used+0x2c>
+    1b94:	|  |  |  |  |        |  |  |  |      e8 89 f5 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1b99:	|  |  |  |  |        |  |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+            nel::elem::set(data_, f, N);
+    1ba0:	|  \--|--|--|--------|--|--|--|----> 48 8d 44 24 40       	lea    0x40(%rsp),%rax
+    1ba5:	|     |  |  |        |  |  |  |      ba 00 01 00 00       	mov    $0x100,%edx
+    1baa:	|     |  |  |        |  |  |  |      be 66 00 00 00       	mov    $0x66,%esi
+    1baf:	|     |  |  |        |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1bb2:	|     |  |  |        |  |  |  |      48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    1bb7:	|     |  |  |        |  |  |  |      e8 14 18 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+                                    : std::realloc(p, new_size);
+    1bbc:	|     |  |  |        |  |  |  |      bf 10 04 00 00       	mov    $0x410,%edi
+    1bc1:	|     |  |  |        |  |  |  |      e8 ea f4 ff ff       	call   10b0 <malloc@plt>
+    1bc6:	|     |  |  |        |  |  |  |      49 89 c6             	mov    %rax,%r14
+            if (new_p == nullptr) {
+    1bc9:	|     |  |  |        |  |  |  |      48 85 c0             	test   %rax,%rax
+    1bcc:	|     \--|--|--------|--|--|--|----- 0f 84 79 fb ff ff    	je     174b <ex2()+0x6b>
+            new_n->alloc_ = new_cap;
+    1bd2:	|        |  |        |  |  |  |      66 0f 6f 05 26 25 00 	movdqa 0x2526(%rip),%xmm0        # 4100 <_IO_stdin_used+0x100>
+    1bd9:	|        |  |        |  |  |  |      00 
+    1bda:	|        |  |        |  |  |  |      0f 11 00             	movups %xmm0,(%rax)
+    1bdd:	|        |  |        |  |  |  |      b8 10 00 00 00       	mov    $0x10,%eax
+            nel::elem::copy(data_, o.data_, N);
+    1be2:	|        |  |        |  |  |  |  /-> 48 8b 74 24 10       	mov    0x10(%rsp),%rsi
+    1be7:	|        |  |        |  |  |  |  |   49 8d 3c 06          	lea    (%r14,%rax,1),%rdi
+    1beb:	|        |  |        |  |  |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+            outs << "Vector(" << v.len() << "){";
+    1bf0:	|        |  |        |  |  |  |  |   4c 8d 2d 92 44 00 00 	lea    0x4492(%rip),%r13        # 6089 <nel::log>
+    1bf7:	|        |  |        |  |  |  |  |   e8 c4 17 00 00       	call   33c0 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>
+                // must the arg be moved on error?
+                return Result<void, Type>::Err(forward<Args>(args)...);
+            }
+
+            new (&values_[len()]) Type(forward<Args>(args)...);
+            len_ += 1;
+    1bfc:	|        |  |        |  |  |  |  |   49 83 46 08 01       	addq   $0x1,0x8(%r14)
+    1c01:	|        |  |        |  |  |  |  |   4c 89 ef             	mov    %r13,%rdi
+    1c04:	|        |  |        |  |  |  |  |   48 8d 35 f9 23 00 00 	lea    0x23f9(%rip),%rsi        # 4004 <_IO_stdin_used+0x4>
+    1c0b:	|        |  |        |  |  |  |  |   e8 50 20 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    1c10:	|        |  |        |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+        constexpr Length len(void) const
+    1c13:	|        |  \--------|--|--|--|--|-- e9 ca fb ff ff       	jmp    17e2 <ex2()+0x102>
+            outs << "Vector(" << v.len() << "){";
+    1c18:	|        \-----------|--|--|--|--|-> 31 f6                	xor    %esi,%esi
+    1c1a:	|                    |  |  |  |  |   e8 01 21 00 00       	call   3d20 <nel::operator<<(nel::Log&, unsigned long)>
+    1c1f:	|                    |  |  |  |  |   48 8d 35 e6 23 00 00 	lea    0x23e6(%rip),%rsi        # 400c <_IO_stdin_used+0xc>
+    1c26:	|                    |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1c29:	|                    |  |  |  |  |   e8 32 20 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+            outs << '\n';
+    1c2e:	|                    |  |  |  |  |   4c 89 ef             	mov    %r13,%rdi
+    1c31:	|                    |  |  |  |  |   be 0a 00 00 00       	mov    $0xa,%esi
+    1c36:	|                    |  |  |  |  |   e8 05 20 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+            outs << '}';
+    1c3b:	|                    |  |  |  |  |   4c 89 ef             	mov    %r13,%rdi
+    1c3e:	|                    |  |  |  |  |   be 7d 00 00 00       	mov    $0x7d,%esi
+    1c43:	|                    |  |  |  |  |   e8 f8 1f 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    nel::log << vec1 << '\n';
+    1c48:	|                    |  |  |  |  |   4c 89 ef             	mov    %r13,%rdi
+    1c4b:	|                    |  |  |  |  |   be 0a 00 00 00       	mov    $0xa,%esi
+    1c50:	|                    |  |  |  |  |   e8 eb 1f 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+            nel::elem::set(data_, 0xa5, N);
+    1c55:	|                    |  |  |  |  |   48 8b 7c 24 10       	mov    0x10(%rsp),%rdi
+    1c5a:	|                    |  |  |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1c5f:	|                    |  |  |  |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    1c64:	|                    |  |  |  |  |   e8 67 17 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+}
+    1c69:	|                    |  |  |  |  |   48 81 c4 58 02 00 00 	add    $0x258,%rsp
+    1c70:	|                    |  |  |  |  |   5b                   	pop    %rbx
+    1c71:	|                    |  |  |  |  |   5d                   	pop    %rbp
+    1c72:	|                    |  |  |  |  |   41 5c                	pop    %r12
+    1c74:	|                    |  |  |  |  |   41 5d                	pop    %r13
+    1c76:	|                    |  |  |  |  |   41 5e                	pop    %r14
+    1c78:	|                    |  |  |  |  |   41 5f                	pop    %r15
+    1c7a:	|                    |  |  |  |  |   c3                   	ret
+    1c7b:	\--------------------|--|--|--|--|-> 48 89 d8             	mov    %rbx,%rax
+    1c7e:	                     |  |  |  |  |   48 c1 e0 08          	shl    $0x8,%rax
+    1c82:	                     |  |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    1c86:	                     |  |  |  |  \-- e9 57 ff ff ff       	jmp    1be2 <ex2()+0x502>
+            new (&d[i]) T(nel::move(s[i]));
+            s[i].~T();
+        }
+    } else {
+        // backwards, so overlap is not overwritten before it is read.
+        for (Index i = n; i > 0; --i) {
+    1c8b:	                     |  \--|--|----> 48 85 db             	test   %rbx,%rbx
+    1c8e:	                     +-----|--|----- 0f 84 0b fe ff ff    	je     1a9f <ex2()+0x3bf>
+    1c94:	                     |     |  |      49 89 dd             	mov    %rbx,%r13
+    1c97:	                     |     |  |      49 c1 e5 08          	shl    $0x8,%r13
+    1c9b:	                     |     |  |      49 81 ed f0 00 00 00 	sub    $0xf0,%r13
+    1ca2:	                     |     |  |      4e 8d 3c 28          	lea    (%rax,%r13,1),%r15
+    1ca6:	                     |     |  |      4d 01 f5             	add    %r14,%r13
+            nel::elem::move(data_, o.data_, N);
+    1ca9:	                     |     |  |  /-> 4c 89 ee             	mov    %r13,%rsi
+    1cac:	                     |     |  |  |   4c 89 ff             	mov    %r15,%rdi
+    1caf:	                     |     |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1cb4:	                     |     |  |  |   49 81 ef 00 01 00 00 	sub    $0x100,%r15
+    1cbb:	                     |     |  |  |   e8 20 17 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1cc0:	                     |     |  |  |   4c 89 ef             	mov    %r13,%rdi
+    1cc3:	                     |     |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1cc8:	                     |     |  |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    1ccd:	                     |     |  |  |   e8 fe 16 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1cd2:	                     |     |  |  |   49 81 ed 00 01 00 00 	sub    $0x100,%r13
+    1cd9:	                     |     |  |  |   48 83 eb 01          	sub    $0x1,%rbx
+    1cdd:	                     |     |  |  \-- 75 ca                	jne    1ca9 <ex2()+0x5c9>
+    1cdf:	                     +-----|--|----- e9 bb fd ff ff       	jmp    1a9f <ex2()+0x3bf>
+    1ce4:	                     |     \--|----> 48 85 db             	test   %rbx,%rbx
+    1ce7:	                     +--------|----- 0f 84 b2 fd ff ff    	je     1a9f <ex2()+0x3bf>
+    1ced:	                     |        |      49 89 dd             	mov    %rbx,%r13
+    1cf0:	                     |        |      49 c1 e5 08          	shl    $0x8,%r13
+    1cf4:	                     |        |      49 81 ed f0 00 00 00 	sub    $0xf0,%r13
+    1cfb:	                     |        |      4f 8d 3c 2c          	lea    (%r12,%r13,1),%r15
+    1cff:	                     |        |      4d 01 f5             	add    %r14,%r13
+            nel::elem::move(data_, o.data_, N);
+    1d02:	                     |        |  /-> 4c 89 ee             	mov    %r13,%rsi
+    1d05:	                     |        |  |   4c 89 ff             	mov    %r15,%rdi
+    1d08:	                     |        |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1d0d:	                     |        |  |   49 81 ef 00 01 00 00 	sub    $0x100,%r15
+    1d14:	                     |        |  |   e8 c7 16 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    1d19:	                     |        |  |   4c 89 ef             	mov    %r13,%rdi
+    1d1c:	                     |        |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1d21:	                     |        |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    1d26:	                     |        |  |   e8 a5 16 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1d2b:	                     |        |  |   49 81 ed 00 01 00 00 	sub    $0x100,%r13
+    1d32:	                     |        |  |   48 83 eb 01          	sub    $0x1,%rbx
+    1d36:	                     |        |  \-- 75 ca                	jne    1d02 <ex2()+0x622>
+    1d38:	                     \--------|----- e9 62 fd ff ff       	jmp    1a9f <ex2()+0x3bf>
+                    nel::panic("invalid Result", ctx);
+    1d3d:	                              \----> 48 8d 3d d9 22 00 00 	lea    0x22d9(%rip),%rdi        # 401d <_IO_stdin_used+0x1d>
+    1d44:	                                     e8 d9 f3 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    1d49:	                                     0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000001d50 <ex3()>:
+{
+    1d50:	                41 57                	push   %r15
+                                    : std::realloc(p, new_size);
+    1d52:	                bf 10 05 00 00       	mov    $0x510,%edi
+    1d57:	                41 56                	push   %r14
+    1d59:	                41 55                	push   %r13
+    1d5b:	                41 54                	push   %r12
+    1d5d:	                55                   	push   %rbp
+    1d5e:	                53                   	push   %rbx
+    1d5f:	                48 81 ec 48 01 00 00 	sub    $0x148,%rsp
+    1d66:	                e8 45 f3 ff ff       	call   10b0 <malloc@plt>
+            if (new_p == nullptr) {
+    1d6b:	                48 85 c0             	test   %rax,%rax
+    1d6e:	   /----------- 0f 84 30 02 00 00    	je     1fa4 <ex3()+0x254>
+            new_n->alloc_ = new_cap;
+    1d74:	   |            66 0f 6f 05 74 23 00 	movdqa 0x2374(%rip),%xmm0        # 40f0 <_IO_stdin_used+0xf0>
+    1d7b:	   |            00 
+    1d7c:	   |            49 89 c6             	mov    %rax,%r14
+    1d7f:	   |            0f 11 00             	movups %xmm0,(%rax)
+            nel::elem::set(data_, f, N);
+    1d82:	/--|----------> 49 8d 5e 10          	lea    0x10(%r14),%rbx
+    1d86:	|  |            ba 00 01 00 00       	mov    $0x100,%edx
+    1d8b:	|  |            be 67 00 00 00       	mov    $0x67,%esi
+    1d90:	|  |            48 89 df             	mov    %rbx,%rdi
+    1d93:	|  |            48 89 5c 24 08       	mov    %rbx,0x8(%rsp)
+            outs << "Vector(" << v.len() << "){";
+    1d98:	|  |            4c 8d 2d ea 42 00 00 	lea    0x42ea(%rip),%r13        # 6089 <nel::log>
+    1d9f:	|  |            e8 2c 16 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            len_ += 1;
+    1da4:	|  |            49 83 46 08 01       	addq   $0x1,0x8(%r14)
+    1da9:	|  |            48 8d 35 54 22 00 00 	lea    0x2254(%rip),%rsi        # 4004 <_IO_stdin_used+0x4>
+    1db0:	|  |            4c 89 ef             	mov    %r13,%rdi
+    1db3:	|  |            e8 a8 1e 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    1db8:	|  |            49 8b 76 08          	mov    0x8(%r14),%rsi
+    1dbc:	|  |            48 89 c7             	mov    %rax,%rdi
+    1dbf:	|  |            e8 5c 1f 00 00       	call   3d20 <nel::operator<<(nel::Log&, unsigned long)>
+    1dc4:	|  |            48 8d 35 41 22 00 00 	lea    0x2241(%rip),%rsi        # 400c <_IO_stdin_used+0xc>
+    1dcb:	|  |            48 89 c7             	mov    %rax,%rdi
+    1dce:	|  |            e8 8d 1e 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+            outs << '\n';
+    1dd3:	|  |            be 0a 00 00 00       	mov    $0xa,%esi
+    1dd8:	|  |            4c 89 ef             	mov    %r13,%rdi
+    1ddb:	|  |            e8 60 1e 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    1de0:	|  |            49 8b 46 08          	mov    0x8(%r14),%rax
+            outs << '[';
+    1de4:	|  |            be 5b 00 00 00       	mov    $0x5b,%esi
+    1de9:	|  |            4c 89 ef             	mov    %r13,%rdi
+    1dec:	|  |            48 c1 e0 08          	shl    $0x8,%rax
+    1df0:	|  |            4c 8d 3c 03          	lea    (%rbx,%rax,1),%r15
+    1df4:	|  |            4c 89 3c 24          	mov    %r15,(%rsp)
+    1df8:	|  |            e8 43 1e 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+            if (!it2.is_done()) {
+    1dfd:	|  |            4c 39 fb             	cmp    %r15,%rbx
+    1e00:	|  |  /-------- 0f 84 2a 01 00 00    	je     1f30 <ex3()+0x1e0>
+            outs << "U8Buf<" << val.len() << ">{";
+    1e06:	|  |  |         48 8d 35 02 22 00 00 	lea    0x2202(%rip),%rsi        # 400f <_IO_stdin_used+0xf>
+    1e0d:	|  |  |         4c 89 ef             	mov    %r13,%rdi
+    1e10:	|  |  |         49 8d 5e 11          	lea    0x11(%r14),%rbx
+    1e14:	|  |  |         e8 47 1e 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    1e19:	|  |  |         be 00 01 00 00       	mov    $0x100,%esi
+    1e1e:	|  |  |         49 8d ae 10 01 00 00 	lea    0x110(%r14),%rbp
+    1e25:	|  |  |         48 89 c7             	mov    %rax,%rdi
+    1e28:	|  |  |         e8 f3 1e 00 00       	call   3d20 <nel::operator<<(nel::Log&, unsigned long)>
+    1e2d:	|  |  |         48 8d 35 e2 21 00 00 	lea    0x21e2(%rip),%rsi        # 4016 <_IO_stdin_used+0x16>
+    1e34:	|  |  |         48 89 c7             	mov    %rax,%rdi
+    1e37:	|  |  |         e8 24 1e 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    1e3c:	|  |  |         41 0f b6 76 10       	movzbl 0x10(%r14),%esi
+    1e41:	|  |  |         4c 89 ef             	mov    %r13,%rdi
+    1e44:	|  |  |         e8 37 1e 00 00       	call   3c80 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1e49:	|  |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+                    outs << ' ' << val.data_[i];
+    1e50:	|  |  |     /-> be 20 00 00 00       	mov    $0x20,%esi
+    1e55:	|  |  |     |   4c 89 ef             	mov    %r13,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1e58:	|  |  |     |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    1e5c:	|  |  |     |   e8 df 1d 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    1e61:	|  |  |     |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1e65:	|  |  |     |   48 89 c7             	mov    %rax,%rdi
+    1e68:	|  |  |     |   e8 13 1e 00 00       	call   3c80 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1e6d:	|  |  |     |   48 39 eb             	cmp    %rbp,%rbx
+    1e70:	|  |  |     \-- 75 de                	jne    1e50 <ex3()+0x100>
+            outs << '}';
+    1e72:	|  |  |         be 7d 00 00 00       	mov    $0x7d,%esi
+    1e77:	|  |  |         4c 89 ef             	mov    %r13,%rdi
+    1e7a:	|  |  |         4d 8d a6 10 02 00 00 	lea    0x210(%r14),%r12
+    1e81:	|  |  |         e8 ba 1d 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+            for (; !self().is_done(); self().inc()) {
+    1e86:	|  |  |         48 39 1c 24          	cmp    %rbx,(%rsp)
+    1e8a:	|  |  +-------- 0f 84 a0 00 00 00    	je     1f30 <ex3()+0x1e0>
+                it2.for_each([&outs](OutT const &e) { outs << ',' << e; });
+    1e90:	|  |  |  /----> be 2c 00 00 00       	mov    $0x2c,%esi
+    1e95:	|  |  |  |      4c 89 ef             	mov    %r13,%rdi
+    1e98:	|  |  |  |      4d 89 e7             	mov    %r12,%r15
+    1e9b:	|  |  |  |      e8 a0 1d 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+            outs << "U8Buf<" << val.len() << ">{";
+    1ea0:	|  |  |  |      48 8d 35 68 21 00 00 	lea    0x2168(%rip),%rsi        # 400f <_IO_stdin_used+0xf>
+    1ea7:	|  |  |  |      49 8d 9c 24 01 ff ff 	lea    -0xff(%r12),%rbx
+    1eae:	|  |  |  |      ff 
+    1eaf:	|  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1eb2:	|  |  |  |      48 89 c5             	mov    %rax,%rbp
+    1eb5:	|  |  |  |      e8 a6 1d 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    1eba:	|  |  |  |      be 00 01 00 00       	mov    $0x100,%esi
+    1ebf:	|  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1ec2:	|  |  |  |      e8 59 1e 00 00       	call   3d20 <nel::operator<<(nel::Log&, unsigned long)>
+    1ec7:	|  |  |  |      48 8d 35 48 21 00 00 	lea    0x2148(%rip),%rsi        # 4016 <_IO_stdin_used+0x16>
+    1ece:	|  |  |  |      48 89 c7             	mov    %rax,%rdi
+    1ed1:	|  |  |  |      e8 8a 1d 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    1ed6:	|  |  |  |      48 89 ef             	mov    %rbp,%rdi
+    1ed9:	|  |  |  |      41 0f b6 b4 24 00 ff 	movzbl -0x100(%r12),%esi
+    1ee0:	|  |  |  |      ff ff 
+    1ee2:	|  |  |  |      e8 99 1d 00 00       	call   3c80 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1ee7:	|  |  |  |      66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+    1eee:	|  |  |  |      00 00 
+                    outs << ' ' << val.data_[i];
+    1ef0:	|  |  |  |  /-> be 20 00 00 00       	mov    $0x20,%esi
+    1ef5:	|  |  |  |  |   48 89 ef             	mov    %rbp,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    1ef8:	|  |  |  |  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    1efc:	|  |  |  |  |   e8 3f 1d 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    1f01:	|  |  |  |  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    1f05:	|  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    1f08:	|  |  |  |  |   e8 73 1d 00 00       	call   3c80 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    1f0d:	|  |  |  |  |   49 39 dc             	cmp    %rbx,%r12
+    1f10:	|  |  |  |  \-- 75 de                	jne    1ef0 <ex3()+0x1a0>
+            outs << '}';
+    1f12:	|  |  |  |      be 7d 00 00 00       	mov    $0x7d,%esi
+    1f17:	|  |  |  |      48 89 ef             	mov    %rbp,%rdi
+            for (; !self().is_done(); self().inc()) {
+    1f1a:	|  |  |  |      49 81 c4 00 01 00 00 	add    $0x100,%r12
+    1f21:	|  |  |  |      e8 1a 1d 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    1f26:	|  |  |  |      4c 39 3c 24          	cmp    %r15,(%rsp)
+    1f2a:	|  |  |  \----- 0f 85 60 ff ff ff    	jne    1e90 <ex3()+0x140>
+            outs << ']';
+    1f30:	|  |  \-------> be 5d 00 00 00       	mov    $0x5d,%esi
+    1f35:	|  |            4c 89 ef             	mov    %r13,%rdi
+            for (Index i = 0; i < len(); ++i) {
+    1f38:	|  |            31 db                	xor    %ebx,%ebx
+    1f3a:	|  |            e8 01 1d 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+            outs << '}';
+    1f3f:	|  |            be 7d 00 00 00       	mov    $0x7d,%esi
+    1f44:	|  |            4c 89 ef             	mov    %r13,%rdi
+    1f47:	|  |            e8 f4 1c 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    nel::log << vec1 << '\n';
+    1f4c:	|  |            be 0a 00 00 00       	mov    $0xa,%esi
+    1f51:	|  |            4c 89 ef             	mov    %r13,%rdi
+    1f54:	|  |            e8 e7 1c 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    1f59:	|  |            49 83 7e 08 00       	cmpq   $0x0,0x8(%r14)
+    1f5e:	|  |            48 8b 6c 24 08       	mov    0x8(%rsp),%rbp
+    1f63:	|  |     /----- 74 26                	je     1f8b <ex3()+0x23b>
+    1f65:	|  |     |      0f 1f 00             	nopl   (%rax)
+            nel::elem::set(data_, 0xa5, N);
+    1f68:	|  |     |  /-> 48 89 ef             	mov    %rbp,%rdi
+    1f6b:	|  |     |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    1f70:	|  |     |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    1f75:	|  |     |  |   48 83 c3 01          	add    $0x1,%rbx
+    1f79:	|  |     |  |   e8 52 14 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1f7e:	|  |     |  |   48 81 c5 00 01 00 00 	add    $0x100,%rbp
+    1f85:	|  |     |  |   49 3b 5e 08          	cmp    0x8(%r14),%rbx
+    1f89:	|  |     |  \-- 72 dd                	jb     1f68 <ex3()+0x218>
+}
+    1f8b:	|  |     \----> 48 81 c4 48 01 00 00 	add    $0x148,%rsp
+                std::free(p);
+    1f92:	|  |            4c 89 f7             	mov    %r14,%rdi
+    1f95:	|  |            5b                   	pop    %rbx
+    1f96:	|  |            5d                   	pop    %rbp
+    1f97:	|  |            41 5c                	pop    %r12
+    1f99:	|  |            41 5d                	pop    %r13
+    1f9b:	|  |            41 5e                	pop    %r14
+    1f9d:	|  |            41 5f                	pop    %r15
+    1f9f:	|  |            e9 8c f0 ff ff       	jmp    1030 <free@plt>
+                                    : std::realloc(p, new_size);
+    1fa4:	|  \----------> bf 10 04 00 00       	mov    $0x410,%edi
+    1fa9:	|               e8 02 f1 ff ff       	call   10b0 <malloc@plt>
+    1fae:	|               49 89 c6             	mov    %rax,%r14
+            if (new_p == nullptr) {
+    1fb1:	|               48 85 c0             	test   %rax,%rax
+    1fb4:	|           /-- 74 1a                	je     1fd0 <ex3()+0x280>
+            new_n->alloc_ = new_cap;
+    1fb6:	|           |   66 0f 6f 05 42 21 00 	movdqa 0x2142(%rip),%xmm0        # 4100 <_IO_stdin_used+0x100>
+    1fbd:	|           |   00 
+    1fbe:	|           |   0f 11 00             	movups %xmm0,(%rax)
+    1fc1:	\-----------|-- e9 bc fd ff ff       	jmp    1d82 <ex3()+0x32>
+    1fc6:	            |   66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    1fcd:	            |   00 00 00 
+            nel::elem::set(data_, f, N);
+    1fd0:	            \-> 48 8d 5c 24 34       	lea    0x34(%rsp),%rbx
+    1fd5:	                ba 00 01 00 00       	mov    $0x100,%edx
+    1fda:	                be 67 00 00 00       	mov    $0x67,%esi
+            : tag_(Tag::ERR)
+    1fdf:	                c7 44 24 30 02 00 00 	movl   $0x2,0x30(%rsp)
+    1fe6:	                00 
+    1fe7:	                48 89 df             	mov    %rbx,%rdi
+    1fea:	                e8 e1 13 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    1fef:	                48 8d 15 b2 20 00 00 	lea    0x20b2(%rip),%rdx        # 40a8 <_IO_stdin_used+0xa8>
+    1ff6:	                48 8d 0d 3a 20 00 00 	lea    0x203a(%rip),%rcx        # 4037 <_IO_stdin_used+0x37>
+    1ffd:	                8b 44 24 30          	mov    0x30(%rsp),%eax
+    2001:	                66 48 0f 6e c1       	movq   %rcx,%xmm0
+    2006:	                66 48 0f 6e ca       	movq   %rdx,%xmm1
+            , line_num_(line_num)
+    200b:	                c7 44 24 20 21 00 00 	movl   $0x21,0x20(%rsp)
+    2012:	                00 
+            : fn_name_(fn_name)
+    2013:	                66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    2017:	                0f 29 44 24 10       	movaps %xmm0,0x10(%rsp)
+            switch (tag_) { // result<void>-match
+    201c:	                83 f8 01             	cmp    $0x1,%eax
+    201f:	            /-- 74 17                	je     2038 <ex3()+0x2e8>
+    2021:	            |   83 f8 02             	cmp    $0x2,%eax
+    2024:	         /--|-- 75 79                	jne    209f <ex3()+0x34f>
+            nel::elem::set(data_, 0xa5, N);
+    2026:	         |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    202b:	         |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    2030:	         |  |   48 89 df             	mov    %rbx,%rdi
+    2033:	         |  |   e8 98 13 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            outs << "Vector(" << v.len() << "){";
+    2038:	         |  \-> 4c 8d 2d 4a 40 00 00 	lea    0x404a(%rip),%r13        # 6089 <nel::log>
+    203f:	         |      48 8d 35 be 1f 00 00 	lea    0x1fbe(%rip),%rsi        # 4004 <_IO_stdin_used+0x4>
+    2046:	         |      4c 89 ef             	mov    %r13,%rdi
+    2049:	         |      e8 12 1c 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    204e:	         |      31 f6                	xor    %esi,%esi
+    2050:	         |      48 89 c7             	mov    %rax,%rdi
+    2053:	         |      e8 c8 1c 00 00       	call   3d20 <nel::operator<<(nel::Log&, unsigned long)>
+    2058:	         |      48 8d 35 ad 1f 00 00 	lea    0x1fad(%rip),%rsi        # 400c <_IO_stdin_used+0xc>
+    205f:	         |      48 89 c7             	mov    %rax,%rdi
+    2062:	         |      e8 f9 1b 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+            outs << '\n';
+    2067:	         |      4c 89 ef             	mov    %r13,%rdi
+    206a:	         |      be 0a 00 00 00       	mov    $0xa,%esi
+    206f:	         |      e8 cc 1b 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+            outs << '}';
+    2074:	         |      4c 89 ef             	mov    %r13,%rdi
+    2077:	         |      be 7d 00 00 00       	mov    $0x7d,%esi
+    207c:	         |      e8 bf 1b 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    2081:	         |      48 81 c4 48 01 00 00 	add    $0x148,%rsp
+    nel::log << vec1 << '\n';
+    2088:	         |      4c 89 ef             	mov    %r13,%rdi
+    208b:	         |      be 0a 00 00 00       	mov    $0xa,%esi
+}
+    2090:	         |      5b                   	pop    %rbx
+    2091:	         |      5d                   	pop    %rbp
+    2092:	         |      41 5c                	pop    %r12
+    2094:	         |      41 5d                	pop    %r13
+    2096:	         |      41 5e                	pop    %r14
+    2098:	         |      41 5f                	pop    %r15
+    nel::log << vec1 << '\n';
+    209a:	         |      e9 a1 1b 00 00       	jmp    3c40 <nel::operator<<(nel::Log&, char)>
+                    nel::panic("bad Result", ctx);
+    209f:	         \----> 48 8d 74 24 10       	lea    0x10(%rsp),%rsi
+            switch (tag_) { // result<void>-match
+    20a4:	                85 c0                	test   %eax,%eax
+    20a6:	            /-- 74 0c                	je     20b4 <ex3()+0x364>
+                    nel::panic("bad Result", ctx);
+    20a8:	            |   48 8d 3d 7d 1f 00 00 	lea    0x1f7d(%rip),%rdi        # 402c <_IO_stdin_used+0x2c>
+    20af:	            |   e8 6e f0 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+                    nel::panic("invalid Result", ctx);
+    20b4:	            \-> 48 8d 3d 62 1f 00 00 	lea    0x1f62(%rip),%rdi        # 401d <_IO_stdin_used+0x1d>
+    20bb:	                e8 62 f0 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+
+00000000000020c0 <ex42()>:
+{
+    20c0:	                                                                            41 57                	push   %r15
+    20c2:	                                                                            48 8d 05 df 1f 00 00 	lea    0x1fdf(%rip),%rax        # 40a8 <_IO_stdin_used+0xa8>
+                                    : std::realloc(p, new_size);
+    20c9:	                                                                            bf 10 05 00 00       	mov    $0x510,%edi
+    20ce:	                                                                            48 8d 15 66 1f 00 00 	lea    0x1f66(%rip),%rdx        # 403b <_IO_stdin_used+0x3b>
+    20d5:	                                                                            41 56                	push   %r14
+    20d7:	                                                                            66 48 0f 6e ca       	movq   %rdx,%xmm1
+    20dc:	                                                                            66 48 0f 6e d8       	movq   %rax,%xmm3
+    20e1:	                                                                            48 8d 15 58 1f 00 00 	lea    0x1f58(%rip),%rdx        # 4040 <_IO_stdin_used+0x40>
+    20e8:	                                                                            41 55                	push   %r13
+    20ea:	                                                                            48 8d 05 57 1f 00 00 	lea    0x1f57(%rip),%rax        # 4048 <_IO_stdin_used+0x48>
+    20f1:	                                                                            66 48 0f 6e d2       	movq   %rdx,%xmm2
+    20f6:	                                                                            66 0f 6c cb          	punpcklqdq %xmm3,%xmm1
+    20fa:	                                                                            41 54                	push   %r12
+    20fc:	                                                                            66 48 0f 6e e0       	movq   %rax,%xmm4
+    2101:	                                                                            55                   	push   %rbp
+    2102:	                                                                            66 0f 6c d4          	punpcklqdq %xmm4,%xmm2
+    2106:	                                                                            53                   	push   %rbx
+    2107:	                                                                            48 81 ec 68 01 00 00 	sub    $0x168,%rsp
+    210e:	                                                                            0f 29 0c 24          	movaps %xmm1,(%rsp)
+    2112:	                                                                            0f 29 54 24 10       	movaps %xmm2,0x10(%rsp)
+    2117:	                                                                            e8 94 ef ff ff       	call   10b0 <malloc@plt>
+            if (new_p == nullptr) {
+    211c:	                                                                            48 85 c0             	test   %rax,%rax
+    211f:	   /----------------------------------------------------------------------- 0f 84 16 07 00 00    	je     283b <ex42()+0x77b>
+    2125:	   |                                                                        66 0f 6f 05 c3 1f 00 	movdqa 0x1fc3(%rip),%xmm0        # 40f0 <_IO_stdin_used+0xf0>
+    212c:	   |                                                                        00 
+    212d:	   |                                                                        49 89 c5             	mov    %rax,%r13
+    2130:	   |                                                                        0f 11 00             	movups %xmm0,(%rax)
+            nel::elem::set(data_, f, N);
+    2133:	/--|----------------------------------------------------------------------> 4d 8d 75 10          	lea    0x10(%r13),%r14
+    2137:	|  |                                                                        ba 00 01 00 00       	mov    $0x100,%edx
+    213c:	|  |                                                                        be 67 00 00 00       	mov    $0x67,%esi
+    2141:	|  |                                                                        4c 89 f7             	mov    %r14,%rdi
+    2144:	|  |                                                                        e8 87 12 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            len_ += 1;
+    2149:	|  |                                                                        49 83 45 08 01       	addq   $0x1,0x8(%r13)
+            return len_;
+    214e:	|  |                                                                        49 8b 5d 08          	mov    0x8(%r13),%rbx
+            return alloc_;
+    2152:	|  |                                                                        49 8b 45 00          	mov    0x0(%r13),%rax
+            if (len() + n <= capacity()) { return true; }
+    2156:	|  |                                                                        48 8d 53 01          	lea    0x1(%rbx),%rdx
+    215a:	|  |                                                                        48 39 d0             	cmp    %rdx,%rax
+    215d:	|  |                                                           /----------- 0f 82 b4 01 00 00    	jb     2317 <ex42()+0x257>
+            if (len() >= capacity()) {
+    2163:	|  |                                                  /--------|----------> 48 39 c3             	cmp    %rax,%rbx
+    2166:	|  |                                                  |  /-----|----------- 0f 82 96 02 00 00    	jb     2402 <ex42()+0x342>
+    216c:	|  |                                                  |  |  /--|----------> 48 8d 5c 24 54       	lea    0x54(%rsp),%rbx
+    2171:	|  |                                                  |  |  |  |            ba 00 01 00 00       	mov    $0x100,%edx
+    2176:	|  |                                                  |  |  |  |            be 68 00 00 00       	mov    $0x68,%esi
+            : tag_(Tag::ERR)
+    217b:	|  |                                                  |  |  |  |            c7 44 24 50 02 00 00 	movl   $0x2,0x50(%rsp)
+    2182:	|  |                                                  |  |  |  |            00 
+    2183:	|  |                                                  |  |  |  |            48 89 df             	mov    %rbx,%rdi
+    2186:	|  |                                                  |  |  |  |            e8 45 12 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    218b:	|  |                                                  |  |  |  |            66 0f 6f 24 24       	movdqa (%rsp),%xmm4
+    2190:	|  |                                                  |  |  |  |            8b 44 24 50          	mov    0x50(%rsp),%eax
+    2194:	|  |                                                  |  |  |  |            0f 29 64 24 30       	movaps %xmm4,0x30(%rsp)
+            switch (tag_) { // result<void>-match
+    2199:	|  |                                                  |  |  |  |            83 f8 01             	cmp    $0x1,%eax
+    219c:	|  |                                               /--|--|--|--|----------- 0f 84 e2 03 00 00    	je     2584 <ex42()+0x4c4>
+            , line_num_(line_num)
+    21a2:	|  |  /--------------------------------------------|--|--|--|--|----------> c7 44 24 40 47 00 00 	movl   $0x47,0x40(%rsp)
+    21a9:	|  |  |                                            |  |  |  |  |            00 
+    21aa:	|  |  |                                            |  |  |  |  |            83 f8 02             	cmp    $0x2,%eax
+    21ad:	|  |  |           /--------------------------------|--|--|--|--|----------- 0f 85 2d 06 00 00    	jne    27e0 <ex42()+0x720>
+            nel::elem::set(data_, 0xa5, N);
+    21b3:	|  |  |           |                                |  |  |  |  |            ba 00 01 00 00       	mov    $0x100,%edx
+    21b8:	|  |  |           |                                |  |  |  |  |            be a5 00 00 00       	mov    $0xa5,%esi
+    21bd:	|  |  |           |                                |  |  |  |  |            48 89 df             	mov    %rbx,%rdi
+    21c0:	|  |  |           |                                |  |  |  |  |            e8 0b 12 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return (item_ == nullptr) ? 0 : item_->len();
+    21c5:	|  |  |  /--------|--------------------------------|--|--|--|--|----------> 4d 85 ed             	test   %r13,%r13
+    21c8:	|  |  |  |        |                                +--|--|--|--|----------- 0f 85 b6 03 00 00    	jne    2584 <ex42()+0x4c4>
+                                    : std::realloc(p, new_size);
+    21ce:	|  |  |  |        |                                |  |  |  |  |            bf 10 04 00 00       	mov    $0x410,%edi
+    21d3:	|  |  |  |        |                                |  |  |  |  |            e8 d8 ee ff ff       	call   10b0 <malloc@plt>
+    21d8:	|  |  |  |        |                                |  |  |  |  |            49 89 c5             	mov    %rax,%r13
+            if (new_p == nullptr) {
+    21db:	|  |  |  |        |                                |  |  |  |  |            48 85 c0             	test   %rax,%rax
+    21de:	|  |  |  |        |  /-----------------------------|--|--|--|--|----------- 0f 84 21 06 00 00    	je     2805 <ex42()+0x745>
+            new_n->alloc_ = new_cap;
+    21e4:	|  |  |  |        |  |                             |  |  |  |  |            66 0f 6f 05 14 1f 00 	movdqa 0x1f14(%rip),%xmm0        # 4100 <_IO_stdin_used+0x100>
+    21eb:	|  |  |  |        |  |                             |  |  |  |  |            00 
+    21ec:	|  |  |  |        |  |                             |  |  |  |  |            0f 11 00             	movups %xmm0,(%rax)
+    21ef:	|  |  |  |        |  |                             |  |  |  |  |            b8 10 00 00 00       	mov    $0x10,%eax
+            nel::elem::set(data_, f, N);
+    21f4:	|  |  |  |  /-----|--|-----------------------------|--|--|--|--|----------> 49 8d 7c 05 00       	lea    0x0(%r13,%rax,1),%rdi
+    21f9:	|  |  |  |  |     |  |                             |  |  |  |  |            ba 00 01 00 00       	mov    $0x100,%edx
+    21fe:	|  |  |  |  |     |  |                             |  |  |  |  |            be 69 00 00 00       	mov    $0x69,%esi
+    2203:	|  |  |  |  |     |  |                             |  |  |  |  |            e8 c8 11 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            len_ += 1;
+    2208:	|  |  |  |  |     |  |                             |  |  |  |  |            49 83 45 08 01       	addq   $0x1,0x8(%r13)
+            return len_;
+    220d:	|  |  |  |  |     |  |              /--------------|--|--|--|--|----------> 49 8b 45 08          	mov    0x8(%r13),%rax
+            return Slice(values_, len());
+    2211:	|  |  |  |  |     |  |              |              |  |  |  |  |            4d 8d 75 10          	lea    0x10(%r13),%r14
+    2215:	|  |  |  |  |     |  |              |              |  |  |  |  |            48 89 c2             	mov    %rax,%rdx
+    2218:	|  |  |  |  |     |  |              |              |  |  |  |  |            48 c1 e2 08          	shl    $0x8,%rdx
+    221c:	|  |  |  |  |     |  |              |              |  |  |  |  |            49 8d 0c 16          	lea    (%r14,%rdx,1),%rcx
+    2220:	|  |  |  |  |     |  |              |              |  |  |  |  |            48 89 0c 24          	mov    %rcx,(%rsp)
+            for (; !self().is_done(); self().inc()) {
+    2224:	|  |  |  |  |     |  |              |              |  |  |  |  |            49 39 ce             	cmp    %rcx,%r14
+    2227:	|  |  |  |  |     |  |              |              |  |  |  |  |  /-------- 0f 84 a7 00 00 00    	je     22d4 <ex42()+0x214>
+    222d:	|  |  |  |  |     |  |              |              |  |  |  |  |  |         49 8d ad 10 01 00 00 	lea    0x110(%r13),%rbp
+    2234:	|  |  |  |  |     |  |              |              |  |  |  |  |  |         4c 8d 25 4e 3e 00 00 	lea    0x3e4e(%rip),%r12        # 6089 <nel::log>
+            outs << "U8Buf<" << val.len() << ">{";
+    223b:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  /----> 48 8d 35 cd 1d 00 00 	lea    0x1dcd(%rip),%rsi        # 400f <_IO_stdin_used+0xf>
+    2242:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      4c 89 e7             	mov    %r12,%rdi
+    2245:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      49 89 ef             	mov    %rbp,%r15
+    2248:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      e8 13 1a 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    224d:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      be 00 01 00 00       	mov    $0x100,%esi
+    2252:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      48 8d 9d 01 ff ff ff 	lea    -0xff(%rbp),%rbx
+    2259:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    225c:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      e8 bf 1a 00 00       	call   3d20 <nel::operator<<(nel::Log&, unsigned long)>
+    2261:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      48 8d 35 ae 1d 00 00 	lea    0x1dae(%rip),%rsi        # 4016 <_IO_stdin_used+0x16>
+    2268:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    226b:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      e8 f0 19 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    2270:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      0f b6 b5 00 ff ff ff 	movzbl -0x100(%rbp),%esi
+    2277:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      4c 89 e7             	mov    %r12,%rdi
+    227a:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      e8 01 1a 00 00       	call   3c80 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    227f:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      90                   	nop
+                    outs << ' ' << val.data_[i];
+    2280:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |  /-> be 20 00 00 00       	mov    $0x20,%esi
+    2285:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |  |   4c 89 e7             	mov    %r12,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    2288:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    228c:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |  |   e8 af 19 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    2291:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    2295:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    2298:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |  |   e8 e3 19 00 00       	call   3c80 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    229d:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |  |   48 39 dd             	cmp    %rbx,%rbp
+    22a0:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |  \-- 75 de                	jne    2280 <ex42()+0x1c0>
+            outs << '}';
+    22a2:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      be 7d 00 00 00       	mov    $0x7d,%esi
+    22a7:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      4c 89 e7             	mov    %r12,%rdi
+    22aa:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      48 81 c5 00 01 00 00 	add    $0x100,%rbp
+    22b1:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      e8 8a 19 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    it.for_each([&](U8Buf<256> &e) -> void { nel::log << e << '\n'; });
+    22b6:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      be 0a 00 00 00       	mov    $0xa,%esi
+    22bb:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      4c 89 e7             	mov    %r12,%rdi
+    22be:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      e8 7d 19 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    22c3:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      48 8b 04 24          	mov    (%rsp),%rax
+    22c7:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      49 39 c7             	cmp    %rax,%r15
+    22ca:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  \----- 0f 85 6b ff ff ff    	jne    223b <ex42()+0x17b>
+            return len_;
+    22d0:	|  |  |  |  |     |  |              |              |  |  |  |  |  |         49 8b 45 08          	mov    0x8(%r13),%rax
+            for (Index i = 0; i < len(); ++i) {
+    22d4:	|  |  |  |  |     |  |              |              |  |  |  |  |  \-------> 31 db                	xor    %ebx,%ebx
+    22d6:	|  |  |  |  |     |  |              |              |  |  |  |  |            48 85 c0             	test   %rax,%rax
+    22d9:	|  |  |  |  |     |  |              |              |  |  |  |  |     /----- 74 23                	je     22fe <ex42()+0x23e>
+            nel::elem::set(data_, 0xa5, N);
+    22db:	|  |  |  |  |     |  |              |              |  |  |  |  |     |  /-> 4c 89 f7             	mov    %r14,%rdi
+    22de:	|  |  |  |  |     |  |              |              |  |  |  |  |     |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    22e3:	|  |  |  |  |     |  |              |              |  |  |  |  |     |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    22e8:	|  |  |  |  |     |  |              |              |  |  |  |  |     |  |   48 83 c3 01          	add    $0x1,%rbx
+    22ec:	|  |  |  |  |     |  |              |              |  |  |  |  |     |  |   e8 df 10 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    22f1:	|  |  |  |  |     |  |              |              |  |  |  |  |     |  |   49 81 c6 00 01 00 00 	add    $0x100,%r14
+    22f8:	|  |  |  |  |     |  |              |              |  |  |  |  |     |  |   49 3b 5d 08          	cmp    0x8(%r13),%rbx
+    22fc:	|  |  |  |  |     |  |              |              |  |  |  |  |     |  \-- 72 dd                	jb     22db <ex42()+0x21b>
+}
+    22fe:	|  |  |  |  |     |  |              |              |  |  |  |  |     \----> 48 81 c4 68 01 00 00 	add    $0x168,%rsp
+                std::free(p);
+    2305:	|  |  |  |  |     |  |              |              |  |  |  |  |            4c 89 ef             	mov    %r13,%rdi
+    2308:	|  |  |  |  |     |  |              |              |  |  |  |  |            5b                   	pop    %rbx
+    2309:	|  |  |  |  |     |  |              |              |  |  |  |  |            5d                   	pop    %rbp
+    230a:	|  |  |  |  |     |  |              |              |  |  |  |  |            41 5c                	pop    %r12
+    230c:	|  |  |  |  |     |  |              |              |  |  |  |  |            41 5d                	pop    %r13
+    230e:	|  |  |  |  |     |  |              |              |  |  |  |  |            41 5e                	pop    %r14
+    2310:	|  |  |  |  |     |  |              |              |  |  |  |  |            41 5f                	pop    %r15
+    2312:	|  |  |  |  |     |  |              |              |  |  |  |  |            e9 19 ed ff ff       	jmp    1030 <free@plt>
+    2317:	|  |  |  |  |     |  |              |              |  |  |  |  \----------> 48 83 f8 03          	cmp    $0x3,%rax
+    231b:	|  |  |  |  |     |  |              |              |  |  |  |        /----- 0f 87 f1 00 00 00    	ja     2412 <ex42()+0x352>
+    2321:	|  |  |  |  |     |  |              |              |  |  |  |        |      b8 04 00 00 00       	mov    $0x4,%eax
+    2326:	|  |  |  |  |     |  |              |              |  |  |  |        |      48 39 c2             	cmp    %rax,%rdx
+    2329:	|  |  |  |  |     |  |              |              |  |  |  |        |      48 0f 42 d0          	cmovb  %rax,%rdx
+    232d:	|  |  |  |  |     |  |              |              |  |  |  |        |      48 39 da             	cmp    %rbx,%rdx
+    2330:	|  |  |  |  |     |  |              |              |  |  |  |        |      48 0f 42 d3          	cmovb  %rbx,%rdx
+    2334:	|  |  |  |  |     |  |              |              |  |  |  |        |      48 89 d5             	mov    %rdx,%rbp
+            if (new_cap > max_capacity) { return nullptr; }
+    2337:	|  |  |  |  |     |  |              |              |  |  |  |     /--|----> 48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    233e:	|  |  |  |  |     |  |              |              |  |  |  |     |  |      ff 7f 00 
+    2341:	|  |  |  |  |     |  |              |              |  |  |  |     |  |      48 39 e8             	cmp    %rbp,%rax
+    2344:	|  |  |  |  |     |  |        /-----|--------------|--|--|--|-----|--|----- 0f 82 17 05 00 00    	jb     2861 <ex42()+0x7a1>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    234a:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      48 89 ef             	mov    %rbp,%rdi
+    234d:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      48 c1 e7 08          	shl    $0x8,%rdi
+    2351:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      48 83 c7 10          	add    $0x10,%rdi
+                                    : std::realloc(p, new_size);
+    2355:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      e8 56 ed ff ff       	call   10b0 <malloc@plt>
+    235a:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      49 89 c4             	mov    %rax,%r12
+            if (new_p == nullptr) {
+    235d:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      48 85 c0             	test   %rax,%rax
+    2360:	|  |  |  |  |     |  |        +-----|--------------|--|--|--|-----|--|----- 0f 84 fb 04 00 00    	je     2861 <ex42()+0x7a1>
+            : fn_name_(fn_name)
+    2366:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      66 0f 6f 74 24 10    	movdqa 0x10(%rsp),%xmm6
+            , line_num_(line_num)
+    236c:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      c7 44 24 60 91 00 00 	movl   $0x91,0x60(%rsp)
+    2373:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      00 
+            : fn_name_(fn_name)
+    2374:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      0f 29 74 24 50       	movaps %xmm6,0x50(%rsp)
+
+#    undef assert
+
+inline void assert(bool pred, char const *const msg, Context const &ctx = Context())
+{
+    if (!pred) { assert_fail(msg, ctx); }
+    2379:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      48 39 dd             	cmp    %rbx,%rbp
+    237c:	|  |  |  |  |     |  |     /--|-----|--------------|--|--|--|-----|--|----- 0f 82 2a 05 00 00    	jb     28ac <ex42()+0x7ec>
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    2382:	|  |  |  |  |     |  |     |  |     |              |  |  |  |     |  |      4c 8d 78 10          	lea    0x10(%rax),%r15
+                    new_n->len_ = old_n->len_;
+    2386:	|  |  |  |  |     |  |     |  |     |              |  |  |  |     |  |      48 89 58 08          	mov    %rbx,0x8(%rax)
+    if (d == s) { return; }
+    238a:	|  |  |  |  |     |  |     |  |     |              |  |  |  |     |  |      4d 39 fe             	cmp    %r15,%r14
+    238d:	|  |  |  |  |  /--|--|-----|--|-----|--------------|--|--|--|-----|--|----- 74 53                	je     23e2 <ex42()+0x322>
+    } else if (d < s) {
+    238f:	|  |  |  |  |  |  |  |     |  |     |              |  |  |  |     |  |      4d 39 f7             	cmp    %r14,%r15
+    2392:	|  |  |  |  |  |  |  |  /--|--|-----|--------------|--|--|--|-----|--|----- 0f 83 91 05 00 00    	jae    2929 <ex42()+0x869>
+        for (Index i = 0; i < n; ++i) {
+    2398:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |      48 85 db             	test   %rbx,%rbx
+    239b:	|  |  |  |  |  +--|--|--|--|--|-----|--------------|--|--|--|-----|--|----- 74 45                	je     23e2 <ex42()+0x322>
+    239d:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |      31 c0                	xor    %eax,%eax
+            nel::elem::move(data_, o.data_, N);
+    239f:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  /-> 4c 89 f6             	mov    %r14,%rsi
+    23a2:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   4c 89 ff             	mov    %r15,%rdi
+    23a5:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    23aa:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    23af:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   e8 2c 10 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    23b4:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   4c 89 f7             	mov    %r14,%rdi
+    23b7:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    23bc:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    23c1:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   e8 0a 10 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    23c6:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   48 8b 44 24 28       	mov    0x28(%rsp),%rax
+    23cb:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   49 81 c6 00 01 00 00 	add    $0x100,%r14
+    23d2:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   49 81 c7 00 01 00 00 	add    $0x100,%r15
+    23d9:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   48 83 c0 01          	add    $0x1,%rax
+    23dd:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   48 39 d8             	cmp    %rbx,%rax
+    23e0:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  \-- 75 bd                	jne    239f <ex42()+0x2df>
+                std::free(p);
+    23e2:	|  |  |  |  |  >--|--|--|--|--|-----|--------------|--|--|--|-----|--|----> 4c 89 ef             	mov    %r13,%rdi
+                item_ = p;
+    23e5:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |      4d 89 e5             	mov    %r12,%r13
+    23e8:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |      e8 43 ec ff ff       	call   1030 <free@plt>
+            return len_;
+    23ed:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |      49 8b 5c 24 08       	mov    0x8(%r12),%rbx
+    23f2:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |      48 89 e8             	mov    %rbp,%rax
+            new_n->alloc_ = new_cap;
+    23f5:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |      49 89 2c 24          	mov    %rbp,(%r12)
+            if (len() >= capacity()) {
+    23f9:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |      48 39 c3             	cmp    %rax,%rbx
+    23fc:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  \-----|--|----- 0f 83 6a fd ff ff    	jae    216c <ex42()+0xac>
+    2402:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  \--------|--|----> 48 89 d8             	mov    %rbx,%rax
+    2405:	|  |  |  |  |  |  |  |  |  |  |     |              |  |           |  |      48 c1 e0 08          	shl    $0x8,%rax
+    2409:	|  |  |  |  |  |  |  |  |  |  |     |              |  |           |  |      48 83 c0 10          	add    $0x10,%rax
+    240d:	|  |  |  |  |  |  |  |  |  |  |     |              |  |        /--|--|----- e9 59 01 00 00       	jmp    256b <ex42()+0x4ab>
+    2412:	|  |  |  |  |  |  |  |  |  |  |     |              |  |        |  |  \----> 48 8d 2c 00          	lea    (%rax,%rax,1),%rbp
+    2416:	|  |  |  |  |  |  |  |  |  |  |     |              |  |        |  |         48 39 d5             	cmp    %rdx,%rbp
+    2419:	|  |  |  |  |  |  |  |  |  |  |     |              |  |        |  |         48 0f 42 ea          	cmovb  %rdx,%rbp
+    241d:	|  |  |  |  |  |  |  |  |  |  |     |              |  |        |  |         48 39 dd             	cmp    %rbx,%rbp
+    2420:	|  |  |  |  |  |  |  |  |  |  |     |              |  |        |  |         48 0f 42 eb          	cmovb  %rbx,%rbp
+            } else if (new_cap == item_->capacity()) {
+    2424:	|  |  |  |  |  |  |  |  |  |  |     |              |  |        |  |         48 39 c5             	cmp    %rax,%rbp
+    2427:	|  |  |  |  |  |  |  |  |  |  |     |              |  \--------|--|-------- 0f 84 36 fd ff ff    	je     2163 <ex42()+0xa3>
+            } else if (new_cap > item_->capacity()) {
+    242d:	|  |  |  |  |  |  |  |  |  |  |     |              |           |  |         48 39 e8             	cmp    %rbp,%rax
+    2430:	|  |  |  |  |  |  |  |  |  |  |     |              |           |  \-------- 0f 82 01 ff ff ff    	jb     2337 <ex42()+0x277>
+            if (new_cap > max_capacity) { return nullptr; }
+    2436:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    243d:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            ff 7f 00 
+    2440:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            48 39 e8             	cmp    %rbp,%rax
+    2443:	|  |  |  |  |  |  |  |  |  |  +-----|--------------|-----------|----------- 0f 82 18 04 00 00    	jb     2861 <ex42()+0x7a1>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    2449:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            48 89 ef             	mov    %rbp,%rdi
+    244c:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            48 c1 e7 08          	shl    $0x8,%rdi
+    2450:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            48 83 c7 10          	add    $0x10,%rdi
+                                    : std::realloc(p, new_size);
+    2454:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            e8 57 ec ff ff       	call   10b0 <malloc@plt>
+    2459:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            49 89 c4             	mov    %rax,%r12
+            if (new_p == nullptr) {
+    245c:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            48 85 c0             	test   %rax,%rax
+    245f:	|  |  |  |  |  |  |  |  |  |  +-----|--------------|-----------|----------- 0f 84 fc 03 00 00    	je     2861 <ex42()+0x7a1>
+            : fn_name_(fn_name)
+    2465:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            66 0f 6f 7c 24 10    	movdqa 0x10(%rsp),%xmm7
+            , line_num_(line_num)
+    246b:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            c7 44 24 60 91 00 00 	movl   $0x91,0x60(%rsp)
+    2472:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            00 
+            : fn_name_(fn_name)
+    2473:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            0f 29 7c 24 50       	movaps %xmm7,0x50(%rsp)
+    if (!pred) { assert_fail(msg, ctx); }
+    2478:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            48 39 dd             	cmp    %rbx,%rbp
+    247b:	|  |  |  |  |  |  |  |  |  +--|-----|--------------|-----------|----------- 0f 82 2b 04 00 00    	jb     28ac <ex42()+0x7ec>
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    2481:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            4c 8d 78 10          	lea    0x10(%rax),%r15
+                    new_n->len_ = old_n->len_;
+    2485:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            48 89 58 08          	mov    %rbx,0x8(%rax)
+    if (d == s) { return; }
+    2489:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            4d 39 fe             	cmp    %r15,%r14
+    248c:	|  |  |  |  |  +--|--|--|--|--|-----|--------------|-----------|----------- 0f 84 50 ff ff ff    	je     23e2 <ex42()+0x322>
+    } else if (d < s) {
+    2492:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            4d 39 f7             	cmp    %r14,%r15
+    2495:	|  |  |  |  |  |  |  |  |  |  |  /--|--------------|-----------|----------- 0f 83 e7 04 00 00    	jae    2982 <ex42()+0x8c2>
+        for (Index i = 0; i < n; ++i) {
+    249b:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |            48 85 db             	test   %rbx,%rbx
+    249e:	|  |  |  |  |  +--|--|--|--|--|--|--|--------------|-----------|----------- 0f 84 3e ff ff ff    	je     23e2 <ex42()+0x322>
+    24a4:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |            31 c0                	xor    %eax,%eax
+            nel::elem::move(data_, o.data_, N);
+    24a6:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        /-> 4c 89 f6             	mov    %r14,%rsi
+    24a9:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   4c 89 ff             	mov    %r15,%rdi
+    24ac:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   ba 00 01 00 00       	mov    $0x100,%edx
+    24b1:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    24b6:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   e8 25 0f 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    24bb:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   4c 89 f7             	mov    %r14,%rdi
+    24be:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   ba 00 01 00 00       	mov    $0x100,%edx
+    24c3:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   be a5 00 00 00       	mov    $0xa5,%esi
+    24c8:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   e8 03 0f 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    24cd:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   48 8b 44 24 28       	mov    0x28(%rsp),%rax
+    24d2:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   49 81 c6 00 01 00 00 	add    $0x100,%r14
+    24d9:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   49 81 c7 00 01 00 00 	add    $0x100,%r15
+    24e0:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   48 83 c0 01          	add    $0x1,%rax
+    24e4:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   48 39 d8             	cmp    %rbx,%rax
+    24e7:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        \-- 75 bd                	jne    24a6 <ex42()+0x3e6>
+    24e9:	|  |  |  |  |  +--|--|--|--|--|--|--|--------------|-----------|----------- e9 f4 fe ff ff       	jmp    23e2 <ex42()+0x322>
+    24ee:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |            66 90                	xchg   %ax,%ax
+            nel::elem::set(data_, f, N);
+    24f0:	|  |  |  |  |  |  |  |  |  |  |  |  |     /--------|-----------|----------> 48 8d 5c 24 54       	lea    0x54(%rsp),%rbx
+    24f5:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            ba 00 01 00 00       	mov    $0x100,%edx
+    24fa:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            be 67 00 00 00       	mov    $0x67,%esi
+            : tag_(Tag::ERR)
+    24ff:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            c7 44 24 50 02 00 00 	movl   $0x2,0x50(%rsp)
+    2506:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            00 
+    2507:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            48 89 df             	mov    %rbx,%rdi
+    250a:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            e8 c1 0e 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            : fn_name_(fn_name)
+    250f:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            66 0f 6f 2c 24       	movdqa (%rsp),%xmm5
+    2514:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            8b 44 24 50          	mov    0x50(%rsp),%eax
+            , line_num_(line_num)
+    2518:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            c7 44 24 40 46 00 00 	movl   $0x46,0x40(%rsp)
+    251f:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            00 
+            : fn_name_(fn_name)
+    2520:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            0f 29 6c 24 30       	movaps %xmm5,0x30(%rsp)
+            switch (tag_) { // result<void>-match
+    2525:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            83 f8 01             	cmp    $0x1,%eax
+    2528:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |        /-- 74 1b                	je     2545 <ex42()+0x485>
+    252a:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |        |   83 f8 02             	cmp    $0x2,%eax
+    252d:	|  |  |  |  |  |  +--|--|--|--|--|--|-----|--------|-----------|--------|-- 0f 85 ad 02 00 00    	jne    27e0 <ex42()+0x720>
+            nel::elem::set(data_, 0xa5, N);
+    2533:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |        |   ba 00 01 00 00       	mov    $0x100,%edx
+    2538:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |        |   be a5 00 00 00       	mov    $0xa5,%esi
+    253d:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |        |   48 89 df             	mov    %rbx,%rdi
+    2540:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |        |   e8 8b 0e 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+                                    : std::realloc(p, new_size);
+    2545:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |        \-> bf 10 04 00 00       	mov    $0x410,%edi
+    254a:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            e8 61 eb ff ff       	call   10b0 <malloc@plt>
+    254f:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            49 89 c5             	mov    %rax,%r13
+            if (new_p == nullptr) {
+    2552:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            48 85 c0             	test   %rax,%rax
+    2555:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  /-----|-----------|----------- 0f 84 0b 03 00 00    	je     2866 <ex42()+0x7a6>
+            new_n->alloc_ = new_cap;
+    255b:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |           |            66 0f 6f 05 9d 1b 00 	movdqa 0x1b9d(%rip),%xmm0        # 4100 <_IO_stdin_used+0x100>
+    2562:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |           |            00 
+    2563:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |           |            0f 11 00             	movups %xmm0,(%rax)
+    2566:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |           |            b8 10 00 00 00       	mov    $0x10,%eax
+            nel::elem::set(data_, f, N);
+    256b:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |           \----------> 49 8d 7c 05 00       	lea    0x0(%r13,%rax,1),%rdi
+    2570:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |                        ba 00 01 00 00       	mov    $0x100,%edx
+    2575:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |                        be 68 00 00 00       	mov    $0x68,%esi
+    257a:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |                        e8 51 0e 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            len_ += 1;
+    257f:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |                        49 83 45 08 01       	addq   $0x1,0x8(%r13)
+            return len_;
+    2584:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     \----------------------> 49 8b 5d 08          	mov    0x8(%r13),%rbx
+            return alloc_;
+    2588:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                              49 8b 45 00          	mov    0x0(%r13),%rax
+            if (len() + n <= capacity()) { return true; }
+    258c:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                              48 8d 53 01          	lea    0x1(%rbx),%rdx
+    2590:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                              48 39 d0             	cmp    %rdx,%rax
+    2593:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           /----------------- 0f 83 e6 00 00 00    	jae    267f <ex42()+0x5bf>
+    2599:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |                  48 83 f8 03          	cmp    $0x3,%rax
+    259d:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |        /-------- 0f 87 59 01 00 00    	ja     26fc <ex42()+0x63c>
+    25a3:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |        |         b8 04 00 00 00       	mov    $0x4,%eax
+    25a8:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |        |         48 39 c2             	cmp    %rax,%rdx
+    25ab:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |        |         48 0f 42 d0          	cmovb  %rax,%rdx
+    25af:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |        |         48 39 da             	cmp    %rbx,%rdx
+    25b2:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |        |         48 0f 42 d3          	cmovb  %rbx,%rdx
+    25b6:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |        |         48 89 d5             	mov    %rdx,%rbp
+            if (new_cap > max_capacity) { return nullptr; }
+    25b9:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |     /--|-------> 48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    25c0:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |     |  |         ff 7f 00 
+    25c3:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |     |  |         48 39 e8             	cmp    %rbp,%rax
+    25c6:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     /-----|-----|--|-------- 0f 82 34 02 00 00    	jb     2800 <ex42()+0x740>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    25cc:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         48 89 ef             	mov    %rbp,%rdi
+    25cf:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         48 c1 e7 08          	shl    $0x8,%rdi
+    25d3:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         48 83 c7 10          	add    $0x10,%rdi
+                                    : std::realloc(p, new_size);
+    25d7:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         e8 d4 ea ff ff       	call   10b0 <malloc@plt>
+    25dc:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         49 89 c4             	mov    %rax,%r12
+            if (new_p == nullptr) {
+    25df:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         48 85 c0             	test   %rax,%rax
+    25e2:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     +-----|-----|--|-------- 0f 84 18 02 00 00    	je     2800 <ex42()+0x740>
+    25e8:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         66 0f 6f 6c 24 10    	movdqa 0x10(%rsp),%xmm5
+            , line_num_(line_num)
+    25ee:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         c7 44 24 60 91 00 00 	movl   $0x91,0x60(%rsp)
+    25f5:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         00 
+            : fn_name_(fn_name)
+    25f6:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         0f 29 6c 24 50       	movaps %xmm5,0x50(%rsp)
+    if (!pred) { assert_fail(msg, ctx); }
+    25fb:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         48 39 dd             	cmp    %rbx,%rbp
+    25fe:	|  |  |  |  |  |  |  |  |  +--|--|--|-----|--|-----|-----|-----|--|-------- 0f 82 a8 02 00 00    	jb     28ac <ex42()+0x7ec>
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    2604:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         4d 8d 75 10          	lea    0x10(%r13),%r14
+    2608:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         4c 8d 78 10          	lea    0x10(%rax),%r15
+                    new_n->len_ = old_n->len_;
+    260c:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         48 89 58 08          	mov    %rbx,0x8(%rax)
+    if (d == s) { return; }
+    2610:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         4d 39 fe             	cmp    %r15,%r14
+    2613:	|  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|-----|-----|-----|--|-------- 74 53                	je     2668 <ex42()+0x5a8>
+    } else if (d < s) {
+    2615:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |         4d 39 f7             	cmp    %r14,%r15
+    2618:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|-----|-----|--|-------- 0f 83 b2 02 00 00    	jae    28d0 <ex42()+0x810>
+        for (Index i = 0; i < n; ++i) {
+    261e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |         48 85 db             	test   %rbx,%rbx
+    2621:	|  |  |  |  |  |  |  |  |  |  |  |  |  +--|--|--|--|-----|-----|--|-------- 74 45                	je     2668 <ex42()+0x5a8>
+    2623:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |         31 c0                	xor    %eax,%eax
+            nel::elem::move(data_, o.data_, N);
+    2625:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     /-> 4c 89 f6             	mov    %r14,%rsi
+    2628:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   4c 89 ff             	mov    %r15,%rdi
+    262b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    2630:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    2635:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   e8 a6 0d 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    263a:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   4c 89 f7             	mov    %r14,%rdi
+    263d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    2642:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    2647:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   e8 84 0d 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    264c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    2651:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   49 81 c6 00 01 00 00 	add    $0x100,%r14
+    2658:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   49 81 c7 00 01 00 00 	add    $0x100,%r15
+    265f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   48 83 c0 01          	add    $0x1,%rax
+    2663:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   48 39 d8             	cmp    %rbx,%rax
+    2666:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     \-- 75 bd                	jne    2625 <ex42()+0x565>
+                std::free(p);
+    2668:	|  |  |  |  |  |  |  |  |  |  |  |  |  >--|--|--|--|-----|-----|--|-------> 4c 89 ef             	mov    %r13,%rdi
+                item_ = p;
+    266b:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |         4d 89 e5             	mov    %r12,%r13
+    266e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |         e8 bd e9 ff ff       	call   1030 <free@plt>
+            new_n->alloc_ = new_cap;
+    2673:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |         49 89 2c 24          	mov    %rbp,(%r12)
+            return len_;
+    2677:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |         49 8b 5c 24 08       	mov    0x8(%r12),%rbx
+    267c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |         48 89 e8             	mov    %rbp,%rax
+            if (len() >= capacity()) {
+    267f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     >-----|--|-------> 48 39 c3             	cmp    %rax,%rbx
+    2682:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|-----|--|-------- 0f 82 14 02 00 00    	jb     289c <ex42()+0x7dc>
+            nel::elem::set(data_, f, N);
+    2688:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 8d 5c 24 54       	lea    0x54(%rsp),%rbx
+    268d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         ba 00 01 00 00       	mov    $0x100,%edx
+    2692:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         be 69 00 00 00       	mov    $0x69,%esi
+            : tag_(Tag::ERR)
+    2697:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         c7 44 24 50 02 00 00 	movl   $0x2,0x50(%rsp)
+    269e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         00 
+    269f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 89 df             	mov    %rbx,%rdi
+    26a2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         e8 29 0d 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            : fn_name_(fn_name)
+    26a7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         66 0f 6f 1c 24       	movdqa (%rsp),%xmm3
+    26ac:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         8b 44 24 50          	mov    0x50(%rsp),%eax
+    26b0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         0f 29 5c 24 30       	movaps %xmm3,0x30(%rsp)
+            switch (tag_) { // result<void>-match
+    26b5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         83 f8 01             	cmp    $0x1,%eax
+    26b8:	|  |  |  |  |  |  |  |  |  |  |  |  +--|--|--|--|--|--|--|-----|--|-------- 0f 84 4f fb ff ff    	je     220d <ex42()+0x14d>
+            , line_num_(line_num)
+    26be:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|-------> c7 44 24 40 48 00 00 	movl   $0x48,0x40(%rsp)
+    26c5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         00 
+    26c6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         83 f8 02             	cmp    $0x2,%eax
+    26c9:	|  |  |  |  |  |  +--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-------- 0f 85 11 01 00 00    	jne    27e0 <ex42()+0x720>
+            nel::elem::set(data_, 0xa5, N);
+    26cf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         ba 00 01 00 00       	mov    $0x100,%edx
+    26d4:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         be a5 00 00 00       	mov    $0xa5,%esi
+    26d9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 df             	mov    %rbx,%rdi
+    26dc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 ef 0c 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return (item_ == nullptr) ? Slice<Type>::empty() : item_->slice();
+    26e1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /----> 4d 85 ed             	test   %r13,%r13
+    26e4:	|  |  |  |  |  |  |  |  |  |  |  |  \--|--|--|--|--|--|--|--|--|--|--|----- 0f 85 23 fb ff ff    	jne    220d <ex42()+0x14d>
+    26ea:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |      48 81 c4 68 01 00 00 	add    $0x168,%rsp
+    26f1:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |      5b                   	pop    %rbx
+    26f2:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |      5d                   	pop    %rbp
+    26f3:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |      41 5c                	pop    %r12
+    26f5:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |      41 5d                	pop    %r13
+    26f7:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |      41 5e                	pop    %r14
+    26f9:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |      41 5f                	pop    %r15
+    26fb:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |      c3                   	ret
+    26fc:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  \--|----> 48 8d 2c 00          	lea    (%rax,%rax,1),%rbp
+    2700:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |     |      48 39 d5             	cmp    %rdx,%rbp
+    2703:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |     |      48 0f 42 ea          	cmovb  %rdx,%rbp
+    2707:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |     |      48 39 dd             	cmp    %rbx,%rbp
+    270a:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |     |      48 0f 42 eb          	cmovb  %rbx,%rbp
+            } else if (new_cap == item_->capacity()) {
+    270e:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |     |      48 39 c5             	cmp    %rax,%rbp
+    2711:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  \--|--|-----|----- 0f 84 68 ff ff ff    	je     267f <ex42()+0x5bf>
+            } else if (new_cap > item_->capacity()) {
+    2717:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |  |     |      48 39 e8             	cmp    %rbp,%rax
+    271a:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |  \-----|----- 0f 82 99 fe ff ff    	jb     25b9 <ex42()+0x4f9>
+            if (new_cap > max_capacity) { return nullptr; }
+    2720:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    2727:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      ff 7f 00 
+    272a:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      48 39 e8             	cmp    %rbp,%rax
+    272d:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  +--|-----|--------|----- 0f 82 cd 00 00 00    	jb     2800 <ex42()+0x740>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    2733:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      48 89 ef             	mov    %rbp,%rdi
+    2736:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      48 c1 e7 08          	shl    $0x8,%rdi
+    273a:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      48 83 c7 10          	add    $0x10,%rdi
+                                    : std::realloc(p, new_size);
+    273e:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      e8 6d e9 ff ff       	call   10b0 <malloc@plt>
+    2743:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      49 89 c4             	mov    %rax,%r12
+            if (new_p == nullptr) {
+    2746:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      48 85 c0             	test   %rax,%rax
+    2749:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  +--|-----|--------|----- 0f 84 b1 00 00 00    	je     2800 <ex42()+0x740>
+            : fn_name_(fn_name)
+    274f:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      66 0f 6f 74 24 10    	movdqa 0x10(%rsp),%xmm6
+            , line_num_(line_num)
+    2755:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      c7 44 24 60 91 00 00 	movl   $0x91,0x60(%rsp)
+    275c:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      00 
+            : fn_name_(fn_name)
+    275d:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      0f 29 74 24 50       	movaps %xmm6,0x50(%rsp)
+    if (!pred) { assert_fail(msg, ctx); }
+    2762:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      48 39 dd             	cmp    %rbx,%rbp
+    2765:	|  |  |  |  |  |  |  |  |  +--|--|-----|--|--|--|--|--|-----|--------|----- 0f 82 41 01 00 00    	jb     28ac <ex42()+0x7ec>
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    276b:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      4d 8d 75 10          	lea    0x10(%r13),%r14
+    276f:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      4c 8d 78 10          	lea    0x10(%rax),%r15
+                    new_n->len_ = old_n->len_;
+    2773:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      48 89 58 08          	mov    %rbx,0x8(%rax)
+    if (d == s) { return; }
+    2777:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      4d 39 fe             	cmp    %r15,%r14
+    277a:	|  |  |  |  |  |  |  |  |  |  |  |     +--|--|--|--|--|-----|--------|----- 0f 84 e8 fe ff ff    	je     2668 <ex42()+0x5a8>
+    } else if (d < s) {
+    2780:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      4d 39 f7             	cmp    %r14,%r15
+    2783:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     /--|----- 0f 83 52 02 00 00    	jae    29db <ex42()+0x91b>
+        for (Index i = 0; i < n; ++i) {
+    2789:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |      48 85 db             	test   %rbx,%rbx
+    278c:	|  |  |  |  |  |  |  |  |  |  |  |     +--|--|--|--|--|-----|-----|--|----- 0f 84 d6 fe ff ff    	je     2668 <ex42()+0x5a8>
+    2792:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |      31 c0                	xor    %eax,%eax
+            nel::elem::move(data_, o.data_, N);
+    2794:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  /-> 4c 89 f6             	mov    %r14,%rsi
+    2797:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   4c 89 ff             	mov    %r15,%rdi
+    279a:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    279f:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    27a4:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   e8 37 0c 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    27a9:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   4c 89 f7             	mov    %r14,%rdi
+    27ac:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    27b1:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    27b6:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   e8 15 0c 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    27bb:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    27c0:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   49 81 c7 00 01 00 00 	add    $0x100,%r15
+    27c7:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   49 81 c6 00 01 00 00 	add    $0x100,%r14
+    27ce:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   48 83 c0 01          	add    $0x1,%rax
+    27d2:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   48 39 d8             	cmp    %rbx,%rax
+    27d5:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  \-- 75 bd                	jne    2794 <ex42()+0x6d4>
+    27d7:	|  |  |  |  |  |  |  |  |  |  |  |     +--|--|--|--|--|-----|-----|--|----- e9 8c fe ff ff       	jmp    2668 <ex42()+0x5a8>
+    27dc:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |      0f 1f 40 00          	nopl   0x0(%rax)
+                    nel::panic("bad Result", ctx);
+    27e0:	|  |  |  |  |  |  \--|--|--|--|--|-----|--|--|--|--|--|-----|-----|--|----> 48 8d 74 24 30       	lea    0x30(%rsp),%rsi
+            switch (tag_) { // result<void>-match
+    27e5:	|  |  |  |  |  |     |  |  |  |  |     |  |  |  |  |  |     |     |  |      85 c0                	test   %eax,%eax
+    27e7:	|  |  |  |  |  |     |  |  |  |  |     |  |  |  |  |  |     |     |  |  /-- 0f 84 d3 00 00 00    	je     28c0 <ex42()+0x800>
+                    nel::panic("bad Result", ctx);
+    27ed:	|  |  |  |  |  |     |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   48 8d 3d 38 18 00 00 	lea    0x1838(%rip),%rdi        # 402c <_IO_stdin_used+0x2c>
+    27f4:	|  |  |  |  |  |     |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   e8 29 e9 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    27f9:	|  |  |  |  |  |     |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    2800:	|  |  |  |  |  |     |  |  |  |  |     |  |  |  |  \--|-----|-----|--|--|-> 48 8d 5c 24 54       	lea    0x54(%rsp),%rbx
+            nel::elem::set(data_, f, N);
+    2805:	|  |  |  |  |  |     \--|--|--|--|-----|--|--|--|-----|-----|-----|--|--|-> ba 00 01 00 00       	mov    $0x100,%edx
+    280a:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     |     |  |  |   be 69 00 00 00       	mov    $0x69,%esi
+    280f:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     |     |  |  |   48 89 df             	mov    %rbx,%rdi
+            : tag_(Tag::ERR)
+    2812:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     |     |  |  |   c7 44 24 50 02 00 00 	movl   $0x2,0x50(%rsp)
+    2819:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     |     |  |  |   00 
+    281a:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     |     |  |  |   e8 b1 0b 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            : fn_name_(fn_name)
+    281f:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     |     |  |  |   66 0f 6f 3c 24       	movdqa (%rsp),%xmm7
+    2824:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     |     |  |  |   8b 44 24 50          	mov    0x50(%rsp),%eax
+    2828:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     |     |  |  |   0f 29 7c 24 30       	movaps %xmm7,0x30(%rsp)
+            switch (tag_) { // result<void>-match
+    282d:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     |     |  |  |   83 f8 01             	cmp    $0x1,%eax
+    2830:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     \-----|--|--|-- 0f 85 88 fe ff ff    	jne    26be <ex42()+0x5fe>
+    2836:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |           |  \--|-- e9 a6 fe ff ff       	jmp    26e1 <ex42()+0x621>
+                                    : std::realloc(p, new_size);
+    283b:	|  \--|--|--|--|--------|--|--|--|-----|--|--|--|-----|-----------|-----|-> bf 10 04 00 00       	mov    $0x410,%edi
+    2840:	|     |  |  |  |        |  |  |  |     |  |  |  |     |           |     |   e8 6b e8 ff ff       	call   10b0 <malloc@plt>
+    2845:	|     |  |  |  |        |  |  |  |     |  |  |  |     |           |     |   49 89 c5             	mov    %rax,%r13
+            if (new_p == nullptr) {
+    2848:	|     |  |  |  |        |  |  |  |     |  |  |  |     |           |     |   48 85 c0             	test   %rax,%rax
+    284b:	|     |  |  |  |        |  |  |  |     |  \--|--|-----|-----------|-----|-- 0f 84 9f fc ff ff    	je     24f0 <ex42()+0x430>
+            new_n->alloc_ = new_cap;
+    2851:	|     |  |  |  |        |  |  |  |     |     |  |     |           |     |   66 0f 6f 05 a7 18 00 	movdqa 0x18a7(%rip),%xmm0        # 4100 <_IO_stdin_used+0x100>
+    2858:	|     |  |  |  |        |  |  |  |     |     |  |     |           |     |   00 
+    2859:	|     |  |  |  |        |  |  |  |     |     |  |     |           |     |   0f 11 00             	movups %xmm0,(%rax)
+    285c:	\-----|--|--|--|--------|--|--|--|-----|-----|--|-----|-----------|-----|-- e9 d2 f8 ff ff       	jmp    2133 <ex42()+0x73>
+    2861:	      |  |  |  |        |  |  \--|-----|-----|--|-----|-----------|-----|-> 48 8d 5c 24 54       	lea    0x54(%rsp),%rbx
+    2866:	      |  |  |  |        |  |     |     |     \--|-----|-----------|-----|-> ba 00 01 00 00       	mov    $0x100,%edx
+    286b:	      |  |  |  |        |  |     |     |        |     |           |     |   be 68 00 00 00       	mov    $0x68,%esi
+    2870:	      |  |  |  |        |  |     |     |        |     |           |     |   48 89 df             	mov    %rbx,%rdi
+            : tag_(Tag::ERR)
+    2873:	      |  |  |  |        |  |     |     |        |     |           |     |   c7 44 24 50 02 00 00 	movl   $0x2,0x50(%rsp)
+    287a:	      |  |  |  |        |  |     |     |        |     |           |     |   00 
+    287b:	      |  |  |  |        |  |     |     |        |     |           |     |   e8 50 0b 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    2880:	      |  |  |  |        |  |     |     |        |     |           |     |   66 0f 6f 1c 24       	movdqa (%rsp),%xmm3
+    2885:	      |  |  |  |        |  |     |     |        |     |           |     |   8b 44 24 50          	mov    0x50(%rsp),%eax
+    2889:	      |  |  |  |        |  |     |     |        |     |           |     |   0f 29 5c 24 30       	movaps %xmm3,0x30(%rsp)
+            switch (tag_) { // result<void>-match
+    288e:	      |  |  |  |        |  |     |     |        |     |           |     |   83 f8 01             	cmp    $0x1,%eax
+    2891:	      \--|--|--|--------|--|-----|-----|--------|-----|-----------|-----|-- 0f 85 0b f9 ff ff    	jne    21a2 <ex42()+0xe2>
+    2897:	         \--|--|--------|--|-----|-----|--------|-----|-----------|-----|-- e9 29 f9 ff ff       	jmp    21c5 <ex42()+0x105>
+    289c:	            |  |        |  |     |     |        |     \-----------|-----|-> 48 89 d8             	mov    %rbx,%rax
+    289f:	            |  |        |  |     |     |        |                 |     |   48 c1 e0 08          	shl    $0x8,%rax
+    28a3:	            |  |        |  |     |     |        |                 |     |   48 83 c0 10          	add    $0x10,%rax
+    28a7:	            \--|--------|--|-----|-----|--------|-----------------|-----|-- e9 48 f9 ff ff       	jmp    21f4 <ex42()+0x134>
+    if (!pred) { assert_fail(msg, ctx); }
+    28ac:	               |        |  \-----|-----|--------|-----------------|-----|-> 48 8d 74 24 50       	lea    0x50(%rsp),%rsi
+    28b1:	               |        |        |     |        |                 |     |   48 8d 3d 10 18 00 00 	lea    0x1810(%rip),%rdi        # 40c8 <_IO_stdin_used+0xc8>
+    28b8:	               |        |        |     |        |                 |     |   e8 95 e8 ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    28bd:	               |        |        |     |        |                 |     |   0f 1f 00             	nopl   (%rax)
+                    nel::panic("invalid Result", ctx);
+    28c0:	               |        |        |     |        |                 |     \-> 48 8d 3d 56 17 00 00 	lea    0x1756(%rip),%rdi        # 401d <_IO_stdin_used+0x1d>
+    28c7:	               |        |        |     |        |                 |         e8 56 e8 ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    28cc:	               |        |        |     |        |                 |         0f 1f 40 00          	nopl   0x0(%rax)
+        for (Index i = n; i > 0; --i) {
+    28d0:	               |        |        |     |        \-----------------|-------> 48 85 db             	test   %rbx,%rbx
+    28d3:	               |        |        |     +--------------------------|-------- 0f 84 8f fd ff ff    	je     2668 <ex42()+0x5a8>
+    28d9:	               |        |        |     |                          |         49 89 de             	mov    %rbx,%r14
+    28dc:	               |        |        |     |                          |         49 c1 e6 08          	shl    $0x8,%r14
+    28e0:	               |        |        |     |                          |         49 81 ee f0 00 00 00 	sub    $0xf0,%r14
+    28e7:	               |        |        |     |                          |         4e 8d 3c 30          	lea    (%rax,%r14,1),%r15
+    28eb:	               |        |        |     |                          |         4d 01 ee             	add    %r13,%r14
+            nel::elem::move(data_, o.data_, N);
+    28ee:	               |        |        |     |                          |     /-> 4c 89 f6             	mov    %r14,%rsi
+    28f1:	               |        |        |     |                          |     |   4c 89 ff             	mov    %r15,%rdi
+    28f4:	               |        |        |     |                          |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    28f9:	               |        |        |     |                          |     |   49 81 ef 00 01 00 00 	sub    $0x100,%r15
+    2900:	               |        |        |     |                          |     |   e8 db 0a 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    2905:	               |        |        |     |                          |     |   4c 89 f7             	mov    %r14,%rdi
+    2908:	               |        |        |     |                          |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    290d:	               |        |        |     |                          |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    2912:	               |        |        |     |                          |     |   e8 b9 0a 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    2917:	               |        |        |     |                          |     |   49 81 ee 00 01 00 00 	sub    $0x100,%r14
+    291e:	               |        |        |     |                          |     |   48 83 eb 01          	sub    $0x1,%rbx
+    2922:	               |        |        |     |                          |     \-- 75 ca                	jne    28ee <ex42()+0x82e>
+    2924:	               |        |        |     +--------------------------|-------- e9 3f fd ff ff       	jmp    2668 <ex42()+0x5a8>
+    2929:	               |        \--------|-----|--------------------------|-------> 48 85 db             	test   %rbx,%rbx
+    292c:	               +-----------------|-----|--------------------------|-------- 0f 84 b0 fa ff ff    	je     23e2 <ex42()+0x322>
+    2932:	               |                 |     |                          |         49 89 de             	mov    %rbx,%r14
+    2935:	               |                 |     |                          |         49 c1 e6 08          	shl    $0x8,%r14
+    2939:	               |                 |     |                          |         49 81 ee f0 00 00 00 	sub    $0xf0,%r14
+    2940:	               |                 |     |                          |         4e 8d 3c 30          	lea    (%rax,%r14,1),%r15
+    2944:	               |                 |     |                          |         4d 01 ee             	add    %r13,%r14
+            nel::elem::move(data_, o.data_, N);
+    2947:	               |                 |     |                          |     /-> 4c 89 f6             	mov    %r14,%rsi
+    294a:	               |                 |     |                          |     |   4c 89 ff             	mov    %r15,%rdi
+    294d:	               |                 |     |                          |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    2952:	               |                 |     |                          |     |   49 81 ef 00 01 00 00 	sub    $0x100,%r15
+    2959:	               |                 |     |                          |     |   e8 82 0a 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    295e:	               |                 |     |                          |     |   4c 89 f7             	mov    %r14,%rdi
+    2961:	               |                 |     |                          |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    2966:	               |                 |     |                          |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    296b:	               |                 |     |                          |     |   e8 60 0a 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    2970:	               |                 |     |                          |     |   49 81 ee 00 01 00 00 	sub    $0x100,%r14
+    2977:	               |                 |     |                          |     |   48 83 eb 01          	sub    $0x1,%rbx
+    297b:	               |                 |     |                          |     \-- 75 ca                	jne    2947 <ex42()+0x887>
+    297d:	               +-----------------|-----|--------------------------|-------- e9 60 fa ff ff       	jmp    23e2 <ex42()+0x322>
+    2982:	               |                 \-----|--------------------------|-------> 48 85 db             	test   %rbx,%rbx
+    2985:	               +-----------------------|--------------------------|-------- 0f 84 57 fa ff ff    	je     23e2 <ex42()+0x322>
+    298b:	               |                       |                          |         49 89 de             	mov    %rbx,%r14
+    298e:	               |                       |                          |         49 c1 e6 08          	shl    $0x8,%r14
+    2992:	               |                       |                          |         49 81 ee f0 00 00 00 	sub    $0xf0,%r14
+    2999:	               |                       |                          |         4e 8d 3c 30          	lea    (%rax,%r14,1),%r15
+    299d:	               |                       |                          |         4d 01 ee             	add    %r13,%r14
+            nel::elem::move(data_, o.data_, N);
+    29a0:	               |                       |                          |     /-> 4c 89 f6             	mov    %r14,%rsi
+    29a3:	               |                       |                          |     |   4c 89 ff             	mov    %r15,%rdi
+    29a6:	               |                       |                          |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    29ab:	               |                       |                          |     |   49 81 ef 00 01 00 00 	sub    $0x100,%r15
+    29b2:	               |                       |                          |     |   e8 29 0a 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    29b7:	               |                       |                          |     |   4c 89 f7             	mov    %r14,%rdi
+    29ba:	               |                       |                          |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    29bf:	               |                       |                          |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    29c4:	               |                       |                          |     |   e8 07 0a 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    29c9:	               |                       |                          |     |   49 81 ee 00 01 00 00 	sub    $0x100,%r14
+    29d0:	               |                       |                          |     |   48 83 eb 01          	sub    $0x1,%rbx
+    29d4:	               |                       |                          |     \-- 75 ca                	jne    29a0 <ex42()+0x8e0>
+    29d6:	               \-----------------------|--------------------------|-------- e9 07 fa ff ff       	jmp    23e2 <ex42()+0x322>
+    29db:	                                       |                          \-------> 48 85 db             	test   %rbx,%rbx
+    29de:	                                       +----------------------------------- 0f 84 84 fc ff ff    	je     2668 <ex42()+0x5a8>
+    29e4:	                                       |                                    49 89 de             	mov    %rbx,%r14
+    29e7:	                                       |                                    49 c1 e6 08          	shl    $0x8,%r14
+    29eb:	                                       |                                    49 81 ee f0 00 00 00 	sub    $0xf0,%r14
+    29f2:	                                       |                                    4e 8d 3c 30          	lea    (%rax,%r14,1),%r15
+    29f6:	                                       |                                    4d 01 ee             	add    %r13,%r14
+            nel::elem::move(data_, o.data_, N);
+    29f9:	                                       |                                /-> 4c 89 f6             	mov    %r14,%rsi
+    29fc:	                                       |                                |   4c 89 ff             	mov    %r15,%rdi
+    29ff:	                                       |                                |   ba 00 01 00 00       	mov    $0x100,%edx
+    2a04:	                                       |                                |   49 81 ef 00 01 00 00 	sub    $0x100,%r15
+    2a0b:	                                       |                                |   e8 d0 09 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    2a10:	                                       |                                |   4c 89 f7             	mov    %r14,%rdi
+    2a13:	                                       |                                |   ba 00 01 00 00       	mov    $0x100,%edx
+    2a18:	                                       |                                |   be a5 00 00 00       	mov    $0xa5,%esi
+    2a1d:	                                       |                                |   e8 ae 09 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    2a22:	                                       |                                |   49 81 ee 00 01 00 00 	sub    $0x100,%r14
+    2a29:	                                       |                                |   48 83 eb 01          	sub    $0x1,%rbx
+    2a2d:	                                       |                                \-- 75 ca                	jne    29f9 <ex42()+0x939>
+    2a2f:	                                       \----------------------------------- e9 34 fc ff ff       	jmp    2668 <ex42()+0x5a8>
+    2a34:	                                                                            66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    2a3b:	                                                                            00 00 00 00 
+    2a3f:	                                                                            90                   	nop
+
+0000000000002a40 <ex43()>:
+{
+    2a40:	                                                                            41 57                	push   %r15
+    2a42:	                                                                            48 8d 05 5f 16 00 00 	lea    0x165f(%rip),%rax        # 40a8 <_IO_stdin_used+0xa8>
+                                    : std::realloc(p, new_size);
+    2a49:	                                                                            bf 10 05 00 00       	mov    $0x510,%edi
+    2a4e:	                                                                            48 8d 15 0a 16 00 00 	lea    0x160a(%rip),%rdx        # 405f <_IO_stdin_used+0x5f>
+    2a55:	                                                                            41 56                	push   %r14
+    2a57:	                                                                            66 48 0f 6e ca       	movq   %rdx,%xmm1
+    2a5c:	                                                                            66 48 0f 6e d8       	movq   %rax,%xmm3
+    2a61:	                                                                            48 8d 15 d8 15 00 00 	lea    0x15d8(%rip),%rdx        # 4040 <_IO_stdin_used+0x40>
+    2a68:	                                                                            41 55                	push   %r13
+    2a6a:	                                                                            48 8d 05 d7 15 00 00 	lea    0x15d7(%rip),%rax        # 4048 <_IO_stdin_used+0x48>
+    2a71:	                                                                            66 48 0f 6e d2       	movq   %rdx,%xmm2
+    2a76:	                                                                            66 0f 6c cb          	punpcklqdq %xmm3,%xmm1
+    2a7a:	                                                                            41 54                	push   %r12
+    2a7c:	                                                                            66 48 0f 6e e0       	movq   %rax,%xmm4
+    2a81:	                                                                            55                   	push   %rbp
+    2a82:	                                                                            66 0f 6c d4          	punpcklqdq %xmm4,%xmm2
+    2a86:	                                                                            53                   	push   %rbx
+    2a87:	                                                                            48 81 ec 68 01 00 00 	sub    $0x168,%rsp
+    2a8e:	                                                                            0f 29 0c 24          	movaps %xmm1,(%rsp)
+    2a92:	                                                                            0f 29 54 24 10       	movaps %xmm2,0x10(%rsp)
+    2a97:	                                                                            e8 14 e6 ff ff       	call   10b0 <malloc@plt>
+            if (new_p == nullptr) {
+    2a9c:	                                                                            48 85 c0             	test   %rax,%rax
+    2a9f:	   /----------------------------------------------------------------------- 0f 84 16 07 00 00    	je     31bb <ex43()+0x77b>
+    2aa5:	   |                                                                        66 0f 6f 05 43 16 00 	movdqa 0x1643(%rip),%xmm0        # 40f0 <_IO_stdin_used+0xf0>
+    2aac:	   |                                                                        00 
+    2aad:	   |                                                                        49 89 c5             	mov    %rax,%r13
+    2ab0:	   |                                                                        0f 11 00             	movups %xmm0,(%rax)
+            nel::elem::set(data_, f, N);
+    2ab3:	/--|----------------------------------------------------------------------> 4d 8d 75 10          	lea    0x10(%r13),%r14
+    2ab7:	|  |                                                                        ba 00 01 00 00       	mov    $0x100,%edx
+    2abc:	|  |                                                                        be 67 00 00 00       	mov    $0x67,%esi
+    2ac1:	|  |                                                                        4c 89 f7             	mov    %r14,%rdi
+    2ac4:	|  |                                                                        e8 07 09 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            len_ += 1;
+    2ac9:	|  |                                                                        49 83 45 08 01       	addq   $0x1,0x8(%r13)
+            return len_;
+    2ace:	|  |                                                                        49 8b 5d 08          	mov    0x8(%r13),%rbx
+            return alloc_;
+    2ad2:	|  |                                                                        49 8b 45 00          	mov    0x0(%r13),%rax
+            if (len() + n <= capacity()) { return true; }
+    2ad6:	|  |                                                                        48 8d 53 01          	lea    0x1(%rbx),%rdx
+    2ada:	|  |                                                                        48 39 d0             	cmp    %rdx,%rax
+    2add:	|  |                                                           /----------- 0f 82 b4 01 00 00    	jb     2c97 <ex43()+0x257>
+            if (len() >= capacity()) {
+    2ae3:	|  |                                                  /--------|----------> 48 39 c3             	cmp    %rax,%rbx
+    2ae6:	|  |                                                  |  /-----|----------- 0f 82 96 02 00 00    	jb     2d82 <ex43()+0x342>
+    2aec:	|  |                                                  |  |  /--|----------> 48 8d 5c 24 54       	lea    0x54(%rsp),%rbx
+    2af1:	|  |                                                  |  |  |  |            ba 00 01 00 00       	mov    $0x100,%edx
+    2af6:	|  |                                                  |  |  |  |            be 68 00 00 00       	mov    $0x68,%esi
+            : tag_(Tag::ERR)
+    2afb:	|  |                                                  |  |  |  |            c7 44 24 50 02 00 00 	movl   $0x2,0x50(%rsp)
+    2b02:	|  |                                                  |  |  |  |            00 
+    2b03:	|  |                                                  |  |  |  |            48 89 df             	mov    %rbx,%rdi
+    2b06:	|  |                                                  |  |  |  |            e8 c5 08 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            : fn_name_(fn_name)
+    2b0b:	|  |                                                  |  |  |  |            66 0f 6f 24 24       	movdqa (%rsp),%xmm4
+    2b10:	|  |                                                  |  |  |  |            8b 44 24 50          	mov    0x50(%rsp),%eax
+    2b14:	|  |                                                  |  |  |  |            0f 29 64 24 30       	movaps %xmm4,0x30(%rsp)
+            switch (tag_) { // result<void>-match
+    2b19:	|  |                                                  |  |  |  |            83 f8 01             	cmp    $0x1,%eax
+    2b1c:	|  |                                               /--|--|--|--|----------- 0f 84 e2 03 00 00    	je     2f04 <ex43()+0x4c4>
+            , line_num_(line_num)
+    2b22:	|  |  /--------------------------------------------|--|--|--|--|----------> c7 44 24 40 53 00 00 	movl   $0x53,0x40(%rsp)
+    2b29:	|  |  |                                            |  |  |  |  |            00 
+    2b2a:	|  |  |                                            |  |  |  |  |            83 f8 02             	cmp    $0x2,%eax
+    2b2d:	|  |  |           /--------------------------------|--|--|--|--|----------- 0f 85 2d 06 00 00    	jne    3160 <ex43()+0x720>
+            nel::elem::set(data_, 0xa5, N);
+    2b33:	|  |  |           |                                |  |  |  |  |            ba 00 01 00 00       	mov    $0x100,%edx
+    2b38:	|  |  |           |                                |  |  |  |  |            be a5 00 00 00       	mov    $0xa5,%esi
+    2b3d:	|  |  |           |                                |  |  |  |  |            48 89 df             	mov    %rbx,%rdi
+    2b40:	|  |  |           |                                |  |  |  |  |            e8 8b 08 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return (item_ == nullptr) ? 0 : item_->len();
+    2b45:	|  |  |  /--------|--------------------------------|--|--|--|--|----------> 4d 85 ed             	test   %r13,%r13
+    2b48:	|  |  |  |        |                                +--|--|--|--|----------- 0f 85 b6 03 00 00    	jne    2f04 <ex43()+0x4c4>
+                                    : std::realloc(p, new_size);
+    2b4e:	|  |  |  |        |                                |  |  |  |  |            bf 10 04 00 00       	mov    $0x410,%edi
+    2b53:	|  |  |  |        |                                |  |  |  |  |            e8 58 e5 ff ff       	call   10b0 <malloc@plt>
+    2b58:	|  |  |  |        |                                |  |  |  |  |            49 89 c5             	mov    %rax,%r13
+            if (new_p == nullptr) {
+    2b5b:	|  |  |  |        |                                |  |  |  |  |            48 85 c0             	test   %rax,%rax
+    2b5e:	|  |  |  |        |  /-----------------------------|--|--|--|--|----------- 0f 84 21 06 00 00    	je     3185 <ex43()+0x745>
+            new_n->alloc_ = new_cap;
+    2b64:	|  |  |  |        |  |                             |  |  |  |  |            66 0f 6f 05 94 15 00 	movdqa 0x1594(%rip),%xmm0        # 4100 <_IO_stdin_used+0x100>
+    2b6b:	|  |  |  |        |  |                             |  |  |  |  |            00 
+    2b6c:	|  |  |  |        |  |                             |  |  |  |  |            0f 11 00             	movups %xmm0,(%rax)
+    2b6f:	|  |  |  |        |  |                             |  |  |  |  |            b8 10 00 00 00       	mov    $0x10,%eax
+            nel::elem::set(data_, f, N);
+    2b74:	|  |  |  |  /-----|--|-----------------------------|--|--|--|--|----------> 49 8d 7c 05 00       	lea    0x0(%r13,%rax,1),%rdi
+    2b79:	|  |  |  |  |     |  |                             |  |  |  |  |            ba 00 01 00 00       	mov    $0x100,%edx
+    2b7e:	|  |  |  |  |     |  |                             |  |  |  |  |            be 69 00 00 00       	mov    $0x69,%esi
+    2b83:	|  |  |  |  |     |  |                             |  |  |  |  |            e8 48 08 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            len_ += 1;
+    2b88:	|  |  |  |  |     |  |                             |  |  |  |  |            49 83 45 08 01       	addq   $0x1,0x8(%r13)
+            return len_;
+    2b8d:	|  |  |  |  |     |  |              /--------------|--|--|--|--|----------> 49 8b 45 08          	mov    0x8(%r13),%rax
+            return Slice(values_, len());
+    2b91:	|  |  |  |  |     |  |              |              |  |  |  |  |            4d 8d 75 10          	lea    0x10(%r13),%r14
+    2b95:	|  |  |  |  |     |  |              |              |  |  |  |  |            48 89 c2             	mov    %rax,%rdx
+    2b98:	|  |  |  |  |     |  |              |              |  |  |  |  |            48 c1 e2 08          	shl    $0x8,%rdx
+    2b9c:	|  |  |  |  |     |  |              |              |  |  |  |  |            49 8d 0c 16          	lea    (%r14,%rdx,1),%rcx
+    2ba0:	|  |  |  |  |     |  |              |              |  |  |  |  |            48 89 0c 24          	mov    %rcx,(%rsp)
+    for (; !it.is_done(); it.inc()) {
+    2ba4:	|  |  |  |  |     |  |              |              |  |  |  |  |            49 39 ce             	cmp    %rcx,%r14
+    2ba7:	|  |  |  |  |     |  |              |              |  |  |  |  |  /-------- 0f 84 a7 00 00 00    	je     2c54 <ex43()+0x214>
+    2bad:	|  |  |  |  |     |  |              |              |  |  |  |  |  |         49 8d ad 10 01 00 00 	lea    0x110(%r13),%rbp
+    2bb4:	|  |  |  |  |     |  |              |              |  |  |  |  |  |         4c 8d 25 ce 34 00 00 	lea    0x34ce(%rip),%r12        # 6089 <nel::log>
+            outs << "U8Buf<" << val.len() << ">{";
+    2bbb:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  /----> 48 8d 35 4d 14 00 00 	lea    0x144d(%rip),%rsi        # 400f <_IO_stdin_used+0xf>
+    2bc2:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      4c 89 e7             	mov    %r12,%rdi
+    2bc5:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      49 89 ef             	mov    %rbp,%r15
+    2bc8:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      e8 93 10 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+    2bcd:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      be 00 01 00 00       	mov    $0x100,%esi
+    2bd2:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      48 8d 9d 01 ff ff ff 	lea    -0xff(%rbp),%rbx
+    2bd9:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    2bdc:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      e8 3f 11 00 00       	call   3d20 <nel::operator<<(nel::Log&, unsigned long)>
+    2be1:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      48 8d 35 2e 14 00 00 	lea    0x142e(%rip),%rsi        # 4016 <_IO_stdin_used+0x16>
+    2be8:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      48 89 c7             	mov    %rax,%rdi
+    2beb:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      e8 70 10 00 00       	call   3c60 <nel::operator<<(nel::Log&, char const*)>
+                outs << val.data_[0];
+    2bf0:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      0f b6 b5 00 ff ff ff 	movzbl -0x100(%rbp),%esi
+    2bf7:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      4c 89 e7             	mov    %r12,%rdi
+    2bfa:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      e8 81 10 00 00       	call   3c80 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    2bff:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      90                   	nop
+                    outs << ' ' << val.data_[i];
+    2c00:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |  /-> be 20 00 00 00       	mov    $0x20,%esi
+    2c05:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |  |   4c 89 e7             	mov    %r12,%rdi
+                for (Index i = 1; i < val.len(); ++i) {
+    2c08:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |  |   48 83 c3 01          	add    $0x1,%rbx
+                    outs << ' ' << val.data_[i];
+    2c0c:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |  |   e8 2f 10 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    2c11:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |  |   0f b6 73 ff          	movzbl -0x1(%rbx),%esi
+    2c15:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |  |   48 89 c7             	mov    %rax,%rdi
+    2c18:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |  |   e8 63 10 00 00       	call   3c80 <nel::operator<<(nel::Log&, unsigned char)>
+                for (Index i = 1; i < val.len(); ++i) {
+    2c1d:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |  |   48 39 dd             	cmp    %rbx,%rbp
+    2c20:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |  \-- 75 de                	jne    2c00 <ex43()+0x1c0>
+            outs << '}';
+    2c22:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      be 7d 00 00 00       	mov    $0x7d,%esi
+    2c27:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      4c 89 e7             	mov    %r12,%rdi
+    2c2a:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      48 81 c5 00 01 00 00 	add    $0x100,%rbp
+    2c31:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      e8 0a 10 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+        nel::log << e << '\n';
+    2c36:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      be 0a 00 00 00       	mov    $0xa,%esi
+    2c3b:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      4c 89 e7             	mov    %r12,%rdi
+    2c3e:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      e8 fd 0f 00 00       	call   3c40 <nel::operator<<(nel::Log&, char)>
+    for (; !it.is_done(); it.inc()) {
+    2c43:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      48 8b 04 24          	mov    (%rsp),%rax
+    2c47:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  |      49 39 c7             	cmp    %rax,%r15
+    2c4a:	|  |  |  |  |     |  |              |              |  |  |  |  |  |  \----- 0f 85 6b ff ff ff    	jne    2bbb <ex43()+0x17b>
+            return len_;
+    2c50:	|  |  |  |  |     |  |              |              |  |  |  |  |  |         49 8b 45 08          	mov    0x8(%r13),%rax
+            for (Index i = 0; i < len(); ++i) {
+    2c54:	|  |  |  |  |     |  |              |              |  |  |  |  |  \-------> 31 db                	xor    %ebx,%ebx
+    2c56:	|  |  |  |  |     |  |              |              |  |  |  |  |            48 85 c0             	test   %rax,%rax
+    2c59:	|  |  |  |  |     |  |              |              |  |  |  |  |     /----- 74 23                	je     2c7e <ex43()+0x23e>
+            nel::elem::set(data_, 0xa5, N);
+    2c5b:	|  |  |  |  |     |  |              |              |  |  |  |  |     |  /-> 4c 89 f7             	mov    %r14,%rdi
+    2c5e:	|  |  |  |  |     |  |              |              |  |  |  |  |     |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    2c63:	|  |  |  |  |     |  |              |              |  |  |  |  |     |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    2c68:	|  |  |  |  |     |  |              |              |  |  |  |  |     |  |   48 83 c3 01          	add    $0x1,%rbx
+    2c6c:	|  |  |  |  |     |  |              |              |  |  |  |  |     |  |   e8 5f 07 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    2c71:	|  |  |  |  |     |  |              |              |  |  |  |  |     |  |   49 81 c6 00 01 00 00 	add    $0x100,%r14
+    2c78:	|  |  |  |  |     |  |              |              |  |  |  |  |     |  |   49 3b 5d 08          	cmp    0x8(%r13),%rbx
+    2c7c:	|  |  |  |  |     |  |              |              |  |  |  |  |     |  \-- 72 dd                	jb     2c5b <ex43()+0x21b>
+}
+    2c7e:	|  |  |  |  |     |  |              |              |  |  |  |  |     \----> 48 81 c4 68 01 00 00 	add    $0x168,%rsp
+                std::free(p);
+    2c85:	|  |  |  |  |     |  |              |              |  |  |  |  |            4c 89 ef             	mov    %r13,%rdi
+    2c88:	|  |  |  |  |     |  |              |              |  |  |  |  |            5b                   	pop    %rbx
+    2c89:	|  |  |  |  |     |  |              |              |  |  |  |  |            5d                   	pop    %rbp
+    2c8a:	|  |  |  |  |     |  |              |              |  |  |  |  |            41 5c                	pop    %r12
+    2c8c:	|  |  |  |  |     |  |              |              |  |  |  |  |            41 5d                	pop    %r13
+    2c8e:	|  |  |  |  |     |  |              |              |  |  |  |  |            41 5e                	pop    %r14
+    2c90:	|  |  |  |  |     |  |              |              |  |  |  |  |            41 5f                	pop    %r15
+    2c92:	|  |  |  |  |     |  |              |              |  |  |  |  |            e9 99 e3 ff ff       	jmp    1030 <free@plt>
+    2c97:	|  |  |  |  |     |  |              |              |  |  |  |  \----------> 48 83 f8 03          	cmp    $0x3,%rax
+    2c9b:	|  |  |  |  |     |  |              |              |  |  |  |        /----- 0f 87 f1 00 00 00    	ja     2d92 <ex43()+0x352>
+    2ca1:	|  |  |  |  |     |  |              |              |  |  |  |        |      b8 04 00 00 00       	mov    $0x4,%eax
+    2ca6:	|  |  |  |  |     |  |              |              |  |  |  |        |      48 39 c2             	cmp    %rax,%rdx
+    2ca9:	|  |  |  |  |     |  |              |              |  |  |  |        |      48 0f 42 d0          	cmovb  %rax,%rdx
+    2cad:	|  |  |  |  |     |  |              |              |  |  |  |        |      48 39 da             	cmp    %rbx,%rdx
+    2cb0:	|  |  |  |  |     |  |              |              |  |  |  |        |      48 0f 42 d3          	cmovb  %rbx,%rdx
+    2cb4:	|  |  |  |  |     |  |              |              |  |  |  |        |      48 89 d5             	mov    %rdx,%rbp
+            if (new_cap > max_capacity) { return nullptr; }
+    2cb7:	|  |  |  |  |     |  |              |              |  |  |  |     /--|----> 48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    2cbe:	|  |  |  |  |     |  |              |              |  |  |  |     |  |      ff 7f 00 
+    2cc1:	|  |  |  |  |     |  |              |              |  |  |  |     |  |      48 39 e8             	cmp    %rbp,%rax
+    2cc4:	|  |  |  |  |     |  |        /-----|--------------|--|--|--|-----|--|----- 0f 82 17 05 00 00    	jb     31e1 <ex43()+0x7a1>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    2cca:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      48 89 ef             	mov    %rbp,%rdi
+    2ccd:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      48 c1 e7 08          	shl    $0x8,%rdi
+    2cd1:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      48 83 c7 10          	add    $0x10,%rdi
+                                    : std::realloc(p, new_size);
+    2cd5:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      e8 d6 e3 ff ff       	call   10b0 <malloc@plt>
+    2cda:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      49 89 c4             	mov    %rax,%r12
+            if (new_p == nullptr) {
+    2cdd:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      48 85 c0             	test   %rax,%rax
+    2ce0:	|  |  |  |  |     |  |        +-----|--------------|--|--|--|-----|--|----- 0f 84 fb 04 00 00    	je     31e1 <ex43()+0x7a1>
+            : fn_name_(fn_name)
+    2ce6:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      66 0f 6f 74 24 10    	movdqa 0x10(%rsp),%xmm6
+            , line_num_(line_num)
+    2cec:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      c7 44 24 60 91 00 00 	movl   $0x91,0x60(%rsp)
+    2cf3:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      00 
+            : fn_name_(fn_name)
+    2cf4:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      0f 29 74 24 50       	movaps %xmm6,0x50(%rsp)
+    if (!pred) { assert_fail(msg, ctx); }
+    2cf9:	|  |  |  |  |     |  |        |     |              |  |  |  |     |  |      48 39 dd             	cmp    %rbx,%rbp
+    2cfc:	|  |  |  |  |     |  |     /--|-----|--------------|--|--|--|-----|--|----- 0f 82 2a 05 00 00    	jb     322c <ex43()+0x7ec>
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    2d02:	|  |  |  |  |     |  |     |  |     |              |  |  |  |     |  |      4c 8d 78 10          	lea    0x10(%rax),%r15
+                    new_n->len_ = old_n->len_;
+    2d06:	|  |  |  |  |     |  |     |  |     |              |  |  |  |     |  |      48 89 58 08          	mov    %rbx,0x8(%rax)
+    if (d == s) { return; }
+    2d0a:	|  |  |  |  |     |  |     |  |     |              |  |  |  |     |  |      4d 39 fe             	cmp    %r15,%r14
+    2d0d:	|  |  |  |  |  /--|--|-----|--|-----|--------------|--|--|--|-----|--|----- 74 53                	je     2d62 <ex43()+0x322>
+    } else if (d < s) {
+    2d0f:	|  |  |  |  |  |  |  |     |  |     |              |  |  |  |     |  |      4d 39 f7             	cmp    %r14,%r15
+    2d12:	|  |  |  |  |  |  |  |  /--|--|-----|--------------|--|--|--|-----|--|----- 0f 83 91 05 00 00    	jae    32a9 <ex43()+0x869>
+        for (Index i = 0; i < n; ++i) {
+    2d18:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |      48 85 db             	test   %rbx,%rbx
+    2d1b:	|  |  |  |  |  +--|--|--|--|--|-----|--------------|--|--|--|-----|--|----- 74 45                	je     2d62 <ex43()+0x322>
+    2d1d:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |      31 c0                	xor    %eax,%eax
+            nel::elem::move(data_, o.data_, N);
+    2d1f:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  /-> 4c 89 f6             	mov    %r14,%rsi
+    2d22:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   4c 89 ff             	mov    %r15,%rdi
+    2d25:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    2d2a:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    2d2f:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   e8 ac 06 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    2d34:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   4c 89 f7             	mov    %r14,%rdi
+    2d37:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    2d3c:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    2d41:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   e8 8a 06 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    2d46:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   48 8b 44 24 28       	mov    0x28(%rsp),%rax
+    2d4b:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   49 81 c6 00 01 00 00 	add    $0x100,%r14
+    2d52:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   49 81 c7 00 01 00 00 	add    $0x100,%r15
+    2d59:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   48 83 c0 01          	add    $0x1,%rax
+    2d5d:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  |   48 39 d8             	cmp    %rbx,%rax
+    2d60:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |  \-- 75 bd                	jne    2d1f <ex43()+0x2df>
+                std::free(p);
+    2d62:	|  |  |  |  |  >--|--|--|--|--|-----|--------------|--|--|--|-----|--|----> 4c 89 ef             	mov    %r13,%rdi
+                item_ = p;
+    2d65:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |      4d 89 e5             	mov    %r12,%r13
+    2d68:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |      e8 c3 e2 ff ff       	call   1030 <free@plt>
+            return len_;
+    2d6d:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |      49 8b 5c 24 08       	mov    0x8(%r12),%rbx
+    2d72:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |      48 89 e8             	mov    %rbp,%rax
+            new_n->alloc_ = new_cap;
+    2d75:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |      49 89 2c 24          	mov    %rbp,(%r12)
+            if (len() >= capacity()) {
+    2d79:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  |     |  |      48 39 c3             	cmp    %rax,%rbx
+    2d7c:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  |  \-----|--|----- 0f 83 6a fd ff ff    	jae    2aec <ex43()+0xac>
+    2d82:	|  |  |  |  |  |  |  |  |  |  |     |              |  |  \--------|--|----> 48 89 d8             	mov    %rbx,%rax
+    2d85:	|  |  |  |  |  |  |  |  |  |  |     |              |  |           |  |      48 c1 e0 08          	shl    $0x8,%rax
+    2d89:	|  |  |  |  |  |  |  |  |  |  |     |              |  |           |  |      48 83 c0 10          	add    $0x10,%rax
+    2d8d:	|  |  |  |  |  |  |  |  |  |  |     |              |  |        /--|--|----- e9 59 01 00 00       	jmp    2eeb <ex43()+0x4ab>
+    2d92:	|  |  |  |  |  |  |  |  |  |  |     |              |  |        |  |  \----> 48 8d 2c 00          	lea    (%rax,%rax,1),%rbp
+    2d96:	|  |  |  |  |  |  |  |  |  |  |     |              |  |        |  |         48 39 d5             	cmp    %rdx,%rbp
+    2d99:	|  |  |  |  |  |  |  |  |  |  |     |              |  |        |  |         48 0f 42 ea          	cmovb  %rdx,%rbp
+    2d9d:	|  |  |  |  |  |  |  |  |  |  |     |              |  |        |  |         48 39 dd             	cmp    %rbx,%rbp
+    2da0:	|  |  |  |  |  |  |  |  |  |  |     |              |  |        |  |         48 0f 42 eb          	cmovb  %rbx,%rbp
+            } else if (new_cap == item_->capacity()) {
+    2da4:	|  |  |  |  |  |  |  |  |  |  |     |              |  |        |  |         48 39 c5             	cmp    %rax,%rbp
+    2da7:	|  |  |  |  |  |  |  |  |  |  |     |              |  \--------|--|-------- 0f 84 36 fd ff ff    	je     2ae3 <ex43()+0xa3>
+            } else if (new_cap > item_->capacity()) {
+    2dad:	|  |  |  |  |  |  |  |  |  |  |     |              |           |  |         48 39 e8             	cmp    %rbp,%rax
+    2db0:	|  |  |  |  |  |  |  |  |  |  |     |              |           |  \-------- 0f 82 01 ff ff ff    	jb     2cb7 <ex43()+0x277>
+            if (new_cap > max_capacity) { return nullptr; }
+    2db6:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    2dbd:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            ff 7f 00 
+    2dc0:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            48 39 e8             	cmp    %rbp,%rax
+    2dc3:	|  |  |  |  |  |  |  |  |  |  +-----|--------------|-----------|----------- 0f 82 18 04 00 00    	jb     31e1 <ex43()+0x7a1>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    2dc9:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            48 89 ef             	mov    %rbp,%rdi
+    2dcc:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            48 c1 e7 08          	shl    $0x8,%rdi
+    2dd0:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            48 83 c7 10          	add    $0x10,%rdi
+                                    : std::realloc(p, new_size);
+    2dd4:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            e8 d7 e2 ff ff       	call   10b0 <malloc@plt>
+    2dd9:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            49 89 c4             	mov    %rax,%r12
+            if (new_p == nullptr) {
+    2ddc:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            48 85 c0             	test   %rax,%rax
+    2ddf:	|  |  |  |  |  |  |  |  |  |  +-----|--------------|-----------|----------- 0f 84 fc 03 00 00    	je     31e1 <ex43()+0x7a1>
+            : fn_name_(fn_name)
+    2de5:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            66 0f 6f 7c 24 10    	movdqa 0x10(%rsp),%xmm7
+            , line_num_(line_num)
+    2deb:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            c7 44 24 60 91 00 00 	movl   $0x91,0x60(%rsp)
+    2df2:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            00 
+            : fn_name_(fn_name)
+    2df3:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            0f 29 7c 24 50       	movaps %xmm7,0x50(%rsp)
+    if (!pred) { assert_fail(msg, ctx); }
+    2df8:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            48 39 dd             	cmp    %rbx,%rbp
+    2dfb:	|  |  |  |  |  |  |  |  |  +--|-----|--------------|-----------|----------- 0f 82 2b 04 00 00    	jb     322c <ex43()+0x7ec>
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    2e01:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            4c 8d 78 10          	lea    0x10(%rax),%r15
+                    new_n->len_ = old_n->len_;
+    2e05:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            48 89 58 08          	mov    %rbx,0x8(%rax)
+    if (d == s) { return; }
+    2e09:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            4d 39 fe             	cmp    %r15,%r14
+    2e0c:	|  |  |  |  |  +--|--|--|--|--|-----|--------------|-----------|----------- 0f 84 50 ff ff ff    	je     2d62 <ex43()+0x322>
+    } else if (d < s) {
+    2e12:	|  |  |  |  |  |  |  |  |  |  |     |              |           |            4d 39 f7             	cmp    %r14,%r15
+    2e15:	|  |  |  |  |  |  |  |  |  |  |  /--|--------------|-----------|----------- 0f 83 e7 04 00 00    	jae    3302 <ex43()+0x8c2>
+        for (Index i = 0; i < n; ++i) {
+    2e1b:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |            48 85 db             	test   %rbx,%rbx
+    2e1e:	|  |  |  |  |  +--|--|--|--|--|--|--|--------------|-----------|----------- 0f 84 3e ff ff ff    	je     2d62 <ex43()+0x322>
+    2e24:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |            31 c0                	xor    %eax,%eax
+            nel::elem::move(data_, o.data_, N);
+    2e26:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        /-> 4c 89 f6             	mov    %r14,%rsi
+    2e29:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   4c 89 ff             	mov    %r15,%rdi
+    2e2c:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   ba 00 01 00 00       	mov    $0x100,%edx
+    2e31:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   48 89 44 24 28       	mov    %rax,0x28(%rsp)
+    2e36:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   e8 a5 05 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    2e3b:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   4c 89 f7             	mov    %r14,%rdi
+    2e3e:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   ba 00 01 00 00       	mov    $0x100,%edx
+    2e43:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   be a5 00 00 00       	mov    $0xa5,%esi
+    2e48:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   e8 83 05 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    2e4d:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   48 8b 44 24 28       	mov    0x28(%rsp),%rax
+    2e52:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   49 81 c6 00 01 00 00 	add    $0x100,%r14
+    2e59:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   49 81 c7 00 01 00 00 	add    $0x100,%r15
+    2e60:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   48 83 c0 01          	add    $0x1,%rax
+    2e64:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        |   48 39 d8             	cmp    %rbx,%rax
+    2e67:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |        \-- 75 bd                	jne    2e26 <ex43()+0x3e6>
+    2e69:	|  |  |  |  |  +--|--|--|--|--|--|--|--------------|-----------|----------- e9 f4 fe ff ff       	jmp    2d62 <ex43()+0x322>
+    2e6e:	|  |  |  |  |  |  |  |  |  |  |  |  |              |           |            66 90                	xchg   %ax,%ax
+            nel::elem::set(data_, f, N);
+    2e70:	|  |  |  |  |  |  |  |  |  |  |  |  |     /--------|-----------|----------> 48 8d 5c 24 54       	lea    0x54(%rsp),%rbx
+    2e75:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            ba 00 01 00 00       	mov    $0x100,%edx
+    2e7a:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            be 67 00 00 00       	mov    $0x67,%esi
+            : tag_(Tag::ERR)
+    2e7f:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            c7 44 24 50 02 00 00 	movl   $0x2,0x50(%rsp)
+    2e86:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            00 
+    2e87:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            48 89 df             	mov    %rbx,%rdi
+    2e8a:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            e8 41 05 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            : fn_name_(fn_name)
+    2e8f:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            66 0f 6f 2c 24       	movdqa (%rsp),%xmm5
+    2e94:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            8b 44 24 50          	mov    0x50(%rsp),%eax
+            , line_num_(line_num)
+    2e98:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            c7 44 24 40 52 00 00 	movl   $0x52,0x40(%rsp)
+    2e9f:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            00 
+            : fn_name_(fn_name)
+    2ea0:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            0f 29 6c 24 30       	movaps %xmm5,0x30(%rsp)
+            switch (tag_) { // result<void>-match
+    2ea5:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            83 f8 01             	cmp    $0x1,%eax
+    2ea8:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |        /-- 74 1b                	je     2ec5 <ex43()+0x485>
+    2eaa:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |        |   83 f8 02             	cmp    $0x2,%eax
+    2ead:	|  |  |  |  |  |  +--|--|--|--|--|--|-----|--------|-----------|--------|-- 0f 85 ad 02 00 00    	jne    3160 <ex43()+0x720>
+            nel::elem::set(data_, 0xa5, N);
+    2eb3:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |        |   ba 00 01 00 00       	mov    $0x100,%edx
+    2eb8:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |        |   be a5 00 00 00       	mov    $0xa5,%esi
+    2ebd:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |        |   48 89 df             	mov    %rbx,%rdi
+    2ec0:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |        |   e8 0b 05 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+                                    : std::realloc(p, new_size);
+    2ec5:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |        \-> bf 10 04 00 00       	mov    $0x410,%edi
+    2eca:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            e8 e1 e1 ff ff       	call   10b0 <malloc@plt>
+    2ecf:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            49 89 c5             	mov    %rax,%r13
+            if (new_p == nullptr) {
+    2ed2:	|  |  |  |  |  |  |  |  |  |  |  |  |     |        |           |            48 85 c0             	test   %rax,%rax
+    2ed5:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  /-----|-----------|----------- 0f 84 0b 03 00 00    	je     31e6 <ex43()+0x7a6>
+            new_n->alloc_ = new_cap;
+    2edb:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |           |            66 0f 6f 05 1d 12 00 	movdqa 0x121d(%rip),%xmm0        # 4100 <_IO_stdin_used+0x100>
+    2ee2:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |           |            00 
+    2ee3:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |           |            0f 11 00             	movups %xmm0,(%rax)
+    2ee6:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |           |            b8 10 00 00 00       	mov    $0x10,%eax
+            nel::elem::set(data_, f, N);
+    2eeb:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |           \----------> 49 8d 7c 05 00       	lea    0x0(%r13,%rax,1),%rdi
+    2ef0:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |                        ba 00 01 00 00       	mov    $0x100,%edx
+    2ef5:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |                        be 68 00 00 00       	mov    $0x68,%esi
+    2efa:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |                        e8 d1 04 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            len_ += 1;
+    2eff:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |                        49 83 45 08 01       	addq   $0x1,0x8(%r13)
+            return len_;
+    2f04:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     \----------------------> 49 8b 5d 08          	mov    0x8(%r13),%rbx
+            return alloc_;
+    2f08:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                              49 8b 45 00          	mov    0x0(%r13),%rax
+            if (len() + n <= capacity()) { return true; }
+    2f0c:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                              48 8d 53 01          	lea    0x1(%rbx),%rdx
+    2f10:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |                              48 39 d0             	cmp    %rdx,%rax
+    2f13:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           /----------------- 0f 83 e6 00 00 00    	jae    2fff <ex43()+0x5bf>
+    2f19:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |                  48 83 f8 03          	cmp    $0x3,%rax
+    2f1d:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |        /-------- 0f 87 59 01 00 00    	ja     307c <ex43()+0x63c>
+    2f23:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |        |         b8 04 00 00 00       	mov    $0x4,%eax
+    2f28:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |        |         48 39 c2             	cmp    %rax,%rdx
+    2f2b:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |        |         48 0f 42 d0          	cmovb  %rax,%rdx
+    2f2f:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |        |         48 39 da             	cmp    %rbx,%rdx
+    2f32:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |        |         48 0f 42 d3          	cmovb  %rbx,%rdx
+    2f36:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |        |         48 89 d5             	mov    %rdx,%rbp
+            if (new_cap > max_capacity) { return nullptr; }
+    2f39:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |     /--|-------> 48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    2f40:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |     |  |         ff 7f 00 
+    2f43:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |           |     |  |         48 39 e8             	cmp    %rbp,%rax
+    2f46:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     /-----|-----|--|-------- 0f 82 34 02 00 00    	jb     3180 <ex43()+0x740>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    2f4c:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         48 89 ef             	mov    %rbp,%rdi
+    2f4f:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         48 c1 e7 08          	shl    $0x8,%rdi
+    2f53:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         48 83 c7 10          	add    $0x10,%rdi
+                                    : std::realloc(p, new_size);
+    2f57:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         e8 54 e1 ff ff       	call   10b0 <malloc@plt>
+    2f5c:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         49 89 c4             	mov    %rax,%r12
+            if (new_p == nullptr) {
+    2f5f:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         48 85 c0             	test   %rax,%rax
+    2f62:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     +-----|-----|--|-------- 0f 84 18 02 00 00    	je     3180 <ex43()+0x740>
+    2f68:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         66 0f 6f 6c 24 10    	movdqa 0x10(%rsp),%xmm5
+            , line_num_(line_num)
+    2f6e:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         c7 44 24 60 91 00 00 	movl   $0x91,0x60(%rsp)
+    2f75:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         00 
+            : fn_name_(fn_name)
+    2f76:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         0f 29 6c 24 50       	movaps %xmm5,0x50(%rsp)
+    if (!pred) { assert_fail(msg, ctx); }
+    2f7b:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         48 39 dd             	cmp    %rbx,%rbp
+    2f7e:	|  |  |  |  |  |  |  |  |  +--|--|--|-----|--|-----|-----|-----|--|-------- 0f 82 a8 02 00 00    	jb     322c <ex43()+0x7ec>
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    2f84:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         4d 8d 75 10          	lea    0x10(%r13),%r14
+    2f88:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         4c 8d 78 10          	lea    0x10(%rax),%r15
+                    new_n->len_ = old_n->len_;
+    2f8c:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         48 89 58 08          	mov    %rbx,0x8(%rax)
+    if (d == s) { return; }
+    2f90:	|  |  |  |  |  |  |  |  |  |  |  |  |     |  |     |     |     |  |         4d 39 fe             	cmp    %r15,%r14
+    2f93:	|  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|-----|-----|-----|--|-------- 74 53                	je     2fe8 <ex43()+0x5a8>
+    } else if (d < s) {
+    2f95:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |     |  |         4d 39 f7             	cmp    %r14,%r15
+    2f98:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|-----|-----|--|-------- 0f 83 b2 02 00 00    	jae    3250 <ex43()+0x810>
+        for (Index i = 0; i < n; ++i) {
+    2f9e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |         48 85 db             	test   %rbx,%rbx
+    2fa1:	|  |  |  |  |  |  |  |  |  |  |  |  |  +--|--|--|--|-----|-----|--|-------- 74 45                	je     2fe8 <ex43()+0x5a8>
+    2fa3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |         31 c0                	xor    %eax,%eax
+            nel::elem::move(data_, o.data_, N);
+    2fa5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     /-> 4c 89 f6             	mov    %r14,%rsi
+    2fa8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   4c 89 ff             	mov    %r15,%rdi
+    2fab:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    2fb0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    2fb5:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   e8 26 04 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    2fba:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   4c 89 f7             	mov    %r14,%rdi
+    2fbd:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    2fc2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    2fc7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   e8 04 04 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    2fcc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    2fd1:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   49 81 c6 00 01 00 00 	add    $0x100,%r14
+    2fd8:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   49 81 c7 00 01 00 00 	add    $0x100,%r15
+    2fdf:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   48 83 c0 01          	add    $0x1,%rax
+    2fe3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     |   48 39 d8             	cmp    %rbx,%rax
+    2fe6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |     \-- 75 bd                	jne    2fa5 <ex43()+0x565>
+                std::free(p);
+    2fe8:	|  |  |  |  |  |  |  |  |  |  |  |  |  >--|--|--|--|-----|-----|--|-------> 4c 89 ef             	mov    %r13,%rdi
+                item_ = p;
+    2feb:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |         4d 89 e5             	mov    %r12,%r13
+    2fee:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |         e8 3d e0 ff ff       	call   1030 <free@plt>
+            new_n->alloc_ = new_cap;
+    2ff3:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |         49 89 2c 24          	mov    %rbp,(%r12)
+            return len_;
+    2ff7:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |         49 8b 5c 24 08       	mov    0x8(%r12),%rbx
+    2ffc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |     |  |         48 89 e8             	mov    %rbp,%rax
+            if (len() >= capacity()) {
+    2fff:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     >-----|--|-------> 48 39 c3             	cmp    %rax,%rbx
+    3002:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|-----|--|-------- 0f 82 14 02 00 00    	jb     321c <ex43()+0x7dc>
+            nel::elem::set(data_, f, N);
+    3008:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 8d 5c 24 54       	lea    0x54(%rsp),%rbx
+    300d:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         ba 00 01 00 00       	mov    $0x100,%edx
+    3012:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         be 69 00 00 00       	mov    $0x69,%esi
+            : tag_(Tag::ERR)
+    3017:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         c7 44 24 50 02 00 00 	movl   $0x2,0x50(%rsp)
+    301e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         00 
+    301f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         48 89 df             	mov    %rbx,%rdi
+    3022:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         e8 a9 03 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            : fn_name_(fn_name)
+    3027:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         66 0f 6f 1c 24       	movdqa (%rsp),%xmm3
+    302c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         8b 44 24 50          	mov    0x50(%rsp),%eax
+    3030:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         0f 29 5c 24 30       	movaps %xmm3,0x30(%rsp)
+            switch (tag_) { // result<void>-match
+    3035:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |     |  |         83 f8 01             	cmp    $0x1,%eax
+    3038:	|  |  |  |  |  |  |  |  |  |  |  |  +--|--|--|--|--|--|--|-----|--|-------- 0f 84 4f fb ff ff    	je     2b8d <ex43()+0x14d>
+            , line_num_(line_num)
+    303e:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /--|--|-------> c7 44 24 40 54 00 00 	movl   $0x54,0x40(%rsp)
+    3045:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         00 
+    3046:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         83 f8 02             	cmp    $0x2,%eax
+    3049:	|  |  |  |  |  |  +--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|--|-------- 0f 85 11 01 00 00    	jne    3160 <ex43()+0x720>
+            nel::elem::set(data_, 0xa5, N);
+    304f:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         ba 00 01 00 00       	mov    $0x100,%edx
+    3054:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         be a5 00 00 00       	mov    $0xa5,%esi
+    3059:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         48 89 df             	mov    %rbx,%rdi
+    305c:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |         e8 6f 03 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            return (item_ == nullptr) ? Slice<Type>::empty() : item_->slice();
+    3061:	|  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  |  /----> 4d 85 ed             	test   %r13,%r13
+    3064:	|  |  |  |  |  |  |  |  |  |  |  |  \--|--|--|--|--|--|--|--|--|--|--|----- 0f 85 23 fb ff ff    	jne    2b8d <ex43()+0x14d>
+    306a:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |      48 81 c4 68 01 00 00 	add    $0x168,%rsp
+    3071:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |      5b                   	pop    %rbx
+    3072:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |      5d                   	pop    %rbp
+    3073:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |      41 5c                	pop    %r12
+    3075:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |      41 5d                	pop    %r13
+    3077:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |      41 5e                	pop    %r14
+    3079:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |      41 5f                	pop    %r15
+    307b:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  |  |      c3                   	ret
+    307c:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |  \--|----> 48 8d 2c 00          	lea    (%rax,%rax,1),%rbp
+    3080:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |     |      48 39 d5             	cmp    %rdx,%rbp
+    3083:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |     |      48 0f 42 ea          	cmovb  %rdx,%rbp
+    3087:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |     |      48 39 dd             	cmp    %rbx,%rbp
+    308a:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |     |      48 0f 42 eb          	cmovb  %rbx,%rbp
+            } else if (new_cap == item_->capacity()) {
+    308e:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  |  |  |     |      48 39 c5             	cmp    %rax,%rbp
+    3091:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |  \--|--|-----|----- 0f 84 68 ff ff ff    	je     2fff <ex43()+0x5bf>
+            } else if (new_cap > item_->capacity()) {
+    3097:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |  |     |      48 39 e8             	cmp    %rbp,%rax
+    309a:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |  \-----|----- 0f 82 99 fe ff ff    	jb     2f39 <ex43()+0x4f9>
+            if (new_cap > max_capacity) { return nullptr; }
+    30a0:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      48 b8 fe ff ff ff ff 	movabs $0x7ffffffffffffe,%rax
+    30a7:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      ff 7f 00 
+    30aa:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      48 39 e8             	cmp    %rbp,%rax
+    30ad:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  +--|-----|--------|----- 0f 82 cd 00 00 00    	jb     3180 <ex43()+0x740>
+            return sizeof(Node) - sizeof(T) + cap * sizeof(T);
+    30b3:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      48 89 ef             	mov    %rbp,%rdi
+    30b6:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      48 c1 e7 08          	shl    $0x8,%rdi
+    30ba:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      48 83 c7 10          	add    $0x10,%rdi
+                                    : std::realloc(p, new_size);
+    30be:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      e8 ed df ff ff       	call   10b0 <malloc@plt>
+    30c3:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      49 89 c4             	mov    %rax,%r12
+            if (new_p == nullptr) {
+    30c6:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      48 85 c0             	test   %rax,%rax
+    30c9:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  +--|-----|--------|----- 0f 84 b1 00 00 00    	je     3180 <ex43()+0x740>
+            : fn_name_(fn_name)
+    30cf:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      66 0f 6f 74 24 10    	movdqa 0x10(%rsp),%xmm6
+            , line_num_(line_num)
+    30d5:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      c7 44 24 60 91 00 00 	movl   $0x91,0x60(%rsp)
+    30dc:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      00 
+            : fn_name_(fn_name)
+    30dd:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      0f 29 74 24 50       	movaps %xmm6,0x50(%rsp)
+    if (!pred) { assert_fail(msg, ctx); }
+    30e2:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      48 39 dd             	cmp    %rbx,%rbp
+    30e5:	|  |  |  |  |  |  |  |  |  +--|--|-----|--|--|--|--|--|-----|--------|----- 0f 82 41 01 00 00    	jb     322c <ex43()+0x7ec>
+                    elem::relocate(new_n->values_, old_n->values_, old_n->len_);
+    30eb:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      4d 8d 75 10          	lea    0x10(%r13),%r14
+    30ef:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      4c 8d 78 10          	lea    0x10(%rax),%r15
+                    new_n->len_ = old_n->len_;
+    30f3:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      48 89 58 08          	mov    %rbx,0x8(%rax)
+    if (d == s) { return; }
+    30f7:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      4d 39 fe             	cmp    %r15,%r14
+    30fa:	|  |  |  |  |  |  |  |  |  |  |  |     +--|--|--|--|--|-----|--------|----- 0f 84 e8 fe ff ff    	je     2fe8 <ex43()+0x5a8>
+    } else if (d < s) {
+    3100:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |        |      4d 39 f7             	cmp    %r14,%r15
+    3103:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     /--|----- 0f 83 52 02 00 00    	jae    335b <ex43()+0x91b>
+        for (Index i = 0; i < n; ++i) {
+    3109:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |      48 85 db             	test   %rbx,%rbx
+    310c:	|  |  |  |  |  |  |  |  |  |  |  |     +--|--|--|--|--|-----|-----|--|----- 0f 84 d6 fe ff ff    	je     2fe8 <ex43()+0x5a8>
+    3112:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |      31 c0                	xor    %eax,%eax
+            nel::elem::move(data_, o.data_, N);
+    3114:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  /-> 4c 89 f6             	mov    %r14,%rsi
+    3117:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   4c 89 ff             	mov    %r15,%rdi
+    311a:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    311f:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   48 89 44 24 10       	mov    %rax,0x10(%rsp)
+    3124:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   e8 b7 02 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    3129:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   4c 89 f7             	mov    %r14,%rdi
+    312c:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   ba 00 01 00 00       	mov    $0x100,%edx
+    3131:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   be a5 00 00 00       	mov    $0xa5,%esi
+    3136:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   e8 95 02 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    313b:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   48 8b 44 24 10       	mov    0x10(%rsp),%rax
+    3140:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   49 81 c7 00 01 00 00 	add    $0x100,%r15
+    3147:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   49 81 c6 00 01 00 00 	add    $0x100,%r14
+    314e:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   48 83 c0 01          	add    $0x1,%rax
+    3152:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   48 39 d8             	cmp    %rbx,%rax
+    3155:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |  \-- 75 bd                	jne    3114 <ex43()+0x6d4>
+    3157:	|  |  |  |  |  |  |  |  |  |  |  |     +--|--|--|--|--|-----|-----|--|----- e9 8c fe ff ff       	jmp    2fe8 <ex43()+0x5a8>
+    315c:	|  |  |  |  |  |  |  |  |  |  |  |     |  |  |  |  |  |     |     |  |      0f 1f 40 00          	nopl   0x0(%rax)
+                    nel::panic("bad Result", ctx);
+    3160:	|  |  |  |  |  |  \--|--|--|--|--|-----|--|--|--|--|--|-----|-----|--|----> 48 8d 74 24 30       	lea    0x30(%rsp),%rsi
+            switch (tag_) { // result<void>-match
+    3165:	|  |  |  |  |  |     |  |  |  |  |     |  |  |  |  |  |     |     |  |      85 c0                	test   %eax,%eax
+    3167:	|  |  |  |  |  |     |  |  |  |  |     |  |  |  |  |  |     |     |  |  /-- 0f 84 d3 00 00 00    	je     3240 <ex43()+0x800>
+                    nel::panic("bad Result", ctx);
+    316d:	|  |  |  |  |  |     |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   48 8d 3d b8 0e 00 00 	lea    0xeb8(%rip),%rdi        # 402c <_IO_stdin_used+0x2c>
+    3174:	|  |  |  |  |  |     |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   e8 a9 df ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    3179:	|  |  |  |  |  |     |  |  |  |  |     |  |  |  |  |  |     |     |  |  |   0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    3180:	|  |  |  |  |  |     |  |  |  |  |     |  |  |  |  \--|-----|-----|--|--|-> 48 8d 5c 24 54       	lea    0x54(%rsp),%rbx
+            nel::elem::set(data_, f, N);
+    3185:	|  |  |  |  |  |     \--|--|--|--|-----|--|--|--|-----|-----|-----|--|--|-> ba 00 01 00 00       	mov    $0x100,%edx
+    318a:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     |     |  |  |   be 69 00 00 00       	mov    $0x69,%esi
+    318f:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     |     |  |  |   48 89 df             	mov    %rbx,%rdi
+            : tag_(Tag::ERR)
+    3192:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     |     |  |  |   c7 44 24 50 02 00 00 	movl   $0x2,0x50(%rsp)
+    3199:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     |     |  |  |   00 
+    319a:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     |     |  |  |   e8 31 02 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+            : fn_name_(fn_name)
+    319f:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     |     |  |  |   66 0f 6f 3c 24       	movdqa (%rsp),%xmm7
+    31a4:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     |     |  |  |   8b 44 24 50          	mov    0x50(%rsp),%eax
+    31a8:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     |     |  |  |   0f 29 7c 24 30       	movaps %xmm7,0x30(%rsp)
+            switch (tag_) { // result<void>-match
+    31ad:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     |     |  |  |   83 f8 01             	cmp    $0x1,%eax
+    31b0:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |     \-----|--|--|-- 0f 85 88 fe ff ff    	jne    303e <ex43()+0x5fe>
+    31b6:	|  |  |  |  |  |        |  |  |  |     |  |  |  |     |           |  \--|-- e9 a6 fe ff ff       	jmp    3061 <ex43()+0x621>
+                                    : std::realloc(p, new_size);
+    31bb:	|  \--|--|--|--|--------|--|--|--|-----|--|--|--|-----|-----------|-----|-> bf 10 04 00 00       	mov    $0x410,%edi
+    31c0:	|     |  |  |  |        |  |  |  |     |  |  |  |     |           |     |   e8 eb de ff ff       	call   10b0 <malloc@plt>
+    31c5:	|     |  |  |  |        |  |  |  |     |  |  |  |     |           |     |   49 89 c5             	mov    %rax,%r13
+            if (new_p == nullptr) {
+    31c8:	|     |  |  |  |        |  |  |  |     |  |  |  |     |           |     |   48 85 c0             	test   %rax,%rax
+    31cb:	|     |  |  |  |        |  |  |  |     |  \--|--|-----|-----------|-----|-- 0f 84 9f fc ff ff    	je     2e70 <ex43()+0x430>
+            new_n->alloc_ = new_cap;
+    31d1:	|     |  |  |  |        |  |  |  |     |     |  |     |           |     |   66 0f 6f 05 27 0f 00 	movdqa 0xf27(%rip),%xmm0        # 4100 <_IO_stdin_used+0x100>
+    31d8:	|     |  |  |  |        |  |  |  |     |     |  |     |           |     |   00 
+    31d9:	|     |  |  |  |        |  |  |  |     |     |  |     |           |     |   0f 11 00             	movups %xmm0,(%rax)
+    31dc:	\-----|--|--|--|--------|--|--|--|-----|-----|--|-----|-----------|-----|-- e9 d2 f8 ff ff       	jmp    2ab3 <ex43()+0x73>
+    31e1:	      |  |  |  |        |  |  \--|-----|-----|--|-----|-----------|-----|-> 48 8d 5c 24 54       	lea    0x54(%rsp),%rbx
+    31e6:	      |  |  |  |        |  |     |     |     \--|-----|-----------|-----|-> ba 00 01 00 00       	mov    $0x100,%edx
+    31eb:	      |  |  |  |        |  |     |     |        |     |           |     |   be 68 00 00 00       	mov    $0x68,%esi
+    31f0:	      |  |  |  |        |  |     |     |        |     |           |     |   48 89 df             	mov    %rbx,%rdi
+            : tag_(Tag::ERR)
+    31f3:	      |  |  |  |        |  |     |     |        |     |           |     |   c7 44 24 50 02 00 00 	movl   $0x2,0x50(%rsp)
+    31fa:	      |  |  |  |        |  |     |     |        |     |           |     |   00 
+    31fb:	      |  |  |  |        |  |     |     |        |     |           |     |   e8 d0 01 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    3200:	      |  |  |  |        |  |     |     |        |     |           |     |   66 0f 6f 1c 24       	movdqa (%rsp),%xmm3
+    3205:	      |  |  |  |        |  |     |     |        |     |           |     |   8b 44 24 50          	mov    0x50(%rsp),%eax
+    3209:	      |  |  |  |        |  |     |     |        |     |           |     |   0f 29 5c 24 30       	movaps %xmm3,0x30(%rsp)
+            switch (tag_) { // result<void>-match
+    320e:	      |  |  |  |        |  |     |     |        |     |           |     |   83 f8 01             	cmp    $0x1,%eax
+    3211:	      \--|--|--|--------|--|-----|-----|--------|-----|-----------|-----|-- 0f 85 0b f9 ff ff    	jne    2b22 <ex43()+0xe2>
+    3217:	         \--|--|--------|--|-----|-----|--------|-----|-----------|-----|-- e9 29 f9 ff ff       	jmp    2b45 <ex43()+0x105>
+    321c:	            |  |        |  |     |     |        |     \-----------|-----|-> 48 89 d8             	mov    %rbx,%rax
+    321f:	            |  |        |  |     |     |        |                 |     |   48 c1 e0 08          	shl    $0x8,%rax
+    3223:	            |  |        |  |     |     |        |                 |     |   48 83 c0 10          	add    $0x10,%rax
+    3227:	            \--|--------|--|-----|-----|--------|-----------------|-----|-- e9 48 f9 ff ff       	jmp    2b74 <ex43()+0x134>
+    if (!pred) { assert_fail(msg, ctx); }
+    322c:	               |        |  \-----|-----|--------|-----------------|-----|-> 48 8d 74 24 50       	lea    0x50(%rsp),%rsi
+    3231:	               |        |        |     |        |                 |     |   48 8d 3d 90 0e 00 00 	lea    0xe90(%rip),%rdi        # 40c8 <_IO_stdin_used+0xc8>
+    3238:	               |        |        |     |        |                 |     |   e8 15 df ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    323d:	               |        |        |     |        |                 |     |   0f 1f 00             	nopl   (%rax)
+                    nel::panic("invalid Result", ctx);
+    3240:	               |        |        |     |        |                 |     \-> 48 8d 3d d6 0d 00 00 	lea    0xdd6(%rip),%rdi        # 401d <_IO_stdin_used+0x1d>
+    3247:	               |        |        |     |        |                 |         e8 d6 de ff ff       	call   1122 <nel::panic(char const*, nel::Context const&)>
+    324c:	               |        |        |     |        |                 |         0f 1f 40 00          	nopl   0x0(%rax)
+        for (Index i = n; i > 0; --i) {
+    3250:	               |        |        |     |        \-----------------|-------> 48 85 db             	test   %rbx,%rbx
+    3253:	               |        |        |     +--------------------------|-------- 0f 84 8f fd ff ff    	je     2fe8 <ex43()+0x5a8>
+    3259:	               |        |        |     |                          |         49 89 de             	mov    %rbx,%r14
+    325c:	               |        |        |     |                          |         49 c1 e6 08          	shl    $0x8,%r14
+    3260:	               |        |        |     |                          |         49 81 ee f0 00 00 00 	sub    $0xf0,%r14
+    3267:	               |        |        |     |                          |         4e 8d 3c 30          	lea    (%rax,%r14,1),%r15
+    326b:	               |        |        |     |                          |         4d 01 ee             	add    %r13,%r14
+            nel::elem::move(data_, o.data_, N);
+    326e:	               |        |        |     |                          |     /-> 4c 89 f6             	mov    %r14,%rsi
+    3271:	               |        |        |     |                          |     |   4c 89 ff             	mov    %r15,%rdi
+    3274:	               |        |        |     |                          |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    3279:	               |        |        |     |                          |     |   49 81 ef 00 01 00 00 	sub    $0x100,%r15
+    3280:	               |        |        |     |                          |     |   e8 5b 01 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    3285:	               |        |        |     |                          |     |   4c 89 f7             	mov    %r14,%rdi
+    3288:	               |        |        |     |                          |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    328d:	               |        |        |     |                          |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    3292:	               |        |        |     |                          |     |   e8 39 01 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    3297:	               |        |        |     |                          |     |   49 81 ee 00 01 00 00 	sub    $0x100,%r14
+    329e:	               |        |        |     |                          |     |   48 83 eb 01          	sub    $0x1,%rbx
+    32a2:	               |        |        |     |                          |     \-- 75 ca                	jne    326e <ex43()+0x82e>
+    32a4:	               |        |        |     +--------------------------|-------- e9 3f fd ff ff       	jmp    2fe8 <ex43()+0x5a8>
+    32a9:	               |        \--------|-----|--------------------------|-------> 48 85 db             	test   %rbx,%rbx
+    32ac:	               +-----------------|-----|--------------------------|-------- 0f 84 b0 fa ff ff    	je     2d62 <ex43()+0x322>
+    32b2:	               |                 |     |                          |         49 89 de             	mov    %rbx,%r14
+    32b5:	               |                 |     |                          |         49 c1 e6 08          	shl    $0x8,%r14
+    32b9:	               |                 |     |                          |         49 81 ee f0 00 00 00 	sub    $0xf0,%r14
+    32c0:	               |                 |     |                          |         4e 8d 3c 30          	lea    (%rax,%r14,1),%r15
+    32c4:	               |                 |     |                          |         4d 01 ee             	add    %r13,%r14
+            nel::elem::move(data_, o.data_, N);
+    32c7:	               |                 |     |                          |     /-> 4c 89 f6             	mov    %r14,%rsi
+    32ca:	               |                 |     |                          |     |   4c 89 ff             	mov    %r15,%rdi
+    32cd:	               |                 |     |                          |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    32d2:	               |                 |     |                          |     |   49 81 ef 00 01 00 00 	sub    $0x100,%r15
+    32d9:	               |                 |     |                          |     |   e8 02 01 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    32de:	               |                 |     |                          |     |   4c 89 f7             	mov    %r14,%rdi
+    32e1:	               |                 |     |                          |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    32e6:	               |                 |     |                          |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    32eb:	               |                 |     |                          |     |   e8 e0 00 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    32f0:	               |                 |     |                          |     |   49 81 ee 00 01 00 00 	sub    $0x100,%r14
+    32f7:	               |                 |     |                          |     |   48 83 eb 01          	sub    $0x1,%rbx
+    32fb:	               |                 |     |                          |     \-- 75 ca                	jne    32c7 <ex43()+0x887>
+    32fd:	               +-----------------|-----|--------------------------|-------- e9 60 fa ff ff       	jmp    2d62 <ex43()+0x322>
+    3302:	               |                 \-----|--------------------------|-------> 48 85 db             	test   %rbx,%rbx
+    3305:	               +-----------------------|--------------------------|-------- 0f 84 57 fa ff ff    	je     2d62 <ex43()+0x322>
+    330b:	               |                       |                          |         49 89 de             	mov    %rbx,%r14
+    330e:	               |                       |                          |         49 c1 e6 08          	shl    $0x8,%r14
+    3312:	               |                       |                          |         49 81 ee f0 00 00 00 	sub    $0xf0,%r14
+    3319:	               |                       |                          |         4e 8d 3c 30          	lea    (%rax,%r14,1),%r15
+    331d:	               |                       |                          |         4d 01 ee             	add    %r13,%r14
+            nel::elem::move(data_, o.data_, N);
+    3320:	               |                       |                          |     /-> 4c 89 f6             	mov    %r14,%rsi
+    3323:	               |                       |                          |     |   4c 89 ff             	mov    %r15,%rdi
+    3326:	               |                       |                          |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    332b:	               |                       |                          |     |   49 81 ef 00 01 00 00 	sub    $0x100,%r15
+    3332:	               |                       |                          |     |   e8 a9 00 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    3337:	               |                       |                          |     |   4c 89 f7             	mov    %r14,%rdi
+    333a:	               |                       |                          |     |   ba 00 01 00 00       	mov    $0x100,%edx
+    333f:	               |                       |                          |     |   be a5 00 00 00       	mov    $0xa5,%esi
+    3344:	               |                       |                          |     |   e8 87 00 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    3349:	               |                       |                          |     |   49 81 ee 00 01 00 00 	sub    $0x100,%r14
+    3350:	               |                       |                          |     |   48 83 eb 01          	sub    $0x1,%rbx
+    3354:	               |                       |                          |     \-- 75 ca                	jne    3320 <ex43()+0x8e0>
+    3356:	               \-----------------------|--------------------------|-------- e9 07 fa ff ff       	jmp    2d62 <ex43()+0x322>
+    335b:	                                       |                          \-------> 48 85 db             	test   %rbx,%rbx
+    335e:	                                       +----------------------------------- 0f 84 84 fc ff ff    	je     2fe8 <ex43()+0x5a8>
+    3364:	                                       |                                    49 89 de             	mov    %rbx,%r14
+    3367:	                                       |                                    49 c1 e6 08          	shl    $0x8,%r14
+    336b:	                                       |                                    49 81 ee f0 00 00 00 	sub    $0xf0,%r14
+    3372:	                                       |                                    4e 8d 3c 30          	lea    (%rax,%r14,1),%r15
+    3376:	                                       |                                    4d 01 ee             	add    %r13,%r14
+            nel::elem::move(data_, o.data_, N);
+    3379:	                                       |                                /-> 4c 89 f6             	mov    %r14,%rsi
+    337c:	                                       |                                |   4c 89 ff             	mov    %r15,%rdi
+    337f:	                                       |                                |   ba 00 01 00 00       	mov    $0x100,%edx
+    3384:	                                       |                                |   49 81 ef 00 01 00 00 	sub    $0x100,%r15
+    338b:	                                       |                                |   e8 50 00 00 00       	call   33e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>
+            nel::elem::set(data_, 0xa5, N);
+    3390:	                                       |                                |   4c 89 f7             	mov    %r14,%rdi
+    3393:	                                       |                                |   ba 00 01 00 00       	mov    $0x100,%edx
+    3398:	                                       |                                |   be a5 00 00 00       	mov    $0xa5,%esi
+    339d:	                                       |                                |   e8 2e 00 00 00       	call   33d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>
+    33a2:	                                       |                                |   49 81 ee 00 01 00 00 	sub    $0x100,%r14
+    33a9:	                                       |                                |   48 83 eb 01          	sub    $0x1,%rbx
+    33ad:	                                       |                                \-- 75 ca                	jne    3379 <ex43()+0x939>
+    33af:	                                       \----------------------------------- e9 34 fc ff ff       	jmp    2fe8 <ex43()+0x5a8>
+    33b4:	                                                                            66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    33bb:	                                                                            00 00 00 
+    33be:	                                                                            66 90                	xchg   %ax,%ax
+
+00000000000033c0 <nel::elem::copy(unsigned char*, unsigned char const*, unsigned long)>:
+    // }
+    // uint8_t const *is = s;
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++is, ++id) {
+    //     *id = *is;
+    // }
+    std::memcpy(d, s, n);
+    33c0:	e9 db dc ff ff       	jmp    10a0 <memcpy@plt>
+    33c5:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    33cc:	00 00 00 00 
+
+00000000000033d0 <nel::elem::set(unsigned char*, unsigned char, unsigned long)>:
+    //     d[i] = s;
+    // }
+    // for (uint8_t *id = d, *const e = (d + n); id != e; ++id) {
+    //     *id = s;
+    // }
+    std::memset(d, s, n);
+    33d0:	40 0f b6 f6          	movzbl %sil,%esi
+    33d4:	e9 87 dc ff ff       	jmp    1060 <memset@plt>
+    33d9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000000033e0 <nel::elem::move(unsigned char*, unsigned char*, unsigned long)>:
+}
+
+void move(uint8_t *const d, uint8_t *const s, Length const n)
+    33e0:	e9 bb dc ff ff       	jmp    10a0 <memcpy@plt>
+    33e5:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    33ec:	00 00 00 00 
+
+00000000000033f0 <nel::elem::relocate(unsigned char*, unsigned char*, unsigned long)>:
+    poison(s, n);
+}
+
+void relocate(uint8_t *const d, uint8_t *const s, Length const n)
+{
+    std::memmove(d, s, n);
+    33f0:	e9 db dc ff ff       	jmp    10d0 <memmove@plt>
+    33f5:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    33fc:	00 00 00 00 
+
+0000000000003400 <nel::elem::wipe(unsigned char*, unsigned long)>:
+}
+
+void wipe(uint8_t *const d, Length const n)
+{
+    3400:	48 89 f2             	mov    %rsi,%rdx
+    std::memset(d, s, n);
+    3403:	be a5 00 00 00       	mov    $0xa5,%esi
+    3408:	e9 53 dc ff ff       	jmp    1060 <memset@plt>
+    340d:	0f 1f 00             	nopl   (%rax)
+
+0000000000003410 <nel::elem::eq(unsigned char const*, unsigned char const*, unsigned long)>:
+    set(d, 0xa5, n);
+}
+
+bool eq(uint8_t const *a, uint8_t const *b, Length n)
+{
+    3410:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a != *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) == 0;
+    3414:	e8 67 dc ff ff       	call   1080 <memcmp@plt>
+    3419:	85 c0                	test   %eax,%eax
+    341b:	0f 94 c0             	sete   %al
+}
+    341e:	48 83 c4 08          	add    $0x8,%rsp
+    3422:	c3                   	ret
+    3423:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    342a:	00 00 00 00 
+    342e:	66 90                	xchg   %ax,%ax
+
+0000000000003430 <nel::elem::ne(unsigned char const*, unsigned char const*, unsigned long)>:
+
+bool ne(uint8_t const *a, uint8_t const *b, Length n)
+{
+    3430:	48 83 ec 08          	sub    $0x8,%rsp
+    // for (; a != e; ++a) {
+    //     if (*a == *b) { return false; }
+    //     ++b;
+    // }
+    // return true;
+    return std::memcmp(a, b, n) != 0;
+    3434:	e8 47 dc ff ff       	call   1080 <memcmp@plt>
+    3439:	85 c0                	test   %eax,%eax
+    343b:	0f 95 c0             	setne  %al
+}
+    343e:	48 83 c4 08          	add    $0x8,%rsp
+    3442:	c3                   	ret
+    3443:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    344a:	00 00 00 00 
+    344e:	66 90                	xchg   %ax,%ax
+
+0000000000003450 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+}
+
+void copy_streaming(uint8_t *const d, uint8_t const *const s, Length const n)
+{
+    if (n < streaming_min) {
+    3450:	                48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    3457:	/-------------- 0f 86 d7 00 00 00    	jbe    3534 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xe4>
+        copy(d, s, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    345d:	|               48 89 f9             	mov    %rdi,%rcx
+{
+    3460:	|               53                   	push   %rbx
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    3461:	|               48 f7 d9             	neg    %rcx
+    3464:	|               83 e1 0f             	and    $0xf,%ecx
+    std::memcpy(d, s, n);
+    3467:	|               83 f9 08             	cmp    $0x8,%ecx
+    346a:	|     /-------- 0f 82 d0 00 00 00    	jb     3540 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xf0>
+    3470:	|     |         48 8b 06             	mov    (%rsi),%rax
+    3473:	|     |         4c 8d 57 08          	lea    0x8(%rdi),%r10
+    3477:	|     |         48 89 f3             	mov    %rsi,%rbx
+    347a:	|     |         49 83 e2 f8          	and    $0xfffffffffffffff8,%r10
+    347e:	|     |         48 89 07             	mov    %rax,(%rdi)
+    3481:	|     |         48 8b 44 0e f8       	mov    -0x8(%rsi,%rcx,1),%rax
+    3486:	|     |         48 89 44 0f f8       	mov    %rax,-0x8(%rdi,%rcx,1)
+    348b:	|     |         48 89 f8             	mov    %rdi,%rax
+    348e:	|     |         4c 29 d0             	sub    %r10,%rax
+    3491:	|     |         48 29 c3             	sub    %rax,%rbx
+    3494:	|     |         01 c8                	add    %ecx,%eax
+    3496:	|     |         83 e0 f8             	and    $0xfffffff8,%eax
+    3499:	|     |         83 f8 08             	cmp    $0x8,%eax
+    349c:	|  /--|-------- 72 1a                	jb     34b8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    349e:	|  |  |         83 e0 f8             	and    $0xfffffff8,%eax
+    34a1:	|  |  |         45 31 c0             	xor    %r8d,%r8d
+    34a4:	|  |  |     /-> 45 89 c1             	mov    %r8d,%r9d
+    34a7:	|  |  |     |   41 83 c0 08          	add    $0x8,%r8d
+    34ab:	|  |  |     |   4e 8b 1c 0b          	mov    (%rbx,%r9,1),%r11
+    34af:	|  |  |     |   4f 89 1c 0a          	mov    %r11,(%r10,%r9,1)
+    34b3:	|  |  |     |   41 39 c0             	cmp    %eax,%r8d
+    34b6:	|  |  |     \-- 72 ec                	jb     34a4 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x54>
+    copy(d, s, head);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    34b8:	|  >--|-------> 48 8d 41 40          	lea    0x40(%rcx),%rax
+    34bc:	|  |  |         48 01 f9             	add    %rdi,%rcx
+    34bf:	|  |  |         90                   	nop
+    std::memcpy(&v, s, sizeof(v));
+    34c0:	|  |  |     /-> f3 0f 6f 54 06 d0    	movdqu -0x30(%rsi,%rax,1),%xmm2
+    34c6:	|  |  |     |   f3 0f 6f 4c 06 e0    	movdqu -0x20(%rsi,%rax,1),%xmm1
+    34cc:	|  |  |     |   49 89 c0             	mov    %rax,%r8
+    for (; i + 64 <= n; i += 64) {
+    34cf:	|  |  |     |   48 83 c1 40          	add    $0x40,%rcx
+    std::memcpy(&v, s, sizeof(v));
+    34d3:	|  |  |     |   f3 0f 6f 44 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm0
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    34d9:	|  |  |     |   f3 0f 6f 5c 06 c0    	movdqu -0x40(%rsi,%rax,1),%xmm3
+    for (; i + 64 <= n; i += 64) {
+    34df:	|  |  |     |   48 83 c0 40          	add    $0x40,%rax
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    34e3:	|  |  |     |   66 0f e7 51 d0       	movntdq %xmm2,-0x30(%rcx)
+    34e8:	|  |  |     |   66 0f e7 49 e0       	movntdq %xmm1,-0x20(%rcx)
+    34ed:	|  |  |     |   66 0f e7 59 c0       	movntdq %xmm3,-0x40(%rcx)
+    34f2:	|  |  |     |   66 0f e7 41 f0       	movntdq %xmm0,-0x10(%rcx)
+    for (; i + 64 <= n; i += 64) {
+    34f7:	|  |  |     |   48 39 c2             	cmp    %rax,%rdx
+    34fa:	|  |  |     \-- 73 c4                	jae    34c0 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x70>
+        stream16(d + i, a);
+        stream16(d + i + 16, b);
+        stream16(d + i + 32, c);
+        stream16(d + i + 48, e);
+    }
+    for (; i + 16 <= n; i += 16) {
+    34fc:	|  |  |         49 8d 40 10          	lea    0x10(%r8),%rax
+    3500:	|  |  |         48 39 c2             	cmp    %rax,%rdx
+    3503:	|  |  |  /----- 72 22                	jb     3527 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xd7>
+    3505:	|  |  |  |      48 8d 4f f0          	lea    -0x10(%rdi),%rcx
+    3509:	|  |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    3510:	|  |  |  |  /-> f3 0f 6f 64 06 f0    	movdqu -0x10(%rsi,%rax,1),%xmm4
+    3516:	|  |  |  |  |   49 89 c0             	mov    %rax,%r8
+    3519:	|  |  |  |  |   66 0f e7 24 01       	movntdq %xmm4,(%rcx,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    351e:	|  |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    3522:	|  |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    3525:	|  |  |  |  \-- 73 e9                	jae    3510 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0xc0>
+        stream16(d + i, load16(s + i));
+    }
+    // streaming stores are weakly ordered, fence so they are seen before later stores.
+    __builtin_ia32_sfence();
+    3527:	|  |  |  \----> 0f ae f8             	sfence
+    copy(d + i, s + i, n - i);
+    352a:	|  |  |         4c 01 c7             	add    %r8,%rdi
+    352d:	|  |  |         4c 29 c2             	sub    %r8,%rdx
+    3530:	|  |  |         4c 01 c6             	add    %r8,%rsi
+}
+    3533:	|  |  |         5b                   	pop    %rbx
+    std::memcpy(d, s, n);
+    3534:	\--|--|-------> e9 67 db ff ff       	jmp    10a0 <memcpy@plt>
+    3539:	   |  |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    3540:	   |  \-------> f6 c1 04             	test   $0x4,%cl
+    3543:	   |        /-- 75 25                	jne    356a <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x11a>
+    3545:	   |        |   85 c9                	test   %ecx,%ecx
+    3547:	   +--------|-- 0f 84 6b ff ff ff    	je     34b8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    354d:	   |        |   0f b6 06             	movzbl (%rsi),%eax
+    3550:	   |        |   88 07                	mov    %al,(%rdi)
+    3552:	   |        |   f6 c1 02             	test   $0x2,%cl
+    3555:	   +--------|-- 0f 84 5d ff ff ff    	je     34b8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    355b:	   |        |   0f b7 44 0e fe       	movzwl -0x2(%rsi,%rcx,1),%eax
+    3560:	   |        |   66 89 44 0f fe       	mov    %ax,-0x2(%rdi,%rcx,1)
+    3565:	   +--------|-- e9 4e ff ff ff       	jmp    34b8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    356a:	   |        \-> 8b 06                	mov    (%rsi),%eax
+    356c:	   |            89 07                	mov    %eax,(%rdi)
+    356e:	   |            8b 44 0e fc          	mov    -0x4(%rsi,%rcx,1),%eax
+    3572:	   |            89 44 0f fc          	mov    %eax,-0x4(%rdi,%rcx,1)
+    3576:	   \----------- e9 3d ff ff ff       	jmp    34b8 <nel::elem::copy_streaming(unsigned char*, unsigned char const*, unsigned long)+0x68>
+    357b:	                0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000003580 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)>:
+
+void set_streaming(uint8_t *const d, uint8_t const p[16], Length const n)
+{
+    3580:	                                           49 89 f8             	mov    %rdi,%r8
+    3583:	                                           48 89 f1             	mov    %rsi,%rcx
+    if (n < streaming_min) {
+    3586:	                                           48 81 fa ff 00 00 00 	cmp    $0xff,%rdx
+    358d:	                              /----------- 0f 86 85 03 00 00    	jbe    3918 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x398>
+        set_pattern(d, p, n);
+        return;
+    }
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    3593:	                              |            48 89 fe             	mov    %rdi,%rsi
+{
+    3596:	                              |            41 57                	push   %r15
+    Length const head = (16 - (reinterpret_cast<USize>(d) & 15)) & 15;
+    3598:	                              |            48 f7 de             	neg    %rsi
+{
+    359b:	                              |            41 56                	push   %r14
+    for (Index i = 0; i < head; ++i) {
+    359d:	                              |            48 89 f0             	mov    %rsi,%rax
+{
+    35a0:	                              |            41 55                	push   %r13
+    35a2:	                              |            41 54                	push   %r12
+    35a4:	                              |            55                   	push   %rbp
+    35a5:	                              |            53                   	push   %rbx
+    for (Index i = 0; i < head; ++i) {
+    35a6:	                              |            83 e0 0f             	and    $0xf,%eax
+    35a9:	/-----------------------------|----------- 0f 84 01 01 00 00    	je     36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    35af:	|                             |            48 8d 78 ff          	lea    -0x1(%rax),%rdi
+    35b3:	|                             |            48 83 ff 02          	cmp    $0x2,%rdi
+    35b7:	|  /--------------------------|----------- 0f 86 8a 04 00 00    	jbe    3a47 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4c7>
+    35bd:	|  |                          |            4c 8d 51 01          	lea    0x1(%rcx),%r10
+    35c1:	|  |                          |            4d 89 c1             	mov    %r8,%r9
+    35c4:	|  |                          |            4d 29 d1             	sub    %r10,%r9
+    35c7:	|  |                          |            49 83 f9 06          	cmp    $0x6,%r9
+    35cb:	|  |                          |  /-------- 0f 87 c7 02 00 00    	ja     3898 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x318>
+        d[i] = p[i];
+    35d1:	|  |                          |  |         0f b6 39             	movzbl (%rcx),%edi
+    35d4:	|  |                          |  |         41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    35d7:	|  |                          |  |         40 f6 c6 0e          	test   $0xe,%sil
+    35db:	+--|--------------------------|--|-------- 0f 84 cf 00 00 00    	je     36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    35e1:	|  |                          |  |         0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    35e5:	|  |                          |  |         41 88 78 01          	mov    %dil,0x1(%r8)
+    35e9:	|  |  /-----------------------|--|-------> 0f b6 79 02          	movzbl 0x2(%rcx),%edi
+    35ed:	|  |  |                       |  |         41 88 78 02          	mov    %dil,0x2(%r8)
+    for (Index i = 0; i < head; ++i) {
+    35f1:	|  |  |                       |  |         40 f6 c6 0c          	test   $0xc,%sil
+    35f5:	+--|--|-----------------------|--|-------- 0f 84 b5 00 00 00    	je     36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    35fb:	|  |  |                       |  |         0f b6 79 03          	movzbl 0x3(%rcx),%edi
+    35ff:	|  |  |                       |  |         41 88 78 03          	mov    %dil,0x3(%r8)
+    for (Index i = 0; i < head; ++i) {
+    3603:	|  |  |                       |  |         48 83 f8 04          	cmp    $0x4,%rax
+    3607:	+--|--|-----------------------|--|-------- 0f 86 a3 00 00 00    	jbe    36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    360d:	|  |  |                       |  |         0f b6 79 04          	movzbl 0x4(%rcx),%edi
+    3611:	|  |  |                       |  |         41 88 78 04          	mov    %dil,0x4(%r8)
+    for (Index i = 0; i < head; ++i) {
+    3615:	|  |  |                       |  |         48 83 f8 05          	cmp    $0x5,%rax
+    3619:	+--|--|-----------------------|--|-------- 0f 84 91 00 00 00    	je     36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    361f:	|  |  |                       |  |         0f b6 79 05          	movzbl 0x5(%rcx),%edi
+    3623:	|  |  |                       |  |         41 88 78 05          	mov    %dil,0x5(%r8)
+    for (Index i = 0; i < head; ++i) {
+    3627:	|  |  |                       |  |         48 83 f8 06          	cmp    $0x6,%rax
+    362b:	+--|--|-----------------------|--|-------- 0f 84 7f 00 00 00    	je     36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    3631:	|  |  |                       |  |         0f b6 79 06          	movzbl 0x6(%rcx),%edi
+    for (Index i = 0; i < head; ++i) {
+    3635:	|  |  |                       |  |         83 e6 08             	and    $0x8,%esi
+        d[i] = p[i];
+    3638:	|  |  |                       |  |         41 88 78 06          	mov    %dil,0x6(%r8)
+    for (Index i = 0; i < head; ++i) {
+    363c:	+--|--|-----------------------|--|-------- 74 72                	je     36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    363e:	|  |  |                       |  |         0f b6 71 07          	movzbl 0x7(%rcx),%esi
+    3642:	|  |  |                       |  |         41 88 70 07          	mov    %sil,0x7(%r8)
+    for (Index i = 0; i < head; ++i) {
+    3646:	|  |  |                       |  |         48 83 f8 08          	cmp    $0x8,%rax
+    364a:	+--|--|-----------------------|--|-------- 76 64                	jbe    36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    364c:	|  |  |                       |  |         0f b6 71 08          	movzbl 0x8(%rcx),%esi
+    3650:	|  |  |                       |  |         41 88 70 08          	mov    %sil,0x8(%r8)
+    for (Index i = 0; i < head; ++i) {
+    3654:	|  |  |                       |  |         48 83 f8 09          	cmp    $0x9,%rax
+    3658:	+--|--|-----------------------|--|-------- 74 56                	je     36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    365a:	|  |  |                       |  |         0f b6 71 09          	movzbl 0x9(%rcx),%esi
+    365e:	|  |  |                       |  |         41 88 70 09          	mov    %sil,0x9(%r8)
+    for (Index i = 0; i < head; ++i) {
+    3662:	|  |  |                       |  |         48 83 f8 0a          	cmp    $0xa,%rax
+    3666:	+--|--|-----------------------|--|-------- 74 48                	je     36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    3668:	|  |  |                       |  |         0f b6 71 0a          	movzbl 0xa(%rcx),%esi
+    366c:	|  |  |                       |  |         41 88 70 0a          	mov    %sil,0xa(%r8)
+    for (Index i = 0; i < head; ++i) {
+    3670:	|  |  |                       |  |         48 83 f8 0b          	cmp    $0xb,%rax
+    3674:	+--|--|-----------------------|--|-------- 74 3a                	je     36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    3676:	|  |  |                       |  |         0f b6 71 0b          	movzbl 0xb(%rcx),%esi
+    367a:	|  |  |                       |  |         41 88 70 0b          	mov    %sil,0xb(%r8)
+    for (Index i = 0; i < head; ++i) {
+    367e:	|  |  |                       |  |         48 83 f8 0c          	cmp    $0xc,%rax
+    3682:	+--|--|-----------------------|--|-------- 74 2c                	je     36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    3684:	|  |  |                       |  |         0f b6 71 0c          	movzbl 0xc(%rcx),%esi
+    3688:	|  |  |                       |  |         41 88 70 0c          	mov    %sil,0xc(%r8)
+    for (Index i = 0; i < head; ++i) {
+    368c:	|  |  |                       |  |         48 83 f8 0d          	cmp    $0xd,%rax
+    3690:	+--|--|-----------------------|--|-------- 74 1e                	je     36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    3692:	|  |  |                       |  |         0f b6 71 0d          	movzbl 0xd(%rcx),%esi
+    3696:	|  |  |                       |  |         41 88 70 0d          	mov    %sil,0xd(%r8)
+    for (Index i = 0; i < head; ++i) {
+    369a:	|  |  |                       |  |         49 8d 70 ff          	lea    -0x1(%r8),%rsi
+    369e:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    36a1:	+--|--|-----------------------|--|-------- 75 0d                	jne    36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    36a3:	|  |  |                       |  |         0f b6 71 0e          	movzbl 0xe(%rcx),%esi
+    36a7:	|  |  |                       |  |         41 88 70 0e          	mov    %sil,0xe(%r8)
+    for (Index i = 0; i < head; ++i) {
+    36ab:	|  |  |                       |  |         0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+    }
+    // the pattern as seen from the first aligned address.
+    uint8_t rotated[16];
+    for (Index i = 0; i < 16; ++i) {
+        rotated[i] = p[(head + i) % 16];
+    36b0:	>--|--|-----------------------|--|-------> 48 8d 70 07          	lea    0x7(%rax),%rsi
+    36b4:	|  |  |                       |  |         4c 8d 78 06          	lea    0x6(%rax),%r15
+    36b8:	|  |  |                       |  |         83 e6 0f             	and    $0xf,%esi
+    36bb:	|  |  |                       |  |         4c 8d 70 05          	lea    0x5(%rax),%r14
+    36bf:	|  |  |                       |  |         4c 8d 68 04          	lea    0x4(%rax),%r13
+    36c3:	|  |  |                       |  |         41 83 e7 0f          	and    $0xf,%r15d
+    std::memcpy(&v, s, sizeof(v));
+    36c7:	|  |  |                       |  |         0f b6 34 31          	movzbl (%rcx,%rsi,1),%esi
+        rotated[i] = p[(head + i) % 16];
+    36cb:	|  |  |                       |  |         41 83 e6 0f          	and    $0xf,%r14d
+    36cf:	|  |  |                       |  |         41 83 e5 0f          	and    $0xf,%r13d
+    36d3:	|  |  |                       |  |         4c 8d 60 03          	lea    0x3(%rax),%r12
+    std::memcpy(&v, s, sizeof(v));
+    36d7:	|  |  |                       |  |         46 0f b6 3c 39       	movzbl (%rcx,%r15,1),%r15d
+    36dc:	|  |  |                       |  |         46 0f b6 34 31       	movzbl (%rcx,%r14,1),%r14d
+        rotated[i] = p[(head + i) % 16];
+    36e1:	|  |  |                       |  |         48 8d 78 08          	lea    0x8(%rax),%rdi
+    36e5:	|  |  |                       |  |         41 83 e4 0f          	and    $0xf,%r12d
+    std::memcpy(&v, s, sizeof(v));
+    36e9:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    36ed:	|  |  |                       |  |         46 0f b6 2c 29       	movzbl (%rcx,%r13,1),%r13d
+        rotated[i] = p[(head + i) % 16];
+    36f2:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    36f5:	|  |  |                       |  |         48 8d 68 02          	lea    0x2(%rax),%rbp
+    std::memcpy(&v, s, sizeof(v));
+    36f9:	|  |  |                       |  |         4c 09 fe             	or     %r15,%rsi
+        rotated[i] = p[(head + i) % 16];
+    36fc:	|  |  |                       |  |         48 89 7c 24 c8       	mov    %rdi,-0x38(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    3701:	|  |  |                       |  |         46 0f b6 24 21       	movzbl (%rcx,%r12,1),%r12d
+        rotated[i] = p[(head + i) % 16];
+    3706:	|  |  |                       |  |         83 e5 0f             	and    $0xf,%ebp
+    std::memcpy(&v, s, sizeof(v));
+    3709:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    370d:	|  |  |                       |  |         48 8d 78 09          	lea    0x9(%rax),%rdi
+    std::memcpy(&v, s, sizeof(v));
+    3711:	|  |  |                       |  |         0f b6 2c 29          	movzbl (%rcx,%rbp,1),%ebp
+        rotated[i] = p[(head + i) % 16];
+    3715:	|  |  |                       |  |         48 8d 58 01          	lea    0x1(%rax),%rbx
+    std::memcpy(&v, s, sizeof(v));
+    3719:	|  |  |                       |  |         4c 09 f6             	or     %r14,%rsi
+        rotated[i] = p[(head + i) % 16];
+    371c:	|  |  |                       |  |         49 89 fb             	mov    %rdi,%r11
+    371f:	|  |  |                       |  |         48 8d 78 0a          	lea    0xa(%rax),%rdi
+    3723:	|  |  |                       |  |         83 e3 0f             	and    $0xf,%ebx
+    std::memcpy(&v, s, sizeof(v));
+    3726:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    372a:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    372e:	|  |  |                       |  |         49 89 fa             	mov    %rdi,%r10
+    std::memcpy(&v, s, sizeof(v));
+    3731:	|  |  |                       |  |         4c 09 ee             	or     %r13,%rsi
+        rotated[i] = p[(head + i) % 16];
+    3734:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    3738:	|  |  |                       |  |         48 8d 78 0b          	lea    0xb(%rax),%rdi
+    373c:	|  |  |                       |  |         4c 89 5c 24 e0       	mov    %r11,-0x20(%rsp)
+    std::memcpy(&v, s, sizeof(v));
+    3741:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    3745:	|  |  |                       |  |         4c 8d 58 0f          	lea    0xf(%rax),%r11
+    3749:	|  |  |                       |  |         4c 89 54 24 e8       	mov    %r10,-0x18(%rsp)
+    374e:	|  |  |                       |  |         49 89 f9             	mov    %rdi,%r9
+    std::memcpy(&v, s, sizeof(v));
+    3751:	|  |  |                       |  |         4c 09 e6             	or     %r12,%rsi
+        rotated[i] = p[(head + i) % 16];
+    3754:	|  |  |                       |  |         41 83 e3 0f          	and    $0xf,%r11d
+    3758:	|  |  |                       |  |         4c 8d 50 0e          	lea    0xe(%rax),%r10
+    375c:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    3760:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+        rotated[i] = p[(head + i) % 16];
+    3764:	|  |  |                       |  |         41 83 e2 0f          	and    $0xf,%r10d
+    3768:	|  |  |                       |  |         4c 89 4c 24 f0       	mov    %r9,-0x10(%rsp)
+    376d:	|  |  |                       |  |         4c 8d 48 0d          	lea    0xd(%rax),%r9
+    std::memcpy(&v, s, sizeof(v));
+    3771:	|  |  |                       |  |         48 09 ee             	or     %rbp,%rsi
+    3774:	|  |  |                       |  |         0f b6 2c 19          	movzbl (%rcx,%rbx,1),%ebp
+    3778:	|  |  |                       |  |         46 0f b6 14 11       	movzbl (%rcx,%r10,1),%r10d
+        rotated[i] = p[(head + i) % 16];
+    377d:	|  |  |                       |  |         41 83 e1 0f          	and    $0xf,%r9d
+    std::memcpy(&v, s, sizeof(v));
+    3781:	|  |  |                       |  |         48 89 f3             	mov    %rsi,%rbx
+    3784:	|  |  |                       |  |         42 0f b6 34 19       	movzbl (%rcx,%r11,1),%esi
+    3789:	|  |  |                       |  |         46 0f b6 0c 09       	movzbl (%rcx,%r9,1),%r9d
+        rotated[i] = p[(head + i) % 16];
+    378e:	|  |  |                       |  |         48 8d 78 0c          	lea    0xc(%rax),%rdi
+    3792:	|  |  |                       |  |         83 e7 0f             	and    $0xf,%edi
+    std::memcpy(&v, s, sizeof(v));
+    3795:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    3799:	|  |  |                       |  |         4c 8b 5c 24 e0       	mov    -0x20(%rsp),%r11
+    379e:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    37a2:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    37a5:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    37a9:	|  |  |                       |  |         0f b6 2c 01          	movzbl (%rcx,%rax,1),%ebp
+    37ad:	|  |  |                       |  |         4c 09 d6             	or     %r10,%rsi
+    37b0:	|  |  |                       |  |         48 c1 e3 08          	shl    $0x8,%rbx
+    37b4:	|  |  |                       |  |         4c 8b 54 24 e8       	mov    -0x18(%rsp),%r10
+    37b9:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    37bd:	|  |  |                       |  |         4c 09 ce             	or     %r9,%rsi
+    37c0:	|  |  |                       |  |         4c 8b 4c 24 f0       	mov    -0x10(%rsp),%r9
+    37c5:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    37c9:	|  |  |                       |  |         48 09 eb             	or     %rbp,%rbx
+    37cc:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    37cf:	|  |  |                       |  |         42 0f b6 3c 09       	movzbl (%rcx,%r9,1),%edi
+    37d4:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    37d8:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    37db:	|  |  |                       |  |         42 0f b6 3c 11       	movzbl (%rcx,%r10,1),%edi
+    37e0:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    37e4:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    37e7:	|  |  |                       |  |         42 0f b6 3c 19       	movzbl (%rcx,%r11,1),%edi
+    37ec:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    37f0:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    37f3:	|  |  |                       |  |         48 8b 7c 24 c8       	mov    -0x38(%rsp),%rdi
+    37f8:	|  |  |                       |  |         48 89 5c 24 c8       	mov    %rbx,-0x38(%rsp)
+    37fd:	|  |  |                       |  |         48 c1 e6 08          	shl    $0x8,%rsi
+    3801:	|  |  |                       |  |         0f b6 3c 39          	movzbl (%rcx,%rdi,1),%edi
+    3805:	|  |  |                       |  |         48 09 fe             	or     %rdi,%rsi
+    }
+    Line16 const v = load16(rotated);
+    Index i = head;
+    for (; i + 64 <= n; i += 64) {
+    3808:	|  |  |                       |  |         48 8d 78 40          	lea    0x40(%rax),%rdi
+    380c:	|  |  |                       |  |         4c 01 c0             	add    %r8,%rax
+    std::memcpy(&v, s, sizeof(v));
+    380f:	|  |  |                       |  |         48 89 74 24 d0       	mov    %rsi,-0x30(%rsp)
+    3814:	|  |  |                       |  |         66 0f 6f 44 24 c8    	movdqa -0x38(%rsp),%xmm0
+    for (; i + 64 <= n; i += 64) {
+    381a:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    3820:	|  |  |                       |  |     /-> 48 89 fe             	mov    %rdi,%rsi
+    for (; i + 64 <= n; i += 64) {
+    3823:	|  |  |                       |  |     |   48 83 c7 40          	add    $0x40,%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    3827:	|  |  |                       |  |     |   66 0f e7 00          	movntdq %xmm0,(%rax)
+    382b:	|  |  |                       |  |     |   66 0f e7 40 10       	movntdq %xmm0,0x10(%rax)
+    3830:	|  |  |                       |  |     |   66 0f e7 40 20       	movntdq %xmm0,0x20(%rax)
+    3835:	|  |  |                       |  |     |   66 0f e7 40 30       	movntdq %xmm0,0x30(%rax)
+    for (; i + 64 <= n; i += 64) {
+    383a:	|  |  |                       |  |     |   48 83 c0 40          	add    $0x40,%rax
+    383e:	|  |  |                       |  |     |   48 39 fa             	cmp    %rdi,%rdx
+    3841:	|  |  |                       |  |     \-- 73 dd                	jae    3820 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2a0>
+        stream16(d + i, v);
+        stream16(d + i + 16, v);
+        stream16(d + i + 32, v);
+        stream16(d + i + 48, v);
+    }
+    for (; i + 16 <= n; i += 16) {
+    3843:	|  |  |                       |  |         48 8d 46 10          	lea    0x10(%rsi),%rax
+    3847:	|  |  |                       |  |         48 39 c2             	cmp    %rax,%rdx
+    384a:	|  |  |                       |  |  /----- 72 15                	jb     3861 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2e1>
+    384c:	|  |  |                       |  |  |      49 8d 78 f0          	lea    -0x10(%r8),%rdi
+    __builtin_ia32_movntdq(reinterpret_cast<Line16 *>(d), v);
+    3850:	|  |  |                       |  |  |  /-> 48 89 c6             	mov    %rax,%rsi
+    3853:	|  |  |                       |  |  |  |   66 0f e7 04 07       	movntdq %xmm0,(%rdi,%rax,1)
+    for (; i + 16 <= n; i += 16) {
+    3858:	|  |  |                       |  |  |  |   48 83 c0 10          	add    $0x10,%rax
+    385c:	|  |  |                       |  |  |  |   48 39 c2             	cmp    %rax,%rdx
+    385f:	|  |  |                       |  |  |  \-- 73 ef                	jae    3850 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2d0>
+        stream16(d + i, v);
+    }
+    __builtin_ia32_sfence();
+    3861:	|  |  |                       |  |  \----> 0f ae f8             	sfence
+    for (; i < n; ++i) {
+    3864:	|  |  |                       |  |         48 39 d6             	cmp    %rdx,%rsi
+    3867:	|  |  |                       |  |  /----- 73 1e                	jae    3887 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x307>
+    3869:	|  |  |                       |  |  |      0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+        d[i] = p[i % 16];
+    3870:	|  |  |                       |  |  |  /-> 48 89 f0             	mov    %rsi,%rax
+    3873:	|  |  |                       |  |  |  |   83 e0 0f             	and    $0xf,%eax
+    3876:	|  |  |                       |  |  |  |   0f b6 04 01          	movzbl (%rcx,%rax,1),%eax
+    387a:	|  |  |                       |  |  |  |   41 88 04 30          	mov    %al,(%r8,%rsi,1)
+    for (; i < n; ++i) {
+    387e:	|  |  |                       |  |  |  |   48 83 c6 01          	add    $0x1,%rsi
+    3882:	|  |  |                       |  |  |  |   48 39 f2             	cmp    %rsi,%rdx
+    3885:	|  |  |                       |  |  |  \-- 75 e9                	jne    3870 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x2f0>
+    }
+}
+    3887:	|  |  |                       |  |  \----> 5b                   	pop    %rbx
+    3888:	|  |  |                       |  |         5d                   	pop    %rbp
+    3889:	|  |  |                       |  |         41 5c                	pop    %r12
+    388b:	|  |  |                       |  |         41 5d                	pop    %r13
+    388d:	|  |  |                       |  |         41 5e                	pop    %r14
+    388f:	|  |  |                       |  |         41 5f                	pop    %r15
+    3891:	|  |  |                       |  |         c3                   	ret
+    3892:	|  |  |                       |  |         66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+    3898:	|  |  |                       |  \-------> 48 83 ff 06          	cmp    $0x6,%rdi
+    389c:	|  |  |  /--------------------|----------- 0f 86 e1 01 00 00    	jbe    3a83 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x503>
+        d[i] = p[i];
+    38a2:	|  |  |  |                    |            48 8b 31             	mov    (%rcx),%rsi
+    38a5:	|  |  |  |                    |            49 89 30             	mov    %rsi,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    38a8:	|  |  |  |                    |            48 83 f8 08          	cmp    $0x8,%rax
+    38ac:	+--|--|--|--------------------|----------- 0f 84 fe fd ff ff    	je     36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    38b2:	|  |  |  |                    |            48 8d 70 f7          	lea    -0x9(%rax),%rsi
+    38b6:	|  |  |  |                    |            4c 8d 48 f8          	lea    -0x8(%rax),%r9
+    38ba:	|  |  |  |                    |            48 83 fe 02          	cmp    $0x2,%rsi
+    38be:	|  |  |  |                    |            be 08 00 00 00       	mov    $0x8,%esi
+    38c3:	|  |  |  |                    |        /-- 76 15                	jbe    38da <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x35a>
+        d[i] = p[i];
+    38c5:	|  |  |  |  /-----------------|--------|-> 8b 3c 31             	mov    (%rcx,%rsi,1),%edi
+    38c8:	|  |  |  |  |                 |        |   41 89 3c 30          	mov    %edi,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    38cc:	|  |  |  |  |                 |        |   48 83 c6 04          	add    $0x4,%rsi
+    38d0:	|  |  |  |  |                 |        |   49 83 f9 04          	cmp    $0x4,%r9
+    38d4:	+--|--|--|--|-----------------|--------|-- 0f 84 d6 fd ff ff    	je     36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    38da:	|  |  |  |  |                 |        \-> 0f b6 3c 31          	movzbl (%rcx,%rsi,1),%edi
+    38de:	|  |  |  |  |                 |            41 88 3c 30          	mov    %dil,(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    38e2:	|  |  |  |  |                 |            48 8d 7e 01          	lea    0x1(%rsi),%rdi
+    38e6:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    38e9:	+--|--|--|--|-----------------|----------- 0f 83 c1 fd ff ff    	jae    36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    38ef:	|  |  |  |  |                 |            0f b6 7c 31 01       	movzbl 0x1(%rcx,%rsi,1),%edi
+    38f4:	|  |  |  |  |                 |            41 88 7c 30 01       	mov    %dil,0x1(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    38f9:	|  |  |  |  |                 |            48 8d 7e 02          	lea    0x2(%rsi),%rdi
+    38fd:	|  |  |  |  |                 |            48 39 c7             	cmp    %rax,%rdi
+    3900:	+--|--|--|--|-----------------|----------- 0f 83 aa fd ff ff    	jae    36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    3906:	|  |  |  |  |                 |            0f b6 7c 31 02       	movzbl 0x2(%rcx,%rsi,1),%edi
+    390b:	|  |  |  |  |                 |            41 88 7c 30 02       	mov    %dil,0x2(%r8,%rsi,1)
+    for (Index i = 0; i < head; ++i) {
+    3910:	+--|--|--|--|-----------------|----------- e9 9b fd ff ff       	jmp    36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    3915:	|  |  |  |  |                 |            0f 1f 00             	nopl   (%rax)
+    Length done = (n < 16) ? n : 16;
+    3918:	|  |  |  |  |                 \----------> 41 ba 10 00 00 00    	mov    $0x10,%r10d
+    391e:	|  |  |  |  |                              4c 39 d2             	cmp    %r10,%rdx
+    3921:	|  |  |  |  |                              4c 0f 46 d2          	cmovbe %rdx,%r10
+    std::memcpy(d, s, n);
+    3925:	|  |  |  |  |                              44 89 d0             	mov    %r10d,%eax
+    3928:	|  |  |  |  |                              41 83 fa 08          	cmp    $0x8,%r10d
+    392c:	|  |  |  |  |        /-------------------- 0f 82 cc 00 00 00    	jb     39fe <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47e>
+    3932:	|  |  |  |  |        |                     48 8b 06             	mov    (%rsi),%rax
+    3935:	|  |  |  |  |        |                     4c 8d 4f 08          	lea    0x8(%rdi),%r9
+    3939:	|  |  |  |  |        |                     49 83 e1 f8          	and    $0xfffffffffffffff8,%r9
+    393d:	|  |  |  |  |        |                     48 89 07             	mov    %rax,(%rdi)
+    3940:	|  |  |  |  |        |                     44 89 d0             	mov    %r10d,%eax
+    3943:	|  |  |  |  |        |                     48 8b 74 06 f8       	mov    -0x8(%rsi,%rax,1),%rsi
+    3948:	|  |  |  |  |        |                     48 89 74 07 f8       	mov    %rsi,-0x8(%rdi,%rax,1)
+    394d:	|  |  |  |  |        |                     48 89 f8             	mov    %rdi,%rax
+    3950:	|  |  |  |  |        |                     4c 29 c8             	sub    %r9,%rax
+    3953:	|  |  |  |  |        |                     48 29 c1             	sub    %rax,%rcx
+    3956:	|  |  |  |  |        |                     44 01 d0             	add    %r10d,%eax
+    3959:	|  |  |  |  |        |                     83 e0 f8             	and    $0xfffffff8,%eax
+    395c:	|  |  |  |  |        |                     83 f8 08             	cmp    $0x8,%eax
+    395f:	|  |  |  |  |  /-----|-------------------- 72 16                	jb     3977 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    3961:	|  |  |  |  |  |     |                     83 e0 f8             	and    $0xfffffff8,%eax
+    3964:	|  |  |  |  |  |     |                     31 f6                	xor    %esi,%esi
+    3966:	|  |  |  |  |  |     |                 /-> 89 f7                	mov    %esi,%edi
+    3968:	|  |  |  |  |  |     |                 |   83 c6 08             	add    $0x8,%esi
+    396b:	|  |  |  |  |  |     |                 |   4c 8b 1c 39          	mov    (%rcx,%rdi,1),%r11
+    396f:	|  |  |  |  |  |     |                 |   4d 89 1c 39          	mov    %r11,(%r9,%rdi,1)
+    3973:	|  |  |  |  |  |     |                 |   39 c6                	cmp    %eax,%esi
+    3975:	|  |  |  |  |  |     |                 \-- 72 ef                	jb     3966 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3e6>
+    while (done < n) {
+    3977:	|  |  |  |  |  >-----|-------------------> 49 39 d2             	cmp    %rdx,%r10
+    397a:	|  |  |  |  |  |     |           /-------- 72 33                	jb     39af <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    397c:	|  |  |  |  |  |     |     /-----|-------- e9 af 00 00 00       	jmp    3a30 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b0>
+    3981:	|  |  |  |  |  |     |     |     |         0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+    std::memcpy(d, s, n);
+    3988:	|  |  |  |  |  |     |     |     |     /-> 41 f6 c1 04          	test   $0x4,%r9b
+    398c:	|  |  |  |  |  |     |     |  /--|-----|-- 0f 85 9f 00 00 00    	jne    3a31 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4b1>
+    3992:	|  |  |  |  |  |     |     |  |  |     |   45 85 c9             	test   %r9d,%r9d
+    3995:	|  |  |  |  |  |  /--|-----|--|--|-----|-- 74 10                	je     39a7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    3997:	|  |  |  |  |  |  |  |     |  |  |     |   41 0f b6 08          	movzbl (%r8),%ecx
+    399b:	|  |  |  |  |  |  |  |     |  |  |     |   88 08                	mov    %cl,(%rax)
+    399d:	|  |  |  |  |  |  |  |     |  |  |     |   41 f6 c1 02          	test   $0x2,%r9b
+    39a1:	|  |  |  |  |  |  |  |  /--|--|--|-----|-- 0f 85 c9 00 00 00    	jne    3a70 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x4f0>
+        done += m;
+    39a7:	|  |  |  |  |  |  >--|--|--|--|--|-----|-> 4d 01 ca             	add    %r9,%r10
+    while (done < n) {
+    39aa:	|  |  |  |  |  |  |  |  |  |  |  |     |   49 39 d2             	cmp    %rdx,%r10
+    39ad:	|  |  |  |  |  |  |  |  |  |  |  |  /--|-- 73 4e                	jae    39fd <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x47d>
+        Length const m = (done < n - done) ? done : n - done;
+    39af:	|  |  |  |  |  |  |  |  |  |  |  >--|--|-> 49 89 d1             	mov    %rdx,%r9
+        copy(d + done, d, m);
+    39b2:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4b 8d 04 10          	lea    (%r8,%r10,1),%rax
+        Length const m = (done < n - done) ? done : n - done;
+    39b6:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 29 d1             	sub    %r10,%r9
+    39b9:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 39 d1             	cmp    %r10,%r9
+    39bc:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   4d 0f 47 ca          	cmova  %r10,%r9
+    std::memcpy(d, s, n);
+    39c0:	|  |  |  |  |  |  |  |  |  |  |  |  |  |   41 83 f9 08          	cmp    $0x8,%r9d
+    39c4:	|  |  |  |  |  |  |  |  |  |  |  |  |  \-- 72 c2                	jb     3988 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x408>
+    39c6:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 08             	mov    (%r8),%rcx
+    39c9:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 8d 78 08          	lea    0x8(%rax),%rdi
+        done += m;
+    39cd:	|  |  |  |  |  |  |  |  |  |  |  |  |      4d 01 ca             	add    %r9,%r10
+    std::memcpy(d, s, n);
+    39d0:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 83 e7 f8          	and    $0xfffffffffffffff8,%rdi
+    39d4:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 08             	mov    %rcx,(%rax)
+    39d7:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 89 c9             	mov    %r9d,%ecx
+    39da:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 8b 74 08 f8       	mov    -0x8(%r8,%rcx,1),%rsi
+    39df:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 89 74 08 f8       	mov    %rsi,-0x8(%rax,%rcx,1)
+    39e4:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 f8             	sub    %rdi,%rax
+    39e7:	|  |  |  |  |  |  |  |  |  |  |  |  |      4c 89 c6             	mov    %r8,%rsi
+    39ea:	|  |  |  |  |  |  |  |  |  |  |  |  |      48 29 c6             	sub    %rax,%rsi
+    39ed:	|  |  |  |  |  |  |  |  |  |  |  |  |      44 01 c8             	add    %r9d,%eax
+    39f0:	|  |  |  |  |  |  |  |  |  |  |  |  |      c1 e8 03             	shr    $0x3,%eax
+    39f3:	|  |  |  |  |  |  |  |  |  |  |  |  |      89 c1                	mov    %eax,%ecx
+    39f5:	|  |  |  |  |  |  |  |  |  |  |  |  |      f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    while (done < n) {
+    39f8:	|  |  |  |  |  |  |  |  |  |  |  |  |      49 39 d2             	cmp    %rdx,%r10
+    39fb:	|  |  |  |  |  |  |  |  |  |  |  \--|----- 72 b2                	jb     39af <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x42f>
+    39fd:	|  |  |  |  |  |  |  |  |  |  |     \----> c3                   	ret
+    std::memcpy(d, s, n);
+    39fe:	|  |  |  |  |  |  |  \--|--|--|----------> 41 f6 c2 04          	test   $0x4,%r10b
+    3a02:	|  |  |  |  |  |  |     |  |  |        /-- 0f 85 85 00 00 00    	jne    3a8d <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x50d>
+    3a08:	|  |  |  |  |  |  |     |  |  |        |   85 c0                	test   %eax,%eax
+    3a0a:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 67 ff ff ff    	je     3977 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    3a10:	|  |  |  |  |  |  |     |  |  |        |   0f b6 36             	movzbl (%rsi),%esi
+    3a13:	|  |  |  |  |  |  |     |  |  |        |   40 88 37             	mov    %sil,(%rdi)
+    3a16:	|  |  |  |  |  |  |     |  |  |        |   a8 02                	test   $0x2,%al
+    3a18:	|  |  |  |  |  +--|-----|--|--|--------|-- 0f 84 59 ff ff ff    	je     3977 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    3a1e:	|  |  |  |  |  |  |     |  |  |        |   0f b7 4c 01 fe       	movzwl -0x2(%rcx,%rax,1),%ecx
+    3a23:	|  |  |  |  |  |  |     |  |  |        |   66 89 4c 07 fe       	mov    %cx,-0x2(%rdi,%rax,1)
+    3a28:	|  |  |  |  |  +--|-----|--|--|--------|-- e9 4a ff ff ff       	jmp    3977 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    3a2d:	|  |  |  |  |  |  |     |  |  |        |   0f 1f 00             	nopl   (%rax)
+    3a30:	|  |  |  |  |  |  |     |  \--|--------|-> c3                   	ret
+    3a31:	|  |  |  |  |  |  |     |     \--------|-> 41 8b 08             	mov    (%r8),%ecx
+    3a34:	|  |  |  |  |  |  |     |              |   89 08                	mov    %ecx,(%rax)
+    3a36:	|  |  |  |  |  |  |     |              |   44 89 c9             	mov    %r9d,%ecx
+    3a39:	|  |  |  |  |  |  |     |              |   41 8b 74 08 fc       	mov    -0x4(%r8,%rcx,1),%esi
+    3a3e:	|  |  |  |  |  |  |     |              |   89 74 08 fc          	mov    %esi,-0x4(%rax,%rcx,1)
+    3a42:	|  |  |  |  |  |  +-----|--------------|-- e9 60 ff ff ff       	jmp    39a7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+        d[i] = p[i];
+    3a47:	|  \--|--|--|--|--|-----|--------------|-> 0f b6 39             	movzbl (%rcx),%edi
+    3a4a:	|     |  |  |  |  |     |              |   41 88 38             	mov    %dil,(%r8)
+    for (Index i = 0; i < head; ++i) {
+    3a4d:	|     |  |  |  |  |     |              |   40 f6 c6 0e          	test   $0xe,%sil
+    3a51:	+-----|--|--|--|--|-----|--------------|-- 0f 84 59 fc ff ff    	je     36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+        d[i] = p[i];
+    3a57:	|     |  |  |  |  |     |              |   0f b6 79 01          	movzbl 0x1(%rcx),%edi
+    3a5b:	|     |  |  |  |  |     |              |   41 88 78 01          	mov    %dil,0x1(%r8)
+    for (Index i = 0; i < head; ++i) {
+    3a5f:	|     |  |  |  |  |     |              |   48 83 f8 03          	cmp    $0x3,%rax
+    3a63:	\-----|--|--|--|--|-----|--------------|-- 0f 85 47 fc ff ff    	jne    36b0 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x130>
+    3a69:	      \--|--|--|--|-----|--------------|-- e9 7b fb ff ff       	jmp    35e9 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x69>
+    3a6e:	         |  |  |  |     |              |   66 90                	xchg   %ax,%ax
+    std::memcpy(d, s, n);
+    3a70:	         |  |  |  |     \--------------|-> 44 89 c9             	mov    %r9d,%ecx
+    3a73:	         |  |  |  |                    |   41 0f b7 74 08 fe    	movzwl -0x2(%r8,%rcx,1),%esi
+    3a79:	         |  |  |  |                    |   66 89 74 08 fe       	mov    %si,-0x2(%rax,%rcx,1)
+    3a7e:	         |  |  |  \--------------------|-- e9 24 ff ff ff       	jmp    39a7 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x427>
+    for (Index i = 0; i < head; ++i) {
+    3a83:	         \--|--|-----------------------|-> 49 89 c1             	mov    %rax,%r9
+    3a86:	            |  |                       |   31 f6                	xor    %esi,%esi
+    3a88:	            \--|-----------------------|-- e9 38 fe ff ff       	jmp    38c5 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x345>
+    std::memcpy(d, s, n);
+    3a8d:	               |                       \-> 8b 36                	mov    (%rsi),%esi
+    3a8f:	               |                           89 37                	mov    %esi,(%rdi)
+    3a91:	               |                           8b 4c 01 fc          	mov    -0x4(%rcx,%rax,1),%ecx
+    3a95:	               |                           89 4c 07 fc          	mov    %ecx,-0x4(%rdi,%rax,1)
+    3a99:	               \-------------------------- e9 d9 fe ff ff       	jmp    3977 <nel::elem::set_streaming(unsigned char*, unsigned char const*, unsigned long)+0x3f7>
+    3a9e:	                                           66 90                	xchg   %ax,%ax
+
+0000000000003aa0 <nel::free_aligned(void*)>:
+    return reinterpret_cast<Length *>(p)[-1];
+}
+
+void free_aligned(void *const p)
+{
+    if (p == nullptr) { return; }
+    3aa0:	    48 85 ff             	test   %rdi,%rdi
+    3aa3:	/-- 74 0b                	je     3ab0 <nel::free_aligned(void*)+0x10>
+    uint8_t *const u8p = reinterpret_cast<uint8_t *>(p);
+    std::free(u8p - offset_field(u8p));
+    3aa5:	|   48 2b 7f f8          	sub    -0x8(%rdi),%rdi
+    3aa9:	|   e9 82 d5 ff ff       	jmp    1030 <free@plt>
+    3aae:	|   66 90                	xchg   %ax,%ax
+}
+    3ab0:	\-> c3                   	ret
+    3ab1:	    66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    3ab8:	    00 00 00 00 
+    3abc:	    0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000003ac0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)>:
+
+void *realloc_aligned(void *const p, Length const align, Length const old_size,
+                      Length const new_size)
+{
+    3ac0:	                   41 56                	push   %r14
+            : fn_name_(fn_name)
+    3ac2:	                   48 8d 05 8f 06 00 00 	lea    0x68f(%rip),%rax        # 4158 <_IO_stdin_used+0x158>
+    3ac9:	                   41 55                	push   %r13
+    3acb:	                   66 48 0f 6e c8       	movq   %rax,%xmm1
+    3ad0:	                   41 54                	push   %r12
+    3ad2:	                   55                   	push   %rbp
+    3ad3:	                   48 89 cd             	mov    %rcx,%rbp
+    3ad6:	                   48 8d 0d 6b 06 00 00 	lea    0x66b(%rip),%rcx        # 4148 <_IO_stdin_used+0x148>
+    3add:	                   53                   	push   %rbx
+    3ade:	                   66 48 0f 6e c1       	movq   %rcx,%xmm0
+    3ae3:	                   66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    3ae7:	                   48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    3aeb:	                   c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    3af2:	                   00 
+            : fn_name_(fn_name)
+    3af3:	                   0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    3af7:	                   48 85 f6             	test   %rsi,%rsi
+    3afa:	/----------------- 0f 84 a0 00 00 00    	je     3ba0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    3b00:	|                  48 8d 46 ff          	lea    -0x1(%rsi),%rax
+    3b04:	|                  48 89 f3             	mov    %rsi,%rbx
+    3b07:	|                  48 85 f0             	test   %rsi,%rax
+    3b0a:	+----------------- 0f 85 90 00 00 00    	jne    3ba0 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xe0>
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+
+    // If realloc fails, old is still valid..
+    uint8_t *const new_base =
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    3b10:	|                  48 8d 34 2e          	lea    (%rsi,%rbp,1),%rsi
+    Length const old_offset = (old_p == nullptr) ? 0 : offset_field(old_p);
+    3b14:	|                  48 85 ff             	test   %rdi,%rdi
+    3b17:	|     /----------- 74 67                	je     3b80 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xc0>
+    3b19:	|     |            4c 8b 6f f8          	mov    -0x8(%rdi),%r13
+    uint8_t *const new_base =
+    3b1d:	|     |            49 89 d4             	mov    %rdx,%r12
+    uint8_t *const old_base = (old_p == nullptr) ? nullptr : old_p - old_offset;
+    3b20:	|     |            4c 29 ef             	sub    %r13,%rdi
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    3b23:	|     |            e8 98 d5 ff ff       	call   10c0 <realloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    3b28:	|     |            48 85 c0             	test   %rax,%rax
+    3b2b:	|  /--|----------- 0f 84 7e 00 00 00    	je     3baf <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    3b31:	|  |  |            48 8d 4c 18 07       	lea    0x7(%rax,%rbx,1),%rcx
+    3b36:	|  |  |            48 f7 db             	neg    %rbx
+    3b39:	|  |  |            48 21 cb             	and    %rcx,%rbx
+    3b3c:	|  |  |            49 89 de             	mov    %rbx,%r14
+    3b3f:	|  |  |            49 29 c6             	sub    %rax,%r14
+
+    Length const new_offset = offset_of(new_base, align);
+    uint8_t *const new_p = new_base + new_offset;
+    if (old_p != nullptr && new_offset != old_offset) {
+    3b42:	|  |  |            4d 39 f5             	cmp    %r14,%r13
+    3b45:	|  |  |        /-- 75 19                	jne    3b60 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xa0>
+        // shift content onto the new boundary.
+        // Shame realloc cannot be told to do this.
+        Length const n = (old_size < new_size) ? old_size : new_size;
+        std::memmove(new_p, new_base + old_offset, n);
+    }
+    offset_field(new_p) = new_offset;
+    3b47:	|  |  |     /--|-> 4c 89 73 f8          	mov    %r14,-0x8(%rbx)
+    return new_p;
+}
+    3b4b:	|  |  |  /--|--|-> 48 83 c4 20          	add    $0x20,%rsp
+    3b4f:	|  |  |  |  |  |   48 89 d8             	mov    %rbx,%rax
+    3b52:	|  |  |  |  |  |   5b                   	pop    %rbx
+    3b53:	|  |  |  |  |  |   5d                   	pop    %rbp
+    3b54:	|  |  |  |  |  |   41 5c                	pop    %r12
+    3b56:	|  |  |  |  |  |   41 5d                	pop    %r13
+    3b58:	|  |  |  |  |  |   41 5e                	pop    %r14
+    3b5a:	|  |  |  |  |  |   c3                   	ret
+    3b5b:	|  |  |  |  |  |   0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+        std::memmove(new_p, new_base + old_offset, n);
+    3b60:	|  |  |  |  |  \-> 4c 39 e5             	cmp    %r12,%rbp
+    3b63:	|  |  |  |  |      4c 89 e2             	mov    %r12,%rdx
+    3b66:	|  |  |  |  |      4a 8d 34 28          	lea    (%rax,%r13,1),%rsi
+    3b6a:	|  |  |  |  |      48 89 df             	mov    %rbx,%rdi
+    3b6d:	|  |  |  |  |      48 0f 46 d5          	cmovbe %rbp,%rdx
+    3b71:	|  |  |  |  |      e8 5a d5 ff ff       	call   10d0 <memmove@plt>
+    3b76:	|  |  |  |  +----- eb cf                	jmp    3b47 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+    3b78:	|  |  |  |  |      0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    3b7f:	|  |  |  |  |      00 
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    3b80:	|  |  \--|--|----> 48 89 f7             	mov    %rsi,%rdi
+    3b83:	|  |     |  |      e8 28 d5 ff ff       	call   10b0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    3b88:	|  |     |  |      48 85 c0             	test   %rax,%rax
+    3b8b:	|  +-----|--|----- 74 22                	je     3baf <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0xef>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    3b8d:	|  |     |  |      48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    3b92:	|  |     |  |      48 f7 db             	neg    %rbx
+    3b95:	|  |     |  |      48 21 d3             	and    %rdx,%rbx
+    3b98:	|  |     |  |      49 89 de             	mov    %rbx,%r14
+    3b9b:	|  |     |  |      49 29 c6             	sub    %rax,%r14
+    if (old_p != nullptr && new_offset != old_offset) {
+    3b9e:	|  |     |  \----- eb a7                	jmp    3b47 <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x87>
+    if (!pred) { assert_fail(msg, ctx); }
+    3ba0:	\--|-----|-------> 48 89 e6             	mov    %rsp,%rsi
+    3ba3:	   |     |         48 8d 3d c0 05 00 00 	lea    0x5c0(%rip),%rdi        # 416a <_IO_stdin_used+0x16a>
+    3baa:	   |     |         e8 a3 d5 ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    if (new_base == nullptr) { return nullptr; }
+    3baf:	   \-----|-------> 31 db                	xor    %ebx,%ebx
+    3bb1:	         \-------- eb 98                	jmp    3b4b <nel::realloc_aligned(void*, unsigned long, unsigned long, unsigned long)+0x8b>
+    3bb3:	                   66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    3bba:	                   00 00 00 00 
+    3bbe:	                   66 90                	xchg   %ax,%ax
+
+0000000000003bc0 <nel::malloc_aligned(unsigned long, unsigned long)>:
+
+void *malloc_aligned(Length const align, Length const size)
+{
+    3bc0:	       53                   	push   %rbx
+            : fn_name_(fn_name)
+    3bc1:	       48 8d 05 90 05 00 00 	lea    0x590(%rip),%rax        # 4158 <_IO_stdin_used+0x158>
+    3bc8:	       48 8d 0d 79 05 00 00 	lea    0x579(%rip),%rcx        # 4148 <_IO_stdin_used+0x148>
+    3bcf:	       66 48 0f 6e c1       	movq   %rcx,%xmm0
+    3bd4:	       66 48 0f 6e c8       	movq   %rax,%xmm1
+    3bd9:	       66 0f 6c c1          	punpcklqdq %xmm1,%xmm0
+    3bdd:	       48 83 ec 20          	sub    $0x20,%rsp
+            , line_num_(line_num)
+    3be1:	       c7 44 24 10 f3 00 00 	movl   $0xf3,0x10(%rsp)
+    3be8:	       00 
+            : fn_name_(fn_name)
+    3be9:	       0f 29 04 24          	movaps %xmm0,(%rsp)
+    nel::assert(align != 0 && (align & (align - 1)) == 0, "align must be a power of 2");
+    3bed:	       48 85 ff             	test   %rdi,%rdi
+    3bf0:	/----- 74 35                	je     3c27 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+    3bf2:	|      48 8d 47 ff          	lea    -0x1(%rdi),%rax
+    3bf6:	|      48 89 fb             	mov    %rdi,%rbx
+    3bf9:	|      48 85 f8             	test   %rdi,%rax
+    3bfc:	+----- 75 29                	jne    3c27 <nel::malloc_aligned(unsigned long, unsigned long)+0x67>
+        reinterpret_cast<uint8_t *>(std::realloc(old_base, new_size + align));
+    3bfe:	|      48 8d 3c 37          	lea    (%rdi,%rsi,1),%rdi
+    3c02:	|      e8 a9 d4 ff ff       	call   10b0 <malloc@plt>
+    if (new_base == nullptr) { return nullptr; }
+    3c07:	|      48 85 c0             	test   %rax,%rax
+    3c0a:	|  /-- 74 15                	je     3c21 <nel::malloc_aligned(unsigned long, unsigned long)+0x61>
+    return ((a + align - 1) & ~(align - 1)) - reinterpret_cast<USize>(base);
+    3c0c:	|  |   48 8d 54 18 07       	lea    0x7(%rax,%rbx,1),%rdx
+    3c11:	|  |   48 f7 db             	neg    %rbx
+    3c14:	|  |   48 21 da             	and    %rbx,%rdx
+    3c17:	|  |   48 29 c2             	sub    %rax,%rdx
+    uint8_t *const new_p = new_base + new_offset;
+    3c1a:	|  |   48 01 d0             	add    %rdx,%rax
+    offset_field(new_p) = new_offset;
+    3c1d:	|  |   48 89 50 f8          	mov    %rdx,-0x8(%rax)
+    return realloc_aligned(nullptr, align, 0, size);
+}
+    3c21:	|  \-> 48 83 c4 20          	add    $0x20,%rsp
+    3c25:	|      5b                   	pop    %rbx
+    3c26:	|      c3                   	ret
+    if (!pred) { assert_fail(msg, ctx); }
+    3c27:	\----> 48 89 e6             	mov    %rsp,%rsi
+    3c2a:	       48 8d 3d 39 05 00 00 	lea    0x539(%rip),%rdi        # 416a <_IO_stdin_used+0x16a>
+    3c31:	       e8 1c d5 ff ff       	call   1152 <nel::assert_fail(char const*, nel::Context const&)>
+    3c36:	       66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+    3c3d:	       00 00 00 
+
+0000000000003c40 <nel::operator<<(nel::Log&, char)>:
+namespace nel
+{
+Log log;
+
+Log &operator<<(Log &outs, char v)
+{
+    3c40:	53                   	push   %rbx
+    3c41:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%c", v);
+    3c44:	40 0f be fe          	movsbl %sil,%edi
+    3c48:	48 8b 35 31 24 00 00 	mov    0x2431(%rip),%rsi        # 6080 <stderr@GLIBC_2.2.5>
+    3c4f:	e8 1c d4 ff ff       	call   1070 <fputc@plt>
+    return outs;
+}
+    3c54:	48 89 d8             	mov    %rbx,%rax
+    3c57:	5b                   	pop    %rbx
+    3c58:	c3                   	ret
+    3c59:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000003c60 <nel::operator<<(nel::Log&, char const*)>:
+
+Log &operator<<(Log &outs, char const *v)
+{
+    3c60:	53                   	push   %rbx
+    3c61:	48 89 fb             	mov    %rdi,%rbx
+    3c64:	48 89 f7             	mov    %rsi,%rdi
+    fprintf(stderr, "%s", v);
+    3c67:	48 8b 35 12 24 00 00 	mov    0x2412(%rip),%rsi        # 6080 <stderr@GLIBC_2.2.5>
+    3c6e:	e8 dd d3 ff ff       	call   1050 <fputs@plt>
+    return outs;
+}
+    3c73:	48 89 d8             	mov    %rbx,%rax
+    3c76:	5b                   	pop    %rbx
+    3c77:	c3                   	ret
+    3c78:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+    3c7f:	00 
+
+0000000000003c80 <nel::operator<<(nel::Log&, unsigned char)>:
+
+Log &operator<<(Log &outs, uint8_t const v)
+{
+    3c80:	53                   	push   %rbx
+    3c81:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu8, v);
+    3c84:	48 8b 3d f5 23 00 00 	mov    0x23f5(%rip),%rdi        # 6080 <stderr@GLIBC_2.2.5>
+    3c8b:	40 0f b6 d6          	movzbl %sil,%edx
+    3c8f:	31 c0                	xor    %eax,%eax
+    3c91:	48 8d 35 ed 04 00 00 	lea    0x4ed(%rip),%rsi        # 4185 <_IO_stdin_used+0x185>
+    3c98:	e8 f3 d3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    3c9d:	48 89 d8             	mov    %rbx,%rax
+    3ca0:	5b                   	pop    %rbx
+    3ca1:	c3                   	ret
+    3ca2:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    3ca9:	00 00 00 00 
+    3cad:	0f 1f 00             	nopl   (%rax)
+
+0000000000003cb0 <nel::operator<<(nel::Log&, unsigned short)>:
+
+Log &operator<<(Log &outs, uint16_t const v)
+{
+    3cb0:	53                   	push   %rbx
+    3cb1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu16, v);
+    3cb4:	48 8b 3d c5 23 00 00 	mov    0x23c5(%rip),%rdi        # 6080 <stderr@GLIBC_2.2.5>
+    3cbb:	0f b7 d6             	movzwl %si,%edx
+    3cbe:	31 c0                	xor    %eax,%eax
+    3cc0:	48 8d 35 be 04 00 00 	lea    0x4be(%rip),%rsi        # 4185 <_IO_stdin_used+0x185>
+    3cc7:	e8 c4 d3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    3ccc:	48 89 d8             	mov    %rbx,%rax
+    3ccf:	5b                   	pop    %rbx
+    3cd0:	c3                   	ret
+    3cd1:	66 66 2e 0f 1f 84 00 	data16 cs nopw 0x0(%rax,%rax,1)
+    3cd8:	00 00 00 00 
+    3cdc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000003ce0 <nel::operator<<(nel::Log&, unsigned int)>:
+
+Log &operator<<(Log &outs, uint32_t const v)
+{
+    3ce0:	53                   	push   %rbx
+    3ce1:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%" PRIu32, v);
+    3ce4:	48 8b 3d 95 23 00 00 	mov    0x2395(%rip),%rdi        # 6080 <stderr@GLIBC_2.2.5>
+{
+    3ceb:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%" PRIu32, v);
+    3ced:	31 c0                	xor    %eax,%eax
+    3cef:	48 8d 35 8f 04 00 00 	lea    0x48f(%rip),%rsi        # 4185 <_IO_stdin_used+0x185>
+    3cf6:	e8 95 d3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    3cfb:	48 89 d8             	mov    %rbx,%rax
+    3cfe:	5b                   	pop    %rbx
+    3cff:	c3                   	ret
+
+0000000000003d00 <nel::operator<<(nel::Log&, int)>:
+
+Log &operator<<(Log &outs, int const v)
+{
+    3d00:	53                   	push   %rbx
+    3d01:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%u", v);
+    3d04:	48 8b 3d 75 23 00 00 	mov    0x2375(%rip),%rdi        # 6080 <stderr@GLIBC_2.2.5>
+{
+    3d0b:	89 f2                	mov    %esi,%edx
+    fprintf(stderr, "%u", v);
+    3d0d:	31 c0                	xor    %eax,%eax
+    3d0f:	48 8d 35 6f 04 00 00 	lea    0x46f(%rip),%rsi        # 4185 <_IO_stdin_used+0x185>
+    3d16:	e8 75 d3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    3d1b:	48 89 d8             	mov    %rbx,%rax
+    3d1e:	5b                   	pop    %rbx
+    3d1f:	c3                   	ret
+
+0000000000003d20 <nel::operator<<(nel::Log&, unsigned long)>:
+
+Log &operator<<(Log &outs, long unsigned int const v)
+{
+    3d20:	53                   	push   %rbx
+    3d21:	48 89 fb             	mov    %rdi,%rbx
+    fprintf(stderr, "%lu", v);
+    3d24:	48 8b 3d 55 23 00 00 	mov    0x2355(%rip),%rdi        # 6080 <stderr@GLIBC_2.2.5>
+{
+    3d2b:	48 89 f2             	mov    %rsi,%rdx
+    fprintf(stderr, "%lu", v);
+    3d2e:	31 c0                	xor    %eax,%eax
+    3d30:	48 8d 35 51 04 00 00 	lea    0x451(%rip),%rsi        # 4188 <_IO_stdin_used+0x188>
+    3d37:	e8 54 d3 ff ff       	call   1090 <fprintf@plt>
+    return outs;
+}
+    3d3c:	48 89 d8             	mov    %rbx,%rax
+    3d3f:	5b                   	pop    %rbx
+    3d40:	c3                   	ret
+
+Disassembly of section .fini:
+
+0000000000003d44 <_fini>:
+    3d44:	48 83 ec 08          	sub    $0x8,%rsp
+    3d48:	48 83 c4 08          	add    $0x8,%rsp
+    3d4c:	c3                   	ret